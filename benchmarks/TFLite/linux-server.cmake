@@ -0,0 +1,87 @@
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+################################################################################
+#                                                                              #
+# Server CPU benchmark configurations                                          #
+#                                                                              #
+# Sweeps the thread counts used on many-core server CPUs (x86_64 and ARM64     #
+# Graviton-class machines). As with the default configurations only the        #
+# target architecture and runtime characteristics are configured here.         #
+#                                                                              #
+################################################################################
+
+set(LINUX_X86_64_SERVER_CPU_COMPILATION_FLAGS
+  "--iree-input-type=tosa"
+  "--iree-llvm-target-cpu=cascadelake"
+  "--iree-llvm-target-triple=x86_64-unknown-linux-gnu"
+)
+
+set(LINUX_ARM64_SERVER_CPU_COMPILATION_FLAGS
+  "--iree-input-type=tosa"
+  "--iree-llvm-target-cpu=neoverse-n1"
+  "--iree-llvm-target-triple=aarch64-none-linux-gnu"
+)
+
+foreach(_THREAD_COUNT 16 32 64)
+  # CPU, Dylib, N threads, x86_64, full-inference
+  iree_benchmark_suite(
+    GROUP_NAME
+      "linux-x86_64-server"
+
+    MODULES
+      "${DEEPLABV3_FP32_MODULE}"
+      "${MOBILESSD_FP32_MODULE}"
+      "${MOBILEBERT_FP32_MODULE}"
+      "${MOBILENET_V2_MODULE}"
+
+    BENCHMARK_MODES
+      "${_THREAD_COUNT}-thread,full-inference,default-flags"
+    TARGET_BACKEND
+      "dylib-llvm-aot"
+    TARGET_ARCHITECTURE
+      "CPU-x86_64-CascadeLake"
+    COMPILATION_FLAGS
+      ${LINUX_X86_64_SERVER_CPU_COMPILATION_FLAGS}
+    BENCHMARK_TOOL
+      iree-benchmark-module
+    CONFIG
+      "iree-dylib"
+    DRIVER
+      "local-task"
+    RUNTIME_FLAGS
+      "--task_topology_group_count=${_THREAD_COUNT}"
+  )
+
+  # CPU, Dylib, N threads, ARM64 Neoverse-N1, full-inference
+  iree_benchmark_suite(
+    GROUP_NAME
+      "linux-arm64-server"
+
+    MODULES
+      "${DEEPLABV3_FP32_MODULE}"
+      "${MOBILESSD_FP32_MODULE}"
+      "${MOBILEBERT_FP32_MODULE}"
+      "${MOBILENET_V2_MODULE}"
+
+    BENCHMARK_MODES
+      "${_THREAD_COUNT}-thread,full-inference,default-flags"
+    TARGET_BACKEND
+      "dylib-llvm-aot"
+    TARGET_ARCHITECTURE
+      "CPU-ARM64-v8A-NeoverseN1"
+    COMPILATION_FLAGS
+      ${LINUX_ARM64_SERVER_CPU_COMPILATION_FLAGS}
+    BENCHMARK_TOOL
+      iree-benchmark-module
+    CONFIG
+      "iree-dylib"
+    DRIVER
+      "local-task"
+    RUNTIME_FLAGS
+      "--task_topology_group_count=${_THREAD_COUNT}"
+  )
+endforeach()
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+"""Benchmarks each dispatch of a model and writes the times as JSON.
+
+The dispatches are taken from the standalone benchmark modules dumped by
+`iree-compile --iree-hal-dump-executable-benchmarks-to=<dir>`, which have one
+benchmark function per dispatch with bindings sized like in the model. Each
+module is compiled, run with `iree-benchmark-module --benchmark_format=json`
+and the mean time of every dispatch is recorded:
+
+  {
+    "dispatches": [
+      {"name": "<benchmark function>", "source": "<file>", "real_time_ns": ...},
+      ...
+    ]
+  }
+
+Example usage:
+  benchmark_dispatches.py --dispatch_dir=<dir> -o dispatches.json \
+    --target_backend=dylib-llvm-aot --driver=local-task \
+    --iree_compile=<build>/tools/iree-compile \
+    --iree_benchmark_module=<build>/tools/iree-benchmark-module
+"""
+
+import argparse
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+from typing import Dict, List
+
+UNIT_SCALES = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def parse_benchmark_results(benchmark_output: str) -> Dict[str, float]:
+  """Returns the mean real time in ns of each benchmark function in the output
+  of `iree-benchmark-module --benchmark_format=json`."""
+  benchmarks = json.loads(benchmark_output)["benchmarks"]
+  aggregates = [b for b in benchmarks if b.get("aggregate_name") == "mean"]
+  times = {}
+  for benchmark in aggregates or benchmarks:
+    # Names look like `BM_<function>/process_time/real_time[_mean]`.
+    name = benchmark.get("run_name", benchmark["name"]).split("/")[0]
+    if name.startswith("BM_"):
+      name = name[len("BM_"):]
+    times.setdefault(name, []).append(benchmark["real_time"] *
+                                      UNIT_SCALES[benchmark["time_unit"]])
+  return {name: sum(values) / len(values) for name, values in times.items()}
+
+
+def benchmark_source(args: argparse.Namespace, source: str,
+                     work_dir: str) -> List[Dict]:
+  module = os.path.join(work_dir, "dispatch.vmfb")
+  compile_cmd = [
+      args.iree_compile,
+      source,
+      f"--iree-hal-target-backends={args.target_backend}",
+      "-o",
+      module,
+  ] + args.compile_flags
+  result = subprocess.run(compile_cmd,
+                          stdout=subprocess.PIPE,
+                          stderr=subprocess.PIPE,
+                          universal_newlines=True)
+  if result.returncode != 0:
+    print(f"warning: failed to compile {source}:\n{result.stderr}",
+          file=sys.stderr)
+    return []
+  benchmark_cmd = [
+      args.iree_benchmark_module,
+      f"--module_file={module}",
+      f"--device={args.driver}",
+      "--benchmark_format=json",
+      f"--benchmark_repetitions={args.repetitions}",
+      "--benchmark_report_aggregates_only=true",
+  ]
+  result = subprocess.run(benchmark_cmd,
+                          stdout=subprocess.PIPE,
+                          stderr=subprocess.PIPE,
+                          universal_newlines=True)
+  if result.returncode != 0:
+    print(f"warning: failed to benchmark {source}:\n{result.stderr}",
+          file=sys.stderr)
+    return []
+  return [{
+      "name": name,
+      "source": os.path.basename(source),
+      "real_time_ns": time,
+  } for name, time in sorted(parse_benchmark_results(result.stdout).items())]
+
+
+def parse_arguments():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument(
+      "--dispatch_dir",
+      required=True,
+      help="Directory of dispatch benchmark modules dumped by iree-compile")
+  parser.add_argument("-o",
+                      "--output",
+                      default="-",
+                      help="Path of the JSON output, or - for stdout")
+  parser.add_argument("--iree_compile", default="iree-compile")
+  parser.add_argument("--iree_benchmark_module",
+                      default="iree-benchmark-module")
+  parser.add_argument("--target_backend", default="dylib-llvm-aot")
+  parser.add_argument("--driver", default="local-task")
+  parser.add_argument("--compile_flags",
+                      nargs="*",
+                      default=[],
+                      help="Additional iree-compile flags")
+  parser.add_argument("--repetitions", type=int, default=5)
+  return parser.parse_args()
+
+
+def main(args):
+  sources = sorted(
+      os.path.join(args.dispatch_dir, name)
+      for name in os.listdir(args.dispatch_dir)
+      if name.endswith(".mlir"))
+  dispatches = []
+  with tempfile.TemporaryDirectory() as work_dir:
+    for source in sources:
+      dispatches.extend(benchmark_source(args, source, work_dir))
+  report = json.dumps({"dispatches": dispatches}, indent=2)
+  if args.output == "-":
+    print(report)
+  else:
+    with open(args.output, "w") as f:
+      f.write(report + "\n")
+
+
+if __name__ == "__main__":
+  main(parse_arguments())
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import json
+import unittest
+
+from benchmark_dispatches import parse_benchmark_results
+
+
+class BenchmarkDispatchesTest(unittest.TestCase):
+
+  def test_parse_benchmark_results_aggregates(self):
+    output = json.dumps({
+        "benchmarks": [
+            {
+                "name": "BM_matmul_64x64/process_time/real_time_mean",
+                "run_name": "BM_matmul_64x64/process_time/real_time",
+                "aggregate_name": "mean",
+                "real_time": 2.0,
+                "time_unit": "us"
+            },
+            {
+                "name": "BM_matmul_64x64/process_time/real_time_stddev",
+                "run_name": "BM_matmul_64x64/process_time/real_time",
+                "aggregate_name": "stddev",
+                "real_time": 0.5,
+                "time_unit": "us"
+            },
+            {
+                "name": "BM_fill_64/process_time/real_time_mean",
+                "run_name": "BM_fill_64/process_time/real_time",
+                "aggregate_name": "mean",
+                "real_time": 500.0,
+                "time_unit": "ns"
+            },
+        ]
+    })
+
+    self.assertEqual(parse_benchmark_results(output), {
+        "matmul_64x64": 2000.0,
+        "fill_64": 500.0,
+    })
+
+  def test_parse_benchmark_results_repetitions(self):
+    output = json.dumps({
+        "benchmarks": [
+            {
+                "name": "BM_fill_64/process_time/real_time",
+                "real_time": 1.0,
+                "time_unit": "ms"
+            },
+            {
+                "name": "BM_fill_64/process_time/real_time",
+                "real_time": 3.0,
+                "time_unit": "ms"
+            },
+        ]
+    })
+
+    self.assertEqual(parse_benchmark_results(output), {"fill_64": 2e6})
+
+
+if __name__ == "__main__":
+  unittest.main()
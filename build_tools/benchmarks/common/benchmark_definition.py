@@ -37,7 +37,7 @@ GPU_NAME_TO_TARGET_ARCH_MAP = {
 }
 
 # A map of canonical microarchitecture names.
-CANONICAL_MICROARCHITECTURE_NAMES = {"CascadeLake", "Zen2"}
+CANONICAL_MICROARCHITECTURE_NAMES = {"CascadeLake", "NeoverseN1", "Zen2"}
 
 
 @dataclass
@@ -438,6 +438,23 @@ class BenchmarkResults(object):
       raise ValueError(f"Cannot found real_time_{kind} in benchmark results")
     return time
 
+  def get_aggregate_counter(self, benchmark_index: int, kind: str,
+                            counter_name: str) -> Optional[float]:
+    """Returns the Google Benchmark aggregate of a user counter, or None if the
+    benchmark didn't report the counter.
+
+      Args:
+      - benchmark_index: the benchmark's index.
+      - kind: what kind of aggregate to get; choices:
+        'mean', 'median', 'stddev'.
+      - counter_name: the counter name, e.g., 'p99_latency_ms'.
+      """
+    for bench_case in self.benchmarks[benchmark_index].results:
+      if bench_case["name"].endswith(f"real_time_{kind}"):
+        value = bench_case.get(counter_name)
+        return None if value is None else float(value)
+    return None
+
   def to_json_str(self) -> str:
     json_object = {"commit": self.commit, "benchmarks": []}
     json_object["benchmarks"] = [b.to_json_object() for b in self.benchmarks]
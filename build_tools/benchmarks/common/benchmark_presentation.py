@@ -13,7 +13,7 @@ from dataclasses import dataclass
 from typing import Any, Callable, Dict, Generic, List, Optional, Sequence, Tuple, TypeVar
 
 from common.benchmark_definition import BenchmarkResults, CompilationInfo, CompilationResults
-from common.benchmark_thresholds import BENCHMARK_THRESHOLDS, COMPILATION_TIME_THRESHOLDS, TOTAL_DISPATCH_SIZE_THRESHOLDS, BenchmarkThreshold, ThresholdUnit
+from common.benchmark_thresholds import BENCHMARK_THRESHOLDS, COMPILATION_TIME_THRESHOLDS, P99_LATENCY_THRESHOLDS, PEAK_MEMORY_THRESHOLDS, TOTAL_DISPATCH_SIZE_THRESHOLDS, BenchmarkThreshold, ThresholdUnit
 
 GetMetricFunc = Callable[[Any], Tuple[int, Optional[int]]]
 GetTableRowFunc = Callable[[str, Any], Tuple]
@@ -25,8 +25,17 @@ BENCHMARK_RESULTS_HEADERS = [
     "Median Latency (ms)",
     "Latency Standard Deviation (ms)",
 ]
+RUNTIME_METRICS_HEADERS = [
+    "Benchmark Name",
+    "P50 Latency (ms)",
+    "P99 Latency (ms)",
+    "Throughput (inferences/s)",
+    "Peak Memory (bytes)",
+]
 COMPILATION_TIME_SERIES_SUFFIX = "compilation:module:compilation-time"
 TOTAL_DISPATCH_SIZE_SERIES_SUFFIX = "compilation:module:component-size:total-dispatch-size"
+P99_LATENCY_SERIES_SUFFIX = "runtime:latency:p99"
+PEAK_MEMORY_SERIES_SUFFIX = "runtime:memory:peak"
 
 
 @dataclass
@@ -37,6 +46,14 @@ class AggregateBenchmarkLatency:
   stddev_time: int
   # The average latency time for the base commit to compare against.
   base_mean_time: Optional[int] = None
+  # Optional runtime metrics; None if the benchmark tool didn't report them.
+  p50_time: Optional[int] = None
+  p99_time: Optional[int] = None
+  throughput: Optional[float] = None
+  peak_memory: Optional[int] = None
+  # The above metrics for the base commit to compare against.
+  base_p99_time: Optional[int] = None
+  base_peak_memory: Optional[int] = None
 
 
 @dataclass
@@ -134,6 +151,60 @@ class TotalDispatchSizeToTable(MetricsToTableMapper[CompilationMetrics]):
     return "Total Dispatch Size (bytes)"
 
 
+class P99LatencyToTable(MetricsToTableMapper[AggregateBenchmarkLatency]):
+  """Helper to map AggregateBenchmarkLatency to p99 latency column."""
+
+  def get_current_and_base_value(
+      self,
+      benchmark: AggregateBenchmarkLatency) -> Tuple[int, Optional[int]]:
+    return (benchmark.p99_time, benchmark.base_p99_time)
+
+  def get_series_name(self, name: str) -> str:
+    return f"{name} [{P99_LATENCY_SERIES_SUFFIX}]"
+
+  @staticmethod
+  def get_metric_thresholds() -> Sequence[BenchmarkThreshold]:
+    return P99_LATENCY_THRESHOLDS
+
+  @staticmethod
+  def get_table_title() -> str:
+    return "P99 Latencies"
+
+  @staticmethod
+  def get_table_header() -> str:
+    return "P99 Latency (ms)"
+
+
+class PeakMemoryToTable(MetricsToTableMapper[AggregateBenchmarkLatency]):
+  """Helper to map AggregateBenchmarkLatency to peak memory column."""
+
+  def get_current_and_base_value(
+      self,
+      benchmark: AggregateBenchmarkLatency) -> Tuple[int, Optional[int]]:
+    return (benchmark.peak_memory, benchmark.base_peak_memory)
+
+  def get_series_name(self, name: str) -> str:
+    return f"{name} [{PEAK_MEMORY_SERIES_SUFFIX}]"
+
+  @staticmethod
+  def get_metric_thresholds() -> Sequence[BenchmarkThreshold]:
+    return PEAK_MEMORY_THRESHOLDS
+
+  @staticmethod
+  def get_table_title() -> str:
+    return "Peak Memory Usages"
+
+  @staticmethod
+  def get_table_header() -> str:
+    return "Peak Memory (bytes)"
+
+
+RUNTIME_METRICS_TO_TABLE_MAPPERS: List[
+    MetricsToTableMapper[AggregateBenchmarkLatency]] = [
+        P99LatencyToTable(),
+        PeakMemoryToTable(),
+    ]
+
 COMPILATION_METRICS_TO_TABLE_MAPPERS: List[
     MetricsToTableMapper[CompilationMetrics]] = [
         CompilationTimeToTable(),
@@ -179,9 +250,23 @@ def aggregate_all_benchmarks(
       mean_time = file_results.get_aggregate_time(benchmark_index, "mean")
       median_time = file_results.get_aggregate_time(benchmark_index, "median")
       stddev_time = file_results.get_aggregate_time(benchmark_index, "stddev")
+      p50_time = file_results.get_aggregate_counter(benchmark_index, "mean",
+                                                    "p50_latency_ms")
+      p99_time = file_results.get_aggregate_counter(benchmark_index, "mean",
+                                                    "p99_latency_ms")
+      throughput = file_results.get_aggregate_counter(
+          benchmark_index, "mean", "throughput_per_second")
+      peak_memory = file_results.get_aggregate_counter(
+          benchmark_index, "mean", "peak_memory_bytes")
 
       aggregate_results[name] = AggregateBenchmarkLatency(
-          mean_time, median_time, stddev_time)
+          mean_time,
+          median_time,
+          stddev_time,
+          p50_time=None if p50_time is None else int(round(p50_time)),
+          p99_time=None if p99_time is None else int(round(p99_time)),
+          throughput=throughput,
+          peak_memory=None if peak_memory is None else int(round(peak_memory)))
 
   return aggregate_results
 
@@ -480,3 +565,92 @@ def categorize_compilation_metrics_into_tables(
         _add_header_and_get_markdown_table(headers, rows, size_cut=size_cut))
 
   return "\n\n".join(tables)
+
+
+def _get_benchmarks_with_metric(
+    benchmarks: Dict[str, AggregateBenchmarkLatency],
+    mapper: MetricsToTableMapper[AggregateBenchmarkLatency]
+) -> Dict[str, AggregateBenchmarkLatency]:
+  """Returns the benchmarks that reported the metric of the mapper."""
+  return {
+      name: benchmark
+      for name, benchmark in benchmarks.items()
+      if mapper.get_current_and_base_value(benchmark)[0] is not None
+  }
+
+
+def categorize_runtime_metrics_into_tables(
+    benchmarks: Dict[str, AggregateBenchmarkLatency],
+    size_cut: Optional[int] = None) -> str:
+  """Splits the optional runtime metrics (p99 latency, peak memory) of
+    benchmarks into regressed/improved categories and returns their markdown
+    tables. Benchmarks without the metric are skipped.
+
+    Args:
+      benchmarks: A dictionary of benchmark names to its aggregate info.
+      size_cut: If not None, only show the top N results for each table.
+  """
+
+  tables = []
+  for mapper in RUNTIME_METRICS_TO_TABLE_MAPPERS:
+    regressed, improved, _, _ = _categorize_on_single_metric(
+        _get_benchmarks_with_metric(benchmarks, mapper),
+        mapper.get_current_and_base_value, mapper.get_metric_thresholds())
+
+    table_title = mapper.get_table_title()
+    table_header = mapper.get_table_header()
+    if regressed:
+      tables.append(md.header(f"Regressed {table_title} 🚩", 3))
+      tables.append(
+          _sort_metrics_objects_and_get_table(regressed, mapper,
+                                              ["Benchmark Name", table_header],
+                                              size_cut))
+    if improved:
+      tables.append(md.header(f"Improved {table_title} 🎉", 3))
+      tables.append(
+          _sort_metrics_objects_and_get_table(improved, mapper,
+                                              ["Benchmark Name", table_header],
+                                              size_cut))
+
+  # If we want to abbreviate, the full listing won't be interesting.
+  reported = {
+      name: benchmark
+      for name, benchmark in benchmarks.items()
+      if benchmark.p99_time is not None or benchmark.throughput is not None or
+      benchmark.peak_memory is not None
+  }
+  if size_cut is None and reported:
+    tables.append(md.header("All Runtime Metrics", 3))
+    rows = []
+    for name, benchmark in reported.items():
+      p50_text = "-" if benchmark.p50_time is None else benchmark.p50_time
+      p99_text = ("-" if benchmark.p99_time is None else _get_compare_text(
+          benchmark.p99_time, benchmark.base_p99_time))
+      throughput_text = ("-" if benchmark.throughput is None else
+                         f"{benchmark.throughput:.2f}")
+      peak_memory_text = ("-" if benchmark.peak_memory is None else
+                          _get_compare_text(benchmark.peak_memory,
+                                            benchmark.base_peak_memory))
+      rows.append((_make_series_link(name), p50_text, p99_text,
+                   throughput_text, peak_memory_text))
+    tables.append(
+        _add_header_and_get_markdown_table(RUNTIME_METRICS_HEADERS, rows))
+
+  return "\n\n".join(tables)
+
+
+def get_regressed_benchmark_names(
+    benchmarks: Dict[str, AggregateBenchmarkLatency]) -> List[str]:
+  """Returns the sorted names of benchmarks regressed on the mean latency or
+    any of the optional runtime metrics.
+  """
+  regressed, _, _, _ = _categorize_on_single_metric(
+      benchmarks, lambda results: (results.mean_time, results.base_mean_time),
+      BENCHMARK_THRESHOLDS)
+  names = set(regressed.keys())
+  for mapper in RUNTIME_METRICS_TO_TABLE_MAPPERS:
+    regressed, _, _, _ = _categorize_on_single_metric(
+        _get_benchmarks_with_metric(benchmarks, mapper),
+        mapper.get_current_and_base_value, mapper.get_metric_thresholds())
+    names.update(regressed.keys())
+  return sorted(names)
@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import tempfile
+import unittest
+
+from common.benchmark_definition import BenchmarkInfo, BenchmarkResults, BenchmarkRun, DeviceInfo, PlatformType
+from common.benchmark_presentation import AggregateBenchmarkLatency, aggregate_all_benchmarks, get_regressed_benchmark_names
+
+
+def _make_aggregate_results(mean: float, counters: dict):
+  results = []
+  for kind, time in [("mean", mean), ("median", mean), ("stddev", 0.1)]:
+    result = {
+        "name": f"BM_main/process_time/real_time_{kind}",
+        "real_time": time,
+        "time_unit": "ms",
+    }
+    if kind == "mean":
+      result.update(counters)
+    results.append(result)
+  return results
+
+
+class BenchmarkPresentationTest(unittest.TestCase):
+
+  def setUp(self):
+    self._tmp_dir_obj = tempfile.TemporaryDirectory()
+    self.tmp_dir = self._tmp_dir_obj.name
+    self.device_info = DeviceInfo(platform_type=PlatformType.LINUX,
+                                  model="Unknown",
+                                  cpu_abi="x86_64",
+                                  cpu_uarch="CascadeLake",
+                                  cpu_features=[],
+                                  gpu_name="Unknown")
+
+  def tearDown(self):
+    self._tmp_dir_obj.cleanup()
+
+  def _write_results(self, filename: str, runs) -> str:
+    results = BenchmarkResults()
+    for model_name, bench_results in runs:
+      info = BenchmarkInfo(model_name=model_name,
+                           model_tags=["fp32"],
+                           model_source="TFLite",
+                           bench_mode=["32-thread", "full-inference"],
+                           runner="iree-dylib",
+                           device_info=self.device_info)
+      results.benchmarks.append(BenchmarkRun(info, {}, bench_results))
+    path = os.path.join(self.tmp_dir, filename)
+    with open(path, "w") as f:
+      f.write(results.to_json_str())
+    return path
+
+  def test_aggregate_all_benchmarks_with_counters(self):
+    path = self._write_results("results.json", [
+        ("ModelA",
+         _make_aggregate_results(
+             10.2, {
+                 "p50_latency_ms": 10.1,
+                 "p99_latency_ms": 14.6,
+                 "throughput_per_second": 98.0,
+                 "peak_memory_bytes": 4096.0,
+             })),
+        ("ModelB", _make_aggregate_results(5.0, {})),
+    ])
+
+    benchmarks = aggregate_all_benchmarks([path])
+
+    (name_a, name_b) = sorted(benchmarks.keys())
+    self.assertEqual(
+        benchmarks[name_a],
+        AggregateBenchmarkLatency(mean_time=10,
+                                  median_time=10,
+                                  stddev_time=0,
+                                  p50_time=10,
+                                  p99_time=15,
+                                  throughput=98.0,
+                                  peak_memory=4096))
+    self.assertEqual(
+        benchmarks[name_b],
+        AggregateBenchmarkLatency(mean_time=5, median_time=5, stddev_time=0))
+
+  def test_get_regressed_benchmark_names(self):
+    benchmarks = {
+        "mean_regressed":
+            AggregateBenchmarkLatency(mean_time=120,
+                                      median_time=120,
+                                      stddev_time=1,
+                                      base_mean_time=100),
+        "p99_regressed":
+            AggregateBenchmarkLatency(mean_time=100,
+                                      median_time=100,
+                                      stddev_time=1,
+                                      base_mean_time=100,
+                                      p99_time=150,
+                                      base_p99_time=110),
+        "memory_regressed":
+            AggregateBenchmarkLatency(mean_time=100,
+                                      median_time=100,
+                                      stddev_time=1,
+                                      base_mean_time=100,
+                                      peak_memory=2048,
+                                      base_peak_memory=1024),
+        "similar":
+            AggregateBenchmarkLatency(mean_time=101,
+                                      median_time=101,
+                                      stddev_time=1,
+                                      base_mean_time=100,
+                                      p99_time=105,
+                                      base_p99_time=100,
+                                      peak_memory=1024,
+                                      base_peak_memory=1024),
+        "no_base":
+            AggregateBenchmarkLatency(mean_time=100,
+                                      median_time=100,
+                                      stddev_time=1,
+                                      p99_time=150),
+    }
+
+    self.assertEqual(get_regressed_benchmark_names(benchmarks),
+                     ["mean_regressed", "memory_regressed", "p99_regressed"])
+
+
+if __name__ == "__main__":
+  unittest.main()
@@ -87,3 +87,13 @@ TOTAL_DISPATCH_SIZE_THRESHOLDS = [
     # Default threshold: 5%.
     BenchmarkThreshold(re.compile(r".*"), 5, ThresholdUnit.PERCENTAGE),
 ]
+
+P99_LATENCY_THRESHOLDS = [
+    # Tail latencies are noisier than averages. Default threshold: 10%.
+    BenchmarkThreshold(re.compile(r".*"), 10, ThresholdUnit.PERCENTAGE),
+]
+
+PEAK_MEMORY_THRESHOLDS = [
+    # Default threshold: 5%.
+    BenchmarkThreshold(re.compile(r".*"), 5, ThresholdUnit.PERCENTAGE),
+]
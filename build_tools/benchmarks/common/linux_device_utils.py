@@ -12,6 +12,11 @@ from typing import Optional, Sequence
 from .benchmark_definition import (execute_cmd_and_get_output, DeviceInfo,
                                    PlatformType)
 
+# A map from the Linux CPU architecture to the CPU ABI used by benchmarks.
+_LINUX_CPU_ARCH_TO_CPU_ABI_MAP = {
+    "aarch64": "arm64-v8a",
+}
+
 
 def _get_lscpu_field(field_name: str, verbose: bool = False) -> str:
   output = execute_cmd_and_get_output(["lscpu"], verbose)
@@ -24,11 +29,37 @@ def get_linux_cpu_arch(verbose: bool = False) -> str:
   return _get_lscpu_field("Architecture", verbose)
 
 
+def get_linux_cpu_abi(verbose: bool = False) -> str:
+  """Returns the CPU ABI, e.g., 'x86_64' or 'arm64-v8a'."""
+  arch = get_linux_cpu_arch(verbose)
+  return _LINUX_CPU_ARCH_TO_CPU_ABI_MAP.get(arch, arch)
+
+
 def get_linux_cpu_features(verbose: bool = False) -> Sequence[str]:
   """Returns CPU feature lists, e.g., ['mmx', 'fxsr', 'sse', 'sse2']."""
   return _get_lscpu_field("Flags", verbose).split(" ")
 
 
+def get_linux_taskset(bench_mode: Sequence[str], cpu_count: int) -> str:
+  """Returns the taskset CPU mask to run a benchmark with the given mode.
+
+    Benchmarks run on the low cores: at least 8 of them (leaving headroom for
+    the main thread) and more if an 'N-thread' mode needs them, capped at the
+    number of available CPUs.
+
+    Args:
+    - bench_mode: the benchmark mode tags, e.g., ['32-thread', 'full-inference']
+    - cpu_count: the number of CPUs on the device.
+  """
+  core_count = 8
+  for mode in bench_mode:
+    match = re.match(r"^(\d+)-thread$", mode)
+    if match:
+      core_count = max(core_count, int(match.group(1)))
+  core_count = max(min(core_count, cpu_count), 1)
+  return hex((1 << core_count) - 1)
+
+
 def get_linux_device_info(device_model: str = "Unknown",
                           cpu_uarch: Optional[str] = None,
                           verbose: bool = False) -> DeviceInfo:
@@ -42,8 +73,7 @@ def get_linux_device_info(device_model: str = "Unknown",
       PlatformType.LINUX,
       # Includes CPU model as it is the key factor of the device performance.
       model=device_model,
-      # Currently we only have x86, so CPU ABI = CPU arch.
-      cpu_abi=get_linux_cpu_arch(verbose),
+      cpu_abi=get_linux_cpu_abi(verbose),
       cpu_uarch=cpu_uarch,
       cpu_features=get_linux_cpu_features(verbose),
       # We don't yet support GPU benchmark on Linux devices.
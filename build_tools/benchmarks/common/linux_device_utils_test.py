@@ -10,7 +10,7 @@ import unittest
 from unittest import mock
 
 from common.benchmark_definition import DeviceInfo, PlatformType
-from common.linux_device_utils import get_linux_cpu_arch, get_linux_cpu_features, get_linux_device_info
+from common.linux_device_utils import get_linux_cpu_abi, get_linux_cpu_arch, get_linux_cpu_features, get_linux_device_info, get_linux_taskset
 
 
 class LinuxDeviceUtilsTest(unittest.TestCase):
@@ -30,6 +30,25 @@ class LinuxDeviceUtilsTest(unittest.TestCase):
   def test_get_linux_cpu_arch(self):
     self.assertEqual(get_linux_cpu_arch(), "x86_64")
 
+  def test_get_linux_cpu_abi(self):
+    self.assertEqual(get_linux_cpu_abi(), "x86_64")
+
+  def test_get_linux_cpu_abi_aarch64(self):
+    self.execute_cmd_mock.return_value = (
+        "Architecture:                    aarch64\n"
+        "Flags:                           fp asimd atomics\n")
+
+    self.assertEqual(get_linux_cpu_abi(), "arm64-v8a")
+
+  def test_get_linux_taskset(self):
+    self.assertEqual(get_linux_taskset(["full-inference"], 64), "0xff")
+    self.assertEqual(get_linux_taskset(["4-thread", "full-inference"], 64),
+                     "0xff")
+    self.assertEqual(get_linux_taskset(["32-thread", "full-inference"], 64),
+                     "0xffffffff")
+    self.assertEqual(get_linux_taskset(["64-thread", "full-inference"], 16),
+                     "0xffff")
+
   def test_get_linux_cpu_features(self):
     self.assertEqual(get_linux_cpu_features(),
                      ["fpu", "vme", "de", "pse", "tsc"])
@@ -9,31 +9,55 @@
 Example usage:
   python3 diff_local_benchmarks.py --base=/path/to/base_benchmarks.json
                                    --target=/path/to/target_benchmarks.json
+
+With --fail_on_regression the script exits with a non-zero status if any
+benchmark regressed on mean latency, p99 latency, or peak memory, so it can
+gate continuous benchmark runs.
 """
 
 import argparse
 import json
 import os
 import requests
+import sys
+
+from typing import Dict
 
 from common.benchmark_presentation import *
 
 
-def get_benchmark_result_markdown(base_benchmark_file: str,
-                                  target_benchmark_file: str,
-                                  verbose: bool = False) -> str:
-  """Gets the full markdown summary of all benchmarks in files."""
+def get_target_benchmarks_with_base(
+    base_benchmark_file: str,
+    target_benchmark_file: str) -> Dict[str, AggregateBenchmarkLatency]:
+  """Aggregates the target benchmarks and fills in their base numbers."""
   base_benchmarks = aggregate_all_benchmarks([base_benchmark_file])
   target_benchmarks = aggregate_all_benchmarks([target_benchmark_file])
 
   # Update the target benchmarks with their corresponding base numbers.
   for bench in base_benchmarks:
     if bench in target_benchmarks:
-      target_benchmarks[bench].base_mean_time = base_benchmarks[bench].mean_time
+      target = target_benchmarks[bench]
+      base = base_benchmarks[bench]
+      target.base_mean_time = base.mean_time
+      target.base_p99_time = base.p99_time
+      target.base_peak_memory = base.peak_memory
+
+  return target_benchmarks
+
+
+def get_benchmark_result_markdown(base_benchmark_file: str,
+                                  target_benchmark_file: str,
+                                  verbose: bool = False) -> str:
+  """Gets the full markdown summary of all benchmarks in files."""
+  target_benchmarks = get_target_benchmarks_with_base(base_benchmark_file,
+                                                      target_benchmark_file)
 
   # Compose the full benchmark tables.
   full_table = [md.header("Full Benchmark Summary", 2)]
   full_table.append(categorize_benchmarks_into_tables(target_benchmarks))
+  runtime_tables = categorize_runtime_metrics_into_tables(target_benchmarks)
+  if runtime_tables:
+    full_table.append(runtime_tables)
 
   return "\n\n".join(full_table)
 
@@ -56,6 +80,10 @@ def parse_arguments():
                       type=check_file_path,
                       required=True,
                       help="Target benchmark results")
+  parser.add_argument(
+      "--fail_on_regression",
+      action="store_true",
+      help="Exit with a non-zero status if any benchmark regressed")
   parser.add_argument("--verbose",
                       action="store_true",
                       help="Print internal information during execution")
@@ -70,3 +98,11 @@ if __name__ == "__main__":
       get_benchmark_result_markdown(args.base,
                                     args.target,
                                     verbose=args.verbose))
+  if args.fail_on_regression:
+    regressed = get_regressed_benchmark_names(
+        get_target_benchmarks_with_base(args.base, args.target))
+    if regressed:
+      print("Regressed benchmarks:", file=sys.stderr)
+      for name in regressed:
+        print(f"  {name}", file=sys.stderr)
+      sys.exit(1)
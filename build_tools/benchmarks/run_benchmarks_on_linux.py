@@ -21,7 +21,7 @@ from common.benchmark_suite import MODEL_FLAGFILE_NAME, BenchmarkCase, Benchmark
 from common.benchmark_config import BenchmarkConfig
 from common.benchmark_definition import execute_cmd, execute_cmd_and_get_output, get_git_commit_hash, get_iree_benchmark_module_arguments, wait_for_iree_benchmark_module_start
 from common.common_arguments import build_common_argument_parser
-from common.linux_device_utils import get_linux_device_info
+from common.linux_device_utils import get_linux_device_info, get_linux_taskset
 
 
 class LinuxBenchmarkDriver(BenchmarkDriver):
@@ -35,8 +35,7 @@ class LinuxBenchmarkDriver(BenchmarkDriver):
                          capture_filename: Optional[str]) -> None:
 
     # TODO(pzread): Taskset should be derived from CPU topology.
-    # Only use the low 8 cores.
-    taskset = "0xFF"
+    taskset = get_linux_taskset(benchmark_case.bench_mode, os.cpu_count())
 
     if benchmark_results_filename:
       self.__run_benchmark(case_dir=benchmark_case.benchmark_case_dir,
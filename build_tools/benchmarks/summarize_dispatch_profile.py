@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+"""Summarizes a device profiling capture into a JSON dispatch profile.
+
+Captures are written by the runtime when profiling is enabled, for example:
+
+  iree-benchmark-module --device_profiling_mode=dispatches \
+    --device_profiling_file=capture.bin ...
+
+The summary aggregates the dispatches by export name and workgroup count and
+is consumed by the compiler with `--iree-hal-dispatch-profile=profile.json`
+and by tune_lowering_configs.py to only tune the dispatches that matter.
+
+Example usage:
+  summarize_dispatch_profile.py capture.bin -o profile.json
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+from typing import Any, Dict, List, NamedTuple, Tuple
+
+# 'IRDP' when read as bytes on little-endian hosts.
+CAPTURE_MAGIC = 0x50445249
+# magic, version, worker_count, executable_count, dispatch_count, duration_ns
+HEADER_V1_FORMAT = "IIIIQq"
+# ... name_table_size, reserved
+HEADER_V2_FORMAT = HEADER_V1_FORMAT + "II"
+# export_count, reserved
+EXECUTABLE_FORMAT = "II"
+# executable_index, ordinal, workgroup_count[3], reserved, start_ns,
+# duration_ns
+DISPATCH_FORMAT = "IIIIIIqq"
+
+
+class Dispatch(NamedTuple):
+  name: str
+  workgroup_count: List[int]
+  duration_ns: int
+
+
+def _align(value: int, alignment: int = 8) -> int:
+  return (value + alignment - 1) // alignment * alignment
+
+
+def parse_capture(data: bytes) -> Tuple[int, List[Dispatch]]:
+  """Returns the capture duration and the dispatches in the capture."""
+  if struct.unpack_from("<I", data)[0] == CAPTURE_MAGIC:
+    byte_order = "<"
+  elif struct.unpack_from(">I", data)[0] == CAPTURE_MAGIC:
+    byte_order = ">"
+  else:
+    raise ValueError("not a device profiling capture")
+  version = struct.unpack_from(byte_order + "I", data, 4)[0]
+  if version not in (1, 2):
+    raise ValueError(f"unsupported capture version {version}")
+  header_format = byte_order + (HEADER_V1_FORMAT
+                                if version == 1 else HEADER_V2_FORMAT)
+  header = struct.unpack_from(header_format, data)
+  _, _, worker_count, executable_count, dispatch_count, duration_ns = header[:6]
+  name_table_size = header[6] if version >= 2 else 0
+  offset = struct.calcsize(header_format)
+
+  export_counts = []
+  for _ in range(executable_count):
+    export_counts.append(
+        struct.unpack_from(byte_order + EXECUTABLE_FORMAT, data, offset)[0])
+    offset += struct.calcsize(EXECUTABLE_FORMAT)
+
+  # Names are NUL-terminated and ordered by executable and export ordinal.
+  names = data[offset:offset + name_table_size].split(b"\0")
+  offset += _align(name_table_size)
+  export_names = []
+  for executable_index, export_count in enumerate(export_counts):
+    executable_names = []
+    for ordinal in range(export_count):
+      name = names.pop(0).decode("utf-8") if len(names) > 1 else ""
+      executable_names.append(
+          name or f"executable{executable_index}_export{ordinal}")
+    export_names.append(executable_names)
+
+  dispatches = []
+  dispatch_size = struct.calcsize(DISPATCH_FORMAT) + _align(worker_count * 4)
+  for _ in range(dispatch_count):
+    (executable_index, ordinal, x, y, z, _, _,
+     dispatch_duration_ns) = struct.unpack_from(byte_order + DISPATCH_FORMAT,
+                                                data, offset)
+    offset += dispatch_size
+    dispatches.append(
+        Dispatch(export_names[executable_index][ordinal], [x, y, z],
+                 dispatch_duration_ns))
+  return duration_ns, dispatches
+
+
+def summarize(duration_ns: int, dispatches: List[Dispatch]) -> Dict[str, Any]:
+  """Aggregates |dispatches| by name and workgroup count, slowest first."""
+  entries = {}
+  for dispatch in dispatches:
+    key = (dispatch.name, tuple(dispatch.workgroup_count))
+    entry = entries.setdefault(
+        key, {
+            "name": dispatch.name,
+            "workgroup_count": dispatch.workgroup_count,
+            "count": 0,
+            "total_ns": 0,
+        })
+    entry["count"] += 1
+    entry["total_ns"] += dispatch.duration_ns
+  total_ns = sum(entry["total_ns"] for entry in entries.values())
+  for entry in entries.values():
+    entry["fraction"] = entry["total_ns"] / total_ns if total_ns else 0.0
+  return {
+      "duration_ns":
+          duration_ns,
+      "dispatches":
+          sorted(entries.values(),
+                 key=lambda entry: (-entry["total_ns"], entry["name"])),
+  }
+
+
+def load_dispatch_fractions(path: str) -> Dict[str, float]:
+  """Returns the fraction of the dispatch time spent in each export."""
+  with open(path, "r") as f:
+    profile = json.load(f)
+  fractions = {}
+  for entry in profile["dispatches"]:
+    fractions[entry["name"]] = fractions.get(entry["name"],
+                                             0.0) + entry["fraction"]
+  return fractions
+
+
+def parse_arguments():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument("capture", help="Device profiling capture file")
+  parser.add_argument("-o",
+                      "--output",
+                      default="-",
+                      help="Output JSON profile path (default: stdout)")
+  return parser.parse_args()
+
+
+def main(args):
+  with open(args.capture, "rb") as f:
+    profile = summarize(*parse_capture(f.read()))
+  if args.output == "-":
+    json.dump(profile, sys.stdout, indent=2)
+    sys.stdout.write("\n")
+  else:
+    with open(args.output, "w") as f:
+      json.dump(profile, f, indent=2)
+
+
+if __name__ == "__main__":
+  main(parse_arguments())
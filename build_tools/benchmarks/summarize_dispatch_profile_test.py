@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import struct
+import unittest
+
+from summarize_dispatch_profile import CAPTURE_MAGIC, Dispatch, parse_capture, summarize
+
+
+def _pack_dispatch(executable_index, ordinal, workgroup_count, duration_ns,
+                   tile_counts):
+  data = struct.pack("<IIIIIIqq", executable_index, ordinal, *workgroup_count,
+                     0, 0, duration_ns)
+  data += struct.pack(f"<{len(tile_counts)}I", *tile_counts)
+  return data + b"\0" * (-len(data) % 8)
+
+
+class SummarizeDispatchProfileTest(unittest.TestCase):
+
+  def test_parse_capture(self):
+    names = b"matmul\0fill\0"
+    data = struct.pack("<IIIIQqII", CAPTURE_MAGIC, 2, 1, 1, 2, 1000,
+                       len(names), 0)
+    data += struct.pack("<II", 2, 0)
+    data += names + b"\0" * (-len(names) % 8)
+    data += _pack_dispatch(0, 1, [4, 1, 1], 10, [4])
+    data += _pack_dispatch(0, 0, [8, 8, 1], 90, [64])
+
+    duration_ns, dispatches = parse_capture(data)
+
+    self.assertEqual(duration_ns, 1000)
+    self.assertEqual(dispatches, [
+        Dispatch("fill", [4, 1, 1], 10),
+        Dispatch("matmul", [8, 8, 1], 90),
+    ])
+
+  def test_parse_capture_without_names(self):
+    data = struct.pack("<IIIIQq", CAPTURE_MAGIC, 1, 0, 1, 1, 100)
+    data += struct.pack("<II", 1, 0)
+    data += _pack_dispatch(0, 0, [1, 1, 1], 5, [])
+
+    _, dispatches = parse_capture(data)
+
+    self.assertEqual(dispatches,
+                     [Dispatch("executable0_export0", [1, 1, 1], 5)])
+
+  def test_summarize(self):
+    profile = summarize(1000, [
+        Dispatch("fill", [4, 1, 1], 10),
+        Dispatch("matmul", [8, 8, 1], 30),
+        Dispatch("matmul", [8, 8, 1], 40),
+        Dispatch("fill", [4, 1, 1], 20),
+    ])
+
+    self.assertEqual(
+        profile, {
+            "duration_ns":
+                1000,
+            "dispatches": [
+                {
+                    "name": "matmul",
+                    "workgroup_count": [8, 8, 1],
+                    "count": 2,
+                    "total_ns": 70,
+                    "fraction": 0.7,
+                },
+                {
+                    "name": "fill",
+                    "workgroup_count": [4, 1, 1],
+                    "count": 2,
+                    "total_ns": 30,
+                    "fraction": 0.3,
+                },
+            ]
+        })
+
+
+if __name__ == "__main__":
+  unittest.main()
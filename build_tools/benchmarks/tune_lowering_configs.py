@@ -0,0 +1,343 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+"""Tunes the lowering configs of dispatches and records them in a database.
+
+The dispatches are taken from the standalone benchmark modules dumped by
+`iree-compile --iree-hal-dump-executable-benchmarks-to=<dir>`. For each of them
+candidate `#iree_codegen.compilation_info` attributes are compiled in through
+`--iree-codegen-tuning-database`, benchmarked with iree-benchmark-module and
+the fastest one, if it beats the default heuristics, is stored in the database
+under the signature of the dispatch. Passing the same database to iree-compile
+afterwards makes it use the tuned configs:
+
+  iree-compile --iree-codegen-tuning-database=tuning.json ...
+
+Example usage:
+  tune_lowering_configs.py --dispatch_dir=<dir> --database=tuning.json \
+    --target_backend=dylib-llvm-aot --driver=local-task \
+    --iree_compile=<build>/tools/iree-compile \
+    --iree_benchmark_module=<build>/tools/iree-benchmark-module
+"""
+
+import argparse
+import itertools
+import json
+import os
+import re
+import subprocess
+import tempfile
+
+from typing import Dict, List, Optional, Sequence, Tuple
+
+from summarize_dispatch_profile import load_dispatch_fractions
+
+SIGNATURE_PATTERN = re.compile(r"^// tuning signature @(\S+): (\".*\")$",
+                               re.MULTILINE)
+# Matches the tensor types in a signature, e.g. tensor<128x256xf32>.
+TENSOR_TYPE_PATTERN = re.compile(r"tensor<([0-9?x]*)x[a-z][a-z0-9]*>")
+
+CPU_TILE_SIZES = [8, 16, 32, 64, 128]
+CPU_VECTOR_TILE_SIZES = [(8, 32), (4, 16), (16, 16)]
+CPU_REDUCTION_TILE_SIZES = [8, 16, 32]
+GPU_TILE_SIZES = [(32, 32, 16), (64, 32, 16), (32, 64, 32), (64, 64, 8)]
+
+
+def parse_tuning_signatures(compiler_output: str) -> Dict[str, str]:
+  """Returns the dispatch signatures printed by the compiler by export name.
+
+  The compiler prints them with `--iree-codegen-print-tuning-signatures` as
+    // tuning signature @<export>: "<signature>"
+  """
+  return {
+      match.group(1): json.loads(match.group(2))
+      for match in SIGNATURE_PATTERN.finditer(compiler_output)
+  }
+
+
+def parse_signature(signature: str) -> Tuple[str, str, List[List[int]]]:
+  """Returns the backend, root op name and tensor shapes of a signature.
+
+  Dynamic dimensions are returned as -1.
+  """
+  backend, _, rest = signature.split(":", 2)
+  op_name = rest.split("(", 1)[0]
+  shapes = []
+  for match in TENSOR_TYPE_PATTERN.finditer(rest):
+    dims = match.group(1)
+    shapes.append([-1 if dim == "?" else int(dim) for dim in dims.split("x")
+                  ] if dims else [])
+  return backend, op_name, shapes
+
+
+def get_matmul_sizes(op_name: str,
+                     shapes: Sequence[List[int]]) -> Optional[List[int]]:
+  """Returns the [(B,) M, N, K] loop sizes of a matmul-like root op."""
+  if op_name == "linalg.matmul" and len(shapes) >= 2:
+    lhs, rhs = shapes[0], shapes[1]
+    if len(lhs) == 2 and len(rhs) == 2:
+      return [lhs[0], rhs[1], lhs[1]]
+  if op_name == "linalg.batch_matmul" and len(shapes) >= 2:
+    lhs, rhs = shapes[0], shapes[1]
+    if len(lhs) == 3 and len(rhs) == 3:
+      return [lhs[0], lhs[1], rhs[2], lhs[2]]
+  return None
+
+
+def _fits(tile: int, size: int) -> bool:
+  """Returns true if |tile| is worth trying for a loop of |size|."""
+  return size < 0 or tile <= size
+
+
+def _format_tile_sizes(tile_sizes: Sequence[Sequence[int]]) -> str:
+  return "[" + ", ".join(
+      "[" + ", ".join(str(size) for size in level) + "]"
+      for level in tile_sizes) + "]"
+
+
+def _format_compilation_info(tile_sizes: Sequence[Sequence[int]],
+                             pipeline: str,
+                             workgroup_size: Sequence[int] = ()) -> str:
+  return ("#iree_codegen.compilation_info<"
+          f"lowering_config = <tile_sizes = {_format_tile_sizes(tile_sizes)}>, "
+          f"translation_info = <{pipeline}>, "
+          f"workgroup_size = [{', '.join(str(s) for s in workgroup_size)}]>")
+
+
+def generate_cpu_candidates(sizes: Sequence[int]) -> List[str]:
+  """Returns CPUDoubleTilingExpert configs for [(B,) M, N, K] loop sizes."""
+  batch = [1] if len(sizes) == 4 else []
+  m, n, k = sizes[-3:]
+  candidates = []
+  for tile_m, tile_n, (vector_m, vector_n), tile_k in itertools.product(
+      CPU_TILE_SIZES, CPU_TILE_SIZES, CPU_VECTOR_TILE_SIZES,
+      CPU_REDUCTION_TILE_SIZES):
+    if not (_fits(tile_m, m) and _fits(tile_n, n) and _fits(tile_k, k)):
+      continue
+    if vector_m > tile_m or vector_n > tile_n:
+      continue
+    candidates.append(
+        _format_compilation_info([
+            batch + [tile_m, tile_n, 0],
+            batch + [vector_m, vector_n, 0],
+            [0] * len(batch) + [0, 0, tile_k],
+        ], "CPUDoubleTilingExpert"))
+  return candidates
+
+
+def generate_gpu_candidates(sizes: Sequence[int]) -> List[str]:
+  """Returns LLVMGPUMatmulSimt configs for [(B,) M, N, K] loop sizes."""
+  batch = [1] if len(sizes) == 4 else []
+  m, n, k = sizes[-3:]
+  candidates = []
+  for tile_m, tile_n, tile_k in GPU_TILE_SIZES:
+    if not (_fits(tile_m, m) and _fits(tile_n, n) and _fits(tile_k, k)):
+      continue
+    # Each thread computes a 4x1 slice of the workgroup tile.
+    workgroup_size = [tile_n, tile_m // 4, 1]
+    if workgroup_size[0] * workgroup_size[1] > 1024:
+      continue
+    candidates.append(
+        _format_compilation_info([batch + [tile_m, tile_n, tile_k]],
+                                 "LLVMGPUMatmulSimt", workgroup_size))
+  return candidates
+
+
+def generate_candidates(signature: str) -> List[str]:
+  """Returns the compilation info candidates to try for a dispatch."""
+  backend, op_name, shapes = parse_signature(signature)
+  sizes = get_matmul_sizes(op_name, shapes)
+  if sizes is None:
+    return []
+  if backend == "llvm":
+    return generate_cpu_candidates(sizes)
+  if backend == "cuda":
+    return generate_gpu_candidates(sizes)
+  return []
+
+
+def parse_benchmark_time(benchmark_output: str) -> float:
+  """Returns the total mean real time in ns of the benchmarks in the output of
+  `iree-benchmark-module --benchmark_format=json`."""
+  unit_scales = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+  benchmarks = json.loads(benchmark_output)["benchmarks"]
+  aggregates = [b for b in benchmarks if b.get("aggregate_name") == "mean"]
+  total = 0.0
+  for benchmark in aggregates or benchmarks:
+    total += benchmark["real_time"] * unit_scales[benchmark["time_unit"]]
+  return total
+
+
+def update_database(database: Dict[str, str], signature: str,
+                    baseline_time: Optional[float],
+                    results: Dict[str, float]) -> bool:
+  """Records the fastest candidate in |results| for |signature| if it beats
+  the baseline. Returns true if the database changed."""
+  if not results:
+    return False
+  best_candidate, best_time = min(results.items(), key=lambda item: item[1])
+  if baseline_time is not None and best_time >= baseline_time:
+    return False
+  if database.get(signature) == best_candidate:
+    return False
+  database[signature] = best_candidate
+  return True
+
+
+def load_database(path: str) -> Dict[str, str]:
+  if not os.path.exists(path):
+    return {}
+  with open(path, "r") as f:
+    return json.load(f)
+
+
+def save_database(path: str, database: Dict[str, str]):
+  with open(path, "w") as f:
+    json.dump(database, f, indent=2, sort_keys=True)
+    f.write("\n")
+
+
+class Tuner(object):
+  """Compiles and benchmarks dispatch benchmark modules."""
+
+  def __init__(self, args: argparse.Namespace, work_dir: str):
+    self.args = args
+    self.work_dir = work_dir
+
+  def _compile(self,
+               source: str,
+               extra_flags: Sequence[str] = (),
+               output: str = os.devnull) -> subprocess.CompletedProcess:
+    cmd = [
+        self.args.iree_compile,
+        source,
+        f"--iree-hal-target-backends={self.args.target_backend}",
+        "-o",
+        output,
+    ] + self.args.compile_flags + list(extra_flags)
+    return subprocess.run(cmd,
+                          stdout=subprocess.PIPE,
+                          stderr=subprocess.PIPE,
+                          universal_newlines=True)
+
+  def get_signatures(self, source: str) -> Dict[str, str]:
+    result = self._compile(source, ["--iree-codegen-print-tuning-signatures"])
+    if result.returncode != 0:
+      print(f"warning: failed to compile {source}:\n{result.stderr}")
+      return {}
+    return parse_tuning_signatures(result.stderr)
+
+  def benchmark(self, source: str,
+                database: Optional[Dict[str, str]]) -> Optional[float]:
+    """Returns the time of the benchmarks in |source| compiled with
+    |database|, or None if compiling or running it failed."""
+    module = os.path.join(self.work_dir, "candidate.vmfb")
+    flags = []
+    if database is not None:
+      database_path = os.path.join(self.work_dir, "candidate.json")
+      save_database(database_path, database)
+      flags.append(f"--iree-codegen-tuning-database={database_path}")
+    if self._compile(source, flags, module).returncode != 0:
+      return None
+    cmd = [
+        self.args.iree_benchmark_module,
+        f"--module_file={module}",
+        f"--device={self.args.driver}",
+        "--benchmark_format=json",
+        f"--benchmark_repetitions={self.args.repetitions}",
+        "--benchmark_report_aggregates_only=true",
+    ]
+    result = subprocess.run(cmd,
+                            stdout=subprocess.PIPE,
+                            stderr=subprocess.PIPE,
+                            universal_newlines=True)
+    if result.returncode != 0:
+      return None
+    return parse_benchmark_time(result.stdout)
+
+
+def is_hot_dispatch(export: str, fractions: Optional[Dict[str, float]],
+                    min_fraction: float) -> bool:
+  """Returns true if |export| takes at least |min_fraction| of the dispatch
+  time in the profile |fractions|. All dispatches are hot without a profile."""
+  if fractions is None:
+    return True
+  return fractions.get(export, 0.0) >= min_fraction
+
+
+def tune_dispatch(tuner: Tuner, source: str, database: Dict[str, str],
+                  fractions: Optional[Dict[str, float]]) -> bool:
+  """Tunes the dispatches in the benchmark module |source| and returns true
+  if |database| was updated."""
+  updated = False
+  for export, signature in tuner.get_signatures(source).items():
+    if not is_hot_dispatch(export, fractions, tuner.args.min_time_fraction):
+      continue
+    candidates = generate_candidates(signature)
+    if not candidates:
+      continue
+    print(f"tuning @{export} with {len(candidates)} candidates: {signature}")
+    baseline_time = tuner.benchmark(source, None)
+    results = {}
+    for candidate in candidates[:tuner.args.max_candidates]:
+      time = tuner.benchmark(source, {signature: candidate})
+      if time is not None:
+        results[candidate] = time
+    if update_database(database, signature, baseline_time, results):
+      print(f"  {database[signature]}: {results[database[signature]]:.0f}ns "
+            f"(default: {baseline_time}ns)")
+      updated = True
+  return updated
+
+
+def parse_arguments():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+  parser.add_argument(
+      "--dispatch_dir",
+      required=True,
+      help="Directory of the --iree-hal-dump-executable-benchmarks-to output")
+  parser.add_argument("--database",
+                      required=True,
+                      help="Tuning database to update (created if missing)")
+  parser.add_argument("--iree_compile", default="iree-compile")
+  parser.add_argument("--iree_benchmark_module",
+                      default="iree-benchmark-module")
+  parser.add_argument("--target_backend", default="dylib-llvm-aot")
+  parser.add_argument("--driver", default="local-task")
+  parser.add_argument("--compile_flags",
+                      nargs="*",
+                      default=[],
+                      help="Extra flags passed to iree-compile")
+  parser.add_argument("--repetitions", type=int, default=5)
+  parser.add_argument("--max_candidates",
+                      type=int,
+                      default=64,
+                      help="Maximum number of candidates tried per dispatch")
+  parser.add_argument(
+      "--profile",
+      help="Dispatch profile from summarize_dispatch_profile.py; only "
+      "dispatches taking at least --min_time_fraction of the time are tuned")
+  parser.add_argument("--min_time_fraction", type=float, default=0.01)
+  return parser.parse_args()
+
+
+def main(args):
+  database = load_database(args.database)
+  fractions = load_dispatch_fractions(args.profile) if args.profile else None
+  sources = sorted(
+      os.path.join(args.dispatch_dir, name)
+      for name in os.listdir(args.dispatch_dir)
+      if name.endswith(".mlir"))
+  with tempfile.TemporaryDirectory() as work_dir:
+    tuner = Tuner(args, work_dir)
+    for source in sources:
+      if tune_dispatch(tuner, source, database, fractions):
+        # Saved after each dispatch such that interrupted runs keep results.
+        save_database(args.database, database)
+
+
+if __name__ == "__main__":
+  main(parse_arguments())
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import json
+import unittest
+
+from tune_lowering_configs import generate_candidates, is_hot_dispatch, parse_benchmark_time, parse_signature, parse_tuning_signatures, update_database
+
+MATMUL_SIGNATURE = ("llvm:embedded-elf-x86_64:linalg.matmul(tensor<128x256xf32>"
+                    ", tensor<256x512xf32>, tensor<128x512xf32>)->"
+                    "(tensor<128x512xf32>)")
+
+
+class TuneLoweringConfigsTest(unittest.TestCase):
+
+  def test_parse_tuning_signatures(self):
+    output = ("warning: unrelated\n"
+              f"// tuning signature @matmul: {json.dumps(MATMUL_SIGNATURE)}\n"
+              "// tuning signature @generic: "
+              "\"llvm:embedded-elf-x86_64:linalg.generic(tensor<4xf32>)->"
+              "(tensor<4xf32>) {iterator_types = [\\\"parallel\\\"]}\"\n")
+
+    signatures = parse_tuning_signatures(output)
+
+    self.assertEqual(
+        signatures, {
+            "matmul":
+                MATMUL_SIGNATURE,
+            "generic":
+                "llvm:embedded-elf-x86_64:linalg.generic(tensor<4xf32>)->"
+                "(tensor<4xf32>) {iterator_types = [\"parallel\"]}",
+        })
+
+  def test_parse_signature(self):
+    backend, op_name, shapes = parse_signature(
+        "cuda:cuda-nvptx-fb:linalg.batch_matmul(tensor<4x?x8xf16>, "
+        "tensor<4x8x16xf16>, tensor<4x?x16xf16>)->(tensor<4x?x16xf16>)")
+
+    self.assertEqual(backend, "cuda")
+    self.assertEqual(op_name, "linalg.batch_matmul")
+    self.assertEqual(shapes, [[4, -1, 8], [4, 8, 16], [4, -1, 16], [4, -1, 16]])
+
+  def test_generate_cpu_candidates(self):
+    candidates = generate_candidates(MATMUL_SIGNATURE)
+
+    self.assertIn(
+        "#iree_codegen.compilation_info<lowering_config = <tile_sizes = "
+        "[[64, 64, 0], [8, 32, 0], [0, 0, 16]]>, translation_info = "
+        "<CPUDoubleTilingExpert>, workgroup_size = []>", candidates)
+    # No tile exceeds the 128-element M dimension.
+    self.assertFalse(any("[256," in c for c in candidates))
+
+  def test_generate_gpu_candidates(self):
+    candidates = generate_candidates(
+        "cuda:cuda-nvptx-fb:linalg.matmul(tensor<64x64xf32>, "
+        "tensor<64x32xf32>, tensor<64x32xf32>)->(tensor<64x32xf32>)")
+
+    self.assertEqual(candidates, [
+        "#iree_codegen.compilation_info<lowering_config = <tile_sizes = "
+        "[[32, 32, 16]]>, translation_info = <LLVMGPUMatmulSimt>, "
+        "workgroup_size = [32, 8, 1]>",
+        "#iree_codegen.compilation_info<lowering_config = <tile_sizes = "
+        "[[64, 32, 16]]>, translation_info = <LLVMGPUMatmulSimt>, "
+        "workgroup_size = [32, 16, 1]>",
+    ])
+
+  def test_generate_candidates_unsupported_op(self):
+    candidates = generate_candidates(
+        "llvm:embedded-elf-x86_64:linalg.generic(tensor<4xf32>)->"
+        "(tensor<4xf32>)")
+
+    self.assertEqual(candidates, [])
+
+  def test_parse_benchmark_time(self):
+    output = json.dumps({
+        "benchmarks": [
+            {
+                "name": "BM_a/mean",
+                "aggregate_name": "mean",
+                "real_time": 2.0,
+                "time_unit": "us"
+            },
+            {
+                "name": "BM_a/stddev",
+                "aggregate_name": "stddev",
+                "real_time": 0.5,
+                "time_unit": "us"
+            },
+            {
+                "name": "BM_b/mean",
+                "aggregate_name": "mean",
+                "real_time": 500.0,
+                "time_unit": "ns"
+            },
+        ]
+    })
+
+    self.assertEqual(parse_benchmark_time(output), 2500.0)
+
+  def test_update_database_best_candidate(self):
+    database = {}
+
+    updated = update_database(database, "sig", 100.0, {"a": 90.0, "b": 80.0})
+
+    self.assertTrue(updated)
+    self.assertEqual(database, {"sig": "b"})
+
+  def test_update_database_slower_than_baseline(self):
+    database = {"other": "c"}
+
+    updated = update_database(database, "sig", 50.0, {"a": 90.0})
+
+    self.assertFalse(updated)
+    self.assertEqual(database, {"other": "c"})
+
+  def test_is_hot_dispatch(self):
+    fractions = {"matmul": 0.9, "fill": 0.001}
+
+    self.assertTrue(is_hot_dispatch("matmul", fractions, 0.01))
+    self.assertFalse(is_hot_dispatch("fill", fractions, 0.01))
+    self.assertFalse(is_hot_dispatch("unprofiled", fractions, 0.01))
+    self.assertTrue(is_hot_dispatch("unprofiled", None, 0.01))
+
+
+if __name__ == "__main__":
+  unittest.main()
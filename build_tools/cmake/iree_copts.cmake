@@ -337,6 +337,17 @@ if(EMSCRIPTEN AND IREE_ENABLE_THREADING)
   )
 endif()
 
+# Lets clang vectorize the runtime (and its builtins/ukernels) with 128-bit
+# WebAssembly SIMD. Browsers without SIMD128 support will fail to load the
+# module, so this can be disabled for them.
+# https://emscripten.org/docs/porting/simd.html
+if(EMSCRIPTEN AND IREE_ENABLE_WASM_SIMD)
+  iree_select_compiler_opts(IREE_DEFAULT_COPTS
+    ALL
+      "-msimd128"
+  )
+endif()
+
 if(ANDROID)
   # logging.h on Android needs llog to link in Android logging.
   iree_select_compiler_opts(_IREE_LOGGING_LINKOPTS
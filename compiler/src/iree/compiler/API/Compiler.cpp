@@ -6,7 +6,11 @@
 
 #include "iree/compiler/API/Compiler.h"
 
+#include <mutex>
+#include <string>
+
 #include "iree/compiler/ConstEval/Passes.h"
+#include "iree/compiler/Dialect/HAL/Target/ExecutableTranslationCache.h"
 #include "iree/compiler/Dialect/VM/IR/VMOps.h"
 #include "iree/compiler/Dialect/VM/Target/Bytecode/BytecodeModuleTarget.h"
 #include "iree/compiler/InputConversion/MHLO/Passes.h"
@@ -17,12 +21,18 @@
 #include "iree/compiler/Tools/init_passes.h"
 #include "iree/compiler/Tools/init_targets.h"
 #include "iree/compiler/Utils/OptionUtils.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/SHA1.h"
 #include "mlir/CAPI/IR.h"
 #include "mlir/CAPI/Pass.h"
 #include "mlir/CAPI/Support.h"
 #include "mlir/CAPI/Utils.h"
 #include "mlir/CAPI/Wrap.h"
 #include "mlir/IR/BuiltinOps.h"
+#include "mlir/IR/MLIRContext.h"
+#include "mlir/Parser/Parser.h"
+#include "mlir/Pass/PassManager.h"
 
 using namespace mlir;
 using namespace mlir::iree_compiler;
@@ -30,6 +40,8 @@ using namespace mlir::iree_compiler;
 // TODO: There is a loose ::IREE namespace somewhere which means that we
 // have to fully qualify from the unnamed namespace.
 using HALTargetOptions = mlir::iree_compiler::IREE::HAL::TargetOptions;
+using HALExecutableTranslationCache =
+    mlir::iree_compiler::IREE::HAL::ExecutableTranslationCache;
 using VMTargetOptions = mlir::iree_compiler::IREE::VM::TargetOptions;
 using VMBytecodeTargetOptions =
     mlir::iree_compiler::IREE::VM::BytecodeTargetOptions;
@@ -58,15 +70,65 @@ struct CompilerOptions {
     vmBytecodeTargetOptions.bindOptions(binder);
   }
 };
-}  // namespace
 
-DEFINE_C_API_PTR_METHODS(IreeCompilerOptions, CompilerOptions)
+// State kept warm across compilations in a session.
+struct CompilerSession {
+  MLIRContext context;
+  std::shared_ptr<HALExecutableTranslationCache> translationCache =
+      std::make_shared<HALExecutableTranslationCache>();
 
-void ireeCompilerRegisterAllDialects(MlirContext context) {
+  // VM bytecode of previously compiled programs keyed by getModuleCacheKey.
+  llvm::StringMap<std::string> moduleCache;
+  int64_t moduleCacheHits = 0;
+  int64_t moduleCacheMisses = 0;
+};
+}  // namespace
+
+static void appendAllDialects(MLIRContext &context) {
   DialectRegistry registry;
   mlir::iree_compiler::registerAllDialects(registry);
   mlir::iree_compiler::registerLLVMIRTranslations(registry);
-  unwrap(context)->appendDialectRegistry(registry);
+  context.appendDialectRegistry(registry);
+}
+
+static void buildIREEVMPassPipeline(CompilerOptions &options,
+                                    const HALTargetOptions &halTargetOptions,
+                                    OpPassManager &passManager) {
+  IREEVMPipelineHooks hooks = {
+      // buildConstEvalPassPipelineCallback =
+      [](OpPassManager &pm) { pm.addPass(ConstEval::createJitGlobalsPass()); }};
+  buildIREEVMTransformPassPipeline(
+      options.bindingOptions, options.inputDialectOptions,
+      options.highLevelOptimizationOptions, options.schedulingOptions,
+      halTargetOptions, options.vmTargetOptions, hooks, passManager);
+}
+
+// Returns the HAL target options of |options| using the session translation
+// cache.
+static HALTargetOptions getSessionHALTargetOptions(CompilerSession &session,
+                                                   CompilerOptions &options) {
+  HALTargetOptions halTargetOptions = options.halTargetOptions;
+  halTargetOptions.translationCache = session.translationCache;
+  return halTargetOptions;
+}
+
+// Returns a key identifying the compilation of |source| with |options|.
+static std::string getModuleCacheKey(CompilerOptions &options,
+                                     StringRef source) {
+  llvm::SHA1 hasher;
+  for (auto &flag : options.binder.printArguments(/*nonDefaultOnly=*/true)) {
+    hasher.update(flag);
+    hasher.update(StringRef("\0", 1));
+  }
+  hasher.update(source);
+  return llvm::toHex(hasher.result(), /*LowerCase=*/true);
+}
+
+DEFINE_C_API_PTR_METHODS(IreeCompilerOptions, CompilerOptions)
+DEFINE_C_API_PTR_METHODS(IreeCompilerSession, CompilerSession)
+
+void ireeCompilerRegisterAllDialects(MlirContext context) {
+  appendAllDialects(*unwrap(context));
 }
 
 void ireeCompilerRegisterAllPasses() { registerAllPasses(); }
@@ -145,15 +207,8 @@ void ireeCompilerBuildTOSAImportPassPipeline(MlirOpPassManager passManager) {
 void ireeCompilerBuildIREEVMPassPipeline(IreeCompilerOptions options,
                                          MlirOpPassManager passManager) {
   auto *optionsCpp = unwrap(options);
-  auto *passManagerCpp = unwrap(passManager);
-  IREEVMPipelineHooks hooks = {
-      // buildConstEvalPassPipelineCallback =
-      [](OpPassManager &pm) { pm.addPass(ConstEval::createJitGlobalsPass()); }};
-  buildIREEVMTransformPassPipeline(
-      optionsCpp->bindingOptions, optionsCpp->inputDialectOptions,
-      optionsCpp->highLevelOptimizationOptions, optionsCpp->schedulingOptions,
-      optionsCpp->halTargetOptions, optionsCpp->vmTargetOptions, hooks,
-      *passManagerCpp);
+  buildIREEVMPassPipeline(*optionsCpp, optionsCpp->halTargetOptions,
+                          *unwrap(passManager));
 }
 
 // Translates a module op derived from the ireeCompilerBuildIREEVMPassPipeline
@@ -181,3 +236,93 @@ MlirLogicalResult ireeCompilerTranslateModuletoVMBytecode(
 
   return wrap(result);
 }
+
+IreeCompilerSession ireeCompilerSessionCreate() {
+  static std::once_flag registerOnce;
+  std::call_once(registerOnce, []() {
+    registerHALTargetBackends();
+    registerAllPasses();
+  });
+  auto *session = new CompilerSession;
+  appendAllDialects(session->context);
+  session->context.loadAllAvailableDialects();
+  return wrap(session);
+}
+
+void ireeCompilerSessionDestroy(IreeCompilerSession session) {
+  delete unwrap(session);
+}
+
+MlirContext ireeCompilerSessionGetContext(IreeCompilerSession session) {
+  return wrap(&unwrap(session)->context);
+}
+
+void ireeCompilerSessionBuildIREEVMPassPipeline(IreeCompilerSession session,
+                                                IreeCompilerOptions options,
+                                                MlirOpPassManager passManager) {
+  auto *sessionCpp = unwrap(session);
+  auto *optionsCpp = unwrap(options);
+  buildIREEVMPassPipeline(*optionsCpp,
+                          getSessionHALTargetOptions(*sessionCpp, *optionsCpp),
+                          *unwrap(passManager));
+}
+
+MlirLogicalResult ireeCompilerSessionCompileSource(
+    IreeCompilerSession session, IreeCompilerOptions options,
+    MlirStringRef source, MlirStringCallback dataCallback,
+    void *dataUserObject) {
+  auto *sessionCpp = unwrap(session);
+  auto *optionsCpp = unwrap(options);
+  StringRef sourceCpp = unwrap(source);
+
+  std::string cacheKey = getModuleCacheKey(*optionsCpp, sourceCpp);
+  auto it = sessionCpp->moduleCache.find(cacheKey);
+  if (it != sessionCpp->moduleCache.end()) {
+    ++sessionCpp->moduleCacheHits;
+    dataCallback(wrap(StringRef(it->second)), dataUserObject);
+    return mlirLogicalResultSuccess();
+  }
+  ++sessionCpp->moduleCacheMisses;
+
+  OwningOpRef<ModuleOp> moduleOp =
+      parseSourceString<ModuleOp>(sourceCpp, &sessionCpp->context);
+  if (!moduleOp) return mlirLogicalResultFailure();
+
+  PassManager passManager(&sessionCpp->context);
+  buildIREEVMPassPipeline(*optionsCpp,
+                          getSessionHALTargetOptions(*sessionCpp, *optionsCpp),
+                          passManager);
+  if (failed(passManager.run(*moduleOp))) return mlirLogicalResultFailure();
+
+  std::string bytecode;
+  llvm::raw_string_ostream output(bytecode);
+  if (failed(iree_compiler::IREE::VM::translateModuleToBytecode(
+          *moduleOp, optionsCpp->vmBytecodeTargetOptions, output))) {
+    return mlirLogicalResultFailure();
+  }
+  output.flush();
+
+  auto &cachedBytecode = sessionCpp->moduleCache[cacheKey];
+  cachedBytecode = std::move(bytecode);
+  dataCallback(wrap(StringRef(cachedBytecode)), dataUserObject);
+  return mlirLogicalResultSuccess();
+}
+
+void ireeCompilerSessionGetStatistics(
+    IreeCompilerSession session, IreeCompilerSessionStatistics *statistics) {
+  auto *sessionCpp = unwrap(session);
+  auto executableStatistics = sessionCpp->translationCache->getStatistics();
+  statistics->moduleCacheHits = sessionCpp->moduleCacheHits;
+  statistics->moduleCacheMisses = sessionCpp->moduleCacheMisses;
+  statistics->executableCacheHits = executableStatistics.hits;
+  statistics->executableCacheMisses = executableStatistics.misses;
+  statistics->executableCacheEntries = executableStatistics.entries;
+}
+
+void ireeCompilerSessionClearCache(IreeCompilerSession session) {
+  auto *sessionCpp = unwrap(session);
+  sessionCpp->moduleCache.clear();
+  sessionCpp->moduleCacheHits = 0;
+  sessionCpp->moduleCacheMisses = 0;
+  sessionCpp->translationCache->clear();
+}
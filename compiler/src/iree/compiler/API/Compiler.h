@@ -7,6 +7,9 @@
 #ifndef IREE_LLVM_EXTERNAL_PROJECTS_IREE_COMPILER_API_COMPILER_H
 #define IREE_LLVM_EXTERNAL_PROJECTS_IREE_COMPILER_API_COMPILER_H
 
+#include <stdint.h>
+
+#include "mlir-c/IR.h"
 #include "mlir-c/Pass.h"
 #include "mlir-c/Support.h"
 
@@ -21,6 +24,7 @@ extern "C" {
   typedef struct name name
 
 DEFINE_C_API_STRUCT(IreeCompilerOptions, void);
+DEFINE_C_API_STRUCT(IreeCompilerSession, void);
 #undef DEFINE_C_API_STRUCT
 
 //===----------------------------------------------------------------------===//
@@ -86,6 +90,67 @@ MLIR_CAPI_EXPORTED MlirLogicalResult ireeCompilerTranslateModuletoVMBytecode(
     IreeCompilerOptions options, MlirOperation moduleOp,
     MlirStringCallback dataCallback, void *dataUserObject);
 
+//===----------------------------------------------------------------------===//
+// Compiler sessions.
+//===----------------------------------------------------------------------===//
+
+// A long-lived compiler session for compiling many programs in one process.
+//
+// The session registers all dialects, passes and target backends once and
+// owns an MLIRContext with them loaded so that later compilations do not pay
+// for startup. Compilation results are cached:
+//   * whole programs by their source and flags; recompiling an unchanged
+//     program returns the cached bytecode.
+//   * translated executables by their contents; programs that differ only in
+//     some dispatches (such as shape specializations of the same model) only
+//     translate the dispatches that changed.
+//
+// Sessions are not thread-safe; compilations within a session may use
+// multiple threads internally.
+
+typedef struct IreeCompilerSessionStatistics {
+  // Compilations returned from and added to the program cache.
+  int64_t moduleCacheHits;
+  int64_t moduleCacheMisses;
+  // Executable variants reused from and added to the translation cache.
+  int64_t executableCacheHits;
+  int64_t executableCacheMisses;
+  int64_t executableCacheEntries;
+} IreeCompilerSessionStatistics;
+
+// Creates and destroys a compiler session.
+MLIR_CAPI_EXPORTED IreeCompilerSession ireeCompilerSessionCreate();
+MLIR_CAPI_EXPORTED void ireeCompilerSessionDestroy(IreeCompilerSession session);
+
+// Returns the MLIRContext owned by the session. Modules parsed in this context
+// may be compiled with the stage APIs above and will reuse the session
+// translation cache when built with ireeCompilerSessionBuildIREEVMPassPipeline.
+MLIR_CAPI_EXPORTED MlirContext
+ireeCompilerSessionGetContext(IreeCompilerSession session);
+
+// Builds the same pipeline as ireeCompilerBuildIREEVMPassPipeline with
+// executable translation results cached in the session.
+MLIR_CAPI_EXPORTED void ireeCompilerSessionBuildIREEVMPassPipeline(
+    IreeCompilerSession session, IreeCompilerOptions options,
+    MlirOpPassManager passManager);
+
+// Compiles the MLIR |source| assembly with |options| to VM bytecode that is
+// passed to |dataCallback|. Diagnostics are reported to the handlers attached
+// to the session context.
+MLIR_CAPI_EXPORTED MlirLogicalResult ireeCompilerSessionCompileSource(
+    IreeCompilerSession session, IreeCompilerOptions options,
+    MlirStringRef source, MlirStringCallback dataCallback,
+    void *dataUserObject);
+
+// Returns cache statistics accumulated since the session was created or last
+// cleared.
+MLIR_CAPI_EXPORTED void ireeCompilerSessionGetStatistics(
+    IreeCompilerSession session, IreeCompilerSessionStatistics *statistics);
+
+// Drops all cached compilation results and resets the statistics.
+MLIR_CAPI_EXPORTED void ireeCompilerSessionClearCache(
+    IreeCompilerSession session);
+
 #ifdef __cplusplus
 }
 #endif
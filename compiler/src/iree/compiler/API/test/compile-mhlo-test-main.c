@@ -110,6 +110,54 @@ static bool iree_compile_mlir_to_bytecode(iree_string_view_t mlir_source,
   return mlirLogicalResultIsSuccess(status);
 }
 
+// Compiles MLIR code twice in a compiler session; the second compilation is
+// served from the session cache.
+static bool iree_compile_mlir_in_session(iree_string_view_t mlir_source,
+                                         iree_string_view_t target_backend,
+                                         iree_string_builder_t* out_builder) {
+  IreeCompilerSession session = ireeCompilerSessionCreate();
+
+  char target_buf[128];
+  iree_string_builder_t target_builder;
+  iree_string_builder_initialize_with_storage(target_buf, sizeof(target_buf),
+                                              &target_builder);
+  iree_string_builder_append_cstring(&target_builder,
+                                     "--iree-hal-target-backends=");
+  iree_string_builder_append_string(&target_builder, target_backend);
+  const char* compiler_flags[] = {
+      iree_string_builder_buffer(&target_builder),
+      "--iree-input-type=mhlo",
+  };
+  IreeCompilerOptions options = ireeCompilerOptionsCreate();
+  MlirLogicalResult status = ireeCompilerOptionsSetFlags(
+      options, IREE_ARRAYSIZE(compiler_flags), compiler_flags, NULL, NULL);
+
+  MlirStringRef source =
+      mlirStringRefCreate(mlir_source.data, mlir_source.size);
+  if (mlirLogicalResultIsSuccess(status)) {
+    status = ireeCompilerSessionCompileSource(
+        session, options, source, bytecode_builder_callback, out_builder);
+  }
+  iree_string_builder_t cached_builder;
+  iree_string_builder_initialize(iree_allocator_system(), &cached_builder);
+  if (mlirLogicalResultIsSuccess(status)) {
+    status = ireeCompilerSessionCompileSource(
+        session, options, source, bytecode_builder_callback, &cached_builder);
+  }
+
+  IreeCompilerSessionStatistics statistics;
+  ireeCompilerSessionGetStatistics(session, &statistics);
+  bool cached =
+      statistics.moduleCacheHits == 1 && statistics.moduleCacheMisses == 1 &&
+      iree_string_view_equal(iree_string_builder_view(&cached_builder),
+                             iree_string_builder_view(out_builder));
+
+  iree_string_builder_deinitialize(&cached_builder);
+  ireeCompilerOptionsDestroy(options);
+  ireeCompilerSessionDestroy(session);
+  return mlirLogicalResultIsSuccess(status) && cached;
+}
+
 int main(int argc, char** argv) {
   // MLIR code that we will compile
   iree_string_view_t mlir_code = iree_make_cstring_view(
@@ -138,7 +186,22 @@ int main(int argc, char** argv) {
   iree_string_view_t bytecode = iree_string_builder_view(&bytecode_builder);
   printf("GENERATED VMFB SIZE: %d\n", (int)bytecode.size);
 
+  // Compiles the same code in a compiler session.
+  iree_string_builder_t session_builder;
+  iree_string_builder_initialize(iree_allocator_system(), &session_builder);
+  status = iree_compile_mlir_in_session(
+      mlir_code, iree_make_cstring_view("vmvx"), &session_builder);
+  if (!status || iree_string_builder_size(&session_builder) != bytecode.size) {
+    iree_string_builder_deinitialize(&session_builder);
+    iree_string_builder_deinitialize(&bytecode_builder);
+    fprintf(stderr, "failed to compile MLIR code in a session\n");
+    return -1;
+  }
+  printf("SESSION VMFB SIZE: %d\n",
+         (int)iree_string_builder_size(&session_builder));
+
   // Cleanups.
+  iree_string_builder_deinitialize(&session_builder);
   iree_string_builder_deinitialize(&bytecode_builder);
   return 0;
 }
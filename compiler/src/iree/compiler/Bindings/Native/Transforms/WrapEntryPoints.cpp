@@ -4,6 +4,8 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <string>
+
 #include "iree/compiler/Dialect/HAL/IR/HALDialect.h"
 #include "iree/compiler/Dialect/HAL/IR/HALOps.h"
 #include "llvm/ADT/STLExtras.h"
@@ -25,6 +27,19 @@ namespace ABI {
 
 // Wraps all entry points in a function that is compatible with the
 // expected invocation semantics of bindings following the native IREE ABI.
+//
+// Entry points with the `iree.abi.output_storage` unit attribute use
+// destination passing for their results: the wrapper takes one additional
+// trailing !hal.buffer_view argument per result and the results are exported
+// directly into the buffers backing those views. The number of storage
+// arguments is reported in the `iree.abi.output_storage` reflection attribute
+// so that runtime bindings can pass caller-provided outputs.
+//
+// Entry points with `iree.abi.model = "coarse-fences"` are asynchronous: the
+// wrapper takes two additional trailing !hal.fence arguments. All inputs are
+// imported after the wait fence is reached and the signal fence is signaled
+// once all results are available. The wrapper itself returns immediately
+// without blocking on the device.
 class WrapEntryPointsPass
     : public PassWrapper<WrapEntryPointsPass, OperationPass<ModuleOp>> {
  public:
@@ -118,6 +133,35 @@ class WrapEntryPointsPass
     for (auto oldType : entryFuncType.getResults()) {
       resultTypes.push_back(mapToABIType(oldType));
     }
+
+    // Append one storage argument per result when using destination passing.
+    unsigned storageArgsBegin = inputTypes.size();
+    unsigned storageArgsEnd = storageArgsBegin;
+    bool hasOutputStorage = entryFuncOp->hasAttr("iree.abi.output_storage");
+    if (hasOutputStorage) {
+      for (auto oldType : llvm::enumerate(entryFuncType.getResults())) {
+        if (!oldType.value().isa<RankedTensorType>()) {
+          entryFuncOp.emitError()
+              << "result " << oldType.index() << " has type "
+              << oldType.value()
+              << " which cannot be written into caller-provided storage; "
+                 "only ranked tensor results are supported with "
+                 "iree.abi.output_storage";
+          return {};
+        }
+        inputTypes.push_back(
+            IREE::HAL::BufferViewType::get(entryFuncOp.getContext()));
+      }
+      storageArgsEnd = inputTypes.size();
+    }
+
+    // Append the wait and signal fences when using the async model.
+    bool isAsync = isCoarseFencesModel(entryFuncOp);
+    if (isAsync) {
+      auto fenceType = IREE::HAL::FenceType::get(entryFuncOp.getContext());
+      inputTypes.push_back(fenceType);  // wait
+      inputTypes.push_back(fenceType);  // signal
+    }
     auto wrapperFuncType =
         FunctionType::get(entryFuncOp.getContext(), inputTypes, resultTypes);
 
@@ -126,12 +170,25 @@ class WrapEntryPointsPass
 
     SmallVector<DictionaryAttr, 4> argAttrDict;
     entryFuncOp.getAllArgAttrs(argAttrDict);
+    for (unsigned i = storageArgsBegin; i < storageArgsEnd; ++i) {
+      auto outputAttr = NamedAttribute(
+          StringAttr::get(entryFuncOp.getContext(), "iree.abi.output"),
+          IntegerAttr::get(IndexType::get(entryFuncOp.getContext()),
+                           i - storageArgsBegin));
+      argAttrDict.push_back(
+          DictionaryAttr::get(entryFuncOp.getContext(), {outputAttr}));
+    }
+    while (argAttrDict.size() < inputTypes.size()) {
+      argAttrDict.push_back(DictionaryAttr::get(entryFuncOp.getContext()));
+    }
     wrapperFuncOp.setAllArgAttrs(argAttrDict);
     SmallVector<DictionaryAttr, 4> resultAttrDict;
     entryFuncOp.getAllResultAttrs(resultAttrDict);
     wrapperFuncOp.setAllResultAttrs(resultAttrDict);
 
-    populateReflectionAttrs(entryFuncOp, wrapperFuncOp);
+    populateReflectionAttrs(entryFuncOp, wrapperFuncOp,
+                            hasOutputStorage ? resultTypes.size() : 0,
+                            isAsync);
 
     auto *entryBlock = wrapperFuncOp.addEntryBlock();
     auto entryBuilder = OpBuilder::atBlockBegin(entryBlock);
@@ -141,28 +198,43 @@ class WrapEntryPointsPass
     resultStorages.resize(resultTypes.size());
     for (unsigned i = 0; i < inputTypes.size(); ++i) {
       auto outputAttr =
-          entryFuncOp.getArgAttrOfType<IntegerAttr>(i, "iree.abi.output");
+          wrapperFuncOp.getArgAttrOfType<IntegerAttr>(i, "iree.abi.output");
       if (!outputAttr) continue;
-      // Today all outputs need to be a !hal.buffer - we could change this
-      // in the future to be something more generalized.
-      auto storageArg = entryBlock->getArgument(i);
-      if (!storageArg.getType().isa<IREE::HAL::BufferType>()) {
+      // Today all outputs need to be a !hal.buffer or a !hal.buffer_view
+      // whose buffer is used - we could change this in the future to be
+      // something more generalized.
+      Value storageArg = entryBlock->getArgument(i);
+      if (storageArg.getType().isa<IREE::HAL::BufferViewType>()) {
+        storageArg = entryBuilder.create<IREE::HAL::BufferViewBufferOp>(
+            storageArg.getLoc(),
+            IREE::HAL::BufferType::get(entryFuncOp.getContext()), storageArg);
+      } else if (!storageArg.getType().isa<IREE::HAL::BufferType>()) {
         entryFuncOp.emitError()
             << "storage argument " << i << " has an invalid type "
-            << storageArg.getType() << "; must be a !hal.buffer";
+            << storageArg.getType()
+            << "; must be a !hal.buffer or !hal.buffer_view";
         return {};
       }
       resultStorages[outputAttr.getInt()] = storageArg;
     }
 
-    // Marshal arguments.
+    Value waitFence;
+    Value signalFence;
+    if (isAsync) {
+      waitFence = entryBlock->getArgument(inputTypes.size() - 2);
+      signalFence = entryBlock->getArgument(inputTypes.size() - 1);
+    }
+
+    // Marshal arguments. Trailing storage and fence arguments are only used by
+    // the wrapper and not passed to the original function.
     SmallVector<Value> arguments;
-    for (auto arg : llvm::enumerate(entryBlock->getArguments())) {
+    for (auto arg : llvm::enumerate(
+             entryBlock->getArguments().take_front(storageArgsBegin))) {
       auto oldType = entryFuncType.getInput(arg.index());
       if (auto tensorType = oldType.dyn_cast<RankedTensorType>()) {
         auto argLoc = arg.value().getLoc();
         auto importOp = entryBuilder.create<IREE::HAL::TensorImportOp>(
-            argLoc, oldType, arg.value());
+            argLoc, oldType, arg.value(), waitFence);
         arguments.push_back(importOp.target());
       } else {
         arguments.push_back(arg.value());
@@ -173,9 +245,25 @@ class WrapEntryPointsPass
     auto callOp = entryBuilder.create<func::CallOp>(entryFuncOp.getLoc(),
                                                     entryFuncOp, arguments);
 
+    // Join all tensor results on the signal fence so that the caller can wait
+    // for them to be available. The results are exported without waiting.
+    auto callResults = llvm::to_vector(callOp.getResults());
+    if (isAsync) {
+      SmallVector<Value> tensorResults;
+      for (auto result : callResults) {
+        if (result.getType().isa<TensorType>()) tensorResults.push_back(result);
+      }
+      auto barrierOp = entryBuilder.create<IREE::HAL::TensorBarrierOp>(
+          entryFuncOp.getLoc(), tensorResults, signalFence);
+      auto barrierResults = barrierOp.results().begin();
+      for (auto &result : callResults) {
+        if (result.getType().isa<TensorType>()) result = *barrierResults++;
+      }
+    }
+
     // Marshal results.
     SmallVector<Value> results;
-    for (auto result : llvm::enumerate(callOp.getResults())) {
+    for (auto result : llvm::enumerate(callResults)) {
       auto oldType = entryFuncType.getResult(result.index());
       auto newType = wrapperFuncType.getResult(result.index());
       if (oldType.isa<TensorType>()) {
@@ -194,15 +282,36 @@ class WrapEntryPointsPass
     return wrapperFuncOp;
   }
 
+  // Returns true if |entryFuncOp| requested the async coarse-fences model.
+  static bool isCoarseFencesModel(func::FuncOp entryFuncOp) {
+    auto modelAttr = entryFuncOp->getAttrOfType<StringAttr>("iree.abi.model");
+    return modelAttr && modelAttr.getValue() == "coarse-fences";
+  }
+
   // Populates attributes on |wrapperFuncOp| to support runtime reflection.
+  // |outputStorageCount| is the number of trailing output storage arguments
+  // added to the wrapper, if any, and |isAsync| indicates that wait and signal
+  // fences follow them.
   void populateReflectionAttrs(func::FuncOp entryFuncOp,
-                               func::FuncOp wrapperFuncOp) {
+                               func::FuncOp wrapperFuncOp,
+                               unsigned outputStorageCount, bool isAsync) {
     SmallVector<NamedAttribute, 4> attrs;
     auto abiAttr = entryFuncOp->getAttr("iree.abi");
     if (abiAttr) {
       attrs.emplace_back(StringAttr::get(entryFuncOp.getContext(), "iree.abi"),
                          abiAttr);
     }
+    if (outputStorageCount > 0) {
+      attrs.emplace_back(
+          StringAttr::get(entryFuncOp.getContext(), "iree.abi.output_storage"),
+          StringAttr::get(entryFuncOp.getContext(),
+                          std::to_string(outputStorageCount)));
+    }
+    if (isAsync) {
+      attrs.emplace_back(
+          StringAttr::get(entryFuncOp.getContext(), "iree.abi.model"),
+          StringAttr::get(entryFuncOp.getContext(), "coarse-fences"));
+    }
     if (!attrs.empty()) {
       auto reflectionAttr = DictionaryAttr::get(&getContext(), attrs);
       wrapperFuncOp->setAttr("iree.reflection", reflectionAttr);
@@ -57,6 +57,69 @@ func.func @outputStorage(%arg0: tensor<?x8x8x3xf32>, %ret1: !hal.buffer {iree.ab
 
 // -----
 
+// CHECK-LABEL: func.func @callerOutputStorage(
+//  CHECK-SAME:   %[[ARG0:.+]]: !hal.buffer_view,
+//  CHECK-SAME:   %[[RET0_STORAGE:.+]]: !hal.buffer_view {iree.abi.output = 0 : index},
+//  CHECK-SAME:   %[[RET1_STORAGE:.+]]: !hal.buffer_view {iree.abi.output = 1 : index}
+//  CHECK-SAME: -> (
+//  CHECK-SAME:   !hal.buffer_view, !hal.buffer_view
+//  CHECK-SAME: ) attributes {
+//  CHECK-SAME:   iree.abi.stub
+//  CHECK-SAME:   iree.reflection = {iree.abi.output_storage = "2"}
+//  CHECK-SAME: } {
+//   CHECK-DAG:   %[[RET0_BUFFER:.+]] = hal.buffer_view.buffer<%[[RET0_STORAGE]] : !hal.buffer_view> : !hal.buffer
+//   CHECK-DAG:   %[[RET1_BUFFER:.+]] = hal.buffer_view.buffer<%[[RET1_STORAGE]] : !hal.buffer_view> : !hal.buffer
+//       CHECK:   %[[ARG0_TENSOR:.+]] = hal.tensor.import %[[ARG0]] : !hal.buffer_view -> tensor<4xf32>
+//  CHECK-NEXT:   %[[RET_TENSORS:.+]]:2 = call @_callerOutputStorage(%[[ARG0_TENSOR]])
+//  CHECK-NEXT:   %[[RET0_VIEW:.+]] = hal.tensor.export %[[RET_TENSORS]]#0 into %[[RET0_BUFFER]] : tensor<4xf32> -> !hal.buffer_view
+//  CHECK-NEXT:   %[[RET1_VIEW:.+]] = hal.tensor.export %[[RET_TENSORS]]#1 into %[[RET1_BUFFER]] : tensor<4xf32> -> !hal.buffer_view
+//  CHECK-NEXT:   return %[[RET0_VIEW]], %[[RET1_VIEW]] : !hal.buffer_view, !hal.buffer_view
+//  CHECK-NEXT: }
+
+// CHECK-LABEL: func.func private @_callerOutputStorage(
+//  CHECK-SAME:   %{{.+}}: tensor<4xf32>) -> (tensor<4xf32>, tensor<4xf32>)
+func.func @callerOutputStorage(%arg0: tensor<4xf32>) -> (tensor<4xf32>, tensor<4xf32>) attributes {
+  iree.abi.output_storage
+} {
+  %0 = arith.addf %arg0, %arg0 : tensor<4xf32>
+  %1 = arith.mulf %0, %arg0 : tensor<4xf32>
+  return %0, %1 : tensor<4xf32>, tensor<4xf32>
+}
+
+// -----
+
+// Tests that the coarse-fences model imports after the wait fence and signals
+// the signal fence once all results are ready without blocking.
+
+// CHECK-LABEL: func.func @asyncEntry(
+//  CHECK-SAME:   %[[ARG0:.+]]: !hal.buffer_view,
+//  CHECK-SAME:   %[[WAIT:.+]]: !hal.fence, %[[SIGNAL:.+]]: !hal.fence
+//  CHECK-SAME: -> (
+//  CHECK-SAME:   !hal.buffer_view, !hal.buffer_view
+//  CHECK-SAME: ) attributes {
+//  CHECK-SAME:   iree.abi.stub
+//  CHECK-SAME:   iree.reflection = {iree.abi.model = "coarse-fences"}
+//  CHECK-SAME: } {
+//  CHECK-NEXT:   %[[ARG0_TENSOR:.+]] = hal.tensor.import wait(%[[WAIT]]) => %[[ARG0]] : !hal.buffer_view -> tensor<4xf32>
+//  CHECK-NEXT:   %[[RET_TENSORS:.+]]:2 = call @_asyncEntry(%[[ARG0_TENSOR]])
+//  CHECK-NEXT:   %[[RET_READY:.+]]:2 = hal.tensor.barrier join(%[[RET_TENSORS]]#0, %[[RET_TENSORS]]#1 : tensor<4xf32>, tensor<4xf32>) => %[[SIGNAL]] : !hal.fence
+//  CHECK-NEXT:   %[[RET0_VIEW:.+]] = hal.tensor.export %[[RET_READY]]#0 : tensor<4xf32> -> !hal.buffer_view
+//  CHECK-NEXT:   %[[RET1_VIEW:.+]] = hal.tensor.export %[[RET_READY]]#1 : tensor<4xf32> -> !hal.buffer_view
+//  CHECK-NEXT:   return %[[RET0_VIEW]], %[[RET1_VIEW]] : !hal.buffer_view, !hal.buffer_view
+//  CHECK-NEXT: }
+
+// CHECK-LABEL: func.func private @_asyncEntry(
+//  CHECK-SAME:   %{{.+}}: tensor<4xf32>) -> (tensor<4xf32>, tensor<4xf32>)
+func.func @asyncEntry(%arg0: tensor<4xf32>) -> (tensor<4xf32>, tensor<4xf32>) attributes {
+  iree.abi.model = "coarse-fences"
+} {
+  %0 = arith.addf %arg0, %arg0 : tensor<4xf32>
+  %1 = arith.mulf %0, %arg0 : tensor<4xf32>
+  return %0, %1 : tensor<4xf32>, tensor<4xf32>
+}
+
+// -----
+
 // CHECK-LABEL: func.func @wrappedAlready
 //  CHECK-SAME: (%arg0: !hal.buffer_view) -> !hal.buffer_view
 //  CHECK-SAME: attributes {iree.abi.stub}
@@ -0,0 +1,193 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//===- ApplyTuningDatabase.cpp --------------------------------------------===//
+//
+// Attaches tuned `#iree_codegen.compilation_info` attributes to the root ops
+// of dispatches from a database produced by the lowering config autotuner
+// (build_tools/benchmarks/tune_lowering_configs.py). The database is a JSON
+// object mapping dispatch signatures to compilation info:
+//   {
+//     "llvm:embedded-elf-x86_64:linalg.matmul(...)->(...)":
+//         "#iree_codegen.compilation_info<...>"
+//   }
+// Dispatches not in the database keep using the default heuristics.
+//
+//===----------------------------------------------------------------------===//
+
+#include "iree/compiler/Codegen/Dialect/IREECodegenDialect.h"
+#include "iree/compiler/Codegen/Dialect/LoweringConfig.h"
+#include "iree/compiler/Codegen/PassDetail.h"
+#include "iree/compiler/Codegen/Passes.h"
+#include "iree/compiler/Codegen/Utils/Utils.h"
+#include "iree/compiler/Dialect/HAL/IR/HALOps.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Parser/Parser.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Support/FileUtilities.h"
+
+#define DEBUG_TYPE "iree-codegen-apply-tuning-database"
+
+namespace mlir {
+namespace iree_compiler {
+
+static llvm::cl::opt<std::string> clTuningDatabase(
+    "iree-codegen-tuning-database",
+    llvm::cl::desc("JSON file mapping dispatch signatures to the "
+                   "#iree_codegen.compilation_info to use for them"),
+    llvm::cl::init(""));
+
+static llvm::cl::opt<bool> clPrintTuningSignatures(
+    "iree-codegen-print-tuning-signatures",
+    llvm::cl::desc("Prints the tuning database signature of each dispatch to "
+                   "stderr"),
+    llvm::cl::init(false));
+
+namespace {
+
+/// Returns the op the tuned configuration is attached to: the last
+/// reduction (contraction, convolution, ...) in the dispatch if any and the
+/// last compute op otherwise. This mirrors the root op selection of the
+/// backends closely enough for the configuration to be picked up.
+static Operation *getTuningRootOp(ArrayRef<Operation *> computeOps) {
+  Operation *rootOp = nullptr;
+  for (auto op : llvm::reverse(computeOps)) {
+    if (isa<linalg::FillOp>(op)) continue;
+    auto linalgOp = dyn_cast<linalg::LinalgOp>(op);
+    if (linalgOp && linalgOp.getNumReductionLoops() != 0) return op;
+    if (!rootOp) rootOp = op;
+  }
+  return rootOp;
+}
+
+/// Returns the signature of |rootOp| identifying the dispatch in the tuning
+/// database, e.g.
+///   llvm:embedded-elf-x86_64:linalg.matmul(tensor<128x256xf32>,
+///       tensor<256x512xf32>, tensor<128x512xf32>)->(tensor<128x512xf32>)
+/// Attributes of the op that are set by codegen itself are left out.
+static std::string getTuningSignature(
+    IREE::HAL::ExecutableTargetAttr targetAttr, Operation *rootOp) {
+  std::string signature;
+  llvm::raw_string_ostream os(signature);
+  os << targetAttr.getBackend().getValue() << ":"
+     << targetAttr.getFormat().getValue() << ":"
+     << rootOp->getName().getStringRef() << "(";
+  llvm::interleaveComma(rootOp->getOperandTypes(), os);
+  os << ")->(";
+  llvm::interleaveComma(rootOp->getResultTypes(), os);
+  os << ")";
+  NamedAttrList attrs(rootOp->getAttrDictionary());
+  for (StringRef name :
+       {"operand_segment_sizes", "lowering_config", "compilation_info",
+        "__internal_linalg_transform__"}) {
+    attrs.erase(name);
+  }
+  if (!attrs.empty()) {
+    os << " ";
+    attrs.getDictionary(rootOp->getContext()).print(os);
+  }
+  return os.str();
+}
+
+class ApplyTuningDatabasePass
+    : public ApplyTuningDatabaseBase<ApplyTuningDatabasePass> {
+ public:
+  ApplyTuningDatabasePass() = default;
+  ApplyTuningDatabasePass(StringRef database, bool printSignatures) {
+    this->database = database.str();
+    this->printSignatures = printSignatures;
+  }
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<IREE::Codegen::IREECodegenDialect>();
+  }
+
+  LogicalResult initialize(MLIRContext *context) override {
+    if (database.empty()) return success();
+    std::string errorMessage;
+    auto file = openInputFile(database, &errorMessage);
+    if (!file) {
+      return emitError(UnknownLoc::get(context))
+             << "failed to open tuning database '" << database
+             << "': " << errorMessage;
+    }
+    auto json = llvm::json::parse(file->getBuffer());
+    if (!json) {
+      return emitError(UnknownLoc::get(context))
+             << "failed to parse tuning database '" << database
+             << "': " << llvm::toString(json.takeError());
+    }
+    auto *entries = json->getAsObject();
+    if (!entries) {
+      return emitError(UnknownLoc::get(context))
+             << "tuning database '" << database << "' is not a JSON object";
+    }
+    for (auto &entry : *entries) {
+      auto value = entry.second.getAsString();
+      auto compilationInfo =
+          value ? parseAttribute(*value, context)
+                      .dyn_cast_or_null<IREE::Codegen::CompilationInfoAttr>()
+                : nullptr;
+      if (!compilationInfo) {
+        return emitError(UnknownLoc::get(context))
+               << "invalid compilation info for '" << entry.first.str()
+               << "' in tuning database '" << database << "'";
+      }
+      compilationInfos[entry.first.str()] = compilationInfo;
+    }
+    return success();
+  }
+
+  void runOnOperation() override {
+    if (compilationInfos.empty() && !printSignatures) return;
+    IREE::HAL::ExecutableVariantOp variantOp = getOperation();
+    ModuleOp moduleOp = variantOp.getInnerModule();
+    auto targetAttr = variantOp.target();
+    llvm::StringMap<IREE::HAL::ExecutableExportOp> exportOps =
+        getAllEntryPoints(moduleOp);
+    for (auto funcOp : moduleOp.getOps<func::FuncOp>()) {
+      auto exportOp = exportOps.lookup(funcOp.getName());
+      if (!exportOp) continue;
+      SmallVector<Operation *> computeOps;
+      SmallVector<LoopTilingAndDistributionInfo> tiledLoops;
+      if (failed(getComputeOps(funcOp, computeOps, tiledLoops))) {
+        return signalPassFailure();
+      }
+      // Dispatches that were already configured, e.g. by the user, are left
+      // alone.
+      if (!tiledLoops.empty() || getTranslationInfo(exportOp)) continue;
+      Operation *rootOp = getTuningRootOp(computeOps);
+      if (!rootOp || getCompilationInfo(rootOp)) continue;
+
+      std::string signature = getTuningSignature(targetAttr, rootOp);
+      if (printSignatures) {
+        llvm::errs() << "// tuning signature @" << exportOp.sym_name()
+                     << ": " << llvm::json::Value(signature) << "\n";
+      }
+      auto it = compilationInfos.find(signature);
+      if (it == compilationInfos.end()) continue;
+      setCompilationInfo(rootOp, it->second);
+    }
+  }
+
+ private:
+  llvm::StringMap<IREE::Codegen::CompilationInfoAttr> compilationInfos;
+};
+
+}  // namespace
+
+std::unique_ptr<OperationPass<IREE::HAL::ExecutableVariantOp>>
+createApplyTuningDatabasePass() {
+  return std::make_unique<ApplyTuningDatabasePass>(clTuningDatabase,
+                                                   clPrintTuningSignatures);
+}
+
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -0,0 +1,104 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/compiler/Codegen/PassDetail.h"
+#include "iree/compiler/Codegen/Passes.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
+#include "mlir/Pass/Pass.h"
+
+namespace mlir {
+namespace iree_compiler {
+
+/// Returns the allocation `buffer` is a view of, if any.
+static Operation *getAllocation(Value buffer) {
+  while (auto viewOp = buffer.getDefiningOp<ViewLikeOpInterface>()) {
+    buffer = viewOp.getViewSource();
+  }
+  Operation *defOp = buffer.getDefiningOp();
+  if (!defOp || !isa<memref::AllocOp, memref::AllocaOp>(defOp)) return nullptr;
+  return defOp;
+}
+
+/// Returns true if `allocOp` allocates memory in the default memory space.
+/// Allocations in other memory spaces, such as GPU workgroup memory, are made
+/// deliberately and not reported.
+static bool isDefaultMemorySpace(Operation *allocOp) {
+  auto type = allocOp->getResult(0).getType().cast<MemRefType>();
+  return !type.getMemorySpace();
+}
+
+/// Returns the source and target of `op` if it copies one buffer into another
+/// without modification.
+static Optional<std::pair<Value, Value>> getCopySourceAndTarget(
+    Operation *op) {
+  if (auto copyOp = dyn_cast<memref::CopyOp>(op)) {
+    return std::make_pair(copyOp.source(), copyOp.target());
+  }
+  auto genericOp = dyn_cast<linalg::GenericOp>(op);
+  if (!genericOp || !genericOp.hasBufferSemantics() ||
+      genericOp.getNumInputs() != 1 || genericOp.getNumOutputs() != 1) {
+    return llvm::None;
+  }
+  if (!llvm::all_of(genericOp.getIndexingMaps(),
+                    [](AffineMap map) { return map.isIdentity(); })) {
+    return llvm::None;
+  }
+  Block &body = genericOp.region().front();
+  auto yieldOp = dyn_cast<linalg::YieldOp>(body.getTerminator());
+  if (&body.front() != yieldOp.getOperation() ||
+      yieldOp.getOperand(0) != body.getArgument(0)) {
+    return llvm::None;
+  }
+  return std::make_pair(genericOp.getInputOperand(0)->get(),
+                        genericOp.getOutputOperand(0)->get());
+}
+
+namespace {
+struct CheckTransientBuffersPass
+    : CheckTransientBuffersBase<CheckTransientBuffersPass> {
+  explicit CheckTransientBuffersPass(bool fail) { this->fail = fail; }
+  void runOnOperation() override;
+};
+}  // namespace
+
+void CheckTransientBuffersPass::runOnOperation() {
+  func::FuncOp funcOp = getOperation();
+  bool foundTransientBuffer = false;
+  auto report = [&](Operation *op) {
+    foundTransientBuffer = true;
+    return fail ? op->emitError() : op->emitWarning();
+  };
+
+  funcOp.walk([&](Operation *op) {
+    if (isa<memref::AllocOp, memref::AllocaOp>(op)) {
+      if (!isDefaultMemorySpace(op)) return;
+      report(op) << "transient "
+                 << (isa<memref::AllocaOp>(op) ? "stack" : "heap")
+                 << " allocation of " << op->getResult(0).getType();
+      return;
+    }
+    auto copy = getCopySourceAndTarget(op);
+    if (!copy) return;
+    Operation *sourceAlloc = getAllocation(copy->first);
+    Operation *targetAlloc = getAllocation(copy->second);
+    if ((sourceAlloc && isDefaultMemorySpace(sourceAlloc)) ||
+        (targetAlloc && isDefaultMemorySpace(targetAlloc))) {
+      report(op) << "copy through a transient buffer";
+    }
+  });
+
+  if (fail && foundTransientBuffer) return signalPassFailure();
+}
+
+std::unique_ptr<OperationPass<func::FuncOp>> createCheckTransientBuffersPass(
+    bool fail) {
+  return std::make_unique<CheckTransientBuffersPass>(fail);
+}
+
+}  // namespace iree_compiler
+}  // namespace mlir
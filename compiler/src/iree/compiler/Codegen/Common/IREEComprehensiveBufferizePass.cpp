@@ -64,6 +64,12 @@ using mlir::bufferization::OneShotBufferizationOptions;
 namespace mlir {
 namespace iree_compiler {
 
+static llvm::cl::opt<bool> clCheckTransientBuffers(
+    "iree-codegen-check-transient-buffers",
+    llvm::cl::desc("Warn about allocations and copies through them that are "
+                   "left in dispatches after bufferization"),
+    llvm::cl::init(false));
+
 namespace {
 
 /// Pass to convert from tensor based ops to memref based ops.
@@ -106,6 +112,77 @@ class IREEComprehensiveBufferizePass
 
 static bool isaTensor(Type t) { return t.isa<TensorType>(); };
 
+/// Returns a copy of `from` into `to` as a linalg.generic on tensors.
+static Value createTensorCopy(OpBuilder &b, Location loc, Value from,
+                              Value to) {
+  auto type = to.getType().cast<RankedTensorType>();
+  AffineMap id = b.getMultiDimIdentityMap(type.getRank());
+  SmallVector<StringRef> iteratorTypes(type.getRank(),
+                                       getParallelIteratorTypeName());
+  auto genericOp = b.create<linalg::GenericOp>(
+      loc, /*resultTensorTypes=*/TypeRange{type}, /*inputs=*/from,
+      /*outputs=*/to, /*indexingMaps=*/llvm::makeArrayRef({id, id}),
+      /*iteratorTypes=*/iteratorTypes,
+      [](OpBuilder &b, Location loc, ValueRange args) {
+        b.create<linalg::YieldOp>(loc, args.front());
+      });
+  return genericOp.getResult(0);
+}
+
+/// Redirects chains of tensor.insert_slice ops that are stored to an output
+/// but insert into a load from a read-only binding. The load cannot be written
+/// in place so bufferization would allocate a temporary, copy the loaded
+/// tensor into it, insert into the temporary and copy all of it again to the
+/// output. Copying the loaded tensor straight into the output instead lets the
+/// insert_slice ops, and through them the producers of the inserted slices,
+/// write directly into their final location.
+static void insertSlicesIntoStoreTarget(Operation *op) {
+  SmallVector<IREE::Flow::DispatchTensorStoreOp> storeOps;
+  op->walk([&](IREE::Flow::DispatchTensorStoreOp storeOp) {
+    storeOps.push_back(storeOp);
+  });
+  DominanceInfo domInfo(op);
+  OpBuilder builder(op->getContext());
+  for (auto storeOp : storeOps) {
+    auto insertOp = storeOp.value().getDefiningOp<tensor::InsertSliceOp>();
+    if (!insertOp || !insertOp->hasOneUse()) continue;
+    while (auto prevOp =
+               insertOp.dest().getDefiningOp<tensor::InsertSliceOp>()) {
+      if (!prevOp->hasOneUse()) break;
+      insertOp = prevOp;
+    }
+    auto loadOp =
+        insertOp.dest().getDefiningOp<IREE::Flow::DispatchTensorLoadOp>();
+    if (!loadOp) continue;
+    auto sourceType =
+        loadOp.source().getType().cast<IREE::Flow::DispatchTensorType>();
+    if (sourceType.getAccess() != IREE::Flow::TensorAccess::ReadOnly) continue;
+
+    // The output slice is materialized where the chain starts.
+    SmallVector<Value> storeOperands = {storeOp.target()};
+    llvm::append_range(storeOperands, storeOp.target_dims());
+    llvm::append_range(storeOperands, storeOp.offsets());
+    llvm::append_range(storeOperands, storeOp.sizes());
+    llvm::append_range(storeOperands, storeOp.strides());
+    if (!llvm::all_of(storeOperands, [&](Value value) {
+          return domInfo.properlyDominates(value, insertOp);
+        })) {
+      continue;
+    }
+
+    builder.setInsertionPoint(insertOp);
+    Location loc = storeOp.getLoc();
+    auto targetOp = builder.create<IREE::Flow::DispatchTensorLoadOp>(
+        loc, storeOp.value().getType().cast<RankedTensorType>(),
+        storeOp.target(), storeOp.target_dims(),
+        storeOp.getMixedOffsets(), storeOp.getMixedSizes(),
+        storeOp.getMixedStrides());
+    Value copy =
+        createTensorCopy(builder, loc, insertOp.dest(), targetOp.result());
+    insertOp.destMutable().assign(copy);
+  }
+}
+
 static LogicalResult initTensorElimination(
     Operation *op, OneShotBufferizationOptions options) {
   // Analyze IR.
@@ -153,6 +230,8 @@ void IREEComprehensiveBufferizePass::runOnOperation() {
   options.opFilter.denyOperation<arith::ConstantOp>();
   options.opFilter.denyOperation<bufferization::ToMemrefOp>();
 
+  insertSlicesIntoStoreTarget(moduleOp);
+
   if (failed(initTensorElimination(moduleOp.getOperation(), options))) {
     return signalPassFailure();
   }
@@ -208,6 +287,9 @@ void addIREEComprehensiveBufferizePasses(
   // memrefs are unified in CSE pass, so we can truely remove redundant memcpy.
   passManager.addNestedPass<func::FuncOp>(createCanonicalizerPass());
   passManager.addNestedPass<func::FuncOp>(createCleanupBufferAllocViewPass());
+  if (clCheckTransientBuffers) {
+    passManager.addNestedPass<func::FuncOp>(createCheckTransientBuffersPass());
+  }
 }
 
 }  // namespace iree_compiler
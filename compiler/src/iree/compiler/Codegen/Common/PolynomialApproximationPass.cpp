@@ -5,14 +5,36 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 #include "iree/compiler/Codegen/PassDetail.h"
 #include "iree/compiler/Codegen/Passes.h"
+#include "iree/compiler/Codegen/Utils/Utils.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
+#include "mlir/Dialect/Math/IR/Math.h"
 #include "mlir/Dialect/Math/Transforms/Approximation.h"
 #include "mlir/Dialect/Math/Transforms/Passes.h"
+#include "mlir/IR/ImplicitLocOpBuilder.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
 namespace mlir {
 namespace iree_compiler {
 
+namespace {
+
+/// Accuracy tiers for lowering math dialect elementary functions.
+enum class MathAccuracy {
+  /// Accurate device library routines where the target has them (CUDA
+  /// libdevice, ROCm device libraries) and the polynomial approximations
+  /// otherwise.
+  Strict,
+  /// Polynomial approximations accurate to a few ulp in f32.
+  Ulp,
+  /// Cheapest available lowering: native math on GPUs and reduced degree
+  /// approximations without special value handling elsewhere.
+  Fast,
+};
+
+}  // namespace
+
 /// Command line to use native hardware operations instead of polynomial
 /// approximation.
 static llvm::cl::opt<bool> clNativeMathPrecision(
@@ -21,16 +43,177 @@ static llvm::cl::opt<bool> clNativeMathPrecision(
         "Skip polynomial lowering for math op natively available on GPU"),
     llvm::cl::init(false));
 
+/// Command line to select the default accuracy tier of math functions.
+static llvm::cl::opt<MathAccuracy> clMathAccuracy(
+    "iree-codegen-math-accuracy",
+    llvm::cl::desc(
+        "Default accuracy of math functions such as exp and tanh. Can be "
+        "overridden per target with the `math_accuracy` executable target "
+        "configuration entry and per module or dispatch function with the "
+        "`iree.codegen.math_accuracy` attribute"),
+    llvm::cl::values(
+        clEnumValN(MathAccuracy::Strict, "strict",
+                   "Use accurate device libraries where available"),
+        clEnumValN(MathAccuracy::Ulp, "ulp",
+                   "Use polynomial approximations accurate to a few ulp"),
+        clEnumValN(MathAccuracy::Fast, "fast",
+                   "Use native math on GPUs and faster, less accurate "
+                   "approximations elsewhere")),
+    llvm::cl::init(MathAccuracy::Ulp));
+
+/// Attribute selecting the accuracy tier of the functions nested under the op
+/// it is attached to.
+static const char kMathAccuracyAttrName[] = "iree.codegen.math_accuracy";
+
+/// Entry of the executable target configuration selecting the accuracy tier
+/// of all functions compiled for the target.
+static const char kMathAccuracyConfigName[] = "math_accuracy";
+
+static Optional<MathAccuracy> parseMathAccuracy(StringRef name) {
+  return llvm::StringSwitch<Optional<MathAccuracy>>(name)
+      .Case("strict", MathAccuracy::Strict)
+      .Case("ulp", MathAccuracy::Ulp)
+      .Case("fast", MathAccuracy::Fast)
+      .Default(llvm::None);
+}
+
+/// Returns the accuracy tier requested for `op`: the closest enclosing
+/// `iree.codegen.math_accuracy` attribute or `math_accuracy` target
+/// configuration entry, and the command line default if there is none.
+static FailureOr<MathAccuracy> getMathAccuracy(Operation *op) {
+  for (Operation *it = op; it; it = it->getParentOp()) {
+    StringAttr attr = it->getAttrOfType<StringAttr>(kMathAccuracyAttrName);
+    if (auto variantOp = dyn_cast<IREE::HAL::ExecutableVariantOp>(it)) {
+      if (auto config = variantOp.target().getConfiguration()) {
+        if (!attr) attr = config.getAs<StringAttr>(kMathAccuracyConfigName);
+      }
+    }
+    if (!attr) continue;
+    Optional<MathAccuracy> accuracy = parseMathAccuracy(attr.getValue());
+    if (!accuracy) {
+      return it->emitOpError("unknown math accuracy '")
+             << attr.getValue() << "'; expected 'strict', 'ulp' or 'fast'";
+    }
+    return accuracy.getValue();
+  }
+  return clMathAccuracy.getValue();
+}
+
+/// Returns true if the target of `op` lowers math ops to accurate device
+/// library routines.
+static bool hasDeviceMathLibrary(Operation *op) {
+  auto variantOp = getExecutableVariantOp(op);
+  if (failed(variantOp)) return false;
+  StringRef backend = variantOp->target().getBackend().getValue();
+  return backend == "cuda" || backend == "rocm";
+}
+
+/// Returns true if the target of `op` is a GPU with native math operations.
+static bool hasNativeMath(Operation *op) {
+  auto variantOp = getExecutableVariantOp(op);
+  if (failed(variantOp)) return false;
+  StringRef backend = variantOp->target().getBackend().getValue();
+  return backend == "cuda" || backend == "rocm" || backend == "vulkan" ||
+         backend == "metal" || backend == "webgpu";
+}
+
 namespace {
 
+/// Approximates f32 exp(x) as 2^n * p(f) where x * log2(e) = n + f with n an
+/// integer and f in [-0.5, 0.5]. p is a degree 4 minimax polynomial of 2^f
+/// with a relative error below 3e-6, giving about 1e-5 overall. Inputs are
+/// clamped to [-87, 88] so results neither flush to zero nor overflow to
+/// infinity, and NaN inputs give unspecified results. This is a handful of
+/// vector ops with no selects and vectorizes to any SIMD ISA.
+struct FastExpApproximation : public OpRewritePattern<math::ExpOp> {
+  using OpRewritePattern<math::ExpOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(math::ExpOp op,
+                                PatternRewriter &rewriter) const override {
+    Type type = op.getType();
+    if (!getElementTypeOrSelf(type).isF32()) return failure();
+    auto vectorType = type.dyn_cast<VectorType>();
+    Type intType = rewriter.getI32Type();
+    if (vectorType) intType = VectorType::get(vectorType.getShape(), intType);
+
+    ImplicitLocOpBuilder b(op.getLoc(), rewriter);
+    auto splat = [&](Type splatType, Attribute attr) -> Value {
+      if (auto splatVectorType = splatType.dyn_cast<VectorType>()) {
+        attr = DenseElementsAttr::get(splatVectorType, attr);
+      }
+      return b.create<arith::ConstantOp>(attr);
+    };
+    auto f32Cst = [&](float value) {
+      return splat(type, b.getF32FloatAttr(value));
+    };
+    auto i32Cst = [&](int32_t value) {
+      return splat(intType, b.getI32IntegerAttr(value));
+    };
+
+    Value x = b.create<arith::MaxFOp>(op.getOperand(), f32Cst(-87.0f));
+    x = b.create<arith::MinFOp>(x, f32Cst(88.0f));
+    Value t = b.create<arith::MulFOp>(x, f32Cst(1.44269504f));
+    Value n =
+        b.create<math::FloorOp>(b.create<arith::AddFOp>(t, f32Cst(0.5f)));
+    Value f = b.create<arith::SubFOp>(t, n);
+
+    Value p = f32Cst(9.582743049e-03f);
+    for (float c : {5.590628088e-02f, 2.402409911e-01f, 6.931242347e-01f,
+                    1.0f}) {
+      p = b.create<math::FmaOp>(p, f, f32Cst(c));
+    }
+
+    // 2^n built directly from its exponent bits; n is in [-125, 127].
+    Value exponent = b.create<arith::FPToSIOp>(intType, n);
+    exponent = b.create<arith::AddIOp>(exponent, i32Cst(127));
+    exponent = b.create<arith::ShLIOp>(exponent, i32Cst(23));
+    Value scale = b.create<arith::BitcastOp>(type, exponent);
+    rewriter.replaceOpWithNewOp<arith::MulFOp>(op, p, scale);
+    return success();
+  }
+};
+
 /// math dialect elementry functions -> polynomial form.
 class PolynomialApproximationPass
     : public PolynomialApproximationPassBase<PolynomialApproximationPass> {
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<arith::ArithmeticDialect, math::MathDialect>();
+  }
+
   void runOnOperation() override {
+    Operation *op = getOperation();
+    FailureOr<MathAccuracy> mathAccuracy = failure();
+    if (!accuracy.empty()) {
+      Optional<MathAccuracy> option = parseMathAccuracy(accuracy);
+      if (!option) {
+        op->emitError("unknown math accuracy '") << accuracy << "'";
+        return signalPassFailure();
+      }
+      mathAccuracy = option.getValue();
+    } else {
+      mathAccuracy = getMathAccuracy(op);
+      if (failed(mathAccuracy)) return signalPassFailure();
+    }
+
+    bool useNativeMath = clNativeMathPrecision;
+    switch (*mathAccuracy) {
+      case MathAccuracy::Strict:
+        useNativeMath |= hasDeviceMathLibrary(op);
+        break;
+      case MathAccuracy::Ulp:
+        break;
+      case MathAccuracy::Fast:
+        useNativeMath |= hasNativeMath(op);
+        break;
+    }
+
     RewritePatternSet mathPatterns(&getContext());
-    if (clNativeMathPrecision) {
+    if (useNativeMath) {
       mathPatterns.add<math::ErfPolynomialApproximation>(&getContext());
     } else {
+      if (*mathAccuracy == MathAccuracy::Fast) {
+        mathPatterns.add<FastExpApproximation>(&getContext(), /*benefit=*/2);
+      }
       populateMathPolynomialApproximationPatterns(mathPatterns);
     }
     if (failed(applyPatternsAndFoldGreedily(getOperation(),
@@ -11,7 +11,9 @@
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
 #include "mlir/Dialect/GPU/IR/GPUDialect.h"
 #include "mlir/Dialect/MemRef/IR/MemRef.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Vector/Transforms/VectorDistribution.h"
+#include "mlir/IR/BlockAndValueMapping.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 #include "mlir/Transforms/Passes.h"
 
@@ -92,8 +94,115 @@ class InsertElementToBroadcast final
   }
 };
 
-struct LLVMGPUReduceToGPUPass
-    : public LLVMGPUReduceToGPUBase<LLVMGPUReduceToGPUPass> {
+/// Pattern to accumulate partial sums in a loop carried vector and reduce it
+/// once after the loop, instead of fully reducing on every iteration:
+///   %r = scf.for ... iter_args(%acc = %init) -> (vector<1xf32>) {
+///     %s = vector.reduction <add>, %v : vector<32xf32> into f32
+///     %b = vector.broadcast %s : f32 to vector<1xf32>
+///     %a = arith.addf %b, %acc : vector<1xf32>
+///     scf.yield %a : vector<1xf32>
+///   }
+/// ->
+///   %p = scf.for ... iter_args(%acc = %zero) -> (vector<32xf32>) {
+///     %a = arith.addf %v, %acc : vector<32xf32>
+///     scf.yield %a : vector<32xf32>
+///   }
+///   %s = vector.reduction <add>, %p : vector<32xf32> into f32
+///   %b = vector.broadcast %s : f32 to vector<1xf32>
+///   %r = arith.addf %b, %init : vector<1xf32>
+/// Once distributed, each lane keeps its partial sum in a register and the
+/// butterfly of warp shuffles is only emitted once per reduction instead of
+/// once per loop iteration.
+class HoistReductionOutOfLoop final : public OpRewritePattern<scf::ForOp> {
+ public:
+  using OpRewritePattern<scf::ForOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(scf::ForOp forOp,
+                                PatternRewriter &rewriter) const override {
+    auto yieldOp = cast<scf::YieldOp>(forOp.getBody()->getTerminator());
+    for (auto it : llvm::enumerate(forOp.getRegionIterArgs())) {
+      BlockArgument iterArg = it.value();
+      unsigned index = it.index();
+      if (!iterArg.hasOneUse()) continue;
+      Operation *addOp = yieldOp.getOperand(index).getDefiningOp();
+      if (!addOp || !isa<arith::AddFOp, arith::AddIOp>(addOp) ||
+          !addOp->hasOneUse() || *iterArg.user_begin() != addOp) {
+        continue;
+      }
+      Value partial = addOp->getOperand(0) == iterArg ? addOp->getOperand(1)
+                                                      : addOp->getOperand(0);
+      auto broadcastOp = partial.getDefiningOp<vector::BroadcastOp>();
+      if (broadcastOp) {
+        if (!broadcastOp->hasOneUse()) continue;
+        partial = broadcastOp.getSource();
+      }
+      auto reductionOp = partial.getDefiningOp<vector::ReductionOp>();
+      if (!reductionOp || reductionOp.getKind() != vector::CombiningKind::ADD ||
+          reductionOp->getNumOperands() != 1 || !reductionOp->hasOneUse() ||
+          reductionOp->getBlock() != forOp.getBody()) {
+        continue;
+      }
+      auto vectorType = reductionOp.getVector().getType().cast<VectorType>();
+
+      auto createAdd = [&](OpBuilder &b, Location loc, Value lhs,
+                           Value rhs) -> Value {
+        if (isa<arith::AddFOp>(addOp)) {
+          return b.create<arith::AddFOp>(loc, lhs, rhs);
+        }
+        return b.create<arith::AddIOp>(loc, lhs, rhs);
+      };
+      Location loc = forOp.getLoc();
+      SmallVector<Value> initArgs = llvm::to_vector(forOp.getIterOperands());
+      Value init = initArgs[index];
+      initArgs[index] = rewriter.create<arith::ConstantOp>(
+          loc, vectorType, rewriter.getZeroAttr(vectorType));
+      auto newForOp = rewriter.create<scf::ForOp>(
+          loc, forOp.getLowerBound(), forOp.getUpperBound(), forOp.getStep(),
+          initArgs,
+          [&](OpBuilder &b, Location nestedLoc, Value iv, ValueRange args) {
+            BlockAndValueMapping mapping;
+            mapping.map(forOp.getInductionVar(), iv);
+            mapping.map(forOp.getRegionIterArgs(), args);
+            for (Operation &op : forOp.getBody()->without_terminator()) {
+              if (&op == addOp || &op == broadcastOp.getOperation() ||
+                  &op == reductionOp.getOperation()) {
+                continue;
+              }
+              b.clone(op, mapping);
+            }
+            SmallVector<Value> yieldedValues;
+            for (Value value : yieldOp.getOperands()) {
+              yieldedValues.push_back(mapping.lookupOrDefault(value));
+            }
+            yieldedValues[index] =
+                createAdd(b, nestedLoc,
+                          mapping.lookupOrDefault(reductionOp.getVector()),
+                          args[index]);
+            b.create<scf::YieldOp>(nestedLoc, yieldedValues);
+          });
+
+      Value result = rewriter.create<vector::ReductionOp>(
+          loc, vector::CombiningKind::ADD, newForOp.getResult(index));
+      if (broadcastOp) {
+        result = rewriter.create<vector::BroadcastOp>(
+            loc, broadcastOp.getVectorType(), result);
+      }
+      SmallVector<Value> results = llvm::to_vector(newForOp.getResults());
+      results[index] = createAdd(rewriter, loc, result, init);
+      rewriter.replaceOp(forOp, results);
+      return success();
+    }
+    return failure();
+  }
+};
+
+class VectorReductionToGPUPass
+    : public VectorReductionToGPUBase<VectorReductionToGPUPass> {
+ public:
+  explicit VectorReductionToGPUPass(
+      std::function<int(func::FuncOp)> getWarpSize)
+      : getWarpSize(getWarpSize) {}
+
   void getDependentDialects(DialectRegistry &registry) const override {
     registry.insert<scf::SCFDialect>();
   }
@@ -111,8 +220,15 @@ struct LLVMGPUReduceToGPUPass
       (void)applyPatternsAndFoldGreedily(getOperation(), std::move(patterns));
     }
 
+    // Keep the reductions of loops as partial sums until after the loop.
+    {
+      RewritePatternSet patterns(ctx);
+      patterns.add<HoistReductionOutOfLoop>(ctx);
+      (void)applyPatternsAndFoldGreedily(getOperation(), std::move(patterns));
+    }
+
     // 2. Create the warp op and move the function body into it.
-    const int warpSize = 32;
+    const int warpSize = getWarpSize ? getWarpSize(funcOp) : 32;
     Location loc = funcOp.getLoc();
     OpBuilder builder(funcOp);
     auto threadX = builder.create<gpu::ThreadIdOp>(loc, builder.getIndexType(),
@@ -169,19 +285,27 @@ struct LLVMGPUReduceToGPUPass
       RewritePatternSet patterns(ctx);
       vector::WarpExecuteOnLane0LoweringOptions options;
       options.warpAllocationFn = allocateGlobalSharedMemory;
+      // Values broadcast through shared memory are written by lane 0 only;
+      // make them visible to the other lanes before they are read.
       options.warpSyncronizationFn = [](Location loc, OpBuilder &builder,
-                                        vector::WarpExecuteOnLane0Op warpOp) {};
+                                        vector::WarpExecuteOnLane0Op warpOp) {
+        builder.create<gpu::BarrierOp>(loc);
+      };
       vector::populateWarpExecuteOnLane0OpToScfForPattern(patterns, options);
       (void)applyPatternsAndFoldGreedily(getOperation(), std::move(patterns));
     }
   }
+
+ private:
+  std::function<int(func::FuncOp)> getWarpSize;
 };
 
 }  // anonymous namespace
 
 std::unique_ptr<OperationPass<func::FuncOp>>
-createConvertVectorReductionToGPUPass() {
-  return std::make_unique<LLVMGPUReduceToGPUPass>();
+createConvertVectorReductionToGPUPass(
+    std::function<int(func::FuncOp)> getWarpSize) {
+  return std::make_unique<VectorReductionToGPUPass>(getWarpSize);
 }
 
 }  // namespace iree_compiler
@@ -5,12 +5,19 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 #include "iree/compiler/Codegen/PassDetail.h"
 #include "iree/compiler/Codegen/Passes.h"
+#include "llvm/Support/CommandLine.h"
 #include "mlir/Dialect/Affine/IR/AffineOps.h"
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
 
 namespace mlir {
 namespace iree_compiler {
 
+static llvm::cl::opt<int> clLogSwizzleTile(
+    "iree-codegen-log-swizzle-tile",
+    llvm::cl::desc("log2 of the workgroup swizzle tile, overriding the one "
+                   "picked by the kernel configuration (0 disables swizzling)"),
+    llvm::cl::init(-1));
+
 /// This function implements the following swizzling logic
 /// void getTiledId2(unsigned x, unsigned y, unsigned* tiledx,
 ///                 unsigned* tiledy) {
@@ -110,6 +117,7 @@ struct WorkGroupSwizzlePass
 
 std::unique_ptr<OperationPass<func::FuncOp>> createWorkGroupSwizzle(
     unsigned swizzleLogTile) {
+  if (clLogSwizzleTile >= 0) swizzleLogTile = clLogSwizzleTile;
   return std::make_unique<WorkGroupSwizzlePass>(swizzleLogTile);
 }
 
@@ -0,0 +1,102 @@
+// RUN: iree-opt --pass-pipeline='hal.executable(hal.executable.variant(iree-codegen-apply-tuning-database{print-signatures=true}))' --split-input-file %s 2>&1 | FileCheck %s --check-prefix=SIGNATURE
+// RUN: echo '{"llvm:embedded-elf-x86_64:linalg.matmul(tensor<128x256xf32>, tensor<256x512xf32>, tensor<128x512xf32>)->(tensor<128x512xf32>)": "#iree_codegen.compilation_info<lowering_config = <tile_sizes = [[32, 128, 0], [8, 32, 0], [0, 0, 16]]>, translation_info = <CPUDoubleTilingExpert>, workgroup_size = []>"}' > %t.json
+// RUN: iree-opt --pass-pipeline="hal.executable(hal.executable.variant(iree-codegen-apply-tuning-database{database=%t.json}))" --split-input-file %s | FileCheck %s
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>,
+    #hal.descriptor_set.binding<2, storage_buffer>
+  ]>
+]>
+#executable_target_embedded_elf_x86_64_ = #hal.executable.target<"llvm", "embedded-elf-x86_64", {
+  data_layout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128",
+  native_vector_size = 16 : index,
+  target_triple = "x86_64-unknown-unknown-eabi-elf"
+}>
+hal.executable private @matmul {
+  hal.executable.variant public @embedded_elf_x86_64, target = #executable_target_embedded_elf_x86_64_ {
+    hal.executable.export public @matmul layout(#executable_layout)
+    builtin.module {
+      func.func @matmul() {
+        %cst = arith.constant 0.000000e+00 : f32
+        %0 = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer)
+            : !flow.dispatch.tensor<readonly:128x256xf32>
+        %1 = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer)
+            : !flow.dispatch.tensor<readonly:256x512xf32>
+        %2 = hal.interface.binding.subspan set(0) binding(2) type(storage_buffer)
+            : !flow.dispatch.tensor<writeonly:128x512xf32>
+        %3 = flow.dispatch.tensor.load %0, offsets = [0, 0], sizes = [128, 256], strides = [1, 1]
+            : !flow.dispatch.tensor<readonly:128x256xf32> -> tensor<128x256xf32>
+        %4 = flow.dispatch.tensor.load %1, offsets = [0, 0], sizes = [256, 512], strides = [1, 1]
+            : !flow.dispatch.tensor<readonly:256x512xf32> -> tensor<256x512xf32>
+        %5 = linalg.init_tensor [128, 512] : tensor<128x512xf32>
+        %6 = linalg.fill ins(%cst : f32) outs(%5 : tensor<128x512xf32>) -> tensor<128x512xf32>
+        %7 = linalg.matmul ins(%3, %4 : tensor<128x256xf32>, tensor<256x512xf32>)
+            outs(%6 : tensor<128x512xf32>) -> tensor<128x512xf32>
+        flow.dispatch.tensor.store %7, %2, offsets = [0, 0], sizes = [128, 512], strides = [1, 1]
+            : tensor<128x512xf32> -> !flow.dispatch.tensor<writeonly:128x512xf32>
+        return
+      }
+    }
+  }
+}
+// SIGNATURE: // tuning signature @matmul: "llvm:embedded-elf-x86_64:linalg.matmul(tensor<128x256xf32>, tensor<256x512xf32>, tensor<128x512xf32>)->(tensor<128x512xf32>)"
+
+//  CHECK-DAG: #[[CONFIG:.+]] = #iree_codegen.lowering_config<tile_sizes = {{\[}}[32, 128, 0], [8, 32, 0], [0, 0, 16]{{\]}}>
+//  CHECK-DAG: #[[TRANSLATION:.+]] = #iree_codegen.translation_info<CPUDoubleTilingExpert>
+//  CHECK-DAG: #[[INFO:.+]] = #iree_codegen.compilation_info<lowering_config = #[[CONFIG]], translation_info = #[[TRANSLATION]], workgroup_size = []>
+//      CHECK: func.func @matmul()
+//  CHECK-NOT:   compilation_info
+//      CHECK:   linalg.fill
+//      CHECK:   linalg.matmul {compilation_info = #[[INFO]]}
+
+// -----
+
+// Dispatches that aren't in the database are left unchanged.
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>
+  ]>
+]>
+#executable_target_embedded_elf_x86_64_ = #hal.executable.target<"llvm", "embedded-elf-x86_64", {
+  data_layout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128",
+  native_vector_size = 16 : index,
+  target_triple = "x86_64-unknown-unknown-eabi-elf"
+}>
+hal.executable private @reduce {
+  hal.executable.variant public @embedded_elf_x86_64, target = #executable_target_embedded_elf_x86_64_ {
+    hal.executable.export public @reduce layout(#executable_layout)
+    builtin.module {
+      func.func @reduce() {
+        %cst = arith.constant 0.000000e+00 : f32
+        %0 = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer)
+            : !flow.dispatch.tensor<readonly:128x384xf32>
+        %1 = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer)
+            : !flow.dispatch.tensor<writeonly:128xf32>
+        %2 = flow.dispatch.tensor.load %0, offsets = [0, 0], sizes = [128, 384], strides = [1, 1]
+            : !flow.dispatch.tensor<readonly:128x384xf32> -> tensor<128x384xf32>
+        %3 = linalg.init_tensor [128] : tensor<128xf32>
+        %4 = linalg.fill ins(%cst : f32) outs(%3 : tensor<128xf32>) -> tensor<128xf32>
+        %5 = linalg.generic {
+            indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0)>],
+            iterator_types = ["parallel", "reduction"]}
+            ins(%2 : tensor<128x384xf32>) outs(%4 : tensor<128xf32>) {
+        ^bb0(%in: f32, %out: f32):
+          %6 = arith.addf %in, %out : f32
+          linalg.yield %6 : f32
+        } -> tensor<128xf32>
+        flow.dispatch.tensor.store %5, %1, offsets = [0], sizes = [128], strides = [1]
+            : tensor<128xf32> -> !flow.dispatch.tensor<writeonly:128xf32>
+        return
+      }
+    }
+  }
+}
+// SIGNATURE: // tuning signature @reduce: "llvm:embedded-elf-x86_64:linalg.generic(tensor<128x384xf32>, tensor<128xf32>)->(tensor<128xf32>) {indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0)>], iterator_types = [\"parallel\", \"reduction\"]}"
+
+//      CHECK: func.func @reduce()
+//  CHECK-NOT:   compilation_info
+//      CHECK:   return
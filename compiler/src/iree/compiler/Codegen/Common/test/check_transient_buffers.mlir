@@ -0,0 +1,48 @@
+// RUN: iree-opt --split-input-file --pass-pipeline='func.func(iree-codegen-check-transient-buffers)' --verify-diagnostics %s
+
+func.func @copy_through_alloc(%arg0: memref<4x8xf32>, %arg1: memref<4x8xf32>) {
+  // expected-warning @+1 {{transient heap allocation of 'memref<4x8xf32>'}}
+  %0 = memref.alloc() : memref<4x8xf32>
+  // expected-warning @+1 {{copy through a transient buffer}}
+  memref.copy %arg0, %0 : memref<4x8xf32> to memref<4x8xf32>
+  // expected-warning @+1 {{copy through a transient buffer}}
+  linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%0 : memref<4x8xf32>) outs(%arg1 : memref<4x8xf32>) {
+  ^bb0(%in: f32, %out: f32):
+    linalg.yield %in : f32
+  }
+  memref.dealloc %0 : memref<4x8xf32>
+  return
+}
+
+// -----
+
+func.func @copy_into_subview_of_alloca(%arg0: memref<4xf32>) {
+  // expected-warning @+1 {{transient stack allocation of 'memref<16xf32>'}}
+  %0 = memref.alloca() : memref<16xf32>
+  %1 = memref.subview %0[4] [4] [1] : memref<16xf32> to memref<4xf32, affine_map<(d0) -> (d0 + 4)>>
+  // expected-warning @+1 {{copy through a transient buffer}}
+  memref.copy %arg0, %1 : memref<4xf32> to memref<4xf32, affine_map<(d0) -> (d0 + 4)>>
+  return
+}
+
+// -----
+
+// Copies between bindings and allocations in other memory spaces, such as GPU
+// workgroup memory, are not reported.
+func.func @no_transient_buffers(%arg0: memref<4xf32>, %arg1: memref<4xf32>) {
+  %0 = memref.alloc() : memref<4xf32, 3>
+  memref.copy %arg0, %0 : memref<4xf32> to memref<4xf32, 3>
+  memref.copy %arg0, %arg1 : memref<4xf32> to memref<4xf32>
+  linalg.generic {
+      indexing_maps = [affine_map<(d0) -> (d0)>, affine_map<(d0) -> (d0)>],
+      iterator_types = ["parallel"]}
+      ins(%arg0 : memref<4xf32>) outs(%0 : memref<4xf32, 3>) {
+  ^bb0(%in: f32, %out: f32):
+    %1 = arith.addf %in, %in : f32
+    linalg.yield %1 : f32
+  }
+  return
+}
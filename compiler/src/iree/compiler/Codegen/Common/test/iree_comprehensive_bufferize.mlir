@@ -918,12 +918,12 @@ module {
 //   CHECK-DAG:   %[[D3:.+]] = hal.interface.constant.load[3] : index
 //   CHECK-DAG:   %[[D4:.+]] = hal.interface.constant.load[4] : index
 //   CHECK-DAG:   %[[D5:.+]] = hal.interface.constant.load[5] : index
-//   CHECK-DAG:   %[[ALLOC:.+]] = memref.alloc(%[[D2]], %[[D3]]) : memref<?x?xi32>
-//       CHECK:   linalg.generic {{.*}} ins(%[[ARG1]] {{.*}} outs(%[[ALLOC]]
-//       CHECK:   %[[SUB_ALLOC:.+]] = memref.subview %[[ALLOC]]
-//       CHECK:   linalg.generic {{.*}} ins(%[[ARG0]] {{.*}} outs(%[[SUB_ALLOC]]
-//       CHECK:   linalg.generic {{.*}} ins(%[[ALLOC]] {{.*}} outs(%[[RET0]]
-//       CHECK:   memref.dealloc %[[ALLOC]]
+//   CHECK-NOT:   memref.alloc
+//       CHECK:   linalg.generic {{.*}} ins(%[[ARG1]] {{.*}} outs(%[[RET0]]
+//       CHECK:   %[[SUB_RET0:.+]] = memref.subview %[[RET0]]
+//       CHECK:   linalg.generic {{.*}} ins(%[[ARG0]] {{.*}} outs(%[[SUB_RET0]]
+//   CHECK-NOT:   linalg.generic
+//   CHECK-NOT:   memref.dealloc
 
 // -----
 
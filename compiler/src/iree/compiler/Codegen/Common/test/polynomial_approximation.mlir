@@ -0,0 +1,104 @@
+// RUN: iree-opt --split-input-file --pass-pipeline='hal.executable(hal.executable.variant(builtin.module(func.func(iree-codegen-polynomial-approximation))))' %s | FileCheck %s
+
+// The default tier uses the upstream approximations on CPUs.
+
+hal.executable private @cpu_default {
+  hal.executable.variant @llvm, target = #hal.executable.target<"llvm-cpu", "embedded-elf-x86_64", {}> {
+    builtin.module {
+      func.func @exp(%arg0: f32) -> f32 {
+        %0 = math.exp %arg0 : f32
+        return %0 : f32
+      }
+    }
+  }
+}
+// CHECK-LABEL: func.func @exp
+//   CHECK-NOT:   math.exp
+//   CHECK-NOT:   arith.constant {{.*}}9.58274{{.*}} : f32
+//       CHECK:   return
+
+// -----
+
+// The target configuration selects the fast tier for all its dispatches.
+
+hal.executable private @cpu_fast {
+  hal.executable.variant @llvm, target = #hal.executable.target<"llvm-cpu", "embedded-elf-x86_64", {math_accuracy = "fast"}> {
+    builtin.module {
+      func.func @exp(%arg0: vector<8xf32>) -> vector<8xf32> {
+        %0 = math.exp %arg0 : vector<8xf32>
+        return %0 : vector<8xf32>
+      }
+    }
+  }
+}
+// CHECK-LABEL: func.func @exp
+//   CHECK-NOT:   math.exp
+//       CHECK:   arith.constant dense<{{.*}}9.58274{{.*}}> : vector<8xf32>
+//       CHECK:   math.fma
+//       CHECK:   arith.fptosi {{.*}} : vector<8xf32> to vector<8xi32>
+//       CHECK:   arith.shli
+//       CHECK:   arith.bitcast {{.*}} : vector<8xi32> to vector<8xf32>
+
+// -----
+
+// A dispatch function attribute overrides the tier of that function only.
+
+hal.executable private @cpu_per_dispatch {
+  hal.executable.variant @llvm, target = #hal.executable.target<"llvm-cpu", "embedded-elf-x86_64", {math_accuracy = "fast"}> {
+    builtin.module {
+      func.func @exp_fast(%arg0: f32) -> f32 {
+        %0 = math.exp %arg0 : f32
+        return %0 : f32
+      }
+      func.func @exp_ulp(%arg0: f32) -> f32 attributes {iree.codegen.math_accuracy = "ulp"} {
+        %0 = math.exp %arg0 : f32
+        return %0 : f32
+      }
+    }
+  }
+}
+// CHECK-LABEL: func.func @exp_fast
+//       CHECK:   arith.constant {{.*}}9.58274{{.*}} : f32
+// CHECK-LABEL: func.func @exp_ulp
+//   CHECK-NOT:   math.exp
+//   CHECK-NOT:   arith.constant {{.*}}9.58274{{.*}} : f32
+//       CHECK:   return
+
+// -----
+
+// The strict and fast tiers keep math ops on CUDA for the device library
+// and only expand those without a native lowering.
+
+hal.executable private @cuda_strict {
+  hal.executable.variant @cuda, target = #hal.executable.target<"cuda", "cuda-nvptx-fb", {math_accuracy = "strict"}> {
+    builtin.module {
+      func.func @exp_erf(%arg0: f32) -> f32 {
+        %0 = math.exp %arg0 : f32
+        %1 = math.erf %0 : f32
+        return %1 : f32
+      }
+    }
+  }
+}
+// CHECK-LABEL: func.func @exp_erf
+//       CHECK:   math.exp
+//   CHECK-NOT:   math.erf
+//       CHECK:   return
+
+// -----
+
+// The ulp tier expands math ops on GPUs as well.
+
+hal.executable private @cuda_ulp {
+  hal.executable.variant @cuda, target = #hal.executable.target<"cuda", "cuda-nvptx-fb", {math_accuracy = "ulp"}> {
+    builtin.module {
+      func.func @exp(%arg0: f32) -> f32 {
+        %0 = math.exp %arg0 : f32
+        return %0 : f32
+      }
+    }
+  }
+}
+// CHECK-LABEL: func.func @exp
+//   CHECK-NOT:   math.exp
+//       CHECK:   return
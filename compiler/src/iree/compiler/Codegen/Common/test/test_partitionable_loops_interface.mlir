@@ -173,3 +173,39 @@ func.func @sort_unit_dim(%arg0 : tensor<?x1xf32>) -> tensor<?x1xf32> {
 }
 // CHECK-LABEL: func.func @sort_unit_dim(
 //       CHECK:   util.unfoldable_constant dense<[0, 1]> : tensor<2xindex>
+
+// -----
+
+func.func @scatter(%original : tensor<?x?xf32>, %indices : tensor<?x1xi32>,
+    %updates : tensor<?x?xf32>) -> tensor<?x?xf32> {
+  %0 = iree_linalg_ext.scatter
+      {__test_interface__ = true}
+      unique_indices(true)
+      ins(%updates, %indices : tensor<?x?xf32>, tensor<?x1xi32>)
+      outs(%original : tensor<?x?xf32>) {
+        ^bb0(%arg1 : f32, %arg2 : f32):
+          iree_linalg_ext.yield %arg1 : f32
+      } -> tensor<?x?xf32>
+  return %0 : tensor<?x?xf32>
+}
+// CHECK-LABEL: func.func @scatter(
+//       CHECK:   util.unfoldable_constant dense<1> : tensor<2xindex>
+
+// -----
+
+func.func @scatter_repeated_indices(%original : tensor<?x?xf32>,
+    %indices : tensor<?x1xi32>, %updates : tensor<?x?xf32>)
+    -> tensor<?x?xf32> {
+  %0 = iree_linalg_ext.scatter
+      {__test_interface__ = true}
+      unique_indices(false)
+      ins(%updates, %indices : tensor<?x?xf32>, tensor<?x1xi32>)
+      outs(%original : tensor<?x?xf32>) {
+        ^bb0(%arg1 : f32, %arg2 : f32):
+          %1 = arith.addf %arg1, %arg2 : f32
+          iree_linalg_ext.yield %1 : f32
+      } -> tensor<?x?xf32>
+  return %0 : tensor<?x?xf32>
+}
+// CHECK-LABEL: func.func @scatter_repeated_indices(
+//       CHECK:   util.unfoldable_constant dense<[0, 1]> : tensor<2xindex>
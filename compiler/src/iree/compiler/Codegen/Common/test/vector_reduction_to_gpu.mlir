@@ -1,4 +1,4 @@
-// RUN: iree-opt -iree-llvmgpu-reduction-to-gpu -cse %s | FileCheck %s
+// RUN: iree-opt --iree-codegen-vector-reduction-to-gpu --cse %s | FileCheck %s
 
 func.func @simple_reduce() {
   %c0 = arith.constant 0 : index
@@ -24,6 +24,8 @@ func.func @simple_reduce() {
   return
 }
 
+// The per-lane partial sums are accumulated in the loop and only reduced
+// across the warp once after it.
 // CHECK-LABEL: func.func @simple_reduce() {
 //   CHECK-DAG:   %[[C0:.*]] = arith.constant 0 : index
 //   CHECK-DAG:   %[[C1:.*]] = arith.constant 1 : i32
@@ -39,22 +41,23 @@ func.func @simple_reduce() {
 //       CHECK:   %[[F:.*]] = scf.for %{{.*}} = %{{.*}} to %{{.*}} step %{{.*}} iter_args(%[[V0:.*]] = %[[VCST]]) -> (vector<1xf32>) {
 //       CHECK:     %[[ID:.*]] = affine.apply
 //       CHECK:     %[[V1:.*]] = vector.transfer_read %{{.*}}[%{{.*}}, %[[ID]]], %{{.*}} {in_bounds = [true]} : memref<128x384xf32>, vector<1xf32>
-//       CHECK:     %[[S:.*]] = vector.extract %[[V1]][0] : vector<1xf32>
-//       CHECK:     %[[S0:.*]], %{{.*}} = gpu.shuffle  xor %[[S]], %[[C1]], %[[C32]] : f32
-//       CHECK:     %[[S1:.*]] = arith.addf %[[S]], %[[S0]] : f32
-//       CHECK:     %[[S2:.*]], %{{.*}} = gpu.shuffle  xor %[[S1]], %[[C2]], %[[C32]] : f32
-//       CHECK:     %[[S3:.*]] = arith.addf %[[S1]], %[[S2]] : f32
-//       CHECK:     %[[S4:.*]], %{{.*}} = gpu.shuffle  xor %[[S3]], %[[C4]], %[[C32]] : f32
-//       CHECK:     %[[S5:.*]] = arith.addf %[[S3]], %[[S4]] : f32
-//       CHECK:     %[[S6:.*]], %{{.*}} = gpu.shuffle  xor %[[S5]], %[[C8]], %[[C32]] : f32
-//       CHECK:     %[[S7:.*]] = arith.addf %[[S5]], %[[S6]] : f32
-//       CHECK:     %[[S8:.*]], %{{.*}} = gpu.shuffle  xor %[[S7]], %[[C16]], %[[C32]] : f32
-//       CHECK:     %[[S9:.*]] = arith.addf %[[S7]], %[[S8]] : f32
-//       CHECK:     %[[B:.*]] = vector.broadcast %[[S9]] : f32 to vector<1xf32>
-//       CHECK:     %[[ADD:.*]] = arith.addf %[[B]], %[[V0]] : vector<1xf32>
+//       CHECK:     %[[ADD:.*]] = arith.addf %[[V1]], %[[V0]] : vector<1xf32>
 //       CHECK:     scf.yield %[[ADD]] : vector<1xf32>
 //       CHECK:   }
-//       CHECK:   %[[DIV:.*]] = arith.divf %[[F]], %{{.*}} : vector<1xf32>
+//       CHECK:   %[[S:.*]] = vector.extract %[[F]][0] : vector<1xf32>
+//       CHECK:   %[[S0:.*]], %{{.*}} = gpu.shuffle  xor %[[S]], %[[C1]], %[[C32]] : f32
+//       CHECK:   %[[S1:.*]] = arith.addf %[[S]], %[[S0]] : f32
+//       CHECK:   %[[S2:.*]], %{{.*}} = gpu.shuffle  xor %[[S1]], %[[C2]], %[[C32]] : f32
+//       CHECK:   %[[S3:.*]] = arith.addf %[[S1]], %[[S2]] : f32
+//       CHECK:   %[[S4:.*]], %{{.*}} = gpu.shuffle  xor %[[S3]], %[[C4]], %[[C32]] : f32
+//       CHECK:   %[[S5:.*]] = arith.addf %[[S3]], %[[S4]] : f32
+//       CHECK:   %[[S6:.*]], %{{.*}} = gpu.shuffle  xor %[[S5]], %[[C8]], %[[C32]] : f32
+//       CHECK:   %[[S7:.*]] = arith.addf %[[S5]], %[[S6]] : f32
+//       CHECK:   %[[S8:.*]], %{{.*}} = gpu.shuffle  xor %[[S7]], %[[C16]], %[[C32]] : f32
+//       CHECK:   %[[S9:.*]] = arith.addf %[[S7]], %[[S8]] : f32
+//       CHECK:   %[[B:.*]] = vector.broadcast %[[S9]] : f32 to vector<1xf32>
+//       CHECK:   %[[R:.*]] = arith.addf %[[B]], %[[VCST]] : vector<1xf32>
+//       CHECK:   %[[DIV:.*]] = arith.divf %[[R]], %{{.*}} : vector<1xf32>
 //       CHECK:   %[[CMP:.*]] = arith.cmpi eq, %[[LID]], %[[C0]] : index
 //       CHECK:   scf.if %[[CMP]] {
 //       CHECK:     vector.transfer_write %[[DIV]], {{.*}} : vector<1xf32>, memref<128xf32>
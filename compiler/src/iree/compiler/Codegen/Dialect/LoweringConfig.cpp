@@ -75,13 +75,14 @@ namespace Codegen {
 
 TranslationInfoAttr TranslationInfoAttr::get(
     MLIRContext *context, DispatchLoweringPassPipeline passPipeline,
-    ArrayRef<int64_t> workloadPerWorkgroup, unsigned softwarePipelineDepth) {
+    ArrayRef<int64_t> workloadPerWorkgroup, unsigned softwarePipelineDepth,
+    unsigned swizzleLogTile) {
   auto pipelineAttr =
       DispatchLoweringPassPipelineAttr::get(context, passPipeline);
   ArrayAttr workloadPerWorkgroupAttr =
       getI64IntegerArrayAttr(context, workloadPerWorkgroup);
   return get(context, pipelineAttr, workloadPerWorkgroupAttr,
-             softwarePipelineDepth);
+             softwarePipelineDepth, swizzleLogTile);
 }
 
 DispatchLoweringPassPipeline
@@ -96,7 +97,8 @@ SmallVector<int64_t> TranslationInfoAttr::getWorkloadPerWorkgroupVals() {
 LogicalResult TranslationInfoAttr::verify(
     function_ref<InFlightDiagnostic()> emitError,
     IREE::Codegen::DispatchLoweringPassPipelineAttr passPipeline,
-    ArrayAttr workloadPerWorkgroup, unsigned softwarePipelineDepth) {
+    ArrayAttr workloadPerWorkgroup, unsigned softwarePipelineDepth,
+    unsigned swizzleLogTile) {
   if (!passPipeline) {
     return emitError() << "missing pass pipeline specification";
   }
@@ -220,7 +222,8 @@ LogicalResult CompilationInfoAttr::verify(
   if (failed(TranslationInfoAttr::verify(
           emitError, translationInfo.getPassPipeline(),
           translationInfo.getWorkloadPerWorkgroup(),
-          translationInfo.getSoftwarePipelineDepth()))) {
+          translationInfo.getSoftwarePipelineDepth(),
+          translationInfo.getSwizzleLogTile()))) {
     return failure();
   }
   if (workgroupSize) {
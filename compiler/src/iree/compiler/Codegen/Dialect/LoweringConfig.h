@@ -119,12 +119,14 @@ void setLoweringConfig(Operation *op, IREE::Codegen::LoweringConfigAttr config);
 inline LogicalResult setOpConfigAndEntryPointFnTranslation(
     func::FuncOp entryPointFn, Operation *op, TileSizesListTypeRef tileSizes,
     IREE::Codegen::DispatchLoweringPassPipeline passPipeline,
-    ArrayRef<int64_t> workgroupSize = {}, unsigned softwarePipelineDepth = 0) {
+    ArrayRef<int64_t> workgroupSize = {}, unsigned softwarePipelineDepth = 0,
+    unsigned swizzleLogTile = 0) {
   MLIRContext *context = entryPointFn.getContext();
   auto config = IREE::Codegen::LoweringConfigAttr::get(context, tileSizes);
   setLoweringConfig(op, config);
   auto translationInfo = IREE::Codegen::TranslationInfoAttr::get(
-      entryPointFn->getContext(), passPipeline, {}, softwarePipelineDepth);
+      entryPointFn->getContext(), passPipeline, {}, softwarePipelineDepth,
+      swizzleLogTile);
   setTranslationInfo(entryPointFn, translationInfo, workgroupSize);
   return success();
 }
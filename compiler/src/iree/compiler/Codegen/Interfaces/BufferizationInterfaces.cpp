@@ -293,7 +293,8 @@ struct LinalgExtOpInterface
     // expect to add more LinalgExt ops.
     auto linalgExtOp = cast<IREE::LinalgExt::LinalgExtOp>(op);
     if (linalgExtOp.isInputTensor(&opOperand)) return true;
-    return !isa<IREE::LinalgExt::ScatterOp, IREE::LinalgExt::ReverseOp>(op);
+    return !isa<IREE::LinalgExt::ScatterOp, IREE::LinalgExt::ReverseOp,
+                IREE::LinalgExt::AttentionOp>(op);
   }
 
   bool bufferizesToMemoryWrite(Operation *op, OpOperand &opOperand,
@@ -415,6 +416,8 @@ void registerBufferizationInterfaces(DialectRegistry &registry) {
             LinalgExtOpInterface<IREE::LinalgExt::ScanOp>>(*ctx);
         IREE::LinalgExt::TopkOp::attachInterface<
             LinalgExtOpInterface<IREE::LinalgExt::TopkOp>>(*ctx);
+        IREE::LinalgExt::AttentionOp::attachInterface<
+            LinalgExtOpInterface<IREE::LinalgExt::AttentionOp>>(*ctx);
       });
 }
 
@@ -236,9 +236,10 @@ void registerPartitionableLoopsInterfaceModels(DialectRegistry &registry) {
   registry.addExtension(
       +[](MLIRContext *ctx, IREE::LinalgExt::IREELinalgExtDialect *dialect) {
         registerInterfaceForTiledOpInterfaceOps<
-            IREE::LinalgExt::FftOp, IREE::LinalgExt::ReverseOp,
-            IREE::LinalgExt::ScanOp, IREE::LinalgExt::ScatterOp,
-            IREE::LinalgExt::SortOp, IREE::LinalgExt::TopkOp>(ctx);
+            IREE::LinalgExt::AttentionOp, IREE::LinalgExt::FftOp,
+            IREE::LinalgExt::ReverseOp, IREE::LinalgExt::ScanOp,
+            IREE::LinalgExt::ScatterOp, IREE::LinalgExt::SortOp,
+            IREE::LinalgExt::TopkOp>(ctx);
       });
   registry.addExtension(+[](MLIRContext *ctx, tensor::TensorDialect *dialect) {
     tensor::ExtractSliceOp::attachInterface<TensorExtractOpPartitionableLoops>(
@@ -15,6 +15,7 @@
 #include "iree/compiler/Dialect/Flow/IR/FlowOps.h"
 #include "llvm/ADT/TypeSwitch.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/TargetSelect.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/Linalg/IR/Linalg.h"
@@ -69,6 +70,11 @@ static llvm::cl::opt<bool> disableMatmulPadPipeline(
     llvm::cl::desc("disable padding options in Matmul codegen"),
     llvm::cl::init(false));
 
+static llvm::cl::opt<bool> clEnableCacheAwareMatmulTiling(
+    "iree-codegen-llvm-enable-cache-aware-matmul-tiling",
+    llvm::cl::desc("size matmul tiles for the cache sizes of the target"),
+    llvm::cl::init(false));
+
 llvm::cl::opt<std::string> clCPUCodegenTransformDialectFileName(
     "iree-codegen-llvmcpu-use-transform-dialect",
     llvm::cl::desc(
@@ -94,6 +100,23 @@ static Optional<int64_t> getNativeVectorSizeInBytes(func::FuncOp entryPointFn) {
   return nativeVectorSizeVal;
 }
 
+/// Returns the size in bytes of the data cache at `level` (1, 2 or 3) from the
+/// `l<level>_cache_size` attribute in the hal.executable.variant op. Returns 0
+/// if unknown.
+static int64_t getCacheSizeInBytes(func::FuncOp entryPointFn, unsigned level) {
+  auto variantOp =
+      entryPointFn->getParentOfType<IREE::HAL::ExecutableVariantOp>();
+  if (!variantOp) return 0;
+  IREE::HAL::ExecutableTargetAttr targetAttr = variantOp.target();
+  if (!targetAttr) return 0;
+  auto config = targetAttr.getConfiguration();
+  if (!config) return 0;
+  auto cacheSizeAttr = config.getAs<IntegerAttr>(
+      llvm::formatv("l{0}_cache_size", level).str());
+  if (!cacheSizeAttr) return 0;
+  return cacheSizeAttr.getInt();
+}
+
 /// For a given `shapedType` or (`byteWidth` of element type) return the number
 /// of elements that correspond to the native vector size. Returns 1 as the
 /// fallback.
@@ -432,7 +455,7 @@ static LogicalResult setDefaultRootConfig(
 static LogicalResult setMatmulPadRootConfig(
     func::FuncOp entryPointFn, linalg::ContractionOpInterface op,
     ArrayRef<int64_t> flowTileSizes, ArrayRef<int64_t> workgroupTileSizes,
-    int vectorSize) {
+    int vectorSize, unsigned swizzleLogTile) {
   // The tiling for parallel dims and reduction dims should be separated.
   SmallVector<int64_t> parallelTileSizes(workgroupTileSizes.begin(),
                                          workgroupTileSizes.end());
@@ -453,13 +476,14 @@ static LogicalResult setMatmulPadRootConfig(
 
   return setOpConfigAndEntryPointFnTranslation(
       entryPointFn, op, tileSizes,
-      DispatchLoweringPassPipeline::CPUDoubleTilingPadExpert);
+      DispatchLoweringPassPipeline::CPUDoubleTilingPadExpert,
+      /*workgroupSize=*/{}, /*softwarePipelineDepth=*/0, swizzleLogTile);
 }
 
 static LogicalResult setMatmulNoPadRootConfig(
     func::FuncOp entryPointFn, linalg::ContractionOpInterface op,
     ArrayRef<int64_t> flowTileSizes, ArrayRef<int64_t> workgroupTileSizes,
-    int vectorSize) {
+    int vectorSize, unsigned swizzleLogTile) {
   assert(flowTileSizes.size() == workgroupTileSizes.size());
   int64_t numLoops = workgroupTileSizes.size();
   // The tiling for parallel dims and reduction dims should be separated.
@@ -488,7 +512,8 @@ static LogicalResult setMatmulNoPadRootConfig(
 
   return setOpConfigAndEntryPointFnTranslation(
       entryPointFn, op, tileSizes,
-      DispatchLoweringPassPipeline::CPUDoubleTilingExpert);
+      DispatchLoweringPassPipeline::CPUDoubleTilingExpert,
+      /*workgroupSize=*/{}, /*softwarePipelineDepth=*/0, swizzleLogTile);
 }
 
 static LogicalResult setAArch64RootConfig(func::FuncOp entryPointFn,
@@ -558,6 +583,47 @@ static SmallVector<int64_t> getMatmulWorkgroupSizes(func::FuncOp entryPointFn,
   return tileSizes;
 }
 
+/// Sizes the matmul tiles such that the operands stay resident in the caches
+/// of the target, similar to the blocking of BLIS-like GEMM implementations:
+/// - the reduction tile `kc` is picked such that the `mr x kc` LHS and
+///   `kc x nr` RHS slivers used by one vector tile fill half of L1,
+/// - the M workgroup tile `mc` is capped such that the packed `mc x kc` LHS
+///   panel fills half of L2,
+/// - the N workgroup tile `nc` is capped such that the packed `kc x nc` RHS
+///   panel fills half of the share of L3 of a thread (or half of L2 if L3 is
+///   unknown).
+/// `workgroupTileSizes` holds the [..., mr, nr, kc] vector level tile sizes and
+/// `maxTileSizes` the caps of the distributed tile sizes. Leaves them
+/// unchanged if the L1 or L2 size of the target is unknown.
+static void setCacheAwareMatmulTileSizes(
+    func::FuncOp entryPointFn, ShapedType lhsShapedType, int64_t vectorSize,
+    SmallVectorImpl<int64_t> &workgroupTileSizes,
+    SmallVectorImpl<int64_t> &maxTileSizes) {
+  int64_t l1CacheSize = getCacheSizeInBytes(entryPointFn, 1);
+  int64_t l2CacheSize = getCacheSizeInBytes(entryPointFn, 2);
+  int64_t l3CacheSize = getCacheSizeInBytes(entryPointFn, 3);
+  Type elementType = lhsShapedType.getElementType();
+  if (!l1CacheSize || !l2CacheSize || !elementType.isIntOrFloat()) return;
+  int64_t byteWidth = IREE::Util::getRoundedElementByteWidth(elementType);
+
+  auto roundDownToMultiple = [](int64_t value, int64_t multiple) {
+    return std::max(value / multiple * multiple, multiple);
+  };
+  unsigned numLoops = workgroupTileSizes.size();
+  int64_t mr = workgroupTileSizes[numLoops - 3];
+  int64_t nr = workgroupTileSizes[numLoops - 2];
+  int64_t kc = roundDownToMultiple(l1CacheSize / 2 / ((mr + nr) * byteWidth),
+                                   vectorSize);
+  int64_t mc = roundDownToMultiple(l2CacheSize / 2 / (kc * byteWidth), mr);
+  int64_t rhsPanelSize =
+      l3CacheSize ? l3CacheSize / clNumberOfRuntimeThreads : l2CacheSize;
+  int64_t nc = roundDownToMultiple(rhsPanelSize / 2 / (kc * byteWidth), nr);
+
+  workgroupTileSizes[numLoops - 1] = kc;
+  maxTileSizes[numLoops - 3] = std::min(maxTileSizes[numLoops - 3], mc);
+  maxTileSizes[numLoops - 2] = std::min(maxTileSizes[numLoops - 2], nc);
+}
+
 /// Sets the lowering configuration for dispatch region with root op that
 /// implements the contraction operation interface.
 static LogicalResult setRootConfig(
@@ -608,21 +674,40 @@ static LogicalResult setRootConfig(
   // There are hard-coded configurations in DoubleTilingPadExpert, so it only
   // works for linalg.matmul cases. We can relax it once we have better
   // scheduling, e.g., transform dialect.
-  SmallVector<int64_t> flowTileSizes;
-  if (!disableMatmulPadPipeline && (isX86(*variantOp) || isRISCV(*variantOp))) {
+  bool usePadPipeline =
+      !disableMatmulPadPipeline && (isX86(*variantOp) || isRISCV(*variantOp));
+  if (usePadPipeline && numLoops == 3) {
     // It's inspired from Sandbox configuration. Sandbox has
     // [[288, 128, 512], [12, 32, 1]] setup. We scale 288 to 192 because
     // 288/12*8=192
-    if (numLoops == 3) {
-      maxTileSizes[0] = 192;
-      maxTileSizes[1] = 128;
-    }
-    flowTileSizes = getDefaultDistributedLevelTileSizes(
-        linalgOp, workgroupTileSizes, maxTileSizes,
-        /*allowIncompleteTile=*/true);
-  } else {
-    flowTileSizes = getDefaultDistributedLevelTileSizes(
-        linalgOp, workgroupTileSizes, maxTileSizes);
+    maxTileSizes[0] = 192;
+    maxTileSizes[1] = 128;
+  }
+  if (clEnableCacheAwareMatmulTiling &&
+      (isX86(*variantOp) || isRISCV(*variantOp))) {
+    setCacheAwareMatmulTileSizes(entryPointFn, lhsShapedType, vectorSize,
+                                 workgroupTileSizes, maxTileSizes);
+  }
+  SmallVector<int64_t> flowTileSizes = getDefaultDistributedLevelTileSizes(
+      linalgOp, workgroupTileSizes, maxTileSizes,
+      /*allowIncompleteTile=*/usePadPipeline);
+
+  // Swizzle the workgroups if the RHS read by each row of workgroups doesn't
+  // fit in the L3 cache shared by the threads running them.
+  unsigned swizzleLogTile = 0;
+  if (numLoops >= 3 && !linalgOp.hasDynamicShape() &&
+      flowTileSizes[numLoops - 3] != 0 &&
+      rhsShapedType.getElementType().isIntOrFloat()) {
+    SmallVector<int64_t, 4> loopRanges = linalgOp.getStaticLoopRanges();
+    int64_t sizeM = loopRanges[numLoops - 3];
+    int64_t sizeN = loopRanges[numLoops - 2];
+    int64_t sizeK = loopRanges[numLoops - 1];
+    int64_t rhsSizeInBytes =
+        sizeK * sizeN *
+        IREE::Util::getRoundedElementByteWidth(rhsShapedType.getElementType());
+    swizzleLogTile = getWorkgroupSwizzleLogTile(
+        llvm::divideCeil(sizeM, flowTileSizes[numLoops - 3]), rhsSizeInBytes,
+        getCacheSizeInBytes(entryPointFn, 3));
   }
 
   // ARM codgen does not switch to use codegen driver based approach, so we have
@@ -631,13 +716,14 @@ static LogicalResult setRootConfig(
   if (isAArch64(*variantOp) && !isQuantized) {
     return setAArch64RootConfig(entryPointFn, contractionOp, flowTileSizes,
                                 workgroupTileSizes, vectorSize);
-  } else if (!disableMatmulPadPipeline &&
-             (isX86(*variantOp) || isRISCV(*variantOp))) {
+  } else if (usePadPipeline) {
     return setMatmulPadRootConfig(entryPointFn, contractionOp, flowTileSizes,
-                                  workgroupTileSizes, vectorSize);
+                                  workgroupTileSizes, vectorSize,
+                                  swizzleLogTile);
   }
   return setMatmulNoPadRootConfig(entryPointFn, contractionOp, flowTileSizes,
-                                  workgroupTileSizes, vectorSize);
+                                  workgroupTileSizes, vectorSize,
+                                  swizzleLogTile);
 }
 
 /// Sets the lowering configuration for dispatch region for linalg.mmt4d root
@@ -0,0 +1,219 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//===- LLVMCPUEmitLintReport.cpp ------------------------------------------===//
+//
+// Writes a JSON report listing the dispatches of an executable that are
+// likely to run well below the peak of the target, so that performance
+// cliffs caused by model or compiler changes can be caught in CI. A dispatch
+// is reported when
+//   - some of its linalg ops were not vectorized and fall back to scalar
+//     loops,
+//   - it is not tiled and distributed across workgroups,
+//   - it has loops with dynamic trip counts within a workgroup,
+//   - the estimated vector utilization of its arithmetic is low.
+//
+//===----------------------------------------------------------------------===//
+
+#include "iree/compiler/Codegen/PassDetail.h"
+#include "iree/compiler/Codegen/Passes.h"
+#include "iree/compiler/Dialect/HAL/IR/HALOps.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/ToolOutputFile.h"
+#include "mlir/Analysis/SliceAnalysis.h"
+#include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Dialect/Math/IR/Math.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Support/FileUtilities.h"
+
+namespace mlir {
+namespace iree_compiler {
+
+namespace {
+
+static std::string getLocationString(Location loc) {
+  std::string str;
+  llvm::raw_string_ostream os(str);
+  os << loc;
+  return os.str();
+}
+
+static llvm::json::Object getIssue(StringRef kind, Operation *op) {
+  return llvm::json::Object{
+      {"kind", kind},
+      {"op", op->getName().getStringRef()},
+      {"location", getLocationString(op->getLoc())},
+  };
+}
+
+/// Returns true if `value` is computed from the workgroup ID or count, i.e.
+/// it is a bound of a loop distributing work across workgroups.
+static bool isWorkgroupDependent(Value value) {
+  Operation *defOp = value.getDefiningOp();
+  if (!defOp) return false;
+  SetVector<Operation *> slice;
+  getBackwardSlice(defOp, &slice);
+  slice.insert(defOp);
+  return llvm::any_of(slice, [](Operation *op) {
+    return isa<IREE::HAL::InterfaceWorkgroupIDOp,
+               IREE::HAL::InterfaceWorkgroupCountOp>(op);
+  });
+}
+
+/// Returns the fraction of the native vector width used by an arithmetic op
+/// on `type`, or None if the op isn't counted (index computations).
+static Optional<double> getVectorUtilization(Type type,
+                                             int64_t nativeVectorSizeInBits) {
+  Type elementType = getElementTypeOrSelf(type);
+  if (!elementType.isIntOrFloat()) return llvm::None;
+  int64_t numBits = elementType.getIntOrFloatBitWidth();
+  if (auto vectorType = type.dyn_cast<VectorType>()) {
+    numBits *= vectorType.getNumElements();
+  }
+  return std::min(1.0, static_cast<double>(numBits) / nativeVectorSizeInBits);
+}
+
+class LLVMCPUEmitLintReportPass
+    : public LLVMCPUEmitLintReportBase<LLVMCPUEmitLintReportPass> {
+ public:
+  LLVMCPUEmitLintReportPass() = default;
+  LLVMCPUEmitLintReportPass(StringRef path, double minVectorUtilization) {
+    this->path = path.str();
+    this->minVectorUtilization = minVectorUtilization;
+  }
+
+  void runOnOperation() override;
+
+ private:
+  /// Returns the report entry of `funcOp`, or None if nothing was found.
+  Optional<llvm::json::Object> lintDispatch(func::FuncOp funcOp,
+                                            int64_t nativeVectorSizeInBits);
+};
+
+}  // namespace
+
+Optional<llvm::json::Object> LLVMCPUEmitLintReportPass::lintDispatch(
+    func::FuncOp funcOp, int64_t nativeVectorSizeInBits) {
+  llvm::json::Array issues;
+  bool isDistributed = false;
+  bool hasWork = false;
+  double totalUtilization = 0.0;
+  int64_t numArithOps = 0;
+  funcOp.walk([&](Operation *op) {
+    if (isa<IREE::HAL::InterfaceWorkgroupIDOp>(op)) {
+      isDistributed = true;
+      return;
+    }
+    if (isa<linalg::LinalgOp>(op)) {
+      hasWork = true;
+      issues.push_back(getIssue("not_vectorized", op));
+      return;
+    }
+    if (auto forOp = dyn_cast<scf::ForOp>(op)) {
+      hasWork = true;
+      bool isStatic = getConstantIntValue(forOp.getLowerBound()) &&
+                      getConstantIntValue(forOp.getUpperBound()) &&
+                      getConstantIntValue(forOp.getStep());
+      if (!isStatic && !isWorkgroupDependent(forOp.getLowerBound())) {
+        issues.push_back(getIssue("dynamic_loop", op));
+      }
+      return;
+    }
+    if (nativeVectorSizeInBits == 0 || op->getNumOperands() == 0 ||
+        !isa<arith::ArithmeticDialect, math::MathDialect>(op->getDialect())) {
+      return;
+    }
+    Optional<double> utilization = getVectorUtilization(
+        op->getOperand(0).getType(), nativeVectorSizeInBits);
+    if (!utilization) return;
+    totalUtilization += *utilization;
+    ++numArithOps;
+  });
+  if (!isDistributed && hasWork) {
+    issues.push_back(getIssue("not_tiled", funcOp));
+  }
+
+  llvm::json::Object entry{
+      {"name", funcOp.getName()},
+      {"location", getLocationString(funcOp.getLoc())},
+  };
+  if (numArithOps != 0) {
+    double utilization = totalUtilization / numArithOps;
+    entry["vector_utilization"] = utilization;
+    if (utilization < minVectorUtilization) {
+      issues.push_back(getIssue("low_vector_utilization", funcOp));
+    }
+  }
+  if (issues.empty()) return llvm::None;
+  entry["issues"] = std::move(issues);
+  return entry;
+}
+
+void LLVMCPUEmitLintReportPass::runOnOperation() {
+  ModuleOp moduleOp = getOperation();
+  StringRef executableName = "executable";
+  StringRef variantName = "variant";
+  int64_t nativeVectorSizeInBits = 0;
+  if (auto executableOp =
+          moduleOp->getParentOfType<IREE::HAL::ExecutableOp>()) {
+    executableName = executableOp.getName();
+  }
+  if (auto variantOp =
+          moduleOp->getParentOfType<IREE::HAL::ExecutableVariantOp>()) {
+    variantName = variantOp.getName();
+    if (auto config = variantOp.target().getConfiguration()) {
+      if (auto nativeVectorSize =
+              config.getAs<IntegerAttr>("native_vector_size")) {
+        nativeVectorSizeInBits = nativeVectorSize.getInt() * 8;
+      }
+    }
+  }
+
+  llvm::json::Array dispatches;
+  for (auto funcOp : moduleOp.getOps<func::FuncOp>()) {
+    if (funcOp.isDeclaration()) continue;
+    if (auto entry = lintDispatch(funcOp, nativeVectorSizeInBits)) {
+      dispatches.push_back(std::move(*entry));
+    }
+  }
+  llvm::json::Value report = llvm::json::Object{
+      {"executable", executableName},
+      {"variant", variantName},
+      {"dispatches", std::move(dispatches)},
+  };
+
+  if (path.empty() || path == "-") {
+    llvm::outs() << llvm::formatv("{0:2}", report) << "\n";
+    return;
+  }
+  // Help people out and mkdir if needed.
+  llvm::sys::fs::create_directories(path);
+  auto fileName = (executableName + "_" + variantName + "_lint.json").str();
+  auto filePath = (path + llvm::sys::path::get_separator() + fileName).str();
+  std::string error;
+  auto file = mlir::openOutputFile(filePath, &error);
+  if (!file) {
+    moduleOp.emitError() << "while writing the lint report to " << path
+                         << ": " << error;
+    return signalPassFailure();
+  }
+  file->os() << llvm::formatv("{0:2}", report) << "\n";
+  file->keep();
+}
+
+std::unique_ptr<OperationPass<ModuleOp>> createLLVMCPUEmitLintReportPass(
+    StringRef path, double minVectorUtilization) {
+  return std::make_unique<LLVMCPUEmitLintReportPass>(path,
+                                                     minVectorUtilization);
+}
+
+}  // namespace iree_compiler
+}  // namespace mlir
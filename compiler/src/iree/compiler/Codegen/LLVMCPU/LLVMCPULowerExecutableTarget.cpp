@@ -191,19 +191,23 @@ void LLVMCPULowerExecutableTargetPass::runOnOperation() {
             break;
           case IREE::Codegen::DispatchLoweringPassPipeline::
               CPUDoubleTilingExpert:
-            addDoubleTilingExpertPassPipeline(executableLoweringPipeline,
-                                              /*enablePeeling=*/false,
-                                              lowerToAVX2);
+            addDoubleTilingExpertPassPipeline(
+                executableLoweringPipeline,
+                /*enablePeeling=*/false, lowerToAVX2,
+                translationInfo.getValue().getSwizzleLogTile());
             break;
           case IREE::Codegen::DispatchLoweringPassPipeline::
               CPUDoubleTilingPadExpert:
-            addDoubleTilingPadExpertPassPipeline(executableLoweringPipeline);
+            addDoubleTilingPadExpertPassPipeline(
+                executableLoweringPipeline,
+                translationInfo.getValue().getSwizzleLogTile());
             break;
           case IREE::Codegen::DispatchLoweringPassPipeline::
               CPUDoubleTilingPeelingExpert:
-            addDoubleTilingExpertPassPipeline(executableLoweringPipeline,
-                                              /*enablePeeling=*/true,
-                                              lowerToAVX2);
+            addDoubleTilingExpertPassPipeline(
+                executableLoweringPipeline,
+                /*enablePeeling=*/true, lowerToAVX2,
+                translationInfo.getValue().getSwizzleLogTile());
             break;
           case IREE::Codegen::DispatchLoweringPassPipeline::
               CPUConvTileAndDecomposeExpert:
@@ -41,10 +41,23 @@ static llvm::cl::opt<bool> clCheckLinalgVectorization(
         "Runs the pass to check if all the Linalg ops are vectorized"),
     llvm::cl::init(false));
 
+static llvm::cl::opt<std::string> clLintReportPath(
+    "iree-llvmcpu-lint-report-path",
+    llvm::cl::desc("Directory to write a JSON report of the dispatches that "
+                   "are likely to perform poorly (not vectorized, not tiled, "
+                   "dynamic loops, low vector utilization) into"),
+    llvm::cl::init(""));
+
 static llvm::cl::opt<bool> clEnableHoistPadding(
     "iree-llvmcpu-enable-hoist-padding",
     llvm::cl::desc("Flag to enable hoist padding"), llvm::cl::init(false));
 
+static llvm::cl::opt<bool> clEnableConvPacking(
+    "iree-llvmcpu-enable-conv-packing",
+    llvm::cl::desc("Flag to enable packing the input patches and filters of "
+                   "each convolution tile into contiguous local buffers"),
+    llvm::cl::init(false));
+
 // MLIR file containing a top-level module that specifies the transformations to
 // apply to form dispatch regions.
 // Defined externally in KernelDispatch.cpp to control the codegen pass
@@ -85,7 +98,8 @@ static void addBufferizePasses(OpPassManager &passManager) {
                                       memcpyFn);
 }
 
-static void addTileAndDistributePasses(OpPassManager &pm) {
+static void addTileAndDistributePasses(OpPassManager &pm,
+                                       unsigned swizzleLogTile = 0) {
   pm.addPass(createTileAndDistributeToWorkgroupsPass());
   auto &nestedModulePM = pm.nest<ModuleOp>();
   nestedModulePM.addNestedPass<func::FuncOp>(
@@ -94,6 +108,8 @@ static void addTileAndDistributePasses(OpPassManager &pm) {
       createFoldAffineMinInDistributedLoopsPass());
   nestedModulePM.addPass(createCanonicalizerPass());
   nestedModulePM.addPass(createCSEPass());
+  nestedModulePM.addNestedPass<func::FuncOp>(
+      createWorkGroupSwizzle(swizzleLogTile));
 }
 
 //===---------------------------------------------------------------------===//
@@ -240,8 +256,9 @@ void addCPUBufferOpsTileAndVectorizePipeline(OpPassManager &passManager) {
   }
 }
 
-void addDoubleTilingPadExpertPassPipeline(OpPassManager &passManager) {
-  addTileAndDistributePasses(passManager);
+void addDoubleTilingPadExpertPassPipeline(OpPassManager &passManager,
+                                          unsigned swizzleLogTile) {
+  addTileAndDistributePasses(passManager, swizzleLogTile);
 
   OpPassManager &nestedModulePM = passManager.nest<ModuleOp>();
   {
@@ -333,8 +350,9 @@ void addDoubleTilingPadExpertPassPipeline(OpPassManager &passManager) {
 }
 
 void addDoubleTilingExpertPassPipeline(OpPassManager &passManager,
-                                       bool enablePeeling, bool lowerToAVX2) {
-  addTileAndDistributePasses(passManager);
+                                       bool enablePeeling, bool lowerToAVX2,
+                                       unsigned swizzleLogTile) {
+  addTileAndDistributePasses(passManager, swizzleLogTile);
 
   OpPassManager &nestedModulePM = passManager.nest<ModuleOp>();
   // Run LinalgFusePass firstly in case that we have fill + matmul + generic
@@ -397,7 +415,7 @@ void addConvTileAndDecomposeExpertPassPipeline(OpPassManager &passManager) {
   }
 
   // Add the sandbox single tiling expert to tile.
-  {
+  if (!clEnableConvPacking) {
     LinalgSingleTilingExpertPassOptions options;
     options.decomposeToLowerDimOp = true;
     options.tilingLevel =
@@ -406,6 +424,47 @@ void addConvTileAndDecomposeExpertPassPipeline(OpPassManager &passManager) {
         createLinalgSingleTilingExpertPass(options));
     nestedModulePM.addNestedPass<func::FuncOp>(createCanonicalizerPass());
     nestedModulePM.addNestedPass<func::FuncOp>(createCSEPass());
+  } else {
+    {
+      LinalgSingleTilingExpertPassOptions options;
+      options.tilingLevel =
+          static_cast<int64_t>(StrategyTilingLevel::ReductionTiles);
+      nestedModulePM.addNestedPass<func::FuncOp>(
+          createLinalgSingleTilingExpertPass(options));
+      nestedModulePM.addNestedPass<func::FuncOp>(createCanonicalizerPass());
+      nestedModulePM.addNestedPass<func::FuncOp>(createCSEPass());
+    }
+
+    // Pack the input and filter slices read by the conv and hoist the packing
+    // out of the (KH, KW, IC) reduction loops. Each parallel tile then copies
+    // its input patch once into a buffer bounded by the tile sizes instead of
+    // striding through the full input in the innermost loops.
+    {
+      LinalgFusePassOptions options;
+      options.padReductionDims = true;
+      options.setAnchorOpToRootOp = true;
+      options.packPaddings = {1, 1, 0};
+      nestedModulePM.addNestedPass<func::FuncOp>(createLinalgFusePass(options));
+    }
+    {
+      LinalgFusePassOptions options;
+      options.pad = true;
+      options.setAnchorOpToRootOp = true;
+      options.hoistPaddings = SmallVector<int64_t>{3, 3, 0};
+      nestedModulePM.addNestedPass<func::FuncOp>(createLinalgFusePass(options));
+      nestedModulePM.addNestedPass<func::FuncOp>(createCanonicalizerPass());
+      nestedModulePM.addNestedPass<func::FuncOp>(createCSEPass());
+    }
+
+    // Decompose the packed conv tiles into 1-D convs for vectorization.
+    {
+      LinalgSingleTilingExpertPassOptions options;
+      options.decomposeToLowerDimOp = true;
+      nestedModulePM.addNestedPass<func::FuncOp>(
+          createLinalgSingleTilingExpertPass(options));
+      nestedModulePM.addNestedPass<func::FuncOp>(createCanonicalizerPass());
+      nestedModulePM.addNestedPass<func::FuncOp>(createCSEPass());
+    }
   }
 
   // Add the sandbox single tiling expert to vectorize.
@@ -509,6 +568,9 @@ static void addLowerToLLVMPasses(OpPassManager &passManager) {
     passManager.addNestedPass<func::FuncOp>(
         createLLVMCPUEmitVectorizationRemarksPass());
   }
+  if (!clLintReportPath.empty()) {
+    passManager.addPass(createLLVMCPUEmitLintReportPass(clLintReportPath));
+  }
   passManager.addNestedPass<func::FuncOp>(createConvertLinalgToLoopsPass());
   passManager.addNestedPass<func::FuncOp>(createCanonicalizerPass());
   passManager.addNestedPass<func::FuncOp>(createCSEPass());
@@ -521,9 +583,10 @@ static void addLowerToLLVMPasses(OpPassManager &passManager) {
   passManager.addNestedPass<func::FuncOp>(createPolynomialApproximationPass());
 
   // Checking stack allocation before converting to CF dialect is easier.
-  // Do not check allocation if hoist-padding is enabled. It intends to allocate
-  // big stack buffers for better accessing.
-  if (clCheckIRBeforeLLVMConversion && !clEnableHoistPadding) {
+  // Do not check allocation if hoist-padding or conv packing is enabled. They
+  // intend to allocate big stack buffers for better accessing.
+  if (clCheckIRBeforeLLVMConversion && !clEnableHoistPadding &&
+      !clEnableConvPacking) {
     passManager.addPass(createLLVMCPUCheckIRBeforeLLVMConversionPass());
   }
 
@@ -548,6 +611,7 @@ static void addLowerToLLVMPasses(OpPassManager &passManager) {
 }
 
 void buildLLVMCPUCodegenPassPipeline(OpPassManager &passManager) {
+  passManager.addPass(createApplyTuningDatabasePass());
   passManager.addNestedPass<ModuleOp>(
       createVerifyLinalgTransformLegalityPass());
   passManager.nest<ModuleOp>().addNestedPass<func::FuncOp>(
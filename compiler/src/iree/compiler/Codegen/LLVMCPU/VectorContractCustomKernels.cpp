@@ -683,6 +683,66 @@ MMTKernel MMTKernel_8x1x1_f32f32f32_Aarch64_Baseline_InlineAsm() {
   return kernel;
 }
 
+// i8*i8->i32 kernel for x86_64 AVX-512 +avx512vnni
+//
+// The VNNI vpdpbusd instruction multiplies unsigned by signed int8 values, so
+// it can't be used for general signed*signed int8 matmuls without correcting
+// the result for the bias. Instead this kernel sign-extends the inputs to int16
+// and uses vpdpwssd, which multiplies adjacent pairs of int16 values and
+// accumulates both products into int32 lanes. That is why k0 is 2 here: each
+// int32 lane of the accumulators receives the sum of 2 products.
+//
+// This kernel is needed because: at the moment, codegen doesn't know how to
+// make use of VNNI instructions and emulates them with vpmovsxbd/vpmulld/
+// vpaddd sequences operating on int32 values.
+MMTKernel MMTKernel_8x2x16_i8i8i32_X86_64Avx512Vnni_InlineAsm() {
+  MMTKernel kernel;
+  kernel.arch = CustomKernelTargetArch::X86_64;
+  kernel.lhsType = MMTKernel::ScalarType::I8;
+  kernel.rhsType = MMTKernel::ScalarType::I8;
+  kernel.accType = MMTKernel::ScalarType::I32;
+  kernel.m0 = 8;  // shape: 8x2x16. Each accumulator row is one zmm register.
+  kernel.k0 = 2;
+  kernel.n0 = 16;
+  kernel.lhsRegSize = 16;  // LHS register type: int8x16 (xmm)
+  kernel.rhsRegSize = 32;  // RHS register type: int8x32 (ymm)
+  kernel.accRegSize = 16;  // Accum register type: int32x16 (zmm)
+  kernel.lhsRegs = 1;
+  kernel.rhsRegs = 1;
+  kernel.accRegs = 8;  // = 8x16/16 for 8x16 Accum elems, 16 per register
+  kernel.asmImpl = R"ASM(
+      // Sign-extend the RHS to int16. Each int32 lane of zmm31 now holds the
+      // 2 int16 values of one RHS row.
+      vpmovsxbw $(rhs:0), %zmm31
+      // Sign-extend the LHS to int16. Each int32 lane of ymm30 now holds the
+      // 2 int16 values of one LHS row.
+      vpmovsxbw $(lhs:0), %ymm30
+      // LHS rows 0--3: broadcast the low 128 bits to all lanes, then each
+      // row's int32 lane to the whole register.
+      vshufi32x4 $$0x00, %zmm30, %zmm30, %zmm29
+      vpshufd $$0x00, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:0)
+      vpshufd $$0x55, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:1)
+      vpshufd $$0xaa, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:2)
+      vpshufd $$0xff, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:3)
+      // LHS rows 4--7, same with the next 128 bits.
+      vshufi32x4 $$0x55, %zmm30, %zmm30, %zmm29
+      vpshufd $$0x00, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:4)
+      vpshufd $$0x55, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:5)
+      vpshufd $$0xaa, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:6)
+      vpshufd $$0xff, %zmm29, %zmm28
+      vpdpwssd %zmm31, %zmm28, $(acc:7)
+    )ASM";
+  kernel.asmClobbers = "zmm28,zmm29,zmm30,zmm31";
+  return kernel;
+}
+
 // Constructs the mlir::Type corresponding to a scalar type.
 Type mlirType(MLIRContext *context, MMTKernel::ScalarType t) {
   switch (t) {
@@ -766,6 +826,9 @@ class MMTKernelGenerator {
     switch (kernel.arch) {
       case CustomKernelTargetArch::Aarch64:
         return "w";
+      case CustomKernelTargetArch::X86_64:
+        // Any SSE/AVX register, including xmm16--xmm31 with AVX-512.
+        return "v";
       case CustomKernelTargetArch::None:
         break;
     }
@@ -1194,6 +1257,12 @@ void populateVectorContractCustomKernelsPatterns(
           context, MMTKernel_8x8x8_i8i8i32_Aarch64I8mm_InlineAsm());
     }
   }
+  if (targetInfo.is(CustomKernelTargetArch::X86_64)) {
+    if (targetInfo.has(CustomKernelTargetFeature::X86_64Avx512Vnni)) {
+      patterns.add<MMTCustomKernelPattern>(
+          context, MMTKernel_8x2x16_i8i8i32_X86_64Avx512Vnni_InlineAsm());
+    }
+  }
 }
 
 std::unique_ptr<OperationPass<func::FuncOp>>
@@ -0,0 +1,81 @@
+// RUN: iree-opt --pass-pipeline='hal.executable(hal.executable.variant(builtin.module(iree-llvmcpu-emit-lint-report)))' %s | FileCheck %s
+
+#map = affine_map<(d0) -> (d0)>
+#map1 = affine_map<()[s0] -> (s0 * 64)>
+hal.executable private @lint {
+  hal.executable.variant public @embedded_elf_x86_64, target = <"llvm", "embedded-elf-x86_64", {
+    native_vector_size = 16 : index,
+    target_triple = "x86_64-unknown-unknown-eabi-elf"
+  }> {
+    builtin.module {
+      func.func @vectorized_add(%arg0: memref<1024xf32>, %arg1: memref<1024xf32>) {
+        %c0 = arith.constant 0 : index
+        %c4 = arith.constant 4 : index
+        %c64 = arith.constant 64 : index
+        %cst = arith.constant 0.000000e+00 : f32
+        %id = hal.interface.workgroup.id[0] : index
+        %offset = affine.apply #map1()[%id]
+        scf.for %iv = %c0 to %c64 step %c4 {
+          %i = arith.addi %offset, %iv : index
+          %0 = vector.transfer_read %arg0[%i], %cst {in_bounds = [true]} : memref<1024xf32>, vector<4xf32>
+          %1 = arith.addf %0, %0 : vector<4xf32>
+          vector.transfer_write %1, %arg1[%i] {in_bounds = [true]} : vector<4xf32>, memref<1024xf32>
+        }
+        return
+      }
+      func.func @scalar_abs(%arg0: memref<?xf32>, %arg1: memref<?xf32>) {
+        %c0 = arith.constant 0 : index
+        %c1 = arith.constant 1 : index
+        %dim = memref.dim %arg0, %c0 : memref<?xf32>
+        scf.for %iv = %c0 to %dim step %c1 {
+          %0 = memref.load %arg0[%iv] : memref<?xf32>
+          %1 = arith.addf %0, %0 : f32
+          memref.store %1, %arg1[%iv] : memref<?xf32>
+        }
+        linalg.generic {indexing_maps = [#map, #map], iterator_types = ["parallel"]}
+            ins(%arg0 : memref<?xf32>) outs(%arg1 : memref<?xf32>) {
+        ^bb0(%in: f32, %out: f32):
+          %2 = math.abs %in : f32
+          linalg.yield %2 : f32
+        }
+        return
+      }
+    }
+  }
+}
+
+// Keys are printed in sorted order. @vectorized_add is distributed across
+// workgroups and fully uses the 128-bit vectors so it isn't reported.
+//       CHECK: {
+//  CHECK-NEXT:   "dispatches": [
+//  CHECK-NEXT:     {
+//  CHECK-NEXT:       "issues": [
+//  CHECK-NEXT:         {
+//  CHECK-NEXT:           "kind": "dynamic_loop",
+//  CHECK-NEXT:           "location": "loc(
+//  CHECK-NEXT:           "op": "scf.for"
+//  CHECK-NEXT:         },
+//  CHECK-NEXT:         {
+//  CHECK-NEXT:           "kind": "not_vectorized",
+//  CHECK-NEXT:           "location": "loc(
+//  CHECK-NEXT:           "op": "linalg.generic"
+//  CHECK-NEXT:         },
+//  CHECK-NEXT:         {
+//  CHECK-NEXT:           "kind": "not_tiled",
+//  CHECK-NEXT:           "location": "loc(
+//  CHECK-NEXT:           "op": "func.func"
+//  CHECK-NEXT:         },
+//  CHECK-NEXT:         {
+//  CHECK-NEXT:           "kind": "low_vector_utilization",
+//  CHECK-NEXT:           "location": "loc(
+//  CHECK-NEXT:           "op": "func.func"
+//  CHECK-NEXT:         }
+//  CHECK-NEXT:       ],
+//  CHECK-NEXT:       "location": "loc(
+//  CHECK-NEXT:       "name": "scalar_abs",
+//  CHECK-NEXT:       "vector_utilization": 0.25
+//  CHECK-NEXT:     }
+//  CHECK-NEXT:   ],
+//  CHECK-NEXT:   "executable": "lint",
+//  CHECK-NEXT:   "variant": "embedded_elf_x86_64"
+//  CHECK-NEXT: }
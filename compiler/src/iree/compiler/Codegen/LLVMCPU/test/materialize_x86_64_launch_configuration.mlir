@@ -794,6 +794,53 @@ hal.executable private @matmul_static  {
 
 // -----
 
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>,
+    #hal.descriptor_set.binding<2, storage_buffer>
+  ]>
+]>
+hal.executable private @matmul_static_swizzled  {
+  hal.executable.variant public @embedded_elf_x86_64, target = #hal.executable.target<
+    "llvm",
+    "embedded-elf-x86_64", {
+      data_layout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128",
+      l3_cache_size = 4194304 : index,
+      native_vector_size = 16 : index,
+      target_triple = "x86_64-unknown-unknown-eabi-elf"
+    }> {
+    hal.executable.export public @matmul_static_swizzled layout(#executable_layout)
+    builtin.module {
+      func.func @matmul_static_swizzled() {
+        %cst = arith.constant 0.0 : f32
+        %lhs_binding = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer) : !flow.dispatch.tensor<readonly:2048x2048xf32>
+        %rhs_binding = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer) : !flow.dispatch.tensor<readonly:2048x2048xf32>
+        %result_binding = hal.interface.binding.subspan set(0) binding(2) type(storage_buffer) : !flow.dispatch.tensor<writeonly:2048x2048xf32>
+        %lhs = flow.dispatch.tensor.load %lhs_binding, offsets = [0, 0], sizes = [2048, 2048], strides = [1, 1]
+            : !flow.dispatch.tensor<readonly:2048x2048xf32> -> tensor<2048x2048xf32>
+        %rhs = flow.dispatch.tensor.load %rhs_binding, offsets = [0, 0], sizes = [2048, 2048], strides = [1, 1]
+            : !flow.dispatch.tensor<readonly:2048x2048xf32> -> tensor<2048x2048xf32>
+        %init = linalg.init_tensor [2048, 2048] : tensor<2048x2048xf32>
+        %fill = linalg.fill ins(%cst : f32) outs(%init : tensor<2048x2048xf32>) -> tensor<2048x2048xf32>
+        %gemm = linalg.matmul ins(%lhs, %rhs : tensor<2048x2048xf32>, tensor<2048x2048xf32>)
+            outs(%fill : tensor<2048x2048xf32>) -> tensor<2048x2048xf32>
+        flow.dispatch.tensor.store %gemm, %result_binding, offsets = [0, 0], sizes = [2048, 2048], strides = [1, 1]
+            : tensor<2048x2048xf32> -> !flow.dispatch.tensor<writeonly:2048x2048xf32>
+        return
+      }
+    }
+  }
+}
+
+// The 16MB RHS does not fit in the 4MB L3, so workgroups are swizzled in
+// tiles of 4 rows.
+//  CHECK-DAG: #[[TRANSLATION:.+]] = #iree_codegen.translation_info<CPUDoubleTilingPadExpert swizzle_log_tile = 2>
+//      CHECK: hal.executable.export public @matmul_static_swizzled
+// CHECK-SAME:     translation_info = #[[TRANSLATION]]
+
+// -----
+
 #executable_layout = #hal.executable.layout<push_constants = 4, sets = [
   #hal.descriptor_set.layout<0, bindings = [
     #hal.descriptor_set.binding<0, storage_buffer>,
@@ -1,5 +1,6 @@
 // RUN: iree-opt --pass-pipeline='hal.executable(hal.executable.variant(iree-llvmcpu-lower-executable-target))' --split-input-file %s | FileCheck %s
 // RUN: iree-opt --pass-pipeline='hal.executable(hal.executable.variant(iree-llvmcpu-lower-executable-target))' --iree-llvmcpu-enable-hoist-padding --split-input-file %s | FileCheck %s --check-prefix=HOIST-PAD
+// RUN: iree-opt --pass-pipeline='hal.executable(hal.executable.variant(iree-llvmcpu-lower-executable-target))' --iree-llvmcpu-enable-conv-packing --split-input-file %s | FileCheck %s --check-prefix=CONV-PACK
 
 // Check that this dispatch compiles to vectors and that there are no allocas.
 // By proxy checks that destination passing style kicked in correctly
@@ -281,3 +282,9 @@ hal.executable private @vectorize_fill_conv2d_generic {
 // CHECK:        vector.outerproduct %{{.+}}, %{{.+}}, %{{.+}} {kind = #vector.kind<add>}
 // CHECK-NOT:    linalg.generic
 // CHECK:        arith.cmpf olt, %{{.+}}, %{{.+}} : vector<4x8xf32>
+
+// CONV-PACK:      func.func @vectorize_fill_conv2d_generic
+// CONV-PACK:        %[[INPUT_PACK:.+]] = memref.alloca() {{.+}} : memref<
+// CONV-PACK:        scf.for
+// CONV-PACK:          vector.load %[[INPUT_PACK]]
+// CONV-PACK:          vector.outerproduct %{{.+}}, %{{.+}}, %{{.+}} {kind = #vector.kind<add>}
@@ -0,0 +1,66 @@
+// RUN: iree-opt --split-input-file --iree-llvmcpu-vector-contract-custom-kernels='arch=x86_64 features=+avx2,+avx512bw,+avx512vnni' %s | FileCheck %s --check-prefix=X86_64-AVX512VNNI
+// RUN: iree-opt --split-input-file --iree-llvmcpu-vector-contract-custom-kernels='arch=x86_64 features=+avx2' %s | FileCheck %s --check-prefix=X86_64-BASELINE
+
+func.func @mmt_8x2x16_i8i8i32(
+    %lhs: vector<8x2xi8>,
+    %rhs: vector<16x2xi8>,
+    %acc: vector<8x16xi32>) -> vector<8x16xi32> {
+  %lhs_wide = arith.extsi %lhs : vector<8x2xi8> to vector<8x2xi32>
+  %rhs_wide = arith.extsi %rhs : vector<16x2xi8> to vector<16x2xi32>
+  %res = vector.contract {
+      indexing_maps = [
+          affine_map<(d0, d1, d2) -> (d0, d2)>,
+          affine_map<(d0, d1, d2) -> (d1, d2)>,
+          affine_map<(d0, d1, d2) -> (d0, d1)>
+      ], iterator_types = ["parallel", "parallel", "reduction"], kind = #vector.kind<add>
+  } %lhs_wide, %rhs_wide, %acc : vector<8x2xi32>, vector<16x2xi32> into vector<8x16xi32>
+  return %res : vector<8x16xi32>
+}
+// X86_64-AVX512VNNI-LABEL: func.func @mmt_8x2x16_i8i8i32(
+// X86_64-AVX512VNNI-SAME:      %[[LHS:[^:[:space:]]+]]
+// X86_64-AVX512VNNI-SAME:      %[[RHS:[^:[:space:]]+]]
+// X86_64-AVX512VNNI-SAME:      %[[ACC:[^:[:space:]]+]]
+// X86_64-AVX512VNNI-DAG:     %[[INITRES:.+]] = arith.constant dense<0> : vector<128xi32>
+// X86_64-AVX512VNNI-DAG:     %[[LHS1D:.+]] = vector.shape_cast %[[LHS]] : vector<8x2xi8> to vector<16xi8>
+// X86_64-AVX512VNNI-DAG:     %[[RHS1D:.+]] = vector.shape_cast %[[RHS]] : vector<16x2xi8> to vector<32xi8>
+// X86_64-AVX512VNNI-DAG:     %[[ACC1D:.+]] = vector.shape_cast %[[ACC]] : vector<8x16xi32> to vector<128xi32>
+// X86_64-AVX512VNNI-DAG:     %[[ACC1D_0:.+]] = vector.extract_strided_slice %[[ACC1D]] {offsets = [0], sizes = [16], strides = [1]} : vector<128xi32> to vector<16xi32>
+// X86_64-AVX512VNNI-DAG:     %[[ACC1D_7:.+]] = vector.extract_strided_slice %[[ACC1D]] {offsets = [112], sizes = [16], strides = [1]} : vector<128xi32> to vector<16xi32>
+// X86_64-AVX512VNNI:         %[[ASM:.+]] = llvm.inline_asm asm_dialect = att
+// X86_64-AVX512VNNI-SAME:      "{{.*}}vpmovsxbw $9, %zmm31{{.*}}vpmovsxbw $8, %ymm30{{.*}}vshufi32x4 $$0x00{{(.*vpdpwssd %zmm31, %zmm28, \$[0-7]){8}[^"]*}}"
+// X86_64-AVX512VNNI-SAME:      "{{(\=v,){8}v,v,0,1,2,3,4,5,6,7,}}~{zmm28},~{zmm29},~{zmm30},~{zmm31}"
+// X86_64-AVX512VNNI-SAME:      {{\(vector<16xi8>, vector<32xi8>, (vector<16xi32>(, )?){8}\)}}
+// X86_64-AVX512VNNI-SAME:      ->  !llvm.struct<({{((vector<16xi32>(, )?){8})}})>
+// X86_64-AVX512VNNI-DAG:     %[[RES0:.+]] = llvm.extractvalue %[[ASM]][0]
+// X86_64-AVX512VNNI-DAG:     %[[RES7:.+]] = llvm.extractvalue %[[ASM]][7]
+// X86_64-AVX512VNNI-DAG:     %[[INS0:.+]] = vector.insert_strided_slice %[[RES0]], %[[INITRES]] {offsets = [0], strides = [1]}
+// X86_64-AVX512VNNI-DAG:     %[[INS7:.+]] = vector.insert_strided_slice %[[RES7]], %{{.+}} {offsets = [112], strides = [1]}
+// X86_64-AVX512VNNI:         %[[RESULT2D:.+]] = vector.shape_cast %[[INS7]] : vector<128xi32> to vector<8x16xi32>
+// X86_64-AVX512VNNI:         return %[[RESULT2D]]
+
+// Without +avx512vnni the contraction is left to the default lowerings.
+// X86_64-BASELINE-LABEL: func.func @mmt_8x2x16_i8i8i32(
+// X86_64-BASELINE-NOT:     llvm.inline_asm
+// X86_64-BASELINE:         vector.contract
+
+// -----
+
+// Only the exact kernel shape is matched.
+func.func @mmt_8x4x16_i8i8i32(
+    %lhs: vector<8x4xi8>,
+    %rhs: vector<16x4xi8>,
+    %acc: vector<8x16xi32>) -> vector<8x16xi32> {
+  %lhs_wide = arith.extsi %lhs : vector<8x4xi8> to vector<8x4xi32>
+  %rhs_wide = arith.extsi %rhs : vector<16x4xi8> to vector<16x4xi32>
+  %res = vector.contract {
+      indexing_maps = [
+          affine_map<(d0, d1, d2) -> (d0, d2)>,
+          affine_map<(d0, d1, d2) -> (d1, d2)>,
+          affine_map<(d0, d1, d2) -> (d0, d1)>
+      ], iterator_types = ["parallel", "parallel", "reduction"], kind = #vector.kind<add>
+  } %lhs_wide, %rhs_wide, %acc : vector<8x4xi32>, vector<16x4xi32> into vector<8x16xi32>
+  return %res : vector<8x16xi32>
+}
+// X86_64-AVX512VNNI-LABEL: func.func @mmt_8x4x16_i8i8i32(
+// X86_64-AVX512VNNI-NOT:     llvm.inline_asm
+// X86_64-AVX512VNNI:         vector.contract
@@ -11,6 +11,7 @@
 #include "iree-dialects/Dialect/LinalgExt/IR/LinalgExtOps.h"
 #include "iree/compiler/Codegen/Dialect/LoweringConfig.h"
 #include "iree/compiler/Dialect/Flow/IR/FlowOps.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "mlir/Analysis/SliceAnalysis.h"
@@ -35,6 +36,19 @@ llvm::cl::opt<std::string> clGPUCodegenTransformDialectFileName(
 }
 }  // namespace mlir
 
+static llvm::cl::opt<unsigned> clGPUTensorCorePipelineDepth(
+    "iree-codegen-llvmgpu-tensorcore-pipeline-depth",
+    llvm::cl::desc("Number of shared memory buffers used to software pipeline "
+                   "the copies feeding tensor core matmuls. Reduced when the "
+                   "buffers don't fit in shared memory"),
+    llvm::cl::init(4));
+
+static llvm::cl::opt<bool> clGPUEnableLargeTensorCoreTiles(
+    "iree-codegen-llvmgpu-enable-large-tensorcore-tiles",
+    llvm::cl::desc("Use larger workgroup tiles for tensor core matmuls that "
+                   "are large enough to still fill the GPU with them"),
+    llvm::cl::init(false));
+
 namespace {
 struct TileWorkgroupSizePair {
   // How many scalar elements each workgroup should handle along each dimension.
@@ -42,10 +56,16 @@ struct TileWorkgroupSizePair {
   std::array<int64_t, 3> workgroupSize;
 };
 
-// Software pipeline depths
-constexpr unsigned softwarePipelineDepthTensorCore = 4;
 // Simt codegen does not do software pipelining.
 constexpr unsigned softwarePipelineDepthSimt = 0;
+
+// Shared memory the multi-buffered tensor core operand tiles may use. Fits the
+// carveout of all sm_8x parts (up to 163KB on sm_80, 99KB on sm_86/sm_89).
+constexpr int64_t kTensorCoreSharedMemBudgetBytes = 96 * 1024;
+
+// Large tensor core tiles are only picked if they produce at least that many
+// workgroups, one per SM on A100, so that no SM is left idle.
+constexpr int64_t kMinWorkgroupsForLargeTensorCoreTiles = 108;
 }  // namespace
 
 /// Return the best combination of tile size and wg size. It will then used to
@@ -70,13 +90,40 @@ static void getTensorCoreConfig(
     SmallVectorImpl<TileWorkgroupSizePair> &tileSizes, bool isFp16) {
   // Tile sizes are skewed towards small matmul for now. Long term the plan is
   // to not rely on hardcoded configurations.
+  // The large tiles give each of the 8 warps a 64x32 tile which amortizes the
+  // shared memory loads over 8 mma ops, against 1 for the default tiles.
   if (isFp16) {
+    if (clGPUEnableLargeTensorCoreTiles) {
+      tileSizes.push_back(TileWorkgroupSizePair({{128, 128, 32}, {128, 2, 1}}));
+      tileSizes.push_back(TileWorkgroupSizePair({{64, 64, 32}, {64, 2, 1}}));
+    }
     tileSizes.push_back(TileWorkgroupSizePair({{32, 32, 32}, {64, 2, 1}}));
   } else {
+    if (clGPUEnableLargeTensorCoreTiles) {
+      tileSizes.push_back(TileWorkgroupSizePair({{128, 128, 16}, {128, 2, 1}}));
+      tileSizes.push_back(TileWorkgroupSizePair({{64, 64, 16}, {64, 2, 1}}));
+    }
     tileSizes.push_back(TileWorkgroupSizePair({{32, 32, 16}, {64, 2, 1}}));
   }
 }
 
+/// Returns the software pipeline depth to use for a tensor core matmul with
+/// the given workgroup tile sizes: the requested depth, reduced until all the
+/// operand buffers fit in shared memory.
+static unsigned getTensorCorePipelineDepth(int64_t tileM, int64_t tileN,
+                                           int64_t tileK, int64_t sizeK,
+                                           Type elementType) {
+  // There is nothing to pipeline if the reduction is done in one step.
+  if (sizeK == tileK) return 1;
+  int64_t stageBytes =
+      (tileM + tileN) * tileK * elementType.getIntOrFloatBitWidth() / 8;
+  unsigned depth = std::max<unsigned>(clGPUTensorCorePipelineDepth, 1);
+  while (depth > 1 && depth * stageBytes > kTensorCoreSharedMemBudgetBytes) {
+    --depth;
+  }
+  return depth;
+}
+
 static std::string getTargetArch(func::FuncOp entryPoint) {
   if (auto variantOp =
           entryPoint->getParentOfType<IREE::HAL::ExecutableVariantOp>()) {
@@ -90,6 +137,32 @@ static std::string getTargetArch(func::FuncOp entryPoint) {
   return "";
 }
 
+/// Returns the SM version of the CUDA target, e.g. 80 for sm_80, or 0 if the
+/// target architecture isn't known.
+static unsigned getCudaSMVersion(func::FuncOp entryPoint) {
+  std::string targetArch = getTargetArch(entryPoint);
+  StringRef version(targetArch);
+  unsigned smVersion = 0;
+  if (!version.consume_front("sm_") ||
+      version.take_while(llvm::isDigit).getAsInteger(10, smVersion)) {
+    return 0;
+  }
+  return smVersion;
+}
+
+/// Returns the size in bytes of the L2 cache of the CUDA target. Parts of the
+/// same architecture differ, so this errs on the small side.
+static int64_t getL2CacheSizeInBytes(func::FuncOp entryPoint) {
+  switch (getCudaSMVersion(entryPoint)) {
+    case 80:  // A100
+      return 40 * 1024 * 1024;
+    case 90:  // H100
+      return 50 * 1024 * 1024;
+    default:
+      return 4 * 1024 * 1024;
+  }
+}
+
 bool isCudaTarget(func::FuncOp entryPoint) {
   if (auto variantOp =
           entryPoint->getParentOfType<IREE::HAL::ExecutableVariantOp>()) {
@@ -105,7 +178,9 @@ static bool supportsTensorCore(func::FuncOp entryPoint, linalg::LinalgOp op) {
   // Limit tensor core pipeline to matmul as not all combinations of transpose
   // are supported upstream.
   // TODO(thomasraoux): Enable batchMatmul and generic contraction.
-  if (getTargetArch(entryPoint) != "sm_80") return false;
+  // The pipeline relies on async copies to shared memory, which are available
+  // from Ampere (sm_80) on.
+  if (getCudaSMVersion(entryPoint) < 80) return false;
   if (!(isa<linalg::MatmulOp>(op) || isa<linalg::BatchMatmulOp>(op))) {
     assert(linalg::isaContractionOpInterface(op));
     // If this is not a named op matmul check some properties to make sure that
@@ -147,7 +222,8 @@ static LogicalResult setContractConfig(func::FuncOp entryPoint,
       [&entryPoint, &op](int64_t tileX, int64_t tileY, int64_t tileK,
                          llvm::ArrayRef<int64_t> workgroupSize,
                          unsigned softwarePipelineDepth,
-                         IREE::Codegen::DispatchLoweringPassPipeline pipeline) {
+                         IREE::Codegen::DispatchLoweringPassPipeline pipeline,
+                         unsigned swizzleLogTile = 0) {
         TileSizesListType tileSizes;
         unsigned numParallelLoops = op.getNumParallelLoops();
         SmallVector<int64_t> workgroupTileSizes(numParallelLoops - 2, 1);
@@ -168,9 +244,9 @@ static LogicalResult setContractConfig(func::FuncOp entryPoint,
 
         tileSizes.emplace_back(
             std::move(workgroupTileSizes));  // Workgroup level.
-        return setOpConfigAndEntryPointFnTranslation(entryPoint, op, tileSizes,
-                                                     pipeline, workgroupSize,
-                                                     softwarePipelineDepth);
+        return setOpConfigAndEntryPointFnTranslation(
+            entryPoint, op, tileSizes, pipeline, workgroupSize,
+            softwarePipelineDepth, swizzleLogTile);
       };
   // Infer the MxN size of the matmul based on operands and indexing maps.
   auto lhsShape =
@@ -209,30 +285,54 @@ static LogicalResult setContractConfig(func::FuncOp entryPoint,
   bool isStaticSize = sizeM != ShapedType::kDynamicSize &&
                       sizeN != ShapedType::kDynamicSize &&
                       sizeK != ShapedType::kDynamicSize;
+  // Swizzles the workgroups when the RHS read by each row of workgroups
+  // doesn't fit in L2.
+  auto getSwizzleLogTile = [&](int64_t tileM) {
+    Type elementType = op.getInputOperand(1)
+                           ->get()
+                           .getType()
+                           .cast<ShapedType>()
+                           .getElementType();
+    int64_t rhsSizeInBytes =
+        sizeK * sizeN * elementType.getIntOrFloatBitWidth() / 8;
+    return getWorkgroupSwizzleLogTile(sizeM / tileM, rhsSizeInBytes,
+                                      getL2CacheSizeInBytes(entryPoint));
+  };
   if (isStaticSize) {
     /// Try tensorcore config first.
     if (supportsTensorCore(entryPoint, op)) {
       SmallVector<TileWorkgroupSizePair> TCtileSizeConfig;
+      Type elementType = op.getInputOperand(0)
+                             ->get()
+                             .getType()
+                             .cast<RankedTensorType>()
+                             .getElementType();
 
-      getTensorCoreConfig(TCtileSizeConfig, op.getInputOperand(0)
-                                                ->get()
-                                                .getType()
-                                                .cast<RankedTensorType>()
-                                                .getElementType()
-                                                .isF16());
+      getTensorCoreConfig(TCtileSizeConfig, elementType.isF16());
       // Pick the best configuration where the original shape is aligned on the
-      // tile size.
-      for (TileWorkgroupSizePair &config : TCtileSizeConfig) {
-        if (sizeK % config.tileSize[2] == 0 &&
-            sizeN % config.tileSize[1] == 0 &&
-            sizeM % config.tileSize[0] == 0) {
-          return setMatmulConfig(
-              config.tileSize[0], config.tileSize[1], config.tileSize[2],
-              config.workgroupSize,
-              sizeK == config.tileSize[2] ? 1 : softwarePipelineDepthTensorCore,
-              IREE::Codegen::DispatchLoweringPassPipeline::
-                  LLVMGPUMatmulTensorCore);
+      // tile size. All but the last configuration also need to produce enough
+      // workgroups to fill the GPU.
+      for (auto it : llvm::enumerate(TCtileSizeConfig)) {
+        TileWorkgroupSizePair &config = it.value();
+        if (sizeK % config.tileSize[2] != 0 ||
+            sizeN % config.tileSize[1] != 0 ||
+            sizeM % config.tileSize[0] != 0) {
+          continue;
+        }
+        int64_t numWorkgroups = (sizeM / config.tileSize[0]) *
+                                (sizeN / config.tileSize[1]);
+        if (it.index() + 1 != TCtileSizeConfig.size() &&
+            numWorkgroups < kMinWorkgroupsForLargeTensorCoreTiles) {
+          continue;
         }
+        return setMatmulConfig(
+            config.tileSize[0], config.tileSize[1], config.tileSize[2],
+            config.workgroupSize,
+            getTensorCorePipelineDepth(config.tileSize[0], config.tileSize[1],
+                                       config.tileSize[2], sizeK, elementType),
+            IREE::Codegen::DispatchLoweringPassPipeline::
+                LLVMGPUMatmulTensorCore,
+            getSwizzleLogTile(config.tileSize[0]));
       }
     }
     // Special case for very small matrices.
@@ -252,7 +352,8 @@ static LogicalResult setContractConfig(func::FuncOp entryPoint,
         return setMatmulConfig(
             config.tileSize[0], config.tileSize[1], config.tileSize[2],
             config.workgroupSize, softwarePipelineDepthSimt,
-            IREE::Codegen::DispatchLoweringPassPipeline::LLVMGPUMatmulSimt);
+            IREE::Codegen::DispatchLoweringPassPipeline::LLVMGPUMatmulSimt,
+            getSwizzleLogTile(config.tileSize[0]));
       }
     }
   }
@@ -165,12 +165,15 @@ void LLVMGPULowerExecutableTargetPass::runOnOperation() {
         addGPUVectorizationPassPipeline(executableLoweringPipeline);
         break;
       case IREE::Codegen::DispatchLoweringPassPipeline::LLVMGPUMatmulSimt:
-        addGPUMatmulSimtPassPipeline(executableLoweringPipeline);
+        addGPUMatmulSimtPassPipeline(
+            executableLoweringPipeline,
+            translationInfo.getValue().getSwizzleLogTile());
         break;
       case IREE::Codegen::DispatchLoweringPassPipeline::LLVMGPUMatmulTensorCore:
         addGPUMatmulTensorCorePassPipeline(
             executableLoweringPipeline,
-            translationInfo.getValue().getSoftwarePipelineDepth());
+            translationInfo.getValue().getSoftwarePipelineDepth(),
+            translationInfo.getValue().getSwizzleLogTile());
         break;
       case IREE::Codegen::DispatchLoweringPassPipeline::LLVMGPUWarpReduction:
         addGPUWarpReductionPassPipeline(executableLoweringPipeline);
@@ -25,10 +25,6 @@
 namespace mlir {
 namespace iree_compiler {
 
-static llvm::cl::opt<unsigned> logSwizzleTile(
-    "iree-codegen-log-swizzle-tile", llvm::cl::desc("log swizzle tile value"),
-    llvm::cl::init(0));
-
 /// Flag used for the transition from wmma to mma.sync. Once we have better
 /// performance with mma.sync we can drop wmma support and remove this flag.
 llvm::cl::opt<bool> llvmgpuUseMMASync(
@@ -103,7 +99,7 @@ void addGPUVectorizationPassPipeline(OpPassManager &pm) {
       createOptimizeVectorTransferPass());
 }
 
-void addGPUMatmulSimtPassPipeline(OpPassManager &pm) {
+void addGPUMatmulSimtPassPipeline(OpPassManager &pm, unsigned swizzleLogTile) {
   tileAndBufferize(pm);
 
   auto &nestedModulePM = pm.nest<ModuleOp>();
@@ -120,7 +116,7 @@ void addGPUMatmulSimtPassPipeline(OpPassManager &pm) {
   nestedModulePM.addNestedPass<func::FuncOp>(
       createRemoveSingleIterationLoopPass());
   nestedModulePM.addNestedPass<func::FuncOp>(
-      createWorkGroupSwizzle(logSwizzleTile));
+      createWorkGroupSwizzle(swizzleLogTile));
   nestedModulePM.addPass(createCanonicalizerPass());
   nestedModulePM.addPass(createCSEPass());
 
@@ -136,7 +132,8 @@ void addGPUMatmulSimtPassPipeline(OpPassManager &pm) {
 }
 
 void addGPUMatmulTensorCorePassPipeline(OpPassManager &pm,
-                                        unsigned pipelineDepth) {
+                                        unsigned pipelineDepth,
+                                        unsigned swizzleLogTile) {
   tileAndBufferize(pm);
 
   auto &nestedModulePM = pm.nest<ModuleOp>();
@@ -159,7 +156,7 @@ void addGPUMatmulTensorCorePassPipeline(OpPassManager &pm,
   nestedModulePM.addNestedPass<func::FuncOp>(
       createRemoveSingleIterationLoopPass());
   nestedModulePM.addNestedPass<func::FuncOp>(
-      createWorkGroupSwizzle(logSwizzleTile));
+      createWorkGroupSwizzle(swizzleLogTile));
   nestedModulePM.addPass(createCanonicalizerPass());
   nestedModulePM.addPass(createCSEPass());
 
@@ -301,6 +298,7 @@ void addGPUTransformDialectInterpreterPasses(OpPassManager &passManager) {
 }
 
 void buildLLVMGPUTransformPassPipeline(OpPassManager &pm, bool useROCM) {
+  pm.addPass(createApplyTuningDatabasePass());
   pm.nest<ModuleOp>().nest<func::FuncOp>().addPass(createTypePropagationPass());
   pm.nest<ModuleOp>().addPass(createBufferizeCopyOnlyDispatchesPass());
   pm.addPass(createLLVMGPULowerExecutableTargetPass());
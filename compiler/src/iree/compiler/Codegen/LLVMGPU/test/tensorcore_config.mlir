@@ -0,0 +1,165 @@
+// RUN: iree-opt --split-input-file --pass-pipeline='hal.executable(hal.executable.variant(iree-llvmgpu-lower-executable-target-pass{test-lowering-configuration}))' --iree-codegen-llvmgpu-enable-large-tensorcore-tiles %s | FileCheck %s
+// RUN: iree-opt --split-input-file --pass-pipeline='hal.executable(hal.executable.variant(iree-llvmgpu-lower-executable-target-pass{test-lowering-configuration}))' --iree-codegen-llvmgpu-enable-large-tensorcore-tiles --iree-codegen-llvmgpu-tensorcore-pipeline-depth=8 %s | FileCheck %s --check-prefix=DEPTH8
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>,
+    #hal.descriptor_set.binding<2, storage_buffer>
+  ]>
+]>
+hal.executable @large_matmul_f16 {
+  hal.executable.variant @cuda, target = <"cuda", "cuda-nvptx-fb", {target_arch = "sm_86"}> {
+    hal.executable.export @large_matmul_f16 layout(#executable_layout)
+    builtin.module {
+      func.func @large_matmul_f16() {
+        %c0 = arith.constant 0 : index
+        %cst = arith.constant 0.000000e+00 : f16
+        %0 = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer) : !flow.dispatch.tensor<readonly:2048x1024xf16>
+        %1 = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer) : !flow.dispatch.tensor<readonly:1024x2048xf16>
+        %2 = hal.interface.binding.subspan set(0) binding(2) type(storage_buffer) : !flow.dispatch.tensor<writeonly:2048x2048xf16>
+        %3 = flow.dispatch.tensor.load %0, offsets = [0, 0], sizes = [2048, 1024], strides = [1, 1] : !flow.dispatch.tensor<readonly:2048x1024xf16> -> tensor<2048x1024xf16>
+        %4 = flow.dispatch.tensor.load %1, offsets = [0, 0], sizes = [1024, 2048], strides = [1, 1] : !flow.dispatch.tensor<readonly:1024x2048xf16> -> tensor<1024x2048xf16>
+        %5 = linalg.init_tensor [2048, 2048] : tensor<2048x2048xf16>
+        %6 = linalg.fill ins(%cst : f16) outs(%5 : tensor<2048x2048xf16>) -> tensor<2048x2048xf16>
+        %7 = linalg.matmul ins(%3, %4 : tensor<2048x1024xf16>, tensor<1024x2048xf16>) outs(%6 : tensor<2048x2048xf16>) -> tensor<2048x2048xf16>
+        flow.dispatch.tensor.store %7, %2, offsets = [0, 0], sizes = [2048, 2048], strides = [1, 1] : tensor<2048x2048xf16> -> !flow.dispatch.tensor<writeonly:2048x2048xf16>
+        return
+      }
+    }
+  }
+}
+
+// Large matmuls on sm_80+ targets use the large tiles.
+//  CHECK-DAG: #[[CONFIG:.+]] = #iree_codegen.lowering_config<tile_sizes = {{\[}}[128, 128, 32]{{\]}}>
+//  CHECK-DAG: #[[TRANSLATION:.+]] = #iree_codegen.translation_info<LLVMGPUMatmulTensorCore pipeline_depth = 4>
+//      CHECK: hal.executable.export public @large_matmul_f16
+// CHECK-SAME:     translation_info = #[[TRANSLATION]]
+// CHECK-SAME:     workgroup_size = [128 : index, 2 : index, 1 : index]
+//      CHECK: linalg.matmul
+// CHECK-SAME:     lowering_config = #[[CONFIG]]
+
+// Only as many buffers as fit in shared memory are used.
+//  DEPTH8-DAG: #[[CONFIG:.+]] = #iree_codegen.lowering_config<tile_sizes = {{\[}}[128, 128, 32]{{\]}}>
+//  DEPTH8-DAG: #[[TRANSLATION:.+]] = #iree_codegen.translation_info<LLVMGPUMatmulTensorCore pipeline_depth = 6>
+//      DEPTH8: hal.executable.export public @large_matmul_f16
+// DEPTH8-SAME:     translation_info = #[[TRANSLATION]]
+// DEPTH8-SAME:     workgroup_size = [128 : index, 2 : index, 1 : index]
+//      DEPTH8: linalg.matmul
+// DEPTH8-SAME:     lowering_config = #[[CONFIG]]
+
+// -----
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>,
+    #hal.descriptor_set.binding<2, storage_buffer>
+  ]>
+]>
+hal.executable @medium_matmul_f16 {
+  hal.executable.variant @cuda, target = <"cuda", "cuda-nvptx-fb", {target_arch = "sm_80"}> {
+    hal.executable.export @medium_matmul_f16 layout(#executable_layout)
+    builtin.module {
+      func.func @medium_matmul_f16() {
+        %c0 = arith.constant 0 : index
+        %cst = arith.constant 0.000000e+00 : f16
+        %0 = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer) : !flow.dispatch.tensor<readonly:512x1024xf16>
+        %1 = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer) : !flow.dispatch.tensor<readonly:1024x512xf16>
+        %2 = hal.interface.binding.subspan set(0) binding(2) type(storage_buffer) : !flow.dispatch.tensor<writeonly:512x512xf16>
+        %3 = flow.dispatch.tensor.load %0, offsets = [0, 0], sizes = [512, 1024], strides = [1, 1] : !flow.dispatch.tensor<readonly:512x1024xf16> -> tensor<512x1024xf16>
+        %4 = flow.dispatch.tensor.load %1, offsets = [0, 0], sizes = [1024, 512], strides = [1, 1] : !flow.dispatch.tensor<readonly:1024x512xf16> -> tensor<1024x512xf16>
+        %5 = linalg.init_tensor [512, 512] : tensor<512x512xf16>
+        %6 = linalg.fill ins(%cst : f16) outs(%5 : tensor<512x512xf16>) -> tensor<512x512xf16>
+        %7 = linalg.matmul ins(%3, %4 : tensor<512x1024xf16>, tensor<1024x512xf16>) outs(%6 : tensor<512x512xf16>) -> tensor<512x512xf16>
+        flow.dispatch.tensor.store %7, %2, offsets = [0, 0], sizes = [512, 512], strides = [1, 1] : tensor<512x512xf16> -> !flow.dispatch.tensor<writeonly:512x512xf16>
+        return
+      }
+    }
+  }
+}
+
+// Large tiles would leave SMs idle, the default tiles are used instead.
+//  CHECK-DAG: #[[CONFIG:.+]] = #iree_codegen.lowering_config<tile_sizes = {{\[}}[32, 32, 32]{{\]}}>
+//  CHECK-DAG: #[[TRANSLATION:.+]] = #iree_codegen.translation_info<LLVMGPUMatmulTensorCore pipeline_depth = 4>
+//      CHECK: hal.executable.export public @medium_matmul_f16
+// CHECK-SAME:     translation_info = #[[TRANSLATION]]
+// CHECK-SAME:     workgroup_size = [64 : index, 2 : index, 1 : index]
+//      CHECK: linalg.matmul
+// CHECK-SAME:     lowering_config = #[[CONFIG]]
+
+// -----
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>,
+    #hal.descriptor_set.binding<2, storage_buffer>
+  ]>
+]>
+hal.executable @large_matmul_f32 {
+  hal.executable.variant @cuda, target = <"cuda", "cuda-nvptx-fb", {target_arch = "sm_80"}> {
+    hal.executable.export @large_matmul_f32 layout(#executable_layout)
+    builtin.module {
+      func.func @large_matmul_f32() {
+        %c0 = arith.constant 0 : index
+        %cst = arith.constant 0.000000e+00 : f32
+        %0 = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer) : !flow.dispatch.tensor<readonly:2048x512xf32>
+        %1 = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer) : !flow.dispatch.tensor<readonly:512x1024xf32>
+        %2 = hal.interface.binding.subspan set(0) binding(2) type(storage_buffer) : !flow.dispatch.tensor<writeonly:2048x1024xf32>
+        %3 = flow.dispatch.tensor.load %0, offsets = [0, 0], sizes = [2048, 512], strides = [1, 1] : !flow.dispatch.tensor<readonly:2048x512xf32> -> tensor<2048x512xf32>
+        %4 = flow.dispatch.tensor.load %1, offsets = [0, 0], sizes = [512, 1024], strides = [1, 1] : !flow.dispatch.tensor<readonly:512x1024xf32> -> tensor<512x1024xf32>
+        %5 = linalg.init_tensor [2048, 1024] : tensor<2048x1024xf32>
+        %6 = linalg.fill ins(%cst : f32) outs(%5 : tensor<2048x1024xf32>) -> tensor<2048x1024xf32>
+        %7 = linalg.matmul ins(%3, %4 : tensor<2048x512xf32>, tensor<512x1024xf32>) outs(%6 : tensor<2048x1024xf32>) -> tensor<2048x1024xf32>
+        flow.dispatch.tensor.store %7, %2, offsets = [0, 0], sizes = [2048, 1024], strides = [1, 1] : tensor<2048x1024xf32> -> !flow.dispatch.tensor<writeonly:2048x1024xf32>
+        return
+      }
+    }
+  }
+}
+
+//  CHECK-DAG: #[[CONFIG:.+]] = #iree_codegen.lowering_config<tile_sizes = {{\[}}[128, 128, 16]{{\]}}>
+//  CHECK-DAG: #[[TRANSLATION:.+]] = #iree_codegen.translation_info<LLVMGPUMatmulTensorCore pipeline_depth = 4>
+//      CHECK: hal.executable.export public @large_matmul_f32
+// CHECK-SAME:     translation_info = #[[TRANSLATION]]
+// CHECK-SAME:     workgroup_size = [128 : index, 2 : index, 1 : index]
+//      CHECK: linalg.matmul
+// CHECK-SAME:     lowering_config = #[[CONFIG]]
+
+// -----
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>,
+    #hal.descriptor_set.binding<2, storage_buffer>
+  ]>
+]>
+hal.executable @swizzled_matmul_f16 {
+  hal.executable.variant @cuda, target = <"cuda", "cuda-nvptx-fb", {target_arch = "sm_80"}> {
+    hal.executable.export @swizzled_matmul_f16 layout(#executable_layout)
+    builtin.module {
+      func.func @swizzled_matmul_f16() {
+        %c0 = arith.constant 0 : index
+        %cst = arith.constant 0.000000e+00 : f16
+        %0 = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer) : !flow.dispatch.tensor<readonly:4096x8192xf16>
+        %1 = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer) : !flow.dispatch.tensor<readonly:8192x8192xf16>
+        %2 = hal.interface.binding.subspan set(0) binding(2) type(storage_buffer) : !flow.dispatch.tensor<writeonly:4096x8192xf16>
+        %3 = flow.dispatch.tensor.load %0, offsets = [0, 0], sizes = [4096, 8192], strides = [1, 1] : !flow.dispatch.tensor<readonly:4096x8192xf16> -> tensor<4096x8192xf16>
+        %4 = flow.dispatch.tensor.load %1, offsets = [0, 0], sizes = [8192, 8192], strides = [1, 1] : !flow.dispatch.tensor<readonly:8192x8192xf16> -> tensor<8192x8192xf16>
+        %5 = linalg.init_tensor [4096, 8192] : tensor<4096x8192xf16>
+        %6 = linalg.fill ins(%cst : f16) outs(%5 : tensor<4096x8192xf16>) -> tensor<4096x8192xf16>
+        %7 = linalg.matmul ins(%3, %4 : tensor<4096x8192xf16>, tensor<8192x8192xf16>) outs(%6 : tensor<4096x8192xf16>) -> tensor<4096x8192xf16>
+        flow.dispatch.tensor.store %7, %2, offsets = [0, 0], sizes = [4096, 8192], strides = [1, 1] : tensor<4096x8192xf16> -> !flow.dispatch.tensor<writeonly:4096x8192xf16>
+        return
+      }
+    }
+  }
+}
+
+// The 128MB RHS does not fit in the 40MB L2 of sm_80, so workgroups are
+// swizzled in tiles of 4 rows to improve the L2 reuse of the RHS.
+//  CHECK-DAG: #[[TRANSLATION:.+]] = #iree_codegen.translation_info<LLVMGPUMatmulTensorCore pipeline_depth = 4 swizzle_log_tile = 2>
+//      CHECK: hal.executable.export public @swizzled_matmul_f16
+// CHECK-SAME:     translation_info = #[[TRANSLATION]]
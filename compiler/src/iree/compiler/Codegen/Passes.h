@@ -7,6 +7,7 @@
 #ifndef IREE_COMPILER_CODEGEN_PASSES_H_
 #define IREE_COMPILER_CODEGEN_PASSES_H_
 
+#include <functional>
 #include <memory>
 
 #include "iree/compiler/Codegen/Dialect/LoweringConfig.h"
@@ -111,6 +112,11 @@ std::unique_ptr<OperationPass<func::FuncOp>> createOptimizeVectorTransferPass();
 std::unique_ptr<OperationPass<void>>
 createTestPartitionableLoopsInterfacePass();
 
+/// Pass to set the `#iree_codegen.compilation_info` of dispatches found in the
+/// tuning database given by `--iree-codegen-tuning-database`.
+std::unique_ptr<OperationPass<IREE::HAL::ExecutableVariantOp>>
+createApplyTuningDatabasePass();
+
 /// Pass to tile and distribute to workgroups.
 std::unique_ptr<OperationPass<IREE::HAL::ExecutableVariantOp>>
 createTileAndDistributeToWorkgroupsPass();
@@ -132,6 +138,13 @@ std::unique_ptr<OperationPass<>> createPolynomialApproximationPass();
 /// Creates a pass to convert memref.copy to linalg op.
 std::unique_ptr<OperationPass<func::FuncOp>> createMemrefCopyToLinalgPass();
 
+/// Creates a pass that reports heap and stack allocations left in dispatches
+/// after bufferization and copies into or out of them. These are usually
+/// transient buffers bufferization could not avoid and waste memory bandwidth.
+/// Reports warnings, or errors that fail the pass when `fail` is set.
+std::unique_ptr<OperationPass<func::FuncOp>> createCheckTransientBuffersPass(
+    bool fail = false);
+
 /// Convert GPU shared memory copies to distributed
 /// transfer_read/transfer_write.
 std::unique_ptr<OperationPass<func::FuncOp>>
@@ -141,13 +154,21 @@ createGPUDistributeSharedMemoryCopy();
 std::unique_ptr<OperationPass<func::FuncOp>> createGPUPipeliningPass(
     unsigned depth = 1);
 
-/// Converts vector ops to gpu dialect.
+/// Swizzles the workgroup IDs with tiles of 2^`swizzleLogTile` rows for better
+/// cache reuse. `--iree-codegen-log-swizzle-tile` overrides `swizzleLogTile`.
 std::unique_ptr<OperationPass<func::FuncOp>> createWorkGroupSwizzle(
     unsigned swizzleLogTile = 0);
 
 /// Pad dynamic alloc op to convert them into static one.
 std::unique_ptr<OperationPass<func::FuncOp>> createPadDynamicAlloc();
 
+/// Distributes vector reductions onto the lanes of a subgroup (warp) and
+/// lowers them to GPU shuffles. `getWarpSize` returns the subgroup size to
+/// use for a given function; 32 is used if it is not provided.
+std::unique_ptr<OperationPass<func::FuncOp>>
+createConvertVectorReductionToGPUPass(
+    std::function<int(func::FuncOp)> getWarpSize = nullptr);
+
 //----------------------------------------------------------------------------//
 // Common codegen patterns.
 //----------------------------------------------------------------------------//
@@ -194,6 +215,11 @@ std::unique_ptr<OperationPass<ModuleOp>> createConvertToLLVMPass();
 std::unique_ptr<OperationPass<func::FuncOp>>
 createLLVMCPUEmitVectorizationRemarksPass();
 
+/// Writes a JSON report listing the dispatches that were not vectorized, not
+/// tiled, have dynamic loops or low estimated vector utilization into `path`.
+std::unique_ptr<OperationPass<ModuleOp>> createLLVMCPUEmitLintReportPass(
+    StringRef path = "", double minVectorUtilization = 0.5);
+
 /// Checks CPU backend specific IR constraints (like no stack allocations)
 std::unique_ptr<OperationPass<ModuleOp>>
 createLLVMCPUCheckIRBeforeLLVMConversionPass();
@@ -261,8 +287,10 @@ LogicalResult verifyDoubleTilingExpertPassPipelineConfig(
     ArrayRef<int64_t> workgroupSize = {});
 void addDoubleTilingExpertPassPipeline(OpPassManager &passManager,
                                        bool enablePeeling,
-                                       bool lowerToAVX2 = false);
-void addDoubleTilingPadExpertPassPipeline(OpPassManager &passManager);
+                                       bool lowerToAVX2 = false,
+                                       unsigned swizzleLogTile = 0);
+void addDoubleTilingPadExpertPassPipeline(OpPassManager &passManager,
+                                          unsigned swizzleLogTile = 0);
 
 // Populates the passes needed to do tiling, decomposing, and vectorizing the
 // convolution ops using the Codegen drivers from sandbox.
@@ -299,7 +327,8 @@ LogicalResult verifyGPUMatmulSimtPassPipeline(
     Operation *op, IREE::Codegen::LoweringConfigAttr loweringConfig,
     IREE::Codegen::TranslationInfoAttr translationInfo,
     ArrayRef<int64_t> workgroupSize);
-void addGPUMatmulSimtPassPipeline(OpPassManager &pm);
+void addGPUMatmulSimtPassPipeline(OpPassManager &pm,
+                                  unsigned swizzleLogTile = 0);
 
 /// Lowering using tensorcore operations.
 LogicalResult verifyGPUMatmulTensorCorePipeline(
@@ -307,7 +336,8 @@ LogicalResult verifyGPUMatmulTensorCorePipeline(
     IREE::Codegen::TranslationInfoAttr translationInfo,
     ArrayRef<int64_t> workgroupSize);
 void addGPUMatmulTensorCorePassPipeline(OpPassManager &pm,
-                                        unsigned pipelineDepth);
+                                        unsigned pipelineDepth,
+                                        unsigned swizzleLogTile = 0);
 
 /// Lowering reductions to warp reductions.
 void addGPUWarpReductionPassPipeline(OpPassManager &pm);
@@ -362,10 +392,6 @@ createLLVMGPUReduceSharedMemoryBankConflicts();
 /// Converts vector ops to gpu dialect.
 std::unique_ptr<OperationPass<func::FuncOp>> createLLVMGPUVectorToGPU();
 
-// Distribute vector ops.
-std::unique_ptr<OperationPass<func::FuncOp>>
-createConvertVectorReductionToGPUPass();
-
 //------------------------------------------------------------------------------
 // SPIR-V Passes
 //------------------------------------------------------------------------------
@@ -391,6 +417,11 @@ void addSPIRVTileAndVectorizeToCooperativeOpsPassPipeline(OpPassManager &pm);
 /// workgroup memory.
 void addSPIRVTileAndVectorizeWithWorkgroupMemoryPassPipeline(OpPassManager &pm);
 
+/// Pass pipeline to lower IREE HAL executables with workgroup tiled and
+/// distributed reduction Linalg ops to SPIR-V subgroup operations. Each
+/// workgroup is a single subgroup reducing one row with subgroup shuffles.
+void addSPIRVSubgroupReducePassPipeline(OpPassManager &pm);
+
 /// Pass to perform the final conversion to SPIR-V dialect.
 ///
 /// This pass converts remaining interface ops into SPIR-V global variables,
@@ -434,6 +465,11 @@ std::unique_ptr<OperationPass<func::FuncOp>> createSPIRVDistributePass();
 /// Pass to vectorize Linalg ops with buffer semantics.
 std::unique_ptr<OperationPass<func::FuncOp>> createSPIRVVectorizePass();
 
+/// Pass to tile reduction dimensions of Linalg ops with buffer semantics to
+/// the subgroup size and vectorize them without unrolling.
+std::unique_ptr<OperationPass<func::FuncOp>>
+createSPIRVTileAndVectorizeReductionPass();
+
 /// Converts memref of scalar to memref of vector of efficent size. This will
 /// allow to convert memory accesses to vector load/store in SPIR-V without
 /// having pointer bitcast.
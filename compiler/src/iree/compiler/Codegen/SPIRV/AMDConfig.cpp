@@ -34,11 +34,22 @@ namespace detail {
 // * 128KB LDS per WGP
 // * Max 20 waves per SIMD32
 // * Max 64KB LDS per workgroup
+//
+// RDNA3 adds WMMA instructions computing 16x16x16 matrix multiplies per wave;
+// they are exposed through the cooperative matrix extension.
 
 LogicalResult setAMDCodeGenConfig(const spirv::TargetEnv &targetEnv,
                                   Operation *rootOp) {
   int subgroupSize = targetEnv.getResourceLimits().getSubgroupSize();
   if (auto matmulOp = dyn_cast<linalg::MatmulOp>(rootOp)) {
+    // First try to see if we can use WMMA via cooperative matrix. Use 2x2
+    // waves per workgroup to share the workgroup tile loads among them.
+    if (failed(setCooperativeMatrixConfig(targetEnv, matmulOp,
+                                          /*bestSubgroupCountsMN=*/{2, 2}))) {
+      return failure();
+    }
+    if (getLoweringConfig(rootOp)) return success();
+
     std::array<int64_t, 2> workgroupXY = {subgroupSize / 2, 8};
     std::array<int64_t, 3> threadMNK = {8, 4, 32};
     return setMatmulOpConfig(matmulOp, subgroupSize, workgroupXY, threadMNK,
@@ -51,6 +51,8 @@
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/IR/SymbolTable.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Interfaces/ViewLikeInterface.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Support/LogicalResult.h"
 #include "mlir/Transforms/DialectConversion.h"
@@ -71,13 +73,15 @@ using InterfaceResourceMap =
 /// `moduleOp`'s block via `symbolTable` and bind it to `set` and `binding`.
 spirv::GlobalVariableOp createResourceVariable(Location loc, Type type,
                                                unsigned set, unsigned binding,
-                                               bool alias, ModuleOp moduleOp,
+                                               bool alias, bool readOnly,
+                                               ModuleOp moduleOp,
                                                SymbolTable *symbolTable) {
   std::string name = llvm::formatv("__resource_var_{0}_{1}_", set, binding);
   OpBuilder builder(moduleOp.getContext());
   auto variable =
       builder.create<spirv::GlobalVariableOp>(loc, type, name, set, binding);
   if (alias) variable->setAttr("aliased", builder.getUnitAttr());
+  if (readOnly) variable->setAttr("non_writable", builder.getUnitAttr());
   symbolTable->insert(variable, moduleOp.getBody()->begin());
   return variable;
 }
@@ -88,10 +92,35 @@ std::pair<int32_t, int32_t> getInterfaceSetAndBinding(
   return {op.set().getSExtValue(), op.binding().getSExtValue()};
 }
 
+/// Returns true if the memory bound to `subspanOp` may be written through it,
+/// looking through view-like ops.
+bool mayBeWritten(IREE::HAL::InterfaceBindingSubspanOp subspanOp) {
+  SmallVector<Value, 4> worklist = {subspanOp.getResult()};
+  while (!worklist.empty()) {
+    Value value = worklist.pop_back_val();
+    for (Operation *user : value.getUsers()) {
+      if (auto viewOp = dyn_cast<ViewLikeOpInterface>(user)) {
+        if (viewOp.getViewSource() == value) {
+          worklist.append(user->result_begin(), user->result_end());
+          continue;
+        }
+      }
+      auto effectOp = dyn_cast<MemoryEffectOpInterface>(user);
+      if (!effectOp || effectOp.hasEffect<MemoryEffects::Write>()) return true;
+    }
+  }
+  return false;
+}
+
 /// Scans all hal.interface.binding.subspan ops in `module`, creates their
 /// corresponding spv.GlobalVariables when needed, and returns the map.
 /// The created variables need to have their types fixed later.
-InterfaceResourceMap createResourceVariables(mlir::ModuleOp module) {
+///
+/// If `markReadOnly` is true, variables for (set, binding) pairs that are never
+/// written in a function are decorated as NonWritable. This allows drivers to
+/// fetch them through the read-only/texture cache path.
+InterfaceResourceMap createResourceVariables(mlir::ModuleOp module,
+                                             bool markReadOnly) {
   SymbolTable symbolTable(module);
   InterfaceResourceMap interfaceToResourceVars;
 
@@ -106,6 +135,8 @@ InterfaceResourceMap createResourceVariables(mlir::ModuleOp module) {
     // which will require creating multiple SPIR-V global variables.
     llvm::DenseMap<std::pair<uint32_t, uint32_t>, llvm::DenseSet<Type>>
         setBindingTypes;
+    // (set, binding) pairs written in this function.
+    llvm::DenseSet<std::pair<uint32_t, uint32_t>> writtenSetBindings;
 
     func.walk([&](Operation *op) {
       auto subspanOp = dyn_cast<IREE::HAL::InterfaceBindingSubspanOp>(op);
@@ -113,6 +144,9 @@ InterfaceResourceMap createResourceVariables(mlir::ModuleOp module) {
       subspanOps.emplace_back(subspanOp);
       setBindings.emplace_back(getInterfaceSetAndBinding(subspanOp));
       setBindingTypes[setBindings.back()].insert(subspanOp.getType());
+      if (mayBeWritten(subspanOp)) {
+        writtenSetBindings.insert(setBindings.back());
+      }
     });
 
     // Keep track of created SPIR-V global variables. This allows us to
@@ -133,13 +167,15 @@ InterfaceResourceMap createResourceVariables(mlir::ModuleOp module) {
         // binding) pair and they are used in the same function, those variables
         // need to have alias decoration.
         bool alias = setBindingTypes[setBindings[i]].size() > 1;
+        bool readOnly =
+            markReadOnly && !writtenSetBindings.contains(setBindings[i]);
 
         // We are using the interface op's type for creating the global
         // variable. It's fine. The correctness boundary is the pass.
         // We will fix it up during conversion so it won't leak.
         var = createResourceVariable(subspanOp.getLoc(), subspanOp.getType(),
                                      setBinding.first, setBinding.second, alias,
-                                     module, &symbolTable);
+                                     readOnly, module, &symbolTable);
         resourceVars[key] = var;
       }
 
@@ -380,7 +416,13 @@ void ConvertToSPIRVPass::runOnOperation() {
 
   // Performs a prelimiary step to analyze all hal.interface.binding.subspan ops
   // and create spv.GlobalVariables.
-  auto interfaceToResourceVars = createResourceVariables(moduleOp);
+  // Read-only bindings are mostly weights; Mali and Adreno GPUs can serve them
+  // from the texture cache once the driver knows they are never written.
+  spirv::Vendor vendor = targetAttr.getVendorID();
+  bool markReadOnly =
+      vendor == spirv::Vendor::ARM || vendor == spirv::Vendor::Qualcomm;
+  auto interfaceToResourceVars =
+      createResourceVariables(moduleOp, markReadOnly);
   // For using use them in conversion.
   patterns.insert<HALInterfaceBindingSubspanConverter>(typeConverter, context,
                                                        interfaceToResourceVars);
@@ -0,0 +1,59 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//===- IntelConfig.h - Intel CodeGen Configurations -----------------------===//
+//
+// This file contains CodeGen configurations for Intel GPUs.
+//
+//===----------------------------------------------------------------------===//
+
+#include "iree/compiler/Codegen/Dialect/LoweringConfig.h"
+#include "iree/compiler/Codegen/SPIRV/KernelConfig.h"
+#include "iree/compiler/Codegen/Utils/Utils.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/IR/BuiltinOps.h"
+
+#define DEBUG_TYPE "iree-spirv-intel-config"
+
+namespace mlir {
+namespace iree_compiler {
+namespace detail {
+
+// Xe-HPG architecture (Arc):
+//
+// Xe-core is the block for workgroups in Xe-HPG; it has 16 vector engines
+// (XVE) and 16 matrix engines (XMX) sharing 192KB of L1 cache/shared local
+// memory.
+//
+// * SIMD8/SIMD16/SIMD32 subgroups
+// * Max 64KB shared local memory per workgroup
+// * Max 1024 invocations per workgroup
+
+LogicalResult setIntelCodeGenConfig(const spirv::TargetEnv &targetEnv,
+                                    Operation *rootOp) {
+  int subgroupSize = targetEnv.getResourceLimits().getSubgroupSize();
+  if (auto matmulOp = dyn_cast<linalg::MatmulOp>(rootOp)) {
+    // First try to see if we can use XMX via cooperative matrix. Subgroups
+    // are narrower than on other desktop GPUs, so use 4x2 of them per
+    // workgroup to keep all the matrix engines of a Xe-core busy.
+    if (failed(setCooperativeMatrixConfig(targetEnv, matmulOp,
+                                          /*bestSubgroupCountsMN=*/{4, 2}))) {
+      return failure();
+    }
+    if (getLoweringConfig(rootOp)) return success();
+
+    std::array<int64_t, 2> workgroupXY = {subgroupSize, 8};
+    std::array<int64_t, 3> threadMNK = {8, 4, 16};
+    return setMatmulOpConfig(matmulOp, subgroupSize, workgroupXY, threadMNK,
+                             /*useWorkgroupMemory=*/true);
+  }
+  return success();
+}
+
+}  // namespace detail
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -17,6 +17,7 @@
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/MathExtras.h"
+#include "mlir/Analysis/SliceAnalysis.h"
 #include "mlir/Dialect/Linalg/IR/Linalg.h"
 #include "mlir/Dialect/SPIRV/IR/SPIRVAttributes.h"
 #include "mlir/Dialect/SPIRV/IR/SPIRVEnums.h"
@@ -295,6 +296,115 @@ LogicalResult setMatmulOpConfig(linalg::LinalgOp op, int64_t subgroupSize,
 
 }  // namespace detail
 
+//===----------------------------------------------------------------------===//
+// Cooperative Matrix Default Configuration
+//===----------------------------------------------------------------------===//
+
+namespace detail {
+
+struct CooperativeMatrixSize {
+  int64_t m;
+  int64_t n;
+  int64_t k;
+};
+
+/// Returns the cooperative matrix (M, N, K) sizes that are supported by the
+/// target environment and match the given parameters.
+static Optional<CooperativeMatrixSize> getCooperativeMatrixSize(
+    spirv::ResourceLimitsAttr resourceLimits, Type lhsType, Type rhsType,
+    Type resultType, int64_t m, int64_t n, int64_t k) {
+  auto properties = resourceLimits.getCooperativeMatrixPropertiesNv()
+                        .getAsRange<spirv::CooperativeMatrixPropertiesNVAttr>();
+  for (auto property : properties) {
+    if (property.getAType() == lhsType && property.getBType() == rhsType &&
+        property.getCType() == resultType &&
+        property.getResultType() == resultType &&
+        property.getScope().getValue() == spirv::Scope::Subgroup) {
+      int matmulM = property.getMSize();
+      int matmulN = property.getNSize();
+      int matmulK = property.getKSize();
+      if (m % matmulM == 0 && n % matmulN == 0 && k % matmulK == 0) {
+        return CooperativeMatrixSize{matmulM, matmulN, matmulK};
+      }
+    }
+  }
+  return llvm::None;
+}
+
+LogicalResult setCooperativeMatrixConfig(
+    const spirv::TargetEnv &targetEnv, linalg::MatmulOp op,
+    std::array<int64_t, 2> bestSubgroupCountsMN) {
+  // This configuration is only for cooperative matrix.
+  if (!targetEnv.allows(spirv::Capability::CooperativeMatrixNV) ||
+      !targetEnv.allows(spirv::Extension::SPV_NV_cooperative_matrix)) {
+    return success();
+  }
+
+  Value lhs = op.inputs()[0], rhs = op.inputs()[1], init = op.outputs()[0];
+
+  ArrayRef<int64_t> lhsShape = lhs.getType().cast<ShapedType>().getShape();
+  ArrayRef<int64_t> rhsShape = rhs.getType().cast<ShapedType>().getShape();
+  if (llvm::any_of(lhsShape, ShapedType::isDynamic)) return success();
+  if (llvm::any_of(rhsShape, ShapedType::isDynamic)) return success();
+
+  // TODO: Cooperative matrix support is fairly restricted. We can only have
+  // a curated list of fused element wise ops as defined in the extension
+  // SPV_NV_cooperative_matrix. Check that once we move bufferization after
+  // vectorization.
+
+  auto getElementType = [](Value v) {
+    return v.getType().cast<ShapedType>().getElementType();
+  };
+
+  auto resourceLimits = targetEnv.getResourceLimits();
+  auto coopMatSize = getCooperativeMatrixSize(
+      resourceLimits, getElementType(lhs), getElementType(rhs),
+      getElementType(init), lhsShape[0], rhsShape[1], lhsShape[1]);
+  if (!coopMatSize) return success();
+
+  auto pipeline = IREE::Codegen::DispatchLoweringPassPipeline::
+      SPIRVVectorizeToCooperativeOps;
+
+  // Each subgroup handles one native cooperative matrix tile. Use as many
+  // subgroups as requested along M and N as long as the workload stays
+  // perfectly divisible and the workgroup fits the target limits.
+  int64_t subgroupSize = resourceLimits.getSubgroupSize();
+  int64_t maxInvocations = resourceLimits.getMaxComputeWorkgroupInvocations();
+  int64_t subgroupCountM = bestSubgroupCountsMN[0];
+  int64_t subgroupCountN = bestSubgroupCountsMN[1];
+  while (subgroupCountM * subgroupCountN > 1) {
+    if (subgroupCountM > 1 &&
+        lhsShape[0] % (coopMatSize->m * subgroupCountM) != 0) {
+      subgroupCountM /= 2;
+    } else if (subgroupCountN > 1 &&
+               rhsShape[1] % (coopMatSize->n * subgroupCountN) != 0) {
+      subgroupCountN /= 2;
+    } else if (subgroupSize * subgroupCountM * subgroupCountN >
+               maxInvocations) {
+      if (subgroupCountM >= subgroupCountN) {
+        subgroupCountM /= 2;
+      } else {
+        subgroupCountN /= 2;
+      }
+    } else {
+      break;
+    }
+  }
+  std::array<int64_t, 3> workgroupSize = {
+      subgroupSize * subgroupCountM * subgroupCountN, 1, 1};
+
+  TileSizesListType tileSizes;
+  tileSizes.push_back({coopMatSize->m * subgroupCountM,
+                       coopMatSize->n * subgroupCountN, coopMatSize->k});
+  tileSizes.push_back({coopMatSize->m, coopMatSize->n, coopMatSize->k});
+
+  return setOpConfigAndEntryPointFnTranslation(
+      op->getParentOfType<func::FuncOp>(), op, tileSizes, pipeline,
+      workgroupSize);
+}
+
+}  // namespace detail
+
 //===----------------------------------------------------------------------===//
 // FFT Default Configuration
 //===----------------------------------------------------------------------===//
@@ -332,6 +442,66 @@ static LogicalResult setFftOpConfig(spirv::ResourceLimitsAttr limits,
       workgroupSize);
 }
 
+//===----------------------------------------------------------------------===//
+// Reduction Default Configuration
+//===----------------------------------------------------------------------===//
+
+/// Sets the configuration for reductions that can be mapped to subgroup
+/// reductions: each workgroup is a single subgroup reducing one row along the
+/// innermost dimension with subgroup shuffles.
+static LogicalResult setReductionConfig(const spirv::TargetEnv &targetEnv,
+                                        linalg::GenericOp op) {
+  // Reducing across the subgroup needs shuffles.
+  if (!targetEnv.allows(spirv::Capability::GroupNonUniformShuffle)) {
+    return failure();
+  }
+  if (op.hasDynamicShape()) return failure();
+  SmallVector<unsigned> reductionDims;
+  op.getReductionDims(reductionDims);
+  if (reductionDims.size() != 1 || reductionDims[0] != op.getNumLoops() - 1) {
+    return failure();
+  }
+  if (op.getRegionOutputArgs().size() != 1) return failure();
+
+  // Only support projected permutation inputs for now.
+  if (llvm::any_of(op.getInputOperands(), [&](OpOperand *input) {
+        return !op.getTiedIndexingMap(input).isProjectedPermutation();
+      })) {
+    return failure();
+  }
+
+  // Only single combiner operations are supported for now.
+  SmallVector<Operation *, 4> combinerOps;
+  if (!matchReduction(op.getRegionOutputArgs(), 0, combinerOps) ||
+      combinerOps.size() != 1) {
+    return failure();
+  }
+
+  const int64_t subgroupSize =
+      targetEnv.getResourceLimits().getSubgroupSize();
+  int64_t dimSize = op.getStaticLoopRanges()[reductionDims[0]];
+  if (dimSize % subgroupSize != 0) return failure();
+
+  // Use one subgroup per workgroup and let each workgroup reduce one row.
+  std::array<int64_t, 3> workgroupSize = {subgroupSize, 1, 1};
+
+  auto interfaceOp = cast<PartitionableLoopsInterface>(*op);
+  auto partitionedLoops =
+      interfaceOp.getPartitionableLoops(kNumMaxParallelDims);
+  size_t numLoops = partitionedLoops.empty() ? 0 : partitionedLoops.back() + 1;
+  SmallVector<int64_t, 4> workgroupTileSizes(numLoops, 1);
+  // Tile the reduction dimension to the subgroup size so that each invocation
+  // loads one element per iteration and the subgroup reduces it together.
+  workgroupTileSizes.append(reductionDims.size(), subgroupSize);
+
+  TileSizesListType tileSizes;
+  tileSizes.emplace_back(std::move(workgroupTileSizes));
+  return setOpConfigAndEntryPointFnTranslation(
+      op->getParentOfType<func::FuncOp>(), op, tileSizes,
+      IREE::Codegen::DispatchLoweringPassPipeline::SPIRVSubgroupReduce,
+      workgroupSize);
+}
+
 //===----------------------------------------------------------------------===//
 // Everything Default Configuration
 //===----------------------------------------------------------------------===//
@@ -567,6 +737,9 @@ static LogicalResult setSPIRVOpConfig(const spirv::TargetEnv &targetEnv,
     case spirv::Vendor::ARM:
       result = detail::setMaliCodeGenConfig(targetEnv, rootOp);
       break;
+    case spirv::Vendor::Intel:
+      result = detail::setIntelCodeGenConfig(targetEnv, rootOp);
+      break;
     case spirv::Vendor::NVIDIA:
       result = detail::setNVIDIACodeGenConfig(targetEnv, rootOp);
       break;
@@ -614,11 +787,13 @@ static LogicalResult setSPIRVOpConfig(const spirv::TargetEnv &targetEnv,
         // Other convolution/pooling op vectorization is not wired up.
         return setDefaultOpConfig(limits, op, /*allowVectorization=*/false);
       })
-      .Case<linalg::GenericOp>([limits](linalg::GenericOp op) {
+      .Case<linalg::GenericOp>([&targetEnv, limits](linalg::GenericOp op) {
         // If a generic op has reduction iterator types, it can be treated as a
-        // root op for configuration as well. Use the default configuration,
-        // which will mark it as a root.
+        // root op for configuration as well. Try to map it to subgroup
+        // reductions first; otherwise use the default configuration, which
+        // will mark it as a root.
         if (op.getNumLoops() != op.getNumParallelLoops()) {
+          if (succeeded(setReductionConfig(targetEnv, op))) return success();
           return setDefaultOpConfig(limits, op);
         }
         return success();
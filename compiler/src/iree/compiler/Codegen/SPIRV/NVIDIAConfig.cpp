@@ -23,91 +23,6 @@ namespace mlir {
 namespace iree_compiler {
 namespace detail {
 
-struct CooperativeMatrixSize {
-  int64_t m;
-  int64_t n;
-  int64_t k;
-};
-
-/// Returns the cooperative matrix (M, N, K) sizes that are supported by the
-/// target environment and match the given parameters.
-static Optional<CooperativeMatrixSize> getCooperativeMatrixSize(
-    spirv::ResourceLimitsAttr resourceLimits, Type lhsType, Type rhsType,
-    Type resultType, int64_t m, int64_t n, int64_t k) {
-  auto properties = resourceLimits.getCooperativeMatrixPropertiesNv()
-                        .getAsRange<spirv::CooperativeMatrixPropertiesNVAttr>();
-  for (auto property : properties) {
-    if (property.getAType() == lhsType && property.getBType() == rhsType &&
-        property.getCType() == resultType &&
-        property.getResultType() == resultType &&
-        property.getScope().getValue() == spirv::Scope::Subgroup) {
-      int matmulM = property.getMSize();
-      int matmulN = property.getNSize();
-      int matmulK = property.getKSize();
-      if (m % matmulM == 0 && n % matmulN == 0 && k % matmulK == 0) {
-        return CooperativeMatrixSize{matmulM, matmulN, matmulK};
-      }
-    }
-  }
-  return llvm::None;
-}
-
-static LogicalResult setOpConfig(const spirv::TargetEnv &targetEnv,
-                                 linalg::MatmulOp op) {
-  // This configuration is only for cooperative matrix.
-  if (!targetEnv.allows(spirv::Capability::CooperativeMatrixNV) ||
-      !targetEnv.allows(spirv::Extension::SPV_NV_cooperative_matrix)) {
-    return success();
-  }
-
-  Value lhs = op.inputs()[0], rhs = op.inputs()[1], init = op.outputs()[0];
-
-  ArrayRef<int64_t> lhsShape = lhs.getType().cast<ShapedType>().getShape();
-  ArrayRef<int64_t> rhsShape = rhs.getType().cast<ShapedType>().getShape();
-  if (llvm::any_of(lhsShape, ShapedType::isDynamic)) return success();
-  if (llvm::any_of(rhsShape, ShapedType::isDynamic)) return success();
-
-  // TODO: Cooperative matrix support is fairly restricted. We can only have
-  // a curated list of fused element wise ops as defined in the extension
-  // SPV_NV_cooperative_matrix. Check that once we move bufferization after
-  // vectorization.
-
-  auto getElementType = [](Value v) {
-    return v.getType().cast<ShapedType>().getElementType();
-  };
-
-  auto resourceLimits = targetEnv.getResourceLimits();
-  auto coopMatSize = getCooperativeMatrixSize(
-      resourceLimits, getElementType(lhs), getElementType(rhs),
-      getElementType(init), lhsShape[0], rhsShape[1], lhsShape[1]);
-  if (!coopMatSize) return success();
-
-  auto pipeline = IREE::Codegen::DispatchLoweringPassPipeline::
-      SPIRVVectorizeToCooperativeOps;
-
-  // For now only support one subgroup per workgroup because in the above
-  // configuration deduction step we only consider whether the input workload is
-  // perfectly divisible by some native cooperative matrix size.
-  //
-  // TODO: Use some heuristics to deduce how many subgroups should be used and
-  // the tile sizes for each subgroup, considering the input workload size and
-  // native cooperative matrix size choices.
-  int subgroupSize = resourceLimits.getSubgroupSize();
-  std::array<int64_t, 3> workgroupSize = {subgroupSize, 1, 1};
-
-  TileSizesListType tileSizes;
-  // Again because we only consider whether the input workload is perfectly
-  // divisible by some native cooperative matrix size, not some multiples of it,
-  // need to make sure the subgroup tile sizes are the same as the workgroup
-  // one.
-  tileSizes.push_back({coopMatSize->m, coopMatSize->n, coopMatSize->k});
-  tileSizes.push_back({coopMatSize->m, coopMatSize->n, coopMatSize->k});
-
-  return setOpConfigAndEntryPointFnTranslation(
-      op->getParentOfType<func::FuncOp>(), op, tileSizes, pipeline,
-      workgroupSize);
-}
-
 // Volta architecture:
 // https://docs.nvidia.com/cuda/volta-tuning-guide/index.html#sm-occupancy
 //
@@ -144,7 +59,9 @@ LogicalResult setNVIDIACodeGenConfig(const spirv::TargetEnv &targetEnv,
 
   // First try to see if we can use tensor cores.
   if (auto matmulOp = dyn_cast<linalg::MatmulOp>(rootOp)) {
-    if (failed(setOpConfig(targetEnv, matmulOp))) return failure();
+    if (failed(setCooperativeMatrixConfig(targetEnv, matmulOp))) {
+      return failure();
+    }
     if (getLoweringConfig(rootOp)) return success();
   }
 
@@ -113,6 +113,9 @@ void SPIRVLowerExecutableTargetPass::runOnOperation() {
         addSPIRVTileAndVectorizeWithWorkgroupMemoryPassPipeline(
             executableLoweringPipeline);
         break;
+      case IREE::Codegen::DispatchLoweringPassPipeline::SPIRVSubgroupReduce:
+        addSPIRVSubgroupReducePassPipeline(executableLoweringPipeline);
+        break;
       default:
         variantOp.emitOpError("Unsupported pipeline on GPU target.");
         return signalPassFailure();
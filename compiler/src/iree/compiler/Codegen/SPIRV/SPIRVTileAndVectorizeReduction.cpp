@@ -0,0 +1,163 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//===- SPIRVTileAndVectorizeReduction.cpp ---------------------------------===//
+//
+// This pass tiles the reduction dimension of Linalg ops with buffer semantics
+// to the subgroup size and vectorizes them without unrolling, so that the
+// vector reductions can later be distributed onto the invocations of a
+// subgroup.
+//
+//===----------------------------------------------------------------------===//
+
+#include "iree/compiler/Codegen/Dialect/LoweringConfig.h"
+#include "iree/compiler/Codegen/PassDetail.h"
+#include "iree/compiler/Codegen/Passes.h"
+#include "iree/compiler/Codegen/Transforms/Transforms.h"
+#include "iree/compiler/Codegen/Utils/MarkerUtils.h"
+#include "iree/compiler/Codegen/Utils/Utils.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Dialect/Linalg/Transforms/Transforms.h"
+#include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/Dialect/SCF/Transforms/Transforms.h"
+#include "mlir/Dialect/Vector/IR/VectorOps.h"
+#include "mlir/Dialect/Vector/Transforms/VectorRewritePatterns.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+
+#define DEBUG_TYPE "iree-spirv-tile-and-vectorize-reduction"
+
+namespace mlir {
+namespace iree_compiler {
+
+//===----------------------------------------------------------------------===//
+// Reduction tiling patterns
+//===----------------------------------------------------------------------===//
+
+/// Tiles the reduction loops with the first level tile sizes. Parallel loops
+/// are already tiled and distributed to workgroups with the same tile sizes.
+static void populateTilingReductionPatterns(RewritePatternSet &patterns) {
+  auto getTileSizeFn = [](OpBuilder &builder,
+                          Operation *op) -> SmallVector<Value, 4> {
+    auto interfaceOp = cast<PartitionableLoopsInterface>(*op);
+    auto partitionedLoops =
+        interfaceOp.getPartitionableLoops(kNumMaxParallelDims);
+    SmallVector<Value, 4> tileSizes = getTileSizes(builder, op, 0);
+    auto zero = builder.create<arith::ConstantIndexOp>(op->getLoc(), 0);
+    for (unsigned depth : partitionedLoops) {
+      if (depth < tileSizes.size()) tileSizes[depth] = zero;
+    }
+    return tileSizes;
+  };
+
+  auto tilingOptions = linalg::LinalgTilingOptions()
+                           .setLoopType(linalg::LinalgTilingLoopType::Loops)
+                           .setTileSizeComputationFunction(getTileSizeFn);
+
+  MLIRContext *context = patterns.getContext();
+  auto filter = linalg::LinalgTransformationFilter(
+      ArrayRef<StringAttr>{},
+      StringAttr::get(context, getTileReductionMarker()));
+
+  linalg::TilingPatterns<linalg::GenericOp>::insert(patterns, tilingOptions,
+                                                    filter);
+}
+
+//===----------------------------------------------------------------------===//
+// Vectorization patterns
+//===----------------------------------------------------------------------===//
+
+static void populateVectorizationPatterns(RewritePatternSet &patterns) {
+  linalg::LinalgVectorizationOptions opt;
+  linalg::LinalgTransformationFilter f;
+  linalg::VectorizationPatterns<linalg::FillOp, linalg::GenericOp>::insert(
+      patterns, opt, f);
+  vector::populateVectorTransferPermutationMapLoweringPatterns(patterns);
+}
+
+//===----------------------------------------------------------------------===//
+// Main pass
+//===----------------------------------------------------------------------===//
+
+namespace {
+/// Function pass that tiles reduction dimensions of Linalg ops with buffer
+/// semantics and vectorizes them.
+class SPIRVTileAndVectorizeReductionPass
+    : public SPIRVTileAndVectorizeReductionBase<
+          SPIRVTileAndVectorizeReductionPass> {
+ public:
+  SPIRVTileAndVectorizeReductionPass() = default;
+  SPIRVTileAndVectorizeReductionPass(
+      const SPIRVTileAndVectorizeReductionPass &pass) = default;
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<linalg::LinalgDialect, scf::SCFDialect,
+                    vector::VectorDialect>();
+  }
+
+  void runOnOperation() override;
+};
+}  // namespace
+
+void SPIRVTileAndVectorizeReductionPass::runOnOperation() {
+  MLIRContext *context = &getContext();
+  func::FuncOp funcOp = getOperation();
+  if (!isEntryPoint(funcOp)) return;
+
+  {  // Tile reduction dimensions.
+    RewritePatternSet tilingPatterns(context);
+    populateTilingReductionPatterns(tilingPatterns);
+    if (failed(applyPatternsAndFoldGreedily(funcOp,
+                                            std::move(tilingPatterns)))) {
+      funcOp.emitOpError() << "failing in tile reduction";
+      return signalPassFailure();
+    }
+
+    RewritePatternSet canonicalizationPatterns =
+        linalg::getLinalgTilingCanonicalizationPatterns(context);
+    scf::populateSCFForLoopCanonicalizationPatterns(canonicalizationPatterns);
+    if (failed(applyPatternsAndFoldGreedily(
+            funcOp, std::move(canonicalizationPatterns)))) {
+      funcOp.emitOpError() << "failing canonicalizing after tile reduction";
+      return signalPassFailure();
+    }
+
+    LLVM_DEBUG({
+      llvm::dbgs() << "--- After tiling reduction dimensions ---\n";
+      funcOp.print(llvm::dbgs(), OpPrintingFlags().useLocalScope());
+      llvm::dbgs() << "\n\n";
+    });
+  }
+
+  {  // Vectorize without unrolling to native vector sizes; the vectors are
+     // distributed onto subgroup invocations afterwards.
+    RewritePatternSet vectorizationPatterns(context);
+    populateVectorizationPatterns(vectorizationPatterns);
+    if (failed(applyPatternsAndFoldGreedily(
+            funcOp, std::move(vectorizationPatterns)))) {
+      return signalPassFailure();
+    }
+
+    LLVM_DEBUG({
+      llvm::dbgs() << "--- After vectorization ---\n";
+      funcOp.print(llvm::dbgs(), OpPrintingFlags().useLocalScope());
+      llvm::dbgs() << "\n\n";
+    });
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// Pass entry point and registration
+//===----------------------------------------------------------------------===//
+
+std::unique_ptr<OperationPass<func::FuncOp>>
+createSPIRVTileAndVectorizeReductionPass() {
+  return std::make_unique<SPIRVTileAndVectorizeReductionPass>();
+}
+
+}  // namespace iree_compiler
+}  // namespace mlir
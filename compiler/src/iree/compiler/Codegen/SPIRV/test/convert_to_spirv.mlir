@@ -253,3 +253,36 @@ hal.executable private @interface_wg_count {
 //       CHECK:     %[[ADDR2:.+]] = spv.mlir.addressof @[[WGCOUNT]]
 //       CHECK:     %[[VAL2:.+]] = spv.Load "Input" %[[ADDR2]]
 //       CHECK:     %[[WGIDY:.+]] = spv.CompositeExtract %[[VAL2]][1 : i32]
+
+// -----
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>,
+    #hal.descriptor_set.binding<1, storage_buffer>
+  ]>
+]>
+hal.executable private @read_only_binding {
+  hal.executable.variant @vulkan, target = <"vulkan-spirv", "vulkan-spirv-fb", {
+      spv.target_env = #spv.target_env<#spv.vce<v1.3, [Shader], []>, ARM:IntegratedGPU, #spv.resource_limits<>>}> {
+    hal.executable.export @read_only_binding layout(#executable_layout) attributes {
+      workgroup_size = [32: index, 1: index, 1: index]
+    }
+    builtin.module {
+      func.func @read_only_binding() {
+        %c0 = arith.constant 0 : index
+        %0 = hal.interface.binding.subspan set(0) binding(0) type(storage_buffer) : memref<16xf32>
+        %1 = hal.interface.binding.subspan set(0) binding(1) type(storage_buffer) : memref<16xf32>
+        %2 = memref.load %0[%c0] : memref<16xf32>
+        memref.store %2, %1[%c0] : memref<16xf32>
+        return
+      }
+    }
+  }
+}
+
+// Bindings never written are decorated as NonWritable on mobile GPUs.
+
+// CHECK-LABEL: spv.module
+//       CHECK:   spv.GlobalVariable @__resource_var_0_0_ bind(0, 0) {non_writable} : !spv.ptr
+//       CHECK:   spv.GlobalVariable @__resource_var_0_1_ bind(0, 1) : !spv.ptr
@@ -184,6 +184,22 @@ bool isReadOnly(Value v) {
 // Utility functions to set configurations
 //===----------------------------------------------------------------------===//
 
+unsigned getWorkgroupSwizzleLogTile(int64_t workgroupCountY,
+                                    int64_t rhsSizeInBytes,
+                                    int64_t cacheSizeInBytes) {
+  // Larger tiles stop helping once the column blocks get taller than the
+  // number of workgroups that run concurrently.
+  const unsigned kMaxSwizzleLogTile = 3;
+  if (cacheSizeInBytes <= 0) return 0;
+  unsigned logTile = 0;
+  while (logTile < kMaxSwizzleLogTile &&
+         (rhsSizeInBytes >> logTile) > cacheSizeInBytes &&
+         (int64_t{2} << logTile) <= workgroupCountY) {
+    ++logTile;
+  }
+  return logTile;
+}
+
 /// Returns the first of `exprs` which is of the type `T`.
 template <typename T>
 static AffineExpr getAffineExprOfType(ArrayRef<AffineExpr> exprs) {
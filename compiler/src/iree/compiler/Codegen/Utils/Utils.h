@@ -75,6 +75,18 @@ bool isReadOnly(Value v);
 // Utility functions to set configurations
 //===----------------------------------------------------------------------===//
 
+/// Returns log2 of the tile to swizzle the workgroup IDs with (see
+/// `createWorkGroupSwizzle`) for a matmul-like op distributed on
+/// `workgroupCountY` rows of workgroups, where each row of workgroups reads the
+/// whole right-hand side operand of `rhsSizeInBytes` bytes. When the operand
+/// doesn't fit in `cacheSizeInBytes`, issuing the workgroups row by row evicts
+/// it before the next row can reuse it; the swizzle walks the workgroups in
+/// column blocks instead so that each block only needs a slice of it. Returns
+/// 0, i.e. no swizzle, if the operand fits or the cache size is unknown.
+unsigned getWorkgroupSwizzleLogTile(int64_t workgroupCountY,
+                                    int64_t rhsSizeInBytes,
+                                    int64_t cacheSizeInBytes);
+
 /// Information about a tiled and distributed loop.
 ///
 /// Right now distribution is happening as the same time when we tile the linalg
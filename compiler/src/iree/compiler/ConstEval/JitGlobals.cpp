@@ -4,12 +4,15 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <chrono>
+
 #include "iree/compiler/ConstEval/PassDetail.h"
 #include "iree/compiler/ConstEval/Passes.h"
 #include "iree/compiler/ConstEval/Runtime.h"
 #include "iree/compiler/Pipelines/Pipelines.h"
 #include "iree/compiler/Utils/PassUtils.h"
 #include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/SetVector.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/raw_ostream.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
@@ -143,96 +146,186 @@ struct JitGlobalsPass : public JitGlobalsBase<JitGlobalsPass> {
 
   void runOnOperation() override {
     auto outerModule = getOperation();
+    auto startTime = std::chrono::steady_clock::now();
+
+    // Partition the initializers we are able to evaluate into batches. Each
+    // batch is compiled into its own program and its results are folded into
+    // the module before the next one is started; this bounds the memory
+    // required and lets us stop when running out of time.
+    SmallVector<SmallVector<IREE::Util::InitializerOp>> batches;
+    SmallVector<IREE::Util::InitializerOp> currentBatch;
+    // Globals whose values are only known at runtime as their initializers
+    // could not be evaluated.
+    DenseSet<StringAttr> runtimeGlobals;
     SymbolTable outerSymbolTable(outerModule);
+    for (auto initializerOp : outerModule.getOps<IREE::Util::InitializerOp>()) {
+      SmallVector<StringAttr> storedGlobals;
+      if (!isEvaluable(initializerOp, outerSymbolTable, runtimeGlobals,
+                       storedGlobals)) {
+        runtimeGlobals.insert(storedGlobals.begin(), storedGlobals.end());
+        continue;
+      }
+      currentBatch.push_back(initializerOp);
+      if (batchSize > 0 &&
+          static_cast<int64_t>(currentBatch.size()) >= batchSize) {
+        batches.push_back(std::move(currentBatch));
+        currentBatch.clear();
+      }
+    }
+    if (!currentBatch.empty()) batches.push_back(std::move(currentBatch));
+
+    bool modified = false;
+    for (auto &batch : batches) {
+      if (maxEvalTimeMs > 0) {
+        auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             std::chrono::steady_clock::now() - startTime)
+                             .count();
+        if (elapsedMs >= maxEvalTimeMs) {
+          LLVM_DEBUG(dbgs() << "JitGlobals: out of time after " << elapsedMs
+                            << "ms; leaving remaining initializers\n");
+          break;
+        }
+      }
+      if (failed(evaluateBatch(outerModule, outerSymbolTable, batch))) {
+        return signalPassFailure();
+      }
+      modified = true;
+    }
+
+    // Signal any outer fixed point iterator that we have modified
+    // globals and need another pass.
+    if (modified) {
+      signalFixedPointModified(outerModule);
+    }
+  }
+
+  // Returns true if |initializerOp| can be evaluated at compile time. All
+  // globals it stores are added to |storedGlobals|.
+  bool isEvaluable(IREE::Util::InitializerOp initializerOp,
+                   SymbolTable &symbolTable,
+                   const DenseSet<StringAttr> &runtimeGlobals,
+                   SmallVectorImpl<StringAttr> &storedGlobals) {
+    bool isEvaluable = true;
+    initializerOp.walk([&](Operation *op) {
+      if (isa<IREE::Util::GlobalLoadIndirectOp,
+              IREE::Util::GlobalStoreIndirectOp>(op)) {
+        isEvaluable = false;
+        return;
+      }
+      auto accessorOp = dyn_cast<IREE::Util::GlobalAccessorOpInterface>(op);
+      if (!accessorOp) return;
+      StringAttr globalSymbol = accessorOp.getGlobalRefAttr().getAttr();
+      // Values only known at runtime can't be used and stores would be
+      // reordered with those of the runtime initializers.
+      if (runtimeGlobals.contains(globalSymbol)) isEvaluable = false;
+      if (!isa<IREE::Util::GlobalStoreOp>(op)) return;
+      storedGlobals.push_back(globalSymbol);
+
+      auto globalOp = symbolTable.lookup<IREE::Util::GlobalOp>(globalSymbol);
+      Type type = globalOp ? globalOp.type() : Type{};
+      if (!type || !CompiledBinary::isSupportedResultType(type)) {
+        LLVM_DEBUG(dbgs() << "JitGlobals: unsupported global type " << type
+                          << "\n");
+        isEvaluable = false;
+      } else if (maxGlobalSize > 0) {
+        auto size = getStorageSize(type);
+        if (!size || *size > maxGlobalSize) {
+          LLVM_DEBUG(dbgs() << "JitGlobals: global @" << globalSymbol
+                            << " is over the size budget\n");
+          isEvaluable = false;
+        }
+      }
+    });
+    return isEvaluable;
+  }
+
+  // Returns the size in bytes of an attribute of |type| or None if dynamic.
+  static Optional<int64_t> getStorageSize(Type type) {
+    auto shapedType = type.dyn_cast<ShapedType>();
+    Type elementType = shapedType ? shapedType.getElementType() : type;
+    if (shapedType && !shapedType.hasStaticShape()) return llvm::None;
+    // i1 values are stored as bytes.
+    int64_t elementSize =
+        llvm::divideCeil(elementType.getIntOrFloatBitWidth(), 8);
+    return shapedType ? shapedType.getNumElements() * elementSize
+                      : elementSize;
+  }
+
+  // Compiles and runs |initializerOps| and replaces them with the initial
+  // values of the globals they store.
+  LogicalResult evaluateBatch(ModuleOp outerModule,
+                              SymbolTable &outerSymbolTable,
+                              ArrayRef<IREE::Util::InitializerOp>
+                                  initializerOps) {
     OpBuilder builder = OpBuilder::atBlockEnd(outerModule.getBody());
     auto innerModule = builder.create<ModuleOp>(outerModule.getLoc());
     ProgramExtractor extractor(outerModule, innerModule);
-    SmallVector<Operation *> pruneOps;
 
     // Import initializers.
-    for (auto childOp : outerModule.getOps<IREE::Util::InitializerOp>()) {
-      extractor.importOperation(childOp);
-      pruneOps.push_back(childOp);
+    SetVector<StringAttr> storedGlobals;
+    for (auto initializerOp : initializerOps) {
+      extractor.importOperation(initializerOp);
+      initializerOp.walk([&](IREE::Util::GlobalStoreOp storeOp) {
+        storedGlobals.insert(storeOp.getGlobalRefAttr().getAttr());
+      });
     }
 
     // Transitively import any dependencies.
     if (failed(extractor.importDependencies())) {
-      signalPassFailure();
+      innerModule.erase();
+      return failure();
     }
 
-    // Find any globals that we pulled in which lack an initializer. These
-    // are the ones we will try to eval. Stash {func_symbol, global_symbol}
-    // pairs for later.
-    SmallVector<std::pair<StringAttr, StringAttr>> uninitializedGlobals;
-    for (Operation &childOp : *innerModule.getBody()) {
-      auto globalOp = llvm::dyn_cast<IREE::Util::GlobalOp>(childOp);
-      if (!globalOp) continue;
-      if (globalOp.getInitialValueAttr()) continue;
-
-      // Only generate an accessor for types our runtime bridge knows how to
-      // handle.
-      Type type = globalOp.type();
-      if (!CompiledBinary::isSupportedResultType(type)) {
-        LLVM_DEBUG(dbgs() << "JitGlobals: unsupported global type " << type);
-        continue;
-      }
-
-      StringAttr funcSymbol = extractor.createAccessor(globalOp);
-      uninitializedGlobals.emplace_back(funcSymbol, globalOp.sym_nameAttr());
+    // Generate an accessor for each global stored by the batch. These are
+    // the ones we will eval.
+    SmallVector<std::string> funcSymbols;
+    for (StringAttr globalSymbol : storedGlobals) {
+      auto globalOp = cast<IREE::Util::GlobalOp>(
+          SymbolTable::lookupSymbolIn(innerModule, globalSymbol));
+      funcSymbols.push_back(extractor.createAccessor(globalOp).str());
     }
 
     // Early exit without compiling if no entry-points (this is not just an
     // optimization: the low level compiler will fail on an empty module).
-    if (uninitializedGlobals.empty()) {
+    if (funcSymbols.empty()) {
       LLVM_DEBUG(dbgs() << "Not JIT'ing globals: no undefined globals found\n");
       innerModule.erase();
-      return;
+      for (auto initializerOp : initializerOps) initializerOp.erase();
+      return success();
     }
 
     // Run the IREE compiler, transforming the inner module into a vm.module.
-    LLVM_DEBUG(dbgs() << "JIT'ing " << uninitializedGlobals.size()
-                      << " uninitialized globals\n");
+    LLVM_DEBUG(dbgs() << "JIT'ing " << funcSymbols.size() << " globals\n");
     if (failed(runPipeline(compilePipeline, innerModule))) {
-      return signalPassFailure();
+      return failure();
     }
 
     // Generate a binary.
-    InMemoryCompiledBinary binary;
+    MappedFileCompiledBinary binary;
     if (failed(binary.translateFromModule(innerModule))) {
-      return signalPassFailure();
+      return failure();
     }
 
     // Kill the temporary program we constructed.
     innerModule.erase();
 
-    bool modified = false;
-    for (auto &it : uninitializedGlobals) {
-      StringAttr funcSymbol = it.first;
-      StringAttr globalSymbol = it.second;
-      auto targetGlobal = llvm::cast<IREE::Util::GlobalOp>(
-          outerSymbolTable.lookup(globalSymbol));
-      Location loc = targetGlobal->getLoc();
-
-      Attribute value =
-          binary.invokeNullaryAsAttribute(loc, funcSymbol.strref());
-      if (!value) {
-        return signalPassFailure();
-      }
-
-      modified = true;
-      targetGlobal.setInitialValue(value);
+    SmallVector<StringRef> funcNames(funcSymbols.begin(), funcSymbols.end());
+    SmallVector<Attribute> values;
+    if (failed(binary.invokeNullaryAsAttributes(outerModule.getLoc(),
+                                                funcNames, values))) {
+      return failure();
     }
-
-    // Delete any ops noted for pruning.
-    for (Operation *op : pruneOps) {
-      op->erase();
+    for (auto it : llvm::zip(storedGlobals, values)) {
+      auto targetGlobal =
+          outerSymbolTable.lookup<IREE::Util::GlobalOp>(std::get<0>(it));
+      targetGlobal.setInitialValue(std::get<1>(it));
     }
 
-    // Signal any outer fixed point iterator that we have modified
-    // globals and need another pass.
-    if (modified) {
-      signalFixedPointModified(outerModule);
+    // The initializers are now fully evaluated.
+    for (auto initializerOp : initializerOps) {
+      initializerOp.erase();
     }
+    return success();
   }
 
   std::shared_ptr<CompileOptions> options;
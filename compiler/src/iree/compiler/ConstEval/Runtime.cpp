@@ -9,8 +9,10 @@
 #include "iree/compiler/Dialect/VM/Target/Bytecode/BytecodeModuleTarget.h"
 #include "iree/hal/drivers/local_task/registration/driver_module.h"
 #include "iree/modules/hal/module.h"
+#include "llvm/Support/FileSystem.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/Threading.h"
 
 namespace mlir {
 namespace iree_compiler {
@@ -156,6 +158,43 @@ Attribute CompiledBinary::invokeNullaryAsAttribute(Location loc,
   return result;
 }
 
+LogicalResult CompiledBinary::invokeNullaryAsAttributes(
+    Location loc, ArrayRef<StringRef> names,
+    SmallVectorImpl<Attribute>& results) {
+  // Invocations share the context and happen one at a time. They only return
+  // references to the evaluated buffers so the bulk of the work is the
+  // conversion below.
+  SmallVector<iree::vm::ref<iree_vm_list_t>> outputLists;
+  outputLists.reserve(names.size());
+  for (StringRef name : names) {
+    if (failed(invokeNullary(
+            loc, name, [&](iree_vm_list_t* outputs) -> LogicalResult {
+              if (iree_vm_list_size(outputs) != 1) {
+                return emitError(loc)
+                       << "expected 1 result for func " << name << " got "
+                       << iree_vm_list_size(outputs);
+              }
+              outputLists.push_back(iree::vm::retain_ref(outputs));
+              return success();
+            }))) {
+      return failure();
+    }
+  }
+
+  // Read back and convert each result on its own thread. Attribute creation
+  // is thread-safe and the buffers are independent.
+  results.resize(names.size());
+  return failableParallelForEach(
+      loc.getContext(), llvm::seq<size_t>(0, names.size()),
+      [&](size_t i) -> LogicalResult {
+        iree_vm_variant_t variant = iree_vm_variant_empty();
+        IREE_CHECK_OK(
+            iree_vm_list_get_variant(outputLists[i].get(), 0, &variant));
+        results[i] = convertVariantToAttribute(loc, variant);
+        return success(results[i] != nullptr);
+      });
+}
+
 bool CompiledBinary::isSupportedResultType(Type type) {
   // TODO(laurenzo): Not currently supported. VMVX would need to support these
   // and today it doesn't. We could use alternative backends (LLVM CPU/etc) if
@@ -302,6 +341,52 @@ LogicalResult InMemoryCompiledBinary::translateFromModule(
   return success();
 }
 
+MappedFileCompiledBinary::~MappedFileCompiledBinary() {
+  deinitialize();
+  buffer.reset();
+  if (!path.empty()) llvm::sys::fs::remove(path);
+}
+
+LogicalResult MappedFileCompiledBinary::translateFromModule(
+    mlir::ModuleOp moduleOp) {
+  SmallString<128> tempPath;
+  int fd = -1;
+  if (auto error = llvm::sys::fs::createTemporaryFile("iree-consteval", "vmfb",
+                                                      fd, tempPath)) {
+    return moduleOp.emitError()
+           << "failed to create temporary file for jit-eval module: "
+           << error.message();
+  }
+  path = tempPath.str().str();
+  {
+    llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+    iree_compiler::IREE::VM::BytecodeTargetOptions targetOptions;
+    if (failed(iree_compiler::IREE::VM::translateModuleToBytecode(
+            moduleOp, targetOptions, os))) {
+      return failure();
+    }
+    os.close();
+    if (os.has_error()) {
+      auto error = os.error();
+      os.clear_error();
+      return moduleOp.emitError() << "failed to write jit-eval module: "
+                                  << error.message();
+    }
+  }
+
+  // Map the file back in; the data stays valid until the buffer is reset.
+  auto fileOr = llvm::MemoryBuffer::getFile(path, /*IsText=*/false,
+                                            /*RequiresNullTerminator=*/false);
+  if (!fileOr) {
+    return moduleOp.emitError() << "failed to map jit-eval module: "
+                                << fileOr.getError().message();
+  }
+  buffer = std::move(*fileOr);
+  initialize(const_cast<char*>(buffer->getBufferStart()),
+             buffer->getBufferSize());
+  return success();
+}
+
 Runtime::Runtime() {
   IREE_CHECK_OK(
       iree_hal_driver_registry_allocate(iree_allocator_system(), &registry));
@@ -12,6 +12,7 @@
 #include "iree/vm/api.h"
 #include "iree/vm/bytecode_module.h"
 #include "iree/vm/ref_cc.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "mlir/IR/BuiltinAttributes.h"
 #include "mlir/IR/BuiltinOps.h"
 
@@ -36,6 +37,13 @@ class CompiledBinary {
   // as an Attribute.
   Attribute invokeNullaryAsAttribute(Location loc, StringRef name);
 
+  // Invokes each nullary function in |names| and returns their (presumed
+  // single) results as Attributes. Functions are invoked in order and their
+  // results are then converted to attributes in parallel.
+  LogicalResult invokeNullaryAsAttributes(Location loc,
+                                          ArrayRef<StringRef> names,
+                                          SmallVectorImpl<Attribute>& results);
+
   // Whether the given type is supported in *AsAttribute methods.
   static bool isSupportedResultType(Type type);
 
@@ -64,6 +72,19 @@ class InMemoryCompiledBinary : public CompiledBinary {
   std::string binary;
 };
 
+// A compiled binary written to a temporary file and mapped back in. The output
+// is streamed to disk and the constant data only occupies memory while paged
+// in, which avoids holding an additional copy of large constants in memory.
+class MappedFileCompiledBinary : public CompiledBinary {
+ public:
+  LogicalResult translateFromModule(mlir::ModuleOp moduleOp);
+  ~MappedFileCompiledBinary() override;
+
+ private:
+  std::string path;
+  std::unique_ptr<llvm::MemoryBuffer> buffer;
+};
+
 // Simple wrapper around IREE runtime library sufficient for loading and
 // executing simple programs.
 class Runtime {
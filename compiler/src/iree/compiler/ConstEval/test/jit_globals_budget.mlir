@@ -0,0 +1,60 @@
+// RUN: iree-opt --split-input-file --iree-consteval-jit-globals="max-global-size=16 batch-size=1" %s | FileCheck %s
+
+// CHECK-LABEL: @over_size_budget
+module @over_size_budget {
+  // CHECK: util.global private @small = dense<2> : tensor<2xi32>
+  util.global private @small : tensor<2xi32>
+  // CHECK: util.global private @large : tensor<5x6xf32>
+  util.global private @large : tensor<5x6xf32>
+  // CHECK: util.global private @large_user : tensor<2xi32>
+  util.global private @large_user : tensor<2xi32>
+  util.initializer {
+    %cst = arith.constant dense<[2, 2]> : tensor<2xi32>
+    util.global.store %cst, @small : tensor<2xi32>
+    util.initializer.return
+  }
+  // CHECK: util.initializer {
+  // CHECK:   util.global.store %{{.+}}, @large
+  util.initializer {
+    %cst = arith.constant dense<4.0> : tensor<5x6xf32>
+    util.global.store %cst, @large : tensor<5x6xf32>
+    util.initializer.return
+  }
+  // Depends on a value that is only known at runtime.
+  // CHECK: util.initializer {
+  // CHECK:   util.global.load @large
+  // CHECK:   util.global.store %{{.+}}, @large_user
+  util.initializer {
+    %large = util.global.load @large : tensor<5x6xf32>
+    %c0 = arith.constant 0 : index
+    %dim = tensor.dim %large, %c0 : tensor<5x6xf32>
+    %dim_i32 = arith.index_cast %dim : index to i32
+    %splat = tensor.splat %dim_i32 : tensor<2xi32>
+    util.global.store %splat, @large_user : tensor<2xi32>
+    util.initializer.return
+  }
+}
+
+// -----
+
+// Later batches see the values evaluated by earlier ones.
+
+// CHECK-LABEL: @batched
+module @batched {
+  // CHECK: util.global private @first = dense<2> : tensor<2xi32>
+  util.global private @first : tensor<2xi32>
+  // CHECK: util.global private @second = dense<4> : tensor<2xi32>
+  util.global private @second : tensor<2xi32>
+  util.initializer {
+    %cst = arith.constant dense<[2, 2]> : tensor<2xi32>
+    util.global.store %cst, @first : tensor<2xi32>
+    util.initializer.return
+  }
+  // CHECK-NOT: util.initializer
+  util.initializer {
+    %first = util.global.load @first : tensor<2xi32>
+    %sum = arith.addi %first, %first : tensor<2xi32>
+    util.global.store %sum, @second : tensor<2xi32>
+    util.initializer.return
+  }
+}
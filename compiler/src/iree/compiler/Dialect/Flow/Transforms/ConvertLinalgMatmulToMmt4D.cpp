@@ -8,8 +8,10 @@
 
 #include "iree/compiler/Dialect/Flow/Transforms/PassDetail.h"
 #include "iree/compiler/Dialect/Flow/Transforms/Passes.h"
+#include "iree/compiler/Dialect/HAL/IR/HALTypes.h"
 #include "iree/compiler/Utils/CustomKernelsTargetInfo.h"
 #include "llvm/ADT/Optional.h"
+#include "llvm/ADT/StringExtras.h"
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
 #include "mlir/Dialect/Linalg/IR/Linalg.h"
 #include "mlir/Dialect/Tensor/Utils/Utils.h"
@@ -365,6 +367,14 @@ LinalgMatmulOpToLinalgMmt4DOpPattern::chooseTileParams(Value lhs, Value rhs,
                                   "f32*f32->f32, aarch64");
     }
   }
+  if (targetInfo.is(CustomKernelTargetArch::X86_64)) {
+    if (lhsElemType.isSignlessInteger(8) && rhsElemType.isSignlessInteger(8) &&
+        accElemType.isSignlessInteger(32) &&
+        targetInfo.has(CustomKernelTargetFeature::X86_64Avx512Vnni)) {
+      return chooseMatMulOrMatVec({8, 2, 16}, {8, 2, 1},
+                                  "i8*i8->i32, x86_64 +avx512vnni");
+    }
+  }
   // enableGenericSlow is meant for tests only. It's just a way to get some
   // test coverage for Mmt4d where we do not currently have kernels.
   if (enableGenericSlow) {
@@ -419,6 +429,51 @@ struct FoldFillGenericOpPattern : public OpRewritePattern<linalg::GenericOp> {
   }
 };
 
+// Infers |targetInfo| from the executable targets the parent module is being
+// compiled for. The packed layout is materialized once for all targets so
+// inference only succeeds if every target is an LLVM CPU target and they all
+// agree on the architecture and the features we care about.
+static LogicalResult inferTargetInfoFromDeviceTargets(
+    Operation *op, CustomKernelsTargetInfo &targetInfo) {
+  targetInfo = CustomKernelsTargetInfo();
+  auto targetAttrs = IREE::HAL::DeviceTargetAttr::lookupExecutableTargets(op);
+  if (targetAttrs.empty()) return failure();
+  Optional<std::pair<std::string, std::string>> archAndFeatures;
+  for (auto targetAttr : targetAttrs) {
+    if (targetAttr.getBackend().getValue() != "llvm") return failure();
+    auto config = targetAttr.getConfiguration();
+    if (!config) return failure();
+    auto tripleAttr = config.getAs<StringAttr>("target_triple");
+    auto cpuFeaturesAttr = config.getAs<StringAttr>("cpu_features");
+    if (!tripleAttr || !cpuFeaturesAttr) return failure();
+
+    // Target CPU features contain many entries we don't have kernels for
+    // (+neon, +v8.2a, etc) so only keep the ones that influence the tiling.
+    StringRef archName = tripleAttr.getValue().split('-').first;
+    SmallVector<StringRef> allFeatures;
+    cpuFeaturesAttr.getValue().split(allFeatures, ',');
+    SmallVector<StringRef> features;
+    if (archName == "aarch64") {
+      for (auto feature : allFeatures) {
+        if (feature == "+dotprod" || feature == "+i8mm") {
+          features.push_back(feature);
+        }
+      }
+    } else if (archName == "x86_64") {
+      for (auto feature : allFeatures) {
+        if (feature == "+avx512bw" || feature == "+avx512vnni") {
+          features.push_back(feature);
+        }
+      }
+    }
+    auto current = std::make_pair(archName.str(), llvm::join(features, ","));
+    if (archAndFeatures && *archAndFeatures != current) return failure();
+    archAndFeatures = current;
+  }
+  return ParseCustomKernelsTargetInfo(archAndFeatures->first,
+                                      archAndFeatures->second, targetInfo);
+}
+
 class ConvertLinalgMatmulToMmt4DPass final
     : public ConvertLinalgMatmulToMmt4DBase<ConvertLinalgMatmulToMmt4DPass> {
  public:
@@ -436,10 +491,18 @@ class ConvertLinalgMatmulToMmt4DPass final
 
   void runOnOperation() override {
     MLIRContext *context = &getContext();
+    // Explicitly specified targets take precedence over inferred ones.
+    CustomKernelsTargetInfo opTargetInfo = targetInfo;
+    if (inferTarget && opTargetInfo.is(CustomKernelTargetArch::None) &&
+        failed(inferTargetInfoFromDeviceTargets(getOperation(),
+                                                opTargetInfo))) {
+      opTargetInfo = CustomKernelsTargetInfo();
+    }
     // Main pattern.
     {
       RewritePatternSet patterns(&getContext());
-      patterns.insert<LinalgMatmulOpToLinalgMmt4DOpPattern>(context, targetInfo,
+      patterns.insert<LinalgMatmulOpToLinalgMmt4DOpPattern>(context,
+                                                            opTargetInfo,
                                                             enableGenericSlow);
       if (failed(applyPatternsAndFoldGreedily(getOperation(),
                                               std::move(patterns)))) {
@@ -229,6 +229,12 @@ class DeduplicateExecutablesPass
 
       for (int j = 0; j < i; ++j) {
         auto referenceExecutableOp = executableOps[j];
+        // Dialect attributes such as the objects linked into the executable
+        // must match as well as the bodies.
+        if (!llvm::equal(duplicateExecutableOp->getDialectAttrs(),
+                         referenceExecutableOp->getDialectAttrs())) {
+          continue;
+        }
         if (!isStructurallyEquivalentTo(duplicateExecutableOp.body(),
                                         referenceExecutableOp.body())) {
           continue;
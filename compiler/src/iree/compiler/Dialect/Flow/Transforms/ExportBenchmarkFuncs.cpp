@@ -14,29 +14,169 @@
 #include "iree/compiler/Dialect/Util/Analysis/Explorer.h"
 #include "iree/compiler/Dialect/Util/IR/UtilDialect.h"
 #include "iree/compiler/Dialect/Util/IR/UtilOps.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/BlockAndValueMapping.h"
 #include "mlir/IR/Builders.h"
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/Pass/Pass.h"
+#include "mlir/Support/FileUtilities.h"
 
 namespace mlir {
 namespace iree_compiler {
 namespace IREE {
 namespace Flow {
 
-// Creates a util.global with a primitive value of |type| initialized to zeros.
+// Returns the value of the dict entry |key| in the header of a .npy file, e.g.
+// `'<f4'` for `descr` in `{'descr': '<f4', 'fortran_order': False, ...}`.
+static StringRef getNpyHeaderValue(StringRef header, StringRef key) {
+  size_t keyPos = header.find(("'" + key + "':").str());
+  if (keyPos == StringRef::npos) return {};
+  StringRef value = header.drop_front(keyPos + key.size() + 3).ltrim();
+  if (value.consume_front("(")) {
+    return value.take_until([](char c) { return c == ')'; });
+  }
+  return value.take_until([](char c) { return c == ',' || c == '}'; }).trim();
+}
+
+// Loads the contents of the NumPy .npy file at |path| as the value of a static
+// |tensorType|. The file must hold a C-ordered little-endian array with the
+// same shape and an element type of the same kind and width.
+static FailureOr<DenseElementsAttr> loadNpyFile(StringRef path,
+                                                RankedTensorType tensorType,
+                                                Location loc) {
+  std::string error;
+  auto file = mlir::openInputFile(path, &error);
+  if (!file) {
+    mlir::emitError(loc) << "unable to open benchmark input " << path << ": "
+                         << error;
+    return failure();
+  }
+  auto fail = [&](const Twine& message) -> FailureOr<DenseElementsAttr> {
+    mlir::emitError(loc) << "invalid benchmark input " << path << ": "
+                         << message;
+    return failure();
+  };
+
+  // Magic `\x93NUMPY`, a major and minor version and the header length as a
+  // 2 byte (version 1) or 4 byte (version 2+) little-endian value.
+  StringRef contents = file->getBuffer();
+  if (contents.size() < 10 || !contents.startswith("\x93NUMPY")) {
+    return fail("not a .npy file");
+  }
+  uint8_t majorVersion = contents[6];
+  size_t headerOffset = majorVersion == 1 ? 10 : 12;
+  if (contents.size() < headerOffset) return fail("truncated");
+  size_t headerLength =
+      majorVersion == 1
+          ? llvm::support::endian::read16le(contents.data() + 8)
+          : llvm::support::endian::read32le(contents.data() + 8);
+  if (contents.size() < headerOffset + headerLength) {
+    return fail("truncated header");
+  }
+  StringRef header = contents.substr(headerOffset, headerLength);
+  StringRef data = contents.drop_front(headerOffset + headerLength);
+
+  if (getNpyHeaderValue(header, "fortran_order") != "False") {
+    return fail("only C-ordered arrays are supported");
+  }
+
+  SmallVector<int64_t> shape;
+  StringRef shapeStr = getNpyHeaderValue(header, "shape");
+  SmallVector<StringRef> dims;
+  shapeStr.split(dims, ',', /*MaxSplit=*/-1, /*KeepEmpty=*/false);
+  for (StringRef dim : dims) {
+    int64_t size = 0;
+    if (dim.trim().getAsInteger(10, size)) {
+      return fail("malformed shape (" + shapeStr + ")");
+    }
+    shape.push_back(size);
+  }
+  if (ArrayRef<int64_t>(shape) != tensorType.getShape()) {
+    mlir::emitError(loc) << "benchmark input " << path << " shape ("
+                         << shapeStr << ") does not match " << tensorType;
+    return failure();
+  }
+
+  // `descr` is a quoted byte order, kind and byte width like '<f4' or '|b1'.
+  StringRef descr = getNpyHeaderValue(header, "descr").trim("'");
+  Type elementType = tensorType.getElementType();
+  int64_t elementBytes = 0;
+  if (descr.size() < 3 || descr.drop_front(2).getAsInteger(10, elementBytes)) {
+    return fail("malformed dtype '" + descr + "'");
+  }
+  char kind = descr[1];
+  bool kindMatches = false;
+  if (elementType.isInteger(1)) {
+    kindMatches = kind == 'b';
+  } else if (elementType.isa<FloatType>()) {
+    kindMatches = kind == 'f';
+  } else if (elementType.isa<IntegerType>()) {
+    kindMatches = kind == 'i' || kind == 'u';
+  }
+  if (!kindMatches ||
+      elementBytes != std::max(1u, elementType.getIntOrFloatBitWidth() / 8)) {
+    mlir::emitError(loc) << "benchmark input " << path << " dtype '" << descr
+                         << "' does not match " << elementType;
+    return failure();
+  }
+  if (elementBytes > 1 &&
+      (descr[0] == '>' ||
+       llvm::support::endian::system_endianness() != llvm::support::little)) {
+    return fail("only little-endian data is supported");
+  }
+  int64_t expectedSize = tensorType.getNumElements() * elementBytes;
+  if (static_cast<int64_t>(data.size()) != expectedSize) {
+    return fail("expected " + Twine(expectedSize) + " bytes of data but got " +
+                Twine(data.size()));
+  }
+
+  // i1 is bit-packed in DenseElementsAttr while NumPy stores a byte each.
+  if (elementType.isInteger(1)) {
+    SmallVector<bool> values;
+    for (char c : data) values.push_back(c != 0);
+    return DenseElementsAttr::get(tensorType, values);
+  }
+  return DenseElementsAttr::getFromRawBuffer(
+      tensorType, ArrayRef<char>(data.data(), data.size()));
+}
+
+// Returns the initial value of a tensor benchmark input of |type|: the
+// contents of the .npy file at |inputPath| if provided and zeros otherwise.
+static FailureOr<Attribute> getInitialValue(StringRef inputPath, Type type,
+                                            Location loc,
+                                            OpBuilder& moduleBuilder) {
+  if (inputPath.empty()) return moduleBuilder.getZeroAttr(type);
+  auto tensorType = type.dyn_cast<RankedTensorType>();
+  if (!tensorType || !tensorType.hasStaticShape()) {
+    mlir::emitError(loc) << "benchmark input " << inputPath
+                         << " can only initialize a static tensor, not "
+                         << type;
+    return failure();
+  }
+  auto attr = loadNpyFile(inputPath, tensorType, loc);
+  if (failed(attr)) return failure();
+  return Attribute(*attr);
+}
+
+// Creates a util.global with a primitive value of |type| initialized to zeros
+// or the contents of |inputPath| if provided.
 // Supports: ints, floats, vectors, and tensors.
 //
 // Example:
 //  util.global @some_fn_arg0 = 4 : i32
 //  util.global @some_fn_arg0 = dense<4> : tensor<4xi32>
 static IREE::Util::GlobalOp createPrimitiveDefaultGlobalOp(
-    std::string name, Location loc, Type type, SymbolTable& symbolTable,
-    OpBuilder& moduleBuilder) {
+    std::string name, Location loc, Type type, StringRef inputPath,
+    SymbolTable& symbolTable, OpBuilder& moduleBuilder) {
   // Get a zero-initialized constant attribute for the type, if supported.
-  auto initialValue = moduleBuilder.getZeroAttr(type);
+  auto initialValueOr = getInitialValue(inputPath, type, loc, moduleBuilder);
+  if (failed(initialValueOr)) return {};
+  auto initialValue = *initialValueOr;
   if (!initialValue) {
     mlir::emitError(loc) << "unsupported function argument type: " << type;
     return {};
@@ -53,10 +193,19 @@ static IREE::Util::GlobalOp createPrimitiveDefaultGlobalOp(
 }
 
 // Creates a util.global of the given |globalType| and initializes a buffer or
-// buffer view as a zeroed |tensorType|.
+// buffer view as a zeroed |tensorType| or with the contents of |inputPath| if
+// provided.
 static IREE::Util::GlobalOp createBufferLikeGlobalOp(
-    std::string name, Location loc, Type globalType, TensorType tensorType,
-    SymbolTable& symbolTable, OpBuilder& moduleBuilder) {
+    std::string name, Location loc, Type globalType,
+    RankedTensorType tensorType, StringRef inputPath, SymbolTable& symbolTable,
+    OpBuilder& moduleBuilder) {
+  DenseElementsAttr inputAttr;
+  if (!inputPath.empty()) {
+    auto attr = loadNpyFile(inputPath, tensorType, loc);
+    if (failed(attr)) return {};
+    inputAttr = *attr;
+  }
+
   // Create !hal.buffer global for the storage buffer or buffer view.
   auto globalOp = moduleBuilder.create<IREE::Util::GlobalOp>(
       loc, name,
@@ -71,14 +220,20 @@ static IREE::Util::GlobalOp createBufferLikeGlobalOp(
   auto initializerOp = moduleBuilder.create<IREE::Util::InitializerOp>(loc);
   auto initializerBuilder =
       OpBuilder::atBlockBegin(initializerOp.addEntryBlock());
-  auto zeroAttr = moduleBuilder.getZeroAttr(tensorType.getElementType());
-  auto zeroOp = initializerBuilder.create<arith::ConstantOp>(loc, zeroAttr);
-  // flow.tensor.splat 0
-  auto splatOp = initializerBuilder.create<IREE::Flow::TensorSplatOp>(
-      loc, tensorType, zeroOp, /*result_dims=*/ValueRange{});
+  Value tensorValue;
+  if (inputAttr) {
+    // arith.constant dense<...>
+    tensorValue = initializerBuilder.create<arith::ConstantOp>(loc, inputAttr);
+  } else {
+    auto zeroAttr = moduleBuilder.getZeroAttr(tensorType.getElementType());
+    auto zeroOp = initializerBuilder.create<arith::ConstantOp>(loc, zeroAttr);
+    // flow.tensor.splat 0
+    tensorValue = initializerBuilder.create<IREE::Flow::TensorSplatOp>(
+        loc, tensorType, zeroOp, /*result_dims=*/ValueRange{});
+  }
   // hal.tensor.export
   auto bufferExportOp = initializerBuilder.create<IREE::HAL::TensorExportOp>(
-      loc, globalOp.type(), splatOp.result());
+      loc, globalOp.type(), tensorValue);
   // util.do_not_optimize (try to prevent optimizations across the export)
   auto dnoOp = initializerBuilder.create<IREE::Util::DoNotOptimizeOp>(
       loc, bufferExportOp.target());
@@ -99,8 +254,8 @@ static IREE::Util::GlobalOp createBufferLikeGlobalOp(
 //  util.global @some_fn_arg0 : !hal.buffer_view
 //  util.initializer { ... }
 static IREE::Util::GlobalOp createImportBufferViewGlobalOp(
-    std::string name, BlockArgument arg, SymbolTable& symbolTable,
-    OpBuilder& moduleBuilder, Explorer& explorer) {
+    std::string name, BlockArgument arg, StringRef inputPath,
+    SymbolTable& symbolTable, OpBuilder& moduleBuilder, Explorer& explorer) {
   auto loc = arg.getLoc();
 
   // Find a hal.tensor.import user.
@@ -123,9 +278,10 @@ static IREE::Util::GlobalOp createImportBufferViewGlobalOp(
     return {};
   }
 
-  // Create the global and initialize it by allocating a zeroed buffer.
+  // Create the global and initialize it by allocating a buffer holding zeros
+  // or the provided input.
   return createBufferLikeGlobalOp(name, loc, arg.getType(), tensorType,
-                                  symbolTable, moduleBuilder);
+                                  inputPath, symbolTable, moduleBuilder);
 }
 
 // Creates a util.global with a buffer initialized to the required storage
@@ -166,33 +322,50 @@ static IREE::Util::GlobalOp createExportBufferGlobalOp(std::string name,
 
   // Create the global and initialize it by allocating a zeroed buffer.
   return createBufferLikeGlobalOp(name, loc, arg.getType(), tensorType,
-                                  symbolTable, moduleBuilder);
+                                  /*inputPath=*/"", symbolTable, moduleBuilder);
+}
+
+// Returns the path of the `<function>_arg<N>.npy` input file provided for |arg|
+// of |funcOp| in |inputsDir| or an empty string if there is none.
+static std::string getInputPath(StringRef inputsDir, mlir::func::FuncOp funcOp,
+                                BlockArgument arg) {
+  if (inputsDir.empty()) return "";
+  SmallString<128> path(inputsDir);
+  llvm::sys::path::append(path, funcOp.getName() + "_arg" +
+                                    std::to_string(arg.getArgNumber()) +
+                                    ".npy");
+  if (!llvm::sys::fs::exists(path)) return "";
+  return std::string(path.str());
 }
 
 static IREE::Util::GlobalOp createDummyInput(const std::string& namePrefix,
                                              BlockArgument arg,
+                                             StringRef inputPath,
                                              SymbolTable& symbolTable,
                                              OpBuilder& moduleBuilder,
                                              Explorer& explorer) {
   std::string name = namePrefix + "_arg" + std::to_string(arg.getArgNumber());
   return TypeSwitch<Type, IREE::Util::GlobalOp>(arg.getType())
       .Case([&](IREE::HAL::BufferViewType type) {
-        return createImportBufferViewGlobalOp(name, arg, symbolTable,
-                                              moduleBuilder, explorer);
+        return createImportBufferViewGlobalOp(name, arg, inputPath,
+                                              symbolTable, moduleBuilder,
+                                              explorer);
       })
       .Case([&](IREE::HAL::BufferType type) {
+        // Output storage is overwritten by the call; inputs don't apply.
         return createExportBufferGlobalOp(name, arg, symbolTable, moduleBuilder,
                                           explorer);
       })
       .Default([&](Type type) {
         return createPrimitiveDefaultGlobalOp(name, arg.getLoc(), type,
-                                              symbolTable, moduleBuilder);
+                                              inputPath, symbolTable,
+                                              moduleBuilder);
       });
 }
 
 static LogicalResult createEntryPointBenchmarkFunc(
     mlir::ModuleOp moduleOp, mlir::func::FuncOp entryFuncOp,
-    Explorer& explorer) {
+    StringRef inputsDir, Explorer& explorer) {
   auto symbolTable = explorer.getSymbolTables().getSymbolTable(moduleOp);
   OpBuilder moduleBuilder(moduleOp.getContext());
   moduleBuilder.setInsertionPointAfter(entryFuncOp);
@@ -204,8 +377,9 @@ static LogicalResult createEntryPointBenchmarkFunc(
   // analysis to find the actual type and initial value.
   SmallVector<IREE::Util::GlobalOp, 4> dummyInputVariableOps;
   for (auto arg : entryFuncOp.getArguments()) {
-    auto dummyVar =
-        createDummyInput(funcName, arg, symbolTable, moduleBuilder, explorer);
+    auto dummyVar = createDummyInput(
+        funcName, arg, getInputPath(inputsDir, entryFuncOp, arg), symbolTable,
+        moduleBuilder, explorer);
     if (!dummyVar) return failure();
     dummyInputVariableOps.push_back(dummyVar);
   }
@@ -251,10 +425,16 @@ static LogicalResult createEntryPointBenchmarkFunc(
 // Clones each exported functions (including those just created) with
 // placeholder constant inputs instead of arguments and removes the exported
 // attribute from the old functions.
-// The input are provided using util.globals.
+// The input are provided using util.globals holding zeros or the
+// representative inputs loaded from |inputsDir|.
 class ExportBenchmarkFuncsPass
     : public ExportBenchmarkFuncsBase<ExportBenchmarkFuncsPass> {
  public:
+  ExportBenchmarkFuncsPass() = default;
+  ExportBenchmarkFuncsPass(std::string inputsDir) {
+    this->inputsDir = std::move(inputsDir);
+  }
+
   void getDependentDialects(DialectRegistry& registry) const override {
     registry.insert<arith::ArithmeticDialect, IREE::Flow::FlowDialect,
                     IREE::HAL::HALDialect, IREE::Util::UtilDialect>();
@@ -276,8 +456,8 @@ class ExportBenchmarkFuncsPass
       }
     }
     for (auto entryFuncOp : entryFuncOps) {
-      if (failed(
-              createEntryPointBenchmarkFunc(moduleOp, entryFuncOp, explorer))) {
+      if (failed(createEntryPointBenchmarkFunc(moduleOp, entryFuncOp,
+                                               inputsDir, explorer))) {
         signalPassFailure();
         return;
       }
@@ -285,9 +465,9 @@ class ExportBenchmarkFuncsPass
   }
 };
 
-std::unique_ptr<OperationPass<mlir::ModuleOp>>
-createExportBenchmarkFuncsPass() {
-  return std::make_unique<ExportBenchmarkFuncsPass>();
+std::unique_ptr<OperationPass<mlir::ModuleOp>> createExportBenchmarkFuncsPass(
+    std::string inputsDir) {
+  return std::make_unique<ExportBenchmarkFuncsPass>(std::move(inputsDir));
 }
 
 }  // namespace Flow
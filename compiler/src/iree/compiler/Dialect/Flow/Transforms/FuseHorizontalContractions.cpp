@@ -0,0 +1,251 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//===- FuseHorizontalContractions.cpp -------------------------------------===//
+//
+// Fuses independent matmuls reading the same LHS into a single matmul over
+// the concatenated RHS operands such that they form a single dispatch.
+//
+//===----------------------------------------------------------------------===//
+
+#include "iree/compiler/Dialect/Flow/Transforms/PassDetail.h"
+#include "iree/compiler/Dialect/Flow/Transforms/Passes.h"
+#include "llvm/ADT/MapVector.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Dialect/Tensor/IR/Tensor.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/Pass/Pass.h"
+
+#define DEBUG_TYPE "iree-flow-fuse-horizontal-contractions"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace Flow {
+namespace {
+
+// Returns the fill |matmulOp| accumulates into, if any. Matmuls are only
+// fused when their accumulators can be recreated as one fill of the result.
+static linalg::FillOp getAccumulatorFill(linalg::MatmulOp matmulOp) {
+  return matmulOp.getOutputOperand(0)->get().getDefiningOp<linalg::FillOp>();
+}
+
+// Returns true if |matmulOp| can be concatenated with others along N.
+static bool isFusionCandidate(linalg::MatmulOp matmulOp) {
+  if (!matmulOp.hasTensorSemantics()) return false;
+  auto lhsType =
+      matmulOp.getInputOperand(0)->get().getType().dyn_cast<RankedTensorType>();
+  auto rhsType =
+      matmulOp.getInputOperand(1)->get().getType().dyn_cast<RankedTensorType>();
+  auto resultType =
+      matmulOp.getResult(0).getType().dyn_cast<RankedTensorType>();
+  if (!lhsType || !rhsType || !resultType) return false;
+  // The results are sliced back out using the shape of the LHS.
+  if (rhsType.isDynamicDim(1) ||
+      resultType.getDimSize(0) != lhsType.getDimSize(0)) {
+    return false;
+  }
+  return getAccumulatorFill(matmulOp) != nullptr;
+}
+
+// Returns the static N dimension of |matmulOp|.
+static int64_t getStaticN(linalg::MatmulOp matmulOp) {
+  auto rhsType = matmulOp.getInputOperand(1)->get().getType();
+  return rhsType.cast<ShapedType>().getDimSize(1);
+}
+
+static bool isSameFillValue(Value lhs, Value rhs) {
+  if (lhs == rhs) return true;
+  Attribute lhsAttr, rhsAttr;
+  return matchPattern(lhs, m_Constant(&lhsAttr)) &&
+         matchPattern(rhs, m_Constant(&rhsAttr)) && lhsAttr == rhsAttr;
+}
+
+// Returns true if |candidateOp| can join |group|: the types and accumulator
+// values must match and no result of the group may be used before
+// |candidateOp| as the fused op is inserted after the last member.
+static bool canJoinGroup(ArrayRef<linalg::MatmulOp> group,
+                         linalg::MatmulOp candidateOp) {
+  auto leaderOp = group.front();
+  auto getElementType = [](Value value) {
+    return value.getType().cast<ShapedType>().getElementType();
+  };
+  if (getElementType(leaderOp.getInputOperand(1)->get()) !=
+          getElementType(candidateOp.getInputOperand(1)->get()) ||
+      getElementType(leaderOp.getResult(0)) !=
+          getElementType(candidateOp.getResult(0))) {
+    return false;
+  }
+  if (!isSameFillValue(getAccumulatorFill(leaderOp).value(),
+                       getAccumulatorFill(candidateOp).value())) {
+    return false;
+  }
+  auto *block = candidateOp->getBlock();
+  for (auto memberOp : group) {
+    for (auto *user : memberOp.getResult(0).getUsers()) {
+      auto *ancestorOp = block->findAncestorOpInBlock(*user);
+      if (ancestorOp && !candidateOp->isBeforeInBlock(ancestorOp)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static OpFoldResult getDim(OpBuilder &builder, Location loc, Value value,
+                           int64_t dim) {
+  auto type = value.getType().cast<RankedTensorType>();
+  if (!type.isDynamicDim(dim)) {
+    return builder.getIndexAttr(type.getDimSize(dim));
+  }
+  return builder.createOrFold<tensor::DimOp>(loc, value, dim);
+}
+
+// Replaces the matmuls in |group| with a single matmul on the concatenation
+// of their RHS operands along N:
+//   %q = linalg.matmul ins(%x, %wq : tensor<?x64xf32>, tensor<64x32xf32>) ...
+//   %k = linalg.matmul ins(%x, %wk : tensor<?x64xf32>, tensor<64x32xf32>) ...
+// ->
+//   %w0 = tensor.insert_slice %wq into %init[0, 0] [64, 32] [1, 1]
+//   %w = tensor.insert_slice %wk into %w0[0, 32] [64, 32] [1, 1]
+//   %qk = linalg.matmul ins(%x, %w : tensor<?x64xf32>, tensor<64x64xf32>) ...
+//   %q = tensor.extract_slice %qk[0, 0] [%m, 32] [1, 1]
+//   %k = tensor.extract_slice %qk[0, 32] [%m, 32] [1, 1]
+// When the RHS operands are constants the concatenation is hoisted out of the
+// program along with the other constant expressions.
+static void fuseGroup(ArrayRef<linalg::MatmulOp> group) {
+  auto leaderOp = group.front();
+  auto lhs = leaderOp.getInputOperand(0)->get();
+  auto rhsElementType = leaderOp.getInputOperand(1)
+                            ->get()
+                            .getType()
+                            .cast<ShapedType>()
+                            .getElementType();
+  auto resultElementType =
+      leaderOp.getResult(0).getType().cast<ShapedType>().getElementType();
+  auto lhsShape = lhs.getType().cast<ShapedType>().getShape();
+  SmallVector<Location> locs;
+  int64_t fusedN = 0;
+  for (auto matmulOp : group) {
+    locs.push_back(matmulOp.getLoc());
+    fusedN += getStaticN(matmulOp);
+  }
+
+  OpBuilder builder(group.back());
+  builder.setInsertionPointAfter(group.back());
+  auto loc = builder.getFusedLoc(locs);
+  auto zero = builder.getIndexAttr(0);
+  auto one = builder.getIndexAttr(1);
+  SmallVector<OpFoldResult> strides = {one, one};
+
+  // Concatenate the RHS operands along N.
+  auto k = getDim(builder, loc, lhs, 1);
+  SmallVector<Value> rhsDynamicSizes;
+  if (auto kValue = k.dyn_cast<Value>()) rhsDynamicSizes.push_back(kValue);
+  Value fusedRhs = builder.create<linalg::InitTensorOp>(
+      loc, rhsDynamicSizes,
+      ArrayRef<int64_t>{lhsShape[1], fusedN}, rhsElementType);
+  SmallVector<int64_t> offsets;
+  int64_t offset = 0;
+  for (auto matmulOp : group) {
+    int64_t n = getStaticN(matmulOp);
+    fusedRhs = builder.create<tensor::InsertSliceOp>(
+        loc, matmulOp.getInputOperand(1)->get(), fusedRhs,
+        ArrayRef<OpFoldResult>{zero, builder.getIndexAttr(offset)},
+        ArrayRef<OpFoldResult>{k, builder.getIndexAttr(n)}, strides);
+    offsets.push_back(offset);
+    offset += n;
+  }
+
+  // Recreate the accumulator for the fused result.
+  auto m = getDim(builder, loc, lhs, 0);
+  SmallVector<Value> resultDynamicSizes;
+  if (auto mValue = m.dyn_cast<Value>()) resultDynamicSizes.push_back(mValue);
+  Value fusedInit = builder.create<linalg::InitTensorOp>(
+      loc, resultDynamicSizes,
+      ArrayRef<int64_t>{lhsShape[0], fusedN}, resultElementType);
+  fusedInit = builder
+                  .create<linalg::FillOp>(
+                      loc, getAccumulatorFill(leaderOp).value(), fusedInit)
+                  .getResult(0);
+  auto fusedOp = builder.create<linalg::MatmulOp>(
+      loc, TypeRange{fusedInit.getType()}, ValueRange{lhs, fusedRhs},
+      ValueRange{fusedInit});
+
+  // Slice the original results back out of the fused one.
+  for (auto it : llvm::zip(group, offsets)) {
+    auto matmulOp = std::get<0>(it);
+    auto result = matmulOp.getResult(0);
+    int64_t n = getStaticN(matmulOp);
+    auto sliceOp = builder.create<tensor::ExtractSliceOp>(
+        matmulOp.getLoc(), result.getType().cast<RankedTensorType>(),
+        fusedOp.getResult(0),
+        ArrayRef<OpFoldResult>{zero, builder.getIndexAttr(std::get<1>(it))},
+        ArrayRef<OpFoldResult>{m, builder.getIndexAttr(n)}, strides);
+    result.replaceAllUsesWith(sliceOp.getResult());
+    auto fillOp = getAccumulatorFill(matmulOp);
+    matmulOp.erase();
+    if (fillOp->use_empty()) fillOp.erase();
+  }
+}
+
+// Fuses the matmuls in |block| sharing an LHS operand. Members of a group are
+// picked in program order and must be independent of each other.
+static void fuseHorizontalContractions(Block *block) {
+  llvm::MapVector<Value, SmallVector<SmallVector<linalg::MatmulOp>>> groups;
+  for (auto matmulOp : block->getOps<linalg::MatmulOp>()) {
+    if (!isFusionCandidate(matmulOp)) continue;
+    auto &lhsGroups = groups[matmulOp.getInputOperand(0)->get()];
+    auto groupIt = llvm::find_if(lhsGroups, [&](auto &group) {
+      return canJoinGroup(group, matmulOp);
+    });
+    if (groupIt != lhsGroups.end()) {
+      groupIt->push_back(matmulOp);
+    } else {
+      lhsGroups.push_back({matmulOp});
+    }
+  }
+  for (auto &lhsGroups : groups) {
+    for (auto &group : lhsGroups.second) {
+      if (group.size() < 2) continue;
+      LLVM_DEBUG(llvm::dbgs() << "fusing " << group.size()
+                              << " matmuls reading " << lhsGroups.first
+                              << "\n");
+      fuseGroup(group);
+    }
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// -iree-flow-fuse-horizontal-contractions
+//===----------------------------------------------------------------------===//
+
+class FuseHorizontalContractionsPass
+    : public FuseHorizontalContractionsBase<FuseHorizontalContractionsPass> {
+ public:
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<linalg::LinalgDialect, tensor::TensorDialect>();
+  }
+
+  void runOnOperation() override {
+    SmallVector<Block *> blocks;
+    getOperation()->walk([&](Block *block) { blocks.push_back(block); });
+    for (auto *block : blocks) fuseHorizontalContractions(block);
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<Pass> createFuseHorizontalContractionsPass() {
+  return std::make_unique<FuseHorizontalContractionsPass>();
+}
+
+}  // namespace Flow
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
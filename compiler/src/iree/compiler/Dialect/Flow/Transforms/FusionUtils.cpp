@@ -24,6 +24,12 @@ static llvm::cl::opt<bool> clEnsureInplaceableConsumer(
     llvm::cl::desc("Ensure the consumer is inplaceable for fusion."),
     llvm::cl::init(true));
 
+static llvm::cl::opt<bool> clFuseReductionBroadcastElementwise(
+    "iree-flow-fuse-reduction-broadcast-elementwise",
+    llvm::cl::desc("Fuse reductions with elementwise consumers that broadcast "
+                   "the reduced result back along the reduction dimensions."),
+    llvm::cl::init(true));
+
 /// For the fusion of root op -> elementwise operation to be bufferized
 /// in-place without use of extra memory, the result of the root operation
 /// must be able to reuse the buffer for the result of the elementwise
@@ -56,6 +62,45 @@ static bool canInsOperandTieWithOutsOperand(OpOperand *insOperand) {
   return llvm::any_of(linalgOp.getOutputOperands(), canTieWithOutsOperand);
 }
 
+/// Returns true if the result of the reduction `producer` is broadcast back
+/// along the reduced dimensions in the elementwise `consumer`, such as the
+/// `x - max(x)` and `exp(x) / sum(exp(x))` steps of a softmax. Both ops then
+/// share an iteration space and each tile of the consumer only needs the
+/// reduction over the matching tile of the producer's parallel dimensions, so
+/// tile + fuse can materialize the chain in a single dispatch.
+static bool isReductionBroadcastFusable(linalg::LinalgOp producer,
+                                        linalg::LinalgOp consumer,
+                                        OpOperand &use) {
+  if (!clFuseReductionBroadcastElementwise) return false;
+  if (producer.getNumReductionLoops() == 0) return false;
+  if (producer.getNumLoops() != consumer.getNumLoops()) return false;
+
+  // The reduced value must be read by the consumer the same way it is
+  // written by the producer so that the loops of the two ops line up.
+  auto result = use.get().cast<OpResult>();
+  OpOperand *producerOutput =
+      producer.getOutputOperand(result.getResultNumber());
+  AffineMap producerIndexingMap = producer.getTiedIndexingMap(producerOutput);
+  AffineMap consumerIndexingMap = consumer.getTiedIndexingMap(&use);
+  if (producerIndexingMap != consumerIndexingMap ||
+      !consumerIndexingMap.isProjectedPermutation()) {
+    return false;
+  }
+
+  // The consumer results are what gets distributed and must cover the whole
+  // iteration space.
+  if (!llvm::all_of(consumer.getOutputOperands(), [&](OpOperand *operand) {
+        return consumer.getTiedIndexingMap(operand).isIdentity();
+      })) {
+    return false;
+  }
+
+  // The reduced value can't reuse the buffer of the consumer result and is
+  // kept in a temporary within the dispatch. Only allow this when the
+  // temporary has a static size that codegen is able to allocate locally.
+  return result.getType().cast<ShapedType>().hasStaticShape();
+}
+
 bool areLinalgOpsFusableUsingTileAndFuse(OpOperand &use) {
   auto producer = use.get().getDefiningOp<linalg::LinalgOp>();
   auto consumer = dyn_cast<linalg::LinalgOp>(use.getOwner());
@@ -67,9 +112,12 @@ bool areLinalgOpsFusableUsingTileAndFuse(OpOperand &use) {
   // 2. Consumer is elementwise parallel.
   if (consumer.getNumLoops() != consumer.getNumParallelLoops()) return false;
 
-  // 3. In consumer the result of producer is accessed using identity indexing.
+  // 3. In consumer the result of producer is accessed using identity indexing
+  // or is a reduction broadcast back along the reduced dimensions.
   AffineMap consumerIndexingMap = consumer.getTiedIndexingMap(&use);
-  if (!consumerIndexingMap.isIdentity()) return false;
+  if (!consumerIndexingMap.isIdentity()) {
+    return isReductionBroadcastFusable(producer, consumer, use);
+  }
 
   // 4. In-place bufferization requirements (for now) require that the use in
   // the consumer can re-use the buffer for a result.
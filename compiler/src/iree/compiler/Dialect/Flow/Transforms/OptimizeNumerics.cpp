@@ -10,6 +10,7 @@
 #include "llvm/Support/Debug.h"
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
 #include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/IR/BlockAndValueMapping.h"
 #include "mlir/IR/PatternMatch.h"
 #include "mlir/Transforms/GreedyPatternRewriteDriver.h"
 
@@ -253,6 +254,131 @@ struct LinalgFpMatmulToLowP : public OpRewritePattern<linalg::MatmulOp> {
   }
 };
 
+// Returns true if |genericOp| dequantizes a low-precision integer tensor: an
+// elementwise op producing floats from at least one integer input of at most
+// 8 bits. Any other inputs (per-channel scales, zero points) are broadcast
+// into the iteration space.
+static bool isDequantizationOp(linalg::GenericOp genericOp) {
+  if (!genericOp.hasTensorSemantics()) return false;
+  if (genericOp.getNumOutputs() != 1) return false;
+  if (genericOp.getNumParallelLoops() != genericOp.getNumLoops()) return false;
+  OpOperand *outputOperand = genericOp.getOutputOperand(0);
+  if (!genericOp.getTiedIndexingMap(outputOperand).isIdentity()) return false;
+  if (!getElementTypeOrSelf(outputOperand->get().getType()).isa<FloatType>()) {
+    return false;
+  }
+  // The output must only be a destination as it is dropped on fusion.
+  if (!genericOp.getBody()
+           ->getArgument(outputOperand->getOperandNumber())
+           .use_empty()) {
+    return false;
+  }
+  return llvm::any_of(genericOp.getInputOperands(), [&](OpOperand *operand) {
+    auto elementType =
+        getElementTypeOrSelf(operand->get().getType()).dyn_cast<IntegerType>();
+    return elementType && elementType.getWidth() <= 8 &&
+           genericOp.getTiedIndexingMap(operand).isIdentity();
+  });
+}
+
+// Fuses the dequantization of a low-precision integer operand into the float
+// matmul consuming it. Importers materialize quantized weights as an integer
+// tensor dequantized by an elementwise op ahead of the matmul; with the
+// dequantization in the contraction payload the integer tensor is what
+// crosses the dispatch boundary and gets loaded by the kernel instead of a
+// 4-8x larger float copy.
+struct LinalgMatmulFuseDequantization
+    : public OpRewritePattern<linalg::MatmulOp> {
+  using OpRewritePattern::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(linalg::MatmulOp matmulOp,
+                                PatternRewriter &rewriter) const override {
+    if (!matmulOp.hasTensorSemantics()) return failure();
+    Type elementType = getElementTypeOrSelf(matmulOp.getResult(0).getType());
+    if (!elementType.isa<FloatType>()) {
+      return rewriter.notifyMatchFailure(matmulOp, "not a float matmul");
+    }
+    // Mixed precision matmuls have casts in their payload we'd need to keep.
+    for (OpOperand *operand : matmulOp.getInputOperands()) {
+      if (getElementTypeOrSelf(operand->get().getType()) != elementType) {
+        return rewriter.notifyMatchFailure(matmulOp, "mixed element types");
+      }
+    }
+
+    // Find an operand that is only dequantized for this matmul.
+    OpOperand *dequantOperand = nullptr;
+    linalg::GenericOp dequantOp;
+    for (OpOperand *operand : matmulOp.getInputOperands()) {
+      auto producerOp = operand->get().getDefiningOp<linalg::GenericOp>();
+      if (producerOp && producerOp->hasOneUse() &&
+          isDequantizationOp(producerOp)) {
+        dequantOperand = operand;
+        dequantOp = producerOp;
+        break;
+      }
+    }
+    if (!dequantOp) {
+      return rewriter.notifyMatchFailure(matmulOp, "no dequantized operand");
+    }
+
+    // Inputs of the dequantization are indexed by the matmul loops through
+    // the map of the operand they replace.
+    AffineMap operandMap = matmulOp.getTiedIndexingMap(dequantOperand);
+    SmallVector<Value> inputs;
+    SmallVector<AffineMap> indexingMaps;
+    for (OpOperand *operand : matmulOp.getInputOperands()) {
+      if (operand != dequantOperand) {
+        inputs.push_back(operand->get());
+        indexingMaps.push_back(matmulOp.getTiedIndexingMap(operand));
+        continue;
+      }
+      for (OpOperand *dequantInput : dequantOp.getInputOperands()) {
+        inputs.push_back(dequantInput->get());
+        indexingMaps.push_back(
+            dequantOp.getTiedIndexingMap(dequantInput).compose(operandMap));
+      }
+    }
+    OpOperand *outputOperand = matmulOp.getOutputOperand(0);
+    indexingMaps.push_back(matmulOp.getTiedIndexingMap(outputOperand));
+    SmallVector<StringRef> iterators;
+    for (auto attr : matmulOp.getIteratorTypes()) {
+      iterators.push_back(attr.cast<StringAttr>().getValue());
+    }
+
+    Block *dequantBody = dequantOp.getBody();
+    auto fusedOp = rewriter.create<linalg::GenericOp>(
+        matmulOp.getLoc(), matmulOp.getResult(0).getType(), inputs,
+        outputOperand->get(), indexingMaps, iterators,
+        [&](OpBuilder &b, Location nestedLoc, ValueRange args) {
+          SmallVector<Value> operandValues;
+          unsigned argIndex = 0;
+          for (OpOperand *operand : matmulOp.getInputOperands()) {
+            if (operand != dequantOperand) {
+              operandValues.push_back(args[argIndex++]);
+              continue;
+            }
+            BlockAndValueMapping mapping;
+            for (unsigned i = 0; i < dequantOp.getNumInputs(); ++i) {
+              mapping.map(dequantBody->getArgument(i), args[argIndex++]);
+            }
+            for (auto &op : dequantBody->without_terminator()) {
+              b.clone(op, mapping);
+            }
+            auto yieldOp = cast<linalg::YieldOp>(dequantBody->getTerminator());
+            operandValues.push_back(
+                mapping.lookupOrDefault(yieldOp.values().front()));
+          }
+          Value product = b.create<arith::MulFOp>(nestedLoc, operandValues[0],
+                                                  operandValues[1]);
+          Value sum = b.create<arith::AddFOp>(nestedLoc, args.back(), product);
+          b.create<linalg::YieldOp>(nestedLoc, sum);
+        });
+    rewriter.replaceOp(matmulOp, fusedOp->getResults());
+    rewriter.eraseOp(dequantOp);
+    return success();
+  }
+};
+
 class OptimizeNumericsPass : public OptimizeNumericsBase<OptimizeNumericsPass> {
   void runOnOperation() override {
     MLIRContext *context = &getContext();
@@ -260,6 +386,7 @@ class OptimizeNumericsPass : public OptimizeNumericsBase<OptimizeNumericsPass> {
 
     // Precision reduction.
     patterns.insert<LinalgFpMatmulToLowP>(context);
+    patterns.insert<LinalgMatmulFuseDequantization>(context);
 
     // Cast propagation.
     patterns.insert<LinalgInitTensorCast>(context);
@@ -132,19 +132,125 @@ class PadMatmulOp : public OpRewritePattern<linalg::MatmulOp> {
   int paddingSize;
 };
 
+/// Pads the dynamic dimensions of the operands of |matmulOp| up to the
+/// smallest of |bucketSizes| that fits them. The padded dimensions are still
+/// dynamic but only take one of a few values, which keeps the number of
+/// distinct dispatch shapes (and with that specializations and cached command
+/// buffers) small. Sizes larger than the largest bucket are left unpadded.
+/// Only the padded result rows/columns are computed on zeros and they are
+/// sliced away before any consumer sees them.
+static void padMatmulOpToBuckets(linalg::MatmulOp matmulOp,
+                                 ArrayRef<int64_t> bucketSizes) {
+  auto lhs = matmulOp.inputs()[0];
+  auto rhs = matmulOp.inputs()[1];
+  auto result = matmulOp.outputs()[0];
+  auto lhsType = lhs.getType().dyn_cast<RankedTensorType>();
+  auto rhsType = rhs.getType().dyn_cast<RankedTensorType>();
+  auto resultType = result.getType().dyn_cast<RankedTensorType>();
+  if (!lhsType || !rhsType || !resultType) return;
+  if (lhsType.hasStaticShape() && rhsType.hasStaticShape()) return;
+
+  auto loc = matmulOp.getLoc();
+  OpBuilder builder(matmulOp);
+
+  // Returns the size of |dim| of |value| and the bucket size it's padded to.
+  auto getBucketedSize = [&](Value value, int64_t dim) {
+    auto type = value.getType().cast<RankedTensorType>();
+    if (!type.isDynamicDim(dim)) {
+      OpFoldResult size = builder.getIndexAttr(type.getDimSize(dim));
+      return std::make_pair(size, size);
+    }
+    Value size = builder.create<tensor::DimOp>(loc, value, dim);
+    Value bucketedSize = size;
+    for (auto bucketSize : llvm::reverse(bucketSizes)) {
+      Value bucketValue =
+          builder.create<arith::ConstantIndexOp>(loc, bucketSize);
+      Value fits = builder.create<arith::CmpIOp>(
+          loc, arith::CmpIPredicate::ule, size, bucketValue);
+      bucketedSize =
+          builder.create<arith::SelectOp>(loc, fits, bucketValue, bucketedSize);
+    }
+    return std::make_pair(OpFoldResult(size), OpFoldResult(bucketedSize));
+  };
+  auto m = getBucketedSize(lhs, 0);
+  auto k = getBucketedSize(lhs, 1);
+  auto n = getBucketedSize(rhs, 1);
+
+  // Pads |value| with zeros up to the bucketed |sizes|.
+  auto padToBuckets =
+      [&](Value value,
+          ArrayRef<std::pair<OpFoldResult, OpFoldResult>> sizes) -> Value {
+    auto type = value.getType().cast<RankedTensorType>();
+    SmallVector<OpFoldResult> low(sizes.size(), builder.getIndexAttr(0));
+    SmallVector<OpFoldResult> high;
+    bool needsPadding = false;
+    for (auto size : sizes) {
+      if (size.first == size.second) {
+        high.push_back(builder.getIndexAttr(0));
+        continue;
+      }
+      needsPadding = true;
+      high.push_back(builder
+                         .create<arith::SubIOp>(loc, size.second.get<Value>(),
+                                                size.first.get<Value>())
+                         .getResult());
+    }
+    if (!needsPadding) return value;
+    Value paddingValue = builder.create<arith::ConstantOp>(
+        loc, builder.getZeroAttr(type.getElementType()));
+    return tensor::createPadScalarOp(type, value, paddingValue, low, high,
+                                     /*nofold=*/false, loc, builder);
+  };
+  Value paddedLhs = padToBuckets(lhs, {m, k});
+  Value paddedRhs = padToBuckets(rhs, {k, n});
+  Value paddedResult = padToBuckets(result, {m, n});
+  if (paddedLhs == lhs && paddedRhs == rhs) return;
+
+  auto paddedMatmulOp =
+      cast<linalg::LinalgOp>(matmulOp.getOperation())
+          .clone(builder, loc, {resultType},
+                 ArrayRef<Value>{paddedLhs, paddedRhs, paddedResult});
+  SmallVector<OpFoldResult> offsets(2, builder.getIndexAttr(0));
+  SmallVector<OpFoldResult> strides(2, builder.getIndexAttr(1));
+  SmallVector<OpFoldResult> sizes = {m.first, n.first};
+  Value slice = builder.create<tensor::ExtractSliceOp>(
+      loc, paddedMatmulOp->getResult(0), offsets, sizes, strides);
+  matmulOp.getResult(0).replaceAllUsesWith(slice);
+  matmulOp.erase();
+}
+
 class PadLinalgOpsPass : public PadLinalgOpsBase<PadLinalgOpsPass> {
  public:
-  PadLinalgOpsPass(int size) : paddingSize(size) {}
+  PadLinalgOpsPass(int size, ArrayRef<int64_t> bucketSizes)
+      : paddingSize(size) {
+    this->bucketSizes = bucketSizes;
+  }
   void getDependentDialects(DialectRegistry &registry) const override {
     registry.insert<linalg::LinalgDialect>();
   }
   void runOnOperation() override {
     MLIRContext *context = &getContext();
-    RewritePatternSet patterns(context);
-    patterns.insert<PadMatmulOp>(context, paddingSize);
-    if (failed(applyPatternsAndFoldGreedily(getOperation(),
-                                            std::move(patterns)))) {
-      return signalPassFailure();
+    if (paddingSize > 0) {
+      RewritePatternSet patterns(context);
+      patterns.insert<PadMatmulOp>(context, paddingSize);
+      if (failed(applyPatternsAndFoldGreedily(getOperation(),
+                                              std::move(patterns)))) {
+        return signalPassFailure();
+      }
+    }
+
+    // Bucketing is done in a single walk instead of as a pattern as the
+    // padded dimensions are still dynamic and would match again.
+    if (!bucketSizes.empty()) {
+      SmallVector<int64_t> sortedBucketSizes(bucketSizes.begin(),
+                                             bucketSizes.end());
+      llvm::sort(sortedBucketSizes);
+      SmallVector<linalg::MatmulOp> matmulOps;
+      getOperation()->walk(
+          [&](linalg::MatmulOp matmulOp) { matmulOps.push_back(matmulOp); });
+      for (auto matmulOp : matmulOps) {
+        padMatmulOpToBuckets(matmulOp, sortedBucketSizes);
+      }
     }
   }
 
@@ -153,8 +259,9 @@ class PadLinalgOpsPass : public PadLinalgOpsBase<PadLinalgOpsPass> {
 };
 }  // namespace
 
-std::unique_ptr<Pass> createPadLinalgOpsToIntegerMultiplePass(int paddingSize) {
-  return std::make_unique<PadLinalgOpsPass>(paddingSize);
+std::unique_ptr<Pass> createPadLinalgOpsToIntegerMultiplePass(
+    int paddingSize, ArrayRef<int64_t> bucketSizes) {
+  return std::make_unique<PadLinalgOpsPass>(paddingSize, bucketSizes);
 }
 
 }  // namespace Flow
@@ -27,6 +27,15 @@ static llvm::cl::opt<bool> clExportBenchmarkFuncs(
         "unique flow.executable that dispatches with dummy arguments."),
     llvm::cl::init(false));
 
+static llvm::cl::opt<std::string> clExportBenchmarkFuncsInputs(
+    "iree-flow-export-benchmark-funcs-inputs",
+    llvm::cl::desc(
+        "Directory of NumPy .npy files named <function>_arg<N>.npy used as "
+        "representative inputs of the benchmark functions exported by "
+        "--iree-flow-export-benchmark-funcs. Arguments without a file are "
+        "zero-filled."),
+    llvm::cl::init(""));
+
 // TODO(ravishankarm): Change to a pipeline option.
 static llvm::cl::opt<bool> clTraceDispatchTensors(
     "iree-flow-trace-dispatch-tensors",
@@ -60,6 +69,13 @@ static llvm::cl::opt<bool> clEnableConvToImg2Col(
     llvm::cl::desc("Enable converting convolution ops to img2col form."),
     llvm::cl::init(false));
 
+static llvm::cl::opt<bool> clEnableFuseHorizontalContractions(
+    "iree-flow-enable-fuse-horizontal-contractions",
+    llvm::cl::desc("Fuses independent matmuls reading the same LHS (such as "
+                   "attention Q/K/V projections) into a single matmul to "
+                   "reduce the dispatch count."),
+    llvm::cl::init(false));
+
 static llvm::cl::opt<bool> clEnablePaddingLinalgOps(
     "iree-flow-enable-padding-linalg-ops",
     llvm::cl::desc("Enable padding linalg ops to an integer multiple of "
@@ -77,6 +93,15 @@ static llvm::cl::opt<int> clLinalgOpsPaddingSize(
                    "flow-padding-size"),
     llvm::cl::init(4));
 
+static llvm::cl::list<int64_t> clLinalgOpsPaddingBucketSizes(
+    "iree-flow-linalg-ops-padding-bucket-sizes",
+    llvm::cl::desc("Pads dynamic dimensions of linalg ops up to the smallest "
+                   "fitting of the given sizes to limit the number of distinct "
+                   "dispatch shapes. Combine with "
+                   "--iree-flow-specialize-dynamic-dispatch-values to get "
+                   "static dispatches per bucket."),
+    llvm::cl::ZeroOrMore, llvm::cl::CommaSeparated);
+
 // TODO(#1159): enable by default or remove this option once it works on
 //              a broader set of programs
 static llvm::cl::opt<bool> clEnableLinalgDetensorize(
@@ -90,6 +115,30 @@ static llvm::cl::opt<std::string> clMmt4dTargetOptions(
                    "given architecture"),
     llvm::cl::init(""));
 
+static llvm::cl::opt<bool> clEnableDataTiling(
+    "iree-flow-enable-data-tiling",
+    llvm::cl::desc("Convert linalg.matmul ops to MMT4D ops with tile sizes "
+                   "inferred from the LLVM CPU targets of the module and "
+                   "hoist the packing of constant operands into globals. "
+                   "Ignored if --iree-flow-mmt4d-target-options is set."),
+    llvm::cl::init(true));
+
+static llvm::cl::list<int64_t> clSpecializeDynamicDispatchValues(
+    "iree-flow-specialize-dynamic-dispatch-values",
+    llvm::cl::desc("Emits static variants of dispatches whose dynamic "
+                   "dimensions all derive from one value for each of the "
+                   "given values (e.g. common sequence lengths) and selects "
+                   "between them at runtime."),
+    llvm::cl::ZeroOrMore, llvm::cl::CommaSeparated);
+
+static llvm::cl::opt<bool> clEnableTransposePropagation(
+    "iree-flow-enable-transpose-propagation",
+    llvm::cl::desc("Folds transposes into the contractions consuming them and "
+                   "normalizes the remaining ones such that they fuse with "
+                   "their producers instead of forming their own dispatches. "
+                   "Implies --iree-flow-normalize-input-indexing-map."),
+    llvm::cl::init(false));
+
 static llvm::cl::opt<bool> clNormalizeInputIndexingMap(
     "iree-flow-normalize-input-indexing-map",
     llvm::cl::desc("Enable normalizing input indexing map to identity"),
@@ -136,7 +185,9 @@ void buildGlobalOptimizationPassPipeline(
   pipeline.addPass(IREE::Util::createApplyPatternsPass());
   pipeline.addPass(IREE::Util::createFoldGlobalsPass());
 
-  if (transformOptions.constExprHoisting) {
+  // Data-tiling relayouts matmul operands and the packing of constant weights
+  // must only happen once at load time instead of on every invocation.
+  if (transformOptions.constExprHoisting || clEnableDataTiling) {
     pipeline.addPass(IREE::Util::createHoistIntoGlobalsPass());
   }
 
@@ -191,6 +242,8 @@ void buildFlowTransformPassPipeline(OpPassManager &passManager,
                          IREE::Flow::createDetachElementwiseFromNamedOpsPass)
       // Input should now be legal.
       .addPass(IREE::Flow::createVerifyInputLegalityPass)
+      .addPredicatedPass(clEnableFuseHorizontalContractions,
+                         IREE::Flow::createFuseHorizontalContractionsPass)
       // Catch matmul ops before we do anything else with them.
       .addPredicatedPass(
           !clMmt4dTargetOptions.empty(),
@@ -198,11 +251,20 @@ void buildFlowTransformPassPipeline(OpPassManager &passManager,
             return IREE::Flow::createConvertLinalgMatmulToMmt4DPass(
                 clMmt4dTargetOptions);
           })
+      .addPredicatedPass(clMmt4dTargetOptions.empty() && clEnableDataTiling,
+                         []() {
+                           return IREE::Flow::
+                               createConvertLinalgMatmulToMmt4DPass(
+                                   "infer_target");
+                         })
       // Pad linalg ops
-      .addPredicatedPass(clEnablePaddingLinalgOps, []() {
-        return IREE::Flow::createPadLinalgOpsToIntegerMultiplePass(
-            clLinalgOpsPaddingSize);
-      });
+      .addPredicatedPass(
+          clEnablePaddingLinalgOps || !clLinalgOpsPaddingBucketSizes.empty(),
+          []() {
+            return IREE::Flow::createPadLinalgOpsToIntegerMultiplePass(
+                clEnablePaddingLinalgOps ? clLinalgOpsPaddingSize : 0,
+                clLinalgOpsPaddingBucketSizes);
+          });
 
   passManager.addPass(mlir::createLinalgNamedOpConversionPass());
 
@@ -239,11 +301,15 @@ void buildFlowTransformPassPipeline(OpPassManager &passManager,
       // SplitReductionPass may create reduction dimension that are not the last
       // dimension.
       .addPass(createInterchangeGenericOpsPass)
+      // Fold transposes of contraction operands into the contractions.
+      .addPredicatedPass(clEnableTransposePropagation,
+                         createPropagateTransposesPass)
       // Normalize the input indexing map to make the input indexing map
       // identity. This helps fusing named linalg op with a generic op with
       // transpose.
-      .addPredicatedPass(clNormalizeInputIndexingMap,
-                         createInterchangeTransposeGenericOpsPass)
+      .addPredicatedPass(
+          clNormalizeInputIndexingMap || clEnableTransposePropagation,
+          createInterchangeTransposeGenericOpsPass)
       ////////////////////////////////////////////////////////////////////////
       // Dispatch region formation.
       .addPredicatedPass(!clDispatchTransformFileName.empty(),
@@ -295,12 +361,20 @@ void buildFlowTransformPassPipeline(OpPassManager &passManager,
   // an argument if two executables differ only in that one dimension).
   passManager.addPass(IREE::Flow::createDeduplicateExecutablesPass());
 
+  // Emit static variants of dynamic dispatches for expected dimension values.
+  // The original dynamic executable is kept as a fallback.
+  if (!clSpecializeDynamicDispatchValues.empty()) {
+    passManager.addPass(IREE::Flow::createSpecializeDynamicDispatchesPass(
+        clSpecializeDynamicDispatchValues));
+  }
+
   // Create one function per exported program entry point that can be used with
   // iree-benchmark-module to benchmark each function individually. Whether
   // a model supports execution like this (handles zero/null args, has state
   // resets, etc) is up to the author.
   if (clExportBenchmarkFuncs) {
-    passManager.addPass(IREE::Flow::createExportBenchmarkFuncsPass());
+    passManager.addPass(IREE::Flow::createExportBenchmarkFuncsPass(
+        clExportBenchmarkFuncsInputs));
   }
 
   FunctionLikeNest(passManager)
@@ -84,7 +84,7 @@ std::unique_ptr<Pass> createConvertConv2DToImg2ColPass();
 std::unique_ptr<Pass> createPadTensorToTensorInsertSlicePass();
 
 // Pass to convert a linalg.matmul into linalg.mmt4d given some target ISA
-// information currently passed as pass options.
+// information passed as pass options or inferred from the device targets.
 std::unique_ptr<Pass> createConvertLinalgMatmulToMmt4DPass();
 std::unique_ptr<Pass> createConvertLinalgMatmulToMmt4DPass(
     CustomKernelsTargetInfo targetInfo);
@@ -93,6 +93,10 @@ std::unique_ptr<Pass> createConvertLinalgMatmulToMmt4DPass(StringRef options);
 // Create a pass to detach elementwise ops from named Linalg ops.
 std::unique_ptr<Pass> createDetachElementwiseFromNamedOpsPass();
 
+// Creates a pass to fuse independent matmuls reading the same LHS into a
+// single matmul over their concatenated RHS operands.
+std::unique_ptr<Pass> createFuseHorizontalContractionsPass();
+
 // Creates a pass to fuse Linalg operations on tensors.
 std::unique_ptr<Pass> createFusionOfTensorOpsPass();
 
@@ -121,6 +125,10 @@ std::unique_ptr<Pass> createConvertToFlowPass();
 // iree-flow-infer-numeric-narrowing.
 std::unique_ptr<Pass> createOptimizeNumericsPass();
 
+// Creates a pass to fold transposes into the indexing maps of the contractions
+// consuming them.
+std::unique_ptr<Pass> createPropagateTransposesPass();
+
 // Strips the signed/unsigned portion off of tensors.
 std::unique_ptr<InterfacePass<mlir::FunctionOpInterface>>
 createStripSignednessPass();
@@ -158,15 +166,19 @@ std::unique_ptr<InterfacePass<mlir::FunctionOpInterface>>
 createInjectDispatchTracingPass();
 
 // Exports all functions and dispatch executables as `() -> ()` benchmark funcs.
-std::unique_ptr<OperationPass<mlir::ModuleOp>> createExportBenchmarkFuncsPass();
+// Arguments are initialized from `<function>_arg<N>.npy` files in |inputsDir|
+// when present and zeros otherwise.
+std::unique_ptr<OperationPass<mlir::ModuleOp>> createExportBenchmarkFuncsPass(
+    std::string inputsDir = "");
 
 //===----------------------------------------------------------------------===//
 // Linalg transforms
 //===----------------------------------------------------------------------===//
 
 // A pass to pad linalg ops to the next integer multiple of `paddingSize`.
+// Dynamic dimensions are padded up to the smallest fitting of `bucketSizes`.
 std::unique_ptr<Pass> createPadLinalgOpsToIntegerMultiplePass(
-    int paddingSize = 4);
+    int paddingSize = 4, ArrayRef<int64_t> bucketSizes = {});
 
 //===----------------------------------------------------------------------===//
 // Optimizations
@@ -180,6 +192,12 @@ createOutlineLargeConstantsPass();
 std::unique_ptr<OperationPass<mlir::ModuleOp>>
 createDeduplicateExecutablesPass();
 
+// Clones executables dispatched with a single dynamic dimension into static
+// variants for each of |values| and selects between them and the original
+// dynamic dispatch at runtime.
+std::unique_ptr<OperationPass<mlir::ModuleOp>>
+createSpecializeDynamicDispatchesPass(ArrayRef<int64_t> values = {});
+
 // Create a pass to split reduction dimension.
 std::unique_ptr<Pass> createSplitReductionPass();
 
@@ -0,0 +1,152 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//===- PropagateTransposes.cpp --------------------------------------------===//
+//
+// Folds transposes into the indexing maps of the contractions consuming them
+// such that they don't end up in dispatches of their own.
+//
+//===----------------------------------------------------------------------===//
+
+#include "iree/compiler/Dialect/Flow/Transforms/PassDetail.h"
+#include "iree/compiler/Dialect/Flow/Transforms/Passes.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
+#include "mlir/Dialect/Linalg/IR/LinalgInterfaces.h"
+#include "mlir/IR/AffineMap.h"
+#include "mlir/IR/BlockAndValueMapping.h"
+#include "mlir/IR/PatternMatch.h"
+#include "mlir/Transforms/GreedyPatternRewriteDriver.h"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace Flow {
+
+namespace {
+
+/// Returns the map from indices of the result of |genericOp| to the indices of
+/// its input if it only permutes its input, such as
+///   linalg.generic {
+///     indexing_maps = [affine_map<(d0, d1) -> (d1, d0)>,
+///                      affine_map<(d0, d1) -> (d0, d1)>], ...}
+///   ^bb0(%in: f32, %out: f32):
+///     linalg.yield %in : f32
+static Optional<AffineMap> getTransposeSourceMap(linalg::GenericOp genericOp) {
+  if (!genericOp.hasTensorSemantics() || genericOp.getNumInputs() != 1 ||
+      genericOp.getNumOutputs() != 1 ||
+      genericOp.getNumParallelLoops() != genericOp.getNumLoops()) {
+    return llvm::None;
+  }
+  auto yieldOp = cast<linalg::YieldOp>(genericOp.getBody()->getTerminator());
+  if (yieldOp.values().size() != 1 ||
+      yieldOp.values().front() != genericOp.getBody()->getArgument(0)) {
+    return llvm::None;
+  }
+  AffineMap inputMap =
+      genericOp.getTiedIndexingMap(genericOp.getInputOperand(0));
+  AffineMap outputMap =
+      genericOp.getTiedIndexingMap(genericOp.getOutputOperand(0));
+  if (!inputMap.isPermutation() || !outputMap.isPermutation() ||
+      inputMap == outputMap) {
+    return llvm::None;
+  }
+  return inputMap.compose(inversePermutation(outputMap));
+}
+
+/// Folds transposed operands of contractions into the indexing maps of the
+/// contraction. Named contractions are rewritten into the equivalent
+/// linalg.generic which codegen still recognizes as a contraction:
+///   %t = linalg.generic {transpose} ins(%b : tensor<32x64xf32>)
+///   %0 = linalg.matmul ins(%a, %t : tensor<16x64xf32>, tensor<64x32xf32>)
+/// ->
+///   %0 = linalg.generic {
+///     indexing_maps = [affine_map<(d0, d1, d2) -> (d0, d2)>,
+///                      affine_map<(d0, d1, d2) -> (d1, d2)>,
+///                      affine_map<(d0, d1, d2) -> (d0, d1)>], ...}
+///     ins(%a, %b : tensor<16x64xf32>, tensor<32x64xf32>)
+struct FoldTransposeIntoContraction
+    : public OpInterfaceRewritePattern<linalg::LinalgOp> {
+  using OpInterfaceRewritePattern::OpInterfaceRewritePattern;
+
+  LogicalResult matchAndRewrite(linalg::LinalgOp linalgOp,
+                                PatternRewriter &rewriter) const override {
+    if (!linalgOp.hasTensorSemantics() ||
+        !linalg::isaContractionOpInterface(linalgOp)) {
+      return failure();
+    }
+
+    bool foldedAny = false;
+    SmallVector<Value> inputs;
+    SmallVector<AffineMap> indexingMaps;
+    for (OpOperand *operand : linalgOp.getInputOperands()) {
+      AffineMap operandMap = linalgOp.getTiedIndexingMap(operand);
+      auto producerOp = operand->get().getDefiningOp<linalg::GenericOp>();
+      Optional<AffineMap> sourceMap;
+      if (producerOp) sourceMap = getTransposeSourceMap(producerOp);
+      if (!sourceMap) {
+        inputs.push_back(operand->get());
+        indexingMaps.push_back(operandMap);
+        continue;
+      }
+      inputs.push_back(producerOp.getInputOperand(0)->get());
+      indexingMaps.push_back(sourceMap->compose(operandMap));
+      foldedAny = true;
+    }
+    if (!foldedAny) {
+      return rewriter.notifyMatchFailure(linalgOp, "no transposed operands");
+    }
+
+    SmallVector<Value> outputs;
+    for (OpOperand *operand : linalgOp.getOutputOperands()) {
+      outputs.push_back(operand->get());
+      indexingMaps.push_back(linalgOp.getTiedIndexingMap(operand));
+    }
+    SmallVector<StringRef> iterators;
+    for (auto attr : linalgOp.getIteratorTypes()) {
+      iterators.push_back(attr.cast<StringAttr>().getValue());
+    }
+
+    // The payload only depends on the element types and is kept as-is.
+    Block *body = linalgOp.getBlock();
+    auto genericOp = rewriter.create<linalg::GenericOp>(
+        linalgOp.getLoc(), linalgOp->getResultTypes(), inputs, outputs,
+        indexingMaps, iterators,
+        [&](OpBuilder &b, Location nestedLoc, ValueRange args) {
+          BlockAndValueMapping mapping;
+          mapping.map(body->getArguments(), args);
+          for (auto &op : body->getOperations()) b.clone(op, mapping);
+        });
+    rewriter.replaceOp(linalgOp, genericOp->getResults());
+    return success();
+  }
+};
+
+struct PropagateTransposesPass
+    : public PropagateTransposesBase<PropagateTransposesPass> {
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<linalg::LinalgDialect>();
+  }
+
+  void runOnOperation() override {
+    RewritePatternSet patterns(&getContext());
+    patterns.add<FoldTransposeIntoContraction>(&getContext());
+    if (failed(applyPatternsAndFoldGreedily(getOperation(),
+                                            std::move(patterns)))) {
+      return signalPassFailure();
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<Pass> createPropagateTransposesPass() {
+  return std::make_unique<PropagateTransposesPass>();
+}
+
+}  // namespace Flow
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -0,0 +1,245 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <map>
+#include <tuple>
+
+#include "iree/compiler/Dialect/Flow/IR/FlowDialect.h"
+#include "iree/compiler/Dialect/Flow/IR/FlowOps.h"
+#include "iree/compiler/Dialect/Flow/Transforms/PassDetail.h"
+#include "iree/compiler/Dialect/Flow/Transforms/Passes.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
+#include "mlir/Dialect/ControlFlow/IR/ControlFlowOps.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Pass/Pass.h"
+
+#define DEBUG_TYPE "iree-flow-specialize-dynamic-dispatches"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace Flow {
+namespace {
+
+// A dispatch site that has all of its dynamic dimensions derived from a single
+// value that is also passed to the dispatch function.
+struct SpecializableSite {
+  DispatchOp dispatchOp;
+  ExecutableExportOp exportOp;
+  // Dynamic dimension shared by all dynamically shaped operands and results.
+  Value dim;
+  // Indices of the dispatch operands (and function arguments) carrying |dim|.
+  SmallVector<unsigned> argIndices;
+};
+
+// Returns a site description if |dispatchOp| can be specialized.
+static Optional<SpecializableSite> matchSpecializableSite(
+    DispatchOp dispatchOp) {
+  // The selection splits the block and we don't handle nested regions.
+  if (!isa<FunctionOpInterface>(dispatchOp->getParentOp())) return llvm::None;
+
+  SetVector<Value> dynamicDims;
+  for (auto dim : dispatchOp.operand_dims()) {
+    if (!matchPattern(dim, m_Constant())) dynamicDims.insert(dim);
+  }
+  for (auto dim : dispatchOp.result_dims()) {
+    if (!matchPattern(dim, m_Constant())) dynamicDims.insert(dim);
+  }
+  if (dynamicDims.size() != 1) return llvm::None;
+
+  SpecializableSite site;
+  site.dispatchOp = dispatchOp;
+  site.dim = dynamicDims.front();
+  for (auto operand : llvm::enumerate(dispatchOp.operands())) {
+    if (operand.value() == site.dim) site.argIndices.push_back(operand.index());
+  }
+  // The dimension needs to reach the dispatch function to be replaced there.
+  if (site.argIndices.empty()) return llvm::None;
+
+  site.exportOp = SymbolTable::lookupNearestSymbolFrom<ExecutableExportOp>(
+      dispatchOp, dispatchOp.entry_point());
+  if (!site.exportOp) return llvm::None;
+  return site;
+}
+
+// Creates a copy of the executable containing |site.exportOp| where the
+// function arguments carrying the dynamic dimension are replaced with
+// |value|. Variants are memoized so that sites dispatching the same function
+// the same way share executables.
+class VariantBuilder {
+ public:
+  explicit VariantBuilder(SymbolTable &moduleSymbols)
+      : moduleSymbols(moduleSymbols) {}
+
+  SymbolRefAttr getVariant(SpecializableSite &site, int64_t value) {
+    auto key = std::make_tuple(site.exportOp.getOperation(),
+                               std::vector<unsigned>(site.argIndices.begin(),
+                                                     site.argIndices.end()),
+                               value);
+    auto it = variants.find(key);
+    if (it != variants.end()) return it->second;
+
+    auto executableOp = site.exportOp->getParentOfType<ExecutableOp>();
+    OpBuilder moduleBuilder(executableOp);
+    moduleBuilder.setInsertionPointAfter(executableOp);
+    auto variantOp = cast<ExecutableOp>(moduleBuilder.clone(*executableOp));
+    variantOp.setName(
+        (executableOp.getName() + "_" + std::to_string(value)).str());
+    moduleSymbols.insert(variantOp);  // uniques name
+
+    auto variantExportOp =
+        variantOp.lookupSymbol<ExecutableExportOp>(site.exportOp.getName());
+    auto funcOp = variantOp.getInnerModule().lookupSymbol<func::FuncOp>(
+        variantExportOp.function_ref());
+    auto &entryBlock = funcOp.front();
+    auto builder = OpBuilder::atBlockBegin(&entryBlock);
+    auto constantOp =
+        builder.create<arith::ConstantIndexOp>(funcOp.getLoc(), value);
+    for (auto argIndex : site.argIndices) {
+      entryBlock.getArgument(argIndex).replaceAllUsesWith(constantOp);
+    }
+
+    auto variantRef = SymbolRefAttr::get(
+        variantOp.getNameAttr(),
+        {SymbolRefAttr::get(variantExportOp.getNameAttr())});
+    variants[key] = variantRef;
+    return variantRef;
+  }
+
+ private:
+  SymbolTable &moduleSymbols;
+  std::map<std::tuple<Operation *, std::vector<unsigned>, int64_t>,
+           SymbolRefAttr>
+      variants;
+};
+
+// Selects between the statically specialized variants of |site| and the
+// original dynamic dispatch at runtime based on the dynamic dimension:
+//   %0 = flow.dispatch @ex::@entry[%d](%arg, %d) : (tensor<?xf32>{%d}, index)
+// ->
+//   %eq = arith.cmpi eq, %d, %c64 : index
+//   cf.cond_br %eq, ^static, ^dynamic
+// ^static:
+//   %1 = flow.dispatch @ex_64::@entry[%d](%arg, %d) : ...
+//   cf.br ^continue(%1)
+// ^dynamic:
+//   %2 = flow.dispatch @ex::@entry[%d](%arg, %d) : ...
+//   cf.br ^continue(%2)
+// ^continue(%0: tensor<?xf32>):
+//   %tied = flow.tensor.tie_shape %0 : tensor<?xf32>{%d}
+static void specializeSite(SpecializableSite &site, ArrayRef<int64_t> values,
+                           VariantBuilder &variantBuilder) {
+  auto dispatchOp = site.dispatchOp;
+  auto loc = dispatchOp.getLoc();
+  auto *block = dispatchOp->getBlock();
+  auto *continueBlock =
+      block->splitBlock(std::next(Block::iterator(dispatchOp)));
+
+  // Results are passed to the continuation block and get their shapes re-tied
+  // as the dimensions all dominate the dispatch.
+  auto continueBuilder = OpBuilder::atBlockBegin(continueBlock);
+  for (auto result : dispatchOp.getResults()) {
+    auto arg = continueBlock->addArgument(result.getType(), result.getLoc());
+    Value replacement = arg;
+    auto resultDims = dispatchOp.getResultDynamicDims(result.getResultNumber());
+    if (!resultDims.empty()) {
+      replacement = continueBuilder.create<TensorTieShapeOp>(
+          result.getLoc(), result.getType(), arg, resultDims);
+    }
+    result.replaceAllUsesWith(replacement);
+  }
+
+  // Emits a block dispatching |entryPoint| that branches to the continuation.
+  auto *region = block->getParent();
+  auto createDispatchBlock = [&](SymbolRefAttr entryPoint) {
+    auto *dispatchBlock = new Block();
+    region->getBlocks().insert(Region::iterator(continueBlock), dispatchBlock);
+    auto builder = OpBuilder::atBlockBegin(dispatchBlock);
+    auto clonedOp = cast<DispatchOp>(builder.clone(*dispatchOp));
+    clonedOp.entry_pointAttr(entryPoint);
+    builder.create<cf::BranchOp>(loc, continueBlock, clonedOp.getResults());
+    return dispatchBlock;
+  };
+
+  // Chain the comparisons such that the first matching variant is used and
+  // the original dynamic dispatch is the fallback.
+  auto *testBlock = block;
+  for (auto value : llvm::enumerate(values)) {
+    auto *variantBlock =
+        createDispatchBlock(variantBuilder.getVariant(site, value.value()));
+    auto *nextBlock = value.index() + 1 == values.size()
+                          ? createDispatchBlock(dispatchOp.entry_point())
+                          : new Block();
+    if (!nextBlock->getParent()) {
+      region->getBlocks().insert(Region::iterator(continueBlock), nextBlock);
+    }
+    auto builder = OpBuilder::atBlockEnd(testBlock);
+    auto valueOp = builder.create<arith::ConstantIndexOp>(loc, value.value());
+    auto cmpOp = builder.create<arith::CmpIOp>(loc, arith::CmpIPredicate::eq,
+                                               site.dim, valueOp);
+    builder.create<cf::CondBranchOp>(loc, cmpOp, variantBlock, ValueRange{},
+                                     nextBlock, ValueRange{});
+    testBlock = nextBlock;
+  }
+  dispatchOp.erase();
+}
+
+//===----------------------------------------------------------------------===//
+// -iree-flow-specialize-dynamic-dispatches
+//===----------------------------------------------------------------------===//
+
+class SpecializeDynamicDispatchesPass
+    : public SpecializeDynamicDispatchesBase<SpecializeDynamicDispatchesPass> {
+ public:
+  SpecializeDynamicDispatchesPass() = default;
+  explicit SpecializeDynamicDispatchesPass(ArrayRef<int64_t> values) {
+    this->values = values;
+  }
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<arith::ArithmeticDialect, cf::ControlFlowDialect,
+                    IREE::Flow::FlowDialect>();
+  }
+
+  void runOnOperation() override {
+    if (values.empty()) return;
+    auto moduleOp = getOperation();
+
+    SmallVector<SpecializableSite> sites;
+    for (auto funcOp : moduleOp.getOps<FunctionOpInterface>()) {
+      funcOp.walk([&](DispatchOp dispatchOp) {
+        if (auto site = matchSpecializableSite(dispatchOp)) {
+          sites.push_back(*site);
+        }
+      });
+    }
+
+    SymbolTable moduleSymbols(moduleOp);
+    VariantBuilder variantBuilder(moduleSymbols);
+    for (auto &site : sites) {
+      LLVM_DEBUG(llvm::dbgs() << "specializing " << values.size()
+                              << " variants of " << site.dispatchOp << "\n");
+      specializeSite(site, values, variantBuilder);
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<OperationPass<mlir::ModuleOp>>
+createSpecializeDynamicDispatchesPass(ArrayRef<int64_t> values) {
+  return std::make_unique<SpecializeDynamicDispatchesPass>(values);
+}
+
+}  // namespace Flow
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -32,6 +32,61 @@ static llvm::cl::opt<int64_t> topkSplitReductionRatio(
     "iree-flow-topk-split-reduction", llvm::cl::desc("split ratio"),
     llvm::cl::init(1));
 
+static llvm::cl::opt<int64_t> scanSplitReductionRatio(
+    "iree-flow-scan-split-reduction",
+    llvm::cl::desc("Number of blocks inclusive scans are split into"),
+    llvm::cl::init(1));
+
+static llvm::cl::opt<int64_t> genericSplitReductionMinSize(
+    "iree-flow-split-reduction-min-size",
+    llvm::cl::desc("Minimum static reduction size of linalg.generic ops to "
+                   "split into a parallel and a reduction part (0 to "
+                   "disable)"),
+    llvm::cl::init(1024 * 1024));
+
+static llvm::cl::opt<int64_t> genericSplitReductionTargetParallelism(
+    "iree-flow-split-reduction-target-parallelism",
+    llvm::cl::desc("Number of parallel iterations split generic reductions "
+                   "aim to expose"),
+    llvm::cl::init(64));
+
+/// Returns the split ratio and the position of the new parallel dimension for
+/// a large linalg.generic reduction that has too little outer parallelism to
+/// occupy the target, such as a sum or norm over millions of elements. The
+/// ratio is the largest divisor of the reduction size that brings the number
+/// of parallel iterations up to the target parallelism. Returns a zero ratio
+/// if the op should not be split.
+static std::pair<int64_t, unsigned> getGenericSplitReductionRatio(
+    linalg::LinalgOp op) {
+  auto noSplit = std::make_pair(int64_t(0), 0u);
+  if (genericSplitReductionMinSize <= 0) return noSplit;
+  if (!isa<linalg::GenericOp>(op) || op.getNumOutputs() != 1 ||
+      op.getNumReductionLoops() != 1) {
+    return noSplit;
+  }
+  SmallVector<unsigned> reductionDims;
+  op.getReductionDims(reductionDims);
+  SmallVector<int64_t> loopRanges = op.getStaticLoopRanges();
+  int64_t reductionSize = loopRanges[reductionDims.front()];
+  if (ShapedType::isDynamic(reductionSize) ||
+      reductionSize < genericSplitReductionMinSize) {
+    return noSplit;
+  }
+  int64_t parallelSize = 1;
+  for (auto loopRange : llvm::enumerate(loopRanges)) {
+    if (loopRange.index() == reductionDims.front()) continue;
+    if (ShapedType::isDynamic(loopRange.value())) return noSplit;
+    parallelSize *= loopRange.value();
+  }
+  int64_t maxRatio = std::min(
+      genericSplitReductionTargetParallelism.getValue() / parallelSize,
+      reductionSize / 2);
+  for (int64_t ratio = maxRatio; ratio >= 2; --ratio) {
+    if (reductionSize % ratio == 0) return std::make_pair(ratio, 0u);
+  }
+  return noSplit;
+}
+
 namespace {
 /// Pattern to wrap splitReduction transformation. This also propagates
 /// attributes to allow compilation info attribute to not be lost.
@@ -81,7 +136,9 @@ struct SplitReductionPass : public SplitReductionBase<SplitReductionPass> {
 
   void runOnOperation() override {
     if (splitReductionRatio.getValue() <= 1 &&
-        topkSplitReductionRatio.getValue() <= 1) {
+        topkSplitReductionRatio.getValue() <= 1 &&
+        scanSplitReductionRatio.getValue() <= 1 &&
+        genericSplitReductionMinSize.getValue() <= 0) {
       return;
     }
 
@@ -91,11 +148,10 @@ struct SplitReductionPass : public SplitReductionBase<SplitReductionPass> {
         [&](linalg::LinalgOp op) {
           // For matmul make the new parallel dimension first so that it looks
           // like a batch_matmul and can follow the same codegen.
-          if (isa<linalg::MatmulOp>(op))
-            return std::make_pair(int64_t(splitReductionRatio), 0);
-          // Currently disable spliting reduction for non-matmul op. This will
-          // get enabled after once tests are ready.
-          return std::make_pair(int64_t(0), 0);
+          if (isa<linalg::MatmulOp>(op)) {
+            return std::make_pair(int64_t(splitReductionRatio), 0u);
+          }
+          return getGenericSplitReductionRatio(op);
         },
         linalg::LinalgTransformationFilter(
             ArrayRef<StringAttr>{}, StringAttr::get(&getContext(), "SPLIT")));
@@ -110,6 +166,16 @@ struct SplitReductionPass : public SplitReductionBase<SplitReductionPass> {
             ArrayRef<StringAttr>{},
             StringAttr::get(patterns.getContext(), "SPLIT_REDUCTION")));
 
+    LinalgExt::ScanSplitReductionControlFn scanSplitReductionFn =
+        [&](LinalgExt::ScanOp scanOp) {
+          return scanSplitReductionRatio.getValue();
+        };
+    LinalgExt::populateScanSplitReductionPattern(
+        patterns, scanSplitReductionFn,
+        mlir::linalg::LinalgTransformationFilter(
+            ArrayRef<StringAttr>{},
+            StringAttr::get(patterns.getContext(), "SPLIT_REDUCTION")));
+
     if (failed(applyPatternsAndFoldGreedily(getOperation(),
                                             std::move(patterns)))) {
       return signalPassFailure();
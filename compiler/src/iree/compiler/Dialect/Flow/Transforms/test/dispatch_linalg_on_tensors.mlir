@@ -1444,3 +1444,72 @@ func.func @multi_use_producer_fusion(%arg0 : tensor<?x8xf32>, %arg1 : tensor<8x?
 //  CHECK-DAG:     flow.dispatch.tensor.store %[[GENERIC]], %[[RESULT0]]
 //  CHECK-DAG:     flow.dispatch.tensor.store %[[MATMUL]], %[[RESULT1]]
 //      CHECK:   return %[[DISPATCH]]#1, %[[DISPATCH]]#0
+
+// -----
+
+func.func @softmax(%arg0 : tensor<12x128xf32>) -> tensor<12x128xf32> {
+  %cst_min = arith.constant -3.40282347E+38 : f32
+  %cst_zero = arith.constant 0.000000e+00 : f32
+  %0 = linalg.init_tensor [12] : tensor<12xf32>
+  %1 = linalg.fill ins(%cst_min : f32) outs(%0 : tensor<12xf32>) -> tensor<12xf32>
+  %max = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0)>],
+      iterator_types = ["parallel", "reduction"]}
+      ins(%arg0 : tensor<12x128xf32>) outs(%1 : tensor<12xf32>) {
+    ^bb0(%b0 : f32, %b1 : f32):
+      %2 = arith.maxf %b0, %b1 : f32
+      linalg.yield %2 : f32
+    } -> tensor<12xf32>
+  %3 = linalg.init_tensor [12, 128] : tensor<12x128xf32>
+  %exp = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%arg0, %max : tensor<12x128xf32>, tensor<12xf32>) outs(%3 : tensor<12x128xf32>) {
+    ^bb0(%b0 : f32, %b1 : f32, %b2 : f32):
+      %4 = arith.subf %b0, %b1 : f32
+      %5 = math.exp %4 : f32
+      linalg.yield %5 : f32
+    } -> tensor<12x128xf32>
+  %6 = linalg.fill ins(%cst_zero : f32) outs(%0 : tensor<12xf32>) -> tensor<12xf32>
+  %sum = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0)>],
+      iterator_types = ["parallel", "reduction"]}
+      ins(%exp : tensor<12x128xf32>) outs(%6 : tensor<12xf32>) {
+    ^bb0(%b0 : f32, %b1 : f32):
+      %7 = arith.addf %b0, %b1 : f32
+      linalg.yield %7 : f32
+    } -> tensor<12xf32>
+  %result = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%exp, %sum : tensor<12x128xf32>, tensor<12xf32>) outs(%3 : tensor<12x128xf32>) {
+    ^bb0(%b0 : f32, %b1 : f32, %b2 : f32):
+      %8 = arith.divf %b0, %b1 : f32
+      linalg.yield %8 : f32
+    } -> tensor<12x128xf32>
+  return %result : tensor<12x128xf32>
+}
+//      CHECK: func.func @softmax
+// CHECK-SAME:     %[[ARG0:[a-zA-Z0-9]+]]: tensor<12x128xf32>
+//      CHECK:   %[[EXP:.+]] = flow.dispatch.workgroups
+// CHECK-SAME:       (%[[ARG0]])
+//      CHECK:     %[[MAX_FILL:.+]] = linalg.fill
+//      CHECK:     %[[MAX:.+]] = linalg.generic
+// CHECK-SAME:         outs(%[[MAX_FILL]] :
+//      CHECK:       arith.maxf
+//      CHECK:     %[[EXP_GENERIC:.+]] = linalg.generic
+// CHECK-SAME:         ins(%{{.+}}, %[[MAX]] :
+//      CHECK:       math.exp
+//      CHECK:     flow.dispatch.tensor.store %[[EXP_GENERIC]]
+//  CHECK-NOT:     linalg.generic
+//      CHECK:   %[[RESULT:.+]] = flow.dispatch.workgroups
+// CHECK-SAME:       (%[[EXP]])
+//      CHECK:     %[[SUM_FILL:.+]] = linalg.fill
+//      CHECK:     %[[SUM:.+]] = linalg.generic
+// CHECK-SAME:         outs(%[[SUM_FILL]] :
+//      CHECK:       arith.addf
+//      CHECK:     %[[DIV:.+]] = linalg.generic
+// CHECK-SAME:         ins(%{{.+}}, %[[SUM]] :
+//      CHECK:       arith.divf
+//      CHECK:     flow.dispatch.tensor.store %[[DIV]]
+//      CHECK:   return %[[RESULT]]
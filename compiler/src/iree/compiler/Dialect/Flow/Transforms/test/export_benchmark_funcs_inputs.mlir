@@ -0,0 +1,35 @@
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: printf "\223NUMPY\001\000\072\000{'descr': '<f4', 'fortran_order': False, 'shape': (2,), }\n\000\000\200\077\000\000\000\100" > %t/simple_arg0.npy
+// RUN: cp %t/simple_arg0.npy %t/simpleMul_arg1.npy
+// RUN: iree-opt --split-input-file --iree-flow-export-benchmark-funcs-pass='inputs-dir=%t' %s | FileCheck %s
+
+// Arguments with an input file are initialized from it and others with zeros.
+
+//  CHECK-DAG: util.global private @simple_benchmark_arg0 {noinline} = dense<[1.000000e+00, 2.000000e+00]> : tensor<2xf32>
+//  CHECK-DAG: util.global private @simple_benchmark_arg1 {noinline} = dense<0.000000e+00> : tensor<2xf32>
+// CHECK-LABEL: func.func @simple_benchmark()
+func.func @simple(%arg0: tensor<2xf32>, %arg1: tensor<2xf32>) -> tensor<2xf32> {
+  %0 = arith.addf %arg0, %arg1 : tensor<2xf32>
+  return %0 : tensor<2xf32>
+}
+
+// -----
+
+// Buffer views are exported from a constant holding the input file contents.
+
+//      CHECK: util.global private @simpleMul_benchmark_arg0 {noinline} : !hal.buffer_view
+//      CHECK: util.initializer {
+//      CHECK:   flow.tensor.splat
+//      CHECK: util.global private @simpleMul_benchmark_arg1 {noinline} : !hal.buffer_view
+//      CHECK: util.initializer {
+//      CHECK:   %[[INPUT:.+]] = arith.constant dense<[1.000000e+00, 2.000000e+00]> : tensor<2xf32>
+//      CHECK:   %[[BUFFER_VIEW:.+]] = hal.tensor.export %[[INPUT]] : tensor<2xf32> -> !hal.buffer_view
+//      CHECK:   %[[DNO:.+]] = util.do_not_optimize(%[[BUFFER_VIEW]]) : !hal.buffer_view
+//      CHECK:   util.global.store %[[DNO]], @simpleMul_benchmark_arg1 : !hal.buffer_view
+func.func @simpleMul(%arg0: !hal.buffer_view, %arg1: !hal.buffer_view) -> !hal.buffer_view attributes {iree.abi.stub, iree.module.export} {
+  %0 = hal.tensor.import %arg0 : !hal.buffer_view -> tensor<2xf32>
+  %1 = hal.tensor.import %arg1 : !hal.buffer_view -> tensor<2xf32>
+  %2 = arith.mulf %0, %1 : tensor<2xf32>
+  %3 = hal.tensor.export %2 : tensor<2xf32> -> !hal.buffer_view
+  return %3 : !hal.buffer_view
+}
@@ -0,0 +1,74 @@
+// RUN: iree-opt --split-input-file --pass-pipeline="func.func(iree-flow-fuse-horizontal-contractions)" %s | FileCheck %s
+
+func.func @fuse_qkv(%x: tensor<?x64xf32>, %wq: tensor<64x32xf32>, %wk: tensor<64x32xf32>, %wv: tensor<64x16xf32>) -> (tensor<?x32xf32>, tensor<?x32xf32>, tensor<?x16xf32>) {
+  %cst = arith.constant 0.000000e+00 : f32
+  %c0 = arith.constant 0 : index
+  %m = tensor.dim %x, %c0 : tensor<?x64xf32>
+  %init_q = linalg.init_tensor [%m, 32] : tensor<?x32xf32>
+  %fill_q = linalg.fill ins(%cst : f32) outs(%init_q : tensor<?x32xf32>) -> tensor<?x32xf32>
+  %q = linalg.matmul ins(%x, %wq : tensor<?x64xf32>, tensor<64x32xf32>) outs(%fill_q : tensor<?x32xf32>) -> tensor<?x32xf32>
+  %init_k = linalg.init_tensor [%m, 32] : tensor<?x32xf32>
+  %fill_k = linalg.fill ins(%cst : f32) outs(%init_k : tensor<?x32xf32>) -> tensor<?x32xf32>
+  %k = linalg.matmul ins(%x, %wk : tensor<?x64xf32>, tensor<64x32xf32>) outs(%fill_k : tensor<?x32xf32>) -> tensor<?x32xf32>
+  %init_v = linalg.init_tensor [%m, 16] : tensor<?x16xf32>
+  %fill_v = linalg.fill ins(%cst : f32) outs(%init_v : tensor<?x16xf32>) -> tensor<?x16xf32>
+  %v = linalg.matmul ins(%x, %wv : tensor<?x64xf32>, tensor<64x16xf32>) outs(%fill_v : tensor<?x16xf32>) -> tensor<?x16xf32>
+  return %q, %k, %v : tensor<?x32xf32>, tensor<?x32xf32>, tensor<?x16xf32>
+}
+// CHECK-LABEL: func.func @fuse_qkv
+//  CHECK-SAME:   %[[X:[a-zA-Z0-9_]+]]: tensor<?x64xf32>
+//  CHECK-SAME:   %[[WQ:[a-zA-Z0-9_]+]]: tensor<64x32xf32>
+//  CHECK-SAME:   %[[WK:[a-zA-Z0-9_]+]]: tensor<64x32xf32>
+//  CHECK-SAME:   %[[WV:[a-zA-Z0-9_]+]]: tensor<64x16xf32>
+//       CHECK:   %[[CST:.+]] = arith.constant 0.000000e+00 : f32
+//   CHECK-NOT:   linalg.matmul
+//       CHECK:   %[[RHS_INIT:.+]] = linalg.init_tensor [64, 80] : tensor<64x80xf32>
+//       CHECK:   %[[RHS0:.+]] = tensor.insert_slice %[[WQ]] into %[[RHS_INIT]][0, 0] [64, 32] [1, 1]
+//       CHECK:   %[[RHS1:.+]] = tensor.insert_slice %[[WK]] into %[[RHS0]][0, 32] [64, 32] [1, 1]
+//       CHECK:   %[[RHS:.+]] = tensor.insert_slice %[[WV]] into %[[RHS1]][0, 64] [64, 16] [1, 1]
+//       CHECK:   %[[M:.+]] = tensor.dim %[[X]], %{{.+}} : tensor<?x64xf32>
+//       CHECK:   %[[INIT:.+]] = linalg.init_tensor [%[[M]], 80] : tensor<?x80xf32>
+//       CHECK:   %[[FILL:.+]] = linalg.fill ins(%[[CST]] : f32) outs(%[[INIT]] : tensor<?x80xf32>)
+//       CHECK:   %[[MATMUL:.+]] = linalg.matmul
+//  CHECK-SAME:     ins(%[[X]], %[[RHS]] : tensor<?x64xf32>, tensor<64x80xf32>)
+//  CHECK-SAME:     outs(%[[FILL]] : tensor<?x80xf32>)
+//   CHECK-NOT:   linalg.matmul
+//       CHECK:   %[[Q:.+]] = tensor.extract_slice %[[MATMUL]][0, 0] [%[[M]], 32] [1, 1] : tensor<?x80xf32> to tensor<?x32xf32>
+//       CHECK:   %[[K:.+]] = tensor.extract_slice %[[MATMUL]][0, 32] [%[[M]], 32] [1, 1] : tensor<?x80xf32> to tensor<?x32xf32>
+//       CHECK:   %[[V:.+]] = tensor.extract_slice %[[MATMUL]][0, 64] [%[[M]], 16] [1, 1] : tensor<?x80xf32> to tensor<?x16xf32>
+//       CHECK:   return %[[Q]], %[[K]], %[[V]]
+
+// -----
+
+// Matmuls depending on each other or accumulating into different values are
+// left alone.
+
+func.func @no_fuse_dependent(%x: tensor<32x32xf32>, %w: tensor<32x32xf32>) -> (tensor<32x32xf32>, tensor<32x32xf32>) {
+  %cst = arith.constant 0.000000e+00 : f32
+  %init = linalg.init_tensor [32, 32] : tensor<32x32xf32>
+  %fill = linalg.fill ins(%cst : f32) outs(%init : tensor<32x32xf32>) -> tensor<32x32xf32>
+  %0 = linalg.matmul ins(%x, %w : tensor<32x32xf32>, tensor<32x32xf32>) outs(%fill : tensor<32x32xf32>) -> tensor<32x32xf32>
+  %1 = linalg.matmul ins(%x, %0 : tensor<32x32xf32>, tensor<32x32xf32>) outs(%fill : tensor<32x32xf32>) -> tensor<32x32xf32>
+  return %0, %1 : tensor<32x32xf32>, tensor<32x32xf32>
+}
+// CHECK-LABEL: func.func @no_fuse_dependent
+//       CHECK:   %[[MATMUL0:.+]] = linalg.matmul
+//       CHECK:   %[[MATMUL1:.+]] = linalg.matmul ins(%{{.+}}, %[[MATMUL0]]
+//   CHECK-NOT:   tensor.extract_slice
+
+// -----
+
+func.func @no_fuse_different_fill(%x: tensor<32x32xf32>, %w0: tensor<32x16xf32>, %w1: tensor<32x16xf32>) -> (tensor<32x16xf32>, tensor<32x16xf32>) {
+  %zero = arith.constant 0.000000e+00 : f32
+  %one = arith.constant 1.000000e+00 : f32
+  %init = linalg.init_tensor [32, 16] : tensor<32x16xf32>
+  %fill0 = linalg.fill ins(%zero : f32) outs(%init : tensor<32x16xf32>) -> tensor<32x16xf32>
+  %fill1 = linalg.fill ins(%one : f32) outs(%init : tensor<32x16xf32>) -> tensor<32x16xf32>
+  %0 = linalg.matmul ins(%x, %w0 : tensor<32x32xf32>, tensor<32x16xf32>) outs(%fill0 : tensor<32x16xf32>) -> tensor<32x16xf32>
+  %1 = linalg.matmul ins(%x, %w1 : tensor<32x32xf32>, tensor<32x16xf32>) outs(%fill1 : tensor<32x16xf32>) -> tensor<32x16xf32>
+  return %0, %1 : tensor<32x16xf32>, tensor<32x16xf32>
+}
+// CHECK-LABEL: func.func @no_fuse_different_fill
+//       CHECK:   linalg.matmul ins(%{{.+}}, %{{.+}} : tensor<32x32xf32>, tensor<32x16xf32>)
+//       CHECK:   linalg.matmul ins(%{{.+}}, %{{.+}} : tensor<32x32xf32>, tensor<32x16xf32>)
+//   CHECK-NOT:   tensor.extract_slice
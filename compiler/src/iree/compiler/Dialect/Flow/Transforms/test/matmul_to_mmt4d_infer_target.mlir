@@ -0,0 +1,78 @@
+// RUN: iree-opt --split-input-file --iree-flow-convert-linalg-matmul-to-mmt4d=infer_target %s | FileCheck %s
+
+// Tests that the tiling is picked from the CPU features of the LLVM target
+// and that features without kernels are ignored.
+
+module attributes {
+  hal.device.targets = [
+    #hal.device.target<"llvm", {
+      executable_targets = [
+        #hal.executable.target<"llvm", "embedded-elf-arm_64", {
+          cpu_features = "+neon,+v8.2a,+dotprod",
+          target_triple = "aarch64-none-elf"
+        }>
+      ]
+    }>
+  ]
+} {
+  // CHECK-LABEL: @infer_aarch64_dotprod
+  func.func @infer_aarch64_dotprod(%arg0: tensor<?x?xi8>, %arg1: tensor<?x?xi8>, %arg2: tensor<?x?xi32>) -> tensor<?x?xi32> {
+    // CHECK: linalg.mmt4d
+    // CHECK-SAME: {comment = "i8*i8->i32, aarch64 +dotprod"}
+    // CHECK-SAME: ins({{.*}} : tensor<?x?x8x4xi8>, tensor<?x?x8x4xi8>) outs({{.*}} : tensor<?x?x8x8xi32>) -> tensor<?x?x8x8xi32>
+    %0 = linalg.matmul ins(%arg0, %arg1 : tensor<?x?xi8>, tensor<?x?xi8>) outs(%arg2 : tensor<?x?xi32>) -> tensor<?x?xi32>
+    return %0 : tensor<?x?xi32>
+  }
+}
+
+// -----
+
+// Tests that targets we don't have a tiling for are left alone.
+
+module attributes {
+  hal.device.targets = [
+    #hal.device.target<"llvm", {
+      executable_targets = [
+        #hal.executable.target<"llvm", "embedded-elf-x86_64", {
+          cpu_features = "+avx2",
+          target_triple = "x86_64-unknown-linux-gnu"
+        }>
+      ]
+    }>
+  ]
+} {
+  // CHECK-LABEL: @unknown_x86_64
+  func.func @unknown_x86_64(%arg0: tensor<?x?xf32>, %arg1: tensor<?x?xf32>, %arg2: tensor<?x?xf32>) -> tensor<?x?xf32> {
+    // CHECK: linalg.matmul
+    // CHECK-NOT: linalg.mmt4d
+    %0 = linalg.matmul ins(%arg0, %arg1 : tensor<?x?xf32>, tensor<?x?xf32>) outs(%arg2 : tensor<?x?xf32>) -> tensor<?x?xf32>
+    return %0 : tensor<?x?xf32>
+  }
+}
+
+// -----
+
+// Tests that the tiling is not inferred when the targets disagree as the same
+// packed layout would be shared by all of them.
+
+module attributes {
+  hal.device.targets = [
+    #hal.device.target<"llvm", {
+      executable_targets = [
+        #hal.executable.target<"llvm", "embedded-elf-arm_64", {
+          cpu_features = "+dotprod",
+          target_triple = "aarch64-none-elf"
+        }>,
+        #hal.executable.target<"vmvx", "vmvx-bytecode-fb">
+      ]
+    }>
+  ]
+} {
+  // CHECK-LABEL: @mixed_targets
+  func.func @mixed_targets(%arg0: tensor<?x?xi8>, %arg1: tensor<?x?xi8>, %arg2: tensor<?x?xi32>) -> tensor<?x?xi32> {
+    // CHECK: linalg.matmul
+    // CHECK-NOT: linalg.mmt4d
+    %0 = linalg.matmul ins(%arg0, %arg1 : tensor<?x?xi8>, tensor<?x?xi8>) outs(%arg2 : tensor<?x?xi32>) -> tensor<?x?xi32>
+    return %0 : tensor<?x?xi32>
+  }
+}
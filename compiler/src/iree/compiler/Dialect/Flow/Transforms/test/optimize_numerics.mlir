@@ -1,5 +1,10 @@
 // RUN: iree-opt --iree-flow-optimize-numerics %s | FileCheck %s
 
+// CHECK-DAG: #[[LHS_MAP:.+]] = affine_map<(d0, d1, d2) -> (d0, d2)>
+// CHECK-DAG: #[[RHS_MAP:.+]] = affine_map<(d0, d1, d2) -> (d2, d1)>
+// CHECK-DAG: #[[SCALE_MAP:.+]] = affine_map<(d0, d1, d2) -> (d1)>
+// CHECK-DAG: #[[OUT_MAP:.+]] = affine_map<(d0, d1, d2) -> (d0, d1)>
+
 // CHECK-LABEL: @matmul_i8_i8_i32_unsigned
 func.func @matmul_i8_i8_i32_unsigned(%arg0 : tensor<5x3xf32>, %arg1 : tensor<3x1xf32>, %arg2 : tensor<5x1xf32>) -> tensor<5x1xf32> {
   // CHECK: %[[LHS:.*]] = arith.fptoui %arg0 : tensor<5x3xf32> to tensor<5x3xi8>
@@ -75,3 +80,50 @@ func.func @cast_init() -> tensor<5x9xi8> {
   %1 = arith.fptosi %0 : tensor<5x9xf32> to tensor<5x9xi8>
   return %1 : tensor<5x9xi8>
 }
+
+// CHECK-LABEL: @matmul_fuse_per_channel_dequantization
+// CHECK-SAME: (%[[LHS:.+]]: tensor<5x3xf32>, %[[WEIGHTS:.+]]: tensor<3x4xi8>, %[[SCALES:.+]]: tensor<4xf32>, %[[INIT:.+]]: tensor<5x4xf32>)
+func.func @matmul_fuse_per_channel_dequantization(%lhs : tensor<5x3xf32>, %weights : tensor<3x4xi8>, %scales : tensor<4xf32>, %init : tensor<5x4xf32>) -> tensor<5x4xf32> {
+  // CHECK-NOT: linalg.matmul
+  // CHECK: %[[RESULT:.+]] = linalg.generic
+  // CHECK-SAME: indexing_maps = [#[[LHS_MAP]], #[[RHS_MAP]], #[[SCALE_MAP]], #[[OUT_MAP]]]
+  // CHECK-SAME: iterator_types = ["parallel", "parallel", "reduction"]
+  // CHECK-SAME: ins(%[[LHS]], %[[WEIGHTS]], %[[SCALES]] : tensor<5x3xf32>, tensor<3x4xi8>, tensor<4xf32>)
+  // CHECK-SAME: outs(%[[INIT]] : tensor<5x4xf32>)
+  // CHECK-NEXT: ^bb0(%[[A:.+]]: f32, %[[W:.+]]: i8, %[[S:.+]]: f32, %[[OUT:.+]]: f32):
+  // CHECK-NEXT:   %[[WF:.+]] = arith.sitofp %[[W]] : i8 to f32
+  // CHECK-NEXT:   %[[DEQUANT:.+]] = arith.mulf %[[WF]], %[[S]] : f32
+  // CHECK-NEXT:   %[[PRODUCT:.+]] = arith.mulf %[[A]], %[[DEQUANT]] : f32
+  // CHECK-NEXT:   %[[SUM:.+]] = arith.addf %[[OUT]], %[[PRODUCT]] : f32
+  // CHECK-NEXT:   linalg.yield %[[SUM]] : f32
+  %empty = linalg.init_tensor [3, 4] : tensor<3x4xf32>
+  %rhs = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d1)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%weights, %scales : tensor<3x4xi8>, tensor<4xf32>) outs(%empty : tensor<3x4xf32>) {
+  ^bb0(%w : i8, %s : f32, %out : f32):
+    %wf = arith.sitofp %w : i8 to f32
+    %dequant = arith.mulf %wf, %s : f32
+    linalg.yield %dequant : f32
+  } -> tensor<3x4xf32>
+  %0 = linalg.matmul ins(%lhs, %rhs : tensor<5x3xf32>, tensor<3x4xf32>) outs(%init : tensor<5x4xf32>) -> tensor<5x4xf32>
+  // CHECK: return %[[RESULT]]
+  return %0 : tensor<5x4xf32>
+}
+
+// CHECK-LABEL: @matmul_reject_shared_dequantization
+// Dequantizations with other users would have to be computed twice.
+func.func @matmul_reject_shared_dequantization(%lhs : tensor<5x3xf32>, %weights : tensor<3x4xi8>, %init : tensor<5x4xf32>) -> (tensor<5x4xf32>, tensor<3x4xf32>) {
+  %empty = linalg.init_tensor [3, 4] : tensor<3x4xf32>
+  %rhs = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%weights : tensor<3x4xi8>) outs(%empty : tensor<3x4xf32>) {
+  ^bb0(%w : i8, %out : f32):
+    %wf = arith.sitofp %w : i8 to f32
+    linalg.yield %wf : f32
+  } -> tensor<3x4xf32>
+  // CHECK: linalg.matmul
+  %0 = linalg.matmul ins(%lhs, %rhs : tensor<5x3xf32>, tensor<3x4xf32>) outs(%init : tensor<5x4xf32>) -> tensor<5x4xf32>
+  return %0, %rhs : tensor<5x4xf32>, tensor<3x4xf32>
+}
@@ -1,4 +1,5 @@
 // RUN: iree-opt --split-input-file --iree-flow-pad-linalg-ops %s | FileCheck %s
+// RUN: iree-opt --split-input-file --iree-flow-pad-linalg-ops='bucket-sizes=64,16' %s | FileCheck %s --check-prefix=BUCKET
 
 func.func @matmul_f32_11x13x17(%lhs: tensor<11x17xf32>, %rhs: tensor<17x13xf32>, %init: tensor<11x13xf32>) -> tensor<11x13xf32> {
     %result = linalg.matmul ins(%lhs, %rhs : tensor<11x17xf32>, tensor<17x13xf32>) outs(%init : tensor<11x13xf32>) -> tensor<11x13xf32>
@@ -53,3 +54,35 @@ func.func @matmul_i8_i8_i32_2x2x4(%lhs: tensor<2x4xi8>, %rhs: tensor<4x2xi8>, %d
 //  CHECK-SAME:         outs(%[[PADDED_DST]] : tensor<4x4xi32>)
 //       CHECK:      %[[RESULT:.+]] = tensor.extract_slice %[[PADDED_RESULT]]
 //       CHECK:      return %[[RESULT]] : tensor<2x2xi32>
+
+// -----
+
+func.func @matmul_f32_dynamic_m(%lhs: tensor<?x16xf32>, %rhs: tensor<16x32xf32>, %dst: tensor<?x32xf32>) -> tensor<?x32xf32> {
+    %result = linalg.matmul ins(%lhs, %rhs : tensor<?x16xf32>, tensor<16x32xf32>) outs(%dst: tensor<?x32xf32>) -> tensor<?x32xf32>
+    return %result : tensor<?x32xf32>
+}
+// Dynamic dimensions are only padded when buckets are provided.
+// CHECK-LABEL: @matmul_f32_dynamic_m
+//   CHECK-NOT:      tensor.pad
+//       CHECK:      linalg.matmul
+
+// BUCKET-LABEL: @matmul_f32_dynamic_m
+//  BUCKET-SAME:   %[[LHS:.+]]: tensor<?x16xf32>
+//  BUCKET-SAME:   %[[RHS:.+]]: tensor<16x32xf32>
+//  BUCKET-SAME:   %[[DST:.+]]: tensor<?x32xf32>
+//       BUCKET:      %[[M:.+]] = tensor.dim %[[LHS]], %c0
+//       BUCKET:      %[[C64:.+]] = arith.constant 64 : index
+//       BUCKET:      %[[FITS64:.+]] = arith.cmpi ule, %[[M]], %[[C64]]
+//       BUCKET:      %[[BUCKET64:.+]] = arith.select %[[FITS64]], %[[C64]], %[[M]]
+//       BUCKET:      %[[C16:.+]] = arith.constant 16 : index
+//       BUCKET:      %[[FITS16:.+]] = arith.cmpi ule, %[[M]], %[[C16]]
+//       BUCKET:      %[[BUCKET:.+]] = arith.select %[[FITS16]], %[[C16]], %[[BUCKET64]]
+//       BUCKET:      %[[PAD_M:.+]] = arith.subi %[[BUCKET]], %[[M]]
+//       BUCKET:      %[[PADDED_LHS:.+]] = tensor.pad %[[LHS]] low[0, 0] high[%[[PAD_M]], 0]
+//   BUCKET-NOT:      tensor.pad %[[RHS]]
+//       BUCKET:      %[[PADDED_DST:.+]] = tensor.pad %[[DST]] low[0, 0] high[%[[PAD_M]], 0]
+//       BUCKET:      %[[PADDED_RESULT:.+]] = linalg.matmul
+//  BUCKET-SAME:         ins(%[[PADDED_LHS]], %[[RHS]] : tensor<?x16xf32>, tensor<16x32xf32>)
+//  BUCKET-SAME:         outs(%[[PADDED_DST]] : tensor<?x32xf32>)
+//       BUCKET:      %[[RESULT:.+]] = tensor.extract_slice %[[PADDED_RESULT]][0, 0] [%[[M]], 32] [1, 1]
+//       BUCKET:      return %[[RESULT]] : tensor<?x32xf32>
@@ -0,0 +1,84 @@
+// RUN: iree-opt --split-input-file --pass-pipeline="func.func(iree-flow-propagate-transposes)" %s | FileCheck %s
+
+func.func @fold_transposed_rhs(%lhs: tensor<16x64xf32>, %rhs: tensor<32x64xf32>, %init: tensor<16x32xf32>) -> tensor<16x32xf32> {
+  %empty = linalg.init_tensor [64, 32] : tensor<64x32xf32>
+  %transpose = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d1, d0)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%rhs : tensor<32x64xf32>) outs(%empty : tensor<64x32xf32>) {
+  ^bb0(%in: f32, %out: f32):
+    linalg.yield %in : f32
+  } -> tensor<64x32xf32>
+  %0 = linalg.matmul ins(%lhs, %transpose : tensor<16x64xf32>, tensor<64x32xf32>) outs(%init : tensor<16x32xf32>) -> tensor<16x32xf32>
+  return %0 : tensor<16x32xf32>
+}
+//  CHECK-DAG: #[[LHS_MAP:.+]] = affine_map<(d0, d1, d2) -> (d0, d2)>
+//  CHECK-DAG: #[[RHS_MAP:.+]] = affine_map<(d0, d1, d2) -> (d1, d2)>
+//  CHECK-DAG: #[[OUT_MAP:.+]] = affine_map<(d0, d1, d2) -> (d0, d1)>
+//      CHECK: func.func @fold_transposed_rhs
+// CHECK-SAME:   %[[LHS:[a-zA-Z0-9_]+]]: tensor<16x64xf32>
+// CHECK-SAME:   %[[RHS:[a-zA-Z0-9_]+]]: tensor<32x64xf32>
+// CHECK-SAME:   %[[INIT:[a-zA-Z0-9_]+]]: tensor<16x32xf32>
+//  CHECK-NOT:   linalg.matmul
+//      CHECK:   %[[RESULT:.+]] = linalg.generic
+// CHECK-SAME:       indexing_maps = [#[[LHS_MAP]], #[[RHS_MAP]], #[[OUT_MAP]]]
+// CHECK-SAME:       iterator_types = ["parallel", "parallel", "reduction"]
+// CHECK-SAME:       ins(%[[LHS]], %[[RHS]] : tensor<16x64xf32>, tensor<32x64xf32>)
+// CHECK-SAME:       outs(%[[INIT]] : tensor<16x32xf32>)
+//      CHECK:     arith.mulf
+//      CHECK:     arith.addf
+//      CHECK:   return %[[RESULT]]
+
+// -----
+
+func.func @fold_transposed_batch_lhs(%lhs: tensor<4x64x16xf32>, %rhs: tensor<4x64x32xf32>, %init: tensor<4x16x32xf32>) -> tensor<4x16x32xf32> {
+  %empty = linalg.init_tensor [4, 16, 64] : tensor<4x16x64xf32>
+  %transpose = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1, d2) -> (d0, d2, d1)>, affine_map<(d0, d1, d2) -> (d0, d1, d2)>],
+      iterator_types = ["parallel", "parallel", "parallel"]}
+      ins(%lhs : tensor<4x64x16xf32>) outs(%empty : tensor<4x16x64xf32>) {
+  ^bb0(%in: f32, %out: f32):
+    linalg.yield %in : f32
+  } -> tensor<4x16x64xf32>
+  %0 = linalg.batch_matmul ins(%transpose, %rhs : tensor<4x16x64xf32>, tensor<4x64x32xf32>) outs(%init : tensor<4x16x32xf32>) -> tensor<4x16x32xf32>
+  return %0 : tensor<4x16x32xf32>
+}
+//  CHECK-DAG: #[[LHS_MAP:.+]] = affine_map<(d0, d1, d2, d3) -> (d0, d3, d1)>
+//  CHECK-DAG: #[[RHS_MAP:.+]] = affine_map<(d0, d1, d2, d3) -> (d0, d3, d2)>
+//  CHECK-DAG: #[[OUT_MAP:.+]] = affine_map<(d0, d1, d2, d3) -> (d0, d1, d2)>
+//      CHECK: func.func @fold_transposed_batch_lhs
+// CHECK-SAME:   %[[LHS:[a-zA-Z0-9_]+]]: tensor<4x64x16xf32>
+// CHECK-SAME:   %[[RHS:[a-zA-Z0-9_]+]]: tensor<4x64x32xf32>
+//  CHECK-NOT:   linalg.batch_matmul
+//      CHECK:   linalg.generic
+// CHECK-SAME:       indexing_maps = [#[[LHS_MAP]], #[[RHS_MAP]], #[[OUT_MAP]]]
+// CHECK-SAME:       ins(%[[LHS]], %[[RHS]] : tensor<4x64x16xf32>, tensor<4x64x32xf32>)
+
+// -----
+
+// Transposes feeding ops that aren't contractions are left to elementwise
+// fusion.
+
+func.func @no_fold_elementwise(%arg0: tensor<32x64xf32>, %arg1: tensor<64x32xf32>) -> tensor<64x32xf32> {
+  %empty = linalg.init_tensor [64, 32] : tensor<64x32xf32>
+  %transpose = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d1, d0)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%arg0 : tensor<32x64xf32>) outs(%empty : tensor<64x32xf32>) {
+  ^bb0(%in: f32, %out: f32):
+    linalg.yield %in : f32
+  } -> tensor<64x32xf32>
+  %0 = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0, d1)>],
+      iterator_types = ["parallel", "parallel"]}
+      ins(%transpose, %arg1 : tensor<64x32xf32>, tensor<64x32xf32>) outs(%empty : tensor<64x32xf32>) {
+  ^bb0(%lhs: f32, %rhs: f32, %out: f32):
+    %add = arith.addf %lhs, %rhs : f32
+    linalg.yield %add : f32
+  } -> tensor<64x32xf32>
+  return %0 : tensor<64x32xf32>
+}
+// CHECK-LABEL: func.func @no_fold_elementwise
+//       CHECK:   %[[TRANSPOSE:.+]] = linalg.generic
+//       CHECK:   linalg.generic
+//  CHECK-SAME:       ins(%[[TRANSPOSE]], %{{.+}} : tensor<64x32xf32>, tensor<64x32xf32>)
@@ -0,0 +1,77 @@
+// RUN: iree-opt --split-input-file --iree-flow-specialize-dynamic-dispatches='values=64,128' %s | FileCheck %s
+
+// Tests that a dispatch with a single dynamic dimension gets static variants
+// that are selected at runtime with the dynamic dispatch as the fallback.
+
+// CHECK: flow.executable private @ex
+// CHECK: func.func @entry(%{{.+}}: !flow.dispatch.tensor<readonly:?xf32>, %[[DIM:.+]]: index
+// CHECK: flow.dispatch.tensor.load {{.+}} !flow.dispatch.tensor<readonly:?xf32>{%[[DIM]]}
+flow.executable private @ex {
+  flow.executable.export public @entry
+  builtin.module {
+    func.func @entry(%arg: !flow.dispatch.tensor<readonly:?xf32>, %dim: index, %ret: !flow.dispatch.tensor<writeonly:?xf32>) {
+      %0 = flow.dispatch.tensor.load %arg, offsets = [0], sizes = [%dim], strides = [1] : !flow.dispatch.tensor<readonly:?xf32>{%dim} -> tensor<?xf32>
+      flow.dispatch.tensor.store %0, %ret, offsets = [0], sizes = [%dim], strides = [1] : tensor<?xf32> -> !flow.dispatch.tensor<writeonly:?xf32>{%dim}
+      return
+    }
+  }
+}
+
+// CHECK: flow.executable private @ex_128
+// CHECK: func.func @entry(%{{.+}}: !flow.dispatch.tensor<readonly:?xf32>, %{{.+}}: index
+// CHECK: %[[C128:.+]] = arith.constant 128 : index
+// CHECK: flow.dispatch.tensor.load {{.+}} !flow.dispatch.tensor<readonly:?xf32>{%[[C128]]}
+
+// CHECK: flow.executable private @ex_64
+// CHECK: func.func @entry(%{{.+}}: !flow.dispatch.tensor<readonly:?xf32>, %{{.+}}: index
+// CHECK: %[[C64:.+]] = arith.constant 64 : index
+// CHECK: flow.dispatch.tensor.load {{.+}} !flow.dispatch.tensor<readonly:?xf32>{%[[C64]]}
+
+// CHECK-LABEL: func.func @dynamicDispatch
+// CHECK-SAME: (%[[ARG:.+]]: tensor<?xf32>, %[[D:.+]]: index)
+func.func @dynamicDispatch(%arg: tensor<?xf32>, %d: index) -> tensor<?xf32> {
+  // CHECK: %[[IS_64:.+]] = arith.cmpi eq, %[[D]], %c64
+  // CHECK: cf.cond_br %[[IS_64]], ^bb1, ^bb2
+  // CHECK: ^bb1:
+  // CHECK:   %[[R64:.+]] = flow.dispatch @ex_64::@entry[%[[D]]](%[[ARG]], %[[D]])
+  // CHECK:   cf.br ^bb5(%[[R64]] : tensor<?xf32>)
+  // CHECK: ^bb2:
+  // CHECK:   %[[IS_128:.+]] = arith.cmpi eq, %[[D]], %c128
+  // CHECK:   cf.cond_br %[[IS_128]], ^bb3, ^bb4
+  // CHECK: ^bb3:
+  // CHECK:   %[[R128:.+]] = flow.dispatch @ex_128::@entry[%[[D]]](%[[ARG]], %[[D]])
+  // CHECK:   cf.br ^bb5(%[[R128]] : tensor<?xf32>)
+  // CHECK: ^bb4:
+  // CHECK:   %[[RDYN:.+]] = flow.dispatch @ex::@entry[%[[D]]](%[[ARG]], %[[D]])
+  // CHECK:   cf.br ^bb5(%[[RDYN]] : tensor<?xf32>)
+  // CHECK: ^bb5(%[[RESULT:.+]]: tensor<?xf32>):
+  // CHECK:   %[[TIED:.+]] = flow.tensor.tie_shape %[[RESULT]] : tensor<?xf32>{%[[D]]}
+  // CHECK:   return %[[TIED]]
+  %0 = flow.dispatch @ex::@entry[%d](%arg, %d) : (tensor<?xf32>{%d}, index) -> tensor<?xf32>{%d}
+  return %0 : tensor<?xf32>
+}
+
+// -----
+
+// Tests that dispatches with multiple independent dynamic dimensions are left
+// alone as the number of variants would explode.
+
+// CHECK-NOT: @ex2_64
+flow.executable private @ex2 {
+  flow.executable.export public @entry
+  builtin.module {
+    func.func @entry(%arg: !flow.dispatch.tensor<readonly:?x?xf32>, %dim0: index, %dim1: index, %ret: !flow.dispatch.tensor<writeonly:?x?xf32>) {
+      %0 = flow.dispatch.tensor.load %arg, offsets = [0, 0], sizes = [%dim0, %dim1], strides = [1, 1] : !flow.dispatch.tensor<readonly:?x?xf32>{%dim0, %dim1} -> tensor<?x?xf32>
+      flow.dispatch.tensor.store %0, %ret, offsets = [0, 0], sizes = [%dim0, %dim1], strides = [1, 1] : tensor<?x?xf32> -> !flow.dispatch.tensor<writeonly:?x?xf32>{%dim0, %dim1}
+      return
+    }
+  }
+}
+
+// CHECK-LABEL: func.func @multipleDynamicDims
+func.func @multipleDynamicDims(%arg: tensor<?x?xf32>, %d0: index, %d1: index) -> tensor<?x?xf32> {
+  // CHECK-NOT: cf.cond_br
+  // CHECK: flow.dispatch @ex2::@entry
+  %0 = flow.dispatch @ex2::@entry[%d0, %d1](%arg, %d0, %d1) : (tensor<?x?xf32>{%d0, %d1}, index, index) -> tensor<?x?xf32>{%d0, %d1}
+  return %0 : tensor<?x?xf32>
+}
@@ -0,0 +1,75 @@
+// RUN: iree-opt --split-input-file --iree-flow-split-reduction-min-size=1024 --iree-flow-split-reduction-target-parallelism=8 --pass-pipeline="func.func(iree-flow-split-reduction-ops)" %s | FileCheck %s
+
+func.func @split_sum(%arg0: tensor<4096xf32>) -> tensor<f32> {
+  %cst = arith.constant 0.000000e+00 : f32
+  %0 = linalg.init_tensor [] : tensor<f32>
+  %1 = linalg.fill ins(%cst : f32) outs(%0 : tensor<f32>) -> tensor<f32>
+  %2 = linalg.generic {
+      indexing_maps = [affine_map<(d0) -> (d0)>, affine_map<(d0) -> ()>],
+      iterator_types = ["reduction"]}
+      ins(%arg0 : tensor<4096xf32>) outs(%1 : tensor<f32>) {
+    ^bb0(%b0: f32, %b1: f32):
+      %3 = arith.addf %b0, %b1 : f32
+      linalg.yield %3 : f32
+    } -> tensor<f32>
+  return %2 : tensor<f32>
+}
+// CHECK-LABEL: func.func @split_sum
+//  CHECK-SAME:   %[[ARG0:.+]]: tensor<4096xf32>
+//       CHECK:   %[[EXPANDED:.+]] = tensor.expand_shape %[[ARG0]] {{\[}}[0, 1]] : tensor<4096xf32> into tensor<8x512xf32>
+//       CHECK:   %[[PARTIAL:.+]] = linalg.generic
+//  CHECK-SAME:       iterator_types = ["parallel", "reduction"]
+//  CHECK-SAME:       ins(%[[EXPANDED]] : tensor<8x512xf32>)
+//  CHECK-SAME:       outs(%{{.+}} : tensor<8xf32>)
+//       CHECK:     arith.addf
+//       CHECK:   %[[RESULT:.+]] = linalg.generic
+//  CHECK-SAME:       iterator_types = ["reduction"]
+//  CHECK-SAME:       ins(%[[PARTIAL]] : tensor<8xf32>)
+//       CHECK:     arith.addf
+//       CHECK:   return %[[RESULT]]
+
+// -----
+
+// Reductions that already have enough parallel iterations are left alone.
+
+func.func @no_split_parallel(%arg0: tensor<16x4096xf32>) -> tensor<16xf32> {
+  %cst = arith.constant 0.000000e+00 : f32
+  %0 = linalg.init_tensor [16] : tensor<16xf32>
+  %1 = linalg.fill ins(%cst : f32) outs(%0 : tensor<16xf32>) -> tensor<16xf32>
+  %2 = linalg.generic {
+      indexing_maps = [affine_map<(d0, d1) -> (d0, d1)>, affine_map<(d0, d1) -> (d0)>],
+      iterator_types = ["parallel", "reduction"]}
+      ins(%arg0 : tensor<16x4096xf32>) outs(%1 : tensor<16xf32>) {
+    ^bb0(%b0: f32, %b1: f32):
+      %3 = arith.addf %b0, %b1 : f32
+      linalg.yield %3 : f32
+    } -> tensor<16xf32>
+  return %2 : tensor<16xf32>
+}
+// CHECK-LABEL: func.func @no_split_parallel
+//   CHECK-NOT:   tensor.expand_shape
+//       CHECK:   linalg.generic
+//   CHECK-NOT:   linalg.generic
+
+// -----
+
+// Reductions smaller than the minimum size are left alone.
+
+func.func @no_split_small(%arg0: tensor<512xf32>) -> tensor<f32> {
+  %cst = arith.constant 0.000000e+00 : f32
+  %0 = linalg.init_tensor [] : tensor<f32>
+  %1 = linalg.fill ins(%cst : f32) outs(%0 : tensor<f32>) -> tensor<f32>
+  %2 = linalg.generic {
+      indexing_maps = [affine_map<(d0) -> (d0)>, affine_map<(d0) -> ()>],
+      iterator_types = ["reduction"]}
+      ins(%arg0 : tensor<512xf32>) outs(%1 : tensor<f32>) {
+    ^bb0(%b0: f32, %b1: f32):
+      %3 = arith.maxf %b0, %b1 : f32
+      linalg.yield %3 : f32
+    } -> tensor<f32>
+  return %2 : tensor<f32>
+}
+// CHECK-LABEL: func.func @no_split_small
+//   CHECK-NOT:   tensor.expand_shape
+//       CHECK:   linalg.generic
+//   CHECK-NOT:   linalg.generic
@@ -7,25 +7,66 @@
 #include "iree/compiler/Dialect/HAL/IR/HALOps.h"
 #include "iree/compiler/Dialect/Util/IR/UtilTypes.h"
 #include "iree/compiler/Dialect/VM/Conversion/ImportUtils.h"
+#include "iree/compiler/Dialect/VM/IR/VMOps.h"
+#include "llvm/ADT/Optional.h"
+#include "llvm/Support/MathExtras.h"
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "mlir/Transforms/DialectConversion.h"
 
 namespace mlir {
 namespace iree_compiler {
 
+// Maximum number of bytes a single coalesced hal.buffer.load.range may read.
+static constexpr int64_t kMaxCoalescedLoadLength = 256;
+
+// Returns the constant byte offset and byte width of |op| if it may be
+// coalesced with other loads into a single range load.
+static Optional<std::pair<int64_t, int64_t>> getCoalescableLoadRange(
+    IREE::HAL::BufferLoadOp op) {
+  auto type = op.result().getType();
+  if (!type.isIntOrFloat() || type.isF16() || type.isBF16()) return llvm::None;
+  int64_t byteWidth = IREE::Util::getRoundedElementByteWidth(type);
+  if (!llvm::isPowerOf2_64(byteWidth) || byteWidth > 8) return llvm::None;
+  APInt offset;
+  if (!matchPattern(op.source_offset(), m_ConstantInt(&offset))) {
+    return llvm::None;
+  }
+  int64_t byteOffset = offset.getSExtValue();
+  if (byteOffset < 0 || byteOffset % byteWidth != 0) return llvm::None;
+  return std::make_pair(byteOffset, byteWidth);
+}
+
 class BufferLoadOpConversion
     : public OpConversionPattern<IREE::HAL::BufferLoadOp> {
  public:
   BufferLoadOpConversion(MLIRContext *context, SymbolTable &importSymbols,
-                         TypeConverter &typeConverter, StringRef importName)
+                         TypeConverter &typeConverter, StringRef importName,
+                         StringRef rangeImportName)
       : OpConversionPattern(typeConverter, context) {
     importOp = importSymbols.lookup<IREE::VM::ImportOp>(importName);
     assert(importOp);
+    rangeImportOp = importSymbols.lookup<IREE::VM::ImportOp>(rangeImportName);
+    assert(rangeImportOp);
   }
 
   LogicalResult matchAndRewrite(
       IREE::HAL::BufferLoadOp op, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const override {
+    // Programs reading back shapes and other small control values tend to
+    // issue runs of loads from the same buffer; each scalar load is a round
+    // trip through the runtime so we read them all with a single range load
+    // into a VM buffer and extract the values from that.
+    int64_t baseOffset = 0;
+    int64_t length = 0;
+    auto loadOps = gatherCoalescedLoads(op, baseOffset, length);
+    if (loadOps.size() > 1) {
+      rewriteCoalescedLoads(loadOps, baseOffset, length,
+                            adaptor.source_buffer(), rewriter);
+      return success();
+    }
+
     auto importType = importOp.getFunctionType();
 
     auto originalType = op.result().getType();
@@ -92,7 +133,106 @@ class BufferLoadOpConversion
   }
 
  private:
+  // Gathers the loads following |rootOp| in its block that read from the same
+  // buffer at constant offsets within kMaxCoalescedLoadLength of it. Only ops
+  // without side effects may appear between the loads such that no store or
+  // call can be reordered. Returns the byte range covering all loads in
+  // |baseOffset| and |length|.
+  SmallVector<IREE::HAL::BufferLoadOp> gatherCoalescedLoads(
+      IREE::HAL::BufferLoadOp rootOp, int64_t &baseOffset,
+      int64_t &length) const {
+    SmallVector<IREE::HAL::BufferLoadOp> loadOps;
+    auto rootRange = getCoalescableLoadRange(rootOp);
+    if (!rootRange) return loadOps;
+    baseOffset = llvm::alignDown(rootRange->first, 8);
+    int64_t endOffset = rootRange->first + rootRange->second;
+    loadOps.push_back(rootOp);
+    for (Operation *op = rootOp->getNextNode(); op; op = op->getNextNode()) {
+      auto loadOp = dyn_cast<IREE::HAL::BufferLoadOp>(op);
+      if (!loadOp) {
+        if (op->getNumRegions() != 0 ||
+            !MemoryEffectOpInterface::hasNoEffect(op)) {
+          break;
+        }
+        continue;
+      }
+      if (loadOp.source_buffer() != rootOp.source_buffer()) continue;
+      auto range = getCoalescableLoadRange(loadOp);
+      if (!range || range->first < baseOffset ||
+          range->first + range->second - baseOffset >
+              kMaxCoalescedLoadLength) {
+        continue;
+      }
+      endOffset = std::max(endOffset, range->first + range->second);
+      loadOps.push_back(loadOp);
+    }
+    length = endOffset - baseOffset;
+    return loadOps;
+  }
+
+  // Replaces |loadOps| with a single range load of |length| bytes at
+  // |baseOffset| into a staging VM buffer and loads from that buffer.
+  void rewriteCoalescedLoads(ArrayRef<IREE::HAL::BufferLoadOp> loadOps,
+                             int64_t baseOffset, int64_t length,
+                             Value sourceBuffer,
+                             ConversionPatternRewriter &rewriter) const {
+    SmallVector<Location> loadLocs;
+    for (auto loadOp : loadOps) loadLocs.push_back(loadOp.getLoc());
+    auto loc = rewriter.getFusedLoc(loadLocs);
+
+    auto bufferRefType = IREE::VM::RefType::get(
+        IREE::VM::BufferType::get(rewriter.getContext()));
+    Value stagingLength = rewriter.create<IREE::VM::ConstI64Op>(loc, length);
+    Value stagingBuffer = rewriter.create<IREE::VM::BufferAllocOp>(
+        loc, bufferRefType, stagingLength);
+    auto callOp = rewriter.create<IREE::VM::CallOp>(
+        loc, SymbolRefAttr::get(rangeImportOp),
+        rangeImportOp.getFunctionType().getResults(),
+        ArrayRef<Value>{
+            sourceBuffer,
+            rewriter.create<IREE::VM::ConstI64Op>(loc, baseOffset),
+            stagingBuffer,
+            rewriter.create<IREE::VM::ConstI64ZeroOp>(loc),
+            stagingLength,
+        });
+    copyImportAttrs(rangeImportOp, callOp);
+
+    for (auto loadOp : loadOps) {
+      auto range = getCoalescableLoadRange(loadOp);
+      auto loadLoc = loadOp.getLoc();
+      Value stagingOffset = rewriter.create<IREE::VM::ConstI64Op>(
+          loadLoc, range->first - baseOffset);
+      Value value;
+      switch (range->second) {
+        case 1:
+          value = rewriter.create<IREE::VM::BufferLoadI8UOp>(
+              loadLoc, rewriter.getI32Type(), stagingBuffer, stagingOffset);
+          break;
+        case 2:
+          value = rewriter.create<IREE::VM::BufferLoadI16UOp>(
+              loadLoc, rewriter.getI32Type(), stagingBuffer, stagingOffset);
+          break;
+        case 4:
+          value = rewriter.create<IREE::VM::BufferLoadI32Op>(
+              loadLoc, rewriter.getI32Type(), stagingBuffer, stagingOffset);
+          break;
+        default:
+          value = rewriter.create<IREE::VM::BufferLoadI64Op>(
+              loadLoc, rewriter.getI64Type(), stagingBuffer, stagingOffset);
+          break;
+      }
+
+      // i32 -> f32, etc
+      auto targetType = typeConverter->convertType(loadOp.result().getType());
+      if (targetType.isa<FloatType>()) {
+        value = rewriter.create<arith::BitcastOp>(loadLoc, targetType, value);
+      }
+      rewriter.replaceOp(loadOp, {value});
+    }
+  }
+
   mutable IREE::VM::ImportOp importOp;
+  mutable IREE::VM::ImportOp rangeImportOp;
 };
 
 class BufferStoreOpConversion
@@ -186,7 +326,8 @@ void populateHALBufferToVMPatterns(MLIRContext *context,
   patterns.insert<VMImportOpConversion<IREE::HAL::BufferLengthOp>>(
       context, importSymbols, typeConverter, "hal.buffer.length");
   patterns.insert<BufferLoadOpConversion>(context, importSymbols, typeConverter,
-                                          "hal.buffer.load");
+                                          "hal.buffer.load",
+                                          "hal.buffer.load.range");
   patterns.insert<BufferStoreOpConversion>(context, importSymbols,
                                            typeConverter, "hal.buffer.store");
 }
@@ -15,6 +15,52 @@ namespace mlir {
 namespace iree_compiler {
 namespace {
 
+class CommandBufferCreateOpConversion
+    : public OpConversionPattern<IREE::HAL::CommandBufferCreateOp> {
+ public:
+  CommandBufferCreateOpConversion(MLIRContext *context,
+                                  SymbolTable &importSymbols,
+                                  TypeConverter &typeConverter,
+                                  StringRef importName)
+      : OpConversionPattern(typeConverter, context) {
+    importOp = importSymbols.lookup<IREE::VM::ImportOp>(importName);
+    assert(importOp);
+  }
+
+  LogicalResult matchAndRewrite(
+      IREE::HAL::CommandBufferCreateOp op, OpAdaptor adaptor,
+      ConversionPatternRewriter &rewriter) const override {
+    auto importType = importOp.getFunctionType();
+
+    // Command buffers without indirect bindings have no binding capacity.
+    Value bindingCapacity = adaptor.binding_capacity();
+    if (bindingCapacity) {
+      bindingCapacity = castToImportType(bindingCapacity,
+                                         rewriter.getI32Type(), rewriter);
+    } else {
+      bindingCapacity =
+          rewriter.createOrFold<IREE::VM::ConstI32Op>(op.getLoc(), 0);
+    }
+    SmallVector<Value, 4> callOperands = {
+        adaptor.device(),
+        rewriter.createOrFold<IREE::VM::ConstI32Op>(
+            op.getLoc(), static_cast<int32_t>(op.modes())),
+        rewriter.createOrFold<IREE::VM::ConstI32Op>(
+            op.getLoc(), static_cast<int32_t>(op.command_categories())),
+        bindingCapacity,
+    };
+
+    auto callOp = rewriter.replaceOpWithNewOp<IREE::VM::CallOp>(
+        op, SymbolRefAttr::get(importOp), importType.getResults(),
+        callOperands);
+    copyImportAttrs(importOp, callOp);
+    return success();
+  }
+
+ private:
+  mutable IREE::VM::ImportOp importOp;
+};
+
 class CommandBufferFillBufferOpConversion
     : public OpConversionPattern<IREE::HAL::CommandBufferFillBufferOp> {
  public:
@@ -120,13 +166,62 @@ class CommandBufferPushDescriptorSetOpConversion
   mutable IREE::VM::ImportOp importOp;
 };
 
+class CommandBufferPushDescriptorSetIndirectOpConversion
+    : public OpConversionPattern<
+          IREE::HAL::CommandBufferPushDescriptorSetIndirectOp> {
+ public:
+  CommandBufferPushDescriptorSetIndirectOpConversion(
+      MLIRContext *context, SymbolTable &importSymbols,
+      TypeConverter &typeConverter, StringRef importName)
+      : OpConversionPattern(context) {
+    importOp = importSymbols.lookup<IREE::VM::ImportOp>(importName);
+    assert(importOp);
+  }
+
+  LogicalResult matchAndRewrite(
+      IREE::HAL::CommandBufferPushDescriptorSetIndirectOp op,
+      OpAdaptor adaptor, ConversionPatternRewriter &rewriter) const override {
+    auto importType = importOp.getFunctionType();
+
+    SmallVector<Value, 8> callOperands = {
+        adaptor.command_buffer(),
+        adaptor.executable_layout(),
+        adaptor.set(),
+    };
+    SmallVector<int16_t, 5> segmentSizes = {
+        /*command_buffer=*/-1,
+        /*executable_layout=*/-1,
+        /*set=*/-1,
+        /*bindings=*/
+        static_cast<int16_t>(adaptor.binding_ordinals().size()),
+    };
+    for (size_t i = 0; i < adaptor.binding_ordinals().size(); ++i) {
+      callOperands.push_back(adaptor.binding_ordinals()[i]);
+      callOperands.push_back(adaptor.binding_slots()[i]);
+      callOperands.push_back(castToImportType(adaptor.binding_offsets()[i],
+                                              rewriter.getI64Type(), rewriter));
+      callOperands.push_back(castToImportType(adaptor.binding_lengths()[i],
+                                              rewriter.getI64Type(), rewriter));
+    }
+
+    auto callOp = rewriter.replaceOpWithNewOp<IREE::VM::CallVariadicOp>(
+        op, SymbolRefAttr::get(importOp), importType.getResults(), segmentSizes,
+        importType.getInputs(), callOperands);
+    copyImportAttrs(importOp, callOp);
+    return success();
+  }
+
+ private:
+  mutable IREE::VM::ImportOp importOp;
+};
+
 }  // namespace
 
 void populateHALCommandBufferToVMPatterns(MLIRContext *context,
                                           SymbolTable &importSymbols,
                                           TypeConverter &typeConverter,
                                           RewritePatternSet &patterns) {
-  patterns.insert<VMImportOpConversion<IREE::HAL::CommandBufferCreateOp>>(
+  patterns.insert<CommandBufferCreateOpConversion>(
       context, importSymbols, typeConverter, "hal.command_buffer.create");
   patterns.insert<VMImportOpConversion<IREE::HAL::CommandBufferFinalizeOp>>(
       context, importSymbols, typeConverter, "hal.command_buffer.finalize");
@@ -153,6 +248,9 @@ void populateHALCommandBufferToVMPatterns(MLIRContext *context,
   patterns.insert<CommandBufferPushDescriptorSetOpConversion>(
       context, importSymbols, typeConverter,
       "hal.command_buffer.push_descriptor_set");
+  patterns.insert<CommandBufferPushDescriptorSetIndirectOpConversion>(
+      context, importSymbols, typeConverter,
+      "hal.command_buffer.push_descriptor_set.indirect");
   patterns.insert<
       VMImportOpConversion<IREE::HAL::CommandBufferBindDescriptorSetOp>>(
       context, importSymbols, typeConverter,
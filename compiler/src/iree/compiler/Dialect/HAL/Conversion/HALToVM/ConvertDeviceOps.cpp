@@ -109,6 +109,59 @@ class DeviceQueryI64OpConversion
   mutable IREE::VM::ImportOp importOp;
 };
 
+class DeviceQueueExecuteIndirectOpConversion
+    : public OpConversionPattern<IREE::HAL::DeviceQueueExecuteIndirectOp> {
+ public:
+  DeviceQueueExecuteIndirectOpConversion(MLIRContext *context,
+                                         SymbolTable &importSymbols,
+                                         TypeConverter &typeConverter,
+                                         StringRef importName)
+      : OpConversionPattern(typeConverter, context) {
+    importOp = importSymbols.lookup<IREE::VM::ImportOp>(importName);
+    assert(importOp);
+  }
+
+  LogicalResult matchAndRewrite(
+      IREE::HAL::DeviceQueueExecuteIndirectOp op, OpAdaptor adaptor,
+      ConversionPatternRewriter &rewriter) const override {
+    auto importType = importOp.getFunctionType();
+
+    SmallVector<Value, 8> callOperands = {
+        adaptor.device(),
+        castToImportType(adaptor.queue_affinity(), rewriter.getI64Type(),
+                         rewriter),
+        adaptor.wait_fence(),
+        adaptor.signal_fence(),
+        adaptor.command_buffer(),
+    };
+    SmallVector<int16_t, 6> segmentSizes = {
+        /*device=*/-1,
+        /*queue_affinity=*/-1,
+        /*wait_fence=*/-1,
+        /*signal_fence=*/-1,
+        /*command_buffer=*/-1,
+        /*bindings=*/
+        static_cast<int16_t>(adaptor.binding_buffers().size()),
+    };
+    for (size_t i = 0; i < adaptor.binding_buffers().size(); ++i) {
+      callOperands.push_back(adaptor.binding_buffers()[i]);
+      callOperands.push_back(castToImportType(adaptor.binding_offsets()[i],
+                                              rewriter.getI64Type(), rewriter));
+      callOperands.push_back(castToImportType(adaptor.binding_lengths()[i],
+                                              rewriter.getI64Type(), rewriter));
+    }
+
+    auto callOp = rewriter.replaceOpWithNewOp<IREE::VM::CallVariadicOp>(
+        op, SymbolRefAttr::get(importOp), importType.getResults(), segmentSizes,
+        importType.getInputs(), callOperands);
+    copyImportAttrs(importOp, callOp);
+    return success();
+  }
+
+ private:
+  mutable IREE::VM::ImportOp importOp;
+};
+
 void populateHALDeviceToVMPatterns(MLIRContext *context,
                                    SymbolTable &importSymbols,
                                    TypeConverter &typeConverter,
@@ -119,6 +172,12 @@ void populateHALDeviceToVMPatterns(MLIRContext *context,
   patterns.insert<DeviceQueryIntCastOpConversion>(context, typeConverter);
   patterns.insert<DeviceQueryI64OpConversion>(
       context, importSymbols, typeConverter, "hal.device.query.i64");
+
+  patterns.insert<VMImportOpConversion<IREE::HAL::DeviceQueueExecuteOp>>(
+      context, importSymbols, typeConverter, "hal.device.queue.execute");
+  patterns.insert<DeviceQueueExecuteIndirectOpConversion>(
+      context, importSymbols, typeConverter,
+      "hal.device.queue.execute.indirect");
 }
 
 }  // namespace iree_compiler
@@ -84,6 +84,44 @@ func.func @buffer_load_f32(%buffer: !hal.buffer) -> f32 {
 
 // -----
 
+// CHECK-LABEL: @buffer_load_coalesced
+// CHECK-SAME: (%[[BUFFER:.+]]: !vm.ref<!hal.buffer>)
+func.func @buffer_load_coalesced(%buffer: !hal.buffer) -> (i32, i64, f32) {
+  %c64 = arith.constant 64 : index
+  %c72 = arith.constant 72 : index
+  %c80 = arith.constant 80 : index
+  // CHECK: %[[STAGING:.+]] = vm.buffer.alloc %c20 : !vm.buffer
+  // CHECK: vm.call @hal.buffer.load.range(%[[BUFFER]], %c64, %[[STAGING]], %zero, %c20) : (!vm.ref<!hal.buffer>, i64, !vm.buffer, i64, i64) -> ()
+  // CHECK: %[[RET0:.+]] = vm.buffer.load.i32 %[[STAGING]][%{{.+}}] : !vm.buffer -> i32
+  %0 = hal.buffer.load<%buffer: !hal.buffer>[%c64] : i32
+  // CHECK: %[[RET1:.+]] = vm.buffer.load.i64 %[[STAGING]][%c8] : !vm.buffer -> i64
+  %1 = hal.buffer.load<%buffer: !hal.buffer>[%c72] : i64
+  // CHECK: %[[RET2_I32:.+]] = vm.buffer.load.i32 %[[STAGING]][%c16] : !vm.buffer -> i32
+  // CHECK: %[[RET2:.+]] = vm.bitcast.i32.f32 %[[RET2_I32]]
+  %2 = hal.buffer.load<%buffer: !hal.buffer>[%c80] : f32
+  // CHECK-NOT: vm.call @hal.buffer.load(
+  // CHECK: return %[[RET0]], %[[RET1]], %[[RET2]]
+  return %0, %1, %2 : i32, i64, f32
+}
+
+// -----
+
+// CHECK-LABEL: @buffer_load_not_coalesced_across_store
+// CHECK-SAME: (%[[BUFFER:.+]]: !vm.ref<!hal.buffer>, %[[VALUE:.+]]: i32)
+func.func @buffer_load_not_coalesced_across_store(%buffer: !hal.buffer, %value: i32) -> (i32, i32) {
+  %c64 = arith.constant 64 : index
+  %c68 = arith.constant 68 : index
+  // CHECK: vm.call @hal.buffer.load(%[[BUFFER]], %c64, %c4)
+  %0 = hal.buffer.load<%buffer: !hal.buffer>[%c64] : i32
+  // CHECK: vm.call @hal.buffer.store(%[[VALUE]], %[[BUFFER]], %c68, %c4)
+  hal.buffer.store<%buffer : !hal.buffer>[%c68] value(%value : i32)
+  // CHECK: vm.call @hal.buffer.load(%[[BUFFER]], %c68, %c4)
+  %1 = hal.buffer.load<%buffer: !hal.buffer>[%c68] : i32
+  return %0, %1 : i32, i32
+}
+
+// -----
+
 // CHECK-LABEL: @buffer_store_i8
 // CHECK-SAME: (%[[BUFFER:.+]]: !vm.ref<!hal.buffer>, %[[VALUE:.+]]: i32)
 func.func @buffer_store_i8(%buffer: !hal.buffer, %value: i8) {
@@ -2,13 +2,23 @@
 
 // CHECK-LABEL: @command_buffer_create
 func.func @command_buffer_create(%arg0: !hal.device) {
-  // CHECK: %ref = vm.call @hal.command_buffer.create(%arg0, %c1, %c3) : (!vm.ref<!hal.device>, i32, i32) -> !vm.ref<!hal.command_buffer>
+  // CHECK: %ref = vm.call @hal.command_buffer.create(%arg0, %c1, %c3, %zero) : (!vm.ref<!hal.device>, i32, i32, i32) -> !vm.ref<!hal.command_buffer>
   %cmd = hal.command_buffer.create device(%arg0 : !hal.device) mode("OneShot") categories("Transfer|Dispatch") : !hal.command_buffer
   return
 }
 
 // -----
 
+// CHECK-LABEL: @command_buffer_create_reusable
+func.func @command_buffer_create_reusable(%arg0: !hal.device) {
+  %c4 = arith.constant 4 : index
+  // CHECK: %ref = vm.call @hal.command_buffer.create(%arg0, %zero, %c2, %c4) : (!vm.ref<!hal.device>, i32, i32, i32) -> !vm.ref<!hal.command_buffer>
+  %cmd = hal.command_buffer.create device(%arg0 : !hal.device) mode(None) categories(Dispatch) bindings(%c4) : !hal.command_buffer
+  return
+}
+
+// -----
+
 // CHECK-LABEL: @command_buffer_finalize
 func.func @command_buffer_finalize(%arg0: !hal.command_buffer) {
   // CHECK: vm.call @hal.command_buffer.finalize(%arg0) : (!vm.ref<!hal.command_buffer>) -> ()
@@ -129,6 +139,30 @@ func.func @command_buffer_bind_descriptor_set(
 
 // -----
 
+// CHECK-LABEL: @command_buffer_push_descriptor_set_indirect
+func.func @command_buffer_push_descriptor_set_indirect(
+  %arg0: !hal.command_buffer,
+  %arg1: !hal.executable_layout
+) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c4 = arith.constant 4 : index
+  %c128 = arith.constant 128 : index
+  // CHECK: vm.call.variadic @hal.command_buffer.push_descriptor_set.indirect(%arg0, %arg1, %zero, [
+  // CHECK-SAME: (%zero, %c1, %{{.+}}, %{{.+}}),
+  // CHECK-SAME: (%c1, %zero, %{{.+}}, %{{.+}})
+  // CHECK-SAME: ]) : (!vm.ref<!hal.command_buffer>, !vm.ref<!hal.executable_layout>, i32, tuple<i32, i32, i64, i64> ...)
+  hal.command_buffer.push_descriptor_set.indirect<%arg0 : !hal.command_buffer>
+      layout(%arg1 : !hal.executable_layout)[%c0]
+      bindings([
+        %c0 = slot(%c1)[%c0, %c128],
+        %c1 = slot(%c0)[%c128, %c128]
+      ])
+  return
+}
+
+// -----
+
 // CHECK-LABEL: @command_buffer_dispatch
 func.func @command_buffer_dispatch(
   %arg0: !hal.command_buffer,
@@ -94,3 +94,54 @@ func.func @device_query_i1_default(%device: !hal.device) -> i1 {
   // CHECK: return %[[OUT]]
   return %value : i1
 }
+
+// -----
+
+// CHECK-LABEL: @device_queue_execute
+func.func @device_queue_execute(
+    // CHECK-SAME: (%[[DEVICE:.+]]: !vm.ref<!hal.device>, %[[AFFINITY:.+]]: i64,
+    %device: !hal.device, %affinity: i64,
+    // CHECK-SAME:  %[[WAIT_FENCE:.+]]: !vm.ref<!hal.fence>, %[[SIGNAL_FENCE:.+]]: !vm.ref<!hal.fence>,
+    %wait_fence: !hal.fence, %signal_fence: !hal.fence,
+    // CHECK-SAME:  %[[CMD0:.+]]: !vm.ref<!hal.command_buffer>, %[[CMD1:.+]]: !vm.ref<!hal.command_buffer>)
+    %cmd0: !hal.command_buffer, %cmd1: !hal.command_buffer) {
+  // CHECK: vm.call.variadic @hal.device.queue.execute(
+  // CHECK-SAME: %[[DEVICE]], %[[AFFINITY]],
+  // CHECK-SAME: %[[WAIT_FENCE]], %[[SIGNAL_FENCE]],
+  // CHECK-SAME: [%[[CMD0]], %[[CMD1]]])
+  hal.device.queue.execute<%device : !hal.device>
+      affinity(%affinity)
+      wait(%wait_fence) signal(%signal_fence)
+      commands([%cmd0, %cmd1])
+  return
+}
+
+// -----
+
+// CHECK-LABEL: @device_queue_execute_indirect
+func.func @device_queue_execute_indirect(
+    // CHECK-SAME: (%[[DEVICE:.+]]: !vm.ref<!hal.device>, %[[AFFINITY:.+]]: i64,
+    %device: !hal.device, %affinity: i64,
+    // CHECK-SAME:  %[[WAIT_FENCE:.+]]: !vm.ref<!hal.fence>, %[[SIGNAL_FENCE:.+]]: !vm.ref<!hal.fence>,
+    %wait_fence: !hal.fence, %signal_fence: !hal.fence,
+    // CHECK-SAME:  %[[CMD:.+]]: !vm.ref<!hal.command_buffer>,
+    %cmd: !hal.command_buffer,
+    // CHECK-SAME:  %[[BUFFER0:.+]]: !vm.ref<!hal.buffer>, %[[BUFFER1:.+]]: !vm.ref<!hal.buffer>)
+    %buffer0: !hal.buffer, %buffer1: !hal.buffer) {
+  %c0 = arith.constant 0 : index
+  %c128 = arith.constant 128 : index
+  %c256 = arith.constant 256 : index
+  // CHECK: vm.call.variadic @hal.device.queue.execute.indirect(
+  // CHECK-SAME: %[[DEVICE]], %[[AFFINITY]],
+  // CHECK-SAME: %[[WAIT_FENCE]], %[[SIGNAL_FENCE]], %[[CMD]],
+  // CHECK-SAME: [(%[[BUFFER0]], %{{.+}}, %{{.+}}), (%[[BUFFER1]], %{{.+}}, %{{.+}})])
+  hal.device.queue.execute.indirect<%device : !hal.device>
+      affinity(%affinity)
+      wait(%wait_fence) signal(%signal_fence)
+      command(%cmd)
+      bindings([
+        (%buffer0 : !hal.buffer)[%c0, %c128],
+        (%buffer1 : !hal.buffer)[%c128, %c256]
+      ])
+  return
+}
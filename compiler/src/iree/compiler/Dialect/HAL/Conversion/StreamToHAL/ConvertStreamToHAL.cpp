@@ -54,6 +54,30 @@ static Value lookupAllocatorFor(Operation *op, OpBuilder &builder) {
   return allocatorOp.result();
 }
 
+// Returns a fence that signals when the timeline of a new semaphore reaches 1.
+// Returns the semaphore in |outSemaphore| and its payload in |outValue| when
+// requested so that the timepoint can be exported.
+static Value makeSignalFence(Location loc, Value device, OpBuilder &builder,
+                             Value *outSemaphore = nullptr,
+                             Value *outValue = nullptr) {
+  auto initialValue = builder.create<arith::ConstantIndexOp>(loc, 0);
+  auto signalValue = builder.create<arith::ConstantIndexOp>(loc, 1);
+  auto semaphore = builder.create<IREE::HAL::SemaphoreCreateOp>(
+      loc, builder.getType<IREE::HAL::SemaphoreType>(), device, initialValue);
+  auto fence = builder.create<IREE::HAL::FenceCreateOp>(
+      loc, builder.getType<IREE::HAL::FenceType>(),
+      ValueRange{semaphore.result()}, ValueRange{signalValue});
+  if (outSemaphore) *outSemaphore = semaphore.result();
+  if (outValue) *outValue = signalValue;
+  return fence.result();
+}
+
+// Returns a null fence indicating a timepoint that has already been reached.
+static Value makeImmediateFence(Location loc, OpBuilder &builder) {
+  return builder.create<IREE::Util::NullOp>(
+      loc, builder.getType<IREE::HAL::FenceType>());
+}
+
 // Scans all of the stream.cmd.* ops in the region to derive a command category.
 static IREE::HAL::CommandCategoryBitfield deriveCommandCategories(
     Region &region) {
@@ -266,9 +290,12 @@ struct ResourceAllocaOpPattern
         adaptor.storage_size());
 
     // TODO(benvanik): stream ordered allocations.
-    auto resolvedTimepoint =
-        rewriter.create<arith::ConstantIndexOp>(allocaOp.getLoc(), 0)
-            .getResult();
+    // The operation is performed synchronously but any awaited timepoint is
+    // forwarded so that ordering is preserved for users of the result.
+    Value resolvedTimepoint = adaptor.await_timepoint();
+    if (!resolvedTimepoint) {
+      resolvedTimepoint = makeImmediateFence(allocaOp.getLoc(), rewriter);
+    }
 
     rewriter.replaceOp(allocaOp, {allocateOp.result(), resolvedTimepoint});
     return success();
@@ -282,9 +309,12 @@ struct ResourceDeallocaOpPattern
       IREE::Stream::ResourceDeallocaOp deallocaOp, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const override {
     // TODO(benvanik): stream ordered allocations.
-    auto resolvedTimepoint =
-        rewriter.create<arith::ConstantIndexOp>(deallocaOp.getLoc(), 0)
-            .getResult();
+    // The operation is performed synchronously but any awaited timepoint is
+    // forwarded so that ordering is preserved for users of the result.
+    Value resolvedTimepoint = adaptor.await_timepoint();
+    if (!resolvedTimepoint) {
+      resolvedTimepoint = makeImmediateFence(deallocaOp.getLoc(), rewriter);
+    }
     rewriter.replaceOp(deallocaOp, {resolvedTimepoint});
     return success();
   }
@@ -807,11 +837,15 @@ struct CmdExecuteOpPattern
     auto loc = executeOp.getLoc();
     auto device = lookupDeviceFor(executeOp, rewriter);
 
-    // TODO(benvanik): disable inline execution once we have semaphores.
-    // We can look ahead to see if there's an await immediately to trigger the
-    // inline execution.
-    auto modes = IREE::HAL::CommandBufferModeBitfield::OneShot |
-                 IREE::HAL::CommandBufferModeBitfield::AllowInlineExecution;
+    // Inline execution is only possible when there is nothing to wait on as
+    // otherwise the host would block on the wait during submission.
+    // TODO(benvanik): look ahead to see if there's an await immediately after
+    // the submission and allow inline execution then.
+    auto modes = IREE::HAL::CommandBufferModeBitfield::OneShot;
+    if (!executeOp.await_timepoint()) {
+      modes =
+          modes | IREE::HAL::CommandBufferModeBitfield::AllowInlineExecution;
+    }
 
     // Derive the command buffer type based on the kind of operations present.
     // This can help the submission get routed to appropriate hardware queues
@@ -823,7 +857,7 @@ struct CmdExecuteOpPattern
         rewriter
             .create<IREE::HAL::CommandBufferCreateOp>(
                 loc, rewriter.getType<IREE::HAL::CommandBufferType>(), device,
-                modes, commandCategories)
+                modes, commandCategories, /*binding_capacity=*/Value{})
             .result();
     mapping->mapCommandBuffer(executeOp, commandBuffer);
 
@@ -839,14 +873,17 @@ struct CmdExecuteOpPattern
     rewriter.mergeBlockBefore(&executeOp.body().front(), endOp,
                               adaptor.operands());
 
-    // TODO(benvanik): we should queue a submit here with the semaphore instead.
-    rewriter.create<IREE::HAL::ExSubmitAndWaitOp>(loc, device, commandBuffer);
-
-    // TODO(benvanik): propagate semaphore information.
-    auto resolvedTimepoint =
-        rewriter.create<arith::ConstantIndexOp>(loc, 0).getResult();
-
-    rewriter.replaceOp(executeOp, resolvedTimepoint);
+    // Queue execution after the awaited timepoint (if any) without blocking
+    // the host; the result timepoint is the fence signaled when it completes.
+    Value waitFence = adaptor.await_timepoint();
+    if (!waitFence) waitFence = makeImmediateFence(loc, rewriter);
+    auto signalFence = makeSignalFence(loc, device, rewriter);
+    auto queueAffinity = rewriter.create<arith::ConstantIntOp>(loc, -1, 64);
+    rewriter.create<IREE::HAL::DeviceQueueExecuteOp>(
+        loc, device, queueAffinity, waitFence, signalFence,
+        ValueRange{commandBuffer});
+
+    rewriter.replaceOp(executeOp, signalFence);
     return success();
   }
 };
@@ -892,8 +929,8 @@ struct TimepointImmediateOpPattern
   LogicalResult matchAndRewrite(
       IREE::Stream::TimepointImmediateOp immediateOp, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const override {
-    // TODO(benvanik): model timepoints as semaphores.
-    rewriter.replaceOpWithNewOp<arith::ConstantIndexOp>(immediateOp, 0);
+    rewriter.replaceOp(immediateOp,
+                       makeImmediateFence(immediateOp.getLoc(), rewriter));
     return success();
   }
 };
@@ -904,24 +941,31 @@ struct TimepointImportOpPattern
   LogicalResult matchAndRewrite(
       IREE::Stream::TimepointImportOp importOp, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const override {
-    // Only handle imports from HAL semaphores.
+    // Fences are timepoints already.
     auto operands = adaptor.operands();
+    if (operands.size() == 1 &&
+        operands[0].getType().isa<IREE::HAL::FenceType>()) {
+      rewriter.replaceOp(importOp, operands[0]);
+      return success();
+    }
+
+    // Otherwise only handle imports from HAL semaphores.
     if (operands.size() != 2 ||
         !operands[0].getType().isa<IREE::HAL::SemaphoreType>() ||
         !operands[1].getType().isIntOrIndex()) {
       return rewriter.notifyMatchFailure(importOp,
-                                         "only imports from HAL semaphore + "
-                                         "sequence value tuples are supported");
+                                         "only imports from HAL fences or "
+                                         "semaphore + sequence value tuples "
+                                         "are supported");
     }
-
-    // TODO(benvanik): model timepoints as semaphores.
-    // For now we just block on the semaphore.
-    auto awaitOp = rewriter.create<IREE::HAL::SemaphoreAwaitOp>(
-        importOp.getLoc(), rewriter.getI32Type(), operands[0], operands[1]);
-    rewriter.create<IREE::Util::StatusCheckOkOp>(
-        importOp.getLoc(), awaitOp.status(),
-        "failed to wait on imported semaphore");
-    rewriter.replaceOpWithNewOp<arith::ConstantIndexOp>(importOp, 0);
+    Value value = operands[1];
+    if (!value.getType().isIndex()) {
+      value = rewriter.createOrFold<arith::IndexCastOp>(
+          importOp.getLoc(), rewriter.getIndexType(), value);
+    }
+    rewriter.replaceOpWithNewOp<IREE::HAL::FenceCreateOp>(
+        importOp, rewriter.getType<IREE::HAL::FenceType>(),
+        ValueRange{operands[0]}, ValueRange{value});
     return success();
   }
 };
@@ -932,39 +976,81 @@ struct TimepointExportOpPattern
   LogicalResult matchAndRewrite(
       IREE::Stream::TimepointExportOp exportOp, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const override {
-    // Only handle exports into HAL semaphores.
+    // Fences are timepoints already.
+    if (exportOp.getNumResults() == 1 &&
+        exportOp.getResult(0).getType().isa<IREE::HAL::FenceType>()) {
+      rewriter.replaceOp(exportOp, adaptor.await_timepoint());
+      return success();
+    }
+
+    // Otherwise only handle exports into HAL semaphores.
     if (exportOp.getNumResults() != 2 ||
         !exportOp.getResult(0).getType().isa<IREE::HAL::SemaphoreType>() ||
         !exportOp.getResult(1).getType().isIntOrIndex()) {
       return rewriter.notifyMatchFailure(exportOp,
-                                         "only exports to HAL semaphore + "
-                                         "sequence value tuples are supported");
+                                         "only exports to HAL fences or "
+                                         "semaphore + sequence value tuples "
+                                         "are supported");
     }
 
     auto loc = exportOp.getLoc();
     auto device = lookupDeviceFor(exportOp, rewriter);
 
-    // TODO(benvanik): model timepoints as semaphores.
-    // For now we just create a signaled semaphore.
-    auto exportValue = rewriter.create<arith::ConstantIndexOp>(loc, 0);
-    auto exportSemaphore = rewriter.create<IREE::HAL::SemaphoreCreateOp>(
-        loc, rewriter.getType<IREE::HAL::SemaphoreType>(), device, exportValue);
+    // The timepoint may span multiple semaphores so we forward it onto a new
+    // semaphore with a queue barrier the caller can wait on.
+    Value exportSemaphore;
+    Value exportValue;
+    auto signalFence =
+        makeSignalFence(loc, device, rewriter, &exportSemaphore, &exportValue);
+    auto queueAffinity = rewriter.create<arith::ConstantIntOp>(loc, -1, 64);
+    rewriter.create<IREE::HAL::DeviceQueueExecuteOp>(
+        loc, device, queueAffinity, adaptor.await_timepoint(), signalFence,
+        ValueRange{});
+    auto resultType = exportOp.getResult(1).getType();
+    if (!resultType.isIndex()) {
+      exportValue = rewriter.createOrFold<arith::IndexCastOp>(loc, resultType,
+                                                              exportValue);
+    }
     rewriter.replaceOp(exportOp, {exportSemaphore, exportValue});
     return success();
   }
 };
 
+struct TimepointChainExternalOpPattern
+    : public StreamConversionPattern<IREE::Stream::TimepointChainExternalOp> {
+  using StreamConversionPattern::StreamConversionPattern;
+  LogicalResult matchAndRewrite(
+      IREE::Stream::TimepointChainExternalOp exportOp, OpAdaptor adaptor,
+      ConversionPatternRewriter &rewriter) const override {
+    // Only handle chaining into HAL fences.
+    auto externalValues = adaptor.external_values();
+    if (externalValues.size() != 1 ||
+        !externalValues[0].getType().isa<IREE::HAL::FenceType>()) {
+      return rewriter.notifyMatchFailure(
+          exportOp, "only exports to a single HAL fence are supported");
+    }
+
+    // Signal the fence with a queue barrier once the timepoint is reached.
+    // This does not block the host.
+    auto loc = exportOp.getLoc();
+    auto device = lookupDeviceFor(exportOp, rewriter);
+    auto queueAffinity = rewriter.create<arith::ConstantIntOp>(loc, -1, 64);
+    rewriter.replaceOpWithNewOp<IREE::HAL::DeviceQueueExecuteOp>(
+        exportOp, device, queueAffinity, adaptor.await_timepoint(),
+        externalValues[0], ValueRange{});
+    return success();
+  }
+};
+
 struct TimepointJoinOpPattern
     : public StreamConversionPattern<IREE::Stream::TimepointJoinOp> {
   using StreamConversionPattern::StreamConversionPattern;
   LogicalResult matchAndRewrite(
       IREE::Stream::TimepointJoinOp joinOp, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const override {
-    // TODO(benvanik): model timepoints as semaphores.
-    // This should be a max() of the operand timepoints. Could be done with
-    // affine expressions, but since everything is always 0 we just max(0,0)=0
-    // here :)
-    rewriter.replaceOpWithNewOp<arith::ConstantIndexOp>(joinOp, 0);
+    rewriter.replaceOpWithNewOp<IREE::HAL::FenceJoinOp>(
+        joinOp, rewriter.getType<IREE::HAL::FenceType>(),
+        adaptor.await_timepoints());
     return success();
   }
 };
@@ -975,7 +1061,13 @@ struct TimepointAwaitOpPattern
   LogicalResult matchAndRewrite(
       IREE::Stream::TimepointAwaitOp awaitOp, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const override {
-    // TODO(benvanik): model timepoints as semaphores.
+    auto loc = awaitOp.getLoc();
+    auto timeoutMillis = rewriter.create<arith::ConstantIntOp>(loc, -1, 32);
+    auto fenceAwaitOp = rewriter.create<IREE::HAL::FenceAwaitOp>(
+        loc, rewriter.getI32Type(), timeoutMillis,
+        ValueRange{adaptor.await_timepoint()});
+    rewriter.create<IREE::Util::StatusCheckOkOp>(
+        loc, fenceAwaitOp.status(), "failed to wait on timepoint");
     rewriter.replaceOp(awaitOp, adaptor.operands());
     return success();
   }
@@ -1003,8 +1095,8 @@ struct GlobalTimepointConversionPattern
     auto initialValue = op.initial_value();
     if (!initialValue.hasValue()) return failure();
     if (!initialValue->isa<IREE::Stream::TimepointAttr>()) return failure();
-    rewriter.updateRootInPlace(
-        op, [&]() { op.initial_valueAttr(rewriter.getIndexAttr(0)); });
+    // Fence globals are null (immediately reached) by default.
+    rewriter.updateRootInPlace(op, [&]() { op.removeInitial_valueAttr(); });
     return success();
   }
 };
@@ -1026,11 +1118,10 @@ void populateStreamToHALPatterns(MLIRContext *context,
 
   typeConverter.addConversion(
       [=](IREE::Stream::TimepointType type, SmallVectorImpl<Type> &results) {
-        // TODO(benvanik): model timepoints as semaphores.
-        // This may become a !hal.semaphore + index, or some !hal.timepoint that
-        // we then do more analysis on once we know what devices are in use
-        // where.
-        results.push_back(IndexType::get(context));
+        // Timepoints are fences that may span multiple semaphores.
+        // TODO(benvanik): analysis to use raw semaphores + values where the
+        // timepoint is known to be on a single timeline.
+        results.push_back(IREE::HAL::FenceType::get(context));
         return success();
       });
 
@@ -1052,8 +1143,9 @@ void populateStreamToHALPatterns(MLIRContext *context,
               CmdExecuteOpPattern, CmdSerialOpPattern, CmdConcurrentOpPattern>(
           mapping, typeConverter, context);
   patterns.insert<TimepointImmediateOpPattern, TimepointImportOpPattern,
-                  TimepointExportOpPattern, TimepointJoinOpPattern,
-                  TimepointAwaitOpPattern>(mapping, typeConverter, context);
+                  TimepointExportOpPattern, TimepointChainExternalOpPattern,
+                  TimepointJoinOpPattern, TimepointAwaitOpPattern>(
+      mapping, typeConverter, context);
   patterns.insert<ElideYieldOpPattern>(mapping, typeConverter, context);
 }
 
@@ -17,7 +17,10 @@ func.func @cmdMemoryControl(%arg0: !stream.resource<transient>, %arg1: index) ->
     stream.cmd.discard %arg2[%c0 for %c128] : !stream.resource<transient>{%arg1}
   } => !stream.timepoint
   // CHECK-NEXT: hal.command_buffer.finalize<%[[CMD]]
-  // CHECK-NEXT: hal.ex.submit_and_wait
+  // CHECK: %[[SIGNAL_FENCE:.+]] = hal.fence.create
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device>
+  // CHECK-SAME: signal(%[[SIGNAL_FENCE]])
+  // CHECK-SAME: commands([%[[CMD]]])
   return %0 : !stream.timepoint
 }
 
@@ -37,7 +40,10 @@ func.func @cmdFill(%arg0: !stream.resource<transient>, %arg1: index) -> !stream.
     // CHECK-NEXT: hal.command_buffer.execution_barrier<%[[CMD]]
   } => !stream.timepoint
   // CHECK-NEXT: hal.command_buffer.finalize<%[[CMD]]
-  // CHECK-NEXT: hal.ex.submit_and_wait
+  // CHECK: %[[SIGNAL_FENCE:.+]] = hal.fence.create
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device>
+  // CHECK-SAME: signal(%[[SIGNAL_FENCE]])
+  // CHECK-SAME: commands([%[[CMD]]])
   return %0 : !stream.timepoint
 }
 
@@ -57,7 +63,10 @@ func.func @cmdCopy(%arg0: !stream.resource<transient>, %arg1: index, %arg2: !str
     // CHECK-NEXT: hal.command_buffer.execution_barrier<%[[CMD]]
   } => !stream.timepoint
   // CHECK-NEXT: hal.command_buffer.finalize<%[[CMD]]
-  // CHECK-NEXT: hal.ex.submit_and_wait
+  // CHECK: %[[SIGNAL_FENCE:.+]] = hal.fence.create
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device>
+  // CHECK-SAME: signal(%[[SIGNAL_FENCE]])
+  // CHECK-SAME: commands([%[[CMD]]])
   return %0 : !stream.timepoint
 }
 
@@ -93,7 +102,11 @@ func.func @cmdExecute(%arg0: !stream.resource<transient>, %arg1: index, %arg2: !
     }
   } => !stream.timepoint
   // CHECK-NEXT: hal.command_buffer.finalize<%[[CMD]]
-  // CHECK-NEXT: hal.ex.submit_and_wait
+  // CHECK: %[[SIGNAL_FENCE:.+]] = hal.fence.create
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device>
+  // CHECK-SAME: wait(%arg4) signal(%[[SIGNAL_FENCE]])
+  // CHECK-SAME: commands([%[[CMD]]])
+  // CHECK: return %[[SIGNAL_FENCE]]
   return %0 : !stream.timepoint
 }
 
@@ -179,6 +192,9 @@ func.func @cmdDispatch(%arg0: !stream.resource<transient>, %arg1: index, %arg2:
     // CHECK: hal.command_buffer.execution_barrier<%[[CMD]]
   } => !stream.timepoint
   // CHECK-NEXT: hal.command_buffer.finalize<%[[CMD]]
-  // CHECK-NEXT: hal.ex.submit_and_wait
+  // CHECK: %[[SIGNAL_FENCE:.+]] = hal.fence.create
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device>
+  // CHECK-SAME: signal(%[[SIGNAL_FENCE]])
+  // CHECK-SAME: commands([%[[CMD]]])
   return %0 : !stream.timepoint
 }
@@ -26,7 +26,7 @@ func.func @resourceAlloca(%arg0: index, %await_timepoint: !stream.timepoint) ->
   // CHECK-SAME: usage("{{.+}}Transfer{{.+}}Dispatch{{.+}}")
   // CHECK-SAME: : !hal.buffer{%arg0}
   %0:2 = stream.resource.alloca uninitialized : !stream.resource<staging>{%arg0} => !stream.timepoint
-  // CHECK: %[[IMMEDIATE:.+]] = arith.constant 0 : index
+  // CHECK: %[[IMMEDIATE:.+]] = util.null : !hal.fence
   // CHECK: return %[[RET0]], %[[IMMEDIATE]]
   return %0#0, %0#1 : !stream.resource<staging>, !stream.timepoint
 }
@@ -42,8 +42,7 @@ func.func @resourceAllocaAwait(%arg0: index, %await_timepoint: !stream.timepoint
   // CHECK-SAME: usage("{{.+}}Transfer{{.+}}Dispatch{{.+}}")
   // CHECK-SAME: : !hal.buffer{%arg0}
   %0:2 = stream.resource.alloca uninitialized await(%await_timepoint) => !stream.resource<staging>{%arg0} => !stream.timepoint
-  // CHECK: %[[IMMEDIATE:.+]] = arith.constant 0 : index
-  // CHECK: return %[[RET0]], %[[IMMEDIATE]]
+  // CHECK: return %[[RET0]], %arg1
   return %0#0, %0#1 : !stream.resource<staging>, !stream.timepoint
 }
 
@@ -54,7 +53,7 @@ func.func @resourceAllocaAwait(%arg0: index, %await_timepoint: !stream.timepoint
 // CHECK-LABEL: @resourceDealloca
 func.func @resourceDealloca(%arg0: index, %arg1: !stream.resource<staging>, %arg2: !stream.timepoint) -> !stream.timepoint {
   %0 = stream.resource.dealloca %arg1 : !stream.resource<staging>{%arg0} => !stream.timepoint
-  // CHECK: %[[IMMEDIATE:.+]] = arith.constant 0 : index
+  // CHECK: %[[IMMEDIATE:.+]] = util.null : !hal.fence
   // CHECK: return %[[IMMEDIATE]]
   return %0 : !stream.timepoint
 }
@@ -66,8 +65,7 @@ func.func @resourceDealloca(%arg0: index, %arg1: !stream.resource<staging>, %arg
 // CHECK-LABEL: @resourceDeallocaAwait
 func.func @resourceDeallocaAwait(%arg0: index, %arg1: !stream.resource<staging>, %arg2: !stream.timepoint) -> !stream.timepoint {
   %0 = stream.resource.dealloca await(%arg2) => %arg1 : !stream.resource<staging>{%arg0} => !stream.timepoint
-  // CHECK: %[[IMMEDIATE:.+]] = arith.constant 0 : index
-  // CHECK: return %[[IMMEDIATE]]
+  // CHECK: return %arg2
   return %0 : !stream.timepoint
 }
 
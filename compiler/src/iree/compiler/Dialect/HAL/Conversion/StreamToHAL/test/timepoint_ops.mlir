@@ -1,12 +1,9 @@
 // RUN: iree-opt --split-input-file --iree-hal-conversion %s | FileCheck %s
 
-// TODO(#1285): implement timepoint lowering into HAL semaphores.
-// For now all timepoints turn into ints and are mostly ignored.
-
 // CHECK-LABEL: @rwTimepoint
-// CHECK-SAME: = 0 : index
+// CHECK-SAME: : !hal.fence
 util.global private mutable @rwTimepoint = #stream.timepoint<immediate>
-// CHECK: func.func @globalTimepoint(%arg0: index) -> index
+// CHECK: func.func @globalTimepoint(%arg0: !hal.fence) -> !hal.fence
 func.func @globalTimepoint(%arg0: !stream.timepoint) -> !stream.timepoint {
   // CHECK: util.global.store %arg0, @rwTimepoint
   util.global.store %arg0, @rwTimepoint : !stream.timepoint
@@ -20,42 +17,72 @@ func.func @globalTimepoint(%arg0: !stream.timepoint) -> !stream.timepoint {
 
 // CHECK-LABEL: @timepointImmediate
 func.func @timepointImmediate() -> !stream.timepoint {
-  // CHECK: %[[TIMEPOINT:.+]] = arith.constant 0
+  // CHECK: %[[FENCE:.+]] = util.null : !hal.fence
   %0 = stream.timepoint.immediate => !stream.timepoint
-  // CHECK: return %[[TIMEPOINT]]
+  // CHECK: return %[[FENCE]]
   return %0 : !stream.timepoint
 }
 
 // -----
 
-// CHECK-LABEL: @timepointImport
-func.func @timepointImport(%arg0: !hal.semaphore, %arg1: index) -> !stream.timepoint {
-  // CHECK: %[[WAIT_OK:.+]] = hal.semaphore.await<%arg0 : !hal.semaphore> until(%arg1) : i32
-  // CHECK: util.status.check_ok %[[WAIT_OK]]
-  // CHECK: %[[TIMEPOINT:.+]] = arith.constant 0
+// CHECK-LABEL: @timepointImportSemaphore
+func.func @timepointImportSemaphore(%arg0: !hal.semaphore, %arg1: index) -> !stream.timepoint {
+  // CHECK: %[[FENCE:.+]] = hal.fence.create at([%arg0]) values([%arg1]) : !hal.fence
   %0 = stream.timepoint.import %arg0, %arg1 : (!hal.semaphore, index) => !stream.timepoint
-  // CHECK: return %[[TIMEPOINT]]
+  // CHECK: return %[[FENCE]]
+  return %0 : !stream.timepoint
+}
+
+// -----
+
+// CHECK-LABEL: @timepointImportFence
+func.func @timepointImportFence(%arg0: !hal.fence) -> !stream.timepoint {
+  %0 = stream.timepoint.import %arg0 : (!hal.fence) => !stream.timepoint
+  // CHECK: return %arg0
   return %0 : !stream.timepoint
 }
 
 // -----
 
-// CHECK-LABEL: @timepointExport
-func.func @timepointExport(%arg0: !stream.timepoint) -> (!hal.semaphore, index) {
-  // CHECK: %[[TIMEPOINT:.+]] = arith.constant 0
-  // CHECK: %[[SEMAPHORE:.+]] = hal.semaphore.create device(%device : !hal.device) initial(%c0) : !hal.semaphore
+// CHECK-LABEL: @timepointExportSemaphore
+func.func @timepointExportSemaphore(%arg0: !stream.timepoint) -> (!hal.semaphore, index) {
+  // CHECK-DAG: %[[C0:.+]] = arith.constant 0 : index
+  // CHECK-DAG: %[[C1:.+]] = arith.constant 1 : index
+  // CHECK: %[[SEMAPHORE:.+]] = hal.semaphore.create device(%{{.+}} : !hal.device) initial(%[[C0]]) : !hal.semaphore
+  // CHECK: %[[SIGNAL_FENCE:.+]] = hal.fence.create at([%[[SEMAPHORE]]]) values([%[[C1]]]) : !hal.fence
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device>
+  // CHECK-SAME: wait(%arg0) signal(%[[SIGNAL_FENCE]])
   %0:2 = stream.timepoint.export %arg0 => (!hal.semaphore, index)
-  // CHECK: return %[[SEMAPHORE]], %[[TIMEPOINT]]
+  // CHECK: return %[[SEMAPHORE]], %[[C1]]
   return %0#0, %0#1 : !hal.semaphore, index
 }
 
 // -----
 
+// CHECK-LABEL: @timepointExportFence
+func.func @timepointExportFence(%arg0: !stream.timepoint) -> !hal.fence {
+  %0 = stream.timepoint.export %arg0 => (!hal.fence)
+  // CHECK: return %arg0
+  return %0 : !hal.fence
+}
+
+// -----
+
+// CHECK-LABEL: @timepointChainExternal
+func.func @timepointChainExternal(%arg0: !stream.timepoint, %arg1: !hal.fence) {
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device>
+  // CHECK-SAME: wait(%arg0) signal(%arg1)
+  stream.timepoint.chain_external %arg0 => (%arg1 : !hal.fence)
+  return
+}
+
+// -----
+
 // CHECK-LABEL: @timepointJoin
 func.func @timepointJoin(%arg0: !stream.timepoint, %arg1: !stream.timepoint) -> !stream.timepoint {
-  // CHECK: %[[TIMEPOINT:.+]] = arith.constant 0
+  // CHECK: %[[FENCE:.+]] = hal.fence.join at([%arg0, %arg1]) : !hal.fence
   %0 = stream.timepoint.join max(%arg0, %arg1) => !stream.timepoint
-  // CHECK: return %[[TIMEPOINT]]
+  // CHECK: return %[[FENCE]]
   return %0 : !stream.timepoint
 }
 
@@ -65,6 +92,9 @@ func.func @timepointJoin(%arg0: !stream.timepoint, %arg1: !stream.timepoint) ->
 func.func @timepointAwait(%arg0: !stream.timepoint, %arg1: !stream.resource<staging>, %arg2: !stream.resource<*>) -> (!stream.resource<staging>, !stream.resource<*>) {
   %c100 = arith.constant 100 : index
   %c200 = arith.constant 200 : index
+  // CHECK: %[[TIMEOUT:.+]] = arith.constant -1 : i32
+  // CHECK: %[[WAIT_OK:.+]] = hal.fence.await until([%arg0]) timeout_millis(%[[TIMEOUT]]) : i32
+  // CHECK: util.status.check_ok %[[WAIT_OK]]
   %0:2 = stream.timepoint.await %arg0 => %arg1, %arg2 : !stream.resource<staging>{%c100}, !stream.resource<*>{%c200}
   // CHECK: return %arg1, %arg2
   return %0#0, %0#1 : !stream.resource<staging>, !stream.resource<*>
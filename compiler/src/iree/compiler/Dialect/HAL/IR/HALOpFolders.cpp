@@ -30,6 +30,7 @@ namespace HAL {
 //===----------------------------------------------------------------------===//
 
 OpFoldResult TensorImportOp::fold(ArrayRef<Attribute> operands) {
+  if (wait_fence()) return {};  // must preserve the wait
   if (auto exportOp = source().getDefiningOp<TensorExportOp>()) {
     if (exportOp.source().getType() == target().getType() &&
         exportOp.source_encoding() == target_encoding()) {
@@ -41,6 +42,7 @@ OpFoldResult TensorImportOp::fold(ArrayRef<Attribute> operands) {
 
 OpFoldResult TensorExportOp::fold(ArrayRef<Attribute> operands) {
   if (auto importOp = source().getDefiningOp<TensorImportOp>()) {
+    if (importOp.wait_fence()) return {};  // must preserve the wait
     if (importOp.source().getType() == target().getType() &&
         importOp.target_encoding() == source_encoding()) {
       return importOp.source();
@@ -283,6 +285,16 @@ void CommandBufferPushDescriptorSetOp::getCanonicalizationPatterns(
 
 // TODO(benvanik): fold matches that are known true based on device config.
 
+//===----------------------------------------------------------------------===//
+// hal.fence.join
+//===----------------------------------------------------------------------===//
+
+OpFoldResult FenceJoinOp::fold(ArrayRef<Attribute> operands) {
+  // Fences are immutable and joining a single fence is a no-op.
+  if (fences().size() == 1) return fences().front();
+  return {};
+}
+
 }  // namespace HAL
 }  // namespace IREE
 }  // namespace iree_compiler
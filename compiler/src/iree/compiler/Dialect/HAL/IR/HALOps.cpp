@@ -118,6 +118,125 @@ static void printDescriptorSetBindings(OpAsmPrinter &p, Operation *op,
   p.printNewline();
 }
 
+//===----------------------------------------------------------------------===//
+// custom<DescriptorSetBindingSlots>($binding_ordinals,
+//                                   $binding_slots,
+//                                   $binding_offsets,
+//                                   $binding_lengths)
+//===----------------------------------------------------------------------===//
+
+static ParseResult parseDescriptorSetBindingSlots(
+    OpAsmParser &parser,
+    SmallVectorImpl<OpAsmParser::UnresolvedOperand> &ordinals,
+    SmallVectorImpl<OpAsmParser::UnresolvedOperand> &slots,
+    SmallVectorImpl<OpAsmParser::UnresolvedOperand> &bufferOffsets,
+    SmallVectorImpl<OpAsmParser::UnresolvedOperand> &bufferLengths) {
+  do {
+    OpAsmParser::UnresolvedOperand ordinal;
+    OpAsmParser::UnresolvedOperand slot;
+    OpAsmParser::UnresolvedOperand bufferOffset;
+    OpAsmParser::UnresolvedOperand bufferLength;
+    if (failed(parser.parseOperand(ordinal)) || failed(parser.parseEqual()) ||
+        failed(parser.parseKeyword("slot")) || failed(parser.parseLParen()) ||
+        failed(parser.parseOperand(slot)) || failed(parser.parseRParen()) ||
+        failed(parser.parseLSquare()) ||
+        failed(parser.parseOperand(bufferOffset)) ||
+        failed(parser.parseComma()) ||
+        failed(parser.parseOperand(bufferLength)) ||
+        failed(parser.parseRSquare())) {
+      return failure();
+    }
+    ordinals.push_back(ordinal);
+    slots.push_back(slot);
+    bufferOffsets.push_back(bufferOffset);
+    bufferLengths.push_back(bufferLength);
+  } while (succeeded(parser.parseOptionalComma()));
+  return success();
+}
+
+static void printDescriptorSetBindingSlots(OpAsmPrinter &p, Operation *op,
+                                           ValueRange ordinals,
+                                           ValueRange slots,
+                                           ValueRange bufferOffsets,
+                                           ValueRange bufferLengths) {
+  llvm::interleaveComma(
+      llvm::zip(ordinals, slots, bufferOffsets, bufferLengths), p,
+      [&](std::tuple<Value, Value, Value, Value> it) {
+        p.printNewline();
+        p << "  ";
+        p.printOperand(std::get<0>(it));
+        p << " = slot(";
+        p.printOperand(std::get<1>(it));
+        p << ")[";
+        p.printOperand(std::get<2>(it));
+        p << ", ";
+        p.printOperand(std::get<3>(it));
+        p << "]";
+      });
+  p.printNewline();
+}
+
+//===----------------------------------------------------------------------===//
+// custom<BindingTable>($binding_buffers,
+//                      type($binding_buffers),
+//                      $binding_offsets,
+//                      $binding_lengths)
+//===----------------------------------------------------------------------===//
+
+static ParseResult parseBindingTable(
+    OpAsmParser &parser,
+    SmallVectorImpl<OpAsmParser::UnresolvedOperand> &buffers,
+    SmallVectorImpl<Type> &bufferTypes,
+    SmallVectorImpl<OpAsmParser::UnresolvedOperand> &bufferOffsets,
+    SmallVectorImpl<OpAsmParser::UnresolvedOperand> &bufferLengths) {
+  // An empty table is allowed as command buffers may have no indirect
+  // bindings.
+  if (failed(parser.parseOptionalLParen())) return success();
+  do {
+    if (!buffers.empty() && failed(parser.parseLParen())) return failure();
+    OpAsmParser::UnresolvedOperand buffer;
+    Type bufferType;
+    OpAsmParser::UnresolvedOperand bufferOffset;
+    OpAsmParser::UnresolvedOperand bufferLength;
+    if (failed(parser.parseOperand(buffer)) ||
+        failed(parser.parseColonType(bufferType)) ||
+        failed(parser.parseRParen()) || failed(parser.parseLSquare()) ||
+        failed(parser.parseOperand(bufferOffset)) ||
+        failed(parser.parseComma()) ||
+        failed(parser.parseOperand(bufferLength)) ||
+        failed(parser.parseRSquare())) {
+      return failure();
+    }
+    buffers.push_back(buffer);
+    bufferTypes.push_back(bufferType);
+    bufferOffsets.push_back(bufferOffset);
+    bufferLengths.push_back(bufferLength);
+  } while (succeeded(parser.parseOptionalComma()));
+  return success();
+}
+
+static void printBindingTable(OpAsmPrinter &p, Operation *op,
+                              ValueRange buffers, TypeRange bufferTypes,
+                              ValueRange bufferOffsets,
+                              ValueRange bufferLengths) {
+  if (buffers.empty()) return;
+  llvm::interleaveComma(
+      llvm::zip(buffers, bufferTypes, bufferOffsets, bufferLengths), p,
+      [&](std::tuple<Value, Type, Value, Value> it) {
+        p.printNewline();
+        p << "  (";
+        p.printOperand(std::get<0>(it));
+        p << " : ";
+        p.printType(std::get<1>(it));
+        p << ")[";
+        p.printOperand(std::get<2>(it));
+        p << ", ";
+        p.printOperand(std::get<3>(it));
+        p << "]";
+      });
+  p.printNewline();
+}
+
 //===----------------------------------------------------------------------===//
 // custom<PackSliceRanges>($lifetime_intervals,
 //                         $dynamic_slice_sizes,
@@ -216,7 +335,8 @@ LogicalResult ReturnOp::verify() {
 //===----------------------------------------------------------------------===//
 
 void TensorImportOp::build(OpBuilder &builder, OperationState &result,
-                           Type resultType, Value source) {
+                           Type resultType, Value source,
+                           Value waitFence) {
   auto shapedType = resultType.cast<ShapedType>();
   assert((source.getType().isa<IREE::HAL::BufferViewType>() ||
           shapedType.hasStaticShape()) &&
@@ -230,7 +350,7 @@ void TensorImportOp::build(OpBuilder &builder, OperationState &result,
         builder.getIndexAttr(i)));
   }
   build(builder, result, resultType, source, TypeAttr::get(shapedType),
-        dynamicDims);
+        dynamicDims, waitFence);
 }
 
 Value TensorImportOp::getTiedResult(unsigned resultIndex) {
@@ -334,6 +454,31 @@ LogicalResult TensorExportOp::verify() {
                                         op.source().getType());
 }
 
+//===----------------------------------------------------------------------===//
+// hal.tensor.barrier
+//===----------------------------------------------------------------------===//
+
+void TensorBarrierOp::build(OpBuilder &builder, OperationState &result,
+                            ValueRange sources, Value signalFence) {
+  auto resultTypes = llvm::to_vector<4>(
+      llvm::map_range(sources, [](Value source) { return source.getType(); }));
+  build(builder, result, resultTypes, sources, signalFence);
+}
+
+Value TensorBarrierOp::getTiedResult(unsigned resultIndex) {
+  return IREE::Util::TiedOpInterface::findTiedBaseValue(
+      sources()[resultIndex]);
+}
+
+::llvm::Optional<unsigned> TensorBarrierOp::getTiedResultOperandIndex(
+    unsigned resultIndex) {
+  return {resultIndex};  // sources[i]
+}
+
+SmallVector<int64_t, 4> TensorBarrierOp::getTiedResultOperandIndices() {
+  return llvm::to_vector<4>(llvm::seq<int64_t>(0, sources().size()));
+}
+
 //===----------------------------------------------------------------------===//
 // hal.allocator.allocate
 //===----------------------------------------------------------------------===//
@@ -1077,6 +1222,32 @@ void ExecutableLayoutLookupOp::getAsmResultNames(
   setNameFn(result(), "executable_layout");
 }
 
+//===----------------------------------------------------------------------===//
+// hal.fence.create
+//===----------------------------------------------------------------------===//
+
+void FenceCreateOp::getAsmResultNames(
+    function_ref<void(Value, StringRef)> setNameFn) {
+  setNameFn(result(), "fence");
+}
+
+LogicalResult FenceCreateOp::verify() {
+  FenceCreateOp op = *this;
+  if (op.semaphores().size() != op.min_values().size()) {
+    return op.emitOpError() << "each semaphore must have a paired min value";
+  }
+  return success();
+}
+
+//===----------------------------------------------------------------------===//
+// hal.fence.join
+//===----------------------------------------------------------------------===//
+
+void FenceJoinOp::getAsmResultNames(
+    function_ref<void(Value, StringRef)> setNameFn) {
+  setNameFn(result(), "fence");
+}
+
 //===----------------------------------------------------------------------===//
 // hal.semaphore.create
 //===----------------------------------------------------------------------===//
@@ -10,6 +10,10 @@
 #include "iree/compiler/Dialect/HAL/IR/HALOps.h"
 #include "iree/compiler/Dialect/Util/IR/UtilOps.h"
 #include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/Builders.h"
@@ -312,6 +316,142 @@ Attribute ExecutableTargetAttr::getMatchExpression() {
   return DeviceMatchExecutableFormatAttr::get(getContext(), getFormat());
 }
 
+//===----------------------------------------------------------------------===//
+// #hal.executable.object
+//===----------------------------------------------------------------------===//
+
+static llvm::cl::list<std::string> clExecutableObjectSearchPath(
+    "iree-hal-executable-object-search-path",
+    llvm::cl::desc("Additional search paths for resolving relative "
+                   "#hal.executable.object file references."),
+    llvm::cl::ZeroOrMore);
+
+FailureOr<std::string> ExecutableObjectAttr::getAbsolutePath() {
+  auto pathAttr = getPath();
+  if (!pathAttr) return failure();  // not a file reference
+  auto path = pathAttr.getValue();
+  if (llvm::sys::path::is_absolute(path)) {
+    if (!llvm::sys::fs::exists(path)) return failure();
+    return path.str();
+  }
+  for (auto &searchPath : clExecutableObjectSearchPath) {
+    SmallString<256> candidatePath(searchPath);
+    llvm::sys::path::append(candidatePath, path);
+    if (llvm::sys::fs::exists(candidatePath)) {
+      return candidatePath.str().str();
+    }
+  }
+  SmallString<256> absolutePath(path);
+  if (llvm::sys::fs::make_absolute(absolutePath) ||
+      !llvm::sys::fs::exists(absolutePath)) {
+    return failure();
+  }
+  return absolutePath.str().str();
+}
+
+Optional<std::string> ExecutableObjectAttr::loadData() {
+  if (auto dataAttr = getData()) {
+    // Embedded data is stored as i8 elements.
+    std::string data;
+    data.reserve(dataAttr.getNumElements());
+    for (auto value : dataAttr.getValues<APInt>()) {
+      data.push_back(static_cast<char>(value.getZExtValue()));
+    }
+    return data;
+  }
+  auto pathOr = getAbsolutePath();
+  if (failed(pathOr)) return llvm::None;
+  auto fileOr = llvm::MemoryBuffer::getFile(*pathOr, /*IsText=*/false,
+                                            /*RequiresNullTerminator=*/false);
+  if (!fileOr) return llvm::None;
+  return (*fileOr)->getBuffer().str();
+}
+
+//===----------------------------------------------------------------------===//
+// #hal.executable.objects
+//===----------------------------------------------------------------------===//
+
+// static
+LogicalResult ExecutableObjectsAttr::verify(
+    function_ref<mlir::InFlightDiagnostic()> emitError, ArrayAttr targetsAttr,
+    ArrayAttr targetObjectsAttr) {
+  if (targetsAttr.size() != targetObjectsAttr.size()) {
+    return emitError() << "targets and objects must be 1:1";
+  }
+  for (auto targetAttr : targetsAttr) {
+    if (!targetAttr.isa<IREE::HAL::ExecutableTargetAttr>()) {
+      return emitError()
+             << "target keys must be #hal.executable.target attributes";
+    }
+  }
+  for (auto objectsAttr : targetObjectsAttr) {
+    auto objectsArrayAttr = objectsAttr.dyn_cast<ArrayAttr>();
+    if (!objectsArrayAttr ||
+        !llvm::all_of(objectsArrayAttr, [](Attribute attr) {
+          return attr.isa<IREE::HAL::ExecutableObjectAttr>();
+        })) {
+      return emitError()
+             << "target objects must be an array of #hal.executable.object "
+                "attributes";
+    }
+  }
+  return success();
+}
+
+// static
+Attribute ExecutableObjectsAttr::parse(AsmParser &p, Type type) {
+  // `<{`
+  if (failed(p.parseLess()) || failed(p.parseLBrace())) return {};
+  SmallVector<Attribute> targetAttrs;
+  SmallVector<Attribute> objectsAttrs;
+  // `}>` or one or more `#target = [objects]` entries.
+  if (failed(p.parseOptionalRBrace())) {
+    do {
+      Attribute targetAttr;
+      ArrayAttr objectsAttr;
+      if (failed(p.parseAttribute(targetAttr)) || failed(p.parseEqual()) ||
+          failed(p.parseAttribute(objectsAttr))) {
+        return {};
+      }
+      targetAttrs.push_back(targetAttr);
+      objectsAttrs.push_back(objectsAttr);
+    } while (succeeded(p.parseOptionalComma()));
+    if (failed(p.parseRBrace())) return {};
+  }
+  if (failed(p.parseGreater())) return {};
+  return getChecked([&]() { return p.emitError(p.getNameLoc()); },
+                    p.getContext(), ArrayAttr::get(p.getContext(), targetAttrs),
+                    ArrayAttr::get(p.getContext(), objectsAttrs));
+}
+
+void ExecutableObjectsAttr::print(AsmPrinter &p) const {
+  auto &os = p.getStream();
+  os << "<{";
+  llvm::interleaveComma(
+      llvm::zip(getTargets(), getTargetObjects()), os, [&](auto it) {
+        p.printAttribute(std::get<0>(it));
+        os << " = ";
+        p.printAttribute(std::get<1>(it));
+      });
+  os << "}>";
+}
+
+ArrayAttr ExecutableObjectsAttr::getApplicableObjects(
+    ExecutableTargetAttr targetAttr) {
+  SmallVector<Attribute> objectAttrs;
+  for (auto it : llvm::zip(getTargets(), getTargetObjects())) {
+    auto keyAttr = std::get<0>(it).cast<ExecutableTargetAttr>();
+    if (keyAttr.getBackend() != targetAttr.getBackend() ||
+        keyAttr.getFormat() != targetAttr.getFormat()) {
+      continue;
+    }
+    auto targetObjectsAttr = std::get<1>(it).cast<ArrayAttr>();
+    objectAttrs.append(targetObjectsAttr.begin(), targetObjectsAttr.end());
+  }
+  if (objectAttrs.empty()) return {};
+  return ArrayAttr::get(getContext(), objectAttrs);
+}
+
 //===----------------------------------------------------------------------===//
 // #hal.match.*
 //===----------------------------------------------------------------------===//
@@ -537,7 +677,7 @@ void HALDialect::registerAttributes() {
 void HALDialect::registerTypes() {
   addTypes<AllocatorType, BufferType, BufferViewType, CommandBufferType,
            DescriptorSetType, DescriptorSetLayoutType, DeviceType, EventType,
-           ExecutableType, ExecutableLayoutType, RingBufferType,
+           ExecutableType, ExecutableLayoutType, FenceType, RingBufferType,
            SemaphoreType>();
 }
 
@@ -586,6 +726,7 @@ Type HALDialect::parseType(DialectAsmParser &parser) const {
           .Case("event", EventType::get(getContext()))
           .Case("executable", ExecutableType::get(getContext()))
           .Case("executable_layout", ExecutableLayoutType::get(getContext()))
+          .Case("fence", FenceType::get(getContext()))
           .Case("ring_buffer", RingBufferType::get(getContext()))
           .Case("semaphore", SemaphoreType::get(getContext()))
           .Default(nullptr);
@@ -617,6 +758,8 @@ void HALDialect::printType(Type type, DialectAsmPrinter &p) const {
     p << "executable";
   } else if (type.isa<ExecutableLayoutType>()) {
     p << "executable_layout";
+  } else if (type.isa<FenceType>()) {
+    p << "fence";
   } else if (type.isa<RingBufferType>()) {
     p << "ring_buffer";
   } else if (type.isa<SemaphoreType>()) {
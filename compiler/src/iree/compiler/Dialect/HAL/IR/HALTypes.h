@@ -126,6 +126,11 @@ class ExecutableLayoutType
   using Base::Base;
 };
 
+class FenceType : public Type::TypeBase<FenceType, Type, TypeStorage> {
+ public:
+  using Base::Base;
+};
+
 class RingBufferType
     : public Type::TypeBase<RingBufferType, Type, TypeStorage> {
  public:
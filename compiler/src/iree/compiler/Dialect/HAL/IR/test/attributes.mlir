@@ -28,3 +28,24 @@
     ]>
   ]>
 } : () -> ()
+
+// -----
+
+// CHECK-LABEL: executable_objects.basic
+"executable_objects.basic"() {
+  // CHECK: object_path = #hal.executable.object<{path = "kernels.o"}>
+  object_path = #hal.executable.object<{path = "kernels.o"}>,
+  // CHECK: object_data = #hal.executable.object<{data = dense<[1, 2, 3, 4]> : vector<4xi8>}>
+  object_data = #hal.executable.object<{data = dense<[1, 2, 3, 4]> : vector<4xi8>}>,
+  // CHECK: objects = #hal.executable.objects<{
+  // CHECK-SAME: #hal.executable.target<"llvm", "embedded-elf-arm_64"> = [#hal.executable.object<{path = "arm_64.o"}>],
+  // CHECK-SAME: #hal.executable.target<"llvm", "embedded-elf-x86_64"> = [#hal.executable.object<{path = "x86_64.o"}>]
+  objects = #hal.executable.objects<{
+    #hal.executable.target<"llvm", "embedded-elf-arm_64"> = [
+      #hal.executable.object<{path = "arm_64.o"}>
+    ],
+    #hal.executable.target<"llvm", "embedded-elf-x86_64"> = [
+      #hal.executable.object<{path = "x86_64.o"}>
+    ]
+  }>
+} : () -> ()
@@ -15,6 +15,23 @@ func.func @command_buffer_create(%device: !hal.device) {
 
 // -----
 
+// CHECK-LABEL: @command_buffer_create_reusable
+//  CHECK-SAME: (%[[DEVICE:.+]]: !hal.device, %[[CAPACITY:.+]]: index)
+func.func @command_buffer_create_reusable(%device: !hal.device, %capacity: index) {
+  //      CHECK: %cmd = hal.command_buffer.create
+  // CHECK-SAME:   device(%[[DEVICE]] : !hal.device)
+  // CHECK-SAME:   mode(None)
+  // CHECK-SAME:   categories(Dispatch)
+  // CHECK-SAME:   bindings(%[[CAPACITY]]) : !hal.command_buffer
+  %cmd = hal.command_buffer.create device(%device : !hal.device)
+                                     mode(None)
+                               categories(Dispatch)
+                                 bindings(%capacity) : !hal.command_buffer
+  return
+}
+
+// -----
+
 // CHECK-LABEL: @command_buffer_finalize
 //  CHECK-SAME: (%[[CMD:.+]]: !hal.command_buffer)
 func.func @command_buffer_finalize(%cmd: !hal.command_buffer) {
@@ -131,6 +148,34 @@ func.func @command_buffer_bind_descriptor_set(
 
 // -----
 
+// CHECK-LABEL: @command_buffer_push_descriptor_set_indirect
+//  CHECK-SAME: (%[[CMD:.+]]: !hal.command_buffer,
+//  CHECK-SAME: %[[LAYOUT:.+]]: !hal.executable_layout,
+//  CHECK-SAME: %[[SLOT:.+]]: index, %[[OFFSET:.+]]: index, %[[LENGTH:.+]]: index)
+func.func @command_buffer_push_descriptor_set_indirect(
+    %cmd: !hal.command_buffer,
+    %layout: !hal.executable_layout,
+    %slot: index,
+    %offset: index,
+    %length: index
+  ) {
+  // CHECK: %[[C0:.+]] = arith.constant 0
+  %c0 = arith.constant 0 : index
+  //      CHECK: hal.command_buffer.push_descriptor_set.indirect<%[[CMD]] : !hal.command_buffer>
+  // CHECK-SAME:   layout(%[[LAYOUT]] : !hal.executable_layout)[%[[C0]]]
+  // CHECK-SAME:   bindings([
+  // CHECK-NEXT:     %[[C0]] = slot(%[[SLOT]])[%[[OFFSET]], %[[LENGTH]]]
+  // CHECK-NEXT:   ])
+  hal.command_buffer.push_descriptor_set.indirect<%cmd : !hal.command_buffer>
+      layout(%layout : !hal.executable_layout)[%c0]
+      bindings([
+        %c0 = slot(%slot)[%offset, %length]
+      ])
+  return
+}
+
+// -----
+
 hal.executable @ex {
   hal.executable.variant @backend, target = <"backend", "format"> {
     hal.executable.export @entry0 ordinal(0) layout(#hal.executable.layout<push_constants = 0, sets = [
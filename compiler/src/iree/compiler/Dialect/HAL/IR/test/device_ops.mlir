@@ -51,3 +51,53 @@ func.func @device_query(%device : !hal.device) -> (i1, i32) {
   %ok, %value = hal.device.query<%device : !hal.device> key("sys" :: "foo") : i1, i32
   return %ok, %value : i1, i32
 }
+
+// -----
+
+// CHECK-LABEL: @device_queue_execute
+func.func @device_queue_execute(
+    // CHECK-SAME: (%[[DEVICE:.+]]: !hal.device, %[[AFFINITY:.+]]: i64,
+    %device: !hal.device, %affinity: i64,
+    // CHECK-SAME:  %[[WAIT_FENCE:.+]]: !hal.fence, %[[SIGNAL_FENCE:.+]]: !hal.fence,
+    %wait_fence: !hal.fence, %signal_fence: !hal.fence,
+    // CHECK-SAME:  %[[CMD0:.+]]: !hal.command_buffer, %[[CMD1:.+]]: !hal.command_buffer)
+    %cmd0: !hal.command_buffer, %cmd1: !hal.command_buffer) {
+  // CHECK: hal.device.queue.execute<%[[DEVICE]] : !hal.device>
+  hal.device.queue.execute<%device : !hal.device>
+      // CHECK-SAME: affinity(%[[AFFINITY]])
+      affinity(%affinity)
+      // CHECK-SAME: wait(%[[WAIT_FENCE]]) signal(%[[SIGNAL_FENCE]])
+      wait(%wait_fence) signal(%signal_fence)
+      // CHECK-SAME: commands([%[[CMD0]], %[[CMD1]]])
+      commands([%cmd0, %cmd1])
+  return
+}
+
+// -----
+
+// CHECK-LABEL: @device_queue_execute_indirect
+func.func @device_queue_execute_indirect(
+    // CHECK-SAME: (%[[DEVICE:.+]]: !hal.device, %[[AFFINITY:.+]]: i64,
+    %device: !hal.device, %affinity: i64,
+    // CHECK-SAME:  %[[WAIT_FENCE:.+]]: !hal.fence, %[[SIGNAL_FENCE:.+]]: !hal.fence,
+    %wait_fence: !hal.fence, %signal_fence: !hal.fence,
+    // CHECK-SAME:  %[[CMD:.+]]: !hal.command_buffer, %[[BUFFER:.+]]: !hal.buffer,
+    %cmd: !hal.command_buffer, %buffer: !hal.buffer,
+    // CHECK-SAME:  %[[OFFSET:.+]]: index, %[[LENGTH:.+]]: index)
+    %offset: index, %length: index) {
+  // CHECK: hal.device.queue.execute.indirect<%[[DEVICE]] : !hal.device>
+  hal.device.queue.execute.indirect<%device : !hal.device>
+      // CHECK-SAME: affinity(%[[AFFINITY]])
+      affinity(%affinity)
+      // CHECK-SAME: wait(%[[WAIT_FENCE]]) signal(%[[SIGNAL_FENCE]])
+      wait(%wait_fence) signal(%signal_fence)
+      // CHECK-SAME: command(%[[CMD]])
+      command(%cmd)
+      // CHECK-SAME: bindings([
+      // CHECK-NEXT:   (%[[BUFFER]] : !hal.buffer)[%[[OFFSET]], %[[LENGTH]]]
+      // CHECK-NEXT: ])
+      bindings([
+        (%buffer : !hal.buffer)[%offset, %length]
+      ])
+  return
+}
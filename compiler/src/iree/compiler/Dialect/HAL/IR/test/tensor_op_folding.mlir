@@ -37,3 +37,15 @@ func.func @foldTensorExportImport(%arg0: tensor<5xi32>) -> tensor<5xi32> {
   // CHECK: return %arg0 : tensor<5xi32>
   return %1 : tensor<5xi32>
 }
+
+// -----
+
+// CHECK-LABEL: @keepAsyncImport
+func.func @keepAsyncImport(%arg0: !hal.buffer_view, %arg1: !hal.fence) -> !hal.buffer_view {
+  // CHECK: %[[IMPORT:.+]] = hal.tensor.import wait(%arg1) => %arg0
+  %0 = hal.tensor.import wait(%arg1) => %arg0 : !hal.buffer_view -> tensor<5xi32>
+  // CHECK: %[[EXPORT:.+]] = hal.tensor.export %[[IMPORT]]
+  %1 = hal.tensor.export %0 : tensor<5xi32> -> !hal.buffer_view
+  // CHECK: return %[[EXPORT]]
+  return %1 : !hal.buffer_view
+}
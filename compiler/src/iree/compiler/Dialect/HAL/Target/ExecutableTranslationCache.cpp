@@ -0,0 +1,84 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/compiler/Dialect/HAL/Target/ExecutableTranslationCache.h"
+
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/SHA1.h"
+#include "llvm/Support/raw_ostream.h"
+#include "mlir/IR/BlockAndValueMapping.h"
+#include "mlir/IR/SymbolTable.h"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace HAL {
+
+// static
+std::string ExecutableTranslationCache::getKey(
+    IREE::HAL::ExecutableVariantOp variantOp) {
+  // Locations are not part of the key: shape specializations of a program
+  // carry the same dispatches at different source locations.
+  std::string ir;
+  llvm::raw_string_ostream os(ir);
+  OpPrintingFlags flags;
+  flags.printGenericOpForm();
+  variantOp->print(os, flags);
+  os.flush();
+
+  llvm::SHA1 hasher;
+  hasher.update(ir);
+  return llvm::toHex(hasher.result(), /*LowerCase=*/true);
+}
+
+bool ExecutableTranslationCache::lookup(
+    StringRef key, IREE::HAL::ExecutableVariantOp variantOp) {
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = entries.find(key);
+  if (it == entries.end() ||
+      it->second->getContext() != variantOp.getContext()) {
+    ++statistics.misses;
+    return false;
+  }
+  ++statistics.hits;
+
+  Operation *cachedOp = it->second.get();
+  Region &body = variantOp->getRegion(0);
+  body.dropAllReferences();
+  body.getBlocks().clear();
+  BlockAndValueMapping mapper;
+  cachedOp->getRegion(0).cloneInto(&body, mapper);
+
+  auto symNameAttr = variantOp->getAttr(SymbolTable::getSymbolAttrName());
+  variantOp->setAttrs(cachedOp->getAttrDictionary());
+  variantOp->setAttr(SymbolTable::getSymbolAttrName(), symNameAttr);
+  return true;
+}
+
+void ExecutableTranslationCache::insert(
+    StringRef key, IREE::HAL::ExecutableVariantOp variantOp) {
+  OwningOpRef<Operation *> clonedOp(variantOp->clone());
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.try_emplace(key, std::move(clonedOp));
+  statistics.entries = entries.size();
+}
+
+void ExecutableTranslationCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  entries.clear();
+  statistics = Statistics();
+}
+
+ExecutableTranslationCache::Statistics
+ExecutableTranslationCache::getStatistics() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return statistics;
+}
+
+}  // namespace HAL
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -0,0 +1,67 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_COMPILER_DIALECT_HAL_TARGET_EXECUTABLETRANSLATIONCACHE_H_
+#define IREE_COMPILER_DIALECT_HAL_TARGET_EXECUTABLETRANSLATIONCACHE_H_
+
+#include <mutex>
+#include <string>
+
+#include "iree/compiler/Dialect/HAL/IR/HALOps.h"
+#include "llvm/ADT/StringMap.h"
+#include "mlir/IR/OwningOpRef.h"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace HAL {
+
+// In-memory cache of translated hal.executable.variant ops.
+//
+// Long-lived compiler sessions compile many closely related programs (such as
+// shape specializations of the same model) in a single MLIRContext and most
+// of their dispatches are identical. Translation is where the majority of
+// compilation time is spent so the translated form of each variant is kept
+// keyed by the variant IR prior to translation and cloned back into later
+// variants with the same contents.
+//
+// Cached ops belong to the MLIRContext they were translated in and the cache
+// must only be used with that context. Thread-safe.
+class ExecutableTranslationCache {
+ public:
+  struct Statistics {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t entries = 0;
+  };
+
+  // Returns the cache key of |variantOp| prior to translation.
+  static std::string getKey(IREE::HAL::ExecutableVariantOp variantOp);
+
+  // Replaces the contents of |variantOp| with the translated variant cached
+  // under |key|, if any. The symbol name of |variantOp| is preserved.
+  bool lookup(StringRef key, IREE::HAL::ExecutableVariantOp variantOp);
+
+  // Caches a copy of the translated |variantOp| under |key|.
+  void insert(StringRef key, IREE::HAL::ExecutableVariantOp variantOp);
+
+  // Drops all cached variants and resets the statistics.
+  void clear();
+
+  Statistics getStatistics();
+
+ private:
+  std::mutex mutex;
+  llvm::StringMap<OwningOpRef<Operation *>> entries;
+  Statistics statistics;
+};
+
+}  // namespace HAL
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
+
+#endif  // IREE_COMPILER_DIALECT_HAL_TARGET_EXECUTABLETRANSLATIONCACHE_H_
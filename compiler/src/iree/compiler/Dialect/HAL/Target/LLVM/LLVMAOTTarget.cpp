@@ -22,11 +22,17 @@
 #include "llvm/Analysis/TargetTransformInfo.h"
 #include "llvm/Bitcode/BitcodeReader.h"
 #include "llvm/Bitcode/BitcodeWriter.h"
+#include "llvm/Config/llvm-config.h"
 #include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/Module.h"
 #include "llvm/Linker/Linker.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA1.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Transforms/Utils/Cloning.h"
 #include "mlir/Dialect/ArmNeon/ArmNeonDialect.h"
 #include "mlir/Dialect/LLVMIR/LLVMDialect.h"
 #include "mlir/Dialect/PDL/IR/PDL.h"
@@ -45,6 +51,75 @@ namespace HAL {
 static constexpr char kQueryFunctionName[] =
     "iree_hal_executable_library_query";
 
+// An ISA-specific variant of the dispatch functions that is selected at runtime
+// when the processor supports all of the required features.
+struct ISAVariant {
+  // Name used with --iree-llvm-target-isa-variants= and to suffix symbols.
+  const char *name;
+  // LLVM target features added to the base target features of the variant.
+  const char *targetFeatures;
+  // Bits that must all be set in processor data field 0 for the variant to be
+  // selected. Matches IREE_CPU_DATA0_* in iree/base/internal/cpu.h.
+  uint64_t processorData0Mask;
+};
+
+// IREE_CPU_DATA0_X86_64_*
+static constexpr uint64_t kX86_64_AVX = 1ull << 0;
+static constexpr uint64_t kX86_64_AVX2 = 1ull << 1;
+static constexpr uint64_t kX86_64_FMA = 1ull << 2;
+static constexpr uint64_t kX86_64_F16C = 1ull << 3;
+static constexpr uint64_t kX86_64_AVX512F = 1ull << 4;
+static constexpr uint64_t kX86_64_AVX512CD = 1ull << 5;
+static constexpr uint64_t kX86_64_AVX512VL = 1ull << 6;
+static constexpr uint64_t kX86_64_AVX512DQ = 1ull << 7;
+static constexpr uint64_t kX86_64_AVX512BW = 1ull << 8;
+static constexpr uint64_t kX86_64_AVX512VNNI = 1ull << 9;
+static constexpr uint64_t kX86_64_AVX2Set =
+    kX86_64_AVX | kX86_64_AVX2 | kX86_64_FMA | kX86_64_F16C;
+static constexpr uint64_t kX86_64_AVX512Set =
+    kX86_64_AVX2Set | kX86_64_AVX512F | kX86_64_AVX512CD | kX86_64_AVX512VL |
+    kX86_64_AVX512DQ | kX86_64_AVX512BW;
+
+// IREE_CPU_DATA0_ARM_64_*
+static constexpr uint64_t kARM_64_DOTPROD = 1ull << 0;
+static constexpr uint64_t kARM_64_I8MM = 1ull << 1;
+
+static const ISAVariant kX86_64ISAVariants[] = {
+    {"avx2", "+avx,+avx2,+fma,+f16c", kX86_64_AVX2Set},
+    {"avx512",
+     "+avx,+avx2,+fma,+f16c,+avx512f,+avx512cd,+avx512vl,+avx512dq,"
+     "+avx512bw",
+     kX86_64_AVX512Set},
+    {"avx512_vnni",
+     "+avx,+avx2,+fma,+f16c,+avx512f,+avx512cd,+avx512vl,+avx512dq,"
+     "+avx512bw,+avx512vnni",
+     kX86_64_AVX512Set | kX86_64_AVX512VNNI},
+};
+static const ISAVariant kARM_64ISAVariants[] = {
+    {"dotprod", "+dotprod", kARM_64_DOTPROD},
+    {"i8mm", "+dotprod,+i8mm", kARM_64_DOTPROD | kARM_64_I8MM},
+};
+
+// Returns the ISA variant with the given |name| for |arch|, if any.
+static const ISAVariant *findISAVariant(llvm::Triple::ArchType arch,
+                                        StringRef name) {
+  ArrayRef<ISAVariant> variants;
+  switch (arch) {
+    case llvm::Triple::x86_64:
+      variants = kX86_64ISAVariants;
+      break;
+    case llvm::Triple::aarch64:
+      variants = kARM_64ISAVariants;
+      break;
+    default:
+      return nullptr;
+  }
+  for (auto &variant : variants) {
+    if (name == variant.name) return &variant;
+  }
+  return nullptr;
+}
+
 static llvm::Optional<FileLineColLoc> findFirstFileLoc(Location baseLoc) {
   if (auto loc = baseLoc.dyn_cast<FusedLoc>()) {
     for (auto &childLoc : loc.getLocations()) {
@@ -148,6 +223,8 @@ class LLVMAOTTargetBackend final : public TargetBackend {
 
   std::string deviceID() const override { return "cpu"; }
 
+  bool supportsExecutableObjects() const override { return true; }
+
   void getDependentDialects(DialectRegistry &registry) const override {
     mlir::registerLLVMDialectTranslation(registry);
     // TODO: make inclusion of ArmNeon conditional?
@@ -235,6 +312,41 @@ class LLVMAOTTargetBackend final : public TargetBackend {
              << "cannot embed ELF and produce static library simultaneously";
     }
 
+    // Load any hand-written objects that must be linked into the library.
+    SmallVector<std::string> externalObjectData;
+    if (auto objectsAttr = variantOp.objectsAttr()) {
+      if (options_.linkStatic) {
+        return variantOp.emitError()
+               << "linking executable objects is not supported when producing "
+                  "static libraries";
+      }
+      for (auto objectAttr :
+           objectsAttr.getAsRange<IREE::HAL::ExecutableObjectAttr>()) {
+        auto objectData = objectAttr.loadData();
+        if (!objectData) {
+          return variantOp.emitError()
+                 << "executable object " << objectAttr
+                 << " could not be loaded; check "
+                    "--iree-hal-executable-object-search-path=";
+        }
+        externalObjectData.push_back(std::move(*objectData));
+      }
+    }
+
+    // Executables that were serialized before with the same options are read
+    // back from the cache. This must happen before the variant is modified.
+    std::string cacheKey;
+    if (!options_.executableCachePath.empty() && !options_.linkStatic &&
+        !options_.keepLinkerArtifacts &&
+        options.dumpIntermediatesPath.empty() &&
+        options.dumpBinariesPath.empty()) {
+      cacheKey = getExecutableCacheKey(variantOp, externalObjectData);
+      if (succeeded(
+              loadCachedExecutable(cacheKey, variantOp, executableBuilder))) {
+        return success();
+      }
+    }
+
     // Specialize the module to the target triple.
     // The executable will have been cloned into other ExecutableVariantOps for
     // other triples so it's fine to mutate in-place.
@@ -297,6 +409,7 @@ class LLVMAOTTargetBackend final : public TargetBackend {
       } break;
     }
     auto align16 = llvm::Attribute::getWithAlignment(context, llvm::Align(16));
+    SmallVector<llvm::Function *> exportFuncs;
     for (auto exportOp : variantOp.getBlock().getOps<ExecutableExportOp>()) {
       // Find the matching function in the LLVM module.
       auto *llvmFunc = llvmModule->getFunction(exportOp.getName());
@@ -326,6 +439,33 @@ class LLVMAOTTargetBackend final : public TargetBackend {
       libraryBuilder.addExport(exportOp.getName(), "",
                                LibraryBuilder::DispatchAttrs{localMemorySize},
                                llvmFunc);
+      exportFuncs.push_back(llvmFunc);
+    }
+
+    // Clone all exports for each requested ISA variant and compile the clones
+    // with the additional target features. The query function selects the
+    // most specialized variant the processor supports when the library is
+    // loaded and otherwise falls back to the base functions.
+    for (auto &variantName : options_.targetISAVariants) {
+      const auto *variant = findISAVariant(targetTriple.getArch(), variantName);
+      if (!variant) {
+        return variantOp.emitError()
+               << "unsupported ISA variant '" << variantName
+               << "' for target triple '" << options_.targetTriple << "'";
+      }
+      std::string targetFeatures = options_.targetCPUFeatures;
+      if (!targetFeatures.empty()) targetFeatures += ",";
+      targetFeatures += variant->targetFeatures;
+      SmallVector<llvm::Function *> variantFuncs;
+      for (auto *baseFunc : exportFuncs) {
+        llvm::ValueToValueMapTy valueMap;
+        auto *variantFunc = llvm::CloneFunction(baseFunc, valueMap);
+        variantFunc->setName(baseFunc->getName() + "_" + variant->name);
+        variantFunc->addFnAttr("target-features", targetFeatures);
+        variantFuncs.push_back(variantFunc);
+      }
+      libraryBuilder.addVariant(variant->name, variant->processorData0Mask,
+                                std::move(variantFuncs));
     }
 
     auto queryFunctionName = std::string(kQueryFunctionName);
@@ -336,6 +476,22 @@ class LLVMAOTTargetBackend final : public TargetBackend {
     }
     auto *queryLibraryFunc = libraryBuilder.build(queryFunctionName);
 
+    // Static libraries may export the range functions of each dispatch under a
+    // library-unique name so that hosts can call them directly instead of
+    // going through the library query. These always wrap the base functions as
+    // the ISA variant is only selected by the query.
+    std::vector<std::string> directDispatchNames;
+    SmallVector<llvm::Function *> directDispatchFuncs;
+    if (options_.linkStatic && options_.staticLibraryDirectDispatch) {
+      for (auto *exportFunc : exportFuncs) {
+        std::string name = libraryName + "_" + exportFunc->getName().str();
+        auto *rangeFunc = libraryBuilder.getOrBuildRangeFunc(exportFunc);
+        rangeFunc->setName(name);
+        directDispatchNames.push_back(rangeFunc->getName().str());
+        directDispatchFuncs.push_back(rangeFunc);
+      }
+    }
+
     // The query function must be exported for dynamic libraries.
     queryLibraryFunc->setVisibility(
         llvm::GlobalValue::VisibilityTypes::DefaultVisibility);
@@ -420,6 +576,12 @@ class LLVMAOTTargetBackend final : public TargetBackend {
         // exported from shared objects and available for linking in static
         // objects.
         continue;
+      } else if (llvm::is_contained(directDispatchFuncs, &func)) {
+        // Direct dispatch functions are linked against by the host.
+        func.setVisibility(
+            llvm::GlobalValue::VisibilityTypes::DefaultVisibility);
+        func.setLinkage(llvm::GlobalValue::LinkageTypes::ExternalLinkage);
+        continue;
       } else if (func.isDeclaration()) {
         // Declarations must have their original visibility/linkage; they most
         // often come from declared llvm builtin ops (llvm.memcpy/etc).
@@ -435,23 +597,40 @@ class LLVMAOTTargetBackend final : public TargetBackend {
 
     SmallVector<Artifact> objectFiles;
 
-    // Emit the base object file containing the bulk of our code.
-    // This must come first such that we have the proper library linking order.
+    // Emit the object files containing the bulk of our code.
+    // These must come first such that we have the proper library linking order.
     {
-      // NOTE: today we just use a single object file, however if we wanted to
-      // scale code generation and linking we'd want to generate one per
-      // function (or something like that). A single object file is also
-      // instrumental to static library generation (which only supports one
-      // object file per library).
-      std::string objectData;
-      if (failed(runEmitObjFilePasses(targetMachine.get(), llvmModule.get(),
-                                      llvm::CGFT_ObjectFile, &objectData))) {
+      // Code generation is split across partitions of the module compiled in
+      // parallel into one object file each. Static library generation only
+      // supports one object file per library so those are never split.
+      unsigned numPartitions =
+          options_.linkStatic
+              ? 1
+              : std::min<unsigned>(options_.codegenPartitions,
+                                   exportFuncs.size());
+      std::vector<std::string> objectData;
+      if (failed(runSplitEmitObjFilePasses(options_, llvmModule.get(),
+                                           numPartitions, &objectData))) {
         return variantOp.emitError()
                << "failed to compile LLVM-IR module to an object file";
       }
-      auto objectFile = Artifact::createTemporary(libraryName, "o");
+      for (auto &data : objectData) {
+        auto objectFile = Artifact::createTemporary(libraryName, "o");
+        auto &os = objectFile.outputFile->os();
+        os << data;
+        os.flush();
+        os.close();
+        objectFiles.push_back(std::move(objectFile));
+      }
+    }
+
+    // Append the hand-written objects after our own so that the code they
+    // reference from ours is resolved by them.
+    for (auto &data : externalObjectData) {
+      auto objectFile =
+          Artifact::createTemporary(libraryName + "_external", "o");
       auto &os = objectFile.outputFile->os();
-      os << objectData;
+      os << data;
       os.flush();
       os.close();
       objectFiles.push_back(std::move(objectFile));
@@ -485,20 +664,143 @@ class LLVMAOTTargetBackend final : public TargetBackend {
       }
     }
     if (options_.linkStatic) {
-      return serializeStaticLibraryExecutable(options, variantOp,
-                                              executableBuilder, libraryName,
-                                              queryFunctionName, objectFiles);
+      if (options_.staticLibraryDirectDispatch &&
+          failed(writeStaticLibraryBitcode(variantOp, llvmModule.get()))) {
+        return failure();
+      }
+      return serializeStaticLibraryExecutable(
+          options, variantOp, executableBuilder, libraryName, queryFunctionName,
+          directDispatchNames, objectFiles);
     } else {
-      return serializeDynamicLibraryExecutable(options, variantOp,
-                                               executableBuilder, libraryName,
-                                               objectFiles, linkerTool.get());
+      return serializeDynamicLibraryExecutable(
+          options, variantOp, executableBuilder, libraryName, objectFiles,
+          linkerTool.get(), cacheKey);
     }
   }
 
+  // Returns the key of the binary produced for |variantOp| in the executable
+  // cache. The key covers the executable IR, the contents of the objects linked
+  // into it, as well as all options that change the produced binary.
+  std::string getExecutableCacheKey(IREE::HAL::ExecutableVariantOp variantOp,
+                                    ArrayRef<std::string> externalObjectData) {
+    std::string key;
+    llvm::raw_string_ostream os(key);
+    // Bump the version when the layout of the cache entries changes.
+    os << "v1;" << LLVM_VERSION_STRING << ";" << options_.targetTriple << ";"
+       << options_.targetCPU << ";" << options_.targetCPUFeatures << ";";
+    llvm::interleave(options_.targetISAVariants, os, ",");
+    os << ";" << options_.optLevel.getSpeedupLevel() << ";"
+       << options_.optLevel.getSizeLevel() << ";"
+       << options_.pipelineTuningOptions.LoopInterleaving
+       << options_.pipelineTuningOptions.LoopVectorization
+       << options_.pipelineTuningOptions.LoopUnrolling
+       << options_.pipelineTuningOptions.SLPVectorization << ";"
+       << static_cast<int>(options_.options.FloatABIType) << ";"
+       << options_.options.MCOptions.ABIName << ";" << options_.debugSymbols
+       << ";" << static_cast<int>(options_.sanitizerKind) << ";"
+       << options_.linkEmbedded << ";" << options_.codegenPartitions << ";"
+       << options_.systemLinkerPath << ";" << options_.embeddedLinkerPath
+       << ";" << options_.wasmLinkerPath << "\n";
+    OpPrintingFlags flags;
+    flags.printGenericOpForm();
+    flags.enableDebugInfo(options_.debugSymbols);
+    variantOp->print(os, flags);
+    os.flush();
+
+    llvm::SHA1 hasher;
+    hasher.update(key);
+    for (auto &data : externalObjectData) hasher.update(data);
+    return llvm::toHex(hasher.result(), /*LowerCase=*/true);
+  }
+
+  std::string getExecutableCachePath(StringRef cacheKey) {
+    return (options_.executableCachePath + llvm::sys::path::get_separator() +
+            cacheKey + ".bin")
+        .str();
+  }
+
+  // Adds the binary stored under |cacheKey| in the executable cache to the
+  // parent hal.executable of |variantOp|. Fails if there is no such binary.
+  LogicalResult loadCachedExecutable(StringRef cacheKey,
+                                     IREE::HAL::ExecutableVariantOp variantOp,
+                                     OpBuilder &executableBuilder) {
+    auto fileOr = llvm::MemoryBuffer::getFile(getExecutableCachePath(cacheKey));
+    if (!fileOr) return failure();
+    // Entries are the MIME type of the binary on the first line followed by
+    // the binary contents.
+    StringRef contents = (*fileOr)->getBuffer();
+    size_t mimeTypeEnd = contents.find('\n');
+    if (mimeTypeEnd == StringRef::npos) return failure();
+    StringRef mimeType = contents.take_front(mimeTypeEnd);
+    StringRef data = contents.drop_front(mimeTypeEnd + 1);
+    auto bufferAttr = DenseIntElementsAttr::get(
+        VectorType::get({static_cast<int64_t>(data.size())},
+                        IntegerType::get(executableBuilder.getContext(), 8)),
+        llvm::makeArrayRef(reinterpret_cast<const int8_t *>(data.data()),
+                           data.size()));
+    auto binaryOp = executableBuilder.create<IREE::HAL::ExecutableBinaryOp>(
+        variantOp.getLoc(), variantOp.sym_name(),
+        variantOp.target().getFormat(), bufferAttr);
+    binaryOp.mime_typeAttr(executableBuilder.getStringAttr(mimeType));
+    return success();
+  }
+
+  // Stores |data| under |cacheKey| in the executable cache. Failing to write to
+  // the cache is not an error as the binary can always be regenerated.
+  void storeCachedExecutable(StringRef cacheKey, StringRef mimeType,
+                             ArrayRef<int8_t> data) {
+    if (cacheKey.empty()) return;
+    llvm::sys::fs::create_directories(options_.executableCachePath);
+    // Entries are written to a temporary file that is renamed into place so
+    // that concurrent compilations never observe partial entries.
+    auto cachePath = getExecutableCachePath(cacheKey);
+    auto tempFileOr = llvm::sys::fs::TempFile::create(cachePath + ".%%%%%%");
+    if (!tempFileOr) {
+      llvm::consumeError(tempFileOr.takeError());
+      return;
+    }
+    {
+      llvm::raw_fd_ostream os(tempFileOr->FD, /*shouldClose=*/false);
+      os << mimeType << "\n";
+      os.write(reinterpret_cast<const char *>(data.data()), data.size());
+      os.flush();
+      if (os.has_error()) {
+        os.clear_error();
+        llvm::consumeError(tempFileOr->discard());
+        return;
+      }
+    }
+    llvm::consumeError(tempFileOr->keep(cachePath));
+  }
+
+  // Writes the bitcode of |llvmModule| beside the static library output so
+  // that it can be LTO'd with the host program in place of the object file.
+  LogicalResult writeStaticLibraryBitcode(
+      IREE::HAL::ExecutableVariantOp variantOp, llvm::Module *llvmModule) {
+    llvm::SmallString<32> bitcodeFilePath(options_.staticLibraryOutput);
+    llvm::sys::path::replace_extension(bitcodeFilePath, ".bc");
+    std::error_code ec;
+    llvm::raw_fd_ostream os(bitcodeFilePath, ec);
+    if (ec) {
+      return variantOp.emitError()
+             << "failed to open static library bitcode output '"
+             << bitcodeFilePath << "': " << ec.message();
+    }
+    llvm::WriteBitcodeToFile(*llvmModule, os);
+    os.close();
+    if (os.has_error()) {
+      return variantOp.emitError()
+             << "failed to write static library bitcode output '"
+             << bitcodeFilePath << "'";
+    }
+    return success();
+  }
+
   LogicalResult serializeStaticLibraryExecutable(
       const SerializationOptions &options,
       IREE::HAL::ExecutableVariantOp variantOp, OpBuilder &executableBuilder,
       const std::string &libraryName, const std::string &queryFunctionName,
+      const std::vector<std::string> &directDispatchNames,
       const SmallVector<Artifact> &objectFiles) {
     if (objectFiles.size() != 1) {
       // Static library output only supports single object libraries.
@@ -509,7 +811,7 @@ class LLVMAOTTargetBackend final : public TargetBackend {
     // Copy the static object file to the specified output along with
     // generated header file.
     if (!outputStaticLibrary(libraryName, queryFunctionName,
-                             options_.staticLibraryOutput,
+                             directDispatchNames, options_.staticLibraryOutput,
                              objectFiles[0].path)) {
       return variantOp.emitError() << "static library generation failed";
     }
@@ -528,7 +830,7 @@ class LLVMAOTTargetBackend final : public TargetBackend {
       const SerializationOptions &options,
       IREE::HAL::ExecutableVariantOp variantOp, OpBuilder &executableBuilder,
       const std::string &libraryName, const SmallVector<Artifact> &objectFiles,
-      LinkerTool *linkerTool) {
+      LinkerTool *linkerTool, StringRef cacheKey) {
     // Link the generated object files into a dylib.
     auto linkArtifactsOr =
         linkerTool->linkDynamicLibrary(libraryName, objectFiles);
@@ -560,6 +862,7 @@ class LLVMAOTTargetBackend final : public TargetBackend {
         dumpDataToPath<int8_t>(options.dumpBinariesPath, options.dumpBaseName,
                                variantOp.getName(), ".so", *elfFile);
       }
+      storeCachedExecutable(cacheKey, "application/x-elf", *elfFile);
       auto bufferAttr = DenseIntElementsAttr::get(
           VectorType::get({static_cast<int64_t>(elfFile->size())},
                           IntegerType::get(executableBuilder.getContext(), 8)),
@@ -618,6 +921,7 @@ class LLVMAOTTargetBackend final : public TargetBackend {
         dumpDataToPath<int8_t>(options.dumpBinariesPath, options.dumpBaseName,
                                variantOp.getName(), extension, libraryFile);
       }
+      storeCachedExecutable(cacheKey, mimeType, libraryFile);
       auto bufferAttr = DenseIntElementsAttr::get(
           VectorType::get({static_cast<int64_t>(libraryFile.size())},
                           IntegerType::get(executableBuilder.getContext(), 8)),
@@ -727,6 +1031,13 @@ class LLVMAOTTargetBackend final : public TargetBackend {
     addConfig("cpu_features",
               StringAttr::get(context, options_.targetCPUFeatures));
 
+    // Set the data cache sizes that are known.
+    for (auto cacheSize : llvm::enumerate(config_.cacheSizes)) {
+      if (!cacheSize.value()) continue;
+      addConfig(llvm::formatv("l{0}_cache_size", cacheSize.index() + 1).str(),
+                IntegerAttr::get(IndexType::get(context), cacheSize.value()));
+    }
+
     return IREE::HAL::ExecutableTargetAttr::get(
         context, StringAttr::get(context, "llvm"),
         StringAttr::get(context, format), DictionaryAttr::get(context, config));
@@ -755,6 +1066,19 @@ class LLVMAOTTargetBackend final : public TargetBackend {
     config_.vectorSize = tti.getRegisterBitWidth(
                              llvm::TargetTransformInfo::RGK_FixedWidthVector) /
                          8;
+
+    // Cache sizes. LLVM only models the L1 and L2 data caches.
+    config_.cacheSizes = options_.cacheSizes;
+    if (!config_.cacheSizes[0]) {
+      config_.cacheSizes[0] =
+          tti.getCacheSize(llvm::TargetTransformInfo::CacheLevel::L1D)
+              .getValueOr(0);
+    }
+    if (!config_.cacheSizes[1]) {
+      config_.cacheSizes[1] =
+          tti.getCacheSize(llvm::TargetTransformInfo::CacheLevel::L2D)
+              .getValueOr(0);
+    }
     LLVM_DEBUG({
       llvm::dbgs() << "CPU : " << targetMachine->getTargetCPU() << "\n";
       llvm::dbgs() << "Target Triple : "
@@ -763,6 +1087,9 @@ class LLVMAOTTargetBackend final : public TargetBackend {
                    << targetMachine->getTargetFeatureString() << "\n";
       llvm::dbgs() << "Data Layout : " << config_.dataLayoutStr << "\n";
       llvm::dbgs() << "Vector Width : " << config_.vectorSize << "\n";
+      llvm::dbgs() << "Cache Sizes : " << config_.cacheSizes[0] << ", "
+                   << config_.cacheSizes[1] << ", " << config_.cacheSizes[2]
+                   << "\n";
     });
   }
 
@@ -773,6 +1100,7 @@ class LLVMAOTTargetBackend final : public TargetBackend {
   struct AdditionalConfigurationValues {
     std::string dataLayoutStr;
     int64_t vectorSize;
+    std::array<unsigned, 3> cacheSizes;
   } config_;
 };
 
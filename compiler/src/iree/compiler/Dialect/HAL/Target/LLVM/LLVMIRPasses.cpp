@@ -6,8 +6,14 @@
 
 #include "iree/compiler/Dialect/HAL/Target/LLVM/LLVMIRPasses.h"
 
+#include <atomic>
+
+#include "llvm/ADT/SmallString.h"
 #include "llvm/Analysis/AliasAnalysis.h"
+#include "llvm/Bitcode/BitcodeReader.h"
+#include "llvm/Bitcode/BitcodeWriter.h"
 #include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/LLVMContext.h"
 #include "llvm/IR/LegacyPassManager.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/PassManager.h"
@@ -18,9 +24,11 @@
 #include "llvm/Support/CodeGen.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/Host.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Transforms/Instrumentation/AddressSanitizer.h"
 #include "llvm/Transforms/Instrumentation/ThreadSanitizer.h"
+#include "llvm/Transforms/Utils/SplitModule.h"
 
 namespace mlir {
 namespace iree_compiler {
@@ -146,6 +154,63 @@ LogicalResult runEmitObjFilePasses(llvm::TargetMachine *machine,
   return success();
 }
 
+LogicalResult runSplitEmitObjFilePasses(const LLVMTargetOptions &options,
+                                        llvm::Module *module,
+                                        unsigned numPartitions,
+                                        std::vector<std::string> *objData) {
+  if (numPartitions <= 1) {
+    auto machine = createTargetMachine(options);
+    if (!machine) return failure();
+    objData->resize(1);
+    return runEmitObjFilePasses(machine.get(), module, llvm::CGFT_ObjectFile,
+                                &objData->front());
+  }
+
+  // LLVM contexts are not thread-safe so each partition is round-tripped
+  // through bitcode into a context owned by the thread compiling it.
+  // Symbols referenced across partitions are externalized with hidden
+  // visibility such that the linker resolves them.
+  std::vector<llvm::SmallString<0>> partitionBitcode;
+  llvm::SplitModule(
+      *module, numPartitions,
+      [&](std::unique_ptr<llvm::Module> partition) {
+        partitionBitcode.emplace_back();
+        llvm::raw_svector_ostream os(partitionBitcode.back());
+        llvm::WriteBitcodeToFile(*partition, os);
+      },
+      /*PreserveLocals=*/false);
+
+  objData->clear();
+  objData->resize(partitionBitcode.size());
+  std::atomic<bool> anyFailed(false);
+  llvm::ThreadPool threadPool(
+      llvm::hardware_concurrency(partitionBitcode.size()));
+  for (size_t i = 0; i < partitionBitcode.size(); ++i) {
+    threadPool.async([&, i]() {
+      llvm::LLVMContext context;
+      context.setOpaquePointers(false);
+      auto partitionOr = llvm::parseBitcodeFile(
+          llvm::MemoryBufferRef(llvm::StringRef(partitionBitcode[i].data(),
+                                                partitionBitcode[i].size()),
+                                "partition"),
+          context);
+      if (!partitionOr) {
+        llvm::consumeError(partitionOr.takeError());
+        anyFailed = true;
+        return;
+      }
+      auto machine = createTargetMachine(options);
+      if (!machine ||
+          failed(runEmitObjFilePasses(machine.get(), partitionOr->get(),
+                                      llvm::CGFT_ObjectFile, &(*objData)[i]))) {
+        anyFailed = true;
+      }
+    });
+  }
+  threadPool.wait();
+  return success(!anyFailed);
+}
+
 }  // namespace HAL
 }  // namespace IREE
 }  // namespace iree_compiler
@@ -8,6 +8,8 @@
 #define IREE_COMPILER_DIALECT_HAL_TARGET_LLVM_LLVMIRPASSES_H_
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "iree/compiler/Dialect/HAL/Target/LLVM/LLVMTargetOptions.h"
 #include "llvm/IR/Module.h"
@@ -34,6 +36,14 @@ LogicalResult runEmitObjFilePasses(llvm::TargetMachine *machine,
                                    llvm::CodeGenFileType fileType,
                                    std::string *objData);
 
+// Emits compiled module objs for the target machine with the functions of the
+// module split across |numPartitions| partitions that are compiled in parallel
+// into separate object files.
+LogicalResult runSplitEmitObjFilePasses(const LLVMTargetOptions &options,
+                                        llvm::Module *module,
+                                        unsigned numPartitions,
+                                        std::vector<std::string> *objData);
+
 }  // namespace HAL
 }  // namespace IREE
 }  // namespace iree_compiler
@@ -6,8 +6,11 @@
 
 #include "iree/compiler/Dialect/HAL/Target/LLVM/LLVMTargetOptions.h"
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
 
+#include "iree/base/internal/cpu.h"
 #include "llvm/ADT/APFloat.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/MC/SubtargetFeature.h"
@@ -74,8 +77,23 @@ LLVMTargetOptions getLLVMTargetOptionsFromFlags() {
   static llvm::cl::opt<std::string> clTargetCPUFeatures(
       "iree-llvm-target-cpu-features",
       llvm::cl::desc("LLVM target machine CPU features; use 'host' for your "
-                     "host native CPU"),
+                     "host native CPU (wasm32/wasm64 default to "
+                     "+atomics,+bulk-memory,+simd128)"),
       llvm::cl::init(""));
+  static llvm::cl::list<std::string> clTargetISAVariants(
+      "iree-llvm-target-isa-variants",
+      llvm::cl::desc("Additional ISA-specific variants of each dispatch to "
+                     "include in the library and select between at runtime "
+                     "(x86_64: avx2,avx512,avx512_vnni; aarch64: "
+                     "dotprod,i8mm)"),
+      llvm::cl::CommaSeparated);
+  static llvm::cl::list<unsigned> clTargetCacheSizes(
+      "iree-llvm-target-cache-sizes",
+      llvm::cl::desc("Sizes in bytes of the L1, L2 and L3 data caches of the "
+                     "target CPU used to size tiles; unset or 0 sizes are "
+                     "queried from the host when targeting the 'host' CPU "
+                     "and otherwise taken from the LLVM target when known"),
+      llvm::cl::CommaSeparated);
 
   static llvm::cl::opt<bool> llvmLoopInterleaving(
       "iree-llvm-loop-interleaving", llvm::cl::init(false),
@@ -98,6 +116,28 @@ LLVMTargetOptions getLLVMTargetOptionsFromFlags() {
   if (clTargetCPUFeatures != "host") {
     targetOptions.targetCPUFeatures = clTargetCPUFeatures;
   }
+  if (targetTriple.isWasm() && targetOptions.targetCPUFeatures.empty()) {
+    // All browsers we target support SIMD128 and, with SharedArrayBuffer,
+    // the atomics and bulk memory needed for multithreading. Without SIMD128
+    // the target reports 64-bit vectors and codegen barely vectorizes.
+    targetOptions.targetCPUFeatures = "+atomics,+bulk-memory,+simd128";
+  }
+  targetOptions.targetISAVariants.assign(clTargetISAVariants.begin(),
+                                         clTargetISAVariants.end());
+  for (auto size : llvm::enumerate(clTargetCacheSizes)) {
+    if (size.index() >= targetOptions.cacheSizes.size()) break;
+    targetOptions.cacheSizes[size.index()] = size.value();
+  }
+  if (clTargetCPU == "host") {
+    // LLVM only knows the cache sizes of some named CPUs; the runtime's host
+    // query reads them from the OS/CPU of the machine we are running on.
+    const iree_cpu_info_t *hostInfo = iree_cpu_info();
+    for (size_t i = 0; i < targetOptions.cacheSizes.size(); ++i) {
+      if (targetOptions.cacheSizes[i]) continue;
+      targetOptions.cacheSizes[i] = static_cast<unsigned>(std::min<uint64_t>(
+          hostInfo->cache_sizes[i], std::numeric_limits<unsigned>::max()));
+    }
+  }
 
   // LLVM opt options.
   targetOptions.pipelineTuningOptions.LoopInterleaving = llvmLoopInterleaving;
@@ -193,6 +233,20 @@ LLVMTargetOptions getLLVMTargetOptionsFromFlags() {
       llvm::cl::init(targetOptions.keepLinkerArtifacts));
   targetOptions.keepLinkerArtifacts = clKeepLinkerArtifacts;
 
+  static llvm::cl::opt<unsigned> clCodegenPartitions(
+      "iree-llvm-codegen-partitions",
+      llvm::cl::desc("Number of partitions the functions of an executable are "
+                     "split into to run LLVM code generation in parallel"),
+      llvm::cl::init(targetOptions.codegenPartitions));
+  targetOptions.codegenPartitions = clCodegenPartitions;
+
+  static llvm::cl::opt<std::string> clExecutableCachePath(
+      "iree-llvm-executable-cache-path",
+      llvm::cl::desc("Directory of a cache of serialized executables reused "
+                     "across compilations for unchanged executables"),
+      llvm::cl::init(targetOptions.executableCachePath));
+  targetOptions.executableCachePath = clExecutableCachePath;
+
   static llvm::cl::opt<std::string> clStaticLibraryOutputPath(
       "iree-llvm-static-library-output-path",
       llvm::cl::desc(
@@ -202,6 +256,15 @@ LLVMTargetOptions getLLVMTargetOptionsFromFlags() {
       llvm::cl::init(targetOptions.staticLibraryOutput));
   targetOptions.staticLibraryOutput = clStaticLibraryOutputPath;
 
+  static llvm::cl::opt<bool> clStaticLibraryDirectDispatch(
+      "iree-llvm-static-library-direct-dispatch",
+      llvm::cl::desc(
+          "Exports the dispatch functions of static libraries for direct "
+          "calls from the host and emits a '.bc' file beside the static "
+          "library for cross-module LTO."),
+      llvm::cl::init(targetOptions.staticLibraryDirectDispatch));
+  targetOptions.staticLibraryDirectDispatch = clStaticLibraryDirectDispatch;
+
   static llvm::cl::opt<bool> clListTargets(
       "iree-llvm-list-targets",
       llvm::cl::desc("Lists all registered targets that the LLVM backend can "
@@ -7,6 +7,10 @@
 #ifndef IREE_COMPILER_DIALECT_HAL_TARGET_LLVM_LLVMTARGETOPTIONS_H_
 #define IREE_COMPILER_DIALECT_HAL_TARGET_LLVM_LLVMTARGETOPTIONS_H_
 
+#include <array>
+#include <string>
+#include <vector>
+
 #include "llvm/Passes/PassBuilder.h"
 #include "llvm/Target/TargetOptions.h"
 
@@ -29,6 +33,19 @@ struct LLVMTargetOptions {
   std::string targetCPU;
   std::string targetCPUFeatures;
 
+  // Additional ISA variants of each dispatch to include in the library.
+  // The runtime selects the most specialized variant the processor supports
+  // when loading the library and falls back to the base targetCPUFeatures.
+  // Variant names are defined per architecture (such as `avx2` on x86_64 or
+  // `dotprod` on aarch64) and are listed in LLVMAOTTarget.cpp.
+  std::vector<std::string> targetISAVariants;
+
+  // Sizes in bytes of the L1, L2 and L3 data caches of the target CPU that
+  // codegen sizes tiles for. Sizes that are 0 are queried from the host when
+  // compiling for the host CPU, from LLVM for other target CPUs where it knows
+  // them, and are left unknown otherwise.
+  std::array<unsigned, 3> cacheSizes = {0, 0, 0};
+
   llvm::PipelineTuningOptions pipelineTuningOptions;
   llvm::OptimizationLevel optLevel;
   llvm::TargetOptions options;
@@ -66,12 +83,31 @@ struct LLVMTargetOptions {
   // True to keep linker artifacts for debugging.
   bool keepLinkerArtifacts = false;
 
+  // Number of partitions the functions of an executable are split into for
+  // code generation. The partitions are compiled in parallel into separate
+  // object files that are linked together. The partitioning only depends on
+  // the module so the output is the same regardless of the host thread count.
+  // Static libraries only support a single object file and are never split.
+  unsigned codegenPartitions = 8;
+
+  // Directory of an on-disk cache of serialized executables keyed by a hash of
+  // the executable IR and the target options. Unchanged executables are read
+  // back from the cache on recompiles and skip LLVM entirely. Disabled if
+  // empty.
+  std::string executableCachePath;
+
   // Build for IREE static library loading using this output path for
   // a "{staticLibraryOutput}.o" object file and "{staticLibraryOutput}.h"
   // header file.
   //
   // This option is incompatible with the linkEmbedded option.
   std::string staticLibraryOutput;
+
+  // Exports a `{library}_{export}` dispatch range function per entry point from
+  // static libraries and declares them in the generated header so that hosts
+  // can call dispatches directly. The LLVM bitcode of the library is written to
+  // "{staticLibraryOutput}.bc" so that it can be LTO'd with the host program.
+  bool staticLibraryDirectDispatch = false;
 };
 
 // Returns LLVMTargetOptions struct intialized with the iree-llvm-* flags.
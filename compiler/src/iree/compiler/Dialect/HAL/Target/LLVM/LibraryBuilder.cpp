@@ -103,6 +103,59 @@ static llvm::FunctionType *makeDispatchFunctionType(
                                  /*isVarArg=*/false);
 }
 
+// %struct.iree_hal_executable_workgroup_range_v0_t = type {
+//   i32,
+//   i32,
+//   i16,
+//   i16,
+//   i32,
+//   i8*,
+//   i32,
+//   i32
+// }
+static llvm::StructType *makeWorkgroupRangeType(llvm::LLVMContext &context) {
+  if (auto *existingType = llvm::StructType::getTypeByName(
+          context, "iree_hal_executable_workgroup_range_v0_t")) {
+    return existingType;
+  }
+  auto *i16Type = llvm::IntegerType::getInt16Ty(context);
+  auto *i32Type = llvm::IntegerType::getInt32Ty(context);
+  auto *i8PtrType = llvm::IntegerType::getInt8PtrTy(context);
+  auto *type =
+      llvm::StructType::create(context,
+                               {
+                                   i32Type,
+                                   i32Type,
+                                   i16Type,
+                                   i16Type,
+                                   i32Type,
+                                   i8PtrType,
+                                   i32Type,
+                                   i32Type,
+                               },
+                               "iree_hal_executable_workgroup_range_v0_t",
+                               /*isPacked=*/false);
+  return type;
+}
+
+// i32 (%struct.iree_hal_executable_environment_v0_t*,
+//      %struct.iree_hal_executable_dispatch_state_v0_t*,
+//      %struct.iree_hal_executable_workgroup_range_v0_t*)
+static llvm::FunctionType *makeDispatchRangeFunctionType(
+    llvm::LLVMContext &context) {
+  auto *environmentType = makeEnvironmentType(context);
+  auto *dispatchStateType = makeDispatchStateType(context);
+  auto *workgroupRangeType = makeWorkgroupRangeType(context);
+  auto *i32Type = llvm::IntegerType::getInt32Ty(context);
+  return llvm::FunctionType::get(i32Type,
+                                 {
+                                     environmentType->getPointerTo(),
+                                     dispatchStateType->getPointerTo(),
+                                     workgroupRangeType->getPointerTo(),
+                                 },
+                                 /*isVarArg=*/false);
+}
+
 // %struct.iree_hal_executable_dispatch_attrs_v0_t = type {
 //   i16,
 //   i16
@@ -173,6 +226,25 @@ static llvm::StructType *makeConstantTableType(llvm::LLVMContext &context) {
   return type;
 }
 
+// %struct.iree_hal_executable_range_table_v0_t = type {
+//   i32 (...)**
+// }
+static llvm::StructType *makeRangeTableType(llvm::LLVMContext &context) {
+  if (auto *existingType = llvm::StructType::getTypeByName(
+          context, "iree_hal_executable_range_table_v0_t")) {
+    return existingType;
+  }
+  auto *dispatchRangeFunctionType = makeDispatchRangeFunctionType(context);
+  auto *type = llvm::StructType::create(
+      context,
+      {
+          dispatchRangeFunctionType->getPointerTo()->getPointerTo(),
+      },
+      "iree_hal_executable_range_table_v0_t",
+      /*isPacked=*/false);
+  return type;
+}
+
 // %struct.iree_hal_executable_library_header_t = type {
 //   i32,
 //   i8*,
@@ -202,6 +274,8 @@ static llvm::StructType *makeLibraryHeaderType(llvm::LLVMContext &context) {
 //   %struct.iree_hal_executable_library_header_t*,
 //   %struct.iree_hal_executable_import_table_v0_t,
 //   %struct.iree_hal_executable_export_table_v0_t,
+//   %struct.iree_hal_executable_constant_table_v0_t,
+//   %struct.iree_hal_executable_range_table_v0_t,
 // }
 static llvm::StructType *makeLibraryType(llvm::StructType *libraryHeaderType) {
   auto &context = libraryHeaderType->getContext();
@@ -212,12 +286,14 @@ static llvm::StructType *makeLibraryType(llvm::StructType *libraryHeaderType) {
   auto *importTableType = makeImportTableType(context);
   auto *exportTableType = makeExportTableType(context);
   auto *constantTableType = makeConstantTableType(context);
+  auto *rangeTableType = makeRangeTableType(context);
   auto *type = llvm::StructType::create(context,
                                         {
                                             libraryHeaderType->getPointerTo(),
                                             importTableType,
                                             exportTableType,
                                             constantTableType,
+                                            rangeTableType,
                                         },
                                         "iree_hal_executable_library_v0_t",
                                         /*isPacked=*/false);
@@ -278,13 +354,78 @@ llvm::Function *LibraryBuilder::build(StringRef queryFuncName) {
   // Build out the header for each version and select it at runtime.
   // NOTE: today there is just one version so this is rather simple:
   //   return max_version == 0 ? &library : NULL;
-  auto *v0 = buildLibraryV0((queryFuncName + "_v0").str());
-  builder.CreateRet(builder.CreateSelect(
+  SmallVector<llvm::Function *> baseFuncs;
+  for (auto &dispatch : exports) baseFuncs.push_back(dispatch.func);
+  auto *v0 = buildLibraryV0((queryFuncName + "_v0").str(), baseFuncs);
+  if (variants.empty()) {
+    builder.CreateRet(builder.CreateSelect(
+        builder.CreateICmpEQ(
+            func->getArg(0),
+            llvm::ConstantInt::get(i32Type,
+                                   static_cast<int64_t>(Version::LATEST))),
+        builder.CreatePointerCast(v0, libraryHeaderType->getPointerTo()),
+        llvm::ConstantPointerNull::get(libraryHeaderType->getPointerTo())));
+    return func;
+  }
+
+  // With ISA variants we select the library based on the processor data in
+  // the environment, checking the most specialized variants first:
+  //   if (max_version != 0) return NULL;
+  //   if (!environment) return &library;
+  //   uint64_t data0 = environment->processor.data[0];
+  //   if ((data0 & mask_n) == mask_n) return &library_variant_n;
+  //   ...
+  //   return &library;
+  auto *nullBlock = llvm::BasicBlock::Create(context, "unsupported", func);
+  auto *versionBlock = llvm::BasicBlock::Create(context, "version", func);
+  auto *baseBlock = llvm::BasicBlock::Create(context, "base", func);
+  builder.CreateCondBr(
       builder.CreateICmpEQ(func->getArg(0),
                            llvm::ConstantInt::get(
                                i32Type, static_cast<int64_t>(Version::LATEST))),
-      builder.CreatePointerCast(v0, libraryHeaderType->getPointerTo()),
-      llvm::ConstantPointerNull::get(libraryHeaderType->getPointerTo())));
+      versionBlock, nullBlock);
+  builder.SetInsertPoint(nullBlock);
+  builder.CreateRet(
+      llvm::ConstantPointerNull::get(libraryHeaderType->getPointerTo()));
+  builder.SetInsertPoint(baseBlock);
+  builder.CreateRet(
+      builder.CreatePointerCast(v0, libraryHeaderType->getPointerTo()));
+
+  builder.SetInsertPoint(versionBlock);
+  auto *checkBlock = llvm::BasicBlock::Create(context, "check", func);
+  builder.CreateCondBr(builder.CreateIsNull(func->getArg(1)), baseBlock,
+                       checkBlock);
+  builder.SetInsertPoint(checkBlock);
+  // Matches the field order in iree_hal_executable_environment_v0_t and
+  // iree_hal_processor_v0_t.
+  auto *i64Type = llvm::IntegerType::getInt64Ty(context);
+  auto *data0Ptr = builder.CreateInBoundsGEP(
+      makeEnvironmentType(context), func->getArg(1),
+      {
+          llvm::ConstantInt::get(i32Type, 0),
+          llvm::ConstantInt::get(i32Type, /*processor=*/3),
+          llvm::ConstantInt::get(i32Type, /*data=*/0),
+          llvm::ConstantInt::get(i32Type, 0),
+      });
+  auto *data0 = builder.CreateLoad(i64Type, data0Ptr);
+  for (auto &variant : llvm::reverse(variants)) {
+    assert(variant.funcs.size() == exports.size() &&
+           "variants must provide one function per export");
+    auto *library = buildLibraryV0(
+        (queryFuncName + "_v0_" + variant.name).str(), variant.funcs);
+    auto *mask = llvm::ConstantInt::get(i64Type, variant.processorData0Mask);
+    auto *selectBlock =
+        llvm::BasicBlock::Create(context, "select_" + variant.name, func);
+    auto *nextBlock = llvm::BasicBlock::Create(context, "next", func);
+    builder.CreateCondBr(
+        builder.CreateICmpEQ(builder.CreateAnd(data0, mask), mask), selectBlock,
+        nextBlock);
+    builder.SetInsertPoint(selectBlock);
+    builder.CreateRet(
+        builder.CreatePointerCast(library, libraryHeaderType->getPointerTo()));
+    builder.SetInsertPoint(nextBlock);
+  }
+  builder.CreateBr(baseBlock);
 
   return func;
 }
@@ -329,7 +470,7 @@ llvm::Constant *LibraryBuilder::buildLibraryV0ImportTable(
 }
 
 llvm::Constant *LibraryBuilder::buildLibraryV0ExportTable(
-    std::string libraryName) {
+    std::string libraryName, ArrayRef<llvm::Function *> funcs) {
   auto &context = module->getContext();
   auto *exportTableType = makeExportTableType(context);
   auto *dispatchFunctionType = makeDispatchFunctionType(context);
@@ -341,8 +482,8 @@ llvm::Constant *LibraryBuilder::buildLibraryV0ExportTable(
 
   // iree_hal_executable_export_table_v0_t::ptrs
   SmallVector<llvm::Constant *, 4> exportPtrValues;
-  for (auto dispatch : exports) {
-    exportPtrValues.push_back(dispatch.func);
+  for (auto *func : funcs) {
+    exportPtrValues.push_back(func);
   }
   auto *exportPtrsType = llvm::ArrayType::get(
       dispatchFunctionType->getPointerTo(), exportPtrValues.size());
@@ -355,6 +496,23 @@ llvm::Constant *LibraryBuilder::buildLibraryV0ExportTable(
   exportPtrs = llvm::ConstantExpr::getInBoundsGetElementPtr(
       exportPtrsType, exportPtrs, ArrayRef<llvm::Constant *>{zero, zero});
 
+  // The remaining fields are shared by all variants so we only build them once.
+  if (v0ExportAttrs) {
+    return llvm::ConstantStruct::get(
+        exportTableType, {
+                             // count=
+                             llvm::ConstantInt::get(i32Type, exports.size()),
+                             // ptrs=
+                             exportPtrs,
+                             // attrs=
+                             v0ExportAttrs,
+                             // names=
+                             v0ExportNames,
+                             // tags=
+                             v0ExportTags,
+                         });
+  }
+
   // iree_hal_executable_export_table_v0_t::attrs
   llvm::Constant *exportAttrs =
       llvm::Constant::getNullValue(i32Type->getPointerTo());
@@ -429,6 +587,10 @@ llvm::Constant *LibraryBuilder::buildLibraryV0ExportTable(
         exportTagsType, global, ArrayRef<llvm::Constant *>{zero, zero});
   }
 
+  v0ExportAttrs = exportAttrs;
+  v0ExportNames = exportNames;
+  v0ExportTags = exportTags;
+
   return llvm::ConstantStruct::get(
       exportTableType, {
                            // count=
@@ -457,15 +619,156 @@ llvm::Constant *LibraryBuilder::buildLibraryV0ConstantTable(
                          });
 }
 
-llvm::Constant *LibraryBuilder::buildLibraryV0(std::string libraryName) {
+llvm::Function *LibraryBuilder::getOrBuildRangeFunc(llvm::Function *func) {
+  auto it = rangeFuncs.find(func);
+  if (it != rangeFuncs.end()) return it->second;
+
   auto &context = module->getContext();
-  auto *libraryHeaderType = makeLibraryHeaderType(context);
-  auto *libraryType = makeLibraryType(libraryHeaderType);
+  auto *dispatchStateType = makeDispatchStateType(context);
+  auto *workgroupStateType = makeWorkgroupStateType(context);
+  auto *workgroupRangeType = makeWorkgroupRangeType(context);
+  auto *i16Type = llvm::IntegerType::getInt16Ty(context);
+  auto *i32Type = llvm::IntegerType::getInt32Ty(context);
+  auto *rangeFunc = llvm::Function::Create(
+      makeDispatchRangeFunctionType(context),
+      llvm::GlobalValue::InternalLinkage, func->getName() + "_range", *module);
+  rangeFuncs[func] = rangeFunc;
+  auto *environment = rangeFunc->getArg(0);
+  auto *dispatchState = rangeFunc->getArg(1);
+  auto *workgroupRange = rangeFunc->getArg(2);
+
+  // The range shares the workgroup state layout for all fields but the
+  // trailing workgroup count. We copy it into a workgroup state and then only
+  // need to update the workgroup IDs between workgroups:
+  //   workgroup_state = *workgroup_range;
+  //   for (uint32_t i = 0; i < workgroup_range->workgroup_count; ++i) {
+  //     int ret = func(environment, dispatch_state, &workgroup_state);
+  //     if (ret != 0) return ret;
+  //     ... advance workgroup_state.workgroup_id_xyz ...
+  //   }
+  //   return 0;
+  auto *entryBlock = llvm::BasicBlock::Create(context, "entry", rangeFunc);
+  auto *loopBlock = llvm::BasicBlock::Create(context, "loop", rangeFunc);
+  auto *nextBlock = llvm::BasicBlock::Create(context, "next", rangeFunc);
+  auto *failBlock = llvm::BasicBlock::Create(context, "fail", rangeFunc);
+  auto *exitBlock = llvm::BasicBlock::Create(context, "exit", rangeFunc);
+  llvm::IRBuilder<> builder(entryBlock);
+  auto *workgroupState = builder.CreateAlloca(workgroupStateType);
+  auto loadRangeField = [&](unsigned index) {
+    return builder.CreateLoad(
+        workgroupRangeType->getElementType(index),
+        builder.CreateStructGEP(workgroupRangeType, workgroupRange, index));
+  };
+  auto storeStateField = [&](unsigned index, llvm::Value *value) {
+    builder.CreateStore(value, builder.CreateStructGEP(workgroupStateType,
+                                                       workgroupState, index));
+  };
+  // Matches the field order in iree_hal_executable_workgroup_range_v0_t.
+  auto *workgroupIdX = loadRangeField(/*workgroup_id_x=*/0);
+  auto *workgroupIdY = loadRangeField(/*workgroup_id_y=*/1);
+  auto *workgroupIdZ = loadRangeField(/*workgroup_id_z=*/2);
+  storeStateField(/*reserved=*/3, llvm::ConstantInt::get(i16Type, 0));
+  storeStateField(/*processor_id=*/4, loadRangeField(/*processor_id=*/4));
+  storeStateField(/*local_memory=*/5, loadRangeField(/*local_memory=*/5));
+  storeStateField(/*local_memory_size=*/6,
+                  loadRangeField(/*local_memory_size=*/6));
+  auto *workgroupCount = loadRangeField(/*workgroup_count=*/7);
+  // Matches the field order in iree_hal_executable_dispatch_state_v0_t.
+  auto *workgroupCountX = builder.CreateLoad(
+      i32Type, builder.CreateStructGEP(dispatchStateType, dispatchState,
+                                       /*workgroup_count_x=*/4));
+  auto *workgroupCountY = builder.CreateLoad(
+      i32Type, builder.CreateStructGEP(dispatchStateType, dispatchState,
+                                       /*workgroup_count_y=*/5));
+  auto *zero32 = llvm::ConstantInt::get(i32Type, 0);
+  builder.CreateCondBr(builder.CreateICmpEQ(workgroupCount, zero32), exitBlock,
+                       loopBlock);
+
+  builder.SetInsertPoint(loopBlock);
+  auto *indexPhi = builder.CreatePHI(i32Type, 2);
+  auto *xPhi = builder.CreatePHI(i32Type, 2);
+  auto *yPhi = builder.CreatePHI(i32Type, 2);
+  auto *zPhi = builder.CreatePHI(i16Type, 2);
+  storeStateField(/*workgroup_id_x=*/0, xPhi);
+  storeStateField(/*workgroup_id_y=*/1, yPhi);
+  storeStateField(/*workgroup_id_z=*/2, zPhi);
+  auto *ret = builder.CreateCall(
+      func, {environment, dispatchState,
+             builder.CreatePointerCast(
+                 workgroupState,
+                 func->getFunctionType()->getParamType(2))});
+  builder.CreateCondBr(builder.CreateICmpNE(ret, zero32), failBlock,
+                       nextBlock);
+
+  builder.SetInsertPoint(nextBlock);
+  auto *nextX = builder.CreateAdd(xPhi, llvm::ConstantInt::get(i32Type, 1));
+  auto *wrapX = builder.CreateICmpEQ(nextX, workgroupCountX);
+  nextX = builder.CreateSelect(wrapX, zero32, nextX);
+  auto *nextY = builder.CreateAdd(yPhi, builder.CreateZExt(wrapX, i32Type));
+  auto *wrapY = builder.CreateICmpEQ(nextY, workgroupCountY);
+  nextY = builder.CreateSelect(wrapY, zero32, nextY);
+  auto *nextZ = builder.CreateAdd(zPhi, builder.CreateZExt(wrapY, i16Type));
+  auto *nextIndex =
+      builder.CreateAdd(indexPhi, llvm::ConstantInt::get(i32Type, 1));
+  builder.CreateCondBr(builder.CreateICmpEQ(nextIndex, workgroupCount),
+                       exitBlock, loopBlock);
+  indexPhi->addIncoming(zero32, entryBlock);
+  indexPhi->addIncoming(nextIndex, nextBlock);
+  xPhi->addIncoming(workgroupIdX, entryBlock);
+  xPhi->addIncoming(nextX, nextBlock);
+  yPhi->addIncoming(workgroupIdY, entryBlock);
+  yPhi->addIncoming(nextY, nextBlock);
+  zPhi->addIncoming(workgroupIdZ, entryBlock);
+  zPhi->addIncoming(nextZ, nextBlock);
+
+  builder.SetInsertPoint(failBlock);
+  builder.CreateRet(ret);
+
+  builder.SetInsertPoint(exitBlock);
+  builder.CreateRet(zero32);
+
+  return rangeFunc;
+}
+
+llvm::Constant *LibraryBuilder::buildLibraryV0RangeTable(
+    std::string libraryName, ArrayRef<llvm::Function *> funcs) {
+  auto &context = module->getContext();
+  auto *rangeTableType = makeRangeTableType(context);
+  auto *dispatchRangeFunctionType = makeDispatchRangeFunctionType(context);
   auto *i32Type = llvm::IntegerType::getInt32Ty(context);
+  llvm::Constant *zero = llvm::ConstantInt::get(i32Type, 0);
 
-  // ----- Header -----
+  // iree_hal_executable_range_table_v0_t::ptrs
+  SmallVector<llvm::Constant *, 4> rangePtrValues;
+  for (auto *func : funcs) {
+    rangePtrValues.push_back(getOrBuildRangeFunc(func));
+  }
+  auto *rangePtrsType = llvm::ArrayType::get(
+      dispatchRangeFunctionType->getPointerTo(), rangePtrValues.size());
+  llvm::Constant *rangePtrs = new llvm::GlobalVariable(
+      *module, rangePtrsType, /*isConstant=*/true,
+      llvm::GlobalVariable::PrivateLinkage,
+      llvm::ConstantArray::get(rangePtrsType, rangePtrValues),
+      /*Name=*/libraryName + "_range_funcs");
+  rangePtrs = llvm::ConstantExpr::getInBoundsGetElementPtr(
+      rangePtrsType, rangePtrs, ArrayRef<llvm::Constant *>{zero, zero});
+
+  return llvm::ConstantStruct::get(rangeTableType, {
+                                                       // ptrs=
+                                                       rangePtrs,
+                                                   });
+}
+
+llvm::Constant *LibraryBuilder::buildLibraryV0Header(
+    std::string libraryName) {
+  // The header is shared by all variants so we only build it once.
+  if (v0Header) return v0Header;
+
+  auto &context = module->getContext();
+  auto *libraryHeaderType = makeLibraryHeaderType(context);
+  auto *i32Type = llvm::IntegerType::getInt32Ty(context);
 
-  auto *libraryHeader = new llvm::GlobalVariable(
+  v0Header = new llvm::GlobalVariable(
       *module, libraryHeaderType, /*isConstant=*/true,
       llvm::GlobalVariable::PrivateLinkage,
       llvm::ConstantStruct::get(
@@ -477,13 +780,27 @@ llvm::Constant *LibraryBuilder::buildLibraryV0(std::string libraryName) {
               // name=
               getStringConstant(module->getName(), module),
               // features=
-              llvm::ConstantInt::get(i32Type, static_cast<int64_t>(features)),
+              llvm::ConstantInt::get(
+                  i32Type, static_cast<int64_t>(features) |
+                               static_cast<int64_t>(Features::DISPATCH_RANGES)),
               // sanitizer=
               llvm::ConstantInt::get(i32Type,
                                      static_cast<int64_t>(sanitizerKind)),
           }),
       /*Name=*/libraryName + "_header");
   // TODO(benvanik): force alignment (8? natural pointer width?)
+  return v0Header;
+}
+
+llvm::Constant *LibraryBuilder::buildLibraryV0(
+    std::string libraryName, ArrayRef<llvm::Function *> funcs) {
+  auto &context = module->getContext();
+  auto *libraryHeaderType = makeLibraryHeaderType(context);
+  auto *libraryType = makeLibraryType(libraryHeaderType);
+
+  // ----- Header -----
+
+  auto *libraryHeader = buildLibraryV0Header(libraryName);
 
   // ----- Library -----
 
@@ -497,9 +814,13 @@ llvm::Constant *LibraryBuilder::buildLibraryV0(std::string libraryName) {
                                     // imports=
                                     buildLibraryV0ImportTable(libraryName),
                                     // exports=
-                                    buildLibraryV0ExportTable(libraryName),
+                                    buildLibraryV0ExportTable(libraryName,
+                                                              funcs),
                                     // constants=
                                     buildLibraryV0ConstantTable(libraryName),
+                                    // ranges=
+                                    buildLibraryV0RangeTable(libraryName,
+                                                             funcs),
                                 }),
       /*Name=*/libraryName);
   // TODO(benvanik): force alignment (8? natural pointer width?)
@@ -11,6 +11,7 @@
 #include <string>
 
 #include "iree/compiler/Dialect/HAL/Target/LLVM/LLVMTargetOptions.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/Triple.h"
 #include "llvm/IR/Module.h"
 #include "mlir/Support/LogicalResult.h"
@@ -58,6 +59,8 @@ class LibraryBuilder {
   enum class Features : uint32_t {
     // IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_NONE
     NONE = 0u,
+    // IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_DISPATCH_RANGES
+    DISPATCH_RANGES = 1u << 0,
   };
 
   // iree_hal_executable_library_sanitizer_kind_t
@@ -117,6 +120,18 @@ class LibraryBuilder {
     exports.push_back({name.str(), tag.str(), attrs, func});
   }
 
+  // Defines an ISA-specific variant of the library that will be selected at
+  // runtime over the base exports when all bits in |processorData0Mask| are
+  // set in field 0 of the processor data provided by the environment.
+  // |funcs| must contain one function per export in the order they were added.
+  // Variants added later take priority over those added earlier.
+  //
+  // See iree/base/internal/cpu.h for the processor data bits.
+  void addVariant(StringRef name, uint64_t processorData0Mask,
+                  SmallVector<llvm::Function *> funcs) {
+    variants.push_back({name.str(), processorData0Mask, std::move(funcs)});
+  }
+
   // Builds a `iree_hal_executable_library_query_fn_t` with the given
   // |queryFuncName| that will return the current library metadata.
   //
@@ -127,12 +142,24 @@ class LibraryBuilder {
   // unit, etc).
   llvm::Function *build(StringRef queryFuncName);
 
+  // Returns an `iree_hal_executable_dispatch_range_v0_t` function that calls
+  // |func| once per workgroup in the range it is provided. The function is
+  // inserted into the module with internal linkage and shared with the range
+  // table of the library.
+  llvm::Function *getOrBuildRangeFunc(llvm::Function *func);
+
  private:
   // Builds and returns an iree_hal_executable_library_v0_t global constant.
-  llvm::Constant *buildLibraryV0(std::string libraryName);
+  // |funcs| contains the export functions of the variant being built.
+  llvm::Constant *buildLibraryV0(std::string libraryName,
+                                 ArrayRef<llvm::Function *> funcs);
+  llvm::Constant *buildLibraryV0Header(std::string libraryName);
   llvm::Constant *buildLibraryV0ImportTable(std::string libraryName);
-  llvm::Constant *buildLibraryV0ExportTable(std::string libraryName);
+  llvm::Constant *buildLibraryV0ExportTable(std::string libraryName,
+                                            ArrayRef<llvm::Function *> funcs);
   llvm::Constant *buildLibraryV0ConstantTable(std::string libraryName);
+  llvm::Constant *buildLibraryV0RangeTable(std::string libraryName,
+                                           ArrayRef<llvm::Function *> funcs);
 
   llvm::Module *module = nullptr;
   Mode mode = Mode::INCLUDE_REFLECTION_ATTRS;
@@ -154,6 +181,22 @@ class LibraryBuilder {
   };
   SmallVector<Dispatch> exports;
 
+  struct Variant {
+    std::string name;
+    uint64_t processorData0Mask = 0;
+    SmallVector<llvm::Function *> funcs;
+  };
+  SmallVector<Variant> variants;
+
+  // Range functions keyed by the dispatch function they wrap.
+  llvm::DenseMap<llvm::Function *, llvm::Function *> rangeFuncs;
+
+  // Metadata shared by all variants of the library, built on first use.
+  llvm::Constant *v0Header = nullptr;
+  llvm::Constant *v0ExportAttrs = nullptr;
+  llvm::Constant *v0ExportNames = nullptr;
+  llvm::Constant *v0ExportTags = nullptr;
+
   size_t constantCount = 0;
 };
 
@@ -58,6 +58,21 @@ static void generateQueryFunction(llvm::raw_ostream &os,
         "iree_hal_executable_environment_v0_t* environment);\n";
 }
 
+static void generateDirectDispatchFunctions(
+    llvm::raw_ostream &os,
+    const std::vector<std::string> &direct_dispatch_names) {
+  if (direct_dispatch_names.empty()) return;
+  os << "\n// Direct dispatch entry points. Each runs the workgroups in the\n"
+     << "// given range and may be called in place of the library exports.\n";
+  for (const auto &name : direct_dispatch_names) {
+    os << "int " << name << "(\n"
+       << "    const iree_hal_executable_environment_v0_t* environment,\n"
+       << "    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,\n"
+       << "    const iree_hal_executable_workgroup_range_v0_t* "
+          "workgroup_range);\n";
+  }
+}
+
 static void generateSuffix(llvm::raw_ostream &os,
                            const std::string &library_name,
                            const std::string &query_function_name) {
@@ -74,12 +89,14 @@ static void generateSuffix(llvm::raw_ostream &os,
 
 static bool generateExecutableLibraryHeader(
     const std::string &library_name, const std::string &query_function_name,
+    const std::vector<std::string> &direct_dispatch_names,
     const std::string &header_file_path) {
   std::error_code ec;
   llvm::raw_fd_ostream os(header_file_path, ec);
 
   generatePrefix(os, library_name, query_function_name);
   generateQueryFunction(os, library_name, query_function_name);
+  generateDirectDispatchFunctions(os, direct_dispatch_names);
   generateSuffix(os, library_name, query_function_name);
 
   os.close();
@@ -88,6 +105,7 @@ static bool generateExecutableLibraryHeader(
 
 bool outputStaticLibrary(const std::string &library_name,
                          const std::string &query_function_name,
+                         const std::vector<std::string> &direct_dispatch_names,
                          const std::string &library_output_path,
                          const std::string &temp_object_path) {
   llvm::SmallString<32> object_file_path(library_output_path);
@@ -103,6 +121,7 @@ bool outputStaticLibrary(const std::string &library_name,
 
   // Generate the header file.
   return generateExecutableLibraryHeader(library_name, query_function_name,
+                                         direct_dispatch_names,
                                          header_file_path.c_str());
 }
 
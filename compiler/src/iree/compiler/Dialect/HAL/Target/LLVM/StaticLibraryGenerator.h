@@ -9,6 +9,7 @@
 #define IREE_COMPILER_DIALECT_HAL_TARGET_LLVM_STATICLIBRARYGENERATOR_H_
 
 #include <string>
+#include <vector>
 
 namespace mlir {
 namespace iree_compiler {
@@ -18,9 +19,12 @@ namespace HAL {
 // Produces a static executable library and generated '.h'.
 // The temporary object file is copied to the library_output_path. The '.h' file
 // with the query_function_name is placed beside it (using the same base
-// filename of the library). Returns true if successful.
+// filename of the library). Each of |direct_dispatch_names| is declared in the
+// header as an `iree_hal_executable_dispatch_range_v0_t` function that may be
+// called directly by the host. Returns true if successful.
 bool outputStaticLibrary(const std::string &library_name,
                          const std::string &query_function_name,
+                         const std::vector<std::string> &direct_dispatch_names,
                          const std::string &library_output_path,
                          const std::string &temp_object_path);
 
@@ -57,6 +57,14 @@ void TargetOptions::bindOptions(OptionsBinder &binder) {
       llvm::cl::desc(
           "Path to write translated and serialized executable binaries into."),
       llvm::cl::cat(halTargetOptionsCategory));
+
+  binder.opt<std::string>(
+      "iree-hal-dispatch-profile", dispatchProfilePath,
+      llvm::cl::desc("Path of a JSON dispatch profile measured at runtime "
+                     "(see build_tools/benchmarks/"
+                     "summarize_dispatch_profile.py) to attach to the "
+                     "hal.executable.export ops."),
+      llvm::cl::cat(halTargetOptionsCategory));
 }
 
 // Renames |op| within |moduleOp| with a new name that is unique within both
@@ -223,6 +231,21 @@ LogicalResult TargetBackend::linkExecutablesInto(
         exportRefReplacements[oldSymbolRefAttr] = newSymbolRefAttr;
       }
 
+      // Carry over the objects that must be linked into the variant.
+      if (auto objectsAttr = variantOp.objectsAttr()) {
+        SmallVector<Attribute> linkedObjectAttrs;
+        if (auto linkedObjectsAttr = linkedTargetOp.objectsAttr()) {
+          linkedObjectAttrs.append(linkedObjectsAttr.begin(),
+                                   linkedObjectsAttr.end());
+        }
+        for (auto objectAttr : objectsAttr) {
+          if (!llvm::is_contained(linkedObjectAttrs, objectAttr)) {
+            linkedObjectAttrs.push_back(objectAttr);
+          }
+        }
+        linkedTargetOp.objectsAttr(builder.getArrayAttr(linkedObjectAttrs));
+      }
+
       // Merge the existing module into the new linked module op.
       auto sourceModuleOp = getInnerModuleFn(variantOp.getInnerModule());
       if (failed(mergeModuleInto(sourceModuleOp, linkedModuleOp,
@@ -8,6 +8,7 @@
 #define IREE_COMPILER_DIALECT_HAL_TARGET_TARGETBACKEND_H_
 
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -25,6 +26,8 @@ namespace iree_compiler {
 namespace IREE {
 namespace HAL {
 
+class ExecutableTranslationCache;
+
 // TODO(benvanik): remove this and replace with the pass pipeline options.
 // Controls executable translation targets.
 struct TargetOptions {
@@ -43,6 +46,14 @@ struct TargetOptions {
   // A path to write translated and serialized executable binaries into.
   std::string executableBinariesPath;
 
+  // A path to a JSON dispatch profile measured at runtime.
+  std::string dispatchProfilePath;
+
+  // An optional cache of translated executable variants shared by all
+  // compilations in the same MLIRContext. Not settable from flags; owned by
+  // long-lived compiler sessions.
+  std::shared_ptr<ExecutableTranslationCache> translationCache;
+
   // TODO(benvanik): flags for debug/optimization/etc.
   // The intent is that we can have a global debug/-ON flag that then each
   // target backend can have tickle it's own flags in the right way. Right now
@@ -122,6 +133,11 @@ class TargetBackend {
   // TODO(benvanik): remove this once we can properly specify targets.
   virtual std::string deviceID() const { return name(); }
 
+  // Returns true if the backend links the objects declared on variants with
+  // `objects = [#hal.executable.object<...>]` into the binaries it produces.
+  // Variants with objects fail to serialize on backends that do not.
+  virtual bool supportsExecutableObjects() const { return false; }
+
   // Registers dependent dialects for the TargetBackend.
   // Mirrors the method on mlir::Pass of the same name. A TargetBackend is
   // expected to register the dialects it will create entities for (Operations,
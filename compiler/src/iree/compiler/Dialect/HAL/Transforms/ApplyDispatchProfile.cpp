@@ -0,0 +1,155 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <memory>
+#include <utility>
+
+#include "iree/compiler/Dialect/HAL/IR/HALDialect.h"
+#include "iree/compiler/Dialect/HAL/IR/HALOps.h"
+#include "iree/compiler/Dialect/HAL/Transforms/Passes.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/Pass/Pass.h"
+#include "mlir/Support/FileUtilities.h"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace HAL {
+
+namespace {
+
+// Measured execution of all dispatches of an export.
+struct DispatchProfile {
+  int64_t count = 0;
+  int64_t totalNs = 0;
+  double fraction = 0.0;
+};
+
+// Attaches the dispatch times measured at runtime to hal.executable.export ops
+// so that later compilation stages can focus on the dispatches that matter.
+// The profile is the JSON produced from a runtime device profiling capture by
+// build_tools/benchmarks/summarize_dispatch_profile.py:
+//   {
+//     "dispatches": [
+//       {"name": "main_dispatch_0", "workgroup_count": [4, 1, 1],
+//        "count": 10, "total_ns": 12345, "fraction": 0.25},
+//       ...
+//     ]
+//   }
+// Entries are matched by export name and aggregated across workgroup counts.
+//
+// Example:
+//   hal.executable.export public @main_dispatch_0 ordinal(0) layout(...)
+// ->
+//   hal.executable.export public @main_dispatch_0 ordinal(0) layout(...)
+//       attributes {hal.dispatch_profile = {count = 10 : i64,
+//                   fraction = 2.5e-01 : f64, total_ns = 12345 : i64}}
+class ApplyDispatchProfilePass
+    : public PassWrapper<ApplyDispatchProfilePass, OperationPass<ModuleOp>> {
+ public:
+  ApplyDispatchProfilePass() = default;
+  ApplyDispatchProfilePass(const ApplyDispatchProfilePass &pass)
+      : profiles(pass.profiles) {}
+  ApplyDispatchProfilePass(StringRef path) { this->path = path.str(); }
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<IREE::HAL::HALDialect>();
+  }
+
+  StringRef getArgument() const override {
+    return "iree-hal-apply-dispatch-profile";
+  }
+
+  StringRef getDescription() const override {
+    return "Attaches runtime dispatch profile data to hal.executable.export "
+           "ops.";
+  }
+
+  LogicalResult initialize(MLIRContext *context) override {
+    if (path.empty()) return success();
+    std::string errorMessage;
+    auto file = openInputFile(path, &errorMessage);
+    if (!file) {
+      return emitError(UnknownLoc::get(context))
+             << "failed to open dispatch profile '" << path
+             << "': " << errorMessage;
+    }
+    auto json = llvm::json::parse(file->getBuffer());
+    if (!json) {
+      return emitError(UnknownLoc::get(context))
+             << "failed to parse dispatch profile '" << path
+             << "': " << llvm::toString(json.takeError());
+    }
+    auto *root = json->getAsObject();
+    auto *dispatches = root ? root->getArray("dispatches") : nullptr;
+    if (!dispatches) {
+      return emitError(UnknownLoc::get(context))
+             << "dispatch profile '" << path
+             << "' has no \"dispatches\" array";
+    }
+    for (auto &value : *dispatches) {
+      auto *entry = value.getAsObject();
+      auto name = entry ? entry->getString("name") : llvm::None;
+      if (!name) {
+        return emitError(UnknownLoc::get(context))
+               << "invalid dispatch entry in dispatch profile '" << path
+               << "'";
+      }
+      auto &profile = profiles[*name];
+      profile.count += entry->getInteger("count").getValueOr(0);
+      profile.totalNs += entry->getInteger("total_ns").getValueOr(0);
+      profile.fraction += entry->getNumber("fraction").getValueOr(0.0);
+    }
+    return success();
+  }
+
+  void runOnOperation() override {
+    if (profiles.empty()) return;
+    auto moduleOp = getOperation();
+    Builder builder(moduleOp.getContext());
+    moduleOp.walk([&](IREE::HAL::ExecutableExportOp exportOp) {
+      auto it = profiles.find(exportOp.sym_name());
+      if (it == profiles.end()) return;
+      auto &profile = it->second;
+      exportOp->setAttr(
+          "hal.dispatch_profile",
+          builder.getDictionaryAttr({
+              builder.getNamedAttr("count",
+                                   builder.getI64IntegerAttr(profile.count)),
+              builder.getNamedAttr("fraction",
+                                   builder.getF64FloatAttr(profile.fraction)),
+              builder.getNamedAttr("total_ns",
+                                   builder.getI64IntegerAttr(profile.totalNs)),
+          }));
+    });
+  }
+
+ private:
+  Option<std::string> path{
+      *this, "path",
+      llvm::cl::desc("Path of the JSON dispatch profile to apply.")};
+
+  llvm::StringMap<DispatchProfile> profiles;
+};
+
+}  // namespace
+
+std::unique_ptr<OperationPass<ModuleOp>> createApplyDispatchProfilePass(
+    StringRef path) {
+  return std::make_unique<ApplyDispatchProfilePass>(path);
+}
+
+static PassRegistration<ApplyDispatchProfilePass> pass([] {
+  return std::make_unique<ApplyDispatchProfilePass>();
+});
+
+}  // namespace HAL
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
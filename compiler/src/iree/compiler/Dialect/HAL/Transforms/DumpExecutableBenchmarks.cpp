@@ -4,6 +4,7 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -12,10 +13,12 @@
 #include "iree/compiler/Dialect/HAL/Transforms/Passes.h"
 #include "iree/compiler/Dialect/Stream/IR/StreamOps.h"
 #include "iree/compiler/Utils/IndexSet.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/ToolOutputFile.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
+#include "mlir/IR/Matchers.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Pass/PassManager.h"
 #include "mlir/Support/FileUtilities.h"
@@ -168,11 +171,11 @@ static IREE::Util::GlobalOp appendGlobalBuffer(
 //
 // Expects the runner to pass an i32 value indicating the number of dispatches
 // to be made in one submission.
-static void appendDispatchBenchmark(IREE::HAL::ExecutableOp executableOp,
-                                    IREE::HAL::ExecutableVariantOp variantOp,
-                                    IREE::HAL::ExecutableExportOp exportOp,
-                                    DispatchParams dispatchParams,
-                                    OpBuilder &moduleBuilder) {
+static func::FuncOp appendDispatchBenchmark(
+    IREE::HAL::ExecutableOp executableOp,
+    IREE::HAL::ExecutableVariantOp variantOp,
+    IREE::HAL::ExecutableExportOp exportOp, DispatchParams dispatchParams,
+    OpBuilder &moduleBuilder) {
   auto loc = FusedLoc::get(executableOp.getContext(), dispatchParams.locs);
 
   std::string baseName = (executableOp.getName() + "_" + variantOp.getName() +
@@ -224,7 +227,8 @@ static void appendDispatchBenchmark(IREE::HAL::ExecutableOp executableOp,
       funcBuilder
           .create<IREE::HAL::CommandBufferCreateOp>(
               loc, funcBuilder.getType<IREE::HAL::CommandBufferType>(), device,
-              commandBufferModes, IREE::HAL::CommandCategoryBitfield::Dispatch)
+              commandBufferModes, IREE::HAL::CommandCategoryBitfield::Dispatch,
+              /*binding_capacity=*/Value{})
           .result();
 
   // Get the layout required to set up the dispatches.
@@ -317,14 +321,70 @@ static void appendDispatchBenchmark(IREE::HAL::ExecutableOp executableOp,
   funcBuilder.create<IREE::HAL::ExSubmitAndWaitOp>(loc, device, commandBuffer);
 
   funcBuilder.create<mlir::func::ReturnOp>(loc);
+  return funcOp;
+}
+
+// A benchmark function appended for a particular export and its parameters.
+struct DispatchBenchmark {
+  func::FuncOp funcOp;
+  IREE::HAL::ExecutableExportOp exportOp;
+  unsigned ordinal = 0;
+  DispatchParams dispatchParams;
+};
+
+// Writes a `--dispatch=` flag for each benchmark in |benchmarks| that can be
+// passed to executable_library_benchmark along with the compiled module:
+//   --dispatch=executable:ordinal:export:XxYxZ:push_constant_count:b0,b1,...
+// Binding sizes are byte lengths. Benchmarks whose workgroup count does not
+// fold to a constant are skipped.
+static void writeDispatchFlags(IREE::HAL::ExecutableOp executableOp,
+                               ArrayRef<DispatchBenchmark> benchmarks,
+                               llvm::raw_ostream &os) {
+  // Matches the rodata names used for executables in the module archive.
+  std::string executableName = executableOp.getName().str();
+  std::replace(executableName.begin(), executableName.end(), '-', '_');
+  for (auto &benchmark : benchmarks) {
+    IREE::HAL::CommandBufferDispatchSymbolOp dispatchOp;
+    benchmark.funcOp.walk([&](IREE::HAL::CommandBufferDispatchSymbolOp op) {
+      dispatchOp = op;
+      return WalkResult::interrupt();
+    });
+    APInt workgroupCount[3];
+    if (!dispatchOp ||
+        !matchPattern(dispatchOp.workgroup_x(),
+                      m_ConstantInt(&workgroupCount[0])) ||
+        !matchPattern(dispatchOp.workgroup_y(),
+                      m_ConstantInt(&workgroupCount[1])) ||
+        !matchPattern(dispatchOp.workgroup_z(),
+                      m_ConstantInt(&workgroupCount[2]))) {
+      os << "# " << benchmark.funcOp.getName()
+         << ": skipped (dynamic workgroup count)\n";
+      continue;
+    }
+    os << "# " << benchmark.funcOp.getName() << "\n";
+    os << "--dispatch=" << executableName << ":" << benchmark.ordinal << ":"
+       << benchmark.exportOp.getName() << ":"
+       << workgroupCount[0].getZExtValue() << "x"
+       << workgroupCount[1].getZExtValue() << "x"
+       << workgroupCount[2].getZExtValue() << ":"
+       << benchmark.exportOp.layoutAttr().getPushConstants() << ":";
+    llvm::interleave(
+        benchmark.dispatchParams.bindings, os,
+        [&](const Binding &binding) { os << binding.size; }, ",");
+    os << "\n";
+  }
 }
 
 // Builds a module exporting one function for each dispatch configuration
 // targeting |sourceExecutableOp|.
+//
+// If |dispatchFlags| is provided a `--dispatch=` flag is appended for
+// each benchmark (see writeDispatchFlags).
 static mlir::OwningOpRef<mlir::ModuleOp> buildBenchmarkModule(
     IREE::HAL::ExecutableOp sourceExecutableOp,
     IREE::HAL::ExecutableVariantOp sourceVariantOp,
-    const DispatchParamsMap &dispatchParamsMap) {
+    const DispatchParamsMap &dispatchParamsMap,
+    llvm::raw_ostream *dispatchFlags) {
   // Empty module with default name.
   // We could use the original module name here to make tracking nicer.
   mlir::OwningOpRef<mlir::ModuleOp> moduleOp =
@@ -348,23 +408,28 @@ static mlir::OwningOpRef<mlir::ModuleOp> buildBenchmarkModule(
 
   // Add functions to test each entry point with its various dispatch
   // parameters.
-  bool hasAnyBenchmarks = false;
-  for (auto exportOp : variantOp.getOps<IREE::HAL::ExecutableExportOp>()) {
+  SmallVector<DispatchBenchmark> benchmarks;
+  for (auto it : llvm::enumerate(
+           variantOp.getOps<IREE::HAL::ExecutableExportOp>())) {
+    auto exportOp = it.value();
     auto symbolRefAttr =
         SymbolRefAttr::get(executableOp.getNameAttr(),
                            {FlatSymbolRefAttr::get(exportOp.getNameAttr())});
     auto dispatchParamsSet = dispatchParamsMap.find(symbolRefAttr);
     if (dispatchParamsSet != dispatchParamsMap.end()) {
       for (auto &dispatchParams : dispatchParamsSet->second) {
-        appendDispatchBenchmark(executableOp, variantOp, exportOp,
-                                dispatchParams, moduleBuilder);
-        hasAnyBenchmarks = true;
+        auto funcOp = appendDispatchBenchmark(executableOp, variantOp, exportOp,
+                                              dispatchParams, moduleBuilder);
+        unsigned ordinal = exportOp.ordinal()
+                               ? (unsigned)exportOp.ordinal()->getZExtValue()
+                               : (unsigned)it.index();
+        benchmarks.push_back({funcOp, exportOp, ordinal, dispatchParams});
       }
     }
   }
 
   // Skip the file when we could not generate any benchmarks.
-  if (!hasAnyBenchmarks) return {};
+  if (benchmarks.empty()) return {};
 
   // Run CSE and the canonicalizer to pretty up the output.
   PassManager passManager(moduleOp->getContext());
@@ -375,6 +440,11 @@ static mlir::OwningOpRef<mlir::ModuleOp> buildBenchmarkModule(
     return {};
   }
 
+  // Workgroup counts are only known after folding the calculation.
+  if (dispatchFlags) {
+    writeDispatchFlags(executableOp, benchmarks, *dispatchFlags);
+  }
+
   return moduleOp;
 }
 
@@ -424,12 +494,19 @@ class DumpExecutableBenchmarksPass
       llvm::sys::fs::create_directories(path);
     }
 
+    // Flags for running all dispatches with executable_library_benchmark
+    // against the compiled module are only written when dumping to files.
+    std::string dispatchFlags;
+    llvm::raw_string_ostream dispatchFlagsStream(dispatchFlags);
+    bool emitDispatchFlags = !path.empty() && path != "-";
+
     // Produce one file per executable containing all exported entry points.
     for (auto executableOp : moduleOp.getOps<IREE::HAL::ExecutableOp>()) {
       for (auto variantOp :
            executableOp.getOps<IREE::HAL::ExecutableVariantOp>()) {
-        auto benchmarkModuleOp =
-            buildBenchmarkModule(executableOp, variantOp, dispatchParamsMap);
+        auto benchmarkModuleOp = buildBenchmarkModule(
+            executableOp, variantOp, dispatchParamsMap,
+            emitDispatchFlags ? &dispatchFlagsStream : nullptr);
         if (!benchmarkModuleOp) continue;
         auto fileName = (moduleName + "_" + executableOp.getName() + "_" +
                          variantOp.getName() + ".mlir")
@@ -451,6 +528,20 @@ class DumpExecutableBenchmarksPass
         }
       }
     }
+
+    if (emitDispatchFlags && !dispatchFlags.empty()) {
+      auto filePath = (path + llvm::sys::path::get_separator() + moduleName +
+                       "_dispatches.flagfile")
+                          .str();
+      std::string error;
+      auto file = mlir::openOutputFile(filePath, &error);
+      if (!file) {
+        moduleOp.emitError() << "while dumping to " << path << ": " << error;
+        return signalPassFailure();
+      }
+      file->os() << dispatchFlagsStream.str();
+      file->keep();
+    }
   }
 
  private:
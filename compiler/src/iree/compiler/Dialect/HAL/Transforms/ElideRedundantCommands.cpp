@@ -10,12 +10,15 @@
 #include "iree/compiler/Dialect/HAL/IR/HALOps.h"
 #include "iree/compiler/Dialect/HAL/Transforms/Passes.h"
 #include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/PostOrderIterator.h"
+#include "llvm/ADT/SetVector.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/Builders.h"
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/Diagnostics.h"
 #include "mlir/IR/Matchers.h"
+#include "mlir/IR/RegionGraphTraits.h"
 #include "mlir/Pass/Pass.h"
 
 namespace mlir {
@@ -28,6 +31,11 @@ struct DescriptorState {
   Value buffer;
   Value offset;
   Value length;
+
+  bool operator==(const DescriptorState &other) const {
+    return buffer == other.buffer && offset == other.offset &&
+           length == other.length;
+  }
 };
 
 struct DescriptorSetState {
@@ -45,6 +53,11 @@ struct DescriptorSetState {
     executableLayout = {};
     descriptors.clear();
   }
+
+  bool operator==(const DescriptorSetState &other) const {
+    return executableLayout == other.executableLayout &&
+           descriptors == other.descriptors;
+  }
 };
 
 struct CommandBufferState {
@@ -62,6 +75,11 @@ struct CommandBufferState {
   // We need to use IPO to track that.
   IREE::HAL::CommandBufferExecutionBarrierOp previousFullBarrier;
 
+  // True if the state tracks everything recorded into the command buffer since
+  // it was created. Only then is the set of bound descriptors known to be
+  // complete.
+  bool isComplete = false;
+
   Value &getPushConstant(int64_t index) {
     if (index >= pushConstants.size()) {
       pushConstants.resize(index + 1);
@@ -81,39 +99,245 @@ struct CommandBufferState {
     }
     return &descriptorSets[index];
   }
+
+  // Forgets any state referencing |value|. Used when |value| is redefined, as
+  // happens to values defined within loops.
+  void forgetValue(Value value) {
+    if (pushConstantLayout == value) {
+      pushConstantLayout = {};
+      pushConstants.clear();
+    }
+    for (auto &pushConstant : pushConstants) {
+      if (pushConstant == value) pushConstant = {};
+    }
+    for (auto &setState : descriptorSets) {
+      if (setState.executableLayout == value) {
+        setState.clear();
+        continue;
+      }
+      for (auto &descriptor : setState.descriptors) {
+        if (descriptor.buffer == value || descriptor.offset == value ||
+            descriptor.length == value) {
+          descriptor = {};
+        }
+      }
+    }
+  }
+
+  // Intersects the state with |other|, keeping only what holds on both.
+  void meet(const CommandBufferState &other) {
+    if (pushConstantLayout != other.pushConstantLayout) {
+      pushConstantLayout = {};
+      pushConstants.clear();
+    }
+    pushConstants.resize(
+        std::min(pushConstants.size(), other.pushConstants.size()));
+    for (auto it : llvm::enumerate(other.pushConstants)) {
+      if (it.index() >= pushConstants.size()) break;
+      if (pushConstants[it.index()] != it.value()) {
+        pushConstants[it.index()] = {};
+      }
+    }
+    descriptorSets.resize(
+        std::min(descriptorSets.size(), other.descriptorSets.size()));
+    for (auto it : llvm::enumerate(other.descriptorSets)) {
+      if (it.index() >= descriptorSets.size()) break;
+      auto &setState = descriptorSets[it.index()];
+      if (setState.executableLayout != it.value().executableLayout) {
+        setState.clear();
+        continue;
+      }
+      setState.descriptors.resize(std::min(setState.descriptors.size(),
+                                           it.value().descriptors.size()));
+      for (auto descriptor : llvm::enumerate(it.value().descriptors)) {
+        if (descriptor.index() >= setState.descriptors.size()) break;
+        if (!(setState.descriptors[descriptor.index()] == descriptor.value())) {
+          setState.descriptors[descriptor.index()] = {};
+        }
+      }
+    }
+    if (!other.previousFullBarrier) previousFullBarrier = {};
+    isComplete = isComplete && other.isComplete;
+  }
+
+  bool operator==(const CommandBufferState &other) const {
+    return pushConstantLayout == other.pushConstantLayout &&
+           pushConstants == other.pushConstants &&
+           descriptorSets == other.descriptorSets &&
+           !previousFullBarrier == !other.previousFullBarrier &&
+           isComplete == other.isComplete;
+  }
+};
+
+struct CommandBufferStateMap {
+  DenseMap<Value, CommandBufferState> states;
+
+  void meet(const CommandBufferStateMap &other) {
+    SmallVector<Value> unknownCommandBuffers;
+    for (auto &it : states) {
+      auto otherIt = other.states.find(it.first);
+      if (otherIt == other.states.end()) {
+        unknownCommandBuffers.push_back(it.first);
+      } else {
+        it.second.meet(otherIt->second);
+      }
+    }
+    for (auto commandBuffer : unknownCommandBuffers) {
+      states.erase(commandBuffer);
+    }
+  }
+
+  bool operator==(const CommandBufferStateMap &other) const {
+    if (states.size() != other.states.size()) return false;
+    for (auto &it : states) {
+      auto otherIt = other.states.find(it.first);
+      if (otherIt == other.states.end() || !(it.second == otherIt->second)) {
+        return false;
+      }
+    }
+    return true;
+  }
 };
 
-using CommandBufferStateMap = DenseMap<Value, CommandBufferState>;
+// A byte range of a buffer accessed by a command.
+struct ResourceRange {
+  Value buffer;
+  Value offset;
+  Value length;
+};
+
+// Resources accessed by the commands recorded between two barriers.
+struct CommandSegment {
+  SmallVector<ResourceRange> ranges;
+  // Set when a command accesses resources we can't determine.
+  bool isUnknown = false;
+
+  void append(const CommandSegment &other) {
+    ranges.append(other.ranges);
+    isUnknown = isUnknown || other.isUnknown;
+  }
+};
+
+// Returns the root buffer of |range| and the constant range within it, if
+// known.
+static Optional<std::tuple<Value, int64_t, int64_t>> resolveRange(
+    const ResourceRange &range) {
+  APInt offsetInt;
+  APInt lengthInt;
+  if (!matchPattern(range.offset, m_ConstantInt(&offsetInt)) ||
+      !matchPattern(range.length, m_ConstantInt(&lengthInt))) {
+    return llvm::None;
+  }
+  Value buffer = range.buffer;
+  int64_t offset = offsetInt.getSExtValue();
+  while (auto subspanOp = dyn_cast_or_null<IREE::HAL::BufferSubspanOp>(
+             buffer.getDefiningOp())) {
+    APInt subspanOffset;
+    if (!matchPattern(subspanOp.source_offset(),
+                      m_ConstantInt(&subspanOffset))) {
+      break;
+    }
+    offset += subspanOffset.getSExtValue();
+    buffer = subspanOp.source_buffer();
+  }
+  return std::make_tuple(buffer, offset, lengthInt.getSExtValue());
+}
+
+// Returns true if the two ranges are provably disjoint: either byte ranges of
+// the same buffer that don't overlap or ranges of two separate allocations.
+static bool isDisjoint(const ResourceRange &lhs, const ResourceRange &rhs) {
+  auto lhsRange = resolveRange(lhs);
+  auto rhsRange = resolveRange(rhs);
+  if (!lhsRange || !rhsRange) return false;
+  auto [lhsBuffer, lhsOffset, lhsLength] = *lhsRange;
+  auto [rhsBuffer, rhsOffset, rhsLength] = *rhsRange;
+  if (lhsBuffer == rhsBuffer) {
+    return lhsOffset + lhsLength <= rhsOffset ||
+           rhsOffset + rhsLength <= lhsOffset;
+  }
+  return lhsBuffer.getDefiningOp<IREE::HAL::AllocatorAllocateOp>() &&
+         rhsBuffer.getDefiningOp<IREE::HAL::AllocatorAllocateOp>();
+}
+
+// Returns true if no command in |lhs| may access the resources of a command
+// in |rhs|. Accesses are conservatively treated as read-write.
+static bool isDisjoint(const CommandSegment &lhs, const CommandSegment &rhs) {
+  if (lhs.isUnknown || rhs.isUnknown) return false;
+  for (auto &lhsRange : lhs.ranges) {
+    for (auto &rhsRange : rhs.ranges) {
+      if (!isDisjoint(lhsRange, rhsRange)) return false;
+    }
+  }
+  return true;
+}
+
+// Tracks the barriers recorded into a command buffer within a block to find
+// those separating commands with no resources in common.
+struct CommandBufferSegments {
+  // The last full barrier that may still be elided and the commands recorded
+  // before it. Unknown if there was no barrier in the block.
+  IREE::HAL::CommandBufferExecutionBarrierOp pendingBarrier;
+  CommandSegment beforeBarrier;
+  // Commands recorded since the last barrier.
+  CommandSegment current;
+
+  CommandBufferSegments() { current.isUnknown = true; }
+
+  // Handles a barrier or the end of recording.
+  void closeSegment(IREE::HAL::CommandBufferExecutionBarrierOp nextBarrier,
+                    bool applyChanges) {
+    if (pendingBarrier && isDisjoint(beforeBarrier, current)) {
+      // The commands on both sides of the pending barrier can run
+      // concurrently.
+      if (applyChanges) pendingBarrier.erase();
+      beforeBarrier.append(current);
+    } else {
+      beforeBarrier = std::move(current);
+    }
+    pendingBarrier = nextBarrier;
+    current = {};
+    if (!nextBarrier) {
+      beforeBarrier = {};
+      current.isUnknown = true;
+    }
+  }
+};
 
 }  // namespace
 
-static void processOp(IREE::HAL::CommandBufferExecutionBarrierOp op,
-                      CommandBufferState &state) {
+static bool isFullBarrier(IREE::HAL::CommandBufferExecutionBarrierOp op) {
+  // These are all we emit today so this simple analysis can remain simple by
+  // pattern matching.
+  return bitEnumContains(op.source_stage_mask(),
+                         IREE::HAL::ExecutionStageBitfield::CommandRetire |
+                             IREE::HAL::ExecutionStageBitfield::Transfer |
+                             IREE::HAL::ExecutionStageBitfield::Dispatch) &&
+         bitEnumContains(op.target_stage_mask(),
+                         IREE::HAL::ExecutionStageBitfield::CommandRetire |
+                             IREE::HAL::ExecutionStageBitfield::Transfer |
+                             IREE::HAL::ExecutionStageBitfield::Dispatch);
+}
+
+// Returns true if |op| was erased.
+static bool processOp(IREE::HAL::CommandBufferExecutionBarrierOp op,
+                      CommandBufferState &state, bool applyChanges) {
   if (state.previousFullBarrier) {
     // We are following a full barrier - this is a no-op (issuing two barriers
     // doesn't make the device barrier any harder).
-    op.erase();
-    return;
-  }
-
-  // See if this is a full barrier. These are all we emit today so this simple
-  // analysis can remain simple by pattern matching.
-  if (bitEnumContains(op.source_stage_mask(),
-                      IREE::HAL::ExecutionStageBitfield::CommandRetire |
-                          IREE::HAL::ExecutionStageBitfield::Transfer |
-                          IREE::HAL::ExecutionStageBitfield::Dispatch) &&
-      bitEnumContains(op.target_stage_mask(),
-                      IREE::HAL::ExecutionStageBitfield::CommandRetire |
-                          IREE::HAL::ExecutionStageBitfield::Transfer |
-                          IREE::HAL::ExecutionStageBitfield::Dispatch)) {
+    if (applyChanges) op.erase();
+    return true;
+  }
+
+  if (isFullBarrier(op)) {
     state.previousFullBarrier = op;
   } else {
     state.previousFullBarrier = {};
   }
+  return false;
 }
 
 static LogicalResult processOp(IREE::HAL::CommandBufferPushConstantsOp op,
-                               CommandBufferState &state) {
+                               CommandBufferState &state, bool applyChanges) {
   // Push constant state is only shared with the same layout.
   if (state.pushConstantLayout != op.executable_layout()) {
     state.pushConstantLayout = op.executable_layout();
@@ -133,7 +357,7 @@ static LogicalResult processOp(IREE::HAL::CommandBufferPushConstantsOp op,
       stateValue = value.value();
     }
   }
-  if (redundantIndices.none()) return success();  // no-op
+  if (redundantIndices.none() || !applyChanges) return success();  // no-op
 
   // If all bits are set we can just kill the op.
   if (redundantIndices.all()) {
@@ -163,7 +387,7 @@ static LogicalResult processOp(IREE::HAL::CommandBufferPushConstantsOp op,
 }
 
 static LogicalResult processOp(IREE::HAL::CommandBufferPushDescriptorSetOp op,
-                               CommandBufferState &state) {
+                               CommandBufferState &state, bool applyChanges) {
   auto *setState = state.getDescriptorSet(op.set());
   if (!setState) return failure();
 
@@ -195,7 +419,7 @@ static LogicalResult processOp(IREE::HAL::CommandBufferPushDescriptorSetOp op,
 
   // If all bits are set we can just kill the op.
   if (isLayoutEqual && redundantIndices.all()) {
-    op.erase();
+    if (applyChanges) op.erase();
     return success();
   }
 
@@ -203,15 +427,34 @@ static LogicalResult processOp(IREE::HAL::CommandBufferPushDescriptorSetOp op,
 }
 
 static LogicalResult processOp(IREE::HAL::CommandBufferBindDescriptorSetOp op,
-                               CommandBufferState &state) {
+                               CommandBufferState &state, bool applyChanges) {
   // TODO(benvanik): descriptor set binding.
   // For now we just nuke the state.
   auto *setState = state.getDescriptorSet(op.set());
   if (!setState) return failure();
   setState->clear();
+  // The buffers bound through the descriptor set aren't tracked.
+  state.isComplete = false;
   return success();
 }
 
+// Returns the resources accessed by a dispatch given the bound descriptors.
+static CommandSegment getDispatchSegment(const CommandBufferState &state) {
+  CommandSegment segment;
+  if (!state.isComplete) {
+    segment.isUnknown = true;
+    return segment;
+  }
+  for (auto &setState : state.descriptorSets) {
+    for (auto &descriptor : setState.descriptors) {
+      if (!descriptor.buffer) continue;
+      segment.ranges.push_back(
+          {descriptor.buffer, descriptor.offset, descriptor.length});
+    }
+  }
+  return segment;
+}
+
 class ElideRedundantCommandsPass
     : public PassWrapper<ElideRedundantCommandsPass, OperationPass<void>> {
  public:
@@ -228,77 +471,196 @@ class ElideRedundantCommandsPass
   }
 
   void runOnOperation() override {
-    auto parentOp = getOperation();
-
-    // TODO(benvanik): intraprocedural at least; keep track of state at block
-    // boundaries. IPO would be nice but it (today) rarely happens that we
-    // pass command buffers across calls.
-    for (auto &region : parentOp->getRegions()) {
-      for (auto &block : region.getBlocks()) {
-        // State tracking for each command buffer found.
-        // Discard state on ops we don't currently analyze (because this is
-        // super basic - we really need to analyze them).
-        CommandBufferStateMap stateMap;
-        auto invalidateState = [&](Value commandBuffer) {
-          stateMap[commandBuffer] = {};
-        };
-        auto resetCommandBufferBarrierBit = [&](Operation *op) {
-          assert(op->getNumOperands() > 0 && "must be a command buffer op");
-          auto commandBuffer = op->getOperand(0);
-          assert(commandBuffer.getType().isa<IREE::HAL::CommandBufferType>() &&
-                 "operand 0 must be a command buffer");
-          stateMap[commandBuffer].previousFullBarrier = {};
-        };
-        for (auto &op : llvm::make_early_inc_range(block.getOperations())) {
-          if (!op.getDialect()) continue;
-          TypeSwitch<Operation *>(&op)
-              .Case([&](IREE::HAL::CommandBufferFinalizeOp op) {
-                invalidateState(op.command_buffer());
-              })
-              .Case([&](IREE::HAL::CommandBufferExecutionBarrierOp op) {
-                processOp(op, stateMap[op.command_buffer()]);
-              })
-              .Case([&](IREE::HAL::CommandBufferPushConstantsOp op) {
-                resetCommandBufferBarrierBit(op);
-                if (failed(processOp(op, stateMap[op.command_buffer()]))) {
-                  invalidateState(op.command_buffer());
-                }
-              })
-              .Case([&](IREE::HAL::CommandBufferPushDescriptorSetOp op) {
+    for (auto &region : getOperation()->getRegions()) {
+      processRegion(region);
+    }
+  }
+
+ private:
+  // Propagates the command buffer state across the blocks of |region| until a
+  // fixed point is reached and then elides the redundant commands found.
+  // TODO(benvanik): IPO would be nice but it (today) rarely happens that we
+  // pass command buffers across calls.
+  void processRegion(Region &region) {
+    if (region.empty()) return;
+
+    // Iterate in reverse post-order such that predecessors are usually visited
+    // first. Predecessors not visited yet are optimistically ignored; their
+    // state is met in once they are and the successors revisited.
+    DenseMap<Block *, CommandBufferStateMap> exitStates;
+    auto getEntryState = [&](Block *block) {
+      CommandBufferStateMap entryState;
+      bool isFirst = true;
+      for (auto *predecessor : block->getPredecessors()) {
+        auto it = exitStates.find(predecessor);
+        if (it == exitStates.end()) continue;
+        if (isFirst) {
+          entryState = it->second;
+          isFirst = false;
+        } else {
+          entryState.meet(it->second);
+        }
+      }
+      return entryState;
+    };
+    SetVector<Block *> worklist;
+    llvm::ReversePostOrderTraversal<Block *> traversal(&region.front());
+    for (auto *block : traversal) worklist.insert(block);
+    while (!worklist.empty()) {
+      auto *block = worklist.front();
+      worklist.remove(block);
+      auto exitState = getEntryState(block);
+      processBlock(*block, exitState, /*applyChanges=*/false);
+      auto it = exitStates.find(block);
+      if (it != exitStates.end() && it->second == exitState) continue;
+      exitStates[block] = std::move(exitState);
+      for (auto *successor : block->getSuccessors()) worklist.insert(successor);
+    }
+
+    // Now that the state on entry to each block is known elide the commands.
+    for (auto *block : traversal) {
+      auto state = getEntryState(block);
+      processBlock(*block, state, /*applyChanges=*/true);
+    }
+  }
+
+  // Updates |stateMap| with the commands recorded in |block| and elides those
+  // that are redundant if |applyChanges| is set.
+  void processBlock(Block &block, CommandBufferStateMap &stateMap,
+                    bool applyChanges) {
+    // Discard state on ops we don't currently analyze (because this is
+    // super basic - we really need to analyze them).
+    auto invalidateState = [&](Value commandBuffer) {
+      stateMap.states[commandBuffer] = {};
+    };
+    auto resetCommandBufferBarrierBit = [&](Operation *op) {
+      assert(op->getNumOperands() > 0 && "must be a command buffer op");
+      auto commandBuffer = op->getOperand(0);
+      assert(commandBuffer.getType().isa<IREE::HAL::CommandBufferType>() &&
+             "operand 0 must be a command buffer");
+      stateMap.states[commandBuffer].previousFullBarrier = {};
+    };
+    // Values redefined on each trip around a loop must not match the state
+    // recorded with their previous definition.
+    auto forgetValues = [&](ValueRange values) {
+      for (auto value : values) {
+        stateMap.states.erase(value);
+        for (auto &it : stateMap.states) it.second.forgetValue(value);
+      }
+    };
+    forgetValues(block.getArguments());
+
+    // Commands accessing disjoint resources need no barrier between them.
+    DenseMap<Value, CommandBufferSegments> segmentMap;
+    auto recordAccess = [&](Value commandBuffer, CommandSegment segment) {
+      segmentMap[commandBuffer].current.append(segment);
+    };
+
+    for (auto &op : llvm::make_early_inc_range(block.getOperations())) {
+      if (!op.getDialect()) continue;
+      // Only ops without results are elided so this is safe to check after.
+      bool hasResults = op.getNumResults() > 0;
+      TypeSwitch<Operation *>(&op)
+          .Case([&](IREE::HAL::CommandBufferCreateOp op) {
+            // Nothing has been recorded into a new command buffer.
+            auto &state = stateMap.states[op.result()];
+            state = {};
+            state.isComplete = true;
+            segmentMap[op.result()].current.isUnknown = false;
+          })
+          .Case([&](IREE::HAL::CommandBufferFinalizeOp op) {
+            segmentMap[op.command_buffer()].closeSegment({}, applyChanges);
+            invalidateState(op.command_buffer());
+          })
+          .Case([&](IREE::HAL::CommandBufferExecutionBarrierOp op) {
+            auto commandBuffer = op.command_buffer();
+            if (processOp(op, stateMap.states[commandBuffer], applyChanges)) {
+              return;
+            }
+            IREE::HAL::CommandBufferExecutionBarrierOp fullBarrier;
+            if (isFullBarrier(op)) fullBarrier = op;
+            segmentMap[commandBuffer].closeSegment(fullBarrier, applyChanges);
+          })
+          .Case([&](IREE::HAL::CommandBufferPushConstantsOp op) {
+            resetCommandBufferBarrierBit(op);
+            if (failed(processOp(op, stateMap.states[op.command_buffer()],
+                                 applyChanges))) {
+              invalidateState(op.command_buffer());
+            }
+          })
+          .Case([&](IREE::HAL::CommandBufferPushDescriptorSetOp op) {
+            resetCommandBufferBarrierBit(op);
+            if (failed(processOp(op, stateMap.states[op.command_buffer()],
+                                 applyChanges))) {
+              invalidateState(op.command_buffer());
+            }
+          })
+          .Case([&](IREE::HAL::CommandBufferBindDescriptorSetOp op) {
+            resetCommandBufferBarrierBit(op);
+            if (failed(processOp(op, stateMap.states[op.command_buffer()],
+                                 applyChanges))) {
+              invalidateState(op.command_buffer());
+            }
+          })
+          .Case<IREE::HAL::CommandBufferDispatchSymbolOp,
+                IREE::HAL::CommandBufferDispatchOp>([&](Operation *op) {
+            resetCommandBufferBarrierBit(op);
+            auto commandBuffer = op->getOperand(0);
+            recordAccess(commandBuffer,
+                         getDispatchSegment(stateMap.states[commandBuffer]));
+          })
+          .Case([&](IREE::HAL::CommandBufferFillBufferOp op) {
+            resetCommandBufferBarrierBit(op);
+            CommandSegment segment;
+            segment.ranges.push_back(
+                {op.target_buffer(), op.target_offset(), op.length()});
+            recordAccess(op.command_buffer(), segment);
+          })
+          .Case([&](IREE::HAL::CommandBufferCopyBufferOp op) {
+            resetCommandBufferBarrierBit(op);
+            CommandSegment segment;
+            segment.ranges.push_back(
+                {op.source_buffer(), op.source_offset(), op.length()});
+            segment.ranges.push_back(
+                {op.target_buffer(), op.target_offset(), op.length()});
+            recordAccess(op.command_buffer(), segment);
+          })
+          .Case<IREE::HAL::CommandBufferDispatchIndirectSymbolOp,
+                IREE::HAL::CommandBufferDispatchIndirectOp>(
+              [&](Operation *op) {
                 resetCommandBufferBarrierBit(op);
-                if (failed(processOp(op, stateMap[op.command_buffer()]))) {
-                  invalidateState(op.command_buffer());
-                }
+                CommandSegment segment;
+                segment.isUnknown = true;
+                recordAccess(op->getOperand(0), segment);
               })
-              .Case([&](IREE::HAL::CommandBufferBindDescriptorSetOp op) {
-                resetCommandBufferBarrierBit(op);
-                if (failed(processOp(op, stateMap[op.command_buffer()]))) {
-                  invalidateState(op.command_buffer());
+          .Case<IREE::HAL::CommandBufferDeviceOp,
+                IREE::HAL::CommandBufferBeginDebugGroupOp,
+                IREE::HAL::CommandBufferEndDebugGroupOp>([&](Operation *op) {
+            // Ok - don't impact state.
+            resetCommandBufferBarrierBit(op);
+          })
+          .Default([&](Operation *op) {
+            // Unknown op - discard the state of the command buffers it may
+            // use. Nested regions are processed on their own as we don't
+            // model the control flow of region ops (like scf.if).
+            SetVector<Value> commandBuffers;
+            op->walk([&](Operation *nestedOp) {
+              for (auto operand : nestedOp->getOperands()) {
+                if (operand.getType().isa<IREE::HAL::CommandBufferType>()) {
+                  commandBuffers.insert(operand);
                 }
-              })
-              .Case<IREE::HAL::CommandBufferDeviceOp,
-                    IREE::HAL::CommandBufferBeginDebugGroupOp,
-                    IREE::HAL::CommandBufferEndDebugGroupOp,
-                    IREE::HAL::CommandBufferFillBufferOp,
-                    IREE::HAL::CommandBufferCopyBufferOp,
-                    IREE::HAL::CommandBufferDispatchSymbolOp,
-                    IREE::HAL::CommandBufferDispatchOp,
-                    IREE::HAL::CommandBufferDispatchIndirectSymbolOp,
-                    IREE::HAL::CommandBufferDispatchIndirectOp>(
-                  [&](Operation *op) {
-                    // Ok - don't impact state.
-                    resetCommandBufferBarrierBit(op);
-                  })
-              .Default([&](Operation *op) {
-                // Unknown op - discard state cache.
-                // This is to avoid correctness issues with region ops (like
-                // scf.if) that we don't analyze properly here. We could
-                // restrict this a bit by only discarding on use of the
-                // command buffer.
-                stateMap.clear();
-              });
-        }
-      }
+              }
+            });
+            // Any pending barrier may be ordering the commands it records.
+            for (auto commandBuffer : commandBuffers) {
+              segmentMap.erase(commandBuffer);
+              invalidateState(commandBuffer);
+            }
+            if (applyChanges) {
+              for (auto &region : op->getRegions()) processRegion(region);
+            }
+          });
+      if (hasResults) forgetValues(op.getResults());
     }
   }
 };
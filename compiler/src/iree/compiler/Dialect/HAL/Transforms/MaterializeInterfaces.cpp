@@ -60,6 +60,14 @@ static LogicalResult materializeExecutableFromSourceOp(
     auto targetVariantOp = targetBuilder.create<IREE::HAL::ExecutableVariantOp>(
         sourceOp->getLoc(), targetAttr.getSymbolNameFragment(), targetAttr);
     targetSymbolTable.insert(targetVariantOp);
+
+    // Hand-written objects are only linked into the variants they target.
+    if (auto objectsAttr = sourceOp.objectsAttr()) {
+      if (auto targetObjectsAttr =
+              objectsAttr.getApplicableObjects(targetAttr)) {
+        targetVariantOp.objectsAttr(targetObjectsAttr);
+      }
+    }
     OpBuilder variantBuilder(&targetVariantOp.getBlock().back());
     for (auto sourceEntryPointOp : sourceEntryPointOps) {
       variantBuilder.clone(*sourceEntryPointOp);
@@ -417,12 +425,21 @@ class MaterializeInterfacesPass
       // are targeting.
       SymbolTable targetSymbolTable(executableOp);
       OpBuilder targetBuilder(&executableOp.getBlock().back());
+      auto objectsAttr =
+          sourceOp->getAttrOfType<IREE::HAL::ExecutableObjectsAttr>(
+              "hal.executable.objects");
       for (auto targetAttr : targetAttrs) {
         auto targetContainerOp =
             targetBuilder.create<IREE::HAL::ExecutableVariantOp>(
                 sourceOp->getLoc(), targetAttr.getSymbolNameFragment(),
                 targetAttr);
         targetSymbolTable.insert(targetContainerOp);
+        if (objectsAttr) {
+          if (auto targetObjectsAttr =
+                  objectsAttr.getApplicableObjects(targetAttr)) {
+            targetContainerOp.objectsAttr(targetObjectsAttr);
+          }
+        }
         OpBuilder containerBuilder(&targetContainerOp.getBlock().back());
         containerBuilder.create<mlir::ModuleOp>(sourceOp->getLoc());
       }
@@ -0,0 +1,336 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <utility>
+
+#include "iree/compiler/Dialect/HAL/IR/HALOps.h"
+#include "iree/compiler/Dialect/HAL/Transforms/Passes.h"
+#include "iree/compiler/Dialect/Util/IR/UtilDialect.h"
+#include "iree/compiler/Dialect/Util/IR/UtilOps.h"
+#include "llvm/ADT/MapVector.h"
+#include "llvm/ADT/SetVector.h"
+#include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
+#include "mlir/Dialect/Func/IR/FuncOps.h"
+#include "mlir/IR/BlockAndValueMapping.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/SymbolTable.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
+#include "mlir/Pass/Pass.h"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace HAL {
+namespace {
+
+// A command buffer recorded and submitted once within a block:
+//   %cmd = hal.command_buffer.create ...
+//   <recording>
+//   hal.command_buffer.finalize<%cmd>
+//   ...
+//   hal.device.queue.execute ... commands([%cmd])
+struct CommandBufferRecording {
+  IREE::HAL::CommandBufferCreateOp createOp;
+  IREE::HAL::CommandBufferFinalizeOp finalizeOp;
+  IREE::HAL::DeviceQueueExecuteOp executeOp;
+  // Ops between the create and the finalize (inclusive).
+  SmallVector<Operation *> recordingOps;
+  // Values from outside of the recording that can be recomputed in an
+  // initializer, in def-before-use order.
+  SetVector<Value> hoistedValues;
+  // Buffers bound in the recording that are provided per submission, mapped
+  // to their binding table slot.
+  llvm::MapVector<Value, int64_t> slotBuffers;
+};
+
+// Returns true if all uses of |buffer| within |recordingOps| bind it in
+// hal.command_buffer.push_descriptor_set ops.
+static bool isOnlyBoundInRecording(Value buffer,
+                                   const DenseSet<Operation *> &recordingOps) {
+  Block *block = (*recordingOps.begin())->getBlock();
+  for (auto &use : buffer.getUses()) {
+    auto *ancestorOp = block->findAncestorOpInBlock(*use.getOwner());
+    if (!ancestorOp || !recordingOps.contains(ancestorOp)) continue;
+    auto pushOp =
+        dyn_cast<IREE::HAL::CommandBufferPushDescriptorSetOp>(use.getOwner());
+    if (!pushOp) return false;
+    if (!llvm::is_contained(pushOp.binding_buffers(), buffer)) return false;
+  }
+  return true;
+}
+
+// Adds |value| and the values it depends on to |hoistedValues| if they are
+// side-effect free and can be recomputed at initialization time.
+static bool tryHoistValue(Value value, SetVector<Value> &hoistedValues) {
+  if (hoistedValues.contains(value)) return true;
+  auto *definingOp = value.getDefiningOp();
+  if (!definingOp || definingOp->getNumRegions() != 0) return false;
+  if (!MemoryEffectOpInterface::hasNoEffect(definingOp)) return false;
+  for (auto operand : definingOp->getOperands()) {
+    if (!tryHoistValue(operand, hoistedValues)) return false;
+  }
+  for (auto result : definingOp->getResults()) hoistedValues.insert(result);
+  return true;
+}
+
+// Returns the recording of |createOp| if it can be memoized: the command
+// buffer must be recorded and submitted once in the same block and only
+// depend on values that are either invariant or bound as buffers.
+static Optional<CommandBufferRecording> analyzeRecording(
+    IREE::HAL::CommandBufferCreateOp createOp) {
+  CommandBufferRecording recording;
+  recording.createOp = createOp;
+  Value commandBuffer = createOp.result();
+  Block *block = createOp->getBlock();
+
+  // Find the finalize and the submission; there must be exactly one of each
+  // in the same block as the creation.
+  for (auto *userOp : commandBuffer.getUsers()) {
+    if (auto finalizeOp =
+            dyn_cast<IREE::HAL::CommandBufferFinalizeOp>(userOp)) {
+      if (recording.finalizeOp || finalizeOp->getBlock() != block) {
+        return llvm::None;
+      }
+      recording.finalizeOp = finalizeOp;
+    } else if (auto executeOp =
+                   dyn_cast<IREE::HAL::DeviceQueueExecuteOp>(userOp)) {
+      if (recording.executeOp || executeOp->getBlock() != block ||
+          executeOp.command_buffers().size() != 1) {
+        return llvm::None;
+      }
+      recording.executeOp = executeOp;
+    }
+  }
+  if (!recording.finalizeOp || !recording.executeOp ||
+      !recording.finalizeOp->isBeforeInBlock(recording.executeOp)) {
+    return llvm::None;
+  }
+
+  DenseSet<Operation *> recordingOpSet;
+  for (Operation *op = createOp->getNextNode(); op != recording.finalizeOp;
+       op = op->getNextNode()) {
+    recording.recordingOps.push_back(op);
+    recordingOpSet.insert(op);
+  }
+  recording.recordingOps.push_back(recording.finalizeOp);
+  recordingOpSet.insert(recording.finalizeOp);
+
+  // All other uses of the command buffer must be within the recording.
+  for (auto *userOp : commandBuffer.getUsers()) {
+    if (userOp == recording.executeOp) continue;
+    auto *ancestorOp = block->findAncestorOpInBlock(*userOp);
+    if (!ancestorOp || !recordingOpSet.contains(ancestorOp)) return llvm::None;
+  }
+
+  auto isDefinedInRecording = [&](Value value) {
+    auto *ownerOp = value.getDefiningOp();
+    if (!ownerOp) ownerOp = value.getParentBlock()->getParentOp();
+    auto *ancestorOp = block->findAncestorOpInBlock(*ownerOp);
+    return ancestorOp && recordingOpSet.contains(ancestorOp);
+  };
+
+  // Each op with side effects must be recording into the command buffer;
+  // anything else (allocations, host calls, etc) has to happen per call.
+  bool isValid = true;
+  SetVector<Value> capturedValues;
+  for (auto *recordingOp : recording.recordingOps) {
+    recordingOp->walk([&](Operation *op) {
+      bool usesCommandBuffer =
+          llvm::is_contained(op->getOperands(), commandBuffer);
+      if (!usesCommandBuffer && !op->hasTrait<OpTrait::IsTerminator>() &&
+          !op->hasTrait<OpTrait::HasRecursiveSideEffects>() &&
+          !MemoryEffectOpInterface::hasNoEffect(op)) {
+        isValid = false;
+      }
+      for (auto operand : op->getOperands()) {
+        if (operand != commandBuffer && !isDefinedInRecording(operand)) {
+          capturedValues.insert(operand);
+        }
+      }
+      // Values produced by the recording can't escape it as it is moved to
+      // an initializer.
+      for (auto result : op->getResults()) {
+        for (auto *userOp : result.getUsers()) {
+          auto *ancestorOp = block->findAncestorOpInBlock(*userOp);
+          if (!ancestorOp || !recordingOpSet.contains(ancestorOp)) {
+            isValid = false;
+          }
+        }
+      }
+    });
+  }
+  if (!isValid) return llvm::None;
+
+  // Buffers are provided from the binding table of each submission and
+  // everything else must be invariant; dynamically shaped dispatches are
+  // rejected here as their workgroup counts and ranges change per call.
+  if (!tryHoistValue(createOp.device(), recording.hoistedValues)) {
+    return llvm::None;
+  }
+  for (auto value : capturedValues) {
+    if (value.getType().isa<IREE::HAL::BufferType>() &&
+        isOnlyBoundInRecording(value, recordingOpSet)) {
+      recording.slotBuffers.insert(
+          std::make_pair(value, recording.slotBuffers.size()));
+    } else if (!tryHoistValue(value, recording.hoistedValues)) {
+      return llvm::None;
+    }
+  }
+  for (auto *recordingOp : recording.recordingOps) {
+    auto result = recordingOp->walk(
+        [&](IREE::HAL::CommandBufferPushDescriptorSetOp pushOp) {
+          for (auto buffer : pushOp.binding_buffers()) {
+            if (!recording.slotBuffers.count(buffer)) {
+              return WalkResult::interrupt();
+            }
+          }
+          return WalkResult::advance();
+        });
+    if (result.wasInterrupted()) return llvm::None;
+  }
+  return recording;
+}
+
+// Moves |recording| into an initializer storing the command buffer in a new
+// global and replaces the submission with one of the global.
+static void memoizeRecording(CommandBufferRecording &recording,
+                             StringRef globalName, SymbolTable &symbolTable) {
+  auto createOp = recording.createOp;
+  auto loc = createOp.getLoc();
+  auto parentOp = createOp->getParentOfType<FunctionOpInterface>();
+  OpBuilder moduleBuilder(parentOp);
+
+  auto globalOp = moduleBuilder.create<IREE::Util::GlobalOp>(
+      loc, globalName, /*isMutable=*/false, createOp.getType());
+  globalOp.setPrivate();
+  symbolTable.insert(globalOp);
+
+  // Record the command buffer once at startup. Bindings referencing the
+  // per-call buffers are recorded against binding table slots.
+  auto initializerOp = moduleBuilder.create<IREE::Util::InitializerOp>(loc);
+  auto initializerBuilder =
+      OpBuilder::atBlockBegin(initializerOp.addEntryBlock());
+  BlockAndValueMapping mapping;
+  for (auto value : recording.hoistedValues) {
+    if (mapping.contains(value)) continue;
+    initializerBuilder.clone(*value.getDefiningOp(), mapping);
+  }
+  Value bindingCapacity;
+  if (!recording.slotBuffers.empty()) {
+    bindingCapacity = initializerBuilder.create<arith::ConstantIndexOp>(
+        loc, recording.slotBuffers.size());
+  }
+  auto newCreateOp =
+      initializerBuilder.create<IREE::HAL::CommandBufferCreateOp>(
+          loc, createOp.getType(), mapping.lookup(createOp.device()),
+          IREE::HAL::CommandBufferModeBitfield::None,
+          createOp.command_categories(), bindingCapacity);
+  mapping.map(createOp.result(), newCreateOp.result());
+  for (auto *op : recording.recordingOps) {
+    initializerBuilder.clone(*op, mapping);
+  }
+  initializerOp.walk([&](IREE::HAL::CommandBufferPushDescriptorSetOp pushOp) {
+    OpBuilder builder(pushOp);
+    SmallVector<Value> bindingSlots;
+    for (auto buffer : pushOp.binding_buffers()) {
+      bindingSlots.push_back(builder.create<arith::ConstantIndexOp>(
+          pushOp.getLoc(), recording.slotBuffers.lookup(buffer)));
+    }
+    builder.create<IREE::HAL::CommandBufferPushDescriptorSetIndirectOp>(
+        pushOp.getLoc(), pushOp.command_buffer(), pushOp.executable_layout(),
+        pushOp.set(), pushOp.binding_ordinals(), bindingSlots,
+        pushOp.binding_offsets(), pushOp.binding_lengths());
+    pushOp.erase();
+  });
+  initializerBuilder.create<IREE::Util::GlobalStoreOp>(
+      loc, newCreateOp.result(), globalOp.getName());
+  initializerBuilder.create<IREE::Util::InitializerReturnOp>(loc);
+
+  // Submit the memoized command buffer with the buffers of this call.
+  auto executeOp = recording.executeOp;
+  OpBuilder builder(executeOp);
+  auto commandBuffer =
+      builder.create<IREE::Util::GlobalLoadOp>(loc, globalOp).result();
+  if (recording.slotBuffers.empty()) {
+    builder.create<IREE::HAL::DeviceQueueExecuteOp>(
+        executeOp.getLoc(), executeOp.device(), executeOp.queue_affinity(),
+        executeOp.wait_fence(), executeOp.signal_fence(),
+        ValueRange{commandBuffer});
+  } else {
+    SmallVector<Value> bindingBuffers;
+    SmallVector<Value> bindingOffsets;
+    SmallVector<Value> bindingLengths;
+    auto zero = builder.create<arith::ConstantIndexOp>(loc, 0);
+    for (auto it : recording.slotBuffers) {
+      bindingBuffers.push_back(it.first);
+      bindingOffsets.push_back(zero);
+      bindingLengths.push_back(builder.createOrFold<IREE::HAL::BufferLengthOp>(
+          loc, builder.getIndexType(), it.first));
+    }
+    builder.create<IREE::HAL::DeviceQueueExecuteIndirectOp>(
+        executeOp.getLoc(), executeOp.device(), executeOp.queue_affinity(),
+        executeOp.wait_fence(), executeOp.signal_fence(), commandBuffer,
+        bindingBuffers, bindingOffsets, bindingLengths);
+  }
+  executeOp.erase();
+  for (auto *op : llvm::reverse(recording.recordingOps)) op->erase();
+  createOp.erase();
+}
+
+// NOTE: this implementation is just for a single active device like the rest
+// of the resource caching in the HAL.
+class MemoizeCommandBuffersPass
+    : public PassWrapper<MemoizeCommandBuffersPass, OperationPass<ModuleOp>> {
+ public:
+  StringRef getArgument() const override {
+    return "iree-hal-memoize-command-buffers";
+  }
+
+  StringRef getDescription() const override {
+    return "Records invariant command buffers once at initialization time and "
+           "reuses them with per-call binding tables";
+  }
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<arith::ArithmeticDialect>();
+    registry.insert<IREE::Util::UtilDialect>();
+  }
+
+  void runOnOperation() override {
+    auto moduleOp = getOperation();
+    SymbolTable symbolTable(moduleOp);
+
+    // Initializers already run once; only command buffers recorded on each
+    // call of a function are worth memoizing.
+    SmallVector<IREE::HAL::CommandBufferCreateOp> createOps;
+    for (auto funcOp : moduleOp.getOps<func::FuncOp>()) {
+      funcOp.walk([&](IREE::HAL::CommandBufferCreateOp createOp) {
+        createOps.push_back(createOp);
+      });
+    }
+    unsigned memoizedCount = 0;
+    for (auto createOp : createOps) {
+      auto recording = analyzeRecording(createOp);
+      if (!recording) continue;
+      std::string globalName =
+          "_command_buffer_" + std::to_string(memoizedCount++);
+      memoizeRecording(*recording, globalName, symbolTable);
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<OperationPass<ModuleOp>> createMemoizeCommandBuffersPass() {
+  return std::make_unique<MemoizeCommandBuffersPass>();
+}
+
+static PassRegistration<MemoizeCommandBuffersPass> pass;
+
+}  // namespace HAL
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -47,6 +47,15 @@ static llvm::cl::opt<unsigned> benchmarkDispatchRepeatCount{
         "meant for command buffers having linear dispatch structures."),
     llvm::cl::init(1)};
 
+static llvm::cl::opt<bool> memoizeCommandBuffers{
+    "iree-hal-memoize-command-buffers",
+    llvm::cl::desc(
+        "Records command buffers that only depend on invariant values once at "
+        "initialization time and reuses them on each call with a binding "
+        "table of the buffers. Requires a HAL driver supporting reusable "
+        "command buffers with binding tables."),
+    llvm::cl::init(false)};
+
 }  // namespace
 
 using FunctionLikeNest = MultiOpNest<func::FuncOp, IREE::Util::InitializerOp>;
@@ -98,6 +107,13 @@ void buildHALTransformPassPipeline(OpPassManager &passManager,
   // device communicate across the ABI boundary.
   passManager.addPass(createMaterializeInterfacesPass());
 
+  // Attach measured dispatch times from a runtime profile so that executable
+  // translation can prioritize the dispatches that dominate execution.
+  if (!targetOptions.dispatchProfilePath.empty()) {
+    passManager.addPass(
+        createApplyDispatchProfilePass(targetOptions.dispatchProfilePath));
+  }
+
   // Dump a source listing of each hal.executable and update the source
   // locations in the IR. This will allow us to easily inspect each executable
   // and give downstream tools that can display source information something
@@ -126,7 +142,7 @@ void buildHALTransformPassPipeline(OpPassManager &passManager,
   // After this point the executables are opaque blobs and we cannot change
   // their interfaces.
   passManager.addNestedPass<IREE::HAL::ExecutableOp>(
-      createTranslateExecutablesPass());
+      createTranslateExecutablesPass(targetOptions.translationCache.get()));
 
   //----------------------------------------------------------------------------
   // Host program conversion
@@ -159,6 +175,13 @@ void buildHALTransformPassPipeline(OpPassManager &passManager,
   // cache them at initialization-time.
   passManager.addPass(createMaterializeResourceCachesPass(targetOptions));
 
+  // Record command buffers that don't change across calls once at startup.
+  // This runs prior to inlining device switches so that each recording is
+  // still contained within a single block.
+  if (memoizeCommandBuffers) {
+    passManager.addPass(createMemoizeCommandBuffersPass());
+  }
+
   //----------------------------------------------------------------------------
   // Device management and specialization
   //----------------------------------------------------------------------------
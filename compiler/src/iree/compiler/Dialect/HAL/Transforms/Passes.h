@@ -67,6 +67,11 @@ std::unique_ptr<OperationPass<void>> createInlineDeviceSwitchesPass();
 // Finds hal.device.query ops and creates variables initialized on startup.
 std::unique_ptr<OperationPass<mlir::ModuleOp>> createMemoizeDeviceQueriesPass();
 
+// Records command buffers that only depend on invariant values once on startup
+// and submits them with per-call binding tables.
+std::unique_ptr<OperationPass<mlir::ModuleOp>>
+createMemoizeCommandBuffersPass();
+
 //===----------------------------------------------------------------------===//
 // Executable translation
 //===----------------------------------------------------------------------===//
@@ -77,6 +82,10 @@ std::unique_ptr<OperationPass<mlir::ModuleOp>> createMemoizeDeviceQueriesPass();
 std::unique_ptr<OperationPass<mlir::ModuleOp>>
 createMaterializeInterfacesPass();
 
+// Attaches the runtime dispatch profile at |path| to hal.executable.export ops.
+std::unique_ptr<OperationPass<mlir::ModuleOp>> createApplyDispatchProfilePass(
+    StringRef path);
+
 // Dumps individual hal.executable source listings to |path|.
 std::unique_ptr<OperationPass<mlir::ModuleOp>> createDumpExecutableSourcesPass(
     StringRef path);
@@ -86,12 +95,15 @@ std::unique_ptr<OperationPass<mlir::ModuleOp>>
 createDumpExecutableBenchmarksPass(StringRef path);
 
 // Translates hal.executable.variant ops via a nested translation pipeline.
+// Translated variants are reused from and added to |translationCache|, if any.
 std::unique_ptr<OperationPass<IREE::HAL::ExecutableOp>>
-createTranslateExecutablesPass();
+createTranslateExecutablesPass(
+    ExecutableTranslationCache *translationCache = nullptr);
 
 // Translates hal.executable.variant ops for the specified |target| backend.
 std::unique_ptr<OperationPass<IREE::HAL::ExecutableVariantOp>>
-createTranslateTargetExecutableVariantsPass(StringRef target);
+createTranslateTargetExecutableVariantsPass(
+    StringRef target, ExecutableTranslationCache *translationCache = nullptr);
 
 // Calls into each target backend to have it link multiple hal.executables
 // together (if that makes sense). For example, the LLVM AOT backend may combine
@@ -150,6 +162,7 @@ std::unique_ptr<OperationPass<func::FuncOp>> createBenchmarkBatchDispatchesPass(
 inline void registerHALPasses() {
   registerHALTransformPassPipeline();
   auto targetOptions = TargetOptions::FromFlags::get();
+  createApplyDispatchProfilePass("");
   createAssignTargetDevicesPass({});
   createBenchmarkBatchDispatchesPass(/*repeatCount=*/1);
   createConvertToHALPass();
@@ -160,6 +173,7 @@ inline void registerHALPasses() {
   createLinkTargetExecutablesPass("");
   createMaterializeInterfacesPass();
   createMaterializeResourceCachesPass(targetOptions);
+  createMemoizeCommandBuffersPass();
   createMemoizeDeviceQueriesPass();
   createResolveExportOrdinalsPass();
   createSerializeExecutablesPass();
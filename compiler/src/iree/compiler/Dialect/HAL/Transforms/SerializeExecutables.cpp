@@ -85,6 +85,12 @@ class SerializeTargetExecutablesPass
         executableOp.getBlock().getOps<IREE::HAL::ExecutableVariantOp>());
     for (auto variantOp : variantOps) {
       if (variantOp.target().getBackend().getValue() != target) continue;
+      if (variantOp.objectsAttr() &&
+          !targetBackend->supportsExecutableObjects()) {
+        variantOp.emitError() << "target backend " << target
+                              << " does not support linking executable objects";
+        return signalPassFailure();
+      }
       OpBuilder executableBuilder(variantOp);
       // Ask the target backend to serialize the executable. Note that it
       // may create one or more hal.executable.binary ops in the case of
@@ -9,6 +9,7 @@
 
 #include "iree/compiler/Dialect/HAL/IR/HALDialect.h"
 #include "iree/compiler/Dialect/HAL/IR/HALOps.h"
+#include "iree/compiler/Dialect/HAL/Target/ExecutableTranslationCache.h"
 #include "iree/compiler/Dialect/HAL/Target/TargetBackend.h"
 #include "iree/compiler/Dialect/HAL/Target/TargetRegistry.h"
 #include "llvm/ADT/StringSet.h"
@@ -30,8 +31,11 @@ class TranslateTargetExecutableVariantsPass
  public:
   TranslateTargetExecutableVariantsPass() = default;
   TranslateTargetExecutableVariantsPass(
-      const TranslateTargetExecutableVariantsPass &pass) {}
-  TranslateTargetExecutableVariantsPass(StringRef target) {
+      const TranslateTargetExecutableVariantsPass &pass)
+      : translationCache(pass.translationCache) {}
+  TranslateTargetExecutableVariantsPass(
+      StringRef target, ExecutableTranslationCache *translationCache)
+      : translationCache(translationCache) {
     this->target = target.str();
   }
 
@@ -62,6 +66,13 @@ class TranslateTargetExecutableVariantsPass
       return signalPassFailure();
     }
 
+    // Identical variants translated earlier in the same context are reused.
+    std::string cacheKey;
+    if (translationCache) {
+      cacheKey = ExecutableTranslationCache::getKey(variantOp);
+      if (translationCache->lookup(cacheKey, variantOp)) return;
+    }
+
     OpPassManager passManager(variantOp.getOperationName());
     targetBackend->buildTranslationPassPipeline(passManager);
     if (failed(runPipeline(passManager, variantOp))) {
@@ -70,9 +81,13 @@ class TranslateTargetExecutableVariantsPass
                             << variantOp.target();
       return signalPassFailure();
     }
+
+    if (translationCache) translationCache->insert(cacheKey, variantOp);
   }
 
  private:
+  ExecutableTranslationCache *translationCache = nullptr;
+
   Option<std::string> target{
       *this, "target",
       llvm::cl::desc(
@@ -81,8 +96,10 @@ class TranslateTargetExecutableVariantsPass
 };
 
 std::unique_ptr<OperationPass<IREE::HAL::ExecutableVariantOp>>
-createTranslateTargetExecutableVariantsPass(StringRef target) {
-  return std::make_unique<TranslateTargetExecutableVariantsPass>(target);
+createTranslateTargetExecutableVariantsPass(
+    StringRef target, ExecutableTranslationCache *translationCache) {
+  return std::make_unique<TranslateTargetExecutableVariantsPass>(
+      target, translationCache);
 }
 
 static PassRegistration<TranslateTargetExecutableVariantsPass> linkTargetPass(
@@ -93,6 +110,11 @@ class TranslateExecutablesPass
                          OperationPass<IREE::HAL::ExecutableOp>> {
  public:
   TranslateExecutablesPass() = default;
+  TranslateExecutablesPass(const TranslateExecutablesPass &pass)
+      : translationCache(pass.translationCache) {}
+  explicit TranslateExecutablesPass(
+      ExecutableTranslationCache *translationCache)
+      : translationCache(translationCache) {}
 
   StringRef getArgument() const override {
     return "iree-hal-translate-executables";
@@ -116,18 +138,22 @@ class TranslateExecutablesPass
     OpPassManager passManager(executableOp.getOperationName());
     for (const auto &targetName : gatherExecutableTargetNames(executableOp)) {
       passManager.addNestedPass<IREE::HAL::ExecutableVariantOp>(
-          createTranslateTargetExecutableVariantsPass(targetName));
+          createTranslateTargetExecutableVariantsPass(targetName,
+                                                      translationCache));
     }
     if (failed(runPipeline(passManager, executableOp))) {
       executableOp.emitError() << "failed to serialize executables";
       return signalPassFailure();
     }
   }
+
+ private:
+  ExecutableTranslationCache *translationCache = nullptr;
 };
 
 std::unique_ptr<OperationPass<IREE::HAL::ExecutableOp>>
-createTranslateExecutablesPass() {
-  return std::make_unique<TranslateExecutablesPass>();
+createTranslateExecutablesPass(ExecutableTranslationCache *translationCache) {
+  return std::make_unique<TranslateExecutablesPass>(translationCache);
 }
 
 static PassRegistration<TranslateExecutablesPass> translatePass([] {
@@ -0,0 +1,24 @@
+// RUN: echo '{"duration_ns": 1000, "dispatches": [{"name": "matmul", "workgroup_count": [8, 8, 1], "count": 2, "total_ns": 600, "fraction": 0.5}, {"name": "matmul", "workgroup_count": [4, 4, 1], "count": 1, "total_ns": 200, "fraction": 0.25}, {"name": "fill", "workgroup_count": [4, 1, 1], "count": 4, "total_ns": 200, "fraction": 0.25}]}' > %t.json
+// RUN: iree-opt --iree-hal-apply-dispatch-profile="path=%t.json" %s | FileCheck %s
+
+#executable_layout = #hal.executable.layout<push_constants = 0, sets = [
+  #hal.descriptor_set.layout<0, bindings = [
+    #hal.descriptor_set.binding<0, storage_buffer>
+  ]>
+]>
+
+hal.executable @exe {
+  hal.executable.variant @target, target = <"vmvx", "vmvx-bytecode-fb"> {
+    // Workgroup counts are aggregated.
+    //      CHECK: hal.executable.export public @matmul
+    // CHECK-SAME:   hal.dispatch_profile = {count = 3 : i64, fraction = 7.500000e-01 : f64, total_ns = 800 : i64}
+    hal.executable.export @matmul ordinal(0) layout(#executable_layout)
+    //      CHECK: hal.executable.export public @fill
+    // CHECK-SAME:   hal.dispatch_profile = {count = 4 : i64, fraction = 2.500000e-01 : f64, total_ns = 200 : i64}
+    hal.executable.export @fill ordinal(1) layout(#executable_layout)
+    // Exports that were not profiled are left unchanged.
+    //      CHECK: hal.executable.export public @unused
+    //  CHECK-NOT:   hal.dispatch_profile
+    hal.executable.export @unused ordinal(2) layout(#executable_layout)
+  }
+}
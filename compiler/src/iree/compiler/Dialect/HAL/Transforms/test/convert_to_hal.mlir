@@ -115,7 +115,12 @@ module attributes {hal.device.targets = [#device_target_cpu]}  {
     // CHECK: hal.command_buffer.finalize<%[[CMD]] : !hal.command_buffer>
     } => !stream.timepoint
 
-    // CHECK: hal.ex.submit_and_wait %[[DEVICE]], %[[CMD]]
+    // CHECK: %[[SIGNAL_FENCE:.+]] = hal.fence.create
+    // CHECK: hal.device.queue.execute<%[[DEVICE]] : !hal.device>
+    // CHECK-SAME: signal(%[[SIGNAL_FENCE]])
+    // CHECK-SAME: commands([%[[CMD]]])
+    // CHECK: %[[WAIT_OK:.+]] = hal.fence.await until([%[[SIGNAL_FENCE]]])
+    // CHECK: util.status.check_ok %[[WAIT_OK]]
     %result_ready = stream.timepoint.await %timepoint => %result_resource : !stream.resource<external>{%c16}
 
     // CHECK: %[[RESULT_VIEW:.+]] = hal.buffer_view.create
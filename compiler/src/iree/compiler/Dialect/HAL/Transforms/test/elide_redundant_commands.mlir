@@ -127,3 +127,135 @@ func.func @elidePushDescriptorSet(%cmd: !hal.command_buffer, %executable_layout:
   // CHECK: return
   return
 }
+
+// -----
+
+// Tests that state is propagated to blocks when all predecessors agree.
+
+// CHECK-LABEL: @elideAcrossBlocks
+func.func @elideAcrossBlocks(%cmd: !hal.command_buffer, %executable_layout: !hal.executable_layout, %cond: i1) {
+  %c0 = arith.constant 0 : i32
+  %c1 = arith.constant 1 : i32
+  // CHECK: hal.command_buffer.push_constants
+  hal.command_buffer.push_constants<%cmd : !hal.command_buffer>
+      layout(%executable_layout : !hal.executable_layout)
+      offset(0)
+      values([%c0]) : i32
+  cf.cond_br %cond, ^bb1, ^bb2
+^bb1:
+  // CHECK: hal.command_buffer.push_constants{{.+}} offset(1) values
+  hal.command_buffer.push_constants<%cmd : !hal.command_buffer>
+      layout(%executable_layout : !hal.executable_layout)
+      offset(1)
+      values([%c1]) : i32
+  cf.br ^bb3
+^bb2:
+  // CHECK: hal.command_buffer.push_constants{{.+}} offset(1) values
+  hal.command_buffer.push_constants<%cmd : !hal.command_buffer>
+      layout(%executable_layout : !hal.executable_layout)
+      offset(1)
+      values([%c0]) : i32
+  cf.br ^bb3
+// CHECK: ^bb3:
+^bb3:
+  // The first constant matches in both predecessors but the second doesn't.
+  // CHECK: hal.command_buffer.push_constants{{.+}} offset(1) values([%{{.+}}])
+  hal.command_buffer.push_constants<%cmd : !hal.command_buffer>
+      layout(%executable_layout : !hal.executable_layout)
+      offset(0)
+      values([%c0, %c1]) : i32, i32
+  // CHECK: return
+  return
+}
+
+// -----
+
+// Tests that values redefined in a loop are not treated as redundant.
+
+// CHECK-LABEL: @loopRedefinedValue
+func.func @loopRedefinedValue(%cmd: !hal.command_buffer, %executable_layout: !hal.executable_layout, %init: i32, %cond: i1) {
+  %c0 = arith.constant 0 : i32
+  // CHECK: hal.command_buffer.push_constants{{.+}} values([%{{.+}}, %{{.+}}])
+  hal.command_buffer.push_constants<%cmd : !hal.command_buffer>
+      layout(%executable_layout : !hal.executable_layout)
+      offset(0)
+      values([%c0, %init]) : i32, i32
+  cf.br ^bb1(%init : i32)
+// CHECK: ^bb1(%[[VALUE:.+]]: i32):
+^bb1(%value: i32):
+  // The constant at offset 0 is invariant across iterations.
+  // CHECK: hal.command_buffer.push_constants{{.+}} offset(1) values([%[[VALUE]]])
+  hal.command_buffer.push_constants<%cmd : !hal.command_buffer>
+      layout(%executable_layout : !hal.executable_layout)
+      offset(0)
+      values([%c0, %value]) : i32, i32
+  %next = arith.addi %value, %value : i32
+  cf.cond_br %cond, ^bb1(%next : i32), ^bb2
+^bb2:
+  // CHECK: return
+  return
+}
+
+// -----
+
+// Tests that barriers between commands on disjoint ranges are elided.
+
+// CHECK-LABEL: @elideDisjointBarriers
+func.func @elideDisjointBarriers(%device: !hal.device, %allocator: !hal.allocator, %pattern: i32) {
+  %c0 = arith.constant 0 : index
+  %c64 = arith.constant 64 : index
+  %c128 = arith.constant 128 : index
+  %c256 = arith.constant 256 : index
+  %buffer = hal.allocator.allocate<%allocator : !hal.allocator>
+      type(DeviceLocal) usage(Transfer) : !hal.buffer{%c256}
+  %subspan = hal.buffer.subspan<%buffer : !hal.buffer>[%c128, %c128] : !hal.buffer
+  %cmd = hal.command_buffer.create device(%device : !hal.device) mode(OneShot) categories("Transfer|Dispatch") : !hal.command_buffer
+  // CHECK: hal.command_buffer.fill_buffer
+  hal.command_buffer.fill_buffer<%cmd : !hal.command_buffer>
+      target(%buffer : !hal.buffer)[%c0, %c128]
+      pattern(%pattern : i32)
+  // CHECK-NOT: hal.command_buffer.execution_barrier
+  hal.command_buffer.execution_barrier<%cmd : !hal.command_buffer> source("Dispatch|Transfer|CommandRetire") target("CommandIssue|Dispatch|Transfer") flags("None")
+  // CHECK: hal.command_buffer.fill_buffer
+  hal.command_buffer.fill_buffer<%cmd : !hal.command_buffer>
+      target(%subspan : !hal.buffer)[%c0, %c64]
+      pattern(%pattern : i32)
+  // The last command overlaps the first and must wait on it.
+  // CHECK: hal.command_buffer.execution_barrier
+  hal.command_buffer.execution_barrier<%cmd : !hal.command_buffer> source("Dispatch|Transfer|CommandRetire") target("CommandIssue|Dispatch|Transfer") flags("None")
+  // CHECK: hal.command_buffer.fill_buffer
+  hal.command_buffer.fill_buffer<%cmd : !hal.command_buffer>
+      target(%buffer : !hal.buffer)[%c64, %c128]
+      pattern(%pattern : i32)
+  // CHECK: hal.command_buffer.finalize
+  hal.command_buffer.finalize<%cmd : !hal.command_buffer>
+  return
+}
+
+// -----
+
+// Tests that barriers between dispatches on overlapping ranges are kept.
+
+// CHECK-LABEL: @keepOverlappingDispatchBarriers
+func.func @keepOverlappingDispatchBarriers(%device: !hal.device, %allocator: !hal.allocator, %executable_layout: !hal.executable_layout, %executable: !hal.executable) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c64 = arith.constant 64 : index
+  %c128 = arith.constant 128 : index
+  %c256 = arith.constant 256 : index
+  %buffer = hal.allocator.allocate<%allocator : !hal.allocator>
+      type(DeviceLocal) usage(Dispatch) : !hal.buffer{%c256}
+  %cmd = hal.command_buffer.create device(%device : !hal.device) mode(OneShot) categories(Dispatch) : !hal.command_buffer
+  hal.command_buffer.push_descriptor_set<%cmd : !hal.command_buffer> layout(%executable_layout : !hal.executable_layout)[%c0] bindings([
+    %c0 = (%buffer : !hal.buffer)[%c0, %c128]
+  ])
+  hal.command_buffer.dispatch<%cmd : !hal.command_buffer> target(%executable : !hal.executable)[0] workgroups([%c1, %c1, %c1])
+  // CHECK: hal.command_buffer.execution_barrier
+  hal.command_buffer.execution_barrier<%cmd : !hal.command_buffer> source("Dispatch|Transfer|CommandRetire") target("CommandIssue|Dispatch|Transfer") flags("None")
+  hal.command_buffer.push_descriptor_set<%cmd : !hal.command_buffer> layout(%executable_layout : !hal.executable_layout)[%c0] bindings([
+    %c0 = (%buffer : !hal.buffer)[%c64, %c128]
+  ])
+  hal.command_buffer.dispatch<%cmd : !hal.command_buffer> target(%executable : !hal.executable)[0] workgroups([%c1, %c1, %c1])
+  hal.command_buffer.finalize<%cmd : !hal.command_buffer>
+  return
+}
@@ -104,3 +104,45 @@ hal.executable.source public @ex {
 // layout bindings are implemented.
 
 }
+
+// -----
+
+// Tests that objects on executable sources are only attached to the variants
+// of the targets they were specified for.
+
+module attributes {hal.device.targets = [
+  #hal.device.target<"cpu", {
+    executable_targets = [
+      #hal.executable.target<"llvm", "embedded-elf-arm_64">,
+      #hal.executable.target<"llvm", "embedded-elf-x86_64">
+    ]
+  }>
+]} {
+
+hal.executable.source public @ex attributes {
+  objects = #hal.executable.objects<{
+    #hal.executable.target<"llvm", "embedded-elf-x86_64"> = [
+      #hal.executable.object<{path = "kernels_x86_64.o"}>
+    ]
+  }>
+} {
+  hal.executable.export public @entry layout(#hal.executable.layout<push_constants = 0, sets = [
+    #hal.descriptor_set.layout<0, bindings = [
+      #hal.descriptor_set.binding<0, storage_buffer>
+    ]>
+  ]>)
+  builtin.module {
+    func.func private @external_kernel()
+    func.func @entry() {
+      func.call @external_kernel() : () -> ()
+      return
+    }
+  }
+}
+
+// CHECK: hal.executable public @ex
+// CHECK:   hal.executable.variant public @embedded_elf_arm_64, target = #executable_target_embedded_elf_arm_64 {
+// CHECK:   hal.executable.variant public @embedded_elf_x86_64, target = #executable_target_embedded_elf_x86_64, objects = [#hal.executable.object<{path = "kernels_x86_64.o"}>] {
+// CHECK:     func.func private @external_kernel()
+
+}
@@ -0,0 +1,82 @@
+// RUN: iree-opt --split-input-file --iree-hal-memoize-command-buffers %s | FileCheck %s
+
+util.global private @_executable_layout_0 : !hal.executable_layout
+util.global private @_executable_0 : !hal.executable
+
+//      CHECK: util.global private @_command_buffer_0 : !hal.command_buffer
+// CHECK-NEXT: util.initializer {
+//  CHECK-DAG:   %[[DEVICE:.+]] = hal.ex.shared_device : !hal.device
+//  CHECK-DAG:   %[[C2:.+]] = arith.constant 2 : index
+//      CHECK:   %[[CMD:.+]] = hal.command_buffer.create device(%[[DEVICE]] : !hal.device) mode(None) categories("Transfer|Dispatch") bindings(%[[C2]]) : !hal.command_buffer
+//      CHECK:   %[[LAYOUT:.+]] = util.global.load @_executable_layout_0 : !hal.executable_layout
+//  CHECK-DAG:   %[[SLOT0:.+]] = arith.constant 0 : index
+//  CHECK-DAG:   %[[SLOT1:.+]] = arith.constant 1 : index
+//      CHECK:   hal.command_buffer.push_descriptor_set.indirect<%[[CMD]] : !hal.command_buffer> layout(%[[LAYOUT]] : !hal.executable_layout)[%{{.+}}] bindings([
+// CHECK-NEXT:     %{{.+}} = slot(%[[SLOT0]])[%{{.+}}, %{{.+}}],
+// CHECK-NEXT:     %{{.+}} = slot(%[[SLOT1]])[%{{.+}}, %{{.+}}]
+// CHECK-NEXT:   ])
+//      CHECK:   %[[EXECUTABLE:.+]] = util.global.load @_executable_0 : !hal.executable
+//      CHECK:   hal.command_buffer.dispatch<%[[CMD]] : !hal.command_buffer> target(%[[EXECUTABLE]] : !hal.executable)[0] workgroups([%{{.+}}, %{{.+}}, %{{.+}}])
+//      CHECK:   hal.command_buffer.execution_barrier<%[[CMD]] : !hal.command_buffer>
+//      CHECK:   hal.command_buffer.finalize<%[[CMD]] : !hal.command_buffer>
+//      CHECK:   util.global.store %[[CMD]], @_command_buffer_0 : !hal.command_buffer
+// CHECK-NEXT:   util.initializer.return
+// CHECK-NEXT: }
+
+// CHECK-LABEL: func.func @static_dispatch
+// CHECK-SAME: (%[[ARG0:.+]]: !hal.buffer, %[[ARG1:.+]]: !hal.buffer, %[[WAIT:.+]]: !hal.fence, %[[SIGNAL:.+]]: !hal.fence)
+func.func @static_dispatch(%arg0: !hal.buffer, %arg1: !hal.buffer, %wait: !hal.fence, %signal: !hal.fence) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c4 = arith.constant 4 : index
+  %c16 = arith.constant 16 : index
+  %affinity = arith.constant -1 : i64
+  // CHECK: %[[DEVICE:.+]] = hal.ex.shared_device
+  %device = hal.ex.shared_device : !hal.device
+  // CHECK-NOT: hal.command_buffer.create
+  %cmd = hal.command_buffer.create device(%device : !hal.device) mode("OneShot|AllowInlineExecution") categories("Transfer|Dispatch") : !hal.command_buffer
+  %layout = util.global.load @_executable_layout_0 : !hal.executable_layout
+  hal.command_buffer.push_descriptor_set<%cmd : !hal.command_buffer> layout(%layout : !hal.executable_layout)[%c0] bindings([
+    %c0 = (%arg0 : !hal.buffer)[%c0, %c16],
+    %c1 = (%arg1 : !hal.buffer)[%c0, %c16]
+  ])
+  %executable = util.global.load @_executable_0 : !hal.executable
+  hal.command_buffer.dispatch<%cmd : !hal.command_buffer> target(%executable : !hal.executable)[0] workgroups([%c4, %c1, %c1])
+  hal.command_buffer.execution_barrier<%cmd : !hal.command_buffer> source("Dispatch|Transfer|CommandRetire") target("CommandIssue|Dispatch|Transfer") flags("None")
+  hal.command_buffer.finalize<%cmd : !hal.command_buffer>
+  // CHECK: %[[MEMOIZED_CMD:.+]] = util.global.load @_command_buffer_0 : !hal.command_buffer
+  // CHECK-DAG: %[[ARG0_LENGTH:.+]] = hal.buffer.length<%[[ARG0]] : !hal.buffer> : index
+  // CHECK-DAG: %[[ARG1_LENGTH:.+]] = hal.buffer.length<%[[ARG1]] : !hal.buffer> : index
+  //      CHECK: hal.device.queue.execute.indirect<%[[DEVICE]] : !hal.device>
+  // CHECK-SAME:   wait(%[[WAIT]]) signal(%[[SIGNAL]])
+  // CHECK-SAME:   command(%[[MEMOIZED_CMD]])
+  // CHECK-SAME:   bindings([
+  // CHECK-NEXT:     (%[[ARG0]] : !hal.buffer)[%{{.+}}, %[[ARG0_LENGTH]]],
+  // CHECK-NEXT:     (%[[ARG1]] : !hal.buffer)[%{{.+}}, %[[ARG1_LENGTH]]]
+  // CHECK-NEXT:   ])
+  hal.device.queue.execute<%device : !hal.device> affinity(%affinity) wait(%wait) signal(%signal) commands([%cmd])
+  return
+}
+
+// -----
+
+util.global private @_executable_0 : !hal.executable
+
+// Workgroup counts that are only known per call require recording on each
+// call.
+
+// CHECK-NOT: util.initializer
+// CHECK-LABEL: func.func @dynamic_dispatch
+func.func @dynamic_dispatch(%workload: index, %wait: !hal.fence, %signal: !hal.fence) {
+  %c1 = arith.constant 1 : index
+  %affinity = arith.constant -1 : i64
+  %device = hal.ex.shared_device : !hal.device
+  // CHECK: %[[CMD:.+]] = hal.command_buffer.create
+  %cmd = hal.command_buffer.create device(%device : !hal.device) mode(OneShot) categories(Dispatch) : !hal.command_buffer
+  %executable = util.global.load @_executable_0 : !hal.executable
+  hal.command_buffer.dispatch<%cmd : !hal.command_buffer> target(%executable : !hal.executable)[0] workgroups([%workload, %c1, %c1])
+  hal.command_buffer.finalize<%cmd : !hal.command_buffer>
+  // CHECK: hal.device.queue.execute<%{{.+}} : !hal.device> affinity(%{{.+}}) wait(%{{.+}}) signal(%{{.+}}) commands([%[[CMD]]])
+  hal.device.queue.execute<%device : !hal.device> affinity(%affinity) wait(%wait) signal(%signal) commands([%cmd])
+  return
+}
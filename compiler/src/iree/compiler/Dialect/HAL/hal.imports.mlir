@@ -101,6 +101,24 @@ vm.import @buffer.store(
   %length : i32
 )
 
+// Loads a range of bytes from a buffer into a VM buffer.
+vm.import @buffer.load.range(
+  %source_buffer : !vm.ref<!hal.buffer>,
+  %source_offset : i64,
+  %target_buffer : !vm.buffer,
+  %target_offset : i64,
+  %length : i64
+)
+
+// Stores a range of bytes from a VM buffer into a buffer.
+vm.import @buffer.store.range(
+  %source_buffer : !vm.buffer,
+  %source_offset : i64,
+  %target_buffer : !vm.ref<!hal.buffer>,
+  %target_offset : i64,
+  %length : i64
+)
+
 //===----------------------------------------------------------------------===//
 // iree_hal_buffer_view_t
 //===----------------------------------------------------------------------===//
@@ -165,10 +183,13 @@ vm.import @buffer_view.trace(
 //===----------------------------------------------------------------------===//
 
 // Returns a command buffer from the device pool ready to begin recording.
+// |binding_capacity| is the number of binding table slots that indirect
+// descriptor set bindings recorded into the command buffer may reference.
 vm.import @command_buffer.create(
   %device : !vm.ref<!hal.device>,
   %modes : i32,
-  %command_categories : i32
+  %command_categories : i32,
+  %binding_capacity : i32
 ) -> !vm.ref<!hal.command_buffer>
 
 // Finalizes recording into the command buffer and prepares it for submission.
@@ -235,6 +256,17 @@ vm.import @command_buffer.push_descriptor_set(
   %bindings : tuple<i32, !vm.ref<!hal.buffer>, i64, i64>...
 )
 
+// Pushes a descriptor set to the given set number with its buffers provided
+// from the binding table at submission time. Offsets are relative to the
+// binding table slots.
+vm.import @command_buffer.push_descriptor_set.indirect(
+  %command_buffer : !vm.ref<!hal.command_buffer>,
+  %executable_layout : !vm.ref<!hal.executable_layout>,
+  %set : i32,
+  // <binding, slot, offset, length>
+  %bindings : tuple<i32, i32, i64, i64>...
+)
+
 // Binds a descriptor set to the given set number.
 vm.import @command_buffer.bind_descriptor_set(
   %command_buffer : !vm.ref<!hal.command_buffer>,
@@ -308,6 +340,30 @@ vm.import @device.query.i64(
 ) -> (i32, i64)
 attributes {nosideeffects}
 
+// Executes one or more command buffers on a device queue.
+// Execution begins once |wait_fence| is reached and |signal_fence| is signaled
+// when all command buffers have completed. A null |wait_fence| begins
+// execution immediately.
+vm.import @device.queue.execute(
+  %device : !vm.ref<!hal.device>,
+  %queue_affinity : i64,
+  %wait_fence : !vm.ref<!hal.fence>,
+  %signal_fence : !vm.ref<!hal.fence>,
+  %command_buffers : !vm.ref<!hal.command_buffer>...
+)
+
+// Executes a reusable command buffer on a device queue with the given binding
+// table providing the buffers for its indirect descriptor set bindings.
+vm.import @device.queue.execute.indirect(
+  %device : !vm.ref<!hal.device>,
+  %queue_affinity : i64,
+  %wait_fence : !vm.ref<!hal.fence>,
+  %signal_fence : !vm.ref<!hal.fence>,
+  %command_buffer : !vm.ref<!hal.command_buffer>,
+  // <buffer, offset, length>
+  %bindings : tuple<!vm.ref<!hal.buffer>, i64, i64>...
+)
+
 //===----------------------------------------------------------------------===//
 // iree_hal_executable_t
 //===----------------------------------------------------------------------===//
@@ -335,6 +391,44 @@ vm.import @executable_layout.create(
 ) -> !vm.ref<!hal.executable_layout>
 attributes {nosideeffects}
 
+//===----------------------------------------------------------------------===//
+// iree_hal_fence_t
+//===----------------------------------------------------------------------===//
+
+// Returns a fence that defines a point in time across one or more timelines.
+vm.import @fence.create(
+  %timepoints : tuple<!vm.ref<!hal.semaphore>, i64>...
+) -> !vm.ref<!hal.fence>
+
+// Returns a fence that joins the input fences as a wait-all operation.
+// Returns null if none of the fences have any timepoints.
+vm.import @fence.join(
+  %fences : !vm.ref<!hal.fence>...
+) -> !vm.ref<!hal.fence>
+
+// Signals the fence.
+vm.import @fence.signal(
+  %fence : !vm.ref<!hal.fence>
+)
+
+// Signals the fence with a failure. The |status| will be returned from
+// `hal.semaphore.query` and `hal.semaphore.signal` for the lifetime
+// of each semaphore in the fence.
+vm.import @fence.fail(
+  %fence : !vm.ref<!hal.fence>,
+  %status : i32
+)
+
+// Yields the caller until all fences are reached or |timeout_millis| elapses.
+// A negative |timeout_millis| waits indefinitely.
+//
+// Returns the status of the wait, with a non-zero value indicating failure.
+vm.import @fence.await(
+  %timeout_millis : i32,
+  %fences : !vm.ref<!hal.fence>...
+) -> i32
+attributes {vm.yield}
+
 //===----------------------------------------------------------------------===//
 // iree_hal_semaphore_t
 //===----------------------------------------------------------------------===//
@@ -26,7 +26,216 @@
 vm.module @vmvx {
 
 //===----------------------------------------------------------------------===//
-// VMVX Ops: TODO
+// VMVX Ops: elementwise
 //===----------------------------------------------------------------------===//
 
+// Strided 2D views are passed as a buffer with an element offset and element
+// strides for each dimension. Views must be in bounds and aligned to their
+// element type.
+
+// out = lhs + rhs
+vm.import @add.2d.f32(
+  %lhs : !vm.buffer,
+  %lhs_offset : i64,
+  %lhs_stride0 : i64,
+  %lhs_stride1 : i64,
+  %rhs : !vm.buffer,
+  %rhs_offset : i64,
+  %rhs_stride0 : i64,
+  %rhs_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride0 : i64,
+  %out_stride1 : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+// out = lhs + rhs
+vm.import @add.2d.i32(
+  %lhs : !vm.buffer,
+  %lhs_offset : i64,
+  %lhs_stride0 : i64,
+  %lhs_stride1 : i64,
+  %rhs : !vm.buffer,
+  %rhs_offset : i64,
+  %rhs_stride0 : i64,
+  %rhs_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride0 : i64,
+  %out_stride1 : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+// out = lhs * rhs
+vm.import @mul.2d.f32(
+  %lhs : !vm.buffer,
+  %lhs_offset : i64,
+  %lhs_stride0 : i64,
+  %lhs_stride1 : i64,
+  %rhs : !vm.buffer,
+  %rhs_offset : i64,
+  %rhs_stride0 : i64,
+  %rhs_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride0 : i64,
+  %out_stride1 : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+// out = lhs * rhs
+vm.import @mul.2d.i32(
+  %lhs : !vm.buffer,
+  %lhs_offset : i64,
+  %lhs_stride0 : i64,
+  %lhs_stride1 : i64,
+  %rhs : !vm.buffer,
+  %rhs_offset : i64,
+  %rhs_stride0 : i64,
+  %rhs_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride0 : i64,
+  %out_stride1 : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+// out = in
+vm.import @copy.2d.x32(
+  %in : !vm.buffer,
+  %in_offset : i64,
+  %in_stride0 : i64,
+  %in_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride0 : i64,
+  %out_stride1 : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+// out = in
+vm.import @copy.2d.x8(
+  %in : !vm.buffer,
+  %in_offset : i64,
+  %in_stride0 : i64,
+  %in_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride0 : i64,
+  %out_stride1 : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+// out = value
+vm.import @fill.2d.x32(
+  %value : i32,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride0 : i64,
+  %out_stride1 : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+//===----------------------------------------------------------------------===//
+// VMVX Ops: reductions
+//===----------------------------------------------------------------------===//
+
+// out[i] = max(in[i][0..size1])
+vm.import @reduce.max.2d.f32(
+  %in : !vm.buffer,
+  %in_offset : i64,
+  %in_stride0 : i64,
+  %in_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+// out[i] = sum(in[i][0..size1])
+vm.import @reduce.sum.2d.f32(
+  %in : !vm.buffer,
+  %in_offset : i64,
+  %in_stride0 : i64,
+  %in_stride1 : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride : i64,
+  %size0 : i64,
+  %size1 : i64
+)
+
+//===----------------------------------------------------------------------===//
+// VMVX Ops: matrix multiplication
+//===----------------------------------------------------------------------===//
+
+// out[m][n] (+)= lhs[m][k] * rhs[k][n] on row-major operands.
+// flags: 1 = accumulate into out.
+vm.import @matmul.f32f32f32(
+  %lhs : !vm.buffer,
+  %lhs_offset : i64,
+  %lhs_stride : i64,
+  %rhs : !vm.buffer,
+  %rhs_offset : i64,
+  %rhs_stride : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride : i64,
+  %m : i64,
+  %n : i64,
+  %k : i64,
+  %flags : i32
+)
+
+// out[M][N][M0][N0] (+)= lhs[M][K][M0][K0] * rhs[N][K][N0][K0]^T
+// flags: 1 = accumulate into out.
+vm.import @mmt4d.f32f32f32(
+  %lhs : !vm.buffer,
+  %lhs_offset : i64,
+  %lhs_stride : i64,
+  %rhs : !vm.buffer,
+  %rhs_offset : i64,
+  %rhs_stride : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride : i64,
+  %m : i64,
+  %n : i64,
+  %k : i64,
+  %m0 : i32,
+  %n0 : i32,
+  %k0 : i32,
+  %flags : i32
+)
+
+// out[M][N][M0][N0] (+)= lhs[M][K][M0][K0] * rhs[N][K][N0][K0]^T
+// flags: 1 = accumulate into out.
+vm.import @mmt4d.i8i8i32(
+  %lhs : !vm.buffer,
+  %lhs_offset : i64,
+  %lhs_stride : i64,
+  %rhs : !vm.buffer,
+  %rhs_offset : i64,
+  %rhs_stride : i64,
+  %out : !vm.buffer,
+  %out_offset : i64,
+  %out_stride : i64,
+  %m : i64,
+  %n : i64,
+  %k : i64,
+  %m0 : i32,
+  %n0 : i32,
+  %k0 : i32,
+  %flags : i32
+)
+
 }  // module
@@ -7,6 +7,7 @@
 #include "iree/compiler/Dialect/Stream/Analysis/Partitioning.h"
 
 #include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "mlir/IR/AsmState.h"
 #include "mlir/IR/PatternMatch.h"
@@ -18,6 +19,25 @@ namespace iree_compiler {
 namespace IREE {
 namespace Stream {
 
+namespace {
+enum class PartitioningAlgorithm {
+  Reference,
+  CostModel,
+};
+}  // namespace
+
+static llvm::cl::opt<PartitioningAlgorithm> clPartitioningAlgorithm(
+    "iree-stream-partitioning-algorithm",
+    llvm::cl::desc("Algorithm used to partition streamable ops into execution "
+                   "regions and concurrency waves."),
+    llvm::cl::init(PartitioningAlgorithm::Reference),
+    llvm::cl::values(
+        clEnumValN(PartitioningAlgorithm::Reference, "reference",
+                   "Greedy partitioning based solely on correctness."),
+        clEnumValN(PartitioningAlgorithm::CostModel, "cost-model",
+                   "Picks among several partitionings using a static cost "
+                   "model of memory traffic and submission overhead.")));
+
 #ifndef NDEBUG
 
 void dumpPartition(Partition &partition, AsmState &state) {
@@ -153,16 +173,36 @@ void PartitionSet::topologicalSort() {
   partitions = std::move(sortedSet);
 }
 
+StringRef getPartitioningAlgorithmName() {
+  switch (clPartitioningAlgorithm) {
+    default:
+    case PartitioningAlgorithm::Reference:
+      return "reference";
+    case PartitioningAlgorithm::CostModel:
+      return "cost-model";
+  }
+}
+
 PartitionSet partitionStreamableOps(IREE::Stream::PartitioningConfigAttr config,
                                     Block *block) {
-  // Only one algorithm today.
-  return partitionStreamableOpsReference(config, block);
+  switch (clPartitioningAlgorithm) {
+    default:
+    case PartitioningAlgorithm::Reference:
+      return partitionStreamableOpsReference(config, block);
+    case PartitioningAlgorithm::CostModel:
+      return partitionStreamableOpsCostModel(config, block);
+  }
 }
 
 PartitionSet partitionRegionConcurrency(
     IREE::Stream::PartitioningConfigAttr config, Block *block) {
-  // Only one algorithm today.
-  return partitionRegionConcurrencyReference(config, block);
+  switch (clPartitioningAlgorithm) {
+    default:
+    case PartitioningAlgorithm::Reference:
+      return partitionRegionConcurrencyReference(config, block);
+    case PartitioningAlgorithm::CostModel:
+      return partitionRegionConcurrencyCostModel(config, block);
+  }
 }
 
 }  // namespace Stream
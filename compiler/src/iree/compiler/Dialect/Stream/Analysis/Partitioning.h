@@ -8,6 +8,7 @@
 #define IREE_COMPILER_DIALECT_STREAM_ANALYSIS_PARTITIONING_H_
 
 #include "iree/compiler/Dialect/Stream/IR/StreamTypes.h"
+#include "llvm/ADT/DenseMap.h"
 #include "mlir/IR/Operation.h"
 #include "mlir/Support/LLVM.h"
 
@@ -60,6 +61,46 @@ struct PartitionSet {
   void topologicalSort();
 };
 
+//===----------------------------------------------------------------------===//
+// Cost modeling
+//===----------------------------------------------------------------------===//
+
+// A coarse static cost model used to guide and compare partitionings.
+// Costs are in abstract units roughly equivalent to bytes of memory traffic.
+// Sizes that are not statically known are not counted and as such dynamically
+// shaped programs are compared using only their static portions.
+class PartitioningCostModel {
+ public:
+  // Uses the costs specified by the --iree-stream-partitioning-* flags.
+  PartitioningCostModel();
+  // |submissionCost| is the fixed overhead of each execution region
+  // submitted to a device queue and |waveCost| is the fixed overhead of each
+  // barrier between waves of concurrently executing work.
+  PartitioningCostModel(int64_t submissionCost, int64_t waveCost);
+
+  // Returns the size in bytes of |value| if it is a resource with a statically
+  // known size and otherwise 0.
+  int64_t getValueBytes(Value value);
+
+  // Returns the estimated cost of executing |op| as the bytes it reads and
+  // writes and, for dispatches, the total static workload.
+  int64_t getOpCost(Operation *op);
+
+  // Returns the estimated cost of executing |partitionSet| with each partition
+  // as its own serialized submission. Values escaping a partition are charged
+  // as they must be materialized for use by other partitions.
+  int64_t estimateSubmissionCost(const PartitionSet &partitionSet);
+
+  // Returns the estimated cost of executing |waveSet| with all ops in each
+  // wave executing concurrently and each wave bounded by a barrier.
+  int64_t estimateConcurrencyCost(const PartitionSet &waveSet);
+
+ private:
+  int64_t submissionCost;
+  int64_t waveCost;
+  DenseMap<Operation *, int64_t> opCosts;
+};
+
 //===----------------------------------------------------------------------===//
 // Stream partitioning algorithms
 //===----------------------------------------------------------------------===//
@@ -100,10 +141,15 @@ struct PartitionSet {
 //   https://tel.archives-ouvertes.fr/tel-01956979/document
 //
 
+// Returns the name of the algorithm selected with
+// --iree-stream-partitioning-algorithm= for use in diagnostics.
+StringRef getPartitioningAlgorithmName();
+
 // Partitions the ops in |block| such that all streamable ops are in one or more
 // partitions (with >1 implying duplication). Partitions may contain
 // non-streamable ops if it is safe to do so (such as std arithmetic). Not all
 // ops in the block will be covered by a partition.
+// The algorithm used is selected with --iree-stream-partitioning-algorithm=.
 PartitionSet partitionStreamableOps(IREE::Stream::PartitioningConfigAttr config,
                                     Block *block);
 PartitionSet partitionRegionConcurrency(
@@ -115,12 +161,34 @@ PartitionSet partitionRegionConcurrency(
 
 // Naive clustering based solely on correctness with no cost model or weighting.
 // Produces the largest possible streams for any given block. Unsatisfactory.
+// If a |costModel| is provided it is used to break ties when an op could be
+// placed in multiple partitions.
 PartitionSet partitionStreamableOpsReference(
-    IREE::Stream::PartitioningConfigAttr config, Block *block);
+    IREE::Stream::PartitioningConfigAttr config, Block *block,
+    PartitioningCostModel *costModel = nullptr);
 
 // Similarly poor algorithm to partitionStreamableOpsReference but for use
 // within partitioned streams to produce waves of concurrently executable work.
+// If a |costModel| is provided ops are placed in the least costly of the waves
+// they could execute in to balance the work across waves.
 PartitionSet partitionRegionConcurrencyReference(
+    IREE::Stream::PartitioningConfigAttr config, Block *block,
+    PartitioningCostModel *costModel = nullptr);
+
+//===----------------------------------------------------------------------===//
+// Cost model partitioning
+//===----------------------------------------------------------------------===//
+
+// Partitions using the reference algorithm with and without cost-guided tie
+// breaking and picks the partitioning with the lowest estimated cost.
+PartitionSet partitionStreamableOpsCostModel(
+    IREE::Stream::PartitioningConfigAttr config, Block *block);
+
+// Partitions into waves using the reference algorithm with several placement
+// strategies and picks the one with the lowest estimated cost. As memory use is
+// not modeled the reference placement is used unchanged when the config favors
+// minimizing peak memory.
+PartitionSet partitionRegionConcurrencyCostModel(
     IREE::Stream::PartitioningConfigAttr config, Block *block);
 
 }  // namespace Stream
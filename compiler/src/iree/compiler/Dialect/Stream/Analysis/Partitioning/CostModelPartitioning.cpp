@@ -0,0 +1,184 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <algorithm>
+
+#include "iree/compiler/Dialect/Stream/Analysis/Partitioning.h"
+#include "iree/compiler/Dialect/Stream/IR/StreamOps.h"
+#include "iree/compiler/Dialect/Util/IR/UtilOps.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/IR/Matchers.h"
+
+#define DEBUG_TYPE "iree-stream-partitioning"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace Stream {
+
+// Defaults are rough equivalents of the time it takes to move the given number
+// of bytes on a discrete GPU: a queue submission is on the order of 10us and a
+// barrier between dispatches is on the order of 1us.
+static llvm::cl::opt<int64_t> clPartitioningSubmissionCost(
+    "iree-stream-partitioning-submission-cost",
+    llvm::cl::desc("Fixed cost of each execution region submission used by "
+                   "the cost-model partitioning algorithm (in bytes of "
+                   "memory traffic)."),
+    llvm::cl::init(128 * 1024));
+static llvm::cl::opt<int64_t> clPartitioningWaveCost(
+    "iree-stream-partitioning-wave-cost",
+    llvm::cl::desc("Fixed cost of each barrier between concurrency waves used "
+                   "by the cost-model partitioning algorithm (in bytes of "
+                   "memory traffic)."),
+    llvm::cl::init(16 * 1024));
+
+//===----------------------------------------------------------------------===//
+// PartitioningCostModel
+//===----------------------------------------------------------------------===//
+
+PartitioningCostModel::PartitioningCostModel()
+    : PartitioningCostModel(clPartitioningSubmissionCost,
+                            clPartitioningWaveCost) {}
+
+PartitioningCostModel::PartitioningCostModel(int64_t submissionCost,
+                                             int64_t waveCost)
+    : submissionCost(submissionCost), waveCost(waveCost) {}
+
+// Returns the static value of |sizeValue| or 0 if it is not constant.
+static int64_t getStaticSize(Value sizeValue) {
+  APInt size;
+  if (sizeValue && matchPattern(sizeValue, m_ConstantInt(&size))) {
+    return size.getSExtValue();
+  }
+  return 0;
+}
+
+int64_t PartitioningCostModel::getValueBytes(Value value) {
+  if (!value.getType().isa<IREE::Stream::ResourceType>()) return 0;
+  auto sizeAwareOp = dyn_cast_or_null<IREE::Util::SizeAwareOpInterface>(
+      value.getDefiningOp());
+  if (!sizeAwareOp) return 0;
+  return getStaticSize(sizeAwareOp.getResultSizeFromValue(value));
+}
+
+int64_t PartitioningCostModel::getOpCost(Operation *op) {
+  auto it = opCosts.find(op);
+  if (it != opCosts.end()) return it->second;
+
+  int64_t cost = 0;
+  auto streamableOp = dyn_cast<IREE::Stream::StreamableOpInterface>(op);
+  if (streamableOp && streamableOp.isMetadata()) {
+    // Metadata ops (like subviews) do no work.
+  } else if (auto sizeAwareOp =
+                 dyn_cast<IREE::Util::SizeAwareOpInterface>(op)) {
+    for (auto operand : llvm::enumerate(op->getOperands())) {
+      if (!operand.value().getType().isa<IREE::Stream::ResourceType>()) {
+        continue;
+      }
+      cost += getStaticSize(sizeAwareOp.getOperandSize(operand.index()));
+    }
+    for (auto result : op->getResults()) {
+      cost += getValueBytes(result);
+    }
+    if (auto dispatchOp = dyn_cast<IREE::Stream::AsyncDispatchOp>(op)) {
+      // The workload is the best static indicator we have of the amount of
+      // compute relative to other dispatches.
+      int64_t workload = 1;
+      for (auto dim : dispatchOp.workload()) {
+        workload *= std::max<int64_t>(1, getStaticSize(dim));
+      }
+      cost += workload;
+    }
+  }
+
+  opCosts[op] = cost;
+  return cost;
+}
+
+int64_t PartitioningCostModel::estimateSubmissionCost(
+    const PartitionSet &partitionSet) {
+  int64_t cost = 0;
+  for (auto &partition : partitionSet.partitions) {
+    cost += submissionCost;
+    for (auto *op : partition.ops) cost += getOpCost(op);
+    for (auto out : partition.outs) cost += getValueBytes(out);
+  }
+  return cost;
+}
+
+int64_t PartitioningCostModel::estimateConcurrencyCost(
+    const PartitionSet &waveSet) {
+  int64_t cost = 0;
+  for (auto &wave : waveSet.partitions) {
+    int64_t maxOpCost = 0;
+    for (auto *op : wave.ops) maxOpCost = std::max(maxOpCost, getOpCost(op));
+    cost += waveCost + maxOpCost;
+  }
+  return cost;
+}
+
+//===----------------------------------------------------------------------===//
+// Cost model partitioning
+//===----------------------------------------------------------------------===//
+
+PartitionSet partitionStreamableOpsCostModel(
+    IREE::Stream::PartitioningConfigAttr config, Block *block) {
+  PartitioningCostModel costModel;
+  auto referenceSet = partitionStreamableOpsReference(config, block);
+  auto guidedSet = partitionStreamableOpsReference(config, block, &costModel);
+  int64_t referenceCost = costModel.estimateSubmissionCost(referenceSet);
+  int64_t guidedCost = costModel.estimateSubmissionCost(guidedSet);
+  LLVM_DEBUG(llvm::dbgs() << "Execution partitioning cost: reference "
+                          << referenceCost << " (" << referenceSet.size()
+                          << " partitions), cost-guided " << guidedCost << " ("
+                          << guidedSet.size() << " partitions)\n");
+  if (guidedCost < referenceCost) return guidedSet;
+  return referenceSet;
+}
+
+PartitionSet partitionRegionConcurrencyCostModel(
+    IREE::Stream::PartitioningConfigAttr config, Block *block) {
+  auto favor = config.getFavor().getValue();
+  if (favor != IREE::Stream::Favor::MaxConcurrency) {
+    // Debug disables partitioning and the reference placement for minimum
+    // peak memory relies on the op order which the cost model doesn't know.
+    return partitionRegionConcurrencyReference(config, block);
+  }
+
+  // Candidates are the reference placement (each op in its latest wave),
+  // the cost-guided placement (each op in the wave it extends the least), and
+  // the reference placement favoring memory (each op in its earliest wave).
+  PartitioningCostModel costModel;
+  SmallVector<PartitionSet> candidateSets;
+  candidateSets.push_back(partitionRegionConcurrencyReference(config, block));
+  candidateSets.push_back(
+      partitionRegionConcurrencyReference(config, block, &costModel));
+  auto altConfig =
+      IREE::Stream::PartitioningConfigAttr::get(IREE::Stream::FavorAttr::get(
+          config.getContext(), IREE::Stream::Favor::MinPeakMemory));
+  candidateSets.push_back(
+      partitionRegionConcurrencyReference(altConfig, block));
+
+  unsigned bestIndex = 0;
+  int64_t bestCost = INT64_MAX;
+  for (auto it : llvm::enumerate(candidateSets)) {
+    int64_t cost = costModel.estimateConcurrencyCost(it.value());
+    LLVM_DEBUG(llvm::dbgs() << "Concurrency partitioning candidate "
+                            << it.index() << " cost " << cost << " ("
+                            << it.value().size() << " waves)\n");
+    if (cost < bestCost) {
+      bestCost = cost;
+      bestIndex = it.index();
+    }
+  }
+  return std::move(candidateSets[bestIndex]);
+}
+
+}  // namespace Stream
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
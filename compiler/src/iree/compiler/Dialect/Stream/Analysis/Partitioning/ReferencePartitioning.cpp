@@ -4,6 +4,8 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <algorithm>
+
 #include "iree/compiler/Dialect/Stream/Analysis/Partitioning.h"
 #include "llvm/ADT/BitVector.h"
 #include "llvm/ADT/STLExtras.h"
@@ -23,7 +25,8 @@ namespace Stream {
 // an op could be in multiple partitions, cloning for ops that are not worth
 // spanning partitions (like splats), etc.
 PartitionSet partitionStreamableOpsReference(
-    IREE::Stream::PartitioningConfigAttr config, Block *block) {
+    IREE::Stream::PartitioningConfigAttr config, Block *block,
+    PartitioningCostModel *costModel) {
   PartitionSet partitionSet;
 
   struct PartitionBuilder {
@@ -146,6 +149,25 @@ PartitionSet partitionStreamableOpsReference(
         }
       } else {
         int consumerOrdinal = consumers.find_last();
+        if (costModel && consumers.count() > 1) {
+          // Prefer the consumer that uses the most of what this op produces
+          // so that less escapes the partition. Ties go to the last as above.
+          int64_t bestBytes = -1;
+          for (auto ordinal : consumers.set_bits()) {
+            int64_t bytes = 0;
+            for (auto result : op.getResults()) {
+              if (llvm::any_of(result.getUsers(), [&](Operation *user) {
+                    return builders[ordinal]->ops.contains(user);
+                  })) {
+                bytes += costModel->getValueBytes(result);
+              }
+            }
+            if (bytes >= bestBytes) {
+              bestBytes = bytes;
+              consumerOrdinal = ordinal;
+            }
+          }
+        }
         LLVM_DEBUG(llvm::dbgs() << "Moving into consumer partition "
                                 << consumerOrdinal << "\n");
         builders[consumerOrdinal]->ops.insert(&op);
@@ -222,7 +244,8 @@ PartitionSet partitionStreamableOpsReference(
 // This looks to extract a single level of concurrency; we should be recursively
 // dividing the block to identify both serial and concurrent regions.
 PartitionSet partitionRegionConcurrencyReference(
-    IREE::Stream::PartitioningConfigAttr config, Block *block) {
+    IREE::Stream::PartitioningConfigAttr config, Block *block,
+    PartitioningCostModel *costModel) {
   PartitionSet waveSet;
 
   auto favor = config.getFavor().getValue();
@@ -235,6 +258,8 @@ PartitionSet partitionRegionConcurrencyReference(
     unsigned ordinal;
     // Ops present in the wave; ops may be present in multiple waves.
     SetVector<Operation *> ops;
+    // Largest estimated cost of any op in the wave when using a cost model.
+    int64_t maxOpCost = 0;
   };
   SmallVector<std::unique_ptr<PartitionBuilder>> builders;
 
@@ -307,10 +332,28 @@ PartitionSet partitionRegionConcurrencyReference(
     int firstCandidateOrdinal = favor == IREE::Stream::Favor::MaxConcurrency
                                     ? candidates.find_first()
                                     : candidates.find_last();
+    int64_t opCost = costModel ? costModel->getOpCost(&op) : 0;
+    if (costModel && firstCandidateOrdinal != -1) {
+      // Pick the wave where the op adds the least to the wave execution time
+      // (the longest op within it). Ties go to the favored wave as above.
+      auto costIncrease = [&](int ordinal) {
+        return std::max<int64_t>(0, opCost - builders[ordinal]->maxOpCost);
+      };
+      int64_t bestIncrease = costIncrease(firstCandidateOrdinal);
+      for (auto ordinal : candidates.set_bits()) {
+        int64_t increase = costIncrease(ordinal);
+        if (increase < bestIncrease) {
+          bestIncrease = increase;
+          firstCandidateOrdinal = ordinal;
+        }
+      }
+    }
     if (firstCandidateOrdinal != -1) {
       LLVM_DEBUG(llvm::dbgs() << "Moving to last candidate wave "
                               << firstCandidateOrdinal << " (continue)\n");
       builders[firstCandidateOrdinal]->ops.insert(&op);
+      builders[firstCandidateOrdinal]->maxOpCost =
+          std::max(builders[firstCandidateOrdinal]->maxOpCost, opCost);
       opInfo.membership.set(firstCandidateOrdinal);
       opInfo.hazards.set(0, firstCandidateOrdinal);
       opInfo.hazards.reset(firstCandidateOrdinal);
@@ -325,6 +368,7 @@ PartitionSet partitionRegionConcurrencyReference(
     auto builder = std::make_unique<PartitionBuilder>();
     builder->ordinal = builders.size();
     builder->ops.insert(&op);
+    builder->maxOpCost = opCost;
     LLVM_DEBUG(llvm::dbgs() << "Created wave " << builder->ordinal << "\n");
     builders.push_back(std::move(builder));
   }
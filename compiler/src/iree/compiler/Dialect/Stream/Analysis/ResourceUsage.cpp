@@ -250,6 +250,12 @@ class ValueResourceUsage : public AbstractResourceUsage<DFX::ValueElement> {
               DFX::Resolution::REQUIRED);
           getState() ^= sourceUsage.getState();
         })
+        .Case([&](IREE::Stream::TimepointBarrierOp op) {
+          auto sourceUsage = solver.getElementFor<ValueResourceUsage>(
+              *this, Position::forValue(op.resource()),
+              DFX::Resolution::REQUIRED);
+          getState() ^= sourceUsage.getState();
+        })
         .Case([&](IREE::Util::GlobalLoadOp op) {
           removeAssumedBits(NOT_GLOBAL_READ);
           auto *globalInfo =
@@ -444,6 +450,12 @@ class ValueResourceUsage : public AbstractResourceUsage<DFX::ValueElement> {
               DFX::Resolution::REQUIRED);
           getState() ^= resultUsage.getState();
         })
+        .Case([&](IREE::Stream::TimepointBarrierOp op) {
+          auto resultUsage = solver.getElementFor<ValueResourceUsage>(
+              *this, Position::forValue(op.result()),
+              DFX::Resolution::REQUIRED);
+          getState() ^= resultUsage.getState();
+        })
         .Case([&](IREE::Util::GlobalStoreOp op) {
           removeAssumedBits(NOT_GLOBAL_WRITE);
           auto *globalInfo =
@@ -60,14 +60,29 @@ struct ConvertTensorImportOp
         op.getLoc(), rewriter.getIndexType(),
         TypeAttr::get(op.target().getType()), adaptor.target_dims(),
         /*affinity=*/nullptr);
-    auto newOp = rewriter.create<IREE::Stream::TensorImportOp>(
+    Value resource = rewriter.create<IREE::Stream::TensorImportOp>(
         op.getLoc(), resultType, adaptor.source(), TypeAttr::get(targetType),
         adaptor.target_dims(), resultSize,
         /*affinity=*/nullptr);
 
+    // Await the fence, if any. When propagated into execution this will become
+    // a device-side wait instead of blocking the host.
+    if (adaptor.wait_fence()) {
+      auto waitTimepoint = rewriter.create<IREE::Stream::TimepointImportOp>(
+          op.getLoc(), rewriter.getType<IREE::Stream::TimepointType>(),
+          ValueRange{adaptor.wait_fence()},
+          /*affinity=*/nullptr);
+      resource = rewriter
+                     .create<IREE::Stream::TimepointAwaitOp>(
+                         op.getLoc(), ValueRange{resource},
+                         ValueRange{resultSize}, waitTimepoint.getResult())
+                     .results()
+                     .front();
+    }
+
     auto unknownType = rewriter.getType<IREE::Stream::ResourceType>();
     rewriter.replaceOpWithNewOp<IREE::Stream::AsyncTransferOp>(
-        op, unknownType, newOp.result(), resultSize, resultSize,
+        op, unknownType, resource, resultSize, resultSize,
         /*source_affinity=*/nullptr,
         /*result_affinity=*/nullptr);
     return success();
@@ -194,6 +209,47 @@ struct ConvertTensorExportOp
   }
 };
 
+// %r0b, %r1b = hal.tensor.barrier join(%r0, %r1 : tensor<4xf32>,
+//                                       tensor<4xf32>) => %fence : !hal.fence
+// ->
+// %r0b, %t0 = stream.timepoint.barrier %r0 : !stream.resource<*>
+// %r1b, %t1 = stream.timepoint.barrier %r1 : !stream.resource<*>
+// %t01 = stream.timepoint.join max(%t0, %t1)
+// stream.timepoint.chain_external %t01 => (%fence : !hal.fence)
+struct ConvertTensorBarrierOp
+    : public OpConversionPattern<IREE::HAL::TensorBarrierOp> {
+  using OpConversionPattern::OpConversionPattern;
+  LogicalResult matchAndRewrite(
+      IREE::HAL::TensorBarrierOp op, OpAdaptor adaptor,
+      ConversionPatternRewriter &rewriter) const override {
+    auto timepointType = rewriter.getType<IREE::Stream::TimepointType>();
+    SmallVector<Value> signaledResources;
+    SmallVector<Value> signaledTimepoints;
+    for (auto sourceResource : adaptor.sources()) {
+      auto source = consumeTensorOperand(op.getLoc(), sourceResource, rewriter);
+      auto barrierOp = rewriter.create<IREE::Stream::TimepointBarrierOp>(
+          sourceResource.getLoc(), source.resource.getType(), timepointType,
+          source.resource, source.resourceSize,
+          /*affinity=*/nullptr);
+      signaledResources.push_back(barrierOp.result());
+      signaledTimepoints.push_back(barrierOp.result_timepoint());
+    }
+    Value joinedTimepoint;
+    if (signaledTimepoints.empty()) {
+      joinedTimepoint =
+          rewriter.create<IREE::Stream::TimepointImmediateOp>(op.getLoc());
+    } else {
+      joinedTimepoint = rewriter.createOrFold<IREE::Stream::TimepointJoinOp>(
+          op.getLoc(), timepointType, signaledTimepoints);
+    }
+    rewriter.create<IREE::Stream::TimepointChainExternalOp>(
+        op.getLoc(), joinedTimepoint, ValueRange{adaptor.signal_fence()},
+        /*affinity=*/nullptr);
+    rewriter.replaceOp(op, signaledResources);
+    return success();
+  }
+};
+
 }  // namespace
 
 void populateHALToStreamConversionPatterns(MLIRContext *context,
@@ -203,6 +259,7 @@ void populateHALToStreamConversionPatterns(MLIRContext *context,
       [](IREE::HAL::BufferViewType type) { return type; });
   patterns.insert<ConvertTensorImportOp>(typeConverter, context);
   patterns.insert<ConvertTensorExportOp>(typeConverter, context);
+  patterns.insert<ConvertTensorBarrierOp>(typeConverter, context);
 }
 
 void populateHALToStreamConversionPatterns(MLIRContext *context,
@@ -223,6 +280,10 @@ void populateHALToStreamConversionPatterns(MLIRContext *context,
         return typeConverter.isLegal(op.source().getType()) &&
                typeConverter.isLegal(op.target().getType());
       });
+  conversionTarget.addDynamicallyLegalOp<IREE::HAL::TensorBarrierOp>(
+      [&](IREE::HAL::TensorBarrierOp op) {
+        return typeConverter.isLegal(op.getResultTypes());
+      });
 
   populateHALToStreamConversionPatterns(context, typeConverter, patterns);
 }
@@ -65,3 +65,35 @@ func.func @exportBufferViewInPlace(%tensor: tensor<?x?x4xf32>, %dim0: index, %di
   // CHECK: return %[[STORAGE_RESULT]]
   return %0 : !hal.buffer_view
 }
+
+// -----
+
+// CHECK-LABEL: @importBufferViewAsync
+// CHECK-SAME: (%[[VIEW:.+]]: !hal.buffer_view, %[[FENCE:.+]]: !hal.fence)
+// CHECK-SAME: -> (!stream.resource<*>, index)
+func.func @importBufferViewAsync(%view: !hal.buffer_view, %fence: !hal.fence) -> tensor<4xf32> {
+  //  CHECK-DAG: %[[SIZE:.+]] = stream.tensor.sizeof tensor<4xf32>
+  //      CHECK: %[[RESOURCE:.+]] = stream.tensor.import %[[VIEW]] : !hal.buffer_view ->
+  // CHECK-SAME:     tensor<4xf32> in !stream.resource<external>{%[[SIZE]]}
+  // CHECK-NEXT: %[[TIMEPOINT:.+]] = stream.timepoint.import %[[FENCE]] : (!hal.fence) => !stream.timepoint
+  // CHECK-NEXT: %[[READY:.+]] = stream.timepoint.await %[[TIMEPOINT]] => %[[RESOURCE]] : !stream.resource<external>{%[[SIZE]]}
+  // CHECK-NEXT: %[[RESULT:.+]] = stream.async.transfer %[[READY]] :
+  // CHECK-SAME:     !stream.resource<external>{%[[SIZE]]} -> !stream.resource<*>{%[[SIZE]]}
+  %0 = hal.tensor.import wait(%fence) => %view : !hal.buffer_view -> tensor<4xf32>
+  // CHECK: return %[[RESULT]], %[[SIZE]] : !stream.resource<*>, index
+  return %0 : tensor<4xf32>
+}
+
+// -----
+
+// CHECK-LABEL: @tensorBarrier
+// CHECK-SAME: (%[[TENSOR0:.+]]: !stream.resource<*>, %[[SIZE0:.+]]: index, %[[TENSOR1:.+]]: !stream.resource<*>, %[[SIZE1:.+]]: index, %[[FENCE:.+]]: !hal.fence)
+func.func @tensorBarrier(%tensor0: tensor<3xf32>, %tensor1: tensor<?xf32>, %fence: !hal.fence) -> (tensor<3xf32>, tensor<?xf32>) {
+  // CHECK-DAG: %[[RESOURCE0:.+]], %[[TIMEPOINT0:.+]] = stream.timepoint.barrier %[[TENSOR0]] : !stream.resource<*>{%[[SIZE0]]} => !stream.timepoint
+  // CHECK-DAG: %[[RESOURCE1:.+]], %[[TIMEPOINT1:.+]] = stream.timepoint.barrier %[[TENSOR1]] : !stream.resource<*>{%[[SIZE1]]} => !stream.timepoint
+  // CHECK: %[[JOIN:.+]] = stream.timepoint.join max(%[[TIMEPOINT0]], %[[TIMEPOINT1]]) => !stream.timepoint
+  // CHECK: stream.timepoint.chain_external %[[JOIN]] => (%[[FENCE]] : !hal.fence)
+  %0:2 = hal.tensor.barrier join(%tensor0, %tensor1 : tensor<3xf32>, tensor<?xf32>) => %fence : !hal.fence
+  // CHECK: return %[[RESOURCE0]], %[[SIZE0]], %[[RESOURCE1]], %[[SIZE1]]
+  return %0#0, %0#1 : tensor<3xf32>, tensor<?xf32>
+}
@@ -2081,6 +2081,24 @@ LogicalResult TimepointJoinOp::verify() {
   return success();
 }
 
+//===----------------------------------------------------------------------===//
+// stream.timepoint.barrier
+//===----------------------------------------------------------------------===//
+
+Value TimepointBarrierOp::getTiedResult(unsigned resultIndex) {
+  return IREE::Util::TiedOpInterface::findTiedBaseValue(resource());
+}
+
+::llvm::Optional<unsigned> TimepointBarrierOp::getTiedResultOperandIndex(
+    unsigned resultIndex) {
+  if (resultIndex != 0) return llvm::None;  // result_timepoint
+  return {0};                                // resource
+}
+
+SmallVector<int64_t, 4> TimepointBarrierOp::getTiedResultOperandIndices() {
+  return {0, IREE::Util::TiedOpInterface::kUntiedIndex};
+}
+
 //===----------------------------------------------------------------------===//
 // stream.timepoint.await
 //===----------------------------------------------------------------------===//
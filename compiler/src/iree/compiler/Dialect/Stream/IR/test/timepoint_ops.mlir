@@ -27,6 +27,15 @@ func.func @timepointExport(%arg0: !stream.timepoint) -> (!hal.semaphore, index)
 
 // -----
 
+// CHECK-LABEL: @timepointChainExternal
+func.func @timepointChainExternal(%arg0: !stream.timepoint, %arg1: !hal.fence) {
+  // CHECK: stream.timepoint.chain_external %arg0 => (%arg1 : !hal.fence)
+  stream.timepoint.chain_external %arg0 => (%arg1 : !hal.fence)
+  return
+}
+
+// -----
+
 // CHECK-LABEL: @timepointJoin
 func.func @timepointJoin(%arg0: !stream.timepoint, %arg1: !stream.timepoint) -> !stream.timepoint {
   // CHECK: = stream.timepoint.join max(%arg0, %arg1) => !stream.timepoint
@@ -44,3 +53,13 @@ func.func @timepointAwait(%arg0: !stream.timepoint, %arg1: !stream.resource<stag
   %0:2 = stream.timepoint.await %arg0 => %arg1, %arg2 : !stream.resource<staging>{%c100}, !stream.resource<*>{%c200}
   return %0#0, %0#1 : !stream.resource<staging>, !stream.resource<*>
 }
+
+// -----
+
+// CHECK-LABEL: @timepointBarrier
+func.func @timepointBarrier(%arg0: !stream.resource<external>) -> (!stream.resource<external>, !stream.timepoint) {
+  %c128 = arith.constant 128 : index
+  // CHECK: = stream.timepoint.barrier %arg0 : !stream.resource<external>{%c128} => !stream.timepoint
+  %0:2 = stream.timepoint.barrier %arg0 : !stream.resource<external>{%c128} => !stream.timepoint
+  return %0#0, %0#1 : !stream.resource<external>, !stream.timepoint
+}
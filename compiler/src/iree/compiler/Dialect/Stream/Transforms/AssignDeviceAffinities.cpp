@@ -0,0 +1,155 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/compiler/Dialect/Stream/IR/StreamDialect.h"
+#include "iree/compiler/Dialect/Stream/IR/StreamOps.h"
+#include "iree/compiler/Dialect/Stream/IR/StreamTypes.h"
+#include "iree/compiler/Dialect/Stream/Transforms/PassDetail.h"
+#include "iree/compiler/Dialect/Stream/Transforms/Passes.h"
+#include "iree/compiler/Dialect/Util/IR/UtilTypes.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/Pass/Pass.h"
+
+#define DEBUG_TYPE "iree-stream-assign-device-affinities"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace Stream {
+namespace {
+
+// Returns true if |op| is async work that can be assigned to a device.
+static bool isAssignableOp(Operation *op) {
+  return isa<IREE::Stream::AffinityOpInterface>(op) &&
+         isa<IREE::Stream::StreamableOpInterface>(op) &&
+         op->hasTrait<OpTrait::IREE::Stream::AsyncPhaseOp>();
+}
+
+// Returns the affinity of |value| if it is produced by an op in |block| that
+// has been assigned one.
+static IREE::Stream::AffinityAttr getProducerAffinity(
+    Value value, Block *block,
+    const DenseMap<Operation *, IREE::Stream::AffinityAttr> &assignments) {
+  auto *definingOp = value.getDefiningOp();
+  if (!definingOp || definingOp->getBlock() != block) return {};
+  auto it = assignments.find(definingOp);
+  return it != assignments.end() ? it->second : IREE::Stream::AffinityAttr{};
+}
+
+// Splits the async work in |block| into |deviceCount| pipeline stages with a
+// roughly equal number of dispatches each. Stage 0 stays on the default device
+// and stage N is pinned to `#stream.affinity<device = N>`. Resources crossing
+// between stages are moved with explicit transfers.
+static void assignPipelineStages(Block *block, int64_t deviceCount) {
+  SmallVector<Operation *> assignableOps;
+  int64_t totalDispatches = 0;
+  for (auto &op : *block) {
+    if (!isAssignableOp(&op)) continue;
+    // Work that was explicitly placed by the user or an earlier pass is
+    // authoritative and we don't try to split around it.
+    if (cast<IREE::Stream::AffinityOpInterface>(op).getAffinity()) return;
+    assignableOps.push_back(&op);
+    if (isa<IREE::Stream::AsyncDispatchOp>(op)) ++totalDispatches;
+  }
+  if (totalDispatches < 2) return;
+  deviceCount = std::min(deviceCount, totalDispatches);
+
+  // Assign stages in program order. Non-dispatch work (splats, slices, etc)
+  // goes with the stage of the dispatches around it.
+  auto *context = block->getParentOp()->getContext();
+  DenseMap<Operation *, IREE::Stream::AffinityAttr> assignments;
+  int64_t dispatchesSeen = 0;
+  for (auto *op : assignableOps) {
+    int64_t stage = std::min(deviceCount - 1,
+                             dispatchesSeen * deviceCount / totalDispatches);
+    if (isa<IREE::Stream::AsyncDispatchOp>(op)) ++dispatchesSeen;
+    if (stage == 0) continue;  // default device
+    auto affinityAttr = IREE::Stream::AffinityAttr::get(context, stage);
+    cast<IREE::Stream::AffinityOpInterface>(op).setAffinity(affinityAttr);
+    assignments[op] = affinityAttr;
+  }
+  LLVM_DEBUG(llvm::dbgs() << "assigned " << assignments.size() << " of "
+                          << assignableOps.size() << " ops across "
+                          << deviceCount << " devices\n");
+
+  // Insert transfers where a resource crosses devices. Users that were not
+  // assigned (returns, global stores, host ops) expect the default device.
+  // Transfers are memoized per value and destination so that multiple users
+  // on the same device share one transfer.
+  DenseMap<std::pair<Value, Attribute>, Value> transfers;
+  for (auto &op : llvm::make_early_inc_range(*block)) {
+    IREE::Stream::AffinityAttr userAffinity;
+    auto it = assignments.find(&op);
+    if (it != assignments.end()) userAffinity = it->second;
+    for (auto &operand : op.getOpOperands()) {
+      auto resourceType =
+          operand.get().getType().dyn_cast<IREE::Stream::ResourceType>();
+      if (!resourceType) continue;
+      // Values produced outside of the block or by unassigned ops are on the
+      // default device.
+      auto producerAffinity =
+          getProducerAffinity(operand.get(), block, assignments);
+      if (producerAffinity == userAffinity) continue;
+      auto &transfer =
+          transfers[std::make_pair(operand.get(), Attribute(userAffinity))];
+      if (!transfer) {
+        OpBuilder builder(&op);
+        auto loc = operand.get().getLoc();
+        auto size = IREE::Util::SizeAwareTypeInterface::queryValueSize(
+            loc, operand.get(), builder);
+        transfer = builder.create<IREE::Stream::AsyncTransferOp>(
+            loc, resourceType, operand.get(), size, size,
+            /*source_affinity=*/producerAffinity,
+            /*result_affinity=*/userAffinity);
+      }
+      operand.set(transfer);
+    }
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// -iree-stream-assign-device-affinities
+//===----------------------------------------------------------------------===//
+
+class AssignDeviceAffinitiesPass
+    : public AssignDeviceAffinitiesBase<AssignDeviceAffinitiesPass> {
+ public:
+  AssignDeviceAffinitiesPass() = default;
+  explicit AssignDeviceAffinitiesPass(int64_t deviceCount) {
+    this->deviceCount = deviceCount;
+  }
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<IREE::Stream::StreamDialect>();
+  }
+
+  void runOnOperation() override {
+    if (deviceCount <= 1) return;
+    auto parentOp = getOperation();
+    if (!parentOp.getCallableRegion() ||
+        parentOp.getCallableRegion()->empty()) {
+      return;
+    }
+    for (auto &block : *parentOp.getCallableRegion()) {
+      assignPipelineStages(&block, deviceCount);
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<InterfacePass<CallableOpInterface>>
+createAssignDeviceAffinitiesPass(int64_t deviceCount) {
+  return std::make_unique<AssignDeviceAffinitiesPass>(deviceCount);
+}
+
+}  // namespace Stream
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -4,8 +4,12 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <algorithm>
 #include <utility>
 
+#include "iree/compiler/Dialect/Flow/IR/FlowOps.h"
+#include "iree/compiler/Dialect/Flow/IR/FlowTypes.h"
+#include "iree/compiler/Dialect/Stream/Analysis/Partitioning.h"
 #include "iree/compiler/Dialect/Stream/IR/StreamDialect.h"
 #include "iree/compiler/Dialect/Stream/IR/StreamOps.h"
 #include "iree/compiler/Dialect/Stream/IR/StreamTraits.h"
@@ -18,6 +22,7 @@
 #include "llvm/Support/Format.h"
 #include "llvm/Support/FormatVariadic.h"
 #include "llvm/Support/raw_ostream.h"
+#include "mlir/Dialect/Linalg/IR/Linalg.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/BuiltinTypes.h"
 #include "mlir/IR/Diagnostics.h"
@@ -46,6 +51,9 @@ struct UsageInfo {
   llvm::MapVector<mlir::func::FuncOp, SmallVector<IREE::Stream::CmdDispatchOp>>
       exportDispatchOps;
 
+  // stream.resource.try_map ops uploading constant data.
+  SmallVector<IREE::Stream::ResourceTryMapOp> tryMapOps;
+
   // TODO(benvanik): resource allocations.
 
   // stream.cmd.execute ops containing all relevant device commands.
@@ -70,6 +78,8 @@ struct UsageInfo {
         TypeSwitch<Operation *>(op)
             .Case<IREE::Stream::ResourceAllocaOp>(
                 [&](auto op) { allocaOps.push_back(op); })
+            .Case<IREE::Stream::ResourceTryMapOp>(
+                [&](auto op) { tryMapOps.push_back(op); })
             .Case<IREE::Stream::CmdExecuteOp>(
                 [&](auto op) { executeOps.push_back(op); })
             .Case<IREE::Stream::TimepointAwaitOp>(
@@ -104,8 +114,13 @@ struct Statistics {
 
   // Execution:
   size_t submissionCount = 0;
+  size_t concurrentCount = 0;
   int64_t transientSize = 0;
   bool transientSizeDynamic = false;
+  // Largest single transient allocation. Transient allocations are scoped to
+  // the submissions using them and this is the peak required at any one time
+  // when they are not overlapped.
+  int64_t peakTransientSize = 0;
   // TODO(benvanik): add fill/copy sizes (when possible).
   size_t fillCount = 0;
   size_t copyCount = 0;
@@ -116,6 +131,14 @@ struct Statistics {
 
   void analyze(const UsageInfo &usageInfo) {
     // Globals:
+    for (auto tryMapOp : usageInfo.tryMapOps) {
+      APInt mapSize;
+      if (matchPattern(tryMapOp.result_size(), m_ConstantInt(&mapSize))) {
+        constantSize += mapSize.getSExtValue();
+      } else {
+        constantSizeDynamic = true;
+      }
+    }
     for (auto it : usageInfo.resourceGlobalOps) {
       auto globalType = it.second.type().dyn_cast<IREE::Stream::ResourceType>();
       if (!globalType) continue;
@@ -141,6 +164,8 @@ struct Statistics {
       APInt allocaSize;
       if (matchPattern(allocaOp.storage_size(), m_ConstantInt(&allocaSize))) {
         transientSize += allocaSize.getSExtValue();
+        peakTransientSize =
+            std::max(peakTransientSize, allocaSize.getSExtValue());
       } else {
         transientSizeDynamic = true;
       }
@@ -148,6 +173,8 @@ struct Statistics {
     for (auto executeOp : usageInfo.executeOps) {
       executeOp.walk([&](Operation *op) {
         TypeSwitch<Operation *>(op)
+            .Case<IREE::Stream::CmdConcurrentOp>(
+                [&](auto op) { ++concurrentCount; })
             .Case<IREE::Stream::CmdFillOp>([&](auto op) { ++fillCount; })
             .Case<IREE::Stream::CmdCopyOp>([&](auto op) { ++copyCount; })
             .Case<IREE::Stream::CmdDispatchOp>(
@@ -160,6 +187,157 @@ struct Statistics {
   }
 };
 
+//===----------------------------------------------------------------------===//
+// Dispatch cost estimation
+//===----------------------------------------------------------------------===//
+
+// Returns the full shape of the dispatch tensor |value| is loaded from or
+// stored to. Returns an empty type if it is not directly tied to one (or is
+// rank-reduced and the dims can't be matched up).
+static IREE::Flow::DispatchTensorType getDispatchTensorTypeFor(
+    Value value, bool isResult) {
+  auto tensorType = value.getType().dyn_cast<RankedTensorType>();
+  if (!tensorType) return {};
+  IREE::Flow::DispatchTensorType dispatchType;
+  if (!isResult) {
+    auto loadOp = value.getDefiningOp<IREE::Flow::DispatchTensorLoadOp>();
+    if (!loadOp) return {};
+    dispatchType =
+        loadOp.source().getType().cast<IREE::Flow::DispatchTensorType>();
+  } else {
+    for (auto *user : value.getUsers()) {
+      if (auto storeOp = dyn_cast<IREE::Flow::DispatchTensorStoreOp>(user)) {
+        dispatchType =
+            storeOp.target().getType().cast<IREE::Flow::DispatchTensorType>();
+        break;
+      }
+    }
+    if (!dispatchType) return {};
+  }
+  if (dispatchType.getRank() != tensorType.getRank()) return {};
+  return dispatchType;
+}
+
+// Estimated arithmetic work of a single dispatch to an export.
+struct DispatchCost {
+  // Scalar arithmetic ops executed across all workgroups. Each op in a
+  // linalg payload counts as one operation per point in its iteration space.
+  int64_t flops = 0;
+  // True if some linalg op had an iteration space that could not be resolved
+  // in which case |flops| is a lower bound.
+  bool flopsDynamic = false;
+};
+
+// Estimates the arithmetic work performed by the dispatch function |funcOp|.
+// Dispatch regions have been distributed across workgroups by the time they
+// reach the stream dialect and the linalg ops only see a single tile. The
+// iteration space of the whole dispatch is recovered from the shapes of the
+// dispatch tensors the tiles are loaded from and stored to.
+static DispatchCost estimateDispatchCost(mlir::func::FuncOp funcOp) {
+  DispatchCost cost;
+  funcOp.walk([&](linalg::LinalgOp linalgOp) {
+    SmallVector<int64_t> loopRanges(linalgOp.getNumLoops(),
+                                    ShapedType::kDynamicSize);
+    for (auto *opOperand : linalgOp.getInputAndOutputOperands()) {
+      IREE::Flow::DispatchTensorType dispatchType;
+      unsigned operandIndex = opOperand->getOperandNumber();
+      if (operandIndex >= linalgOp.getNumInputs()) {
+        unsigned resultIndex = operandIndex - linalgOp.getNumInputs();
+        if (resultIndex >= linalgOp->getNumResults()) continue;
+        dispatchType = getDispatchTensorTypeFor(
+            linalgOp->getResult(resultIndex), /*isResult=*/true);
+      } else {
+        dispatchType =
+            getDispatchTensorTypeFor(opOperand->get(), /*isResult=*/false);
+      }
+      if (!dispatchType) continue;
+      auto indexingMap = linalgOp.getTiedIndexingMap(opOperand);
+      for (auto expr : llvm::enumerate(indexingMap.getResults())) {
+        auto dimExpr = expr.value().dyn_cast<AffineDimExpr>();
+        if (!dimExpr) continue;
+        int64_t dimSize = dispatchType.getDimSize(expr.index());
+        if (dimSize == ShapedType::kDynamicSize) continue;
+        loopRanges[dimExpr.getPosition()] = dimSize;
+      }
+    }
+    int64_t iterationCount = 1;
+    for (auto loopRange : loopRanges) {
+      if (loopRange == ShapedType::kDynamicSize) {
+        cost.flopsDynamic = true;
+        return;
+      }
+      iterationCount *= loopRange;
+    }
+    int64_t payloadOpCount = 0;
+    for (auto &block : linalgOp->getRegions().front()) {
+      auto payloadOps = block.without_terminator();
+      payloadOpCount += std::distance(payloadOps.begin(), payloadOps.end());
+    }
+    cost.flops += iterationCount * std::max<int64_t>(payloadOpCount, 1);
+  });
+  return cost;
+}
+
+// Aggregate cost of all dispatches to a single export.
+struct ExportCost {
+  size_t dispatchCount = 0;
+  int64_t flops = 0;
+  bool flopsDynamic = false;
+  // Bytes of binding ranges read and written by the dispatches. Ranges that
+  // are both read and written count towards both.
+  int64_t bytesRead = 0;
+  int64_t bytesWritten = 0;
+  bool bytesDynamic = false;
+
+  // Returns the ratio of estimated operations to bytes accessed.
+  double getArithmeticIntensity() const {
+    int64_t bytesTotal = bytesRead + bytesWritten;
+    return bytesTotal ? flops / (double)bytesTotal : 0.0;
+  }
+
+  void analyze(mlir::func::FuncOp funcOp,
+               ArrayRef<IREE::Stream::CmdDispatchOp> dispatchOps) {
+    auto dispatchCost = estimateDispatchCost(funcOp);
+    dispatchCount = dispatchOps.size();
+    flops = dispatchCost.flops * dispatchCount;
+    flopsDynamic = dispatchCost.flopsDynamic;
+    for (auto dispatchOp : dispatchOps) {
+      for (auto it : llvm::zip(dispatchOp.resource_lengths(),
+                               dispatchOp.resource_accesses())) {
+        APInt length;
+        if (!matchPattern(std::get<0>(it), m_ConstantInt(&length))) {
+          bytesDynamic = true;
+          continue;
+        }
+        auto access = std::get<1>(it)
+                          .cast<IREE::Stream::ResourceAccessBitfieldAttr>()
+                          .getValue();
+        if (bitEnumContains(access,
+                            IREE::Stream::ResourceAccessBitfield::Read)) {
+          bytesRead += length.getSExtValue();
+        }
+        if (bitEnumContains(access,
+                            IREE::Stream::ResourceAccessBitfield::Write)) {
+          bytesWritten += length.getSExtValue();
+        }
+      }
+    }
+  }
+};
+
+// Returns the aggregate cost of all dispatches to the export |funcOp|.
+static ExportCost analyzeExportCost(const UsageInfo &usageInfo,
+                                    mlir::func::FuncOp funcOp) {
+  ExportCost cost;
+  auto it = usageInfo.exportDispatchOps.find(funcOp);
+  if (it != usageInfo.exportDispatchOps.end()) {
+    cost.analyze(funcOp, it->second);
+  } else {
+    cost.analyze(funcOp, {});
+  }
+  return cost;
+}
+
 //===----------------------------------------------------------------------===//
 // Pretty printing
 //===----------------------------------------------------------------------===//
@@ -217,12 +395,19 @@ static void prettyPrintStatistics(const UsageInfo &usageInfo,
 
   os << llvm::formatv("//  D->H Syncs: {0}\n", stats.awaitCount);
 
+  os << llvm::formatv("// Partitioner: {0}\n", getPartitioningAlgorithmName());
+
   os << llvm::formatv("// Submissions: {0}, using cumulative ",
                       stats.submissionCount);
   os << llvm::formatv(
-      "{0}{1} B ({2:F2} MiB)\n", stats.transientSizeDynamic ? "minimum " : "",
+      "{0}{1} B ({2:F2} MiB), ", stats.transientSizeDynamic ? "minimum " : "",
       stats.transientSize, stats.transientSize / (1 * 1024 * 1024.0f));
+  os << llvm::formatv(
+      "peak {0}{1} B ({2:F2} MiB)\n",
+      stats.transientSizeDynamic ? "minimum " : "", stats.peakTransientSize,
+      stats.peakTransientSize / (1 * 1024 * 1024.0f));
 
+  os << llvm::formatv("//  Concurrent: {0} regions\n", stats.concurrentCount);
   os << llvm::formatv("//   DMA Fills: {0}\n", stats.fillCount);
   os << llvm::formatv("//  DMA Copies: {0}\n", stats.copyCount);
   os << llvm::formatv("//  Dispatches: {0}\n", stats.dispatchCount);
@@ -327,7 +512,16 @@ static void prettyPrintExecutableExportInfo(
   // TODO(benvanik): ask codegen team if they want anything like a list of
   // linalg named ops, etc.
 
-  os << "// TODO\n";
+  auto cost = analyzeExportCost(usageInfo, funcOp);
+  os << llvm::formatv("//      Dispatches: {0}\n", cost.dispatchCount);
+  os << llvm::formatv("// Estimated FLOPs: {0}{1}\n",
+                      cost.flopsDynamic ? "minimum " : "", cost.flops);
+  os << llvm::formatv("//      Bytes Read: {0}{1} B\n",
+                      cost.bytesDynamic ? "minimum " : "", cost.bytesRead);
+  os << llvm::formatv("//   Bytes Written: {0}{1} B\n",
+                      cost.bytesDynamic ? "minimum " : "", cost.bytesWritten);
+  os << llvm::formatv("//       Intensity: {0:F2} FLOP/B\n",
+                      cost.getArithmeticIntensity());
 }
 
 static void prettyPrintExecutableInfo(const UsageInfo &usageInfo,
@@ -379,7 +573,7 @@ static void dumpAggregateCSVTable(const UsageInfo &usageInfo,
   Statistics stats;
   stats.analyze(usageInfo);
 
-  os << R"("Constants","Constant Size","Variables","Variable Size","Awaits","Submissions","Transient Size","Fills","Copies","Dispatches","Executables")";
+  os << R"("Constants","Constant Size","Variables","Variable Size","Awaits","Submissions","Concurrent Regions","Transient Size","Peak Transient Size","Fills","Copies","Dispatches","Executables")";
   os << "\n";
 
   // Globals:
@@ -391,8 +585,9 @@ static void dumpAggregateCSVTable(const UsageInfo &usageInfo,
   os << llvm::formatv("{0},", stats.awaitCount);
 
   // Execution:
-  os << llvm::formatv("{0},{1},{2},{3},{4},", stats.submissionCount,
-                      stats.transientSize, stats.fillCount, stats.copyCount,
+  os << llvm::formatv("{0},{1},{2},{3},{4},{5},{6},", stats.submissionCount,
+                      stats.concurrentCount, stats.transientSize,
+                      stats.peakTransientSize, stats.fillCount, stats.copyCount,
                       stats.dispatchCount);
 
   // Executables:
@@ -508,8 +703,13 @@ static void dumpAggregateJSONStructure(const UsageInfo &usageInfo,
   os << "  },\n";
 
   os << "  \"execution\": {\n";
+  os << llvm::formatv("    \"{0}\": \"{1}\",\n", "partitioning-algorithm",
+                      getPartitioningAlgorithmName());
   os << llvm::formatv(kvPair, "submission-count", stats.submissionCount);
+  os << llvm::formatv(kvPair, "concurrent-count", stats.concurrentCount);
   os << llvm::formatv(kvPair, "transient-memory-size", stats.transientSize);
+  os << llvm::formatv(kvPair, "peak-transient-memory-size",
+                      stats.peakTransientSize);
   os << llvm::formatv(kvPair, "fill-count", stats.fillCount);
   os << llvm::formatv(kvPair, "copy-count", stats.copyCount);
   os << llvm::formatv(kvPairNoComma, "dispatch-count", stats.dispatchCount);
@@ -520,13 +720,50 @@ static void dumpAggregateJSONStructure(const UsageInfo &usageInfo,
   os << "  }\n";
 }
 
+static void dumpDispatchJSONStructures(const UsageInfo &usageInfo,
+                                       llvm::raw_fd_ostream &os) {
+  const char kvPair[] = "    \"{0}\": {1},\n";
+
+  bool isFirst = true;
+  for (auto it : usageInfo.executableOps) {
+    auto executableOp = it.second;
+    for (auto exportOp :
+         executableOp.getOps<IREE::Stream::ExecutableExportOp>()) {
+      auto funcOp = exportOp.getFunctionRef();
+      if (!funcOp) continue;
+      auto cost = analyzeExportCost(usageInfo, funcOp);
+      if (!isFirst) os << ",\n";
+      isFirst = false;
+      os << "  {\n";
+      os << llvm::formatv("    \"{0}\": \"@{1}::@{2}\",\n", "symbol",
+                          executableOp.getName(), exportOp.getName());
+      os << llvm::formatv(kvPair, "dispatch-count", cost.dispatchCount);
+      os << llvm::formatv(kvPair, "estimated-flops", cost.flops);
+      os << llvm::formatv(kvPair, "estimated-flops-dynamic",
+                          cost.flopsDynamic ? "true" : "false");
+      os << llvm::formatv(kvPair, "bytes-read", cost.bytesRead);
+      os << llvm::formatv(kvPair, "bytes-written", cost.bytesWritten);
+      os << llvm::formatv(kvPair, "bytes-dynamic",
+                          cost.bytesDynamic ? "true" : "false");
+      os << llvm::formatv("    \"{0}\": {1:F4}\n", "arithmetic-intensity",
+                          cost.getArithmeticIntensity());
+      os << "  }";
+    }
+  }
+  if (!isFirst) os << "\n";
+}
+
 static void dumpJSONStructures(const UsageInfo &usageInfo,
                                llvm::raw_fd_ostream &os) {
   os << "{\n";
 
   os << "\"stream-aggregate\": {\n";
   dumpAggregateJSONStructure(usageInfo, os);
-  os << "}\n";
+  os << "},\n";
+
+  os << "\"stream-dispatches\": [\n";
+  dumpDispatchJSONStructures(usageInfo, os);
+  os << "]\n";
 
   // TODO(antiagainst): dump per-execution data if needed.
 
@@ -423,6 +423,105 @@ static bool isSafeToElideCloneOp(IREE::Stream::AsyncCloneOp cloneOp,
   return false;
 }
 
+// Returns true if |operand| is used in-place by its owner.
+static bool isTiedUse(OpOperand &operand) {
+  if (auto tiedOp = dyn_cast<IREE::Util::TiedOpInterface>(operand.getOwner())) {
+    return tiedOp.isOperandTied(operand.getOperandNumber());
+  }
+  return false;
+}
+
+// Tries to sink the in-place consumer of |cloneOp| below all other users of the
+// clone source such that the clone becomes the last use and can be elided.
+// This handles updates that are ordered before reads of the original value
+// such as cache updates into globals:
+//   %0 = ...
+//   %1 = clone(%0)
+//   %2 = update(%x, %1)  // in-place
+//   %3 = read(%0)
+// ->
+//   %0 = ...
+//   %3 = read(%0)
+//   %1 = clone(%0)  // last use; elidable
+//   %2 = update(%x, %1)
+//
+// Only applies when the other users of the source are pure readers in the same
+// block and none of the ops being moved across depend on the consumer or
+// mutate any of its operands. Returns true if the IR was changed.
+static bool trySinkCloneConsumer(IREE::Stream::AsyncCloneOp cloneOp,
+                                 LastUseAnalysis &analysis) {
+  // Only useful if the clone could be elided once it was the last user.
+  auto source = cloneOp.source();
+  if (auto arg = source.dyn_cast<BlockArgument>()) {
+    if (!analysis.isArgMoved(arg)) return false;
+  }
+  auto sourceType = source.getType().cast<IREE::Stream::ResourceType>();
+  if (sourceType != cloneOp.result().getType() &&
+      sourceType.getLifetime() == IREE::Stream::Lifetime::Constant) {
+    return false;
+  }
+
+  // The clone must be consumed in-place by a single op in the same block.
+  if (!cloneOp.result().hasOneUse()) return false;
+  auto &consumerUse = *cloneOp.result().use_begin();
+  auto *consumerOp = consumerUse.getOwner();
+  auto *block = cloneOp->getBlock();
+  if (consumerOp->getBlock() != block || !isTiedUse(consumerUse) ||
+      consumerOp->hasTrait<OpTrait::IsTerminator>()) {
+    return false;
+  }
+
+  // Find the last of the other users of the source. They must all be readers
+  // we can move the consumer below.
+  Operation *lastUserOp = nullptr;
+  for (auto &use : source.getUses()) {
+    if (use.getOwner() == cloneOp) continue;
+    auto *userOp = block->findAncestorOpInBlock(*use.getOwner());
+    if (!userOp || userOp == consumerOp || isTiedUse(use) ||
+        isa<IREE::Stream::AsyncCloneOp>(userOp) ||
+        userOp->hasTrait<OpTrait::IsTerminator>()) {
+      return false;
+    }
+    if (!lastUserOp || lastUserOp->isBeforeInBlock(userOp)) {
+      lastUserOp = userOp;
+    }
+  }
+  if (!lastUserOp || lastUserOp->isBeforeInBlock(consumerOp)) return false;
+
+  // Ensure nothing between the consumer and the last user depends on the
+  // consumer results or mutates the consumer operands in-place.
+  for (auto *op = consumerOp->getNextNode(); op != lastUserOp->getNextNode();
+       op = op->getNextNode()) {
+    auto walkResult = op->walk([&](Operation *nestedOp) {
+      for (auto &operand : nestedOp->getOpOperands()) {
+        if (operand.get().getDefiningOp() == consumerOp ||
+            (isTiedUse(operand) &&
+             llvm::is_contained(consumerOp->getOperands(), operand.get()))) {
+          return WalkResult::interrupt();
+        }
+      }
+      return WalkResult::advance();
+    });
+    if (walkResult.wasInterrupted()) return false;
+  }
+  for (auto result : consumerOp->getResults()) {
+    for (auto *user : result.getUsers()) {
+      auto *userOp = block->findAncestorOpInBlock(*user);
+      if (!userOp || !lastUserOp->isBeforeInBlock(userOp)) return false;
+    }
+  }
+
+  LLVM_DEBUG({
+    llvm::dbgs() << "  + sinking clone consumer below last reader: ";
+    consumerOp->print(llvm::dbgs(),
+                      OpPrintingFlags().elideLargeElementsAttrs());
+    llvm::dbgs() << "\n";
+  });
+  consumerOp->moveAfter(lastUserOp);
+  cloneOp->moveBefore(consumerOp);
+  return true;
+}
+
 // Tries to elide |cloneOp| by replacing all uses with its source if safe.
 // Returns true if the op was elided.
 static bool tryElideCloneOp(IREE::Stream::AsyncCloneOp cloneOp,
@@ -441,7 +540,12 @@ static bool tryElideAsyncCopiesInRegion(Region &region,
   for (auto &block : region) {
     for (auto cloneOp : llvm::make_early_inc_range(
              block.getOps<IREE::Stream::AsyncCloneOp>())) {
-      if (!isSafeToElideCloneOp(cloneOp, analysis)) continue;
+      if (!isSafeToElideCloneOp(cloneOp, analysis)) {
+        // Reordering invalidates the analysis so we need to rerun it before
+        // eliding anything else.
+        if (trySinkCloneConsumer(cloneOp, analysis)) return true;
+        continue;
+      }
       cloneOp.replaceAllUsesWith(cloneOp.source());
       cloneOp.erase();
       didChange = true;
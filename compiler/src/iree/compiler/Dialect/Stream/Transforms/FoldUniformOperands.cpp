@@ -246,6 +246,167 @@ static void inlineUniformConstants(
       [&](BlockArgument arg) { return deadArgMap.test(arg.getArgNumber()); });
 }
 
+// Rebases constant operands that differ from an earlier operand by the same
+// amount at all dispatch sites. This is common with the offsets produced by
+// binding fusion where a dispatch receives several subranges of the same
+// resource: only the base offset needs to be passed at runtime and the
+// relative offsets can be inlined.
+//
+// Example:
+//   stream.cmd.dispatch @foo(%c100, %c200 : index, index)
+//   stream.cmd.dispatch @foo(%c300, %c400 : index, index)
+// ->
+//   stream.cmd.dispatch @foo(%c100 : index)
+//   stream.cmd.dispatch @foo(%c300 : index)
+// + inlined %arg0 + 100 for %arg1 in the executable
+static void rebaseCorrelatedConstants(
+    mlir::func::FuncOp funcOp,
+    SmallVector<IREE::Stream::CmdDispatchOp> &dispatchOps) {
+  auto &entryBlock = funcOp.front();
+  auto anyDispatchOp = dispatchOps.front();
+  unsigned operandCount = anyDispatchOp.operands().size();
+
+  // Gather the constant values of each operand at every dispatch site.
+  // Operands that are dynamic at any site can't be rebased.
+  SmallVector<SmallVector<APInt>> operandValues(operandCount);
+  llvm::BitVector constantOperandMap(operandCount, /*t=*/true);
+  for (unsigned idx = 0; idx < operandCount; ++idx) {
+    if (!anyDispatchOp.operands()[idx].getType().isIntOrIndex()) {
+      constantOperandMap.reset(idx);
+      continue;
+    }
+    for (auto dispatchOp : dispatchOps) {
+      APInt intValue;
+      if (!matchPattern(dispatchOp.operands()[idx],
+                        m_ConstantInt(&intValue))) {
+        constantOperandMap.reset(idx);
+        break;
+      }
+      operandValues[idx].push_back(intValue);
+    }
+  }
+
+  // For each constant operand find an earlier base operand of the same type
+  // that it is at a uniform delta from at all sites.
+  SmallVector<Optional<std::pair<unsigned, APInt>>> rebasedOperands(
+      operandCount);
+  llvm::BitVector rebasedOperandMap(operandCount);
+  for (auto idx : constantOperandMap.set_bits()) {
+    auto type = anyDispatchOp.operands()[idx].getType();
+    for (auto baseIdx : constantOperandMap.set_bits()) {
+      if (baseIdx >= idx) break;
+      if (rebasedOperandMap.test(baseIdx)) continue;
+      if (anyDispatchOp.operands()[baseIdx].getType() != type) continue;
+      APInt delta = operandValues[idx][0] - operandValues[baseIdx][0];
+      bool isUniform = true;
+      for (unsigned site = 1; site < dispatchOps.size(); ++site) {
+        if (operandValues[idx][site] - operandValues[baseIdx][site] != delta) {
+          isUniform = false;
+          break;
+        }
+      }
+      if (!isUniform) continue;
+      rebasedOperands[idx] = std::make_pair(baseIdx, delta);
+      rebasedOperandMap.set(idx);
+      break;
+    }
+  }
+  if (rebasedOperandMap.none()) {
+    // Early-exit if no-op.
+    return;
+  }
+
+  LLVM_DEBUG({
+    llvm::dbgs() << "rebaseCorrelatedConstants for " << funcOp.getSymName()
+                 << "\n";
+    for (auto idx : rebasedOperandMap.set_bits()) {
+      llvm::dbgs() << "  operand " << idx << " = operand "
+                   << rebasedOperands[idx]->first << " + "
+                   << rebasedOperands[idx]->second << "\n";
+    }
+  });
+
+  auto operandToArgMap =
+      IREE::Stream::CmdDispatchOp::makeOperandToArgMap(funcOp);
+
+  // Replace uses of the rebased arguments with an addition to their base.
+  llvm::BitVector deadArgMap(funcOp.getNumArguments());
+  auto builder = OpBuilder::atBlockBegin(&entryBlock);
+  for (auto operandIdx : rebasedOperandMap.set_bits()) {
+    unsigned argIdx = operandToArgMap[operandIdx];
+    auto arg = entryBlock.getArgument(argIdx);
+    auto &rebase = rebasedOperands[operandIdx].getValue();
+    auto baseArg = entryBlock.getArgument(operandToArgMap[rebase.first]);
+    deadArgMap.set(argIdx);
+    auto deltaOp = builder.create<arith::ConstantOp>(
+        arg.getLoc(), builder.getIntegerAttr(arg.getType(), rebase.second));
+    auto addOp = builder.create<arith::AddIOp>(arg.getLoc(), baseArg, deltaOp);
+    arg.replaceAllUsesWith(addOp);
+  }
+
+  // Update each dispatch site to remove the rebased operands.
+  SmallVector<unsigned> deadOperands;
+  for (auto idx : rebasedOperandMap.set_bits()) deadOperands.push_back(idx);
+  for (auto dispatchOp : dispatchOps) {
+    for (auto idx : llvm::reverse(deadOperands)) {
+      dispatchOp.operandsMutable().erase(idx);
+    }
+  }
+
+  // Fixup function signature.
+  funcOp.setType(funcOp.getTypeWithoutArgsAndResults(deadArgMap, {}));
+  entryBlock.eraseArguments(
+      [&](BlockArgument arg) { return deadArgMap.test(arg.getArgNumber()); });
+}
+
+// Drops operands that are not used within the executable. Each operand is
+// uploaded on every dispatch (as push constants or uniform buffer contents)
+// and unused ones are pure overhead.
+//
+// Example:
+//   stream.cmd.dispatch @foo(%c100, %0 : index, index)
+// ->
+//   stream.cmd.dispatch @foo(%0 : index)
+// + %arg0 unused in the executable
+static void deleteUnusedOperands(
+    mlir::func::FuncOp funcOp,
+    SmallVector<IREE::Stream::CmdDispatchOp> &dispatchOps) {
+  auto &entryBlock = funcOp.front();
+  auto operandToArgMap =
+      IREE::Stream::CmdDispatchOp::makeOperandToArgMap(funcOp);
+
+  llvm::BitVector deadArgMap(funcOp.getNumArguments());
+  SmallVector<unsigned> deadOperands;
+  for (auto it : llvm::enumerate(operandToArgMap)) {
+    if (!entryBlock.getArgument(it.value()).use_empty()) continue;
+    deadArgMap.set(it.value());
+    deadOperands.push_back(it.index());
+  }
+  if (deadOperands.empty()) {
+    // Early-exit if no-op.
+    return;
+  }
+
+  LLVM_DEBUG({
+    llvm::dbgs() << "deleteUnusedOperands for " << funcOp.getSymName() << "\n";
+    llvm::dbgs() << "  dead operands: ";
+    llvm::interleaveComma(deadOperands, llvm::dbgs());
+    llvm::dbgs() << "\n";
+  });
+
+  // Update each dispatch site to remove the unused operands.
+  for (auto dispatchOp : dispatchOps) {
+    for (auto idx : llvm::reverse(deadOperands)) {
+      dispatchOp.operandsMutable().erase(idx);
+    }
+  }
+
+  // Fixup function signature.
+  funcOp.setType(funcOp.getTypeWithoutArgsAndResults(deadArgMap, {}));
+  entryBlock.eraseArguments(
+      [&](BlockArgument arg) { return deadArgMap.test(arg.getArgNumber()); });
+}
+
 //===----------------------------------------------------------------------===//
 // -iree-stream-specialize-dispatches
 //===----------------------------------------------------------------------===//
@@ -289,6 +450,13 @@ class FoldUniformOperandsPass
 
         // Inline constants that have the same value at all sites.
         inlineUniformConstants(funcOp, dispatchOps);
+
+        // Pass only base values for constants that correlate at all sites.
+        rebaseCorrelatedConstants(funcOp, dispatchOps);
+
+        // Remove any operands the executable doesn't use (including those
+        // that the folding above left unused).
+        deleteUnusedOperands(funcOp, dispatchOps);
       }
     }
   }
@@ -369,10 +369,8 @@ static void fuseDispatchBindings(
     }
   });
 
-  // TODO(benvanik): some special handling for finding least-common-denominator
-  // or base values for constants passed in. We can end up with a lot of
-  // subranges into transient or constant resources that are all relatively
-  // correlated:
+  // NOTE: we can end up with a lot of subranges into transient or constant
+  // resources that are all relatively correlated:
   //   operand[0]: @storage0: offset 100
   //   operand[1]: @storage0: offset 200
   //   operand[2]: @storage0: offset 300
@@ -380,12 +378,9 @@ static void fuseDispatchBindings(
   //   operand[0]: @storage0: offset +0
   //   operand[1]: @storage0: offset +100
   //   operand[2]: @storage0: offset +200
-  // Identifying these and using those relative offsets would make it cheaper to
-  // inline the values into the executables as they are not dispatch site
-  // specific. We'd do this by going per range and finding uniformly constant
-  // values. See the old MaterializeInterfaces.cpp pass for an earlier
-  // implementation that was special-cased for constant buffers only: here we
-  // can do it for everything.
+  // We pass all offsets as operands here and rely on FoldUniformOperands to
+  // rebase those that are uniformly correlated across all dispatch sites such
+  // that only the base offset is passed at runtime.
 
   // Update the executable function to use the new bindings.
   auto funcOp = exportOp.getFunctionRef();
@@ -0,0 +1,187 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/compiler/Dialect/Stream/IR/StreamDialect.h"
+#include "iree/compiler/Dialect/Stream/IR/StreamOps.h"
+#include "iree/compiler/Dialect/Stream/Transforms/PassDetail.h"
+#include "iree/compiler/Dialect/Stream/Transforms/Passes.h"
+#include "iree/compiler/Dialect/Util/IR/UtilDialect.h"
+#include "iree/compiler/Dialect/Util/IR/UtilOps.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/BuiltinTypes.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/Pass/Pass.h"
+
+#define DEBUG_TYPE "iree-stream-hoist-transients"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace Stream {
+namespace {
+
+// A stream-ordered transient allocation with a static size that can be served
+// from a pool allocated once at program load.
+struct TransientSite {
+  IREE::Stream::ResourceAllocaOp allocaOp;
+  IREE::Stream::ResourceDeallocaOp deallocaOp;
+  int64_t storageSize;
+};
+
+// Returns the dealloca releasing |allocaOp| if the allocation only lives for
+// the duration of the execution regions in its block such as those produced by
+// the ScheduleAllocation pass:
+//   %t, %t_ready = stream.resource.alloca await(%a) => ...
+//   %done = stream.cmd.execute await(%t_ready) with(%t as ...) {...}
+//   %released = stream.resource.dealloca await(%done) => %t ...
+static IREE::Stream::ResourceDeallocaOp findTransientDealloca(
+    IREE::Stream::ResourceAllocaOp allocaOp) {
+  auto *block = allocaOp->getBlock();
+  IREE::Stream::ResourceDeallocaOp deallocaOp;
+  for (auto *user : allocaOp.result().getUsers()) {
+    if (user->getBlock() != block) return {};
+    if (auto userOp = dyn_cast<IREE::Stream::ResourceDeallocaOp>(user)) {
+      if (deallocaOp) return {};
+      deallocaOp = userOp;
+    } else if (!isa<IREE::Stream::CmdExecuteOp>(user)) {
+      // Escapes to something we don't know the lifetime of (calls, etc).
+      return {};
+    }
+  }
+  if (!deallocaOp || !deallocaOp.await_timepoint()) return {};
+  for (auto *user : allocaOp.result().getUsers()) {
+    if (user != deallocaOp && !user->isBeforeInBlock(deallocaOp)) return {};
+  }
+  return deallocaOp;
+}
+
+// Returns all transient allocations in |callableOp| that can be pooled.
+static SmallVector<TransientSite> findTransientSites(
+    CallableOpInterface callableOp) {
+  SmallVector<TransientSite> sites;
+  auto *region = callableOp.getCallableRegion();
+  if (!region) return sites;
+  region->walk([&](IREE::Stream::ResourceAllocaOp allocaOp) {
+    APInt storageSize;
+    if (!matchPattern(allocaOp.storage_size(), m_ConstantInt(&storageSize))) {
+      return;  // dynamically sized
+    }
+    auto deallocaOp = findTransientDealloca(allocaOp);
+    if (!deallocaOp) return;
+    sites.push_back({allocaOp, deallocaOp, storageSize.getSExtValue()});
+  });
+  return sites;
+}
+
+// Replaces the alloca/dealloca pair of |site| with a pool global allocated in
+// an initializer inserted prior to |callableOp|. The pool is guarded by a
+// timepoint global that each use waits on before execution and advances to
+// the point the transient would have been deallocated.
+static void hoistTransientSite(TransientSite &site, Operation *callableOp,
+                               SymbolTable &moduleSymbols) {
+  auto allocaOp = site.allocaOp;
+  auto deallocaOp = site.deallocaOp;
+  auto loc = allocaOp.getLoc();
+  auto resourceType = allocaOp.result().getType();
+  auto timepointType = allocaOp.result_timepoint().getType();
+
+  OpBuilder moduleBuilder(callableOp);
+  auto poolOp = moduleBuilder.create<IREE::Util::GlobalOp>(
+      loc, "_transient_pool", /*isMutable=*/false, resourceType);
+  poolOp.setPrivate();
+  moduleSymbols.insert(poolOp);  // uniques name
+  auto timepointOp = moduleBuilder.create<IREE::Util::GlobalOp>(
+      loc, (poolOp.getName() + "__timepoint").str(), /*isMutable=*/true,
+      timepointType,
+      IREE::Stream::TimepointAttr::get(moduleBuilder.getContext(),
+                                       timepointType));
+  timepointOp.setPrivate();
+  moduleSymbols.insert(timepointOp);
+
+  // Allocate the pool once at program load.
+  auto initializerOp = moduleBuilder.create<IREE::Util::InitializerOp>(loc);
+  auto initializerBuilder =
+      OpBuilder::atBlockBegin(initializerOp.addEntryBlock());
+  auto storageSize = initializerBuilder.create<arith::ConstantIndexOp>(
+      loc, site.storageSize);
+  auto allocOp = initializerBuilder.create<IREE::Stream::ResourceAllocOp>(
+      loc, resourceType, storageSize.getResult(),
+      /*uninitialized=*/initializerBuilder.getUnitAttr(),
+      allocaOp.affinityAttr());
+  initializerBuilder.create<IREE::Util::GlobalStoreOp>(
+      loc, allocOp.results().front(), poolOp.getSymbolName());
+  initializerBuilder.create<IREE::Util::InitializerReturnOp>(loc);
+
+  // Wait for the prior use of the pool (if any) along with whatever the
+  // allocation was waiting on.
+  OpBuilder builder(allocaOp);
+  auto poolValue = builder.create<IREE::Util::GlobalLoadOp>(loc, poolOp);
+  Value readyTimepoint =
+      builder.create<IREE::Util::GlobalLoadOp>(loc, timepointOp).result();
+  if (auto awaitTimepoint = allocaOp.await_timepoint()) {
+    readyTimepoint = builder.create<IREE::Stream::TimepointJoinOp>(
+        loc, timepointType, ValueRange{awaitTimepoint, readyTimepoint});
+  }
+  allocaOp.result().replaceAllUsesWith(poolValue.result());
+  allocaOp.result_timepoint().replaceAllUsesWith(readyTimepoint);
+  allocaOp.erase();
+
+  // The next use of the pool waits on whatever the dealloca would have.
+  builder.setInsertionPoint(deallocaOp);
+  auto releaseTimepoint = deallocaOp.await_timepoint();
+  builder.create<IREE::Util::GlobalStoreOp>(deallocaOp.getLoc(),
+                                            releaseTimepoint,
+                                            timepointOp.getSymbolName());
+  deallocaOp.result_timepoint().replaceAllUsesWith(releaseTimepoint);
+  deallocaOp.erase();
+}
+
+//===----------------------------------------------------------------------===//
+// -iree-stream-hoist-transients
+//===----------------------------------------------------------------------===//
+
+class HoistTransientsPass : public HoistTransientsBase<HoistTransientsPass> {
+ public:
+  HoistTransientsPass() = default;
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<mlir::arith::ArithmeticDialect>();
+    registry.insert<IREE::Stream::StreamDialect>();
+    registry.insert<IREE::Util::UtilDialect>();
+  }
+
+  void runOnOperation() override {
+    auto moduleOp = getOperation();
+    if (moduleOp.getBody()->empty()) return;
+
+    SymbolTable moduleSymbols(moduleOp);
+    for (auto callableOp :
+         llvm::make_early_inc_range(moduleOp.getOps<CallableOpInterface>())) {
+      // Initializers only run once and gain nothing from pooling.
+      if (isa<IREE::Util::InitializerOp>(callableOp.getOperation())) continue;
+      for (auto &site : findTransientSites(callableOp)) {
+        LLVM_DEBUG(llvm::dbgs() << "hoisting transient of " << site.storageSize
+                                << "B: " << site.allocaOp << "\n");
+        hoistTransientSite(site, callableOp.getOperation(), moduleSymbols);
+      }
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<OperationPass<mlir::ModuleOp>> createHoistTransientsPass() {
+  return std::make_unique<HoistTransientsPass>();
+}
+
+}  // namespace Stream
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -5,6 +5,7 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include <list>
+#include <numeric>
 
 #include "iree/compiler/Dialect/Stream/IR/StreamDialect.h"
 #include "iree/compiler/Dialect/Stream/IR/StreamOps.h"
@@ -15,6 +16,7 @@
 #include "iree/compiler/Dialect/Util/IR/UtilOps.h"
 #include "iree/compiler/Dialect/Util/IR/UtilTypes.h"
 #include "iree/compiler/Utils/IndexSet.h"
+#include "llvm/ADT/BitVector.h"
 #include "llvm/Support/Debug.h"
 #include "mlir/Dialect/Arithmetic/IR/Arithmetic.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
@@ -63,31 +65,30 @@ static Value packSlicesWithNoAliasing(
   return builder.createOrFold<IREE::Util::AlignOp>(loc, offset, rangeAlignment);
 }
 
-// Packs a set of statically-sized slices by greedy strip packing.
+// Static offset assignment for a set of statically-sized slices.
+struct StaticLayout {
+  // Offset of each slice relative to the base offset in slice order.
+  SmallVector<int64_t> offsets;
+  // Size of each slice aligned to the range alignment in slice order.
+  SmallVector<int64_t> sizes;
+  // Total size required by all slices without the trailing range alignment.
+  int64_t highwaterMark = 0;
+};
+
+// Assigns offsets to a set of statically-sized slices by greedy strip packing.
+// Slices are visited in the given |order| and placed in the smallest gap
+// between reservations with overlapping lifetimes that they fit in.
 //
-// This is the same algorithm used in tflite here:
+// When |order| is the original lifetime order this is the same algorithm used
+// in tflite here:
 // https://github.com/tensorflow/tensorflow/blob/master/tensorflow/lite/simple_memory_arena.cc
 // It's not fantastic and can end up with a significant amount of wastage.
 // They do the packing at runtime and as such care more about performance than
-// we do while doing the packing here offline. For this initial version I
-// wanted to ensure we matched apples/apples their implementation.
-//
-// We should use a set of heuristics and pick the smallest one. There are also
-// some really great papers that have approximations (as all of these are -
-// 2D strip packing is NP-hard) such as
-// https://www.sciencedirect.com/science/article/pii/S0925772113001016 that
-// someone with a brain able to parse mathy papers can try implementing.
-//
-// Slice packed offset SSA values will be updated and start at the given
-// |baseOffset|. Returns |baseOffset| + the total size of the allocation
-// aligned to the requirements of |resourceConfig|.
-static Value packStaticSlicesGreedily(
-    IREE::Stream::ResourcePackOp packOp, Value baseOffset,
-    ArrayRef<Slice> slices, IREE::Stream::ResourceConfigAttr resourceConfig,
-    IndexSet &indexSet, OpBuilder &builder) {
-  int64_t offsetAlignment = resourceConfig.getMinBufferOffsetAlignment();
-  int64_t rangeAlignment = resourceConfig.getMinBufferRangeAlignment();
-
+// we do while doing the packing here offline.
+static StaticLayout layoutStaticSlicesGreedily(ArrayRef<Slice> slices,
+                                               ArrayRef<int64_t> sizes,
+                                               ArrayRef<unsigned> order,
+                                               int64_t offsetAlignment) {
   struct Reservation {
     const Slice *slice = nullptr;
     int64_t staticOffset = 0;
@@ -95,14 +96,16 @@ static Value packStaticSlicesGreedily(
   };
   static constexpr int64_t UNASSIGNED = INT64_MAX;
 
+  StaticLayout layout;
+  layout.offsets.resize(slices.size(), 0);
+  layout.sizes.assign(sizes.begin(), sizes.end());
+
   std::list<Reservation> reservations;
-  int64_t highwaterMark = 0;
-  for (auto &slice : slices) {
+  for (unsigned sliceIndex : order) {
+    const Slice &slice = slices[sliceIndex];
+    int64_t alignedSize = sizes[sliceIndex];
     int64_t bestOffset = UNASSIGNED;
     int64_t bestOffsetFit = UNASSIGNED;
-    int64_t staticSize =
-        cast<arith::ConstantIndexOp>(slice.dynamicSize.getDefiningOp()).value();
-    int64_t alignedSize = IREE::Util::align(staticSize, rangeAlignment);
 
     // Iterate through reservations (sorted by ascending offset) and identify
     // gaps in which the slice will fit. To reduce wastage we want to find the
@@ -121,7 +124,7 @@ static Value packStaticSlicesGreedily(
       if (alignedOffset + alignedSize <= reservation.staticOffset &&
           reservation.staticOffset - alignedOffset < bestOffsetFit) {
         bestOffset = alignedOffset;
-        bestOffsetFit = reservation.staticOffset - currentOffset;
+        bestOffsetFit = reservation.staticOffset - alignedOffset;
       }
       currentOffset = std::max(
           currentOffset, reservation.staticOffset + reservation.staticSize);
@@ -141,41 +144,113 @@ static Value packStaticSlicesGreedily(
       ++insertionIt;
     }
     reservations.insert(insertionIt, reservation);
-    slice.packedOffset.replaceAllUsesWith(builder.createOrFold<arith::AddIOp>(
-        packOp.getLoc(), baseOffset, indexSet.get(bestOffset)));
+    layout.offsets[sliceIndex] = bestOffset;
 
     // Update highwater mark indicating how much memory needs to be allocated
     // for the entire slab.
-    highwaterMark = std::max(highwaterMark, bestOffset + alignedSize);
+    layout.highwaterMark =
+        std::max(layout.highwaterMark, bestOffset + alignedSize);
   }
+  return layout;
+}
+
+// Computes a static layout for a set of statically-sized slices.
+//
+// 2D strip packing is NP-hard and no single greedy visitation order is best
+// for all inputs so we try a few heuristics and pick the smallest. There are
+// also some really great papers that have approximations such as
+// https://www.sciencedirect.com/science/article/pii/S0925772113001016 that
+// someone with a brain able to parse mathy papers can try implementing.
+static StaticLayout computeStaticLayout(
+    ArrayRef<Slice> slices, IREE::Stream::ResourceConfigAttr resourceConfig) {
+  int64_t offsetAlignment = resourceConfig.getMinBufferOffsetAlignment();
+  int64_t rangeAlignment = resourceConfig.getMinBufferRangeAlignment();
 
-  highwaterMark = IREE::Util::align(highwaterMark, rangeAlignment);
+  SmallVector<int64_t> sizes;
+  sizes.reserve(slices.size());
+  for (auto &slice : slices) {
+    int64_t staticSize =
+        cast<arith::ConstantIndexOp>(slice.dynamicSize.getDefiningOp()).value();
+    sizes.push_back(IREE::Util::align(staticSize, rangeAlignment));
+  }
+
+  // Slices in ascending lifetime order as they are defined in the program.
+  SmallVector<unsigned> lifetimeOrder(slices.size());
+  std::iota(lifetimeOrder.begin(), lifetimeOrder.end(), 0);
+  StaticLayout lifetimeLayout = layoutStaticSlicesGreedily(
+      slices, sizes, lifetimeOrder, offsetAlignment);
+
+  // Greedy by size: placing the largest slices first leaves the smaller ones
+  // to fill the gaps between them. This is usually much better when there are
+  // a few large long-lived slices surrounded by short-lived temporaries.
+  SmallVector<unsigned> sizeOrder = lifetimeOrder;
+  std::stable_sort(sizeOrder.begin(), sizeOrder.end(),
+                   [&](unsigned lhs, unsigned rhs) {
+                     return sizes[lhs] > sizes[rhs];
+                   });
+  StaticLayout sizeLayout =
+      layoutStaticSlicesGreedily(slices, sizes, sizeOrder, offsetAlignment);
+
+  LLVM_DEBUG(llvm::dbgs() << "static layout of " << slices.size()
+                          << " slices: lifetime order "
+                          << lifetimeLayout.highwaterMark << "b, size order "
+                          << sizeLayout.highwaterMark << "b\n");
+  if (sizeLayout.highwaterMark < lifetimeLayout.highwaterMark) {
+    return sizeLayout;
+  }
+  return lifetimeLayout;
+}
+
+// Packs a set of statically-sized slices using the precomputed |layout|.
+//
+// Slice packed offset SSA values will be updated and start at the given
+// |baseOffset|. Returns |baseOffset| + the total size of the allocation
+// aligned to the requirements of |resourceConfig|.
+static Value packStaticSlicesGreedily(
+    IREE::Stream::ResourcePackOp packOp, Value baseOffset,
+    ArrayRef<Slice> slices, const StaticLayout &layout,
+    IREE::Stream::ResourceConfigAttr resourceConfig, IndexSet &indexSet,
+    OpBuilder &builder) {
+  int64_t rangeAlignment = resourceConfig.getMinBufferRangeAlignment();
+  for (auto it : llvm::enumerate(slices)) {
+    it.value().packedOffset.replaceAllUsesWith(
+        builder.createOrFold<arith::AddIOp>(
+            packOp.getLoc(), baseOffset,
+            indexSet.get(layout.offsets[it.index()])));
+  }
+  int64_t highwaterMark =
+      IREE::Util::align(layout.highwaterMark, rangeAlignment);
   return builder.createOrFold<arith::AddIOp>(packOp.getLoc(), baseOffset,
                                              indexSet.get(highwaterMark));
 }
 
 // Packs a set of dynamically-sized slices based on the structural information
 // in the IR. Only slices that have the exact same size will be allowed to
-// alias.
+// alias each other.
+//
+// Dynamic slices may alias the statically packed slices in |staticSlices| (as
+// laid out by |staticLayout|) when their lifetimes do not overlap: each bin of
+// dynamic slices starts above only those static and dynamic reservations it
+// is live at the same time as. As the dynamic sizes are unknown the offsets
+// are computed at runtime as the maximum of the ends of those reservations.
 //
 // We can improve this if we know which sizes are larger/smaller relative to
 // others as then we can do things like reuse an allocation bucket with
 // non-overlapping lifetimes if the thing we are trying to pack in it is
 // definitely <=. If we end up knowing that certain sizes are less than some
-// absolute value then we could also alias with static allocations like if %sz
-// is known less than 1000b it could reuse any static allocation >= 1000b.
-//
-// We could also emit code for efficient runtime bucketing by providing the
-// sorted, compacted, delta-coded lifetime intervals and runtime-computed
-// sizes if we wanted to produce the smallest buffers.
+// absolute value then we could also place them in gaps within the static
+// allocations like if %sz is known less than 1000b it could reuse any static
+// allocation >= 1000b.
 //
 // Slice packed offset SSA values will be updated and start at the given
 // |baseOffset|. Returns |baseOffset| + the total size of the allocation
 // aligned to the requirements of |resourceConfig|.
 static Value packDynamicSlicesConservatively(
     IREE::Stream::ResourcePackOp packOp, Value baseOffset,
-    ArrayRef<Slice> slices, IREE::Stream::ResourceConfigAttr resourceConfig,
-    IndexSet &indexSet, OpBuilder &builder) {
+    ArrayRef<Slice> slices, ArrayRef<Slice> staticSlices,
+    const StaticLayout &staticLayout,
+    IREE::Stream::ResourceConfigAttr resourceConfig, IndexSet &indexSet,
+    OpBuilder &builder) {
   auto loc = packOp.getLoc();
   int64_t offsetAlignment = resourceConfig.getMinBufferOffsetAlignment();
   int64_t rangeAlignment = resourceConfig.getMinBufferRangeAlignment();
@@ -187,56 +262,142 @@ static Value packDynamicSlicesConservatively(
     slicesBySize[slice.dynamicSize].push_back(&slice);
   }
 
-  // Allocate each bucket while observing the lifetime of the slices within.
-  // Two or more slices may overlap in lifetime and need their own unique
-  // reservation.
-  Value offset = baseOffset;
+  // A set of same-sized slices with non-overlapping lifetimes that share a
+  // single reservation.
+  struct Bin {
+    Value size;
+    SmallVector<const Slice *> slices;
+    bool intersects(const Slice &slice) const {
+      for (auto *binSlice : slices) {
+        if (binSlice->intersects(slice)) return true;
+      }
+      return false;
+    }
+    bool intersects(const Bin &bin) const {
+      for (auto *binSlice : bin.slices) {
+        if (intersects(*binSlice)) return true;
+      }
+      return false;
+    }
+
+    // Assigned offset and the aligned end of the reservation.
+    Value offset;
+    Value end;
+    // A static offset (relative to the base offset) the bin is known to start
+    // at or above.
+    int64_t staticFloor = 0;
+    // Bins whose reservations are known to end at or before this bin starts.
+    llvm::BitVector below;
+  };
+
+  // Bin the slices by those that do not overlap. All of the allocations in
+  // each bin can alias. Binning happens before any placement so that the
+  // lifetime of each bin is fully known when checking for intersections.
+  // NOTE: O(n^2) in the worst case but there's usually only a small number
+  // of bins (<10) as we have already bucketed by size class. We could do
+  // some sorting and make this O(nlogn) or O(logn) with some interval tree
+  // magic.
+  SmallVector<Bin> bins;
   for (auto &sizeBucket : slicesBySize) {
     auto sliceSize = builder.createOrFold<IREE::Util::AlignOp>(
         loc, sizeBucket.first, rangeAlignment);
-    auto &slices = sizeBucket.second;
-    std::stable_sort(slices.begin(), slices.end());
-
-    // Bin the slices by those that do not overlap. All of the allocations in
-    // each bin can alias.
-    // NOTE: O(n^2) in the worst case but there's usually only a small number
-    // of bins (<10) as we have already bucketed by size class. We could do
-    // some sorting and make this O(nlogn) or O(logn) with some interval tree
-    // magic.
-    struct Bin {
-      Value offset;
-      SmallVector<const Slice *> slices;
-      bool intersects(const Slice &slice) const {
-        for (auto *binSlice : slices) {
-          if (binSlice->intersects(slice)) return true;
-        }
-        return false;
-      }
-    };
-    SmallVector<Bin> bins;
-    for (auto *slice : slices) {
+    auto &bucketSlices = sizeBucket.second;
+    std::stable_sort(bucketSlices.begin(), bucketSlices.end());
+    size_t firstBin = bins.size();
+    for (auto *slice : bucketSlices) {
       // Try to find a bin we can reuse (non-intersecting lifetime).
       Bin *targetBin = nullptr;
-      for (auto &bin : bins) {
-        if (!bin.intersects(*slice)) {
-          targetBin = &bin;
+      for (size_t i = firstBin; i < bins.size(); ++i) {
+        if (!bins[i].intersects(*slice)) {
+          targetBin = &bins[i];
           break;
         }
       }
       if (!targetBin) {
         // Allocate a new bin for this slice.
-        bins.push_back({offset, {}});
+        bins.emplace_back();
         targetBin = &bins.back();
-        auto binSize =
-            builder.createOrFold<arith::AddIOp>(loc, offset, sliceSize);
-        offset = builder.createOrFold<IREE::Util::AlignOp>(loc, binSize,
-                                                           offsetAlignment);
+        targetBin->size = sliceSize;
       }
       targetBin->slices.push_back(slice);
-      slice->packedOffset.replaceAllUsesWith(targetBin->offset);
     }
   }
 
+  // Place each bin above all static reservations and prior bins that it is
+  // live at the same time as. We track which reservations are transitively
+  // below each bin so that we don't emit redundant max operations.
+  for (size_t i = 0; i < bins.size(); ++i) {
+    Bin &bin = bins[i];
+    bin.below.resize(bins.size());
+
+    int64_t staticFloor = 0;
+    for (auto it : llvm::enumerate(staticSlices)) {
+      if (bin.intersects(it.value())) {
+        staticFloor = std::max(staticFloor, staticLayout.offsets[it.index()] +
+                                                staticLayout.sizes[it.index()]);
+      }
+    }
+    staticFloor = IREE::Util::align(staticFloor, offsetAlignment);
+
+    SmallVector<size_t> intersectingBins;
+    for (size_t j = 0; j < i; ++j) {
+      if (bins[j].intersects(bin)) intersectingBins.push_back(j);
+    }
+    bool needsStaticFloor = true;
+    SmallVector<Value> lowerBounds;
+    for (size_t j : intersectingBins) {
+      bool isRedundant = llvm::any_of(
+          intersectingBins, [&](size_t k) { return bins[k].below.test(j); });
+      if (!isRedundant) lowerBounds.push_back(bins[j].end);
+      if (bins[j].staticFloor >= staticFloor) needsStaticFloor = false;
+      bin.staticFloor = std::max(bin.staticFloor, bins[j].staticFloor);
+      bin.below |= bins[j].below;
+      bin.below.set(j);
+    }
+    if (needsStaticFloor) {
+      lowerBounds.insert(lowerBounds.begin(),
+                         builder.createOrFold<arith::AddIOp>(
+                             loc, baseOffset, indexSet.get(staticFloor)));
+      bin.staticFloor = std::max(bin.staticFloor, staticFloor);
+    }
+
+    bin.offset = lowerBounds.front();
+    for (auto lowerBound : llvm::drop_begin(lowerBounds)) {
+      bin.offset =
+          builder.createOrFold<arith::MaxUIOp>(loc, bin.offset, lowerBound);
+    }
+    auto binEnd =
+        builder.createOrFold<arith::AddIOp>(loc, bin.offset, bin.size);
+    bin.end =
+        builder.createOrFold<IREE::Util::AlignOp>(loc, binEnd, offsetAlignment);
+    for (auto *slice : bin.slices) {
+      slice->packedOffset.replaceAllUsesWith(bin.offset);
+    }
+  }
+
+  // The total size is the maximum end of all reservations that are not known
+  // to be below another.
+  llvm::BitVector belowAny(bins.size());
+  int64_t maxStaticFloor = 0;
+  for (auto &bin : bins) {
+    belowAny |= bin.below;
+    maxStaticFloor = std::max(maxStaticFloor, bin.staticFloor);
+  }
+  SmallVector<Value> ends;
+  if (!staticSlices.empty() && maxStaticFloor < staticLayout.highwaterMark) {
+    ends.push_back(builder.createOrFold<arith::AddIOp>(
+        loc, baseOffset,
+        indexSet.get(
+            IREE::Util::align(staticLayout.highwaterMark, rangeAlignment))));
+  }
+  for (size_t i = 0; i < bins.size(); ++i) {
+    if (!belowAny.test(i)) ends.push_back(bins[i].end);
+  }
+  Value offset = ends.front();
+  for (auto end : llvm::drop_begin(ends)) {
+    offset = builder.createOrFold<arith::MaxUIOp>(loc, offset, end);
+  }
+
   return builder.createOrFold<IREE::Util::AlignOp>(loc, offset, rangeAlignment);
 }
 
@@ -289,9 +450,13 @@ class LayoutSlicesPass : public LayoutSlicesBase<LayoutSlicesPass> {
       // First pack all static slices as these are entirely knowable here at
       // compile time.
       auto offset = packOp.offset() ? packOp.offset() : indexSet.get(0);
+      auto baseOffset = offset;
+      StaticLayout staticLayout;
       if (!staticSlices.empty()) {
-        offset = packStaticSlicesGreedily(packOp, offset, staticSlices,
-                                          resourceConfig, indexSet, builder);
+        staticLayout = computeStaticLayout(staticSlices, resourceConfig);
+        offset =
+            packStaticSlicesGreedily(packOp, offset, staticSlices, staticLayout,
+                                     resourceConfig, indexSet, builder);
 
         // TODO(benvanik): make this an option; it can be useful for debugging
         // this code.
@@ -299,12 +464,13 @@ class LayoutSlicesPass : public LayoutSlicesBase<LayoutSlicesPass> {
         //                                   resourceConfig, indexSet, builder);
       }
 
-      // Next pack all dynamic slices. Depending on the analysis information
-      // available we could reuse static slices with non-overlapping lifetimes
-      // in some cases.
+      // Next pack all dynamic slices. These may reuse the memory of static
+      // slices with non-overlapping lifetimes and as such start from the base
+      // offset.
       if (!dynamicSlices.empty()) {
         offset = packDynamicSlicesConservatively(
-            packOp, offset, dynamicSlices, resourceConfig, indexSet, builder);
+            packOp, baseOffset, dynamicSlices, staticSlices, staticLayout,
+            resourceConfig, indexSet, builder);
       }
 
       // Total packed length is the current offset after all slices are
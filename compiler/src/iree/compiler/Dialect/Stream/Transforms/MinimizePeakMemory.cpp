@@ -0,0 +1,299 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/compiler/Dialect/Stream/IR/StreamDialect.h"
+#include "iree/compiler/Dialect/Stream/IR/StreamOps.h"
+#include "iree/compiler/Dialect/Stream/IR/StreamTypes.h"
+#include "iree/compiler/Dialect/Stream/Transforms/PassDetail.h"
+#include "iree/compiler/Dialect/Stream/Transforms/Passes.h"
+#include "iree/compiler/Dialect/Util/IR/UtilDialect.h"
+#include "iree/compiler/Dialect/Util/IR/UtilOps.h"
+#include "iree/compiler/Dialect/Util/IR/UtilTypes.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/Support/Debug.h"
+#include "mlir/IR/Attributes.h"
+#include "mlir/IR/Builders.h"
+#include "mlir/IR/Matchers.h"
+#include "mlir/Pass/Pass.h"
+
+#define DEBUG_TYPE "iree-stream-minimize-peak-memory"
+
+namespace mlir {
+namespace iree_compiler {
+namespace IREE {
+namespace Stream {
+namespace {
+
+// Storage produced by an op in the execution region. Tied results alias the
+// storage of the operand they are tied to and don't produce new storage.
+struct Storage {
+  // Size in bytes if statically known and otherwise 0. Dynamically-sized
+  // storage can't be compared so it does not influence the order.
+  int64_t size = 0;
+  // Ops in the region that use any value aliasing the storage.
+  SetVector<Operation *> users;
+  // True if the storage escapes the region and is live until its end.
+  bool escapes = false;
+};
+
+// Use-def graph of the ops in an execution region along with the storage
+// each op produces and consumes.
+struct RegionGraph {
+  // All ops in the region in their original order, excluding the terminator.
+  SmallVector<Operation *> ops;
+  DenseMap<Operation *, unsigned> opOrdinals;
+  // Ops within the region each op depends on.
+  SmallVector<SetVector<unsigned>> deps;
+  // Storage produced and consumed by each op.
+  SmallVector<SmallVector<unsigned>> producedStorage;
+  SmallVector<SetVector<unsigned>> consumedStorage;
+  SmallVector<Storage> storage;
+};
+
+// Returns the statically-known size of |result| in bytes or 0 if dynamic.
+static int64_t getStaticResultSize(Operation *op, unsigned resultIndex) {
+  auto sizeAwareOp = dyn_cast<IREE::Util::SizeAwareOpInterface>(op);
+  if (!sizeAwareOp) return 0;
+  auto resultSize = sizeAwareOp.getResultSize(resultIndex);
+  APInt staticSize;
+  if (!resultSize || !matchPattern(resultSize, m_ConstantInt(&staticSize))) {
+    return 0;
+  }
+  return staticSize.getSExtValue();
+}
+
+static RegionGraph buildRegionGraph(Block *block) {
+  RegionGraph graph;
+  for (auto &op : block->without_terminator()) {
+    graph.opOrdinals[&op] = graph.ops.size();
+    graph.ops.push_back(&op);
+  }
+  graph.deps.resize(graph.ops.size());
+  graph.producedStorage.resize(graph.ops.size());
+  graph.consumedStorage.resize(graph.ops.size());
+
+  // Assign storage to each resource value defined in the block. Values from
+  // outside of the region (captures) are not counted as the region can't
+  // change their lifetime.
+  DenseMap<Value, unsigned> valueStorage;
+  for (auto *op : graph.ops) {
+    unsigned ordinal = graph.opOrdinals[op];
+    auto tiedOp = dyn_cast<IREE::Util::TiedOpInterface>(op);
+    for (auto result : op->getResults()) {
+      if (!result.getType().isa<IREE::Stream::ResourceType>()) continue;
+      if (tiedOp) {
+        if (auto tiedOperand = tiedOp.getTiedResultOperand(result)) {
+          auto it = valueStorage.find(tiedOperand);
+          if (it != valueStorage.end()) valueStorage[result] = it->second;
+          continue;
+        }
+      }
+      valueStorage[result] = graph.storage.size();
+      graph.producedStorage[ordinal].push_back(graph.storage.size());
+      Storage storage;
+      storage.size = getStaticResultSize(op, result.getResultNumber());
+      graph.storage.push_back(std::move(storage));
+    }
+  }
+
+  // Gather dependencies and storage uses. Uses from nested regions are
+  // attributed to the op in the block containing them.
+  for (auto *op : graph.ops) {
+    unsigned ordinal = graph.opOrdinals[op];
+    op->walk([&](Operation *nestedOp) {
+      for (auto operand : nestedOp->getOperands()) {
+        auto *definingOp = operand.getDefiningOp();
+        if (!definingOp) continue;
+        auto *ancestorOp = block->findAncestorOpInBlock(*definingOp);
+        if (!ancestorOp || ancestorOp == op) continue;
+        graph.deps[ordinal].insert(graph.opOrdinals[ancestorOp]);
+        auto it = valueStorage.find(operand);
+        if (it == valueStorage.end()) continue;
+        graph.consumedStorage[ordinal].insert(it->second);
+        graph.storage[it->second].users.insert(op);
+      }
+    });
+  }
+  for (auto operand : block->getTerminator()->getOperands()) {
+    auto it = valueStorage.find(operand);
+    if (it != valueStorage.end()) graph.storage[it->second].escapes = true;
+  }
+  return graph;
+}
+
+// Tracks the live storage as ops in a region are scheduled in some order.
+struct LivenessState {
+  explicit LivenessState(const RegionGraph &graph) : graph(graph) {
+    remainingUsers.reserve(graph.storage.size());
+    for (auto &storage : graph.storage) {
+      remainingUsers.push_back(storage.users.size());
+    }
+  }
+
+  // Returns the change in live bytes once the op at |ordinal| has executed.
+  int64_t getDelta(unsigned ordinal) const {
+    int64_t delta = 0;
+    for (auto storageOrdinal : graph.producedStorage[ordinal]) {
+      auto &storage = graph.storage[storageOrdinal];
+      if (storage.escapes || !storage.users.empty()) delta += storage.size;
+    }
+    for (auto storageOrdinal : graph.consumedStorage[ordinal]) {
+      auto &storage = graph.storage[storageOrdinal];
+      if (!storage.escapes && remainingUsers[storageOrdinal] == 1) {
+        delta -= storage.size;
+      }
+    }
+    return delta;
+  }
+
+  // Schedules the op at |ordinal|. Its results are live while it executes and
+  // any storage it was the last user of is released after it completes.
+  void schedule(unsigned ordinal) {
+    for (auto storageOrdinal : graph.producedStorage[ordinal]) {
+      liveSize += graph.storage[storageOrdinal].size;
+    }
+    peakSize = std::max(peakSize, liveSize);
+    for (auto storageOrdinal : graph.producedStorage[ordinal]) {
+      auto &storage = graph.storage[storageOrdinal];
+      if (!storage.escapes && storage.users.empty()) liveSize -= storage.size;
+    }
+    for (auto storageOrdinal : graph.consumedStorage[ordinal]) {
+      auto &storage = graph.storage[storageOrdinal];
+      if (--remainingUsers[storageOrdinal] == 0 && !storage.escapes) {
+        liveSize -= storage.size;
+      }
+    }
+  }
+
+  const RegionGraph &graph;
+  SmallVector<size_t> remainingUsers;
+  int64_t liveSize = 0;
+  int64_t peakSize = 0;
+};
+
+// Returns the peak live bytes when executing the region in its current order.
+static int64_t computeOriginalPeak(const RegionGraph &graph) {
+  LivenessState state(graph);
+  for (unsigned i = 0; i < graph.ops.size(); ++i) state.schedule(i);
+  return state.peakSize;
+}
+
+// Computes a topological order of the region ops that greedily keeps live
+// memory low: of the ops whose dependencies have been scheduled the one that
+// increases live memory the least (or frees the most) is picked next, with
+// ties going to the original order. Returns the peak live bytes of the order.
+static int64_t computeMinimalPeakOrder(const RegionGraph &graph,
+                                       SmallVectorImpl<unsigned> &order) {
+  LivenessState state(graph);
+  SmallVector<size_t> pendingDeps;
+  SmallVector<SmallVector<unsigned>> dependents(graph.ops.size());
+  pendingDeps.reserve(graph.ops.size());
+  for (unsigned i = 0; i < graph.ops.size(); ++i) {
+    pendingDeps.push_back(graph.deps[i].size());
+    for (auto dep : graph.deps[i]) dependents[dep].push_back(i);
+  }
+  SetVector<unsigned> readyOps;
+  for (unsigned i = 0; i < graph.ops.size(); ++i) {
+    if (!pendingDeps[i]) readyOps.insert(i);
+  }
+  while (!readyOps.empty()) {
+    unsigned bestOrdinal = readyOps.front();
+    int64_t bestDelta = state.getDelta(bestOrdinal);
+    for (auto ordinal : readyOps) {
+      int64_t delta = state.getDelta(ordinal);
+      if (delta < bestDelta || (delta == bestDelta && ordinal < bestOrdinal)) {
+        bestOrdinal = ordinal;
+        bestDelta = delta;
+      }
+    }
+    readyOps.remove(bestOrdinal);
+    state.schedule(bestOrdinal);
+    order.push_back(bestOrdinal);
+    for (auto dependent : dependents[bestOrdinal]) {
+      if (--pendingDeps[dependent] == 0) readyOps.insert(dependent);
+    }
+  }
+  assert(order.size() == graph.ops.size() && "region must be acyclic");
+  return state.peakSize;
+}
+
+//===----------------------------------------------------------------------===//
+// -iree-stream-minimize-peak-memory
+//===----------------------------------------------------------------------===//
+
+class MinimizePeakMemoryPass
+    : public MinimizePeakMemoryBase<MinimizePeakMemoryPass> {
+ public:
+  MinimizePeakMemoryPass() = default;
+  explicit MinimizePeakMemoryPass(int64_t memoryBudget) {
+    this->memoryBudget = memoryBudget;
+  }
+
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<IREE::Stream::StreamDialect>();
+    registry.insert<IREE::Util::UtilDialect>();
+  }
+
+  void runOnOperation() override {
+    auto parentOp = getOperation();
+    if (!parentOp.getCallableRegion() ||
+        parentOp.getCallableRegion()->empty()) {
+      return;
+    }
+    parentOp.getCallableRegion()->walk(
+        [&](IREE::Stream::AsyncExecuteOp executeOp) {
+          runOnRegion(executeOp);
+        });
+  }
+
+  void runOnRegion(IREE::Stream::AsyncExecuteOp executeOp) {
+    if (executeOp.body().empty()) return;
+    auto *block = &executeOp.body().front();
+
+    auto graph = buildRegionGraph(block);
+    int64_t originalPeak = computeOriginalPeak(graph);
+    SmallVector<unsigned> order;
+    int64_t minimalPeak = computeMinimalPeakOrder(graph, order);
+    LLVM_DEBUG(llvm::dbgs() << "Execution region peak " << originalPeak
+                            << "B -> " << minimalPeak << "B\n");
+
+    // Only reorder if it's an improvement so that we don't perturb regions
+    // that are already optimal (or that we can't reason about).
+    int64_t peakSize = originalPeak;
+    if (minimalPeak < originalPeak) {
+      auto *terminatorOp = block->getTerminator();
+      for (auto ordinal : order) graph.ops[ordinal]->moveBefore(terminatorOp);
+      peakSize = minimalPeak;
+    }
+
+    // Concurrency waves keep their inputs and results live together and can
+    // only increase the peak we computed for the serialized order. If we are
+    // already over budget then favor memory over concurrency. Explicitly
+    // configured regions are left as-is.
+    if (memoryBudget > 0 && peakSize > memoryBudget &&
+        !executeOp->hasAttr("stream.partitioning")) {
+      LLVM_DEBUG(llvm::dbgs() << "Peak exceeds budget of " << memoryBudget
+                              << "B; favoring min-peak-memory\n");
+      auto favorAttr = IREE::Stream::FavorAttr::get(
+          executeOp.getContext(), IREE::Stream::Favor::MinPeakMemory);
+      executeOp->setAttr("stream.partitioning",
+                         IREE::Stream::PartitioningConfigAttr::get(favorAttr));
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<InterfacePass<CallableOpInterface>>
+createMinimizePeakMemoryPass(int64_t memoryBudget) {
+  return std::make_unique<MinimizePeakMemoryPass>(memoryBudget);
+}
+
+}  // namespace Stream
+}  // namespace IREE
+}  // namespace iree_compiler
+}  // namespace mlir
@@ -13,6 +13,7 @@
 #include "iree/compiler/Dialect/Util/IR/UtilOps.h"
 #include "iree/compiler/Dialect/Util/IR/UtilTypes.h"
 #include "iree/compiler/Utils/IndexSet.h"
+#include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "mlir/Dialect/Func/IR/FuncOps.h"
 #include "mlir/Dialect/SCF/IR/SCF.h"
@@ -33,6 +34,15 @@ namespace IREE {
 namespace Stream {
 namespace {
 
+static llvm::cl::opt<int64_t> clConstantSegmentAlignment(
+    "iree-stream-constant-segment-alignment",
+    llvm::cl::desc("Minimum alignment in bytes of constant storage segments "
+                   "in the output module. Page-sized alignments (4096) allow "
+                   "the segments to be mapped directly from the module file "
+                   "without copies. 0 uses the target's minimum buffer "
+                   "offset alignment."),
+    llvm::cl::init(0));
+
 //===----------------------------------------------------------------------===//
 // Pool packing and storage assignment
 //===----------------------------------------------------------------------===//
@@ -494,12 +504,13 @@ class PackConstantsPass : public PackConstantsBase<PackConstantsPass> {
       // As our upload paths may vary this ensures that we are only emitting
       // them once regardless of how many strategies we emit IR for.
       SmallVector<Value> storageBuffers;
+      int64_t segmentAlignment =
+          std::max<int64_t>(resourceConfig.getMinBufferOffsetAlignment(),
+                            clConstantSegmentAlignment);
       for (auto &storageResource : storageResources) {
         auto rodataOp = builder.create<IREE::Util::ByteBufferConstantOp>(
             storageResource.loc, builder.getType<IREE::Util::ByteBufferType>(),
-            storageResource.data,
-            builder.getI64IntegerAttr(
-                resourceConfig.getMinBufferOffsetAlignment()));
+            storageResource.data, builder.getI64IntegerAttr(segmentAlignment));
         storageBuffers.push_back(rodataOp);
       }
 
@@ -118,6 +118,15 @@ void buildStreamAsyncPassPipeline(OpPassManager &passManager,
 
   addCleanupPatterns(passManager);
 
+  // Split work across devices as pipeline stages. This happens before
+  // copy-on-write materialization and lifetime refinement so that the
+  // transfers between devices are treated like any other async op.
+  FunctionLikeNest(passManager)
+      .addPredicatedPass(transformOptions.deviceCount > 1, [&]() {
+        return IREE::Stream::createAssignDeviceAffinitiesPass(
+            transformOptions.deviceCount);
+      });
+
   // Materialize copy-on-write behavior with explicit stream.async.* ops.
   // This will insert a lot of copies, so follow it up with a pass that elides
   // ones that aren't needed. This is easier to verify than if there was one
@@ -141,6 +150,13 @@ void buildStreamAsyncPassPipeline(OpPassManager &passManager,
   FunctionLikeNest(passManager)
       // Combine async work into execution regions.
       .addPass(IREE::Stream::createScheduleExecutionPass)
+      // Reorder independent work to reduce peak memory before waves are
+      // formed as concurrency scheduling assumes the order is memory-friendly
+      // when favoring min-peak-memory.
+      .addPredicatedPass(transformOptions.minimizePeakMemory, [&]() {
+        return IREE::Stream::createMinimizePeakMemoryPass(
+            transformOptions.memoryBudget);
+      })
       // Group concurrently executable work into waves.
       .addPass(IREE::Stream::createScheduleConcurrencyPass);
 
@@ -190,6 +206,14 @@ void buildStreamCmdPassPipeline(OpPassManager &passManager,
   passManager.addPass(IREE::Stream::createPropagateSubviewsPass());
   addCleanupPatterns(passManager);
 
+  // Serve statically-sized transients from pools allocated at program load
+  // instead of allocating them on every invocation. The cleanup above has
+  // folded the packed sizes to constants where possible.
+  if (transformOptions.hoistTransients) {
+    passManager.addPass(IREE::Stream::createHoistTransientsPass());
+    addCleanupPatterns(passManager);
+  }
+
   // TODO(benvanik): outline streams (ala dispatch regions). Note that we may
   // want to do this earlier to enable better deduplication but that makes the
   // above passes trickier. Outlining may be more like "find chunks of streams
@@ -35,6 +35,43 @@ struct TransformOptions : public PassPipelineOptions<TransformOptions> {
       llvm::cl::init(true),
   };
 
+  Option<int64_t> deviceCount{
+      *this,
+      "device-count",
+      llvm::cl::desc(
+          "Splits async work across the given number of devices as pipeline "
+          "stages with transfers between them (1 to disable)."),
+      llvm::cl::init(1),
+  };
+
+  Option<bool> minimizePeakMemory{
+      *this,
+      "minimize-peak-memory",
+      llvm::cl::desc(
+          "Reorders independent ops within execution regions to minimize their "
+          "peak live transient memory."),
+      llvm::cl::init(false),
+  };
+  Option<int64_t> memoryBudget{
+      *this,
+      "memory-budget",
+      llvm::cl::desc(
+          "Peak transient memory in bytes above which execution regions favor "
+          "lower memory over concurrency when minimizing peak memory (0 to "
+          "disable)."),
+      llvm::cl::init(0),
+  };
+
+  Option<bool> hoistTransients{
+      *this,
+      "hoist-transients",
+      llvm::cl::desc(
+          "Hoists statically-sized transient allocations into pools that are "
+          "allocated at program load and reused across invocations. Only "
+          "valid when invocations are externally synchronized."),
+      llvm::cl::init(false),
+  };
+
   Option<DumpOutputFormat> dumpStatisticsFormat{
       *this,
       "dump-statistics-format",
@@ -122,6 +159,10 @@ std::unique_ptr<InterfacePass<CallableOpInterface>>
 createScheduleExecutionPass();
 std::unique_ptr<InterfacePass<CallableOpInterface>>
 createScheduleConcurrencyPass();
+std::unique_ptr<InterfacePass<CallableOpInterface>>
+createMinimizePeakMemoryPass(int64_t memoryBudget = 0);
+std::unique_ptr<InterfacePass<CallableOpInterface>>
+createAssignDeviceAffinitiesPass(int64_t deviceCount = 1);
 
 std::unique_ptr<OperationPass<mlir::ModuleOp>> createPropagateTimepointsPass();
 
@@ -137,6 +178,7 @@ std::unique_ptr<InterfacePass<CallableOpInterface>> createPackAllocationsPass();
 std::unique_ptr<InterfacePass<CallableOpInterface>> createLayoutSlicesPass();
 
 std::unique_ptr<OperationPass<mlir::ModuleOp>> createPropagateSubviewsPass();
+std::unique_ptr<OperationPass<mlir::ModuleOp>> createHoistTransientsPass();
 
 //===----------------------------------------------------------------------===//
 // Stream memoization
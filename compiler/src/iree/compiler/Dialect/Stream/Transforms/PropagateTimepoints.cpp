@@ -491,6 +491,39 @@ static void expandAwaitOp(IREE::Stream::TimepointAwaitOp op,
   }
 }
 
+// Resolves a barrier on a resource to the timepoint associated with it.
+// Exports of the resource are not required to wait as the timepoint is what
+// signals the consumers of the exported value while all other users continue
+// to observe the awaited resource.
+//
+// Example:
+//  %1 = stream.timepoint.await %t, %0
+//  %2, %bt = stream.timepoint.barrier %1
+//  stream.timepoint.chain_external %bt => (%fence)
+//  %3 = stream.tensor.export %2
+//  ->
+//  stream.timepoint.chain_external %t => (%fence)
+//  %3 = stream.tensor.export %0
+static void expandBarrierOp(IREE::Stream::TimepointBarrierOp op,
+                            BlockAndValueMapping &resourceTimepointMap) {
+  OpBuilder builder(op);
+  auto timepointResource = consumeTimepoint(op.getLoc(), op.resource(),
+                                            resourceTimepointMap, builder);
+  auto timepoint = timepointResource.first;
+  auto resource = timepointResource.second;
+  resourceTimepointMap.map(resource, timepoint);
+  Value awaitedResource = op.resource();
+  for (auto &use : llvm::make_early_inc_range(op.result().getUses())) {
+    if (isa<IREE::Stream::TensorExportOp>(use.getOwner())) {
+      use.set(resource);
+    } else {
+      use.set(awaitedResource);
+    }
+  }
+  op.result_timepoint().replaceAllUsesWith(timepoint);
+  op.erase();
+}
+
 // Expands resource operands captured by a stream.async.execute |op| to await
 // on the timepoints of those resources. In the case of back-to-back execution
 // regions this performs the chaining of unreadied results to awaited operands.
@@ -557,6 +590,9 @@ static void expandTimepoints(Operation *op, ExpandedGlobalMap &globalMap,
     expandCondBranchOp(condBranchOp, resourceTimepointMap);
   } else if (auto awaitOp = dyn_cast<IREE::Stream::TimepointAwaitOp>(op)) {
     expandAwaitOp(awaitOp, resourceTimepointMap);
+  } else if (auto barrierOp =
+                 dyn_cast<IREE::Stream::TimepointBarrierOp>(op)) {
+    expandBarrierOp(barrierOp, resourceTimepointMap);
   } else if (auto executeOp = dyn_cast<IREE::Stream::AsyncExecuteOp>(op)) {
     expandAsyncExecuteOp(executeOp, resourceTimepointMap);
   }
@@ -349,6 +349,7 @@ static void insertUsageRefinementPatterns(MLIRContext *context,
                   ApplyStreamableOp<IREE::Stream::AsyncDispatchOp>,
                   ApplyStreamableOp<IREE::Stream::AsyncExecuteOp>,
                   ApplyStreamableOp<IREE::Stream::AsyncConcurrentOp>,
+                  ApplyStreamableOp<IREE::Stream::TimepointBarrierOp>,
                   ApplyStreamableOp<IREE::Stream::YieldOp>>(context, analysis);
   IREE::Stream::AsyncTransferOp::getCanonicalizationPatterns(patterns, context);
 }
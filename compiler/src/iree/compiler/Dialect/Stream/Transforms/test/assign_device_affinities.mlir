@@ -0,0 +1,39 @@
+// RUN: iree-opt --split-input-file --pass-pipeline="func.func(iree-stream-assign-device-affinities{device-count=2})" %s | FileCheck %s
+
+// Tests that a chain of dispatches is split into two pipeline stages with
+// transfers at the stage boundary and back to the default device for results.
+
+// CHECK-LABEL: @pipelineStages
+// CHECK-SAME: (%[[ARG:.+]]: !stream.resource<*>)
+func.func @pipelineStages(%arg0: !stream.resource<*>) -> !stream.resource<*> {
+  %c1 = arith.constant 1 : index
+  %c4 = arith.constant 4 : index
+  // CHECK: %[[D0:.+]] = stream.async.dispatch @ex::@d0
+  %0 = stream.async.dispatch @ex::@d0[%c1, %c1, %c1](%arg0) : (!stream.resource<*>{%c4}) -> !stream.resource<*>{%c4}
+  // CHECK: %[[D1:.+]] = stream.async.dispatch @ex::@d1[%c1, %c1, %c1](%[[D0]])
+  %1 = stream.async.dispatch @ex::@d1[%c1, %c1, %c1](%0) : (!stream.resource<*>{%c4}) -> !stream.resource<*>{%c4}
+  // CHECK: %[[D1_T:.+]] = stream.async.transfer %[[D1]] : !stream.resource<*>{%c4} -> to(#stream.affinity<device = 1>) !stream.resource<*>{%c4}
+  // CHECK: %[[D2:.+]] = stream.async.dispatch on(#stream.affinity<device = 1>) @ex::@d2[%c1, %c1, %c1](%[[D1_T]])
+  %2 = stream.async.dispatch @ex::@d2[%c1, %c1, %c1](%1) : (!stream.resource<*>{%c4}) -> !stream.resource<*>{%c4}
+  // CHECK: %[[D3:.+]] = stream.async.dispatch on(#stream.affinity<device = 1>) @ex::@d3[%c1, %c1, %c1](%[[D2]])
+  %3 = stream.async.dispatch @ex::@d3[%c1, %c1, %c1](%2) : (!stream.resource<*>{%c4}) -> !stream.resource<*>{%c4}
+  // CHECK: %[[D3_T:.+]] = stream.async.transfer from(#stream.affinity<device = 1>) %[[D3]] : !stream.resource<*>{%c4} -> !stream.resource<*>{%c4}
+  // CHECK: return %[[D3_T]]
+  return %3 : !stream.resource<*>
+}
+
+// -----
+
+// Tests that explicitly placed work is left as-is.
+
+// CHECK-LABEL: @explicitAffinity
+func.func @explicitAffinity(%arg0: !stream.resource<*>) -> !stream.resource<*> {
+  %c1 = arith.constant 1 : index
+  %c4 = arith.constant 4 : index
+  // CHECK: stream.async.dispatch @ex::@d0
+  %0 = stream.async.dispatch @ex::@d0[%c1, %c1, %c1](%arg0) : (!stream.resource<*>{%c4}) -> !stream.resource<*>{%c4}
+  // CHECK-NOT: stream.async.transfer
+  // CHECK: stream.async.dispatch on(#stream.affinity<device = 2>) @ex::@d1
+  %1 = stream.async.dispatch on(#stream.affinity<device = 2>) @ex::@d1[%c1, %c1, %c1](%0) : (!stream.resource<*>{%c4}) -> !stream.resource<*>{%c4}
+  return %1 : !stream.resource<*>
+}
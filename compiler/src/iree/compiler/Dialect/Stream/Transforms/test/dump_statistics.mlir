@@ -1,24 +1,65 @@
 // RUN: iree-opt --split-input-file --pass-pipeline=iree-stream-dump-statistics{output-format=pretty} %s 2>&1 | FileCheck %s --check-prefix=CHECK-PRETTY
 // RUN: iree-opt --split-input-file --pass-pipeline=iree-stream-dump-statistics{output-format=csv} %s 2>&1 | FileCheck %s --check-prefix=CHECK-CSV
+// RUN: iree-opt --split-input-file --pass-pipeline=iree-stream-dump-statistics{output-format=json} %s 2>&1 | FileCheck %s --check-prefix=CHECK-JSON
 
 // CHECK-PRETTY: Aggregate Statistics
-// CHECK-PRETTY:   Constants: 1, 0 B
+// CHECK-PRETTY:   Constants: 1, 192 B
 // CHECK-PRETTY:   Variables: 0, 0 B
 // CHECK-PRETTY:  D->H Syncs: 2
-// CHECK-PRETTY: Submissions: 3, using cumulative 0 B
+// CHECK-PRETTY: Partitioner: reference
+// CHECK-PRETTY: Submissions: 3, using cumulative 0 B (0.00 MiB), peak 0 B (0.00 MiB)
+// CHECK-PRETTY:  Concurrent: 0 regions
 // CHECK-PRETTY:   DMA Fills: 0
 // CHECK-PRETTY:  DMA Copies: 2
 // CHECK-PRETTY:  Dispatches: 3
 // CHECK-PRETTY: Executables: 2, 33% reuse
+// CHECK-PRETTY: stream.executable.export @func_a_ex_0::@dispatch_0
+// CHECK-PRETTY:      Dispatches: 2
+// CHECK-PRETTY: Estimated FLOPs: 8
+// CHECK-PRETTY:      Bytes Read: 64 B
+// CHECK-PRETTY:   Bytes Written: 32 B
+// CHECK-PRETTY:       Intensity: 0.08 FLOP/B
+// CHECK-PRETTY: stream.executable.export @func_a_ex_1::@dispatch_1
+// CHECK-PRETTY:      Dispatches: 1
+// CHECK-PRETTY: Estimated FLOPs: 3
+// CHECK-PRETTY:      Bytes Read: 32 B
+// CHECK-PRETTY:   Bytes Written: 16 B
+// CHECK-PRETTY:       Intensity: 0.06 FLOP/B
 
 // CHECK-CSV: ; Aggregate Statistics
-// CHECK-CSV: "Constants","Constant Size","Variables","Variable Size","Awaits","Submissions","Transient Size","Fills","Copies","Dispatches","Executables"
-// CHECK-CSV: 1,0,0,0,2,3,0,0,2,3,2
+// CHECK-CSV: "Constants","Constant Size","Variables","Variable Size","Awaits","Submissions","Concurrent Regions","Transient Size","Peak Transient Size","Fills","Copies","Dispatches","Executables"
+// CHECK-CSV: 1,192,0,0,2,3,0,0,0,0,2,3,2
 // CHECK-CSV: ; Execution
 // CHECK-CSV: "Depth","Command","Symbol","Length","Invocations","Workload","Operands","Resources"
 // CHECK-CSV: 0,"copy",,192,,,,
 // CHECK-CSV: 0,"dispatch","@func_a_ex_0::@dispatch_0",,4,"4;1;1",0,3
 
+// CHECK-JSON: "stream-aggregate": {
+// CHECK-JSON:   "global": {
+// CHECK-JSON:     "constant-count": 1,
+// CHECK-JSON:     "constant-size": 192,
+// CHECK-JSON:   "execution": {
+// CHECK-JSON:     "submission-count": 3,
+// CHECK-JSON:     "peak-transient-memory-size": 0,
+// CHECK-JSON: "stream-dispatches": [
+// CHECK-JSON-NEXT:   {
+// CHECK-JSON-NEXT:     "symbol": "@func_a_ex_0::@dispatch_0",
+// CHECK-JSON-NEXT:     "dispatch-count": 2,
+// CHECK-JSON-NEXT:     "estimated-flops": 8,
+// CHECK-JSON-NEXT:     "estimated-flops-dynamic": false,
+// CHECK-JSON-NEXT:     "bytes-read": 64,
+// CHECK-JSON-NEXT:     "bytes-written": 32,
+// CHECK-JSON-NEXT:     "bytes-dynamic": false,
+// CHECK-JSON-NEXT:     "arithmetic-intensity": 0.0833
+// CHECK-JSON-NEXT:   },
+// CHECK-JSON-NEXT:   {
+// CHECK-JSON-NEXT:     "symbol": "@func_a_ex_1::@dispatch_1",
+// CHECK-JSON-NEXT:     "dispatch-count": 1,
+// CHECK-JSON-NEXT:     "estimated-flops": 3,
+// CHECK-JSON:     "arithmetic-intensity": 0.0625
+// CHECK-JSON-NEXT:   }
+// CHECK-JSON-NEXT: ]
+
 util.global private mutable @_constant__timepoint = #stream.timepoint<immediate>
 util.global private @_constant : !stream.resource<constant>
 util.initializer {
@@ -120,3 +120,29 @@ func.func private @blockArgMove(%cond: i1, %size: index) -> (!stream.resource<*>
 ^bb2(%bb2_0: !stream.resource<*>, %bb2_1: !stream.resource<*>):
   return %bb2_0, %bb2_1 : !stream.resource<*>, !stream.resource<*>
 }
+
+// -----
+
+// Tests that an in-place update ordered before a read of the original value is
+// sunk below the read so that the clone can be elided. This is the common
+// pattern for cache updates where the old contents are consumed in the same
+// step as the update.
+
+// CHECK-LABEL: @sinkUpdateBelowReader
+// CHECK-SAME: (%[[SIZE:.+]]: index, %[[UPDATE:.+]]: !stream.resource<*>)
+func.func @sinkUpdateBelowReader(%size: index, %update: !stream.resource<*>) -> (!stream.resource<*>, !stream.resource<*>) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c4 = arith.constant 4 : index
+  %c123_i32 = arith.constant 123 : i32
+  // CHECK: %[[SPLAT:.+]] = stream.async.splat
+  %splat = stream.async.splat %c123_i32 : i32 -> !stream.resource<*>{%size}
+  // CHECK-NOT: stream.async.clone
+  %clone = stream.async.clone %splat : !stream.resource<*>{%size} -> !stream.resource<*>{%size}
+  // CHECK-NEXT: %[[READ:.+]] = stream.async.dispatch @ex::@read[%c1, %c1, %c1](%[[SPLAT]])
+  // CHECK-NEXT: %[[UPDATED:.+]] = stream.async.update %[[UPDATE]], %[[SPLAT]][%c0 to %c4]
+  %updated = stream.async.update %update, %clone[%c0 to %c4] : !stream.resource<*>{%c4} -> %clone as !stream.resource<*>{%size}
+  %read = stream.async.dispatch @ex::@read[%c1, %c1, %c1](%splat) : (!stream.resource<*>{%size}) -> !stream.resource<*>{%c4}
+  // CHECK: return %[[UPDATED]], %[[READ]]
+  return %updated, %read : !stream.resource<*>, !stream.resource<*>
+}
@@ -95,3 +95,56 @@ func.func @inlineConstantOperands(%a: i32) {
   } => !stream.timepoint
   return
 }
+
+// -----
+
+// Tests that constant operands at a uniform delta from an earlier operand at
+// all dispatch sites are rebased on that operand and that unused operands are
+// dropped.
+//
+// In this test %b is always %a + 100 and rebased, %c is divergent from %a
+// (+100/+200) and kept, and %d is unused by the executable and dropped.
+
+// CHECK-LABEL: @rebaseCorrelatedOperandsEx
+stream.executable private @rebaseCorrelatedOperandsEx {
+  stream.executable.export public @dispatch
+  builtin.module  {
+    // CHECK: func.func @dispatch(%[[BINDING:.+]]: !stream.binding, %[[A:.+]]: index, %[[C:.+]]: index)
+    func.func @dispatch(%binding: !stream.binding, %a: index, %b: index, %c: index, %d: i32) {
+      // CHECK: %[[DELTA:.+]] = arith.constant 100 : index
+      // CHECK: %[[B:.+]] = arith.addi %[[A]], %[[DELTA]] : index
+      // CHECK-NEXT: util.do_not_optimize(%[[BINDING]]) : !stream.binding
+      util.do_not_optimize(%binding) : !stream.binding
+      // CHECK-NEXT: util.do_not_optimize(%[[A]]) : index
+      util.do_not_optimize(%a) : index
+      // CHECK-NEXT: util.do_not_optimize(%[[B]]) : index
+      util.do_not_optimize(%b) : index
+      // CHECK-NEXT: util.do_not_optimize(%[[C]]) : index
+      util.do_not_optimize(%c) : index
+      return
+    }
+  }
+}
+// CHECK: func.func @rebaseCorrelatedOperands(%[[D:.+]]: i32)
+func.func @rebaseCorrelatedOperands(%d: i32) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c20 = arith.constant 20 : index
+  %c100 = arith.constant 100 : index
+  %c200 = arith.constant 200 : index
+  %c300 = arith.constant 300 : index
+  %c400 = arith.constant 400 : index
+  %c500 = arith.constant 500 : index
+  %alloc = stream.resource.alloc uninitialized : !stream.resource<transient>{%c20}
+  %result_timepoint = stream.cmd.execute with(%alloc as %capture: !stream.resource<transient>{%c20}) {
+    // CHECK: stream.cmd.dispatch {{.+}}(%c100, %c200 : index, index)
+    stream.cmd.dispatch @rebaseCorrelatedOperandsEx::@dispatch[%c1, %c1, %c1](%c100, %c200, %c200, %d : index, index, index, i32) {
+      rw %capture[%c0 for %c20] : !stream.resource<transient>{%c20}
+    }
+    // CHECK: stream.cmd.dispatch {{.+}}(%c300, %c500 : index, index)
+    stream.cmd.dispatch @rebaseCorrelatedOperandsEx::@dispatch[%c1, %c1, %c1](%c300, %c400, %c500, %d : index, index, index, i32) {
+      rw %capture[%c0 for %c20] : !stream.resource<transient>{%c20}
+    }
+  } => !stream.timepoint
+  return
+}
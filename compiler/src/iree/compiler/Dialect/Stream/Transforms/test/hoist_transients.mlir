@@ -0,0 +1,72 @@
+// RUN: iree-opt --split-input-file --iree-stream-hoist-transients %s | FileCheck %s
+
+// Tests that statically-sized transients are served from a pool allocated at
+// program load and that each invocation is ordered after the last use of the
+// pool via its timepoint global.
+
+// CHECK: util.global private @_transient_pool : !stream.resource<transient>
+// CHECK: util.global private mutable @_transient_pool__timepoint = #stream.timepoint<immediate>
+// CHECK: util.initializer {
+// CHECK:   %[[POOL_SIZE:.+]] = arith.constant 128 : index
+// CHECK:   %[[POOL:.+]] = stream.resource.alloc uninitialized : !stream.resource<transient>{%[[POOL_SIZE]]}
+// CHECK:   util.global.store %[[POOL]], @_transient_pool : !stream.resource<transient>
+// CHECK:   util.initializer.return
+
+// CHECK-LABEL: @staticTransient
+// CHECK-SAME: (%[[AWAIT_TIMEPOINT:.+]]: !stream.timepoint)
+func.func @staticTransient(%await_timepoint: !stream.timepoint) -> !stream.timepoint {
+  %c0 = arith.constant 0 : index
+  %c128 = arith.constant 128 : index
+  %c255_i32 = arith.constant 255 : i32
+  // CHECK-NOT: stream.resource.alloca
+  // CHECK: %[[TRANSIENT:.+]] = util.global.load @_transient_pool : !stream.resource<transient>
+  // CHECK: %[[LAST_USE:.+]] = util.global.load @_transient_pool__timepoint : !stream.timepoint
+  // CHECK: %[[READY:.+]] = stream.timepoint.join max(%[[AWAIT_TIMEPOINT]], %[[LAST_USE]])
+  %transient, %alloca_timepoint = stream.resource.alloca uninitialized await(%await_timepoint) => !stream.resource<transient>{%c128} => !stream.timepoint
+  // CHECK: %[[EXEC_TIMEPOINT:.+]] = stream.cmd.execute await(%[[READY]])
+  // CHECK-SAME: with(%[[TRANSIENT]] as
+  %execute_timepoint = stream.cmd.execute await(%alloca_timepoint) => with(%transient as %capture: !stream.resource<transient>{%c128}) {
+    stream.cmd.fill %c255_i32, %capture[%c0 for %c128] : i32 -> !stream.resource<transient>{%c128}
+  } => !stream.timepoint
+  // CHECK-NOT: stream.resource.dealloca
+  // CHECK: util.global.store %[[EXEC_TIMEPOINT]], @_transient_pool__timepoint : !stream.timepoint
+  %dealloca_timepoint = stream.resource.dealloca await(%execute_timepoint) => %transient : !stream.resource<transient>{%c128} => !stream.timepoint
+  // CHECK: return %[[EXEC_TIMEPOINT]]
+  return %dealloca_timepoint : !stream.timepoint
+}
+
+// -----
+
+// Tests that dynamically-sized transients are left as stream-ordered allocas.
+
+// CHECK-NOT: util.global
+// CHECK-LABEL: @dynamicTransient
+func.func @dynamicTransient(%size: index, %await_timepoint: !stream.timepoint) -> !stream.timepoint {
+  %c0 = arith.constant 0 : index
+  %c255_i32 = arith.constant 255 : i32
+  // CHECK: stream.resource.alloca
+  %transient, %alloca_timepoint = stream.resource.alloca uninitialized await(%await_timepoint) => !stream.resource<transient>{%size} => !stream.timepoint
+  %execute_timepoint = stream.cmd.execute await(%alloca_timepoint) => with(%transient as %capture: !stream.resource<transient>{%size}) {
+    stream.cmd.fill %c255_i32, %capture[%c0 for %size] : i32 -> !stream.resource<transient>{%size}
+  } => !stream.timepoint
+  // CHECK: stream.resource.dealloca
+  %dealloca_timepoint = stream.resource.dealloca await(%execute_timepoint) => %transient : !stream.resource<transient>{%size} => !stream.timepoint
+  return %dealloca_timepoint : !stream.timepoint
+}
+
+// -----
+
+// Tests that transients escaping the execution regions are left alone as
+// their lifetime can't be bounded by the pool timeline.
+
+// CHECK-NOT: util.global
+// CHECK-LABEL: @escapingTransient
+func.func @escapingTransient(%await_timepoint: !stream.timepoint) -> !stream.timepoint {
+  %c128 = arith.constant 128 : index
+  // CHECK: stream.resource.alloca
+  %transient, %alloca_timepoint = stream.resource.alloca uninitialized await(%await_timepoint) => !stream.resource<transient>{%c128} => !stream.timepoint
+  util.do_not_optimize(%transient) : !stream.resource<transient>
+  // CHECK: stream.resource.dealloca
+  %dealloca_timepoint = stream.resource.dealloca await(%alloca_timepoint) => %transient : !stream.resource<transient>{%c128} => !stream.timepoint
+  return %dealloca_timepoint : !stream.timepoint
+}
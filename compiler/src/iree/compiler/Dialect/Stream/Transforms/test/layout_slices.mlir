@@ -29,6 +29,37 @@ func.func @layoutStatic() -> (index, index, index, index, index, index, index)
 
 // -----
 
+#layoutStaticBySizeConfig = #stream.resource_config<{
+  max_allocation_size = 1073741824,
+  min_buffer_offset_alignment = 16,
+  max_buffer_range = 1073741824,
+  min_buffer_range_alignment = 16,
+  index_bits = 32
+}>
+
+// Packing in lifetime order would place [2, 3] after [1, 2] as it doesn't fit
+// in the gap left by [0, 1] (112 + 304 + 208 = 624). Placing the largest slice
+// first lets the two smaller ones share the memory above it.
+
+// CHECK-LABEL: @layoutStaticBySize
+func.func @layoutStaticBySize() -> (index, index, index, index)
+    attributes {stream.resources = #layoutStaticBySizeConfig} {
+  %c100 = arith.constant 100 : index
+  %c200 = arith.constant 200 : index
+  %c300 = arith.constant 300 : index
+  %t:4 = stream.resource.pack slices({
+    [0, 1] = %c100,  // +304 (after [1, 2])
+    [1, 2] = %c300,  // +0
+    [2, 3] = %c200,  // +304 (reuse [0, 1])
+  }) : index
+  // 304 + 208 = 512 total bytes required
+  // CHECK: return %c512
+  // CHECK-SAME: %c304, %c0, %c304
+  return %t#0, %t#1, %t#2, %t#3 : index, index, index, index
+}
+
+// -----
+
 #layoutDynamicConfig = #stream.resource_config<{
   max_allocation_size = 1073741824,
   min_buffer_offset_alignment = 16,
@@ -81,14 +112,20 @@ func.func @layoutMixedStaticDynamic(%size_a: index, %size_b: index) -> (index, i
     [5, 6] = %c200,
   }) : index
 
+  // [1, 2] is only live at the same time as the static [0, 1] and can reuse
+  // the memory of [5, 6]. [2, 3] is only live with [1, 2] and is placed after
+  // it. The total is then whichever is larger of the static or dynamic ends.
+
   // CHECK-DAG: %c0 = arith.constant 0 : index
   // CHECK-DAG: %c16 = arith.constant 16 : index
+  // CHECK-DAG: %c112 = arith.constant 112 : index
   // CHECK-DAG: %c208 = arith.constant 208 : index
-  // CHECK-DAG: %0 = util.align %[[SIZE_A]], %c16 : index
-  // CHECK-DAG: %1 = arith.addi %c208, %0 : index
-  // CHECK-DAG: %2 = util.align %[[SIZE_B]], %c16 : index
-  // CHECK-DAG: %3 = arith.addi %1, %2 : index
+  // CHECK-DAG: %[[ALIGNED_A:.+]] = util.align %[[SIZE_A]], %c16 : index
+  // CHECK-DAG: %[[END_A:.+]] = arith.addi %c112, %[[ALIGNED_A]] : index
+  // CHECK-DAG: %[[ALIGNED_B:.+]] = util.align %[[SIZE_B]], %c16 : index
+  // CHECK-DAG: %[[END_B:.+]] = arith.addi %[[END_A]], %[[ALIGNED_B]] : index
+  // CHECK-DAG: %[[TOTAL:.+]] = arith.maxui {{.*}}%[[END_B]]
 
-  // CHECK: return %3, %c0, %c208, %1, %c0
+  // CHECK: return %[[TOTAL]], %c0, %c112, %[[END_A]], %c0
   return %t#0, %t#1, %t#2, %t#3, %t#4 : index, index, index, index, index
 }
@@ -0,0 +1,59 @@
+// RUN: iree-opt --split-input-file --pass-pipeline="func.func(iree-stream-minimize-peak-memory)" %s | FileCheck %s
+// RUN: iree-opt --split-input-file --pass-pipeline="func.func(iree-stream-minimize-peak-memory{memory-budget=1024})" %s | FileCheck %s --check-prefix=CHECK-BUDGET
+
+// Tests that independent ops are reordered such that large temporaries are
+// consumed before others are produced. The original order keeps both splats
+// live together (2064B) while the reordered one peaks at 1056B.
+
+// CHECK-LABEL: @reorderIndependentChains
+// CHECK-BUDGET-LABEL: @reorderIndependentChains
+func.func @reorderIndependentChains() -> (!stream.resource<transient>, !stream.resource<transient>) {
+  %c0 = arith.constant 0 : index
+  %c16 = arith.constant 16 : index
+  %c1024 = arith.constant 1024 : index
+  %c254_i32 = arith.constant 254 : i32
+  %c255_i32 = arith.constant 255 : i32
+  // CHECK: stream.async.execute
+  // CHECK-BUDGET: stream.async.execute
+  %results:2, %result_timepoint = stream.async.execute with() -> (!stream.resource<transient>{%c16}, !stream.resource<transient>{%c16}) {
+    // CHECK-NEXT: %[[SPLAT0:.+]] = stream.async.splat %c254_i32
+    %0 = stream.async.splat %c254_i32 : i32 -> !stream.resource<transient>{%c1024}
+    // CHECK-NEXT: %[[SLICE0:.+]] = stream.async.slice %[[SPLAT0]]
+    // CHECK-NEXT: %[[SPLAT1:.+]] = stream.async.splat %c255_i32
+    %1 = stream.async.splat %c255_i32 : i32 -> !stream.resource<transient>{%c1024}
+    %2 = stream.async.slice %0[%c0 to %c16] : !stream.resource<transient>{%c1024} -> !stream.resource<transient>{%c16}
+    // CHECK-NEXT: %[[SLICE1:.+]] = stream.async.slice %[[SPLAT1]]
+    %3 = stream.async.slice %1[%c0 to %c16] : !stream.resource<transient>{%c1024} -> !stream.resource<transient>{%c16}
+    // CHECK-NEXT: stream.yield %[[SLICE0]], %[[SLICE1]]
+    stream.yield %2, %3 : !stream.resource<transient>{%c16}, !stream.resource<transient>{%c16}
+  // CHECK-BUDGET: } => !stream.timepoint attributes {stream.partitioning = #stream.partitioning_config<favor-min-peak-memory>}
+  } => !stream.timepoint
+  %ready:2 = stream.timepoint.await %result_timepoint => %results#0, %results#1 : !stream.resource<transient>{%c16}, !stream.resource<transient>{%c16}
+  return %ready#0, %ready#1 : !stream.resource<transient>, !stream.resource<transient>
+}
+
+// -----
+
+// Tests that regions already in a memory-friendly order are left untouched
+// and that regions within the budget keep their concurrency.
+
+// CHECK-LABEL: @preserveOptimalOrder
+// CHECK-BUDGET-LABEL: @preserveOptimalOrder
+func.func @preserveOptimalOrder() -> !stream.resource<transient> {
+  %c0 = arith.constant 0 : index
+  %c16 = arith.constant 16 : index
+  %c255_i32 = arith.constant 255 : i32
+  // CHECK: stream.async.execute
+  // CHECK-BUDGET: stream.async.execute
+  %result, %result_timepoint = stream.async.execute with() -> !stream.resource<transient>{%c16} {
+    // CHECK-NEXT: %[[SPLAT:.+]] = stream.async.splat
+    %0 = stream.async.splat %c255_i32 : i32 -> !stream.resource<transient>{%c16}
+    // CHECK-NEXT: %[[SLICE:.+]] = stream.async.slice %[[SPLAT]]
+    %1 = stream.async.slice %0[%c0 to %c16] : !stream.resource<transient>{%c16} -> !stream.resource<transient>{%c16}
+    // CHECK-NEXT: stream.yield %[[SLICE]]
+    stream.yield %1 : !stream.resource<transient>{%c16}
+  // CHECK-BUDGET: } => !stream.timepoint{{$}}
+  } => !stream.timepoint
+  %ready = stream.timepoint.await %result_timepoint => %result : !stream.resource<transient>{%c16}
+  return %ready : !stream.resource<transient>
+}
@@ -1,4 +1,5 @@
 // RUN: iree-opt --split-input-file --pass-pipeline='func.func(iree-stream-pack-constants)' %s | FileCheck %s
+// RUN: iree-opt --split-input-file --pass-pipeline='func.func(iree-stream-pack-constants)' --iree-stream-constant-segment-alignment=4096 %s | FileCheck %s --check-prefix=CHECK-PAGE
 
 // This is a high level test of the structure emitted by the pass.
 // Subsequent tests focus on individual components.
@@ -12,12 +13,14 @@
 // CHECK-NEXT: ]>
 
 // CHECK-LABEL: @resourceConstants
+// CHECK-PAGE-LABEL: @resourceConstants
 func.func @resourceConstants() -> (!stream.resource<constant>, !stream.resource<constant>, !stream.timepoint) {
   %c4 = arith.constant 4 : index
   %c8 = arith.constant 8 : index
 
   // Fetch the read-only host data containing the constants.
   // CHECK: %[[RODATA:.+]] = util.byte_buffer.constant {alignment = 64 : i64} : !util.byte_buffer = #composite_of_128b
+  // CHECK-PAGE: util.byte_buffer.constant {alignment = 4096 : i64}
   %0:3 = stream.resource.constants :
     !stream.resource<constant>{%c4} = dense<100> : tensor<1xi32>,
     !stream.resource<constant>{%c8} = dense<[101, 102]> : tensor<2xi32>
@@ -186,3 +186,29 @@ func.func @asyncExecuteConsume(%arg0: !stream.resource<external>, %arg1: !stream
   util.do_not_optimize(%ready_results#1) : !stream.resource<transient>
   return
 }
+
+// -----
+
+// Tests that barriers resolve to the timepoint of the resource and that exports
+// of the barrier results bypass the await so that the host does not block.
+
+// CHECK-LABEL: @barrierExport
+// CHECK-SAME: (%[[FENCE:.+]]: !hal.fence)
+func.func @barrierExport(%fence: !hal.fence) -> !hal.buffer_view {
+  %c128 = arith.constant 128 : index
+  %c255_i32 = arith.constant 255 : i32
+  // CHECK: %[[RESULT:.+]], %[[RESULT_TIMEPOINT:.+]] = stream.async.execute
+  %result, %result_timepoint = stream.async.execute with() -> !stream.resource<external>{%c128} {
+    %0 = stream.async.splat %c255_i32 : i32 -> !stream.resource<external>{%c128}
+    stream.yield %0 : !stream.resource<external>{%c128}
+  } => !stream.timepoint
+  %ready = stream.timepoint.await %result_timepoint => %result : !stream.resource<external>{%c128}
+  // CHECK-NOT: stream.timepoint.barrier
+  %barrier, %barrier_timepoint = stream.timepoint.barrier %ready : !stream.resource<external>{%c128} => !stream.timepoint
+  // CHECK: stream.timepoint.chain_external %[[RESULT_TIMEPOINT]] => (%[[FENCE]] : !hal.fence)
+  stream.timepoint.chain_external %barrier_timepoint => (%fence : !hal.fence)
+  // CHECK: %[[VIEW:.+]] = stream.tensor.export %[[RESULT]]
+  %view = stream.tensor.export %barrier : tensor<32xf32> in !stream.resource<external>{%c128} -> !hal.buffer_view
+  // CHECK: return %[[VIEW]]
+  return %view : !hal.buffer_view
+}
@@ -376,6 +376,12 @@ static bool isAlignedTo(Value value, Value alignment) {
         isAlignedTo(sourceMulOp.getRhs(), alignment)) {
       return true;
     }
+  } else if (auto sourceMaxOp = value.getDefiningOp<arith::MaxUIOp>()) {
+    // The larger of two aligned values is still aligned.
+    if (isAlignedTo(sourceMaxOp.getLhs(), alignment) &&
+        isAlignedTo(sourceMaxOp.getRhs(), alignment)) {
+      return true;
+    }
   }
 
   return false;
@@ -76,6 +76,23 @@ func.func @foldAddAlignment(%lhs: index, %rhs: index, %alignment: index) -> inde
 
 // -----
 
+// CHECK-LABEL: @foldMaxAlignment
+// CHECK-SAME: (%[[LHS:.+]]: index, %[[RHS:.+]]: index, %[[ALIGNMENT:.+]]: index)
+func.func @foldMaxAlignment(%lhs: index, %rhs: index, %alignment: index) -> index {
+  // CHECK: %[[LHS_ALIGNED:.+]] = util.align %[[LHS]], %[[ALIGNMENT]]
+  %lhs_aligned = util.align %lhs, %alignment : index
+  // CHECK: %[[RHS_ALIGNED:.+]] = util.align %[[RHS]], %[[ALIGNMENT]]
+  %rhs_aligned = util.align %rhs, %alignment : index
+  // CHECK: %[[MAX_ALIGNED:.+]] = arith.maxui %[[LHS_ALIGNED]], %[[RHS_ALIGNED]]
+  %max_aligned = arith.maxui %lhs_aligned, %rhs_aligned : index
+  // CHECK-NOT: util.align
+  %result = util.align %max_aligned, %alignment : index
+  // CHECK: return %[[MAX_ALIGNED]]
+  return %result : index
+}
+
+// -----
+
 // CHECK-LABEL: @foldAddAlignmentConstant
 // CHECK-SAME: (%[[LHS:.+]]: index)
 func.func @foldAddAlignmentConstant(%lhs: index) -> index {
@@ -12,7 +12,10 @@
 #include "iree/compiler/Dialect/Util/IR/UtilTraits.h"
 #include "iree/compiler/Dialect/Util/Transforms/Passes.h"
 #include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/SetVector.h"
 #include "llvm/Support/Debug.h"
+#include "mlir/IR/Dominance.h"
+#include "mlir/IR/SymbolTable.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Pass/PassRegistry.h"
 
@@ -220,6 +223,231 @@ static bool rearrangeBlockGlobalAccesses(
   return didRemoveAny;
 }
 
+// A natural loop in the CFG of a callable region.
+struct SimpleLoop {
+  Block *header = nullptr;
+  // The only block outside of the loop branching to the header.
+  Block *preheader = nullptr;
+  // The only block inside of the loop branching back to the header.
+  Block *latch = nullptr;
+  // The only block outside of the loop reached from within the loop.
+  Block *exit = nullptr;
+  // All loop blocks in topological order starting with the header.
+  SmallVector<Block *> blocks;
+};
+
+static void sortLoopBlocks(Block *block, SimpleLoop &loop,
+                           DenseSet<Block *> &loopBlocks,
+                           DenseSet<Block *> &visitedBlocks) {
+  if (!visitedBlocks.insert(block).second) return;
+  for (auto *successor : block->getSuccessors()) {
+    if (successor != loop.header && loopBlocks.contains(successor)) {
+      sortLoopBlocks(successor, loop, loopBlocks, visitedBlocks);
+    }
+  }
+  loop.blocks.push_back(block);
+}
+
+// Returns the loop headed by |header| if it has the shape produced by lowering
+// structured control flow: a single preheader, latch and exit block, all
+// branches implementing BranchOpInterface and no nested loops.
+static Optional<SimpleLoop> matchSimpleLoop(Block *header,
+                                            DominanceInfo &dominance) {
+  SimpleLoop loop;
+  loop.header = header;
+  for (auto *predecessor : header->getPredecessors()) {
+    if (!dominance.isReachableFromEntry(predecessor)) return llvm::None;
+    Block *&edge =
+        dominance.dominates(header, predecessor) ? loop.latch : loop.preheader;
+    if (edge && edge != predecessor) return llvm::None;
+    edge = predecessor;
+  }
+  if (!loop.preheader || !loop.latch) return llvm::None;
+  if (!isa<BranchOpInterface>(loop.preheader->getTerminator())) {
+    return llvm::None;
+  }
+
+  // Walk backwards from the latch; all blocks reached before the header are in
+  // the loop.
+  DenseSet<Block *> loopBlocks = {header};
+  SmallVector<Block *> worklist = {loop.latch};
+  while (!worklist.empty()) {
+    Block *block = worklist.pop_back_val();
+    if (!loopBlocks.insert(block).second) continue;
+    worklist.append(block->pred_begin(), block->pred_end());
+  }
+
+  for (auto *block : loopBlocks) {
+    if (!isa<BranchOpInterface>(block->getTerminator())) return llvm::None;
+    for (auto *successor : block->getSuccessors()) {
+      if (loopBlocks.contains(successor)) {
+        // Any back edge other than the one to the header is a nested loop.
+        if (successor != header && dominance.dominates(successor, block)) {
+          return llvm::None;
+        }
+      } else {
+        if (loop.exit && loop.exit != successor) return llvm::None;
+        loop.exit = successor;
+      }
+    }
+  }
+  if (!loop.exit) return llvm::None;
+  for (auto *predecessor : loop.exit->getPredecessors()) {
+    if (!loopBlocks.contains(predecessor)) return llvm::None;
+  }
+
+  DenseSet<Block *> visitedBlocks;
+  sortLoopBlocks(header, loop, loopBlocks, visitedBlocks);
+  std::reverse(loop.blocks.begin(), loop.blocks.end());
+  return loop;
+}
+
+// Appends |value| to the operands |predecessor| forwards to |successor|.
+static void appendSuccessorOperand(Block *predecessor, Block *successor,
+                                   Value value) {
+  auto branchOp = cast<BranchOpInterface>(predecessor->getTerminator());
+  for (unsigned i = 0; i < branchOp->getNumSuccessors(); ++i) {
+    if (branchOp->getSuccessor(i) == successor) {
+      branchOp.getSuccessorOperands(i).append(value);
+    }
+  }
+}
+
+// Returns the value of a global on entry to |block| given the values on exit
+// from each of its (already processed) predecessors. A block argument is added
+// if the predecessors disagree.
+static Value getBlockEntryValue(Block *block, Type type, Location loc,
+                                DenseMap<Block *, Value> &exitValues) {
+  if (auto *predecessor = block->getSinglePredecessor()) {
+    return exitValues[predecessor];
+  }
+  Value value = block->addArgument(type, loc);
+  SetVector<Block *> predecessors(block->pred_begin(), block->pred_end());
+  for (auto *predecessor : predecessors) {
+    appendSuccessorOperand(predecessor, block, exitValues[predecessor]);
+  }
+  return value;
+}
+
+// Promotes mutable globals accessed within |loop| to values carried through
+// the loop blocks: each global is loaded once in the preheader and, if stored
+// within the loop, stored once on loop exit.
+//
+// Example:
+//   cf.br ^loop
+// ^loop:
+//   %0 = util.global.load @a : i32
+//   %1 = arith.addi %0, %c1 : i32
+//   util.global.store %1, @a : i32
+//   cf.cond_br %cond, ^loop, ^exit
+// ^exit:
+// ->
+//   %a = util.global.load @a : i32
+//   cf.br ^loop(%a : i32)
+// ^loop(%0: i32):
+//   %1 = arith.addi %0, %c1 : i32
+//   cf.cond_br %cond, ^loop(%1 : i32), ^exit(%1 : i32)
+// ^exit(%2: i32):
+//   util.global.store %2, @a : i32
+//
+// This is only safe if nothing else can observe the globals while the loop
+// runs and as such any op that blocks motion prevents the promotion.
+static void promoteLoopGlobalAccesses(CallableOpInterface callableOp,
+                                      SimpleLoop &loop,
+                                      DenseSet<StringRef> &immutableGlobals) {
+  DenseSet<Block *> loopBlocks(loop.blocks.begin(), loop.blocks.end());
+  std::map<StringRef, SmallVector<Operation *>> accesses;
+  DenseSet<StringRef> nestedAccesses;
+  for (auto *block : loop.blocks) {
+    auto result = block->walk([&](Operation *op) {
+      if (doesOpBlockMotion(op)) return WalkResult::interrupt();
+      StringRef globalName;
+      if (auto loadOp = dyn_cast<IREE::Util::GlobalLoadOp>(op)) {
+        if (immutableGlobals.contains(loadOp.global())) {
+          return WalkResult::advance();
+        }
+        globalName = loadOp.global();
+      } else if (auto storeOp = dyn_cast<IREE::Util::GlobalStoreOp>(op)) {
+        globalName = storeOp.global();
+      } else {
+        return WalkResult::advance();
+      }
+      // Accesses within nested regions would need the value threaded through
+      // the region ops.
+      if (!loopBlocks.contains(op->getBlock())) {
+        nestedAccesses.insert(globalName);
+      }
+      accesses[globalName].push_back(op);
+      return WalkResult::advance();
+    });
+    if (result.wasInterrupted()) return;
+  }
+
+  for (auto &access : accesses) {
+    StringRef globalName = access.first;
+    if (nestedAccesses.contains(globalName)) continue;
+    auto globalNameAttr = StringAttr::get(callableOp.getContext(), globalName);
+    auto globalOp = SymbolTable::lookupNearestSymbolFrom<IREE::Util::GlobalOp>(
+        callableOp.getOperation(), globalNameAttr);
+    if (!globalOp) continue;
+    Type type = globalOp.type();
+    bool hasStores = false;
+    bool hasMatchingTypes = llvm::all_of(access.second, [&](Operation *op) {
+      if (auto storeOp = dyn_cast<IREE::Util::GlobalStoreOp>(op)) {
+        hasStores = true;
+        return storeOp.value().getType() == type;
+      }
+      return op->getResult(0).getType() == type;
+    });
+    if (!hasMatchingTypes) continue;
+
+    LLVM_DEBUG(llvm::dbgs() << "promoting mutable global " << globalName
+                            << " accesses out of loop\n");
+    Location loc = access.second.front()->getLoc();
+    OpBuilder builder(loop.preheader->getTerminator());
+    Value initialValue =
+        builder.create<IREE::Util::GlobalLoadOp>(loc, type, globalName)
+            .result();
+
+    // With no stores the value is invariant across the loop.
+    if (!hasStores) {
+      for (auto *op : access.second) {
+        op->replaceAllUsesWith(ValueRange{initialValue});
+        op->erase();
+      }
+      continue;
+    }
+
+    DenseMap<Block *, Value> exitValues;
+    for (auto *block : loop.blocks) {
+      Value value;
+      if (block == loop.header) {
+        value = block->addArgument(type, loc);
+        appendSuccessorOperand(loop.preheader, block, initialValue);
+      } else {
+        value = getBlockEntryValue(block, type, loc, exitValues);
+      }
+      for (auto &op : llvm::make_early_inc_range(*block)) {
+        if (auto loadOp = dyn_cast<IREE::Util::GlobalLoadOp>(op)) {
+          if (loadOp.global() != globalName) continue;
+          loadOp.replaceAllUsesWith(value);
+          loadOp.erase();
+        } else if (auto storeOp = dyn_cast<IREE::Util::GlobalStoreOp>(op)) {
+          if (storeOp.global() != globalName) continue;
+          value = storeOp.value();
+          storeOp.erase();
+        }
+      }
+      exitValues[block] = value;
+    }
+    appendSuccessorOperand(loop.latch, loop.header, exitValues[loop.latch]);
+
+    Value exitValue = getBlockEntryValue(loop.exit, type, loc, exitValues);
+    builder.setInsertionPointToStart(loop.exit);
+    builder.create<IREE::Util::GlobalStoreOp>(loc, exitValue, globalName);
+  }
+}
+
 namespace {
 
 class SimplifyGlobalAccessesPass
@@ -276,6 +504,19 @@ class SimplifyGlobalAccessesPass
       }
     }
 
+    // Promote globals accessed within loops to loop-carried values. Loops
+    // updating recurrent state in globals otherwise load and store them each
+    // iteration.
+    if (!region.hasOneBlock()) {
+      DominanceInfo dominance(callableOp.getOperation());
+      for (auto &block : llvm::make_early_inc_range(
+               llvm::make_range(++region.begin(), region.end()))) {
+        if (auto loop = matchSimpleLoop(&block, dominance)) {
+          promoteLoopGlobalAccesses(callableOp, *loop, immutableGlobals);
+        }
+      }
+    }
+
     // For each block in the function hoist loads and sink stores.
     // This does no cross-block movement, though it really should. Maybe when a
     // real compiler engineer sees this they'll be inspired to do this properly.
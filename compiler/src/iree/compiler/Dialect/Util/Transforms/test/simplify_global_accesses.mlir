@@ -134,3 +134,69 @@ func.func @side_effects() {
 }
 
 func.func private @other_fn()
+
+// -----
+
+util.global private mutable @varA = 0 : i32
+util.global private mutable @varB = 1 : i32
+
+// Loops updating globals each iteration carry the values through the loop
+// and only access the globals once before and after it.
+
+// CHECK-LABEL: @loop_carried
+// CHECK-SAME: (%[[COUNT:.+]]: index)
+func.func @loop_carried(%count: index) {
+  %c0 = arith.constant 0 : index
+  %c1 = arith.constant 1 : index
+  %c2_i32 = arith.constant 2 : i32
+  //      CHECK: %[[INIT_A:.+]] = util.global.load @varA : i32
+  //      CHECK: %[[INIT_B:.+]] = util.global.load @varB : i32
+  //      CHECK: cf.br ^bb1(%{{.+}}, %[[INIT_A]], %[[INIT_B]] : index, i32, i32)
+  cf.br ^bb1(%c0 : index)
+// CHECK-NEXT: ^bb1(%[[IV:.+]]: index, %[[A:.+]]: i32, %[[B:.+]]: i32):
+^bb1(%iv: index):
+  // CHECK-NOT: util.global.load
+  %a = util.global.load @varA : i32
+  %b = util.global.load @varB : i32
+  // CHECK: %[[NEW_A:.+]] = arith.addi %[[A]], %[[B]] : i32
+  %new_a = arith.addi %a, %b : i32
+  // CHECK: %[[NEW_B:.+]] = arith.muli %[[B]], %{{.+}} : i32
+  %new_b = arith.muli %b, %c2_i32 : i32
+  // CHECK-NOT: util.global.store
+  util.global.store %new_a, @varA : i32
+  util.global.store %new_b, @varB : i32
+  %next = arith.addi %iv, %c1 : index
+  %cond = arith.cmpi slt, %next, %count : index
+  // CHECK: cf.cond_br %{{.+}}, ^bb1(%{{.+}}, %[[NEW_A]], %[[NEW_B]] : index, i32, i32), ^bb2
+  cf.cond_br %cond, ^bb1(%next : index), ^bb2
+// CHECK-NEXT: ^bb2:
+^bb2:
+  // CHECK-NEXT: util.global.store %[[NEW_A]], @varA : i32
+  // CHECK-NEXT: util.global.store %[[NEW_B]], @varB : i32
+  // CHECK-NEXT: return
+  return
+}
+
+// -----
+
+util.global private mutable @varA = 0 : i32
+
+// Calls may observe the global and block the promotion.
+
+// CHECK-LABEL: @loop_with_call
+func.func @loop_with_call(%cond: i1) {
+  cf.br ^bb1
+// CHECK: ^bb1:
+^bb1:
+  // CHECK-NEXT: %[[A:.+]] = util.global.load @varA : i32
+  %a = util.global.load @varA : i32
+  // CHECK-NEXT: call @other_fn()
+  call @other_fn() : () -> ()
+  // CHECK-NEXT: util.global.store %[[A]], @varA : i32
+  util.global.store %a, @varA : i32
+  cf.cond_br %cond, ^bb1, ^bb2
+^bb2:
+  return
+}
+
+func.func private @other_fn()
@@ -146,6 +146,27 @@ struct RegisterUsage {
     }
   }
 
+  // Allocates the register with the same ordinal as |hint| if it matches the
+  // register class of |type| and is entirely free.
+  Optional<Register> tryAllocateRegister(Type type, Register hint) {
+    if (type.isIntOrFloat()) {
+      size_t byteWidth = IREE::Util::getRoundedElementByteWidth(type);
+      if (hint.isRef() || hint.byteWidth() != byteWidth) return llvm::None;
+      int ordinalStart = hint.ordinal();
+      unsigned int ordinalEnd = ordinalStart + (byteWidth / 4) - 1;
+      if (intRegisters.find_first_in(ordinalStart, ordinalEnd + 1) != -1) {
+        return llvm::None;
+      }
+    } else {
+      if (!hint.isRef() || refRegisters.test(hint.ordinal())) {
+        return llvm::None;
+      }
+    }
+    auto reg = Register::getWithSameType(hint, hint.ordinal());
+    markRegisterUsed(reg);
+    return reg;
+  }
+
   void markRegisterUsed(Register reg) {
     int ordinalStart = reg.ordinal();
     if (reg.isRef()) {
@@ -202,6 +223,48 @@ static SmallVector<Block *, 8> sortBlocksInDominanceOrder(
   return orderedBlocks;
 }
 
+// Tries to allocate |blockArg| to the register of a value forwarded to it by
+// a predecessor that has already been allocated.
+static Optional<Register> allocateCoalescedBlockArg(
+    RegisterUsage &registerUsage, const llvm::DenseMap<Value, Register> &map,
+    BlockArgument blockArg) {
+  Block *block = blockArg.getOwner();
+  for (auto *predecessor : block->getPredecessors()) {
+    auto branchOp = dyn_cast<BranchOpInterface>(predecessor->getTerminator());
+    if (!branchOp) continue;
+    for (unsigned i = 0; i < branchOp->getNumSuccessors(); ++i) {
+      if (branchOp->getSuccessor(i) != block) continue;
+      auto operands = branchOp.getSuccessorOperands(i).getForwardedOperands();
+      if (blockArg.getArgNumber() >= operands.size()) continue;
+      auto it = map.find(operands[blockArg.getArgNumber()]);
+      if (it == map.end()) continue;
+      auto reg = registerUsage.tryAllocateRegister(blockArg.getType(),
+                                                   it->getSecond());
+      if (reg.hasValue()) return reg;
+    }
+  }
+  return llvm::None;
+}
+
+// Tries to allocate |result| to the register of a successor block argument
+// that has already been allocated (such as a loop header) it is forwarded to.
+static Optional<Register> allocateCoalescedResult(
+    RegisterUsage &registerUsage, const llvm::DenseMap<Value, Register> &map,
+    Value result) {
+  for (auto &use : result.getUses()) {
+    auto branchOp = dyn_cast<BranchOpInterface>(use.getOwner());
+    if (!branchOp) continue;
+    auto blockArg = branchOp.getSuccessorBlockArgument(use.getOperandNumber());
+    if (!blockArg.hasValue()) continue;
+    auto it = map.find(blockArg.getValue());
+    if (it == map.end()) continue;
+    auto reg =
+        registerUsage.tryAllocateRegister(result.getType(), it->getSecond());
+    if (reg.hasValue()) return reg;
+  }
+  return llvm::None;
+}
+
 // NOTE: this is not a good algorithm, nor is it a good allocator. If you're
 // looking at this and have ideas of how to do this for real please feel
 // free to rip it all apart :)
@@ -211,6 +274,11 @@ static SmallVector<Block *, 8> sortBlocksInDominanceOrder(
 // ensure we are avoiding as many moves as possible. The special case we need to
 // handle is when values are not defined within the current block (as values in
 // dominators are allowed to cross block boundaries outside of arguments).
+//
+// To avoid moves on branches we try to coalesce values flowing into block
+// arguments: block arguments prefer the registers of the operands forwarded by
+// already allocated predecessors and values forwarded along back edges prefer
+// the registers of the (already allocated) successor arguments.
 LogicalResult RegisterAllocation::recalculate(IREE::VM::FuncOp funcOp) {
   map_.clear();
 
@@ -239,7 +307,10 @@ LogicalResult RegisterAllocation::recalculate(IREE::VM::FuncOp funcOp) {
 
     // Allocate arguments first from left-to-right.
     for (auto blockArg : block->getArguments()) {
-      auto reg = registerUsage.allocateRegister(blockArg.getType());
+      auto reg = allocateCoalescedBlockArg(registerUsage, map_, blockArg);
+      if (!reg.hasValue()) {
+        reg = registerUsage.allocateRegister(blockArg.getType());
+      }
       if (!reg.hasValue()) {
         return funcOp.emitError() << "register allocation failed for block arg "
                                   << blockArg.getArgNumber();
@@ -265,7 +336,10 @@ LogicalResult RegisterAllocation::recalculate(IREE::VM::FuncOp funcOp) {
         }
       }
       for (auto result : op.getResults()) {
-        auto reg = registerUsage.allocateRegister(result.getType());
+        auto reg = allocateCoalescedResult(registerUsage, map_, result);
+        if (!reg.hasValue()) {
+          reg = registerUsage.allocateRegister(result.getType());
+        }
         if (!reg.hasValue()) {
           return op.emitError() << "register allocation failed for result "
                                 << result.cast<OpResult>().getResultNumber();
@@ -69,59 +69,76 @@ vm.module @module {
     vm.return %0 : i32
   }
 
-  // CHECK-LABEL: @branch_args_cycle
-  vm.func @branch_args_cycle(%arg0 : i32, %arg1 : i32) -> i32 {
+  // CHECK-LABEL: @branch_args_coalesced
+  vm.func @branch_args_coalesced(%arg0 : i32, %arg1 : i32) -> i32 {
     // CHECK: vm.br
     // CHECK-SAME: block_registers = ["i0", "i1"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i0->i2", "i1->i0", "i2->i1"]
+    // CHECK-SAME:   []
     // CHECK-SAME: ]
     vm.br ^bb1(%arg1, %arg0 : i32, i32)
   ^bb1(%0 : i32, %1 : i32):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0", "i1"]
+    // CHECK-SAME: block_registers = ["i1", "i0"]
     vm.return %0 : i32
   }
 
-  // CHECK-LABEL: @branch_args_cycle_64
-  vm.func @branch_args_cycle_64(%arg0 : i64, %arg1 : i64) -> i64 {
+  // CHECK-LABEL: @branch_args_coalesced_64
+  vm.func @branch_args_coalesced_64(%arg0 : i64, %arg1 : i64) -> i64 {
     // CHECK: vm.br
     // CHECK-SAME: block_registers = ["i0+1", "i2+3"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i0+1->i4+5", "i2+3->i0+1", "i4+5->i2+3"]
+    // CHECK-SAME:   []
     // CHECK-SAME: ]
     vm.br ^bb1(%arg1, %arg0 : i64, i64)
   ^bb1(%0 : i64, %1 : i64):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0+1", "i2+3"]
+    // CHECK-SAME: block_registers = ["i2+3", "i0+1"]
     vm.return %0 : i64
   }
 
+  // Back edges are allocated after the loop header and may still need cycles
+  // broken with scratch registers.
+  // CHECK-LABEL: @branch_args_cycle
+  vm.func @branch_args_cycle(%arg0 : i32, %arg1 : i32, %arg2 : i32) -> i32 {
+    vm.br ^bb1(%arg0, %arg1 : i32, i32)
+  ^bb1(%0 : i32, %1 : i32):
+    // CHECK: vm.cond_br
+    // CHECK-SAME: block_registers = ["i0", "i1"]
+    // CHECK-SAME: remap_registers = [
+    // CHECK-SAME:   ["i0->i3", "i1->i0", "i3->i1"],
+    // CHECK-SAME:   []
+    // CHECK-SAME: ]
+    vm.cond_br %arg2, ^bb1(%1, %0 : i32, i32), ^bb2
+  ^bb2:
+    vm.return %0 : i32
+  }
+
   // CHECK-LABEL: @branch_args_swizzled
   vm.func @branch_args_swizzled(%arg0 : i32, %arg1 : i32, %arg2 : i32) -> i32 {
     // CHECK: vm.br
     // CHECK-SAME: block_registers = ["i0", "i1", "i2"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i2->i3", "i0->i2", "i1->i0", "i3->i1"]
+    // CHECK-SAME:   []
     // CHECK-SAME: ]
     vm.br ^bb1(%arg1, %arg2, %arg0 : i32, i32, i32)
   ^bb1(%0 : i32, %1 : i32, %2 : i32):
     // CHECK: vm.br
-    // CHECK-SAME: block_registers = ["i0", "i1", "i2"]
+    // CHECK-SAME: block_registers = ["i1", "i2", "i0"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i0->i3", "i2->i0", "i3->i2"]
+    // CHECK-SAME:   []
     // CHECK-SAME: ]
     vm.br ^bb2(%2, %1, %0 : i32, i32, i32)
   ^bb2(%3 : i32, %4 : i32, %5 : i32):
     // CHECK: vm.br
-    // CHECK-SAME: block_registers = ["i0", "i1", "i2"]
+    // CHECK-SAME: block_registers = ["i0", "i2", "i1"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i0->i2", "i1->i0"]
+    // CHECK-SAME:   ["i0->i1", "i2->i0"]
     // CHECK-SAME: ]
     vm.br ^bb3(%4, %4, %3 : i32, i32, i32)
   ^bb3(%6 : i32, %7 : i32, %8 : i32):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0", "i1", "i2"]
+    // CHECK-SAME: block_registers = ["i2", "i0", "i1"]
     vm.return %6 : i32
   }
 
@@ -130,17 +147,17 @@ vm.module @module {
     // CHECK: vm.cond_br
     // CHECK-SAME: block_registers = ["i0", "i1", "i2"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i1->i0"],
-    // CHECK-SAME:   ["i2->i0"]
+    // CHECK-SAME:   [],
+    // CHECK-SAME:   []
     // CHECK-SAME: ]
     vm.cond_br %arg0, ^bb1(%arg1 : i32), ^bb2(%arg2 : i32)
   ^bb1(%0 : i32):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0"]
+    // CHECK-SAME: block_registers = ["i1"]
     vm.return %0 : i32
   ^bb2(%1 : i32):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0"]
+    // CHECK-SAME: block_registers = ["i2"]
     vm.return %1 : i32
   }
 
@@ -149,17 +166,17 @@ vm.module @module {
     // CHECK: vm.cond_br
     // CHECK-SAME: block_registers = ["i0", "i1", "i2"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i1->i0", "i2->i1"],
-    // CHECK-SAME:   ["i0->i3", "i1->i0", "i3->i1"]
+    // CHECK-SAME:   [],
+    // CHECK-SAME:   []
     // CHECK-SAME: ]
     vm.cond_br %arg0, ^bb1(%arg1, %arg2 : i32, i32), ^bb2(%arg1, %arg0 : i32, i32)
   ^bb1(%0 : i32, %1 : i32):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0", "i1"]
+    // CHECK-SAME: block_registers = ["i1", "i2"]
     vm.return %0 : i32
   ^bb2(%2 : i32, %3 : i32):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0", "i1"]
+    // CHECK-SAME: block_registers = ["i1", "i0"]
     vm.return %3 : i32
   }
 
@@ -168,17 +185,17 @@ vm.module @module {
     // CHECK: vm.cond_br
     // CHECK-SAME: block_registers = ["i0", "i2+3", "i4+5"]
     // CHECK-SAME: remap_registers = [
-    // CHECK-SAME:   ["i2+3->i0+1", "i4+5->i2+3"],
+    // CHECK-SAME:   [],
     // CHECK-SAME:   ["i2+3->i0+1"]
     // CHECK-SAME: ]
     vm.cond_br %arg0, ^bb1(%arg1, %arg2 : i64, i64), ^bb2(%arg1, %arg1 : i64, i64)
   ^bb1(%0 : i64, %1 : i64):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0+1", "i2+3"]
+    // CHECK-SAME: block_registers = ["i2+3", "i4+5"]
     vm.return %0 : i64
   ^bb2(%2 : i64, %3 : i64):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0+1", "i2+3"]
+    // CHECK-SAME: block_registers = ["i2+3", "i0+1"]
     vm.return %3 : i64
   }
 
@@ -210,12 +227,41 @@ vm.module @module {
     // CHECK: vm.cond_br
     // CHECK-SAME: remap_registers = [
     // CHECK-SAME:   [],
-    // CHECK-SAME:   ["i2->i0"]
+    // CHECK-SAME:   []
     // CHECK-SAME: ]
     vm.cond_br %cmp, ^loop(%in : i32), ^loop_exit(%in : i32)
   ^loop_exit(%ie : i32):
     // CHECK: vm.return
-    // CHECK-SAME: block_registers = ["i0"]
+    // CHECK-SAME: block_registers = ["i2"]
     vm.return %ie : i32
   }
+
+  // Values forwarded along the back edge prefer the registers of the loop
+  // header arguments.
+  // CHECK-LABEL: @loop_result_coalescing
+  vm.func @loop_result_coalescing(%arg0 : i32) -> i32 {
+    %c1 = vm.const.i32 1
+    vm.br ^loop(%arg0, %arg0 : i32, i32)
+  ^loop(%i : i32, %sum : i32):
+    // CHECK: vm.add.i32
+    // CHECK-SAME: block_registers = ["i0", "i2"]
+    // CHECK-SAME: result_registers = ["i3"]
+    %ni = vm.add.i32 %i, %c1 : i32
+    // CHECK: vm.add.i32
+    // CHECK-SAME: result_registers = ["i2"]
+    %nsum = vm.add.i32 %sum, %i : i32
+    // CHECK: vm.cmp.lt.i32.s
+    // CHECK-SAME: result_registers = ["i0"]
+    %cmp = vm.cmp.lt.i32.s %ni, %c1 : i32
+    // CHECK: vm.cond_br
+    // CHECK-SAME: remap_registers = [
+    // CHECK-SAME:   ["i3->i0"],
+    // CHECK-SAME:   []
+    // CHECK-SAME: ]
+    vm.cond_br %cmp, ^loop(%ni, %nsum : i32, i32), ^exit(%nsum : i32)
+  ^exit(%result : i32):
+    // CHECK: vm.return
+    // CHECK-SAME: block_registers = ["i2"]
+    vm.return %result : i32
+  }
 }
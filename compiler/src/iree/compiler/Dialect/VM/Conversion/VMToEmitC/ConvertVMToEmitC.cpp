@@ -24,6 +24,7 @@
 #include "mlir/IR/BuiltinDialect.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/Matchers.h"
+#include "mlir/Interfaces/SideEffectInterfaces.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Transforms/DialectConversion.h"
 
@@ -687,6 +688,17 @@ mlir::func::CallOp returnIfError(OpBuilder &builder, Location location,
                                  mlir::func::FuncOp &callee,
                                  ArrayRef<Value> operands,
                                  IREE::VM::EmitCTypeConverter &typeConverter) {
+  // Calls to functions that are known to always succeed don't need to check
+  // the returned status.
+  auto calleeAnalysis = typeConverter.analysisCache.find(callee.getOperation());
+  if (calleeAnalysis != typeConverter.analysisCache.end() &&
+      !calleeAnalysis->second.canFail) {
+    return builder.create<mlir::func::CallOp>(
+        /*location=*/location,
+        /*callee=*/callee,
+        /*operands=*/operands);
+  }
+
   auto blockBuilder = [&builder, &location,
                        &typeConverter](mlir::func::CallOp &callOp) {
     Block *block = builder.getBlock();
@@ -5006,6 +5018,50 @@ namespace {
 //   (iir) -> (ri) => (iree_vm_stack_t*, module_t*, module_state_t*, int32_t,
 //                      int32_t, iree_vm_ref_t*, iree_vm_ref_t*, int32_t*) ->
 //                      iree_status_t
+/// Returns the functions in |moduleOp| that can never return a failure status.
+/// These only contain side-effect free ops on primitive values, control flow
+/// and calls to other such functions, none of which are lowered to failable
+/// calls.
+DenseSet<Operation *> findInfallibleFuncs(IREE::VM::ModuleOp moduleOp) {
+  DenseSet<Operation *> infallibleFuncs;
+  auto isRefType = [](Type type) { return type.isa<IREE::VM::RefType>(); };
+  auto isInfallibleOp = [&](Operation &op) {
+    if (isa<IREE::VM::BranchOp, IREE::VM::CondBranchOp, IREE::VM::ReturnOp>(
+            op)) {
+      return true;
+    }
+    if (llvm::any_of(op.getOperandTypes(), isRefType) ||
+        llvm::any_of(op.getResultTypes(), isRefType)) {
+      return false;
+    }
+    if (auto callOp = dyn_cast<IREE::VM::CallOp>(op)) {
+      auto calleeOp = moduleOp.lookupSymbol<IREE::VM::FuncOp>(callOp.callee());
+      return calleeOp && infallibleFuncs.contains(calleeOp);
+    }
+    auto effects = dyn_cast<MemoryEffectOpInterface>(op);
+    return effects && effects.hasNoEffect();
+  };
+
+  // Iterate to a fixed point so that callers of infallible functions are
+  // found regardless of the function order. Recursive functions are
+  // conservatively treated as failable.
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (auto funcOp : moduleOp.getOps<IREE::VM::FuncOp>()) {
+      if (infallibleFuncs.contains(funcOp)) continue;
+      bool isInfallible = llvm::all_of(funcOp.getBlocks(), [&](Block &block) {
+        return llvm::all_of(block, isInfallibleOp);
+      });
+      if (isInfallible) {
+        infallibleFuncs.insert(funcOp);
+        changed = true;
+      }
+    }
+  }
+  return infallibleFuncs;
+}
+
 class ConvertVMToEmitCPass
     : public PassWrapper<ConvertVMToEmitCPass,
                          OperationPass<IREE::VM::ModuleOp>> {
@@ -5036,10 +5092,13 @@ class ConvertVMToEmitCPass
     // conversion.
     SmallVector<IREE::VM::FuncOp, 4> funcsToRemove;
     SmallVector<BlockArgument, 4> blockArgsToRemove;
+    DenseSet<Operation *> infallibleFuncs = findInfallibleFuncs(module);
     for (auto funcOp : module.getOps<IREE::VM::FuncOp>()) {
       Operation *op = funcOp.getOperation();
+      VMAnalysis vmAnalysis(funcOp);
+      vmAnalysis.canFail = !infallibleFuncs.contains(op);
       typeConverter.analysisCache.insert(
-          std::make_pair(op, VMAnalysis(funcOp)));
+          std::make_pair(op, std::move(vmAnalysis)));
 
       if (failed(convertFuncOp(funcOp, typeConverter, blockArgsToRemove))) {
         return signalPassFailure();
@@ -58,6 +58,9 @@ struct VMAnalysis {
   DenseMap<int64_t, Operation *> &localRefs() { return refs; }
   size_t numRefArguments;
   FunctionType originalFunctionType;
+  // False if the function is known to never return a failure status, in which
+  // case callers don't need to check it.
+  bool canFail = true;
 
  private:
   RegisterAllocation registerAllocation;
@@ -105,6 +105,10 @@ vm.module @my_module {
     // CHECK-SAME:     : (!emitc.ptr<!emitc.opaque<"iree_vm_stack_t">>, !emitc.ptr<!emitc.opaque<"my_module_t">>,
     // CHECK-SAME:        !emitc.ptr<!emitc.opaque<"my_module_state_t">>, i32, !emitc.ptr<!emitc.opaque<"int32_t">>)
     // CHECK-SAME:     -> !emitc.opaque<"iree_status_t">
+
+    // The callee can't fail so the status is not checked.
+    // CHECK-NOT: emitc.cast
+    // CHECK: emitc.call "iree_ok_status"()
     %0 = vm.call @internal_fn(%arg0) : (i32) -> i32
     vm.return %0 : i32
   }
@@ -112,6 +116,27 @@ vm.module @my_module {
 
 // -----
 
+// Test vm.call conversion on an internal function that may fail.
+vm.module @my_module {
+  vm.func @failable_fn(%arg0 : i32) -> i32 {
+    vm.cond_br %arg0, ^bb1, ^bb2
+  ^bb1:
+    vm.fail %arg0, "message"
+  ^bb2:
+    vm.return %arg0 : i32
+  }
+
+  // CHECK-LABEL: @my_module_call_failable_fn
+  vm.func @call_failable_fn(%arg0 : i32) -> i32 {
+    // CHECK: %[[STATUS:.+]] = call @my_module_failable_fn
+    // CHECK-NEXT: %{{.+}} = emitc.cast %[[STATUS]] : !emitc.opaque<"iree_status_t"> to i1
+    %0 = vm.call @failable_fn(%arg0) : (i32) -> i32
+    vm.return %0 : i32
+  }
+}
+
+// -----
+
 // Test vm.call.variadic conversion on an imported function.
 vm.module @my_module {
   // CHECK: func.func @my_module_call_[[VARIADICFN:[^\(]+]]
@@ -2612,6 +2612,29 @@ struct SimplifySameTargetCondBranchOp : public OpRewritePattern<CondBranchOp> {
   }
 };
 
+/// Branches directly on the value being compared against zero as cond_br
+/// already tests its condition for non-zero. This saves a compare instruction
+/// and its register on each branch.
+struct SimplifyCmpNZCondBranchPred : public OpRewritePattern<CondBranchOp> {
+  using OpRewritePattern<CondBranchOp>::OpRewritePattern;
+  LogicalResult matchAndRewrite(CondBranchOp op,
+                                PatternRewriter &rewriter) const override {
+    if (auto cmpOp = op.condition().getDefiningOp<CmpNZI32Op>()) {
+      rewriter.replaceOpWithNewOp<CondBranchOp>(
+          op, cmpOp.operand(), op.getTrueDest(), op.getTrueOperands(),
+          op.getFalseDest(), op.getFalseOperands());
+      return success();
+    } else if (auto eqOp = op.condition().getDefiningOp<CmpEQI32Op>()) {
+      if (!matchPattern(eqOp.rhs(), m_Zero())) return failure();
+      rewriter.replaceOpWithNewOp<CondBranchOp>(
+          op, eqOp.lhs(), op.getFalseDest(), op.getFalseOperands(),
+          op.getTrueDest(), op.getTrueOperands());
+      return success();
+    }
+    return failure();
+  }
+};
+
 /// Swaps the cond_br true and false targets if the condition is inverted.
 struct SwapInvertedCondBranchOpTargets : public OpRewritePattern<CondBranchOp> {
   using OpRewritePattern<CondBranchOp>::OpRewritePattern;
@@ -2641,7 +2664,8 @@ struct SwapInvertedCondBranchOpTargets : public OpRewritePattern<CondBranchOp> {
 void CondBranchOp::getCanonicalizationPatterns(RewritePatternSet &results,
                                                MLIRContext *context) {
   results.insert<SimplifyConstCondBranchPred, SimplifySameTargetCondBranchOp,
-                 SwapInvertedCondBranchOpTargets>(context);
+                 SimplifyCmpNZCondBranchPred, SwapInvertedCondBranchOpTargets>(
+      context);
 }
 
 namespace {
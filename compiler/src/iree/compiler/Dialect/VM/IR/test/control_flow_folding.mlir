@@ -43,6 +43,25 @@ vm.module @cond_br_folds {
     vm.return %0 : i32
   }
 
+  // CHECK-LABEL: @cmp_nz_cond_br
+  vm.func @cmp_nz_cond_br(%arg0 : i32, %arg1 : i32, %arg2 : i32) -> i32 {
+    // CHECK-NEXT: vm.cond_br %arg0, ^bb1(%arg1 : i32), ^bb1(%arg2 : i32)
+    %nz = vm.cmp.nz.i32 %arg0 : i32
+    vm.cond_br %nz, ^bb1(%arg1 : i32), ^bb1(%arg2 : i32)
+  ^bb1(%0 : i32):
+    vm.return %0 : i32
+  }
+
+  // CHECK-LABEL: @cmp_eqz_cond_br
+  vm.func @cmp_eqz_cond_br(%arg0 : i32, %arg1 : i32, %arg2 : i32) -> i32 {
+    // CHECK-NEXT: vm.cond_br %arg0, ^bb1(%arg2 : i32), ^bb1(%arg1 : i32)
+    %zero = vm.const.i32.zero
+    %eqz = vm.cmp.eq.i32 %arg0, %zero : i32
+    vm.cond_br %eqz, ^bb1(%arg1 : i32), ^bb1(%arg2 : i32)
+  ^bb1(%0 : i32):
+    vm.return %0 : i32
+  }
+
   // TODO(benvanik): fix swapping by proper cond^1 check.
   // // DISABLED-LABEL: @swap_inverted_cond_br
   // vm.func @swap_inverted_cond_br(%arg0 : i32, %arg1 : i32, %arg2 : i32) -> i32 {
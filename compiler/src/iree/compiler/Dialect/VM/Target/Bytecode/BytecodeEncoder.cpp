@@ -46,6 +46,7 @@ class V0BytecodeEncoder : public BytecodeEncoder {
   LogicalResult endOp(Operation *op) override {
     // TODO(benvanik): encode source information (end).
     currentOp_ = nullptr;
+    ++instructionCount_;
     return success();
   }
 
@@ -190,6 +191,7 @@ class V0BytecodeEncoder : public BytecodeEncoder {
     if (failed(ensureAlignment(2)) || failed(writeUint16(srcDstRegs.size()))) {
       return failure();
     }
+    branchMoveCount_ += srcDstRegs.size();
     for (auto srcDstReg : srcDstRegs) {
       if (failed(writeUint16(srcDstReg.first.encode())) ||
           failed(writeUint16(srcDstReg.second.encode()))) {
@@ -251,6 +253,9 @@ class V0BytecodeEncoder : public BytecodeEncoder {
 
   size_t getOffset() const { return bytecode_.size(); }
 
+  int64_t getInstructionCount() const { return instructionCount_; }
+  int64_t getBranchMoveCount() const { return branchMoveCount_; }
+
   LogicalResult ensureAlignment(size_t alignment) {
     size_t paddedSize = (bytecode_.size() + (alignment - 1)) & ~(alignment - 1);
     size_t padding = paddedSize - bytecode_.size();
@@ -322,6 +327,9 @@ class V0BytecodeEncoder : public BytecodeEncoder {
   std::vector<uint8_t> bytecode_;
   llvm::DenseMap<Block *, size_t> blockOffsets_;
   std::vector<std::pair<Block *, size_t>> blockOffsetFixups_;
+
+  int64_t instructionCount_ = 0;
+  int64_t branchMoveCount_ = 0;
 };
 
 }  // namespace
@@ -386,6 +394,8 @@ Optional<EncodedBytecodeFunction> BytecodeEncoder::encodeFunction(
   result.bytecodeData = bytecodeData.getValue();
   result.i32RegisterCount = registerAllocation.getMaxI32RegisterOrdinal() + 1;
   result.refRegisterCount = registerAllocation.getMaxRefRegisterOrdinal() + 1;
+  result.instructionCount = encoder.getInstructionCount();
+  result.branchMoveCount = encoder.getBranchMoveCount();
   return result;
 }
 
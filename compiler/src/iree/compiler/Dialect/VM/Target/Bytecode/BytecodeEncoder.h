@@ -26,6 +26,11 @@ struct EncodedBytecodeFunction {
   uint16_t i32RegisterCount = 0;
   // Total vm.ref register slots required for execution.
   uint16_t refRegisterCount = 0;
+
+  // Total number of instructions encoded in the function body.
+  int64_t instructionCount = 0;
+  // Total number of register moves encoded on branch edges.
+  int64_t branchMoveCount = 0;
 };
 
 // Abstract encoder used for function bytecode encoding.
@@ -27,6 +27,11 @@
 #include "llvm/Support/CRC.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/ToolOutputFile.h"
+#include "llvm/Support/raw_ostream.h"
 #include "mlir/IR/Attributes.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/Diagnostics.h"
@@ -34,6 +39,7 @@
 #include "mlir/IR/Visitors.h"
 #include "mlir/Pass/Pass.h"
 #include "mlir/Pass/PassManager.h"
+#include "mlir/Support/FileUtilities.h"
 #include "mlir/Tools/mlir-translate/Translation.h"
 #include "mlir/Transforms/DialectConversion.h"
 #include "mlir/Transforms/LocationSnapshot.h"
@@ -58,6 +64,11 @@ static constexpr int kDefaultRodataAlignment = 16;
 // data at the risk of tripping the 31-bit FlatBuffer offset values.
 static constexpr int kMaxEmbeddedDataSize = 4 * 1024;
 
+// Minimum alignment of data in the parameter archive. Page-aligning each
+// segment allows the runtime to map the archive and use the data in-place and
+// for processes mapping the same archive to share the physical pages.
+static constexpr int kParameterAlignment = 4 * 1024;
+
 struct TypeDef {
   Type type;
   std::string full_name;
@@ -74,6 +85,8 @@ struct RodataRef {
   uint64_t totalSize = 0;
   // Optional reference to the rodata in the file.
   Optional<ArchiveWriter::File> archiveFile;
+  // Optional offset of the rodata in the parameter archive.
+  Optional<uint64_t> parameterOffset;
 };
 
 }  // namespace
@@ -303,6 +316,40 @@ static iree_vm_FunctionSignatureDef_ref_t makeInternalFunctionSignatureDef(
                                     cconv.getValue(), /*attrsRef=*/0, fbb);
 }
 
+// Writes the rodata with parameter offsets assigned to the parameter archive at
+// |path|. Segments are written in offset order and the space between them is
+// zero-filled.
+static LogicalResult writeParameterArchive(Location loc, StringRef path,
+                                           ArrayRef<RodataRef> rodataRefs) {
+  std::error_code ec;
+  llvm::raw_fd_ostream os(path, ec, llvm::sys::fs::OF_None);
+  if (ec) {
+    return mlir::emitError(loc) << "failed to open parameter archive '"
+                                << path << "': " << ec.message();
+  }
+  uint64_t offset = 0;
+  for (auto &rodataRef : rodataRefs) {
+    if (!rodataRef.parameterOffset.hasValue()) continue;
+    uint64_t parameterOffset = rodataRef.parameterOffset.getValue();
+    assert(parameterOffset >= offset && "expected ordered parameters");
+    os.write_zeros(parameterOffset - offset);
+    auto rodataValue = rodataRef.rodataOp.value()
+                           .cast<IREE::Util::SerializableAttrInterface>();
+    if (failed(rodataValue.serializeToStream(llvm::support::endianness::little,
+                                             os))) {
+      return rodataRef.rodataOp.emitError()
+             << "failed to serialize rodata to the parameter archive";
+    }
+    offset = parameterOffset + rodataRef.totalSize;
+  }
+  os.close();
+  if (os.has_error()) {
+    return mlir::emitError(loc) << "failed to write parameter archive '"
+                                << path << "': " << os.error().message();
+  }
+  return success();
+}
+
 // Builds a complete BytecodeModuleDef FlatBuffer object in |fbb|.
 // The order of the encoding is ordered to ensure that all metadata is at the
 // front of the resulting buffer. Large read-only data and bytecode blobs always
@@ -313,6 +360,54 @@ static iree_vm_FunctionSignatureDef_ref_t makeInternalFunctionSignatureDef(
 // has been packed into the top-level table. This results in a messier function
 // here during serialization but a much more trivial (and cache-friendly)
 // representation at runtime.
+// Size and instruction statistics of the bytecode of a single function.
+struct FunctionStatistics {
+  StringRef name;
+  size_t bytecodeLength = 0;
+  int64_t instructionCount = 0;
+  int64_t branchMoveCount = 0;
+  uint16_t i32RegisterCount = 0;
+  uint16_t refRegisterCount = 0;
+};
+
+// Writes a report of per-function bytecode statistics to |path| ("-" for
+// stderr). Instruction and branch move counts are a proxy for the interpreter
+// dispatch overhead of each function invocation.
+static LogicalResult writeBytecodeStatistics(
+    IREE::VM::ModuleOp moduleOp, StringRef path,
+    ArrayRef<FunctionStatistics> functionStatistics) {
+  std::string error;
+  std::unique_ptr<llvm::ToolOutputFile> file;
+  if (path != "-") {
+    file = mlir::openOutputFile(path, &error);
+    if (!file) {
+      return moduleOp.emitError()
+             << "failed to open bytecode statistics file '" << path
+             << "': " << error;
+    }
+  }
+  llvm::raw_ostream &os = file ? file->os() : llvm::errs();
+
+  os << "bytecode statistics for module @" << moduleOp.sym_name() << ":\n";
+  FunctionStatistics total;
+  for (auto &stats : functionStatistics) {
+    os << llvm::formatv(
+        "  @{0}: {1} bytes, {2} instructions, {3} branch moves, {4} i32 "
+        "registers, {5} ref registers\n",
+        stats.name, stats.bytecodeLength, stats.instructionCount,
+        stats.branchMoveCount, stats.i32RegisterCount, stats.refRegisterCount);
+    total.bytecodeLength += stats.bytecodeLength;
+    total.instructionCount += stats.instructionCount;
+    total.branchMoveCount += stats.branchMoveCount;
+  }
+  os << llvm::formatv(
+      "  total: {0} bytes, {1} instructions, {2} branch moves\n",
+      total.bytecodeLength, total.instructionCount, total.branchMoveCount);
+
+  if (file) file->keep();
+  return success();
+}
+
 static LogicalResult buildFlatBufferModule(
     BytecodeTargetOptions targetOptions, IREE::VM::ModuleOp moduleOp,
     MutableArrayRef<RodataRef> rodataRefs, FlatbufferBuilder &fbb) {
@@ -363,8 +458,10 @@ static LogicalResult buildFlatBufferModule(
   // Serialize function bytecode one at a time and then merge at the end.
   SmallVector<std::vector<uint8_t>, 8> bytecodeDataParts;
   SmallVector<iree_vm_FunctionDescriptor_t, 8> functionDescriptors;
+  SmallVector<FunctionStatistics, 8> functionStatistics;
   bytecodeDataParts.resize(internalFuncOps.size());
   functionDescriptors.resize(internalFuncOps.size());
+  functionStatistics.resize(internalFuncOps.size());
   size_t totalBytecodeLength = 0;
   for (auto funcOp : llvm::enumerate(internalFuncOps)) {
     auto encodedFunction = BytecodeEncoder::encodeFunction(
@@ -377,9 +474,21 @@ static LogicalResult buildFlatBufferModule(
         encodedFunction->bytecodeData.size(), encodedFunction->i32RegisterCount,
         encodedFunction->refRegisterCount);
     totalBytecodeLength += encodedFunction->bytecodeData.size();
+    auto &stats = functionStatistics[funcOp.index()];
+    stats.name = funcOp.value().getName();
+    stats.bytecodeLength = encodedFunction->bytecodeData.size();
+    stats.instructionCount = encodedFunction->instructionCount;
+    stats.branchMoveCount = encodedFunction->branchMoveCount;
+    stats.i32RegisterCount = encodedFunction->i32RegisterCount;
+    stats.refRegisterCount = encodedFunction->refRegisterCount;
     bytecodeDataParts[funcOp.index()] =
         std::move(encodedFunction->bytecodeData);
   }
+  if (!targetOptions.statisticsPath.empty() &&
+      failed(writeBytecodeStatistics(moduleOp, targetOptions.statisticsPath,
+                                     functionStatistics))) {
+    return failure();
+  }
   flatbuffers_uint8_vec_start(fbb);
   uint8_t *bytecodeDataPtr =
       flatbuffers_uint8_vec_extend(fbb, totalBytecodeLength);
@@ -413,15 +522,23 @@ static LogicalResult buildFlatBufferModule(
   // in the IR. Though this it isn't required for correctness, enabling file
   // layout planning by preserving the order in the IR is useful.
   SmallVector<iree_vm_RodataSegmentDef_ref_t, 8> rodataSegmentRefs;
+  bool anyParameterData = false;
   for (auto &rodataRef : llvm::reverse(rodataRefs)) {
     flatbuffers_uint8_vec_ref_t embedded_ref = 0;
-    if (!rodataRef.archiveFile.hasValue()) {
+    iree_vm_ParameterDataDef_ref_t parameter_ref = 0;
+    if (rodataRef.parameterOffset.hasValue()) {
+      parameter_ref = iree_vm_ParameterDataDef_create(
+          fbb, rodataRef.parameterOffset.getValue(), rodataRef.totalSize);
+      anyParameterData = true;
+    } else if (!rodataRef.archiveFile.hasValue()) {
       embedded_ref = serializeEmbeddedData(
           rodataRef.rodataOp.getLoc(), rodataRef.rodataOp.value(),
           rodataRef.alignment, rodataRef.totalSize, fbb);
     }
     iree_vm_RodataSegmentDef_start(fbb);
-    if (rodataRef.archiveFile.hasValue()) {
+    if (parameter_ref) {
+      iree_vm_RodataSegmentDef_parameter_data_add(fbb, parameter_ref);
+    } else if (rodataRef.archiveFile.hasValue()) {
       iree_vm_RodataSegmentDef_external_data_offset_add(
           fbb, rodataRef.archiveFile->relativeOffset +
                    rodataRef.archiveFile->prefixLength);
@@ -506,6 +623,12 @@ static LogicalResult buildFlatBufferModule(
   auto moduleNameRef = fbb.createString(
       moduleOp.sym_name().empty() ? "module" : moduleOp.sym_name());
 
+  flatbuffers_string_ref_t parameterArchiveRef = 0;
+  if (anyParameterData) {
+    parameterArchiveRef = fbb.createString(
+        llvm::sys::path::filename(targetOptions.parameterArchive));
+  }
+
   iree_vm_BytecodeModuleDef_name_add(fbb, moduleNameRef);
   iree_vm_BytecodeModuleDef_types_add(fbb, typesRef);
   iree_vm_BytecodeModuleDef_imported_functions_add(fbb, importFuncsRef);
@@ -519,6 +642,9 @@ static LogicalResult buildFlatBufferModule(
                                                  BytecodeEncoder::kVersion);
   iree_vm_BytecodeModuleDef_bytecode_data_add(fbb, bytecodeDataRef);
   iree_vm_BytecodeModuleDef_debug_database_add(fbb, debugDatabaseRef);
+  if (parameterArchiveRef) {
+    iree_vm_BytecodeModuleDef_parameter_archive_add(fbb, parameterArchiveRef);
+  }
   iree_vm_BytecodeModuleDef_end_as_root(fbb);
 
   return success();
@@ -597,6 +723,7 @@ LogicalResult translateModuleToBytecode(IREE::VM::ModuleOp moduleOp,
   }
   SmallVector<RodataRef> rodataRefs;
   rodataRefs.resize(rodataOps.size());
+  uint64_t parameterArchiveSize = 0;
   for (auto &rodataOp : rodataOps) {
     auto rodataValue =
         rodataOp.value().dyn_cast<IREE::Util::SerializableAttrInterface>();
@@ -615,7 +742,20 @@ LogicalResult translateModuleToBytecode(IREE::VM::ModuleOp moduleOp,
     rodataRef.alignment = rodataOp.alignment() ? rodataOp.alignment().getValue()
                                                : kDefaultRodataAlignment;
     rodataRef.totalSize = static_cast<uint64_t>(actualSize);
-    if (storeExternal) {
+
+    // Large constant data (anything without a mime type, such as packed
+    // constant pools) can be routed to the parameter archive instead.
+    bool storeParameter = !targetOptions.parameterArchive.empty() &&
+                          !rodataOp.mime_type().hasValue() &&
+                          actualSize >= kMaxEmbeddedDataSize;
+    if (storeParameter) {
+      uint64_t alignment =
+          std::max<uint64_t>(rodataRef.alignment, kParameterAlignment);
+      rodataRef.parameterOffset =
+          IREE::Util::align(parameterArchiveSize, alignment);
+      parameterArchiveSize =
+          rodataRef.parameterOffset.getValue() + rodataRef.totalSize;
+    } else if (storeExternal) {
       std::string fileName =
           (rodataOp.getName() +
            mimeTypeToFileExtension(rodataOp.mime_type().getValueOr("")))
@@ -643,6 +783,13 @@ LogicalResult translateModuleToBytecode(IREE::VM::ModuleOp moduleOp,
   }
   archiveWriter.reset();
 
+  if (parameterArchiveSize > 0 &&
+      failed(writeParameterArchive(moduleOp.getLoc(),
+                                   targetOptions.parameterArchive,
+                                   rodataRefs))) {
+    return failure();
+  }
+
   return success();
 }
 
@@ -697,6 +844,19 @@ void BytecodeTargetOptions::bindOptions(OptionsBinder &binder) {
       llvm::cl::desc(
           "Enables output files to be viewed as zip files for debugging "
           "(only applies to binary targets)"));
+  binder.opt<std::string>(
+      "iree-vm-bytecode-module-parameter-archive", parameterArchive,
+      llvm::cl::cat(vmBytecodeOptionsCategory),
+      llvm::cl::desc(
+          "Writes large constant data to a page-aligned parameter archive at "
+          "the given path instead of embedding it in the module; the archive "
+          "must be placed next to the module at runtime"));
+  binder.opt<std::string>(
+      "iree-vm-bytecode-module-statistics", statisticsPath,
+      llvm::cl::cat(vmBytecodeOptionsCategory),
+      llvm::cl::desc(
+          "Writes per-function bytecode size, instruction count, and branch "
+          "register move count to the given file ('-' for stderr)"));
 }
 
 }  // namespace VM
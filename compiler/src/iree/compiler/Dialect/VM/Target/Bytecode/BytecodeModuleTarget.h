@@ -56,6 +56,16 @@ struct BytecodeTargetOptions {
   // should be disabled in release builds.
   bool emitPolyglotZip = true;
 
+  // Path of a parameter archive file that large constant rodata is written to
+  // instead of the module. Each segment is page-aligned within the file such
+  // that the runtime can map the archive and reference the data in-place. The
+  // module references the archive by file name relative to itself.
+  std::string parameterArchive;
+
+  // Path of a file that per-function bytecode statistics (size, instruction
+  // count, branch register moves) are written to or '-' for stderr.
+  std::string statisticsPath;
+
   void bindOptions(OptionsBinder &binder);
   using FromFlags = OptionsFromFlags<BytecodeTargetOptions>;
 };
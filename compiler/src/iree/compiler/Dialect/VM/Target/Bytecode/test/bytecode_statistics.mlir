@@ -0,0 +1,14 @@
+// RUN: iree-compile --compile-mode=vm \
+// RUN:   --iree-vm-bytecode-module-output-format=flatbuffer-text \
+// RUN:   --iree-vm-bytecode-module-statistics=- %s -o /dev/null 2>&1 | \
+// RUN:   FileCheck %s
+
+// CHECK: bytecode statistics for module @statistics_module:
+vm.module @statistics_module {
+  vm.export @identity
+  // CHECK-NEXT: @identity: 8 bytes, 1 instructions, 0 branch moves, 1 i32 registers, 0 ref registers
+  vm.func @identity(%arg0 : i32) -> i32 {
+    vm.return %arg0 : i32
+  }
+  // CHECK-NEXT: total: 8 bytes, 1 instructions, 0 branch moves
+}
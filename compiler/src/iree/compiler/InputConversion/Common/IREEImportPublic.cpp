@@ -104,7 +104,7 @@ class BufferViewToTensorPattern
       // will get it).
       rewriter.replaceOpWithNewOp<IREE::HAL::TensorImportOp>(
           srcOp, resultType, adaptor.source(), TypeAttr::get(resultType),
-          adaptor.target_dims());
+          adaptor.target_dims(), /*wait_fence=*/Value{});
     }
     return success();
   }
@@ -319,6 +319,10 @@ struct ScatterOpConversion : public OpConversionPattern<mhlo::ScatterOp> {
 struct FftOpConversion : public OpConversionPattern<mhlo::FftOp> {
   using OpConversionPattern<mhlo::FftOp>::OpConversionPattern;
 
+  // Largest FFT length that is not a power of two lowered to a DFT matmul.
+  // The DFT matrices hold 2 * n * (n / 2 + 1) constants.
+  static constexpr int kMaxDFTMatmulLength = 1024;
+
   static Value getBitReversalBuffer(ImplicitLocOpBuilder &b, int fftLength) {
     SmallVector<Attribute> values;
     int logn = std::log(fftLength) / std::log(2);
@@ -392,21 +396,103 @@ struct FftOpConversion : public OpConversionPattern<mhlo::FftOp> {
                                     DenseFPElementsAttr::get(type, imag))};
   }
 
+  // Computes the real and imaginary parts of the first `fftLength / 2 + 1`
+  // DFT coefficients as a single matmul of the operand, with all leading
+  // dimensions batched into the rows, against the DFT matrix. This is O(n^2)
+  // but supports any FFT length and keeps all stages in one dispatch.
+  static SmallVector<Value> getDFTMatmul(ImplicitLocOpBuilder &b, Value real,
+                                         int fftLength) {
+    auto realType = real.getType().cast<RankedTensorType>();
+    int64_t rank = realType.getRank();
+    int64_t outputLength = fftLength / 2 + 1;
+    int64_t batchSize = 1;
+    for (int64_t dim : realType.getShape().drop_back()) batchSize *= dim;
+
+    // Flatten the operand to [batch, fftLength].
+    SmallVector<ReassociationIndices> reassociation;
+    if (rank == 1) {
+      reassociation.push_back({0, 1});
+    } else {
+      reassociation.push_back(
+          llvm::to_vector(llvm::seq<int64_t>(0, rank - 1)));
+      reassociation.push_back({rank - 1});
+    }
+    auto lhsType = RankedTensorType::get({batchSize, fftLength},
+                                         realType.getElementType());
+    Value lhs = real;
+    if (rank == 1) {
+      lhs = b.create<tensor::ExpandShapeOp>(lhsType, real, reassociation);
+    } else if (rank > 2) {
+      lhs = b.create<tensor::CollapseShapeOp>(lhsType, real, reassociation);
+    }
+
+    SmallVector<Attribute> cosValues, sinValues;
+    for (int n = 0; n < fftLength; ++n) {
+      for (int k = 0; k < outputLength; ++k) {
+        // Reduce k * n first so that the angle stays in [0, 2pi).
+        double angle = 2 * M_PI * ((int64_t(k) * n) % fftLength) / fftLength;
+        cosValues.push_back(b.getF32FloatAttr(std::cos(angle)));
+        sinValues.push_back(b.getF32FloatAttr(-std::sin(angle)));
+      }
+    }
+    auto coeffType = RankedTensorType::get({fftLength, outputLength},
+                                           b.getF32Type());
+    auto resultType = RankedTensorType::get({batchSize, outputLength},
+                                            realType.getElementType());
+    Value zero =
+        b.create<arith::ConstantOp>(b.getF32Type(), b.getF32FloatAttr(0.0));
+    Value init = b.create<linalg::InitTensorOp>(
+        ValueRange{}, resultType.getShape(), resultType.getElementType());
+    Value fill = b.create<linalg::FillOp>(zero, init).result();
+
+    SmallVector<int64_t> shape(realType.getShape().begin(),
+                               realType.getShape().end());
+    shape.back() = outputLength;
+    auto type = RankedTensorType::get(shape, realType.getElementType());
+    auto dftMatmul = [&](ArrayRef<Attribute> values) -> Value {
+      Value coeffs = b.create<arith::ConstantOp>(
+          coeffType, DenseFPElementsAttr::get(coeffType, values));
+      Value matmul = b.create<linalg::MatmulOp>(TypeRange{resultType},
+                                                ValueRange{lhs, coeffs},
+                                                ValueRange{fill})
+                         .getResult(0);
+      // Restore the leading dimensions.
+      if (rank == 1) {
+        return b.create<tensor::CollapseShapeOp>(type, matmul, reassociation);
+      } else if (rank > 2) {
+        return b.create<tensor::ExpandShapeOp>(type, matmul, reassociation);
+      }
+      return matmul;
+    };
+    return {dftMatmul(cosValues), dftMatmul(sinValues)};
+  }
+
   LogicalResult matchAndRewrite(
       mhlo::FftOp op, OpAdaptor adaptor,
       ConversionPatternRewriter &rewriter) const final {
-    // Only handle 2^n fft length.
     auto operandType = adaptor.operand().getType().dyn_cast<RankedTensorType>();
     if (!operandType || !operandType.hasStaticShape()) {
       return failure();
     }
     int fftLength = op.fft_length().getSplatValue<IntegerAttr>().getInt();
+
+    ImplicitLocOpBuilder b(op.getLoc(), rewriter);
+
+    // Lengths that are not a power of two (such as the 400 point windows
+    // common in audio front-ends) are computed as a DFT matmul.
     if (fftLength & (fftLength - 1)) {
-      return rewriter.notifyMatchFailure(
-          op, "expected FFT length to be a power of two");
+      if (fftLength > kMaxDFTMatmulLength) {
+        return rewriter.notifyMatchFailure(
+            op, "expected FFT length to be a power of two or at most " +
+                    Twine(kMaxDFTMatmulLength));
+      }
+      SmallVector<Value> results =
+          getDFTMatmul(b, adaptor.operand(), fftLength);
+      rewriter.replaceOpWithNewOp<mhlo::ComplexOp>(op, op.getType(),
+                                                   results[0], results[1]);
+      return success();
     }
 
-    ImplicitLocOpBuilder b(op.getLoc(), rewriter);
     SmallVector<Value> results =
         getBitReversalOrder(b, adaptor.operand(), fftLength);
     int lognPlus1 = std::log(fftLength) / std::log(2) + 1;
@@ -501,6 +501,103 @@ class ScatterRank0Value : public OpRewritePattern<mhlo::ScatterOp> {
   }
 };
 
+// Rewrites a gather of full slices along a single operand dimension into a
+// torch_index_select along that dimension, followed by a transpose when the
+// gather places the batch dimensions elsewhere in the result. This covers the
+// embedding lookups and `take` along an axis that the upstream pattern only
+// handles for dimension 0. torch_index_select lowers to a linalg.generic that
+// reads the indices as an input, so it fuses with the producers of the indices
+// and with elementwise consumers instead of extracting every index.
+class GatherAlongDimToTorchIndexSelect
+    : public OpRewritePattern<mhlo::GatherOp> {
+ public:
+  using OpRewritePattern<mhlo::GatherOp>::OpRewritePattern;
+
+  LogicalResult matchAndRewrite(mhlo::GatherOp op,
+                                PatternRewriter &rewriter) const override {
+    Value operand = op.operand();
+    Value indices = op.start_indices();
+    auto operandTy = operand.getType().dyn_cast<RankedTensorType>();
+    auto indicesTy = indices.getType().dyn_cast<RankedTensorType>();
+    auto resultTy = op.getType().dyn_cast<RankedTensorType>();
+    if (!operandTy || !indicesTy || !resultTy) return failure();
+
+    auto dimNumbers = op.dimension_numbers();
+    auto startIndexMap = dimNumbers.getStartIndexMap();
+    if (startIndexMap.size() != 1) return failure();
+    int64_t dim = startIndexMap.front();
+    auto collapsedSliceDims = dimNumbers.getCollapsedSliceDims();
+    if (collapsedSliceDims.size() != 1 || collapsedSliceDims.front() != dim) {
+      return failure();
+    }
+
+    // Every other dimension of the operand must be gathered in full.
+    for (auto en : llvm::enumerate(op.slice_sizes().getValues<int64_t>())) {
+      int64_t expected = en.index() == static_cast<size_t>(dim)
+                             ? 1
+                             : operandTy.getDimSize(en.index());
+      if (ShapedType::isDynamic(expected) || en.value() != expected) {
+        return failure();
+      }
+    }
+
+    // The index vector dimension is either implicit or a trailing unit
+    // dimension that is dropped with a reshape.
+    int64_t indexVectorDim = dimNumbers.getIndexVectorDim();
+    if (indexVectorDim == indicesTy.getRank() - 1 &&
+        indicesTy.getShape().back() == 1) {
+      if (!indicesTy.hasStaticShape()) return failure();
+      indicesTy = RankedTensorType::get(indicesTy.getShape().drop_back(),
+                                        indicesTy.getElementType());
+      indices =
+          rewriter.create<mhlo::ReshapeOp>(op.getLoc(), indicesTy, indices);
+    } else if (indexVectorDim != indicesTy.getRank()) {
+      return failure();
+    }
+
+    // torch_index_select produces operand[:dim] + indices + operand[dim+1:].
+    int64_t batchRank = indicesTy.getRank();
+    SmallVector<int64_t> selectShape(operandTy.getShape().begin(),
+                                     operandTy.getShape().begin() + dim);
+    llvm::append_range(selectShape, indicesTy.getShape());
+    selectShape.append(operandTy.getShape().begin() + dim + 1,
+                       operandTy.getShape().end());
+    if (selectShape.size() != static_cast<size_t>(resultTy.getRank())) {
+      return failure();
+    }
+
+    // The gather result places the remaining operand dimensions at the offset
+    // dims and the batch dimensions everywhere else, both in order.
+    auto offsetDims = dimNumbers.getOffsetDims();
+    SmallVector<int64_t> permutation;
+    int64_t offsetIndex = 0;
+    int64_t batchIndex = 0;
+    for (int64_t i = 0; i < resultTy.getRank(); ++i) {
+      if (llvm::is_contained(offsetDims, i)) {
+        permutation.push_back(offsetIndex < dim ? offsetIndex
+                                                : offsetIndex + batchRank);
+        ++offsetIndex;
+      } else {
+        permutation.push_back(dim + batchIndex);
+        ++batchIndex;
+      }
+    }
+
+    Value result = rewriter.create<mhlo::TorchIndexSelectOp>(
+        op.getLoc(),
+        RankedTensorType::get(selectShape, resultTy.getElementType()), operand,
+        indices, rewriter.getI64IntegerAttr(dim),
+        rewriter.getI64IntegerAttr(0));
+    if (!isIota(permutation)) {
+      result = rewriter.create<mhlo::TransposeOp>(
+          op.getLoc(), resultTy, result,
+          rewriter.getI64TensorAttr(permutation));
+    }
+    rewriter.replaceOp(op, result);
+    return success();
+  }
+};
+
 // Traverse upward past common operations to see if the value came from a
 // boolean tensor.
 bool isFromBool(Value val) {
@@ -763,7 +860,8 @@ struct MHLOToMHLOPreprocessingPass
     mhlo::populateUnfuseBatchNormPatterns(context, &patterns);
     mhlo::populateComplexLoweringPatterns(context, &patterns);
     mhlo::populateGatherToTorchIndexSelectPatterns(context, &patterns);
-    patterns.insert<ScatterRank0Value, ExpandRngNormal, MulCastOfBool>(context);
+    patterns.insert<GatherAlongDimToTorchIndexSelect, ScatterRank0Value,
+                    ExpandRngNormal, MulCastOfBool>(context);
 
     // dot_general canoncalization patterns.
     mhlo::populateGeneralDotOpLoweringPatterns(&patterns, context);
@@ -507,6 +507,28 @@ func.func @rfft_2d(%input: tensor<4x8xf32>) -> (tensor<4x5xf32>, tensor<4x5xf32>
 
 // -----
 
+func.func @rfft_non_power_of_two(%input: tensor<4x6xf32>) -> (tensor<4x4xf32>, tensor<4x4xf32>) {
+  %0 = "mhlo.fft"(%input) {
+    fft_length = dense<6> : tensor<1xi64>, fft_type = #mhlo<"fft_type RFFT">
+  } : (tensor<4x6xf32>) -> tensor<4x4xcomplex<f32>>
+  %1 = "mhlo.real"(%0) : (tensor<4x4xcomplex<f32>>) -> tensor<4x4xf32>
+  %2 = "mhlo.imag"(%0) : (tensor<4x4xcomplex<f32>>) -> tensor<4x4xf32>
+  return %1, %2 : tensor<4x4xf32>, tensor<4x4xf32>
+}
+// CHECK:      func.func @rfft_non_power_of_two
+// CHECK-SAME:   %[[REAL:[a-zA-Z0-9]+]]
+// CHECK-NOT:    iree_linalg_ext.fft
+// CHECK-DAG:    %[[ZERO:.+]] = arith.constant 0.000000e+00 : f32
+// CHECK-DAG:    %[[INIT:.+]] = linalg.init_tensor [4, 4] : tensor<4x4xf32>
+// CHECK:        %[[FILL:.+]] = linalg.fill ins(%[[ZERO]] : f32) outs(%[[INIT]] : tensor<4x4xf32>)
+// CHECK-DAG:    %[[COS:.+]] = arith.constant dense<{{.+}}> : tensor<6x4xf32>
+// CHECK:        %[[RES_REAL:.+]] = linalg.matmul ins(%[[REAL]], %[[COS]] : tensor<4x6xf32>, tensor<6x4xf32>) outs(%[[FILL]] : tensor<4x4xf32>)
+// CHECK-DAG:    %[[SIN:.+]] = arith.constant dense<{{.+}}> : tensor<6x4xf32>
+// CHECK:        %[[RES_IMAG:.+]] = linalg.matmul ins(%[[REAL]], %[[SIN]] : tensor<4x6xf32>, tensor<6x4xf32>) outs(%[[FILL]] : tensor<4x4xf32>)
+// CHECK:        %{{.+}} = mhlo.complex(%[[RES_REAL]], %[[RES_IMAG]])
+
+// -----
+
 func.func @reverse_dim1(%arg0: tensor<3x5xi32>) -> tensor<3x5xi32> {
   %0 = "mhlo.reverse"(%arg0) {
     dimensions = dense<1> : tensor<1xi64>
@@ -261,6 +261,44 @@ func.func @scatter_rank0(%arg0: tensor<5x5xi32>, %arg1: tensor<2xi32>, %arg2: te
 
 // -----
 
+func.func @gather_along_dim(%arg0: tensor<4x8xf32>, %arg1: tensor<5xi32>) -> tensor<4x5xf32> {
+  %0 = "mhlo.gather"(%arg0, %arg1) {dimension_numbers = #mhlo.gather<offset_dims = [0], collapsed_slice_dims = [1], start_index_map = [1], index_vector_dim = 1>, indices_are_sorted = false, slice_sizes = dense<[4, 1]> : tensor<2xi64>} : (tensor<4x8xf32>, tensor<5xi32>) -> tensor<4x5xf32>
+  return %0 : tensor<4x5xf32>
+}
+
+// CHECK-LABEL: func.func @gather_along_dim
+// CHECK-SAME:    %[[ARG0:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[ARG1:[a-zA-Z0-9]+]]
+// CHECK:         %[[SELECT:.+]] = "mhlo.torch_index_select"(%[[ARG0]], %[[ARG1]]) {batch_dims = 0 : i64, dim = 1 : i64} : (tensor<4x8xf32>, tensor<5xi32>) -> tensor<4x5xf32>
+// CHECK:         return %[[SELECT]]
+
+// -----
+
+func.func @gather_along_dim_transposed(%arg0: tensor<4x8xf32>, %arg1: tensor<5x1xi32>) -> tensor<5x4xf32> {
+  %0 = "mhlo.gather"(%arg0, %arg1) {dimension_numbers = #mhlo.gather<offset_dims = [1], collapsed_slice_dims = [1], start_index_map = [1], index_vector_dim = 1>, indices_are_sorted = false, slice_sizes = dense<[4, 1]> : tensor<2xi64>} : (tensor<4x8xf32>, tensor<5x1xi32>) -> tensor<5x4xf32>
+  return %0 : tensor<5x4xf32>
+}
+
+// CHECK-LABEL: func.func @gather_along_dim_transposed
+// CHECK-SAME:    %[[ARG0:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[ARG1:[a-zA-Z0-9]+]]
+// CHECK:         %[[INDICES:.+]] = "mhlo.reshape"(%[[ARG1]]) : (tensor<5x1xi32>) -> tensor<5xi32>
+// CHECK:         %[[SELECT:.+]] = "mhlo.torch_index_select"(%[[ARG0]], %[[INDICES]]) {batch_dims = 0 : i64, dim = 1 : i64} : (tensor<4x8xf32>, tensor<5xi32>) -> tensor<4x5xf32>
+// CHECK:         %[[TRANSPOSE:.+]] = "mhlo.transpose"(%[[SELECT]]) {permutation = dense<[1, 0]> : tensor<2xi64>} : (tensor<4x5xf32>) -> tensor<5x4xf32>
+// CHECK:         return %[[TRANSPOSE]]
+
+// -----
+
+func.func @gather_multiple_dims(%arg0: tensor<4x8xf32>, %arg1: tensor<5x2xi32>) -> tensor<5xf32> {
+  %0 = "mhlo.gather"(%arg0, %arg1) {dimension_numbers = #mhlo.gather<collapsed_slice_dims = [0, 1], start_index_map = [0, 1], index_vector_dim = 1>, indices_are_sorted = false, slice_sizes = dense<1> : tensor<2xi64>} : (tensor<4x8xf32>, tensor<5x2xi32>) -> tensor<5xf32>
+  return %0 : tensor<5xf32>
+}
+
+// CHECK-LABEL: func.func @gather_multiple_dims
+// CHECK:         "mhlo.gather"
+
+// -----
+
 func.func @mul_float_bool_cast(%arg0 : tensor<?xi1>, %arg1 : tensor<?xf32>) -> tensor<?xf32> {
   %0 = "mhlo.convert"(%arg0) : (tensor<?xi1>) -> tensor<?xf32>
   %1 = "mhlo.multiply"(%0, %arg1) : (tensor<?xf32>, tensor<?xf32>) -> tensor<?xf32>
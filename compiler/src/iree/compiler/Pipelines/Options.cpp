@@ -95,6 +95,29 @@ void SchedulingOptions::bindOptions(OptionsBinder &binder) {
                           llvm::cl::desc("File path to write statistics to; or "
                                          "`` for stderr or `-` for stdout."),
                           llvm::cl::cat(category));
+  binder.opt<bool>(
+      "iree-scheduling-minimize-peak-memory", minimizePeakMemory,
+      llvm::cl::desc("Reorders independent ops within execution regions to "
+                     "minimize peak live transient memory."),
+      llvm::cl::cat(category));
+  binder.opt<int64_t>(
+      "iree-scheduling-memory-budget", memoryBudget,
+      llvm::cl::desc(
+          "Peak transient memory in bytes per execution region above which "
+          "scheduling favors lower memory over concurrency (0 to disable)."),
+      llvm::cl::cat(category));
+  binder.opt<bool>(
+      "iree-scheduling-hoist-transients", hoistTransients,
+      llvm::cl::desc(
+          "Hoists statically-sized transient allocations into pools allocated "
+          "at program load and reused across invocations. Only valid when "
+          "invocations are externally synchronized."),
+      llvm::cl::cat(category));
+  binder.opt<int64_t>(
+      "iree-scheduling-device-count", deviceCount,
+      llvm::cl::desc("Splits async work across the given number of devices as "
+                     "pipeline stages (1 to disable)."),
+      llvm::cl::cat(category));
 }
 
 }  // namespace iree_compiler
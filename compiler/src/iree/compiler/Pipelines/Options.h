@@ -94,6 +94,21 @@ struct SchedulingOptions {
   // File path to write statistics to; or `` for stderr or `-` for stdout.
   std::string dumpStatisticsFile = "";
 
+  // Reorders independent ops within execution regions to minimize peak live
+  // transient memory. When |memoryBudget| is non-zero regions exceeding it
+  // favor lower memory over concurrency.
+  bool minimizePeakMemory = false;
+  int64_t memoryBudget = 0;
+
+  // Hoists statically-sized transient allocations into pools allocated once at
+  // program load and reused by every invocation. Invocations of the module
+  // must be externally synchronized as the pools are shared.
+  bool hoistTransients = false;
+
+  // Splits async work across this many devices as pipeline stages with
+  // explicit transfers between them. 1 keeps all work on the default device.
+  int64_t deviceCount = 1;
+
   // TODO(benvanik): favor size/speed/etc for partitioning.
   // TODO(benvanik): execution model to optimize for (unified/discrete memory,
   //                 single/multiple processors, etc).
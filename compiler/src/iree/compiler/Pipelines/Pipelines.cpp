@@ -95,6 +95,10 @@ void buildIREEVMTransformPassPipeline(
   streamOptions.dumpStatisticsFormat =
       (IREE::Stream::DumpOutputFormat)schedulingOptions.dumpStatisticsFormat;
   streamOptions.dumpStatisticsFile = schedulingOptions.dumpStatisticsFile;
+  streamOptions.minimizePeakMemory = schedulingOptions.minimizePeakMemory;
+  streamOptions.memoryBudget = schedulingOptions.memoryBudget;
+  streamOptions.hoistTransients = schedulingOptions.hoistTransients;
+  streamOptions.deviceCount = schedulingOptions.deviceCount;
 
   IREE::Flow::buildFlowTransformPassPipeline(passManager, flowOptions);
   IREE::Stream::buildStreamTransformPassPipeline(passManager, streamOptions);
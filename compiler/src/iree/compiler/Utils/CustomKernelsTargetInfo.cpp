@@ -32,6 +32,33 @@ LogicalResult ParseCustomKernelTargetFeaturesForAarch64(
   return success();
 }
 
+LogicalResult ParseCustomKernelTargetFeaturesForX86_64(
+    const llvm::SmallVector<llvm::StringRef> &features,
+    CustomKernelsTargetInfo &targetInfo) {
+  // Unlike on Aarch64, x86_64 CPU feature strings as produced by LLVM for a
+  // given CPU routinely list dozens of features (+sse4.2,+avx2,+bmi2,...) so
+  // features that don't enable any kernel are ignored instead of rejected.
+  bool hasAvx512bw = false;
+  bool hasAvx512vnni = false;
+  for (auto f : features) {
+    if (f == "+avx512bw") {
+      hasAvx512bw = true;
+    } else if (f == "+avx512vnni") {
+      hasAvx512vnni = true;
+    }
+  }
+  // AVX-512 VNNI implies AVX-512BW on all CPUs implementing it, but kernels
+  // use AVX-512BW instructions and LLVM does not infer one from the other.
+  if (hasAvx512vnni) {
+    if (!hasAvx512bw) {
+      llvm::errs() << "x86_64 CPU feature +avx512vnni requires +avx512bw\n";
+      return failure();
+    }
+    targetInfo.add(CustomKernelTargetFeature::X86_64Avx512Vnni);
+  }
+  return success();
+}
+
 LogicalResult ParseCustomKernelsTargetInfo(
     llvm::StringRef archStr, llvm::StringRef featuresStr,
     CustomKernelsTargetInfo &targetInfo) {
@@ -51,6 +78,11 @@ LogicalResult ParseCustomKernelsTargetInfo(
     return ParseCustomKernelTargetFeaturesForAarch64(features, targetInfo);
   }
 
+  if (archStr == "x86_64") {
+    targetInfo.init(CustomKernelTargetArch::X86_64);
+    return ParseCustomKernelTargetFeaturesForX86_64(features, targetInfo);
+  }
+
   // Currently, on unknown arch, we return success as long as no features
   // were specified (we wouldn't know how to parse features for an unknown arch)
   // as we don't necessarily know all the arch strings that IREE is being used
@@ -18,7 +18,7 @@ namespace iree_compiler {
 
 // Enumerates target ISAs that we care about. 'int8_t' because we somewhat
 // care because this is used in struct MMTKernel, which is passed by value.
-enum class CustomKernelTargetArch : int8_t { None, Aarch64 };
+enum class CustomKernelTargetArch : int8_t { None, Aarch64, X86_64 };
 
 // Enumerates arch-specific target features that we care about.
 // We explicitly want to stick to the default enumeration values (0, 1, 2, ...,
@@ -34,6 +34,8 @@ enum class CustomKernelTargetFeature {
   // Aarch64 features.
   Aarch64Dotprod,
   Aarch64I8mm,
+  // X86_64 features.
+  X86_64Avx512Vnni,
 };
 
 inline bool isFeatureForArch(CustomKernelTargetFeature feature,
@@ -45,6 +47,8 @@ inline bool isFeatureForArch(CustomKernelTargetFeature feature,
       return arch == CustomKernelTargetArch::Aarch64;
     case CustomKernelTargetFeature::Aarch64I8mm:
       return arch == CustomKernelTargetArch::Aarch64;
+    case CustomKernelTargetFeature::X86_64Avx512Vnni:
+      return arch == CustomKernelTargetArch::X86_64;
   }
   assert(false && "Unhandled CustomKernelTargetFeature value");
   return false;
@@ -0,0 +1,80 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// See iree/base/api.h for documentation on the API conventions used.
+
+#ifndef IREE_REMOTING_HAL_API_H_
+#define IREE_REMOTING_HAL_API_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_remote_device_t
+//===----------------------------------------------------------------------===//
+
+// Parameters configuring an iree_hal_remote_device_t.
+// Must be initialized with iree_hal_remote_device_params_initialize prior to
+// use.
+typedef struct iree_hal_remote_device_params_t {
+  // Total size of each block in the device shared block pool used for
+  // recording command buffers.
+  iree_host_size_t arena_block_size;
+
+  // Capacity, in bytes, of the buffer batching outgoing messages. Messages
+  // that don't need a reply are sent once the buffer fills or a reply is
+  // needed; larger values coalesce more small commands into each send.
+  iree_host_size_t batch_capacity;
+} iree_hal_remote_device_params_t;
+
+// Initializes |out_params| to default values.
+IREE_API_EXPORT void iree_hal_remote_device_params_initialize(
+    iree_hal_remote_device_params_t* out_params);
+
+// Creates a device that forwards all work to the server listening on
+// |address| ("host:port"); see experimental/remoting/server/.
+IREE_API_EXPORT iree_status_t iree_hal_remote_device_create(
+    iree_string_view_t identifier,
+    const iree_hal_remote_device_params_t* params, iree_string_view_t address,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device);
+
+//===----------------------------------------------------------------------===//
+// iree_hal_remote_driver_t
+//===----------------------------------------------------------------------===//
+
+// Parameters for configuring an iree_hal_remote_driver_t.
+// Must be initialized with iree_hal_remote_driver_options_initialize prior to
+// use.
+typedef struct iree_hal_remote_driver_options_t {
+  // Parameters used for all devices created by the driver.
+  iree_hal_remote_device_params_t default_params;
+
+  // Server address used when creating the default device.
+  iree_string_view_t default_address;
+} iree_hal_remote_driver_options_t;
+
+IREE_API_EXPORT void iree_hal_remote_driver_options_initialize(
+    iree_hal_remote_driver_options_t* out_options);
+
+// Creates a remote HAL driver. Devices are created by server address; for
+// example `remote://localhost:9345` creates a device using the server
+// listening on port 9345 of the local machine.
+//
+// |out_driver| must be released by the caller (see iree_hal_driver_release).
+IREE_API_EXPORT iree_status_t iree_hal_remote_driver_create(
+    iree_string_view_t identifier,
+    const iree_hal_remote_driver_options_t* options,
+    iree_allocator_t host_allocator, iree_hal_driver_t** out_driver);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_HAL_API_H_
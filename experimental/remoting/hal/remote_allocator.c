@@ -0,0 +1,222 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/remoting/hal/remote_allocator.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "experimental/remoting/hal/remote_buffer.h"
+#include "experimental/remoting/hal/remote_device.h"
+#include "iree/base/tracing.h"
+
+typedef struct iree_hal_remote_allocator_t {
+  iree_hal_resource_t resource;
+  iree_hal_device_t* device;
+  iree_allocator_t host_allocator;
+
+  IREE_STATISTICS(iree_hal_allocator_statistics_t statistics;)
+} iree_hal_remote_allocator_t;
+
+static const iree_hal_allocator_vtable_t iree_hal_remote_allocator_vtable;
+
+static iree_hal_remote_allocator_t* iree_hal_remote_allocator_cast(
+    iree_hal_allocator_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_remote_allocator_vtable);
+  return (iree_hal_remote_allocator_t*)base_value;
+}
+
+iree_status_t iree_hal_remote_allocator_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(out_allocator);
+  *out_allocator = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_remote_allocator_t* allocator = NULL;
+  iree_status_t status = iree_allocator_malloc(
+      host_allocator, sizeof(*allocator), (void**)&allocator);
+  if (iree_status_is_ok(status)) {
+    iree_hal_resource_initialize(&iree_hal_remote_allocator_vtable,
+                                 &allocator->resource);
+    allocator->device = device;
+    allocator->host_allocator = host_allocator;
+    *out_allocator = (iree_hal_allocator_t*)allocator;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_remote_allocator_destroy(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_remote_allocator_t* allocator =
+      iree_hal_remote_allocator_cast(base_allocator);
+  iree_allocator_t host_allocator = allocator->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_allocator_free(host_allocator, allocator);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_allocator_t iree_hal_remote_allocator_host_allocator(
+    const iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_remote_allocator_t* allocator =
+      (iree_hal_remote_allocator_t*)base_allocator;
+  return allocator->host_allocator;
+}
+
+static iree_status_t iree_hal_remote_allocator_trim(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  // The server allocator is trimmed along with the device.
+  return iree_ok_status();
+}
+
+static void iree_hal_remote_allocator_query_statistics(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_allocator_statistics_t* IREE_RESTRICT out_statistics) {
+  IREE_STATISTICS({
+    iree_hal_remote_allocator_t* allocator =
+        iree_hal_remote_allocator_cast(base_allocator);
+    memcpy(out_statistics, &allocator->statistics, sizeof(*out_statistics));
+  });
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_remote_allocator_query_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size) {
+  // Querying the server would cost a round trip per query; all buffers live
+  // on the server and host-visible buffers are emulated by transferring their
+  // contents on map and unmap, which is supported (if slow).
+  iree_hal_buffer_compatibility_t compatibility =
+      IREE_HAL_BUFFER_COMPATIBILITY_ALLOCATABLE;
+  if (iree_all_bits_set(params->usage, IREE_HAL_BUFFER_USAGE_TRANSFER)) {
+    compatibility |= IREE_HAL_BUFFER_COMPATIBILITY_QUEUE_TRANSFER;
+  }
+  if (iree_all_bits_set(params->usage,
+                        IREE_HAL_BUFFER_USAGE_DISPATCH_STORAGE)) {
+    compatibility |= IREE_HAL_BUFFER_COMPATIBILITY_QUEUE_DISPATCH;
+  }
+  return compatibility;
+}
+
+static iree_status_t iree_hal_remote_allocator_allocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size, iree_const_byte_span_t initial_data,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_remote_allocator_t* allocator =
+      iree_hal_remote_allocator_cast(base_allocator);
+  *out_buffer = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, allocation_size);
+
+  iree_hal_memory_type_t memory_type =
+      iree_hal_remote_buffer_memory_type(params->type);
+
+  // The server allocates with the original parameters so that it can place
+  // host-visible buffers in memory it can map for transfers.
+  iree_remoting_id_t id = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_remote_device_allocate_id(allocator->device, &id));
+  iree_remoting_buffer_allocate_t request = {
+      .buffer_id = id,
+      .memory_type = params->type,
+      .access = params->access,
+      .usage = params->usage,
+      .queue_affinity = params->queue_affinity,
+      .min_alignment = params->min_alignment,
+      .allocation_size = allocation_size,
+  };
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+  };
+  iree_status_t status = iree_hal_remote_device_send(
+      allocator->device, IREE_REMOTING_MESSAGE_BUFFER_ALLOCATE,
+      IREE_ARRAYSIZE(spans), spans);
+  if (!iree_status_is_ok(status)) {
+    iree_hal_remote_device_release_id(allocator->device, id);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+
+  iree_hal_buffer_t* buffer = NULL;
+  status = iree_hal_remote_buffer_wrap(
+      allocator->device, base_allocator, memory_type, params->access,
+      params->usage, allocation_size, id, &buffer);
+
+  // Uploads are pipelined with the allocation.
+  if (iree_status_is_ok(status) &&
+      !iree_const_byte_span_is_empty(initial_data)) {
+    status = iree_hal_device_transfer_range(
+        allocator->device,
+        iree_hal_make_host_transfer_buffer_span((void*)initial_data.data,
+                                                initial_data.data_length),
+        0, iree_hal_make_device_transfer_buffer(buffer), 0,
+        initial_data.data_length, IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+        iree_infinite_timeout());
+  }
+
+  if (iree_status_is_ok(status)) {
+    IREE_STATISTICS(iree_hal_allocator_statistics_record_alloc(
+        &allocator->statistics, memory_type, allocation_size));
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_remote_allocator_deallocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT base_buffer) {
+  iree_hal_remote_allocator_t* allocator =
+      iree_hal_remote_allocator_cast(base_allocator);
+  (void)allocator;
+
+  IREE_STATISTICS(iree_hal_allocator_statistics_record_free(
+      &allocator->statistics, iree_hal_buffer_memory_type(base_buffer),
+      iree_hal_buffer_allocation_size(base_buffer)));
+
+  iree_hal_buffer_destroy(base_buffer);
+}
+
+static iree_status_t iree_hal_remote_allocator_import_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_hal_external_buffer_t* IREE_RESTRICT external_buffer,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                          "importing buffers is not supported remotely");
+}
+
+static iree_status_t iree_hal_remote_allocator_export_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_external_buffer_type_t requested_type,
+    iree_hal_external_buffer_flags_t requested_flags,
+    iree_hal_external_buffer_t* IREE_RESTRICT out_external_buffer) {
+  return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                          "exporting buffers is not supported remotely");
+}
+
+static const iree_hal_allocator_vtable_t iree_hal_remote_allocator_vtable = {
+    .destroy = iree_hal_remote_allocator_destroy,
+    .host_allocator = iree_hal_remote_allocator_host_allocator,
+    .trim = iree_hal_remote_allocator_trim,
+    .query_statistics = iree_hal_remote_allocator_query_statistics,
+    .query_compatibility = iree_hal_remote_allocator_query_compatibility,
+    .allocate_buffer = iree_hal_remote_allocator_allocate_buffer,
+    .deallocate_buffer = iree_hal_remote_allocator_deallocate_buffer,
+    .import_buffer = iree_hal_remote_allocator_import_buffer,
+    .export_buffer = iree_hal_remote_allocator_export_buffer,
+};
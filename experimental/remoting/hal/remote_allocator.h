@@ -0,0 +1,27 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_HAL_REMOTE_ALLOCATOR_H_
+#define IREE_REMOTING_HAL_REMOTE_ALLOCATOR_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Creates an allocator whose buffers live on the server |device| forwards to.
+// |device| is unretained as the allocator is owned by the device.
+iree_status_t iree_hal_remote_allocator_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_HAL_REMOTE_ALLOCATOR_H_
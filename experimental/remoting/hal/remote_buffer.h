@@ -0,0 +1,50 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_HAL_REMOTE_BUFFER_H_
+#define IREE_REMOTING_HAL_REMOTE_BUFFER_H_
+
+#include "experimental/remoting/protocol/protocol.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Returns the memory type of proxy buffers allocated with |requested_type|.
+// The memory is never directly accessible by the host and host-visible
+// buffers are emulated by transferring their contents on map and unmap.
+static inline iree_hal_memory_type_t iree_hal_remote_buffer_memory_type(
+    iree_hal_memory_type_t requested_type) {
+  iree_hal_memory_type_t memory_type =
+      IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+  if (iree_any_bit_set(requested_type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE)) {
+    memory_type |=
+        IREE_HAL_MEMORY_TYPE_HOST_VISIBLE | IREE_HAL_MEMORY_TYPE_HOST_COHERENT;
+  }
+  return memory_type;
+}
+
+// Wraps the server buffer bound to |id| in a proxy buffer that releases the
+// server buffer when destroyed. Takes ownership of |id|.
+iree_status_t iree_hal_remote_buffer_wrap(
+    iree_hal_device_t* device, iree_hal_allocator_t* allocator,
+    iree_hal_memory_type_t memory_type, iree_hal_memory_access_t allowed_access,
+    iree_hal_buffer_usage_t allowed_usage, iree_device_size_t allocation_size,
+    iree_remoting_id_t id, iree_hal_buffer_t** out_buffer);
+
+// Returns the server buffer backing |buffer| and the offset of |buffer| within
+// it. Fails if |buffer| was not allocated from a remote device.
+iree_status_t iree_hal_remote_buffer_resolve(iree_hal_buffer_t* buffer,
+                                             iree_remoting_id_t* out_id,
+                                             iree_device_size_t* out_offset);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_HAL_REMOTE_BUFFER_H_
@@ -0,0 +1,768 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/remoting/hal/remote_device.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "experimental/remoting/hal/remote_allocator.h"
+#include "experimental/remoting/hal/remote_buffer.h"
+#include "experimental/remoting/hal/remote_resources.h"
+#include "experimental/remoting/hal/remote_semaphore.h"
+#include "experimental/remoting/hal/stream_command_buffer.h"
+#include "experimental/remoting/protocol/transport.h"
+#include "iree/base/internal/arena.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/utils/deferred_command_buffer.h"
+
+// Device waits are split into slices of at most this long; see
+// iree_hal_remote_semaphore_multi_wait.
+#define IREE_HAL_REMOTE_DEVICE_WAIT_SLICE_NS (10 * 1000000ll)
+
+//===----------------------------------------------------------------------===//
+// iree_hal_remote_device_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_hal_remote_device_t {
+  iree_hal_resource_t resource;
+  iree_string_view_t identifier;
+
+  // Block pool used for recording command buffers.
+  iree_arena_block_pool_t block_pool;
+
+  iree_allocator_t host_allocator;
+  iree_hal_allocator_t* device_allocator;
+
+  // Guards the channel and the ID pool. Held for the duration of calls and
+  // of each queue submission so that commands are never interleaved.
+  iree_slim_mutex_t mutex;
+  iree_remoting_channel_t channel;
+
+  // Next never-used ID and the stack of released IDs available for reuse.
+  // Reusing IDs keeps the server handle table dense.
+  iree_remoting_id_t next_id;
+  iree_host_size_t free_id_count;
+  iree_host_size_t free_id_capacity;
+  iree_remoting_id_t* free_ids;
+
+  // Command buffer all deferred command buffers are replayed through at
+  // submission time to stream their commands to the server.
+  iree_hal_command_buffer_t* stream_command_buffer;
+} iree_hal_remote_device_t;
+
+static const iree_hal_device_vtable_t iree_hal_remote_device_vtable;
+
+static iree_hal_remote_device_t* iree_hal_remote_device_cast(
+    iree_hal_device_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_remote_device_vtable);
+  return (iree_hal_remote_device_t*)base_value;
+}
+
+IREE_API_EXPORT void iree_hal_remote_device_params_initialize(
+    iree_hal_remote_device_params_t* out_params) {
+  memset(out_params, 0, sizeof(*out_params));
+  out_params->arena_block_size = 32 * 1024;
+  out_params->batch_capacity = 64 * 1024;
+}
+
+static iree_status_t iree_hal_remote_device_check_params(
+    const iree_hal_remote_device_params_t* params) {
+  if (params->arena_block_size < 4096) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "arena block size too small (< 4096 bytes)");
+  }
+  if (params->batch_capacity < 4096) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "batch capacity too small (< 4096 bytes)");
+  }
+  return iree_ok_status();
+}
+
+// Exchanges HELLO messages with the server to check protocol compatibility.
+static iree_status_t iree_hal_remote_device_handshake(
+    iree_hal_remote_device_t* device) {
+  iree_remoting_hello_t hello = {
+      .magic = IREE_REMOTING_PROTOCOL_MAGIC,
+      .version = IREE_REMOTING_PROTOCOL_VERSION,
+  };
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&hello, sizeof(hello)),
+  };
+  int64_t server_version = 0;
+  IREE_RETURN_IF_ERROR(iree_remoting_channel_call(
+      &device->channel, IREE_REMOTING_MESSAGE_HELLO, IREE_ARRAYSIZE(spans),
+      spans, &server_version, iree_byte_span_empty()));
+  if (server_version != IREE_REMOTING_PROTOCOL_VERSION) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "server speaks protocol version %d, expected %u",
+                            (int)server_version,
+                            IREE_REMOTING_PROTOCOL_VERSION);
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_remote_device_create(
+    iree_string_view_t identifier,
+    const iree_hal_remote_device_params_t* params, iree_string_view_t address,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device) {
+  IREE_ASSERT_ARGUMENT(params);
+  IREE_ASSERT_ARGUMENT(out_device);
+  *out_device = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_remote_device_check_params(params));
+
+  iree_remoting_transport_t* transport = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_remoting_tcp_transport_connect(address, host_allocator,
+                                              &transport));
+
+  iree_hal_remote_device_t* device = NULL;
+  iree_host_size_t total_size = sizeof(*device) + identifier.size;
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, total_size, (void**)&device);
+  if (!iree_status_is_ok(status)) {
+    iree_remoting_transport_destroy(transport);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+  memset(device, 0, total_size);
+  iree_hal_resource_initialize(&iree_hal_remote_device_vtable,
+                               &device->resource);
+  iree_string_view_append_to_buffer(
+      identifier, &device->identifier,
+      (char*)device + total_size - identifier.size);
+  iree_arena_block_pool_initialize(params->arena_block_size, host_allocator,
+                                   &device->block_pool);
+  device->host_allocator = host_allocator;
+  iree_slim_mutex_initialize(&device->mutex);
+  device->next_id = 1;
+
+  // The channel takes ownership of the transport even on failure.
+  status = iree_remoting_channel_initialize(
+      transport, params->batch_capacity, host_allocator, &device->channel);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_remote_device_handshake(device);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_remote_allocator_create(
+        (iree_hal_device_t*)device, host_allocator, &device->device_allocator);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_remote_stream_command_buffer_create(
+        (iree_hal_device_t*)device, host_allocator,
+        &device->stream_command_buffer);
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_device = (iree_hal_device_t*)device;
+  } else {
+    iree_hal_device_release((iree_hal_device_t*)device);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_remote_device_destroy(iree_hal_device_t* base_device) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_allocator_t host_allocator = iree_hal_device_host_allocator(base_device);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_command_buffer_release(device->stream_command_buffer);
+  iree_hal_allocator_release(device->device_allocator);
+  if (device->channel.transport) {
+    // Send any trailing releases; the server drops everything it still holds
+    // for the client when the connection closes.
+    iree_status_ignore(iree_remoting_channel_flush(&device->channel));
+    iree_remoting_channel_deinitialize(&device->channel);
+  }
+  iree_allocator_free(host_allocator, device->free_ids);
+  iree_slim_mutex_deinitialize(&device->mutex);
+  iree_arena_block_pool_deinitialize(&device->block_pool);
+  iree_allocator_free(host_allocator, device);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Allocates an ID from the pool. Requires the device mutex.
+static iree_status_t iree_hal_remote_device_allocate_id_locked(
+    iree_hal_remote_device_t* device, iree_remoting_id_t* out_id) {
+  if (device->free_id_count > 0) {
+    *out_id = device->free_ids[--device->free_id_count];
+    return iree_ok_status();
+  }
+  if (device->next_id == UINT32_MAX) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "out of remote resource IDs");
+  }
+  *out_id = device->next_id++;
+  return iree_ok_status();
+}
+
+// Returns |id| to the pool. Requires the device mutex.
+static void iree_hal_remote_device_free_id_locked(
+    iree_hal_remote_device_t* device, iree_remoting_id_t id) {
+  if (device->free_id_count == device->free_id_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(64, device->free_id_capacity * 2);
+    iree_status_t status = iree_allocator_realloc(
+        device->host_allocator, new_capacity * sizeof(*device->free_ids),
+        (void**)&device->free_ids);
+    if (!iree_status_is_ok(status)) {
+      // Leaking the ID only costs a larger handle table on the server.
+      iree_status_ignore(status);
+      return;
+    }
+    device->free_id_capacity = new_capacity;
+  }
+  device->free_ids[device->free_id_count++] = id;
+}
+
+iree_status_t iree_hal_remote_device_allocate_id(
+    iree_hal_device_t* base_device, iree_remoting_id_t* out_id) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_slim_mutex_lock(&device->mutex);
+  iree_status_t status =
+      iree_hal_remote_device_allocate_id_locked(device, out_id);
+  iree_slim_mutex_unlock(&device->mutex);
+  return status;
+}
+
+void iree_hal_remote_device_release_id(iree_hal_device_t* base_device,
+                                       iree_remoting_id_t id) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_remoting_resource_release_t request = {
+      .id = id,
+  };
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+  };
+  iree_slim_mutex_lock(&device->mutex);
+  // The ID is only reused if the release made it into the stream; otherwise
+  // the server may still have a resource bound to it.
+  iree_status_t status = iree_remoting_channel_send(
+      &device->channel, IREE_REMOTING_MESSAGE_RESOURCE_RELEASE,
+      IREE_REMOTING_MESSAGE_FLAG_NONE, IREE_ARRAYSIZE(spans), spans);
+  if (iree_status_is_ok(status)) {
+    iree_hal_remote_device_free_id_locked(device, id);
+  }
+  iree_slim_mutex_unlock(&device->mutex);
+  iree_status_ignore(status);
+}
+
+iree_status_t iree_hal_remote_device_send(iree_hal_device_t* base_device,
+                                          iree_remoting_message_type_t type,
+                                          iree_host_size_t span_count,
+                                          const iree_const_byte_span_t* spans) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_slim_mutex_lock(&device->mutex);
+  iree_status_t status =
+      iree_remoting_channel_send(&device->channel, type,
+                                 IREE_REMOTING_MESSAGE_FLAG_NONE, span_count,
+                                 spans);
+  iree_slim_mutex_unlock(&device->mutex);
+  return status;
+}
+
+iree_status_t iree_hal_remote_device_call(iree_hal_device_t* base_device,
+                                          iree_remoting_message_type_t type,
+                                          iree_host_size_t span_count,
+                                          const iree_const_byte_span_t* spans,
+                                          int64_t* out_value,
+                                          iree_byte_span_t result_data) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_slim_mutex_lock(&device->mutex);
+  iree_status_t status = iree_remoting_channel_call(
+      &device->channel, type, span_count, spans, out_value, result_data);
+  iree_slim_mutex_unlock(&device->mutex);
+  return status;
+}
+
+static iree_string_view_t iree_hal_remote_device_id(
+    iree_hal_device_t* base_device) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return device->identifier;
+}
+
+static iree_allocator_t iree_hal_remote_device_host_allocator(
+    iree_hal_device_t* base_device) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return device->host_allocator;
+}
+
+static iree_hal_allocator_t* iree_hal_remote_device_allocator(
+    iree_hal_device_t* base_device) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return device->device_allocator;
+}
+
+static void iree_hal_remote_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
+static iree_status_t iree_hal_remote_device_trim(
+    iree_hal_device_t* base_device) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_arena_block_pool_trim(&device->block_pool);
+  return iree_hal_remote_device_send(
+      base_device, IREE_REMOTING_MESSAGE_DEVICE_TRIM, 0, NULL);
+}
+
+static iree_status_t iree_hal_remote_device_query_i64(
+    iree_hal_device_t* base_device, iree_string_view_t category,
+    iree_string_view_t key, int64_t* out_value) {
+  // Capabilities are those of the server device. Queries are made while
+  // loading modules and programs and so aren't worth caching.
+  iree_remoting_device_query_i64_t request = {
+      .category_length = (uint32_t)category.size,
+      .key_length = (uint32_t)key.size,
+  };
+  iree_const_byte_span_t spans[3] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+      iree_make_const_byte_span(category.data, category.size),
+      iree_make_const_byte_span(key.data, key.size),
+  };
+  return iree_hal_remote_device_call(
+      base_device, IREE_REMOTING_MESSAGE_DEVICE_QUERY_I64,
+      IREE_ARRAYSIZE(spans), spans, out_value, iree_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_device_create_command_buffer(
+    iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  // Recorded on the client and streamed to the server on submission; see
+  // iree_hal_remote_stream_command_buffer_create.
+  return iree_hal_deferred_command_buffer_create(
+      base_device, mode, command_categories, binding_capacity,
+      &device->block_pool, device->host_allocator, out_command_buffer);
+}
+
+static iree_status_t iree_hal_remote_device_create_descriptor_set(
+    iree_hal_device_t* base_device,
+    iree_hal_descriptor_set_layout_t* set_layout,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_binding_t* bindings,
+    iree_hal_descriptor_set_t** out_descriptor_set) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "non-push descriptor sets still need work");
+}
+
+static iree_status_t iree_hal_remote_device_create_descriptor_set_layout(
+    iree_hal_device_t* base_device,
+    iree_hal_descriptor_set_layout_usage_type_t usage_type,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_layout_binding_t* bindings,
+    iree_hal_descriptor_set_layout_t** out_descriptor_set_layout) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return iree_hal_remote_descriptor_set_layout_create(
+      base_device, usage_type, binding_count, bindings, device->host_allocator,
+      out_descriptor_set_layout);
+}
+
+static iree_status_t iree_hal_remote_device_create_event(
+    iree_hal_device_t* base_device, iree_hal_event_t** out_event) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return iree_hal_remote_event_create(base_device, device->host_allocator,
+                                      out_event);
+}
+
+static iree_status_t iree_hal_remote_device_create_executable_cache(
+    iree_hal_device_t* base_device, iree_string_view_t identifier,
+    iree_loop_t loop, iree_hal_executable_cache_t** out_executable_cache) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return iree_hal_remote_executable_cache_create(
+      base_device, device->host_allocator, out_executable_cache);
+}
+
+static iree_status_t iree_hal_remote_device_create_executable_layout(
+    iree_hal_device_t* base_device, iree_host_size_t push_constants,
+    iree_host_size_t set_layout_count,
+    iree_hal_descriptor_set_layout_t** set_layouts,
+    iree_hal_executable_layout_t** out_executable_layout) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return iree_hal_remote_executable_layout_create(
+      base_device, push_constants, set_layout_count, set_layouts,
+      device->host_allocator, out_executable_layout);
+}
+
+static iree_status_t iree_hal_remote_device_create_semaphore(
+    iree_hal_device_t* base_device, uint64_t initial_value,
+    iree_hal_semaphore_t** out_semaphore) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  return iree_hal_remote_semaphore_create(
+      base_device, initial_value, device->host_allocator, out_semaphore);
+}
+
+static iree_hal_semaphore_compatibility_t
+iree_hal_remote_device_query_semaphore_compatibility(
+    iree_hal_device_t* base_device, iree_hal_semaphore_t* semaphore) {
+  if (!iree_hal_remote_semaphore_isa(semaphore)) {
+    return IREE_HAL_SEMAPHORE_COMPATIBILITY_NONE;
+  }
+  // Host waits and signals are forwarded to the server.
+  return IREE_HAL_SEMAPHORE_COMPATIBILITY_ALL;
+}
+
+static iree_status_t iree_hal_remote_device_transfer_range(
+    iree_hal_device_t* base_device, iree_hal_transfer_buffer_t source,
+    iree_device_size_t source_offset, iree_hal_transfer_buffer_t target,
+    iree_device_size_t target_offset, iree_device_size_t data_length,
+    iree_hal_transfer_buffer_flags_t flags, iree_timeout_t timeout) {
+  if (data_length == 0) return iree_ok_status();
+
+  if (!source.device_buffer && target.device_buffer) {
+    // Host -> device: pipelined with other messages; the server applies the
+    // write before anything sent after it. Large writes are sent straight
+    // from host memory.
+    iree_remoting_buffer_range_t request = {
+        .length = data_length,
+    };
+    iree_device_size_t buffer_offset = 0;
+    IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+        target.device_buffer, &request.buffer_id, &buffer_offset));
+    request.offset = buffer_offset + target_offset;
+    iree_const_byte_span_t spans[2] = {
+        iree_make_const_byte_span(&request, sizeof(request)),
+        iree_make_const_byte_span(source.host_buffer.data + source_offset,
+                                  (iree_host_size_t)data_length),
+    };
+    return iree_hal_remote_device_send(base_device,
+                                       IREE_REMOTING_MESSAGE_BUFFER_WRITE,
+                                       IREE_ARRAYSIZE(spans), spans);
+  } else if (source.device_buffer && !target.device_buffer) {
+    // Device -> host: the reply is received directly into host memory.
+    iree_remoting_buffer_range_t request = {
+        .length = data_length,
+    };
+    iree_device_size_t buffer_offset = 0;
+    IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+        source.device_buffer, &request.buffer_id, &buffer_offset));
+    request.offset = buffer_offset + source_offset;
+    iree_const_byte_span_t spans[1] = {
+        iree_make_const_byte_span(&request, sizeof(request)),
+    };
+    return iree_hal_remote_device_call(
+        base_device, IREE_REMOTING_MESSAGE_BUFFER_READ, IREE_ARRAYSIZE(spans),
+        spans, /*out_value=*/NULL,
+        iree_make_byte_span(target.host_buffer.data + target_offset,
+                            (iree_host_size_t)data_length));
+  } else if (source.device_buffer && target.device_buffer) {
+    // Device -> device: copied on the server.
+    iree_remoting_buffer_copy_t request = {
+        .length = data_length,
+    };
+    iree_device_size_t source_buffer_offset = 0;
+    IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+        source.device_buffer, &request.source_buffer_id,
+        &source_buffer_offset));
+    iree_device_size_t target_buffer_offset = 0;
+    IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+        target.device_buffer, &request.target_buffer_id,
+        &target_buffer_offset));
+    request.source_offset = source_buffer_offset + source_offset;
+    request.target_offset = target_buffer_offset + target_offset;
+    iree_const_byte_span_t spans[1] = {
+        iree_make_const_byte_span(&request, sizeof(request)),
+    };
+    return iree_hal_remote_device_send(base_device,
+                                       IREE_REMOTING_MESSAGE_BUFFER_COPY,
+                                       IREE_ARRAYSIZE(spans), spans);
+  }
+
+  // Host -> host.
+  memcpy(target.host_buffer.data + target_offset,
+         source.host_buffer.data + source_offset, (size_t)data_length);
+  return iree_ok_status();
+}
+
+// Streams the command buffers of |batch| and the submission referencing them.
+// Requires the device mutex.
+static iree_status_t iree_hal_remote_device_submit_batch_locked(
+    iree_hal_remote_device_t* device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_submission_batch_t* batch) {
+  // Layout: header, wait values, command buffer IDs (padded), signal values.
+  iree_remoting_queue_submit_t* request = NULL;
+  iree_host_size_t wait_offset = sizeof(*request);
+  iree_host_size_t command_buffer_offset =
+      wait_offset + batch->wait_semaphores.count *
+                        sizeof(iree_remoting_semaphore_value_t);
+  iree_host_size_t signal_offset =
+      command_buffer_offset +
+      iree_host_align(batch->command_buffer_count * sizeof(iree_remoting_id_t),
+                      8);
+  iree_host_size_t total_size =
+      signal_offset + batch->signal_semaphores.count *
+                          sizeof(iree_remoting_semaphore_value_t);
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(device->host_allocator,
+                                             total_size, (void**)&request));
+  memset(request, 0, total_size);
+  request->command_categories = command_categories;
+  request->wait_count = (uint32_t)batch->wait_semaphores.count;
+  request->command_buffer_count = (uint32_t)batch->command_buffer_count;
+  request->signal_count = (uint32_t)batch->signal_semaphores.count;
+  request->queue_affinity = queue_affinity;
+  uint8_t* request_ptr = (uint8_t*)request;
+  iree_remoting_id_t* command_buffer_ids =
+      (iree_remoting_id_t*)(request_ptr + command_buffer_offset);
+
+  iree_status_t status = iree_hal_remote_semaphore_list_serialize(
+      batch->wait_semaphores,
+      (iree_remoting_semaphore_value_t*)(request_ptr + wait_offset));
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_remote_semaphore_list_serialize(
+        batch->signal_semaphores,
+        (iree_remoting_semaphore_value_t*)(request_ptr + signal_offset));
+  }
+
+  // Each command buffer is recorded into a transient server command buffer.
+  // The server stops tracking the IDs as soon as the submission is received
+  // so they can be reused right away.
+  iree_host_size_t id_count = 0;
+  for (iree_host_size_t i = 0;
+       i < batch->command_buffer_count && iree_status_is_ok(status); ++i) {
+    iree_hal_command_buffer_t* command_buffer = batch->command_buffers[i];
+    status = iree_hal_remote_device_allocate_id_locked(device,
+                                                       &command_buffer_ids[i]);
+    if (!iree_status_is_ok(status)) break;
+    ++id_count;
+    iree_hal_remote_stream_command_buffer_set_target(
+        device->stream_command_buffer, &device->channel, command_buffer_ids[i],
+        iree_hal_command_buffer_mode(command_buffer),
+        iree_hal_command_buffer_allowed_categories(command_buffer),
+        queue_affinity);
+    status = iree_hal_deferred_command_buffer_apply(
+        command_buffer, device->stream_command_buffer,
+        batch->binding_tables ? batch->binding_tables[i]
+                              : iree_hal_buffer_binding_table_empty());
+  }
+
+  if (iree_status_is_ok(status)) {
+    iree_const_byte_span_t spans[1] = {
+        iree_make_const_byte_span(request, total_size),
+    };
+    status = iree_remoting_channel_send(
+        &device->channel, IREE_REMOTING_MESSAGE_QUEUE_SUBMIT,
+        IREE_REMOTING_MESSAGE_FLAG_NONE, IREE_ARRAYSIZE(spans), spans);
+  }
+  // On failure the connection is unusable anyway (a command buffer may be
+  // left half-recorded on the server) so the IDs are simply recycled.
+  for (iree_host_size_t i = 0; i < id_count; ++i) {
+    iree_hal_remote_device_free_id_locked(device, command_buffer_ids[i]);
+  }
+
+  iree_allocator_free(device->host_allocator, request);
+  return status;
+}
+
+static iree_status_t iree_hal_remote_device_queue_submit(
+    iree_hal_device_t* base_device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
+    const iree_hal_submission_batch_t* batches) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Submissions are fully pipelined: the server waits on the semaphores and
+  // the client carries on recording the next submission.
+  iree_status_t status = iree_ok_status();
+  iree_slim_mutex_lock(&device->mutex);
+  for (iree_host_size_t i = 0; i < batch_count && iree_status_is_ok(status);
+       ++i) {
+    status = iree_hal_remote_device_submit_batch_locked(
+        device, command_categories, queue_affinity, &batches[i]);
+  }
+  iree_slim_mutex_unlock(&device->mutex);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Sends a QUEUE_ALLOCA or QUEUE_DEALLOCA of |buffer_id|.
+static iree_status_t iree_hal_remote_device_send_queue_alloca(
+    iree_hal_remote_device_t* device, iree_remoting_message_type_t type,
+    iree_remoting_id_t buffer_id, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    const iree_hal_buffer_params_t* params,
+    iree_device_size_t allocation_size) {
+  iree_remoting_queue_alloca_t* request = NULL;
+  iree_host_size_t total_size =
+      sizeof(*request) +
+      (wait_semaphore_list.count + signal_semaphore_list.count) *
+          sizeof(iree_remoting_semaphore_value_t);
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(device->host_allocator,
+                                             total_size, (void**)&request));
+  memset(request, 0, sizeof(*request));
+  request->buffer_id = buffer_id;
+  request->wait_count = (uint32_t)wait_semaphore_list.count;
+  request->signal_count = (uint32_t)signal_semaphore_list.count;
+  request->queue_affinity = queue_affinity;
+  if (params) {
+    request->memory_type = params->type;
+    request->access = params->access;
+    request->usage = params->usage;
+    request->min_alignment = params->min_alignment;
+  }
+  request->allocation_size = allocation_size;
+  iree_remoting_semaphore_value_t* values =
+      (iree_remoting_semaphore_value_t*)(request + 1);
+  iree_status_t status =
+      iree_hal_remote_semaphore_list_serialize(wait_semaphore_list, values);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_remote_semaphore_list_serialize(
+        signal_semaphore_list, values + wait_semaphore_list.count);
+  }
+  if (iree_status_is_ok(status)) {
+    iree_const_byte_span_t spans[1] = {
+        iree_make_const_byte_span(request, total_size),
+    };
+    status = iree_hal_remote_device_send((iree_hal_device_t*)device, type,
+                                         IREE_ARRAYSIZE(spans), spans);
+  }
+  iree_allocator_free(device->host_allocator, request);
+  return status;
+}
+
+static iree_status_t iree_hal_remote_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_remoting_id_t id = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_device_allocate_id(base_device, &id));
+  iree_status_t status = iree_hal_remote_device_send_queue_alloca(
+      device, IREE_REMOTING_MESSAGE_QUEUE_ALLOCA, id, queue_affinity,
+      wait_semaphore_list, signal_semaphore_list, &params, allocation_size);
+  if (!iree_status_is_ok(status)) {
+    iree_hal_remote_device_release_id(base_device, id);
+    return status;
+  }
+  // The proxy is usable immediately; commands using it are ordered after the
+  // allocation by the signal semaphores.
+  return iree_hal_remote_buffer_wrap(
+      base_device, device->device_allocator,
+      iree_hal_remote_buffer_memory_type(params.type), params.access,
+      params.usage, allocation_size, id, out_buffer);
+}
+
+static iree_status_t iree_hal_remote_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_remote_device_t* device = iree_hal_remote_device_cast(base_device);
+  iree_remoting_id_t id = 0;
+  iree_device_size_t offset = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(buffer, &id, &offset));
+  return iree_hal_remote_device_send_queue_alloca(
+      device, IREE_REMOTING_MESSAGE_QUEUE_DEALLOCA, id, queue_affinity,
+      wait_semaphore_list, signal_semaphore_list, /*params=*/NULL,
+      /*allocation_size=*/0);
+}
+
+static iree_status_t iree_hal_remote_device_submit_and_wait(
+    iree_hal_device_t* base_device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
+    const iree_hal_submission_batch_t* batches,
+    iree_hal_semaphore_t* wait_semaphore, uint64_t wait_value,
+    iree_timeout_t timeout) {
+  // Submit...
+  IREE_RETURN_IF_ERROR(iree_hal_remote_device_queue_submit(
+      base_device, command_categories, queue_affinity, batch_count, batches));
+
+  // ...and wait.
+  return iree_hal_semaphore_wait(wait_semaphore, wait_value, timeout);
+}
+
+static iree_status_t iree_hal_remote_device_wait_semaphores(
+    iree_hal_device_t* base_device, iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
+  return iree_hal_remote_semaphore_multi_wait(base_device, wait_mode,
+                                              *semaphore_list, timeout);
+}
+
+static iree_status_t iree_hal_remote_device_wait_idle(
+    iree_hal_device_t* base_device, iree_timeout_t timeout) {
+  // Sliced like semaphore waits so other threads can keep submitting.
+  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
+  while (true) {
+    int64_t timeout_ns = iree_absolute_deadline_to_timeout_ns(deadline_ns);
+    iree_remoting_device_wait_idle_t request = {
+        .timeout_ns =
+            iree_min(timeout_ns, IREE_HAL_REMOTE_DEVICE_WAIT_SLICE_NS),
+    };
+    iree_const_byte_span_t spans[1] = {
+        iree_make_const_byte_span(&request, sizeof(request)),
+    };
+    iree_status_t status = iree_hal_remote_device_call(
+        base_device, IREE_REMOTING_MESSAGE_DEVICE_WAIT_IDLE,
+        IREE_ARRAYSIZE(spans), spans, /*out_value=*/NULL,
+        iree_byte_span_empty());
+    if (!iree_status_is_deadline_exceeded(status) ||
+        request.timeout_ns >= timeout_ns) {
+      return status;
+    }
+    // Only the slice expired; try again.
+    iree_status_ignore(status);
+  }
+}
+
+static iree_status_t iree_hal_remote_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  // Profile the server process instead.
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_remote_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  return iree_ok_status();
+}
+
+static const iree_hal_device_vtable_t iree_hal_remote_device_vtable = {
+    .destroy = iree_hal_remote_device_destroy,
+    .id = iree_hal_remote_device_id,
+    .host_allocator = iree_hal_remote_device_host_allocator,
+    .device_allocator = iree_hal_remote_device_allocator,
+    .replace_device_allocator = iree_hal_remote_device_replace_allocator,
+    .trim = iree_hal_remote_device_trim,
+    .query_i64 = iree_hal_remote_device_query_i64,
+    .create_command_buffer = iree_hal_remote_device_create_command_buffer,
+    .create_descriptor_set = iree_hal_remote_device_create_descriptor_set,
+    .create_descriptor_set_layout =
+        iree_hal_remote_device_create_descriptor_set_layout,
+    .create_event = iree_hal_remote_device_create_event,
+    .create_executable_cache = iree_hal_remote_device_create_executable_cache,
+    .create_executable_layout =
+        iree_hal_remote_device_create_executable_layout,
+    .create_semaphore = iree_hal_remote_device_create_semaphore,
+    .query_semaphore_compatibility =
+        iree_hal_remote_device_query_semaphore_compatibility,
+    .transfer_range = iree_hal_remote_device_transfer_range,
+    .queue_alloca = iree_hal_remote_device_queue_alloca,
+    .queue_dealloca = iree_hal_remote_device_queue_dealloca,
+    .queue_submit = iree_hal_remote_device_queue_submit,
+    .submit_and_wait = iree_hal_remote_device_submit_and_wait,
+    .wait_semaphores = iree_hal_remote_device_wait_semaphores,
+    .wait_idle = iree_hal_remote_device_wait_idle,
+    .profiling_begin = iree_hal_remote_device_profiling_begin,
+    .profiling_end = iree_hal_remote_device_profiling_end,
+};
@@ -0,0 +1,48 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_HAL_REMOTE_DEVICE_H_
+#define IREE_REMOTING_HAL_REMOTE_DEVICE_H_
+
+#include "experimental/remoting/hal/api.h"
+#include "experimental/remoting/protocol/channel.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Allocates an ID for a new remote resource. IDs are assigned by the client
+// so that resources can be created without waiting for the server.
+iree_status_t iree_hal_remote_device_allocate_id(iree_hal_device_t* device,
+                                                 iree_remoting_id_t* out_id);
+
+// Releases the server resource bound to |id| and recycles the ID.
+// Failures are reported by the next call made on the device.
+void iree_hal_remote_device_release_id(iree_hal_device_t* device,
+                                       iree_remoting_id_t id);
+
+// Sends a message that doesn't need a reply. The message is batched with
+// others and may be sent any time before the next call.
+iree_status_t iree_hal_remote_device_send(iree_hal_device_t* device,
+                                          iree_remoting_message_type_t type,
+                                          iree_host_size_t span_count,
+                                          const iree_const_byte_span_t* spans);
+
+// Sends a message and waits for its reply; see iree_remoting_channel_call.
+iree_status_t iree_hal_remote_device_call(iree_hal_device_t* device,
+                                          iree_remoting_message_type_t type,
+                                          iree_host_size_t span_count,
+                                          const iree_const_byte_span_t* spans,
+                                          int64_t* out_value,
+                                          iree_byte_span_t result_data);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_HAL_REMOTE_DEVICE_H_
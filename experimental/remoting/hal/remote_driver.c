@@ -0,0 +1,151 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "experimental/remoting/hal/api.h"
+#include "iree/base/api.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/api.h"
+
+typedef struct iree_hal_remote_driver_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  // Identifier used for the driver in the IREE driver registry.
+  iree_string_view_t identifier;
+  // Parameters used for all devices created by the driver.
+  iree_hal_remote_device_params_t default_params;
+  // Server address used for the default device.
+  iree_string_view_t default_address;
+} iree_hal_remote_driver_t;
+
+// The default device connects to the default address.
+#define IREE_HAL_REMOTE_DEFAULT_DEVICE_ID 1
+
+static const iree_hal_driver_vtable_t iree_hal_remote_driver_vtable;
+
+static iree_hal_remote_driver_t* iree_hal_remote_driver_cast(
+    iree_hal_driver_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_remote_driver_vtable);
+  return (iree_hal_remote_driver_t*)base_value;
+}
+
+IREE_API_EXPORT void iree_hal_remote_driver_options_initialize(
+    iree_hal_remote_driver_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+  iree_hal_remote_device_params_initialize(&out_options->default_params);
+  out_options->default_address = iree_make_cstring_view("localhost:9345");
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_remote_driver_create(
+    iree_string_view_t identifier,
+    const iree_hal_remote_driver_options_t* options,
+    iree_allocator_t host_allocator, iree_hal_driver_t** out_driver) {
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_driver);
+  *out_driver = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_remote_driver_t* driver = NULL;
+  iree_host_size_t total_size =
+      sizeof(*driver) + identifier.size + options->default_address.size;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, total_size, (void**)&driver));
+  iree_hal_resource_initialize(&iree_hal_remote_driver_vtable,
+                               &driver->resource);
+  driver->host_allocator = host_allocator;
+  char* string_storage = (char*)driver + sizeof(*driver);
+  string_storage += iree_string_view_append_to_buffer(
+      identifier, &driver->identifier, string_storage);
+  iree_string_view_append_to_buffer(options->default_address,
+                                    &driver->default_address, string_storage);
+  memcpy(&driver->default_params, &options->default_params,
+         sizeof(driver->default_params));
+
+  *out_driver = (iree_hal_driver_t*)driver;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_hal_remote_driver_destroy(iree_hal_driver_t* base_driver) {
+  iree_hal_remote_driver_t* driver = iree_hal_remote_driver_cast(base_driver);
+  iree_allocator_t host_allocator = driver->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_allocator_free(host_allocator, driver);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_status_t iree_hal_remote_driver_query_available_devices(
+    iree_hal_driver_t* base_driver, iree_allocator_t host_allocator,
+    iree_host_size_t* out_device_info_count,
+    iree_hal_device_info_t** out_device_infos) {
+  iree_hal_remote_driver_t* driver = iree_hal_remote_driver_cast(base_driver);
+  // Servers aren't discovered; only the default address is reported so that
+  // `remote://` selects it.
+  iree_hal_device_info_t* device_info = NULL;
+  iree_host_size_t total_size =
+      sizeof(*device_info) + driver->default_address.size;
+  IREE_RETURN_IF_ERROR(
+      iree_allocator_malloc(host_allocator, total_size, (void**)&device_info));
+  device_info->device_id = IREE_HAL_REMOTE_DEFAULT_DEVICE_ID;
+  iree_string_view_append_to_buffer(driver->default_address, &device_info->path,
+                                    (char*)device_info + sizeof(*device_info));
+  device_info->name = device_info->path;
+  *out_device_info_count = 1;
+  *out_device_infos = device_info;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_remote_driver_dump_device_info(
+    iree_hal_driver_t* base_driver, iree_hal_device_id_t device_id,
+    iree_string_builder_t* builder) {
+  // Device information is only known to the server.
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_remote_driver_create_device_by_path(
+    iree_hal_driver_t* base_driver, iree_string_view_t driver_name,
+    iree_string_view_t device_path, iree_host_size_t param_count,
+    const iree_string_pair_t* params, iree_allocator_t host_allocator,
+    iree_hal_device_t** out_device) {
+  iree_hal_remote_driver_t* driver = iree_hal_remote_driver_cast(base_driver);
+  iree_string_view_t address = iree_string_view_is_empty(device_path)
+                                   ? driver->default_address
+                                   : device_path;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status =
+      iree_hal_remote_device_create(driver->identifier, &driver->default_params,
+                                    address, host_allocator, out_device);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_hal_remote_driver_create_device_by_id(
+    iree_hal_driver_t* base_driver, iree_hal_device_id_t device_id,
+    iree_host_size_t param_count, const iree_string_pair_t* params,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device) {
+  if (device_id != IREE_HAL_DEVICE_ID_DEFAULT &&
+      device_id != IREE_HAL_REMOTE_DEFAULT_DEVICE_ID) {
+    return iree_make_status(IREE_STATUS_NOT_FOUND,
+                            "remote device %" PRIu64
+                            " not found; create devices by server address",
+                            (uint64_t)device_id);
+  }
+  return iree_hal_remote_driver_create_device_by_path(
+      base_driver, iree_string_view_empty(), iree_string_view_empty(),
+      param_count, params, host_allocator, out_device);
+}
+
+static const iree_hal_driver_vtable_t iree_hal_remote_driver_vtable = {
+    .destroy = iree_hal_remote_driver_destroy,
+    .query_available_devices = iree_hal_remote_driver_query_available_devices,
+    .dump_device_info = iree_hal_remote_driver_dump_device_info,
+    .create_device_by_id = iree_hal_remote_driver_create_device_by_id,
+    .create_device_by_path = iree_hal_remote_driver_create_device_by_path,
+};
@@ -0,0 +1,345 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/remoting/hal/remote_resources.h"
+
+#include <stddef.h>
+
+#include "experimental/remoting/hal/remote_device.h"
+#include "iree/base/tracing.h"
+
+//===----------------------------------------------------------------------===//
+// iree_hal_remote_proxy_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_hal_remote_proxy_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  // Unretained; resources must not outlive their device.
+  iree_hal_device_t* device;
+  iree_remoting_id_t id;
+} iree_hal_remote_proxy_t;
+
+// All proxies share the same destroy but have distinct vtables so that the
+// HAL type checks keep working.
+typedef struct iree_hal_remote_proxy_vtable_t {
+  void(IREE_API_PTR* destroy)(iree_hal_remote_proxy_t* proxy);
+} iree_hal_remote_proxy_vtable_t;
+
+static void iree_hal_remote_proxy_destroy(iree_hal_remote_proxy_t* proxy) {
+  iree_allocator_t host_allocator = proxy->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_remote_device_release_id(proxy->device, proxy->id);
+  iree_allocator_free(host_allocator, proxy);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static const iree_hal_remote_proxy_vtable_t
+    iree_hal_remote_descriptor_set_layout_vtable = {
+        .destroy = iree_hal_remote_proxy_destroy,
+};
+static const iree_hal_remote_proxy_vtable_t
+    iree_hal_remote_executable_layout_vtable = {
+        .destroy = iree_hal_remote_proxy_destroy,
+};
+static const iree_hal_remote_proxy_vtable_t iree_hal_remote_executable_vtable =
+    {
+        .destroy = iree_hal_remote_proxy_destroy,
+};
+static const iree_hal_remote_proxy_vtable_t iree_hal_remote_event_vtable = {
+    .destroy = iree_hal_remote_proxy_destroy,
+};
+
+// Sends |type| with |spans| creating the server resource for a new proxy.
+// |request_id| points at the resource ID field of the request in |spans| and
+// is assigned here.
+static iree_status_t iree_hal_remote_proxy_create(
+    iree_hal_device_t* device, const iree_hal_remote_proxy_vtable_t* vtable,
+    iree_remoting_message_type_t type, iree_remoting_id_t* request_id,
+    iree_host_size_t span_count, const iree_const_byte_span_t* spans,
+    iree_allocator_t host_allocator, iree_hal_remote_proxy_t** out_proxy) {
+  *out_proxy = NULL;
+  iree_remoting_id_t id = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_device_allocate_id(device, &id));
+  *request_id = id;
+  iree_status_t status =
+      iree_hal_remote_device_send(device, type, span_count, spans);
+
+  iree_hal_remote_proxy_t* proxy = NULL;
+  if (iree_status_is_ok(status)) {
+    status =
+        iree_allocator_malloc(host_allocator, sizeof(*proxy), (void**)&proxy);
+  }
+  if (iree_status_is_ok(status)) {
+    iree_hal_resource_initialize(vtable, &proxy->resource);
+    proxy->host_allocator = host_allocator;
+    proxy->device = device;
+    proxy->id = id;
+    *out_proxy = proxy;
+  } else {
+    iree_hal_remote_device_release_id(device, id);
+  }
+  return status;
+}
+
+iree_status_t iree_hal_remote_resource_id(const void* resource,
+                                          iree_remoting_id_t* out_id) {
+  if (!resource) {
+    *out_id = 0;
+    return iree_ok_status();
+  }
+  if (!iree_hal_resource_is(resource,
+                            &iree_hal_remote_descriptor_set_layout_vtable) &&
+      !iree_hal_resource_is(resource,
+                            &iree_hal_remote_executable_layout_vtable) &&
+      !iree_hal_resource_is(resource, &iree_hal_remote_executable_vtable) &&
+      !iree_hal_resource_is(resource, &iree_hal_remote_event_vtable)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "resource was not created by a remote device");
+  }
+  *out_id = ((const iree_hal_remote_proxy_t*)resource)->id;
+  return iree_ok_status();
+}
+
+//===----------------------------------------------------------------------===//
+// Descriptor set layouts, executable layouts, and events
+//===----------------------------------------------------------------------===//
+
+iree_status_t iree_hal_remote_descriptor_set_layout_create(
+    iree_hal_device_t* device,
+    iree_hal_descriptor_set_layout_usage_type_t usage_type,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_layout_binding_t* bindings,
+    iree_allocator_t host_allocator,
+    iree_hal_descriptor_set_layout_t** out_descriptor_set_layout) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_remoting_descriptor_set_layout_create_t request = {
+      .usage_type = usage_type,
+      .binding_count = (uint32_t)binding_count,
+  };
+  static_assert(sizeof(iree_remoting_descriptor_set_layout_binding_t) ==
+                    sizeof(iree_hal_descriptor_set_layout_binding_t),
+                "HAL bindings are sent as-is");
+  iree_const_byte_span_t spans[2] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+      iree_make_const_byte_span(bindings, binding_count * sizeof(*bindings)),
+  };
+  iree_status_t status = iree_hal_remote_proxy_create(
+      device, &iree_hal_remote_descriptor_set_layout_vtable,
+      IREE_REMOTING_MESSAGE_DESCRIPTOR_SET_LAYOUT_CREATE,
+      &request.set_layout_id, IREE_ARRAYSIZE(spans), spans, host_allocator,
+      (iree_hal_remote_proxy_t**)out_descriptor_set_layout);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_hal_remote_executable_layout_create(
+    iree_hal_device_t* device, iree_host_size_t push_constants,
+    iree_host_size_t set_layout_count,
+    iree_hal_descriptor_set_layout_t** set_layouts,
+    iree_allocator_t host_allocator,
+    iree_hal_executable_layout_t** out_executable_layout) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_remoting_id_t* set_layout_ids = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator,
+                                set_layout_count * sizeof(*set_layout_ids) + 1,
+                                (void**)&set_layout_ids));
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < set_layout_count; ++i) {
+    status = iree_hal_remote_resource_id(set_layouts[i], &set_layout_ids[i]);
+    if (!iree_status_is_ok(status)) break;
+  }
+  if (iree_status_is_ok(status)) {
+    iree_remoting_executable_layout_create_t request = {
+        .push_constant_count = (uint32_t)push_constants,
+        .set_layout_count = (uint32_t)set_layout_count,
+    };
+    iree_const_byte_span_t spans[2] = {
+        iree_make_const_byte_span(&request, sizeof(request)),
+        iree_make_const_byte_span(set_layout_ids,
+                                  set_layout_count * sizeof(*set_layout_ids)),
+    };
+    status = iree_hal_remote_proxy_create(
+        device, &iree_hal_remote_executable_layout_vtable,
+        IREE_REMOTING_MESSAGE_EXECUTABLE_LAYOUT_CREATE,
+        &request.executable_layout_id, IREE_ARRAYSIZE(spans), spans,
+        host_allocator,
+        (iree_hal_remote_proxy_t**)out_executable_layout);
+  }
+  iree_allocator_free(host_allocator, set_layout_ids);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_hal_remote_event_create(iree_hal_device_t* device,
+                                           iree_allocator_t host_allocator,
+                                           iree_hal_event_t** out_event) {
+  iree_remoting_event_create_t request = {0};
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+  };
+  return iree_hal_remote_proxy_create(
+      device, &iree_hal_remote_event_vtable, IREE_REMOTING_MESSAGE_EVENT_CREATE,
+      &request.event_id, IREE_ARRAYSIZE(spans), spans, host_allocator,
+      (iree_hal_remote_proxy_t**)out_event);
+}
+
+//===----------------------------------------------------------------------===//
+// iree_hal_remote_executable_cache_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_hal_remote_executable_cache_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  // Unretained; caches must not outlive their device.
+  iree_hal_device_t* device;
+} iree_hal_remote_executable_cache_t;
+
+static const iree_hal_executable_cache_vtable_t
+    iree_hal_remote_executable_cache_vtable;
+
+static iree_hal_remote_executable_cache_t*
+iree_hal_remote_executable_cache_cast(
+    iree_hal_executable_cache_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_remote_executable_cache_vtable);
+  return (iree_hal_remote_executable_cache_t*)base_value;
+}
+
+iree_status_t iree_hal_remote_executable_cache_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_executable_cache_t** out_executable_cache) {
+  IREE_ASSERT_ARGUMENT(out_executable_cache);
+  *out_executable_cache = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_remote_executable_cache_t* executable_cache = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, sizeof(*executable_cache),
+                            (void**)&executable_cache);
+  if (iree_status_is_ok(status)) {
+    iree_hal_resource_initialize(&iree_hal_remote_executable_cache_vtable,
+                                 &executable_cache->resource);
+    executable_cache->host_allocator = host_allocator;
+    executable_cache->device = device;
+    *out_executable_cache = (iree_hal_executable_cache_t*)executable_cache;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_remote_executable_cache_destroy(
+    iree_hal_executable_cache_t* base_executable_cache) {
+  iree_hal_remote_executable_cache_t* executable_cache =
+      iree_hal_remote_executable_cache_cast(base_executable_cache);
+  iree_allocator_t host_allocator = executable_cache->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_allocator_free(host_allocator, executable_cache);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static bool iree_hal_remote_executable_cache_can_prepare_format(
+    iree_hal_executable_cache_t* base_executable_cache,
+    iree_hal_executable_caching_mode_t caching_mode,
+    iree_string_view_t executable_format) {
+  iree_hal_remote_executable_cache_t* executable_cache =
+      iree_hal_remote_executable_cache_cast(base_executable_cache);
+  // Only asked once per executable format while loading modules.
+  iree_remoting_executable_can_prepare_format_t request = {
+      .caching_mode = caching_mode,
+      .format_length = (uint32_t)executable_format.size,
+  };
+  iree_const_byte_span_t spans[2] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+      iree_make_const_byte_span(executable_format.data,
+                                executable_format.size),
+  };
+  int64_t value = 0;
+  iree_status_t status = iree_hal_remote_device_call(
+      executable_cache->device,
+      IREE_REMOTING_MESSAGE_EXECUTABLE_CAN_PREPARE_FORMAT,
+      IREE_ARRAYSIZE(spans), spans, &value, iree_byte_span_empty());
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    return false;
+  }
+  return value != 0;
+}
+
+static iree_status_t iree_hal_remote_executable_cache_prepare_executable(
+    iree_hal_executable_cache_t* base_executable_cache,
+    const iree_hal_executable_params_t* executable_params,
+    iree_hal_executable_t** out_executable) {
+  iree_hal_remote_executable_cache_t* executable_cache =
+      iree_hal_remote_executable_cache_cast(base_executable_cache);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_remoting_id_t* layout_ids = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(executable_cache->host_allocator,
+                                executable_params->executable_layout_count *
+                                        sizeof(*layout_ids) +
+                                    1,
+                                (void**)&layout_ids));
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < executable_params->executable_layout_count;
+       ++i) {
+    status = iree_hal_remote_resource_id(
+        executable_params->executable_layouts[i], &layout_ids[i]);
+    if (!iree_status_is_ok(status)) break;
+  }
+
+  if (iree_status_is_ok(status)) {
+    iree_remoting_executable_create_t request = {
+        .caching_mode = executable_params->caching_mode,
+        .executable_layout_count =
+            (uint32_t)executable_params->executable_layout_count,
+        .constant_count = (uint32_t)executable_params->constant_count,
+        .format_length = (uint32_t)executable_params->executable_format.size,
+        .data_length = executable_params->executable_data.data_length,
+    };
+    iree_host_size_t unpadded_length =
+        sizeof(request) +
+        request.executable_layout_count * sizeof(*layout_ids) +
+        request.constant_count * sizeof(uint32_t) + request.format_length;
+    static const uint8_t padding[8] = {0};
+    // Executable data is usually large and sent straight from the module
+    // without being copied.
+    iree_const_byte_span_t spans[6] = {
+        iree_make_const_byte_span(&request, sizeof(request)),
+        iree_make_const_byte_span(
+            layout_ids, request.executable_layout_count * sizeof(*layout_ids)),
+        iree_make_const_byte_span(executable_params->constants,
+                                  request.constant_count * sizeof(uint32_t)),
+        iree_make_const_byte_span(executable_params->executable_format.data,
+                                  request.format_length),
+        iree_make_const_byte_span(
+            padding, iree_host_align(unpadded_length, 8) - unpadded_length),
+        executable_params->executable_data,
+    };
+    status = iree_hal_remote_proxy_create(
+        executable_cache->device, &iree_hal_remote_executable_vtable,
+        IREE_REMOTING_MESSAGE_EXECUTABLE_CREATE, &request.executable_id,
+        IREE_ARRAYSIZE(spans), spans, executable_cache->host_allocator,
+        (iree_hal_remote_proxy_t**)out_executable);
+  }
+
+  iree_allocator_free(executable_cache->host_allocator, layout_ids);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static const iree_hal_executable_cache_vtable_t
+    iree_hal_remote_executable_cache_vtable = {
+        .destroy = iree_hal_remote_executable_cache_destroy,
+        .can_prepare_format =
+            iree_hal_remote_executable_cache_can_prepare_format,
+        .prepare_executable =
+            iree_hal_remote_executable_cache_prepare_executable,
+};
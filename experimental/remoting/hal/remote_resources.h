@@ -0,0 +1,56 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_HAL_REMOTE_RESOURCES_H_
+#define IREE_REMOTING_HAL_REMOTE_RESOURCES_H_
+
+#include "experimental/remoting/protocol/protocol.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Proxies for resources that are only ever referenced by commands and have
+// no behavior of their own on the client. Each is bound to a server resource
+// that is released when the proxy is destroyed.
+
+iree_status_t iree_hal_remote_descriptor_set_layout_create(
+    iree_hal_device_t* device,
+    iree_hal_descriptor_set_layout_usage_type_t usage_type,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_layout_binding_t* bindings,
+    iree_allocator_t host_allocator,
+    iree_hal_descriptor_set_layout_t** out_descriptor_set_layout);
+
+iree_status_t iree_hal_remote_executable_layout_create(
+    iree_hal_device_t* device, iree_host_size_t push_constants,
+    iree_host_size_t set_layout_count,
+    iree_hal_descriptor_set_layout_t** set_layouts,
+    iree_allocator_t host_allocator,
+    iree_hal_executable_layout_t** out_executable_layout);
+
+iree_status_t iree_hal_remote_event_create(iree_hal_device_t* device,
+                                           iree_allocator_t host_allocator,
+                                           iree_hal_event_t** out_event);
+
+// Creates an executable cache that prepares executables on the server.
+// Caching is left to the server device.
+iree_status_t iree_hal_remote_executable_cache_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_executable_cache_t** out_executable_cache);
+
+// Returns the server resource ID of a descriptor set layout, executable
+// layout, executable, or event proxy. Fails if |resource| is not a proxy.
+iree_status_t iree_hal_remote_resource_id(const void* resource,
+                                          iree_remoting_id_t* out_id);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_HAL_REMOTE_RESOURCES_H_
@@ -0,0 +1,285 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/remoting/hal/remote_semaphore.h"
+
+#include <stddef.h>
+
+#include "experimental/remoting/hal/remote_device.h"
+#include "iree/base/internal/atomics.h"
+#include "iree/base/tracing.h"
+
+// Waits are split into slices of at most this long so that the device lock
+// isn't held for the full wait: another thread may need to send the signal
+// being waited on.
+#define IREE_HAL_REMOTE_SEMAPHORE_WAIT_SLICE_NS (10 * 1000000ll)
+
+typedef struct iree_hal_remote_semaphore_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  // Unretained; semaphores must not outlive their device.
+  iree_hal_device_t* device;
+  iree_remoting_id_t id;
+  // Last value observed; lets waits on values already reached skip the round
+  // trip to the server.
+  iree_atomic_int64_t last_value;
+} iree_hal_remote_semaphore_t;
+
+static const iree_hal_semaphore_vtable_t iree_hal_remote_semaphore_vtable;
+
+static iree_hal_remote_semaphore_t* iree_hal_remote_semaphore_cast(
+    iree_hal_semaphore_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_remote_semaphore_vtable);
+  return (iree_hal_remote_semaphore_t*)base_value;
+}
+
+iree_status_t iree_hal_remote_semaphore_create(
+    iree_hal_device_t* device, uint64_t initial_value,
+    iree_allocator_t host_allocator, iree_hal_semaphore_t** out_semaphore) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(out_semaphore);
+  *out_semaphore = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_remoting_id_t id = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_remote_device_allocate_id(device, &id));
+  iree_remoting_semaphore_create_t request = {
+      .semaphore_id = id,
+      .initial_value = initial_value,
+  };
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+  };
+  iree_status_t status = iree_hal_remote_device_send(
+      device, IREE_REMOTING_MESSAGE_SEMAPHORE_CREATE, IREE_ARRAYSIZE(spans),
+      spans);
+
+  iree_hal_remote_semaphore_t* semaphore = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_allocator_malloc(host_allocator, sizeof(*semaphore),
+                                   (void**)&semaphore);
+  }
+  if (iree_status_is_ok(status)) {
+    iree_hal_resource_initialize(&iree_hal_remote_semaphore_vtable,
+                                 &semaphore->resource);
+    semaphore->host_allocator = host_allocator;
+    semaphore->device = device;
+    semaphore->id = id;
+    iree_atomic_store_int64(&semaphore->last_value, (int64_t)initial_value,
+                            iree_memory_order_relaxed);
+    *out_semaphore = (iree_hal_semaphore_t*)semaphore;
+  } else {
+    iree_hal_remote_device_release_id(device, id);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_remote_semaphore_destroy(
+    iree_hal_semaphore_t* base_semaphore) {
+  iree_hal_remote_semaphore_t* semaphore =
+      iree_hal_remote_semaphore_cast(base_semaphore);
+  iree_allocator_t host_allocator = semaphore->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_remote_device_release_id(semaphore->device, semaphore->id);
+  iree_allocator_free(host_allocator, semaphore);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+bool iree_hal_remote_semaphore_isa(iree_hal_semaphore_t* semaphore) {
+  return iree_hal_resource_is(semaphore, &iree_hal_remote_semaphore_vtable);
+}
+
+iree_remoting_id_t iree_hal_remote_semaphore_id(
+    iree_hal_semaphore_t* base_semaphore) {
+  return iree_hal_remote_semaphore_cast(base_semaphore)->id;
+}
+
+// Raises the last observed value of |semaphore| to at least |value|.
+static void iree_hal_remote_semaphore_observe(
+    iree_hal_remote_semaphore_t* semaphore, uint64_t value) {
+  int64_t last_value =
+      iree_atomic_load_int64(&semaphore->last_value, iree_memory_order_relaxed);
+  while (last_value < (int64_t)value &&
+         !iree_atomic_compare_exchange_weak_int64(
+             &semaphore->last_value, &last_value, (int64_t)value,
+             iree_memory_order_relaxed, iree_memory_order_relaxed)) {
+  }
+}
+
+static bool iree_hal_remote_semaphore_has_reached(
+    iree_hal_remote_semaphore_t* semaphore, uint64_t value) {
+  return (uint64_t)iree_atomic_load_int64(&semaphore->last_value,
+                                          iree_memory_order_relaxed) >= value;
+}
+
+static iree_status_t iree_hal_remote_semaphore_query(
+    iree_hal_semaphore_t* base_semaphore, uint64_t* out_value) {
+  iree_hal_remote_semaphore_t* semaphore =
+      iree_hal_remote_semaphore_cast(base_semaphore);
+  iree_remoting_semaphore_value_t request = {
+      .semaphore_id = semaphore->id,
+  };
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+  };
+  int64_t value = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_device_call(
+      semaphore->device, IREE_REMOTING_MESSAGE_SEMAPHORE_QUERY,
+      IREE_ARRAYSIZE(spans), spans, &value, iree_byte_span_empty()));
+  iree_hal_remote_semaphore_observe(semaphore, (uint64_t)value);
+  *out_value = (uint64_t)value;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_remote_semaphore_signal(
+    iree_hal_semaphore_t* base_semaphore, uint64_t new_value) {
+  iree_hal_remote_semaphore_t* semaphore =
+      iree_hal_remote_semaphore_cast(base_semaphore);
+  // Signals are pipelined; out-of-order signals are reported by the next
+  // call made on the device.
+  iree_remoting_semaphore_signal_t request = {
+      .semaphore_id = semaphore->id,
+      .value = new_value,
+  };
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+  };
+  IREE_RETURN_IF_ERROR(iree_hal_remote_device_send(
+      semaphore->device, IREE_REMOTING_MESSAGE_SEMAPHORE_SIGNAL,
+      IREE_ARRAYSIZE(spans), spans));
+  iree_hal_remote_semaphore_observe(semaphore, new_value);
+  return iree_ok_status();
+}
+
+static void iree_hal_remote_semaphore_fail(iree_hal_semaphore_t* base_semaphore,
+                                           iree_status_t status) {
+  iree_hal_remote_semaphore_t* semaphore =
+      iree_hal_remote_semaphore_cast(base_semaphore);
+  // Only the status code is sent; the server records its own message.
+  iree_remoting_semaphore_fail_t request = {
+      .semaphore_id = semaphore->id,
+      .status_code = iree_status_code(status),
+  };
+  iree_status_ignore(status);
+  iree_const_byte_span_t spans[1] = {
+      iree_make_const_byte_span(&request, sizeof(request)),
+  };
+  iree_status_ignore(iree_hal_remote_device_send(
+      semaphore->device, IREE_REMOTING_MESSAGE_SEMAPHORE_FAIL,
+      IREE_ARRAYSIZE(spans), spans));
+}
+
+iree_status_t iree_hal_remote_semaphore_list_serialize(
+    const iree_hal_semaphore_list_t semaphore_list,
+    iree_remoting_semaphore_value_t* out_values) {
+  for (iree_host_size_t i = 0; i < semaphore_list.count; ++i) {
+    if (!iree_hal_remote_semaphore_isa(semaphore_list.semaphores[i])) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "semaphore %zu was not created by a remote "
+                              "device",
+                              i);
+    }
+    out_values[i].semaphore_id =
+        iree_hal_remote_semaphore_id(semaphore_list.semaphores[i]);
+    out_values[i].reserved = 0;
+    out_values[i].value = semaphore_list.payload_values[i];
+  }
+  return iree_ok_status();
+}
+
+// Returns true if the wait is known to be satisfied without asking the server.
+static bool iree_hal_remote_semaphore_list_has_reached(
+    iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t semaphore_list) {
+  for (iree_host_size_t i = 0; i < semaphore_list.count; ++i) {
+    bool reached = iree_hal_remote_semaphore_has_reached(
+        iree_hal_remote_semaphore_cast(semaphore_list.semaphores[i]),
+        semaphore_list.payload_values[i]);
+    if (wait_mode == IREE_HAL_WAIT_MODE_ANY && reached) return true;
+    if (wait_mode == IREE_HAL_WAIT_MODE_ALL && !reached) return false;
+  }
+  return wait_mode == IREE_HAL_WAIT_MODE_ALL;
+}
+
+iree_status_t iree_hal_remote_semaphore_multi_wait(
+    iree_hal_device_t* device, iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t semaphore_list, iree_timeout_t timeout) {
+  if (semaphore_list.count == 0) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_remoting_semaphore_wait_t* request = NULL;
+  iree_host_size_t total_size =
+      sizeof(*request) +
+      semaphore_list.count * sizeof(iree_remoting_semaphore_value_t);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(iree_hal_device_host_allocator(device),
+                                total_size, (void**)&request));
+  request->wait_mode = wait_mode;
+  request->semaphore_count = (uint32_t)semaphore_list.count;
+  iree_status_t status = iree_hal_remote_semaphore_list_serialize(
+      semaphore_list, (iree_remoting_semaphore_value_t*)(request + 1));
+
+  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
+  while (iree_status_is_ok(status) &&
+         !iree_hal_remote_semaphore_list_has_reached(wait_mode,
+                                                     semaphore_list)) {
+    int64_t timeout_ns = iree_absolute_deadline_to_timeout_ns(deadline_ns);
+    request->timeout_ns =
+        iree_min(timeout_ns, IREE_HAL_REMOTE_SEMAPHORE_WAIT_SLICE_NS);
+    iree_const_byte_span_t spans[1] = {
+        iree_make_const_byte_span(request, total_size),
+    };
+    status = iree_hal_remote_device_call(
+        device, IREE_REMOTING_MESSAGE_SEMAPHORE_WAIT, IREE_ARRAYSIZE(spans),
+        spans, /*out_value=*/NULL, iree_byte_span_empty());
+    if (iree_status_is_ok(status)) {
+      if (wait_mode == IREE_HAL_WAIT_MODE_ALL) {
+        for (iree_host_size_t i = 0; i < semaphore_list.count; ++i) {
+          iree_hal_remote_semaphore_observe(
+              iree_hal_remote_semaphore_cast(semaphore_list.semaphores[i]),
+              semaphore_list.payload_values[i]);
+        }
+      }
+      break;
+    } else if (iree_status_is_deadline_exceeded(status) &&
+               request->timeout_ns < timeout_ns) {
+      // Only the slice expired; try again.
+      iree_status_ignore(status);
+      status = iree_ok_status();
+    }
+  }
+
+  iree_allocator_free(iree_hal_device_host_allocator(device), request);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_hal_remote_semaphore_wait(
+    iree_hal_semaphore_t* base_semaphore, uint64_t value,
+    iree_timeout_t timeout) {
+  iree_hal_remote_semaphore_t* semaphore =
+      iree_hal_remote_semaphore_cast(base_semaphore);
+  iree_hal_semaphore_list_t semaphore_list = {
+      .count = 1,
+      .semaphores = &base_semaphore,
+      .payload_values = &value,
+  };
+  return iree_hal_remote_semaphore_multi_wait(
+      semaphore->device, IREE_HAL_WAIT_MODE_ALL, semaphore_list, timeout);
+}
+
+static const iree_hal_semaphore_vtable_t iree_hal_remote_semaphore_vtable = {
+    .destroy = iree_hal_remote_semaphore_destroy,
+    .query = iree_hal_remote_semaphore_query,
+    .signal = iree_hal_remote_semaphore_signal,
+    .fail = iree_hal_remote_semaphore_fail,
+    .wait = iree_hal_remote_semaphore_wait,
+};
@@ -0,0 +1,45 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_HAL_REMOTE_SEMAPHORE_H_
+#define IREE_REMOTING_HAL_REMOTE_SEMAPHORE_H_
+
+#include "experimental/remoting/protocol/protocol.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Creates a semaphore proxying one created on the server |device| forwards to.
+iree_status_t iree_hal_remote_semaphore_create(
+    iree_hal_device_t* device, uint64_t initial_value,
+    iree_allocator_t host_allocator, iree_hal_semaphore_t** out_semaphore);
+
+// Returns true if |semaphore| is a remote semaphore.
+bool iree_hal_remote_semaphore_isa(iree_hal_semaphore_t* semaphore);
+
+// Returns the ID of the server semaphore proxied by |semaphore|.
+iree_remoting_id_t iree_hal_remote_semaphore_id(
+    iree_hal_semaphore_t* semaphore);
+
+// Copies |semaphore_list| into |out_values| as protocol semaphore values.
+// |out_values| must have room for |semaphore_list.count| values.
+iree_status_t iree_hal_remote_semaphore_list_serialize(
+    const iree_hal_semaphore_list_t semaphore_list,
+    iree_remoting_semaphore_value_t* out_values);
+
+// Waits on the server for |semaphore_list| to reach its values.
+iree_status_t iree_hal_remote_semaphore_multi_wait(
+    iree_hal_device_t* device, iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t semaphore_list, iree_timeout_t timeout);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_HAL_REMOTE_SEMAPHORE_H_
@@ -0,0 +1,460 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/remoting/hal/stream_command_buffer.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "experimental/remoting/hal/remote_buffer.h"
+#include "experimental/remoting/hal/remote_resources.h"
+#include "iree/base/tracing.h"
+
+// Maximum number of bindings in a single push; they are staged on the stack.
+#define IREE_HAL_REMOTE_MAX_PUSH_DESCRIPTOR_BINDINGS 32
+
+typedef struct iree_hal_remote_stream_command_buffer_t {
+  iree_hal_command_buffer_t base;
+  iree_allocator_t host_allocator;
+
+  // Target set with iree_hal_remote_stream_command_buffer_set_target.
+  iree_remoting_channel_t* channel;
+  iree_remoting_command_buffer_begin_t begin;
+} iree_hal_remote_stream_command_buffer_t;
+
+static const iree_hal_command_buffer_vtable_t
+    iree_hal_remote_stream_command_buffer_vtable;
+
+static iree_hal_remote_stream_command_buffer_t*
+iree_hal_remote_stream_command_buffer_cast(
+    iree_hal_command_buffer_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value,
+                       &iree_hal_remote_stream_command_buffer_vtable);
+  return (iree_hal_remote_stream_command_buffer_t*)base_value;
+}
+
+iree_status_t iree_hal_remote_stream_command_buffer_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  IREE_ASSERT_ARGUMENT(out_command_buffer);
+  *out_command_buffer = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_remote_stream_command_buffer_t* command_buffer = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, sizeof(*command_buffer),
+                            (void**)&command_buffer);
+  if (iree_status_is_ok(status)) {
+    // Commands were validated when they were recorded into the deferred
+    // command buffer being replayed.
+    iree_hal_command_buffer_initialize(
+        device, IREE_HAL_COMMAND_BUFFER_MODE_UNVALIDATED,
+        IREE_HAL_COMMAND_CATEGORY_ANY, IREE_HAL_QUEUE_AFFINITY_ANY,
+        /*binding_capacity=*/0, &iree_hal_remote_stream_command_buffer_vtable,
+        &command_buffer->base);
+    command_buffer->host_allocator = host_allocator;
+    command_buffer->channel = NULL;
+    memset(&command_buffer->begin, 0, sizeof(command_buffer->begin));
+    *out_command_buffer = &command_buffer->base;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_remote_stream_command_buffer_destroy(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_allocator_t host_allocator = command_buffer->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_allocator_free(host_allocator, command_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+void iree_hal_remote_stream_command_buffer_set_target(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_remoting_channel_t* channel, iree_remoting_id_t command_buffer_id,
+    iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  command_buffer->channel = channel;
+  command_buffer->begin.command_buffer_id = command_buffer_id;
+  command_buffer->begin.mode = mode;
+  command_buffer->begin.command_categories = command_categories;
+  command_buffer->begin.queue_affinity = queue_affinity;
+}
+
+static void* iree_hal_remote_stream_command_buffer_dyn_cast(
+    iree_hal_command_buffer_t* command_buffer, const void* vtable) {
+  if (vtable == &iree_hal_remote_stream_command_buffer_vtable) {
+    IREE_HAL_ASSERT_TYPE(command_buffer, vtable);
+    return command_buffer;
+  }
+  return NULL;
+}
+
+// Sends a command made up of |request| followed by |data|.
+static iree_status_t iree_hal_remote_stream_command_buffer_send(
+    iree_hal_remote_stream_command_buffer_t* command_buffer,
+    iree_remoting_message_type_t type, const void* request,
+    iree_host_size_t request_length, iree_const_byte_span_t data) {
+  iree_const_byte_span_t spans[2] = {
+      iree_make_const_byte_span(request, request_length),
+      data,
+  };
+  return iree_remoting_channel_send(command_buffer->channel, type,
+                                    IREE_REMOTING_MESSAGE_FLAG_NONE,
+                                    IREE_ARRAYSIZE(spans), spans);
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_begin(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  if (!command_buffer->channel) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "no target set on the command buffer");
+  }
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_COMMAND_BUFFER_BEGIN,
+      &command_buffer->begin, sizeof(command_buffer->begin),
+      iree_const_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_end(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_status_t status = iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_COMMAND_BUFFER_END, NULL, 0,
+      iree_const_byte_span_empty());
+  command_buffer->channel = NULL;
+  return status;
+}
+
+static void iree_hal_remote_stream_command_buffer_begin_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer, iree_string_view_t label,
+    iree_hal_label_color_t label_color,
+    const iree_hal_label_location_t* location) {
+  // Debug groups are not forwarded; use the server's tooling to profile.
+}
+
+static void iree_hal_remote_stream_command_buffer_end_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer) {}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_execution_barrier(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_hal_execution_barrier_flags_t flags,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  // Memory and buffer barriers are dropped; the execution barrier on the
+  // same stages is a (conservative) superset of them.
+  iree_remoting_cmd_execution_barrier_t request = {
+      .source_stage_mask = source_stage_mask,
+      .target_stage_mask = target_stage_mask,
+      .flags = flags,
+  };
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_EXECUTION_BARRIER, &request,
+      sizeof(request), iree_const_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_send_event(
+    iree_hal_remote_stream_command_buffer_t* command_buffer,
+    iree_remoting_message_type_t type, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  iree_remoting_cmd_event_t request = {
+      .source_stage_mask = source_stage_mask,
+  };
+  IREE_RETURN_IF_ERROR(iree_hal_remote_resource_id(event, &request.event_id));
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, type, &request, sizeof(request),
+      iree_const_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_signal_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  return iree_hal_remote_stream_command_buffer_send_event(
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer),
+      IREE_REMOTING_MESSAGE_CMD_SIGNAL_EVENT, event, source_stage_mask);
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_reset_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  return iree_hal_remote_stream_command_buffer_send_event(
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer),
+      IREE_REMOTING_MESSAGE_CMD_RESET_EVENT, event, source_stage_mask);
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_wait_events(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_host_size_t event_count, const iree_hal_event_t** events,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_remoting_id_t* event_ids = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_allocator_malloc(command_buffer->host_allocator,
+                            event_count * sizeof(*event_ids) + 1,
+                            (void**)&event_ids));
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < event_count; ++i) {
+    status = iree_hal_remote_resource_id(events[i], &event_ids[i]);
+    if (!iree_status_is_ok(status)) break;
+  }
+  if (iree_status_is_ok(status)) {
+    iree_remoting_cmd_wait_events_t request = {
+        .event_count = (uint32_t)event_count,
+        .source_stage_mask = source_stage_mask,
+        .target_stage_mask = target_stage_mask,
+    };
+    status = iree_hal_remote_stream_command_buffer_send(
+        command_buffer, IREE_REMOTING_MESSAGE_CMD_WAIT_EVENTS, &request,
+        sizeof(request),
+        iree_make_const_byte_span(event_ids, event_count * sizeof(*event_ids)));
+  }
+  iree_allocator_free(command_buffer->host_allocator, event_ids);
+  return status;
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_discard_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_buffer_t* buffer) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_remoting_cmd_discard_buffer_t request = {0};
+  iree_device_size_t offset = 0;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_remote_buffer_resolve(buffer, &request.buffer_id, &offset));
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_DISCARD_BUFFER, &request,
+      sizeof(request), iree_const_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_fill_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length, const void* pattern,
+    iree_host_size_t pattern_length) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  if (pattern_length > sizeof(uint64_t)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "fill patterns are at most 8 bytes, got %zu",
+                            pattern_length);
+  }
+  iree_remoting_cmd_fill_buffer_t request = {
+      .pattern_length = (uint32_t)pattern_length,
+      .length = length,
+  };
+  iree_device_size_t buffer_offset = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+      target_buffer, &request.target_buffer_id, &buffer_offset));
+  request.target_offset = buffer_offset + target_offset;
+  memcpy(&request.pattern, pattern, pattern_length);
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_FILL_BUFFER, &request,
+      sizeof(request), iree_const_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_update_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, const void* source_buffer,
+    iree_host_size_t source_offset, iree_hal_buffer_t* target_buffer,
+    iree_device_size_t target_offset, iree_device_size_t length) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_remoting_cmd_update_buffer_t request = {
+      .length = length,
+  };
+  iree_device_size_t buffer_offset = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+      target_buffer, &request.target_buffer_id, &buffer_offset));
+  request.target_offset = buffer_offset + target_offset;
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_UPDATE_BUFFER, &request,
+      sizeof(request),
+      iree_make_const_byte_span((const uint8_t*)source_buffer + source_offset,
+                                (iree_host_size_t)length));
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_copy_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* source_buffer, iree_device_size_t source_offset,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_remoting_cmd_copy_buffer_t request = {
+      .length = length,
+  };
+  iree_device_size_t source_buffer_offset = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+      source_buffer, &request.source_buffer_id, &source_buffer_offset));
+  iree_device_size_t target_buffer_offset = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+      target_buffer, &request.target_buffer_id, &target_buffer_offset));
+  request.source_offset = source_buffer_offset + source_offset;
+  request.target_offset = target_buffer_offset + target_offset;
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_COPY_BUFFER, &request,
+      sizeof(request), iree_const_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_push_constants(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, iree_host_size_t offset,
+    const void* values, iree_host_size_t values_length) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_remoting_cmd_push_constants_t request = {
+      .offset = (uint32_t)offset,
+      .values_length = (uint32_t)values_length,
+  };
+  IREE_RETURN_IF_ERROR(iree_hal_remote_resource_id(
+      executable_layout, &request.executable_layout_id));
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_PUSH_CONSTANTS, &request,
+      sizeof(request), iree_make_const_byte_span(values, values_length));
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_push_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_binding_t* bindings) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  if (binding_count > IREE_HAL_REMOTE_MAX_PUSH_DESCRIPTOR_BINDINGS) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "at most %d bindings may be pushed, got %zu",
+                            IREE_HAL_REMOTE_MAX_PUSH_DESCRIPTOR_BINDINGS,
+                            binding_count);
+  }
+  iree_remoting_cmd_push_descriptor_set_t request = {
+      .set = set,
+      .binding_count = (uint32_t)binding_count,
+  };
+  IREE_RETURN_IF_ERROR(iree_hal_remote_resource_id(
+      executable_layout, &request.executable_layout_id));
+  iree_remoting_descriptor_set_binding_t
+      remote_bindings[IREE_HAL_REMOTE_MAX_PUSH_DESCRIPTOR_BINDINGS];
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    iree_device_size_t buffer_offset = 0;
+    IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+        bindings[i].buffer, &remote_bindings[i].buffer_id, &buffer_offset));
+    remote_bindings[i].binding = bindings[i].binding;
+    remote_bindings[i].offset = buffer_offset + bindings[i].offset;
+    // Whole-buffer lengths are resolved here as the server only sees the
+    // allocated buffer and not any subspan of it.
+    remote_bindings[i].length =
+        bindings[i].length == IREE_WHOLE_BUFFER
+            ? iree_hal_buffer_byte_length(bindings[i].buffer) -
+                  bindings[i].offset
+            : bindings[i].length;
+  }
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_PUSH_DESCRIPTOR_SET, &request,
+      sizeof(request),
+      iree_make_const_byte_span(remote_bindings,
+                                binding_count * sizeof(remote_bindings[0])));
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_bind_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_hal_descriptor_set_t* descriptor_set,
+    iree_host_size_t dynamic_offset_count,
+    const iree_device_size_t* dynamic_offsets) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "descriptor sets are not supported remotely; use "
+                          "push descriptor sets");
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_dispatch(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_remoting_cmd_dispatch_t request = {
+      .entry_point = entry_point,
+      .workgroup_x = workgroup_x,
+      .workgroup_y = workgroup_y,
+      .workgroup_z = workgroup_z,
+  };
+  IREE_RETURN_IF_ERROR(
+      iree_hal_remote_resource_id(executable, &request.executable_id));
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_DISPATCH, &request,
+      sizeof(request), iree_const_byte_span_empty());
+}
+
+static iree_status_t iree_hal_remote_stream_command_buffer_dispatch_indirect(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    iree_hal_buffer_t* workgroups_buffer,
+    iree_device_size_t workgroups_offset) {
+  iree_hal_remote_stream_command_buffer_t* command_buffer =
+      iree_hal_remote_stream_command_buffer_cast(base_command_buffer);
+  iree_remoting_cmd_dispatch_indirect_t request = {
+      .entry_point = entry_point,
+  };
+  IREE_RETURN_IF_ERROR(
+      iree_hal_remote_resource_id(executable, &request.executable_id));
+  iree_device_size_t buffer_offset = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_remote_buffer_resolve(
+      workgroups_buffer, &request.workgroups_buffer_id, &buffer_offset));
+  request.workgroups_offset = buffer_offset + workgroups_offset;
+  return iree_hal_remote_stream_command_buffer_send(
+      command_buffer, IREE_REMOTING_MESSAGE_CMD_DISPATCH_INDIRECT, &request,
+      sizeof(request), iree_const_byte_span_empty());
+}
+
+static const iree_hal_command_buffer_vtable_t
+    iree_hal_remote_stream_command_buffer_vtable = {
+        .destroy = iree_hal_remote_stream_command_buffer_destroy,
+        .dyn_cast = iree_hal_remote_stream_command_buffer_dyn_cast,
+        .begin = iree_hal_remote_stream_command_buffer_begin,
+        .end = iree_hal_remote_stream_command_buffer_end,
+        .begin_debug_group =
+            iree_hal_remote_stream_command_buffer_begin_debug_group,
+        .end_debug_group =
+            iree_hal_remote_stream_command_buffer_end_debug_group,
+        .execution_barrier =
+            iree_hal_remote_stream_command_buffer_execution_barrier,
+        .signal_event = iree_hal_remote_stream_command_buffer_signal_event,
+        .reset_event = iree_hal_remote_stream_command_buffer_reset_event,
+        .wait_events = iree_hal_remote_stream_command_buffer_wait_events,
+        .discard_buffer = iree_hal_remote_stream_command_buffer_discard_buffer,
+        .fill_buffer = iree_hal_remote_stream_command_buffer_fill_buffer,
+        .update_buffer = iree_hal_remote_stream_command_buffer_update_buffer,
+        .copy_buffer = iree_hal_remote_stream_command_buffer_copy_buffer,
+        .push_constants = iree_hal_remote_stream_command_buffer_push_constants,
+        .push_descriptor_set =
+            iree_hal_remote_stream_command_buffer_push_descriptor_set,
+        .bind_descriptor_set =
+            iree_hal_remote_stream_command_buffer_bind_descriptor_set,
+        .dispatch = iree_hal_remote_stream_command_buffer_dispatch,
+        .dispatch_indirect =
+            iree_hal_remote_stream_command_buffer_dispatch_indirect,
+};
@@ -0,0 +1,39 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_HAL_STREAM_COMMAND_BUFFER_H_
+#define IREE_REMOTING_HAL_STREAM_COMMAND_BUFFER_H_
+
+#include "experimental/remoting/protocol/channel.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Creates a command buffer that streams each command recorded into it to the
+// server as a message. Deferred command buffers are replayed into it when
+// submitted; it is never exposed to users.
+iree_status_t iree_hal_remote_stream_command_buffer_create(
+    iree_hal_device_t* device, iree_allocator_t host_allocator,
+    iree_hal_command_buffer_t** out_command_buffer);
+
+// Sets the |channel| commands are sent on and the server command buffer they
+// are recorded into. Must be called before each begin and the caller must
+// have exclusive access to |channel| until end.
+void iree_hal_remote_stream_command_buffer_set_target(
+    iree_hal_command_buffer_t* command_buffer,
+    iree_remoting_channel_t* channel, iree_remoting_id_t command_buffer_id,
+    iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_HAL_STREAM_COMMAND_BUFFER_H_
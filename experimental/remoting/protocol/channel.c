@@ -0,0 +1,224 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/remoting/protocol/channel.h"
+
+#include <string.h>
+
+#include "iree/base/tracing.h"
+
+iree_status_t iree_remoting_channel_initialize(
+    iree_remoting_transport_t* transport, iree_host_size_t batch_capacity,
+    iree_allocator_t host_allocator, iree_remoting_channel_t* out_channel) {
+  IREE_ASSERT_ARGUMENT(transport);
+  IREE_ASSERT_ARGUMENT(out_channel);
+  memset(out_channel, 0, sizeof(*out_channel));
+  out_channel->host_allocator = host_allocator;
+  out_channel->transport = transport;
+  out_channel->send_capacity =
+      iree_max(batch_capacity, sizeof(iree_remoting_message_header_t) +
+                                   IREE_REMOTING_CHANNEL_INLINE_SPAN_LIMIT);
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, out_channel->send_capacity,
+                            (void**)&out_channel->send_buffer);
+  if (!iree_status_is_ok(status)) {
+    iree_remoting_channel_deinitialize(out_channel);
+  }
+  return status;
+}
+
+void iree_remoting_channel_deinitialize(iree_remoting_channel_t* channel) {
+  iree_allocator_free(channel->host_allocator, channel->send_buffer);
+  iree_allocator_free(channel->host_allocator, channel->recv_buffer);
+  iree_remoting_transport_destroy(channel->transport);
+  memset(channel, 0, sizeof(*channel));
+}
+
+static iree_const_byte_span_t iree_remoting_channel_pending(
+    iree_remoting_channel_t* channel) {
+  return iree_make_const_byte_span(channel->send_buffer, channel->send_length);
+}
+
+iree_status_t iree_remoting_channel_flush(iree_remoting_channel_t* channel) {
+  if (channel->send_length == 0) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, channel->send_length);
+  iree_const_byte_span_t pending = iree_remoting_channel_pending(channel);
+  channel->send_length = 0;
+  iree_status_t status =
+      channel->transport->vtable->send(channel->transport, 1, &pending);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Copies |data| into the batch buffer, flushing first if it doesn't fit.
+static iree_status_t iree_remoting_channel_append(
+    iree_remoting_channel_t* channel, const void* data,
+    iree_host_size_t length) {
+  if (channel->send_length + length > channel->send_capacity) {
+    IREE_RETURN_IF_ERROR(iree_remoting_channel_flush(channel));
+  }
+  memcpy(channel->send_buffer + channel->send_length, data, length);
+  channel->send_length += length;
+  return iree_ok_status();
+}
+
+iree_status_t iree_remoting_channel_send(iree_remoting_channel_t* channel,
+                                         iree_remoting_message_type_t type,
+                                         iree_remoting_message_flags_t flags,
+                                         iree_host_size_t span_count,
+                                         const iree_const_byte_span_t* spans) {
+  iree_remoting_message_header_t header = {
+      .type = type,
+      .flags = flags,
+      .length = 0,
+  };
+  for (iree_host_size_t i = 0; i < span_count; ++i) {
+    header.length += spans[i].data_length;
+  }
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_channel_append(channel, &header, sizeof(header)));
+  for (iree_host_size_t i = 0; i < span_count; ++i) {
+    if (spans[i].data_length < IREE_REMOTING_CHANNEL_INLINE_SPAN_LIMIT) {
+      IREE_RETURN_IF_ERROR(iree_remoting_channel_append(
+          channel, spans[i].data, spans[i].data_length));
+      continue;
+    }
+    // Send large spans from the caller's memory along with everything
+    // batched so far in one gather write.
+    iree_const_byte_span_t send_spans[2] = {
+        iree_remoting_channel_pending(channel),
+        spans[i],
+    };
+    channel->send_length = 0;
+    IREE_RETURN_IF_ERROR(channel->transport->vtable->send(
+        channel->transport, IREE_ARRAYSIZE(send_spans), send_spans));
+  }
+  return iree_ok_status();
+}
+
+iree_status_t iree_remoting_channel_recv_header(
+    iree_remoting_channel_t* channel,
+    iree_remoting_message_header_t* out_header) {
+  return channel->transport->vtable->recv(channel->transport, out_header,
+                                          sizeof(*out_header));
+}
+
+iree_status_t iree_remoting_channel_recv_payload(
+    iree_remoting_channel_t* channel, iree_host_size_t length,
+    iree_byte_span_t* out_payload) {
+  if (length > channel->recv_capacity) {
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        channel->host_allocator, length, (void**)&channel->recv_buffer));
+    channel->recv_capacity = length;
+  }
+  IREE_RETURN_IF_ERROR(channel->transport->vtable->recv(
+      channel->transport, channel->recv_buffer, length));
+  *out_payload = iree_make_byte_span(channel->recv_buffer, length);
+  return iree_ok_status();
+}
+
+iree_status_t iree_remoting_channel_recv_into(iree_remoting_channel_t* channel,
+                                              void* target,
+                                              iree_host_size_t length) {
+  if (length == 0) return iree_ok_status();
+  return channel->transport->vtable->recv(channel->transport, target, length);
+}
+
+iree_status_t iree_remoting_channel_call(iree_remoting_channel_t* channel,
+                                         iree_remoting_message_type_t type,
+                                         iree_host_size_t span_count,
+                                         const iree_const_byte_span_t* spans,
+                                         int64_t* out_value,
+                                         iree_byte_span_t result_data) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, type);
+  if (out_value) *out_value = 0;
+
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_remoting_channel_send(channel, type,
+                                     IREE_REMOTING_MESSAGE_FLAG_REPLY,
+                                     span_count, spans));
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(z0, iree_remoting_channel_flush(channel));
+
+  iree_remoting_message_header_t header;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_remoting_channel_recv_header(channel, &header));
+  iree_remoting_reply_t reply;
+  if (header.type != IREE_REMOTING_MESSAGE_REPLY ||
+      header.length < sizeof(reply)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_DATA_LOSS,
+                            "expected a reply message, got type %u",
+                            header.type);
+  }
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_remoting_channel_recv_into(channel, &reply, sizeof(reply)));
+  iree_host_size_t data_length =
+      (iree_host_size_t)header.length - sizeof(reply) - reply.message_length;
+
+  iree_status_t status = iree_ok_status();
+  if (reply.status_code != IREE_STATUS_OK) {
+    // Failed; the reply carries the message but no data.
+    iree_byte_span_t message = iree_byte_span_empty();
+    status = iree_remoting_channel_recv_payload(
+        channel, reply.message_length + data_length, &message);
+    if (iree_status_is_ok(status)) {
+      status = iree_make_status((iree_status_code_t)reply.status_code,
+                                "remote: %.*s", (int)reply.message_length,
+                                (const char*)message.data);
+    }
+  } else if (data_length != result_data.data_length) {
+    status = iree_make_status(IREE_STATUS_DATA_LOSS,
+                              "reply carries %zu bytes, expected %zu",
+                              data_length, result_data.data_length);
+  } else {
+    iree_byte_span_t message = iree_byte_span_empty();
+    status = iree_remoting_channel_recv_payload(channel, reply.message_length,
+                                                &message);
+    if (iree_status_is_ok(status)) {
+      status = iree_remoting_channel_recv_into(channel, result_data.data,
+                                               result_data.data_length);
+    }
+    if (iree_status_is_ok(status) && out_value) *out_value = reply.value;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_remoting_channel_reply(iree_remoting_channel_t* channel,
+                                          iree_status_t status, int64_t value,
+                                          iree_const_byte_span_t data) {
+  char message[256];
+  iree_host_size_t message_length = 0;
+  if (!iree_status_is_ok(status)) {
+    if (!iree_status_format(status, sizeof(message), message,
+                            &message_length)) {
+      // Too long to format in full; send just the status code.
+      iree_string_view_t code_string = iree_make_cstring_view(
+          iree_status_code_string(iree_status_code(status)));
+      message_length = iree_string_view_append_to_buffer(
+          code_string, &code_string, message);
+    }
+    data = iree_const_byte_span_empty();
+  }
+  iree_remoting_reply_t reply = {
+      .status_code = iree_status_code(status),
+      .message_length = (uint32_t)message_length,
+      .value = value,
+  };
+  iree_status_ignore(status);
+  iree_const_byte_span_t spans[3] = {
+      iree_make_const_byte_span(&reply, sizeof(reply)),
+      iree_make_const_byte_span(message, message_length),
+      data,
+  };
+  IREE_RETURN_IF_ERROR(iree_remoting_channel_send(
+      channel, IREE_REMOTING_MESSAGE_REPLY, IREE_REMOTING_MESSAGE_FLAG_NONE,
+      IREE_ARRAYSIZE(spans), spans));
+  return iree_remoting_channel_flush(channel);
+}
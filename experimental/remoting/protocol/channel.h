@@ -0,0 +1,102 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_PROTOCOL_CHANNEL_H_
+#define IREE_REMOTING_PROTOCOL_CHANNEL_H_
+
+#include "experimental/remoting/protocol/protocol.h"
+#include "experimental/remoting/protocol/transport.h"
+#include "iree/base/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Spans at least this large are sent directly from the caller's memory
+// instead of being copied into the batch buffer.
+#define IREE_REMOTING_CHANNEL_INLINE_SPAN_LIMIT (16 * 1024)
+
+// Frames messages over a transport.
+//
+// Outgoing messages are appended to a batch buffer and only sent when the
+// buffer fills or the channel is flushed. Streams of commands that don't
+// need a reply (recording, queue submissions, uploads) are pipelined into as
+// few sends as possible while the server works through earlier ones.
+//
+// Thread-compatible; callers must serialize access.
+typedef struct iree_remoting_channel_t {
+  iree_allocator_t host_allocator;
+  // Owned.
+  iree_remoting_transport_t* transport;
+
+  uint8_t* send_buffer;
+  iree_host_size_t send_capacity;
+  iree_host_size_t send_length;
+
+  // Storage for the most recently received message payload.
+  uint8_t* recv_buffer;
+  iree_host_size_t recv_capacity;
+} iree_remoting_channel_t;
+
+// Initializes |out_channel| to frame messages over |transport|, taking
+// ownership of it.
+iree_status_t iree_remoting_channel_initialize(
+    iree_remoting_transport_t* transport, iree_host_size_t batch_capacity,
+    iree_allocator_t host_allocator, iree_remoting_channel_t* out_channel);
+
+// Deinitializes |channel| and destroys its transport. Pending messages are
+// discarded.
+void iree_remoting_channel_deinitialize(iree_remoting_channel_t* channel);
+
+// Appends a message of |type| made up of the concatenation of |spans|.
+// The message may be sent at any time before the next flush; the spans are
+// only referenced for the duration of the call.
+iree_status_t iree_remoting_channel_send(iree_remoting_channel_t* channel,
+                                         iree_remoting_message_type_t type,
+                                         iree_remoting_message_flags_t flags,
+                                         iree_host_size_t span_count,
+                                         const iree_const_byte_span_t* spans);
+
+// Sends all pending messages.
+iree_status_t iree_remoting_channel_flush(iree_remoting_channel_t* channel);
+
+// Receives the next message header.
+iree_status_t iree_remoting_channel_recv_header(
+    iree_remoting_channel_t* channel,
+    iree_remoting_message_header_t* out_header);
+
+// Receives |length| bytes of the current message into channel storage.
+// The returned span is valid until the next receive.
+iree_status_t iree_remoting_channel_recv_payload(
+    iree_remoting_channel_t* channel, iree_host_size_t length,
+    iree_byte_span_t* out_payload);
+
+// Receives |length| bytes of the current message directly into |target|.
+iree_status_t iree_remoting_channel_recv_into(iree_remoting_channel_t* channel,
+                                              void* target,
+                                              iree_host_size_t length);
+
+// Sends a message with IREE_REMOTING_MESSAGE_FLAG_REPLY, flushes, and waits
+// for the reply. Returns the failure reported by the server, if any.
+// |out_value| receives the scalar result and, if |result_data| is not empty,
+// the data accompanying the reply is received into it.
+iree_status_t iree_remoting_channel_call(iree_remoting_channel_t* channel,
+                                         iree_remoting_message_type_t type,
+                                         iree_host_size_t span_count,
+                                         const iree_const_byte_span_t* spans,
+                                         int64_t* out_value,
+                                         iree_byte_span_t result_data);
+
+// Sends a reply with |status| (consumed) and optional |value| and |data|.
+iree_status_t iree_remoting_channel_reply(iree_remoting_channel_t* channel,
+                                          iree_status_t status, int64_t value,
+                                          iree_const_byte_span_t data);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_PROTOCOL_CHANNEL_H_
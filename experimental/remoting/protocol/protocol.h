@@ -0,0 +1,362 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Wire protocol spoken between the remote HAL driver (client) and the server
+// process that owns the real device.
+//
+// The client streams messages to the server which executes them in order.
+// Resources are named by 32-bit IDs assigned by the client so that creating a
+// resource and using it never requires waiting on the server. Only messages
+// with IREE_REMOTING_MESSAGE_FLAG_REPLY receive a reply; any failure of the
+// messages before a reply is returned with it and fails the connection (like
+// a lost device).
+//
+// All values are little-endian and structs are naturally aligned so they can
+// be read in place. Variable-length data follows each message struct.
+
+#ifndef IREE_REMOTING_PROTOCOL_PROTOCOL_H_
+#define IREE_REMOTING_PROTOCOL_PROTOCOL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// 'IREM'
+#define IREE_REMOTING_PROTOCOL_MAGIC 0x4D455249u
+#define IREE_REMOTING_PROTOCOL_VERSION 1u
+
+// Client-assigned resource ID. 0 is reserved for NULL.
+typedef uint32_t iree_remoting_id_t;
+
+typedef uint32_t iree_remoting_message_type_t;
+enum iree_remoting_message_type_e {
+  IREE_REMOTING_MESSAGE_HELLO = 0,
+  IREE_REMOTING_MESSAGE_REPLY,
+
+  // Device.
+  IREE_REMOTING_MESSAGE_DEVICE_QUERY_I64,
+  IREE_REMOTING_MESSAGE_DEVICE_TRIM,
+  IREE_REMOTING_MESSAGE_DEVICE_WAIT_IDLE,
+  IREE_REMOTING_MESSAGE_RESOURCE_RELEASE,
+
+  // Buffers.
+  IREE_REMOTING_MESSAGE_BUFFER_ALLOCATE,
+  IREE_REMOTING_MESSAGE_BUFFER_WRITE,
+  IREE_REMOTING_MESSAGE_BUFFER_READ,
+  IREE_REMOTING_MESSAGE_BUFFER_COPY,
+
+  // Executables and their layouts.
+  IREE_REMOTING_MESSAGE_DESCRIPTOR_SET_LAYOUT_CREATE,
+  IREE_REMOTING_MESSAGE_EXECUTABLE_LAYOUT_CREATE,
+  IREE_REMOTING_MESSAGE_EXECUTABLE_CAN_PREPARE_FORMAT,
+  IREE_REMOTING_MESSAGE_EXECUTABLE_CREATE,
+
+  // Synchronization.
+  IREE_REMOTING_MESSAGE_EVENT_CREATE,
+  IREE_REMOTING_MESSAGE_SEMAPHORE_CREATE,
+  IREE_REMOTING_MESSAGE_SEMAPHORE_QUERY,
+  IREE_REMOTING_MESSAGE_SEMAPHORE_SIGNAL,
+  IREE_REMOTING_MESSAGE_SEMAPHORE_FAIL,
+  IREE_REMOTING_MESSAGE_SEMAPHORE_WAIT,
+
+  // Command buffer recording. Commands between BEGIN and END are recorded into
+  // the command buffer being begun.
+  IREE_REMOTING_MESSAGE_COMMAND_BUFFER_BEGIN,
+  IREE_REMOTING_MESSAGE_COMMAND_BUFFER_END,
+  IREE_REMOTING_MESSAGE_CMD_EXECUTION_BARRIER,
+  IREE_REMOTING_MESSAGE_CMD_SIGNAL_EVENT,
+  IREE_REMOTING_MESSAGE_CMD_RESET_EVENT,
+  IREE_REMOTING_MESSAGE_CMD_WAIT_EVENTS,
+  IREE_REMOTING_MESSAGE_CMD_DISCARD_BUFFER,
+  IREE_REMOTING_MESSAGE_CMD_FILL_BUFFER,
+  IREE_REMOTING_MESSAGE_CMD_UPDATE_BUFFER,
+  IREE_REMOTING_MESSAGE_CMD_COPY_BUFFER,
+  IREE_REMOTING_MESSAGE_CMD_PUSH_CONSTANTS,
+  IREE_REMOTING_MESSAGE_CMD_PUSH_DESCRIPTOR_SET,
+  IREE_REMOTING_MESSAGE_CMD_DISPATCH,
+  IREE_REMOTING_MESSAGE_CMD_DISPATCH_INDIRECT,
+
+  // Queue operations.
+  IREE_REMOTING_MESSAGE_QUEUE_SUBMIT,
+  IREE_REMOTING_MESSAGE_QUEUE_ALLOCA,
+  IREE_REMOTING_MESSAGE_QUEUE_DEALLOCA,
+
+  IREE_REMOTING_MESSAGE_TYPE_COUNT,
+};
+
+typedef uint32_t iree_remoting_message_flags_t;
+enum iree_remoting_message_flag_bits_e {
+  IREE_REMOTING_MESSAGE_FLAG_NONE = 0u,
+  // The sender waits for an IREE_REMOTING_MESSAGE_REPLY.
+  IREE_REMOTING_MESSAGE_FLAG_REPLY = 1u << 0,
+};
+
+// Precedes every message on the wire.
+typedef struct iree_remoting_message_header_t {
+  iree_remoting_message_type_t type;
+  iree_remoting_message_flags_t flags;
+  // Length of the message following the header, in bytes.
+  uint64_t length;
+} iree_remoting_message_header_t;
+
+typedef struct iree_remoting_hello_t {
+  uint32_t magic;
+  uint32_t version;
+} iree_remoting_hello_t;
+
+// Followed by |message_length| characters of status message and then any
+// data the request returns.
+typedef struct iree_remoting_reply_t {
+  // iree_status_code_t of the first failure since the last reply.
+  uint32_t status_code;
+  uint32_t message_length;
+  // Scalar result of the request (query values, etc).
+  int64_t value;
+} iree_remoting_reply_t;
+
+// A semaphore and payload value pair in a semaphore list.
+typedef struct iree_remoting_semaphore_value_t {
+  iree_remoting_id_t semaphore_id;
+  uint32_t reserved;
+  uint64_t value;
+} iree_remoting_semaphore_value_t;
+
+// Followed by |category_length| + |key_length| characters.
+typedef struct iree_remoting_device_query_i64_t {
+  uint32_t category_length;
+  uint32_t key_length;
+} iree_remoting_device_query_i64_t;
+
+typedef struct iree_remoting_device_wait_idle_t {
+  // Relative timeout; INT64_MAX waits forever.
+  int64_t timeout_ns;
+} iree_remoting_device_wait_idle_t;
+
+typedef struct iree_remoting_resource_release_t {
+  iree_remoting_id_t id;
+} iree_remoting_resource_release_t;
+
+typedef struct iree_remoting_buffer_allocate_t {
+  iree_remoting_id_t buffer_id;
+  uint32_t memory_type;
+  uint32_t access;
+  uint32_t usage;
+  uint64_t queue_affinity;
+  uint64_t min_alignment;
+  uint64_t allocation_size;
+} iree_remoting_buffer_allocate_t;
+
+// BUFFER_WRITE is followed by |length| bytes of data.
+// BUFFER_READ replies with |length| bytes of data.
+typedef struct iree_remoting_buffer_range_t {
+  iree_remoting_id_t buffer_id;
+  uint32_t reserved;
+  uint64_t offset;
+  uint64_t length;
+} iree_remoting_buffer_range_t;
+
+typedef struct iree_remoting_buffer_copy_t {
+  iree_remoting_id_t source_buffer_id;
+  iree_remoting_id_t target_buffer_id;
+  uint64_t source_offset;
+  uint64_t target_offset;
+  uint64_t length;
+} iree_remoting_buffer_copy_t;
+
+// Followed by |binding_count| bindings.
+typedef struct iree_remoting_descriptor_set_layout_create_t {
+  iree_remoting_id_t set_layout_id;
+  uint32_t usage_type;
+  uint32_t binding_count;
+  uint32_t reserved;
+} iree_remoting_descriptor_set_layout_create_t;
+
+typedef struct iree_remoting_descriptor_set_layout_binding_t {
+  uint32_t binding;
+  uint32_t type;
+} iree_remoting_descriptor_set_layout_binding_t;
+
+// Followed by |set_layout_count| set layout IDs.
+typedef struct iree_remoting_executable_layout_create_t {
+  iree_remoting_id_t executable_layout_id;
+  uint32_t push_constant_count;
+  uint32_t set_layout_count;
+  uint32_t reserved;
+} iree_remoting_executable_layout_create_t;
+
+// Followed by |format_length| characters. Replies with a boolean value.
+typedef struct iree_remoting_executable_can_prepare_format_t {
+  uint32_t caching_mode;
+  uint32_t format_length;
+} iree_remoting_executable_can_prepare_format_t;
+
+// Followed by |executable_layout_count| layout IDs, |constant_count| uint32_t
+// constants, |format_length| characters, padding to 8 bytes, and then
+// |data_length| bytes of executable data.
+typedef struct iree_remoting_executable_create_t {
+  iree_remoting_id_t executable_id;
+  uint32_t caching_mode;
+  uint32_t executable_layout_count;
+  uint32_t constant_count;
+  uint32_t format_length;
+  uint32_t reserved;
+  uint64_t data_length;
+} iree_remoting_executable_create_t;
+
+typedef struct iree_remoting_event_create_t {
+  iree_remoting_id_t event_id;
+} iree_remoting_event_create_t;
+
+typedef struct iree_remoting_semaphore_create_t {
+  iree_remoting_id_t semaphore_id;
+  uint32_t reserved;
+  uint64_t initial_value;
+} iree_remoting_semaphore_create_t;
+
+// SEMAPHORE_QUERY replies with the current value.
+// SEMAPHORE_SIGNAL sets the value.
+typedef iree_remoting_semaphore_value_t iree_remoting_semaphore_signal_t;
+
+typedef struct iree_remoting_semaphore_fail_t {
+  iree_remoting_id_t semaphore_id;
+  uint32_t status_code;
+} iree_remoting_semaphore_fail_t;
+
+// Followed by |semaphore_count| semaphore values.
+typedef struct iree_remoting_semaphore_wait_t {
+  uint32_t wait_mode;
+  uint32_t semaphore_count;
+  // Relative timeout; INT64_MAX waits forever.
+  int64_t timeout_ns;
+} iree_remoting_semaphore_wait_t;
+
+typedef struct iree_remoting_command_buffer_begin_t {
+  iree_remoting_id_t command_buffer_id;
+  uint32_t mode;
+  uint32_t command_categories;
+  uint32_t reserved;
+  uint64_t queue_affinity;
+} iree_remoting_command_buffer_begin_t;
+
+// Memory and buffer barriers are widened to a full execution barrier.
+typedef struct iree_remoting_cmd_execution_barrier_t {
+  uint32_t source_stage_mask;
+  uint32_t target_stage_mask;
+  uint32_t flags;
+  uint32_t reserved;
+} iree_remoting_cmd_execution_barrier_t;
+
+// Used for both SIGNAL_EVENT and RESET_EVENT.
+typedef struct iree_remoting_cmd_event_t {
+  iree_remoting_id_t event_id;
+  uint32_t source_stage_mask;
+} iree_remoting_cmd_event_t;
+
+// Followed by |event_count| event IDs.
+typedef struct iree_remoting_cmd_wait_events_t {
+  uint32_t event_count;
+  uint32_t source_stage_mask;
+  uint32_t target_stage_mask;
+  uint32_t reserved;
+} iree_remoting_cmd_wait_events_t;
+
+typedef struct iree_remoting_cmd_discard_buffer_t {
+  iree_remoting_id_t buffer_id;
+} iree_remoting_cmd_discard_buffer_t;
+
+typedef struct iree_remoting_cmd_fill_buffer_t {
+  iree_remoting_id_t target_buffer_id;
+  uint32_t pattern_length;
+  uint64_t target_offset;
+  uint64_t length;
+  // Up to 8 bytes of pattern; only the first |pattern_length| are used.
+  uint64_t pattern;
+} iree_remoting_cmd_fill_buffer_t;
+
+// Followed by |length| bytes of data.
+typedef struct iree_remoting_cmd_update_buffer_t {
+  iree_remoting_id_t target_buffer_id;
+  uint32_t reserved;
+  uint64_t target_offset;
+  uint64_t length;
+} iree_remoting_cmd_update_buffer_t;
+
+typedef iree_remoting_buffer_copy_t iree_remoting_cmd_copy_buffer_t;
+
+// Followed by |values_length| bytes of constants.
+typedef struct iree_remoting_cmd_push_constants_t {
+  iree_remoting_id_t executable_layout_id;
+  uint32_t offset;
+  uint32_t values_length;
+  uint32_t reserved;
+} iree_remoting_cmd_push_constants_t;
+
+// Followed by |binding_count| bindings.
+typedef struct iree_remoting_cmd_push_descriptor_set_t {
+  iree_remoting_id_t executable_layout_id;
+  uint32_t set;
+  uint32_t binding_count;
+  uint32_t reserved;
+} iree_remoting_cmd_push_descriptor_set_t;
+
+typedef struct iree_remoting_descriptor_set_binding_t {
+  uint32_t binding;
+  iree_remoting_id_t buffer_id;
+  uint64_t offset;
+  uint64_t length;
+} iree_remoting_descriptor_set_binding_t;
+
+typedef struct iree_remoting_cmd_dispatch_t {
+  iree_remoting_id_t executable_id;
+  int32_t entry_point;
+  uint32_t workgroup_x;
+  uint32_t workgroup_y;
+  uint32_t workgroup_z;
+  uint32_t reserved;
+} iree_remoting_cmd_dispatch_t;
+
+typedef struct iree_remoting_cmd_dispatch_indirect_t {
+  iree_remoting_id_t executable_id;
+  int32_t entry_point;
+  iree_remoting_id_t workgroups_buffer_id;
+  uint32_t reserved;
+  uint64_t workgroups_offset;
+} iree_remoting_cmd_dispatch_indirect_t;
+
+// Followed by |wait_count| semaphore values, |command_buffer_count| command
+// buffer IDs (padded to 8 bytes), and |signal_count| semaphore values.
+// The server releases the command buffers once the submission retires.
+typedef struct iree_remoting_queue_submit_t {
+  uint32_t command_categories;
+  uint32_t wait_count;
+  uint32_t command_buffer_count;
+  uint32_t signal_count;
+  uint64_t queue_affinity;
+} iree_remoting_queue_submit_t;
+
+// Followed by |wait_count| and then |signal_count| semaphore values.
+// ALLOCA binds the allocated buffer to |buffer_id| and DEALLOCA queues its
+// deallocation (only |buffer_id| and the semaphores are used). The handle
+// itself is released with RESOURCE_RELEASE like any other.
+typedef struct iree_remoting_queue_alloca_t {
+  iree_remoting_id_t buffer_id;
+  uint32_t wait_count;
+  uint32_t signal_count;
+  uint32_t memory_type;
+  uint32_t access;
+  uint32_t usage;
+  uint64_t queue_affinity;
+  uint64_t min_alignment;
+  uint64_t allocation_size;
+} iree_remoting_queue_alloca_t;
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_PROTOCOL_PROTOCOL_H_
@@ -0,0 +1,361 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// NOTE: must be first before _any_ system includes.
+#define _GNU_SOURCE
+
+#include "experimental/remoting/protocol/transport.h"
+
+#include <string.h>
+
+#include "iree/base/tracing.h"
+
+void iree_remoting_transport_destroy(iree_remoting_transport_t* transport) {
+  if (transport) transport->vtable->destroy(transport);
+}
+
+#if defined(IREE_PLATFORM_WINDOWS)
+
+iree_status_t iree_remoting_tcp_transport_connect(
+    iree_string_view_t address, iree_allocator_t host_allocator,
+    iree_remoting_transport_t** out_transport) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "TCP transport not yet implemented on Windows");
+}
+
+iree_status_t iree_remoting_tcp_listener_create(
+    iree_string_view_t address, iree_allocator_t host_allocator,
+    iree_remoting_tcp_listener_t** out_listener) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "TCP transport not yet implemented on Windows");
+}
+
+void iree_remoting_tcp_listener_destroy(
+    iree_remoting_tcp_listener_t* listener) {}
+
+iree_status_t iree_remoting_tcp_listener_accept(
+    iree_remoting_tcp_listener_t* listener,
+    iree_remoting_transport_t** out_transport) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "TCP transport not yet implemented on Windows");
+}
+
+#else
+
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Maximum number of spans sent with a single sendmsg call.
+#define IREE_REMOTING_TCP_MAX_IOVECS 16
+
+// Splits |address| ("host:port") into NUL-terminated |host| and |port|
+// strings. An empty host is returned as NULL.
+static iree_status_t iree_remoting_tcp_parse_address(
+    iree_string_view_t address, char* host, iree_host_size_t host_capacity,
+    char* port, iree_host_size_t port_capacity, const char** out_host) {
+  // Split on the last ':' so that IPv6 hosts ("[::1]:port") are preserved.
+  iree_host_size_t split_pos = iree_string_view_find_last_of(
+      address, IREE_SV(":"), address.size ? address.size - 1 : 0);
+  if (split_pos == IREE_STRING_VIEW_NPOS || split_pos + 1 == address.size) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "address '%.*s' is not of the form 'host:port'",
+                            (int)address.size, address.data);
+  }
+  iree_string_view_t host_part = iree_string_view_substr(address, 0, split_pos);
+  iree_string_view_t port_part =
+      iree_string_view_substr(address, split_pos + 1, IREE_STRING_VIEW_NPOS);
+  if (host_part.size >= 2 && host_part.data[0] == '[' &&
+      host_part.data[host_part.size - 1] == ']') {
+    host_part = iree_string_view_substr(host_part, 1, host_part.size - 2);
+  }
+  if (host_part.size >= host_capacity || port_part.size >= port_capacity) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "address '%.*s' is too long", (int)address.size,
+                            address.data);
+  }
+  memcpy(host, host_part.data, host_part.size);
+  host[host_part.size] = 0;
+  memcpy(port, port_part.data, port_part.size);
+  port[port_part.size] = 0;
+  *out_host = host_part.size ? host : NULL;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_tcp_resolve(iree_string_view_t address,
+                                               bool passive,
+                                               struct addrinfo** out_info) {
+  char host[256];
+  char port[16];
+  const char* host_ptr = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_tcp_parse_address(
+      address, host, sizeof(host), port, sizeof(port), &host_ptr));
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = passive ? AI_PASSIVE : 0;
+  int ret = getaddrinfo(host_ptr, port, &hints, out_info);
+  if (ret != 0) {
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "unable to resolve '%.*s': %s", (int)address.size,
+                            address.data, gai_strerror(ret));
+  }
+  return iree_ok_status();
+}
+
+//===----------------------------------------------------------------------===//
+// iree_remoting_tcp_transport_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_remoting_tcp_transport_t {
+  iree_remoting_transport_t base;
+  iree_allocator_t host_allocator;
+  int fd;
+} iree_remoting_tcp_transport_t;
+
+static const iree_remoting_transport_vtable_t
+    iree_remoting_tcp_transport_vtable;
+
+static iree_status_t iree_remoting_tcp_transport_wrap(
+    int fd, iree_allocator_t host_allocator,
+    iree_remoting_transport_t** out_transport) {
+  // Messages are batched by the channel so disable Nagle's algorithm to
+  // avoid delaying the flushes that precede waiting for a reply.
+  int enable = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+
+  iree_remoting_tcp_transport_t* transport = NULL;
+  iree_status_t status = iree_allocator_malloc(
+      host_allocator, sizeof(*transport), (void**)&transport);
+  if (iree_status_is_ok(status)) {
+    transport->base.vtable = &iree_remoting_tcp_transport_vtable;
+    transport->host_allocator = host_allocator;
+    transport->fd = fd;
+    *out_transport = &transport->base;
+  } else {
+    close(fd);
+  }
+  return status;
+}
+
+iree_status_t iree_remoting_tcp_transport_connect(
+    iree_string_view_t address, iree_allocator_t host_allocator,
+    iree_remoting_transport_t** out_transport) {
+  IREE_ASSERT_ARGUMENT(out_transport);
+  *out_transport = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  struct addrinfo* info = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_remoting_tcp_resolve(address, /*passive=*/false, &info));
+  int fd = -1;
+  int last_errno = 0;
+  for (struct addrinfo* it = info; it != NULL; it = it->ai_next) {
+    fd = socket(it->ai_family, it->ai_socktype, it->ai_protocol);
+    if (fd < 0) {
+      last_errno = errno;
+      continue;
+    }
+    if (connect(fd, it->ai_addr, it->ai_addrlen) == 0) break;
+    last_errno = errno;
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(info);
+
+  iree_status_t status = iree_ok_status();
+  if (fd < 0) {
+    status = iree_make_status(iree_status_code_from_errno(last_errno),
+                              "unable to connect to '%.*s': %s",
+                              (int)address.size, address.data,
+                              strerror(last_errno));
+  } else {
+    status = iree_remoting_tcp_transport_wrap(fd, host_allocator,
+                                              out_transport);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_remoting_tcp_transport_t* iree_remoting_tcp_transport_cast(
+    iree_remoting_transport_t* base_value) {
+  return (iree_remoting_tcp_transport_t*)base_value;
+}
+
+static void iree_remoting_tcp_transport_destroy(
+    iree_remoting_transport_t* base_transport) {
+  iree_remoting_tcp_transport_t* transport =
+      iree_remoting_tcp_transport_cast(base_transport);
+  close(transport->fd);
+  iree_allocator_free(transport->host_allocator, transport);
+}
+
+static iree_status_t iree_remoting_tcp_transport_send(
+    iree_remoting_transport_t* base_transport, iree_host_size_t span_count,
+    const iree_const_byte_span_t* spans) {
+  iree_remoting_tcp_transport_t* transport =
+      iree_remoting_tcp_transport_cast(base_transport);
+  struct iovec iovecs[IREE_REMOTING_TCP_MAX_IOVECS];
+  iree_host_size_t span_index = 0;
+  iree_host_size_t span_offset = 0;
+  while (span_index < span_count) {
+    // Gather as many of the remaining spans as fit into one sendmsg.
+    int iovec_count = 0;
+    for (iree_host_size_t i = span_index;
+         i < span_count && iovec_count < IREE_REMOTING_TCP_MAX_IOVECS; ++i) {
+      iree_host_size_t offset = i == span_index ? span_offset : 0;
+      if (spans[i].data_length == offset) continue;
+      iovecs[iovec_count].iov_base = (void*)(spans[i].data + offset);
+      iovecs[iovec_count].iov_len = spans[i].data_length - offset;
+      ++iovec_count;
+    }
+    if (iovec_count == 0) break;
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = iovecs;
+    message.msg_iovlen = iovec_count;
+    ssize_t sent = sendmsg(transport->fd, &message, MSG_NOSIGNAL);
+    if (sent < 0) {
+      if (errno == EINTR) continue;
+      return iree_make_status(iree_status_code_from_errno(errno),
+                              "send failed: %s", strerror(errno));
+    }
+    // Advance past the bytes that were sent.
+    iree_host_size_t remaining = (iree_host_size_t)sent;
+    while (span_index < span_count) {
+      iree_host_size_t available = spans[span_index].data_length - span_offset;
+      if (remaining < available) {
+        span_offset += remaining;
+        break;
+      }
+      remaining -= available;
+      ++span_index;
+      span_offset = 0;
+    }
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_tcp_transport_recv(
+    iree_remoting_transport_t* base_transport, void* buffer,
+    iree_host_size_t length) {
+  iree_remoting_tcp_transport_t* transport =
+      iree_remoting_tcp_transport_cast(base_transport);
+  uint8_t* ptr = (uint8_t*)buffer;
+  while (length > 0) {
+    ssize_t received = recv(transport->fd, ptr, length, MSG_WAITALL);
+    if (received == 0) {
+      return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                              "connection closed by peer");
+    } else if (received < 0) {
+      if (errno == EINTR) continue;
+      return iree_make_status(iree_status_code_from_errno(errno),
+                              "recv failed: %s", strerror(errno));
+    }
+    ptr += received;
+    length -= (iree_host_size_t)received;
+  }
+  return iree_ok_status();
+}
+
+static const iree_remoting_transport_vtable_t
+    iree_remoting_tcp_transport_vtable = {
+        .destroy = iree_remoting_tcp_transport_destroy,
+        .send = iree_remoting_tcp_transport_send,
+        .recv = iree_remoting_tcp_transport_recv,
+};
+
+//===----------------------------------------------------------------------===//
+// iree_remoting_tcp_listener_t
+//===----------------------------------------------------------------------===//
+
+struct iree_remoting_tcp_listener_t {
+  iree_allocator_t host_allocator;
+  int fd;
+};
+
+iree_status_t iree_remoting_tcp_listener_create(
+    iree_string_view_t address, iree_allocator_t host_allocator,
+    iree_remoting_tcp_listener_t** out_listener) {
+  IREE_ASSERT_ARGUMENT(out_listener);
+  *out_listener = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  struct addrinfo* info = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_remoting_tcp_resolve(address, /*passive=*/true, &info));
+  int fd = -1;
+  int last_errno = 0;
+  for (struct addrinfo* it = info; it != NULL; it = it->ai_next) {
+    fd = socket(it->ai_family, it->ai_socktype, it->ai_protocol);
+    if (fd < 0) {
+      last_errno = errno;
+      continue;
+    }
+    int reuse = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (bind(fd, it->ai_addr, it->ai_addrlen) == 0 && listen(fd, 8) == 0) {
+      break;
+    }
+    last_errno = errno;
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(info);
+  if (fd < 0) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(iree_status_code_from_errno(last_errno),
+                            "unable to listen on '%.*s': %s",
+                            (int)address.size, address.data,
+                            strerror(last_errno));
+  }
+
+  iree_remoting_tcp_listener_t* listener = NULL;
+  iree_status_t status = iree_allocator_malloc(
+      host_allocator, sizeof(*listener), (void**)&listener);
+  if (iree_status_is_ok(status)) {
+    listener->host_allocator = host_allocator;
+    listener->fd = fd;
+    *out_listener = listener;
+  } else {
+    close(fd);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_remoting_tcp_listener_destroy(
+    iree_remoting_tcp_listener_t* listener) {
+  if (!listener) return;
+  close(listener->fd);
+  iree_allocator_free(listener->host_allocator, listener);
+}
+
+iree_status_t iree_remoting_tcp_listener_accept(
+    iree_remoting_tcp_listener_t* listener,
+    iree_remoting_transport_t** out_transport) {
+  IREE_ASSERT_ARGUMENT(listener);
+  IREE_ASSERT_ARGUMENT(out_transport);
+  *out_transport = NULL;
+  int fd = -1;
+  do {
+    fd = accept(listener->fd, NULL, NULL);
+  } while (fd < 0 && errno == EINTR);
+  if (fd < 0) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "accept failed: %s", strerror(errno));
+  }
+  return iree_remoting_tcp_transport_wrap(fd, listener->host_allocator,
+                                          out_transport);
+}
+
+#endif  // IREE_PLATFORM_WINDOWS
@@ -0,0 +1,76 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_PROTOCOL_TRANSPORT_H_
+#define IREE_REMOTING_PROTOCOL_TRANSPORT_H_
+
+#include "iree/base/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_remoting_transport_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_remoting_transport_t iree_remoting_transport_t;
+
+typedef struct iree_remoting_transport_vtable_t {
+  void (*destroy)(iree_remoting_transport_t* transport);
+
+  // Sends the contents of all |spans| in order. The spans are only referenced
+  // for the duration of the call.
+  iree_status_t (*send)(iree_remoting_transport_t* transport,
+                        iree_host_size_t span_count,
+                        const iree_const_byte_span_t* spans);
+
+  // Receives exactly |length| bytes into |buffer|.
+  iree_status_t (*recv)(iree_remoting_transport_t* transport, void* buffer,
+                        iree_host_size_t length);
+} iree_remoting_transport_vtable_t;
+
+// A reliable, ordered byte stream between a client and a server.
+//
+// Transports send the caller's memory directly (with a gather write on TCP)
+// so large transfers are not copied into intermediate buffers. Transports
+// capable of zero-copy remote memory access (RDMA) can be added by
+// implementing this interface.
+struct iree_remoting_transport_t {
+  const iree_remoting_transport_vtable_t* vtable;
+};
+
+// Destroys |transport| and closes its connection.
+void iree_remoting_transport_destroy(iree_remoting_transport_t* transport);
+
+//===----------------------------------------------------------------------===//
+// TCP
+//===----------------------------------------------------------------------===//
+
+// Connects to a server listening on |address| ("host:port").
+iree_status_t iree_remoting_tcp_transport_connect(
+    iree_string_view_t address, iree_allocator_t host_allocator,
+    iree_remoting_transport_t** out_transport);
+
+typedef struct iree_remoting_tcp_listener_t iree_remoting_tcp_listener_t;
+
+// Listens for connections on |address| ("host:port" or ":port").
+iree_status_t iree_remoting_tcp_listener_create(
+    iree_string_view_t address, iree_allocator_t host_allocator,
+    iree_remoting_tcp_listener_t** out_listener);
+
+void iree_remoting_tcp_listener_destroy(iree_remoting_tcp_listener_t* listener);
+
+// Blocks until a client connects and returns its transport.
+iree_status_t iree_remoting_tcp_listener_accept(
+    iree_remoting_tcp_listener_t* listener,
+    iree_remoting_transport_t** out_transport);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_PROTOCOL_TRANSPORT_H_
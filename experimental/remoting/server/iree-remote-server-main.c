@@ -0,0 +1,86 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Serves a local HAL device to remote HAL driver clients.
+//
+// Example:
+//   iree-remote-server --device=cuda --listen=:9345
+//   iree-run-module --device=remote://gpuhost:9345 ...
+
+#include <stdio.h>
+
+#include "experimental/remoting/protocol/transport.h"
+#include "experimental/remoting/server/server.h"
+#include "iree/base/api.h"
+#include "iree/base/internal/flags.h"
+#include "iree/hal/api.h"
+#include "iree/tooling/device_util.h"
+
+IREE_FLAG(string, listen, "localhost:9345",
+          "Address to listen on for clients (`host:port` or `:port`).");
+
+IREE_FLAG(int32_t, batch_capacity, 64 * 1024,
+          "Capacity in bytes of the buffer replies are batched into.");
+
+// Serves clients one at a time until a non-client error occurs.
+static iree_status_t iree_remote_server_run(iree_hal_device_t* device,
+                                            iree_allocator_t host_allocator) {
+  iree_remoting_server_options_t options;
+  iree_remoting_server_options_initialize(&options);
+  options.batch_capacity = (iree_host_size_t)FLAG_batch_capacity;
+
+  iree_remoting_tcp_listener_t* listener = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_tcp_listener_create(
+      iree_make_cstring_view(FLAG_listen), host_allocator, &listener));
+  fprintf(stdout, "listening on %s\n", FLAG_listen);
+  fflush(stdout);
+
+  iree_status_t status = iree_ok_status();
+  while (iree_status_is_ok(status)) {
+    iree_remoting_transport_t* transport = NULL;
+    status = iree_remoting_tcp_listener_accept(listener, &transport);
+    if (!iree_status_is_ok(status)) break;
+    fprintf(stdout, "client connected\n");
+    fflush(stdout);
+    // A misbehaving client only ends its own session.
+    iree_status_t session_status =
+        iree_remoting_server_serve(device, transport, &options, host_allocator);
+    if (!iree_status_is_ok(session_status)) {
+      fprintf(stderr, "client session failed: ");
+      iree_status_fprint(stderr, session_status);
+      iree_status_ignore(session_status);
+    }
+    fprintf(stdout, "client disconnected\n");
+    fflush(stdout);
+  }
+
+  iree_remoting_tcp_listener_destroy(listener);
+  return status;
+}
+
+int main(int argc, char** argv) {
+  iree_flags_parse_checked(IREE_FLAGS_PARSE_MODE_DEFAULT, &argc, &argv);
+  if (argc > 1) {
+    fprintf(stderr, "usage: iree-remote-server --device=<uri> --listen=...\n");
+    return 1;
+  }
+
+  iree_allocator_t host_allocator = iree_allocator_system();
+  iree_hal_device_t* device = NULL;
+  iree_status_t status = iree_hal_create_device_from_flags(
+      iree_hal_default_device_uri(), host_allocator, &device);
+  if (iree_status_is_ok(status)) {
+    status = iree_remote_server_run(device, host_allocator);
+  }
+  iree_hal_device_release(device);
+
+  if (!iree_status_is_ok(status)) {
+    iree_status_fprint(stderr, status);
+    iree_status_free(status);
+    return 1;
+  }
+  return 0;
+}
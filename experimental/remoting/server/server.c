@@ -0,0 +1,1280 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/remoting/server/server.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "experimental/remoting/protocol/channel.h"
+#include "experimental/remoting/protocol/protocol.h"
+#include "iree/base/tracing.h"
+
+void iree_remoting_server_options_initialize(
+    iree_remoting_server_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->batch_capacity = 64 * 1024;
+}
+
+//===----------------------------------------------------------------------===//
+// Message reader
+//===----------------------------------------------------------------------===//
+
+// Reads the pieces of a received message in order.
+typedef struct iree_remoting_reader_t {
+  const uint8_t* data;
+  iree_host_size_t remaining;
+} iree_remoting_reader_t;
+
+// Returns a pointer to the next |length| bytes of the message in |out_data|.
+static iree_status_t iree_remoting_reader_read(iree_remoting_reader_t* reader,
+                                               iree_host_size_t length,
+                                               const void** out_data) {
+  if (length > reader->remaining) {
+    return iree_make_status(IREE_STATUS_DATA_LOSS,
+                            "message truncated; needed %zu bytes but only %zu "
+                            "remain",
+                            length, reader->remaining);
+  }
+  *out_data = reader->data;
+  reader->data += length;
+  reader->remaining -= length;
+  return iree_ok_status();
+}
+
+// Skips the padding following |unpadded_length| bytes of the message.
+static iree_status_t iree_remoting_reader_align(
+    iree_remoting_reader_t* reader, iree_host_size_t unpadded_length,
+    iree_host_size_t alignment) {
+  const void* padding = NULL;
+  return iree_remoting_reader_read(
+      reader, iree_host_align(unpadded_length, alignment) - unpadded_length,
+      &padding);
+}
+
+//===----------------------------------------------------------------------===//
+// Session
+//===----------------------------------------------------------------------===//
+
+typedef enum iree_remoting_handle_type_e {
+  IREE_REMOTING_HANDLE_TYPE_NONE = 0,
+  IREE_REMOTING_HANDLE_TYPE_BUFFER,
+  IREE_REMOTING_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT,
+  IREE_REMOTING_HANDLE_TYPE_EXECUTABLE_LAYOUT,
+  IREE_REMOTING_HANDLE_TYPE_EXECUTABLE,
+  IREE_REMOTING_HANDLE_TYPE_EVENT,
+  IREE_REMOTING_HANDLE_TYPE_SEMAPHORE,
+  IREE_REMOTING_HANDLE_TYPE_COMMAND_BUFFER,
+} iree_remoting_handle_type_t;
+
+// A resource created on behalf of the client, indexed by its client ID.
+typedef struct iree_remoting_handle_t {
+  iree_remoting_handle_type_t type;
+  iree_hal_resource_t* resource;
+} iree_remoting_handle_t;
+
+// A queue submission whose command buffers are kept live until all of its
+// signal semaphores are reached (or fail).
+typedef struct iree_remoting_submission_t {
+  struct iree_remoting_submission_t* next;
+  iree_host_size_t command_buffer_count;
+  iree_hal_command_buffer_t** command_buffers;
+  iree_hal_semaphore_list_t signal_semaphores;
+} iree_remoting_submission_t;
+
+typedef struct iree_remoting_session_t {
+  iree_allocator_t host_allocator;
+  iree_hal_device_t* device;
+  iree_hal_executable_cache_t* executable_cache;
+  iree_status_t loop_status;
+  iree_remoting_channel_t channel;
+
+  // Resources by client ID. Empty slots have IREE_REMOTING_HANDLE_TYPE_NONE.
+  iree_host_size_t handle_capacity;
+  iree_remoting_handle_t* handles;
+
+  // Command buffer between COMMAND_BUFFER_BEGIN and END. Owned by |handles|.
+  iree_hal_command_buffer_t* recording_command_buffer;
+
+  // Submissions that have not yet retired, newest first.
+  iree_remoting_submission_t* submissions;
+
+  // First failure of a message without a reply. Returned with the next reply
+  // after which the session ends.
+  iree_status_t sticky_status;
+
+  // Storage for data returned with replies.
+  uint8_t* scratch;
+  iree_host_size_t scratch_capacity;
+} iree_remoting_session_t;
+
+// Binds |resource| to |id|, taking ownership of the caller's reference.
+static iree_status_t iree_remoting_session_bind(
+    iree_remoting_session_t* session, iree_remoting_id_t id,
+    iree_remoting_handle_type_t type, void* resource) {
+  iree_status_t status = iree_ok_status();
+  if (id == 0) {
+    status = iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "resource ID 0 is reserved");
+  } else if (id >= session->handle_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max((iree_host_size_t)id + 1,
+                 iree_max((iree_host_size_t)16, session->handle_capacity * 2));
+    status = iree_allocator_realloc(session->host_allocator,
+                                    new_capacity * sizeof(*session->handles),
+                                    (void**)&session->handles);
+    if (iree_status_is_ok(status)) {
+      memset(session->handles + session->handle_capacity, 0,
+             (new_capacity - session->handle_capacity) *
+                 sizeof(*session->handles));
+      session->handle_capacity = new_capacity;
+    }
+  }
+  if (iree_status_is_ok(status) &&
+      session->handles[id].type != IREE_REMOTING_HANDLE_TYPE_NONE) {
+    status = iree_make_status(IREE_STATUS_ALREADY_EXISTS,
+                              "resource ID %u is already in use", id);
+  }
+  if (!iree_status_is_ok(status)) {
+    iree_hal_resource_release(resource);
+    return status;
+  }
+  session->handles[id].type = type;
+  session->handles[id].resource = (iree_hal_resource_t*)resource;
+  return iree_ok_status();
+}
+
+// Returns the resource of |type| bound to |id| in |out_resource| (unretained).
+static iree_status_t iree_remoting_session_lookup(
+    iree_remoting_session_t* session, iree_remoting_id_t id,
+    iree_remoting_handle_type_t type, void** out_resource) {
+  *out_resource = NULL;
+  if (id == 0 || id >= session->handle_capacity ||
+      session->handles[id].type == IREE_REMOTING_HANDLE_TYPE_NONE) {
+    return iree_make_status(IREE_STATUS_NOT_FOUND,
+                            "no resource is bound to ID %u", id);
+  }
+  if (session->handles[id].type != type) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "resource %u has type %d, expected %d", id,
+                            (int)session->handles[id].type, (int)type);
+  }
+  *out_resource = session->handles[id].resource;
+  return iree_ok_status();
+}
+
+// Releases the resource bound to |id| and frees the ID for reuse.
+static iree_status_t iree_remoting_session_unbind(
+    iree_remoting_session_t* session, iree_remoting_id_t id) {
+  if (id == 0 || id >= session->handle_capacity ||
+      session->handles[id].type == IREE_REMOTING_HANDLE_TYPE_NONE) {
+    return iree_make_status(IREE_STATUS_NOT_FOUND,
+                            "no resource is bound to ID %u", id);
+  }
+  iree_hal_resource_t* resource = session->handles[id].resource;
+  if (resource == (iree_hal_resource_t*)session->recording_command_buffer) {
+    session->recording_command_buffer = NULL;
+  }
+  session->handles[id].type = IREE_REMOTING_HANDLE_TYPE_NONE;
+  session->handles[id].resource = NULL;
+  iree_hal_resource_release(resource);
+  return iree_ok_status();
+}
+
+// Returns the command buffer being recorded in |out_command_buffer|.
+static iree_status_t iree_remoting_session_recording(
+    iree_remoting_session_t* session,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  *out_command_buffer = session->recording_command_buffer;
+  if (!*out_command_buffer) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "no command buffer is being recorded");
+  }
+  return iree_ok_status();
+}
+
+// Reads |count| semaphore values from |reader| into |out_list|.
+// The list must be freed with iree_remoting_session_free_semaphore_list.
+static iree_status_t iree_remoting_session_read_semaphore_list(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader,
+    uint32_t count, iree_hal_semaphore_list_t* out_list) {
+  memset(out_list, 0, sizeof(*out_list));
+  if (count == 0) return iree_ok_status();
+  const iree_remoting_semaphore_value_t* values = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(
+      reader, count * sizeof(*values), (const void**)&values));
+
+  // The payload values are placed first to keep them aligned.
+  uint8_t* storage = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      session->host_allocator,
+      count * (sizeof(uint64_t) + sizeof(iree_hal_semaphore_t*)),
+      (void**)&storage));
+  out_list->count = count;
+  out_list->payload_values = (uint64_t*)storage;
+  out_list->semaphores =
+      (iree_hal_semaphore_t**)(storage + count * sizeof(uint64_t));
+  for (uint32_t i = 0; i < count; ++i) {
+    out_list->payload_values[i] = values[i].value;
+    iree_status_t status = iree_remoting_session_lookup(
+        session, values[i].semaphore_id, IREE_REMOTING_HANDLE_TYPE_SEMAPHORE,
+        (void**)&out_list->semaphores[i]);
+    if (!iree_status_is_ok(status)) {
+      iree_allocator_free(session->host_allocator, storage);
+      memset(out_list, 0, sizeof(*out_list));
+      return status;
+    }
+  }
+  return iree_ok_status();
+}
+
+static void iree_remoting_session_free_semaphore_list(
+    iree_remoting_session_t* session, iree_hal_semaphore_list_t* list) {
+  iree_allocator_free(session->host_allocator, list->payload_values);
+  memset(list, 0, sizeof(*list));
+}
+
+static void iree_remoting_submission_free(
+    iree_allocator_t host_allocator, iree_remoting_submission_t* submission) {
+  for (iree_host_size_t i = 0; i < submission->command_buffer_count; ++i) {
+    iree_hal_command_buffer_release(submission->command_buffers[i]);
+  }
+  for (iree_host_size_t i = 0; i < submission->signal_semaphores.count; ++i) {
+    iree_hal_semaphore_release(submission->signal_semaphores.semaphores[i]);
+  }
+  iree_allocator_free(host_allocator, submission);
+}
+
+static bool iree_remoting_submission_has_retired(
+    iree_remoting_submission_t* submission) {
+  for (iree_host_size_t i = 0; i < submission->signal_semaphores.count; ++i) {
+    uint64_t value = 0;
+    iree_status_t status = iree_hal_semaphore_query(
+        submission->signal_semaphores.semaphores[i], &value);
+    if (!iree_status_is_ok(status)) {
+      // Failed semaphores will never be signaled.
+      iree_status_ignore(status);
+      continue;
+    }
+    if (value < submission->signal_semaphores.payload_values[i]) return false;
+  }
+  return true;
+}
+
+// Releases the resources of all submissions that have completed.
+static void iree_remoting_session_retire_submissions(
+    iree_remoting_session_t* session) {
+  iree_remoting_submission_t** link = &session->submissions;
+  while (*link) {
+    iree_remoting_submission_t* submission = *link;
+    if (iree_remoting_submission_has_retired(submission)) {
+      *link = submission->next;
+      iree_remoting_submission_free(session->host_allocator, submission);
+    } else {
+      link = &submission->next;
+    }
+  }
+}
+
+static iree_status_t iree_remoting_session_initialize(
+    iree_hal_device_t* device, iree_remoting_transport_t* transport,
+    const iree_remoting_server_options_t* options,
+    iree_allocator_t host_allocator, iree_remoting_session_t* out_session) {
+  memset(out_session, 0, sizeof(*out_session));
+  out_session->host_allocator = host_allocator;
+  out_session->device = device;
+  iree_hal_device_retain(device);
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_channel_initialize(transport, options->batch_capacity,
+                                       host_allocator, &out_session->channel));
+  return iree_hal_executable_cache_create(
+      device, iree_make_cstring_view("remote"),
+      iree_loop_inline(&out_session->loop_status),
+      &out_session->executable_cache);
+}
+
+static void iree_remoting_session_deinitialize(
+    iree_remoting_session_t* session) {
+  // A client may disconnect with work in flight; it must complete before the
+  // resources it uses are released.
+  if (session->submissions) {
+    iree_status_ignore(
+        iree_hal_device_wait_idle(session->device, iree_infinite_timeout()));
+  }
+  while (session->submissions) {
+    iree_remoting_submission_t* submission = session->submissions;
+    session->submissions = submission->next;
+    iree_remoting_submission_free(session->host_allocator, submission);
+  }
+  for (iree_host_size_t i = 0; i < session->handle_capacity; ++i) {
+    if (session->handles[i].resource) {
+      iree_hal_resource_release(session->handles[i].resource);
+    }
+  }
+  iree_allocator_free(session->host_allocator, session->handles);
+  iree_allocator_free(session->host_allocator, session->scratch);
+  iree_hal_executable_cache_release(session->executable_cache);
+  iree_remoting_channel_deinitialize(&session->channel);
+  iree_status_ignore(session->loop_status);
+  iree_status_ignore(session->sticky_status);
+  iree_hal_device_release(session->device);
+  memset(session, 0, sizeof(*session));
+}
+
+//===----------------------------------------------------------------------===//
+// Device and resources
+//===----------------------------------------------------------------------===//
+
+static iree_status_t iree_remoting_session_hello(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader,
+    int64_t* out_value) {
+  const iree_remoting_hello_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  if (request->magic != IREE_REMOTING_PROTOCOL_MAGIC) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "client is not speaking the IREE remoting "
+                            "protocol");
+  }
+  // The client decides whether it can speak our version.
+  *out_value = IREE_REMOTING_PROTOCOL_VERSION;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_session_device_query_i64(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader,
+    int64_t* out_value) {
+  const iree_remoting_device_query_i64_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  const char* category = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(
+      reader, request->category_length, (const void**)&category));
+  const char* key = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, request->key_length,
+                                                 (const void**)&key));
+  return iree_hal_device_query_i64(
+      session->device,
+      iree_make_string_view(category, request->category_length),
+      iree_make_string_view(key, request->key_length), out_value);
+}
+
+static iree_status_t iree_remoting_session_device_wait_idle(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_device_wait_idle_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  return iree_hal_device_wait_idle(session->device,
+                                   iree_make_timeout_ns(request->timeout_ns));
+}
+
+static iree_status_t iree_remoting_session_resource_release(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_resource_release_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  return iree_remoting_session_unbind(session, request->id);
+}
+
+//===----------------------------------------------------------------------===//
+// Buffers
+//===----------------------------------------------------------------------===//
+
+static iree_status_t iree_remoting_session_buffer_allocate(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_buffer_allocate_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_buffer_params_t params = {
+      .usage = request->usage,
+      .access = request->access,
+      .type = request->memory_type,
+      .queue_affinity = request->queue_affinity,
+      .min_alignment = request->min_alignment,
+  };
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
+      iree_hal_device_allocator(session->device), params,
+      request->allocation_size, iree_const_byte_span_empty(), &buffer));
+  return iree_remoting_session_bind(session, request->buffer_id,
+                                    IREE_REMOTING_HANDLE_TYPE_BUFFER, buffer);
+}
+
+static iree_status_t iree_remoting_session_buffer_write(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_buffer_range_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  const void* data = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(
+      reader, (iree_host_size_t)request->length, &data));
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&buffer));
+  return iree_hal_device_transfer_h2d(
+      session->device, data, buffer, request->offset, request->length,
+      IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+}
+
+static iree_status_t iree_remoting_session_buffer_read(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader,
+    iree_const_byte_span_t* out_data) {
+  const iree_remoting_buffer_range_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&buffer));
+  iree_host_size_t length = (iree_host_size_t)request->length;
+  if (length > session->scratch_capacity) {
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        session->host_allocator, length, (void**)&session->scratch));
+    session->scratch_capacity = length;
+  }
+  IREE_RETURN_IF_ERROR(iree_hal_device_transfer_d2h(
+      session->device, buffer, request->offset, session->scratch,
+      request->length, IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  *out_data = iree_make_const_byte_span(session->scratch, length);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_session_buffer_copy(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_buffer_copy_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_buffer_t* source_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->source_buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&source_buffer));
+  iree_hal_buffer_t* target_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->target_buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&target_buffer));
+  return iree_hal_device_transfer_d2d(
+      session->device, source_buffer, request->source_offset, target_buffer,
+      request->target_offset, request->length,
+      IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+}
+
+//===----------------------------------------------------------------------===//
+// Executables and their layouts
+//===----------------------------------------------------------------------===//
+
+static iree_status_t iree_remoting_session_descriptor_set_layout_create(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_descriptor_set_layout_create_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  const iree_remoting_descriptor_set_layout_binding_t* bindings = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(
+      reader, request->binding_count * sizeof(*bindings),
+      (const void**)&bindings));
+
+  iree_hal_descriptor_set_layout_binding_t* layout_bindings = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      session->host_allocator,
+      request->binding_count * sizeof(*layout_bindings) + 1,
+      (void**)&layout_bindings));
+  for (uint32_t i = 0; i < request->binding_count; ++i) {
+    layout_bindings[i].binding = bindings[i].binding;
+    layout_bindings[i].type = (iree_hal_descriptor_type_t)bindings[i].type;
+  }
+  iree_hal_descriptor_set_layout_t* set_layout = NULL;
+  iree_status_t status = iree_hal_descriptor_set_layout_create(
+      session->device,
+      (iree_hal_descriptor_set_layout_usage_type_t)request->usage_type,
+      request->binding_count, layout_bindings, &set_layout);
+  iree_allocator_free(session->host_allocator, layout_bindings);
+  IREE_RETURN_IF_ERROR(status);
+  return iree_remoting_session_bind(
+      session, request->set_layout_id,
+      IREE_REMOTING_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT, set_layout);
+}
+
+// Resolves |count| resource IDs of |type| from |reader| into a list that must
+// be freed by the caller.
+static iree_status_t iree_remoting_session_read_resource_list(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader,
+    uint32_t count, iree_remoting_handle_type_t type, void*** out_resources) {
+  *out_resources = NULL;
+  const iree_remoting_id_t* ids = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, count * sizeof(*ids),
+                                                 (const void**)&ids));
+  void** resources = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(session->host_allocator,
+                                             count * sizeof(*resources) + 1,
+                                             (void**)&resources));
+  for (uint32_t i = 0; i < count; ++i) {
+    iree_status_t status =
+        iree_remoting_session_lookup(session, ids[i], type, &resources[i]);
+    if (!iree_status_is_ok(status)) {
+      iree_allocator_free(session->host_allocator, resources);
+      return status;
+    }
+  }
+  *out_resources = resources;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_session_executable_layout_create(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_executable_layout_create_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  void** set_layouts = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_read_resource_list(
+      session, reader, request->set_layout_count,
+      IREE_REMOTING_HANDLE_TYPE_DESCRIPTOR_SET_LAYOUT, &set_layouts));
+  iree_hal_executable_layout_t* executable_layout = NULL;
+  iree_status_t status = iree_hal_executable_layout_create(
+      session->device, request->push_constant_count, request->set_layout_count,
+      (iree_hal_descriptor_set_layout_t**)set_layouts, &executable_layout);
+  iree_allocator_free(session->host_allocator, set_layouts);
+  IREE_RETURN_IF_ERROR(status);
+  return iree_remoting_session_bind(
+      session, request->executable_layout_id,
+      IREE_REMOTING_HANDLE_TYPE_EXECUTABLE_LAYOUT, executable_layout);
+}
+
+static iree_status_t iree_remoting_session_executable_can_prepare_format(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader,
+    int64_t* out_value) {
+  const iree_remoting_executable_can_prepare_format_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  const char* format = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(
+      reader, request->format_length, (const void**)&format));
+  *out_value = iree_hal_executable_cache_can_prepare_format(
+                   session->executable_cache,
+                   (iree_hal_executable_caching_mode_t)request->caching_mode,
+                   iree_make_string_view(format, request->format_length))
+                   ? 1
+                   : 0;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_session_executable_create(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_executable_create_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_executable_params_t params;
+  iree_hal_executable_params_initialize(&params);
+  params.caching_mode =
+      (iree_hal_executable_caching_mode_t)request->caching_mode;
+  params.constant_count = request->constant_count;
+  params.executable_layout_count = request->executable_layout_count;
+
+  void** executable_layouts = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_read_resource_list(
+      session, reader, request->executable_layout_count,
+      IREE_REMOTING_HANDLE_TYPE_EXECUTABLE_LAYOUT, &executable_layouts));
+  params.executable_layouts =
+      (iree_hal_executable_layout_t* const*)executable_layouts;
+  const char* format = NULL;
+  iree_status_t status = iree_remoting_reader_read(
+      reader, request->constant_count * sizeof(uint32_t),
+      (const void**)&params.constants);
+  if (iree_status_is_ok(status)) {
+    status = iree_remoting_reader_read(reader, request->format_length,
+                                       (const void**)&format);
+  }
+  if (iree_status_is_ok(status)) {
+    params.executable_format =
+        iree_make_string_view(format, request->format_length);
+    status = iree_remoting_reader_align(
+        reader,
+        sizeof(*request) +
+            request->executable_layout_count * sizeof(iree_remoting_id_t) +
+            request->constant_count * sizeof(uint32_t) + request->format_length,
+        8);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_remoting_reader_read(
+        reader, (iree_host_size_t)request->data_length,
+        (const void**)&params.executable_data.data);
+    params.executable_data.data_length =
+        (iree_host_size_t)request->data_length;
+  }
+
+  iree_hal_executable_t* executable = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_executable_cache_prepare_executable(
+        session->executable_cache, &params, &executable);
+  }
+  iree_allocator_free(session->host_allocator, executable_layouts);
+  IREE_RETURN_IF_ERROR(status);
+  return iree_remoting_session_bind(session, request->executable_id,
+                                    IREE_REMOTING_HANDLE_TYPE_EXECUTABLE,
+                                    executable);
+}
+
+//===----------------------------------------------------------------------===//
+// Synchronization
+//===----------------------------------------------------------------------===//
+
+static iree_status_t iree_remoting_session_event_create(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_event_create_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_event_t* event = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_event_create(session->device, &event));
+  return iree_remoting_session_bind(session, request->event_id,
+                                    IREE_REMOTING_HANDLE_TYPE_EVENT, event);
+}
+
+static iree_status_t iree_remoting_session_semaphore_create(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_semaphore_create_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_semaphore_create(
+      session->device, request->initial_value, &semaphore));
+  return iree_remoting_session_bind(session, request->semaphore_id,
+                                    IREE_REMOTING_HANDLE_TYPE_SEMAPHORE,
+                                    semaphore);
+}
+
+// Handles SEMAPHORE_QUERY and SEMAPHORE_SIGNAL.
+static iree_status_t iree_remoting_session_semaphore_value(
+    iree_remoting_session_t* session, iree_remoting_message_type_t type,
+    iree_remoting_reader_t* reader, int64_t* out_value) {
+  const iree_remoting_semaphore_value_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->semaphore_id, IREE_REMOTING_HANDLE_TYPE_SEMAPHORE,
+      (void**)&semaphore));
+  if (type == IREE_REMOTING_MESSAGE_SEMAPHORE_SIGNAL) {
+    return iree_hal_semaphore_signal(semaphore, request->value);
+  }
+  uint64_t value = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_semaphore_query(semaphore, &value));
+  *out_value = (int64_t)value;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_session_semaphore_fail(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_semaphore_fail_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_semaphore_t* semaphore = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->semaphore_id, IREE_REMOTING_HANDLE_TYPE_SEMAPHORE,
+      (void**)&semaphore));
+  iree_hal_semaphore_fail(
+      semaphore,
+      iree_status_from_code((iree_status_code_t)request->status_code));
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_session_semaphore_wait(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_semaphore_wait_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_semaphore_list_t semaphore_list;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_read_semaphore_list(
+      session, reader, request->semaphore_count, &semaphore_list));
+  iree_status_t status = iree_hal_device_wait_semaphores(
+      session->device, (iree_hal_wait_mode_t)request->wait_mode,
+      &semaphore_list, iree_make_timeout_ns(request->timeout_ns));
+  iree_remoting_session_free_semaphore_list(session, &semaphore_list);
+  return status;
+}
+
+//===----------------------------------------------------------------------===//
+// Command buffer recording
+//===----------------------------------------------------------------------===//
+
+static iree_status_t iree_remoting_session_command_buffer_begin(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_command_buffer_begin_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  if (session->recording_command_buffer) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "a command buffer is already being recorded");
+  }
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_command_buffer_create(
+      session->device, (iree_hal_command_buffer_mode_t)request->mode,
+      (iree_hal_command_category_t)request->command_categories,
+      request->queue_affinity, /*binding_capacity=*/0, &command_buffer));
+  iree_status_t status = iree_hal_command_buffer_begin(command_buffer);
+  if (!iree_status_is_ok(status)) {
+    iree_hal_command_buffer_release(command_buffer);
+    return status;
+  }
+  IREE_RETURN_IF_ERROR(iree_remoting_session_bind(
+      session, request->command_buffer_id,
+      IREE_REMOTING_HANDLE_TYPE_COMMAND_BUFFER, command_buffer));
+  session->recording_command_buffer = command_buffer;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_remoting_session_command_buffer_end(
+    iree_remoting_session_t* session) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  session->recording_command_buffer = NULL;
+  return iree_hal_command_buffer_end(command_buffer);
+}
+
+static iree_status_t iree_remoting_session_cmd_execution_barrier(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_execution_barrier_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  return iree_hal_command_buffer_execution_barrier(
+      command_buffer, request->source_stage_mask, request->target_stage_mask,
+      request->flags, 0, NULL, 0, NULL);
+}
+
+// Handles CMD_SIGNAL_EVENT and CMD_RESET_EVENT.
+static iree_status_t iree_remoting_session_cmd_event(
+    iree_remoting_session_t* session, iree_remoting_message_type_t type,
+    iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_event_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_event_t* event = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_lookup(session, request->event_id,
+                                   IREE_REMOTING_HANDLE_TYPE_EVENT,
+                                   (void**)&event));
+  if (type == IREE_REMOTING_MESSAGE_CMD_SIGNAL_EVENT) {
+    return iree_hal_command_buffer_signal_event(command_buffer, event,
+                                                request->source_stage_mask);
+  }
+  return iree_hal_command_buffer_reset_event(command_buffer, event,
+                                             request->source_stage_mask);
+}
+
+static iree_status_t iree_remoting_session_cmd_wait_events(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_wait_events_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  void** events = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_read_resource_list(
+      session, reader, request->event_count, IREE_REMOTING_HANDLE_TYPE_EVENT,
+      &events));
+  iree_status_t status = iree_hal_command_buffer_wait_events(
+      command_buffer, request->event_count, (const iree_hal_event_t**)events,
+      request->source_stage_mask, request->target_stage_mask, 0, NULL, 0,
+      NULL);
+  iree_allocator_free(session->host_allocator, events);
+  return status;
+}
+
+static iree_status_t iree_remoting_session_cmd_discard_buffer(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_discard_buffer_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&buffer));
+  return iree_hal_command_buffer_discard_buffer(command_buffer, buffer);
+}
+
+static iree_status_t iree_remoting_session_cmd_fill_buffer(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_fill_buffer_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  if (request->pattern_length > sizeof(request->pattern)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "fill patterns are at most 8 bytes, got %u",
+                            request->pattern_length);
+  }
+  iree_hal_buffer_t* target_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->target_buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&target_buffer));
+  return iree_hal_command_buffer_fill_buffer(
+      command_buffer, target_buffer, request->target_offset, request->length,
+      &request->pattern, request->pattern_length);
+}
+
+static iree_status_t iree_remoting_session_cmd_update_buffer(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_update_buffer_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  const void* data = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(
+      reader, (iree_host_size_t)request->length, &data));
+  iree_hal_buffer_t* target_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->target_buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&target_buffer));
+  return iree_hal_command_buffer_update_buffer(command_buffer, data, 0,
+                                               target_buffer,
+                                               request->target_offset,
+                                               request->length);
+}
+
+static iree_status_t iree_remoting_session_cmd_copy_buffer(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_copy_buffer_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_buffer_t* source_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->source_buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&source_buffer));
+  iree_hal_buffer_t* target_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->target_buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&target_buffer));
+  return iree_hal_command_buffer_copy_buffer(
+      command_buffer, source_buffer, request->source_offset, target_buffer,
+      request->target_offset, request->length);
+}
+
+static iree_status_t iree_remoting_session_cmd_push_constants(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_push_constants_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  const void* values = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_reader_read(reader, request->values_length, &values));
+  iree_hal_executable_layout_t* executable_layout = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->executable_layout_id,
+      IREE_REMOTING_HANDLE_TYPE_EXECUTABLE_LAYOUT, (void**)&executable_layout));
+  return iree_hal_command_buffer_push_constants(
+      command_buffer, executable_layout, request->offset, values,
+      request->values_length);
+}
+
+static iree_status_t iree_remoting_session_cmd_push_descriptor_set(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_push_descriptor_set_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  const iree_remoting_descriptor_set_binding_t* bindings = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(
+      reader, request->binding_count * sizeof(*bindings),
+      (const void**)&bindings));
+  iree_hal_executable_layout_t* executable_layout = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->executable_layout_id,
+      IREE_REMOTING_HANDLE_TYPE_EXECUTABLE_LAYOUT, (void**)&executable_layout));
+
+  iree_hal_descriptor_set_binding_t* set_bindings = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      session->host_allocator,
+      request->binding_count * sizeof(*set_bindings) + 1,
+      (void**)&set_bindings));
+  memset(set_bindings, 0, request->binding_count * sizeof(*set_bindings));
+  iree_status_t status = iree_ok_status();
+  for (uint32_t i = 0; i < request->binding_count; ++i) {
+    set_bindings[i].binding = bindings[i].binding;
+    set_bindings[i].offset = bindings[i].offset;
+    set_bindings[i].length = bindings[i].length;
+    status = iree_remoting_session_lookup(session, bindings[i].buffer_id,
+                                          IREE_REMOTING_HANDLE_TYPE_BUFFER,
+                                          (void**)&set_bindings[i].buffer);
+    if (!iree_status_is_ok(status)) break;
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_command_buffer_push_descriptor_set(
+        command_buffer, executable_layout, request->set,
+        request->binding_count, set_bindings);
+  }
+  iree_allocator_free(session->host_allocator, set_bindings);
+  return status;
+}
+
+static iree_status_t iree_remoting_session_cmd_dispatch(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_dispatch_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_executable_t* executable = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->executable_id, IREE_REMOTING_HANDLE_TYPE_EXECUTABLE,
+      (void**)&executable));
+  return iree_hal_command_buffer_dispatch(
+      command_buffer, executable, request->entry_point, request->workgroup_x,
+      request->workgroup_y, request->workgroup_z);
+}
+
+static iree_status_t iree_remoting_session_cmd_dispatch_indirect(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_remoting_session_recording(session, &command_buffer));
+  const iree_remoting_cmd_dispatch_indirect_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_executable_t* executable = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->executable_id, IREE_REMOTING_HANDLE_TYPE_EXECUTABLE,
+      (void**)&executable));
+  iree_hal_buffer_t* workgroups_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_lookup(
+      session, request->workgroups_buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+      (void**)&workgroups_buffer));
+  return iree_hal_command_buffer_dispatch_indirect(
+      command_buffer, executable, request->entry_point, workgroups_buffer,
+      request->workgroups_offset);
+}
+
+//===----------------------------------------------------------------------===//
+// Queue operations
+//===----------------------------------------------------------------------===//
+
+static iree_status_t iree_remoting_session_queue_submit(
+    iree_remoting_session_t* session, iree_remoting_reader_t* reader) {
+  const iree_remoting_queue_submit_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_semaphore_list_t wait_semaphores;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_read_semaphore_list(
+      session, reader, request->wait_count, &wait_semaphores));
+  const iree_remoting_id_t* command_buffer_ids = NULL;
+  iree_host_size_t command_buffer_ids_length =
+      request->command_buffer_count * sizeof(*command_buffer_ids);
+  iree_status_t status = iree_remoting_reader_read(
+      reader, command_buffer_ids_length, (const void**)&command_buffer_ids);
+  if (iree_status_is_ok(status)) {
+    status = iree_remoting_reader_align(reader, command_buffer_ids_length, 8);
+  }
+  iree_hal_semaphore_list_t signal_semaphores;
+  memset(&signal_semaphores, 0, sizeof(signal_semaphores));
+  if (iree_status_is_ok(status)) {
+    status = iree_remoting_session_read_semaphore_list(
+        session, reader, request->signal_count, &signal_semaphores);
+  }
+
+  // The submission retains everything it needs until it retires.
+  iree_remoting_submission_t* submission = NULL;
+  if (iree_status_is_ok(status)) {
+    iree_host_size_t total_size =
+        sizeof(*submission) +
+        request->signal_count * sizeof(uint64_t) +
+        request->signal_count * sizeof(iree_hal_semaphore_t*) +
+        request->command_buffer_count * sizeof(iree_hal_command_buffer_t*);
+    status = iree_allocator_malloc(session->host_allocator, total_size,
+                                   (void**)&submission);
+  }
+  if (iree_status_is_ok(status)) {
+    memset(submission, 0, sizeof(*submission));
+    uint8_t* storage = (uint8_t*)(submission + 1);
+    submission->signal_semaphores.payload_values = (uint64_t*)storage;
+    storage += request->signal_count * sizeof(uint64_t);
+    submission->signal_semaphores.semaphores = (iree_hal_semaphore_t**)storage;
+    storage += request->signal_count * sizeof(iree_hal_semaphore_t*);
+    submission->command_buffers = (iree_hal_command_buffer_t**)storage;
+    submission->signal_semaphores.count = signal_semaphores.count;
+    for (iree_host_size_t i = 0; i < signal_semaphores.count; ++i) {
+      submission->signal_semaphores.semaphores[i] =
+          signal_semaphores.semaphores[i];
+      submission->signal_semaphores.payload_values[i] =
+          signal_semaphores.payload_values[i];
+      iree_hal_semaphore_retain(signal_semaphores.semaphores[i]);
+    }
+    for (uint32_t i = 0; i < request->command_buffer_count; ++i) {
+      iree_hal_command_buffer_t* command_buffer = NULL;
+      status = iree_remoting_session_lookup(
+          session, command_buffer_ids[i],
+          IREE_REMOTING_HANDLE_TYPE_COMMAND_BUFFER, (void**)&command_buffer);
+      if (!iree_status_is_ok(status)) break;
+      iree_hal_command_buffer_retain(command_buffer);
+      submission->command_buffers[submission->command_buffer_count++] =
+          command_buffer;
+      // The client reuses the ID as soon as the submission is sent.
+      status = iree_remoting_session_unbind(session, command_buffer_ids[i]);
+      if (!iree_status_is_ok(status)) break;
+    }
+  }
+
+  if (iree_status_is_ok(status)) {
+    iree_hal_submission_batch_t batch = {
+        .wait_semaphores = wait_semaphores,
+        .command_buffer_count = submission->command_buffer_count,
+        .command_buffers = submission->command_buffers,
+        .binding_tables = NULL,
+        .signal_semaphores = signal_semaphores,
+    };
+    status = iree_hal_device_queue_submit(
+        session->device,
+        (iree_hal_command_category_t)request->command_categories,
+        request->queue_affinity, 1, &batch);
+  }
+  if (iree_status_is_ok(status)) {
+    submission->next = session->submissions;
+    session->submissions = submission;
+  } else if (submission) {
+    iree_remoting_submission_free(session->host_allocator, submission);
+  }
+
+  iree_remoting_session_free_semaphore_list(session, &signal_semaphores);
+  iree_remoting_session_free_semaphore_list(session, &wait_semaphores);
+  return status;
+}
+
+// Handles QUEUE_ALLOCA and QUEUE_DEALLOCA.
+static iree_status_t iree_remoting_session_queue_alloca(
+    iree_remoting_session_t* session, iree_remoting_message_type_t type,
+    iree_remoting_reader_t* reader) {
+  const iree_remoting_queue_alloca_t* request = NULL;
+  IREE_RETURN_IF_ERROR(iree_remoting_reader_read(reader, sizeof(*request),
+                                                 (const void**)&request));
+  iree_hal_semaphore_list_t wait_semaphores;
+  IREE_RETURN_IF_ERROR(iree_remoting_session_read_semaphore_list(
+      session, reader, request->wait_count, &wait_semaphores));
+  iree_hal_semaphore_list_t signal_semaphores;
+  iree_status_t status = iree_remoting_session_read_semaphore_list(
+      session, reader, request->signal_count, &signal_semaphores);
+
+  if (iree_status_is_ok(status) &&
+      type == IREE_REMOTING_MESSAGE_QUEUE_ALLOCA) {
+    iree_hal_buffer_params_t params = {
+        .usage = request->usage,
+        .access = request->access,
+        .type = request->memory_type,
+        .queue_affinity = request->queue_affinity,
+        .min_alignment = request->min_alignment,
+    };
+    iree_hal_buffer_t* buffer = NULL;
+    status = iree_hal_device_queue_alloca(
+        session->device, request->queue_affinity, wait_semaphores,
+        signal_semaphores, params, request->allocation_size, &buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_remoting_session_bind(
+          session, request->buffer_id, IREE_REMOTING_HANDLE_TYPE_BUFFER,
+          buffer);
+    }
+  } else if (iree_status_is_ok(status)) {
+    iree_hal_buffer_t* buffer = NULL;
+    status = iree_remoting_session_lookup(session, request->buffer_id,
+                                          IREE_REMOTING_HANDLE_TYPE_BUFFER,
+                                          (void**)&buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_device_queue_dealloca(
+          session->device, request->queue_affinity, wait_semaphores,
+          signal_semaphores, buffer);
+    }
+  }
+
+  iree_remoting_session_free_semaphore_list(session, &signal_semaphores);
+  iree_remoting_session_free_semaphore_list(session, &wait_semaphores);
+  return status;
+}
+
+//===----------------------------------------------------------------------===//
+// Message loop
+//===----------------------------------------------------------------------===//
+
+// Executes the message of |type| in |payload|. Messages with a reply may set
+// |out_value| and |out_data| to return a result.
+static iree_status_t iree_remoting_session_dispatch(
+    iree_remoting_session_t* session, iree_remoting_message_type_t type,
+    iree_byte_span_t payload, int64_t* out_value,
+    iree_const_byte_span_t* out_data) {
+  iree_remoting_reader_t reader = {
+      .data = payload.data,
+      .remaining = payload.data_length,
+  };
+  switch (type) {
+    case IREE_REMOTING_MESSAGE_HELLO:
+      return iree_remoting_session_hello(session, &reader, out_value);
+    case IREE_REMOTING_MESSAGE_DEVICE_QUERY_I64:
+      return iree_remoting_session_device_query_i64(session, &reader,
+                                                    out_value);
+    case IREE_REMOTING_MESSAGE_DEVICE_TRIM:
+      return iree_hal_device_trim(session->device);
+    case IREE_REMOTING_MESSAGE_DEVICE_WAIT_IDLE:
+      return iree_remoting_session_device_wait_idle(session, &reader);
+    case IREE_REMOTING_MESSAGE_RESOURCE_RELEASE:
+      return iree_remoting_session_resource_release(session, &reader);
+    case IREE_REMOTING_MESSAGE_BUFFER_ALLOCATE:
+      return iree_remoting_session_buffer_allocate(session, &reader);
+    case IREE_REMOTING_MESSAGE_BUFFER_WRITE:
+      return iree_remoting_session_buffer_write(session, &reader);
+    case IREE_REMOTING_MESSAGE_BUFFER_READ:
+      return iree_remoting_session_buffer_read(session, &reader, out_data);
+    case IREE_REMOTING_MESSAGE_BUFFER_COPY:
+      return iree_remoting_session_buffer_copy(session, &reader);
+    case IREE_REMOTING_MESSAGE_DESCRIPTOR_SET_LAYOUT_CREATE:
+      return iree_remoting_session_descriptor_set_layout_create(session,
+                                                                &reader);
+    case IREE_REMOTING_MESSAGE_EXECUTABLE_LAYOUT_CREATE:
+      return iree_remoting_session_executable_layout_create(session, &reader);
+    case IREE_REMOTING_MESSAGE_EXECUTABLE_CAN_PREPARE_FORMAT:
+      return iree_remoting_session_executable_can_prepare_format(
+          session, &reader, out_value);
+    case IREE_REMOTING_MESSAGE_EXECUTABLE_CREATE:
+      return iree_remoting_session_executable_create(session, &reader);
+    case IREE_REMOTING_MESSAGE_EVENT_CREATE:
+      return iree_remoting_session_event_create(session, &reader);
+    case IREE_REMOTING_MESSAGE_SEMAPHORE_CREATE:
+      return iree_remoting_session_semaphore_create(session, &reader);
+    case IREE_REMOTING_MESSAGE_SEMAPHORE_QUERY:
+    case IREE_REMOTING_MESSAGE_SEMAPHORE_SIGNAL:
+      return iree_remoting_session_semaphore_value(session, type, &reader,
+                                                   out_value);
+    case IREE_REMOTING_MESSAGE_SEMAPHORE_FAIL:
+      return iree_remoting_session_semaphore_fail(session, &reader);
+    case IREE_REMOTING_MESSAGE_SEMAPHORE_WAIT:
+      return iree_remoting_session_semaphore_wait(session, &reader);
+    case IREE_REMOTING_MESSAGE_COMMAND_BUFFER_BEGIN:
+      return iree_remoting_session_command_buffer_begin(session, &reader);
+    case IREE_REMOTING_MESSAGE_COMMAND_BUFFER_END:
+      return iree_remoting_session_command_buffer_end(session);
+    case IREE_REMOTING_MESSAGE_CMD_EXECUTION_BARRIER:
+      return iree_remoting_session_cmd_execution_barrier(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_SIGNAL_EVENT:
+    case IREE_REMOTING_MESSAGE_CMD_RESET_EVENT:
+      return iree_remoting_session_cmd_event(session, type, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_WAIT_EVENTS:
+      return iree_remoting_session_cmd_wait_events(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_DISCARD_BUFFER:
+      return iree_remoting_session_cmd_discard_buffer(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_FILL_BUFFER:
+      return iree_remoting_session_cmd_fill_buffer(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_UPDATE_BUFFER:
+      return iree_remoting_session_cmd_update_buffer(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_COPY_BUFFER:
+      return iree_remoting_session_cmd_copy_buffer(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_PUSH_CONSTANTS:
+      return iree_remoting_session_cmd_push_constants(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_PUSH_DESCRIPTOR_SET:
+      return iree_remoting_session_cmd_push_descriptor_set(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_DISPATCH:
+      return iree_remoting_session_cmd_dispatch(session, &reader);
+    case IREE_REMOTING_MESSAGE_CMD_DISPATCH_INDIRECT:
+      return iree_remoting_session_cmd_dispatch_indirect(session, &reader);
+    case IREE_REMOTING_MESSAGE_QUEUE_SUBMIT:
+      return iree_remoting_session_queue_submit(session, &reader);
+    case IREE_REMOTING_MESSAGE_QUEUE_ALLOCA:
+    case IREE_REMOTING_MESSAGE_QUEUE_DEALLOCA:
+      return iree_remoting_session_queue_alloca(session, type, &reader);
+    default:
+      return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                              "unsupported message type %u", type);
+  }
+}
+
+static iree_status_t iree_remoting_session_run(
+    iree_remoting_session_t* session) {
+  while (true) {
+    iree_remoting_message_header_t header;
+    iree_status_t status =
+        iree_remoting_channel_recv_header(&session->channel, &header);
+    if (iree_status_is_unavailable(status)) {
+      // Disconnected between messages.
+      iree_status_ignore(status);
+      return iree_ok_status();
+    }
+    IREE_RETURN_IF_ERROR(status);
+    iree_byte_span_t payload = iree_byte_span_empty();
+    IREE_RETURN_IF_ERROR(iree_remoting_channel_recv_payload(
+        &session->channel, (iree_host_size_t)header.length, &payload));
+
+    // Once a message has failed the rest are dropped until the client hears
+    // about it.
+    int64_t value = 0;
+    iree_const_byte_span_t data = iree_const_byte_span_empty();
+    if (iree_status_is_ok(session->sticky_status)) {
+      IREE_TRACE_ZONE_BEGIN(z0);
+      IREE_TRACE_ZONE_APPEND_VALUE(z0, header.type);
+      status = iree_remoting_session_dispatch(session, header.type, payload,
+                                              &value, &data);
+      IREE_TRACE_ZONE_END(z0);
+    }
+    iree_remoting_session_retire_submissions(session);
+
+    if (!(header.flags & IREE_REMOTING_MESSAGE_FLAG_REPLY)) {
+      if (iree_status_is_ok(session->sticky_status)) {
+        session->sticky_status = status;
+      } else {
+        iree_status_ignore(status);
+      }
+      continue;
+    }
+    if (!iree_status_is_ok(session->sticky_status)) {
+      // The client can't tell which message failed so the session is over.
+      iree_status_ignore(status);
+      IREE_RETURN_IF_ERROR(iree_remoting_channel_reply(
+          &session->channel, iree_status_clone(session->sticky_status), 0,
+          iree_const_byte_span_empty()));
+      status = session->sticky_status;
+      session->sticky_status = iree_ok_status();
+      return status;
+    }
+    IREE_RETURN_IF_ERROR(
+        iree_remoting_channel_reply(&session->channel, status, value, data));
+  }
+}
+
+iree_status_t iree_remoting_server_serve(
+    iree_hal_device_t* device, iree_remoting_transport_t* transport,
+    const iree_remoting_server_options_t* options,
+    iree_allocator_t host_allocator) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(transport);
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_remoting_session_t session;
+  iree_status_t status = iree_remoting_session_initialize(
+      device, transport, options, host_allocator, &session);
+  if (iree_status_is_ok(status)) {
+    status = iree_remoting_session_run(&session);
+  }
+  iree_remoting_session_deinitialize(&session);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -0,0 +1,41 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_REMOTING_SERVER_SERVER_H_
+#define IREE_REMOTING_SERVER_SERVER_H_
+
+#include "experimental/remoting/protocol/transport.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+typedef struct iree_remoting_server_options_t {
+  // Capacity of the buffer replies are batched into.
+  iree_host_size_t batch_capacity;
+} iree_remoting_server_options_t;
+
+// Initializes |out_options| to the default values.
+void iree_remoting_server_options_initialize(
+    iree_remoting_server_options_t* out_options);
+
+// Executes the requests of the client connected over |transport| on |device|
+// until the client disconnects. Takes ownership of |transport|.
+//
+// All resources the client created are released before returning. Returns OK
+// when the client disconnects cleanly between messages.
+iree_status_t iree_remoting_server_serve(
+    iree_hal_device_t* device, iree_remoting_transport_t* transport,
+    const iree_remoting_server_options_t* options,
+    iree_allocator_t host_allocator);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_REMOTING_SERVER_SERVER_H_
@@ -16,6 +16,49 @@
 extern "C" {
 #endif  // __cplusplus
 
+//===----------------------------------------------------------------------===//
+// iree_hal_rocm_device_t
+//===----------------------------------------------------------------------===//
+
+// Defines how command buffers are recorded and executed.
+typedef enum iree_hal_rocm_command_buffer_mode_e {
+  // Command buffers are recorded into HIP graphs and launched with a single
+  // call on submission.
+  IREE_HAL_ROCM_COMMAND_BUFFER_MODE_GRAPH = 0,
+  // Command buffers are recorded on the host and replayed directly against a
+  // HIP stream on submission.
+  IREE_HAL_ROCM_COMMAND_BUFFER_MODE_DIRECT = 1,
+} iree_hal_rocm_command_buffer_mode_t;
+
+// Parameters configuring an iree_hal_rocm_device_t.
+// Must be initialized with iree_hal_rocm_device_params_initialize prior to use.
+typedef struct iree_hal_rocm_device_params_t {
+  // Number of queues exposed on the device.
+  // Each queue is backed by its own HIP stream and acts as a separate
+  // synchronization scope where all work executes concurrently unless
+  // prohibited by semaphores. Submissions select a queue by hashing their
+  // queue affinity.
+  iree_host_size_t queue_count;
+
+  // Total size of each block in the device shared block pool.
+  // Larger sizes will lower overhead and ensure the heap isn't hit for
+  // transient allocations while also increasing memory consumption.
+  iree_host_size_t arena_block_size;
+
+  // Specifies how command buffers are recorded and executed.
+  iree_hal_rocm_command_buffer_mode_t command_buffer_mode;
+
+  // Services queue-ordered allocations (iree_hal_device_queue_alloca and
+  // iree_hal_device_queue_dealloca) of device-local memory in stream order
+  // with hipMallocAsync and hipFreeAsync. Ignored if the runtime or device
+  // does not support stream-ordered allocation.
+  bool async_allocations;
+} iree_hal_rocm_device_params_t;
+
+// Initializes |out_params| to default values.
+void iree_hal_rocm_device_params_initialize(
+    iree_hal_rocm_device_params_t *out_params);
+
 //===----------------------------------------------------------------------===//
 // iree_hal_rocm_driver_t
 //===----------------------------------------------------------------------===//
@@ -35,6 +78,7 @@ IREE_API_EXPORT void iree_hal_rocm_driver_options_initialize(
 // |out_driver| must be released by the caller (see |iree_hal_driver_release|).
 IREE_API_EXPORT iree_status_t iree_hal_rocm_driver_create(
     iree_string_view_t identifier,
+    const iree_hal_rocm_device_params_t *default_params,
     const iree_hal_rocm_driver_options_t *options,
     iree_allocator_t host_allocator, iree_hal_driver_t **out_driver);
 
@@ -9,6 +9,7 @@
 #include <assert.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "experimental/rocm/dynamic_symbols.h"
 #include "experimental/rocm/executable_layout.h"
@@ -26,16 +27,17 @@ typedef struct {
   iree_hal_command_buffer_t base;
   iree_hal_rocm_context_wrapper_t* context;
   iree_arena_block_pool_t* block_pool;
+  hipStream_t stream;
 
   // Keep track of the current set of kernel arguments.
   int32_t push_constant[IREE_HAL_ROCM_MAX_PUSH_CONSTANT_COUNT];
-  void* current_descriptor[];
+  // Kernel arguments packed as expected by the kernels: bindings are written
+  // directly as they are pushed and push constants are appended on dispatch
+  // at the offset given by the kernel parameter layout of the entry point.
+  iree_alignas(iree_max_align_t) uint8_t
+      kernel_params[IREE_HAL_ROCM_MAX_KERNEL_PARAMS_SIZE];
 } iree_hal_rocm_direct_command_buffer_t;
 
-#define IREE_HAL_ROCM_MAX_BINDING_COUNT 64
-// Kernel arguments contains binding and push constants.
-#define IREE_HAL_ROCM_MAX_KERNEL_ARG 128
-
 static const iree_hal_command_buffer_vtable_t
     iree_hal_rocm_direct_command_buffer_vtable;
 
@@ -50,32 +52,25 @@ iree_status_t iree_hal_rocm_direct_command_buffer_create(
     iree_hal_device_t* device, iree_hal_rocm_context_wrapper_t* context,
     iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, hipStream_t stream,
     iree_arena_block_pool_t* block_pool,
     iree_hal_command_buffer_t** out_command_buffer) {
   IREE_ASSERT_ARGUMENT(context);
-  IREE_ASSERT_ARGUMENT(block_pool);
   IREE_ASSERT_ARGUMENT(out_command_buffer);
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_rocm_direct_command_buffer_t* command_buffer = NULL;
-  size_t total_size = sizeof(*command_buffer) +
-                      IREE_HAL_ROCM_MAX_KERNEL_ARG * sizeof(void*) +
-                      IREE_HAL_ROCM_MAX_KERNEL_ARG * sizeof(hipDeviceptr_t);
-  iree_status_t status = iree_allocator_malloc(
-      context->host_allocator, total_size, (void**)&command_buffer);
+  iree_status_t status =
+      iree_allocator_malloc(context->host_allocator, sizeof(*command_buffer),
+                            (void**)&command_buffer);
   if (iree_status_is_ok(status)) {
     iree_hal_command_buffer_initialize(
         device, mode, command_categories, queue_affinity,
-        &iree_hal_rocm_direct_command_buffer_vtable, &command_buffer->base);
+        /*binding_capacity=*/0, &iree_hal_rocm_direct_command_buffer_vtable,
+        &command_buffer->base);
     command_buffer->context = context;
     command_buffer->block_pool = block_pool;
-    hipDeviceptr_t* device_ptrs =
-        (hipDeviceptr_t*)(command_buffer->current_descriptor +
-                          IREE_HAL_ROCM_MAX_KERNEL_ARG);
-    for (size_t i = 0; i < IREE_HAL_ROCM_MAX_KERNEL_ARG; i++) {
-      command_buffer->current_descriptor[i] = &device_ptrs[i];
-    }
+    command_buffer->stream = stream;
 
     *out_command_buffer = &command_buffer->base;
   }
@@ -141,7 +136,7 @@ static iree_status_t iree_hal_rocm_direct_command_buffer_execution_barrier(
     const iree_hal_memory_barrier_t* memory_barriers,
     iree_host_size_t buffer_barrier_count,
     const iree_hal_buffer_barrier_t* buffer_barriers) {
-  // TODO: Implement barrier
+  // Nothing to do: all commands execute in stream order.
   return iree_ok_status();
 }
 
@@ -191,27 +186,28 @@ static iree_status_t iree_hal_rocm_direct_command_buffer_fill_buffer(
   target_offset += iree_hal_buffer_byte_offset(target_buffer);
   hipDeviceptr_t dst = target_device_buffer + target_offset;
   size_t num_elements = length / pattern_length;
-  // TODO(raikonenfnu): Currently using NULL stream, need to figure out way to
-  // access proper stream from command buffer
   switch (pattern_length) {
     case 4: {
       ROCM_RETURN_IF_ERROR(
           command_buffer->context->syms,
-          hipMemsetD32Async(dst, *(const uint32_t*)(pattern), num_elements, 0),
+          hipMemsetD32Async(dst, *(const uint32_t*)(pattern), num_elements,
+                            command_buffer->stream),
           "hipMemsetD32Async");
       break;
     }
     case 2: {
       ROCM_RETURN_IF_ERROR(
           command_buffer->context->syms,
-          hipMemsetD16Async(dst, *(const uint16_t*)(pattern), num_elements, 0),
+          hipMemsetD16Async(dst, *(const uint16_t*)(pattern), num_elements,
+                            command_buffer->stream),
           "hipMemsetD16Async");
       break;
     }
     case 1: {
       ROCM_RETURN_IF_ERROR(
           command_buffer->context->syms,
-          hipMemsetD8Async(dst, *(const uint8_t*)(pattern), num_elements, 0),
+          hipMemsetD8Async(dst, *(const uint8_t*)(pattern), num_elements,
+                           command_buffer->stream),
           "hipMemsetD*Async");
       break;
     }
@@ -226,8 +222,22 @@ static iree_status_t iree_hal_rocm_direct_command_buffer_update_buffer(
     iree_hal_command_buffer_t* base_command_buffer, const void* source_buffer,
     iree_host_size_t source_offset, iree_hal_buffer_t* target_buffer,
     iree_device_size_t target_offset, iree_device_size_t length) {
-  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                          "need rocm implementation");
+  iree_hal_rocm_direct_command_buffer_t* command_buffer =
+      iree_hal_rocm_direct_command_buffer_cast(base_command_buffer);
+
+  // The source buffer must remain live until the copy has executed: command
+  // buffers replayed from a deferred command buffer own the data until the
+  // submission completes.
+  hipDeviceptr_t target_device_buffer = iree_hal_rocm_buffer_device_pointer(
+      iree_hal_buffer_allocated_buffer(target_buffer));
+  target_offset += iree_hal_buffer_byte_offset(target_buffer);
+  hipDeviceptr_t dst = target_device_buffer + target_offset;
+  const uint8_t* src = (const uint8_t*)source_buffer + source_offset;
+  ROCM_RETURN_IF_ERROR(command_buffer->context->syms,
+                       hipMemcpyAsync(dst, src, length, hipMemcpyHostToDevice,
+                                      command_buffer->stream),
+                       "hipMemcpyAsync");
+  return iree_ok_status();
 }
 
 static iree_status_t iree_hal_rocm_direct_command_buffer_copy_buffer(
@@ -246,12 +256,10 @@ static iree_status_t iree_hal_rocm_direct_command_buffer_copy_buffer(
   source_offset += iree_hal_buffer_byte_offset(source_buffer);
   hipDeviceptr_t dst = target_device_buffer + target_offset;
   hipDeviceptr_t src = source_device_buffer + source_offset;
-  // TODO(raikonenfnu): Currently using NULL stream, need to figure out way to
-  // access proper stream from command buffer
-  ROCM_RETURN_IF_ERROR(
-      command_buffer->context->syms,
-      hipMemcpyAsync(dst, src, length, hipMemcpyDeviceToDevice, 0),
-      "hipMemcpyAsync");
+  ROCM_RETURN_IF_ERROR(command_buffer->context->syms,
+                       hipMemcpyAsync(dst, src, length, hipMemcpyDeviceToDevice,
+                                      command_buffer->stream),
+                       "hipMemcpyAsync");
   return iree_ok_status();
 }
 
@@ -307,14 +315,14 @@ static iree_status_t iree_hal_rocm_direct_command_buffer_push_descriptor_set(
         compare_binding_index);
   assert(binding_count < IREE_HAL_ROCM_MAX_BINDING_COUNT &&
          "binding count larger than the max expected.");
+  hipDeviceptr_t* binding_params =
+      (hipDeviceptr_t*)command_buffer->kernel_params + base_binding;
   for (iree_host_size_t i = 0; i < binding_count; i++) {
     iree_hal_descriptor_set_binding_t binding = bindings[binding_used[i].index];
-    hipDeviceptr_t device_ptr =
-        iree_hal_rocm_buffer_device_pointer(
-            iree_hal_buffer_allocated_buffer(binding.buffer)) +
-        iree_hal_buffer_byte_offset(binding.buffer) + binding.offset;
-    *((hipDeviceptr_t*)command_buffer->current_descriptor[i + base_binding]) =
-        device_ptr;
+    binding_params[i] = iree_hal_rocm_buffer_device_pointer(
+                            iree_hal_buffer_allocated_buffer(binding.buffer)) +
+                        iree_hal_buffer_byte_offset(binding.buffer) +
+                        binding.offset;
   }
   return iree_ok_status();
 }
@@ -335,31 +343,31 @@ static iree_status_t iree_hal_rocm_direct_command_buffer_dispatch(
     uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z) {
   iree_hal_rocm_direct_command_buffer_t* command_buffer =
       iree_hal_rocm_direct_command_buffer_cast(base_command_buffer);
-  iree_hal_rocm_direct_command_buffer_cast(base_command_buffer);
-  iree_hal_executable_layout_t* layout =
-      iree_hal_rocm_executable_get_layout(executable, entry_point);
-  iree_host_size_t num_constants =
-      iree_hal_rocm_executable_layout_num_constants(layout);
-  iree_host_size_t constant_base_index =
-      iree_hal_rocm_push_constant_index(layout);
-  // Patch the push constants in the kernel arguments.
-  for (iree_host_size_t i = 0; i < num_constants; i++) {
-    *((uint32_t*)command_buffer->current_descriptor[i + constant_base_index]) =
-        command_buffer->push_constant[i];
-  }
+  const iree_hal_rocm_kernel_params_layout_t* params_layout =
+      iree_hal_rocm_native_executable_kernel_params_layout(executable,
+                                                           entry_point);
+  // Append the push constants to the bindings already in the kernel arguments.
+  memcpy(command_buffer->kernel_params + params_layout->constant_offset,
+         command_buffer->push_constant,
+         params_layout->constant_count * sizeof(uint32_t));
+  size_t kernel_params_size = params_layout->total_size;
+  void* launch_config[] = {
+      HIP_LAUNCH_PARAM_BUFFER_POINTER, command_buffer->kernel_params,
+      HIP_LAUNCH_PARAM_BUFFER_SIZE,    &kernel_params_size,
+      HIP_LAUNCH_PARAM_END,
+  };
 
   int32_t block_size_x, block_size_y, block_size_z;
   IREE_RETURN_IF_ERROR(iree_hal_rocm_native_executable_block_size(
       executable, entry_point, &block_size_x, &block_size_y, &block_size_z));
   hipFunction_t func =
       iree_hal_rocm_native_executable_for_entry_point(executable, entry_point);
-  // TODO(raikonenfnu): Currently using NULL stream, need to figure out way to
-  // access proper stream from command buffer
   ROCM_RETURN_IF_ERROR(
       command_buffer->context->syms,
       hipModuleLaunchKernel(func, workgroup_x, workgroup_y, workgroup_z,
-                            block_size_x, block_size_y, block_size_z, 0, 0,
-                            command_buffer->current_descriptor, NULL),
+                            block_size_x, block_size_y, block_size_z, 0,
+                            command_buffer->stream, /*kernelParams=*/NULL,
+                            launch_config),
       "hipModuleLaunchKernel");
   return iree_ok_status();
 }
@@ -47,3 +47,25 @@ RC_PFN_DECL(hipStreamCreateWithFlags, hipStream_t *, unsigned int)
 RC_PFN_DECL(hipStreamDestroy, hipStream_t)
 RC_PFN_DECL(hipStreamSynchronize, hipStream_t)
 RC_PFN_DECL(hipStreamWaitEvent, hipStream_t, hipEvent_t, unsigned int)
+RC_PFN_DECL(hipLaunchHostFunc, hipStream_t, hipHostFn_t, void *)
+RC_PFN_DECL(hipEventCreateWithFlags, hipEvent_t *, unsigned int)
+RC_PFN_DECL(hipEventDestroy, hipEvent_t)
+RC_PFN_DECL(hipEventRecord, hipEvent_t, hipStream_t)
+RC_PFN_DECL(hipGraphCreate, hipGraph_t *, unsigned int)
+RC_PFN_DECL(hipGraphDestroy, hipGraph_t)
+RC_PFN_DECL(hipGraphAddEmptyNode, hipGraphNode_t *, hipGraph_t,
+            const hipGraphNode_t *, size_t)
+RC_PFN_DECL(hipGraphAddKernelNode, hipGraphNode_t *, hipGraph_t,
+            const hipGraphNode_t *, size_t, const hipKernelNodeParams *)
+RC_PFN_DECL(hipGraphAddMemsetNode, hipGraphNode_t *, hipGraph_t,
+            const hipGraphNode_t *, size_t, const hipMemsetParams *)
+RC_PFN_DECL(hipGraphAddMemcpyNode1D, hipGraphNode_t *, hipGraph_t,
+            const hipGraphNode_t *, size_t, void *, const void *, size_t,
+            hipMemcpyKind)
+RC_PFN_DECL(hipGraphInstantiate, hipGraphExec_t *, hipGraph_t,
+            hipGraphNode_t *, char *, size_t)
+RC_PFN_DECL(hipGraphLaunch, hipGraphExec_t, hipStream_t)
+RC_PFN_DECL(hipGraphExecDestroy, hipGraphExec_t)
+// Stream-ordered allocation is only available in newer HIP runtimes.
+RC_PFN_DECL_OPTIONAL(hipMallocAsync, void **, size_t, hipStream_t)
+RC_PFN_DECL_OPTIONAL(hipFreeAsync, void *, hipStream_t)
@@ -28,9 +28,16 @@ static iree_status_t iree_hal_rocm_dynamic_symbols_resolve_all(
     IREE_RETURN_IF_ERROR(iree_dynamic_library_lookup_symbol(          \
         syms->loader_library, kName, (void**)&syms->rocmSymbolName)); \
   }
+#define RC_PFN_DECL_OPTIONAL(rocmSymbolName, ...)                     \
+  {                                                                   \
+    static const char* kName = #rocmSymbolName;                       \
+    iree_status_ignore(iree_dynamic_library_lookup_symbol(            \
+        syms->loader_library, kName, (void**)&syms->rocmSymbolName)); \
+  }
 #define RC_PFN_STR_DECL(rocmSymbolName, ...) RC_PFN_DECL(rocmSymbolName, ...)
 #include "experimental/rocm/dynamic_symbol_tables.h"  // IWYU pragma: keep
 #undef RC_PFN_DECL
+#undef RC_PFN_DECL_OPTIONAL
 #undef RC_PFN_STR_DECL
   return iree_ok_status();
 }
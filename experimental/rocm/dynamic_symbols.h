@@ -18,16 +18,21 @@ extern "C" {
 // DynamicSymbols allow loading dynamically a subset of ROCM driver API. It
 // loads all the function declared in `dynamic_symbol_tables.def` and fail if
 // any of the symbol is not available. The functions signatures are matching
-// the declarations in `hipruntime.h`.
+// the declarations in `hipruntime.h`. Symbols declared with
+// RC_PFN_DECL_OPTIONAL are NULL when not available in the loaded runtime and
+// must be checked before use.
 typedef struct iree_hal_rocm_dynamic_symbols_t {
   iree_dynamic_library_t* loader_library;
 
 #define RC_PFN_DECL(rocmSymbolName, ...) \
   hipError_t (*rocmSymbolName)(__VA_ARGS__);
+#define RC_PFN_DECL_OPTIONAL(rocmSymbolName, ...) \
+  hipError_t (*rocmSymbolName)(__VA_ARGS__);
 #define RC_PFN_STR_DECL(rocmSymbolName, ...) \
   const char* (*rocmSymbolName)(__VA_ARGS__);
 #include "experimental/rocm/dynamic_symbol_tables.h"  // IWYU pragma: export
 #undef RC_PFN_DECL
+#undef RC_PFN_DECL_OPTIONAL
 #undef RC_PFN_STR_DECL
 } iree_hal_rocm_dynamic_symbols_t;
 
@@ -6,15 +6,66 @@
 
 #include "experimental/rocm/event_semaphore.h"
 
+#include <inttypes.h>
+#include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "iree/base/api.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/utils/semaphore_base.h"
 
+// Sentinel used the semaphore has failed and an error status is set.
+#define IREE_HAL_ROCM_SEMAPHORE_FAILURE_VALUE UINT64_MAX
+
+//===----------------------------------------------------------------------===//
+// iree_hal_rocm_semaphore_state_t
+//===----------------------------------------------------------------------===//
+
+void iree_hal_rocm_semaphore_state_initialize(
+    iree_hal_rocm_semaphore_state_t* out_shared_state) {
+  memset(out_shared_state, 0, sizeof(*out_shared_state));
+  iree_notification_initialize(&out_shared_state->notification);
+}
+
+void iree_hal_rocm_semaphore_state_deinitialize(
+    iree_hal_rocm_semaphore_state_t* shared_state) {
+  iree_notification_deinitialize(&shared_state->notification);
+  memset(shared_state, 0, sizeof(*shared_state));
+}
+
+//===----------------------------------------------------------------------===//
+// iree_hal_rocm_semaphore_t
+//===----------------------------------------------------------------------===//
+
 typedef struct iree_hal_rocm_semaphore_t {
   iree_hal_semaphore_t base;
   iree_hal_rocm_context_wrapper_t* context;
+
+  // Shared across all semaphores created from the same device.
+  iree_hal_rocm_semaphore_state_t* shared_state;
+
+  // Guards all mutable fields. Signals arrive from HIP host functions and
+  // contention is expected to be low.
+  iree_slim_mutex_t mutex;
+
+  // Current signaled value. May be IREE_HAL_ROCM_SEMAPHORE_FAILURE_VALUE to
+  // indicate that the semaphore has been signaled for failure and
+  // |failure_status| contains the error.
+  uint64_t current_value;
+
+  // OK or the status passed to iree_hal_semaphore_fail. Owned by the semaphore.
+  iree_status_t failure_status;
+
+  // Stream that the most recent device signal was enqueued on and the value it
+  // will signal. Waits on the same stream for this value or earlier are
+  // satisfied by stream order.
+  hipStream_t pending_stream;
+  uint64_t pending_value;
+
+  // Event recorded on |pending_stream| after the pending signal. Waits from
+  // other streams wait on the event instead of the host. Created on first use.
+  hipEvent_t pending_event;
 } iree_hal_rocm_semaphore_t;
 
 static const iree_hal_semaphore_vtable_t iree_hal_rocm_semaphore_vtable;
@@ -26,10 +77,13 @@ static iree_hal_rocm_semaphore_t* iree_hal_rocm_semaphore_cast(
 }
 
 iree_status_t iree_hal_rocm_semaphore_create(
-    iree_hal_rocm_context_wrapper_t* context, uint64_t initial_value,
+    iree_hal_rocm_context_wrapper_t* context,
+    iree_hal_rocm_semaphore_state_t* shared_state, uint64_t initial_value,
     iree_hal_semaphore_t** out_semaphore) {
   IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(shared_state);
   IREE_ASSERT_ARGUMENT(out_semaphore);
+  *out_semaphore = NULL;
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_rocm_semaphore_t* semaphore = NULL;
@@ -39,6 +93,15 @@ iree_status_t iree_hal_rocm_semaphore_create(
     iree_hal_semaphore_initialize(&iree_hal_rocm_semaphore_vtable,
                                   &semaphore->base);
     semaphore->context = context;
+    semaphore->shared_state = shared_state;
+
+    iree_slim_mutex_initialize(&semaphore->mutex);
+    semaphore->current_value = initial_value;
+    semaphore->failure_status = iree_ok_status();
+    semaphore->pending_stream = NULL;
+    semaphore->pending_value = initial_value;
+    semaphore->pending_event = NULL;
+
     *out_semaphore = &semaphore->base;
   }
 
@@ -46,6 +109,10 @@ iree_status_t iree_hal_rocm_semaphore_create(
   return status;
 }
 
+bool iree_hal_rocm_semaphore_isa(iree_hal_semaphore_t* semaphore) {
+  return iree_hal_resource_is(semaphore, &iree_hal_rocm_semaphore_vtable);
+}
+
 static void iree_hal_rocm_semaphore_destroy(
     iree_hal_semaphore_t* base_semaphore) {
   iree_hal_rocm_semaphore_t* semaphore =
@@ -53,6 +120,13 @@ static void iree_hal_rocm_semaphore_destroy(
   iree_allocator_t host_allocator = semaphore->context->host_allocator;
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  if (semaphore->pending_event) {
+    ROCM_IGNORE_ERROR(semaphore->context->syms,
+                      hipEventDestroy(semaphore->pending_event));
+  }
+  iree_slim_mutex_deinitialize(&semaphore->mutex);
+  iree_status_ignore(semaphore->failure_status);
+
   iree_hal_semaphore_deinitialize(&semaphore->base);
   iree_allocator_free(host_allocator, semaphore);
 
@@ -61,18 +135,60 @@ static void iree_hal_rocm_semaphore_destroy(
 
 static iree_status_t iree_hal_rocm_semaphore_query(
     iree_hal_semaphore_t* base_semaphore, uint64_t* out_value) {
-  // TODO: Support semaphores completely.
-  *out_value = 0;
-  return iree_make_status(IREE_STATUS_UNIMPLEMENTED, "Not impemented on rocm");
+  iree_hal_rocm_semaphore_t* semaphore =
+      iree_hal_rocm_semaphore_cast(base_semaphore);
+
+  iree_slim_mutex_lock(&semaphore->mutex);
+
+  *out_value = semaphore->current_value;
+
+  iree_status_t status = iree_ok_status();
+  if (*out_value >= IREE_HAL_ROCM_SEMAPHORE_FAILURE_VALUE) {
+    status = iree_status_clone(semaphore->failure_status);
+  }
+
+  iree_slim_mutex_unlock(&semaphore->mutex);
+
+  return status;
+}
+
+// Signals |semaphore| to |new_value| or returns an error if doing so would be
+// invalid. The semaphore mutex must be held.
+static iree_status_t iree_hal_rocm_semaphore_signal_unsafe(
+    iree_hal_rocm_semaphore_t* semaphore, uint64_t new_value) {
+  if (new_value <= semaphore->current_value) {
+    uint64_t current_value IREE_ATTRIBUTE_UNUSED = semaphore->current_value;
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "semaphore values must be monotonically "
+                            "increasing; current_value=%" PRIu64
+                            ", new_value=%" PRIu64,
+                            current_value, new_value);
+  }
+
+  // Update to the new value.
+  semaphore->current_value = new_value;
+
+  return iree_ok_status();
 }
 
 static iree_status_t iree_hal_rocm_semaphore_signal(
     iree_hal_semaphore_t* base_semaphore, uint64_t new_value) {
   iree_hal_rocm_semaphore_t* semaphore =
       iree_hal_rocm_semaphore_cast(base_semaphore);
-  // TODO: Support semaphores completely. Return OK currently as everything is
-  // synchronized for each submit to allow things to run.
-  iree_hal_semaphore_poll(&semaphore->base);
+
+  iree_slim_mutex_lock(&semaphore->mutex);
+  iree_status_t status =
+      iree_hal_rocm_semaphore_signal_unsafe(semaphore, new_value);
+  iree_slim_mutex_unlock(&semaphore->mutex);
+  IREE_RETURN_IF_ERROR(status);
+
+  // Notify timepoints of the new value.
+  iree_hal_semaphore_notify(&semaphore->base, new_value, IREE_STATUS_OK);
+
+  // Post a shared notification so that any waiter will wake.
+  iree_notification_post(&semaphore->shared_state->notification,
+                         IREE_ALL_WAITERS);
+
   return iree_ok_status();
 }
 
@@ -80,9 +196,159 @@ static void iree_hal_rocm_semaphore_fail(iree_hal_semaphore_t* base_semaphore,
                                          iree_status_t status) {
   iree_hal_rocm_semaphore_t* semaphore =
       iree_hal_rocm_semaphore_cast(base_semaphore);
-  // TODO: save status and mark timepoint as failed.
-  iree_status_ignore(status);
-  iree_hal_semaphore_poll(&semaphore->base);
+  const iree_status_code_t status_code = iree_status_code(status);
+
+  iree_slim_mutex_lock(&semaphore->mutex);
+
+  // Try to set our local status - we only preserve the first failure so only
+  // do this if we are going from a valid semaphore to a failed one.
+  if (!iree_status_is_ok(semaphore->failure_status)) {
+    // Previous status was not OK; drop our new status.
+    IREE_IGNORE_ERROR(status);
+    iree_slim_mutex_unlock(&semaphore->mutex);
+    return;
+  }
+
+  // Signal to our failure sentinel value.
+  semaphore->current_value = IREE_HAL_ROCM_SEMAPHORE_FAILURE_VALUE;
+  semaphore->failure_status = status;
+
+  iree_slim_mutex_unlock(&semaphore->mutex);
+
+  // Notify timepoints of the failure.
+  iree_hal_semaphore_notify(&semaphore->base,
+                            IREE_HAL_ROCM_SEMAPHORE_FAILURE_VALUE, status_code);
+
+  iree_notification_post(&semaphore->shared_state->notification,
+                         IREE_ALL_WAITERS);
+}
+
+iree_status_t iree_hal_rocm_semaphore_enqueue_signal(
+    iree_hal_semaphore_t* base_semaphore, hipStream_t stream, uint64_t value) {
+  iree_hal_rocm_semaphore_t* semaphore =
+      iree_hal_rocm_semaphore_cast(base_semaphore);
+  iree_status_t status = iree_ok_status();
+  iree_slim_mutex_lock(&semaphore->mutex);
+  if (value > semaphore->pending_value) {
+    if (!semaphore->pending_event) {
+      status = ROCM_RESULT_TO_STATUS(
+          semaphore->context->syms,
+          hipEventCreateWithFlags(&semaphore->pending_event,
+                                  hipEventDisableTiming),
+          "hipEventCreateWithFlags");
+    }
+    // Re-recording the event is safe: waits enqueued earlier have already
+    // captured the prior record and later waits are satisfied by the newer
+    // (and higher valued) signal.
+    if (iree_status_is_ok(status)) {
+      status = ROCM_RESULT_TO_STATUS(
+          semaphore->context->syms,
+          hipEventRecord(semaphore->pending_event, stream), "hipEventRecord");
+    }
+    if (iree_status_is_ok(status)) {
+      semaphore->pending_stream = stream;
+      semaphore->pending_value = value;
+    }
+  }
+  iree_slim_mutex_unlock(&semaphore->mutex);
+  return status;
+}
+
+iree_status_t iree_hal_rocm_semaphore_enqueue_wait(
+    iree_hal_semaphore_t* base_semaphore, hipStream_t stream, uint64_t value,
+    bool* out_is_ordered) {
+  iree_hal_rocm_semaphore_t* semaphore =
+      iree_hal_rocm_semaphore_cast(base_semaphore);
+  *out_is_ordered = false;
+  iree_status_t status = iree_ok_status();
+  iree_slim_mutex_lock(&semaphore->mutex);
+  if (!iree_status_is_ok(semaphore->failure_status)) {
+    // Failed semaphores must be waited on by the host to surface the failure.
+  } else if (semaphore->current_value >= value) {
+    // Already reached; nothing to order against.
+    *out_is_ordered = true;
+  } else if (semaphore->pending_value >= value) {
+    if (semaphore->pending_stream == stream) {
+      // The signal has been enqueued ahead of any work enqueued now.
+      *out_is_ordered = true;
+    } else {
+      // The signal is enqueued on another stream; wait for it on the device.
+      status = ROCM_RESULT_TO_STATUS(
+          semaphore->context->syms,
+          hipStreamWaitEvent(stream, semaphore->pending_event, 0),
+          "hipStreamWaitEvent");
+      *out_is_ordered = iree_status_is_ok(status);
+    }
+  }
+  iree_slim_mutex_unlock(&semaphore->mutex);
+  return status;
+}
+
+iree_status_t iree_hal_rocm_semaphore_multi_signal(
+    iree_hal_rocm_semaphore_state_t* shared_state,
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  IREE_ASSERT_ARGUMENT(shared_state);
+  IREE_ASSERT_ARGUMENT(semaphore_list);
+  if (semaphore_list->count == 0) {
+    return iree_ok_status();
+  } else if (semaphore_list->count == 1) {
+    // Fast-path for a single semaphore.
+    return iree_hal_semaphore_signal(semaphore_list->semaphores[0],
+                                     semaphore_list->payload_values[0]);
+  }
+
+  // Try to signal all semaphores, stopping if we encounter any issues.
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    iree_hal_semaphore_t* base_semaphore = semaphore_list->semaphores[i];
+    const uint64_t new_value = semaphore_list->payload_values[i];
+    if (!iree_hal_rocm_semaphore_isa(base_semaphore)) {
+      // Semaphores from other devices are signaled through their own path.
+      status = iree_hal_semaphore_signal(base_semaphore, new_value);
+      if (!iree_status_is_ok(status)) break;
+      continue;
+    }
+
+    iree_hal_rocm_semaphore_t* semaphore =
+        iree_hal_rocm_semaphore_cast(base_semaphore);
+    iree_slim_mutex_lock(&semaphore->mutex);
+    status = iree_hal_rocm_semaphore_signal_unsafe(semaphore, new_value);
+    iree_slim_mutex_unlock(&semaphore->mutex);
+    if (!iree_status_is_ok(status)) break;
+
+    // Notify timepoints that the new value has been reached.
+    iree_hal_semaphore_notify(base_semaphore, new_value, IREE_STATUS_OK);
+  }
+
+  // Notify all waiters that we've updated semaphores. They'll wake and check
+  // to see if they are satisfied.
+  // NOTE: we do this even if there was a failure as we may have signaled some
+  // of the list.
+  iree_notification_post(&shared_state->notification, IREE_ALL_WAITERS);
+
+  return status;
+}
+
+// Returns true if the semaphore has reached |value| or has failed.
+// The semaphore mutex must not be held.
+static bool iree_hal_rocm_semaphore_is_signaled(
+    iree_hal_rocm_semaphore_t* semaphore, uint64_t value) {
+  iree_slim_mutex_lock(&semaphore->mutex);
+  bool is_signaled = semaphore->current_value >= value ||
+                     !iree_status_is_ok(semaphore->failure_status);
+  iree_slim_mutex_unlock(&semaphore->mutex);
+  return is_signaled;
+}
+
+typedef struct iree_hal_rocm_semaphore_notify_state_t {
+  iree_hal_rocm_semaphore_t* semaphore;
+  uint64_t value;
+} iree_hal_rocm_semaphore_notify_state_t;
+
+// Used with with iree_condition_fn_t and must match that signature.
+static bool iree_hal_rocm_semaphore_notify_state_is_signaled(
+    iree_hal_rocm_semaphore_notify_state_t* state) {
+  return iree_hal_rocm_semaphore_is_signaled(state->semaphore, state->value);
 }
 
 static iree_status_t iree_hal_rocm_semaphore_wait(
@@ -90,10 +356,151 @@ static iree_status_t iree_hal_rocm_semaphore_wait(
     iree_timeout_t timeout) {
   iree_hal_rocm_semaphore_t* semaphore =
       iree_hal_rocm_semaphore_cast(base_semaphore);
-  // TODO: Support semaphores completely. Return OK currently as everything is
-  // synchronized for each submit to allow things to run.
-  iree_hal_semaphore_poll(&semaphore->base);
-  return iree_ok_status();
+
+  // Try to see if we can return immediately.
+  iree_slim_mutex_lock(&semaphore->mutex);
+  if (!iree_status_is_ok(semaphore->failure_status)) {
+    // Fastest path: failed; return an error to tell callers to query for it.
+    iree_slim_mutex_unlock(&semaphore->mutex);
+    return iree_status_from_code(IREE_STATUS_ABORTED);
+  } else if (semaphore->current_value >= value) {
+    // Fast path: already satisfied.
+    iree_slim_mutex_unlock(&semaphore->mutex);
+    return iree_ok_status();
+  } else if (iree_timeout_is_immediate(timeout)) {
+    // Not satisfied but a poll, so can avoid the expensive wait.
+    iree_slim_mutex_unlock(&semaphore->mutex);
+    return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+  }
+  iree_slim_mutex_unlock(&semaphore->mutex);
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Wait on the shared notification until signaled, failed, or timed out.
+  iree_hal_rocm_semaphore_notify_state_t notify_state = {
+      .semaphore = semaphore,
+      .value = value,
+  };
+  iree_notification_await(
+      &semaphore->shared_state->notification,
+      (iree_condition_fn_t)iree_hal_rocm_semaphore_notify_state_is_signaled,
+      (void*)&notify_state, timeout);
+
+  iree_status_t status = iree_ok_status();
+  iree_slim_mutex_lock(&semaphore->mutex);
+  if (!iree_status_is_ok(semaphore->failure_status)) {
+    // Semaphore has failed.
+    status = iree_status_from_code(IREE_STATUS_ABORTED);
+  } else if (semaphore->current_value < value) {
+    // Deadline expired before the semaphore was signaled.
+    status = iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+  }
+  iree_slim_mutex_unlock(&semaphore->mutex);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Returns true if any semaphore in the list has signaled (or failed).
+// Used with with iree_condition_fn_t and must match that signature.
+static bool iree_hal_rocm_semaphore_any_signaled(
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    if (iree_hal_rocm_semaphore_is_signaled(
+            iree_hal_rocm_semaphore_cast(semaphore_list->semaphores[i]),
+            semaphore_list->payload_values[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns true if all semaphores in the list has signaled (or any failed).
+// Used with with iree_condition_fn_t and must match that signature.
+static bool iree_hal_rocm_semaphore_all_signaled(
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    if (!iree_hal_rocm_semaphore_is_signaled(
+            iree_hal_rocm_semaphore_cast(semaphore_list->semaphores[i]),
+            semaphore_list->payload_values[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns a status derived from the |semaphore_list| at the current time:
+// - IREE_STATUS_OK: any or all semaphores signaled (based on |wait_mode|).
+// - IREE_STATUS_ABORTED: one or more semaphores failed.
+// - IREE_STATUS_DEADLINE_EXCEEDED: any or all semaphores unsignaled.
+static iree_status_t iree_hal_rocm_semaphore_result_from_state(
+    iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  bool any_signaled = false;
+  bool all_signaled = true;
+  bool any_failed = false;
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    iree_hal_rocm_semaphore_t* semaphore =
+        iree_hal_rocm_semaphore_cast(semaphore_list->semaphores[i]);
+    iree_slim_mutex_lock(&semaphore->mutex);
+    if (!iree_status_is_ok(semaphore->failure_status)) {
+      any_failed = true;
+    } else if (semaphore->current_value < semaphore_list->payload_values[i]) {
+      all_signaled = false;
+    } else {
+      any_signaled = true;
+    }
+    iree_slim_mutex_unlock(&semaphore->mutex);
+  }
+  if (any_failed) {
+    // Always prioritize failure state.
+    return iree_status_from_code(IREE_STATUS_ABORTED);
+  }
+  switch (wait_mode) {
+    default:
+    case IREE_HAL_WAIT_MODE_ALL:
+      return all_signaled
+                 ? iree_ok_status()
+                 : iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+    case IREE_HAL_WAIT_MODE_ANY:
+      return any_signaled
+                 ? iree_ok_status()
+                 : iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+  }
+}
+
+iree_status_t iree_hal_rocm_semaphore_multi_wait(
+    iree_hal_rocm_semaphore_state_t* shared_state,
+    iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
+  IREE_ASSERT_ARGUMENT(shared_state);
+  IREE_ASSERT_ARGUMENT(semaphore_list);
+  if (semaphore_list->count == 0) {
+    return iree_ok_status();
+  } else if (semaphore_list->count == 1) {
+    // Fast-path for a single semaphore.
+    return iree_hal_semaphore_wait(semaphore_list->semaphores[0],
+                                   semaphore_list->payload_values[0], timeout);
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Poll-only waits never block and can just do a quick query.
+  if (!iree_timeout_is_immediate(timeout)) {
+    iree_notification_await(
+        &shared_state->notification,
+        wait_mode == IREE_HAL_WAIT_MODE_ALL
+            ? (iree_condition_fn_t)iree_hal_rocm_semaphore_all_signaled
+            : (iree_condition_fn_t)iree_hal_rocm_semaphore_any_signaled,
+        (void*)semaphore_list, timeout);
+  }
+
+  // We may have been successful - or may have a partial failure.
+  iree_status_t status =
+      iree_hal_rocm_semaphore_result_from_state(wait_mode, semaphore_list);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
 }
 
 static const iree_hal_semaphore_vtable_t iree_hal_rocm_semaphore_vtable = {
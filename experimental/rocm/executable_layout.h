@@ -15,6 +15,7 @@
 extern "C" {
 #endif  // __cplusplus
 
+#define IREE_HAL_ROCM_MAX_BINDING_COUNT 64
 #define IREE_HAL_ROCM_MAX_PUSH_CONSTANT_COUNT 64
 
 // Creates the kernel arguments.
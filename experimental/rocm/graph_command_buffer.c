@@ -0,0 +1,637 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/rocm/graph_command_buffer.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "experimental/rocm/dynamic_symbols.h"
+#include "experimental/rocm/executable_layout.h"
+#include "experimental/rocm/native_executable.h"
+#include "experimental/rocm/rocm_buffer.h"
+#include "experimental/rocm/status_util.h"
+#include "iree/base/api.h"
+#include "iree/base/internal/arena.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/utils/resource_set.h"
+
+// Maximum number of nodes tracked in a single concurrency region before they
+// are joined into an empty node. Joining does not change execution order but
+// bounds the storage required and the edge count of the following barrier.
+#define IREE_HAL_ROCM_MAX_CONCURRENT_GRAPH_NODE_COUNT 32
+
+// Command buffer implementation that directly maps to a HIP graph.
+// This records the commands on the calling thread without additional threading
+// indirection.
+typedef struct iree_hal_rocm_graph_command_buffer_t {
+  iree_hal_command_buffer_t base;
+  iree_hal_rocm_context_wrapper_t* context;
+
+  // Maintains a reference to all resources used within the command buffer.
+  iree_hal_resource_set_t* resource_set;
+
+  // Arena used for data referenced by graph nodes such as host->device
+  // transfers. Released with the command buffer.
+  iree_arena_allocator_t arena;
+
+  hipGraph_t graph;
+  hipGraphExec_t exec;
+
+  // Node all nodes in the current concurrency region depend on: the last node
+  // of the region preceding the most recent execution barrier or NULL if no
+  // barrier with prior work has been recorded.
+  hipGraphNode_t barrier_node;
+  // Nodes added since the most recent execution barrier. These have no edges
+  // between each other and may execute concurrently.
+  iree_host_size_t region_node_count;
+  hipGraphNode_t region_nodes[IREE_HAL_ROCM_MAX_CONCURRENT_GRAPH_NODE_COUNT];
+
+  int32_t push_constant[IREE_HAL_ROCM_MAX_PUSH_CONSTANT_COUNT];
+  // Kernel arguments packed as expected by the kernels: bindings are written
+  // directly as they are pushed and push constants are appended on dispatch
+  // at the offset given by the kernel parameter layout of the entry point.
+  iree_alignas(iree_max_align_t) uint8_t
+      kernel_params[IREE_HAL_ROCM_MAX_KERNEL_PARAMS_SIZE];
+} iree_hal_rocm_graph_command_buffer_t;
+
+static const iree_hal_command_buffer_vtable_t
+    iree_hal_rocm_graph_command_buffer_vtable;
+
+static iree_hal_rocm_graph_command_buffer_t*
+iree_hal_rocm_graph_command_buffer_cast(iree_hal_command_buffer_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_rocm_graph_command_buffer_vtable);
+  return (iree_hal_rocm_graph_command_buffer_t*)base_value;
+}
+
+iree_status_t iree_hal_rocm_graph_command_buffer_create(
+    iree_hal_device_t* device, iree_hal_rocm_context_wrapper_t* context,
+    iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity,
+    iree_arena_block_pool_t* block_pool,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(block_pool);
+  IREE_ASSERT_ARGUMENT(out_command_buffer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_rocm_graph_command_buffer_t* command_buffer = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(context->host_allocator, sizeof(*command_buffer),
+                            (void**)&command_buffer);
+  if (iree_status_is_ok(status)) {
+    iree_hal_command_buffer_initialize(
+        device, mode, command_categories, queue_affinity,
+        /*binding_capacity=*/0, &iree_hal_rocm_graph_command_buffer_vtable,
+        &command_buffer->base);
+    command_buffer->context = context;
+    iree_arena_initialize(block_pool, &command_buffer->arena);
+    command_buffer->graph = NULL;
+    command_buffer->exec = NULL;
+    command_buffer->barrier_node = NULL;
+    command_buffer->region_node_count = 0;
+
+    status = iree_hal_resource_set_allocate(block_pool,
+                                            &command_buffer->resource_set);
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_command_buffer = &command_buffer->base;
+  } else if (command_buffer) {
+    iree_hal_command_buffer_release(&command_buffer->base);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_rocm_graph_command_buffer_destroy(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  if (command_buffer->graph != NULL) {
+    ROCM_IGNORE_ERROR(command_buffer->context->syms,
+                      hipGraphDestroy(command_buffer->graph));
+    command_buffer->graph = NULL;
+  }
+  if (command_buffer->exec != NULL) {
+    ROCM_IGNORE_ERROR(command_buffer->context->syms,
+                      hipGraphExecDestroy(command_buffer->exec));
+    command_buffer->exec = NULL;
+  }
+  command_buffer->barrier_node = NULL;
+  command_buffer->region_node_count = 0;
+
+  iree_hal_resource_set_free(command_buffer->resource_set);
+  iree_arena_deinitialize(&command_buffer->arena);
+  iree_allocator_free(command_buffer->context->host_allocator, command_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+bool iree_hal_rocm_graph_command_buffer_isa(
+    iree_hal_command_buffer_t* command_buffer) {
+  return iree_hal_command_buffer_dyn_cast(
+      command_buffer, &iree_hal_rocm_graph_command_buffer_vtable);
+}
+
+static void* iree_hal_rocm_graph_command_buffer_dyn_cast(
+    iree_hal_command_buffer_t* command_buffer, const void* vtable) {
+  if (vtable == &iree_hal_rocm_graph_command_buffer_vtable) {
+    IREE_HAL_ASSERT_TYPE(command_buffer, vtable);
+    return command_buffer;
+  }
+  return NULL;
+}
+
+// Joins |node_count| |nodes| into a single empty node; if only one node is
+// given it is returned directly.
+static iree_status_t iree_hal_rocm_graph_command_buffer_join_nodes(
+    iree_hal_rocm_graph_command_buffer_t* command_buffer,
+    iree_host_size_t node_count, const hipGraphNode_t* nodes,
+    hipGraphNode_t* out_node) {
+  if (node_count == 1) {
+    *out_node = nodes[0];
+    return iree_ok_status();
+  }
+  return ROCM_RESULT_TO_STATUS(
+      command_buffer->context->syms,
+      hipGraphAddEmptyNode(out_node, command_buffer->graph, nodes, node_count),
+      "hipGraphAddEmptyNode");
+}
+
+// Ensures there is room in the current concurrency region for another node.
+// Full regions are joined into a single node that stands in for all of them.
+static iree_status_t iree_hal_rocm_graph_command_buffer_reserve_node(
+    iree_hal_rocm_graph_command_buffer_t* command_buffer) {
+  if (command_buffer->region_node_count <
+      IREE_ARRAYSIZE(command_buffer->region_nodes)) {
+    return iree_ok_status();
+  }
+  hipGraphNode_t join_node = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_rocm_graph_command_buffer_join_nodes(
+      command_buffer, command_buffer->region_node_count,
+      command_buffer->region_nodes, &join_node));
+  command_buffer->region_nodes[0] = join_node;
+  command_buffer->region_node_count = 1;
+  return iree_ok_status();
+}
+
+// Returns the number of dependencies (0 or 1) that new nodes in the current
+// concurrency region must have on |command_buffer|->barrier_node.
+static size_t iree_hal_rocm_graph_command_buffer_dependency_count(
+    iree_hal_rocm_graph_command_buffer_t* command_buffer) {
+  return command_buffer->barrier_node ? 1 : 0;
+}
+
+// Appends |node| to the current concurrency region. Space must have been
+// reserved with iree_hal_rocm_graph_command_buffer_reserve_node.
+static void iree_hal_rocm_graph_command_buffer_append_node(
+    iree_hal_rocm_graph_command_buffer_t* command_buffer, hipGraphNode_t node) {
+  command_buffer->region_nodes[command_buffer->region_node_count++] = node;
+}
+
+// Ends the current concurrency region such that all nodes added afterward
+// depend on all nodes added before. No-op if the region is empty.
+static iree_status_t iree_hal_rocm_graph_command_buffer_end_region(
+    iree_hal_rocm_graph_command_buffer_t* command_buffer) {
+  if (command_buffer->region_node_count == 0) return iree_ok_status();
+  IREE_RETURN_IF_ERROR(iree_hal_rocm_graph_command_buffer_join_nodes(
+      command_buffer, command_buffer->region_node_count,
+      command_buffer->region_nodes, &command_buffer->barrier_node));
+  command_buffer->region_node_count = 0;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_begin(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+
+  if (command_buffer->graph != NULL || command_buffer->exec != NULL) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "command buffer cannot be re-recorded");
+  }
+
+  ROCM_RETURN_IF_ERROR(command_buffer->context->syms,
+                       hipGraphCreate(&command_buffer->graph, /*flags=*/0),
+                       "hipGraphCreate");
+
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_end(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+
+  command_buffer->barrier_node = NULL;
+  command_buffer->region_node_count = 0;
+
+  hipGraphNode_t error_node = NULL;
+  iree_status_t status = ROCM_RESULT_TO_STATUS(
+      command_buffer->context->syms,
+      hipGraphInstantiate(&command_buffer->exec, command_buffer->graph,
+                          &error_node,
+                          /*pLogBuffer=*/NULL,
+                          /*bufferSize=*/0),
+      "hipGraphInstantiate");
+
+  // The instantiated graph holds everything it needs to launch.
+  ROCM_IGNORE_ERROR(command_buffer->context->syms,
+                    hipGraphDestroy(command_buffer->graph));
+  command_buffer->graph = NULL;
+
+  return status;
+}
+
+static void iree_hal_rocm_graph_command_buffer_begin_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer, iree_string_view_t label,
+    iree_hal_label_color_t label_color,
+    const iree_hal_label_location_t* location) {
+  // TODO(benvanik): tracy event stack.
+}
+
+static void iree_hal_rocm_graph_command_buffer_end_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  // TODO(benvanik): tracy event stack.
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_execution_barrier(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_hal_execution_barrier_flags_t flags,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+  // Stage masks are ignored: the barrier orders all prior work before all
+  // subsequent work.
+  return iree_hal_rocm_graph_command_buffer_end_region(command_buffer);
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_signal_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  // Events are implemented conservatively by the barrier in wait_events.
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_reset_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  // Events are implemented conservatively by the barrier in wait_events.
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_wait_events(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_host_size_t event_count, const iree_hal_event_t** events,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+  // Waiting on any event orders all prior work before all subsequent work.
+  return iree_hal_rocm_graph_command_buffer_end_region(command_buffer);
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_discard_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_buffer_t* buffer) {
+  // nothing to do.
+  return iree_ok_status();
+}
+
+// Splats a pattern value of 1, 2, or 4 bytes out to a 4 byte value.
+static uint32_t iree_hal_rocm_splat_pattern(const void* pattern,
+                                            size_t pattern_length) {
+  switch (pattern_length) {
+    case 1: {
+      uint32_t pattern_value = *(const uint8_t*)(pattern);
+      return (pattern_value << 24) | (pattern_value << 16) |
+             (pattern_value << 8) | pattern_value;
+    }
+    case 2: {
+      uint32_t pattern_value = *(const uint16_t*)(pattern);
+      return (pattern_value << 16) | pattern_value;
+    }
+    case 4: {
+      uint32_t pattern_value = *(const uint32_t*)(pattern);
+      return pattern_value;
+    }
+    default:
+      return 0;  // Already verified that this should not be possible.
+  }
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_fill_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length, const void* pattern,
+    iree_host_size_t pattern_length) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+
+  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
+      command_buffer->resource_set, 1, &target_buffer));
+
+  hipDeviceptr_t target_device_buffer = iree_hal_rocm_buffer_device_pointer(
+      iree_hal_buffer_allocated_buffer(target_buffer));
+  target_offset += iree_hal_buffer_byte_offset(target_buffer);
+  uint32_t dword_pattern = iree_hal_rocm_splat_pattern(pattern, pattern_length);
+  hipMemsetParams params = {
+      .dst = (uint8_t*)target_device_buffer + target_offset,
+      .elementSize = pattern_length,
+      .width = length / pattern_length,
+      .height = 1,
+      .value = dword_pattern,
+  };
+  IREE_RETURN_IF_ERROR(
+      iree_hal_rocm_graph_command_buffer_reserve_node(command_buffer));
+  hipGraphNode_t node = NULL;
+  const size_t dependency_count =
+      iree_hal_rocm_graph_command_buffer_dependency_count(command_buffer);
+  ROCM_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      hipGraphAddMemsetNode(&node, command_buffer->graph,
+                            &command_buffer->barrier_node, dependency_count,
+                            &params),
+      "hipGraphAddMemsetNode");
+  iree_hal_rocm_graph_command_buffer_append_node(command_buffer, node);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_update_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, const void* source_buffer,
+    iree_host_size_t source_offset, iree_hal_buffer_t* target_buffer,
+    iree_device_size_t target_offset, iree_device_size_t length) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+
+  // Allocate scratch space in the arena for the data and copy it in.
+  // The update buffer API requires that the command buffer capture the host
+  // memory at the time the method is called in case the caller wants to reuse
+  // the memory. The arena lives as long as the command buffer and therefore
+  // any launch of the graph.
+  uint8_t* storage = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_arena_allocate(&command_buffer->arena, length, (void**)&storage));
+  memcpy(storage, (const uint8_t*)source_buffer + source_offset, length);
+
+  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
+      command_buffer->resource_set, 1, &target_buffer));
+
+  hipDeviceptr_t target_device_buffer = iree_hal_rocm_buffer_device_pointer(
+      iree_hal_buffer_allocated_buffer(target_buffer));
+  target_offset += iree_hal_buffer_byte_offset(target_buffer);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_rocm_graph_command_buffer_reserve_node(command_buffer));
+  hipGraphNode_t node = NULL;
+  const size_t dependency_count =
+      iree_hal_rocm_graph_command_buffer_dependency_count(command_buffer);
+  ROCM_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      hipGraphAddMemcpyNode1D(&node, command_buffer->graph,
+                              &command_buffer->barrier_node, dependency_count,
+                              (uint8_t*)target_device_buffer + target_offset,
+                              storage, length, hipMemcpyHostToDevice),
+      "hipGraphAddMemcpyNode1D");
+  iree_hal_rocm_graph_command_buffer_append_node(command_buffer, node);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_copy_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* source_buffer, iree_device_size_t source_offset,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+
+  const iree_hal_buffer_t* buffers[2] = {source_buffer, target_buffer};
+  IREE_RETURN_IF_ERROR(
+      iree_hal_resource_set_insert(command_buffer->resource_set, 2, buffers));
+
+  hipDeviceptr_t target_device_buffer = iree_hal_rocm_buffer_device_pointer(
+      iree_hal_buffer_allocated_buffer(target_buffer));
+  target_offset += iree_hal_buffer_byte_offset(target_buffer);
+  hipDeviceptr_t source_device_buffer = iree_hal_rocm_buffer_device_pointer(
+      iree_hal_buffer_allocated_buffer(source_buffer));
+  source_offset += iree_hal_buffer_byte_offset(source_buffer);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_rocm_graph_command_buffer_reserve_node(command_buffer));
+  hipGraphNode_t node = NULL;
+  const size_t dependency_count =
+      iree_hal_rocm_graph_command_buffer_dependency_count(command_buffer);
+  ROCM_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      hipGraphAddMemcpyNode1D(&node, command_buffer->graph,
+                              &command_buffer->barrier_node, dependency_count,
+                              (uint8_t*)target_device_buffer + target_offset,
+                              (const uint8_t*)source_device_buffer +
+                                  source_offset,
+                              length, hipMemcpyDeviceToDevice),
+      "hipGraphAddMemcpyNode1D");
+  iree_hal_rocm_graph_command_buffer_append_node(command_buffer, node);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_push_constants(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, iree_host_size_t offset,
+    const void* values, iree_host_size_t values_length) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+  iree_host_size_t constant_base_index = offset / sizeof(int32_t);
+  for (iree_host_size_t i = 0; i < values_length / sizeof(int32_t); i++) {
+    command_buffer->push_constant[i + constant_base_index] =
+        ((uint32_t*)values)[i];
+  }
+  return iree_ok_status();
+}
+
+// Tie together the binding index and its index in |bindings| array.
+typedef struct {
+  uint32_t index;
+  uint32_t binding;
+} iree_hal_rocm_binding_mapping_t;
+
+// Helper to sort the binding based on their binding index.
+static int compare_binding_index(const void* a, const void* b) {
+  const iree_hal_rocm_binding_mapping_t buffer_a =
+      *(const iree_hal_rocm_binding_mapping_t*)a;
+  const iree_hal_rocm_binding_mapping_t buffer_b =
+      *(const iree_hal_rocm_binding_mapping_t*)b;
+  return buffer_a.binding < buffer_b.binding ? -1 : 1;
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_push_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_binding_t* bindings) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+  iree_host_size_t base_binding =
+      iree_hal_rocm_base_binding_index(executable_layout, set);
+  // Convention with the compiler side. We map bindings to kernel argument.
+  // We compact the bindings to get a dense set of arguments and keep them order
+  // based on the binding index.
+  // Sort the binding based on the binding index and map the array index to the
+  // argument index.
+  iree_hal_rocm_binding_mapping_t binding_used[IREE_HAL_ROCM_MAX_BINDING_COUNT];
+  for (iree_host_size_t i = 0; i < binding_count; i++) {
+    iree_hal_rocm_binding_mapping_t buffer = {i, bindings[i].binding};
+    binding_used[i] = buffer;
+  }
+  qsort(binding_used, binding_count, sizeof(iree_hal_rocm_binding_mapping_t),
+        compare_binding_index);
+  assert(binding_count < IREE_HAL_ROCM_MAX_BINDING_COUNT &&
+         "binding count larger than the max expected.");
+  hipDeviceptr_t* binding_params =
+      (hipDeviceptr_t*)command_buffer->kernel_params + base_binding;
+  for (iree_host_size_t i = 0; i < binding_count; i++) {
+    const iree_hal_descriptor_set_binding_t* binding =
+        &bindings[binding_used[i].index];
+    binding_params[i] =
+        (uint8_t*)iree_hal_rocm_buffer_device_pointer(
+            iree_hal_buffer_allocated_buffer(binding->buffer)) +
+        iree_hal_buffer_byte_offset(binding->buffer) + binding->offset;
+    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
+        command_buffer->resource_set, 1, &binding->buffer));
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_bind_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_hal_descriptor_set_t* descriptor_set,
+    iree_host_size_t dynamic_offset_count,
+    const iree_device_size_t* dynamic_offsets) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "need rocm implementation");
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_dispatch(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
+      command_buffer->resource_set, 1, &executable));
+
+  const iree_hal_rocm_kernel_params_layout_t* params_layout =
+      iree_hal_rocm_native_executable_kernel_params_layout(executable,
+                                                           entry_point);
+  // Append the push constants to the bindings already in the kernel arguments.
+  uint8_t* constant_params =
+      command_buffer->kernel_params + params_layout->constant_offset;
+  memcpy(constant_params, command_buffer->push_constant,
+         params_layout->constant_count * sizeof(uint32_t));
+
+  // Kernel node arguments are copied when the node is added so pointers to the
+  // packed values can be passed directly.
+  void* kernel_params[IREE_HAL_ROCM_MAX_BINDING_COUNT +
+                      IREE_HAL_ROCM_MAX_PUSH_CONSTANT_COUNT];
+  for (iree_host_size_t i = 0; i < params_layout->binding_count; i++) {
+    kernel_params[i] = (hipDeviceptr_t*)command_buffer->kernel_params + i;
+  }
+  for (iree_host_size_t i = 0; i < params_layout->constant_count; i++) {
+    kernel_params[params_layout->binding_count + i] =
+        constant_params + i * sizeof(uint32_t);
+  }
+
+  int32_t block_size_x, block_size_y, block_size_z;
+  IREE_RETURN_IF_ERROR(iree_hal_rocm_native_executable_block_size(
+      executable, entry_point, &block_size_x, &block_size_y, &block_size_z));
+  hipKernelNodeParams params = {
+      .func = iree_hal_rocm_native_executable_for_entry_point(executable,
+                                                             entry_point),
+      .blockDim = {block_size_x, block_size_y, block_size_z},
+      .gridDim = {workgroup_x, workgroup_y, workgroup_z},
+      .kernelParams = kernel_params,
+      .extra = NULL,
+      .sharedMemBytes = 0,
+  };
+
+  // Nodes in the same concurrency region may execute concurrently.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_rocm_graph_command_buffer_reserve_node(command_buffer));
+  hipGraphNode_t node = NULL;
+  const size_t dependency_count =
+      iree_hal_rocm_graph_command_buffer_dependency_count(command_buffer);
+  ROCM_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      hipGraphAddKernelNode(&node, command_buffer->graph,
+                            &command_buffer->barrier_node, dependency_count,
+                            &params),
+      "hipGraphAddKernelNode");
+  iree_hal_rocm_graph_command_buffer_append_node(command_buffer, node);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_graph_command_buffer_dispatch_indirect(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    iree_hal_buffer_t* workgroups_buffer,
+    iree_device_size_t workgroups_offset) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "need rocm implementation");
+}
+
+iree_status_t iree_hal_rocm_graph_command_buffer_launch(
+    iree_hal_command_buffer_t* base_command_buffer, hipStream_t stream) {
+  iree_hal_rocm_graph_command_buffer_t* command_buffer =
+      iree_hal_rocm_graph_command_buffer_cast(base_command_buffer);
+  if (!command_buffer->exec) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "command buffer must be ended before submission");
+  }
+  ROCM_RETURN_IF_ERROR(command_buffer->context->syms,
+                       hipGraphLaunch(command_buffer->exec, stream),
+                       "hipGraphLaunch");
+  return iree_ok_status();
+}
+
+static const iree_hal_command_buffer_vtable_t
+    iree_hal_rocm_graph_command_buffer_vtable = {
+        .destroy = iree_hal_rocm_graph_command_buffer_destroy,
+        .dyn_cast = iree_hal_rocm_graph_command_buffer_dyn_cast,
+        .begin = iree_hal_rocm_graph_command_buffer_begin,
+        .end = iree_hal_rocm_graph_command_buffer_end,
+        .begin_debug_group =
+            iree_hal_rocm_graph_command_buffer_begin_debug_group,
+        .end_debug_group = iree_hal_rocm_graph_command_buffer_end_debug_group,
+        .execution_barrier =
+            iree_hal_rocm_graph_command_buffer_execution_barrier,
+        .signal_event = iree_hal_rocm_graph_command_buffer_signal_event,
+        .reset_event = iree_hal_rocm_graph_command_buffer_reset_event,
+        .wait_events = iree_hal_rocm_graph_command_buffer_wait_events,
+        .discard_buffer = iree_hal_rocm_graph_command_buffer_discard_buffer,
+        .fill_buffer = iree_hal_rocm_graph_command_buffer_fill_buffer,
+        .update_buffer = iree_hal_rocm_graph_command_buffer_update_buffer,
+        .copy_buffer = iree_hal_rocm_graph_command_buffer_copy_buffer,
+        .push_constants = iree_hal_rocm_graph_command_buffer_push_constants,
+        .push_descriptor_set =
+            iree_hal_rocm_graph_command_buffer_push_descriptor_set,
+        .bind_descriptor_set =
+            iree_hal_rocm_graph_command_buffer_bind_descriptor_set,
+        .dispatch = iree_hal_rocm_graph_command_buffer_dispatch,
+        .dispatch_indirect =
+            iree_hal_rocm_graph_command_buffer_dispatch_indirect,
+};
@@ -24,6 +24,7 @@ typedef struct iree_hal_rocm_native_executable_function_t {
   uint32_t block_size_x;
   uint32_t block_size_y;
   uint32_t block_size_z;
+  iree_hal_rocm_kernel_params_layout_t params_layout;
 } iree_hal_rocm_native_executable_function_t;
 
 typedef struct iree_hal_rocm_native_executable_t {
@@ -44,6 +45,30 @@ static iree_hal_rocm_native_executable_t* iree_hal_rocm_native_executable_cast(
   return (iree_hal_rocm_native_executable_t*)base_value;
 }
 
+// Computes the packed kernel argument layout for entry points using
+// |executable_layout|. Kernels take one pointer per binding followed by one
+// 32-bit value per push constant, each at its natural alignment.
+static iree_status_t iree_hal_rocm_kernel_params_layout_initialize(
+    iree_hal_executable_layout_t* executable_layout,
+    iree_hal_rocm_kernel_params_layout_t* out_layout) {
+  out_layout->binding_count =
+      iree_hal_rocm_push_constant_index(executable_layout);
+  out_layout->constant_count =
+      iree_hal_rocm_executable_layout_num_constants(executable_layout);
+  if (out_layout->binding_count > IREE_HAL_ROCM_MAX_BINDING_COUNT) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "binding count %" PRIhsz
+                            " over the limit of %d",
+                            out_layout->binding_count,
+                            IREE_HAL_ROCM_MAX_BINDING_COUNT);
+  }
+  out_layout->constant_offset =
+      out_layout->binding_count * sizeof(hipDeviceptr_t);
+  out_layout->total_size = out_layout->constant_offset +
+                           out_layout->constant_count * sizeof(uint32_t);
+  return iree_ok_status();
+}
+
 iree_status_t iree_hal_rocm_native_executable_create(
     iree_hal_rocm_context_wrapper_t* context,
     const iree_hal_executable_params_t* executable_params,
@@ -74,6 +99,13 @@ iree_status_t iree_hal_rocm_native_executable_create(
       entry_count * sizeof(iree_hal_executable_layout_t*);
   iree_status_t status = iree_allocator_malloc(context->host_allocator,
                                                total_size, (void**)&executable);
+  if (!iree_status_is_ok(status)) {
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+  iree_hal_resource_initialize(&iree_hal_rocm_native_executable_vtable,
+                               &executable->resource);
+  executable->context = context;
   executable->executable_layouts =
       (void*)((char*)executable + sizeof(*executable) +
               entry_count * sizeof(iree_hal_rocm_native_executable_function_t));
@@ -99,14 +131,17 @@ iree_status_t iree_hal_rocm_native_executable_create(
           executable_params->executable_layouts[i];
       iree_hal_executable_layout_retain(
           executable_params->executable_layouts[i]);
+      executable->entry_count = i + 1;
+    }
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_rocm_kernel_params_layout_initialize(
+          executable_params->executable_layouts[i],
+          &executable->entry_functions[i].params_layout);
     }
   }
 
+  executable->module = module;
   if (iree_status_is_ok(status)) {
-    iree_hal_resource_initialize(&iree_hal_rocm_native_executable_vtable,
-                                 &executable->resource);
-    executable->module = module;
-    executable->context = context;
     *out_executable = (iree_hal_executable_t*)executable;
   } else {
     iree_hal_executable_destroy((iree_hal_executable_t*)executable);
@@ -141,6 +176,14 @@ iree_hal_executable_layout_t* iree_hal_rocm_executable_get_layout(
   return executable->executable_layouts[entry_point];
 }
 
+const iree_hal_rocm_kernel_params_layout_t*
+iree_hal_rocm_native_executable_kernel_params_layout(
+    iree_hal_executable_t* base_executable, int32_t entry_point) {
+  iree_hal_rocm_native_executable_t* executable =
+      iree_hal_rocm_native_executable_cast(base_executable);
+  return &executable->entry_functions[entry_point].params_layout;
+}
+
 static void iree_hal_rocm_native_executable_destroy(
     iree_hal_executable_t* base_executable) {
   iree_hal_rocm_native_executable_t* executable =
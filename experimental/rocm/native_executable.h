@@ -10,6 +10,7 @@
 #include <stdint.h>
 
 #include "experimental/rocm/context_wrapper.h"
+#include "experimental/rocm/executable_layout.h"
 #include "experimental/rocm/rocm_headers.h"
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
@@ -18,6 +19,25 @@
 extern "C" {
 #endif  // __cplusplus
 
+// Layout of the kernel arguments of an entry point when packed into a single
+// buffer passed with HIP_LAUNCH_PARAM_BUFFER_POINTER. Bindings are device
+// pointers in binding order followed by the push constants as 32-bit values.
+typedef struct iree_hal_rocm_kernel_params_layout_t {
+  // Number of bindings at the start of the kernel arguments.
+  iree_host_size_t binding_count;
+  // Number of push constants following the bindings.
+  iree_host_size_t constant_count;
+  // Byte offset of the first push constant.
+  iree_host_size_t constant_offset;
+  // Total size in bytes of the packed kernel arguments.
+  size_t total_size;
+} iree_hal_rocm_kernel_params_layout_t;
+
+// Maximum size in bytes of the packed kernel arguments of any entry point.
+#define IREE_HAL_ROCM_MAX_KERNEL_PARAMS_SIZE                     \
+  (IREE_HAL_ROCM_MAX_BINDING_COUNT * sizeof(hipDeviceptr_t) + \
+   IREE_HAL_ROCM_MAX_PUSH_CONSTANT_COUNT * sizeof(uint32_t))
+
 // Creates an executable from a HSACO module. The module may contain several
 // kernels that can be extracted along with the associated block size.
 iree_status_t iree_hal_rocm_native_executable_create(
@@ -37,6 +57,12 @@ iree_status_t iree_hal_rocm_native_executable_block_size(
 iree_hal_executable_layout_t* iree_hal_rocm_executable_get_layout(
     iree_hal_executable_t* executable, int32_t entry_point);
 
+// Returns the packed kernel argument layout of the given |entry_point|.
+// Computed when the executable is loaded.
+const iree_hal_rocm_kernel_params_layout_t*
+iree_hal_rocm_native_executable_kernel_params_layout(
+    iree_hal_executable_t* executable, int32_t entry_point);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
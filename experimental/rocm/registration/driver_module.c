@@ -11,8 +11,21 @@
 
 #include "experimental/rocm/api.h"
 #include "iree/base/api.h"
+#include "iree/base/internal/flags.h"
 #include "iree/base/tracing.h"
 
+IREE_FLAG(bool, rocm_use_graphs, true,
+          "Use HIP graphs for executing command buffers (instead of replaying "
+          "them directly against HIP streams).");
+
+IREE_FLAG(int32_t, rocm_queue_count, 8,
+          "Number of queues (each backed by a HIP stream) exposed on each "
+          "ROCM device.");
+
+IREE_FLAG(bool, rocm_async_allocations, false,
+          "Service queue-ordered allocations with stream-ordered HIP "
+          "allocations when supported by the runtime.");
+
 static iree_status_t iree_hal_rocm_driver_factory_enumerate(
     void *self, iree_host_size_t *out_driver_info_count,
     const iree_hal_driver_info_t **out_driver_infos) {
@@ -37,10 +50,23 @@ static iree_status_t iree_hal_rocm_driver_factory_try_create(
                             (int)driver_name.size, driver_name.data);
   }
   IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_rocm_device_params_t default_params;
+  iree_hal_rocm_device_params_initialize(&default_params);
+  if (!FLAG_rocm_use_graphs) {
+    default_params.command_buffer_mode =
+        IREE_HAL_ROCM_COMMAND_BUFFER_MODE_DIRECT;
+  }
+  default_params.queue_count =
+      (iree_host_size_t)iree_max(0, FLAG_rocm_queue_count);
+  default_params.async_allocations = FLAG_rocm_async_allocations;
+
   iree_hal_rocm_driver_options_t driver_options;
   iree_hal_rocm_driver_options_initialize(&driver_options);
-  iree_status_t status = iree_hal_rocm_driver_create(
-      driver_name, &driver_options, host_allocator, out_driver);
+
+  iree_status_t status =
+      iree_hal_rocm_driver_create(driver_name, &default_params, &driver_options,
+                                  host_allocator, out_driver);
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
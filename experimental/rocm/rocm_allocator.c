@@ -19,6 +19,13 @@ typedef struct iree_hal_rocm_allocator_t {
   iree_hal_device_t* base_device;
   iree_hal_rocm_context_wrapper_t* context;
 
+  // Stream used to free async buffers released without a queue-ordered
+  // deallocation.
+  hipStream_t stream;
+
+  // True if device-local allocations can be made in stream order.
+  bool supports_async;
+
   IREE_STATISTICS(iree_hal_allocator_statistics_t statistics;)
 } iree_hal_rocm_allocator_t;
 
@@ -32,6 +39,7 @@ static iree_hal_rocm_allocator_t* iree_hal_rocm_allocator_cast(
 
 iree_status_t iree_hal_rocm_allocator_create(
     iree_hal_device_t* base_device, iree_hal_rocm_context_wrapper_t* context,
+    hipStream_t stream, bool enable_async_allocations,
     iree_hal_allocator_t** out_allocator) {
   IREE_ASSERT_ARGUMENT(base_device);
   IREE_ASSERT_ARGUMENT(context);
@@ -44,6 +52,11 @@ iree_status_t iree_hal_rocm_allocator_create(
                                  &allocator->resource);
     allocator->context = context;
     allocator->base_device = base_device;
+    allocator->stream = stream;
+    // Stream-ordered allocation is only available in newer HIP runtimes.
+    allocator->supports_async = enable_async_allocations &&
+                                context->syms->hipMallocAsync &&
+                                context->syms->hipFreeAsync;
     *out_allocator = (iree_hal_allocator_t*)allocator;
   }
 
@@ -168,8 +181,8 @@ static iree_status_t iree_hal_rocm_allocator_allocate_buffer(
   iree_hal_buffer_t* buffer = NULL;
   if (iree_status_is_ok(status)) {
     status = iree_hal_rocm_buffer_wrap(
-        (iree_hal_allocator_t*)allocator, params->type, params->access,
-        params->usage, allocation_size,
+        (iree_hal_allocator_t*)allocator, IREE_HAL_ROCM_BUFFER_TYPE_DEFAULT,
+        params->type, params->access, params->usage, allocation_size,
         /*byte_offset=*/0,
         /*byte_length=*/allocation_size, device_ptr, host_ptr, &buffer);
   }
@@ -207,6 +220,19 @@ static void iree_hal_rocm_allocator_deallocate_buffer(
   iree_hal_rocm_allocator_t* allocator =
       iree_hal_rocm_allocator_cast(base_allocator);
 
+  if (iree_hal_rocm_buffer_type(base_buffer) ==
+      IREE_HAL_ROCM_BUFFER_TYPE_ASYNC) {
+    // Buffers released without a queue-ordered deallocation are freed in the
+    // order of the allocator stream; buffers already freed have had their
+    // device pointer dropped.
+    if (iree_hal_rocm_buffer_device_pointer(base_buffer)) {
+      iree_status_ignore(iree_hal_rocm_allocator_free_async(
+          base_allocator, allocator->stream, base_buffer));
+    }
+    iree_hal_buffer_destroy(base_buffer);
+    return;
+  }
+
   iree_hal_memory_type_t memory_type = iree_hal_buffer_memory_type(base_buffer);
   iree_hal_rocm_buffer_free(allocator->context, memory_type,
                             iree_hal_rocm_buffer_device_pointer(base_buffer),
@@ -219,6 +245,79 @@ static void iree_hal_rocm_allocator_deallocate_buffer(
   iree_hal_buffer_destroy(base_buffer);
 }
 
+bool iree_hal_rocm_allocator_supports_async(
+    iree_hal_allocator_t* base_allocator,
+    const iree_hal_buffer_params_t* params) {
+  iree_hal_rocm_allocator_t* allocator =
+      iree_hal_rocm_allocator_cast(base_allocator);
+  if (!allocator->supports_async) return false;
+  return iree_all_bits_set(params->type, IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL) &&
+         !iree_any_bit_set(params->type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE);
+}
+
+iree_status_t iree_hal_rocm_allocator_alloc_async(
+    iree_hal_allocator_t* base_allocator, hipStream_t stream,
+    const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** out_buffer) {
+  iree_hal_rocm_allocator_t* allocator =
+      iree_hal_rocm_allocator_cast(base_allocator);
+  IREE_ASSERT(iree_hal_rocm_allocator_supports_async(base_allocator, params));
+  *out_buffer = NULL;
+  if (allocation_size == 0) allocation_size = 4;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, allocation_size);
+
+  hipDeviceptr_t device_ptr = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, ROCM_RESULT_TO_STATUS(
+              allocator->context->syms,
+              hipMallocAsync(&device_ptr, allocation_size, stream),
+              "hipMallocAsync"));
+
+  iree_hal_buffer_t* buffer = NULL;
+  iree_status_t status = iree_hal_rocm_buffer_wrap(
+      base_allocator, IREE_HAL_ROCM_BUFFER_TYPE_ASYNC, params->type,
+      params->access, params->usage, allocation_size,
+      /*byte_offset=*/0,
+      /*byte_length=*/allocation_size, device_ptr, /*host_ptr=*/NULL, &buffer);
+
+  if (iree_status_is_ok(status)) {
+    IREE_STATISTICS(iree_hal_allocator_statistics_record_alloc(
+        &allocator->statistics, params->type, allocation_size));
+    *out_buffer = buffer;
+  } else {
+    ROCM_IGNORE_ERROR(allocator->context->syms,
+                      hipFreeAsync(device_ptr, stream));
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_hal_rocm_allocator_free_async(
+    iree_hal_allocator_t* base_allocator, hipStream_t stream,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_rocm_allocator_t* allocator =
+      iree_hal_rocm_allocator_cast(base_allocator);
+  IREE_ASSERT(iree_hal_rocm_buffer_type(buffer) ==
+              IREE_HAL_ROCM_BUFFER_TYPE_ASYNC);
+  hipDeviceptr_t device_ptr = iree_hal_rocm_buffer_device_pointer(buffer);
+  if (!device_ptr) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_status_t status =
+      ROCM_RESULT_TO_STATUS(allocator->context->syms,
+                            hipFreeAsync(device_ptr, stream), "hipFreeAsync");
+  if (iree_status_is_ok(status)) {
+    iree_hal_rocm_buffer_drop_device_pointer(buffer);
+    IREE_STATISTICS(iree_hal_allocator_statistics_record_free(
+        &allocator->statistics, iree_hal_buffer_memory_type(buffer),
+        iree_hal_buffer_allocation_size(buffer)));
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static iree_status_t iree_hal_rocm_allocator_import_buffer(
     iree_hal_allocator_t* IREE_RESTRICT base_allocator,
     const iree_hal_buffer_params_t* IREE_RESTRICT params,
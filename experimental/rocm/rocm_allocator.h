@@ -17,10 +17,37 @@ extern "C" {
 #endif  // __cplusplus
 
 // Create a ROCM allocator.
+// When |enable_async_allocations| is set and the runtime supports
+// stream-ordered allocation iree_hal_rocm_allocator_alloc_async can be used to
+// allocate device-local memory in stream order. Async buffers released without
+// a queue-ordered deallocation are freed in the order of |stream|.
 iree_status_t iree_hal_rocm_allocator_create(
     iree_hal_device_t* base_device, iree_hal_rocm_context_wrapper_t* context,
+    hipStream_t stream, bool enable_async_allocations,
     iree_hal_allocator_t** out_allocator);
 
+// Returns true if buffers with |params| can be allocated in stream order with
+// iree_hal_rocm_allocator_alloc_async. Only device-local memory that is not
+// host-visible can be allocated in stream order.
+bool iree_hal_rocm_allocator_supports_async(
+    iree_hal_allocator_t* allocator, const iree_hal_buffer_params_t* params);
+
+// Allocates a buffer in stream order that is available for use by work
+// enqueued on |stream| after this call. Work on other streams must be ordered
+// after |stream| before using the buffer.
+iree_status_t iree_hal_rocm_allocator_alloc_async(
+    iree_hal_allocator_t* allocator, hipStream_t stream,
+    const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** out_buffer);
+
+// Frees the memory backing |buffer| in stream order on |stream|. The buffer
+// must have been allocated with iree_hal_rocm_allocator_alloc_async and must
+// not be used by work enqueued after this call. The buffer object itself
+// remains valid until released.
+iree_status_t iree_hal_rocm_allocator_free_async(
+    iree_hal_allocator_t* allocator, hipStream_t stream,
+    iree_hal_buffer_t* buffer);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
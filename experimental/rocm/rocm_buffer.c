@@ -15,6 +15,7 @@
 
 typedef struct iree_hal_rocm_buffer_t {
   iree_hal_buffer_t base;
+  iree_hal_rocm_buffer_type_t type;
   void* host_ptr;
   hipDeviceptr_t device_ptr;
 } iree_hal_rocm_buffer_t;
@@ -28,8 +29,8 @@ static iree_hal_rocm_buffer_t* iree_hal_rocm_buffer_cast(
 }
 
 iree_status_t iree_hal_rocm_buffer_wrap(
-    iree_hal_allocator_t* allocator, iree_hal_memory_type_t memory_type,
-    iree_hal_memory_access_t allowed_access,
+    iree_hal_allocator_t* allocator, iree_hal_rocm_buffer_type_t buffer_type,
+    iree_hal_memory_type_t memory_type, iree_hal_memory_access_t allowed_access,
     iree_hal_buffer_usage_t allowed_usage, iree_device_size_t allocation_size,
     iree_device_size_t byte_offset, iree_device_size_t byte_length,
     hipDeviceptr_t device_ptr, void* host_ptr, iree_hal_buffer_t** out_buffer) {
@@ -47,6 +48,7 @@ iree_status_t iree_hal_rocm_buffer_wrap(
                                allocation_size, byte_offset, byte_length,
                                memory_type, allowed_access, allowed_usage,
                                &iree_hal_rocm_buffer_vtable, &buffer->base);
+    buffer->type = buffer_type;
     buffer->host_ptr = host_ptr;
     buffer->device_ptr = device_ptr;
     *out_buffer = &buffer->base;
@@ -126,6 +128,20 @@ void* iree_hal_rocm_buffer_host_pointer(iree_hal_buffer_t* base_buffer) {
   return buffer->host_ptr;
 }
 
+iree_hal_rocm_buffer_type_t iree_hal_rocm_buffer_type(
+    iree_hal_buffer_t* base_buffer) {
+  if (!iree_hal_resource_is(base_buffer, &iree_hal_rocm_buffer_vtable)) {
+    return IREE_HAL_ROCM_BUFFER_TYPE_DEFAULT;
+  }
+  iree_hal_rocm_buffer_t* buffer = iree_hal_rocm_buffer_cast(base_buffer);
+  return buffer->type;
+}
+
+void iree_hal_rocm_buffer_drop_device_pointer(iree_hal_buffer_t* base_buffer) {
+  iree_hal_rocm_buffer_t* buffer = iree_hal_rocm_buffer_cast(base_buffer);
+  buffer->device_ptr = 0;
+}
+
 static const iree_hal_buffer_vtable_t iree_hal_rocm_buffer_vtable = {
     .recycle = iree_hal_buffer_recycle,
     .destroy = iree_hal_rocm_buffer_destroy,
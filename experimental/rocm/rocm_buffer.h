@@ -15,14 +15,33 @@
 extern "C" {
 #endif  // __cplusplus
 
-// Wraps a ROCm allocation in an iree_hal_buffer_t.
+// Defines how the memory backing a ROCm buffer was allocated.
+typedef enum iree_hal_rocm_buffer_type_e {
+  // Allocated synchronously with hipMalloc/hipMallocManaged/hipMemAllocHost.
+  IREE_HAL_ROCM_BUFFER_TYPE_DEFAULT = 0,
+  // Allocated in stream order with hipMallocAsync and freed with
+  // hipFreeAsync.
+  IREE_HAL_ROCM_BUFFER_TYPE_ASYNC = 1,
+} iree_hal_rocm_buffer_type_t;
+
+// Wraps a ROCm allocation of |buffer_type| in an iree_hal_buffer_t.
 iree_status_t iree_hal_rocm_buffer_wrap(
-    iree_hal_allocator_t* allocator, iree_hal_memory_type_t memory_type,
-    iree_hal_memory_access_t allowed_access,
+    iree_hal_allocator_t* allocator, iree_hal_rocm_buffer_type_t buffer_type,
+    iree_hal_memory_type_t memory_type, iree_hal_memory_access_t allowed_access,
     iree_hal_buffer_usage_t allowed_usage, iree_device_size_t allocation_size,
     iree_device_size_t byte_offset, iree_device_size_t byte_length,
     hipDeviceptr_t device_ptr, void* host_ptr, iree_hal_buffer_t** out_buffer);
 
+// Returns the type of the allocation backing |buffer| or
+// IREE_HAL_ROCM_BUFFER_TYPE_DEFAULT if |buffer| is not a ROCm buffer.
+iree_hal_rocm_buffer_type_t iree_hal_rocm_buffer_type(
+    iree_hal_buffer_t* buffer);
+
+// Drops the device pointer of |buffer| after its allocation has been freed
+// out-of-band (such as with hipFreeAsync) such that it is not freed again
+// when the buffer is destroyed.
+void iree_hal_rocm_buffer_drop_device_pointer(iree_hal_buffer_t* buffer);
+
 // Returns the ROCm base pointer for the given |buffer|.
 // This is the entire allocated_buffer and must be offset by the buffer
 // byte_offset and byte_length when used.
@@ -16,18 +16,38 @@
 #include "experimental/rocm/dynamic_symbols.h"
 #include "experimental/rocm/event_semaphore.h"
 #include "experimental/rocm/executable_layout.h"
+#include "experimental/rocm/graph_command_buffer.h"
 #include "experimental/rocm/nop_executable_cache.h"
 #include "experimental/rocm/rocm_allocator.h"
+#include "experimental/rocm/rocm_buffer.h"
 #include "experimental/rocm/rocm_event.h"
 #include "experimental/rocm/status_util.h"
 #include "iree/base/internal/arena.h"
+#include "iree/base/internal/atomic_slist.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/utils/buffer_transfer.h"
+#include "iree/hal/utils/deferred_command_buffer.h"
+#include "iree/hal/utils/transient_buffer_pool.h"
 
 //===----------------------------------------------------------------------===//
 // iree_hal_rocm_device_t
 //===----------------------------------------------------------------------===//
 
+// A device queue backed by its own HIP stream.
+// Work submitted to different queues may execute concurrently on the device
+// unless ordered by semaphores.
+typedef struct iree_hal_rocm_device_queue_t {
+  // Serializes submissions to the queue as the stream and the cached direct
+  // command buffer must be externally synchronized.
+  iree_slim_mutex_t mutex;
+
+  hipStream_t stream;
+
+  // Direct command buffer recording into |stream| that deferred command
+  // buffers are replayed against when in direct mode.
+  iree_hal_command_buffer_t* direct_command_buffer;
+} iree_hal_rocm_device_queue_t;
+
 typedef struct iree_hal_rocm_device_t {
   iree_hal_resource_t resource;
   iree_string_view_t identifier;
@@ -40,13 +60,28 @@ typedef struct iree_hal_rocm_device_t {
   // to ensure the symbols remains valid.
   iree_hal_driver_t* driver;
 
+  // Parameters used to control device behavior.
+  iree_hal_rocm_device_params_t params;
+
   hipDevice_t device;
 
-  // TODO: support multiple streams.
-  hipStream_t stream;
   iree_hal_rocm_context_wrapper_t context_wrapper;
   iree_hal_allocator_t* device_allocator;
 
+  // Pool of device allocations recycled by queue-ordered allocations.
+  iree_hal_transient_buffer_pool_t* transient_pool;
+
+  // State shared by all semaphores created from the device.
+  iree_hal_rocm_semaphore_state_t semaphore_state;
+
+  // Submissions whose work has completed on the stream and whose resources
+  // can be released. Populated from HIP host functions, which must not call
+  // into HIP, and reclaimed on the host as the device is used.
+  iree_atomic_slist_t completed_submissions;
+
+  // Queues selected by submission queue affinity.
+  iree_host_size_t queue_count;
+  iree_hal_rocm_device_queue_t queues[];
 } iree_hal_rocm_device_t;
 
 static const iree_hal_device_vtable_t iree_hal_rocm_device_vtable;
@@ -57,15 +92,61 @@ static iree_hal_rocm_device_t* iree_hal_rocm_device_cast(
   return (iree_hal_rocm_device_t*)base_value;
 }
 
+void iree_hal_rocm_device_params_initialize(
+    iree_hal_rocm_device_params_t* out_params) {
+  out_params->queue_count = 8;
+  out_params->arena_block_size = 32 * 1024;
+  out_params->command_buffer_mode = IREE_HAL_ROCM_COMMAND_BUFFER_MODE_GRAPH;
+  out_params->async_allocations = false;
+}
+
+static iree_status_t iree_hal_rocm_device_check_params(
+    const iree_hal_rocm_device_params_t* params) {
+  if (params->arena_block_size < 4096) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "arena block size too small (< 4096 bytes)");
+  }
+  if (params->queue_count == 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "at least one queue is required");
+  }
+  return iree_ok_status();
+}
+
+static void iree_hal_rocm_device_reclaim_submissions(
+    iree_hal_rocm_device_t* device);
+
 static void iree_hal_rocm_device_destroy(iree_hal_device_t* base_device) {
   iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
   iree_allocator_t host_allocator = iree_hal_device_host_allocator(base_device);
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  // Drain all in-flight work so that its completion callbacks have run and the
+  // resources it retained can be released.
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    if (!device->queues[i].stream) continue;
+    ROCM_IGNORE_ERROR(device->context_wrapper.syms,
+                      hipStreamSynchronize(device->queues[i].stream));
+  }
+  iree_hal_rocm_device_reclaim_submissions(device);
+  iree_atomic_slist_deinitialize(&device->completed_submissions);
+
   // There should be no more buffers live that use the allocator.
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    iree_hal_command_buffer_release(device->queues[i].direct_command_buffer);
+  }
+  iree_hal_transient_buffer_pool_free(device->transient_pool);
   iree_hal_allocator_release(device->device_allocator);
-  ROCM_IGNORE_ERROR(device->context_wrapper.syms,
-                    hipStreamDestroy(device->stream));
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    if (device->queues[i].stream) {
+      ROCM_IGNORE_ERROR(device->context_wrapper.syms,
+                        hipStreamDestroy(device->queues[i].stream));
+    }
+    iree_slim_mutex_deinitialize(&device->queues[i].mutex);
+  }
+
+  iree_arena_block_pool_deinitialize(&device->block_pool);
+  iree_hal_rocm_semaphore_state_deinitialize(&device->semaphore_state);
 
   // Finally, destroy the device.
   iree_hal_driver_release(device->driver);
@@ -77,28 +158,71 @@ static void iree_hal_rocm_device_destroy(iree_hal_device_t* base_device) {
 
 static iree_status_t iree_hal_rocm_device_create_internal(
     iree_hal_driver_t* driver, iree_string_view_t identifier,
-    hipDevice_t rocm_device, hipStream_t stream, hipCtx_t context,
-    iree_hal_rocm_dynamic_symbols_t* syms, iree_allocator_t host_allocator,
-    iree_hal_device_t** out_device) {
+    const iree_hal_rocm_device_params_t* params, hipDevice_t rocm_device,
+    hipCtx_t context, iree_hal_rocm_dynamic_symbols_t* syms,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device) {
   iree_hal_rocm_device_t* device = NULL;
-  iree_host_size_t total_size = sizeof(*device) + identifier.size;
+  iree_host_size_t queues_size =
+      params->queue_count * sizeof(device->queues[0]);
+  iree_host_size_t total_size =
+      iree_sizeof_struct(*device) + queues_size + identifier.size;
   IREE_RETURN_IF_ERROR(
       iree_allocator_malloc(host_allocator, total_size, (void**)&device));
   memset(device, 0, total_size);
   iree_hal_resource_initialize(&iree_hal_rocm_device_vtable, &device->resource);
   device->driver = driver;
   iree_hal_driver_retain(device->driver);
-  uint8_t* buffer_ptr = (uint8_t*)device + sizeof(*device);
-  buffer_ptr += iree_string_view_append_to_buffer(
-      identifier, &device->identifier, (char*)buffer_ptr);
+  iree_string_view_append_to_buffer(
+      identifier, &device->identifier,
+      (char*)device + iree_sizeof_struct(*device) + queues_size);
+  device->params = *params;
   device->device = rocm_device;
-  device->stream = stream;
   device->context_wrapper.rocm_context = context;
   device->context_wrapper.host_allocator = host_allocator;
   device->context_wrapper.syms = syms;
-  iree_status_t status = iree_hal_rocm_allocator_create(
-      (iree_hal_device_t*)device, &device->context_wrapper,
-      &device->device_allocator);
+  iree_arena_block_pool_initialize(params->arena_block_size, host_allocator,
+                                   &device->block_pool);
+  iree_hal_rocm_semaphore_state_initialize(&device->semaphore_state);
+  iree_atomic_slist_initialize(&device->completed_submissions);
+
+  iree_status_t status = iree_ok_status();
+  device->queue_count = params->queue_count;
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    iree_slim_mutex_initialize(&device->queues[i].mutex);
+  }
+  for (iree_host_size_t i = 0;
+       i < device->queue_count && iree_status_is_ok(status); ++i) {
+    status = ROCM_RESULT_TO_STATUS(
+        syms, hipStreamCreateWithFlags(&device->queues[i].stream,
+                                       hipStreamNonBlocking));
+  }
+
+  // Stream-ordered allocations made outside of queue operations are issued
+  // against the first queue.
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_rocm_allocator_create(
+        (iree_hal_device_t*)device, &device->context_wrapper,
+        device->queues[0].stream, params->async_allocations,
+        &device->device_allocator);
+  }
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_transient_buffer_pool_create(
+        device->device_allocator, host_allocator, &device->transient_pool);
+  }
+
+  if (params->command_buffer_mode == IREE_HAL_ROCM_COMMAND_BUFFER_MODE_DIRECT) {
+    for (iree_host_size_t i = 0;
+         i < device->queue_count && iree_status_is_ok(status); ++i) {
+      status = iree_hal_rocm_direct_command_buffer_create(
+          (iree_hal_device_t*)device, &device->context_wrapper,
+          IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION,
+          IREE_HAL_COMMAND_CATEGORY_ANY, IREE_HAL_QUEUE_AFFINITY_ANY,
+          device->queues[i].stream,
+          /*block_pool=*/NULL, &device->queues[i].direct_command_buffer);
+    }
+  }
+
   if (iree_status_is_ok(status)) {
     *out_device = (iree_hal_device_t*)device;
   } else {
@@ -107,29 +231,23 @@ static iree_status_t iree_hal_rocm_device_create_internal(
   return status;
 }
 
-iree_status_t iree_hal_rocm_device_create(iree_hal_driver_t* driver,
-                                          iree_string_view_t identifier,
-                                          iree_hal_rocm_dynamic_symbols_t* syms,
-                                          hipDevice_t device,
-                                          iree_allocator_t host_allocator,
-                                          iree_hal_device_t** out_device) {
+iree_status_t iree_hal_rocm_device_create(
+    iree_hal_driver_t* driver, iree_string_view_t identifier,
+    const iree_hal_rocm_device_params_t* params,
+    iree_hal_rocm_dynamic_symbols_t* syms, hipDevice_t device,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device) {
+  IREE_ASSERT_ARGUMENT(params);
   IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(z0,
+                                    iree_hal_rocm_device_check_params(params));
   hipCtx_t context;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
       z0, ROCM_RESULT_TO_STATUS(syms, hipCtxCreate(&context, 0, device)));
-  hipStream_t stream;
-  iree_status_t status = ROCM_RESULT_TO_STATUS(
-      syms, hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
 
-  if (iree_status_is_ok(status)) {
-    status = iree_hal_rocm_device_create_internal(driver, identifier, device,
-                                                  stream, context, syms,
-                                                  host_allocator, out_device);
-  }
+  iree_status_t status = iree_hal_rocm_device_create_internal(
+      driver, identifier, params, device, context, syms, host_allocator,
+      out_device);
   if (!iree_status_is_ok(status)) {
-    if (stream) {
-      syms->hipStreamDestroy(stream);
-    }
     syms->hipCtxDestroy(context);
   }
   IREE_TRACE_ZONE_END(z0);
@@ -154,10 +272,18 @@ static iree_hal_allocator_t* iree_hal_rocm_device_allocator(
   return device->device_allocator;
 }
 
+static void iree_hal_rocm_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
 static iree_status_t iree_hal_rocm_device_query_i64(
     iree_hal_device_t* base_device, iree_string_view_t category,
     iree_string_view_t key, int64_t* out_value) {
-  // iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
+  iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
   *out_value = 0;
 
   if (iree_string_view_equal(category,
@@ -167,6 +293,12 @@ static iree_status_t iree_hal_rocm_device_query_i64(
             ? 1
             : 0;
     return iree_ok_status();
+  } else if (iree_string_view_equal(category,
+                                    iree_make_cstring_view("hal.device"))) {
+    if (iree_string_view_equal(key, iree_make_cstring_view("concurrency"))) {
+      *out_value = (int64_t)device->queue_count;
+      return iree_ok_status();
+    }
   }
 
   return iree_make_status(
@@ -178,18 +310,47 @@ static iree_status_t iree_hal_rocm_device_query_i64(
 static iree_status_t iree_hal_rocm_device_trim(iree_hal_device_t* base_device) {
   iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
   iree_arena_block_pool_trim(&device->block_pool);
+  iree_hal_rocm_device_reclaim_submissions(device);
+  iree_hal_transient_buffer_pool_trim(device->transient_pool);
   return iree_hal_allocator_trim(device->device_allocator);
 }
 
+// Returns the queue to submit work to based on the |queue_affinity|.
+// All queues are general purpose so |command_categories| is ignored. As with
+// other devices the affinity only ensures that equivalent affinities map to
+// equivalent queues.
+static iree_hal_rocm_device_queue_t* iree_hal_rocm_device_select_queue(
+    iree_hal_rocm_device_t* device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity) {
+  return &device->queues[queue_affinity % device->queue_count];
+}
+
 static iree_status_t iree_hal_rocm_device_create_command_buffer(
     iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer) {
   iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
-  return iree_hal_rocm_direct_command_buffer_create(
-      base_device, &device->context_wrapper, mode, command_categories,
-      queue_affinity, &device->block_pool, out_command_buffer);
+  switch (device->params.command_buffer_mode) {
+    case IREE_HAL_ROCM_COMMAND_BUFFER_MODE_GRAPH:
+      if (binding_capacity > 0) {
+        return iree_make_status(
+            IREE_STATUS_UNIMPLEMENTED,
+            "binding tables not yet implemented for graph command buffers");
+      }
+      return iree_hal_rocm_graph_command_buffer_create(
+          base_device, &device->context_wrapper, mode, command_categories,
+          queue_affinity, &device->block_pool, out_command_buffer);
+    case IREE_HAL_ROCM_COMMAND_BUFFER_MODE_DIRECT:
+      return iree_hal_deferred_command_buffer_create(
+          base_device, mode, command_categories, binding_capacity,
+          &device->block_pool, iree_hal_device_host_allocator(base_device),
+          out_command_buffer);
+    default:
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "invalid command buffer mode");
+  }
 }
 
 static iree_status_t iree_hal_rocm_device_create_descriptor_set(
@@ -243,31 +404,330 @@ static iree_status_t iree_hal_rocm_device_create_semaphore(
     iree_hal_device_t* base_device, uint64_t initial_value,
     iree_hal_semaphore_t** out_semaphore) {
   iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
-  return iree_hal_rocm_semaphore_create(&device->context_wrapper, initial_value,
+  return iree_hal_rocm_semaphore_create(&device->context_wrapper,
+                                        &device->semaphore_state, initial_value,
                                         out_semaphore);
 }
 
 static iree_hal_semaphore_compatibility_t
 iree_hal_rocm_device_query_semaphore_compatibility(
     iree_hal_device_t* base_device, iree_hal_semaphore_t* semaphore) {
-  // TODO: implement ROCM semaphores.
+  if (iree_hal_rocm_semaphore_isa(semaphore)) {
+    // ROCM semaphores are signaled from the stream as work completes without
+    // blocking the submitting thread. Waits are performed on the host unless
+    // the signal has already been enqueued on a stream.
+    return IREE_HAL_SEMAPHORE_COMPATIBILITY_HOST_ONLY |
+           IREE_HAL_SEMAPHORE_COMPATIBILITY_DEVICE_SIGNAL;
+  }
   return IREE_HAL_SEMAPHORE_COMPATIBILITY_HOST_ONLY;
 }
 
+// Resources retained by a submission until its work has completed on the
+// stream. Allocated as a single block with trailing storage for the lists.
+typedef struct iree_hal_rocm_device_submission_t {
+  // Entry in the device completed_submissions list.
+  iree_atomic_slist_entry_t slist_entry;
+  // Unretained; the device drains the stream before it is destroyed.
+  iree_hal_rocm_device_t* device;
+  // Retained command buffers whose execution must complete before release.
+  iree_host_size_t command_buffer_count;
+  iree_hal_command_buffer_t** command_buffers;
+  // Retained semaphores signaled once the submission completes.
+  iree_hal_semaphore_list_t signal_semaphores;
+} iree_hal_rocm_device_submission_t;
+
+static void iree_hal_rocm_device_submission_free(
+    iree_hal_rocm_device_submission_t* submission) {
+  iree_allocator_t host_allocator =
+      submission->device->context_wrapper.host_allocator;
+  for (iree_host_size_t i = 0; i < submission->command_buffer_count; ++i) {
+    iree_hal_command_buffer_release(submission->command_buffers[i]);
+  }
+  for (iree_host_size_t i = 0; i < submission->signal_semaphores.count; ++i) {
+    iree_hal_semaphore_release(submission->signal_semaphores.semaphores[i]);
+  }
+  iree_allocator_free(host_allocator, submission);
+}
+
+// Releases the resources of all submissions that have completed.
+// Must not be called from HIP host functions as releasing command buffers may
+// destroy HIP objects.
+static void iree_hal_rocm_device_reclaim_submissions(
+    iree_hal_rocm_device_t* device) {
+  iree_atomic_slist_entry_t* head = NULL;
+  if (!iree_atomic_slist_flush(&device->completed_submissions,
+                               IREE_ATOMIC_SLIST_FLUSH_ORDER_APPROXIMATE_LIFO,
+                               &head, /*out_tail=*/NULL)) {
+    return;
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  while (head) {
+    iree_atomic_slist_entry_t* next = head->next;
+    // The entry is the first member of the submission.
+    iree_hal_rocm_device_submission_free(
+        (iree_hal_rocm_device_submission_t*)head);
+    head = next;
+  }
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// HIP host function run once all work enqueued on the stream prior to the
+// submission has completed.
+// NOTE: HIP APIs must not be called from here; resources are handed back to
+// the device to be released on the next host-side use.
+static void iree_hal_rocm_device_submission_complete(void* user_data) {
+  iree_hal_rocm_device_submission_t* submission =
+      (iree_hal_rocm_device_submission_t*)user_data;
+  iree_hal_rocm_device_t* device = submission->device;
+  iree_status_t status = iree_hal_rocm_semaphore_multi_signal(
+      &device->semaphore_state, &submission->signal_semaphores);
+  if (!iree_status_is_ok(status)) {
+    // Waiters must not hang on semaphores we were unable to signal.
+    for (iree_host_size_t i = 0; i < submission->signal_semaphores.count; ++i) {
+      iree_hal_semaphore_fail(submission->signal_semaphores.semaphores[i],
+                              iree_status_clone(status));
+    }
+    iree_status_ignore(status);
+  }
+  iree_atomic_slist_push(&device->completed_submissions,
+                         &submission->slist_entry);
+}
+
+// Enqueues a host function on |queue| that signals the batch signal semaphores
+// and releases the batch command buffers once all prior work on the queue
+// stream has completed. Must be called with the queue mutex held.
+static iree_status_t iree_hal_rocm_device_enqueue_completion(
+    iree_hal_rocm_device_t* device, iree_hal_rocm_device_queue_t* queue,
+    const iree_hal_submission_batch_t* batch) {
+  const iree_host_size_t command_buffer_count = batch->command_buffer_count;
+  const iree_host_size_t signal_count = batch->signal_semaphores.count;
+  if (command_buffer_count == 0 && signal_count == 0) return iree_ok_status();
+
+  iree_hal_rocm_device_submission_t* submission = NULL;
+  iree_host_size_t total_size =
+      iree_sizeof_struct(*submission) + signal_count * sizeof(uint64_t) +
+      (command_buffer_count + signal_count) * sizeof(void*);
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      device->context_wrapper.host_allocator, total_size, (void**)&submission));
+  uint8_t* ptr = (uint8_t*)submission + iree_sizeof_struct(*submission);
+  submission->signal_semaphores.payload_values = (uint64_t*)ptr;
+  ptr += signal_count * sizeof(uint64_t);
+  submission->signal_semaphores.semaphores = (iree_hal_semaphore_t**)ptr;
+  ptr += signal_count * sizeof(void*);
+  submission->command_buffers = (iree_hal_command_buffer_t**)ptr;
+  submission->slist_entry.next = NULL;
+  submission->device = device;
+
+  submission->command_buffer_count = command_buffer_count;
+  for (iree_host_size_t i = 0; i < command_buffer_count; ++i) {
+    submission->command_buffers[i] = batch->command_buffers[i];
+    iree_hal_command_buffer_retain(batch->command_buffers[i]);
+  }
+  submission->signal_semaphores.count = signal_count;
+  for (iree_host_size_t i = 0; i < signal_count; ++i) {
+    submission->signal_semaphores.semaphores[i] =
+        batch->signal_semaphores.semaphores[i];
+    submission->signal_semaphores.payload_values[i] =
+        batch->signal_semaphores.payload_values[i];
+    iree_hal_semaphore_retain(batch->signal_semaphores.semaphores[i]);
+  }
+
+  iree_status_t status = ROCM_RESULT_TO_STATUS(
+      device->context_wrapper.syms,
+      hipLaunchHostFunc(queue->stream, iree_hal_rocm_device_submission_complete,
+                        submission),
+      "hipLaunchHostFunc");
+  if (!iree_status_is_ok(status)) {
+    iree_hal_rocm_device_submission_free(submission);
+    return status;
+  }
+
+  // Work enqueued after this point on any queue can be ordered after the
+  // signals without waiting on the host.
+  for (iree_host_size_t i = 0; i < signal_count && iree_status_is_ok(status);
+       ++i) {
+    iree_hal_semaphore_t* semaphore = batch->signal_semaphores.semaphores[i];
+    if (iree_hal_rocm_semaphore_isa(semaphore)) {
+      status = iree_hal_rocm_semaphore_enqueue_signal(
+          semaphore, queue->stream, batch->signal_semaphores.payload_values[i]);
+    }
+  }
+  return status;
+}
+
+// Ensures all waits in |wait_semaphores| are satisfied before work is enqueued
+// on |queue|. Waits on signals already enqueued on a stream are performed by
+// the device on an event and all others are waited on by the host. Must be
+// called without the queue mutex held as the signal being waited on may come
+// from another thread submitting to the same queue.
+static iree_status_t iree_hal_rocm_device_wait_for_batch(
+    iree_hal_rocm_device_t* device, iree_hal_rocm_device_queue_t* queue,
+    const iree_hal_semaphore_list_t* wait_semaphores) {
+  for (iree_host_size_t i = 0; i < wait_semaphores->count; ++i) {
+    iree_hal_semaphore_t* semaphore = wait_semaphores->semaphores[i];
+    const uint64_t value = wait_semaphores->payload_values[i];
+    bool is_ordered = false;
+    if (iree_hal_rocm_semaphore_isa(semaphore)) {
+      IREE_RETURN_IF_ERROR(iree_hal_rocm_semaphore_enqueue_wait(
+          semaphore, queue->stream, value, &is_ordered));
+    }
+    if (is_ordered) continue;
+    IREE_RETURN_IF_ERROR(
+        iree_hal_semaphore_wait(semaphore, value, iree_infinite_timeout()));
+  }
+  return iree_ok_status();
+}
+
 static iree_status_t iree_hal_rocm_device_queue_submit(
     iree_hal_device_t* base_device,
     iree_hal_command_category_t command_categories,
     iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
     const iree_hal_submission_batch_t* batches) {
   iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
-  // TODO(raikonenfnu): Once semaphore is implemented wait for semaphores
-  // TODO(thomasraoux): implement semaphores - for now this conservatively
-  // synchronizes after every submit.
-  // TODO(raikonenfnu): currently run on default/null stream, when cmd buffer
-  // stream work with device->stream, we'll change
-  ROCM_RETURN_IF_ERROR(device->context_wrapper.syms, hipStreamSynchronize(0),
-                       "hipStreamSynchronize");
-  return iree_ok_status();
+  iree_hal_rocm_device_queue_t* queue = iree_hal_rocm_device_select_queue(
+      device, command_categories, queue_affinity);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Release resources from prior submissions that have since completed.
+  iree_hal_rocm_device_reclaim_submissions(device);
+
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < batch_count && iree_status_is_ok(status);
+       i++) {
+    status = iree_hal_rocm_device_wait_for_batch(device, queue,
+                                                 &batches[i].wait_semaphores);
+    if (!iree_status_is_ok(status)) break;
+    iree_slim_mutex_lock(&queue->mutex);
+    for (iree_host_size_t j = 0;
+         j < batches[i].command_buffer_count && iree_status_is_ok(status);
+         j++) {
+      iree_hal_command_buffer_t* command_buffer = batches[i].command_buffers[j];
+      if (iree_hal_rocm_graph_command_buffer_isa(command_buffer)) {
+        status =
+            iree_hal_rocm_graph_command_buffer_launch(command_buffer,
+                                                      queue->stream);
+      } else {
+        status = iree_hal_deferred_command_buffer_apply(
+            command_buffer, queue->direct_command_buffer,
+            batches[i].binding_tables ? batches[i].binding_tables[j]
+                                      : iree_hal_buffer_binding_table_empty());
+      }
+    }
+    if (iree_status_is_ok(status)) {
+      // Signals and resource release happen asynchronously as the stream
+      // executes; we return as soon as the work is enqueued.
+      status =
+          iree_hal_rocm_device_enqueue_completion(device, queue, &batches[i]);
+    }
+    iree_slim_mutex_unlock(&queue->mutex);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_hal_rocm_device_queue_barrier(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list) {
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = wait_semaphore_list;
+  batch.signal_semaphores = signal_semaphore_list;
+  return iree_hal_rocm_device_queue_submit(
+      base_device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity, 1, &batch);
+}
+
+// Device-local allocations are made in stream order with hipMallocAsync when
+// async allocations are enabled and supported: the allocation is enqueued on
+// the queue stream after the waits and the signals are enqueued after it such
+// that no host synchronization is required. All other allocations come from
+// the transient buffer pool whose allocations are reused once the semaphores
+// signaled by their deallocation have been reached or are waited on by the
+// allocation reusing them.
+static iree_status_t iree_hal_rocm_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
+
+  if (iree_hal_rocm_allocator_supports_async(device->device_allocator,
+                                             &params)) {
+    iree_hal_rocm_device_queue_t* queue = iree_hal_rocm_device_select_queue(
+        device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity);
+    iree_hal_rocm_device_reclaim_submissions(device);
+    IREE_RETURN_IF_ERROR(iree_hal_rocm_device_wait_for_batch(
+        device, queue, &wait_semaphore_list));
+    iree_hal_submission_batch_t batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.signal_semaphores = signal_semaphore_list;
+    iree_hal_buffer_t* buffer = NULL;
+    iree_slim_mutex_lock(&queue->mutex);
+    iree_status_t status = iree_hal_rocm_allocator_alloc_async(
+        device->device_allocator, queue->stream, &params, allocation_size,
+        &buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_rocm_device_enqueue_completion(device, queue, &batch);
+    }
+    iree_slim_mutex_unlock(&queue->mutex);
+    if (iree_status_is_ok(status)) {
+      *out_buffer = buffer;
+    } else {
+      iree_hal_buffer_release(buffer);
+    }
+    return status;
+  }
+
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_transient_buffer_pool_acquire(
+      device->transient_pool, params, allocation_size, wait_semaphore_list,
+      &buffer));
+  iree_status_t status = iree_hal_rocm_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+static iree_status_t iree_hal_rocm_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
+
+  if (iree_hal_rocm_buffer_type(buffer) == IREE_HAL_ROCM_BUFFER_TYPE_ASYNC) {
+    // The memory is freed in stream order after the waits and may be reused
+    // by any subsequent allocation on the stream.
+    iree_hal_rocm_device_queue_t* queue = iree_hal_rocm_device_select_queue(
+        device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity);
+    iree_hal_rocm_device_reclaim_submissions(device);
+    IREE_RETURN_IF_ERROR(iree_hal_rocm_device_wait_for_batch(
+        device, queue, &wait_semaphore_list));
+    iree_hal_submission_batch_t batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.signal_semaphores = signal_semaphore_list;
+    iree_slim_mutex_lock(&queue->mutex);
+    iree_status_t status = iree_hal_rocm_allocator_free_async(
+        device->device_allocator, queue->stream, buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_rocm_device_enqueue_completion(device, queue, &batch);
+    }
+    iree_slim_mutex_unlock(&queue->mutex);
+    return status;
+  }
+
+  IREE_RETURN_IF_ERROR(iree_hal_rocm_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list));
+  // The storage may still be in use by work on the stream until the barrier
+  // signals.
+  return iree_hal_transient_buffer_pool_release(device->transient_pool, buffer,
+                                                signal_semaphore_list);
 }
 
 static iree_status_t iree_hal_rocm_device_submit_and_wait(
@@ -288,19 +748,38 @@ static iree_status_t iree_hal_rocm_device_submit_and_wait(
 static iree_status_t iree_hal_rocm_device_wait_semaphores(
     iree_hal_device_t* base_device, iree_hal_wait_mode_t wait_mode,
     const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
-  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                          "semaphore not implemented");
+  iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
+  iree_status_t status = iree_hal_rocm_semaphore_multi_wait(
+      &device->semaphore_state, wait_mode, semaphore_list, timeout);
+  iree_hal_rocm_device_reclaim_submissions(device);
+  return status;
 }
 
 static iree_status_t iree_hal_rocm_device_wait_idle(
     iree_hal_device_t* base_device, iree_timeout_t timeout) {
   iree_hal_rocm_device_t* device = iree_hal_rocm_device_cast(base_device);
-  // Wait until the stream is done.
+  // Wait until all streams are done.
   // TODO(thomasraoux): HIP doesn't support a deadline for wait, figure out how
   // to handle it better.
-  ROCM_RETURN_IF_ERROR(device->context_wrapper.syms,
-                       hipStreamSynchronize(device->stream),
-                       "hipStreamSynchronize");
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    ROCM_RETURN_IF_ERROR(device->context_wrapper.syms,
+                         hipStreamSynchronize(device->queues[i].stream),
+                         "hipStreamSynchronize");
+  }
+  iree_hal_rocm_device_reclaim_submissions(device);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  // Unimplemented (and that's ok).
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_rocm_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  // Unimplemented (and that's ok).
   return iree_ok_status();
 }
 
@@ -309,6 +788,7 @@ static const iree_hal_device_vtable_t iree_hal_rocm_device_vtable = {
     .id = iree_hal_rocm_device_id,
     .host_allocator = iree_hal_rocm_device_host_allocator,
     .device_allocator = iree_hal_rocm_device_allocator,
+    .replace_device_allocator = iree_hal_rocm_device_replace_allocator,
     .trim = iree_hal_rocm_device_trim,
     .query_i64 = iree_hal_rocm_device_query_i64,
     .create_command_buffer = iree_hal_rocm_device_create_command_buffer,
@@ -322,8 +802,12 @@ static const iree_hal_device_vtable_t iree_hal_rocm_device_vtable = {
     .query_semaphore_compatibility =
         iree_hal_rocm_device_query_semaphore_compatibility,
     .transfer_range = iree_hal_device_submit_transfer_range_and_wait,
+    .queue_alloca = iree_hal_rocm_device_queue_alloca,
+    .queue_dealloca = iree_hal_rocm_device_queue_dealloca,
     .queue_submit = iree_hal_rocm_device_queue_submit,
     .submit_and_wait = iree_hal_rocm_device_submit_and_wait,
     .wait_semaphores = iree_hal_rocm_device_wait_semaphores,
     .wait_idle = iree_hal_rocm_device_wait_idle,
+    .profiling_begin = iree_hal_rocm_device_profiling_begin,
+    .profiling_end = iree_hal_rocm_device_profiling_end,
 };
@@ -0,0 +1,32 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/webgpu/api.h"
+#include "iree/hal/api.h"
+
+// Creates a WebGPU device using the GPUDevice the worker script requested and
+// stored on `Module.preinitializedWebGPUDevice` before startup.
+//
+// Despite the name programs are not loaded through a wasm loader: they must be
+// compiled for WebGPU, such as with `--iree-hal-target-backends=webgpu`.
+iree_status_t create_device_with_wasm_loader(iree_allocator_t host_allocator,
+                                             iree_hal_device_t** out_device) {
+  iree_hal_webgpu_driver_options_t driver_options;
+  iree_hal_webgpu_driver_options_initialize(&driver_options);
+
+  iree_hal_driver_t* driver = NULL;
+  iree_status_t status = iree_hal_webgpu_driver_create(
+      iree_make_cstring_view("webgpu"), &driver_options, host_allocator,
+      &driver);
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_driver_create_default_device(driver, host_allocator,
+                                                   out_device);
+  }
+
+  iree_hal_driver_release(driver);
+  return status;
+}
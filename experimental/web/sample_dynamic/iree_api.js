@@ -26,7 +26,11 @@ function _handleMessageFromWorker(messageEvent) {
   const {messageType, id, payload, error} = messageEvent.data;
 
   if (messageType == 'initialized') {
-    pendingPromises['initialize']['resolve']();
+    if (error !== undefined) {
+      pendingPromises['initialize']['reject'](error);
+    } else {
+      pendingPromises['initialize']['resolve']();
+    }
     delete pendingPromises['initialize'];
   } else if (messageType == 'callResult') {
     if (error !== undefined) {
@@ -55,15 +59,22 @@ function _callIntoWorker(baseMessage) {
 
 // Initializes IREE's web worker asynchronously.
 //
+// |backend| selects the HAL device programs run on:
+//   * 'wasm' (default): the CPU, using programs compiled with
+//       --iree-hal-target-backends=llvm
+//   * 'webgpu': the GPU through WebGPU, using programs compiled with
+//       --iree-hal-target-backends=webgpu
+//
 // Resolves with no return value when the worker is fully initialized.
-function ireeInitializeWorker() {
+function ireeInitializeWorker(backend) {
   return new Promise((resolve, reject) => {
     pendingPromises['initialize'] = {
       'resolve': resolve,
       'reject': reject,
     };
 
-    ireeWorker = new Worker('iree_worker.js', {name: 'IREE-main'});
+    const workerUrl = 'iree_worker.js?backend=' + (backend || 'wasm');
+    ireeWorker = new Worker(workerUrl, {name: 'IREE-main'});
     ireeWorker.onmessage = _handleMessageFromWorker;
   });
 }
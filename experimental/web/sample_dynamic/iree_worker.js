@@ -4,9 +4,14 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+// The backend is chosen by ireeInitializeWorker() via the worker URL.
+const BACKEND =
+    new URLSearchParams(self.location.search).get('backend') || 'wasm';
+
 // TODO(scotttodd): configure this through the build system / scripts?
 // const MAIN_SCRIPT_URL = 'web-sample-dynamic-multithreaded.js';
-const MAIN_SCRIPT_URL = 'web-sample-dynamic-sync.js';
+const MAIN_SCRIPT_URL = BACKEND === 'webgpu' ? 'web-sample-dynamic-webgpu.js' :
+                                               'web-sample-dynamic-sync.js';
 
 let wasmSetupSampleFn;
 let wasmCleanupSampleFn;
@@ -31,8 +36,11 @@ var Module = {
         Module.cwrap('load_program', 'number', ['number', 'number', 'number']);
     wasmInspectProgramFn = Module.cwrap('inspect_program', null, ['number']);
     wasmUnloadProgramFn = Module.cwrap('unload_program', null, ['number']);
+    // WebGPU builds use Asyncify to wait on buffer readback, so calls into
+    // the program return Promises there.
     wasmCallFunctionFn = Module.cwrap(
-        'call_function', 'string', ['number', 'string', 'string', 'number']);
+        'call_function', 'string', ['number', 'string', 'string', 'number'],
+        {async: BACKEND === 'webgpu'});
 
     sampleState = wasmSetupSampleFn();
 
@@ -120,9 +128,13 @@ function callFunction(id, functionParams) {
     return;
   }
 
-  const returnValue =
-      wasmCallFunctionFn(programState, functionName, inputsJoined, iterations);
+  Promise
+      .resolve(wasmCallFunctionFn(
+          programState, functionName, inputsJoined, iterations))
+      .then((returnValue) => postCallFunctionResult(id, returnValue));
+}
 
+function postCallFunctionResult(id, returnValue) {
   if (returnValue === '') {
     postMessage({
       'messageType': 'callResult',
@@ -157,4 +169,28 @@ self.onmessage = function(messageEvent) {
   }
 };
 
-importScripts(MAIN_SCRIPT_URL);
+if (BACKEND === 'webgpu') {
+  // The device must be requested asynchronously before the runtime starts;
+  // the WebGPU HAL driver picks it up via emscripten_webgpu_get_device().
+  if (!navigator.gpu) {
+    postMessage({
+      'messageType': 'initialized',
+      'error': 'WebGPU is not supported by this browser',
+    });
+  } else {
+    navigator.gpu.requestAdapter()
+        .then((adapter) => adapter.requestDevice())
+        .then((device) => {
+          Module.preinitializedWebGPUDevice = device;
+          importScripts(MAIN_SCRIPT_URL);
+        })
+        .catch((error) => {
+          postMessage({
+            'messageType': 'initialized',
+            'error': 'Failed to create a WebGPU device: ' + error,
+          });
+        });
+  }
+} else {
+  importScripts(MAIN_SCRIPT_URL);
+}
@@ -11,6 +11,13 @@
 #include "iree/task/api.h"
 #include "mnist_static.h"
 
+// Upper bound on the worker count. Each worker is a Web Worker with its own
+// stack in the shared WebAssembly.Memory, and past a handful of workers small
+// models stop scaling.
+#if !defined(IREE_WEB_SAMPLE_MAX_WORKER_COUNT)
+#define IREE_WEB_SAMPLE_MAX_WORKER_COUNT 8
+#endif  // !IREE_WEB_SAMPLE_MAX_WORKER_COUNT
+
 iree_status_t create_device_with_static_loader(iree_allocator_t host_allocator,
                                                iree_hal_device_t** out_device) {
   iree_hal_task_device_params_t params;
@@ -28,20 +35,23 @@ iree_status_t create_device_with_static_loader(iree_allocator_t host_allocator,
 
   // Create a task executor.
   iree_task_executor_t* executor = NULL;
-  iree_task_scheduling_mode_t scheduling_mode = 0;
-  iree_host_size_t worker_local_memory = 0;
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
   iree_task_topology_t topology;
   iree_task_topology_initialize(&topology);
-  iree_task_topology_initialize_from_group_count(
-      /*group_count=*/4, &topology);
-  // Note: threads increase memory usage. If using a high thread count, consider
-  // passing in a larger WebAssembly.Memory object, increasing Emscripten's
-  // INITIAL_MEMORY, or setting Emscripten's ALLOW_MEMORY_GROWTH.
-  // iree_task_topology_initialize_from_group_count(
-  //     /*group_count=*/emscripten_num_logical_cores(), &topology);
+  // One worker per logical core (navigator.hardwareConcurrency).
+  // Note: threads increase memory usage. The sample is linked with
+  // ALLOW_MEMORY_GROWTH; when raising the worker count limit consider also
+  // passing in a larger WebAssembly.Memory object or increasing Emscripten's
+  // INITIAL_MEMORY.
+  int group_count = emscripten_num_logical_cores();
+  if (group_count < 1) group_count = 1;
+  if (group_count > IREE_WEB_SAMPLE_MAX_WORKER_COUNT) {
+    group_count = IREE_WEB_SAMPLE_MAX_WORKER_COUNT;
+  }
+  iree_task_topology_initialize_from_group_count(group_count, &topology);
   if (iree_status_is_ok(status)) {
-    status = iree_task_executor_create(scheduling_mode, &topology,
-                                       worker_local_memory, host_allocator,
+    status = iree_task_executor_create(options, &topology, host_allocator,
                                        &executor);
   }
   iree_task_topology_deinitialize(&topology);
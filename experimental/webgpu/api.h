@@ -0,0 +1,91 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// See iree/base/api.h for documentation on the API conventions used.
+
+#ifndef IREE_HAL_WEBGPU_API_H_
+#define IREE_HAL_WEBGPU_API_H_
+
+#include <webgpu/webgpu.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_webgpu_device_t
+//===----------------------------------------------------------------------===//
+
+// Parameters configuring an iree_hal_webgpu_device_t.
+// Must be initialized with iree_hal_webgpu_device_params_initialize prior to
+// use.
+typedef struct iree_hal_webgpu_device_params_t {
+  // Total size of each block in the device shared block pool used for
+  // recording command buffers.
+  // Larger sizes will lower overhead and ensure the heap isn't hit for
+  // transient allocations while also increasing memory consumption.
+  iree_host_size_t arena_block_size;
+
+  // Size, in bytes, of each buffer in the staging buffer pool used for
+  // reading back device buffers with mapAsync. Transfers larger than this
+  // use a dedicated staging buffer that is released once the transfer
+  // completes.
+  iree_device_size_t staging_buffer_size;
+
+  // Maximum number of staging buffers kept alive for reuse. Readbacks reuse a
+  // pooled buffer instead of creating (and destroying) a new GPUBuffer each
+  // time.
+  iree_host_size_t staging_buffer_capacity;
+} iree_hal_webgpu_device_params_t;
+
+// Initializes |out_params| to default values.
+IREE_API_EXPORT void iree_hal_webgpu_device_params_initialize(
+    iree_hal_webgpu_device_params_t* out_params);
+
+// Wraps an existing |handle| WGPUDevice, such as one acquired from the
+// browser with navigator.gpu.requestAdapter().requestDevice(), in a HAL
+// device. The device retains a reference to |handle| (wgpuDeviceReference)
+// for its lifetime.
+//
+// |out_device| must be released by the caller (see iree_hal_device_release).
+IREE_API_EXPORT iree_status_t iree_hal_webgpu_wrap_device(
+    iree_string_view_t identifier,
+    const iree_hal_webgpu_device_params_t* params, WGPUDevice handle,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device);
+
+//===----------------------------------------------------------------------===//
+// iree_hal_webgpu_driver_t
+//===----------------------------------------------------------------------===//
+
+// WebGPU driver creation options.
+typedef struct iree_hal_webgpu_driver_options_t {
+  // Parameters used for all devices created by the driver.
+  iree_hal_webgpu_device_params_t default_params;
+} iree_hal_webgpu_driver_options_t;
+
+IREE_API_EXPORT void iree_hal_webgpu_driver_options_initialize(
+    iree_hal_webgpu_driver_options_t* out_options);
+
+// Creates a WebGPU HAL driver exposing the platform default device.
+// On the web this is the device preinitialized by the hosting JavaScript
+// (Module.preinitializedWebGPUDevice, see emscripten_webgpu_get_device).
+// Native builds have no default device and must use
+// iree_hal_webgpu_wrap_device instead.
+//
+// |out_driver| must be released by the caller (see iree_hal_driver_release).
+IREE_API_EXPORT iree_status_t iree_hal_webgpu_driver_create(
+    iree_string_view_t identifier,
+    const iree_hal_webgpu_driver_options_t* options,
+    iree_allocator_t host_allocator, iree_hal_driver_t** out_driver);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_WEBGPU_API_H_
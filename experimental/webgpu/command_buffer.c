@@ -0,0 +1,551 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/webgpu/command_buffer.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "experimental/webgpu/descriptor_set_layout.h"
+#include "experimental/webgpu/executable.h"
+#include "experimental/webgpu/executable_layout.h"
+#include "experimental/webgpu/webgpu_buffer.h"
+#include "iree/base/api.h"
+#include "iree/base/tracing.h"
+
+typedef struct iree_hal_webgpu_command_buffer_t {
+  iree_hal_command_buffer_t base;
+  iree_allocator_t host_allocator;
+  WGPUDevice device;
+
+  // Encoder commands are recorded into; unowned.
+  WGPUCommandEncoder encoder;
+
+  // Compute pass that dispatches are recorded into, if one is open.
+  // Passes are kept open across dispatches and only ended when a transfer
+  // command (which must be recorded outside of a pass) or the end of the
+  // command buffer is reached.
+  WGPUComputePassEncoder compute_pass;
+
+  struct {
+    // Pipeline last set on |compute_pass|.
+    WGPUComputePipeline pipeline;
+    // Bind groups from push_descriptor_set; owned.
+    WGPUBindGroup bind_groups[IREE_HAL_WEBGPU_MAX_DESCRIPTOR_SET_COUNT];
+    // Bitmask of |bind_groups| that need to be set on |compute_pass|.
+    uint32_t bind_groups_dirty;
+  } state;
+} iree_hal_webgpu_command_buffer_t;
+
+static const iree_hal_command_buffer_vtable_t
+    iree_hal_webgpu_command_buffer_vtable;
+
+static iree_hal_webgpu_command_buffer_t* iree_hal_webgpu_command_buffer_cast(
+    iree_hal_command_buffer_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_webgpu_command_buffer_vtable);
+  return (iree_hal_webgpu_command_buffer_t*)base_value;
+}
+
+iree_status_t iree_hal_webgpu_command_buffer_create(
+    iree_hal_device_t* device, WGPUDevice handle,
+    iree_hal_command_category_t command_categories,
+    iree_allocator_t host_allocator,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(handle);
+  IREE_ASSERT_ARGUMENT(out_command_buffer);
+  *out_command_buffer = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_webgpu_command_buffer_t* command_buffer = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, sizeof(*command_buffer),
+                            (void**)&command_buffer);
+  if (iree_status_is_ok(status)) {
+    // Commands were validated when they were recorded into the deferred
+    // command buffer being replayed.
+    iree_hal_command_buffer_initialize(
+        device, IREE_HAL_COMMAND_BUFFER_MODE_UNVALIDATED, command_categories,
+        IREE_HAL_QUEUE_AFFINITY_ANY, /*binding_capacity=*/0,
+        &iree_hal_webgpu_command_buffer_vtable, &command_buffer->base);
+    command_buffer->host_allocator = host_allocator;
+    command_buffer->device = handle;
+    memset(&command_buffer->state, 0, sizeof(command_buffer->state));
+    *out_command_buffer = &command_buffer->base;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_webgpu_command_buffer_reset_state(
+    iree_hal_webgpu_command_buffer_t* command_buffer) {
+  for (iree_host_size_t i = 0;
+       i < IREE_ARRAYSIZE(command_buffer->state.bind_groups); ++i) {
+    if (command_buffer->state.bind_groups[i]) {
+      wgpuBindGroupRelease(command_buffer->state.bind_groups[i]);
+    }
+  }
+  memset(&command_buffer->state, 0, sizeof(command_buffer->state));
+}
+
+static void iree_hal_webgpu_command_buffer_destroy(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  iree_allocator_t host_allocator = command_buffer->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  if (command_buffer->compute_pass) {
+    wgpuComputePassEncoderRelease(command_buffer->compute_pass);
+  }
+  iree_hal_webgpu_command_buffer_reset_state(command_buffer);
+  iree_allocator_free(host_allocator, command_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+bool iree_hal_webgpu_command_buffer_isa(
+    iree_hal_command_buffer_t* command_buffer) {
+  return iree_hal_command_buffer_dyn_cast(
+      command_buffer, &iree_hal_webgpu_command_buffer_vtable);
+}
+
+void iree_hal_webgpu_command_buffer_set_encoder(
+    iree_hal_command_buffer_t* base_command_buffer,
+    WGPUCommandEncoder encoder) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  IREE_ASSERT(!command_buffer->compute_pass);
+  command_buffer->encoder = encoder;
+}
+
+static void* iree_hal_webgpu_command_buffer_dyn_cast(
+    iree_hal_command_buffer_t* command_buffer, const void* vtable) {
+  if (vtable == &iree_hal_webgpu_command_buffer_vtable) {
+    IREE_HAL_ASSERT_TYPE(command_buffer, vtable);
+    return command_buffer;
+  }
+  return NULL;
+}
+
+// Returns the open compute pass, beginning a new one if needed.
+static WGPUComputePassEncoder iree_hal_webgpu_command_buffer_acquire_pass(
+    iree_hal_webgpu_command_buffer_t* command_buffer) {
+  if (command_buffer->compute_pass) return command_buffer->compute_pass;
+  const WGPUComputePassDescriptor descriptor = {
+      .nextInChain = NULL,
+      .label = NULL,
+  };
+  command_buffer->compute_pass = wgpuCommandEncoderBeginComputePass(
+      command_buffer->encoder, &descriptor);
+  // State does not carry across passes.
+  command_buffer->state.pipeline = NULL;
+  for (iree_host_size_t i = 0;
+       i < IREE_ARRAYSIZE(command_buffer->state.bind_groups); ++i) {
+    if (command_buffer->state.bind_groups[i]) {
+      command_buffer->state.bind_groups_dirty |= 1u << i;
+    }
+  }
+  return command_buffer->compute_pass;
+}
+
+// Ends the open compute pass, if any, so that encoder commands can be
+// recorded.
+static void iree_hal_webgpu_command_buffer_flush_pass(
+    iree_hal_webgpu_command_buffer_t* command_buffer) {
+  if (!command_buffer->compute_pass) return;
+  wgpuComputePassEncoderEnd(command_buffer->compute_pass);
+  wgpuComputePassEncoderRelease(command_buffer->compute_pass);
+  command_buffer->compute_pass = NULL;
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_begin(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  if (!command_buffer->encoder) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "no encoder set on the command buffer");
+  }
+  iree_hal_webgpu_command_buffer_reset_state(command_buffer);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_end(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  iree_hal_webgpu_command_buffer_flush_pass(command_buffer);
+  iree_hal_webgpu_command_buffer_reset_state(command_buffer);
+  return iree_ok_status();
+}
+
+static void iree_hal_webgpu_command_buffer_begin_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer, iree_string_view_t label,
+    iree_hal_label_color_t label_color,
+    const iree_hal_label_location_t* location) {
+  // TODO: push debug groups on the pass or encoder; groups can't span the
+  // boundary between the two and we don't want to end passes for them.
+}
+
+static void iree_hal_webgpu_command_buffer_end_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer) {}
+
+static iree_status_t iree_hal_webgpu_command_buffer_execution_barrier(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_hal_execution_barrier_flags_t flags,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  // WebGPU tracks usage and inserts the required barriers between each
+  // dispatch and transfer itself.
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_signal_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  // No-op: WebGPU executes in order (see nop_event.h).
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_reset_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  // No-op: WebGPU executes in order (see nop_event.h).
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_wait_events(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_host_size_t event_count, const iree_hal_event_t** events,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  // No-op: WebGPU executes in order (see nop_event.h).
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_discard_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_buffer_t* buffer) {
+  return iree_ok_status();
+}
+
+// Returns a status if a transfer range is not 4-byte aligned as required by
+// WebGPU.
+static iree_status_t iree_hal_webgpu_validate_transfer_alignment(
+    iree_device_size_t offset, iree_device_size_t length) {
+  if (!iree_device_size_has_alignment(offset, 4) ||
+      !iree_device_size_has_alignment(length, 4)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "WebGPU transfers require 4-byte aligned offsets "
+                            "and lengths (offset=%" PRIdsz ", length=%" PRIdsz
+                            ")",
+                            offset, length);
+  }
+  return iree_ok_status();
+}
+
+// Records a copy of |length| bytes produced by |fill_fn| into |target_buffer|
+// using a temporary buffer that is mapped at creation. The temporary buffer
+// is released immediately and kept alive by the encoder until it executes.
+typedef void (*iree_hal_webgpu_fill_fn_t)(void* user_data, uint8_t* target,
+                                          iree_device_size_t length);
+static iree_status_t iree_hal_webgpu_command_buffer_upload(
+    iree_hal_webgpu_command_buffer_t* command_buffer,
+    iree_hal_webgpu_fill_fn_t fill_fn, void* user_data,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length) {
+  const WGPUBufferDescriptor descriptor = {
+      .nextInChain = NULL,
+      .label = NULL,
+      .usage = WGPUBufferUsage_CopySrc,
+      .size = length,
+      .mappedAtCreation = true,
+  };
+  WGPUBuffer upload_buffer =
+      wgpuDeviceCreateBuffer(command_buffer->device, &descriptor);
+  if (!upload_buffer) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "unable to allocate upload buffer of size %" PRIdsz,
+                            length);
+  }
+  fill_fn(user_data,
+          (uint8_t*)wgpuBufferGetMappedRange(upload_buffer, 0, (size_t)length),
+          length);
+  wgpuBufferUnmap(upload_buffer);
+
+  iree_hal_webgpu_command_buffer_flush_pass(command_buffer);
+  wgpuCommandEncoderCopyBufferToBuffer(
+      command_buffer->encoder, upload_buffer, 0,
+      iree_hal_webgpu_buffer_handle(target_buffer),
+      iree_hal_buffer_byte_offset(target_buffer) + target_offset, length);
+  wgpuBufferRelease(upload_buffer);
+  return iree_ok_status();
+}
+
+typedef struct iree_hal_webgpu_pattern_t {
+  const void* pattern;
+  iree_host_size_t pattern_length;
+} iree_hal_webgpu_pattern_t;
+
+static void iree_hal_webgpu_fill_pattern(void* user_data, uint8_t* target,
+                                         iree_device_size_t length) {
+  const iree_hal_webgpu_pattern_t* pattern =
+      (const iree_hal_webgpu_pattern_t*)user_data;
+  for (iree_device_size_t i = 0; i < length; i += pattern->pattern_length) {
+    memcpy(target + i, pattern->pattern, pattern->pattern_length);
+  }
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_fill_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length, const void* pattern,
+    iree_host_size_t pattern_length) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_webgpu_validate_transfer_alignment(target_offset, length));
+
+  // Zero fills are common (and cheap) enough to have their own command.
+  bool is_zero = true;
+  for (iree_host_size_t i = 0; i < pattern_length; ++i) {
+    if (((const uint8_t*)pattern)[i] != 0) {
+      is_zero = false;
+      break;
+    }
+  }
+  if (is_zero) {
+    iree_hal_webgpu_command_buffer_flush_pass(command_buffer);
+    wgpuCommandEncoderClearBuffer(
+        command_buffer->encoder, iree_hal_webgpu_buffer_handle(target_buffer),
+        iree_hal_buffer_byte_offset(target_buffer) + target_offset, length);
+    return iree_ok_status();
+  }
+
+  iree_hal_webgpu_pattern_t fill_pattern = {
+      .pattern = pattern,
+      .pattern_length = pattern_length,
+  };
+  return iree_hal_webgpu_command_buffer_upload(
+      command_buffer, iree_hal_webgpu_fill_pattern, &fill_pattern,
+      target_buffer, target_offset, length);
+}
+
+static void iree_hal_webgpu_fill_copy(void* user_data, uint8_t* target,
+                                      iree_device_size_t length) {
+  memcpy(target, user_data, (size_t)length);
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_update_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, const void* source_buffer,
+    iree_host_size_t source_offset, iree_hal_buffer_t* target_buffer,
+    iree_device_size_t target_offset, iree_device_size_t length) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_webgpu_validate_transfer_alignment(target_offset, length));
+  // NOTE: wgpuQueueWriteBuffer would be cheaper but executes before the
+  // command buffer and break ordering with the other commands.
+  return iree_hal_webgpu_command_buffer_upload(
+      command_buffer, iree_hal_webgpu_fill_copy,
+      (uint8_t*)source_buffer + source_offset, target_buffer, target_offset,
+      length);
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_copy_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* source_buffer, iree_device_size_t source_offset,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_webgpu_validate_transfer_alignment(source_offset, length));
+  IREE_RETURN_IF_ERROR(
+      iree_hal_webgpu_validate_transfer_alignment(target_offset, length));
+  iree_hal_webgpu_command_buffer_flush_pass(command_buffer);
+  wgpuCommandEncoderCopyBufferToBuffer(
+      command_buffer->encoder, iree_hal_webgpu_buffer_handle(source_buffer),
+      iree_hal_buffer_byte_offset(source_buffer) + source_offset,
+      iree_hal_webgpu_buffer_handle(target_buffer),
+      iree_hal_buffer_byte_offset(target_buffer) + target_offset, length);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_push_constants(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, iree_host_size_t offset,
+    const void* values, iree_host_size_t values_length) {
+  if (values_length == 0) return iree_ok_status();
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "WGSL does not support push constants");
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_push_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_binding_t* bindings) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  iree_hal_descriptor_set_layout_t* set_layout =
+      iree_hal_webgpu_executable_layout_set_layout(executable_layout, set);
+  if (!set_layout) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "descriptor set %u not in the executable layout",
+                            set);
+  }
+  if (binding_count > IREE_HAL_WEBGPU_MAX_DESCRIPTOR_SET_BINDING_COUNT) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "binding count %" PRIhsz " exceeds the limit of %d",
+                            binding_count,
+                            IREE_HAL_WEBGPU_MAX_DESCRIPTOR_SET_BINDING_COUNT);
+  }
+
+  WGPUBindGroupEntry entries[IREE_HAL_WEBGPU_MAX_DESCRIPTOR_SET_BINDING_COUNT];
+  memset(entries, 0, sizeof(entries));
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    iree_hal_buffer_t* buffer = bindings[i].buffer;
+    if (!buffer) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "binding %u has no buffer", bindings[i].binding);
+    }
+    iree_device_size_t length = bindings[i].length;
+    if (length == IREE_WHOLE_BUFFER) {
+      length = iree_hal_buffer_byte_length(buffer) - bindings[i].offset;
+    }
+    entries[i].binding = bindings[i].binding;
+    entries[i].buffer = iree_hal_webgpu_buffer_handle(buffer);
+    entries[i].offset =
+        iree_hal_buffer_byte_offset(buffer) + bindings[i].offset;
+    entries[i].size = length;
+  }
+  const WGPUBindGroupDescriptor descriptor = {
+      .nextInChain = NULL,
+      .label = NULL,
+      .layout = iree_hal_webgpu_descriptor_set_layout_handle(set_layout),
+      .entryCount = (uint32_t)binding_count,
+      .entries = entries,
+  };
+  WGPUBindGroup bind_group =
+      wgpuDeviceCreateBindGroup(command_buffer->device, &descriptor);
+  if (!bind_group) {
+    return iree_make_status(IREE_STATUS_INTERNAL,
+                            "wgpuDeviceCreateBindGroup failed");
+  }
+
+  if (command_buffer->state.bind_groups[set]) {
+    wgpuBindGroupRelease(command_buffer->state.bind_groups[set]);
+  }
+  command_buffer->state.bind_groups[set] = bind_group;
+  command_buffer->state.bind_groups_dirty |= 1u << set;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_bind_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_hal_descriptor_set_t* descriptor_set,
+    iree_host_size_t dynamic_offset_count,
+    const iree_device_size_t* dynamic_offsets) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "non-push descriptor sets still need work");
+}
+
+// Opens a compute pass (if needed) and binds the pipeline and descriptor sets
+// needed to dispatch |entry_point_ordinal| of |executable|.
+static iree_status_t iree_hal_webgpu_command_buffer_prepare_dispatch(
+    iree_hal_webgpu_command_buffer_t* command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point_ordinal,
+    WGPUComputePassEncoder* out_compute_pass) {
+  const iree_hal_webgpu_entry_point_t* entry_point = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_webgpu_executable_lookup_entry_point(
+      executable, entry_point_ordinal, &entry_point));
+
+  WGPUComputePassEncoder compute_pass =
+      iree_hal_webgpu_command_buffer_acquire_pass(command_buffer);
+  if (command_buffer->state.pipeline != entry_point->pipeline) {
+    wgpuComputePassEncoderSetPipeline(compute_pass, entry_point->pipeline);
+    command_buffer->state.pipeline = entry_point->pipeline;
+  }
+  iree_host_size_t set_count =
+      iree_hal_webgpu_executable_layout_set_count(entry_point->layout);
+  for (iree_host_size_t i = 0; i < set_count; ++i) {
+    if (!(command_buffer->state.bind_groups_dirty & (1u << i))) continue;
+    wgpuComputePassEncoderSetBindGroup(compute_pass, (uint32_t)i,
+                                       command_buffer->state.bind_groups[i],
+                                       /*dynamicOffsetCount=*/0,
+                                       /*dynamicOffsets=*/NULL);
+    command_buffer->state.bind_groups_dirty &= ~(1u << i);
+  }
+
+  *out_compute_pass = compute_pass;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_dispatch(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  WGPUComputePassEncoder compute_pass = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_webgpu_command_buffer_prepare_dispatch(
+      command_buffer, executable, entry_point, &compute_pass));
+  wgpuComputePassEncoderDispatchWorkgroups(compute_pass, workgroup_x,
+                                           workgroup_y, workgroup_z);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_command_buffer_dispatch_indirect(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    iree_hal_buffer_t* workgroups_buffer,
+    iree_device_size_t workgroups_offset) {
+  iree_hal_webgpu_command_buffer_t* command_buffer =
+      iree_hal_webgpu_command_buffer_cast(base_command_buffer);
+  WGPUComputePassEncoder compute_pass = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_webgpu_command_buffer_prepare_dispatch(
+      command_buffer, executable, entry_point, &compute_pass));
+  wgpuComputePassEncoderDispatchWorkgroupsIndirect(
+      compute_pass, iree_hal_webgpu_buffer_handle(workgroups_buffer),
+      iree_hal_buffer_byte_offset(workgroups_buffer) + workgroups_offset);
+  return iree_ok_status();
+}
+
+static const iree_hal_command_buffer_vtable_t
+    iree_hal_webgpu_command_buffer_vtable = {
+        .destroy = iree_hal_webgpu_command_buffer_destroy,
+        .dyn_cast = iree_hal_webgpu_command_buffer_dyn_cast,
+        .begin = iree_hal_webgpu_command_buffer_begin,
+        .end = iree_hal_webgpu_command_buffer_end,
+        .begin_debug_group = iree_hal_webgpu_command_buffer_begin_debug_group,
+        .end_debug_group = iree_hal_webgpu_command_buffer_end_debug_group,
+        .execution_barrier = iree_hal_webgpu_command_buffer_execution_barrier,
+        .signal_event = iree_hal_webgpu_command_buffer_signal_event,
+        .reset_event = iree_hal_webgpu_command_buffer_reset_event,
+        .wait_events = iree_hal_webgpu_command_buffer_wait_events,
+        .discard_buffer = iree_hal_webgpu_command_buffer_discard_buffer,
+        .fill_buffer = iree_hal_webgpu_command_buffer_fill_buffer,
+        .update_buffer = iree_hal_webgpu_command_buffer_update_buffer,
+        .copy_buffer = iree_hal_webgpu_command_buffer_copy_buffer,
+        .push_constants = iree_hal_webgpu_command_buffer_push_constants,
+        .push_descriptor_set =
+            iree_hal_webgpu_command_buffer_push_descriptor_set,
+        .bind_descriptor_set =
+            iree_hal_webgpu_command_buffer_bind_descriptor_set,
+        .dispatch = iree_hal_webgpu_command_buffer_dispatch,
+        .dispatch_indirect = iree_hal_webgpu_command_buffer_dispatch_indirect,
+};
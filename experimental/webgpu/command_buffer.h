@@ -0,0 +1,47 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_WEBGPU_COMMAND_BUFFER_H_
+#define IREE_HAL_WEBGPU_COMMAND_BUFFER_H_
+
+#include "experimental/webgpu/api.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Creates a command buffer that records directly into a GPUCommandEncoder
+// provided with iree_hal_webgpu_command_buffer_set_encoder.
+//
+// WebGPU command buffers can only be submitted once and the device instead
+// records HAL command buffers with the deferred command buffer and replays
+// them all through a single instance of this command buffer at submission
+// time. This lets every command buffer in a batch share one encoder (and one
+// wgpuQueueSubmit) and consecutive dispatches share one compute pass.
+iree_status_t iree_hal_webgpu_command_buffer_create(
+    iree_hal_device_t* device, WGPUDevice handle,
+    iree_hal_command_category_t command_categories,
+    iree_allocator_t host_allocator,
+    iree_hal_command_buffer_t** out_command_buffer);
+
+// Sets the |encoder| that commands are recorded into by subsequent
+// begin/end scopes of |command_buffer|. The encoder is not retained and must
+// remain valid until iree_hal_webgpu_command_buffer_set_encoder is called
+// again.
+void iree_hal_webgpu_command_buffer_set_encoder(
+    iree_hal_command_buffer_t* command_buffer, WGPUCommandEncoder encoder);
+
+// Returns true if |command_buffer| is a WebGPU command buffer.
+bool iree_hal_webgpu_command_buffer_isa(
+    iree_hal_command_buffer_t* command_buffer);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_WEBGPU_COMMAND_BUFFER_H_
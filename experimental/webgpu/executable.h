@@ -0,0 +1,39 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_WEBGPU_EXECUTABLE_H_
+#define IREE_HAL_WEBGPU_EXECUTABLE_H_
+
+#include "experimental/webgpu/api.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+typedef struct iree_hal_webgpu_entry_point_t {
+  WGPUComputePipeline pipeline;
+  // Retained executable layout the pipeline was created with.
+  iree_hal_executable_layout_t* layout;
+} iree_hal_webgpu_entry_point_t;
+
+// Creates an executable from a WGSL executable flatbuffer with one compute
+// pipeline per entry point.
+iree_status_t iree_hal_webgpu_executable_create(
+    WGPUDevice device, const iree_hal_executable_params_t* executable_params,
+    iree_allocator_t host_allocator, iree_hal_executable_t** out_executable);
+
+// Returns the entry point with the given |ordinal| in |executable|.
+iree_status_t iree_hal_webgpu_executable_lookup_entry_point(
+    iree_hal_executable_t* executable, int32_t ordinal,
+    const iree_hal_webgpu_entry_point_t** out_entry_point);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_WEBGPU_EXECUTABLE_H_
@@ -0,0 +1,195 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/webgpu/nop_semaphore.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+
+#include "iree/base/tracing.h"
+#include "iree/hal/utils/semaphore_base.h"
+
+// Sentinel used the semaphore has failed and an error status is set.
+#define IREE_HAL_WEBGPU_SEMAPHORE_FAILURE_VALUE UINT64_MAX
+
+typedef struct iree_hal_webgpu_nop_semaphore_t {
+  iree_hal_semaphore_t base;
+  iree_allocator_t host_allocator;
+
+  // Current signaled value. May be IREE_HAL_WEBGPU_SEMAPHORE_FAILURE_VALUE to
+  // indicate that the semaphore has been signaled for failure and
+  // |failure_status| contains the error.
+  uint64_t current_value;
+
+  // OK or the status passed to iree_hal_semaphore_fail. Owned by the semaphore.
+  iree_status_t failure_status;
+} iree_hal_webgpu_nop_semaphore_t;
+
+static const iree_hal_semaphore_vtable_t iree_hal_webgpu_nop_semaphore_vtable;
+
+static iree_hal_webgpu_nop_semaphore_t* iree_hal_webgpu_nop_semaphore_cast(
+    iree_hal_semaphore_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_webgpu_nop_semaphore_vtable);
+  return (iree_hal_webgpu_nop_semaphore_t*)base_value;
+}
+
+iree_status_t iree_hal_webgpu_nop_semaphore_create(
+    uint64_t initial_value, iree_allocator_t host_allocator,
+    iree_hal_semaphore_t** out_semaphore) {
+  IREE_ASSERT_ARGUMENT(out_semaphore);
+  *out_semaphore = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_webgpu_nop_semaphore_t* semaphore = NULL;
+  iree_status_t status = iree_allocator_malloc(
+      host_allocator, sizeof(*semaphore), (void**)&semaphore);
+  if (iree_status_is_ok(status)) {
+    iree_hal_semaphore_initialize(&iree_hal_webgpu_nop_semaphore_vtable,
+                                  &semaphore->base);
+    semaphore->host_allocator = host_allocator;
+    semaphore->current_value = initial_value;
+    semaphore->failure_status = iree_ok_status();
+    *out_semaphore = &semaphore->base;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_webgpu_nop_semaphore_destroy(
+    iree_hal_semaphore_t* base_semaphore) {
+  iree_hal_webgpu_nop_semaphore_t* semaphore =
+      iree_hal_webgpu_nop_semaphore_cast(base_semaphore);
+  iree_allocator_t host_allocator = semaphore->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_status_ignore(semaphore->failure_status);
+  iree_hal_semaphore_deinitialize(&semaphore->base);
+  iree_allocator_free(host_allocator, semaphore);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_status_t iree_hal_webgpu_nop_semaphore_query(
+    iree_hal_semaphore_t* base_semaphore, uint64_t* out_value) {
+  iree_hal_webgpu_nop_semaphore_t* semaphore =
+      iree_hal_webgpu_nop_semaphore_cast(base_semaphore);
+  *out_value = semaphore->current_value;
+  if (*out_value >= IREE_HAL_WEBGPU_SEMAPHORE_FAILURE_VALUE) {
+    return iree_status_clone(semaphore->failure_status);
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_nop_semaphore_signal(
+    iree_hal_semaphore_t* base_semaphore, uint64_t new_value) {
+  iree_hal_webgpu_nop_semaphore_t* semaphore =
+      iree_hal_webgpu_nop_semaphore_cast(base_semaphore);
+  if (new_value <= semaphore->current_value) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "semaphore values must be monotonically "
+                            "increasing; current_value=%" PRIu64
+                            ", new_value=%" PRIu64,
+                            semaphore->current_value, new_value);
+  }
+  semaphore->current_value = new_value;
+  iree_hal_semaphore_notify(&semaphore->base, new_value, IREE_STATUS_OK);
+  return iree_ok_status();
+}
+
+static void iree_hal_webgpu_nop_semaphore_fail(
+    iree_hal_semaphore_t* base_semaphore, iree_status_t status) {
+  iree_hal_webgpu_nop_semaphore_t* semaphore =
+      iree_hal_webgpu_nop_semaphore_cast(base_semaphore);
+  const iree_status_code_t status_code = iree_status_code(status);
+
+  // Only the first failure is preserved.
+  if (!iree_status_is_ok(semaphore->failure_status)) {
+    IREE_IGNORE_ERROR(status);
+    return;
+  }
+  semaphore->current_value = IREE_HAL_WEBGPU_SEMAPHORE_FAILURE_VALUE;
+  semaphore->failure_status = status;
+
+  iree_hal_semaphore_notify(&semaphore->base,
+                            IREE_HAL_WEBGPU_SEMAPHORE_FAILURE_VALUE,
+                            status_code);
+}
+
+// Returns OK if |semaphore| has reached |value|, DEADLINE_EXCEEDED if it has
+// not, and the failure status if it has failed.
+static iree_status_t iree_hal_webgpu_nop_semaphore_check(
+    iree_hal_webgpu_nop_semaphore_t* semaphore, uint64_t value) {
+  if (semaphore->current_value >= IREE_HAL_WEBGPU_SEMAPHORE_FAILURE_VALUE) {
+    return iree_status_clone(semaphore->failure_status);
+  } else if (semaphore->current_value >= value) {
+    return iree_ok_status();
+  }
+  return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+}
+
+static iree_status_t iree_hal_webgpu_nop_semaphore_wait(
+    iree_hal_semaphore_t* base_semaphore, uint64_t value,
+    iree_timeout_t timeout) {
+  iree_hal_webgpu_nop_semaphore_t* semaphore =
+      iree_hal_webgpu_nop_semaphore_cast(base_semaphore);
+  iree_status_t status = iree_hal_webgpu_nop_semaphore_check(semaphore, value);
+  if (iree_status_is_deadline_exceeded(status) &&
+      !iree_timeout_is_immediate(timeout)) {
+    // All work is signaled on submission; nothing will ever signal this.
+    return iree_make_status(
+        IREE_STATUS_FAILED_PRECONDITION,
+        "waiting on a semaphore value (%" PRIu64 ") that has not been "
+        "submitted (current %" PRIu64 ") would deadlock",
+        value, semaphore->current_value);
+  }
+  return status;
+}
+
+iree_status_t iree_hal_webgpu_nop_semaphore_multi_wait(
+    iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
+  if (semaphore_list->count == 0) return iree_ok_status();
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    iree_status_t status = iree_hal_webgpu_nop_semaphore_wait(
+        semaphore_list->semaphores[i], semaphore_list->payload_values[i],
+        wait_mode == IREE_HAL_WAIT_MODE_ANY ? iree_immediate_timeout()
+                                            : timeout);
+    if (wait_mode == IREE_HAL_WAIT_MODE_ANY) {
+      if (iree_status_is_ok(status)) return status;
+      if (!iree_status_is_deadline_exceeded(status)) return status;
+      iree_status_ignore(status);
+    } else if (!iree_status_is_ok(status)) {
+      return status;
+    }
+  }
+  if (wait_mode == IREE_HAL_WAIT_MODE_ANY) {
+    return iree_timeout_is_immediate(timeout)
+               ? iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED)
+               : iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                                  "waiting on semaphore values that have not "
+                                  "been submitted would deadlock");
+  }
+  return iree_ok_status();
+}
+
+iree_status_t iree_hal_webgpu_nop_semaphore_multi_signal(
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    IREE_RETURN_IF_ERROR(iree_hal_semaphore_signal(
+        semaphore_list->semaphores[i], semaphore_list->payload_values[i]));
+  }
+  return iree_ok_status();
+}
+
+static const iree_hal_semaphore_vtable_t iree_hal_webgpu_nop_semaphore_vtable =
+    {
+        .destroy = iree_hal_webgpu_nop_semaphore_destroy,
+        .query = iree_hal_webgpu_nop_semaphore_query,
+        .signal = iree_hal_webgpu_nop_semaphore_signal,
+        .fail = iree_hal_webgpu_nop_semaphore_fail,
+        .wait = iree_hal_webgpu_nop_semaphore_wait,
+};
@@ -0,0 +1,41 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_WEBGPU_NOP_SEMAPHORE_H_
+#define IREE_HAL_WEBGPU_NOP_SEMAPHORE_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Creates a host-side timeline semaphore.
+//
+// WebGPU has a single in-order queue and no way to observe progress other
+// than mapping buffers. Semaphores are signaled when the work is submitted to
+// the queue and anything the host reads back waits for the queue through
+// mapAsync. Waiting on a value that has not been signaled can never succeed
+// as there is nothing else that could signal it.
+iree_status_t iree_hal_webgpu_nop_semaphore_create(
+    uint64_t initial_value, iree_allocator_t host_allocator,
+    iree_hal_semaphore_t** out_semaphore);
+
+// Waits for all (or any) of |semaphore_list| to reach their payload values.
+iree_status_t iree_hal_webgpu_nop_semaphore_multi_wait(
+    iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout);
+
+// Signals all of |semaphore_list| to their payload values.
+iree_status_t iree_hal_webgpu_nop_semaphore_multi_signal(
+    const iree_hal_semaphore_list_t* semaphore_list);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_WEBGPU_NOP_SEMAPHORE_H_
@@ -0,0 +1,186 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/webgpu/staging_buffer_pool.h"
+
+#include <string.h>
+
+#include "iree/base/api.h"
+#include "iree/base/tracing.h"
+
+#if defined(__EMSCRIPTEN__)
+#include <emscripten.h>
+#endif  // __EMSCRIPTEN__
+
+iree_status_t iree_hal_webgpu_staging_buffer_pool_initialize(
+    WGPUDevice device, iree_device_size_t buffer_size,
+    iree_host_size_t capacity, iree_allocator_t host_allocator,
+    iree_hal_webgpu_staging_buffer_pool_t* out_pool) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(out_pool);
+  memset(out_pool, 0, sizeof(*out_pool));
+  out_pool->device = device;
+  out_pool->host_allocator = host_allocator;
+  out_pool->buffer_size = iree_device_align(buffer_size, 4);
+  out_pool->capacity = capacity;
+  if (!capacity) return iree_ok_status();
+  return iree_allocator_malloc(host_allocator,
+                               capacity * sizeof(out_pool->buffers[0]),
+                               (void**)&out_pool->buffers);
+}
+
+void iree_hal_webgpu_staging_buffer_pool_deinitialize(
+    iree_hal_webgpu_staging_buffer_pool_t* pool) {
+  iree_hal_webgpu_staging_buffer_pool_trim(pool);
+  iree_allocator_free(pool->host_allocator, pool->buffers);
+  memset(pool, 0, sizeof(*pool));
+}
+
+static void iree_hal_webgpu_staging_buffer_destroy(WGPUBuffer buffer) {
+  wgpuBufferDestroy(buffer);
+  wgpuBufferRelease(buffer);
+}
+
+void iree_hal_webgpu_staging_buffer_pool_trim(
+    iree_hal_webgpu_staging_buffer_pool_t* pool) {
+  for (iree_host_size_t i = 0; i < pool->count; ++i) {
+    iree_hal_webgpu_staging_buffer_destroy(pool->buffers[i]);
+  }
+  pool->count = 0;
+}
+
+iree_status_t iree_hal_webgpu_staging_buffer_pool_acquire(
+    iree_hal_webgpu_staging_buffer_pool_t* pool,
+    iree_device_size_t minimum_size, WGPUBuffer* out_buffer) {
+  *out_buffer = NULL;
+  bool is_pooled = minimum_size <= pool->buffer_size && pool->capacity > 0;
+  if (is_pooled && pool->count > 0) {
+    *out_buffer = pool->buffers[--pool->count];
+    return iree_ok_status();
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  const WGPUBufferDescriptor descriptor = {
+      .nextInChain = NULL,
+      .label = NULL,
+      .usage = WGPUBufferUsage_MapRead | WGPUBufferUsage_CopyDst,
+      .size = is_pooled ? pool->buffer_size
+                        : iree_device_align(minimum_size, 4),
+      .mappedAtCreation = false,
+  };
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, descriptor.size);
+  *out_buffer = wgpuDeviceCreateBuffer(pool->device, &descriptor);
+  IREE_TRACE_ZONE_END(z0);
+  if (!*out_buffer) {
+    return iree_make_status(
+        IREE_STATUS_RESOURCE_EXHAUSTED,
+        "unable to allocate staging buffer of size %" PRIdsz,
+        (iree_device_size_t)descriptor.size);
+  }
+  return iree_ok_status();
+}
+
+void iree_hal_webgpu_staging_buffer_pool_release(
+    iree_hal_webgpu_staging_buffer_pool_t* pool,
+    iree_device_size_t minimum_size, WGPUBuffer buffer) {
+  if (minimum_size <= pool->buffer_size && pool->count < pool->capacity) {
+    pool->buffers[pool->count++] = buffer;
+  } else {
+    iree_hal_webgpu_staging_buffer_destroy(buffer);
+  }
+}
+
+// Returns control to the implementation so that pending callbacks can run.
+static void iree_hal_webgpu_poll(WGPUDevice device) {
+#if defined(__EMSCRIPTEN__)
+  // Yields to the browser event loop (requires ASYNCIFY).
+  emscripten_sleep(0);
+#else
+  wgpuDeviceTick(device);
+#endif  // __EMSCRIPTEN__
+}
+
+typedef struct iree_hal_webgpu_map_state_t {
+  bool is_done;
+  WGPUBufferMapAsyncStatus status;
+} iree_hal_webgpu_map_state_t;
+
+static void iree_hal_webgpu_map_callback(WGPUBufferMapAsyncStatus status,
+                                         void* user_data) {
+  iree_hal_webgpu_map_state_t* state = (iree_hal_webgpu_map_state_t*)user_data;
+  state->status = status;
+  state->is_done = true;
+}
+
+iree_status_t iree_hal_webgpu_map_buffer_for_read_sync(
+    WGPUDevice device, WGPUBuffer buffer, iree_device_size_t length,
+    const void** out_data) {
+  *out_data = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, length);
+
+  // Mapped ranges must be 4-byte aligned; staging buffers are allocated with
+  // their size rounded up so this never extends past the end.
+  size_t mapped_length = (size_t)iree_device_align(length, 4);
+  iree_hal_webgpu_map_state_t state = {
+      .is_done = false,
+      .status = WGPUBufferMapAsyncStatus_Unknown,
+  };
+  wgpuBufferMapAsync(buffer, WGPUMapMode_Read, 0, mapped_length,
+                     iree_hal_webgpu_map_callback, &state);
+  while (!state.is_done) {
+    iree_hal_webgpu_poll(device);
+  }
+
+  iree_status_t status = iree_ok_status();
+  if (state.status == WGPUBufferMapAsyncStatus_Success) {
+    *out_data = wgpuBufferGetConstMappedRange(buffer, 0, mapped_length);
+    if (!*out_data) {
+      status = iree_make_status(IREE_STATUS_INTERNAL,
+                                "mapped staging buffer has no contents");
+    }
+  } else {
+    status = iree_make_status(IREE_STATUS_UNAVAILABLE,
+                              "failed to map staging buffer (%d)",
+                              (int)state.status);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+typedef struct iree_hal_webgpu_work_done_state_t {
+  bool is_done;
+  WGPUQueueWorkDoneStatus status;
+} iree_hal_webgpu_work_done_state_t;
+
+static void iree_hal_webgpu_work_done_callback(WGPUQueueWorkDoneStatus status,
+                                               void* user_data) {
+  iree_hal_webgpu_work_done_state_t* state =
+      (iree_hal_webgpu_work_done_state_t*)user_data;
+  state->status = status;
+  state->is_done = true;
+}
+
+iree_status_t iree_hal_webgpu_wait_for_queue_idle_sync(WGPUDevice device,
+                                                       WGPUQueue queue) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_webgpu_work_done_state_t state = {
+      .is_done = false,
+      .status = WGPUQueueWorkDoneStatus_Unknown,
+  };
+  wgpuQueueOnSubmittedWorkDone(queue, /*signalValue=*/0,
+                               iree_hal_webgpu_work_done_callback, &state);
+  while (!state.is_done) {
+    iree_hal_webgpu_poll(device);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  if (state.status != WGPUQueueWorkDoneStatus_Success) {
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "failed to wait for queue work (%d)",
+                            (int)state.status);
+  }
+  return iree_ok_status();
+}
@@ -0,0 +1,88 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_WEBGPU_STAGING_BUFFER_POOL_H_
+#define IREE_HAL_WEBGPU_STAGING_BUFFER_POOL_H_
+
+#include "experimental/webgpu/api.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// A pool of MapRead|CopyDst buffers used to read back device buffers.
+//
+// WebGPU only allows mapping buffers that have no other usage than copies and
+// reading any storage buffer requires a copy into one of these followed by a
+// mapAsync. Creating one per readback churns the GPU process and the
+// JavaScript garbage collector so buffers of the pool size are kept around
+// and reused. Larger requests get a dedicated buffer that is destroyed on
+// release.
+//
+// Thread-compatible: WebGPU devices are used from a single thread.
+typedef struct iree_hal_webgpu_staging_buffer_pool_t {
+  WGPUDevice device;
+  iree_allocator_t host_allocator;
+  // Size of each pooled buffer.
+  iree_device_size_t buffer_size;
+  // Maximum number of buffers retained in |buffers|.
+  iree_host_size_t capacity;
+  // Number of free buffers in |buffers|.
+  iree_host_size_t count;
+  WGPUBuffer* buffers;
+} iree_hal_webgpu_staging_buffer_pool_t;
+
+// Initializes |out_pool| creating buffers of |buffer_size| from |device| on
+// demand and retaining up to |capacity| of them.
+iree_status_t iree_hal_webgpu_staging_buffer_pool_initialize(
+    WGPUDevice device, iree_device_size_t buffer_size,
+    iree_host_size_t capacity, iree_allocator_t host_allocator,
+    iree_hal_webgpu_staging_buffer_pool_t* out_pool);
+
+// Destroys all buffers in the pool. All acquired buffers must have been
+// released.
+void iree_hal_webgpu_staging_buffer_pool_deinitialize(
+    iree_hal_webgpu_staging_buffer_pool_t* pool);
+
+// Destroys all free buffers retained by the pool.
+void iree_hal_webgpu_staging_buffer_pool_trim(
+    iree_hal_webgpu_staging_buffer_pool_t* pool);
+
+// Acquires an unmapped staging buffer of at least |minimum_size| bytes.
+// The buffer must be returned with iree_hal_webgpu_staging_buffer_pool_release
+// once it has been unmapped.
+iree_status_t iree_hal_webgpu_staging_buffer_pool_acquire(
+    iree_hal_webgpu_staging_buffer_pool_t* pool,
+    iree_device_size_t minimum_size, WGPUBuffer* out_buffer);
+
+// Returns |buffer| acquired with a |minimum_size| to the pool.
+void iree_hal_webgpu_staging_buffer_pool_release(
+    iree_hal_webgpu_staging_buffer_pool_t* pool,
+    iree_device_size_t minimum_size, WGPUBuffer buffer);
+
+// Maps |length| bytes of the staging |buffer| for reading and blocks the
+// calling thread until the mapping completes (and with it all work submitted
+// to the queue prior to the call).
+//
+// On the web this requires the program to be built with -sASYNCIFY so that
+// control can be returned to the browser event loop while waiting.
+iree_status_t iree_hal_webgpu_map_buffer_for_read_sync(
+    WGPUDevice device, WGPUBuffer buffer, iree_device_size_t length,
+    const void** out_data);
+
+// Blocks the calling thread until all work submitted to |queue| has
+// completed. Has the same ASYNCIFY requirement as
+// iree_hal_webgpu_map_buffer_for_read_sync.
+iree_status_t iree_hal_webgpu_wait_for_queue_idle_sync(WGPUDevice device,
+                                                       WGPUQueue queue);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_WEBGPU_STAGING_BUFFER_POOL_H_
@@ -0,0 +1,44 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_WEBGPU_BUFFER_H_
+#define IREE_HAL_WEBGPU_BUFFER_H_
+
+#include "experimental/webgpu/api.h"
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Wraps a WebGPU |handle| in a HAL buffer. The buffer takes ownership of the
+// handle and destroys it when released unless a |release_callback| is
+// provided, in which case the callback is responsible for it.
+//
+// WebGPU buffers cannot be persistently mapped while in use by the queue and
+// mapping is emulated with queue transfers through |device|.
+iree_status_t iree_hal_webgpu_buffer_wrap(
+    iree_hal_device_t* device, iree_hal_allocator_t* allocator,
+    iree_hal_memory_type_t memory_type, iree_hal_memory_access_t allowed_access,
+    iree_hal_buffer_usage_t allowed_usage, iree_device_size_t allocation_size,
+    iree_device_size_t byte_offset, iree_device_size_t byte_length,
+    WGPUBuffer handle, iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** out_buffer);
+
+// Returns true if |buffer| is backed by a WebGPU buffer.
+bool iree_hal_webgpu_buffer_isa(iree_hal_buffer_t* buffer);
+
+// Returns the WebGPU buffer backing the allocation of |buffer|.
+// The offset of |buffer| into the allocation must be added to any accesses of
+// the handle (see iree_hal_buffer_byte_offset).
+WGPUBuffer iree_hal_webgpu_buffer_handle(iree_hal_buffer_t* buffer);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_WEBGPU_BUFFER_H_
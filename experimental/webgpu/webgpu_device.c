@@ -0,0 +1,594 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "experimental/webgpu/webgpu_device.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "experimental/webgpu/command_buffer.h"
+#include "experimental/webgpu/descriptor_set_layout.h"
+#include "experimental/webgpu/executable_layout.h"
+#include "experimental/webgpu/nop_event.h"
+#include "experimental/webgpu/nop_executable_cache.h"
+#include "experimental/webgpu/nop_semaphore.h"
+#include "experimental/webgpu/staging_buffer_pool.h"
+#include "experimental/webgpu/webgpu_allocator.h"
+#include "experimental/webgpu/webgpu_buffer.h"
+#include "iree/base/internal/arena.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/utils/deferred_command_buffer.h"
+
+//===----------------------------------------------------------------------===//
+// iree_hal_webgpu_device_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_hal_webgpu_device_t {
+  iree_hal_resource_t resource;
+  iree_string_view_t identifier;
+
+  // Block pool used for command buffers with a larger block size (as command
+  // buffers can contain inlined data uploads).
+  iree_arena_block_pool_t block_pool;
+
+  iree_allocator_t host_allocator;
+  iree_hal_allocator_t* device_allocator;
+
+  WGPUDevice handle;
+  WGPUQueue queue;
+
+  // Pooled MapRead buffers used for reading back device buffers.
+  iree_hal_webgpu_staging_buffer_pool_t staging_buffer_pool;
+
+  // Command buffer all deferred command buffers are replayed through at
+  // submission time. Reused across submissions so that replay doesn't
+  // allocate.
+  iree_hal_command_buffer_t* replay_command_buffer;
+} iree_hal_webgpu_device_t;
+
+static const iree_hal_device_vtable_t iree_hal_webgpu_device_vtable;
+
+static iree_hal_webgpu_device_t* iree_hal_webgpu_device_cast(
+    iree_hal_device_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_webgpu_device_vtable);
+  return (iree_hal_webgpu_device_t*)base_value;
+}
+
+IREE_API_EXPORT void iree_hal_webgpu_device_params_initialize(
+    iree_hal_webgpu_device_params_t* out_params) {
+  memset(out_params, 0, sizeof(*out_params));
+  out_params->arena_block_size = 32 * 1024;
+  out_params->staging_buffer_size = 1 * 1024 * 1024;
+  out_params->staging_buffer_capacity = 4;
+}
+
+static iree_status_t iree_hal_webgpu_device_check_params(
+    const iree_hal_webgpu_device_params_t* params) {
+  if (params->arena_block_size < 4096) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "arena block size too small (< 4096 bytes)");
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_webgpu_wrap_device(
+    iree_string_view_t identifier,
+    const iree_hal_webgpu_device_params_t* params, WGPUDevice handle,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device) {
+  IREE_ASSERT_ARGUMENT(params);
+  IREE_ASSERT_ARGUMENT(handle);
+  IREE_ASSERT_ARGUMENT(out_device);
+  *out_device = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_webgpu_device_check_params(params));
+
+  iree_hal_webgpu_device_t* device = NULL;
+  iree_host_size_t total_size = sizeof(*device) + identifier.size;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, total_size, (void**)&device));
+  memset(device, 0, total_size);
+  iree_hal_resource_initialize(&iree_hal_webgpu_device_vtable,
+                               &device->resource);
+  iree_string_view_append_to_buffer(
+      identifier, &device->identifier,
+      (char*)device + total_size - identifier.size);
+  iree_arena_block_pool_initialize(params->arena_block_size, host_allocator,
+                                   &device->block_pool);
+  device->host_allocator = host_allocator;
+  device->handle = handle;
+  wgpuDeviceReference(handle);
+  device->queue = wgpuDeviceGetQueue(handle);
+
+  iree_status_t status = iree_hal_webgpu_staging_buffer_pool_initialize(
+      handle, params->staging_buffer_size, params->staging_buffer_capacity,
+      host_allocator, &device->staging_buffer_pool);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_webgpu_allocator_create((iree_hal_device_t*)device,
+                                              handle, host_allocator,
+                                              &device->device_allocator);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_webgpu_command_buffer_create(
+        (iree_hal_device_t*)device, handle, IREE_HAL_COMMAND_CATEGORY_ANY,
+        host_allocator, &device->replay_command_buffer);
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_device = (iree_hal_device_t*)device;
+  } else {
+    iree_hal_device_release((iree_hal_device_t*)device);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_webgpu_device_destroy(iree_hal_device_t* base_device) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  iree_allocator_t host_allocator = iree_hal_device_host_allocator(base_device);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_command_buffer_release(device->replay_command_buffer);
+  iree_hal_allocator_release(device->device_allocator);
+  if (device->staging_buffer_pool.device) {
+    iree_hal_webgpu_staging_buffer_pool_deinitialize(
+        &device->staging_buffer_pool);
+  }
+  iree_arena_block_pool_deinitialize(&device->block_pool);
+  if (device->queue) wgpuQueueRelease(device->queue);
+  wgpuDeviceRelease(device->handle);
+  iree_allocator_free(host_allocator, device);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+WGPUDevice iree_hal_webgpu_device_handle(iree_hal_device_t* base_device) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return device->handle;
+}
+
+static iree_string_view_t iree_hal_webgpu_device_id(
+    iree_hal_device_t* base_device) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return device->identifier;
+}
+
+static iree_allocator_t iree_hal_webgpu_device_host_allocator(
+    iree_hal_device_t* base_device) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return device->host_allocator;
+}
+
+static iree_hal_allocator_t* iree_hal_webgpu_device_allocator(
+    iree_hal_device_t* base_device) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return device->device_allocator;
+}
+
+static void iree_hal_webgpu_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
+static iree_status_t iree_hal_webgpu_device_trim(
+    iree_hal_device_t* base_device) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  iree_arena_block_pool_trim(&device->block_pool);
+  iree_hal_webgpu_staging_buffer_pool_trim(&device->staging_buffer_pool);
+  return iree_hal_allocator_trim(device->device_allocator);
+}
+
+static iree_status_t iree_hal_webgpu_device_query_i64(
+    iree_hal_device_t* base_device, iree_string_view_t category,
+    iree_string_view_t key, int64_t* out_value) {
+  *out_value = 0;
+
+  if (iree_string_view_equal(category,
+                             iree_make_cstring_view("hal.executable.format"))) {
+    *out_value =
+        iree_string_view_equal(key, iree_make_cstring_view("webgpu-wgsl-fb"))
+            ? 1
+            : 0;
+    return iree_ok_status();
+  } else if (iree_string_view_equal(category,
+                                    iree_make_cstring_view("hal.device"))) {
+    if (iree_string_view_equal(key, iree_make_cstring_view("concurrency"))) {
+      // WebGPU exposes a single queue.
+      *out_value = 1;
+      return iree_ok_status();
+    }
+  }
+
+  return iree_make_status(
+      IREE_STATUS_NOT_FOUND,
+      "unknown device configuration key value '%.*s :: %.*s'",
+      (int)category.size, category.data, (int)key.size, key.data);
+}
+
+static iree_status_t iree_hal_webgpu_device_create_command_buffer(
+    iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  // Recorded on the host and replayed into the shared encoder on submission;
+  // see iree_hal_webgpu_command_buffer_create.
+  return iree_hal_deferred_command_buffer_create(
+      base_device, mode, command_categories, binding_capacity,
+      &device->block_pool, device->host_allocator, out_command_buffer);
+}
+
+static iree_status_t iree_hal_webgpu_device_create_descriptor_set(
+    iree_hal_device_t* base_device,
+    iree_hal_descriptor_set_layout_t* set_layout,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_binding_t* bindings,
+    iree_hal_descriptor_set_t** out_descriptor_set) {
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "non-push descriptor sets still need work");
+}
+
+static iree_status_t iree_hal_webgpu_device_create_descriptor_set_layout(
+    iree_hal_device_t* base_device,
+    iree_hal_descriptor_set_layout_usage_type_t usage_type,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_layout_binding_t* bindings,
+    iree_hal_descriptor_set_layout_t** out_descriptor_set_layout) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return iree_hal_webgpu_descriptor_set_layout_create(
+      device->handle, usage_type, binding_count, bindings,
+      device->host_allocator, out_descriptor_set_layout);
+}
+
+static iree_status_t iree_hal_webgpu_device_create_event(
+    iree_hal_device_t* base_device, iree_hal_event_t** out_event) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return iree_hal_webgpu_nop_event_create(device->host_allocator, out_event);
+}
+
+static iree_status_t iree_hal_webgpu_device_create_executable_cache(
+    iree_hal_device_t* base_device, iree_string_view_t identifier,
+    iree_loop_t loop, iree_hal_executable_cache_t** out_executable_cache) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return iree_hal_webgpu_nop_executable_cache_create(
+      device->handle, identifier, device->host_allocator,
+      out_executable_cache);
+}
+
+static iree_status_t iree_hal_webgpu_device_create_executable_layout(
+    iree_hal_device_t* base_device, iree_host_size_t push_constants,
+    iree_host_size_t set_layout_count,
+    iree_hal_descriptor_set_layout_t** set_layouts,
+    iree_hal_executable_layout_t** out_executable_layout) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return iree_hal_webgpu_executable_layout_create(
+      device->handle, set_layout_count, set_layouts, push_constants,
+      device->host_allocator, out_executable_layout);
+}
+
+static iree_status_t iree_hal_webgpu_device_create_semaphore(
+    iree_hal_device_t* base_device, uint64_t initial_value,
+    iree_hal_semaphore_t** out_semaphore) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return iree_hal_webgpu_nop_semaphore_create(
+      initial_value, device->host_allocator, out_semaphore);
+}
+
+static iree_hal_semaphore_compatibility_t
+iree_hal_webgpu_device_query_semaphore_compatibility(
+    iree_hal_device_t* base_device, iree_hal_semaphore_t* semaphore) {
+  // Semaphores are signaled on the host as work is submitted.
+  return IREE_HAL_SEMAPHORE_COMPATIBILITY_HOST_ONLY;
+}
+
+// Finishes |encoder| and submits the resulting command buffer to the queue.
+// Always releases |encoder|.
+static iree_status_t iree_hal_webgpu_device_submit_encoder(
+    iree_hal_webgpu_device_t* device, WGPUCommandEncoder encoder) {
+  const WGPUCommandBufferDescriptor descriptor = {
+      .nextInChain = NULL,
+      .label = NULL,
+  };
+  WGPUCommandBuffer command_buffer =
+      wgpuCommandEncoderFinish(encoder, &descriptor);
+  wgpuCommandEncoderRelease(encoder);
+  if (!command_buffer) {
+    return iree_make_status(IREE_STATUS_INTERNAL,
+                            "wgpuCommandEncoderFinish failed");
+  }
+  wgpuQueueSubmit(device->queue, 1, &command_buffer);
+  wgpuCommandBufferRelease(command_buffer);
+  return iree_ok_status();
+}
+
+static WGPUCommandEncoder iree_hal_webgpu_device_create_encoder(
+    iree_hal_webgpu_device_t* device) {
+  const WGPUCommandEncoderDescriptor descriptor = {
+      .nextInChain = NULL,
+      .label = NULL,
+  };
+  return wgpuDeviceCreateCommandEncoder(device->handle, &descriptor);
+}
+
+// Reads |length| bytes of |source_buffer| at |source_offset| into
+// |target_data| by copying to a pooled staging buffer and mapping it.
+static iree_status_t iree_hal_webgpu_device_read_buffer(
+    iree_hal_webgpu_device_t* device, iree_hal_buffer_t* source_buffer,
+    iree_device_size_t source_offset, void* target_data,
+    iree_device_size_t length) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, length);
+
+  // Copies must be 4-byte aligned; read the enclosing aligned range and only
+  // return the requested bytes.
+  iree_device_size_t absolute_offset =
+      iree_hal_buffer_byte_offset(source_buffer) + source_offset;
+  iree_device_size_t aligned_offset = absolute_offset & ~(iree_device_size_t)3;
+  iree_device_size_t aligned_length =
+      iree_device_align(absolute_offset + length, 4) - aligned_offset;
+
+  WGPUBuffer staging_buffer = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_webgpu_staging_buffer_pool_acquire(
+              &device->staging_buffer_pool, aligned_length, &staging_buffer));
+
+  iree_status_t status = iree_ok_status();
+  WGPUCommandEncoder encoder = iree_hal_webgpu_device_create_encoder(device);
+  if (!encoder) {
+    status = iree_make_status(IREE_STATUS_INTERNAL,
+                              "wgpuDeviceCreateCommandEncoder failed");
+  }
+  if (iree_status_is_ok(status)) {
+    wgpuCommandEncoderCopyBufferToBuffer(
+        encoder, iree_hal_webgpu_buffer_handle(source_buffer), aligned_offset,
+        staging_buffer, 0, aligned_length);
+    status = iree_hal_webgpu_device_submit_encoder(device, encoder);
+  }
+  const void* mapped_data = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_webgpu_map_buffer_for_read_sync(
+        device->handle, staging_buffer, aligned_length, &mapped_data);
+  }
+  if (iree_status_is_ok(status)) {
+    memcpy(target_data,
+           (const uint8_t*)mapped_data + (absolute_offset - aligned_offset),
+           (size_t)length);
+    wgpuBufferUnmap(staging_buffer);
+  }
+  iree_hal_webgpu_staging_buffer_pool_release(&device->staging_buffer_pool,
+                                              aligned_length, staging_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_hal_webgpu_device_transfer_range(
+    iree_hal_device_t* base_device, iree_hal_transfer_buffer_t source,
+    iree_device_size_t source_offset, iree_hal_transfer_buffer_t target,
+    iree_device_size_t target_offset, iree_device_size_t data_length,
+    iree_hal_transfer_buffer_flags_t flags, iree_timeout_t timeout) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  if (data_length == 0) return iree_ok_status();
+
+  if (!source.device_buffer && target.device_buffer) {
+    // Host -> device: written through the queue in submission order.
+    iree_device_size_t offset =
+        iree_hal_buffer_byte_offset(target.device_buffer) + target_offset;
+    if (!iree_device_size_has_alignment(offset, 4) ||
+        !iree_device_size_has_alignment(data_length, 4)) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "WebGPU buffer writes require 4-byte aligned "
+                              "offsets and lengths");
+    }
+    wgpuQueueWriteBuffer(
+        device->queue, iree_hal_webgpu_buffer_handle(target.device_buffer),
+        offset, source.host_buffer.data + source_offset, (size_t)data_length);
+    return iree_ok_status();
+  } else if (source.device_buffer && !target.device_buffer) {
+    // Device -> host: staged through a pooled mappable buffer.
+    return iree_hal_webgpu_device_read_buffer(
+        device, source.device_buffer, source_offset,
+        target.host_buffer.data + target_offset, data_length);
+  } else if (source.device_buffer && target.device_buffer) {
+    // Device -> device: a copy submitted on its own.
+    WGPUCommandEncoder encoder = iree_hal_webgpu_device_create_encoder(device);
+    if (!encoder) {
+      return iree_make_status(IREE_STATUS_INTERNAL,
+                              "wgpuDeviceCreateCommandEncoder failed");
+    }
+    wgpuCommandEncoderCopyBufferToBuffer(
+        encoder, iree_hal_webgpu_buffer_handle(source.device_buffer),
+        iree_hal_buffer_byte_offset(source.device_buffer) + source_offset,
+        iree_hal_webgpu_buffer_handle(target.device_buffer),
+        iree_hal_buffer_byte_offset(target.device_buffer) + target_offset,
+        data_length);
+    return iree_hal_webgpu_device_submit_encoder(device, encoder);
+  }
+
+  // Host -> host.
+  memcpy(target.host_buffer.data + target_offset,
+         source.host_buffer.data + source_offset, (size_t)data_length);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_device_queue_submit(
+    iree_hal_device_t* base_device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
+    const iree_hal_submission_batch_t* batches) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // All batches are encoded into one encoder and submitted with a single
+  // wgpuQueueSubmit. The queue executes in order and semaphores are signaled
+  // on submission so this preserves the batch ordering.
+  WGPUCommandEncoder encoder = NULL;
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < batch_count && iree_status_is_ok(status);
+       ++i) {
+    const iree_hal_submission_batch_t* batch = &batches[i];
+    status = iree_hal_webgpu_nop_semaphore_multi_wait(
+        IREE_HAL_WAIT_MODE_ALL, &batch->wait_semaphores,
+        iree_infinite_timeout());
+    for (iree_host_size_t j = 0;
+         j < batch->command_buffer_count && iree_status_is_ok(status); ++j) {
+      if (!encoder) {
+        encoder = iree_hal_webgpu_device_create_encoder(device);
+        if (!encoder) {
+          status = iree_make_status(IREE_STATUS_INTERNAL,
+                                    "wgpuDeviceCreateCommandEncoder failed");
+          break;
+        }
+        iree_hal_webgpu_command_buffer_set_encoder(
+            device->replay_command_buffer, encoder);
+      }
+      status = iree_hal_deferred_command_buffer_apply(
+          batch->command_buffers[j], device->replay_command_buffer,
+          batch->binding_tables ? batch->binding_tables[j]
+                                : iree_hal_buffer_binding_table_empty());
+    }
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_webgpu_nop_semaphore_multi_signal(
+          &batch->signal_semaphores);
+    }
+  }
+
+  if (encoder) {
+    iree_hal_webgpu_command_buffer_set_encoder(device->replay_command_buffer,
+                                               NULL);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_webgpu_device_submit_encoder(device, encoder);
+    } else {
+      wgpuCommandEncoderRelease(encoder);
+    }
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Waits on |wait_semaphore_list| and then signals |signal_semaphore_list|.
+static iree_status_t iree_hal_webgpu_device_queue_barrier(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list) {
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = wait_semaphore_list;
+  batch.signal_semaphores = signal_semaphore_list;
+  return iree_hal_webgpu_device_queue_submit(
+      base_device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity, 1, &batch);
+}
+
+static iree_status_t iree_hal_webgpu_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  IREE_RETURN_IF_ERROR(iree_hal_webgpu_nop_semaphore_multi_wait(
+      IREE_HAL_WAIT_MODE_ALL, &wait_semaphore_list, iree_infinite_timeout()));
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
+      device->device_allocator, params, allocation_size,
+      iree_const_byte_span_empty(), &buffer));
+  iree_status_t status =
+      iree_hal_webgpu_nop_semaphore_multi_signal(&signal_semaphore_list);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+static iree_status_t iree_hal_webgpu_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  // The buffer is freed when its last reference is released; WebGPU keeps the
+  // underlying memory alive until queued work using it has completed.
+  return iree_hal_webgpu_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+}
+
+static iree_status_t iree_hal_webgpu_device_submit_and_wait(
+    iree_hal_device_t* base_device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
+    const iree_hal_submission_batch_t* batches,
+    iree_hal_semaphore_t* wait_semaphore, uint64_t wait_value,
+    iree_timeout_t timeout) {
+  // Submit...
+  IREE_RETURN_IF_ERROR(iree_hal_webgpu_device_queue_submit(
+      base_device, command_categories, queue_affinity, batch_count, batches));
+
+  // ...and wait.
+  return iree_hal_semaphore_wait(wait_semaphore, wait_value, timeout);
+}
+
+static iree_status_t iree_hal_webgpu_device_wait_semaphores(
+    iree_hal_device_t* base_device, iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
+  return iree_hal_webgpu_nop_semaphore_multi_wait(wait_mode, semaphore_list,
+                                                  timeout);
+}
+
+static iree_status_t iree_hal_webgpu_device_wait_idle(
+    iree_hal_device_t* base_device, iree_timeout_t timeout) {
+  iree_hal_webgpu_device_t* device = iree_hal_webgpu_device_cast(base_device);
+  return iree_hal_webgpu_wait_for_queue_idle_sync(device->handle,
+                                                  device->queue);
+}
+
+static iree_status_t iree_hal_webgpu_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  // Unimplemented (and that's ok).
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  // Unimplemented (and that's ok).
+  return iree_ok_status();
+}
+
+static const iree_hal_device_vtable_t iree_hal_webgpu_device_vtable = {
+    .destroy = iree_hal_webgpu_device_destroy,
+    .id = iree_hal_webgpu_device_id,
+    .host_allocator = iree_hal_webgpu_device_host_allocator,
+    .device_allocator = iree_hal_webgpu_device_allocator,
+    .replace_device_allocator = iree_hal_webgpu_device_replace_allocator,
+    .trim = iree_hal_webgpu_device_trim,
+    .query_i64 = iree_hal_webgpu_device_query_i64,
+    .create_command_buffer = iree_hal_webgpu_device_create_command_buffer,
+    .create_descriptor_set = iree_hal_webgpu_device_create_descriptor_set,
+    .create_descriptor_set_layout =
+        iree_hal_webgpu_device_create_descriptor_set_layout,
+    .create_event = iree_hal_webgpu_device_create_event,
+    .create_executable_cache = iree_hal_webgpu_device_create_executable_cache,
+    .create_executable_layout =
+        iree_hal_webgpu_device_create_executable_layout,
+    .create_semaphore = iree_hal_webgpu_device_create_semaphore,
+    .query_semaphore_compatibility =
+        iree_hal_webgpu_device_query_semaphore_compatibility,
+    .transfer_range = iree_hal_webgpu_device_transfer_range,
+    .queue_alloca = iree_hal_webgpu_device_queue_alloca,
+    .queue_dealloca = iree_hal_webgpu_device_queue_dealloca,
+    .queue_submit = iree_hal_webgpu_device_queue_submit,
+    .submit_and_wait = iree_hal_webgpu_device_submit_and_wait,
+    .wait_semaphores = iree_hal_webgpu_device_wait_semaphores,
+    .wait_idle = iree_hal_webgpu_device_wait_idle,
+    .profiling_begin = iree_hal_webgpu_device_profiling_begin,
+    .profiling_end = iree_hal_webgpu_device_profiling_end,
+};
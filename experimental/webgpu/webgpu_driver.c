@@ -0,0 +1,168 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "experimental/webgpu/api.h"
+#include "iree/base/api.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/api.h"
+
+#if defined(__EMSCRIPTEN__)
+#include <emscripten/html5_webgpu.h>
+#endif  // __EMSCRIPTEN__
+
+typedef struct iree_hal_webgpu_driver_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  // Identifier used for the driver in the IREE driver registry.
+  iree_string_view_t identifier;
+  // Parameters used for all devices created by the driver.
+  iree_hal_webgpu_device_params_t default_params;
+} iree_hal_webgpu_driver_t;
+
+// There is only ever the one device provided by the platform.
+#define IREE_HAL_WEBGPU_DEFAULT_DEVICE_ID 1
+
+static const iree_hal_driver_vtable_t iree_hal_webgpu_driver_vtable;
+
+static iree_hal_webgpu_driver_t* iree_hal_webgpu_driver_cast(
+    iree_hal_driver_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_webgpu_driver_vtable);
+  return (iree_hal_webgpu_driver_t*)base_value;
+}
+
+IREE_API_EXPORT void iree_hal_webgpu_driver_options_initialize(
+    iree_hal_webgpu_driver_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+  iree_hal_webgpu_device_params_initialize(&out_options->default_params);
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_webgpu_driver_create(
+    iree_string_view_t identifier,
+    const iree_hal_webgpu_driver_options_t* options,
+    iree_allocator_t host_allocator, iree_hal_driver_t** out_driver) {
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_driver);
+  *out_driver = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_webgpu_driver_t* driver = NULL;
+  iree_host_size_t total_size = sizeof(*driver) + identifier.size;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, total_size, (void**)&driver));
+  iree_hal_resource_initialize(&iree_hal_webgpu_driver_vtable,
+                               &driver->resource);
+  driver->host_allocator = host_allocator;
+  iree_string_view_append_to_buffer(
+      identifier, &driver->identifier,
+      (char*)driver + total_size - identifier.size);
+  memcpy(&driver->default_params, &options->default_params,
+         sizeof(driver->default_params));
+
+  *out_driver = (iree_hal_driver_t*)driver;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_hal_webgpu_driver_destroy(iree_hal_driver_t* base_driver) {
+  iree_hal_webgpu_driver_t* driver = iree_hal_webgpu_driver_cast(base_driver);
+  iree_allocator_t host_allocator = driver->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_allocator_free(host_allocator, driver);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Returns the WGPUDevice provided by the platform, if any.
+static WGPUDevice iree_hal_webgpu_driver_platform_device(void) {
+#if defined(__EMSCRIPTEN__)
+  // Populated from Module.preinitializedWebGPUDevice by the hosting page or
+  // worker; see the web samples for how it is requested.
+  return emscripten_webgpu_get_device();
+#else
+  return NULL;
+#endif  // __EMSCRIPTEN__
+}
+
+static iree_status_t iree_hal_webgpu_driver_query_available_devices(
+    iree_hal_driver_t* base_driver, iree_allocator_t host_allocator,
+    iree_host_size_t* out_device_info_count,
+    iree_hal_device_info_t** out_device_infos) {
+  static const iree_hal_device_info_t device_infos[1] = {
+      {
+          .device_id = IREE_HAL_WEBGPU_DEFAULT_DEVICE_ID,
+          .name = iree_string_view_literal("default"),
+      },
+  };
+  *out_device_info_count = 0;
+  *out_device_infos = NULL;
+  if (!iree_hal_webgpu_driver_platform_device()) return iree_ok_status();
+  *out_device_info_count = IREE_ARRAYSIZE(device_infos);
+  return iree_allocator_clone(
+      host_allocator, iree_make_const_byte_span(device_infos,
+                                                sizeof(device_infos)),
+      (void**)out_device_infos);
+}
+
+static iree_status_t iree_hal_webgpu_driver_dump_device_info(
+    iree_hal_driver_t* base_driver, iree_hal_device_id_t device_id,
+    iree_string_builder_t* builder) {
+  // TODO: dump the adapter properties once they can be queried from the
+  // device (WebGPU only exposes them on the adapter).
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_webgpu_driver_create_device_by_id(
+    iree_hal_driver_t* base_driver, iree_hal_device_id_t device_id,
+    iree_host_size_t param_count, const iree_string_pair_t* params,
+    iree_allocator_t host_allocator, iree_hal_device_t** out_device) {
+  iree_hal_webgpu_driver_t* driver = iree_hal_webgpu_driver_cast(base_driver);
+  if (device_id != IREE_HAL_DEVICE_ID_DEFAULT &&
+      device_id != IREE_HAL_WEBGPU_DEFAULT_DEVICE_ID) {
+    return iree_make_status(IREE_STATUS_NOT_FOUND,
+                            "WebGPU device %" PRIu64 " not found",
+                            (uint64_t)device_id);
+  }
+  WGPUDevice handle = iree_hal_webgpu_driver_platform_device();
+  if (!handle) {
+    return iree_make_status(
+        IREE_STATUS_UNAVAILABLE,
+        "no WebGPU device was provided by the platform; on the web set "
+        "Module.preinitializedWebGPUDevice prior to startup and natively use "
+        "iree_hal_webgpu_wrap_device");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status =
+      iree_hal_webgpu_wrap_device(driver->identifier, &driver->default_params,
+                                  handle, host_allocator, out_device);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_hal_webgpu_driver_create_device_by_path(
+    iree_hal_driver_t* base_driver, iree_string_view_t driver_name,
+    iree_string_view_t device_path, iree_host_size_t param_count,
+    const iree_string_pair_t* params, iree_allocator_t host_allocator,
+    iree_hal_device_t** out_device) {
+  if (!iree_string_view_is_empty(device_path)) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "device paths not yet implemented");
+  }
+  return iree_hal_webgpu_driver_create_device_by_id(
+      base_driver, IREE_HAL_DEVICE_ID_DEFAULT, param_count, params,
+      host_allocator, out_device);
+}
+
+static const iree_hal_driver_vtable_t iree_hal_webgpu_driver_vtable = {
+    .destroy = iree_hal_webgpu_driver_destroy,
+    .query_available_devices = iree_hal_webgpu_driver_query_available_devices,
+    .dump_device_info = iree_hal_webgpu_driver_dump_device_info,
+    .create_device_by_id = iree_hal_webgpu_driver_create_device_by_id,
+    .create_device_by_path = iree_hal_webgpu_driver_create_device_by_path,
+};
@@ -38,6 +38,20 @@ void populateTopkSplitReductionPattern(
 
 std::unique_ptr<OperationPass<func::FuncOp>> createTopkSplitReductionPass();
 
+/// Function signature to control scan splitting. This returns the number of
+/// blocks the scan dimension of an inclusive ScanOp is split into. If the
+/// ratio value is less or equal to 1 then nothing will be done.
+using ScanSplitReductionControlFn = std::function<int64_t(ScanOp scanOp)>;
+
+/// Patterns to apply `scan split reduction` pass.
+void populateScanSplitReductionPattern(
+    RewritePatternSet &patterns,
+    const ScanSplitReductionControlFn &splitReductionFn,
+    const linalg::LinalgTransformationFilter &f =
+        linalg::LinalgTransformationFilter());
+
+std::unique_ptr<OperationPass<func::FuncOp>> createScanSplitReductionPass();
+
 void registerTilingInterfaceExternalModels(DialectRegistry &registry);
 
 void registerPasses();
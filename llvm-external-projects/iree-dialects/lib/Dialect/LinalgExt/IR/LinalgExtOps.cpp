@@ -246,6 +246,25 @@ SmallVector<Range> ScatterOp::getIterationDomain(OpBuilder &builder) {
   return ranges;
 }
 
+SmallVector<unsigned>
+ScatterOp::getPartitionableLoops(unsigned maxNumParallelDims) {
+  // Updates with repeated indices may write the same element of the original
+  // and can't be partitioned, but every element of an update slice is written
+  // to a distinct element of the original.
+  auto range = llvm::seq<unsigned>(0, getUpdateType().getRank());
+  SmallVector<unsigned> partitionableLoops(range.begin(), range.end());
+  if (!unique_indices()) {
+    partitionableLoops.erase(partitionableLoops.begin());
+  }
+  if (partitionableLoops.size() > maxNumParallelDims) {
+    partitionableLoops.erase(
+        partitionableLoops.begin(),
+        std::next(partitionableLoops.begin(),
+                  partitionableLoops.size() - maxNumParallelDims));
+  }
+  return partitionableLoops;
+}
+
 Operation *ScatterOp::getTiledImplementation(OpBuilder &builder,
                                              ValueRange outputs,
                                              ArrayRef<OpFoldResult> offsets,
@@ -491,77 +510,133 @@ Operation *SortOp::getTiledImplementation(OpBuilder &builder,
 
 LogicalResult SortOp::generateScalarImplementation(OpBuilder &b, Location loc,
                                                    ValueRange ivs) {
+  // The loop nest also iterates over the sort dimension. The whole dimension
+  // is heap sorted in its first iteration, which takes O(n log n) comparisons
+  // instead of the O(n^2) of a bubble sort pass per iteration.
   auto sortDim = dimension();
-  SmallVector<Value> indices, sortBlkArgs;
-  indices.append(ivs.begin(), ivs.end());
-  // Bubble sort innermost loop.
   Value zero = b.create<arith::ConstantIndexOp>(loc, 0);
   Value one = b.create<arith::ConstantIndexOp>(loc, 1);
-  Value ub;
+  Value two = b.create<arith::ConstantIndexOp>(loc, 2);
+  Value size;
   if (getOperandType(0).isDynamicDim(sortDim)) {
-    ub = b.create<memref::DimOp>(loc, operand(0), sortDim);
+    size = b.create<memref::DimOp>(loc, operand(0), sortDim);
   } else {
-    ub = b.create<arith::ConstantIndexOp>(
+    size = b.create<arith::ConstantIndexOp>(
         loc, getOperandType(0).getDimSize(sortDim));
   }
-  ub = b.create<arith::SubIOp>(loc, ub, one);
-  auto scfFor = b.create<scf::ForOp>(
-      loc, zero, ub, one, ValueRange{},
-      [&](OpBuilder &b, Location loc, Value iv, ValueRange iters) {
-        SmallVector<Value> indices(ivs);
-        Value ivPlusOne = b.create<arith::AddIOp>(loc, iv, one);
-        for (auto output : getOutputOperands()) {
-          indices[sortDim] = iv;
-          sortBlkArgs.push_back(
-              b.create<memref::LoadOp>(loc, output->get(), indices));
-          indices[sortDim] = ivPlusOne;
-          sortBlkArgs.push_back(
-              b.create<memref::LoadOp>(loc, output->get(), indices));
-        }
-      });
 
+  // Returns whether the elements at `lhs` and `rhs` along the sort dimension
+  // are in order according to the comparator.
   auto &srcBlock = region().front();
-  Region &region = scfFor.getRegion();
-  BlockAndValueMapping bvm;
-  {
-    OpBuilder::InsertionGuard guard(b);
-    auto &block = region.front();
-    b.setInsertionPointToEnd(&block);
-    for (auto it : llvm::zip(srcBlock.getArguments(), sortBlkArgs)) {
-      bvm.map(std::get<0>(it), std::get<1>(it));
+  auto emitIsOrdered = [&](OpBuilder &b, Location loc, Value lhs,
+                           Value rhs) -> Value {
+    SmallVector<Value> indices(ivs.begin(), ivs.end());
+    BlockAndValueMapping bvm;
+    for (int i = 0, e = getNumOutputs(); i < e; ++i) {
+      Value output = getOutputOperand(i)->get();
+      indices[sortDim] = lhs;
+      bvm.map(srcBlock.getArgument(i * 2),
+              b.create<memref::LoadOp>(loc, output, indices));
+      indices[sortDim] = rhs;
+      bvm.map(srcBlock.getArgument(i * 2 + 1),
+              b.create<memref::LoadOp>(loc, output, indices));
     }
     for (auto &blockOp : srcBlock.without_terminator()) {
       b.clone(blockOp, bvm);
     }
-  }
-  Value cond = bvm.lookupOrDefault(srcBlock.getTerminator()->getOperand(0));
+    return bvm.lookupOrDefault(srcBlock.getTerminator()->getOperand(0));
+  };
 
-  OpBuilder::InsertionGuard g(b);
-  b.setInsertionPointToEnd(&region.front());
-  b.create<scf::IfOp>(
-      loc, TypeRange{}, cond,
-      [&](OpBuilder &b, Location loc) {
-        // Do not swap the pairs if true.
+  // Swaps the elements at `lhs` and `rhs` along the sort dimension.
+  auto emitSwap = [&](OpBuilder &b, Location loc, Value lhs, Value rhs) {
+    SmallVector<Value> lhsIndices(ivs.begin(), ivs.end());
+    SmallVector<Value> rhsIndices(ivs.begin(), ivs.end());
+    lhsIndices[sortDim] = lhs;
+    rhsIndices[sortDim] = rhs;
+    for (auto output : getOutputOperands()) {
+      Value lhsValue = b.create<memref::LoadOp>(loc, output->get(), lhsIndices);
+      Value rhsValue = b.create<memref::LoadOp>(loc, output->get(), rhsIndices);
+      b.create<memref::StoreOp>(loc, rhsValue, output->get(), lhsIndices);
+      b.create<memref::StoreOp>(loc, lhsValue, output->get(), rhsIndices);
+    }
+  };
+
+  // Sifts the element at `root` down the heap formed by the first `end`
+  // elements, in which every element is ordered after its children.
+  auto emitSiftDown = [&](OpBuilder &b, Location loc, Value root, Value end) {
+    Type indexType = b.getIndexType();
+    b.create<scf::WhileOp>(
+        loc, TypeRange{indexType, indexType}, ValueRange{root},
+        [&](OpBuilder &b, Location loc, ValueRange args) {
+          Value node = args[0];
+          Value child = b.create<arith::AddIOp>(
+              loc, b.create<arith::MulIOp>(loc, node, two), one);
+          Value hasChild = b.create<arith::CmpIOp>(
+              loc, arith::CmpIPredicate::ult, child, end);
+          auto swapOp = b.create<scf::IfOp>(
+              loc, TypeRange{b.getI1Type(), indexType}, hasChild,
+              [&](OpBuilder &b, Location loc) {
+                // Pick the child ordered last and swap with it if the node is
+                // ordered before it.
+                Value sibling = b.create<arith::AddIOp>(loc, child, one);
+                Value hasSibling = b.create<arith::CmpIOp>(
+                    loc, arith::CmpIPredicate::ult, sibling, end);
+                auto lastChildOp = b.create<scf::IfOp>(
+                    loc, TypeRange{indexType}, hasSibling,
+                    [&](OpBuilder &b, Location loc) {
+                      Value isOrdered = emitIsOrdered(b, loc, child, sibling);
+                      Value lastChild = b.create<arith::SelectOp>(
+                          loc, isOrdered, sibling, child);
+                      b.create<scf::YieldOp>(loc, lastChild);
+                    },
+                    [&](OpBuilder &b, Location loc) {
+                      b.create<scf::YieldOp>(loc, child);
+                    });
+                Value lastChild = lastChildOp.getResult(0);
+                Value isOrdered = emitIsOrdered(b, loc, node, lastChild);
+                b.create<scf::YieldOp>(loc, ValueRange{isOrdered, lastChild});
+              },
+              [&](OpBuilder &b, Location loc) {
+                Value isLeaf = b.create<arith::ConstantIntOp>(loc, 0, 1);
+                b.create<scf::YieldOp>(loc, ValueRange{isLeaf, child});
+              });
+          b.create<scf::ConditionOp>(loc, swapOp.getResult(0),
+                                     ValueRange{node, swapOp.getResult(1)});
+        },
+        [&](OpBuilder &b, Location loc, ValueRange args) {
+          emitSwap(b, loc, args[0], args[1]);
+          b.create<scf::YieldOp>(loc, args[1]);
+        });
+  };
+
+  Value isFirst = b.create<arith::CmpIOp>(loc, arith::CmpIPredicate::eq,
+                                          ivs[sortDim], zero);
+  auto ifOp = b.create<scf::IfOp>(loc, isFirst, /*withElseRegion=*/false);
+  OpBuilder::InsertionGuard guard(b);
+  b.setInsertionPointToStart(ifOp.thenBlock());
+
+  // Build the heap bottom-up from the last parent.
+  Value half = b.create<arith::DivUIOp>(loc, size, two);
+  Value lastParent = b.create<arith::SubIOp>(loc, half, one);
+  b.create<scf::ForOp>(
+      loc, zero, half, one, ValueRange{},
+      [&](OpBuilder &b, Location loc, Value iv, ValueRange iters) {
+        Value root = b.create<arith::SubIOp>(loc, lastParent, iv);
+        emitSiftDown(b, loc, root, size);
         b.create<scf::YieldOp>(loc);
-      },
-      [&](OpBuilder &b, Location loc) {
-        // Swap the pairs if false.
-        SmallVector<Value> indices(ivs.begin(), ivs.end());
-        Value ivPlusOne =
-            b.create<arith::AddIOp>(loc, scfFor.getInductionVar(), one);
-        for (int i = 0, e = getNumOutputs(); i < e; ++i) {
-          Value v1 = sortBlkArgs[i * 2];
-          Value v2 = sortBlkArgs[i * 2 + 1];
-          indices[sortDim] = scfFor.getInductionVar();
-          b.create<memref::StoreOp>(loc, v2, getOutputOperand(i)->get(),
-                                    indices);
-          indices[sortDim] = ivPlusOne;
-          b.create<memref::StoreOp>(loc, v1, getOutputOperand(i)->get(),
-                                    indices);
-        }
+      });
+
+  // Repeatedly move the root, ordered after all others, to the end of the
+  // shrinking heap.
+  Value last = b.create<arith::SubIOp>(loc, size, one);
+  b.create<scf::ForOp>(
+      loc, zero, last, one, ValueRange{},
+      [&](OpBuilder &b, Location loc, Value iv, ValueRange iters) {
+        Value end = b.create<arith::SubIOp>(loc, last, iv);
+        emitSwap(b, loc, zero, end);
+        emitSiftDown(b, loc, zero, end);
         b.create<scf::YieldOp>(loc);
       });
-  b.create<scf::YieldOp>(loc);
   return success();
 }
 
@@ -1320,6 +1395,53 @@ LogicalResult TopkOp::generateScalarImplementation(OpBuilder &b, Location loc,
   // Compute K (ub) from the selected dim of the output
   Value ub = b.create<memref::DimOp>(loc, outputValues(), dimension());
 
+  // Retrieve region as black box comparision function f(x,y).
+  auto &srcBlock = region().front();
+  auto emitCompare = [&](OpBuilder &b, Value x, Value y) -> Value {
+    BlockAndValueMapping bvm;
+    bvm.map(srcBlock.getArgument(0), x);
+    bvm.map(srcBlock.getArgument(1), y);
+    for (auto &blockOp : srcBlock.without_terminator()) {
+      b.clone(blockOp, bvm);
+    }
+    return bvm.lookup(srcBlock.getTerminator()->getOperand(0));
+  };
+
+  // The outputs are kept ordered so only values that are selected over the
+  // last of the K outputs change them. With a small K and a large input most
+  // values are rejected by this single comparison instead of the K loop.
+  Value hasK =
+      b.create<arith::CmpIOp>(loc, arith::CmpIPredicate::ugt, ub, zero);
+  auto isSelectedOp = b.create<scf::IfOp>(
+      loc, TypeRange{b.getI1Type()}, hasK,
+      [&](OpBuilder &b, Location loc) {
+        SmallVector<Value> indices(ivs);
+        indices[kDim] = b.create<arith::SubIOp>(loc, ub, one);
+        Value lastValue =
+            b.create<memref::LoadOp>(loc, outputValues(), indices);
+        Value lastIndex =
+            b.create<memref::LoadOp>(loc, outputIndices(), indices);
+        Value forwardCmpRes = emitCompare(b, initialValue, lastValue);
+        Value reverseCmpRes = emitCompare(b, lastValue, initialValue);
+        Value cmpValuesEqual = b.create<arith::CmpIOp>(
+            loc, arith::CmpIPredicate::eq, forwardCmpRes, reverseCmpRes);
+        Value cmpFirstIndex = b.create<arith::CmpIOp>(
+            loc, arith::CmpIPredicate::slt, initialIndex, lastIndex);
+        Value combinedCmpEqRes =
+            b.create<arith::AndIOp>(loc, cmpValuesEqual, cmpFirstIndex);
+        Value isSelected =
+            b.create<arith::OrIOp>(loc, forwardCmpRes, combinedCmpEqRes);
+        b.create<scf::YieldOp>(loc, isSelected);
+      },
+      [&](OpBuilder &b, Location loc) {
+        Value isSelected = b.create<arith::ConstantIntOp>(loc, 0, 1);
+        b.create<scf::YieldOp>(loc, isSelected);
+      });
+  auto ifOp = b.create<scf::IfOp>(loc, isSelectedOp.getResult(0),
+                                  /*withElseRegion=*/false);
+  OpBuilder::InsertionGuard ifGuard(b);
+  b.setInsertionPointToStart(ifOp.thenBlock());
+
   // Inner K loop functions:
   //   Load current K value and index
   //   Compare N/K using inserted block compare
@@ -1342,8 +1464,7 @@ LogicalResult TopkOp::generateScalarImplementation(OpBuilder &b, Location loc,
   indices[kDim] = scfFor.getInductionVar();
   auto loopCarryValues = scfFor.getRegionIterArgs();
 
-  // Retrieve region as black box comparision function f(x,y). Plug into op.
-  auto &srcBlock = region().front();
+  // Plug the comparision function into the op.
   BlockAndValueMapping bvmF; // f(x,y)
   BlockAndValueMapping bvmR; // f(y,x)
   {
@@ -1451,6 +1572,225 @@ Operation *TopkOp::getTiledImplementation(OpBuilder &builder,
   return tiledTopkOp;
 }
 
+//===----------------------------------------------------------------------===//
+// AttentionOp
+//===----------------------------------------------------------------------===//
+
+LogicalResult AttentionOp::verify() {
+  Operation *op = getOperation();
+  if (getNumInputs() != 3) {
+    return op->emitOpError("expected three input operands");
+  }
+  if (getNumOutputs() != 1) {
+    return op->emitOpError("expected one output operand");
+  }
+  auto queryType = query().getType().cast<ShapedType>();
+  auto keyType = key().getType().cast<ShapedType>();
+  auto valueType = value().getType().cast<ShapedType>();
+  auto outputType = output().getType().cast<ShapedType>();
+  if (queryType.getRank() != 3 || keyType.getRank() != 3 ||
+      valueType.getRank() != 3 || outputType.getRank() != 3) {
+    return op->emitOpError("expected all operands to be of rank 3");
+  }
+  Type elementType = queryType.getElementType();
+  if (!elementType.isa<FloatType>()) {
+    return op->emitOpError("expected floating point element type");
+  }
+  if (keyType.getElementType() != elementType ||
+      valueType.getElementType() != elementType ||
+      outputType.getElementType() != elementType) {
+    return op->emitOpError("expected all operands to have the same element "
+                           "type");
+  }
+  auto isCompatible = [](int64_t lhs, int64_t rhs) {
+    return lhs == ShapedType::kDynamicSize ||
+           rhs == ShapedType::kDynamicSize || lhs == rhs;
+  };
+  ArrayRef<int64_t> queryShape = queryType.getShape();
+  ArrayRef<int64_t> keyShape = keyType.getShape();
+  ArrayRef<int64_t> valueShape = valueType.getShape();
+  ArrayRef<int64_t> outputShape = outputType.getShape();
+  if (!isCompatible(queryShape[0], keyShape[0]) ||
+      !isCompatible(queryShape[0], valueShape[0]) ||
+      !isCompatible(queryShape[0], outputShape[0])) {
+    return op->emitOpError("incompatible batch dimensions");
+  }
+  if (!isCompatible(queryShape[2], keyShape[2])) {
+    return op->emitOpError("incompatible query/key head dimensions");
+  }
+  if (!isCompatible(keyShape[1], valueShape[1])) {
+    return op->emitOpError("incompatible key/value sequence lengths");
+  }
+  if (!isCompatible(queryShape[1], outputShape[1]) ||
+      !isCompatible(valueShape[2], outputShape[2])) {
+    return op->emitOpError("incompatible output shape");
+  }
+  return success();
+}
+
+SmallVector<Range> AttentionOp::getIterationDomain(OpBuilder &builder) {
+  Location loc = getLoc();
+  Value zero = builder.create<arith::ConstantIndexOp>(loc, 0);
+  Value one = builder.create<arith::ConstantIndexOp>(loc, 1);
+  SmallVector<Range> loopBounds;
+  // Batch and query sequence dimensions.
+  for (auto dim : llvm::seq<int64_t>(0, 2)) {
+    Value ub = getDimValue(builder, loc, query(), dim);
+    loopBounds.emplace_back(Range{zero, ub, one});
+  }
+  return loopBounds;
+}
+
+SmallVector<StringRef> AttentionOp::getLoopIteratorTypes() {
+  SmallVector<StringRef> iteratorTypes(2, getParallelIteratorTypeName());
+  return iteratorTypes;
+}
+
+LogicalResult AttentionOp::generateScalarImplementation(OpBuilder &b,
+                                                        Location loc,
+                                                        ValueRange ivs) {
+  Value batch = ivs[0];
+  Value row = ivs[1];
+  Value zero = b.create<arith::ConstantIndexOp>(loc, 0);
+  Value one = b.create<arith::ConstantIndexOp>(loc, 1);
+  Value headDim = getDimValue(b, loc, query(), 2);
+  Value sequenceLength = getDimValue(b, loc, key(), 1);
+  Value valueDim = getDimValue(b, loc, value(), 2);
+
+  auto elementType = getQueryType().getElementType().cast<FloatType>();
+  Value zeroValue =
+      b.create<arith::ConstantOp>(loc, b.getFloatAttr(elementType, 0.0));
+  Value negInf = b.create<arith::ConstantOp>(
+      loc, b.getFloatAttr(elementType,
+                          APFloat::getInf(elementType.getFloatSemantics(),
+                                          /*Negative=*/true)));
+
+  // The output row is used as the accumulator of the weighted values.
+  b.create<scf::ForOp>(loc, zero, valueDim, one, llvm::None,
+                       [&](OpBuilder &b, Location loc, Value k, ValueRange) {
+                         b.create<memref::StoreOp>(
+                             loc, zeroValue, output(),
+                             ValueRange{batch, row, k});
+                         b.create<scf::YieldOp>(loc);
+                       });
+
+  // For each key/value pair:
+  //   score = dot(query[row], key[s])
+  //   newMax = max(max, score)
+  //   correction = exp(max - newMax)
+  //   p = exp(score - newMax)
+  //   sum = sum * correction + p
+  //   output[row] = output[row] * correction + p * value[s]
+  auto sequenceLoop = b.create<scf::ForOp>(
+      loc, zero, sequenceLength, one, ValueRange{negInf, zeroValue},
+      [&](OpBuilder &b, Location loc, Value s, ValueRange iterArgs) {
+        Value runningMax = iterArgs[0];
+        Value runningSum = iterArgs[1];
+        auto scoreLoop = b.create<scf::ForOp>(
+            loc, zero, headDim, one, ValueRange{zeroValue},
+            [&](OpBuilder &b, Location loc, Value k, ValueRange iterArgs) {
+              Value q = b.create<memref::LoadOp>(loc, query(),
+                                                 ValueRange{batch, row, k});
+              Value kv = b.create<memref::LoadOp>(loc, key(),
+                                                  ValueRange{batch, s, k});
+              Value product = b.create<arith::MulFOp>(loc, q, kv);
+              Value acc = b.create<arith::AddFOp>(loc, iterArgs[0], product);
+              b.create<scf::YieldOp>(loc, acc);
+            });
+        Value score = scoreLoop.getResult(0);
+        Value newMax = b.create<arith::MaxFOp>(loc, runningMax, score);
+        Value correction = b.create<math::ExpOp>(
+            loc, b.create<arith::SubFOp>(loc, runningMax, newMax));
+        Value p = b.create<math::ExpOp>(
+            loc, b.create<arith::SubFOp>(loc, score, newMax));
+        Value newSum = b.create<arith::AddFOp>(
+            loc, b.create<arith::MulFOp>(loc, runningSum, correction), p);
+        b.create<scf::ForOp>(
+            loc, zero, valueDim, one, llvm::None,
+            [&](OpBuilder &b, Location loc, Value k, ValueRange) {
+              Value acc = b.create<memref::LoadOp>(loc, output(),
+                                                   ValueRange{batch, row, k});
+              Value v = b.create<memref::LoadOp>(loc, value(),
+                                                 ValueRange{batch, s, k});
+              Value scaledAcc = b.create<arith::MulFOp>(loc, acc, correction);
+              Value weighted = b.create<arith::MulFOp>(loc, p, v);
+              Value newAcc = b.create<arith::AddFOp>(loc, scaledAcc, weighted);
+              b.create<memref::StoreOp>(loc, newAcc, output(),
+                                        ValueRange{batch, row, k});
+              b.create<scf::YieldOp>(loc);
+            });
+        b.create<scf::YieldOp>(loc, ValueRange{newMax, newSum});
+      });
+
+  // Normalize the output row by the softmax denominator.
+  Value sum = sequenceLoop.getResult(1);
+  b.create<scf::ForOp>(loc, zero, valueDim, one, llvm::None,
+                       [&](OpBuilder &b, Location loc, Value k, ValueRange) {
+                         Value acc = b.create<memref::LoadOp>(
+                             loc, output(), ValueRange{batch, row, k});
+                         Value result = b.create<arith::DivFOp>(loc, acc, sum);
+                         b.create<memref::StoreOp>(loc, result, output(),
+                                                   ValueRange{batch, row, k});
+                         b.create<scf::YieldOp>(loc);
+                       });
+  return success();
+}
+
+Operation *AttentionOp::getTiledImplementation(
+    OpBuilder &builder, ValueRange outputs, ArrayRef<OpFoldResult> offsets,
+    ArrayRef<OpFoldResult> sizes, SmallVectorImpl<Value> &results) {
+  assert(outputs.size() == 1);
+  assert(offsets.size() == 2 && sizes.size() == 2);
+  Location loc = getLoc();
+  OpFoldResult zero = builder.getI64IntegerAttr(0);
+  SmallVector<OpFoldResult> strides(getQueryRank(),
+                                    builder.getI64IntegerAttr(1));
+  auto getFullSize = [&](Value source, int64_t dim) -> OpFoldResult {
+    return getAsOpFoldResult(getDimValue(builder, loc, source, dim));
+  };
+
+  // Query and output rows are tiled along the batch and query sequence
+  // dimensions while each tile reads the entire key/value sequences of its
+  // batch.
+  SmallVector<OpFoldResult> queryOffsets = {offsets[0], offsets[1], zero};
+  SmallVector<OpFoldResult> querySizes = {sizes[0], sizes[1],
+                                          getFullSize(query(), 2)};
+  SmallVector<OpFoldResult> keyValueOffsets = {offsets[0], zero, zero};
+  SmallVector<OpFoldResult> keySizes = {sizes[0], getFullSize(key(), 1),
+                                        getFullSize(key(), 2)};
+  SmallVector<OpFoldResult> valueSizes = {sizes[0], getFullSize(value(), 1),
+                                          getFullSize(value(), 2)};
+  SmallVector<OpFoldResult> outputSizes = {sizes[0], sizes[1],
+                                           getFullSize(output(), 2)};
+
+  SmallVector<Value> tiledOperands;
+  tiledOperands.emplace_back(
+      getSlice(builder, loc, query(), queryOffsets, querySizes, strides));
+  tiledOperands.emplace_back(
+      getSlice(builder, loc, key(), keyValueOffsets, keySizes, strides));
+  tiledOperands.emplace_back(
+      getSlice(builder, loc, value(), keyValueOffsets, valueSizes, strides));
+  tiledOperands.emplace_back(
+      getSlice(builder, loc, outputs[0], queryOffsets, outputSizes, strides));
+
+  SmallVector<Type> resultTypes;
+  if (hasTensorSemantics()) {
+    resultTypes.push_back(tiledOperands.back().getType());
+  }
+
+  Operation *tiledAttentionOp =
+      cast<LinalgExtOp>(getOperation())
+          .clone(builder, loc, resultTypes, tiledOperands);
+
+  for (auto result : llvm::enumerate(tiledAttentionOp->getResults())) {
+    auto insertSliceOp = builder.create<tensor::InsertSliceOp>(
+        loc, result.value(), outputs[result.index()], queryOffsets,
+        outputSizes, strides);
+    results.push_back(insertSliceOp.getResult());
+  }
+  return tiledAttentionOp;
+}
+
 #define DEFINE_OP_GET_EFFECTS(OP_NAME)                                         \
   void OP_NAME::getEffects(                                                    \
       SmallVectorImpl<SideEffects::EffectInstance<MemoryEffects::Effect>>      \
@@ -1467,6 +1807,7 @@ DEFINE_OP_GET_EFFECTS(FftOp)
 DEFINE_OP_GET_EFFECTS(ReverseOp)
 DEFINE_OP_GET_EFFECTS(ScanOp)
 DEFINE_OP_GET_EFFECTS(TopkOp)
+DEFINE_OP_GET_EFFECTS(AttentionOp)
 
 namespace {
 /// This is derived from mlir/lib/Dialect/Linalg/IR/LinalgOps.cpp without any
@@ -18,6 +18,7 @@
 #include "mlir/Dialect/SCF/IR/SCF.h"
 #include "mlir/Dialect/Tensor/IR/Tensor.h"
 #include "mlir/IR/AffineExpr.h"
+#include "mlir/IR/BlockAndValueMapping.h"
 #include "mlir/IR/BuiltinOps.h"
 #include "mlir/IR/Operation.h"
 #include "mlir/IR/PatternMatch.h"
@@ -328,6 +329,188 @@ private:
   mlir::linalg::LinalgTransformationFilter filter;
 };
 
+// Returns an init tensor of `type` whose dynamic dimensions are taken from
+// the given dimensions of `source`.
+Value createInitTensorLike(OpBuilder &b, Location loc, Value source,
+                           RankedTensorType type,
+                           ArrayRef<int64_t> sourceDims) {
+  SmallVector<Value> dynSizes;
+  for (auto en : llvm::enumerate(sourceDims)) {
+    if (type.isDynamicDim(en.index())) {
+      dynSizes.push_back(getDimValue(b, loc, source, en.value()));
+    }
+  }
+  return b.create<mlir::linalg::InitTensorOp>(loc, dynSizes, type.getShape(),
+                                              type.getElementType());
+}
+
+struct ScanOpSplitReduction : public OpRewritePattern<ScanOp> {
+  using OpRewritePattern::OpRewritePattern;
+
+  ScanOpSplitReduction(MLIRContext *context, ScanSplitReductionControlFn fn,
+                       linalg::LinalgTransformationFilter filt)
+      : OpRewritePattern<ScanOp>(context), splitReductionFn(std::move(fn)),
+        filter(std::move(filt)) {}
+
+  // Transforms an inclusive ScanOp along a long dimension into a blocked
+  // three-phase scan so that the scan dimension is no longer executed by a
+  // single thread.
+  //
+  // The first phase expands the scan dimension into (M, N / M) and scans each
+  // of the M blocks in parallel; the accumulator of that scan holds the total
+  // of each block. The second phase scans the M block totals. The third phase
+  // combines the running total of blocks [0, i) into every element of block i
+  // with a parallel linalg.generic. The accumulator of the second phase is the
+  // accumulator of the original scan.
+  //
+  // This reassociates the combiner, which is assumed to be associative.
+  // Exclusive scans are not supported as their accumulator does not include
+  // the last element of each block.
+  LogicalResult matchAndRewrite(ScanOp scanOp,
+                                PatternRewriter &rewriter) const override {
+    if (failed(filter.checkAndNotify(rewriter, scanOp))) {
+      return rewriter.notifyMatchFailure(scanOp, "preconditions not met");
+    }
+    if (!scanOp.hasTensorSemantics()) {
+      return rewriter.notifyMatchFailure(scanOp,
+                                         "expected tensor semantics");
+    }
+    if (!scanOp.inclusive()) {
+      return rewriter.notifyMatchFailure(scanOp,
+                                         "exclusive scans aren't supported");
+    }
+    auto inputType = scanOp.getOperandType().cast<RankedTensorType>();
+    if (scanOp.getResult(0).getType() != inputType) {
+      return rewriter.notifyMatchFailure(
+          scanOp, "expected matching input/output types");
+    }
+    int64_t scanDim = scanOp.dimension();
+    if (inputType.isDynamicDim(scanDim)) {
+      return rewriter.notifyMatchFailure(scanOp,
+                                         "cannot split dynamic dimension");
+    }
+    int64_t splitReductionRatio = splitReductionFn(scanOp);
+    if (splitReductionRatio <= 1) {
+      return rewriter.notifyMatchFailure(scanOp, "reduction ratio <= 1");
+    }
+    if (inputType.getDimSize(scanDim) % splitReductionRatio != 0) {
+      return rewriter.notifyMatchFailure(
+          scanOp,
+          "scan dimension must be perfectly aligned to (divisible by) the "
+          "split ratio");
+    }
+
+    Location loc = scanOp.getLoc();
+    Type elementType = inputType.getElementType();
+    int64_t rank = inputType.getRank();
+    SmallVector<ReassociationIndices> reassociationIndices =
+        getReassociationIndices(rank, scanDim);
+
+    SmallVector<int64_t> expandedShape = getExpandedShape(
+        inputType.getShape(), splitReductionRatio, scanDim);
+    auto expandedType = RankedTensorType::get(expandedShape, elementType);
+    int64_t expandedRank = expandedType.getRank();
+    Value expandedInput = rewriter.create<tensor::ExpandShapeOp>(
+        loc, expandedType, scanOp.input(), reassociationIndices);
+    SmallVector<int64_t> expandedDims =
+        llvm::to_vector(llvm::seq<int64_t>(0, expandedRank));
+    SmallVector<int64_t> blockDims = expandedDims;
+    blockDims.erase(std::next(blockDims.begin(), scanDim + 1));
+    SmallVector<int64_t> blockShape = expandedShape;
+    blockShape.erase(std::next(blockShape.begin(), scanDim + 1));
+    auto blockType = RankedTensorType::get(blockShape, elementType);
+
+    // Scan within each block in parallel.
+    SmallVector<Type> blockScanResultTypes = {expandedType, blockType};
+    SmallVector<Value> blockScanOuts = {
+        createInitTensorLike(rewriter, loc, expandedInput, expandedType,
+                             expandedDims),
+        createInitTensorLike(rewriter, loc, expandedInput, blockType,
+                             blockDims)};
+    auto blockScanOp = rewriter.create<ScanOp>(
+        loc, blockScanResultTypes, ValueRange{expandedInput}, blockScanOuts,
+        scanDim + 1, /*inclusive=*/true);
+    rewriter.cloneRegionBefore(scanOp.region(), blockScanOp.region(),
+                               blockScanOp.region().end());
+    Value partialScan = blockScanOp.getResult(0);
+    Value blockTotals = blockScanOp.getResult(1);
+
+    // Scan the block totals. The accumulator of the original scan is only
+    // written to by inclusive scans so it is reused as is.
+    SmallVector<Type> carryScanResultTypes = {blockType,
+                                              scanOp.getResult(1).getType()};
+    SmallVector<Value> carryScanOuts = {
+        createInitTensorLike(rewriter, loc, blockTotals, blockType,
+                             llvm::to_vector(llvm::seq<int64_t>(0, rank))),
+        scanOp.accumulator()};
+    auto carryScanOp = rewriter.create<ScanOp>(
+        loc, carryScanResultTypes, ValueRange{blockTotals}, carryScanOuts,
+        scanDim, /*inclusive=*/true);
+    rewriter.cloneRegionBefore(scanOp.region(), carryScanOp.region(),
+                               carryScanOp.region().end());
+
+    // Combine the running total of the preceding blocks into blocks [1, M).
+    OpFoldResult zero = rewriter.getIndexAttr(0);
+    OpFoldResult one = rewriter.getIndexAttr(1);
+    SmallVector<OpFoldResult> tailOffsets(expandedRank, zero);
+    SmallVector<OpFoldResult> tailStrides(expandedRank, one);
+    SmallVector<OpFoldResult> tailSizes;
+    for (int64_t dim : expandedDims) {
+      tailSizes.push_back(getDim(rewriter, loc, partialScan, dim));
+    }
+    tailOffsets[scanDim] = one;
+    tailSizes[scanDim] = rewriter.getIndexAttr(splitReductionRatio - 1);
+    Value partialTail = rewriter.create<tensor::ExtractSliceOp>(
+        loc, partialScan, tailOffsets, tailSizes, tailStrides);
+
+    SmallVector<OpFoldResult> carryOffsets(rank, zero);
+    SmallVector<OpFoldResult> carryStrides(rank, one);
+    SmallVector<OpFoldResult> carrySizes;
+    for (int64_t dim : blockDims) carrySizes.push_back(tailSizes[dim]);
+    Value carry = rewriter.create<tensor::ExtractSliceOp>(
+        loc, carryScanOp.getResult(0), carryOffsets, carrySizes, carryStrides);
+
+    SmallVector<AffineExpr> carryExprs;
+    for (int64_t dim : blockDims) {
+      carryExprs.push_back(rewriter.getAffineDimExpr(dim));
+    }
+    SmallVector<AffineMap> indexingMaps = {
+        AffineMap::get(expandedRank, 0, carryExprs, rewriter.getContext()),
+        rewriter.getMultiDimIdentityMap(expandedRank)};
+    SmallVector<StringRef> iterators(expandedRank, "parallel");
+    Block &combiner = scanOp.region().front();
+    auto combineOp = rewriter.create<linalg::GenericOp>(
+        loc, /*resultTensorTypes=*/partialTail.getType(),
+        /*inputs=*/ValueRange{carry}, /*outputs=*/ValueRange{partialTail},
+        indexingMaps, iterators,
+        [&](OpBuilder &b, Location loc, ValueRange args) {
+          BlockAndValueMapping bvm;
+          bvm.map(combiner.getArgument(0), args[0]);
+          bvm.map(combiner.getArgument(1), args[1]);
+          for (auto &op : combiner.without_terminator()) {
+            b.clone(op, bvm);
+          }
+          b.create<linalg::YieldOp>(
+              loc,
+              bvm.lookupOrDefault(combiner.getTerminator()->getOperand(0)));
+        });
+    Value combined = rewriter.create<tensor::InsertSliceOp>(
+        loc, combineOp.getResult(0), partialScan, tailOffsets, tailSizes,
+        tailStrides);
+    Value result = rewriter.create<tensor::CollapseShapeOp>(
+        loc, inputType, combined, reassociationIndices);
+
+    rewriter.replaceOp(scanOp, {result, carryScanOp.getResult(1)});
+    filter.replaceLinalgTransformationFilter(rewriter, blockScanOp);
+    filter.replaceLinalgTransformationFilter(rewriter, carryScanOp);
+    return success();
+  }
+
+private:
+  ScanSplitReductionControlFn splitReductionFn;
+  mlir::linalg::LinalgTransformationFilter filter;
+};
+
 } // namespace
 
 //===----------------------------------------------------------------------===//
@@ -366,6 +549,39 @@ struct TopkSplitReductionPass
 };
 } // namespace
 
+namespace {
+struct ScanSplitReductionPass
+    : public ScanSplitReductionBase<ScanSplitReductionPass> {
+  void getDependentDialects(DialectRegistry &registry) const override {
+    registry.insert<linalg::LinalgDialect, func::FuncDialect,
+                    mlir::arith::ArithmeticDialect, math::MathDialect,
+                    memref::MemRefDialect, scf::SCFDialect,
+                    tensor::TensorDialect>();
+  }
+
+  void runOnOperation() override {
+    if (splitRatio.getValue() <= 1) {
+      return;
+    }
+
+    RewritePatternSet patterns(&getContext());
+    ScanSplitReductionControlFn splitReductionFn =
+        [&](mlir::iree_compiler::IREE::LinalgExt::ScanOp scanOp) {
+          return splitRatio.getValue();
+        };
+    patterns.add<ScanOpSplitReduction>(
+        patterns.getContext(), splitReductionFn,
+        mlir::linalg::LinalgTransformationFilter(
+            ArrayRef<StringAttr>{},
+            StringAttr::get(patterns.getContext(), "SPLIT_REDUCTION")));
+    if (failed(applyPatternsAndFoldGreedily(getOperation(),
+                                            std::move(patterns)))) {
+      return signalPassFailure();
+    }
+  }
+};
+} // namespace
+
 void mlir::iree_compiler::IREE::LinalgExt::populateTopkSplitReductionPattern(
     RewritePatternSet &patterns,
     const TopkSplitReductionControlFn &splitReductionFn,
@@ -378,3 +594,16 @@ std::unique_ptr<OperationPass<func::FuncOp>>
 mlir::iree_compiler::IREE::LinalgExt::createTopkSplitReductionPass() {
   return std::make_unique<TopkSplitReductionPass>();
 }
+
+void mlir::iree_compiler::IREE::LinalgExt::populateScanSplitReductionPattern(
+    RewritePatternSet &patterns,
+    const ScanSplitReductionControlFn &splitReductionFn,
+    const linalg::LinalgTransformationFilter &f) {
+  patterns.add<ScanOpSplitReduction>(patterns.getContext(), splitReductionFn,
+                                     f);
+}
+
+std::unique_ptr<OperationPass<func::FuncOp>>
+mlir::iree_compiler::IREE::LinalgExt::createScanSplitReductionPass() {
+  return std::make_unique<ScanSplitReductionPass>();
+}
@@ -14,19 +14,55 @@ func.func @sort_1d(%arg0: memref<128xi32>) {
 // CHECK-DAG:     %[[C128:.+]] = arith.constant 128 : index
 // CHECK-DAG:     %[[C0:.+]] = arith.constant 0 : index
 // CHECK-DAG:     %[[C1:.+]] = arith.constant 1 : index
+// CHECK-DAG:     %[[C2:.+]] = arith.constant 2 : index
+// CHECK-DAG:     %[[C63:.+]] = arith.constant 63 : index
+// CHECK-DAG:     %[[C64:.+]] = arith.constant 64 : index
 // CHECK-DAG:     %[[C127:.+]] = arith.constant 127 : index
 // CHECK:         scf.for %[[ARG1:.+]] = %[[C0]] to %[[C128]] step %[[C1]]
-// CHECK:           scf.for %[[ARG2:.+]] = %[[C0]] to %[[C127]] step %[[C1]]
-// CHECK:             %[[T1:.+]] = arith.addi %[[ARG2]], %[[C1]] : index
-// CHECK:             %[[V1:.+]] = memref.load %[[BUF]][%[[ARG2]]]
-// CHECK:             %[[V2:.+]] = memref.load %[[BUF]][%[[T1]]]
-// CHECK:             %[[COND:.+]] = arith.cmpi sgt, %[[V1]], %[[V2]] : i32
-// CHECK:             scf.if %[[COND]] {
-// CHECK:             } else {
-// CHECK:               %[[T2:.+]] = arith.addi %[[ARG2]], %[[C1]] : index
-// CHECK:               memref.store %[[V2]], %[[BUF]][%[[ARG2]]]
-// CHECK:               memref.store %[[V1]], %[[BUF]][%[[T2]]]
-// CHECK:             }
+// CHECK:           %[[FIRST:.+]] = arith.cmpi eq, %[[ARG1]], %[[C0]] : index
+// CHECK:           scf.if %[[FIRST]] {
+// CHECK:             scf.for %[[ARG2:.+]] = %[[C0]] to %[[C64]] step %[[C1]]
+// CHECK:               %[[ROOT:.+]] = arith.subi %[[C63]], %[[ARG2]] : index
+// CHECK:               scf.while (%[[NODE:.+]] = %[[ROOT]]) : (index) -> (index, index) {
+// CHECK:                 %[[T0:.+]] = arith.muli %[[NODE]], %[[C2]] : index
+// CHECK:                 %[[CHILD:.+]] = arith.addi %[[T0]], %[[C1]] : index
+// CHECK:                 %[[HAS_CHILD:.+]] = arith.cmpi ult, %[[CHILD]], %[[C128]] : index
+// CHECK:                 %[[SWAP:.+]]:2 = scf.if %[[HAS_CHILD]] -> (i1, index) {
+// CHECK:                   %[[SIBLING:.+]] = arith.addi %[[CHILD]], %[[C1]] : index
+// CHECK:                   %[[HAS_SIBLING:.+]] = arith.cmpi ult, %[[SIBLING]], %[[C128]] : index
+// CHECK:                   %[[LAST:.+]] = scf.if %[[HAS_SIBLING]] -> (index) {
+// CHECK:                     %[[V0:.+]] = memref.load %[[BUF]][%[[CHILD]]]
+// CHECK:                     %[[V1:.+]] = memref.load %[[BUF]][%[[SIBLING]]]
+// CHECK:                     %[[ORDERED:.+]] = arith.cmpi sgt, %[[V0]], %[[V1]] : i32
+// CHECK:                     %[[SELECT:.+]] = arith.select %[[ORDERED]], %[[SIBLING]], %[[CHILD]] : index
+// CHECK:                     scf.yield %[[SELECT]] : index
+// CHECK:                   } else {
+// CHECK:                     scf.yield %[[CHILD]] : index
+// CHECK:                   }
+// CHECK:                   %[[V2:.+]] = memref.load %[[BUF]][%[[NODE]]]
+// CHECK:                   %[[V3:.+]] = memref.load %[[BUF]][%[[LAST]]]
+// CHECK:                   %[[SWAP_NODE:.+]] = arith.cmpi sgt, %[[V2]], %[[V3]] : i32
+// CHECK:                   scf.yield %[[SWAP_NODE]], %[[LAST]] : i1, index
+// CHECK:                 } else {
+// CHECK:                   scf.yield %{{.+}}, %[[CHILD]] : i1, index
+// CHECK:                 }
+// CHECK:                 scf.condition(%[[SWAP]]#0) %[[NODE]], %[[SWAP]]#1 : index, index
+// CHECK:               } do {
+// CHECK:               ^bb0(%[[LHS:.+]]: index, %[[RHS:.+]]: index):
+// CHECK:                 %[[V4:.+]] = memref.load %[[BUF]][%[[LHS]]]
+// CHECK:                 %[[V5:.+]] = memref.load %[[BUF]][%[[RHS]]]
+// CHECK:                 memref.store %[[V5]], %[[BUF]][%[[LHS]]]
+// CHECK:                 memref.store %[[V4]], %[[BUF]][%[[RHS]]]
+// CHECK:                 scf.yield %[[RHS]] : index
+// CHECK:               }
+// CHECK:             scf.for %[[ARG3:.+]] = %[[C0]] to %[[C127]] step %[[C1]]
+// CHECK:               %[[END:.+]] = arith.subi %[[C127]], %[[ARG3]] : index
+// CHECK:               %[[V6:.+]] = memref.load %[[BUF]][%[[C0]]]
+// CHECK:               %[[V7:.+]] = memref.load %[[BUF]][%[[END]]]
+// CHECK:               memref.store %[[V7]], %[[BUF]][%[[C0]]]
+// CHECK:               memref.store %[[V6]], %[[BUF]][%[[END]]]
+// CHECK:               scf.while (%{{.+}} = %[[C0]]) : (index) -> (index, index) {
+// CHECK:                 arith.cmpi ult, %{{.+}}, %[[END]] : index
 
 // -----
 
@@ -45,20 +81,29 @@ func.func @sort_2d(%arg0: memref<16x32xi32>) {
 // CHECK-DAG:     %[[C32:.+]] = arith.constant 32 : index
 // CHECK-DAG:     %[[C0:.+]] = arith.constant 0 : index
 // CHECK-DAG:     %[[C1:.+]] = arith.constant 1 : index
+// CHECK-DAG:     %[[C7:.+]] = arith.constant 7 : index
+// CHECK-DAG:     %[[C8:.+]] = arith.constant 8 : index
 // CHECK-DAG:     %[[C15:.+]] = arith.constant 15 : index
 // CHECK:         scf.for %[[ARG1:.+]] = %[[C0]] to %[[C16]] step %[[C1]]
 // CHECK:           scf.for %[[ARG2:.+]] = %[[C0]] to %[[C32]] step %[[C1]]
-// CHECK:             scf.for %[[ARG3:.+]] = %[[C0]] to %[[C15]] step %[[C1]]
-// CHECK:               %[[T1:.+]] = arith.addi %[[ARG3]], %[[C1]] : index
-// CHECK:               %[[V1:.+]] = memref.load %[[BUF]][%[[ARG3]], %[[ARG2]]]
-// CHECK:               %[[V2:.+]] = memref.load %[[BUF]][%[[T1]], %[[ARG2]]]
-// CHECK:               %[[COND:.+]] = arith.cmpi sgt, %[[V1]], %[[V2]] : i32
-// CHECK:               scf.if %[[COND]] {
-// CHECK:               } else {
-// CHECK:                 %[[T2:.+]] = arith.addi %[[ARG3]], %[[C1]] : index
-// CHECK:                 memref.store %[[V2]], %[[BUF]][%[[ARG3]], %[[ARG2]]]
-// CHECK:                 memref.store %[[V1]], %[[BUF]][%[[T2]], %[[ARG2]]]
-// CHECK:               }
+// CHECK:             %[[FIRST:.+]] = arith.cmpi eq, %[[ARG1]], %[[C0]] : index
+// CHECK:             scf.if %[[FIRST]] {
+// CHECK:               scf.for %[[ARG3:.+]] = %[[C0]] to %[[C8]] step %[[C1]]
+// CHECK:                 %[[ROOT:.+]] = arith.subi %[[C7]], %[[ARG3]] : index
+// CHECK:                 scf.while (%[[NODE:.+]] = %[[ROOT]])
+// CHECK:                   %[[V0:.+]] = memref.load %[[BUF]][%{{.+}}, %[[ARG2]]]
+// CHECK:                   %[[V1:.+]] = memref.load %[[BUF]][%{{.+}}, %[[ARG2]]]
+// CHECK:                   arith.cmpi sgt, %[[V0]], %[[V1]] : i32
+// CHECK:                 } do {
+// CHECK:                 ^bb0(%[[LHS:.+]]: index, %[[RHS:.+]]: index):
+// CHECK:                   %[[V2:.+]] = memref.load %[[BUF]][%[[LHS]], %[[ARG2]]]
+// CHECK:                   %[[V3:.+]] = memref.load %[[BUF]][%[[RHS]], %[[ARG2]]]
+// CHECK:                   memref.store %[[V3]], %[[BUF]][%[[LHS]], %[[ARG2]]]
+// CHECK:                   memref.store %[[V2]], %[[BUF]][%[[RHS]], %[[ARG2]]]
+// CHECK:               scf.for %[[ARG4:.+]] = %[[C0]] to %[[C15]] step %[[C1]]
+// CHECK:                 %[[END:.+]] = arith.subi %[[C15]], %[[ARG4]] : index
+// CHECK:                 memref.load %[[BUF]][%[[C0]], %[[ARG2]]]
+// CHECK:                 memref.load %[[BUF]][%[[END]], %[[ARG2]]]
 
 // -----
 
@@ -78,23 +123,26 @@ func.func @sort_multi(%arg0: memref<128xf32>, %arg1: memref<128xi32>) {
 // CHECK-DAG:     %[[C128:.+]] = arith.constant 128 : index
 // CHECK-DAG:     %[[C0:.+]] = arith.constant 0 : index
 // CHECK-DAG:     %[[C1:.+]] = arith.constant 1 : index
-// CHECK-DAG:     %[[C127:.+]] = arith.constant 127 : index
+// CHECK-DAG:     %[[C64:.+]] = arith.constant 64 : index
 // CHECK:         scf.for %[[ARG1:.+]] = %[[C0]] to %[[C128]] step %[[C1]]
-// CHECK:           scf.for %[[ARG2:.+]] = %[[C0]] to %[[C127]] step %[[C1]]
-// CHECK:             %[[T1:.+]] = arith.addi %[[ARG2]], %[[C1]] : index
-// CHECK:             %[[V1:.+]] = memref.load %[[BUF1]][%[[ARG2]]]
-// CHECK:             %[[V2:.+]] = memref.load %[[BUF1]][%[[T1]]]
-// CHECK:             %[[V3:.+]] = memref.load %[[BUF2]][%[[ARG2]]]
-// CHECK:             %[[V4:.+]] = memref.load %[[BUF2]][%[[T1]]]
-// CHECK:             %[[COND:.+]] = arith.cmpf ogt, %[[V1]], %[[V2]] : f32
-// CHECK:             scf.if %[[COND]] {
-// CHECK:             } else {
-// CHECK:               %[[T2:.+]] = arith.addi %[[ARG2]], %[[C1]] : index
-// CHECK:               memref.store %[[V2]], %[[BUF1]][%[[ARG2]]]
-// CHECK:               memref.store %[[V1]], %[[BUF1]][%[[T2]]]
-// CHECK:               memref.store %[[V4]], %[[BUF2]][%[[ARG2]]]
-// CHECK:               memref.store %[[V3]], %[[BUF2]][%[[T2]]]
-// CHECK:             }
+// CHECK:           scf.if
+// CHECK:             scf.for %[[ARG2:.+]] = %[[C0]] to %[[C64]] step %[[C1]]
+// CHECK:               scf.while
+// CHECK:                 %[[V0:.+]] = memref.load %[[BUF1]][%[[CHILD:.+]]]
+// CHECK:                 %[[V1:.+]] = memref.load %[[BUF1]][%[[SIBLING:.+]]]
+// CHECK:                 memref.load %[[BUF2]][%[[CHILD]]]
+// CHECK:                 memref.load %[[BUF2]][%[[SIBLING]]]
+// CHECK:                 arith.cmpf ogt, %[[V0]], %[[V1]] : f32
+// CHECK:               } do {
+// CHECK:               ^bb0(%[[LHS:.+]]: index, %[[RHS:.+]]: index):
+// CHECK:                 %[[V2:.+]] = memref.load %[[BUF1]][%[[LHS]]]
+// CHECK:                 %[[V3:.+]] = memref.load %[[BUF1]][%[[RHS]]]
+// CHECK:                 memref.store %[[V3]], %[[BUF1]][%[[LHS]]]
+// CHECK:                 memref.store %[[V2]], %[[BUF1]][%[[RHS]]]
+// CHECK:                 %[[V4:.+]] = memref.load %[[BUF2]][%[[LHS]]]
+// CHECK:                 %[[V5:.+]] = memref.load %[[BUF2]][%[[RHS]]]
+// CHECK:                 memref.store %[[V5]], %[[BUF2]][%[[LHS]]]
+// CHECK:                 memref.store %[[V4]], %[[BUF2]][%[[RHS]]]
 
 // -----
 
@@ -658,6 +706,18 @@ func.func @topk_memref(%input_values: memref<2x10xf32>, %input_indices: memref<2
 // CHECK:           scf.for %[[ARG5:.+]] = %[[C0]] to %[[C10]] step %[[C1]]
 // CHECK:             %[[D0:.+]] = memref.load %[[ARG0]][%[[ARG4]], %[[ARG5]]]
 // CHECK:             %[[D1:.+]] = memref.load %[[ARG1]][%[[ARG4]], %[[ARG5]]]
+// CHECK:             %[[SELECTED:.+]] = scf.if %{{.+}} -> (i1) {
+// CHECK:               %[[LAST_VALUE:.+]] = memref.load %[[ARG2]][%[[ARG4]], %[[C2]]]
+// CHECK:               %[[LAST_INDEX:.+]] = memref.load %[[ARG3]][%[[ARG4]], %[[C2]]]
+// CHECK:               %[[FORWARD:.+]] = arith.cmpf ogt, %[[D0]], %[[LAST_VALUE]] : f32
+// CHECK:               %[[REVERSE:.+]] = arith.cmpf ogt, %[[LAST_VALUE]], %[[D0]] : f32
+// CHECK:               %[[EQUAL:.+]] = arith.cmpi eq, %[[FORWARD]], %[[REVERSE]] : i1
+// CHECK:               %[[FIRST:.+]] = arith.cmpi slt, %[[D1]], %[[LAST_INDEX]] : i32
+// CHECK:               %[[TIE:.+]] = arith.andi %[[EQUAL]], %[[FIRST]] : i1
+// CHECK:               %[[IS_SELECTED:.+]] = arith.ori %[[FORWARD]], %[[TIE]] : i1
+// CHECK:               scf.yield %[[IS_SELECTED]] : i1
+// CHECK:             }
+// CHECK:             scf.if %[[SELECTED]] {
 // CHECK:             %[[D2:.+]]:2 = scf.for %[[ARG6:.+]] = %[[C0]] to %[[C3]] step %[[C1]] iter_args(%[[ARG7:.+]] = %[[D0]], %[[ARG8:.+]] = %[[D1]])
 // CHECK:               %[[D3:.+]] = memref.load %[[ARG2]][%[[ARG4]], %[[ARG6]]]
 // CHECK:               %[[D4:.+]] = memref.load %[[ARG3]][%[[ARG4]], %[[ARG6]]]
@@ -763,3 +823,58 @@ func.func @topk_memref_optional(%input_values: memref<2x10xf32>, %out_values: me
 // CHECK:               %[[D13:.+]] = arith.select %[[D5]], %[[D3]], %[[ARG6]] : f32
 // CHECK:               %[[D14:.+]] = arith.select %[[D10]], %[[D4]], %[[ARG7]] : i32
 // CHECK:               scf.yield %[[D13]], %[[D14]] : f32, i32
+
+// -----
+
+func.func @attention(%query: memref<2x8x16xf32>, %key: memref<2x32x16xf32>, %value: memref<2x32x24xf32>, %output: memref<2x8x24xf32>) {
+  iree_linalg_ext.attention
+    ins(%query, %key, %value : memref<2x8x16xf32>, memref<2x32x16xf32>, memref<2x32x24xf32>)
+    outs(%output : memref<2x8x24xf32>)
+  return
+}
+// CHECK-LABEL: func.func @attention
+// CHECK-SAME:    %[[QUERY:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[KEY:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[VALUE:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[OUTPUT:[a-zA-Z0-9]+]]
+// CHECK-DAG:     %[[C0:.+]] = arith.constant 0 : index
+// CHECK-DAG:     %[[C1:.+]] = arith.constant 1 : index
+// CHECK-DAG:     %[[C2:.+]] = arith.constant 2 : index
+// CHECK-DAG:     %[[C8:.+]] = arith.constant 8 : index
+// CHECK-DAG:     %[[C16:.+]] = arith.constant 16 : index
+// CHECK-DAG:     %[[C24:.+]] = arith.constant 24 : index
+// CHECK-DAG:     %[[C32:.+]] = arith.constant 32 : index
+// CHECK-DAG:     %[[ZERO:.+]] = arith.constant 0.000000e+00 : f32
+// CHECK-DAG:     %[[NEG_INF:.+]] = arith.constant 0xFF800000 : f32
+// CHECK:         scf.for %[[B:.+]] = %[[C0]] to %[[C2]] step %[[C1]]
+// CHECK:           scf.for %[[N:.+]] = %[[C0]] to %[[C8]] step %[[C1]]
+// CHECK:             scf.for %[[K0:.+]] = %[[C0]] to %[[C24]] step %[[C1]]
+// CHECK:               memref.store %[[ZERO]], %[[OUTPUT]][%[[B]], %[[N]], %[[K0]]]
+// CHECK:             %[[ROW:.+]]:2 = scf.for %[[S:.+]] = %[[C0]] to %[[C32]] step %[[C1]]
+// CHECK-SAME:            iter_args(%[[MAX:.+]] = %[[NEG_INF]], %[[SUM:.+]] = %[[ZERO]])
+// CHECK:               %[[SCORE:.+]] = scf.for %[[K1:.+]] = %[[C0]] to %[[C16]] step %[[C1]]
+// CHECK-SAME:              iter_args(%[[ACC:.+]] = %[[ZERO]])
+// CHECK:                 %[[Q:.+]] = memref.load %[[QUERY]][%[[B]], %[[N]], %[[K1]]]
+// CHECK:                 %[[K:.+]] = memref.load %[[KEY]][%[[B]], %[[S]], %[[K1]]]
+// CHECK:                 %[[QK:.+]] = arith.mulf %[[Q]], %[[K]]
+// CHECK:                 %[[NEW_ACC:.+]] = arith.addf %[[ACC]], %[[QK]]
+// CHECK:                 scf.yield %[[NEW_ACC]]
+// CHECK:               %[[NEW_MAX:.+]] = arith.maxf %[[MAX]], %[[SCORE]]
+// CHECK:               %[[T0:.+]] = arith.subf %[[MAX]], %[[NEW_MAX]]
+// CHECK:               %[[CORRECTION:.+]] = math.exp %[[T0]]
+// CHECK:               %[[T1:.+]] = arith.subf %[[SCORE]], %[[NEW_MAX]]
+// CHECK:               %[[P:.+]] = math.exp %[[T1]]
+// CHECK:               %[[T2:.+]] = arith.mulf %[[SUM]], %[[CORRECTION]]
+// CHECK:               %[[NEW_SUM:.+]] = arith.addf %[[T2]], %[[P]]
+// CHECK:               scf.for %[[K2:.+]] = %[[C0]] to %[[C24]] step %[[C1]]
+// CHECK:                 %[[O:.+]] = memref.load %[[OUTPUT]][%[[B]], %[[N]], %[[K2]]]
+// CHECK:                 %[[V:.+]] = memref.load %[[VALUE]][%[[B]], %[[S]], %[[K2]]]
+// CHECK:                 %[[T3:.+]] = arith.mulf %[[O]], %[[CORRECTION]]
+// CHECK:                 %[[T4:.+]] = arith.mulf %[[P]], %[[V]]
+// CHECK:                 %[[T5:.+]] = arith.addf %[[T3]], %[[T4]]
+// CHECK:                 memref.store %[[T5]], %[[OUTPUT]][%[[B]], %[[N]], %[[K2]]]
+// CHECK:               scf.yield %[[NEW_MAX]], %[[NEW_SUM]]
+// CHECK:             scf.for %[[K3:.+]] = %[[C0]] to %[[C24]] step %[[C1]]
+// CHECK:               %[[O1:.+]] = memref.load %[[OUTPUT]][%[[B]], %[[N]], %[[K3]]]
+// CHECK:               %[[R:.+]] = arith.divf %[[O1]], %[[ROW]]#1
+// CHECK:               memref.store %[[R]], %[[OUTPUT]][%[[B]], %[[N]], %[[K3]]]
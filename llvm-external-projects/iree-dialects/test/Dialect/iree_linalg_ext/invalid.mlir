@@ -508,3 +508,33 @@ func.func @topk_invalid(%input_values: tensor<3x10xf32>, %input_indices: tensor<
         } -> tensor<2x3xf32>, tensor<2x3xi32>
   return %0#0, %0#1 : tensor<2x3xf32>, tensor<2x3xi32>
 }
+
+// -----
+
+func.func @attention_invalid_rank(%query: tensor<32x64xf32>, %key: tensor<128x64xf32>, %value: tensor<128x64xf32>, %output: tensor<32x64xf32>) -> tensor<32x64xf32> {
+  // expected-error@+1 {{expected all operands to be of rank 3}}
+  %0 = iree_linalg_ext.attention
+        ins(%query, %key, %value : tensor<32x64xf32>, tensor<128x64xf32>, tensor<128x64xf32>)
+        outs(%output : tensor<32x64xf32>) -> tensor<32x64xf32>
+  return %0 : tensor<32x64xf32>
+}
+
+// -----
+
+func.func @attention_invalid_head_dim(%query: tensor<4x32x64xf32>, %key: tensor<4x128x32xf32>, %value: tensor<4x128x64xf32>, %output: tensor<4x32x64xf32>) -> tensor<4x32x64xf32> {
+  // expected-error@+1 {{incompatible query/key head dimensions}}
+  %0 = iree_linalg_ext.attention
+        ins(%query, %key, %value : tensor<4x32x64xf32>, tensor<4x128x32xf32>, tensor<4x128x64xf32>)
+        outs(%output : tensor<4x32x64xf32>) -> tensor<4x32x64xf32>
+  return %0 : tensor<4x32x64xf32>
+}
+
+// -----
+
+func.func @attention_invalid_sequence_length(%query: tensor<4x32x64xf32>, %key: tensor<4x128x64xf32>, %value: tensor<4x96x64xf32>, %output: tensor<4x32x64xf32>) -> tensor<4x32x64xf32> {
+  // expected-error@+1 {{incompatible key/value sequence lengths}}
+  %0 = iree_linalg_ext.attention
+        ins(%query, %key, %value : tensor<4x32x64xf32>, tensor<4x128x64xf32>, tensor<4x96x64xf32>)
+        outs(%output : tensor<4x32x64xf32>) -> tensor<4x32x64xf32>
+  return %0 : tensor<4x32x64xf32>
+}
@@ -643,3 +643,39 @@ func.func @topk_tensor_optional(%input_values: tensor<20x10x8x4xf32>) -> (tensor
 //  CHECK-SAME:      outs(%[[OUT_VALUES]], %[[OUT_INDICES]]
 //       CHECK:      iree_linalg_ext.yield
 //       CHECK:   return %[[RESULT]]#0, %[[RESULT]]#1
+
+// -----
+
+func.func @attention_tensor(%query: tensor<4x32x64xf32>, %key: tensor<4x128x64xf32>, %value: tensor<4x128x48xf32>) -> tensor<4x32x48xf32> {
+  %init = linalg.init_tensor [4, 32, 48] : tensor<4x32x48xf32>
+  %0 = iree_linalg_ext.attention
+        ins(%query, %key, %value : tensor<4x32x64xf32>, tensor<4x128x64xf32>, tensor<4x128x48xf32>)
+        outs(%init : tensor<4x32x48xf32>) -> tensor<4x32x48xf32>
+  return %0 : tensor<4x32x48xf32>
+}
+// CHECK-LABEL: func.func @attention_tensor
+//  CHECK-SAME:   %[[QUERY:[a-zA-Z0-9]+]]: tensor<4x32x64xf32>
+//  CHECK-SAME:   %[[KEY:[a-zA-Z0-9]+]]: tensor<4x128x64xf32>
+//  CHECK-SAME:   %[[VALUE:[a-zA-Z0-9]+]]: tensor<4x128x48xf32>
+//       CHECK:   %[[INIT:.+]] = linalg.init_tensor [4, 32, 48]
+//       CHECK:   %[[RESULT:.+]] = iree_linalg_ext.attention
+//  CHECK-SAME:      ins(%[[QUERY]], %[[KEY]], %[[VALUE]]
+//  CHECK-SAME:      outs(%[[INIT]]
+//       CHECK:   return %[[RESULT]]
+
+// -----
+
+func.func @attention_memref(%query: memref<?x?x?xf16>, %key: memref<?x?x?xf16>, %value: memref<?x?x?xf16>, %output: memref<?x?x?xf16>) {
+  iree_linalg_ext.attention
+        ins(%query, %key, %value : memref<?x?x?xf16>, memref<?x?x?xf16>, memref<?x?x?xf16>)
+        outs(%output : memref<?x?x?xf16>)
+  return
+}
+// CHECK-LABEL: func.func @attention_memref
+//  CHECK-SAME:   %[[QUERY:[a-zA-Z0-9]+]]: memref<?x?x?xf16>
+//  CHECK-SAME:   %[[KEY:[a-zA-Z0-9]+]]: memref<?x?x?xf16>
+//  CHECK-SAME:   %[[VALUE:[a-zA-Z0-9]+]]: memref<?x?x?xf16>
+//  CHECK-SAME:   %[[OUTPUT:[a-zA-Z0-9]+]]: memref<?x?x?xf16>
+//       CHECK:   iree_linalg_ext.attention
+//  CHECK-SAME:      ins(%[[QUERY]], %[[KEY]], %[[VALUE]]
+//  CHECK-SAME:      outs(%[[OUTPUT]]
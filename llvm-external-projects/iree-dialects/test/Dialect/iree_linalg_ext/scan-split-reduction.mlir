@@ -0,0 +1,89 @@
+// RUN: iree-dialects-opt --split-input-file --iree-linalg-ext-scan-split-reduction='split-ratio=4' %s | FileCheck %s
+
+func.func @scan_split_reduction_1d(%input: tensor<128xi32>, %output: tensor<128xi32>, %acc: tensor<i32>) -> (tensor<128xi32>, tensor<i32>) {
+  %0:2 = iree_linalg_ext.scan
+        dimension(0) inclusive(true)
+        ins(%input : tensor<128xi32>)
+        outs(%output, %acc : tensor<128xi32>, tensor<i32>) {
+        ^bb0(%arg0 : i32, %arg1 : i32):
+          %sum = arith.addi %arg0, %arg1 : i32
+          iree_linalg_ext.yield %sum : i32
+        } -> tensor<128xi32>, tensor<i32>
+  return %0#0, %0#1 : tensor<128xi32>, tensor<i32>
+}
+
+// CHECK-DAG:     #[[MAP0:.+]] = affine_map<(d0, d1) -> (d0)>
+// CHECK-DAG:     #[[MAP1:.+]] = affine_map<(d0, d1) -> (d0, d1)>
+// CHECK-LABEL: func.func @scan_split_reduction_1d(
+// CHECK-SAME:    %[[INPUT:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[OUTPUT:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[ACC:[a-zA-Z0-9]+]]
+// CHECK:         %[[EXPANDED:.+]] = tensor.expand_shape %[[INPUT]] {{\[\[}}0, 1]] : tensor<128xi32> into tensor<4x32xi32>
+// CHECK:         %[[PARTIAL_INIT:.+]] = linalg.init_tensor [4, 32] : tensor<4x32xi32>
+// CHECK:         %[[TOTALS_INIT:.+]] = linalg.init_tensor [4] : tensor<4xi32>
+// CHECK:         %[[BLOCKS:.+]]:2 = iree_linalg_ext.scan {__internal_linalg_transform__ = "SPLIT_REDUCTION"} dimension(1) inclusive(true)
+// CHECK-SAME:      ins(%[[EXPANDED]] : tensor<4x32xi32>) outs(%[[PARTIAL_INIT]], %[[TOTALS_INIT]] : tensor<4x32xi32>, tensor<4xi32>)
+// CHECK:           arith.addi
+// CHECK:         %[[CARRY_INIT:.+]] = linalg.init_tensor [4] : tensor<4xi32>
+// CHECK:         %[[CARRY:.+]]:2 = iree_linalg_ext.scan {__internal_linalg_transform__ = "SPLIT_REDUCTION"} dimension(0) inclusive(true)
+// CHECK-SAME:      ins(%[[BLOCKS]]#1 : tensor<4xi32>) outs(%[[CARRY_INIT]], %[[ACC]] : tensor<4xi32>, tensor<i32>)
+// CHECK:           arith.addi
+// CHECK:         %[[TAIL:.+]] = tensor.extract_slice %[[BLOCKS]]#0[1, 0] [3, 32] [1, 1] : tensor<4x32xi32> to tensor<3x32xi32>
+// CHECK:         %[[PRECEDING:.+]] = tensor.extract_slice %[[CARRY]]#0[0] [3] [1] : tensor<4xi32> to tensor<3xi32>
+// CHECK:         %[[COMBINED:.+]] = linalg.generic
+// CHECK-SAME:      indexing_maps = [#[[MAP0]], #[[MAP1]]]
+// CHECK-SAME:      iterator_types = ["parallel", "parallel"]
+// CHECK-SAME:      ins(%[[PRECEDING]] : tensor<3xi32>) outs(%[[TAIL]] : tensor<3x32xi32>)
+// CHECK:         ^bb0(%[[LHS:.+]]: i32, %[[RHS:.+]]: i32):
+// CHECK:           %[[SUM:.+]] = arith.addi %[[LHS]], %[[RHS]] : i32
+// CHECK:           linalg.yield %[[SUM]] : i32
+// CHECK:         %[[INSERTED:.+]] = tensor.insert_slice %[[COMBINED]] into %[[BLOCKS]]#0[1, 0] [3, 32] [1, 1] : tensor<3x32xi32> into tensor<4x32xi32>
+// CHECK:         %[[RESULT:.+]] = tensor.collapse_shape %[[INSERTED]] {{\[\[}}0, 1]] : tensor<4x32xi32> into tensor<128xi32>
+// CHECK:         return %[[RESULT]], %[[CARRY]]#1 : tensor<128xi32>, tensor<i32>
+
+// -----
+
+func.func @scan_split_reduction_2d(%input: tensor<16x64xf32>, %output: tensor<16x64xf32>, %acc: tensor<64xf32>) -> (tensor<16x64xf32>, tensor<64xf32>) {
+  %0:2 = iree_linalg_ext.scan
+        dimension(0) inclusive(true)
+        ins(%input : tensor<16x64xf32>)
+        outs(%output, %acc : tensor<16x64xf32>, tensor<64xf32>) {
+        ^bb0(%arg0 : f32, %arg1 : f32):
+          %sum = arith.addf %arg0, %arg1 : f32
+          iree_linalg_ext.yield %sum : f32
+        } -> tensor<16x64xf32>, tensor<64xf32>
+  return %0#0, %0#1 : tensor<16x64xf32>, tensor<64xf32>
+}
+
+// CHECK-DAG:     #[[MAP0:.+]] = affine_map<(d0, d1, d2) -> (d0, d2)>
+// CHECK-DAG:     #[[MAP1:.+]] = affine_map<(d0, d1, d2) -> (d0, d1, d2)>
+// CHECK-LABEL: func.func @scan_split_reduction_2d(
+// CHECK:         %[[EXPANDED:.+]] = tensor.expand_shape %{{.+}} {{\[\[}}0, 1], [2]] : tensor<16x64xf32> into tensor<4x4x64xf32>
+// CHECK:         %[[BLOCKS:.+]]:2 = iree_linalg_ext.scan {__internal_linalg_transform__ = "SPLIT_REDUCTION"} dimension(1) inclusive(true)
+// CHECK-SAME:      ins(%[[EXPANDED]] : tensor<4x4x64xf32>) outs(%{{.+}}, %{{.+}} : tensor<4x4x64xf32>, tensor<4x64xf32>)
+// CHECK:         %[[CARRY:.+]]:2 = iree_linalg_ext.scan {__internal_linalg_transform__ = "SPLIT_REDUCTION"} dimension(0) inclusive(true)
+// CHECK-SAME:      ins(%[[BLOCKS]]#1 : tensor<4x64xf32>) outs(%{{.+}}, %{{.+}} : tensor<4x64xf32>, tensor<64xf32>)
+// CHECK:         %[[TAIL:.+]] = tensor.extract_slice %[[BLOCKS]]#0[1, 0, 0] [3, 4, 64] [1, 1, 1]
+// CHECK:         %[[PRECEDING:.+]] = tensor.extract_slice %[[CARRY]]#0[0, 0] [3, 64] [1, 1]
+// CHECK:         linalg.generic
+// CHECK-SAME:      indexing_maps = [#[[MAP0]], #[[MAP1]]]
+// CHECK-SAME:      ins(%[[PRECEDING]] : tensor<3x64xf32>) outs(%[[TAIL]] : tensor<3x4x64xf32>)
+// CHECK:         tensor.collapse_shape %{{.+}} {{\[\[}}0, 1], [2]] : tensor<4x4x64xf32> into tensor<16x64xf32>
+
+// -----
+
+func.func @scan_split_reduction_exclusive(%input: tensor<128xi32>, %output: tensor<128xi32>, %acc: tensor<i32>) -> (tensor<128xi32>, tensor<i32>) {
+  %0:2 = iree_linalg_ext.scan
+        dimension(0) inclusive(false)
+        ins(%input : tensor<128xi32>)
+        outs(%output, %acc : tensor<128xi32>, tensor<i32>) {
+        ^bb0(%arg0 : i32, %arg1 : i32):
+          %sum = arith.addi %arg0, %arg1 : i32
+          iree_linalg_ext.yield %sum : i32
+        } -> tensor<128xi32>, tensor<i32>
+  return %0#0, %0#1 : tensor<128xi32>, tensor<i32>
+}
+
+// CHECK-LABEL: func.func @scan_split_reduction_exclusive(
+// CHECK-NOT:     tensor.expand_shape
+// CHECK:         iree_linalg_ext.scan dimension(0) inclusive(false)
@@ -926,3 +926,40 @@ func.func @topk_tile_tensor_optional(%input_values: tensor<20x10xf32>, %out_valu
 // CHECK:           %[[D7:.+]] = tensor.insert_slice %[[D5]]#1 into %[[ARG5]][%[[ARG3]], 0] [%[[D1]], %[[C3]]] [1, 1]
 // CHECK:           scf.yield %[[D6]], %[[D7]]
 // CHECK:           return %[[RESULT]]#0, %[[RESULT]]#1
+
+// -----
+
+func.func @attention_tile_tensor(%query: tensor<20x40x16xf32>, %key: tensor<20x64x16xf32>, %value: tensor<20x64x32xf32>, %output: tensor<20x40x32xf32>) -> tensor<20x40x32xf32> {
+  %0 = iree_linalg_ext.attention
+        {__internal_linalg_transform__ = "tiling_input"}
+        ins(%query, %key, %value : tensor<20x40x16xf32>, tensor<20x64x16xf32>, tensor<20x64x32xf32>)
+        outs(%output : tensor<20x40x32xf32>) -> tensor<20x40x32xf32>
+  return %0 : tensor<20x40x32xf32>
+}
+// CHECK-LABEL: func.func @attention_tile_tensor
+// CHECK-SAME:    %[[QUERY:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[KEY:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[VALUE:[a-zA-Z0-9]+]]
+// CHECK-SAME:    %[[OUTPUT:[a-zA-Z0-9]+]]
+// CHECK-DAG:     %[[C0:.+]] = arith.constant 0 : index
+// CHECK-DAG:     %[[C10:.+]] = arith.constant 10 : index
+// CHECK-DAG:     %[[C20:.+]] = arith.constant 20 : index
+// CHECK-DAG:     %[[C40:.+]] = arith.constant 40 : index
+// CHECK:         %[[RESULT:.+]] = scf.for %[[B:.+]] = %[[C0]] to %[[C20]] step %[[C10]]
+// CHECK-SAME:        iter_args(%[[ARG0:.+]] = %[[OUTPUT]])
+// CHECK:           %[[B_SIZE:.+]] = affine.min
+// CHECK:           %[[INNER:.+]] = scf.for %[[N:.+]] = %[[C0]] to %[[C40]] step %[[C20]]
+// CHECK-SAME:          iter_args(%[[ARG1:.+]] = %[[ARG0]])
+// CHECK:             %[[N_SIZE:.+]] = affine.min
+// CHECK:             %[[QUERY_SLICE:.+]] = tensor.extract_slice %[[QUERY]][%[[B]], %[[N]], 0] [%[[B_SIZE]], %[[N_SIZE]], 16] [1, 1, 1]
+// CHECK:             %[[KEY_SLICE:.+]] = tensor.extract_slice %[[KEY]][%[[B]], 0, 0] [%[[B_SIZE]], 64, 16] [1, 1, 1]
+// CHECK:             %[[VALUE_SLICE:.+]] = tensor.extract_slice %[[VALUE]][%[[B]], 0, 0] [%[[B_SIZE]], 64, 32] [1, 1, 1]
+// CHECK:             %[[OUTPUT_SLICE:.+]] = tensor.extract_slice %[[ARG1]][%[[B]], %[[N]], 0] [%[[B_SIZE]], %[[N_SIZE]], 32] [1, 1, 1]
+// CHECK:             %[[TILE:.+]] = iree_linalg_ext.attention
+// CHECK-SAME:            {__internal_linalg_transform__ = "tiling_output"}
+// CHECK-SAME:            ins(%[[QUERY_SLICE]], %[[KEY_SLICE]], %[[VALUE_SLICE]]
+// CHECK-SAME:            outs(%[[OUTPUT_SLICE]]
+// CHECK:             %[[UPDATE:.+]] = tensor.insert_slice %[[TILE]] into %[[ARG1]][%[[B]], %[[N]], 0] [%[[B_SIZE]], %[[N_SIZE]], 32] [1, 1, 1]
+// CHECK:             scf.yield %[[UPDATE]]
+// CHECK:           scf.yield %[[INNER]]
+// CHECK:         return %[[RESULT]]
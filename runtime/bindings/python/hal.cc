@@ -6,6 +6,9 @@
 
 #include "./hal.h"
 
+#include <cstring>
+#include <memory>
+
 #include "iree/base/tracing.h"
 #include "iree/hal/api.h"
 #include "pybind11/numpy.h"
@@ -244,6 +247,364 @@ HalDevice HalDriver::CreateDefaultDevice() {
   return HalDevice::StealFromRawPtr(device);
 }
 
+//------------------------------------------------------------------------------
+// DLPack interop
+//------------------------------------------------------------------------------
+
+namespace {
+
+// ABI-compatible subset of the DLPack v0.8 C API (dlpack/dlpack.h). Only the
+// structures are needed and defining them here avoids taking a dependency.
+// See: https://dmlc.github.io/dlpack/latest/c_api.html
+enum DLDeviceType : int32_t {
+  kDLCPU = 1,
+  kDLCUDA = 2,
+  kDLCUDAHost = 3,
+};
+enum DLDataTypeCode : uint8_t {
+  kDLInt = 0,
+  kDLUInt = 1,
+  kDLFloat = 2,
+  kDLBfloat = 4,
+  kDLComplex = 5,
+  kDLBool = 6,
+};
+struct DLDevice {
+  int32_t device_type;
+  int32_t device_id;
+};
+struct DLDataType {
+  uint8_t code;
+  uint8_t bits;
+  uint16_t lanes;
+};
+struct DLTensor {
+  void* data;
+  DLDevice device;
+  int32_t ndim;
+  DLDataType dtype;
+  int64_t* shape;
+  int64_t* strides;
+  uint64_t byte_offset;
+};
+struct DLManagedTensor {
+  DLTensor dl_tensor;
+  void* manager_ctx;
+  void (*deleter)(DLManagedTensor* self);
+};
+
+// Capsule names as defined by the Python array API standard. Consumers rename
+// the capsule to kUsedDLTensorCapsuleName once they take ownership.
+static const char kDLTensorCapsuleName[] = "dltensor";
+static const char kUsedDLTensorCapsuleName[] = "used_dltensor";
+
+// Returns the device ordinal used by DLPack to identify |device|, if any.
+static int32_t QueryDLPackDeviceId(iree_hal_device_t* device) {
+  int64_t ordinal = 0;
+  iree_status_t status = iree_hal_device_query_i64(
+      device, IREE_SV("hal.device"), IREE_SV("ordinal"), &ordinal);
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    return 0;
+  }
+  return (int32_t)ordinal;
+}
+
+// Returns true if |device| is backed by CUDA such that DEVICE_ALLOCATION
+// external buffers are CUdeviceptrs.
+static bool IsCudaDevice(iree_hal_device_t* device) {
+  return iree_string_view_starts_with(iree_hal_device_id(device),
+                                      IREE_SV("cuda"));
+}
+
+static DLDataType MapElementTypeToDLDataType(
+    iree_hal_element_type_t element_type) {
+  DLDataType dtype;
+  dtype.bits = (uint8_t)iree_hal_element_bit_count(element_type);
+  dtype.lanes = 1;
+  switch (iree_hal_element_numerical_type(element_type)) {
+    case IREE_HAL_NUMERICAL_TYPE_INTEGER:
+    case IREE_HAL_NUMERICAL_TYPE_INTEGER_SIGNED:
+      dtype.code = kDLInt;
+      break;
+    case IREE_HAL_NUMERICAL_TYPE_INTEGER_UNSIGNED:
+      dtype.code = kDLUInt;
+      break;
+    case IREE_HAL_NUMERICAL_TYPE_BOOLEAN:
+      dtype.code = kDLBool;
+      break;
+    case IREE_HAL_NUMERICAL_TYPE_FLOAT_IEEE:
+      dtype.code = kDLFloat;
+      break;
+    case IREE_HAL_NUMERICAL_TYPE_FLOAT_BRAIN:
+      dtype.code = kDLBfloat;
+      break;
+    case IREE_HAL_NUMERICAL_TYPE_FLOAT_COMPLEX:
+      dtype.code = kDLComplex;
+      break;
+    default:
+      throw RaiseValueError("Element type has no DLPack equivalent");
+  }
+  if (!iree_hal_element_is_byte_aligned(element_type)) {
+    throw RaiseValueError("Sub-byte element types have no DLPack equivalent");
+  }
+  return dtype;
+}
+
+static iree_hal_element_type_t MapDLDataTypeToElementType(DLDataType dtype) {
+  if (dtype.lanes != 1) {
+    throw RaiseValueError("Vectorized DLPack types are not supported");
+  }
+  iree_hal_numerical_type_t numerical_type;
+  switch (dtype.code) {
+    case kDLInt:
+      numerical_type = IREE_HAL_NUMERICAL_TYPE_INTEGER_SIGNED;
+      break;
+    case kDLUInt:
+      numerical_type = IREE_HAL_NUMERICAL_TYPE_INTEGER_UNSIGNED;
+      break;
+    case kDLBool:
+      numerical_type = IREE_HAL_NUMERICAL_TYPE_BOOLEAN;
+      break;
+    case kDLFloat:
+      numerical_type = IREE_HAL_NUMERICAL_TYPE_FLOAT_IEEE;
+      break;
+    case kDLBfloat:
+      numerical_type = IREE_HAL_NUMERICAL_TYPE_FLOAT_BRAIN;
+      break;
+    case kDLComplex:
+      numerical_type = IREE_HAL_NUMERICAL_TYPE_FLOAT_COMPLEX;
+      break;
+    default:
+      throw RaiseValueError("Unsupported DLPack data type code");
+  }
+  if (dtype.bits == 0 || (dtype.bits % 8) != 0) {
+    throw RaiseValueError("Sub-byte DLPack data types are not supported");
+  }
+  return iree_hal_make_element_type(numerical_type, dtype.bits);
+}
+
+// Owns everything a DLManagedTensor exported from a buffer view references.
+// The buffer view is retained (and thus the backing buffer and allocator) for
+// as long as the consumer holds on to the tensor.
+struct ExportedDLManagedTensor {
+  DLManagedTensor managed;
+  iree_hal_buffer_view_t* buffer_view = nullptr;
+  // Non-empty if the exported pointer is from a scoped mapping.
+  iree_hal_buffer_mapping_t mapping = {{0}};
+  bool has_mapping = false;
+  std::vector<int64_t> shape;
+
+  static void Delete(DLManagedTensor* self) {
+    auto* exported = static_cast<ExportedDLManagedTensor*>(self->manager_ctx);
+    if (exported->has_mapping) {
+      iree_status_ignore(iree_hal_buffer_unmap_range(&exported->mapping));
+    }
+    iree_hal_buffer_view_release(exported->buffer_view);
+    delete exported;
+  }
+};
+
+// Capsule destructor that deletes the tensor only if no consumer took it.
+static void DLTensorCapsuleDestructor(PyObject* capsule) {
+  if (!PyCapsule_IsValid(capsule, kDLTensorCapsuleName)) return;
+  auto* managed = static_cast<DLManagedTensor*>(
+      PyCapsule_GetPointer(capsule, kDLTensorCapsuleName));
+  if (managed && managed->deleter) managed->deleter(managed);
+}
+
+// Returns the (device_type, device_id) |buffer_view| would be exported with and
+// the external buffer handle referencing its contents.
+static DLDevice ResolveDLPackExport(HalDevice& device,
+                                    iree_hal_buffer_view_t* buffer_view,
+                                    iree_hal_external_buffer_t* out_external) {
+  iree_hal_buffer_t* buffer = iree_hal_buffer_view_buffer(buffer_view);
+  iree_hal_memory_type_t memory_type = iree_hal_buffer_memory_type(buffer);
+  if (iree_all_bits_set(memory_type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE)) {
+    // Host memory may be consumed directly by the CPU. Allocators that cannot
+    // export a stable host pointer fall back to a mapping owned by the tensor.
+    iree_status_t status = iree_hal_allocator_export_buffer(
+        device.allocator(), buffer,
+        IREE_HAL_EXTERNAL_BUFFER_TYPE_HOST_ALLOCATION,
+        IREE_HAL_EXTERNAL_BUFFER_FLAG_NONE, out_external);
+    if (!iree_status_is_ok(status)) {
+      iree_status_ignore(status);
+      out_external->type = IREE_HAL_EXTERNAL_BUFFER_TYPE_NONE;
+    }
+    return {kDLCPU, 0};
+  }
+  if (IsCudaDevice(device.raw_ptr())) {
+    CheckApiStatus(iree_hal_allocator_export_buffer(
+                       device.allocator(), buffer,
+                       IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION,
+                       IREE_HAL_EXTERNAL_BUFFER_FLAG_NONE, out_external),
+                   "Could not export device buffer");
+    return {kDLCUDA, QueryDLPackDeviceId(device.raw_ptr())};
+  }
+  throw RaiseValueError(
+      "Buffer is neither host visible nor exportable from this device; "
+      "transfer it to the host first");
+}
+
+py::tuple DLPackDeviceOf(HalDevice& device, HalBufferView& buffer_view) {
+  iree_hal_external_buffer_t external;
+  memset(&external, 0, sizeof(external));
+  DLDevice dl_device =
+      ResolveDLPackExport(device, buffer_view.raw_ptr(), &external);
+  return py::make_tuple(dl_device.device_type, dl_device.device_id);
+}
+
+py::capsule ExportDLPack(HalDevice& device, HalBufferView& buffer_view) {
+  IREE_TRACE_SCOPE0("HalDevice::ExportDLPack");
+  iree_hal_buffer_view_t* bv = buffer_view.raw_ptr();
+  iree_hal_buffer_t* buffer = iree_hal_buffer_view_buffer(bv);
+  iree_hal_external_buffer_t external;
+  memset(&external, 0, sizeof(external));
+  DLDevice dl_device = ResolveDLPackExport(device, bv, &external);
+
+  iree_hal_element_type_t element_type = iree_hal_buffer_view_element_type(bv);
+  auto exported = std::make_unique<ExportedDLManagedTensor>();
+  void* data = nullptr;
+  switch (external.type) {
+    case IREE_HAL_EXTERNAL_BUFFER_TYPE_HOST_ALLOCATION:
+      data = external.handle.host_allocation.ptr;
+      break;
+    case IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION:
+      data = (void*)(uintptr_t)external.handle.device_allocation.ptr;
+      break;
+    default:
+      CheckApiStatus(
+          iree_hal_buffer_map_range(
+              buffer, IREE_HAL_MAPPING_MODE_SCOPED,
+              iree_hal_buffer_allowed_access(buffer) &
+                  (IREE_HAL_MEMORY_ACCESS_READ | IREE_HAL_MEMORY_ACCESS_WRITE),
+              0, IREE_WHOLE_BUFFER, &exported->mapping),
+          "Could not map memory");
+      exported->has_mapping = true;
+      data = exported->mapping.contents.data;
+      break;
+  }
+
+  iree_host_size_t rank = iree_hal_buffer_view_shape_rank(bv);
+  const iree_hal_dim_t* dims = iree_hal_buffer_view_shape_dims(bv);
+  exported->shape.assign(dims, dims + rank);
+
+  DLTensor& tensor = exported->managed.dl_tensor;
+  tensor.data = data;
+  tensor.device = dl_device;
+  tensor.ndim = (int32_t)rank;
+  tensor.dtype = MapElementTypeToDLDataType(element_type);
+  tensor.shape = exported->shape.data();
+  tensor.strides = nullptr;  // compact row-major
+  tensor.byte_offset = 0;
+
+  iree_hal_buffer_view_retain(bv);
+  exported->buffer_view = bv;
+  exported->managed.manager_ctx = exported.get();
+  exported->managed.deleter = &ExportedDLManagedTensor::Delete;
+  DLManagedTensor* managed = &exported.release()->managed;
+  PyObject* capsule =
+      PyCapsule_New(managed, kDLTensorCapsuleName, DLTensorCapsuleDestructor);
+  if (!capsule) {
+    managed->deleter(managed);
+    throw py::error_already_set();
+  }
+  return py::reinterpret_steal<py::capsule>(capsule);
+}
+
+// Issues the DLManagedTensor deleter once the HAL no longer references the
+// imported memory. Deleters usually drop Python references (such as to the
+// ndarray owning the memory) and buffers may be released from any thread so
+// the GIL is acquired around it.
+static void ReleaseImportedDLManagedTensor(void* user_data,
+                                           iree_hal_buffer_t* buffer) {
+  auto* managed = static_cast<DLManagedTensor*>(user_data);
+  if (!managed->deleter || !Py_IsInitialized()) return;
+  py::gil_scoped_acquire acquire;
+  managed->deleter(managed);
+}
+
+HalBufferView ImportDLPack(HalDevice& device, py::capsule capsule) {
+  IREE_TRACE_SCOPE0("HalDevice::ImportDLPack");
+  if (!PyCapsule_IsValid(capsule.ptr(), kDLTensorCapsuleName)) {
+    throw RaiseValueError(
+        "Expected an unconsumed DLPack capsule (named 'dltensor')");
+  }
+  auto* managed = static_cast<DLManagedTensor*>(
+      PyCapsule_GetPointer(capsule.ptr(), kDLTensorCapsuleName));
+  const DLTensor& tensor = managed->dl_tensor;
+
+  iree_hal_element_type_t element_type =
+      MapDLDataTypeToElementType(tensor.dtype);
+  std::vector<iree_hal_dim_t> dims(tensor.ndim);
+  iree_device_size_t byte_length = tensor.dtype.bits / 8;
+  int64_t expected_stride = 1;
+  for (int32_t i = tensor.ndim - 1; i >= 0; --i) {
+    dims[i] = (iree_hal_dim_t)tensor.shape[i];
+    if (tensor.strides && tensor.shape[i] != 1 &&
+        tensor.strides[i] != expected_stride) {
+      throw RaiseValueError("Only compact row-major DLPack tensors are "
+                            "supported");
+    }
+    expected_stride *= tensor.shape[i];
+    byte_length *= (iree_device_size_t)tensor.shape[i];
+  }
+  uint8_t* data = (uint8_t*)tensor.data + tensor.byte_offset;
+
+  iree_hal_buffer_params_t params = {0};
+  params.access = IREE_HAL_MEMORY_ACCESS_ALL;
+  iree_hal_external_buffer_t external;
+  memset(&external, 0, sizeof(external));
+  external.size = byte_length;
+  switch (tensor.device.device_type) {
+    case kDLCPU:
+    case kDLCUDAHost:
+      external.type = IREE_HAL_EXTERNAL_BUFFER_TYPE_HOST_ALLOCATION;
+      external.handle.host_allocation.ptr = data;
+      params.type =
+          IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+      params.usage =
+          IREE_HAL_BUFFER_USAGE_DEFAULT | IREE_HAL_BUFFER_USAGE_MAPPING;
+      break;
+    case kDLCUDA:
+      if (!IsCudaDevice(device.raw_ptr()) ||
+          tensor.device.device_id != QueryDLPackDeviceId(device.raw_ptr())) {
+        throw RaiseValueError(
+            "DLPack tensor resides on a different device than the target");
+      }
+      external.type = IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION;
+      external.handle.device_allocation.ptr = (uint64_t)(uintptr_t)data;
+      params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
+      params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+      break;
+    default:
+      throw RaiseValueError("Unsupported DLPack device type");
+  }
+
+  iree_hal_buffer_release_callback_t release_callback = {
+      ReleaseImportedDLManagedTensor, managed};
+  iree_hal_buffer_t* buffer = nullptr;
+  CheckApiStatus(
+      iree_hal_allocator_import_buffer(device.allocator(), params, &external,
+                                       release_callback, &buffer),
+      "Could not import DLPack tensor");
+
+  // The buffer now owns the tensor; mark the capsule consumed so that it does
+  // not delete it as well.
+  PyCapsule_SetName(capsule.ptr(), kUsedDLTensorCapsuleName);
+
+  iree_hal_buffer_view_t* buffer_view = nullptr;
+  iree_status_t status = iree_hal_buffer_view_create(
+      buffer, dims.size(), dims.data(), element_type,
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR,
+      iree_hal_allocator_host_allocator(device.allocator()), &buffer_view);
+  iree_hal_buffer_release(buffer);
+  CheckApiStatus(status, "Error creating buffer view");
+  return HalBufferView::StealFromRawPtr(buffer_view);
+}
+
+}  // namespace
+
 //------------------------------------------------------------------------------
 // Enum helpers
 //------------------------------------------------------------------------------
@@ -436,7 +797,22 @@ void SetupHalBindings(pybind11::module m) {
           [](HalDevice& self) {
             return HalAllocator::BorrowFromRawPtr(self.allocator());
           },
-          py::keep_alive<0, 1>());
+          py::keep_alive<0, 1>())
+      .def("dlpack_device", &DLPackDeviceOf, py::arg("buffer_view"),
+           "Returns the DLPack (device_type, device_id) the buffer view would "
+           "be exported with by export_dlpack.")
+      .def("export_dlpack", &ExportDLPack, py::arg("buffer_view"),
+           "Exports a buffer view as a DLPack capsule without copying. The "
+           "capsule retains the buffer view until the consumer releases it. "
+           "Host visible buffers are exported as CPU tensors and device local "
+           "buffers as device tensors when supported (CUDA).")
+      .def("import_dlpack", &ImportDLPack, py::arg("capsule"),
+           py::keep_alive<0, 1>(),
+           "Imports a DLPack capsule as a buffer view aliasing its memory "
+           "without copying. The producer's tensor is released once the "
+           "buffer is no longer used. Raises if the memory cannot be imported "
+           "by the device allocator (such as host memory that is not "
+           "suitably aligned).");
 
   py::class_<HalDriver>(m, "HalDriver")
       .def_static("query", &HalDriver::Query)
@@ -49,6 +49,7 @@ class InvokeStatics {
   py::str kSlistTag = py::str("slist");
   py::str kStupleTag = py::str("stuple");
   py::str kSdictTag = py::str("sdict");
+  py::str kPyHomogeneousListTag = py::str("py_homogeneous_list");
 
   py::int_ kZero = py::int_(0);
   py::int_ kOne = py::int_(1);
@@ -60,6 +61,8 @@ class InvokeStatics {
   py::str kDtypeAttr = py::str("dtype");
 
   // Primitive type names.
+  py::str kF16 = py::str("f16");
+  py::str kBF16 = py::str("bf16");
   py::str kF32 = py::str("f32");
   py::str kF64 = py::str("f64");
   py::str kI1 = py::str("i1");
@@ -112,14 +115,20 @@ class InvokeStatics {
   }
 
   enum iree_hal_element_types_t MapDtypeToElementType(py::object dtype) {
-    // TODO: Consider porting this from a py func to C++ as it can be on
-    // the critical path.
+    // This is on the critical path of packing generic ndarray arguments so
+    // results of the (Python) mapping function are cached per dtype.
+    PyObject *cached =
+        PyDict_GetItem(dtype_to_element_type_.ptr(), dtype.ptr());
+    if (cached) {
+      return py::cast<enum iree_hal_element_types_t>(py::handle(cached));
+    }
     try {
       py::object element_type =
           array_interop_module().attr(kMapDtypeToElementTypeAttr)(dtype);
       if (element_type.is_none()) {
         throw std::invalid_argument("mapping not found");
       }
+      dtype_to_element_type_[dtype] = element_type;
       return py::cast<enum iree_hal_element_types_t>(element_type);
     } catch (std::exception &e) {
       std::string msg("could not map dtype ");
@@ -544,6 +553,9 @@ class InvokeStatics {
 
   // Dict of str (ABI dtype like 'f32') to numpy dtype.
   py::dict abi_type_to_dtype_ = BuildAbiTypeToDtype();
+
+  // Dict of numpy dtype to HalElementType memoizing MapDtypeToElementType.
+  py::dict dtype_to_element_type_;
 };
 
 /// Object that can pack Python arguments into a VM List for a specific
@@ -694,6 +706,266 @@ class ArgumentPacker {
   bool dynamic_dispatch_ = false;
 };
 
+/// Object that can unpack the results of a specific function from a VM List
+/// into Python values. The conversion for each result position is resolved
+/// from the reflection metadata once such that no per-call descriptor
+/// inspection is needed.
+class ResultUnpacker {
+ public:
+  // Converts the element at |index| of |list|.
+  using UnpackCallback = std::function<py::object(
+      iree_vm_list_t *list, iree_host_size_t index, py::handle device)>;
+  // Converts all elements of |list| into a compound value.
+  using ListUnpackCallback =
+      std::function<py::object(iree_vm_list_t *list, py::handle device)>;
+
+  ResultUnpacker(InvokeStatics &statics, std::optional<py::list> ret_descs)
+      : statics_(statics) {
+    IREE_TRACE_SCOPE0("ResultUnpacker::Init");
+    if (!ret_descs) {
+      dynamic_dispatch_ = true;
+      return;
+    }
+    // Results that are a single slist/stuple/sdict are inlined with the
+    // function results: the result list itself is the compound value.
+    if (py::len(*ret_descs) == 1) {
+      py::handle desc = (*ret_descs)[0];
+      if (py::isinstance<py::list>(desc) && py::len(desc) > 0) {
+        py::object compound_type = desc[statics.kZero];
+        if (compound_type.equal(statics.kSlistTag) ||
+            compound_type.equal(statics.kStupleTag) ||
+            compound_type.equal(statics.kSdictTag)) {
+          inlined_unpacker_ = AbiTypeToListUnpackCallback(desc);
+          return;
+        }
+      }
+    }
+    flat_unpackers_ = SequenceUnpackCallbacks(*ret_descs, /*offset=*/0);
+  }
+
+  /// Unpacks |ret_list| into a Python value: None if there are no results,
+  /// the value itself for a single result and a tuple otherwise.
+  py::object Unpack(py::handle device, VmVariantList &ret_list) {
+    IREE_TRACE_SCOPE0("ResultUnpacker::Unpack");
+    if (inlined_unpacker_) {
+      return inlined_unpacker_(ret_list.raw_ptr(), device);
+    }
+
+    iree_host_size_t arity = ret_list.size();
+    if (!dynamic_dispatch_ && arity != flat_unpackers_.size()) {
+      std::string message("mismatched return arity: ");
+      message.append(std::to_string(arity));
+      message.append(" vs ");
+      message.append(std::to_string(flat_unpackers_.size()));
+      throw std::invalid_argument(std::move(message));
+    }
+    if (arity == 0) return py::none();
+    if (arity == 1) return UnpackFlat(device, ret_list, 0);
+    py::tuple results(arity);
+    for (iree_host_size_t i = 0; i < arity; ++i) {
+      results[i] = UnpackFlat(device, ret_list, i);
+    }
+    return std::move(results);
+  }
+
+ private:
+  py::object UnpackFlat(py::handle device, VmVariantList &ret_list,
+                        iree_host_size_t index) {
+    if (!dynamic_dispatch_) {
+      return flat_unpackers_[index](ret_list.raw_ptr(), index, device);
+    }
+    // Dynamic (non reflection mode). Buffer views are upgraded to a
+    // DeviceArray as in the reflection case.
+    py::object converted = ret_list.GetVariant(index);
+    if (py::isinstance(converted, statics_.hal_buffer_view_type())) {
+      converted = statics_.device_array_type()(
+          device, converted, py::arg("implicit_host_transfer") = true);
+    }
+    return converted;
+  }
+
+  static iree_vm_list_t *GetSubList(iree_vm_list_t *list,
+                                    iree_host_size_t index) {
+    iree_vm_ref_t ref = {0};
+    CheckApiStatus(iree_vm_list_get_ref_assign(list, index, &ref),
+                   "could not access list element");
+    iree_vm_list_t *sub_list = nullptr;
+    CheckApiStatus(iree_vm_list_check_deref(ref, &sub_list),
+                   "could not deref list (wrong type?)");
+    return sub_list;
+  }
+
+  static void CheckSubListArity(iree_vm_list_t *list, size_t expected) {
+    if (iree_vm_list_size(list) != expected) {
+      std::string message("mismatched return arity: ");
+      message.append(std::to_string(iree_vm_list_size(list)));
+      message.append(" vs ");
+      message.append(std::to_string(expected));
+      throw std::invalid_argument(std::move(message));
+    }
+  }
+
+  std::vector<UnpackCallback> SequenceUnpackCallbacks(py::handle descs,
+                                                      size_t offset) {
+    std::vector<UnpackCallback> unpackers(py::len(descs) - offset);
+    for (size_t i = 0; i < unpackers.size(); ++i) {
+      unpackers[i] = AbiTypeToUnpackCallback(descs[py::int_(i + offset)]);
+    }
+    return unpackers;
+  }
+
+  ListUnpackCallback AbiTypeToListUnpackCallback(py::handle desc) {
+    py::object compound_type = desc[statics_.kZero];
+    if (compound_type.equal(statics_.kSlistTag) ||
+        compound_type.equal(statics_.kStupleTag)) {
+      // The descriptor for an slist/stuple is like:
+      //   ['slist', item1, ...]
+      bool is_tuple = compound_type.equal(statics_.kStupleTag);
+      return [is_tuple, sub_unpackers = SequenceUnpackCallbacks(desc, 1)](
+                 iree_vm_list_t *list, py::handle device) -> py::object {
+        CheckSubListArity(list, sub_unpackers.size());
+        py::list items(sub_unpackers.size());
+        for (size_t i = 0; i < sub_unpackers.size(); ++i) {
+          items[i] = sub_unpackers[i](list, i, device);
+        }
+        if (is_tuple) return py::tuple(std::move(items));
+        return std::move(items);
+      };
+    } else if (compound_type.equal(statics_.kSdictTag)) {
+      // The descriptor for an sdict is like:
+      //   ['sdict', ['key1', value1], ...]
+      std::vector<std::pair<py::object, UnpackCallback>> sub_unpackers(
+          py::len(desc) - 1);
+      for (size_t i = 0; i < sub_unpackers.size(); ++i) {
+        py::object sub_desc = desc[py::int_(i + 1)];
+        py::object key = sub_desc[statics_.kZero];
+        py::object value_desc = sub_desc[statics_.kOne];
+        sub_unpackers[i] = std::make_pair(std::move(key),
+                                          AbiTypeToUnpackCallback(value_desc));
+      }
+      return [sub_unpackers = std::move(sub_unpackers)](
+                 iree_vm_list_t *list, py::handle device) -> py::object {
+        CheckSubListArity(list, sub_unpackers.size());
+        py::dict items;
+        for (size_t i = 0; i < sub_unpackers.size(); ++i) {
+          items[sub_unpackers[i].first] =
+              sub_unpackers[i].second(list, i, device);
+        }
+        return std::move(items);
+      };
+    } else if (compound_type.equal(statics_.kPyHomogeneousListTag)) {
+      // The descriptor for a pylist is like:
+      //   ['py_homogeneous_list', element_type]
+      return [element_unpacker = AbiTypeToUnpackCallback(desc[statics_.kOne])](
+                 iree_vm_list_t *list, py::handle device) -> py::object {
+        iree_host_size_t size = iree_vm_list_size(list);
+        py::list items(size);
+        for (iree_host_size_t i = 0; i < size; ++i) {
+          items[i] = element_unpacker(list, i, device);
+        }
+        return std::move(items);
+      };
+    }
+    std::string message("cannot map VM type to Python: ");
+    message.append(py::cast<std::string>(py::str(compound_type)));
+    throw std::invalid_argument(std::move(message));
+  }
+
+  UnpackCallback AbiTypeToUnpackCallback(py::handle desc) {
+    if (py::isinstance<py::list>(desc)) {
+      py::object compound_type = desc[statics_.kZero];
+      if (compound_type.equal(statics_.kNdarray)) {
+        // The descriptor for an ndarray is like:
+        //   ["ndarray", "<dtype>", <rank>, <dim>...]
+        py::object abi_type = desc[statics_.kOne];
+        py::object dtype = statics_.MapElementAbiTypeToDtype(abi_type);
+        return [&statics = statics_, dtype = std::move(dtype)](
+                   iree_vm_list_t *list, iree_host_size_t index,
+                   py::handle device) -> py::object {
+          iree_vm_ref_t ref = {0};
+          CheckApiStatus(iree_vm_list_get_ref_assign(list, index, &ref),
+                         "could not access list element");
+          iree_hal_buffer_view_t *buffer_view = nullptr;
+          CheckApiStatus(iree_hal_buffer_view_check_deref(ref, &buffer_view),
+                         "could not deref result buffer view (wrong type?)");
+          py::object py_buffer_view =
+              py::cast(HalBufferView::BorrowFromRawPtr(buffer_view),
+                       py::return_value_policy::move);
+          return statics.device_array_type()(
+              device, py_buffer_view, py::arg("implicit_host_transfer") = true,
+              py::arg("override_dtype") = dtype);
+        };
+      }
+      ListUnpackCallback list_unpacker = AbiTypeToListUnpackCallback(desc);
+      return [list_unpacker = std::move(list_unpacker)](
+                 iree_vm_list_t *list, iree_host_size_t index,
+                 py::handle device) -> py::object {
+        return list_unpacker(GetSubList(list, index), device);
+      };
+    }
+
+    // Primitive type.
+    py::str prim_type = py::cast<py::str>(desc);
+    bool is_integer = prim_type.equal(statics_.kI8) ||
+                      prim_type.equal(statics_.kI16) ||
+                      prim_type.equal(statics_.kI32) ||
+                      prim_type.equal(statics_.kI64);
+    bool is_float = prim_type.equal(statics_.kF16) ||
+                    prim_type.equal(statics_.kF32) ||
+                    prim_type.equal(statics_.kF64) ||
+                    prim_type.equal(statics_.kBF16);
+    if (!is_integer && !is_float) {
+      std::string message("cannot map VM type to Python: ");
+      message.append(py::cast<std::string>(prim_type));
+      throw std::invalid_argument(std::move(message));
+    }
+    return [is_integer](iree_vm_list_t *list, iree_host_size_t index,
+                        py::handle device) -> py::object {
+      iree_vm_value_t value;
+      CheckApiStatus(
+          iree_vm_list_get_value(list, index, &value),
+          "expected a scalar value but got a reference type or value");
+      switch (value.type) {
+        case IREE_VM_VALUE_TYPE_I8:
+          if (is_integer) return py::int_(value.i8);
+          break;
+        case IREE_VM_VALUE_TYPE_I16:
+          if (is_integer) return py::int_(value.i16);
+          break;
+        case IREE_VM_VALUE_TYPE_I32:
+          if (is_integer) return py::int_(value.i32);
+          break;
+        case IREE_VM_VALUE_TYPE_I64:
+          if (is_integer) return py::int_(value.i64);
+          break;
+        case IREE_VM_VALUE_TYPE_F32:
+          if (!is_integer) return py::float_(value.f32);
+          break;
+        case IREE_VM_VALUE_TYPE_F64:
+          if (!is_integer) return py::float_(value.f64);
+          break;
+        default:
+          break;
+      }
+      throw std::invalid_argument(is_integer
+                                      ? "expected an integer value"
+                                      : "expected a floating point value");
+    };
+  }
+
+  InvokeStatics &statics_;
+
+  // Per-position unpackers of the function results when not inlined.
+  std::vector<UnpackCallback> flat_unpackers_;
+
+  // Set when the results are an inlined slist/stuple/sdict.
+  ListUnpackCallback inlined_unpacker_;
+
+  // If true, then there is no dispatch metadata and we process fully
+  // dynamically.
+  bool dynamic_dispatch_ = false;
+};
+
 }  // namespace
 
 void SetupInvokeBindings(pybind11::module &m) {
@@ -702,6 +974,10 @@ void SetupInvokeBindings(pybind11::module &m) {
   py::class_<ArgumentPacker>(m, "ArgumentPacker")
       .def(py::init<InvokeStatics &, std::optional<py::list>>())
       .def("pack", &ArgumentPacker::Pack);
+  py::class_<ResultUnpacker>(m, "ResultUnpacker")
+      .def(py::init<InvokeStatics &, std::optional<py::list>>())
+      .def("unpack", &ResultUnpacker::Unpack, py::arg("device"),
+           py::arg("ret_list"));
 
   m.attr("_invoke_statics") = py::cast(InvokeStatics());
 }
@@ -22,6 +22,7 @@ from ._binding import (
 __all__ = [
     "asdevicearray",
     "DeviceArray",
+    "from_dlpack",
 ]
 
 _DEVICE_HANDLED_FUNCTIONS = {}
@@ -93,6 +94,19 @@ class DeviceArray(numpy.lib.mixins.NDArrayOperatorsMixin):
   def __repr__(self):
     return f"<IREE DeviceArray: shape={np.shape(self)}, dtype={self.dtype}>"
 
+  def __dlpack__(self, stream=None):
+    """Exports the array as a DLPack capsule aliasing the device buffer.
+
+    The buffer view is kept alive by the capsule until the consumer releases
+    it. Work producing the array has completed by the time it is returned to
+    Python and no additional synchronization is performed with |stream|.
+    """
+    del stream
+    return self._device.export_dlpack(self._buffer_view)
+
+  def __dlpack_device__(self):
+    return self._device.dlpack_device(self._buffer_view)
+
   @property
   def is_host_accessible(self):
     """Whether this array is currently host accessible."""
@@ -200,6 +214,11 @@ def asdevicearray(device: HalDevice,
   Note that additional flags `memory_type`, `allowed_usage` and `element_type`
   are only hints if creating a new DeviceArray. If `a` is already a DeviceArray,
   they are ignored.
+
+  Like np.asarray, when `a` supports DLPack (such as numpy arrays) and no
+  dtype conversion is requested the returned array aliases the memory of `a`
+  if the device can import it. Otherwise the contents are copied into a new
+  device buffer.
   """
   if isinstance(a, DeviceArray):
     if dtype is None:
@@ -208,6 +227,11 @@ def asdevicearray(device: HalDevice,
     # device, so transfer back to the host.
     logging.warn(
         "Implicit dtype conversion of a DeviceArray forces a host transfer")
+  if hasattr(a, "__dlpack__") and (dtype is None or
+                                   np.dtype(dtype) == getattr(a, "dtype", None)):
+    imported = _try_import_dlpack(device, a, implicit_host_transfer)
+    if imported is not None:
+      return imported
   # First get an ndarray.
   a = np.asarray(a, dtype=dtype)
   element_type = map_dtype_to_element_type(a.dtype)
@@ -224,6 +248,48 @@ def asdevicearray(device: HalDevice,
                      override_dtype=a.dtype)
 
 
+def from_dlpack(device: HalDevice,
+                x,
+                *,
+                implicit_host_transfer: bool = False) -> DeviceArray:
+  """Creates a DeviceArray aliasing the memory of a DLPack tensor.
+
+  `x` may be any object implementing `__dlpack__` (numpy, PyTorch, CuPy, ...)
+  or a DLPack capsule. No copy is made: the producer's tensor stays alive
+  until the device buffer is released. Raises if the device cannot import the
+  memory (such as host memory on a GPU device or a tensor on another device);
+  use `asdevicearray` to fall back to copying.
+
+  Device tensors must have completed any pending work on the producer side as
+  IREE does not synchronize with the producer's streams.
+  """
+  capsule = x.__dlpack__() if hasattr(x, "__dlpack__") else x
+  buffer_view = device.import_dlpack(capsule)
+  return DeviceArray(device,
+                     buffer_view,
+                     implicit_host_transfer=implicit_host_transfer)
+
+
+def _try_import_dlpack(device: HalDevice, a,
+                       implicit_host_transfer: bool) -> Optional[DeviceArray]:
+  """Imports `a` without copying or returns None if not possible."""
+  try:
+    capsule = a.__dlpack__()
+  except (BufferError, TypeError, ValueError):
+    # Read-only or otherwise unexportable arrays.
+    return None
+  try:
+    buffer_view = device.import_dlpack(capsule)
+  except (IndexError, RuntimeError, ValueError):
+    # Unimportable memory (such as misaligned host memory) is left unconsumed
+    # and the capsule is released with its producer.
+    return None
+  return DeviceArray(device,
+                     buffer_view,
+                     implicit_host_transfer=implicit_host_transfer,
+                     override_dtype=getattr(a, "dtype", None))
+
+
 # NOTE: Numpy dtypes are not hashable and exist in a hierarchy that should
 # be queried via isinstance checks. This should be done as a fallback but
 # this is a linear list for quick access to the most common. There may also
@@ -242,9 +242,19 @@ class BoundModules(dict):
 
 
 class SystemContext:
-  """Global system."""
+  """Global system.
 
-  def __init__(self, vm_modules=None, config: Optional[Config] = None):
+  Contexts created with `concurrent=True` may be invoked from multiple threads
+  (or with overlapping `call_async` calls) at the same time. Static contexts
+  are ready for this on creation while dynamic contexts must be `freeze()`d
+  once all modules have been added.
+  """
+
+  def __init__(self,
+               vm_modules=None,
+               config: Optional[Config] = None,
+               *,
+               concurrent: bool = False):
     self._config = config if config is not None else _get_global_config()
     logging.debug("SystemContext driver=%r", self._config.driver)
     self._is_dynamic = vm_modules is None
@@ -254,7 +264,8 @@ class SystemContext:
       init_vm_modules = self._config.default_vm_modules + tuple(vm_modules)
 
     self._vm_context = _binding.VmContext(instance=self._config.vm_instance,
-                                          modules=init_vm_modules)
+                                          modules=init_vm_modules,
+                                          concurrent=concurrent)
 
     if self._is_dynamic:
       self._vm_context.register_modules(self._config.default_vm_modules)
@@ -308,6 +319,10 @@ class SystemContext:
   def add_vm_module(self, vm_module):
     self.add_vm_modules((vm_module,))
 
+  def freeze(self):
+    """Disallows adding further modules to a dynamic context."""
+    self._vm_context.freeze()
+
 
 def load_vm_modules(*vm_modules, config: Optional[Config] = None):
   """Loads VmModules into a new SystemContext and returns them."""
@@ -164,6 +164,56 @@ class DeviceHalTest(unittest.TestCase):
     self.assertEqual(repr(ary), "<IREE DeviceArray: shape=[3, 4], dtype=bool>")
     np.testing.assert_array_equal(ary.to_host(), init_ary)
 
+  @unittest.skipUnless(hasattr(np, "from_dlpack"), "requires numpy DLPack")
+  def testDLPackExport(self):
+    init_ary = np.arange(12, dtype=np.float32).reshape([3, 4])
+    ary = iree.runtime.asdevicearray(
+        self.device,
+        init_ary,
+        memory_type=iree.runtime.MemoryType.DEVICE_LOCAL |
+        iree.runtime.MemoryType.HOST_VISIBLE)
+    self.assertEqual(ary.__dlpack_device__(), (1, 0))  # kDLCPU
+    exported = np.from_dlpack(ary)
+    np.testing.assert_array_equal(exported, init_ary)
+
+    # The exported array aliases the device buffer and keeps it alive.
+    exported[0, 0] = 42.0
+    self.assertEqual(ary.to_host()[0, 0], 42.0)
+    ary = None
+    gc.collect()
+    self.assertEqual(exported[0, 0], 42.0)
+
+  @unittest.skipUnless(hasattr(np, "from_dlpack"), "requires numpy DLPack")
+  def testFromDLPackAliasesMemory(self):
+    # Heap buffers require imported host memory to be suitably aligned.
+    alignment = 64
+    storage = np.zeros(12 * 4 + alignment, dtype=np.uint8)
+    offset = -storage.ctypes.data % alignment
+    init_ary = storage[offset:offset + 12 * 4].view(np.float32).reshape([3, 4])
+    ary = iree.runtime.from_dlpack(self.device, init_ary)
+    self.assertEqual([3, 4], ary.shape)
+    self.assertEqual(np.float32, ary.dtype)
+    init_ary[1, 2] = 7.0
+    self.assertEqual(ary.to_host()[1, 2], 7.0)
+
+    # The source memory must outlive the source array reference.
+    init_ary = None
+    storage = None
+    gc.collect()
+    self.assertEqual(ary.to_host()[1, 2], 7.0)
+
+  def testFromDLPackRejectsConsumedCapsule(self):
+    init_ary = np.zeros([4], dtype=np.int32)
+    if not hasattr(init_ary, "__dlpack__"):
+      self.skipTest("requires numpy DLPack")
+    capsule = init_ary.__dlpack__()
+    try:
+      self.device.import_dlpack(capsule)
+    except (IndexError, RuntimeError):
+      self.skipTest("memory not importable by the device")
+    with self.assertRaises(ValueError):
+      self.device.import_dlpack(capsule)
+
 
 if __name__ == "__main__":
   unittest.main()
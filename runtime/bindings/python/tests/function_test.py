@@ -4,6 +4,7 @@
 # See https://llvm.org/LICENSE.txt for license information.
 # SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+import asyncio
 import json
 import numpy as np
 import unittest
@@ -84,6 +85,19 @@ class FunctionTest(unittest.TestCase):
                      vm_context.mock_arg_reprs)
     self.assertEqual(3, result)
 
+  def testCallAsync(self):
+
+    def invoke(arg_list, ret_list):
+      ret_list.push_int(3)
+      ret_list.push_int(4)
+
+    vm_context = MockVmContext(invoke)
+    vm_function = MockVmFunction(reflection={})
+    invoker = FunctionInvoker(vm_context, self.device, vm_function, tracer=None)
+    result = asyncio.run(invoker.call_async(1, 2))
+    self.assertEqual("[<VmVariantList(2): [1, 2]>]", vm_context.mock_arg_reprs)
+    self.assertEqual((3, 4), result)
+
   def testListArg(self):
 
     def invoke(arg_list, ret_list):
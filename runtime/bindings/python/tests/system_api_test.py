@@ -6,6 +6,7 @@
 
 # pylint: disable=unused-variable
 
+import asyncio
 import logging
 import os
 import re
@@ -135,6 +136,29 @@ class SystemApiTest(unittest.TestCase):
     print("SIMPLE_MUL RESULTS:", results)
     np.testing.assert_allclose(results, [4., 10., 18., 28.])
 
+  def test_concurrent_call_async(self):
+    ctx = iree.runtime.SystemContext(vm_modules=[create_simple_mul_module()],
+                                     concurrent=True)
+    f = ctx.modules.arithmetic["simple_mul"]
+    arg0 = np.array([1., 2., 3., 4.], dtype=np.float32)
+
+    async def run_all():
+      return await asyncio.gather(*[
+          f.call_async(arg0, np.full([4], i, dtype=np.float32))
+          for i in range(8)
+      ])
+
+    results = asyncio.run(run_all())
+    for i, result in enumerate(results):
+      np.testing.assert_allclose(result, arg0 * i)
+
+  def test_freeze_dynamic(self):
+    ctx = iree.runtime.SystemContext(concurrent=True)
+    ctx.add_vm_module(create_simple_mul_module())
+    ctx.freeze()
+    with self.assertRaises(RuntimeError):
+      ctx.vm_context.register_modules([create_simple_mul_module()])
+
 
 if __name__ == "__main__":
   logging.basicConfig(level=logging.DEBUG)
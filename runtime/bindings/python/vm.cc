@@ -75,13 +75,16 @@ VmInstance VmInstance::Create() {
 //------------------------------------------------------------------------------
 
 VmContext VmContext::Create(VmInstance* instance,
-                            std::optional<std::vector<VmModule*>> modules) {
+                            std::optional<std::vector<VmModule*>> modules,
+                            bool concurrent) {
   IREE_TRACE_SCOPE0("VmContext::Create");
+  iree_vm_context_flags_t flags = IREE_VM_CONTEXT_FLAG_NONE;
+  if (concurrent) flags |= IREE_VM_CONTEXT_FLAG_CONCURRENT;
   iree_vm_context_t* context;
   if (!modules) {
     // Simple create with open allowed modules.
     auto status =
-        iree_vm_context_create(instance->raw_ptr(), IREE_VM_CONTEXT_FLAG_NONE,
+        iree_vm_context_create(instance->raw_ptr(), flags,
                                iree_allocator_system(), &context);
     CheckApiStatus(status, "Error creating vm context");
   } else {
@@ -92,7 +95,7 @@ VmContext VmContext::Create(VmInstance* instance,
       module_handles[i] = (*modules)[i]->raw_ptr();
     }
     auto status = iree_vm_context_create_with_modules(
-        instance->raw_ptr(), IREE_VM_CONTEXT_FLAG_NONE, module_handles.size(),
+        instance->raw_ptr(), flags, module_handles.size(),
         module_handles.data(), iree_allocator_system(), &context);
     CheckApiStatus(status, "Error creating vm context with modules");
   }
@@ -112,6 +115,10 @@ void VmContext::RegisterModules(std::vector<VmModule*> modules) {
   CheckApiStatus(status, "Error registering modules");
 }
 
+void VmContext::Freeze() {
+  CheckApiStatus(iree_vm_context_freeze(raw_ptr()), "Error freezing context");
+}
+
 void VmContext::Invoke(iree_vm_function_t f, VmVariantList& inputs,
                        VmVariantList& outputs) {
   iree_status_t status;
@@ -548,8 +555,10 @@ void SetupVmBindings(pybind11::module m) {
 
   py::class_<VmContext>(m, "VmContext")
       .def(py::init(&VmContext::Create), py::arg("instance"),
-           py::arg("modules") = std::optional<std::vector<VmModule*>>())
+           py::arg("modules") = std::optional<std::vector<VmModule*>>(),
+           py::arg("concurrent") = false)
       .def("register_modules", &VmContext::RegisterModules)
+      .def("freeze", &VmContext::Freeze)
       .def_property_readonly("context_id", &VmContext::context_id)
       .def("invoke", &VmContext::Invoke);
 
@@ -141,18 +141,26 @@ class VmContext : public ApiRefCounted<VmContext, iree_vm_context_t> {
  public:
   // Creates a context, optionally with modules, which will make the context
   // static, disallowing further module registration (and may be more
-  // efficient).
+  // efficient). Concurrent contexts may be invoked from multiple threads at
+  // once after they are frozen (static contexts are frozen on creation).
   static VmContext Create(VmInstance* instance,
-                          std::optional<std::vector<VmModule*>> modules);
+                          std::optional<std::vector<VmModule*>> modules,
+                          bool concurrent);
 
   // Registers additional modules. Only valid for non static contexts (i.e.
   // those created without modules.
   void RegisterModules(std::vector<VmModule*> modules);
 
+  // Disallows further module registration such that the context can be shared
+  // by concurrent invocations.
+  void Freeze();
+
   // Unique id for this context.
   int context_id() const { return iree_vm_context_id(raw_ptr()); }
 
   // Synchronously invokes the given function.
+  // The GIL is released for the duration of the invocation such that other
+  // Python threads may run (and invoke concurrent contexts) in the meantime.
   void Invoke(iree_vm_function_t f, VmVariantList& inputs,
               VmVariantList& outputs);
 };
@@ -197,6 +197,20 @@ static iree_status_t _TfLiteInterpreterRefreshOutputShapes(
   return iree_ok_status();
 }
 
+// Refreshes only the output tensor shapes by querying the module.
+static iree_status_t _TfLiteInterpreterRefreshOutputShapesOnly(
+    TfLiteInterpreter* interpreter) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  _TfLiteInterpreterShapeFrame frame;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, _TfLiteInterpreterShapeFrameInitialize(&frame));
+  iree_status_t status =
+      _TfLiteInterpreterRefreshOutputShapes(interpreter, &frame);
+  _TfLiteInterpreterShapeFrameDeinitialize(&frame);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 // Refreshes both input and output tensor shapes by querying the module.
 // This should be called after each shape change so that we can let the module
 // run "shape propagation" and compute the new output shapes.
@@ -526,6 +540,18 @@ static iree_status_t _TfLiteInterpreterAllocateTensors(
   // non-data-dependent output shapes.
   IREE_RETURN_IF_ERROR(_TfLiteInterpreterRefreshIOShapes(interpreter));
 
+  // Output shapes only change when input shapes do (which requires another
+  // call here) unless they are data-dependent and only known after invocation.
+  interpreter->has_dynamic_output_shapes = false;
+  for (iree_host_size_t i = 0; i < interpreter->model->output_count; ++i) {
+    const TfLiteTensor* tensor = &interpreter->output_tensors[i];
+    for (int32_t j = 0; j < tensor->shape_rank; ++j) {
+      if (tensor->shape_dims[j] < 0) {
+        interpreter->has_dynamic_output_shapes = true;
+      }
+    }
+  }
+
   // Drop all input tensors we hang on to in the input list. This way we aren't
   // double-allocating during the resize.
   IREE_RETURN_IF_ERROR(iree_vm_list_resize(interpreter->input_list, 0));
@@ -579,13 +605,18 @@ static iree_status_t _TfLiteInterpreterInvoke(TfLiteInterpreter* interpreter) {
                      /*policy=*/NULL, interpreter->input_list,
                      interpreter->output_list, interpreter->allocator));
 
-  // Refresh output shapes.
-  // TODO(#3975): just use buffer view results or at least just refresh outputs.
-  IREE_RETURN_IF_ERROR(_TfLiteInterpreterRefreshIOShapes(interpreter));
+  // Refresh output shapes if they depend on the values computed. Input shapes
+  // cannot change during invocation and static output shapes were queried when
+  // the tensors were allocated.
+  // TODO(#3975): just use buffer view results.
+  if (interpreter->has_dynamic_output_shapes) {
+    IREE_RETURN_IF_ERROR(
+        _TfLiteInterpreterRefreshOutputShapesOnly(interpreter));
+  }
 
-  // Map the output buffers.
-  // NOTE: we could defer the mapping unless requested and ensure state buffers
-  // remain where they currently are for the next invocation.
+  // Map the output buffers. Buffers that are the same as the prior invocation
+  // retain their existing mapping.
+  // NOTE: we could defer the mapping unless requested.
   for (iree_host_size_t i = 0; i < interpreter->model->output_count; ++i) {
     iree_hal_buffer_t* buffer = (iree_hal_buffer_t*)iree_vm_list_get_ref_deref(
         interpreter->output_list, i, iree_hal_buffer_get_descriptor());
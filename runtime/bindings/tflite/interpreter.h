@@ -39,10 +39,17 @@ struct TfLiteInterpreter {
   };
   iree_vm_context_t* context;
 
+  // Invocation lists allocated as part of the interpreter and reused across
+  // all invocations. The input list is populated when tensors are allocated
+  // and the output list is overwritten in-place by each invocation.
   iree_vm_list_t* input_list;
   iree_vm_list_t* output_list;
   TfLiteTensor* input_tensors;
   TfLiteTensor* output_tensors;
+
+  // True if any output shape could not be determined from the input shapes
+  // when tensors were allocated and must be queried after each invocation.
+  bool has_dynamic_output_shapes;
 };
 
 #endif  // IREE_BINDINGS_TFLITE_INTERPRETER_H_
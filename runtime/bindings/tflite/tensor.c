@@ -103,6 +103,24 @@ static iree_status_t _TfLiteTypeToElementType(
   return iree_ok_status();
 }
 
+// Maps the whole of the tensor buffer for host access.
+// Buffers that live in host-local memory and were allocated for persistent
+// mapping are mapped once and then accessed directly by the user through
+// TfLiteTensorData without any further HAL calls.
+static iree_status_t _TfLiteTensorMapBuffer(TfLiteTensor* tensor) {
+  iree_hal_mapping_mode_t mapping_mode = IREE_HAL_MAPPING_MODE_SCOPED;
+  if (iree_all_bits_set(iree_hal_buffer_memory_type(tensor->buffer),
+                        IREE_HAL_MEMORY_TYPE_HOST_LOCAL) &&
+      iree_all_bits_set(iree_hal_buffer_allowed_usage(tensor->buffer),
+                        IREE_HAL_BUFFER_USAGE_MAPPING_PERSISTENT)) {
+    mapping_mode = IREE_HAL_MAPPING_MODE_PERSISTENT;
+  }
+  return iree_hal_buffer_map_range(
+      tensor->buffer, mapping_mode,
+      IREE_HAL_MEMORY_ACCESS_READ | IREE_HAL_MEMORY_ACCESS_WRITE, 0,
+      IREE_WHOLE_BUFFER, &tensor->buffer_mapping);
+}
+
 iree_status_t _TfLiteTensorReallocateIfNeeded(
     TfLiteTensor* tensor, iree_hal_allocator_t* buffer_allocator,
     iree_allocator_t heap_allocator) {
@@ -133,8 +151,11 @@ iree_status_t _TfLiteTensorReallocateIfNeeded(
     IREE_TRACE_ZONE_END(z0);
     return iree_ok_status();
   }
+  _TfLiteTensorDiscardBuffer(tensor);
 
-  // Allocate the underlying buffer for the tensor.
+  // Allocate the underlying buffer for the tensor. The buffer is requested as
+  // persistently mappable so that on unified memory systems (CPU and most
+  // mobile GPUs) the user reads and writes the device memory directly.
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
       z0, iree_hal_allocator_allocate_buffer(
               buffer_allocator,
@@ -143,7 +164,8 @@ iree_status_t _TfLiteTensorReallocateIfNeeded(
                           IREE_HAL_MEMORY_TYPE_HOST_VISIBLE,
                   .usage = IREE_HAL_BUFFER_USAGE_DISPATCH_STORAGE |
                            IREE_HAL_BUFFER_USAGE_TRANSFER |
-                           IREE_HAL_BUFFER_USAGE_MAPPING,
+                           IREE_HAL_BUFFER_USAGE_MAPPING |
+                           IREE_HAL_BUFFER_USAGE_MAPPING_PERSISTENT,
               },
               allocation_size, iree_const_byte_span_empty(), &tensor->buffer));
 
@@ -152,11 +174,7 @@ iree_status_t _TfLiteTensorReallocateIfNeeded(
   // just going to be passed to future invocations. We could move this to an
   // on-demand mapping when the user calls TfLiteTensorData but this at least
   // puts potential errors in the same easy to find place.
-  IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0,
-      iree_hal_buffer_map_range(tensor->buffer, IREE_HAL_MAPPING_MODE_SCOPED,
-                                IREE_HAL_MEMORY_ACCESS_ALL, 0,
-                                IREE_WHOLE_BUFFER, &tensor->buffer_mapping));
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(z0, _TfLiteTensorMapBuffer(tensor));
 
   IREE_TRACE_ZONE_END(z0);
   return iree_ok_status();
@@ -164,6 +182,10 @@ iree_status_t _TfLiteTensorReallocateIfNeeded(
 
 iree_status_t _TfLiteTensorBind(TfLiteTensor* tensor,
                                 iree_hal_buffer_t* buffer) {
+  if (buffer && buffer == tensor->buffer) {
+    // Same buffer as the last invocation; the existing mapping is still valid.
+    return iree_ok_status();
+  }
   IREE_TRACE_ZONE_BEGIN(z0);
   _TfLiteTensorDiscardBuffer(tensor);
   if (!buffer) {
@@ -172,21 +194,15 @@ iree_status_t _TfLiteTensorBind(TfLiteTensor* tensor,
     return iree_ok_status();
   }
 
+  // Retain the buffer view until discarded/reset.
+  tensor->buffer = buffer;
+  iree_hal_buffer_retain(tensor->buffer);
+
   // Attempt to map the buffer. The tflite API doesn't let us know if this
   // should be read or read/write - or if we even need to map at all. We could
   // move this to an on-demand mapping when the user calls TfLiteTensorData but
   // this at least puts potential errors in the same easy to find place.
-  iree_device_size_t byte_offset = 0;
-  iree_device_size_t byte_length = IREE_WHOLE_BUFFER;
-  IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_hal_buffer_map_range(
-              buffer, IREE_HAL_MAPPING_MODE_SCOPED,
-              IREE_HAL_MEMORY_ACCESS_READ | IREE_HAL_MEMORY_ACCESS_WRITE,
-              byte_offset, byte_length, &tensor->buffer_mapping));
-
-  // Retain the buffer view until discarded/reset.
-  tensor->buffer = buffer;
-  iree_hal_buffer_retain(tensor->buffer);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(z0, _TfLiteTensorMapBuffer(tensor));
 
   IREE_TRACE_ZONE_END(z0);
   return iree_ok_status();
@@ -197,6 +213,7 @@ void _TfLiteTensorDiscardBuffer(TfLiteTensor* tensor) {
   if (tensor->buffer_mapping.contents.data != NULL) {
     iree_hal_buffer_unmap_range(&tensor->buffer_mapping);
   }
+  memset(&tensor->buffer_mapping, 0, sizeof(tensor->buffer_mapping));
   iree_hal_buffer_release(tensor->buffer);
   tensor->buffer = NULL;
   IREE_TRACE_ZONE_END(z0);
@@ -254,8 +271,16 @@ TFL_CAPI_EXPORT extern TfLiteStatus TfLiteTensorCopyFromBuffer(
   // efficient and portable to do the iree_hal_buffer_map_copy.
   memcpy(tensor->buffer_mapping.contents.data, input_data, input_data_size);
 
+  // Non-coherent memory needs the host writes made visible to the device.
+  iree_status_t status = iree_ok_status();
+  if (!iree_all_bits_set(iree_hal_buffer_memory_type(tensor->buffer),
+                         IREE_HAL_MEMORY_TYPE_HOST_COHERENT)) {
+    status = iree_hal_buffer_mapping_flush_range(&tensor->buffer_mapping, 0,
+                                                 IREE_WHOLE_BUFFER);
+  }
+
   IREE_TRACE_ZONE_END(z0);
-  return kTfLiteOk;
+  return _TfLiteStatusFromIREEStatus(status);
 }
 
 TFL_CAPI_EXPORT extern TfLiteStatus TfLiteTensorCopyToBuffer(
@@ -268,6 +293,18 @@ TFL_CAPI_EXPORT extern TfLiteStatus TfLiteTensorCopyToBuffer(
   IREE_TRACE_ZONE_APPEND_VALUE(
       z0, output_tensor->buffer_mapping.contents.data_length);
 
+  // Non-coherent memory needs device writes made visible to the host.
+  if (!iree_all_bits_set(iree_hal_buffer_memory_type(output_tensor->buffer),
+                         IREE_HAL_MEMORY_TYPE_HOST_COHERENT)) {
+    iree_status_t status = iree_hal_buffer_mapping_invalidate_range(
+        (iree_hal_buffer_mapping_t*)&output_tensor->buffer_mapping, 0,
+        IREE_WHOLE_BUFFER);
+    if (!iree_status_is_ok(status)) {
+      IREE_TRACE_ZONE_END(z0);
+      return _TfLiteStatusFromIREEStatus(status);
+    }
+  }
+
   // NOTE: as with above we should use an iree_hal_buffer_map_read here.
   memcpy(output_data, output_tensor->buffer_mapping.contents.data,
          output_data_size);
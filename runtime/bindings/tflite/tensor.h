@@ -36,7 +36,10 @@ struct TfLiteTensor {
 
   // Allocated buffer view referencing the backing tensor memory.
   iree_hal_buffer_t* buffer;
-  // Persistently mapped buffer; invalidated when buffer is resized.
+  // Mapped buffer contents; invalidated when buffer is resized or rebound.
+  // Host-local buffers are mapped persistently so that the pointer returned by
+  // TfLiteTensorData remains valid across invocations. Other buffers use a
+  // scoped mapping for as long as they are bound to the tensor.
   iree_hal_buffer_mapping_t buffer_mapping;
 };
 
@@ -62,6 +65,8 @@ iree_status_t _TfLiteTensorReallocateIfNeeded(
 
 // Binds the given |buffer| to the tensor and maps it.
 // The tensor shape will be overwritten with the buffer view shape.
+// No-op if |buffer| is already bound so that repeated invocations returning
+// the same buffer keep their existing mapping.
 iree_status_t _TfLiteTensorBind(TfLiteTensor* tensor,
                                 iree_hal_buffer_t* buffer);
 
@@ -191,4 +191,21 @@
 #define IREE_ATTRIBUTE_UNUSED
 #endif  // IREE_HAVE_ATTRIBUTE(maybe_unused / unused)
 
+//===----------------------------------------------------------------------===//
+// IREE_THREAD_LOCAL
+//===----------------------------------------------------------------------===//
+
+// Declares a variable with thread storage duration. Only usable on variables
+// with static or extern linkage and trivial initialization.
+//
+// Example:
+//   static IREE_THREAD_LOCAL int32_t thread_slot = 0;
+#if defined(__cplusplus)
+#define IREE_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define IREE_THREAD_LOCAL __declspec(thread)
+#else
+#define IREE_THREAD_LOCAL _Thread_local
+#endif  // __cplusplus / _MSC_VER
+
 #endif  // IREE_BASE_ATTRIBUTES_H_
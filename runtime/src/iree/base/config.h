@@ -180,6 +180,24 @@ typedef IREE_DEVICE_SIZE_T iree_device_size_t;
 #define IREE_HAL_COMMAND_BUFFER_VALIDATION_ENABLE 1
 #endif  // IREE_HAL_COMMAND_BUFFER_VALIDATION_ENABLE
 
+#if !defined(IREE_HAL_DEFERRED_COMMAND_BUFFER_OPTIMIZATION_ENABLE)
+// Enables the peephole optimizations deferred command buffers run over their
+// recorded commands when recording ends (dropping redundant state changes,
+// merging adjacent transfers, and eliding unneeded barriers). Disable to have
+// the target command buffer receive exactly the commands that were recorded
+// when debugging or benchmarking command buffers.
+#define IREE_HAL_DEFERRED_COMMAND_BUFFER_OPTIMIZATION_ENABLE 1
+#endif  // IREE_HAL_DEFERRED_COMMAND_BUFFER_OPTIMIZATION_ENABLE
+
+#if !defined(IREE_HAL_SEMAPHORE_SPIN_DURATION_NS)
+// Duration in nanoseconds that host waits on local semaphores spin polling the
+// semaphore payload before parking the waiting thread. Waits on semaphores
+// signaled shortly after the wait begins (the common case when the host is
+// blocked on the tail of a short submission) then avoid the wake latency and
+// syscalls of a full wait. Set to 0 to always park immediately.
+#define IREE_HAL_SEMAPHORE_SPIN_DURATION_NS (20 * 1000)
+#endif  // IREE_HAL_SEMAPHORE_SPIN_DURATION_NS
+
 #if !defined(IREE_HAL_MODULE_STRING_UTIL_ENABLE)
 // Enables HAL module methods that perform string printing/parsing.
 // This functionality pulls in a large amount of string manipulation code that
@@ -204,6 +222,29 @@ typedef IREE_DEVICE_SIZE_T iree_device_size_t;
 #define IREE_VM_BACKTRACE_ENABLE 1
 #endif  // !IREE_VM_BACKTRACE_ENABLE
 
+#if !defined(IREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE)
+// Uses computed goto (direct-threaded) dispatch in the bytecode interpreter.
+// Each op jumps directly to the handler of the next op instead of returning to
+// a shared switch and is significantly faster on control-heavy programs.
+// Requires the GCC/clang labels-as-values extension; when disabled or
+// unsupported a portable switch-based dispatch loop is used.
+#if defined(IREE_COMPILER_MSVC) && !defined(IREE_COMPILER_CLANG)
+#define IREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE 0
+#else
+#define IREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE 1
+#endif  // MSVC
+#endif  // !IREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE
+
+#if !defined(IREE_VM_REF_COUNT_ATOMICS_ENABLE)
+// Uses atomic read-modify-write operations to update the reference counts of
+// VM ref objects. When disabled counts are updated with plain loads and stores
+// that avoid locked instructions and cache line contention. This is only safe
+// if ref objects (including HAL objects such as buffer views passed through
+// the VM) are never retained or released concurrently from multiple threads,
+// as is the case when each object stays within a single thread.
+#define IREE_VM_REF_COUNT_ATOMICS_ENABLE 1
+#endif  // !IREE_VM_REF_COUNT_ATOMICS_ENABLE
+
 #if !defined(IREE_VM_EXECUTION_TRACING_ENABLE)
 // Enables disassembly of vm bytecode functions and stderr dumping of execution.
 // Increases code size quite, lowers VM performance, and is generally unsafe;
@@ -234,6 +275,15 @@ typedef IREE_DEVICE_SIZE_T iree_device_size_t;
 #define IREE_VM_EXECUTION_TRACING_SRC_LOC_ENABLE 0
 #endif  // !IREE_VM_EXECUTION_TRACING_SRC_LOC_ENABLE
 
+#if !defined(IREE_VM_EXECUTION_PROFILING_ENABLE)
+// Enables collection of per-function instruction counts and timings and
+// per-import call latencies within the bytecode interpreter. Collection is
+// only performed for invocations with IREE_VM_INVOCATION_FLAG_PROFILE_EXECUTION
+// set (or within contexts created with IREE_VM_CONTEXT_FLAG_PROFILE_EXECUTION)
+// but when compiled in all invocations pay a small cost per instruction.
+#define IREE_VM_EXECUTION_PROFILING_ENABLE 0
+#endif  // !IREE_VM_EXECUTION_PROFILING_ENABLE
+
 #if !defined(IREE_VM_EXT_F32_ENABLE)
 // Enables the 32-bit floating-point instruction extension.
 // Targeted from the compiler with `-iree-vm-target-extension-f32`.
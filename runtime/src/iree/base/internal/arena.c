@@ -9,12 +9,44 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "iree/base/internal/atomics.h"
 #include "iree/base/tracing.h"
 
 //===----------------------------------------------------------------------===//
 // iree_arena_block_pool_t
 //===----------------------------------------------------------------------===//
 
+// Thread slot assigned on first use of any pool; 0 if unassigned.
+// Slots are shared by all pools so that a thread always maps to the same
+// magazine index.
+static iree_atomic_int32_t iree_arena_next_thread_slot =
+    IREE_ATOMIC_VAR_INIT(0);
+static IREE_THREAD_LOCAL int32_t iree_arena_thread_slot = 0;
+
+// Returns the magazine in |block_pool| assigned to the calling thread.
+static iree_arena_block_magazine_t* iree_arena_block_pool_current_magazine(
+    iree_arena_block_pool_t* block_pool) {
+  int32_t slot = iree_arena_thread_slot;
+  if (IREE_UNLIKELY(slot == 0)) {
+    slot = iree_atomic_fetch_add_int32(&iree_arena_next_thread_slot, 1,
+                                       iree_memory_order_relaxed) +
+           1;
+    iree_arena_thread_slot = slot;
+  }
+  return &block_pool->magazines[(uint32_t)(slot - 1) %
+                                IREE_ARENA_BLOCK_POOL_MAGAZINE_COUNT];
+}
+
+// Frees all blocks in the |head| list back to the block pool allocator.
+static void iree_arena_block_pool_free_blocks(
+    iree_arena_block_pool_t* block_pool, iree_arena_block_t* head) {
+  while (head) {
+    void* ptr = (uint8_t*)head - block_pool->usable_block_size;
+    head = head->next;
+    iree_allocator_free(block_pool->block_allocator, ptr);
+  }
+}
+
 void iree_arena_block_pool_initialize(iree_host_size_t total_block_size,
                                       iree_allocator_t block_allocator,
                                       iree_arena_block_pool_t* out_block_pool) {
@@ -25,6 +57,10 @@ void iree_arena_block_pool_initialize(iree_host_size_t total_block_size,
   out_block_pool->usable_block_size =
       total_block_size - sizeof(iree_arena_block_t);
   out_block_pool->block_allocator = block_allocator;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(out_block_pool->magazines);
+       ++i) {
+    iree_slim_mutex_initialize(&out_block_pool->magazines[i].mutex);
+  }
   iree_atomic_arena_block_slist_initialize(&out_block_pool->available_slist);
 
   IREE_TRACE_ZONE_END(z0);
@@ -37,6 +73,9 @@ void iree_arena_block_pool_deinitialize(iree_arena_block_pool_t* block_pool) {
   // it doesn't retain any blocks.
   iree_arena_block_pool_trim(block_pool);
   iree_atomic_arena_block_slist_deinitialize(&block_pool->available_slist);
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(block_pool->magazines); ++i) {
+    iree_slim_mutex_deinitialize(&block_pool->magazines[i].mutex);
+  }
 
   IREE_TRACE_ZONE_END(z0);
 }
@@ -44,15 +83,21 @@ void iree_arena_block_pool_deinitialize(iree_arena_block_pool_t* block_pool) {
 void iree_arena_block_pool_trim(iree_arena_block_pool_t* block_pool) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(block_pool->magazines); ++i) {
+    iree_arena_block_magazine_t* magazine = &block_pool->magazines[i];
+    iree_slim_mutex_lock(&magazine->mutex);
+    iree_arena_block_t* head = magazine->block_head;
+    magazine->block_head = NULL;
+    magazine->block_count = 0;
+    iree_slim_mutex_unlock(&magazine->mutex);
+    iree_arena_block_pool_free_blocks(block_pool, head);
+  }
+
   iree_arena_block_t* head = NULL;
   iree_atomic_arena_block_slist_flush(
       &block_pool->available_slist,
       IREE_ATOMIC_SLIST_FLUSH_ORDER_APPROXIMATE_LIFO, &head, NULL);
-  while (head) {
-    void* ptr = (uint8_t*)head - block_pool->usable_block_size;
-    head = head->next;
-    iree_allocator_free(block_pool->block_allocator, ptr);
-  }
+  iree_arena_block_pool_free_blocks(block_pool, head);
 
   IREE_TRACE_ZONE_END(z0);
 }
@@ -61,8 +106,21 @@ iree_status_t iree_arena_block_pool_acquire(iree_arena_block_pool_t* block_pool,
                                             iree_arena_block_t** out_block) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
-  iree_arena_block_t* block =
-      iree_atomic_arena_block_slist_pop(&block_pool->available_slist);
+  // Try the magazine of the calling thread first and only fall back to the
+  // shared list when it is empty.
+  iree_arena_block_t* block = NULL;
+  iree_arena_block_magazine_t* magazine =
+      iree_arena_block_pool_current_magazine(block_pool);
+  iree_slim_mutex_lock(&magazine->mutex);
+  if (magazine->block_head) {
+    block = magazine->block_head;
+    magazine->block_head = block->next;
+    --magazine->block_count;
+  }
+  iree_slim_mutex_unlock(&magazine->mutex);
+  if (!block) {
+    block = iree_atomic_arena_block_slist_pop(&block_pool->available_slist);
+  }
 
   if (!block) {
     // No blocks available; allocate one now.
@@ -90,8 +148,27 @@ void iree_arena_block_pool_release(iree_arena_block_pool_t* block_pool,
                                    iree_arena_block_t* block_head,
                                    iree_arena_block_t* block_tail) {
   IREE_TRACE_ZONE_BEGIN(z0);
-  iree_atomic_arena_block_slist_concat(&block_pool->available_slist, block_head,
-                                       block_tail);
+
+  // Fill the magazine of the calling thread up to its capacity and spill the
+  // remaining blocks (if any) to the shared list.
+  iree_arena_block_magazine_t* magazine =
+      iree_arena_block_pool_current_magazine(block_pool);
+  iree_slim_mutex_lock(&magazine->mutex);
+  while (block_head &&
+         magazine->block_count < IREE_ARENA_BLOCK_POOL_MAGAZINE_CAPACITY) {
+    iree_arena_block_t* block = block_head;
+    block_head = block == block_tail ? NULL : block->next;
+    block->next = magazine->block_head;
+    magazine->block_head = block;
+    ++magazine->block_count;
+  }
+  iree_slim_mutex_unlock(&magazine->mutex);
+
+  if (block_head) {
+    iree_atomic_arena_block_slist_concat(&block_pool->available_slist,
+                                         block_head, block_tail);
+  }
+
   IREE_TRACE_ZONE_END(z0);
 }
 
@@ -11,6 +11,7 @@
 
 #include "iree/base/api.h"
 #include "iree/base/internal/atomic_slist.h"
+#include "iree/base/internal/synchronization.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,34 @@ typedef struct iree_arena_block_t {
 IREE_TYPED_ATOMIC_SLIST_WRAPPER(iree_atomic_arena_block, iree_arena_block_t,
                                 offsetof(iree_arena_block_t, next));
 
+// Total number of per-thread block magazines in each pool. Threads are assigned
+// a magazine on first use and threads beyond this count share magazines.
+// Must be at least 1.
+#if !defined(IREE_ARENA_BLOCK_POOL_MAGAZINE_COUNT)
+#define IREE_ARENA_BLOCK_POOL_MAGAZINE_COUNT 8
+#endif  // !IREE_ARENA_BLOCK_POOL_MAGAZINE_COUNT
+
+// Maximum number of free blocks cached in each magazine. Blocks released while
+// the magazine is full go to the shared pool list. 0 disables the magazines.
+#if !defined(IREE_ARENA_BLOCK_POOL_MAGAZINE_CAPACITY)
+#define IREE_ARENA_BLOCK_POOL_MAGAZINE_CAPACITY 8
+#endif  // !IREE_ARENA_BLOCK_POOL_MAGAZINE_CAPACITY
+
+// A small per-thread cache of free blocks in front of the shared pool list.
+typedef union iree_arena_block_magazine_t {
+  struct {
+    // Guards the magazine; only contended when threads share a magazine.
+    iree_slim_mutex_t mutex;
+    // Number of blocks in the block_head list.
+    iree_host_size_t block_count;
+    // Linked list of free blocks (LIFO).
+    iree_arena_block_t* block_head;
+  };
+  // Pads each magazine to a cache line so that threads using adjacent
+  // magazines don't contend on the same line.
+  uint8_t reserved[64];
+} iree_arena_block_magazine_t;
+
 // A simple atomic fixed-size block pool.
 // Blocks are allocated from the system as required and kept in the pool to
 // satisfy future requests. Blocks are all of a uniform size specified when the
@@ -41,9 +70,17 @@ IREE_TYPED_ATOMIC_SLIST_WRAPPER(iree_atomic_arena_block, iree_arena_block_t,
 // blocks so that the underlying allocator is more likely to bucket them
 // appropriately.
 //
+// Each thread acquiring and releasing blocks first tries a small magazine of
+// blocks assigned to it before falling back to the shared list. This keeps
+// threads that repeatedly reset arenas (command buffer recording, etc) from
+// all contending on the shared list head. Magazines are bounded by
+// IREE_ARENA_BLOCK_POOL_MAGAZINE_CAPACITY and flushed by trim.
+//
 // Thread-safe; multiple threads may acquire and release blocks from the pool.
 // The underlying allocator must also be thread-safe.
 typedef struct iree_arena_block_pool_t {
+  // Per-thread caches of free blocks checked before available_slist.
+  iree_arena_block_magazine_t magazines[IREE_ARENA_BLOCK_POOL_MAGAZINE_COUNT];
   // Block size, in bytes. All blocks in the available_slist will have this
   // byte size which includes the iree_arena_block_t footer.
   iree_host_size_t total_block_size;
@@ -69,6 +106,7 @@ void iree_arena_block_pool_initialize(iree_host_size_t total_block_size,
 void iree_arena_block_pool_deinitialize(iree_arena_block_pool_t* block_pool);
 
 // Trims the pool by freeing unused blocks back to the allocator.
+// Blocks cached in the per-thread magazines are freed as well.
 // Acquired blocks are not freed and remain valid.
 void iree_arena_block_pool_trim(iree_arena_block_pool_t* block_pool);
 
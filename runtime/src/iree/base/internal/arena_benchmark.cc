@@ -0,0 +1,71 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+#include "iree/base/api.h"
+#include "iree/base/internal/arena.h"
+
+namespace {
+
+//==============================================================================
+// iree_arena_block_pool_t
+//==============================================================================
+
+// Shared by all benchmark threads like a pool shared by all command buffers on
+// a device. Blocks are 32KB like the HAL pools.
+iree_arena_block_pool_t* SharedBlockPool() {
+  static iree_arena_block_pool_t* block_pool =
+      ([]() -> iree_arena_block_pool_t* {
+        auto pool = new iree_arena_block_pool_t();
+        iree_arena_block_pool_initialize(32 * 1024, iree_allocator_system(),
+                                         pool);
+        return pool;
+      })();
+  return block_pool;
+}
+
+// Acquires and releases one block at a time.
+void BM_BlockPoolAcquireRelease(benchmark::State& state) {
+  iree_arena_block_pool_t* block_pool = SharedBlockPool();
+  for (auto _ : state) {
+    iree_arena_block_t* block = NULL;
+    IREE_CHECK_OK(iree_arena_block_pool_acquire(block_pool, &block));
+    benchmark::DoNotOptimize(block);
+    iree_arena_block_pool_release(block_pool, block, block);
+  }
+}
+BENCHMARK(BM_BlockPoolAcquireRelease)->UseRealTime()->ThreadRange(1, 16);
+
+// Emulates command buffer recording: an arena is filled with a number of
+// blocks worth of commands and then reset, releasing all blocks at once.
+void BM_ArenaRecordReset(benchmark::State& state) {
+  iree_arena_block_pool_t* block_pool = SharedBlockPool();
+  iree_arena_allocator_t arena;
+  iree_arena_initialize(block_pool, &arena);
+  const iree_host_size_t block_count = (iree_host_size_t)state.range(0);
+  const iree_host_size_t allocation_size = 256;
+  const iree_host_size_t allocation_count =
+      block_count * (block_pool->usable_block_size / allocation_size);
+  for (auto _ : state) {
+    for (iree_host_size_t i = 0; i < allocation_count; ++i) {
+      void* ptr = NULL;
+      IREE_CHECK_OK(iree_arena_allocate(&arena, allocation_size, &ptr));
+      benchmark::DoNotOptimize(ptr);
+    }
+    iree_arena_reset(&arena);
+  }
+  iree_arena_deinitialize(&arena);
+}
+BENCHMARK(BM_ArenaRecordReset)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(16)
+    ->UseRealTime()
+    ->ThreadRange(1, 16);
+
+}  // namespace
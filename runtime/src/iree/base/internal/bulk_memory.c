@@ -0,0 +1,400 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/bulk_memory.h"
+
+#include <string.h>
+
+#include "iree/base/internal/call_once.h"
+#include "iree/base/internal/cpu.h"
+#include "iree/base/target_platform.h"
+
+#if defined(IREE_ARCH_X86_64)
+#include <immintrin.h>
+#elif defined(IREE_ARCH_ARM_64)
+#include <arm_neon.h>
+#endif  // IREE_ARCH_*
+
+// AVX kernels are compiled with a function-level target attribute so that the
+// rest of the file (and the runtime) can be built for the baseline ISA.
+// MSVC allows the intrinsics to be used without any annotation.
+#if defined(IREE_ARCH_X86_64) && \
+    (defined(IREE_COMPILER_GCC_COMPAT) || defined(IREE_COMPILER_MSVC))
+#define IREE_BULK_MEMORY_HAVE_AVX 1
+#if defined(IREE_COMPILER_GCC_COMPAT)
+#define IREE_BULK_MEMORY_TARGET_AVX __attribute__((target("avx")))
+#else
+#define IREE_BULK_MEMORY_TARGET_AVX
+#endif  // IREE_COMPILER_GCC_COMPAT
+#endif  // IREE_ARCH_X86_64
+
+//===----------------------------------------------------------------------===//
+// Fill kernels
+//===----------------------------------------------------------------------===//
+
+// Fills |length| bytes at |target| with the repeating 8-byte |pattern|.
+// The first byte of |pattern| is stored at |target|.
+typedef void (*iree_bulk_memory_fill_fn_t)(uint8_t* target,
+                                           iree_host_size_t length,
+                                           uint64_t pattern);
+
+// Stores the trailing |length| < 8 bytes of a fill.
+static inline void iree_bulk_memory_fill_tail(uint8_t* target,
+                                              iree_host_size_t length,
+                                              uint64_t pattern) {
+  memcpy(target, &pattern, length);
+}
+
+static void iree_bulk_memory_fill_scalar(uint8_t* target,
+                                         iree_host_size_t length,
+                                         uint64_t pattern) {
+  iree_host_size_t i = 0;
+  for (; i + sizeof(pattern) <= length; i += sizeof(pattern)) {
+    memcpy(target + i, &pattern, sizeof(pattern));
+  }
+  iree_bulk_memory_fill_tail(target + i, length - i, pattern);
+}
+
+#if defined(IREE_ARCH_X86_64)
+
+static void iree_bulk_memory_fill_sse2(uint8_t* target, iree_host_size_t length,
+                                       uint64_t pattern) {
+  const __m128i value = _mm_set1_epi64x((long long)pattern);
+  iree_host_size_t i = 0;
+  for (; i + 4 * sizeof(value) <= length; i += 4 * sizeof(value)) {
+    _mm_storeu_si128((__m128i*)(target + i + 0 * sizeof(value)), value);
+    _mm_storeu_si128((__m128i*)(target + i + 1 * sizeof(value)), value);
+    _mm_storeu_si128((__m128i*)(target + i + 2 * sizeof(value)), value);
+    _mm_storeu_si128((__m128i*)(target + i + 3 * sizeof(value)), value);
+  }
+  for (; i + sizeof(value) <= length; i += sizeof(value)) {
+    _mm_storeu_si128((__m128i*)(target + i), value);
+  }
+  iree_bulk_memory_fill_scalar(target + i, length - i, pattern);
+}
+
+#endif  // IREE_ARCH_X86_64
+
+#if defined(IREE_BULK_MEMORY_HAVE_AVX)
+
+IREE_BULK_MEMORY_TARGET_AVX static void iree_bulk_memory_fill_avx(
+    uint8_t* target, iree_host_size_t length, uint64_t pattern) {
+  const __m256i value = _mm256_set1_epi64x((long long)pattern);
+  iree_host_size_t i = 0;
+  for (; i + 4 * sizeof(value) <= length; i += 4 * sizeof(value)) {
+    _mm256_storeu_si256((__m256i*)(target + i + 0 * sizeof(value)), value);
+    _mm256_storeu_si256((__m256i*)(target + i + 1 * sizeof(value)), value);
+    _mm256_storeu_si256((__m256i*)(target + i + 2 * sizeof(value)), value);
+    _mm256_storeu_si256((__m256i*)(target + i + 3 * sizeof(value)), value);
+  }
+  for (; i + sizeof(value) <= length; i += sizeof(value)) {
+    _mm256_storeu_si256((__m256i*)(target + i), value);
+  }
+  iree_bulk_memory_fill_scalar(target + i, length - i, pattern);
+}
+
+#endif  // IREE_BULK_MEMORY_HAVE_AVX
+
+#if defined(IREE_ARCH_ARM_64)
+
+static void iree_bulk_memory_fill_neon(uint8_t* target, iree_host_size_t length,
+                                       uint64_t pattern) {
+  const uint8x16_t value = vreinterpretq_u8_u64(vdupq_n_u64(pattern));
+  iree_host_size_t i = 0;
+  for (; i + 4 * sizeof(value) <= length; i += 4 * sizeof(value)) {
+    vst1q_u8(target + i + 0 * sizeof(value), value);
+    vst1q_u8(target + i + 1 * sizeof(value), value);
+    vst1q_u8(target + i + 2 * sizeof(value), value);
+    vst1q_u8(target + i + 3 * sizeof(value), value);
+  }
+  for (; i + sizeof(value) <= length; i += sizeof(value)) {
+    vst1q_u8(target + i, value);
+  }
+  iree_bulk_memory_fill_scalar(target + i, length - i, pattern);
+}
+
+#endif  // IREE_ARCH_ARM_64
+
+static iree_once_flag iree_bulk_memory_fill_fn_flag = IREE_ONCE_FLAG_INIT;
+static iree_bulk_memory_fill_fn_t iree_bulk_memory_fill_fn =
+    iree_bulk_memory_fill_scalar;
+
+// Selects the widest fill kernel supported by the current processor.
+// SSE2 and NEON are part of the x86_64 and aarch64 baselines.
+static void iree_bulk_memory_select_fill_fn(void) {
+#if defined(IREE_ARCH_X86_64)
+  iree_bulk_memory_fill_fn = iree_bulk_memory_fill_sse2;
+#if defined(IREE_BULK_MEMORY_HAVE_AVX)
+  uint64_t cpu_data0 = 0;
+  iree_cpu_query_data_fields(1, &cpu_data0);
+  if (cpu_data0 & IREE_CPU_DATA0_X86_64_AVX) {
+    iree_bulk_memory_fill_fn = iree_bulk_memory_fill_avx;
+  }
+#endif  // IREE_BULK_MEMORY_HAVE_AVX
+#elif defined(IREE_ARCH_ARM_64)
+  iree_bulk_memory_fill_fn = iree_bulk_memory_fill_neon;
+#endif  // IREE_ARCH_*
+}
+
+// Fills below this many bytes don't amortize the kernel dispatch.
+#define IREE_BULK_MEMORY_FILL_SCALAR_MAX_LENGTH 64
+
+void iree_bulk_memory_fill(void* target, iree_host_size_t element_count,
+                           const void* pattern,
+                           iree_host_size_t element_length) {
+  IREE_ASSERT(element_length == 1 || element_length == 2 ||
+              element_length == 4 || element_length == 8);
+  if (!element_count) return;
+  IREE_ASSERT_ARGUMENT(target);
+  IREE_ASSERT_ARGUMENT(pattern);
+
+  // Replicate the pattern to 8 bytes; since each element length evenly divides
+  // 8 storing the replicated pattern from any element boundary is valid.
+  uint8_t pattern_bytes[8];
+  for (iree_host_size_t i = 0; i < sizeof(pattern_bytes); i += element_length) {
+    memcpy(pattern_bytes + i, pattern, element_length);
+  }
+  uint64_t pattern64 = 0;
+  memcpy(&pattern64, pattern_bytes, sizeof(pattern64));
+
+  // Patterns made of a single repeated byte (including all zeros) are handled
+  // by memset, which is usually the most heavily tuned routine available.
+  const iree_host_size_t length = element_count * element_length;
+  const uint64_t byte_splat = 0x0101010101010101ull * pattern_bytes[0];
+  if (pattern64 == byte_splat) {
+    memset(target, pattern_bytes[0], length);
+    return;
+  }
+
+  if (length < IREE_BULK_MEMORY_FILL_SCALAR_MAX_LENGTH) {
+    iree_bulk_memory_fill_scalar((uint8_t*)target, length, pattern64);
+    return;
+  }
+  iree_call_once(&iree_bulk_memory_fill_fn_flag,
+                 iree_bulk_memory_select_fill_fn);
+  iree_bulk_memory_fill_fn((uint8_t*)target, length, pattern64);
+}
+
+//===----------------------------------------------------------------------===//
+// Strided copies
+//===----------------------------------------------------------------------===//
+
+// Copies rows of a fixed |row_length| so that the memcpy can be inlined.
+static IREE_ATTRIBUTE_ALWAYS_INLINE inline void iree_bulk_memory_copy_rows(
+    uint8_t* target, iree_host_size_t target_stride, const uint8_t* source,
+    iree_host_size_t source_stride, iree_host_size_t row_length,
+    iree_host_size_t row_count) {
+  for (iree_host_size_t i = 0; i < row_count; ++i) {
+    memcpy(target, source, row_length);
+    target += target_stride;
+    source += source_stride;
+  }
+}
+
+void iree_bulk_memory_copy_2d(void* target, iree_host_size_t target_stride,
+                              const void* source,
+                              iree_host_size_t source_stride,
+                              iree_host_size_t row_length,
+                              iree_host_size_t row_count) {
+  if (!row_length || !row_count) return;
+  IREE_ASSERT_ARGUMENT(target);
+  IREE_ASSERT_ARGUMENT(source);
+  if (target_stride == row_length && source_stride == row_length) {
+    memcpy(target, source, row_length * row_count);
+    return;
+  }
+  uint8_t* target_ptr = (uint8_t*)target;
+  const uint8_t* source_ptr = (const uint8_t*)source;
+  switch (row_length) {
+#define IREE_BULK_MEMORY_COPY_ROWS_CASE(n)                               \
+  case n:                                                                \
+    iree_bulk_memory_copy_rows(target_ptr, target_stride, source_ptr,    \
+                               source_stride, n, row_count);             \
+    break;
+    IREE_BULK_MEMORY_COPY_ROWS_CASE(1)
+    IREE_BULK_MEMORY_COPY_ROWS_CASE(2)
+    IREE_BULK_MEMORY_COPY_ROWS_CASE(4)
+    IREE_BULK_MEMORY_COPY_ROWS_CASE(8)
+    IREE_BULK_MEMORY_COPY_ROWS_CASE(16)
+    IREE_BULK_MEMORY_COPY_ROWS_CASE(32)
+#undef IREE_BULK_MEMORY_COPY_ROWS_CASE
+    default:
+      iree_bulk_memory_copy_rows(target_ptr, target_stride, source_ptr,
+                                 source_stride, row_length, row_count);
+      break;
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// Transposes
+//===----------------------------------------------------------------------===//
+
+// Square tile size in elements used to keep both the source rows and target
+// rows of a tile resident in cache.
+#define IREE_BULK_MEMORY_TRANSPOSE_TILE_SIZE 8
+
+// Transposes a tile of up to TILE_SIZE x TILE_SIZE elements of a fixed
+// |element_length| so that the element copies can be inlined.
+static IREE_ATTRIBUTE_ALWAYS_INLINE inline void
+iree_bulk_memory_transpose_tile_scalar(uint8_t* target,
+                                       iree_host_size_t target_stride,
+                                       const uint8_t* source,
+                                       iree_host_size_t source_stride,
+                                       iree_host_size_t row_count,
+                                       iree_host_size_t column_count,
+                                       iree_host_size_t element_length) {
+  for (iree_host_size_t r = 0; r < row_count; ++r) {
+    const uint8_t* source_row = source + r * source_stride;
+    for (iree_host_size_t c = 0; c < column_count; ++c) {
+      memcpy(target + c * target_stride + r * element_length,
+             source_row + c * element_length, element_length);
+    }
+  }
+}
+
+#if defined(IREE_ARCH_X86_64) || defined(IREE_ARCH_ARM_64)
+
+// Transposes a full 4x4 tile of 32-bit elements.
+static inline void iree_bulk_memory_transpose_4x4_x32(
+    uint8_t* target, iree_host_size_t target_stride, const uint8_t* source,
+    iree_host_size_t source_stride) {
+#if defined(IREE_ARCH_X86_64)
+  __m128i r0 = _mm_loadu_si128((const __m128i*)(source + 0 * source_stride));
+  __m128i r1 = _mm_loadu_si128((const __m128i*)(source + 1 * source_stride));
+  __m128i r2 = _mm_loadu_si128((const __m128i*)(source + 2 * source_stride));
+  __m128i r3 = _mm_loadu_si128((const __m128i*)(source + 3 * source_stride));
+  __m128i t0 = _mm_unpacklo_epi32(r0, r1);  // r0[0] r1[0] r0[1] r1[1]
+  __m128i t1 = _mm_unpacklo_epi32(r2, r3);  // r2[0] r3[0] r2[1] r3[1]
+  __m128i t2 = _mm_unpackhi_epi32(r0, r1);  // r0[2] r1[2] r0[3] r1[3]
+  __m128i t3 = _mm_unpackhi_epi32(r2, r3);  // r2[2] r3[2] r2[3] r3[3]
+  _mm_storeu_si128((__m128i*)(target + 0 * target_stride),
+                   _mm_unpacklo_epi64(t0, t1));
+  _mm_storeu_si128((__m128i*)(target + 1 * target_stride),
+                   _mm_unpackhi_epi64(t0, t1));
+  _mm_storeu_si128((__m128i*)(target + 2 * target_stride),
+                   _mm_unpacklo_epi64(t2, t3));
+  _mm_storeu_si128((__m128i*)(target + 3 * target_stride),
+                   _mm_unpackhi_epi64(t2, t3));
+#else
+  uint32x4_t r0 = vreinterpretq_u32_u8(vld1q_u8(source + 0 * source_stride));
+  uint32x4_t r1 = vreinterpretq_u32_u8(vld1q_u8(source + 1 * source_stride));
+  uint32x4_t r2 = vreinterpretq_u32_u8(vld1q_u8(source + 2 * source_stride));
+  uint32x4_t r3 = vreinterpretq_u32_u8(vld1q_u8(source + 3 * source_stride));
+  uint32x4x2_t t01 = vtrnq_u32(r0, r1);  // [r0[0] r1[0] r0[2] r1[2]], [odd]
+  uint32x4x2_t t23 = vtrnq_u32(r2, r3);  // [r2[0] r3[0] r2[2] r3[2]], [odd]
+  vst1q_u8(target + 0 * target_stride,
+           vreinterpretq_u8_u32(vcombine_u32(vget_low_u32(t01.val[0]),
+                                             vget_low_u32(t23.val[0]))));
+  vst1q_u8(target + 1 * target_stride,
+           vreinterpretq_u8_u32(vcombine_u32(vget_low_u32(t01.val[1]),
+                                             vget_low_u32(t23.val[1]))));
+  vst1q_u8(target + 2 * target_stride,
+           vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(t01.val[0]),
+                                             vget_high_u32(t23.val[0]))));
+  vst1q_u8(target + 3 * target_stride,
+           vreinterpretq_u8_u32(vcombine_u32(vget_high_u32(t01.val[1]),
+                                             vget_high_u32(t23.val[1]))));
+#endif  // IREE_ARCH_*
+}
+
+// Transposes a tile of 32-bit elements using 4x4 vector transposes for the
+// full 4x4 sub-tiles and scalar copies for the ragged edges.
+static void iree_bulk_memory_transpose_tile_x32(
+    uint8_t* target, iree_host_size_t target_stride, const uint8_t* source,
+    iree_host_size_t source_stride, iree_host_size_t row_count,
+    iree_host_size_t column_count) {
+  const iree_host_size_t full_rows = row_count & ~(iree_host_size_t)3;
+  const iree_host_size_t full_columns = column_count & ~(iree_host_size_t)3;
+  for (iree_host_size_t r = 0; r < full_rows; r += 4) {
+    for (iree_host_size_t c = 0; c < full_columns; c += 4) {
+      iree_bulk_memory_transpose_4x4_x32(
+          target + c * target_stride + r * sizeof(uint32_t), target_stride,
+          source + r * source_stride + c * sizeof(uint32_t), source_stride);
+    }
+  }
+  if (full_columns < column_count) {
+    iree_bulk_memory_transpose_tile_scalar(
+        target + full_columns * target_stride, target_stride,
+        source + full_columns * sizeof(uint32_t), source_stride, full_rows,
+        column_count - full_columns, sizeof(uint32_t));
+  }
+  if (full_rows < row_count) {
+    iree_bulk_memory_transpose_tile_scalar(
+        target + full_rows * sizeof(uint32_t), target_stride,
+        source + full_rows * source_stride, source_stride,
+        row_count - full_rows, column_count, sizeof(uint32_t));
+  }
+}
+
+#endif  // IREE_ARCH_X86_64 || IREE_ARCH_ARM_64
+
+// Transposes a tile of at most TILE_SIZE x TILE_SIZE elements.
+static void iree_bulk_memory_transpose_tile(uint8_t* target,
+                                            iree_host_size_t target_stride,
+                                            const uint8_t* source,
+                                            iree_host_size_t source_stride,
+                                            iree_host_size_t row_count,
+                                            iree_host_size_t column_count,
+                                            iree_host_size_t element_length) {
+  switch (element_length) {
+    case 1:
+      iree_bulk_memory_transpose_tile_scalar(target, target_stride, source,
+                                             source_stride, row_count,
+                                             column_count, 1);
+      break;
+    case 2:
+      iree_bulk_memory_transpose_tile_scalar(target, target_stride, source,
+                                             source_stride, row_count,
+                                             column_count, 2);
+      break;
+    case 4:
+#if defined(IREE_ARCH_X86_64) || defined(IREE_ARCH_ARM_64)
+      iree_bulk_memory_transpose_tile_x32(target, target_stride, source,
+                                          source_stride, row_count,
+                                          column_count);
+#else
+      iree_bulk_memory_transpose_tile_scalar(target, target_stride, source,
+                                             source_stride, row_count,
+                                             column_count, 4);
+#endif  // IREE_ARCH_X86_64 || IREE_ARCH_ARM_64
+      break;
+    case 8:
+      iree_bulk_memory_transpose_tile_scalar(target, target_stride, source,
+                                             source_stride, row_count,
+                                             column_count, 8);
+      break;
+    default:
+      IREE_ASSERT_UNREACHABLE("unsupported element length");
+      break;
+  }
+}
+
+void iree_bulk_memory_transpose_2d(void* target, iree_host_size_t target_stride,
+                                   const void* source,
+                                   iree_host_size_t source_stride,
+                                   iree_host_size_t row_count,
+                                   iree_host_size_t column_count,
+                                   iree_host_size_t element_length) {
+  IREE_ASSERT(element_length == 1 || element_length == 2 ||
+              element_length == 4 || element_length == 8);
+  if (!row_count || !column_count) return;
+  IREE_ASSERT_ARGUMENT(target);
+  IREE_ASSERT_ARGUMENT(source);
+  uint8_t* target_ptr = (uint8_t*)target;
+  const uint8_t* source_ptr = (const uint8_t*)source;
+  const iree_host_size_t tile_size = IREE_BULK_MEMORY_TRANSPOSE_TILE_SIZE;
+  for (iree_host_size_t r = 0; r < row_count; r += tile_size) {
+    const iree_host_size_t tile_rows = iree_min(tile_size, row_count - r);
+    for (iree_host_size_t c = 0; c < column_count; c += tile_size) {
+      const iree_host_size_t tile_columns =
+          iree_min(tile_size, column_count - c);
+      iree_bulk_memory_transpose_tile(
+          target_ptr + c * target_stride + r * element_length, target_stride,
+          source_ptr + r * source_stride + c * element_length, source_stride,
+          tile_rows, tile_columns, element_length);
+    }
+  }
+}
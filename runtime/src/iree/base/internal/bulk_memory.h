@@ -0,0 +1,63 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_BASE_INTERNAL_BULK_MEMORY_H_
+#define IREE_BASE_INTERNAL_BULK_MEMORY_H_
+
+#include <stddef.h>
+
+#include "iree/base/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_bulk_memory_*
+//===----------------------------------------------------------------------===//
+// Host memory fill/copy/transpose routines for the runtime's bulk data paths.
+//
+// The routines use the widest vector width available on the processor
+// executing them, as reported by iree/base/internal/cpu.h, and fall back to
+// portable scalar code on other architectures. Contiguous byte operations are
+// forwarded to the C library memset/memcpy which are already well tuned.
+//
+// Pointers need not be aligned to the element size but aligned pointers are
+// faster on most architectures. Source and target ranges must not overlap.
+
+// Fills |element_count| elements of |element_length| bytes each starting at
+// |target| with the |element_length| bytes of |pattern|.
+// |element_length| must be one of 1, 2, 4, or 8.
+void iree_bulk_memory_fill(void* target, iree_host_size_t element_count,
+                           const void* pattern,
+                           iree_host_size_t element_length);
+
+// Copies |row_count| rows of |row_length| bytes each from |source| to |target|.
+// Rows in each are separated by the given strides in bytes; strides equal to
+// |row_length| indicate contiguous data and result in a single memcpy.
+void iree_bulk_memory_copy_2d(void* target, iree_host_size_t target_stride,
+                              const void* source,
+                              iree_host_size_t source_stride,
+                              iree_host_size_t row_length,
+                              iree_host_size_t row_count);
+
+// Transposes the |row_count| by |column_count| row-major matrix of elements
+// of |element_length| bytes at |source| into the |column_count| by |row_count|
+// matrix at |target| such that target[c][r] = source[r][c].
+// Strides are the distance in bytes between rows of each matrix.
+// |element_length| must be one of 1, 2, 4, or 8.
+void iree_bulk_memory_transpose_2d(void* target, iree_host_size_t target_stride,
+                                   const void* source,
+                                   iree_host_size_t source_stride,
+                                   iree_host_size_t row_count,
+                                   iree_host_size_t column_count,
+                                   iree_host_size_t element_length);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_BASE_INTERNAL_BULK_MEMORY_H_
@@ -0,0 +1,153 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/bulk_memory.h"
+
+#include <cstring>
+#include <vector>
+
+#include "iree/testing/gtest.h"
+
+namespace {
+
+// Element lengths supported by all of the bulk memory routines.
+static const iree_host_size_t kElementLengths[] = {1, 2, 4, 8};
+
+// Returns |length| bytes of distinct-ish values.
+static std::vector<uint8_t> MakeSequence(iree_host_size_t length) {
+  std::vector<uint8_t> data(length);
+  for (iree_host_size_t i = 0; i < length; ++i) {
+    data[i] = (uint8_t)(i * 7 + 3);
+  }
+  return data;
+}
+
+//==============================================================================
+// iree_bulk_memory_fill
+//==============================================================================
+
+TEST(BulkMemoryTest, FillEmpty) {
+  uint32_t pattern = 0xCAFEF00Du;
+  iree_bulk_memory_fill(NULL, 0, &pattern, sizeof(pattern));
+}
+
+TEST(BulkMemoryTest, FillPatterns) {
+  const uint8_t pattern_bytes[8] = {0x01, 0x23, 0x45, 0x67,
+                                    0x89, 0xAB, 0xCD, 0xEF};
+  // Covers the scalar path, each vector width and ragged tails, with the
+  // target offset from the allocation (and any alignment) by |offset| bytes.
+  const iree_host_size_t kElementCounts[] = {1, 3, 7, 8, 31, 64, 129, 1000};
+  for (iree_host_size_t element_length : kElementLengths) {
+    for (iree_host_size_t element_count : kElementCounts) {
+      for (iree_host_size_t offset = 0; offset < 8; ++offset) {
+        const iree_host_size_t length = element_count * element_length;
+        std::vector<uint8_t> buffer(offset + length + 8, 0xFF);
+        iree_bulk_memory_fill(buffer.data() + offset, element_count,
+                              pattern_bytes, element_length);
+        for (iree_host_size_t i = 0; i < offset; ++i) {
+          ASSERT_EQ(0xFF, buffer[i]);
+        }
+        for (iree_host_size_t i = 0; i < length; ++i) {
+          ASSERT_EQ(pattern_bytes[i % element_length], buffer[offset + i])
+              << "element_length=" << element_length
+              << " element_count=" << element_count << " offset=" << offset
+              << " i=" << i;
+        }
+        for (iree_host_size_t i = offset + length; i < buffer.size(); ++i) {
+          ASSERT_EQ(0xFF, buffer[i]);
+        }
+      }
+    }
+  }
+}
+
+TEST(BulkMemoryTest, FillSplatPatterns) {
+  // Patterns of a single repeated byte are routed through memset.
+  for (uint8_t byte : {0x00, 0x5A}) {
+    for (iree_host_size_t element_length : kElementLengths) {
+      uint8_t pattern_bytes[8];
+      memset(pattern_bytes, byte, sizeof(pattern_bytes));
+      std::vector<uint8_t> buffer(256 * element_length + 1, 0xFF);
+      iree_bulk_memory_fill(buffer.data(), 256, pattern_bytes, element_length);
+      for (iree_host_size_t i = 0; i < 256 * element_length; ++i) {
+        ASSERT_EQ(byte, buffer[i]);
+      }
+      EXPECT_EQ(0xFF, buffer.back());
+    }
+  }
+}
+
+//==============================================================================
+// iree_bulk_memory_copy_2d
+//==============================================================================
+
+TEST(BulkMemoryTest, Copy2DContiguous) {
+  std::vector<uint8_t> source = MakeSequence(5 * 24);
+  std::vector<uint8_t> target(source.size(), 0);
+  iree_bulk_memory_copy_2d(target.data(), 24, source.data(), 24, 24, 5);
+  EXPECT_EQ(source, target);
+}
+
+TEST(BulkMemoryTest, Copy2DStrided) {
+  const iree_host_size_t kRowLengths[] = {1, 2, 3, 4, 8, 16, 32, 37};
+  const iree_host_size_t kRowCount = 9;
+  for (iree_host_size_t row_length : kRowLengths) {
+    const iree_host_size_t source_stride = row_length + 5;
+    const iree_host_size_t target_stride = row_length * 2 + 1;
+    std::vector<uint8_t> source = MakeSequence(kRowCount * source_stride);
+    std::vector<uint8_t> target(kRowCount * target_stride, 0xFF);
+    iree_bulk_memory_copy_2d(target.data(), target_stride, source.data(),
+                             source_stride, row_length, kRowCount);
+    for (iree_host_size_t r = 0; r < kRowCount; ++r) {
+      for (iree_host_size_t i = 0; i < target_stride; ++i) {
+        const uint8_t expected =
+            i < row_length ? source[r * source_stride + i] : 0xFF;
+        ASSERT_EQ(expected, target[r * target_stride + i])
+            << "row_length=" << row_length << " r=" << r << " i=" << i;
+      }
+    }
+  }
+}
+
+//==============================================================================
+// iree_bulk_memory_transpose_2d
+//==============================================================================
+
+TEST(BulkMemoryTest, Transpose2D) {
+  // Shapes cover full tiles, ragged tiles, and single rows/columns.
+  const iree_host_size_t kShapes[][2] = {
+      {1, 1}, {1, 13}, {13, 1}, {4, 4}, {8, 8}, {5, 11}, {16, 24}, {33, 17},
+  };
+  for (iree_host_size_t element_length : kElementLengths) {
+    for (const auto& shape : kShapes) {
+      const iree_host_size_t rows = shape[0];
+      const iree_host_size_t columns = shape[1];
+      // Pad each row to check that strides are honored.
+      const iree_host_size_t source_stride = (columns + 1) * element_length;
+      const iree_host_size_t target_stride = (rows + 3) * element_length;
+      std::vector<uint8_t> source = MakeSequence(rows * source_stride);
+      std::vector<uint8_t> target(columns * target_stride, 0xFF);
+      iree_bulk_memory_transpose_2d(target.data(), target_stride,
+                                    source.data(), source_stride, rows,
+                                    columns, element_length);
+      for (iree_host_size_t c = 0; c < columns; ++c) {
+        for (iree_host_size_t r = 0; r < rows; ++r) {
+          ASSERT_EQ(0, memcmp(&target[c * target_stride + r * element_length],
+                              &source[r * source_stride + c * element_length],
+                              element_length))
+              << "element_length=" << element_length << " shape=" << rows
+              << "x" << columns << " r=" << r << " c=" << c;
+        }
+        for (iree_host_size_t i = rows * element_length; i < target_stride;
+             ++i) {
+          ASSERT_EQ(0xFF, target[c * target_stride + i]);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
@@ -74,10 +74,15 @@ static inline void iree_call_once(iree_once_flag* flag, void (*func)(void)) {
 
 #elif IREE_SYNCHRONIZATION_DISABLE_UNSAFE
 
-// No-op when the thread control is disabled.
+// Single-threaded when the thread control is disabled.
 #define IREE_ONCE_FLAG_INIT 1
 #define iree_once_flag uint32_t
-static inline void iree_call_once(iree_once_flag* flag, void (*func)(void)) {}
+static inline void iree_call_once(iree_once_flag* flag, void (*func)(void)) {
+  if (*flag) {
+    *flag = 0;
+    func();
+  }
+}
 
 #else
 
@@ -9,6 +9,9 @@
 
 #include "iree/base/internal/cpu.h"
 
+#include <string.h>
+
+#include "iree/base/internal/call_once.h"
 #include "iree/base/target_platform.h"
 
 //===----------------------------------------------------------------------===//
@@ -59,3 +62,490 @@ void iree_cpu_requery_processor_id(iree_cpu_processor_tag_t* IREE_RESTRICT tag,
 
   *processor_id = iree_cpu_query_processor_id();
 }
+
+//===----------------------------------------------------------------------===//
+// iree_cpu_data_*
+//===----------------------------------------------------------------------===//
+
+#if defined(IREE_ARCH_X86_64)
+
+#if defined(IREE_COMPILER_MSVC)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif  // IREE_COMPILER_MSVC
+
+static void iree_cpu_x86_64_cpuid(uint32_t leaf, uint32_t subleaf,
+                                  uint32_t* out_regs) {
+#if defined(IREE_COMPILER_MSVC)
+  int regs[4];
+  __cpuidex(regs, (int)leaf, (int)subleaf);
+  memcpy(out_regs, regs, sizeof(regs));
+#else
+  __cpuid_count(leaf, subleaf, out_regs[0], out_regs[1], out_regs[2],
+                out_regs[3]);
+#endif  // IREE_COMPILER_MSVC
+}
+
+#if defined(IREE_PLATFORM_LINUX) || defined(IREE_PLATFORM_ANDROID)
+#include <sys/syscall.h>
+#include <unistd.h>
+#if !defined(ARCH_REQ_XCOMP_PERM)
+#define ARCH_REQ_XCOMP_PERM 0x1023
+#endif  // !ARCH_REQ_XCOMP_PERM
+#endif  // IREE_PLATFORM_LINUX || IREE_PLATFORM_ANDROID
+
+// Returns true if the process may use the AMX tile register state.
+// Linux only enables the state for processes that request it and executes
+// the first tile instruction of any other process as an illegal instruction.
+static bool iree_cpu_x86_64_request_tile_state(void) {
+#if defined(IREE_PLATFORM_LINUX) || defined(IREE_PLATFORM_ANDROID)
+  const int xfeature_xtiledata = 18;
+  return syscall(SYS_arch_prctl, ARCH_REQ_XCOMP_PERM, xfeature_xtiledata) == 0;
+#else
+  return true;
+#endif  // IREE_PLATFORM_LINUX || IREE_PLATFORM_ANDROID
+}
+
+// Returns the XCR0 register indicating which register state the OS saves.
+// Must only be called if CPUID reports OSXSAVE.
+static uint64_t iree_cpu_x86_64_xgetbv0(void) {
+#if defined(IREE_COMPILER_MSVC)
+  return _xgetbv(0);
+#else
+  uint32_t eax = 0, edx = 0;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+#endif  // IREE_COMPILER_MSVC
+}
+
+static uint64_t iree_cpu_query_data0_x86_64(void) {
+  uint32_t leaf0[4] = {0};
+  iree_cpu_x86_64_cpuid(0, 0, leaf0);
+  const uint32_t max_leaf = leaf0[0];
+  if (max_leaf < 1) return 0;
+
+  uint32_t leaf1[4] = {0};
+  iree_cpu_x86_64_cpuid(1, 0, leaf1);
+  const uint32_t leaf1_ecx = leaf1[2];
+
+  // The AVX family is only usable if the OS saves the wider register state on
+  // context switches: XMM|YMM for AVX and additionally opmask|ZMM for AVX-512.
+  if (!(leaf1_ecx & (1u << 27))) return 0;  // OSXSAVE
+  const uint64_t xcr0 = iree_cpu_x86_64_xgetbv0();
+  if ((xcr0 & 0x06) != 0x06) return 0;
+  const bool has_zmm_state = (xcr0 & 0xE6) == 0xE6;
+  const bool has_tile_state = (xcr0 & 0x60000) == 0x60000;
+
+  uint64_t data0 = 0;
+  if (leaf1_ecx & (1u << 28)) data0 |= IREE_CPU_DATA0_X86_64_AVX;
+  if (leaf1_ecx & (1u << 12)) data0 |= IREE_CPU_DATA0_X86_64_FMA;
+  if (leaf1_ecx & (1u << 29)) data0 |= IREE_CPU_DATA0_X86_64_F16C;
+  if (max_leaf >= 7) {
+    uint32_t leaf7[4] = {0};
+    iree_cpu_x86_64_cpuid(7, 0, leaf7);
+    const uint32_t leaf7_max_subleaf = leaf7[0];
+    const uint32_t leaf7_ebx = leaf7[1];
+    const uint32_t leaf7_ecx = leaf7[2];
+    const uint32_t leaf7_edx = leaf7[3];
+    uint32_t leaf7_1[4] = {0};
+    if (leaf7_max_subleaf >= 1) iree_cpu_x86_64_cpuid(7, 1, leaf7_1);
+    const uint32_t leaf7_1_eax = leaf7_1[0];
+    if (leaf7_ebx & (1u << 5)) data0 |= IREE_CPU_DATA0_X86_64_AVX2;
+    if (has_zmm_state) {
+      if (leaf7_ebx & (1u << 16)) data0 |= IREE_CPU_DATA0_X86_64_AVX512F;
+      if (leaf7_ebx & (1u << 28)) data0 |= IREE_CPU_DATA0_X86_64_AVX512CD;
+      if (leaf7_ebx & (1u << 31)) data0 |= IREE_CPU_DATA0_X86_64_AVX512VL;
+      if (leaf7_ebx & (1u << 17)) data0 |= IREE_CPU_DATA0_X86_64_AVX512DQ;
+      if (leaf7_ebx & (1u << 30)) data0 |= IREE_CPU_DATA0_X86_64_AVX512BW;
+      if (leaf7_ecx & (1u << 11)) data0 |= IREE_CPU_DATA0_X86_64_AVX512VNNI;
+      if (leaf7_ecx & (1u << 1)) data0 |= IREE_CPU_DATA0_X86_64_AVX512VBMI;
+      if (leaf7_ebx & (1u << 21)) data0 |= IREE_CPU_DATA0_X86_64_AVX512IFMA;
+      if (leaf7_1_eax & (1u << 5)) data0 |= IREE_CPU_DATA0_X86_64_AVX512BF16;
+    }
+    if (has_tile_state && (leaf7_edx & (1u << 24)) &&
+        iree_cpu_x86_64_request_tile_state()) {
+      data0 |= IREE_CPU_DATA0_X86_64_AMXTILE;
+      if (leaf7_edx & (1u << 25)) data0 |= IREE_CPU_DATA0_X86_64_AMXINT8;
+      if (leaf7_edx & (1u << 22)) data0 |= IREE_CPU_DATA0_X86_64_AMXBF16;
+    }
+  }
+  return data0;
+}
+
+// Queries the sizes of the caches visible to the calling processor using the
+// deterministic cache parameters leaf (4 on Intel, 0x8000001D on AMD).
+// Used when the OS does not provide the information.
+static void iree_cpu_query_caches_x86_64(iree_cpu_info_t* info) {
+  uint32_t regs[4] = {0};
+  iree_cpu_x86_64_cpuid(0, 0, regs);
+  const uint32_t max_leaf = regs[0];
+  uint32_t cache_leaf = 0;
+  if (max_leaf >= 4) {
+    iree_cpu_x86_64_cpuid(4, 0, regs);
+    if (regs[0] & 0x1F) cache_leaf = 4;
+  }
+  if (!cache_leaf) {
+    iree_cpu_x86_64_cpuid(0x80000000u, 0, regs);
+    if (regs[0] >= 0x8000001Du) {
+      iree_cpu_x86_64_cpuid(0x80000001u, 0, regs);
+      if (regs[2] & (1u << 22)) cache_leaf = 0x8000001Du;  // TOPOEXT
+    }
+  }
+  for (uint32_t i = 0; cache_leaf && i < 16; ++i) {
+    iree_cpu_x86_64_cpuid(cache_leaf, i, regs);
+    const uint32_t type = regs[0] & 0x1F;  // 1=data, 2=instruction, 3=unified
+    if (type == 0) break;
+    if (type == 2) continue;
+    const uint32_t level = (regs[0] >> 5) & 0x7;
+    if (level < 1 || level > IREE_ARRAYSIZE(info->cache_sizes)) continue;
+    const uint64_t line_size = (regs[1] & 0xFFF) + 1;
+    const uint64_t partitions = ((regs[1] >> 12) & 0x3FF) + 1;
+    const uint64_t ways = ((regs[1] >> 22) & 0x3FF) + 1;
+    const uint64_t sets = (uint64_t)regs[2] + 1;
+    info->cache_sizes[level - 1] = ways * partitions * line_size * sets;
+    if (!info->cache_line_size) info->cache_line_size = (uint32_t)line_size;
+  }
+  if (!info->cache_line_size && max_leaf >= 1) {
+    // CLFLUSH line size in 8-byte units.
+    iree_cpu_x86_64_cpuid(1, 0, regs);
+    info->cache_line_size = ((regs[1] >> 8) & 0xFF) * 8;
+  }
+}
+
+#elif defined(IREE_ARCH_ARM_64) && \
+    (defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX))
+
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+
+static uint64_t iree_cpu_query_data0_arm_64(void) {
+  const unsigned long hwcap = getauxval(AT_HWCAP);
+  const unsigned long hwcap2 = getauxval(AT_HWCAP2);
+  (void)hwcap2;
+  uint64_t data0 = 0;
+#if defined(HWCAP_ASIMDDP)
+  if (hwcap & HWCAP_ASIMDDP) data0 |= IREE_CPU_DATA0_ARM_64_DOTPROD;
+#endif  // HWCAP_ASIMDDP
+#if defined(HWCAP2_I8MM)
+  if (hwcap2 & HWCAP2_I8MM) data0 |= IREE_CPU_DATA0_ARM_64_I8MM;
+#endif  // HWCAP2_I8MM
+#if defined(HWCAP_ASIMDHP)
+  if (hwcap & HWCAP_ASIMDHP) data0 |= IREE_CPU_DATA0_ARM_64_FP16;
+#endif  // HWCAP_ASIMDHP
+#if defined(HWCAP2_BF16)
+  if (hwcap2 & HWCAP2_BF16) data0 |= IREE_CPU_DATA0_ARM_64_BF16;
+#endif  // HWCAP2_BF16
+#if defined(HWCAP_SVE)
+  if (hwcap & HWCAP_SVE) data0 |= IREE_CPU_DATA0_ARM_64_SVE;
+#endif  // HWCAP_SVE
+#if defined(HWCAP2_SVE2)
+  if (hwcap2 & HWCAP2_SVE2) data0 |= IREE_CPU_DATA0_ARM_64_SVE2;
+#endif  // HWCAP2_SVE2
+  return data0;
+}
+
+#endif  // IREE_ARCH_*
+
+void iree_cpu_query_data_fields(iree_host_size_t field_count,
+                                uint64_t* out_fields) {
+  IREE_ASSERT_ARGUMENT(!field_count || out_fields);
+  if (!field_count) return;
+  memset(out_fields, 0, field_count * sizeof(*out_fields));
+  const iree_cpu_info_t* info = iree_cpu_info();
+  memcpy(out_fields, info->data,
+         iree_min(field_count, IREE_ARRAYSIZE(info->data)) *
+             sizeof(*out_fields));
+}
+
+//===----------------------------------------------------------------------===//
+// iree_cpu_info_t
+//===----------------------------------------------------------------------===//
+
+// Counts a logical processor with the given maximum frequency towards the
+// cluster of processors sharing it. Once all clusters are in use the
+// processor is merged into the slowest cluster.
+static void iree_cpu_info_add_processor(iree_cpu_info_t* info,
+                                        uint32_t max_frequency_khz) {
+  ++info->logical_processor_count;
+  for (uint32_t i = 0; i < info->cluster_count; ++i) {
+    if (info->clusters[i].max_frequency_khz == max_frequency_khz) {
+      ++info->clusters[i].processor_count;
+      return;
+    }
+  }
+  if (info->cluster_count < IREE_ARRAYSIZE(info->clusters)) {
+    iree_cpu_cluster_t* cluster = &info->clusters[info->cluster_count++];
+    cluster->processor_count = 1;
+    cluster->max_frequency_khz = max_frequency_khz;
+    return;
+  }
+  iree_cpu_cluster_t* slowest = &info->clusters[0];
+  for (uint32_t i = 1; i < info->cluster_count; ++i) {
+    if (info->clusters[i].max_frequency_khz < slowest->max_frequency_khz) {
+      slowest = &info->clusters[i];
+    }
+  }
+  ++slowest->processor_count;
+  slowest->max_frequency_khz =
+      iree_min(slowest->max_frequency_khz, max_frequency_khz);
+}
+
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX)
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+// Reads the first whitespace-delimited word of the sysfs file at |path|.
+static bool iree_cpu_read_sysfs_string(const char* path, char* buffer,
+                                       iree_host_size_t buffer_capacity) {
+  FILE* file = fopen(path, "r");
+  if (!file) return false;
+  bool found = fgets(buffer, (int)buffer_capacity, file) != NULL;
+  fclose(file);
+  if (!found) return false;
+  buffer[strcspn(buffer, " \t\r\n")] = 0;
+  return true;
+}
+
+// Reads the leading unsigned integer of the sysfs file at |path|, scaling it
+// by an optional K/M/G size suffix (as used by the cache sizes). Trailing
+// list or range syntax such as `0-3` or `0,64` is ignored.
+static bool iree_cpu_read_sysfs_uint64(const char* path, uint64_t* out_value) {
+  *out_value = 0;
+  char buffer[64];
+  if (!iree_cpu_read_sysfs_string(path, buffer, sizeof(buffer))) return false;
+  char* end = NULL;
+  unsigned long long value = strtoull(buffer, &end, 10);
+  if (end == buffer) return false;
+  switch (*end) {
+    case 'K':
+      value <<= 10;
+      break;
+    case 'M':
+      value <<= 20;
+      break;
+    case 'G':
+      value <<= 30;
+      break;
+    default:
+      break;
+  }
+  *out_value = (uint64_t)value;
+  return true;
+}
+
+// Queries the data and unified caches of processor 0.
+static void iree_cpu_query_caches_sysfs(iree_cpu_info_t* info) {
+  char path[96];
+  for (unsigned int index = 0;; ++index) {
+    uint64_t level = 0;
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%u/level", index);
+    if (!iree_cpu_read_sysfs_uint64(path, &level)) break;
+    if (level < 1 || level > IREE_ARRAYSIZE(info->cache_sizes)) continue;
+    char type[16];
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%u/type", index);
+    if (!iree_cpu_read_sysfs_string(path, type, sizeof(type)) ||
+        strcmp(type, "Instruction") == 0) {
+      continue;
+    }
+    uint64_t size = 0;
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%u/size", index);
+    if (iree_cpu_read_sysfs_uint64(path, &size)) {
+      info->cache_sizes[level - 1] = size;
+    }
+    uint64_t line_size = 0;
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu0/cache/index%u/coherency_line_size",
+             index);
+    if (!info->cache_line_size &&
+        iree_cpu_read_sysfs_uint64(path, &line_size)) {
+      info->cache_line_size = (uint32_t)line_size;
+    }
+  }
+}
+
+// Queries the online processors, their SMT siblings, and their maximum
+// frequencies along with the number of NUMA nodes.
+static void iree_cpu_query_topology_sysfs(iree_cpu_info_t* info) {
+  const long processor_limit = sysconf(_SC_NPROCESSORS_CONF);
+  char path[96];
+  for (long i = 0; i < processor_limit; ++i) {
+    // Offline processors have no topology. The first entry of the sibling
+    // list identifies the physical core shared by SMT threads.
+    uint64_t first_sibling = 0;
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%ld/topology/thread_siblings_list",
+             i);
+    if (!iree_cpu_read_sysfs_uint64(path, &first_sibling)) continue;
+    if (first_sibling == (uint64_t)i) ++info->physical_core_count;
+    uint64_t max_frequency_khz = 0;
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%ld/cpufreq/cpuinfo_max_freq", i);
+    iree_cpu_read_sysfs_uint64(path, &max_frequency_khz);
+    iree_cpu_info_add_processor(info, (uint32_t)max_frequency_khz);
+  }
+  if (!info->logical_processor_count) {
+    // sysfs may be unavailable in sandboxes; fall back to the online count.
+    info->physical_core_count = 0;
+    const long online_count = sysconf(_SC_NPROCESSORS_ONLN);
+    for (long i = 0; i < online_count; ++i) {
+      iree_cpu_info_add_processor(info, 0);
+    }
+  }
+
+  DIR* dir = opendir("/sys/devices/system/node");
+  if (dir) {
+    struct dirent* entry = NULL;
+    while ((entry = readdir(dir)) != NULL) {
+      unsigned int node = 0;
+      if (sscanf(entry->d_name, "node%u", &node) == 1) {
+        ++info->numa_node_count;
+      }
+    }
+    closedir(dir);
+  }
+}
+
+static void iree_cpu_query_info_platform(iree_cpu_info_t* info) {
+  iree_cpu_query_caches_sysfs(info);
+  iree_cpu_query_topology_sysfs(info);
+}
+
+#elif defined(IREE_PLATFORM_APPLE)
+
+#include <stdio.h>
+#include <sys/sysctl.h>
+
+// Returns the value of the integer sysctl |name| or 0 if unavailable.
+static uint64_t iree_cpu_sysctl_uint64(const char* name) {
+  uint64_t value = 0;
+  size_t value_size = sizeof(value);
+  if (sysctlbyname(name, &value, &value_size, NULL, 0) != 0) return 0;
+  // Some values are 32-bit; the little-endian low bytes hold the result.
+  return value_size == sizeof(uint32_t) ? (uint32_t)value : value;
+}
+
+static void iree_cpu_query_info_platform(iree_cpu_info_t* info) {
+  info->cache_line_size = (uint32_t)iree_cpu_sysctl_uint64("hw.cachelinesize");
+  info->cache_sizes[0] = iree_cpu_sysctl_uint64("hw.l1dcachesize");
+  info->cache_sizes[1] = iree_cpu_sysctl_uint64("hw.l2cachesize");
+  info->cache_sizes[2] = iree_cpu_sysctl_uint64("hw.l3cachesize");
+  info->physical_core_count =
+      (uint32_t)iree_cpu_sysctl_uint64("hw.physicalcpu");
+  info->numa_node_count = 1;
+
+  // Performance levels are ordered from the highest performing and the
+  // frequency is not exposed. Each level is reported as its own cluster.
+  const uint64_t perflevel_count = iree_cpu_sysctl_uint64("hw.nperflevels");
+  for (uint64_t i = 0; i < perflevel_count; ++i) {
+    char name[64];
+    snprintf(name, sizeof(name), "hw.perflevel%u.logicalcpu", (unsigned int)i);
+    const uint64_t processor_count = iree_cpu_sysctl_uint64(name);
+    if (info->cluster_count < IREE_ARRAYSIZE(info->clusters)) {
+      ++info->cluster_count;
+    }
+    info->clusters[info->cluster_count - 1].processor_count +=
+        (uint32_t)processor_count;
+    info->logical_processor_count += (uint32_t)processor_count;
+  }
+  if (!info->logical_processor_count) {
+    info->logical_processor_count =
+        (uint32_t)iree_cpu_sysctl_uint64("hw.logicalcpu");
+  }
+}
+
+#elif defined(IREE_PLATFORM_WINDOWS)
+
+// TODO: query caches, cores, and efficiency classes with
+// GetLogicalProcessorInformationEx.
+static void iree_cpu_query_info_platform(iree_cpu_info_t* info) {
+  const DWORD processor_count = GetActiveProcessorCount(ALL_PROCESSOR_GROUPS);
+  for (DWORD i = 0; i < processor_count; ++i) {
+    iree_cpu_info_add_processor(info, 0);
+  }
+}
+
+#else
+
+// No implementation.
+static void iree_cpu_query_info_platform(iree_cpu_info_t* info) {}
+
+#endif  // IREE_PLATFORM_*
+
+// Returns |value| clamped to fit in |bit_count| bits.
+static uint64_t iree_cpu_saturate_bits(uint64_t value, uint32_t bit_count) {
+  const uint64_t max_value = (1ull << bit_count) - 1;
+  return value < max_value ? value : max_value;
+}
+
+static void iree_cpu_query_info(iree_cpu_info_t* info) {
+  memset(info, 0, sizeof(*info));
+#if defined(IREE_ARCH_X86_64)
+  info->data[0] = iree_cpu_query_data0_x86_64();
+#elif defined(IREE_ARCH_ARM_64) && \
+    (defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX))
+  info->data[0] = iree_cpu_query_data0_arm_64();
+#endif  // IREE_ARCH_*
+
+  iree_cpu_query_info_platform(info);
+#if defined(IREE_ARCH_X86_64)
+  if (!info->cache_sizes[0] && !info->cache_sizes[1] &&
+      !info->cache_sizes[2]) {
+    iree_cpu_query_caches_x86_64(info);
+  }
+#endif  // IREE_ARCH_X86_64
+
+  if (!info->physical_core_count) {
+    info->physical_core_count = info->logical_processor_count;
+  }
+  if (info->physical_core_count) {
+    info->smt_width =
+        info->logical_processor_count / info->physical_core_count;
+  }
+  if (!info->cluster_count && info->logical_processor_count) {
+    info->cluster_count = 1;
+    info->clusters[0].processor_count = info->logical_processor_count;
+  }
+
+  // Stable insertion sort by descending frequency.
+  for (uint32_t i = 1; i < info->cluster_count; ++i) {
+    iree_cpu_cluster_t cluster = info->clusters[i];
+    uint32_t j = i;
+    for (; j > 0 && info->clusters[j - 1].max_frequency_khz <
+                        cluster.max_frequency_khz;
+         --j) {
+      info->clusters[j] = info->clusters[j - 1];
+    }
+    info->clusters[j] = cluster;
+  }
+
+  // See the IREE_CPU_DATA1_* and IREE_CPU_DATA2_* field layouts.
+  info->data[1] =
+      iree_cpu_saturate_bits(info->cache_sizes[0] / 1024, 16) |
+      (iree_cpu_saturate_bits(info->cache_sizes[1] / 1024, 24) << 16) |
+      (iree_cpu_saturate_bits(info->cache_sizes[2] / 1024, 24) << 40);
+  info->data[2] =
+      iree_cpu_saturate_bits(info->logical_processor_count, 16) |
+      (iree_cpu_saturate_bits(info->physical_core_count, 16) << 16) |
+      (iree_cpu_saturate_bits(info->cluster_count, 8) << 32) |
+      (iree_cpu_saturate_bits(info->numa_node_count, 8) << 40) |
+      (iree_cpu_saturate_bits(info->cache_line_size, 16) << 48);
+}
+
+static iree_cpu_info_t iree_cpu_info_storage;
+static iree_once_flag iree_cpu_info_flag = IREE_ONCE_FLAG_INIT;
+
+static void iree_cpu_initialize_info(void) {
+  iree_cpu_query_info(&iree_cpu_info_storage);
+}
+
+const iree_cpu_info_t* iree_cpu_info(void) {
+  iree_call_once(&iree_cpu_info_flag, iree_cpu_initialize_info);
+  return &iree_cpu_info_storage;
+}
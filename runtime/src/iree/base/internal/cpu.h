@@ -33,8 +33,137 @@ void iree_cpu_requery_processor_id(iree_cpu_processor_tag_t* IREE_RESTRICT tag,
                                    iree_cpu_processor_id_t* IREE_RESTRICT
                                        processor_id);
 
+//===----------------------------------------------------------------------===//
+// iree_cpu_data_*
+//===----------------------------------------------------------------------===//
+
+// Bits in data field 0 as populated by iree_cpu_query_data_fields.
+// The meaning of each bit is architecture-specific.
+//
+// NOTE: these values are baked into compiled executables that select between
+// ISA-specific variants at load time (see LLVMAOTTarget.cpp) and must only
+// ever be appended to.
+
+// x86_64:
+#define IREE_CPU_DATA0_X86_64_AVX (1ull << 0)
+#define IREE_CPU_DATA0_X86_64_AVX2 (1ull << 1)
+#define IREE_CPU_DATA0_X86_64_FMA (1ull << 2)
+#define IREE_CPU_DATA0_X86_64_F16C (1ull << 3)
+#define IREE_CPU_DATA0_X86_64_AVX512F (1ull << 4)
+#define IREE_CPU_DATA0_X86_64_AVX512CD (1ull << 5)
+#define IREE_CPU_DATA0_X86_64_AVX512VL (1ull << 6)
+#define IREE_CPU_DATA0_X86_64_AVX512DQ (1ull << 7)
+#define IREE_CPU_DATA0_X86_64_AVX512BW (1ull << 8)
+#define IREE_CPU_DATA0_X86_64_AVX512VNNI (1ull << 9)
+#define IREE_CPU_DATA0_X86_64_AVX512VBMI (1ull << 10)
+#define IREE_CPU_DATA0_X86_64_AVX512IFMA (1ull << 11)
+#define IREE_CPU_DATA0_X86_64_AVX512BF16 (1ull << 12)
+#define IREE_CPU_DATA0_X86_64_AMXTILE (1ull << 13)
+#define IREE_CPU_DATA0_X86_64_AMXINT8 (1ull << 14)
+#define IREE_CPU_DATA0_X86_64_AMXBF16 (1ull << 15)
+
+// aarch64:
+#define IREE_CPU_DATA0_ARM_64_DOTPROD (1ull << 0)
+#define IREE_CPU_DATA0_ARM_64_I8MM (1ull << 1)
+#define IREE_CPU_DATA0_ARM_64_FP16 (1ull << 2)
+#define IREE_CPU_DATA0_ARM_64_BF16 (1ull << 3)
+#define IREE_CPU_DATA0_ARM_64_SVE (1ull << 4)
+#define IREE_CPU_DATA0_ARM_64_SVE2 (1ull << 5)
+
+// Data field 1 describes the cache hierarchy on all architectures:
+//   [0:16)  L1 data cache size in KiB
+//   [16:40) L2 cache size in KiB
+//   [40:64) L3 cache size in KiB
+// Sizes are those of the cache instances visible to a single processor (not
+// the sum across the system) and 0 when unknown.
+#define IREE_CPU_DATA1_L1_CACHE_KB(data1) ((uint32_t)((data1)&0xFFFFull))
+#define IREE_CPU_DATA1_L2_CACHE_KB(data1) \
+  ((uint32_t)(((data1) >> 16) & 0xFFFFFFull))
+#define IREE_CPU_DATA1_L3_CACHE_KB(data1) \
+  ((uint32_t)(((data1) >> 40) & 0xFFFFFFull))
+
+// Data field 2 describes the processor topology on all architectures:
+//   [0:16)  logical processor count
+//   [16:32) physical core count
+//   [32:40) core cluster count
+//   [40:48) NUMA node count
+//   [48:64) cache line size in bytes
+// Values are 0 when unknown and saturate when they do not fit.
+#define IREE_CPU_DATA2_LOGICAL_PROCESSOR_COUNT(data2) \
+  ((uint32_t)((data2)&0xFFFFull))
+#define IREE_CPU_DATA2_PHYSICAL_CORE_COUNT(data2) \
+  ((uint32_t)(((data2) >> 16) & 0xFFFFull))
+#define IREE_CPU_DATA2_CLUSTER_COUNT(data2) \
+  ((uint32_t)(((data2) >> 32) & 0xFFull))
+#define IREE_CPU_DATA2_NUMA_NODE_COUNT(data2) \
+  ((uint32_t)(((data2) >> 40) & 0xFFull))
+#define IREE_CPU_DATA2_CACHE_LINE_SIZE(data2) \
+  ((uint32_t)(((data2) >> 48) & 0xFFFFull))
+
+// Total number of data fields defined across all architectures.
+#define IREE_CPU_DATA_FIELD_COUNT 3
+
+// Queries the features of the processor executing this code and stores them
+// in |out_fields|. Fields beyond those defined for the architecture are zeroed.
+// Features that cannot be queried on the current platform (or that the OS has
+// not enabled, such as AVX state saving) are reported as unavailable.
+//
+// The fields are derived from iree_cpu_info and are only queried from the
+// system once per process.
+void iree_cpu_query_data_fields(iree_host_size_t field_count,
+                                uint64_t* out_fields);
+
+//===----------------------------------------------------------------------===//
+// iree_cpu_info_t
+//===----------------------------------------------------------------------===//
+
+// Maximum number of core clusters tracked in iree_cpu_info_t.
+#define IREE_CPU_MAX_CLUSTER_COUNT 8
+
+// A set of logical processors sharing the same maximum frequency, such as the
+// big or LITTLE cores of a heterogeneous system.
+typedef struct iree_cpu_cluster_t {
+  // Number of logical processors in the cluster.
+  uint32_t processor_count;
+  // Maximum frequency of the processors in kHz or 0 if unknown.
+  uint32_t max_frequency_khz;
+} iree_cpu_cluster_t;
+
+// Description of the host CPU. Values that cannot be determined on the current
+// platform are 0.
+typedef struct iree_cpu_info_t {
+  // Data fields as returned by iree_cpu_query_data_fields.
+  uint64_t data[IREE_CPU_DATA_FIELD_COUNT];
+
+  // Size in bytes of a cache line.
+  uint32_t cache_line_size;
+  // Sizes in bytes of the L1 data, L2 and L3 caches visible to a single
+  // processor.
+  uint64_t cache_sizes[3];
+
+  // Number of logical processors (hardware threads) in the system.
+  uint32_t logical_processor_count;
+  // Number of physical cores in the system.
+  uint32_t physical_core_count;
+  // Number of logical processors per physical core; 2 or more with SMT.
+  uint32_t smt_width;
+  // Number of NUMA nodes in the system.
+  uint32_t numa_node_count;
+
+  // Clusters of processors sorted by descending maximum frequency. Systems
+  // with more distinct frequencies than IREE_CPU_MAX_CLUSTER_COUNT have the
+  // slowest ones merged into the last cluster.
+  uint32_t cluster_count;
+  iree_cpu_cluster_t clusters[IREE_CPU_MAX_CLUSTER_COUNT];
+} iree_cpu_info_t;
+
+// Returns the description of the host CPU.
+// The system is queried on the first call and the result is cached for the
+// lifetime of the process. Thread-safe.
+const iree_cpu_info_t* iree_cpu_info(void);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
 
-#endif  // IREE_BASE_INTERNAL_ARENA_H_
+#endif  // IREE_BASE_INTERNAL_CPU_H_
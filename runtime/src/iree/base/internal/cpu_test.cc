@@ -0,0 +1,71 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/cpu.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "iree/testing/gtest.h"
+
+namespace {
+
+TEST(CpuInfoTest, IsCached) { EXPECT_EQ(iree_cpu_info(), iree_cpu_info()); }
+
+TEST(CpuInfoTest, DataFieldsMatchInfo) {
+  const iree_cpu_info_t* info = iree_cpu_info();
+  uint64_t fields[IREE_CPU_DATA_FIELD_COUNT + 2];
+  memset(fields, 0xCD, sizeof(fields));
+  iree_cpu_query_data_fields(IREE_ARRAYSIZE(fields), fields);
+  for (int i = 0; i < IREE_CPU_DATA_FIELD_COUNT; ++i) {
+    EXPECT_EQ(fields[i], info->data[i]);
+  }
+  EXPECT_EQ(fields[IREE_CPU_DATA_FIELD_COUNT], 0u);
+  EXPECT_EQ(fields[IREE_CPU_DATA_FIELD_COUNT + 1], 0u);
+
+  // Fewer fields than defined are truncated.
+  uint64_t data0 = 0;
+  iree_cpu_query_data_fields(1, &data0);
+  EXPECT_EQ(data0, info->data[0]);
+}
+
+TEST(CpuInfoTest, DataFieldsEncodeInfo) {
+  const iree_cpu_info_t* info = iree_cpu_info();
+  EXPECT_EQ(IREE_CPU_DATA1_L1_CACHE_KB(info->data[1]),
+            std::min<uint64_t>(info->cache_sizes[0] / 1024, 0xFFFF));
+  EXPECT_EQ(IREE_CPU_DATA1_L2_CACHE_KB(info->data[1]),
+            std::min<uint64_t>(info->cache_sizes[1] / 1024, 0xFFFFFF));
+  EXPECT_EQ(IREE_CPU_DATA1_L3_CACHE_KB(info->data[1]),
+            std::min<uint64_t>(info->cache_sizes[2] / 1024, 0xFFFFFF));
+  EXPECT_EQ(IREE_CPU_DATA2_LOGICAL_PROCESSOR_COUNT(info->data[2]),
+            std::min<uint32_t>(info->logical_processor_count, 0xFFFF));
+  EXPECT_EQ(IREE_CPU_DATA2_PHYSICAL_CORE_COUNT(info->data[2]),
+            std::min<uint32_t>(info->physical_core_count, 0xFFFF));
+  EXPECT_EQ(IREE_CPU_DATA2_CLUSTER_COUNT(info->data[2]), info->cluster_count);
+  EXPECT_EQ(IREE_CPU_DATA2_NUMA_NODE_COUNT(info->data[2]),
+            std::min<uint32_t>(info->numa_node_count, 0xFF));
+  EXPECT_EQ(IREE_CPU_DATA2_CACHE_LINE_SIZE(info->data[2]),
+            std::min<uint32_t>(info->cache_line_size, 0xFFFF));
+}
+
+TEST(CpuInfoTest, TopologyIsConsistent) {
+  const iree_cpu_info_t* info = iree_cpu_info();
+  EXPECT_LE(info->physical_core_count, info->logical_processor_count);
+  EXPECT_LE(info->smt_width * info->physical_core_count,
+            info->logical_processor_count);
+  ASSERT_LE(info->cluster_count, IREE_CPU_MAX_CLUSTER_COUNT);
+  uint32_t clustered_processor_count = 0;
+  for (uint32_t i = 0; i < info->cluster_count; ++i) {
+    clustered_processor_count += info->clusters[i].processor_count;
+    if (i > 0) {
+      EXPECT_GE(info->clusters[i - 1].max_frequency_khz,
+                info->clusters[i].max_frequency_khz);
+    }
+  }
+  EXPECT_EQ(clustered_processor_count, info->logical_processor_count);
+}
+
+}  // namespace
@@ -47,6 +47,11 @@ iree_status_t iree_dynamic_library_load_from_files(
 // Opens a dynamic library from a range of bytes in memory.
 // |identifier| will be used as the module name in debugging/profiling tools.
 // |buffer| must remain live for the lifetime of the library.
+//
+// On POSIX platforms the library is loaded from an anonymous memory file where
+// supported. If the IREE_DYLIB_CACHE_DIR environment variable names a
+// directory then libraries are instead stored there under a name derived from
+// their contents and reused by subsequent loads in this and other processes.
 iree_status_t iree_dynamic_library_load_from_memory(
     iree_string_view_t identifier, iree_const_byte_span_t buffer,
     iree_dynamic_library_flags_t flags, iree_allocator_t allocator,
@@ -4,6 +4,7 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <inttypes.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -20,16 +21,42 @@
 
 #include <dlfcn.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+// Loads libraries from memory with memfd_create + dlopen of the fd path to
+// avoid touching the filesystem. Libraries fall back to temp files if the
+// kernel or loader does not support it.
+#if !defined(IREE_DYNAMIC_LIBRARY_USE_MEMFD)
+#if defined(IREE_PLATFORM_LINUX) && !defined(IREE_PLATFORM_ANDROID)
+#define IREE_DYNAMIC_LIBRARY_USE_MEMFD 1
+#else
+#define IREE_DYNAMIC_LIBRARY_USE_MEMFD 0
+#endif  // IREE_PLATFORM_LINUX && !IREE_PLATFORM_ANDROID
+#endif  // !IREE_DYNAMIC_LIBRARY_USE_MEMFD
+
+#if IREE_DYNAMIC_LIBRARY_USE_MEMFD
+#include <sys/syscall.h>
+#if !defined(SYS_memfd_create)
+#undef IREE_DYNAMIC_LIBRARY_USE_MEMFD
+#define IREE_DYNAMIC_LIBRARY_USE_MEMFD 0
+#endif  // !SYS_memfd_create
+#endif  // IREE_DYNAMIC_LIBRARY_USE_MEMFD
+
 struct iree_dynamic_library_t {
   iree_atomic_ref_count_t ref_count;
   iree_allocator_t allocator;
 
   // dlopen shared object handle.
   void* handle;
+
+  // Anonymous file the library was loaded from or -1 if loaded from a path.
+  // The loader identifies libraries by path and /proc/self/fd/ paths are only
+  // unique while the fd remains open so it is kept until the library closes.
+  int memfd;
 };
 
 // Allocate a new string from |allocator| returned in |out_file_path| containing
@@ -115,6 +142,25 @@ static iree_status_t iree_dynamic_library_write_temp_file(
   return status;
 }
 
+// Writes all of |source_data| to |fd| handling partial writes.
+static iree_status_t iree_dynamic_library_write_fd(
+    int fd, iree_const_byte_span_t source_data) {
+  const uint8_t* ptr = source_data.data;
+  iree_host_size_t remaining = source_data.data_length;
+  while (remaining > 0) {
+    ssize_t written = write(fd, ptr, remaining);
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      return iree_make_status(iree_status_code_from_errno(errno),
+                              "unable to write library span of %zu bytes",
+                              source_data.data_length);
+    }
+    ptr += written;
+    remaining -= (iree_host_size_t)written;
+  }
+  return iree_ok_status();
+}
+
 // Allocates an iree_dynamic_library_t with the given allocator.
 static iree_status_t iree_dynamic_library_create(
     void* handle, iree_allocator_t allocator,
@@ -128,6 +174,7 @@ static iree_status_t iree_dynamic_library_create(
   iree_atomic_ref_count_init(&library->ref_count);
   library->allocator = allocator;
   library->handle = handle;
+  library->memfd = -1;
 
   *out_library = library;
   return iree_ok_status();
@@ -179,6 +226,7 @@ static iree_once_flag iree_dynamic_library_temp_dir_init_once_flag_ =
 static const char* iree_dynamic_library_temp_dir_path_;
 static bool iree_dynamic_library_temp_dir_valid_;
 static bool iree_dynamic_library_temp_dir_preserve_;
+static const char* iree_dynamic_library_cache_dir_path_;
 
 static bool iree_dynamic_library_path_is_null_or_empty(const char* path) {
   return path == NULL || path[0] == 0;
@@ -219,12 +267,162 @@ static void iree_dynamic_library_init_temp_dir(void) {
   struct stat s;
   iree_dynamic_library_temp_dir_valid_ =
       stat(path, &s) == 0 && (s.st_mode & S_IFMT) == S_IFDIR;
+
+  // If IREE_DYLIB_CACHE_DIR is set to a directory then libraries are stored in
+  // it under a name derived from their contents and reused across loads and
+  // processes. Invalid paths are ignored as the cache is only an optimization.
+  const char* cache_path = getenv("IREE_DYLIB_CACHE_DIR");
+  if (!iree_dynamic_library_path_is_null_or_empty(cache_path) &&
+      stat(cache_path, &s) == 0 && (s.st_mode & S_IFMT) == S_IFDIR) {
+    iree_dynamic_library_cache_dir_path_ = cache_path;
+  }
 }
 
-// TODO(#3845): use dlopen on an fd with either dlopen(/proc/self/fd/NN),
-// fdlopen, or android_dlopen_ext to avoid needing to write the file to disk.
-// Can fallback to memfd_create + dlopen where available, and fallback from
-// that to disk (maybe just windows/mac).
+// Returns the 64-bit FNV-1a hash of |data|.
+static uint64_t iree_dynamic_library_hash(iree_const_byte_span_t data) {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  for (iree_host_size_t i = 0; i < data.data_length; ++i) {
+    hash = (hash ^ data.data[i]) * 0x00000100000001B3ull;
+  }
+  return hash;
+}
+
+// Returns true if the file at |file_path| exists and has exactly the contents
+// of |buffer|. The comparison is done against a mapping of the file so that it
+// is served from the page cache when the entry was recently used.
+static bool iree_dynamic_library_cache_entry_matches(
+    const char* file_path, iree_const_byte_span_t buffer) {
+  int fd = open(file_path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return false;
+  bool matches = false;
+  struct stat s;
+  if (fstat(fd, &s) == 0 && (iree_host_size_t)s.st_size == buffer.data_length) {
+    void* contents = mmap(NULL, buffer.data_length, PROT_READ, MAP_PRIVATE, fd,
+                          /*offset=*/0);
+    if (contents != MAP_FAILED) {
+      matches = memcmp(contents, buffer.data, buffer.data_length) == 0;
+      munmap(contents, buffer.data_length);
+    }
+  }
+  close(fd);
+  return matches;
+}
+
+// Stores |buffer| in the content-addressed cache directory and returns the
+// path of the entry in |out_file_path|. Existing entries with matching
+// contents are reused as-is. New entries are written to a unique file and
+// renamed into place so that concurrent loaders never observe partial files.
+static iree_status_t iree_dynamic_library_cache_store(
+    iree_const_byte_span_t buffer, iree_allocator_t allocator,
+    char** out_file_path) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  *out_file_path = NULL;
+
+  const char* format = "%s/iree_dylib_%016" PRIx64 "_%zu.so";
+  const uint64_t hash = iree_dynamic_library_hash(buffer);
+  int length = snprintf(NULL, 0, format, iree_dynamic_library_cache_dir_path_,
+                        hash, buffer.data_length);
+  if (length < 0) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "unable to form cache path string");
+  }
+  // The entry path is followed by a mkstemp template for the staging file.
+  const char* staging_suffix = ".XXXXXX";
+  const iree_host_size_t staging_length = length + strlen(staging_suffix);
+  char* file_path = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(allocator, 2 * (staging_length + /*NUL=*/1),
+                                (void**)&file_path));
+  char* staging_path = file_path + staging_length + /*NUL=*/1;
+  snprintf(file_path, length + /*NUL=*/1, format,
+           iree_dynamic_library_cache_dir_path_, hash, buffer.data_length);
+  snprintf(staging_path, staging_length + /*NUL=*/1, "%s%s", file_path,
+           staging_suffix);
+
+  if (iree_dynamic_library_cache_entry_matches(file_path, buffer)) {
+    IREE_TRACE_ZONE_APPEND_TEXT(z0, "hit");
+    *out_file_path = file_path;
+    IREE_TRACE_ZONE_END(z0);
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_APPEND_TEXT(z0, "miss");
+
+  iree_status_t status = iree_ok_status();
+  int fd = mkstemp(staging_path);
+  if (fd < 0) {
+    status = iree_make_status(iree_status_code_from_errno(errno),
+                              "unable to create cache file '%s'", staging_path);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_dynamic_library_write_fd(fd, buffer);
+    close(fd);
+    // Entries must be readable by other processes sharing the cache.
+    if (iree_status_is_ok(status)) chmod(staging_path, 0644);
+    if (iree_status_is_ok(status) && rename(staging_path, file_path) != 0) {
+      status = iree_make_status(iree_status_code_from_errno(errno),
+                                "unable to rename cache file to '%s'",
+                                file_path);
+    }
+    if (!iree_status_is_ok(status)) remove(staging_path);
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_file_path = file_path;
+  } else {
+    iree_allocator_free(allocator, file_path);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+#if IREE_DYNAMIC_LIBRARY_USE_MEMFD
+
+// Loads |buffer| from an anonymous memory file. The fd is owned by the
+// returned library and closed when it is unloaded.
+static iree_status_t iree_dynamic_library_load_from_memfd(
+    iree_string_view_t identifier, iree_const_byte_span_t buffer,
+    iree_dynamic_library_flags_t flags, iree_allocator_t allocator,
+    iree_dynamic_library_t** out_library) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // The name is only used for debugging (it shows in /proc/self/maps).
+  char name[64];
+  snprintf(name, sizeof(name), "iree_dylib_%.*s", (int)identifier.size,
+           identifier.data);
+  int fd = (int)syscall(SYS_memfd_create, name, /*MFD_CLOEXEC=*/1u);
+  if (fd < 0) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "memfd_create failed");
+  }
+
+  iree_status_t status = iree_dynamic_library_write_fd(fd, buffer);
+  if (iree_status_is_ok(status)) {
+    char fd_path[64];
+    snprintf(fd_path, sizeof(fd_path), "/proc/self/fd/%d", fd);
+    status = iree_dynamic_library_load_from_file(fd_path, flags, allocator,
+                                                 out_library);
+  }
+  if (iree_status_is_ok(status)) {
+    (*out_library)->memfd = fd;
+  } else {
+    close(fd);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+#endif  // IREE_DYNAMIC_LIBRARY_USE_MEMFD
+
+// Libraries are loaded from (in order of preference):
+// - a temp file when the user requested they be preserved for tooling;
+// - the content-addressed cache directory when IREE_DYLIB_CACHE_DIR is set;
+// - an anonymous memfd where supported;
+// - a temp file that is removed once loaded.
+//
+// TODO(#3845): use fdlopen or android_dlopen_ext where available.
 iree_status_t iree_dynamic_library_load_from_memory(
     iree_string_view_t identifier, iree_const_byte_span_t buffer,
     iree_dynamic_library_flags_t flags, iree_allocator_t allocator,
@@ -236,6 +434,37 @@ iree_status_t iree_dynamic_library_load_from_memory(
   iree_call_once(&iree_dynamic_library_temp_dir_init_once_flag_,
                  iree_dynamic_library_init_temp_dir);
 
+  if (!iree_dynamic_library_temp_dir_preserve_ &&
+      iree_dynamic_library_cache_dir_path_) {
+    char* cache_path = NULL;
+    iree_status_t status =
+        iree_dynamic_library_cache_store(buffer, allocator, &cache_path);
+    if (iree_status_is_ok(status)) {
+      status = iree_dynamic_library_load_from_file(cache_path, flags,
+                                                   allocator, out_library);
+      iree_allocator_free(allocator, cache_path);
+    }
+    if (iree_status_is_ok(status)) {
+      IREE_TRACE_ZONE_END(z0);
+      return status;
+    }
+    // Fall through to the uncached paths if the cache is unusable.
+    iree_status_ignore(status);
+  }
+
+#if IREE_DYNAMIC_LIBRARY_USE_MEMFD
+  if (!iree_dynamic_library_temp_dir_preserve_) {
+    iree_status_t status = iree_dynamic_library_load_from_memfd(
+        identifier, buffer, flags, allocator, out_library);
+    if (iree_status_is_ok(status)) {
+      IREE_TRACE_ZONE_END(z0);
+      return status;
+    }
+    // Fall back to temp files (noexec /proc, seccomp policies, etc).
+    iree_status_ignore(status);
+  }
+#endif  // IREE_DYNAMIC_LIBRARY_USE_MEMFD
+
   if (!iree_dynamic_library_temp_dir_valid_) {
     return iree_make_status(
         IREE_STATUS_INVALID_ARGUMENT,
@@ -283,6 +512,9 @@ static void iree_dynamic_library_delete(iree_dynamic_library_t* library) {
   if (library->handle != NULL) {
     dlclose(library->handle);
   }
+  if (library->memfd >= 0) {
+    close(library->memfd);
+  }
 #endif  // IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
 
   iree_allocator_free(allocator, library);
@@ -10,27 +10,93 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "iree/base/internal/atomics.h"
 #include "iree/base/internal/synchronization.h"
 #include "iree/base/tracing.h"
 
+#if IREE_EVENT_POOL_MAGAZINE_COUNT < 1
+#error "IREE_EVENT_POOL_MAGAZINE_COUNT must be at least 1"
+#endif  // IREE_EVENT_POOL_MAGAZINE_COUNT < 1
+#if IREE_EVENT_POOL_MAGAZINE_CAPACITY < 1
+#error "IREE_EVENT_POOL_MAGAZINE_CAPACITY must be at least 1"
+#endif  // IREE_EVENT_POOL_MAGAZINE_CAPACITY < 1
+
+// A small per-thread cache of reset events in front of the shared pool list.
+typedef struct iree_event_pool_magazine_state_t {
+  // Guards the magazine; only contended when threads share a magazine.
+  iree_slim_mutex_t mutex;
+  // Number of events in the events list.
+  iree_host_size_t event_count;
+  // Dense left-aligned list of event_count events.
+  iree_event_t events[IREE_EVENT_POOL_MAGAZINE_CAPACITY];
+} iree_event_pool_magazine_state_t;
+typedef union iree_event_pool_magazine_t {
+  iree_event_pool_magazine_state_t state;
+  // Pads each magazine to a cache line multiple so that threads using adjacent
+  // magazines don't contend on the same line.
+  uint8_t reserved[(sizeof(iree_event_pool_magazine_state_t) + 63) & ~63];
+} iree_event_pool_magazine_t;
+
 struct iree_event_pool_t {
+  // Per-thread caches of events checked before the shared available_list.
+  iree_event_pool_magazine_t magazines[IREE_EVENT_POOL_MAGAZINE_COUNT];
   // Allocator used to create the event pool.
   iree_allocator_t host_allocator;
-  // Guards the pool. Since this pool is used to get operating system-level
-  // event objects that will be signaled and waited on using syscalls it's got
-  // relatively low contention: callers are rate limited by how fast they can
-  // signal and wait on the events they get.
+  // Guards the shared available_list. Most acquires and releases are handled
+  // by the magazines and only spill to the shared list when the magazine of
+  // the calling thread is empty or full.
   iree_slim_mutex_t mutex;
-  // Maximum number of events that will be maintained in the pool. More events
-  // may be allocated at any time but when they are no longer needed they will
-  // be disposed directly.
+  // Capacity of the available_list storage. Grows as more events are released
+  // to the pool than it can hold.
   iree_host_size_t available_capacity;
-  // Total number of available
+  // Total number of available events in the shared list.
   iree_host_size_t available_count;
   // Dense left-aligned list of available_count events.
-  iree_event_t available_list[];
+  iree_event_t* available_list;
 };
 
+// Thread slot assigned on first use of any pool; 0 if unassigned.
+// Slots are shared by all pools so that a thread always maps to the same
+// magazine index.
+static iree_atomic_int32_t iree_event_pool_next_thread_slot =
+    IREE_ATOMIC_VAR_INIT(0);
+static IREE_THREAD_LOCAL int32_t iree_event_pool_thread_slot = 0;
+
+// Returns the magazine in |event_pool| assigned to the calling thread.
+static iree_event_pool_magazine_state_t* iree_event_pool_current_magazine(
+    iree_event_pool_t* event_pool) {
+  int32_t slot = iree_event_pool_thread_slot;
+  if (IREE_UNLIKELY(slot == 0)) {
+    slot = iree_atomic_fetch_add_int32(&iree_event_pool_next_thread_slot, 1,
+                                       iree_memory_order_relaxed) +
+           1;
+    iree_event_pool_thread_slot = slot;
+  }
+  return &event_pool
+              ->magazines[(uint32_t)(slot - 1) % IREE_EVENT_POOL_MAGAZINE_COUNT]
+              .state;
+}
+
+// Grows the shared available_list storage to hold at least |minimum_capacity|
+// events. Must be called with the pool mutex held.
+static iree_status_t iree_event_pool_reserve_locked(
+    iree_event_pool_t* event_pool, iree_host_size_t minimum_capacity) {
+  if (minimum_capacity <= event_pool->available_capacity) {
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_host_size_t new_capacity =
+      iree_max(minimum_capacity, event_pool->available_capacity * 2);
+  iree_status_t status = iree_allocator_realloc(
+      event_pool->host_allocator, new_capacity * sizeof(iree_event_t),
+      (void**)&event_pool->available_list);
+  if (iree_status_is_ok(status)) {
+    event_pool->available_capacity = new_capacity;
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 iree_status_t iree_event_pool_allocate(iree_host_size_t available_capacity,
                                        iree_allocator_t host_allocator,
                                        iree_event_pool_t** out_event_pool) {
@@ -39,22 +105,27 @@ iree_status_t iree_event_pool_allocate(iree_host_size_t available_capacity,
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_event_pool_t* event_pool = NULL;
-  iree_host_size_t total_size =
-      sizeof(*event_pool) +
-      available_capacity * sizeof(event_pool->available_list[0]);
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0,
-      iree_allocator_malloc(host_allocator, total_size, (void**)&event_pool));
+      z0, iree_allocator_malloc(host_allocator, sizeof(*event_pool),
+                                (void**)&event_pool));
   event_pool->host_allocator = host_allocator;
-  event_pool->available_capacity = available_capacity;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(event_pool->magazines);
+       ++i) {
+    iree_slim_mutex_initialize(&event_pool->magazines[i].state.mutex);
+  }
+  iree_slim_mutex_initialize(&event_pool->mutex);
+  event_pool->available_capacity = 0;
   event_pool->available_count = 0;
+  event_pool->available_list = NULL;
 
-  iree_status_t status = iree_ok_status();
-  for (iree_host_size_t i = 0; i < available_capacity; ++i) {
+  iree_status_t status =
+      iree_event_pool_reserve_locked(event_pool, available_capacity);
+  for (iree_host_size_t i = 0;
+       i < available_capacity && iree_status_is_ok(status); ++i) {
     status = iree_event_initialize(
         /*initial_state=*/false,
-        &event_pool->available_list[event_pool->available_count++]);
-    if (!iree_status_is_ok(status)) break;
+        &event_pool->available_list[event_pool->available_count]);
+    if (iree_status_is_ok(status)) ++event_pool->available_count;
   }
 
   if (iree_status_is_ok(status)) {
@@ -70,9 +141,19 @@ void iree_event_pool_free(iree_event_pool_t* event_pool) {
   iree_allocator_t host_allocator = event_pool->host_allocator;
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(event_pool->magazines);
+       ++i) {
+    iree_event_pool_magazine_state_t* magazine =
+        &event_pool->magazines[i].state;
+    for (iree_host_size_t j = 0; j < magazine->event_count; ++j) {
+      iree_event_deinitialize(&magazine->events[j]);
+    }
+    iree_slim_mutex_deinitialize(&magazine->mutex);
+  }
   for (iree_host_size_t i = 0; i < event_pool->available_count; ++i) {
     iree_event_deinitialize(&event_pool->available_list[i]);
   }
+  iree_allocator_free(host_allocator, event_pool->available_list);
   iree_slim_mutex_deinitialize(&event_pool->mutex);
   iree_allocator_free(host_allocator, event_pool);
 
@@ -86,34 +167,51 @@ iree_status_t iree_event_pool_acquire(iree_event_pool_t* event_pool,
   if (!event_count) return iree_ok_status();
   IREE_ASSERT_ARGUMENT(out_events);
 
-  // We'll try to get what we can from the pool and fall back to initializing
-  // new events.
-  iree_host_size_t remaining_count = event_count;
+  // We'll try to get what we can from the magazine of the calling thread, then
+  // the shared pool, and fall back to initializing new events.
+  iree_host_size_t acquired_count = 0;
 
-  // Try first to grab from the pool.
+  // Try first to grab from the magazine.
+  iree_event_pool_magazine_state_t* magazine =
+      iree_event_pool_current_magazine(event_pool);
+  iree_slim_mutex_lock(&magazine->mutex);
+  iree_host_size_t from_magazine_count =
+      iree_min(magazine->event_count, event_count);
+  if (from_magazine_count > 0) {
+    iree_host_size_t magazine_base_index =
+        magazine->event_count - from_magazine_count;
+    memcpy(out_events, &magazine->events[magazine_base_index],
+           from_magazine_count * sizeof(iree_event_t));
+    magazine->event_count -= from_magazine_count;
+    acquired_count += from_magazine_count;
+  }
+  iree_slim_mutex_unlock(&magazine->mutex);
+  if (acquired_count == event_count) return iree_ok_status();
+
+  // Try next to grab from the shared pool.
   iree_slim_mutex_lock(&event_pool->mutex);
   iree_host_size_t from_pool_count =
-      iree_min(event_pool->available_count, event_count);
+      iree_min(event_pool->available_count, event_count - acquired_count);
   if (from_pool_count > 0) {
     iree_host_size_t pool_base_index =
         event_pool->available_count - from_pool_count;
-    memcpy(out_events, &event_pool->available_list[pool_base_index],
+    memcpy(&out_events[acquired_count],
+           &event_pool->available_list[pool_base_index],
            from_pool_count * sizeof(iree_event_t));
     event_pool->available_count -= from_pool_count;
-    remaining_count -= from_pool_count;
+    acquired_count += from_pool_count;
   }
   iree_slim_mutex_unlock(&event_pool->mutex);
 
   // Allocate the rest of the events.
-  if (remaining_count > 0) {
+  if (acquired_count < event_count) {
     IREE_TRACE_ZONE_BEGIN(z0);
-    iree_status_t status = iree_ok_status();
-    for (iree_host_size_t i = 0; i < remaining_count; ++i) {
-      status = iree_event_initialize(/*initial_state=*/false,
-                                     &out_events[from_pool_count + i]);
+    for (; acquired_count < event_count; ++acquired_count) {
+      iree_status_t status = iree_event_initialize(
+          /*initial_state=*/false, &out_events[acquired_count]);
       if (!iree_status_is_ok(status)) {
         // Must release all events we've acquired so far.
-        iree_event_pool_release(event_pool, from_pool_count + i, out_events);
+        iree_event_pool_release(event_pool, acquired_count, out_events);
         IREE_TRACE_ZONE_END(z0);
         return status;
       }
@@ -131,35 +229,48 @@ void iree_event_pool_release(iree_event_pool_t* event_pool,
   if (!event_count) return;
   IREE_ASSERT_ARGUMENT(events);
 
-  // We'll try to release all we can back to the pool and then deinitialize
-  // the ones that won't fit.
-  iree_host_size_t remaining_count = event_count;
+  // Reset the events so that they are ready to be acquired again.
+  for (iree_host_size_t i = 0; i < event_count; ++i) {
+    iree_event_reset(&events[i]);
+  }
 
-  // Try first to release to the pool.
-  // Note that we reset the events we add back to the pool so that they are
-  // ready to be acquired again.
-  iree_slim_mutex_lock(&event_pool->mutex);
-  iree_host_size_t to_pool_count =
-      iree_min(event_pool->available_capacity - event_pool->available_count,
+  // Fill the magazine of the calling thread up to its capacity and spill the
+  // remaining events (if any) to the shared pool.
+  iree_host_size_t released_count = 0;
+  iree_event_pool_magazine_state_t* magazine =
+      iree_event_pool_current_magazine(event_pool);
+  iree_slim_mutex_lock(&magazine->mutex);
+  iree_host_size_t to_magazine_count =
+      iree_min(IREE_EVENT_POOL_MAGAZINE_CAPACITY - magazine->event_count,
                event_count);
-  if (to_pool_count > 0) {
-    iree_host_size_t pool_base_index = event_pool->available_count;
-    for (iree_host_size_t i = 0; i < to_pool_count; ++i) {
-      iree_event_reset(&events[i]);
-    }
-    memcpy(&event_pool->available_list[pool_base_index], events,
-           to_pool_count * sizeof(iree_event_t));
-    event_pool->available_count += to_pool_count;
-    remaining_count -= to_pool_count;
+  if (to_magazine_count > 0) {
+    memcpy(&magazine->events[magazine->event_count], events,
+           to_magazine_count * sizeof(iree_event_t));
+    magazine->event_count += to_magazine_count;
+    released_count += to_magazine_count;
+  }
+  iree_slim_mutex_unlock(&magazine->mutex);
+  if (released_count == event_count) return;
+
+  // Release the rest to the shared pool, growing it if needed.
+  iree_host_size_t remaining_count = event_count - released_count;
+  iree_slim_mutex_lock(&event_pool->mutex);
+  iree_status_t status = iree_event_pool_reserve_locked(
+      event_pool, event_pool->available_count + remaining_count);
+  if (iree_status_is_ok(status)) {
+    memcpy(&event_pool->available_list[event_pool->available_count],
+           &events[released_count], remaining_count * sizeof(iree_event_t));
+    event_pool->available_count += remaining_count;
+    released_count += remaining_count;
   }
   iree_slim_mutex_unlock(&event_pool->mutex);
 
-  // Deallocate the rest of the events. We don't bother resetting them as we are
-  // getting rid of them.
-  if (remaining_count > 0) {
+  // If the pool could not grow then deallocate the events that didn't fit.
+  if (IREE_UNLIKELY(!iree_status_is_ok(status))) {
     IREE_TRACE_ZONE_BEGIN(z0);
-    for (iree_host_size_t i = 0; i < remaining_count; ++i) {
-      iree_event_deinitialize(&events[to_pool_count + i]);
+    iree_status_ignore(status);
+    for (; released_count < event_count; ++released_count) {
+      iree_event_deinitialize(&events[released_count]);
     }
     IREE_TRACE_ZONE_END(z0);
   }
@@ -14,12 +14,32 @@
 extern "C" {
 #endif  // __cplusplus
 
-// A simple pool of iree_event_ts to recycle.
+// Total number of per-thread event magazines in each pool. Threads are assigned
+// a magazine on first use and threads beyond this count share magazines.
+// Must be at least 1.
+#if !defined(IREE_EVENT_POOL_MAGAZINE_COUNT)
+#define IREE_EVENT_POOL_MAGAZINE_COUNT 8
+#endif  // !IREE_EVENT_POOL_MAGAZINE_COUNT
+
+// Maximum number of events cached in each magazine. Events released while the
+// magazine is full go to the shared pool list. Must be at least 1.
+#if !defined(IREE_EVENT_POOL_MAGAZINE_CAPACITY)
+#define IREE_EVENT_POOL_MAGAZINE_CAPACITY 8
+#endif  // !IREE_EVENT_POOL_MAGAZINE_CAPACITY
+
+// A pool of iree_event_ts to recycle.
+//
+// Each thread acquiring and releasing events first tries a small magazine of
+// events assigned to it before falling back to the shared list. The shared
+// list grows to retain every event released to it so that once the pool has
+// warmed up to the peak number of concurrently used events no new system
+// events need to be created.
 //
 // Thread-safe; multiple threads may acquire and release events from the pool.
 typedef struct iree_event_pool_t iree_event_pool_t;
 
-// Allocates a new event pool with up to |available_capacity| events.
+// Allocates a new event pool with |available_capacity| events preallocated.
+// The pool grows beyond this as needed.
 iree_status_t iree_event_pool_allocate(iree_host_size_t available_capacity,
                                        iree_allocator_t host_allocator,
                                        iree_event_pool_t** out_event_pool);
@@ -27,11 +27,22 @@
 #define IREE_SET_BINARY_MODE(handle) ((void)0)
 #endif  // IREE_PLATFORM_WINDOWS
 
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_APPLE) || \
+    defined(IREE_PLATFORM_LINUX)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define IREE_FILE_IO_HAVE_MMAP 1
+#endif  // IREE_PLATFORM_ANDROID || IREE_PLATFORM_APPLE || IREE_PLATFORM_LINUX
+
 // We could take alignment as an arg, but roughly page aligned should be
 // acceptable for all uses - if someone cares about memory usage they won't
 // be using this method.
 #define IREE_FILE_BASE_ALIGNMENT 4096
 
+// Default chunk size used by iree_file_read_chunks.
+#define IREE_FILE_DEFAULT_CHUNK_SIZE (1 * 1024 * 1024)
+
 iree_status_t iree_file_exists(const char* path) {
   IREE_ASSERT_ARGUMENT(path);
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -60,8 +71,7 @@ iree_status_t iree_file_contents_allocator_ctl(void* self,
     return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
                             "only the file contents buffer is valid");
   }
-  iree_allocator_t allocator = contents->allocator;
-  iree_allocator_free(allocator, contents);
+  iree_file_contents_free(contents);
   return iree_ok_status();
 }
 
@@ -74,9 +84,13 @@ iree_allocator_t iree_file_contents_deallocator(
   return allocator;
 }
 
+// Unmaps the |buffer| of a mapped iree_file_contents_t.
+static void iree_file_contents_unmap(iree_byte_span_t buffer);
+
 void iree_file_contents_free(iree_file_contents_t* contents) {
   if (!contents) return;
   IREE_TRACE_ZONE_BEGIN(z0);
+  if (contents->is_mapped) iree_file_contents_unmap(contents->buffer);
   iree_allocator_free(contents->allocator, contents);
   IREE_TRACE_ZONE_END(z0);
 }
@@ -112,6 +126,7 @@ static iree_status_t iree_file_read_contents_impl(
   contents->buffer.data = (void*)iree_host_align(
       (uintptr_t)contents + sizeof(*contents), IREE_FILE_BASE_ALIGNMENT);
   contents->buffer.data_length = file_size;
+  contents->is_mapped = false;
 
   // Attempt to read the file into memory.
   if (fread(contents->buffer.data, file_size, 1, file) != 1) {
@@ -154,6 +169,204 @@ iree_status_t iree_file_read_contents(const char* path,
   return status;
 }
 
+#if defined(IREE_PLATFORM_WINDOWS) || defined(IREE_FILE_IO_HAVE_MMAP)
+
+// Allocates an iree_file_contents_t referencing the mapped |buffer|.
+// Empty buffers are not mapped and are not unmapped when freed.
+static iree_status_t iree_file_contents_wrap_mapping(
+    iree_byte_span_t buffer, iree_allocator_t allocator,
+    iree_file_contents_t** out_contents) {
+  iree_file_contents_t* contents = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_allocator_malloc(allocator, sizeof(*contents), (void**)&contents));
+  contents->allocator = allocator;
+  contents->buffer = buffer;
+  contents->is_mapped = buffer.data_length > 0;
+  *out_contents = contents;
+  return iree_ok_status();
+}
+
+#endif  // IREE_PLATFORM_WINDOWS || IREE_FILE_IO_HAVE_MMAP
+
+#if defined(IREE_PLATFORM_WINDOWS)
+
+static void iree_file_contents_unmap(iree_byte_span_t buffer) {
+  UnmapViewOfFile(buffer.data);
+}
+
+// Maps the file at |path| read-only into |out_contents|.
+static iree_status_t iree_file_map_contents_impl(
+    const char* path, iree_allocator_t allocator,
+    iree_file_contents_t** out_contents) {
+  HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (file == INVALID_HANDLE_VALUE) {
+    return iree_make_status(iree_status_code_from_win32_error(GetLastError()),
+                            "failed to open file '%s'", path);
+  }
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file, &file_size)) {
+    iree_status_t status = iree_make_status(
+        iree_status_code_from_win32_error(GetLastError()), "size query");
+    CloseHandle(file);
+    return status;
+  }
+  if (file_size.QuadPart == 0) {
+    // Empty files cannot be mapped.
+    CloseHandle(file);
+    return iree_file_contents_wrap_mapping(iree_make_byte_span(NULL, 0),
+                                           allocator, out_contents);
+  }
+
+  // The view keeps the mapping (and file) alive after the handles are closed.
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+  void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+  iree_status_t status =
+      data ? iree_ok_status()
+           : iree_make_status(iree_status_code_from_win32_error(GetLastError()),
+                              "failed to map file '%s'", path);
+  if (mapping) CloseHandle(mapping);
+  CloseHandle(file);
+  IREE_RETURN_IF_ERROR(status);
+
+  iree_byte_span_t buffer =
+      iree_make_byte_span(data, (iree_host_size_t)file_size.QuadPart);
+  status = iree_file_contents_wrap_mapping(buffer, allocator, out_contents);
+  if (!iree_status_is_ok(status)) iree_file_contents_unmap(buffer);
+  return status;
+}
+
+#elif defined(IREE_FILE_IO_HAVE_MMAP)
+
+static void iree_file_contents_unmap(iree_byte_span_t buffer) {
+  munmap(buffer.data, buffer.data_length);
+}
+
+// Maps the file at |path| read-only into |out_contents|.
+static iree_status_t iree_file_map_contents_impl(
+    const char* path, iree_allocator_t allocator,
+    iree_file_contents_t** out_contents) {
+  int fd = open(path, O_RDONLY);
+  if (fd == -1) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to open file '%s'", path);
+  }
+  struct stat stat_buf;
+  if (fstat(fd, &stat_buf) == -1) {
+    iree_status_t status =
+        iree_make_status(iree_status_code_from_errno(errno), "size query");
+    close(fd);
+    return status;
+  }
+  if (stat_buf.st_size == 0) {
+    // Empty files cannot be mapped.
+    close(fd);
+    return iree_file_contents_wrap_mapping(iree_make_byte_span(NULL, 0),
+                                           allocator, out_contents);
+  }
+
+  // The mapping keeps the file alive after the descriptor is closed.
+  iree_host_size_t file_size = (iree_host_size_t)stat_buf.st_size;
+  void* data = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  iree_status_t status =
+      data != MAP_FAILED
+          ? iree_ok_status()
+          : iree_make_status(iree_status_code_from_errno(errno),
+                             "failed to map file '%s'", path);
+  close(fd);
+  IREE_RETURN_IF_ERROR(status);
+
+  iree_byte_span_t buffer = iree_make_byte_span(data, file_size);
+  status = iree_file_contents_wrap_mapping(buffer, allocator, out_contents);
+  if (!iree_status_is_ok(status)) iree_file_contents_unmap(buffer);
+  return status;
+}
+
+#else
+
+static void iree_file_contents_unmap(iree_byte_span_t buffer) {}
+
+static iree_status_t iree_file_map_contents_impl(
+    const char* path, iree_allocator_t allocator,
+    iree_file_contents_t** out_contents) {
+  // Mapping is unavailable; read the contents instead.
+  return iree_file_read_contents(path, allocator, out_contents);
+}
+
+#endif  // IREE_PLATFORM_WINDOWS
+
+iree_status_t iree_file_map_contents(const char* path,
+                                     iree_allocator_t allocator,
+                                     iree_file_contents_t** out_contents) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_ASSERT_ARGUMENT(path);
+  IREE_ASSERT_ARGUMENT(out_contents);
+  *out_contents = NULL;
+
+  iree_status_t status =
+      iree_file_map_contents_impl(path, allocator, out_contents);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_file_read_chunks_impl(
+    FILE* file, uint8_t* buffer, iree_host_size_t chunk_size,
+    iree_file_chunk_callback_t callback) {
+  iree_host_size_t offset = 0;
+  while (true) {
+    size_t read_length = fread(buffer, 1, chunk_size, file);
+    if (read_length > 0) {
+      IREE_RETURN_IF_ERROR(
+          callback.fn(callback.user_data, offset,
+                      iree_make_const_byte_span(buffer, read_length)),
+          "processing chunk at offset %zu", offset);
+      offset += read_length;
+    }
+    if (read_length < chunk_size) {
+      if (ferror(file)) {
+        return iree_make_status(iree_status_code_from_errno(errno),
+                                "read failed at offset %zu", offset);
+      }
+      break;  // EOF
+    }
+  }
+  return iree_ok_status();
+}
+
+iree_status_t iree_file_read_chunks(const char* path,
+                                    iree_host_size_t chunk_size,
+                                    iree_file_chunk_callback_t callback,
+                                    iree_allocator_t allocator) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_ASSERT_ARGUMENT(path);
+  IREE_ASSERT_ARGUMENT(callback.fn);
+  if (chunk_size == 0) chunk_size = IREE_FILE_DEFAULT_CHUNK_SIZE;
+
+  FILE* file = fopen(path, "rb");
+  if (file == NULL) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to open file '%s'", path);
+  }
+
+  uint8_t* buffer = NULL;
+  iree_status_t status = iree_allocator_malloc_uninitialized(
+      allocator, chunk_size, (void**)&buffer);
+  if (iree_status_is_ok(status)) {
+    status = iree_file_read_chunks_impl(file, buffer, chunk_size, callback);
+    if (!iree_status_is_ok(status)) {
+      status = iree_status_annotate_f(status, "reading file '%s'", path);
+    }
+  }
+
+  iree_allocator_free(allocator, buffer);
+  fclose(file);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 iree_status_t iree_file_write_contents(const char* path,
                                        iree_const_byte_span_t content) {
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -230,6 +443,7 @@ static iree_status_t iree_stdin_read_contents_impl(
   }
 
   contents->allocator = allocator;
+  contents->is_mapped = false;
   contents->buffer.data[size] = 0;  // NUL
   contents->buffer.data_length = size;
   *out_contents = contents;
@@ -265,6 +479,19 @@ iree_status_t iree_file_read_contents(const char* path,
   return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
 }
 
+iree_status_t iree_file_map_contents(const char* path,
+                                     iree_allocator_t allocator,
+                                     iree_file_contents_t** out_contents) {
+  return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
+}
+
+iree_status_t iree_file_read_chunks(const char* path,
+                                    iree_host_size_t chunk_size,
+                                    iree_file_chunk_callback_t callback,
+                                    iree_allocator_t allocator) {
+  return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
+}
+
 iree_status_t iree_file_write_contents(const char* path,
                                        iree_const_byte_span_t content) {
   return iree_make_status(IREE_STATUS_UNAVAILABLE, "File I/O is disabled");
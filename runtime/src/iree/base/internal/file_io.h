@@ -7,6 +7,8 @@
 #ifndef IREE_BASE_INTERNAL_FILE_IO_H_
 #define IREE_BASE_INTERNAL_FILE_IO_H_
 
+#include <stdbool.h>
+
 #include "iree/base/api.h"
 
 #ifdef __cplusplus
@@ -27,6 +29,9 @@ typedef struct iree_file_contents_t {
     iree_byte_span_t buffer;
     iree_const_byte_span_t const_buffer;
   };
+  // True if |buffer| is a read-only mapping of the file that must not be
+  // modified.
+  bool is_mapped;
 } iree_file_contents_t;
 
 // Returns an allocator that deallocates the |contents|.
@@ -45,6 +50,47 @@ iree_status_t iree_file_read_contents(const char* path,
                                       iree_allocator_t allocator,
                                       iree_file_contents_t** out_contents);
 
+// Maps a file's contents into memory read-only.
+//
+// Returns the contents of the file in |out_contents| without copying them:
+// pages are loaded from the file on first access and are shared with other
+// processes mapping the same file. This makes startup time independent of the
+// file size when only some of the contents are accessed (or are accessed
+// later on) and is preferred for large files such as modules with embedded
+// constants. Unlike iree_file_read_contents the contents are not guaranteed
+// to have a trailing NUL and must not be modified.
+//
+// If the platform does not support mapping files the contents are read as with
+// iree_file_read_contents. |allocator| is used to allocate the
+// iree_file_contents_t and the caller must use iree_file_contents_free to
+// release the mapping.
+iree_status_t iree_file_map_contents(const char* path,
+                                     iree_allocator_t allocator,
+                                     iree_file_contents_t** out_contents);
+
+// Callback invoked by iree_file_read_chunks with each chunk of the file.
+// |offset| is the byte offset of |chunk| within the file. The chunk contents
+// are only valid for the duration of the call. Returning a failure stops the
+// read and the status is returned to the caller of iree_file_read_chunks.
+typedef iree_status_t(IREE_API_PTR* iree_file_chunk_fn_t)(
+    void* user_data, iree_host_size_t offset, iree_const_byte_span_t chunk);
+
+typedef struct iree_file_chunk_callback_t {
+  iree_file_chunk_fn_t fn;
+  void* user_data;
+} iree_file_chunk_callback_t;
+
+// Synchronously reads a file in chunks of up to |chunk_size| bytes (or a
+// default size if 0) and passes each to |callback| in order.
+//
+// Only a single chunk-sized buffer allocated from |allocator| is resident at
+// any time making this suitable for consuming large files that don't need to
+// be in memory all at once (hashing, copying to device memory, etc).
+iree_status_t iree_file_read_chunks(const char* path,
+                                    iree_host_size_t chunk_size,
+                                    iree_file_chunk_callback_t callback,
+                                    iree_allocator_t allocator);
+
 // Synchronously writes a byte buffer into a file.
 // Existing contents are overwritten.
 iree_status_t iree_file_write_contents(const char* path,
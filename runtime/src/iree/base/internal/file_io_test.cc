@@ -77,6 +77,105 @@ TEST(FileIO, ReadWriteContents) {
   iree_file_contents_free(read_contents);
 }
 
+TEST(FileIO, MapContents) {
+  constexpr const char* kUniqueName = "MapContents";
+  auto path = GetUniquePath(kUniqueName);
+
+  // Write the contents to disk.
+  auto write_contents = GetUniqueContents(kUniqueName);
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  // Map the contents and expect they are equal.
+  iree_file_contents_t* mapped_contents = NULL;
+  IREE_ASSERT_OK(iree_file_map_contents(path.c_str(), iree_allocator_system(),
+                                        &mapped_contents));
+  EXPECT_EQ(write_contents.size(), mapped_contents->const_buffer.data_length);
+  EXPECT_EQ(memcmp(write_contents.data(), mapped_contents->const_buffer.data,
+                   mapped_contents->const_buffer.data_length),
+            0);
+
+  // Release the mapping through the deallocator as ownership transfers do.
+  iree_allocator_t deallocator =
+      iree_file_contents_deallocator(mapped_contents);
+  iree_allocator_free(deallocator, mapped_contents->buffer.data);
+}
+
+TEST(FileIO, MapEmptyContents) {
+  constexpr const char* kUniqueName = "MapEmptyContents";
+  auto path = GetUniquePath(kUniqueName);
+  IREE_ASSERT_OK(
+      iree_file_write_contents(path.c_str(), iree_const_byte_span_empty()));
+
+  iree_file_contents_t* mapped_contents = NULL;
+  IREE_ASSERT_OK(iree_file_map_contents(path.c_str(), iree_allocator_system(),
+                                        &mapped_contents));
+  EXPECT_EQ(0, mapped_contents->const_buffer.data_length);
+  iree_file_contents_free(mapped_contents);
+}
+
+TEST(FileIO, MapMissingFile) {
+  auto path = GetUniquePath("MapMissingFile");
+  iree_file_contents_t* mapped_contents = NULL;
+  iree_status_t status = iree_file_map_contents(
+      path.c_str(), iree_allocator_system(), &mapped_contents);
+  IREE_EXPECT_STATUS_IS(IREE_STATUS_NOT_FOUND, status);
+  iree_status_free(status);
+  EXPECT_EQ(nullptr, mapped_contents);
+}
+
+TEST(FileIO, ReadChunks) {
+  constexpr const char* kUniqueName = "ReadChunks";
+  auto path = GetUniquePath(kUniqueName);
+  std::string write_contents;
+  for (int i = 0; i < 100; ++i) {
+    write_contents += GetUniqueContents(kUniqueName);
+  }
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  // Use an odd chunk size so the last chunk is partial.
+  std::string read_contents;
+  iree_file_chunk_callback_t callback;
+  callback.fn = +[](void* user_data, iree_host_size_t offset,
+                    iree_const_byte_span_t chunk) -> iree_status_t {
+    auto* read_contents = (std::string*)user_data;
+    EXPECT_EQ(read_contents->size(), offset);
+    EXPECT_LE(chunk.data_length, 7);
+    read_contents->append((const char*)chunk.data, chunk.data_length);
+    return iree_ok_status();
+  };
+  callback.user_data = &read_contents;
+  IREE_ASSERT_OK(iree_file_read_chunks(path.c_str(), /*chunk_size=*/7,
+                                       callback, iree_allocator_system()));
+  EXPECT_EQ(write_contents, read_contents);
+}
+
+TEST(FileIO, ReadChunksStopsOnFailure) {
+  constexpr const char* kUniqueName = "ReadChunksStopsOnFailure";
+  auto path = GetUniquePath(kUniqueName);
+  auto write_contents = GetUniqueContents(kUniqueName);
+  IREE_ASSERT_OK(iree_file_write_contents(
+      path.c_str(),
+      iree_make_const_byte_span(write_contents.data(), write_contents.size())));
+
+  int chunk_count = 0;
+  iree_file_chunk_callback_t callback;
+  callback.fn = +[](void* user_data, iree_host_size_t offset,
+                    iree_const_byte_span_t chunk) -> iree_status_t {
+    ++*(int*)user_data;
+    return iree_make_status(IREE_STATUS_CANCELLED);
+  };
+  callback.user_data = &chunk_count;
+  iree_status_t status = iree_file_read_chunks(
+      path.c_str(), /*chunk_size=*/4, callback, iree_allocator_system());
+  IREE_EXPECT_STATUS_IS(IREE_STATUS_CANCELLED, status);
+  iree_status_free(status);
+  EXPECT_EQ(1, chunk_count);
+}
+
 }  // namespace
 }  // namespace file_io
 }  // namespace iree
@@ -9,10 +9,19 @@
 #include <assert.h>
 #include <string.h>
 
+#if defined(IREE_COMPILER_MSVC) && \
+    (defined(IREE_ARCH_X86_32) || defined(IREE_ARCH_X86_64))
+#include <intrin.h>  // _mm_pause
+#endif  // IREE_COMPILER_MSVC && IREE_ARCH_X86_*
+
 #if IREE_SYNCHRONIZATION_DISABLE_UNSAFE
 
 // Disabled.
 
+#elif defined(IREE_PLATFORM_APPLE)
+
+#include <errno.h>
+
 #elif defined(IREE_PLATFORM_EMSCRIPTEN)
 
 #include <emscripten/threading.h>
@@ -76,7 +85,62 @@ static inline iree_status_code_t iree_futex_wait(void* address,
 // over lower priority waiters.
 static inline void iree_futex_wake(void* address, int32_t count);
 
-#if defined(IREE_PLATFORM_EMSCRIPTEN)
+#if defined(IREE_PLATFORM_APPLE)
+
+// Apple doesn't have a public futex API but provides __ulock_wait/__ulock_wake
+// (macOS 10.12+/iOS 10+). These are what libc++ uses to implement
+// std::atomic::wait/notify and have been stable since their introduction.
+// https://github.com/apple/darwin-xnu/blob/main/bsd/sys/ulock.h
+#define IREE_UL_COMPARE_AND_WAIT 1
+#define IREE_ULF_WAKE_ALL 0x00000100
+#define IREE_ULF_NO_ERRNO 0x01000000
+extern int __ulock_wait(uint32_t operation, void* addr, uint64_t value,
+                        uint32_t timeout_us);
+extern int __ulock_wake(uint32_t operation, void* addr, uint64_t wake_value);
+
+static inline iree_status_code_t iree_futex_wait(void* address,
+                                                 uint32_t expected_value,
+                                                 uint32_t timeout_ms) {
+  // A timeout of 0 waits forever. Timeouts that don't fit in 32-bit
+  // microseconds (~71 minutes) are clamped and reported as spurious wakes so
+  // that callers recompute the remaining time and wait again.
+  uint32_t timeout_us = 0;
+  bool is_clamped = false;
+  if (timeout_ms != IREE_INFINITE_TIMEOUT_MS) {
+    if (timeout_ms >= UINT32_MAX / 1000) {
+      timeout_us = UINT32_MAX;
+      is_clamped = true;
+    } else {
+      timeout_us = iree_max(1, timeout_ms * 1000);
+    }
+  }
+  int rc = __ulock_wait(IREE_UL_COMPARE_AND_WAIT | IREE_ULF_NO_ERRNO, address,
+                        expected_value, timeout_us);
+  if (IREE_LIKELY(rc >= 0) || rc == -EINTR || rc == -EFAULT) {
+    return IREE_STATUS_OK;
+  } else if (rc == -ETIMEDOUT) {
+    return is_clamped ? IREE_STATUS_OK : IREE_STATUS_DEADLINE_EXCEEDED;
+  }
+  return IREE_STATUS_UNAVAILABLE;
+}
+
+static inline void iree_futex_wake(void* address, int32_t count) {
+  if (count == INT32_MAX) {
+    __ulock_wake(IREE_UL_COMPARE_AND_WAIT | IREE_ULF_WAKE_ALL |
+                     IREE_ULF_NO_ERRNO,
+                 address, 0);
+    return;
+  }
+  for (; count > 0; --count) {
+    // -ENOENT indicates there are no more waiters.
+    if (__ulock_wake(IREE_UL_COMPARE_AND_WAIT | IREE_ULF_NO_ERRNO, address,
+                     0) == -ENOENT) {
+      break;
+    }
+  }
+}
+
+#elif defined(IREE_PLATFORM_EMSCRIPTEN)
 
 static inline iree_status_code_t iree_futex_wait(void* address,
                                                  uint32_t expected_value,
@@ -527,6 +591,26 @@ void iree_slim_mutex_unlock(iree_slim_mutex_t* mutex)
 // iree_notification_t
 //==============================================================================
 
+// Number of spin iterations between deadline checks when spinning in
+// iree_notification_commit_wait. Querying the time is much more expensive than
+// a pause so we amortize it over several iterations.
+#define IREE_NOTIFICATION_SPIN_CHECK_INTERVAL 32
+
+// Hints to the processor that the calling thread is in a spin-wait loop.
+// This reduces power usage and frees resources for sibling hardware threads
+// (such as the SMT thread that may be about to post the notification).
+static inline void iree_notification_spin_pause(void) {
+#if defined(IREE_ARCH_X86_32) || defined(IREE_ARCH_X86_64)
+#if defined(IREE_COMPILER_MSVC)
+  _mm_pause();
+#else
+  __builtin_ia32_pause();
+#endif  // IREE_COMPILER_MSVC
+#elif defined(IREE_ARCH_ARM_64) && defined(IREE_COMPILER_GCC_COMPAT)
+  __asm__ __volatile__("yield");
+#endif  // IREE_ARCH_*
+}
+
 #if IREE_SYNCHRONIZATION_DISABLE_UNSAFE
 
 // No-op implementation that is only used when there is guaranteed to be one
@@ -548,6 +632,7 @@ iree_wait_token_t iree_notification_prepare_wait(
 
 bool iree_notification_commit_wait(iree_notification_t* notification,
                                    iree_wait_token_t wait_token,
+                                   iree_duration_t spin_ns,
                                    iree_time_t deadline_ns) {
   return true;
 }
@@ -603,12 +688,33 @@ iree_wait_token_t iree_notification_prepare_wait(
 
 bool iree_notification_commit_wait(iree_notification_t* notification,
                                    iree_wait_token_t wait_token,
+                                   iree_duration_t spin_ns,
                                    iree_time_t deadline_ns) {
   struct timespec abs_ts = {
       .tv_sec = (time_t)(deadline_ns / 1000000000ull),
       .tv_nsec = (long)(deadline_ns % 1000000000ull),
   };
 
+  // Spin (briefly taking the lock to check the epoch) before parking on the
+  // condvar. This is an emulation path and not expected to be as fast as the
+  // futex path but it still avoids the context switch when the notification
+  // arrives quickly.
+  if (spin_ns > 0) {
+    const iree_time_t spin_deadline_ns =
+        iree_min(deadline_ns, iree_time_now() + spin_ns);
+    for (uint32_t i = 1;; ++i) {
+      pthread_mutex_lock(&notification->mutex);
+      const bool notified = notification->epoch != wait_token;
+      pthread_mutex_unlock(&notification->mutex);
+      if (notified) break;
+      if ((i % IREE_NOTIFICATION_SPIN_CHECK_INTERVAL) == 0 &&
+          iree_time_now() >= spin_deadline_ns) {
+        break;
+      }
+      iree_notification_spin_pause();
+    }
+  }
+
   pthread_mutex_lock(&notification->mutex);
 
   // Spin until notified and the epoch increments from what we captured during
@@ -707,9 +813,31 @@ iree_wait_token_t iree_notification_prepare_wait(
 
 bool iree_notification_commit_wait(iree_notification_t* notification,
                                    iree_wait_token_t wait_token,
+                                   iree_duration_t spin_ns,
                                    iree_time_t deadline_ns) {
   bool result = true;
 
+  // Spin until notified or the spin duration elapses before parking on the
+  // futex. A notification posted while we spin still issues a futex wake (as
+  // we are counted as a waiter) but we avoid the latency of being descheduled
+  // and rescheduled by the kernel.
+  if (spin_ns > 0) {
+    const iree_time_t spin_deadline_ns =
+        iree_min(deadline_ns, iree_time_now() + spin_ns);
+    for (uint32_t i = 1;; ++i) {
+      if ((iree_atomic_load_int64(&notification->value,
+                                  iree_memory_order_acquire) >>
+           IREE_NOTIFICATION_EPOCH_SHIFT) != wait_token) {
+        break;
+      }
+      if ((i % IREE_NOTIFICATION_SPIN_CHECK_INTERVAL) == 0 &&
+          iree_time_now() >= spin_deadline_ns) {
+        break;
+      }
+      iree_notification_spin_pause();
+    }
+  }
+
   // Spin until notified and the epoch increments from what we captured during
   // iree_notification_prepare_wait.
   while ((iree_atomic_load_int64(&notification->value,
@@ -773,7 +901,7 @@ bool iree_notification_await(iree_notification_t* notification,
       return true;
     } else {
       if (!iree_notification_commit_wait(notification, wait_token,
-                                         deadline_ns)) {
+                                         /*spin_ns=*/0, deadline_ns)) {
         // Wait hit the deadline before we hit the condition.
         return false;
       }
@@ -782,3 +910,20 @@ bool iree_notification_await(iree_notification_t* notification,
 
   return true;
 }
+
+bool iree_spin_until(iree_condition_fn_t condition_fn, void* condition_arg,
+                     iree_time_t deadline_ns) {
+#if IREE_SYNCHRONIZATION_DISABLE_UNSAFE
+  // Nothing else can change the condition so spinning would never succeed.
+  return condition_fn(condition_arg);
+#else
+  for (uint32_t i = 1;; ++i) {
+    if (condition_fn(condition_arg)) return true;
+    if ((i % IREE_NOTIFICATION_SPIN_CHECK_INTERVAL) == 0 &&
+        iree_time_now() >= deadline_ns) {
+      return false;
+    }
+    iree_notification_spin_pause();
+  }
+#endif  // IREE_SYNCHRONIZATION_DISABLE_UNSAFE
+}
@@ -55,8 +55,9 @@
 // NOTE: we only support futex when not using tsan as we need to add annotations
 // for tsan to understand what we are doing.
 // https://github.com/llvm-mirror/compiler-rt/blob/master/include/sanitizer/tsan_interface.h
-#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_EMSCRIPTEN) || \
-    defined(IREE_PLATFORM_LINUX) || defined(IREE_PLATFORM_WINDOWS)
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_APPLE) ||    \
+    defined(IREE_PLATFORM_EMSCRIPTEN) || defined(IREE_PLATFORM_LINUX) || \
+    defined(IREE_PLATFORM_WINDOWS)
 #if !defined(IREE_SANITIZER_THREAD)
 #define IREE_PLATFORM_HAS_FUTEX 1
 #endif  // !IREE_SANITIZER_THREAD
@@ -289,7 +290,7 @@ typedef struct iree_notification_t {
   // Nothing required. Unused field to make compilers happy.
   int reserved;
 #elif !defined(IREE_PLATFORM_HAS_FUTEX)
-  // No futex on darwin/when using TSAN, so use mutex/condvar instead.
+  // No futex when using TSAN, so use mutex/condvar instead.
   pthread_mutex_t mutex;
   pthread_cond_t cond;
   uint32_t epoch;
@@ -349,6 +350,11 @@ iree_wait_token_t iree_notification_prepare_wait(
 // is reached. Returns false if the deadline is reached before a notification is
 // posted.
 //
+// If |spin_ns| is non-zero the calling thread will first spin for up to that
+// duration (with processor pause hints) in case the notification is posted
+// shortly. This trades CPU time for lower wake latency as the thread avoids
+// being descheduled by the kernel. Pass 0 to immediately park the thread.
+//
 // Acts as (at least) a memory_order_acquire barrier:
 //   A load operation with this memory order performs the acquire operation on
 //   the affected memory location: no reads or writes in the current thread can
@@ -356,6 +362,7 @@ iree_wait_token_t iree_notification_prepare_wait(
 //   same atomic variable are visible in the current thread.
 bool iree_notification_commit_wait(iree_notification_t* notification,
                                    iree_wait_token_t wait_token,
+                                   iree_duration_t spin_ns,
                                    iree_time_t deadline_ns);
 
 // Cancels a pending wait operation without blocking.
@@ -391,6 +398,17 @@ bool iree_notification_await(iree_notification_t* notification,
                              iree_condition_fn_t condition_fn,
                              void* condition_arg, iree_timeout_t timeout);
 
+// Spins the calling thread until |condition_fn| returns true or |deadline_ns|
+// is reached without ever parking it. Returns true if the condition was met.
+//
+// Intended for bounded spins (a few microseconds) ahead of a real wait where
+// the condition is expected to be met shortly and waking from a park would
+// cost more than the spin. The |condition_fn| is called frequently and must be
+// cheap (such as an atomic load); querying the time is amortized over several
+// condition checks.
+bool iree_spin_until(iree_condition_fn_t condition_fn, void* condition_arg,
+                     iree_time_t deadline_ns);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
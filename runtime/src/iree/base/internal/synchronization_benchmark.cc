@@ -4,6 +4,7 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <atomic>
 #include <cstddef>
 #include <mutex>
 
@@ -249,8 +250,71 @@ BENCHMARK_TEMPLATE(BM_Contended, std::mutex)
 // iree_notification_t
 //==============================================================================
 
-// TODO(benvanik): benchmark this; it should in the worst case be as bad as
-// mutex/futex (as that's what is used), but at the moment we don't really
-// care beyond that.
+// Posts with no waiters; this should be a single atomic operation on all
+// platforms with a futex (or futex-like) primitive.
+void BM_NotificationPostNoWaiters(benchmark::State& state) {
+  static iree_notification_t* notification =
+      ([]() -> iree_notification_t* {
+        auto notification = new iree_notification_t();
+        iree_notification_initialize(notification);
+        return notification;
+      })();
+  for (auto _ : state) {
+    iree_notification_post(notification, IREE_ALL_WAITERS);
+  }
+}
+BENCHMARK(BM_NotificationPostNoWaiters)
+    ->UseRealTime()
+    ->Threads(1)
+    ->ThreadPerCpu();
+
+// Awaits a condition that is already true; the fast path never touches the
+// notification.
+void BM_NotificationAwaitSatisfied(benchmark::State& state) {
+  iree_notification_t notification;
+  iree_notification_initialize(&notification);
+  for (auto _ : state) {
+    bool result = iree_notification_await(
+        &notification, [](void* arg) -> bool { return true; }, NULL,
+        iree_infinite_timeout());
+    benchmark::DoNotOptimize(result);
+  }
+  iree_notification_deinitialize(&notification);
+}
+BENCHMARK(BM_NotificationAwaitSatisfied)->UseRealTime()->Threads(1);
+
+// Two threads take turns waking each other as workers and the task
+// coordinator do. Each iteration is one post and (usually) one wake.
+void BM_NotificationPingPong(benchmark::State& state) {
+  struct Shared {
+    iree_notification_t notification;
+    std::atomic<int> turn;
+  };
+  static Shared* shared = ([]() -> Shared* {
+    auto shared = new Shared();
+    iree_notification_initialize(&shared->notification);
+    shared->turn = 0;
+    return shared;
+  })();
+  struct Condition {
+    Shared* shared;
+    int self;
+  } condition = {shared, state.thread_index()};
+  // Both threads run the same number of iterations and strictly alternate so
+  // the turn is back to thread 0 when the benchmark completes.
+  for (auto _ : state) {
+    iree_notification_await(
+        &shared->notification,
+        [](void* arg) -> bool {
+          auto* condition = (Condition*)arg;
+          return condition->shared->turn.load(std::memory_order_acquire) ==
+                 condition->self;
+        },
+        &condition, iree_infinite_timeout());
+    shared->turn.store(1 - condition.self, std::memory_order_release);
+    iree_notification_post(&shared->notification, IREE_ALL_WAITERS);
+  }
+}
+BENCHMARK(BM_NotificationPingPong)->UseRealTime()->Threads(2);
 
 }  // namespace
@@ -6,6 +6,7 @@
 
 #include "iree/base/internal/synchronization.h"
 
+#include <atomic>
 #include <thread>
 
 #include "iree/testing/gtest.h"
@@ -215,4 +216,60 @@ TEST(NotificationTest, Timeout) {
   iree_notification_deinitialize(&notification);
 }
 
+// Tests that a spinning wait observes a notification posted while spinning.
+TEST(NotificationTest, SpinWaitNotified) {
+  iree_notification_t notification;
+  iree_notification_initialize(&notification);
+
+  iree_wait_token_t wait_token = iree_notification_prepare_wait(&notification);
+  std::thread thread(
+      [&]() { iree_notification_post(&notification, IREE_ALL_WAITERS); });
+  EXPECT_TRUE(iree_notification_commit_wait(
+      &notification, wait_token, /*spin_ns=*/1000 * 1000000ll,
+      IREE_TIME_INFINITE_FUTURE));
+  thread.join();
+
+  iree_notification_deinitialize(&notification);
+}
+
+// Tests that a spinning wait falls back to parking and still honors the
+// deadline when no notification arrives.
+TEST(NotificationTest, SpinWaitTimeout) {
+  iree_notification_t notification;
+  iree_notification_initialize(&notification);
+
+  iree_time_t start_ns = iree_time_now();
+
+  iree_wait_token_t wait_token = iree_notification_prepare_wait(&notification);
+  EXPECT_FALSE(iree_notification_commit_wait(
+      &notification, wait_token, /*spin_ns=*/10 * 1000000ll,
+      start_ns + 100 * 1000000ll));
+
+  iree_duration_t delta_ns = iree_time_now() - start_ns;
+  iree_duration_t delta_ms = delta_ns / 1000000;
+  EXPECT_GE(delta_ms, 50);  // slop
+
+  iree_notification_deinitialize(&notification);
+}
+
+// Tests that a spin observes a condition changed by another thread.
+TEST(SpinUntilTest, ConditionMet) {
+  std::atomic<bool> flag{false};
+  auto check_flag = [](void* arg) -> bool {
+    return static_cast<std::atomic<bool>*>(arg)->load();
+  };
+
+  std::thread thread([&]() { flag.store(true); });
+  EXPECT_TRUE(iree_spin_until(check_flag, &flag, IREE_TIME_INFINITE_FUTURE));
+  thread.join();
+}
+
+// Tests that a spin gives up once the deadline is reached.
+TEST(SpinUntilTest, Timeout) {
+  auto never = [](void* arg) -> bool { return false; };
+  iree_time_t start_ns = iree_time_now();
+  EXPECT_FALSE(iree_spin_until(never, nullptr, start_ns + 10 * 1000000ll));
+  EXPECT_GE(iree_time_now(), start_ns + 10 * 1000000ll);
+}
+
 }  // namespace
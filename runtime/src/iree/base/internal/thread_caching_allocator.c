@@ -0,0 +1,421 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/thread_caching_allocator.h"
+
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+
+//===----------------------------------------------------------------------===//
+// Size classes
+//===----------------------------------------------------------------------===//
+
+// Size classes in units of the block granularity (iree_max_align_t). Classes
+// are spaced 4 per power of two to bound internal fragmentation to ~25%.
+static const uint16_t iree_tca_class_sizes[] = {
+    16,  32,  48,  64,  80,  96,  112, 128, 160, 192,
+    224, 256, 320, 384, 448, 512, 640, 768, 896, 1024,
+};
+#define IREE_TCA_CLASS_COUNT IREE_ARRAYSIZE(iree_tca_class_sizes)
+#define IREE_TCA_GRANULARITY iree_max_align_t
+#define IREE_TCA_LARGE_CLASS UINT32_MAX
+
+static_assert(IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE <= 1024,
+              "size class table only covers allocations up to 1024 bytes");
+
+// Number of blocks moved between a thread cache and the central cache at
+// a time. Thread caches hold at most twice this many free blocks per class.
+#define IREE_TCA_BATCH_SIZE 32
+
+// Header preceding every allocation. Keeps the user pointer aligned to
+// iree_max_align_t and records how the block must be freed.
+typedef struct iree_alignas(iree_max_align_t) iree_tca_block_header_t {
+  // Size class index or IREE_TCA_LARGE_CLASS for base allocations.
+  uint32_t size_class;
+} iree_tca_block_header_t;
+static_assert(sizeof(iree_tca_block_header_t) == IREE_TCA_GRANULARITY,
+              "header must preserve the alignment of the user pointer");
+
+// A freed block; aliases the user storage following the header.
+typedef struct iree_tca_free_block_t {
+  struct iree_tca_free_block_t* next;
+} iree_tca_free_block_t;
+
+// Header at the start of each slab linking all slabs owned by a cache.
+typedef struct iree_alignas(iree_max_align_t) iree_tca_slab_t {
+  struct iree_tca_slab_t* next;
+} iree_tca_slab_t;
+
+//===----------------------------------------------------------------------===//
+// iree_thread_caching_allocator_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_alignas(iree_hardware_destructive_interference_size)
+    iree_tca_cache_t {
+  iree_slim_mutex_t mutex;
+  // Free blocks per size class; the user storage of each block is used as the
+  // list link.
+  iree_tca_free_block_t* free_lists[IREE_TCA_CLASS_COUNT];
+  uint32_t free_counts[IREE_TCA_CLASS_COUNT];
+  // Remaining unused bytes in the most recently allocated slab.
+  uint8_t* slab_cursor;
+  uint8_t* slab_end;
+  // All slabs allocated by this cache.
+  iree_tca_slab_t* slab_head;
+  // Statistics; bytes_in_use is kept as a modular sum across caches as blocks
+  // may be freed on a different thread than they were allocated on.
+  uint64_t small_alloc_count;
+  uint64_t small_reuse_count;
+  uint64_t small_free_count;
+  uint64_t large_alloc_count;
+  uint64_t slab_count;
+  uint64_t bytes_in_use;
+} iree_tca_cache_t;
+
+struct iree_thread_caching_allocator_t {
+  iree_allocator_t base_allocator;
+  // Size class lookup indexed by `(byte_length + 15) / 16`.
+  uint8_t class_lookup[IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE /
+                           IREE_TCA_GRANULARITY +
+                       1];
+  // Central cache balancing blocks between thread caches. Only free lists are
+  // used.
+  iree_tca_cache_t central;
+  iree_tca_cache_t caches[IREE_THREAD_CACHING_ALLOCATOR_CACHE_COUNT];
+};
+
+// Thread slot assigned on first use by any allocator; 0 if unassigned.
+// Slots are shared by all allocators so that a thread always maps to the same
+// cache index.
+static iree_atomic_int32_t iree_tca_next_thread_slot = IREE_ATOMIC_VAR_INIT(0);
+static IREE_THREAD_LOCAL int32_t iree_tca_thread_slot = 0;
+
+static iree_tca_cache_t* iree_tca_current_cache(
+    iree_thread_caching_allocator_t* allocator) {
+  int32_t slot = iree_tca_thread_slot;
+  if (IREE_UNLIKELY(slot == 0)) {
+    slot = iree_atomic_fetch_add_int32(&iree_tca_next_thread_slot, 1,
+                                       iree_memory_order_relaxed) +
+           1;
+    iree_tca_thread_slot = slot;
+  }
+  return &allocator
+              ->caches[(uint32_t)(slot - 1) %
+                       IREE_THREAD_CACHING_ALLOCATOR_CACHE_COUNT];
+}
+
+static void iree_tca_cache_initialize(iree_tca_cache_t* out_cache) {
+  memset(out_cache, 0, sizeof(*out_cache));
+  iree_slim_mutex_initialize(&out_cache->mutex);
+}
+
+static void iree_tca_cache_deinitialize(iree_allocator_t base_allocator,
+                                        iree_tca_cache_t* cache) {
+  iree_tca_slab_t* slab = cache->slab_head;
+  while (slab) {
+    iree_tca_slab_t* next = slab->next;
+    iree_allocator_free(base_allocator, slab);
+    slab = next;
+  }
+  iree_slim_mutex_deinitialize(&cache->mutex);
+}
+
+iree_status_t iree_thread_caching_allocator_create(
+    iree_allocator_t base_allocator,
+    iree_thread_caching_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(out_allocator);
+  *out_allocator = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_thread_caching_allocator_t* allocator = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0,
+      iree_allocator_malloc_aligned(
+          base_allocator, sizeof(*allocator),
+          iree_hardware_destructive_interference_size, 0, (void**)&allocator));
+  allocator->base_allocator = base_allocator;
+  uint32_t size_class = 0;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(allocator->class_lookup);
+       ++i) {
+    while (iree_tca_class_sizes[size_class] < i * IREE_TCA_GRANULARITY) {
+      ++size_class;
+    }
+    allocator->class_lookup[i] = (uint8_t)size_class;
+  }
+  iree_tca_cache_initialize(&allocator->central);
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(allocator->caches); ++i) {
+    iree_tca_cache_initialize(&allocator->caches[i]);
+  }
+
+  *out_allocator = allocator;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+void iree_thread_caching_allocator_free(
+    iree_thread_caching_allocator_t* allocator) {
+  if (!allocator) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_allocator_t base_allocator = allocator->base_allocator;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(allocator->caches); ++i) {
+    iree_tca_cache_deinitialize(base_allocator, &allocator->caches[i]);
+  }
+  iree_tca_cache_deinitialize(base_allocator, &allocator->central);
+  iree_allocator_free_aligned(base_allocator, allocator);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+iree_allocator_t iree_thread_caching_allocator_as_allocator(
+    iree_thread_caching_allocator_t* allocator) {
+  iree_allocator_t v = {allocator, iree_thread_caching_allocator_ctl};
+  return v;
+}
+
+void iree_thread_caching_allocator_query_statistics(
+    iree_thread_caching_allocator_t* allocator,
+    iree_thread_caching_allocator_statistics_t* out_statistics) {
+  IREE_ASSERT_ARGUMENT(allocator);
+  IREE_ASSERT_ARGUMENT(out_statistics);
+  memset(out_statistics, 0, sizeof(*out_statistics));
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(allocator->caches); ++i) {
+    iree_tca_cache_t* cache = &allocator->caches[i];
+    iree_slim_mutex_lock(&cache->mutex);
+    out_statistics->small_alloc_count += cache->small_alloc_count;
+    out_statistics->small_reuse_count += cache->small_reuse_count;
+    out_statistics->small_free_count += cache->small_free_count;
+    out_statistics->large_alloc_count += cache->large_alloc_count;
+    out_statistics->slab_count += cache->slab_count;
+    out_statistics->bytes_in_use += cache->bytes_in_use;
+    iree_slim_mutex_unlock(&cache->mutex);
+  }
+  out_statistics->bytes_reserved =
+      out_statistics->slab_count * IREE_THREAD_CACHING_ALLOCATOR_SLAB_SIZE;
+}
+
+// Moves up to IREE_TCA_BATCH_SIZE blocks of |size_class| from |source| to
+// |target|. Both caches must be locked.
+static void iree_tca_transfer_batch(iree_tca_cache_t* source,
+                                    iree_tca_cache_t* target,
+                                    uint32_t size_class) {
+  for (uint32_t i = 0;
+       i < IREE_TCA_BATCH_SIZE && source->free_lists[size_class]; ++i) {
+    iree_tca_free_block_t* block = source->free_lists[size_class];
+    source->free_lists[size_class] = block->next;
+    --source->free_counts[size_class];
+    block->next = target->free_lists[size_class];
+    target->free_lists[size_class] = block;
+    ++target->free_counts[size_class];
+  }
+}
+
+// Allocates a block of |size_class| from |cache| and returns its header.
+// The cache must be locked.
+static iree_status_t iree_tca_cache_alloc_block(
+    iree_thread_caching_allocator_t* allocator, iree_tca_cache_t* cache,
+    uint32_t size_class, iree_tca_block_header_t** out_header) {
+  // Refill from the central cache when we have run dry; blocks freed by other
+  // threads (or released by caches that accumulated too many) end up there.
+  if (!cache->free_lists[size_class]) {
+    iree_slim_mutex_lock(&allocator->central.mutex);
+    iree_tca_transfer_batch(&allocator->central, cache, size_class);
+    iree_slim_mutex_unlock(&allocator->central.mutex);
+  }
+
+  iree_tca_free_block_t* block = cache->free_lists[size_class];
+  if (block) {
+    cache->free_lists[size_class] = block->next;
+    --cache->free_counts[size_class];
+    ++cache->small_reuse_count;
+    *out_header = (iree_tca_block_header_t*)block - 1;
+    return iree_ok_status();
+  }
+
+  // Carve a new block from the current slab, acquiring a new one if needed.
+  const iree_host_size_t block_size =
+      sizeof(iree_tca_block_header_t) + iree_tca_class_sizes[size_class];
+  if ((iree_host_size_t)(cache->slab_end - cache->slab_cursor) < block_size) {
+    iree_tca_slab_t* slab = NULL;
+    IREE_RETURN_IF_ERROR(iree_allocator_malloc_uninitialized(
+        allocator->base_allocator, IREE_THREAD_CACHING_ALLOCATOR_SLAB_SIZE,
+        (void**)&slab));
+    slab->next = cache->slab_head;
+    cache->slab_head = slab;
+    cache->slab_cursor = (uint8_t*)slab + sizeof(*slab);
+    cache->slab_end = (uint8_t*)slab + IREE_THREAD_CACHING_ALLOCATOR_SLAB_SIZE;
+    ++cache->slab_count;
+  }
+  iree_tca_block_header_t* header =
+      (iree_tca_block_header_t*)cache->slab_cursor;
+  cache->slab_cursor += block_size;
+  header->size_class = size_class;
+  *out_header = header;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_tca_alloc_small(
+    iree_thread_caching_allocator_t* allocator,
+    iree_allocator_command_t command, iree_host_size_t byte_length,
+    void** out_ptr) {
+  const uint32_t size_class =
+      allocator->class_lookup[(byte_length + IREE_TCA_GRANULARITY - 1) /
+                              IREE_TCA_GRANULARITY];
+  iree_tca_cache_t* cache = iree_tca_current_cache(allocator);
+  iree_slim_mutex_lock(&cache->mutex);
+  iree_tca_block_header_t* header = NULL;
+  iree_status_t status =
+      iree_tca_cache_alloc_block(allocator, cache, size_class, &header);
+  if (iree_status_is_ok(status)) {
+    ++cache->small_alloc_count;
+    cache->bytes_in_use += iree_tca_class_sizes[size_class];
+  }
+  iree_slim_mutex_unlock(&cache->mutex);
+  IREE_RETURN_IF_ERROR(status);
+
+  void* ptr = header + 1;
+  if (command == IREE_ALLOCATOR_COMMAND_CALLOC) {
+    memset(ptr, 0, byte_length);
+  }
+  IREE_TRACE_ALLOC(ptr, byte_length);
+  *out_ptr = ptr;
+  return iree_ok_status();
+}
+
+static void iree_tca_free_small(iree_thread_caching_allocator_t* allocator,
+                                iree_tca_block_header_t* header) {
+  const uint32_t size_class = header->size_class;
+  iree_tca_free_block_t* block = (iree_tca_free_block_t*)(header + 1);
+  IREE_TRACE_FREE(block);
+  iree_tca_cache_t* cache = iree_tca_current_cache(allocator);
+  iree_slim_mutex_lock(&cache->mutex);
+  block->next = cache->free_lists[size_class];
+  cache->free_lists[size_class] = block;
+  ++cache->free_counts[size_class];
+  ++cache->small_free_count;
+  cache->bytes_in_use -= iree_tca_class_sizes[size_class];
+  if (cache->free_counts[size_class] > 2 * IREE_TCA_BATCH_SIZE) {
+    // Return a batch to the central cache so that threads that mostly free
+    // (consumers) don't hoard blocks that threads that mostly allocate
+    // (producers) would otherwise carve from new slabs.
+    iree_slim_mutex_lock(&allocator->central.mutex);
+    iree_tca_transfer_batch(cache, &allocator->central, size_class);
+    iree_slim_mutex_unlock(&allocator->central.mutex);
+  }
+  iree_slim_mutex_unlock(&cache->mutex);
+}
+
+static iree_status_t iree_tca_alloc_large(
+    iree_thread_caching_allocator_t* allocator,
+    iree_allocator_command_t command, iree_host_size_t byte_length,
+    void** inout_ptr) {
+  iree_tca_block_header_t* header = NULL;
+  const iree_host_size_t total_length = sizeof(*header) + byte_length;
+  if (command == IREE_ALLOCATOR_COMMAND_CALLOC) {
+    IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+        allocator->base_allocator, total_length, (void**)&header));
+  } else {
+    IREE_RETURN_IF_ERROR(iree_allocator_malloc_uninitialized(
+        allocator->base_allocator, total_length, (void**)&header));
+  }
+  header->size_class = IREE_TCA_LARGE_CLASS;
+  iree_tca_cache_t* cache = iree_tca_current_cache(allocator);
+  iree_slim_mutex_lock(&cache->mutex);
+  ++cache->large_alloc_count;
+  iree_slim_mutex_unlock(&cache->mutex);
+  *inout_ptr = header + 1;
+  return iree_ok_status();
+}
+
+static iree_status_t iree_tca_alloc(iree_thread_caching_allocator_t* allocator,
+                                    iree_allocator_command_t command,
+                                    iree_host_size_t byte_length,
+                                    void** inout_ptr) {
+  if (byte_length <= IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE) {
+    return iree_tca_alloc_small(allocator, command, byte_length, inout_ptr);
+  }
+  return iree_tca_alloc_large(allocator, command, byte_length, inout_ptr);
+}
+
+static void iree_tca_free(iree_thread_caching_allocator_t* allocator,
+                          void* ptr) {
+  iree_tca_block_header_t* header = (iree_tca_block_header_t*)ptr - 1;
+  if (header->size_class == IREE_TCA_LARGE_CLASS) {
+    iree_allocator_free(allocator->base_allocator, header);
+  } else {
+    iree_tca_free_small(allocator, header);
+  }
+}
+
+static iree_status_t iree_tca_realloc(
+    iree_thread_caching_allocator_t* allocator, iree_host_size_t byte_length,
+    void** inout_ptr) {
+  iree_tca_block_header_t* header = (iree_tca_block_header_t*)*inout_ptr - 1;
+  if (header->size_class == IREE_TCA_LARGE_CLASS &&
+      byte_length > IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE) {
+    // Large to large can be handled by the base allocator in-place.
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        allocator->base_allocator, sizeof(*header) + byte_length,
+        (void**)&header));
+    *inout_ptr = header + 1;
+    return iree_ok_status();
+  }
+
+  // Small blocks have slack up to their size class.
+  iree_host_size_t existing_length = 0;
+  if (header->size_class != IREE_TCA_LARGE_CLASS) {
+    existing_length = iree_tca_class_sizes[header->size_class];
+    if (byte_length <= existing_length) {
+      return iree_ok_status();
+    }
+  } else {
+    // Shrinking from large to small; only the new length is preserved.
+    existing_length = byte_length;
+  }
+
+  void* new_ptr = NULL;
+  IREE_RETURN_IF_ERROR(iree_tca_alloc(
+      allocator, IREE_ALLOCATOR_COMMAND_MALLOC, byte_length, &new_ptr));
+  memcpy(new_ptr, *inout_ptr, iree_min(existing_length, byte_length));
+  iree_tca_free(allocator, *inout_ptr);
+  *inout_ptr = new_ptr;
+  return iree_ok_status();
+}
+
+iree_status_t iree_thread_caching_allocator_ctl(
+    void* self, iree_allocator_command_t command, const void* params,
+    void** inout_ptr) {
+  iree_thread_caching_allocator_t* allocator =
+      (iree_thread_caching_allocator_t*)self;
+  IREE_ASSERT_ARGUMENT(inout_ptr);
+  switch (command) {
+    case IREE_ALLOCATOR_COMMAND_MALLOC:
+    case IREE_ALLOCATOR_COMMAND_CALLOC:
+    case IREE_ALLOCATOR_COMMAND_REALLOC: {
+      IREE_ASSERT_ARGUMENT(params);
+      const iree_host_size_t byte_length =
+          ((const iree_allocator_alloc_params_t*)params)->byte_length;
+      if (IREE_UNLIKELY(byte_length == 0)) {
+        return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                                "allocations must be >0 bytes");
+      }
+      if (command == IREE_ALLOCATOR_COMMAND_REALLOC && *inout_ptr) {
+        return iree_tca_realloc(allocator, byte_length, inout_ptr);
+      }
+      return iree_tca_alloc(allocator, command, byte_length, inout_ptr);
+    }
+    case IREE_ALLOCATOR_COMMAND_FREE:
+      if (*inout_ptr) {
+        iree_tca_free(allocator, *inout_ptr);
+        *inout_ptr = NULL;
+      }
+      return iree_ok_status();
+    default:
+      return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                              "unsupported thread caching allocator command");
+  }
+}
@@ -0,0 +1,109 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_BASE_INTERNAL_THREAD_CACHING_ALLOCATOR_H_
+#define IREE_BASE_INTERNAL_THREAD_CACHING_ALLOCATOR_H_
+
+#include "iree/base/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_thread_caching_allocator_t
+//===----------------------------------------------------------------------===//
+
+// Largest allocation size, in bytes, serviced from the size-class caches.
+// Larger allocations are forwarded to the base allocator.
+#if !defined(IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE)
+#define IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE 1024
+#endif  // !IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE
+
+// Size, in bytes, of each slab allocated from the base allocator. Each thread
+// cache carves blocks of any size class from its current slab.
+#if !defined(IREE_THREAD_CACHING_ALLOCATOR_SLAB_SIZE)
+#define IREE_THREAD_CACHING_ALLOCATOR_SLAB_SIZE (64 * 1024)
+#endif  // !IREE_THREAD_CACHING_ALLOCATOR_SLAB_SIZE
+
+// Total number of per-thread caches. Threads are assigned a cache on first use
+// and threads beyond this count share caches (still correct, just contended).
+#if !defined(IREE_THREAD_CACHING_ALLOCATOR_CACHE_COUNT)
+#define IREE_THREAD_CACHING_ALLOCATOR_CACHE_COUNT 16
+#endif  // !IREE_THREAD_CACHING_ALLOCATOR_CACHE_COUNT
+
+// Statistics aggregated across all caches of the allocator.
+typedef struct iree_thread_caching_allocator_statistics_t {
+  // Total number of allocations serviced from the size-class caches.
+  uint64_t small_alloc_count;
+  // Total number of small allocations that reused a previously freed block.
+  uint64_t small_reuse_count;
+  // Total number of small blocks freed back to the caches.
+  uint64_t small_free_count;
+  // Total number of allocations forwarded to the base allocator.
+  uint64_t large_alloc_count;
+  // Total number of slabs allocated from the base allocator.
+  uint64_t slab_count;
+  // Bytes currently reserved from the base allocator for slabs.
+  uint64_t bytes_reserved;
+  // Bytes of small blocks currently allocated (rounded up to their class).
+  uint64_t bytes_in_use;
+} iree_thread_caching_allocator_statistics_t;
+
+// A thread-caching size-class allocator for small host allocations.
+// Allocations of up to IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE bytes are
+// rounded up to one of a fixed set of size classes and serviced from free
+// lists kept in per-thread caches; blocks are carved from slabs allocated from
+// the base allocator and are only returned to it when the allocator is freed.
+// Larger allocations pass through to the base allocator unmodified.
+//
+// Blocks freed on a thread other than the one that allocated them are cached
+// on the freeing thread. All small allocations have iree_max_align_t
+// alignment.
+//
+// Intended to be used by sessions, devices, and other long-lived objects that
+// make many small, short-lived allocations (statuses, lists, refs, etc) by
+// passing iree_thread_caching_allocator_as_allocator as their host allocator.
+//
+// Thread-safe; the base allocator must also be thread-safe.
+typedef struct iree_thread_caching_allocator_t
+    iree_thread_caching_allocator_t;
+
+// Creates a new thread-caching allocator that acquires slabs and services
+// large allocations from |base_allocator|.
+// |out_allocator| must be released with iree_thread_caching_allocator_free
+// after all allocations made from it have been freed.
+iree_status_t iree_thread_caching_allocator_create(
+    iree_allocator_t base_allocator,
+    iree_thread_caching_allocator_t** out_allocator);
+
+// Frees |allocator| and all slabs it has acquired.
+void iree_thread_caching_allocator_free(
+    iree_thread_caching_allocator_t* allocator);
+
+// Returns an iree_allocator_t that allocates from |allocator|.
+// The returned allocator is only valid for the lifetime of |allocator|.
+iree_allocator_t iree_thread_caching_allocator_as_allocator(
+    iree_thread_caching_allocator_t* allocator);
+
+// Queries the current statistics of |allocator|.
+// Values are gathered from each cache in turn and may be slightly out of date
+// if other threads are concurrently using the allocator.
+void iree_thread_caching_allocator_query_statistics(
+    iree_thread_caching_allocator_t* allocator,
+    iree_thread_caching_allocator_statistics_t* out_statistics);
+
+// iree_allocator_ctl_fn_t implementation; |self| must be an
+// iree_thread_caching_allocator_t.
+iree_status_t iree_thread_caching_allocator_ctl(
+    void* self, iree_allocator_command_t command, const void* params,
+    void** inout_ptr);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_BASE_INTERNAL_THREAD_CACHING_ALLOCATOR_H_
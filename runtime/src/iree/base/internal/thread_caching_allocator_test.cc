@@ -0,0 +1,177 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/thread_caching_allocator.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "iree/base/status_cc.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+class ThreadCachingAllocatorTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    IREE_ASSERT_OK(iree_thread_caching_allocator_create(iree_allocator_system(),
+                                                        &caching_allocator_));
+    allocator_ = iree_thread_caching_allocator_as_allocator(caching_allocator_);
+  }
+
+  void TearDown() override {
+    iree_thread_caching_allocator_free(caching_allocator_);
+  }
+
+  iree_thread_caching_allocator_statistics_t QueryStatistics() {
+    iree_thread_caching_allocator_statistics_t statistics;
+    iree_thread_caching_allocator_query_statistics(caching_allocator_,
+                                                   &statistics);
+    return statistics;
+  }
+
+  iree_thread_caching_allocator_t* caching_allocator_ = nullptr;
+  iree_allocator_t allocator_;
+};
+
+TEST_F(ThreadCachingAllocatorTest, ZeroLengthFails) {
+  void* ptr = nullptr;
+  EXPECT_THAT(Status(iree_allocator_malloc(allocator_, 0, &ptr)),
+              StatusIs(StatusCode::kInvalidArgument));
+}
+
+TEST_F(ThreadCachingAllocatorTest, SmallReuse) {
+  void* ptr0 = nullptr;
+  IREE_ASSERT_OK(iree_allocator_malloc(allocator_, 24, &ptr0));
+  EXPECT_EQ(0, (uintptr_t)ptr0 % iree_max_align_t);
+  std::memset(ptr0, 0xCD, 24);
+  iree_allocator_free(allocator_, ptr0);
+
+  // Same size class on the same thread reuses the block and still zeros it.
+  void* ptr1 = nullptr;
+  IREE_ASSERT_OK(iree_allocator_malloc(allocator_, 32, &ptr1));
+  EXPECT_EQ(ptr0, ptr1);
+  for (int i = 0; i < 32; ++i) EXPECT_EQ(0, ((uint8_t*)ptr1)[i]);
+  iree_allocator_free(allocator_, ptr1);
+
+  auto statistics = QueryStatistics();
+  EXPECT_EQ(2, statistics.small_alloc_count);
+  EXPECT_EQ(1, statistics.small_reuse_count);
+  EXPECT_EQ(2, statistics.small_free_count);
+  EXPECT_EQ(0, statistics.bytes_in_use);
+  EXPECT_EQ(1, statistics.slab_count);
+}
+
+TEST_F(ThreadCachingAllocatorTest, Large) {
+  const iree_host_size_t length =
+      IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE + 1;
+  uint8_t* ptr = nullptr;
+  IREE_ASSERT_OK(iree_allocator_malloc(allocator_, length, (void**)&ptr));
+  EXPECT_EQ(0, (uintptr_t)ptr % iree_max_align_t);
+  for (iree_host_size_t i = 0; i < length; ++i) EXPECT_EQ(0, ptr[i]);
+  iree_allocator_free(allocator_, ptr);
+  auto statistics = QueryStatistics();
+  EXPECT_EQ(1, statistics.large_alloc_count);
+  EXPECT_EQ(0, statistics.small_alloc_count);
+  EXPECT_EQ(0, statistics.slab_count);
+}
+
+TEST_F(ThreadCachingAllocatorTest, Realloc) {
+  uint8_t* ptr = nullptr;
+  IREE_ASSERT_OK(iree_allocator_malloc(allocator_, 8, (void**)&ptr));
+  for (int i = 0; i < 8; ++i) ptr[i] = (uint8_t)i;
+
+  // Growing within the size class keeps the block.
+  uint8_t* original_ptr = ptr;
+  IREE_ASSERT_OK(iree_allocator_realloc(allocator_, 16, (void**)&ptr));
+  EXPECT_EQ(original_ptr, ptr);
+
+  // Small -> small in a larger class and then small -> large -> large.
+  for (iree_host_size_t length : {100, 4000, 64 * 1024}) {
+    IREE_ASSERT_OK(iree_allocator_realloc(allocator_, length, (void**)&ptr));
+    for (int i = 0; i < 8; ++i) EXPECT_EQ(i, ptr[i]);
+  }
+
+  // Large -> small.
+  IREE_ASSERT_OK(iree_allocator_realloc(allocator_, 8, (void**)&ptr));
+  for (int i = 0; i < 8; ++i) EXPECT_EQ(i, ptr[i]);
+  iree_allocator_free(allocator_, ptr);
+  EXPECT_EQ(0, QueryStatistics().bytes_in_use);
+}
+
+TEST_F(ThreadCachingAllocatorTest, AllSizes) {
+  std::vector<void*> ptrs;
+  for (iree_host_size_t length = 1;
+       length <= IREE_THREAD_CACHING_ALLOCATOR_MAX_SMALL_SIZE * 2; ++length) {
+    void* ptr = nullptr;
+    IREE_ASSERT_OK(
+        iree_allocator_malloc_uninitialized(allocator_, length, &ptr));
+    std::memset(ptr, 0xAB, length);
+    ptrs.push_back(ptr);
+  }
+  for (void* ptr : ptrs) iree_allocator_free(allocator_, ptr);
+  EXPECT_EQ(0, QueryStatistics().bytes_in_use);
+}
+
+// Allocates on one set of threads and frees on another to ensure blocks flow
+// back through the central cache instead of continuously growing slabs.
+TEST_F(ThreadCachingAllocatorTest, CrossThreadFree) {
+  static constexpr int kRounds = 64;
+  static constexpr int kBlocksPerRound = 256;
+  for (int round = 0; round < kRounds; ++round) {
+    std::vector<void*> ptrs(kBlocksPerRound);
+    std::thread producer([&]() {
+      for (auto& ptr : ptrs) {
+        IREE_ASSERT_OK(iree_allocator_malloc(allocator_, 48, &ptr));
+      }
+    });
+    producer.join();
+    std::thread consumer([&]() {
+      for (auto ptr : ptrs) iree_allocator_free(allocator_, ptr);
+    });
+    consumer.join();
+  }
+  auto statistics = QueryStatistics();
+  EXPECT_EQ(0, statistics.bytes_in_use);
+  EXPECT_EQ(statistics.small_alloc_count, statistics.small_free_count);
+  // Each round uses a new pair of threads; most blocks must be reused.
+  EXPECT_GT(statistics.small_reuse_count, statistics.small_alloc_count / 2);
+}
+
+TEST_F(ThreadCachingAllocatorTest, ConcurrentStress) {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([this, t]() {
+      std::vector<uint8_t*> ptrs;
+      for (int i = 0; i < 10000; ++i) {
+        iree_host_size_t length = 1 + ((i * 37 + t * 101) % 1500);
+        uint8_t* ptr = nullptr;
+        IREE_ASSERT_OK(
+            iree_allocator_malloc(allocator_, length, (void**)&ptr));
+        ptr[0] = (uint8_t)t;
+        ptrs.push_back(ptr);
+        if (ptrs.size() > 64) {
+          uint8_t* old_ptr = ptrs[i % ptrs.size()];
+          EXPECT_EQ((uint8_t)t, old_ptr[0]);
+          iree_allocator_free(allocator_, old_ptr);
+          ptrs[i % ptrs.size()] = ptrs.back();
+          ptrs.pop_back();
+        }
+      }
+      for (auto ptr : ptrs) iree_allocator_free(allocator_, ptr);
+    });
+  }
+  for (auto& thread : threads) thread.join();
+  EXPECT_EQ(0, QueryStatistics().bytes_in_use);
+}
+
+}  // namespace
+}  // namespace iree
@@ -47,6 +47,31 @@ typedef enum iree_thread_priority_class_e {
   IREE_THREAD_PRIORITY_CLASS_HIGHEST = 2,
 } iree_thread_priority_class_t;
 
+// Specifies a thread's scheduling policy.
+// Policies are requested on a best-effort basis and silently fall back to the
+// platform default when unsupported or not permitted (such as when real-time
+// scheduling requires privileges the process does not have).
+//
+// Linux/Android:
+//   Maps to the corresponding SCHED_* policy. When using
+//   IREE_THREAD_SCHEDULING_POLICY_REALTIME the priority class selects the
+//   real-time priority within the SCHED_FIFO range.
+//
+// macOS/iOS/Windows:
+//   Ignored; the priority class (QoS class on Apple platforms) is the only
+//   scheduling control.
+typedef enum iree_thread_scheduling_policy_e {
+  // Default time-sharing policy of the system (SCHED_OTHER).
+  IREE_THREAD_SCHEDULING_POLICY_DEFAULT = 0,
+  // Throughput-oriented policy for non-interactive work that benefits from
+  // being preempted less frequently (SCHED_BATCH).
+  IREE_THREAD_SCHEDULING_POLICY_BATCH = 1,
+  // Fixed-priority real-time policy for latency-critical work that must
+  // preempt all time-sharing threads when runnable (SCHED_FIFO). Use with
+  // care: a spinning real-time thread can starve the rest of the system.
+  IREE_THREAD_SCHEDULING_POLICY_REALTIME = 2,
+} iree_thread_scheduling_policy_t;
+
 // Specifies the processor affinity for a particular thread.
 // Each platform handles this differently (if at all).
 //
@@ -101,6 +126,9 @@ typedef struct iree_thread_create_params_t {
   // see that for more information.
   iree_thread_priority_class_t priority_class;
 
+  // Scheduling policy of the thread.
+  iree_thread_scheduling_policy_t scheduling_policy;
+
   // Initial thread affinity.
   // This may be changed later via iree_thread_request_affinity; see that for
   // more information.
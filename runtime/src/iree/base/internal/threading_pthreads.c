@@ -55,6 +55,9 @@ struct iree_thread_t {
 
 static void iree_thread_set_priority_class(
     iree_thread_t* thread, iree_thread_priority_class_t priority_class);
+static void iree_thread_set_scheduling_policy(
+    iree_thread_t* thread, iree_thread_scheduling_policy_t scheduling_policy,
+    iree_thread_priority_class_t priority_class);
 
 static bool iree_thread_resumed_predicate(void* arg) {
   iree_thread_t* thread = (iree_thread_t*)arg;
@@ -191,7 +194,10 @@ iree_status_t iree_thread_create(iree_thread_entry_t entry, void* entry_arg,
                             "thread creation failed with %d", rc);
   }
 
-  if (params.priority_class != IREE_THREAD_PRIORITY_CLASS_NORMAL) {
+  if (params.scheduling_policy != IREE_THREAD_SCHEDULING_POLICY_DEFAULT) {
+    iree_thread_set_scheduling_policy(thread, params.scheduling_policy,
+                                      params.priority_class);
+  } else if (params.priority_class != IREE_THREAD_PRIORITY_CLASS_NORMAL) {
     iree_thread_set_priority_class(thread, params.priority_class);
   }
   if (params.initial_affinity.specified) {
@@ -296,6 +302,47 @@ static void iree_thread_set_priority_class(
   IREE_TRACE_ZONE_END(z0);
 }
 
+// Sets the thread scheduling policy to |scheduling_policy| with the priority
+// derived from |priority_class|. Priority class overrides made afterward keep
+// the policy and only change the priority within it.
+//
+// Real-time policies require CAP_SYS_NICE or a sufficient RLIMIT_RTPRIO and if
+// the request is denied we keep the default policy.
+static void iree_thread_set_scheduling_policy(
+    iree_thread_t* thread, iree_thread_scheduling_policy_t scheduling_policy,
+    iree_thread_priority_class_t priority_class) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+#if defined(IREE_PLATFORM_EMSCRIPTEN)
+  // TODO(benvanik): Some sort of solution on Emscripten, if possible
+#else
+  int policy = SCHED_OTHER;
+  switch (scheduling_policy) {
+    default:
+    case IREE_THREAD_SCHEDULING_POLICY_DEFAULT:
+      policy = SCHED_OTHER;
+      break;
+    case IREE_THREAD_SCHEDULING_POLICY_BATCH:
+#if defined(SCHED_BATCH)
+      policy = SCHED_BATCH;
+#endif  // SCHED_BATCH
+      break;
+    case IREE_THREAD_SCHEDULING_POLICY_REALTIME:
+      policy = SCHED_FIFO;
+      break;
+  }
+  struct sched_param param =
+      iree_thread_sched_param_for_priority_class(policy, priority_class);
+  int rc = pthread_setschedparam(thread->handle, policy, &param);
+  if (rc != 0) {
+    IREE_TRACE_ZONE_APPEND_TEXT(z0, "denied");
+    iree_thread_set_priority_class(thread, priority_class);
+  }
+#endif  // IREE_PLATFORM_EMSCRIPTEN
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
 iree_thread_override_t* iree_thread_priority_class_override_begin(
     iree_thread_t* thread, iree_thread_priority_class_t priority_class) {
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -34,6 +34,9 @@
 // NOTE: order matters; priorities are (kqueue|epoll) > ppoll > poll.
 // When overridden with NULL (no platform primitives) or on Win32 we always use
 // those implementations (today).
+//
+// IO_URING is opt-in as it requires Linux 5.4+ and may be disabled by the
+// kernel or a sandbox: -DIREE_WAIT_API=IREE_WAIT_API_IO_URING.
 #define IREE_WAIT_API_NULL 0
 #define IREE_WAIT_API_INPROC 1
 #define IREE_WAIT_API_WIN32 2
@@ -41,6 +44,7 @@
 #define IREE_WAIT_API_PPOLL 4
 #define IREE_WAIT_API_EPOLL 5
 #define IREE_WAIT_API_KQUEUE 6
+#define IREE_WAIT_API_IO_URING 7
 
 // We allow overriding the wait API via command line flags. If unspecified we
 // try to guess based on the target platform.
@@ -70,10 +74,11 @@
 
 // Many implementations share the same posix-like nature (file descriptors/etc)
 // and can share most of their code.
-#if (IREE_WAIT_API == IREE_WAIT_API_POLL) ||  \
-    (IREE_WAIT_API == IREE_WAIT_API_PPOLL) || \
-    (IREE_WAIT_API == IREE_WAIT_API_EPOLL) || \
-    (IREE_WAIT_API == IREE_WAIT_API_KQUEUE)
+#if (IREE_WAIT_API == IREE_WAIT_API_POLL) ||   \
+    (IREE_WAIT_API == IREE_WAIT_API_PPOLL) ||  \
+    (IREE_WAIT_API == IREE_WAIT_API_EPOLL) ||  \
+    (IREE_WAIT_API == IREE_WAIT_API_KQUEUE) || \
+    (IREE_WAIT_API == IREE_WAIT_API_IO_URING)
 #define IREE_WAIT_API_POSIX_LIKE 1
 #endif  // IREE_WAIT_API = posix-like
 
@@ -0,0 +1,674 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// NOTE: must be first to ensure that we can define settings for all includes.
+#include "iree/base/internal/wait_handle_impl.h"
+
+#if IREE_WAIT_API == IREE_WAIT_API_IO_URING
+
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/math.h"
+#include "iree/base/internal/wait_handle_posix.h"
+#include "iree/base/tracing.h"
+
+//===----------------------------------------------------------------------===//
+// Platform utilities
+//===----------------------------------------------------------------------===//
+
+// We use the raw syscalls instead of liburing to avoid the dependency; we only
+// need a tiny subset of what it provides (poll add/remove and timeouts).
+//
+// Documentation: https://kernel.dk/io_uring.pdf
+//                https://man7.org/linux/man-pages/man7/io_uring.7.html
+
+static int iree_syscall_io_uring_setup(unsigned entries,
+                                       struct io_uring_params* params) {
+  return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int iree_syscall_io_uring_enter(int fd, unsigned to_submit,
+                                       unsigned min_complete, unsigned flags) {
+  return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete, flags,
+                      NULL, 0);
+}
+
+// Matches struct __kernel_timespec, which not all linux/io_uring.h versions
+// pull in.
+typedef struct iree_io_uring_timespec_t {
+  int64_t tv_sec;
+  long long tv_nsec;
+} iree_io_uring_timespec_t;
+
+// Kinds of submissions encoded in the top bits of their user_data.
+// Completions of kinds we don't care about (removals) are ignored.
+#define IREE_IO_URING_USER_DATA_KIND_IGNORED 0ull
+#define IREE_IO_URING_USER_DATA_KIND_POLL 1ull
+#define IREE_IO_URING_USER_DATA_KIND_TIMEOUT 2ull
+
+// Encodes |kind| and the |generation| of |slot| such that completions of
+// operations on slots that have since been erased or reused can be detected.
+static inline uint64_t iree_io_uring_make_user_data(uint64_t kind,
+                                                    uint32_t generation,
+                                                    uint16_t slot) {
+  return (kind << 62) | ((uint64_t)generation << 16) | slot;
+}
+
+//===----------------------------------------------------------------------===//
+// iree_wait_set_t
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_wait_set_slot_t {
+  // User-provided handle; only valid when in_use is set.
+  iree_wait_handle_t handle;
+  // Incremented each time the slot is erased so that completions of polls
+  // armed for prior handles can be ignored.
+  uint32_t generation;
+  // fd polled for the handle or -1 if the handle is never signaled.
+  int fd;
+  // True if the slot holds a user handle.
+  uint8_t in_use : 1;
+  // True if a poll has been queued and has not yet completed.
+  uint8_t armed : 1;
+  // True if the poll completed and |result| holds the result.
+  uint8_t signaled : 1;
+  // Result of the last completed poll; revents or -errno.
+  int32_t result;
+} iree_wait_set_slot_t;
+
+// A wait set backed by an io_uring instance.
+// Unlike poll/ppoll, where every wait hands the full list of fds to the kernel
+// and the kernel registers and unregisters with each of them, polls remain
+// armed in the ring across waits. A wait only needs to submit polls for
+// handles that were inserted or signaled since the last wait along with any
+// removals of erased handles, all within the same io_uring_enter call that
+// blocks for completions.
+//
+// The wait-wake-erase pattern used by the task poller then costs a single
+// syscall per wake regardless of the number of outstanding waits.
+struct iree_wait_set_t {
+  iree_allocator_t allocator;
+
+  // io_uring instance fd.
+  int ring_fd;
+
+  // Submission queue ring mapping.
+  void* sq_ptr;
+  iree_host_size_t sq_size;
+  iree_atomic_int32_t* sq_head;
+  iree_atomic_int32_t* sq_tail;
+  uint32_t* sq_array;
+  uint32_t sq_mask;
+  uint32_t sq_entries;
+  struct io_uring_sqe* sqes;
+  iree_host_size_t sqes_size;
+
+  // Completion queue ring mapping; may alias sq_ptr.
+  void* cq_ptr;
+  iree_host_size_t cq_size;
+  iree_atomic_int32_t* cq_head;
+  iree_atomic_int32_t* cq_tail;
+  uint32_t cq_mask;
+  struct io_uring_cqe* cqes;
+
+  // Local copy of the submission queue tail; published to sq_tail on flush.
+  uint32_t sq_local_tail;
+
+  // Deadline of the currently armed timeout (if timeout_armed).
+  iree_time_t timeout_deadline_ns;
+  uint32_t timeout_generation;
+  bool timeout_armed;
+  // Relative timeout referenced by the last timeout submission.
+  iree_io_uring_timespec_t timeout_ts;
+
+  // Total capacity of the slot list.
+  iree_host_size_t handle_capacity;
+  // Total number of slots in use.
+  iree_host_size_t handle_count;
+  // Slots for each handle; unordered with holes from erasures.
+  iree_wait_set_slot_t* slots;
+};
+
+static void iree_wait_set_unmap(iree_wait_set_t* set) {
+  if (set->sqes) munmap(set->sqes, set->sqes_size);
+  if (set->cq_ptr && set->cq_ptr != set->sq_ptr) {
+    munmap(set->cq_ptr, set->cq_size);
+  }
+  if (set->sq_ptr) munmap(set->sq_ptr, set->sq_size);
+  if (set->ring_fd >= 0) close(set->ring_fd);
+}
+
+static iree_status_t iree_wait_set_map(iree_wait_set_t* set,
+                                       uint32_t entries) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  set->ring_fd = iree_syscall_io_uring_setup(entries, &params);
+  if (set->ring_fd < 0) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "io_uring_setup failed (%d); the kernel may not "
+                            "support io_uring or it may be disabled",
+                            errno);
+  }
+
+  set->sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  set->cq_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    set->sq_size = set->cq_size = iree_max(set->sq_size, set->cq_size);
+  }
+  set->sq_ptr = mmap(NULL, set->sq_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, set->ring_fd,
+                     IORING_OFF_SQ_RING);
+  if (set->sq_ptr == MAP_FAILED) {
+    set->sq_ptr = NULL;
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to map io_uring submission queue");
+  }
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    set->cq_ptr = set->sq_ptr;
+  } else {
+    set->cq_ptr = mmap(NULL, set->cq_size, PROT_READ | PROT_WRITE,
+                       MAP_SHARED | MAP_POPULATE, set->ring_fd,
+                       IORING_OFF_CQ_RING);
+    if (set->cq_ptr == MAP_FAILED) {
+      set->cq_ptr = NULL;
+      return iree_make_status(iree_status_code_from_errno(errno),
+                              "failed to map io_uring completion queue");
+    }
+  }
+  set->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  set->sqes = (struct io_uring_sqe*)mmap(
+      NULL, set->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      set->ring_fd, IORING_OFF_SQES);
+  if (set->sqes == MAP_FAILED) {
+    set->sqes = NULL;
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to map io_uring submission entries");
+  }
+
+  uint8_t* sq_base = (uint8_t*)set->sq_ptr;
+  set->sq_head = (iree_atomic_int32_t*)(sq_base + params.sq_off.head);
+  set->sq_tail = (iree_atomic_int32_t*)(sq_base + params.sq_off.tail);
+  set->sq_array = (uint32_t*)(sq_base + params.sq_off.array);
+  set->sq_mask = *(uint32_t*)(sq_base + params.sq_off.ring_mask);
+  set->sq_entries = params.sq_entries;
+  set->sq_local_tail =
+      (uint32_t)iree_atomic_load_int32(set->sq_tail, iree_memory_order_relaxed);
+
+  uint8_t* cq_base = (uint8_t*)set->cq_ptr;
+  set->cq_head = (iree_atomic_int32_t*)(cq_base + params.cq_off.head);
+  set->cq_tail = (iree_atomic_int32_t*)(cq_base + params.cq_off.tail);
+  set->cq_mask = *(uint32_t*)(cq_base + params.cq_off.ring_mask);
+  set->cqes = (struct io_uring_cqe*)(cq_base + params.cq_off.cqes);
+
+  return iree_ok_status();
+}
+
+// Returns the number of submissions queued but not yet consumed by the kernel.
+static uint32_t iree_wait_set_pending_submission_count(iree_wait_set_t* set) {
+  return set->sq_local_tail - (uint32_t)iree_atomic_load_int32(
+                                  set->sq_head, iree_memory_order_acquire);
+}
+
+// Processes a single completion by updating the state of the slot or timeout
+// that it references. Completions for erased slots or replaced timeouts are
+// ignored.
+static void iree_wait_set_process_completion(iree_wait_set_t* set,
+                                             const struct io_uring_cqe* cqe) {
+  uint64_t kind = cqe->user_data >> 62;
+  uint32_t generation = (uint32_t)(cqe->user_data >> 16);
+  uint16_t slot_index = (uint16_t)cqe->user_data;
+  if (kind == IREE_IO_URING_USER_DATA_KIND_POLL) {
+    if (slot_index >= set->handle_capacity) return;
+    iree_wait_set_slot_t* slot = &set->slots[slot_index];
+    if (!slot->in_use || !slot->armed || slot->generation != generation) {
+      return;  // stale
+    }
+    slot->armed = 0;
+    slot->signaled = 1;
+    slot->result = cqe->res;
+  } else if (kind == IREE_IO_URING_USER_DATA_KIND_TIMEOUT) {
+    if (set->timeout_armed && set->timeout_generation == generation) {
+      set->timeout_armed = false;
+    }
+  }
+}
+
+// Processes all available completions without blocking.
+static void iree_wait_set_reap_completions(iree_wait_set_t* set) {
+  uint32_t head =
+      (uint32_t)iree_atomic_load_int32(set->cq_head, iree_memory_order_relaxed);
+  uint32_t tail =
+      (uint32_t)iree_atomic_load_int32(set->cq_tail, iree_memory_order_acquire);
+  if (head == tail) return;
+  for (; head != tail; ++head) {
+    iree_wait_set_process_completion(set, &set->cqes[head & set->cq_mask]);
+  }
+  iree_atomic_store_int32(set->cq_head, (int32_t)head,
+                          iree_memory_order_release);
+}
+
+// Publishes all queued submissions and enters the kernel to submit them and
+// optionally wait for |min_complete| completions.
+static iree_status_t iree_wait_set_enter(iree_wait_set_t* set,
+                                         uint32_t min_complete) {
+  iree_atomic_store_int32(set->sq_tail, (int32_t)set->sq_local_tail,
+                          iree_memory_order_release);
+  unsigned flags = min_complete > 0 ? IORING_ENTER_GETEVENTS : 0;
+  int rv = -1;
+  do {
+    rv = iree_syscall_io_uring_enter(
+        set->ring_fd, iree_wait_set_pending_submission_count(set),
+        min_complete, flags);
+    if (rv < 0 && errno == EBUSY) {
+      // Completion queue is backlogged; drain it and try again.
+      iree_wait_set_reap_completions(set);
+      continue;
+    }
+  } while (rv < 0 && (errno == EINTR || errno == EBUSY));
+  if (IREE_UNLIKELY(rv < 0)) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "io_uring_enter failure %d", errno);
+  }
+  iree_wait_set_reap_completions(set);
+  return iree_ok_status();
+}
+
+// Returns a zeroed submission queue entry that will be submitted on the next
+// enter. Flushes the queue if it is full.
+static iree_status_t iree_wait_set_get_sqe(iree_wait_set_t* set,
+                                           struct io_uring_sqe** out_sqe) {
+  if (iree_wait_set_pending_submission_count(set) >= set->sq_entries) {
+    IREE_RETURN_IF_ERROR(iree_wait_set_enter(set, /*min_complete=*/0));
+  }
+  uint32_t index = set->sq_local_tail & set->sq_mask;
+  struct io_uring_sqe* sqe = &set->sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  set->sq_array[index] = index;
+  ++set->sq_local_tail;
+  *out_sqe = sqe;
+  return iree_ok_status();
+}
+
+// Queues a removal of the submission with |user_data| using |opcode|
+// (IORING_OP_POLL_REMOVE or IORING_OP_TIMEOUT_REMOVE).
+static void iree_wait_set_queue_remove(iree_wait_set_t* set, uint8_t opcode,
+                                       uint64_t user_data) {
+  struct io_uring_sqe* sqe = NULL;
+  iree_status_t status = iree_wait_set_get_sqe(set, &sqe);
+  if (!iree_status_is_ok(status)) {
+    // Removal is best-effort: the stale completion will be ignored when it
+    // arrives and the ring releases any outstanding operations when closed.
+    iree_status_ignore(status);
+    return;
+  }
+  sqe->opcode = opcode;
+  sqe->fd = -1;
+  sqe->addr = user_data;
+  sqe->user_data = iree_io_uring_make_user_data(
+      IREE_IO_URING_USER_DATA_KIND_IGNORED, 0, 0);
+}
+
+// Queues a poll for any slot that is in use and not armed or signaled.
+static iree_status_t iree_wait_set_arm_slots(iree_wait_set_t* set) {
+  for (iree_host_size_t i = 0; i < set->handle_capacity; ++i) {
+    iree_wait_set_slot_t* slot = &set->slots[i];
+    if (!slot->in_use || slot->armed || slot->signaled || slot->fd < 0) {
+      continue;
+    }
+    struct io_uring_sqe* sqe = NULL;
+    IREE_RETURN_IF_ERROR(iree_wait_set_get_sqe(set, &sqe));
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = slot->fd;
+    sqe->poll_events = POLLIN | POLLPRI;  // implicit POLLERR | POLLHUP
+    sqe->user_data = iree_io_uring_make_user_data(
+        IREE_IO_URING_USER_DATA_KIND_POLL, slot->generation, (uint16_t)i);
+    slot->armed = 1;
+  }
+  return iree_ok_status();
+}
+
+// Queues a timeout for |deadline_ns| if one is not already armed for it,
+// replacing any previous timeout. IREE_TIME_INFINITE_FUTURE only removes the
+// previous timeout.
+static iree_status_t iree_wait_set_arm_timeout(iree_wait_set_t* set,
+                                               iree_time_t deadline_ns) {
+  if (set->timeout_armed && set->timeout_deadline_ns == deadline_ns) {
+    return iree_ok_status();
+  }
+  if (set->timeout_armed) {
+    iree_wait_set_queue_remove(
+        set, IORING_OP_TIMEOUT_REMOVE,
+        iree_io_uring_make_user_data(IREE_IO_URING_USER_DATA_KIND_TIMEOUT,
+                                     set->timeout_generation, 0));
+    set->timeout_armed = false;
+  }
+  if (deadline_ns == IREE_TIME_INFINITE_FUTURE) return iree_ok_status();
+
+  iree_duration_t timeout_ns = iree_max(0, deadline_ns - iree_time_now());
+  set->timeout_ts.tv_sec = (int64_t)(timeout_ns / 1000000000ull);
+  set->timeout_ts.tv_nsec = (long long)(timeout_ns % 1000000000ull);
+  struct io_uring_sqe* sqe = NULL;
+  IREE_RETURN_IF_ERROR(iree_wait_set_get_sqe(set, &sqe));
+  sqe->opcode = IORING_OP_TIMEOUT;
+  sqe->fd = -1;
+  sqe->addr = (uint64_t)(uintptr_t)&set->timeout_ts;
+  sqe->len = 1;
+  sqe->off = 0;  // pure timeout; not counting completions
+  sqe->user_data = iree_io_uring_make_user_data(
+      IREE_IO_URING_USER_DATA_KIND_TIMEOUT, ++set->timeout_generation, 0);
+  set->timeout_deadline_ns = deadline_ns;
+  set->timeout_armed = true;
+  return iree_ok_status();
+}
+
+iree_status_t iree_wait_set_allocate(iree_host_size_t capacity,
+                                     iree_allocator_t allocator,
+                                     iree_wait_set_t** out_set) {
+  IREE_ASSERT_ARGUMENT(out_set);
+
+  // Slot indices are stored in the 16-bit set_internal.index and user_data.
+  if (capacity >= UINT16_MAX) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "wait set capacity of %zu is unreasonably large",
+                            capacity);
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_host_size_t slot_list_size = capacity * sizeof(iree_wait_set_slot_t);
+  iree_host_size_t total_size =
+      iree_sizeof_struct(iree_wait_set_t) + slot_list_size;
+
+  iree_wait_set_t* set = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(allocator, total_size, (void**)&set));
+  set->allocator = allocator;
+  set->ring_fd = -1;
+  set->handle_capacity = capacity;
+  set->slots =
+      (iree_wait_set_slot_t*)((uint8_t*)set +
+                              iree_sizeof_struct(iree_wait_set_t));
+
+  // Each slot may have both a poll and a poll removal in flight along with
+  // the current timeout and its removal.
+  uint32_t entries = (uint32_t)iree_math_round_up_to_pow2_u32(
+      (uint32_t)(capacity * 2 + 4));
+  iree_status_t status = iree_wait_set_map(set, entries);
+
+  if (iree_status_is_ok(status)) {
+    *out_set = set;
+  } else {
+    iree_wait_set_free(set);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_wait_set_free(iree_wait_set_t* set) {
+  if (!set) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  // Closing the ring cancels all outstanding polls and timeouts.
+  iree_wait_set_unmap(set);
+  iree_allocator_free(set->allocator, set);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+bool iree_wait_set_is_empty(const iree_wait_set_t* set) {
+  return set->handle_count == 0;
+}
+
+iree_status_t iree_wait_set_insert(iree_wait_set_t* set,
+                                   iree_wait_handle_t handle) {
+  if (set->handle_count + 1 > set->handle_capacity) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "wait set capacity reached");
+  }
+
+  iree_wait_set_slot_t* slot = NULL;
+  for (iree_host_size_t i = 0; i < set->handle_capacity; ++i) {
+    if (!set->slots[i].in_use) {
+      slot = &set->slots[i];
+      break;
+    }
+  }
+  ++set->handle_count;
+
+  iree_wait_handle_wrap_primitive(handle.type, handle.value, &slot->handle);
+  slot->fd = iree_wait_primitive_get_read_fd(&handle);
+  slot->in_use = 1;
+  slot->armed = 0;
+  slot->signaled = 0;
+  slot->result = 0;
+
+  // The poll is armed on the next wait so that insertions are batched with
+  // the wait itself.
+  return iree_ok_status();
+}
+
+// Erases the handle in |slot| and cancels its outstanding poll, if any.
+static void iree_wait_set_erase_slot(iree_wait_set_t* set,
+                                     iree_wait_set_slot_t* slot) {
+  if (slot->armed) {
+    iree_wait_set_queue_remove(
+        set, IORING_OP_POLL_REMOVE,
+        iree_io_uring_make_user_data(IREE_IO_URING_USER_DATA_KIND_POLL,
+                                     slot->generation,
+                                     (uint16_t)(slot - set->slots)));
+  }
+  ++slot->generation;
+  slot->in_use = 0;
+  slot->armed = 0;
+  slot->signaled = 0;
+  --set->handle_count;
+}
+
+void iree_wait_set_erase(iree_wait_set_t* set, iree_wait_handle_t handle) {
+  // Find the slot of the handle. If valid we can use the slot index set after
+  // an iree_wait_any wake to avoid the scan.
+  iree_host_size_t index = handle.set_internal.index;
+  if (IREE_UNLIKELY(index >= set->handle_capacity) ||
+      IREE_UNLIKELY(!set->slots[index].in_use) ||
+      IREE_UNLIKELY(!iree_wait_primitive_compare_identical(
+          &set->slots[index].handle, &handle))) {
+    index = set->handle_capacity;
+    for (iree_host_size_t i = 0; i < set->handle_capacity; ++i) {
+      if (set->slots[i].in_use && iree_wait_primitive_compare_identical(
+                                      &set->slots[i].handle, &handle)) {
+        index = i;
+        break;
+      }
+    }
+    if (index == set->handle_capacity) return;  // not found
+  }
+  iree_wait_set_erase_slot(set, &set->slots[index]);
+}
+
+void iree_wait_set_clear(iree_wait_set_t* set) {
+  for (iree_host_size_t i = 0; i < set->handle_capacity; ++i) {
+    if (set->slots[i].in_use) iree_wait_set_erase_slot(set, &set->slots[i]);
+  }
+}
+
+// Maps a poll completion result to a status (on failure) and an indicator of
+// whether the event was signaled.
+static iree_status_t iree_wait_set_resolve_poll_result(int32_t result,
+                                                       bool* out_signaled) {
+  *out_signaled = false;
+  if (result < 0) {
+    return iree_make_status(iree_status_code_from_errno(-result),
+                            "io_uring poll failure %d", -result);
+  } else if (result & POLLERR) {
+    return iree_make_status(IREE_STATUS_INTERNAL, "POLLERR on fd");
+  } else if (result & POLLHUP) {
+    return iree_make_status(IREE_STATUS_CANCELLED, "POLLHUP on fd");
+  } else if (result & POLLNVAL) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT, "POLLNVAL on fd");
+  }
+  *out_signaled = (result & POLLIN) != 0;
+  return iree_ok_status();
+}
+
+// Checks the signaled slots and returns whether the wait is satisfied: any
+// valid slot signaled for wait-any or all valid slots signaled for wait-all.
+// Returns the first signaled slot in |out_slot| for wait-any.
+static iree_status_t iree_wait_set_check_signaled(
+    iree_wait_set_t* set, bool wait_all, bool* out_satisfied,
+    iree_wait_set_slot_t** out_slot) {
+  *out_satisfied = false;
+  *out_slot = NULL;
+  iree_host_size_t signaled_count = 0;
+  iree_host_size_t valid_count = 0;
+  for (iree_host_size_t i = 0; i < set->handle_capacity; ++i) {
+    iree_wait_set_slot_t* slot = &set->slots[i];
+    if (!slot->in_use || slot->fd < 0) continue;
+    ++valid_count;
+    if (!slot->signaled) continue;
+    bool signaled = false;
+    IREE_RETURN_IF_ERROR(
+        iree_wait_set_resolve_poll_result(slot->result, &signaled));
+    if (!signaled) {
+      // Woke without data (POLLPRI only/etc); poll again.
+      slot->signaled = 0;
+      continue;
+    }
+    ++signaled_count;
+    if (!wait_all) {
+      *out_satisfied = true;
+      *out_slot = slot;
+      return iree_ok_status();
+    }
+  }
+  *out_satisfied = wait_all && signaled_count == valid_count;
+  return iree_ok_status();
+}
+
+// Waits until any or all (|wait_all|) handles in the set are signaled or
+// |deadline_ns| elapses.
+static iree_status_t iree_wait_set_wait(iree_wait_set_t* set, bool wait_all,
+                                        iree_time_t deadline_ns,
+                                        iree_wait_set_slot_t** out_slot) {
+  // Handles signaled in prior waits may have since been reset; drop their
+  // results so that they are polled again.
+  for (iree_host_size_t i = 0; i < set->handle_capacity; ++i) {
+    set->slots[i].signaled = 0;
+  }
+
+  bool has_entered = false;
+  while (true) {
+    // Pick up any completions that arrived since the last enter and check if
+    // they satisfy the wait. Polls on handles that are already signaled
+    // complete during submission so the first enter is required even if the
+    // deadline has elapsed.
+    bool satisfied = false;
+    IREE_RETURN_IF_ERROR(
+        iree_wait_set_check_signaled(set, wait_all, &satisfied, out_slot));
+    if (satisfied) return iree_ok_status();
+    if (has_entered && (deadline_ns == IREE_TIME_INFINITE_PAST ||
+                        iree_time_now() >= deadline_ns)) {
+      return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+    }
+
+    IREE_RETURN_IF_ERROR(iree_wait_set_arm_slots(set));
+    if (deadline_ns == IREE_TIME_INFINITE_PAST ||
+        (has_entered && deadline_ns <= iree_time_now())) {
+      // Just submit and check the results.
+      IREE_RETURN_IF_ERROR(iree_wait_set_enter(set, /*min_complete=*/0));
+    } else {
+      IREE_RETURN_IF_ERROR(iree_wait_set_arm_timeout(set, deadline_ns));
+      IREE_RETURN_IF_ERROR(iree_wait_set_enter(set, /*min_complete=*/1));
+    }
+    has_entered = true;
+  }
+}
+
+iree_status_t iree_wait_all(iree_wait_set_t* set, iree_time_t deadline_ns) {
+  // Make the syscall only when we have at least one valid fd.
+  // Don't use this as a sleep.
+  if (set->handle_count <= 0) {
+    return iree_ok_status();
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_wait_set_slot_t* slot = NULL;
+  iree_status_t status =
+      iree_wait_set_wait(set, /*wait_all=*/true, deadline_ns, &slot);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_wait_any(iree_wait_set_t* set, iree_time_t deadline_ns,
+                            iree_wait_handle_t* out_wake_handle) {
+  // Make the syscall only when we have at least one valid fd.
+  // Don't use this as a sleep.
+  memset(out_wake_handle, 0, sizeof(*out_wake_handle));
+  if (set->handle_count <= 0) {
+    return iree_ok_status();
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_wait_set_slot_t* slot = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_wait_set_wait(set, /*wait_all=*/false, deadline_ns, &slot));
+  if (slot) {
+    memcpy(out_wake_handle, &slot->handle, sizeof(*out_wake_handle));
+    out_wake_handle->set_internal.index = (uint16_t)(slot - set->slots);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+iree_status_t iree_wait_one(iree_wait_handle_t* handle,
+                            iree_time_t deadline_ns) {
+  struct pollfd poll_fd;
+  poll_fd.fd = iree_wait_primitive_get_read_fd(handle);
+  if (poll_fd.fd == -1) return iree_ok_status();
+  poll_fd.events = POLLIN;
+  poll_fd.revents = 0;
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Single-handle waits don't benefit from a ring (setting one up costs more
+  // than the wait) and ppoll gets the job done in one syscall.
+  int rv = -1;
+  do {
+    struct timespec timeout_ts;
+    struct timespec* tmo_p = &timeout_ts;
+    if (deadline_ns == IREE_TIME_INFINITE_PAST) {
+      memset(&timeout_ts, 0, sizeof(timeout_ts));
+    } else if (deadline_ns == IREE_TIME_INFINITE_FUTURE) {
+      tmo_p = NULL;
+    } else {
+      iree_duration_t timeout_ns = iree_max(0, deadline_ns - iree_time_now());
+      timeout_ts.tv_sec = (time_t)(timeout_ns / 1000000000ull);
+      timeout_ts.tv_nsec = (long)(timeout_ns % 1000000000ull);
+    }
+    rv = ppoll(&poll_fd, 1, tmo_p, NULL);
+  } while (rv < 0 && errno == EINTR);
+
+  iree_status_t status = iree_ok_status();
+  if (rv < 0) {
+    status = iree_make_status(iree_status_code_from_errno(errno),
+                              "ppoll failure %d", errno);
+  } else if (rv == 0) {
+    status = iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+#endif  // IREE_WAIT_API == IREE_WAIT_API_IO_URING
@@ -19,6 +19,8 @@
 #include "iree/base/alignment.h"
 #include "iree/base/allocator.h"
 #include "iree/base/assert.h"
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/math.h"
 #include "iree/base/target_platform.h"
 #include "iree/base/tracing.h"
 
@@ -62,6 +64,147 @@ static inline void iree_aligned_free(void* p) {
 }
 #endif  // IREE_PLATFORM_WINDOWS
 
+//===----------------------------------------------------------------------===//
+// Preallocated status storage pool
+//===----------------------------------------------------------------------===//
+
+#if IREE_STATUS_FEATURES != 0
+
+// Total number of preallocated slots used for status storage and annotation
+// payloads. Set to 0 to always allocate from the system.
+//
+// Some code uses failing statuses for control flow (probing, retries, etc) and
+// the cost of a round-trip through the system allocator on each status can
+// dominate. Slots are shared by all threads as statuses commonly move between
+// threads and outlive the thread that produced them.
+#if !defined(IREE_STATUS_POOL_CAPACITY)
+#define IREE_STATUS_POOL_CAPACITY 64
+#endif  // !IREE_STATUS_POOL_CAPACITY
+
+// Size in bytes of each preallocated slot. Storage or payloads (including any
+// formatted message) larger than this are allocated from the system.
+#if !defined(IREE_STATUS_POOL_SLOT_SIZE)
+#define IREE_STATUS_POOL_SLOT_SIZE 256
+#endif  // !IREE_STATUS_POOL_SLOT_SIZE
+
+// Storage is aligned such that the code can be packed in the lower bits of the
+// pointer.
+#define IREE_STATUS_STORAGE_ALIGNMENT (IREE_STATUS_CODE_MASK + 1)
+
+#if IREE_STATUS_POOL_CAPACITY > 64
+#error "IREE_STATUS_POOL_CAPACITY is limited to the 64 slots in the used mask"
+#endif  // IREE_STATUS_POOL_CAPACITY > 64
+#if (IREE_STATUS_POOL_SLOT_SIZE % IREE_STATUS_STORAGE_ALIGNMENT) != 0
+#error "IREE_STATUS_POOL_SLOT_SIZE must be a multiple of the storage alignment"
+#endif  // IREE_STATUS_POOL_SLOT_SIZE % IREE_STATUS_STORAGE_ALIGNMENT
+
+#if IREE_STATUS_POOL_CAPACITY > 0
+
+#if IREE_STATUS_POOL_CAPACITY == 64
+#define IREE_STATUS_POOL_ALL_SLOTS_MASK UINT64_MAX
+#else
+#define IREE_STATUS_POOL_ALL_SLOTS_MASK \
+  ((UINT64_C(1) << IREE_STATUS_POOL_CAPACITY) - 1)
+#endif  // IREE_STATUS_POOL_CAPACITY == 64
+
+typedef struct iree_status_pool_t {
+  // Bit i is set when slots[i] is in use.
+  iree_atomic_int64_t used_mask;
+  iree_alignas(64) uint8_t slots[IREE_STATUS_POOL_CAPACITY]
+                                [IREE_STATUS_POOL_SLOT_SIZE];
+} iree_status_pool_t;
+
+// Zero-initialized (all slots free) at load time so that statuses can be
+// created before (and during) any other initialization.
+static iree_status_pool_t iree_status_pool;
+
+#endif  // IREE_STATUS_POOL_CAPACITY > 0
+
+// Allocates |size| bytes aligned to IREE_STATUS_STORAGE_ALIGNMENT from the
+// pool if a slot is available and otherwise from the system.
+//
+// Note that we are using the CRT allocation function here, as we can't trust
+// our allocator system to work when we are throwing errors (as we may be
+// allocating this error from a failed allocation!).
+static void* iree_status_pool_alloc(iree_host_size_t size) {
+#if IREE_STATUS_POOL_CAPACITY > 0
+  if (size <= IREE_STATUS_POOL_SLOT_SIZE) {
+    int64_t used_mask = iree_atomic_load_int64(&iree_status_pool.used_mask,
+                                               iree_memory_order_relaxed);
+    uint64_t free_mask =
+        ~(uint64_t)used_mask & IREE_STATUS_POOL_ALL_SLOTS_MASK;
+    while (free_mask) {
+      int slot = iree_math_count_trailing_zeros_u64(free_mask);
+      if (iree_atomic_compare_exchange_weak_int64(
+              &iree_status_pool.used_mask, &used_mask,
+              (int64_t)((uint64_t)used_mask | (UINT64_C(1) << slot)),
+              iree_memory_order_acquire, iree_memory_order_relaxed)) {
+        return iree_status_pool.slots[slot];
+      }
+      free_mask = ~(uint64_t)used_mask & IREE_STATUS_POOL_ALL_SLOTS_MASK;
+    }
+  }
+#endif  // IREE_STATUS_POOL_CAPACITY > 0
+  return iree_aligned_alloc(
+      IREE_STATUS_STORAGE_ALIGNMENT,
+      iree_host_align(size, IREE_STATUS_STORAGE_ALIGNMENT));
+}
+
+// Frees |ptr| allocated by iree_status_pool_alloc. May be called from any
+// thread.
+static void iree_status_pool_free(void* ptr) {
+#if IREE_STATUS_POOL_CAPACITY > 0
+  uintptr_t offset = (uintptr_t)ptr - (uintptr_t)iree_status_pool.slots;
+  if (offset < sizeof(iree_status_pool.slots)) {
+    int slot = (int)(offset / IREE_STATUS_POOL_SLOT_SIZE);
+    iree_atomic_fetch_and_int64(&iree_status_pool.used_mask,
+                                (int64_t)~(UINT64_C(1) << slot),
+                                iree_memory_order_release);
+    return;
+  }
+#endif  // IREE_STATUS_POOL_CAPACITY > 0
+  iree_aligned_free(ptr);
+}
+
+#if IREE_STATUS_FEATURES & IREE_STATUS_FEATURE_ANNOTATIONS
+
+static iree_status_t iree_status_pool_allocator_ctl(
+    void* self, iree_allocator_command_t command, const void* params,
+    void** inout_ptr) {
+  switch (command) {
+    case IREE_ALLOCATOR_COMMAND_MALLOC:
+    case IREE_ALLOCATOR_COMMAND_CALLOC: {
+      iree_host_size_t byte_length =
+          ((const iree_allocator_alloc_params_t*)params)->byte_length;
+      void* ptr = iree_status_pool_alloc(byte_length);
+      if (IREE_UNLIKELY(!ptr)) {
+        return iree_status_from_code(IREE_STATUS_RESOURCE_EXHAUSTED);
+      }
+      if (command == IREE_ALLOCATOR_COMMAND_CALLOC) memset(ptr, 0, byte_length);
+      *inout_ptr = ptr;
+      return iree_ok_status();
+    }
+    case IREE_ALLOCATOR_COMMAND_FREE:
+      iree_status_pool_free(*inout_ptr);
+      return iree_ok_status();
+    default:
+      return iree_status_from_code(IREE_STATUS_UNIMPLEMENTED);
+  }
+}
+
+// Returns an allocator for status payloads that uses the status pool.
+static iree_allocator_t iree_status_pool_allocator(void) {
+  iree_allocator_t allocator = {
+      .self = NULL,
+      .ctl = iree_status_pool_allocator_ctl,
+  };
+  return allocator;
+}
+
+#endif  // has IREE_STATUS_FEATURE_ANNOTATIONS
+
+#endif  // has any IREE_STATUS_FEATURES
+
 //===----------------------------------------------------------------------===//
 // iree_status_t canonical errors
 //===----------------------------------------------------------------------===//
@@ -421,19 +564,13 @@ iree_status_allocate(iree_status_code_t code, const char* file, uint32_t line,
   if (IREE_UNLIKELY(code == IREE_STATUS_OK)) return iree_ok_status();
 
   // Allocate storage with the appropriate alignment such that we can pack the
-  // code in the lower bits of the pointer. Since failed statuses are rare and
-  // likely have much larger costs (like string formatting) the extra bytes for
-  // alignment are worth being able to avoid pointer dereferences and other
-  // things during the normal code paths that just check codes.
-  //
-  // Note that we are using the CRT allocation function here, as we can't trust
-  // our allocator system to work when we are throwing errors (as we may be
-  // allocating this error from a failed allocation!).
-  size_t storage_alignment = (IREE_STATUS_CODE_MASK + 1);
-  size_t storage_size =
-      iree_host_align(sizeof(iree_status_storage_t), storage_alignment);
-  iree_status_storage_t* storage = (iree_status_storage_t*)iree_aligned_alloc(
-      storage_alignment, storage_size);
+  // code in the lower bits of the pointer. The extra bytes for alignment are
+  // worth being able to avoid pointer dereferences and other things during the
+  // normal code paths that just check codes. Storage comes from the status pool
+  // when possible so that statuses used for control flow avoid the heap.
+  iree_status_storage_t* storage =
+      (iree_status_storage_t*)iree_status_pool_alloc(
+          sizeof(iree_status_storage_t));
   if (IREE_UNLIKELY(!storage)) return iree_status_from_code(code);
   memset(storage, 0, sizeof(*storage));
 
@@ -486,11 +623,9 @@ IREE_API_EXPORT IREE_MUST_USE_RESULT iree_status_t iree_status_allocate_vf(
   // Allocate storage with the additional room to store the formatted message.
   // This avoids additional allocations for the common case of a message coming
   // only from the original status error site.
-  size_t storage_alignment = (IREE_STATUS_CODE_MASK + 1);
-  size_t storage_size = iree_host_align(
-      sizeof(iree_status_storage_t) + message_size, storage_alignment);
-  iree_status_storage_t* storage = (iree_status_storage_t*)iree_aligned_alloc(
-      storage_alignment, storage_size);
+  iree_status_storage_t* storage =
+      (iree_status_storage_t*)iree_status_pool_alloc(
+          sizeof(iree_status_storage_t) + message_size);
   if (IREE_UNLIKELY(!storage)) return iree_status_from_code(code);
   memset(storage, 0, sizeof(*storage));
 
@@ -505,7 +640,7 @@ IREE_API_EXPORT IREE_MUST_USE_RESULT iree_status_t iree_status_allocate_vf(
   int ret =
       vsnprintf((char*)storage->message.data, message_size, format, varargs_1);
   if (IREE_UNLIKELY(ret < 0)) {
-    iree_aligned_free(storage);
+    iree_status_pool_free(storage);
     return (iree_status_t)code;
   }
 
@@ -554,7 +689,7 @@ IREE_API_EXPORT void iree_status_free(iree_status_t status) {
     iree_allocator_free(payload->allocator, payload);
     payload = next;
   }
-  iree_aligned_free(storage);
+  iree_status_pool_free(storage);
 #endif  // has any IREE_STATUS_FEATURES
 }
 
@@ -614,7 +749,7 @@ iree_status_annotate(iree_status_t base_status, iree_string_view_t message) {
     return base_status;
   }
 
-  iree_allocator_t allocator = iree_allocator_system();
+  iree_allocator_t allocator = iree_status_pool_allocator();
   iree_status_payload_message_t* payload = NULL;
   iree_status_ignore(
       iree_allocator_malloc(allocator, sizeof(*payload), (void**)&payload));
@@ -651,7 +786,7 @@ IREE_MUST_USE_RESULT static iree_status_t iree_status_annotate_vf(
   // Allocate storage with the additional room to store the formatted message.
   // This avoids additional allocations for the common case of a message coming
   // only from the original status error site.
-  iree_allocator_t allocator = iree_allocator_system();
+  iree_allocator_t allocator = iree_status_pool_allocator();
   iree_status_payload_message_t* payload = NULL;
   iree_status_ignore(iree_allocator_malloc(
       allocator, sizeof(*payload) + message_size, (void**)&payload));
@@ -668,7 +803,7 @@ IREE_MUST_USE_RESULT static iree_status_t iree_status_annotate_vf(
   int ret = vsnprintf((char*)payload->message.data, payload->message.size + 1,
                       format, varargs_1);
   if (IREE_UNLIKELY(ret < 0)) {
-    iree_aligned_free(payload);
+    iree_allocator_free(allocator, payload);
     return base_status;
   }
   return iree_status_append_payload(base_status, storage,
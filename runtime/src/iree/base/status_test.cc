@@ -6,8 +6,10 @@
 
 #include <ostream>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "iree/base/api.h"
 #include "iree/base/status_cc.h"
@@ -98,5 +100,40 @@ TEST(StatusMacro, AssignOrReturn) {
   IREE_EXPECT_OK(assignOrReturn("foo"));
 }
 
+// Creates more statuses than fit in the preallocated pool (and ones too large
+// for a pool slot) to ensure storage falls back to the system allocator.
+TEST(StatusStorage, PoolExhaustion) {
+  std::vector<Status> statuses;
+  for (int i = 0; i < 256; ++i) {
+    statuses.push_back(
+        iree_make_status(IREE_STATUS_NOT_FOUND, "status %d", i));
+  }
+  statuses.push_back(iree_make_status(IREE_STATUS_NOT_FOUND, "%0512d", 7));
+  for (int i = 0; i < 256; ++i) {
+    EXPECT_THAT(statuses[i], StatusIs(StatusCode::kNotFound));
+    CHECK_STATUS_MESSAGE(statuses[i], "status " + std::to_string(i));
+  }
+  CHECK_STATUS_MESSAGE(statuses.back(), std::string(511, '0') + "7");
+}
+
+// Statuses are often freed on a different thread than they were created on.
+TEST(StatusStorage, CrossThreadFree) {
+  std::vector<iree_status_t> statuses(128);
+  std::thread producer([&]() {
+    for (auto& status : statuses) {
+      status = iree_status_annotate(iree_make_status(IREE_STATUS_CANCELLED),
+                                    iree_make_cstring_view("annotation"));
+    }
+  });
+  producer.join();
+  std::thread consumer([&]() {
+    for (auto status : statuses) {
+      EXPECT_TRUE(iree_status_is_cancelled(status));
+      iree_status_free(status);
+    }
+  });
+  consumer.join();
+}
+
 }  // namespace
 }  // namespace iree
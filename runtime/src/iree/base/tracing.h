@@ -90,6 +90,23 @@
 #define IREE_TRACING_MAX_CALLSTACK_DEPTH 16
 #endif  // IREE_TRACING_MAX_CALLSTACK_DEPTH
 
+//===----------------------------------------------------------------------===//
+// IREE_TRACING_PROVIDER selection
+//===----------------------------------------------------------------------===//
+
+// Streams all events to the Tracy profiler. Supports all tracing features.
+#define IREE_TRACING_PROVIDER_TRACY 1
+
+// Records zones into bounded per-thread ring buffers that can be dumped on
+// demand as a JSON trace (see iree/base/tracing_ring.h). Only supports
+// IREE_TRACING_FEATURE_INSTRUMENTATION and is cheap enough to leave enabled in
+// production deployments.
+#define IREE_TRACING_PROVIDER_RING 2
+
+#if !defined(IREE_TRACING_PROVIDER)
+#define IREE_TRACING_PROVIDER IREE_TRACING_PROVIDER_TRACY
+#endif  // !IREE_TRACING_PROVIDER
+
 //===----------------------------------------------------------------------===//
 // IREE_TRACING_MODE simple setting
 //===----------------------------------------------------------------------===//
@@ -102,8 +119,16 @@
 // IREE_TRACING_MODE = 2: same as 1 with added allocation tracking
 // IREE_TRACING_MODE = 3: same as 2 with callstacks for allocations
 // IREE_TRACING_MODE = 4: same as 3 with callstacks for all instrumentation
+//
+// The ring provider only records instrumentation and ignores the mode level.
 #if !defined(IREE_TRACING_FEATURES)
-#if defined(IREE_TRACING_MODE) && IREE_TRACING_MODE == 1
+#if IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_RING
+#if defined(IREE_TRACING_MODE) && IREE_TRACING_MODE >= 1
+#define IREE_TRACING_FEATURES IREE_TRACING_FEATURE_INSTRUMENTATION
+#else
+#define IREE_TRACING_FEATURES 0
+#endif  // IREE_TRACING_MODE
+#elif defined(IREE_TRACING_MODE) && IREE_TRACING_MODE == 1
 #define IREE_TRACING_FEATURES \
   (IREE_TRACING_FEATURE_INSTRUMENTATION | IREE_TRACING_FEATURE_LOG_MESSAGES)
 #undef IREE_TRACING_MAX_CALLSTACK_DEPTH
@@ -133,13 +158,19 @@
 #endif  // IREE_TRACING_MODE
 #endif  // !IREE_TRACING_FEATURES
 
+#if (IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_RING) && \
+    (IREE_TRACING_FEATURES & ~IREE_TRACING_FEATURE_INSTRUMENTATION)
+#error "the ring tracing provider only supports instrumentation"
+#endif  // IREE_TRACING_PROVIDER_RING
+
 //===----------------------------------------------------------------------===//
 // Tracy configuration
 //===----------------------------------------------------------------------===//
 // NOTE: order matters here as we are including files that require/define.
 
 // Enable Tracy only when we are using tracing features.
-#if IREE_TRACING_FEATURES != 0
+#if (IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_TRACY) && \
+    (IREE_TRACING_FEATURES != 0)
 #define TRACY_ENABLE 1
 #endif  // IREE_TRACING_FEATURES
 
@@ -182,7 +213,9 @@
 // overriding values set by Tracy itself.
 #if defined(TRACY_ENABLE)
 #include "third_party/tracy/TracyC.h"  // IWYU pragma: export
-#endif
+#elif IREE_TRACING_FEATURES != 0
+#include "iree/base/tracing_ring.h"  // IWYU pragma: export
+#endif  // TRACY_ENABLE
 
 // Disable callstack capture if our depth is 0; this allows us to avoid any
 // expensive capture (and all the associated dependencies) if we aren't going to
@@ -205,7 +238,7 @@ typedef uint32_t iree_zone_id_t;
 extern "C" {
 #endif  // __cplusplus
 
-#if IREE_TRACING_FEATURES
+#if defined(TRACY_ENABLE)
 
 typedef struct ___tracy_source_location_data iree_tracing_location_t;
 
@@ -240,7 +273,7 @@ void iree_tracing_mutex_after_lock(uint32_t lock_id);
 void iree_tracing_mutex_after_try_lock(uint32_t lock_id, bool was_acquired);
 void iree_tracing_mutex_after_unlock(uint32_t lock_id);
 
-#endif  // IREE_TRACING_FEATURES
+#endif  // TRACY_ENABLE
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -269,7 +302,8 @@ enum {
   IREE_TRACING_MESSAGE_LEVEL_DEBUG = 0x00FF00u,
 };
 
-#if IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+#if (IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION) && \
+    defined(TRACY_ENABLE)
 
 // Sets an application-specific payload that will be stored in the trace.
 // This can be used to fingerprint traces to particular versions and denote
@@ -414,6 +448,64 @@ enum {
 #define IREE_TRACE_IMPL_GET_VARIADIC_(args) \
   IREE_TRACE_IMPL_GET_VARIADIC_HELPER_ args
 
+#elif IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+
+// Ring provider: only zones and thread names are recorded.
+// See the Tracy variants above for documentation.
+
+#define IREE_TRACE_SET_APP_INFO(value, value_length)
+#define IREE_TRACE_SET_THREAD_NAME(name) iree_tracing_ring_set_thread_name(name)
+#define IREE_TRACE(expr) expr
+#define IREE_TRACE_FIBER_ENTER(fiber)
+#define IREE_TRACE_FIBER_LEAVE()
+
+#define IREE_TRACE_ZONE_BEGIN(zone_id) \
+  IREE_TRACE_ZONE_BEGIN_NAMED(zone_id, NULL)
+#define IREE_TRACE_ZONE_BEGIN_NAMED(zone_id, name_literal)             \
+  static const iree_tracing_location_t IREE_TRACE_IMPL_CONCAT_(        \
+      iree_tracing_ring_location_, __LINE__) = {                       \
+      name_literal, __FUNCTION__, __FILE__, (uint32_t)__LINE__, 0};    \
+  iree_zone_id_t zone_id = iree_tracing_ring_zone_begin(               \
+      &IREE_TRACE_IMPL_CONCAT_(iree_tracing_ring_location_, __LINE__), \
+      NULL, 0);
+#define IREE_TRACE_ZONE_BEGIN_NAMED_DYNAMIC(zone_id, name, name_length) \
+  static const iree_tracing_location_t IREE_TRACE_IMPL_CONCAT_(         \
+      iree_tracing_ring_location_, __LINE__) = {                        \
+      0, __FUNCTION__, __FILE__, (uint32_t)__LINE__, 0};                \
+  iree_zone_id_t zone_id = iree_tracing_ring_zone_begin(                \
+      &IREE_TRACE_IMPL_CONCAT_(iree_tracing_ring_location_, __LINE__),  \
+      (name), (name_length));
+#define IREE_TRACE_ZONE_BEGIN_EXTERNAL(                                       \
+    zone_id, file_name, file_name_length, line, function_name,                \
+    function_name_length, name, name_length)                                  \
+  iree_zone_id_t zone_id = iree_tracing_ring_zone_begin_external(             \
+      file_name, file_name_length, line, function_name, function_name_length, \
+      name, name_length)
+#define IREE_TRACE_ZONE_SET_COLOR(zone_id, color_xrgb)
+#define IREE_TRACE_ZONE_APPEND_VALUE(zone_id, value)
+#define IREE_TRACE_ZONE_APPEND_TEXT(zone_id, ...)
+#define IREE_TRACE_ZONE_APPEND_TEXT_CSTRING(zone_id, value)
+#define IREE_TRACE_ZONE_APPEND_TEXT_STRING_VIEW(zone_id, value, value_length)
+#define IREE_TRACE_ZONE_END(zone_id) iree_tracing_ring_zone_end(zone_id)
+#define IREE_RETURN_AND_END_ZONE_IF_ERROR(zone_id, ...) \
+  IREE_RETURN_AND_EVAL_IF_ERROR(IREE_TRACE_ZONE_END(zone_id), __VA_ARGS__)
+#define IREE_TRACE_SET_PLOT_TYPE(name_literal, plot_type)
+#define IREE_TRACE_PLOT_VALUE_I64(name_literal, value)
+#define IREE_TRACE_PLOT_VALUE_F32(name_literal, value)
+#define IREE_TRACE_PLOT_VALUE_F64(name_literal, value)
+#define IREE_TRACE_FRAME_MARK()
+#define IREE_TRACE_FRAME_MARK_NAMED(name_literal)
+#define IREE_TRACE_FRAME_MARK_BEGIN_NAMED(name_literal)
+#define IREE_TRACE_FRAME_MARK_END_NAMED(name_literal)
+#define IREE_TRACE_MESSAGE(level, value_literal)
+#define IREE_TRACE_MESSAGE_COLORED(color, value_literal)
+#define IREE_TRACE_MESSAGE_DYNAMIC(level, value, value_length)
+#define IREE_TRACE_MESSAGE_DYNAMIC_COLORED(color, value, value_length)
+
+// Utilities:
+#define IREE_TRACE_IMPL_CONCAT_HELPER_(x, y) x##y
+#define IREE_TRACE_IMPL_CONCAT_(x, y) IREE_TRACE_IMPL_CONCAT_HELPER_(x, y)
+
 #else
 #define IREE_TRACE_SET_APP_INFO(value, value_length)
 #define IREE_TRACE_SET_THREAD_NAME(name)
@@ -506,7 +598,8 @@ enum {
 #include "third_party/tracy/Tracy.hpp"  // IWYU pragma: export
 #endif
 
-#if IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+#if (IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION) && \
+    defined(TRACY_ENABLE)
 
 // TODO(#1886): update these to tracy and drop the 0.
 #define IREE_TRACE_SCOPE() ZoneScoped
@@ -516,6 +609,30 @@ enum {
 #define IREE_TRACE_EVENT
 #define IREE_TRACE_EVENT0
 
+#elif IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+
+#define IREE_TRACE_SCOPE() IREE_TRACE_SCOPE0(nullptr)
+#define IREE_TRACE_SCOPE_DYNAMIC(name_cstr)                               \
+  static const iree_tracing_location_t IREE_TRACE_IMPL_CONCAT_(           \
+      iree_tracing_ring_location_, __LINE__) = {                          \
+      nullptr, __FUNCTION__, __FILE__, (uint32_t)__LINE__, 0};            \
+  const char* IREE_TRACE_IMPL_CONCAT_(iree_tracing_ring_name_, __LINE__) = \
+      (name_cstr);                                                        \
+  ::iree::RingTraceZone IREE_TRACE_IMPL_CONCAT_(                          \
+      iree_tracing_ring_zone_, __LINE__)(                                 \
+      &IREE_TRACE_IMPL_CONCAT_(iree_tracing_ring_location_, __LINE__),    \
+      IREE_TRACE_IMPL_CONCAT_(iree_tracing_ring_name_, __LINE__),         \
+      strlen(IREE_TRACE_IMPL_CONCAT_(iree_tracing_ring_name_, __LINE__)))
+#define IREE_TRACE_SCOPE0(name_literal)                                \
+  static const iree_tracing_location_t IREE_TRACE_IMPL_CONCAT_(        \
+      iree_tracing_ring_location_, __LINE__) = {                       \
+      name_literal, __FUNCTION__, __FILE__, (uint32_t)__LINE__, 0};    \
+  ::iree::RingTraceZone IREE_TRACE_IMPL_CONCAT_(                       \
+      iree_tracing_ring_zone_, __LINE__)(                              \
+      &IREE_TRACE_IMPL_CONCAT_(iree_tracing_ring_location_, __LINE__))
+#define IREE_TRACE_EVENT
+#define IREE_TRACE_EVENT0
+
 #else
 #define IREE_TRACE_THREAD_ENABLE(name)
 #define IREE_TRACE_SCOPE()
@@ -0,0 +1,391 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/tracing.h"
+
+#if (IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_RING) && \
+    (IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION)
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "iree/base/attributes.h"
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/debugging.h"
+#include "iree/base/target_platform.h"
+
+//===----------------------------------------------------------------------===//
+// Clock
+//===----------------------------------------------------------------------===//
+
+// Returns a monotonic timestamp in nanoseconds.
+static uint64_t iree_tracing_ring_now_ns(void) {
+#if defined(IREE_PLATFORM_WINDOWS)
+  static LARGE_INTEGER frequency = {0};
+  if (!frequency.QuadPart) QueryPerformanceFrequency(&frequency);
+  LARGE_INTEGER counter;
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)((double)counter.QuadPart * 1e9 /
+                    (double)frequency.QuadPart);
+#elif defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_APPLE) || \
+    defined(IREE_PLATFORM_LINUX) || defined(IREE_PLATFORM_EMSCRIPTEN)
+  struct timespec clock_time;
+  clock_gettime(CLOCK_MONOTONIC, &clock_time);
+  return clock_time.tv_sec * 1000000000ull + clock_time.tv_nsec;
+#else
+  // Processor time is the best portable approximation available.
+  return (uint64_t)((double)clock() * 1e9 / (double)CLOCKS_PER_SEC);
+#endif  // IREE_PLATFORM_*
+}
+
+//===----------------------------------------------------------------------===//
+// Thread ring buffers
+//===----------------------------------------------------------------------===//
+
+enum iree_tracing_ring_event_type_e {
+  IREE_TRACING_RING_EVENT_ZONE_BEGIN = 0,
+  IREE_TRACING_RING_EVENT_ZONE_END = 1,
+};
+
+// Maximum length of the name stored inline in zone begin events.
+#define IREE_TRACING_RING_MAX_NAME_LENGTH 46
+
+// Maximum length of thread names.
+#define IREE_TRACING_RING_MAX_THREAD_NAME_LENGTH 63
+
+typedef struct iree_tracing_ring_event_t {
+  uint64_t timestamp_ns;
+  // Static location of zone begin events, if any.
+  const iree_tracing_location_t* location;
+  uint8_t type;
+  // Length of |name| or 0 to use the name of |location|.
+  uint8_t name_length;
+  char name[IREE_TRACING_RING_MAX_NAME_LENGTH];
+} iree_tracing_ring_event_t;
+static_assert(sizeof(iree_tracing_ring_event_t) == 64,
+              "events are expected to be a cache line");
+
+typedef struct iree_tracing_ring_thread_t {
+  // Next thread in the global list; immutable once registered.
+  struct iree_tracing_ring_thread_t* next;
+  // Process-unique ID assigned in registration order.
+  uint32_t thread_id;
+  // NUL-terminated thread name; written only by the owning thread.
+  char name[IREE_TRACING_RING_MAX_THREAD_NAME_LENGTH + 1];
+  // Total number of events ever written. The event with index i is stored in
+  // events[i % IREE_TRACING_RING_CAPACITY] and is visible to readers once the
+  // count exceeds i.
+  iree_atomic_int64_t write_count;
+  iree_tracing_ring_event_t events[IREE_TRACING_RING_CAPACITY];
+} iree_tracing_ring_thread_t;
+
+// Head of the list of all registered threads (iree_tracing_ring_thread_t*).
+static iree_atomic_intptr_t iree_tracing_ring_threads = IREE_ATOMIC_VAR_INIT(0);
+static iree_atomic_int32_t iree_tracing_ring_next_thread_id =
+    IREE_ATOMIC_VAR_INIT(1);
+static iree_atomic_int32_t iree_tracing_ring_enabled = IREE_ATOMIC_VAR_INIT(1);
+
+static IREE_THREAD_LOCAL iree_tracing_ring_thread_t*
+    iree_tracing_ring_current_thread = NULL;
+
+// Returns the ring buffer of the calling thread, allocating and registering it
+// if needed. Returns NULL if allocation fails.
+static iree_tracing_ring_thread_t* iree_tracing_ring_thread(void) {
+  iree_tracing_ring_thread_t* thread = iree_tracing_ring_current_thread;
+  if (IREE_LIKELY(thread)) return thread;
+
+  IREE_LEAK_CHECK_DISABLE_PUSH();
+  thread = (iree_tracing_ring_thread_t*)calloc(1, sizeof(*thread));
+  IREE_LEAK_CHECK_DISABLE_POP();
+  if (!thread) return NULL;
+  thread->thread_id = (uint32_t)iree_atomic_fetch_add_int32(
+      &iree_tracing_ring_next_thread_id, 1, iree_memory_order_relaxed);
+  iree_atomic_store_int64(&thread->write_count, 0, iree_memory_order_relaxed);
+
+  intptr_t head =
+      iree_atomic_load_intptr(&iree_tracing_ring_threads,
+                              iree_memory_order_relaxed);
+  do {
+    thread->next = (iree_tracing_ring_thread_t*)head;
+  } while (!iree_atomic_compare_exchange_weak_intptr(
+      &iree_tracing_ring_threads, &head, (intptr_t)thread,
+      iree_memory_order_release, iree_memory_order_relaxed));
+
+  iree_tracing_ring_current_thread = thread;
+  return thread;
+}
+
+// Returns the slot of the next event of |thread|. The event is published by
+// iree_tracing_ring_commit_event.
+static iree_tracing_ring_event_t* iree_tracing_ring_next_event(
+    iree_tracing_ring_thread_t* thread, int64_t* out_index) {
+  *out_index = iree_atomic_load_int64(&thread->write_count,
+                                      iree_memory_order_relaxed);
+  return &thread->events[*out_index % IREE_TRACING_RING_CAPACITY];
+}
+
+static void iree_tracing_ring_commit_event(iree_tracing_ring_thread_t* thread,
+                                           int64_t index) {
+  iree_atomic_store_int64(&thread->write_count, index + 1,
+                          iree_memory_order_release);
+}
+
+static uint32_t iree_tracing_ring_record_begin(
+    const iree_tracing_location_t* location, const char* name,
+    size_t name_length) {
+  if (!iree_atomic_load_int32(&iree_tracing_ring_enabled,
+                              iree_memory_order_relaxed)) {
+    return 0;
+  }
+  iree_tracing_ring_thread_t* thread = iree_tracing_ring_thread();
+  if (!thread) return 0;
+
+  int64_t index = 0;
+  iree_tracing_ring_event_t* event =
+      iree_tracing_ring_next_event(thread, &index);
+  event->timestamp_ns = iree_tracing_ring_now_ns();
+  event->location = location;
+  event->type = IREE_TRACING_RING_EVENT_ZONE_BEGIN;
+  if (name_length > IREE_TRACING_RING_MAX_NAME_LENGTH) {
+    name_length = IREE_TRACING_RING_MAX_NAME_LENGTH;
+  }
+  event->name_length = (uint8_t)name_length;
+  if (name_length) memcpy(event->name, name, name_length);
+  iree_tracing_ring_commit_event(thread, index);
+  return 1;
+}
+
+uint32_t iree_tracing_ring_zone_begin(const iree_tracing_location_t* location,
+                                      const char* name, size_t name_length) {
+  return iree_tracing_ring_record_begin(location, name, name_length);
+}
+
+uint32_t iree_tracing_ring_zone_begin_external(
+    const char* file_name, size_t file_name_length, uint32_t line,
+    const char* function_name, size_t function_name_length, const char* name,
+    size_t name_length) {
+  if (name && name_length) {
+    return iree_tracing_ring_record_begin(NULL, name, name_length);
+  }
+  return iree_tracing_ring_record_begin(NULL, function_name,
+                                        function_name_length);
+}
+
+void iree_tracing_ring_zone_end(uint32_t zone_id) {
+  if (!zone_id) return;
+  iree_tracing_ring_thread_t* thread = iree_tracing_ring_current_thread;
+  if (!thread) return;
+  int64_t index = 0;
+  iree_tracing_ring_event_t* event =
+      iree_tracing_ring_next_event(thread, &index);
+  event->timestamp_ns = iree_tracing_ring_now_ns();
+  event->location = NULL;
+  event->type = IREE_TRACING_RING_EVENT_ZONE_END;
+  event->name_length = 0;
+  iree_tracing_ring_commit_event(thread, index);
+}
+
+void iree_tracing_ring_set_thread_name(const char* name) {
+  iree_tracing_ring_thread_t* thread = iree_tracing_ring_thread();
+  if (!thread || !name) return;
+  strncpy(thread->name, name, IREE_TRACING_RING_MAX_THREAD_NAME_LENGTH);
+  thread->name[IREE_TRACING_RING_MAX_THREAD_NAME_LENGTH] = 0;
+}
+
+//===----------------------------------------------------------------------===//
+// Control
+//===----------------------------------------------------------------------===//
+
+void iree_tracing_ring_set_enabled(bool enabled) {
+  iree_atomic_store_int32(&iree_tracing_ring_enabled, enabled ? 1 : 0,
+                          iree_memory_order_relaxed);
+}
+
+bool iree_tracing_ring_is_enabled(void) {
+  return iree_atomic_load_int32(&iree_tracing_ring_enabled,
+                                iree_memory_order_relaxed) != 0;
+}
+
+//===----------------------------------------------------------------------===//
+// JSON Trace Event Format dumping
+//===----------------------------------------------------------------------===//
+
+typedef struct iree_tracing_ring_writer_t {
+  iree_tracing_ring_write_fn_t write_fn;
+  void* user_data;
+  bool is_first_event;
+} iree_tracing_ring_writer_t;
+
+static void iree_tracing_ring_write(iree_tracing_ring_writer_t* writer,
+                                    const char* data, size_t data_length) {
+  writer->write_fn(writer->user_data, data, data_length);
+}
+
+static void iree_tracing_ring_write_cstring(iree_tracing_ring_writer_t* writer,
+                                            const char* value) {
+  iree_tracing_ring_write(writer, value, strlen(value));
+}
+
+// Writes |value| as a quoted and escaped JSON string.
+static void iree_tracing_ring_write_json_string(
+    iree_tracing_ring_writer_t* writer, const char* value,
+    size_t value_length) {
+  iree_tracing_ring_write(writer, "\"", 1);
+  size_t run_start = 0;
+  for (size_t i = 0; i < value_length; ++i) {
+    unsigned char c = (unsigned char)value[i];
+    if (c != '"' && c != '\\' && c >= 0x20) continue;
+    iree_tracing_ring_write(writer, value + run_start, i - run_start);
+    char escape[8];
+    int escape_length = snprintf(escape, sizeof(escape), "\\u%04x", c);
+    iree_tracing_ring_write(writer, escape, (size_t)escape_length);
+    run_start = i + 1;
+  }
+  iree_tracing_ring_write(writer, value + run_start, value_length - run_start);
+  iree_tracing_ring_write(writer, "\"", 1);
+}
+
+// Writes the separator and common fields of an event through the "tid" field.
+static void iree_tracing_ring_write_event_prefix(
+    iree_tracing_ring_writer_t* writer, const char* phase,
+    uint64_t timestamp_ns, uint32_t thread_id) {
+  char buffer[128];
+  int length = snprintf(buffer, sizeof(buffer),
+                        "%s\n{\"ph\":\"%s\",\"ts\":%" PRIu64
+                        ".%03u,\"pid\":1,\"tid\":%u",
+                        writer->is_first_event ? "" : ",", phase,
+                        timestamp_ns / 1000, (uint32_t)(timestamp_ns % 1000),
+                        thread_id);
+  writer->is_first_event = false;
+  iree_tracing_ring_write(writer, buffer, (size_t)length);
+}
+
+static void iree_tracing_ring_write_thread(
+    iree_tracing_ring_writer_t* writer, iree_tracing_ring_thread_t* thread,
+    iree_tracing_ring_event_t* scratch_events) {
+  // Copy the events out and then discard those that may have been overwritten
+  // by the owning thread while we were copying.
+  int64_t end_index = iree_atomic_load_int64(&thread->write_count,
+                                             iree_memory_order_acquire);
+  int64_t begin_index = end_index > IREE_TRACING_RING_CAPACITY
+                            ? end_index - IREE_TRACING_RING_CAPACITY
+                            : 0;
+  for (int64_t i = begin_index; i < end_index; ++i) {
+    scratch_events[i - begin_index] =
+        thread->events[i % IREE_TRACING_RING_CAPACITY];
+  }
+  iree_atomic_thread_fence(iree_memory_order_acquire);
+  int64_t overwrite_index =
+      iree_atomic_load_int64(&thread->write_count, iree_memory_order_relaxed) +
+      1 - IREE_TRACING_RING_CAPACITY;
+  int64_t first_index =
+      overwrite_index > begin_index ? overwrite_index : begin_index;
+
+  char name[IREE_TRACING_RING_MAX_THREAD_NAME_LENGTH + 1];
+  memcpy(name, thread->name, sizeof(name));
+  name[IREE_TRACING_RING_MAX_THREAD_NAME_LENGTH] = 0;
+  if (name[0]) {
+    iree_tracing_ring_write_event_prefix(writer, "M", 0, thread->thread_id);
+    iree_tracing_ring_write_cstring(
+        writer, ",\"name\":\"thread_name\",\"args\":{\"name\":");
+    iree_tracing_ring_write_json_string(writer, name, strlen(name));
+    iree_tracing_ring_write_cstring(writer, "}}");
+  }
+
+  // Zones are nested per thread; ends without a retained begin are skipped.
+  int64_t depth = 0;
+  for (int64_t i = first_index; i < end_index; ++i) {
+    const iree_tracing_ring_event_t* event = &scratch_events[i - begin_index];
+    if (event->type == IREE_TRACING_RING_EVENT_ZONE_END) {
+      if (depth == 0) continue;
+      --depth;
+      iree_tracing_ring_write_event_prefix(writer, "E", event->timestamp_ns,
+                                           thread->thread_id);
+      iree_tracing_ring_write_cstring(writer, "}");
+      continue;
+    }
+    ++depth;
+    iree_tracing_ring_write_event_prefix(writer, "B", event->timestamp_ns,
+                                         thread->thread_id);
+    iree_tracing_ring_write_cstring(writer, ",\"name\":");
+    const iree_tracing_location_t* location = event->location;
+    if (event->name_length) {
+      iree_tracing_ring_write_json_string(writer, event->name,
+                                          event->name_length);
+    } else {
+      const char* zone_name = location->name ? location->name
+                                             : location->function;
+      iree_tracing_ring_write_json_string(writer, zone_name,
+                                          strlen(zone_name));
+    }
+    if (location) {
+      iree_tracing_ring_write_cstring(writer, ",\"args\":{\"file\":");
+      iree_tracing_ring_write_json_string(writer, location->file,
+                                          strlen(location->file));
+      char line[32];
+      int line_length =
+          snprintf(line, sizeof(line), ",\"line\":%u}", location->line);
+      iree_tracing_ring_write(writer, line, (size_t)line_length);
+    }
+    iree_tracing_ring_write_cstring(writer, "}");
+  }
+}
+
+bool iree_tracing_ring_dump(iree_tracing_ring_write_fn_t write_fn,
+                            void* user_data) {
+  iree_tracing_ring_event_t* scratch_events =
+      (iree_tracing_ring_event_t*)malloc(IREE_TRACING_RING_CAPACITY *
+                                         sizeof(iree_tracing_ring_event_t));
+  if (!scratch_events) return false;
+
+  iree_tracing_ring_writer_t writer = {
+      .write_fn = write_fn,
+      .user_data = user_data,
+      .is_first_event = true,
+  };
+  iree_tracing_ring_write_cstring(
+      &writer, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  iree_tracing_ring_thread_t* thread =
+      (iree_tracing_ring_thread_t*)iree_atomic_load_intptr(
+          &iree_tracing_ring_threads, iree_memory_order_acquire);
+  for (; thread; thread = thread->next) {
+    iree_tracing_ring_write_thread(&writer, thread, scratch_events);
+  }
+  iree_tracing_ring_write_cstring(&writer, "\n]}\n");
+
+  free(scratch_events);
+  return true;
+}
+
+typedef struct iree_tracing_ring_file_t {
+  FILE* file;
+  bool failed;
+} iree_tracing_ring_file_t;
+
+static void iree_tracing_ring_write_file(void* user_data, const char* data,
+                                         size_t data_length) {
+  iree_tracing_ring_file_t* file = (iree_tracing_ring_file_t*)user_data;
+  if (data_length && fwrite(data, 1, data_length, file->file) != data_length) {
+    file->failed = true;
+  }
+}
+
+bool iree_tracing_ring_dump_to_file(const char* path) {
+  iree_tracing_ring_file_t file = {
+      .file = fopen(path, "wb"),
+      .failed = false,
+  };
+  if (!file.file) return false;
+  bool succeeded =
+      iree_tracing_ring_dump(iree_tracing_ring_write_file, &file);
+  succeeded = fclose(file.file) == 0 && succeeded && !file.failed;
+  return succeeded;
+}
+
+#endif  // IREE_TRACING_PROVIDER_RING && IREE_TRACING_FEATURE_INSTRUMENTATION
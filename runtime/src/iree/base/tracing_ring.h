@@ -0,0 +1,144 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Always-on ring buffer tracing provider.
+//
+// Selected by defining IREE_TRACING_PROVIDER=IREE_TRACING_PROVIDER_RING (in
+// CMake with -DIREE_ENABLE_RUNTIME_TRACING=ON -DIREE_TRACING_PROVIDER=ring).
+// The existing IREE_TRACE_ZONE_* and IREE_TRACE_SCOPE* instrumentation then
+// records zone begin/end events with nanosecond timestamps into a fixed-size
+// ring buffer owned by each thread instead of streaming them to Tracy.
+//
+// Recording is lock-free: each thread only ever writes to its own buffer and
+// the only allocation is that of the buffer on the first event recorded on a
+// thread. Once a buffer is full the oldest events are overwritten so memory
+// use is bounded to IREE_TRACING_RING_CAPACITY events per thread that ever
+// recorded an event. Thread buffers live until process exit.
+//
+// The most recent events of all threads can be dumped at any time, including
+// while recording continues on other threads, as a JSON Trace Event Format
+// document that can be loaded in chrome://tracing or https://ui.perfetto.dev.
+//
+// NOTE: this header is included by tracing.h and used both from C and C++
+// code. Do not use C++ features outside of the __cplusplus section.
+
+#ifndef IREE_BASE_TRACING_RING_H_
+#define IREE_BASE_TRACING_RING_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Number of events retained per thread. Each event occupies 64 bytes.
+#if !defined(IREE_TRACING_RING_CAPACITY)
+#define IREE_TRACING_RING_CAPACITY 8192
+#endif  // IREE_TRACING_RING_CAPACITY
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// Recording (used by the IREE_TRACE_* macros)
+//===----------------------------------------------------------------------===//
+// These functions are implementation details and should not be called directly.
+// Always use the macros (or C++ RAII types).
+
+// Static source location of an instrumented zone.
+// Matches the layout of Tracy source locations so that the same instrumentation
+// macros can be used with either provider.
+typedef struct iree_tracing_location_t {
+  const char* name;
+  const char* function;
+  const char* file;
+  uint32_t line;
+  uint32_t color;
+} iree_tracing_location_t;
+
+// Records the beginning of a zone at |location|. If |name| is provided it is
+// copied (and possibly truncated) and used instead of the location name.
+// Returns 0 if the zone is not recorded because recording is disabled.
+uint32_t iree_tracing_ring_zone_begin(const iree_tracing_location_t* location,
+                                      const char* name, size_t name_length);
+
+// Records the beginning of a zone with a dynamic source location.
+// The zone is named |name| if provided and otherwise |function_name|.
+uint32_t iree_tracing_ring_zone_begin_external(
+    const char* file_name, size_t file_name_length, uint32_t line,
+    const char* function_name, size_t function_name_length, const char* name,
+    size_t name_length);
+
+// Records the end of the zone returned by a zone begin call.
+void iree_tracing_ring_zone_end(uint32_t zone_id);
+
+// Sets the name of the calling thread as it appears in dumps.
+// The string is copied and may be truncated.
+void iree_tracing_ring_set_thread_name(const char* name);
+
+//===----------------------------------------------------------------------===//
+// Control
+//===----------------------------------------------------------------------===//
+
+// Enables or disables recording of new zones process-wide.
+// Recording is enabled by default. Zones that began while recording was enabled
+// still record their end so that dumps remain balanced.
+void iree_tracing_ring_set_enabled(bool enabled);
+
+// Returns true if new zones are being recorded.
+bool iree_tracing_ring_is_enabled(void);
+
+// Receives chunks of a dump. Chunks are not NUL-terminated.
+typedef void (*iree_tracing_ring_write_fn_t)(void* user_data, const char* data,
+                                             size_t data_length);
+
+// Writes the events currently held by all thread ring buffers as a JSON Trace
+// Event Format document to |write_fn|. Zones whose begin event was overwritten
+// are omitted and zones that have not yet ended are left open.
+//
+// Thread-safe and may be called while other threads record events; events that
+// are overwritten while being read are dropped from the dump. Returns false
+// if scratch memory for the dump could not be allocated.
+bool iree_tracing_ring_dump(iree_tracing_ring_write_fn_t write_fn,
+                            void* user_data);
+
+// Dumps the events currently held by all thread ring buffers to the file at
+// |path| as with iree_tracing_ring_dump. Returns false if the file could not be
+// written.
+bool iree_tracing_ring_dump_to_file(const char* path);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// C++ RAII types
+//===----------------------------------------------------------------------===//
+
+#ifdef __cplusplus
+
+namespace iree {
+
+// Records a zone for the lifetime of the object.
+class RingTraceZone {
+ public:
+  explicit RingTraceZone(const iree_tracing_location_t* location,
+                         const char* name = nullptr, size_t name_length = 0)
+      : zone_id_(iree_tracing_ring_zone_begin(location, name, name_length)) {}
+  ~RingTraceZone() { iree_tracing_ring_zone_end(zone_id_); }
+
+  RingTraceZone(const RingTraceZone&) = delete;
+  RingTraceZone& operator=(const RingTraceZone&) = delete;
+
+ private:
+  uint32_t zone_id_;
+};
+
+}  // namespace iree
+
+#endif  // __cplusplus
+
+#endif  // IREE_BASE_TRACING_RING_H_
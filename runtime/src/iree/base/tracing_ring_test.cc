@@ -0,0 +1,107 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/tracing_ring.h"
+
+#include <string>
+#include <thread>
+
+#include "iree/base/tracing.h"
+#include "iree/testing/gtest.h"
+
+namespace {
+
+using ::testing::HasSubstr;
+using ::testing::Not;
+using ::testing::StartsWith;
+
+static_assert(IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_RING,
+              "test requires the ring tracing provider");
+
+std::string Dump() {
+  std::string result;
+  EXPECT_TRUE(iree_tracing_ring_dump(
+      [](void* user_data, const char* data, size_t data_length) {
+        static_cast<std::string*>(user_data)->append(data, data_length);
+      },
+      &result));
+  return result;
+}
+
+size_t CountOccurrences(const std::string& haystack,
+                        const std::string& needle) {
+  size_t count = 0;
+  for (size_t i = haystack.find(needle); i != std::string::npos;
+       i = haystack.find(needle, i + needle.size())) {
+    ++count;
+  }
+  return count;
+}
+
+void RecordNamedZone() {
+  IREE_TRACE_ZONE_BEGIN_NAMED(z0, "ring_test_named_zone");
+  IREE_TRACE_ZONE_END(z0);
+}
+
+TEST(TracingRingTest, RecordsZones) {
+  RecordNamedZone();
+  {
+    const char* name = "ring_test_\"dynamic\"";
+    IREE_TRACE_ZONE_BEGIN_NAMED_DYNAMIC(z0, name, strlen(name));
+    IREE_TRACE_ZONE_END(z0);
+  }
+  {
+    IREE_TRACE_SCOPE0("ring_test_scope");
+  }
+
+  std::string dump = Dump();
+  EXPECT_THAT(dump,
+              StartsWith("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+  EXPECT_THAT(dump, HasSubstr("\"name\":\"ring_test_named_zone\""));
+  EXPECT_THAT(dump, HasSubstr("\"name\":\"ring_test_\\u0022dynamic\\u0022\""));
+  EXPECT_THAT(dump, HasSubstr("\"name\":\"ring_test_scope\""));
+  EXPECT_THAT(dump, HasSubstr("tracing_ring_test.cc"));
+  EXPECT_EQ(CountOccurrences(dump, "\"ph\":\"B\""),
+            CountOccurrences(dump, "\"ph\":\"E\""));
+}
+
+TEST(TracingRingTest, NamesThreads) {
+  std::thread thread([]() {
+    IREE_TRACE_SET_THREAD_NAME("ring_test_thread");
+    RecordNamedZone();
+  });
+  thread.join();
+  EXPECT_THAT(Dump(), HasSubstr("\"args\":{\"name\":\"ring_test_thread\"}"));
+}
+
+TEST(TracingRingTest, Disable) {
+  iree_tracing_ring_set_enabled(false);
+  EXPECT_FALSE(iree_tracing_ring_is_enabled());
+  {
+    IREE_TRACE_SCOPE0("ring_test_disabled");
+  }
+  iree_tracing_ring_set_enabled(true);
+  EXPECT_TRUE(iree_tracing_ring_is_enabled());
+  EXPECT_THAT(Dump(), Not(HasSubstr("ring_test_disabled")));
+}
+
+TEST(TracingRingTest, OverwritesOldestEvents) {
+  std::thread thread([]() {
+    IREE_TRACE_SCOPE0("ring_test_outer");
+    for (int i = 0; i < IREE_TRACING_RING_CAPACITY; ++i) {
+      RecordNamedZone();
+    }
+  });
+  thread.join();
+
+  // The begin of the outer zone was overwritten and its end is dropped.
+  std::string dump = Dump();
+  EXPECT_THAT(dump, Not(HasSubstr("ring_test_outer")));
+  EXPECT_EQ(CountOccurrences(dump, "\"ph\":\"B\""),
+            CountOccurrences(dump, "\"ph\":\"E\""));
+}
+
+}  // namespace
@@ -0,0 +1,164 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_BUILTINS_UKERNEL_API_H_
+#define IREE_BUILTINS_UKERNEL_API_H_
+
+#include <stdint.h>
+
+#include "iree/base/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// Microkernels (ukernels)
+//===----------------------------------------------------------------------===//
+//
+// Hand-optimized implementations of hot operations provided by the runtime to
+// executables as imports. Each ukernel is exported under a stable symbol name
+// and follows the executable import ABI (iree_hal_executable_import_v0_t):
+//   int fn(void* params);
+// where |params| points at the ukernel-specific parameter struct declared
+// below. Ukernels return 0 on success and non-zero if the parameters are
+// invalid.
+//
+// Ukernels that have ISA-specific implementations take the processor data
+// from the executable environment (iree_hal_executable_environment_v0_t) and
+// select the best implementation available on the executing processor. A NULL
+// |cpu_data| selects the portable implementation.
+//
+// All sizes and strides are in elements. Buffers must not alias.
+
+// Signature of all ukernel entry points.
+typedef int (*iree_uk_fn_t)(void* params);
+
+// Returns the ukernel with the given |symbol_name| or NULL if not found.
+iree_uk_fn_t iree_uk_lookup(iree_string_view_t symbol_name);
+
+//===----------------------------------------------------------------------===//
+// mmt4d: tiled matrix multiplication with a transposed RHS
+//===----------------------------------------------------------------------===//
+//
+// Computes out[M][N][M0][N0] (+)= lhs[M][K][M0][K0] * rhs[N][K][N0][K0]^T
+// where each [M0][K0]/[N0][K0]/[M0][N0] tile is stored contiguously. This is
+// the layout produced by pack (with a transposed RHS) and the inner tile
+// sizes are chosen by the compiler to match the target ISA.
+//
+// Symbols:
+//   iree_uk_mmt4d_f32f32f32: f32 lhs * f32 rhs -> f32 out
+//   iree_uk_mmt4d_i8i8i32: i8 lhs * i8 rhs -> i32 out (quantized GEMM core;
+//                          zero points are applied by the caller)
+
+// Accumulates into the existing |out_buffer| contents instead of overwriting.
+#define IREE_UK_FLAG_ACCUMULATE 0x1u
+
+typedef struct iree_uk_mmt4d_params_t {
+  const void* lhs_buffer;
+  // Elements between consecutive M rows of |lhs_buffer| (usually K*M0*K0).
+  int64_t lhs_stride;
+  const void* rhs_buffer;
+  // Elements between consecutive N rows of |rhs_buffer| (usually K*N0*K0).
+  int64_t rhs_stride;
+  void* out_buffer;
+  // Elements between consecutive M rows of |out_buffer| (usually N*M0*N0).
+  int64_t out_stride;
+  // Outer tile counts.
+  int64_t M;
+  int64_t N;
+  int64_t K;
+  // Inner tile sizes.
+  int32_t M0;
+  int32_t N0;
+  int32_t K0;
+  // IREE_UK_FLAG_* bitfield.
+  uint32_t flags;
+  // Optional processor data from the executable environment.
+  const uint64_t* cpu_data;
+} iree_uk_mmt4d_params_t;
+
+int iree_uk_mmt4d_f32f32f32(void* params);
+int iree_uk_mmt4d_i8i8i32(void* params);
+
+//===----------------------------------------------------------------------===//
+// pack/unpack: tiling of 2D row-major matrices
+//===----------------------------------------------------------------------===//
+//
+// pack: out[out_size0][out_size1][tile_size0][tile_size1] = in[size0][size1]
+// Elements outside of the input bounds are filled with |padding_value|.
+//
+// unpack: out[size0][size1] = in[out_size0][out_size1][tile_size0][tile_size1]
+// Only elements within the output bounds are written.
+//
+// With IREE_UK_FLAG_PACK_TRANSPOSE the unpacked matrix is accessed transposed
+// such that element (i, j) of the tiled matrix maps to unpacked element
+// (j, i); this is used to produce the transposed RHS consumed by mmt4d.
+//
+// Element types are treated as opaque bits and selected by size:
+//   iree_uk_pack_x8 / iree_uk_unpack_x8: 1 byte elements
+//   iree_uk_pack_x32 / iree_uk_unpack_x32: 4 byte elements
+
+#define IREE_UK_FLAG_PACK_TRANSPOSE 0x2u
+
+typedef struct iree_uk_pack_params_t {
+  // Unpacked row-major matrix (input of pack and output of unpack).
+  void* unpacked_buffer;
+  // Elements between consecutive rows of |unpacked_buffer|.
+  int64_t unpacked_stride;
+  // Tiled matrix (output of pack and input of unpack).
+  void* packed_buffer;
+  // Elements between consecutive outer rows of |packed_buffer| (usually
+  // out_size1*tile_size0*tile_size1).
+  int64_t packed_stride;
+  // Logical size of the unpacked matrix (before any transposition).
+  int64_t size0;
+  int64_t size1;
+  // Outer tile counts of the packed matrix.
+  int64_t out_size0;
+  int64_t out_size1;
+  // Inner tile sizes of the packed matrix.
+  int64_t tile_size0;
+  int64_t tile_size1;
+  // Optional element-sized value used by pack for out-of-bounds elements.
+  // Zero is used when omitted.
+  const void* padding_value;
+  // IREE_UK_FLAG_* bitfield.
+  uint32_t flags;
+} iree_uk_pack_params_t;
+
+int iree_uk_pack_x8(void* params);
+int iree_uk_pack_x32(void* params);
+int iree_uk_unpack_x8(void* params);
+int iree_uk_unpack_x32(void* params);
+
+//===----------------------------------------------------------------------===//
+// softmax: numerically stable row-wise softmax
+//===----------------------------------------------------------------------===//
+//
+// out[i][j] = exp(in[i][j] - max(in[i])) / sum(exp(in[i] - max(in[i])))
+//
+// Symbols:
+//   iree_uk_softmax_f32
+
+typedef struct iree_uk_softmax_params_t {
+  const float* in_buffer;
+  // Elements between consecutive rows of |in_buffer|.
+  int64_t in_stride;
+  float* out_buffer;
+  // Elements between consecutive rows of |out_buffer|.
+  int64_t out_stride;
+  int64_t rows;
+  int64_t cols;
+} iree_uk_softmax_params_t;
+
+int iree_uk_softmax_f32(void* params);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_BUILTINS_UKERNEL_API_H_
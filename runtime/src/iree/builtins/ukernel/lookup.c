@@ -0,0 +1,33 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/builtins/ukernel/api.h"
+
+typedef struct iree_uk_symbol_t {
+  const char* name;
+  iree_uk_fn_t fn;
+} iree_uk_symbol_t;
+
+static const iree_uk_symbol_t iree_uk_symbols[] = {
+    {"iree_uk_mmt4d_f32f32f32", iree_uk_mmt4d_f32f32f32},
+    {"iree_uk_mmt4d_i8i8i32", iree_uk_mmt4d_i8i8i32},
+    {"iree_uk_pack_x32", iree_uk_pack_x32},
+    {"iree_uk_pack_x8", iree_uk_pack_x8},
+    {"iree_uk_softmax_f32", iree_uk_softmax_f32},
+    {"iree_uk_unpack_x32", iree_uk_unpack_x32},
+    {"iree_uk_unpack_x8", iree_uk_unpack_x8},
+};
+
+iree_uk_fn_t iree_uk_lookup(iree_string_view_t symbol_name) {
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(iree_uk_symbols); ++i) {
+    const iree_uk_symbol_t* symbol = &iree_uk_symbols[i];
+    if (iree_string_view_equal(symbol_name,
+                               iree_make_cstring_view(symbol->name))) {
+      return symbol->fn;
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,132 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <string.h>
+
+#include "iree/builtins/ukernel/mmt4d_internal.h"
+
+//===----------------------------------------------------------------------===//
+// Generic tile functions
+//===----------------------------------------------------------------------===//
+
+static void iree_uk_mmt4d_tile_f32f32f32_generic(
+    void* out_tile_untyped, const void* lhs_panel_untyped,
+    const void* rhs_panel_untyped, int64_t K, uint32_t flags,
+    const iree_uk_mmt4d_params_t* params) {
+  float* out_tile = (float*)out_tile_untyped;
+  const float* lhs_panel = (const float*)lhs_panel_untyped;
+  const float* rhs_panel = (const float*)rhs_panel_untyped;
+  const int32_t M0 = params->M0;
+  const int32_t N0 = params->N0;
+  const int32_t K0 = params->K0;
+  if (!(flags & IREE_UK_FLAG_ACCUMULATE)) {
+    memset(out_tile, 0, M0 * N0 * sizeof(*out_tile));
+  }
+  for (int64_t k = 0; k < K; ++k) {
+    for (int32_t i0 = 0; i0 < M0; ++i0) {
+      for (int32_t j0 = 0; j0 < N0; ++j0) {
+        float acc = out_tile[i0 * N0 + j0];
+        for (int32_t k0 = 0; k0 < K0; ++k0) {
+          acc += lhs_panel[i0 * K0 + k0] * rhs_panel[j0 * K0 + k0];
+        }
+        out_tile[i0 * N0 + j0] = acc;
+      }
+    }
+    lhs_panel += M0 * K0;
+    rhs_panel += N0 * K0;
+  }
+}
+
+static void iree_uk_mmt4d_tile_i8i8i32_generic(
+    void* out_tile_untyped, const void* lhs_panel_untyped,
+    const void* rhs_panel_untyped, int64_t K, uint32_t flags,
+    const iree_uk_mmt4d_params_t* params) {
+  int32_t* out_tile = (int32_t*)out_tile_untyped;
+  const int8_t* lhs_panel = (const int8_t*)lhs_panel_untyped;
+  const int8_t* rhs_panel = (const int8_t*)rhs_panel_untyped;
+  const int32_t M0 = params->M0;
+  const int32_t N0 = params->N0;
+  const int32_t K0 = params->K0;
+  if (!(flags & IREE_UK_FLAG_ACCUMULATE)) {
+    memset(out_tile, 0, M0 * N0 * sizeof(*out_tile));
+  }
+  for (int64_t k = 0; k < K; ++k) {
+    for (int32_t i0 = 0; i0 < M0; ++i0) {
+      for (int32_t j0 = 0; j0 < N0; ++j0) {
+        int32_t acc = out_tile[i0 * N0 + j0];
+        for (int32_t k0 = 0; k0 < K0; ++k0) {
+          acc += (int32_t)lhs_panel[i0 * K0 + k0] *
+                 (int32_t)rhs_panel[j0 * K0 + k0];
+        }
+        out_tile[i0 * N0 + j0] = acc;
+      }
+    }
+    lhs_panel += M0 * K0;
+    rhs_panel += N0 * K0;
+  }
+}
+
+//===----------------------------------------------------------------------===//
+// Outer loop
+//===----------------------------------------------------------------------===//
+
+static int iree_uk_mmt4d_validate(const iree_uk_mmt4d_params_t* params) {
+  if (params->M0 <= 0 || params->N0 <= 0 || params->K0 <= 0) return 1;
+  if (params->M < 0 || params->N < 0 || params->K < 0) return 1;
+  if (params->M == 0 || params->N == 0) return 0;
+  if (!params->out_buffer) return 1;
+  if (params->K > 0 && (!params->lhs_buffer || !params->rhs_buffer)) return 1;
+  return 0;
+}
+
+static void iree_uk_mmt4d_run(const iree_uk_mmt4d_params_t* params,
+                              iree_uk_mmt4d_tile_fn_t tile_fn,
+                              iree_host_size_t lhs_element_size,
+                              iree_host_size_t rhs_element_size,
+                              iree_host_size_t out_element_size) {
+  const uint8_t* lhs_row = (const uint8_t*)params->lhs_buffer;
+  uint8_t* out_row = (uint8_t*)params->out_buffer;
+  const iree_host_size_t rhs_row_size = params->rhs_stride * rhs_element_size;
+  const iree_host_size_t out_tile_size =
+      params->M0 * params->N0 * out_element_size;
+  for (int64_t i = 0; i < params->M; ++i) {
+    const uint8_t* rhs_row = (const uint8_t*)params->rhs_buffer;
+    uint8_t* out_tile = out_row;
+    for (int64_t j = 0; j < params->N; ++j) {
+      tile_fn(out_tile, lhs_row, rhs_row, params->K, params->flags, params);
+      rhs_row += rhs_row_size;
+      out_tile += out_tile_size;
+    }
+    lhs_row += params->lhs_stride * lhs_element_size;
+    out_row += params->out_stride * out_element_size;
+  }
+}
+
+int iree_uk_mmt4d_f32f32f32(void* params_untyped) {
+  const iree_uk_mmt4d_params_t* params =
+      (const iree_uk_mmt4d_params_t*)params_untyped;
+  if (iree_uk_mmt4d_validate(params)) return 1;
+  if (params->M == 0 || params->N == 0) return 0;
+  iree_uk_mmt4d_tile_fn_t tile_fn =
+      iree_uk_mmt4d_select_tile_fn_f32f32f32_arch(params);
+  if (!tile_fn) tile_fn = iree_uk_mmt4d_tile_f32f32f32_generic;
+  iree_uk_mmt4d_run(params, tile_fn, sizeof(float), sizeof(float),
+                    sizeof(float));
+  return 0;
+}
+
+int iree_uk_mmt4d_i8i8i32(void* params_untyped) {
+  const iree_uk_mmt4d_params_t* params =
+      (const iree_uk_mmt4d_params_t*)params_untyped;
+  if (iree_uk_mmt4d_validate(params)) return 1;
+  if (params->M == 0 || params->N == 0) return 0;
+  iree_uk_mmt4d_tile_fn_t tile_fn =
+      iree_uk_mmt4d_select_tile_fn_i8i8i32_arch(params);
+  if (!tile_fn) tile_fn = iree_uk_mmt4d_tile_i8i8i32_generic;
+  iree_uk_mmt4d_run(params, tile_fn, sizeof(int8_t), sizeof(int8_t),
+                    sizeof(int32_t));
+  return 0;
+}
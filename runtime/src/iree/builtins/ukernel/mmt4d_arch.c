@@ -0,0 +1,122 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/base/internal/cpu.h"
+#include "iree/builtins/ukernel/mmt4d_internal.h"
+
+// Architecture-specific tile functions. These are compiled with per-function
+// target attributes so that the containing library can still be built for the
+// baseline ISA and the tile functions are only selected when the executing
+// processor reports support via the |cpu_data| in the parameters.
+
+#if defined(IREE_ARCH_X86_64) && defined(IREE_COMPILER_GCC_COMPAT)
+
+#include <immintrin.h>
+
+#define IREE_UK_X86_64_AVX2_FMA_BITS \
+  (IREE_CPU_DATA0_X86_64_AVX2 | IREE_CPU_DATA0_X86_64_FMA)
+
+static bool iree_uk_mmt4d_has_avx2_fma(const iree_uk_mmt4d_params_t* params) {
+  if (!params->cpu_data) return false;
+  return (params->cpu_data[0] & IREE_UK_X86_64_AVX2_FMA_BITS) ==
+         IREE_UK_X86_64_AVX2_FMA_BITS;
+}
+
+// f32 8x8x1: one ymm accumulator per output row with the lhs element
+// broadcast against the 8 rhs columns.
+__attribute__((target("avx2,fma"))) static void
+iree_uk_mmt4d_tile_f32f32f32_8x8x1_x86_64_avx2_fma(
+    void* out_tile_untyped, const void* lhs_panel_untyped,
+    const void* rhs_panel_untyped, int64_t K, uint32_t flags,
+    const iree_uk_mmt4d_params_t* params) {
+  float* out_ptr = (float*)out_tile_untyped;
+  const float* lhs_ptr = (const float*)lhs_panel_untyped;
+  const float* rhs_ptr = (const float*)rhs_panel_untyped;
+  __m256 acc[8];
+  if (flags & IREE_UK_FLAG_ACCUMULATE) {
+    for (int i = 0; i < 8; ++i) acc[i] = _mm256_loadu_ps(out_ptr + i * 8);
+  } else {
+    for (int i = 0; i < 8; ++i) acc[i] = _mm256_setzero_ps();
+  }
+  for (int64_t k = 0; k < K; ++k) {
+    __m256 rhs = _mm256_loadu_ps(rhs_ptr);
+    for (int i = 0; i < 8; ++i) {
+      acc[i] = _mm256_fmadd_ps(_mm256_broadcast_ss(lhs_ptr + i), rhs, acc[i]);
+    }
+    lhs_ptr += 8;
+    rhs_ptr += 8;
+  }
+  for (int i = 0; i < 8; ++i) _mm256_storeu_ps(out_ptr + i * 8, acc[i]);
+}
+
+// i8i8i32 8x8x2: the int8 pairs along K0 are sign-extended to int16 and
+// reduced with vpmaddwd, which produces exactly one int32 per output column.
+__attribute__((target("avx2"))) static void
+iree_uk_mmt4d_tile_i8i8i32_8x8x2_x86_64_avx2(
+    void* out_tile_untyped, const void* lhs_panel_untyped,
+    const void* rhs_panel_untyped, int64_t K, uint32_t flags,
+    const iree_uk_mmt4d_params_t* params) {
+  int32_t* out_ptr = (int32_t*)out_tile_untyped;
+  const int8_t* lhs_ptr = (const int8_t*)lhs_panel_untyped;
+  const int8_t* rhs_ptr = (const int8_t*)rhs_panel_untyped;
+  __m256i acc[8];
+  if (flags & IREE_UK_FLAG_ACCUMULATE) {
+    for (int i = 0; i < 8; ++i) {
+      acc[i] = _mm256_loadu_si256((const __m256i*)(out_ptr + i * 8));
+    }
+  } else {
+    for (int i = 0; i < 8; ++i) acc[i] = _mm256_setzero_si256();
+  }
+  for (int64_t k = 0; k < K; ++k) {
+    __m256i lhs =
+        _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)lhs_ptr));
+    __m256i rhs =
+        _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)rhs_ptr));
+    for (int i = 0; i < 8; ++i) {
+      // Broadcast the (lhs[i][0], lhs[i][1]) int16 pair to all lanes.
+      __m256i lhs_i = _mm256_permutevar8x32_epi32(lhs, _mm256_set1_epi32(i));
+      acc[i] = _mm256_add_epi32(acc[i], _mm256_madd_epi16(lhs_i, rhs));
+    }
+    lhs_ptr += 16;
+    rhs_ptr += 16;
+  }
+  for (int i = 0; i < 8; ++i) {
+    _mm256_storeu_si256((__m256i*)(out_ptr + i * 8), acc[i]);
+  }
+}
+
+iree_uk_mmt4d_tile_fn_t iree_uk_mmt4d_select_tile_fn_f32f32f32_arch(
+    const iree_uk_mmt4d_params_t* params) {
+  if (params->M0 == 8 && params->N0 == 8 && params->K0 == 1 &&
+      iree_uk_mmt4d_has_avx2_fma(params)) {
+    return iree_uk_mmt4d_tile_f32f32f32_8x8x1_x86_64_avx2_fma;
+  }
+  return NULL;
+}
+
+iree_uk_mmt4d_tile_fn_t iree_uk_mmt4d_select_tile_fn_i8i8i32_arch(
+    const iree_uk_mmt4d_params_t* params) {
+  if (params->M0 == 8 && params->N0 == 8 && params->K0 == 2 &&
+      params->cpu_data &&
+      (params->cpu_data[0] & IREE_CPU_DATA0_X86_64_AVX2)) {
+    return iree_uk_mmt4d_tile_i8i8i32_8x8x2_x86_64_avx2;
+  }
+  return NULL;
+}
+
+#else
+
+iree_uk_mmt4d_tile_fn_t iree_uk_mmt4d_select_tile_fn_f32f32f32_arch(
+    const iree_uk_mmt4d_params_t* params) {
+  return NULL;
+}
+
+iree_uk_mmt4d_tile_fn_t iree_uk_mmt4d_select_tile_fn_i8i8i32_arch(
+    const iree_uk_mmt4d_params_t* params) {
+  return NULL;
+}
+
+#endif  // IREE_ARCH_X86_64 && IREE_COMPILER_GCC_COMPAT
@@ -0,0 +1,35 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_BUILTINS_UKERNEL_MMT4D_INTERNAL_H_
+#define IREE_BUILTINS_UKERNEL_MMT4D_INTERNAL_H_
+
+#include "iree/builtins/ukernel/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Computes a single [M0][N0] |out_tile| from a [K][M0][K0] |lhs_panel| and a
+// [K][N0][K0] |rhs_panel|. Accumulates into the existing tile contents when
+// IREE_UK_FLAG_ACCUMULATE is set in |flags|.
+typedef void (*iree_uk_mmt4d_tile_fn_t)(void* out_tile, const void* lhs_panel,
+                                        const void* rhs_panel, int64_t K,
+                                        uint32_t flags,
+                                        const iree_uk_mmt4d_params_t* params);
+
+// Returns an architecture-specific tile function for |params| or NULL if none
+// is available and the generic tile function should be used.
+iree_uk_mmt4d_tile_fn_t iree_uk_mmt4d_select_tile_fn_f32f32f32_arch(
+    const iree_uk_mmt4d_params_t* params);
+iree_uk_mmt4d_tile_fn_t iree_uk_mmt4d_select_tile_fn_i8i8i32_arch(
+    const iree_uk_mmt4d_params_t* params);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_BUILTINS_UKERNEL_MMT4D_INTERNAL_H_
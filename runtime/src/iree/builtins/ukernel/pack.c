@@ -0,0 +1,104 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <string.h>
+
+#include "iree/builtins/ukernel/api.h"
+
+static int iree_uk_pack_validate(const iree_uk_pack_params_t* params) {
+  if (params->tile_size0 <= 0 || params->tile_size1 <= 0) return 1;
+  if (params->size0 < 0 || params->size1 < 0) return 1;
+  if (params->out_size0 < 0 || params->out_size1 < 0) return 1;
+  if (params->out_size0 == 0 || params->out_size1 == 0) return 0;
+  if (!params->packed_buffer) return 1;
+  if (params->size0 > 0 && params->size1 > 0 && !params->unpacked_buffer) {
+    return 1;
+  }
+  return 0;
+}
+
+// Returns the unpacked element offset of tiled element (i, j) or -1 if it is
+// out of bounds of the unpacked matrix.
+static inline int64_t iree_uk_pack_unpacked_offset(
+    const iree_uk_pack_params_t* params, int64_t i, int64_t j) {
+  if (params->flags & IREE_UK_FLAG_PACK_TRANSPOSE) {
+    int64_t t = i;
+    i = j;
+    j = t;
+  }
+  if (i >= params->size0 || j >= params->size1) return -1;
+  return i * params->unpacked_stride + j;
+}
+
+static int iree_uk_pack_run(const iree_uk_pack_params_t* params,
+                            iree_host_size_t element_size) {
+  if (iree_uk_pack_validate(params)) return 1;
+  static const uint32_t zero = 0;
+  const uint8_t* padding_value = params->padding_value
+                                     ? (const uint8_t*)params->padding_value
+                                     : (const uint8_t*)&zero;
+  const uint8_t* in_ptr = (const uint8_t*)params->unpacked_buffer;
+  uint8_t* out_row = (uint8_t*)params->packed_buffer;
+  for (int64_t i1 = 0; i1 < params->out_size0; ++i1) {
+    uint8_t* out_ptr = out_row;
+    for (int64_t j1 = 0; j1 < params->out_size1; ++j1) {
+      for (int64_t i0 = 0; i0 < params->tile_size0; ++i0) {
+        const int64_t i = i1 * params->tile_size0 + i0;
+        for (int64_t j0 = 0; j0 < params->tile_size1; ++j0) {
+          const int64_t j = j1 * params->tile_size1 + j0;
+          int64_t offset = iree_uk_pack_unpacked_offset(params, i, j);
+          const uint8_t* src =
+              offset >= 0 ? in_ptr + offset * element_size : padding_value;
+          memcpy(out_ptr, src, element_size);
+          out_ptr += element_size;
+        }
+      }
+    }
+    out_row += params->packed_stride * element_size;
+  }
+  return 0;
+}
+
+static int iree_uk_unpack_run(const iree_uk_pack_params_t* params,
+                              iree_host_size_t element_size) {
+  if (iree_uk_pack_validate(params)) return 1;
+  uint8_t* out_ptr = (uint8_t*)params->unpacked_buffer;
+  const uint8_t* in_row = (const uint8_t*)params->packed_buffer;
+  for (int64_t i1 = 0; i1 < params->out_size0; ++i1) {
+    const uint8_t* in_ptr = in_row;
+    for (int64_t j1 = 0; j1 < params->out_size1; ++j1) {
+      for (int64_t i0 = 0; i0 < params->tile_size0; ++i0) {
+        const int64_t i = i1 * params->tile_size0 + i0;
+        for (int64_t j0 = 0; j0 < params->tile_size1; ++j0) {
+          const int64_t j = j1 * params->tile_size1 + j0;
+          int64_t offset = iree_uk_pack_unpacked_offset(params, i, j);
+          if (offset >= 0) {
+            memcpy(out_ptr + offset * element_size, in_ptr, element_size);
+          }
+          in_ptr += element_size;
+        }
+      }
+    }
+    in_row += params->packed_stride * element_size;
+  }
+  return 0;
+}
+
+int iree_uk_pack_x8(void* params) {
+  return iree_uk_pack_run((const iree_uk_pack_params_t*)params, 1);
+}
+
+int iree_uk_pack_x32(void* params) {
+  return iree_uk_pack_run((const iree_uk_pack_params_t*)params, 4);
+}
+
+int iree_uk_unpack_x8(void* params) {
+  return iree_uk_unpack_run((const iree_uk_pack_params_t*)params, 1);
+}
+
+int iree_uk_unpack_x32(void* params) {
+  return iree_uk_unpack_run((const iree_uk_pack_params_t*)params, 4);
+}
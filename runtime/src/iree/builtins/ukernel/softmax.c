@@ -0,0 +1,38 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <math.h>
+
+#include "iree/builtins/ukernel/api.h"
+
+int iree_uk_softmax_f32(void* params_untyped) {
+  const iree_uk_softmax_params_t* params =
+      (const iree_uk_softmax_params_t*)params_untyped;
+  if (params->rows < 0 || params->cols < 0) return 1;
+  if (params->rows == 0 || params->cols == 0) return 0;
+  if (!params->in_buffer || !params->out_buffer) return 1;
+  const float* in_row = params->in_buffer;
+  float* out_row = params->out_buffer;
+  for (int64_t i = 0; i < params->rows; ++i) {
+    float max_value = in_row[0];
+    for (int64_t j = 1; j < params->cols; ++j) {
+      max_value = in_row[j] > max_value ? in_row[j] : max_value;
+    }
+    float sum = 0.0f;
+    for (int64_t j = 0; j < params->cols; ++j) {
+      float value = expf(in_row[j] - max_value);
+      out_row[j] = value;
+      sum += value;
+    }
+    const float inv_sum = 1.0f / sum;
+    for (int64_t j = 0; j < params->cols; ++j) {
+      out_row[j] *= inv_sum;
+    }
+    in_row += params->in_stride;
+    out_row += params->out_stride;
+  }
+  return 0;
+}
@@ -0,0 +1,174 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/builtins/ukernel/api.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "iree/base/internal/cpu.h"
+#include "iree/testing/gtest.h"
+
+namespace {
+
+// Packs a row-major [rows][cols] matrix into [rows/t0][cols/t1][t0][t1] tiles
+// (optionally transposed) with zero padding using the pack ukernel.
+template <typename T>
+std::vector<T> Pack(const std::vector<T>& unpacked, int64_t rows, int64_t cols,
+                    int64_t tile_size0, int64_t tile_size1, bool transpose) {
+  int64_t tiled_rows = transpose ? cols : rows;
+  int64_t tiled_cols = transpose ? rows : cols;
+  iree_uk_pack_params_t params = {};
+  params.unpacked_buffer = const_cast<T*>(unpacked.data());
+  params.unpacked_stride = cols;
+  params.size0 = rows;
+  params.size1 = cols;
+  params.out_size0 = (tiled_rows + tile_size0 - 1) / tile_size0;
+  params.out_size1 = (tiled_cols + tile_size1 - 1) / tile_size1;
+  params.tile_size0 = tile_size0;
+  params.tile_size1 = tile_size1;
+  params.packed_stride = params.out_size1 * tile_size0 * tile_size1;
+  params.flags = transpose ? IREE_UK_FLAG_PACK_TRANSPOSE : 0;
+  std::vector<T> packed(params.out_size0 * params.packed_stride, T(1));
+  params.packed_buffer = packed.data();
+  EXPECT_EQ(0, sizeof(T) == 1 ? iree_uk_pack_x8(&params)
+                              : iree_uk_pack_x32(&params));
+  return packed;
+}
+
+template <typename T>
+std::vector<T> Unpack(const std::vector<T>& packed, int64_t rows, int64_t cols,
+                      int64_t tile_size0, int64_t tile_size1) {
+  iree_uk_pack_params_t params = {};
+  std::vector<T> unpacked(rows * cols);
+  params.unpacked_buffer = unpacked.data();
+  params.unpacked_stride = cols;
+  params.size0 = rows;
+  params.size1 = cols;
+  params.out_size0 = (rows + tile_size0 - 1) / tile_size0;
+  params.out_size1 = (cols + tile_size1 - 1) / tile_size1;
+  params.tile_size0 = tile_size0;
+  params.tile_size1 = tile_size1;
+  params.packed_stride = params.out_size1 * tile_size0 * tile_size1;
+  params.packed_buffer = const_cast<T*>(packed.data());
+  EXPECT_EQ(0, sizeof(T) == 1 ? iree_uk_unpack_x8(&params)
+                              : iree_uk_unpack_x32(&params));
+  return unpacked;
+}
+
+// Computes lhs[m][k] * rhs[k][n] through pack + mmt4d + unpack.
+template <typename LhsT, typename OutT>
+std::vector<OutT> Matmul(iree_uk_fn_t fn, const uint64_t* cpu_data,
+                         const std::vector<LhsT>& lhs,
+                         const std::vector<LhsT>& rhs, int64_t m, int64_t n,
+                         int64_t k, int32_t M0, int32_t N0, int32_t K0) {
+  auto packed_lhs = Pack(lhs, m, k, M0, K0, /*transpose=*/false);
+  auto packed_rhs = Pack(rhs, k, n, N0, K0, /*transpose=*/true);
+  iree_uk_mmt4d_params_t params = {};
+  params.M = (m + M0 - 1) / M0;
+  params.N = (n + N0 - 1) / N0;
+  params.K = (k + K0 - 1) / K0;
+  params.M0 = M0;
+  params.N0 = N0;
+  params.K0 = K0;
+  params.lhs_buffer = packed_lhs.data();
+  params.lhs_stride = params.K * M0 * K0;
+  params.rhs_buffer = packed_rhs.data();
+  params.rhs_stride = params.K * N0 * K0;
+  std::vector<OutT> packed_out(params.M * params.N * M0 * N0, OutT(7));
+  params.out_buffer = packed_out.data();
+  params.out_stride = params.N * M0 * N0;
+  params.cpu_data = cpu_data;
+  EXPECT_EQ(0, fn(&params));
+  return Unpack(packed_out, m, n, M0, N0);
+}
+
+class UkernelTest : public ::testing::TestWithParam<bool> {
+ protected:
+  // Returns the processor data to use or NULL to force the portable path.
+  const uint64_t* cpu_data() {
+    if (!GetParam()) return nullptr;
+    iree_cpu_query_data_fields(1, &cpu_data_);
+    return &cpu_data_;
+  }
+
+ private:
+  uint64_t cpu_data_ = 0;
+};
+
+TEST(UkernelLookupTest, Symbols) {
+  EXPECT_EQ(&iree_uk_mmt4d_f32f32f32,
+            iree_uk_lookup(IREE_SV("iree_uk_mmt4d_f32f32f32")));
+  EXPECT_EQ(&iree_uk_unpack_x8, iree_uk_lookup(IREE_SV("iree_uk_unpack_x8")));
+  EXPECT_EQ(nullptr, iree_uk_lookup(IREE_SV("iree_uk_unknown")));
+}
+
+TEST(UkernelPackTest, RoundTrip) {
+  std::vector<int32_t> values(13 * 7);
+  for (size_t i = 0; i < values.size(); ++i) values[i] = (int32_t)i;
+  auto packed = Pack(values, 13, 7, 4, 2, /*transpose=*/false);
+  // Padding is zero filled.
+  EXPECT_EQ(0, packed[3 * 4 * 4 * 2 + 3 * 2 + 1]);
+  EXPECT_EQ(values, Unpack(packed, 13, 7, 4, 2));
+}
+
+TEST_P(UkernelTest, MatmulF32) {
+  const int64_t m = 19, n = 11, k = 23;
+  std::vector<float> lhs(m * k), rhs(k * n);
+  for (size_t i = 0; i < lhs.size(); ++i) lhs[i] = (float)(i % 7) - 3.0f;
+  for (size_t i = 0; i < rhs.size(); ++i) rhs[i] = (float)(i % 5) * 0.5f;
+  auto out = Matmul<float, float>(iree_uk_mmt4d_f32f32f32, cpu_data(), lhs,
+                                  rhs, m, n, k, 8, 8, 1);
+  for (int64_t i = 0; i < m; ++i) {
+    for (int64_t j = 0; j < n; ++j) {
+      float expected = 0.0f;
+      for (int64_t l = 0; l < k; ++l) {
+        expected += lhs[i * k + l] * rhs[l * n + j];
+      }
+      EXPECT_FLOAT_EQ(expected, out[i * n + j]);
+    }
+  }
+}
+
+TEST_P(UkernelTest, MatmulI8) {
+  const int64_t m = 9, n = 17, k = 33;
+  std::vector<int8_t> lhs(m * k), rhs(k * n);
+  for (size_t i = 0; i < lhs.size(); ++i) lhs[i] = (int8_t)(i * 37);
+  for (size_t i = 0; i < rhs.size(); ++i) rhs[i] = (int8_t)(i * 91);
+  auto out = Matmul<int8_t, int32_t>(iree_uk_mmt4d_i8i8i32, cpu_data(), lhs,
+                                     rhs, m, n, k, 8, 8, 2);
+  for (int64_t i = 0; i < m; ++i) {
+    for (int64_t j = 0; j < n; ++j) {
+      int32_t expected = 0;
+      for (int64_t l = 0; l < k; ++l) {
+        expected += (int32_t)lhs[i * k + l] * (int32_t)rhs[l * n + j];
+      }
+      EXPECT_EQ(expected, out[i * n + j]);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(UkernelTests, UkernelTest, ::testing::Bool());
+
+TEST(UkernelSoftmaxTest, Rows) {
+  std::vector<float> in = {1.0f, 2.0f, 3.0f, 1000.0f, 1000.0f, 1000.0f};
+  std::vector<float> out(in.size());
+  iree_uk_softmax_params_t params = {};
+  params.in_buffer = in.data();
+  params.in_stride = 3;
+  params.out_buffer = out.data();
+  params.out_stride = 3;
+  params.rows = 2;
+  params.cols = 3;
+  ASSERT_EQ(0, iree_uk_softmax_f32(&params));
+  float sum = std::exp(-2.0f) + std::exp(-1.0f) + 1.0f;
+  EXPECT_FLOAT_EQ(std::exp(-2.0f) / sum, out[0]);
+  EXPECT_FLOAT_EQ(1.0f / sum, out[2]);
+  for (int j = 3; j < 6; ++j) EXPECT_FLOAT_EQ(1.0f / 3.0f, out[j]);
+}
+
+}  // namespace
@@ -115,6 +115,26 @@ iree_hal_allocator_query_compatibility(
                                                           allocation_size);
 }
 
+IREE_API_EXPORT iree_hal_buffer_compatibility_t
+iree_hal_allocator_query_buffer_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_buffer_usage_t intended_usage) {
+  IREE_ASSERT_ARGUMENT(allocator);
+  IREE_ASSERT_ARGUMENT(buffer);
+  if (_VTABLE_DISPATCH(allocator, query_buffer_compatibility)) {
+    return _VTABLE_DISPATCH(allocator, query_buffer_compatibility)(
+        allocator, buffer, intended_usage);
+  }
+  return iree_hal_allocator_query_compatibility(
+      allocator,
+      (iree_hal_buffer_params_t){
+          .type = iree_hal_buffer_memory_type(buffer),
+          .usage = iree_hal_buffer_allowed_usage(buffer) & intended_usage,
+      },
+      iree_hal_buffer_allocation_size(buffer));
+}
+
 IREE_API_EXPORT iree_status_t iree_hal_allocator_allocate_buffer(
     iree_hal_allocator_t* IREE_RESTRICT allocator,
     iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
@@ -199,8 +199,11 @@ typedef enum iree_hal_external_buffer_type_e {
   //  Uses CU_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD.
   //
   // Vulkan:
+  //  Requires VK_KHR_external_memory_fd.
   //  Requires device support.
   //  Uses VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT.
+  //  Ownership of the file descriptor is transferred to the implementation on
+  //  successful import; callers wanting to retain it must pass a dup.
   IREE_HAL_EXTERNAL_BUFFER_TYPE_OPAQUE_FD = 2,
 
   // A driver/device-specific Win32 HANDLE.
@@ -218,10 +221,31 @@ typedef enum iree_hal_external_buffer_type_e {
   //  Uses VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT.
   IREE_HAL_EXTERNAL_BUFFER_TYPE_OPAQUE_WIN32 = 3,
 
+  // An Android AHardwareBuffer*.
+  // An imported buffer acquires its own reference to the hardware buffer and
+  // the caller may release theirs at any time. Only hardware buffers with the
+  // AHARDWAREBUFFER_FORMAT_BLOB format can be imported as they are addressed
+  // linearly; image formats such as camera YUV frames must be produced into or
+  // copied to BLOB buffers first.
+  //
+  // Vulkan:
+  //  Requires VK_ANDROID_external_memory_android_hardware_buffer.
+  //  Uses VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID.
+  IREE_HAL_EXTERNAL_BUFFER_TYPE_ANDROID_HARDWARE_BUFFER = 4,
+
+  // A driver/device-specific device pointer to an allocation made outside of
+  // the HAL on the same device (such as by another framework sharing the
+  // device context). An imported/exported buffer does not own a reference to
+  // the memory and the caller is responsible for ensuring the memory remains
+  // live for as long as the iree_hal_buffer_t referencing it.
+  //
+  // CUDA:
+  //  Uses a CUdeviceptr in the same CUcontext as the device.
+  IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION = 5,
+
   // TODO(benvanik): additional memory types:
   //  shared memory fd (shmem)/mapped file
   //  VK_EXTERNAL_MEMORY_HANDLE_TYPE_DMA_BUF_BIT_EXT
-  //  VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID
 } iree_hal_external_buffer_type_t;
 
 // Flags for controlling iree_hal_external_buffer_t implementation details.
@@ -256,6 +280,16 @@ typedef struct iree_hal_external_buffer_t {
     struct {
       void* handle;
     } opaque_win32;
+    // IREE_HAL_EXTERNAL_BUFFER_TYPE_ANDROID_HARDWARE_BUFFER
+    struct {
+      // AHardwareBuffer*.
+      void* buffer;
+    } android_hardware_buffer;
+    // IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION
+    struct {
+      // Device pointer (such as a CUdeviceptr) widened to 64 bits.
+      uint64_t ptr;
+    } device_allocation;
   } handle;
 } iree_hal_external_buffer_t;
 
@@ -354,6 +388,20 @@ iree_hal_allocator_query_compatibility(
     iree_hal_allocator_t* IREE_RESTRICT allocator,
     iree_hal_buffer_params_t params, iree_device_size_t allocation_size);
 
+// Returns a bitmask indicating what operations with the existing |buffer| are
+// available on the allocator.
+//
+// Unlike iree_hal_allocator_query_compatibility this accounts for where the
+// buffer was allocated: device-local buffers allocated from another device may
+// only be usable if the device the allocator services can access their memory
+// directly (such as over a peer-to-peer link). Allocators that make no such
+// distinction report the compatibility of the buffer memory type and usage.
+IREE_API_EXPORT iree_hal_buffer_compatibility_t
+iree_hal_allocator_query_buffer_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_buffer_usage_t intended_usage);
+
 // Allocates a buffer from the allocator.
 // If |initial_data| is provided then the bytes will be copied into the device
 // buffer. To avoid the copy when device-accessible constant data is used prefer
@@ -443,6 +491,60 @@ IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap(
     iree_string_view_t identifier, iree_allocator_t data_allocator,
     iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator);
 
+// Indicates that heap buffer storage may be placed on any NUMA node.
+#define IREE_HAL_HEAP_ALLOCATOR_NUMA_NODE_ANY UINT32_MAX
+
+// Controls how the heap allocator places large buffer storage in memory.
+enum iree_hal_heap_allocator_flag_bits_t {
+  IREE_HAL_HEAP_ALLOCATOR_FLAG_NONE = 0u,
+
+  // Requests transparent huge pages for large buffers. This is advisory and
+  // buffers fall back to regular pages if the system does not provide them.
+  IREE_HAL_HEAP_ALLOCATOR_FLAG_TRANSPARENT_HUGE_PAGES = 1u << 0,
+
+  // Maps large buffers from the reserved huge page pool of the size specified
+  // by iree_hal_heap_allocator_options_t::huge_page_size (such as Linux
+  // hugetlbfs). Buffers fall back to transparent huge pages (if requested) or
+  // regular pages if the pool is exhausted.
+  IREE_HAL_HEAP_ALLOCATOR_FLAG_RESERVED_HUGE_PAGES = 1u << 1,
+};
+typedef uint32_t iree_hal_heap_allocator_flags_t;
+
+// Options controlling the placement of heap allocator buffer storage.
+// Placement is only applied to buffers of at least |min_placement_size| as
+// smaller allocations gain little and would waste memory when rounded up to
+// page sizes. Other buffers are allocated from the data allocator.
+typedef struct iree_hal_heap_allocator_options_t {
+  iree_hal_heap_allocator_flags_t flags;
+
+  // Minimum allocation size in bytes to which placement is applied.
+  iree_device_size_t min_placement_size;
+
+  // Page size in bytes such as 2MB or 1GB used when
+  // IREE_HAL_HEAP_ALLOCATOR_FLAG_RESERVED_HUGE_PAGES is set.
+  // Must be a power of two.
+  iree_device_size_t huge_page_size;
+
+  // NUMA node on which buffer storage is preferentially allocated or
+  // IREE_HAL_HEAP_ALLOCATOR_NUMA_NODE_ANY to use the system default policy
+  // (usually the node of the thread first touching each page). When buffers
+  // are read by workers pinned to a particular node this keeps them from
+  // landing on the node of whichever thread happened to initialize them.
+  uint32_t numa_node;
+} iree_hal_heap_allocator_options_t;
+
+// Initializes |out_options| to the default values that apply no placement.
+IREE_API_EXPORT void iree_hal_heap_allocator_options_initialize(
+    iree_hal_heap_allocator_options_t* out_options);
+
+// Creates a host-local heap allocator as with iree_hal_allocator_create_heap
+// that places buffer storage as specified by |options|.
+IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap_with_options(
+    iree_string_view_t identifier,
+    const iree_hal_heap_allocator_options_t* options,
+    iree_allocator_t data_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator);
+
 //===----------------------------------------------------------------------===//
 // iree_hal_allocator_t implementation details
 //===----------------------------------------------------------------------===//
@@ -488,6 +590,13 @@ typedef struct iree_hal_allocator_vtable_t {
       iree_hal_external_buffer_type_t requested_type,
       iree_hal_external_buffer_flags_t requested_flags,
       iree_hal_external_buffer_t* IREE_RESTRICT out_external_buffer);
+
+  // Optional; if NULL the compatibility of the buffer memory type and usage
+  // is queried with query_compatibility.
+  iree_hal_buffer_compatibility_t(IREE_API_PTR* query_buffer_compatibility)(
+      iree_hal_allocator_t* IREE_RESTRICT allocator,
+      iree_hal_buffer_t* IREE_RESTRICT buffer,
+      iree_hal_buffer_usage_t intended_usage);
 } iree_hal_allocator_vtable_t;
 IREE_HAL_ASSERT_VTABLE_LAYOUT(iree_hal_allocator_vtable_t);
 
@@ -4,9 +4,12 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <inttypes.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/math.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/allocator.h"
 #include "iree/hal/buffer.h"
@@ -17,6 +20,7 @@ typedef struct iree_hal_heap_allocator_t {
   iree_hal_resource_t resource;
   iree_allocator_t host_allocator;
   iree_allocator_t data_allocator;
+  iree_hal_heap_allocator_options_t options;
   iree_string_view_t identifier;
   IREE_STATISTICS(iree_hal_heap_allocator_statistics_t statistics;)
 } iree_hal_heap_allocator_t;
@@ -28,12 +32,41 @@ iree_hal_heap_allocator_t* iree_hal_heap_allocator_cast(
   return (iree_hal_heap_allocator_t*)base_value;
 }
 
+IREE_API_EXPORT void iree_hal_heap_allocator_options_initialize(
+    iree_hal_heap_allocator_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->flags = IREE_HAL_HEAP_ALLOCATOR_FLAG_NONE;
+  out_options->min_placement_size = 2 * 1024 * 1024;
+  out_options->huge_page_size = 2 * 1024 * 1024;
+  out_options->numa_node = IREE_HAL_HEAP_ALLOCATOR_NUMA_NODE_ANY;
+}
+
 IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap(
     iree_string_view_t identifier, iree_allocator_t data_allocator,
     iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator) {
+  iree_hal_heap_allocator_options_t options;
+  iree_hal_heap_allocator_options_initialize(&options);
+  return iree_hal_allocator_create_heap_with_options(
+      identifier, &options, data_allocator, host_allocator, out_allocator);
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap_with_options(
+    iree_string_view_t identifier,
+    const iree_hal_heap_allocator_options_t* options,
+    iree_allocator_t data_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(options);
   IREE_ASSERT_ARGUMENT(out_allocator);
-  IREE_TRACE_ZONE_BEGIN(z0);
   *out_allocator = NULL;
+  if (iree_any_bit_set(options->flags,
+                       IREE_HAL_HEAP_ALLOCATOR_FLAG_RESERVED_HUGE_PAGES) &&
+      iree_math_count_ones_u64(options->huge_page_size) != 1) {
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "huge page size must be a power of two; got %" PRIu64,
+        (uint64_t)options->huge_page_size);
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_heap_allocator_t* allocator = NULL;
   iree_host_size_t total_size =
@@ -45,6 +78,7 @@ IREE_API_EXPORT iree_status_t iree_hal_allocator_create_heap(
                                  &allocator->resource);
     allocator->host_allocator = host_allocator;
     allocator->data_allocator = data_allocator;
+    allocator->options = *options;
     iree_string_view_append_to_buffer(
         identifier, &allocator->identifier,
         (char*)allocator + iree_sizeof_struct(*allocator));
@@ -163,8 +197,9 @@ static iree_status_t iree_hal_heap_allocator_allocate_buffer(
   IREE_STATISTICS(statistics = &allocator->statistics);
   iree_hal_buffer_t* buffer = NULL;
   IREE_RETURN_IF_ERROR(iree_hal_heap_buffer_create(
-      base_allocator, statistics, &compat_params, allocation_size, initial_data,
-      allocator->data_allocator, allocator->host_allocator, &buffer));
+      base_allocator, statistics, &allocator->options, &compat_params,
+      allocation_size, initial_data, allocator->data_allocator,
+      allocator->host_allocator, &buffer));
 
   *out_buffer = buffer;
   return iree_ok_status();
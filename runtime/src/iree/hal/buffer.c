@@ -10,6 +10,7 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "iree/base/internal/bulk_memory.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/allocator.h"
 #include "iree/hal/detail.h"
@@ -594,40 +595,12 @@ IREE_API_EXPORT iree_status_t iree_hal_buffer_map_fill(
     pattern_length = 1;
   }
 
-  iree_status_t status = iree_ok_status();
-  void* data_ptr = target_mapping.contents.data;
-  switch (pattern_length) {
-    case 1: {
-      uint8_t* data = (uint8_t*)data_ptr;
-      uint8_t value_bits = *(const uint8_t*)(pattern);
-      memset(data, value_bits, byte_length);
-      break;
-    }
-    case 2: {
-      uint16_t* data = (uint16_t*)data_ptr;
-      uint16_t value_bits = *(const uint16_t*)(pattern);
-      for (iree_device_size_t i = 0; i < byte_length / sizeof(uint16_t); ++i) {
-        data[i] = value_bits;
-      }
-      break;
-    }
-    case 4: {
-      uint32_t* data = (uint32_t*)data_ptr;
-      uint32_t value_bits = *(const uint32_t*)(pattern);
-      for (iree_device_size_t i = 0; i < byte_length / sizeof(uint32_t); ++i) {
-        data[i] = value_bits;
-      }
-      break;
-    }
-    default:
-      status = iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
-                                "unsupported fill pattern length: %zu",
-                                pattern_length);
-      break;
-  }
+  iree_bulk_memory_fill(target_mapping.contents.data,
+                        (iree_host_size_t)(byte_length / pattern_length),
+                        pattern, pattern_length);
 
-  if (iree_status_is_ok(status) &&
-      !iree_all_bits_set(iree_hal_buffer_memory_type(buffer),
+  iree_status_t status = iree_ok_status();
+  if (!iree_all_bits_set(iree_hal_buffer_memory_type(buffer),
                          IREE_HAL_MEMORY_TYPE_HOST_COHERENT)) {
     status = iree_hal_buffer_mapping_flush_range(&target_mapping, 0,
                                                  IREE_WHOLE_BUFFER);
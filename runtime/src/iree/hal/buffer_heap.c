@@ -4,17 +4,28 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+// NOTE: must be first before _any_ system includes.
+#define _GNU_SOURCE
+
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/math.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/allocator.h"
 #include "iree/hal/buffer.h"
 #include "iree/hal/buffer_heap_impl.h"
 #include "iree/hal/resource.h"
 
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define IREE_HAL_HEAP_BUFFER_HAVE_PLACEMENT 1
+#endif  // IREE_PLATFORM_ANDROID || IREE_PLATFORM_LINUX
+
 typedef enum iree_hal_heap_buffer_storage_mode_e {
   // Allocated as a [metadata, data] slab.
   // The base metadata pointer must be freed with iree_allocator_free_aligned.
@@ -29,6 +40,10 @@ typedef enum iree_hal_heap_buffer_storage_mode_e {
   // A user-provided buffer release callback is notified that the buffer is no
   // longer referencing the data.
   IREE_HAL_HEAP_BUFFER_STORAGE_MODE_EXTERNAL = 2u,
+  // Allocated as split [metadata] and [data] mapped directly from the system.
+  // The base metadata pointer must be freed with iree_allocator_free.
+  // The data storage must be unmapped with its mapped length.
+  IREE_HAL_HEAP_BUFFER_STORAGE_MODE_MAPPED = 3u,
 } iree_hal_heap_buffer_storage_mode_t;
 
 typedef struct iree_hal_heap_buffer_t {
@@ -41,6 +56,8 @@ typedef struct iree_hal_heap_buffer_t {
     iree_allocator_t data_allocator;
     // Used for IREE_HAL_HEAP_BUFFER_STORAGE_MODE_EXTERNAL.
     iree_hal_buffer_release_callback_t release_callback;
+    // Used for IREE_HAL_HEAP_BUFFER_STORAGE_MODE_MAPPED.
+    iree_host_size_t mapped_length;
   };
 
   // Optional statistics shared with the allocator.
@@ -80,6 +97,135 @@ static iree_status_t iree_hal_heap_buffer_allocate_split(
   return status;
 }
 
+#if defined(IREE_HAL_HEAP_BUFFER_HAVE_PLACEMENT)
+
+// Size of transparent huge pages; mappings requesting them are aligned to this
+// so that the kernel can back the entire range with huge pages.
+#define IREE_HAL_HEAP_BUFFER_TRANSPARENT_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+// MPOL_PREFERRED from linux/mempolicy.h; mbind is called directly via syscall
+// to avoid a dependency on libnuma.
+#define IREE_HAL_HEAP_BUFFER_MPOL_PREFERRED 1
+
+// Maximum NUMA node index supported by the node mask passed to mbind.
+#define IREE_HAL_HEAP_BUFFER_MAX_NUMA_NODE_COUNT 1024
+
+// Sets the memory policy of the (untouched) mapping at |data| to prefer
+// |numa_node|. Advisory only: failures leave the default policy in place.
+static void iree_hal_heap_buffer_prefer_numa_node(void* data,
+                                                  iree_host_size_t length,
+                                                  uint32_t numa_node) {
+#if defined(SYS_mbind)
+  if (numa_node >= IREE_HAL_HEAP_BUFFER_MAX_NUMA_NODE_COUNT) return;
+  unsigned long node_mask[IREE_HAL_HEAP_BUFFER_MAX_NUMA_NODE_COUNT /
+                          (8 * sizeof(unsigned long))] = {0};
+  node_mask[numa_node / (8 * sizeof(unsigned long))] =
+      1ul << (numa_node % (8 * sizeof(unsigned long)));
+  // The kernel treats maxnode as one past the last valid bit.
+  syscall(SYS_mbind, data, length, IREE_HAL_HEAP_BUFFER_MPOL_PREFERRED,
+          node_mask, IREE_HAL_HEAP_BUFFER_MAX_NUMA_NODE_COUNT + 1, 0);
+#endif  // SYS_mbind
+}
+
+// Maps |size| bytes with an anonymous mapping aligned to |alignment|.
+// The unaligned head and tail of an over-sized mapping are unmapped.
+static void* iree_hal_heap_buffer_map_aligned(iree_host_size_t size,
+                                              iree_host_size_t alignment) {
+  const iree_host_size_t padded_size = size + alignment;
+  uint8_t* base = (uint8_t*)mmap(NULL, padded_size, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if ((void*)base == MAP_FAILED) return NULL;
+  uint8_t* data = (uint8_t*)iree_host_align((uintptr_t)base, alignment);
+  const iree_host_size_t head_size = (iree_host_size_t)(data - base);
+  if (head_size > 0) munmap(base, head_size);
+  const iree_host_size_t tail_size = padded_size - head_size - size;
+  if (tail_size > 0) munmap(data + size, tail_size);
+  return data;
+}
+
+// Maps storage for |allocation_size| bytes with the placement requested by
+// |options|. Returns NULL if no mapping could be created and the caller should
+// fall back to a normal allocation.
+static void* iree_hal_heap_buffer_map_placed(
+    const iree_hal_heap_allocator_options_t* options,
+    iree_device_size_t allocation_size, iree_host_size_t* out_mapped_length) {
+  void* data = NULL;
+  iree_host_size_t mapped_length = 0;
+
+#if defined(MAP_HUGETLB)
+  if (iree_any_bit_set(options->flags,
+                       IREE_HAL_HEAP_ALLOCATOR_FLAG_RESERVED_HUGE_PAGES)) {
+    mapped_length = (iree_host_size_t)iree_device_align(
+        allocation_size, options->huge_page_size);
+    int map_flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_SHIFT)
+    map_flags |= (int)iree_math_count_trailing_zeros_u64(
+                     options->huge_page_size)
+                 << MAP_HUGE_SHIFT;
+#endif  // MAP_HUGE_SHIFT
+    data = mmap(NULL, mapped_length, PROT_READ | PROT_WRITE, map_flags, -1, 0);
+    if (data == MAP_FAILED) data = NULL;
+  }
+#endif  // MAP_HUGETLB
+
+  if (!data) {
+    const iree_host_size_t page_size = (iree_host_size_t)sysconf(_SC_PAGESIZE);
+    mapped_length =
+        (iree_host_size_t)iree_device_align(allocation_size, page_size);
+    iree_host_size_t alignment = page_size;
+#if defined(MADV_HUGEPAGE)
+    const bool transparent_huge_pages = iree_any_bit_set(
+        options->flags, IREE_HAL_HEAP_ALLOCATOR_FLAG_TRANSPARENT_HUGE_PAGES);
+    if (transparent_huge_pages) {
+      alignment = IREE_HAL_HEAP_BUFFER_TRANSPARENT_HUGE_PAGE_SIZE;
+    }
+#endif  // MADV_HUGEPAGE
+    data = iree_hal_heap_buffer_map_aligned(mapped_length, alignment);
+    if (!data) return NULL;
+#if defined(MADV_HUGEPAGE)
+    // Advisory only: if huge pages are unavailable we still have regular pages.
+    if (transparent_huge_pages) madvise(data, mapped_length, MADV_HUGEPAGE);
+#endif  // MADV_HUGEPAGE
+  }
+
+  // The policy must be set before the pages are first touched.
+  if (options->numa_node != IREE_HAL_HEAP_ALLOCATOR_NUMA_NODE_ANY) {
+    iree_hal_heap_buffer_prefer_numa_node(data, mapped_length,
+                                          options->numa_node);
+  }
+
+  *out_mapped_length = mapped_length;
+  return data;
+}
+
+// Allocates a buffer with the metadata split from storage mapped directly from
+// the system with the placement requested by |options|. Succeeds with a NULL
+// |out_buffer| if the storage could not be mapped.
+static iree_status_t iree_hal_heap_buffer_allocate_mapped(
+    const iree_hal_heap_allocator_options_t* options,
+    iree_device_size_t allocation_size, iree_allocator_t host_allocator,
+    iree_hal_heap_buffer_t** out_buffer, iree_byte_span_t* out_data,
+    iree_host_size_t* out_mapped_length) {
+  *out_buffer = NULL;
+  iree_host_size_t mapped_length = 0;
+  uint8_t* data_ptr = (uint8_t*)iree_hal_heap_buffer_map_placed(
+      options, allocation_size, &mapped_length);
+  if (!data_ptr) return iree_ok_status();
+  *out_data = iree_make_byte_span(data_ptr, allocation_size);
+  *out_mapped_length = mapped_length;
+
+  // Allocate the host metadata wrapper with natural alignment.
+  iree_status_t status = iree_allocator_malloc(
+      host_allocator, sizeof(**out_buffer), (void**)out_buffer);
+  if (!iree_status_is_ok(status)) {
+    // Need to unmap the storage we just mapped.
+    munmap(data_ptr, mapped_length);
+  }
+  return status;
+}
+
+#endif  // IREE_HAL_HEAP_BUFFER_HAVE_PLACEMENT
+
 // Allocates a buffer with the metadata as a prefix to the storage.
 // This results in a single allocation per buffer but requires that both the
 // metadata and storage live together.
@@ -114,6 +260,7 @@ static iree_status_t iree_hal_heap_buffer_allocate_slab(
 iree_status_t iree_hal_heap_buffer_create(
     iree_hal_allocator_t* allocator,
     iree_hal_heap_allocator_statistics_t* statistics,
+    const iree_hal_heap_allocator_options_t* placement_options,
     const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
     iree_const_byte_span_t initial_data, iree_allocator_t data_allocator,
     iree_allocator_t host_allocator, iree_hal_buffer_t** out_buffer) {
@@ -130,12 +277,30 @@ iree_status_t iree_hal_heap_buffer_create(
 
   iree_hal_heap_buffer_t* buffer = NULL;
   iree_byte_span_t data = iree_make_byte_span(NULL, 0);
-  iree_status_t status =
-      same_allocator
-          ? iree_hal_heap_buffer_allocate_slab(allocation_size, host_allocator,
-                                               &buffer, &data)
-          : iree_hal_heap_buffer_allocate_split(allocation_size, data_allocator,
-                                                host_allocator, &buffer, &data);
+  iree_host_size_t mapped_length = 0;
+  iree_status_t status = iree_ok_status();
+
+#if defined(IREE_HAL_HEAP_BUFFER_HAVE_PLACEMENT)
+  // Large buffers with a requested placement are mapped directly from the
+  // system. If the mapping fails we fall back to the normal allocation path.
+  if (placement_options &&
+      (placement_options->flags != IREE_HAL_HEAP_ALLOCATOR_FLAG_NONE ||
+       placement_options->numa_node != IREE_HAL_HEAP_ALLOCATOR_NUMA_NODE_ANY) &&
+      allocation_size >= placement_options->min_placement_size) {
+    status = iree_hal_heap_buffer_allocate_mapped(
+        placement_options, allocation_size, host_allocator, &buffer, &data,
+        &mapped_length);
+  }
+#endif  // IREE_HAL_HEAP_BUFFER_HAVE_PLACEMENT
+
+  if (iree_status_is_ok(status) && !buffer) {
+    status = same_allocator
+                 ? iree_hal_heap_buffer_allocate_slab(
+                       allocation_size, host_allocator, &buffer, &data)
+                 : iree_hal_heap_buffer_allocate_split(
+                       allocation_size, data_allocator, host_allocator,
+                       &buffer, &data);
+  }
 
   if (iree_status_is_ok(status)) {
     iree_hal_buffer_initialize(host_allocator, allocator, &buffer->base,
@@ -144,7 +309,10 @@ iree_status_t iree_hal_heap_buffer_create(
                                &iree_hal_heap_buffer_vtable, &buffer->base);
     buffer->data = data;
 
-    if (same_allocator) {
+    if (mapped_length > 0) {
+      buffer->base.flags = IREE_HAL_HEAP_BUFFER_STORAGE_MODE_MAPPED;
+      buffer->mapped_length = mapped_length;
+    } else if (same_allocator) {
       buffer->base.flags = IREE_HAL_HEAP_BUFFER_STORAGE_MODE_SLAB;
       buffer->data_allocator = iree_allocator_null();
     } else {
@@ -250,6 +418,13 @@ static void iree_hal_heap_buffer_destroy(iree_hal_buffer_t* base_buffer) {
       iree_allocator_free(host_allocator, buffer);
       break;
     }
+#if defined(IREE_HAL_HEAP_BUFFER_HAVE_PLACEMENT)
+    case IREE_HAL_HEAP_BUFFER_STORAGE_MODE_MAPPED: {
+      munmap(buffer->data.data, buffer->mapped_length);
+      iree_allocator_free(host_allocator, buffer);
+      break;
+    }
+#endif  // IREE_HAL_HEAP_BUFFER_HAVE_PLACEMENT
     default:
       IREE_ASSERT_UNREACHABLE("unhandled buffer storage mode");
       break;
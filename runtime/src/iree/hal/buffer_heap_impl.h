@@ -9,6 +9,7 @@
 
 #include "iree/base/api.h"
 #include "iree/base/internal/synchronization.h"
+#include "iree/hal/allocator.h"
 #include "iree/hal/buffer.h"
 
 #ifdef __cplusplus
@@ -30,9 +31,14 @@ typedef struct iree_hal_heap_allocator_statistics_t {
 // |host_allocator| is used for the iree_hal_buffer_t metadata. If both
 // |data_allocator| and |host_allocator| are the same the buffer will be created
 // as a flat slab. |out_buffer| must be released by the caller.
+//
+// If |placement_options| is provided and the allocation is large enough the
+// storage is mapped directly from the system with the requested placement
+// instead of being allocated from |data_allocator|.
 iree_status_t iree_hal_heap_buffer_create(
     iree_hal_allocator_t* allocator,
     iree_hal_heap_allocator_statistics_t* statistics,
+    const iree_hal_heap_allocator_options_t* placement_options,
     const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
     iree_const_byte_span_t initial_data, iree_allocator_t data_allocator,
     iree_allocator_t host_allocator, iree_hal_buffer_t** out_buffer);
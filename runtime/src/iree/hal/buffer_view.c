@@ -6,7 +6,10 @@
 
 #include "iree/hal/buffer_view.h"
 
+#include <stddef.h>
+
 #include "iree/base/api.h"
+#include "iree/base/internal/atomic_slist.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/allocator.h"
 #include "iree/hal/buffer_view_util.h"
@@ -15,14 +18,52 @@
 struct iree_hal_buffer_view_t {
   iree_atomic_ref_count_t ref_count;
   iree_allocator_t host_allocator;
+  // Pool the view is returned to when released or NULL if the view was
+  // individually allocated. Retained while the view is live.
+  iree_hal_buffer_view_pool_t* pool;
+  // Links the view into the free list of its pool while it is unused.
+  iree_atomic_slist_intrusive_ptr_t slist_next;
   iree_hal_buffer_t* buffer;
   iree_hal_element_type_t element_type;
   iree_hal_encoding_type_t encoding_type;
   iree_device_size_t byte_length;
+  // Total number of dimensions allocated in |shape|.
+  iree_host_size_t shape_capacity;
   iree_host_size_t shape_rank;
   iree_hal_dim_t shape[];
 };
 
+IREE_TYPED_ATOMIC_SLIST_WRAPPER(iree_hal_buffer_view, iree_hal_buffer_view_t,
+                                offsetof(iree_hal_buffer_view_t, slist_next));
+
+struct iree_hal_buffer_view_pool_t {
+  iree_atomic_ref_count_t ref_count;
+  iree_allocator_t host_allocator;
+  // Unused views with IREE_HAL_BUFFER_VIEW_POOL_SHAPE_CAPACITY dimensions of
+  // shape storage. Owned by the pool.
+  iree_hal_buffer_view_slist_t free_list;
+};
+
+// Assigns the buffer, shape, and types of a view with sufficient shape
+// capacity. Any previous buffer must have already been released.
+static void iree_hal_buffer_view_assign(
+    iree_hal_buffer_view_t* buffer_view, iree_hal_buffer_t* buffer,
+    iree_host_size_t shape_rank, const iree_hal_dim_t* shape,
+    iree_hal_element_type_t element_type,
+    iree_hal_encoding_type_t encoding_type) {
+  buffer_view->buffer = buffer;
+  iree_hal_buffer_retain(buffer_view->buffer);
+  buffer_view->element_type = element_type;
+  buffer_view->encoding_type = encoding_type;
+  buffer_view->byte_length =
+      iree_hal_element_dense_byte_count(buffer_view->element_type);
+  buffer_view->shape_rank = shape_rank;
+  for (iree_host_size_t i = 0; i < shape_rank; ++i) {
+    buffer_view->shape[i] = shape[i];
+    buffer_view->byte_length *= shape[i];
+  }
+}
+
 IREE_API_EXPORT iree_status_t iree_hal_buffer_view_create(
     iree_hal_buffer_t* buffer, iree_host_size_t shape_rank,
     const iree_hal_dim_t* shape, iree_hal_element_type_t element_type,
@@ -49,17 +90,10 @@ IREE_API_EXPORT iree_status_t iree_hal_buffer_view_create(
   if (iree_status_is_ok(status)) {
     iree_atomic_ref_count_init(&buffer_view->ref_count);
     buffer_view->host_allocator = host_allocator;
-    buffer_view->buffer = buffer;
-    iree_hal_buffer_retain(buffer_view->buffer);
-    buffer_view->element_type = element_type;
-    buffer_view->encoding_type = encoding_type;
-    buffer_view->byte_length =
-        iree_hal_element_dense_byte_count(buffer_view->element_type);
-    buffer_view->shape_rank = shape_rank;
-    for (iree_host_size_t i = 0; i < shape_rank; ++i) {
-      buffer_view->shape[i] = shape[i];
-      buffer_view->byte_length *= shape[i];
-    }
+    buffer_view->pool = NULL;
+    buffer_view->shape_capacity = shape_rank;
+    iree_hal_buffer_view_assign(buffer_view, buffer, shape_rank, shape,
+                                element_type, encoding_type);
     *out_buffer_view = buffer_view;
   }
 
@@ -67,6 +101,34 @@ IREE_API_EXPORT iree_status_t iree_hal_buffer_view_create(
   return status;
 }
 
+IREE_API_EXPORT iree_status_t iree_hal_buffer_view_reinitialize(
+    iree_hal_buffer_view_t* buffer_view, iree_hal_buffer_t* buffer,
+    iree_host_size_t shape_rank, const iree_hal_dim_t* shape,
+    iree_hal_element_type_t element_type,
+    iree_hal_encoding_type_t encoding_type) {
+  IREE_ASSERT_ARGUMENT(buffer_view);
+  IREE_ASSERT_ARGUMENT(buffer);
+  if (IREE_UNLIKELY(shape_rank > 0 && !shape)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "no shape dimensions specified");
+  }
+  if (IREE_UNLIKELY(shape_rank > buffer_view->shape_capacity)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "buffer view has storage for %zu dimensions but "
+                            "%zu were specified",
+                            buffer_view->shape_capacity, shape_rank);
+  }
+
+  // Retain the new buffer before releasing the old one in case they are the
+  // same.
+  iree_hal_buffer_t* old_buffer = buffer_view->buffer;
+  iree_hal_buffer_view_assign(buffer_view, buffer, shape_rank, shape,
+                              element_type, encoding_type);
+  iree_hal_buffer_release(old_buffer);
+
+  return iree_ok_status();
+}
+
 IREE_API_EXPORT void iree_hal_buffer_view_retain(
     iree_hal_buffer_view_t* buffer_view) {
   if (IREE_LIKELY(buffer_view)) {
@@ -87,7 +149,16 @@ IREE_API_EXPORT void iree_hal_buffer_view_destroy(
   iree_allocator_t host_allocator = buffer_view->host_allocator;
   IREE_TRACE_ZONE_BEGIN(z0);
   iree_hal_buffer_release(buffer_view->buffer);
-  iree_allocator_free(host_allocator, buffer_view);
+  buffer_view->buffer = NULL;
+  iree_hal_buffer_view_pool_t* pool = buffer_view->pool;
+  if (pool) {
+    // Return to the pool for reuse; the pool may be destroyed by the release
+    // (along with this view) if this was the last reference keeping it live.
+    iree_hal_buffer_view_slist_push(&pool->free_list, buffer_view);
+    iree_hal_buffer_view_pool_release(pool);
+  } else {
+    iree_allocator_free(host_allocator, buffer_view);
+  }
   IREE_TRACE_ZONE_END(z0);
 }
 
@@ -233,3 +304,118 @@ IREE_API_EXPORT iree_status_t iree_hal_buffer_view_compute_range(
       buffer_view->encoding_type, indices_count, start_indices, lengths_count,
       lengths, out_start_offset, out_length);
 }
+
+//===----------------------------------------------------------------------===//
+// iree_hal_buffer_view_pool_t
+//===----------------------------------------------------------------------===//
+
+IREE_API_EXPORT iree_status_t iree_hal_buffer_view_pool_create(
+    iree_allocator_t host_allocator, iree_hal_buffer_view_pool_t** out_pool) {
+  IREE_ASSERT_ARGUMENT(out_pool);
+  *out_pool = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_buffer_view_pool_t* pool = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, sizeof(*pool), (void**)&pool);
+  if (iree_status_is_ok(status)) {
+    iree_atomic_ref_count_init(&pool->ref_count);
+    pool->host_allocator = host_allocator;
+    iree_hal_buffer_view_slist_initialize(&pool->free_list);
+    *out_pool = pool;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_buffer_view_pool_destroy(
+    iree_hal_buffer_view_pool_t* pool) {
+  iree_allocator_t host_allocator = pool->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_buffer_view_pool_trim(pool);
+  iree_hal_buffer_view_slist_deinitialize(&pool->free_list);
+  iree_allocator_free(host_allocator, pool);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+IREE_API_EXPORT void iree_hal_buffer_view_pool_retain(
+    iree_hal_buffer_view_pool_t* pool) {
+  if (IREE_LIKELY(pool)) {
+    iree_atomic_ref_count_inc(&pool->ref_count);
+  }
+}
+
+IREE_API_EXPORT void iree_hal_buffer_view_pool_release(
+    iree_hal_buffer_view_pool_t* pool) {
+  if (IREE_LIKELY(pool) && iree_atomic_ref_count_dec(&pool->ref_count) == 1) {
+    iree_hal_buffer_view_pool_destroy(pool);
+  }
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_buffer_view_pool_acquire(
+    iree_hal_buffer_view_pool_t* pool, iree_hal_buffer_t* buffer,
+    iree_host_size_t shape_rank, const iree_hal_dim_t* shape,
+    iree_hal_element_type_t element_type,
+    iree_hal_encoding_type_t encoding_type,
+    iree_hal_buffer_view_t** out_buffer_view) {
+  IREE_ASSERT_ARGUMENT(pool);
+  IREE_ASSERT_ARGUMENT(buffer);
+  IREE_ASSERT_ARGUMENT(out_buffer_view);
+  *out_buffer_view = NULL;
+  if (IREE_UNLIKELY(shape_rank > 0 && !shape)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "no shape dimensions specified");
+  }
+
+  // Views with large shapes are rare and not worth the memory of giving every
+  // pooled view enough storage for them.
+  if (shape_rank > IREE_HAL_BUFFER_VIEW_POOL_SHAPE_CAPACITY) {
+    return iree_hal_buffer_view_create(buffer, shape_rank, shape, element_type,
+                                       encoding_type, pool->host_allocator,
+                                       out_buffer_view);
+  }
+
+  iree_hal_buffer_view_t* buffer_view =
+      iree_hal_buffer_view_slist_pop(&pool->free_list);
+  if (!buffer_view) {
+    IREE_TRACE_ZONE_BEGIN(z0);
+    iree_status_t status = iree_allocator_malloc(
+        pool->host_allocator,
+        sizeof(*buffer_view) +
+            sizeof(iree_hal_dim_t) * IREE_HAL_BUFFER_VIEW_POOL_SHAPE_CAPACITY,
+        (void**)&buffer_view);
+    IREE_TRACE_ZONE_END(z0);
+    IREE_RETURN_IF_ERROR(status);
+    buffer_view->host_allocator = pool->host_allocator;
+    buffer_view->pool = pool;
+    buffer_view->shape_capacity = IREE_HAL_BUFFER_VIEW_POOL_SHAPE_CAPACITY;
+  }
+
+  iree_atomic_ref_count_init(&buffer_view->ref_count);
+  iree_hal_buffer_view_pool_retain(pool);
+  iree_hal_buffer_view_assign(buffer_view, buffer, shape_rank, shape,
+                              element_type, encoding_type);
+  *out_buffer_view = buffer_view;
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT void iree_hal_buffer_view_pool_trim(
+    iree_hal_buffer_view_pool_t* pool) {
+  IREE_ASSERT_ARGUMENT(pool);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_buffer_view_t* head = NULL;
+  iree_hal_buffer_view_slist_flush(
+      &pool->free_list, IREE_ATOMIC_SLIST_FLUSH_ORDER_APPROXIMATE_LIFO, &head,
+      NULL);
+  while (head) {
+    iree_hal_buffer_view_t* next = iree_hal_buffer_view_slist_get_next(head);
+    iree_allocator_free(pool->host_allocator, head);
+    head = next;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+}
@@ -193,6 +193,20 @@ IREE_API_EXPORT iree_status_t iree_hal_buffer_view_create(
     iree_hal_encoding_type_t encoding_type, iree_allocator_t host_allocator,
     iree_hal_buffer_view_t** out_buffer_view);
 
+// Reinitializes |buffer_view| in place to reference |buffer| with the given
+// shape and types. The previously referenced buffer is released.
+//
+// This allows callers producing views at a high rate (such as per-call
+// results) to reuse a view instead of allocating a new one. The caller must
+// hold the only reference to |buffer_view| as any other holder would observe
+// the change. Fails if |shape_rank| exceeds the rank the view was created with
+// (or IREE_HAL_BUFFER_VIEW_POOL_SHAPE_CAPACITY for pooled views).
+IREE_API_EXPORT iree_status_t iree_hal_buffer_view_reinitialize(
+    iree_hal_buffer_view_t* buffer_view, iree_hal_buffer_t* buffer,
+    iree_host_size_t shape_rank, const iree_hal_dim_t* shape,
+    iree_hal_element_type_t element_type,
+    iree_hal_encoding_type_t encoding_type);
+
 // Retains the given |buffer_view| for the caller.
 IREE_API_EXPORT void iree_hal_buffer_view_retain(
     iree_hal_buffer_view_t* buffer_view);
@@ -277,6 +291,50 @@ IREE_API_EXPORT iree_status_t iree_hal_buffer_view_compute_range(
     const iree_hal_dim_t* lengths, iree_device_size_t* out_start_offset,
     iree_device_size_t* out_length);
 
+//===----------------------------------------------------------------------===//
+// iree_hal_buffer_view_pool_t
+//===----------------------------------------------------------------------===//
+
+// Number of shape dimensions stored inline in each view allocated by an
+// iree_hal_buffer_view_pool_t. Views acquired with a higher rank bypass the
+// pool and are individually allocated.
+#define IREE_HAL_BUFFER_VIEW_POOL_SHAPE_CAPACITY 8
+
+// A thread-safe free-list of buffer views.
+// Views acquired from the pool return to it when their last reference is
+// released and are reused by subsequent acquisitions, avoiding an allocation
+// per view in steady state. Each view retains the pool while it is live and
+// the pool frees its unused views when its last reference is released.
+typedef struct iree_hal_buffer_view_pool_t iree_hal_buffer_view_pool_t;
+
+// Creates a buffer view pool allocating views from |host_allocator|.
+// |out_pool| must be released by the caller.
+IREE_API_EXPORT iree_status_t iree_hal_buffer_view_pool_create(
+    iree_allocator_t host_allocator, iree_hal_buffer_view_pool_t** out_pool);
+
+// Retains the given |pool| for the caller.
+IREE_API_EXPORT void iree_hal_buffer_view_pool_retain(
+    iree_hal_buffer_view_pool_t* pool);
+
+// Releases the given |pool| from the caller.
+IREE_API_EXPORT void iree_hal_buffer_view_pool_release(
+    iree_hal_buffer_view_pool_t* pool);
+
+// Acquires a buffer view from |pool| with the given |buffer|, as with
+// iree_hal_buffer_view_create. |out_buffer_view| must be released by the
+// caller, at which point it returns to the pool.
+IREE_API_EXPORT iree_status_t iree_hal_buffer_view_pool_acquire(
+    iree_hal_buffer_view_pool_t* pool, iree_hal_buffer_t* buffer,
+    iree_host_size_t shape_rank, const iree_hal_dim_t* shape,
+    iree_hal_element_type_t element_type,
+    iree_hal_encoding_type_t encoding_type,
+    iree_hal_buffer_view_t** out_buffer_view);
+
+// Frees all unused views in |pool|. Views still in use are unaffected and
+// return to the pool when released.
+IREE_API_EXPORT void iree_hal_buffer_view_pool_trim(
+    iree_hal_buffer_view_pool_t* pool);
+
 //===----------------------------------------------------------------------===//
 // iree_hal_buffer_view_t implementation details
 //===----------------------------------------------------------------------===//
@@ -72,13 +72,14 @@ IREE_HAL_API_RETAIN_RELEASE(command_buffer);
 IREE_API_EXPORT void iree_hal_command_buffer_initialize(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     const iree_hal_command_buffer_vtable_t* vtable,
     iree_hal_command_buffer_t* command_buffer) {
   iree_hal_resource_initialize(vtable, &command_buffer->resource);
   command_buffer->mode = mode;
   command_buffer->allowed_categories = command_categories;
   command_buffer->queue_affinity = queue_affinity;
+  command_buffer->binding_capacity = binding_capacity;
 
   // Perform initialization validation after we allocate/initialize the concrete
   // implementation.
@@ -91,7 +92,7 @@ IREE_API_EXPORT void iree_hal_command_buffer_initialize(
 IREE_API_EXPORT iree_status_t iree_hal_command_buffer_create(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer) {
   IREE_ASSERT_ARGUMENT(device);
   IREE_ASSERT_ARGUMENT(out_command_buffer);
@@ -105,12 +106,20 @@ IREE_API_EXPORT iree_status_t iree_hal_command_buffer_create(
           IREE_STATUS_INVALID_ARGUMENT,
           "inline command buffers must be one-shot and primary");
     }
+    // Inline command buffers execute as they are recorded and the binding
+    // table is not available until submission.
+    if (binding_capacity > 0) {
+      return iree_make_status(
+          IREE_STATUS_INVALID_ARGUMENT,
+          "inline command buffers cannot use binding tables");
+    }
   }
 
   IREE_TRACE_ZONE_BEGIN(z0);
   iree_status_t status =
       IREE_HAL_VTABLE_DISPATCH(device, iree_hal_device, create_command_buffer)(
-          device, mode, command_categories, queue_affinity, out_command_buffer);
+          device, mode, command_categories, queue_affinity, binding_capacity,
+          out_command_buffer);
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
@@ -135,6 +144,50 @@ iree_hal_command_buffer_allowed_categories(
   return command_buffer->allowed_categories;
 }
 
+IREE_API_EXPORT iree_status_t iree_hal_buffer_binding_table_resolve(
+    iree_hal_buffer_binding_table_t binding_table,
+    const iree_hal_descriptor_set_binding_t* binding,
+    iree_hal_descriptor_set_binding_t* out_binding) {
+  IREE_ASSERT_ARGUMENT(binding);
+  IREE_ASSERT_ARGUMENT(out_binding);
+  *out_binding = *binding;
+  if (binding->buffer) return iree_ok_status();
+  if (IREE_UNLIKELY(binding->buffer_slot >= binding_table.count)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "binding table slot %u out of range (table has "
+                            "%" PRIhsz " bindings)",
+                            binding->buffer_slot, binding_table.count);
+  }
+  const iree_hal_buffer_binding_t* entry =
+      &binding_table.bindings[binding->buffer_slot];
+  if (IREE_UNLIKELY(!entry->buffer)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "binding table slot %u has no buffer",
+                            binding->buffer_slot);
+  }
+  if (IREE_UNLIKELY(entry->length != IREE_WHOLE_BUFFER &&
+                    binding->offset > entry->length)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "binding offset %" PRIdsz
+                            " exceeds binding table slot %u length %" PRIdsz,
+                            binding->offset, binding->buffer_slot,
+                            entry->length);
+  }
+  out_binding->buffer = entry->buffer;
+  out_binding->offset = entry->offset + binding->offset;
+  if (binding->length == IREE_WHOLE_BUFFER &&
+      entry->length != IREE_WHOLE_BUFFER) {
+    out_binding->length = entry->length - binding->offset;
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_host_size_t iree_hal_command_buffer_binding_capacity(
+    const iree_hal_command_buffer_t* command_buffer) {
+  IREE_ASSERT_ARGUMENT(command_buffer);
+  return command_buffer->binding_capacity;
+}
+
 IREE_API_EXPORT iree_status_t
 iree_hal_command_buffer_begin(iree_hal_command_buffer_t* command_buffer) {
   IREE_ASSERT_ARGUMENT(command_buffer);
@@ -480,9 +533,9 @@ IREE_API_EXPORT iree_status_t iree_hal_create_transfer_command_buffer(
 
   iree_hal_command_buffer_t* command_buffer = NULL;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_hal_command_buffer_create(device, mode,
-                                         IREE_HAL_COMMAND_CATEGORY_TRANSFER,
-                                         queue_affinity, &command_buffer));
+      z0, iree_hal_command_buffer_create(
+              device, mode, IREE_HAL_COMMAND_CATEGORY_TRANSFER, queue_affinity,
+              /*binding_capacity=*/0, &command_buffer));
 
   iree_status_t status = iree_hal_command_buffer_begin(command_buffer);
   if (iree_status_is_ok(status)) {
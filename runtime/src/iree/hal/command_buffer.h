@@ -193,6 +193,47 @@ static inline iree_hal_label_color_t iree_hal_label_color_unspecified() {
   return color;
 }
 
+// A subrange of a buffer provided to a command buffer at submission time.
+typedef struct iree_hal_buffer_binding_t {
+  // Buffer bound to the binding table slot.
+  iree_hal_buffer_t* buffer;
+  // Offset, in bytes, into the buffer that the binding starts at.
+  // The offsets of the descriptor set bindings referencing the slot are
+  // relative to this.
+  iree_device_size_t offset;
+  // Length, in bytes, of the buffer range available through the slot.
+  // This can be IREE_WHOLE_BUFFER to make the entire remaining buffer
+  // available.
+  iree_device_size_t length;
+} iree_hal_buffer_binding_t;
+
+// A table of buffer bindings used to resolve the binding table slots
+// referenced by a command buffer when it is submitted.
+//
+// Command buffers created with a nonzero binding capacity may record
+// descriptor set bindings that have a NULL buffer and instead reference a
+// |buffer_slot| in the table. This allows a command buffer to be recorded once
+// and submitted many times with different buffers. Tables are only read during
+// the submission call and need not outlive it; the buffers referenced are
+// retained by the implementation until the submission completes.
+typedef struct iree_hal_buffer_binding_table_t {
+  iree_host_size_t count;
+  const iree_hal_buffer_binding_t* bindings;
+} iree_hal_buffer_binding_table_t;
+
+// Returns an empty binding table.
+static inline iree_hal_buffer_binding_table_t
+iree_hal_buffer_binding_table_empty(void) {
+  iree_hal_buffer_binding_table_t table = {0, NULL};
+  return table;
+}
+
+// Returns true if |table| has no bindings.
+static inline bool iree_hal_buffer_binding_table_is_empty(
+    iree_hal_buffer_binding_table_t table) {
+  return table.count == 0;
+}
+
 // Formats a command buffer mode bitfield as a string.
 // See iree_bitfield_format for usage.
 IREE_API_EXPORT iree_string_view_t
@@ -262,10 +303,16 @@ typedef struct iree_hal_command_buffer_t iree_hal_command_buffer_t;
 // |queue_affinity| specifies the device queues the command buffer may be
 // submitted to. The queue affinity provided to iree_hal_device_queue_submit
 // must match or be a subset of the |queue_affinity|.
+//
+// |binding_capacity| specifies the maximum number of binding table slots that
+// descriptor set bindings recorded into the command buffer may reference. When
+// nonzero a iree_hal_buffer_binding_table_t with at least |binding_capacity|
+// bindings must be provided with each submission. Devices that do not support
+// binding tables fail creation when it is nonzero.
 IREE_API_EXPORT iree_status_t iree_hal_command_buffer_create(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer);
 
 // Retains the given |command_buffer| for the caller.
@@ -289,6 +336,21 @@ IREE_API_EXPORT iree_hal_command_category_t
 iree_hal_command_buffer_allowed_categories(
     const iree_hal_command_buffer_t* command_buffer);
 
+// Resolves a descriptor set |binding| that references a slot in
+// |binding_table| to the concrete buffer range it is bound to. Bindings that
+// have a buffer are returned unchanged. The offset of the binding is applied
+// relative to the table entry and a whole-buffer length covers the remainder
+// of the table entry range.
+IREE_API_EXPORT iree_status_t iree_hal_buffer_binding_table_resolve(
+    iree_hal_buffer_binding_table_t binding_table,
+    const iree_hal_descriptor_set_binding_t* binding,
+    iree_hal_descriptor_set_binding_t* out_binding);
+
+// Returns the maximum number of binding table slots that may be referenced by
+// the command buffer. 0 if the command buffer does not use binding tables.
+IREE_API_EXPORT iree_host_size_t iree_hal_command_buffer_binding_capacity(
+    const iree_hal_command_buffer_t* command_buffer);
+
 // Begins recording into the command buffer.
 // The command buffer must not have been recorded already; this is only valid to
 // call once after creation and must be paired with iree_hal_command_buffer_end.
@@ -650,6 +712,7 @@ struct iree_hal_command_buffer_t {
   iree_hal_command_buffer_mode_t mode;
   iree_hal_command_category_t allowed_categories;
   iree_hal_queue_affinity_t queue_affinity;
+  iree_host_size_t binding_capacity;
 
 #if IREE_HAL_COMMAND_BUFFER_VALIDATION_ENABLE
   iree_hal_command_buffer_validation_state_t validation;
@@ -659,7 +722,7 @@ struct iree_hal_command_buffer_t {
 IREE_API_EXPORT void iree_hal_command_buffer_initialize(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     const iree_hal_command_buffer_vtable_t* vtable,
     iree_hal_command_buffer_t* command_buffer);
 
@@ -57,13 +57,9 @@ static iree_status_t iree_hal_command_buffer_validate_buffer_compatibility(
     iree_hal_buffer_compatibility_t required_compatibility,
     iree_hal_buffer_usage_t intended_usage) {
   iree_hal_buffer_compatibility_t allowed_compatibility =
-      iree_hal_allocator_query_compatibility(
-          iree_hal_device_allocator(validation_state->device),
-          (iree_hal_buffer_params_t){
-              .type = iree_hal_buffer_memory_type(buffer),
-              .usage = iree_hal_buffer_allowed_usage(buffer) & intended_usage,
-          },
-          iree_hal_buffer_allocation_size(buffer));
+      iree_hal_allocator_query_buffer_compatibility(
+          iree_hal_device_allocator(validation_state->device), buffer,
+          intended_usage);
   if (!iree_all_bits_set(allowed_compatibility, required_compatibility)) {
 #if IREE_STATUS_MODE
     // Buffer cannot be used on the queue for the given usage.
@@ -395,6 +391,20 @@ iree_status_t iree_hal_command_buffer_push_descriptor_set_validation(
   // TODO(benvanik): validate binding_offset.
   // TODO(benvanik): validate bindings.
 
+  // Bindings without a buffer reference the binding table provided during
+  // submission when the command buffer has one.
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    if (bindings[i].buffer || command_buffer->binding_capacity == 0) continue;
+    if (bindings[i].buffer_slot >= command_buffer->binding_capacity) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "binding %u references binding table slot %u "
+                              "but the command buffer has a capacity of "
+                              "%" PRIhsz,
+                              bindings[i].binding, bindings[i].buffer_slot,
+                              command_buffer->binding_capacity);
+    }
+  }
+
   return iree_ok_status();
 }
 
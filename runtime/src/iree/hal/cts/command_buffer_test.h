@@ -57,7 +57,7 @@ class command_buffer_test : public CtsTestBase {
     IREE_CHECK_OK(iree_hal_command_buffer_create(
         device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
         IREE_HAL_COMMAND_CATEGORY_ANY, IREE_HAL_QUEUE_AFFINITY_ANY,
-        &command_buffer));
+        /*binding_capacity=*/0, &command_buffer));
     IREE_CHECK_OK(iree_hal_command_buffer_begin(command_buffer));
 
     // Fill the pattern.
@@ -88,7 +88,7 @@ TEST_P(command_buffer_test, Create) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   EXPECT_TRUE((iree_hal_command_buffer_allowed_categories(command_buffer) &
                IREE_HAL_COMMAND_CATEGORY_DISPATCH) ==
@@ -102,7 +102,7 @@ TEST_P(command_buffer_test, BeginEnd) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
   IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
@@ -115,7 +115,7 @@ TEST_P(command_buffer_test, SubmitEmpty) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
   IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
@@ -126,12 +126,37 @@ TEST_P(command_buffer_test, SubmitEmpty) {
   iree_hal_command_buffer_release(command_buffer);
 }
 
+TEST_P(command_buffer_test, SubmitWithoutBindingTable) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  iree_status_t status = iree_hal_command_buffer_create(
+      device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
+      IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
+      /*binding_capacity=*/1, &command_buffer);
+  if (iree_status_is_unimplemented(status)) {
+    iree_status_ignore(status);
+    GTEST_SKIP() << "binding tables not supported by this driver";
+  }
+  IREE_ASSERT_OK(status);
+  EXPECT_EQ(1u, iree_hal_command_buffer_binding_capacity(command_buffer));
+
+  IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
+  IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
+
+  // Command buffers with a binding capacity require a binding table.
+  status = SubmitCommandBufferAndWait(IREE_HAL_COMMAND_CATEGORY_DISPATCH,
+                                      command_buffer);
+  EXPECT_EQ(IREE_STATUS_INVALID_ARGUMENT, iree_status_code(status));
+  iree_status_ignore(status);
+
+  iree_hal_command_buffer_release(command_buffer);
+}
+
 TEST_P(command_buffer_test, CopyWholeBuffer) {
   iree_hal_command_buffer_t* command_buffer = NULL;
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_TRANSFER, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   uint8_t i8_val = 0x54;
   std::vector<uint8_t> reference_buffer(kDefaultAllocationSize);
@@ -194,7 +219,7 @@ TEST_P(command_buffer_test, CopySubBuffer) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_TRANSFER, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   iree_hal_buffer_params_t device_params = {0};
   device_params.type =
@@ -446,7 +471,7 @@ TEST_P(command_buffer_test, UpdateBufferWholeBuffer) {
   IREE_CHECK_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_ANY, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
   IREE_CHECK_OK(iree_hal_command_buffer_begin(command_buffer));
 
   // Issue the update_buffer command.
@@ -483,7 +508,7 @@ TEST_P(command_buffer_test, UpdateBufferWithOffsets) {
   IREE_CHECK_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_ANY, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
   IREE_CHECK_OK(iree_hal_command_buffer_begin(command_buffer));
 
   // Issue the update_buffer command.
@@ -530,7 +555,7 @@ TEST_P(command_buffer_test, UpdateBufferSubspan) {
   IREE_CHECK_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_ANY, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
   IREE_CHECK_OK(iree_hal_command_buffer_begin(command_buffer));
 
   // Issue the update_buffer command.
@@ -567,6 +592,64 @@ TEST_P(command_buffer_test, UpdateBufferSubspan) {
   iree_hal_buffer_release(device_buffer);
 }
 
+TEST_P(command_buffer_test, TransfersAcrossBarriers) {
+  iree_device_size_t target_buffer_size = 16;
+  std::vector<uint8_t> source_buffer{0x01, 0x02, 0x03, 0x04};
+
+  iree_hal_buffer_t* device_buffer = NULL;
+  CreateZeroedDeviceBuffer(target_buffer_size, &device_buffer);
+
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_CHECK_OK(iree_hal_command_buffer_create(
+      device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
+      IREE_HAL_COMMAND_CATEGORY_ANY, IREE_HAL_QUEUE_AFFINITY_ANY,
+      /*binding_capacity=*/0, &command_buffer));
+  IREE_CHECK_OK(iree_hal_command_buffer_begin(command_buffer));
+
+  // The copy depends on the update across the first barrier while the fills
+  // are independent of all other transfers.
+  IREE_CHECK_OK(iree_hal_command_buffer_update_buffer(
+      command_buffer, source_buffer.data(), /*source_offset=*/0, device_buffer,
+      /*target_offset=*/0, /*length=*/4));
+  IREE_CHECK_OK(iree_hal_command_buffer_execution_barrier(
+      command_buffer, IREE_HAL_EXECUTION_STAGE_TRANSFER,
+      IREE_HAL_EXECUTION_STAGE_TRANSFER, IREE_HAL_EXECUTION_BARRIER_FLAG_NONE,
+      /*memory_barrier_count=*/0, NULL, /*buffer_barrier_count=*/0, NULL));
+  uint8_t fill_pattern = 0xFF;
+  IREE_CHECK_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, device_buffer, /*target_offset=*/4, /*length=*/4,
+      &fill_pattern, sizeof(fill_pattern)));
+  IREE_CHECK_OK(iree_hal_command_buffer_copy_buffer(
+      command_buffer, /*source_buffer=*/device_buffer, /*source_offset=*/0,
+      /*target_buffer=*/device_buffer, /*target_offset=*/8, /*length=*/4));
+  IREE_CHECK_OK(iree_hal_command_buffer_execution_barrier(
+      command_buffer, IREE_HAL_EXECUTION_STAGE_TRANSFER,
+      IREE_HAL_EXECUTION_STAGE_TRANSFER, IREE_HAL_EXECUTION_BARRIER_FLAG_NONE,
+      /*memory_barrier_count=*/0, NULL, /*buffer_barrier_count=*/0, NULL));
+  fill_pattern = 0xAA;
+  IREE_CHECK_OK(iree_hal_command_buffer_fill_buffer(
+      command_buffer, device_buffer, /*target_offset=*/12, /*length=*/4,
+      &fill_pattern, sizeof(fill_pattern)));
+
+  IREE_CHECK_OK(iree_hal_command_buffer_end(command_buffer));
+  IREE_CHECK_OK(SubmitCommandBufferAndWait(IREE_HAL_COMMAND_CATEGORY_ANY,
+                                           command_buffer));
+
+  std::vector<uint8_t> actual_data(target_buffer_size);
+  IREE_ASSERT_OK(iree_hal_device_transfer_d2h(
+      device_, device_buffer, /*source_offset=*/0, actual_data.data(),
+      actual_data.size(), IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT,
+      iree_infinite_timeout()));
+  std::vector<uint8_t> reference_buffer{0x01, 0x02, 0x03, 0x04,  //
+                                        0xFF, 0xFF, 0xFF, 0xFF,  //
+                                        0x01, 0x02, 0x03, 0x04,  //
+                                        0xAA, 0xAA, 0xAA, 0xAA};
+  EXPECT_THAT(actual_data, ContainerEq(reference_buffer));
+
+  iree_hal_command_buffer_release(command_buffer);
+  iree_hal_buffer_release(device_buffer);
+}
+
 }  // namespace cts
 }  // namespace hal
 }  // namespace iree
@@ -106,6 +106,7 @@ class CtsTestBase : public ::testing::TestWithParam<std::string> {
     iree_hal_command_buffer_t* command_buffer_ptrs[] = {command_buffer};
     submission_batch.command_buffer_count = IREE_ARRAYSIZE(command_buffer_ptrs);
     submission_batch.command_buffers = command_buffer_ptrs;
+    submission_batch.binding_tables = NULL;
 
     // One signal semaphore from 0 -> 1.
     iree_hal_semaphore_t* signal_semaphore_ptrs[] = {signal_semaphore};
@@ -35,7 +35,7 @@ TEST_P(event_test, SignalAndReset) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
   IREE_ASSERT_OK(iree_hal_command_buffer_signal_event(
@@ -60,11 +60,11 @@ TEST_P(event_test, SubmitWithChainedCommandBuffers) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer_1));
+      /*binding_capacity=*/0, &command_buffer_1));
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer_2));
+      /*binding_capacity=*/0, &command_buffer_2));
 
   // First command buffer signals the event when it completes.
   IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer_1));
@@ -94,6 +94,7 @@ TEST_P(event_test, SubmitWithChainedCommandBuffers) {
                                                       command_buffer_2};
   submission_batch.command_buffer_count = IREE_ARRAYSIZE(command_buffer_ptrs);
   submission_batch.command_buffers = command_buffer_ptrs;
+  submission_batch.binding_tables = NULL;
   iree_hal_semaphore_t* signal_semaphore;
   IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &signal_semaphore));
   iree_hal_semaphore_t* signal_semaphore_ptrs[] = {signal_semaphore};
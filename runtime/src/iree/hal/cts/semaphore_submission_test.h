@@ -29,6 +29,7 @@ TEST_P(semaphore_submission_test, SubmitWithNoCommandBuffers) {
   submission_batch.wait_semaphores.payload_values = NULL;
   submission_batch.command_buffer_count = 0;
   submission_batch.command_buffers = NULL;
+  submission_batch.binding_tables = NULL;
   iree_hal_semaphore_t* signal_semaphore = NULL;
   IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &signal_semaphore));
   iree_hal_semaphore_t* signal_semaphore_ptrs[] = {signal_semaphore};
@@ -53,7 +54,7 @@ TEST_P(semaphore_submission_test, SubmitAndSignal) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
   IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
@@ -65,6 +66,7 @@ TEST_P(semaphore_submission_test, SubmitAndSignal) {
   submission_batch.wait_semaphores.payload_values = NULL;
   submission_batch.command_buffer_count = 1;
   submission_batch.command_buffers = &command_buffer;
+  submission_batch.binding_tables = NULL;
   iree_hal_semaphore_t* signal_semaphore = NULL;
   IREE_ASSERT_OK(iree_hal_semaphore_create(device_, 0ull, &signal_semaphore));
   iree_hal_semaphore_t* signal_semaphore_ptrs[] = {signal_semaphore};
@@ -91,7 +93,7 @@ TEST_P(semaphore_submission_test, SubmitWithWait) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
   IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
   IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
 
@@ -110,6 +112,7 @@ TEST_P(semaphore_submission_test, SubmitWithWait) {
   submission_batch.wait_semaphores.payload_values = wait_payload_values;
   submission_batch.command_buffer_count = 1;
   submission_batch.command_buffers = &command_buffer;
+  submission_batch.binding_tables = NULL;
   submission_batch.signal_semaphores.count =
       IREE_ARRAYSIZE(signal_semaphore_ptrs);
   submission_batch.signal_semaphores.semaphores = signal_semaphore_ptrs;
@@ -140,7 +143,7 @@ TEST_P(semaphore_submission_test, SubmitWithMultipleSemaphores) {
   IREE_ASSERT_OK(iree_hal_command_buffer_create(
       device_, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT,
       IREE_HAL_COMMAND_CATEGORY_DISPATCH, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      /*binding_capacity=*/0, &command_buffer));
 
   IREE_ASSERT_OK(iree_hal_command_buffer_begin(command_buffer));
   IREE_ASSERT_OK(iree_hal_command_buffer_end(command_buffer));
@@ -165,6 +168,7 @@ TEST_P(semaphore_submission_test, SubmitWithMultipleSemaphores) {
   submission_batch.wait_semaphores.payload_values = wait_payload_values;
   submission_batch.command_buffer_count = 1;
   submission_batch.command_buffers = &command_buffer;
+  submission_batch.binding_tables = NULL;
   submission_batch.signal_semaphores.count =
       IREE_ARRAYSIZE(signal_semaphore_ptrs);
   submission_batch.signal_semaphores.semaphores = signal_semaphore_ptrs;
@@ -40,7 +40,9 @@ typedef struct iree_hal_descriptor_set_binding_t {
   // same binding number in the executable interface.
   uint32_t binding;
   // Buffer bound to the binding number.
-  // May be NULL if the binding is not used by the executable.
+  // May be NULL if the binding is not used by the executable or if the buffer
+  // is resolved from |buffer_slot| of the binding table provided at submission
+  // time (only on command buffers created with a nonzero binding capacity).
   iree_hal_buffer_t* buffer;
   // Offset, in bytes, into the buffer that the binding starts at.
   // If the descriptor type is dynamic this will be added to the dynamic
@@ -52,6 +54,10 @@ typedef struct iree_hal_descriptor_set_binding_t {
   // will fail. If the descriptor type is dynamic this will be used for all
   // ranges regardless of offset.
   iree_device_size_t length;
+  // Binding table slot the buffer is resolved from when |buffer| is NULL.
+  // |offset| and |length| are relative to the range of the binding table entry.
+  // See iree_hal_buffer_binding_table_t.
+  uint32_t buffer_slot;
 } iree_hal_descriptor_set_binding_t;
 
 //===----------------------------------------------------------------------===//
@@ -36,6 +36,15 @@ IREE_API_EXPORT iree_hal_allocator_t* iree_hal_device_allocator(
   return _VTABLE_DISPATCH(device, device_allocator)(device);
 }
 
+IREE_API_EXPORT void iree_hal_device_replace_allocator(
+    iree_hal_device_t* device, iree_hal_allocator_t* new_allocator) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(new_allocator);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  _VTABLE_DISPATCH(device, replace_device_allocator)(device, new_allocator);
+  IREE_TRACE_ZONE_END(z0);
+}
+
 IREE_API_EXPORT
 iree_status_t iree_hal_device_trim(iree_hal_device_t* device) {
   IREE_ASSERT_ARGUMENT(device);
@@ -218,6 +227,52 @@ IREE_API_EXPORT iree_status_t iree_hal_device_transfer_and_wait(
   return status;
 }
 
+IREE_API_EXPORT iree_status_t iree_hal_device_queue_alloca(
+    iree_hal_device_t* device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(
+      !wait_semaphore_list.count ||
+      (wait_semaphore_list.semaphores && wait_semaphore_list.payload_values));
+  IREE_ASSERT_ARGUMENT(!signal_semaphore_list.count ||
+                       (signal_semaphore_list.semaphores &&
+                        signal_semaphore_list.payload_values));
+  IREE_ASSERT_ARGUMENT(out_buffer);
+  *out_buffer = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)allocation_size);
+  iree_hal_buffer_params_canonicalize(&params);
+  iree_status_t status = _VTABLE_DISPATCH(device, queue_alloca)(
+      device, queue_affinity, wait_semaphore_list, signal_semaphore_list,
+      params, allocation_size, out_buffer);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_device_queue_dealloca(
+    iree_hal_device_t* device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(
+      !wait_semaphore_list.count ||
+      (wait_semaphore_list.semaphores && wait_semaphore_list.payload_values));
+  IREE_ASSERT_ARGUMENT(!signal_semaphore_list.count ||
+                       (signal_semaphore_list.semaphores &&
+                        signal_semaphore_list.payload_values));
+  IREE_ASSERT_ARGUMENT(buffer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status = _VTABLE_DISPATCH(device, queue_dealloca)(
+      device, queue_affinity, wait_semaphore_list, signal_semaphore_list,
+      buffer);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 // Validates that the submission is well-formed.
 static iree_status_t iree_hal_device_validate_submission(
     iree_host_size_t batch_count, const iree_hal_submission_batch_t* batches) {
@@ -236,6 +291,23 @@ static iree_status_t iree_hal_device_validate_submission(
             "inline command buffer submitted with a wait; inline command "
             "buffers must be ready to execute immediately");
       }
+      iree_host_size_t binding_capacity =
+          iree_hal_command_buffer_binding_capacity(
+              batches[i].command_buffers[j]);
+      if (binding_capacity > 0) {
+        // Slots are validated against the capacity during recording and
+        // implementations rely on the table covering all of them.
+        iree_host_size_t binding_count =
+            batches[i].binding_tables ? batches[i].binding_tables[j].count : 0;
+        if (binding_count < binding_capacity) {
+          return iree_make_status(
+              IREE_STATUS_INVALID_ARGUMENT,
+              "command buffer %" PRIhsz " in batch %" PRIhsz
+              " requires a binding table with at least %" PRIhsz
+              " bindings but %" PRIhsz " were provided",
+              j, i, binding_capacity, binding_count);
+        }
+      }
     }
   }
   return iree_ok_status();
@@ -294,3 +366,24 @@ iree_hal_device_wait_idle(iree_hal_device_t* device, iree_timeout_t timeout) {
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
+
+IREE_API_EXPORT iree_status_t iree_hal_device_profiling_begin(
+    iree_hal_device_t* device,
+    const iree_hal_device_profiling_options_t* options) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status =
+      _VTABLE_DISPATCH(device, profiling_begin)(device, options);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+IREE_API_EXPORT iree_status_t
+iree_hal_device_profiling_end(iree_hal_device_t* device) {
+  IREE_ASSERT_ARGUMENT(device);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status = _VTABLE_DISPATCH(device, profiling_end)(device);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -162,6 +162,12 @@ typedef struct iree_hal_semaphore_list_t {
   uint64_t* payload_values;
 } iree_hal_semaphore_list_t;
 
+// Returns an empty semaphore list.
+static inline iree_hal_semaphore_list_t iree_hal_semaphore_list_empty(void) {
+  iree_hal_semaphore_list_t list = {0, NULL, NULL};
+  return list;
+}
+
 // A single batch of command buffers submitted to a device queue.
 // All of the wait semaphores must reach or exceed the given payload value prior
 // to the batch beginning execution. Each command buffer begins execution in the
@@ -184,6 +190,12 @@ typedef struct iree_hal_submission_batch_t {
   iree_host_size_t command_buffer_count;
   iree_hal_command_buffer_t** command_buffers;
 
+  // Optional binding tables used to resolve the binding table slots of the
+  // command buffers, one per command buffer. May be NULL if no command buffer
+  // in the batch was created with a binding capacity. Command buffers without
+  // a binding capacity ignore their table.
+  const iree_hal_buffer_binding_table_t* binding_tables;
+
   // Semaphores to signal once all command buffers have completed execution.
   iree_hal_semaphore_list_t signal_semaphores;
 } iree_hal_submission_batch_t;
@@ -223,6 +235,18 @@ iree_hal_device_host_allocator(iree_hal_device_t* device);
 IREE_API_EXPORT iree_hal_allocator_t* iree_hal_device_allocator(
     iree_hal_device_t* device);
 
+// Replaces the allocator of the device with |new_allocator|, which is retained
+// by the device. This is intended for wrapping the default allocator with one
+// that adds tracking, caching, or other behavior on top of it, as in:
+//   iree_hal_allocator_t* base = iree_hal_device_allocator(device);
+//   iree_hal_some_allocator_create(base, ..., &wrapped);
+//   iree_hal_device_replace_allocator(device, wrapped);
+//
+// Must be called before any buffers are allocated from the device as existing
+// buffers may still refer to the prior allocator. Not thread-safe.
+IREE_API_EXPORT void iree_hal_device_replace_allocator(
+    iree_hal_device_t* device, iree_hal_allocator_t* new_allocator);
+
 // Trims pools and caches used by the HAL to the minimum required for live
 // allocations. This can be used on low-memory conditions or when
 // suspending/parking instances.
@@ -326,6 +350,42 @@ IREE_API_EXPORT iree_status_t iree_hal_device_transfer_and_wait(
     const iree_hal_transfer_command_t* transfer_commands,
     iree_timeout_t timeout);
 
+// Reserves and returns a device-local queue-ordered transient buffer.
+// The allocation will not be committed until the entire |wait_semaphore_list|
+// has been reached. Once the storage is available for use the
+// |signal_semaphore_list| will be signaled. The contents of the buffer are
+// undefined until signaled and it must not be used (even by queue operations)
+// prior to that. The returned buffer handle may be retained and placed into
+// command buffers while awaiting the signal.
+//
+// Implementations may reuse the storage of buffers deallocated with
+// iree_hal_device_queue_dealloca once the work using them has completed (or
+// is known to complete before the |wait_semaphore_list|) without host
+// synchronization.
+//
+// |out_buffer| must be released by the caller.
+IREE_API_EXPORT iree_status_t iree_hal_device_queue_alloca(
+    iree_hal_device_t* device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer);
+
+// Enqueues a deallocation of a transient buffer allocated with
+// iree_hal_device_queue_alloca. The storage of the buffer may be reused once
+// the |wait_semaphore_list| has been reached and the |signal_semaphore_list|
+// will be signaled afterward. The buffer must not be used by the caller or any
+// queue operation ordered after the deallocation and the caller must still
+// release its reference.
+//
+// Buffers not allocated with iree_hal_device_queue_alloca are not deallocated
+// and the operation only orders the semaphores.
+IREE_API_EXPORT iree_status_t iree_hal_device_queue_dealloca(
+    iree_hal_device_t* device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer);
+
 // Submits one or more batches of work to a device queue.
 //
 // The queue is selected based on the flags set in |command_categories| and the
@@ -398,6 +458,48 @@ IREE_API_EXPORT iree_status_t iree_hal_device_wait_semaphores(
 IREE_API_EXPORT iree_status_t
 iree_hal_device_wait_idle(iree_hal_device_t* device, iree_timeout_t timeout);
 
+// Bitfield specifying which device operations are captured while profiling.
+enum iree_hal_device_profiling_mode_bits_t {
+  IREE_HAL_DEVICE_PROFILING_MODE_NONE = 0u,
+
+  // Captures the execution of each dispatch including its executable, export
+  // ordinal, workgroup count, wall time, and (on devices that execute
+  // dispatches on host worker threads) the distribution of its workgroups
+  // across workers.
+  IREE_HAL_DEVICE_PROFILING_MODE_DISPATCHES = 1u << 0,
+};
+typedef uint32_t iree_hal_device_profiling_mode_t;
+
+// Controls profiling options.
+typedef struct iree_hal_device_profiling_options_t {
+  // Which profiling data is captured. Implementations ignore modes they do not
+  // support.
+  iree_hal_device_profiling_mode_t mode;
+
+  // Path of the file the capture is written to when profiling ends. The
+  // format of the file is implementation-defined.
+  const char* file_path;
+} iree_hal_device_profiling_options_t;
+
+// Begins a profile capture on |device| with the given |options|.
+// All supported operations submitted to the device are captured until
+// iree_hal_device_profiling_end is called. If the device does not support
+// profiling or any of the requested modes this is a no-op.
+//
+// Profiling is intended for tooling and must not be started or ended
+// concurrently with other operations on the device. Only one capture may be
+// active at a time.
+IREE_API_EXPORT iree_status_t iree_hal_device_profiling_begin(
+    iree_hal_device_t* device,
+    const iree_hal_device_profiling_options_t* options);
+
+// Ends a profile capture previously started with
+// iree_hal_device_profiling_begin. Waits for all outstanding work on the
+// device to complete and then writes the capture. A no-op if no capture is
+// active.
+IREE_API_EXPORT iree_status_t
+iree_hal_device_profiling_end(iree_hal_device_t* device);
+
 //===----------------------------------------------------------------------===//
 // iree_hal_device_t implementation details
 //===----------------------------------------------------------------------===//
@@ -410,6 +512,8 @@ typedef struct iree_hal_device_vtable_t {
   iree_allocator_t(IREE_API_PTR* host_allocator)(iree_hal_device_t* device);
   iree_hal_allocator_t*(IREE_API_PTR* device_allocator)(
       iree_hal_device_t* device);
+  void(IREE_API_PTR* replace_device_allocator)(
+      iree_hal_device_t* device, iree_hal_allocator_t* new_allocator);
 
   iree_status_t(IREE_API_PTR* trim)(iree_hal_device_t* device);
 
@@ -422,6 +526,7 @@ typedef struct iree_hal_device_vtable_t {
       iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
       iree_hal_command_category_t command_categories,
       iree_hal_queue_affinity_t queue_affinity,
+      iree_host_size_t binding_capacity,
       iree_hal_command_buffer_t** out_command_buffer);
 
   iree_status_t(IREE_API_PTR* create_descriptor_set)(
@@ -464,6 +569,19 @@ typedef struct iree_hal_device_vtable_t {
       iree_device_size_t target_offset, iree_device_size_t data_length,
       iree_hal_transfer_buffer_flags_t flags, iree_timeout_t timeout);
 
+  iree_status_t(IREE_API_PTR* queue_alloca)(
+      iree_hal_device_t* device, iree_hal_queue_affinity_t queue_affinity,
+      const iree_hal_semaphore_list_t wait_semaphore_list,
+      const iree_hal_semaphore_list_t signal_semaphore_list,
+      iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+      iree_hal_buffer_t** IREE_RESTRICT out_buffer);
+
+  iree_status_t(IREE_API_PTR* queue_dealloca)(
+      iree_hal_device_t* device, iree_hal_queue_affinity_t queue_affinity,
+      const iree_hal_semaphore_list_t wait_semaphore_list,
+      const iree_hal_semaphore_list_t signal_semaphore_list,
+      iree_hal_buffer_t* buffer);
+
   iree_status_t(IREE_API_PTR* queue_submit)(
       iree_hal_device_t* device, iree_hal_command_category_t command_categories,
       iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
@@ -482,6 +600,11 @@ typedef struct iree_hal_device_vtable_t {
 
   iree_status_t(IREE_API_PTR* wait_idle)(iree_hal_device_t* device,
                                          iree_timeout_t timeout);
+
+  iree_status_t(IREE_API_PTR* profiling_begin)(
+      iree_hal_device_t* device,
+      const iree_hal_device_profiling_options_t* options);
+  iree_status_t(IREE_API_PTR* profiling_end)(iree_hal_device_t* device);
 } iree_hal_device_vtable_t;
 IREE_HAL_ASSERT_VTABLE_LAYOUT(iree_hal_device_vtable_t);
 
@@ -28,8 +28,10 @@ typedef enum iree_hal_cuda_command_buffer_mode_e {
 // Must be initialized with iree_hal_cuda_device_params_initialize prior to use.
 typedef struct iree_hal_cuda_device_params_t {
   // Number of queues exposed on the device.
-  // Each queue acts as a separate synchronization scope where all work executes
-  // concurrently unless prohibited by semaphores.
+  // Each queue is backed by its own CUDA stream and acts as a separate
+  // synchronization scope where all work executes concurrently unless
+  // prohibited by semaphores. Submissions select a queue by hashing their
+  // queue affinity.
   iree_host_size_t queue_count;
 
   // Total size of each block in the device shared block pool.
@@ -44,6 +46,29 @@ typedef struct iree_hal_cuda_device_params_t {
   // Only command buffers produced by the compiler that have the
   // IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION bit set will use this.
   bool allow_inline_execution;
+
+  // Services queue-ordered allocations (iree_hal_device_queue_alloca and
+  // iree_hal_device_queue_dealloca) of device-local memory from a
+  // stream-ordered CUDA memory pool with cuMemAllocFromPoolAsync and
+  // cuMemFreeAsync. Ignored if the driver or device does not support memory
+  // pools.
+  bool async_allocations;
+
+  // Bytes of freed memory the stream-ordered pool retains for reuse instead of
+  // releasing it back to the system when streams synchronize. UINT64_MAX
+  // retains all memory until the device is trimmed.
+  uint64_t async_allocation_release_threshold;
+
+  // Size in bytes of the page-locked host staging ring used by
+  // iree_hal_device_transfer_range to move data between host memory and
+  // device-local memory on a dedicated copy stream. The memory is allocated on
+  // first use. 0 disables the ring and uses the generic transfer path.
+  iree_host_size_t staging_ring_capacity;
+
+  // Existing directory where cubins JIT compiled from executable PTX are
+  // persisted and reused across processes. Empty disables the cache and leaves
+  // compilation to the driver on each load. Copied by the device on creation.
+  iree_string_view_t cubin_cache_path;
 } iree_hal_cuda_device_params_t;
 
 // Initializes |out_params| to default values.
@@ -75,6 +100,23 @@ IREE_API_EXPORT iree_status_t iree_hal_cuda_driver_create(
 
 // TODO(thomasraoux): Support importing a CUcontext from app.
 
+//===----------------------------------------------------------------------===//
+// iree_hal_cuda_device_t
+//===----------------------------------------------------------------------===//
+
+// Enables |device| to directly access memory allocated on |peer_device| over
+// a peer-to-peer link. Once enabled device-local buffers allocated from the
+// |peer_device| allocator are compatible with dispatches on |device| and
+// copies between the devices no longer stage through host memory. Access is
+// one-way; enable it with the devices swapped to access memory in both
+// directions. Enabling access that is already enabled is a no-op.
+//
+// Both devices must be CUDA devices and |peer_device| must outlive any use of
+// its buffers on |device|. Fails with IREE_STATUS_UNAVAILABLE if the devices
+// do not support peer access.
+IREE_API_EXPORT iree_status_t iree_hal_cuda_device_enable_peer_access(
+    iree_hal_device_t* device, iree_hal_device_t* peer_device);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
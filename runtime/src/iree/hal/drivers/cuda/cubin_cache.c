@@ -0,0 +1,217 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/cuda/cubin_cache.h"
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "iree/base/internal/file_io.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/drivers/cuda/dynamic_symbols.h"
+#include "iree/hal/drivers/cuda/status_util.h"
+
+struct iree_hal_cuda_cubin_cache_t {
+  iree_allocator_t host_allocator;
+
+  // Properties of the device and driver that compiled cubins depend on.
+  int compute_capability_major;
+  int compute_capability_minor;
+  int driver_version;
+
+  // Cache directory; stored in the same allocation as the cache.
+  iree_string_view_t path;
+};
+
+iree_status_t iree_hal_cuda_cubin_cache_allocate(
+    iree_hal_cuda_context_wrapper_t* context, CUdevice device,
+    iree_string_view_t path, iree_hal_cuda_cubin_cache_t** out_cache) {
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(out_cache);
+  *out_cache = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  int compute_capability_major = 0;
+  int compute_capability_minor = 0;
+  int driver_version = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(
+              context->syms,
+              cuDeviceGetAttribute(&compute_capability_major,
+                                   CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR,
+                                   device),
+              "cuDeviceGetAttribute"));
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(
+              context->syms,
+              cuDeviceGetAttribute(&compute_capability_minor,
+                                   CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR,
+                                   device),
+              "cuDeviceGetAttribute"));
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0,
+      CU_RESULT_TO_STATUS(context->syms, cuDriverGetVersion(&driver_version),
+                          "cuDriverGetVersion"));
+
+  iree_hal_cuda_cubin_cache_t* cache = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(context->host_allocator,
+                                sizeof(*cache) + path.size, (void**)&cache));
+  cache->host_allocator = context->host_allocator;
+  cache->compute_capability_major = compute_capability_major;
+  cache->compute_capability_minor = compute_capability_minor;
+  cache->driver_version = driver_version;
+  char* path_storage = (char*)cache + sizeof(*cache);
+  memcpy(path_storage, path.data, path.size);
+  cache->path = iree_make_string_view(path_storage, path.size);
+
+  *out_cache = cache;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+void iree_hal_cuda_cubin_cache_free(iree_hal_cuda_cubin_cache_t* cache) {
+  if (!cache) return;
+  iree_allocator_free(cache->host_allocator, cache);
+}
+
+// Returns the 64-bit FNV-1a hash of |data|.
+static uint64_t iree_hal_cuda_cubin_cache_hash(iree_string_view_t data) {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  for (iree_host_size_t i = 0; i < data.size; ++i) {
+    hash = (hash ^ (uint8_t)data.data[i]) * 0x00000100000001B3ull;
+  }
+  return hash;
+}
+
+// Allocates the NUL-terminated path of the cache entry for |ptx_image| in
+// |out_file_path|. The caller must free it with the cache host allocator.
+static iree_status_t iree_hal_cuda_cubin_cache_make_file_path(
+    iree_hal_cuda_cubin_cache_t* cache, iree_string_view_t ptx_image,
+    char** out_file_path) {
+  const uint64_t hash = iree_hal_cuda_cubin_cache_hash(ptx_image);
+  const char* format = "%.*s/%016" PRIx64 "_sm%d%d_%d.cubin";
+  int length = snprintf(NULL, 0, format, (int)cache->path.size,
+                        cache->path.data, hash, cache->compute_capability_major,
+                        cache->compute_capability_minor, cache->driver_version);
+  if (length < 0) {
+    return iree_make_status(IREE_STATUS_INTERNAL,
+                            "failed to format cubin cache path");
+  }
+  char* file_path = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      cache->host_allocator, (iree_host_size_t)length + 1, (void**)&file_path));
+  snprintf(file_path, (size_t)length + 1, format, (int)cache->path.size,
+           cache->path.data, hash, cache->compute_capability_major,
+           cache->compute_capability_minor, cache->driver_version);
+  *out_file_path = file_path;
+  return iree_ok_status();
+}
+
+// Loads the cached cubin at |file_path| into |out_module|. Fails if the entry
+// does not exist or the driver rejects it.
+static iree_status_t iree_hal_cuda_cubin_cache_load_entry(
+    iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_cubin_cache_t* cache, const char* file_path,
+    CUmodule* out_module) {
+  iree_file_contents_t* contents = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_file_read_contents(file_path, cache->host_allocator, &contents));
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      context->syms, cuModuleLoadData(out_module, contents->const_buffer.data),
+      "cuModuleLoadData");
+  iree_file_contents_free(contents);
+  return status;
+}
+
+// JIT compiles |ptx_image| into a cubin, loads it into |out_module|, and writes
+// it to the cache entry at |file_path|. Failing to write the entry is not an
+// error as the module is still usable.
+static iree_status_t iree_hal_cuda_cubin_cache_compile_entry(
+    iree_hal_cuda_context_wrapper_t* context, iree_string_view_t ptx_image,
+    const char* file_path, CUmodule* out_module) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, ptx_image.size);
+
+  CUlinkState link_state = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(context->syms,
+                              cuLinkCreate(/*numOptions=*/0, /*options=*/NULL,
+                                           /*optionValues=*/NULL, &link_state),
+                              "cuLinkCreate"));
+
+  // The size of PTX input includes the NUL terminator.
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      context->syms,
+      cuLinkAddData(link_state, CU_JIT_INPUT_PTX, (void*)ptx_image.data,
+                    ptx_image.size + 1, /*name=*/"executable",
+                    /*numOptions=*/0, /*options=*/NULL,
+                    /*optionValues=*/NULL),
+      "cuLinkAddData");
+  void* cubin = NULL;
+  size_t cubin_size = 0;
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(
+        context->syms, cuLinkComplete(link_state, &cubin, &cubin_size),
+        "cuLinkComplete");
+  }
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(context->syms,
+                                 cuModuleLoadData(out_module, cubin),
+                                 "cuModuleLoadData");
+  }
+  if (iree_status_is_ok(status)) {
+    // TODO: write to a temporary file and rename to avoid other processes
+    // observing partially written entries. Today they are rejected by the
+    // driver when loaded and the PTX is compiled again.
+    iree_status_ignore(iree_file_write_contents(
+        file_path, iree_make_const_byte_span(cubin, cubin_size)));
+  }
+
+  // The cubin is owned by the link state.
+  CUDA_IGNORE_ERROR(context->syms, cuLinkDestroy(link_state));
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_hal_cuda_cubin_cache_load_module(
+    iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_cubin_cache_t* cache, iree_string_view_t ptx_image,
+    CUmodule* out_module) {
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(out_module);
+  *out_module = NULL;
+  if (!cache) {
+    return CU_RESULT_TO_STATUS(
+        context->syms,
+        cuModuleLoadDataEx(out_module, ptx_image.data, 0, NULL, NULL),
+        "cuModuleLoadDataEx");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  char* file_path = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0,
+      iree_hal_cuda_cubin_cache_make_file_path(cache, ptx_image, &file_path));
+
+  iree_status_t status = iree_hal_cuda_cubin_cache_load_entry(
+      context, cache, file_path, out_module);
+  if (iree_status_is_ok(status)) {
+    IREE_TRACE_ZONE_APPEND_TEXT(z0, "hit");
+  } else {
+    // Missing or stale entries are recompiled and overwritten.
+    iree_status_ignore(status);
+    IREE_TRACE_ZONE_APPEND_TEXT(z0, "miss");
+    status = iree_hal_cuda_cubin_cache_compile_entry(context, ptx_image,
+                                                     file_path, out_module);
+  }
+
+  iree_allocator_free(cache->host_allocator, file_path);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
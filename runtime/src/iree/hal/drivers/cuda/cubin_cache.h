@@ -0,0 +1,53 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_CUDA_CUBIN_CACHE_H_
+#define IREE_HAL_DRIVERS_CUDA_CUBIN_CACHE_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/drivers/cuda/context_wrapper.h"
+#include "iree/hal/drivers/cuda/cuda_headers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// A persistent on-disk cache of cubins JIT compiled from PTX.
+//
+// Loading a PTX module makes the driver JIT compile it for the device on every
+// process start which dominates the cold start time of large programs. With
+// the cache the PTX is compiled explicitly with the cuLink* APIs and the
+// resulting cubin is written to the cache directory. Later loads of the same
+// PTX on a device of the same compute capability with the same driver version
+// load the cubin directly. Entries are keyed by a hash of the PTX, the compute
+// capability, and the driver version such that stale entries are never used;
+// unreadable or invalid entries fall back to compiling the PTX.
+//
+// Thread-safe; the cache is immutable after allocation and concurrent writers
+// of the same entry produce identical contents.
+typedef struct iree_hal_cuda_cubin_cache_t iree_hal_cuda_cubin_cache_t;
+
+// Allocates a cache storing cubins for |device| in the existing directory at
+// |path|.
+iree_status_t iree_hal_cuda_cubin_cache_allocate(
+    iree_hal_cuda_context_wrapper_t* context, CUdevice device,
+    iree_string_view_t path, iree_hal_cuda_cubin_cache_t** out_cache);
+
+// Frees |cache|. Entries on disk are retained.
+void iree_hal_cuda_cubin_cache_free(iree_hal_cuda_cubin_cache_t* cache);
+
+// Loads |ptx_image| (NUL-terminated) into a new module in |out_module|.
+// If |cache| is NULL the PTX is loaded directly and JIT compiled by the driver.
+iree_status_t iree_hal_cuda_cubin_cache_load_module(
+    iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_cubin_cache_t* cache, iree_string_view_t ptx_image,
+    CUmodule* out_module);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_CUDA_CUBIN_CACHE_H_
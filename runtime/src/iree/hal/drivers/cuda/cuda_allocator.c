@@ -9,6 +9,7 @@
 #include <stddef.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/atomics.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/cuda/cuda_buffer.h"
 #include "iree/hal/drivers/cuda/dynamic_symbols.h"
@@ -26,6 +27,14 @@ typedef struct iree_hal_cuda_allocator_t {
   CUstream stream;
   bool supports_concurrent_managed_access;
 
+  // Stream-ordered memory pool used for queue-ordered allocations or NULL if
+  // not enabled or not supported by the device.
+  CUmemoryPool async_pool;
+
+  // Bitmask of the ordinals of devices whose memory the device can access
+  // directly. Devices with ordinals beyond the mask are never peers.
+  iree_atomic_int64_t peer_device_mask;
+
   IREE_STATISTICS(iree_hal_allocator_statistics_t statistics;)
 } iree_hal_cuda_allocator_t;
 
@@ -37,9 +46,68 @@ static iree_hal_cuda_allocator_t* iree_hal_cuda_allocator_cast(
   return (iree_hal_cuda_allocator_t*)base_value;
 }
 
+// Creates a stream-ordered memory pool for device-local allocations on
+// |device|. |out_pool| is set to NULL without failing if the loaded driver or
+// the device does not support memory pools.
+static iree_status_t iree_hal_cuda_allocator_create_async_pool(
+    iree_hal_cuda_context_wrapper_t* context, CUdevice device,
+    uint64_t release_threshold, CUmemoryPool* out_pool) {
+  *out_pool = NULL;
+  iree_hal_cuda_dynamic_symbols_t* syms = context->syms;
+  if (!syms->cuMemPoolCreate || !syms->cuMemPoolDestroy ||
+      !syms->cuMemPoolSetAttribute || !syms->cuMemPoolTrimTo ||
+      !syms->cuMemAllocFromPoolAsync || !syms->cuMemFreeAsync) {
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  int supports_memory_pools = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(
+              syms,
+              cuDeviceGetAttribute(&supports_memory_pools,
+                                   CU_DEVICE_ATTRIBUTE_MEMORY_POOLS_SUPPORTED,
+                                   device),
+              "cuDeviceGetAttribute"));
+  if (!supports_memory_pools) {
+    IREE_TRACE_ZONE_APPEND_TEXT(z0, "no MEMORY_POOLS_SUPPORTED");
+    IREE_TRACE_ZONE_END(z0);
+    return iree_ok_status();
+  }
+
+  CUmemPoolProps pool_props;
+  memset(&pool_props, 0, sizeof(pool_props));
+  pool_props.allocType = CU_MEM_ALLOCATION_TYPE_PINNED;
+  pool_props.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  pool_props.location.id = device;
+  CUmemoryPool pool = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(syms, cuMemPoolCreate(&pool, &pool_props),
+                              "cuMemPoolCreate"));
+
+  // By default pools release all memory back to the system when the stream
+  // synchronizes; retaining up to the threshold lets steady-state allocations
+  // be serviced from the pool without driver calls.
+  cuuint64_t threshold = (cuuint64_t)release_threshold;
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      syms,
+      cuMemPoolSetAttribute(pool, CU_MEMPOOL_ATTR_RELEASE_THRESHOLD,
+                            &threshold),
+      "cuMemPoolSetAttribute");
+
+  if (iree_status_is_ok(status)) {
+    *out_pool = pool;
+  } else {
+    CUDA_IGNORE_ERROR(syms, cuMemPoolDestroy(pool));
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 iree_status_t iree_hal_cuda_allocator_create(
     iree_hal_device_t* base_device, iree_hal_cuda_context_wrapper_t* context,
-    CUdevice device, CUstream stream, iree_hal_allocator_t** out_allocator) {
+    CUdevice device, CUstream stream, bool enable_async_allocations,
+    uint64_t async_release_threshold, iree_hal_allocator_t** out_allocator) {
   IREE_ASSERT_ARGUMENT(base_device);
   IREE_ASSERT_ARGUMENT(context);
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -77,7 +145,20 @@ iree_status_t iree_hal_cuda_allocator_create(
     allocator->stream = stream;
     allocator->supports_concurrent_managed_access =
         supports_concurrent_managed_access != 0;
+    allocator->async_pool = NULL;
+    iree_atomic_store_int64(&allocator->peer_device_mask, 0,
+                            iree_memory_order_relaxed);
+  }
+
+  if (iree_status_is_ok(status) && enable_async_allocations) {
+    status = iree_hal_cuda_allocator_create_async_pool(
+        context, device, async_release_threshold, &allocator->async_pool);
+  }
+
+  if (iree_status_is_ok(status)) {
     *out_allocator = (iree_hal_allocator_t*)allocator;
+  } else if (allocator) {
+    iree_allocator_free(context->host_allocator, allocator);
   }
 
   IREE_TRACE_ZONE_END(z0);
@@ -91,6 +172,10 @@ static void iree_hal_cuda_allocator_destroy(
   iree_allocator_t host_allocator = allocator->context->host_allocator;
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  if (allocator->async_pool) {
+    CUDA_IGNORE_ERROR(allocator->context->syms,
+                      cuMemPoolDestroy(allocator->async_pool));
+  }
   iree_allocator_free(host_allocator, allocator);
 
   IREE_TRACE_ZONE_END(z0);
@@ -105,6 +190,15 @@ static iree_allocator_t iree_hal_cuda_allocator_host_allocator(
 
 static iree_status_t iree_hal_cuda_allocator_trim(
     iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_cuda_allocator_t* allocator =
+      iree_hal_cuda_allocator_cast(base_allocator);
+  if (allocator->async_pool) {
+    // Releases all memory retained by the pool that is not in use by any
+    // outstanding allocation.
+    return CU_RESULT_TO_STATUS(allocator->context->syms,
+                               cuMemPoolTrimTo(allocator->async_pool, 0),
+                               "cuMemPoolTrimTo");
+  }
   return iree_ok_status();
 }
 
@@ -155,6 +249,82 @@ iree_hal_cuda_allocator_query_compatibility(
   return compatibility;
 }
 
+void iree_hal_cuda_allocator_add_peer(iree_hal_allocator_t* base_allocator,
+                                      CUdevice peer_device) {
+  iree_hal_cuda_allocator_t* allocator =
+      iree_hal_cuda_allocator_cast(base_allocator);
+  if (peer_device < 0 || peer_device >= 64) return;
+  iree_atomic_fetch_or_int64(&allocator->peer_device_mask,
+                             (int64_t)(1ull << peer_device),
+                             iree_memory_order_release);
+}
+
+// Returns true if the device |allocator| services can directly access memory
+// allocated on |peer_device|.
+static bool iree_hal_cuda_allocator_has_peer(
+    iree_hal_cuda_allocator_t* allocator, CUdevice peer_device) {
+  if (peer_device < 0 || peer_device >= 64) return false;
+  uint64_t peer_device_mask = (uint64_t)iree_atomic_load_int64(
+      &allocator->peer_device_mask, iree_memory_order_acquire);
+  return (peer_device_mask & (1ull << peer_device)) != 0;
+}
+
+iree_status_t iree_hal_cuda_allocator_grant_peer_access(
+    iree_hal_allocator_t* base_allocator, CUdevice peer_device) {
+  iree_hal_cuda_allocator_t* allocator =
+      iree_hal_cuda_allocator_cast(base_allocator);
+  if (!allocator->async_pool) return iree_ok_status();
+  if (!allocator->context->syms->cuMemPoolSetAccess) {
+    return iree_make_status(
+        IREE_STATUS_UNAVAILABLE,
+        "driver does not support granting peer access to memory pools");
+  }
+  CUmemAccessDesc access_desc;
+  memset(&access_desc, 0, sizeof(access_desc));
+  access_desc.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  access_desc.location.id = peer_device;
+  access_desc.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+  return CU_RESULT_TO_STATUS(
+      allocator->context->syms,
+      cuMemPoolSetAccess(allocator->async_pool, &access_desc, 1),
+      "cuMemPoolSetAccess");
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_cuda_allocator_query_buffer_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_buffer_usage_t intended_usage) {
+  iree_hal_cuda_allocator_t* allocator =
+      iree_hal_cuda_allocator_cast(base_allocator);
+  const iree_hal_buffer_params_t params = {
+      .type = iree_hal_buffer_memory_type(buffer),
+      .usage = iree_hal_buffer_allowed_usage(buffer) & intended_usage,
+  };
+  iree_hal_buffer_compatibility_t compatibility =
+      iree_hal_cuda_allocator_query_compatibility(
+          base_allocator, &params, iree_hal_buffer_allocation_size(buffer));
+
+  // Host and managed memory is accessible from all devices. Device memory of
+  // other devices can only be accessed by dispatches if peer access has been
+  // enabled; copies are still supported but are staged by the driver.
+  iree_hal_allocator_t* owner_allocator =
+      iree_hal_buffer_allocated_buffer(buffer)->device_allocator;
+  if (!owner_allocator || owner_allocator == base_allocator ||
+      !iree_hal_resource_is(owner_allocator, &iree_hal_cuda_allocator_vtable) ||
+      !iree_all_bits_set(params.type, IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL) ||
+      iree_any_bit_set(params.type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE)) {
+    return compatibility;
+  }
+  CUdevice owner_device =
+      ((iree_hal_cuda_allocator_t*)owner_allocator)->device;
+  if (owner_device != allocator->device &&
+      !iree_hal_cuda_allocator_has_peer(allocator, owner_device)) {
+    compatibility &= ~IREE_HAL_BUFFER_COMPATIBILITY_QUEUE_DISPATCH;
+  }
+  return compatibility;
+}
+
 static void iree_hal_cuda_buffer_free(iree_hal_cuda_context_wrapper_t* context,
                                       iree_hal_memory_type_t memory_type,
                                       CUdeviceptr device_ptr, void* host_ptr) {
@@ -241,10 +411,11 @@ static iree_status_t iree_hal_cuda_allocator_allocate_buffer(
   iree_hal_buffer_t* buffer = NULL;
   if (iree_status_is_ok(status)) {
     status = iree_hal_cuda_buffer_wrap(
-        base_allocator, memory_type, params->access, params->usage,
-        allocation_size,
+        base_allocator, IREE_HAL_CUDA_BUFFER_TYPE_DEFAULT, memory_type,
+        params->access, params->usage, allocation_size,
         /*byte_offset=*/0,
-        /*byte_length=*/allocation_size, device_ptr, host_ptr, &buffer);
+        /*byte_length=*/allocation_size, device_ptr, host_ptr,
+        iree_hal_buffer_release_callback_null(), &buffer);
   }
 
   // Copy the initial contents into the buffer. This may require staging.
@@ -282,6 +453,26 @@ static void iree_hal_cuda_allocator_deallocate_buffer(
     iree_hal_buffer_t* IREE_RESTRICT base_buffer) {
   iree_hal_cuda_allocator_t* allocator =
       iree_hal_cuda_allocator_cast(base_allocator);
+
+  if (iree_hal_cuda_buffer_type(base_buffer) ==
+      IREE_HAL_CUDA_BUFFER_TYPE_EXTERNAL) {
+    // Imported memory is owned by the caller that provided it and the release
+    // callback issued on destruction lets them know it is no longer in use.
+    iree_hal_buffer_destroy(base_buffer);
+    return;
+  } else if (iree_hal_cuda_buffer_type(base_buffer) ==
+             IREE_HAL_CUDA_BUFFER_TYPE_ASYNC) {
+    // Buffers released without a queue-ordered deallocation are freed in the
+    // order of the allocator stream; buffers already freed have had their
+    // device pointer dropped.
+    if (iree_hal_cuda_buffer_device_pointer(base_buffer)) {
+      iree_status_ignore(iree_hal_cuda_allocator_free_async(
+          base_allocator, allocator->stream, base_buffer));
+    }
+    iree_hal_buffer_destroy(base_buffer);
+    return;
+  }
+
   iree_hal_memory_type_t memory_type = iree_hal_buffer_memory_type(base_buffer);
   iree_hal_cuda_buffer_free(allocator->context, memory_type,
                             iree_hal_cuda_buffer_device_pointer(base_buffer),
@@ -297,14 +488,120 @@ static void iree_hal_cuda_allocator_deallocate_buffer(
   iree_hal_buffer_destroy(base_buffer);
 }
 
+bool iree_hal_cuda_allocator_supports_async(
+    iree_hal_allocator_t* base_allocator,
+    const iree_hal_buffer_params_t* params) {
+  iree_hal_cuda_allocator_t* allocator =
+      iree_hal_cuda_allocator_cast(base_allocator);
+  if (!allocator->async_pool) return false;
+  return iree_all_bits_set(params->type, IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL) &&
+         !iree_any_bit_set(params->type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE);
+}
+
+iree_status_t iree_hal_cuda_allocator_alloc_async(
+    iree_hal_allocator_t* base_allocator, CUstream stream,
+    const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** out_buffer) {
+  iree_hal_cuda_allocator_t* allocator =
+      iree_hal_cuda_allocator_cast(base_allocator);
+  IREE_ASSERT(iree_hal_cuda_allocator_supports_async(base_allocator, params));
+  *out_buffer = NULL;
+  if (allocation_size == 0) allocation_size = 4;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, allocation_size);
+
+  CUdeviceptr device_ptr = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(
+              allocator->context->syms,
+              cuMemAllocFromPoolAsync(&device_ptr, allocation_size,
+                                      allocator->async_pool, stream),
+              "cuMemAllocFromPoolAsync"));
+
+  iree_hal_buffer_t* buffer = NULL;
+  iree_status_t status = iree_hal_cuda_buffer_wrap(
+      base_allocator, IREE_HAL_CUDA_BUFFER_TYPE_ASYNC, params->type,
+      params->access, params->usage, allocation_size,
+      /*byte_offset=*/0,
+      /*byte_length=*/allocation_size, device_ptr, /*host_ptr=*/NULL,
+      iree_hal_buffer_release_callback_null(), &buffer);
+
+  if (iree_status_is_ok(status)) {
+    IREE_TRACE_ALLOC_NAMED(IREE_HAL_CUDA_ALLOCATOR_ID, (void*)device_ptr,
+                           allocation_size);
+    IREE_STATISTICS(iree_hal_allocator_statistics_record_alloc(
+        &allocator->statistics, params->type, allocation_size));
+    *out_buffer = buffer;
+  } else {
+    CUDA_IGNORE_ERROR(allocator->context->syms,
+                      cuMemFreeAsync(device_ptr, stream));
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_hal_cuda_allocator_free_async(
+    iree_hal_allocator_t* base_allocator, CUstream stream,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_cuda_allocator_t* allocator =
+      iree_hal_cuda_allocator_cast(base_allocator);
+  IREE_ASSERT(iree_hal_cuda_buffer_type(buffer) ==
+              IREE_HAL_CUDA_BUFFER_TYPE_ASYNC);
+  CUdeviceptr device_ptr = iree_hal_cuda_buffer_device_pointer(buffer);
+  if (!device_ptr) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_status_t status =
+      CU_RESULT_TO_STATUS(allocator->context->syms,
+                          cuMemFreeAsync(device_ptr, stream), "cuMemFreeAsync");
+  if (iree_status_is_ok(status)) {
+    iree_hal_cuda_buffer_drop_device_pointer(buffer);
+    IREE_TRACE_FREE_NAMED(IREE_HAL_CUDA_ALLOCATOR_ID, (void*)device_ptr);
+    IREE_STATISTICS(iree_hal_allocator_statistics_record_free(
+        &allocator->statistics, iree_hal_buffer_memory_type(buffer),
+        iree_hal_buffer_allocation_size(buffer)));
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static iree_status_t iree_hal_cuda_allocator_import_buffer(
     iree_hal_allocator_t* IREE_RESTRICT base_allocator,
     const iree_hal_buffer_params_t* IREE_RESTRICT params,
     iree_hal_external_buffer_t* IREE_RESTRICT external_buffer,
     iree_hal_buffer_release_callback_t release_callback,
     iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
-  return iree_make_status(IREE_STATUS_UNAVAILABLE,
-                          "importing from external buffers not supported");
+  if (external_buffer->type !=
+      IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION) {
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "external buffer type not supported");
+  }
+  if (iree_any_bit_set(params->type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE)) {
+    return iree_make_status(
+        IREE_STATUS_UNAVAILABLE,
+        "imported device allocations are not host visible");
+  }
+  if (!external_buffer->handle.device_allocation.ptr) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "external device allocation is NULL");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, external_buffer->size);
+
+  // The pointer is assumed to be in the same context as the device; CUDA
+  // itself does not let us verify that cheaply.
+  iree_status_t status = iree_hal_cuda_buffer_wrap(
+      base_allocator, IREE_HAL_CUDA_BUFFER_TYPE_EXTERNAL,
+      params->type | IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL, params->access,
+      params->usage, external_buffer->size,
+      /*byte_offset=*/0,
+      /*byte_length=*/external_buffer->size,
+      (CUdeviceptr)external_buffer->handle.device_allocation.ptr,
+      /*host_ptr=*/NULL, release_callback, out_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
 }
 
 static iree_status_t iree_hal_cuda_allocator_export_buffer(
@@ -313,8 +610,45 @@ static iree_status_t iree_hal_cuda_allocator_export_buffer(
     iree_hal_external_buffer_type_t requested_type,
     iree_hal_external_buffer_flags_t requested_flags,
     iree_hal_external_buffer_t* IREE_RESTRICT out_external_buffer) {
-  return iree_make_status(IREE_STATUS_UNAVAILABLE,
-                          "exporting to external buffers not supported");
+  iree_hal_buffer_t* allocated_buffer =
+      iree_hal_buffer_allocated_buffer(buffer);
+  if (!iree_hal_cuda_buffer_isa(allocated_buffer)) {
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "buffer was not allocated by a CUDA allocator");
+  }
+  iree_device_size_t byte_offset = iree_hal_buffer_byte_offset(buffer);
+  switch (requested_type) {
+    case IREE_HAL_EXTERNAL_BUFFER_TYPE_DEVICE_ALLOCATION: {
+      CUdeviceptr device_ptr =
+          iree_hal_cuda_buffer_device_pointer(allocated_buffer);
+      if (!device_ptr) {
+        return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                                "buffer has no device pointer");
+      }
+      out_external_buffer->handle.device_allocation.ptr =
+          (uint64_t)(device_ptr + byte_offset);
+      break;
+    }
+    case IREE_HAL_EXTERNAL_BUFFER_TYPE_HOST_ALLOCATION: {
+      uint8_t* host_ptr =
+          (uint8_t*)iree_hal_cuda_buffer_host_pointer(allocated_buffer);
+      if (!host_ptr) {
+        return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                                "buffer is not host visible");
+      }
+      out_external_buffer->handle.host_allocation.ptr = host_ptr + byte_offset;
+      break;
+    }
+    default:
+      return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                              "external buffer type not supported");
+  }
+
+  // Note that the returned pointer is unowned.
+  out_external_buffer->type = requested_type;
+  out_external_buffer->flags = requested_flags;
+  out_external_buffer->size = iree_hal_buffer_byte_length(buffer);
+  return iree_ok_status();
 }
 
 static const iree_hal_allocator_vtable_t iree_hal_cuda_allocator_vtable = {
@@ -327,4 +661,6 @@ static const iree_hal_allocator_vtable_t iree_hal_cuda_allocator_vtable = {
     .deallocate_buffer = iree_hal_cuda_allocator_deallocate_buffer,
     .import_buffer = iree_hal_cuda_allocator_import_buffer,
     .export_buffer = iree_hal_cuda_allocator_export_buffer,
+    .query_buffer_compatibility =
+        iree_hal_cuda_allocator_query_buffer_compatibility,
 };
@@ -17,9 +17,50 @@ extern "C" {
 #endif  // __cplusplus
 
 // Create a cuda allocator.
+// When |enable_async_allocations| is set and the device supports stream-ordered
+// memory pools a dedicated pool is created that retains up to
+// |async_release_threshold| bytes of freed memory for reuse by
+// iree_hal_cuda_allocator_alloc_async.
 iree_status_t iree_hal_cuda_allocator_create(
     iree_hal_device_t* base_device, iree_hal_cuda_context_wrapper_t* context,
-    CUdevice device, CUstream stream, iree_hal_allocator_t** out_allocator);
+    CUdevice device, CUstream stream, bool enable_async_allocations,
+    uint64_t async_release_threshold, iree_hal_allocator_t** out_allocator);
+
+// Returns true if buffers with |params| can be allocated in stream order with
+// iree_hal_cuda_allocator_alloc_async. Only device-local memory that is not
+// host-visible can be allocated from the stream-ordered pool.
+bool iree_hal_cuda_allocator_supports_async(
+    iree_hal_allocator_t* allocator, const iree_hal_buffer_params_t* params);
+
+// Allocates a buffer from the stream-ordered pool that is available for use by
+// work enqueued on |stream| after this call. Work on other streams must be
+// ordered after |stream| before using the buffer.
+iree_status_t iree_hal_cuda_allocator_alloc_async(
+    iree_hal_allocator_t* allocator, CUstream stream,
+    const iree_hal_buffer_params_t* params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** out_buffer);
+
+// Frees the memory backing |buffer| in stream order on |stream|. The buffer
+// must have been allocated with iree_hal_cuda_allocator_alloc_async and must
+// not be used by work enqueued after this call. The buffer object itself
+// remains valid until released.
+iree_status_t iree_hal_cuda_allocator_free_async(
+    iree_hal_allocator_t* allocator, CUstream stream,
+    iree_hal_buffer_t* buffer);
+
+// Records that the device |allocator| services can directly access memory
+// allocated on |peer_device| such that device-local buffers allocated from the
+// peer are reported as compatible for dispatch. Peer access must have been
+// enabled from the context of the device to that of the peer.
+void iree_hal_cuda_allocator_add_peer(iree_hal_allocator_t* allocator,
+                                      CUdevice peer_device);
+
+// Grants |peer_device| read-write access to memory allocated from the
+// stream-ordered pool of |allocator|. Pool allocations are not covered by
+// context peer access and are otherwise only accessible from the device that
+// owns the pool. No-op if |allocator| has no pool.
+iree_status_t iree_hal_cuda_allocator_grant_peer_access(
+    iree_hal_allocator_t* allocator, CUdevice peer_device);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -15,13 +15,42 @@
 extern "C" {
 #endif  // __cplusplus
 
-// Wraps a CUDA allocation in an iree_hal_buffer_t.
+// Defines how the memory backing a CUDA buffer was allocated.
+typedef enum iree_hal_cuda_buffer_type_e {
+  // Allocated synchronously with cuMemAlloc/cuMemAllocManaged/cuMemHostAlloc.
+  IREE_HAL_CUDA_BUFFER_TYPE_DEFAULT = 0,
+  // Allocated from a stream-ordered memory pool with cuMemAllocFromPoolAsync
+  // and freed with cuMemFreeAsync.
+  IREE_HAL_CUDA_BUFFER_TYPE_ASYNC = 1,
+  // Externally-owned allocation imported with iree_hal_allocator_import_buffer.
+  // The memory is never freed by the HAL and the release callback provided on
+  // import is issued when the buffer is destroyed.
+  IREE_HAL_CUDA_BUFFER_TYPE_EXTERNAL = 2,
+} iree_hal_cuda_buffer_type_t;
+
+// Wraps a CUDA allocation of |buffer_type| in an iree_hal_buffer_t.
+// |release_callback| is issued when the buffer is destroyed.
 iree_status_t iree_hal_cuda_buffer_wrap(
-    iree_hal_allocator_t* allocator, iree_hal_memory_type_t memory_type,
-    iree_hal_memory_access_t allowed_access,
+    iree_hal_allocator_t* allocator, iree_hal_cuda_buffer_type_t buffer_type,
+    iree_hal_memory_type_t memory_type, iree_hal_memory_access_t allowed_access,
     iree_hal_buffer_usage_t allowed_usage, iree_device_size_t allocation_size,
     iree_device_size_t byte_offset, iree_device_size_t byte_length,
-    CUdeviceptr device_ptr, void* host_ptr, iree_hal_buffer_t** out_buffer);
+    CUdeviceptr device_ptr, void* host_ptr,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** out_buffer);
+
+// Returns true if |buffer| is a CUDA buffer.
+bool iree_hal_cuda_buffer_isa(iree_hal_buffer_t* buffer);
+
+// Returns the type of the allocation backing |buffer| or
+// IREE_HAL_CUDA_BUFFER_TYPE_DEFAULT if |buffer| is not a CUDA buffer.
+iree_hal_cuda_buffer_type_t iree_hal_cuda_buffer_type(
+    iree_hal_buffer_t* buffer);
+
+// Drops the device pointer of |buffer| after its allocation has been freed
+// out-of-band (such as with cuMemFreeAsync) such that it is not freed again
+// when the buffer is destroyed.
+void iree_hal_cuda_buffer_drop_device_pointer(iree_hal_buffer_t* buffer);
 
 // Returns the CUDA base pointer for the given |buffer|.
 // This is the entire allocated_buffer and must be offset by the buffer
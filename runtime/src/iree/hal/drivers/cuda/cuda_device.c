@@ -11,25 +11,46 @@
 #include <string.h>
 
 #include "iree/base/internal/arena.h"
+#include "iree/base/internal/atomic_slist.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/cuda/context_wrapper.h"
+#include "iree/hal/drivers/cuda/cubin_cache.h"
 #include "iree/hal/drivers/cuda/cuda_allocator.h"
+#include "iree/hal/drivers/cuda/cuda_buffer.h"
 #include "iree/hal/drivers/cuda/cuda_event.h"
+#include "iree/hal/drivers/cuda/cuda_profiler.h"
 #include "iree/hal/drivers/cuda/descriptor_set_layout.h"
 #include "iree/hal/drivers/cuda/dynamic_symbols.h"
 #include "iree/hal/drivers/cuda/event_semaphore.h"
 #include "iree/hal/drivers/cuda/executable_layout.h"
 #include "iree/hal/drivers/cuda/graph_command_buffer.h"
+#include "iree/hal/drivers/cuda/graph_exec_cache.h"
 #include "iree/hal/drivers/cuda/nop_executable_cache.h"
+#include "iree/hal/drivers/cuda/staging_ring.h"
 #include "iree/hal/drivers/cuda/status_util.h"
 #include "iree/hal/drivers/cuda/stream_command_buffer.h"
 #include "iree/hal/utils/buffer_transfer.h"
 #include "iree/hal/utils/deferred_command_buffer.h"
+#include "iree/hal/utils/transient_buffer_pool.h"
 
 //===----------------------------------------------------------------------===//
 // iree_hal_cuda_device_t
 //===----------------------------------------------------------------------===//
 
+// A device queue backed by its own CUDA stream.
+// Work submitted to different queues may execute concurrently on the device
+// unless ordered by semaphores.
+typedef struct iree_hal_cuda_device_queue_t {
+  // Serializes submissions to the queue as the stream and the cached stream
+  // command buffer must be externally synchronized.
+  iree_slim_mutex_t mutex;
+
+  CUstream stream;
+
+  // Cache of the direct stream command buffer initialized when in stream mode.
+  iree_hal_command_buffer_t* stream_command_buffer;
+} iree_hal_cuda_device_queue_t;
+
 typedef struct iree_hal_cuda_device_t {
   iree_hal_resource_t resource;
   iree_string_view_t identifier;
@@ -47,14 +68,36 @@ typedef struct iree_hal_cuda_device_t {
 
   CUdevice device;
 
-  // TODO: support multiple streams.
-  CUstream stream;
   iree_hal_cuda_context_wrapper_t context_wrapper;
   iree_hal_allocator_t* device_allocator;
 
-  // Cache of the direct stream command buffer initialized when in stream mode.
-  // TODO: have one cached per stream once there are multiple streams.
-  iree_hal_command_buffer_t* stream_command_buffer;
+  // Cache of graph instantiations reused by graph command buffers.
+  iree_hal_cuda_graph_exec_cache_t* graph_exec_cache;
+
+  // Pool of device allocations recycled by queue-ordered allocations.
+  iree_hal_transient_buffer_pool_t* transient_pool;
+
+  // Page-locked staging memory used for host <-> device transfers or NULL if
+  // disabled.
+  iree_hal_cuda_staging_ring_t* staging_ring;
+
+  // Persistent cache of compiled executables or NULL if disabled.
+  iree_hal_cuda_cubin_cache_t* cubin_cache;
+
+  // Active profiling capture shared by all queues or NULL if not profiling.
+  iree_hal_cuda_profiler_t* profiler;
+
+  // State shared by all semaphores created from the device.
+  iree_hal_cuda_semaphore_state_t semaphore_state;
+
+  // Submissions whose work has completed on the stream and whose resources
+  // can be released. Populated from CUDA host functions, which must not call
+  // into CUDA, and reclaimed on the host as the device is used.
+  iree_atomic_slist_t completed_submissions;
+
+  // Queues selected by submission queue affinity.
+  iree_host_size_t queue_count;
+  iree_hal_cuda_device_queue_t queues[];
 } iree_hal_cuda_device_t;
 
 static const iree_hal_device_vtable_t iree_hal_cuda_device_vtable;
@@ -71,6 +114,10 @@ void iree_hal_cuda_device_params_initialize(
   out_params->queue_count = 8;
   out_params->command_buffer_mode = IREE_HAL_CUDA_COMMAND_BUFFER_MODE_GRAPH;
   out_params->allow_inline_execution = false;
+  out_params->async_allocations = false;
+  out_params->async_allocation_release_threshold = UINT64_MAX;
+  out_params->staging_ring_capacity = 16 * 1024 * 1024;
+  out_params->cubin_cache_path = iree_string_view_empty();
 }
 
 static iree_status_t iree_hal_cuda_device_check_params(
@@ -89,10 +136,13 @@ static iree_status_t iree_hal_cuda_device_check_params(
 static iree_status_t iree_hal_cuda_device_create_internal(
     iree_hal_driver_t* driver, iree_string_view_t identifier,
     const iree_hal_cuda_device_params_t* params, CUdevice cu_device,
-    CUstream stream, CUcontext context, iree_hal_cuda_dynamic_symbols_t* syms,
+    CUcontext context, iree_hal_cuda_dynamic_symbols_t* syms,
     iree_allocator_t host_allocator, iree_hal_device_t** out_device) {
   iree_hal_cuda_device_t* device = NULL;
-  iree_host_size_t total_size = iree_sizeof_struct(*device) + identifier.size;
+  iree_host_size_t queues_size =
+      params->queue_count * sizeof(device->queues[0]);
+  iree_host_size_t total_size =
+      iree_sizeof_struct(*device) + queues_size + identifier.size;
   IREE_RETURN_IF_ERROR(
       iree_allocator_malloc(host_allocator, total_size, (void**)&device));
   memset(device, 0, total_size);
@@ -101,27 +151,72 @@ static iree_status_t iree_hal_cuda_device_create_internal(
   iree_hal_driver_retain(device->driver);
   iree_string_view_append_to_buffer(
       identifier, &device->identifier,
-      (char*)device + iree_sizeof_struct(*device));
+      (char*)device + iree_sizeof_struct(*device) + queues_size);
   device->params = *params;
   device->device = cu_device;
-  device->stream = stream;
   device->context_wrapper.cu_context = context;
   device->context_wrapper.host_allocator = host_allocator;
   iree_arena_block_pool_initialize(params->arena_block_size, host_allocator,
                                    &device->block_pool);
   device->context_wrapper.syms = syms;
+  iree_hal_cuda_semaphore_state_initialize(&device->semaphore_state);
+  iree_atomic_slist_initialize(&device->completed_submissions);
+
+  iree_status_t status = iree_ok_status();
+  device->queue_count = params->queue_count;
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    iree_slim_mutex_initialize(&device->queues[i].mutex);
+  }
+  for (iree_host_size_t i = 0;
+       i < device->queue_count && iree_status_is_ok(status); ++i) {
+    status = CU_RESULT_TO_STATUS(
+        syms,
+        cuStreamCreate(&device->queues[i].stream, CU_STREAM_NON_BLOCKING));
+  }
+
+  // The allocator issues its own asynchronous work (prefetches) against the
+  // first queue.
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_cuda_allocator_create(
+        (iree_hal_device_t*)device, &device->context_wrapper, cu_device,
+        device->queues[0].stream, params->async_allocations,
+        params->async_allocation_release_threshold, &device->device_allocator);
+  }
+
+  if (iree_status_is_ok(status) &&
+      params->command_buffer_mode == IREE_HAL_CUDA_COMMAND_BUFFER_MODE_GRAPH) {
+    status = iree_hal_cuda_graph_exec_cache_allocate(
+        &device->context_wrapper, &device->graph_exec_cache);
+  }
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_transient_buffer_pool_create(
+        device->device_allocator, host_allocator, &device->transient_pool);
+  }
 
-  iree_status_t status = iree_hal_cuda_allocator_create(
-      (iree_hal_device_t*)device, &device->context_wrapper, cu_device, stream,
-      &device->device_allocator);
+  if (iree_status_is_ok(status) && params->staging_ring_capacity > 0) {
+    status = iree_hal_cuda_staging_ring_allocate(&device->context_wrapper,
+                                                 params->staging_ring_capacity,
+                                                 &device->staging_ring);
+  }
 
   if (iree_status_is_ok(status) &&
-      params->command_buffer_mode == IREE_HAL_CUDA_COMMAND_BUFFER_MODE_STREAM) {
-    status = iree_hal_cuda_stream_command_buffer_create(
-        (iree_hal_device_t*)device, &device->context_wrapper,
-        IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION,
-        IREE_HAL_COMMAND_CATEGORY_ANY, device->stream, /*block_pool=*/NULL,
-        &device->stream_command_buffer);
+      !iree_string_view_is_empty(params->cubin_cache_path)) {
+    status = iree_hal_cuda_cubin_cache_allocate(&device->context_wrapper,
+                                                cu_device,
+                                                params->cubin_cache_path,
+                                                &device->cubin_cache);
+  }
+
+  if (params->command_buffer_mode == IREE_HAL_CUDA_COMMAND_BUFFER_MODE_STREAM) {
+    for (iree_host_size_t i = 0;
+         i < device->queue_count && iree_status_is_ok(status); ++i) {
+      status = iree_hal_cuda_stream_command_buffer_create(
+          (iree_hal_device_t*)device, &device->context_wrapper,
+          IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION,
+          IREE_HAL_COMMAND_CATEGORY_ANY, device->queues[i].stream,
+          /*block_pool=*/NULL, &device->queues[i].stream_command_buffer);
+    }
   }
 
   if (iree_status_is_ok(status)) {
@@ -144,37 +239,116 @@ iree_status_t iree_hal_cuda_device_create(
   CUcontext context;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
       z0, CU_RESULT_TO_STATUS(syms, cuCtxCreate(&context, 0, device)));
-  CUstream stream;
-  iree_status_t status = CU_RESULT_TO_STATUS(
-      syms, cuStreamCreate(&stream, CU_STREAM_NON_BLOCKING));
 
-  if (iree_status_is_ok(status)) {
-    status = iree_hal_cuda_device_create_internal(driver, identifier, params,
-                                                  device, stream, context, syms,
-                                                  host_allocator, out_device);
-  }
+  iree_status_t status = iree_hal_cuda_device_create_internal(
+      driver, identifier, params, device, context, syms, host_allocator,
+      out_device);
   if (!iree_status_is_ok(status)) {
-    if (stream) {
-      syms->cuStreamDestroy(stream);
-    }
     syms->cuCtxDestroy(context);
   }
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
 
+IREE_API_EXPORT iree_status_t iree_hal_cuda_device_enable_peer_access(
+    iree_hal_device_t* base_device, iree_hal_device_t* base_peer_device) {
+  IREE_ASSERT_ARGUMENT(base_device);
+  IREE_ASSERT_ARGUMENT(base_peer_device);
+  if (!iree_hal_resource_is(base_device, &iree_hal_cuda_device_vtable) ||
+      !iree_hal_resource_is(base_peer_device, &iree_hal_cuda_device_vtable)) {
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "peer access can only be enabled between CUDA devices");
+  }
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+  iree_hal_cuda_device_t* peer_device =
+      iree_hal_cuda_device_cast(base_peer_device);
+  if (device == peer_device) return iree_ok_status();
+  iree_hal_cuda_dynamic_symbols_t* syms = device->context_wrapper.syms;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  int can_access_peer = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(syms,
+                              cuDeviceCanAccessPeer(&can_access_peer,
+                                                    device->device,
+                                                    peer_device->device),
+                              "cuDeviceCanAccessPeer"));
+  if (!can_access_peer) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "CUDA device %d cannot directly access the memory "
+                            "of CUDA device %d",
+                            (int)device->device, (int)peer_device->device);
+  }
+
+  // Memory allocated from the stream-ordered pool of the peer is not covered
+  // by context peer access and must be granted separately.
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_cuda_allocator_grant_peer_access(
+              peer_device->device_allocator, device->device));
+
+  // Peer access is enabled from the current context so the device context is
+  // made current for the duration of the call.
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, CU_RESULT_TO_STATUS(
+              syms, cuCtxPushCurrent(device->context_wrapper.cu_context),
+              "cuCtxPushCurrent"));
+  CUresult result = syms->cuCtxEnablePeerAccess(
+      peer_device->context_wrapper.cu_context, /*Flags=*/0);
+  CUcontext popped_context = NULL;
+  CUDA_IGNORE_ERROR(syms, cuCtxPopCurrent(&popped_context));
+  iree_status_t status = iree_ok_status();
+  if (result != CUDA_ERROR_PEER_ACCESS_ALREADY_ENABLED) {
+    status = iree_hal_cuda_result_to_status(syms, result, __FILE__, __LINE__);
+  }
+
+  if (iree_status_is_ok(status)) {
+    iree_hal_cuda_allocator_add_peer(device->device_allocator,
+                                     peer_device->device);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_cuda_device_reclaim_submissions(
+    iree_hal_cuda_device_t* device);
+
 static void iree_hal_cuda_device_destroy(iree_hal_device_t* base_device) {
   iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
   iree_allocator_t host_allocator = iree_hal_device_host_allocator(base_device);
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  // Drain all in-flight work so that its completion callbacks have run and the
+  // resources it retained can be released.
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    if (!device->queues[i].stream) continue;
+    CUDA_IGNORE_ERROR(device->context_wrapper.syms,
+                      cuStreamSynchronize(device->queues[i].stream));
+  }
+  iree_hal_cuda_device_reclaim_submissions(device);
+  iree_atomic_slist_deinitialize(&device->completed_submissions);
+  iree_hal_cuda_profiler_destroy(device->profiler);
+
   // There should be no more buffers live that use the allocator.
-  iree_hal_command_buffer_release(device->stream_command_buffer);
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    iree_hal_command_buffer_release(device->queues[i].stream_command_buffer);
+  }
+  iree_hal_transient_buffer_pool_free(device->transient_pool);
+  iree_hal_cuda_staging_ring_free(device->staging_ring);
+  iree_hal_cuda_cubin_cache_free(device->cubin_cache);
+  iree_hal_cuda_graph_exec_cache_free(device->graph_exec_cache);
   iree_hal_allocator_release(device->device_allocator);
-  CUDA_IGNORE_ERROR(device->context_wrapper.syms,
-                    cuStreamDestroy(device->stream));
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    if (device->queues[i].stream) {
+      CUDA_IGNORE_ERROR(device->context_wrapper.syms,
+                        cuStreamDestroy(device->queues[i].stream));
+    }
+    iree_slim_mutex_deinitialize(&device->queues[i].mutex);
+  }
 
   iree_arena_block_pool_deinitialize(&device->block_pool);
+  iree_hal_cuda_semaphore_state_deinitialize(&device->semaphore_state);
 
   // Finally, destroy the device.
   iree_hal_driver_release(device->driver);
@@ -202,16 +376,29 @@ static iree_hal_allocator_t* iree_hal_cuda_device_allocator(
   return device->device_allocator;
 }
 
+static void iree_hal_cuda_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
 static iree_status_t iree_hal_cuda_device_trim(iree_hal_device_t* base_device) {
   iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
   iree_arena_block_pool_trim(&device->block_pool);
+  iree_hal_cuda_device_reclaim_submissions(device);
+  if (device->graph_exec_cache) {
+    iree_hal_cuda_graph_exec_cache_trim(device->graph_exec_cache);
+  }
+  iree_hal_transient_buffer_pool_trim(device->transient_pool);
   return iree_hal_allocator_trim(device->device_allocator);
 }
 
 static iree_status_t iree_hal_cuda_device_query_i64(
     iree_hal_device_t* base_device, iree_string_view_t category,
     iree_string_view_t key, int64_t* out_value) {
-  // iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
   *out_value = 0;
 
   if (iree_string_view_equal(category,
@@ -221,6 +408,17 @@ static iree_status_t iree_hal_cuda_device_query_i64(
             ? 1
             : 0;
     return iree_ok_status();
+  } else if (iree_string_view_equal(category,
+                                    iree_make_cstring_view("hal.device"))) {
+    if (iree_string_view_equal(key, iree_make_cstring_view("concurrency"))) {
+      *out_value = (int64_t)device->queue_count;
+      return iree_ok_status();
+    } else if (iree_string_view_equal(key,
+                                      iree_make_cstring_view("ordinal"))) {
+      // CUdevice handles are the device ordinals as used by the runtime API.
+      *out_value = (int64_t)device->device;
+      return iree_ok_status();
+    }
   }
 
   return iree_make_status(
@@ -229,10 +427,21 @@ static iree_status_t iree_hal_cuda_device_query_i64(
       (int)category.size, category.data, (int)key.size, key.data);
 }
 
+// Returns the queue to submit work to based on the |queue_affinity|.
+// All queues are general purpose so |command_categories| is ignored. As with
+// other devices the affinity only ensures that equivalent affinities map to
+// equivalent queues.
+static iree_hal_cuda_device_queue_t* iree_hal_cuda_device_select_queue(
+    iree_hal_cuda_device_t* device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity) {
+  return &device->queues[queue_affinity % device->queue_count];
+}
+
 static iree_status_t iree_hal_cuda_device_create_command_buffer(
     iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer) {
   iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
   if (device->params.allow_inline_execution &&
@@ -242,19 +451,35 @@ static iree_status_t iree_hal_cuda_device_create_command_buffer(
     // recorded, implying that the command buffer cannot be reused and doesn't
     // need to be persisted. This lets us lower the execution delay as we can
     // directly route commands to a CUDA stream and let it eagerly flush.
-    return iree_hal_cuda_stream_command_buffer_create(
+    // NOTE: recording is not synchronized with submissions to the same queue;
+    // inline command buffers are expected to be recorded by the thread
+    // submitting to the queue.
+    iree_hal_cuda_device_queue_t* queue = iree_hal_cuda_device_select_queue(
+        device, command_categories, queue_affinity);
+    IREE_RETURN_IF_ERROR(iree_hal_cuda_stream_command_buffer_create(
         base_device, &device->context_wrapper, mode, command_categories,
-        device->stream, &device->block_pool, out_command_buffer);
+        queue->stream, &device->block_pool, out_command_buffer));
+    iree_hal_cuda_stream_command_buffer_set_profiler(*out_command_buffer,
+                                                     device->profiler);
+    return iree_ok_status();
   }
   switch (device->params.command_buffer_mode) {
     case IREE_HAL_CUDA_COMMAND_BUFFER_MODE_GRAPH:
+      if (binding_capacity > 0) {
+        return iree_make_status(
+            IREE_STATUS_UNIMPLEMENTED,
+            "binding tables not yet implemented for graph command buffers");
+      }
       return iree_hal_cuda_graph_command_buffer_create(
           base_device, &device->context_wrapper, mode, command_categories,
-          queue_affinity, &device->block_pool, out_command_buffer);
+          queue_affinity, &device->block_pool, device->graph_exec_cache,
+          /*enable_dispatch_profiling=*/device->profiler != NULL,
+          out_command_buffer);
     case IREE_HAL_CUDA_COMMAND_BUFFER_MODE_STREAM:
       return iree_hal_deferred_command_buffer_create(
-          base_device, mode, command_categories, &device->block_pool,
-          iree_hal_device_host_allocator(base_device), out_command_buffer);
+          base_device, mode, command_categories, binding_capacity,
+          &device->block_pool, iree_hal_device_host_allocator(base_device),
+          out_command_buffer);
     default:
       return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
                               "invalid command buffer mode");
@@ -294,7 +519,8 @@ static iree_status_t iree_hal_cuda_device_create_executable_cache(
     iree_loop_t loop, iree_hal_executable_cache_t** out_executable_cache) {
   iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
   return iree_hal_cuda_nop_executable_cache_create(
-      &device->context_wrapper, identifier, out_executable_cache);
+      &device->context_wrapper, device->cubin_cache, identifier,
+      out_executable_cache);
 }
 
 static iree_status_t iree_hal_cuda_device_create_executable_layout(
@@ -312,49 +538,388 @@ static iree_status_t iree_hal_cuda_device_create_semaphore(
     iree_hal_device_t* base_device, uint64_t initial_value,
     iree_hal_semaphore_t** out_semaphore) {
   iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
-  return iree_hal_cuda_semaphore_create(&device->context_wrapper, initial_value,
+  return iree_hal_cuda_semaphore_create(&device->context_wrapper,
+                                        &device->semaphore_state, initial_value,
                                         out_semaphore);
 }
 
 static iree_hal_semaphore_compatibility_t
 iree_hal_cuda_device_query_semaphore_compatibility(
     iree_hal_device_t* base_device, iree_hal_semaphore_t* semaphore) {
-  // TODO: implement CUDA semaphores.
+  if (iree_hal_cuda_semaphore_isa(semaphore)) {
+    // CUDA semaphores are signaled from the stream as work completes without
+    // blocking the submitting thread. Waits are performed on the host unless
+    // the signal has already been enqueued on the same stream.
+    return IREE_HAL_SEMAPHORE_COMPATIBILITY_HOST_ONLY |
+           IREE_HAL_SEMAPHORE_COMPATIBILITY_DEVICE_SIGNAL;
+  }
   return IREE_HAL_SEMAPHORE_COMPATIBILITY_HOST_ONLY;
 }
 
+// Resources retained by a submission until its work has completed on the
+// stream. Allocated as a single block with trailing storage for the lists.
+typedef struct iree_hal_cuda_device_submission_t {
+  // Entry in the device completed_submissions list.
+  iree_atomic_slist_entry_t slist_entry;
+  // Unretained; the device drains the stream before it is destroyed.
+  iree_hal_cuda_device_t* device;
+  // Retained command buffers whose execution must complete before release.
+  iree_host_size_t command_buffer_count;
+  iree_hal_command_buffer_t** command_buffers;
+  // Retained semaphores signaled once the submission completes.
+  iree_hal_semaphore_list_t signal_semaphores;
+} iree_hal_cuda_device_submission_t;
+
+static void iree_hal_cuda_device_submission_free(
+    iree_hal_cuda_device_submission_t* submission) {
+  iree_allocator_t host_allocator =
+      submission->device->context_wrapper.host_allocator;
+  for (iree_host_size_t i = 0; i < submission->command_buffer_count; ++i) {
+    iree_hal_command_buffer_release(submission->command_buffers[i]);
+  }
+  for (iree_host_size_t i = 0; i < submission->signal_semaphores.count; ++i) {
+    iree_hal_semaphore_release(submission->signal_semaphores.semaphores[i]);
+  }
+  iree_allocator_free(host_allocator, submission);
+}
+
+// Releases the resources of all submissions that have completed.
+// Must not be called from CUDA host functions as releasing command buffers may
+// destroy CUDA objects.
+static void iree_hal_cuda_device_reclaim_submissions(
+    iree_hal_cuda_device_t* device) {
+  iree_atomic_slist_entry_t* head = NULL;
+  if (!iree_atomic_slist_flush(&device->completed_submissions,
+                               IREE_ATOMIC_SLIST_FLUSH_ORDER_APPROXIMATE_LIFO,
+                               &head, /*out_tail=*/NULL)) {
+    return;
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  while (head) {
+    iree_atomic_slist_entry_t* next = head->next;
+    // The entry is the first member of the submission.
+    iree_hal_cuda_device_submission_free(
+        (iree_hal_cuda_device_submission_t*)head);
+    head = next;
+  }
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// CUDA host function run once all work enqueued on the stream prior to the
+// submission has completed.
+// NOTE: CUDA APIs must not be called from here; resources are handed back to
+// the device to be released on the next host-side use.
+static void CUDA_CB iree_hal_cuda_device_submission_complete(void* user_data) {
+  iree_hal_cuda_device_submission_t* submission =
+      (iree_hal_cuda_device_submission_t*)user_data;
+  iree_hal_cuda_device_t* device = submission->device;
+  iree_status_t status = iree_hal_cuda_semaphore_multi_signal(
+      &device->semaphore_state, &submission->signal_semaphores);
+  if (!iree_status_is_ok(status)) {
+    // Waiters must not hang on semaphores we were unable to signal.
+    for (iree_host_size_t i = 0; i < submission->signal_semaphores.count; ++i) {
+      iree_hal_semaphore_fail(submission->signal_semaphores.semaphores[i],
+                              iree_status_clone(status));
+    }
+    iree_status_ignore(status);
+  }
+  iree_atomic_slist_push(&device->completed_submissions,
+                         &submission->slist_entry);
+}
+
+// Enqueues a host function on |queue| that signals the batch signal semaphores
+// and releases the batch command buffers once all prior work on the queue
+// stream has completed. Must be called with the queue mutex held.
+static iree_status_t iree_hal_cuda_device_enqueue_completion(
+    iree_hal_cuda_device_t* device, iree_hal_cuda_device_queue_t* queue,
+    const iree_hal_submission_batch_t* batch) {
+  const iree_host_size_t command_buffer_count = batch->command_buffer_count;
+  const iree_host_size_t signal_count = batch->signal_semaphores.count;
+  if (command_buffer_count == 0 && signal_count == 0) return iree_ok_status();
+
+  iree_hal_cuda_device_submission_t* submission = NULL;
+  iree_host_size_t total_size =
+      iree_sizeof_struct(*submission) + signal_count * sizeof(uint64_t) +
+      (command_buffer_count + signal_count) * sizeof(void*);
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      device->context_wrapper.host_allocator, total_size, (void**)&submission));
+  uint8_t* ptr = (uint8_t*)submission + iree_sizeof_struct(*submission);
+  submission->signal_semaphores.payload_values = (uint64_t*)ptr;
+  ptr += signal_count * sizeof(uint64_t);
+  submission->signal_semaphores.semaphores = (iree_hal_semaphore_t**)ptr;
+  ptr += signal_count * sizeof(void*);
+  submission->command_buffers = (iree_hal_command_buffer_t**)ptr;
+  submission->slist_entry.next = NULL;
+  submission->device = device;
+
+  submission->command_buffer_count = command_buffer_count;
+  for (iree_host_size_t i = 0; i < command_buffer_count; ++i) {
+    submission->command_buffers[i] = batch->command_buffers[i];
+    iree_hal_command_buffer_retain(batch->command_buffers[i]);
+  }
+  submission->signal_semaphores.count = signal_count;
+  for (iree_host_size_t i = 0; i < signal_count; ++i) {
+    submission->signal_semaphores.semaphores[i] =
+        batch->signal_semaphores.semaphores[i];
+    submission->signal_semaphores.payload_values[i] =
+        batch->signal_semaphores.payload_values[i];
+    iree_hal_semaphore_retain(batch->signal_semaphores.semaphores[i]);
+  }
+
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      device->context_wrapper.syms,
+      cuLaunchHostFunc(queue->stream, iree_hal_cuda_device_submission_complete,
+                       submission),
+      "cuLaunchHostFunc");
+  if (!iree_status_is_ok(status)) {
+    iree_hal_cuda_device_submission_free(submission);
+    return status;
+  }
+
+  // Work enqueued after this point on any queue can be ordered after the
+  // signals without waiting on the host.
+  for (iree_host_size_t i = 0; i < signal_count && iree_status_is_ok(status);
+       ++i) {
+    iree_hal_semaphore_t* semaphore = batch->signal_semaphores.semaphores[i];
+    if (iree_hal_cuda_semaphore_isa(semaphore)) {
+      status = iree_hal_cuda_semaphore_enqueue_signal(
+          semaphore, queue->stream, batch->signal_semaphores.payload_values[i]);
+    }
+  }
+  return status;
+}
+
+// Ensures all waits in |wait_semaphores| are satisfied before work is enqueued
+// on |queue|. Waits on signals already enqueued on the same stream are
+// satisfied by stream order, waits on signals enqueued on other streams are
+// performed by the device on an event, and all others are waited on by the
+// host. Must be called without the queue mutex held as the signal being waited
+// on may come from another thread submitting to the same queue.
+static iree_status_t iree_hal_cuda_device_wait_for_batch(
+    iree_hal_cuda_device_t* device, iree_hal_cuda_device_queue_t* queue,
+    const iree_hal_semaphore_list_t* wait_semaphores) {
+  for (iree_host_size_t i = 0; i < wait_semaphores->count; ++i) {
+    iree_hal_semaphore_t* semaphore = wait_semaphores->semaphores[i];
+    const uint64_t value = wait_semaphores->payload_values[i];
+    bool is_ordered = false;
+    if (iree_hal_cuda_semaphore_isa(semaphore)) {
+      IREE_RETURN_IF_ERROR(iree_hal_cuda_semaphore_enqueue_wait(
+          semaphore, queue->stream, value, &is_ordered));
+    }
+    if (is_ordered) continue;
+    IREE_RETURN_IF_ERROR(
+        iree_hal_semaphore_wait(semaphore, value, iree_infinite_timeout()));
+  }
+  return iree_ok_status();
+}
+
 static iree_status_t iree_hal_cuda_device_queue_submit(
     iree_hal_device_t* base_device,
     iree_hal_command_category_t command_categories,
     iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
     const iree_hal_submission_batch_t* batches) {
   iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
-  for (int i = 0; i < batch_count; i++) {
-    for (int j = 0; j < batches[i].command_buffer_count; j++) {
+  iree_hal_cuda_device_queue_t* queue = iree_hal_cuda_device_select_queue(
+      device, command_categories, queue_affinity);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Release resources from prior submissions that have since completed.
+  iree_hal_cuda_device_reclaim_submissions(device);
+
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < batch_count && iree_status_is_ok(status);
+       i++) {
+    status = iree_hal_cuda_device_wait_for_batch(device, queue,
+                                                 &batches[i].wait_semaphores);
+    if (!iree_status_is_ok(status)) break;
+    iree_slim_mutex_lock(&queue->mutex);
+    for (iree_host_size_t j = 0;
+         j < batches[i].command_buffer_count && iree_status_is_ok(status);
+         j++) {
       iree_hal_command_buffer_t* command_buffer = batches[i].command_buffers[j];
       if (iree_hal_cuda_stream_command_buffer_isa(command_buffer)) {
         // Nothing to do for an inline command buffer; all the work has already
-        // been submitted. When we support semaphores we'll still need to signal
-        // their completion but do not have to worry about any waits: if there
-        // were waits we wouldn't have been able to execute inline!
+        // been submitted. We still signal its completion below but do not have
+        // to worry about any waits: if there were waits we wouldn't have been
+        // able to execute inline!
       } else if (iree_hal_cuda_graph_command_buffer_isa(command_buffer)) {
-        CUgraphExec exec = iree_hal_cuda_graph_command_buffer_exec(
-            batches[i].command_buffers[j]);
-        CUDA_RETURN_IF_ERROR(device->context_wrapper.syms,
-                             cuGraphLaunch(exec, device->stream),
-                             "cuGraphLaunch");
+        status = iree_hal_cuda_graph_command_buffer_launch(
+            command_buffer, queue->stream, device->profiler);
       } else {
-        IREE_RETURN_IF_ERROR(iree_hal_deferred_command_buffer_apply(
-            batches[i].command_buffers[j], device->stream_command_buffer));
+        status = iree_hal_deferred_command_buffer_apply(
+            command_buffer, queue->stream_command_buffer,
+            batches[i].binding_tables ? batches[i].binding_tables[j]
+                                      : iree_hal_buffer_binding_table_empty());
       }
     }
+    if (iree_status_is_ok(status)) {
+      // Signals and resource release happen asynchronously as the stream
+      // executes; we return as soon as the work is enqueued.
+      status =
+          iree_hal_cuda_device_enqueue_completion(device, queue, &batches[i]);
+    }
+    iree_slim_mutex_unlock(&queue->mutex);
   }
-  // TODO(thomasraoux): implement semaphores - for now this conservatively
-  // synchronizes after every submit.
-  CUDA_RETURN_IF_ERROR(device->context_wrapper.syms,
-                       cuStreamSynchronize(device->stream),
-                       "cuStreamSynchronize");
-  return iree_ok_status();
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_hal_cuda_device_queue_barrier(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list) {
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = wait_semaphore_list;
+  batch.signal_semaphores = signal_semaphore_list;
+  return iree_hal_cuda_device_queue_submit(
+      base_device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity, 1, &batch);
+}
+
+// Device-local allocations are made in stream order from the allocator
+// memory pool when async allocations are enabled and supported: the
+// allocation is enqueued on the queue stream after the waits and the signals
+// are enqueued after it such that no host synchronization is required.
+// All other allocations come from the transient buffer pool whose allocations
+// are reused once the semaphores signaled by their deallocation have been
+// reached or are waited on by the allocation reusing them.
+// Returns the device address of |offset| within |buffer| if it is a CUDA
+// buffer that the host cannot map and otherwise 0.
+static CUdeviceptr iree_hal_cuda_device_unmappable_buffer_pointer(
+    iree_hal_buffer_t* buffer, iree_device_size_t offset) {
+  if (!buffer) return 0;
+  if (iree_all_bits_set(iree_hal_buffer_memory_type(buffer),
+                        IREE_HAL_MEMORY_TYPE_HOST_VISIBLE)) {
+    return 0;
+  }
+  iree_hal_buffer_t* allocated_buffer =
+      iree_hal_buffer_allocated_buffer(buffer);
+  if (!iree_hal_cuda_buffer_isa(allocated_buffer)) return 0;
+  return iree_hal_cuda_buffer_device_pointer(allocated_buffer) +
+         iree_hal_buffer_byte_offset(buffer) + offset;
+}
+
+static iree_status_t iree_hal_cuda_device_transfer_range(
+    iree_hal_device_t* base_device, iree_hal_transfer_buffer_t source,
+    iree_device_size_t source_offset, iree_hal_transfer_buffer_t target,
+    iree_device_size_t target_offset, iree_device_size_t data_length,
+    iree_hal_transfer_buffer_flags_t flags, iree_timeout_t timeout) {
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+
+  // Transfers between host memory and device memory the host cannot map are
+  // staged through the ring. Everything else is either directly mappable or
+  // device-to-device and uses the generic path.
+  // TODO(thomasraoux): CUDA doesn't support a deadline for wait, figure out how
+  // to handle |timeout| better.
+  if (device->staging_ring) {
+    if (!source.device_buffer) {
+      CUdeviceptr target_ptr = iree_hal_cuda_device_unmappable_buffer_pointer(
+          target.device_buffer, target_offset);
+      if (target_ptr) {
+        return iree_hal_cuda_staging_ring_upload(
+            device->staging_ring, source.host_buffer.data + source_offset,
+            target_ptr, data_length);
+      }
+    } else if (!target.device_buffer) {
+      CUdeviceptr source_ptr = iree_hal_cuda_device_unmappable_buffer_pointer(
+          source.device_buffer, source_offset);
+      if (source_ptr) {
+        return iree_hal_cuda_staging_ring_download(
+            device->staging_ring, source_ptr,
+            target.host_buffer.data + target_offset, data_length);
+      }
+    }
+  }
+
+  return iree_hal_device_submit_transfer_range_and_wait(
+      base_device, source, source_offset, target, target_offset, data_length,
+      flags, timeout);
+}
+
+static iree_status_t iree_hal_cuda_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+
+  if (iree_hal_cuda_allocator_supports_async(device->device_allocator,
+                                             &params)) {
+    iree_hal_cuda_device_queue_t* queue = iree_hal_cuda_device_select_queue(
+        device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity);
+    iree_hal_cuda_device_reclaim_submissions(device);
+    IREE_RETURN_IF_ERROR(iree_hal_cuda_device_wait_for_batch(
+        device, queue, &wait_semaphore_list));
+    iree_hal_submission_batch_t batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.signal_semaphores = signal_semaphore_list;
+    iree_hal_buffer_t* buffer = NULL;
+    iree_slim_mutex_lock(&queue->mutex);
+    iree_status_t status = iree_hal_cuda_allocator_alloc_async(
+        device->device_allocator, queue->stream, &params, allocation_size,
+        &buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_cuda_device_enqueue_completion(device, queue, &batch);
+    }
+    iree_slim_mutex_unlock(&queue->mutex);
+    if (iree_status_is_ok(status)) {
+      *out_buffer = buffer;
+    } else {
+      iree_hal_buffer_release(buffer);
+    }
+    return status;
+  }
+
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_transient_buffer_pool_acquire(
+      device->transient_pool, params, allocation_size, wait_semaphore_list,
+      &buffer));
+  iree_status_t status = iree_hal_cuda_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+static iree_status_t iree_hal_cuda_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+
+  if (iree_hal_cuda_buffer_type(buffer) == IREE_HAL_CUDA_BUFFER_TYPE_ASYNC) {
+    // The memory is returned to the pool in stream order after the waits and
+    // may be reused by any subsequent allocation on the stream.
+    iree_hal_cuda_device_queue_t* queue = iree_hal_cuda_device_select_queue(
+        device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity);
+    iree_hal_cuda_device_reclaim_submissions(device);
+    IREE_RETURN_IF_ERROR(iree_hal_cuda_device_wait_for_batch(
+        device, queue, &wait_semaphore_list));
+    iree_hal_submission_batch_t batch;
+    memset(&batch, 0, sizeof(batch));
+    batch.signal_semaphores = signal_semaphore_list;
+    iree_slim_mutex_lock(&queue->mutex);
+    iree_status_t status = iree_hal_cuda_allocator_free_async(
+        device->device_allocator, queue->stream, buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_cuda_device_enqueue_completion(device, queue, &batch);
+    }
+    iree_slim_mutex_unlock(&queue->mutex);
+    return status;
+  }
+
+  IREE_RETURN_IF_ERROR(iree_hal_cuda_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list));
+  // The storage may still be in use by work on the stream until the barrier
+  // signals.
+  return iree_hal_transient_buffer_pool_release(device->transient_pool, buffer,
+                                                signal_semaphore_list);
 }
 
 static iree_status_t iree_hal_cuda_device_submit_and_wait(
@@ -375,27 +940,95 @@ static iree_status_t iree_hal_cuda_device_submit_and_wait(
 static iree_status_t iree_hal_cuda_device_wait_semaphores(
     iree_hal_device_t* base_device, iree_hal_wait_mode_t wait_mode,
     const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
-  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                          "semaphore not implemented");
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+  iree_status_t status = iree_hal_cuda_semaphore_multi_wait(
+      &device->semaphore_state, wait_mode, semaphore_list, timeout);
+  iree_hal_cuda_device_reclaim_submissions(device);
+  return status;
 }
 
 static iree_status_t iree_hal_cuda_device_wait_idle(
     iree_hal_device_t* base_device, iree_timeout_t timeout) {
   iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
-  // Wait until the stream is done.
+  // Wait until all streams are done.
   // TODO(thomasraoux): CUDA doesn't support a deadline for wait, figure out how
   // to handle it better.
-  CUDA_RETURN_IF_ERROR(device->context_wrapper.syms,
-                       cuStreamSynchronize(device->stream),
-                       "cuStreamSynchronize");
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    CUDA_RETURN_IF_ERROR(device->context_wrapper.syms,
+                         cuStreamSynchronize(device->queues[i].stream),
+                         "cuStreamSynchronize");
+  }
+  iree_hal_cuda_device_reclaim_submissions(device);
   return iree_ok_status();
 }
 
+// Sets the profiler used by all queues. Queues must be idle.
+static void iree_hal_cuda_device_set_profiler(
+    iree_hal_cuda_device_t* device, iree_hal_cuda_profiler_t* profiler) {
+  device->profiler = profiler;
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    iree_hal_cuda_device_queue_t* queue = &device->queues[i];
+    if (!queue->stream_command_buffer) continue;
+    iree_slim_mutex_lock(&queue->mutex);
+    iree_hal_cuda_stream_command_buffer_set_profiler(
+        queue->stream_command_buffer, profiler);
+    iree_slim_mutex_unlock(&queue->mutex);
+  }
+}
+
+static iree_status_t iree_hal_cuda_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+  if (device->profiler) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "profiling already active");
+  }
+  if (!iree_all_bits_set(options->mode,
+                         IREE_HAL_DEVICE_PROFILING_MODE_DISPATCHES)) {
+    // No supported modes requested.
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Dispatches are captured when issued to a stream: stream command buffers
+  // recorded and deferred command buffers submitted after this point and
+  // graph command buffers both recorded and submitted after this point.
+  iree_hal_cuda_profiler_t* profiler = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_cuda_profiler_create(&device->context_wrapper, options,
+                                        device->queues[0].stream, &profiler));
+  iree_hal_cuda_device_set_profiler(device, profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_cuda_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  iree_hal_cuda_device_t* device = iree_hal_cuda_device_cast(base_device);
+  if (!device->profiler) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // All captured dispatches must have completed before the capture is written.
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_cuda_device_wait_idle(base_device, iree_infinite_timeout()));
+
+  iree_hal_cuda_profiler_t* profiler = device->profiler;
+  iree_hal_cuda_device_set_profiler(device, NULL);
+  iree_status_t status = iree_hal_cuda_profiler_write(profiler);
+  iree_hal_cuda_profiler_destroy(profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static const iree_hal_device_vtable_t iree_hal_cuda_device_vtable = {
     .destroy = iree_hal_cuda_device_destroy,
     .id = iree_hal_cuda_device_id,
     .host_allocator = iree_hal_cuda_device_host_allocator,
     .device_allocator = iree_hal_cuda_device_allocator,
+    .replace_device_allocator = iree_hal_cuda_device_replace_allocator,
     .trim = iree_hal_cuda_device_trim,
     .query_i64 = iree_hal_cuda_device_query_i64,
     .create_command_buffer = iree_hal_cuda_device_create_command_buffer,
@@ -408,9 +1041,13 @@ static const iree_hal_device_vtable_t iree_hal_cuda_device_vtable = {
     .create_semaphore = iree_hal_cuda_device_create_semaphore,
     .query_semaphore_compatibility =
         iree_hal_cuda_device_query_semaphore_compatibility,
-    .transfer_range = iree_hal_device_submit_transfer_range_and_wait,
+    .transfer_range = iree_hal_cuda_device_transfer_range,
+    .queue_alloca = iree_hal_cuda_device_queue_alloca,
+    .queue_dealloca = iree_hal_cuda_device_queue_dealloca,
     .queue_submit = iree_hal_cuda_device_queue_submit,
     .submit_and_wait = iree_hal_cuda_device_submit_and_wait,
     .wait_semaphores = iree_hal_cuda_device_wait_semaphores,
     .wait_idle = iree_hal_cuda_device_wait_idle,
+    .profiling_begin = iree_hal_cuda_device_profiling_begin,
+    .profiling_end = iree_hal_cuda_device_profiling_end,
 };
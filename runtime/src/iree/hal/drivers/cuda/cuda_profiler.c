@@ -0,0 +1,452 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/cuda/cuda_profiler.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "iree/base/internal/file_io.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/drivers/cuda/dynamic_symbols.h"
+#include "iree/hal/drivers/cuda/native_executable.h"
+#include "iree/hal/drivers/cuda/status_util.h"
+
+typedef enum iree_hal_cuda_profiler_record_state_e {
+  // Appended but the events have not yet been enqueued.
+  IREE_HAL_CUDA_PROFILER_RECORD_STATE_APPENDED = 0,
+  // Events have been enqueued and will complete with the dispatch.
+  IREE_HAL_CUDA_PROFILER_RECORD_STATE_ENQUEUED,
+  // Enqueuing failed and the dispatch never executed.
+  IREE_HAL_CUDA_PROFILER_RECORD_STATE_DROPPED,
+  // Timings have been read back and the events reused.
+  IREE_HAL_CUDA_PROFILER_RECORD_STATE_RESOLVED,
+} iree_hal_cuda_profiler_record_state_t;
+
+// A dispatch appended to the capture.
+typedef struct iree_hal_cuda_profiler_record_t {
+  iree_hal_cuda_profiler_record_state_t state;
+  uint32_t executable_index;
+  uint32_t ordinal;
+  uint32_t workgroup_count[3];
+  // Events bracketing the dispatch until resolved.
+  CUevent start_event;
+  CUevent end_event;
+  // Timings relative to the start of the capture once resolved.
+  int64_t start_ns;
+  int64_t duration_ns;
+} iree_hal_cuda_profiler_record_t;
+
+struct iree_hal_cuda_profiler_t {
+  iree_hal_cuda_context_wrapper_t* context;
+
+  // NUL-terminated path the capture is written to.
+  const char* file_path;
+
+  // Stream and event marking the start of the capture. All device times are
+  // measured relative to the event.
+  CUstream stream;
+  CUevent begin_event;
+
+  // Guards all mutable state below.
+  iree_slim_mutex_t mutex;
+
+  // Dispatch records in append order. Records before |resolved_count| have
+  // been resolved.
+  iree_host_size_t record_count;
+  iree_host_size_t record_capacity;
+  iree_hal_cuda_profiler_record_t* records;
+  iree_host_size_t resolved_count;
+
+  // Events of resolved records available for reuse.
+  iree_host_size_t free_event_count;
+  iree_host_size_t free_event_capacity;
+  CUevent* free_events;
+
+  // Retained executables indexed by executable index.
+  iree_host_size_t executable_count;
+  iree_host_size_t executable_capacity;
+  iree_hal_executable_t** executables;
+  // Index of the executable most recently dispatched as dispatches of the same
+  // executable tend to be recorded together.
+  iree_host_size_t last_executable_index;
+};
+
+iree_status_t iree_hal_cuda_profiler_create(
+    iree_hal_cuda_context_wrapper_t* context,
+    const iree_hal_device_profiling_options_t* options, CUstream stream,
+    iree_hal_cuda_profiler_t** out_profiler) {
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_profiler);
+  *out_profiler = NULL;
+  if (!options->file_path || !strlen(options->file_path)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "profiling requires a capture file path");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_cuda_profiler_t* profiler = NULL;
+  const iree_host_size_t file_path_length = strlen(options->file_path);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(context->host_allocator,
+                                sizeof(*profiler) + file_path_length + 1,
+                                (void**)&profiler));
+  memset(profiler, 0, sizeof(*profiler));
+  profiler->context = context;
+  char* file_path = (char*)profiler + sizeof(*profiler);
+  memcpy(file_path, options->file_path, file_path_length + 1);
+  profiler->file_path = file_path;
+  profiler->stream = stream;
+  iree_slim_mutex_initialize(&profiler->mutex);
+
+  // Waiting for the begin event ensures the capture starts once all prior work
+  // on the stream has completed and not when the stream happens to reach it.
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      context->syms, cuEventCreate(&profiler->begin_event, CU_EVENT_DEFAULT),
+      "cuEventCreate");
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(
+        context->syms, cuEventRecord(profiler->begin_event, stream),
+        "cuEventRecord");
+  }
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(context->syms,
+                                 cuEventSynchronize(profiler->begin_event),
+                                 "cuEventSynchronize");
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_profiler = profiler;
+  } else {
+    iree_hal_cuda_profiler_destroy(profiler);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_hal_cuda_profiler_destroy(iree_hal_cuda_profiler_t* profiler) {
+  if (!profiler) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_cuda_context_wrapper_t* context = profiler->context;
+
+  for (iree_host_size_t i = profiler->resolved_count;
+       i < profiler->record_count; ++i) {
+    iree_hal_cuda_profiler_record_t* record = &profiler->records[i];
+    CUDA_IGNORE_ERROR(context->syms, cuEventDestroy(record->start_event));
+    CUDA_IGNORE_ERROR(context->syms, cuEventDestroy(record->end_event));
+  }
+  iree_allocator_free(context->host_allocator, profiler->records);
+  for (iree_host_size_t i = 0; i < profiler->free_event_count; ++i) {
+    CUDA_IGNORE_ERROR(context->syms, cuEventDestroy(profiler->free_events[i]));
+  }
+  iree_allocator_free(context->host_allocator, profiler->free_events);
+  for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+    iree_hal_executable_release(profiler->executables[i]);
+  }
+  iree_allocator_free(context->host_allocator, profiler->executables);
+  if (profiler->begin_event) {
+    CUDA_IGNORE_ERROR(context->syms, cuEventDestroy(profiler->begin_event));
+  }
+  iree_slim_mutex_deinitialize(&profiler->mutex);
+  iree_allocator_free(context->host_allocator, profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Returns the number of nanoseconds between |start_event| and |end_event|.
+static iree_status_t iree_hal_cuda_profiler_elapsed_ns(
+    iree_hal_cuda_profiler_t* profiler, CUevent start_event, CUevent end_event,
+    int64_t* out_elapsed_ns) {
+  // The driver reports milliseconds with a resolution of around 0.5us.
+  float elapsed_ms = 0.0f;
+  IREE_RETURN_IF_ERROR(CU_RESULT_TO_STATUS(
+      profiler->context->syms,
+      cuEventElapsedTime(&elapsed_ms, start_event, end_event),
+      "cuEventElapsedTime"));
+  *out_elapsed_ns = (int64_t)((double)elapsed_ms * 1000000.0);
+  return iree_ok_status();
+}
+
+// Returns the events of |record| to the free list. Requires the profiler mutex.
+static iree_status_t iree_hal_cuda_profiler_release_events(
+    iree_hal_cuda_profiler_t* profiler,
+    iree_hal_cuda_profiler_record_t* record) {
+  if (profiler->free_event_count + 2 > profiler->free_event_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(32, profiler->free_event_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        profiler->context->host_allocator,
+        new_capacity * sizeof(*profiler->free_events),
+        (void**)&profiler->free_events));
+    profiler->free_event_capacity = new_capacity;
+  }
+  profiler->free_events[profiler->free_event_count++] = record->start_event;
+  profiler->free_events[profiler->free_event_count++] = record->end_event;
+  record->start_event = NULL;
+  record->end_event = NULL;
+  return iree_ok_status();
+}
+
+// Resolves the timings of records in append order. Stops at the first record
+// that has not completed unless |wait| is set in which case the host waits for
+// it. Requires the profiler mutex.
+static iree_status_t iree_hal_cuda_profiler_resolve(
+    iree_hal_cuda_profiler_t* profiler, bool wait) {
+  iree_hal_cuda_dynamic_symbols_t* syms = profiler->context->syms;
+  while (profiler->resolved_count < profiler->record_count) {
+    iree_hal_cuda_profiler_record_t* record =
+        &profiler->records[profiler->resolved_count];
+    if (record->state == IREE_HAL_CUDA_PROFILER_RECORD_STATE_APPENDED) {
+      // Not yet enqueued. Waiting only happens once all work has been
+      // submitted so the dispatch will never execute.
+      if (!wait) break;
+    } else if (record->state == IREE_HAL_CUDA_PROFILER_RECORD_STATE_ENQUEUED) {
+      CUresult result = syms->cuEventQuery(record->end_event);
+      if (result == CUDA_ERROR_NOT_READY) {
+        if (!wait) break;
+        result = syms->cuEventSynchronize(record->end_event);
+      }
+      IREE_RETURN_IF_ERROR(iree_hal_cuda_result_to_status(
+          syms, result, __FILE__, __LINE__));
+      IREE_RETURN_IF_ERROR(iree_hal_cuda_profiler_elapsed_ns(
+          profiler, profiler->begin_event, record->start_event,
+          &record->start_ns));
+      IREE_RETURN_IF_ERROR(iree_hal_cuda_profiler_elapsed_ns(
+          profiler, record->start_event, record->end_event,
+          &record->duration_ns));
+    }
+    IREE_RETURN_IF_ERROR(
+        iree_hal_cuda_profiler_release_events(profiler, record));
+    record->state = IREE_HAL_CUDA_PROFILER_RECORD_STATE_RESOLVED;
+    ++profiler->resolved_count;
+  }
+  return iree_ok_status();
+}
+
+// Returns the index of |executable| in the executable table, adding it if this
+// is the first dispatch of the executable. Requires the profiler mutex.
+static iree_status_t iree_hal_cuda_profiler_lookup_executable(
+    iree_hal_cuda_profiler_t* profiler, iree_hal_executable_t* executable,
+    uint32_t* out_executable_index) {
+  if (profiler->last_executable_index < profiler->executable_count &&
+      profiler->executables[profiler->last_executable_index] == executable) {
+    *out_executable_index = (uint32_t)profiler->last_executable_index;
+    return iree_ok_status();
+  }
+  for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+    if (profiler->executables[i] == executable) {
+      profiler->last_executable_index = i;
+      *out_executable_index = (uint32_t)i;
+      return iree_ok_status();
+    }
+  }
+
+  if (profiler->executable_count == profiler->executable_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(16, profiler->executable_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        profiler->context->host_allocator,
+        new_capacity * sizeof(*profiler->executables),
+        (void**)&profiler->executables));
+    profiler->executable_capacity = new_capacity;
+  }
+
+  // Executables are retained so that they are not reused for other
+  // executables while the capture is active.
+  const iree_host_size_t executable_index = profiler->executable_count++;
+  profiler->executables[executable_index] = executable;
+  iree_hal_executable_retain(executable);
+  profiler->last_executable_index = executable_index;
+  *out_executable_index = (uint32_t)executable_index;
+  return iree_ok_status();
+}
+
+// Returns an event from the free list or creates a new one. Requires the
+// profiler mutex.
+static iree_status_t iree_hal_cuda_profiler_acquire_event(
+    iree_hal_cuda_profiler_t* profiler, CUevent* out_event) {
+  if (profiler->free_event_count > 0) {
+    *out_event = profiler->free_events[--profiler->free_event_count];
+    return iree_ok_status();
+  }
+  return CU_RESULT_TO_STATUS(profiler->context->syms,
+                             cuEventCreate(out_event, CU_EVENT_DEFAULT),
+                             "cuEventCreate");
+}
+
+// Allocates a new record with its events. Requires the profiler mutex.
+static iree_status_t iree_hal_cuda_profiler_allocate_record(
+    iree_hal_cuda_profiler_t* profiler,
+    iree_hal_cuda_profiler_record_t** out_record) {
+  if (profiler->record_count == profiler->record_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(256, profiler->record_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        profiler->context->host_allocator,
+        new_capacity * sizeof(*profiler->records),
+        (void**)&profiler->records));
+    profiler->record_capacity = new_capacity;
+  }
+  CUevent start_event = NULL;
+  CUevent end_event = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_cuda_profiler_acquire_event(profiler, &start_event));
+  iree_status_t status =
+      iree_hal_cuda_profiler_acquire_event(profiler, &end_event);
+  if (!iree_status_is_ok(status)) {
+    CUDA_IGNORE_ERROR(profiler->context->syms, cuEventDestroy(start_event));
+    return status;
+  }
+  iree_hal_cuda_profiler_record_t* record =
+      &profiler->records[profiler->record_count++];
+  memset(record, 0, sizeof(*record));
+  record->state = IREE_HAL_CUDA_PROFILER_RECORD_STATE_APPENDED;
+  record->start_event = start_event;
+  record->end_event = end_event;
+  *out_record = record;
+  return iree_ok_status();
+}
+
+iree_status_t iree_hal_cuda_profiler_append_dispatch(
+    iree_hal_cuda_profiler_t* profiler, iree_hal_executable_t* executable,
+    int32_t entry_point, uint32_t workgroup_x, uint32_t workgroup_y,
+    uint32_t workgroup_z, iree_hal_cuda_profiler_dispatch_t* out_dispatch) {
+  IREE_ASSERT_ARGUMENT(profiler);
+  IREE_ASSERT_ARGUMENT(executable);
+  IREE_ASSERT_ARGUMENT(out_dispatch);
+  memset(out_dispatch, 0, sizeof(*out_dispatch));
+
+  iree_slim_mutex_lock(&profiler->mutex);
+  // Resolving here keeps the number of live events proportional to the work
+  // in-flight. Only completed records are resolved so this does not block.
+  iree_status_t status = iree_hal_cuda_profiler_resolve(profiler,
+                                                        /*wait=*/false);
+  uint32_t executable_index = 0;
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_cuda_profiler_lookup_executable(profiler, executable,
+                                                      &executable_index);
+  }
+  iree_hal_cuda_profiler_record_t* record = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_cuda_profiler_allocate_record(profiler, &record);
+  }
+  if (iree_status_is_ok(status)) {
+    record->executable_index = executable_index;
+    record->ordinal = (uint32_t)entry_point;
+    record->workgroup_count[0] = workgroup_x;
+    record->workgroup_count[1] = workgroup_y;
+    record->workgroup_count[2] = workgroup_z;
+    out_dispatch->record_index = profiler->record_count - 1;
+    out_dispatch->start_event = record->start_event;
+    out_dispatch->end_event = record->end_event;
+  }
+  iree_slim_mutex_unlock(&profiler->mutex);
+  return status;
+}
+
+void iree_hal_cuda_profiler_commit_dispatch(
+    iree_hal_cuda_profiler_t* profiler,
+    const iree_hal_cuda_profiler_dispatch_t* dispatch, bool enqueued) {
+  IREE_ASSERT_ARGUMENT(profiler);
+  IREE_ASSERT_ARGUMENT(dispatch);
+  iree_slim_mutex_lock(&profiler->mutex);
+  profiler->records[dispatch->record_index].state =
+      enqueued ? IREE_HAL_CUDA_PROFILER_RECORD_STATE_ENQUEUED
+               : IREE_HAL_CUDA_PROFILER_RECORD_STATE_DROPPED;
+  iree_slim_mutex_unlock(&profiler->mutex);
+}
+
+iree_status_t iree_hal_cuda_profiler_write(iree_hal_cuda_profiler_t* profiler) {
+  IREE_ASSERT_ARGUMENT(profiler);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_slim_mutex_lock(&profiler->mutex);
+
+  // Mark the end of the capture after all captured work has completed.
+  CUevent end_event = NULL;
+  int64_t duration_ns = 0;
+  iree_status_t status = iree_hal_cuda_profiler_resolve(profiler,
+                                                        /*wait=*/true);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_cuda_profiler_acquire_event(profiler, &end_event);
+  }
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(profiler->context->syms,
+                                 cuEventRecord(end_event, profiler->stream),
+                                 "cuEventRecord");
+  }
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(profiler->context->syms,
+                                 cuEventSynchronize(end_event),
+                                 "cuEventSynchronize");
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_cuda_profiler_elapsed_ns(
+        profiler, profiler->begin_event, end_event, &duration_ns);
+  }
+  if (end_event) {
+    CUDA_IGNORE_ERROR(profiler->context->syms, cuEventDestroy(end_event));
+  }
+
+  const iree_host_size_t total_size =
+      sizeof(iree_hal_cuda_profile_file_header_t) +
+      profiler->executable_count *
+          sizeof(iree_hal_cuda_profile_file_executable_t) +
+      profiler->record_count * sizeof(iree_hal_cuda_profile_file_dispatch_t);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, total_size);
+
+  uint8_t* contents = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_allocator_malloc(profiler->context->host_allocator,
+                                   total_size, (void**)&contents);
+  }
+  if (iree_status_is_ok(status)) {
+    memset(contents, 0, total_size);
+    uint8_t* ptr = contents;
+
+    iree_hal_cuda_profile_file_header_t* header =
+        (iree_hal_cuda_profile_file_header_t*)ptr;
+    header->magic = IREE_HAL_CUDA_PROFILE_FILE_MAGIC;
+    header->version = IREE_HAL_CUDA_PROFILE_FILE_VERSION;
+    header->worker_count = 0;
+    header->executable_count = (uint32_t)profiler->executable_count;
+    header->dispatch_count = (uint64_t)profiler->record_count;
+    header->duration_ns = duration_ns;
+    ptr += sizeof(*header);
+
+    for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+      iree_hal_cuda_profile_file_executable_t* executable =
+          (iree_hal_cuda_profile_file_executable_t*)ptr;
+      executable->export_count =
+          (uint32_t)iree_hal_cuda_native_executable_entry_count(
+              profiler->executables[i]);
+      ptr += sizeof(*executable);
+    }
+
+    for (iree_host_size_t i = 0; i < profiler->record_count; ++i) {
+      const iree_hal_cuda_profiler_record_t* record = &profiler->records[i];
+      iree_hal_cuda_profile_file_dispatch_t* dispatch =
+          (iree_hal_cuda_profile_file_dispatch_t*)ptr;
+      dispatch->executable_index = record->executable_index;
+      dispatch->ordinal = record->ordinal;
+      memcpy(dispatch->workgroup_count, record->workgroup_count,
+             sizeof(dispatch->workgroup_count));
+      dispatch->start_ns = record->start_ns;
+      dispatch->duration_ns = record->duration_ns;
+      ptr += sizeof(*dispatch);
+    }
+
+    status = iree_file_write_contents(
+        profiler->file_path, iree_make_const_byte_span(contents, total_size));
+  }
+
+  iree_slim_mutex_unlock(&profiler->mutex);
+  iree_allocator_free(profiler->context->host_allocator, contents);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -0,0 +1,133 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_CUDA_CUDA_PROFILER_H_
+#define IREE_HAL_DRIVERS_CUDA_CUDA_PROFILER_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/drivers/cuda/context_wrapper.h"
+#include "iree/hal/drivers/cuda/cuda_headers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// Capture file format
+//===----------------------------------------------------------------------===//
+
+// A capture file uses the same layout as those of the local-task device (see
+// iree/hal/drivers/local_task/task_profiler.h) such that the same tools can
+// read captures from either:
+//   iree_hal_cuda_profile_file_header_t header;
+//   iree_hal_cuda_profile_file_executable_t executables[executable_count];
+//   iree_hal_cuda_profile_file_dispatch_t dispatches[dispatch_count];
+//
+// Dispatches execute on the device and have no per-worker tile counters so the
+// header worker_count is always 0. Dispatches are stored in the order they
+// were issued and all times are in nanoseconds relative to the start of the
+// capture as measured by the device.
+
+// 'IRDP' when read as bytes on little-endian hosts.
+#define IREE_HAL_CUDA_PROFILE_FILE_MAGIC 0x50445249u
+#define IREE_HAL_CUDA_PROFILE_FILE_VERSION 1u
+
+typedef struct iree_hal_cuda_profile_file_header_t {
+  // IREE_HAL_CUDA_PROFILE_FILE_MAGIC.
+  uint32_t magic;
+  // IREE_HAL_CUDA_PROFILE_FILE_VERSION.
+  uint32_t version;
+  // Number of tile counters per dispatch; always 0.
+  uint32_t worker_count;
+  // Number of entries in the executable table.
+  uint32_t executable_count;
+  // Number of dispatch records following the executable table.
+  uint64_t dispatch_count;
+  // Duration of the capture from begin to end.
+  int64_t duration_ns;
+} iree_hal_cuda_profile_file_header_t;
+
+// Executables are assigned indices in the order they were first dispatched.
+typedef struct iree_hal_cuda_profile_file_executable_t {
+  // Total number of exports in the executable.
+  uint32_t export_count;
+  uint32_t reserved;
+} iree_hal_cuda_profile_file_executable_t;
+
+typedef struct iree_hal_cuda_profile_file_dispatch_t {
+  // Index of the dispatched executable in the executable table.
+  uint32_t executable_index;
+  // Export ordinal within the executable.
+  uint32_t ordinal;
+  // Workgroup count the dispatch was issued with.
+  uint32_t workgroup_count[3];
+  uint32_t reserved;
+  // Time the dispatch started executing.
+  int64_t start_ns;
+  // Time from the dispatch starting to it completing. 0 if the dispatch was
+  // never executed.
+  int64_t duration_ns;
+} iree_hal_cuda_profile_file_dispatch_t;
+
+//===----------------------------------------------------------------------===//
+// iree_hal_cuda_profiler_t
+//===----------------------------------------------------------------------===//
+
+// A dispatch appended to a profiler capture.
+// The start and end events must be recorded immediately before and after the
+// dispatch in stream order and the dispatch committed once they have been.
+typedef struct iree_hal_cuda_profiler_dispatch_t {
+  iree_host_size_t record_index;
+  CUevent start_event;
+  CUevent end_event;
+} iree_hal_cuda_profiler_dispatch_t;
+
+// Captures the dispatches issued to a CUDA device between profiling begin and
+// end. Each dispatch is bracketed by a pair of timing events owned by the
+// profiler. Timings are resolved asynchronously as new dispatches are appended
+// and the events of resolved dispatches are reused such that the number of
+// live events is bounded by the amount of work in-flight rather than the
+// length of the capture.
+//
+// Thread-safe; dispatches may be appended from multiple queues concurrently.
+typedef struct iree_hal_cuda_profiler_t iree_hal_cuda_profiler_t;
+
+// Creates a profiler that writes to the file specified in |options|.
+// The start of the capture is marked on |stream| which must remain valid for
+// the lifetime of the profiler.
+iree_status_t iree_hal_cuda_profiler_create(
+    iree_hal_cuda_context_wrapper_t* context,
+    const iree_hal_device_profiling_options_t* options, CUstream stream,
+    iree_hal_cuda_profiler_t** out_profiler);
+
+// Destroys |profiler| and releases all captured executables.
+// All dispatches appended must have completed.
+void iree_hal_cuda_profiler_destroy(iree_hal_cuda_profiler_t* profiler);
+
+// Appends a dispatch of |executable| export |entry_point| to the capture and
+// returns the events bracketing it in |out_dispatch|.
+iree_status_t iree_hal_cuda_profiler_append_dispatch(
+    iree_hal_cuda_profiler_t* profiler, iree_hal_executable_t* executable,
+    int32_t entry_point, uint32_t workgroup_x, uint32_t workgroup_y,
+    uint32_t workgroup_z, iree_hal_cuda_profiler_dispatch_t* out_dispatch);
+
+// Commits |dispatch| after its events have been enqueued. If |enqueued| is
+// false enqueuing failed and the dispatch is recorded as never having
+// executed. Every appended dispatch must be committed exactly once.
+void iree_hal_cuda_profiler_commit_dispatch(
+    iree_hal_cuda_profiler_t* profiler,
+    const iree_hal_cuda_profiler_dispatch_t* dispatch, bool enqueued);
+
+// Writes the capture to the profiler file.
+// All dispatches appended must have completed.
+iree_status_t iree_hal_cuda_profiler_write(iree_hal_cuda_profiler_t* profiler);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_CUDA_CUDA_PROFILER_H_
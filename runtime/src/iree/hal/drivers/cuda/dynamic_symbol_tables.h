@@ -6,13 +6,26 @@
 
 CU_PFN_DECL(cuCtxCreate, CUcontext*, unsigned int, CUdevice)
 CU_PFN_DECL(cuCtxDestroy, CUcontext)
+CU_PFN_DECL(cuCtxEnablePeerAccess, CUcontext, unsigned int)
+CU_PFN_DECL(cuCtxPopCurrent, CUcontext*)
+CU_PFN_DECL(cuCtxPushCurrent, CUcontext)
+CU_PFN_DECL(cuDeviceCanAccessPeer, int*, CUdevice, CUdevice)
 CU_PFN_DECL(cuDeviceGet, CUdevice*, int)
 CU_PFN_DECL(cuDeviceGetCount, int*)
 CU_PFN_DECL(cuDeviceGetName, char*, int, CUdevice)
 CU_PFN_DECL(cuDeviceGetAttribute, int*, CUdevice_attribute, CUdevice)
 CU_PFN_DECL(cuDeviceGetUuid, CUuuid*, CUdevice)
+CU_PFN_DECL(cuDriverGetVersion, int*)
+CU_PFN_DECL(cuEventCreate, CUevent*, unsigned int)
+CU_PFN_DECL(cuEventDestroy, CUevent)
+CU_PFN_DECL(cuEventElapsedTime, float*, CUevent, CUevent)
+CU_PFN_DECL(cuEventQuery, CUevent)
+CU_PFN_DECL(cuEventRecord, CUevent, CUstream)
+CU_PFN_DECL(cuEventSynchronize, CUevent)
 CU_PFN_DECL(cuGetErrorName, CUresult, const char**)
 CU_PFN_DECL(cuGetErrorString, CUresult, const char**)
+CU_PFN_DECL(cuGraphAddEmptyNode, CUgraphNode*, CUgraph, const CUgraphNode*,
+            size_t)
 CU_PFN_DECL(cuGraphAddMemcpyNode, CUgraphNode*, CUgraph, const CUgraphNode*,
             size_t, const CUDA_MEMCPY3D*, CUcontext)
 CU_PFN_DECL(cuGraphAddMemsetNode, CUgraphNode*, CUgraph, const CUgraphNode*,
@@ -22,11 +35,14 @@ CU_PFN_DECL(cuGraphAddKernelNode, CUgraphNode*, CUgraph, const CUgraphNode*,
 CU_PFN_DECL(cuGraphCreate, CUgraph*, unsigned int)
 CU_PFN_DECL(cuGraphDestroy, CUgraph)
 CU_PFN_DECL(cuGraphExecDestroy, CUgraphExec)
+CU_PFN_DECL(cuGraphExecUpdate, CUgraphExec, CUgraph, CUgraphNode*,
+            CUgraphExecUpdateResult*)
 CU_PFN_DECL(cuGraphGetNodes, CUgraph, CUgraphNode*, size_t*)
 CU_PFN_DECL(cuGraphInstantiate, CUgraphExec*, CUgraph, CUgraphNode*, char*,
             size_t)
 CU_PFN_DECL(cuGraphLaunch, CUgraphExec, CUstream)
 CU_PFN_DECL(cuInit, unsigned int)
+CU_PFN_DECL(cuLaunchHostFunc, CUstream, CUhostFn, void*)
 CU_PFN_DECL(cuMemAllocManaged, CUdeviceptr*, size_t, unsigned int)
 CU_PFN_DECL(cuMemPrefetchAsync, CUdeviceptr, size_t, CUdevice, CUstream)
 CU_PFN_DECL(cuMemAlloc, CUdeviceptr*, size_t)
@@ -35,6 +51,12 @@ CU_PFN_DECL(cuMemFreeHost, void*)
 CU_PFN_DECL(cuMemHostAlloc, void**, size_t, unsigned int)
 CU_PFN_DECL(cuMemHostGetDevicePointer, CUdeviceptr*, void*, unsigned int)
 CU_PFN_DECL(cuModuleGetFunction, CUfunction*, CUmodule, const char*)
+CU_PFN_DECL(cuLinkAddData, CUlinkState, CUjitInputType, void*, size_t,
+            const char*, unsigned int, CUjit_option*, void**)
+CU_PFN_DECL(cuLinkComplete, CUlinkState, void**, size_t*)
+CU_PFN_DECL(cuLinkCreate, unsigned int, CUjit_option*, void**, CUlinkState*)
+CU_PFN_DECL(cuLinkDestroy, CUlinkState)
+CU_PFN_DECL(cuModuleLoadData, CUmodule*, const void*)
 CU_PFN_DECL(cuModuleLoadDataEx, CUmodule*, const void*, unsigned int,
             CUjit_option*, void**)
 CU_PFN_DECL(cuModuleUnload, CUmodule)
@@ -50,7 +72,29 @@ CU_PFN_DECL(cuMemsetD8Async, unsigned long long, unsigned char, size_t,
             CUstream)
 CU_PFN_DECL(cuMemcpyAsync, CUdeviceptr, CUdeviceptr, size_t, CUstream)
 CU_PFN_DECL(cuMemcpyHtoDAsync_v2, CUdeviceptr, const void*, size_t, CUstream)
+CU_PFN_DECL(cuMemcpyDtoHAsync_v2, void*, CUdeviceptr, size_t, CUstream)
 CU_PFN_DECL(cuFuncSetAttribute, CUfunction, CUfunction_attribute, int)
 CU_PFN_DECL(cuLaunchKernel, CUfunction, unsigned int, unsigned int,
             unsigned int, unsigned int, unsigned int, unsigned int,
             unsigned int, CUstream, void**, void**)
+
+// Stream-ordered memory pools (CUDA 11.2+). Optional as older drivers do not
+// export them; users must check for NULL and fall back to synchronous
+// allocation.
+CU_PFN_DECL_OPTIONAL(cuMemAllocFromPoolAsync, CUdeviceptr*, size_t,
+                     CUmemoryPool, CUstream)
+CU_PFN_DECL_OPTIONAL(cuMemFreeAsync, CUdeviceptr, CUstream)
+CU_PFN_DECL_OPTIONAL(cuMemPoolCreate, CUmemoryPool*, const CUmemPoolProps*)
+CU_PFN_DECL_OPTIONAL(cuMemPoolDestroy, CUmemoryPool)
+CU_PFN_DECL_OPTIONAL(cuMemPoolSetAttribute, CUmemoryPool, CUmemPool_attribute,
+                     void*)
+CU_PFN_DECL_OPTIONAL(cuMemPoolSetAccess, CUmemoryPool, const CUmemAccessDesc*,
+                     size_t)
+CU_PFN_DECL_OPTIONAL(cuMemPoolTrimTo, CUmemoryPool, size_t)
+
+// Graph event record nodes (CUDA 11.1+). Optional as older drivers do not
+// export them; graph command buffers are not profiled without them.
+CU_PFN_DECL_OPTIONAL(cuGraphAddEventRecordNode, CUgraphNode*, CUgraph,
+                     const CUgraphNode*, size_t, CUevent)
+CU_PFN_DECL_OPTIONAL(cuGraphExecEventRecordNodeSetEvent, CUgraphExec,
+                     CUgraphNode, CUevent)
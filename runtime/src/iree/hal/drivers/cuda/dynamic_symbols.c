@@ -35,8 +35,20 @@ static iree_status_t iree_hal_cuda_dynamic_symbols_resolve_all(
     iree_dynamic_library_lookup_symbol(syms->loader_library, kNameV2, &funV2); \
     if (funV2) syms->cudaSymbolName = funV2;                                   \
   }
+#define CU_PFN_DECL_OPTIONAL(cudaSymbolName, ...)                              \
+  {                                                                            \
+    static const char* kName = #cudaSymbolName;                                \
+    iree_status_ignore(iree_dynamic_library_lookup_symbol(                     \
+        syms->loader_library, kName, (void**)&syms->cudaSymbolName));          \
+    static const char* kNameV2 = concat(#cudaSymbolName, "_v2");               \
+    void* funV2 = NULL;                                                        \
+    iree_status_ignore(iree_dynamic_library_lookup_symbol(                     \
+        syms->loader_library, kNameV2, &funV2));                               \
+    if (funV2) syms->cudaSymbolName = funV2;                                   \
+  }
 #include "iree/hal/drivers/cuda/dynamic_symbol_tables.h"  // IWYU pragma: keep
 #undef CU_PFN_DECL
+#undef CU_PFN_DECL_OPTIONAL
   return iree_ok_status();
 }
 
@@ -18,14 +18,18 @@ extern "C" {
 // DynamicSymbols allow loading dynamically a subset of CUDA driver API. It
 // loads all the function declared in `dynamic_symbol_tables.def` and fail if
 // any of the symbol is not available. The functions signatures are matching
-// the declarations in `cuda.h`.
+// the declarations in `cuda.h`. Symbols declared with CU_PFN_DECL_OPTIONAL are
+// NULL when not available in the loaded driver and must be checked before use.
 typedef struct iree_hal_cuda_dynamic_symbols_t {
   iree_dynamic_library_t* loader_library;
 
 #define CU_PFN_DECL(cudaSymbolName, ...) \
   CUresult (*cudaSymbolName)(__VA_ARGS__);
+#define CU_PFN_DECL_OPTIONAL(cudaSymbolName, ...) \
+  CUresult (*cudaSymbolName)(__VA_ARGS__);
 #include "iree/hal/drivers/cuda/dynamic_symbol_tables.h"  // IWYU pragma: export
 #undef CU_PFN_DECL
+#undef CU_PFN_DECL_OPTIONAL
 } iree_hal_cuda_dynamic_symbols_t;
 
 // Initializes |out_syms| in-place with dynamically loaded CUDA symbols.
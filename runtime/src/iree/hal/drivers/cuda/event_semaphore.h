@@ -10,6 +10,7 @@
 #include <stdint.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/synchronization.h"
 #include "iree/hal/api.h"
 #include "iree/hal/drivers/cuda/context_wrapper.h"
 #include "iree/hal/drivers/cuda/status_util.h"
@@ -18,11 +19,76 @@
 extern "C" {
 #endif  // __cplusplus
 
-// Create a cuda allocator.
+//===----------------------------------------------------------------------===//
+// iree_hal_cuda_semaphore_state_t
+//===----------------------------------------------------------------------===//
+
+// State shared between all semaphores created from a device.
+// Owned by the device and guaranteed to remain valid for the lifetime of any
+// semaphore created from it.
+typedef struct iree_hal_cuda_semaphore_state_t {
+  // In-process notification signaled when any semaphore value changes.
+  iree_notification_t notification;
+} iree_hal_cuda_semaphore_state_t;
+
+// Initializes state used to perform semaphore synchronization.
+void iree_hal_cuda_semaphore_state_initialize(
+    iree_hal_cuda_semaphore_state_t* out_shared_state);
+
+// Deinitializes state used to perform semaphore synchronization; no semaphores
+// must be live with references.
+void iree_hal_cuda_semaphore_state_deinitialize(
+    iree_hal_cuda_semaphore_state_t* shared_state);
+
+//===----------------------------------------------------------------------===//
+// iree_hal_cuda_semaphore_t
+//===----------------------------------------------------------------------===//
+
+// Creates a timeline semaphore whose payload lives on the host.
+// Device work signals the semaphore from a host function enqueued on a stream
+// after the work completes. Waits from device streams are ordered on the
+// device when the signal has already been enqueued on any stream of the same
+// context and otherwise performed by the host.
 iree_status_t iree_hal_cuda_semaphore_create(
-    iree_hal_cuda_context_wrapper_t* context, uint64_t initial_value,
+    iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_semaphore_state_t* shared_state, uint64_t initial_value,
     iree_hal_semaphore_t** out_semaphore);
 
+// Returns true if |semaphore| is a CUDA semaphore.
+bool iree_hal_cuda_semaphore_isa(iree_hal_semaphore_t* semaphore);
+
+// Records that a signal of |semaphore| to |value| has been enqueued on
+// |stream|. Work enqueued afterward on any stream that waits for |value| or
+// earlier can be ordered after the signal without waiting on the host.
+iree_status_t iree_hal_cuda_semaphore_enqueue_signal(
+    iree_hal_semaphore_t* semaphore, CUstream stream, uint64_t value);
+
+// Orders work enqueued on |stream| after |semaphore| reaches |value|, if
+// possible without involving the host. |out_is_ordered| is set to true if the
+// semaphore has already reached |value| or the signal has been enqueued such
+// that stream order or a stream wait on an event covers it. Callers must wait
+// on the host when |out_is_ordered| is false.
+iree_status_t iree_hal_cuda_semaphore_enqueue_wait(
+    iree_hal_semaphore_t* semaphore, CUstream stream, uint64_t value,
+    bool* out_is_ordered);
+
+// Performs a signal of a list of semaphores.
+// The semaphores will transition to their new values (nearly) atomically and
+// batching up signals will reduce synchronization overhead.
+//
+// Safe to call from CUDA host functions as no CUDA APIs are used.
+iree_status_t iree_hal_cuda_semaphore_multi_signal(
+    iree_hal_cuda_semaphore_state_t* shared_state,
+    const iree_hal_semaphore_list_t* semaphore_list);
+
+// Performs a multi-wait on one or more semaphores.
+// Returns IREE_STATUS_DEADLINE_EXCEEDED if the wait does not complete before
+// |timeout| elapses and IREE_STATUS_ABORTED if any semaphore has failed.
+iree_status_t iree_hal_cuda_semaphore_multi_wait(
+    iree_hal_cuda_semaphore_state_t* shared_state,
+    iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
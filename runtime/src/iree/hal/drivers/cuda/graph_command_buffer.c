@@ -13,15 +13,30 @@
 #include "iree/base/api.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/cuda/cuda_buffer.h"
+#include "iree/hal/drivers/cuda/cuda_profiler.h"
 #include "iree/hal/drivers/cuda/dynamic_symbols.h"
 #include "iree/hal/drivers/cuda/executable_layout.h"
+#include "iree/hal/drivers/cuda/graph_exec_cache.h"
 #include "iree/hal/drivers/cuda/native_executable.h"
 #include "iree/hal/drivers/cuda/status_util.h"
 #include "iree/hal/utils/resource_set.h"
 
 #define IREE_HAL_CUDA_MAX_BINDING_COUNT 64
-// Kernel arguments contains binding and push constants.
-#define IREE_HAL_CUDA_MAX_KERNEL_ARG 128
+// Maximum number of nodes tracked in a single concurrency region before they
+// are joined into an empty node. Joining does not change execution order but
+// bounds the storage required and the edge count of the following barrier.
+#define IREE_HAL_CUDA_MAX_CONCURRENT_GRAPH_NODE_COUNT 32
+
+// A dispatch recorded with dispatch profiling enabled.
+typedef struct iree_hal_cuda_graph_profiled_dispatch_t {
+  // Retained by the command buffer resource set.
+  iree_hal_executable_t* executable;
+  int32_t entry_point;
+  uint32_t workgroup_count[3];
+  // Event record nodes immediately preceding and following the kernel node.
+  CUgraphNode start_node;
+  CUgraphNode end_node;
+} iree_hal_cuda_graph_profiled_dispatch_t;
 
 // Command buffer implementation that directly maps to cuda graph.
 // This records the commands on the calling thread without additional threading
@@ -42,12 +57,40 @@ typedef struct iree_hal_cuda_graph_command_buffer_t {
   CUgraph graph;
   CUgraphExec exec;
 
-  // Keep track of the last node added to the command buffer as we are currently
-  // serializing all the nodes (each node depends on the previous one).
-  CUgraphNode last_node;
+  // Optional cache used to reuse instantiations of previously recorded graphs
+  // with the same topology. The exec is returned to the cache on destruction.
+  iree_hal_cuda_graph_exec_cache_t* exec_cache;
+
+  // Running hash of the structure of the recorded graph: the node types and
+  // the properties of each node that cuGraphExecUpdate cannot change. Buffer
+  // pointers, sizes, and kernel parameters are excluded.
+  uint64_t topology_hash;
+
+  // Node all nodes in the current concurrency region depend on: the last node
+  // of the region preceding the most recent execution barrier or NULL if no
+  // barrier with prior work has been recorded.
+  CUgraphNode barrier_node;
+  // Nodes added since the most recent execution barrier. These have no edges
+  // between each other and may execute concurrently.
+  iree_host_size_t region_node_count;
+  CUgraphNode region_nodes[IREE_HAL_CUDA_MAX_CONCURRENT_GRAPH_NODE_COUNT];
+
+  // True if dispatches are bracketed by event record nodes. The graph is
+  // retained after instantiation as updating the events of the instantiation
+  // requires the nodes of the graph it was instantiated from.
+  bool profile_dispatches;
+  // Event recorded by all event record nodes when not profiling.
+  CUevent placeholder_event;
+  // True if the event record nodes of the instantiation reference profiler
+  // events that must be reset before launching without the profiler.
+  bool exec_has_profiler_events;
+  iree_host_size_t profiled_dispatch_count;
+  iree_host_size_t profiled_dispatch_capacity;
+  iree_hal_cuda_graph_profiled_dispatch_t* profiled_dispatches;
+
   int32_t push_constant[IREE_HAL_CUDA_MAX_PUSH_CONSTANT_COUNT];
-  // Keep track of the current set of kernel arguments.
-  void* current_descriptor[];
+  // Keep track of the current set of bound buffers in kernel argument order.
+  CUdeviceptr bindings[IREE_HAL_CUDA_MAX_KERNEL_ARG];
 } iree_hal_cuda_graph_command_buffer_t;
 
 static const iree_hal_command_buffer_vtable_t
@@ -65,6 +108,8 @@ iree_status_t iree_hal_cuda_graph_command_buffer_create(
     iree_hal_command_category_t command_categories,
     iree_hal_queue_affinity_t queue_affinity,
     iree_arena_block_pool_t* block_pool,
+    iree_hal_cuda_graph_exec_cache_t* exec_cache,
+    bool enable_dispatch_profiling,
     iree_hal_command_buffer_t** out_command_buffer) {
   IREE_ASSERT_ARGUMENT(context);
   IREE_ASSERT_ARGUMENT(block_pool);
@@ -72,31 +117,47 @@ iree_status_t iree_hal_cuda_graph_command_buffer_create(
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_cuda_graph_command_buffer_t* command_buffer = NULL;
-  size_t total_size = sizeof(*command_buffer) +
-                      IREE_HAL_CUDA_MAX_KERNEL_ARG * sizeof(void*) +
-                      IREE_HAL_CUDA_MAX_KERNEL_ARG * sizeof(CUdeviceptr);
-  iree_status_t status = iree_allocator_malloc(
-      context->host_allocator, total_size, (void**)&command_buffer);
+  iree_status_t status =
+      iree_allocator_malloc(context->host_allocator, sizeof(*command_buffer),
+                            (void**)&command_buffer);
   if (iree_status_is_ok(status)) {
     iree_hal_command_buffer_initialize(
         device, mode, command_categories, queue_affinity,
-        &iree_hal_cuda_graph_command_buffer_vtable, &command_buffer->base);
+        /*binding_capacity=*/0, &iree_hal_cuda_graph_command_buffer_vtable,
+        &command_buffer->base);
     command_buffer->context = context;
     iree_arena_initialize(block_pool, &command_buffer->arena);
     command_buffer->graph = NULL;
     command_buffer->exec = NULL;
-    command_buffer->last_node = NULL;
-
-    CUdeviceptr* device_ptrs =
-        (CUdeviceptr*)(command_buffer->current_descriptor +
-                       IREE_HAL_CUDA_MAX_KERNEL_ARG);
-    for (size_t i = 0; i < IREE_HAL_CUDA_MAX_KERNEL_ARG; i++) {
-      command_buffer->current_descriptor[i] = &device_ptrs[i];
+    command_buffer->exec_cache = exec_cache;
+    command_buffer->topology_hash = 0;
+    command_buffer->barrier_node = NULL;
+    command_buffer->region_node_count = 0;
+    // Event record nodes are unavailable on older drivers in which case the
+    // command buffer is recorded without profiling.
+    command_buffer->profile_dispatches =
+        enable_dispatch_profiling &&
+        context->syms->cuGraphAddEventRecordNode &&
+        context->syms->cuGraphExecEventRecordNodeSetEvent;
+    command_buffer->placeholder_event = NULL;
+    command_buffer->exec_has_profiler_events = false;
+    command_buffer->profiled_dispatch_count = 0;
+    command_buffer->profiled_dispatch_capacity = 0;
+    command_buffer->profiled_dispatches = NULL;
+    if (command_buffer->profile_dispatches) {
+      command_buffer->exec_cache = NULL;
     }
 
     status = iree_hal_resource_set_allocate(block_pool,
                                             &command_buffer->resource_set);
   }
+  if (iree_status_is_ok(status) && command_buffer->profile_dispatches) {
+    status = CU_RESULT_TO_STATUS(
+        context->syms,
+        cuEventCreate(&command_buffer->placeholder_event,
+                      CU_EVENT_DISABLE_TIMING),
+        "cuEventCreate");
+  }
 
   if (iree_status_is_ok(status)) {
     *out_command_buffer = &command_buffer->base;
@@ -119,11 +180,24 @@ static void iree_hal_cuda_graph_command_buffer_destroy(
     command_buffer->graph = NULL;
   }
   if (command_buffer->exec != NULL) {
-    CUDA_IGNORE_ERROR(command_buffer->context->syms,
-                      cuGraphExecDestroy(command_buffer->exec));
+    if (command_buffer->exec_cache) {
+      iree_hal_cuda_graph_exec_cache_release(command_buffer->exec_cache,
+                                             command_buffer->topology_hash,
+                                             command_buffer->exec);
+    } else {
+      CUDA_IGNORE_ERROR(command_buffer->context->syms,
+                        cuGraphExecDestroy(command_buffer->exec));
+    }
     command_buffer->exec = NULL;
   }
-  command_buffer->last_node = NULL;
+  command_buffer->barrier_node = NULL;
+  command_buffer->region_node_count = 0;
+  if (command_buffer->placeholder_event) {
+    CUDA_IGNORE_ERROR(command_buffer->context->syms,
+                      cuEventDestroy(command_buffer->placeholder_event));
+  }
+  iree_allocator_free(command_buffer->context->host_allocator,
+                      command_buffer->profiled_dispatches);
 
   iree_hal_resource_set_free(command_buffer->resource_set);
   iree_arena_deinitialize(&command_buffer->arena);
@@ -139,6 +213,104 @@ CUgraphExec iree_hal_cuda_graph_command_buffer_handle(
   return command_buffer->exec;
 }
 
+// Offset basis and prime of the 64-bit FNV-1a hash.
+#define IREE_HAL_CUDA_TOPOLOGY_HASH_BASIS 0xCBF29CE484222325ull
+#define IREE_HAL_CUDA_TOPOLOGY_HASH_PRIME 0x00000100000001B3ull
+
+// Kinds of nodes recorded into the graph.
+typedef enum iree_hal_cuda_graph_node_kind_e {
+  IREE_HAL_CUDA_GRAPH_NODE_KIND_MEMSET = 1,
+  IREE_HAL_CUDA_GRAPH_NODE_KIND_MEMCPY = 2,
+  IREE_HAL_CUDA_GRAPH_NODE_KIND_KERNEL = 3,
+  // An empty node joining all nodes of a full concurrency region.
+  IREE_HAL_CUDA_GRAPH_NODE_KIND_JOIN = 4,
+  // An execution barrier ending a non-empty concurrency region.
+  IREE_HAL_CUDA_GRAPH_NODE_KIND_BARRIER = 5,
+  // An event record node bracketing a profiled dispatch.
+  IREE_HAL_CUDA_GRAPH_NODE_KIND_EVENT_RECORD = 6,
+} iree_hal_cuda_graph_node_kind_t;
+
+// Mixes a node of |kind| with |data_length| bytes of identifying |data| into
+// the topology hash of |command_buffer|. Edges are derived only from the order
+// of nodes and barriers so hashing barriers as pseudo-nodes captures them.
+static void iree_hal_cuda_graph_command_buffer_hash_node(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer,
+    iree_hal_cuda_graph_node_kind_t kind, const void* data,
+    iree_host_size_t data_length) {
+  uint64_t hash = command_buffer->topology_hash;
+  hash = (hash ^ (uint64_t)kind) * IREE_HAL_CUDA_TOPOLOGY_HASH_PRIME;
+  const uint8_t* bytes = (const uint8_t*)data;
+  for (iree_host_size_t i = 0; i < data_length; ++i) {
+    hash = (hash ^ bytes[i]) * IREE_HAL_CUDA_TOPOLOGY_HASH_PRIME;
+  }
+  command_buffer->topology_hash = hash;
+}
+
+// Joins |node_count| |nodes| into a single empty node; if only one node is
+// given it is returned directly.
+static iree_status_t iree_hal_cuda_graph_command_buffer_join_nodes(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer,
+    iree_host_size_t node_count, const CUgraphNode* nodes,
+    CUgraphNode* out_node) {
+  if (node_count == 1) {
+    *out_node = nodes[0];
+    return iree_ok_status();
+  }
+  return CU_RESULT_TO_STATUS(
+      command_buffer->context->syms,
+      cuGraphAddEmptyNode(out_node, command_buffer->graph, nodes, node_count),
+      "cuGraphAddEmptyNode");
+}
+
+// Ensures there is room in the current concurrency region for another node.
+// Full regions are joined into a single node that stands in for all of them.
+static iree_status_t iree_hal_cuda_graph_command_buffer_reserve_node(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer) {
+  if (command_buffer->region_node_count <
+      IREE_ARRAYSIZE(command_buffer->region_nodes)) {
+    return iree_ok_status();
+  }
+  CUgraphNode join_node = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_cuda_graph_command_buffer_join_nodes(
+      command_buffer, command_buffer->region_node_count,
+      command_buffer->region_nodes, &join_node));
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_JOIN, NULL, 0);
+  command_buffer->region_nodes[0] = join_node;
+  command_buffer->region_node_count = 1;
+  return iree_ok_status();
+}
+
+// Returns the number of dependencies (0 or 1) that new nodes in the current
+// concurrency region must have on |command_buffer|->barrier_node.
+static size_t iree_hal_cuda_graph_command_buffer_dependency_count(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer) {
+  return command_buffer->barrier_node ? 1 : 0;
+}
+
+// Appends |node| to the current concurrency region. Space must have been
+// reserved with iree_hal_cuda_graph_command_buffer_reserve_node.
+static void iree_hal_cuda_graph_command_buffer_append_node(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer, CUgraphNode node) {
+  command_buffer->region_nodes[command_buffer->region_node_count++] = node;
+}
+
+// Ends the current concurrency region such that all nodes added afterward
+// depend on all nodes added before. No-op if the region is empty.
+static iree_status_t iree_hal_cuda_graph_command_buffer_end_region(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer) {
+  if (command_buffer->region_node_count == 0) return iree_ok_status();
+  const uint64_t node_count = command_buffer->region_node_count;
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_BARRIER, &node_count,
+      sizeof(node_count));
+  IREE_RETURN_IF_ERROR(iree_hal_cuda_graph_command_buffer_join_nodes(
+      command_buffer, command_buffer->region_node_count,
+      command_buffer->region_nodes, &command_buffer->barrier_node));
+  command_buffer->region_node_count = 0;
+  return iree_ok_status();
+}
+
 bool iree_hal_cuda_graph_command_buffer_isa(
     iree_hal_command_buffer_t* command_buffer) {
   return iree_hal_command_buffer_dyn_cast(
@@ -169,6 +341,7 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_begin(
   CUDA_RETURN_IF_ERROR(command_buffer->context->syms,
                        cuGraphCreate(&command_buffer->graph, /*flags=*/0),
                        "cuGraphCreate");
+  command_buffer->topology_hash = IREE_HAL_CUDA_TOPOLOGY_HASH_BASIS;
 
   return iree_ok_status();
 }
@@ -178,25 +351,35 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_end(
   iree_hal_cuda_graph_command_buffer_t* command_buffer =
       iree_hal_cuda_graph_command_buffer_cast(base_command_buffer);
 
-  // Reset state used during recording.
-  command_buffer->last_node = NULL;
-
-  // Compile the graph.
-  CUgraphNode error_node = NULL;
-  iree_status_t status =
-      CU_RESULT_TO_STATUS(command_buffer->context->syms,
-                          cuGraphInstantiate(&command_buffer->exec,
-                                             command_buffer->graph, &error_node,
-                                             /*logBuffer=*/NULL,
-                                             /*bufferSize=*/0));
-  if (iree_status_is_ok(status)) {
+  // Reset state used during recording. Nodes of the final region need no join
+  // as the graph completes only once all of its nodes have.
+  command_buffer->barrier_node = NULL;
+  command_buffer->region_node_count = 0;
+
+  // Compile the graph, reusing a cached instantiation of the same topology if
+  // possible.
+  iree_status_t status = iree_ok_status();
+  if (command_buffer->exec_cache) {
+    status = iree_hal_cuda_graph_exec_cache_instantiate(
+        command_buffer->exec_cache, command_buffer->graph,
+        command_buffer->topology_hash, &command_buffer->exec);
+  } else {
+    CUgraphNode error_node = NULL;
+    status = CU_RESULT_TO_STATUS(
+        command_buffer->context->syms,
+        cuGraphInstantiate(&command_buffer->exec, command_buffer->graph,
+                           &error_node,
+                           /*logBuffer=*/NULL,
+                           /*bufferSize=*/0));
+  }
+  if (iree_status_is_ok(status) && !command_buffer->profile_dispatches) {
     // No longer need the source graph used for construction.
     CUDA_IGNORE_ERROR(command_buffer->context->syms,
                       cuGraphDestroy(command_buffer->graph));
     command_buffer->graph = NULL;
   }
 
-  return iree_ok_status();
+  return status;
 }
 
 static void iree_hal_cuda_graph_command_buffer_begin_debug_group(
@@ -220,24 +403,24 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_execution_barrier(
     const iree_hal_memory_barrier_t* memory_barriers,
     iree_host_size_t buffer_barrier_count,
     const iree_hal_buffer_barrier_t* buffer_barriers) {
-  // TODO: Implement barrier with Graph edges. Right now all the nodes are
-  // serialized.
-  return iree_ok_status();
+  iree_hal_cuda_graph_command_buffer_t* command_buffer =
+      iree_hal_cuda_graph_command_buffer_cast(base_command_buffer);
+  // Graph edges order whole nodes so all barriers are full execution
+  // barriers; the compiler only emits them between dependent regions.
+  return iree_hal_cuda_graph_command_buffer_end_region(command_buffer);
 }
 
 static iree_status_t iree_hal_cuda_graph_command_buffer_signal_event(
     iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
     iree_hal_execution_stage_t source_stage_mask) {
-  // TODO: Implement barrier with Graph edges. Right now all the nodes are
-  // serialized.
+  // Waits are recorded as full barriers so signals need no graph nodes.
   return iree_ok_status();
 }
 
 static iree_status_t iree_hal_cuda_graph_command_buffer_reset_event(
     iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
     iree_hal_execution_stage_t source_stage_mask) {
-  // TODO: Implement barrier with Graph edges. Right now all the nodes are
-  // serialized.
+  // Waits are recorded as full barriers so signals need no graph nodes.
   return iree_ok_status();
 }
 
@@ -250,9 +433,11 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_wait_events(
     const iree_hal_memory_barrier_t* memory_barriers,
     iree_host_size_t buffer_barrier_count,
     const iree_hal_buffer_barrier_t* buffer_barriers) {
-  // TODO: Implement barrier with Graph edges. Right now all the nodes are
-  // serialized.
-  return iree_ok_status();
+  iree_hal_cuda_graph_command_buffer_t* command_buffer =
+      iree_hal_cuda_graph_command_buffer_cast(base_command_buffer);
+  // TODO: track the nodes preceding each signal to only order after those.
+  // For now a wait orders after all prior work which is conservative.
+  return iree_hal_cuda_graph_command_buffer_end_region(command_buffer);
 }
 
 static iree_status_t iree_hal_cuda_graph_command_buffer_discard_buffer(
@@ -307,15 +492,22 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_fill_buffer(
       .height = 1,
       .value = dword_pattern,
   };
-  // Serialize all the nodes for now.
-  CUgraphNode dep[] = {command_buffer->last_node};
-  size_t numNode = command_buffer->last_node ? 1 : 0;
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_MEMSET,
+      &params.elementSize, sizeof(params.elementSize));
+  // Nodes in the same concurrency region may execute concurrently.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_cuda_graph_command_buffer_reserve_node(command_buffer));
+  CUgraphNode node = NULL;
+  const size_t dependency_count =
+      iree_hal_cuda_graph_command_buffer_dependency_count(command_buffer);
   CUDA_RETURN_IF_ERROR(
       command_buffer->context->syms,
-      cuGraphAddMemsetNode(&command_buffer->last_node, command_buffer->graph,
-                           dep, numNode, &params,
-                           command_buffer->context->cu_context),
+      cuGraphAddMemsetNode(&node, command_buffer->graph,
+                           &command_buffer->barrier_node, dependency_count,
+                           &params, command_buffer->context->cu_context),
       "cuGraphAddMemsetNode");
+  iree_hal_cuda_graph_command_buffer_append_node(command_buffer, node);
   return iree_ok_status();
 }
 
@@ -352,15 +544,24 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_update_buffer(
       .Height = 1,
       .Depth = 1,
   };
-  // Serialize all the nodes for now.
-  CUgraphNode dep[] = {command_buffer->last_node};
-  size_t numNode = command_buffer->last_node ? 1 : 0;
+  const CUmemorytype memory_types[2] = {params.srcMemoryType,
+                                       params.dstMemoryType};
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_MEMCPY, memory_types,
+      sizeof(memory_types));
+  // Nodes in the same concurrency region may execute concurrently.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_cuda_graph_command_buffer_reserve_node(command_buffer));
+  CUgraphNode node = NULL;
+  const size_t dependency_count =
+      iree_hal_cuda_graph_command_buffer_dependency_count(command_buffer);
   CUDA_RETURN_IF_ERROR(
       command_buffer->context->syms,
-      cuGraphAddMemcpyNode(&command_buffer->last_node, command_buffer->graph,
-                           dep, numNode, &params,
-                           command_buffer->context->cu_context),
+      cuGraphAddMemcpyNode(&node, command_buffer->graph,
+                           &command_buffer->barrier_node, dependency_count,
+                           &params, command_buffer->context->cu_context),
       "cuGraphAddMemcpyNode");
+  iree_hal_cuda_graph_command_buffer_append_node(command_buffer, node);
   return iree_ok_status();
 }
 
@@ -393,15 +594,24 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_copy_buffer(
       .Height = 1,
       .Depth = 1,
   };
-  // Serialize all the nodes for now.
-  CUgraphNode dep[] = {command_buffer->last_node};
-  size_t numNode = command_buffer->last_node ? 1 : 0;
+  const CUmemorytype memory_types[2] = {params.srcMemoryType,
+                                       params.dstMemoryType};
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_MEMCPY, memory_types,
+      sizeof(memory_types));
+  // Nodes in the same concurrency region may execute concurrently.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_cuda_graph_command_buffer_reserve_node(command_buffer));
+  CUgraphNode node = NULL;
+  const size_t dependency_count =
+      iree_hal_cuda_graph_command_buffer_dependency_count(command_buffer);
   CUDA_RETURN_IF_ERROR(
       command_buffer->context->syms,
-      cuGraphAddMemcpyNode(&command_buffer->last_node, command_buffer->graph,
-                           dep, numNode, &params,
-                           command_buffer->context->cu_context),
+      cuGraphAddMemcpyNode(&node, command_buffer->graph,
+                           &command_buffer->barrier_node, dependency_count,
+                           &params, command_buffer->context->cu_context),
       "cuGraphAddMemcpyNode");
+  iree_hal_cuda_graph_command_buffer_append_node(command_buffer, node);
   return iree_ok_status();
 }
 
@@ -464,8 +674,7 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_push_descriptor_set(
         iree_hal_cuda_buffer_device_pointer(
             iree_hal_buffer_allocated_buffer(binding->buffer)) +
         iree_hal_buffer_byte_offset(binding->buffer) + binding->offset;
-    *((CUdeviceptr*)command_buffer->current_descriptor[i + base_binding]) =
-        device_ptr;
+    command_buffer->bindings[i + base_binding] = device_ptr;
     IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
         command_buffer->resource_set, 1, &binding->buffer));
   }
@@ -482,6 +691,67 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_bind_descriptor_set(
                           "need cuda implementation");
 }
 
+// Adds a kernel node with |params| bracketed by event record nodes to the
+// current concurrency region. The event record nodes initially record the
+// placeholder event and are updated with profiler events on launch. Space
+// must have been reserved with iree_hal_cuda_graph_command_buffer_reserve_node.
+static iree_status_t
+iree_hal_cuda_graph_command_buffer_add_profiled_kernel_node(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    const CUDA_KERNEL_NODE_PARAMS* params) {
+  if (command_buffer->profiled_dispatch_count ==
+      command_buffer->profiled_dispatch_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(16, command_buffer->profiled_dispatch_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        command_buffer->context->host_allocator,
+        new_capacity * sizeof(*command_buffer->profiled_dispatches),
+        (void**)&command_buffer->profiled_dispatches));
+    command_buffer->profiled_dispatch_capacity = new_capacity;
+  }
+  iree_hal_cuda_graph_profiled_dispatch_t* dispatch =
+      &command_buffer->profiled_dispatches[command_buffer
+                                               ->profiled_dispatch_count];
+  dispatch->executable = executable;
+  dispatch->entry_point = entry_point;
+  dispatch->workgroup_count[0] = params->gridDimX;
+  dispatch->workgroup_count[1] = params->gridDimY;
+  dispatch->workgroup_count[2] = params->gridDimZ;
+
+  // start -> kernel -> end; only the end node joins the region.
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_EVENT_RECORD, NULL, 0);
+  const size_t dependency_count =
+      iree_hal_cuda_graph_command_buffer_dependency_count(command_buffer);
+  CUDA_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      cuGraphAddEventRecordNode(&dispatch->start_node, command_buffer->graph,
+                                &command_buffer->barrier_node,
+                                dependency_count,
+                                command_buffer->placeholder_event),
+      "cuGraphAddEventRecordNode");
+  CUgraphNode kernel_node = NULL;
+  CUDA_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      cuGraphAddKernelNode(&kernel_node, command_buffer->graph,
+                           &dispatch->start_node, 1, params),
+      "cuGraphAddKernelNode");
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_EVENT_RECORD, NULL, 0);
+  CUDA_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      cuGraphAddEventRecordNode(&dispatch->end_node, command_buffer->graph,
+                                &kernel_node, 1,
+                                command_buffer->placeholder_event),
+      "cuGraphAddEventRecordNode");
+
+  ++command_buffer->profiled_dispatch_count;
+  iree_hal_cuda_graph_command_buffer_append_node(command_buffer,
+                                                 dispatch->end_node);
+  return iree_ok_status();
+}
+
 static iree_status_t iree_hal_cuda_graph_command_buffer_dispatch(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_hal_executable_t* executable, int32_t entry_point,
@@ -490,43 +760,53 @@ static iree_status_t iree_hal_cuda_graph_command_buffer_dispatch(
       iree_hal_cuda_graph_command_buffer_cast(base_command_buffer);
   IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
       command_buffer->resource_set, 1, &executable));
-  iree_hal_executable_layout_t* layout =
-      iree_hal_cuda_executable_get_layout(executable, entry_point);
-  iree_host_size_t num_constants =
-      iree_hal_cuda_executable_layout_num_constants(layout);
-  iree_host_size_t constant_base_index =
-      iree_hal_cuda_push_constant_index(layout);
-  // Patch the push constants in the kernel arguments.
-  for (iree_host_size_t i = 0; i < num_constants; i++) {
-    *((uint32_t*)command_buffer->current_descriptor[i + constant_base_index]) =
-        command_buffer->push_constant[i];
-  }
-  int32_t block_size_x, block_size_y, block_size_z;
-  int32_t shared_memory_size;
-  IREE_RETURN_IF_ERROR(iree_hal_cuda_native_executable_block_size(
-      executable, entry_point, &block_size_x, &block_size_y, &block_size_z));
-  IREE_RETURN_IF_ERROR(iree_hal_cuda_native_executable_shared_memory_size(
-      executable, entry_point, &shared_memory_size));
+  const iree_hal_cuda_kernel_params_t* kernel_params =
+      iree_hal_cuda_native_executable_kernel_params(executable, entry_point);
+
+  // Pack the bindings and push constants into a single parameter block; the
+  // driver copies it into the node so it can live on the stack.
+  uint8_t param_buffer[IREE_HAL_CUDA_MAX_KERNEL_PARAM_BUFFER_SIZE];
+  iree_hal_cuda_kernel_params_pack(kernel_params, command_buffer->bindings,
+                                   command_buffer->push_constant, param_buffer);
+  size_t param_buffer_size = kernel_params->param_buffer_size;
+  void* extra[] = {
+      CU_LAUNCH_PARAM_BUFFER_POINTER, param_buffer,
+      CU_LAUNCH_PARAM_BUFFER_SIZE,    &param_buffer_size,
+      CU_LAUNCH_PARAM_END,
+  };
   CUDA_KERNEL_NODE_PARAMS params = {
-      .func = iree_hal_cuda_native_executable_for_entry_point(executable,
-                                                              entry_point),
-      .blockDimX = block_size_x,
-      .blockDimY = block_size_y,
-      .blockDimZ = block_size_z,
+      .func = kernel_params->function,
+      .blockDimX = kernel_params->block_size[0],
+      .blockDimY = kernel_params->block_size[1],
+      .blockDimZ = kernel_params->block_size[2],
       .gridDimX = workgroup_x,
       .gridDimY = workgroup_y,
       .gridDimZ = workgroup_z,
-      .kernelParams = command_buffer->current_descriptor,
-      .sharedMemBytes = shared_memory_size,
+      .kernelParams = NULL,
+      .extra = extra,
+      .sharedMemBytes = kernel_params->shared_memory_size,
   };
-  // Serialize all the nodes for now.
-  CUgraphNode dep[] = {command_buffer->last_node};
-  size_t numNodes = command_buffer->last_node ? 1 : 0;
+  // Kernel nodes cannot change their function when updated.
+  iree_hal_cuda_graph_command_buffer_hash_node(
+      command_buffer, IREE_HAL_CUDA_GRAPH_NODE_KIND_KERNEL, &params.func,
+      sizeof(params.func));
+  // Nodes in the same concurrency region may execute concurrently.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_cuda_graph_command_buffer_reserve_node(command_buffer));
+  if (command_buffer->profile_dispatches) {
+    return iree_hal_cuda_graph_command_buffer_add_profiled_kernel_node(
+        command_buffer, executable, entry_point, &params);
+  }
+  CUgraphNode node = NULL;
+  const size_t dependency_count =
+      iree_hal_cuda_graph_command_buffer_dependency_count(command_buffer);
   CUDA_RETURN_IF_ERROR(
       command_buffer->context->syms,
-      cuGraphAddKernelNode(&command_buffer->last_node, command_buffer->graph,
-                           dep, numNodes, &params),
+      cuGraphAddKernelNode(&node, command_buffer->graph,
+                           &command_buffer->barrier_node, dependency_count,
+                           &params),
       "cuGraphAddKernelNode");
+  iree_hal_cuda_graph_command_buffer_append_node(command_buffer, node);
   return iree_ok_status();
 }
 
@@ -548,6 +828,96 @@ CUgraphExec iree_hal_cuda_graph_command_buffer_exec(
   return command_buffer->exec;
 }
 
+// Sets the events recorded by the event record nodes of |dispatch| in the
+// instantiated graph.
+static iree_status_t iree_hal_cuda_graph_command_buffer_set_dispatch_events(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer,
+    const iree_hal_cuda_graph_profiled_dispatch_t* dispatch,
+    CUevent start_event, CUevent end_event) {
+  CUDA_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      cuGraphExecEventRecordNodeSetEvent(command_buffer->exec,
+                                         dispatch->start_node, start_event),
+      "cuGraphExecEventRecordNodeSetEvent");
+  CUDA_RETURN_IF_ERROR(
+      command_buffer->context->syms,
+      cuGraphExecEventRecordNodeSetEvent(command_buffer->exec,
+                                         dispatch->end_node, end_event),
+      "cuGraphExecEventRecordNodeSetEvent");
+  return iree_ok_status();
+}
+
+// Launches a graph recorded with dispatch profiling with all dispatches
+// appended to |profiler| or, if NULL, recording the placeholder event.
+static iree_status_t iree_hal_cuda_graph_command_buffer_launch_profiled(
+    iree_hal_cuda_graph_command_buffer_t* command_buffer, CUstream stream,
+    iree_hal_cuda_profiler_t* profiler) {
+  iree_hal_cuda_dynamic_symbols_t* syms = command_buffer->context->syms;
+  const iree_host_size_t dispatch_count =
+      command_buffer->profiled_dispatch_count;
+
+  // Profiler events are only valid for the lifetime of the capture so they
+  // are replaced before launching outside of it.
+  if (!profiler) {
+    for (iree_host_size_t i = 0; i < dispatch_count; ++i) {
+      IREE_RETURN_IF_ERROR(
+          iree_hal_cuda_graph_command_buffer_set_dispatch_events(
+              command_buffer, &command_buffer->profiled_dispatches[i],
+              command_buffer->placeholder_event,
+              command_buffer->placeholder_event));
+    }
+    command_buffer->exec_has_profiler_events = false;
+    return CU_RESULT_TO_STATUS(
+        syms, cuGraphLaunch(command_buffer->exec, stream), "cuGraphLaunch");
+  }
+
+  iree_hal_cuda_profiler_dispatch_t* dispatches = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      command_buffer->context->host_allocator,
+      dispatch_count * sizeof(*dispatches), (void**)&dispatches));
+  iree_host_size_t appended_count = 0;
+  iree_status_t status = iree_ok_status();
+  for (; appended_count < dispatch_count && iree_status_is_ok(status);
+       ++appended_count) {
+    const iree_hal_cuda_graph_profiled_dispatch_t* dispatch =
+        &command_buffer->profiled_dispatches[appended_count];
+    status = iree_hal_cuda_profiler_append_dispatch(
+        profiler, dispatch->executable, dispatch->entry_point,
+        dispatch->workgroup_count[0], dispatch->workgroup_count[1],
+        dispatch->workgroup_count[2], &dispatches[appended_count]);
+    if (!iree_status_is_ok(status)) break;
+    command_buffer->exec_has_profiler_events = true;
+    status = iree_hal_cuda_graph_command_buffer_set_dispatch_events(
+        command_buffer, dispatch, dispatches[appended_count].start_event,
+        dispatches[appended_count].end_event);
+  }
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(
+        syms, cuGraphLaunch(command_buffer->exec, stream), "cuGraphLaunch");
+  }
+  for (iree_host_size_t i = 0; i < appended_count; ++i) {
+    iree_hal_cuda_profiler_commit_dispatch(profiler, &dispatches[i],
+                                           iree_status_is_ok(status));
+  }
+  iree_allocator_free(command_buffer->context->host_allocator, dispatches);
+  return status;
+}
+
+iree_status_t iree_hal_cuda_graph_command_buffer_launch(
+    iree_hal_command_buffer_t* base_command_buffer, CUstream stream,
+    iree_hal_cuda_profiler_t* profiler) {
+  iree_hal_cuda_graph_command_buffer_t* command_buffer =
+      iree_hal_cuda_graph_command_buffer_cast(base_command_buffer);
+  if (command_buffer->profiled_dispatch_count > 0 &&
+      (profiler || command_buffer->exec_has_profiler_events)) {
+    return iree_hal_cuda_graph_command_buffer_launch_profiled(command_buffer,
+                                                              stream, profiler);
+  }
+  return CU_RESULT_TO_STATUS(command_buffer->context->syms,
+                             cuGraphLaunch(command_buffer->exec, stream),
+                             "cuGraphLaunch");
+}
+
 static const iree_hal_command_buffer_vtable_t
     iree_hal_cuda_graph_command_buffer_vtable = {
         .destroy = iree_hal_cuda_graph_command_buffer_destroy,
@@ -19,16 +19,30 @@ extern "C" {
 
 typedef struct iree_arena_block_pool_t iree_arena_block_pool_t;
 
+typedef struct iree_hal_cuda_graph_exec_cache_t
+    iree_hal_cuda_graph_exec_cache_t;
+typedef struct iree_hal_cuda_profiler_t iree_hal_cuda_profiler_t;
+
 // Creates a command buffer that records into a CUDA graph.
+// If |exec_cache| is provided the graph instantiation is taken from and
+// returned to the cache such that re-recording the same sequence of commands
+// avoids re-instantiating the graph.
+//
+// If |enable_dispatch_profiling| is set each dispatch is bracketed by event
+// record nodes whose events are provided by the profiler each time the graph
+// is launched with iree_hal_cuda_graph_command_buffer_launch. Profiled graphs
+// are not cached as their event nodes must be updated on each launch.
 //
-// NOTE: the |block_pool| must remain live for the lifetime of the command
-// buffers that use it.
+// NOTE: the |block_pool| and |exec_cache| must remain live for the lifetime of
+// the command buffers that use them.
 iree_status_t iree_hal_cuda_graph_command_buffer_create(
     iree_hal_device_t* device, iree_hal_cuda_context_wrapper_t* context,
     iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
     iree_hal_queue_affinity_t queue_affinity,
     iree_arena_block_pool_t* block_pool,
+    iree_hal_cuda_graph_exec_cache_t* exec_cache,
+    bool enable_dispatch_profiling,
     iree_hal_command_buffer_t** out_command_buffer);
 
 // Returns true if |command_buffer| is a CUDA graph-based command buffer.
@@ -39,6 +53,15 @@ bool iree_hal_cuda_graph_command_buffer_isa(
 CUgraphExec iree_hal_cuda_graph_command_buffer_exec(
     iree_hal_command_buffer_t* command_buffer);
 
+// Launches the graph of |command_buffer| on |stream|. If |profiler| is provided
+// and the command buffer was recorded with dispatch profiling the dispatches
+// of the launch are appended to the profiler capture.
+// Launches of the same command buffer must be externally synchronized when
+// profiling as the events of the instantiated graph are updated.
+iree_status_t iree_hal_cuda_graph_command_buffer_launch(
+    iree_hal_command_buffer_t* command_buffer, CUstream stream,
+    iree_hal_cuda_profiler_t* profiler);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
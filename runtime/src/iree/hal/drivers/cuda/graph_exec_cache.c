@@ -0,0 +1,156 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/cuda/graph_exec_cache.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/drivers/cuda/dynamic_symbols.h"
+#include "iree/hal/drivers/cuda/status_util.h"
+
+typedef struct iree_hal_cuda_graph_exec_cache_entry_t {
+  uint64_t topology_hash;
+  CUgraphExec exec;
+} iree_hal_cuda_graph_exec_cache_entry_t;
+
+struct iree_hal_cuda_graph_exec_cache_t {
+  iree_hal_cuda_context_wrapper_t* context;
+
+  // Guards |entries|.
+  iree_slim_mutex_t mutex;
+
+  // Idle instantiations ordered from least to most recently released.
+  iree_host_size_t entry_count;
+  iree_hal_cuda_graph_exec_cache_entry_t
+      entries[IREE_HAL_CUDA_GRAPH_EXEC_CACHE_CAPACITY];
+};
+
+iree_status_t iree_hal_cuda_graph_exec_cache_allocate(
+    iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_graph_exec_cache_t** out_cache) {
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(out_cache);
+  *out_cache = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_cuda_graph_exec_cache_t* cache = NULL;
+  iree_status_t status = iree_allocator_malloc(
+      context->host_allocator, sizeof(*cache), (void**)&cache);
+  if (iree_status_is_ok(status)) {
+    memset(cache, 0, sizeof(*cache));
+    cache->context = context;
+    iree_slim_mutex_initialize(&cache->mutex);
+    *out_cache = cache;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_hal_cuda_graph_exec_cache_free(
+    iree_hal_cuda_graph_exec_cache_t* cache) {
+  if (!cache) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_cuda_graph_exec_cache_trim(cache);
+  iree_slim_mutex_deinitialize(&cache->mutex);
+  iree_allocator_free(cache->context->host_allocator, cache);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Removes and returns the most recently released idle instantiation with
+// |topology_hash| or NULL if there is none.
+static CUgraphExec iree_hal_cuda_graph_exec_cache_take(
+    iree_hal_cuda_graph_exec_cache_t* cache, uint64_t topology_hash) {
+  CUgraphExec exec = NULL;
+  iree_slim_mutex_lock(&cache->mutex);
+  for (iree_host_size_t i = cache->entry_count; i > 0; --i) {
+    iree_hal_cuda_graph_exec_cache_entry_t* entry = &cache->entries[i - 1];
+    if (entry->topology_hash != topology_hash) continue;
+    exec = entry->exec;
+    memmove(entry, entry + 1,
+            (cache->entry_count - i) * sizeof(cache->entries[0]));
+    --cache->entry_count;
+    break;
+  }
+  iree_slim_mutex_unlock(&cache->mutex);
+  return exec;
+}
+
+iree_status_t iree_hal_cuda_graph_exec_cache_instantiate(
+    iree_hal_cuda_graph_exec_cache_t* cache, CUgraph graph,
+    uint64_t topology_hash, CUgraphExec* out_exec) {
+  IREE_ASSERT_ARGUMENT(cache);
+  IREE_ASSERT_ARGUMENT(out_exec);
+  *out_exec = NULL;
+  iree_hal_cuda_dynamic_symbols_t* syms = cache->context->syms;
+
+  // Try to patch an idle instantiation of the same topology in-place.
+  CUgraphExec exec = iree_hal_cuda_graph_exec_cache_take(cache, topology_hash);
+  if (exec) {
+    IREE_TRACE_ZONE_BEGIN_NAMED(z0, "iree_hal_cuda_graph_exec_cache_update");
+    CUgraphNode error_node = NULL;
+    CUgraphExecUpdateResult update_result = CU_GRAPH_EXEC_UPDATE_SUCCESS;
+    CUresult result =
+        syms->cuGraphExecUpdate(exec, graph, &error_node, &update_result);
+    IREE_TRACE_ZONE_END(z0);
+    if (result == CUDA_SUCCESS &&
+        update_result == CU_GRAPH_EXEC_UPDATE_SUCCESS) {
+      *out_exec = exec;
+      return iree_ok_status();
+    }
+    // The graphs differ in some way the update can't express (or the hashes
+    // collided); fall back to a full instantiation.
+    CUDA_IGNORE_ERROR(syms, cuGraphExecDestroy(exec));
+  }
+
+  IREE_TRACE_ZONE_BEGIN_NAMED(z0, "iree_hal_cuda_graph_exec_cache_instantiate");
+  CUgraphNode error_node = NULL;
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      syms, cuGraphInstantiate(out_exec, graph, &error_node,
+                               /*logBuffer=*/NULL,
+                               /*bufferSize=*/0),
+      "cuGraphInstantiate");
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_hal_cuda_graph_exec_cache_release(
+    iree_hal_cuda_graph_exec_cache_t* cache, uint64_t topology_hash,
+    CUgraphExec exec) {
+  IREE_ASSERT_ARGUMENT(cache);
+  if (!exec) return;
+  CUgraphExec evicted_exec = NULL;
+  iree_slim_mutex_lock(&cache->mutex);
+  if (cache->entry_count == IREE_ARRAYSIZE(cache->entries)) {
+    // Evict the least recently released instantiation.
+    evicted_exec = cache->entries[0].exec;
+    memmove(&cache->entries[0], &cache->entries[1],
+            (cache->entry_count - 1) * sizeof(cache->entries[0]));
+    --cache->entry_count;
+  }
+  cache->entries[cache->entry_count].topology_hash = topology_hash;
+  cache->entries[cache->entry_count].exec = exec;
+  ++cache->entry_count;
+  iree_slim_mutex_unlock(&cache->mutex);
+  if (evicted_exec) {
+    CUDA_IGNORE_ERROR(cache->context->syms, cuGraphExecDestroy(evicted_exec));
+  }
+}
+
+void iree_hal_cuda_graph_exec_cache_trim(
+    iree_hal_cuda_graph_exec_cache_t* cache) {
+  IREE_ASSERT_ARGUMENT(cache);
+  iree_slim_mutex_lock(&cache->mutex);
+  for (iree_host_size_t i = 0; i < cache->entry_count; ++i) {
+    CUDA_IGNORE_ERROR(cache->context->syms,
+                      cuGraphExecDestroy(cache->entries[i].exec));
+  }
+  cache->entry_count = 0;
+  iree_slim_mutex_unlock(&cache->mutex);
+}
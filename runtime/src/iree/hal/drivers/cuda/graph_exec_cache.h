@@ -0,0 +1,76 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_CUDA_GRAPH_EXEC_CACHE_H_
+#define IREE_HAL_DRIVERS_CUDA_GRAPH_EXEC_CACHE_H_
+
+#include <stdint.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/drivers/cuda/context_wrapper.h"
+#include "iree/hal/drivers/cuda/cuda_headers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Maximum number of idle graph instantiations retained by a cache.
+// Exceeding the capacity evicts the least recently released instantiation.
+#if !defined(IREE_HAL_CUDA_GRAPH_EXEC_CACHE_CAPACITY)
+#define IREE_HAL_CUDA_GRAPH_EXEC_CACHE_CAPACITY 32
+#endif  // !IREE_HAL_CUDA_GRAPH_EXEC_CACHE_CAPACITY
+
+// A cache of instantiated CUDA graphs keyed by a hash of their topology.
+//
+// Instantiating a graph with cuGraphInstantiate is expensive (hundreds of
+// microseconds for large graphs) while programs commonly record the same
+// sequence of operations over and over with only the buffer pointers and
+// kernel parameters changing. When a graph with a matching topology hash has
+// been instantiated before and has since been released its instantiation is
+// patched in-place with cuGraphExecUpdate instead. If the update is rejected
+// (such as on a hash collision) a new instantiation is made.
+//
+// Each instantiation is owned by at most one command buffer at a time: command
+// buffers acquire an instantiation when they end recording and release it back
+// to the cache when destroyed. Updates only apply to future launches so it is
+// safe to release an instantiation that is still in-flight.
+//
+// Thread-safe; multiple threads may instantiate and release concurrently.
+typedef struct iree_hal_cuda_graph_exec_cache_t
+    iree_hal_cuda_graph_exec_cache_t;
+
+// Allocates an empty graph instantiation cache for |context|.
+iree_status_t iree_hal_cuda_graph_exec_cache_allocate(
+    iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_graph_exec_cache_t** out_cache);
+
+// Frees |cache| and destroys all idle instantiations it retains.
+void iree_hal_cuda_graph_exec_cache_free(
+    iree_hal_cuda_graph_exec_cache_t* cache);
+
+// Returns an instantiation of |graph| in |out_exec|, reusing an idle cached
+// instantiation with the same |topology_hash| if one is available.
+// The caller owns the returned instantiation and must either return it with
+// iree_hal_cuda_graph_exec_cache_release or destroy it.
+iree_status_t iree_hal_cuda_graph_exec_cache_instantiate(
+    iree_hal_cuda_graph_exec_cache_t* cache, CUgraph graph,
+    uint64_t topology_hash, CUgraphExec* out_exec);
+
+// Returns |exec| instantiated from a graph with |topology_hash| to the cache
+// for reuse by later instantiations.
+void iree_hal_cuda_graph_exec_cache_release(
+    iree_hal_cuda_graph_exec_cache_t* cache, uint64_t topology_hash,
+    CUgraphExec exec);
+
+// Destroys all idle instantiations retained by |cache|.
+void iree_hal_cuda_graph_exec_cache_trim(
+    iree_hal_cuda_graph_exec_cache_t* cache);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_CUDA_GRAPH_EXEC_CACHE_H_
@@ -10,6 +10,7 @@
 
 #include "iree/base/api.h"
 #include "iree/base/tracing.h"
+#include "iree/hal/drivers/cuda/cubin_cache.h"
 #include "iree/hal/drivers/cuda/dynamic_symbols.h"
 #include "iree/hal/drivers/cuda/executable_layout.h"
 #include "iree/hal/drivers/cuda/status_util.h"
@@ -19,21 +20,13 @@
 #include "iree/schemas/cuda_executable_def_reader.h"
 #include "iree/schemas/cuda_executable_def_verifier.h"
 
-typedef struct iree_hal_cuda_native_executable_function_t {
-  CUfunction cu_function;
-  uint32_t block_size_x;
-  uint32_t block_size_y;
-  uint32_t block_size_z;
-  uint32_t shared_memory_size;
-} iree_hal_cuda_native_executable_function_t;
-
 typedef struct iree_hal_cuda_native_executable_t {
   iree_hal_resource_t resource;
   iree_hal_cuda_context_wrapper_t* context;
   iree_hal_executable_layout_t** executable_layouts;
   iree_host_size_t entry_count;
   CUmodule module;
-  iree_hal_cuda_native_executable_function_t entry_functions[];
+  iree_hal_cuda_kernel_params_t entry_functions[];
 } iree_hal_cuda_native_executable_t;
 
 static const iree_hal_executable_vtable_t
@@ -47,6 +40,7 @@ static iree_hal_cuda_native_executable_t* iree_hal_cuda_native_executable_cast(
 
 iree_status_t iree_hal_cuda_native_executable_create(
     iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_cubin_cache_t* cubin_cache,
     const iree_hal_executable_params_t* executable_params,
     iree_hal_executable_t** out_executable) {
   IREE_ASSERT_ARGUMENT(context);
@@ -73,7 +67,7 @@ iree_status_t iree_hal_cuda_native_executable_create(
   iree_host_size_t entry_count = flatbuffers_string_vec_len(entry_points_vec);
   iree_host_size_t total_size =
       sizeof(*executable) +
-      entry_count * sizeof(iree_hal_cuda_native_executable_function_t) +
+      entry_count * sizeof(iree_hal_cuda_kernel_params_t) +
       entry_count * sizeof(iree_hal_executable_layout_t*);
   iree_status_t status = iree_allocator_malloc(context->host_allocator,
                                                total_size, (void**)&executable);
@@ -86,11 +80,12 @@ iree_status_t iree_hal_cuda_native_executable_create(
 
     executable->executable_layouts =
         (void*)((char*)executable + sizeof(*executable) +
-                entry_count *
-                    sizeof(iree_hal_cuda_native_executable_function_t));
-    status = CU_RESULT_TO_STATUS(
-        context->syms, cuModuleLoadDataEx(&module, ptx_image, 0, NULL, NULL),
-        "cuModuleLoadDataEx");
+                entry_count * sizeof(iree_hal_cuda_kernel_params_t));
+    status = iree_hal_cuda_cubin_cache_load_module(
+        context, cubin_cache,
+        iree_make_string_view(ptx_image, flatbuffers_string_len(ptx_image)),
+        &module);
+    executable->module = module;
   }
 
   executable->entry_count = entry_count;
@@ -109,16 +104,30 @@ iree_status_t iree_hal_cuda_native_executable_create(
                                shared_memory_sizes[i]),
             "cuFuncSetAttribute");
       }
-      executable->entry_functions[i].cu_function = function;
-      executable->entry_functions[i].block_size_x = block_sizes_vec[i].x;
-      executable->entry_functions[i].block_size_y = block_sizes_vec[i].y;
-      executable->entry_functions[i].block_size_z = block_sizes_vec[i].z;
-      executable->entry_functions[i].shared_memory_size =
-          shared_memory_sizes[i];
-      executable->executable_layouts[i] =
+      iree_hal_executable_layout_t* layout =
           executable_params->executable_layouts[i];
-      iree_hal_executable_layout_retain(
-          executable_params->executable_layouts[i]);
+      iree_hal_cuda_kernel_params_t* kernel_params =
+          &executable->entry_functions[i];
+      kernel_params->function = function;
+      kernel_params->block_size[0] = block_sizes_vec[i].x;
+      kernel_params->block_size[1] = block_sizes_vec[i].y;
+      kernel_params->block_size[2] = block_sizes_vec[i].z;
+      kernel_params->shared_memory_size = shared_memory_sizes[i];
+      kernel_params->binding_count =
+          (uint32_t)iree_hal_cuda_push_constant_index(layout);
+      kernel_params->constant_count =
+          (uint32_t)iree_hal_cuda_executable_layout_num_constants(layout);
+      kernel_params->param_buffer_size =
+          kernel_params->binding_count * sizeof(CUdeviceptr) +
+          kernel_params->constant_count * sizeof(uint32_t);
+      executable->executable_layouts[i] = layout;
+      iree_hal_executable_layout_retain(layout);
+      if (kernel_params->binding_count > IREE_HAL_CUDA_MAX_KERNEL_ARG) {
+        status = iree_make_status(
+            IREE_STATUS_RESOURCE_EXHAUSTED,
+            "entry point %" PRIhsz " uses %u bindings; only %d are supported",
+            i, kernel_params->binding_count, IREE_HAL_CUDA_MAX_KERNEL_ARG);
+      }
     }
   }
 
@@ -142,37 +151,28 @@ static void iree_hal_cuda_native_executable_destroy(
   for (iree_host_size_t i = 0; i < executable->entry_count; ++i) {
     iree_hal_executable_layout_release(executable->executable_layouts[i]);
   }
+  if (executable->module) {
+    CUDA_IGNORE_ERROR(executable->context->syms,
+                      cuModuleUnload(executable->module));
+  }
   iree_allocator_free(host_allocator, executable);
 
   IREE_TRACE_ZONE_END(z0);
 }
 
-CUfunction iree_hal_cuda_native_executable_for_entry_point(
+const iree_hal_cuda_kernel_params_t*
+iree_hal_cuda_native_executable_kernel_params(
     iree_hal_executable_t* base_executable, int32_t entry_point) {
   iree_hal_cuda_native_executable_t* executable =
       iree_hal_cuda_native_executable_cast(base_executable);
-  return executable->entry_functions[entry_point].cu_function;
+  return &executable->entry_functions[entry_point];
 }
 
-iree_status_t iree_hal_cuda_native_executable_block_size(
-    iree_hal_executable_t* base_executable, int32_t entry_point, uint32_t* x,
-    uint32_t* y, uint32_t* z) {
-  iree_hal_cuda_native_executable_t* executable =
-      iree_hal_cuda_native_executable_cast(base_executable);
-  *x = executable->entry_functions[entry_point].block_size_x;
-  *y = executable->entry_functions[entry_point].block_size_y;
-  *z = executable->entry_functions[entry_point].block_size_z;
-  return iree_ok_status();
-}
-
-iree_status_t iree_hal_cuda_native_executable_shared_memory_size(
-    iree_hal_executable_t* base_executable, int32_t entry_point,
-    uint32_t* shared_memory_size) {
+iree_host_size_t iree_hal_cuda_native_executable_entry_count(
+    iree_hal_executable_t* base_executable) {
   iree_hal_cuda_native_executable_t* executable =
       iree_hal_cuda_native_executable_cast(base_executable);
-  *shared_memory_size =
-      executable->entry_functions[entry_point].shared_memory_size;
-  return iree_ok_status();
+  return executable->entry_count;
 }
 
 iree_hal_executable_layout_t* iree_hal_cuda_executable_get_layout(
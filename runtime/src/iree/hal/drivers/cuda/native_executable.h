@@ -8,36 +8,80 @@
 #define IREE_HAL_DRIVERS_CUDA_NATIVE_EXECUTABLE_H_
 
 #include <stdint.h>
+#include <string.h>
 
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
 #include "iree/hal/drivers/cuda/context_wrapper.h"
 #include "iree/hal/drivers/cuda/cuda_headers.h"
+#include "iree/hal/drivers/cuda/executable_layout.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif  // __cplusplus
 
+// Maximum number of buffer bindings passed to a kernel across all sets.
+#define IREE_HAL_CUDA_MAX_KERNEL_ARG 128
+
+// Maximum size in bytes of the packed kernel parameter block.
+#define IREE_HAL_CUDA_MAX_KERNEL_PARAM_BUFFER_SIZE         \
+  (IREE_HAL_CUDA_MAX_KERNEL_ARG * sizeof(CUdeviceptr) + \
+   IREE_HAL_CUDA_MAX_PUSH_CONSTANT_COUNT * sizeof(uint32_t))
+
+// Launch parameters of an entry point computed when the executable is loaded.
+//
+// By convention with the compiler kernels take one pointer argument per
+// binding of the executable layout (ordered by set and then binding) followed
+// by one i32 argument per push constant. Arguments are passed to the kernel as
+// a single packed parameter block (CU_LAUNCH_PARAM_BUFFER_POINTER) built with
+// iree_hal_cuda_kernel_params_pack.
+typedef struct iree_hal_cuda_kernel_params_t {
+  CUfunction function;
+  uint32_t block_size[3];
+  uint32_t shared_memory_size;
+  // Number of pointer arguments at the start of the parameter block.
+  uint32_t binding_count;
+  // Number of i32 arguments following the bindings.
+  uint32_t constant_count;
+  // Total size in bytes of the packed parameter block.
+  size_t param_buffer_size;
+} iree_hal_cuda_kernel_params_t;
+
+// Packs |bindings| and |constants| into |param_buffer| using the layout in
+// |kernel_params|. |param_buffer| must have at least
+// |kernel_params|->param_buffer_size bytes.
+static inline void iree_hal_cuda_kernel_params_pack(
+    const iree_hal_cuda_kernel_params_t* kernel_params,
+    const CUdeviceptr* bindings, const int32_t* constants,
+    uint8_t* param_buffer) {
+  const size_t bindings_size = kernel_params->binding_count * sizeof(*bindings);
+  memcpy(param_buffer, bindings, bindings_size);
+  memcpy(param_buffer + bindings_size, constants,
+         kernel_params->constant_count * sizeof(*constants));
+}
+
+typedef struct iree_hal_cuda_cubin_cache_t iree_hal_cuda_cubin_cache_t;
+
 // Creates an executable from a PTX module. The module may contain several
 // kernels that can be extracted along with the associated block size.
+// If |cubin_cache| is provided the compiled PTX is loaded from and stored in
+// the cache.
 iree_status_t iree_hal_cuda_native_executable_create(
     iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_cubin_cache_t* cubin_cache,
     const iree_hal_executable_params_t* executable_params,
     iree_hal_executable_t** out_executable);
 
-CUfunction iree_hal_cuda_native_executable_for_entry_point(
+// Returns the launch parameters of the given |entry_point| within the
+// executable. The returned pointer remains valid for the lifetime of the
+// executable.
+const iree_hal_cuda_kernel_params_t*
+iree_hal_cuda_native_executable_kernel_params(
     iree_hal_executable_t* executable, int32_t entry_point);
 
-// Return the block size of the given |entry_point| within the executable.
-iree_status_t iree_hal_cuda_native_executable_block_size(
-    iree_hal_executable_t* executable, int32_t entry_point, uint32_t* x,
-    uint32_t* y, uint32_t* z);
-
-// Return the shared memory size of the given |entry_point| within the
-// executable.
-iree_status_t iree_hal_cuda_native_executable_shared_memory_size(
-    iree_hal_executable_t* executable, int32_t entry_point,
-    uint32_t* shared_memory_size);
+// Returns the total number of entry points in the executable.
+iree_host_size_t iree_hal_cuda_native_executable_entry_count(
+    iree_hal_executable_t* executable);
 
 /// Return the layout associated with the entry point.
 iree_hal_executable_layout_t* iree_hal_cuda_executable_get_layout(
@@ -15,11 +15,15 @@
 extern "C" {
 #endif  // __cplusplus
 
-// Creates a no-op executable cache that does not cache at all.
+typedef struct iree_hal_cuda_cubin_cache_t iree_hal_cuda_cubin_cache_t;
+
+// Creates a no-op executable cache that does not cache executables in memory.
 // This is useful to isolate pipeline caching behavior and verify compilation
-// behavior.
+// behavior. Compiled modules are still persisted in the optional device-owned
+// |cubin_cache| which must remain valid for the lifetime of the cache.
 iree_status_t iree_hal_cuda_nop_executable_cache_create(
-    iree_hal_cuda_context_wrapper_t* context, iree_string_view_t identifier,
+    iree_hal_cuda_context_wrapper_t* context,
+    iree_hal_cuda_cubin_cache_t* cubin_cache, iree_string_view_t identifier,
     iree_hal_executable_cache_t** out_executable_cache);
 
 #ifdef __cplusplus
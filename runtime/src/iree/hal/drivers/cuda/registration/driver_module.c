@@ -26,6 +26,26 @@ IREE_FLAG(bool, cuda_allow_inline_execution, false,
 
 IREE_FLAG(int32_t, cuda_default_index, 0, "Index of the default CUDA device.");
 
+IREE_FLAG(int32_t, cuda_queue_count, 8,
+          "Number of queues (each backed by a CUDA stream) exposed on each "
+          "CUDA device.");
+
+IREE_FLAG(bool, cuda_async_allocations, false,
+          "Service queue-ordered allocations from stream-ordered CUDA memory "
+          "pools when supported by the device.");
+
+IREE_FLAG(int64_t, cuda_async_allocation_release_threshold, -1,
+          "Bytes of freed memory retained by the stream-ordered memory pool "
+          "for reuse; -1 retains all memory until the device is trimmed.");
+
+IREE_FLAG(int64_t, cuda_staging_ring_capacity, 16 * 1024 * 1024,
+          "Bytes of page-locked host memory used to stage transfers between "
+          "host and device memory; 0 disables staging.");
+
+IREE_FLAG(string, cuda_cubin_cache_path, "",
+          "Existing directory used to persist cubins compiled from executable "
+          "PTX across runs; empty disables the cache.");
+
 static iree_status_t iree_hal_cuda_driver_factory_enumerate(
     void* self, iree_host_size_t* out_driver_info_count,
     const iree_hal_driver_info_t** out_driver_infos) {
@@ -58,6 +78,17 @@ static iree_status_t iree_hal_cuda_driver_factory_try_create(
         IREE_HAL_CUDA_COMMAND_BUFFER_MODE_STREAM;
   }
   default_params.allow_inline_execution = FLAG_cuda_allow_inline_execution;
+  default_params.queue_count =
+      (iree_host_size_t)iree_max(0, FLAG_cuda_queue_count);
+  default_params.async_allocations = FLAG_cuda_async_allocations;
+  default_params.async_allocation_release_threshold =
+      FLAG_cuda_async_allocation_release_threshold < 0
+          ? UINT64_MAX
+          : (uint64_t)FLAG_cuda_async_allocation_release_threshold;
+  default_params.staging_ring_capacity =
+      (iree_host_size_t)iree_max(0, FLAG_cuda_staging_ring_capacity);
+  default_params.cubin_cache_path =
+      iree_make_cstring_view(FLAG_cuda_cubin_cache_path);
 
   iree_hal_cuda_driver_options_t driver_options;
   iree_hal_cuda_driver_options_initialize(&driver_options);
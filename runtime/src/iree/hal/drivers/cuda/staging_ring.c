@@ -0,0 +1,268 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/cuda/staging_ring.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/drivers/cuda/dynamic_symbols.h"
+#include "iree/hal/drivers/cuda/status_util.h"
+
+typedef struct iree_hal_cuda_staging_slot_t {
+  // Recorded on the copy stream after the last copy using the slot memory.
+  CUevent event;
+  // True if a copy using the slot memory may still be in-flight.
+  bool is_pending;
+  // Host memory the slot contents are copied into once the pending download
+  // completes or NULL if the pending copy is an upload.
+  void* readback_target;
+  iree_host_size_t readback_length;
+} iree_hal_cuda_staging_slot_t;
+
+struct iree_hal_cuda_staging_ring_t {
+  iree_hal_cuda_context_wrapper_t* context;
+
+  // Guards all ring state; held for the duration of each transfer.
+  iree_slim_mutex_t mutex;
+
+  // Stream all staged copies are issued on.
+  CUstream stream;
+
+  // Page-locked host memory of |capacity| bytes split into slots of
+  // |slot_capacity| bytes. Allocated on first use.
+  iree_host_size_t capacity;
+  iree_host_size_t slot_capacity;
+  uint8_t* host_ptr;
+
+  // Index of the slot the next chunk will be staged in.
+  iree_host_size_t next_slot;
+  iree_hal_cuda_staging_slot_t slots[IREE_HAL_CUDA_STAGING_RING_SLOT_COUNT];
+};
+
+iree_status_t iree_hal_cuda_staging_ring_allocate(
+    iree_hal_cuda_context_wrapper_t* context, iree_host_size_t capacity,
+    iree_hal_cuda_staging_ring_t** out_ring) {
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(out_ring);
+  *out_ring = NULL;
+  const iree_host_size_t slot_capacity =
+      capacity / IREE_HAL_CUDA_STAGING_RING_SLOT_COUNT;
+  if (slot_capacity == 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "staging ring capacity must be at least %d bytes",
+                            IREE_HAL_CUDA_STAGING_RING_SLOT_COUNT);
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_cuda_staging_ring_t* ring = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(context->host_allocator, sizeof(*ring),
+                                (void**)&ring));
+  memset(ring, 0, sizeof(*ring));
+  ring->context = context;
+  iree_slim_mutex_initialize(&ring->mutex);
+  ring->slot_capacity = slot_capacity;
+  ring->capacity = slot_capacity * IREE_HAL_CUDA_STAGING_RING_SLOT_COUNT;
+
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      context->syms, cuStreamCreate(&ring->stream, CU_STREAM_NON_BLOCKING),
+      "cuStreamCreate");
+  for (iree_host_size_t i = 0;
+       i < IREE_ARRAYSIZE(ring->slots) && iree_status_is_ok(status); ++i) {
+    status = CU_RESULT_TO_STATUS(
+        context->syms,
+        cuEventCreate(&ring->slots[i].event, CU_EVENT_DISABLE_TIMING),
+        "cuEventCreate");
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_ring = ring;
+  } else {
+    iree_hal_cuda_staging_ring_free(ring);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_hal_cuda_staging_ring_free(iree_hal_cuda_staging_ring_t* ring) {
+  if (!ring) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_cuda_dynamic_symbols_t* syms = ring->context->syms;
+  if (ring->stream) {
+    CUDA_IGNORE_ERROR(syms, cuStreamSynchronize(ring->stream));
+  }
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(ring->slots); ++i) {
+    if (ring->slots[i].event) {
+      CUDA_IGNORE_ERROR(syms, cuEventDestroy(ring->slots[i].event));
+    }
+  }
+  if (ring->host_ptr) {
+    CUDA_IGNORE_ERROR(syms, cuMemFreeHost(ring->host_ptr));
+  }
+  if (ring->stream) {
+    CUDA_IGNORE_ERROR(syms, cuStreamDestroy(ring->stream));
+  }
+  iree_slim_mutex_deinitialize(&ring->mutex);
+  iree_allocator_free(ring->context->host_allocator, ring);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Allocates the page-locked host memory of the ring if not yet allocated.
+// Must be called with the ring mutex held.
+static iree_status_t iree_hal_cuda_staging_ring_ensure_host_memory(
+    iree_hal_cuda_staging_ring_t* ring) {
+  if (ring->host_ptr) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, ring->capacity);
+  // Write-combined memory is fast for the device to read and for the host to
+  // write but very slow for the host to read back, which downloads need.
+  iree_status_t status = CU_RESULT_TO_STATUS(
+      ring->context->syms,
+      cuMemHostAlloc((void**)&ring->host_ptr, ring->capacity, /*flags=*/0),
+      "cuMemHostAlloc");
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Waits for the pending copy using |slot| to complete and, if it was a
+// download, copies the slot contents to their host target.
+// Must be called with the ring mutex held.
+static iree_status_t iree_hal_cuda_staging_ring_drain_slot(
+    iree_hal_cuda_staging_ring_t* ring, iree_host_size_t slot_index) {
+  iree_hal_cuda_staging_slot_t* slot = &ring->slots[slot_index];
+  if (!slot->is_pending) return iree_ok_status();
+  slot->is_pending = false;
+  void* readback_target = slot->readback_target;
+  slot->readback_target = NULL;
+  CUDA_RETURN_IF_ERROR(ring->context->syms, cuEventSynchronize(slot->event),
+                       "cuEventSynchronize");
+  if (readback_target) {
+    memcpy(readback_target, ring->host_ptr + slot_index * ring->slot_capacity,
+           slot->readback_length);
+  }
+  return iree_ok_status();
+}
+
+// Drains all slots in the order their copies were issued.
+// Must be called with the ring mutex held.
+static iree_status_t iree_hal_cuda_staging_ring_drain_all(
+    iree_hal_cuda_staging_ring_t* ring) {
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(ring->slots); ++i) {
+    iree_host_size_t slot_index =
+        (ring->next_slot + i) % IREE_ARRAYSIZE(ring->slots);
+    status = iree_status_join(
+        status, iree_hal_cuda_staging_ring_drain_slot(ring, slot_index));
+  }
+  return status;
+}
+
+// Returns the index of the next slot after draining any copy still using it.
+// Must be called with the ring mutex held.
+static iree_status_t iree_hal_cuda_staging_ring_acquire_slot(
+    iree_hal_cuda_staging_ring_t* ring, iree_host_size_t* out_slot_index) {
+  iree_host_size_t slot_index = ring->next_slot;
+  ring->next_slot = (slot_index + 1) % IREE_ARRAYSIZE(ring->slots);
+  *out_slot_index = slot_index;
+  return iree_hal_cuda_staging_ring_drain_slot(ring, slot_index);
+}
+
+iree_status_t iree_hal_cuda_staging_ring_upload(
+    iree_hal_cuda_staging_ring_t* ring, const void* source, CUdeviceptr target,
+    iree_device_size_t length) {
+  IREE_ASSERT_ARGUMENT(ring);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, length);
+  iree_hal_cuda_dynamic_symbols_t* syms = ring->context->syms;
+  iree_slim_mutex_lock(&ring->mutex);
+
+  iree_status_t status = iree_hal_cuda_staging_ring_ensure_host_memory(ring);
+  for (iree_device_size_t offset = 0;
+       offset < length && iree_status_is_ok(status);) {
+    const iree_host_size_t chunk_length =
+        (iree_host_size_t)iree_min(length - offset, ring->slot_capacity);
+    iree_host_size_t slot_index = 0;
+    status = iree_hal_cuda_staging_ring_acquire_slot(ring, &slot_index);
+    if (!iree_status_is_ok(status)) break;
+    uint8_t* slot_ptr = ring->host_ptr + slot_index * ring->slot_capacity;
+    memcpy(slot_ptr, (const uint8_t*)source + offset, chunk_length);
+    status = CU_RESULT_TO_STATUS(
+        syms,
+        cuMemcpyHtoDAsync_v2(target + offset, slot_ptr, chunk_length,
+                             ring->stream),
+        "cuMemcpyHtoDAsync_v2");
+    if (iree_status_is_ok(status)) {
+      status = CU_RESULT_TO_STATUS(
+          syms, cuEventRecord(ring->slots[slot_index].event, ring->stream),
+          "cuEventRecord");
+    }
+    if (!iree_status_is_ok(status)) break;
+    ring->slots[slot_index].is_pending = true;
+    offset += chunk_length;
+  }
+
+  // The upload must be complete before work on other streams reads the target.
+  status = iree_status_join(status, iree_hal_cuda_staging_ring_drain_all(ring));
+  if (!iree_status_is_ok(status)) {
+    // Copies issued before the failure may not have a recorded event.
+    CUDA_IGNORE_ERROR(syms, cuStreamSynchronize(ring->stream));
+  }
+
+  iree_slim_mutex_unlock(&ring->mutex);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_hal_cuda_staging_ring_download(
+    iree_hal_cuda_staging_ring_t* ring, CUdeviceptr source, void* target,
+    iree_device_size_t length) {
+  IREE_ASSERT_ARGUMENT(ring);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, length);
+  iree_hal_cuda_dynamic_symbols_t* syms = ring->context->syms;
+  iree_slim_mutex_lock(&ring->mutex);
+
+  iree_status_t status = iree_hal_cuda_staging_ring_ensure_host_memory(ring);
+  for (iree_device_size_t offset = 0;
+       offset < length && iree_status_is_ok(status);) {
+    const iree_host_size_t chunk_length =
+        (iree_host_size_t)iree_min(length - offset, ring->slot_capacity);
+    iree_host_size_t slot_index = 0;
+    status = iree_hal_cuda_staging_ring_acquire_slot(ring, &slot_index);
+    if (!iree_status_is_ok(status)) break;
+    uint8_t* slot_ptr = ring->host_ptr + slot_index * ring->slot_capacity;
+    status = CU_RESULT_TO_STATUS(
+        syms,
+        cuMemcpyDtoHAsync_v2(slot_ptr, source + offset, chunk_length,
+                             ring->stream),
+        "cuMemcpyDtoHAsync_v2");
+    if (iree_status_is_ok(status)) {
+      status = CU_RESULT_TO_STATUS(
+          syms, cuEventRecord(ring->slots[slot_index].event, ring->stream),
+          "cuEventRecord");
+    }
+    if (!iree_status_is_ok(status)) break;
+    iree_hal_cuda_staging_slot_t* slot = &ring->slots[slot_index];
+    slot->is_pending = true;
+    slot->readback_target = (uint8_t*)target + offset;
+    slot->readback_length = chunk_length;
+    offset += chunk_length;
+  }
+
+  // Copy out the remaining chunks as they arrive.
+  status = iree_status_join(status, iree_hal_cuda_staging_ring_drain_all(ring));
+  if (!iree_status_is_ok(status)) {
+    // Copies issued before the failure may not have a recorded event.
+    CUDA_IGNORE_ERROR(syms, cuStreamSynchronize(ring->stream));
+  }
+
+  iree_slim_mutex_unlock(&ring->mutex);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -0,0 +1,65 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_CUDA_STAGING_RING_H_
+#define IREE_HAL_DRIVERS_CUDA_STAGING_RING_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/drivers/cuda/context_wrapper.h"
+#include "iree/hal/drivers/cuda/cuda_headers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Number of slots the staging ring memory is divided into. Transfers are split
+// into slot-sized chunks such that the host can fill or drain one slot while
+// the copy engine works on the others.
+#if !defined(IREE_HAL_CUDA_STAGING_RING_SLOT_COUNT)
+#define IREE_HAL_CUDA_STAGING_RING_SLOT_COUNT 4
+#endif  // !IREE_HAL_CUDA_STAGING_RING_SLOT_COUNT
+
+// A ring of page-locked host memory used to stage transfers between pageable
+// host memory and device memory.
+//
+// Copies from pageable memory are performed by the driver synchronously through
+// its own small internal staging buffers and each transfer made through the
+// generic HAL utilities allocates (and page-locks) a new staging buffer. The
+// ring is allocated once on first use and transfers are pipelined through its
+// slots on a dedicated copy stream: while the copy engine moves one chunk the
+// host memcpys the next. As the copy stream is distinct from the queue streams
+// transfers overlap with any compute work already in-flight on the device.
+//
+// Thread-safe; concurrent transfers are serialized.
+typedef struct iree_hal_cuda_staging_ring_t iree_hal_cuda_staging_ring_t;
+
+// Allocates a staging ring of |capacity| bytes for |context|. The page-locked
+// host memory is not allocated until the first transfer.
+iree_status_t iree_hal_cuda_staging_ring_allocate(
+    iree_hal_cuda_context_wrapper_t* context, iree_host_size_t capacity,
+    iree_hal_cuda_staging_ring_t** out_ring);
+
+// Frees |ring| after waiting for any in-flight copies to complete.
+void iree_hal_cuda_staging_ring_free(iree_hal_cuda_staging_ring_t* ring);
+
+// Copies |length| bytes from host memory at |source| to device memory at
+// |target| and waits for the copy to complete.
+iree_status_t iree_hal_cuda_staging_ring_upload(
+    iree_hal_cuda_staging_ring_t* ring, const void* source, CUdeviceptr target,
+    iree_device_size_t length);
+
+// Copies |length| bytes from device memory at |source| to host memory at
+// |target| and waits for the copy to complete.
+iree_status_t iree_hal_cuda_staging_ring_download(
+    iree_hal_cuda_staging_ring_t* ring, CUdeviceptr source, void* target,
+    iree_device_size_t length);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_CUDA_STAGING_RING_H_
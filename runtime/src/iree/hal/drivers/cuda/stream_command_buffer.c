@@ -9,13 +9,12 @@
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/cuda/cuda_buffer.h"
 #include "iree/hal/drivers/cuda/cuda_event.h"
+#include "iree/hal/drivers/cuda/cuda_profiler.h"
 #include "iree/hal/drivers/cuda/executable_layout.h"
 #include "iree/hal/drivers/cuda/native_executable.h"
 #include "iree/hal/drivers/cuda/status_util.h"
 
 #define IREE_HAL_CUDA_MAX_BINDING_COUNT 64
-// Kernel arguments contains binding and push constants.
-#define IREE_HAL_CUDA_MAX_KERNEL_ARG 128
 // This records the commands on the calling thread without additional threading
 // indirection.
 
@@ -29,10 +28,12 @@ typedef struct {
   // asynchronous operations.
   iree_arena_allocator_t arena;
 
+  // Profiler capturing dispatches or NULL if not profiling.
+  iree_hal_cuda_profiler_t* profiler;
+
   int32_t push_constant[IREE_HAL_CUDA_MAX_PUSH_CONSTANT_COUNT];
-  // Keep track of the current set of kernel arguments.
-  void* current_descriptor[IREE_HAL_CUDA_MAX_KERNEL_ARG];
-  CUdeviceptr* device_ptrs[IREE_HAL_CUDA_MAX_KERNEL_ARG];
+  // Keep track of the current set of bound buffers in kernel argument order.
+  CUdeviceptr bindings[IREE_HAL_CUDA_MAX_KERNEL_ARG];
 } iree_hal_cuda_stream_command_buffer_t;
 
 static const iree_hal_command_buffer_vtable_t
@@ -64,13 +65,12 @@ iree_status_t iree_hal_cuda_stream_command_buffer_create(
   if (iree_status_is_ok(status)) {
     iree_hal_command_buffer_initialize(
         device, mode, command_categories, IREE_HAL_QUEUE_AFFINITY_ANY,
-        &iree_hal_cuda_stream_command_buffer_vtable, &command_buffer->base);
+        /*binding_capacity=*/0, &iree_hal_cuda_stream_command_buffer_vtable,
+        &command_buffer->base);
     command_buffer->context = context;
     command_buffer->stream = stream;
     iree_arena_initialize(block_pool, &command_buffer->arena);
-    for (size_t i = 0; i < IREE_HAL_CUDA_MAX_KERNEL_ARG; i++) {
-      command_buffer->current_descriptor[i] = &command_buffer->device_ptrs[i];
-    }
+    command_buffer->profiler = NULL;
   }
 
   *out_command_buffer = &command_buffer->base;
@@ -90,6 +90,14 @@ static void iree_hal_cuda_stream_command_buffer_destroy(
   IREE_TRACE_ZONE_END(z0);
 }
 
+void iree_hal_cuda_stream_command_buffer_set_profiler(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_cuda_profiler_t* profiler) {
+  iree_hal_cuda_stream_command_buffer_t* command_buffer =
+      iree_hal_cuda_stream_command_buffer_cast(base_command_buffer);
+  command_buffer->profiler = profiler;
+}
+
 bool iree_hal_cuda_stream_command_buffer_isa(
     iree_hal_command_buffer_t* command_buffer) {
   return iree_hal_command_buffer_dyn_cast(
@@ -324,8 +332,7 @@ static iree_status_t iree_hal_cuda_stream_command_buffer_push_descriptor_set(
         iree_hal_cuda_buffer_device_pointer(
             iree_hal_buffer_allocated_buffer(binding.buffer)) +
         iree_hal_buffer_byte_offset(binding.buffer) + binding.offset;
-    *((CUdeviceptr*)command_buffer->current_descriptor[i + base_binding]) =
-        device_ptr;
+    command_buffer->bindings[i + base_binding] = device_ptr;
   }
   return iree_ok_status();
 }
@@ -346,34 +353,58 @@ static iree_status_t iree_hal_cuda_stream_command_buffer_dispatch(
     uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z) {
   iree_hal_cuda_stream_command_buffer_t* command_buffer =
       iree_hal_cuda_stream_command_buffer_cast(base_command_buffer);
-  iree_hal_executable_layout_t* layout =
-      iree_hal_cuda_executable_get_layout(executable, entry_point);
-  iree_host_size_t num_constants =
-      iree_hal_cuda_executable_layout_num_constants(layout);
-  iree_host_size_t constant_base_index =
-      iree_hal_cuda_push_constant_index(layout);
-  // Patch the push constants in the kernel arguments.
-  for (iree_host_size_t i = 0; i < num_constants; i++) {
-    *((uint32_t*)command_buffer->current_descriptor[i + constant_base_index]) =
-        command_buffer->push_constant[i];
+  const iree_hal_cuda_kernel_params_t* kernel_params =
+      iree_hal_cuda_native_executable_kernel_params(executable, entry_point);
+
+  // Pack the bindings and push constants into a single parameter block; the
+  // driver copies it during the launch so it can live on the stack.
+  uint8_t param_buffer[IREE_HAL_CUDA_MAX_KERNEL_PARAM_BUFFER_SIZE];
+  iree_hal_cuda_kernel_params_pack(kernel_params, command_buffer->bindings,
+                                   command_buffer->push_constant, param_buffer);
+  size_t param_buffer_size = kernel_params->param_buffer_size;
+  void* extra[] = {
+      CU_LAUNCH_PARAM_BUFFER_POINTER, param_buffer,
+      CU_LAUNCH_PARAM_BUFFER_SIZE,    &param_buffer_size,
+      CU_LAUNCH_PARAM_END,
+  };
+  // When profiling the launch is bracketed with timing events resolved later
+  // by the profiler.
+  iree_hal_cuda_profiler_t* profiler = command_buffer->profiler;
+  iree_hal_cuda_profiler_dispatch_t dispatch;
+  if (profiler) {
+    IREE_RETURN_IF_ERROR(iree_hal_cuda_profiler_append_dispatch(
+        profiler, executable, entry_point, workgroup_x, workgroup_y,
+        workgroup_z, &dispatch));
   }
-
-  int32_t block_size_x, block_size_y, block_size_z;
-  int32_t shared_memory_size;
-  IREE_RETURN_IF_ERROR(iree_hal_cuda_native_executable_block_size(
-      executable, entry_point, &block_size_x, &block_size_y, &block_size_z));
-  IREE_RETURN_IF_ERROR(iree_hal_cuda_native_executable_shared_memory_size(
-      executable, entry_point, &shared_memory_size));
-  CUfunction func =
-      iree_hal_cuda_native_executable_for_entry_point(executable, entry_point);
-  CUDA_RETURN_IF_ERROR(
-      command_buffer->context->syms,
-      cuLaunchKernel(func, workgroup_x, workgroup_y, workgroup_z, block_size_x,
-                     block_size_y, block_size_z, shared_memory_size,
-                     command_buffer->stream, command_buffer->current_descriptor,
-                     NULL),
-      "cuLaunchKernel");
-  return iree_ok_status();
+  iree_status_t status = iree_ok_status();
+  if (profiler) {
+    status = CU_RESULT_TO_STATUS(
+        command_buffer->context->syms,
+        cuEventRecord(dispatch.start_event, command_buffer->stream),
+        "cuEventRecord");
+  }
+  if (iree_status_is_ok(status)) {
+    status = CU_RESULT_TO_STATUS(
+        command_buffer->context->syms,
+        cuLaunchKernel(kernel_params->function, workgroup_x, workgroup_y,
+                       workgroup_z, kernel_params->block_size[0],
+                       kernel_params->block_size[1],
+                       kernel_params->block_size[2],
+                       kernel_params->shared_memory_size,
+                       command_buffer->stream, /*kernelParams=*/NULL, extra),
+        "cuLaunchKernel");
+  }
+  if (profiler) {
+    if (iree_status_is_ok(status)) {
+      status = CU_RESULT_TO_STATUS(
+          command_buffer->context->syms,
+          cuEventRecord(dispatch.end_event, command_buffer->stream),
+          "cuEventRecord");
+    }
+    iree_hal_cuda_profiler_commit_dispatch(profiler, &dispatch,
+                                           iree_status_is_ok(status));
+  }
+  return status;
 }
 
 static iree_status_t iree_hal_cuda_stream_command_buffer_dispatch_indirect(
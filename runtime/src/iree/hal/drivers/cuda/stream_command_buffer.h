@@ -35,6 +35,14 @@ iree_status_t iree_hal_cuda_stream_command_buffer_create(
     iree_arena_block_pool_t* block_pool,
     iree_hal_command_buffer_t** out_command_buffer);
 
+typedef struct iree_hal_cuda_profiler_t iree_hal_cuda_profiler_t;
+
+// Sets the |profiler| capturing dispatches issued by |command_buffer| or NULL
+// to stop capturing. Must not be called while commands are being issued.
+void iree_hal_cuda_stream_command_buffer_set_profiler(
+    iree_hal_command_buffer_t* command_buffer,
+    iree_hal_cuda_profiler_t* profiler);
+
 // Returns true if |command_buffer| is a CUDA stream-based command buffer.
 bool iree_hal_cuda_stream_command_buffer_isa(
     iree_hal_command_buffer_t* command_buffer);
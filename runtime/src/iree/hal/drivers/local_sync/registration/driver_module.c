@@ -10,9 +10,16 @@
 #include <stddef.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/flags.h"
 #include "iree/hal/drivers/local_sync/sync_driver.h"
 #include "iree/hal/local/loaders/registration/init.h"
 
+IREE_FLAG(
+    int32_t, local_sync_worker_count, 1,
+    "Total number of threads (including the submitting thread) that the\n"
+    "workgroups of each dispatch are split across. 1 executes all work on\n"
+    "the submitting thread.");
+
 static iree_status_t iree_hal_local_sync_driver_factory_enumerate(
     void* self, iree_host_size_t* out_driver_info_count,
     const iree_hal_driver_info_t** out_driver_infos) {
@@ -38,10 +45,22 @@ static iree_status_t iree_hal_local_sync_driver_factory_try_create(
   iree_hal_sync_device_params_t default_params;
   iree_hal_sync_device_params_initialize(&default_params);
 
+  iree_status_t status = iree_ok_status();
+  if (FLAG_local_sync_worker_count < 1) {
+    status = iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "--local_sync_worker_count must be >= 1");
+  } else if (FLAG_local_sync_worker_count > 1) {
+    status = iree_hal_inline_worker_group_create_with_threads(
+        (iree_host_size_t)FLAG_local_sync_worker_count, host_allocator,
+        &default_params.worker_group);
+  }
+
   iree_hal_executable_loader_t* loaders[8] = {NULL};
   iree_host_size_t loader_count = 0;
-  iree_status_t status = iree_hal_create_all_available_executable_loaders(
-      IREE_ARRAYSIZE(loaders), &loader_count, loaders, host_allocator);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_create_all_available_executable_loaders(
+        IREE_ARRAYSIZE(loaders), &loader_count, loaders, host_allocator);
+  }
 
   iree_hal_allocator_t* device_allocator = NULL;
   if (iree_status_is_ok(status)) {
@@ -60,6 +79,7 @@ static iree_status_t iree_hal_local_sync_driver_factory_try_create(
   for (iree_host_size_t i = 0; i < loader_count; ++i) {
     iree_hal_executable_loader_release(loaders[i]);
   }
+  iree_hal_inline_worker_group_release(default_params.worker_group);
   return status;
 }
 
@@ -10,6 +10,7 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "iree/base/internal/arena.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/local_sync/sync_event.h"
 #include "iree/hal/drivers/local_sync/sync_semaphore.h"
@@ -19,6 +20,8 @@
 #include "iree/hal/local/local_executable_cache.h"
 #include "iree/hal/local/local_executable_layout.h"
 #include "iree/hal/utils/buffer_transfer.h"
+#include "iree/hal/utils/deferred_command_buffer.h"
+#include "iree/hal/utils/transient_buffer_pool.h"
 
 typedef struct iree_hal_sync_device_t {
   iree_hal_resource_t resource;
@@ -27,8 +30,21 @@ typedef struct iree_hal_sync_device_t {
   iree_allocator_t host_allocator;
   iree_hal_allocator_t* device_allocator;
 
+  // Block pool used for recording deferred command buffers.
+  iree_arena_block_pool_t large_block_pool;
+
+  // Optional workers that dispatches are split across.
+  iree_hal_inline_worker_group_t* worker_group;
+
+  // Pool of storage recycled by queue-ordered allocations.
+  iree_hal_transient_buffer_pool_t* transient_pool;
+
   iree_hal_sync_semaphore_state_t semaphore_state;
 
+  // Storage shared by all executable caches created from the device such that
+  // contexts loading the same executables share them.
+  iree_hal_local_executable_cache_storage_t* executable_cache_storage;
+
   iree_host_size_t loader_count;
   iree_hal_executable_loader_t* loaders[];
 } iree_hal_sync_device_t;
@@ -44,10 +60,15 @@ static iree_hal_sync_device_t* iree_hal_sync_device_cast(
 void iree_hal_sync_device_params_initialize(
     iree_hal_sync_device_params_t* out_params) {
   memset(out_params, 0, sizeof(*out_params));
+  out_params->arena_block_size = 32 * 1024;
 }
 
 static iree_status_t iree_hal_sync_device_check_params(
     const iree_hal_sync_device_params_t* params) {
+  if (params->arena_block_size < 4096) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "arena block size too small (< 4096 bytes)");
+  }
   return iree_ok_status();
 }
 
@@ -81,6 +102,10 @@ iree_status_t iree_hal_sync_device_create(
     device->host_allocator = host_allocator;
     device->device_allocator = device_allocator;
     iree_hal_allocator_retain(device_allocator);
+    iree_arena_block_pool_initialize(params->arena_block_size, host_allocator,
+                                     &device->large_block_pool);
+    device->worker_group = params->worker_group;
+    iree_hal_inline_worker_group_retain(device->worker_group);
 
     device->loader_count = loader_count;
     for (iree_host_size_t i = 0; i < device->loader_count; ++i) {
@@ -89,6 +114,13 @@ iree_status_t iree_hal_sync_device_create(
     }
 
     iree_hal_sync_semaphore_state_initialize(&device->semaphore_state);
+
+    status = iree_hal_transient_buffer_pool_create(
+        device_allocator, host_allocator, &device->transient_pool);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_local_executable_cache_storage_create(
+        host_allocator, &device->executable_cache_storage);
   }
 
   if (iree_status_is_ok(status)) {
@@ -110,7 +142,12 @@ static void iree_hal_sync_device_destroy(iree_hal_device_t* base_device) {
   for (iree_host_size_t i = 0; i < device->loader_count; ++i) {
     iree_hal_executable_loader_release(device->loaders[i]);
   }
+  iree_hal_local_executable_cache_storage_release(
+      device->executable_cache_storage);
+  iree_hal_transient_buffer_pool_free(device->transient_pool);
   iree_hal_allocator_release(device->device_allocator);
+  iree_arena_block_pool_deinitialize(&device->large_block_pool);
+  iree_hal_inline_worker_group_release(device->worker_group);
   iree_allocator_free(host_allocator, device);
 
   IREE_TRACE_ZONE_END(z0);
@@ -134,8 +171,18 @@ static iree_hal_allocator_t* iree_hal_sync_device_allocator(
   return device->device_allocator;
 }
 
+static void iree_hal_sync_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_sync_device_t* device = iree_hal_sync_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
 static iree_status_t iree_hal_sync_device_trim(iree_hal_device_t* base_device) {
   iree_hal_sync_device_t* device = iree_hal_sync_device_cast(base_device);
+  iree_arena_block_pool_trim(&device->large_block_pool);
+  iree_hal_transient_buffer_pool_trim(device->transient_pool);
   return iree_hal_allocator_trim(device->device_allocator);
 }
 
@@ -176,13 +223,24 @@ static iree_status_t iree_hal_sync_device_query_i64(
 static iree_status_t iree_hal_sync_device_create_command_buffer(
     iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer) {
-  // TODO(#4680): implement a non-inline command buffer that stores its commands
-  // and can be submitted later on/multiple-times.
-  return iree_hal_inline_command_buffer_create(
-      base_device, mode, command_categories, queue_affinity,
-      iree_hal_device_host_allocator(base_device), out_command_buffer);
+  iree_hal_sync_device_t* device = iree_hal_sync_device_cast(base_device);
+  if (iree_all_bits_set(mode,
+                        IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION)) {
+    return iree_hal_inline_command_buffer_create(
+        base_device, mode, command_categories, queue_affinity,
+        device->worker_group, iree_hal_device_host_allocator(base_device),
+        out_command_buffer);
+  }
+  // Command buffers that cannot execute during recording are recorded and then
+  // replayed through an inline command buffer when submitted. Binding table
+  // slots are resolved as part of the replay.
+  // TODO(#4680): implement a non-inline command buffer that avoids the replay.
+  return iree_hal_deferred_command_buffer_create(
+      base_device, mode, command_categories, binding_capacity,
+      &device->large_block_pool, iree_hal_device_host_allocator(base_device),
+      out_command_buffer);
 }
 
 static iree_status_t iree_hal_sync_device_create_descriptor_set(
@@ -218,6 +276,8 @@ static iree_status_t iree_hal_sync_device_create_executable_cache(
   iree_hal_sync_device_t* device = iree_hal_sync_device_cast(base_device);
   return iree_hal_local_executable_cache_create(
       identifier, device->loader_count, device->loaders,
+      device->executable_cache_storage,
+      iree_hal_local_executable_cache_scheduler_null(),
       iree_hal_device_host_allocator(base_device), out_executable_cache);
 }
 
@@ -246,6 +306,28 @@ iree_hal_sync_device_query_semaphore_compatibility(
   return IREE_HAL_SEMAPHORE_COMPATIBILITY_HOST_ONLY;
 }
 
+// Replays a deferred |command_buffer| by executing it inline on the calling
+// thread with binding table slots resolved from |binding_table|.
+static iree_status_t iree_hal_sync_device_replay_command_buffer(
+    iree_hal_sync_device_t* device, iree_hal_command_buffer_t* command_buffer,
+    iree_hal_buffer_binding_table_t binding_table) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_command_buffer_t* inline_command_buffer = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_inline_command_buffer_create(
+              (iree_hal_device_t*)device,
+              IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT |
+                  IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION,
+              iree_hal_command_buffer_allowed_categories(command_buffer),
+              IREE_HAL_QUEUE_AFFINITY_ANY, device->worker_group,
+              device->host_allocator, &inline_command_buffer));
+  iree_status_t status = iree_hal_deferred_command_buffer_apply(
+      command_buffer, inline_command_buffer, binding_table);
+  iree_hal_command_buffer_release(inline_command_buffer);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static iree_status_t iree_hal_sync_device_queue_submit(
     iree_hal_device_t* base_device,
     iree_hal_command_category_t command_categories,
@@ -266,8 +348,16 @@ static iree_status_t iree_hal_sync_device_queue_submit(
         &device->semaphore_state, IREE_HAL_WAIT_MODE_ALL,
         &batch->wait_semaphores, iree_infinite_timeout()));
 
-    // TODO(#4680): if we were doing deferred submissions we would issue them
-    // here. With only inline command buffers we have nothing to do here.
+    // Inline command buffers have already executed during recording and only
+    // deferred command buffers need to be replayed.
+    for (iree_host_size_t j = 0; j < batch->command_buffer_count; ++j) {
+      iree_hal_command_buffer_t* command_buffer = batch->command_buffers[j];
+      if (iree_hal_inline_command_buffer_isa(command_buffer)) continue;
+      IREE_RETURN_IF_ERROR(iree_hal_sync_device_replay_command_buffer(
+          device, command_buffer,
+          batch->binding_tables ? batch->binding_tables[j]
+                                : iree_hal_buffer_binding_table_empty()));
+    }
 
     // Signal all semaphores now that batch work has completed.
     IREE_RETURN_IF_ERROR(iree_hal_sync_semaphore_multi_signal(
@@ -277,6 +367,53 @@ static iree_status_t iree_hal_sync_device_queue_submit(
   return iree_ok_status();
 }
 
+// Waits on |wait_semaphore_list| and then signals |signal_semaphore_list|.
+static iree_status_t iree_hal_sync_device_queue_barrier(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list) {
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = wait_semaphore_list;
+  batch.signal_semaphores = signal_semaphore_list;
+  return iree_hal_sync_device_queue_submit(
+      base_device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity, 1, &batch);
+}
+
+static iree_status_t iree_hal_sync_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_sync_device_t* device = iree_hal_sync_device_cast(base_device);
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_transient_buffer_pool_acquire(
+      device->transient_pool, params, allocation_size, wait_semaphore_list,
+      &buffer));
+  iree_status_t status = iree_hal_sync_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+static iree_status_t iree_hal_sync_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_sync_device_t* device = iree_hal_sync_device_cast(base_device);
+  // Waits happen inline and the storage is immediately available afterward.
+  IREE_RETURN_IF_ERROR(iree_hal_sync_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list));
+  return iree_hal_transient_buffer_pool_release(
+      device->transient_pool, buffer, iree_hal_semaphore_list_empty());
+}
+
 static iree_status_t iree_hal_sync_device_submit_and_wait(
     iree_hal_device_t* base_device,
     iree_hal_command_category_t command_categories,
@@ -308,11 +445,25 @@ static iree_status_t iree_hal_sync_device_wait_idle(
   return iree_ok_status();
 }
 
+static iree_status_t iree_hal_sync_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  // Unimplemented (and that's ok).
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_sync_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  // Unimplemented (and that's ok).
+  return iree_ok_status();
+}
+
 static const iree_hal_device_vtable_t iree_hal_sync_device_vtable = {
     .destroy = iree_hal_sync_device_destroy,
     .id = iree_hal_sync_device_id,
     .host_allocator = iree_hal_sync_device_host_allocator,
     .device_allocator = iree_hal_sync_device_allocator,
+    .replace_device_allocator = iree_hal_sync_device_replace_allocator,
     .trim = iree_hal_sync_device_trim,
     .query_i64 = iree_hal_sync_device_query_i64,
     .create_command_buffer = iree_hal_sync_device_create_command_buffer,
@@ -326,8 +477,12 @@ static const iree_hal_device_vtable_t iree_hal_sync_device_vtable = {
     .query_semaphore_compatibility =
         iree_hal_sync_device_query_semaphore_compatibility,
     .transfer_range = iree_hal_device_transfer_mappable_range,
+    .queue_alloca = iree_hal_sync_device_queue_alloca,
+    .queue_dealloca = iree_hal_sync_device_queue_dealloca,
     .queue_submit = iree_hal_sync_device_queue_submit,
     .submit_and_wait = iree_hal_sync_device_submit_and_wait,
     .wait_semaphores = iree_hal_sync_device_wait_semaphores,
     .wait_idle = iree_hal_sync_device_wait_idle,
+    .profiling_begin = iree_hal_sync_device_profiling_begin,
+    .profiling_end = iree_hal_sync_device_profiling_end,
 };
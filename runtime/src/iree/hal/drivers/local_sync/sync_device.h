@@ -10,6 +10,7 @@
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
 #include "iree/hal/local/executable_loader.h"
+#include "iree/hal/local/inline_worker_group.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -18,7 +19,14 @@ extern "C" {
 // Parameters configuring an iree_hal_sync_device_t.
 // Must be initialized with iree_hal_sync_device_params_initialize prior to use.
 typedef struct iree_hal_sync_device_params_t {
-  int reserved;
+  // Total size of each block in the device shared block pool used to record
+  // deferred command buffers.
+  iree_host_size_t arena_block_size;
+
+  // Optional workers that the workgroups of each dispatch are split across.
+  // When NULL all work executes on the submitting thread alone. Retained by
+  // devices created with the params.
+  iree_hal_inline_worker_group_t* worker_group;
 } iree_hal_sync_device_params_t;
 
 // Initializes |out_params| to default values.
@@ -52,7 +52,11 @@ typedef struct iree_hal_sync_semaphore_t {
   // Current signaled value. May be IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE to
   // indicate that the semaphore has been signaled for failure and
   // |failure_status| contains the error.
-  uint64_t current_value;
+  //
+  // Only updated with |mutex| held but may be loaded without it so that
+  // waiters can poll the payload. Stored as a signed atomic and must be read
+  // with iree_hal_sync_semaphore_load_value.
+  iree_atomic_int64_t current_value;
 
   // OK or the status passed to iree_hal_semaphore_fail. Owned by the semaphore.
   iree_status_t failure_status;
@@ -66,6 +70,21 @@ static iree_hal_sync_semaphore_t* iree_hal_sync_semaphore_cast(
   return (iree_hal_sync_semaphore_t*)base_value;
 }
 
+// Returns the current payload value of |semaphore| without taking its lock.
+static inline uint64_t iree_hal_sync_semaphore_load_value(
+    iree_hal_sync_semaphore_t* semaphore) {
+  return (uint64_t)iree_atomic_load_int64(&semaphore->current_value,
+                                          iree_memory_order_acquire);
+}
+
+// Stores |value| as the payload of |semaphore|. The semaphore mutex must be
+// held.
+static inline void iree_hal_sync_semaphore_store_value_unsafe(
+    iree_hal_sync_semaphore_t* semaphore, uint64_t value) {
+  iree_atomic_store_int64(&semaphore->current_value, (int64_t)value,
+                          iree_memory_order_release);
+}
+
 iree_status_t iree_hal_sync_semaphore_create(
     iree_hal_sync_semaphore_state_t* shared_state, uint64_t initial_value,
     iree_allocator_t host_allocator, iree_hal_semaphore_t** out_semaphore) {
@@ -84,7 +103,8 @@ iree_status_t iree_hal_sync_semaphore_create(
     semaphore->shared_state = shared_state;
 
     iree_slim_mutex_initialize(&semaphore->mutex);
-    semaphore->current_value = initial_value;
+    iree_atomic_store_int64(&semaphore->current_value, (int64_t)initial_value,
+                            iree_memory_order_relaxed);
     semaphore->failure_status = iree_ok_status();
 
     *out_semaphore = &semaphore->base;
@@ -117,7 +137,7 @@ static iree_status_t iree_hal_sync_semaphore_query(
 
   iree_slim_mutex_lock(&semaphore->mutex);
 
-  *out_value = semaphore->current_value;
+  *out_value = iree_hal_sync_semaphore_load_value(semaphore);
 
   iree_status_t status = iree_ok_status();
   if (*out_value >= IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE) {
@@ -133,8 +153,8 @@ static iree_status_t iree_hal_sync_semaphore_query(
 // invalid. The semaphore mutex must be held.
 static iree_status_t iree_hal_sync_semaphore_signal_unsafe(
     iree_hal_sync_semaphore_t* semaphore, uint64_t new_value) {
-  if (new_value <= semaphore->current_value) {
-    uint64_t current_value IREE_ATTRIBUTE_UNUSED = semaphore->current_value;
+  uint64_t current_value = iree_hal_sync_semaphore_load_value(semaphore);
+  if (new_value <= current_value) {
     return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
                             "semaphore values must be monotonically "
                             "increasing; current_value=%" PRIu64
@@ -143,7 +163,7 @@ static iree_status_t iree_hal_sync_semaphore_signal_unsafe(
   }
 
   // Update to the new value.
-  semaphore->current_value = new_value;
+  iree_hal_sync_semaphore_store_value_unsafe(semaphore, new_value);
 
   return iree_ok_status();
 }
@@ -194,7 +214,8 @@ static void iree_hal_sync_semaphore_fail(iree_hal_semaphore_t* base_semaphore,
   }
 
   // Signal to our failure sentinel value.
-  semaphore->current_value = IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE;
+  iree_hal_sync_semaphore_store_value_unsafe(
+      semaphore, IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE);
   semaphore->failure_status = status;
 
   iree_slim_mutex_unlock(&semaphore->mutex);
@@ -256,14 +277,12 @@ typedef struct iree_hal_sync_semaphore_notify_state_t {
   uint64_t value;
 } iree_hal_sync_semaphore_notify_state_t;
 
+// Returns true if the semaphore has reached the value (or failed).
+// Failure signals the semaphore to IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE so a
+// single lock-free load of the payload covers both.
 static bool iree_hal_sync_semaphore_is_signaled(
     iree_hal_sync_semaphore_notify_state_t* state) {
-  iree_hal_sync_semaphore_t* semaphore = state->semaphore;
-  iree_slim_mutex_lock(&semaphore->mutex);
-  bool is_signaled = semaphore->current_value >= state->value ||
-                     !iree_status_is_ok(semaphore->failure_status);
-  iree_slim_mutex_unlock(&semaphore->mutex);
-  return is_signaled;
+  return iree_hal_sync_semaphore_load_value(state->semaphore) >= state->value;
 }
 
 static iree_status_t iree_hal_sync_semaphore_wait(
@@ -273,49 +292,45 @@ static iree_status_t iree_hal_sync_semaphore_wait(
       iree_hal_sync_semaphore_cast(base_semaphore);
 
   // Try to see if we can return immediately.
-  iree_slim_mutex_lock(&semaphore->mutex);
-  if (!iree_status_is_ok(semaphore->failure_status)) {
+  uint64_t current_value = iree_hal_sync_semaphore_load_value(semaphore);
+  if (current_value >= IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE) {
     // Fastest path: failed; return an error to tell callers to query for it.
-    iree_slim_mutex_unlock(&semaphore->mutex);
     return iree_status_from_code(IREE_STATUS_ABORTED);
-  } else if (semaphore->current_value >= value) {
+  } else if (current_value >= value) {
     // Fast path: already satisfied.
-    iree_slim_mutex_unlock(&semaphore->mutex);
     return iree_ok_status();
   } else if (iree_timeout_is_immediate(timeout)) {
     // Not satisfied but a poll, so can avoid the expensive wait handle work.
-    iree_slim_mutex_unlock(&semaphore->mutex);
     return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
   }
-  iree_slim_mutex_unlock(&semaphore->mutex);
+  const iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
 
-  // TODO(#4680): we should be checking for DEADLINE_EXCEEDED here. This is
-  // easy when it's iree_timeout_is_infinite (we can just use the notification
-  // as below) but if it's an actual deadline we'll need to probably switch to
-  // iree_wait_handle_t.
-
-  // Perform wait on the global notification. Will wait forever.
+  // Spin briefly on the payload in case the signal is imminent; if it arrives
+  // we never touch the shared notification.
   iree_hal_sync_semaphore_state_t* shared_state = semaphore->shared_state;
   iree_hal_sync_semaphore_notify_state_t notify_state = {
       .semaphore = semaphore,
       .value = value,
   };
-  iree_notification_await(
-      &shared_state->notification,
-      (iree_condition_fn_t)iree_hal_sync_semaphore_is_signaled,
-      (void*)&notify_state, timeout);
+  if (!iree_hal_semaphore_spin_until(
+          (iree_condition_fn_t)iree_hal_sync_semaphore_is_signaled,
+          (void*)&notify_state, deadline_ns)) {
+    // Perform wait on the global notification.
+    iree_notification_await(
+        &shared_state->notification,
+        (iree_condition_fn_t)iree_hal_sync_semaphore_is_signaled,
+        (void*)&notify_state, iree_make_deadline(deadline_ns));
+  }
 
-  iree_status_t status = iree_ok_status();
-  iree_slim_mutex_lock(&semaphore->mutex);
-  if (!iree_status_is_ok(semaphore->failure_status)) {
+  current_value = iree_hal_sync_semaphore_load_value(semaphore);
+  if (current_value >= IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE) {
     // Semaphore has failed.
-    status = iree_status_from_code(IREE_STATUS_ABORTED);
-  } else if (semaphore->current_value < value) {
+    return iree_status_from_code(IREE_STATUS_ABORTED);
+  } else if (current_value < value) {
     // Deadline expired before the semaphore was signaled.
-    status = iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+    return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
   }
-  iree_slim_mutex_unlock(&semaphore->mutex);
-  return status;
+  return iree_ok_status();
 }
 
 // Returns true if any semaphore in the list has signaled (or failed).
@@ -325,11 +340,8 @@ static bool iree_hal_sync_semaphore_any_signaled(
   for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
     iree_hal_sync_semaphore_t* semaphore =
         iree_hal_sync_semaphore_cast(semaphore_list->semaphores[i]);
-    iree_slim_mutex_lock(&semaphore->mutex);
-    bool is_signaled =
-        semaphore->current_value >= semaphore_list->payload_values[i] ||
-        !iree_status_is_ok(semaphore->failure_status);
-    iree_slim_mutex_unlock(&semaphore->mutex);
+    bool is_signaled = iree_hal_sync_semaphore_load_value(semaphore) >=
+                       semaphore_list->payload_values[i];
     if (is_signaled) return true;
   }
   return false;
@@ -342,11 +354,8 @@ static bool iree_hal_sync_semaphore_all_signaled(
   for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
     iree_hal_sync_semaphore_t* semaphore =
         iree_hal_sync_semaphore_cast(semaphore_list->semaphores[i]);
-    iree_slim_mutex_lock(&semaphore->mutex);
-    bool is_signaled =
-        semaphore->current_value >= semaphore_list->payload_values[i] ||
-        !iree_status_is_ok(semaphore->failure_status);
-    iree_slim_mutex_unlock(&semaphore->mutex);
+    bool is_signaled = iree_hal_sync_semaphore_load_value(semaphore) >=
+                       semaphore_list->payload_values[i];
     if (!is_signaled) return false;
   }
   return true;
@@ -365,11 +374,9 @@ static iree_status_t iree_hal_sync_semaphore_result_from_state(
   for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
     iree_hal_sync_semaphore_t* semaphore =
         iree_hal_sync_semaphore_cast(semaphore_list->semaphores[i]);
-    iree_slim_mutex_lock(&semaphore->mutex);
-    const uint64_t current_value = semaphore->current_value;
-    const iree_status_code_t current_status_code =
-        iree_status_code(semaphore->failure_status);
-    if (current_status_code != IREE_STATUS_OK) {
+    const uint64_t current_value =
+        iree_hal_sync_semaphore_load_value(semaphore);
+    if (current_value >= IREE_HAL_SYNC_SEMAPHORE_FAILURE_VALUE) {
       // Semaphore has failed.
       any_failed = true;
     } else if (current_value < semaphore_list->payload_values[i]) {
@@ -379,7 +386,6 @@ static iree_status_t iree_hal_sync_semaphore_result_from_state(
       // Signaled!
       any_signaled = true;
     }
-    iree_slim_mutex_unlock(&semaphore->mutex);
   }
   if (any_failed) {
     // Always prioritize failure state.
@@ -421,13 +427,17 @@ iree_status_t iree_hal_sync_semaphore_multi_wait(
     return status;
   }
 
-  // Perform wait on the global notification.
-  iree_notification_await(
-      &shared_state->notification,
+  // Spin briefly polling the payloads in case the signals are imminent before
+  // falling back to a wait on the global notification.
+  iree_condition_fn_t condition_fn =
       wait_mode == IREE_HAL_WAIT_MODE_ALL
           ? (iree_condition_fn_t)iree_hal_sync_semaphore_all_signaled
-          : (iree_condition_fn_t)iree_hal_sync_semaphore_any_signaled,
-      (void*)semaphore_list, iree_infinite_timeout());
+          : (iree_condition_fn_t)iree_hal_sync_semaphore_any_signaled;
+  if (!iree_hal_semaphore_spin_until(condition_fn, (void*)semaphore_list,
+                                     iree_timeout_as_deadline_ns(timeout))) {
+    iree_notification_await(&shared_state->notification, condition_fn,
+                            (void*)semaphore_list, iree_infinite_timeout());
+  }
 
   // We may have been successful - or may have a partial failure.
   iree_status_t status =
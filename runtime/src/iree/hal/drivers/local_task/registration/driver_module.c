@@ -10,10 +10,41 @@
 #include <stddef.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/flags.h"
 #include "iree/hal/drivers/local_task/task_driver.h"
 #include "iree/hal/local/loaders/registration/init.h"
 #include "iree/task/api.h"
 
+IREE_FLAG(
+    bool, task_allocator_huge_pages, false,
+    "Backs large device buffers with transparent huge pages where the\n"
+    "platform supports it to reduce TLB misses when dispatches stream through\n"
+    "large weights.");
+
+IREE_FLAG(
+    bool, task_allocator_numa_placement, false,
+    "Places large device buffers on the NUMA node of the task system workers\n"
+    "when all workers are on a single node (such as when the topology is\n"
+    "restricted to one socket). Has no effect if workers span nodes.");
+
+// Initializes the device allocator placement |out_options| from flags for
+// buffers used by workers in |topology|.
+static void iree_hal_local_task_driver_allocator_options_from_flags(
+    const iree_task_topology_t* topology,
+    iree_hal_heap_allocator_options_t* out_options) {
+  iree_hal_heap_allocator_options_initialize(out_options);
+  if (FLAG_task_allocator_huge_pages) {
+    out_options->flags |= IREE_HAL_HEAP_ALLOCATOR_FLAG_TRANSPARENT_HUGE_PAGES;
+  }
+  if (FLAG_task_allocator_numa_placement) {
+    const uint32_t numa_node =
+        iree_task_topology_query_common_numa_node(topology);
+    if (numa_node != IREE_TASK_TOPOLOGY_NUMA_NODE_ANY) {
+      out_options->numa_node = numa_node;
+    }
+  }
+}
+
 static iree_status_t iree_hal_local_task_driver_factory_enumerate(
     void* self, iree_host_size_t* out_driver_info_count,
     const iree_hal_driver_info_t** out_driver_infos) {
@@ -46,18 +77,33 @@ static iree_status_t iree_hal_local_task_driver_factory_try_create(
   iree_status_t status = iree_hal_create_all_available_executable_loaders(
       IREE_ARRAYSIZE(loaders), &loader_count, loaders, host_allocator);
 
+  iree_task_topology_t topology;
+  if (iree_status_is_ok(status)) {
+    status = iree_task_topology_initialize_from_flags(&topology);
+  } else {
+    iree_task_topology_initialize(&topology);
+  }
+
   iree_task_executor_t* executor = NULL;
   if (iree_status_is_ok(status)) {
-    status = iree_task_executor_create_from_flags(host_allocator, &executor);
+    iree_task_executor_options_t options;
+    iree_task_executor_options_initialize_from_flags(&options);
+    status = iree_task_executor_create(options, &topology, host_allocator,
+                                       &executor);
   }
 
   iree_hal_allocator_t* device_allocator = NULL;
   if (iree_status_is_ok(status)) {
-    status = iree_hal_allocator_create_heap(iree_make_cstring_view("local"),
-                                            host_allocator, host_allocator,
-                                            &device_allocator);
+    iree_hal_heap_allocator_options_t allocator_options;
+    iree_hal_local_task_driver_allocator_options_from_flags(&topology,
+                                                            &allocator_options);
+    status = iree_hal_allocator_create_heap_with_options(
+        iree_make_cstring_view("local"), &allocator_options, host_allocator,
+        host_allocator, &device_allocator);
   }
 
+  iree_task_topology_deinitialize(&topology);
+
   if (iree_status_is_ok(status)) {
     status = iree_hal_task_driver_create(
         driver_name, &default_params, executor, loader_count, loaders,
@@ -9,6 +9,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "iree/base/api.h"
@@ -36,6 +37,138 @@
 // additional allocations required during recording or execution. That means our
 // command buffer here is essentially just a builder for the task system types
 // and manager of the lifetime of the tasks.
+//
+// Reusable command buffers (those without
+// IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT) are recorded the same way but when
+// recording ends the task DAG is packed into an immutable template (see
+// iree_hal_task_command_buffer_template_t). Each issue clones the template into
+// the submission arena with a single copy and only links the clone to the
+// retire task of the submission.
+//
+// Command buffers created with a binding capacity may push descriptor set
+// bindings referencing binding table slots. Dispatches using them are recorded
+// with placeholder binding pointers and a fixup that is applied to the issued
+// tasks (or the template clone) using the binding table of the submission.
+
+// Fills, updates, and copies are not emitted as individual tasks. Instead they
+// are batched into a single multi-range transfer dispatch per synchronization
+// scope (see iree_hal_cmd_transfer_t). Execution barriers separating scopes
+// that contain only transfers are elided when none of the transfers on either
+// side of the barrier access overlapping ranges with at least one writer; this
+// keeps the small transfers interleaved with compute dispatches from each
+// forcing a join-fork point in the DAG.
+
+// Maximum number of transfer operations batched into a single transfer task.
+// Batches that fill are flushed and a new batch started.
+#define IREE_HAL_CMD_TRANSFER_MAX_OPS 32
+
+typedef enum iree_hal_cmd_transfer_op_type_e {
+  IREE_HAL_CMD_TRANSFER_OP_FILL = 0,
+  IREE_HAL_CMD_TRANSFER_OP_UPDATE,
+  IREE_HAL_CMD_TRANSFER_OP_COPY,
+} iree_hal_cmd_transfer_op_type_t;
+
+// A single fill, update, or copy range within a transfer task.
+typedef struct iree_hal_cmd_transfer_op_t {
+  iree_hal_cmd_transfer_op_type_t type;
+  // Index of the first tile of the transfer task processing this operation.
+  uint32_t tile_base;
+  // Source buffer for copies; NULL for fills and updates.
+  iree_hal_buffer_t* source_buffer;
+  // Offset into |source_buffer| for copies and the offset of the inline update
+  // data from the start of the transfer command for updates.
+  iree_device_size_t source_offset;
+  iree_hal_buffer_t* target_buffer;
+  iree_device_size_t target_offset;
+  iree_device_size_t length;
+  uint32_t pattern_length;
+  uint8_t pattern[8];
+} iree_hal_cmd_transfer_op_t;
+
+// A transfer operation recorded but not yet emitted into the DAG.
+typedef struct iree_hal_task_pending_transfer_t {
+  iree_hal_cmd_transfer_op_t op;
+  // Update source data copied into the arena; only valid for updates.
+  const uint8_t* update_data;
+  // Barrier epoch the operation was recorded in. Operations with differing
+  // epochs were separated by an elided barrier.
+  uint32_t epoch;
+} iree_hal_task_pending_transfer_t;
+
+typedef struct iree_hal_cmd_dispatch_t iree_hal_cmd_dispatch_t;
+
+// Returns true if |task| is an executable dispatch command.
+static bool iree_hal_cmd_dispatch_isa(const iree_task_t* task);
+
+// Appends the dispatch |cmd| to the |profiler| capture.
+static iree_status_t iree_hal_cmd_dispatch_profile(
+    iree_hal_cmd_dispatch_t* cmd, iree_hal_task_profiler_t* profiler);
+
+// Appends |head| and all dispatches linked after it to the |profiler| capture.
+static iree_status_t iree_hal_cmd_dispatch_profile_list(
+    iree_hal_cmd_dispatch_t* head, iree_hal_task_profiler_t* profiler);
+
+// A dispatch binding that is resolved from the binding table at issue time.
+typedef struct iree_hal_task_binding_fixup_t {
+  struct iree_hal_task_binding_fixup_t* next;
+  // Locations of the binding pointer and length in the dispatch command.
+  // Absolute addresses while recording and offsets from the start of the
+  // template storage once packed into a template.
+  uintptr_t binding_ptr;
+  uintptr_t binding_length;
+  // The pushed binding referencing the binding table slot.
+  iree_hal_descriptor_set_binding_t binding;
+} iree_hal_task_binding_fixup_t;
+
+// A record of command storage allocated while recording a reusable command
+// buffer. Each record is either a task (and any trailing command data) or an
+// array of task pointers referenced by a barrier.
+typedef struct iree_hal_task_cmd_record_t {
+  struct iree_hal_task_cmd_record_t* next;
+  // Storage in the command buffer arena.
+  uint8_t* storage;
+  iree_host_size_t storage_size;
+  // True if |storage| begins with an iree_task_t and otherwise it is an array
+  // of iree_task_t pointers.
+  bool is_task;
+  // Offset of the record within the template storage once packed.
+  iree_host_size_t template_offset;
+} iree_hal_task_cmd_record_t;
+
+// Immutable task DAG template of a reusable command buffer.
+// The template storage contains all tasks as they were recorded but with all
+// pointers between them replaced with offsets from the start of the storage.
+// Issuing copies the storage, adds the base address of the copy to each slot
+// listed in |relocations|, and then links the leaf tasks to the retire task.
+// As the template tasks are never executed their dependency counts are the
+// pristine values from recording and can be copied as-is.
+typedef struct iree_hal_task_command_buffer_template_t {
+  // Total size of |storage| in bytes.
+  iree_host_size_t storage_size;
+  uint8_t* storage;
+
+  // Offsets of pointer-sized slots in |storage| holding template offsets.
+  iree_host_size_t relocation_count;
+  iree_host_size_t* relocations;
+
+  // Offsets of the tasks that are ready to execute immediately.
+  iree_host_size_t root_count;
+  iree_host_size_t* root_offsets;
+
+  // Offsets of the tasks that must complete before the command buffer has.
+  iree_host_size_t leaf_count;
+  iree_host_size_t* leaf_offsets;
+
+  // Dispatch bindings resolved from the binding table on each issue.
+  iree_host_size_t binding_fixup_count;
+  iree_hal_task_binding_fixup_t* binding_fixups;
+
+  // Offsets of the executable dispatch commands appended to the profiler
+  // capture on each issue while profiling.
+  iree_host_size_t dispatch_count;
+  iree_host_size_t* dispatch_offsets;
+} iree_hal_task_command_buffer_template_t;
+
 typedef struct iree_hal_task_command_buffer_t {
   iree_hal_command_buffer_t base;
   iree_allocator_t host_allocator;
@@ -61,6 +194,22 @@ typedef struct iree_hal_task_command_buffer_t {
   // An empty list indicates that root_tasks are also the leaves.
   iree_task_list_t leaf_tasks;
 
+  // Task DAG template built when recording ends for reusable command buffers.
+  // Allocated from the host allocator and NULL for one-shot command buffers.
+  iree_hal_task_command_buffer_template_t* dag_template;
+
+  // Dispatch bindings referencing binding table slots in recording order.
+  // Allocated from the arena and moved into the template for reusable command
+  // buffers.
+  iree_hal_task_binding_fixup_t* binding_fixup_head;
+  iree_hal_task_binding_fixup_t* binding_fixup_tail;
+  iree_host_size_t binding_fixup_count;
+
+  // Executable dispatches recorded into one-shot command buffers in recording
+  // order. Reusable command buffers track their dispatches in the template.
+  iree_hal_cmd_dispatch_t* dispatch_head;
+  iree_hal_cmd_dispatch_t* dispatch_tail;
+
   // TODO(benvanik): move this out of the struct and allocate from the arena -
   // we only need this during recording and it's ~4KB of waste otherwise.
   // State tracked within the command buffer during recording only.
@@ -80,6 +229,24 @@ typedef struct iree_hal_task_command_buffer_t {
     // All execution tasks emitted that must execute after |open_barrier|.
     iree_task_list_t open_tasks;
 
+    // True if the open scope contains tasks with unknown memory access (such
+    // as dispatches) and barriers closing it cannot be elided.
+    bool has_opaque_tasks;
+
+    // True if a barrier closing the open scope was elided and must be emitted
+    // if any subsequent command conflicts with the batched transfers.
+    bool barrier_pending;
+
+    // Incremented each time a barrier is elided. Reset when a barrier is
+    // emitted.
+    uint32_t barrier_epoch;
+
+    // Transfers recorded since the last emitted barrier that will be flushed as
+    // a single transfer task.
+    iree_host_size_t transfer_count;
+    iree_host_size_t transfer_data_size;
+    iree_hal_task_pending_transfer_t transfers[IREE_HAL_CMD_TRANSFER_MAX_OPS];
+
     // A flattened list of all available descriptor set bindings.
     // As descriptor sets are pushed/bound the bindings will be updated to
     // represent the fully-translated binding data pointer.
@@ -91,10 +258,25 @@ typedef struct iree_hal_task_command_buffer_t {
         binding_lengths[IREE_HAL_LOCAL_MAX_DESCRIPTOR_SET_COUNT *
                         IREE_HAL_LOCAL_MAX_DESCRIPTOR_BINDING_COUNT];
 
+    // Bindings referencing binding table slots that are resolved at issue.
+    // Only valid for ordinals with |binding_is_slot| set.
+    bool binding_is_slot[IREE_HAL_LOCAL_MAX_DESCRIPTOR_SET_COUNT *
+                         IREE_HAL_LOCAL_MAX_DESCRIPTOR_BINDING_COUNT];
+    iree_hal_descriptor_set_binding_t
+        slot_bindings[IREE_HAL_LOCAL_MAX_DESCRIPTOR_SET_COUNT *
+                      IREE_HAL_LOCAL_MAX_DESCRIPTOR_BINDING_COUNT];
+
     // All available push constants updated each time push_constants is called.
     // Reset only with the command buffer and otherwise will maintain its values
     // during recording to allow for partial push_constants updates.
     uint32_t push_constants[IREE_HAL_LOCAL_MAX_PUSH_CONSTANT_COUNT];
+
+    // All command storage allocated during recording in recording order.
+    // Only tracked for reusable command buffers so that the storage can be
+    // packed into the task DAG template.
+    iree_hal_task_cmd_record_t* record_head;
+    iree_hal_task_cmd_record_t* record_tail;
+    iree_host_size_t record_count;
   } state;
 } iree_hal_task_command_buffer_t;
 
@@ -111,25 +293,11 @@ iree_status_t iree_hal_task_command_buffer_create(
     iree_hal_device_t* device, iree_task_scope_t* scope,
     iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_arena_block_pool_t* block_pool, iree_allocator_t host_allocator,
     iree_hal_command_buffer_t** out_command_buffer) {
   IREE_ASSERT_ARGUMENT(out_command_buffer);
   *out_command_buffer = NULL;
-  if (!iree_all_bits_set(mode, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT)) {
-    // If we want reuse we'd need to support duplicating the task DAG after
-    // recording or have some kind of copy-on-submit behavior that does so if
-    // a command buffer is submitted for execution twice. Allowing for the same
-    // command buffer to be enqueued multiple times would be fine so long as
-    // execution doesn't overlap (`cmdbuf|cmdbuf` vs
-    // `cmdbuf -> semaphore -> cmdbuf`) though we'd still need to be careful
-    // that we did the enqueuing and reset of the task structures at the right
-    // times. Definitely something that'll be useful in the future... but not
-    // today :)
-    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                            "only one-shot command buffer usage is supported");
-  }
-
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_task_command_buffer_t* command_buffer = NULL;
@@ -137,13 +305,19 @@ iree_status_t iree_hal_task_command_buffer_create(
       host_allocator, sizeof(*command_buffer), (void**)&command_buffer);
   if (iree_status_is_ok(status)) {
     iree_hal_command_buffer_initialize(
-        device, mode, command_categories, queue_affinity,
+        device, mode, command_categories, queue_affinity, binding_capacity,
         &iree_hal_task_command_buffer_vtable, &command_buffer->base);
     command_buffer->host_allocator = host_allocator;
     command_buffer->scope = scope;
     iree_arena_initialize(block_pool, &command_buffer->arena);
     iree_task_list_initialize(&command_buffer->root_tasks);
     iree_task_list_initialize(&command_buffer->leaf_tasks);
+    command_buffer->dag_template = NULL;
+    command_buffer->binding_fixup_head = NULL;
+    command_buffer->binding_fixup_tail = NULL;
+    command_buffer->binding_fixup_count = 0;
+    command_buffer->dispatch_head = NULL;
+    command_buffer->dispatch_tail = NULL;
     memset(&command_buffer->state, 0, sizeof(command_buffer->state));
     status = iree_hal_resource_set_allocate(block_pool,
                                             &command_buffer->resource_set);
@@ -168,6 +342,7 @@ static void iree_hal_task_command_buffer_destroy(
   memset(&command_buffer->state, 0, sizeof(command_buffer->state));
   iree_task_list_discard(&command_buffer->leaf_tasks);
   iree_task_list_discard(&command_buffer->root_tasks);
+  iree_allocator_free(host_allocator, command_buffer->dag_template);
   iree_arena_deinitialize(&command_buffer->arena);
   iree_hal_resource_set_free(command_buffer->resource_set);
   iree_allocator_free(host_allocator, command_buffer);
@@ -196,12 +371,49 @@ static void* iree_hal_task_command_buffer_dyn_cast(
 
 static iree_status_t iree_hal_task_command_buffer_flush_tasks(
     iree_hal_task_command_buffer_t* command_buffer);
+static iree_status_t iree_hal_task_command_buffer_flush_transfers(
+    iree_hal_task_command_buffer_t* command_buffer);
+static iree_status_t iree_hal_task_command_buffer_build_template(
+    iree_hal_task_command_buffer_t* command_buffer);
+
+// Allocates |storage_size| bytes of command storage from the command buffer
+// arena. Reusable command buffers also record the allocation so that it can be
+// packed into the task DAG template when recording ends. |is_task| indicates
+// whether the storage begins with an iree_task_t or is an array of task
+// pointers.
+static iree_status_t iree_hal_task_command_buffer_allocate_cmd(
+    iree_hal_task_command_buffer_t* command_buffer,
+    iree_host_size_t storage_size, bool is_task, void** out_storage) {
+  IREE_RETURN_IF_ERROR(
+      iree_arena_allocate(&command_buffer->arena, storage_size, out_storage));
+  if (iree_all_bits_set(iree_hal_command_buffer_mode(&command_buffer->base),
+                        IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT)) {
+    return iree_ok_status();
+  }
+  iree_hal_task_cmd_record_t* record = NULL;
+  IREE_RETURN_IF_ERROR(iree_arena_allocate(&command_buffer->arena,
+                                           sizeof(*record), (void**)&record));
+  record->next = NULL;
+  record->storage = (uint8_t*)*out_storage;
+  record->storage_size = storage_size;
+  record->is_task = is_task;
+  record->template_offset = 0;
+  if (command_buffer->state.record_tail) {
+    command_buffer->state.record_tail->next = record;
+  } else {
+    command_buffer->state.record_head = record;
+  }
+  command_buffer->state.record_tail = record;
+  ++command_buffer->state.record_count;
+  return iree_ok_status();
+}
 
 static iree_status_t iree_hal_task_command_buffer_begin(
     iree_hal_command_buffer_t* base_command_buffer) {
   iree_hal_task_command_buffer_t* command_buffer =
       iree_hal_task_command_buffer_cast(base_command_buffer);
-  if (!iree_task_list_is_empty(&command_buffer->root_tasks)) {
+  if (!iree_task_list_is_empty(&command_buffer->root_tasks) ||
+      command_buffer->dag_template) {
     return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
                             "command buffer cannot be re-recorded");
   }
@@ -213,7 +425,10 @@ static iree_status_t iree_hal_task_command_buffer_end(
   iree_hal_task_command_buffer_t* command_buffer =
       iree_hal_task_command_buffer_cast(base_command_buffer);
 
-  // Flush any open barriers.
+  // Flush any batched transfers and open barriers. A trailing elided barrier
+  // is dropped as the command buffer completes only once all leaves have.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_command_buffer_flush_transfers(command_buffer));
   IREE_RETURN_IF_ERROR(
       iree_hal_task_command_buffer_flush_tasks(command_buffer));
 
@@ -225,6 +440,14 @@ static iree_status_t iree_hal_task_command_buffer_end(
                         &command_buffer->root_tasks);
   }
 
+  // Reusable command buffers pack the recorded DAG into a template that is
+  // cloned on each issue.
+  if (!iree_all_bits_set(iree_hal_command_buffer_mode(&command_buffer->base),
+                         IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT)) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_task_command_buffer_build_template(command_buffer));
+  }
+
   return iree_ok_status();
 }
 
@@ -252,9 +475,9 @@ static iree_status_t iree_hal_task_command_buffer_flush_tasks(
       // Since we couldn't know at the time how many tasks would end up in the
       // barrier we had to defer it until now.
       iree_task_t** dependent_tasks = NULL;
-      IREE_RETURN_IF_ERROR(iree_arena_allocate(
-          &command_buffer->arena, dependent_task_count * sizeof(iree_task_t*),
-          (void**)&dependent_tasks));
+      IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_cmd(
+          command_buffer, dependent_task_count * sizeof(iree_task_t*),
+          /*is_task=*/false, (void**)&dependent_tasks));
       iree_task_t* task = task_head;
       for (iree_host_size_t i = 0; i < dependent_task_count; ++i) {
         dependent_tasks[i] = task;
@@ -284,6 +507,13 @@ static iree_status_t iree_hal_task_command_buffer_flush_tasks(
 // to build out the proper task graph.
 static iree_status_t iree_hal_task_command_buffer_emit_global_barrier(
     iree_hal_task_command_buffer_t* command_buffer) {
+  // Emit any batched transfers into the scope being closed.
+  IREE_RETURN_IF_ERROR(
+      iree_hal_task_command_buffer_flush_transfers(command_buffer));
+  command_buffer->state.has_opaque_tasks = false;
+  command_buffer->state.barrier_pending = false;
+  command_buffer->state.barrier_epoch = 0;
+
   // Flush open tasks to the previous barrier. This resets our state such that
   // we can assign the new open barrier and start recording tasks for it.
   // Previous tasks will be moved into the leaf_tasks list.
@@ -296,8 +526,8 @@ static iree_status_t iree_hal_task_command_buffer_emit_global_barrier(
   // it so we can setup the join from previous tasks (the first half of the
   // synchronization domain).
   iree_task_barrier_t* barrier = NULL;
-  IREE_RETURN_IF_ERROR(iree_arena_allocate(&command_buffer->arena,
-                                           sizeof(*barrier), (void**)&barrier));
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_cmd(
+      command_buffer, sizeof(*barrier), /*is_task=*/true, (void**)&barrier));
   iree_task_barrier_initialize_empty(command_buffer->scope, barrier);
 
   // If there were previous tasks then join them to the barrier.
@@ -327,9 +557,9 @@ static iree_status_t iree_hal_task_command_buffer_emit_global_barrier(
   return iree_ok_status();
 }
 
-// Emits a the given execution |task| into the current open synchronization
+// Appends the given execution |task| into the current open synchronization
 // scope (after state.open_barrier and before the next barrier).
-static iree_status_t iree_hal_task_command_buffer_emit_execution_task(
+static iree_status_t iree_hal_task_command_buffer_append_task(
     iree_hal_task_command_buffer_t* command_buffer, iree_task_t* task) {
   if (command_buffer->state.open_barrier == NULL) {
     // If there is no open barrier then we are at the head and going right into
@@ -343,19 +573,391 @@ static iree_status_t iree_hal_task_command_buffer_emit_execution_task(
   return iree_ok_status();
 }
 
+// Emits a the given execution |task| with unknown memory access into the
+// current open synchronization scope. Any elided barrier is emitted first as
+// the task may depend on any transfer recorded prior to it.
+static iree_status_t iree_hal_task_command_buffer_emit_execution_task(
+    iree_hal_task_command_buffer_t* command_buffer, iree_task_t* task) {
+  if (command_buffer->state.barrier_pending) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_task_command_buffer_emit_global_barrier(command_buffer));
+  }
+  command_buffer->state.has_opaque_tasks = true;
+  return iree_hal_task_command_buffer_append_task(command_buffer, task);
+}
+
+// Emits or elides a global barrier as requested by the command stream.
+// Barriers closing a scope containing only batched transfers are elided and
+// only emitted if a subsequent command conflicts with those transfers.
+static iree_status_t iree_hal_task_command_buffer_emit_requested_barrier(
+    iree_hal_task_command_buffer_t* command_buffer) {
+  if (command_buffer->state.transfer_count > 0 &&
+      !command_buffer->state.has_opaque_tasks) {
+    command_buffer->state.barrier_pending = true;
+    ++command_buffer->state.barrier_epoch;
+    return iree_ok_status();
+  }
+  return iree_hal_task_command_buffer_emit_global_barrier(command_buffer);
+}
+
+//===----------------------------------------------------------------------===//
+// iree_hal_task_command_buffer_template_t
+//===----------------------------------------------------------------------===//
+
+static int iree_hal_task_cmd_record_compare(const void* a, const void* b) {
+  const uint8_t* lhs = (*(const iree_hal_task_cmd_record_t* const*)a)->storage;
+  const uint8_t* rhs = (*(const iree_hal_task_cmd_record_t* const*)b)->storage;
+  return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+}
+
+// Returns the record in the address-sorted |records| containing |ptr| or NULL
+// if |ptr| does not point into any command storage.
+static const iree_hal_task_cmd_record_t* iree_hal_task_cmd_record_lookup(
+    iree_hal_task_cmd_record_t** records, iree_host_size_t record_count,
+    const void* ptr) {
+  const uint8_t* p = (const uint8_t*)ptr;
+  iree_host_size_t lo = 0;
+  iree_host_size_t hi = record_count;
+  while (lo < hi) {
+    iree_host_size_t mid = lo + (hi - lo) / 2;
+    const iree_hal_task_cmd_record_t* record = records[mid];
+    if (p < record->storage) {
+      hi = mid;
+    } else if (p >= record->storage + record->storage_size) {
+      lo = mid + 1;
+    } else {
+      return record;
+    }
+  }
+  return NULL;
+}
+
+// Translates the original pointer held in |slot| of a template record to an
+// offset within the template storage and records the relocation. Pointers to
+// anything other than command storage (or NULL) are left as-is.
+static void iree_hal_task_command_buffer_template_relocate(
+    iree_hal_task_command_buffer_template_t* dag_template,
+    iree_hal_task_cmd_record_t** records, iree_host_size_t record_count,
+    void** slot) {
+  const iree_hal_task_cmd_record_t* target =
+      iree_hal_task_cmd_record_lookup(records, record_count, *slot);
+  if (!target) return;
+  *(uintptr_t*)slot = target->template_offset +
+                      (uintptr_t)((uint8_t*)*slot - target->storage);
+  dag_template->relocations[dag_template->relocation_count++] =
+      (iree_host_size_t)((uint8_t*)slot - dag_template->storage);
+}
+
+// Returns the template offset of |ptr| into command storage recorded in the
+// address-sorted |records|.
+static iree_host_size_t iree_hal_task_command_buffer_template_offset(
+    iree_hal_task_cmd_record_t** records, iree_host_size_t record_count,
+    const void* ptr) {
+  const iree_hal_task_cmd_record_t* record =
+      iree_hal_task_cmd_record_lookup(records, record_count, ptr);
+  IREE_ASSERT(record);
+  return record->template_offset + ((const uint8_t*)ptr - record->storage);
+}
+
+// Packs all tasks recorded into |command_buffer| into an immutable template
+// that can be cloned for each issue. The recorded tasks are released once the
+// template has been built as they will never be executed directly.
+static iree_status_t iree_hal_task_command_buffer_build_template(
+    iree_hal_task_command_buffer_t* command_buffer) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  const iree_host_size_t record_count = command_buffer->state.record_count;
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, record_count);
+
+  // Assign each record its location in the template and count how many
+  // pointer slots may need relocation: tasks may have a completion task and
+  // closure/dependent task list pointers and arrays are all task pointers.
+  iree_host_size_t storage_size = 0;
+  iree_host_size_t max_relocation_count = 0;
+  iree_host_size_t dispatch_count = 0;
+  for (iree_hal_task_cmd_record_t* record = command_buffer->state.record_head;
+       record != NULL; record = record->next) {
+    record->template_offset = storage_size;
+    storage_size += iree_host_align(record->storage_size, iree_max_align_t);
+    max_relocation_count += record->is_task
+                                ? 2
+                                : record->storage_size / sizeof(iree_task_t*);
+    if (record->is_task &&
+        iree_hal_cmd_dispatch_isa((const iree_task_t*)record->storage)) {
+      ++dispatch_count;
+    }
+  }
+  iree_host_size_t root_count = 0;
+  for (iree_task_t* task = command_buffer->root_tasks.head; task != NULL;
+       task = task->next_task) {
+    ++root_count;
+  }
+  iree_task_list_t* leaf_list =
+      iree_task_list_is_empty(&command_buffer->leaf_tasks)
+          ? &command_buffer->root_tasks
+          : &command_buffer->leaf_tasks;
+  iree_host_size_t leaf_count = 0;
+  for (iree_task_t* task = leaf_list->head; task != NULL;
+       task = task->next_task) {
+    ++leaf_count;
+  }
+
+  // Allocate the template and its tables along with scratch space for the
+  // address-sorted record list in a single allocation.
+  iree_hal_task_command_buffer_template_t* dag_template = NULL;
+  const iree_host_size_t header_size =
+      iree_host_align(sizeof(*dag_template), iree_max_align_t);
+  const iree_host_size_t table_size =
+      (max_relocation_count + root_count + leaf_count + dispatch_count) *
+      sizeof(iree_host_size_t);
+  const iree_host_size_t binding_fixup_count =
+      command_buffer->binding_fixup_count;
+  const iree_host_size_t binding_fixups_size =
+      binding_fixup_count * sizeof(iree_hal_task_binding_fixup_t);
+  const iree_host_size_t records_size =
+      record_count * sizeof(iree_hal_task_cmd_record_t*);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(command_buffer->host_allocator,
+                                header_size + storage_size + table_size +
+                                    binding_fixups_size + records_size,
+                                (void**)&dag_template));
+  dag_template->storage_size = storage_size;
+  dag_template->storage = (uint8_t*)dag_template + header_size;
+  dag_template->relocation_count = 0;
+  dag_template->relocations =
+      (iree_host_size_t*)(dag_template->storage + storage_size);
+  dag_template->root_count = root_count;
+  dag_template->root_offsets =
+      dag_template->relocations + max_relocation_count;
+  dag_template->leaf_count = leaf_count;
+  dag_template->leaf_offsets = dag_template->root_offsets + root_count;
+  dag_template->dispatch_count = 0;
+  dag_template->dispatch_offsets = dag_template->leaf_offsets + leaf_count;
+  dag_template->binding_fixup_count = binding_fixup_count;
+  dag_template->binding_fixups =
+      (iree_hal_task_binding_fixup_t*)(dag_template->dispatch_offsets +
+                                       dispatch_count);
+  iree_hal_task_cmd_record_t** records =
+      (iree_hal_task_cmd_record_t**)(dag_template->binding_fixups +
+                                     binding_fixup_count);
+
+  // Sort the records by address so that pointers can be mapped back to them.
+  iree_host_size_t record_index = 0;
+  for (iree_hal_task_cmd_record_t* record = command_buffer->state.record_head;
+       record != NULL; record = record->next) {
+    records[record_index++] = record;
+  }
+  qsort(records, record_count, sizeof(records[0]),
+        iree_hal_task_cmd_record_compare);
+
+  // Copy all storage into the template and replace internal pointers with
+  // offsets.
+  for (iree_hal_task_cmd_record_t* record = command_buffer->state.record_head;
+       record != NULL; record = record->next) {
+    uint8_t* storage = dag_template->storage + record->template_offset;
+    memcpy(storage, record->storage, record->storage_size);
+    if (!record->is_task) {
+      void** tasks = (void**)storage;
+      for (iree_host_size_t i = 0;
+           i < record->storage_size / sizeof(iree_task_t*); ++i) {
+        iree_hal_task_command_buffer_template_relocate(
+            dag_template, records, record_count, &tasks[i]);
+      }
+      continue;
+    }
+    iree_task_t* task = (iree_task_t*)storage;
+    // Task list links are only meaningful during recording; issues build
+    // their own lists from the root/leaf tables.
+    task->next_task = NULL;
+    iree_hal_task_command_buffer_template_relocate(
+        dag_template, records, record_count, (void**)&task->completion_task);
+    switch (task->type) {
+      case IREE_TASK_TYPE_CALL:
+        iree_hal_task_command_buffer_template_relocate(
+            dag_template, records, record_count,
+            &((iree_task_call_t*)task)->closure.user_context);
+        break;
+      case IREE_TASK_TYPE_BARRIER:
+        iree_hal_task_command_buffer_template_relocate(
+            dag_template, records, record_count,
+            (void**)&((iree_task_barrier_t*)task)->dependent_tasks);
+        break;
+      case IREE_TASK_TYPE_DISPATCH:
+        iree_hal_task_command_buffer_template_relocate(
+            dag_template, records, record_count,
+            &((iree_task_dispatch_t*)task)->closure.user_context);
+        if (iree_hal_cmd_dispatch_isa(task)) {
+          dag_template->dispatch_offsets[dag_template->dispatch_count++] =
+              record->template_offset;
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  iree_host_size_t root_index = 0;
+  for (iree_task_t* task = command_buffer->root_tasks.head; task != NULL;
+       task = task->next_task) {
+    dag_template->root_offsets[root_index++] =
+        iree_hal_task_command_buffer_template_offset(records, record_count,
+                                                     task);
+  }
+  iree_host_size_t leaf_index = 0;
+  for (iree_task_t* task = leaf_list->head; task != NULL;
+       task = task->next_task) {
+    dag_template->leaf_offsets[leaf_index++] =
+        iree_hal_task_command_buffer_template_offset(records, record_count,
+                                                     task);
+  }
+
+  // Binding fixups reference the dispatch storage by offset in the template.
+  iree_host_size_t binding_fixup_index = 0;
+  for (iree_hal_task_binding_fixup_t* fixup =
+           command_buffer->binding_fixup_head;
+       fixup != NULL; fixup = fixup->next) {
+    iree_hal_task_binding_fixup_t* packed_fixup =
+        &dag_template->binding_fixups[binding_fixup_index++];
+    packed_fixup->next = NULL;
+    packed_fixup->binding_ptr = iree_hal_task_command_buffer_template_offset(
+        records, record_count, (const void*)fixup->binding_ptr);
+    packed_fixup->binding_length = iree_hal_task_command_buffer_template_offset(
+        records, record_count, (const void*)fixup->binding_length);
+    packed_fixup->binding = fixup->binding;
+  }
+  command_buffer->binding_fixup_head = NULL;
+  command_buffer->binding_fixup_tail = NULL;
+  command_buffer->binding_fixup_count = 0;
+
+  // The recorded tasks have been copied and are never executed. The lists are
+  // dropped without discarding as they were never part of any submission.
+  iree_task_list_initialize(&command_buffer->root_tasks);
+  iree_task_list_initialize(&command_buffer->leaf_tasks);
+  command_buffer->state.record_head = NULL;
+  command_buffer->state.record_tail = NULL;
+  command_buffer->state.record_count = 0;
+  iree_arena_reset(&command_buffer->arena);
+
+  command_buffer->dag_template = dag_template;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+// Resolves the binding table slot referenced by |fixup| from |binding_table|
+// and stores the mapped binding in the dispatch command located at |base| plus
+// the fixup offsets. |base| is NULL when the fixup holds absolute addresses.
+static iree_status_t iree_hal_task_binding_fixup_apply(
+    const iree_hal_task_binding_fixup_t* fixup, uint8_t* base,
+    iree_hal_buffer_binding_table_t binding_table) {
+  iree_hal_descriptor_set_binding_t binding;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_binding_table_resolve(
+      binding_table, &fixup->binding, &binding));
+  // The binding table buffers are retained by the queue for the lifetime of
+  // the submission.
+  iree_hal_buffer_mapping_t buffer_mapping = {{0}};
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_map_range(
+      binding.buffer, IREE_HAL_MAPPING_MODE_PERSISTENT,
+      IREE_HAL_MEMORY_ACCESS_ANY, binding.offset, binding.length,
+      &buffer_mapping));
+  *(void**)(base + fixup->binding_ptr) = buffer_mapping.contents.data;
+  *(size_t*)(base + fixup->binding_length) =
+      (size_t)buffer_mapping.contents.data_length;
+  return iree_ok_status();
+}
+
+// Issues a clone of the reusable |dag_template| with all task memory allocated
+// from |arena|. Bindings referencing |binding_table| slots are resolved into
+// the clone and when |profiler| is provided the cloned dispatches are
+// appended to its capture.
+static iree_status_t iree_hal_task_command_buffer_issue_template(
+    const iree_hal_task_command_buffer_template_t* dag_template,
+    iree_hal_buffer_binding_table_t binding_table,
+    iree_hal_task_profiler_t* profiler, iree_task_t* retire_task,
+    iree_arena_allocator_t* arena, iree_task_submission_t* pending_submission) {
+  if (dag_template->root_count == 0) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, dag_template->storage_size);
+
+  // Oversized arena allocations are not guaranteed to have the alignment
+  // required by tasks so we align manually.
+  uint8_t* base = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_arena_allocate(arena,
+                              dag_template->storage_size + iree_max_align_t,
+                              (void**)&base));
+  base = (uint8_t*)iree_host_align((uintptr_t)base, iree_max_align_t);
+  memcpy(base, dag_template->storage, dag_template->storage_size);
+  for (iree_host_size_t i = 0; i < dag_template->relocation_count; ++i) {
+    *(uintptr_t*)(base + dag_template->relocations[i]) += (uintptr_t)base;
+  }
+  for (iree_host_size_t i = 0; i < dag_template->binding_fixup_count; ++i) {
+    IREE_RETURN_AND_END_ZONE_IF_ERROR(
+        z0, iree_hal_task_binding_fixup_apply(&dag_template->binding_fixups[i],
+                                              base, binding_table));
+  }
+  if (profiler) {
+    for (iree_host_size_t i = 0; i < dag_template->dispatch_count; ++i) {
+      IREE_RETURN_AND_END_ZONE_IF_ERROR(
+          z0, iree_hal_cmd_dispatch_profile(
+                  (iree_hal_cmd_dispatch_t*)(base +
+                                             dag_template->dispatch_offsets[i]),
+                  profiler));
+    }
+  }
+
+  // Chain the retire task onto the leaf tasks as their completion indicates
+  // that all commands have completed.
+  for (iree_host_size_t i = 0; i < dag_template->leaf_count; ++i) {
+    iree_task_set_completion_task(
+        (iree_task_t*)(base + dag_template->leaf_offsets[i]), retire_task);
+  }
+
+  // Enqueue all root tasks that are ready to run immediately.
+  for (iree_host_size_t i = 0; i < dag_template->root_count; ++i) {
+    iree_task_submission_enqueue(
+        pending_submission,
+        (iree_task_t*)(base + dag_template->root_offsets[i]));
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
 //===----------------------------------------------------------------------===//
 // iree_hal_task_command_buffer_t execution
 //===----------------------------------------------------------------------===//
 
 iree_status_t iree_hal_task_command_buffer_issue(
     iree_hal_command_buffer_t* base_command_buffer,
-    iree_hal_task_queue_state_t* queue_state, iree_task_t* retire_task,
+    iree_hal_task_queue_state_t* queue_state,
+    iree_hal_buffer_binding_table_t binding_table,
+    iree_hal_task_profiler_t* profiler, iree_task_t* retire_task,
     iree_arena_allocator_t* arena, iree_task_submission_t* pending_submission) {
   iree_hal_task_command_buffer_t* command_buffer =
       iree_hal_command_buffer_dyn_cast(base_command_buffer,
                                        &iree_hal_task_command_buffer_vtable);
   IREE_ASSERT_TRUE(command_buffer);
 
+  // Reusable command buffers leave their template untouched and issue a copy.
+  if (command_buffer->dag_template) {
+    return iree_hal_task_command_buffer_issue_template(
+        command_buffer->dag_template, binding_table, profiler, retire_task,
+        arena, pending_submission);
+  }
+
+  // One-shot command buffers are only issued once and can have their bindings
+  // resolved in-place.
+  for (iree_hal_task_binding_fixup_t* fixup =
+           command_buffer->binding_fixup_head;
+       fixup != NULL; fixup = fixup->next) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_task_binding_fixup_apply(fixup, NULL, binding_table));
+  }
+  if (profiler) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_cmd_dispatch_profile_list(command_buffer->dispatch_head,
+                                           profiler));
+  }
+
   // If the command buffer is empty (valid!) then we are a no-op.
   bool has_root_tasks = !iree_task_list_is_empty(&command_buffer->root_tasks);
   if (!has_root_tasks) {
@@ -422,8 +1024,9 @@ static iree_status_t iree_hal_task_command_buffer_execution_barrier(
       iree_hal_task_command_buffer_cast(base_command_buffer);
 
   // TODO(benvanik): actual DAG construction. Right now we are just doing simple
-  // global barriers each time and forcing a join-fork point.
-  return iree_hal_task_command_buffer_emit_global_barrier(command_buffer);
+  // global barriers each time (unless elided between independent transfers)
+  // and forcing a join-fork point.
+  return iree_hal_task_command_buffer_emit_requested_barrier(command_buffer);
 }
 
 //===----------------------------------------------------------------------===//
@@ -464,7 +1067,7 @@ static iree_status_t iree_hal_task_command_buffer_wait_events(
   iree_hal_task_command_buffer_t* command_buffer =
       iree_hal_task_command_buffer_cast(base_command_buffer);
   // TODO(#4518): implement events. For now we just insert global barriers.
-  return iree_hal_task_command_buffer_emit_global_barrier(command_buffer);
+  return iree_hal_task_command_buffer_emit_requested_barrier(command_buffer);
 }
 
 //===----------------------------------------------------------------------===//
@@ -477,112 +1080,262 @@ static iree_status_t iree_hal_task_command_buffer_discard_buffer(
 }
 
 //===----------------------------------------------------------------------===//
-// iree_hal_command_buffer_fill_buffer
+// iree_hal_cmd_transfer_t
 //===----------------------------------------------------------------------===//
-// NOTE: for large copies we dispatch this as tiles for parallelism.
+// NOTE: for large transfers we dispatch this as tiles for parallelism.
 // We'd want to do some measurement for when it's worth it; filling a 200KB
 // buffer: maybe not, filling a 200MB buffer: yeah. For now we just do
-// arbitrarily sized chunks.
+// arbitrarily sized chunks. Each operation batched into the transfer gets at
+// least one tile so that small independent transfers execute concurrently.
 
 // TODO(benvanik): make this a configurable setting. Must be aligned to pattern
 // length so pick a power of two.
-#define IREE_HAL_CMD_FILL_SLICE_LENGTH (128 * 1024)
+#define IREE_HAL_CMD_TRANSFER_SLICE_LENGTH (128 * 1024)
 
-typedef struct iree_hal_cmd_fill_buffer_t {
+typedef struct iree_hal_cmd_transfer_t {
   iree_task_dispatch_t task;
-  iree_hal_buffer_t* target_buffer;
-  iree_device_size_t target_offset;
-  iree_device_size_t length;
-  uint32_t pattern_length;
-  uint8_t pattern[8];
-} iree_hal_cmd_fill_buffer_t;
+  iree_host_size_t op_count;
+  // Operations sorted by tile_base. The inline data of update operations
+  // follows the operation list.
+  iree_hal_cmd_transfer_op_t ops[];
+} iree_hal_cmd_transfer_t;
+
+// Returns the number of tiles used to process a transfer of |length| bytes.
+static uint32_t iree_hal_cmd_transfer_tile_count(iree_device_size_t length) {
+  iree_device_size_t tile_count =
+      (length + IREE_HAL_CMD_TRANSFER_SLICE_LENGTH - 1) /
+      IREE_HAL_CMD_TRANSFER_SLICE_LENGTH;
+  return tile_count > 0 ? (uint32_t)tile_count : 1;
+}
 
-static iree_status_t iree_hal_cmd_fill_tile(
+static iree_status_t iree_hal_cmd_transfer_tile(
     void* user_context, const iree_task_tile_context_t* tile_context,
     iree_task_submission_t* pending_submission) {
-  const iree_hal_cmd_fill_buffer_t* cmd =
-      (const iree_hal_cmd_fill_buffer_t*)user_context;
+  const iree_hal_cmd_transfer_t* cmd =
+      (const iree_hal_cmd_transfer_t*)user_context;
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  // Find the operation the tile belongs to.
+  const uint32_t tile_index = tile_context->workgroup_xyz[0];
+  iree_host_size_t lo = 0;
+  iree_host_size_t hi = cmd->op_count - 1;
+  while (lo < hi) {
+    iree_host_size_t mid = lo + (hi - lo + 1) / 2;
+    if (cmd->ops[mid].tile_base <= tile_index) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  const iree_hal_cmd_transfer_op_t* op = &cmd->ops[lo];
+
   uint32_t length_per_slice = tile_context->workgroup_size[0];
   iree_device_size_t slice_offset =
-      tile_context->workgroup_xyz[0] * length_per_slice;
-  iree_device_size_t remaining_length = cmd->length - slice_offset;
+      (iree_device_size_t)(tile_index - op->tile_base) * length_per_slice;
+  iree_device_size_t remaining_length = op->length - slice_offset;
   iree_device_size_t slice_length =
       iree_min(length_per_slice, remaining_length);
   IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)slice_length);
 
-  iree_status_t status = iree_hal_buffer_map_fill(
-      cmd->target_buffer, cmd->target_offset + slice_offset, slice_length,
-      cmd->pattern, cmd->pattern_length);
+  iree_status_t status = iree_ok_status();
+  switch (op->type) {
+    case IREE_HAL_CMD_TRANSFER_OP_FILL:
+      status = iree_hal_buffer_map_fill(
+          op->target_buffer, op->target_offset + slice_offset, slice_length,
+          op->pattern, op->pattern_length);
+      break;
+    case IREE_HAL_CMD_TRANSFER_OP_UPDATE:
+      status = iree_hal_buffer_map_write(
+          op->target_buffer, op->target_offset + slice_offset,
+          (const uint8_t*)cmd + op->source_offset + slice_offset,
+          slice_length);
+      break;
+    case IREE_HAL_CMD_TRANSFER_OP_COPY:
+      status = iree_hal_buffer_map_copy(
+          op->source_buffer, op->source_offset + slice_offset,
+          op->target_buffer, op->target_offset + slice_offset, slice_length);
+      break;
+    default:
+      status = iree_make_status(IREE_STATUS_INTERNAL,
+                                "unhandled transfer operation type %d",
+                                (int)op->type);
+      break;
+  }
 
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
 
-static iree_status_t iree_hal_task_command_buffer_fill_buffer(
-    iree_hal_command_buffer_t* base_command_buffer,
-    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
-    iree_device_size_t length, const void* pattern,
-    iree_host_size_t pattern_length) {
-  iree_hal_task_command_buffer_t* command_buffer =
-      iree_hal_task_command_buffer_cast(base_command_buffer);
-
-  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
-      command_buffer->resource_set, 1, &target_buffer));
-
-  iree_hal_cmd_fill_buffer_t* cmd = NULL;
-  IREE_RETURN_IF_ERROR(
-      iree_arena_allocate(&command_buffer->arena, sizeof(*cmd), (void**)&cmd));
+// Emits all batched transfers as a single transfer task into the open scope.
+static iree_status_t iree_hal_task_command_buffer_flush_transfers(
+    iree_hal_task_command_buffer_t* command_buffer) {
+  iree_host_size_t op_count = command_buffer->state.transfer_count;
+  if (op_count == 0) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)op_count);
+
+  iree_host_size_t data_offset = sizeof(iree_hal_cmd_transfer_t) +
+                                 op_count * sizeof(iree_hal_cmd_transfer_op_t);
+  iree_hal_cmd_transfer_t* cmd = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_task_command_buffer_allocate_cmd(
+              command_buffer,
+              data_offset + command_buffer->state.transfer_data_size,
+              /*is_task=*/true, (void**)&cmd));
+
+  uint32_t tile_count = 0;
+  for (iree_host_size_t i = 0; i < op_count; ++i) {
+    const iree_hal_task_pending_transfer_t* pending =
+        &command_buffer->state.transfers[i];
+    iree_hal_cmd_transfer_op_t* op = &cmd->ops[i];
+    *op = pending->op;
+    op->tile_base = tile_count;
+    tile_count += iree_hal_cmd_transfer_tile_count(op->length);
+    if (op->type == IREE_HAL_CMD_TRANSFER_OP_UPDATE) {
+      memcpy((uint8_t*)cmd + data_offset, pending->update_data,
+             (iree_host_size_t)op->length);
+      op->source_offset = data_offset;
+      data_offset += (iree_host_size_t)op->length;
+    }
+  }
+  cmd->op_count = op_count;
 
   const uint32_t workgroup_size[3] = {
-      /*x=*/IREE_HAL_CMD_FILL_SLICE_LENGTH,
+      /*x=*/IREE_HAL_CMD_TRANSFER_SLICE_LENGTH,
       /*y=*/1,
       /*z=*/1,
   };
   const uint32_t workgroup_count[3] = {
-      /*x=*/length / workgroup_size[0] + 1,
+      /*x=*/tile_count,
       /*y=*/1,
       /*z=*/1,
   };
   iree_task_dispatch_initialize(
       command_buffer->scope,
-      iree_task_make_dispatch_closure(iree_hal_cmd_fill_tile, (void*)cmd),
+      iree_task_make_dispatch_closure(iree_hal_cmd_transfer_tile, (void*)cmd),
       workgroup_size, workgroup_count, &cmd->task);
-  cmd->target_buffer = target_buffer;
-  cmd->target_offset = target_offset;
-  cmd->length = length;
-  memcpy(cmd->pattern, pattern, pattern_length);
-  cmd->pattern_length = pattern_length;
 
-  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
-                                                          &cmd->task.header);
+  command_buffer->state.transfer_count = 0;
+  command_buffer->state.transfer_data_size = 0;
+
+  iree_status_t status = iree_hal_task_command_buffer_append_task(
+      command_buffer, &cmd->task.header);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Returns true if |a| and |b| access overlapping ranges and at least one of
+// them writes to the overlapping range.
+static bool iree_hal_cmd_transfer_ops_conflict(
+    const iree_hal_cmd_transfer_op_t* a, const iree_hal_cmd_transfer_op_t* b) {
+  if (iree_hal_buffer_test_overlap(a->target_buffer, a->target_offset,
+                                   a->length, b->target_buffer,
+                                   b->target_offset, b->length) !=
+      IREE_HAL_BUFFER_OVERLAP_DISJOINT) {
+    return true;
+  }
+  if (a->source_buffer &&
+      iree_hal_buffer_test_overlap(a->source_buffer, a->source_offset,
+                                   a->length, b->target_buffer,
+                                   b->target_offset, b->length) !=
+          IREE_HAL_BUFFER_OVERLAP_DISJOINT) {
+    return true;
+  }
+  if (b->source_buffer &&
+      iree_hal_buffer_test_overlap(a->target_buffer, a->target_offset,
+                                   a->length, b->source_buffer,
+                                   b->source_offset, b->length) !=
+          IREE_HAL_BUFFER_OVERLAP_DISJOINT) {
+    return true;
+  }
+  return false;
+}
+
+// Records a transfer |op| into the pending transfer batch. |update_data| is
+// copied when |op| is an update.
+static iree_status_t iree_hal_task_command_buffer_record_transfer(
+    iree_hal_task_command_buffer_t* command_buffer,
+    const iree_hal_cmd_transfer_op_t* op, const void* update_data) {
+  // If barriers were elided the new operation must be ordered after all
+  // operations recorded before them: if it conflicts with any of those the
+  // barrier is emitted after all.
+  if (command_buffer->state.barrier_pending) {
+    bool any_conflict = false;
+    for (iree_host_size_t i = 0;
+         i < command_buffer->state.transfer_count && !any_conflict; ++i) {
+      const iree_hal_task_pending_transfer_t* pending =
+          &command_buffer->state.transfers[i];
+      any_conflict = pending->epoch != command_buffer->state.barrier_epoch &&
+                     iree_hal_cmd_transfer_ops_conflict(&pending->op, op);
+    }
+    if (any_conflict) {
+      IREE_RETURN_IF_ERROR(
+          iree_hal_task_command_buffer_emit_global_barrier(command_buffer));
+    }
+  }
+
+  // Flush the batch if it is full. If no barrier was elided the flushed task
+  // remains in the open scope and is no longer tracked so the barrier closing
+  // the scope can no longer be elided.
+  if (command_buffer->state.transfer_count == IREE_HAL_CMD_TRANSFER_MAX_OPS) {
+    if (command_buffer->state.barrier_pending) {
+      IREE_RETURN_IF_ERROR(
+          iree_hal_task_command_buffer_emit_global_barrier(command_buffer));
+    } else {
+      IREE_RETURN_IF_ERROR(
+          iree_hal_task_command_buffer_flush_transfers(command_buffer));
+      command_buffer->state.has_opaque_tasks = true;
+    }
+  }
+
+  iree_hal_task_pending_transfer_t* pending =
+      &command_buffer->state.transfers[command_buffer->state.transfer_count];
+  pending->op = *op;
+  pending->update_data = NULL;
+  pending->epoch = command_buffer->state.barrier_epoch;
+  if (op->type == IREE_HAL_CMD_TRANSFER_OP_UPDATE) {
+    uint8_t* data = NULL;
+    IREE_RETURN_IF_ERROR(iree_arena_allocate(
+        &command_buffer->arena, (iree_host_size_t)op->length, (void**)&data));
+    memcpy(data, update_data, (iree_host_size_t)op->length);
+    pending->update_data = data;
+    command_buffer->state.transfer_data_size += (iree_host_size_t)op->length;
+  }
+  ++command_buffer->state.transfer_count;
+  return iree_ok_status();
 }
 
 //===----------------------------------------------------------------------===//
-// iree_hal_command_buffer_update_buffer
+// iree_hal_command_buffer_fill_buffer
 //===----------------------------------------------------------------------===//
 
-typedef struct iree_hal_cmd_update_buffer_t {
-  iree_task_call_t task;
-  iree_hal_buffer_t* target_buffer;
-  iree_device_size_t target_offset;
-  iree_device_size_t length;
-  uint8_t source_buffer[];
-} iree_hal_cmd_update_buffer_t;
+static iree_status_t iree_hal_task_command_buffer_fill_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length, const void* pattern,
+    iree_host_size_t pattern_length) {
+  iree_hal_task_command_buffer_t* command_buffer =
+      iree_hal_task_command_buffer_cast(base_command_buffer);
 
-static iree_status_t iree_hal_cmd_update_buffer(
-    void* user_context, iree_task_t* task,
-    iree_task_submission_t* pending_submission) {
-  const iree_hal_cmd_update_buffer_t* cmd =
-      (const iree_hal_cmd_update_buffer_t*)user_context;
-  IREE_TRACE_ZONE_BEGIN(z0);
-  iree_status_t status = iree_hal_buffer_map_write(
-      cmd->target_buffer, cmd->target_offset, cmd->source_buffer, cmd->length);
-  IREE_TRACE_ZONE_END(z0);
-  return status;
+  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
+      command_buffer->resource_set, 1, &target_buffer));
+
+  iree_hal_cmd_transfer_op_t op;
+  memset(&op, 0, sizeof(op));
+  op.type = IREE_HAL_CMD_TRANSFER_OP_FILL;
+  op.target_buffer = target_buffer;
+  op.target_offset = target_offset;
+  op.length = length;
+  memcpy(op.pattern, pattern, pattern_length);
+  op.pattern_length = pattern_length;
+  return iree_hal_task_command_buffer_record_transfer(command_buffer, &op,
+                                                      NULL);
 }
 
+//===----------------------------------------------------------------------===//
+// iree_hal_command_buffer_update_buffer
+//===----------------------------------------------------------------------===//
+
 static iree_status_t iree_hal_task_command_buffer_update_buffer(
     iree_hal_command_buffer_t* base_command_buffer, const void* source_buffer,
     iree_host_size_t source_offset, iree_hal_buffer_t* target_buffer,
@@ -593,71 +1346,19 @@ static iree_status_t iree_hal_task_command_buffer_update_buffer(
   IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
       command_buffer->resource_set, 1, &target_buffer));
 
-  iree_host_size_t total_cmd_size =
-      sizeof(iree_hal_cmd_update_buffer_t) + length;
-
-  iree_hal_cmd_update_buffer_t* cmd = NULL;
-  IREE_RETURN_IF_ERROR(iree_arena_allocate(&command_buffer->arena,
-                                           total_cmd_size, (void**)&cmd));
-
-  iree_task_call_initialize(
-      command_buffer->scope,
-      iree_task_make_call_closure(iree_hal_cmd_update_buffer, (void*)cmd),
-      &cmd->task);
-  cmd->target_buffer = target_buffer;
-  cmd->target_offset = target_offset;
-  cmd->length = length;
-
-  memcpy(cmd->source_buffer, (const uint8_t*)source_buffer + source_offset,
-         cmd->length);
-
-  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
-                                                          &cmd->task.header);
+  iree_hal_cmd_transfer_op_t op;
+  memset(&op, 0, sizeof(op));
+  op.type = IREE_HAL_CMD_TRANSFER_OP_UPDATE;
+  op.target_buffer = target_buffer;
+  op.target_offset = target_offset;
+  op.length = length;
+  return iree_hal_task_command_buffer_record_transfer(
+      command_buffer, &op, (const uint8_t*)source_buffer + source_offset);
 }
 
 //===----------------------------------------------------------------------===//
 // iree_hal_command_buffer_copy_buffer
 //===----------------------------------------------------------------------===//
-// NOTE: for large copies we dispatch this as tiles for parallelism.
-// We'd want to do some measurement for when it's worth it; copying a 200KB
-// buffer: maybe not, copying a 200MB buffer: yeah. For now we just do
-// arbitrarily sized chunks.
-
-// TODO(benvanik): make this a configurable setting. Must be aligned to pattern
-// length so pick a power of two.
-#define IREE_HAL_CMD_COPY_SLICE_LENGTH (128 * 1024)
-
-typedef struct iree_hal_cmd_copy_buffer_t {
-  iree_task_dispatch_t task;
-  iree_hal_buffer_t* source_buffer;
-  iree_device_size_t source_offset;
-  iree_hal_buffer_t* target_buffer;
-  iree_device_size_t target_offset;
-  iree_device_size_t length;
-} iree_hal_cmd_copy_buffer_t;
-
-static iree_status_t iree_hal_cmd_copy_tile(
-    void* user_context, const iree_task_tile_context_t* tile_context,
-    iree_task_submission_t* pending_submission) {
-  const iree_hal_cmd_copy_buffer_t* cmd =
-      (const iree_hal_cmd_copy_buffer_t*)user_context;
-  IREE_TRACE_ZONE_BEGIN(z0);
-
-  uint32_t length_per_slice = tile_context->workgroup_size[0];
-  iree_device_size_t slice_offset =
-      tile_context->workgroup_xyz[0] * length_per_slice;
-  iree_device_size_t remaining_length = cmd->length - slice_offset;
-  iree_device_size_t slice_length =
-      iree_min(length_per_slice, remaining_length);
-  IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)slice_length);
-
-  iree_status_t status = iree_hal_buffer_map_copy(
-      cmd->source_buffer, cmd->source_offset + slice_offset, cmd->target_buffer,
-      cmd->target_offset + slice_offset, slice_length);
-
-  IREE_TRACE_ZONE_END(z0);
-  return status;
-}
 
 static iree_status_t iree_hal_task_command_buffer_copy_buffer(
     iree_hal_command_buffer_t* base_command_buffer,
@@ -671,32 +1372,16 @@ static iree_status_t iree_hal_task_command_buffer_copy_buffer(
   IREE_RETURN_IF_ERROR(
       iree_hal_resource_set_insert(command_buffer->resource_set, 2, buffers));
 
-  iree_hal_cmd_copy_buffer_t* cmd = NULL;
-  IREE_RETURN_IF_ERROR(
-      iree_arena_allocate(&command_buffer->arena, sizeof(*cmd), (void**)&cmd));
-
-  const uint32_t workgroup_size[3] = {
-      /*x=*/IREE_HAL_CMD_COPY_SLICE_LENGTH,
-      /*y=*/1,
-      /*z=*/1,
-  };
-  const uint32_t workgroup_count[3] = {
-      /*x=*/length / workgroup_size[0] + 1,
-      /*y=*/1,
-      /*z=*/1,
-  };
-  iree_task_dispatch_initialize(
-      command_buffer->scope,
-      iree_task_make_dispatch_closure(iree_hal_cmd_copy_tile, (void*)cmd),
-      workgroup_size, workgroup_count, &cmd->task);
-  cmd->source_buffer = source_buffer;
-  cmd->source_offset = source_offset;
-  cmd->target_buffer = target_buffer;
-  cmd->target_offset = target_offset;
-  cmd->length = length;
-
-  return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
-                                                          &cmd->task.header);
+  iree_hal_cmd_transfer_op_t op;
+  memset(&op, 0, sizeof(op));
+  op.type = IREE_HAL_CMD_TRANSFER_OP_COPY;
+  op.source_buffer = source_buffer;
+  op.source_offset = source_offset;
+  op.target_buffer = target_buffer;
+  op.target_offset = target_offset;
+  op.length = length;
+  return iree_hal_task_command_buffer_record_transfer(command_buffer, &op,
+                                                      NULL);
 }
 
 //===----------------------------------------------------------------------===//
@@ -752,6 +1437,18 @@ static iree_status_t iree_hal_task_command_buffer_push_descriptor_set(
     }
     iree_host_size_t binding_ordinal = binding_base + bindings[i].binding;
 
+    // Bindings without a buffer reference a binding table slot that is
+    // resolved when the command buffer is issued.
+    if (!bindings[i].buffer &&
+        iree_hal_command_buffer_binding_capacity(base_command_buffer) > 0) {
+      command_buffer->state.binding_is_slot[binding_ordinal] = true;
+      command_buffer->state.slot_bindings[binding_ordinal] = bindings[i];
+      command_buffer->state.bindings[binding_ordinal] = NULL;
+      command_buffer->state.binding_lengths[binding_ordinal] = 0;
+      continue;
+    }
+    command_buffer->state.binding_is_slot[binding_ordinal] = false;
+
     // TODO(benvanik): batch insert by getting the resources in their own list.
     IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
         command_buffer->resource_set, 1, &bindings[i].buffer));
@@ -795,6 +1492,9 @@ typedef struct iree_hal_cmd_dispatch_t {
   iree_hal_local_executable_t* executable;
   int32_t ordinal;
 
+  // Next dispatch recorded into a one-shot command buffer or NULL.
+  struct iree_hal_cmd_dispatch_t* next_dispatch;
+
   // Total number of available 4 byte push constant values in |push_constants|.
   uint16_t push_constant_count;
 
@@ -809,6 +1509,36 @@ typedef struct iree_hal_cmd_dispatch_t {
   // - const size_t binding_lengths[binding_count];
 } iree_hal_cmd_dispatch_t;
 
+// Populates the |out_dispatch_state| shared by all workgroups of |cmd|.
+static void iree_hal_cmd_dispatch_initialize_state(
+    const iree_hal_cmd_dispatch_t* cmd,
+    const iree_task_tile_context_t* tile_context,
+    iree_hal_executable_dispatch_state_v0_t* out_dispatch_state) {
+  // We could share this across all workgroups in a dispatch and reduce cache
+  // pressure as all cores would be hitting the same hot read-only cache line.
+  // It'd grow the size of iree_hal_cmd_dispatch_t by a few dozen bytes, though,
+  // and so we'd need some profiling to see if it's worth it (fixed command
+  // buffer cost vs potential for saving a cache miss or two).
+  out_dispatch_state->workgroup_size_x = tile_context->workgroup_size[0];
+  out_dispatch_state->workgroup_size_y = tile_context->workgroup_size[1];
+  out_dispatch_state->workgroup_size_z = tile_context->workgroup_size[2];
+  out_dispatch_state->push_constant_count = cmd->push_constant_count;
+  out_dispatch_state->workgroup_count_x = tile_context->workgroup_count[0];
+  out_dispatch_state->workgroup_count_y = tile_context->workgroup_count[1];
+  out_dispatch_state->workgroup_count_z = tile_context->workgroup_count[2];
+  out_dispatch_state->max_concurrency =
+      iree_task_affinity_set_count_ones(cmd->task.header.affinity_set);
+  out_dispatch_state->binding_count = cmd->binding_count;
+  uint8_t* cmd_ptr = (uint8_t*)cmd + sizeof(*cmd);
+  out_dispatch_state->push_constants = (uint32_t*)cmd_ptr;
+  cmd_ptr +=
+      cmd->push_constant_count * sizeof(*out_dispatch_state->push_constants);
+  out_dispatch_state->binding_ptrs = (void**)cmd_ptr;
+  cmd_ptr += cmd->binding_count * sizeof(*out_dispatch_state->binding_ptrs);
+  out_dispatch_state->binding_lengths = (size_t*)cmd_ptr;
+  cmd_ptr += cmd->binding_count * sizeof(*out_dispatch_state->binding_lengths);
+}
+
 static iree_status_t iree_hal_cmd_dispatch_tile(
     void* user_context, const iree_task_tile_context_t* tile_context,
     iree_task_submission_t* pending_submission) {
@@ -816,30 +1546,8 @@ static iree_status_t iree_hal_cmd_dispatch_tile(
       (const iree_hal_cmd_dispatch_t*)user_context;
   IREE_TRACE_ZONE_BEGIN(z0);
 
-  // We could share this across all workgroups in a dispatch and reduce cache
-  // pressure as all cores would be hitting the same hot read-only cache line.
-  // It'd grow the size of iree_hal_cmd_dispatch_t by a few dozen bytes, though,
-  // and so we'd need some profiling to see if it's worth it (fixed command
-  // buffer cost vs potential for saving a cache miss or two).
-  iree_alignas(64) iree_hal_executable_dispatch_state_v0_t dispatch_state = {
-      .workgroup_size_x = tile_context->workgroup_size[0],
-      .workgroup_size_y = tile_context->workgroup_size[1],
-      .workgroup_size_z = tile_context->workgroup_size[2],
-      .push_constant_count = cmd->push_constant_count,
-      .workgroup_count_x = tile_context->workgroup_count[0],
-      .workgroup_count_y = tile_context->workgroup_count[1],
-      .workgroup_count_z = tile_context->workgroup_count[2],
-      .max_concurrency =
-          iree_task_affinity_set_count_ones(cmd->task.header.affinity_set),
-      .binding_count = cmd->binding_count,
-  };
-  uint8_t* cmd_ptr = (uint8_t*)cmd + sizeof(*cmd);
-  dispatch_state.push_constants = (uint32_t*)cmd_ptr;
-  cmd_ptr += cmd->push_constant_count * sizeof(*dispatch_state.push_constants);
-  dispatch_state.binding_ptrs = (void**)cmd_ptr;
-  cmd_ptr += cmd->binding_count * sizeof(*dispatch_state.binding_ptrs);
-  dispatch_state.binding_lengths = (size_t*)cmd_ptr;
-  cmd_ptr += cmd->binding_count * sizeof(*dispatch_state.binding_lengths);
+  iree_alignas(64) iree_hal_executable_dispatch_state_v0_t dispatch_state = {0};
+  iree_hal_cmd_dispatch_initialize_state(cmd, tile_context, &dispatch_state);
 
   const iree_alignas(64)
       iree_hal_executable_workgroup_state_v0_t workgroup_state = {
@@ -858,6 +1566,58 @@ static iree_status_t iree_hal_cmd_dispatch_tile(
   return status;
 }
 
+// Executes |tile_count| workgroups starting at the |tile_context| workgroup ID
+// with a single dispatch state and, when supported by the executable, a single
+// call into the executable.
+static iree_status_t iree_hal_cmd_dispatch_tile_range(
+    void* user_context, const iree_task_tile_context_t* tile_context,
+    uint32_t tile_count, iree_task_submission_t* pending_submission) {
+  const iree_hal_cmd_dispatch_t* cmd =
+      (const iree_hal_cmd_dispatch_t*)user_context;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_alignas(64) iree_hal_executable_dispatch_state_v0_t dispatch_state = {0};
+  iree_hal_cmd_dispatch_initialize_state(cmd, tile_context, &dispatch_state);
+
+  const iree_alignas(64)
+      iree_hal_executable_workgroup_range_v0_t workgroup_range = {
+          .workgroup_id_x = tile_context->workgroup_xyz[0],
+          .workgroup_id_y = tile_context->workgroup_xyz[1],
+          .workgroup_id_z = tile_context->workgroup_xyz[2],
+          .reserved = 0,
+          .processor_id = tile_context->processor_id,
+          .local_memory = tile_context->local_memory.data,
+          .local_memory_size = (size_t)tile_context->local_memory.data_length,
+          .workgroup_count = tile_count,
+      };
+  iree_status_t status = iree_hal_local_executable_issue_range(
+      cmd->executable, cmd->ordinal, &dispatch_state, &workgroup_range);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static bool iree_hal_cmd_dispatch_isa(const iree_task_t* task) {
+  return task->type == IREE_TASK_TYPE_DISPATCH &&
+         ((const iree_task_dispatch_t*)task)->closure.fn ==
+             iree_hal_cmd_dispatch_tile;
+}
+
+static iree_status_t iree_hal_cmd_dispatch_profile(
+    iree_hal_cmd_dispatch_t* cmd, iree_hal_task_profiler_t* profiler) {
+  return iree_hal_task_profiler_append_dispatch(
+      profiler, cmd->executable, cmd->ordinal, &cmd->task.profile);
+}
+
+static iree_status_t iree_hal_cmd_dispatch_profile_list(
+    iree_hal_cmd_dispatch_t* head, iree_hal_task_profiler_t* profiler) {
+  for (iree_hal_cmd_dispatch_t* cmd = head; cmd != NULL;
+       cmd = cmd->next_dispatch) {
+    IREE_RETURN_IF_ERROR(iree_hal_cmd_dispatch_profile(cmd, profiler));
+  }
+  return iree_ok_status();
+}
+
 static iree_status_t iree_hal_task_command_buffer_build_dispatch(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_hal_executable_t* executable, int32_t entry_point,
@@ -887,11 +1647,12 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
       sizeof(*cmd) + push_constant_count * sizeof(uint32_t) +
       used_binding_count * sizeof(void*) +
       used_binding_count * sizeof(iree_device_size_t);
-  IREE_RETURN_IF_ERROR(iree_arena_allocate(&command_buffer->arena,
-                                           total_cmd_size, (void**)&cmd));
+  IREE_RETURN_IF_ERROR(iree_hal_task_command_buffer_allocate_cmd(
+      command_buffer, total_cmd_size, /*is_task=*/true, (void**)&cmd));
 
   cmd->executable = local_executable;
   cmd->ordinal = entry_point;
+  cmd->next_dispatch = NULL;
   cmd->push_constant_count = push_constant_count;
   cmd->binding_count = used_binding_count;
 
@@ -900,7 +1661,9 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
   const uint32_t workgroup_size[3] = {1, 1, 1};
   iree_task_dispatch_initialize(
       command_buffer->scope,
-      iree_task_make_dispatch_closure(iree_hal_cmd_dispatch_tile, (void*)cmd),
+      iree_task_make_dispatch_range_closure(iree_hal_cmd_dispatch_tile,
+                                            iree_hal_cmd_dispatch_tile_range,
+                                            (void*)cmd),
       workgroup_size, workgroup_count, &cmd->task);
 
   // Tell the task system how much workgroup local memory is required for the
@@ -912,6 +1675,12 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
                 IREE_HAL_WORKGROUP_LOCAL_MEMORY_PAGE_SIZE
           : 0;
 
+  // Track tile costs per executable export so that the task system can size
+  // tile reservations based on how expensive each workgroup is. Executable
+  // pointers have their high bits clear in practice so the ordinal lives there.
+  cmd->task.cost_key =
+      (uint64_t)(uintptr_t)local_executable ^ ((uint64_t)entry_point << 48);
+
   // Copy only the push constant range used by the executable.
   uint8_t* cmd_ptr = (uint8_t*)cmd + sizeof(*cmd);
   uint32_t* push_constants = (uint32_t*)cmd_ptr;
@@ -939,12 +1708,39 @@ static iree_status_t iree_hal_task_command_buffer_build_dispatch(
     used_binding_mask = iree_shr(used_binding_mask, mask_offset + 1);
     binding_ptrs[i] = command_buffer->state.bindings[binding_ordinal];
     binding_lengths[i] = command_buffer->state.binding_lengths[binding_ordinal];
+    if (command_buffer->state.binding_is_slot[binding_ordinal]) {
+      iree_hal_task_binding_fixup_t* fixup = NULL;
+      IREE_RETURN_IF_ERROR(iree_arena_allocate(
+          &command_buffer->arena, sizeof(*fixup), (void**)&fixup));
+      fixup->next = NULL;
+      fixup->binding_ptr = (uintptr_t)&binding_ptrs[i];
+      fixup->binding_length = (uintptr_t)&binding_lengths[i];
+      fixup->binding = command_buffer->state.slot_bindings[binding_ordinal];
+      if (command_buffer->binding_fixup_tail) {
+        command_buffer->binding_fixup_tail->next = fixup;
+      } else {
+        command_buffer->binding_fixup_head = fixup;
+      }
+      command_buffer->binding_fixup_tail = fixup;
+      ++command_buffer->binding_fixup_count;
+      continue;
+    }
     if (!binding_ptrs[i]) {
       return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
                               "(flat) binding %d is NULL", binding_ordinal);
     }
   }
 
+  if (iree_all_bits_set(iree_hal_command_buffer_mode(&command_buffer->base),
+                        IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT)) {
+    if (command_buffer->dispatch_tail) {
+      command_buffer->dispatch_tail->next_dispatch = cmd;
+    } else {
+      command_buffer->dispatch_head = cmd;
+    }
+    command_buffer->dispatch_tail = cmd;
+  }
+
   *out_cmd = cmd;
   return iree_hal_task_command_buffer_emit_execution_task(command_buffer,
                                                           &cmd->task.header);
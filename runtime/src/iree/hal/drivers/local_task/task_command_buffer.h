@@ -10,6 +10,7 @@
 #include "iree/base/api.h"
 #include "iree/base/internal/arena.h"
 #include "iree/hal/api.h"
+#include "iree/hal/drivers/local_task/task_profiler.h"
 #include "iree/hal/drivers/local_task/task_queue_state.h"
 #include "iree/task/scope.h"
 #include "iree/task/task.h"
@@ -22,7 +23,7 @@ iree_status_t iree_hal_task_command_buffer_create(
     iree_hal_device_t* device, iree_task_scope_t* scope,
     iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_arena_block_pool_t* block_pool, iree_allocator_t host_allocator,
     iree_hal_command_buffer_t** out_command_buffer);
 
@@ -35,6 +36,14 @@ bool iree_hal_task_command_buffer_isa(
 // prior commands such as signaled events and will be mutated as events are
 // reset or new events are signaled.
 //
+// |binding_table| is used to resolve any bindings recorded as binding table
+// slots and must contain at least as many bindings as the binding capacity the
+// command buffer was created with. It is only used during the issue and the
+// caller must keep the referenced buffers live until |retire_task| completes.
+//
+// |profiler| is optional and when provided each dispatch issued is appended to
+// the capture. The profiler must remain live until |retire_task| completes.
+//
 // |retire_task| will be scheduled once all commands issued from the command
 // buffer retire and can be used as a fence point.
 //
@@ -48,7 +57,9 @@ bool iree_hal_task_command_buffer_isa(
 // submitted to the executor (or discarded on failure) by the caller.
 iree_status_t iree_hal_task_command_buffer_issue(
     iree_hal_command_buffer_t* command_buffer,
-    iree_hal_task_queue_state_t* queue_state, iree_task_t* retire_task,
+    iree_hal_task_queue_state_t* queue_state,
+    iree_hal_buffer_binding_table_t binding_table,
+    iree_hal_task_profiler_t* profiler, iree_task_t* retire_task,
     iree_arena_allocator_t* arena, iree_task_submission_t* pending_submission);
 
 #ifdef __cplusplus
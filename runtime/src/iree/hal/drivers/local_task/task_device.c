@@ -14,6 +14,7 @@
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/local_task/task_command_buffer.h"
 #include "iree/hal/drivers/local_task/task_event.h"
+#include "iree/hal/drivers/local_task/task_profiler.h"
 #include "iree/hal/drivers/local_task/task_queue.h"
 #include "iree/hal/drivers/local_task/task_semaphore.h"
 #include "iree/hal/local/local_descriptor_set.h"
@@ -21,6 +22,8 @@
 #include "iree/hal/local/local_executable_cache.h"
 #include "iree/hal/local/local_executable_layout.h"
 #include "iree/hal/utils/buffer_transfer.h"
+#include "iree/hal/utils/transient_buffer_pool.h"
+#include "iree/task/executor.h"
 
 typedef struct iree_hal_task_device_t {
   iree_hal_resource_t resource;
@@ -38,9 +41,19 @@ typedef struct iree_hal_task_device_t {
   iree_host_size_t loader_count;
   iree_hal_executable_loader_t** loaders;
 
+  // Storage shared by all executable caches created from the device such that
+  // contexts loading the same executables share them.
+  iree_hal_local_executable_cache_storage_t* executable_cache_storage;
+
   iree_allocator_t host_allocator;
   iree_hal_allocator_t* device_allocator;
 
+  // Pool of storage recycled by queue-ordered allocations.
+  iree_hal_transient_buffer_pool_t* transient_pool;
+
+  // Active profiling capture shared by all queues or NULL if not profiling.
+  iree_hal_task_profiler_t* profiler;
+
   iree_host_size_t queue_count;
   iree_hal_task_queue_t queues[];
 } iree_hal_task_device_t;
@@ -57,6 +70,8 @@ void iree_hal_task_device_params_initialize(
     iree_hal_task_device_params_t* out_params) {
   out_params->arena_block_size = 32 * 1024;
   out_params->queue_count = 8;
+  out_params->high_priority_queue_count = 0;
+  out_params->low_priority_queue_count = 0;
 }
 
 static iree_status_t iree_hal_task_device_check_params(
@@ -69,9 +84,34 @@ static iree_status_t iree_hal_task_device_check_params(
     return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
                             "at least one queue is required");
   }
+  if (params->high_priority_queue_count + params->low_priority_queue_count >
+      params->queue_count) {
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "high (%" PRIhsz ") and low (%" PRIhsz
+        ") priority queue counts exceed the total queue count (%" PRIhsz ")",
+        params->high_priority_queue_count, params->low_priority_queue_count,
+        params->queue_count);
+  }
   return iree_ok_status();
 }
 
+// Returns the task priority of the queue at |queue_index| based on the
+// partitioning of queues in |params|.
+static iree_task_priority_t iree_hal_task_device_queue_priority(
+    const iree_hal_task_device_params_t* params, iree_host_size_t queue_index) {
+  const iree_host_size_t normal_priority_queue_count =
+      params->queue_count - params->high_priority_queue_count -
+      params->low_priority_queue_count;
+  if (queue_index < normal_priority_queue_count) {
+    return IREE_TASK_PRIORITY_NORMAL;
+  } else if (queue_index <
+             normal_priority_queue_count + params->high_priority_queue_count) {
+    return IREE_TASK_PRIORITY_HIGH;
+  }
+  return IREE_TASK_PRIORITY_LOW;
+}
+
 iree_status_t iree_hal_task_device_create(
     iree_string_view_t identifier, const iree_hal_task_device_params_t* params,
     iree_task_executor_t* executor, iree_host_size_t loader_count,
@@ -126,10 +166,17 @@ iree_status_t iree_hal_task_device_create(
     device->queue_count = params->queue_count;
     for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
       // TODO(benvanik): add a number to each queue ID.
-      iree_hal_task_queue_initialize(device->identifier, device->executor,
-                                     &device->small_block_pool,
-                                     &device->queues[i]);
+      iree_hal_task_queue_initialize(
+          device->identifier, iree_hal_task_device_queue_priority(params, i),
+          device->executor, &device->small_block_pool, &device->queues[i]);
     }
+
+    status = iree_hal_transient_buffer_pool_create(
+        device_allocator, host_allocator, &device->transient_pool);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_local_executable_cache_storage_create(
+        host_allocator, &device->executable_cache_storage);
   }
 
   if (iree_status_is_ok(status)) {
@@ -149,10 +196,14 @@ static void iree_hal_task_device_destroy(iree_hal_device_t* base_device) {
   for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
     iree_hal_task_queue_deinitialize(&device->queues[i]);
   }
+  iree_hal_task_profiler_destroy(device->profiler);
   for (iree_host_size_t i = 0; i < device->loader_count; ++i) {
     iree_hal_executable_loader_release(device->loaders[i]);
   }
+  iree_hal_local_executable_cache_storage_release(
+      device->executable_cache_storage);
   iree_task_executor_release(device->executor);
+  iree_hal_transient_buffer_pool_free(device->transient_pool);
   iree_arena_block_pool_deinitialize(&device->large_block_pool);
   iree_arena_block_pool_deinitialize(&device->small_block_pool);
   iree_hal_allocator_release(device->device_allocator);
@@ -179,11 +230,20 @@ static iree_hal_allocator_t* iree_hal_task_device_allocator(
   return device->device_allocator;
 }
 
+static void iree_hal_task_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
 static iree_status_t iree_hal_task_device_trim(iree_hal_device_t* base_device) {
   iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
   iree_arena_block_pool_trim(&device->small_block_pool);
   iree_arena_block_pool_trim(&device->large_block_pool);
   iree_task_executor_trim(device->executor);
+  iree_hal_transient_buffer_pool_trim(device->transient_pool);
   return iree_hal_allocator_trim(device->device_allocator);
 }
 
@@ -238,15 +298,15 @@ static iree_host_size_t iree_hal_task_device_select_queue(
 static iree_status_t iree_hal_task_device_create_command_buffer(
     iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer) {
   iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
   iree_host_size_t queue_index = iree_hal_task_device_select_queue(
       device, command_categories, queue_affinity);
   return iree_hal_task_command_buffer_create(
       base_device, &device->queues[queue_index].scope, mode, command_categories,
-      queue_affinity, &device->large_block_pool, device->host_allocator,
-      out_command_buffer);
+      queue_affinity, binding_capacity, &device->large_block_pool,
+      device->host_allocator, out_command_buffer);
 }
 
 static iree_status_t iree_hal_task_device_create_descriptor_set(
@@ -276,12 +336,84 @@ static iree_status_t iree_hal_task_device_create_event(
                                     out_event);
 }
 
+// Closure state for executable cache work issued to the executor.
+typedef struct iree_hal_task_device_cache_work_t {
+  iree_hal_local_executable_cache_work_fn_t work_fn;
+  void* user_data;
+} iree_hal_task_device_cache_work_t;
+
+static iree_status_t iree_hal_task_device_cache_work_tile(
+    void* user_context, const iree_task_tile_context_t* tile_context,
+    iree_task_submission_t* pending_submission) {
+  iree_hal_task_device_cache_work_t* work =
+      (iree_hal_task_device_cache_work_t*)user_context;
+  return work->work_fn(work->user_data, tile_context->workgroup_xyz[0]);
+}
+
+// Runs executable cache work (such as loading and relocating executables) as
+// a dispatch on the device executor with one workgroup per work item. The
+// calling thread is donated to the executor until the dispatch completes.
+static iree_status_t iree_hal_task_device_cache_run(
+    void* self, iree_host_size_t count,
+    iree_hal_local_executable_cache_work_fn_t work_fn, void* user_data) {
+  iree_task_executor_t* executor = (iree_task_executor_t*)self;
+  if (count > UINT32_MAX) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "executable cache work count %" PRIhsz
+                            " exceeds the dispatch workgroup limit",
+                            count);
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("executable_cache"),
+                             &scope);
+
+  iree_hal_task_device_cache_work_t work = {
+      .work_fn = work_fn,
+      .user_data = user_data,
+  };
+  const uint32_t workgroup_size[3] = {1, 1, 1};
+  const uint32_t workgroup_count[3] = {(uint32_t)count, 1, 1};
+  iree_task_dispatch_t dispatch_task;
+  iree_task_dispatch_initialize(
+      &scope,
+      iree_task_make_dispatch_closure(iree_hal_task_device_cache_work_tile,
+                                      &work),
+      workgroup_size, workgroup_count, &dispatch_task);
+
+  iree_task_fence_t* fence = NULL;
+  iree_status_t status =
+      iree_task_executor_acquire_fence(executor, &scope, &fence);
+  if (iree_status_is_ok(status)) {
+    iree_task_set_completion_task(&dispatch_task.header, &fence->header);
+    iree_task_submission_t submission;
+    iree_task_submission_initialize(&submission);
+    iree_task_submission_enqueue(&submission, &dispatch_task.header);
+    iree_task_executor_submit(executor, &submission);
+    status = iree_task_executor_donate_caller(
+        executor, iree_task_scope_await_idle(&scope), iree_infinite_timeout());
+  }
+  if (iree_status_is_ok(status) && iree_task_scope_has_failed(&scope)) {
+    status = iree_task_scope_consume_status(&scope);
+  }
+
+  iree_task_scope_deinitialize(&scope);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static iree_status_t iree_hal_task_device_create_executable_cache(
     iree_hal_device_t* base_device, iree_string_view_t identifier,
     iree_loop_t loop, iree_hal_executable_cache_t** out_executable_cache) {
   iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  const iree_hal_local_executable_cache_scheduler_t scheduler = {
+      .self = device->executor,
+      .run = iree_hal_task_device_cache_run,
+  };
   return iree_hal_local_executable_cache_create(
       identifier, device->loader_count, device->loaders,
+      device->executable_cache_storage, scheduler,
       iree_hal_device_host_allocator(base_device), out_executable_cache);
 }
 
@@ -299,9 +431,8 @@ static iree_status_t iree_hal_task_device_create_semaphore(
     iree_hal_device_t* base_device, uint64_t initial_value,
     iree_hal_semaphore_t** out_semaphore) {
   iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
-  return iree_hal_task_semaphore_create(
-      iree_task_executor_event_pool(device->executor), initial_value,
-      device->host_allocator, out_semaphore);
+  return iree_hal_task_semaphore_create(device->executor, initial_value,
+                                        device->host_allocator, out_semaphore);
 }
 
 static iree_hal_semaphore_compatibility_t
@@ -331,6 +462,62 @@ static iree_status_t iree_hal_task_device_queue_submit(
                                     batches);
 }
 
+// Enqueues a barrier that signals |signal_semaphore_list| once
+// |wait_semaphore_list| has been reached.
+static iree_status_t iree_hal_task_device_queue_barrier(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list) {
+  if (!wait_semaphore_list.count && !signal_semaphore_list.count) {
+    return iree_ok_status();
+  }
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = wait_semaphore_list;
+  batch.signal_semaphores = signal_semaphore_list;
+  return iree_hal_task_device_queue_submit(
+      base_device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity, 1, &batch);
+}
+
+static iree_status_t iree_hal_task_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  // Host memory is committed immediately and any reused storage is known to be
+  // unused once the waits are reached so we only need to order the signal.
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_transient_buffer_pool_acquire(
+      device->transient_pool, params, allocation_size, wait_semaphore_list,
+      &buffer));
+  iree_status_t status = iree_hal_task_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+static iree_status_t iree_hal_task_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  // The storage is available for reuse once the signal (or when there is none
+  // the wait) is reached.
+  IREE_RETURN_IF_ERROR(iree_hal_transient_buffer_pool_release(
+      device->transient_pool, buffer,
+      signal_semaphore_list.count ? signal_semaphore_list
+                                  : wait_semaphore_list));
+  return iree_hal_task_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+}
+
 static iree_status_t iree_hal_task_device_submit_and_wait(
     iree_hal_device_t* base_device,
     iree_hal_command_category_t command_categories,
@@ -350,10 +537,9 @@ static iree_status_t iree_hal_task_device_wait_semaphores(
     iree_hal_device_t* base_device, iree_hal_wait_mode_t wait_mode,
     const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
   iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
-  return iree_hal_task_semaphore_multi_wait(
-      wait_mode, semaphore_list, timeout,
-      iree_task_executor_event_pool(device->executor),
-      &device->large_block_pool);
+  return iree_hal_task_semaphore_multi_wait(wait_mode, semaphore_list, timeout,
+                                            device->executor,
+                                            &device->large_block_pool);
 }
 
 static iree_status_t iree_hal_task_device_wait_idle(
@@ -369,11 +555,68 @@ static iree_status_t iree_hal_task_device_wait_idle(
   return status;
 }
 
+// Sets the profiler used by all queues. Queues must be idle.
+static void iree_hal_task_device_set_profiler(
+    iree_hal_task_device_t* device, iree_hal_task_profiler_t* profiler) {
+  device->profiler = profiler;
+  for (iree_host_size_t i = 0; i < device->queue_count; ++i) {
+    device->queues[i].profiler = profiler;
+  }
+}
+
+static iree_status_t iree_hal_task_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  if (device->profiler) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "profiling already active");
+  }
+  if (!iree_all_bits_set(options->mode,
+                         IREE_HAL_DEVICE_PROFILING_MODE_DISPATCHES)) {
+    // No supported modes requested.
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Only work submitted after this point is captured as queues sample the
+  // profiler when work is submitted.
+  iree_hal_task_profiler_t* profiler = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_task_profiler_create(
+              options, iree_task_executor_worker_count(device->executor),
+              device->host_allocator, &profiler));
+  iree_hal_task_device_set_profiler(device, profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_task_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  iree_hal_task_device_t* device = iree_hal_task_device_cast(base_device);
+  if (!device->profiler) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // All captured dispatches must have retired before the capture is written.
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_task_device_wait_idle(base_device, iree_infinite_timeout()));
+
+  iree_hal_task_profiler_t* profiler = device->profiler;
+  iree_hal_task_device_set_profiler(device, NULL);
+  iree_status_t status = iree_hal_task_profiler_write(profiler);
+  iree_hal_task_profiler_destroy(profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static const iree_hal_device_vtable_t iree_hal_task_device_vtable = {
     .destroy = iree_hal_task_device_destroy,
     .id = iree_hal_task_device_id,
     .host_allocator = iree_hal_task_device_host_allocator,
     .device_allocator = iree_hal_task_device_allocator,
+    .replace_device_allocator = iree_hal_task_device_replace_allocator,
     .trim = iree_hal_task_device_trim,
     .query_i64 = iree_hal_task_device_query_i64,
     .create_command_buffer = iree_hal_task_device_create_command_buffer,
@@ -387,8 +630,12 @@ static const iree_hal_device_vtable_t iree_hal_task_device_vtable = {
     .query_semaphore_compatibility =
         iree_hal_task_device_query_semaphore_compatibility,
     .transfer_range = iree_hal_device_transfer_mappable_range,
+    .queue_alloca = iree_hal_task_device_queue_alloca,
+    .queue_dealloca = iree_hal_task_device_queue_dealloca,
     .queue_submit = iree_hal_task_device_queue_submit,
     .submit_and_wait = iree_hal_task_device_submit_and_wait,
     .wait_semaphores = iree_hal_task_device_wait_semaphores,
     .wait_idle = iree_hal_task_device_wait_idle,
+    .profiling_begin = iree_hal_task_device_profiling_begin,
+    .profiling_end = iree_hal_task_device_profiling_end,
 };
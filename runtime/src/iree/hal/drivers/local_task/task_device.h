@@ -24,6 +24,17 @@ typedef struct iree_hal_task_device_params_t {
   // concurrently unless prohibited by semaphores.
   iree_host_size_t queue_count;
 
+  // Number of the queues that schedule their work at high and low priority.
+  // Queues are ordered with all normal priority queues first followed by the
+  // high priority queues and then the low priority queues such that callers
+  // can select the priority of their work with the queue affinity of their
+  // submissions. High priority work is executed before any normal or low
+  // priority work that is ready at the same time and preempts dispatches of
+  // lower priority between tile reservations. The sum of both must not exceed
+  // queue_count.
+  iree_host_size_t high_priority_queue_count;
+  iree_host_size_t low_priority_queue_count;
+
   // Total size of each block in the device shared block pool.
   // Larger sizes will lower overhead and ensure the heap isn't hit for
   // transient allocations while also increasing memory consumption.
@@ -0,0 +1,360 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/local_task/task_profiler.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "iree/base/internal/file_io.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+
+// Size of each block of dispatch records. Records are never moved once
+// allocated as the task system updates them while the dispatches execute.
+#define IREE_HAL_TASK_PROFILER_BLOCK_SIZE (64 * 1024)
+
+// A dispatch appended to the capture. The task system profile follows the
+// record in memory.
+typedef struct iree_hal_task_profiler_record_t {
+  uint32_t executable_index;
+  uint32_t ordinal;
+} iree_hal_task_profiler_record_t;
+
+typedef struct iree_hal_task_profiler_block_t {
+  struct iree_hal_task_profiler_block_t* next;
+  // Number of records allocated from the block.
+  iree_host_size_t record_count;
+  // Followed by up to the block capacity records of the profiler stride.
+} iree_hal_task_profiler_block_t;
+
+struct iree_hal_task_profiler_t {
+  iree_allocator_t host_allocator;
+
+  // NUL-terminated path the capture is written to.
+  const char* file_path;
+
+  // Time the capture began.
+  iree_time_t begin_ns;
+
+  // Number of tile counters in each dispatch profile.
+  uint32_t worker_capacity;
+
+  // Size in bytes of each record and its trailing profile.
+  iree_host_size_t record_stride;
+  // Maximum number of records in each block.
+  iree_host_size_t block_capacity;
+
+  // Guards all mutable state below.
+  iree_slim_mutex_t mutex;
+
+  // Blocks in allocation order; new records are allocated from the tail.
+  iree_hal_task_profiler_block_t* block_head;
+  iree_hal_task_profiler_block_t* block_tail;
+  iree_host_size_t dispatch_count;
+
+  // Retained executables indexed by executable index.
+  iree_host_size_t executable_count;
+  iree_host_size_t executable_capacity;
+  iree_hal_local_executable_t** executables;
+  // Index of the executable most recently dispatched as dispatches of the same
+  // executable tend to be recorded together.
+  iree_host_size_t last_executable_index;
+};
+
+static iree_task_dispatch_profile_t* iree_hal_task_profiler_record_profile(
+    iree_hal_task_profiler_record_t* record) {
+  return (iree_task_dispatch_profile_t*)((uint8_t*)record +
+                                         iree_host_align(sizeof(*record), 8));
+}
+
+static iree_hal_task_profiler_record_t* iree_hal_task_profiler_block_record(
+    const iree_hal_task_profiler_t* profiler,
+    iree_hal_task_profiler_block_t* block, iree_host_size_t record_index) {
+  return (iree_hal_task_profiler_record_t*)((uint8_t*)block +
+                                            iree_host_align(sizeof(*block), 8) +
+                                            record_index *
+                                                profiler->record_stride);
+}
+
+iree_status_t iree_hal_task_profiler_create(
+    const iree_hal_device_profiling_options_t* options,
+    iree_host_size_t worker_count, iree_allocator_t host_allocator,
+    iree_hal_task_profiler_t** out_profiler) {
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_profiler);
+  *out_profiler = NULL;
+  if (!options->file_path || !strlen(options->file_path)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "profiling requires a capture file path");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_task_profiler_t* profiler = NULL;
+  const iree_host_size_t file_path_length = strlen(options->file_path);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator,
+                                sizeof(*profiler) + file_path_length + 1,
+                                (void**)&profiler));
+  memset(profiler, 0, sizeof(*profiler));
+  profiler->host_allocator = host_allocator;
+  char* file_path = (char*)profiler + sizeof(*profiler);
+  memcpy(file_path, options->file_path, file_path_length + 1);
+  profiler->file_path = file_path;
+  profiler->begin_ns = iree_time_now();
+
+  // One counter for each worker and one for donated threads.
+  profiler->worker_capacity = (uint32_t)worker_count + 1;
+  profiler->record_stride = iree_host_align(
+      iree_host_align(sizeof(iree_hal_task_profiler_record_t), 8) +
+          sizeof(iree_task_dispatch_profile_t) +
+          profiler->worker_capacity * sizeof(iree_atomic_int32_t),
+      iree_max_align_t);
+  profiler->block_capacity =
+      (IREE_HAL_TASK_PROFILER_BLOCK_SIZE -
+       iree_host_align(sizeof(iree_hal_task_profiler_block_t), 8)) /
+      profiler->record_stride;
+  if (profiler->block_capacity == 0) profiler->block_capacity = 1;
+
+  iree_slim_mutex_initialize(&profiler->mutex);
+
+  *out_profiler = profiler;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+void iree_hal_task_profiler_destroy(iree_hal_task_profiler_t* profiler) {
+  if (!profiler) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_allocator_t host_allocator = profiler->host_allocator;
+
+  iree_hal_task_profiler_block_t* block = profiler->block_head;
+  while (block) {
+    iree_hal_task_profiler_block_t* next_block = block->next;
+    iree_allocator_free(host_allocator, block);
+    block = next_block;
+  }
+  for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+    iree_hal_executable_release(
+        (iree_hal_executable_t*)profiler->executables[i]);
+  }
+  iree_allocator_free(host_allocator, profiler->executables);
+  iree_slim_mutex_deinitialize(&profiler->mutex);
+  iree_allocator_free(host_allocator, profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Returns the index of |executable| in the executable table, adding it if this
+// is the first dispatch of the executable. Requires the profiler mutex.
+static iree_status_t iree_hal_task_profiler_lookup_executable(
+    iree_hal_task_profiler_t* profiler,
+    iree_hal_local_executable_t* executable, uint32_t* out_executable_index) {
+  if (profiler->last_executable_index < profiler->executable_count &&
+      profiler->executables[profiler->last_executable_index] == executable) {
+    *out_executable_index = (uint32_t)profiler->last_executable_index;
+    return iree_ok_status();
+  }
+  for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+    if (profiler->executables[i] == executable) {
+      profiler->last_executable_index = i;
+      *out_executable_index = (uint32_t)i;
+      return iree_ok_status();
+    }
+  }
+
+  if (profiler->executable_count == profiler->executable_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(16, profiler->executable_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        profiler->host_allocator,
+        new_capacity * sizeof(*profiler->executables),
+        (void**)&profiler->executables));
+    profiler->executable_capacity = new_capacity;
+  }
+
+  // Executables are retained so that they are not reused for other
+  // executables while the capture is active.
+  const iree_host_size_t executable_index = profiler->executable_count++;
+  profiler->executables[executable_index] = executable;
+  iree_hal_executable_retain((iree_hal_executable_t*)executable);
+  profiler->last_executable_index = executable_index;
+  *out_executable_index = (uint32_t)executable_index;
+  return iree_ok_status();
+}
+
+// Allocates storage for a new record. Requires the profiler mutex.
+static iree_status_t iree_hal_task_profiler_allocate_record(
+    iree_hal_task_profiler_t* profiler,
+    iree_hal_task_profiler_record_t** out_record) {
+  iree_hal_task_profiler_block_t* block = profiler->block_tail;
+  if (!block || block->record_count == profiler->block_capacity) {
+    IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+        profiler->host_allocator,
+        iree_host_align(sizeof(*block), 8) +
+            profiler->block_capacity * profiler->record_stride,
+        (void**)&block));
+    block->next = NULL;
+    block->record_count = 0;
+    if (profiler->block_tail) {
+      profiler->block_tail->next = block;
+    } else {
+      profiler->block_head = block;
+    }
+    profiler->block_tail = block;
+  }
+  *out_record =
+      iree_hal_task_profiler_block_record(profiler, block, block->record_count);
+  ++block->record_count;
+  ++profiler->dispatch_count;
+  return iree_ok_status();
+}
+
+iree_status_t iree_hal_task_profiler_append_dispatch(
+    iree_hal_task_profiler_t* profiler,
+    iree_hal_local_executable_t* executable, int32_t ordinal,
+    iree_task_dispatch_profile_t** out_profile) {
+  IREE_ASSERT_ARGUMENT(profiler);
+  IREE_ASSERT_ARGUMENT(executable);
+  IREE_ASSERT_ARGUMENT(out_profile);
+  *out_profile = NULL;
+
+  iree_slim_mutex_lock(&profiler->mutex);
+  uint32_t executable_index = 0;
+  iree_hal_task_profiler_record_t* record = NULL;
+  iree_status_t status = iree_hal_task_profiler_lookup_executable(
+      profiler, executable, &executable_index);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_task_profiler_allocate_record(profiler, &record);
+  }
+  iree_slim_mutex_unlock(&profiler->mutex);
+  IREE_RETURN_IF_ERROR(status);
+
+  record->executable_index = executable_index;
+  record->ordinal = (uint32_t)ordinal;
+  iree_task_dispatch_profile_t* profile =
+      iree_hal_task_profiler_record_profile(record);
+  iree_task_dispatch_profile_initialize(profiler->worker_capacity, profile);
+  *out_profile = profile;
+  return iree_ok_status();
+}
+
+// Returns the name of export |ordinal| of |executable| or an empty string if
+// the executable has no reflection information.
+static iree_string_view_t iree_hal_task_profiler_export_name(
+    iree_hal_local_executable_t* executable, iree_host_size_t ordinal) {
+  if (!executable->export_names || ordinal >= executable->export_count ||
+      !executable->export_names[ordinal]) {
+    return iree_string_view_empty();
+  }
+  return iree_make_cstring_view(executable->export_names[ordinal]);
+}
+
+iree_status_t iree_hal_task_profiler_write(iree_hal_task_profiler_t* profiler) {
+  IREE_ASSERT_ARGUMENT(profiler);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_slim_mutex_lock(&profiler->mutex);
+
+  const iree_host_size_t tile_counts_size = iree_host_align(
+      profiler->worker_capacity * sizeof(uint32_t), sizeof(uint64_t));
+  const iree_host_size_t dispatch_size =
+      sizeof(iree_hal_task_profile_file_dispatch_t) + tile_counts_size;
+  iree_host_size_t name_table_size = 0;
+  for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+    iree_hal_local_executable_t* executable = profiler->executables[i];
+    for (iree_host_size_t j = 0; j < executable->executable_layout_count; ++j) {
+      name_table_size +=
+          iree_hal_task_profiler_export_name(executable, j).size + 1;
+    }
+  }
+  const iree_host_size_t total_size =
+      sizeof(iree_hal_task_profile_file_header_t) +
+      profiler->executable_count *
+          sizeof(iree_hal_task_profile_file_executable_t) +
+      iree_host_align(name_table_size, sizeof(uint64_t)) +
+      profiler->dispatch_count * dispatch_size;
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, total_size);
+
+  uint8_t* contents = NULL;
+  iree_status_t status = iree_allocator_malloc(profiler->host_allocator,
+                                               total_size, (void**)&contents);
+  if (iree_status_is_ok(status)) {
+    memset(contents, 0, total_size);
+    uint8_t* ptr = contents;
+
+    iree_hal_task_profile_file_header_t* header =
+        (iree_hal_task_profile_file_header_t*)ptr;
+    header->magic = IREE_HAL_TASK_PROFILE_FILE_MAGIC;
+    header->version = IREE_HAL_TASK_PROFILE_FILE_VERSION;
+    header->worker_count = profiler->worker_capacity;
+    header->executable_count = (uint32_t)profiler->executable_count;
+    header->dispatch_count = (uint64_t)profiler->dispatch_count;
+    header->duration_ns = iree_time_now() - profiler->begin_ns;
+    header->name_table_size = (uint32_t)name_table_size;
+    ptr += sizeof(*header);
+
+    for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+      iree_hal_task_profile_file_executable_t* executable =
+          (iree_hal_task_profile_file_executable_t*)ptr;
+      executable->export_count =
+          (uint32_t)profiler->executables[i]->executable_layout_count;
+      ptr += sizeof(*executable);
+    }
+
+    // Names are NUL-terminated by the memset above.
+    char* name_ptr = (char*)ptr;
+    for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+      iree_hal_local_executable_t* executable = profiler->executables[i];
+      for (iree_host_size_t j = 0; j < executable->executable_layout_count;
+           ++j) {
+        iree_string_view_t name =
+            iree_hal_task_profiler_export_name(executable, j);
+        memcpy(name_ptr, name.data, name.size);
+        name_ptr += name.size + 1;
+      }
+    }
+    ptr += iree_host_align(name_table_size, sizeof(uint64_t));
+
+    for (iree_hal_task_profiler_block_t* block = profiler->block_head;
+         block != NULL; block = block->next) {
+      for (iree_host_size_t i = 0; i < block->record_count; ++i) {
+        iree_hal_task_profiler_record_t* record =
+            iree_hal_task_profiler_block_record(profiler, block, i);
+        iree_task_dispatch_profile_t* profile =
+            iree_hal_task_profiler_record_profile(record);
+        iree_hal_task_profile_file_dispatch_t* dispatch =
+            (iree_hal_task_profile_file_dispatch_t*)ptr;
+        dispatch->executable_index = record->executable_index;
+        dispatch->ordinal = record->ordinal;
+        memcpy(dispatch->workgroup_count, profile->workgroup_count,
+               sizeof(dispatch->workgroup_count));
+        const int64_t start_ns = iree_atomic_load_int64(
+            &profile->start_ns, iree_memory_order_relaxed);
+        const int64_t end_ns =
+            iree_atomic_load_int64(&profile->end_ns, iree_memory_order_relaxed);
+        if (start_ns) {
+          dispatch->start_ns = start_ns - profiler->begin_ns;
+          dispatch->duration_ns = end_ns - start_ns;
+        }
+        uint32_t* tile_counts = (uint32_t*)(ptr + sizeof(*dispatch));
+        for (uint32_t j = 0; j < profile->worker_capacity; ++j) {
+          tile_counts[j] = (uint32_t)iree_atomic_load_int32(
+              &profile->worker_tile_counts[j], iree_memory_order_relaxed);
+        }
+        ptr += dispatch_size;
+      }
+    }
+
+    status = iree_file_write_contents(
+        profiler->file_path, iree_make_const_byte_span(contents, total_size));
+  }
+
+  iree_slim_mutex_unlock(&profiler->mutex);
+  iree_allocator_free(profiler->host_allocator, contents);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
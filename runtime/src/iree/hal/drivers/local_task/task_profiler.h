@@ -0,0 +1,128 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_LOCAL_TASK_TASK_PROFILER_H_
+#define IREE_HAL_DRIVERS_LOCAL_TASK_TASK_PROFILER_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/local/local_executable.h"
+#include "iree/task/task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// Capture file format
+//===----------------------------------------------------------------------===//
+
+// A capture file is laid out as:
+//   iree_hal_task_profile_file_header_t header;
+//   iree_hal_task_profile_file_executable_t executables[executable_count];
+//   char export_names[name_table_size];  // padded to a multiple of 8 bytes
+//   {
+//     iree_hal_task_profile_file_dispatch_t dispatch;
+//     uint32_t tile_counts[worker_count];  // padded to a multiple of 8 bytes
+//   } dispatches[dispatch_count];
+//
+// All values are stored in host byte order; readers can use the magic value to
+// detect captures from hosts of differing endianness. Dispatches are stored in
+// the order they were issued and all times are in nanoseconds relative to the
+// start of the capture.
+//
+// The export name table holds one NUL-terminated name per export of each
+// executable in executable table order. Names are empty if the executable was
+// compiled without reflection information.
+
+// 'IRDP' when read as bytes on little-endian hosts.
+#define IREE_HAL_TASK_PROFILE_FILE_MAGIC 0x50445249u
+#define IREE_HAL_TASK_PROFILE_FILE_VERSION 2u
+
+typedef struct iree_hal_task_profile_file_header_t {
+  // IREE_HAL_TASK_PROFILE_FILE_MAGIC.
+  uint32_t magic;
+  // IREE_HAL_TASK_PROFILE_FILE_VERSION.
+  uint32_t version;
+  // Number of tile counters per dispatch. Each counter is the number of tiles
+  // executed by the executor worker with the same index and the last counts
+  // tiles executed by threads donated to the executor.
+  uint32_t worker_count;
+  // Number of entries in the executable table.
+  uint32_t executable_count;
+  // Number of dispatch records following the executable table.
+  uint64_t dispatch_count;
+  // Duration of the capture from begin to end.
+  int64_t duration_ns;
+  // Size in bytes of the export name table excluding padding.
+  uint32_t name_table_size;
+  uint32_t reserved;
+} iree_hal_task_profile_file_header_t;
+
+// Executables are assigned indices in the order they were first dispatched.
+typedef struct iree_hal_task_profile_file_executable_t {
+  // Total number of exports in the executable.
+  uint32_t export_count;
+  uint32_t reserved;
+} iree_hal_task_profile_file_executable_t;
+
+typedef struct iree_hal_task_profile_file_dispatch_t {
+  // Index of the dispatched executable in the executable table.
+  uint32_t executable_index;
+  // Export ordinal within the executable.
+  uint32_t ordinal;
+  // Workgroup count the dispatch was issued with.
+  uint32_t workgroup_count[3];
+  uint32_t reserved;
+  // Time the first tile started executing.
+  int64_t start_ns;
+  // Time from the first tile starting to the last tile completing. 0 if the
+  // dispatch executed no tiles.
+  int64_t duration_ns;
+} iree_hal_task_profile_file_dispatch_t;
+
+//===----------------------------------------------------------------------===//
+// iree_hal_task_profiler_t
+//===----------------------------------------------------------------------===//
+
+// Captures the dispatches issued to a task device between profiling begin and
+// end. Each dispatch is assigned a profile that the task system updates as the
+// dispatch executes and that is written to the capture file once profiling
+// ends. Profiles are only updated once per shard and the tile function is
+// unmodified such that profiling does not perturb the dispatches measured.
+//
+// Thread-safe; dispatches may be appended from multiple queues concurrently.
+typedef struct iree_hal_task_profiler_t iree_hal_task_profiler_t;
+
+// Creates a profiler that writes to the file specified in |options|.
+// |worker_count| is the total number of workers in the executor the profiled
+// dispatches execute on.
+iree_status_t iree_hal_task_profiler_create(
+    const iree_hal_device_profiling_options_t* options,
+    iree_host_size_t worker_count, iree_allocator_t host_allocator,
+    iree_hal_task_profiler_t** out_profiler);
+
+// Destroys |profiler| and releases all captured executables.
+// All dispatches appended must have retired.
+void iree_hal_task_profiler_destroy(iree_hal_task_profiler_t* profiler);
+
+// Appends a dispatch of |executable| export |ordinal| to the capture and
+// returns the profile to attach to its task in |out_profile|. The profile
+// remains valid until the profiler is destroyed.
+iree_status_t iree_hal_task_profiler_append_dispatch(
+    iree_hal_task_profiler_t* profiler,
+    iree_hal_local_executable_t* executable, int32_t ordinal,
+    iree_task_dispatch_profile_t** out_profile);
+
+// Writes the capture to the profiler file.
+// All dispatches appended must have retired.
+iree_status_t iree_hal_task_profiler_write(iree_hal_task_profiler_t* profiler);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_LOCAL_TASK_TASK_PROFILER_H_
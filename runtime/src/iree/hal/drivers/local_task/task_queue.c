@@ -12,6 +12,7 @@
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/local_task/task_command_buffer.h"
 #include "iree/hal/drivers/local_task/task_semaphore.h"
+#include "iree/hal/utils/resource_set.h"
 #include "iree/task/submission.h"
 
 // Each submission is turned into a DAG for execution:
@@ -51,6 +52,9 @@
 //    |                       earlier submissions complete if there were no
 //   ...                      dependencies between the commands in each batch.
 //
+// The retire also acts as the scope fence of the submission so that no
+// additional task is needed to notify waiters when the queue goes idle.
+//
 // Could this be simplified? Probably. Improvements to the task system to allow
 // for efficient multiwaits and better stitching of independent DAGs would help.
 
@@ -182,6 +186,14 @@ typedef struct iree_hal_task_queue_issue_cmd_t {
   // if we are the last issue pending.
   iree_hal_task_queue_t* queue;
 
+  // Profiler active when the batch was submitted or NULL if not profiling.
+  iree_hal_task_profiler_t* profiler;
+
+  // Binding tables for each command buffer or NULL if none were provided.
+  // Copied into the arena and the referenced buffers are retained by the
+  // retire command.
+  iree_hal_buffer_binding_table_t* binding_tables;
+
   // Command buffers to be issued in the order the appeared in the submission.
   iree_host_size_t command_buffer_count;
   iree_hal_command_buffer_t* command_buffers[];
@@ -203,7 +215,10 @@ static iree_status_t iree_hal_task_queue_issue_cmd(
       if (iree_hal_task_command_buffer_isa(cmd->command_buffers[i])) {
         status = iree_hal_task_command_buffer_issue(
             cmd->command_buffers[i], &cmd->queue->state,
-            cmd->task.header.completion_task, cmd->arena, pending_submission);
+            cmd->binding_tables ? cmd->binding_tables[i]
+                                : iree_hal_buffer_binding_table_empty(),
+            cmd->profiler, cmd->task.header.completion_task, cmd->arena,
+            pending_submission);
         iree_hal_command_buffer_release(cmd->command_buffers[i]);
         cmd->command_buffers[i] = NULL;
       } else {
@@ -238,6 +253,7 @@ static iree_status_t iree_hal_task_queue_issue_cmd_allocate(
     iree_task_scope_t* scope, iree_hal_task_queue_t* queue,
     iree_task_t* retire_task, iree_host_size_t command_buffer_count,
     iree_hal_command_buffer_t** const command_buffers,
+    const iree_hal_buffer_binding_table_t* binding_tables,
     iree_arena_allocator_t* arena, iree_hal_task_queue_issue_cmd_t** out_cmd) {
   iree_hal_task_queue_issue_cmd_t* cmd = NULL;
   iree_host_size_t total_cmd_size =
@@ -252,6 +268,26 @@ static iree_status_t iree_hal_task_queue_issue_cmd_allocate(
                            iree_hal_task_queue_issue_cmd_cleanup);
   cmd->arena = arena;
   cmd->queue = queue;
+  cmd->profiler = queue->profiler;
+
+  cmd->binding_tables = NULL;
+  if (binding_tables && command_buffer_count > 0) {
+    IREE_RETURN_IF_ERROR(iree_arena_allocate(
+        arena, command_buffer_count * sizeof(*cmd->binding_tables),
+        (void**)&cmd->binding_tables));
+    for (iree_host_size_t i = 0; i < command_buffer_count; ++i) {
+      cmd->binding_tables[i].count = binding_tables[i].count;
+      cmd->binding_tables[i].bindings = NULL;
+      if (binding_tables[i].count == 0) continue;
+      iree_hal_buffer_binding_t* bindings = NULL;
+      IREE_RETURN_IF_ERROR(iree_arena_allocate(
+          arena, binding_tables[i].count * sizeof(*bindings),
+          (void**)&bindings));
+      memcpy(bindings, binding_tables[i].bindings,
+             binding_tables[i].count * sizeof(*bindings));
+      cmd->binding_tables[i].bindings = bindings;
+    }
+  }
 
   cmd->command_buffer_count = command_buffer_count;
   for (iree_host_size_t i = 0; i < command_buffer_count; ++i) {
@@ -271,6 +307,10 @@ static iree_status_t iree_hal_task_queue_issue_cmd_allocate(
 // it. The task is issued only once all commands from all command buffers in
 // the submission complete. Semaphores will be signaled and dependent
 // submissions may be issued.
+//
+// The command begins the queue scope when allocated and ends it once all
+// memory of the submission has been returned to the block pool, acting as the
+// scope fence of the submission.
 typedef struct iree_hal_task_queue_retire_cmd_t {
   // Call to iree_hal_task_queue_retire_cmd.
   iree_task_call_t task;
@@ -282,6 +322,10 @@ typedef struct iree_hal_task_queue_retire_cmd_t {
 
   // A list of semaphores to signal upon retiring.
   iree_hal_semaphore_list_t signal_semaphores;
+
+  // Buffers referenced by the submission binding tables that must remain live
+  // until all commands complete. NULL if the submission had no binding tables.
+  iree_hal_resource_set_t* resource_set;
 } iree_hal_task_queue_retire_cmd_t;
 
 // Retires a submission by signaling semaphores to their desired value and
@@ -325,13 +369,20 @@ static void iree_hal_task_queue_retire_cmd_cleanup(
     }
   }
 
-  // Release all semaphores.
+  // Release all semaphores and retained binding table buffers.
   iree_hal_semaphore_list_release(&cmd->signal_semaphores);
+  if (cmd->resource_set) iree_hal_resource_set_free(cmd->resource_set);
 
   // Drop all memory used by the submission (**including cmd**).
+  iree_task_scope_t* scope = cmd->task.header.scope;
   iree_arena_allocator_t arena = cmd->arena;
   cmd = NULL;
   iree_arena_deinitialize(&arena);
+
+  // Notify the scope that the submission has retired only once its memory has
+  // been released; waiters on the scope may deinitialize the queue and block
+  // pool as soon as it goes idle.
+  iree_task_scope_end(scope);
 }
 
 // Allocates and initializes a iree_hal_task_queue_retire_cmd_t task.
@@ -356,6 +407,7 @@ static iree_status_t iree_hal_task_queue_retire_cmd_allocate(
         &cmd->task);
     iree_task_set_cleanup_fn(&cmd->task.header,
                              iree_hal_task_queue_retire_cmd_cleanup);
+    cmd->resource_set = NULL;
   }
 
   // Clone the signal semaphores from the batch - we retain them and their
@@ -366,8 +418,10 @@ static iree_status_t iree_hal_task_queue_retire_cmd_allocate(
   }
 
   if (iree_status_is_ok(status)) {
-    // Transfer ownership of the arena to command.
+    // Transfer ownership of the arena to command. The scope is ended when the
+    // command is cleaned up.
     memcpy(&cmd->arena, &arena, sizeof(cmd->arena));
+    iree_task_scope_begin(scope);
     *out_cmd = cmd;
   } else {
     iree_arena_deinitialize(&arena);
@@ -375,11 +429,24 @@ static iree_status_t iree_hal_task_queue_retire_cmd_allocate(
   return status;
 }
 
+// Disposes of a |cmd| that was allocated but never submitted.
+static void iree_hal_task_queue_retire_cmd_discard(
+    iree_hal_task_queue_retire_cmd_t* cmd) {
+  iree_hal_semaphore_list_release(&cmd->signal_semaphores);
+  if (cmd->resource_set) iree_hal_resource_set_free(cmd->resource_set);
+  iree_task_scope_t* scope = cmd->task.header.scope;
+  iree_arena_allocator_t arena = cmd->arena;
+  cmd = NULL;
+  iree_arena_deinitialize(&arena);
+  iree_task_scope_end(scope);
+}
+
 //===----------------------------------------------------------------------===//
 // iree_hal_task_queue_t
 //===----------------------------------------------------------------------===//
 
 void iree_hal_task_queue_initialize(iree_string_view_t identifier,
+                                    iree_task_priority_t priority,
                                     iree_task_executor_t* executor,
                                     iree_arena_block_pool_t* block_pool,
                                     iree_hal_task_queue_t* out_queue) {
@@ -393,6 +460,7 @@ void iree_hal_task_queue_initialize(iree_string_view_t identifier,
   out_queue->block_pool = block_pool;
 
   iree_task_scope_initialize(identifier, &out_queue->scope);
+  iree_task_scope_set_priority(&out_queue->scope, priority);
 
   iree_hal_task_queue_state_initialize(&out_queue->state);
 
@@ -425,12 +493,23 @@ static iree_status_t iree_hal_task_queue_submit_batch(
   // NOTE: if we fail from here on we must drop the retire_cmd arena.
   iree_status_t status = iree_ok_status();
 
-  // A fence we'll use to detect when the entire submission has completed.
-  // TODO(benvanik): fold into the retire command.
-  iree_task_fence_t* fence = NULL;
-  status =
-      iree_task_executor_acquire_fence(queue->executor, &queue->scope, &fence);
-  iree_task_set_completion_task(&retire_cmd->task.header, &fence->header);
+  // Retain all buffers referenced by binding tables until the submission
+  // retires; callers are not required to keep them live themselves.
+  if (batch->binding_tables) {
+    status = iree_hal_resource_set_allocate(queue->block_pool,
+                                            &retire_cmd->resource_set);
+    for (iree_host_size_t i = 0;
+         i < batch->command_buffer_count && iree_status_is_ok(status); ++i) {
+      const iree_hal_buffer_binding_table_t* binding_table =
+          &batch->binding_tables[i];
+      for (iree_host_size_t j = 0;
+           j < binding_table->count && iree_status_is_ok(status); ++j) {
+        if (!binding_table->bindings[j].buffer) continue;
+        status = iree_hal_resource_set_insert(
+            retire_cmd->resource_set, 1, &binding_table->bindings[j].buffer);
+      }
+    }
+  }
 
   // Task to fork and wait for unsatisfied semaphore dependencies.
   // This is optional and only required if we have previous submissions still
@@ -448,13 +527,19 @@ static iree_status_t iree_hal_task_queue_submit_batch(
   if (iree_status_is_ok(status)) {
     status = iree_hal_task_queue_issue_cmd_allocate(
         &queue->scope, queue, &retire_cmd->task.header,
-        batch->command_buffer_count, batch->command_buffers, &retire_cmd->arena,
-        &issue_cmd);
+        batch->command_buffer_count, batch->command_buffers,
+        batch->binding_tables, &retire_cmd->arena, &issue_cmd);
   }
 
   // Last chance for failure - from here on we are submitting.
   if (IREE_UNLIKELY(!iree_status_is_ok(status))) {
-    iree_arena_deinitialize(&retire_cmd->arena);
+    // Semaphores retained by the wait command allocated from the arena must be
+    // released before the arena is dropped.
+    if (wait_cmd) {
+      iree_hal_task_queue_wait_cmd_cleanup(&wait_cmd->task.header,
+                                           iree_status_code(status));
+    }
+    iree_hal_task_queue_retire_cmd_discard(retire_cmd);
     return status;
   }
 
@@ -519,11 +604,12 @@ iree_status_t iree_hal_task_queue_submit_and_wait(
   iree_status_t status =
       iree_hal_task_queue_submit_batches(queue, batch_count, batches);
   if (iree_status_is_ok(status)) {
-    // Flush the pending submissions and begin processing, then wait until idle.
-    // TODO(benvanik): get a wait_handle we can pass to
-    // iree_task_executor_donate_caller - it'll flush + do work.
-    iree_task_executor_flush(queue->executor);
-    status = iree_hal_semaphore_wait(wait_semaphore, wait_value, timeout);
+    // Flush the pending submissions and begin processing, then wait until the
+    // semaphore is signaled. Donation will perform the work on this thread if
+    // the executor has no workers of its own.
+    status = iree_task_executor_donate_caller(
+        queue->executor, iree_hal_semaphore_await(wait_semaphore, wait_value),
+        timeout);
   }
 
   IREE_TRACE_ZONE_END(z0);
@@ -533,8 +619,8 @@ iree_status_t iree_hal_task_queue_submit_and_wait(
 iree_status_t iree_hal_task_queue_wait_idle(iree_hal_task_queue_t* queue,
                                             iree_timeout_t timeout) {
   IREE_TRACE_ZONE_BEGIN(z0);
-  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
-  iree_status_t status = iree_task_scope_wait_idle(&queue->scope, deadline_ns);
+  iree_status_t status = iree_task_executor_donate_caller(
+      queue->executor, iree_task_scope_await_idle(&queue->scope), timeout);
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
@@ -13,6 +13,7 @@
 #include "iree/base/internal/arena.h"
 #include "iree/base/internal/synchronization.h"
 #include "iree/hal/api.h"
+#include "iree/hal/drivers/local_task/task_profiler.h"
 #include "iree/hal/drivers/local_task/task_queue_state.h"
 #include "iree/task/executor.h"
 #include "iree/task/scope.h"
@@ -37,9 +38,15 @@ typedef struct iree_hal_task_queue_t {
   // The intra-queue synchronization (barriers/events) carries across command
   // buffers and this is used to rendezvous the tasks in each set.
   iree_hal_task_queue_state_t state;
+
+  // Profiler capturing the dispatches of command buffers submitted to the
+  // queue or NULL if not profiling. Only changed while the queue is idle.
+  iree_hal_task_profiler_t* profiler;
 } iree_hal_task_queue_t;
 
+// Initializes a queue whose tasks are all scheduled at |priority|.
 void iree_hal_task_queue_initialize(iree_string_view_t identifier,
+                                    iree_task_priority_t priority,
                                     iree_task_executor_t* executor,
                                     iree_arena_block_pool_t* block_pool,
                                     iree_hal_task_queue_t* out_queue);
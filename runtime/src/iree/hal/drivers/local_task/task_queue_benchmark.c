@@ -0,0 +1,157 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <stdint.h>
+#include <string.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/drivers/local_task/task_device.h"
+#include "iree/task/api.h"
+#include "iree/testing/benchmark.h"
+
+// Number of submissions made before waiting for them all to complete.
+#define IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH 16
+
+typedef struct iree_hal_task_queue_benchmark_t {
+  iree_task_executor_t* executor;
+  iree_hal_allocator_t* device_allocator;
+  iree_hal_device_t* device;
+  iree_hal_semaphore_t* semaphores[IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH];
+} iree_hal_task_queue_benchmark_t;
+
+static void iree_hal_task_queue_benchmark_initialize(
+    iree_host_size_t worker_count, iree_allocator_t host_allocator,
+    iree_hal_task_queue_benchmark_t* out_benchmark) {
+  memset(out_benchmark, 0, sizeof(*out_benchmark));
+
+  // A topology with no groups runs all work on the waiting caller.
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_group_count(worker_count, &topology);
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  IREE_CHECK_OK(iree_task_executor_create(options, &topology, host_allocator,
+                                          &out_benchmark->executor));
+  iree_task_topology_deinitialize(&topology);
+
+  IREE_CHECK_OK(iree_hal_allocator_create_heap(
+      iree_make_cstring_view("local"), host_allocator, host_allocator,
+      &out_benchmark->device_allocator));
+  iree_hal_task_device_params_t params;
+  iree_hal_task_device_params_initialize(&params);
+  IREE_CHECK_OK(iree_hal_task_device_create(
+      iree_make_cstring_view("local-task"), &params, out_benchmark->executor,
+      /*loader_count=*/0, /*loaders=*/NULL, out_benchmark->device_allocator,
+      host_allocator, &out_benchmark->device));
+  for (iree_host_size_t i = 0; i < IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH; ++i) {
+    IREE_CHECK_OK(iree_hal_semaphore_create(out_benchmark->device, 0ull,
+                                            &out_benchmark->semaphores[i]));
+  }
+}
+
+static void iree_hal_task_queue_benchmark_deinitialize(
+    iree_hal_task_queue_benchmark_t* benchmark) {
+  for (iree_host_size_t i = 0; i < IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH; ++i) {
+    iree_hal_semaphore_release(benchmark->semaphores[i]);
+  }
+  iree_hal_device_release(benchmark->device);
+  iree_hal_allocator_release(benchmark->device_allocator);
+  iree_task_executor_release(benchmark->executor);
+}
+
+// Measures the rate of submitting and retiring empty batches: the queue
+// overhead of every submission made by a program regardless of the work it
+// contains. Independent batches each signal their own semaphore as they may
+// retire in any order while chained batches wait on the value of a timeline
+// semaphore signaled by the previous batch and signal the next value.
+//
+// user_data is the worker count in the low bits and whether to chain the
+// batches in bit 16.
+static iree_status_t iree_hal_task_queue_benchmark_submit(
+    const iree_benchmark_def_t* benchmark_def,
+    iree_benchmark_state_t* benchmark_state) {
+  uintptr_t user_data = (uintptr_t)benchmark_def->user_data;
+  iree_host_size_t worker_count = (iree_host_size_t)(user_data & 0xFFFFu);
+  bool chain = (user_data >> 16) & 1;
+
+  iree_hal_task_queue_benchmark_t benchmark;
+  iree_hal_task_queue_benchmark_initialize(
+      worker_count, benchmark_state->host_allocator, &benchmark);
+
+  uint64_t round = 0;
+  uint64_t chain_value = 0;
+  uint64_t wait_values[IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH];
+  while (iree_benchmark_keep_running(benchmark_state,
+                                     IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH)) {
+    ++round;
+    for (int i = 0; i < IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH; ++i) {
+      uint64_t wait_value = chain_value;
+      uint64_t signal_value = chain ? ++chain_value : round;
+      wait_values[i] = round;
+      iree_hal_submission_batch_t batch;
+      memset(&batch, 0, sizeof(batch));
+      if (chain) {
+        batch.wait_semaphores.count = 1;
+        batch.wait_semaphores.semaphores = &benchmark.semaphores[0];
+        batch.wait_semaphores.payload_values = &wait_value;
+      }
+      batch.signal_semaphores.count = 1;
+      batch.signal_semaphores.semaphores =
+          &benchmark.semaphores[chain ? 0 : i];
+      batch.signal_semaphores.payload_values = &signal_value;
+      IREE_CHECK_OK(iree_hal_device_queue_submit(
+          benchmark.device, IREE_HAL_COMMAND_CATEGORY_ANY,
+          IREE_HAL_QUEUE_AFFINITY_ANY, 1, &batch));
+    }
+    if (chain) {
+      IREE_CHECK_OK(iree_hal_semaphore_wait(
+          benchmark.semaphores[0], chain_value, iree_infinite_timeout()));
+    } else {
+      iree_hal_semaphore_list_t wait_list = {
+          .count = IREE_HAL_TASK_QUEUE_BENCHMARK_DEPTH,
+          .semaphores = benchmark.semaphores,
+          .payload_values = wait_values,
+      };
+      IREE_CHECK_OK(iree_hal_device_wait_semaphores(
+          benchmark.device, IREE_HAL_WAIT_MODE_ALL, &wait_list,
+          iree_infinite_timeout()));
+    }
+  }
+
+  iree_hal_task_queue_benchmark_deinitialize(&benchmark);
+  return iree_ok_status();
+}
+
+int main(int argc, char** argv) {
+  iree_benchmark_initialize(&argc, argv);
+
+  // iree_hal_task_queue_benchmark_submit
+  {
+    iree_benchmark_def_t benchmark_def = {
+        .flags = IREE_BENCHMARK_FLAG_MEASURE_PROCESS_CPU_TIME |
+                 IREE_BENCHMARK_FLAG_USE_REAL_TIME,
+        .time_unit = IREE_BENCHMARK_UNIT_NANOSECOND,
+        .minimum_duration_ns = 0,
+        .iteration_count = 0,
+        .run = iree_hal_task_queue_benchmark_submit,
+    };
+    benchmark_def.user_data = (void*)1u;
+    iree_benchmark_register(iree_make_cstring_view("independent_1_worker"),
+                            &benchmark_def);
+    benchmark_def.user_data = (void*)4u;
+    iree_benchmark_register(iree_make_cstring_view("independent_4_workers"),
+                            &benchmark_def);
+    benchmark_def.user_data = (void*)((1u << 16) | 1u);
+    iree_benchmark_register(iree_make_cstring_view("chained_1_worker"),
+                            &benchmark_def);
+    benchmark_def.user_data = (void*)((1u << 16) | 4u);
+    iree_benchmark_register(iree_make_cstring_view("chained_4_workers"),
+                            &benchmark_def);
+  }
+
+  iree_benchmark_run_specified();
+  return 0;
+}
@@ -53,6 +53,7 @@ static iree_status_t iree_hal_task_semaphore_timepoint_callback(
 typedef struct iree_hal_task_semaphore_t {
   iree_hal_semaphore_t base;
   iree_allocator_t host_allocator;
+  iree_task_executor_t* executor;
   iree_event_pool_t* event_pool;
 
   // Guards all mutable fields. We expect low contention on semaphores and since
@@ -63,7 +64,11 @@ typedef struct iree_hal_task_semaphore_t {
   // Current signaled value. May be IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE to
   // indicate that the semaphore has been signaled for failure and
   // |failure_status| contains the error.
-  uint64_t current_value;
+  //
+  // Only updated with |mutex| held but may be loaded without it so that
+  // waiters can poll the payload. Stored as a signed atomic and must be read
+  // with iree_hal_task_semaphore_load_value.
+  iree_atomic_int64_t current_value;
 
   // OK or the status passed to iree_hal_semaphore_fail. Owned by the semaphore.
   iree_status_t failure_status;
@@ -77,10 +82,25 @@ static iree_hal_task_semaphore_t* iree_hal_task_semaphore_cast(
   return (iree_hal_task_semaphore_t*)base_value;
 }
 
+// Returns the current payload value of |semaphore| without taking its lock.
+static inline uint64_t iree_hal_task_semaphore_load_value(
+    iree_hal_task_semaphore_t* semaphore) {
+  return (uint64_t)iree_atomic_load_int64(&semaphore->current_value,
+                                          iree_memory_order_acquire);
+}
+
+// Stores |value| as the payload of |semaphore|. The semaphore mutex must be
+// held.
+static inline void iree_hal_task_semaphore_store_value_unsafe(
+    iree_hal_task_semaphore_t* semaphore, uint64_t value) {
+  iree_atomic_store_int64(&semaphore->current_value, (int64_t)value,
+                          iree_memory_order_release);
+}
+
 iree_status_t iree_hal_task_semaphore_create(
-    iree_event_pool_t* event_pool, uint64_t initial_value,
+    iree_task_executor_t* executor, uint64_t initial_value,
     iree_allocator_t host_allocator, iree_hal_semaphore_t** out_semaphore) {
-  IREE_ASSERT_ARGUMENT(event_pool);
+  IREE_ASSERT_ARGUMENT(executor);
   IREE_ASSERT_ARGUMENT(out_semaphore);
   *out_semaphore = NULL;
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -92,10 +112,13 @@ iree_status_t iree_hal_task_semaphore_create(
     iree_hal_semaphore_initialize(&iree_hal_task_semaphore_vtable,
                                   &semaphore->base);
     semaphore->host_allocator = host_allocator;
-    semaphore->event_pool = event_pool;
+    semaphore->executor = executor;
+    iree_task_executor_retain(executor);
+    semaphore->event_pool = iree_task_executor_event_pool(executor);
 
     iree_slim_mutex_initialize(&semaphore->mutex);
-    semaphore->current_value = initial_value;
+    iree_atomic_store_int64(&semaphore->current_value, (int64_t)initial_value,
+                            iree_memory_order_relaxed);
     semaphore->failure_status = iree_ok_status();
 
     *out_semaphore = &semaphore->base;
@@ -114,6 +137,7 @@ static void iree_hal_task_semaphore_destroy(
 
   iree_slim_mutex_deinitialize(&semaphore->mutex);
   iree_status_ignore(semaphore->failure_status);
+  iree_task_executor_release(semaphore->executor);
 
   iree_hal_semaphore_deinitialize(&semaphore->base);
   iree_allocator_free(host_allocator, semaphore);
@@ -133,7 +157,7 @@ static iree_status_t iree_hal_task_semaphore_query(
 
   iree_slim_mutex_lock(&semaphore->mutex);
 
-  *out_value = semaphore->current_value;
+  *out_value = iree_hal_task_semaphore_load_value(semaphore);
 
   iree_status_t status = iree_ok_status();
   if (*out_value >= IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE) {
@@ -152,8 +176,8 @@ static iree_status_t iree_hal_task_semaphore_signal(
 
   iree_slim_mutex_lock(&semaphore->mutex);
 
-  if (new_value <= semaphore->current_value) {
-    uint64_t current_value IREE_ATTRIBUTE_UNUSED = semaphore->current_value;
+  uint64_t current_value = iree_hal_task_semaphore_load_value(semaphore);
+  if (new_value <= current_value) {
     iree_slim_mutex_unlock(&semaphore->mutex);
     return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
                             "semaphore values must be monotonically "
@@ -162,7 +186,7 @@ static iree_status_t iree_hal_task_semaphore_signal(
                             current_value, new_value);
   }
 
-  semaphore->current_value = new_value;
+  iree_hal_task_semaphore_store_value_unsafe(semaphore, new_value);
 
   iree_slim_mutex_unlock(&semaphore->mutex);
 
@@ -190,7 +214,8 @@ static void iree_hal_task_semaphore_fail(iree_hal_semaphore_t* base_semaphore,
   }
 
   // Signal to our failure sentinel value.
-  semaphore->current_value = IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE;
+  iree_hal_task_semaphore_store_value_unsafe(
+      semaphore, IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE);
   semaphore->failure_status = status;
 
   iree_slim_mutex_unlock(&semaphore->mutex);
@@ -250,7 +275,7 @@ iree_status_t iree_hal_task_semaphore_enqueue_timepoint(
   iree_slim_mutex_lock(&semaphore->mutex);
 
   iree_status_t status = iree_ok_status();
-  if (semaphore->current_value >= minimum_value) {
+  if (iree_hal_task_semaphore_load_value(semaphore) >= minimum_value) {
     // Fast path: already satisfied.
   } else if (!iree_status_is_ok(semaphore->failure_status)) {
     // Semaphore failed; can't enqueue timepoints (they'll reject immediately).
@@ -279,34 +304,48 @@ iree_status_t iree_hal_task_semaphore_enqueue_timepoint(
   return status;
 }
 
-static iree_status_t iree_hal_task_semaphore_wait(
-    iree_hal_semaphore_t* base_semaphore, uint64_t value,
-    iree_timeout_t timeout) {
-  iree_hal_task_semaphore_t* semaphore =
-      iree_hal_task_semaphore_cast(base_semaphore);
+typedef struct iree_hal_task_semaphore_wait_state_t {
+  iree_hal_task_semaphore_t* semaphore;
+  uint64_t value;
+} iree_hal_task_semaphore_wait_state_t;
+
+// Returns true if the semaphore has reached the value (or failed).
+// Failure signals the semaphore to IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE so a
+// single lock-free load of the payload covers both.
+// Used with iree_condition_fn_t and must match that signature.
+static bool iree_hal_task_semaphore_is_reached(
+    const iree_hal_task_semaphore_wait_state_t* state) {
+  return iree_hal_task_semaphore_load_value(state->semaphore) >= state->value;
+}
 
+// Returns the wait result of |semaphore| once it has reached |value|:
+// IREE_STATUS_ABORTED if it has failed and otherwise OK.
+static iree_status_t iree_hal_task_semaphore_reached_status(
+    iree_hal_task_semaphore_t* semaphore) {
+  return iree_hal_task_semaphore_load_value(semaphore) >=
+                 IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE
+             ? iree_status_from_code(IREE_STATUS_ABORTED)
+             : iree_ok_status();
+}
+
+// Blocks the caller on a timepoint until |semaphore| reaches |value| or
+// |deadline_ns| elapses. The payload is checked again under the lock before
+// acquiring the timepoint: a signal that landed after any lock-free check
+// would otherwise have already notified and never resolve the timepoint.
+static iree_status_t iree_hal_task_semaphore_wait_timepoint(
+    iree_hal_task_semaphore_t* semaphore, uint64_t value,
+    iree_time_t deadline_ns) {
   iree_slim_mutex_lock(&semaphore->mutex);
 
-  if (!iree_status_is_ok(semaphore->failure_status)) {
-    // Fastest path: failed; return an error to tell callers to query for it.
+  if (iree_hal_task_semaphore_load_value(semaphore) >= value) {
     iree_slim_mutex_unlock(&semaphore->mutex);
-    return iree_status_from_code(IREE_STATUS_ABORTED);
-  } else if (semaphore->current_value >= value) {
-    // Fast path: already satisfied.
-    iree_slim_mutex_unlock(&semaphore->mutex);
-    return iree_ok_status();
-  } else if (iree_timeout_is_immediate(timeout)) {
-    // Not satisfied but a poll, so can avoid the expensive wait handle work.
-    iree_slim_mutex_unlock(&semaphore->mutex);
-    return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+    return iree_hal_task_semaphore_reached_status(semaphore);
   }
 
-  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
-
   // Slow path: acquire a timepoint while we hold the lock.
   iree_hal_task_timepoint_t timepoint;
   iree_status_t status = iree_hal_task_semaphore_acquire_timepoint(
-      semaphore, value, timeout, &timepoint);
+      semaphore, value, iree_make_deadline(deadline_ns), &timepoint);
 
   iree_slim_mutex_unlock(&semaphore->mutex);
   if (IREE_UNLIKELY(!iree_status_is_ok(status))) return status;
@@ -320,85 +359,268 @@ static iree_status_t iree_hal_task_semaphore_wait(
   }
   iree_event_pool_release(semaphore->event_pool, 1, &timepoint.event);
 
+  // Timepoints are also resolved when the semaphore fails.
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_task_semaphore_reached_status(semaphore);
+  }
   return status;
 }
 
-iree_status_t iree_hal_task_semaphore_multi_wait(
+static iree_status_t iree_hal_task_semaphore_wait(
+    iree_hal_semaphore_t* base_semaphore, uint64_t value,
+    iree_timeout_t timeout) {
+  iree_hal_task_semaphore_t* semaphore =
+      iree_hal_task_semaphore_cast(base_semaphore);
+
+  // Try to see if we can return immediately without taking the lock.
+  const uint64_t current_value = iree_hal_task_semaphore_load_value(semaphore);
+  if (current_value >= IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE) {
+    // Fastest path: failed; return an error to tell callers to query for it.
+    return iree_status_from_code(IREE_STATUS_ABORTED);
+  } else if (current_value >= value) {
+    // Fast path: already satisfied.
+    return iree_ok_status();
+  } else if (iree_timeout_is_immediate(timeout)) {
+    // Not satisfied but a poll, so can avoid the expensive wait handle work.
+    return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+  } else if (iree_task_executor_is_caller_only(semaphore->executor)) {
+    // Caller-only executor: nothing will make progress unless we do the work
+    // that signals the semaphore ourselves.
+    return iree_task_executor_donate_caller(
+        semaphore->executor, iree_hal_semaphore_await(base_semaphore, value),
+        timeout);
+  }
+
+  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
+
+  // Spin briefly on the payload in case the signal is imminent; if it arrives
+  // we avoid acquiring an event and blocking in the kernel.
+  iree_hal_task_semaphore_wait_state_t wait_state = {
+      .semaphore = semaphore,
+      .value = value,
+  };
+  if (iree_hal_semaphore_spin_until(
+          (iree_condition_fn_t)iree_hal_task_semaphore_is_reached,
+          (void*)&wait_state, deadline_ns)) {
+    return iree_hal_task_semaphore_reached_status(semaphore);
+  }
+
+  return iree_hal_task_semaphore_wait_timepoint(semaphore, value, deadline_ns);
+}
+
+// Wait source control function for a wait-any on an iree_hal_semaphore_list_t.
+// Only queries are supported as the wait source is only ever used when
+// donating to a caller-only executor (which never blocks in the wait source).
+static iree_status_t iree_hal_task_semaphore_list_wait_any_ctl(
+    iree_wait_source_t wait_source, iree_wait_source_command_t command,
+    const void* params, void** inout_ptr) {
+  if (command != IREE_WAIT_SOURCE_COMMAND_QUERY) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "semaphore list wait sources only support queries");
+  }
+  const iree_hal_semaphore_list_t* semaphore_list =
+      (const iree_hal_semaphore_list_t*)wait_source.self;
+  iree_status_code_t* out_wait_status_code = (iree_status_code_t*)inout_ptr;
+  *out_wait_status_code = IREE_STATUS_DEFERRED;
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    uint64_t current_value = 0;
+    iree_status_t status =
+        iree_hal_semaphore_query(semaphore_list->semaphores[i], &current_value);
+    if (!iree_status_is_ok(status)) {
+      *out_wait_status_code = iree_status_code(status);
+      iree_status_ignore(status);
+      break;
+    } else if (current_value >= semaphore_list->payload_values[i]) {
+      *out_wait_status_code = IREE_STATUS_OK;
+      break;
+    }
+  }
+  return iree_ok_status();
+}
+
+// Performs a multi-wait by donating the caller to a caller-only |executor|.
+static iree_status_t iree_hal_task_semaphore_multi_wait_donate(
     iree_hal_wait_mode_t wait_mode,
     const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout,
-    iree_event_pool_t* event_pool, iree_arena_block_pool_t* block_pool) {
-  IREE_ASSERT_ARGUMENT(semaphore_list);
-  if (semaphore_list->count == 0) {
-    return iree_ok_status();
-  } else if (semaphore_list->count == 1) {
-    // Fast-path for a single semaphore.
-    return iree_hal_semaphore_wait(semaphore_list->semaphores[0],
-                                   semaphore_list->payload_values[0], timeout);
+    iree_task_executor_t* executor) {
+  iree_convert_timeout_to_absolute(&timeout);
+  if (wait_mode == IREE_HAL_WAIT_MODE_ANY) {
+    iree_wait_source_t wait_source = {
+        .self = (void*)semaphore_list,
+        .data = 0,
+        .ctl = iree_hal_task_semaphore_list_wait_any_ctl,
+    };
+    return iree_task_executor_donate_caller(executor, wait_source, timeout);
   }
+  // Waits for all can be performed in any order; the total time is bounded by
+  // the shared absolute deadline.
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    IREE_RETURN_IF_ERROR(iree_task_executor_donate_caller(
+        executor,
+        iree_hal_semaphore_await(semaphore_list->semaphores[i],
+                                 semaphore_list->payload_values[i]),
+        timeout));
+  }
+  return iree_ok_status();
+}
 
-  IREE_TRACE_ZONE_BEGIN(z0);
+// Returns true if all semaphores in the list have reached their values (or
+// any has failed). Used with iree_condition_fn_t and must match that signature.
+static bool iree_hal_task_semaphore_list_all_reached(
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    const uint64_t current_value = iree_hal_task_semaphore_load_value(
+        iree_hal_task_semaphore_cast(semaphore_list->semaphores[i]));
+    if (current_value >= IREE_HAL_TASK_SEMAPHORE_FAILURE_VALUE) return true;
+    if (current_value < semaphore_list->payload_values[i]) return false;
+  }
+  return true;
+}
 
-  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
+// Returns true if any semaphore in the list has reached its value (or failed).
+// Used with iree_condition_fn_t and must match that signature.
+static bool iree_hal_task_semaphore_list_any_reached(
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    if (iree_hal_task_semaphore_load_value(iree_hal_task_semaphore_cast(
+            semaphore_list->semaphores[i])) >=
+        semaphore_list->payload_values[i]) {
+      return true;
+    }
+  }
+  return false;
+}
 
-  // Avoid heap allocations by using the device block pool for the wait set.
+// Returns the wait result of a list once its wait condition has been met:
+// IREE_STATUS_ABORTED if any semaphore has failed and otherwise OK.
+static iree_status_t iree_hal_task_semaphore_list_reached_status(
+    const iree_hal_semaphore_list_t* semaphore_list) {
+  for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+    iree_status_t status = iree_hal_task_semaphore_reached_status(
+        iree_hal_task_semaphore_cast(semaphore_list->semaphores[i]));
+    if (!iree_status_is_ok(status)) return status;
+  }
+  return iree_ok_status();
+}
+
+// Performs a wait-any by acquiring a timepoint on each unsatisfied semaphore
+// with all of them setting one shared event. Whichever timepoint resolves
+// first wakes the caller and no wait set is needed.
+static iree_status_t iree_hal_task_semaphore_multi_wait_any(
+    const iree_hal_semaphore_list_t* semaphore_list, iree_time_t deadline_ns,
+    iree_task_executor_t* executor, iree_arena_block_pool_t* block_pool) {
+  iree_event_pool_t* event_pool = iree_task_executor_event_pool(executor);
+  iree_event_t event;
+  IREE_RETURN_IF_ERROR(iree_event_pool_acquire(event_pool, 1, &event));
+
+  // Avoid heap allocations by using the device block pool for the timepoints.
   iree_arena_allocator_t arena;
   iree_arena_initialize(block_pool, &arena);
-  iree_wait_set_t* wait_set = NULL;
-  iree_status_t status = iree_wait_set_allocate(
-      semaphore_list->count, iree_arena_allocator(&arena), &wait_set);
-
-  // Acquire a wait handle for each semaphore timepoint we are to wait on.
-  // TODO(benvanik): flip this API around so we can batch request events from
-  // the event pool. We should be acquiring all required time points in one
-  // call.
   iree_host_size_t timepoint_count = 0;
   iree_hal_task_timepoint_t* timepoints = NULL;
-  iree_host_size_t total_timepoint_size =
-      semaphore_list->count * sizeof(timepoints[0]);
-  status =
-      iree_arena_allocate(&arena, total_timepoint_size, (void**)&timepoints);
+  iree_status_t status = iree_arena_allocate(
+      &arena, semaphore_list->count * sizeof(timepoints[0]),
+      (void**)&timepoints);
+
+  bool any_reached = false;
   if (iree_status_is_ok(status)) {
-    memset(timepoints, 0, total_timepoint_size);
     for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
       iree_hal_task_semaphore_t* semaphore =
           iree_hal_task_semaphore_cast(semaphore_list->semaphores[i]);
       iree_slim_mutex_lock(&semaphore->mutex);
-      if (semaphore->current_value >= semaphore_list->payload_values[i]) {
-        // Fast path: already satisfied.
+      if (iree_hal_task_semaphore_load_value(semaphore) >=
+          semaphore_list->payload_values[i]) {
+        // Fast path: already satisfied and there's no need to wait at all.
+        any_reached = true;
       } else {
-        // Slow path: get a native wait handle for the timepoint.
         iree_hal_task_timepoint_t* timepoint = &timepoints[timepoint_count++];
-        status = iree_hal_task_semaphore_acquire_timepoint(
-            semaphore, semaphore_list->payload_values[i], timeout, timepoint);
-        if (iree_status_is_ok(status)) {
-          status = iree_wait_set_insert(wait_set, timepoint->event);
-        }
+        timepoint->semaphore = &semaphore->base;
+        timepoint->event = event;
+        iree_hal_semaphore_acquire_timepoint(
+            &semaphore->base, semaphore_list->payload_values[i],
+            iree_make_deadline(deadline_ns),
+            (iree_hal_semaphore_callback_t){
+                .fn = iree_hal_task_semaphore_timepoint_callback,
+                .user_data = timepoint,
+            },
+            &timepoint->base);
       }
       iree_slim_mutex_unlock(&semaphore->mutex);
-      if (!iree_status_is_ok(status)) break;
+      if (any_reached) break;
     }
   }
 
   // Perform the wait.
-  if (iree_status_is_ok(status)) {
-    if (wait_mode == IREE_HAL_WAIT_MODE_ANY) {
-      status = iree_wait_any(wait_set, deadline_ns, /*out_wake_handle=*/NULL);
-    } else {
-      status = iree_wait_all(wait_set, deadline_ns);
-    }
+  if (iree_status_is_ok(status) && !any_reached) {
+    status = iree_wait_one(&event, deadline_ns);
   }
 
-  // TODO(benvanik): if we flip the API to multi-acquire events from the pool
-  // above then we can multi-release here too.
+  // The shared event must outlive every timepoint that may set it.
   for (iree_host_size_t i = 0; i < timepoint_count; ++i) {
-    iree_hal_semaphore_t* semaphore = timepoints[i].semaphore;
-    if (semaphore) {
-      iree_hal_semaphore_cancel_timepoint(semaphore, &timepoints[i].base);
-      iree_event_pool_release(event_pool, 1, &timepoints[i].event);
-    }
+    iree_hal_semaphore_cancel_timepoint(timepoints[i].semaphore,
+                                        &timepoints[i].base);
   }
-  iree_wait_set_free(wait_set);
   iree_arena_deinitialize(&arena);
+  iree_event_pool_release(event_pool, 1, &event);
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_task_semaphore_list_reached_status(semaphore_list);
+  }
+  return status;
+}
+
+iree_status_t iree_hal_task_semaphore_multi_wait(
+    iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout,
+    iree_task_executor_t* executor, iree_arena_block_pool_t* block_pool) {
+  IREE_ASSERT_ARGUMENT(semaphore_list);
+  if (semaphore_list->count == 0) {
+    return iree_ok_status();
+  } else if (semaphore_list->count == 1) {
+    // Fast-path for a single semaphore.
+    return iree_hal_semaphore_wait(semaphore_list->semaphores[0],
+                                   semaphore_list->payload_values[0], timeout);
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  if (iree_task_executor_is_caller_only(executor)) {
+    iree_status_t status = iree_hal_task_semaphore_multi_wait_donate(
+        wait_mode, semaphore_list, timeout, executor);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+
+  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
+
+  // Spin briefly polling the payloads in case the signals are imminent.
+  iree_condition_fn_t condition_fn =
+      wait_mode == IREE_HAL_WAIT_MODE_ALL
+          ? (iree_condition_fn_t)iree_hal_task_semaphore_list_all_reached
+          : (iree_condition_fn_t)iree_hal_task_semaphore_list_any_reached;
+  if (iree_hal_semaphore_spin_until(condition_fn, (void*)semaphore_list,
+                                    deadline_ns)) {
+    iree_status_t status =
+        iree_hal_task_semaphore_list_reached_status(semaphore_list);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+
+  iree_status_t status = iree_ok_status();
+  if (wait_mode == IREE_HAL_WAIT_MODE_ALL) {
+    // Waits for all can be performed in any order; the total time is bounded
+    // by the shared absolute deadline. Each wait needs at most one event and
+    // no wait set.
+    for (iree_host_size_t i = 0; i < semaphore_list->count; ++i) {
+      status = iree_hal_task_semaphore_wait_timepoint(
+          iree_hal_task_semaphore_cast(semaphore_list->semaphores[i]),
+          semaphore_list->payload_values[i], deadline_ns);
+      if (!iree_status_is_ok(status)) break;
+    }
+  } else {
+    status = iree_hal_task_semaphore_multi_wait_any(semaphore_list, deadline_ns,
+                                                    executor, block_pool);
+  }
 
   IREE_TRACE_ZONE_END(z0);
   return status;
@@ -153,12 +153,34 @@ typedef struct iree_hal_vulkan_queue_set_t {
 // TODO(benvanik): replace with flag list (easier to version).
 enum iree_hal_vulkan_device_flag_bits_t {
   IREE_HAL_VULKAN_DEVICE_FLAG_NONE = 0u,
+
+  // Submits command buffers containing only transfer commands to dedicated
+  // transfer queues when the device has them such that transfers may overlap
+  // with dispatches. Ordering between queues is established with the
+  // semaphores provided on submission. Dedicated transfer queues cannot
+  // execute dispatches and fills of transfer-only command buffers must have
+  // 4-byte aligned offsets and lengths.
+  IREE_HAL_VULKAN_DEVICE_FLAG_DEDICATED_TRANSFER_QUEUES = 1u << 0,
 };
 typedef uint32_t iree_hal_vulkan_device_flags_t;
 
 typedef struct iree_hal_vulkan_device_options_t {
   // Flags controlling device behavior.
   iree_hal_vulkan_device_flags_t flags;
+
+  // Optional path of a file the device pipeline cache is persisted to. If the
+  // file exists its contents initialize the cache and the cache is written
+  // back to it when the device is destroyed. Data written on a different
+  // physical device or driver version is ignored. Must remain valid for as
+  // long as devices may be created with the options.
+  iree_string_view_t pipeline_cache_path;
+
+  // Optional pipeline cache data as returned by
+  // iree_hal_vulkan_device_query_pipeline_cache_data used to initialize the
+  // device pipeline cache. Takes precedence over the contents of the file at
+  // |pipeline_cache_path|. Must remain valid for as long as devices may be
+  // created with the options.
+  iree_const_byte_span_t pipeline_cache_data;
 } iree_hal_vulkan_device_options_t;
 
 IREE_API_EXPORT void iree_hal_vulkan_device_options_initialize(
@@ -202,6 +224,18 @@ IREE_API_EXPORT iree_status_t iree_hal_vulkan_wrap_device(
     const iree_hal_vulkan_queue_set_t* transfer_queue_set,
     iree_allocator_t host_allocator, iree_hal_device_t** out_device);
 
+// Serializes the pipeline cache shared by all executables created on |device|
+// such that it can be provided as |pipeline_cache_data| to devices created in
+// later processes.
+//
+// |data_capacity| defines the number of bytes available in |data| and
+// |out_data_length| will be set with the number of bytes required. If
+// |data_capacity| is too small then IREE_STATUS_OUT_OF_RANGE will be returned.
+// To only query the required capacity |data| may be passed as NULL.
+IREE_API_EXPORT iree_status_t iree_hal_vulkan_device_query_pipeline_cache_data(
+    iree_hal_device_t* device, iree_host_size_t data_capacity, void* data,
+    iree_host_size_t* out_data_length);
+
 //===----------------------------------------------------------------------===//
 // iree_hal_vulkan_driver_t
 //===----------------------------------------------------------------------===//
@@ -163,6 +163,7 @@ iree_status_t BuiltinExecutables::FillBufferUnaligned(
   binding.buffer = target_buffer;
   binding.offset = 0;
   binding.length = IREE_WHOLE_BUFFER;
+  binding.buffer_slot = 0;
   IREE_RETURN_IF_ERROR(descriptor_set_arena->BindDescriptorSet(
       command_buffer, executable_layout_,
       IREE_HAL_VULKAN_BUILTIN_DESCRIPTOR_SET, /*binding_count=*/1, &binding));
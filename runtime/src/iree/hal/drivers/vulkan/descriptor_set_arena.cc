@@ -24,6 +24,42 @@ namespace vulkan {
 
 namespace {
 
+static void PopulateDescriptorBufferInfo(
+    const iree_hal_descriptor_set_binding_t& binding,
+    VkDescriptorBufferInfo* out_buffer_info) {
+  auto& buffer_info = *out_buffer_info;
+  buffer_info.buffer = iree_hal_vulkan_vma_buffer_handle(
+      iree_hal_buffer_allocated_buffer(binding.buffer));
+  buffer_info.offset =
+      iree_hal_buffer_byte_offset(binding.buffer) + binding.offset;
+  if (binding.length == IREE_WHOLE_BUFFER) {
+    buffer_info.range = VK_WHOLE_SIZE;
+  } else {
+    // Round up to a multiple of 32-bit. 32-bit is the most native bitwidth on
+    // GPUs; it has the best support compared to other bitwidths. We use VMA
+    // to manage GPU memory for us and VMA should already handled proper
+    // alignment when performing allocations; here we just need to provide the
+    // proper "view" to Vulkan drivers over the allocated memory.
+    //
+    // Note this is needed because we can see unusal buffers like
+    // tensor<3xi8>. Depending on GPU capabilities, this might not always be
+    // directly supported by the hardware. Under such circumstances, we need
+    // to emulate i8 support with i32. Shader CodeGen takes care of that: the
+    // shader will read the buffer as tensor<i32> and perform bit shifts to
+    // extract each byte and conduct computations. The extra additional byte
+    // is read but not really used by the shader. Here in application we need
+    // to match the ABI and provide the buffer as 32-bit aligned, otherwise
+    // the whole read by the shader is considered as out of bounds per the
+    // Vulkan spec. See
+    // https://github.com/iree-org/iree/issues/2022#issuecomment-640617234 for
+    // more details.
+    buffer_info.range = iree_device_align(
+        std::min(binding.length, iree_hal_buffer_byte_length(binding.buffer) -
+                                     binding.offset),
+        4);
+  }
+}
+
 static void PopulateDescriptorSetWriteInfos(
     iree_host_size_t binding_count,
     const iree_hal_descriptor_set_binding_t* bindings, VkDescriptorSet dst_set,
@@ -38,36 +74,7 @@ static void PopulateDescriptorSetWriteInfos(
     const auto& binding = bindings[i];
 
     auto& buffer_info = buffer_infos[i];
-    buffer_info.buffer = iree_hal_vulkan_vma_buffer_handle(
-        iree_hal_buffer_allocated_buffer(binding.buffer));
-    buffer_info.offset =
-        iree_hal_buffer_byte_offset(binding.buffer) + binding.offset;
-    if (binding.length == IREE_WHOLE_BUFFER) {
-      buffer_info.range = VK_WHOLE_SIZE;
-    } else {
-      // Round up to a multiple of 32-bit. 32-bit is the most native bitwidth on
-      // GPUs; it has the best support compared to other bitwidths. We use VMA
-      // to manage GPU memory for us and VMA should already handled proper
-      // alignment when performing allocations; here we just need to provide the
-      // proper "view" to Vulkan drivers over the allocated memory.
-      //
-      // Note this is needed because we can see unusal buffers like
-      // tensor<3xi8>. Depending on GPU capabilities, this might not always be
-      // directly supported by the hardware. Under such circumstances, we need
-      // to emulate i8 support with i32. Shader CodeGen takes care of that: the
-      // shader will read the buffer as tensor<i32> and perform bit shifts to
-      // extract each byte and conduct computations. The extra additional byte
-      // is read but not really used by the shader. Here in application we need
-      // to match the ABI and provide the buffer as 32-bit aligned, otherwise
-      // the whole read by the shader is considered as out of bounds per the
-      // Vulkan spec. See
-      // https://github.com/iree-org/iree/issues/2022#issuecomment-640617234 for
-      // more details.
-      buffer_info.range = iree_device_align(
-          std::min(binding.length, iree_hal_buffer_byte_length(binding.buffer) -
-                                       binding.offset),
-          4);
-    }
+    PopulateDescriptorBufferInfo(binding, &buffer_info);
 
     auto& write_info = write_infos[i];
     write_info.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
@@ -225,6 +232,32 @@ void DescriptorSetArena::PushDescriptorSet(
   VkPipelineLayout device_executable_layout =
       iree_hal_vulkan_native_executable_layout_handle(executable_layout);
 
+  // Fastest path using a descriptor update template that consumes the buffer
+  // infos directly. Only usable when every binding of the set is provided.
+  iree_host_size_t template_binding_count = 0;
+  VkDescriptorUpdateTemplate update_template =
+      iree_hal_vulkan_native_executable_layout_push_template(
+          executable_layout, set, &template_binding_count);
+  if (update_template != VK_NULL_HANDLE &&
+      binding_count == template_binding_count) {
+    scratch_arena_.Reset();
+    auto buffer_infos =
+        scratch_arena_.AllocateSpan<VkDescriptorBufferInfo>(binding_count);
+    uint64_t binding_mask = 0;
+    for (iree_host_size_t i = 0; i < binding_count; ++i) {
+      uint32_t ordinal = bindings[i].binding;
+      if (ordinal >= template_binding_count) break;
+      PopulateDescriptorBufferInfo(bindings[i], &buffer_infos[ordinal]);
+      binding_mask |= 1ull << ordinal;
+    }
+    if (binding_mask == (1ull << template_binding_count) - 1) {
+      syms().vkCmdPushDescriptorSetWithTemplateKHR(
+          command_buffer, update_template, device_executable_layout, set,
+          buffer_infos.data());
+      return;
+    }
+  }
+
   // Get a list of VkWriteDescriptorSet structs with all bound buffers.
   iree_host_size_t write_info_count = 0;
   VkWriteDescriptorSet* write_infos = NULL;
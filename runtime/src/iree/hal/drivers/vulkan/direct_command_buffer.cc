@@ -34,6 +34,8 @@ typedef struct iree_hal_vulkan_direct_command_buffer_t {
   iree_hal_command_buffer_t base;
   VkDeviceHandle* logical_device;
   iree_hal_vulkan_tracing_context_t* tracing_context;
+  // Profiler capturing dispatches recorded into the command buffer, if any.
+  iree_hal_vulkan_profiler_t* profiler;
   iree_arena_block_pool_t* block_pool;
 
   VkCommandPoolHandle* command_pool;
@@ -84,6 +86,7 @@ iree_status_t iree_hal_vulkan_direct_command_buffer_allocate(
     iree_hal_command_category_t command_categories,
     iree_hal_queue_affinity_t queue_affinity,
     iree_hal_vulkan_tracing_context_t* tracing_context,
+    iree_hal_vulkan_profiler_t* profiler,
     iree::hal::vulkan::DescriptorPoolCache* descriptor_pool_cache,
     iree::hal::vulkan::BuiltinExecutables* builtin_executables,
     iree_arena_block_pool_t* block_pool,
@@ -113,9 +116,16 @@ iree_status_t iree_hal_vulkan_direct_command_buffer_allocate(
   if (iree_status_is_ok(status)) {
     iree_hal_command_buffer_initialize(
         device, mode, command_categories, queue_affinity,
-        &iree_hal_vulkan_direct_command_buffer_vtable, &command_buffer->base);
+        /*binding_capacity=*/0, &iree_hal_vulkan_direct_command_buffer_vtable,
+        &command_buffer->base);
     command_buffer->logical_device = logical_device;
     command_buffer->tracing_context = tracing_context;
+    // Reusable command buffers would overwrite their timestamps each time they
+    // are submitted and are not captured.
+    command_buffer->profiler =
+        iree_all_bits_set(mode, IREE_HAL_COMMAND_BUFFER_MODE_ONE_SHOT)
+            ? profiler
+            : NULL;
     command_buffer->block_pool = block_pool;
     command_buffer->command_pool = command_pool;
     command_buffer->handle = handle;
@@ -547,6 +557,17 @@ static iree_status_t iree_hal_vulkan_direct_command_buffer_fill_buffer(
   // fill operations, if needed.
 
   if (target_offset % 4 != 0 || length % 4 != 0) {
+    // Transfer-only command buffers may be recorded for queues that are unable
+    // to execute the polyfill dispatch.
+    if (!iree_all_bits_set(
+            iree_hal_command_buffer_allowed_categories(base_command_buffer),
+            IREE_HAL_COMMAND_CATEGORY_DISPATCH)) {
+      return iree_make_status(
+          IREE_STATUS_UNIMPLEMENTED,
+          "unaligned fills (offset %" PRIdsz ", length %" PRIdsz
+          ") require a command buffer allowing dispatches",
+          target_offset, length);
+    }
     // TODO(scotttodd): only restore push constants that have been modified?
     //                  (this can pass uninitialized memory right now, which
     //                   *should* be safe but is wasteful)
@@ -728,6 +749,41 @@ static iree_status_t iree_hal_vulkan_direct_command_buffer_bind_descriptor_set(
   return iree_ok_status();
 }
 
+// Appends a dispatch to the command buffer profiler, if any, and writes the
+// timestamp marking its start. The returned |out_dispatch| must be passed to
+// iree_hal_vulkan_direct_command_buffer_end_profiled_dispatch after the
+// dispatch has been recorded.
+static iree_status_t
+iree_hal_vulkan_direct_command_buffer_begin_profiled_dispatch(
+    iree_hal_vulkan_direct_command_buffer_t* command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z,
+    iree_hal_vulkan_profiler_dispatch_t* out_dispatch) {
+  out_dispatch->query_pool = VK_NULL_HANDLE;
+  out_dispatch->query_index = 0;
+  if (!command_buffer->profiler) return iree_ok_status();
+  IREE_RETURN_IF_ERROR(iree_hal_vulkan_profiler_append_dispatch(
+      command_buffer->profiler, executable, entry_point, workgroup_x,
+      workgroup_y, workgroup_z, out_dispatch));
+  command_buffer->syms->vkCmdResetQueryPool(command_buffer->handle,
+                                            out_dispatch->query_pool,
+                                            out_dispatch->query_index, 2);
+  command_buffer->syms->vkCmdWriteTimestamp(
+      command_buffer->handle, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+      out_dispatch->query_pool, out_dispatch->query_index);
+  return iree_ok_status();
+}
+
+// Writes the timestamp marking the end of a profiled |dispatch|.
+static void iree_hal_vulkan_direct_command_buffer_end_profiled_dispatch(
+    iree_hal_vulkan_direct_command_buffer_t* command_buffer,
+    const iree_hal_vulkan_profiler_dispatch_t* dispatch) {
+  if (dispatch->query_pool == VK_NULL_HANDLE) return;
+  command_buffer->syms->vkCmdWriteTimestamp(
+      command_buffer->handle, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+      dispatch->query_pool, dispatch->query_index + 1);
+}
+
 static iree_status_t iree_hal_vulkan_direct_command_buffer_dispatch(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_hal_executable_t* executable, int32_t entry_point,
@@ -758,8 +814,15 @@ static iree_status_t iree_hal_vulkan_direct_command_buffer_dispatch(
   command_buffer->syms->vkCmdBindPipeline(
       command_buffer->handle, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline_handle);
 
+  iree_hal_vulkan_profiler_dispatch_t profiled_dispatch;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_vulkan_direct_command_buffer_begin_profiled_dispatch(
+          command_buffer, executable, entry_point, workgroup_x, workgroup_y,
+          workgroup_z, &profiled_dispatch));
   command_buffer->syms->vkCmdDispatch(command_buffer->handle, workgroup_x,
                                       workgroup_y, workgroup_z);
+  iree_hal_vulkan_direct_command_buffer_end_profiled_dispatch(
+      command_buffer, &profiled_dispatch);
 
   IREE_VULKAN_TRACE_ZONE_END(command_buffer->tracing_context,
                              command_buffer->handle);
@@ -800,8 +863,16 @@ static iree_status_t iree_hal_vulkan_direct_command_buffer_dispatch_indirect(
   VkBuffer workgroups_device_buffer = iree_hal_vulkan_vma_buffer_handle(
       iree_hal_buffer_allocated_buffer(workgroups_buffer));
   workgroups_offset += iree_hal_buffer_byte_offset(workgroups_buffer);
+  // The workgroup count is only known on the device and is recorded as 0.
+  iree_hal_vulkan_profiler_dispatch_t profiled_dispatch;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_vulkan_direct_command_buffer_begin_profiled_dispatch(
+          command_buffer, executable, entry_point, 0, 0, 0,
+          &profiled_dispatch));
   command_buffer->syms->vkCmdDispatchIndirect(
       command_buffer->handle, workgroups_device_buffer, workgroups_offset);
+  iree_hal_vulkan_direct_command_buffer_end_profiled_dispatch(
+      command_buffer, &profiled_dispatch);
 
   IREE_VULKAN_TRACE_ZONE_END(command_buffer->tracing_context,
                              command_buffer->handle);
@@ -12,6 +12,7 @@
 #include "iree/hal/drivers/vulkan/builtin_executables.h"
 #include "iree/hal/drivers/vulkan/descriptor_pool_cache.h"
 #include "iree/hal/drivers/vulkan/handle_util.h"
+#include "iree/hal/drivers/vulkan/profiler.h"
 #include "iree/hal/drivers/vulkan/tracing.h"
 
 #ifdef __cplusplus
@@ -22,6 +23,9 @@ typedef struct iree_arena_block_pool_t iree_arena_block_pool_t;
 
 // Creates a command buffer that directly records into a VkCommandBuffer.
 //
+// Dispatches recorded into one-shot command buffers are captured by |profiler|
+// if provided.
+//
 // NOTE: the |block_pool| must remain live for the lifetime of the command
 // buffers that use it.
 iree_status_t iree_hal_vulkan_direct_command_buffer_allocate(
@@ -32,6 +36,7 @@ iree_status_t iree_hal_vulkan_direct_command_buffer_allocate(
     iree_hal_command_category_t command_categories,
     iree_hal_queue_affinity_t queue_affinity,
     iree_hal_vulkan_tracing_context_t* tracing_context,
+    iree_hal_vulkan_profiler_t* profiler,
     iree::hal::vulkan::DescriptorPoolCache* descriptor_pool_cache,
     iree::hal::vulkan::BuiltinExecutables* builtin_executables,
     iree_arena_block_pool_t* block_pool,
@@ -7,11 +7,13 @@
 #include "iree/hal/drivers/vulkan/direct_command_queue.h"
 
 #include <cstdint>
+#include <utility>
 
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/vulkan/direct_command_buffer.h"
 #include "iree/hal/drivers/vulkan/dynamic_symbols.h"
 #include "iree/hal/drivers/vulkan/native_semaphore.h"
+#include "iree/hal/drivers/vulkan/rebindable_command_buffer.h"
 #include "iree/hal/drivers/vulkan/status_util.h"
 #include "iree/hal/drivers/vulkan/tracing.h"
 #include "iree/hal/drivers/vulkan/util/ref_ptr.h"
@@ -23,9 +25,15 @@ namespace vulkan {
 DirectCommandQueue::DirectCommandQueue(
     VkDeviceHandle* logical_device,
     iree_hal_command_category_t supported_categories, VkQueue queue)
-    : CommandQueue(logical_device, supported_categories, queue) {}
+    : CommandQueue(logical_device, supported_categories, queue) {
+  iree_slim_mutex_initialize(&pending_mutex_);
+  pending_arena_ = &arenas_[0];
+  submit_arena_ = &arenas_[1];
+}
 
-DirectCommandQueue::~DirectCommandQueue() = default;
+DirectCommandQueue::~DirectCommandQueue() {
+  iree_slim_mutex_deinitialize(&pending_mutex_);
+}
 
 iree_status_t DirectCommandQueue::TranslateBatchInfo(
     const iree_hal_submission_batch_t* batch, VkSubmitInfo* submit_info,
@@ -62,8 +70,17 @@ iree_status_t DirectCommandQueue::TranslateBatchInfo(
   auto command_buffer_handles =
       arena->AllocateSpan<VkCommandBuffer>(batch->command_buffer_count);
   for (iree_host_size_t i = 0; i < batch->command_buffer_count; ++i) {
-    command_buffer_handles[i] =
-        iree_hal_vulkan_direct_command_buffer_handle(batch->command_buffers[i]);
+    iree_hal_command_buffer_t* command_buffer = batch->command_buffers[i];
+    if (iree_hal_vulkan_rebindable_command_buffer_isa(command_buffer)) {
+      IREE_RETURN_IF_ERROR(iree_hal_vulkan_rebindable_command_buffer_resolve(
+          command_buffer,
+          batch->binding_tables ? batch->binding_tables[i]
+                                : iree_hal_buffer_binding_table_empty(),
+          batch->signal_semaphores, &command_buffer_handles[i]));
+    } else {
+      command_buffer_handles[i] =
+          iree_hal_vulkan_direct_command_buffer_handle(command_buffer);
+    }
   }
 
   submit_info->sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
@@ -96,27 +113,75 @@ iree_status_t DirectCommandQueue::Submit(
     iree_host_size_t batch_count, const iree_hal_submission_batch_t* batches) {
   IREE_TRACE_SCOPE0("DirectCommandQueue::Submit");
 
-  // Map the submission batches to VkSubmitInfos.
-  // Note that we must keep all arrays referenced alive until submission
+  // Map the submission batches to VkSubmitInfos and append them to the pending
+  // list. Note that we must keep all arrays referenced alive until submission
   // completes and since there are a bunch of them we use an arena.
-  Arena arena(4 * 1024);
-  auto submit_infos = arena.AllocateSpan<VkSubmitInfo>(batch_count);
-  auto timeline_submit_infos =
-      arena.AllocateSpan<VkTimelineSemaphoreSubmitInfo>(batch_count);
-  for (int i = 0; i < batch_count; ++i) {
-    IREE_RETURN_IF_ERROR(TranslateBatchInfo(&batches[i], &submit_infos[i],
-                                            &timeline_submit_infos[i], &arena));
+  iree_slim_mutex_lock(&pending_mutex_);
+  size_t base_submit_info_count = pending_submit_infos_.size();
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < batch_count; ++i) {
+    auto* timeline_submit_info =
+        pending_arena_->Allocate<VkTimelineSemaphoreSubmitInfo>();
+    VkSubmitInfo submit_info;
+    status = TranslateBatchInfo(&batches[i], &submit_info,
+                                timeline_submit_info, pending_arena_);
+    if (!iree_status_is_ok(status)) break;
+    pending_submit_infos_.push_back(submit_info);
+  }
+  if (!iree_status_is_ok(status)) {
+    // Drop any of our batches that were translated; arena storage is reclaimed
+    // when the pending submissions are next submitted.
+    pending_submit_infos_.resize(base_submit_info_count);
+    iree_slim_mutex_unlock(&pending_mutex_);
+    return status;
   }
+  uint64_t ticket = ++pending_ticket_;
+  iree_slim_mutex_unlock(&pending_mutex_);
 
+  // Submit everything pending, including ours, unless another caller already
+  // did so while we were waiting for the queue.
   iree_slim_mutex_lock(&queue_mutex_);
+  status = FlushPending(ticket);
+  iree_slim_mutex_unlock(&queue_mutex_);
+  return status;
+}
+
+iree_status_t DirectCommandQueue::FlushPending(uint64_t ticket) {
+  if (ticket <= submitted_ticket_) {
+    if (ticket >= failed_ticket_begin_ && ticket <= failed_ticket_end_) {
+      return iree_make_status(failed_status_code_,
+                              "vkQueueSubmit of coalesced submissions failed");
+    }
+    return iree_ok_status();
+  }
+
+  // Take ownership of all pending submissions. The storage they were
+  // translated into is swapped such that new submissions can be appended while
+  // we submit.
+  iree_slim_mutex_lock(&pending_mutex_);
+  std::swap(pending_arena_, submit_arena_);
+  pending_submit_infos_.swap(submit_infos_);
+  uint64_t first_ticket = submitted_ticket_ + 1;
+  uint64_t last_ticket = pending_ticket_;
+  iree_slim_mutex_unlock(&pending_mutex_);
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (int64_t)(last_ticket - first_ticket + 1));
   iree_status_t status = VK_RESULT_TO_STATUS(
-      syms()->vkQueueSubmit(queue_, static_cast<uint32_t>(submit_infos.size()),
-                            submit_infos.data(), VK_NULL_HANDLE),
+      syms()->vkQueueSubmit(queue_, static_cast<uint32_t>(submit_infos_.size()),
+                            submit_infos_.data(), VK_NULL_HANDLE),
       "vkQueueSubmit");
-  iree_slim_mutex_unlock(&queue_mutex_);
-  IREE_RETURN_IF_ERROR(status);
+  IREE_TRACE_ZONE_END(z0);
 
-  return iree_ok_status();
+  submitted_ticket_ = last_ticket;
+  if (!iree_status_is_ok(status)) {
+    failed_ticket_begin_ = first_ticket;
+    failed_ticket_end_ = last_ticket;
+    failed_status_code_ = iree_status_code(status);
+  }
+  submit_infos_.clear();
+  submit_arena_->Reset();
+  return status;
 }
 
 iree_status_t DirectCommandQueue::WaitIdle(iree_timeout_t timeout) {
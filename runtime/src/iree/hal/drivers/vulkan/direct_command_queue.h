@@ -11,6 +11,8 @@
 #include "iree/hal/api.h"
 #include "iree/hal/drivers/vulkan/command_queue.h"
 #include "iree/hal/drivers/vulkan/handle_util.h"
+#include <vector>
+
 #include "iree/hal/drivers/vulkan/util/arena.h"
 
 namespace iree {
@@ -18,6 +20,13 @@ namespace hal {
 namespace vulkan {
 
 // Command queue implementation directly maps to VkQueue.
+//
+// Submissions from concurrent callers are coalesced: each caller translates its
+// batches into a shared pending list and whichever caller next acquires the
+// queue submits everything pending with a single vkQueueSubmit. Callers whose
+// batches were submitted by another caller return without calling into the
+// driver. The translation storage is retained across submissions to avoid
+// reallocating it per call.
 class DirectCommandQueue final : public CommandQueue {
  public:
   DirectCommandQueue(VkDeviceHandle* logical_device,
@@ -34,6 +43,34 @@ class DirectCommandQueue final : public CommandQueue {
   iree_status_t TranslateBatchInfo(
       const iree_hal_submission_batch_t* batch, VkSubmitInfo* submit_info,
       VkTimelineSemaphoreSubmitInfo* timeline_submit_info, Arena* arena);
+
+  // Submits all pending submissions up to and including |ticket| if another
+  // caller has not already done so. Must be called with queue_mutex_ held.
+  iree_status_t FlushPending(uint64_t ticket);
+
+  // Two sets of translation storage: one receives pending submissions while
+  // the other is owned by the caller submitting to the queue.
+  Arena arenas_[2];
+
+  // Submissions that have been translated but not yet submitted.
+  // Each call to Submit is assigned an increasing ticket.
+  iree_slim_mutex_t pending_mutex_;
+  Arena* pending_arena_ IREE_GUARDED_BY(pending_mutex_);
+  std::vector<VkSubmitInfo> pending_submit_infos_
+      IREE_GUARDED_BY(pending_mutex_);
+  uint64_t pending_ticket_ IREE_GUARDED_BY(pending_mutex_) = 0;
+
+  // Storage of the submissions being submitted to the queue.
+  Arena* submit_arena_ IREE_GUARDED_BY(queue_mutex_);
+  std::vector<VkSubmitInfo> submit_infos_ IREE_GUARDED_BY(queue_mutex_);
+  // The last ticket that has been submitted to the queue.
+  uint64_t submitted_ticket_ IREE_GUARDED_BY(queue_mutex_) = 0;
+  // Tickets (inclusive) of the most recent failed submission and its status
+  // code. Callers whose batches were part of it return the failure.
+  uint64_t failed_ticket_begin_ IREE_GUARDED_BY(queue_mutex_) = 0;
+  uint64_t failed_ticket_end_ IREE_GUARDED_BY(queue_mutex_) = 0;
+  iree_status_code_t failed_status_code_ IREE_GUARDED_BY(queue_mutex_) =
+      IREE_STATUS_OK;
 };
 
 }  // namespace vulkan
@@ -207,6 +207,16 @@ iree_hal_vulkan_populate_enabled_device_extensions(
     } else if (strcmp(extension_name,
                       VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME) == 0) {
       extensions.calibrated_timestamps = true;
+    } else if (strcmp(extension_name,
+                      VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME) == 0) {
+      extensions.external_memory_fd = true;
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    } else if (
+        strcmp(extension_name,
+               VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME) ==
+        0) {
+      extensions.external_memory_android_hardware_buffer = true;
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
     }
   }
   return extensions;
@@ -229,5 +239,13 @@ iree_hal_vulkan_infer_enabled_device_extensions(
   if (device_syms->vkGetCalibratedTimestampsEXT) {
     extensions.calibrated_timestamps = true;
   }
+  if (device_syms->vkGetMemoryFdPropertiesKHR) {
+    extensions.external_memory_fd = true;
+  }
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+  if (device_syms->vkGetAndroidHardwareBufferPropertiesANDROID) {
+    extensions.external_memory_android_hardware_buffer = true;
+  }
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
   return extensions;
 }
@@ -80,6 +80,10 @@ typedef struct iree_hal_vulkan_device_extensions_t {
   bool host_query_reset : 1;
   // VK_EXT_calibrated_timestamps is enabled.
   bool calibrated_timestamps : 1;
+  // VK_KHR_external_memory_fd is enabled.
+  bool external_memory_fd : 1;
+  // VK_ANDROID_external_memory_android_hardware_buffer is enabled.
+  bool external_memory_android_hardware_buffer : 1;
 } iree_hal_vulkan_device_extensions_t;
 
 // Returns a bitfield with all of the provided extension names.
@@ -22,6 +22,9 @@ typedef struct iree_hal_vulkan_native_descriptor_set_layout_t {
   iree_hal_resource_t resource;
   VkDeviceHandle* logical_device;
   VkDescriptorSetLayout handle;
+  // Number of bindings pushed with a descriptor update template or 0 if the
+  // layout must be pushed with individual descriptor writes.
+  iree_host_size_t push_template_binding_count;
 } iree_hal_vulkan_native_descriptor_set_layout_t;
 
 namespace {
@@ -37,6 +40,23 @@ iree_hal_vulkan_native_descriptor_set_layout_cast(
   return (iree_hal_vulkan_native_descriptor_set_layout_t*)base_value;
 }
 
+// Returns the number of bindings if |bindings| are storage buffers with
+// ordinals densely packed from 0 (in any order), otherwise 0.
+static iree_host_size_t iree_hal_vulkan_dense_storage_buffer_binding_count(
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_layout_binding_t* bindings) {
+  if (binding_count == 0 || binding_count >= 64) return 0;
+  uint64_t binding_mask = 0;
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    if (bindings[i].type != IREE_HAL_DESCRIPTOR_TYPE_STORAGE_BUFFER ||
+        bindings[i].binding >= binding_count) {
+      return 0;
+    }
+    binding_mask |= 1ull << bindings[i].binding;
+  }
+  return binding_mask == (1ull << binding_count) - 1 ? binding_count : 0;
+}
+
 static iree_status_t iree_hal_vulkan_create_descriptor_set_layout(
     VkDeviceHandle* logical_device,
     iree_hal_descriptor_set_layout_usage_type_t usage_type,
@@ -120,6 +140,12 @@ iree_status_t iree_hal_vulkan_native_descriptor_set_layout_create(
         &descriptor_set_layout->resource);
     descriptor_set_layout->logical_device = logical_device;
     descriptor_set_layout->handle = handle;
+    if (usage_type == IREE_HAL_DESCRIPTOR_SET_LAYOUT_USAGE_TYPE_PUSH_ONLY &&
+        logical_device->enabled_extensions().push_descriptors) {
+      descriptor_set_layout->push_template_binding_count =
+          iree_hal_vulkan_dense_storage_buffer_binding_count(binding_count,
+                                                             bindings);
+    }
     *out_descriptor_set_layout =
         (iree_hal_descriptor_set_layout_t*)descriptor_set_layout;
   } else {
@@ -154,6 +180,15 @@ VkDescriptorSetLayout iree_hal_vulkan_native_descriptor_set_layout_handle(
   return descriptor_set_layout->handle;
 }
 
+iree_host_size_t
+iree_hal_vulkan_native_descriptor_set_layout_push_binding_count(
+    iree_hal_descriptor_set_layout_t* base_descriptor_set_layout) {
+  iree_hal_vulkan_native_descriptor_set_layout_t* descriptor_set_layout =
+      iree_hal_vulkan_native_descriptor_set_layout_cast(
+          base_descriptor_set_layout);
+  return descriptor_set_layout->push_template_binding_count;
+}
+
 namespace {
 const iree_hal_descriptor_set_layout_vtable_t
     iree_hal_vulkan_native_descriptor_set_layout_vtable = {
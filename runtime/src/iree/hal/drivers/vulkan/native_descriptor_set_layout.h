@@ -27,6 +27,13 @@ iree_status_t iree_hal_vulkan_native_descriptor_set_layout_create(
 VkDescriptorSetLayout iree_hal_vulkan_native_descriptor_set_layout_handle(
     iree_hal_descriptor_set_layout_t* base_descriptor_set_layout);
 
+// Returns the number of bindings in the layout if it is a push descriptor
+// layout of storage buffers with binding ordinals densely packed from 0 such
+// that it can be pushed with a descriptor update template, otherwise 0.
+iree_host_size_t
+iree_hal_vulkan_native_descriptor_set_layout_push_binding_count(
+    iree_hal_descriptor_set_layout_t* base_descriptor_set_layout);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -317,6 +317,13 @@ static void iree_hal_vulkan_native_executable_destroy(
   IREE_TRACE_ZONE_END(z0);
 }
 
+iree_host_size_t iree_hal_vulkan_native_executable_entry_point_count(
+    iree_hal_executable_t* base_executable) {
+  iree_hal_vulkan_native_executable_t* executable =
+      iree_hal_vulkan_native_executable_cast(base_executable);
+  return executable->entry_point_count;
+}
+
 void iree_hal_vulkan_native_executable_entry_point_source_location(
     iree_hal_executable_t* base_executable, iree_host_size_t entry_ordinal,
     iree_hal_vulkan_source_location_t* out_source_location) {
@@ -34,6 +34,10 @@ iree_status_t iree_hal_vulkan_native_executable_create(
     const iree_hal_executable_params_t* executable_params,
     iree_hal_executable_t** out_executable);
 
+// Returns the total number of entry points in |executable|.
+iree_host_size_t iree_hal_vulkan_native_executable_entry_point_count(
+    iree_hal_executable_t* executable);
+
 // Returns the source location for the given entry point. May be empty if not
 // available.
 void iree_hal_vulkan_native_executable_entry_point_source_location(
@@ -23,6 +23,9 @@ typedef struct iree_hal_vulkan_native_executable_layout_t {
   iree_hal_resource_t resource;
   VkDeviceHandle* logical_device;
   VkPipelineLayout handle;
+  // Descriptor update templates for pushing each set or VK_NULL_HANDLE if not
+  // supported by the set; stored in the same allocation as the layout.
+  VkDescriptorUpdateTemplate* push_templates;
   iree_host_size_t set_layout_count;
   iree_hal_descriptor_set_layout_t* set_layouts[];
 } iree_hal_vulkan_native_executable_layout_t;
@@ -81,6 +84,56 @@ static void iree_hal_vulkan_destroy_pipeline_layout(
                                                   logical_device->allocator());
 }
 
+// Returns true if descriptor sets can be pushed with update templates.
+static bool iree_hal_vulkan_supports_push_templates(
+    VkDeviceHandle* logical_device) {
+  const auto& syms = logical_device->syms();
+  return logical_device->enabled_extensions().push_descriptors &&
+         syms->vkCmdPushDescriptorSetWithTemplateKHR &&
+         syms->vkCreateDescriptorUpdateTemplate &&
+         syms->vkDestroyDescriptorUpdateTemplate;
+}
+
+// Creates a template for pushing |binding_count| storage buffers with dense
+// binding ordinals to |set| of |pipeline_layout|. Pushing with a template
+// passes the buffer infos directly instead of requiring a
+// VkWriteDescriptorSet per binding on every dispatch.
+static iree_status_t iree_hal_vulkan_create_push_template(
+    VkDeviceHandle* logical_device, VkPipelineLayout pipeline_layout,
+    uint32_t set, iree_host_size_t binding_count,
+    VkDescriptorUpdateTemplate* out_handle) {
+  VkDescriptorUpdateTemplateEntry* entries =
+      (VkDescriptorUpdateTemplateEntry*)iree_alloca(
+          binding_count * sizeof(VkDescriptorUpdateTemplateEntry));
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    entries[i].dstBinding = (uint32_t)i;
+    entries[i].dstArrayElement = 0;
+    entries[i].descriptorCount = 1;
+    entries[i].descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    entries[i].offset = i * sizeof(VkDescriptorBufferInfo);
+    entries[i].stride = sizeof(VkDescriptorBufferInfo);
+  }
+
+  VkDescriptorUpdateTemplateCreateInfo create_info;
+  create_info.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+  create_info.pNext = nullptr;
+  create_info.flags = 0;
+  create_info.descriptorUpdateEntryCount = (uint32_t)binding_count;
+  create_info.pDescriptorUpdateEntries = entries;
+  create_info.templateType =
+      VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_PUSH_DESCRIPTORS_KHR;
+  create_info.descriptorSetLayout = VK_NULL_HANDLE;
+  create_info.pipelineBindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+  create_info.pipelineLayout = pipeline_layout;
+  create_info.set = set;
+
+  return VK_RESULT_TO_STATUS(
+      logical_device->syms()->vkCreateDescriptorUpdateTemplate(
+          *logical_device, &create_info, logical_device->allocator(),
+          out_handle),
+      "vkCreateDescriptorUpdateTemplate");
+}
+
 iree_status_t iree_hal_vulkan_native_executable_layout_create(
     iree::hal::vulkan::VkDeviceHandle* logical_device,
     iree_host_size_t push_constant_count, iree_host_size_t set_layout_count,
@@ -101,7 +154,8 @@ iree_status_t iree_hal_vulkan_native_executable_layout_create(
   iree_hal_vulkan_native_executable_layout_t* executable_layout = NULL;
   iree_host_size_t total_size =
       sizeof(*executable_layout) +
-      set_layout_count * sizeof(*executable_layout->set_layouts);
+      set_layout_count * sizeof(*executable_layout->set_layouts) +
+      set_layout_count * sizeof(*executable_layout->push_templates);
   iree_status_t status = iree_allocator_malloc(
       logical_device->host_allocator(), total_size, (void**)&executable_layout);
   if (iree_status_is_ok(status)) {
@@ -110,16 +164,42 @@ iree_status_t iree_hal_vulkan_native_executable_layout_create(
         &executable_layout->resource);
     executable_layout->logical_device = logical_device;
     executable_layout->handle = handle;
+    uint8_t* push_templates_ptr =
+        (uint8_t*)executable_layout + sizeof(*executable_layout) +
+        set_layout_count * sizeof(*executable_layout->set_layouts);
+    executable_layout->push_templates =
+        (VkDescriptorUpdateTemplate*)push_templates_ptr;
     executable_layout->set_layout_count = set_layout_count;
     for (iree_host_size_t i = 0; i < set_layout_count; ++i) {
       executable_layout->set_layouts[i] = set_layouts[i];
       iree_hal_descriptor_set_layout_retain(set_layouts[i]);
+      executable_layout->push_templates[i] = VK_NULL_HANDLE;
     }
-    *out_executable_layout = (iree_hal_executable_layout_t*)executable_layout;
   } else {
     iree_hal_vulkan_destroy_pipeline_layout(logical_device, handle);
   }
 
+  if (iree_status_is_ok(status) &&
+      iree_hal_vulkan_supports_push_templates(logical_device)) {
+    for (iree_host_size_t i = 0; i < set_layout_count; ++i) {
+      iree_host_size_t binding_count =
+          iree_hal_vulkan_native_descriptor_set_layout_push_binding_count(
+              set_layouts[i]);
+      if (binding_count == 0) continue;
+      status = iree_hal_vulkan_create_push_template(
+          logical_device, handle, (uint32_t)i, binding_count,
+          &executable_layout->push_templates[i]);
+      if (!iree_status_is_ok(status)) break;
+    }
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_executable_layout = (iree_hal_executable_layout_t*)executable_layout;
+  } else if (executable_layout) {
+    iree_hal_executable_layout_destroy(
+        (iree_hal_executable_layout_t*)executable_layout);
+  }
+
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
@@ -132,7 +212,15 @@ static void iree_hal_vulkan_native_executable_layout_destroy(
       executable_layout->logical_device->host_allocator();
   IREE_TRACE_ZONE_BEGIN(z0);
 
-  iree_hal_vulkan_destroy_pipeline_layout(executable_layout->logical_device,
+  VkDeviceHandle* logical_device = executable_layout->logical_device;
+  for (iree_host_size_t i = 0; i < executable_layout->set_layout_count; ++i) {
+    if (executable_layout->push_templates[i] != VK_NULL_HANDLE) {
+      logical_device->syms()->vkDestroyDescriptorUpdateTemplate(
+          *logical_device, executable_layout->push_templates[i],
+          logical_device->allocator());
+    }
+  }
+  iree_hal_vulkan_destroy_pipeline_layout(logical_device,
                                           executable_layout->handle);
   for (iree_host_size_t i = 0; i < executable_layout->set_layout_count; ++i) {
     iree_hal_descriptor_set_layout_release(executable_layout->set_layouts[i]);
@@ -167,6 +255,26 @@ iree_hal_descriptor_set_layout_t* iree_hal_vulkan_native_executable_layout_set(
   return executable_layout->set_layouts[set_index];
 }
 
+VkDescriptorUpdateTemplate
+iree_hal_vulkan_native_executable_layout_push_template(
+    iree_hal_executable_layout_t* base_executable_layout,
+    iree_host_size_t set_index, iree_host_size_t* out_binding_count) {
+  iree_hal_vulkan_native_executable_layout_t* executable_layout =
+      iree_hal_vulkan_native_executable_layout_cast(base_executable_layout);
+  *out_binding_count = 0;
+  if (IREE_UNLIKELY(set_index >= executable_layout->set_layout_count)) {
+    return VK_NULL_HANDLE;
+  }
+  VkDescriptorUpdateTemplate handle =
+      executable_layout->push_templates[set_index];
+  if (handle != VK_NULL_HANDLE) {
+    *out_binding_count =
+        iree_hal_vulkan_native_descriptor_set_layout_push_binding_count(
+            executable_layout->set_layouts[set_index]);
+  }
+  return handle;
+}
+
 namespace {
 const iree_hal_executable_layout_vtable_t
     iree_hal_vulkan_native_executable_layout_vtable = {
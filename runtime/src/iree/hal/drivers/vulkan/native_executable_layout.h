@@ -40,6 +40,16 @@ iree_hal_descriptor_set_layout_t* iree_hal_vulkan_native_executable_layout_set(
     iree_hal_executable_layout_t* executable_layout,
     iree_host_size_t set_index);
 
+// Returns the descriptor update template used to push the descriptor set with
+// the given |set_index| or VK_NULL_HANDLE if the set must be pushed with
+// individual descriptor writes. The template consumes one
+// VkDescriptorBufferInfo per storage buffer binding ordinal in
+// [0, |out_binding_count|).
+VkDescriptorUpdateTemplate
+iree_hal_vulkan_native_executable_layout_push_template(
+    iree_hal_executable_layout_t* executable_layout, iree_host_size_t set_index,
+    iree_host_size_t* out_binding_count);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -15,12 +15,13 @@
 extern "C" {
 #endif  // __cplusplus
 
-// Creates a no-op executable cache that does not cache at all.
-// This is useful to isolate pipeline caching behavior and verify compilation
-// behavior.
+// Creates an executable cache that does not cache executables itself.
+// Pipelines are created with |pipeline_cache|, if not VK_NULL_HANDLE, such
+// that the driver can reuse compiled pipelines shared with other executable
+// caches on the same device.
 iree_status_t iree_hal_vulkan_nop_executable_cache_create(
     iree::hal::vulkan::VkDeviceHandle* logical_device,
-    iree_string_view_t identifier,
+    VkPipelineCache pipeline_cache, iree_string_view_t identifier,
     iree_hal_executable_cache_t** out_executable_cache);
 
 #ifdef __cplusplus
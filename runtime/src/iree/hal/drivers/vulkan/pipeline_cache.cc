@@ -0,0 +1,243 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/vulkan/pipeline_cache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "iree/base/api.h"
+#include "iree/base/internal/file_io.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/drivers/vulkan/dynamic_symbols.h"
+#include "iree/hal/drivers/vulkan/status_util.h"
+
+using namespace iree::hal::vulkan;
+
+// 'IRPC' when read as bytes on little-endian hosts.
+#define IREE_HAL_VULKAN_PIPELINE_CACHE_MAGIC 0x43505249u
+#define IREE_HAL_VULKAN_PIPELINE_CACHE_VERSION 1u
+
+// Header prefixing serialized VkPipelineCache data.
+typedef struct iree_hal_vulkan_pipeline_cache_header_t {
+  // IREE_HAL_VULKAN_PIPELINE_CACHE_MAGIC.
+  uint32_t magic;
+  // IREE_HAL_VULKAN_PIPELINE_CACHE_VERSION.
+  uint32_t version;
+  // VkPhysicalDeviceProperties of the device the data was serialized on.
+  uint32_t vendor_id;
+  uint32_t device_id;
+  uint32_t driver_version;
+  uint32_t reserved;
+  uint8_t pipeline_cache_uuid[VK_UUID_SIZE];
+  // Length of the VkPipelineCache data following the header.
+  uint64_t data_length;
+} iree_hal_vulkan_pipeline_cache_header_t;
+
+struct iree_hal_vulkan_pipeline_cache_t {
+  VkDeviceHandle* logical_device;
+  VkPipelineCache handle;
+
+  // Header identifying the device and driver the cache is valid for. The
+  // data_length is populated only when serializing.
+  iree_hal_vulkan_pipeline_cache_header_t header;
+
+  // NUL-terminated path of the file the cache is persisted to or empty if not
+  // persisted; stored in the same allocation as the cache.
+  iree_string_view_t path;
+};
+
+// Returns the VkPipelineCache data within |data| if it is prefixed with a
+// header matching that of |cache| and otherwise an empty span.
+static iree_const_byte_span_t iree_hal_vulkan_pipeline_cache_unwrap(
+    iree_hal_vulkan_pipeline_cache_t* cache, iree_const_byte_span_t data) {
+  iree_hal_vulkan_pipeline_cache_header_t header;
+  if (data.data_length < sizeof(header)) return iree_const_byte_span_empty();
+  memcpy(&header, data.data, sizeof(header));
+  const iree_hal_vulkan_pipeline_cache_header_t* expected = &cache->header;
+  if (header.magic != expected->magic || header.version != expected->version ||
+      header.vendor_id != expected->vendor_id ||
+      header.device_id != expected->device_id ||
+      header.driver_version != expected->driver_version ||
+      memcmp(header.pipeline_cache_uuid, expected->pipeline_cache_uuid,
+             sizeof(header.pipeline_cache_uuid)) != 0 ||
+      header.data_length > data.data_length - sizeof(header)) {
+    return iree_const_byte_span_empty();
+  }
+  return iree_make_const_byte_span(data.data + sizeof(header),
+                                   (iree_host_size_t)header.data_length);
+}
+
+static iree_status_t iree_hal_vulkan_pipeline_cache_create_handle(
+    iree_hal_vulkan_pipeline_cache_t* cache,
+    iree_const_byte_span_t cache_data) {
+  VkDeviceHandle* logical_device = cache->logical_device;
+  VkPipelineCacheCreateInfo create_info;
+  create_info.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+  create_info.pNext = NULL;
+  create_info.flags = 0;
+  create_info.initialDataSize = cache_data.data_length;
+  create_info.pInitialData = cache_data.data;
+  return VK_RESULT_TO_STATUS(
+      logical_device->syms()->vkCreatePipelineCache(
+          *logical_device, &create_info, logical_device->allocator(),
+          &cache->handle),
+      "vkCreatePipelineCache");
+}
+
+iree_status_t iree_hal_vulkan_pipeline_cache_allocate(
+    iree::hal::vulkan::VkDeviceHandle* logical_device,
+    VkPhysicalDevice physical_device, iree_string_view_t path,
+    iree_const_byte_span_t initial_data,
+    iree_hal_vulkan_pipeline_cache_t** out_cache) {
+  IREE_ASSERT_ARGUMENT(logical_device);
+  IREE_ASSERT_ARGUMENT(out_cache);
+  *out_cache = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_allocator_t host_allocator = logical_device->host_allocator();
+  iree_hal_vulkan_pipeline_cache_t* cache = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*cache) + path.size + 1,
+                                (void**)&cache));
+  cache->logical_device = logical_device;
+  cache->handle = VK_NULL_HANDLE;
+  char* path_storage = (char*)cache + sizeof(*cache);
+  memcpy(path_storage, path.data, path.size);
+  path_storage[path.size] = 0;
+  cache->path = iree_make_string_view(path_storage, path.size);
+
+  VkPhysicalDeviceProperties properties;
+  logical_device->syms()->vkGetPhysicalDeviceProperties(physical_device,
+                                                        &properties);
+  cache->header.magic = IREE_HAL_VULKAN_PIPELINE_CACHE_MAGIC;
+  cache->header.version = IREE_HAL_VULKAN_PIPELINE_CACHE_VERSION;
+  cache->header.vendor_id = properties.vendorID;
+  cache->header.device_id = properties.deviceID;
+  cache->header.driver_version = properties.driverVersion;
+  memcpy(cache->header.pipeline_cache_uuid, properties.pipelineCacheUUID,
+         sizeof(cache->header.pipeline_cache_uuid));
+
+  // Missing or unreadable files leave the cache empty.
+  iree_file_contents_t* file_contents = NULL;
+  if (initial_data.data_length == 0 && !iree_string_view_is_empty(path)) {
+    iree_status_t load_status =
+        iree_file_read_contents(cache->path.data, host_allocator,
+                                &file_contents);
+    if (iree_status_is_ok(load_status)) {
+      initial_data = file_contents->const_buffer;
+    } else {
+      iree_status_ignore(load_status);
+    }
+  }
+  iree_const_byte_span_t cache_data =
+      iree_hal_vulkan_pipeline_cache_unwrap(cache, initial_data);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, cache_data.data_length);
+
+  iree_status_t status =
+      iree_hal_vulkan_pipeline_cache_create_handle(cache, cache_data);
+  if (!iree_status_is_ok(status) && cache_data.data_length > 0) {
+    // Drivers may reject data that passed our checks (such as when it was
+    // truncated); start with an empty cache instead of failing.
+    iree_status_ignore(status);
+    status = iree_hal_vulkan_pipeline_cache_create_handle(
+        cache, iree_const_byte_span_empty());
+  }
+  iree_file_contents_free(file_contents);
+
+  if (iree_status_is_ok(status)) {
+    *out_cache = cache;
+  } else {
+    iree_allocator_free(host_allocator, cache);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Writes the serialized contents of |cache| to its file.
+static iree_status_t iree_hal_vulkan_pipeline_cache_write(
+    iree_hal_vulkan_pipeline_cache_t* cache) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_allocator_t host_allocator = cache->logical_device->host_allocator();
+
+  iree_host_size_t data_length = 0;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_vulkan_pipeline_cache_serialize(cache, 0, NULL,
+                                                   &data_length));
+  uint8_t* data = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, data_length, (void**)&data));
+  iree_status_t status = iree_hal_vulkan_pipeline_cache_serialize(
+      cache, data_length, data, &data_length);
+  if (iree_status_is_ok(status)) {
+    status = iree_file_write_contents(
+        cache->path.data, iree_make_const_byte_span(data, data_length));
+  }
+  iree_allocator_free(host_allocator, data);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_hal_vulkan_pipeline_cache_free(
+    iree_hal_vulkan_pipeline_cache_t* cache) {
+  if (!cache) return;
+  VkDeviceHandle* logical_device = cache->logical_device;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  if (!iree_string_view_is_empty(cache->path)) {
+    iree_status_ignore(iree_hal_vulkan_pipeline_cache_write(cache));
+  }
+  logical_device->syms()->vkDestroyPipelineCache(
+      *logical_device, cache->handle, logical_device->allocator());
+  iree_allocator_free(logical_device->host_allocator(), cache);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+VkPipelineCache iree_hal_vulkan_pipeline_cache_handle(
+    iree_hal_vulkan_pipeline_cache_t* cache) {
+  return cache->handle;
+}
+
+iree_status_t iree_hal_vulkan_pipeline_cache_serialize(
+    iree_hal_vulkan_pipeline_cache_t* cache, iree_host_size_t data_capacity,
+    void* data, iree_host_size_t* out_data_length) {
+  IREE_ASSERT_ARGUMENT(cache);
+  IREE_ASSERT_ARGUMENT(out_data_length);
+  *out_data_length = 0;
+  VkDeviceHandle* logical_device = cache->logical_device;
+
+  size_t cache_data_size = 0;
+  VK_RETURN_IF_ERROR(
+      logical_device->syms()->vkGetPipelineCacheData(
+          *logical_device, cache->handle, &cache_data_size, NULL),
+      "vkGetPipelineCacheData");
+  iree_hal_vulkan_pipeline_cache_header_t header = cache->header;
+  *out_data_length = sizeof(header) + cache_data_size;
+  if (!data) return iree_ok_status();
+  if (data_capacity < *out_data_length) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "pipeline cache data requires %zu bytes but only "
+                            "%zu were provided",
+                            *out_data_length, data_capacity);
+  }
+
+  VkResult result = logical_device->syms()->vkGetPipelineCacheData(
+      *logical_device, cache->handle, &cache_data_size,
+      (uint8_t*)data + sizeof(header));
+  if (result == VK_INCOMPLETE) {
+    // Pipelines were added to the cache since its size was queried.
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "pipeline cache grew while being serialized");
+  }
+  VK_RETURN_IF_ERROR(result, "vkGetPipelineCacheData");
+  header.data_length = cache_data_size;
+  memcpy(data, &header, sizeof(header));
+  *out_data_length = sizeof(header) + cache_data_size;
+  return iree_ok_status();
+}
@@ -0,0 +1,71 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_VULKAN_PIPELINE_CACHE_H_
+#define IREE_HAL_DRIVERS_VULKAN_PIPELINE_CACHE_H_
+
+// clang-format off: must be included before all other headers.
+#include "iree/hal/drivers/vulkan/vulkan_headers.h"
+// clang-format on
+
+#include "iree/base/api.h"
+#include "iree/hal/drivers/vulkan/handle_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// A VkPipelineCache shared by all executables created on a device that can be
+// persisted across processes.
+//
+// Creating compute pipelines makes the driver compile SPIR-V to device code
+// and on many platforms this dominates startup time. The cache can be
+// initialized with data serialized by a previous process, either provided
+// directly or loaded from a file, such that pipelines compiled before are not
+// compiled again. When backed by a file the cache contents are written back to
+// it when the cache is freed.
+//
+// Serialized data is prefixed with a header identifying the physical device
+// by vendor, device ID, pipeline cache UUID, and driver version. Data
+// serialized on any other device or driver version is ignored and the cache
+// starts empty.
+//
+// Thread-safe; the VkPipelineCache is internally synchronized.
+typedef struct iree_hal_vulkan_pipeline_cache_t
+    iree_hal_vulkan_pipeline_cache_t;
+
+// Allocates a pipeline cache for |physical_device|. The cache is initialized
+// with |initial_data| if not empty and otherwise from the file at |path| if it
+// exists. If |path| is not empty the cache is written to it when freed.
+iree_status_t iree_hal_vulkan_pipeline_cache_allocate(
+    iree::hal::vulkan::VkDeviceHandle* logical_device,
+    VkPhysicalDevice physical_device, iree_string_view_t path,
+    iree_const_byte_span_t initial_data,
+    iree_hal_vulkan_pipeline_cache_t** out_cache);
+
+// Frees |cache| after writing it to its file, if any. Failing to write the
+// file is not an error as the cache is only an optimization.
+void iree_hal_vulkan_pipeline_cache_free(
+    iree_hal_vulkan_pipeline_cache_t* cache);
+
+// Returns the VkPipelineCache pipelines should be created with.
+VkPipelineCache iree_hal_vulkan_pipeline_cache_handle(
+    iree_hal_vulkan_pipeline_cache_t* cache);
+
+// Serializes the contents of |cache| into |data|.
+// |data_capacity| defines the number of bytes available in |data| and
+// |out_data_length| will be set with the number of bytes required. If
+// |data_capacity| is too small IREE_STATUS_OUT_OF_RANGE is returned. To only
+// query the required capacity |data| may be passed as NULL.
+iree_status_t iree_hal_vulkan_pipeline_cache_serialize(
+    iree_hal_vulkan_pipeline_cache_t* cache, iree_host_size_t data_capacity,
+    void* data, iree_host_size_t* out_data_length);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_VULKAN_PIPELINE_CACHE_H_
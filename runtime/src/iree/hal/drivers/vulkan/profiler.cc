@@ -0,0 +1,418 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/vulkan/profiler.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "iree/base/internal/file_io.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/drivers/vulkan/dynamic_symbols.h"
+#include "iree/hal/drivers/vulkan/native_executable.h"
+#include "iree/hal/drivers/vulkan/status_util.h"
+
+using namespace iree::hal::vulkan;
+
+// Number of timestamp queries in each query pool allocated by the profiler.
+// Each dispatch uses two queries.
+#if !defined(IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY)
+#define IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY 4096
+#endif  // !IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY
+
+// A dispatch appended to the capture.
+typedef struct iree_hal_vulkan_profiler_record_t {
+  uint32_t executable_index;
+  uint32_t ordinal;
+  uint32_t workgroup_count[3];
+  // True if the timestamps were read back. False if the dispatch never
+  // executed.
+  bool executed;
+  // Timestamps in device ticks once read back.
+  uint64_t start_ticks;
+  uint64_t end_ticks;
+} iree_hal_vulkan_profiler_record_t;
+
+struct iree_hal_vulkan_profiler_t {
+  VkDeviceHandle* logical_device;
+
+  // NUL-terminated path the capture is written to.
+  const char* file_path;
+
+  // Nanoseconds per timestamp tick.
+  double timestamp_period;
+  // Mask of the valid bits of timestamps.
+  uint64_t timestamp_mask;
+
+  // Guards all mutable state below.
+  iree_slim_mutex_t mutex;
+
+  // Dispatch records in append order. Record i uses queries 2*i and 2*i+1
+  // counted across all query pools in order.
+  iree_host_size_t record_count;
+  iree_host_size_t record_capacity;
+  iree_hal_vulkan_profiler_record_t* records;
+
+  // Query pools of IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY queries each.
+  iree_host_size_t query_pool_count;
+  iree_host_size_t query_pool_capacity;
+  VkQueryPool* query_pools;
+
+  // Retained executables indexed by executable index.
+  iree_host_size_t executable_count;
+  iree_host_size_t executable_capacity;
+  iree_hal_executable_t** executables;
+  // Index of the executable most recently dispatched as dispatches of the same
+  // executable tend to be recorded together.
+  iree_host_size_t last_executable_index;
+};
+
+iree_status_t iree_hal_vulkan_profiler_create(
+    VkDeviceHandle* logical_device, VkPhysicalDevice physical_device,
+    uint32_t queue_family_index,
+    const iree_hal_device_profiling_options_t* options,
+    iree_hal_vulkan_profiler_t** out_profiler) {
+  IREE_ASSERT_ARGUMENT(logical_device);
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_profiler);
+  *out_profiler = NULL;
+  if (!options->file_path || !strlen(options->file_path)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "profiling requires a capture file path");
+  }
+  const auto& syms = logical_device->syms();
+
+  uint32_t queue_family_count = 0;
+  syms->vkGetPhysicalDeviceQueueFamilyProperties(physical_device,
+                                                 &queue_family_count, NULL);
+  if (queue_family_index >= queue_family_count) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "queue family %u out of range", queue_family_index);
+  }
+  VkQueueFamilyProperties* queue_family_properties =
+      (VkQueueFamilyProperties*)iree_alloca(queue_family_count *
+                                            sizeof(VkQueueFamilyProperties));
+  syms->vkGetPhysicalDeviceQueueFamilyProperties(
+      physical_device, &queue_family_count, queue_family_properties);
+  const uint32_t timestamp_valid_bits =
+      queue_family_properties[queue_family_index].timestampValidBits;
+  if (timestamp_valid_bits == 0) {
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "queue family %u does not support timestamps",
+                            queue_family_index);
+  }
+
+  VkPhysicalDeviceProperties device_properties;
+  syms->vkGetPhysicalDeviceProperties(physical_device, &device_properties);
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_allocator_t host_allocator = logical_device->host_allocator();
+  iree_hal_vulkan_profiler_t* profiler = NULL;
+  const iree_host_size_t file_path_length = strlen(options->file_path);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator,
+                                sizeof(*profiler) + file_path_length + 1,
+                                (void**)&profiler));
+  memset(profiler, 0, sizeof(*profiler));
+  profiler->logical_device = logical_device;
+  char* file_path = (char*)profiler + sizeof(*profiler);
+  memcpy(file_path, options->file_path, file_path_length + 1);
+  profiler->file_path = file_path;
+  profiler->timestamp_period = device_properties.limits.timestampPeriod;
+  profiler->timestamp_mask = timestamp_valid_bits >= 64
+                                 ? UINT64_MAX
+                                 : (1ull << timestamp_valid_bits) - 1;
+  iree_slim_mutex_initialize(&profiler->mutex);
+
+  *out_profiler = profiler;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+void iree_hal_vulkan_profiler_destroy(iree_hal_vulkan_profiler_t* profiler) {
+  if (!profiler) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  VkDeviceHandle* logical_device = profiler->logical_device;
+  iree_allocator_t host_allocator = logical_device->host_allocator();
+
+  for (iree_host_size_t i = 0; i < profiler->query_pool_count; ++i) {
+    logical_device->syms()->vkDestroyQueryPool(
+        *logical_device, profiler->query_pools[i], logical_device->allocator());
+  }
+  iree_allocator_free(host_allocator, profiler->query_pools);
+  iree_allocator_free(host_allocator, profiler->records);
+  for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+    iree_hal_executable_release(profiler->executables[i]);
+  }
+  iree_allocator_free(host_allocator, profiler->executables);
+  iree_slim_mutex_deinitialize(&profiler->mutex);
+  iree_allocator_free(host_allocator, profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Returns the index of |executable| in the executable table, adding it if this
+// is the first dispatch of the executable. Requires the profiler mutex.
+static iree_status_t iree_hal_vulkan_profiler_lookup_executable(
+    iree_hal_vulkan_profiler_t* profiler, iree_hal_executable_t* executable,
+    uint32_t* out_executable_index) {
+  if (profiler->last_executable_index < profiler->executable_count &&
+      profiler->executables[profiler->last_executable_index] == executable) {
+    *out_executable_index = (uint32_t)profiler->last_executable_index;
+    return iree_ok_status();
+  }
+  for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+    if (profiler->executables[i] == executable) {
+      profiler->last_executable_index = i;
+      *out_executable_index = (uint32_t)i;
+      return iree_ok_status();
+    }
+  }
+
+  if (profiler->executable_count == profiler->executable_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(16, profiler->executable_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        profiler->logical_device->host_allocator(),
+        new_capacity * sizeof(*profiler->executables),
+        (void**)&profiler->executables));
+    profiler->executable_capacity = new_capacity;
+  }
+
+  // Executables are retained so that they are not reused for other
+  // executables while the capture is active.
+  const iree_host_size_t executable_index = profiler->executable_count++;
+  profiler->executables[executable_index] = executable;
+  iree_hal_executable_retain(executable);
+  profiler->last_executable_index = executable_index;
+  *out_executable_index = (uint32_t)executable_index;
+  return iree_ok_status();
+}
+
+// Allocates a new query pool. Requires the profiler mutex.
+static iree_status_t iree_hal_vulkan_profiler_grow_query_pools(
+    iree_hal_vulkan_profiler_t* profiler) {
+  VkDeviceHandle* logical_device = profiler->logical_device;
+  if (profiler->query_pool_count == profiler->query_pool_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(8, profiler->query_pool_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        logical_device->host_allocator(),
+        new_capacity * sizeof(*profiler->query_pools),
+        (void**)&profiler->query_pools));
+    profiler->query_pool_capacity = new_capacity;
+  }
+
+  VkQueryPoolCreateInfo create_info;
+  memset(&create_info, 0, sizeof(create_info));
+  create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+  create_info.pNext = NULL;
+  create_info.flags = 0;
+  create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+  create_info.queryCount = IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY;
+  create_info.pipelineStatistics = 0;
+  VkQueryPool query_pool = VK_NULL_HANDLE;
+  VK_RETURN_IF_ERROR(logical_device->syms()->vkCreateQueryPool(
+                         *logical_device, &create_info,
+                         logical_device->allocator(), &query_pool),
+                     "vkCreateQueryPool");
+  profiler->query_pools[profiler->query_pool_count++] = query_pool;
+  return iree_ok_status();
+}
+
+// Allocates a new record and its queries. Requires the profiler mutex.
+static iree_status_t iree_hal_vulkan_profiler_allocate_record(
+    iree_hal_vulkan_profiler_t* profiler,
+    iree_hal_vulkan_profiler_record_t** out_record,
+    iree_hal_vulkan_profiler_dispatch_t* out_dispatch) {
+  if (profiler->record_count == profiler->record_capacity) {
+    iree_host_size_t new_capacity =
+        iree_max(256, profiler->record_capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        profiler->logical_device->host_allocator(),
+        new_capacity * sizeof(*profiler->records),
+        (void**)&profiler->records));
+    profiler->record_capacity = new_capacity;
+  }
+  const iree_host_size_t query_ordinal = profiler->record_count * 2;
+  const iree_host_size_t query_pool_index =
+      query_ordinal / IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY;
+  if (query_pool_index >= profiler->query_pool_count) {
+    IREE_RETURN_IF_ERROR(iree_hal_vulkan_profiler_grow_query_pools(profiler));
+  }
+  out_dispatch->query_pool = profiler->query_pools[query_pool_index];
+  out_dispatch->query_index =
+      (uint32_t)(query_ordinal % IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY);
+
+  iree_hal_vulkan_profiler_record_t* record =
+      &profiler->records[profiler->record_count++];
+  memset(record, 0, sizeof(*record));
+  *out_record = record;
+  return iree_ok_status();
+}
+
+iree_status_t iree_hal_vulkan_profiler_append_dispatch(
+    iree_hal_vulkan_profiler_t* profiler, iree_hal_executable_t* executable,
+    int32_t entry_point, uint32_t workgroup_x, uint32_t workgroup_y,
+    uint32_t workgroup_z, iree_hal_vulkan_profiler_dispatch_t* out_dispatch) {
+  IREE_ASSERT_ARGUMENT(profiler);
+  IREE_ASSERT_ARGUMENT(executable);
+  IREE_ASSERT_ARGUMENT(out_dispatch);
+  memset(out_dispatch, 0, sizeof(*out_dispatch));
+
+  iree_slim_mutex_lock(&profiler->mutex);
+  uint32_t executable_index = 0;
+  iree_status_t status = iree_hal_vulkan_profiler_lookup_executable(
+      profiler, executable, &executable_index);
+  iree_hal_vulkan_profiler_record_t* record = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_vulkan_profiler_allocate_record(profiler, &record,
+                                                      out_dispatch);
+  }
+  if (iree_status_is_ok(status)) {
+    record->executable_index = executable_index;
+    record->ordinal = (uint32_t)entry_point;
+    record->workgroup_count[0] = workgroup_x;
+    record->workgroup_count[1] = workgroup_y;
+    record->workgroup_count[2] = workgroup_z;
+  }
+  iree_slim_mutex_unlock(&profiler->mutex);
+  return status;
+}
+
+// Reads back the timestamps of all records. Queries of dispatches whose command
+// buffers never executed are reported as unavailable and leave the records
+// unexecuted. Requires the profiler mutex.
+static iree_status_t iree_hal_vulkan_profiler_read_timestamps(
+    iree_hal_vulkan_profiler_t* profiler) {
+  VkDeviceHandle* logical_device = profiler->logical_device;
+  const iree_host_size_t query_count = profiler->record_count * 2;
+  if (query_count == 0) return iree_ok_status();
+
+  // Each query produces its value followed by its availability.
+  uint64_t* results = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      logical_device->host_allocator(),
+      IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY * 2 * sizeof(uint64_t),
+      (void**)&results));
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < profiler->query_pool_count; ++i) {
+    const iree_host_size_t base_query =
+        i * IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY;
+    const uint32_t pool_query_count = (uint32_t)iree_min(
+        query_count - base_query, IREE_HAL_VULKAN_PROFILER_QUERY_POOL_CAPACITY);
+    VkResult result = logical_device->syms()->vkGetQueryPoolResults(
+        *logical_device, profiler->query_pools[i], 0, pool_query_count,
+        pool_query_count * 2 * sizeof(uint64_t), results,
+        2 * sizeof(uint64_t),
+        VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+    // VK_NOT_READY indicates some queries are unavailable and is expected.
+    if (result != VK_SUCCESS && result != VK_NOT_READY) {
+      status = VK_RESULT_TO_STATUS(result, "vkGetQueryPoolResults");
+      break;
+    }
+    for (uint32_t j = 0; j + 1 < pool_query_count; j += 2) {
+      const uint64_t* start = &results[j * 2];
+      const uint64_t* end = &results[(j + 1) * 2];
+      if (!start[1] || !end[1]) continue;  // unavailable
+      iree_hal_vulkan_profiler_record_t* record =
+          &profiler->records[(base_query + j) / 2];
+      record->executed = true;
+      record->start_ticks = start[0] & profiler->timestamp_mask;
+      record->end_ticks = end[0] & profiler->timestamp_mask;
+    }
+  }
+  iree_allocator_free(logical_device->host_allocator(), results);
+  return status;
+}
+
+iree_status_t iree_hal_vulkan_profiler_write(
+    iree_hal_vulkan_profiler_t* profiler) {
+  IREE_ASSERT_ARGUMENT(profiler);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_allocator_t host_allocator = profiler->logical_device->host_allocator();
+  iree_slim_mutex_lock(&profiler->mutex);
+
+  iree_status_t status = iree_hal_vulkan_profiler_read_timestamps(profiler);
+
+  // Times are reported relative to the earliest executed dispatch.
+  uint64_t first_ticks = UINT64_MAX;
+  uint64_t last_ticks = 0;
+  for (iree_host_size_t i = 0; i < profiler->record_count; ++i) {
+    const iree_hal_vulkan_profiler_record_t* record = &profiler->records[i];
+    if (!record->executed) continue;
+    first_ticks = iree_min(first_ticks, record->start_ticks);
+    last_ticks = iree_max(last_ticks, record->end_ticks);
+  }
+  if (first_ticks > last_ticks) first_ticks = last_ticks;
+
+  const iree_host_size_t total_size =
+      sizeof(iree_hal_vulkan_profile_file_header_t) +
+      profiler->executable_count *
+          sizeof(iree_hal_vulkan_profile_file_executable_t) +
+      profiler->record_count * sizeof(iree_hal_vulkan_profile_file_dispatch_t);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, total_size);
+
+  uint8_t* contents = NULL;
+  if (iree_status_is_ok(status)) {
+    status =
+        iree_allocator_malloc(host_allocator, total_size, (void**)&contents);
+  }
+  if (iree_status_is_ok(status)) {
+    memset(contents, 0, total_size);
+    uint8_t* ptr = contents;
+
+    iree_hal_vulkan_profile_file_header_t* header =
+        (iree_hal_vulkan_profile_file_header_t*)ptr;
+    header->magic = IREE_HAL_VULKAN_PROFILE_FILE_MAGIC;
+    header->version = IREE_HAL_VULKAN_PROFILE_FILE_VERSION;
+    header->worker_count = 0;
+    header->executable_count = (uint32_t)profiler->executable_count;
+    header->dispatch_count = (uint64_t)profiler->record_count;
+    header->duration_ns =
+        (int64_t)((double)(last_ticks - first_ticks) *
+                  profiler->timestamp_period);
+    ptr += sizeof(*header);
+
+    for (iree_host_size_t i = 0; i < profiler->executable_count; ++i) {
+      iree_hal_vulkan_profile_file_executable_t* executable =
+          (iree_hal_vulkan_profile_file_executable_t*)ptr;
+      executable->export_count =
+          (uint32_t)iree_hal_vulkan_native_executable_entry_point_count(
+              profiler->executables[i]);
+      ptr += sizeof(*executable);
+    }
+
+    for (iree_host_size_t i = 0; i < profiler->record_count; ++i) {
+      const iree_hal_vulkan_profiler_record_t* record = &profiler->records[i];
+      iree_hal_vulkan_profile_file_dispatch_t* dispatch =
+          (iree_hal_vulkan_profile_file_dispatch_t*)ptr;
+      dispatch->executable_index = record->executable_index;
+      dispatch->ordinal = record->ordinal;
+      memcpy(dispatch->workgroup_count, record->workgroup_count,
+             sizeof(dispatch->workgroup_count));
+      if (record->executed) {
+        dispatch->start_ns =
+            (int64_t)((double)(record->start_ticks - first_ticks) *
+                      profiler->timestamp_period);
+        dispatch->duration_ns =
+            (int64_t)((double)(record->end_ticks - record->start_ticks) *
+                      profiler->timestamp_period);
+      }
+      ptr += sizeof(*dispatch);
+    }
+
+    status = iree_file_write_contents(
+        profiler->file_path, iree_make_const_byte_span(contents, total_size));
+  }
+
+  iree_slim_mutex_unlock(&profiler->mutex);
+  iree_allocator_free(host_allocator, contents);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
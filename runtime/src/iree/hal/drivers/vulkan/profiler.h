@@ -0,0 +1,133 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_VULKAN_PROFILER_H_
+#define IREE_HAL_DRIVERS_VULKAN_PROFILER_H_
+
+// clang-format off: must be included before all other headers.
+#include "iree/hal/drivers/vulkan/vulkan_headers.h"
+// clang-format on
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/drivers/vulkan/handle_util.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// Capture file format
+//===----------------------------------------------------------------------===//
+
+// A capture file uses the same layout as those of the local-task and CUDA
+// devices such that the same tools can read captures from any of them:
+//   iree_hal_vulkan_profile_file_header_t header;
+//   iree_hal_vulkan_profile_file_executable_t executables[executable_count];
+//   iree_hal_vulkan_profile_file_dispatch_t dispatches[dispatch_count];
+//
+// Dispatches execute on the device and have no per-worker tile counters so the
+// header worker_count is always 0. Dispatches are stored in the order they
+// were recorded and all times are in nanoseconds relative to the start of the
+// earliest dispatch executed as measured by the device.
+
+// 'IRDP' when read as bytes on little-endian hosts.
+#define IREE_HAL_VULKAN_PROFILE_FILE_MAGIC 0x50445249u
+#define IREE_HAL_VULKAN_PROFILE_FILE_VERSION 1u
+
+typedef struct iree_hal_vulkan_profile_file_header_t {
+  // IREE_HAL_VULKAN_PROFILE_FILE_MAGIC.
+  uint32_t magic;
+  // IREE_HAL_VULKAN_PROFILE_FILE_VERSION.
+  uint32_t version;
+  // Number of tile counters per dispatch; always 0.
+  uint32_t worker_count;
+  // Number of entries in the executable table.
+  uint32_t executable_count;
+  // Number of dispatch records following the executable table.
+  uint64_t dispatch_count;
+  // Duration from the start of the earliest dispatch to the end of the latest.
+  int64_t duration_ns;
+} iree_hal_vulkan_profile_file_header_t;
+
+// Executables are assigned indices in the order they were first dispatched.
+typedef struct iree_hal_vulkan_profile_file_executable_t {
+  // Total number of exports in the executable.
+  uint32_t export_count;
+  uint32_t reserved;
+} iree_hal_vulkan_profile_file_executable_t;
+
+typedef struct iree_hal_vulkan_profile_file_dispatch_t {
+  // Index of the dispatched executable in the executable table.
+  uint32_t executable_index;
+  // Export ordinal within the executable.
+  uint32_t ordinal;
+  // Workgroup count the dispatch was recorded with. 0 for indirect dispatches.
+  uint32_t workgroup_count[3];
+  uint32_t reserved;
+  // Time the dispatch started executing.
+  int64_t start_ns;
+  // Time from the dispatch starting to it completing. 0 if the dispatch was
+  // never executed.
+  int64_t duration_ns;
+} iree_hal_vulkan_profile_file_dispatch_t;
+
+//===----------------------------------------------------------------------===//
+// iree_hal_vulkan_profiler_t
+//===----------------------------------------------------------------------===//
+
+// A dispatch appended to a profiler capture.
+// Timestamps must be written to |query_pool| at |query_index| immediately
+// before the dispatch and at |query_index| + 1 immediately after it. The
+// queries must be reset in the same command buffer before they are written.
+typedef struct iree_hal_vulkan_profiler_dispatch_t {
+  VkQueryPool query_pool;
+  uint32_t query_index;
+} iree_hal_vulkan_profiler_dispatch_t;
+
+// Captures the dispatches recorded into command buffers on a Vulkan device
+// between profiling begin and end. Each dispatch is bracketed by a pair of
+// timestamp queries allocated from query pools owned by the profiler and the
+// timestamps are read back when the capture is written. This does not depend
+// on Tracy and is available in all build configurations.
+//
+// Only one-shot command buffers are captured as reusable command buffers would
+// overwrite their timestamps each time they are submitted. Command buffers
+// recorded during a capture must be submitted before the capture ends.
+//
+// Thread-safe; dispatches may be appended from multiple threads concurrently.
+typedef struct iree_hal_vulkan_profiler_t iree_hal_vulkan_profiler_t;
+
+// Creates a profiler that writes to the file specified in |options|.
+// Dispatches must be submitted to queues of |queue_family_index|. Fails with
+// IREE_STATUS_UNAVAILABLE if the queue family does not support timestamps.
+iree_status_t iree_hal_vulkan_profiler_create(
+    iree::hal::vulkan::VkDeviceHandle* logical_device,
+    VkPhysicalDevice physical_device, uint32_t queue_family_index,
+    const iree_hal_device_profiling_options_t* options,
+    iree_hal_vulkan_profiler_t** out_profiler);
+
+// Destroys |profiler| and releases all captured executables.
+// All command buffers referencing the profiler queries must have completed.
+void iree_hal_vulkan_profiler_destroy(iree_hal_vulkan_profiler_t* profiler);
+
+// Appends a dispatch of |executable| export |entry_point| to the capture and
+// returns the queries bracketing it in |out_dispatch|.
+iree_status_t iree_hal_vulkan_profiler_append_dispatch(
+    iree_hal_vulkan_profiler_t* profiler, iree_hal_executable_t* executable,
+    int32_t entry_point, uint32_t workgroup_x, uint32_t workgroup_y,
+    uint32_t workgroup_z, iree_hal_vulkan_profiler_dispatch_t* out_dispatch);
+
+// Reads back all timestamps and writes the capture to the profiler file.
+// All command buffers referencing the profiler queries must have completed.
+iree_status_t iree_hal_vulkan_profiler_write(
+    iree_hal_vulkan_profiler_t* profiler);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_VULKAN_PROFILER_H_
@@ -0,0 +1,557 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/drivers/vulkan/rebindable_command_buffer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "iree/base/api.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/drivers/vulkan/direct_command_buffer.h"
+#include "iree/hal/utils/deferred_command_buffer.h"
+
+using namespace iree::hal::vulkan;
+
+// Number of recorded VkCommandBuffers retained per command buffer beyond which
+// those whose submissions have completed are released. Recordings still in
+// use by pending submissions are always retained.
+#if !defined(IREE_HAL_VULKAN_REBINDABLE_COMMAND_BUFFER_CAPACITY)
+#define IREE_HAL_VULKAN_REBINDABLE_COMMAND_BUFFER_CAPACITY 4
+#endif  // !IREE_HAL_VULKAN_REBINDABLE_COMMAND_BUFFER_CAPACITY
+
+// A direct command buffer replayed with a particular set of bindings.
+typedef struct iree_hal_vulkan_rebindable_entry_t {
+  struct iree_hal_vulkan_rebindable_entry_t* next;
+  iree_hal_command_buffer_t* command_buffer;
+  // Semaphore and payload value signaled by the submission the entry was last
+  // resolved for. NULL if the submission signaled no semaphores in which case
+  // the entry is retained until the command buffer is destroyed.
+  iree_hal_semaphore_t* semaphore;
+  uint64_t payload_value;
+  // Bindings the entry was replayed with, one per binding table slot. Stored
+  // in the same allocation as the entry.
+  iree_hal_buffer_binding_t* bindings;
+} iree_hal_vulkan_rebindable_entry_t;
+
+typedef struct iree_hal_vulkan_rebindable_command_buffer_t {
+  iree_hal_command_buffer_t base;
+  iree_hal_device_t* device;
+  VkDeviceHandle* logical_device;
+  VkCommandPoolHandle* command_pool;
+  iree_hal_vulkan_tracing_context_t* tracing_context;
+  DescriptorPoolCache* descriptor_pool_cache;
+  BuiltinExecutables* builtin_executables;
+  iree_arena_block_pool_t* block_pool;
+
+  // Deferred command buffer all commands are recorded into.
+  iree_hal_command_buffer_t* deferred_command_buffer;
+
+  // Submissions to different queues may resolve concurrently.
+  iree_slim_mutex_t mutex;
+  // Entries in most-recently-resolved order.
+  iree_hal_vulkan_rebindable_entry_t* entry_head IREE_GUARDED_BY(mutex);
+  iree_host_size_t entry_count IREE_GUARDED_BY(mutex);
+} iree_hal_vulkan_rebindable_command_buffer_t;
+
+namespace {
+extern const iree_hal_command_buffer_vtable_t
+    iree_hal_vulkan_rebindable_command_buffer_vtable;
+}  // namespace
+
+static iree_hal_vulkan_rebindable_command_buffer_t*
+iree_hal_vulkan_rebindable_command_buffer_cast(
+    iree_hal_command_buffer_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value,
+                       &iree_hal_vulkan_rebindable_command_buffer_vtable);
+  return (iree_hal_vulkan_rebindable_command_buffer_t*)base_value;
+}
+
+iree_status_t iree_hal_vulkan_rebindable_command_buffer_create(
+    iree_hal_device_t* device,
+    iree::hal::vulkan::VkDeviceHandle* logical_device,
+    iree::hal::vulkan::VkCommandPoolHandle* command_pool,
+    iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
+    iree_hal_vulkan_tracing_context_t* tracing_context,
+    iree::hal::vulkan::DescriptorPoolCache* descriptor_pool_cache,
+    iree::hal::vulkan::BuiltinExecutables* builtin_executables,
+    iree_arena_block_pool_t* block_pool,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  IREE_ASSERT_ARGUMENT(logical_device);
+  IREE_ASSERT_ARGUMENT(command_pool);
+  IREE_ASSERT_ARGUMENT(descriptor_pool_cache);
+  IREE_ASSERT_ARGUMENT(block_pool);
+  IREE_ASSERT_ARGUMENT(out_command_buffer);
+  *out_command_buffer = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0,
+      iree_allocator_malloc(logical_device->host_allocator(),
+                            sizeof(*command_buffer), (void**)&command_buffer));
+  iree_hal_command_buffer_initialize(
+      device, mode, command_categories, queue_affinity, binding_capacity,
+      &iree_hal_vulkan_rebindable_command_buffer_vtable, &command_buffer->base);
+  command_buffer->device = device;
+  command_buffer->logical_device = logical_device;
+  command_buffer->command_pool = command_pool;
+  command_buffer->tracing_context = tracing_context;
+  command_buffer->descriptor_pool_cache = descriptor_pool_cache;
+  command_buffer->builtin_executables = builtin_executables;
+  command_buffer->block_pool = block_pool;
+  command_buffer->deferred_command_buffer = NULL;
+  iree_slim_mutex_initialize(&command_buffer->mutex);
+  command_buffer->entry_head = NULL;
+  command_buffer->entry_count = 0;
+
+  iree_status_t status = iree_hal_deferred_command_buffer_create(
+      device, mode, command_categories, binding_capacity, block_pool,
+      logical_device->host_allocator(),
+      &command_buffer->deferred_command_buffer);
+
+  if (iree_status_is_ok(status)) {
+    *out_command_buffer = &command_buffer->base;
+  } else {
+    iree_hal_command_buffer_destroy(&command_buffer->base);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_vulkan_rebindable_entry_free(
+    iree_allocator_t host_allocator,
+    iree_hal_vulkan_rebindable_entry_t* entry) {
+  iree_hal_command_buffer_release(entry->command_buffer);
+  iree_hal_semaphore_release(entry->semaphore);
+  iree_allocator_free(host_allocator, entry);
+}
+
+static void iree_hal_vulkan_rebindable_command_buffer_destroy(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  iree_allocator_t host_allocator =
+      command_buffer->logical_device->host_allocator();
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_vulkan_rebindable_entry_t* entry = command_buffer->entry_head;
+  while (entry) {
+    iree_hal_vulkan_rebindable_entry_t* next_entry = entry->next;
+    iree_hal_vulkan_rebindable_entry_free(host_allocator, entry);
+    entry = next_entry;
+  }
+  iree_hal_command_buffer_release(command_buffer->deferred_command_buffer);
+  iree_slim_mutex_deinitialize(&command_buffer->mutex);
+  iree_allocator_free(host_allocator, command_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+bool iree_hal_vulkan_rebindable_command_buffer_isa(
+    iree_hal_command_buffer_t* command_buffer) {
+  return iree_hal_command_buffer_dyn_cast(
+      command_buffer, &iree_hal_vulkan_rebindable_command_buffer_vtable);
+}
+
+static void* iree_hal_vulkan_rebindable_command_buffer_dyn_cast(
+    iree_hal_command_buffer_t* command_buffer, const void* vtable) {
+  if (vtable == &iree_hal_vulkan_rebindable_command_buffer_vtable) {
+    IREE_HAL_ASSERT_TYPE(command_buffer, vtable);
+    return command_buffer;
+  }
+  return NULL;
+}
+
+// Returns true if |entry| was replayed with the first |binding_count| bindings
+// of |binding_table|.
+static bool iree_hal_vulkan_rebindable_entry_matches(
+    const iree_hal_vulkan_rebindable_entry_t* entry,
+    iree_host_size_t binding_count,
+    iree_hal_buffer_binding_table_t binding_table) {
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    const iree_hal_buffer_binding_t* lhs = &entry->bindings[i];
+    const iree_hal_buffer_binding_t* rhs = &binding_table.bindings[i];
+    if (lhs->buffer != rhs->buffer || lhs->offset != rhs->offset ||
+        lhs->length != rhs->length) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true if the submission |entry| was last resolved for has completed.
+static bool iree_hal_vulkan_rebindable_entry_is_idle(
+    const iree_hal_vulkan_rebindable_entry_t* entry) {
+  if (!entry->semaphore) return false;
+  uint64_t value = 0;
+  iree_status_t status = iree_hal_semaphore_query(entry->semaphore, &value);
+  if (!iree_status_is_ok(status)) {
+    // Failed semaphores will never be signaled and their submissions have
+    // been abandoned.
+    iree_status_ignore(status);
+    return true;
+  }
+  return value >= entry->payload_value;
+}
+
+// Replays the deferred commands with |binding_table| into a new entry.
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_record(
+    iree_hal_vulkan_rebindable_command_buffer_t* command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
+    iree_hal_vulkan_rebindable_entry_t** out_entry) {
+  iree_allocator_t host_allocator =
+      command_buffer->logical_device->host_allocator();
+  iree_host_size_t binding_count = command_buffer->base.binding_capacity;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_vulkan_rebindable_entry_t* entry = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(
+              host_allocator,
+              sizeof(*entry) + binding_count * sizeof(entry->bindings[0]),
+              (void**)&entry));
+  entry->next = NULL;
+  entry->command_buffer = NULL;
+  entry->semaphore = NULL;
+  entry->payload_value = 0;
+  entry->bindings =
+      (iree_hal_buffer_binding_t*)((uint8_t*)entry + sizeof(*entry));
+  memcpy(entry->bindings, binding_table.bindings,
+         binding_count * sizeof(entry->bindings[0]));
+
+  // The bindings are retained by the direct command buffer resource set.
+  iree_status_t status = iree_hal_vulkan_direct_command_buffer_allocate(
+      command_buffer->device, command_buffer->logical_device,
+      command_buffer->command_pool, command_buffer->base.mode,
+      command_buffer->base.allowed_categories,
+      command_buffer->base.queue_affinity, command_buffer->tracing_context,
+      /*profiler=*/NULL, command_buffer->descriptor_pool_cache,
+      command_buffer->builtin_executables, command_buffer->block_pool,
+      &entry->command_buffer);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_deferred_command_buffer_apply(
+        command_buffer->deferred_command_buffer, entry->command_buffer,
+        binding_table);
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_entry = entry;
+  } else {
+    iree_hal_vulkan_rebindable_entry_free(host_allocator, entry);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Releases idle entries other than the most recently resolved one until the
+// entry count is within capacity.
+static void iree_hal_vulkan_rebindable_command_buffer_trim(
+    iree_hal_vulkan_rebindable_command_buffer_t* command_buffer) {
+  iree_allocator_t host_allocator =
+      command_buffer->logical_device->host_allocator();
+  iree_hal_vulkan_rebindable_entry_t** entry_ptr =
+      &command_buffer->entry_head->next;
+  while (*entry_ptr && command_buffer->entry_count >
+                           IREE_HAL_VULKAN_REBINDABLE_COMMAND_BUFFER_CAPACITY) {
+    iree_hal_vulkan_rebindable_entry_t* entry = *entry_ptr;
+    if (iree_hal_vulkan_rebindable_entry_is_idle(entry)) {
+      *entry_ptr = entry->next;
+      --command_buffer->entry_count;
+      iree_hal_vulkan_rebindable_entry_free(host_allocator, entry);
+    } else {
+      entry_ptr = &entry->next;
+    }
+  }
+}
+
+iree_status_t iree_hal_vulkan_rebindable_command_buffer_resolve(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
+    iree_hal_semaphore_list_t signal_semaphores, VkCommandBuffer* out_handle) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  *out_handle = VK_NULL_HANDLE;
+  iree_host_size_t binding_count = command_buffer->base.binding_capacity;
+  if (binding_table.count < binding_count) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "binding table has %zu bindings but the command "
+                            "buffer was created with a capacity of %zu",
+                            binding_table.count, binding_count);
+  }
+
+  iree_slim_mutex_lock(&command_buffer->mutex);
+
+  // Find an existing recording with the same bindings and unlink it such that
+  // it can be moved to the head of the list.
+  iree_hal_vulkan_rebindable_entry_t* entry = NULL;
+  iree_hal_vulkan_rebindable_entry_t** entry_ptr = &command_buffer->entry_head;
+  while (*entry_ptr) {
+    if (iree_hal_vulkan_rebindable_entry_matches(*entry_ptr, binding_count,
+                                                 binding_table)) {
+      entry = *entry_ptr;
+      *entry_ptr = entry->next;
+      --command_buffer->entry_count;
+      break;
+    }
+    entry_ptr = &(*entry_ptr)->next;
+  }
+
+  iree_status_t status = iree_ok_status();
+  if (!entry) {
+    status = iree_hal_vulkan_rebindable_command_buffer_record(
+        command_buffer, binding_table, &entry);
+  }
+
+  if (iree_status_is_ok(status)) {
+    // All signal semaphores are signaled together once the submission
+    // completes so tracking the first is sufficient.
+    iree_hal_semaphore_release(entry->semaphore);
+    entry->semaphore = NULL;
+    entry->payload_value = 0;
+    if (signal_semaphores.count > 0) {
+      entry->semaphore = signal_semaphores.semaphores[0];
+      iree_hal_semaphore_retain(entry->semaphore);
+      entry->payload_value = signal_semaphores.payload_values[0];
+    }
+    entry->next = command_buffer->entry_head;
+    command_buffer->entry_head = entry;
+    ++command_buffer->entry_count;
+    iree_hal_vulkan_rebindable_command_buffer_trim(command_buffer);
+    *out_handle = iree_hal_vulkan_direct_command_buffer_handle(
+        entry->command_buffer);
+  }
+
+  iree_slim_mutex_unlock(&command_buffer->mutex);
+  return status;
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_begin(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_begin(command_buffer->deferred_command_buffer);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_end(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_end(command_buffer->deferred_command_buffer);
+}
+
+static void iree_hal_vulkan_rebindable_command_buffer_begin_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer, iree_string_view_t label,
+    iree_hal_label_color_t label_color,
+    const iree_hal_label_location_t* location) {
+  // Not captured by the deferred command buffer.
+}
+
+static void iree_hal_vulkan_rebindable_command_buffer_end_debug_group(
+    iree_hal_command_buffer_t* base_command_buffer) {
+  // Not captured by the deferred command buffer.
+}
+
+static iree_status_t
+iree_hal_vulkan_rebindable_command_buffer_execution_barrier(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_hal_execution_barrier_flags_t flags,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_execution_barrier(
+      command_buffer->deferred_command_buffer, source_stage_mask,
+      target_stage_mask, flags, memory_barrier_count, memory_barriers,
+      buffer_barrier_count, buffer_barriers);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_signal_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_signal_event(
+      command_buffer->deferred_command_buffer, event, source_stage_mask);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_reset_event(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_event_t* event,
+    iree_hal_execution_stage_t source_stage_mask) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_reset_event(
+      command_buffer->deferred_command_buffer, event, source_stage_mask);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_wait_events(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_host_size_t event_count, const iree_hal_event_t** events,
+    iree_hal_execution_stage_t source_stage_mask,
+    iree_hal_execution_stage_t target_stage_mask,
+    iree_host_size_t memory_barrier_count,
+    const iree_hal_memory_barrier_t* memory_barriers,
+    iree_host_size_t buffer_barrier_count,
+    const iree_hal_buffer_barrier_t* buffer_barriers) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_wait_events(
+      command_buffer->deferred_command_buffer, event_count, events,
+      source_stage_mask, target_stage_mask, memory_barrier_count,
+      memory_barriers, buffer_barrier_count, buffer_barriers);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_discard_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, iree_hal_buffer_t* buffer) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_discard_buffer(
+      command_buffer->deferred_command_buffer, buffer);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_fill_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length, const void* pattern,
+    iree_host_size_t pattern_length) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_fill_buffer(
+      command_buffer->deferred_command_buffer, target_buffer, target_offset,
+      length, pattern, pattern_length);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_update_buffer(
+    iree_hal_command_buffer_t* base_command_buffer, const void* source_buffer,
+    iree_host_size_t source_offset, iree_hal_buffer_t* target_buffer,
+    iree_device_size_t target_offset, iree_device_size_t length) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_update_buffer(
+      command_buffer->deferred_command_buffer, source_buffer, source_offset,
+      target_buffer, target_offset, length);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_copy_buffer(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_buffer_t* source_buffer, iree_device_size_t source_offset,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_copy_buffer(
+      command_buffer->deferred_command_buffer, source_buffer, source_offset,
+      target_buffer, target_offset, length);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_push_constants(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, iree_host_size_t offset,
+    const void* values, iree_host_size_t values_length) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_push_constants(
+      command_buffer->deferred_command_buffer, executable_layout, offset,
+      values, values_length);
+}
+
+static iree_status_t
+iree_hal_vulkan_rebindable_command_buffer_push_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_binding_t* bindings) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_push_descriptor_set(
+      command_buffer->deferred_command_buffer, executable_layout, set,
+      binding_count, bindings);
+}
+
+static iree_status_t
+iree_hal_vulkan_rebindable_command_buffer_bind_descriptor_set(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_layout_t* executable_layout, uint32_t set,
+    iree_hal_descriptor_set_t* descriptor_set,
+    iree_host_size_t dynamic_offset_count,
+    const iree_device_size_t* dynamic_offsets) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_bind_descriptor_set(
+      command_buffer->deferred_command_buffer, executable_layout, set,
+      descriptor_set, dynamic_offset_count, dynamic_offsets);
+}
+
+static iree_status_t iree_hal_vulkan_rebindable_command_buffer_dispatch(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    uint32_t workgroup_x, uint32_t workgroup_y, uint32_t workgroup_z) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_dispatch(
+      command_buffer->deferred_command_buffer, executable, entry_point,
+      workgroup_x, workgroup_y, workgroup_z);
+}
+
+static iree_status_t
+iree_hal_vulkan_rebindable_command_buffer_dispatch_indirect(
+    iree_hal_command_buffer_t* base_command_buffer,
+    iree_hal_executable_t* executable, int32_t entry_point,
+    iree_hal_buffer_t* workgroups_buffer,
+    iree_device_size_t workgroups_offset) {
+  iree_hal_vulkan_rebindable_command_buffer_t* command_buffer =
+      iree_hal_vulkan_rebindable_command_buffer_cast(base_command_buffer);
+  return iree_hal_command_buffer_dispatch_indirect(
+      command_buffer->deferred_command_buffer, executable, entry_point,
+      workgroups_buffer, workgroups_offset);
+}
+
+namespace {
+const iree_hal_command_buffer_vtable_t
+    iree_hal_vulkan_rebindable_command_buffer_vtable = {
+        /*.destroy=*/iree_hal_vulkan_rebindable_command_buffer_destroy,
+        /*.dyn_cast=*/iree_hal_vulkan_rebindable_command_buffer_dyn_cast,
+        /*.begin=*/iree_hal_vulkan_rebindable_command_buffer_begin,
+        /*.end=*/iree_hal_vulkan_rebindable_command_buffer_end,
+        /*.begin_debug_group=*/
+        iree_hal_vulkan_rebindable_command_buffer_begin_debug_group,
+        /*.end_debug_group=*/
+        iree_hal_vulkan_rebindable_command_buffer_end_debug_group,
+        /*.execution_barrier=*/
+        iree_hal_vulkan_rebindable_command_buffer_execution_barrier,
+        /*.signal_event=*/
+        iree_hal_vulkan_rebindable_command_buffer_signal_event,
+        /*.reset_event=*/
+        iree_hal_vulkan_rebindable_command_buffer_reset_event,
+        /*.wait_events=*/
+        iree_hal_vulkan_rebindable_command_buffer_wait_events,
+        /*.discard_buffer=*/
+        iree_hal_vulkan_rebindable_command_buffer_discard_buffer,
+        /*.fill_buffer=*/
+        iree_hal_vulkan_rebindable_command_buffer_fill_buffer,
+        /*.update_buffer=*/
+        iree_hal_vulkan_rebindable_command_buffer_update_buffer,
+        /*.copy_buffer=*/
+        iree_hal_vulkan_rebindable_command_buffer_copy_buffer,
+        /*.push_constants=*/
+        iree_hal_vulkan_rebindable_command_buffer_push_constants,
+        /*.push_descriptor_set=*/
+        iree_hal_vulkan_rebindable_command_buffer_push_descriptor_set,
+        /*.bind_descriptor_set=*/
+        iree_hal_vulkan_rebindable_command_buffer_bind_descriptor_set,
+        /*.dispatch=*/iree_hal_vulkan_rebindable_command_buffer_dispatch,
+        /*.dispatch_indirect=*/
+        iree_hal_vulkan_rebindable_command_buffer_dispatch_indirect,
+};
+}  // namespace
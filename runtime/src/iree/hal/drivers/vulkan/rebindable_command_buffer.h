@@ -0,0 +1,74 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_DRIVERS_VULKAN_REBINDABLE_COMMAND_BUFFER_H_
+#define IREE_HAL_DRIVERS_VULKAN_REBINDABLE_COMMAND_BUFFER_H_
+
+// clang-format off: must be included before all other headers.
+#include "iree/hal/drivers/vulkan/vulkan_headers.h"
+// clang-format on
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/drivers/vulkan/builtin_executables.h"
+#include "iree/hal/drivers/vulkan/descriptor_pool_cache.h"
+#include "iree/hal/drivers/vulkan/handle_util.h"
+#include "iree/hal/drivers/vulkan/tracing.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+typedef struct iree_arena_block_pool_t iree_arena_block_pool_t;
+
+// Creates a command buffer with a nonzero |binding_capacity| whose descriptor
+// set bindings may reference binding table slots provided at submission.
+//
+// Commands are recorded into a deferred command buffer and replayed into a
+// direct command buffer the first time the command buffer is submitted with a
+// particular binding table. The recorded VkCommandBuffers are retained and
+// resubmitted as-is when the same bindings are provided again such that
+// steady-state submissions that alternate between a small set of buffers (such
+// as double-buffered inputs) do no recording work at all.
+//
+// Debug groups are not captured by the deferred command buffer and are
+// dropped, and dispatches are not captured by device profiling.
+//
+// The remaining arguments are those of
+// iree_hal_vulkan_direct_command_buffer_allocate and are used to create the
+// direct command buffers.
+iree_status_t iree_hal_vulkan_rebindable_command_buffer_create(
+    iree_hal_device_t* device,
+    iree::hal::vulkan::VkDeviceHandle* logical_device,
+    iree::hal::vulkan::VkCommandPoolHandle* command_pool,
+    iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
+    iree_hal_vulkan_tracing_context_t* tracing_context,
+    iree::hal::vulkan::DescriptorPoolCache* descriptor_pool_cache,
+    iree::hal::vulkan::BuiltinExecutables* builtin_executables,
+    iree_arena_block_pool_t* block_pool,
+    iree_hal_command_buffer_t** out_command_buffer);
+
+// Returns true if |command_buffer| is a Vulkan rebindable command buffer.
+bool iree_hal_vulkan_rebindable_command_buffer_isa(
+    iree_hal_command_buffer_t* command_buffer);
+
+// Returns the native Vulkan VkCommandBuffer handle recorded with the bindings
+// in |binding_table|, recording one if none exists yet, for submission with
+// |signal_semaphores|. Recorded VkCommandBuffers are only released once the
+// semaphores of the submission they were last resolved for have been signaled
+// or when |command_buffer| is destroyed.
+iree_status_t iree_hal_vulkan_rebindable_command_buffer_resolve(
+    iree_hal_command_buffer_t* command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
+    iree_hal_semaphore_list_t signal_semaphores, VkCommandBuffer* out_handle);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_DRIVERS_VULKAN_REBINDABLE_COMMAND_BUFFER_H_
@@ -31,6 +31,14 @@ IREE_FLAG(int32_t, vulkan_debug_verbosity, 2,
 IREE_FLAG(bool, vulkan_tracing, true,
           "Enables Vulkan tracing (if IREE tracing is enabled).");
 
+IREE_FLAG(bool, vulkan_dedicated_transfer_queues, false,
+          "Submits transfer-only command buffers to dedicated transfer "
+          "queues, if available, such that they overlap with dispatches.");
+
+IREE_FLAG(string, vulkan_pipeline_cache_path, "",
+          "File the Vulkan pipeline cache is loaded from and saved to such "
+          "that pipelines compiled by earlier runs are reused.");
+
 static iree_status_t iree_hal_vulkan_create_driver_with_flags(
     iree_string_view_t identifier, iree_allocator_t host_allocator,
     iree_hal_driver_t** out_driver) {
@@ -63,6 +71,12 @@ static iree_status_t iree_hal_vulkan_create_driver_with_flags(
   if (FLAG_vulkan_tracing) {
     driver_options.requested_features |= IREE_HAL_VULKAN_FEATURE_ENABLE_TRACING;
   }
+  if (FLAG_vulkan_dedicated_transfer_queues) {
+    driver_options.device_options.flags |=
+        IREE_HAL_VULKAN_DEVICE_FLAG_DEDICATED_TRANSFER_QUEUES;
+  }
+  driver_options.device_options.pipeline_cache_path =
+      iree_make_cstring_view(FLAG_vulkan_pipeline_cache_path);
 
   // Load the Vulkan library. This will fail if the library cannot be found or
   // does not have the expected functions.
@@ -6,7 +6,8 @@
 
 #include "iree/hal/drivers/vulkan/tracing.h"
 
-#if IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+#if (IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION) && \
+    (IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_TRACY)
 
 #include "iree/base/api.h"
 #include "iree/base/target_platform.h"
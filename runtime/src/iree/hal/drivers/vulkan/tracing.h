@@ -69,7 +69,8 @@ extern "C" {
 typedef struct iree_hal_vulkan_tracing_context_t
     iree_hal_vulkan_tracing_context_t;
 
-#if IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+#if (IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION) && \
+    (IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_TRACY)
 
 // Allocates a tracing context for the given Vulkan queue.
 // Each context must only be used with the queue it was created with.
@@ -7,9 +7,11 @@
 #include "iree/hal/drivers/vulkan/vma_allocator.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/synchronization.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/vulkan/dynamic_symbols.h"
 #include "iree/hal/drivers/vulkan/status_util.h"
@@ -18,12 +20,61 @@
 
 using namespace iree::hal::vulkan;
 
+// Size of the memory blocks backing the staging buffer pools.
+#if !defined(IREE_HAL_VULKAN_VMA_STAGING_POOL_BLOCK_SIZE)
+#define IREE_HAL_VULKAN_VMA_STAGING_POOL_BLOCK_SIZE (16 * 1024 * 1024)
+#endif  // !IREE_HAL_VULKAN_VMA_STAGING_POOL_BLOCK_SIZE
+
+// Size of the memory blocks backing the constant buffer pools.
+#if !defined(IREE_HAL_VULKAN_VMA_CONSTANT_POOL_BLOCK_SIZE)
+#define IREE_HAL_VULKAN_VMA_CONSTANT_POOL_BLOCK_SIZE (32 * 1024 * 1024)
+#endif  // !IREE_HAL_VULKAN_VMA_CONSTANT_POOL_BLOCK_SIZE
+
+// Classes of buffers that are allocated from their own VMA pools such that
+// allocations with very different lifetimes do not share memory blocks. Short
+// lived staging buffers interleaved with long lived constants otherwise pin
+// mostly empty blocks and fragment the default pools of long running
+// processes.
+typedef enum iree_hal_vulkan_vma_pool_class_e {
+  // Host-visible buffers only used for transfers and mapping.
+  IREE_HAL_VULKAN_VMA_POOL_CLASS_STAGING = 0,
+  // Buffers that are immutable once initialized.
+  IREE_HAL_VULKAN_VMA_POOL_CLASS_CONSTANT,
+  IREE_HAL_VULKAN_VMA_POOL_CLASS_COUNT,
+  // Buffers allocated from the VMA default pools.
+  IREE_HAL_VULKAN_VMA_POOL_CLASS_DEFAULT = IREE_HAL_VULKAN_VMA_POOL_CLASS_COUNT,
+} iree_hal_vulkan_vma_pool_class_t;
+
+// Returns the size of the memory blocks backing pools of |pool_class|.
+static VkDeviceSize iree_hal_vulkan_vma_pool_block_size(
+    iree_hal_vulkan_vma_pool_class_t pool_class) {
+  switch (pool_class) {
+    case IREE_HAL_VULKAN_VMA_POOL_CLASS_STAGING:
+      return IREE_HAL_VULKAN_VMA_STAGING_POOL_BLOCK_SIZE;
+    case IREE_HAL_VULKAN_VMA_POOL_CLASS_CONSTANT:
+      return IREE_HAL_VULKAN_VMA_CONSTANT_POOL_BLOCK_SIZE;
+    default:
+      return 0;
+  }
+}
+
 typedef struct iree_hal_vulkan_vma_allocator_t {
   iree_hal_resource_t resource;
   iree_hal_device_t* device;  // unretained to avoid cycles
   iree_allocator_t host_allocator;
+  VkDeviceHandle* logical_device;
   VmaAllocator vma;
 
+  // Queue families buffers are shared between when there is more than one.
+  // Stored in the same allocation as the allocator.
+  uint32_t queue_family_count;
+  uint32_t* queue_family_indices;
+
+  // Pools for each usage class and memory type, created on first use.
+  iree_slim_mutex_t pool_mutex;
+  VmaPool pools[IREE_HAL_VULKAN_VMA_POOL_CLASS_COUNT][VK_MAX_MEMORY_TYPES]
+      IREE_GUARDED_BY(pool_mutex);
+
   IREE_STATISTICS(VkPhysicalDeviceMemoryProperties memory_props;)
   IREE_STATISTICS(iree_hal_allocator_statistics_t statistics;)
 } iree_hal_vulkan_vma_allocator_t;
@@ -84,23 +135,38 @@ static void VKAPI_PTR iree_hal_vulkan_vma_free_callback(
 iree_status_t iree_hal_vulkan_vma_allocator_create(
     VkInstance instance, VkPhysicalDevice physical_device,
     VkDeviceHandle* logical_device, iree_hal_device_t* device,
+    iree_host_size_t queue_family_count, const uint32_t* queue_family_indices,
     iree_hal_allocator_t** out_allocator) {
   IREE_ASSERT_ARGUMENT(instance);
   IREE_ASSERT_ARGUMENT(physical_device);
   IREE_ASSERT_ARGUMENT(logical_device);
   IREE_ASSERT_ARGUMENT(device);
+  IREE_ASSERT_ARGUMENT(!queue_family_count || queue_family_indices);
   IREE_ASSERT_ARGUMENT(out_allocator);
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_allocator_t host_allocator = logical_device->host_allocator();
   iree_hal_vulkan_vma_allocator_t* allocator = NULL;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_allocator_malloc(host_allocator, sizeof(*allocator),
-                                (void**)&allocator));
+      z0, iree_allocator_malloc(
+              host_allocator,
+              sizeof(*allocator) +
+                  queue_family_count * sizeof(*allocator->queue_family_indices),
+              (void**)&allocator));
   iree_hal_resource_initialize(&iree_hal_vulkan_vma_allocator_vtable,
                                &allocator->resource);
   allocator->host_allocator = host_allocator;
   allocator->device = device;
+  allocator->logical_device = logical_device;
+  iree_slim_mutex_initialize(&allocator->pool_mutex);
+  memset(allocator->pools, 0, sizeof(allocator->pools));
+  allocator->queue_family_count = (uint32_t)queue_family_count;
+  allocator->queue_family_indices =
+      (uint32_t*)((uint8_t*)allocator + sizeof(*allocator));
+  if (queue_family_count > 0) {
+    memcpy(allocator->queue_family_indices, queue_family_indices,
+           queue_family_count * sizeof(*allocator->queue_family_indices));
+  }
 
   const auto& syms = logical_device->syms();
   VmaVulkanFunctions vulkan_fns;
@@ -163,6 +229,8 @@ iree_status_t iree_hal_vulkan_vma_allocator_create(
     *out_allocator = (iree_hal_allocator_t*)allocator;
   } else {
     vmaDestroyAllocator(vma);
+    iree_slim_mutex_deinitialize(&allocator->pool_mutex);
+    iree_allocator_free(host_allocator, allocator);
   }
 
   IREE_TRACE_ZONE_END(z0);
@@ -176,7 +244,15 @@ static void iree_hal_vulkan_vma_allocator_destroy(
   iree_allocator_t host_allocator = allocator->host_allocator;
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  for (int i = 0; i < IREE_HAL_VULKAN_VMA_POOL_CLASS_COUNT; ++i) {
+    for (int j = 0; j < VK_MAX_MEMORY_TYPES; ++j) {
+      if (allocator->pools[i][j]) {
+        vmaDestroyPool(allocator->vma, allocator->pools[i][j]);
+      }
+    }
+  }
   vmaDestroyAllocator(allocator->vma);
+  iree_slim_mutex_deinitialize(&allocator->pool_mutex);
   iree_allocator_free(host_allocator, allocator);
 
   IREE_TRACE_ZONE_END(z0);
@@ -228,9 +304,116 @@ iree_hal_vulkan_vma_allocator_query_compatibility(
     }
   }
 
+  // External memory handles can be imported when the device supports any of
+  // the handle types. The memory type of a particular handle is only known
+  // when importing it.
+  iree_hal_vulkan_vma_allocator_t* allocator =
+      iree_hal_vulkan_vma_allocator_cast(base_allocator);
+  const iree_hal_vulkan_device_extensions_t& extensions =
+      allocator->logical_device->enabled_extensions();
+  if (extensions.external_memory_fd ||
+      extensions.external_memory_android_hardware_buffer) {
+    compatibility |= IREE_HAL_BUFFER_COMPATIBILITY_IMPORTABLE;
+  }
+
   return compatibility;
 }
 
+// Returns the Vulkan buffer usage flags for buffers with HAL |usage|.
+static VkBufferUsageFlags iree_hal_vulkan_vma_buffer_usage_flags(
+    iree_hal_buffer_usage_t usage) {
+  VkBufferUsageFlags flags = 0;
+  if (iree_all_bits_set(usage, IREE_HAL_BUFFER_USAGE_TRANSFER)) {
+    flags |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+    flags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+  }
+  if (iree_all_bits_set(usage, IREE_HAL_BUFFER_USAGE_DISPATCH_STORAGE)) {
+    flags |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
+    flags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+    flags |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+  }
+  return flags;
+}
+
+// Returns the usage class of buffers allocated with |params|.
+static iree_hal_vulkan_vma_pool_class_t iree_hal_vulkan_vma_select_pool_class(
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size) {
+  // Exported buffers may require dedicated allocations.
+  if (iree_any_bit_set(params->usage, IREE_HAL_BUFFER_USAGE_SHARING_EXPORT)) {
+    return IREE_HAL_VULKAN_VMA_POOL_CLASS_DEFAULT;
+  }
+  iree_hal_vulkan_vma_pool_class_t pool_class =
+      IREE_HAL_VULKAN_VMA_POOL_CLASS_DEFAULT;
+  const iree_hal_buffer_usage_t dispatch_usage =
+      IREE_HAL_BUFFER_USAGE_DISPATCH_INDIRECT_PARAMS |
+      IREE_HAL_BUFFER_USAGE_DISPATCH_UNIFORM_READ |
+      IREE_HAL_BUFFER_USAGE_DISPATCH_STORAGE |
+      IREE_HAL_BUFFER_USAGE_DISPATCH_IMAGE;
+  if (iree_all_bits_set(params->type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE) &&
+      !iree_any_bit_set(params->usage, dispatch_usage)) {
+    pool_class = IREE_HAL_VULKAN_VMA_POOL_CLASS_STAGING;
+  } else if (iree_all_bits_set(params->usage,
+                               IREE_HAL_BUFFER_USAGE_SHARING_IMMUTABLE)) {
+    pool_class = IREE_HAL_VULKAN_VMA_POOL_CLASS_CONSTANT;
+  }
+  // Large allocations would waste most of a block and get dedicated memory
+  // from the default pools instead.
+  if (pool_class != IREE_HAL_VULKAN_VMA_POOL_CLASS_DEFAULT &&
+      allocation_size > iree_hal_vulkan_vma_pool_block_size(pool_class) / 4) {
+    pool_class = IREE_HAL_VULKAN_VMA_POOL_CLASS_DEFAULT;
+  }
+  return pool_class;
+}
+
+// Returns the pool of |pool_class| serving allocations made with
+// |allocation_create_info|, creating it if needed. Returns VK_NULL_HANDLE if no
+// pool is available and the default pools should be used.
+static VmaPool iree_hal_vulkan_vma_allocator_select_pool(
+    iree_hal_vulkan_vma_allocator_t* IREE_RESTRICT allocator,
+    iree_hal_vulkan_vma_pool_class_t pool_class,
+    const VmaAllocationCreateInfo* allocation_create_info) {
+  if (pool_class == IREE_HAL_VULKAN_VMA_POOL_CLASS_DEFAULT) {
+    return VK_NULL_HANDLE;
+  }
+  // NOTE: this avoids vmaFindMemoryTypeIndexForBufferInfo as it creates a
+  // temporary buffer on every call. All memory types of interest support
+  // buffers in practice and if not the allocation falls back to the default
+  // pools.
+  uint32_t memory_type_index = 0;
+  if (vmaFindMemoryTypeIndex(allocator->vma, /*memoryTypeBits=*/UINT32_MAX,
+                             allocation_create_info,
+                             &memory_type_index) != VK_SUCCESS) {
+    return VK_NULL_HANDLE;
+  }
+
+  iree_slim_mutex_lock(&allocator->pool_mutex);
+  VmaPool pool = allocator->pools[pool_class][memory_type_index];
+  if (!pool) {
+    IREE_TRACE_ZONE_BEGIN(z0);
+    IREE_TRACE_ZONE_APPEND_VALUE(z0, (int64_t)pool_class);
+    VmaPoolCreateInfo pool_create_info;
+    memset(&pool_create_info, 0, sizeof(pool_create_info));
+    pool_create_info.memoryTypeIndex = memory_type_index;
+    pool_create_info.flags = 0;
+    pool_create_info.blockSize =
+        iree_hal_vulkan_vma_pool_block_size(pool_class);
+    pool_create_info.minBlockCount = 0;
+    pool_create_info.maxBlockCount = 0;  // Unlimited.
+    // Failing to create the pool (usually due to memory pressure) is not
+    // fatal as the default pools can still be used.
+    if (vmaCreatePool(allocator->vma, &pool_create_info, &pool) ==
+        VK_SUCCESS) {
+      allocator->pools[pool_class][memory_type_index] = pool;
+    } else {
+      pool = VK_NULL_HANDLE;
+    }
+    IREE_TRACE_ZONE_END(z0);
+  }
+  iree_slim_mutex_unlock(&allocator->pool_mutex);
+  return pool;
+}
+
 static iree_status_t iree_hal_vulkan_vma_allocator_allocate_internal(
     iree_hal_vulkan_vma_allocator_t* IREE_RESTRICT allocator,
     const iree_hal_buffer_params_t* IREE_RESTRICT params,
@@ -250,20 +433,17 @@ static iree_status_t iree_hal_vulkan_vma_allocator_allocate_internal(
   buffer_create_info.pNext = NULL;
   buffer_create_info.flags = 0;
   buffer_create_info.size = allocation_size;
-  buffer_create_info.usage = 0;
-  if (iree_all_bits_set(params->usage, IREE_HAL_BUFFER_USAGE_TRANSFER)) {
-    buffer_create_info.usage |= VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
-    buffer_create_info.usage |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-  }
-  if (iree_all_bits_set(params->usage,
-                        IREE_HAL_BUFFER_USAGE_DISPATCH_STORAGE)) {
-    buffer_create_info.usage |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
-    buffer_create_info.usage |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
-    buffer_create_info.usage |= VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+  buffer_create_info.usage =
+      iree_hal_vulkan_vma_buffer_usage_flags(params->usage);
+  if (allocator->queue_family_count > 1) {
+    buffer_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+    buffer_create_info.queueFamilyIndexCount = allocator->queue_family_count;
+    buffer_create_info.pQueueFamilyIndices = allocator->queue_family_indices;
+  } else {
+    buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    buffer_create_info.queueFamilyIndexCount = 0;
+    buffer_create_info.pQueueFamilyIndices = NULL;
   }
-  buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
-  buffer_create_info.queueFamilyIndexCount = 0;
-  buffer_create_info.pQueueFamilyIndices = NULL;
 
   VmaAllocationCreateInfo allocation_create_info;
   allocation_create_info.flags = flags;
@@ -308,13 +488,29 @@ static iree_status_t iree_hal_vulkan_vma_allocator_allocate_internal(
   // TODO(benvanik): if on a unified memory system and initial data is present
   // we could set the mapping bit and ensure a much more efficient upload.
 
+  // Allocate from the pool of the buffer usage class, if any. Pool memory is
+  // allocated through the same callbacks as the default pools and included in
+  // the allocator statistics.
+  allocation_create_info.pool = iree_hal_vulkan_vma_allocator_select_pool(
+      allocator,
+      iree_hal_vulkan_vma_select_pool_class(params, allocation_size),
+      &allocation_create_info);
+
   VkBuffer handle = VK_NULL_HANDLE;
   VmaAllocation allocation = VK_NULL_HANDLE;
   VmaAllocationInfo allocation_info;
-  VK_RETURN_IF_ERROR(vmaCreateBuffer(allocator->vma, &buffer_create_info,
-                                     &allocation_create_info, &handle,
-                                     &allocation, &allocation_info),
-                     "vmaCreateBuffer");
+  VkResult result = vmaCreateBuffer(allocator->vma, &buffer_create_info,
+                                    &allocation_create_info, &handle,
+                                    &allocation, &allocation_info);
+  if (result != VK_SUCCESS && allocation_create_info.pool != VK_NULL_HANDLE) {
+    // The pool may be exhausted or its memory type incompatible with the
+    // buffer; retry with the default pools.
+    allocation_create_info.pool = VK_NULL_HANDLE;
+    result = vmaCreateBuffer(allocator->vma, &buffer_create_info,
+                             &allocation_create_info, &handle, &allocation,
+                             &allocation_info);
+  }
+  VK_RETURN_IF_ERROR(result, "vmaCreateBuffer");
 
   iree_hal_buffer_t* buffer = NULL;
   iree_status_t status = iree_hal_vulkan_vma_buffer_wrap(
@@ -367,15 +563,220 @@ static void iree_hal_vulkan_vma_allocator_deallocate_buffer(
   iree_hal_buffer_destroy(base_buffer);
 }
 
+// Imports |memory_requirements| bytes of external memory described by
+// |import_info| (a VkImport*InfoKHR/ANDROID structure) as a buffer of
+// |buffer_size| bytes. |memory_requirements| memoryTypeBits indicates the
+// memory types the handle may be imported as and is intersected with those the
+// buffer supports.
+static iree_status_t iree_hal_vulkan_vma_allocator_import_memory(
+    iree_hal_vulkan_vma_allocator_t* IREE_RESTRICT allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    VkExternalMemoryHandleTypeFlagBits handle_type, const void* import_info,
+    VkMemoryRequirements memory_requirements, iree_device_size_t buffer_size,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  VkDeviceHandle* logical_device = allocator->logical_device;
+  const auto& syms = logical_device->syms();
+
+  // TODO(benvanik): acquire ownership from VK_QUEUE_FAMILY_FOREIGN_EXT with a
+  // barrier on first use; today producers must have released the memory prior
+  // to import (such as by waiting on the fence/sync fd of the frame).
+  VkExternalMemoryBufferCreateInfo external_create_info;
+  external_create_info.sType =
+      VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+  external_create_info.pNext = NULL;
+  external_create_info.handleTypes = handle_type;
+  VkBufferCreateInfo buffer_create_info;
+  buffer_create_info.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+  buffer_create_info.pNext = &external_create_info;
+  buffer_create_info.flags = 0;
+  buffer_create_info.size = buffer_size;
+  buffer_create_info.usage =
+      iree_hal_vulkan_vma_buffer_usage_flags(params->usage);
+  if (allocator->queue_family_count > 1) {
+    buffer_create_info.sharingMode = VK_SHARING_MODE_CONCURRENT;
+    buffer_create_info.queueFamilyIndexCount = allocator->queue_family_count;
+    buffer_create_info.pQueueFamilyIndices = allocator->queue_family_indices;
+  } else {
+    buffer_create_info.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    buffer_create_info.queueFamilyIndexCount = 0;
+    buffer_create_info.pQueueFamilyIndices = NULL;
+  }
+  VkBuffer handle = VK_NULL_HANDLE;
+  VK_RETURN_IF_ERROR(
+      syms->vkCreateBuffer(*logical_device, &buffer_create_info,
+                           logical_device->allocator(), &handle),
+      "vkCreateBuffer");
+
+  // Select a memory type compatible with both the handle and the buffer that
+  // has the properties required by the HAL memory type.
+  VkMemoryRequirements buffer_requirements;
+  syms->vkGetBufferMemoryRequirements(*logical_device, handle,
+                                      &buffer_requirements);
+  VmaAllocationCreateInfo allocation_create_info;
+  memset(&allocation_create_info, 0, sizeof(allocation_create_info));
+  allocation_create_info.usage = VMA_MEMORY_USAGE_UNKNOWN;
+  if (iree_any_bit_set(params->type, IREE_HAL_MEMORY_TYPE_HOST_VISIBLE) ||
+      iree_all_bits_set(params->usage, IREE_HAL_BUFFER_USAGE_MAPPING)) {
+    allocation_create_info.requiredFlags |= VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+  }
+  if (iree_all_bits_set(params->type, IREE_HAL_MEMORY_TYPE_HOST_COHERENT)) {
+    allocation_create_info.requiredFlags |=
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+  }
+  if (iree_all_bits_set(params->type, IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL)) {
+    allocation_create_info.preferredFlags |=
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+  }
+  uint32_t memory_type_index = 0;
+  iree_status_t status = iree_ok_status();
+  if (buffer_requirements.size > memory_requirements.size) {
+    status = iree_make_status(
+        IREE_STATUS_OUT_OF_RANGE,
+        "external memory of %" PRIdsz " bytes is smaller than the %" PRIdsz
+        " bytes required by the buffer",
+        (iree_device_size_t)memory_requirements.size,
+        (iree_device_size_t)buffer_requirements.size);
+  } else if (vmaFindMemoryTypeIndex(allocator->vma,
+                             memory_requirements.memoryTypeBits &
+                                 buffer_requirements.memoryTypeBits,
+                             &allocation_create_info,
+                             &memory_type_index) != VK_SUCCESS) {
+    status = iree_make_status(
+        IREE_STATUS_UNAVAILABLE,
+        "external memory cannot be imported with the requested memory type");
+  }
+
+  // Import the memory. The handle ownership is transferred to the memory on
+  // success.
+  VkDeviceMemory memory = VK_NULL_HANDLE;
+  if (iree_status_is_ok(status)) {
+    VkMemoryAllocateInfo allocate_info;
+    allocate_info.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocate_info.pNext = import_info;
+    allocate_info.allocationSize = memory_requirements.size;
+    allocate_info.memoryTypeIndex = memory_type_index;
+    status = VK_RESULT_TO_STATUS(
+        syms->vkAllocateMemory(*logical_device, &allocate_info,
+                               logical_device->allocator(), &memory),
+        "vkAllocateMemory");
+  }
+  if (iree_status_is_ok(status)) {
+    status = VK_RESULT_TO_STATUS(
+        syms->vkBindBufferMemory(*logical_device, handle, memory,
+                                 /*memoryOffset=*/0),
+        "vkBindBufferMemory");
+  }
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_vulkan_vma_buffer_wrap_imported(
+        (iree_hal_allocator_t*)allocator, params->type, params->access,
+        params->usage, buffer_size, /*byte_offset=*/0,
+        /*byte_length=*/buffer_size, logical_device, handle, memory,
+        release_callback, out_buffer);
+  }
+
+  if (!iree_status_is_ok(status)) {
+    if (memory) {
+      syms->vkFreeMemory(*logical_device, memory, logical_device->allocator());
+    }
+    syms->vkDestroyBuffer(*logical_device, handle,
+                          logical_device->allocator());
+  }
+  return status;
+}
+
 static iree_status_t iree_hal_vulkan_vma_allocator_import_buffer(
     iree_hal_allocator_t* IREE_RESTRICT base_allocator,
     const iree_hal_buffer_params_t* IREE_RESTRICT params,
     iree_hal_external_buffer_t* IREE_RESTRICT external_buffer,
     iree_hal_buffer_release_callback_t release_callback,
     iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
-  // TODO(#7242): use VK_EXT_external_memory_host to import memory.
-  return iree_make_status(IREE_STATUS_UNAVAILABLE,
-                          "importing from external buffers not supported");
+  iree_hal_vulkan_vma_allocator_t* allocator =
+      iree_hal_vulkan_vma_allocator_cast(base_allocator);
+  const iree_hal_vulkan_device_extensions_t& extensions =
+      allocator->logical_device->enabled_extensions();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (int64_t)external_buffer->type);
+
+  iree_status_t status = iree_ok_status();
+  switch (external_buffer->type) {
+    case IREE_HAL_EXTERNAL_BUFFER_TYPE_OPAQUE_FD: {
+      if (!extensions.external_memory_fd) {
+        status = iree_make_status(
+            IREE_STATUS_UNAVAILABLE,
+            "importing opaque fds requires VK_KHR_external_memory_fd");
+        break;
+      }
+      // Opaque fds have no queryable properties and must be imported with the
+      // same size and a memory type compatible with the exporting allocation.
+      VkImportMemoryFdInfoKHR import_info;
+      import_info.sType = VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR;
+      import_info.pNext = NULL;
+      import_info.handleType = VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT;
+      import_info.fd = external_buffer->handle.opaque_fd.fd;
+      VkMemoryRequirements memory_requirements;
+      memory_requirements.size = external_buffer->size;
+      memory_requirements.alignment = 0;
+      memory_requirements.memoryTypeBits = UINT32_MAX;
+      status = iree_hal_vulkan_vma_allocator_import_memory(
+          allocator, params, import_info.handleType, &import_info,
+          memory_requirements, external_buffer->size, release_callback,
+          out_buffer);
+      break;
+    }
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+    case IREE_HAL_EXTERNAL_BUFFER_TYPE_ANDROID_HARDWARE_BUFFER: {
+      if (!extensions.external_memory_android_hardware_buffer) {
+        status = iree_make_status(
+            IREE_STATUS_UNAVAILABLE,
+            "importing AHardwareBuffers requires "
+            "VK_ANDROID_external_memory_android_hardware_buffer");
+        break;
+      }
+      struct AHardwareBuffer* hardware_buffer =
+          (struct AHardwareBuffer*)
+              external_buffer->handle.android_hardware_buffer.buffer;
+      VkAndroidHardwareBufferPropertiesANDROID properties;
+      properties.sType =
+          VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_PROPERTIES_ANDROID;
+      properties.pNext = NULL;
+      status = VK_RESULT_TO_STATUS(
+          allocator->logical_device->syms()
+              ->vkGetAndroidHardwareBufferPropertiesANDROID(
+                  *allocator->logical_device, hardware_buffer, &properties),
+          "vkGetAndroidHardwareBufferPropertiesANDROID");
+      if (!iree_status_is_ok(status)) break;
+      VkImportAndroidHardwareBufferInfoANDROID import_info;
+      import_info.sType =
+          VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID;
+      import_info.pNext = NULL;
+      import_info.buffer = hardware_buffer;
+      VkMemoryRequirements memory_requirements;
+      memory_requirements.size = properties.allocationSize;
+      memory_requirements.alignment = 0;
+      memory_requirements.memoryTypeBits = properties.memoryTypeBits;
+      iree_device_size_t buffer_size =
+          external_buffer->size ? external_buffer->size
+                                : (iree_device_size_t)properties.allocationSize;
+      status = iree_hal_vulkan_vma_allocator_import_memory(
+          allocator, params,
+          VK_EXTERNAL_MEMORY_HANDLE_TYPE_ANDROID_HARDWARE_BUFFER_BIT_ANDROID,
+          &import_info, memory_requirements, buffer_size, release_callback,
+          out_buffer);
+      break;
+    }
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+    default:
+      // TODO(#7242): use VK_EXT_external_memory_host to import memory.
+      status = iree_make_status(IREE_STATUS_UNAVAILABLE,
+                                "external buffer type %d not supported",
+                                (int)external_buffer->type);
+      break;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
 }
 
 static iree_status_t iree_hal_vulkan_vma_allocator_export_buffer(
@@ -30,13 +30,19 @@ extern "C" {
 // VMA is internally synchronized and the functionality exposed on the HAL
 // interface is thread-safe.
 //
+// Buffers are owned exclusively by a single queue family unless more than one
+// of |queue_family_indices| is provided in which case they are shared
+// concurrently between all of them. Concurrent sharing allows buffers to be
+// used by queues of different families without ownership transfers.
+//
 // More information:
 //   https://github.com/GPUOpen-LibrariesAndSDKs/VulkanMemoryAllocator
 //   https://gpuopen-librariesandsdks.github.io/VulkanMemoryAllocator/html/
 iree_status_t iree_hal_vulkan_vma_allocator_create(
     VkInstance instance, VkPhysicalDevice physical_device,
     iree::hal::vulkan::VkDeviceHandle* logical_device,
-    iree_hal_device_t* device, iree_hal_allocator_t** out_allocator);
+    iree_hal_device_t* device, iree_host_size_t queue_family_count,
+    const uint32_t* queue_family_indices, iree_hal_allocator_t** out_allocator);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -14,6 +14,8 @@
 #include "iree/base/tracing.h"
 #include "iree/hal/drivers/vulkan/status_util.h"
 
+using namespace iree::hal::vulkan;
+
 typedef struct iree_hal_vulkan_vma_buffer_t {
   iree_hal_buffer_t base;
 
@@ -21,6 +23,13 @@ typedef struct iree_hal_vulkan_vma_buffer_t {
   VkBuffer handle;
   VmaAllocation allocation;
   VmaAllocationInfo allocation_info;
+
+  // Imported buffers have no VMA allocation and instead own |memory| directly.
+  // Persistently mapped into |host_ptr| when mapping is allowed.
+  VkDeviceHandle* logical_device;
+  VkDeviceMemory memory;
+  void* host_ptr;
+  iree_hal_buffer_release_callback_t release_callback;
 } iree_hal_vulkan_vma_buffer_t;
 
 namespace {
@@ -61,6 +70,10 @@ iree_status_t iree_hal_vulkan_vma_buffer_wrap(
     buffer->handle = handle;
     buffer->allocation = allocation;
     buffer->allocation_info = allocation_info;
+    buffer->logical_device = NULL;
+    buffer->memory = VK_NULL_HANDLE;
+    buffer->host_ptr = NULL;
+    buffer->release_callback = iree_hal_buffer_release_callback_null();
 
     // TODO(benvanik): set debug name instead and use the
     //     VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT flag.
@@ -79,6 +92,59 @@ iree_status_t iree_hal_vulkan_vma_buffer_wrap(
   return iree_ok_status();
 }
 
+iree_status_t iree_hal_vulkan_vma_buffer_wrap_imported(
+    iree_hal_allocator_t* allocator, iree_hal_memory_type_t memory_type,
+    iree_hal_memory_access_t allowed_access,
+    iree_hal_buffer_usage_t allowed_usage, iree_device_size_t allocation_size,
+    iree_device_size_t byte_offset, iree_device_size_t byte_length,
+    VkDeviceHandle* logical_device, VkBuffer handle, VkDeviceMemory memory,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** out_buffer) {
+  IREE_ASSERT_ARGUMENT(allocator);
+  IREE_ASSERT_ARGUMENT(logical_device);
+  IREE_ASSERT_ARGUMENT(handle);
+  IREE_ASSERT_ARGUMENT(memory);
+  IREE_ASSERT_ARGUMENT(out_buffer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // vkMapMemory cannot be nested so rather than tracking outstanding mappings
+  // the memory is mapped once for the lifetime of the buffer.
+  void* host_ptr = NULL;
+  if (iree_all_bits_set(allowed_usage, IREE_HAL_BUFFER_USAGE_MAPPING)) {
+    IREE_RETURN_AND_END_ZONE_IF_ERROR(
+        z0, VK_RESULT_TO_STATUS(logical_device->syms()->vkMapMemory(
+                                    *logical_device, memory, /*offset=*/0,
+                                    VK_WHOLE_SIZE, /*flags=*/0, &host_ptr),
+                                "vkMapMemory"));
+  }
+
+  iree_allocator_t host_allocator =
+      iree_hal_allocator_host_allocator(allocator);
+  iree_hal_vulkan_vma_buffer_t* buffer = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(host_allocator, sizeof(*buffer), (void**)&buffer);
+  if (iree_status_is_ok(status)) {
+    iree_hal_buffer_initialize(
+        host_allocator, allocator, &buffer->base, allocation_size, byte_offset,
+        byte_length, memory_type, allowed_access, allowed_usage,
+        &iree_hal_vulkan_vma_buffer_vtable, &buffer->base);
+    buffer->vma = VK_NULL_HANDLE;
+    buffer->handle = handle;
+    buffer->allocation = VK_NULL_HANDLE;
+    memset(&buffer->allocation_info, 0, sizeof(buffer->allocation_info));
+    buffer->logical_device = logical_device;
+    buffer->memory = memory;
+    buffer->host_ptr = host_ptr;
+    buffer->release_callback = release_callback;
+    *out_buffer = &buffer->base;
+  } else if (host_ptr) {
+    logical_device->syms()->vkUnmapMemory(*logical_device, memory);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static void iree_hal_vulkan_vma_buffer_destroy(iree_hal_buffer_t* base_buffer) {
   iree_hal_vulkan_vma_buffer_t* buffer =
       iree_hal_vulkan_vma_buffer_cast(base_buffer);
@@ -87,7 +153,20 @@ static void iree_hal_vulkan_vma_buffer_destroy(iree_hal_buffer_t* base_buffer) {
 
   // IREE_TRACE_FREE_NAMED("VMA", (void*)buffer->handle);
 
-  vmaDestroyBuffer(buffer->vma, buffer->handle, buffer->allocation);
+  if (buffer->allocation) {
+    vmaDestroyBuffer(buffer->vma, buffer->handle, buffer->allocation);
+  } else {
+    // Imported memory; freeing implicitly unmaps it.
+    VkDeviceHandle* logical_device = buffer->logical_device;
+    logical_device->syms()->vkDestroyBuffer(*logical_device, buffer->handle,
+                                            logical_device->allocator());
+    logical_device->syms()->vkFreeMemory(*logical_device, buffer->memory,
+                                         logical_device->allocator());
+    if (buffer->release_callback.fn) {
+      buffer->release_callback.fn(buffer->release_callback.user_data,
+                                  base_buffer);
+    }
+  }
   iree_allocator_free(host_allocator, buffer);
 
   IREE_TRACE_ZONE_END(z0);
@@ -116,9 +195,13 @@ static iree_status_t iree_hal_vulkan_vma_buffer_map_range(
                                      IREE_HAL_BUFFER_USAGE_MAPPING));
 
   uint8_t* data_ptr = nullptr;
-  VK_RETURN_IF_ERROR(
-      vmaMapMemory(buffer->vma, buffer->allocation, (void**)&data_ptr),
-      "vmaMapMemory");
+  if (buffer->allocation) {
+    VK_RETURN_IF_ERROR(
+        vmaMapMemory(buffer->vma, buffer->allocation, (void**)&data_ptr),
+        "vmaMapMemory");
+  } else {
+    data_ptr = (uint8_t*)buffer->host_ptr;
+  }
   mapping->contents =
       iree_make_byte_span(data_ptr + local_byte_offset, local_byte_length);
 
@@ -140,15 +223,39 @@ static iree_status_t iree_hal_vulkan_vma_buffer_unmap_range(
     iree_device_size_t local_byte_length, iree_hal_buffer_mapping_t* mapping) {
   iree_hal_vulkan_vma_buffer_t* buffer =
       iree_hal_vulkan_vma_buffer_cast(base_buffer);
-  vmaUnmapMemory(buffer->vma, buffer->allocation);
+  if (buffer->allocation) {
+    vmaUnmapMemory(buffer->vma, buffer->allocation);
+  }
   return iree_ok_status();
 }
 
+// Returns a range covering all of the imported memory of |buffer|.
+// Ranges must otherwise be aligned to nonCoherentAtomSize and the whole memory
+// is no more expensive to flush/invalidate than a subrange in practice.
+static VkMappedMemoryRange iree_hal_vulkan_vma_buffer_imported_range(
+    iree_hal_vulkan_vma_buffer_t* buffer) {
+  VkMappedMemoryRange range;
+  range.sType = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE;
+  range.pNext = NULL;
+  range.memory = buffer->memory;
+  range.offset = 0;
+  range.size = VK_WHOLE_SIZE;
+  return range;
+}
+
 static iree_status_t iree_hal_vulkan_vma_buffer_invalidate_range(
     iree_hal_buffer_t* base_buffer, iree_device_size_t local_byte_offset,
     iree_device_size_t local_byte_length) {
   iree_hal_vulkan_vma_buffer_t* buffer =
       iree_hal_vulkan_vma_buffer_cast(base_buffer);
+  if (!buffer->allocation) {
+    VkMappedMemoryRange range =
+        iree_hal_vulkan_vma_buffer_imported_range(buffer);
+    return VK_RESULT_TO_STATUS(
+        buffer->logical_device->syms()->vkInvalidateMappedMemoryRanges(
+            *buffer->logical_device, 1, &range),
+        "vkInvalidateMappedMemoryRanges");
+  }
   VK_RETURN_IF_ERROR(
       vmaInvalidateAllocation(buffer->vma, buffer->allocation,
                               local_byte_offset, local_byte_length),
@@ -161,6 +268,14 @@ static iree_status_t iree_hal_vulkan_vma_buffer_flush_range(
     iree_device_size_t local_byte_length) {
   iree_hal_vulkan_vma_buffer_t* buffer =
       iree_hal_vulkan_vma_buffer_cast(base_buffer);
+  if (!buffer->allocation) {
+    VkMappedMemoryRange range =
+        iree_hal_vulkan_vma_buffer_imported_range(buffer);
+    return VK_RESULT_TO_STATUS(
+        buffer->logical_device->syms()->vkFlushMappedMemoryRanges(
+            *buffer->logical_device, 1, &range),
+        "vkFlushMappedMemoryRanges");
+  }
   VK_RETURN_IF_ERROR(vmaFlushAllocation(buffer->vma, buffer->allocation,
                                         local_byte_offset, local_byte_length),
                      "vmaFlushAllocation");
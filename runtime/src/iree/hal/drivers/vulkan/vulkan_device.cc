@@ -29,12 +29,16 @@
 #include "iree/hal/drivers/vulkan/native_executable_layout.h"
 #include "iree/hal/drivers/vulkan/native_semaphore.h"
 #include "iree/hal/drivers/vulkan/nop_executable_cache.h"
+#include "iree/hal/drivers/vulkan/pipeline_cache.h"
+#include "iree/hal/drivers/vulkan/profiler.h"
+#include "iree/hal/drivers/vulkan/rebindable_command_buffer.h"
 #include "iree/hal/drivers/vulkan/status_util.h"
 #include "iree/hal/drivers/vulkan/tracing.h"
 #include "iree/hal/drivers/vulkan/util/arena.h"
 #include "iree/hal/drivers/vulkan/util/ref_ptr.h"
 #include "iree/hal/drivers/vulkan/vma_allocator.h"
 #include "iree/hal/utils/buffer_transfer.h"
+#include "iree/hal/utils/transient_buffer_pool.h"
 
 using namespace iree::hal::vulkan;
 
@@ -110,6 +114,25 @@ IREE_API_EXPORT iree_status_t iree_hal_vulkan_query_extensibility_set(
   ADD_EXT(IREE_HAL_VULKAN_EXTENSIBILITY_DEVICE_EXTENSIONS_OPTIONAL,
           VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
 
+  // VK_KHR_external_memory + VK_KHR_external_memory_fd:
+  // Allows importing buffers shared by other APIs and processes as opaque file
+  // descriptors without copies. VK_KHR_external_memory was promoted to core in
+  // Vulkan 1.1.
+  ADD_EXT(IREE_HAL_VULKAN_EXTENSIBILITY_DEVICE_EXTENSIONS_OPTIONAL,
+          VK_KHR_EXTERNAL_MEMORY_EXTENSION_NAME);
+  ADD_EXT(IREE_HAL_VULKAN_EXTENSIBILITY_DEVICE_EXTENSIONS_OPTIONAL,
+          VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME);
+
+#if defined(VK_USE_PLATFORM_ANDROID_KHR)
+  // VK_ANDROID_external_memory_android_hardware_buffer:
+  // Allows importing AHardwareBuffers (such as those produced by camera and
+  // video pipelines) without copies. Depends on VK_EXT_queue_family_foreign.
+  ADD_EXT(IREE_HAL_VULKAN_EXTENSIBILITY_DEVICE_EXTENSIONS_OPTIONAL,
+          VK_EXT_QUEUE_FAMILY_FOREIGN_EXTENSION_NAME);
+  ADD_EXT(IREE_HAL_VULKAN_EXTENSIBILITY_DEVICE_EXTENSIONS_OPTIONAL,
+          VK_ANDROID_EXTERNAL_MEMORY_ANDROID_HARDWARE_BUFFER_EXTENSION_NAME);
+#endif  // VK_USE_PLATFORM_ANDROID_KHR
+
   //===--------------------------------------------------------------------===//
   // Vulkan forward-compatibility shims
   //===--------------------------------------------------------------------===//
@@ -148,7 +171,8 @@ IREE_API_EXPORT iree_status_t iree_hal_vulkan_query_extensibility_set(
             VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
   }
 
-#if IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+#if (IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION) && \
+    (IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_TRACY)
   if (iree_all_bits_set(requested_features,
                         IREE_HAL_VULKAN_FEATURE_ENABLE_TRACING)) {
     // VK_EXT_host_query_reset:
@@ -359,9 +383,14 @@ typedef struct iree_hal_vulkan_device_t {
   iree_allocator_t host_allocator;
   iree_hal_allocator_t* device_allocator;
 
+  // Pool of device allocations recycled by queue-ordered allocations.
+  iree_hal_transient_buffer_pool_t* transient_pool;
+
   // All queues available on the device; the device owns these.
   iree_host_size_t queue_count;
   CommandQueue** queues;
+  // Queue family of dispatch_queues.
+  uint32_t dispatch_queue_family_index;
   // The subset of queues that support dispatch operations. May overlap with
   // transfer_queues.
   iree_host_size_t dispatch_queue_count;
@@ -384,6 +413,12 @@ typedef struct iree_hal_vulkan_device_t {
   iree_arena_block_pool_t block_pool;
 
   BuiltinExecutables* builtin_executables;
+
+  // Pipeline cache shared by all executable caches created on the device.
+  iree_hal_vulkan_pipeline_cache_t* pipeline_cache;
+
+  // Active dispatch profiler capture, if any.
+  iree_hal_vulkan_profiler_t* profiler;
 } iree_hal_vulkan_device_t;
 
 namespace {
@@ -400,6 +435,8 @@ IREE_API_EXPORT void iree_hal_vulkan_device_options_initialize(
     iree_hal_vulkan_device_options_t* out_options) {
   memset(out_options, 0, sizeof(*out_options));
   out_options->flags = 0;
+  out_options->pipeline_cache_path = iree_string_view_empty();
+  out_options->pipeline_cache_data = iree_const_byte_span_empty();
 }
 
 // Creates a transient command pool for the given queue family.
@@ -586,15 +623,34 @@ static iree_status_t iree_hal_vulkan_device_create_internal(
   device->queue_tracing_contexts =
       (iree_hal_vulkan_tracing_context_t**)buffer_ptr;
   buffer_ptr += total_queue_count * sizeof(device->queue_tracing_contexts[0]);
+  device->dispatch_queue_family_index = compute_queue_set->queue_family_index;
 
   device->descriptor_pool_cache =
       new DescriptorPoolCache(device->logical_device);
 
   // Create the device memory allocator that will service all buffer
-  // allocation requests.
+  // allocation requests. When transfers are submitted to queues of a different
+  // family than dispatches buffers must be shared between both families.
+  uint32_t queue_family_indices[2] = {
+      compute_queue_set->queue_family_index,
+      transfer_queue_set->queue_family_index,
+  };
+  iree_host_size_t queue_family_count = 1;
+  if (iree_all_bits_set(
+          options->flags,
+          IREE_HAL_VULKAN_DEVICE_FLAG_DEDICATED_TRANSFER_QUEUES) &&
+      transfer_queue_set->queue_indices != 0 &&
+      transfer_queue_set->queue_family_index !=
+          compute_queue_set->queue_family_index) {
+    queue_family_count = 2;
+  }
   iree_status_t status = iree_hal_vulkan_vma_allocator_create(
       instance, physical_device, logical_device, (iree_hal_device_t*)device,
-      &device->device_allocator);
+      queue_family_count, queue_family_indices, &device->device_allocator);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_transient_buffer_pool_create(
+        device->device_allocator, host_allocator, &device->transient_pool);
+  }
 
   // Create command pools for each queue family. If we don't have a transfer
   // queue then we'll ignore that one and just use the dispatch pool.
@@ -621,6 +677,12 @@ static iree_status_t iree_hal_vulkan_device_create_internal(
         transfer_queue_set);
   }
 
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_vulkan_pipeline_cache_allocate(
+        device->logical_device, physical_device, options->pipeline_cache_path,
+        options->pipeline_cache_data, &device->pipeline_cache);
+  }
+
   if (iree_status_is_ok(status)) {
     device->builtin_executables =
         new BuiltinExecutables(device->logical_device);
@@ -646,6 +708,9 @@ static void iree_hal_vulkan_device_destroy(iree_hal_device_t* base_device) {
     iree_hal_vulkan_tracing_context_free(device->queue_tracing_contexts[i]);
   }
 
+  // Drop any capture that was never ended now that its queries are unused.
+  iree_hal_vulkan_profiler_destroy(device->profiler);
+
   // Drop command pools now that we know there are no more outstanding command
   // buffers.
   delete device->dispatch_command_pool;
@@ -655,8 +720,10 @@ static void iree_hal_vulkan_device_destroy(iree_hal_device_t* base_device) {
   // have been in use.
   delete device->builtin_executables;
   delete device->descriptor_pool_cache;
+  iree_hal_vulkan_pipeline_cache_free(device->pipeline_cache);
 
   // There should be no more buffers live that use the allocator.
+  iree_hal_transient_buffer_pool_free(device->transient_pool);
   iree_hal_allocator_release(device->device_allocator);
 
   // All arena blocks should have been returned.
@@ -874,7 +941,8 @@ IREE_API_EXPORT iree_status_t iree_hal_vulkan_wrap_device(
       iree_hal_vulkan_infer_enabled_device_extensions(device_syms.get());
 
   iree_hal_vulkan_features_t enabled_features = 0;
-#if IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
+#if (IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION) && \
+    (IREE_TRACING_PROVIDER == IREE_TRACING_PROVIDER_TRACY)
   enabled_features |= IREE_HAL_VULKAN_FEATURE_ENABLE_TRACING;
 #endif  // IREE_TRACING_FEATURES & IREE_TRACING_FEATURE_INSTRUMENTATION
 
@@ -894,6 +962,16 @@ IREE_API_EXPORT iree_status_t iree_hal_vulkan_wrap_device(
   return status;
 }
 
+IREE_API_EXPORT iree_status_t iree_hal_vulkan_device_query_pipeline_cache_data(
+    iree_hal_device_t* base_device, iree_host_size_t data_capacity, void* data,
+    iree_host_size_t* out_data_length) {
+  IREE_ASSERT_ARGUMENT(base_device);
+  IREE_ASSERT_ARGUMENT(out_data_length);
+  iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
+  return iree_hal_vulkan_pipeline_cache_serialize(
+      device->pipeline_cache, data_capacity, data, out_data_length);
+}
+
 static iree_string_view_t iree_hal_vulkan_device_id(
     iree_hal_device_t* base_device) {
   iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
@@ -912,10 +990,19 @@ static iree_hal_allocator_t* iree_hal_vulkan_device_allocator(
   return device->device_allocator;
 }
 
+static void iree_hal_vulkan_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
 static iree_status_t iree_hal_vulkan_device_trim(
     iree_hal_device_t* base_device) {
   iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
   iree_arena_block_pool_trim(&device->block_pool);
+  iree_hal_transient_buffer_pool_trim(device->transient_pool);
   return iree_hal_allocator_trim(device->device_allocator);
 }
 
@@ -941,18 +1028,34 @@ static iree_status_t iree_hal_vulkan_device_query_i64(
       (int)category.size, category.data, (int)key.size, key.data);
 }
 
-// Returns the queue to submit work to based on the |queue_affinity|.
-static CommandQueue* iree_hal_vulkan_device_select_queue(
+// Returns the command categories work is scheduled with on |device|.
+// Transfer-only work is treated as dispatch work unless dedicated transfer
+// queues were requested and are available.
+static iree_hal_command_category_t iree_hal_vulkan_device_schedule_categories(
     iree_hal_vulkan_device_t* device,
-    iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity) {
+    iree_hal_command_category_t command_categories) {
+  if (device->transfer_command_pool &&
+      iree_all_bits_set(
+          device->flags,
+          IREE_HAL_VULKAN_DEVICE_FLAG_DEDICATED_TRANSFER_QUEUES)) {
+    return command_categories;
+  }
   // TODO(scotttodd): revisit queue selection logic and remove this
   //   * the unaligned buffer fill polyfill and tracing timestamp queries may
   //     both insert dispatches into command buffers that at compile time are
   //     expected to only contain transfer commands
   //   * we could set a bit at recording time if emulation or tracing is used
   //     and submit to the right queue based on that
-  command_categories |= IREE_HAL_COMMAND_CATEGORY_DISPATCH;
+  return command_categories | IREE_HAL_COMMAND_CATEGORY_DISPATCH;
+}
+
+// Returns the queue to submit work to based on the |queue_affinity|.
+static CommandQueue* iree_hal_vulkan_device_select_queue(
+    iree_hal_vulkan_device_t* device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity) {
+  command_categories =
+      iree_hal_vulkan_device_schedule_categories(device, command_categories);
 
   // TODO(benvanik): meaningful heuristics for affinity. We don't generate
   // anything from the compiler that uses multiple queues and until we do it's
@@ -967,17 +1070,11 @@ static CommandQueue* iree_hal_vulkan_device_select_queue(
 static iree_status_t iree_hal_vulkan_device_create_command_buffer(
     iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
     iree_hal_command_buffer_t** out_command_buffer) {
   iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
-
-  // TODO(scotttodd): revisit queue selection logic and remove this
-  //   * the unaligned buffer fill polyfill and tracing timestamp queries may
-  //     both insert dispatches into command buffers that at compile time are
-  //     expected to only contain transfer commands
-  //   * we could set a bit at recording time if emulation or tracing is used
-  //     and submit to the right queue based on that
-  command_categories |= IREE_HAL_COMMAND_CATEGORY_DISPATCH;
+  command_categories =
+      iree_hal_vulkan_device_schedule_categories(device, command_categories);
 
   // Select the command pool to used based on the types of commands used.
   // Note that we may not have a dedicated transfer command pool if there are
@@ -999,11 +1096,21 @@ static iree_status_t iree_hal_vulkan_device_create_command_buffer(
   CommandQueue* queue = iree_hal_vulkan_device_select_queue(
       device, command_categories, queue_affinity);
 
+  // Command buffers using binding tables are recorded once and replayed into
+  // direct command buffers for each set of bindings they are submitted with.
+  if (binding_capacity > 0) {
+    return iree_hal_vulkan_rebindable_command_buffer_create(
+        base_device, device->logical_device, command_pool, mode,
+        command_categories, queue_affinity, binding_capacity,
+        queue->tracing_context(), device->descriptor_pool_cache,
+        device->builtin_executables, &device->block_pool, out_command_buffer);
+  }
+
   return iree_hal_vulkan_direct_command_buffer_allocate(
       base_device, device->logical_device, command_pool, mode,
       command_categories, queue_affinity, queue->tracing_context(),
-      device->descriptor_pool_cache, device->builtin_executables,
-      &device->block_pool, out_command_buffer);
+      device->profiler, device->descriptor_pool_cache,
+      device->builtin_executables, &device->block_pool, out_command_buffer);
 }
 
 static iree_status_t iree_hal_vulkan_device_create_descriptor_set(
@@ -1040,7 +1147,9 @@ static iree_status_t iree_hal_vulkan_device_create_executable_cache(
     iree_loop_t loop, iree_hal_executable_cache_t** out_executable_cache) {
   iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
   return iree_hal_vulkan_nop_executable_cache_create(
-      device->logical_device, identifier, out_executable_cache);
+      device->logical_device,
+      iree_hal_vulkan_pipeline_cache_handle(device->pipeline_cache),
+      identifier, out_executable_cache);
 }
 
 static iree_status_t iree_hal_vulkan_device_create_executable_layout(
@@ -1087,6 +1196,63 @@ static iree_status_t iree_hal_vulkan_device_queue_submit(
   return queue->Submit(batch_count, batches);
 }
 
+// Enqueues a barrier that signals |signal_semaphore_list| once
+// |wait_semaphore_list| has been reached.
+static iree_status_t iree_hal_vulkan_device_queue_barrier(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list) {
+  if (!wait_semaphore_list.count && !signal_semaphore_list.count) {
+    return iree_ok_status();
+  }
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = wait_semaphore_list;
+  batch.signal_semaphores = signal_semaphore_list;
+  return iree_hal_vulkan_device_queue_submit(
+      base_device, IREE_HAL_COMMAND_CATEGORY_ANY, queue_affinity, 1, &batch);
+}
+
+static iree_status_t iree_hal_vulkan_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
+  // VMA allocations are bound to memory immediately and any reused storage is
+  // known to be unused once the waits are reached so we only need to order the
+  // signal on the queue.
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_transient_buffer_pool_acquire(
+      device->transient_pool, params, allocation_size, wait_semaphore_list,
+      &buffer));
+  iree_status_t status = iree_hal_vulkan_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+static iree_status_t iree_hal_vulkan_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
+  // The storage is available for reuse once the signal (or when there is none
+  // the wait) is reached.
+  IREE_RETURN_IF_ERROR(iree_hal_transient_buffer_pool_release(
+      device->transient_pool, buffer,
+      signal_semaphore_list.count ? signal_semaphore_list
+                                  : wait_semaphore_list));
+  return iree_hal_vulkan_device_queue_barrier(
+      base_device, queue_affinity, wait_semaphore_list, signal_semaphore_list);
+}
+
 static iree_status_t iree_hal_vulkan_device_submit_and_wait(
     iree_hal_device_t* base_device,
     iree_hal_command_category_t command_categories,
@@ -1123,12 +1289,60 @@ static iree_status_t iree_hal_vulkan_device_wait_idle(
   return iree_ok_status();
 }
 
+static iree_status_t iree_hal_vulkan_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
+  if (device->profiler) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "profiling already active");
+  }
+  if (!iree_all_bits_set(options->mode,
+                         IREE_HAL_DEVICE_PROFILING_MODE_DISPATCHES)) {
+    // No supported modes requested.
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Dispatches are captured when recorded: only one-shot command buffers
+  // created after this point are captured.
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_vulkan_profiler_create(
+              device->logical_device, device->physical_device,
+              device->dispatch_queue_family_index, options,
+              &device->profiler));
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_vulkan_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  iree_hal_vulkan_device_t* device = iree_hal_vulkan_device_cast(base_device);
+  if (!device->profiler) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // All captured dispatches must have completed before the capture is written.
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0,
+      iree_hal_vulkan_device_wait_idle(base_device, iree_infinite_timeout()));
+
+  iree_hal_vulkan_profiler_t* profiler = device->profiler;
+  device->profiler = NULL;
+  iree_status_t status = iree_hal_vulkan_profiler_write(profiler);
+  iree_hal_vulkan_profiler_destroy(profiler);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 namespace {
 const iree_hal_device_vtable_t iree_hal_vulkan_device_vtable = {
     /*.destroy=*/iree_hal_vulkan_device_destroy,
     /*.id=*/iree_hal_vulkan_device_id,
     /*.host_allocator=*/iree_hal_vulkan_device_host_allocator,
     /*.device_allocator=*/iree_hal_vulkan_device_allocator,
+    /*.replace_device_allocator=*/iree_hal_vulkan_device_replace_allocator,
     /*.trim=*/iree_hal_vulkan_device_trim,
     /*.query_i64=*/iree_hal_vulkan_device_query_i64,
     /*.create_command_buffer=*/iree_hal_vulkan_device_create_command_buffer,
@@ -1144,10 +1358,14 @@ const iree_hal_device_vtable_t iree_hal_vulkan_device_vtable = {
     /*.query_semaphore_compatibility=*/
     iree_hal_vulkan_device_query_semaphore_compatibility,
     /*.transfer_range=*/iree_hal_device_submit_transfer_range_and_wait,
+    /*.queue_alloca=*/iree_hal_vulkan_device_queue_alloca,
+    /*.queue_dealloca=*/iree_hal_vulkan_device_queue_dealloca,
     /*.queue_submit=*/iree_hal_vulkan_device_queue_submit,
     /*.submit_and_wait=*/
     iree_hal_vulkan_device_submit_and_wait,
     /*.wait_semaphores=*/iree_hal_vulkan_device_wait_semaphores,
     /*.wait_idle=*/iree_hal_vulkan_device_wait_idle,
+    /*.profiling_begin=*/iree_hal_vulkan_device_profiling_begin,
+    /*.profiling_end=*/iree_hal_vulkan_device_profiling_end,
 };
 }  // namespace
@@ -33,6 +33,13 @@
 // https://djang86.blogspot.com/2019/01/what-is-vknoprototypes.html
 #define VK_NO_PROTOTYPES 1
 
+#include "iree/base/target_platform.h"
+
+// Platform APIs are only used for external memory interop.
+#if defined(IREE_PLATFORM_ANDROID) && !defined(VK_USE_PLATFORM_ANDROID_KHR)
+#define VK_USE_PLATFORM_ANDROID_KHR 1
+#endif  // IREE_PLATFORM_ANDROID
+
 #include <vulkan/vulkan.h>  // IWYU pragma: export
 
 #ifdef IREE_PLATFORM_APPLE
@@ -188,6 +188,21 @@ IREE_API_EXPORT iree_status_t iree_hal_executable_cache_prepare_executable(
     const iree_hal_executable_params_t* executable_params,
     iree_hal_executable_t** out_executable);
 
+// Prepares |executable_count| executables defined by |executable_params| for
+// use as with iree_hal_executable_cache_prepare_executable. The prepared
+// executables are returned in the matching indices of |out_executables|.
+//
+// Implementations may prepare the executables concurrently (such as by
+// loading and relocating them across a pool of host threads) and batching
+// should be preferred when multiple executables are needed at the same time.
+// If any executable fails to prepare then all are released and the failure is
+// returned.
+IREE_API_EXPORT iree_status_t iree_hal_executable_cache_prepare_executables(
+    iree_hal_executable_cache_t* executable_cache,
+    iree_host_size_t executable_count,
+    const iree_hal_executable_params_t* executable_params,
+    iree_hal_executable_t** out_executables);
+
 //===----------------------------------------------------------------------===//
 // iree_hal_executable_cache_t implementation details
 //===----------------------------------------------------------------------===//
@@ -204,6 +219,13 @@ typedef struct iree_hal_executable_cache_vtable_t {
       iree_hal_executable_cache_t* executable_cache,
       const iree_hal_executable_params_t* executable_params,
       iree_hal_executable_t** out_executable);
+
+  // Optional; executables are prepared one at a time when omitted.
+  iree_status_t(IREE_API_PTR* prepare_executables)(
+      iree_hal_executable_cache_t* executable_cache,
+      iree_host_size_t executable_count,
+      const iree_hal_executable_params_t* executable_params,
+      iree_hal_executable_t** out_executables);
 } iree_hal_executable_cache_vtable_t;
 IREE_HAL_ASSERT_VTABLE_LAYOUT(iree_hal_executable_cache_vtable_t);
 
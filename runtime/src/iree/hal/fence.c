@@ -0,0 +1,229 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/fence.h"
+
+#include <stddef.h>
+
+#include "iree/base/tracing.h"
+
+struct iree_hal_fence_t {
+  iree_atomic_ref_count_t ref_count;
+  iree_allocator_t host_allocator;
+  iree_host_size_t capacity;
+  iree_host_size_t count;
+  // Retained semaphores and their payload values; stored inline.
+  iree_hal_semaphore_t** semaphores;
+  uint64_t* payload_values;
+};
+
+IREE_API_EXPORT iree_status_t iree_hal_fence_create(
+    iree_host_size_t capacity, iree_allocator_t host_allocator,
+    iree_hal_fence_t** out_fence) {
+  IREE_ASSERT_ARGUMENT(out_fence);
+  *out_fence = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)capacity);
+
+  iree_hal_fence_t* fence = NULL;
+  iree_host_size_t total_size =
+      sizeof(*fence) + capacity * (sizeof(*fence->payload_values) +
+                                   sizeof(*fence->semaphores));
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, total_size, (void**)&fence));
+  iree_atomic_ref_count_init(&fence->ref_count);
+  fence->host_allocator = host_allocator;
+  fence->capacity = capacity;
+  fence->count = 0;
+  fence->payload_values = (uint64_t*)((uint8_t*)fence + sizeof(*fence));
+  fence->semaphores =
+      (iree_hal_semaphore_t**)(fence->payload_values + capacity);
+  *out_fence = fence;
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_fence_create_at(
+    iree_hal_semaphore_t* semaphore, uint64_t value,
+    iree_allocator_t host_allocator, iree_hal_fence_t** out_fence) {
+  IREE_ASSERT_ARGUMENT(semaphore);
+  IREE_ASSERT_ARGUMENT(out_fence);
+  iree_hal_fence_t* fence = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_fence_create(/*capacity=*/1, host_allocator, &fence));
+  iree_status_t status = iree_hal_fence_insert(fence, semaphore, value);
+  if (iree_status_is_ok(status)) {
+    *out_fence = fence;
+  } else {
+    iree_hal_fence_release(fence);
+  }
+  return status;
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_fence_join(
+    iree_host_size_t fence_count, iree_hal_fence_t** fences,
+    iree_allocator_t host_allocator, iree_hal_fence_t** out_fence) {
+  IREE_ASSERT_ARGUMENT(!fence_count || fences);
+  IREE_ASSERT_ARGUMENT(out_fence);
+  *out_fence = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Capacity is the worst case of no semaphores being shared.
+  iree_host_size_t capacity = 0;
+  for (iree_host_size_t i = 0; i < fence_count; ++i) {
+    capacity += iree_hal_fence_timepoint_count(fences[i]);
+  }
+  if (capacity == 0) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_ok_status();
+  }
+
+  iree_hal_fence_t* fence = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_fence_create(capacity, host_allocator, &fence));
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < fence_count && iree_status_is_ok(status);
+       ++i) {
+    iree_hal_fence_t* source_fence = fences[i];
+    if (!source_fence) continue;
+    for (iree_host_size_t j = 0;
+         j < source_fence->count && iree_status_is_ok(status); ++j) {
+      status = iree_hal_fence_insert(fence, source_fence->semaphores[j],
+                                     source_fence->payload_values[j]);
+    }
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_fence = fence;
+  } else {
+    iree_hal_fence_release(fence);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+IREE_API_EXPORT void iree_hal_fence_retain(iree_hal_fence_t* fence) {
+  if (IREE_LIKELY(fence)) {
+    iree_atomic_ref_count_inc(&fence->ref_count);
+  }
+}
+
+IREE_API_EXPORT void iree_hal_fence_release(iree_hal_fence_t* fence) {
+  if (IREE_LIKELY(fence) &&
+      iree_atomic_ref_count_dec(&fence->ref_count) == 1) {
+    iree_hal_fence_destroy(fence);
+  }
+}
+
+IREE_API_EXPORT void iree_hal_fence_destroy(iree_hal_fence_t* fence) {
+  iree_allocator_t host_allocator = fence->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  for (iree_host_size_t i = 0; i < fence->count; ++i) {
+    iree_hal_semaphore_release(fence->semaphores[i]);
+  }
+  iree_allocator_free(host_allocator, fence);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_fence_insert(
+    iree_hal_fence_t* fence, iree_hal_semaphore_t* semaphore, uint64_t value) {
+  IREE_ASSERT_ARGUMENT(fence);
+  IREE_ASSERT_ARGUMENT(semaphore);
+
+  // Fences are small and a linear scan is cheaper than anything smarter.
+  for (iree_host_size_t i = 0; i < fence->count; ++i) {
+    if (fence->semaphores[i] == semaphore) {
+      if (value > fence->payload_values[i]) fence->payload_values[i] = value;
+      return iree_ok_status();
+    }
+  }
+
+  if (fence->count >= fence->capacity) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "fence capacity %zu reached", fence->capacity);
+  }
+  fence->semaphores[fence->count] = semaphore;
+  fence->payload_values[fence->count] = value;
+  iree_hal_semaphore_retain(semaphore);
+  ++fence->count;
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_host_size_t
+iree_hal_fence_timepoint_count(const iree_hal_fence_t* fence) {
+  return fence ? fence->count : 0;
+}
+
+IREE_API_EXPORT iree_hal_semaphore_list_t
+iree_hal_fence_semaphore_list(iree_hal_fence_t* fence) {
+  if (!fence) return iree_hal_semaphore_list_empty();
+  iree_hal_semaphore_list_t list = {
+      .count = fence->count,
+      .semaphores = fence->semaphores,
+      .payload_values = fence->payload_values,
+  };
+  return list;
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_fence_query(iree_hal_fence_t* fence) {
+  if (!fence) return iree_ok_status();
+  for (iree_host_size_t i = 0; i < fence->count; ++i) {
+    uint64_t current_value = 0;
+    IREE_RETURN_IF_ERROR(
+        iree_hal_semaphore_query(fence->semaphores[i], &current_value));
+    if (current_value < fence->payload_values[i]) {
+      return iree_status_from_code(IREE_STATUS_DEFERRED);
+    }
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_fence_signal(iree_hal_fence_t* fence) {
+  if (!fence) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < fence->count && iree_status_is_ok(status);
+       ++i) {
+    status = iree_hal_semaphore_signal(fence->semaphores[i],
+                                       fence->payload_values[i]);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+IREE_API_EXPORT void iree_hal_fence_fail(iree_hal_fence_t* fence,
+                                         iree_status_t status) {
+  if (!fence || fence->count == 0) {
+    iree_status_ignore(status);
+    return;
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  // Each semaphore takes ownership of its own copy of the status.
+  for (iree_host_size_t i = 0; i < fence->count - 1; ++i) {
+    iree_hal_semaphore_fail(fence->semaphores[i], iree_status_clone(status));
+  }
+  iree_hal_semaphore_fail(fence->semaphores[fence->count - 1], status);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+IREE_API_EXPORT iree_status_t iree_hal_fence_wait(iree_hal_fence_t* fence,
+                                                  iree_timeout_t timeout) {
+  if (!fence) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  // Waits are sequential against a shared deadline; the semaphores may come
+  // from different devices and cannot be waited on together.
+  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < fence->count && iree_status_is_ok(status);
+       ++i) {
+    status = iree_hal_semaphore_wait(fence->semaphores[i],
+                                     fence->payload_values[i],
+                                     iree_make_deadline(deadline_ns));
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -0,0 +1,102 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_FENCE_H_
+#define IREE_HAL_FENCE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/device.h"
+#include "iree/hal/semaphore.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_fence_t
+//===----------------------------------------------------------------------===//
+
+// A set of semaphore timepoints defining a point in time across queues.
+// Fences are used to pass the asynchronous dependencies of queue operations
+// around as a single value: waiting on a fence waits until all of its
+// semaphores reach their payload values and signaling a fence signals each
+// semaphore to its payload value.
+//
+// Fences are immutable once shared and may be used any number of times.
+// A NULL fence is valid in all APIs and is treated as an empty fence that is
+// always reached.
+typedef struct iree_hal_fence_t iree_hal_fence_t;
+
+// Creates an empty fence with space for up to |capacity| timepoints.
+IREE_API_EXPORT iree_status_t iree_hal_fence_create(
+    iree_host_size_t capacity, iree_allocator_t host_allocator,
+    iree_hal_fence_t** out_fence);
+
+// Creates a fence with the single timepoint of |semaphore| reaching |value|.
+IREE_API_EXPORT iree_status_t iree_hal_fence_create_at(
+    iree_hal_semaphore_t* semaphore, uint64_t value,
+    iree_allocator_t host_allocator, iree_hal_fence_t** out_fence);
+
+// Joins the timepoints of all |fences| into a new fence taking the maximum
+// payload value of any semaphore present in multiple fences. NULL fences are
+// ignored and |out_fence| will be NULL if no timepoints remain.
+IREE_API_EXPORT iree_status_t iree_hal_fence_join(
+    iree_host_size_t fence_count, iree_hal_fence_t** fences,
+    iree_allocator_t host_allocator, iree_hal_fence_t** out_fence);
+
+// Retains the given |fence| for the caller.
+IREE_API_EXPORT void iree_hal_fence_retain(iree_hal_fence_t* fence);
+
+// Releases the given |fence| from the caller.
+IREE_API_EXPORT void iree_hal_fence_release(iree_hal_fence_t* fence);
+
+// Inserts the timepoint of |semaphore| reaching |value| into the |fence|.
+// If the semaphore is already present the maximum of the two payload values is
+// used. Must only be called while constructing a fence before it is shared.
+IREE_API_EXPORT iree_status_t iree_hal_fence_insert(
+    iree_hal_fence_t* fence, iree_hal_semaphore_t* semaphore, uint64_t value);
+
+// Returns the number of timepoints in the |fence|.
+IREE_API_EXPORT iree_host_size_t
+iree_hal_fence_timepoint_count(const iree_hal_fence_t* fence);
+
+// Returns a list of the timepoints in |fence| valid for the lifetime of the
+// fence. The list can be passed directly to queue operations.
+IREE_API_EXPORT iree_hal_semaphore_list_t
+iree_hal_fence_semaphore_list(iree_hal_fence_t* fence);
+
+// Returns OK if all timepoints in |fence| have been reached,
+// IREE_STATUS_DEFERRED if any have not, and the failure status of any failed
+// semaphore.
+IREE_API_EXPORT iree_status_t iree_hal_fence_query(iree_hal_fence_t* fence);
+
+// Signals all semaphores in |fence| to their payload values.
+IREE_API_EXPORT iree_status_t iree_hal_fence_signal(iree_hal_fence_t* fence);
+
+// Signals all semaphores in |fence| with a failure. Ownership of the |status|
+// transfers to the fence.
+IREE_API_EXPORT void iree_hal_fence_fail(iree_hal_fence_t* fence,
+                                         iree_status_t status);
+
+// Blocks the caller until all timepoints in |fence| are reached or the
+// |timeout| elapses. Follows the same semantics as iree_hal_semaphore_wait.
+IREE_API_EXPORT iree_status_t iree_hal_fence_wait(iree_hal_fence_t* fence,
+                                                  iree_timeout_t timeout);
+
+//===----------------------------------------------------------------------===//
+// iree_hal_fence_t implementation details
+//===----------------------------------------------------------------------===//
+
+IREE_API_EXPORT void iree_hal_fence_destroy(iree_hal_fence_t* fence);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_FENCE_H_
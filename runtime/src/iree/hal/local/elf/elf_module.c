@@ -230,23 +230,73 @@ static iree_byte_range_t iree_elf_module_calculate_vaddr_range(
   return byte_range;
 }
 
+// Returns true if |phdr| is an executable PT_LOAD segment that spans at least
+// one large page and should be backed by large pages when requested.
+static bool iree_elf_module_is_large_page_segment(
+    const iree_elf_module_load_state_t* load_state,
+    const iree_elf_phdr_t* phdr) {
+  const iree_host_size_t large_page_size =
+      load_state->memory_info.large_page_granularity;
+  return phdr->p_type == IREE_ELF_PT_LOAD && (phdr->p_flags & IREE_ELF_PF_X) &&
+         large_page_size > load_state->memory_info.normal_page_size &&
+         phdr->p_memsz >= large_page_size;
+}
+
+// Returns the offset from the start of a large page aligned reservation at
+// which the ELF must be placed such that its largest executable segment starts
+// on a large page boundary. Returns 0 if there are no segments that would
+// benefit from large pages.
+static iree_host_size_t iree_elf_module_calculate_large_page_offset(
+    iree_elf_module_load_state_t* load_state, iree_byte_range_t vaddr_range) {
+  const iree_elf_phdr_t* large_phdr = NULL;
+  for (iree_elf_half_t i = 0; i < load_state->ehdr->e_phnum; ++i) {
+    const iree_elf_phdr_t* phdr = &load_state->phdr_table[i];
+    if (!iree_elf_module_is_large_page_segment(load_state, phdr)) continue;
+    if (!large_phdr || phdr->p_memsz > large_phdr->p_memsz) large_phdr = phdr;
+  }
+  if (!large_phdr) return 0;
+  const iree_host_size_t large_page_size =
+      load_state->memory_info.large_page_granularity;
+  const iree_host_size_t segment_offset =
+      (iree_host_size_t)iree_page_align_start(
+          large_phdr->p_vaddr, load_state->memory_info.normal_page_size) -
+      vaddr_range.offset;
+  return (large_page_size - (segment_offset & (large_page_size - 1))) &
+         (large_page_size - 1);
+}
+
 // Allocates space for and loads all DT_LOAD segments into the host virtual
 // address space.
 static iree_status_t iree_elf_module_load_segments(
-    iree_const_byte_span_t raw_data, iree_elf_module_load_state_t* load_state,
-    iree_elf_module_t* module) {
+    iree_const_byte_span_t raw_data, iree_elf_module_flags_t flags,
+    iree_elf_module_load_state_t* load_state, iree_elf_module_t* module) {
   // Calculate the total internally-aligned vaddr range.
   iree_byte_range_t vaddr_range =
       iree_elf_module_calculate_vaddr_range(load_state);
 
+  // When using large pages the reservation is large page aligned and the
+  // module is shifted within it such that the executable segment starts on a
+  // large page boundary.
+  const bool use_large_pages =
+      iree_all_bits_set(flags, IREE_ELF_MODULE_FLAG_LARGE_PAGES);
+  iree_host_size_t large_page_offset = 0;
+  iree_memory_view_flags_t view_flags = IREE_MEMORY_VIEW_FLAG_MAY_EXECUTE;
+  if (use_large_pages) {
+    large_page_offset =
+        iree_elf_module_calculate_large_page_offset(load_state, vaddr_range);
+    view_flags |= IREE_MEMORY_VIEW_FLAG_LARGE_PAGES;
+  }
+
   // Reserve virtual address space in the host memory space. This memory is
   // uncommitted by default as the ELF may only sparsely use the address space.
-  module->vaddr_size = iree_page_align_end(
-      vaddr_range.length, load_state->memory_info.normal_page_size);
-  IREE_RETURN_IF_ERROR(iree_memory_view_reserve(
-      IREE_MEMORY_VIEW_FLAG_MAY_EXECUTE, module->vaddr_size,
-      module->host_allocator, (void**)&module->vaddr_base));
-  module->vaddr_bias = module->vaddr_base - vaddr_range.offset;
+  module->vaddr_size =
+      iree_page_align_end(large_page_offset + vaddr_range.length,
+                          load_state->memory_info.normal_page_size);
+  IREE_RETURN_IF_ERROR(iree_memory_view_reserve(view_flags, module->vaddr_size,
+                                                module->host_allocator,
+                                                (void**)&module->vaddr_base));
+  module->vaddr_bias =
+      module->vaddr_base + large_page_offset - vaddr_range.offset;
 
   // Commit and load all of the segments.
   for (iree_elf_half_t i = 0; i < load_state->ehdr->e_phnum; ++i) {
@@ -263,6 +313,13 @@ static iree_status_t iree_elf_module_load_segments(
         module->vaddr_bias, 1, &byte_range,
         IREE_MEMORY_ACCESS_READ | IREE_MEMORY_ACCESS_WRITE));
 
+    // Request large pages prior to populating the segment so that the initial
+    // faults can allocate them directly.
+    if (use_large_pages &&
+        iree_elf_module_is_large_page_segment(load_state, phdr)) {
+      iree_memory_view_advise_large_pages(module->vaddr_bias, 1, &byte_range);
+    }
+
     // Copy data present in the file.
     // TODO(benvanik): infra for being able to detect if the source model is in
     // a mapped file - if it is, we can remap the page and directly reference it
@@ -571,7 +628,7 @@ static const iree_elf_sym_t* iree_elf_module_lookup_global_symbol(
 
 iree_status_t iree_elf_module_initialize_from_memory(
     iree_const_byte_span_t raw_data,
-    const iree_elf_import_table_t* import_table,
+    const iree_elf_import_table_t* import_table, iree_elf_module_flags_t flags,
     iree_allocator_t host_allocator, iree_elf_module_t* out_module) {
   IREE_ASSERT_ARGUMENT(raw_data.data);
   IREE_ASSERT_ARGUMENT(out_module);
@@ -589,7 +646,8 @@ iree_status_t iree_elf_module_initialize_from_memory(
   // Allocate and load the ELF into memory.
   iree_memory_jit_context_begin();
   if (iree_status_is_ok(status)) {
-    status = iree_elf_module_load_segments(raw_data, &load_state, out_module);
+    status = iree_elf_module_load_segments(raw_data, flags, &load_state,
+                                           out_module);
   }
 
   // Parse required dynamic symbol tables in loaded memory. These are used for
@@ -128,6 +128,12 @@ enum iree_memory_view_flag_bits_t {
   // Indicates that the memory may be used to execute code.
   // May be used to ask for special privileges (like MAP_JIT on MacOS).
   IREE_MEMORY_VIEW_FLAG_MAY_EXECUTE = 1u << 10,
+
+  // Indicates that the reservation should be aligned to the large page
+  // granularity such that ranges within it can be backed by large pages with
+  // iree_memory_view_advise_large_pages. Ignored on platforms that are unable
+  // to align reservations.
+  IREE_MEMORY_VIEW_FLAG_LARGE_PAGES = 1u << 11,
 };
 typedef uint32_t iree_memory_view_flags_t;
 
@@ -169,6 +175,18 @@ iree_status_t iree_memory_view_protect_ranges(void* base_address,
                                               const iree_byte_range_t* ranges,
                                               iree_memory_access_t new_access);
 
+// Hints that the committed pages overlapping the byte ranges defined by
+// |byte_ranges| should be backed by large pages. Only the whole large pages
+// within each range (per iree_memory_info_t::large_page_granularity) are
+// affected and the hint must be given prior to writing to the pages.
+// Best-effort: platforms or configurations without support ignore the hint.
+//
+// Implemented by madvise+MADV_HUGEPAGE (transparent huge pages):
+//  https://www.kernel.org/doc/html/latest/admin-guide/mm/transhuge.html
+void iree_memory_view_advise_large_pages(void* base_address,
+                                         iree_host_size_t range_count,
+                                         const iree_byte_range_t* ranges);
+
 // Flushes the CPU instruction cache for a given range of bytes.
 // May be a no-op depending on architecture, but must be called prior to
 // executing code from any pages that have been written during load.
@@ -91,6 +91,12 @@ iree_status_t iree_memory_view_protect_ranges(void* base_address,
 #error "no instruction cache clear implementation"
 #endif  // !defined(IREE_ELF_CLEAR_CACHE)
 
+void iree_memory_view_advise_large_pages(void* base_address,
+                                         iree_host_size_t range_count,
+                                         const iree_byte_range_t* ranges) {
+  // No large page support; the default pages are used.
+}
+
 void iree_memory_view_flush_icache(void* base_address,
                                    iree_host_size_t length) {
   IREE_ELF_CLEAR_CACHE(base_address, base_address + length);
@@ -4,6 +4,7 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include "iree/base/internal/call_once.h"
 #include "iree/base/target_platform.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/local/elf/platform.h"
@@ -11,6 +12,8 @@
 #if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX)
 
 #include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
 #include <sys/mman.h>
 #include <unistd.h>
 
@@ -18,6 +21,33 @@
 // Memory subsystem information and control
 //==============================================================================
 
+// Large pages are provided by transparent huge pages (THP) and only usable
+// when the kernel was built with support for them. Explicit hugetlbfs pages
+// require up-front reservation by the system administrator and are not used.
+static iree_once_flag iree_memory_large_page_size_flag = IREE_ONCE_FLAG_INIT;
+static iree_host_size_t iree_memory_large_page_size = 0;
+
+static void iree_memory_query_large_page_size(void) {
+  int fd = open("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size",
+                O_RDONLY | O_CLOEXEC);
+  if (fd < 0) return;
+  char buffer[32] = {0};
+  ssize_t length = read(fd, buffer, sizeof(buffer) - 1);
+  close(fd);
+  unsigned long long hpage_size = length > 0 ? strtoull(buffer, NULL, 10) : 0;
+  if (hpage_size > (unsigned long long)getpagesize() &&
+      (hpage_size & (hpage_size - 1)) == 0) {
+    iree_memory_large_page_size = (iree_host_size_t)hpage_size;
+  }
+}
+
+// Returns the THP size in bytes or 0 if large pages are unavailable.
+static iree_host_size_t iree_memory_large_page_granularity(void) {
+  iree_call_once(&iree_memory_large_page_size_flag,
+                 iree_memory_query_large_page_size);
+  return iree_memory_large_page_size;
+}
+
 void iree_memory_query_info(iree_memory_info_t* out_info) {
   memset(out_info, 0, sizeof(*out_info));
 
@@ -25,14 +55,9 @@ void iree_memory_query_info(iree_memory_info_t* out_info) {
   out_info->normal_page_size = page_size;
   out_info->normal_page_granularity = page_size;
 
-  // Large pages arent't currently used so we aren't introducing the build goo
-  // to detect and use them yet.
-  // https://linux.die.net/man/3/gethugepagesizes
-  // http://manpages.ubuntu.com/manpages/bionic/man3/gethugepagesize.3.html
-  // Would be:
-  //   #include <hugetlbfs.h>
-  //   out_info->large_page_granularity = gethugepagesize();
-  out_info->large_page_granularity = page_size;
+  iree_host_size_t large_page_size = iree_memory_large_page_granularity();
+  out_info->large_page_granularity =
+      large_page_size ? large_page_size : page_size;
 
   out_info->can_allocate_executable_pages = true;
 }
@@ -63,11 +88,28 @@ iree_status_t iree_memory_view_reserve(iree_memory_view_flags_t flags,
   int mmap_prot = PROT_NONE;
   int mmap_flags = MAP_PRIVATE | MAP_ANON | MAP_NORESERVE;
 
+  // Large page aligned reservations over-reserve by one large page and trim
+  // the unaligned head and tail off of the mapping.
+  iree_host_size_t alignment = 0;
+  if (flags & IREE_MEMORY_VIEW_FLAG_LARGE_PAGES) {
+    alignment = iree_memory_large_page_granularity();
+  }
+
   iree_status_t status = iree_ok_status();
-  void* base_address = mmap(NULL, total_length, mmap_prot, mmap_flags, -1, 0);
+  void* base_address =
+      mmap(NULL, total_length + alignment, mmap_prot, mmap_flags, -1, 0);
   if (base_address == MAP_FAILED) {
     status = iree_make_status(iree_status_code_from_errno(errno),
                               "mmap reservation failed");
+  } else if (alignment > 0) {
+    uint8_t* reserved_base = (uint8_t*)base_address;
+    uint8_t* aligned_base =
+        (uint8_t*)iree_host_align((uintptr_t)reserved_base, alignment);
+    iree_host_size_t head_length = aligned_base - reserved_base;
+    if (head_length > 0) munmap(reserved_base, head_length);
+    iree_host_size_t tail_length = alignment - head_length;
+    if (tail_length > 0) munmap(aligned_base + total_length, tail_length);
+    base_address = aligned_base;
   }
 
   *out_base_address = base_address;
@@ -138,6 +180,29 @@ iree_status_t iree_memory_view_protect_ranges(void* base_address,
   return status;
 }
 
+void iree_memory_view_advise_large_pages(void* base_address,
+                                         iree_host_size_t range_count,
+                                         const iree_byte_range_t* ranges) {
+#if defined(MADV_HUGEPAGE)
+  const iree_host_size_t granularity = iree_memory_large_page_granularity();
+  if (!granularity) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  for (iree_host_size_t i = 0; i < range_count; ++i) {
+    // Shrink the range to the whole large pages it contains.
+    uintptr_t range_start = iree_host_align(
+        (uintptr_t)base_address + ranges[i].offset, granularity);
+    uintptr_t range_end =
+        ((uintptr_t)base_address + ranges[i].offset + ranges[i].length) &
+        ~(uintptr_t)(granularity - 1);
+    if (range_end <= range_start) continue;
+    // NOTE: failures are ignored as this is only a hint; the kernel may not
+    // have THP enabled and the normal pages will be used.
+    madvise((void*)range_start, range_end - range_start, MADV_HUGEPAGE);
+  }
+  IREE_TRACE_ZONE_END(z0);
+#endif  // MADV_HUGEPAGE
+}
+
 // IREE_ELF_CLEAR_CACHE can be defined externally to override this default
 // behavior.
 #if !defined(IREE_ELF_CLEAR_CACHE)
@@ -18,9 +18,13 @@ void iree_hal_processor_query(iree_allocator_t temp_allocator,
   IREE_TRACE_ZONE_BEGIN(z0);
   memset(out_processor, 0, sizeof(*out_processor));
 
-  // TODO(benvanik): define processor features we want to query for each arch.
-  // This needs to be baked into the executable library API and made consistent
-  // with the compiler side producing the executables that access it.
+  // The field encoding is defined by iree/base/internal/cpu.h and must be kept
+  // consistent with the compiler side producing executables that check it.
+  // Field 0 holds the ISA feature bits and fields 1 and 2 describe the cache
+  // sizes and processor topology so executables can tune themselves to the
+  // host. The fields are queried once per process.
+  iree_cpu_query_data_fields(IREE_ARRAYSIZE(out_processor->data),
+                             out_processor->data);
 
   IREE_TRACE_ZONE_END(z0);
 }
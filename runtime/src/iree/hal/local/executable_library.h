@@ -40,6 +40,10 @@
 // Defines a bitfield of features that the library requires or supports.
 enum iree_hal_executable_library_feature_bits_t {
   IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_NONE = 0u,
+  // Library provides the iree_hal_executable_library_v0_t::ranges table of
+  // batched workgroup range entry points. Libraries without the feature end at
+  // the constants table and the ranges table must not be accessed.
+  IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_DISPATCH_RANGES = 1u << 0,
   // TODO(benvanik): declare features for debugging/coverage/printf/etc.
   // These will control which symbols are injected into the library at runtime.
 };
@@ -228,7 +232,8 @@ typedef struct iree_hal_processor_v0_t {
   // The contents are opaque here as to support out-of-tree architectures. The
   // runtime code deriving the identifier/flags and providing it here is losely
   // coupled with the compiler code emitting checks based on the identifier and
-  // only those two places ever need to change.
+  // only those two places ever need to change. In-tree architectures use the
+  // encoding defined by iree/base/internal/cpu.h.
   uint64_t data[IREE_HAL_PROCESSOR_DATA_CAPACITY_V0];
 } iree_hal_processor_v0_t;
 static_assert(sizeof(iree_hal_processor_v0_t) % sizeof(uint64_t) == 0,
@@ -365,6 +370,57 @@ typedef int (*iree_hal_executable_dispatch_v0_t)(
     const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
     const iree_hal_executable_workgroup_state_v0_t* workgroup_state);
 
+// Read-only state describing a contiguous range of workgroups within a
+// dispatch that are to be executed by a single call.
+//
+// The leading fields match iree_hal_executable_workgroup_state_v0_t so that
+// implementations can execute the first workgroup directly with the range
+// state and only update the workgroup IDs for the workgroups that follow.
+typedef struct iree_hal_executable_workgroup_range_v0_t {
+  // Workgroup ID of the first workgroup in the range. Subsequent workgroups
+  // increment X and wrap into Y and then Z based on the workgroup count
+  // specified in the dispatch state.
+  uint32_t workgroup_id_x;
+  uint32_t workgroup_id_y;
+  uint16_t workgroup_id_z;
+
+  // Reserved for future use.
+  uint16_t reserved;
+
+  // Logical processor identifier executing the entire range.
+  uint32_t processor_id;
+
+  // Scratch memory available for use by each workgroup in the range. The
+  // contents are undefined at the start of each workgroup.
+  void* local_memory;
+  // Total number of bytes available in |local_memory|.
+  uint32_t local_memory_size;
+
+  // Total number of workgroups in the range. Always at least 1 and the range
+  // never extends past the end of the dispatch.
+  uint32_t workgroup_count;
+} iree_hal_executable_workgroup_range_v0_t;
+static_assert(
+    offsetof(iree_hal_executable_workgroup_range_v0_t, local_memory_size) ==
+        offsetof(iree_hal_executable_workgroup_state_v0_t, local_memory_size),
+    "workgroup range must share the workgroup state layout");
+static_assert(
+    sizeof(iree_hal_executable_workgroup_range_v0_t) <= 64,
+    "try keeping workgroup range small enough to fit in a cache line");
+
+// Function signature of batched executable entry points that execute a
+// contiguous range of workgroups in a single call. Behaves as if the matching
+// iree_hal_executable_dispatch_v0_t was called once for each workgroup in the
+// |workgroup_range| in order and stops at the first failure.
+//
+// Executing many workgroups per call amortizes the per-workgroup call overhead
+// of the runtime (tracing, state setup, indirect calls through ABI thunks) and
+// allows implementations to hoist work common to all workgroups in the range.
+typedef int (*iree_hal_executable_dispatch_range_v0_t)(
+    const iree_hal_executable_environment_v0_t* environment,
+    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+    const iree_hal_executable_workgroup_range_v0_t* workgroup_range);
+
 // Bytes per page of workgroup local memory.
 // This is chosen to match the common page size of devices.
 #define IREE_HAL_WORKGROUP_LOCAL_MEMORY_PAGE_SIZE 4096
@@ -418,6 +474,14 @@ typedef struct iree_hal_executable_constant_table_v0_t {
   // We could add more metadata here if we wanted to enable reflection.
 } iree_hal_executable_constant_table_v0_t;
 
+// A table of optional batched entry points 1:1 with the export table.
+// Exports without a batched entry point are executed one workgroup at a time.
+typedef struct iree_hal_executable_range_table_v0_t {
+  // Optional table of function pointers 1:1 with the export table ptrs.
+  // Either the table or any individual entry may be NULL.
+  const iree_hal_executable_dispatch_range_v0_t* ptrs;
+} iree_hal_executable_range_table_v0_t;
+
 // Structure used for v0 library interfaces.
 // The entire structure is designed to be read-only and able to live embedded in
 // the binary .rdata section.
@@ -441,6 +505,11 @@ typedef struct iree_hal_executable_library_v0_t {
 
   // Table of executable-level constants.
   iree_hal_executable_constant_table_v0_t constants;
+
+  // Table of batched workgroup range entry points.
+  // Only present when the library header declares
+  // IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_DISPATCH_RANGES.
+  iree_hal_executable_range_table_v0_t ranges;
 } iree_hal_executable_library_v0_t;
 
 #endif  // IREE_HAL_LOCAL_EXECUTABLE_LIBRARY_H_
@@ -20,8 +20,17 @@
 #include "iree/hal/local/local_descriptor_set_layout.h"
 #include "iree/hal/local/local_executable.h"
 #include "iree/hal/local/local_executable_layout.h"
+#include "iree/task/executor.h"
+#include "iree/task/topology.h"
 #include "iree/testing/benchmark.h"
 
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif  // IREE_PLATFORM_ANDROID || IREE_PLATFORM_LINUX
+
 IREE_FLAG(string, executable_format, "",
           "Format of the executable file being loaded.");
 IREE_FLAG(string, executable_file, "",
@@ -131,6 +140,775 @@ IREE_FLAG_CALLBACK(
     "  # 2 4-byte floating-point values with contents [[1.4], [2.1]]:\n"
     "  --binding=2x1xf32=1.4,2.1");
 
+IREE_FLAG(string, module_file, "",
+          "Path to a compiled module (.vmfb) containing the executables\n"
+          "referenced by --dispatch= flags. When set all --dispatch= entries\n"
+          "are benchmarked instead of the single --executable_file= entry\n"
+          "point.");
+
+IREE_FLAG(string, worker_counts, "",
+          "Comma-separated list of task system worker counts each\n"
+          "--dispatch= is benchmarked with (ex: `1,2,4,8`). When empty\n"
+          "dispatches run inline on the calling thread.");
+
+// A dispatch parsed from a --dispatch= flag as produced by the compiler
+// --iree-hal-dump-executable-benchmarks-to= flagfile.
+typedef struct iree_dispatch_benchmark_spec_t {
+  // Archive file name prefix of the executable (`[executable name]_`).
+  iree_string_view_t executable_name;
+  // Export ordinal within the executable.
+  uint32_t ordinal;
+  // Informational export name used in the benchmark name.
+  iree_string_view_t export_name;
+  uint32_t workgroup_count[3];
+  uint32_t push_constant_count;
+  iree_host_size_t binding_count;
+  iree_host_size_t binding_lengths[IREE_HAL_LOCAL_MAX_TOTAL_BINDING_COUNT];
+} iree_dispatch_benchmark_spec_t;
+
+struct {
+  iree_host_size_t count;
+  iree_host_size_t capacity;
+  iree_dispatch_benchmark_spec_t* specs;
+} dispatch_specs = {
+    .count = 0,
+    .capacity = 0,
+    .specs = NULL,
+};
+
+// Parses `executable:ordinal:export:XxYxZ:push_constant_count:b0,b1,...`.
+static iree_status_t parse_dispatch(iree_string_view_t flag_name,
+                                    void* storage, iree_string_view_t value) {
+  if (dispatch_specs.count == dispatch_specs.capacity) {
+    iree_host_size_t new_capacity = iree_max(16, dispatch_specs.capacity * 2);
+    IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+        iree_allocator_system(), new_capacity * sizeof(dispatch_specs.specs[0]),
+        (void**)&dispatch_specs.specs));
+    dispatch_specs.capacity = new_capacity;
+  }
+  iree_dispatch_benchmark_spec_t* spec =
+      &dispatch_specs.specs[dispatch_specs.count];
+  memset(spec, 0, sizeof(*spec));
+
+  iree_string_view_t fields[6];
+  iree_string_view_t remaining = value;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(fields); ++i) {
+    if (i + 1 == IREE_ARRAYSIZE(fields)) {
+      fields[i] = remaining;
+    } else if (iree_string_view_split(remaining, ':', &fields[i],
+                                      &remaining) == -1) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "malformed dispatch '%.*s'; expected "
+                              "`executable:ordinal:export:XxYxZ:"
+                              "push_constant_count:b0,b1,...`",
+                              (int)value.size, value.data);
+    }
+  }
+  spec->executable_name = fields[0];
+  spec->export_name = fields[2];
+  iree_string_view_t count_y_z = iree_string_view_empty();
+  iree_string_view_t count_x = iree_string_view_empty();
+  iree_string_view_t count_y = iree_string_view_empty();
+  iree_string_view_t count_z = iree_string_view_empty();
+  iree_string_view_split(fields[3], 'x', &count_x, &count_y_z);
+  iree_string_view_split(count_y_z, 'x', &count_y, &count_z);
+  if (iree_string_view_is_empty(spec->executable_name) ||
+      !iree_string_view_atoi_uint32(fields[1], &spec->ordinal) ||
+      !iree_string_view_atoi_uint32(count_x, &spec->workgroup_count[0]) ||
+      !iree_string_view_atoi_uint32(count_y, &spec->workgroup_count[1]) ||
+      !iree_string_view_atoi_uint32(count_z, &spec->workgroup_count[2]) ||
+      !iree_string_view_atoi_uint32(fields[4], &spec->push_constant_count) ||
+      spec->push_constant_count > IREE_HAL_LOCAL_MAX_PUSH_CONSTANT_COUNT) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "invalid dispatch '%.*s'", (int)value.size,
+                            value.data);
+  }
+  remaining = fields[5];
+  while (!iree_string_view_is_empty(remaining)) {
+    if (spec->binding_count + 1 > IREE_ARRAYSIZE(spec->binding_lengths)) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "too many bindings in dispatch '%.*s'",
+                              (int)value.size, value.data);
+    }
+    iree_string_view_t binding_length = iree_string_view_empty();
+    iree_string_view_split(remaining, ',', &binding_length, &remaining);
+    uint64_t length = 0;
+    if (!iree_string_view_atoi_uint64(binding_length, &length)) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "invalid binding length '%.*s'",
+                              (int)binding_length.size, binding_length.data);
+    }
+    spec->binding_lengths[spec->binding_count++] = (iree_host_size_t)length;
+  }
+  ++dispatch_specs.count;
+  return iree_ok_status();
+}
+static void print_dispatch(iree_string_view_t flag_name, void* storage,
+                           FILE* file) {
+  if (dispatch_specs.count == 0) {
+    fprintf(file,
+            "# --%.*s=executable:ordinal:export:XxYxZ:push_constant_count:"
+            "b0,b1,...\n",
+            (int)flag_name.size, flag_name.data);
+    return;
+  }
+  for (iree_host_size_t i = 0; i < dispatch_specs.count; ++i) {
+    const iree_dispatch_benchmark_spec_t* spec = &dispatch_specs.specs[i];
+    fprintf(file, "--%.*s=%.*s:%u:%.*s:%ux%ux%u:%u:", (int)flag_name.size,
+            flag_name.data, (int)spec->executable_name.size,
+            spec->executable_name.data, spec->ordinal,
+            (int)spec->export_name.size, spec->export_name.data,
+            spec->workgroup_count[0], spec->workgroup_count[1],
+            spec->workgroup_count[2], spec->push_constant_count);
+    for (iree_host_size_t j = 0; j < spec->binding_count; ++j) {
+      fprintf(file, j > 0 ? ",%" PRIhsz : "%" PRIhsz,
+              spec->binding_lengths[j]);
+    }
+    fprintf(file, "\n");
+  }
+}
+IREE_FLAG_CALLBACK(
+    parse_dispatch, print_dispatch, &dispatch_specs, dispatch,
+    "Appends a dispatch of an executable in --module_file= to benchmark.\n"
+    "Generated by the compiler with\n"
+    "--iree-hal-dump-executable-benchmarks-to=path/ in the\n"
+    "`[module]_dispatches.flagfile` file. Bindings are zero-initialized\n"
+    "ranges of the given byte lengths and push constants are zero.\n"
+    "Example:\n"
+    "  --dispatch=main_dispatch_0:0:main_dispatch_0:4x8x1:0:1024,1024");
+
+//===----------------------------------------------------------------------===//
+// iTLB miss counter
+//===----------------------------------------------------------------------===//
+
+// Large executables mapped with normal pages can be dominated by instruction
+// TLB misses. When the platform exposes hardware counters the misses incurred
+// while dispatching are reported in the benchmark label so that the effect of
+// mapping the executable code with large pages can be compared (see
+// IREE_HAL_EMBEDDED_ELF_LOADER_MODULE_FLAGS).
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX)
+
+// Opens a counter of user-mode iTLB read misses on the calling thread.
+// Returns -1 if the counter is unavailable (no PMU access, etc).
+static int iree_itlb_miss_counter_open(void) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = PERF_TYPE_HW_CACHE;
+  attr.config = PERF_COUNT_HW_CACHE_ITLB |
+                (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return (int)syscall(__NR_perf_event_open, &attr, /*pid=*/0, /*cpu=*/-1,
+                      /*group_fd=*/-1, /*flags=*/0);
+}
+
+static void iree_itlb_miss_counter_start(int fd) {
+  if (fd < 0) return;
+  ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+  ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+}
+
+// Stops the counter and returns the total misses since it was started.
+static uint64_t iree_itlb_miss_counter_stop(int fd) {
+  if (fd < 0) return 0;
+  ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+  uint64_t value = 0;
+  if (read(fd, &value, sizeof(value)) != sizeof(value)) value = 0;
+  return value;
+}
+
+static void iree_itlb_miss_counter_close(int fd) {
+  if (fd >= 0) close(fd);
+}
+
+#else
+
+static int iree_itlb_miss_counter_open(void) { return -1; }
+static void iree_itlb_miss_counter_start(int fd) {}
+static uint64_t iree_itlb_miss_counter_stop(int fd) { return 0; }
+static void iree_itlb_miss_counter_close(int fd) {}
+
+#endif  // IREE_PLATFORM_ANDROID || IREE_PLATFORM_LINUX
+
+//===----------------------------------------------------------------------===//
+// Module archive executables
+//===----------------------------------------------------------------------===//
+
+// Modules are emitted by the compiler as ZIP-compatible archives (see
+// --iree-vm-emit-polyglot-zip) with each executable binary stored
+// uncompressed as a file named `[executable]_[binary].[ext]`. We only need
+// enough of the ZIP format to walk the central directory and find the file
+// contents and don't verify anything beyond what's needed to stay in bounds.
+
+#define IREE_ZIP_LOCAL_FILE_HEADER_SIGNATURE 0x04034B50u
+#define IREE_ZIP_CENTRAL_DIRECTORY_SIGNATURE 0x02014B50u
+#define IREE_ZIP_EOCD_SIGNATURE 0x06054B50u
+#define IREE_ZIP_EOCD64_SIGNATURE 0x06064B50u
+#define IREE_ZIP_EOCD64_LOCATOR_SIGNATURE 0x07064B50u
+#define IREE_ZIP_EOCD_SIZE 22
+#define IREE_ZIP_EOCD64_LOCATOR_SIZE 20
+#define IREE_ZIP_EOCD64_SIZE 56
+#define IREE_ZIP_CENTRAL_DIRECTORY_SIZE 46
+#define IREE_ZIP_LOCAL_FILE_HEADER_SIZE 30
+
+static uint16_t iree_zip_read_u16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+static uint32_t iree_zip_read_u32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) |
+         ((uint32_t)p[3] << 24);
+}
+static uint64_t iree_zip_read_u64(const uint8_t* p) {
+  return (uint64_t)iree_zip_read_u32(p) |
+         ((uint64_t)iree_zip_read_u32(p + 4) << 32);
+}
+
+typedef struct iree_module_archive_file_t {
+  iree_string_view_t name;
+  iree_const_byte_span_t contents;
+} iree_module_archive_file_t;
+
+// Resolves the contents of the file described by the central directory record
+// at |record| (of |record_length| bytes including variable-length fields).
+static iree_status_t iree_module_archive_resolve_file(
+    iree_const_byte_span_t archive, const uint8_t* record,
+    iree_host_size_t record_length, iree_module_archive_file_t* out_file) {
+  const uint16_t compression_method = iree_zip_read_u16(record + 10);
+  uint64_t compressed_size = iree_zip_read_u32(record + 20);
+  uint64_t uncompressed_size = iree_zip_read_u32(record + 24);
+  const uint16_t name_length = iree_zip_read_u16(record + 28);
+  const uint16_t extra_length = iree_zip_read_u16(record + 30);
+  uint64_t header_offset = iree_zip_read_u32(record + 42);
+  out_file->name = iree_make_string_view(
+      (const char*)record + IREE_ZIP_CENTRAL_DIRECTORY_SIZE, name_length);
+
+  // Values of UINT32_MAX are stored in the zip64 extra field in a fixed order.
+  const uint8_t* extra = record + IREE_ZIP_CENTRAL_DIRECTORY_SIZE + name_length;
+  const uint8_t* extra_end = extra + extra_length;
+  while (extra + 4 <= extra_end) {
+    const uint16_t id = iree_zip_read_u16(extra);
+    const uint16_t size = iree_zip_read_u16(extra + 2);
+    const uint8_t* field = extra + 4;
+    const uint8_t* field_end = field + size;
+    if (field_end > extra_end) break;
+    if (id == 0x0001u) {
+      uint64_t* values[3] = {&uncompressed_size, &compressed_size,
+                             &header_offset};
+      for (int i = 0; i < 3; ++i) {
+        if (*values[i] != UINT32_MAX) continue;
+        if (field + 8 > field_end) break;
+        *values[i] = iree_zip_read_u64(field);
+        field += 8;
+      }
+    }
+    extra = field_end;
+  }
+
+  if (compression_method != 0 || compressed_size != uncompressed_size) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "archive file '%.*s' is compressed",
+                            (int)out_file->name.size, out_file->name.data);
+  }
+  if (header_offset + IREE_ZIP_LOCAL_FILE_HEADER_SIZE > archive.data_length ||
+      iree_zip_read_u32(archive.data + header_offset) !=
+          IREE_ZIP_LOCAL_FILE_HEADER_SIGNATURE) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "archive file '%.*s' header is invalid",
+                            (int)out_file->name.size, out_file->name.data);
+  }
+  const uint8_t* header = archive.data + header_offset;
+  const uint64_t data_offset = header_offset +
+                               IREE_ZIP_LOCAL_FILE_HEADER_SIZE +
+                               iree_zip_read_u16(header + 26) +
+                               iree_zip_read_u16(header + 28);
+  if (data_offset > archive.data_length ||
+      compressed_size > archive.data_length - data_offset) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "archive file '%.*s' contents out of range",
+                            (int)out_file->name.size, out_file->name.data);
+  }
+  out_file->contents = iree_make_const_byte_span(
+      archive.data + data_offset, (iree_host_size_t)compressed_size);
+  return iree_ok_status();
+}
+
+// Calls |callback| for each file in the module |archive|.
+static iree_status_t iree_module_archive_enumerate_files(
+    iree_const_byte_span_t archive,
+    iree_status_t (*callback)(void* user_data,
+                              const iree_module_archive_file_t* file),
+    void* user_data) {
+  // The end of central directory record is at the end of the file followed by
+  // an optional comment of up to 64KB.
+  const uint8_t* eocd = NULL;
+  if (archive.data_length >= IREE_ZIP_EOCD_SIZE) {
+    iree_host_size_t search_begin =
+        archive.data_length > IREE_ZIP_EOCD_SIZE + UINT16_MAX
+            ? archive.data_length - IREE_ZIP_EOCD_SIZE - UINT16_MAX
+            : 0;
+    for (iree_host_size_t i = archive.data_length - IREE_ZIP_EOCD_SIZE + 1;
+         i-- > search_begin;) {
+      if (iree_zip_read_u32(archive.data + i) == IREE_ZIP_EOCD_SIGNATURE) {
+        eocd = archive.data + i;
+        break;
+      }
+    }
+  }
+  if (!eocd) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "module is not a ZIP-compatible archive; compile "
+                            "with --iree-vm-emit-polyglot-zip=true");
+  }
+  uint64_t entry_count = iree_zip_read_u16(eocd + 10);
+  uint64_t directory_offset = iree_zip_read_u32(eocd + 16);
+  const iree_host_size_t eocd_offset = (iree_host_size_t)(eocd - archive.data);
+  if (eocd_offset >= IREE_ZIP_EOCD64_LOCATOR_SIZE) {
+    const uint8_t* locator = eocd - IREE_ZIP_EOCD64_LOCATOR_SIZE;
+    if (iree_zip_read_u32(locator) == IREE_ZIP_EOCD64_LOCATOR_SIGNATURE) {
+      const uint64_t eocd64_offset = iree_zip_read_u64(locator + 8);
+      if (eocd64_offset + IREE_ZIP_EOCD64_SIZE > archive.data_length ||
+          iree_zip_read_u32(archive.data + eocd64_offset) !=
+              IREE_ZIP_EOCD64_SIGNATURE) {
+        return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                                "invalid zip64 end of central directory");
+      }
+      const uint8_t* eocd64 = archive.data + eocd64_offset;
+      entry_count = iree_zip_read_u64(eocd64 + 32);
+      directory_offset = iree_zip_read_u64(eocd64 + 48);
+    }
+  }
+
+  uint64_t offset = directory_offset;
+  for (uint64_t i = 0; i < entry_count; ++i) {
+    if (offset + IREE_ZIP_CENTRAL_DIRECTORY_SIZE > archive.data_length ||
+        iree_zip_read_u32(archive.data + offset) !=
+            IREE_ZIP_CENTRAL_DIRECTORY_SIGNATURE) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "invalid central directory record %" PRIu64, i);
+    }
+    const uint8_t* record = archive.data + offset;
+    const uint64_t record_length = IREE_ZIP_CENTRAL_DIRECTORY_SIZE +
+                                   iree_zip_read_u16(record + 28) +
+                                   iree_zip_read_u16(record + 30) +
+                                   iree_zip_read_u16(record + 32);
+    if (offset + record_length > archive.data_length) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "central directory record %" PRIu64
+                              " out of range",
+                              i);
+    }
+    iree_module_archive_file_t file;
+    IREE_RETURN_IF_ERROR(iree_module_archive_resolve_file(
+        archive, record, (iree_host_size_t)record_length, &file));
+    IREE_RETURN_IF_ERROR(callback(user_data, &file));
+    offset += record_length;
+  }
+  return iree_ok_status();
+}
+
+//===----------------------------------------------------------------------===//
+// Module dispatch benchmarks
+//===----------------------------------------------------------------------===//
+
+// Total number of executables we allow a single module to contain.
+#define IREE_MODULE_MAX_EXECUTABLE_COUNT 1024
+
+typedef struct iree_module_executable_t {
+  // Archive file name the executable was loaded from.
+  iree_string_view_t file_name;
+  iree_hal_local_executable_t* executable;
+} iree_module_executable_t;
+
+// Module state shared by all module dispatch benchmarks.
+struct {
+  iree_file_contents_t* file_contents;
+  iree_hal_executable_loader_t* executable_loader;
+  iree_host_size_t executable_count;
+  iree_module_executable_t executables[IREE_MODULE_MAX_EXECUTABLE_COUNT];
+} module_state = {
+    .file_contents = NULL,
+    .executable_loader = NULL,
+    .executable_count = 0,
+};
+
+// A single registered benchmark of a dispatch with a particular worker count.
+typedef struct iree_dispatch_benchmark_t {
+  const iree_dispatch_benchmark_spec_t* spec;
+  iree_hal_local_executable_t* executable;
+  iree_host_size_t ordinal;
+  // Number of task system workers or 0 to run inline on the calling thread.
+  iree_host_size_t worker_count;
+  // Dispatch state shared by all workgroups; populated during the benchmark.
+  iree_hal_executable_dispatch_state_v0_t dispatch_state;
+} iree_dispatch_benchmark_t;
+
+static iree_status_t iree_module_load_executable(
+    void* user_data, const iree_module_archive_file_t* file) {
+  if (!iree_string_view_ends_with(file->name, IREE_SV(".so"))) {
+    return iree_ok_status();
+  }
+  if (module_state.executable_count + 1 >
+      IREE_ARRAYSIZE(module_state.executables)) {
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "too many executables in module");
+  }
+
+  iree_hal_executable_params_t executable_params;
+  iree_hal_executable_params_initialize(&executable_params);
+  executable_params.caching_mode =
+      IREE_HAL_EXECUTABLE_CACHING_MODE_ALLOW_OPTIMIZATION |
+      IREE_HAL_EXECUTABLE_CACHING_MODE_ALIAS_PROVIDED_DATA |
+      IREE_HAL_EXECUTABLE_CACHING_MODE_DISABLE_VERIFICATION;
+  executable_params.executable_format =
+      iree_make_cstring_view(FLAG_executable_format);
+  executable_params.executable_data = file->contents;
+  iree_hal_executable_t* executable = NULL;
+  iree_status_t status = iree_hal_executable_loader_try_load(
+      module_state.executable_loader, &executable_params, &executable);
+  if (!iree_status_is_ok(status)) {
+    // Variants for other architectures/formats are expected to fail to load.
+    fprintf(stderr, "skipping archive file '%.*s': ", (int)file->name.size,
+            file->name.data);
+    iree_status_fprint(stderr, status);
+    iree_status_ignore(status);
+    return iree_ok_status();
+  }
+  iree_module_executable_t* module_executable =
+      &module_state.executables[module_state.executable_count++];
+  module_executable->file_name = file->name;
+  module_executable->executable = iree_hal_local_executable_cast(executable);
+  return iree_ok_status();
+}
+
+// Resolves the executable and entry point ordinal for |spec|.
+// Executables are usually linked together by the compiler after the dispatch
+// flagfile is produced and entry points are found by export name when the
+// executables include reflection information. Otherwise the executable is
+// matched by the archive file name `[executable name]_*` and the ordinal in
+// the spec is used as-is.
+static bool iree_module_lookup_export(
+    const iree_dispatch_benchmark_spec_t* spec,
+    iree_hal_local_executable_t** out_executable,
+    iree_host_size_t* out_ordinal) {
+  for (iree_host_size_t i = 0; i < module_state.executable_count; ++i) {
+    iree_hal_local_executable_t* executable =
+        module_state.executables[i].executable;
+    if (!executable->export_names) continue;
+    for (iree_host_size_t j = 0; j < executable->export_count; ++j) {
+      if (iree_string_view_equal(
+              spec->export_name,
+              iree_make_cstring_view(executable->export_names[j]))) {
+        *out_executable = executable;
+        *out_ordinal = j;
+        return true;
+      }
+    }
+  }
+  for (iree_host_size_t i = 0; i < module_state.executable_count; ++i) {
+    iree_string_view_t file_name = module_state.executables[i].file_name;
+    // Rodata names may be uniqued with a leading underscore.
+    if (!iree_string_view_starts_with(file_name, spec->executable_name)) {
+      if (!iree_string_view_consume_prefix(&file_name, IREE_SV("_")) ||
+          !iree_string_view_starts_with(file_name, spec->executable_name)) {
+        continue;
+      }
+    }
+    file_name =
+        iree_string_view_remove_prefix(file_name, spec->executable_name.size);
+    if (iree_string_view_starts_with(file_name, IREE_SV("_"))) {
+      *out_executable = module_state.executables[i].executable;
+      *out_ordinal = spec->ordinal;
+      return true;
+    }
+  }
+  return false;
+}
+
+static iree_status_t iree_dispatch_benchmark_tile_range(
+    void* user_context, const iree_task_tile_context_t* tile_context,
+    uint32_t tile_count, iree_task_submission_t* pending_submission) {
+  const iree_dispatch_benchmark_t* benchmark =
+      (const iree_dispatch_benchmark_t*)user_context;
+  const iree_hal_executable_workgroup_range_v0_t workgroup_range = {
+      .workgroup_id_x = tile_context->workgroup_xyz[0],
+      .workgroup_id_y = tile_context->workgroup_xyz[1],
+      .workgroup_id_z = tile_context->workgroup_xyz[2],
+      .reserved = 0,
+      .processor_id = tile_context->processor_id,
+      .local_memory = tile_context->local_memory.data,
+      .local_memory_size = (size_t)tile_context->local_memory.data_length,
+      .workgroup_count = tile_count,
+  };
+  return iree_hal_local_executable_issue_range(
+      benchmark->executable, benchmark->ordinal, &benchmark->dispatch_state,
+      &workgroup_range);
+}
+
+static iree_status_t iree_dispatch_benchmark_tile(
+    void* user_context, const iree_task_tile_context_t* tile_context,
+    iree_task_submission_t* pending_submission) {
+  return iree_dispatch_benchmark_tile_range(user_context, tile_context,
+                                            /*tile_count=*/1,
+                                            pending_submission);
+}
+
+// Runs the dispatch through a task executor with the requested worker count
+// the same way the local-task HAL device would.
+static iree_status_t iree_dispatch_benchmark_run_tasks(
+    iree_dispatch_benchmark_t* benchmark, iree_host_size_t local_memory_size,
+    iree_benchmark_state_t* benchmark_state, int64_t* out_dispatch_count) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_group_count(benchmark->worker_count,
+                                                 &topology);
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  options.worker_local_memory_size = local_memory_size;
+  iree_task_executor_t* executor = NULL;
+  iree_status_t status = iree_task_executor_create(
+      options, &topology, benchmark_state->host_allocator, &executor);
+  iree_task_topology_deinitialize(&topology);
+  IREE_RETURN_IF_ERROR(status);
+
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("benchmark"), &scope);
+  const uint32_t workgroup_size[3] = {1, 1, 1};
+  const iree_task_dispatch_closure_t closure =
+      iree_task_make_dispatch_range_closure(iree_dispatch_benchmark_tile,
+                                            iree_dispatch_benchmark_tile_range,
+                                            benchmark);
+  int64_t dispatch_count = 0;
+  while (iree_status_is_ok(status) &&
+         iree_benchmark_keep_running(benchmark_state, /*batch_count=*/1)) {
+    iree_task_dispatch_t dispatch_task;
+    iree_task_dispatch_initialize(&scope, closure, workgroup_size,
+                                  benchmark->spec->workgroup_count,
+                                  &dispatch_task);
+    dispatch_task.local_memory_size = (uint32_t)local_memory_size;
+    dispatch_task.cost_key = (uint64_t)(uintptr_t)benchmark->executable ^
+                             ((uint64_t)benchmark->ordinal << 48);
+    iree_task_fence_t* fence = NULL;
+    status = iree_task_executor_acquire_fence(executor, &scope, &fence);
+    if (!iree_status_is_ok(status)) break;
+    iree_task_set_completion_task(&dispatch_task.header, &fence->header);
+    iree_task_submission_t submission;
+    iree_task_submission_initialize(&submission);
+    iree_task_submission_enqueue(&submission, &dispatch_task.header);
+    iree_task_executor_submit(executor, &submission);
+    iree_task_executor_flush(executor);
+    status = iree_task_scope_wait_idle(&scope, IREE_TIME_INFINITE_FUTURE);
+    ++dispatch_count;
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_task_scope_consume_status(&scope);
+  }
+
+  iree_task_scope_deinitialize(&scope);
+  iree_task_executor_release(executor);
+  *out_dispatch_count = dispatch_count;
+  return status;
+}
+
+// Benchmarks one --dispatch= entry in the module with a fixed worker count.
+// Binding storage is packed into a single zeroed allocation with the same
+// alignment the compiler uses for its generated dispatch benchmarks.
+static iree_status_t iree_dispatch_benchmark_run(
+    const iree_benchmark_def_t* benchmark_def,
+    iree_benchmark_state_t* benchmark_state) {
+  iree_dispatch_benchmark_t* benchmark =
+      (iree_dispatch_benchmark_t*)benchmark_def->user_data;
+  const iree_dispatch_benchmark_spec_t* spec = benchmark->spec;
+  iree_allocator_t host_allocator = benchmark_state->host_allocator;
+  const iree_host_size_t binding_alignment = 256;
+
+  iree_host_size_t total_binding_length = 0;
+  for (iree_host_size_t i = 0; i < spec->binding_count; ++i) {
+    total_binding_length = iree_host_align(
+        total_binding_length + spec->binding_lengths[i], binding_alignment);
+  }
+  uint8_t* binding_storage = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      host_allocator, total_binding_length + binding_alignment,
+      (void**)&binding_storage));
+  uint8_t* binding_base =
+      (uint8_t*)iree_host_align((uintptr_t)binding_storage, binding_alignment);
+  void* binding_ptrs[IREE_HAL_LOCAL_MAX_TOTAL_BINDING_COUNT];
+  size_t binding_lengths[IREE_HAL_LOCAL_MAX_TOTAL_BINDING_COUNT];
+  iree_host_size_t binding_offset = 0;
+  for (iree_host_size_t i = 0; i < spec->binding_count; ++i) {
+    binding_ptrs[i] = binding_base + binding_offset;
+    binding_lengths[i] = spec->binding_lengths[i];
+    binding_offset = iree_host_align(binding_offset + spec->binding_lengths[i],
+                                     binding_alignment);
+  }
+
+  const uint32_t push_constants[IREE_HAL_LOCAL_MAX_PUSH_CONSTANT_COUNT] = {0};
+  const iree_hal_executable_dispatch_state_v0_t dispatch_state = {
+      .workgroup_count_x = spec->workgroup_count[0],
+      .workgroup_count_y = spec->workgroup_count[1],
+      .workgroup_count_z = spec->workgroup_count[2],
+      .workgroup_size_x = 1,
+      .workgroup_size_y = 1,
+      .workgroup_size_z = 1,
+      .max_concurrency =
+          (uint32_t)iree_max((iree_host_size_t)1, benchmark->worker_count),
+      .push_constant_count = spec->push_constant_count,
+      .push_constants = push_constants,
+      .binding_count = (uint32_t)spec->binding_count,
+      .binding_ptrs = binding_ptrs,
+      .binding_lengths = binding_lengths,
+  };
+  benchmark->dispatch_state = dispatch_state;
+
+  const iree_hal_local_executable_t* executable = benchmark->executable;
+  const iree_host_size_t local_memory_size =
+      executable->dispatch_attrs
+          ? executable->dispatch_attrs[benchmark->ordinal].local_memory_pages *
+                IREE_HAL_WORKGROUP_LOCAL_MEMORY_PAGE_SIZE
+          : 0;
+
+  iree_status_t status = iree_ok_status();
+  int64_t dispatch_count = 0;
+  if (benchmark->worker_count == 0) {
+    iree_byte_span_t local_memory = iree_make_byte_span(NULL, 0);
+    if (local_memory_size > 0) {
+      status = iree_allocator_malloc(host_allocator, local_memory_size,
+                                     (void**)&local_memory.data);
+      local_memory.data_length = local_memory_size;
+    }
+    while (iree_status_is_ok(status) &&
+           iree_benchmark_keep_running(benchmark_state, /*batch_count=*/1)) {
+      status = iree_hal_local_executable_issue_dispatch_inline(
+          benchmark->executable, benchmark->ordinal, &benchmark->dispatch_state,
+          0, local_memory);
+      ++dispatch_count;
+    }
+    iree_allocator_free(host_allocator, local_memory.data);
+  } else {
+    status = iree_dispatch_benchmark_run_tasks(
+        benchmark, local_memory_size, benchmark_state, &dispatch_count);
+  }
+  iree_allocator_free(host_allocator, binding_storage);
+  IREE_RETURN_IF_ERROR(status);
+
+  // Items are workgroups so that both the per-dispatch latency (time) and the
+  // workgroup throughput (items/s) are reported.
+  iree_benchmark_set_items_processed(
+      benchmark_state, dispatch_count * spec->workgroup_count[0] *
+                           spec->workgroup_count[1] * spec->workgroup_count[2]);
+  iree_benchmark_set_bytes_processed(
+      benchmark_state, dispatch_count * (int64_t)total_binding_length);
+  return iree_ok_status();
+}
+
+// Loads the --module_file= executables and registers one benchmark for each
+// --dispatch= and --worker_counts= combination. Benchmarks are named
+// `[export]_[XxYxZ]/workers:[N]` (or `/inline`).
+static iree_status_t iree_module_register_dispatch_benchmarks(
+    iree_allocator_t host_allocator, iree_benchmark_def_t* benchmark_def_base) {
+  if (strlen(FLAG_executable_format) == 0) {
+    FLAG_executable_format = "embedded-elf-" IREE_ARCH;
+  }
+  IREE_RETURN_IF_ERROR(iree_hal_create_executable_loader_by_name(
+      iree_make_cstring_view(FLAG_executable_format), host_allocator,
+      &module_state.executable_loader));
+  if (!iree_hal_executable_loader_query_support(
+          module_state.executable_loader, /*caching_mode=*/0,
+          iree_make_cstring_view(FLAG_executable_format))) {
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "executable format '%s' is not supported",
+                            FLAG_executable_format);
+  }
+  IREE_RETURN_IF_ERROR(iree_file_map_contents(
+      FLAG_module_file, host_allocator, &module_state.file_contents));
+  IREE_RETURN_IF_ERROR(iree_module_archive_enumerate_files(
+      module_state.file_contents->const_buffer, iree_module_load_executable,
+      NULL));
+
+  // Parse the worker counts; an empty list runs everything inline.
+  iree_host_size_t worker_counts[64];
+  iree_host_size_t worker_count_count = 0;
+  iree_string_view_t worker_counts_str =
+      iree_make_cstring_view(FLAG_worker_counts);
+  if (iree_string_view_is_empty(worker_counts_str)) {
+    worker_counts[worker_count_count++] = 0;
+  }
+  while (!iree_string_view_is_empty(worker_counts_str)) {
+    iree_string_view_t worker_count_str = iree_string_view_empty();
+    iree_string_view_split(worker_counts_str, ',', &worker_count_str,
+                           &worker_counts_str);
+    uint32_t worker_count = 0;
+    if (!iree_string_view_atoi_uint32(worker_count_str, &worker_count) ||
+        worker_count == 0 ||
+        worker_count_count + 1 > IREE_ARRAYSIZE(worker_counts)) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "invalid worker count '%.*s'",
+                              (int)worker_count_str.size,
+                              worker_count_str.data);
+    }
+    worker_counts[worker_count_count++] = worker_count;
+  }
+
+  // Benchmark definitions and names must outlive the benchmark run; they are
+  // intentionally leaked as the process exits right after.
+  for (iree_host_size_t i = 0; i < dispatch_specs.count; ++i) {
+    const iree_dispatch_benchmark_spec_t* spec = &dispatch_specs.specs[i];
+    iree_hal_local_executable_t* executable = NULL;
+    iree_host_size_t ordinal = 0;
+    if (!iree_module_lookup_export(spec, &executable, &ordinal)) {
+      return iree_make_status(IREE_STATUS_NOT_FOUND,
+                              "no loadable executable for '%.*s' (%.*s:%u) "
+                              "found in module",
+                              (int)spec->export_name.size,
+                              spec->export_name.data,
+                              (int)spec->executable_name.size,
+                              spec->executable_name.data, spec->ordinal);
+    }
+    for (iree_host_size_t j = 0; j < worker_count_count; ++j) {
+      iree_dispatch_benchmark_t* benchmark = NULL;
+      iree_benchmark_def_t* benchmark_def = NULL;
+      char* name = NULL;
+      IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+          host_allocator, sizeof(*benchmark), (void**)&benchmark));
+      IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+          host_allocator, sizeof(*benchmark_def), (void**)&benchmark_def));
+      IREE_RETURN_IF_ERROR(
+          iree_allocator_malloc(host_allocator, 256, (void**)&name));
+      benchmark->spec = spec;
+      benchmark->executable = executable;
+      benchmark->ordinal = ordinal;
+      benchmark->worker_count = worker_counts[j];
+      *benchmark_def = *benchmark_def_base;
+      benchmark_def->run = iree_dispatch_benchmark_run;
+      benchmark_def->user_data = benchmark;
+      int name_length = snprintf(
+          name, 256, "%.*s_%ux%ux%u/", (int)spec->export_name.size,
+          spec->export_name.data, spec->workgroup_count[0],
+          spec->workgroup_count[1], spec->workgroup_count[2]);
+      if (benchmark->worker_count) {
+        snprintf(name + name_length, 256 - name_length, "workers:%" PRIhsz,
+                 benchmark->worker_count);
+      } else {
+        snprintf(name + name_length, 256 - name_length, "inline");
+      }
+      iree_benchmark_register(iree_make_cstring_view(name), benchmark_def);
+    }
+  }
+  return iree_ok_status();
+}
+
+static void iree_module_release(void) {
+  for (iree_host_size_t i = 0; i < module_state.executable_count; ++i) {
+    iree_hal_executable_release(
+        (iree_hal_executable_t*)module_state.executables[i].executable);
+  }
+  iree_hal_executable_loader_release(module_state.executable_loader);
+  iree_file_contents_free(module_state.file_contents);
+  iree_allocator_free(iree_allocator_system(), dispatch_specs.specs);
+}
+
 // NOTE: error handling is here just for better diagnostics: it is not tracking
 // allocations correctly and will leak. Don't use this as an example for how to
 // write robust code.
@@ -159,8 +937,8 @@ static iree_status_t iree_hal_executable_library_run(
 
   // Load the executable data.
   iree_file_contents_t* file_contents = NULL;
-  IREE_RETURN_IF_ERROR(iree_file_read_contents(FLAG_executable_file,
-                                               host_allocator, &file_contents));
+  IREE_RETURN_IF_ERROR(iree_file_map_contents(FLAG_executable_file,
+                                              host_allocator, &file_contents));
   executable_params.executable_data = file_contents->const_buffer;
 
   // Setup the layouts defining how each entry point is interpreted.
@@ -238,11 +1016,21 @@ static iree_status_t iree_hal_executable_library_run(
   // tile processing the same exact region of memory over and over we are not
   // testing cache effects.
   int64_t dispatch_count = 0;
+  int itlb_miss_counter = iree_itlb_miss_counter_open();
+  iree_itlb_miss_counter_start(itlb_miss_counter);
   while (iree_benchmark_keep_running(benchmark_state, /*batch_count=*/1)) {
     IREE_RETURN_IF_ERROR(iree_hal_local_executable_issue_dispatch_inline(
         local_executable, FLAG_entry_point, &dispatch_state, 0, local_memory));
     ++dispatch_count;
   }
+  uint64_t itlb_misses = iree_itlb_miss_counter_stop(itlb_miss_counter);
+  if (itlb_miss_counter >= 0 && dispatch_count > 0) {
+    char label[64];
+    snprintf(label, sizeof(label), "itlb_misses/dispatch=%.2f",
+             (double)itlb_misses / (double)dispatch_count);
+    iree_benchmark_set_label(benchmark_state, label);
+  }
+  iree_itlb_miss_counter_close(itlb_miss_counter);
 
   // To get a total time per invocation we set the item count to the total
   // invocations dispatched. That gives us both total dispatch and single
@@ -283,6 +1071,13 @@ int main(int argc, char** argv) {
       "executables (bypassing all of the IREE VM, HAL APIs, task system,\n"
       "etc).\n"
       "\n"
+      "On Linux the instruction TLB misses incurred per dispatch are\n"
+      "reported in the benchmark label when hardware counters are\n"
+      "available. Large executables have their code mapped with large\n"
+      "pages by default; build with\n"
+      "-DIREE_HAL_EMBEDDED_ELF_LOADER_MODULE_FLAGS=0 to compare against\n"
+      "normal pages.\n"
+      "\n"
       "Example --flagfile:\n"
       "  --executable_format=embedded-elf\n"
       "  --executable_file=iree/hal/local/elf/testdata/"
@@ -297,6 +1092,15 @@ int main(int argc, char** argv) {
       "  --binding=4xf32=1,2,3,4\n"
       "  --binding=4xf32=100,200,300,400\n"
       "  --binding=4xf32=0,0,0,0\n"
+      "\n"
+      "All dispatches in a module can be benchmarked by compiling with\n"
+      "--iree-hal-dump-executable-benchmarks-to=path/ and passing the\n"
+      "module along with the emitted dispatch flagfile:\n"
+      "  --module_file=module.vmfb\n"
+      "  --flagfile=path/module_dispatches.flagfile\n"
+      "  --worker_counts=1,4,8\n"
+      "Use --benchmark_format=json or --benchmark_out=file.json for\n"
+      "machine-readable results.\n"
       "\n");
 
   iree_flags_parse_checked(IREE_FLAGS_PARSE_MODE_UNDEFINED_OK, &argc, &argv);
@@ -311,8 +1115,21 @@ int main(int argc, char** argv) {
       .iteration_count = 0,
       .run = iree_hal_executable_library_run,
   };
-  iree_benchmark_register(iree_make_cstring_view("dispatch"), &benchmark_def);
+  if (strlen(FLAG_module_file) > 0) {
+    iree_status_t status = iree_module_register_dispatch_benchmarks(
+        iree_allocator_system(), &benchmark_def);
+    if (!iree_status_is_ok(status)) {
+      iree_status_fprint(stderr, status);
+      iree_status_ignore(status);
+      iree_module_release();
+      return 1;
+    }
+  } else {
+    iree_benchmark_register(iree_make_cstring_view("dispatch"),
+                            &benchmark_def);
+  }
 
   iree_benchmark_run_specified();
+  iree_module_release();
   return 0;
 }
@@ -36,6 +36,26 @@ static int dispatch_tile_a(
   return 0;
 }
 
+// An optional batched version of dispatch_tile_a that processes a whole range
+// of workgroups in a single call. The runtime will use it in place of issuing
+// one call per workgroup and the loop can be specialized to the entry point:
+// here the dispatch is 1D and the workgroups map directly to array elements.
+static int dispatch_tile_a_range(
+    const iree_hal_executable_environment_v0_t* environment,
+    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+    const iree_hal_executable_workgroup_range_v0_t* workgroup_range) {
+  const dispatch_tile_a_push_constants_t* push_constants =
+      (const dispatch_tile_a_push_constants_t*)dispatch_state->push_constants;
+  const float* src = ((const float*)dispatch_state->binding_ptrs[0]);
+  float* dst = ((float*)dispatch_state->binding_ptrs[1]);
+  const uint32_t x_begin = workgroup_range->workgroup_id_x;
+  const uint32_t x_end = x_begin + workgroup_range->workgroup_count;
+  for (uint32_t x = x_begin; x < x_end; ++x) {
+    dst[x] = src[x] + push_constants->f0;
+  }
+  return 0;
+}
+
 // Just another entry point.
 static int dispatch_tile_b(
     const iree_hal_executable_environment_v0_t* environment,
@@ -52,7 +72,8 @@ static const iree_hal_executable_library_header_t header = {
     .version = IREE_HAL_EXECUTABLE_LIBRARY_VERSION_LATEST,
     // Name used for logging/diagnostics and rendezvous.
     .name = "demo_library",
-    .features = IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_NONE,
+    // Declares that the library provides the optional ranges table.
+    .features = IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_DISPATCH_RANGES,
     .sanitizer = IREE_HAL_EXECUTABLE_LIBRARY_SANITIZER_NONE,
 };
 // Table of export function entry points.
@@ -60,6 +81,12 @@ static const iree_hal_executable_dispatch_v0_t entry_points[2] = {
     dispatch_tile_a,
     dispatch_tile_b,
 };
+// Optional batched entry points; dispatch_tile_b only has the per-workgroup
+// entry point and will be issued one workgroup at a time.
+static const iree_hal_executable_dispatch_range_v0_t entry_ranges[2] = {
+    dispatch_tile_a_range,
+    NULL,
+};
 // Optional attributes for each dispatch function used by the runtime.
 // The table can be omitted if no attributes are non-zero. We don't use
 // local_memory in our dispatches here and don't need to specify the sizes.
@@ -100,6 +127,10 @@ static const iree_hal_executable_library_v0_t library = {
         {
             .count = 0,
         },
+    .ranges =
+        {
+            .ptrs = entry_ranges,
+        },
 };
 
 // The primary access point to the executable: in a static library this is
@@ -120,5 +120,25 @@ int main(int argc, char** argv) {
     IREE_ASSERT_EQ(ret0[i], ret0_expected[i], "math is hard");
     all_match = all_match && ret0[i] == ret0_expected[i];
   }
+
+  // Libraries may optionally provide batched entry points that execute a range
+  // of workgroups in a single call.
+  const iree_hal_executable_library_features_t features = header->features;
+  if ((features & IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_DISPATCH_RANGES) &&
+      library.v0->ranges.ptrs && library.v0->ranges.ptrs[0]) {
+    memset(ret0, 0, sizeof(ret0));
+    const iree_hal_executable_workgroup_range_v0_t workgroup_range = {
+        .processor_id = iree_cpu_query_processor_id(),
+        .workgroup_count = dispatch_state.workgroup_count_x,
+    };
+    int ret = library.v0->ranges.ptrs[0](&environment, &dispatch_state,
+                                         &workgroup_range);
+    IREE_ASSERT_EQ(ret, 0, "range entry points fail just like workgroups");
+    for (size_t i = 0; i < IREE_ARRAYSIZE(ret0_expected); ++i) {
+      IREE_ASSERT_EQ(ret0[i], ret0_expected[i], "math is still hard");
+      all_match = all_match && ret0[i] == ret0_expected[i];
+    }
+  }
+
   return all_match ? 0 : 1;
 }
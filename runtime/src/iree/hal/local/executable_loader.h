@@ -118,7 +118,9 @@ bool iree_hal_query_any_executable_loader_support(
 // the runtime loader and system are required.
 //
 // Returns IREE_STATUS_CANCELLED when the loader cannot load the file in the
-// given format.
+// given format. Callers probe loaders in a loop and skip ones that return
+// CANCELLED so implementations should return the code without annotations via
+// `iree_status_from_code(IREE_STATUS_CANCELLED)` to avoid status allocations.
 iree_status_t iree_hal_executable_loader_try_load(
     iree_hal_executable_loader_t* executable_loader,
     const iree_hal_executable_params_t* executable_params,
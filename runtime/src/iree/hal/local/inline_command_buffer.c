@@ -11,6 +11,7 @@
 #include <string.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/atomics.h"
 #include "iree/base/internal/fpu_state.h"
 #include "iree/base/internal/math.h"
 #include "iree/base/tracing.h"
@@ -29,6 +30,9 @@ typedef struct iree_hal_inline_command_buffer_t {
   iree_hal_command_buffer_t base;
   iree_allocator_t host_allocator;
 
+  // Optional workers that dispatches are split across.
+  iree_hal_inline_worker_group_t* worker_group;
+
   struct {
     // A flattened list of all available descriptor set bindings.
     // As descriptor sets are pushed/bound the bindings will be updated to
@@ -90,7 +94,9 @@ static void iree_hal_inline_command_buffer_reset(
 iree_status_t iree_hal_inline_command_buffer_create(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity, iree_allocator_t host_allocator,
+    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_inline_worker_group_t* worker_group,
+    iree_allocator_t host_allocator,
     iree_hal_command_buffer_t** out_command_buffer) {
   IREE_ASSERT_ARGUMENT(out_command_buffer);
   *out_command_buffer = NULL;
@@ -113,8 +119,11 @@ iree_status_t iree_hal_inline_command_buffer_create(
   if (iree_status_is_ok(status)) {
     iree_hal_command_buffer_initialize(
         device, mode, command_categories, queue_affinity,
-        &iree_hal_inline_command_buffer_vtable, &command_buffer->base);
+        /*binding_capacity=*/0, &iree_hal_inline_command_buffer_vtable,
+        &command_buffer->base);
     command_buffer->host_allocator = host_allocator;
+    command_buffer->worker_group = worker_group;
+    iree_hal_inline_worker_group_retain(worker_group);
     iree_hal_inline_command_buffer_reset(command_buffer);
 
     *out_command_buffer = &command_buffer->base;
@@ -132,6 +141,7 @@ static void iree_hal_inline_command_buffer_destroy(
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_inline_command_buffer_reset(command_buffer);
+  iree_hal_inline_worker_group_release(command_buffer->worker_group);
   iree_allocator_free(host_allocator, command_buffer);
 
   IREE_TRACE_ZONE_END(z0);
@@ -395,6 +405,138 @@ static iree_status_t iree_hal_inline_command_buffer_bind_descriptor_set(
 // iree_hal_command_buffer_dispatch
 //===----------------------------------------------------------------------===//
 
+// Number of tiles each worker should get on average when splitting a dispatch
+// across a worker group. Workers claim tiles dynamically so a few per worker
+// balances uneven workgroup costs without much claiming overhead.
+#define IREE_HAL_INLINE_TILES_PER_WORKER 4
+
+// Shared state of a dispatch split across a worker group.
+typedef struct iree_hal_inline_tiled_dispatch_t {
+  iree_hal_local_executable_t* executable;
+  int32_t entry_point;
+  const iree_hal_executable_dispatch_state_v0_t* dispatch_state;
+  // Total workgroups in the dispatch and the number per tile.
+  uint64_t workgroup_count;
+  uint32_t tile_size;
+  uint32_t tile_count;
+  // Next tile to be claimed by a worker.
+  iree_atomic_int32_t next_tile;
+  // First failure status from any worker; tiles stop being claimed after.
+  iree_atomic_intptr_t status;
+  // Scratch memory for each worker at a stride of local_memory_stride.
+  uint8_t* local_memory;
+  iree_host_size_t local_memory_size;
+  iree_host_size_t local_memory_stride;
+} iree_hal_inline_tiled_dispatch_t;
+
+// Executes tiles of the |user_data| dispatch until none remain.
+static void iree_hal_inline_command_buffer_issue_tiles(
+    void* user_data, iree_host_size_t worker_index) {
+  iree_hal_inline_tiled_dispatch_t* tiled_dispatch =
+      (iree_hal_inline_tiled_dispatch_t*)user_data;
+  const iree_hal_executable_dispatch_state_v0_t* dispatch_state =
+      tiled_dispatch->dispatch_state;
+
+  // Workers are borrowed threads as well; reset the floating point state.
+  iree_fpu_state_t fpu_state =
+      iree_fpu_state_push(IREE_FPU_STATE_FLAG_FLUSH_DENORMALS_TO_ZERO);
+
+  iree_alignas(64) iree_hal_executable_workgroup_range_v0_t workgroup_range = {
+      .processor_id = iree_cpu_query_processor_id(),
+      .local_memory =
+          tiled_dispatch->local_memory
+              ? tiled_dispatch->local_memory +
+                    worker_index * tiled_dispatch->local_memory_stride
+              : NULL,
+      .local_memory_size = (uint32_t)tiled_dispatch->local_memory_size,
+  };
+  while (!iree_atomic_load_intptr(&tiled_dispatch->status,
+                                  iree_memory_order_relaxed)) {
+    uint32_t tile = (uint32_t)iree_atomic_fetch_add_int32(
+        &tiled_dispatch->next_tile, 1, iree_memory_order_relaxed);
+    if (tile >= tiled_dispatch->tile_count) break;
+
+    // Convert the flattened index of the first workgroup in the tile back to
+    // XYZ; the range wraps into subsequent rows as needed.
+    uint64_t first = (uint64_t)tile * tiled_dispatch->tile_size;
+    uint64_t row = first / dispatch_state->workgroup_count_x;
+    workgroup_range.workgroup_id_x =
+        (uint32_t)(first % dispatch_state->workgroup_count_x);
+    workgroup_range.workgroup_id_y =
+        (uint32_t)(row % dispatch_state->workgroup_count_y);
+    workgroup_range.workgroup_id_z =
+        (uint16_t)(row / dispatch_state->workgroup_count_y);
+    workgroup_range.workgroup_count = (uint32_t)iree_min(
+        tiled_dispatch->tile_size, tiled_dispatch->workgroup_count - first);
+
+    iree_status_t status = iree_hal_local_executable_issue_range(
+        tiled_dispatch->executable, tiled_dispatch->entry_point,
+        dispatch_state, &workgroup_range);
+    if (!iree_status_is_ok(status)) {
+      intptr_t expected = 0;
+      if (!iree_atomic_compare_exchange_strong_intptr(
+              &tiled_dispatch->status, &expected, (intptr_t)status,
+              iree_memory_order_acq_rel, iree_memory_order_relaxed)) {
+        iree_status_ignore(status);  // another worker failed first
+      }
+      break;
+    }
+  }
+
+  iree_fpu_state_pop(fpu_state);
+}
+
+// Splits the workgroups of a dispatch across the |worker_group|.
+static iree_status_t iree_hal_inline_command_buffer_issue_dispatch_tiled(
+    iree_hal_inline_command_buffer_t* command_buffer,
+    iree_hal_local_executable_t* executable, int32_t entry_point,
+    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+    uint64_t workgroup_count, iree_host_size_t local_memory_size) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_host_size_t worker_count =
+      iree_hal_inline_worker_group_worker_count(command_buffer->worker_group);
+
+  iree_hal_inline_tiled_dispatch_t tiled_dispatch;
+  memset(&tiled_dispatch, 0, sizeof(tiled_dispatch));
+  tiled_dispatch.executable = executable;
+  tiled_dispatch.entry_point = entry_point;
+  tiled_dispatch.dispatch_state = dispatch_state;
+  tiled_dispatch.workgroup_count = workgroup_count;
+  uint64_t target_tile_count =
+      (uint64_t)worker_count * IREE_HAL_INLINE_TILES_PER_WORKER;
+  uint64_t tile_size =
+      (workgroup_count + target_tile_count - 1) / target_tile_count;
+  tiled_dispatch.tile_size = (uint32_t)iree_min(tile_size, UINT32_MAX);
+  tiled_dispatch.tile_count =
+      (uint32_t)((workgroup_count + tiled_dispatch.tile_size - 1) /
+                 tiled_dispatch.tile_size);
+
+  // Each worker needs its own scratch memory. See the note in
+  // iree_hal_inline_command_buffer_dispatch about this allocation.
+  tiled_dispatch.local_memory_size = local_memory_size;
+  tiled_dispatch.local_memory_stride =
+      iree_host_align(local_memory_size, iree_max_align_t);
+  if (local_memory_size > 0) {
+    IREE_RETURN_AND_END_ZONE_IF_ERROR(
+        z0, iree_allocator_malloc(
+                command_buffer->host_allocator,
+                tiled_dispatch.local_memory_stride * worker_count,
+                (void**)&tiled_dispatch.local_memory));
+  }
+
+  iree_hal_inline_worker_group_fork_join(
+      command_buffer->worker_group, iree_hal_inline_command_buffer_issue_tiles,
+      &tiled_dispatch);
+
+  if (tiled_dispatch.local_memory) {
+    iree_allocator_free(command_buffer->host_allocator,
+                        tiled_dispatch.local_memory);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return (iree_status_t)iree_atomic_load_intptr(&tiled_dispatch.status,
+                                                iree_memory_order_acquire);
+}
+
 static iree_status_t iree_hal_inline_command_buffer_dispatch(
     iree_hal_command_buffer_t* base_command_buffer,
     iree_hal_executable_t* executable, int32_t entry_point,
@@ -430,8 +572,19 @@ static iree_status_t iree_hal_inline_command_buffer_dispatch(
   dispatch_state->workgroup_count_y = workgroup_y;
   dispatch_state->workgroup_count_z = workgroup_z;
 
-  // Single-threaded.
-  dispatch_state->max_concurrency = 1;
+  // Dispatches with more than one workgroup are split across the worker group
+  // if one is available.
+  uint64_t workgroup_count =
+      (uint64_t)workgroup_x * workgroup_y * (uint64_t)workgroup_z;
+  iree_host_size_t worker_count =
+      command_buffer->worker_group
+          ? iree_hal_inline_worker_group_worker_count(
+                command_buffer->worker_group)
+          : 1;
+  bool is_tiled = worker_count > 1 && workgroup_count > 1 &&
+                  (uint64_t)workgroup_y * workgroup_z <= UINT32_MAX;
+  dispatch_state->max_concurrency =
+      is_tiled ? (uint8_t)iree_min(worker_count, UINT8_MAX) : 1;
 
   // Push constants are pulled directly from the command buffer state, but we
   // only allow the dispatch to read what we know is initialized based on the
@@ -467,6 +620,12 @@ static iree_status_t iree_hal_inline_command_buffer_dispatch(
         command_buffer->state.full_binding_lengths[binding_ordinal];
   }
 
+  if (is_tiled) {
+    return iree_hal_inline_command_buffer_issue_dispatch_tiled(
+        command_buffer, local_executable, entry_point, dispatch_state,
+        workgroup_count, local_memory_size);
+  }
+
   // TODO(benvanik): plumb through an arena or fixed-size reservation to use.
   // For now when deploying to devices where you want something like the
   // inline command buffer you probably don't want 256KB of transient memory
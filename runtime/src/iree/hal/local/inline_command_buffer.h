@@ -9,6 +9,7 @@
 
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
+#include "iree/hal/local/inline_worker_group.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -20,13 +21,18 @@ extern "C" {
 // can begin execution immediately. No inter-command-buffer scheduling will be
 // performed and all barriers and events are ignored.
 //
-// Executes all work on the calling thread synchronously (today).
+// Executes all work on the calling thread synchronously. If |worker_group| is
+// provided the workgroups of each dispatch are split across the calling thread
+// and the workers of the group and the dispatch returns once all have
+// completed. The group is retained for the lifetime of the command buffer.
 //
 // Must have IREE_HAL_COMMAND_BUFFER_MODE_ALLOW_INLINE_EXECUTION set.
 iree_status_t iree_hal_inline_command_buffer_create(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_hal_queue_affinity_t queue_affinity, iree_allocator_t host_allocator,
+    iree_hal_queue_affinity_t queue_affinity,
+    iree_hal_inline_worker_group_t* worker_group,
+    iree_allocator_t host_allocator,
     iree_hal_command_buffer_t** out_command_buffer);
 
 // Returns true if |command_buffer| is an inline command buffer.
@@ -0,0 +1,270 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/local/inline_worker_group.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/internal/threading.h"
+#include "iree/base/tracing.h"
+
+// Entry argument for a worker thread owned by the group.
+typedef struct iree_hal_inline_worker_thread_t {
+  iree_hal_inline_worker_group_t* group;
+  iree_host_size_t worker_index;
+  iree_thread_t* thread;
+} iree_hal_inline_worker_thread_t;
+
+struct iree_hal_inline_worker_group_t {
+  iree_atomic_ref_count_t ref_count;
+  iree_allocator_t host_allocator;
+
+  // Total number of workers including the thread issuing fork-joins.
+  iree_host_size_t worker_count;
+
+  // Held by the thread issuing a fork-join for its entire duration.
+  iree_slim_mutex_t fork_mutex;
+
+  // Incremented each time work is forked; workers run the current function
+  // each time they observe it change.
+  iree_atomic_int32_t epoch;
+  // Set to 1 when workers should return once idle.
+  iree_atomic_int32_t shutdown;
+  // Number of workers (excluding the caller) still running the current epoch.
+  iree_atomic_int32_t pending_count;
+
+  // Function and user data for the current epoch. Published by the release
+  // increment of |epoch|.
+  iree_hal_inline_worker_fn_t fn;
+  void* user_data;
+
+  // Posted when |epoch| or |shutdown| changes.
+  iree_notification_t fork_notification;
+  // Posted when |pending_count| reaches 0.
+  iree_notification_t join_notification;
+
+  // Worker threads created by the group, if any.
+  iree_host_size_t thread_count;
+  iree_hal_inline_worker_thread_t threads[];
+};
+
+static iree_status_t iree_hal_inline_worker_group_allocate(
+    iree_host_size_t worker_count, iree_host_size_t thread_count,
+    iree_allocator_t host_allocator,
+    iree_hal_inline_worker_group_t** out_group) {
+  *out_group = NULL;
+  if (worker_count == 0 || worker_count > INT32_MAX) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "worker count %" PRIhsz " out of range",
+                            worker_count);
+  }
+  iree_hal_inline_worker_group_t* group = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      host_allocator, sizeof(*group) + thread_count * sizeof(group->threads[0]),
+      (void**)&group));
+  memset(group, 0, sizeof(*group) + thread_count * sizeof(group->threads[0]));
+  iree_atomic_ref_count_init(&group->ref_count);
+  group->host_allocator = host_allocator;
+  group->worker_count = worker_count;
+  iree_slim_mutex_initialize(&group->fork_mutex);
+  iree_notification_initialize(&group->fork_notification);
+  iree_notification_initialize(&group->join_notification);
+  *out_group = group;
+  return iree_ok_status();
+}
+
+iree_status_t iree_hal_inline_worker_group_create(
+    iree_host_size_t worker_count, iree_allocator_t host_allocator,
+    iree_hal_inline_worker_group_t** out_group) {
+  IREE_ASSERT_ARGUMENT(out_group);
+  return iree_hal_inline_worker_group_allocate(worker_count,
+                                               /*thread_count=*/0,
+                                               host_allocator, out_group);
+}
+
+static int iree_hal_inline_worker_thread_main(void* entry_arg) {
+  iree_hal_inline_worker_thread_t* worker_thread =
+      (iree_hal_inline_worker_thread_t*)entry_arg;
+  iree_hal_inline_worker_group_run_worker(worker_thread->group,
+                                          worker_thread->worker_index);
+  return 0;
+}
+
+iree_status_t iree_hal_inline_worker_group_create_with_threads(
+    iree_host_size_t worker_count, iree_allocator_t host_allocator,
+    iree_hal_inline_worker_group_t** out_group) {
+  IREE_ASSERT_ARGUMENT(out_group);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_host_size_t thread_count = worker_count > 1 ? worker_count - 1 : 0;
+  iree_hal_inline_worker_group_t* group = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_inline_worker_group_allocate(worker_count, thread_count,
+                                                host_allocator, &group));
+
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < thread_count; ++i) {
+    iree_hal_inline_worker_thread_t* worker_thread = &group->threads[i];
+    worker_thread->group = group;
+    worker_thread->worker_index = i + 1;
+    char name[16];
+    int name_length =
+        snprintf(name, sizeof(name), "iree-inline-%" PRIhsz, i + 1);
+    iree_thread_create_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.name = iree_make_string_view(name, name_length);
+    status = iree_thread_create(iree_hal_inline_worker_thread_main,
+                                worker_thread, params, host_allocator,
+                                &worker_thread->thread);
+    if (!iree_status_is_ok(status)) break;
+    ++group->thread_count;
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_group = group;
+  } else {
+    iree_hal_inline_worker_group_release(group);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_inline_worker_group_destroy(
+    iree_hal_inline_worker_group_t* group) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Releasing the threads joins them so they must have exited first.
+  iree_hal_inline_worker_group_shutdown(group);
+  for (iree_host_size_t i = 0; i < group->thread_count; ++i) {
+    iree_thread_release(group->threads[i].thread);
+  }
+
+  iree_notification_deinitialize(&group->join_notification);
+  iree_notification_deinitialize(&group->fork_notification);
+  iree_slim_mutex_deinitialize(&group->fork_mutex);
+  iree_allocator_free(group->host_allocator, group);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+void iree_hal_inline_worker_group_retain(
+    iree_hal_inline_worker_group_t* group) {
+  if (IREE_LIKELY(group)) {
+    iree_atomic_ref_count_inc(&group->ref_count);
+  }
+}
+
+void iree_hal_inline_worker_group_release(
+    iree_hal_inline_worker_group_t* group) {
+  if (IREE_LIKELY(group) && iree_atomic_ref_count_dec(&group->ref_count) == 1) {
+    iree_hal_inline_worker_group_destroy(group);
+  }
+}
+
+iree_host_size_t iree_hal_inline_worker_group_worker_count(
+    const iree_hal_inline_worker_group_t* group) {
+  return group->worker_count;
+}
+
+typedef struct iree_hal_inline_worker_wait_t {
+  iree_hal_inline_worker_group_t* group;
+  int32_t last_epoch;
+} iree_hal_inline_worker_wait_t;
+
+static bool iree_hal_inline_worker_has_work(void* arg) {
+  iree_hal_inline_worker_wait_t* wait = (iree_hal_inline_worker_wait_t*)arg;
+  return iree_atomic_load_int32(&wait->group->epoch,
+                                iree_memory_order_acquire) !=
+             wait->last_epoch ||
+         iree_atomic_load_int32(&wait->group->shutdown,
+                                iree_memory_order_acquire) != 0;
+}
+
+void iree_hal_inline_worker_group_run_worker(
+    iree_hal_inline_worker_group_t* group, iree_host_size_t worker_index) {
+  IREE_ASSERT(worker_index > 0 && worker_index < group->worker_count);
+  // Starts from the initial epoch so that a worker that begins running after
+  // work was forked still participates.
+  iree_hal_inline_worker_wait_t wait = {
+      .group = group,
+      .last_epoch = 0,
+  };
+  while (true) {
+    iree_notification_await(&group->fork_notification,
+                            iree_hal_inline_worker_has_work, &wait,
+                            iree_infinite_timeout());
+    int32_t epoch =
+        iree_atomic_load_int32(&group->epoch, iree_memory_order_acquire);
+    if (epoch != wait.last_epoch) {
+      wait.last_epoch = epoch;
+      group->fn(group->user_data, worker_index);
+      if (iree_atomic_fetch_sub_int32(&group->pending_count, 1,
+                                      iree_memory_order_acq_rel) == 1) {
+        iree_notification_post(&group->join_notification, IREE_ALL_WAITERS);
+      }
+      continue;
+    }
+    // Shutdown only takes effect while idle; forks hold the fork mutex that
+    // shutdown acquires so no epoch can be missed.
+    break;
+  }
+}
+
+void iree_hal_inline_worker_group_shutdown(
+    iree_hal_inline_worker_group_t* group) {
+  // Waits for any in-flight fork-join to complete.
+  iree_slim_mutex_lock(&group->fork_mutex);
+  iree_atomic_store_int32(&group->shutdown, 1, iree_memory_order_release);
+  iree_slim_mutex_unlock(&group->fork_mutex);
+  iree_notification_post(&group->fork_notification, IREE_ALL_WAITERS);
+}
+
+static bool iree_hal_inline_worker_group_is_joined(void* arg) {
+  iree_hal_inline_worker_group_t* group = (iree_hal_inline_worker_group_t*)arg;
+  return iree_atomic_load_int32(&group->pending_count,
+                                iree_memory_order_acquire) == 0;
+}
+
+iree_host_size_t iree_hal_inline_worker_group_fork_join(
+    iree_hal_inline_worker_group_t* group, iree_hal_inline_worker_fn_t fn,
+    void* user_data) {
+  // Run on the calling thread alone if there's nothing to fork to or another
+  // thread is already using the workers.
+  if (group->worker_count <= 1 ||
+      !iree_slim_mutex_try_lock(&group->fork_mutex)) {
+    fn(user_data, 0);
+    return 1;
+  }
+  if (iree_atomic_load_int32(&group->shutdown, iree_memory_order_acquire)) {
+    iree_slim_mutex_unlock(&group->fork_mutex);
+    fn(user_data, 0);
+    return 1;
+  }
+
+  // Fork: publish the work and wake all workers.
+  group->fn = fn;
+  group->user_data = user_data;
+  iree_atomic_store_int32(&group->pending_count,
+                          (int32_t)(group->worker_count - 1),
+                          iree_memory_order_relaxed);
+  iree_atomic_fetch_add_int32(&group->epoch, 1, iree_memory_order_release);
+  iree_notification_post(&group->fork_notification, IREE_ALL_WAITERS);
+
+  // Participate as worker 0.
+  fn(user_data, 0);
+
+  // Join: wait for all other workers to finish.
+  iree_notification_await(&group->join_notification,
+                          iree_hal_inline_worker_group_is_joined, group,
+                          iree_infinite_timeout());
+  group->fn = NULL;
+  group->user_data = NULL;
+  iree_slim_mutex_unlock(&group->fork_mutex);
+  return group->worker_count;
+}
@@ -0,0 +1,98 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_LOCAL_INLINE_WORKER_GROUP_H_
+#define IREE_HAL_LOCAL_INLINE_WORKER_GROUP_H_
+
+#include "iree/base/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_inline_worker_group_t
+//===----------------------------------------------------------------------===//
+
+// A small fixed set of threads that inline command buffers can split dispatch
+// workgroups across using a simple fork-join barrier.
+//
+// This is a lightweight middle ground between fully single-threaded inline
+// execution and the task system: there are no queues, no work stealing, and no
+// cross-dispatch scheduling. The thread issuing work participates as worker 0
+// and blocks until all other workers have finished their share.
+//
+// Workers are threads owned by the caller: after creating the group each of
+// the |worker_count| - 1 additional threads must call
+// iree_hal_inline_worker_group_run_worker with its worker index and will
+// remain inside until iree_hal_inline_worker_group_shutdown is called. This
+// allows embedded applications to provide threads with whatever stack size,
+// priority, and affinity their system requires. Fork-join operations block
+// until every worker participates and must not be issued if workers may not be
+// running.
+//
+// Thread-safe. If a fork-join is already in progress (such as when multiple
+// threads are submitting work to the same device) additional callers execute
+// their work on the calling thread alone instead of waiting.
+typedef struct iree_hal_inline_worker_group_t iree_hal_inline_worker_group_t;
+
+// Creates a worker group with |worker_count| workers including the caller.
+// The caller must provide |worker_count| - 1 threads that run
+// iree_hal_inline_worker_group_run_worker.
+iree_status_t iree_hal_inline_worker_group_create(
+    iree_host_size_t worker_count, iree_allocator_t host_allocator,
+    iree_hal_inline_worker_group_t** out_group);
+
+// Creates a worker group with |worker_count| workers including the caller
+// where the group creates and owns its additional worker threads. The threads
+// are shut down and joined when the group is destroyed.
+iree_status_t iree_hal_inline_worker_group_create_with_threads(
+    iree_host_size_t worker_count, iree_allocator_t host_allocator,
+    iree_hal_inline_worker_group_t** out_group);
+
+// Retains the given |group| for the caller.
+void iree_hal_inline_worker_group_retain(iree_hal_inline_worker_group_t* group);
+
+// Releases the given |group| from the caller.
+// Caller-provided worker threads must have returned from
+// iree_hal_inline_worker_group_run_worker before the last reference is
+// released.
+void iree_hal_inline_worker_group_release(
+    iree_hal_inline_worker_group_t* group);
+
+// Returns the total number of workers in the group including the caller.
+iree_host_size_t iree_hal_inline_worker_group_worker_count(
+    const iree_hal_inline_worker_group_t* group);
+
+// Runs the worker loop for |worker_index| (in [1, worker_count)) on the calling
+// thread until the group is shut down.
+void iree_hal_inline_worker_group_run_worker(
+    iree_hal_inline_worker_group_t* group, iree_host_size_t worker_index);
+
+// Requests that all workers return from iree_hal_inline_worker_group_run_worker
+// once they are idle. No further fork-join operations are distributed to the
+// workers after shutdown and instead execute on the calling thread.
+void iree_hal_inline_worker_group_shutdown(
+    iree_hal_inline_worker_group_t* group);
+
+// Function run by each worker participating in a fork-join operation.
+// |worker_index| is in [0, worker_count) with 0 being the calling thread.
+typedef void (*iree_hal_inline_worker_fn_t)(void* user_data,
+                                             iree_host_size_t worker_index);
+
+// Runs |fn| on every worker of the |group| and returns once all have
+// returned. The calling thread executes |fn| as worker 0. Returns the number of
+// workers that executed |fn|; this is 1 if the group is busy with another
+// fork-join or has been shut down.
+iree_host_size_t iree_hal_inline_worker_group_fork_join(
+    iree_hal_inline_worker_group_t* group, iree_hal_inline_worker_fn_t fn,
+    void* user_data);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_LOCAL_INLINE_WORKER_GROUP_H_
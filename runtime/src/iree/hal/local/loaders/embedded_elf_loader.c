@@ -17,6 +17,14 @@
 #include "iree/hal/local/local_executable.h"
 #include "iree/hal/local/local_executable_layout.h"
 
+// Flags used when loading all embedded ELF modules. Large pages are only used
+// for executable segments spanning at least one large page such that small
+// libraries are mapped as they always have been.
+#if !defined(IREE_HAL_EMBEDDED_ELF_LOADER_MODULE_FLAGS)
+#define IREE_HAL_EMBEDDED_ELF_LOADER_MODULE_FLAGS \
+  IREE_ELF_MODULE_FLAG_LARGE_PAGES
+#endif  // !IREE_HAL_EMBEDDED_ELF_LOADER_MODULE_FLAGS
+
 //===----------------------------------------------------------------------===//
 // iree_hal_elf_executable_t
 //===----------------------------------------------------------------------===//
@@ -39,6 +47,35 @@ typedef struct iree_hal_elf_executable_t {
   iree_hal_local_executable_layout_t* layouts[];
 } iree_hal_elf_executable_t;
 
+static iree_status_t iree_hal_elf_executable_issue_range(
+    iree_hal_local_executable_t* base_executable, iree_host_size_t ordinal,
+    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+    const iree_hal_executable_workgroup_range_v0_t* workgroup_range) {
+  iree_hal_elf_executable_t* executable =
+      (iree_hal_elf_executable_t*)base_executable;
+  const iree_hal_executable_library_v0_t* library = executable->library.v0;
+
+  if (IREE_UNLIKELY(ordinal >= library->exports.count)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "entry point ordinal out of bounds");
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, workgroup_range->workgroup_count);
+
+  int ret = iree_elf_call_i_ppp(library->ranges.ptrs[ordinal],
+                                (void*)&base_executable->environment,
+                                (void*)dispatch_state, (void*)workgroup_range);
+
+  IREE_TRACE_ZONE_END(z0);
+
+  return ret == 0 ? iree_ok_status()
+                  : iree_make_status(
+                        IREE_STATUS_INTERNAL,
+                        "executable entry point returned catastrophic error %d",
+                        ret);
+}
+
 static const iree_hal_local_executable_vtable_t iree_hal_elf_executable_vtable;
 
 static iree_status_t iree_hal_elf_executable_query_library(
@@ -82,6 +119,11 @@ static iree_status_t iree_hal_elf_executable_query_library(
   executable->identifier = iree_make_cstring_view(header->name);
 
   executable->base.dispatch_attrs = executable->library.v0->exports.attrs;
+  executable->base.export_count = executable->library.v0->exports.count;
+  executable->base.export_names = executable->library.v0->exports.names;
+  if (header->features & IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_DISPATCH_RANGES) {
+    executable->base.dispatch_ranges = executable->library.v0->ranges.ptrs;
+  }
 
   return iree_ok_status();
 }
@@ -174,7 +216,8 @@ static iree_status_t iree_hal_elf_executable_create(
     // Attempt to load the ELF module.
     status = iree_elf_module_initialize_from_memory(
         executable_params->executable_data, /*import_table=*/NULL,
-        host_allocator, &executable->module);
+        IREE_HAL_EMBEDDED_ELF_LOADER_MODULE_FLAGS, host_allocator,
+        &executable->module);
   }
   if (iree_status_is_ok(status)) {
     // Query metadata and get the entry point function pointers.
@@ -295,6 +338,7 @@ static const iree_hal_local_executable_vtable_t iree_hal_elf_executable_vtable =
                 .destroy = iree_hal_elf_executable_destroy,
             },
         .issue_call = iree_hal_elf_executable_issue_call,
+        .issue_range = iree_hal_elf_executable_issue_range,
 };
 
 //===----------------------------------------------------------------------===//
@@ -6,6 +6,8 @@
 
 #include "iree/hal/local/loaders/registration/init.h"
 
+#include "iree/hal/local/ukernel_import_provider.h"
+
 // NOTE: we register in a specific order to allow for prioritization:
 // - system-library: used when embedded is not desired (TSAN/debugging/etc).
 // - embedded-elf: default codegen portable ELF output format.
@@ -52,7 +54,7 @@ IREE_API_EXPORT iree_status_t iree_hal_create_all_available_executable_loaders(
 #if defined(IREE_HAVE_HAL_EXECUTABLE_LOADER_SYSTEM_LIBRARY)
   if (iree_status_is_ok(status)) {
     status = iree_hal_system_library_loader_create(
-        iree_hal_executable_import_provider_null(), host_allocator,
+        iree_hal_ukernel_import_provider(), host_allocator,
         &loaders[count++]);
   }
 #endif  // IREE_HAVE_HAL_EXECUTABLE_LOADER_SYSTEM_LIBRARY
@@ -60,7 +62,7 @@ IREE_API_EXPORT iree_status_t iree_hal_create_all_available_executable_loaders(
 #if defined(IREE_HAVE_HAL_EXECUTABLE_LOADER_EMBEDDED_ELF)
   if (iree_status_is_ok(status)) {
     status = iree_hal_embedded_elf_loader_create(
-        iree_hal_executable_import_provider_null(), host_allocator,
+        iree_hal_ukernel_import_provider(), host_allocator,
         &loaders[count++]);
   }
 #endif  // IREE_HAVE_HAL_EXECUTABLE_LOADER_EMBEDDED_ELF
@@ -89,7 +91,7 @@ IREE_API_EXPORT iree_status_t iree_hal_create_executable_loader_by_name(
 #if defined(IREE_HAVE_HAL_EXECUTABLE_LOADER_EMBEDDED_ELF)
   if (iree_string_view_starts_with(name, IREE_SV("embedded-elf"))) {
     return iree_hal_embedded_elf_loader_create(
-        iree_hal_executable_import_provider_null(), host_allocator,
+        iree_hal_ukernel_import_provider(), host_allocator,
         out_executable_loader);
   }
 #endif  // IREE_HAVE_HAL_EXECUTABLE_LOADER_EMBEDDED_ELF
@@ -97,7 +99,7 @@ IREE_API_EXPORT iree_status_t iree_hal_create_executable_loader_by_name(
 #if defined(IREE_HAVE_HAL_EXECUTABLE_LOADER_SYSTEM_LIBRARY)
   if (iree_string_view_starts_with(name, IREE_SV("system-library"))) {
     return iree_hal_system_library_loader_create(
-        iree_hal_executable_import_provider_null(), host_allocator,
+        iree_hal_ukernel_import_provider(), host_allocator,
         out_executable_loader);
   }
 #endif  // IREE_HAVE_HAL_EXECUTABLE_LOADER_SYSTEM_LIBRARY
@@ -92,6 +92,34 @@ typedef struct iree_hal_system_executable_t {
   iree_hal_local_executable_layout_t* layouts[];
 } iree_hal_system_executable_t;
 
+static iree_status_t iree_hal_system_executable_issue_range(
+    iree_hal_local_executable_t* base_executable, iree_host_size_t ordinal,
+    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+    const iree_hal_executable_workgroup_range_v0_t* workgroup_range) {
+  iree_hal_system_executable_t* executable =
+      (iree_hal_system_executable_t*)base_executable;
+  const iree_hal_executable_library_v0_t* library = executable->library.v0;
+
+  if (IREE_UNLIKELY(ordinal >= library->exports.count)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "entry point ordinal out of bounds");
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, workgroup_range->workgroup_count);
+
+  int ret = library->ranges.ptrs[ordinal](&base_executable->environment,
+                                          dispatch_state, workgroup_range);
+
+  IREE_TRACE_ZONE_END(z0);
+
+  return ret == 0 ? iree_ok_status()
+                  : iree_make_status(
+                        IREE_STATUS_INTERNAL,
+                        "executable entry point returned catastrophic error %d",
+                        ret);
+}
+
 static const iree_hal_local_executable_vtable_t
     iree_hal_system_executable_vtable;
 
@@ -202,6 +230,11 @@ static iree_status_t iree_hal_system_executable_query_library(
   executable->identifier = iree_make_cstring_view(header->name);
 
   executable->base.dispatch_attrs = executable->library.v0->exports.attrs;
+  executable->base.export_count = executable->library.v0->exports.count;
+  executable->base.export_names = executable->library.v0->exports.names;
+  if (header->features & IREE_HAL_EXECUTABLE_LIBRARY_FEATURE_DISPATCH_RANGES) {
+    executable->base.dispatch_ranges = executable->library.v0->ranges.ptrs;
+  }
 
   return iree_ok_status();
 }
@@ -414,6 +447,7 @@ static const iree_hal_local_executable_vtable_t
                 .destroy = iree_hal_system_executable_destroy,
             },
         .issue_call = iree_hal_system_executable_issue_call,
+        .issue_range = iree_hal_system_executable_issue_range,
 };
 
 //===----------------------------------------------------------------------===//
@@ -29,6 +29,9 @@ void iree_hal_local_executable_initialize(
 
   // Function attributes are optional and populated by the parent type.
   out_base_executable->dispatch_attrs = NULL;
+  out_base_executable->dispatch_ranges = NULL;
+  out_base_executable->export_count = 0;
+  out_base_executable->export_names = NULL;
 
   // Default environment with no imports assigned.
   iree_hal_executable_environment_initialize(host_allocator,
@@ -61,6 +64,46 @@ iree_status_t iree_hal_local_executable_issue_call(
       ->issue_call(executable, ordinal, dispatch_state, workgroup_state);
 }
 
+iree_status_t iree_hal_local_executable_issue_range(
+    iree_hal_local_executable_t* executable, iree_host_size_t ordinal,
+    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+    const iree_hal_executable_workgroup_range_v0_t* workgroup_range) {
+  IREE_ASSERT_ARGUMENT(executable);
+  IREE_ASSERT_ARGUMENT(dispatch_state);
+  IREE_ASSERT_ARGUMENT(workgroup_range);
+  const iree_hal_local_executable_vtable_t* vtable =
+      (const iree_hal_local_executable_vtable_t*)executable->resource.vtable;
+  if (executable->dispatch_ranges && executable->dispatch_ranges[ordinal] &&
+      vtable->issue_range) {
+    return vtable->issue_range(executable, ordinal, dispatch_state,
+                               workgroup_range);
+  }
+
+  // No batched entry point; walk the range one workgroup at a time.
+  iree_alignas(64) iree_hal_executable_workgroup_state_v0_t workgroup_state = {
+      .workgroup_id_x = workgroup_range->workgroup_id_x,
+      .workgroup_id_y = workgroup_range->workgroup_id_y,
+      .workgroup_id_z = workgroup_range->workgroup_id_z,
+      .reserved = 0,
+      .processor_id = workgroup_range->processor_id,
+      .local_memory = workgroup_range->local_memory,
+      .local_memory_size = workgroup_range->local_memory_size,
+  };
+  for (uint32_t i = 0; i < workgroup_range->workgroup_count; ++i) {
+    IREE_RETURN_IF_ERROR(vtable->issue_call(executable, ordinal, dispatch_state,
+                                            &workgroup_state));
+    if (++workgroup_state.workgroup_id_x == dispatch_state->workgroup_count_x) {
+      workgroup_state.workgroup_id_x = 0;
+      if (++workgroup_state.workgroup_id_y ==
+          dispatch_state->workgroup_count_y) {
+        workgroup_state.workgroup_id_y = 0;
+        ++workgroup_state.workgroup_id_z;
+      }
+    }
+  }
+  return iree_ok_status();
+}
+
 iree_status_t iree_hal_local_executable_issue_dispatch_inline(
     iree_hal_local_executable_t* executable, iree_host_size_t ordinal,
     const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
@@ -82,22 +125,25 @@ iree_status_t iree_hal_local_executable_issue_dispatch_inline(
 
   iree_status_t status = iree_ok_status();
 
-  iree_alignas(64) iree_hal_executable_workgroup_state_v0_t workgroup_state = {
+  // Each row of workgroups along X is issued as a single range; the total
+  // workgroup count may exceed what fits in a single range.
+  iree_alignas(64) iree_hal_executable_workgroup_range_v0_t workgroup_range = {
       .workgroup_id_x = 0,
       .workgroup_id_y = 0,
       .workgroup_id_z = 0,
       .processor_id = processor_id,
       .local_memory = local_memory.data,
       .local_memory_size = (size_t)local_memory.data_length,
+      .workgroup_count = workgroup_count_x,
   };
-  for (uint32_t z = 0; z < workgroup_count_z; ++z) {
-    workgroup_state.workgroup_id_z = z;
-    for (uint32_t y = 0; y < workgroup_count_y; ++y) {
-      workgroup_state.workgroup_id_y = y;
-      for (uint32_t x = 0; x < workgroup_count_x; ++x) {
-        workgroup_state.workgroup_id_x = x;
-        status = iree_hal_local_executable_issue_call(
-            executable, ordinal, dispatch_state, &workgroup_state);
+  if (workgroup_count_x > 0) {
+    for (uint32_t z = 0; z < workgroup_count_z && iree_status_is_ok(status);
+         ++z) {
+      workgroup_range.workgroup_id_z = z;
+      for (uint32_t y = 0; y < workgroup_count_y; ++y) {
+        workgroup_range.workgroup_id_y = y;
+        status = iree_hal_local_executable_issue_range(
+            executable, ordinal, dispatch_state, &workgroup_range);
         if (!iree_status_is_ok(status)) break;
       }
     }
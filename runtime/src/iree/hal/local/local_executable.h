@@ -28,6 +28,17 @@ typedef struct iree_hal_local_executable_t {
   // of memory required by the function.
   const iree_hal_executable_dispatch_attrs_v0_t* dispatch_attrs;
 
+  // Optional per-entry point batched functions executing ranges of workgroups.
+  // When NULL or the entry for an ordinal is NULL ranges are executed by
+  // issuing one call per workgroup.
+  const iree_hal_executable_dispatch_range_v0_t* dispatch_ranges;
+
+  // Optional export names 1:1 with entry point ordinals. Only available when
+  // the executable was compiled with reflection information and intended for
+  // tooling that needs to find entry points by name.
+  iree_host_size_t export_count;
+  const char* const* export_names;
+
   // Execution environment.
   iree_hal_executable_environment_v0_t environment;
 } iree_hal_local_executable_t;
@@ -39,6 +50,13 @@ typedef struct iree_hal_local_executable_vtable_t {
       iree_hal_local_executable_t* executable, iree_host_size_t ordinal,
       const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
       const iree_hal_executable_workgroup_state_v0_t* workgroup_state);
+
+  // Optional; only called for entry points with a non-NULL dispatch_ranges
+  // entry.
+  iree_status_t(IREE_API_PTR* issue_range)(
+      iree_hal_local_executable_t* executable, iree_host_size_t ordinal,
+      const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+      const iree_hal_executable_workgroup_range_v0_t* workgroup_range);
 } iree_hal_local_executable_vtable_t;
 
 // Initializes the local executable base type.
@@ -64,6 +82,14 @@ iree_status_t iree_hal_local_executable_issue_call(
     const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
     const iree_hal_executable_workgroup_state_v0_t* workgroup_state);
 
+// Issues the contiguous range of workgroups described by |workgroup_range|.
+// Uses the batched entry point of the executable when available and otherwise
+// issues one call per workgroup.
+iree_status_t iree_hal_local_executable_issue_range(
+    iree_hal_local_executable_t* executable, iree_host_size_t ordinal,
+    const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
+    const iree_hal_executable_workgroup_range_v0_t* workgroup_range);
+
 iree_status_t iree_hal_local_executable_issue_dispatch_inline(
     iree_hal_local_executable_t* executable, iree_host_size_t ordinal,
     const iree_hal_executable_dispatch_state_v0_t* dispatch_state,
@@ -8,13 +8,278 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/synchronization.h"
 #include "iree/base/tracing.h"
+#include "iree/hal/local/local_executable.h"
+#include "iree/hal/local/local_executable_layout.h"
+
+//===----------------------------------------------------------------------===//
+// iree_hal_local_executable_cache_storage_t
+//===----------------------------------------------------------------------===//
+
+// Caching mode bits that do not change the behavior of the loaded executable.
+// Shared executables are always loaded without aliasing the provided data as
+// they may outlive the caller that provided it.
+#define IREE_HAL_LOCAL_EXECUTABLE_CACHE_IGNORED_CACHING_MODES \
+  IREE_HAL_EXECUTABLE_CACHING_MODE_ALIAS_PROVIDED_DATA
+
+typedef struct iree_hal_local_executable_cache_entry_t {
+  struct iree_hal_local_executable_cache_entry_t* next;
+  // Hash of the executable data and constants used to quickly reject entries.
+  uint64_t hash;
+  iree_hal_executable_caching_mode_t caching_mode;
+  // Copies of the identifying executable params stored in the same allocation
+  // as the entry. The loaded executable retains its executable layouts.
+  iree_string_view_t executable_format;
+  iree_const_byte_span_t executable_data;
+  iree_host_size_t constant_count;
+  const uint32_t* constants;
+  // Retained executable shared with all caches using the storage.
+  iree_hal_executable_t* executable;
+} iree_hal_local_executable_cache_entry_t;
+
+struct iree_hal_local_executable_cache_storage_t {
+  iree_atomic_ref_count_t ref_count;
+  iree_allocator_t host_allocator;
+
+  // Guards the entry list. Held while loading executables such that concurrent
+  // requests for the same executable only load it once.
+  iree_slim_mutex_t mutex;
+  iree_hal_local_executable_cache_entry_t* entry_head;
+};
+
+iree_status_t iree_hal_local_executable_cache_storage_create(
+    iree_allocator_t host_allocator,
+    iree_hal_local_executable_cache_storage_t** out_storage) {
+  IREE_ASSERT_ARGUMENT(out_storage);
+  *out_storage = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_local_executable_cache_storage_t* storage = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*storage),
+                                (void**)&storage));
+  iree_atomic_ref_count_init(&storage->ref_count);
+  storage->host_allocator = host_allocator;
+  iree_slim_mutex_initialize(&storage->mutex);
+  storage->entry_head = NULL;
+
+  *out_storage = storage;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_hal_local_executable_cache_entry_free(
+    iree_allocator_t host_allocator,
+    iree_hal_local_executable_cache_entry_t* entry) {
+  iree_hal_executable_release(entry->executable);
+  iree_allocator_free(host_allocator, entry);
+}
+
+static void iree_hal_local_executable_cache_storage_destroy(
+    iree_hal_local_executable_cache_storage_t* storage) {
+  iree_allocator_t host_allocator = storage->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_local_executable_cache_entry_t* entry = storage->entry_head;
+  while (entry) {
+    iree_hal_local_executable_cache_entry_t* next = entry->next;
+    iree_hal_local_executable_cache_entry_free(host_allocator, entry);
+    entry = next;
+  }
+  iree_slim_mutex_deinitialize(&storage->mutex);
+  iree_allocator_free(host_allocator, storage);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+void iree_hal_local_executable_cache_storage_retain(
+    iree_hal_local_executable_cache_storage_t* storage) {
+  if (IREE_LIKELY(storage)) {
+    iree_atomic_ref_count_inc(&storage->ref_count);
+  }
+}
+
+void iree_hal_local_executable_cache_storage_release(
+    iree_hal_local_executable_cache_storage_t* storage) {
+  if (IREE_LIKELY(storage) &&
+      iree_atomic_ref_count_dec(&storage->ref_count) == 1) {
+    iree_hal_local_executable_cache_storage_destroy(storage);
+  }
+}
+
+// Returns a 64-bit FNV-1a hash of the identifying data in |executable_params|.
+static uint64_t iree_hal_local_executable_cache_hash(
+    const iree_hal_executable_params_t* executable_params) {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  const uint8_t* data = executable_params->executable_data.data;
+  for (iree_host_size_t i = 0;
+       i < executable_params->executable_data.data_length; ++i) {
+    hash = (hash ^ data[i]) * 0x00000100000001B3ull;
+  }
+  for (iree_host_size_t i = 0; i < executable_params->constant_count; ++i) {
+    hash = (hash ^ executable_params->constants[i]) * 0x00000100000001B3ull;
+  }
+  return hash;
+}
+
+// Returns true if |entry| holds an executable equivalent to one that would be
+// loaded with |executable_params|.
+static bool iree_hal_local_executable_cache_entry_matches(
+    const iree_hal_local_executable_cache_entry_t* entry, uint64_t hash,
+    iree_hal_executable_caching_mode_t caching_mode,
+    const iree_hal_executable_params_t* executable_params) {
+  if (entry->hash != hash || entry->caching_mode != caching_mode ||
+      entry->executable_data.data_length !=
+          executable_params->executable_data.data_length ||
+      entry->constant_count != executable_params->constant_count ||
+      !iree_string_view_equal(entry->executable_format,
+                              executable_params->executable_format)) {
+    return false;
+  }
+  iree_hal_local_executable_t* local_executable =
+      iree_hal_local_executable_cast(entry->executable);
+  if (local_executable->executable_layout_count !=
+      executable_params->executable_layout_count) {
+    return false;
+  }
+  for (iree_host_size_t i = 0; i < executable_params->executable_layout_count;
+       ++i) {
+    if (!iree_hal_local_executable_layout_equal(
+            (iree_hal_executable_layout_t*)
+                local_executable->executable_layouts[i],
+            executable_params->executable_layouts[i])) {
+      return false;
+    }
+  }
+  return memcmp(entry->constants, executable_params->constants,
+                entry->constant_count * sizeof(*entry->constants)) == 0 &&
+         memcmp(entry->executable_data.data,
+                executable_params->executable_data.data,
+                entry->executable_data.data_length) == 0;
+}
+
+// Evicts all entries in |storage| whose executables are no longer referenced
+// outside of the storage.
+static void iree_hal_local_executable_cache_storage_evict_unused(
+    iree_hal_local_executable_cache_storage_t* storage) {
+  iree_hal_local_executable_cache_entry_t** entry_ptr = &storage->entry_head;
+  while (*entry_ptr) {
+    iree_hal_local_executable_cache_entry_t* entry = *entry_ptr;
+    // New references can only be acquired through the storage (which we have
+    // locked) or from existing holders so a count of 1 can't change under us.
+    if (iree_atomic_ref_count_load(
+            &((iree_hal_resource_t*)entry->executable)->ref_count) == 1) {
+      *entry_ptr = entry->next;
+      iree_hal_local_executable_cache_entry_free(storage->host_allocator,
+                                                 entry);
+    } else {
+      entry_ptr = &entry->next;
+    }
+  }
+}
+
+// Allocates a new entry for |executable_params| that will share |executable|.
+// The entry is not yet inserted.
+static iree_status_t iree_hal_local_executable_cache_entry_allocate(
+    iree_allocator_t host_allocator, uint64_t hash,
+    iree_hal_executable_caching_mode_t caching_mode,
+    const iree_hal_executable_params_t* executable_params,
+    iree_hal_executable_t* executable,
+    iree_hal_local_executable_cache_entry_t** out_entry) {
+  *out_entry = NULL;
+  iree_hal_local_executable_cache_entry_t* entry = NULL;
+  const iree_host_size_t constants_size =
+      executable_params->constant_count * sizeof(*executable_params->constants);
+  const iree_host_size_t total_size =
+      iree_host_align(sizeof(*entry), iree_max_align_t) + constants_size +
+      executable_params->executable_data.data_length +
+      executable_params->executable_format.size;
+  IREE_RETURN_IF_ERROR(
+      iree_allocator_malloc(host_allocator, total_size, (void**)&entry));
+  uint8_t* ptr =
+      (uint8_t*)entry + iree_host_align(sizeof(*entry), iree_max_align_t);
+
+  entry->next = NULL;
+  entry->hash = hash;
+  entry->caching_mode = caching_mode;
+  entry->constant_count = executable_params->constant_count;
+  entry->constants = (const uint32_t*)ptr;
+  if (constants_size > 0) {
+    memcpy(ptr, executable_params->constants, constants_size);
+  }
+  ptr += constants_size;
+  entry->executable_data = iree_make_const_byte_span(
+      ptr, executable_params->executable_data.data_length);
+  if (executable_params->executable_data.data_length > 0) {
+    memcpy(ptr, executable_params->executable_data.data,
+           executable_params->executable_data.data_length);
+  }
+  ptr += executable_params->executable_data.data_length;
+  iree_string_view_append_to_buffer(executable_params->executable_format,
+                                    &entry->executable_format, (char*)ptr);
+  entry->executable = executable;
+  iree_hal_executable_retain(executable);
+
+  *out_entry = entry;
+  return iree_ok_status();
+}
+
+// Returns the caching mode used to key entries for |executable_params|.
+static iree_hal_executable_caching_mode_t
+iree_hal_local_executable_cache_entry_caching_mode(
+    const iree_hal_executable_params_t* executable_params) {
+  return executable_params->caching_mode &
+         ~IREE_HAL_LOCAL_EXECUTABLE_CACHE_IGNORED_CACHING_MODES;
+}
+
+// Returns a retained executable from |storage| matching |executable_params| or
+// NULL if none is present. Must be called with the storage mutex held.
+static iree_hal_executable_t* iree_hal_local_executable_cache_storage_lookup(
+    iree_hal_local_executable_cache_storage_t* storage, uint64_t hash,
+    const iree_hal_executable_params_t* executable_params) {
+  const iree_hal_executable_caching_mode_t caching_mode =
+      iree_hal_local_executable_cache_entry_caching_mode(executable_params);
+  for (iree_hal_local_executable_cache_entry_t* entry = storage->entry_head;
+       entry != NULL; entry = entry->next) {
+    if (iree_hal_local_executable_cache_entry_matches(
+            entry, hash, caching_mode, executable_params)) {
+      iree_hal_executable_retain(entry->executable);
+      return entry->executable;
+    }
+  }
+  return NULL;
+}
+
+// Inserts a new entry sharing |executable| loaded with |executable_params|.
+// Must be called with the storage mutex held.
+static iree_status_t iree_hal_local_executable_cache_storage_insert(
+    iree_hal_local_executable_cache_storage_t* storage, uint64_t hash,
+    const iree_hal_executable_params_t* executable_params,
+    iree_hal_executable_t* executable) {
+  iree_hal_local_executable_cache_entry_t* entry = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_local_executable_cache_entry_allocate(
+      storage->host_allocator, hash,
+      iree_hal_local_executable_cache_entry_caching_mode(executable_params),
+      executable_params, executable, &entry));
+  entry->next = storage->entry_head;
+  storage->entry_head = entry;
+  return iree_ok_status();
+}
+
+//===----------------------------------------------------------------------===//
+// iree_hal_local_executable_cache_t
+//===----------------------------------------------------------------------===//
 
 typedef struct iree_hal_local_executable_cache_t {
   iree_hal_resource_t resource;
   iree_allocator_t host_allocator;
   iree_string_view_t identifier;
+  iree_hal_local_executable_cache_storage_t* storage;
+  iree_hal_local_executable_cache_scheduler_t scheduler;
   iree_host_size_t loader_count;
   iree_hal_executable_loader_t* loaders[];
 } iree_hal_local_executable_cache_t;
@@ -30,7 +295,10 @@ static iree_hal_local_executable_cache_t* iree_hal_local_executable_cache_cast(
 
 iree_status_t iree_hal_local_executable_cache_create(
     iree_string_view_t identifier, iree_host_size_t loader_count,
-    iree_hal_executable_loader_t** loaders, iree_allocator_t host_allocator,
+    iree_hal_executable_loader_t** loaders,
+    iree_hal_local_executable_cache_storage_t* storage,
+    iree_hal_local_executable_cache_scheduler_t scheduler,
+    iree_allocator_t host_allocator,
     iree_hal_executable_cache_t** out_executable_cache) {
   IREE_ASSERT_ARGUMENT(!loader_count || loaders);
   IREE_ASSERT_ARGUMENT(out_executable_cache);
@@ -51,6 +319,9 @@ iree_status_t iree_hal_local_executable_cache_create(
     iree_string_view_append_to_buffer(
         identifier, &executable_cache->identifier,
         (char*)executable_cache + total_size - identifier.size);
+    executable_cache->storage = storage;
+    iree_hal_local_executable_cache_storage_retain(storage);
+    executable_cache->scheduler = scheduler;
 
     executable_cache->loader_count = loader_count;
     for (iree_host_size_t i = 0; i < executable_cache->loader_count; ++i) {
@@ -75,6 +346,7 @@ static void iree_hal_local_executable_cache_destroy(
   for (iree_host_size_t i = 0; i < executable_cache->loader_count; ++i) {
     iree_hal_executable_loader_release(executable_cache->loaders[i]);
   }
+  iree_hal_local_executable_cache_storage_release(executable_cache->storage);
   iree_allocator_free(host_allocator, executable_cache);
 
   IREE_TRACE_ZONE_END(z0);
@@ -95,12 +367,11 @@ static bool iree_hal_local_executable_cache_can_prepare_format(
   return false;
 }
 
-static iree_status_t iree_hal_local_executable_cache_prepare_executable(
-    iree_hal_executable_cache_t* base_executable_cache,
+// Loads a new executable with the first loader that supports it.
+static iree_status_t iree_hal_local_executable_cache_load_executable(
+    iree_hal_local_executable_cache_t* executable_cache,
     const iree_hal_executable_params_t* executable_params,
     iree_hal_executable_t** out_executable) {
-  iree_hal_local_executable_cache_t* executable_cache =
-      iree_hal_local_executable_cache_cast(base_executable_cache);
   for (iree_host_size_t i = 0; i < executable_cache->loader_count; ++i) {
     if (!iree_hal_executable_loader_query_support(
             executable_cache->loaders[i], executable_params->caching_mode,
@@ -129,6 +400,177 @@ static iree_status_t iree_hal_local_executable_cache_prepare_executable(
       executable_params->executable_format.data);
 }
 
+// Returns |executable_params| as used to load executables shared in storage.
+// The executable may outlive the caller so the data must not be aliased.
+static iree_hal_executable_params_t
+iree_hal_local_executable_cache_shared_params(
+    const iree_hal_executable_params_t* executable_params) {
+  iree_hal_executable_params_t shared_params = *executable_params;
+  shared_params.caching_mode &=
+      ~IREE_HAL_EXECUTABLE_CACHING_MODE_ALIAS_PROVIDED_DATA;
+  return shared_params;
+}
+
+static iree_status_t iree_hal_local_executable_cache_prepare_executable(
+    iree_hal_executable_cache_t* base_executable_cache,
+    const iree_hal_executable_params_t* executable_params,
+    iree_hal_executable_t** out_executable) {
+  iree_hal_local_executable_cache_t* executable_cache =
+      iree_hal_local_executable_cache_cast(base_executable_cache);
+  iree_hal_local_executable_cache_storage_t* storage =
+      executable_cache->storage;
+  if (!storage) {
+    return iree_hal_local_executable_cache_load_executable(
+        executable_cache, executable_params, out_executable);
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  const uint64_t hash = iree_hal_local_executable_cache_hash(executable_params);
+
+  iree_slim_mutex_lock(&storage->mutex);
+  iree_hal_local_executable_cache_storage_evict_unused(storage);
+
+  iree_hal_executable_t* executable =
+      iree_hal_local_executable_cache_storage_lookup(storage, hash,
+                                                     executable_params);
+  if (executable) {
+    *out_executable = executable;
+    iree_slim_mutex_unlock(&storage->mutex);
+    IREE_TRACE_ZONE_APPEND_TEXT(z0, "hit");
+    IREE_TRACE_ZONE_END(z0);
+    return iree_ok_status();
+  }
+  IREE_TRACE_ZONE_APPEND_TEXT(z0, "miss");
+
+  iree_hal_executable_params_t shared_params =
+      iree_hal_local_executable_cache_shared_params(executable_params);
+  iree_status_t status = iree_hal_local_executable_cache_load_executable(
+      executable_cache, &shared_params, &executable);
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_local_executable_cache_storage_insert(
+        storage, hash, executable_params, executable);
+  }
+  if (iree_status_is_ok(status)) {
+    *out_executable = executable;
+  } else {
+    iree_hal_executable_release(executable);
+  }
+
+  iree_slim_mutex_unlock(&storage->mutex);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// State shared by all loads in a batch issued to the cache scheduler.
+typedef struct iree_hal_local_executable_cache_batch_t {
+  iree_hal_local_executable_cache_t* executable_cache;
+  const iree_hal_executable_params_t* executable_params;
+  iree_hal_executable_t** out_executables;
+  // Indices into |executable_params| of the executables that must be loaded.
+  const iree_host_size_t* load_indices;
+} iree_hal_local_executable_cache_batch_t;
+
+// Loads the executable at |index| in the batch load list.
+// Each invocation writes only to its own output slot and may run concurrently
+// with all others in the same batch.
+static iree_status_t iree_hal_local_executable_cache_batch_load(
+    void* user_data, iree_host_size_t index) {
+  iree_hal_local_executable_cache_batch_t* batch =
+      (iree_hal_local_executable_cache_batch_t*)user_data;
+  const iree_host_size_t i = batch->load_indices[index];
+  iree_hal_executable_params_t executable_params =
+      batch->executable_cache->storage
+          ? iree_hal_local_executable_cache_shared_params(
+                &batch->executable_params[i])
+          : batch->executable_params[i];
+  return iree_hal_local_executable_cache_load_executable(
+      batch->executable_cache, &executable_params, &batch->out_executables[i]);
+}
+
+static iree_status_t iree_hal_local_executable_cache_prepare_executables(
+    iree_hal_executable_cache_t* base_executable_cache,
+    iree_host_size_t executable_count,
+    const iree_hal_executable_params_t* executable_params,
+    iree_hal_executable_t** out_executables) {
+  iree_hal_local_executable_cache_t* executable_cache =
+      iree_hal_local_executable_cache_cast(base_executable_cache);
+  if (!executable_cache->scheduler.run || executable_count == 1) {
+    // No concurrency available; load each executable in order.
+    iree_status_t status = iree_ok_status();
+    for (iree_host_size_t i = 0;
+         i < executable_count && iree_status_is_ok(status); ++i) {
+      status = iree_hal_local_executable_cache_prepare_executable(
+          base_executable_cache, &executable_params[i], &out_executables[i]);
+    }
+    return status;
+  }
+  iree_hal_local_executable_cache_storage_t* storage =
+      executable_cache->storage;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Scratch storage for the hashes of each executable and the list of those
+  // missing from storage that must be loaded.
+  uint64_t* hashes = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(
+              executable_cache->host_allocator,
+              executable_count * (sizeof(*hashes) + sizeof(iree_host_size_t)),
+              (void**)&hashes));
+  iree_host_size_t* load_indices =
+      (iree_host_size_t*)(hashes + executable_count);
+  iree_host_size_t load_count = 0;
+
+  // Resolve all executables already present in storage. The lock is held
+  // across the batch such that concurrent requests for the same executables
+  // wait for them to be loaded instead of loading duplicates.
+  if (storage) {
+    iree_slim_mutex_lock(&storage->mutex);
+    iree_hal_local_executable_cache_storage_evict_unused(storage);
+  }
+  for (iree_host_size_t i = 0; i < executable_count; ++i) {
+    if (storage) {
+      hashes[i] = iree_hal_local_executable_cache_hash(&executable_params[i]);
+      out_executables[i] = iree_hal_local_executable_cache_storage_lookup(
+          storage, hashes[i], &executable_params[i]);
+    }
+    if (!out_executables[i]) load_indices[load_count++] = i;
+  }
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)load_count);
+
+  // Load (and relocate) all missing executables concurrently.
+  iree_hal_local_executable_cache_batch_t batch = {
+      .executable_cache = executable_cache,
+      .executable_params = executable_params,
+      .out_executables = out_executables,
+      .load_indices = load_indices,
+  };
+  iree_status_t status = iree_ok_status();
+  if (load_count == 1) {
+    status = iree_hal_local_executable_cache_batch_load(&batch, 0);
+  } else if (load_count > 1) {
+    status = executable_cache->scheduler.run(
+        executable_cache->scheduler.self, load_count,
+        iree_hal_local_executable_cache_batch_load, &batch);
+  }
+
+  // Publish the newly loaded executables to storage for sharing. On failure
+  // the caller releases all executables in |out_executables|.
+  if (storage) {
+    for (iree_host_size_t i = 0; i < load_count && iree_status_is_ok(status);
+         ++i) {
+      const iree_host_size_t index = load_indices[i];
+      status = iree_hal_local_executable_cache_storage_insert(
+          storage, hashes[index], &executable_params[index],
+          out_executables[index]);
+    }
+    iree_slim_mutex_unlock(&storage->mutex);
+  }
+
+  iree_allocator_free(executable_cache->host_allocator, hashes);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 static const iree_hal_executable_cache_vtable_t
     iree_hal_local_executable_cache_vtable = {
         .destroy = iree_hal_local_executable_cache_destroy,
@@ -136,4 +578,6 @@ static const iree_hal_executable_cache_vtable_t
             iree_hal_local_executable_cache_can_prepare_format,
         .prepare_executable =
             iree_hal_local_executable_cache_prepare_executable,
+        .prepare_executables =
+            iree_hal_local_executable_cache_prepare_executables,
 };
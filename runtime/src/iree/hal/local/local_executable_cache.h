@@ -15,17 +15,86 @@
 extern "C" {
 #endif  // __cplusplus
 
+//===----------------------------------------------------------------------===//
+// iree_hal_local_executable_cache_scheduler_t
+//===----------------------------------------------------------------------===//
+
+// Work function invoked once per |index| in [0, count) by a scheduler.
+typedef iree_status_t(IREE_API_PTR* iree_hal_local_executable_cache_work_fn_t)(
+    void* user_data, iree_host_size_t index);
+
+// Interface used to load batches of executables concurrently.
+// This virtualizes some external host thread pool (such as a task executor)
+// and does not take ownership of the instance: callers must ensure that the
+// scheduler remains valid for the lifetime of the executable cache using it.
+typedef struct iree_hal_local_executable_cache_scheduler_t {
+  // User-defined pointer passed to all functions.
+  void* self;
+
+  // Invokes |work_fn| for each index in [0, count), potentially concurrently,
+  // and returns once all invocations have completed. Returns the failure of any
+  // invocation and pending invocations may be skipped once one has failed.
+  iree_status_t(IREE_API_PTR* run)(
+      void* self, iree_host_size_t count,
+      iree_hal_local_executable_cache_work_fn_t work_fn, void* user_data);
+} iree_hal_local_executable_cache_scheduler_t;
+
+// Returns a scheduler that does not schedule any work. Executable caches using
+// it load all executables serially on the calling thread.
+static inline iree_hal_local_executable_cache_scheduler_t
+iree_hal_local_executable_cache_scheduler_null(void) {
+  iree_hal_local_executable_cache_scheduler_t scheduler = {NULL, NULL};
+  return scheduler;
+}
+
+//===----------------------------------------------------------------------===//
+// iree_hal_local_executable_cache_storage_t
+//===----------------------------------------------------------------------===//
+
+// Storage shared by all executable caches created from a device that dedupes
+// identical executables across them. Executables are keyed by their format,
+// data, constants, caching mode, and the contents of their executable layouts
+// such that multiple contexts loading the same module share the loaded
+// executables instead of each loading (and relocating) their own.
+//
+// Storage retains each loaded executable and entries are evicted once the
+// storage holds the only remaining reference. Thread-safe.
+typedef struct iree_hal_local_executable_cache_storage_t
+    iree_hal_local_executable_cache_storage_t;
+
+// Creates executable cache storage. The storage is reference counted and
+// retained by each executable cache using it.
+iree_status_t iree_hal_local_executable_cache_storage_create(
+    iree_allocator_t host_allocator,
+    iree_hal_local_executable_cache_storage_t** out_storage);
+
+// Retains the given |storage| for the caller.
+void iree_hal_local_executable_cache_storage_retain(
+    iree_hal_local_executable_cache_storage_t* storage);
+
+// Releases the given |storage| from the caller.
+void iree_hal_local_executable_cache_storage_release(
+    iree_hal_local_executable_cache_storage_t* storage);
+
+//===----------------------------------------------------------------------===//
+// iree_hal_local_executable_cache_t
+//===----------------------------------------------------------------------===//
+
 // TODO(benvanik): when we refactor executable caches this can become something
 // more specialized; like nop_executable_cache (does nothing but pass through)
 // or inproc_lru_executable_cache (simple in-memory LRU of recent executables).
-//
-// We can also set this up so they share storage. Ideally a JIT'ed executable in
-// one device is the same JIT'ed executable in another, and in multi-tenant
-// situations we're likely to want that isolation _and_ sharing.
 
+// Creates an executable cache loading executables with |loaders|.
+// If |storage| is provided executables are shared with all other caches using
+// the same storage and otherwise each request loads a new executable.
+// If |scheduler| is provided batches of executables prepared with
+// iree_hal_executable_cache_prepare_executables are loaded concurrently.
 iree_status_t iree_hal_local_executable_cache_create(
     iree_string_view_t identifier, iree_host_size_t loader_count,
-    iree_hal_executable_loader_t** loaders, iree_allocator_t host_allocator,
+    iree_hal_executable_loader_t** loaders,
+    iree_hal_local_executable_cache_storage_t* storage,
+    iree_hal_local_executable_cache_scheduler_t scheduler,
+    iree_allocator_t host_allocator,
     iree_hal_executable_cache_t** out_executable_cache);
 
 #ifdef __cplusplus
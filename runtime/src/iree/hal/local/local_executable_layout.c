@@ -86,6 +86,39 @@ iree_status_t iree_hal_local_executable_layout_create(
   return status;
 }
 
+bool iree_hal_local_executable_layout_equal(iree_hal_executable_layout_t* lhs,
+                                            iree_hal_executable_layout_t* rhs) {
+  if (lhs == rhs) return true;
+  iree_hal_local_executable_layout_t* lhs_layout =
+      iree_hal_local_executable_layout_cast(lhs);
+  iree_hal_local_executable_layout_t* rhs_layout =
+      iree_hal_local_executable_layout_cast(rhs);
+  if (lhs_layout->push_constants != rhs_layout->push_constants ||
+      lhs_layout->set_layout_count != rhs_layout->set_layout_count) {
+    return false;
+  }
+  for (iree_host_size_t i = 0; i < lhs_layout->set_layout_count; ++i) {
+    if (lhs_layout->set_layouts[i] == rhs_layout->set_layouts[i]) continue;
+    iree_hal_local_descriptor_set_layout_t* lhs_set_layout =
+        iree_hal_local_descriptor_set_layout_cast(lhs_layout->set_layouts[i]);
+    iree_hal_local_descriptor_set_layout_t* rhs_set_layout =
+        iree_hal_local_descriptor_set_layout_cast(rhs_layout->set_layouts[i]);
+    if (lhs_set_layout->usage_type != rhs_set_layout->usage_type ||
+        lhs_set_layout->binding_count != rhs_set_layout->binding_count) {
+      return false;
+    }
+    for (iree_host_size_t j = 0; j < lhs_set_layout->binding_count; ++j) {
+      if (lhs_set_layout->bindings[j].binding !=
+              rhs_set_layout->bindings[j].binding ||
+          lhs_set_layout->bindings[j].type !=
+              rhs_set_layout->bindings[j].type) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 static void iree_hal_local_executable_layout_destroy(
     iree_hal_executable_layout_t* base_layout) {
   iree_hal_local_executable_layout_t* layout =
@@ -43,6 +43,11 @@ iree_status_t iree_hal_local_executable_layout_create(
 iree_hal_local_executable_layout_t* iree_hal_local_executable_layout_cast(
     iree_hal_executable_layout_t* base_value);
 
+// Returns true if |lhs| and |rhs| have the same push constants and descriptor
+// set layouts such that executables created with one can be used with either.
+bool iree_hal_local_executable_layout_equal(iree_hal_executable_layout_t* lhs,
+                                            iree_hal_executable_layout_t* rhs);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
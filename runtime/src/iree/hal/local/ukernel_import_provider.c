@@ -0,0 +1,29 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/local/ukernel_import_provider.h"
+
+#include "iree/builtins/ukernel/api.h"
+
+static iree_status_t iree_hal_ukernel_import_provider_resolve(
+    void* self, iree_string_view_t symbol_name, void** out_fn_ptr) {
+  iree_uk_fn_t fn = iree_uk_lookup(symbol_name);
+  if (!fn) {
+    return iree_make_status(IREE_STATUS_NOT_FOUND,
+                            "no ukernel named '%.*s' in this runtime",
+                            (int)symbol_name.size, symbol_name.data);
+  }
+  *out_fn_ptr = (void*)fn;
+  return iree_ok_status();
+}
+
+iree_hal_executable_import_provider_t iree_hal_ukernel_import_provider(void) {
+  iree_hal_executable_import_provider_t provider = {
+      /*self=*/NULL,
+      iree_hal_ukernel_import_provider_resolve,
+  };
+  return provider;
+}
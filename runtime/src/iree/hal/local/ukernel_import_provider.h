@@ -0,0 +1,26 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_LOCAL_UKERNEL_IMPORT_PROVIDER_H_
+#define IREE_HAL_LOCAL_UKERNEL_IMPORT_PROVIDER_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/local/executable_loader.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Returns an import provider that resolves the runtime ukernels declared in
+// iree/builtins/ukernel/api.h (`iree_uk_*`) for use by executables.
+// The provider is stateless and valid for the lifetime of the process.
+iree_hal_executable_import_provider_t iree_hal_ukernel_import_provider(void);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_LOCAL_UKERNEL_IMPORT_PROVIDER_H_
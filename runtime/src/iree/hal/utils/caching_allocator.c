@@ -0,0 +1,365 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/caching_allocator.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/math.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/resource.h"
+
+// One bucket per power-of-two size class.
+#define IREE_HAL_CACHING_ALLOCATOR_BUCKET_COUNT 64
+
+void iree_hal_caching_allocator_options_initialize(
+    iree_hal_caching_allocator_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->min_allocation_size = 256;
+  out_options->max_allocation_size = 64 * 1024 * 1024;
+  out_options->max_cached_size = 256 * 1024 * 1024;
+}
+
+// An unused buffer retained by the cache.
+typedef struct iree_hal_caching_allocator_entry_t {
+  struct iree_hal_caching_allocator_entry_t* next;
+  iree_hal_buffer_t* buffer;
+} iree_hal_caching_allocator_entry_t;
+
+typedef struct iree_hal_caching_allocator_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  iree_hal_allocator_t* base_allocator;
+  iree_hal_caching_allocator_options_t options;
+
+  iree_slim_mutex_t mutex;
+  // Total size of all buffers in the buckets.
+  iree_device_size_t cached_size;
+  // Unused buffers in most-recently-released order by size class.
+  iree_hal_caching_allocator_entry_t*
+      buckets[IREE_HAL_CACHING_ALLOCATOR_BUCKET_COUNT];
+  // Entries that are not in use by any bucket; recycled to avoid host
+  // allocations on every buffer release.
+  iree_hal_caching_allocator_entry_t* free_entries;
+} iree_hal_caching_allocator_t;
+
+static const iree_hal_allocator_vtable_t iree_hal_caching_allocator_vtable;
+
+static iree_hal_caching_allocator_t* iree_hal_caching_allocator_cast(
+    iree_hal_allocator_t* IREE_RESTRICT base_value) {
+  return (iree_hal_caching_allocator_t*)base_value;
+}
+
+iree_status_t iree_hal_caching_allocator_create(
+    const iree_hal_caching_allocator_options_t* options,
+    iree_hal_allocator_t* base_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(base_allocator);
+  IREE_ASSERT_ARGUMENT(out_allocator);
+  *out_allocator = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_caching_allocator_t* allocator = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*allocator),
+                                (void**)&allocator));
+  memset(allocator, 0, sizeof(*allocator));
+  iree_hal_resource_initialize(&iree_hal_caching_allocator_vtable,
+                               &allocator->resource);
+  allocator->host_allocator = host_allocator;
+  allocator->base_allocator = base_allocator;
+  iree_hal_allocator_retain(base_allocator);
+  allocator->options = *options;
+  allocator->options.min_allocation_size =
+      iree_max(1, allocator->options.min_allocation_size);
+  iree_slim_mutex_initialize(&allocator->mutex);
+
+  *out_allocator = (iree_hal_allocator_t*)allocator;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+// Returns a buffer that was retained by the cache to the base allocator.
+static void iree_hal_caching_allocator_free_buffer(
+    iree_hal_caching_allocator_t* allocator, iree_hal_buffer_t* buffer) {
+  buffer->device_allocator = allocator->base_allocator;
+  iree_hal_allocator_deallocate_buffer(allocator->base_allocator, buffer);
+}
+
+// Returns all unused buffers and entries to their allocators.
+static void iree_hal_caching_allocator_flush(
+    iree_hal_caching_allocator_t* allocator) {
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_hal_caching_allocator_entry_t* entries = allocator->free_entries;
+  allocator->free_entries = NULL;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(allocator->buckets); ++i) {
+    iree_hal_caching_allocator_entry_t* entry = allocator->buckets[i];
+    while (entry) {
+      iree_hal_caching_allocator_entry_t* next = entry->next;
+      entry->next = entries;
+      entries = entry;
+      entry = next;
+    }
+    allocator->buckets[i] = NULL;
+  }
+  allocator->cached_size = 0;
+  iree_slim_mutex_unlock(&allocator->mutex);
+
+  // Freed outside of the lock as base allocators may be slow to free.
+  while (entries) {
+    iree_hal_caching_allocator_entry_t* next = entries->next;
+    if (entries->buffer) {
+      iree_hal_caching_allocator_free_buffer(allocator, entries->buffer);
+    }
+    iree_allocator_free(allocator->host_allocator, entries);
+    entries = next;
+  }
+}
+
+static void iree_hal_caching_allocator_destroy(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+  iree_allocator_t host_allocator = allocator->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_caching_allocator_flush(allocator);
+  iree_slim_mutex_deinitialize(&allocator->mutex);
+  iree_hal_allocator_release(allocator->base_allocator);
+  iree_allocator_free(host_allocator, allocator);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_allocator_t iree_hal_caching_allocator_host_allocator(
+    const iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_caching_allocator_t* allocator =
+      (iree_hal_caching_allocator_t*)base_allocator;
+  return allocator->host_allocator;
+}
+
+static iree_status_t iree_hal_caching_allocator_trim(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_caching_allocator_flush(allocator);
+  iree_status_t status = iree_hal_allocator_trim(allocator->base_allocator);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static void iree_hal_caching_allocator_query_statistics(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_allocator_statistics_t* IREE_RESTRICT out_statistics) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+  iree_hal_allocator_query_statistics(allocator->base_allocator,
+                                      out_statistics);
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_caching_allocator_query_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_compatibility(allocator->base_allocator,
+                                                *params, allocation_size);
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_caching_allocator_query_buffer_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_buffer_usage_t intended_usage) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_buffer_compatibility(
+      allocator->base_allocator, buffer, intended_usage);
+}
+
+// Returns true if the unused |buffer| can satisfy an allocation with |params|.
+static bool iree_hal_caching_allocator_is_compatible(
+    iree_hal_buffer_t* buffer, const iree_hal_buffer_params_t* params) {
+  // The optimal bit only guides allocation and is not retained by buffers.
+  iree_hal_memory_type_t memory_type =
+      params->type & ~IREE_HAL_MEMORY_TYPE_OPTIMAL;
+  return iree_all_bits_set(iree_hal_buffer_memory_type(buffer), memory_type) &&
+         iree_all_bits_set(iree_hal_buffer_allowed_usage(buffer),
+                           params->usage) &&
+         iree_all_bits_set(iree_hal_buffer_allowed_access(buffer),
+                           params->access);
+}
+
+// Returns the bucket index of allocations of |allocation_size| and the size of
+// the buffers in the bucket in |out_bucket_size|.
+static iree_host_size_t iree_hal_caching_allocator_select_bucket(
+    iree_hal_caching_allocator_t* allocator,
+    iree_device_size_t allocation_size, iree_device_size_t* out_bucket_size) {
+  uint64_t bucket_size = iree_math_round_up_to_pow2_u64(
+      iree_max(allocation_size, allocator->options.min_allocation_size));
+  *out_bucket_size = (iree_device_size_t)bucket_size;
+  return (iree_host_size_t)iree_math_count_trailing_zeros_u64(bucket_size);
+}
+
+static iree_status_t iree_hal_caching_allocator_allocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size, iree_const_byte_span_t initial_data,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+
+  // Allocations that are not cached are made directly from the base allocator
+  // and are returned to it when released.
+  if (!iree_const_byte_span_is_empty(initial_data) || allocation_size == 0 ||
+      allocation_size > allocator->options.max_allocation_size) {
+    return iree_hal_allocator_allocate_buffer(
+        allocator->base_allocator, *params, allocation_size, initial_data,
+        out_buffer);
+  }
+
+  iree_device_size_t bucket_size = 0;
+  iree_host_size_t bucket_index = iree_hal_caching_allocator_select_bucket(
+      allocator, allocation_size, &bucket_size);
+
+  // Reuse the most recently released compatible buffer in the bucket.
+  iree_hal_caching_allocator_entry_t* entry = NULL;
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_hal_caching_allocator_entry_t** entry_ptr =
+      &allocator->buckets[bucket_index];
+  while (*entry_ptr) {
+    if (iree_hal_caching_allocator_is_compatible((*entry_ptr)->buffer,
+                                                 params)) {
+      entry = *entry_ptr;
+      *entry_ptr = entry->next;
+      allocator->cached_size -= bucket_size;
+      break;
+    }
+    entry_ptr = &(*entry_ptr)->next;
+  }
+  iree_hal_buffer_t* buffer = NULL;
+  if (entry) {
+    buffer = entry->buffer;
+    entry->buffer = NULL;
+    entry->next = allocator->free_entries;
+    allocator->free_entries = entry;
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+
+  if (buffer) {
+    IREE_TRACE_ZONE_BEGIN_NAMED(z0, "iree_hal_caching_allocator_reuse");
+    // The buffer was released with no remaining references and is now owned
+    // by the caller. Its contents are undefined.
+    iree_atomic_ref_count_init(&buffer->resource.ref_count);
+    buffer->byte_length = allocation_size;
+    *out_buffer = buffer;
+    IREE_TRACE_ZONE_END(z0);
+    return iree_ok_status();
+  }
+
+  // Allocate a new buffer of the full bucket size so that it can be reused by
+  // any allocation in the bucket.
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
+      allocator->base_allocator, *params, bucket_size, initial_data, &buffer));
+  if (iree_hal_buffer_allocated_buffer(buffer) != buffer ||
+      iree_hal_buffer_byte_length(buffer) != bucket_size) {
+    // Base allocators returning views of other allocations cannot be cached
+    // as the allocations are not owned by the buffer.
+    *out_buffer = buffer;
+    return iree_ok_status();
+  }
+
+  // Route releases of the buffer back to the cache; see
+  // iree_hal_buffer_recycle.
+  buffer->device_allocator = base_allocator;
+  buffer->byte_length = allocation_size;
+  *out_buffer = buffer;
+  return iree_ok_status();
+}
+
+static void iree_hal_caching_allocator_deallocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+
+  iree_device_size_t bucket_size = 0;
+  iree_host_size_t bucket_index = iree_hal_caching_allocator_select_bucket(
+      allocator, iree_hal_buffer_allocation_size(buffer), &bucket_size);
+
+  iree_slim_mutex_lock(&allocator->mutex);
+  bool cache_buffer =
+      allocator->cached_size + bucket_size <= allocator->options.max_cached_size;
+  iree_hal_caching_allocator_entry_t* entry = NULL;
+  if (cache_buffer) {
+    entry = allocator->free_entries;
+    if (entry) allocator->free_entries = entry->next;
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+
+  if (cache_buffer && !entry) {
+    cache_buffer = iree_status_is_ok(
+        iree_allocator_malloc(allocator->host_allocator, sizeof(*entry),
+                              (void**)&entry));
+  }
+  if (!cache_buffer) {
+    iree_hal_caching_allocator_free_buffer(allocator, buffer);
+    return;
+  }
+
+  iree_slim_mutex_lock(&allocator->mutex);
+  entry->buffer = buffer;
+  entry->next = allocator->buckets[bucket_index];
+  allocator->buckets[bucket_index] = entry;
+  allocator->cached_size += bucket_size;
+  iree_slim_mutex_unlock(&allocator->mutex);
+}
+
+static iree_status_t iree_hal_caching_allocator_import_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_hal_external_buffer_t* IREE_RESTRICT external_buffer,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+  return iree_hal_allocator_import_buffer(allocator->base_allocator, *params,
+                                          external_buffer, release_callback,
+                                          out_buffer);
+}
+
+static iree_status_t iree_hal_caching_allocator_export_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_external_buffer_type_t requested_type,
+    iree_hal_external_buffer_flags_t requested_flags,
+    iree_hal_external_buffer_t* IREE_RESTRICT out_external_buffer) {
+  iree_hal_caching_allocator_t* allocator =
+      iree_hal_caching_allocator_cast(base_allocator);
+  return iree_hal_allocator_export_buffer(allocator->base_allocator, buffer,
+                                          requested_type, requested_flags,
+                                          out_external_buffer);
+}
+
+static const iree_hal_allocator_vtable_t iree_hal_caching_allocator_vtable = {
+    .destroy = iree_hal_caching_allocator_destroy,
+    .host_allocator = iree_hal_caching_allocator_host_allocator,
+    .trim = iree_hal_caching_allocator_trim,
+    .query_statistics = iree_hal_caching_allocator_query_statistics,
+    .query_compatibility = iree_hal_caching_allocator_query_compatibility,
+    .allocate_buffer = iree_hal_caching_allocator_allocate_buffer,
+    .deallocate_buffer = iree_hal_caching_allocator_deallocate_buffer,
+    .import_buffer = iree_hal_caching_allocator_import_buffer,
+    .export_buffer = iree_hal_caching_allocator_export_buffer,
+    .query_buffer_compatibility =
+        iree_hal_caching_allocator_query_buffer_compatibility,
+};
@@ -0,0 +1,63 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_CACHING_ALLOCATOR_H_
+#define IREE_HAL_UTILS_CACHING_ALLOCATOR_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_caching_allocator_t
+//===----------------------------------------------------------------------===//
+
+// Parameters controlling which allocations are cached and for how long.
+typedef struct iree_hal_caching_allocator_options_t {
+  // Allocations are rounded up to a power of two no smaller than this size so
+  // that buffers can be reused by allocations of similar sizes.
+  iree_device_size_t min_allocation_size;
+  // Allocations larger than this size bypass the cache and are always made
+  // from and returned to the base allocator.
+  iree_device_size_t max_allocation_size;
+  // Maximum total size of unused buffers retained by the cache. Buffers
+  // released while the cache is full are returned to the base allocator.
+  iree_device_size_t max_cached_size;
+} iree_hal_caching_allocator_options_t;
+
+// Initializes |out_options| to their default values.
+void iree_hal_caching_allocator_options_initialize(
+    iree_hal_caching_allocator_options_t* out_options);
+
+// Creates an allocator that caches buffers allocated from |base_allocator| and
+// reuses them for later allocations without round-tripping through the base
+// allocator. Buffers are bucketed by power-of-two size class and reused for
+// any allocation whose memory type, usage, and access they satisfy.
+//
+// Allocations with initial data are not cached as they are usually long-lived
+// constants. All other operations are forwarded to |base_allocator|:
+// trimming the caching allocator returns all unused buffers to the base
+// allocator and then trims it, and statistics are those of the base allocator
+// such that they reflect the memory actually allocated including unused
+// cached buffers.
+//
+// Buffers allocated from the caching allocator must be released before it is
+// destroyed, as is required for all allocators.
+//
+// Thread-safe; multiple threads may allocate and release concurrently.
+iree_status_t iree_hal_caching_allocator_create(
+    const iree_hal_caching_allocator_options_t* options,
+    iree_hal_allocator_t* base_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_CACHING_ALLOCATOR_H_
@@ -0,0 +1,189 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/caching_allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+struct CachingAllocatorTest : public ::testing::Test {
+  iree_allocator_t host_allocator = iree_allocator_system();
+  iree_hal_allocator_t* base_allocator = NULL;
+  iree_hal_allocator_t* allocator = NULL;
+
+  void SetUp() override {
+    IREE_ASSERT_OK(iree_hal_allocator_create_heap(
+        iree_make_cstring_view("heap"), host_allocator, host_allocator,
+        &base_allocator));
+    iree_hal_caching_allocator_options_t options;
+    iree_hal_caching_allocator_options_initialize(&options);
+    options.min_allocation_size = 64;
+    options.max_allocation_size = 4096;
+    options.max_cached_size = 8192;
+    IREE_ASSERT_OK(iree_hal_caching_allocator_create(
+        &options, base_allocator, host_allocator, &allocator));
+  }
+
+  void TearDown() override {
+    iree_hal_allocator_release(allocator);
+    iree_hal_allocator_release(base_allocator);
+  }
+
+  iree_hal_buffer_params_t MakeParams(iree_hal_memory_type_t type) {
+    iree_hal_buffer_params_t params = {0};
+    params.type = type;
+    params.usage =
+        IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+    return params;
+  }
+
+  iree_hal_buffer_t* Allocate(iree_device_size_t allocation_size,
+                              iree_hal_memory_type_t type =
+                                  IREE_HAL_MEMORY_TYPE_HOST_LOCAL |
+                                  IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE) {
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_CHECK_OK(iree_hal_allocator_allocate_buffer(
+        allocator, MakeParams(type), allocation_size,
+        iree_const_byte_span_empty(), &buffer));
+    return buffer;
+  }
+};
+
+// Tests that released buffers are reused by allocations in the same size class.
+TEST_F(CachingAllocatorTest, ReuseSizeClass) {
+  iree_hal_buffer_t* buffer0 = Allocate(100);
+  EXPECT_EQ(iree_hal_buffer_byte_length(buffer0), 100);
+  EXPECT_EQ(iree_hal_buffer_allocation_size(buffer0), 128);
+  iree_hal_buffer_release(buffer0);
+
+  iree_hal_buffer_t* buffer1 = Allocate(120);
+  EXPECT_EQ(buffer0, buffer1);
+  EXPECT_EQ(iree_hal_buffer_byte_length(buffer1), 120);
+
+  // A buffer of a different size class is a different allocation.
+  iree_hal_buffer_t* buffer2 = Allocate(200);
+  EXPECT_NE(buffer1, buffer2);
+  iree_hal_buffer_release(buffer1);
+  iree_hal_buffer_release(buffer2);
+
+  // Small allocations share the minimum size class.
+  iree_hal_buffer_t* buffer3 = Allocate(1);
+  EXPECT_EQ(iree_hal_buffer_allocation_size(buffer3), 64);
+  iree_hal_buffer_release(buffer3);
+}
+
+// Tests that reused buffers are mappable over their new length.
+TEST_F(CachingAllocatorTest, ReuseContents) {
+  iree_hal_buffer_t* buffer0 = Allocate(128);
+  uint32_t pattern = 0xCAFEF00Du;
+  IREE_ASSERT_OK(iree_hal_buffer_map_fill(buffer0, 0, 128, &pattern,
+                                          sizeof(pattern)));
+  iree_hal_buffer_release(buffer0);
+
+  iree_hal_buffer_t* buffer1 = Allocate(64 + 4);
+  ASSERT_EQ(buffer0, buffer1);
+  uint32_t value = 0;
+  IREE_ASSERT_OK(iree_hal_buffer_map_read(buffer1, 64, &value, sizeof(value)));
+  EXPECT_EQ(value, pattern);
+  EXPECT_THAT(Status(iree_hal_buffer_map_read(buffer1, 96, &value,
+                                              sizeof(value))),
+              StatusIs(StatusCode::kOutOfRange));
+  iree_hal_buffer_release(buffer1);
+}
+
+// Tests that buffers are only reused for compatible allocations.
+TEST_F(CachingAllocatorTest, MemoryTypeMismatch) {
+  iree_hal_buffer_t* buffer0 = Allocate(128, IREE_HAL_MEMORY_TYPE_HOST_LOCAL);
+  iree_hal_buffer_release(buffer0);
+
+  // The host-local buffer is not device visible.
+  iree_hal_buffer_t* buffer1 =
+      Allocate(128, IREE_HAL_MEMORY_TYPE_HOST_LOCAL |
+                        IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE);
+  EXPECT_NE(buffer0, buffer1);
+  iree_hal_buffer_release(buffer1);
+
+  // Both cached buffers satisfy host-local allocations.
+  iree_hal_buffer_t* buffer2 = Allocate(128, IREE_HAL_MEMORY_TYPE_HOST_LOCAL);
+  EXPECT_EQ(buffer1, buffer2);
+  iree_hal_buffer_t* buffer3 = Allocate(128, IREE_HAL_MEMORY_TYPE_HOST_LOCAL);
+  EXPECT_EQ(buffer0, buffer3);
+  iree_hal_buffer_release(buffer2);
+  iree_hal_buffer_release(buffer3);
+}
+
+// Tests that large allocations and allocations with initial data bypass the
+// cache.
+TEST_F(CachingAllocatorTest, Uncached) {
+  iree_hal_buffer_t* large_buffer = Allocate(8192);
+  EXPECT_EQ(iree_hal_buffer_allocation_size(large_buffer), 8192);
+  iree_hal_buffer_release(large_buffer);
+  iree_hal_buffer_t* large_buffer2 = Allocate(8192);
+  iree_hal_buffer_release(large_buffer2);
+
+  uint8_t initial_data[100] = {0};
+  iree_hal_buffer_t* data_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      allocator,
+      MakeParams(IREE_HAL_MEMORY_TYPE_HOST_LOCAL |
+                 IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE),
+      sizeof(initial_data),
+      iree_make_const_byte_span(initial_data, sizeof(initial_data)),
+      &data_buffer));
+  EXPECT_EQ(iree_hal_buffer_allocation_size(data_buffer), sizeof(initial_data));
+  iree_hal_buffer_release(data_buffer);
+
+#if IREE_STATISTICS_ENABLE
+  // Nothing was retained by the cache.
+  iree_hal_allocator_statistics_t statistics;
+  iree_hal_allocator_query_statistics(allocator, &statistics);
+  EXPECT_EQ(statistics.host_bytes_allocated, statistics.host_bytes_freed);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
+// Tests that the cache retains no more than its limit and that trimming
+// returns all unused buffers to the base allocator.
+TEST_F(CachingAllocatorTest, LimitAndTrim) {
+  iree_hal_buffer_t* buffers[3] = {
+      Allocate(4096),
+      Allocate(4096),
+      Allocate(4096),
+  };
+  for (iree_hal_buffer_t* buffer : buffers) iree_hal_buffer_release(buffer);
+
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_statistics_t statistics;
+  iree_hal_allocator_query_statistics(allocator, &statistics);
+  EXPECT_EQ(statistics.host_bytes_allocated - statistics.host_bytes_freed,
+            8192);
+#endif  // IREE_STATISTICS_ENABLE
+
+  IREE_ASSERT_OK(iree_hal_allocator_trim(allocator));
+
+#if IREE_STATISTICS_ENABLE
+  iree_hal_allocator_query_statistics(allocator, &statistics);
+  EXPECT_EQ(statistics.host_bytes_allocated, statistics.host_bytes_freed);
+#endif  // IREE_STATISTICS_ENABLE
+
+  // Allocation still works after trimming.
+  iree_hal_buffer_t* buffer = Allocate(4096);
+  iree_hal_buffer_release(buffer);
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
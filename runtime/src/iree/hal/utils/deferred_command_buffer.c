@@ -33,11 +33,12 @@ typedef enum iree_hal_command_type_e {
 // Header prefixed to all commands, forming a linked-list.
 //
 // Each command is allocated from the arena and does *not* retain any resources.
-// We could elide some of these commands by keeping local state however that
-// requires knowing more about the target device (executable layouts, etc) and
-// prevents using this as a way to debug or benchmark command buffers. The
-// intent is that each command captures the exact information passed during the
-// call such that the target command buffer cannot tell they were deferred.
+// Each command captures the exact information passed during the call. When
+// IREE_HAL_DEFERRED_COMMAND_BUFFER_OPTIMIZATION_ENABLE is set the list is
+// optimized once recording ends (see iree_hal_cmd_list_optimize) by removing
+// or merging commands such that the target command buffer observes the same
+// results with fewer commands; otherwise the target command buffer cannot tell
+// the commands were deferred.
 //
 // As each command is variable sized we store pointers to the following command
 // to allow us to walk the list during replay. Storing just a size would be
@@ -52,6 +53,7 @@ typedef struct iree_hal_cmd_header_t {
 
 typedef iree_status_t (*iree_hal_cmd_apply_fn_t)(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     iree_hal_cmd_header_t* cmd_header);
 
 //===----------------------------------------------------------------------===//
@@ -161,7 +163,8 @@ iree_hal_deferred_command_buffer_cast(iree_hal_command_buffer_t* base_value) {
 IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_create(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_arena_block_pool_t* block_pool, iree_allocator_t host_allocator,
+    iree_host_size_t binding_capacity, iree_arena_block_pool_t* block_pool,
+    iree_allocator_t host_allocator,
     iree_hal_command_buffer_t** out_command_buffer) {
   IREE_ASSERT_ARGUMENT(block_pool);
   IREE_ASSERT_ARGUMENT(out_command_buffer);
@@ -174,7 +177,8 @@ IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_create(
   if (iree_status_is_ok(status)) {
     iree_hal_command_buffer_initialize(
         device, mode, command_categories, IREE_HAL_QUEUE_AFFINITY_ANY,
-        &iree_hal_deferred_command_buffer_vtable, &command_buffer->base);
+        binding_capacity, &iree_hal_deferred_command_buffer_vtable,
+        &command_buffer->base);
     command_buffer->host_allocator = host_allocator;
     iree_hal_cmd_list_initialize(block_pool, &command_buffer->cmd_list);
 
@@ -225,8 +229,15 @@ static iree_status_t iree_hal_deferred_command_buffer_begin(
   return iree_ok_status();
 }
 
+static void iree_hal_cmd_list_optimize(iree_hal_cmd_list_t* cmd_list);
+
 static iree_status_t iree_hal_deferred_command_buffer_end(
     iree_hal_command_buffer_t* base_command_buffer) {
+#if IREE_HAL_DEFERRED_COMMAND_BUFFER_OPTIMIZATION_ENABLE
+  iree_hal_deferred_command_buffer_t* command_buffer =
+      iree_hal_deferred_command_buffer_cast(base_command_buffer);
+  iree_hal_cmd_list_optimize(&command_buffer->cmd_list);
+#endif  // IREE_HAL_DEFERRED_COMMAND_BUFFER_OPTIMIZATION_ENABLE
   return iree_ok_status();
 }
 
@@ -283,6 +294,7 @@ static iree_status_t iree_hal_deferred_command_buffer_execution_barrier(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_execution_barrier(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_execution_barrier_t* cmd) {
   return iree_hal_command_buffer_execution_barrier(
       target_command_buffer, cmd->source_stage_mask, cmd->target_stage_mask,
@@ -318,6 +330,7 @@ static iree_status_t iree_hal_deferred_command_buffer_signal_event(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_signal_event(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_signal_event_t* cmd) {
   return iree_hal_command_buffer_signal_event(target_command_buffer, cmd->event,
                                               cmd->source_stage_mask);
@@ -351,6 +364,7 @@ static iree_status_t iree_hal_deferred_command_buffer_reset_event(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_reset_event(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_reset_event_t* cmd) {
   return iree_hal_command_buffer_reset_event(target_command_buffer, cmd->event,
                                              cmd->source_stage_mask);
@@ -415,6 +429,7 @@ static iree_status_t iree_hal_deferred_command_buffer_wait_events(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_wait_events(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_wait_events_t* cmd) {
   return iree_hal_command_buffer_wait_events(
       target_command_buffer, cmd->event_count,
@@ -448,6 +463,7 @@ static iree_status_t iree_hal_deferred_command_buffer_discard_buffer(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_discard_buffer(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_discard_buffer_t* cmd) {
   return iree_hal_command_buffer_discard_buffer(target_command_buffer,
                                                 cmd->buffer);
@@ -493,6 +509,7 @@ static iree_status_t iree_hal_deferred_command_buffer_fill_buffer(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_fill_buffer(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_fill_buffer_t* cmd) {
   return iree_hal_command_buffer_fill_buffer(
       target_command_buffer, cmd->target_buffer, cmd->target_offset,
@@ -534,6 +551,7 @@ static iree_status_t iree_hal_deferred_command_buffer_update_buffer(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_update_buffer(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_update_buffer_t* cmd) {
   return iree_hal_command_buffer_update_buffer(
       target_command_buffer, cmd->source_buffer, 0, cmd->target_buffer,
@@ -577,6 +595,7 @@ static iree_status_t iree_hal_deferred_command_buffer_copy_buffer(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_copy_buffer(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_copy_buffer_t* cmd) {
   return iree_hal_command_buffer_copy_buffer(
       target_command_buffer, cmd->source_buffer, cmd->source_offset,
@@ -617,6 +636,7 @@ static iree_status_t iree_hal_deferred_command_buffer_push_constants(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_push_constants(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_push_constants_t* cmd) {
   return iree_hal_command_buffer_push_constants(
       target_command_buffer, cmd->executable_layout, cmd->offset, cmd->values,
@@ -645,10 +665,11 @@ static iree_status_t iree_hal_deferred_command_buffer_push_descriptor_set(
   iree_hal_cmd_list_t* cmd_list = &command_buffer->cmd_list;
   IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
       command_buffer->resource_set, 1, &executable_layout));
-  for (iree_host_size_t i = 0; i < binding_count; ++i) {
-    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert(
-        command_buffer->resource_set, 1, &bindings[i].buffer));
-  }
+  // Bindings referencing binding table slots have no buffer and are resolved
+  // during replay.
+  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert_strided(
+      command_buffer->resource_set, binding_count, &bindings[0].buffer,
+      sizeof(bindings[0])));
   iree_hal_cmd_push_descriptor_set_t* cmd = NULL;
   IREE_RETURN_IF_ERROR(iree_hal_cmd_list_append_command(
       cmd_list, IREE_HAL_CMD_PUSH_DESCRIPTOR_SET,
@@ -662,10 +683,25 @@ static iree_status_t iree_hal_deferred_command_buffer_push_descriptor_set(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_push_descriptor_set(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_push_descriptor_set_t* cmd) {
+  if (iree_hal_buffer_binding_table_is_empty(binding_table)) {
+    return iree_hal_command_buffer_push_descriptor_set(
+        target_command_buffer, cmd->executable_layout, cmd->set,
+        cmd->binding_count, cmd->bindings);
+  }
+
+  // Resolve any binding table slots to the buffers provided for this replay.
+  iree_hal_descriptor_set_binding_t* bindings =
+      (iree_hal_descriptor_set_binding_t*)iree_alloca(
+          cmd->binding_count * sizeof(iree_hal_descriptor_set_binding_t));
+  for (iree_host_size_t i = 0; i < cmd->binding_count; ++i) {
+    IREE_RETURN_IF_ERROR(iree_hal_buffer_binding_table_resolve(
+        binding_table, &cmd->bindings[i], &bindings[i]));
+  }
   return iree_hal_command_buffer_push_descriptor_set(
       target_command_buffer, cmd->executable_layout, cmd->set,
-      cmd->binding_count, cmd->bindings);
+      cmd->binding_count, bindings);
 }
 
 //===----------------------------------------------------------------------===//
@@ -709,6 +745,7 @@ static iree_status_t iree_hal_deferred_command_buffer_bind_descriptor_set(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_bind_descriptor_set(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_bind_descriptor_set_t* cmd) {
   return iree_hal_command_buffer_bind_descriptor_set(
       target_command_buffer, cmd->executable_layout, cmd->set,
@@ -750,6 +787,7 @@ static iree_status_t iree_hal_deferred_command_buffer_dispatch(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_dispatch(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_dispatch_t* cmd) {
   return iree_hal_command_buffer_dispatch(
       target_command_buffer, cmd->executable, cmd->entry_point,
@@ -791,12 +829,347 @@ static iree_status_t iree_hal_deferred_command_buffer_dispatch_indirect(
 
 static iree_status_t iree_hal_deferred_command_buffer_apply_dispatch_indirect(
     iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table,
     const iree_hal_cmd_dispatch_indirect_t* cmd) {
   return iree_hal_command_buffer_dispatch_indirect(
       target_command_buffer, cmd->executable, cmd->entry_point,
       cmd->workgroups_buffer, cmd->workgroups_offset);
 }
 
+//===----------------------------------------------------------------------===//
+// Command list optimization
+//===----------------------------------------------------------------------===//
+// A single forward pass over the recorded commands performed when recording
+// ends. Everything here is conservative: when in doubt (unknown descriptor set
+// contents, binding table slots that may alias, etc) commands are kept as-is.
+//
+// * push_constants and push_descriptor_set commands identical to the state
+//   already pushed are dropped.
+// * Copies and fills that continue the immediately preceding copy or fill are
+//   merged into it.
+// * Execution barriers separating dispatches that touch disjoint buffer
+//   ranges are dropped so that the dispatches may run concurrently. Only
+//   segments consisting solely of dispatches and state changes are considered.
+
+// Maximum number of descriptor sets whose push state is tracked. Commands
+// using sets beyond this are kept and disable barrier elision.
+#define IREE_HAL_CMD_OPTIMIZE_MAX_SET_COUNT 4
+
+// Maximum number of buffer ranges tracked for a segment of dispatches between
+// barriers. Segments touching more ranges conservatively retain their barriers.
+#define IREE_HAL_CMD_OPTIMIZE_MAX_RANGE_COUNT 64
+
+// A buffer range accessed by the dispatches of a segment.
+typedef struct iree_hal_cmd_range_t {
+  iree_hal_buffer_t* buffer;
+  iree_device_size_t offset;
+  iree_device_size_t length;
+} iree_hal_cmd_range_t;
+
+// Buffer ranges accessed by a segment of commands between barriers.
+typedef struct iree_hal_cmd_segment_t {
+  // False if the segment contains commands whose accesses are unknown.
+  bool is_valid;
+  iree_host_size_t range_count;
+  iree_hal_cmd_range_t ranges[IREE_HAL_CMD_OPTIMIZE_MAX_RANGE_COUNT];
+} iree_hal_cmd_segment_t;
+
+static void iree_hal_cmd_segment_reset(iree_hal_cmd_segment_t* segment) {
+  segment->is_valid = true;
+  segment->range_count = 0;
+}
+
+static void iree_hal_cmd_segment_insert(iree_hal_cmd_segment_t* segment,
+                                        iree_hal_buffer_t* buffer,
+                                        iree_device_size_t offset,
+                                        iree_device_size_t length) {
+  if (!segment->is_valid) return;
+  for (iree_host_size_t i = 0; i < segment->range_count; ++i) {
+    const iree_hal_cmd_range_t* range = &segment->ranges[i];
+    if (range->buffer == buffer && range->offset == offset &&
+        range->length == length) {
+      return;  // already tracked
+    }
+  }
+  if (segment->range_count == IREE_ARRAYSIZE(segment->ranges)) {
+    segment->is_valid = false;
+    return;
+  }
+  iree_hal_cmd_range_t* range = &segment->ranges[segment->range_count++];
+  range->buffer = buffer;
+  range->offset = offset;
+  range->length = length;
+}
+
+// Returns true if none of the ranges in |a| overlap with those in |b|.
+static bool iree_hal_cmd_segment_is_disjoint(const iree_hal_cmd_segment_t* a,
+                                             const iree_hal_cmd_segment_t* b) {
+  for (iree_host_size_t i = 0; i < a->range_count; ++i) {
+    const iree_hal_cmd_range_t* lhs = &a->ranges[i];
+    for (iree_host_size_t j = 0; j < b->range_count; ++j) {
+      const iree_hal_cmd_range_t* rhs = &b->ranges[j];
+      if (iree_hal_buffer_test_overlap(lhs->buffer, lhs->offset, lhs->length,
+                                       rhs->buffer, rhs->offset, rhs->length) !=
+          IREE_HAL_BUFFER_OVERLAP_DISJOINT) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+typedef struct iree_hal_cmd_optimize_state_t {
+  // Last push_constants command applied, if any.
+  const iree_hal_cmd_push_constants_t* push_constants;
+  // Layout used by the last push_descriptor_set command.
+  iree_hal_executable_layout_t* push_layout;
+  // Last push_descriptor_set command applied to each set, if any.
+  const iree_hal_cmd_push_descriptor_set_t*
+      push_sets[IREE_HAL_CMD_OPTIMIZE_MAX_SET_COUNT];
+  // True if the contents of a set are unknown (bound via descriptor sets or
+  // pushed with an untracked set ordinal).
+  bool unknown_sets;
+
+  // Barrier separating previous_segment from current_segment, if any, and the
+  // command preceding it so that it can be unlinked.
+  iree_hal_cmd_header_t* barrier_prev;
+  iree_hal_cmd_header_t* barrier;
+  // Ranges accessed by the commands prior to |barrier| (up to the barrier
+  // before it).
+  iree_hal_cmd_segment_t previous_segment;
+  // Ranges accessed by the commands since |barrier|.
+  iree_hal_cmd_segment_t current_segment;
+  // True if current_segment contains any dispatches.
+  bool current_has_dispatches;
+} iree_hal_cmd_optimize_state_t;
+
+// Unlinks |cmd| (following |prev|, or the head if NULL) from the list.
+// The command storage remains in the arena until the list is reset.
+static void iree_hal_cmd_list_unlink(iree_hal_cmd_list_t* cmd_list,
+                                     iree_hal_cmd_header_t* prev,
+                                     iree_hal_cmd_header_t* cmd) {
+  if (prev) {
+    prev->next = cmd->next;
+  } else {
+    cmd_list->head = cmd->next;
+  }
+  if (cmd_list->tail == cmd) cmd_list->tail = prev;
+}
+
+static bool iree_hal_cmd_is_redundant_push_constants(
+    const iree_hal_cmd_optimize_state_t* state,
+    const iree_hal_cmd_push_constants_t* cmd) {
+  const iree_hal_cmd_push_constants_t* last = state->push_constants;
+  return last && last->executable_layout == cmd->executable_layout &&
+         last->offset == cmd->offset &&
+         last->values_length == cmd->values_length &&
+         memcmp(last->values, cmd->values, cmd->values_length) == 0;
+}
+
+static bool iree_hal_cmd_is_redundant_push_descriptor_set(
+    const iree_hal_cmd_optimize_state_t* state,
+    const iree_hal_cmd_push_descriptor_set_t* cmd) {
+  // Pushing with a different layout may disturb other sets so we only compare
+  // against the last push when the layout has not changed since.
+  if (cmd->set >= IREE_ARRAYSIZE(state->push_sets)) return false;
+  const iree_hal_cmd_push_descriptor_set_t* last = state->push_sets[cmd->set];
+  return last && state->push_layout == cmd->executable_layout &&
+         last->executable_layout == cmd->executable_layout &&
+         last->binding_count == cmd->binding_count &&
+         memcmp(last->bindings, cmd->bindings,
+                sizeof(cmd->bindings[0]) * cmd->binding_count) == 0;
+}
+
+// Merges |cmd| into |prev| if it continues the same copy.
+static bool iree_hal_cmd_merge_copy_buffer(
+    iree_hal_cmd_copy_buffer_t* prev, const iree_hal_cmd_copy_buffer_t* cmd) {
+  if (prev->source_buffer != cmd->source_buffer ||
+      prev->target_buffer != cmd->target_buffer ||
+      prev->length == IREE_WHOLE_BUFFER || cmd->length == IREE_WHOLE_BUFFER ||
+      prev->source_offset + prev->length != cmd->source_offset ||
+      prev->target_offset + prev->length != cmd->target_offset) {
+    return false;
+  }
+  // The merged copy must not read anything the first copy wrote.
+  const iree_device_size_t length = prev->length + cmd->length;
+  if (iree_hal_buffer_test_overlap(prev->source_buffer, prev->source_offset,
+                                   length, prev->target_buffer,
+                                   prev->target_offset, length) !=
+      IREE_HAL_BUFFER_OVERLAP_DISJOINT) {
+    return false;
+  }
+  prev->length = length;
+  return true;
+}
+
+// Merges |cmd| into |prev| if it continues the same fill pattern.
+static bool iree_hal_cmd_merge_fill_buffer(
+    iree_hal_cmd_fill_buffer_t* prev, const iree_hal_cmd_fill_buffer_t* cmd) {
+  // Only the first pattern_length bytes of the pattern storage are valid.
+  if (prev->target_buffer != cmd->target_buffer ||
+      prev->pattern_length != cmd->pattern_length ||
+      memcmp(&prev->pattern, &cmd->pattern, cmd->pattern_length) != 0 ||
+      prev->length == IREE_WHOLE_BUFFER || cmd->length == IREE_WHOLE_BUFFER ||
+      prev->length % prev->pattern_length != 0 ||
+      prev->target_offset + prev->length != cmd->target_offset) {
+    return false;
+  }
+  prev->length += cmd->length;
+  return true;
+}
+
+// Adds the buffer ranges a dispatch may access to the current segment.
+static void iree_hal_cmd_optimize_track_dispatch(
+    iree_hal_cmd_optimize_state_t* state) {
+  iree_hal_cmd_segment_t* segment = &state->current_segment;
+  state->current_has_dispatches = true;
+  if (state->unknown_sets) {
+    segment->is_valid = false;
+    return;
+  }
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(state->push_sets); ++i) {
+    const iree_hal_cmd_push_descriptor_set_t* cmd = state->push_sets[i];
+    if (!cmd) continue;
+    for (iree_host_size_t j = 0; j < cmd->binding_count; ++j) {
+      const iree_hal_descriptor_set_binding_t* binding = &cmd->bindings[j];
+      if (!binding->buffer) {
+        // Binding table slots are resolved during replay and may alias.
+        segment->is_valid = false;
+        return;
+      }
+      iree_hal_cmd_segment_insert(segment, binding->buffer, binding->offset,
+                                  binding->length);
+    }
+  }
+}
+
+// Handles the execution barrier |cmd| following |prev|.
+static void iree_hal_cmd_optimize_barrier(iree_hal_cmd_list_t* cmd_list,
+                                          iree_hal_cmd_optimize_state_t* state,
+                                          iree_hal_cmd_header_t* prev,
+                                          iree_hal_cmd_header_t* cmd) {
+  // The pending barrier can be dropped if the dispatches on either side of it
+  // are independent. The nested barrier |cmd| then orders both segments
+  // against whatever follows.
+  if (state->barrier && state->current_has_dispatches &&
+      state->previous_segment.is_valid && state->current_segment.is_valid &&
+      iree_hal_cmd_segment_is_disjoint(&state->previous_segment,
+                                       &state->current_segment)) {
+    iree_hal_cmd_list_unlink(cmd_list, state->barrier_prev, state->barrier);
+    if (prev == state->barrier) prev = state->barrier_prev;
+    for (iree_host_size_t i = 0; i < state->current_segment.range_count; ++i) {
+      const iree_hal_cmd_range_t* range = &state->current_segment.ranges[i];
+      iree_hal_cmd_segment_insert(&state->previous_segment, range->buffer,
+                                  range->offset, range->length);
+    }
+  } else {
+    state->previous_segment = state->current_segment;
+  }
+  state->barrier_prev = prev;
+  state->barrier = cmd;
+  iree_hal_cmd_segment_reset(&state->current_segment);
+  state->current_has_dispatches = false;
+}
+
+static void iree_hal_cmd_list_optimize(iree_hal_cmd_list_t* cmd_list) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_cmd_optimize_state_t state;
+  memset(&state, 0, sizeof(state));
+  iree_hal_cmd_segment_reset(&state.previous_segment);
+  iree_hal_cmd_segment_reset(&state.current_segment);
+
+  iree_hal_cmd_header_t* prev = NULL;
+  iree_hal_cmd_header_t* cmd = cmd_list->head;
+  while (cmd) {
+    iree_hal_cmd_header_t* next = cmd->next;
+    bool is_redundant = false;
+    switch (cmd->type) {
+      case IREE_HAL_CMD_EXECUTION_BARRIER:
+        iree_hal_cmd_optimize_barrier(cmd_list, &state, prev, cmd);
+        break;
+      case IREE_HAL_CMD_PUSH_CONSTANTS: {
+        iree_hal_cmd_push_constants_t* push_cmd =
+            (iree_hal_cmd_push_constants_t*)cmd;
+        is_redundant =
+            iree_hal_cmd_is_redundant_push_constants(&state, push_cmd);
+        state.push_constants = push_cmd;
+        break;
+      }
+      case IREE_HAL_CMD_PUSH_DESCRIPTOR_SET: {
+        iree_hal_cmd_push_descriptor_set_t* push_cmd =
+            (iree_hal_cmd_push_descriptor_set_t*)cmd;
+        is_redundant =
+            iree_hal_cmd_is_redundant_push_descriptor_set(&state, push_cmd);
+        state.push_layout = push_cmd->executable_layout;
+        if (push_cmd->set < IREE_ARRAYSIZE(state.push_sets)) {
+          state.push_sets[push_cmd->set] = push_cmd;
+        } else {
+          state.unknown_sets = true;
+        }
+        break;
+      }
+      case IREE_HAL_CMD_BIND_DESCRIPTOR_SET: {
+        // The descriptor set contents are opaque to us.
+        iree_hal_cmd_bind_descriptor_set_t* bind_cmd =
+            (iree_hal_cmd_bind_descriptor_set_t*)cmd;
+        if (bind_cmd->set < IREE_ARRAYSIZE(state.push_sets)) {
+          state.push_sets[bind_cmd->set] = NULL;
+        }
+        state.push_layout = NULL;
+        state.unknown_sets = true;
+        break;
+      }
+      case IREE_HAL_CMD_DISPATCH:
+        iree_hal_cmd_optimize_track_dispatch(&state);
+        break;
+      case IREE_HAL_CMD_DISPATCH_INDIRECT: {
+        iree_hal_cmd_dispatch_indirect_t* dispatch_cmd =
+            (iree_hal_cmd_dispatch_indirect_t*)cmd;
+        iree_hal_cmd_optimize_track_dispatch(&state);
+        iree_hal_cmd_segment_insert(
+            &state.current_segment, dispatch_cmd->workgroups_buffer,
+            dispatch_cmd->workgroups_offset, sizeof(uint32_t) * 3);
+        break;
+      }
+      case IREE_HAL_CMD_COPY_BUFFER:
+        is_redundant = prev && prev->type == IREE_HAL_CMD_COPY_BUFFER &&
+                       iree_hal_cmd_merge_copy_buffer(
+                           (iree_hal_cmd_copy_buffer_t*)prev,
+                           (const iree_hal_cmd_copy_buffer_t*)cmd);
+        state.current_segment.is_valid = false;
+        break;
+      case IREE_HAL_CMD_FILL_BUFFER:
+        is_redundant = prev && prev->type == IREE_HAL_CMD_FILL_BUFFER &&
+                       iree_hal_cmd_merge_fill_buffer(
+                           (iree_hal_cmd_fill_buffer_t*)prev,
+                           (const iree_hal_cmd_fill_buffer_t*)cmd);
+        state.current_segment.is_valid = false;
+        break;
+      default:
+        // Transfers and events have accesses we don't track.
+        state.current_segment.is_valid = false;
+        break;
+    }
+    if (is_redundant) {
+      iree_hal_cmd_list_unlink(cmd_list, prev, cmd);
+    } else {
+      prev = cmd;
+    }
+    cmd = next;
+  }
+
+  // A final barrier followed only by independent dispatches orders nothing.
+  if (state.barrier && state.current_has_dispatches &&
+      state.previous_segment.is_valid && state.current_segment.is_valid &&
+      iree_hal_cmd_segment_is_disjoint(&state.previous_segment,
+                                       &state.current_segment)) {
+    iree_hal_cmd_list_unlink(cmd_list, state.barrier_prev, state.barrier);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
 //===----------------------------------------------------------------------===//
 // Dynamic replay dispatch
 //===----------------------------------------------------------------------===//
@@ -832,7 +1205,8 @@ static const iree_hal_cmd_apply_fn_t iree_hal_cmd_apply_table[] = {
 
 IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply(
     iree_hal_command_buffer_t* base_command_buffer,
-    iree_hal_command_buffer_t* target_command_buffer) {
+    iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_deferred_command_buffer_t* command_buffer =
@@ -844,7 +1218,8 @@ IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply(
   if (iree_status_is_ok(status)) {
     for (iree_hal_cmd_header_t* cmd = cmd_list->head; cmd != NULL;
          cmd = cmd->next) {
-      status = iree_hal_cmd_apply_table[cmd->type](target_command_buffer, cmd);
+      status = iree_hal_cmd_apply_table[cmd->type](target_command_buffer,
+                                                   binding_table, cmd);
       if (!iree_status_is_ok(status)) break;
     }
   }
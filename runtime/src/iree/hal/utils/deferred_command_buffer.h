@@ -42,18 +42,32 @@ typedef struct iree_arena_block_pool_t iree_arena_block_pool_t;
 // After recording iree_hal_deferred_command_buffer_apply can be used to replay
 // the sequence of commands against a target command buffer implementation.
 // The command buffer can be replayed multiple times.
+//
+// When IREE_HAL_DEFERRED_COMMAND_BUFFER_OPTIMIZATION_ENABLE is set the recorded
+// commands are optimized when recording ends: redundant push constants and
+// descriptor set pushes are dropped, contiguous copies and fills are merged,
+// and barriers between dispatches touching disjoint buffer ranges are removed.
+//
+// When |binding_capacity| is nonzero descriptor set bindings may reference
+// binding table slots that are resolved each time the command buffer is
+// replayed. The target command buffer only ever receives concrete buffers.
 IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_create(
     iree_hal_device_t* device, iree_hal_command_buffer_mode_t mode,
     iree_hal_command_category_t command_categories,
-    iree_arena_block_pool_t* block_pool, iree_allocator_t host_allocator,
+    iree_host_size_t binding_capacity, iree_arena_block_pool_t* block_pool,
+    iree_allocator_t host_allocator,
     iree_hal_command_buffer_t** out_command_buffer);
 
 // Replays a recorded |command_buffer| against a |target_command_buffer|.
+// Binding table slots referenced by the recorded commands are resolved against
+// |binding_table|; the buffers it references are not retained and must remain
+// live until the target command buffer has completed execution.
 // If the command buffer was recorded in one-shot mode it will be reset upon
 // return.
 IREE_API_EXPORT iree_status_t iree_hal_deferred_command_buffer_apply(
     iree_hal_command_buffer_t* command_buffer,
-    iree_hal_command_buffer_t* target_command_buffer);
+    iree_hal_command_buffer_t* target_command_buffer,
+    iree_hal_buffer_binding_table_t binding_table);
 
 #ifdef __cplusplus
 }  // extern "C"
@@ -0,0 +1,262 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/quota_allocator.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/resource.h"
+
+typedef struct iree_hal_quota_allocator_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  iree_hal_allocator_t* base_allocator;
+
+  iree_slim_mutex_t mutex;
+  // Bytes reserved by allocations that are in progress and have not yet been
+  // recorded in |usage|.
+  iree_device_size_t bytes_reserved;
+  iree_hal_quota_allocator_usage_t usage;
+} iree_hal_quota_allocator_t;
+
+static const iree_hal_allocator_vtable_t iree_hal_quota_allocator_vtable;
+
+static iree_hal_quota_allocator_t* iree_hal_quota_allocator_cast(
+    iree_hal_allocator_t* IREE_RESTRICT base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_quota_allocator_vtable);
+  return (iree_hal_quota_allocator_t*)base_value;
+}
+
+iree_status_t iree_hal_quota_allocator_create(
+    iree_hal_allocator_t* base_allocator, iree_device_size_t bytes_limit,
+    iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(base_allocator);
+  IREE_ASSERT_ARGUMENT(out_allocator);
+  *out_allocator = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_quota_allocator_t* allocator = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*allocator),
+                                (void**)&allocator));
+  memset(allocator, 0, sizeof(*allocator));
+  iree_hal_resource_initialize(&iree_hal_quota_allocator_vtable,
+                               &allocator->resource);
+  allocator->host_allocator = host_allocator;
+  allocator->base_allocator = base_allocator;
+  iree_hal_allocator_retain(base_allocator);
+  iree_slim_mutex_initialize(&allocator->mutex);
+  allocator->usage.bytes_limit = bytes_limit;
+
+  *out_allocator = (iree_hal_allocator_t*)allocator;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+bool iree_hal_quota_allocator_isa(iree_hal_allocator_t* allocator) {
+  return iree_hal_resource_is(allocator, &iree_hal_quota_allocator_vtable);
+}
+
+static void iree_hal_quota_allocator_destroy(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  iree_allocator_t host_allocator = allocator->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_slim_mutex_deinitialize(&allocator->mutex);
+  iree_hal_allocator_release(allocator->base_allocator);
+  iree_allocator_free(host_allocator, allocator);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_allocator_t iree_hal_quota_allocator_host_allocator(
+    const iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_quota_allocator_t* allocator =
+      (iree_hal_quota_allocator_t*)base_allocator;
+  return allocator->host_allocator;
+}
+
+static iree_status_t iree_hal_quota_allocator_trim(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  return iree_hal_allocator_trim(allocator->base_allocator);
+}
+
+static void iree_hal_quota_allocator_query_statistics(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_allocator_statistics_t* IREE_RESTRICT out_statistics) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  iree_hal_allocator_query_statistics(allocator->base_allocator,
+                                      out_statistics);
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_quota_allocator_query_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_compatibility(allocator->base_allocator,
+                                                *params, allocation_size);
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_quota_allocator_query_buffer_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_buffer_usage_t intended_usage) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_buffer_compatibility(
+      allocator->base_allocator, buffer, intended_usage);
+}
+
+// Reserves |allocation_size| bytes of the quota for an allocation that is about
+// to be made. Reservations are counted against the limit so that concurrent
+// allocations cannot exceed it together.
+static iree_status_t iree_hal_quota_allocator_reserve(
+    iree_hal_quota_allocator_t* allocator, iree_device_size_t allocation_size) {
+  iree_status_t status = iree_ok_status();
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_hal_quota_allocator_usage_t* usage = &allocator->usage;
+  iree_device_size_t bytes_used = usage->bytes_live + allocator->bytes_reserved;
+  if (bytes_used > usage->bytes_limit ||
+      allocation_size > usage->bytes_limit - bytes_used) {
+    ++usage->rejected_count;
+    status = iree_make_status(
+        IREE_STATUS_RESOURCE_EXHAUSTED,
+        "allocation of %" PRIdsz "B would exceed the quota of %" PRIdsz
+        "B (%" PRIdsz "B in use)",
+        allocation_size, usage->bytes_limit, bytes_used);
+  } else {
+    allocator->bytes_reserved += allocation_size;
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+  return status;
+}
+
+static iree_status_t iree_hal_quota_allocator_allocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size, iree_const_byte_span_t initial_data,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  IREE_RETURN_IF_ERROR(
+      iree_hal_quota_allocator_reserve(allocator, allocation_size));
+
+  iree_hal_buffer_t* buffer = NULL;
+  iree_status_t status = iree_hal_allocator_allocate_buffer(
+      allocator->base_allocator, *params, allocation_size, initial_data,
+      &buffer);
+  // Base allocators returning views of other allocations or buffers that are
+  // released to other allocators cannot be accounted as releases do not route
+  // back through the base allocator.
+  bool is_accounted =
+      iree_status_is_ok(status) &&
+      iree_hal_buffer_allocated_buffer(buffer) == buffer &&
+      buffer->device_allocator == allocator->base_allocator;
+
+  iree_slim_mutex_lock(&allocator->mutex);
+  allocator->bytes_reserved -= allocation_size;
+  if (is_accounted) {
+    iree_hal_quota_allocator_usage_t* usage = &allocator->usage;
+    usage->bytes_live += iree_hal_buffer_allocation_size(buffer);
+    usage->bytes_peak = iree_max(usage->bytes_peak, usage->bytes_live);
+    ++usage->allocation_count;
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+  IREE_RETURN_IF_ERROR(status);
+
+  if (is_accounted) {
+    // Route releases of the buffer back to the quota allocator; see
+    // iree_hal_buffer_recycle.
+    buffer->device_allocator = base_allocator;
+  }
+  *out_buffer = buffer;
+  return iree_ok_status();
+}
+
+static void iree_hal_quota_allocator_deallocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+
+  iree_slim_mutex_lock(&allocator->mutex);
+  allocator->usage.bytes_live -= iree_hal_buffer_allocation_size(buffer);
+  iree_slim_mutex_unlock(&allocator->mutex);
+
+  buffer->device_allocator = allocator->base_allocator;
+  iree_hal_allocator_deallocate_buffer(allocator->base_allocator, buffer);
+}
+
+static iree_status_t iree_hal_quota_allocator_import_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_hal_external_buffer_t* IREE_RESTRICT external_buffer,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  return iree_hal_allocator_import_buffer(allocator->base_allocator, *params,
+                                          external_buffer, release_callback,
+                                          out_buffer);
+}
+
+static iree_status_t iree_hal_quota_allocator_export_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_external_buffer_type_t requested_type,
+    iree_hal_external_buffer_flags_t requested_flags,
+    iree_hal_external_buffer_t* IREE_RESTRICT out_external_buffer) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  return iree_hal_allocator_export_buffer(allocator->base_allocator, buffer,
+                                          requested_type, requested_flags,
+                                          out_external_buffer);
+}
+
+void iree_hal_quota_allocator_set_limit(iree_hal_allocator_t* base_allocator,
+                                        iree_device_size_t bytes_limit) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  iree_slim_mutex_lock(&allocator->mutex);
+  allocator->usage.bytes_limit = bytes_limit;
+  iree_slim_mutex_unlock(&allocator->mutex);
+}
+
+void iree_hal_quota_allocator_query_usage(
+    iree_hal_allocator_t* base_allocator,
+    iree_hal_quota_allocator_usage_t* out_usage) {
+  iree_hal_quota_allocator_t* allocator =
+      iree_hal_quota_allocator_cast(base_allocator);
+  iree_slim_mutex_lock(&allocator->mutex);
+  *out_usage = allocator->usage;
+  iree_slim_mutex_unlock(&allocator->mutex);
+}
+
+static const iree_hal_allocator_vtable_t iree_hal_quota_allocator_vtable = {
+    .destroy = iree_hal_quota_allocator_destroy,
+    .host_allocator = iree_hal_quota_allocator_host_allocator,
+    .trim = iree_hal_quota_allocator_trim,
+    .query_statistics = iree_hal_quota_allocator_query_statistics,
+    .query_compatibility = iree_hal_quota_allocator_query_compatibility,
+    .allocate_buffer = iree_hal_quota_allocator_allocate_buffer,
+    .deallocate_buffer = iree_hal_quota_allocator_deallocate_buffer,
+    .import_buffer = iree_hal_quota_allocator_import_buffer,
+    .export_buffer = iree_hal_quota_allocator_export_buffer,
+    .query_buffer_compatibility =
+        iree_hal_quota_allocator_query_buffer_compatibility,
+};
@@ -0,0 +1,76 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_QUOTA_ALLOCATOR_H_
+#define IREE_HAL_UTILS_QUOTA_ALLOCATOR_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_quota_allocator_t
+//===----------------------------------------------------------------------===//
+
+// Quota limit that allows allocations of any size.
+#define IREE_HAL_QUOTA_ALLOCATOR_UNLIMITED ((iree_device_size_t)-1)
+
+// Memory usage of the allocations made through a quota allocator.
+typedef struct iree_hal_quota_allocator_usage_t {
+  // Maximum number of bytes that may be live at any time.
+  iree_device_size_t bytes_limit;
+  // Bytes currently allocated.
+  iree_device_size_t bytes_live;
+  // High-water mark of |bytes_live| since the allocator was created.
+  iree_device_size_t bytes_peak;
+  // Number of allocations made.
+  iree_host_size_t allocation_count;
+  // Number of allocations that failed because they would exceed the limit.
+  iree_host_size_t rejected_count;
+} iree_hal_quota_allocator_usage_t;
+
+// Creates an allocator that forwards all operations to |base_allocator| while
+// limiting the total size of the buffers live at any time to |bytes_limit|.
+// Allocations that would exceed the limit fail with
+// IREE_STATUS_RESOURCE_EXHAUSTED without reaching |base_allocator|.
+//
+// This is intended to isolate multiple tenants sharing a device: each tenant
+// gets its own quota allocator wrapping the device allocator (see
+// iree_hal_tenant_device_create) such that one tenant cannot exhaust the
+// memory of all others. The limit applies to the requested allocation sizes
+// and bases may round allocations up.
+//
+// Imported buffers are not owned by the allocator and do not count against the
+// limit. Buffers allocated from the quota allocator must be released before it
+// is destroyed, as is required for all allocators.
+//
+// Thread-safe; multiple threads may allocate and release concurrently.
+iree_status_t iree_hal_quota_allocator_create(
+    iree_hal_allocator_t* base_allocator, iree_device_size_t bytes_limit,
+    iree_allocator_t host_allocator, iree_hal_allocator_t** out_allocator);
+
+// Returns true if |allocator| is a quota allocator.
+bool iree_hal_quota_allocator_isa(iree_hal_allocator_t* allocator);
+
+// Changes the limit of |allocator| to |bytes_limit|. Live buffers are not
+// affected; if the new limit is below the live bytes then all allocations will
+// fail until enough buffers have been released.
+void iree_hal_quota_allocator_set_limit(iree_hal_allocator_t* allocator,
+                                        iree_device_size_t bytes_limit);
+
+// Queries the memory usage of all allocations made through |allocator|.
+void iree_hal_quota_allocator_query_usage(
+    iree_hal_allocator_t* allocator,
+    iree_hal_quota_allocator_usage_t* out_usage);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_QUOTA_ALLOCATOR_H_
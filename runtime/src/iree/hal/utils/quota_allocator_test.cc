@@ -0,0 +1,167 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/quota_allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/utils/tracking_allocator.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+struct QuotaAllocatorTest : public ::testing::Test {
+  iree_allocator_t host_allocator = iree_allocator_system();
+  iree_hal_allocator_t* base_allocator = NULL;
+
+  void SetUp() override {
+    IREE_ASSERT_OK(iree_hal_allocator_create_heap(
+        iree_make_cstring_view("heap"), host_allocator, host_allocator,
+        &base_allocator));
+  }
+
+  void TearDown() override { iree_hal_allocator_release(base_allocator); }
+
+  iree_hal_allocator_t* CreateQuota(iree_device_size_t bytes_limit) {
+    iree_hal_allocator_t* allocator = NULL;
+    IREE_CHECK_OK(iree_hal_quota_allocator_create(base_allocator, bytes_limit,
+                                                  host_allocator, &allocator));
+    return allocator;
+  }
+
+  iree_status_t Allocate(iree_hal_allocator_t* allocator,
+                         iree_device_size_t allocation_size,
+                         iree_hal_buffer_t** out_buffer) {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+    params.usage =
+        IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+    return iree_hal_allocator_allocate_buffer(allocator, params,
+                                              allocation_size,
+                                              iree_const_byte_span_empty(),
+                                              out_buffer);
+  }
+
+  iree_hal_quota_allocator_usage_t QueryUsage(iree_hal_allocator_t* allocator) {
+    iree_hal_quota_allocator_usage_t usage;
+    iree_hal_quota_allocator_query_usage(allocator, &usage);
+    return usage;
+  }
+};
+
+// Tests that allocations beyond the limit are rejected until enough buffers
+// have been released.
+TEST_F(QuotaAllocatorTest, Limit) {
+  iree_hal_allocator_t* allocator = CreateQuota(1000);
+  EXPECT_TRUE(iree_hal_quota_allocator_isa(allocator));
+  EXPECT_FALSE(iree_hal_quota_allocator_isa(base_allocator));
+
+  iree_hal_buffer_t* buffer0 = NULL;
+  iree_hal_buffer_t* buffer1 = NULL;
+  iree_hal_buffer_t* buffer2 = NULL;
+  IREE_ASSERT_OK(Allocate(allocator, 600, &buffer0));
+  IREE_ASSERT_OK(Allocate(allocator, 400, &buffer1));
+  EXPECT_THAT(Status(Allocate(allocator, 1, &buffer2)),
+              StatusIs(StatusCode::kResourceExhausted));
+  EXPECT_EQ(buffer2, nullptr);
+
+  iree_hal_quota_allocator_usage_t usage = QueryUsage(allocator);
+  EXPECT_EQ(usage.bytes_limit, 1000);
+  EXPECT_EQ(usage.bytes_live, 1000);
+  EXPECT_EQ(usage.bytes_peak, 1000);
+  EXPECT_EQ(usage.allocation_count, 2);
+  EXPECT_EQ(usage.rejected_count, 1);
+
+  iree_hal_buffer_release(buffer0);
+  IREE_ASSERT_OK(Allocate(allocator, 500, &buffer2));
+  usage = QueryUsage(allocator);
+  EXPECT_EQ(usage.bytes_live, 900);
+  EXPECT_EQ(usage.bytes_peak, 1000);
+
+  iree_hal_buffer_release(buffer1);
+  iree_hal_buffer_release(buffer2);
+  EXPECT_EQ(QueryUsage(allocator).bytes_live, 0);
+  iree_hal_allocator_release(allocator);
+}
+
+// Tests that lowering the limit below the live bytes rejects new allocations
+// without affecting the live buffers.
+TEST_F(QuotaAllocatorTest, SetLimit) {
+  iree_hal_allocator_t* allocator =
+      CreateQuota(IREE_HAL_QUOTA_ALLOCATOR_UNLIMITED);
+  iree_hal_buffer_t* buffer0 = NULL;
+  IREE_ASSERT_OK(Allocate(allocator, 4096, &buffer0));
+
+  iree_hal_quota_allocator_set_limit(allocator, 1024);
+  iree_hal_buffer_t* buffer1 = NULL;
+  EXPECT_THAT(Status(Allocate(allocator, 16, &buffer1)),
+              StatusIs(StatusCode::kResourceExhausted));
+  iree_hal_buffer_release(buffer0);
+  IREE_ASSERT_OK(Allocate(allocator, 1024, &buffer1));
+
+  iree_hal_quota_allocator_usage_t usage = QueryUsage(allocator);
+  EXPECT_EQ(usage.bytes_limit, 1024);
+  EXPECT_EQ(usage.bytes_live, 1024);
+  EXPECT_EQ(usage.bytes_peak, 4096);
+  EXPECT_EQ(usage.rejected_count, 1);
+  iree_hal_buffer_release(buffer1);
+  iree_hal_allocator_release(allocator);
+}
+
+// Tests that tenants sharing a base allocator are charged independently.
+TEST_F(QuotaAllocatorTest, Tenants) {
+  iree_hal_allocator_t* tracking_allocator = NULL;
+  IREE_ASSERT_OK(iree_hal_tracking_allocator_create(
+      base_allocator, host_allocator, &tracking_allocator));
+  iree_hal_allocator_t* tenant0 = NULL;
+  iree_hal_allocator_t* tenant1 = NULL;
+  IREE_ASSERT_OK(iree_hal_quota_allocator_create(tracking_allocator, 256,
+                                                 host_allocator, &tenant0));
+  IREE_ASSERT_OK(iree_hal_quota_allocator_create(tracking_allocator, 512,
+                                                 host_allocator, &tenant1));
+
+  iree_hal_buffer_t* buffer0 = NULL;
+  iree_hal_buffer_t* buffer1 = NULL;
+  iree_hal_buffer_t* buffer2 = NULL;
+  IREE_ASSERT_OK(Allocate(tenant0, 256, &buffer0));
+  EXPECT_THAT(Status(Allocate(tenant0, 256, &buffer1)),
+              StatusIs(StatusCode::kResourceExhausted));
+  IREE_ASSERT_OK(Allocate(tenant1, 256, &buffer1));
+  IREE_ASSERT_OK(Allocate(tenant1, 256, &buffer2));
+
+  EXPECT_EQ(QueryUsage(tenant0).bytes_live, 256);
+  EXPECT_EQ(QueryUsage(tenant0).rejected_count, 1);
+  EXPECT_EQ(QueryUsage(tenant1).bytes_live, 512);
+  EXPECT_EQ(QueryUsage(tenant1).rejected_count, 0);
+  iree_hal_tracking_allocator_usage_t total;
+  iree_hal_tracking_allocator_query_usage(tracking_allocator, &total);
+  EXPECT_EQ(total.host_bytes_live, 768);
+
+  iree_hal_buffer_release(buffer0);
+  iree_hal_buffer_release(buffer1);
+  iree_hal_buffer_release(buffer2);
+  EXPECT_EQ(QueryUsage(tenant0).bytes_live, 0);
+  EXPECT_EQ(QueryUsage(tenant1).bytes_live, 0);
+  iree_hal_tracking_allocator_query_usage(tracking_allocator, &total);
+  EXPECT_EQ(total.host_bytes_live, 0);
+
+  iree_hal_allocator_release(tenant0);
+  iree_hal_allocator_release(tenant1);
+  iree_hal_allocator_release(tracking_allocator);
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
@@ -59,6 +59,15 @@ static void iree_hal_resource_set_release_blocks(iree_hal_resource_set_t* set,
   // that isn't worth the complexity.
   iree_arena_block_t* block_head = NULL;
   iree_arena_block_t* block_tail = NULL;
+  if (set->hash_slots) {
+    block_head = block_tail =
+        (iree_arena_block_t*)((uint8_t*)set->hash_slots +
+                              set->block_pool->usable_block_size);
+    block_head->next = NULL;
+    set->hash_slots = NULL;
+    set->hash_capacity = 0;
+    set->hash_count = 0;
+  }
   iree_hal_resource_set_chunk_t* chunk = set->chunk_head;
   while (chunk) {
     // Release all resources in the chunk.
@@ -107,6 +116,69 @@ IREE_API_EXPORT void iree_hal_resource_set_free(iree_hal_resource_set_t* set) {
   IREE_TRACE_ZONE_END(z0);
 }
 
+// Returns the slot in the hash table of |set| that either holds |resource| or
+// is the empty slot it should be inserted into. The table is never allowed to
+// fill up so probing always terminates.
+static iree_hal_resource_t** iree_hal_resource_set_hash_find(
+    iree_hal_resource_set_t* set, iree_hal_resource_t* resource) {
+  // Fibonacci hashing mixes the high bits down as the low bits of resource
+  // pointers are always zero.
+  uint32_t mask = set->hash_capacity - 1;
+  uint32_t index =
+      (uint32_t)(((uint64_t)(uintptr_t)resource * 0x9E3779B97F4A7C15ull) >>
+                 32) &
+      mask;
+  while (set->hash_slots[index] && set->hash_slots[index] != resource) {
+    index = (index + 1) & mask;
+  }
+  return &set->hash_slots[index];
+}
+
+// Adds the already-retained |resource| to the hash table of |set| if there is
+// room. Tracking is best-effort as the set may contain duplicates anyway.
+static void iree_hal_resource_set_hash_insert(iree_hal_resource_set_t* set,
+                                              iree_hal_resource_t* resource) {
+  if (set->hash_count >= set->hash_capacity - set->hash_capacity / 4) return;
+  iree_hal_resource_t** slot = iree_hal_resource_set_hash_find(set, resource);
+  if (*slot) return;
+  *slot = resource;
+  ++set->hash_count;
+}
+
+// Switches |set| to tracking resources in a hash table and adds all resources
+// retained so far. This is an optimization and failure to acquire the table
+// storage only means the set keeps relying on the MRU.
+static void iree_hal_resource_set_enable_hash(iree_hal_resource_set_t* set) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_arena_block_t* block = NULL;
+  iree_status_t status = iree_arena_block_pool_acquire(set->block_pool, &block);
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    IREE_TRACE_ZONE_END(z0);
+    return;
+  }
+  uint32_t capacity = 1;
+  while (capacity * 2 <=
+         set->block_pool->usable_block_size / sizeof(iree_hal_resource_t*)) {
+    capacity *= 2;
+  }
+  set->hash_slots =
+      (iree_hal_resource_t**)((uint8_t*)block -
+                              set->block_pool->usable_block_size);
+  memset(set->hash_slots, 0, capacity * sizeof(iree_hal_resource_t*));
+  set->hash_capacity = capacity;
+  set->hash_count = 0;
+  for (iree_hal_resource_set_chunk_t* chunk = set->chunk_head; chunk;
+       chunk = iree_hal_resource_set_chunk_is_stored_inline(chunk)
+                   ? NULL
+                   : chunk->next_chunk) {
+    for (iree_host_size_t i = 0; i < chunk->count; ++i) {
+      iree_hal_resource_set_hash_insert(set, chunk->resources[i]);
+    }
+  }
+  IREE_TRACE_ZONE_END(z0);
+}
+
 // Retains |resource| and adds it to the main |set| list.
 static iree_status_t iree_hal_resource_set_insert_retain(
     iree_hal_resource_set_t* set, iree_hal_resource_t* resource) {
@@ -132,6 +204,15 @@ static iree_status_t iree_hal_resource_set_insert_retain(
   // Retain and insert into the chunk.
   chunk->resources[chunk->count++] = resource;
   iree_hal_resource_retain(resource);
+
+  // Large sets switch to hashing now that the MRU is likely to miss.
+  ++set->count;
+  if (set->hash_slots) {
+    iree_hal_resource_set_hash_insert(set, resource);
+  } else if (IREE_UNLIKELY(set->count ==
+                           IREE_HAL_RESOURCE_SET_HASH_THRESHOLD)) {
+    iree_hal_resource_set_enable_hash(set);
+  }
   return iree_ok_status();
 }
 
@@ -232,10 +313,14 @@ static iree_status_t iree_hal_resource_set_insert_1(
     return iree_ok_status();
   }
 
-  // Miss - insert into the main list (slow path).
+  // Miss - check the hash table of large sets before falling back to inserting
+  // into the main list (slow path).
   // Note that we do this before updating the MRU in case allocation fails - we
   // don't want to keep the pointer around unless we've really retained it.
-  IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert_retain(set, resource));
+  if (!set->hash_slots ||
+      *iree_hal_resource_set_hash_find(set, resource) != resource) {
+    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert_retain(set, resource));
+  }
 
   // Shift the MRU down and insert the new item at the head.
   memmove(&set->mru[1], &set->mru[0],
@@ -261,3 +346,15 @@ iree_hal_resource_set_insert(iree_hal_resource_set_t* set,
   }
   return iree_ok_status();
 }
+
+IREE_API_EXPORT iree_status_t iree_hal_resource_set_insert_strided(
+    iree_hal_resource_set_t* set, iree_host_size_t count,
+    const void* resources, iree_host_size_t stride) {
+  const uint8_t* resource_ptr = (const uint8_t*)resources;
+  for (iree_host_size_t i = 0; i < count; ++i, resource_ptr += stride) {
+    iree_hal_resource_t* resource = *(iree_hal_resource_t* const*)resource_ptr;
+    if (!resource) continue;
+    IREE_RETURN_IF_ERROR(iree_hal_resource_set_insert_1(set, resource));
+  }
+  return iree_ok_status();
+}
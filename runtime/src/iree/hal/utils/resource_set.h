@@ -66,6 +66,14 @@ typedef struct iree_hal_resource_set_chunk_t {
 #define IREE_HAL_RESOURCE_SET_MRU_SIZE \
   (iree_hardware_constructive_interference_size / sizeof(uintptr_t))
 
+// Number of retained resources after which a set also tracks its resources in
+// an open-addressing hash table. Below this the MRU catches most redundant
+// insertions; above it (command buffers with many dispatches cycling through
+// the same buffers and executables) the MRU mostly misses and every miss would
+// retain the resource again.
+#define IREE_HAL_RESOURCE_SET_HASH_THRESHOLD \
+  (2 * IREE_HAL_RESOURCE_SET_MRU_SIZE)
+
 // "Efficient" append-only set for retaining a set of resources.
 // This is a non-deterministic data structure that tries to reduce the amount of
 // overhead involved in tracking a reasonably-sized set of resources (~dozens to
@@ -86,6 +94,11 @@ typedef struct iree_hal_resource_set_chunk_t {
 // whatever user code may need to do to maintain proper lifetime - or as small
 // in terms of code-size.
 //
+// Once the set grows past IREE_HAL_RESOURCE_SET_HASH_THRESHOLD resources MRU
+// misses are checked against a hash table stored in a single block from the
+// pool. The table is never grown: once it is 3/4 full additional resources are
+// only retained and deduplicated by the MRU as before.
+//
 // **WARNING**: thread-unsafe insertion: it's assumed that sets are constructed
 // by a single thread, sealed, and then released at once at a future time point.
 // Multiple threads needing to insert into a set should have their own sets and
@@ -111,6 +124,16 @@ typedef struct iree_hal_resource_set_t {
 
   // Linked list of storage chunks.
   iree_hal_resource_set_chunk_t* chunk_head;
+
+  // Total number of resources retained in all chunks (including duplicates).
+  uint32_t count;
+
+  // Open-addressing hash table of retained resources or NULL if the set has
+  // not yet reached IREE_HAL_RESOURCE_SET_HASH_THRESHOLD resources. Stored in
+  // a block from |block_pool|; |hash_capacity| is a power of two.
+  uint32_t hash_capacity;
+  uint32_t hash_count;
+  iree_hal_resource_t** hash_slots;
 } iree_hal_resource_set_t;
 
 // TODO(benvanik): add an allocation method that allows for placement; in many
@@ -133,6 +156,16 @@ IREE_API_EXPORT iree_status_t
 iree_hal_resource_set_insert(iree_hal_resource_set_t* set,
                              iree_host_size_t count, const void* resources);
 
+// Inserts |count| resources read every |stride| bytes starting at |resources|.
+// NULL resources are skipped. This allows inserting the resources of an array
+// of structs in one call, such as the buffers of descriptor set bindings:
+//   iree_hal_resource_set_insert_strided(set, binding_count,
+//                                        &bindings[0].buffer,
+//                                        sizeof(bindings[0]));
+IREE_API_EXPORT iree_status_t iree_hal_resource_set_insert_strided(
+    iree_hal_resource_set_t* set, iree_host_size_t count,
+    const void* resources, iree_host_size_t stride);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -203,6 +203,81 @@ static iree_status_t iree_hal_resource_set_benchmark_randomized_n(
   return iree_ok_status();
 }
 
+// Tests recording a large command buffer: each dispatch inserts its
+// executable and a descriptor set of 4 buffers chosen from a pool (via the
+// strided insert used for descriptor set bindings). Once the pool exceeds the
+// MRU the set relies on the hash table to avoid retaining the same resources
+// over and over.
+//
+// user_data is the number of unique buffers used by the dispatches.
+static iree_status_t iree_hal_resource_set_benchmark_dispatches_n(
+    const iree_benchmark_def_t* benchmark_def,
+    iree_benchmark_state_t* benchmark_state) {
+  iree_allocator_t host_allocator = benchmark_state->host_allocator;
+
+  // Initialize the block pool we'll be serving from.
+  // Sized like we usually do it in the runtime for ~512-1024 elements.
+  iree_arena_block_pool_t block_pool;
+  iree_arena_block_pool_initialize(4096, host_allocator, &block_pool);
+
+  // Allocate the buffers and a handful of executables up front.
+  uint32_t count = (uint32_t)(uintptr_t)benchmark_def->user_data;
+  iree_hal_resource_t** resources = NULL;
+  IREE_CHECK_OK(iree_allocator_malloc(host_allocator,
+                                      sizeof(iree_hal_resource_t*) * count,
+                                      (void**)&resources));
+  for (uint32_t i = 0; i < count; ++i) {
+    IREE_CHECK_OK(iree_hal_test_resource_create(host_allocator, &resources[i]));
+  }
+  iree_hal_resource_t* executables[4] = {NULL};
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(executables); ++i) {
+    IREE_CHECK_OK(
+        iree_hal_test_resource_create(host_allocator, &executables[i]));
+  }
+
+  // Matches the layout of iree_hal_descriptor_set_binding_t closely enough.
+  typedef struct {
+    uint32_t binding;
+    iree_hal_resource_t* buffer;
+    iree_device_size_t offset;
+    iree_device_size_t length;
+  } binding_t;
+
+  // Record 1024 dispatches into a new set each iteration.
+  iree_prng_xoroshiro128_state_t prng = {0};
+  iree_prng_xoroshiro128_initialize(123ull, &prng);
+  while (iree_benchmark_keep_running(benchmark_state, /*batch_count=*/1024)) {
+    iree_hal_resource_set_t* set = NULL;
+    IREE_CHECK_OK(iree_hal_resource_set_allocate(&block_pool, &set));
+    for (uint32_t i = 0; i < 1024; ++i) {
+      IREE_CHECK_OK(iree_hal_resource_set_insert(
+          set, 1, &executables[i % IREE_ARRAYSIZE(executables)]));
+      binding_t bindings[4];
+      for (iree_host_size_t j = 0; j < IREE_ARRAYSIZE(bindings); ++j) {
+        bindings[j].binding = (uint32_t)j;
+        bindings[j].buffer =
+            resources[iree_prng_xoroshiro128plus_next_uint32(&prng) % count];
+      }
+      IREE_CHECK_OK(iree_hal_resource_set_insert_strided(
+          set, IREE_ARRAYSIZE(bindings), &bindings[0].buffer,
+          sizeof(bindings[0])));
+    }
+    iree_hal_resource_set_free(set);
+  }
+
+  // Cleanup.
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(executables); ++i) {
+    iree_hal_resource_release(executables[i]);
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    iree_hal_resource_release(resources[i]);
+  }
+  iree_allocator_free(host_allocator, resources);
+  iree_arena_block_pool_deinitialize(&block_pool);
+
+  return iree_ok_status();
+}
+
 int main(int argc, char** argv) {
   iree_benchmark_initialize(&argc, argv);
 
@@ -282,6 +357,27 @@ int main(int argc, char** argv) {
                             &benchmark_def);
   }
 
+  // iree_hal_resource_set_benchmark_dispatches_n
+  {
+    iree_benchmark_def_t benchmark_def = {
+        .flags = IREE_BENCHMARK_FLAG_MEASURE_PROCESS_CPU_TIME |
+                 IREE_BENCHMARK_FLAG_USE_REAL_TIME,
+        .time_unit = IREE_BENCHMARK_UNIT_NANOSECOND,
+        .minimum_duration_ns = 0,
+        .iteration_count = 0,
+        .run = iree_hal_resource_set_benchmark_dispatches_n,
+    };
+    benchmark_def.user_data = (void*)4u;
+    iree_benchmark_register(iree_make_cstring_view("dispatches_4"),
+                            &benchmark_def);
+    benchmark_def.user_data = (void*)64u;
+    iree_benchmark_register(iree_make_cstring_view("dispatches_64"),
+                            &benchmark_def);
+    benchmark_def.user_data = (void*)256u;
+    iree_benchmark_register(iree_make_cstring_view("dispatches_256"),
+                            &benchmark_def);
+  }
+
   iree_benchmark_run_specified();
   return 0;
 }
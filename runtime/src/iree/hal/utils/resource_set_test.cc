@@ -252,6 +252,70 @@ TEST_F(ResourceSetTest, RedundantInsertion) {
   EXPECT_EQ(live_bitmap, 0u);
 }
 
+// Tests that large sets deduplicate resources that have fallen out of the MRU
+// using the hash table.
+TEST_F(ResourceSetTest, HashedRedundantInsertion) {
+  // The hash table lives in a single block and needs room for all resources.
+  iree_arena_block_pool_t large_block_pool;
+  iree_arena_block_pool_initialize(4096, host_allocator, &large_block_pool);
+  auto resource_set = make_resource_set(&large_block_pool);
+
+  iree_hal_resource_t* resources[32] = {NULL};
+  static_assert(
+      IREE_ARRAYSIZE(resources) > IREE_HAL_RESOURCE_SET_HASH_THRESHOLD,
+      "need to pick a value that switches the set to hashing");
+  uint32_t live_bitmap = 0u;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(resources); ++i) {
+    IREE_ASSERT_OK(iree_hal_test_resource_create(
+        i, &live_bitmap, host_allocator, &resources[i]));
+  }
+
+  // Insert all of the resources a few times; every round misses the MRU.
+  for (int round = 0; round < 4; ++round) {
+    IREE_ASSERT_OK(iree_hal_resource_set_insert(
+        resource_set.get(), IREE_ARRAYSIZE(resources), resources));
+  }
+  EXPECT_EQ(resource_set->count, IREE_ARRAYSIZE(resources));
+  EXPECT_EQ(resource_set->hash_count, IREE_ARRAYSIZE(resources));
+
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(resources); ++i) {
+    iree_hal_resource_release(resources[i]);
+  }
+  EXPECT_EQ(live_bitmap, 0xFFFFFFFFu);
+  resource_set.reset();
+  EXPECT_EQ(live_bitmap, 0u);
+  iree_arena_block_pool_deinitialize(&large_block_pool);
+}
+
+// Tests inserting resources from an array of structs, skipping NULLs.
+TEST_F(ResourceSetTest, InsertStrided) {
+  auto resource_set = make_resource_set(&block_pool);
+
+  struct binding_t {
+    uint32_t binding;
+    iree_hal_resource_t* resource;
+  } bindings[4] = {};
+  uint32_t live_bitmap = 0u;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(bindings); ++i) {
+    bindings[i].binding = (uint32_t)i;
+    if (i == 2) continue;  // left NULL
+    IREE_ASSERT_OK(iree_hal_test_resource_create(
+        i, &live_bitmap, host_allocator, &bindings[i].resource));
+  }
+  EXPECT_EQ(live_bitmap, 0xBu);
+
+  IREE_ASSERT_OK(iree_hal_resource_set_insert_strided(
+      resource_set.get(), IREE_ARRAYSIZE(bindings), &bindings[0].resource,
+      sizeof(bindings[0])));
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(bindings); ++i) {
+    if (bindings[i].resource) iree_hal_resource_release(bindings[i].resource);
+  }
+  EXPECT_EQ(live_bitmap, 0xBu);
+
+  resource_set.reset();
+  EXPECT_EQ(live_bitmap, 0u);
+}
+
 }  // namespace
 }  // namespace hal
 }  // namespace iree
@@ -295,6 +295,18 @@ IREE_API_EXPORT void iree_hal_semaphore_notify(
   IREE_TRACE_ZONE_END(z0);
 }
 
+IREE_API_EXPORT bool iree_hal_semaphore_spin_until(
+    iree_condition_fn_t condition_fn, void* condition_arg,
+    iree_time_t deadline_ns) {
+#if IREE_HAL_SEMAPHORE_SPIN_DURATION_NS > 0
+  const iree_time_t spin_deadline_ns = iree_min(
+      deadline_ns, iree_time_now() + IREE_HAL_SEMAPHORE_SPIN_DURATION_NS);
+  return iree_spin_until(condition_fn, condition_arg, spin_deadline_ns);
+#else
+  return condition_fn(condition_arg);
+#endif  // IREE_HAL_SEMAPHORE_SPIN_DURATION_NS > 0
+}
+
 IREE_API_EXPORT void iree_hal_semaphore_poll(iree_hal_semaphore_t* semaphore) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
@@ -163,6 +163,17 @@ IREE_API_EXPORT void iree_hal_semaphore_notify(
     iree_hal_semaphore_t* semaphore, uint64_t new_value,
     iree_status_code_t new_status_code);
 
+// Spins the calling thread for up to IREE_HAL_SEMAPHORE_SPIN_DURATION_NS (or
+// until |deadline_ns|, if sooner) while |condition_fn| returns false.
+// Returns true if the condition was met during the spin.
+//
+// Implementations use this to poll their payload values without locks ahead
+// of acquiring timepoints or parking on a wait handle so that waits on
+// semaphores that are about to be signaled avoid the syscalls of a full wait.
+IREE_API_EXPORT bool iree_hal_semaphore_spin_until(
+    iree_condition_fn_t condition_fn, void* condition_arg,
+    iree_time_t deadline_ns);
+
 // Polls timepoints and issues callbacks for those already resolved.
 // This polling is performed internally on user calls such as signal and wait
 // but can be made more frequently to reduce latency in cases where users are
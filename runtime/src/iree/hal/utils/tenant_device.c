@@ -0,0 +1,370 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/tenant_device.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/tracing.h"
+#include "iree/hal/detail.h"
+#include "iree/hal/resource.h"
+
+// Dispatches |method_name| directly to the base device implementation. The
+// public API has already performed any validation on the tenant device.
+#define _BASE_DISPATCH(device, method_name) \
+  IREE_HAL_VTABLE_DISPATCH((device)->base_device, iree_hal_device, method_name)
+
+typedef struct iree_hal_tenant_device_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  iree_hal_device_t* base_device;
+
+  // Allocator charging all allocations against the tenant quota.
+  iree_hal_allocator_t* quota_allocator;
+  // Allocator returned as the device allocator; the quota allocator unless it
+  // has been replaced by one wrapping it.
+  iree_hal_allocator_t* device_allocator;
+} iree_hal_tenant_device_t;
+
+static const iree_hal_device_vtable_t iree_hal_tenant_device_vtable;
+
+static iree_hal_tenant_device_t* iree_hal_tenant_device_cast(
+    iree_hal_device_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_tenant_device_vtable);
+  return (iree_hal_tenant_device_t*)base_value;
+}
+
+iree_status_t iree_hal_tenant_device_create(iree_hal_device_t* base_device,
+                                            iree_device_size_t bytes_limit,
+                                            iree_allocator_t host_allocator,
+                                            iree_hal_device_t** out_device) {
+  IREE_ASSERT_ARGUMENT(base_device);
+  IREE_ASSERT_ARGUMENT(out_device);
+  *out_device = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_tenant_device_t* device = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0,
+      iree_allocator_malloc(host_allocator, sizeof(*device), (void**)&device));
+  memset(device, 0, sizeof(*device));
+  iree_hal_resource_initialize(&iree_hal_tenant_device_vtable,
+                               &device->resource);
+  device->host_allocator = host_allocator;
+  device->base_device = base_device;
+  iree_hal_device_retain(base_device);
+
+  iree_status_t status = iree_hal_quota_allocator_create(
+      iree_hal_device_allocator(base_device), bytes_limit, host_allocator,
+      &device->quota_allocator);
+  if (iree_status_is_ok(status)) {
+    device->device_allocator = device->quota_allocator;
+    iree_hal_allocator_retain(device->device_allocator);
+    *out_device = (iree_hal_device_t*)device;
+  } else {
+    iree_hal_device_release((iree_hal_device_t*)device);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+bool iree_hal_tenant_device_isa(iree_hal_device_t* device) {
+  return iree_hal_resource_is(device, &iree_hal_tenant_device_vtable);
+}
+
+iree_hal_allocator_t* iree_hal_tenant_device_quota_allocator(
+    iree_hal_device_t* base_device) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return device->quota_allocator;
+}
+
+void iree_hal_tenant_device_query_usage(
+    iree_hal_device_t* base_device,
+    iree_hal_quota_allocator_usage_t* out_usage) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  iree_hal_quota_allocator_query_usage(device->quota_allocator, out_usage);
+}
+
+static void iree_hal_tenant_device_destroy(iree_hal_device_t* base_device) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  iree_allocator_t host_allocator = device->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_allocator_release(device->device_allocator);
+  iree_hal_allocator_release(device->quota_allocator);
+  iree_hal_device_release(device->base_device);
+  iree_allocator_free(host_allocator, device);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_string_view_t iree_hal_tenant_device_id(
+    iree_hal_device_t* base_device) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return iree_hal_device_id(device->base_device);
+}
+
+static iree_allocator_t iree_hal_tenant_device_host_allocator(
+    iree_hal_device_t* base_device) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return device->host_allocator;
+}
+
+static iree_hal_allocator_t* iree_hal_tenant_device_allocator(
+    iree_hal_device_t* base_device) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return device->device_allocator;
+}
+
+static void iree_hal_tenant_device_replace_allocator(
+    iree_hal_device_t* base_device, iree_hal_allocator_t* new_allocator) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  iree_hal_allocator_retain(new_allocator);
+  iree_hal_allocator_release(device->device_allocator);
+  device->device_allocator = new_allocator;
+}
+
+static iree_status_t iree_hal_tenant_device_trim(
+    iree_hal_device_t* base_device) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_trim(device->device_allocator));
+  return iree_hal_device_trim(device->base_device);
+}
+
+static iree_status_t iree_hal_tenant_device_query_i64(
+    iree_hal_device_t* base_device, iree_string_view_t category,
+    iree_string_view_t key, int64_t* out_value) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return iree_hal_device_query_i64(device->base_device, category, key,
+                                   out_value);
+}
+
+static iree_status_t iree_hal_tenant_device_create_command_buffer(
+    iree_hal_device_t* base_device, iree_hal_command_buffer_mode_t mode,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t binding_capacity,
+    iree_hal_command_buffer_t** out_command_buffer) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, create_command_buffer)(
+      device->base_device, mode, command_categories, queue_affinity,
+      binding_capacity, out_command_buffer);
+}
+
+static iree_status_t iree_hal_tenant_device_create_descriptor_set(
+    iree_hal_device_t* base_device,
+    iree_hal_descriptor_set_layout_t* set_layout,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_binding_t* bindings,
+    iree_hal_descriptor_set_t** out_descriptor_set) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, create_descriptor_set)(
+      device->base_device, set_layout, binding_count, bindings,
+      out_descriptor_set);
+}
+
+static iree_status_t iree_hal_tenant_device_create_descriptor_set_layout(
+    iree_hal_device_t* base_device,
+    iree_hal_descriptor_set_layout_usage_type_t usage_type,
+    iree_host_size_t binding_count,
+    const iree_hal_descriptor_set_layout_binding_t* bindings,
+    iree_hal_descriptor_set_layout_t** out_descriptor_set_layout) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, create_descriptor_set_layout)(
+      device->base_device, usage_type, binding_count, bindings,
+      out_descriptor_set_layout);
+}
+
+static iree_status_t iree_hal_tenant_device_create_event(
+    iree_hal_device_t* base_device, iree_hal_event_t** out_event) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, create_event)(device->base_device, out_event);
+}
+
+static iree_status_t iree_hal_tenant_device_create_executable_cache(
+    iree_hal_device_t* base_device, iree_string_view_t identifier,
+    iree_loop_t loop, iree_hal_executable_cache_t** out_executable_cache) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, create_executable_cache)(
+      device->base_device, identifier, loop, out_executable_cache);
+}
+
+static iree_status_t iree_hal_tenant_device_create_executable_layout(
+    iree_hal_device_t* base_device, iree_host_size_t push_constants,
+    iree_host_size_t set_layout_count,
+    iree_hal_descriptor_set_layout_t** set_layouts,
+    iree_hal_executable_layout_t** out_executable_layout) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, create_executable_layout)(
+      device->base_device, push_constants, set_layout_count, set_layouts,
+      out_executable_layout);
+}
+
+static iree_status_t iree_hal_tenant_device_create_semaphore(
+    iree_hal_device_t* base_device, uint64_t initial_value,
+    iree_hal_semaphore_t** out_semaphore) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, create_semaphore)(device->base_device,
+                                                  initial_value, out_semaphore);
+}
+
+static iree_hal_semaphore_compatibility_t
+iree_hal_tenant_device_query_semaphore_compatibility(
+    iree_hal_device_t* base_device, iree_hal_semaphore_t* semaphore) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, query_semaphore_compatibility)(
+      device->base_device, semaphore);
+}
+
+static iree_status_t iree_hal_tenant_device_transfer_range(
+    iree_hal_device_t* base_device, iree_hal_transfer_buffer_t source,
+    iree_device_size_t source_offset, iree_hal_transfer_buffer_t target,
+    iree_device_size_t target_offset, iree_device_size_t data_length,
+    iree_hal_transfer_buffer_flags_t flags, iree_timeout_t timeout) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, transfer_range)(
+      device->base_device, source, source_offset, target, target_offset,
+      data_length, flags, timeout);
+}
+
+// Waits for |wait_semaphore_list| and then signals |signal_semaphore_list|.
+static iree_status_t iree_hal_tenant_device_queue_barrier(
+    iree_hal_tenant_device_t* device,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list) {
+  if (wait_semaphore_list.count > 0) {
+    IREE_RETURN_IF_ERROR(_BASE_DISPATCH(device, wait_semaphores)(
+        device->base_device, IREE_HAL_WAIT_MODE_ALL, &wait_semaphore_list,
+        iree_infinite_timeout()));
+  }
+  for (iree_host_size_t i = 0; i < signal_semaphore_list.count; ++i) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_semaphore_signal(signal_semaphore_list.semaphores[i],
+                                  signal_semaphore_list.payload_values[i]));
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_hal_tenant_device_queue_alloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  // The base device would allocate from its own pools and bypass the quota so
+  // the allocation is made here once the waits have been satisfied.
+  if (wait_semaphore_list.count > 0) {
+    IREE_RETURN_IF_ERROR(_BASE_DISPATCH(device, wait_semaphores)(
+        device->base_device, IREE_HAL_WAIT_MODE_ALL, &wait_semaphore_list,
+        iree_infinite_timeout()));
+  }
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
+      device->device_allocator, params, allocation_size,
+      iree_const_byte_span_empty(), &buffer));
+  iree_status_t status = iree_hal_tenant_device_queue_barrier(
+      device, iree_hal_semaphore_list_empty(), signal_semaphore_list);
+  if (iree_status_is_ok(status)) {
+    *out_buffer = buffer;
+  } else {
+    iree_hal_buffer_release(buffer);
+  }
+  return status;
+}
+
+static iree_status_t iree_hal_tenant_device_queue_dealloca(
+    iree_hal_device_t* base_device, iree_hal_queue_affinity_t queue_affinity,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    const iree_hal_semaphore_list_t signal_semaphore_list,
+    iree_hal_buffer_t* buffer) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  // Buffers from queue_alloca are regular allocations that are returned to the
+  // quota when their last reference is released.
+  return iree_hal_tenant_device_queue_barrier(device, wait_semaphore_list,
+                                              signal_semaphore_list);
+}
+
+static iree_status_t iree_hal_tenant_device_queue_submit(
+    iree_hal_device_t* base_device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
+    const iree_hal_submission_batch_t* batches) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, queue_submit)(
+      device->base_device, command_categories, queue_affinity, batch_count,
+      batches);
+}
+
+static iree_status_t iree_hal_tenant_device_submit_and_wait(
+    iree_hal_device_t* base_device,
+    iree_hal_command_category_t command_categories,
+    iree_hal_queue_affinity_t queue_affinity, iree_host_size_t batch_count,
+    const iree_hal_submission_batch_t* batches,
+    iree_hal_semaphore_t* wait_semaphore, uint64_t wait_value,
+    iree_timeout_t timeout) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, submit_and_wait)(
+      device->base_device, command_categories, queue_affinity, batch_count,
+      batches, wait_semaphore, wait_value, timeout);
+}
+
+static iree_status_t iree_hal_tenant_device_wait_semaphores(
+    iree_hal_device_t* base_device, iree_hal_wait_mode_t wait_mode,
+    const iree_hal_semaphore_list_t* semaphore_list, iree_timeout_t timeout) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, wait_semaphores)(
+      device->base_device, wait_mode, semaphore_list, timeout);
+}
+
+static iree_status_t iree_hal_tenant_device_wait_idle(
+    iree_hal_device_t* base_device, iree_timeout_t timeout) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  // NOTE: this waits for the work of all tenants as the queues are shared.
+  return _BASE_DISPATCH(device, wait_idle)(device->base_device, timeout);
+}
+
+static iree_status_t iree_hal_tenant_device_profiling_begin(
+    iree_hal_device_t* base_device,
+    const iree_hal_device_profiling_options_t* options) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, profiling_begin)(device->base_device, options);
+}
+
+static iree_status_t iree_hal_tenant_device_profiling_end(
+    iree_hal_device_t* base_device) {
+  iree_hal_tenant_device_t* device = iree_hal_tenant_device_cast(base_device);
+  return _BASE_DISPATCH(device, profiling_end)(device->base_device);
+}
+
+static const iree_hal_device_vtable_t iree_hal_tenant_device_vtable = {
+    .destroy = iree_hal_tenant_device_destroy,
+    .id = iree_hal_tenant_device_id,
+    .host_allocator = iree_hal_tenant_device_host_allocator,
+    .device_allocator = iree_hal_tenant_device_allocator,
+    .replace_device_allocator = iree_hal_tenant_device_replace_allocator,
+    .trim = iree_hal_tenant_device_trim,
+    .query_i64 = iree_hal_tenant_device_query_i64,
+    .create_command_buffer = iree_hal_tenant_device_create_command_buffer,
+    .create_descriptor_set = iree_hal_tenant_device_create_descriptor_set,
+    .create_descriptor_set_layout =
+        iree_hal_tenant_device_create_descriptor_set_layout,
+    .create_event = iree_hal_tenant_device_create_event,
+    .create_executable_cache = iree_hal_tenant_device_create_executable_cache,
+    .create_executable_layout = iree_hal_tenant_device_create_executable_layout,
+    .create_semaphore = iree_hal_tenant_device_create_semaphore,
+    .query_semaphore_compatibility =
+        iree_hal_tenant_device_query_semaphore_compatibility,
+    .transfer_range = iree_hal_tenant_device_transfer_range,
+    .queue_alloca = iree_hal_tenant_device_queue_alloca,
+    .queue_dealloca = iree_hal_tenant_device_queue_dealloca,
+    .queue_submit = iree_hal_tenant_device_queue_submit,
+    .submit_and_wait = iree_hal_tenant_device_submit_and_wait,
+    .wait_semaphores = iree_hal_tenant_device_wait_semaphores,
+    .wait_idle = iree_hal_tenant_device_wait_idle,
+    .profiling_begin = iree_hal_tenant_device_profiling_begin,
+    .profiling_end = iree_hal_tenant_device_profiling_end,
+};
@@ -0,0 +1,60 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_TENANT_DEVICE_H_
+#define IREE_HAL_UTILS_TENANT_DEVICE_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/utils/quota_allocator.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_tenant_device_t
+//===----------------------------------------------------------------------===//
+
+// Creates a device that shares |base_device| with other tenants while limiting
+// the memory it may allocate to |bytes_limit|. All operations are forwarded to
+// |base_device| except that buffers are allocated from a quota allocator (see
+// iree_hal_quota_allocator_create) wrapping the base device allocator.
+//
+// This allows multiple runtime sessions to share one device without one of
+// them being able to exhaust the device memory of all others:
+//   iree_hal_device_t* tenant_device = NULL;
+//   iree_hal_tenant_device_create(device, 256 * 1024 * 1024, host_allocator,
+//                                 &tenant_device);
+//   iree_runtime_session_create_with_device(instance, &options, tenant_device,
+//                                           host_allocator, &session);
+//
+// Queue-ordered allocations are performed synchronously on the calling thread
+// after waiting for their wait semaphores so that they are charged to the
+// quota instead of any pool owned by |base_device|.
+iree_status_t iree_hal_tenant_device_create(iree_hal_device_t* base_device,
+                                            iree_device_size_t bytes_limit,
+                                            iree_allocator_t host_allocator,
+                                            iree_hal_device_t** out_device);
+
+// Returns true if |device| is a tenant device.
+bool iree_hal_tenant_device_isa(iree_hal_device_t* device);
+
+// Returns the quota allocator that charges allocations made by |device|.
+// It remains valid for the lifetime of the device even if the device allocator
+// has been replaced with one wrapping it.
+iree_hal_allocator_t* iree_hal_tenant_device_quota_allocator(
+    iree_hal_device_t* device);
+
+// Queries the memory usage of all allocations made by |device|.
+void iree_hal_tenant_device_query_usage(
+    iree_hal_device_t* device, iree_hal_quota_allocator_usage_t* out_usage);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_TENANT_DEVICE_H_
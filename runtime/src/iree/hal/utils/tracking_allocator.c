@@ -0,0 +1,531 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/tracking_allocator.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/resource.h"
+
+// Initial capacity of the live allocation table. Must be a power of two.
+#define IREE_HAL_TRACKING_ALLOCATOR_INITIAL_CAPACITY 64
+
+// A live allocation made through the tracking allocator.
+typedef struct iree_hal_tracking_allocator_entry_t {
+  // NULL if the slot is empty.
+  iree_hal_buffer_t* buffer;
+  // The allocator the buffer was allocated from and must be returned to.
+  iree_hal_allocator_t* device_allocator;
+  iree_device_size_t allocation_size;
+  uint16_t tag_index;
+  bool is_host;
+} iree_hal_tracking_allocator_entry_t;
+
+typedef struct iree_hal_tracking_allocator_tag_t {
+  // Owned copy of the tag string; NULL for the untagged entry.
+  char* name;
+  iree_host_size_t name_length;
+  iree_hal_tracking_allocator_usage_t usage;
+} iree_hal_tracking_allocator_tag_t;
+
+typedef struct iree_hal_tracking_allocator_t {
+  iree_hal_resource_t resource;
+  iree_allocator_t host_allocator;
+  iree_hal_allocator_t* base_allocator;
+
+  iree_slim_mutex_t mutex;
+  iree_hal_tracking_allocator_usage_t usage;
+  iree_host_size_t tag_count;
+  iree_hal_tracking_allocator_tag_t tags[IREE_HAL_TRACKING_ALLOCATOR_MAX_TAGS];
+  // Open-addressed table of live allocations keyed by buffer pointer using
+  // linear probing. Its capacity is a power of two and it is kept at most 3/4
+  // full so probing always terminates.
+  iree_hal_tracking_allocator_entry_t* entries;
+  iree_host_size_t entry_capacity;
+  iree_host_size_t entry_count;
+} iree_hal_tracking_allocator_t;
+
+static const iree_hal_allocator_vtable_t iree_hal_tracking_allocator_vtable;
+
+static iree_hal_tracking_allocator_t* iree_hal_tracking_allocator_cast(
+    iree_hal_allocator_t* IREE_RESTRICT base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_tracking_allocator_vtable);
+  return (iree_hal_tracking_allocator_t*)base_value;
+}
+
+iree_status_t iree_hal_tracking_allocator_create(
+    iree_hal_allocator_t* base_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator) {
+  IREE_ASSERT_ARGUMENT(base_allocator);
+  IREE_ASSERT_ARGUMENT(out_allocator);
+  *out_allocator = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_tracking_allocator_t* allocator = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*allocator),
+                                (void**)&allocator));
+  memset(allocator, 0, sizeof(*allocator));
+  iree_hal_resource_initialize(&iree_hal_tracking_allocator_vtable,
+                               &allocator->resource);
+  allocator->host_allocator = host_allocator;
+  allocator->base_allocator = base_allocator;
+  iree_hal_allocator_retain(base_allocator);
+  iree_slim_mutex_initialize(&allocator->mutex);
+  // Tag 0 is the untagged entry.
+  allocator->tag_count = 1;
+
+  *out_allocator = (iree_hal_allocator_t*)allocator;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+bool iree_hal_tracking_allocator_isa(iree_hal_allocator_t* allocator) {
+  return iree_hal_resource_is(allocator, &iree_hal_tracking_allocator_vtable);
+}
+
+static void iree_hal_tracking_allocator_destroy(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  iree_allocator_t host_allocator = allocator->host_allocator;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  for (iree_host_size_t i = 0; i < allocator->tag_count; ++i) {
+    iree_allocator_free(host_allocator, allocator->tags[i].name);
+  }
+  iree_allocator_free(host_allocator, allocator->entries);
+  iree_slim_mutex_deinitialize(&allocator->mutex);
+  iree_hal_allocator_release(allocator->base_allocator);
+  iree_allocator_free(host_allocator, allocator);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+static iree_allocator_t iree_hal_tracking_allocator_host_allocator(
+    const iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_tracking_allocator_t* allocator =
+      (iree_hal_tracking_allocator_t*)base_allocator;
+  return allocator->host_allocator;
+}
+
+static iree_status_t iree_hal_tracking_allocator_trim(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  return iree_hal_allocator_trim(allocator->base_allocator);
+}
+
+static void iree_hal_tracking_allocator_query_statistics(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_allocator_statistics_t* IREE_RESTRICT out_statistics) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  iree_hal_allocator_query_statistics(allocator->base_allocator,
+                                      out_statistics);
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_tracking_allocator_query_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_compatibility(allocator->base_allocator,
+                                                *params, allocation_size);
+}
+
+static iree_hal_buffer_compatibility_t
+iree_hal_tracking_allocator_query_buffer_compatibility(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_buffer_usage_t intended_usage) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  return iree_hal_allocator_query_buffer_compatibility(
+      allocator->base_allocator, buffer, intended_usage);
+}
+
+// Returns the slot |buffer| would ideally be stored in within the live
+// allocation table.
+static iree_host_size_t iree_hal_tracking_allocator_home_slot(
+    iree_hal_tracking_allocator_t* allocator, iree_hal_buffer_t* buffer) {
+  // Fibonacci hashing mixes the high bits down as the low bits of buffer
+  // pointers are always zero.
+  return (iree_host_size_t)(((uint64_t)(uintptr_t)buffer *
+                             0x9E3779B97F4A7C15ull) >>
+                            32) &
+         (allocator->entry_capacity - 1);
+}
+
+// Returns the slot in the live allocation table that either holds |buffer| or
+// is the empty slot it should be inserted into.
+static iree_host_size_t iree_hal_tracking_allocator_find_slot(
+    iree_hal_tracking_allocator_t* allocator, iree_hal_buffer_t* buffer) {
+  iree_host_size_t mask = allocator->entry_capacity - 1;
+  iree_host_size_t index =
+      iree_hal_tracking_allocator_home_slot(allocator, buffer);
+  while (allocator->entries[index].buffer &&
+         allocator->entries[index].buffer != buffer) {
+    index = (index + 1) & mask;
+  }
+  return index;
+}
+
+// Ensures there is room for one more entry in the live allocation table.
+// Must be called with the lock held.
+static iree_status_t iree_hal_tracking_allocator_reserve_entry(
+    iree_hal_tracking_allocator_t* allocator) {
+  if (allocator->entry_count + 1 <=
+      allocator->entry_capacity - allocator->entry_capacity / 4) {
+    return iree_ok_status();
+  }
+  iree_host_size_t new_capacity =
+      allocator->entry_capacity ? allocator->entry_capacity * 2
+                                : IREE_HAL_TRACKING_ALLOCATOR_INITIAL_CAPACITY;
+  iree_hal_tracking_allocator_entry_t* old_entries = allocator->entries;
+  iree_host_size_t old_capacity = allocator->entry_capacity;
+  iree_hal_tracking_allocator_entry_t* new_entries = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      allocator->host_allocator, new_capacity * sizeof(*new_entries),
+      (void**)&new_entries));
+  memset(new_entries, 0, new_capacity * sizeof(*new_entries));
+  allocator->entries = new_entries;
+  allocator->entry_capacity = new_capacity;
+  for (iree_host_size_t i = 0; i < old_capacity; ++i) {
+    if (!old_entries[i].buffer) continue;
+    iree_host_size_t slot =
+        iree_hal_tracking_allocator_find_slot(allocator, old_entries[i].buffer);
+    allocator->entries[slot] = old_entries[i];
+  }
+  iree_allocator_free(allocator->host_allocator, old_entries);
+  return iree_ok_status();
+}
+
+// Removes the entry at |slot| from the live allocation table by shifting back
+// any entries that probed past it. Must be called with the lock held.
+static void iree_hal_tracking_allocator_remove_slot(
+    iree_hal_tracking_allocator_t* allocator, iree_host_size_t slot) {
+  iree_host_size_t mask = allocator->entry_capacity - 1;
+  iree_host_size_t hole = slot;
+  iree_host_size_t index = (slot + 1) & mask;
+  while (allocator->entries[index].buffer) {
+    // The entry can fill the hole if its home slot is not within the run
+    // (hole, index] as it would otherwise no longer be found by probing.
+    iree_host_size_t home = iree_hal_tracking_allocator_home_slot(
+        allocator, allocator->entries[index].buffer);
+    if (((index - home) & mask) >= ((index - hole) & mask)) {
+      allocator->entries[hole] = allocator->entries[index];
+      hole = index;
+    }
+    index = (index + 1) & mask;
+  }
+  memset(&allocator->entries[hole], 0, sizeof(allocator->entries[hole]));
+  --allocator->entry_count;
+}
+
+// Returns the index of |tag|, adding it if it has not been seen before.
+// Tags beyond the capacity (or that fail to be copied) map to the untagged
+// entry. Must be called with the lock held.
+static uint16_t iree_hal_tracking_allocator_intern_tag(
+    iree_hal_tracking_allocator_t* allocator, iree_string_view_t tag) {
+  if (iree_string_view_is_empty(tag)) return 0;
+  for (iree_host_size_t i = 1; i < allocator->tag_count; ++i) {
+    const iree_hal_tracking_allocator_tag_t* entry = &allocator->tags[i];
+    if (iree_string_view_equal(
+            tag, iree_make_string_view(entry->name, entry->name_length))) {
+      return (uint16_t)i;
+    }
+  }
+  if (allocator->tag_count >= IREE_ARRAYSIZE(allocator->tags)) return 0;
+  char* name = NULL;
+  iree_status_t status =
+      iree_allocator_malloc(allocator->host_allocator, tag.size, (void**)&name);
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    return 0;
+  }
+  memcpy(name, tag.data, tag.size);
+  iree_hal_tracking_allocator_tag_t* entry =
+      &allocator->tags[allocator->tag_count];
+  memset(entry, 0, sizeof(*entry));
+  entry->name = name;
+  entry->name_length = tag.size;
+  return (uint16_t)allocator->tag_count++;
+}
+
+static void iree_hal_tracking_allocator_usage_record_alloc(
+    iree_hal_tracking_allocator_usage_t* usage, bool is_host,
+    iree_device_size_t allocation_size) {
+  if (is_host) {
+    usage->host_bytes_live += allocation_size;
+    usage->host_bytes_peak =
+        iree_max(usage->host_bytes_peak, usage->host_bytes_live);
+  } else {
+    usage->device_bytes_live += allocation_size;
+    usage->device_bytes_peak =
+        iree_max(usage->device_bytes_peak, usage->device_bytes_live);
+  }
+  ++usage->allocation_count;
+}
+
+static void iree_hal_tracking_allocator_usage_record_free(
+    iree_hal_tracking_allocator_usage_t* usage, bool is_host,
+    iree_device_size_t allocation_size) {
+  if (is_host) {
+    usage->host_bytes_live -= allocation_size;
+  } else {
+    usage->device_bytes_live -= allocation_size;
+  }
+}
+
+static iree_status_t iree_hal_tracking_allocator_allocate_tagged(
+    iree_hal_tracking_allocator_t* allocator, iree_string_view_t tag,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size, iree_const_byte_span_t initial_data,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  // Reserve the table entry first so that tracking never fails after the
+  // buffer has been allocated.
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_status_t status = iree_hal_tracking_allocator_reserve_entry(allocator);
+  iree_slim_mutex_unlock(&allocator->mutex);
+  IREE_RETURN_IF_ERROR(status);
+
+  iree_hal_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
+      allocator->base_allocator, *params, allocation_size, initial_data,
+      &buffer));
+  if (iree_hal_buffer_allocated_buffer(buffer) != buffer) {
+    // Base allocators returning views of other allocations cannot be tracked
+    // as releases of the view do not route through the allocator.
+    *out_buffer = buffer;
+    return iree_ok_status();
+  }
+
+  iree_hal_tracking_allocator_entry_t entry = {
+      .buffer = buffer,
+      .device_allocator = buffer->device_allocator,
+      .allocation_size = iree_hal_buffer_allocation_size(buffer),
+      .is_host = iree_all_bits_set(iree_hal_buffer_memory_type(buffer),
+                                   IREE_HAL_MEMORY_TYPE_HOST_LOCAL),
+  };
+  iree_slim_mutex_lock(&allocator->mutex);
+  // Another thread may have used the reserved entry; the table only grows so
+  // reserving again only fails if the host is out of memory.
+  status = iree_hal_tracking_allocator_reserve_entry(allocator);
+  if (iree_status_is_ok(status)) {
+    entry.tag_index = iree_hal_tracking_allocator_intern_tag(allocator, tag);
+    allocator->entries[iree_hal_tracking_allocator_find_slot(
+        allocator, buffer)] = entry;
+    ++allocator->entry_count;
+    iree_hal_tracking_allocator_usage_record_alloc(
+        &allocator->usage, entry.is_host, entry.allocation_size);
+    iree_hal_tracking_allocator_usage_record_alloc(
+        &allocator->tags[entry.tag_index].usage, entry.is_host,
+        entry.allocation_size);
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+  if (!iree_status_is_ok(status)) {
+    iree_hal_buffer_release(buffer);
+    return status;
+  }
+
+  // Route releases of the buffer back to the tracking allocator; see
+  // iree_hal_buffer_recycle.
+  buffer->device_allocator = (iree_hal_allocator_t*)allocator;
+  *out_buffer = buffer;
+  return iree_ok_status();
+}
+
+iree_status_t iree_hal_tracking_allocator_allocate_buffer_tagged(
+    iree_hal_allocator_t* base_allocator, iree_string_view_t tag,
+    const iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_const_byte_span_t initial_data, iree_hal_buffer_t** out_buffer) {
+  IREE_ASSERT_ARGUMENT(base_allocator);
+  IREE_ASSERT_ARGUMENT(out_buffer);
+  *out_buffer = NULL;
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status = iree_hal_tracking_allocator_allocate_tagged(
+      allocator, tag, &params, allocation_size, initial_data, out_buffer);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static iree_status_t iree_hal_tracking_allocator_allocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_device_size_t allocation_size, iree_const_byte_span_t initial_data,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  return iree_hal_tracking_allocator_allocate_tagged(
+      allocator, iree_string_view_empty(), params, allocation_size,
+      initial_data, out_buffer);
+}
+
+static void iree_hal_tracking_allocator_deallocate_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_host_size_t slot =
+      iree_hal_tracking_allocator_find_slot(allocator, buffer);
+  iree_hal_tracking_allocator_entry_t entry = allocator->entries[slot];
+  IREE_ASSERT_EQ(entry.buffer, buffer);
+  iree_hal_tracking_allocator_remove_slot(allocator, slot);
+  iree_hal_tracking_allocator_usage_record_free(
+      &allocator->usage, entry.is_host, entry.allocation_size);
+  iree_hal_tracking_allocator_usage_record_free(
+      &allocator->tags[entry.tag_index].usage, entry.is_host,
+      entry.allocation_size);
+  iree_slim_mutex_unlock(&allocator->mutex);
+
+  buffer->device_allocator = entry.device_allocator;
+  iree_hal_allocator_deallocate_buffer(entry.device_allocator, buffer);
+}
+
+static iree_status_t iree_hal_tracking_allocator_import_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    const iree_hal_buffer_params_t* IREE_RESTRICT params,
+    iree_hal_external_buffer_t* IREE_RESTRICT external_buffer,
+    iree_hal_buffer_release_callback_t release_callback,
+    iree_hal_buffer_t** IREE_RESTRICT out_buffer) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  return iree_hal_allocator_import_buffer(allocator->base_allocator, *params,
+                                          external_buffer, release_callback,
+                                          out_buffer);
+}
+
+static iree_status_t iree_hal_tracking_allocator_export_buffer(
+    iree_hal_allocator_t* IREE_RESTRICT base_allocator,
+    iree_hal_buffer_t* IREE_RESTRICT buffer,
+    iree_hal_external_buffer_type_t requested_type,
+    iree_hal_external_buffer_flags_t requested_flags,
+    iree_hal_external_buffer_t* IREE_RESTRICT out_external_buffer) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  return iree_hal_allocator_export_buffer(allocator->base_allocator, buffer,
+                                          requested_type, requested_flags,
+                                          out_external_buffer);
+}
+
+void iree_hal_tracking_allocator_query_usage(
+    iree_hal_allocator_t* base_allocator,
+    iree_hal_tracking_allocator_usage_t* out_usage) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  iree_slim_mutex_lock(&allocator->mutex);
+  *out_usage = allocator->usage;
+  iree_slim_mutex_unlock(&allocator->mutex);
+}
+
+iree_host_size_t iree_hal_tracking_allocator_tag_count(
+    iree_hal_allocator_t* base_allocator) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_host_size_t tag_count = allocator->tag_count;
+  iree_slim_mutex_unlock(&allocator->mutex);
+  return tag_count;
+}
+
+iree_status_t iree_hal_tracking_allocator_query_tag_usage(
+    iree_hal_allocator_t* base_allocator, iree_host_size_t tag_index,
+    iree_string_view_t* out_tag,
+    iree_hal_tracking_allocator_usage_t* out_usage) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  iree_status_t status = iree_ok_status();
+  iree_slim_mutex_lock(&allocator->mutex);
+  if (tag_index < allocator->tag_count) {
+    const iree_hal_tracking_allocator_tag_t* tag = &allocator->tags[tag_index];
+    *out_tag = iree_make_string_view(tag->name, tag->name_length);
+    *out_usage = tag->usage;
+  } else {
+    status = iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "tag index %" PRIhsz " out of range (%" PRIhsz
+                              " tags)",
+                              tag_index, allocator->tag_count);
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+  return status;
+}
+
+static void iree_hal_tracking_allocator_usage_reset_peak(
+    iree_hal_tracking_allocator_usage_t* usage) {
+  usage->host_bytes_peak = usage->host_bytes_live;
+  usage->device_bytes_peak = usage->device_bytes_live;
+  usage->allocation_count = 0;
+}
+
+void iree_hal_tracking_allocator_reset_peak(
+    iree_hal_allocator_t* base_allocator) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  iree_slim_mutex_lock(&allocator->mutex);
+  iree_hal_tracking_allocator_usage_reset_peak(&allocator->usage);
+  for (iree_host_size_t i = 0; i < allocator->tag_count; ++i) {
+    iree_hal_tracking_allocator_usage_reset_peak(&allocator->tags[i].usage);
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+}
+
+static void iree_hal_tracking_allocator_usage_fprint(
+    FILE* file, iree_string_view_t name,
+    const iree_hal_tracking_allocator_usage_t* usage) {
+  fprintf(file,
+          "%12" PRIdsz "B host peak / %12" PRIdsz "B device peak / %8" PRIhsz
+          " allocations: %.*s\n",
+          usage->host_bytes_peak, usage->device_bytes_peak,
+          usage->allocation_count, (int)name.size, name.data);
+}
+
+iree_status_t iree_hal_tracking_allocator_fprint(
+    FILE* file, iree_hal_allocator_t* base_allocator) {
+  iree_hal_tracking_allocator_t* allocator =
+      iree_hal_tracking_allocator_cast(base_allocator);
+  iree_slim_mutex_lock(&allocator->mutex);
+  fprintf(file, "[[ iree_hal_tracking_allocator_t ]]\n");
+  iree_hal_tracking_allocator_usage_fprint(
+      file, IREE_SV("(total)"), &allocator->usage);
+  for (iree_host_size_t i = 0; i < allocator->tag_count; ++i) {
+    const iree_hal_tracking_allocator_tag_t* tag = &allocator->tags[i];
+    if (!tag->usage.allocation_count && !tag->usage.host_bytes_peak &&
+        !tag->usage.device_bytes_peak) {
+      continue;
+    }
+    iree_hal_tracking_allocator_usage_fprint(
+        file,
+        i == 0 ? IREE_SV("(untagged)")
+               : iree_make_string_view(tag->name, tag->name_length),
+        &tag->usage);
+  }
+  iree_slim_mutex_unlock(&allocator->mutex);
+  return iree_ok_status();
+}
+
+static const iree_hal_allocator_vtable_t iree_hal_tracking_allocator_vtable = {
+    .destroy = iree_hal_tracking_allocator_destroy,
+    .host_allocator = iree_hal_tracking_allocator_host_allocator,
+    .trim = iree_hal_tracking_allocator_trim,
+    .query_statistics = iree_hal_tracking_allocator_query_statistics,
+    .query_compatibility = iree_hal_tracking_allocator_query_compatibility,
+    .allocate_buffer = iree_hal_tracking_allocator_allocate_buffer,
+    .deallocate_buffer = iree_hal_tracking_allocator_deallocate_buffer,
+    .import_buffer = iree_hal_tracking_allocator_import_buffer,
+    .export_buffer = iree_hal_tracking_allocator_export_buffer,
+    .query_buffer_compatibility =
+        iree_hal_tracking_allocator_query_buffer_compatibility,
+};
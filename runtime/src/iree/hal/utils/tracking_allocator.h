@@ -0,0 +1,103 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_TRACKING_ALLOCATOR_H_
+#define IREE_HAL_UTILS_TRACKING_ALLOCATOR_H_
+
+#include <stdio.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_tracking_allocator_t
+//===----------------------------------------------------------------------===//
+
+// Maximum number of distinct allocation tags tracked by an allocator.
+// Allocations with tags beyond this are attributed to the untagged entry.
+#define IREE_HAL_TRACKING_ALLOCATOR_MAX_TAGS 64
+
+// Memory usage of a set of allocations. Peaks and counts are measured since
+// the allocator was created or iree_hal_tracking_allocator_reset_peak was last
+// called, whichever is later.
+typedef struct iree_hal_tracking_allocator_usage_t {
+  // Bytes currently allocated in host-local memory.
+  iree_device_size_t host_bytes_live;
+  // High-water mark of |host_bytes_live|.
+  iree_device_size_t host_bytes_peak;
+  // Bytes currently allocated in memory that is not host-local.
+  iree_device_size_t device_bytes_live;
+  // High-water mark of |device_bytes_live|.
+  iree_device_size_t device_bytes_peak;
+  // Number of allocations made.
+  iree_host_size_t allocation_count;
+} iree_hal_tracking_allocator_usage_t;
+
+// Creates an allocator that forwards all operations to |base_allocator| while
+// tracking the live and peak memory of the buffers allocated through it.
+// Unlike iree_hal_allocator_query_statistics this is available in all build
+// configurations and the peaks can be reset, e.g. to measure the high-water
+// mark of a single invocation.
+//
+// Allocations made with iree_hal_tracking_allocator_allocate_buffer_tagged
+// are also attributed to the given tag such as the program location that made
+// the allocation. All other allocations are attributed to the untagged entry
+// (tag index 0, an empty tag).
+//
+// Buffers allocated from the tracking allocator must be released before it is
+// destroyed, as is required for all allocators.
+//
+// Thread-safe; multiple threads may allocate and release concurrently.
+iree_status_t iree_hal_tracking_allocator_create(
+    iree_hal_allocator_t* base_allocator, iree_allocator_t host_allocator,
+    iree_hal_allocator_t** out_allocator);
+
+// Returns true if |allocator| is a tracking allocator.
+bool iree_hal_tracking_allocator_isa(iree_hal_allocator_t* allocator);
+
+// Allocates a buffer as with iree_hal_allocator_allocate_buffer and attributes
+// it to |tag|. The tag string is copied and need not outlive the call.
+iree_status_t iree_hal_tracking_allocator_allocate_buffer_tagged(
+    iree_hal_allocator_t* allocator, iree_string_view_t tag,
+    const iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_const_byte_span_t initial_data, iree_hal_buffer_t** out_buffer);
+
+// Queries the memory usage of all allocations made through |allocator|.
+void iree_hal_tracking_allocator_query_usage(
+    iree_hal_allocator_t* allocator,
+    iree_hal_tracking_allocator_usage_t* out_usage);
+
+// Returns the number of tags that have been seen by |allocator|, including the
+// untagged entry.
+iree_host_size_t iree_hal_tracking_allocator_tag_count(
+    iree_hal_allocator_t* allocator);
+
+// Queries the memory usage of the allocations attributed to the tag at
+// |tag_index| in [0, iree_hal_tracking_allocator_tag_count). The returned
+// |out_tag| remains valid for the lifetime of the allocator.
+iree_status_t iree_hal_tracking_allocator_query_tag_usage(
+    iree_hal_allocator_t* allocator, iree_host_size_t tag_index,
+    iree_string_view_t* out_tag,
+    iree_hal_tracking_allocator_usage_t* out_usage);
+
+// Resets all peaks to the currently live memory and all allocation counts to
+// zero such that subsequent queries report the high-water marks reached from
+// this point on.
+void iree_hal_tracking_allocator_reset_peak(iree_hal_allocator_t* allocator);
+
+// Prints the memory usage of |allocator| and each of its tags to |file|.
+iree_status_t iree_hal_tracking_allocator_fprint(
+    FILE* file, iree_hal_allocator_t* allocator);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_TRACKING_ALLOCATOR_H_
@@ -0,0 +1,187 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/tracking_allocator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+struct TrackingAllocatorTest : public ::testing::Test {
+  iree_allocator_t host_allocator = iree_allocator_system();
+  iree_hal_allocator_t* base_allocator = NULL;
+  iree_hal_allocator_t* allocator = NULL;
+
+  void SetUp() override {
+    IREE_ASSERT_OK(iree_hal_allocator_create_heap(
+        iree_make_cstring_view("heap"), host_allocator, host_allocator,
+        &base_allocator));
+    IREE_ASSERT_OK(iree_hal_tracking_allocator_create(
+        base_allocator, host_allocator, &allocator));
+  }
+
+  void TearDown() override {
+    iree_hal_allocator_release(allocator);
+    iree_hal_allocator_release(base_allocator);
+  }
+
+  iree_hal_buffer_params_t MakeParams(iree_hal_memory_type_t type) {
+    iree_hal_buffer_params_t params = {0};
+    params.type = type;
+    params.usage =
+        IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+    return params;
+  }
+
+  iree_hal_buffer_t* Allocate(iree_device_size_t allocation_size,
+                              const char* tag = NULL,
+                              iree_hal_memory_type_t type =
+                                  IREE_HAL_MEMORY_TYPE_HOST_LOCAL |
+                                  IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE) {
+    iree_hal_buffer_t* buffer = NULL;
+    if (tag) {
+      IREE_CHECK_OK(iree_hal_tracking_allocator_allocate_buffer_tagged(
+          allocator, iree_make_cstring_view(tag), MakeParams(type),
+          allocation_size, iree_const_byte_span_empty(), &buffer));
+    } else {
+      IREE_CHECK_OK(iree_hal_allocator_allocate_buffer(
+          allocator, MakeParams(type), allocation_size,
+          iree_const_byte_span_empty(), &buffer));
+    }
+    return buffer;
+  }
+
+  iree_hal_tracking_allocator_usage_t QueryUsage() {
+    iree_hal_tracking_allocator_usage_t usage;
+    iree_hal_tracking_allocator_query_usage(allocator, &usage);
+    return usage;
+  }
+};
+
+// Tests that live and peak bytes follow allocations and releases.
+TEST_F(TrackingAllocatorTest, LiveAndPeak) {
+  EXPECT_TRUE(iree_hal_tracking_allocator_isa(allocator));
+  EXPECT_FALSE(iree_hal_tracking_allocator_isa(base_allocator));
+
+  iree_hal_buffer_t* buffer0 = Allocate(100);
+  iree_hal_buffer_t* buffer1 = Allocate(200);
+  iree_hal_tracking_allocator_usage_t usage = QueryUsage();
+  EXPECT_EQ(usage.host_bytes_live, 300);
+  EXPECT_EQ(usage.host_bytes_peak, 300);
+  EXPECT_EQ(usage.device_bytes_live, 0);
+  EXPECT_EQ(usage.allocation_count, 2);
+
+  iree_hal_buffer_release(buffer0);
+  usage = QueryUsage();
+  EXPECT_EQ(usage.host_bytes_live, 200);
+  EXPECT_EQ(usage.host_bytes_peak, 300);
+
+  iree_hal_buffer_t* buffer2 =
+      Allocate(64, NULL,
+               IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL |
+                   IREE_HAL_MEMORY_TYPE_HOST_VISIBLE);
+  usage = QueryUsage();
+  EXPECT_EQ(usage.device_bytes_live, 64);
+  EXPECT_EQ(usage.device_bytes_peak, 64);
+
+  iree_hal_buffer_release(buffer1);
+  iree_hal_buffer_release(buffer2);
+  usage = QueryUsage();
+  EXPECT_EQ(usage.host_bytes_live, 0);
+  EXPECT_EQ(usage.device_bytes_live, 0);
+  EXPECT_EQ(usage.host_bytes_peak, 300);
+  EXPECT_EQ(usage.device_bytes_peak, 64);
+}
+
+// Tests that resetting the peak measures the high-water mark from that point.
+TEST_F(TrackingAllocatorTest, ResetPeak) {
+  iree_hal_buffer_t* persistent = Allocate(1000);
+  iree_hal_buffer_t* transient = Allocate(500);
+  iree_hal_buffer_release(transient);
+
+  iree_hal_tracking_allocator_reset_peak(allocator);
+  iree_hal_tracking_allocator_usage_t usage = QueryUsage();
+  EXPECT_EQ(usage.host_bytes_peak, 1000);
+  EXPECT_EQ(usage.allocation_count, 0);
+
+  transient = Allocate(100);
+  iree_hal_buffer_release(transient);
+  usage = QueryUsage();
+  EXPECT_EQ(usage.host_bytes_live, 1000);
+  EXPECT_EQ(usage.host_bytes_peak, 1100);
+  EXPECT_EQ(usage.allocation_count, 1);
+
+  iree_hal_buffer_release(persistent);
+}
+
+// Tests that allocations are attributed to their tags.
+TEST_F(TrackingAllocatorTest, Tags) {
+  iree_hal_buffer_t* buffer0 = Allocate(100, "a");
+  iree_hal_buffer_t* buffer1 = Allocate(200, "b");
+  iree_hal_buffer_t* buffer2 = Allocate(300, "a");
+  iree_hal_buffer_t* buffer3 = Allocate(400);
+  iree_hal_buffer_release(buffer2);
+
+  ASSERT_EQ(iree_hal_tracking_allocator_tag_count(allocator), 3);
+  iree_string_view_t tag;
+  iree_hal_tracking_allocator_usage_t usage;
+  IREE_ASSERT_OK(
+      iree_hal_tracking_allocator_query_tag_usage(allocator, 0, &tag, &usage));
+  EXPECT_TRUE(iree_string_view_is_empty(tag));
+  EXPECT_EQ(usage.host_bytes_live, 400);
+  IREE_ASSERT_OK(
+      iree_hal_tracking_allocator_query_tag_usage(allocator, 1, &tag, &usage));
+  EXPECT_TRUE(iree_string_view_equal(tag, IREE_SV("a")));
+  EXPECT_EQ(usage.host_bytes_live, 100);
+  EXPECT_EQ(usage.host_bytes_peak, 400);
+  EXPECT_EQ(usage.allocation_count, 2);
+  IREE_ASSERT_OK(
+      iree_hal_tracking_allocator_query_tag_usage(allocator, 2, &tag, &usage));
+  EXPECT_TRUE(iree_string_view_equal(tag, IREE_SV("b")));
+  EXPECT_EQ(usage.host_bytes_live, 200);
+  EXPECT_THAT(Status(iree_hal_tracking_allocator_query_tag_usage(
+                  allocator, 3, &tag, &usage)),
+              StatusIs(StatusCode::kOutOfRange));
+
+  iree_hal_buffer_release(buffer0);
+  iree_hal_buffer_release(buffer1);
+  iree_hal_buffer_release(buffer3);
+}
+
+// Tests that many live allocations are tracked across table growth and
+// releases in arbitrary order.
+TEST_F(TrackingAllocatorTest, ManyAllocations) {
+  std::vector<iree_hal_buffer_t*> buffers;
+  for (int i = 0; i < 1000; ++i) {
+    buffers.push_back(Allocate(16));
+  }
+  EXPECT_EQ(QueryUsage().host_bytes_live, 1000 * 16);
+  for (size_t i = 0; i < buffers.size(); i += 2) {
+    iree_hal_buffer_release(buffers[i]);
+  }
+  EXPECT_EQ(QueryUsage().host_bytes_live, 500 * 16);
+  for (size_t i = 1; i < buffers.size(); i += 2) {
+    iree_hal_buffer_release(buffers[i]);
+  }
+  iree_hal_tracking_allocator_usage_t usage = QueryUsage();
+  EXPECT_EQ(usage.host_bytes_live, 0);
+  EXPECT_EQ(usage.host_bytes_peak, 1000 * 16);
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
@@ -0,0 +1,380 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/transient_buffer_pool.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/hal/detail.h"
+
+#define _VTABLE_DISPATCH(buffer, method_name) \
+  IREE_HAL_VTABLE_DISPATCH(buffer, iree_hal_buffer, method_name)
+
+//===----------------------------------------------------------------------===//
+// iree_hal_transient_buffer_t
+//===----------------------------------------------------------------------===//
+
+// A buffer referencing the entire storage of a pooled device allocation.
+// Behaves like a subspan buffer of the allocation and is only distinguished
+// from one so that deallocation can verify the buffer came from a pool.
+typedef struct iree_hal_transient_buffer_t {
+  iree_hal_buffer_t base;
+  // Set once the buffer has been returned to the pool with
+  // iree_hal_transient_buffer_pool_release. Guarded by the pool mutex.
+  bool is_deallocated;
+} iree_hal_transient_buffer_t;
+
+static const iree_hal_buffer_vtable_t iree_hal_transient_buffer_vtable;
+
+static iree_hal_transient_buffer_t* iree_hal_transient_buffer_cast(
+    iree_hal_buffer_t* base_value) {
+  IREE_HAL_ASSERT_TYPE(base_value, &iree_hal_transient_buffer_vtable);
+  return (iree_hal_transient_buffer_t*)base_value;
+}
+
+static iree_status_t iree_hal_transient_buffer_create(
+    iree_hal_buffer_t* allocated_buffer, iree_device_size_t byte_length,
+    iree_allocator_t host_allocator, iree_hal_buffer_t** out_buffer) {
+  iree_hal_transient_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_allocator_malloc(host_allocator, sizeof(*buffer), (void**)&buffer));
+  iree_hal_buffer_initialize(
+      host_allocator, /*device_allocator=*/NULL, allocated_buffer,
+      allocated_buffer->allocation_size, /*byte_offset=*/0, byte_length,
+      allocated_buffer->memory_type, allocated_buffer->allowed_access,
+      allocated_buffer->allowed_usage, &iree_hal_transient_buffer_vtable,
+      &buffer->base);
+  buffer->is_deallocated = false;
+  *out_buffer = &buffer->base;
+  return iree_ok_status();
+}
+
+bool iree_hal_transient_buffer_isa(iree_hal_buffer_t* buffer) {
+  return iree_hal_resource_is(buffer, &iree_hal_transient_buffer_vtable);
+}
+
+static void iree_hal_transient_buffer_destroy(iree_hal_buffer_t* base_buffer) {
+  iree_allocator_t host_allocator = base_buffer->host_allocator;
+  iree_hal_buffer_release(base_buffer->allocated_buffer);
+  iree_allocator_free(host_allocator, base_buffer);
+}
+
+static iree_status_t iree_hal_transient_buffer_map_range(
+    iree_hal_buffer_t* buffer, iree_hal_mapping_mode_t mapping_mode,
+    iree_hal_memory_access_t memory_access,
+    iree_device_size_t local_byte_offset, iree_device_size_t local_byte_length,
+    iree_hal_buffer_mapping_t* mapping) {
+  return _VTABLE_DISPATCH(buffer->allocated_buffer, map_range)(
+      buffer->allocated_buffer, mapping_mode, memory_access, local_byte_offset,
+      local_byte_length, mapping);
+}
+
+static iree_status_t iree_hal_transient_buffer_unmap_range(
+    iree_hal_buffer_t* buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length, iree_hal_buffer_mapping_t* mapping) {
+  return _VTABLE_DISPATCH(buffer->allocated_buffer, unmap_range)(
+      buffer->allocated_buffer, local_byte_offset, local_byte_length, mapping);
+}
+
+static iree_status_t iree_hal_transient_buffer_invalidate_range(
+    iree_hal_buffer_t* buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length) {
+  return _VTABLE_DISPATCH(buffer->allocated_buffer, invalidate_range)(
+      buffer->allocated_buffer, local_byte_offset, local_byte_length);
+}
+
+static iree_status_t iree_hal_transient_buffer_flush_range(
+    iree_hal_buffer_t* buffer, iree_device_size_t local_byte_offset,
+    iree_device_size_t local_byte_length) {
+  return _VTABLE_DISPATCH(buffer->allocated_buffer, flush_range)(
+      buffer->allocated_buffer, local_byte_offset, local_byte_length);
+}
+
+static const iree_hal_buffer_vtable_t iree_hal_transient_buffer_vtable = {
+    .recycle = iree_hal_buffer_recycle,
+    .destroy = iree_hal_transient_buffer_destroy,
+    .map_range = iree_hal_transient_buffer_map_range,
+    .unmap_range = iree_hal_transient_buffer_unmap_range,
+    .invalidate_range = iree_hal_transient_buffer_invalidate_range,
+    .flush_range = iree_hal_transient_buffer_flush_range,
+};
+
+//===----------------------------------------------------------------------===//
+// iree_hal_transient_buffer_pool_t
+//===----------------------------------------------------------------------===//
+
+// Storage returned to the pool that may be reused once all timepoints have been
+// reached. Allocated from the host allocator with the timepoints stored inline.
+typedef struct iree_hal_transient_buffer_pool_entry_t {
+  struct iree_hal_transient_buffer_pool_entry_t* next;
+  // Retained device allocation.
+  iree_hal_buffer_t* allocated_buffer;
+  // Retained semaphores and the payloads after which the storage is unused.
+  iree_host_size_t timepoint_count;
+  iree_hal_semaphore_t** semaphores;
+  uint64_t* payload_values;
+} iree_hal_transient_buffer_pool_entry_t;
+
+struct iree_hal_transient_buffer_pool_t {
+  iree_allocator_t host_allocator;
+  iree_hal_allocator_t* device_allocator;
+
+  iree_slim_mutex_t mutex;
+  // Entries in the order they were released; older entries are more likely to
+  // have their timepoints reached and are checked first.
+  iree_hal_transient_buffer_pool_entry_t* entry_head;
+  iree_hal_transient_buffer_pool_entry_t* entry_tail;
+};
+
+iree_status_t iree_hal_transient_buffer_pool_create(
+    iree_hal_allocator_t* device_allocator, iree_allocator_t host_allocator,
+    iree_hal_transient_buffer_pool_t** out_pool) {
+  IREE_ASSERT_ARGUMENT(device_allocator);
+  IREE_ASSERT_ARGUMENT(out_pool);
+  *out_pool = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_transient_buffer_pool_t* pool = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*pool), (void**)&pool));
+  pool->host_allocator = host_allocator;
+  pool->device_allocator = device_allocator;
+  iree_hal_allocator_retain(device_allocator);
+  iree_slim_mutex_initialize(&pool->mutex);
+  pool->entry_head = NULL;
+  pool->entry_tail = NULL;
+  *out_pool = pool;
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_hal_transient_buffer_pool_entry_free(
+    iree_hal_transient_buffer_pool_t* pool,
+    iree_hal_transient_buffer_pool_entry_t* entry) {
+  for (iree_host_size_t i = 0; i < entry->timepoint_count; ++i) {
+    iree_hal_semaphore_release(entry->semaphores[i]);
+  }
+  iree_hal_buffer_release(entry->allocated_buffer);
+  iree_allocator_free(pool->host_allocator, entry);
+}
+
+void iree_hal_transient_buffer_pool_free(
+    iree_hal_transient_buffer_pool_t* pool) {
+  if (!pool) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_hal_transient_buffer_pool_entry_t* entry = pool->entry_head;
+  while (entry) {
+    iree_hal_transient_buffer_pool_entry_t* next = entry->next;
+    iree_hal_transient_buffer_pool_entry_free(pool, entry);
+    entry = next;
+  }
+  iree_slim_mutex_deinitialize(&pool->mutex);
+  iree_hal_allocator_release(pool->device_allocator);
+  iree_allocator_free(pool->host_allocator, pool);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Returns true if all timepoints of |entry| have been reached or are waited on
+// by |wait_semaphore_list|. Failed semaphores are never considered reached.
+static bool iree_hal_transient_buffer_pool_entry_is_available(
+    const iree_hal_transient_buffer_pool_entry_t* entry,
+    const iree_hal_semaphore_list_t wait_semaphore_list) {
+  for (iree_host_size_t i = 0; i < entry->timepoint_count; ++i) {
+    bool is_waited = false;
+    for (iree_host_size_t j = 0; j < wait_semaphore_list.count; ++j) {
+      if (wait_semaphore_list.semaphores[j] == entry->semaphores[i] &&
+          wait_semaphore_list.payload_values[j] >= entry->payload_values[i]) {
+        is_waited = true;
+        break;
+      }
+    }
+    if (is_waited) continue;
+    uint64_t current_value = 0;
+    iree_status_t status =
+        iree_hal_semaphore_query(entry->semaphores[i], &current_value);
+    if (!iree_status_is_ok(status)) {
+      iree_status_ignore(status);
+      return false;
+    }
+    if (current_value < entry->payload_values[i]) return false;
+  }
+  return true;
+}
+
+// Returns true if the storage of |allocated_buffer| can be used for an
+// allocation of |allocation_size| bytes with |params|. Storage more than twice
+// the size required is not used to avoid pinning large allocations with small
+// ones.
+static bool iree_hal_transient_buffer_pool_is_compatible(
+    iree_hal_buffer_t* allocated_buffer, iree_hal_buffer_params_t params,
+    iree_device_size_t allocation_size) {
+  iree_device_size_t storage_size =
+      iree_hal_buffer_allocation_size(allocated_buffer);
+  if (storage_size < allocation_size || storage_size / 2 > allocation_size) {
+    return false;
+  }
+  // The optimal bit is a placement hint and not retained by allocations.
+  return iree_all_bits_set(iree_hal_buffer_memory_type(allocated_buffer),
+                           params.type & ~IREE_HAL_MEMORY_TYPE_OPTIMAL) &&
+         iree_all_bits_set(iree_hal_buffer_allowed_usage(allocated_buffer),
+                           params.usage) &&
+         iree_all_bits_set(iree_hal_buffer_allowed_access(allocated_buffer),
+                           params.access);
+}
+
+iree_status_t iree_hal_transient_buffer_pool_acquire(
+    iree_hal_transient_buffer_pool_t* pool, iree_hal_buffer_params_t params,
+    iree_device_size_t allocation_size,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    iree_hal_buffer_t** out_buffer) {
+  IREE_ASSERT_ARGUMENT(pool);
+  IREE_ASSERT_ARGUMENT(out_buffer);
+  *out_buffer = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)allocation_size);
+
+  // Try to find compatible storage that is no longer in use.
+  iree_hal_transient_buffer_pool_entry_t* reused_entry = NULL;
+  iree_slim_mutex_lock(&pool->mutex);
+  iree_hal_transient_buffer_pool_entry_t* prev_entry = NULL;
+  for (iree_hal_transient_buffer_pool_entry_t* entry = pool->entry_head;
+       entry != NULL; prev_entry = entry, entry = entry->next) {
+    if (!iree_hal_transient_buffer_pool_is_compatible(
+            entry->allocated_buffer, params, allocation_size) ||
+        !iree_hal_transient_buffer_pool_entry_is_available(
+            entry, wait_semaphore_list)) {
+      continue;
+    }
+    if (prev_entry) {
+      prev_entry->next = entry->next;
+    } else {
+      pool->entry_head = entry->next;
+    }
+    if (pool->entry_tail == entry) pool->entry_tail = prev_entry;
+    reused_entry = entry;
+    break;
+  }
+  iree_slim_mutex_unlock(&pool->mutex);
+
+  iree_hal_buffer_t* allocated_buffer = NULL;
+  iree_status_t status = iree_ok_status();
+  if (reused_entry) {
+    allocated_buffer = reused_entry->allocated_buffer;
+    iree_hal_buffer_retain(allocated_buffer);
+    iree_hal_transient_buffer_pool_entry_free(pool, reused_entry);
+  } else {
+    status = iree_hal_allocator_allocate_buffer(
+        pool->device_allocator, params, allocation_size,
+        iree_const_byte_span_empty(), &allocated_buffer);
+  }
+
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_transient_buffer_create(
+        allocated_buffer, allocation_size, pool->host_allocator, out_buffer);
+  }
+  iree_hal_buffer_release(allocated_buffer);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_hal_transient_buffer_pool_release(
+    iree_hal_transient_buffer_pool_t* pool, iree_hal_buffer_t* base_buffer,
+    const iree_hal_semaphore_list_t semaphore_list) {
+  IREE_ASSERT_ARGUMENT(pool);
+  IREE_ASSERT_ARGUMENT(base_buffer);
+  if (!iree_hal_transient_buffer_isa(base_buffer)) return iree_ok_status();
+  iree_hal_transient_buffer_t* buffer =
+      iree_hal_transient_buffer_cast(base_buffer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_hal_transient_buffer_pool_entry_t* entry = NULL;
+  iree_host_size_t total_size =
+      sizeof(*entry) + semaphore_list.count * (sizeof(*entry->semaphores) +
+                                               sizeof(*entry->payload_values));
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(pool->host_allocator, total_size,
+                                (void**)&entry));
+  entry->next = NULL;
+  entry->allocated_buffer = base_buffer->allocated_buffer;
+  entry->timepoint_count = semaphore_list.count;
+  entry->payload_values = (uint64_t*)((uint8_t*)entry + sizeof(*entry));
+  entry->semaphores =
+      (iree_hal_semaphore_t**)(entry->payload_values + semaphore_list.count);
+  for (iree_host_size_t i = 0; i < semaphore_list.count; ++i) {
+    entry->semaphores[i] = semaphore_list.semaphores[i];
+    entry->payload_values[i] = semaphore_list.payload_values[i];
+  }
+
+  iree_status_t status = iree_ok_status();
+  iree_slim_mutex_lock(&pool->mutex);
+  if (buffer->is_deallocated) {
+    status = iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                              "transient buffer has already been deallocated");
+  } else {
+    buffer->is_deallocated = true;
+    iree_hal_buffer_retain(entry->allocated_buffer);
+    for (iree_host_size_t i = 0; i < entry->timepoint_count; ++i) {
+      iree_hal_semaphore_retain(entry->semaphores[i]);
+    }
+    if (pool->entry_tail) {
+      pool->entry_tail->next = entry;
+    } else {
+      pool->entry_head = entry;
+    }
+    pool->entry_tail = entry;
+  }
+  iree_slim_mutex_unlock(&pool->mutex);
+  if (!iree_status_is_ok(status)) {
+    iree_allocator_free(pool->host_allocator, entry);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+void iree_hal_transient_buffer_pool_trim(
+    iree_hal_transient_buffer_pool_t* pool) {
+  IREE_ASSERT_ARGUMENT(pool);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Unlink all available entries and free them outside of the lock as
+  // releasing the storage may call back into the device allocator.
+  iree_hal_transient_buffer_pool_entry_t* free_head = NULL;
+  iree_slim_mutex_lock(&pool->mutex);
+  iree_hal_transient_buffer_pool_entry_t* prev_entry = NULL;
+  iree_hal_transient_buffer_pool_entry_t* entry = pool->entry_head;
+  while (entry) {
+    iree_hal_transient_buffer_pool_entry_t* next = entry->next;
+    if (iree_hal_transient_buffer_pool_entry_is_available(
+            entry, iree_hal_semaphore_list_empty())) {
+      if (prev_entry) {
+        prev_entry->next = next;
+      } else {
+        pool->entry_head = next;
+      }
+      if (pool->entry_tail == entry) pool->entry_tail = prev_entry;
+      entry->next = free_head;
+      free_head = entry;
+    } else {
+      prev_entry = entry;
+    }
+    entry = next;
+  }
+  iree_slim_mutex_unlock(&pool->mutex);
+
+  while (free_head) {
+    iree_hal_transient_buffer_pool_entry_t* next = free_head->next;
+    iree_hal_transient_buffer_pool_entry_free(pool, free_head);
+    free_head = next;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+}
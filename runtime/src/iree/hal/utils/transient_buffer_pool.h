@@ -0,0 +1,90 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_HAL_UTILS_TRANSIENT_BUFFER_POOL_H_
+#define IREE_HAL_UTILS_TRANSIENT_BUFFER_POOL_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_hal_transient_buffer_pool_t
+//===----------------------------------------------------------------------===//
+
+// A pool of device allocations backing queue-ordered transient buffers.
+// Devices use this to implement iree_hal_device_queue_alloca and
+// iree_hal_device_queue_dealloca by recycling the storage of deallocated
+// transient buffers in later allocations without round-tripping through the
+// device allocator.
+//
+// Deallocated storage is tracked along with the timepoints (semaphore payloads)
+// after which it is no longer in use by the queue. Storage is reused by an
+// allocation when each timepoint has either been reached or is waited on by the
+// allocation: in the latter case any work using the allocated buffer is ordered
+// after the work that used the storage previously and no host synchronization
+// is required.
+//
+// Transient buffers returned by the pool reference the underlying device
+// allocation as their allocated buffer such that they can be used anywhere a
+// normal buffer allocated from the device allocator can be. Transient buffers
+// that are released without being deallocated return their storage to the
+// device allocator.
+//
+// Thread-safe; multiple threads may acquire and release concurrently.
+typedef struct iree_hal_transient_buffer_pool_t
+    iree_hal_transient_buffer_pool_t;
+
+// Creates a transient buffer pool allocating storage from |device_allocator|.
+iree_status_t iree_hal_transient_buffer_pool_create(
+    iree_hal_allocator_t* device_allocator, iree_allocator_t host_allocator,
+    iree_hal_transient_buffer_pool_t** out_pool);
+
+// Frees |pool| and all storage it retains.
+// Transient buffers acquired from the pool may outlive it.
+void iree_hal_transient_buffer_pool_free(
+    iree_hal_transient_buffer_pool_t* pool);
+
+// Acquires a transient buffer of |allocation_size| bytes compatible with
+// |params|. Storage is reused from the pool if a compatible allocation is
+// available once all of the semaphores in |wait_semaphore_list| have been
+// reached and otherwise a new allocation is made from the device allocator.
+//
+// The contents of the returned buffer are undefined.
+// |out_buffer| must be released by the caller.
+iree_status_t iree_hal_transient_buffer_pool_acquire(
+    iree_hal_transient_buffer_pool_t* pool, iree_hal_buffer_params_t params,
+    iree_device_size_t allocation_size,
+    const iree_hal_semaphore_list_t wait_semaphore_list,
+    iree_hal_buffer_t** out_buffer);
+
+// Returns the storage backing the transient |buffer| to the pool for reuse once
+// all of the semaphores in |semaphore_list| have been reached.
+// An empty |semaphore_list| makes the storage available immediately.
+//
+// |buffer| must not be used after this call though the caller must still
+// release its reference. Buffers not acquired from a transient buffer pool are
+// ignored.
+iree_status_t iree_hal_transient_buffer_pool_release(
+    iree_hal_transient_buffer_pool_t* pool, iree_hal_buffer_t* buffer,
+    const iree_hal_semaphore_list_t semaphore_list);
+
+// Returns all storage that is no longer in use by the queue to the device
+// allocator.
+void iree_hal_transient_buffer_pool_trim(
+    iree_hal_transient_buffer_pool_t* pool);
+
+// Returns true if |buffer| is a transient buffer acquired from a pool.
+bool iree_hal_transient_buffer_isa(iree_hal_buffer_t* buffer);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_HAL_UTILS_TRANSIENT_BUFFER_POOL_H_
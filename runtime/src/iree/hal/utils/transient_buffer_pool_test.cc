@@ -0,0 +1,260 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/hal/utils/transient_buffer_pool.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/hal/utils/semaphore_base.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+namespace iree {
+namespace hal {
+namespace {
+
+using ::iree::testing::status::StatusIs;
+
+namespace {
+extern const iree_hal_semaphore_vtable_t test_semaphore_vtable;
+}  // namespace
+
+// Semaphore that only tracks its current value; waits are not supported.
+struct TestSemaphore {
+  iree_hal_semaphore_t base;
+  iree_allocator_t host_allocator;
+  uint64_t current_value;
+
+  static TestSemaphore* Create(uint64_t initial_value,
+                               iree_allocator_t host_allocator) {
+    TestSemaphore* semaphore = nullptr;
+    IREE_CHECK_OK(iree_allocator_malloc(host_allocator, sizeof(*semaphore),
+                                        (void**)&semaphore));
+    iree_hal_semaphore_initialize(&test_semaphore_vtable, &semaphore->base);
+    semaphore->host_allocator = host_allocator;
+    semaphore->current_value = initial_value;
+    return semaphore;
+  }
+
+  static TestSemaphore* Cast(iree_hal_semaphore_t* base_semaphore) {
+    return reinterpret_cast<TestSemaphore*>(base_semaphore);
+  }
+
+  static void Destroy(iree_hal_semaphore_t* base_semaphore) {
+    auto* semaphore = Cast(base_semaphore);
+    iree_hal_semaphore_deinitialize(&semaphore->base);
+    iree_allocator_free(semaphore->host_allocator, semaphore);
+  }
+
+  static iree_status_t Query(iree_hal_semaphore_t* base_semaphore,
+                             uint64_t* out_value) {
+    *out_value = Cast(base_semaphore)->current_value;
+    return iree_ok_status();
+  }
+
+  static iree_status_t Signal(iree_hal_semaphore_t* base_semaphore,
+                              uint64_t new_value) {
+    Cast(base_semaphore)->current_value = new_value;
+    return iree_ok_status();
+  }
+
+  static void Fail(iree_hal_semaphore_t* base_semaphore, iree_status_t status) {
+    iree_status_ignore(status);
+  }
+
+  static iree_status_t Wait(iree_hal_semaphore_t* base_semaphore,
+                            uint64_t value, iree_timeout_t timeout) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED);
+  }
+
+  constexpr operator iree_hal_semaphore_t*() noexcept { return &base; }
+};
+
+namespace {
+const iree_hal_semaphore_vtable_t test_semaphore_vtable = {
+    /*.destroy=*/TestSemaphore::Destroy,
+    /*.query=*/TestSemaphore::Query,
+    /*.signal=*/TestSemaphore::Signal,
+    /*.fail=*/TestSemaphore::Fail,
+    /*.wait=*/TestSemaphore::Wait,
+};
+}  // namespace
+
+struct TransientBufferPoolTest : public ::testing::Test {
+  iree_allocator_t host_allocator = iree_allocator_system();
+  iree_hal_allocator_t* device_allocator = NULL;
+  iree_hal_transient_buffer_pool_t* pool = NULL;
+
+  void SetUp() override {
+    IREE_ASSERT_OK(iree_hal_allocator_create_heap(
+        iree_make_cstring_view("heap"), host_allocator, host_allocator,
+        &device_allocator));
+    IREE_ASSERT_OK(iree_hal_transient_buffer_pool_create(
+        device_allocator, host_allocator, &pool));
+  }
+
+  void TearDown() override {
+    iree_hal_transient_buffer_pool_free(pool);
+    iree_hal_allocator_release(device_allocator);
+  }
+
+  iree_hal_buffer_params_t MakeParams() {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+    params.usage =
+        IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+    iree_hal_buffer_params_canonicalize(&params);
+    return params;
+  }
+
+  // Acquires a buffer and returns its allocated buffer for identity checks.
+  iree_hal_buffer_t* Acquire(iree_device_size_t allocation_size,
+                             iree_hal_semaphore_list_t wait_semaphore_list,
+                             iree_hal_buffer_t** out_buffer) {
+    IREE_CHECK_OK(iree_hal_transient_buffer_pool_acquire(
+        pool, MakeParams(), allocation_size, wait_semaphore_list, out_buffer));
+    return iree_hal_buffer_allocated_buffer(*out_buffer);
+  }
+};
+
+// Tests that released storage is reused immediately when not gated.
+TEST_F(TransientBufferPoolTest, ReuseImmediate) {
+  iree_hal_buffer_t* buffer0 = NULL;
+  iree_hal_buffer_t* storage0 =
+      Acquire(128, iree_hal_semaphore_list_empty(), &buffer0);
+  EXPECT_TRUE(iree_hal_transient_buffer_isa(buffer0));
+  EXPECT_EQ(iree_hal_buffer_byte_length(buffer0), 128);
+  IREE_ASSERT_OK(iree_hal_transient_buffer_pool_release(
+      pool, buffer0, iree_hal_semaphore_list_empty()));
+  iree_hal_buffer_release(buffer0);
+
+  iree_hal_buffer_t* buffer1 = NULL;
+  iree_hal_buffer_t* storage1 =
+      Acquire(100, iree_hal_semaphore_list_empty(), &buffer1);
+  EXPECT_EQ(storage0, storage1);
+  EXPECT_EQ(iree_hal_buffer_byte_length(buffer1), 100);
+  iree_hal_buffer_release(buffer1);
+}
+
+// Tests that storage is not reused for much smaller or larger allocations.
+TEST_F(TransientBufferPoolTest, SizeMismatch) {
+  iree_hal_buffer_t* buffer0 = NULL;
+  iree_hal_buffer_t* storage0 =
+      Acquire(1024, iree_hal_semaphore_list_empty(), &buffer0);
+  IREE_ASSERT_OK(iree_hal_transient_buffer_pool_release(
+      pool, buffer0, iree_hal_semaphore_list_empty()));
+  iree_hal_buffer_release(buffer0);
+
+  iree_hal_buffer_t* small_buffer = NULL;
+  EXPECT_NE(storage0,
+            Acquire(16, iree_hal_semaphore_list_empty(), &small_buffer));
+  iree_hal_buffer_t* large_buffer = NULL;
+  EXPECT_NE(storage0,
+            Acquire(2048, iree_hal_semaphore_list_empty(), &large_buffer));
+  iree_hal_buffer_release(small_buffer);
+  iree_hal_buffer_release(large_buffer);
+}
+
+// Tests that gated storage is only reused once its timepoint is reached or
+// waited on by the allocation.
+TEST_F(TransientBufferPoolTest, ReuseGated) {
+  auto* semaphore = TestSemaphore::Create(0ull, host_allocator);
+  iree_hal_semaphore_t* semaphore_ptr = *semaphore;
+  uint64_t payload_value = 1ull;
+  iree_hal_semaphore_list_t semaphore_list = {1, &semaphore_ptr,
+                                              &payload_value};
+
+  iree_hal_buffer_t* buffer0 = NULL;
+  iree_hal_buffer_t* storage0 =
+      Acquire(128, iree_hal_semaphore_list_empty(), &buffer0);
+  IREE_ASSERT_OK(
+      iree_hal_transient_buffer_pool_release(pool, buffer0, semaphore_list));
+  iree_hal_buffer_release(buffer0);
+
+  // Not yet reached: new storage is allocated.
+  iree_hal_buffer_t* buffer1 = NULL;
+  EXPECT_NE(storage0, Acquire(128, iree_hal_semaphore_list_empty(), &buffer1));
+  iree_hal_buffer_release(buffer1);
+
+  // Waited on by the allocation: storage is reused without being reached.
+  iree_hal_buffer_t* buffer2 = NULL;
+  EXPECT_EQ(storage0, Acquire(128, semaphore_list, &buffer2));
+  IREE_ASSERT_OK(
+      iree_hal_transient_buffer_pool_release(pool, buffer2, semaphore_list));
+  iree_hal_buffer_release(buffer2);
+
+  // Reached: storage is reused.
+  IREE_ASSERT_OK(iree_hal_semaphore_signal(*semaphore, 1ull));
+  iree_hal_buffer_t* buffer3 = NULL;
+  EXPECT_EQ(storage0, Acquire(128, iree_hal_semaphore_list_empty(), &buffer3));
+  iree_hal_buffer_release(buffer3);
+
+  iree_hal_semaphore_release(*semaphore);
+}
+
+// Tests that trimming frees only storage that is no longer in use.
+TEST_F(TransientBufferPoolTest, Trim) {
+  auto* semaphore = TestSemaphore::Create(0ull, host_allocator);
+  iree_hal_semaphore_t* semaphore_ptr = *semaphore;
+  uint64_t payload_value = 1ull;
+  iree_hal_semaphore_list_t semaphore_list = {1, &semaphore_ptr,
+                                              &payload_value};
+
+  iree_hal_buffer_t* gated_buffer = NULL;
+  iree_hal_buffer_t* gated_storage =
+      Acquire(128, iree_hal_semaphore_list_empty(), &gated_buffer);
+  IREE_ASSERT_OK(iree_hal_transient_buffer_pool_release(pool, gated_buffer,
+                                                        semaphore_list));
+  iree_hal_buffer_release(gated_buffer);
+  iree_hal_buffer_t* free_buffer = NULL;
+  iree_hal_buffer_t* free_storage =
+      Acquire(4096, iree_hal_semaphore_list_empty(), &free_buffer);
+  IREE_ASSERT_OK(iree_hal_transient_buffer_pool_release(
+      pool, free_buffer, iree_hal_semaphore_list_empty()));
+  iree_hal_buffer_release(free_buffer);
+
+  iree_hal_transient_buffer_pool_trim(pool);
+
+  iree_hal_buffer_t* buffer0 = NULL;
+  EXPECT_EQ(gated_storage, Acquire(128, semaphore_list, &buffer0));
+  iree_hal_buffer_release(buffer0);
+  iree_hal_buffer_t* buffer1 = NULL;
+  EXPECT_NE(free_storage,
+            Acquire(4096, iree_hal_semaphore_list_empty(), &buffer1));
+  iree_hal_buffer_release(buffer1);
+
+  iree_hal_semaphore_release(*semaphore);
+}
+
+// Tests that buffers are only returned to the pool once and that buffers not
+// acquired from a pool are ignored.
+TEST_F(TransientBufferPoolTest, ReleaseValidation) {
+  iree_hal_buffer_t* buffer = NULL;
+  Acquire(128, iree_hal_semaphore_list_empty(), &buffer);
+  IREE_ASSERT_OK(iree_hal_transient_buffer_pool_release(
+      pool, buffer, iree_hal_semaphore_list_empty()));
+  EXPECT_THAT(Status(iree_hal_transient_buffer_pool_release(
+                  pool, buffer, iree_hal_semaphore_list_empty())),
+              StatusIs(StatusCode::kFailedPrecondition));
+  iree_hal_buffer_release(buffer);
+
+  iree_hal_buffer_t* heap_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      device_allocator, MakeParams(), 128, iree_const_byte_span_empty(),
+      &heap_buffer));
+  EXPECT_FALSE(iree_hal_transient_buffer_isa(heap_buffer));
+  IREE_ASSERT_OK(iree_hal_transient_buffer_pool_release(
+      pool, heap_buffer, iree_hal_semaphore_list_empty()));
+  iree_hal_buffer_release(heap_buffer);
+}
+
+}  // namespace
+}  // namespace hal
+}  // namespace iree
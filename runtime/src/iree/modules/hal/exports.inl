@@ -31,7 +31,9 @@ EXPORT_FN("allocator.map.byte_buffer", iree_hal_module_allocator_map_byte_buffer
 EXPORT_FN("buffer.assert", iree_hal_module_buffer_assert, rrrIii, v)
 EXPORT_FN("buffer.length", iree_hal_module_buffer_length, r, I)
 EXPORT_FN("buffer.load", iree_hal_module_buffer_load, rIi, i)
+EXPORT_FN("buffer.load.range", iree_hal_module_buffer_load_range, rIrII, v)
 EXPORT_FN("buffer.store", iree_hal_module_buffer_store, irIi, v)
+EXPORT_FN("buffer.store.range", iree_hal_module_buffer_store_range, rIrII, v)
 EXPORT_FN("buffer.subspan", iree_hal_module_buffer_subspan, rII, r)
 
 EXPORT_FN("buffer_view.assert", iree_hal_module_buffer_view_assert, rriiCID, v)
@@ -46,7 +48,7 @@ EXPORT_FN("buffer_view.trace", iree_hal_module_buffer_view_trace, rCrD, v)
 EXPORT_FN("command_buffer.begin_debug_group", iree_hal_module_command_buffer_begin_debug_group, rr, v)
 EXPORT_FN("command_buffer.bind_descriptor_set", iree_hal_module_command_buffer_bind_descriptor_set, rrirCID, v)
 EXPORT_FN("command_buffer.copy_buffer", iree_hal_module_command_buffer_copy_buffer, rrIrII, v)
-EXPORT_FN("command_buffer.create", iree_hal_module_command_buffer_create, rii, r)
+EXPORT_FN("command_buffer.create", iree_hal_module_command_buffer_create, riii, r)
 EXPORT_FN("command_buffer.dispatch", iree_hal_module_command_buffer_dispatch, rriiii, v)
 EXPORT_FN("command_buffer.dispatch.indirect", iree_hal_module_command_buffer_dispatch_indirect, rrirI, v)
 EXPORT_FN("command_buffer.end_debug_group", iree_hal_module_command_buffer_end_debug_group, r, v)
@@ -55,6 +57,7 @@ EXPORT_FN("command_buffer.fill_buffer", iree_hal_module_command_buffer_fill_buff
 EXPORT_FN("command_buffer.finalize", iree_hal_module_command_buffer_finalize, r, v)
 EXPORT_FN("command_buffer.push_constants", iree_hal_module_command_buffer_push_constants, rriCiD, v)
 EXPORT_FN("command_buffer.push_descriptor_set", iree_hal_module_command_buffer_push_descriptor_set, rriCirIID, v)
+EXPORT_FN("command_buffer.push_descriptor_set.indirect", iree_hal_module_command_buffer_push_descriptor_set_indirect, rriCiiIID, v)
 
 EXPORT_FN("descriptor_set.create", iree_hal_module_descriptor_set_create, rrCirIID, r)
 
@@ -62,6 +65,8 @@ EXPORT_FN("descriptor_set_layout.create", iree_hal_module_descriptor_set_layout_
 
 EXPORT_FN("device.allocator", iree_hal_module_device_allocator, r, r)
 EXPORT_FN("device.query.i64", iree_hal_module_device_query_i64, rrr, iI)
+EXPORT_FN("device.queue.execute", iree_hal_module_device_queue_execute, rIrrCrD, v)
+EXPORT_FN("device.queue.execute.indirect", iree_hal_module_device_queue_execute_indirect, rIrrrCrIID, v)
 
 EXPORT_FN("ex.shared_device", iree_hal_module_ex_shared_device, v, r)
 EXPORT_FN("ex.submit_and_wait", iree_hal_module_ex_submit_and_wait, rr, v)
@@ -70,6 +75,12 @@ EXPORT_FN("executable.create", iree_hal_module_executable_create, rrrrCrD, r)
 
 EXPORT_FN("executable_layout.create", iree_hal_module_executable_layout_create, riCrD, r)
 
+EXPORT_FN("fence.await", iree_hal_module_fence_await, iCrD, i)
+EXPORT_FN("fence.create", iree_hal_module_fence_create, CrID, r)
+EXPORT_FN("fence.fail", iree_hal_module_fence_fail, ri, v)
+EXPORT_FN("fence.join", iree_hal_module_fence_join, CrD, r)
+EXPORT_FN("fence.signal", iree_hal_module_fence_signal, r, v)
+
 EXPORT_FN("semaphore.await", iree_hal_module_semaphore_await, rI, i)
 EXPORT_FN("semaphore.create", iree_hal_module_semaphore_create, rI, r)
 EXPORT_FN("semaphore.fail", iree_hal_module_semaphore_fail, r, i)
@@ -16,12 +16,22 @@
 #include "iree/base/api.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/api.h"
+#include "iree/hal/utils/tracking_allocator.h"
 #include "iree/vm/api.h"
 
 // Limit the number of bindings we pass down through the HAL. This can be tuned
 // in the future but right now guards the stack from blowing up during calls.
 #define IREE_HAL_MODULE_MAX_DESCRIPTOR_BINDING_COUNT ((iree_host_size_t)32)
 
+// Limit the number of binding table slots provided with a single submission.
+// Tables are marshaled on the stack like descriptor set bindings.
+#define IREE_HAL_MODULE_MAX_BINDING_TABLE_CAPACITY ((iree_host_size_t)256)
+
+// Number of persistent host mappings kept by each module state for scalar and
+// range buffer accesses. Programs reading back shapes or small control values
+// tend to repeatedly access the same few buffers.
+#define IREE_HAL_MODULE_MAPPING_CACHE_CAPACITY 4
+
 //===----------------------------------------------------------------------===//
 // Type registration
 //===----------------------------------------------------------------------===//
@@ -38,6 +48,7 @@ static iree_vm_ref_type_descriptor_t iree_hal_event_descriptor = {0};
 static iree_vm_ref_type_descriptor_t iree_hal_executable_descriptor = {0};
 static iree_vm_ref_type_descriptor_t iree_hal_executable_layout_descriptor = {
     0};
+static iree_vm_ref_type_descriptor_t iree_hal_fence_descriptor = {0};
 static iree_vm_ref_type_descriptor_t iree_hal_semaphore_descriptor = {0};
 
 #define IREE_VM_REGISTER_HAL_C_TYPE(type, name, destroy_fn, descriptor)   \
@@ -82,6 +93,9 @@ IREE_API_EXPORT iree_status_t iree_hal_module_register_types(void) {
                               "hal.executable_layout",
                               iree_hal_executable_layout_destroy,
                               iree_hal_executable_layout_descriptor);
+  IREE_VM_REGISTER_HAL_C_TYPE(iree_hal_fence_t, "hal.fence",
+                              iree_hal_fence_destroy,
+                              iree_hal_fence_descriptor);
   IREE_VM_REGISTER_HAL_C_TYPE(iree_hal_semaphore_t, "hal.semaphore",
                               iree_hal_semaphore_destroy,
                               iree_hal_semaphore_descriptor);
@@ -108,6 +122,7 @@ IREE_VM_DEFINE_TYPE_ADAPTERS(iree_hal_event, iree_hal_event_t);
 IREE_VM_DEFINE_TYPE_ADAPTERS(iree_hal_executable, iree_hal_executable_t);
 IREE_VM_DEFINE_TYPE_ADAPTERS(iree_hal_executable_layout,
                              iree_hal_executable_layout_t);
+IREE_VM_DEFINE_TYPE_ADAPTERS(iree_hal_fence, iree_hal_fence_t);
 IREE_VM_DEFINE_TYPE_ADAPTERS(iree_hal_semaphore, iree_hal_semaphore_t);
 
 //===----------------------------------------------------------------------===//
@@ -123,6 +138,16 @@ typedef struct iree_hal_module_t {
 #define IREE_HAL_MODULE_CAST(module) \
   (iree_hal_module_t*)((uint8_t*)(module) + iree_vm_native_module_size());
 
+// A persistent host mapping of an allocated buffer.
+typedef struct iree_hal_module_mapping_cache_entry_t {
+  // Allocated buffer the mapping is of, retained; NULL if the entry is unused.
+  iree_hal_buffer_t* buffer;
+  // Access the mapping was made with.
+  iree_hal_memory_access_t memory_access;
+  // Mapping of the entire allocated buffer.
+  iree_hal_buffer_mapping_t mapping;
+} iree_hal_module_mapping_cache_entry_t;
+
 typedef struct iree_hal_module_state_t {
   iree_allocator_t host_allocator;
   iree_hal_device_t* shared_device;
@@ -131,8 +156,89 @@ typedef struct iree_hal_module_state_t {
 
   iree_hal_semaphore_t* submit_semaphore;
   uint64_t submit_value;
+
+  // Pool of buffer views created by the program. Results handed back to the
+  // application return here when released and are reused by later calls.
+  iree_hal_buffer_view_pool_t* buffer_view_pool;
+
+  // Persistent host mappings of recently accessed allocations reused by
+  // buffer loads and stores instead of transferring on each access. Entries
+  // retain their buffers and are replaced round-robin.
+  iree_host_size_t mapping_cache_next;
+  iree_hal_module_mapping_cache_entry_t
+      mapping_cache[IREE_HAL_MODULE_MAPPING_CACHE_CAPACITY];
 } iree_hal_module_state_t;
 
+// Unmaps all cached host mappings and releases their buffers.
+static void iree_hal_module_mapping_cache_clear(
+    iree_hal_module_state_t* state) {
+  for (iree_host_size_t i = 0; i < IREE_HAL_MODULE_MAPPING_CACHE_CAPACITY;
+       ++i) {
+    iree_hal_module_mapping_cache_entry_t* entry = &state->mapping_cache[i];
+    if (!entry->buffer) continue;
+    iree_status_ignore(iree_hal_buffer_unmap_range(&entry->mapping));
+    iree_hal_buffer_release(entry->buffer);
+    memset(entry, 0, sizeof(*entry));
+  }
+  state->mapping_cache_next = 0;
+}
+
+// Returns a cached persistent host mapping of the allocation backing |buffer|
+// in |out_entry|, mapping it if needed. Returns NULL if the buffer cannot be
+// persistently mapped and must be accessed with transfer operations instead.
+static iree_status_t iree_hal_module_mapping_cache_lookup(
+    iree_hal_module_state_t* state, iree_hal_buffer_t* buffer,
+    iree_hal_module_mapping_cache_entry_t** out_entry) {
+  *out_entry = NULL;
+
+  iree_hal_buffer_t* allocated_buffer =
+      iree_hal_buffer_allocated_buffer(buffer);
+  if (!iree_all_bits_set(iree_hal_buffer_memory_type(allocated_buffer),
+                         IREE_HAL_MEMORY_TYPE_HOST_VISIBLE) ||
+      !iree_all_bits_set(iree_hal_buffer_allowed_usage(allocated_buffer),
+                         IREE_HAL_BUFFER_USAGE_MAPPING_PERSISTENT)) {
+    return iree_ok_status();
+  }
+
+  for (iree_host_size_t i = 0; i < IREE_HAL_MODULE_MAPPING_CACHE_CAPACITY;
+       ++i) {
+    if (state->mapping_cache[i].buffer == allocated_buffer) {
+      *out_entry = &state->mapping_cache[i];
+      return iree_ok_status();
+    }
+  }
+
+  // Evict the oldest entry to make room.
+  iree_hal_module_mapping_cache_entry_t* entry =
+      &state->mapping_cache[state->mapping_cache_next];
+  if (entry->buffer) {
+    iree_status_ignore(iree_hal_buffer_unmap_range(&entry->mapping));
+    iree_hal_buffer_release(entry->buffer);
+    memset(entry, 0, sizeof(*entry));
+  }
+
+  iree_hal_memory_access_t memory_access =
+      iree_hal_buffer_allowed_access(allocated_buffer) &
+      (IREE_HAL_MEMORY_ACCESS_READ | IREE_HAL_MEMORY_ACCESS_WRITE);
+  iree_status_t status = iree_hal_buffer_map_range(
+      allocated_buffer, IREE_HAL_MAPPING_MODE_PERSISTENT, memory_access, 0,
+      IREE_WHOLE_BUFFER, &entry->mapping);
+  if (!iree_status_is_ok(status)) {
+    // Mapping is only an optimization; fall back to transfers.
+    iree_status_ignore(status);
+    memset(entry, 0, sizeof(*entry));
+    return iree_ok_status();
+  }
+  entry->buffer = allocated_buffer;
+  iree_hal_buffer_retain(entry->buffer);
+  entry->memory_access = memory_access;
+  state->mapping_cache_next =
+      (state->mapping_cache_next + 1) % IREE_HAL_MODULE_MAPPING_CACHE_CAPACITY;
+
+  *out_entry = entry;
+  return iree_ok_status();
+}
+
 static void IREE_API_PTR iree_hal_module_destroy(void* base_module) {
   iree_hal_module_t* module = IREE_HAL_MODULE_CAST(base_module);
   iree_hal_device_release(module->shared_device);
@@ -164,6 +270,10 @@ iree_hal_module_alloc_state(void* self, iree_allocator_t host_allocator,
       z0, iree_hal_semaphore_create(state->shared_device, state->submit_value,
                                     &state->submit_semaphore));
 
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_hal_buffer_view_pool_create(host_allocator,
+                                           &state->buffer_view_pool));
+
   *out_module_state = (iree_vm_module_state_t*)state;
   IREE_TRACE_ZONE_END(z0);
   return iree_ok_status();
@@ -174,6 +284,8 @@ iree_hal_module_free_state(void* self, iree_vm_module_state_t* module_state) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_hal_module_state_t* state = (iree_hal_module_state_t*)module_state;
+  iree_hal_module_mapping_cache_clear(state);
+  iree_hal_buffer_view_pool_release(state->buffer_view_pool);
   iree_hal_semaphore_release(state->submit_semaphore);
   iree_hal_executable_cache_release(state->executable_cache);
   iree_status_ignore(state->loop_status);
@@ -189,6 +301,8 @@ static iree_status_t IREE_API_PTR iree_hal_module_notify(
   switch (signal) {
     case IREE_VM_SIGNAL_SUSPEND:
     case IREE_VM_SIGNAL_LOW_MEMORY:
+      iree_hal_module_mapping_cache_clear(state);
+      iree_hal_buffer_view_pool_trim(state->buffer_view_pool);
       return iree_hal_device_trim(state->shared_device);
     default:
       return iree_ok_status();
@@ -260,10 +374,38 @@ static iree_device_size_t iree_hal_cast_device_size(int64_t value) {
   return (iree_device_size_t)value;
 }
 
+// Dereferences an optional fence; null refs are treated as empty fences.
+static iree_status_t iree_hal_fence_check_deref_or_null(
+    iree_vm_ref_t ref, iree_hal_fence_t** out_fence) {
+  if (iree_vm_ref_is_null(&ref)) {
+    *out_fence = NULL;
+    return iree_ok_status();
+  }
+  return iree_hal_fence_check_deref(ref, out_fence);
+}
+
 //===----------------------------------------------------------------------===//
 // iree_hal_allocator_t
 //===----------------------------------------------------------------------===//
 
+// Allocates a buffer from |allocator|. When the allocator is tracking memory
+// usage the allocation is attributed to the calling VM function so that peak
+// memory can be broken down by the program location that allocated it.
+static iree_status_t iree_hal_module_allocate_buffer(
+    iree_vm_stack_t* stack, iree_hal_allocator_t* allocator,
+    const iree_hal_buffer_params_t params, iree_device_size_t allocation_size,
+    iree_const_byte_span_t initial_data, iree_hal_buffer_t** out_buffer) {
+  if (!iree_hal_tracking_allocator_isa(allocator)) {
+    return iree_hal_allocator_allocate_buffer(
+        allocator, params, allocation_size, initial_data, out_buffer);
+  }
+  iree_string_view_t tag = iree_string_view_empty();
+  iree_vm_stack_frame_t* caller_frame = iree_vm_stack_parent_frame(stack);
+  if (caller_frame) tag = iree_vm_function_name(&caller_frame->function);
+  return iree_hal_tracking_allocator_allocate_buffer_tagged(
+      allocator, tag, params, allocation_size, initial_data, out_buffer);
+}
+
 IREE_VM_ABI_EXPORT(iree_hal_module_allocator_allocate,  //
                    iree_hal_module_state_t,             //
                    riiI, r) {
@@ -278,8 +420,8 @@ IREE_VM_ABI_EXPORT(iree_hal_module_allocator_allocate,  //
       .usage = buffer_usage,
   };
   iree_hal_buffer_t* buffer = NULL;
-  IREE_RETURN_IF_ERROR(iree_hal_allocator_allocate_buffer(
-      allocator, params, allocation_size, iree_const_byte_span_empty(),
+  IREE_RETURN_IF_ERROR(iree_hal_module_allocate_buffer(
+      stack, allocator, params, allocation_size, iree_const_byte_span_empty(),
       &buffer));
   rets->r0 = iree_hal_buffer_move_ref(buffer);
   return iree_ok_status();
@@ -315,8 +457,8 @@ IREE_VM_ABI_EXPORT(iree_hal_module_allocator_allocate_initialized,  //
   };
   iree_hal_buffer_t* buffer = NULL;
   IREE_RETURN_IF_ERROR(
-      iree_hal_allocator_allocate_buffer(
-          allocator, params, length,
+      iree_hal_module_allocate_buffer(
+          stack, allocator, params, length,
           iree_make_const_byte_span(source->data.data + offset, length),
           &buffer),
       "failed to allocate buffer of length %" PRIdsz, length);
@@ -544,6 +686,77 @@ IREE_VM_ABI_EXPORT(iree_hal_module_buffer_length,  //
   return iree_ok_status();
 }
 
+// Reads |length| bytes from |source_buffer| into |target| through a cached
+// persistent mapping if possible and otherwise with a device transfer.
+static iree_status_t iree_hal_module_state_read_buffer(
+    iree_hal_module_state_t* state, iree_hal_buffer_t* source_buffer,
+    iree_device_size_t source_offset, void* target, iree_device_size_t length) {
+  if (source_offset + length > iree_hal_buffer_byte_length(source_buffer)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "load out of bounds (source_offset=%" PRIdsz
+                            ", length=%" PRIdsz " into max %" PRIdsz ")",
+                            source_offset, length,
+                            iree_hal_buffer_byte_length(source_buffer));
+  }
+
+  iree_hal_module_mapping_cache_entry_t* entry = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_module_mapping_cache_lookup(state, source_buffer, &entry));
+  if (!entry ||
+      !iree_all_bits_set(entry->memory_access, IREE_HAL_MEMORY_ACCESS_READ)) {
+    return iree_hal_device_transfer_d2h(
+        state->shared_device, source_buffer, source_offset, target, length,
+        IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+  }
+
+  iree_device_size_t offset =
+      iree_hal_buffer_byte_offset(source_buffer) + source_offset;
+  if (!iree_all_bits_set(iree_hal_buffer_memory_type(entry->buffer),
+                         IREE_HAL_MEMORY_TYPE_HOST_COHERENT)) {
+    IREE_RETURN_IF_ERROR(iree_hal_buffer_mapping_invalidate_range(
+        &entry->mapping, offset, length));
+  }
+  memcpy(target, entry->mapping.contents.data + offset, length);
+  return iree_ok_status();
+}
+
+// Writes |length| bytes from |source| into |target_buffer| through a cached
+// persistent mapping if possible and otherwise with a device transfer.
+static iree_status_t iree_hal_module_state_write_buffer(
+    iree_hal_module_state_t* state, const void* source,
+    iree_hal_buffer_t* target_buffer, iree_device_size_t target_offset,
+    iree_device_size_t length) {
+  if (target_offset + length > iree_hal_buffer_byte_length(target_buffer)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "store out of bounds (target_offset=%" PRIdsz
+                            ", length=%" PRIdsz " into max %" PRIdsz ")",
+                            target_offset, length,
+                            iree_hal_buffer_byte_length(target_buffer));
+  }
+
+  iree_hal_module_mapping_cache_entry_t* entry = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_module_mapping_cache_lookup(state, target_buffer, &entry));
+  if (!entry ||
+      !iree_all_bits_set(entry->memory_access, IREE_HAL_MEMORY_ACCESS_WRITE) ||
+      !iree_all_bits_set(iree_hal_buffer_allowed_access(target_buffer),
+                         IREE_HAL_MEMORY_ACCESS_WRITE)) {
+    return iree_hal_device_transfer_h2d(
+        state->shared_device, source, target_buffer, target_offset, length,
+        IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+  }
+
+  iree_device_size_t offset =
+      iree_hal_buffer_byte_offset(target_buffer) + target_offset;
+  memcpy(entry->mapping.contents.data + offset, source, length);
+  if (!iree_all_bits_set(iree_hal_buffer_memory_type(entry->buffer),
+                         IREE_HAL_MEMORY_TYPE_HOST_COHERENT)) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_buffer_mapping_flush_range(&entry->mapping, offset, length));
+  }
+  return iree_ok_status();
+}
+
 IREE_VM_ABI_EXPORT(iree_hal_module_buffer_load,  //
                    iree_hal_module_state_t,      //
                    rIi, i) {
@@ -558,14 +771,44 @@ IREE_VM_ABI_EXPORT(iree_hal_module_buffer_load,  //
                             "load length byte count %d exceeds max", length);
   }
 
-  IREE_RETURN_IF_ERROR(iree_hal_device_transfer_d2h(
-      state->shared_device, source_buffer, source_offset, &target_buffer,
-      length, IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout()));
+  IREE_RETURN_IF_ERROR(iree_hal_module_state_read_buffer(
+      state, source_buffer, source_offset, &target_buffer, length));
 
   rets->i0 = target_buffer;
   return iree_ok_status();
 }
 
+IREE_VM_ABI_EXPORT(iree_hal_module_buffer_load_range,  //
+                   iree_hal_module_state_t,            //
+                   rIrII, v) {
+  iree_hal_buffer_t* source_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_check_deref(args->r0, &source_buffer));
+  iree_device_size_t source_offset = iree_hal_cast_device_size(args->i1);
+  iree_vm_buffer_t* target_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_buffer_check_deref(args->r2, &target_buffer));
+  iree_host_size_t target_offset = (iree_host_size_t)args->i3;
+  iree_host_size_t length = (iree_host_size_t)args->i4;
+
+  if (!iree_all_bits_set(target_buffer->access,
+                         IREE_VM_BUFFER_ACCESS_MUTABLE)) {
+    return iree_make_status(IREE_STATUS_PERMISSION_DENIED,
+                            "target buffer is read-only");
+  }
+  iree_host_size_t target_length = target_buffer->data.data_length;
+  if (target_offset > target_length ||
+      length > target_length - target_offset) {
+    return iree_make_status(
+        IREE_STATUS_OUT_OF_RANGE,
+        "load range target out of bounds (target_offset=%" PRIhsz
+        ", length=%" PRIhsz " into max %" PRIhsz ")",
+        target_offset, length, target_length);
+  }
+
+  return iree_hal_module_state_read_buffer(
+      state, source_buffer, source_offset,
+      target_buffer->data.data + target_offset, length);
+}
+
 IREE_VM_ABI_EXPORT(iree_hal_module_buffer_store,  //
                    iree_hal_module_state_t,       //
                    irIi, v) {
@@ -578,18 +821,36 @@ IREE_VM_ABI_EXPORT(iree_hal_module_buffer_store,  //
   if (length > sizeof(value)) {
     return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
                             "store length byte count %d exceeds max", length);
-  } else if (target_offset + length >
-             iree_hal_buffer_byte_length(target_buffer)) {
-    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
-                            "store out of bounds (target_offset=%" PRIdsz
-                            ", length=%d into max %" PRIdsz ")",
-                            target_offset, length,
-                            iree_hal_buffer_byte_length(target_buffer));
   }
 
-  return iree_hal_device_transfer_h2d(
-      state->shared_device, &value, target_buffer, target_offset, length,
-      IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+  return iree_hal_module_state_write_buffer(state, &value, target_buffer,
+                                            target_offset, length);
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_buffer_store_range,  //
+                   iree_hal_module_state_t,             //
+                   rIrII, v) {
+  iree_vm_buffer_t* source_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_buffer_check_deref(args->r0, &source_buffer));
+  iree_host_size_t source_offset = (iree_host_size_t)args->i1;
+  iree_hal_buffer_t* target_buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_check_deref(args->r2, &target_buffer));
+  iree_device_size_t target_offset = iree_hal_cast_device_size(args->i3);
+  iree_host_size_t length = (iree_host_size_t)args->i4;
+
+  iree_host_size_t source_length = source_buffer->data.data_length;
+  if (source_offset > source_length ||
+      length > source_length - source_offset) {
+    return iree_make_status(
+        IREE_STATUS_OUT_OF_RANGE,
+        "store range source out of bounds (source_offset=%" PRIhsz
+        ", length=%" PRIhsz " into max %" PRIhsz ")",
+        source_offset, length, source_length);
+  }
+
+  return iree_hal_module_state_write_buffer(
+      state, source_buffer->data.data + source_offset, target_buffer,
+      target_offset, length);
 }
 
 //===----------------------------------------------------------------------===//
@@ -610,9 +871,9 @@ IREE_VM_ABI_EXPORT(iree_hal_module_buffer_view_create,  //
                              &shape_rank, &shape_dims);
 
   iree_hal_buffer_view_t* buffer_view = NULL;
-  IREE_RETURN_IF_ERROR(iree_hal_buffer_view_create(
-      source_buffer, shape_rank, shape_dims, element_type, encoding_type,
-      state->host_allocator, &buffer_view));
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_view_pool_acquire(
+      state->buffer_view_pool, source_buffer, shape_rank, shape_dims,
+      element_type, encoding_type, &buffer_view));
   rets->r0 = iree_hal_buffer_view_move_ref(buffer_view);
   return iree_ok_status();
 }
@@ -869,18 +1130,25 @@ IREE_VM_ABI_EXPORT(iree_hal_module_buffer_view_trace,  //
 
 IREE_VM_ABI_EXPORT(iree_hal_module_command_buffer_create,  //
                    iree_hal_module_state_t,                //
-                   rii, r) {
+                   riii, r) {
   iree_hal_device_t* device = NULL;
   IREE_RETURN_IF_ERROR(iree_hal_device_check_deref(args->r0, &device));
   iree_hal_command_buffer_mode_t modes =
       (iree_hal_command_buffer_mode_t)args->i1;
   iree_hal_command_category_t command_categories =
       (iree_hal_command_category_t)args->i2;
+  iree_host_size_t binding_capacity = (iree_host_size_t)args->i3;
+  if (IREE_UNLIKELY(binding_capacity >
+                    IREE_HAL_MODULE_MAX_BINDING_TABLE_CAPACITY)) {
+    return iree_make_status(
+        IREE_STATUS_OUT_OF_RANGE, "binding capacity %" PRIhsz " > %" PRIhsz,
+        binding_capacity, IREE_HAL_MODULE_MAX_BINDING_TABLE_CAPACITY);
+  }
 
   iree_hal_command_buffer_t* command_buffer = NULL;
   IREE_RETURN_IF_ERROR(iree_hal_command_buffer_create(
       device, modes, command_categories, IREE_HAL_QUEUE_AFFINITY_ANY,
-      &command_buffer));
+      binding_capacity, &command_buffer));
 
   iree_status_t status = iree_hal_command_buffer_begin(command_buffer);
   if (iree_status_is_ok(status)) {
@@ -1035,6 +1303,41 @@ IREE_VM_ABI_EXPORT(iree_hal_module_command_buffer_push_descriptor_set,  //
     bindings[i].binding = (uint32_t)args->a3[i].i0;
     bindings[i].offset = iree_hal_cast_device_size(args->a3[i].i2);
     bindings[i].length = iree_hal_cast_device_size(args->a3[i].i3);
+    bindings[i].buffer_slot = 0;
+  }
+
+  return iree_hal_command_buffer_push_descriptor_set(
+      command_buffer, executable_layout, set, binding_count, bindings);
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_command_buffer_push_descriptor_set_indirect,
+                   iree_hal_module_state_t,  //
+                   rriCiiIID, v) {
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_command_buffer_check_deref(args->r0, &command_buffer));
+  iree_hal_executable_layout_t* executable_layout = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_executable_layout_check_deref(args->r1, &executable_layout));
+  iree_vm_size_t set = args->i2;
+
+  iree_host_size_t binding_count = args->a3_count;
+  if (IREE_UNLIKELY(binding_count >
+                    IREE_HAL_MODULE_MAX_DESCRIPTOR_BINDING_COUNT)) {
+    return iree_make_status(
+        IREE_STATUS_OUT_OF_RANGE, "binding count %" PRIhsz " > %" PRIhsz,
+        binding_count, IREE_HAL_MODULE_MAX_DESCRIPTOR_BINDING_COUNT);
+  }
+  iree_hal_descriptor_set_binding_t* bindings =
+      (iree_hal_descriptor_set_binding_t*)iree_alloca(
+          binding_count * sizeof(iree_hal_descriptor_set_binding_t));
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    // The buffers are provided from the binding table at submission time.
+    bindings[i].binding = (uint32_t)args->a3[i].i0;
+    bindings[i].buffer_slot = (uint32_t)args->a3[i].i1;
+    bindings[i].buffer = NULL;
+    bindings[i].offset = iree_hal_cast_device_size(args->a3[i].i2);
+    bindings[i].length = iree_hal_cast_device_size(args->a3[i].i3);
   }
 
   return iree_hal_command_buffer_push_descriptor_set(
@@ -1128,6 +1431,7 @@ IREE_VM_ABI_EXPORT(iree_hal_module_descriptor_set_create,  //
     bindings[i].binding = (uint32_t)args->a2[i].i0;
     bindings[i].offset = iree_hal_cast_device_size(args->a2[i].i2);
     bindings[i].length = iree_hal_cast_device_size(args->a2[i].i3);
+    bindings[i].buffer_slot = 0;
   }
 
   iree_hal_descriptor_set_t* descriptor_set = NULL;
@@ -1204,6 +1508,85 @@ IREE_VM_ABI_EXPORT(iree_hal_module_device_query_i64,  //
   return iree_ok_status();
 }
 
+IREE_VM_ABI_EXPORT(iree_hal_module_device_queue_execute,  //
+                   iree_hal_module_state_t,               //
+                   rIrrCrD, v) {
+  iree_hal_device_t* device = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_device_check_deref(args->r0, &device));
+  iree_hal_queue_affinity_t queue_affinity =
+      (iree_hal_queue_affinity_t)args->i1;
+  iree_hal_fence_t* wait_fence = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_fence_check_deref_or_null(args->r2, &wait_fence));
+  iree_hal_fence_t* signal_fence = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_fence_check_deref_or_null(args->r3, &signal_fence));
+  iree_host_size_t command_buffer_count = 0;
+  iree_hal_command_buffer_t** command_buffers = NULL;
+  IREE_VM_ABI_VLA_STACK_DEREF(args, a4_count, a4, iree_hal_command_buffer, 32,
+                              &command_buffer_count, &command_buffers);
+
+  // The submission is queue-ordered: the caller continues immediately and
+  // observes completion through the signal fence.
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = iree_hal_fence_semaphore_list(wait_fence);
+  batch.command_buffer_count = command_buffer_count;
+  batch.command_buffers = command_buffers;
+  batch.signal_semaphores = iree_hal_fence_semaphore_list(signal_fence);
+  return iree_hal_device_queue_submit(device, IREE_HAL_COMMAND_CATEGORY_ANY,
+                                      queue_affinity, 1, &batch);
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_device_queue_execute_indirect,  //
+                   iree_hal_module_state_t,                        //
+                   rIrrrCrIID, v) {
+  iree_hal_device_t* device = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_device_check_deref(args->r0, &device));
+  iree_hal_queue_affinity_t queue_affinity =
+      (iree_hal_queue_affinity_t)args->i1;
+  iree_hal_fence_t* wait_fence = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_fence_check_deref_or_null(args->r2, &wait_fence));
+  iree_hal_fence_t* signal_fence = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_fence_check_deref_or_null(args->r3, &signal_fence));
+  iree_hal_command_buffer_t* command_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_command_buffer_check_deref(args->r4, &command_buffer));
+
+  iree_host_size_t binding_count = args->a5_count;
+  if (IREE_UNLIKELY(binding_count >
+                    IREE_HAL_MODULE_MAX_BINDING_TABLE_CAPACITY)) {
+    return iree_make_status(
+        IREE_STATUS_OUT_OF_RANGE, "binding table count %" PRIhsz " > %" PRIhsz,
+        binding_count, IREE_HAL_MODULE_MAX_BINDING_TABLE_CAPACITY);
+  }
+  iree_hal_buffer_binding_t* bindings =
+      (iree_hal_buffer_binding_t*)iree_alloca(
+          binding_count * sizeof(iree_hal_buffer_binding_t));
+  for (iree_host_size_t i = 0; i < binding_count; ++i) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_buffer_check_deref(args->a5[i].r0, &bindings[i].buffer));
+    bindings[i].offset = iree_hal_cast_device_size(args->a5[i].i1);
+    bindings[i].length = iree_hal_cast_device_size(args->a5[i].i2);
+  }
+  iree_hal_buffer_binding_table_t binding_table = {
+      .count = binding_count,
+      .bindings = bindings,
+  };
+
+  iree_hal_submission_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  batch.wait_semaphores = iree_hal_fence_semaphore_list(wait_fence);
+  batch.command_buffer_count = 1;
+  batch.command_buffers = &command_buffer;
+  batch.binding_tables = &binding_table;
+  batch.signal_semaphores = iree_hal_fence_semaphore_list(signal_fence);
+  return iree_hal_device_queue_submit(device, IREE_HAL_COMMAND_CATEGORY_ANY,
+                                      queue_affinity, 1, &batch);
+}
+
 //===--------------------------------------------------------------------===//
 // iree_hal_executable_t
 //===--------------------------------------------------------------------===//
@@ -1296,6 +1679,111 @@ IREE_VM_ABI_EXPORT(iree_hal_module_executable_layout_create,  //
   return iree_ok_status();
 }
 
+//===----------------------------------------------------------------------===//
+// iree_hal_fence_t
+//===----------------------------------------------------------------------===//
+
+IREE_VM_ABI_EXPORT(iree_hal_module_fence_create,  //
+                   iree_hal_module_state_t,       //
+                   CrID, r) {
+  iree_hal_fence_t* fence = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_fence_create(args->a0_count, state->host_allocator, &fence));
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < args->a0_count; ++i) {
+    iree_hal_semaphore_t* semaphore = NULL;
+    status = iree_hal_semaphore_check_deref(args->a0[i].r0, &semaphore);
+    if (!iree_status_is_ok(status)) break;
+    status = iree_hal_fence_insert(fence, semaphore, (uint64_t)args->a0[i].i1);
+    if (!iree_status_is_ok(status)) break;
+  }
+  if (iree_status_is_ok(status)) {
+    rets->r0 = iree_hal_fence_move_ref(fence);
+  } else {
+    iree_hal_fence_release(fence);
+  }
+  return status;
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_fence_join,  //
+                   iree_hal_module_state_t,     //
+                   CrD, r) {
+  iree_host_size_t fence_count = args->a0_count;
+  if (IREE_UNLIKELY(fence_count > 128)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "count %zu of iree_hal_fence > 128", fence_count);
+  }
+  iree_hal_fence_t** fences =
+      (iree_hal_fence_t**)iree_alloca(fence_count * sizeof(iree_hal_fence_t*));
+  for (iree_host_size_t i = 0; i < fence_count; ++i) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_fence_check_deref_or_null(args->a0[i].r0, &fences[i]));
+  }
+
+  // Joining only immediate fences produces an immediate (null) fence.
+  iree_hal_fence_t* fence = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_fence_join(fence_count, fences, state->host_allocator, &fence));
+  if (fence) rets->r0 = iree_hal_fence_move_ref(fence);
+  return iree_ok_status();
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_fence_signal,  //
+                   iree_hal_module_state_t,       //
+                   r, v) {
+  iree_hal_fence_t* fence = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_fence_check_deref(args->r0, &fence));
+  return iree_hal_fence_signal(fence);
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_fence_fail,  //
+                   iree_hal_module_state_t,     //
+                   ri, v) {
+  iree_hal_fence_t* fence = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_fence_check_deref(args->r0, &fence));
+  iree_status_code_t status_code =
+      (iree_status_code_t)(args->i1 & IREE_STATUS_CODE_MASK);
+  iree_hal_fence_fail(fence, iree_make_status(status_code));
+  return iree_ok_status();
+}
+
+IREE_VM_ABI_EXPORT(iree_hal_module_fence_await,  //
+                   iree_hal_module_state_t,      //
+                   iCrD, i) {
+  // Negative timeouts wait forever.
+  iree_timeout_t timeout =
+      args->i0 < 0 ? iree_infinite_timeout()
+                   : iree_make_timeout_ms((iree_duration_t)args->i0);
+  // Null fences are immediately reached and skipped.
+  iree_host_size_t fence_count = args->a1_count;
+  if (IREE_UNLIKELY(fence_count > 128)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "count %zu of iree_hal_fence > 128", fence_count);
+  }
+  iree_hal_fence_t** fences =
+      (iree_hal_fence_t**)iree_alloca(fence_count * sizeof(iree_hal_fence_t*));
+  for (iree_host_size_t i = 0; i < fence_count; ++i) {
+    IREE_RETURN_IF_ERROR(
+        iree_hal_fence_check_deref_or_null(args->a1[i].r0, &fences[i]));
+  }
+
+  // TODO(benvanik): coroutine magic.
+  iree_time_t deadline_ns = iree_timeout_as_deadline_ns(timeout);
+  iree_status_t status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < fence_count && iree_status_is_ok(status);
+       ++i) {
+    status = iree_hal_fence_wait(fences[i], iree_make_deadline(deadline_ns));
+  }
+  if (iree_status_is_ok(status)) {
+    rets->i0 = 0;
+  } else if (iree_status_is_deadline_exceeded(status)) {
+    // Propagate deadline exceeded back to the VM.
+    rets->i0 = (int32_t)iree_status_consume_code(status);
+    status = iree_ok_status();
+  }
+  return status;
+}
+
 //===----------------------------------------------------------------------===//
 // iree_hal_semaphore_t
 //===----------------------------------------------------------------------===//
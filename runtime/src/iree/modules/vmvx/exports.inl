@@ -23,6 +23,17 @@
 
 // clang-format off
 
-EXPORT_FN("_placeholder", iree_vmvx_module_placeholder, v, v)
+EXPORT_FN("add.2d.f32", iree_vmvx_module_add_2d_f32, rIIIrIIIrIIIII, v)
+EXPORT_FN("add.2d.i32", iree_vmvx_module_add_2d_i32, rIIIrIIIrIIIII, v)
+EXPORT_FN("copy.2d.x32", iree_vmvx_module_copy_2d_x32, rIIIrIIIII, v)
+EXPORT_FN("copy.2d.x8", iree_vmvx_module_copy_2d_x8, rIIIrIIIII, v)
+EXPORT_FN("fill.2d.x32", iree_vmvx_module_fill_2d_x32, irIIIII, v)
+EXPORT_FN("matmul.f32f32f32", iree_vmvx_module_matmul_f32f32f32, rIIrIIrIIIIIi, v)
+EXPORT_FN("mmt4d.f32f32f32", iree_vmvx_module_mmt4d_f32f32f32, rIIrIIrIIIIIiiii, v)
+EXPORT_FN("mmt4d.i8i8i32", iree_vmvx_module_mmt4d_i8i8i32, rIIrIIrIIIIIiiii, v)
+EXPORT_FN("mul.2d.f32", iree_vmvx_module_mul_2d_f32, rIIIrIIIrIIIII, v)
+EXPORT_FN("mul.2d.i32", iree_vmvx_module_mul_2d_i32, rIIIrIIIrIIIII, v)
+EXPORT_FN("reduce.max.2d.f32", iree_vmvx_module_reduce_max_2d_f32, rIIIrIIII, v)
+EXPORT_FN("reduce.sum.2d.f32", iree_vmvx_module_reduce_sum_2d_f32, rIIIrIIII, v)
 
 // clang-format on
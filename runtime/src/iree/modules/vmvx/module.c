@@ -12,7 +12,9 @@
 #include <string.h>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/cpu.h"
 #include "iree/base/tracing.h"
+#include "iree/builtins/ukernel/api.h"
 #include "iree/vm/api.h"
 
 //===----------------------------------------------------------------------===//
@@ -36,6 +38,9 @@ typedef struct iree_vmvx_module_state_t {
   // we'll have to perform the synchronization ourselves here. That'd be bad,
   // of course, and an indication that whatever is being called is not suited
   // for this use.
+
+  // Processor data of the host used to select ukernel implementations.
+  uint64_t cpu_data[1];
 } iree_vmvx_module_state_t;
 
 static void IREE_API_PTR iree_vmvx_module_destroy(void* base_module) {
@@ -50,6 +55,7 @@ iree_vmvx_module_alloc_state(void* self, iree_allocator_t host_allocator,
       iree_allocator_malloc(host_allocator, sizeof(*state), (void**)&state));
   memset(state, 0, sizeof(*state));
   state->host_allocator = host_allocator;
+  iree_cpu_query_data_fields(IREE_ARRAYSIZE(state->cpu_data), state->cpu_data);
   *out_module_state = (iree_vm_module_state_t*)state;
   return iree_ok_status();
 }
@@ -61,16 +67,280 @@ iree_vmvx_module_free_state(void* self, iree_vm_module_state_t* module_state) {
 }
 
 //===----------------------------------------------------------------------===//
-// TODO
+// Strided buffer views
+//===----------------------------------------------------------------------===//
+
+// Resolves a 2D view of |size0|x|size1| elements of |element_size| bytes
+// starting at element |offset| of the buffer in |ref| with element strides
+// |stride0| and |stride1|. The view is bounds and alignment checked and a
+// pointer to its first element is returned in |out_ptr| (or NULL if empty).
+static iree_status_t iree_vmvx_map_2d(iree_vm_ref_t ref, bool writable,
+                                      int64_t offset, int64_t stride0,
+                                      int64_t stride1, int64_t size0,
+                                      int64_t size1,
+                                      iree_host_size_t element_size,
+                                      void** out_ptr) {
+  *out_ptr = NULL;
+  iree_vm_buffer_t* buffer = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_buffer_check_deref(ref, &buffer));
+  if (writable &&
+      !iree_all_bits_set(buffer->access, IREE_VM_BUFFER_ACCESS_MUTABLE)) {
+    return iree_make_status(IREE_STATUS_PERMISSION_DENIED,
+                            "buffer is read-only and cannot be written");
+  }
+  if (offset < 0 || stride0 < 0 || stride1 < 0 || size0 < 0 || size1 < 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "negative buffer view offset/stride/size");
+  }
+  if (size0 == 0 || size1 == 0) return iree_ok_status();
+
+  // Walk from the last element of the buffer to avoid overflow when checking
+  // that the last element of the view is in bounds.
+  iree_byte_span_t data = iree_vm_buffer_data(buffer);
+  const uint64_t element_count = data.data_length / element_size;
+  if ((uint64_t)offset >= element_count) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "buffer view offset %" PRId64
+                            " out of range of %" PRIu64 " elements",
+                            offset, element_count);
+  }
+  uint64_t remaining = element_count - 1 - (uint64_t)offset;
+  const int64_t sizes[2] = {size0, size1};
+  const int64_t strides[2] = {stride0, stride1};
+  for (int i = 0; i < 2; ++i) {
+    if (sizes[i] == 1) continue;
+    const uint64_t steps = (uint64_t)sizes[i] - 1;
+    if ((uint64_t)strides[i] > remaining / steps) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "buffer view exceeds buffer of %" PRIu64
+                              " elements",
+                              element_count);
+    }
+    remaining -= steps * (uint64_t)strides[i];
+  }
+
+  uint8_t* ptr = data.data + (iree_host_size_t)offset * element_size;
+  if (((uintptr_t)ptr % element_size) != 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "buffer view is not aligned to its element size");
+  }
+  *out_ptr = ptr;
+  return iree_ok_status();
+}
+
+#define IREE_VMVX_MAP_2D(ref, writable, offset, stride0, stride1, size0,   \
+                         size1, type, out_ptr)                             \
+  IREE_RETURN_IF_ERROR(iree_vmvx_map_2d((ref), (writable), (offset),       \
+                                        (stride0), (stride1), (size0),     \
+                                        (size1), sizeof(type),             \
+                                        (void**)(out_ptr)))
+
+//===----------------------------------------------------------------------===//
+// Elementwise ops
 //===----------------------------------------------------------------------===//
+// The inner loops are written such that compilers vectorize them when the
+// innermost dimension is contiguous (the common case produced by the compiler)
+// and the generic strided loop is only used otherwise.
+
+#define IREE_VMVX_BINARY_2D(name, type, op)                                 \
+  IREE_VM_ABI_EXPORT(iree_vmvx_module_##name, iree_vmvx_module_state_t,     \
+                     rIIIrIIIrIIIII, v) {                                   \
+    const int64_t size0 = args->i12;                                        \
+    const int64_t size1 = args->i13;                                        \
+    const type* lhs = NULL;                                                 \
+    const type* rhs = NULL;                                                 \
+    type* out = NULL;                                                       \
+    IREE_VMVX_MAP_2D(args->r0, false, args->i1, args->i2, args->i3, size0,  \
+                     size1, type, &lhs);                                    \
+    IREE_VMVX_MAP_2D(args->r4, false, args->i5, args->i6, args->i7, size0,  \
+                     size1, type, &rhs);                                    \
+    IREE_VMVX_MAP_2D(args->r8, true, args->i9, args->i10, args->i11, size0, \
+                     size1, type, &out);                                    \
+    if (args->i3 == 1 && args->i7 == 1 && args->i11 == 1) {                 \
+      for (int64_t i = 0; i < size0; ++i) {                                 \
+        const type* IREE_RESTRICT lhs_row = lhs + i * args->i2;             \
+        const type* IREE_RESTRICT rhs_row = rhs + i * args->i6;             \
+        type* IREE_RESTRICT out_row = out + i * args->i10;                  \
+        for (int64_t j = 0; j < size1; ++j) {                               \
+          out_row[j] = lhs_row[j] op rhs_row[j];                            \
+        }                                                                   \
+      }                                                                     \
+    } else {                                                                \
+      for (int64_t i = 0; i < size0; ++i) {                                 \
+        for (int64_t j = 0; j < size1; ++j) {                               \
+          out[i * args->i10 + j * args->i11] =                              \
+              lhs[i * args->i2 + j * args->i3] op                           \
+              rhs[i * args->i6 + j * args->i7];                             \
+        }                                                                   \
+      }                                                                     \
+    }                                                                       \
+    return iree_ok_status();                                                \
+  }
+
+IREE_VMVX_BINARY_2D(add_2d_f32, float, +)
+IREE_VMVX_BINARY_2D(add_2d_i32, int32_t, +)
+IREE_VMVX_BINARY_2D(mul_2d_f32, float, *)
+IREE_VMVX_BINARY_2D(mul_2d_i32, int32_t, *)
+
+#define IREE_VMVX_COPY_2D(name, type)                                     \
+  IREE_VM_ABI_EXPORT(iree_vmvx_module_##name, iree_vmvx_module_state_t,   \
+                     rIIIrIIIII, v) {                                     \
+    const int64_t size0 = args->i8;                                       \
+    const int64_t size1 = args->i9;                                       \
+    const type* in = NULL;                                                \
+    type* out = NULL;                                                     \
+    IREE_VMVX_MAP_2D(args->r0, false, args->i1, args->i2, args->i3,       \
+                     size0, size1, type, &in);                            \
+    IREE_VMVX_MAP_2D(args->r4, true, args->i5, args->i6, args->i7, size0, \
+                     size1, type, &out);                                  \
+    if (args->i3 == 1 && args->i7 == 1) {                                 \
+      for (int64_t i = 0; i < size0; ++i) {                               \
+        memmove(out + i * args->i6, in + i * args->i2,                    \
+                size1 * sizeof(type));                                    \
+      }                                                                   \
+    } else {                                                              \
+      for (int64_t i = 0; i < size0; ++i) {                               \
+        for (int64_t j = 0; j < size1; ++j) {                             \
+          out[i * args->i6 + j * args->i7] =                              \
+              in[i * args->i2 + j * args->i3];                            \
+        }                                                                 \
+      }                                                                   \
+    }                                                                     \
+    return iree_ok_status();                                              \
+  }
 
-// Placeholder to make the function pointer arrays happy (they can't be empty).
-IREE_VM_ABI_EXPORT(iree_vmvx_module_placeholder,  //
+IREE_VMVX_COPY_2D(copy_2d_x32, uint32_t)
+IREE_VMVX_COPY_2D(copy_2d_x8, uint8_t)
+
+IREE_VM_ABI_EXPORT(iree_vmvx_module_fill_2d_x32,  //
                    iree_vmvx_module_state_t,      //
-                   v, v) {
+                   irIIIII, v) {
+  const uint32_t value = (uint32_t)args->i0;
+  const int64_t size0 = args->i5;
+  const int64_t size1 = args->i6;
+  uint32_t* out = NULL;
+  IREE_VMVX_MAP_2D(args->r1, true, args->i2, args->i3, args->i4, size0, size1,
+                   uint32_t, &out);
+  for (int64_t i = 0; i < size0; ++i) {
+    uint32_t* IREE_RESTRICT out_row = out + i * args->i3;
+    if (args->i4 == 1) {
+      for (int64_t j = 0; j < size1; ++j) out_row[j] = value;
+    } else {
+      for (int64_t j = 0; j < size1; ++j) out_row[j * args->i4] = value;
+    }
+  }
   return iree_ok_status();
 }
 
+//===----------------------------------------------------------------------===//
+// Reductions
+//===----------------------------------------------------------------------===//
+
+// Reduces each row of the 2D input into one element of the 1D output.
+#define IREE_VMVX_REDUCE_2D(name, type, init, combine)                      \
+  IREE_VM_ABI_EXPORT(iree_vmvx_module_##name, iree_vmvx_module_state_t,     \
+                     rIIIrIIII, v) {                                        \
+    const int64_t size0 = args->i7;                                         \
+    const int64_t size1 = args->i8;                                         \
+    const type* in = NULL;                                                  \
+    type* out = NULL;                                                       \
+    IREE_VMVX_MAP_2D(args->r0, false, args->i1, args->i2, args->i3, size0,  \
+                     size1, type, &in);                                     \
+    IREE_VMVX_MAP_2D(args->r4, true, args->i5, args->i6, 1, size0, 1, type, \
+                     &out);                                                 \
+    for (int64_t i = 0; i < size0 && size1 > 0; ++i) {                      \
+      const type* IREE_RESTRICT in_row = in + i * args->i2;                 \
+      type acc = init;                                                      \
+      for (int64_t j = 0; j < size1; ++j) {                                 \
+        const type value = in_row[j * args->i3];                            \
+        acc = combine;                                                      \
+      }                                                                     \
+      out[i * args->i6] = acc;                                              \
+    }                                                                       \
+    return iree_ok_status();                                                \
+  }
+
+IREE_VMVX_REDUCE_2D(reduce_max_2d_f32, float, in_row[0],
+                    value > acc ? value : acc)
+IREE_VMVX_REDUCE_2D(reduce_sum_2d_f32, float, 0.0f, acc + value)
+
+//===----------------------------------------------------------------------===//
+// Matrix multiplication
+//===----------------------------------------------------------------------===//
+
+// Accumulates into the existing output contents instead of overwriting.
+#define IREE_VMVX_MATMUL_FLAG_ACCUMULATE 0x1u
+
+// out[m][n] (+)= lhs[m][k] * rhs[k][n] with row-major operands that have a
+// contiguous innermost dimension.
+IREE_VM_ABI_EXPORT(iree_vmvx_module_matmul_f32f32f32,  //
+                   iree_vmvx_module_state_t,           //
+                   rIIrIIrIIIIIi, v) {
+  const int64_t m = args->i9;
+  const int64_t n = args->i10;
+  const int64_t k = args->i11;
+  const uint32_t flags = (uint32_t)args->i12;
+  const float* lhs = NULL;
+  const float* rhs = NULL;
+  float* out = NULL;
+  IREE_VMVX_MAP_2D(args->r0, false, args->i1, args->i2, 1, m, k, float, &lhs);
+  IREE_VMVX_MAP_2D(args->r3, false, args->i4, args->i5, 1, k, n, float, &rhs);
+  IREE_VMVX_MAP_2D(args->r6, true, args->i7, args->i8, 1, m, n, float, &out);
+  for (int64_t i = 0; i < m && n > 0; ++i) {
+    float* IREE_RESTRICT out_row = out + i * args->i8;
+    if (!(flags & IREE_VMVX_MATMUL_FLAG_ACCUMULATE)) {
+      memset(out_row, 0, n * sizeof(*out_row));
+    }
+    for (int64_t l = 0; l < k; ++l) {
+      const float lhs_value = lhs[i * args->i2 + l];
+      const float* IREE_RESTRICT rhs_row = rhs + l * args->i5;
+      for (int64_t j = 0; j < n; ++j) out_row[j] += lhs_value * rhs_row[j];
+    }
+  }
+  return iree_ok_status();
+}
+
+// Tiled matmul with a transposed RHS; see iree/builtins/ukernel/api.h.
+// The flags match IREE_UK_FLAG_*.
+#define IREE_VMVX_MMT4D(name, lhs_type, out_type)                              \
+  IREE_VM_ABI_EXPORT(iree_vmvx_module_##name, iree_vmvx_module_state_t,        \
+                     rIIrIIrIIIIIiiii, v) {                                    \
+    iree_uk_mmt4d_params_t params;                                             \
+    memset(&params, 0, sizeof(params));                                        \
+    params.M = args->i9;                                                       \
+    params.N = args->i10;                                                      \
+    params.K = args->i11;                                                      \
+    params.M0 = args->i12;                                                     \
+    params.N0 = args->i13;                                                     \
+    params.K0 = args->i14;                                                     \
+    params.flags = (uint32_t)args->i15;                                        \
+    params.lhs_stride = args->i2;                                              \
+    params.rhs_stride = args->i5;                                              \
+    params.out_stride = args->i8;                                              \
+    params.cpu_data = state->cpu_data;                                         \
+    if (params.M0 <= 0 || params.N0 <= 0 || params.K0 <= 0 || params.K < 0) {  \
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,                    \
+                              "invalid mmt4d tile sizes");                     \
+    }                                                                          \
+    IREE_VMVX_MAP_2D(args->r0, false, args->i1, args->i2, 1, params.M,         \
+                     params.K * params.M0 * params.K0, lhs_type,               \
+                     &params.lhs_buffer);                                      \
+    IREE_VMVX_MAP_2D(args->r3, false, args->i4, args->i5, 1, params.N,         \
+                     params.K * params.N0 * params.K0, lhs_type,               \
+                     &params.rhs_buffer);                                      \
+    IREE_VMVX_MAP_2D(args->r6, true, args->i7, args->i8, 1, params.M,          \
+                     params.N * params.M0 * params.N0, out_type,               \
+                     &params.out_buffer);                                      \
+    if (iree_uk_##name(&params) != 0) {                                        \
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,                    \
+                              "invalid mmt4d parameters");                     \
+    }                                                                          \
+    return iree_ok_status();                                                   \
+  }
+
+IREE_VMVX_MMT4D(mmt4d_f32f32f32, float, float)
+IREE_VMVX_MMT4D(mmt4d_i8i8i32, int8_t, int32_t)
+
 //===----------------------------------------------------------------------===//
 // VM module interface implementation
 //===----------------------------------------------------------------------===//
@@ -0,0 +1,509 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/runtime/batcher.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/modules/hal/module.h"
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_batcher_options_t
+//===----------------------------------------------------------------------===//
+
+IREE_API_EXPORT void iree_runtime_batcher_options_initialize(
+    iree_runtime_batcher_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->max_batch_size = 16;
+  out_options->max_delay_ns = 1000000;  // 1ms
+}
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_batcher_t
+//===----------------------------------------------------------------------===//
+
+// A single call enqueued by a caller. Lives on the stack of the caller, which
+// blocks until the request has completed.
+typedef struct iree_runtime_batcher_request_t {
+  struct iree_runtime_batcher_request_t* next;
+  iree_vm_list_t* input_list;
+  iree_vm_list_t* output_list;
+  // Leading dimension shared by all inputs of the request.
+  iree_hal_dim_t batch_size;
+  // Result of the batch the request was issued in; set before |completed|.
+  iree_status_t status;
+  // Set to 1 by the batch leader once |status| and |output_list| are populated.
+  // After this the request must not be touched by the leader.
+  iree_atomic_int32_t completed;
+} iree_runtime_batcher_request_t;
+
+// A batch of requests that will be issued together. Lives on the stack of the
+// leader (the first request in the batch) which issues the batch when it is
+// sealed or its delay has elapsed.
+typedef struct iree_runtime_batcher_batch_t {
+  iree_runtime_batcher_request_t* head;
+  iree_runtime_batcher_request_t* tail;
+  iree_host_size_t request_count;
+  // Sum of the batch sizes of all requests.
+  iree_hal_dim_t batch_size;
+  // Set to 1 when no more requests may join the batch.
+  iree_atomic_int32_t sealed;
+} iree_runtime_batcher_batch_t;
+
+struct iree_runtime_batcher_t {
+  iree_atomic_ref_count_t ref_count;
+  iree_allocator_t host_allocator;
+
+  iree_runtime_session_t* session;
+  iree_vm_function_t function;
+  iree_runtime_batcher_options_t options;
+
+  // Guards |pending_batch| and the membership of the batch it references.
+  iree_slim_mutex_t mutex;
+  // Batch currently accepting new requests, if any.
+  iree_runtime_batcher_batch_t* pending_batch;
+
+  // Serializes batched calls into the thread-compatible session.
+  iree_slim_mutex_t call_mutex;
+
+  // Posted whenever a batch is sealed or its requests are completed.
+  iree_notification_t notification;
+};
+
+IREE_API_EXPORT iree_status_t iree_runtime_batcher_create(
+    iree_runtime_session_t* session, const iree_vm_function_t* function,
+    const iree_runtime_batcher_options_t* options,
+    iree_allocator_t host_allocator, iree_runtime_batcher_t** out_batcher) {
+  IREE_ASSERT_ARGUMENT(session);
+  IREE_ASSERT_ARGUMENT(function);
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_batcher);
+  *out_batcher = NULL;
+  if (options->max_batch_size == 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "max_batch_size must be at least 1");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_runtime_batcher_t* batcher = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*batcher),
+                                (void**)&batcher));
+  memset(batcher, 0, sizeof(*batcher));
+  iree_atomic_ref_count_init(&batcher->ref_count);
+  batcher->host_allocator = host_allocator;
+  batcher->session = session;
+  iree_runtime_session_retain(session);
+  batcher->function = *function;
+  batcher->options = *options;
+  iree_slim_mutex_initialize(&batcher->mutex);
+  iree_slim_mutex_initialize(&batcher->call_mutex);
+  iree_notification_initialize(&batcher->notification);
+
+  *out_batcher = batcher;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_runtime_batcher_destroy(iree_runtime_batcher_t* batcher) {
+  IREE_ASSERT_ARGUMENT(batcher);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  IREE_ASSERT(!batcher->pending_batch, "calls still in flight");
+  iree_notification_deinitialize(&batcher->notification);
+  iree_slim_mutex_deinitialize(&batcher->call_mutex);
+  iree_slim_mutex_deinitialize(&batcher->mutex);
+  iree_runtime_session_release(batcher->session);
+  iree_allocator_free(batcher->host_allocator, batcher);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+IREE_API_EXPORT void iree_runtime_batcher_retain(
+    iree_runtime_batcher_t* batcher) {
+  if (batcher) {
+    iree_atomic_ref_count_inc(&batcher->ref_count);
+  }
+}
+
+IREE_API_EXPORT void iree_runtime_batcher_release(
+    iree_runtime_batcher_t* batcher) {
+  if (batcher && iree_atomic_ref_count_dec(&batcher->ref_count) == 1) {
+    iree_runtime_batcher_destroy(batcher);
+  }
+}
+
+// Returns the buffer view at |i| in |list| without retaining it.
+static iree_status_t iree_runtime_batcher_list_get_buffer_view(
+    iree_vm_list_t* list, iree_host_size_t i,
+    iree_hal_buffer_view_t** out_buffer_view) {
+  iree_vm_ref_t value = {0};
+  IREE_RETURN_IF_ERROR(iree_vm_list_get_ref_assign(list, i, &value));
+  return iree_hal_buffer_view_check_deref(value, out_buffer_view);
+}
+
+// Returns the leading dimension shared by all buffer views in |input_list|.
+static iree_status_t iree_runtime_batcher_query_batch_size(
+    iree_vm_list_t* input_list, iree_hal_dim_t* out_batch_size) {
+  *out_batch_size = 0;
+  const iree_host_size_t input_count = iree_vm_list_size(input_list);
+  if (input_count == 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "batched calls require at least one input");
+  }
+  for (iree_host_size_t i = 0; i < input_count; ++i) {
+    iree_hal_buffer_view_t* buffer_view = NULL;
+    IREE_RETURN_IF_ERROR(
+        iree_runtime_batcher_list_get_buffer_view(input_list, i, &buffer_view),
+        "batched call inputs must be buffer views");
+    if (iree_hal_buffer_view_shape_rank(buffer_view) == 0) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "batched call input %zu is a scalar; inputs "
+                              "require a leading batch dimension",
+                              i);
+    }
+    const iree_hal_dim_t batch_size =
+        iree_hal_buffer_view_shape_dim(buffer_view, 0);
+    if (i > 0 && batch_size != *out_batch_size) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "batched call input %zu has a leading dimension "
+                              "of %" PRIdim " but prior inputs have %" PRIdim,
+                              i, batch_size, *out_batch_size);
+    }
+    *out_batch_size = batch_size;
+  }
+  return iree_ok_status();
+}
+
+// Returns true if the inputs of |a| and |b| differ only in their leading
+// dimension such that they can be concatenated.
+static bool iree_runtime_batcher_requests_are_compatible(
+    const iree_runtime_batcher_request_t* a,
+    const iree_runtime_batcher_request_t* b) {
+  const iree_host_size_t input_count = iree_vm_list_size(a->input_list);
+  if (iree_vm_list_size(b->input_list) != input_count) return false;
+  for (iree_host_size_t i = 0; i < input_count; ++i) {
+    iree_hal_buffer_view_t* a_view = NULL;
+    iree_hal_buffer_view_t* b_view = NULL;
+    // Both lists were verified by iree_runtime_batcher_query_batch_size.
+    iree_status_ignore(
+        iree_runtime_batcher_list_get_buffer_view(a->input_list, i, &a_view));
+    iree_status_ignore(
+        iree_runtime_batcher_list_get_buffer_view(b->input_list, i, &b_view));
+    const iree_host_size_t rank = iree_hal_buffer_view_shape_rank(a_view);
+    if (iree_hal_buffer_view_shape_rank(b_view) != rank ||
+        iree_hal_buffer_view_element_type(a_view) !=
+            iree_hal_buffer_view_element_type(b_view) ||
+        iree_hal_buffer_view_encoding_type(a_view) !=
+            iree_hal_buffer_view_encoding_type(b_view)) {
+      return false;
+    }
+    const iree_hal_dim_t* a_dims = iree_hal_buffer_view_shape_dims(a_view);
+    const iree_hal_dim_t* b_dims = iree_hal_buffer_view_shape_dims(b_view);
+    if (memcmp(a_dims + 1, b_dims + 1, (rank - 1) * sizeof(*a_dims)) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void iree_runtime_batcher_batch_append(
+    iree_runtime_batcher_batch_t* batch,
+    iree_runtime_batcher_request_t* request) {
+  if (batch->tail) {
+    batch->tail->next = request;
+  } else {
+    batch->head = request;
+  }
+  batch->tail = request;
+  ++batch->request_count;
+  batch->batch_size += request->batch_size;
+}
+
+// Seals |batch| so that no more requests may join it.
+// The caller must post the notification after releasing the mutex.
+static void iree_runtime_batcher_seal_locked(
+    iree_runtime_batcher_t* batcher, iree_runtime_batcher_batch_t* batch) {
+  iree_atomic_store_int32(&batch->sealed, 1, iree_memory_order_release);
+  if (batcher->pending_batch == batch) batcher->pending_batch = NULL;
+}
+
+static bool iree_runtime_batcher_batch_is_sealed(void* arg) {
+  iree_runtime_batcher_batch_t* batch = (iree_runtime_batcher_batch_t*)arg;
+  return iree_atomic_load_int32(&batch->sealed, iree_memory_order_acquire) != 0;
+}
+
+static bool iree_runtime_batcher_request_is_completed(void* arg) {
+  iree_runtime_batcher_request_t* request =
+      (iree_runtime_batcher_request_t*)arg;
+  return iree_atomic_load_int32(&request->completed,
+                                iree_memory_order_acquire) != 0;
+}
+
+// Concatenates input |input_ordinal| of all requests in |batch| along the
+// leading dimension and appends the result to |batch_inputs|.
+static iree_status_t iree_runtime_batcher_gather_input(
+    iree_runtime_batcher_t* batcher, iree_runtime_batcher_batch_t* batch,
+    iree_host_size_t input_ordinal, iree_vm_list_t* batch_inputs) {
+  iree_hal_buffer_view_t* head_view = NULL;
+  IREE_RETURN_IF_ERROR(iree_runtime_batcher_list_get_buffer_view(
+      batch->head->input_list, input_ordinal, &head_view));
+  const iree_host_size_t rank = iree_hal_buffer_view_shape_rank(head_view);
+  iree_hal_dim_t* shape =
+      (iree_hal_dim_t*)iree_alloca(rank * sizeof(iree_hal_dim_t));
+  memcpy(shape, iree_hal_buffer_view_shape_dims(head_view),
+         rank * sizeof(iree_hal_dim_t));
+  shape[0] = batch->batch_size;
+
+  const iree_hal_buffer_params_t buffer_params = {
+      .type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL,
+      .usage = IREE_HAL_BUFFER_USAGE_DEFAULT,
+  };
+  iree_hal_buffer_view_t* batch_view = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_view_allocate_buffer(
+      iree_runtime_session_device_allocator(batcher->session), rank, shape,
+      iree_hal_buffer_view_element_type(head_view),
+      iree_hal_buffer_view_encoding_type(head_view), buffer_params,
+      iree_const_byte_span_empty(), &batch_view));
+
+  iree_hal_device_t* device = iree_runtime_session_device(batcher->session);
+  iree_status_t status = iree_ok_status();
+  iree_device_size_t offset = 0;
+  for (iree_runtime_batcher_request_t* request = batch->head;
+       request && iree_status_is_ok(status); request = request->next) {
+    iree_hal_buffer_view_t* request_view = NULL;
+    status = iree_runtime_batcher_list_get_buffer_view(
+        request->input_list, input_ordinal, &request_view);
+    if (!iree_status_is_ok(status)) break;
+    const iree_device_size_t length =
+        iree_hal_buffer_view_byte_length(request_view);
+    if (length > 0) {
+      status = iree_hal_device_transfer_d2d(
+          device, iree_hal_buffer_view_buffer(request_view), 0,
+          iree_hal_buffer_view_buffer(batch_view), offset, length,
+          IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+    }
+    offset += length;
+  }
+
+  if (iree_status_is_ok(status)) {
+    iree_vm_ref_t batch_view_ref = iree_hal_buffer_view_move_ref(batch_view);
+    status = iree_vm_list_push_ref_move(batch_inputs, &batch_view_ref);
+    if (!iree_status_is_ok(status)) iree_vm_ref_release(&batch_view_ref);
+  } else {
+    iree_hal_buffer_view_release(batch_view);
+  }
+  return status;
+}
+
+// Slices output |output_ordinal| of |batch_outputs| along the leading
+// dimension and appends each request's rows to its output list.
+static iree_status_t iree_runtime_batcher_scatter_output(
+    iree_runtime_batcher_t* batcher, iree_runtime_batcher_batch_t* batch,
+    iree_vm_list_t* batch_outputs, iree_host_size_t output_ordinal) {
+  iree_hal_buffer_view_t* batch_view = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_runtime_batcher_list_get_buffer_view(batch_outputs, output_ordinal,
+                                                &batch_view),
+      "batched call outputs must be buffer views");
+  const iree_host_size_t rank = iree_hal_buffer_view_shape_rank(batch_view);
+  if (rank == 0 ||
+      iree_hal_buffer_view_shape_dim(batch_view, 0) != batch->batch_size) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "batched call output %zu does not have a leading "
+                            "dimension matching the batch size %" PRIdim,
+                            output_ordinal, batch->batch_size);
+  }
+  iree_hal_dim_t* shape =
+      (iree_hal_dim_t*)iree_alloca(rank * sizeof(iree_hal_dim_t));
+  memcpy(shape, iree_hal_buffer_view_shape_dims(batch_view),
+         rank * sizeof(iree_hal_dim_t));
+  const iree_device_size_t row_length =
+      batch->batch_size
+          ? iree_hal_buffer_view_byte_length(batch_view) / batch->batch_size
+          : 0;
+
+  iree_device_size_t offset = 0;
+  for (iree_runtime_batcher_request_t* request = batch->head; request;
+       request = request->next) {
+    const iree_device_size_t length = request->batch_size * row_length;
+    if (request->output_list) {
+      iree_hal_buffer_t* request_buffer = NULL;
+      IREE_RETURN_IF_ERROR(
+          iree_hal_buffer_subspan(iree_hal_buffer_view_buffer(batch_view),
+                                  offset, length, &request_buffer));
+      shape[0] = request->batch_size;
+      iree_hal_buffer_view_t* request_view = NULL;
+      iree_status_t status = iree_hal_buffer_view_create(
+          request_buffer, rank, shape,
+          iree_hal_buffer_view_element_type(batch_view),
+          iree_hal_buffer_view_encoding_type(batch_view),
+          iree_runtime_session_host_allocator(batcher->session),
+          &request_view);
+      iree_hal_buffer_release(request_buffer);
+      IREE_RETURN_IF_ERROR(status);
+      iree_vm_ref_t request_view_ref =
+          iree_hal_buffer_view_move_ref(request_view);
+      status = iree_vm_list_push_ref_move(request->output_list,
+                                          &request_view_ref);
+      if (!iree_status_is_ok(status)) {
+        iree_vm_ref_release(&request_view_ref);
+        return status;
+      }
+    }
+    offset += length;
+  }
+  return iree_ok_status();
+}
+
+// Issues |batch| as a single call and scatters the results to its requests.
+// The caller must hold the call mutex.
+static iree_status_t iree_runtime_batcher_issue(
+    iree_runtime_batcher_t* batcher, iree_runtime_batcher_batch_t* batch) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (int64_t)batch->request_count);
+
+  // Requests issued alone are passed through without any copies.
+  if (batch->request_count == 1) {
+    iree_status_t status = iree_runtime_session_call(
+        batcher->session, &batcher->function, batch->head->input_list,
+        batch->head->output_list);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+
+  const iree_host_size_t input_count =
+      iree_vm_list_size(batch->head->input_list);
+  iree_allocator_t host_allocator =
+      iree_runtime_session_host_allocator(batcher->session);
+  iree_vm_list_t* batch_inputs = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_vm_list_create(/*element_type=*/NULL, input_count,
+                              host_allocator, &batch_inputs));
+  iree_vm_list_t* batch_outputs = NULL;
+  iree_status_t status = iree_vm_list_create(/*element_type=*/NULL, 16,
+                                             host_allocator, &batch_outputs);
+
+  for (iree_host_size_t i = 0; i < input_count && iree_status_is_ok(status);
+       ++i) {
+    status = iree_runtime_batcher_gather_input(batcher, batch, i, batch_inputs);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_runtime_session_call(batcher->session, &batcher->function,
+                                       batch_inputs, batch_outputs);
+  }
+  if (iree_status_is_ok(status)) {
+    const iree_host_size_t output_count = iree_vm_list_size(batch_outputs);
+    for (iree_host_size_t i = 0; i < output_count && iree_status_is_ok(status);
+         ++i) {
+      status = iree_runtime_batcher_scatter_output(batcher, batch,
+                                                   batch_outputs, i);
+    }
+  }
+
+  iree_vm_list_release(batch_outputs);
+  iree_vm_list_release(batch_inputs);
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+IREE_API_EXPORT iree_status_t iree_runtime_batcher_call(
+    iree_runtime_batcher_t* batcher, iree_vm_list_t* input_list,
+    iree_vm_list_t* output_list) {
+  IREE_ASSERT_ARGUMENT(batcher);
+  IREE_ASSERT_ARGUMENT(input_list);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_runtime_batcher_request_t request;
+  memset(&request, 0, sizeof(request));
+  request.input_list = input_list;
+  request.output_list = output_list;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0,
+      iree_runtime_batcher_query_batch_size(input_list, &request.batch_size));
+  const iree_hal_dim_t max_batch_size =
+      (iree_hal_dim_t)batcher->options.max_batch_size;
+
+  // Join the pending batch if the request fits or otherwise start a new one.
+  // A pending batch the request can't join is sealed early so that it issues
+  // immediately and requests aren't reordered behind it.
+  iree_runtime_batcher_batch_t batch;
+  memset(&batch, 0, sizeof(batch));
+  bool is_leader = false;
+  bool needs_post = false;
+  iree_slim_mutex_lock(&batcher->mutex);
+  iree_runtime_batcher_batch_t* pending_batch = batcher->pending_batch;
+  if (pending_batch &&
+      (pending_batch->batch_size + request.batch_size > max_batch_size ||
+       !iree_runtime_batcher_requests_are_compatible(pending_batch->head,
+                                                     &request))) {
+    iree_runtime_batcher_seal_locked(batcher, pending_batch);
+    needs_post = true;
+    pending_batch = NULL;
+  }
+  if (pending_batch) {
+    iree_runtime_batcher_batch_append(pending_batch, &request);
+    if (pending_batch->batch_size >= max_batch_size) {
+      iree_runtime_batcher_seal_locked(batcher, pending_batch);
+      needs_post = true;
+    }
+  } else {
+    is_leader = true;
+    iree_runtime_batcher_batch_append(&batch, &request);
+    if (batch.batch_size >= max_batch_size) {
+      iree_atomic_store_int32(&batch.sealed, 1, iree_memory_order_relaxed);
+    } else {
+      batcher->pending_batch = &batch;
+    }
+  }
+  iree_slim_mutex_unlock(&batcher->mutex);
+  if (needs_post) {
+    iree_notification_post(&batcher->notification, IREE_ALL_WAITERS);
+  }
+
+  // Followers wait for the leader to complete their request.
+  if (!is_leader) {
+    iree_notification_await(&batcher->notification,
+                            iree_runtime_batcher_request_is_completed,
+                            &request, iree_infinite_timeout());
+    IREE_TRACE_ZONE_END(z0);
+    return request.status;
+  }
+
+  // Wait for the batch to fill or the delay to elapse and then seal it so that
+  // its membership is fixed.
+  iree_notification_await(
+      &batcher->notification, iree_runtime_batcher_batch_is_sealed, &batch,
+      iree_make_timeout_ns(batcher->options.max_delay_ns));
+  iree_slim_mutex_lock(&batcher->mutex);
+  iree_runtime_batcher_seal_locked(batcher, &batch);
+  iree_slim_mutex_unlock(&batcher->mutex);
+
+  iree_slim_mutex_lock(&batcher->call_mutex);
+  iree_status_t status = iree_runtime_batcher_issue(batcher, &batch);
+  iree_slim_mutex_unlock(&batcher->call_mutex);
+
+  // Complete all followers; each may return (and pop its request off of its
+  // stack) as soon as it observes completion.
+  iree_runtime_batcher_request_t* follower = batch.head->next;
+  while (follower) {
+    iree_runtime_batcher_request_t* next = follower->next;
+    follower->status =
+        iree_status_is_ok(status) ? iree_ok_status() : iree_status_clone(status);
+    iree_atomic_store_int32(&follower->completed, 1, iree_memory_order_release);
+    follower = next;
+  }
+  if (batch.request_count > 1) {
+    iree_notification_post(&batcher->notification, IREE_ALL_WAITERS);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
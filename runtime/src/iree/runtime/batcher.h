@@ -0,0 +1,103 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_RUNTIME_BATCHER_H_
+#define IREE_RUNTIME_BATCHER_H_
+
+#include <stdint.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/runtime/session.h"
+#include "iree/vm/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_batcher_options_t
+//===----------------------------------------------------------------------===//
+
+// Options used to configure batcher creation.
+typedef struct iree_runtime_batcher_options_t {
+  // Maximum total batch size (the sum of the leading dimension of the inputs
+  // of each request) of a single batched call. Requests larger than this are
+  // issued on their own.
+  iree_host_size_t max_batch_size;
+
+  // Maximum duration the first request of a batch waits for additional
+  // requests to arrive before the batch is issued. Requests may wait longer if
+  // a prior batch is still executing.
+  iree_duration_t max_delay_ns;
+} iree_runtime_batcher_options_t;
+
+// Initializes |out_options| to its default values.
+IREE_API_EXPORT void iree_runtime_batcher_options_initialize(
+    iree_runtime_batcher_options_t* out_options);
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_batcher_t
+//===----------------------------------------------------------------------===//
+
+// Dynamically batches concurrent calls to a session function.
+//
+// The function must have been compiled with a dynamic leading (batch)
+// dimension on all of its inputs and outputs: calling it with inputs of batch
+// size N must produce outputs of batch size N where row i of each output
+// depends only on row i of each input. Concurrent callers enqueue requests with
+// iree_runtime_batcher_call and requests with otherwise matching input shapes
+// and element types are coalesced by concatenating their inputs along the
+// leading dimension. A batch is issued when it reaches max_batch_size or
+// max_delay_ns after its first request arrived and each caller receives views
+// of its rows of the batched outputs.
+//
+// Batches are issued on the thread of the first caller to join them and no
+// additional threads are created. While a batch is executing the next batch
+// accumulates requests such that batching naturally increases under load.
+//
+// Thread-safe; any number of threads may issue calls concurrently. The session
+// is thread-compatible and must not be used by anything other than the batcher
+// while calls are in flight.
+typedef struct iree_runtime_batcher_t iree_runtime_batcher_t;
+
+// Creates a batcher issuing calls to |function| in |session|.
+// The session is retained for the lifetime of the batcher.
+IREE_API_EXPORT iree_status_t iree_runtime_batcher_create(
+    iree_runtime_session_t* session, const iree_vm_function_t* function,
+    const iree_runtime_batcher_options_t* options,
+    iree_allocator_t host_allocator, iree_runtime_batcher_t** out_batcher);
+
+// Retains the given |batcher| for the caller.
+IREE_API_EXPORT void iree_runtime_batcher_retain(
+    iree_runtime_batcher_t* batcher);
+
+// Releases the given |batcher| from the caller.
+IREE_API_EXPORT void iree_runtime_batcher_release(
+    iree_runtime_batcher_t* batcher);
+
+// Synchronously issues a call as part of a batch.
+//
+// |input_list| must contain only buffer views that all have the same leading
+// dimension, which is the batch size of the request. List ownership remains
+// with the caller and the buffer views must not be modified until the call
+// returns.
+//
+// |output_list| is populated after the batch completes execution with buffer
+// views of the rows of each batched output corresponding to this request. The
+// views reference the batched output storage. List ownership remains with the
+// caller.
+//
+// Failures during batched execution are returned to all requests in the batch.
+IREE_API_EXPORT iree_status_t iree_runtime_batcher_call(
+    iree_runtime_batcher_t* batcher, iree_vm_list_t* input_list,
+    iree_vm_list_t* output_list);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_RUNTIME_BATCHER_H_
@@ -17,8 +17,11 @@
 // iree_runtime_call_t
 //===----------------------------------------------------------------------===//
 
-IREE_API_EXPORT iree_status_t iree_runtime_call_initialize(
+// Initializes |out_call| with lists allocated from |list_allocator|.
+// If |transient| is true the lists are fixed-capacity and initialized in-place.
+static iree_status_t iree_runtime_call_initialize_lists(
     iree_runtime_session_t* session, iree_vm_function_t function,
+    bool transient, iree_allocator_t list_allocator,
     iree_runtime_call_t* out_call) {
   IREE_ASSERT_ARGUMENT(session);
   IREE_ASSERT_ARGUMENT(out_call);
@@ -35,20 +38,45 @@ IREE_API_EXPORT iree_status_t iree_runtime_call_initialize(
   out_call->session = session;
   iree_runtime_session_retain(session);
   out_call->function = function;
+  out_call->transient = transient;
+
+  // Functions using destination passing take one trailing storage argument
+  // for each result (see iree/compiler/Bindings/Native).
+  iree_string_view_t output_storage = iree_vm_function_lookup_attr_by_name(
+      &function, IREE_SV("iree.abi.output_storage"));
+  if (!iree_string_view_is_empty(output_storage)) {
+    uint32_t output_storage_count = 0;
+    if (!iree_string_view_atoi_uint32(output_storage, &output_storage_count) ||
+        output_storage_count != results.size ||
+        output_storage_count > arguments.size) {
+      iree_runtime_call_deinitialize(out_call);
+      return iree_make_status(
+          IREE_STATUS_INVALID_ARGUMENT,
+          "function has malformed iree.abi.output_storage reflection '%.*s'",
+          (int)output_storage.size, output_storage.data);
+    }
+    out_call->output_storage_ordinal = arguments.size - output_storage_count;
+    out_call->output_storage_count = output_storage_count;
+  }
 
   // Allocate the input and output lists with the required capacity.
-  // A user wanting to avoid dynamic allocations could instead create on-stack
-  // storage for these and use iree_vm_list_initialize instead. This high-level
-  // API keeps things simple, though, and for the frequency of calls through
-  // this interface a few small pooled malloc calls should be fine.
-  iree_allocator_t host_allocator =
-      iree_runtime_session_host_allocator(session);
-  iree_status_t status = iree_vm_list_create(
-      /*element_type=*/NULL, arguments.size, host_allocator, &out_call->inputs);
-  if (iree_status_is_ok(status)) {
-    status = iree_vm_list_create(
-        /*element_type=*/NULL, results.size, host_allocator,
-        &out_call->outputs);
+  iree_status_t status = iree_ok_status();
+  if (transient) {
+    status = iree_vm_list_initialize_transient(
+        /*element_type=*/NULL, arguments.size, list_allocator,
+        &out_call->inputs);
+    if (iree_status_is_ok(status)) {
+      status = iree_vm_list_initialize_transient(
+          /*element_type=*/NULL, results.size, list_allocator,
+          &out_call->outputs);
+    }
+  } else {
+    status = iree_vm_list_create(/*element_type=*/NULL, arguments.size,
+                                 list_allocator, &out_call->inputs);
+    if (iree_status_is_ok(status)) {
+      status = iree_vm_list_create(/*element_type=*/NULL, results.size,
+                                   list_allocator, &out_call->outputs);
+    }
   }
 
   if (!iree_status_is_ok(status)) {
@@ -57,6 +85,26 @@ IREE_API_EXPORT iree_status_t iree_runtime_call_initialize(
   return status;
 }
 
+IREE_API_EXPORT iree_status_t iree_runtime_call_initialize(
+    iree_runtime_session_t* session, iree_vm_function_t function,
+    iree_runtime_call_t* out_call) {
+  IREE_ASSERT_ARGUMENT(session);
+  // A user wanting to avoid dynamic allocations could instead use
+  // iree_runtime_call_initialize_transient with an arena. This keeps things
+  // simple, though, and for the frequency of calls through this interface a
+  // few small pooled malloc calls should be fine.
+  return iree_runtime_call_initialize_lists(
+      session, function, /*transient=*/false,
+      iree_runtime_session_host_allocator(session), out_call);
+}
+
+IREE_API_EXPORT iree_status_t iree_runtime_call_initialize_transient(
+    iree_runtime_session_t* session, iree_vm_function_t function,
+    iree_allocator_t list_allocator, iree_runtime_call_t* out_call) {
+  return iree_runtime_call_initialize_lists(
+      session, function, /*transient=*/true, list_allocator, out_call);
+}
+
 IREE_API_EXPORT iree_status_t iree_runtime_call_initialize_by_name(
     iree_runtime_session_t* session, iree_string_view_t full_name,
     iree_runtime_call_t* out_call) {
@@ -68,8 +116,20 @@ IREE_API_EXPORT iree_status_t iree_runtime_call_initialize_by_name(
 
 IREE_API_EXPORT void iree_runtime_call_deinitialize(iree_runtime_call_t* call) {
   IREE_ASSERT_ARGUMENT(call);
-  iree_vm_list_release(call->inputs);
-  iree_vm_list_release(call->outputs);
+  if (call->transient) {
+    if (call->inputs) iree_vm_list_deinitialize(call->inputs);
+    if (call->outputs) iree_vm_list_deinitialize(call->outputs);
+  } else {
+    iree_vm_list_release(call->inputs);
+    iree_vm_list_release(call->outputs);
+  }
+  if (call->output_bindings) {
+    for (iree_host_size_t i = 0; i < call->output_binding_capacity; ++i) {
+      iree_hal_buffer_view_release(call->output_bindings[i]);
+    }
+    iree_allocator_free(iree_runtime_session_host_allocator(call->session),
+                        call->output_bindings);
+  }
   iree_runtime_session_release(call->session);
 }
 
@@ -91,10 +151,102 @@ IREE_API_EXPORT iree_vm_list_t* iree_runtime_call_outputs(
   return call->outputs;
 }
 
+// Writes each output result with a bound destination into that destination
+// and replaces the result in the outputs list with it.
+static iree_status_t iree_runtime_call_store_bound_outputs(
+    iree_runtime_call_t* call) {
+  iree_hal_device_t* device = iree_runtime_session_device(call->session);
+  iree_host_size_t count =
+      iree_min(iree_vm_list_size(call->outputs), call->output_binding_capacity);
+  for (iree_host_size_t i = 0; i < count; ++i) {
+    iree_hal_buffer_view_t* target = call->output_bindings[i];
+    if (!target) continue;
+    iree_hal_buffer_view_t* source =
+        (iree_hal_buffer_view_t*)iree_vm_list_get_ref_deref(
+            call->outputs, i, iree_hal_buffer_view_get_descriptor());
+    if (!source) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "output %zu is bound but the result is not a "
+                              "buffer view",
+                              i);
+    }
+    if (source == target) continue;  // already produced in-place
+
+    // Bindings must match exactly; we don't convert or reshape.
+    if (iree_hal_buffer_view_element_type(source) !=
+            iree_hal_buffer_view_element_type(target) ||
+        iree_hal_buffer_view_shape_rank(source) !=
+            iree_hal_buffer_view_shape_rank(target) ||
+        memcmp(iree_hal_buffer_view_shape_dims(source),
+               iree_hal_buffer_view_shape_dims(target),
+               iree_hal_buffer_view_shape_rank(source) *
+                   sizeof(iree_hal_dim_t)) != 0) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "output %zu result shape or element type does "
+                              "not match the bound buffer view",
+                              i);
+    }
+    // Results written into the bound storage by the program itself (with
+    // destination passing) need no copy.
+    if (iree_hal_buffer_view_buffer(source) !=
+        iree_hal_buffer_view_buffer(target)) {
+      IREE_RETURN_IF_ERROR(iree_hal_device_transfer_d2d(
+          device, iree_hal_buffer_view_buffer(source), 0,
+          iree_hal_buffer_view_buffer(target), 0,
+          iree_hal_buffer_view_byte_length(source),
+          IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout()));
+    }
+
+    iree_vm_ref_t value = iree_hal_buffer_view_retain_ref(target);
+    IREE_RETURN_IF_ERROR(iree_vm_list_set_ref_move(call->outputs, i, &value));
+  }
+  return iree_ok_status();
+}
+
+// Passes the bound outputs as the trailing output storage arguments of a
+// function using destination passing.
+static iree_status_t iree_runtime_call_bind_output_storage(
+    iree_runtime_call_t* call) {
+  // All storage must be provided as the program has nowhere else to put the
+  // results.
+  for (iree_host_size_t i = 0; i < call->output_storage_count; ++i) {
+    if (!call->output_bindings || !call->output_bindings[i]) {
+      return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                              "function requires caller-provided output "
+                              "storage but output %zu is not bound",
+                              i);
+    }
+  }
+  // The lists have capacity for all arguments so this does not allocate.
+  IREE_RETURN_IF_ERROR(iree_vm_list_resize(
+      call->inputs, call->output_storage_ordinal + call->output_storage_count));
+  for (iree_host_size_t i = 0; i < call->output_storage_count; ++i) {
+    iree_vm_ref_t value = {0};
+    IREE_RETURN_IF_ERROR(iree_vm_ref_wrap_assign(
+        call->output_bindings[i], iree_hal_buffer_view_type_id(), &value));
+    IREE_RETURN_IF_ERROR(iree_vm_list_set_ref_retain(
+        call->inputs, call->output_storage_ordinal + i, &value));
+  }
+  return iree_ok_status();
+}
+
 IREE_API_EXPORT iree_status_t iree_runtime_call_invoke(
     iree_runtime_call_t* call, iree_runtime_call_flags_t flags) {
-  return iree_runtime_session_call(call->session, &call->function, call->inputs,
-                                   call->outputs);
+  IREE_ASSERT_ARGUMENT(call);
+  iree_vm_invocation_flags_t invocation_flags = IREE_VM_INVOCATION_FLAG_NONE;
+  if (flags & IREE_RUNTIME_CALL_FLAG_CONSUME_INPUTS) {
+    invocation_flags |= IREE_VM_INVOCATION_FLAG_CONSUME_INPUTS;
+  }
+  if (call->output_storage_count > 0) {
+    IREE_RETURN_IF_ERROR(iree_runtime_call_bind_output_storage(call));
+  }
+  IREE_RETURN_IF_ERROR(
+      iree_vm_invoke(iree_runtime_session_context(call->session),
+                     call->function, invocation_flags,
+                     /*policy=*/NULL, call->inputs, call->outputs,
+                     iree_runtime_session_host_allocator(call->session)));
+  if (!call->output_bindings) return iree_ok_status();
+  return iree_runtime_call_store_bound_outputs(call);
 }
 
 //===----------------------------------------------------------------------===//
@@ -122,3 +274,61 @@ IREE_API_EXPORT iree_status_t iree_runtime_call_outputs_pop_front_buffer_view(
   IREE_RETURN_IF_ERROR(iree_vm_list_pop_front_ref_move(call->outputs, &value));
   return iree_hal_buffer_view_check_deref(value, out_buffer_view);
 }
+
+//===----------------------------------------------------------------------===//
+// Pre-bound call I/O
+//===----------------------------------------------------------------------===//
+
+IREE_API_EXPORT iree_status_t iree_runtime_call_inputs_bind_buffer_view(
+    iree_runtime_call_t* call, iree_host_size_t ordinal,
+    iree_hal_buffer_view_t* buffer_view) {
+  IREE_ASSERT_ARGUMENT(call);
+  IREE_ASSERT_ARGUMENT(buffer_view);
+  if (ordinal >= iree_vm_list_size(call->inputs)) {
+    // Lists are created with capacity for all arguments so this only grows the
+    // storage when binding beyond the function signature.
+    IREE_RETURN_IF_ERROR(iree_vm_list_resize(call->inputs, ordinal + 1));
+  }
+  iree_vm_ref_t value = {0};
+  IREE_RETURN_IF_ERROR(iree_vm_ref_wrap_assign(
+      buffer_view, iree_hal_buffer_view_type_id(), &value));
+  return iree_vm_list_set_ref_retain(call->inputs, ordinal, &value);
+}
+
+IREE_API_EXPORT iree_status_t iree_runtime_call_outputs_bind_buffer_view(
+    iree_runtime_call_t* call, iree_host_size_t ordinal,
+    iree_hal_buffer_view_t* buffer_view) {
+  IREE_ASSERT_ARGUMENT(call);
+
+  // Lazily allocate the binding table on first use so that calls not using
+  // bindings pay nothing.
+  if (!call->output_bindings) {
+    if (!buffer_view) return iree_ok_status();
+    iree_vm_function_signature_t signature =
+        iree_vm_function_signature(&call->function);
+    iree_string_view_t arguments;
+    iree_string_view_t results;
+    IREE_RETURN_IF_ERROR(iree_vm_function_call_get_cconv_fragments(
+        &signature, &arguments, &results));
+    if (results.size == 0) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "function has no outputs to bind");
+    }
+    IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+        iree_runtime_session_host_allocator(call->session),
+        results.size * sizeof(call->output_bindings[0]),
+        (void**)&call->output_bindings));
+    call->output_binding_capacity = results.size;
+  }
+
+  if (ordinal >= call->output_binding_capacity) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "output ordinal %zu out of range (function has "
+                            "at most %zu outputs)",
+                            ordinal, call->output_binding_capacity);
+  }
+  iree_hal_buffer_view_retain(buffer_view);
+  iree_hal_buffer_view_release(call->output_bindings[ordinal]);
+  call->output_bindings[ordinal] = buffer_view;
+  return iree_ok_status();
+}
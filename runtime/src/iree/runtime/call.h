@@ -29,6 +29,9 @@ typedef struct iree_runtime_session_t iree_runtime_session_t;
 // without having to pollute this interface.
 enum iree_runtime_call_flag_bits_t {
   IREE_RUNTIME_CALL_FLAG_RESERVED = 0u,
+  // Moves ref inputs into the invocation instead of retaining them. The inputs
+  // list must be repopulated before the call is invoked again.
+  IREE_RUNTIME_CALL_FLAG_CONSUME_INPUTS = 1u << 0,
 };
 typedef uint32_t iree_runtime_call_flags_t;
 
@@ -41,6 +44,23 @@ typedef uint32_t iree_runtime_call_flags_t;
 // call like this callers are required to either reset the call, copy their
 // data out, or reset the particular output they are consuming.
 //
+// Calls can also be pre-bound for allocation-free steady-state use: input
+// buffer views are bound in place with
+// iree_runtime_call_inputs_bind_buffer_view (and their contents updated with
+// iree_hal_buffer_map_write) and outputs can be directed into caller-provided
+// buffer views with iree_runtime_call_outputs_bind_buffer_view. Once bound,
+// repeated invocations perform no heap allocations in the runtime; any
+// allocations made by the program itself (such as for results not already in
+// caller storage) remain.
+//
+// Functions compiled with the `iree.abi.output_storage` attribute use
+// destination passing and write their results directly into caller-provided
+// storage passed as trailing arguments. All outputs of such functions must be
+// bound with iree_runtime_call_outputs_bind_buffer_view and the bound buffer
+// views are passed as the storage arguments automatically; only the function
+// inputs need to be provided. This avoids both the result allocation and the
+// copy into the bound outputs.
+//
 // Thread-compatible; these are designed to be stack-local or embedded in a user
 // data structure that can provide synchronization when required.
 typedef struct iree_runtime_call_t {
@@ -48,6 +68,18 @@ typedef struct iree_runtime_call_t {
   iree_vm_function_t function;
   iree_vm_list_t* inputs;
   iree_vm_list_t* outputs;
+  // True if the lists were initialized with iree_vm_list_initialize_transient
+  // and must be deinitialized instead of released.
+  bool transient;
+  // Capacity of |output_bindings| in outputs.
+  iree_host_size_t output_binding_capacity;
+  // Caller-provided destinations for outputs indexed by output ordinal or NULL
+  // if no outputs have been bound. Retained.
+  iree_hal_buffer_view_t** output_bindings;
+  // Argument ordinal of the first output storage argument and the total number
+  // of storage arguments for functions using destination passing, or 0.
+  iree_host_size_t output_storage_ordinal;
+  iree_host_size_t output_storage_count;
 } iree_runtime_call_t;
 
 // Initializes call state for a call to |function| within |session|.
@@ -55,6 +87,16 @@ IREE_API_EXPORT iree_status_t iree_runtime_call_initialize(
     iree_runtime_session_t* session, iree_vm_function_t function,
     iree_runtime_call_t* out_call);
 
+// Initializes call state for a call to |function| within |session| with the
+// input and output lists allocated from |list_allocator|. This is designed for
+// calls made per-request where |list_allocator| is an arena
+// (iree_arena_allocator) reset between requests such that calls made in steady
+// state perform no system allocations. The list storage is never returned to
+// |list_allocator| and must remain valid until the call is deinitialized.
+IREE_API_EXPORT iree_status_t iree_runtime_call_initialize_transient(
+    iree_runtime_session_t* session, iree_vm_function_t function,
+    iree_allocator_t list_allocator, iree_runtime_call_t* out_call);
+
 // Initializes call state for a call to |full_name| within |session|.
 //
 // The function name matches the original MLIR module and function symbols.
@@ -72,7 +114,7 @@ IREE_API_EXPORT iree_status_t iree_runtime_call_initialize_by_name(
 IREE_API_EXPORT void iree_runtime_call_deinitialize(iree_runtime_call_t* call);
 
 // Resets the input and output lists back to 0-length in preparation for
-// construction of another call.
+// construction of another call. Output bindings are preserved.
 IREE_API_EXPORT void iree_runtime_call_reset(iree_runtime_call_t* call);
 
 // Returns an initially-empty variant list for passing in function inputs.
@@ -87,8 +129,11 @@ IREE_API_EXPORT iree_vm_list_t* iree_runtime_call_outputs(
     const iree_runtime_call_t* call);
 
 // Synchronously invokes the call and returns the status.
-// The inputs list will remain unchanged to allow for subsequent reuse and the
-// output list will be populated with the results of the call.
+// The inputs list will remain unchanged to allow for subsequent reuse (unless
+// IREE_RUNTIME_CALL_FLAG_CONSUME_INPUTS is specified) and the output list will
+// be populated with the results of the call. Results for outputs bound with
+// iree_runtime_call_outputs_bind_buffer_view are written into the bound buffer
+// views which then take their place in the output list.
 IREE_API_EXPORT iree_status_t iree_runtime_call_invoke(
     iree_runtime_call_t* call, iree_runtime_call_flags_t flags);
 
@@ -108,9 +153,37 @@ IREE_API_EXPORT iree_status_t iree_runtime_call_inputs_push_back_buffer_view(
 
 // Pops a buffer view from the front of the call outputs list.
 // Ownership of the buffer view transfers to the caller.
+//
+// Buffer views created by the program are acquired from a pool owned by the
+// session context and return to it when released: callers that release each
+// output before the next invocation do not allocate views in steady state.
 IREE_API_EXPORT iree_status_t iree_runtime_call_outputs_pop_front_buffer_view(
     iree_runtime_call_t* call, iree_hal_buffer_view_t** out_buffer_view);
 
+//===----------------------------------------------------------------------===//
+// Pre-bound call I/O
+//===----------------------------------------------------------------------===//
+// Binding allows a call to be set up once and invoked repeatedly without
+// rebuilding its lists. Rebinding replaces values in place and performs no
+// allocations once the lists have reached their full size.
+
+// Binds |buffer_view| as input |ordinal| of the call, replacing any value
+// previously at that ordinal. The inputs list is extended with null values if
+// required. The value will be retained by the list.
+IREE_API_EXPORT iree_status_t iree_runtime_call_inputs_bind_buffer_view(
+    iree_runtime_call_t* call, iree_host_size_t ordinal,
+    iree_hal_buffer_view_t* buffer_view);
+
+// Binds |buffer_view| as the destination of output |ordinal| of the call,
+// replacing any prior binding. After each successful invocation the result at
+// |ordinal| is written into |buffer_view| (unless the result already is
+// |buffer_view|) and |buffer_view| takes its place in the outputs list. The
+// result must have the same shape and element type as |buffer_view|.
+// Passing NULL removes the binding. The buffer view is retained by the call.
+IREE_API_EXPORT iree_status_t iree_runtime_call_outputs_bind_buffer_view(
+    iree_runtime_call_t* call, iree_host_size_t ordinal,
+    iree_hal_buffer_view_t* buffer_view);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
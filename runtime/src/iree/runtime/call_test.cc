@@ -0,0 +1,308 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/runtime/call.h"
+
+#include <cstdint>
+#include <cstring>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/modules/hal/module.h"
+#include "iree/runtime/instance.h"
+#include "iree/runtime/session.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+#include "iree/vm/api.h"
+#include "iree/vm/native_module.h"
+
+namespace {
+
+//===----------------------------------------------------------------------===//
+// Allocation counting
+//===----------------------------------------------------------------------===//
+
+// Forwards to the system allocator and counts all allocations made.
+struct CountingAllocator {
+  iree_host_size_t allocation_count = 0;
+
+  static iree_status_t Ctl(void* self, iree_allocator_command_t command,
+                           const void* params, void** inout_ptr) {
+    auto* allocator = reinterpret_cast<CountingAllocator*>(self);
+    if (command != IREE_ALLOCATOR_COMMAND_FREE) ++allocator->allocation_count;
+    return iree_allocator_system_ctl(/*self=*/NULL, command, params, inout_ptr);
+  }
+
+  iree_allocator_t get() {
+    iree_allocator_t allocator = {this, Ctl};
+    return allocator;
+  }
+};
+
+//===----------------------------------------------------------------------===//
+// test module
+//===----------------------------------------------------------------------===//
+
+// Returns its argument unchanged.
+IREE_VM_ABI_EXPORT(test_identity, void, r, r) {
+  iree_hal_buffer_view_t* buffer_view = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_buffer_view_check_deref(args->r0, &buffer_view));
+  rets->r0 = iree_hal_buffer_view_retain_ref(buffer_view);
+  return iree_ok_status();
+}
+
+// Returns its argument written into the caller-provided storage as a function
+// compiled with iree.abi.output_storage would.
+IREE_VM_ABI_EXPORT(test_identity_into, void, rr, r) {
+  iree_hal_buffer_view_t* buffer_view = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_buffer_view_check_deref(args->r0, &buffer_view));
+  iree_hal_buffer_view_t* storage = NULL;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_view_check_deref(args->r1, &storage));
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_map_copy(
+      iree_hal_buffer_view_buffer(buffer_view), 0,
+      iree_hal_buffer_view_buffer(storage), 0,
+      iree_hal_buffer_view_byte_length(buffer_view)));
+  rets->r0 = iree_hal_buffer_view_retain_ref(storage);
+  return iree_ok_status();
+}
+
+static const iree_string_pair_t kTestIdentityIntoAttrs[] = {
+    {iree_make_cstring_view("iree.abi.output_storage"),
+     iree_make_cstring_view("1")},
+};
+static const iree_vm_native_export_descriptor_t kTestModuleExports[] = {
+    {iree_make_cstring_view("identity"), iree_make_cstring_view("0r_r"), 0,
+     NULL},
+    {iree_make_cstring_view("identity_into"), iree_make_cstring_view("0rr_r"),
+     IREE_ARRAYSIZE(kTestIdentityIntoAttrs), kTestIdentityIntoAttrs},
+};
+static const iree_vm_native_function_ptr_t kTestModuleFuncs[] = {
+    {(iree_vm_native_function_shim_t)iree_vm_shim_r_r,
+     (iree_vm_native_function_target_t)test_identity},
+    {(iree_vm_native_function_shim_t)iree_vm_shim_rr_r,
+     (iree_vm_native_function_target_t)test_identity_into},
+};
+static_assert(IREE_ARRAYSIZE(kTestModuleFuncs) ==
+                  IREE_ARRAYSIZE(kTestModuleExports),
+              "function pointer table must be 1:1 with exports");
+static const iree_vm_native_module_descriptor_t kTestModuleDescriptor = {
+    iree_make_cstring_view("test"),
+    0,
+    NULL,
+    0,
+    NULL,
+    IREE_ARRAYSIZE(kTestModuleExports),
+    kTestModuleExports,
+    IREE_ARRAYSIZE(kTestModuleFuncs),
+    kTestModuleFuncs,
+};
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_call_t
+//===----------------------------------------------------------------------===//
+
+static const iree_hal_dim_t kShape[] = {4};
+
+class CallTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    iree_runtime_instance_options_t instance_options;
+    iree_runtime_instance_options_initialize(IREE_API_VERSION_LATEST,
+                                             &instance_options);
+    iree_runtime_instance_options_use_all_available_drivers(&instance_options);
+    IREE_ASSERT_OK(iree_runtime_instance_create(
+        &instance_options, counting_allocator_.get(), &instance_));
+
+    iree_status_t status = iree_runtime_instance_try_create_default_device(
+        instance_, iree_make_cstring_view("local-sync"), &device_);
+    if (iree_status_is_not_found(status)) {
+      iree_status_ignore(status);
+      GTEST_SKIP() << "'local-sync' driver not available";
+    }
+    IREE_ASSERT_OK(status);
+
+    iree_runtime_session_options_t session_options;
+    iree_runtime_session_options_initialize(&session_options);
+    IREE_ASSERT_OK(iree_runtime_session_create_with_device(
+        instance_, &session_options, device_, counting_allocator_.get(),
+        &session_));
+
+    iree_vm_module_t interface;
+    IREE_ASSERT_OK(iree_vm_module_initialize(&interface, NULL));
+    iree_vm_module_t* module = NULL;
+    IREE_ASSERT_OK(iree_vm_native_module_create(
+        &interface, &kTestModuleDescriptor, iree_allocator_system(), &module));
+    status = iree_runtime_session_append_module(session_, module);
+    iree_vm_module_release(module);
+    IREE_ASSERT_OK(status);
+  }
+
+  void TearDown() override {
+    iree_runtime_session_release(session_);
+    iree_hal_device_release(device_);
+    iree_runtime_instance_release(instance_);
+  }
+
+  // Allocates a host-visible buffer view of kShape filled with |value|.
+  void AllocateBufferView(float value, iree_hal_buffer_view_t** out_view) {
+    float data[4] = {value, value, value, value};
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+    params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+    IREE_ASSERT_OK(iree_hal_buffer_view_allocate_buffer(
+        iree_runtime_session_device_allocator(session_),
+        IREE_ARRAYSIZE(kShape), kShape, IREE_HAL_ELEMENT_TYPE_FLOAT_32,
+        IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, params,
+        iree_make_const_byte_span(data, sizeof(data)), out_view));
+  }
+
+  CountingAllocator counting_allocator_;
+  iree_runtime_instance_t* instance_ = NULL;
+  iree_hal_device_t* device_ = NULL;
+  iree_runtime_session_t* session_ = NULL;
+};
+
+TEST_F(CallTest, BoundOutputReceivesResult) {
+  iree_runtime_call_t call;
+  IREE_ASSERT_OK(iree_runtime_call_initialize_by_name(
+      session_, iree_make_cstring_view("test.identity"), &call));
+
+  iree_hal_buffer_view_t* input = NULL;
+  iree_hal_buffer_view_t* output = NULL;
+  AllocateBufferView(3.0f, &input);
+  AllocateBufferView(0.0f, &output);
+  IREE_ASSERT_OK(iree_runtime_call_inputs_bind_buffer_view(&call, 0, input));
+  IREE_ASSERT_OK(iree_runtime_call_outputs_bind_buffer_view(&call, 0, output));
+  IREE_ASSERT_OK(iree_runtime_call_invoke(&call, /*flags=*/0));
+
+  // The bound view takes the place of the result.
+  EXPECT_EQ(output, iree_vm_list_get_ref_deref(
+                        iree_runtime_call_outputs(&call), 0,
+                        iree_hal_buffer_view_get_descriptor()));
+  float result[4] = {0};
+  IREE_ASSERT_OK(iree_hal_buffer_map_read(iree_hal_buffer_view_buffer(output),
+                                          0, result, sizeof(result)));
+  for (float value : result) EXPECT_EQ(3.0f, value);
+
+  iree_hal_buffer_view_release(input);
+  iree_hal_buffer_view_release(output);
+  iree_runtime_call_deinitialize(&call);
+}
+
+TEST_F(CallTest, BoundOutputShapeMismatch) {
+  iree_runtime_call_t call;
+  IREE_ASSERT_OK(iree_runtime_call_initialize_by_name(
+      session_, iree_make_cstring_view("test.identity"), &call));
+
+  iree_hal_buffer_view_t* input = NULL;
+  iree_hal_buffer_view_t* output = NULL;
+  AllocateBufferView(1.0f, &input);
+  iree_hal_buffer_params_t params = {0};
+  params.type = IREE_HAL_MEMORY_TYPE_HOST_LOCAL;
+  params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+  const iree_hal_dim_t shape[] = {2, 2};
+  IREE_ASSERT_OK(iree_hal_buffer_view_allocate_buffer(
+      iree_runtime_session_device_allocator(session_), IREE_ARRAYSIZE(shape),
+      shape, IREE_HAL_ELEMENT_TYPE_FLOAT_32,
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, params,
+      iree_const_byte_span_empty(), &output));
+  IREE_ASSERT_OK(iree_runtime_call_inputs_bind_buffer_view(&call, 0, input));
+  IREE_ASSERT_OK(iree_runtime_call_outputs_bind_buffer_view(&call, 0, output));
+  IREE_EXPECT_STATUS_IS(IREE_STATUS_INVALID_ARGUMENT,
+                        iree_runtime_call_invoke(&call, /*flags=*/0));
+
+  iree_hal_buffer_view_release(input);
+  iree_hal_buffer_view_release(output);
+  iree_runtime_call_deinitialize(&call);
+}
+
+TEST_F(CallTest, SteadyStateIsAllocationFree) {
+  iree_runtime_call_t call;
+  IREE_ASSERT_OK(iree_runtime_call_initialize_by_name(
+      session_, iree_make_cstring_view("test.identity"), &call));
+
+  iree_hal_buffer_view_t* input = NULL;
+  iree_hal_buffer_view_t* output = NULL;
+  AllocateBufferView(0.0f, &input);
+  AllocateBufferView(0.0f, &output);
+  IREE_ASSERT_OK(iree_runtime_call_inputs_bind_buffer_view(&call, 0, input));
+  IREE_ASSERT_OK(iree_runtime_call_outputs_bind_buffer_view(&call, 0, output));
+
+  // Warm up to let any lazily-initialized state settle.
+  IREE_ASSERT_OK(iree_runtime_call_invoke(&call, /*flags=*/0));
+
+  const iree_host_size_t baseline_count = counting_allocator_.allocation_count;
+  for (int i = 0; i < 16; ++i) {
+    float data[4] = {(float)i, (float)i, (float)i, (float)i};
+    IREE_ASSERT_OK(iree_hal_buffer_map_write(iree_hal_buffer_view_buffer(input),
+                                             0, data, sizeof(data)));
+    IREE_ASSERT_OK(iree_runtime_call_inputs_bind_buffer_view(&call, 0, input));
+    IREE_ASSERT_OK(iree_runtime_call_invoke(&call, /*flags=*/0));
+    float result[4] = {0};
+    IREE_ASSERT_OK(iree_hal_buffer_map_read(
+        iree_hal_buffer_view_buffer(output), 0, result, sizeof(result)));
+    ASSERT_EQ((float)i, result[0]);
+  }
+  EXPECT_EQ(baseline_count, counting_allocator_.allocation_count);
+
+  iree_hal_buffer_view_release(input);
+  iree_hal_buffer_view_release(output);
+  iree_runtime_call_deinitialize(&call);
+}
+
+TEST_F(CallTest, OutputStorageRequiresBinding) {
+  iree_runtime_call_t call;
+  IREE_ASSERT_OK(iree_runtime_call_initialize_by_name(
+      session_, iree_make_cstring_view("test.identity_into"), &call));
+
+  iree_hal_buffer_view_t* input = NULL;
+  AllocateBufferView(1.0f, &input);
+  IREE_ASSERT_OK(iree_runtime_call_inputs_bind_buffer_view(&call, 0, input));
+  IREE_EXPECT_STATUS_IS(IREE_STATUS_FAILED_PRECONDITION,
+                        iree_runtime_call_invoke(&call, /*flags=*/0));
+
+  iree_hal_buffer_view_release(input);
+  iree_runtime_call_deinitialize(&call);
+}
+
+TEST_F(CallTest, OutputStorageIsAllocationFree) {
+  iree_runtime_call_t call;
+  IREE_ASSERT_OK(iree_runtime_call_initialize_by_name(
+      session_, iree_make_cstring_view("test.identity_into"), &call));
+
+  iree_hal_buffer_view_t* input = NULL;
+  iree_hal_buffer_view_t* output = NULL;
+  AllocateBufferView(0.0f, &input);
+  AllocateBufferView(0.0f, &output);
+  IREE_ASSERT_OK(iree_runtime_call_inputs_bind_buffer_view(&call, 0, input));
+  IREE_ASSERT_OK(iree_runtime_call_outputs_bind_buffer_view(&call, 0, output));
+  IREE_ASSERT_OK(iree_runtime_call_invoke(&call, /*flags=*/0));
+
+  const iree_host_size_t baseline_count = counting_allocator_.allocation_count;
+  for (int i = 0; i < 16; ++i) {
+    float data[4] = {(float)i, (float)i, (float)i, (float)i};
+    IREE_ASSERT_OK(iree_hal_buffer_map_write(iree_hal_buffer_view_buffer(input),
+                                             0, data, sizeof(data)));
+    IREE_ASSERT_OK(iree_runtime_call_invoke(&call, /*flags=*/0));
+    EXPECT_EQ(output, iree_vm_list_get_ref_deref(
+                          iree_runtime_call_outputs(&call), 0,
+                          iree_hal_buffer_view_get_descriptor()));
+    float result[4] = {0};
+    IREE_ASSERT_OK(iree_hal_buffer_map_read(
+        iree_hal_buffer_view_buffer(output), 0, result, sizeof(result)));
+    ASSERT_EQ((float)i, result[3]);
+  }
+  EXPECT_EQ(baseline_count, counting_allocator_.allocation_count);
+
+  iree_hal_buffer_view_release(input);
+  iree_hal_buffer_view_release(output);
+  iree_runtime_call_deinitialize(&call);
+}
+
+}  // namespace
@@ -11,6 +11,7 @@
 
 #include "iree/base/internal/atomics.h"
 #include "iree/base/internal/file_io.h"
+#include "iree/base/internal/path.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/api.h"
 #include "iree/modules/hal/module.h"
@@ -225,21 +226,53 @@ iree_runtime_session_append_bytecode_module_from_file(
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_TRACE_ZONE_APPEND_TEXT(z0, file_path);
 
-  // TODO(#3909): actually map the memory here. For now we just load the
-  // contents.
+  // The file is mapped such that rodata (such as large constants) is paged in
+  // only when used and can be imported into HAL buffers without copies.
   iree_file_contents_t* flatbuffer_contents = NULL;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_file_read_contents(file_path,
-                                  iree_runtime_session_host_allocator(session),
-                                  &flatbuffer_contents));
+      z0, iree_file_map_contents(file_path,
+                                 iree_runtime_session_host_allocator(session),
+                                 &flatbuffer_contents));
+
+  // Large constants may be stored in a parameter archive next to the module.
+  // It's mapped as well so that processes loading the same model share pages.
+  iree_string_view_t parameter_name = iree_string_view_empty();
+  iree_status_t status = iree_vm_bytecode_module_query_parameter_archive(
+      flatbuffer_contents->const_buffer, &parameter_name);
+  iree_file_contents_t* parameter_contents = NULL;
+  if (iree_status_is_ok(status) && !iree_string_view_is_empty(parameter_name)) {
+    char* parameter_path = NULL;
+    status = iree_file_path_join(
+        iree_file_path_dirname(iree_make_cstring_view(file_path)),
+        parameter_name, iree_runtime_session_host_allocator(session),
+        &parameter_path);
+    if (iree_status_is_ok(status)) {
+      status = iree_file_map_contents(
+          parameter_path, iree_runtime_session_host_allocator(session),
+          &parameter_contents);
+    }
+    iree_allocator_free(iree_runtime_session_host_allocator(session),
+                        parameter_path);
+  }
 
-  iree_status_t status =
-      iree_runtime_session_append_bytecode_module_from_memory(
-          session, flatbuffer_contents->const_buffer,
-          iree_file_contents_deallocator(flatbuffer_contents));
-  if (!iree_status_is_ok(status)) {
+  iree_vm_module_t* module = NULL;
+  if (iree_status_is_ok(status)) {
+    status = iree_vm_bytecode_module_create_with_parameters(
+        flatbuffer_contents->const_buffer,
+        iree_file_contents_deallocator(flatbuffer_contents),
+        parameter_contents ? parameter_contents->const_buffer
+                           : iree_const_byte_span_empty(),
+        parameter_contents ? iree_file_contents_deallocator(parameter_contents)
+                           : iree_allocator_null(),
+        iree_runtime_session_host_allocator(session), &module);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_runtime_session_append_module(session, module);
+  } else {
+    iree_file_contents_free(parameter_contents);
     iree_file_contents_free(flatbuffer_contents);
   }
+  iree_vm_module_release(module);
 
   IREE_TRACE_ZONE_END(z0);
   return status;
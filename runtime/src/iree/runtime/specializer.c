@@ -0,0 +1,437 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/runtime/specializer.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/internal/threading.h"
+#include "iree/base/tracing.h"
+#include "iree/modules/hal/module.h"
+#include "iree/vm/bytecode_module.h"
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_specializer_options_t
+//===----------------------------------------------------------------------===//
+
+IREE_API_EXPORT void iree_runtime_specializer_options_initialize(
+    iree_runtime_specializer_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+  out_options->compile_threshold = 8;
+  out_options->max_signatures = 64;
+}
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_specializer_t
+//===----------------------------------------------------------------------===//
+
+// Maximum length of a signature string; calls with longer signatures (very
+// high rank or many inputs) are not specialized.
+#define IREE_RUNTIME_SPECIALIZER_MAX_SIGNATURE_LENGTH 512
+
+typedef enum iree_runtime_specialization_state_e {
+  // Counting calls until the compile threshold is reached.
+  IREE_RUNTIME_SPECIALIZATION_STATE_COUNTING = 0,
+  // Compiling on the specializer thread.
+  IREE_RUNTIME_SPECIALIZATION_STATE_COMPILING,
+  // Loaded and receiving calls.
+  IREE_RUNTIME_SPECIALIZATION_STATE_READY,
+  // Failed to compile or load; calls go to the original function.
+  IREE_RUNTIME_SPECIALIZATION_STATE_FAILED,
+} iree_runtime_specialization_state_t;
+
+// A signature seen by the specializer and its specialization, if any.
+// Entries are never removed and their signatures are immutable such that the
+// compile thread can use them without holding the mutex.
+typedef struct iree_runtime_specialization_t {
+  // Signature string allocated from the host allocator.
+  iree_string_view_t signature;
+  iree_host_size_t call_count;
+  iree_runtime_specialization_state_t state;
+  // Context containing the HAL module and specialized module when ready.
+  iree_vm_context_t* context;
+  iree_vm_function_t function;
+} iree_runtime_specialization_t;
+
+struct iree_runtime_specializer_t {
+  iree_atomic_ref_count_t ref_count;
+  iree_allocator_t host_allocator;
+
+  iree_runtime_session_t* session;
+  iree_vm_function_t function;
+  iree_runtime_specializer_options_t options;
+  iree_runtime_specializer_compiler_t compiler;
+
+  // Guards the specialization table and statistics.
+  iree_slim_mutex_t mutex;
+  iree_host_size_t specialization_count;
+  iree_runtime_specialization_t* specializations;
+  iree_runtime_specializer_statistics_t statistics;
+
+  // Thread compiling |compiling_specialization|, if any. Threads are joined
+  // before the next one is started and when the specializer is destroyed.
+  iree_thread_t* compile_thread;
+  iree_runtime_specialization_t* compiling_specialization;
+  // Set to 1 while a specialization is compiling.
+  iree_atomic_int32_t is_compiling;
+  // Posted whenever a compilation completes.
+  iree_notification_t notification;
+};
+
+IREE_API_EXPORT iree_status_t iree_runtime_specializer_create(
+    iree_runtime_session_t* session, const iree_vm_function_t* function,
+    const iree_runtime_specializer_options_t* options,
+    iree_runtime_specializer_compiler_t compiler,
+    iree_allocator_t host_allocator,
+    iree_runtime_specializer_t** out_specializer) {
+  IREE_ASSERT_ARGUMENT(session);
+  IREE_ASSERT_ARGUMENT(function);
+  IREE_ASSERT_ARGUMENT(options);
+  IREE_ASSERT_ARGUMENT(out_specializer);
+  *out_specializer = NULL;
+  if (!compiler.compile) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "a specialization compiler is required");
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_runtime_specializer_t* specializer = NULL;
+  const iree_host_size_t total_size =
+      sizeof(*specializer) +
+      options->max_signatures * sizeof(specializer->specializations[0]);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, total_size,
+                                (void**)&specializer));
+  memset(specializer, 0, total_size);
+  iree_atomic_ref_count_init(&specializer->ref_count);
+  specializer->host_allocator = host_allocator;
+  specializer->session = session;
+  iree_runtime_session_retain(session);
+  specializer->function = *function;
+  specializer->options = *options;
+  specializer->compiler = compiler;
+  iree_slim_mutex_initialize(&specializer->mutex);
+  specializer->specializations =
+      (iree_runtime_specialization_t*)((uint8_t*)specializer +
+                                       sizeof(*specializer));
+  iree_notification_initialize(&specializer->notification);
+
+  *out_specializer = specializer;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_runtime_specializer_destroy(
+    iree_runtime_specializer_t* specializer) {
+  IREE_ASSERT_ARGUMENT(specializer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Joins any in-flight compilation.
+  iree_thread_release(specializer->compile_thread);
+
+  for (iree_host_size_t i = 0; i < specializer->specialization_count; ++i) {
+    iree_runtime_specialization_t* specialization =
+        &specializer->specializations[i];
+    iree_vm_context_release(specialization->context);
+    iree_allocator_free(specializer->host_allocator,
+                        (void*)specialization->signature.data);
+  }
+  iree_notification_deinitialize(&specializer->notification);
+  iree_slim_mutex_deinitialize(&specializer->mutex);
+  iree_runtime_session_release(specializer->session);
+  iree_allocator_free(specializer->host_allocator, specializer);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+IREE_API_EXPORT void iree_runtime_specializer_retain(
+    iree_runtime_specializer_t* specializer) {
+  if (specializer) {
+    iree_atomic_ref_count_inc(&specializer->ref_count);
+  }
+}
+
+IREE_API_EXPORT void iree_runtime_specializer_release(
+    iree_runtime_specializer_t* specializer) {
+  if (specializer && iree_atomic_ref_count_dec(&specializer->ref_count) == 1) {
+    iree_runtime_specializer_destroy(specializer);
+  }
+}
+
+// Appends the signature of |input_list| to |builder|.
+static iree_status_t iree_runtime_specializer_format_signature(
+    iree_vm_list_t* input_list, iree_string_builder_t* builder) {
+  const iree_host_size_t input_count =
+      input_list ? iree_vm_list_size(input_list) : 0;
+  for (iree_host_size_t i = 0; i < input_count; ++i) {
+    if (i > 0) {
+      IREE_RETURN_IF_ERROR(iree_string_builder_append_cstring(builder, ","));
+    }
+    iree_vm_variant_t variant = iree_vm_variant_empty();
+    IREE_RETURN_IF_ERROR(iree_vm_list_get_variant(input_list, i, &variant));
+    iree_hal_buffer_view_t* buffer_view =
+        iree_vm_variant_is_ref(variant)
+            ? iree_hal_buffer_view_deref(variant.ref)
+            : NULL;
+    if (!buffer_view) {
+      IREE_RETURN_IF_ERROR(iree_string_builder_append_cstring(builder, "?"));
+      continue;
+    }
+    const iree_host_size_t rank = iree_hal_buffer_view_shape_rank(buffer_view);
+    for (iree_host_size_t j = 0; j < rank; ++j) {
+      IREE_RETURN_IF_ERROR(iree_string_builder_append_format(
+          builder, "%" PRIdim "x",
+          iree_hal_buffer_view_shape_dim(buffer_view, j)));
+    }
+    char element_type[32];
+    iree_host_size_t element_type_length = 0;
+    IREE_RETURN_IF_ERROR(iree_hal_format_element_type(
+        iree_hal_buffer_view_element_type(buffer_view), sizeof(element_type),
+        element_type, &element_type_length));
+    IREE_RETURN_IF_ERROR(iree_string_builder_append_string(
+        builder, iree_make_string_view(element_type, element_type_length)));
+  }
+  return iree_ok_status();
+}
+
+// Returns the specialization for |signature|, adding it if there is room.
+// Returns NULL if the signature is not tracked.
+static iree_runtime_specialization_t*
+iree_runtime_specializer_find_or_add_locked(
+    iree_runtime_specializer_t* specializer, iree_string_view_t signature) {
+  for (iree_host_size_t i = 0; i < specializer->specialization_count; ++i) {
+    iree_runtime_specialization_t* specialization =
+        &specializer->specializations[i];
+    if (iree_string_view_equal(specialization->signature, signature)) {
+      return specialization;
+    }
+  }
+  if (specializer->specialization_count >=
+      specializer->options.max_signatures) {
+    return NULL;
+  }
+  char* signature_data = NULL;
+  if (!iree_status_is_ok(iree_allocator_malloc(specializer->host_allocator,
+                                               signature.size + 1,
+                                               (void**)&signature_data))) {
+    return NULL;
+  }
+  memcpy(signature_data, signature.data, signature.size);
+  signature_data[signature.size] = 0;
+  iree_runtime_specialization_t* specialization =
+      &specializer->specializations[specializer->specialization_count++];
+  specialization->signature =
+      iree_make_string_view(signature_data, signature.size);
+  return specialization;
+}
+
+// Compiles |specialization| and loads it into a new context on the session
+// device.
+static iree_status_t iree_runtime_specializer_load(
+    iree_runtime_specializer_t* specializer,
+    iree_runtime_specialization_t* specialization,
+    iree_vm_context_t** out_context, iree_vm_function_t* out_function) {
+  iree_string_view_t function_name =
+      iree_vm_function_name(&specializer->function);
+  iree_const_byte_span_t module_data = iree_const_byte_span_empty();
+  iree_allocator_t module_allocator = iree_allocator_null();
+  IREE_RETURN_IF_ERROR(specializer->compiler.compile(
+      specializer->compiler.user_data, function_name,
+      specialization->signature, &module_data, &module_allocator));
+
+  iree_allocator_t host_allocator = specializer->host_allocator;
+  iree_vm_module_t* modules[2] = {NULL, NULL};
+  iree_status_t status = iree_vm_bytecode_module_create(
+      module_data, module_allocator, host_allocator, &modules[1]);
+  if (!iree_status_is_ok(status)) {
+    iree_allocator_free(module_allocator, (void*)module_data.data);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_hal_module_create(
+        iree_runtime_session_device(specializer->session), host_allocator,
+        &modules[0]);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_vm_module_lookup_function_by_name(
+        modules[1], IREE_VM_FUNCTION_LINKAGE_EXPORT, function_name,
+        out_function);
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_vm_context_create_with_modules(
+        /*instance=*/NULL, IREE_VM_CONTEXT_FLAG_NONE, IREE_ARRAYSIZE(modules),
+        modules, host_allocator, out_context);
+  }
+  iree_vm_module_release(modules[0]);
+  iree_vm_module_release(modules[1]);
+  return status;
+}
+
+static int iree_runtime_specializer_compile_main(void* entry_arg) {
+  iree_runtime_specializer_t* specializer =
+      (iree_runtime_specializer_t*)entry_arg;
+  iree_runtime_specialization_t* specialization =
+      specializer->compiling_specialization;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_TEXT(z0, specialization->signature.data,
+                              specialization->signature.size);
+
+  iree_vm_context_t* context = NULL;
+  iree_vm_function_t function;
+  memset(&function, 0, sizeof(function));
+  iree_status_t status = iree_runtime_specializer_load(
+      specializer, specialization, &context, &function);
+
+  iree_slim_mutex_lock(&specializer->mutex);
+  if (iree_status_is_ok(status)) {
+    specialization->context = context;
+    specialization->function = function;
+    specialization->state = IREE_RUNTIME_SPECIALIZATION_STATE_READY;
+    ++specializer->statistics.specialization_count;
+  } else {
+    specialization->state = IREE_RUNTIME_SPECIALIZATION_STATE_FAILED;
+    ++specializer->statistics.failed_specialization_count;
+  }
+  specializer->compiling_specialization = NULL;
+  iree_slim_mutex_unlock(&specializer->mutex);
+  iree_status_ignore(status);
+
+  iree_atomic_store_int32(&specializer->is_compiling, 0,
+                          iree_memory_order_release);
+  iree_notification_post(&specializer->notification, IREE_ALL_WAITERS);
+  IREE_TRACE_ZONE_END(z0);
+  return 0;
+}
+
+// Starts compiling |specialization| on a new compile thread. |specialization|
+// must already be the compiling specialization and the prior compile thread,
+// if any, must have completed.
+static void iree_runtime_specializer_start_compile(
+    iree_runtime_specializer_t* specializer,
+    iree_runtime_specialization_t* specialization) {
+  iree_thread_release(specializer->compile_thread);
+  specializer->compile_thread = NULL;
+
+  iree_thread_create_params_t params;
+  memset(&params, 0, sizeof(params));
+  params.name = IREE_SV("iree-specializer");
+  params.priority_class = IREE_THREAD_PRIORITY_CLASS_LOW;
+  iree_status_t status = iree_thread_create(
+      iree_runtime_specializer_compile_main, specializer, params,
+      specializer->host_allocator, &specializer->compile_thread);
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    iree_slim_mutex_lock(&specializer->mutex);
+    specialization->state = IREE_RUNTIME_SPECIALIZATION_STATE_FAILED;
+    ++specializer->statistics.failed_specialization_count;
+    specializer->compiling_specialization = NULL;
+    iree_slim_mutex_unlock(&specializer->mutex);
+    iree_atomic_store_int32(&specializer->is_compiling, 0,
+                            iree_memory_order_release);
+  }
+}
+
+IREE_API_EXPORT iree_status_t iree_runtime_specializer_call(
+    iree_runtime_specializer_t* specializer, iree_vm_list_t* input_list,
+    iree_vm_list_t* output_list) {
+  IREE_ASSERT_ARGUMENT(specializer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Signatures that don't fit the inline storage are not specialized.
+  char signature_storage[IREE_RUNTIME_SPECIALIZER_MAX_SIGNATURE_LENGTH];
+  iree_string_builder_t signature_builder;
+  iree_string_builder_initialize_with_storage(
+      signature_storage, sizeof(signature_storage), &signature_builder);
+  iree_status_t status = iree_runtime_specializer_format_signature(
+      input_list, &signature_builder);
+  bool has_signature = iree_status_is_ok(status);
+  iree_status_ignore(status);
+
+  iree_vm_context_t* context = NULL;
+  iree_vm_function_t function = specializer->function;
+  iree_runtime_specialization_t* compile_specialization = NULL;
+  iree_slim_mutex_lock(&specializer->mutex);
+  iree_runtime_specialization_t* specialization =
+      has_signature ? iree_runtime_specializer_find_or_add_locked(
+                          specializer,
+                          iree_string_builder_view(&signature_builder))
+                    : NULL;
+  if (specialization) {
+    ++specialization->call_count;
+    if (specialization->state == IREE_RUNTIME_SPECIALIZATION_STATE_READY) {
+      context = specialization->context;
+      iree_vm_context_retain(context);
+      function = specialization->function;
+    } else if (specialization->state ==
+                   IREE_RUNTIME_SPECIALIZATION_STATE_COUNTING &&
+               specialization->call_count >=
+                   specializer->options.compile_threshold &&
+               !specializer->compiling_specialization) {
+      specialization->state = IREE_RUNTIME_SPECIALIZATION_STATE_COMPILING;
+      compile_specialization = specialization;
+      specializer->compiling_specialization = specialization;
+      iree_atomic_store_int32(&specializer->is_compiling, 1,
+                              iree_memory_order_relaxed);
+    }
+  }
+  if (context) {
+    ++specializer->statistics.specialized_call_count;
+  } else {
+    ++specializer->statistics.generic_call_count;
+  }
+  iree_slim_mutex_unlock(&specializer->mutex);
+  iree_string_builder_deinitialize(&signature_builder);
+
+  if (compile_specialization) {
+    iree_runtime_specializer_start_compile(specializer,
+                                           compile_specialization);
+  }
+
+  if (context) {
+    status = iree_vm_invoke(context, function, IREE_VM_INVOCATION_FLAG_NONE,
+                            /*policy=*/NULL, input_list, output_list,
+                            iree_runtime_session_host_allocator(
+                                specializer->session));
+    iree_vm_context_release(context);
+  } else {
+    status = iree_runtime_session_call(specializer->session, &function,
+                                       input_list, output_list);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+static bool iree_runtime_specializer_is_idle(void* arg) {
+  iree_runtime_specializer_t* specializer = (iree_runtime_specializer_t*)arg;
+  return iree_atomic_load_int32(&specializer->is_compiling,
+                                iree_memory_order_acquire) == 0;
+}
+
+IREE_API_EXPORT iree_status_t iree_runtime_specializer_wait_idle(
+    iree_runtime_specializer_t* specializer, iree_timeout_t timeout) {
+  IREE_ASSERT_ARGUMENT(specializer);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  bool is_idle =
+      iree_notification_await(&specializer->notification,
+                              iree_runtime_specializer_is_idle, specializer,
+                              timeout);
+  IREE_TRACE_ZONE_END(z0);
+  return is_idle ? iree_ok_status()
+                 : iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+}
+
+IREE_API_EXPORT void iree_runtime_specializer_query_statistics(
+    iree_runtime_specializer_t* specializer,
+    iree_runtime_specializer_statistics_t* out_statistics) {
+  IREE_ASSERT_ARGUMENT(specializer);
+  IREE_ASSERT_ARGUMENT(out_statistics);
+  iree_slim_mutex_lock(&specializer->mutex);
+  *out_statistics = specializer->statistics;
+  iree_slim_mutex_unlock(&specializer->mutex);
+}
@@ -0,0 +1,143 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_RUNTIME_SPECIALIZER_H_
+#define IREE_RUNTIME_SPECIALIZER_H_
+
+#include <stdint.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/runtime/session.h"
+#include "iree/vm/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_specializer_compiler_t
+//===----------------------------------------------------------------------===//
+
+// Compiles a static-shape specialization of a dynamically shaped function.
+//
+// |function_name| is the name of the function within its module (such as
+// `main` for `module.main`) and |signature| lists the shape and element type of
+// each input in its order, separated by commas, in the same format as used by
+// iree_hal_buffer_view_parse (such as `4x8xf32,8xi32`). Inputs that are not
+// buffer views are listed as `?` and remain dynamic.
+//
+// On success |out_module_data| must contain a VM bytecode module that exports
+// a function named |function_name| with the same calling convention as the
+// original function and only imports from the HAL module. Ownership of the
+// data is transferred to the specializer which frees it with
+// |out_module_allocator| (which may be iree_allocator_null for static data).
+//
+// Called from a background thread owned by the specializer. Hosts typically
+// implement this with the compiler API by recompiling the original program
+// source with the dynamic dimensions of the function arguments replaced with
+// those in |signature|.
+typedef struct iree_runtime_specializer_compiler_t {
+  iree_status_t(IREE_API_PTR* compile)(void* user_data,
+                                       iree_string_view_t function_name,
+                                       iree_string_view_t signature,
+                                       iree_const_byte_span_t* out_module_data,
+                                       iree_allocator_t* out_module_allocator);
+  void* user_data;
+} iree_runtime_specializer_compiler_t;
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_specializer_options_t
+//===----------------------------------------------------------------------===//
+
+// Options used to configure specializer creation.
+typedef struct iree_runtime_specializer_options_t {
+  // Number of calls with the same signature after which a specialization is
+  // compiled for it.
+  iree_host_size_t compile_threshold;
+
+  // Maximum number of distinct signatures tracked. Calls with signatures seen
+  // after this many are always issued to the original function.
+  iree_host_size_t max_signatures;
+} iree_runtime_specializer_options_t;
+
+// Initializes |out_options| to its default values.
+IREE_API_EXPORT void iree_runtime_specializer_options_initialize(
+    iree_runtime_specializer_options_t* out_options);
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_specializer_t
+//===----------------------------------------------------------------------===//
+
+// Statistics of the calls issued through a specializer.
+typedef struct iree_runtime_specializer_statistics_t {
+  // Calls issued to the original dynamically shaped function.
+  iree_host_size_t generic_call_count;
+  // Calls issued to a compiled specialization.
+  iree_host_size_t specialized_call_count;
+  // Specializations compiled and available for calls.
+  iree_host_size_t specialization_count;
+  // Specializations that failed to compile or load and are not retried.
+  iree_host_size_t failed_specialization_count;
+} iree_runtime_specializer_statistics_t;
+
+// Specializes calls to a dynamically shaped session function for the input
+// shapes they are most frequently called with.
+//
+// Each call records the shapes of its inputs (its signature). Once a signature
+// has been seen |compile_threshold| times a static-shape specialization is
+// compiled in the background with the host-provided compiler and loaded into
+// its own VM context on the session device. Subsequent calls with that
+// signature are issued to the specialization and all other calls to the
+// original function. At most one specialization compiles at a time and calls
+// are never blocked on compilation.
+//
+// Specializations only contain the specialized module and the HAL module and
+// cannot share module state (such as globals) with the session.
+//
+// Thread-compatible like the session it wraps; only a single thread may issue
+// calls at any time.
+typedef struct iree_runtime_specializer_t iree_runtime_specializer_t;
+
+// Creates a specializer issuing calls to |function| in |session|.
+// The session is retained for the lifetime of the specializer.
+IREE_API_EXPORT iree_status_t iree_runtime_specializer_create(
+    iree_runtime_session_t* session, const iree_vm_function_t* function,
+    const iree_runtime_specializer_options_t* options,
+    iree_runtime_specializer_compiler_t compiler,
+    iree_allocator_t host_allocator,
+    iree_runtime_specializer_t** out_specializer);
+
+// Retains the given |specializer| for the caller.
+IREE_API_EXPORT void iree_runtime_specializer_retain(
+    iree_runtime_specializer_t* specializer);
+
+// Releases the given |specializer| from the caller.
+// Waits for any in-flight compilation to complete.
+IREE_API_EXPORT void iree_runtime_specializer_release(
+    iree_runtime_specializer_t* specializer);
+
+// Synchronously issues a call to the specialization matching the shapes of
+// |input_list|, if one is available, or to the original function otherwise.
+// Semantics match iree_runtime_session_call.
+IREE_API_EXPORT iree_status_t iree_runtime_specializer_call(
+    iree_runtime_specializer_t* specializer, iree_vm_list_t* input_list,
+    iree_vm_list_t* output_list);
+
+// Blocks until no specialization is being compiled or |timeout| elapses.
+IREE_API_EXPORT iree_status_t iree_runtime_specializer_wait_idle(
+    iree_runtime_specializer_t* specializer, iree_timeout_t timeout);
+
+// Returns statistics of the calls issued through |specializer|.
+IREE_API_EXPORT void iree_runtime_specializer_query_statistics(
+    iree_runtime_specializer_t* specializer,
+    iree_runtime_specializer_statistics_t* out_statistics);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_RUNTIME_SPECIALIZER_H_
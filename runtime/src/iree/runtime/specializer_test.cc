@@ -0,0 +1,240 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/runtime/specializer.h"
+
+#include <string>
+#include <vector>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/modules/hal/module.h"
+#include "iree/runtime/instance.h"
+#include "iree/runtime/session.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+#include "iree/vm/api.h"
+#include "iree/vm/native_module.h"
+
+namespace {
+
+//===----------------------------------------------------------------------===//
+// test module
+//===----------------------------------------------------------------------===//
+
+// Returns its argument unchanged.
+IREE_VM_ABI_EXPORT(test_identity, void, r, r) {
+  iree_hal_buffer_view_t* buffer_view = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_hal_buffer_view_check_deref(args->r0, &buffer_view));
+  rets->r0 = iree_hal_buffer_view_retain_ref(buffer_view);
+  return iree_ok_status();
+}
+
+static const iree_vm_native_export_descriptor_t kTestModuleExports[] = {
+    {iree_make_cstring_view("identity"), iree_make_cstring_view("0r_r"), 0,
+     NULL},
+};
+static const iree_vm_native_function_ptr_t kTestModuleFuncs[] = {
+    {(iree_vm_native_function_shim_t)iree_vm_shim_r_r,
+     (iree_vm_native_function_target_t)test_identity},
+};
+static_assert(IREE_ARRAYSIZE(kTestModuleFuncs) ==
+                  IREE_ARRAYSIZE(kTestModuleExports),
+              "function pointer table must be 1:1 with exports");
+static const iree_vm_native_module_descriptor_t kTestModuleDescriptor = {
+    iree_make_cstring_view("test"),
+    0,
+    NULL,
+    0,
+    NULL,
+    IREE_ARRAYSIZE(kTestModuleExports),
+    kTestModuleExports,
+    IREE_ARRAYSIZE(kTestModuleFuncs),
+    kTestModuleFuncs,
+};
+
+//===----------------------------------------------------------------------===//
+// iree_runtime_specializer_t
+//===----------------------------------------------------------------------===//
+
+// Records compile requests and fails them; successful specializations require
+// a compiler to produce bytecode modules and are covered by integration tests.
+struct RecordingCompiler {
+  std::vector<std::string> function_names;
+  std::vector<std::string> signatures;
+
+  static iree_status_t Compile(void* user_data,
+                               iree_string_view_t function_name,
+                               iree_string_view_t signature,
+                               iree_const_byte_span_t* out_module_data,
+                               iree_allocator_t* out_module_allocator) {
+    auto* compiler = reinterpret_cast<RecordingCompiler*>(user_data);
+    compiler->function_names.emplace_back(function_name.data,
+                                          function_name.size);
+    compiler->signatures.emplace_back(signature.data, signature.size);
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED, "no compiler");
+  }
+
+  iree_runtime_specializer_compiler_t get() {
+    iree_runtime_specializer_compiler_t compiler = {Compile, this};
+    return compiler;
+  }
+};
+
+class SpecializerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    iree_runtime_instance_options_t instance_options;
+    iree_runtime_instance_options_initialize(IREE_API_VERSION_LATEST,
+                                             &instance_options);
+    iree_runtime_instance_options_use_all_available_drivers(&instance_options);
+    IREE_ASSERT_OK(iree_runtime_instance_create(
+        &instance_options, iree_allocator_system(), &instance_));
+
+    iree_status_t status = iree_runtime_instance_try_create_default_device(
+        instance_, iree_make_cstring_view("local-sync"), &device_);
+    if (iree_status_is_not_found(status)) {
+      iree_status_ignore(status);
+      GTEST_SKIP() << "'local-sync' driver not available";
+    }
+    IREE_ASSERT_OK(status);
+
+    iree_runtime_session_options_t session_options;
+    iree_runtime_session_options_initialize(&session_options);
+    IREE_ASSERT_OK(iree_runtime_session_create_with_device(
+        instance_, &session_options, device_, iree_allocator_system(),
+        &session_));
+
+    iree_vm_module_t interface;
+    IREE_ASSERT_OK(iree_vm_module_initialize(&interface, NULL));
+    iree_vm_module_t* module = NULL;
+    IREE_ASSERT_OK(iree_vm_native_module_create(
+        &interface, &kTestModuleDescriptor, iree_allocator_system(), &module));
+    status = iree_runtime_session_append_module(session_, module);
+    iree_vm_module_release(module);
+    IREE_ASSERT_OK(status);
+    IREE_ASSERT_OK(iree_runtime_session_lookup_function(
+        session_, iree_make_cstring_view("test.identity"), &function_));
+  }
+
+  void TearDown() override {
+    iree_runtime_specializer_release(specializer_);
+    iree_runtime_session_release(session_);
+    iree_hal_device_release(device_);
+    iree_runtime_instance_release(instance_);
+  }
+
+  void CreateSpecializer(iree_host_size_t compile_threshold,
+                         iree_host_size_t max_signatures) {
+    iree_runtime_specializer_options_t options;
+    iree_runtime_specializer_options_initialize(&options);
+    options.compile_threshold = compile_threshold;
+    options.max_signatures = max_signatures;
+    IREE_ASSERT_OK(iree_runtime_specializer_create(
+        session_, &function_, &options, compiler_.get(),
+        iree_allocator_system(), &specializer_));
+  }
+
+  // Calls the function with a buffer view of |shape| and checks that the
+  // result is the input.
+  void Call(std::vector<iree_hal_dim_t> shape) {
+    iree_hal_buffer_params_t params = {0};
+    params.type =
+        IREE_HAL_MEMORY_TYPE_HOST_LOCAL | IREE_HAL_MEMORY_TYPE_DEVICE_VISIBLE;
+    params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+    iree_hal_buffer_view_t* input = NULL;
+    IREE_ASSERT_OK(iree_hal_buffer_view_allocate_buffer(
+        iree_runtime_session_device_allocator(session_), shape.size(),
+        shape.data(), IREE_HAL_ELEMENT_TYPE_FLOAT_32,
+        IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, params,
+        iree_const_byte_span_empty(), &input));
+
+    iree_vm_list_t* inputs = NULL;
+    IREE_ASSERT_OK(iree_vm_list_create(/*element_type=*/NULL, 1,
+                                       iree_allocator_system(), &inputs));
+    iree_vm_list_t* outputs = NULL;
+    IREE_ASSERT_OK(iree_vm_list_create(/*element_type=*/NULL, 1,
+                                       iree_allocator_system(), &outputs));
+    iree_vm_ref_t input_ref = iree_hal_buffer_view_retain_ref(input);
+    IREE_ASSERT_OK(iree_vm_list_push_ref_move(inputs, &input_ref));
+
+    IREE_ASSERT_OK(iree_runtime_specializer_call(specializer_, inputs, outputs));
+    EXPECT_EQ(input, iree_vm_list_get_ref_deref(
+                         outputs, 0, iree_hal_buffer_view_get_descriptor()));
+
+    iree_vm_list_release(outputs);
+    iree_vm_list_release(inputs);
+    iree_hal_buffer_view_release(input);
+  }
+
+  iree_runtime_specializer_statistics_t QueryStatistics() {
+    iree_runtime_specializer_statistics_t statistics;
+    iree_runtime_specializer_query_statistics(specializer_, &statistics);
+    return statistics;
+  }
+
+  iree_runtime_instance_t* instance_ = NULL;
+  iree_hal_device_t* device_ = NULL;
+  iree_runtime_session_t* session_ = NULL;
+  iree_vm_function_t function_;
+  RecordingCompiler compiler_;
+  iree_runtime_specializer_t* specializer_ = NULL;
+};
+
+// Tests that a specialization is requested once the threshold is reached and
+// that calls continue to the original function when it fails to compile.
+TEST_F(SpecializerTest, CompilesAtThreshold) {
+  CreateSpecializer(/*compile_threshold=*/3, /*max_signatures=*/4);
+
+  Call({2, 4});
+  Call({2, 4});
+  IREE_ASSERT_OK(
+      iree_runtime_specializer_wait_idle(specializer_, iree_infinite_timeout()));
+  EXPECT_TRUE(compiler_.signatures.empty());
+
+  Call({2, 4});
+  IREE_ASSERT_OK(
+      iree_runtime_specializer_wait_idle(specializer_, iree_infinite_timeout()));
+  ASSERT_EQ(compiler_.signatures.size(), 1);
+  EXPECT_EQ(compiler_.function_names[0], "identity");
+  EXPECT_EQ(compiler_.signatures[0], "2x4xf32");
+
+  // Failed specializations are not retried.
+  Call({2, 4});
+  IREE_ASSERT_OK(
+      iree_runtime_specializer_wait_idle(specializer_, iree_infinite_timeout()));
+  EXPECT_EQ(compiler_.signatures.size(), 1);
+
+  iree_runtime_specializer_statistics_t statistics = QueryStatistics();
+  EXPECT_EQ(statistics.generic_call_count, 4);
+  EXPECT_EQ(statistics.specialized_call_count, 0);
+  EXPECT_EQ(statistics.specialization_count, 0);
+  EXPECT_EQ(statistics.failed_specialization_count, 1);
+}
+
+// Tests that signatures are counted independently and that signatures beyond
+// the tracking limit are never specialized.
+TEST_F(SpecializerTest, TracksSignaturesIndependently) {
+  CreateSpecializer(/*compile_threshold=*/2, /*max_signatures=*/2);
+
+  Call({1});
+  Call({2});
+  Call({3});
+  Call({3});
+  IREE_ASSERT_OK(
+      iree_runtime_specializer_wait_idle(specializer_, iree_infinite_timeout()));
+  EXPECT_TRUE(compiler_.signatures.empty());
+
+  Call({2});
+  IREE_ASSERT_OK(
+      iree_runtime_specializer_wait_idle(specializer_, iree_infinite_timeout()));
+  ASSERT_EQ(compiler_.signatures.size(), 1);
+  EXPECT_EQ(compiler_.signatures[0], "2xf32");
+  EXPECT_EQ(QueryStatistics().generic_call_count, 5);
+}
+
+}  // namespace
@@ -25,57 +25,223 @@ extern "C" {
 // iree_task_affinity_set_t
 //===----------------------------------------------------------------------===//
 
-typedef uint64_t iree_task_affinity_set_t;
+// Number of worker bits stored in each affinity set word.
+#define IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT 64
+
+// Number of words required to hold one bit per worker.
+// With the default IREE_TASK_EXECUTOR_MAX_WORKER_COUNT of 64 this is a single
+// word and all of the operations below compile down to the same scalar code
+// as a plain uint64_t. Larger worker counts add one word per 64 workers and
+// operations are performed word-by-word, skipping words that have no bits set
+// where possible so that sparse sets remain cheap to scan.
+#define IREE_TASK_AFFINITY_SET_WORD_COUNT                \
+  ((IREE_TASK_EXECUTOR_MAX_WORKER_COUNT +                \
+    IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT - 1) /         \
+   IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT)
+
+// Total number of worker bits in an affinity set.
+#define IREE_TASK_AFFINITY_SET_BIT_COUNT \
+  (IREE_TASK_AFFINITY_SET_WORD_COUNT * IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT)
+
+// A bitset with one bit per worker in an executor. Bit N of word W indicates
+// worker W*64+N.
+typedef struct iree_task_affinity_set_t {
+  uint64_t words[IREE_TASK_AFFINITY_SET_WORD_COUNT];
+} iree_task_affinity_set_t;
+
+// Selects no workers.
+static inline iree_task_affinity_set_t iree_task_affinity_set_empty(void) {
+  iree_task_affinity_set_t set;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) set.words[i] = 0;
+  return set;
+}
 
 // Allows for only a specific worker to be selected.
 static inline iree_task_affinity_set_t iree_task_affinity_for_worker(
-    uint8_t worker_index) {
-  return 1ull << worker_index;
+    iree_host_size_t worker_index) {
+  iree_task_affinity_set_t set = iree_task_affinity_set_empty();
+  set.words[worker_index / IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT] =
+      1ull << (worker_index % IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT);
+  return set;
 }
 
-// Allows for a range of workers to be selected.
+// Allows for a range of workers [worker_start, worker_end) to be selected.
 static inline iree_task_affinity_set_t iree_task_affinity_for_worker_range(
-    uint8_t worker_start, uint8_t worker_end) {
-  return ((1ull << (worker_start - 1)) - 1) ^ ((1ull << worker_end) - 1);
+    iree_host_size_t worker_start, iree_host_size_t worker_end) {
+  iree_task_affinity_set_t set;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    const iree_host_size_t word_start =
+        i * IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT;
+    const iree_host_size_t word_end =
+        word_start + IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT;
+    const iree_host_size_t lo = iree_max(worker_start, word_start);
+    const iree_host_size_t hi = iree_min(worker_end, word_end);
+    if (lo >= hi) {
+      set.words[i] = 0;
+    } else {
+      const uint64_t hi_mask =
+          hi == word_end ? UINT64_MAX : (1ull << (hi - word_start)) - 1;
+      const uint64_t lo_mask = (1ull << (lo - word_start)) - 1;
+      set.words[i] = hi_mask & ~lo_mask;
+    }
+  }
+  return set;
 }
 
 // Allows for any worker to be selected.
 static inline iree_task_affinity_set_t iree_task_affinity_for_any_worker(void) {
-  return UINT64_MAX;
+  iree_task_affinity_set_t set;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    set.words[i] = UINT64_MAX;
+  }
+  return set;
+}
+
+// Returns true if no workers are selected in |set|.
+static inline bool iree_task_affinity_set_is_empty(
+    iree_task_affinity_set_t set) {
+  uint64_t any = 0;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    any |= set.words[i];
+  }
+  return any == 0;
+}
+
+// Returns true if |worker_index| is selected in |set|.
+static inline bool iree_task_affinity_set_test(iree_task_affinity_set_t set,
+                                               iree_host_size_t worker_index) {
+  return (set.words[worker_index / IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT] >>
+          (worker_index % IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT)) &
+         1;
+}
+
+// Selects |worker_index| in |set|.
+static inline void iree_task_affinity_set_insert(
+    iree_task_affinity_set_t* set, iree_host_size_t worker_index) {
+  set->words[worker_index / IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT] |=
+      1ull << (worker_index % IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT);
+}
+
+// Returns |a| & |b|.
+static inline iree_task_affinity_set_t iree_task_affinity_set_and(
+    iree_task_affinity_set_t a, iree_task_affinity_set_t b) {
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    a.words[i] &= b.words[i];
+  }
+  return a;
+}
+
+// Returns |a| | |b|.
+static inline iree_task_affinity_set_t iree_task_affinity_set_or(
+    iree_task_affinity_set_t a, iree_task_affinity_set_t b) {
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    a.words[i] |= b.words[i];
+  }
+  return a;
+}
+
+// Returns |a| & ~|b|.
+static inline iree_task_affinity_set_t iree_task_affinity_set_and_not(
+    iree_task_affinity_set_t a, iree_task_affinity_set_t b) {
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    a.words[i] &= ~b.words[i];
+  }
+  return a;
+}
+
+// Returns the total number of workers selected in |set|.
+static inline int iree_task_affinity_set_count_ones(
+    iree_task_affinity_set_t set) {
+  int count = 0;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    if (set.words[i]) count += iree_math_count_ones_u64(set.words[i]);
+  }
+  return count;
 }
 
-#define iree_task_affinity_set_count_trailing_zeros \
-  iree_math_count_trailing_zeros_u64
-#define iree_task_affinity_set_count_ones iree_math_count_ones_u64
-#define iree_task_affinity_set_rotr iree_math_rotr_u64
+// Returns the lowest worker index >= |start_index| selected in |set| or -1 if
+// there are no more workers selected. Iterating a set is O(popcnt) * O(ctz)
+// plus one load per empty word:
+//   for (int i = iree_task_affinity_set_find_next(set, 0); i >= 0;
+//        i = iree_task_affinity_set_find_next(set, i + 1)) { ... }
+static inline int iree_task_affinity_set_find_next(
+    iree_task_affinity_set_t set, iree_host_size_t start_index) {
+  if (start_index >= IREE_TASK_AFFINITY_SET_BIT_COUNT) return -1;
+  int word_index = (int)(start_index / IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT);
+  uint64_t word = set.words[word_index] &
+                  (UINT64_MAX
+                   << (start_index % IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT));
+  while (!word) {
+    if (++word_index >= IREE_TASK_AFFINITY_SET_WORD_COUNT) return -1;
+    word = set.words[word_index];
+  }
+  return word_index * IREE_TASK_AFFINITY_SET_WORD_BIT_COUNT +
+         iree_math_count_trailing_zeros_u64(word);
+}
 
 //===----------------------------------------------------------------------===//
 // iree_atomic_task_affinity_set_t
 //===----------------------------------------------------------------------===//
 
-typedef iree_atomic_int64_t iree_atomic_task_affinity_set_t;
+// An affinity set with atomic per-word access.
+// Each word is updated atomically but operations spanning multiple words
+// (when IREE_TASK_EXECUTOR_MAX_WORKER_COUNT > 64) are not a single atomic
+// snapshot. This is fine for how the executor uses the sets: every bit is
+// owned by exactly one worker and readers only treat the values as hints.
+typedef struct iree_atomic_task_affinity_set_t {
+  iree_atomic_int64_t words[IREE_TASK_AFFINITY_SET_WORD_COUNT];
+} iree_atomic_task_affinity_set_t;
 
 static inline iree_task_affinity_set_t iree_atomic_task_affinity_set_load(
     iree_atomic_task_affinity_set_t* set, iree_memory_order_t order) {
-  return iree_atomic_load_int64(set, order);
+  iree_task_affinity_set_t value;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    value.words[i] = (uint64_t)iree_atomic_load_int64(&set->words[i], order);
+  }
+  return value;
 }
 
 static inline void iree_atomic_task_affinity_set_store(
     iree_atomic_task_affinity_set_t* set, iree_task_affinity_set_t value,
     iree_memory_order_t order) {
-  iree_atomic_store_int64(set, value, order);
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    iree_atomic_store_int64(&set->words[i], (int64_t)value.words[i], order);
+  }
 }
 
-static inline iree_task_affinity_set_t iree_atomic_task_affinity_set_fetch_and(
+// Atomically clears the bits in |value| from |set| and returns the prior
+// value. Words with no bits in |value| are only loaded.
+static inline iree_task_affinity_set_t
+iree_atomic_task_affinity_set_fetch_and_not(
     iree_atomic_task_affinity_set_t* set, iree_task_affinity_set_t value,
     iree_memory_order_t order) {
-  return iree_atomic_fetch_and_int64(set, value, order);
+  iree_task_affinity_set_t prior;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    prior.words[i] =
+        value.words[i]
+            ? (uint64_t)iree_atomic_fetch_and_int64(
+                  &set->words[i], (int64_t)~value.words[i], order)
+            : (uint64_t)iree_atomic_load_int64(&set->words[i],
+                                               iree_memory_order_relaxed);
+  }
+  return prior;
 }
 
+// Atomically sets the bits in |value| in |set| and returns the prior value.
+// Words with no bits in |value| are only loaded.
 static inline iree_task_affinity_set_t iree_atomic_task_affinity_set_fetch_or(
     iree_atomic_task_affinity_set_t* set, iree_task_affinity_set_t value,
     iree_memory_order_t order) {
-  return iree_atomic_fetch_or_int64(set, value, order);
+  iree_task_affinity_set_t prior;
+  for (int i = 0; i < IREE_TASK_AFFINITY_SET_WORD_COUNT; ++i) {
+    prior.words[i] =
+        value.words[i]
+            ? (uint64_t)iree_atomic_fetch_or_int64(
+                  &set->words[i], (int64_t)value.words[i], order)
+            : (uint64_t)iree_atomic_load_int64(&set->words[i],
+                                               iree_memory_order_relaxed);
+  }
+  return prior;
 }
 
 #ifdef __cplusplus
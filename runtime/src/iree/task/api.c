@@ -24,15 +24,24 @@ IREE_FLAG(
     "threads for potential latency additions later on as threads take longer\n"
     "to wake on their first use.");
 
-// TODO(benvanik): enable this when we use it - though hopefully we don't!
 IREE_FLAG(
     int32_t, task_worker_local_memory, 0,  // 64 * 1024,
-    "Specifies the bytes of per-worker local memory allocated for use by\n"
-    "dispatched tiles. Tiles may use less than this but will fail to dispatch\n"
-    "if they require more. Conceptually it is like a stack reservation and\n"
-    "should be treated the same way: the source programs must be built to\n"
-    "only use a specific maximum amount of local memory and the runtime must\n"
-    "be configured to make at least that amount of local memory available.");
+    "Specifies the bytes of per-worker local memory reserved up front for use\n"
+    "by dispatched tiles. Workers grow their local memory on demand to the\n"
+    "largest amount required by any dispatch they execute; reserving the\n"
+    "expected high-water mark avoids growth during execution.");
+IREE_FLAG(
+    bool, task_worker_local_memory_huge_pages, false,
+    "Backs large per-worker local memory blocks with huge pages where the\n"
+    "platform supports it to reduce TLB misses in dispatches using large\n"
+    "amounts of workgroup local memory.");
+
+IREE_FLAG(
+    int32_t, task_worker_spin_us, 0,
+    "Maximum duration in microseconds each worker should spin waiting for\n"
+    "additional work before parking. Spinning increases CPU usage but avoids\n"
+    "the kernel wake latency when new work arrives shortly after a worker\n"
+    "goes idle. 0 parks workers immediately.");
 
 //===----------------------------------------------------------------------===//
 // Topology configuration
@@ -45,7 +54,14 @@ IREE_FLAG(
     "   Uses whatever the specified group count is and ignores the set mode.\n"
     " 'physical_cores':\n"
     "   Creates one group per physical core in the machine up to\n"
-    "   the value specified by --task_topology_max_group_count.\n");
+    "   the value specified by --task_topology_max_group_count.\n"
+    " 'available_cores':\n"
+    "   Like 'physical_cores' but only uses the cores the process is allowed\n"
+    "   to run on and no more than its CPU quota (such as when running in a\n"
+    "   container with a cgroup cpuset or cpu.max limit).\n"
+    " 'caller':\n"
+    "   Creates no worker threads; all work is performed by threads donated\n"
+    "   to the executor (such as those waiting on results).\n");
 
 IREE_FLAG(
     int32_t, task_topology_group_count, 0,
@@ -67,42 +83,63 @@ IREE_FLAG(
 // Task system factory functions
 //===----------------------------------------------------------------------===//
 
-iree_status_t iree_task_executor_create_from_flags(
-    iree_allocator_t host_allocator, iree_task_executor_t** out_executor) {
-  IREE_ASSERT_ARGUMENT(out_executor);
-  *out_executor = NULL;
-  IREE_TRACE_ZONE_BEGIN(z0);
-
-  iree_task_scheduling_mode_t scheduling_mode = 0;
+void iree_task_executor_options_initialize_from_flags(
+    iree_task_executor_options_t* out_options) {
+  iree_task_executor_options_initialize(out_options);
   if (FLAG_task_scheduling_defer_worker_startup) {
-    scheduling_mode |= IREE_TASK_SCHEDULING_MODE_DEFER_WORKER_STARTUP;
+    out_options->scheduling_mode |=
+        IREE_TASK_SCHEDULING_MODE_DEFER_WORKER_STARTUP;
   }
-
-  iree_host_size_t worker_local_memory =
+  out_options->worker_local_memory_size =
       (iree_host_size_t)FLAG_task_worker_local_memory;
+  if (FLAG_task_worker_local_memory_huge_pages) {
+    out_options->worker_local_memory_flags |=
+        IREE_TASK_LOCAL_MEMORY_FLAG_HUGE_PAGES;
+  }
+  out_options->worker_spin_ns =
+      (iree_duration_t)FLAG_task_worker_spin_us * 1000;
+}
 
-  iree_status_t status = iree_ok_status();
-
-  iree_task_topology_t topology;
-  iree_task_topology_initialize(&topology);
-
+iree_status_t iree_task_topology_initialize_from_flags(
+    iree_task_topology_t* out_topology) {
+  iree_task_topology_initialize(out_topology);
   if (FLAG_task_topology_group_count != 0) {
     iree_task_topology_initialize_from_group_count(
-        FLAG_task_topology_group_count, &topology);
+        FLAG_task_topology_group_count, out_topology);
   } else if (strcmp(FLAG_task_topology_mode, "physical_cores") == 0) {
     iree_task_topology_initialize_from_physical_cores(
-        FLAG_task_topology_max_group_count, &topology);
+        FLAG_task_topology_max_group_count, out_topology);
+  } else if (strcmp(FLAG_task_topology_mode, "available_cores") == 0) {
+    iree_task_topology_cpu_limits_t limits;
+    iree_task_topology_cpu_limits_query(&limits);
+    iree_task_topology_initialize_from_physical_cores_with_limits(
+        &limits, FLAG_task_topology_max_group_count, out_topology);
+  } else if (strcmp(FLAG_task_topology_mode, "caller") == 0) {
+    // Empty topology; the executor will run in caller-only mode.
   } else {
-    status = iree_make_status(
+    return iree_make_status(
         IREE_STATUS_INVALID_ARGUMENT,
         "one of --task_topology_group_count or --task_topology_mode must be "
         "specified and be a valid value; have --task_topology_mode=%s.",
         FLAG_task_topology_mode);
   }
+  return iree_ok_status();
+}
+
+iree_status_t iree_task_executor_create_from_flags(
+    iree_allocator_t host_allocator, iree_task_executor_t** out_executor) {
+  IREE_ASSERT_ARGUMENT(out_executor);
+  *out_executor = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize_from_flags(&options);
+
+  iree_task_topology_t topology;
+  iree_status_t status = iree_task_topology_initialize_from_flags(&topology);
 
   if (iree_status_is_ok(status)) {
-    status = iree_task_executor_create(scheduling_mode, &topology,
-                                       worker_local_memory, host_allocator,
+    status = iree_task_executor_create(options, &topology, host_allocator,
                                        out_executor);
   }
 
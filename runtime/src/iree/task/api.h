@@ -19,6 +19,16 @@ extern "C" {
 // Task system factory functions
 //===----------------------------------------------------------------------===//
 
+// Initializes |out_options| with executor parameters from the current command
+// line flags.
+void iree_task_executor_options_initialize_from_flags(
+    iree_task_executor_options_t* out_options);
+
+// Initializes |out_topology| from the current command line flags.
+// |out_topology| must be deinitialized by the caller even on failure.
+iree_status_t iree_task_topology_initialize_from_flags(
+    iree_task_topology_t* out_topology);
+
 // Creates a task system executor from the current command line flags.
 // This configures a topology and all of the executor parameters and returns
 // a newly created instance in |out_executor| that must be released by the
@@ -10,6 +10,7 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "iree/base/internal/fpu_state.h"
 #include "iree/base/internal/math.h"
 #include "iree/base/tracing.h"
 #include "iree/task/affinity_set.h"
@@ -24,11 +25,15 @@
 
 static void iree_task_executor_destroy(iree_task_executor_t* executor);
 
-iree_status_t iree_task_executor_create(
-    iree_task_scheduling_mode_t scheduling_mode,
-    const iree_task_topology_t* topology,
-    iree_host_size_t worker_local_memory_size, iree_allocator_t allocator,
-    iree_task_executor_t** out_executor) {
+void iree_task_executor_options_initialize(
+    iree_task_executor_options_t* out_options) {
+  memset(out_options, 0, sizeof(*out_options));
+}
+
+iree_status_t iree_task_executor_create(iree_task_executor_options_t options,
+                                        const iree_task_topology_t* topology,
+                                        iree_allocator_t allocator,
+                                        iree_task_executor_t** out_executor) {
   iree_host_size_t worker_count = iree_task_topology_group_count(topology);
   if (worker_count > IREE_TASK_EXECUTOR_MAX_WORKER_COUNT) {
     return iree_make_status(
@@ -37,23 +42,22 @@ iree_status_t iree_task_executor_create(
         IREE_TASK_EXECUTOR_MAX_WORKER_COUNT);
   }
 
-  // TODO(benvanik): support a threadless mode where we have one dummy worker
-  // that just holds the lists but is pumped from donate_caller.
-  if (worker_count == 0) {
-    return iree_make_status(
-        IREE_STATUS_UNIMPLEMENTED,
-        "threadless donate-only executor mode not yet implemented");
-  }
+  // Threadless mode: we have one caller worker that just holds the lists and is
+  // pumped from donate_caller. No worker threads are created.
+  const bool caller_only = worker_count == 0;
+  if (caller_only) worker_count = 1;
 
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_ASSERT_ARGUMENT(out_executor);
   *out_executor = NULL;
 
-  // The executor is followed in memory by worker[] + worker_local_memory[].
-  // The whole point is that we don't want destructive sharing between workers
-  // so ensure we are aligned to at least the destructive interference size.
-  worker_local_memory_size = iree_host_align(
-      worker_local_memory_size, iree_hardware_destructive_interference_size);
+  // The executor is followed in memory by worker[]. The whole point is that we
+  // don't want destructive sharing between workers so ensure we are aligned to
+  // at least the destructive interference size. Worker local memory is
+  // allocated by each worker as it may grow over time.
+  iree_host_size_t worker_local_memory_size =
+      iree_host_align(options.worker_local_memory_size,
+                      iree_hardware_destructive_interference_size);
   IREE_TRACE_ZONE_APPEND_VALUE(z0, (int64_t)worker_local_memory_size);
   iree_host_size_t executor_base_size =
       iree_host_align(sizeof(iree_task_executor_t),
@@ -61,18 +65,26 @@ iree_status_t iree_task_executor_create(
   iree_host_size_t worker_list_size =
       iree_host_align(worker_count * sizeof(iree_task_worker_t),
                       iree_hardware_destructive_interference_size);
-  iree_host_size_t executor_size = executor_base_size + worker_list_size +
-                                   worker_count * worker_local_memory_size;
+  iree_host_size_t executor_size = executor_base_size + worker_list_size;
 
   iree_task_executor_t* executor = NULL;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
       z0, iree_allocator_malloc(allocator, executor_size, (void**)&executor));
-  memset(executor, 0, executor_size);
   iree_atomic_ref_count_init(&executor->ref_count);
   executor->allocator = allocator;
-  executor->scheduling_mode = scheduling_mode;
+  executor->scheduling_mode = options.scheduling_mode;
+  executor->worker_spin_ns = options.worker_spin_ns;
+  executor->caller_only = caller_only;
   iree_atomic_task_slist_initialize(&executor->incoming_ready_slist);
   iree_slim_mutex_initialize(&executor->coordinator_mutex);
+  iree_atomic_store_int32(&executor->coordination_requested, 0,
+                          iree_memory_order_relaxed);
+  iree_atomic_store_int32(&executor->worker_affinity_epoch, 0,
+                          iree_memory_order_relaxed);
+  iree_slim_mutex_initialize(&executor->donation_mutex);
+  iree_task_local_memory_initialize(options.worker_local_memory_flags,
+                                    allocator,
+                                    &executor->donation_local_memory);
 
   // Simple PRNG used to generate seeds for the per-worker PRNGs used to
   // distribute work. This isn't strong (and doesn't need to be); it's just
@@ -118,33 +130,41 @@ iree_status_t iree_task_executor_create(
                                          &executor->poller);
   }
 
+  // Threads donated to executors with workers steal tasks and need their own
+  // local memory as they cannot use that of any worker.
+  if (iree_status_is_ok(status) && !caller_only) {
+    status = iree_task_local_memory_reserve(&executor->donation_local_memory,
+                                            worker_local_memory_size);
+  }
+
   // Bring up the workers; the threads will be created here but be suspended
   // (if the platform supports it) awaiting the first tasks getting scheduled.
   if (iree_status_is_ok(status)) {
     executor->worker_count = worker_count;
     executor->workers =
         (iree_task_worker_t*)((uint8_t*)executor + executor_base_size);
-    uint8_t* worker_local_memory =
-        (uint8_t*)executor->workers + worker_list_size;
 
-    iree_task_affinity_set_t worker_idle_mask = 0;
-    iree_task_affinity_set_t worker_live_mask = 0;
-    iree_task_affinity_set_t worker_suspend_mask = 0;
+    iree_task_affinity_set_t worker_idle_mask = iree_task_affinity_set_empty();
+    iree_task_affinity_set_t worker_live_mask = iree_task_affinity_set_empty();
+    iree_task_affinity_set_t worker_suspend_mask =
+        iree_task_affinity_set_empty();
     for (iree_host_size_t i = 0; i < worker_count; ++i) {
-      iree_task_affinity_set_t worker_bit = iree_task_affinity_for_worker(i);
-      worker_idle_mask |= worker_bit;
-      worker_live_mask |= worker_bit;
-      if (executor->scheduling_mode &
-          IREE_TASK_SCHEDULING_MODE_DEFER_WORKER_STARTUP) {
-        worker_suspend_mask |= worker_bit;
+      iree_task_affinity_set_insert(&worker_idle_mask, i);
+      iree_task_affinity_set_insert(&worker_live_mask, i);
+      if (!caller_only && (executor->scheduling_mode &
+                           IREE_TASK_SCHEDULING_MODE_DEFER_WORKER_STARTUP)) {
+        iree_task_affinity_set_insert(&worker_suspend_mask, i);
       }
 
       iree_task_worker_t* worker = &executor->workers[i];
       status = iree_task_worker_initialize(
-          executor, i, iree_task_topology_get_group(topology, i),
-          iree_make_byte_span(worker_local_memory, worker_local_memory_size),
+          executor, i,
+          caller_only ? NULL : iree_task_topology_get_group(topology, i),
+          caller_only
+              ? iree_task_affinity_set_empty()
+              : iree_task_topology_calculate_node_sharing_mask(topology, i),
+          options.worker_local_memory_flags, worker_local_memory_size,
           &seed_prng, worker);
-      worker_local_memory += worker_local_memory_size;
       if (!iree_status_is_ok(status)) break;
     }
     iree_atomic_task_affinity_set_store(&executor->worker_suspend_mask,
@@ -205,6 +225,8 @@ static void iree_task_executor_destroy(iree_task_executor_t* executor) {
   iree_task_poller_deinitialize(&executor->poller);
 
   iree_event_pool_free(executor->event_pool);
+  iree_task_local_memory_deinitialize(&executor->donation_local_memory);
+  iree_slim_mutex_deinitialize(&executor->donation_mutex);
   iree_slim_mutex_deinitialize(&executor->coordinator_mutex);
   iree_atomic_task_slist_deinitialize(&executor->incoming_ready_slist);
   iree_task_pool_deinitialize(&executor->transient_task_pool);
@@ -239,6 +261,100 @@ iree_host_size_t iree_task_executor_worker_count(
   return executor->worker_count;
 }
 
+bool iree_task_executor_is_caller_only(iree_task_executor_t* executor) {
+  return executor->caller_only;
+}
+
+iree_host_size_t iree_task_executor_active_worker_count(
+    iree_task_executor_t* executor) {
+  return (iree_host_size_t)iree_task_affinity_set_count_ones(
+      iree_atomic_task_affinity_set_load(&executor->worker_live_mask,
+                                         iree_memory_order_relaxed));
+}
+
+iree_status_t iree_task_executor_set_active_worker_count(
+    iree_task_executor_t* executor, iree_host_size_t active_worker_count) {
+  IREE_ASSERT_ARGUMENT(executor);
+  if (active_worker_count < 1 ||
+      active_worker_count > executor->worker_count) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "active worker count %" PRIhsz
+                            " must be between 1 and the worker count %" PRIhsz,
+                            active_worker_count, executor->worker_count);
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, active_worker_count);
+
+  // Workers leaving the live set will observe the change the next time they
+  // run out of local work and those joining will start receiving posts and
+  // stealing immediately.
+  iree_atomic_task_affinity_set_store(
+      &executor->worker_live_mask,
+      iree_task_affinity_for_worker_range(0, active_worker_count),
+      iree_memory_order_release);
+  iree_atomic_fetch_add_int32(&executor->worker_affinity_epoch, 1,
+                              iree_memory_order_release);
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+iree_status_t iree_task_executor_refresh_cpu_limits(
+    iree_task_executor_t* executor) {
+  IREE_ASSERT_ARGUMENT(executor);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_task_topology_cpu_limits_t limits;
+  iree_task_topology_cpu_limits_query(&limits);
+  iree_host_size_t active_worker_count =
+      iree_min(executor->worker_count,
+               iree_task_topology_cpu_limits_processor_count(&limits));
+  iree_status_t status = iree_task_executor_set_active_worker_count(
+      executor, iree_max(1, active_worker_count));
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_task_executor_query_statistics(
+    iree_task_executor_t* executor, iree_host_size_t worker_capacity,
+    iree_task_worker_statistics_t* out_worker_statistics,
+    iree_task_executor_statistics_t* out_statistics) {
+  IREE_ASSERT_ARGUMENT(executor);
+  IREE_ASSERT_ARGUMENT(out_statistics);
+  memset(out_statistics, 0, sizeof(*out_statistics));
+  out_statistics->worker_count = executor->worker_count;
+  if (out_worker_statistics && worker_capacity < executor->worker_count) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "worker statistics capacity %" PRIhsz
+                            " is less than the worker count %" PRIhsz,
+                            worker_capacity, executor->worker_count);
+  }
+
+  iree_task_worker_statistics_t* totals = &out_statistics->worker_totals;
+  for (iree_host_size_t i = 0; i < executor->worker_count; ++i) {
+    iree_task_worker_statistics_t worker_statistics;
+    iree_task_worker_query_statistics(&executor->workers[i],
+                                      &worker_statistics);
+    if (out_worker_statistics) out_worker_statistics[i] = worker_statistics;
+    totals->task_count += worker_statistics.task_count;
+    totals->tile_count += worker_statistics.tile_count;
+    totals->steal_attempt_count += worker_statistics.steal_attempt_count;
+    totals->steal_success_count += worker_statistics.steal_success_count;
+    totals->steal_duration_ns += worker_statistics.steal_duration_ns;
+    totals->wake_count += worker_statistics.wake_count;
+    totals->idle_duration_ns += worker_statistics.idle_duration_ns;
+  }
+
+  out_statistics->donated_task_count = iree_atomic_load_int64(
+      &executor->donated_task_count, iree_memory_order_relaxed);
+  out_statistics->coordination_count = iree_atomic_load_int64(
+      &executor->coordination_count, iree_memory_order_relaxed);
+  out_statistics->coordination_deferred_count = iree_atomic_load_int64(
+      &executor->coordination_deferred_count, iree_memory_order_relaxed);
+  out_statistics->coordination_duration_ns = iree_atomic_load_int64(
+      &executor->coordination_duration_ns, iree_memory_order_relaxed);
+  return iree_ok_status();
+}
+
 iree_event_pool_t* iree_task_executor_event_pool(
     iree_task_executor_t* executor) {
   return executor->event_pool;
@@ -282,7 +398,9 @@ static void iree_task_executor_relay_to_worker(
 // least recently added tasks from the submission (nice in-order traversal) we
 // are pushing them as what will become the least recent tasks in the batch.
 //
-// Only called during coordination and expects the coordinator lock to be held.
+// Called during coordination and by producers submitting directly to workers.
+// All state touched is either owned by the tasks being scheduled or atomically
+// updated and the coordinator lock need not be held.
 void iree_task_executor_schedule_ready_tasks(
     iree_task_executor_t* executor, iree_task_submission_t* pending_submission,
     iree_task_post_batch_t* post_batch) {
@@ -378,8 +496,29 @@ void iree_task_executor_submit(iree_task_executor_t* executor,
                                iree_task_submission_t* submission) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
-  // Concatenate the submitted tasks onto our primary LIFO incoming lists.
-  iree_task_executor_merge_submission(executor, submission);
+  // Schedule the ready tasks from the calling thread and post them directly to
+  // the mailboxes of the workers that will execute them. This keeps producers
+  // from funneling through the coordinator such that many threads submitting
+  // concurrently only contend on the lock-free worker mailboxes. Tasks that
+  // become ready while scheduling (such as those after a retired barrier) are
+  // scheduled here too.
+  if (!iree_task_list_is_empty(&submission->ready_list)) {
+    // The submission is LIFO; schedule in FIFO order as the coordinator would.
+    iree_task_list_reverse(&submission->ready_list);
+    iree_task_post_batch_t* post_batch =
+        iree_alloca(sizeof(iree_task_post_batch_t) +
+                    executor->worker_count * sizeof(iree_task_list_t));
+    iree_task_post_batch_initialize(executor, /*current_worker=*/NULL,
+                                    post_batch);
+    iree_task_executor_schedule_ready_tasks(executor, submission, post_batch);
+    iree_task_post_batch_submit(post_batch);
+  }
+
+  // Enqueue waiting tasks (including any that became ready above and then
+  // turned out to need a wait) with the poller.
+  iree_task_poller_enqueue(&executor->poller, &submission->waiting_list);
+
+  iree_task_submission_reset(submission);
 
   IREE_TRACE_ZONE_END(z0);
 }
@@ -395,18 +534,10 @@ void iree_task_executor_flush(iree_task_executor_t* executor) {
   IREE_TRACE_ZONE_END(z0);
 }
 
-// Dispatches tasks in the global submission queue to workers.
-// This is called by users upon submission of new tasks or by workers when they
-// run out of tasks to process. If |current_worker| is provided then tasks will
-// prefer to be routed back to it for immediate processing.
-//
-// If a coordination run ends up with no ready tasks and |current_worker| is
-// provided the calling thread will enter a wait until the worker has more tasks
-// posted to it.
-void iree_task_executor_coordinate(iree_task_executor_t* executor,
-                                   iree_task_worker_t* current_worker) {
+// Performs coordination with the coordinator lock held.
+static void iree_task_executor_coordinate_locked(
+    iree_task_executor_t* executor, iree_task_worker_t* current_worker) {
   IREE_TRACE_ZONE_BEGIN(z0);
-  iree_slim_mutex_lock(&executor->coordinator_mutex);
 
   // We may be adding tasks/waiting/etc on each pass through coordination - to
   // ensure we completely drain the incoming queues and satisfied waits we loop
@@ -459,39 +590,97 @@ void iree_task_executor_coordinate(iree_task_executor_t* executor,
     schedule_dirty = iree_task_post_batch_submit(post_batch);
   } while (schedule_dirty);
 
-  iree_slim_mutex_unlock(&executor->coordinator_mutex);
   IREE_TRACE_ZONE_END(z0);
 }
 
+// Dispatches tasks in the global submission queue to workers.
+// This is called by users upon submission of new tasks or by workers when they
+// run out of tasks to process. If |current_worker| is provided then tasks will
+// prefer to be routed back to it for immediate processing.
+//
+// If a coordination run ends up with no ready tasks and |current_worker| is
+// provided the calling thread will enter a wait until the worker has more tasks
+// posted to it.
+//
+// Coordination never blocks on another coordinator: if one is already active
+// the request is recorded and that coordinator will run again before it
+// returns so that any tasks made available by the caller are not missed.
+void iree_task_executor_coordinate(iree_task_executor_t* executor,
+                                   iree_task_worker_t* current_worker) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Publish the request prior to checking the lock. This pairs with the active
+  // coordinator checking for requests after unlocking; the fences ensure at
+  // least one of us observes the other.
+  iree_atomic_store_int32(&executor->coordination_requested, 1,
+                          iree_memory_order_seq_cst);
+  iree_atomic_thread_fence(iree_memory_order_seq_cst);
+  while (iree_atomic_load_int32(&executor->coordination_requested,
+                                iree_memory_order_acquire)) {
+    if (!iree_slim_mutex_try_lock(&executor->coordinator_mutex)) {
+      IREE_TRACE_ZONE_APPEND_TEXT(z0, "deferred");
+      iree_atomic_fetch_add_int64(&executor->coordination_deferred_count, 1,
+                                  iree_memory_order_relaxed);
+      break;
+    }
+    iree_atomic_store_int32(&executor->coordination_requested, 0,
+                            iree_memory_order_seq_cst);
+    const iree_time_t coordination_start_ns = iree_time_now();
+    iree_task_executor_coordinate_locked(executor, current_worker);
+    iree_task_statistics_counter_add(&executor->coordination_count, 1);
+    iree_task_statistics_counter_add(&executor->coordination_duration_ns,
+                                     iree_time_now() - coordination_start_ns);
+    iree_slim_mutex_unlock(&executor->coordinator_mutex);
+    iree_atomic_thread_fence(iree_memory_order_seq_cst);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+
+iree_task_dispatch_cost_t* iree_task_executor_lookup_dispatch_cost(
+    iree_task_executor_t* executor, uint64_t key) {
+  // Fibonacci hash to spread out keys derived from pointers (which often share
+  // their low bits due to alignment).
+  iree_host_size_t slot = (iree_host_size_t)((key * 0x9E3779B97F4A7C15ull) >>
+                                             32) &
+                          (IREE_TASK_DISPATCH_COST_CACHE_CAPACITY - 1);
+  iree_task_dispatch_cost_t* cost = &executor->dispatch_costs[slot];
+  if (iree_atomic_load_int64(&cost->key, iree_memory_order_relaxed) !=
+      (int64_t)key) {
+    iree_atomic_store_int64(&cost->tile_duration_ns, 0,
+                            iree_memory_order_relaxed);
+    iree_atomic_store_int64(&cost->key, (int64_t)key,
+                            iree_memory_order_relaxed);
+  }
+  return cost;
+}
+
 static iree_task_t* iree_task_executor_try_steal_task_from_affinity_set(
     iree_task_executor_t* executor, iree_task_affinity_set_t victim_mask,
-    uint32_t max_theft_attempts, int rotation_offset,
-    iree_task_queue_t* local_task_queue) {
-  if (!victim_mask) return NULL;
+    uint32_t max_theft_attempts, iree_host_size_t rotation_offset,
+    iree_task_queue_t* local_task_queues) {
+  if (iree_task_affinity_set_is_empty(victim_mask)) return NULL;
   max_theft_attempts = iree_min(max_theft_attempts,
                                 iree_task_affinity_set_count_ones(victim_mask));
-  victim_mask = iree_task_affinity_set_rotr(victim_mask, rotation_offset);
 
-  int worker_index = rotation_offset;
-  iree_task_affinity_set_t mask =
-      iree_task_affinity_set_rotr(victim_mask, worker_index);
+  // Start at |rotation_offset| and walk forward through the set bits, wrapping
+  // around to the start once we run off the end. Skipping directly to each set
+  // bit avoids the need for doing a full O(n) scan and instead gets us at
+  // O(popcnt) * O(ctz) plus one load per empty word.
+  //
+  // Example: victim mask = 0b01010101
+  //          rotation_offset = 3 (randomly selected)
+  //          victims tried in order: 4, 6, 0, 2
+  int victim_index = iree_task_affinity_set_find_next(victim_mask,
+                                                      rotation_offset);
   for (uint32_t i = 0; i < max_theft_attempts; ++i) {
-    // Find the last set bit and skip to it. This avoids the need for doing
-    // a full O(n) scan and instead gets us at O(popcnt) * O(ctz).
-    //
-    // Example: sharing mask = 0b01010101
-    //          mask_rotation = 3 (randomly selected)
-    //          mask = 0b01010101 rotr 3 = 0b10101010
-    //          for (i = 0; i < 4; ++i)
-    //            offset = ctz(0b10101010) = 1
-    //            mask_rotation += 1 = 4
-    //            mask >>= 1 = 0b01010101
-    //            victim_index = 4 % 64 = 4
-    int offset = iree_task_affinity_set_count_trailing_zeros(mask);
-    int victim_index = (worker_index + offset) % executor->worker_count;
-    worker_index += offset + 1;
-    mask = iree_shr(mask, offset + 1);
+    if (victim_index < 0) {
+      victim_index = iree_task_affinity_set_find_next(victim_mask, 0);
+    }
     iree_task_worker_t* victim_worker = &executor->workers[victim_index];
+    victim_index =
+        iree_task_affinity_set_find_next(victim_mask, victim_index + 1);
 
     // Policy: steal a chunk of tasks at the tail of the victim queue.
     // This will steal multiple tasks from the victim up to the specified max
@@ -500,7 +689,7 @@ static iree_task_t* iree_task_executor_try_steal_task_from_affinity_set(
     // thievery taking ~half of the tasks each time (across all queues) will
     // lead to a relatively even distribution.
     iree_task_t* task = iree_task_worker_try_steal_task(
-        victim_worker, local_task_queue,
+        victim_worker, local_task_queues,
         /*max_tasks=*/IREE_TASK_EXECUTOR_MAX_THEFT_TASK_COUNT);
     if (task) return task;
   }
@@ -511,12 +700,15 @@ static iree_task_t* iree_task_executor_try_steal_task_from_affinity_set(
 
 // Tries to steal an entire task from a sibling worker (based on topology).
 // Returns a task that is available (has not yet begun processing at all).
-// May steal multiple tasks and add them to the |local_task_queue|.
+// May steal multiple tasks and add them to the |local_task_queues|.
 //
 // We do a scan through ideal victims indicated by the
 // |constructive_sharing_mask|; these are the workers most likely to have some
 // cache benefits to taking their work as they share some level of the cache
-// hierarchy and should be better to steal from than any random worker.
+// hierarchy and should be better to steal from than any random worker. After
+// those we try the workers on the same NUMA node in |node_sharing_mask| as
+// their tasks are likely to be touching memory local to the node before
+// finally falling back to crossing nodes.
 //
 // To prevent biasing any particular victim we use a fast prng function to
 // select where in the set of potential victims defined by the topology
@@ -526,8 +718,9 @@ static iree_task_t* iree_task_executor_try_steal_task_from_affinity_set(
 iree_task_t* iree_task_executor_try_steal_task(
     iree_task_executor_t* executor,
     iree_task_affinity_set_t constructive_sharing_mask,
-    uint32_t max_theft_attempts, iree_prng_minilcg128_state_t* theft_prng,
-    iree_task_queue_t* local_task_queue) {
+    iree_task_affinity_set_t node_sharing_mask, uint32_t max_theft_attempts,
+    iree_prng_minilcg128_state_t* theft_prng,
+    iree_task_queue_t* local_task_queues) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
   iree_task_affinity_set_t worker_live_mask =
@@ -538,31 +731,44 @@ iree_task_t* iree_task_executor_try_steal_task(
                                          iree_memory_order_relaxed);
   // Limit the workers we will steal from to the ones that are currently live
   // and not idle.
-  iree_task_affinity_set_t victim_mask = worker_live_mask & ~worker_idle_mask;
+  iree_task_affinity_set_t victim_mask =
+      iree_task_affinity_set_and_not(worker_live_mask, worker_idle_mask);
 
   // TODO(benvanik): it may be possible to rework this such that we better
   // use the prng; for example, instead of all this rotating stuff we could just
   // generate an 8-bit number (or even split it into two 4-bit numbers) per
   // theft attempt. The current rotation strategy is biased toward the same try
   // ordering vs. what we may really want with an unbiased random selection.
-  int rotation_offset = iree_prng_minilcg128_next_uint8(theft_prng) &
-                        (8 * sizeof(iree_task_affinity_set_t) - 1);
+  iree_host_size_t rotation_offset =
+      iree_prng_minilcg128_next_uint8(theft_prng) % executor->worker_count;
 
   // Try first with the workers we may have some caches shared with. This
   // helps to prevent cache invalidations/availability updates as it's likely
   // that we won't need to go back to main memory (or higher cache tiers) in the
   // event that the thief and victim are running close to each other in time.
   iree_task_t* task = iree_task_executor_try_steal_task_from_affinity_set(
-      executor, victim_mask & constructive_sharing_mask, max_theft_attempts,
-      rotation_offset, local_task_queue);
+      executor,
+      iree_task_affinity_set_and(victim_mask, constructive_sharing_mask),
+      max_theft_attempts, rotation_offset, local_task_queues);
   if (task) {
     IREE_TRACE_ZONE_APPEND_TEXT(z0, "local");
   } else {
+    // Next try the workers on the same NUMA node.
+    victim_mask =
+        iree_task_affinity_set_and_not(victim_mask, constructive_sharing_mask);
     task = iree_task_executor_try_steal_task_from_affinity_set(
-        executor, victim_mask & ~constructive_sharing_mask, max_theft_attempts,
-        rotation_offset, local_task_queue);
+        executor, iree_task_affinity_set_and(victim_mask, node_sharing_mask),
+        max_theft_attempts, rotation_offset, local_task_queues);
     if (task) {
-      IREE_TRACE_ZONE_APPEND_TEXT(z0, "non-local");
+      IREE_TRACE_ZONE_APPEND_TEXT(z0, "node-local");
+    } else {
+      task = iree_task_executor_try_steal_task_from_affinity_set(
+          executor,
+          iree_task_affinity_set_and_not(victim_mask, node_sharing_mask),
+          max_theft_attempts, rotation_offset, local_task_queues);
+      if (task) {
+        IREE_TRACE_ZONE_APPEND_TEXT(z0, "non-local");
+      }
     }
   }
 
@@ -570,20 +776,221 @@ iree_task_t* iree_task_executor_try_steal_task(
   return task;
 }
 
+// Queries |wait_source| and returns true if it has resolved (successfully or
+// otherwise) with the result stored in |out_status|.
+static bool iree_task_executor_query_wait_source(iree_wait_source_t wait_source,
+                                                 iree_status_t* out_status) {
+  iree_status_code_t wait_status_code = IREE_STATUS_OK;
+  iree_status_t status = iree_wait_source_query(wait_source, &wait_status_code);
+  if (!iree_status_is_ok(status)) {
+    *out_status = status;
+    return true;
+  } else if (wait_status_code == IREE_STATUS_DEFERRED) {
+    return false;
+  }
+  *out_status = iree_status_from_code(wait_status_code);
+  return true;
+}
+
+// Pumps the caller worker of a caller-only executor on the calling thread until
+// |wait_source| resolves or |deadline_ns| elapses. Waits for new work when the
+// worker runs dry but periodically re-queries the wait source in case it was
+// resolved by something outside of the executor.
+static iree_status_t iree_task_executor_donate_caller_only(
+    iree_task_executor_t* executor, iree_wait_source_t wait_source,
+    iree_time_t deadline_ns) {
+  iree_task_worker_t* worker = &executor->workers[0];
+
+  // We cannot rely on the caller thread having the FPU state we need.
+  iree_fpu_state_t fpu_state =
+      iree_fpu_state_push(IREE_FPU_STATE_FLAG_FLUSH_DENORMALS_TO_ZERO);
+  iree_cpu_requery_processor_id(&worker->processor_tag, &worker->processor_id);
+
+  iree_status_t status = iree_ok_status();
+  while (!iree_task_executor_query_wait_source(wait_source, &status)) {
+    iree_time_t now_ns = iree_time_now();
+    if (now_ns >= deadline_ns) {
+      status = iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+      break;
+    }
+    iree_time_t poll_deadline_ns =
+        iree_min(deadline_ns,
+                 now_ns + IREE_TASK_EXECUTOR_DONATION_POLL_INTERVAL_NS);
+
+    // Run everything available to the worker. Tasks posted to the worker
+    // after this point will interrupt the wait below. Only one donated thread
+    // may pump the worker at a time; others just wait for it to make progress
+    // on their behalf.
+    iree_wait_token_t wait_token =
+        iree_notification_prepare_wait(&worker->wake_notification);
+    bool has_more_work = false;
+    if (iree_slim_mutex_try_lock(&executor->donation_mutex)) {
+      has_more_work = iree_task_worker_pump_until_idle(worker);
+      iree_slim_mutex_unlock(&executor->donation_mutex);
+    }
+    if (has_more_work ||
+        iree_task_executor_query_wait_source(wait_source, &status)) {
+      iree_notification_cancel_wait(&worker->wake_notification);
+      if (has_more_work) continue;
+      break;
+    }
+
+    // Nothing left to do; wait for new work to arrive (such as from the poller
+    // when waits resolve) or until it's time to check the wait source again.
+    IREE_TRACE_ZONE_BEGIN_NAMED(z_wait,
+                                "iree_task_executor_donate_caller_wait");
+    iree_notification_commit_wait(&worker->wake_notification, wait_token,
+                                  executor->worker_spin_ns, poll_deadline_ns);
+    IREE_TRACE_ZONE_END(z_wait);
+  }
+
+  iree_fpu_state_pop(fpu_state);
+  return status;
+}
+
+// Executes a |task| stolen by a donated caller thread.
+// Only task types that are scheduled to workers are handled; all others must be
+// handled by the coordinator during scheduling.
+static void iree_task_executor_donation_execute(
+    iree_task_executor_t* executor, iree_task_t* task,
+    iree_cpu_processor_id_t processor_id,
+    iree_task_submission_t* pending_submission) {
+  switch (task->type) {
+    case IREE_TASK_TYPE_CALL: {
+      iree_task_call_execute((iree_task_call_t*)task, pending_submission);
+      break;
+    }
+    case IREE_TASK_TYPE_DISPATCH_SHARD: {
+      // Donated threads never yield shards as they have no queue of their own
+      // that higher priority work could be posted to.
+      iree_task_dispatch_shard_execute(
+          (iree_task_dispatch_shard_t*)task, executor->worker_count,
+          processor_id, &executor->donation_local_memory,
+          /*pending_priority_mask=*/NULL, /*out_tiles_executed=*/NULL,
+          pending_submission);
+      break;
+    }
+    default:
+      IREE_ASSERT_UNREACHABLE("incorrect task type for donated execution");
+      break;
+  }
+}
+
+// Pops the next task stolen by a donated caller thread in priority order.
+static iree_task_t* iree_task_executor_donation_pop_task(
+    iree_task_queue_t* local_task_queues) {
+  for (iree_host_size_t i = 0; i < IREE_TASK_PRIORITY_COUNT; ++i) {
+    iree_task_t* task = iree_task_queue_pop_front(&local_task_queues[i]);
+    if (task) return task;
+  }
+  return NULL;
+}
+
+// Steals tasks from the executor workers and executes them on the calling
+// thread until |wait_source| resolves or |deadline_ns| elapses. When there is
+// nothing to steal the caller waits on the wait source for a short time before
+// trying again so that it can join in on work that arrives later.
+//
+// Tasks stolen in the same batch are always completed before returning so that
+// none are stranded on the calling thread.
+static iree_status_t iree_task_executor_donate_and_steal(
+    iree_task_executor_t* executor, iree_wait_source_t wait_source,
+    iree_time_t deadline_ns) {
+  // We cannot rely on the caller thread having the FPU state we need.
+  iree_fpu_state_t fpu_state =
+      iree_fpu_state_push(IREE_FPU_STATE_FLAG_FLUSH_DENORMALS_TO_ZERO);
+  iree_cpu_processor_tag_t processor_tag = 0;
+  iree_cpu_processor_id_t processor_id = 0;
+  iree_cpu_requery_processor_id(&processor_tag, &processor_id);
+
+  iree_task_queue_t local_task_queues[IREE_TASK_PRIORITY_COUNT];
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(local_task_queues); ++i) {
+    iree_task_queue_initialize(&local_task_queues[i]);
+  }
+
+  iree_status_t status = iree_ok_status();
+  while (!iree_task_executor_query_wait_source(wait_source, &status)) {
+    iree_time_t now_ns = iree_time_now();
+    if (now_ns >= deadline_ns) {
+      status = iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+      break;
+    }
+
+    // Only one donated thread may steal at a time as the donation local memory
+    // is not shareable.
+    iree_task_t* task = NULL;
+    bool did_lock = iree_slim_mutex_try_lock(&executor->donation_mutex);
+    if (did_lock) {
+      task = iree_task_executor_try_steal_task(
+          executor,
+          /*constructive_sharing_mask=*/iree_task_affinity_set_empty(),
+          /*node_sharing_mask=*/iree_task_affinity_set_empty(),
+          /*max_theft_attempts=*/(uint32_t)executor->worker_count,
+          &executor->donation_theft_prng, local_task_queues);
+    }
+    if (!task) {
+      if (did_lock) iree_slim_mutex_unlock(&executor->donation_mutex);
+      // Nothing to steal; wait a bit to see if the wait source resolves on its
+      // own before trying again.
+      iree_time_t poll_deadline_ns = iree_min(
+          deadline_ns, now_ns + IREE_TASK_EXECUTOR_DONATION_POLL_INTERVAL_NS);
+      iree_status_t wait_status = iree_wait_source_wait_one(
+          wait_source, iree_make_deadline(poll_deadline_ns));
+      if (iree_status_is_deadline_exceeded(wait_status)) {
+        iree_status_ignore(wait_status);
+        continue;
+      }
+      status = wait_status;
+      break;
+    }
+
+    // Run the stolen task and any others stolen along with it.
+    iree_task_submission_t pending_submission;
+    iree_task_submission_initialize(&pending_submission);
+    do {
+      iree_task_statistics_counter_add(&executor->donated_task_count, 1);
+      iree_task_executor_donation_execute(executor, task, processor_id,
+                                          &pending_submission);
+    } while ((task = iree_task_executor_donation_pop_task(local_task_queues)));
+    iree_slim_mutex_unlock(&executor->donation_mutex);
+
+    // Hand off any newly-readied tasks to the workers.
+    if (!iree_task_submission_is_empty(&pending_submission)) {
+      iree_task_executor_merge_submission(executor, &pending_submission);
+      iree_task_executor_coordinate(executor, /*current_worker=*/NULL);
+    }
+  }
+
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(local_task_queues); ++i) {
+    iree_task_queue_deinitialize(&local_task_queues[i]);
+  }
+  iree_fpu_state_pop(fpu_state);
+  return status;
+}
+
 iree_status_t iree_task_executor_donate_caller(iree_task_executor_t* executor,
                                                iree_wait_source_t wait_source,
                                                iree_timeout_t timeout) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  // Capture time as an absolute value as we don't know how long we'll run.
+  iree_convert_timeout_to_absolute(&timeout);
+
   // Perform an immediate flush/coordination (in case the caller queued).
   iree_task_executor_flush(executor);
 
-  // Wait until completed.
-  // TODO(benvanik): make this steal tasks until wait_handle resolves?
-  // Somewhat dangerous as we don't know what kind of thread we are running on;
-  // it may have a smaller stack than we are expecting or have some weird thread
-  // local state (FPU rounding modes/etc).
-  iree_status_t status = iree_wait_source_wait_one(wait_source, timeout);
+  iree_status_t status = iree_ok_status();
+  if (executor->caller_only) {
+    // No workers will ever run our tasks; we have to do it ourselves.
+    status = iree_task_executor_donate_caller_only(
+        executor, wait_source, iree_timeout_as_deadline_ns(timeout));
+  } else {
+    // Join the workers and steal tasks until the wait source resolves.
+    // NOTE: tasks run on the caller's stack; callers on threads with small
+    // stacks should wait on the wait source directly instead of donating.
+    status = iree_task_executor_donate_and_steal(
+        executor, wait_source, iree_timeout_as_deadline_ns(timeout));
+  }
 
   IREE_TRACE_ZONE_END(z0);
   return status;
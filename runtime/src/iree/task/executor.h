@@ -112,9 +112,16 @@ extern "C" {
 //      the ready_list. If it is initially waiting on an external resource such
 //      as iree_wait_handle_t then it is placed into the waiting_list.
 //
-// 2. iree_task_executor_submit (LIFO, atomic slist)
-//    Submissions have their task thread-local lists concatenated into a LIFO
-//    incoming_ready_slist or the wait poller shared by the executor.
+// 2. iree_task_executor_submit (lock-free, producer thread)
+//    Ready tasks in submissions are scheduled on the submitting thread with
+//    iree_task_executor_schedule_ready_tasks (step 3b) and posted directly to
+//    the mailboxes of their target workers (step 3c). Waiting tasks go to the
+//    wait poller shared by the executor. Producers never take the coordinator
+//    lock and only contend with each other on the atomic worker mailboxes.
+//
+//    Tasks that become ready on workers as their dependencies retire are
+//    concatenated into a LIFO incoming_ready_slist instead and scheduled by
+//    the next coordinator.
 //
 // 3. iree_task_executor_flush (or a worker puts on its coordinator hat 🎩)
 //
@@ -135,13 +142,16 @@ extern "C" {
 //    each worker will check its mailbox_slist to see if any tasks have been
 //    posted.
 //
-//    a. Tasks are flushed from the LIFO mailbox into the local_task_queue FIFO
-//       for the particular worker.
+//    a. Tasks are flushed from the LIFO mailbox into the local_task_queues
+//       FIFOs for the particular worker based on the priority of their scope.
 //
 //    b. If the mailbox is empty the worker *may* attempt to steal work from
 //       another nearby worker in the topology.
 //
-//    c. Any tasks in the local_task_queue are executed until empty.
+//    c. Any tasks in the local_task_queues are executed until empty with
+//       higher priority tasks always run first. Dispatch shards check for
+//       higher priority work posted to the mailbox between tile reservations
+//       and yield back to the front of their queue so that it runs first.
 //       Tasks are retired and dependent tasks (via completion_task or barriers)
 //       are made ready and placed in the executor incoming_ready_slist as with
 //       iree_task_executor_submit.
@@ -152,7 +162,9 @@ extern "C" {
 //       becomes available after coordination step 5 repeats.
 //
 //    e. If another worker (or iree_task_executor_flush) is already wearing the
-//       coordinator hat then the worker will go to sleep.
+//       coordinator hat then the worker will go to sleep. Coordination never
+//       blocks: the request is recorded and the active coordinator runs again
+//       to pick up anything that arrived while it held the hat.
 //
 //==============================================================================
 // Scaling Down
@@ -285,24 +297,62 @@ enum iree_task_scheduling_mode_bits_t {
 };
 typedef uint32_t iree_task_scheduling_mode_t;
 
+// Flags controlling how worker local memory is allocated.
+enum iree_task_local_memory_flag_bits_t {
+  IREE_TASK_LOCAL_MEMORY_FLAG_NONE = 0u,
+
+  // Backs large worker local memory blocks with huge pages where supported
+  // (transparent huge pages on Linux). Reduces TLB misses in dispatches that
+  // stream through large amounts of workgroup local memory. Ignored on
+  // platforms without support.
+  IREE_TASK_LOCAL_MEMORY_FLAG_HUGE_PAGES = 1u << 0,
+};
+typedef uint32_t iree_task_local_memory_flags_t;
+
+// Options controlling executor behavior.
+typedef struct iree_task_executor_options_t {
+  // Specifies the schedule mode used for worker and workload balancing.
+  iree_task_scheduling_mode_t scheduling_mode;
+
+  // Defines the bytes to be allocated and reserved up front for each worker to
+  // use for local memory operations. Will be rounded up to the next power of
+  // two. Each worker keeps a persistent block that grows on demand to the
+  // largest amount requested by any dispatch it executes and is never shrunk,
+  // so reserving the expected high-water mark here avoids growth during
+  // execution. May be 0 to allocate only when first required.
+  iree_host_size_t worker_local_memory_size;
+
+  // Controls how worker local memory is allocated.
+  iree_task_local_memory_flags_t worker_local_memory_flags;
+
+  // Maximum duration in nanoseconds each worker should spin waiting for
+  // additional work when it runs out before parking on its wake notification.
+  // Spinning burns CPU time (with processor pause hints) but avoids the kernel
+  // wake latency when work arrives shortly after a worker goes idle, such as
+  // with pipelined dispatches in small models. 0 parks immediately.
+  iree_duration_t worker_spin_ns;
+} iree_task_executor_options_t;
+
+// Initializes |out_options| to its default values.
+void iree_task_executor_options_initialize(
+    iree_task_executor_options_t* out_options);
+
 // Base task system executor interface.
 typedef struct iree_task_executor_t iree_task_executor_t;
 
-// Creates a task executor using the specified topology.
+// Creates a task executor using the specified topology and |options|.
 //
-// |worker_local_memory_size| defines the bytes to be allocated and reserved for
-// each worker to use for local memory operations. Will be rounded up to the
-// next power of two. Dispatches performed will be able to request up to this
-// amount of memory for their invocations and no more. May be 0 if no worker
-// local memory is required.
+// If |topology| has no groups then the executor is created in caller-only
+// mode: no worker threads are created and all work is performed by threads
+// donated with iree_task_executor_donate_caller. This avoids context switches
+// and wakeups when the submitting thread would have waited anyway.
 //
 // |topology| is only used during creation and need not live beyond this call.
 // |out_executor| must be released by the caller.
-iree_status_t iree_task_executor_create(
-    iree_task_scheduling_mode_t scheduling_mode,
-    const iree_task_topology_t* topology,
-    iree_host_size_t worker_local_memory_size, iree_allocator_t allocator,
-    iree_task_executor_t** out_executor);
+iree_status_t iree_task_executor_create(iree_task_executor_options_t options,
+                                        const iree_task_topology_t* topology,
+                                        iree_allocator_t allocator,
+                                        iree_task_executor_t** out_executor);
 
 // Retains the given |executor| for the caller.
 void iree_task_executor_retain(iree_task_executor_t* executor);
@@ -313,11 +363,99 @@ void iree_task_executor_release(iree_task_executor_t* executor);
 // Trims pools and caches used by the executor and its workers.
 void iree_task_executor_trim(iree_task_executor_t* executor);
 
-// Returns the number of live workers usable by the executor.
-// The actual number used for any particular operation is dynamic.
+// Returns the total number of workers owned by the executor.
+// The actual number used for any particular operation is dynamic; see
+// iree_task_executor_active_worker_count.
 iree_host_size_t iree_task_executor_worker_count(
     iree_task_executor_t* executor);
 
+// Returns the number of workers that new work is scheduled on.
+iree_host_size_t iree_task_executor_active_worker_count(
+    iree_task_executor_t* executor);
+
+// Sets the number of workers that new work is scheduled on to workers
+// [0, |active_worker_count|). Must be between 1 and the total worker count.
+// Inactive workers finish any tasks already posted to them and then park, no
+// longer stealing work from others, until they are made active again. Tasks
+// with an affinity for only inactive workers run on an active worker instead.
+//
+// This is intended for adapting to changes in the processors available to the
+// process at runtime such as a container CPU quota being resized. Workers will
+// also reapply their thread affinity the next time they wake in case
+// processors were brought online or offline.
+//
+// May be called from any thread.
+iree_status_t iree_task_executor_set_active_worker_count(
+    iree_task_executor_t* executor, iree_host_size_t active_worker_count);
+
+// Queries the CPU limits currently imposed on the process (see
+// iree_task_topology_cpu_limits_query) and sets the active worker count to the
+// number of workers that can run concurrently under them.
+//
+// May be called from any thread.
+iree_status_t iree_task_executor_refresh_cpu_limits(
+    iree_task_executor_t* executor);
+
+// Returns true if the executor has no worker threads of its own and will only
+// make progress when threads are donated to it with
+// iree_task_executor_donate_caller.
+bool iree_task_executor_is_caller_only(iree_task_executor_t* executor);
+
+// Scheduling statistics for a single worker.
+// All values are cumulative since the executor was created.
+typedef struct iree_task_worker_statistics_t {
+  // Total number of tasks executed by the worker. Dispatch shards that yield
+  // to higher priority work are counted each time they are executed.
+  uint64_t task_count;
+  // Total number of dispatch tiles executed by the worker.
+  uint64_t tile_count;
+  // Number of times the worker ran out of work and tried to steal from others.
+  uint64_t steal_attempt_count;
+  // Number of steal attempts that found work.
+  uint64_t steal_success_count;
+  // Total time spent trying to steal work, successful or not.
+  iree_duration_t steal_duration_ns;
+  // Number of times the worker went idle and was woken to check for work.
+  uint64_t wake_count;
+  // Total time spent idle (spinning or parked) waiting for work.
+  iree_duration_t idle_duration_ns;
+} iree_task_worker_statistics_t;
+
+// Scheduling statistics for an executor.
+// All values are cumulative since the executor was created.
+typedef struct iree_task_executor_statistics_t {
+  // Total number of workers in the executor.
+  iree_host_size_t worker_count;
+  // Sum of the statistics of all workers.
+  iree_task_worker_statistics_t worker_totals;
+  // Total number of tasks executed by threads donated to the executor while
+  // they were stealing from workers.
+  uint64_t donated_task_count;
+  // Number of coordination passes performed by any thread.
+  uint64_t coordination_count;
+  // Number of coordination requests handed off to another thread that was
+  // already coordinating.
+  uint64_t coordination_deferred_count;
+  // Total time spent coordinating.
+  iree_duration_t coordination_duration_ns;
+} iree_task_executor_statistics_t;
+
+// Queries the scheduling statistics of the |executor|.
+// Statistics are always available and updated by workers with relaxed atomics
+// such that they are cheap to maintain; values may be slightly stale and are
+// not consistent with each other when queried while tasks are in-flight.
+//
+// If |out_worker_statistics| is provided it must have room for at least
+// |worker_capacity| workers and will receive the statistics of each worker.
+// Fails with IREE_STATUS_OUT_OF_RANGE if the capacity is insufficient; the
+// required count is available in |out_statistics|->worker_count.
+//
+// Safe to call from any thread.
+iree_status_t iree_task_executor_query_statistics(
+    iree_task_executor_t* executor, iree_host_size_t worker_capacity,
+    iree_task_worker_statistics_t* out_worker_statistics,
+    iree_task_executor_statistics_t* out_statistics);
+
 // Returns an iree_event_t pool managed by the executor.
 // Users of the task system should acquire their transient events from this.
 // Long-lived events should be allocated on their own in order to avoid
@@ -340,8 +478,9 @@ iree_status_t iree_task_executor_acquire_fence(iree_task_executor_t* executor,
 // submission unless tasks have a custom pool specified that they can be
 // returned to.
 //
-// Safe to call from any thread. Wait-free but may block for a small duration
-// during initial scheduling of the submitted tasks.
+// Safe to call from any thread. Lock-free: ready tasks are scheduled from the
+// calling thread and posted directly to the workers that will execute them and
+// may begin executing immediately without a flush.
 //
 // NOTE: it's possible for all work in the submission to complete prior to this
 // function returning.
@@ -350,8 +489,9 @@ void iree_task_executor_submit(iree_task_executor_t* executor,
 
 // Flushes any pending task batches for execution.
 //
-// Safe to call from any thread. Wait-free but may block for a small duration
-// during initial scheduling of the submitted tasks.
+// Safe to call from any thread. Never blocks on other threads: if another
+// thread is already coordinating then it will pick up the pending batches on
+// behalf of the caller.
 //
 // NOTE: due to races it's possible for new work to arrive from other threads
 // after the flush has occurred but prior to this call returning.
@@ -361,10 +501,17 @@ void iree_task_executor_flush(iree_task_executor_t* executor);
 // resolves or |timeout| is exceeded. Flushes any pending task batches prior
 // to doing any work or waiting.
 //
-// If there are no tasks available then the calling thread will block as if
-// iree_wait_source_wait_one had been used on |wait_source|. If tasks are ready
-// then the caller will not block prior to starting to perform work on behalf of
-// the executor.
+// While the wait source is unresolved the calling thread joins the workers and
+// steals tasks from them to execute itself. If there are no tasks available
+// then the calling thread will block as if iree_wait_source_wait_one had been
+// used on |wait_source|, periodically waking to check for more work to steal.
+// If tasks are ready then the caller will not block prior to starting to
+// perform work on behalf of the executor. Caller-only executors perform all of
+// their work this way.
+//
+// Tasks executed on the calling thread run on its stack with the FPU state
+// configured as on workers. Callers on threads with small stacks should use
+// iree_wait_source_wait_one instead.
 //
 // Donation is intended as an optimization to elide context switches when the
 // caller would have waited anyway; now instead of performing a kernel wait and
@@ -0,0 +1,87 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+#include "iree/base/api.h"
+#include "iree/task/api.h"
+
+namespace {
+
+// Number of worker threads in the shared executor. Fixed so that results are
+// comparable across machines with different core counts.
+constexpr iree_host_size_t kWorkerCount = 8;
+
+// Returns an executor shared across all benchmark threads.
+// Creating an executor per thread would measure executor startup and remove the
+// very contention on the submission path we are trying to observe.
+iree_task_executor_t* SharedExecutor() {
+  static iree_task_executor_t* executor = ([]() -> iree_task_executor_t* {
+    iree_task_topology_t topology;
+    iree_task_topology_initialize_from_group_count(kWorkerCount, &topology);
+    iree_task_executor_options_t options;
+    iree_task_executor_options_initialize(&options);
+    iree_task_executor_t* executor = NULL;
+    IREE_CHECK_OK(iree_task_executor_create(
+        options, &topology, iree_allocator_system(), &executor));
+    iree_task_topology_deinitialize(&topology);
+    return executor;
+  })();
+  return executor;
+}
+
+iree_status_t NopCall(void* user_context, iree_task_t* task,
+                      iree_task_submission_t* pending_submission) {
+  return iree_ok_status();
+}
+
+//==============================================================================
+// iree_task_executor_submit + iree_task_executor_flush
+//==============================================================================
+
+// Each benchmark thread acts as an independent producer (like a HAL queue
+// submitting from a request thread) with its own scope. Every iteration submits
+// a batch of independent calls and waits for them to complete so that the
+// number of tasks in flight is bounded and reported rates are sustainable.
+void BM_SubmitCalls(benchmark::State& state) {
+  iree_task_executor_t* executor = SharedExecutor();
+  const iree_host_size_t batch_size = (iree_host_size_t)state.range(0);
+
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("producer"), &scope);
+  iree_task_call_t* calls = new iree_task_call_t[batch_size];
+
+  for (auto _ : state) {
+    iree_task_fence_t* fence = NULL;
+    IREE_CHECK_OK(iree_task_executor_acquire_fence(executor, &scope, &fence));
+    iree_task_submission_t submission;
+    iree_task_submission_initialize(&submission);
+    for (iree_host_size_t i = 0; i < batch_size; ++i) {
+      iree_task_call_initialize(&scope,
+                                iree_task_make_call_closure(NopCall, NULL),
+                                &calls[i]);
+      iree_task_set_completion_task(&calls[i].header, &fence->header);
+      iree_task_submission_enqueue(&submission, &calls[i].header);
+    }
+    iree_task_executor_submit(executor, &submission);
+    iree_task_executor_flush(executor);
+    IREE_CHECK_OK(iree_task_scope_wait_idle(&scope, IREE_TIME_INFINITE_FUTURE));
+  }
+  state.SetItemsProcessed(state.iterations() * batch_size);
+
+  delete[] calls;
+  iree_task_scope_deinitialize(&scope);
+}
+BENCHMARK(BM_SubmitCalls)
+    ->Arg(1)
+    ->Arg(16)
+    ->UseRealTime()
+    ->ThreadRange(1, 32)
+    ->Threads(48)
+    ->Threads(64);
+
+}  // namespace
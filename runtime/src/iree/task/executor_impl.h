@@ -15,6 +15,7 @@
 #include "iree/task/affinity_set.h"
 #include "iree/task/executor.h"
 #include "iree/task/list.h"
+#include "iree/task/local_memory.h"
 #include "iree/task/poller.h"
 #include "iree/task/pool.h"
 #include "iree/task/post_batch.h"
@@ -34,6 +35,10 @@ struct iree_task_executor_t {
   // TODO(benvanik): make mutable; currently always the same reserved value.
   iree_task_scheduling_mode_t scheduling_mode;
 
+  // Maximum duration workers spin waiting for work before parking.
+  // See iree_task_executor_options_t::worker_spin_ns.
+  iree_duration_t worker_spin_ns;
+
   // State used by the work-stealing operations performed by donated threads.
   // This is **NOT SYNCHRONIZED** and relies on the fact that we actually don't
   // much care about the precise selection of workers enough to mind any tears
@@ -79,6 +84,11 @@ struct iree_task_executor_t {
   // coordinator.
   iree_slim_mutex_t coordinator_mutex;
 
+  // Set when a thread requests coordination. Threads that find another acting
+  // as the coordinator leave this set instead of blocking on the
+  // coordinator_mutex and the active coordinator runs again before returning.
+  iree_atomic_int32_t coordination_requested;
+
   // Wait task polling and wait thread manager.
   // This handles all system waits so that we can keep the syscalls off the
   // worker threads and lower wake latencies (the wait thread can enqueue
@@ -86,12 +96,23 @@ struct iree_task_executor_t {
   // existing computation on the workers to finish).
   iree_task_poller_t poller;
 
+  // Measured tile costs of dispatches keyed by iree_task_dispatch_t::cost_key.
+  // See iree_task_executor_lookup_dispatch_cost.
+  iree_task_dispatch_cost_t
+      dispatch_costs[IREE_TASK_DISPATCH_COST_CACHE_CAPACITY];
+
   // A bitset indicating which workers are live and usable; all attempts to
   // push work onto a particular worker should check first with this mask. This
   // may change over time either automatically or by user request ("don't use
   // these cores for awhile I'm going to be using them" etc).
   iree_atomic_task_affinity_set_t worker_live_mask;
 
+  // Incremented each time the set of live workers or the processors available
+  // to the process may have changed. Workers compare against the last value
+  // they observed upon waking and reapply their thread affinity when it
+  // differs.
+  iree_atomic_int32_t worker_affinity_epoch;
+
   // A bitset indicating which workers may be suspended and need to be resumed
   // via iree_thread_resume prior to them being able to execute work.
   iree_atomic_task_affinity_set_t worker_suspend_mask;
@@ -102,6 +123,31 @@ struct iree_task_executor_t {
   // on already woken workers.
   iree_atomic_task_affinity_set_t worker_idle_mask;
 
+  // True if the executor has no worker threads of its own. A single caller
+  // worker holds the task queues and is only pumped by threads donated with
+  // iree_task_executor_donate_caller.
+  bool caller_only;
+
+  // Held by the donated thread currently pumping the caller worker in
+  // caller-only mode or stealing work from the workers otherwise. The worker
+  // (and donation local memory) can only be used by one thread at a time and
+  // other donated threads wait until it is released.
+  iree_slim_mutex_t donation_mutex;
+
+  // Local memory used by tasks executed on donated threads when the executor
+  // has worker threads. Reserved to match the worker local memory, grown on
+  // demand like it, and only used while holding the donation_mutex.
+  iree_task_local_memory_t donation_local_memory;
+
+  // Statistics counters reported by iree_task_executor_query_statistics.
+  // donated_task_count is only updated while holding the donation_mutex and
+  // the coordination counters while holding the coordinator_mutex; all other
+  // threads only ever read them.
+  iree_atomic_int64_t donated_task_count;
+  iree_atomic_int64_t coordination_count;
+  iree_atomic_int64_t coordination_deferred_count;
+  iree_atomic_int64_t coordination_duration_ns;
+
   // Specifies how many workers threads there are.
   // For now this number is fixed per executor however if we wanted to enable
   // live join/leave behavior we could change this to a registration mechanism.
@@ -135,14 +181,38 @@ void iree_task_executor_schedule_ready_tasks(
 void iree_task_executor_coordinate(iree_task_executor_t* executor,
                                    iree_task_worker_t* current_worker);
 
+// Returns the dispatch cost tracking entry for |key|.
+// If the entry was previously assigned to another key it is reassigned and its
+// measured cost is reset.
+//
+// May be called from any thread.
+iree_task_dispatch_cost_t* iree_task_executor_lookup_dispatch_cost(
+    iree_task_executor_t* executor, uint64_t key);
+
+// Adds |delta| to a statistics |counter| with a single writer.
+// Avoids the cost of an atomic read-modify-write while still allowing readers
+// on other threads to observe the value without tearing.
+static inline void iree_task_statistics_counter_add(
+    iree_atomic_int64_t* counter, int64_t delta) {
+  iree_atomic_store_int64(
+      counter,
+      iree_atomic_load_int64(counter, iree_memory_order_relaxed) + delta,
+      iree_memory_order_relaxed);
+}
+
 // Tries to steal an entire task from a sibling worker (based on topology).
 // Returns a task that is available (has not yet begun processing at all).
-// May steal multiple tasks and add them to the |local_task_queue|.
+// May steal multiple tasks and add them to the |local_task_queues| (one per
+// iree_task_priority_t) based on their priority.
+//
+// Workers in |constructive_sharing_mask| are tried first, then those on the
+// same NUMA node in |node_sharing_mask|, and finally all others.
 iree_task_t* iree_task_executor_try_steal_task(
     iree_task_executor_t* executor,
     iree_task_affinity_set_t constructive_sharing_mask,
+    iree_task_affinity_set_t node_sharing_mask,
     uint32_t max_theft_attempts, iree_prng_minilcg128_state_t* theft_prng,
-    iree_task_queue_t* local_task_queue);
+    iree_task_queue_t* local_task_queues);
 
 #ifdef __cplusplus
 }  // extern "C"
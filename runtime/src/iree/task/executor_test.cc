@@ -13,6 +13,10 @@
 
 namespace {
 
+using iree::Status;
+using iree::StatusCode;
+using iree::testing::status::StatusIs;
+
 // Tests that an executor can be created and destroyed repeatedly without
 // running out of system resources. Since all systems are different there's no
 // guarantee this will fail but it does give ASAN/TSAN some nice stuff to chew
@@ -23,12 +27,11 @@ TEST(ExecutorTest, Lifetime) {
 
   for (int i = 0; i < 100; ++i) {
     iree_task_executor_t* executor = NULL;
-    iree_task_scheduling_mode_t scheduling_mode =
-        IREE_TASK_SCHEDULING_MODE_RESERVED;
-    iree_host_size_t worker_local_memory_size = 64 * 1024;
+    iree_task_executor_options_t options;
+    iree_task_executor_options_initialize(&options);
+    options.worker_local_memory_size = 64 * 1024;
     IREE_ASSERT_OK(iree_task_executor_create(
-        scheduling_mode, &topology, worker_local_memory_size,
-        iree_allocator_system(), &executor));
+        options, &topology, iree_allocator_system(), &executor));
     // -- idle --
     iree_task_executor_release(executor);
   }
@@ -44,12 +47,11 @@ TEST(ExecutorTest, LifetimeStress) {
 
   for (int i = 0; i < 100; ++i) {
     iree_task_executor_t* executor = NULL;
-    iree_task_scheduling_mode_t scheduling_mode =
-        IREE_TASK_SCHEDULING_MODE_RESERVED;
-    iree_host_size_t worker_local_memory_size = 64 * 1024;
+    iree_task_executor_options_t options;
+    iree_task_executor_options_initialize(&options);
+    options.worker_local_memory_size = 64 * 1024;
     IREE_ASSERT_OK(iree_task_executor_create(
-        scheduling_mode, &topology, worker_local_memory_size,
-        iree_allocator_system(), &executor));
+        options, &topology, iree_allocator_system(), &executor));
     iree_task_scope_t scope;
     iree_task_scope_initialize(iree_make_cstring_view("scope"), &scope);
 
@@ -87,17 +89,17 @@ TEST(ExecutorTest, LifetimeStress) {
   iree_task_topology_deinitialize(&topology);
 }
 
-// Tests heavily serialized submission to an executor.
-// This puts pressure on the overheads involved in spilling up threads.
-TEST(ExecutorTest, SubmissionStress) {
+// Performs heavily serialized submission to an executor with workers that
+// spin for |worker_spin_ns| before parking.
+static void RunSubmissionStress(iree_duration_t worker_spin_ns) {
   iree_task_topology_t topology;
   iree_task_topology_initialize_from_group_count(/*group_count=*/4, &topology);
   iree_task_executor_t* executor = NULL;
-  iree_task_scheduling_mode_t scheduling_mode =
-      IREE_TASK_SCHEDULING_MODE_RESERVED;
-  iree_host_size_t worker_local_memory_size = 64 * 1024;
-  IREE_ASSERT_OK(iree_task_executor_create(scheduling_mode, &topology,
-                                           worker_local_memory_size,
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  options.worker_local_memory_size = 64 * 1024;
+  options.worker_spin_ns = worker_spin_ns;
+  IREE_ASSERT_OK(iree_task_executor_create(options, &topology,
                                            iree_allocator_system(), &executor));
   iree_task_scope_t scope;
   iree_task_scope_initialize(iree_make_cstring_view("scope"), &scope);
@@ -136,4 +138,188 @@ TEST(ExecutorTest, SubmissionStress) {
   iree_task_topology_deinitialize(&topology);
 }
 
+// Tests heavily serialized submission to an executor.
+// This puts pressure on the overheads involved in spilling up threads.
+TEST(ExecutorTest, SubmissionStress) {
+  RunSubmissionStress(/*worker_spin_ns=*/0);
+}
+
+// Tests heavily serialized submission to an executor whose workers spin before
+// parking such that most submissions should land while workers are spinning.
+TEST(ExecutorTest, SubmissionStressSpinning) {
+  RunSubmissionStress(/*worker_spin_ns=*/100 * 1000);
+}
+
+// Tests that a caller-only executor (no worker threads) makes progress when
+// the submitting thread donates itself.
+TEST(ExecutorTest, CallerOnly) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize(&topology);
+  iree_task_executor_t* executor = NULL;
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  options.worker_local_memory_size = 64 * 1024;
+  IREE_ASSERT_OK(iree_task_executor_create(options, &topology,
+                                           iree_allocator_system(), &executor));
+  EXPECT_TRUE(iree_task_executor_is_caller_only(executor));
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("scope"), &scope);
+
+  for (int i = 0; i < 100; ++i) {
+    static std::atomic<int> received_value = {0};
+    iree_task_call_t call;
+    iree_task_call_initialize(
+        &scope,
+        iree_task_make_call_closure(
+            [](void* user_context, iree_task_t* task,
+               iree_task_submission_t* pending_submission) {
+              received_value = (int)(uintptr_t)user_context;
+              return iree_ok_status();
+            },
+            (void*)(uintptr_t)i),
+        &call);
+
+    iree_task_fence_t* fence = NULL;
+    IREE_ASSERT_OK(iree_task_executor_acquire_fence(executor, &scope, &fence));
+    iree_task_set_completion_task(&call.header, &fence->header);
+
+    iree_task_submission_t submission;
+    iree_task_submission_initialize(&submission);
+    iree_task_submission_enqueue(&submission, &call.header);
+    iree_task_executor_submit(executor, &submission);
+    IREE_ASSERT_OK(iree_task_executor_donate_caller(
+        executor, iree_task_scope_await_idle(&scope),
+        iree_infinite_timeout()));
+
+    EXPECT_EQ(received_value, i) << "call did not correlate to loop";
+  }
+
+  iree_task_scope_deinitialize(&scope);
+  iree_task_executor_release(executor);
+  iree_task_topology_deinitialize(&topology);
+}
+
+// Tests that a thread donated to an executor with workers can join the workers
+// in processing a dispatch and returns once the work has completed.
+TEST(ExecutorTest, DonateCallerDispatch) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_group_count(/*group_count=*/4, &topology);
+  iree_task_executor_t* executor = NULL;
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  options.worker_local_memory_size = 64 * 1024;
+  IREE_ASSERT_OK(iree_task_executor_create(options, &topology,
+                                           iree_allocator_system(), &executor));
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("scope"), &scope);
+
+  for (int i = 0; i < 100; ++i) {
+    static std::atomic<int> tile_count = {0};
+    tile_count = 0;
+    const uint32_t workgroup_size[3] = {1, 1, 1};
+    const uint32_t workgroup_count[3] = {64, 4, 1};
+    iree_task_dispatch_t dispatch;
+    iree_task_dispatch_initialize(
+        &scope,
+        iree_task_make_dispatch_closure(
+            [](void* user_context, const iree_task_tile_context_t* tile_context,
+               iree_task_submission_t* pending_submission) {
+              ++tile_count;
+              return iree_ok_status();
+            },
+            NULL),
+        workgroup_size, workgroup_count, &dispatch);
+
+    iree_task_fence_t* fence = NULL;
+    IREE_ASSERT_OK(iree_task_executor_acquire_fence(executor, &scope, &fence));
+    iree_task_set_completion_task(&dispatch.header, &fence->header);
+
+    iree_task_submission_t submission;
+    iree_task_submission_initialize(&submission);
+    iree_task_submission_enqueue(&submission, &dispatch.header);
+    iree_task_executor_submit(executor, &submission);
+    IREE_ASSERT_OK(iree_task_executor_donate_caller(
+        executor, iree_task_scope_await_idle(&scope),
+        iree_infinite_timeout()));
+
+    EXPECT_EQ(tile_count, 64 * 4);
+  }
+
+  iree_task_scope_deinitialize(&scope);
+  iree_task_executor_release(executor);
+  iree_task_topology_deinitialize(&topology);
+}
+
+// Tests that the active worker set can be shrunk and grown at runtime and that
+// inactive workers are not given any new work.
+TEST(ExecutorTest, ActiveWorkerCount) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_group_count(/*group_count=*/4, &topology);
+  iree_task_executor_t* executor = NULL;
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  IREE_ASSERT_OK(iree_task_executor_create(options, &topology,
+                                           iree_allocator_system(), &executor));
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("scope"), &scope);
+
+  EXPECT_EQ(4, iree_task_executor_active_worker_count(executor));
+  EXPECT_THAT(Status(iree_task_executor_set_active_worker_count(executor, 0)),
+              StatusIs(StatusCode::kOutOfRange));
+  EXPECT_THAT(Status(iree_task_executor_set_active_worker_count(executor, 5)),
+              StatusIs(StatusCode::kOutOfRange));
+
+  static std::atomic<int> tile_count = {0};
+  auto run_dispatch = [&]() {
+    tile_count = 0;
+    const uint32_t workgroup_size[3] = {1, 1, 1};
+    const uint32_t workgroup_count[3] = {64, 4, 1};
+    iree_task_dispatch_t dispatch;
+    iree_task_dispatch_initialize(
+        &scope,
+        iree_task_make_dispatch_closure(
+            [](void* user_context, const iree_task_tile_context_t* tile_context,
+               iree_task_submission_t* pending_submission) {
+              ++tile_count;
+              return iree_ok_status();
+            },
+            NULL),
+        workgroup_size, workgroup_count, &dispatch);
+    iree_task_fence_t* fence = NULL;
+    IREE_ASSERT_OK(iree_task_executor_acquire_fence(executor, &scope, &fence));
+    iree_task_set_completion_task(&dispatch.header, &fence->header);
+    iree_task_submission_t submission;
+    iree_task_submission_initialize(&submission);
+    iree_task_submission_enqueue(&submission, &dispatch.header);
+    iree_task_executor_submit(executor, &submission);
+    iree_task_executor_flush(executor);
+    IREE_ASSERT_OK(
+        iree_task_scope_wait_idle(&scope, IREE_TIME_INFINITE_FUTURE));
+    EXPECT_EQ(tile_count, 64 * 4);
+  };
+
+  // Only the first two workers should receive or steal shards.
+  IREE_ASSERT_OK(iree_task_executor_set_active_worker_count(executor, 2));
+  EXPECT_EQ(2, iree_task_executor_active_worker_count(executor));
+  for (int i = 0; i < 10; ++i) run_dispatch();
+  iree_task_worker_statistics_t worker_statistics[4];
+  iree_task_executor_statistics_t statistics;
+  IREE_ASSERT_OK(iree_task_executor_query_statistics(
+      executor, IREE_ARRAYSIZE(worker_statistics), worker_statistics,
+      &statistics));
+  EXPECT_EQ(10 * 64 * 4, worker_statistics[0].tile_count +
+                             worker_statistics[1].tile_count);
+  EXPECT_EQ(0, worker_statistics[2].tile_count);
+  EXPECT_EQ(0, worker_statistics[3].tile_count);
+
+  // Growing back should still complete all work.
+  IREE_ASSERT_OK(iree_task_executor_set_active_worker_count(executor, 4));
+  EXPECT_EQ(4, iree_task_executor_active_worker_count(executor));
+  run_dispatch();
+
+  iree_task_scope_deinitialize(&scope);
+  iree_task_executor_release(executor);
+  iree_task_topology_deinitialize(&topology);
+}
+
 }  // namespace
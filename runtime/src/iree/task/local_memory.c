@@ -0,0 +1,112 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/task/local_memory.h"
+
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/math.h"
+#include "iree/base/tracing.h"
+#include "iree/task/tuning.h"
+
+#if defined(IREE_PLATFORM_ANDROID) || defined(IREE_PLATFORM_LINUX)
+#include <sys/mman.h>
+#if defined(MADV_HUGEPAGE)
+#define IREE_TASK_LOCAL_MEMORY_HAVE_HUGE_PAGES 1
+#endif  // MADV_HUGEPAGE
+#endif  // IREE_PLATFORM_ANDROID || IREE_PLATFORM_LINUX
+
+void iree_task_local_memory_initialize(iree_task_local_memory_flags_t flags,
+                                       iree_allocator_t allocator,
+                                       iree_task_local_memory_t* out_memory) {
+  memset(out_memory, 0, sizeof(*out_memory));
+  out_memory->allocator = allocator;
+  out_memory->flags = flags;
+}
+
+static void iree_task_local_memory_release(iree_task_local_memory_t* memory) {
+  if (!memory->data) return;
+#if defined(IREE_TASK_LOCAL_MEMORY_HAVE_HUGE_PAGES)
+  if (memory->is_mapped) {
+    munmap(memory->data, memory->capacity);
+  } else {
+    iree_allocator_free_aligned(memory->allocator, memory->data);
+  }
+#else
+  iree_allocator_free_aligned(memory->allocator, memory->data);
+#endif  // IREE_TASK_LOCAL_MEMORY_HAVE_HUGE_PAGES
+  memory->data = NULL;
+  memory->capacity = 0;
+  memory->is_mapped = false;
+}
+
+void iree_task_local_memory_deinitialize(iree_task_local_memory_t* memory) {
+  iree_task_local_memory_release(memory);
+}
+
+#if defined(IREE_TASK_LOCAL_MEMORY_HAVE_HUGE_PAGES)
+// Maps |capacity| bytes (a multiple of the huge page size) and requests
+// transparent huge pages. The mapping is touched by the calling thread to fault
+// in the pages. Returns NULL if the mapping could not be created.
+static void* iree_task_local_memory_map_huge_pages(iree_host_size_t capacity) {
+  void* data = mmap(NULL, capacity, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) return NULL;
+  // Advisory only: if huge pages are unavailable we still have regular pages.
+  madvise(data, capacity, MADV_HUGEPAGE);
+  memset(data, 0, capacity);
+  return data;
+}
+#endif  // IREE_TASK_LOCAL_MEMORY_HAVE_HUGE_PAGES
+
+iree_status_t iree_task_local_memory_reserve(iree_task_local_memory_t* memory,
+                                             iree_host_size_t minimum_size) {
+  if (minimum_size <= memory->capacity) return iree_ok_status();
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (int64_t)minimum_size);
+
+  // Grow geometrically so that dispatches with slowly increasing requirements
+  // don't reallocate each time.
+  iree_host_size_t capacity =
+      (iree_host_size_t)iree_math_round_up_to_pow2_u64(minimum_size);
+  capacity = iree_max(capacity, iree_hardware_destructive_interference_size);
+
+  // Contents need not be preserved so the old block is dropped first to avoid
+  // having both live at the high-water mark.
+  iree_task_local_memory_release(memory);
+
+#if defined(IREE_TASK_LOCAL_MEMORY_HAVE_HUGE_PAGES)
+  if (iree_any_bit_set(memory->flags, IREE_TASK_LOCAL_MEMORY_FLAG_HUGE_PAGES) &&
+      capacity >= IREE_TASK_LOCAL_MEMORY_HUGE_PAGE_SIZE) {
+    void* data = iree_task_local_memory_map_huge_pages(capacity);
+    if (data) {
+      memory->data = (uint8_t*)data;
+      memory->capacity = capacity;
+      memory->is_mapped = true;
+      IREE_TRACE_ZONE_END(z0);
+      return iree_ok_status();
+    }
+    // Fall back to the allocator below.
+  }
+#endif  // IREE_TASK_LOCAL_MEMORY_HAVE_HUGE_PAGES
+
+  // Aligned allocations are zeroed which touches the pages from this thread.
+  void* data = NULL;
+  iree_status_t status = iree_allocator_malloc_aligned(
+      memory->allocator, capacity, iree_hardware_destructive_interference_size,
+      /*offset=*/0, &data);
+  if (iree_status_is_ok(status)) {
+    memory->data = (uint8_t*)data;
+    memory->capacity = capacity;
+  } else {
+    status = iree_status_annotate_f(
+        status, "growing worker local memory to %" PRIhsz " bytes", capacity);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
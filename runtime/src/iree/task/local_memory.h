@@ -0,0 +1,73 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_TASK_LOCAL_MEMORY_H_
+#define IREE_TASK_LOCAL_MEMORY_H_
+
+#include <stdbool.h>
+
+#include "iree/base/api.h"
+#include "iree/task/executor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Persistent scratch memory owned by a single thread and handed to dispatch
+// tiles as their workgroup local memory.
+//
+// The block grows to the high-water mark of all dispatches executed and is
+// never shrunk so that steady-state execution performs no allocations. Growth
+// happens on the owning thread so that on systems with first-touch page
+// placement the pages reside on the NUMA node of that thread.
+//
+// Thread-compatible; only the owning thread may acquire memory.
+typedef struct iree_task_local_memory_t {
+  // Allocator used for the block when not mapped directly from the system.
+  iree_allocator_t allocator;
+  iree_task_local_memory_flags_t flags;
+
+  // Base of the block aligned to iree_hardware_destructive_interference_size.
+  uint8_t* data;
+  // Total capacity of the block in bytes.
+  iree_host_size_t capacity;
+  // True if the block was mapped from the system to use huge pages.
+  bool is_mapped;
+} iree_task_local_memory_t;
+
+// Initializes an empty local memory block. No memory is allocated until the
+// first call to iree_task_local_memory_reserve or
+// iree_task_local_memory_acquire.
+void iree_task_local_memory_initialize(iree_task_local_memory_flags_t flags,
+                                       iree_allocator_t allocator,
+                                       iree_task_local_memory_t* out_memory);
+
+// Releases the block; it must not be in use by any tile.
+void iree_task_local_memory_deinitialize(iree_task_local_memory_t* memory);
+
+// Grows the block such that at least |minimum_size| bytes are available.
+// Existing contents are not preserved. Newly allocated memory is touched by the
+// calling thread.
+iree_status_t iree_task_local_memory_reserve(iree_task_local_memory_t* memory,
+                                             iree_host_size_t minimum_size);
+
+// Returns a span of exactly |size| bytes of local memory, growing the block
+// first if required. Contents are undefined.
+static inline iree_status_t iree_task_local_memory_acquire(
+    iree_task_local_memory_t* memory, iree_host_size_t size,
+    iree_byte_span_t* out_span) {
+  if (IREE_UNLIKELY(size > memory->capacity)) {
+    IREE_RETURN_IF_ERROR(iree_task_local_memory_reserve(memory, size));
+  }
+  *out_span = iree_make_byte_span(memory->data, size);
+  return iree_ok_status();
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_TASK_LOCAL_MEMORY_H_
@@ -0,0 +1,677 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/task/loop.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "iree/base/internal/atomics.h"
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/task/scope.h"
+#include "iree/task/submission.h"
+#include "iree/task/task.h"
+#include "iree/task/tuning.h"
+
+typedef struct iree_task_loop_wait_op_t iree_task_loop_wait_op_t;
+
+struct iree_task_loop_t {
+  iree_allocator_t allocator;
+  iree_task_executor_t* executor;
+
+  // Optional handler receiving errors returned from callbacks.
+  iree_task_loop_error_fn_t error_fn;
+  void* error_user_data;
+
+  // Scope all loop tasks are attributed to and used to track loop idleness.
+  // Each pending operation holds a begin/end pair on the scope. Tasks never
+  // report failures to the scope and instead route them through the loop so
+  // that the loop can recover once drained.
+  iree_task_scope_t scope;
+
+  // Set when the loop aborts and cleared once the loop has drained. All
+  // operations that run while set are aborted.
+  iree_atomic_int32_t aborted;
+
+  // Guards |wait_list_head| and the cancellation flags of the waits in it.
+  iree_slim_mutex_t mutex;
+  // Doubly-linked list of all pending wait operations so that they can be
+  // cancelled when the loop aborts.
+  iree_task_loop_wait_op_t* wait_list_head;
+};
+
+// Aborts all operations pending in the loop.
+static void iree_task_loop_abort(iree_task_loop_t* task_loop);
+
+// Routes |status| to the loop error handler and aborts pending operations.
+static void iree_task_loop_emit_error(iree_task_loop_t* task_loop,
+                                      iree_status_t status) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_TEXT(
+      z0, iree_status_code_string(iree_status_code(status)));
+
+  if (task_loop->error_fn) {
+    task_loop->error_fn(task_loop->error_user_data, status);
+  } else {
+    iree_status_ignore(status);
+  }
+
+  iree_task_loop_abort(task_loop);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Submits |task| and any tasks it enqueues to the executor.
+static void iree_task_loop_submit(iree_task_loop_t* task_loop,
+                                  iree_task_t* task) {
+  iree_task_submission_t submission;
+  iree_task_submission_initialize(&submission);
+  iree_task_submission_enqueue(&submission, task);
+  iree_task_executor_submit(task_loop->executor, &submission);
+}
+
+//==============================================================================
+// Operations
+//==============================================================================
+
+// Common header of all operations.
+// Every operation (aside from poller kicks) ends with |call_task| issuing the
+// user callback exactly once. The operation is freed when the call task is
+// cleaned up.
+typedef struct iree_task_loop_op_t {
+  // Issues the user callback; the operation is freed when it is cleaned up.
+  iree_task_call_t call_task;
+  iree_task_loop_t* task_loop;
+  iree_loop_callback_t callback;
+  // True once |callback| has been issued.
+  bool issued;
+} iree_task_loop_op_t;
+
+// Returns true if |op| should be aborted instead of run.
+static bool iree_task_loop_op_is_aborted(iree_task_loop_op_t* op) {
+  return iree_atomic_load_int32(&op->task_loop->aborted,
+                                iree_memory_order_acquire) != 0;
+}
+
+// Issues the |op| callback with |status| and routes any failure it returns to
+// the loop.
+static void iree_task_loop_op_issue(iree_task_loop_op_t* op,
+                                    iree_status_t status) {
+  IREE_ASSERT(!op->issued);
+  op->issued = true;
+  iree_task_loop_t* task_loop = op->task_loop;
+  iree_status_t callback_status = op->callback.fn(
+      op->callback.user_data, iree_loop_task(task_loop), status);
+  if (!iree_status_is_ok(callback_status)) {
+    iree_task_loop_emit_error(task_loop, callback_status);
+  }
+}
+
+// Frees |op| and ends its hold on the loop scope.
+// Callbacks are issued with IREE_STATUS_ABORTED if the task system discarded
+// the operation before it could run.
+static void iree_task_loop_op_free(iree_task_loop_op_t* op) {
+  iree_task_loop_t* task_loop = op->task_loop;
+  if (!op->issued) {
+    iree_task_loop_op_issue(op, iree_status_from_code(IREE_STATUS_ABORTED));
+  }
+  iree_task_scope_t* scope = &task_loop->scope;
+  iree_allocator_free(task_loop->allocator, op);
+  // NOTE: the loop may be freed as soon as the scope is idle.
+  iree_task_scope_end(scope);
+}
+
+// Allocates an operation of |total_size| bytes with a header initialized to
+// run |call_fn| and schedule against |task_loop|.
+static iree_status_t iree_task_loop_op_allocate(
+    iree_task_loop_t* task_loop, iree_host_size_t total_size,
+    iree_loop_callback_t callback, iree_task_call_closure_fn_t call_fn,
+    iree_task_cleanup_fn_t cleanup_fn, iree_task_loop_op_t** out_op) {
+  iree_task_loop_op_t* op = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_allocator_malloc(task_loop->allocator, total_size, (void**)&op));
+  op->task_loop = task_loop;
+  op->callback = callback;
+  op->issued = false;
+  iree_task_call_initialize(&task_loop->scope,
+                            iree_task_make_call_closure(call_fn, op),
+                            &op->call_task);
+  iree_task_set_cleanup_fn(&op->call_task.header, cleanup_fn);
+  iree_task_scope_begin(&task_loop->scope);
+  *out_op = op;
+  return iree_ok_status();
+}
+
+static void iree_task_loop_op_cleanup(iree_task_t* task,
+                                      iree_status_code_t status_code) {
+  iree_task_loop_op_free((iree_task_loop_op_t*)task);
+}
+
+//==============================================================================
+// IREE_LOOP_COMMAND_CALL
+//==============================================================================
+
+static iree_status_t iree_task_loop_call_execute(
+    void* user_context, iree_task_t* task,
+    iree_task_submission_t* pending_submission) {
+  iree_task_loop_op_t* op = (iree_task_loop_op_t*)user_context;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_task_loop_op_issue(
+      op, iree_task_loop_op_is_aborted(op)
+              ? iree_status_from_code(IREE_STATUS_ABORTED)
+              : iree_ok_status());
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_task_loop_call(
+    iree_task_loop_t* task_loop, const iree_loop_call_params_t* params) {
+  iree_task_loop_op_t* op = NULL;
+  IREE_RETURN_IF_ERROR(iree_task_loop_op_allocate(
+      task_loop, sizeof(*op), params->callback, iree_task_loop_call_execute,
+      iree_task_loop_op_cleanup, &op));
+  iree_task_loop_submit(task_loop, &op->call_task.header);
+  return iree_ok_status();
+}
+
+//==============================================================================
+// IREE_LOOP_COMMAND_DISPATCH
+//==============================================================================
+
+typedef struct iree_task_loop_dispatch_op_t {
+  iree_task_loop_op_t base;
+  // Runs the workgroups and readies the call task upon completion.
+  iree_task_dispatch_t dispatch_task;
+  iree_loop_workgroup_fn_t workgroup_fn;
+  // First failure returned by a workgroup. Workgroup failures are passed to the
+  // completion callback instead of failing the task scope.
+  iree_atomic_intptr_t status;
+} iree_task_loop_dispatch_op_t;
+
+static iree_status_t iree_task_loop_dispatch_tile(
+    void* user_context, const iree_task_tile_context_t* tile_context,
+    iree_task_submission_t* pending_submission) {
+  iree_task_loop_dispatch_op_t* op =
+      (iree_task_loop_dispatch_op_t*)user_context;
+
+  // Skip the remaining workgroups once any has failed or the loop aborted.
+  if (iree_atomic_load_intptr(&op->status, iree_memory_order_acquire) != 0 ||
+      iree_task_loop_op_is_aborted(&op->base)) {
+    return iree_ok_status();
+  }
+
+  iree_status_t status = op->workgroup_fn(
+      op->base.callback.user_data, iree_loop_task(op->base.task_loop),
+      tile_context->workgroup_xyz[0], tile_context->workgroup_xyz[1],
+      tile_context->workgroup_xyz[2]);
+  if (IREE_UNLIKELY(!iree_status_is_ok(status))) {
+    intptr_t expected = 0;
+    if (!iree_atomic_compare_exchange_strong_intptr(
+            &op->status, &expected, (intptr_t)status,
+            iree_memory_order_acq_rel, iree_memory_order_relaxed)) {
+      iree_status_ignore(status);
+    }
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_task_loop_dispatch_complete(
+    void* user_context, iree_task_t* task,
+    iree_task_submission_t* pending_submission) {
+  iree_task_loop_dispatch_op_t* op =
+      (iree_task_loop_dispatch_op_t*)user_context;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status = (iree_status_t)iree_atomic_exchange_intptr(
+      &op->status, 0, iree_memory_order_acquire);
+  if (iree_task_loop_op_is_aborted(&op->base)) {
+    iree_status_ignore(status);
+    status = iree_status_from_code(IREE_STATUS_ABORTED);
+  }
+  iree_task_loop_op_issue(&op->base, status);
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_task_loop_dispatch_cleanup(iree_task_t* task,
+                                            iree_status_code_t status_code) {
+  iree_task_loop_dispatch_op_t* op = (iree_task_loop_dispatch_op_t*)task;
+  iree_status_ignore((iree_status_t)iree_atomic_exchange_intptr(
+      &op->status, 0, iree_memory_order_acquire));
+  iree_task_loop_op_free(&op->base);
+}
+
+static iree_status_t iree_task_loop_dispatch(
+    iree_task_loop_t* task_loop, const iree_loop_dispatch_params_t* params) {
+  iree_task_loop_dispatch_op_t* op = NULL;
+  IREE_RETURN_IF_ERROR(iree_task_loop_op_allocate(
+      task_loop, sizeof(*op), params->callback,
+      iree_task_loop_dispatch_complete, iree_task_loop_dispatch_cleanup,
+      (iree_task_loop_op_t**)&op));
+  op->workgroup_fn = params->workgroup_fn;
+  iree_atomic_store_intptr(&op->status, 0, iree_memory_order_relaxed);
+
+  const uint32_t workgroup_size[3] = {1, 1, 1};
+  iree_task_dispatch_initialize(
+      &task_loop->scope,
+      iree_task_make_dispatch_closure(iree_task_loop_dispatch_tile, op),
+      workgroup_size, params->workgroup_count_xyz, &op->dispatch_task);
+  iree_task_set_completion_task(&op->dispatch_task.header,
+                                &op->base.call_task.header);
+
+  iree_task_loop_submit(task_loop, &op->dispatch_task.header);
+  return iree_ok_status();
+}
+
+//==============================================================================
+// IREE_LOOP_COMMAND_WAIT_*
+//==============================================================================
+
+// A wait operation handled by the executor poller.
+//
+// The call task of the operation runs one or more times: each time it checks
+// whether the wait has been satisfied and if not arms a round of wait tasks
+// that share a cancellation flag in wait-any mode with the call task as their
+// completion task. When any of the waits in the round resolve the rest are
+// cancelled and the call task runs again. Deadlines are modeled with a delay
+// task in the round so that wait tasks never fail with
+// IREE_STATUS_DEADLINE_EXCEEDED (which would fail the scope) and instead the
+// deadline is passed to the callback.
+struct iree_task_loop_wait_op_t {
+  iree_task_loop_op_t base;
+
+  // Links in iree_task_loop_t::wait_list_head.
+  iree_task_loop_wait_op_t* prev;
+  iree_task_loop_wait_op_t* next;
+
+  // One of IREE_LOOP_COMMAND_WAIT_UNTIL/WAIT_ONE/WAIT_ANY/WAIT_ALL.
+  iree_loop_command_t command;
+  // Absolute deadline of the wait.
+  iree_time_t deadline_ns;
+  // True once at least one round of waits has been armed.
+  bool armed;
+
+  // Shared by all of the wait tasks in the current round.
+  // Guarded by the loop mutex while the operation is in the wait list.
+  iree_atomic_int32_t cancellation_flag;
+
+  // Unresolved wait sources; resolved sources are removed as they are found.
+  iree_host_size_t wait_source_count;
+  iree_wait_source_t* wait_sources;
+  // Storage for one wait task per wait source and a trailing delay task.
+  iree_task_wait_t* wait_tasks;
+
+  // + trailing wait_sources[wait_source_count]
+  // + trailing wait_tasks[wait_source_count + 1]
+};
+
+static void iree_task_loop_wait_list_insert(iree_task_loop_t* task_loop,
+                                            iree_task_loop_wait_op_t* op) {
+  iree_slim_mutex_lock(&task_loop->mutex);
+  op->prev = NULL;
+  op->next = task_loop->wait_list_head;
+  if (op->next) op->next->prev = op;
+  task_loop->wait_list_head = op;
+  iree_slim_mutex_unlock(&task_loop->mutex);
+}
+
+static void iree_task_loop_wait_list_erase(iree_task_loop_t* task_loop,
+                                           iree_task_loop_wait_op_t* op) {
+  iree_slim_mutex_lock(&task_loop->mutex);
+  if (op->prev) {
+    op->prev->next = op->next;
+  } else {
+    task_loop->wait_list_head = op->next;
+  }
+  if (op->next) op->next->prev = op->prev;
+  op->prev = op->next = NULL;
+  iree_slim_mutex_unlock(&task_loop->mutex);
+}
+
+// Checks whether the wait |op| has completed and returns true if so with the
+// status to pass to the callback in |out_status|.
+static bool iree_task_loop_wait_op_poll(iree_task_loop_wait_op_t* op,
+                                        iree_status_t* out_status) {
+  *out_status = iree_ok_status();
+  if (iree_task_loop_op_is_aborted(&op->base)) {
+    *out_status = iree_status_from_code(IREE_STATUS_ABORTED);
+    return true;
+  }
+
+  // Delays retire on the poller within the slop of their deadline and we must
+  // match that here to avoid rearming them repeatedly.
+  const bool deadline_reached =
+      op->deadline_ns <= iree_time_now() + IREE_TASK_EXECUTOR_DELAY_SLOP_NS;
+  if (op->command == IREE_LOOP_COMMAND_WAIT_UNTIL) {
+    return op->armed || deadline_reached;
+  }
+
+  // Query and remove all resolved wait sources.
+  bool any_resolved = false;
+  for (iree_host_size_t i = 0; i < op->wait_source_count;) {
+    iree_status_code_t wait_status_code = IREE_STATUS_OK;
+    iree_status_t status =
+        iree_wait_source_query(op->wait_sources[i], &wait_status_code);
+    if (!iree_status_is_ok(status)) {
+      *out_status = status;
+      return true;
+    } else if (wait_status_code == IREE_STATUS_DEFERRED) {
+      ++i;
+    } else if (wait_status_code == IREE_STATUS_OK) {
+      any_resolved = true;
+      op->wait_sources[i] = op->wait_sources[--op->wait_source_count];
+    } else {
+      *out_status = iree_status_from_code(wait_status_code);
+      return true;
+    }
+  }
+  if (op->wait_source_count == 0 ||
+      (any_resolved && op->command != IREE_LOOP_COMMAND_WAIT_ALL)) {
+    return true;
+  }
+
+  if (deadline_reached) {
+    *out_status = iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+    return true;
+  }
+  return false;
+}
+
+// Arms a round of wait tasks for the unresolved wait sources of |op| and its
+// deadline. Returns false if the loop aborted and the round was not armed.
+static bool iree_task_loop_wait_op_arm(
+    iree_task_loop_wait_op_t* op, iree_task_submission_t* pending_submission) {
+  iree_task_loop_t* task_loop = op->base.task_loop;
+
+  // The abort check and flag reset must happen under the lock so that an
+  // abort racing with us either sees the armed round or we see the abort.
+  iree_slim_mutex_lock(&task_loop->mutex);
+  bool aborted = iree_task_loop_op_is_aborted(&op->base);
+  if (!aborted) {
+    iree_atomic_store_int32(&op->cancellation_flag, 0,
+                            iree_memory_order_release);
+    op->armed = true;
+  }
+  iree_slim_mutex_unlock(&task_loop->mutex);
+  if (aborted) return false;
+
+  iree_task_t* call_task = &op->base.call_task.header;
+  iree_host_size_t wait_task_count = 0;
+  for (iree_host_size_t i = 0; i < op->wait_source_count; ++i) {
+    iree_task_wait_t* wait_task = &op->wait_tasks[wait_task_count++];
+    iree_task_wait_initialize(&task_loop->scope, op->wait_sources[i],
+                              IREE_TIME_INFINITE_FUTURE, wait_task);
+  }
+  if (op->deadline_ns != IREE_TIME_INFINITE_FUTURE) {
+    iree_task_wait_t* delay_task = &op->wait_tasks[wait_task_count++];
+    iree_task_wait_initialize_delay(&task_loop->scope, op->deadline_ns,
+                                    delay_task);
+  }
+  for (iree_host_size_t i = 0; i < wait_task_count; ++i) {
+    iree_task_wait_t* wait_task = &op->wait_tasks[i];
+    iree_task_wait_set_wait_any(wait_task, &op->cancellation_flag);
+    iree_task_set_completion_task(&wait_task->header, call_task);
+    iree_task_submission_enqueue(pending_submission, &wait_task->header);
+  }
+  return true;
+}
+
+static iree_status_t iree_task_loop_wait_execute(
+    void* user_context, iree_task_t* task,
+    iree_task_submission_t* pending_submission) {
+  iree_task_loop_wait_op_t* op = (iree_task_loop_wait_op_t*)user_context;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_status_t status = iree_ok_status();
+  if (!iree_task_loop_wait_op_poll(op, &status)) {
+    if (iree_task_loop_wait_op_arm(op, pending_submission)) {
+      // We'll run again once the round of waits retires.
+      IREE_TRACE_ZONE_END(z0);
+      return iree_ok_status();
+    }
+    status = iree_status_from_code(IREE_STATUS_ABORTED);
+  }
+
+  iree_task_loop_wait_list_erase(op->base.task_loop, op);
+  iree_task_loop_op_issue(&op->base, status);
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static void iree_task_loop_wait_cleanup(iree_task_t* task,
+                                        iree_status_code_t status_code) {
+  iree_task_loop_wait_op_t* op = (iree_task_loop_wait_op_t*)task;
+  if (!op->base.issued) {
+    iree_task_loop_wait_list_erase(op->base.task_loop, op);
+  }
+  iree_task_loop_op_free(&op->base);
+}
+
+static iree_status_t iree_task_loop_wait(
+    iree_task_loop_t* task_loop, iree_loop_command_t command,
+    iree_loop_callback_t callback, iree_time_t deadline_ns,
+    iree_host_size_t wait_source_count,
+    const iree_wait_source_t* wait_sources) {
+  // Wait sources are copied so that resolved ones can be removed as we go.
+  iree_host_size_t total_size =
+      iree_host_align(sizeof(iree_task_loop_wait_op_t), iree_max_align_t);
+  const iree_host_size_t wait_sources_offset = total_size;
+  total_size += iree_host_align(wait_source_count * sizeof(iree_wait_source_t),
+                                iree_max_align_t);
+  const iree_host_size_t wait_tasks_offset = total_size;
+  total_size += (wait_source_count + 1) * sizeof(iree_task_wait_t);
+
+  iree_task_loop_wait_op_t* op = NULL;
+  IREE_RETURN_IF_ERROR(iree_task_loop_op_allocate(
+      task_loop, total_size, callback, iree_task_loop_wait_execute,
+      iree_task_loop_wait_cleanup, (iree_task_loop_op_t**)&op));
+  op->command = command;
+  op->deadline_ns = deadline_ns;
+  op->armed = false;
+  iree_atomic_store_int32(&op->cancellation_flag, 0,
+                          iree_memory_order_relaxed);
+  op->wait_source_count = wait_source_count;
+  op->wait_sources =
+      (iree_wait_source_t*)((uint8_t*)op + wait_sources_offset);
+  if (wait_source_count > 0) {
+    memcpy(op->wait_sources, wait_sources,
+           wait_source_count * sizeof(*wait_sources));
+  }
+  op->wait_tasks = (iree_task_wait_t*)((uint8_t*)op + wait_tasks_offset);
+
+  iree_task_loop_wait_list_insert(task_loop, op);
+  iree_task_loop_submit(task_loop, &op->base.call_task.header);
+  return iree_ok_status();
+}
+
+//==============================================================================
+// Aborts
+//==============================================================================
+
+// Wait task used to wake the poller so that it rescans its cancelled waits.
+typedef struct iree_task_loop_kick_t {
+  iree_task_wait_t wait_task;
+  iree_task_loop_t* task_loop;
+} iree_task_loop_kick_t;
+
+static void iree_task_loop_kick_cleanup(iree_task_t* task,
+                                        iree_status_code_t status_code) {
+  iree_task_loop_kick_t* kick = (iree_task_loop_kick_t*)task;
+  iree_task_loop_t* task_loop = kick->task_loop;
+  iree_task_scope_t* scope = &task_loop->scope;
+  iree_allocator_free(task_loop->allocator, kick);
+  iree_task_scope_end(scope);
+}
+
+// Wakes the executor poller by submitting an immediately-resolved wait.
+// Best-effort: if the kick cannot be allocated the cancelled waits will still
+// be retired the next time the poller wakes.
+static void iree_task_loop_kick_poller(iree_task_loop_t* task_loop) {
+  iree_task_loop_kick_t* kick = NULL;
+  iree_status_t status = iree_allocator_malloc(task_loop->allocator,
+                                               sizeof(*kick), (void**)&kick);
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    return;
+  }
+  kick->task_loop = task_loop;
+  iree_task_wait_initialize(&task_loop->scope, iree_wait_source_immediate(),
+                            IREE_TIME_INFINITE_FUTURE, &kick->wait_task);
+  iree_task_set_cleanup_fn(&kick->wait_task.header,
+                           iree_task_loop_kick_cleanup);
+  iree_task_scope_begin(&task_loop->scope);
+  iree_task_loop_submit(task_loop, &kick->wait_task.header);
+}
+
+static void iree_task_loop_abort(iree_task_loop_t* task_loop) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // All operations that run from now until the loop drains are aborted and
+  // any waits that are armed are cancelled.
+  iree_slim_mutex_lock(&task_loop->mutex);
+  iree_atomic_store_int32(&task_loop->aborted, 1, iree_memory_order_release);
+  bool any_waits = task_loop->wait_list_head != NULL;
+  for (iree_task_loop_wait_op_t* op = task_loop->wait_list_head; op;
+       op = op->next) {
+    iree_atomic_store_int32(&op->cancellation_flag, 1,
+                            iree_memory_order_release);
+  }
+  iree_slim_mutex_unlock(&task_loop->mutex);
+
+  // The poller only checks cancellation flags when it scans its waits.
+  if (any_waits) iree_task_loop_kick_poller(task_loop);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+//==============================================================================
+// iree_task_loop_t
+//==============================================================================
+
+iree_status_t iree_task_loop_allocate(iree_task_executor_t* executor,
+                                      iree_task_loop_error_fn_t error_fn,
+                                      void* error_user_data,
+                                      iree_allocator_t allocator,
+                                      iree_task_loop_t** out_task_loop) {
+  IREE_ASSERT_ARGUMENT(executor);
+  IREE_ASSERT_ARGUMENT(out_task_loop);
+  *out_task_loop = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_task_loop_t* task_loop = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(allocator, sizeof(*task_loop),
+                                (void**)&task_loop));
+  task_loop->allocator = allocator;
+  task_loop->executor = executor;
+  iree_task_executor_retain(executor);
+  task_loop->error_fn = error_fn;
+  task_loop->error_user_data = error_user_data;
+  iree_task_scope_initialize(iree_make_cstring_view("loop"),
+                             &task_loop->scope);
+  iree_atomic_store_int32(&task_loop->aborted, 0,
+                          iree_memory_order_relaxed);
+  iree_slim_mutex_initialize(&task_loop->mutex);
+  task_loop->wait_list_head = NULL;
+
+  *out_task_loop = task_loop;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+void iree_task_loop_free(iree_task_loop_t* task_loop) {
+  IREE_ASSERT_ARGUMENT(task_loop);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_allocator_t allocator = task_loop->allocator;
+
+  // Abort all pending operations and wait for their callbacks to be issued.
+  iree_task_loop_abort(task_loop);
+  iree_status_ignore(
+      iree_task_loop_wait_idle(task_loop, iree_infinite_timeout()));
+  IREE_ASSERT(!task_loop->wait_list_head);
+
+  iree_slim_mutex_deinitialize(&task_loop->mutex);
+  iree_task_scope_deinitialize(&task_loop->scope);
+  iree_task_executor_release(task_loop->executor);
+  iree_allocator_free(allocator, task_loop);
+
+  IREE_TRACE_ZONE_END(z0);
+}
+
+iree_status_t iree_task_loop_wait_idle(iree_task_loop_t* task_loop,
+                                       iree_timeout_t timeout) {
+  IREE_ASSERT_ARGUMENT(task_loop);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_status_t status = iree_task_executor_donate_caller(
+      task_loop->executor, iree_task_scope_await_idle(&task_loop->scope),
+      timeout);
+
+  // Tasks only fail the scope if the task system was unable to perform a wait
+  // (such as a wait source that could not be exported). Route those to the
+  // error handler as we would callback failures.
+  if (iree_status_is_ok(status) &&
+      iree_task_scope_has_failed(&task_loop->scope)) {
+    iree_status_t scope_status =
+        iree_task_scope_consume_status(&task_loop->scope);
+    if (!iree_status_is_ok(scope_status)) {
+      iree_task_loop_emit_error(task_loop, scope_status);
+    }
+  }
+
+  // Now that all aborted operations have retired the loop can accept new work.
+  if (iree_status_is_ok(status)) {
+    iree_atomic_store_int32(&task_loop->aborted, 0, iree_memory_order_release);
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_task_loop_ctl(void* self, iree_loop_command_t command,
+                                 const void* params, void** inout_ptr) {
+  IREE_ASSERT_ARGUMENT(self);
+  iree_task_loop_t* task_loop = (iree_task_loop_t*)self;
+  switch (command) {
+    case IREE_LOOP_COMMAND_CALL:
+      return iree_task_loop_call(task_loop,
+                                 (const iree_loop_call_params_t*)params);
+    case IREE_LOOP_COMMAND_DISPATCH:
+      return iree_task_loop_dispatch(
+          task_loop, (const iree_loop_dispatch_params_t*)params);
+    case IREE_LOOP_COMMAND_WAIT_UNTIL: {
+      const iree_loop_wait_until_params_t* wait_params =
+          (const iree_loop_wait_until_params_t*)params;
+      return iree_task_loop_wait(task_loop, command, wait_params->callback,
+                                 wait_params->deadline_ns, 0, NULL);
+    }
+    case IREE_LOOP_COMMAND_WAIT_ONE: {
+      const iree_loop_wait_one_params_t* wait_params =
+          (const iree_loop_wait_one_params_t*)params;
+      return iree_task_loop_wait(task_loop, command, wait_params->callback,
+                                 wait_params->deadline_ns, 1,
+                                 &wait_params->wait_source);
+    }
+    case IREE_LOOP_COMMAND_WAIT_ALL:
+    case IREE_LOOP_COMMAND_WAIT_ANY: {
+      const iree_loop_wait_multi_params_t* wait_params =
+          (const iree_loop_wait_multi_params_t*)params;
+      return iree_task_loop_wait(task_loop, command, wait_params->callback,
+                                 wait_params->deadline_ns, wait_params->count,
+                                 wait_params->wait_sources);
+    }
+    case IREE_LOOP_COMMAND_DRAIN: {
+      const iree_loop_drain_params_t* drain_params =
+          (const iree_loop_drain_params_t*)params;
+      return iree_task_loop_wait_idle(
+          task_loop, iree_make_deadline(drain_params->deadline_ns));
+    }
+    default:
+      return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                              "unimplemented loop command");
+  }
+}
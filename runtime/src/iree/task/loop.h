@@ -0,0 +1,81 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_TASK_LOOP_H_
+#define IREE_TASK_LOOP_H_
+
+#include "iree/base/api.h"
+#include "iree/task/executor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+//===----------------------------------------------------------------------===//
+// iree_task_loop_t
+//===----------------------------------------------------------------------===//
+
+// Handles errors returned from loop callback operations.
+// Ownership of |status| is passed to the handler and must be freed.
+// All operations pending in the loop will be aborted.
+// May be called from any thread, including concurrently if multiple operations
+// fail at the same time.
+typedef void(IREE_API_PTR* iree_task_loop_error_fn_t)(void* user_data,
+                                                      iree_status_t status);
+
+// A loop that runs operations concurrently on an iree_task_executor_t.
+// Calls and dispatch workgroups are executed by the executor workers and waits
+// are handled by the executor poller such that no thread is blocked waiting.
+// Unlike iree_loop_sync_t the loop makes progress without any calls to
+// iree_loop_drain and callbacks may be issued from any worker thread in any
+// order: users requiring ordering must chain their operations.
+//
+// When an operation callback fails the error is routed to the loop error
+// handler and all pending operations are issued with IREE_STATUS_ABORTED.
+// Because operations race with the failure any operation that runs after it is
+// also aborted until the loop is drained with iree_task_loop_wait_idle (or
+// iree_loop_drain), after which the loop accepts new work as normal.
+//
+// Thread-safe: operations may be enqueued from any thread.
+typedef struct iree_task_loop_t iree_task_loop_t;
+
+// Allocates a loop that schedules work on |executor| stored into
+// |out_task_loop|. The executor is retained for the lifetime of the loop.
+// |error_fn| is optional and receives errors returned by loop callbacks.
+iree_status_t iree_task_loop_allocate(iree_task_executor_t* executor,
+                                      iree_task_loop_error_fn_t error_fn,
+                                      void* error_user_data,
+                                      iree_allocator_t allocator,
+                                      iree_task_loop_t** out_task_loop);
+
+// Frees |task_loop| after aborting all pending operations and waiting for their
+// callbacks to be issued.
+void iree_task_loop_free(iree_task_loop_t* task_loop);
+
+// Waits until the loop is idle (all operations have retired).
+// Returns IREE_STATUS_DEADLINE_EXCEEDED if |timeout| is reached before the
+// loop is idle. The calling thread is donated to the executor while waiting.
+// Must not be called from within a loop callback.
+iree_status_t iree_task_loop_wait_idle(iree_task_loop_t* task_loop,
+                                       iree_timeout_t timeout);
+
+iree_status_t iree_task_loop_ctl(void* self, iree_loop_command_t command,
+                                 const void* params, void** inout_ptr);
+
+// Returns a loop that schedules operations against |task_loop|.
+static inline iree_loop_t iree_loop_task(iree_task_loop_t* task_loop) {
+  iree_loop_t loop = {
+      task_loop,
+      iree_task_loop_ctl,
+  };
+  return loop;
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_TASK_LOOP_H_
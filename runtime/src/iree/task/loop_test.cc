@@ -0,0 +1,54 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/task/loop.h"
+
+#include <mutex>
+
+#include "iree/base/api.h"
+#include "iree/task/executor.h"
+#include "iree/task/topology.h"
+#include "iree/testing/gtest.h"
+#include "iree/testing/status_matchers.h"
+
+// Contains the test definitions applied to all loop implementations:
+#include "iree/base/loop_test.h"
+
+void AllocateLoop(iree_status_t* out_status, iree_allocator_t allocator,
+                  iree_loop_t* out_loop) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_group_count(4, &topology);
+  iree_task_executor_options_t options;
+  iree_task_executor_options_initialize(&options);
+  options.worker_local_memory_size = 64 * 1024;
+  iree_task_executor_t* executor = NULL;
+  IREE_CHECK_OK(
+      iree_task_executor_create(options, &topology, allocator, &executor));
+  iree_task_topology_deinitialize(&topology);
+
+  iree_task_loop_t* task_loop = NULL;
+  IREE_CHECK_OK(iree_task_loop_allocate(
+      executor,
+      +[](void* user_data, iree_status_t status) {
+        // Errors may be reported concurrently from multiple workers.
+        static std::mutex mutex;
+        std::lock_guard<std::mutex> lock(mutex);
+        iree_status_t* status_ptr = (iree_status_t*)user_data;
+        if (iree_status_is_ok(*status_ptr)) {
+          *status_ptr = status;
+        } else {
+          iree_status_ignore(status);
+        }
+      },
+      out_status, allocator, &task_loop));
+  iree_task_executor_release(executor);
+
+  *out_loop = iree_loop_task(task_loop);
+}
+
+void FreeLoop(iree_allocator_t allocator, iree_loop_t loop) {
+  iree_task_loop_free((iree_task_loop_t*)loop.self);
+}
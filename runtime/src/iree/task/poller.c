@@ -217,8 +217,11 @@ typedef uint32_t iree_task_poller_prepare_result_t;
 // The task will be checked for completion or failure such as deadline exceeded
 // and removed from the wait list if resolved. If unresolved the wait will be
 // prepared for the system wait by ensuring a wait handle is available.
+// |prev_task| is the task preceding |task| in the wait list, if any. Retired
+// tasks are erased from the wait list prior to retiring as their cleanup
+// functions may free them.
 static iree_task_poller_prepare_result_t iree_task_poller_prepare_task(
-    iree_task_poller_t* poller, iree_task_wait_t* task,
+    iree_task_poller_t* poller, iree_task_t* prev_task, iree_task_wait_t* task,
     iree_task_submission_t* pending_submission, iree_time_t now_ns,
     iree_time_t* earliest_deadline_ns) {
   IREE_TRACE_ZONE_BEGIN(z0);
@@ -338,6 +341,7 @@ static iree_task_poller_prepare_result_t iree_task_poller_prepare_task(
       status = iree_status_from_code(wait_status_code);
     }
   }
+  iree_task_list_erase(&poller->wait_list, prev_task, &task->header);
   iree_task_wait_retire(task, pending_submission, status);
 
   IREE_TRACE_ZONE_END(z0);
@@ -374,18 +378,17 @@ static void iree_task_poller_prepare_wait(
       iree_task_t* next_task = task->next_task;
 
       iree_task_poller_prepare_result_t result = iree_task_poller_prepare_task(
-          poller, (iree_task_wait_t*)task, pending_submission, now_ns,
-          out_earliest_deadline_ns);
+          poller, prev_task, (iree_task_wait_t*)task, pending_submission,
+          now_ns, out_earliest_deadline_ns);
       if (iree_all_bits_set(result, IREE_TASK_POLLER_PREPARE_CANCELLED)) {
         // A task was cancelled; we'll need to retry the scan to clean up any
         // waits we may have already checked.
         retry_scan = true;
       }
 
-      if (iree_all_bits_set(result, IREE_TASK_POLLER_PREPARE_RETIRED)) {
-        // Erase the retired task from the wait list.
-        iree_task_list_erase(&poller->wait_list, prev_task, task);
-      } else {
+      // Retired tasks have already been erased from the wait list and may no
+      // longer be live.
+      if (!iree_all_bits_set(result, IREE_TASK_POLLER_PREPARE_RETIRED)) {
         prev_task = task;
       }
       task = next_task;
@@ -35,6 +35,10 @@ typedef struct iree_task_post_batch_t {
   // May be NULL if not being posted from a worker (such as a submission).
   iree_task_worker_t* current_worker;
 
+  // Snapshot of the executor worker_live_mask taken when the batch was
+  // initialized. All tasks in the batch are only posted to these workers.
+  iree_task_affinity_set_t worker_live_mask;
+
   // A bitmask of workers indicating which have pending tasks in their lists.
   // Used to quickly scan the lists and perform the posts only when required.
   iree_task_affinity_set_t worker_pending_mask;
@@ -47,7 +51,7 @@ void iree_task_post_batch_initialize(iree_task_executor_t* executor,
                                      iree_task_worker_t* current_worker,
                                      iree_task_post_batch_t* out_post_batch);
 
-// Returns the total number of workers that the post batch is targeting.
+// Returns the total number of live workers that the post batch is targeting.
 iree_host_size_t iree_task_post_batch_worker_count(
     const iree_task_post_batch_t* post_batch);
 
@@ -27,6 +27,8 @@ void iree_task_scope_initialize(iree_string_view_t name,
   // TODO(benvanik): pick trace colors based on name hash.
   IREE_TRACE(out_scope->task_trace_color = 0xFFFF0000u);
 
+  out_scope->priority = IREE_TASK_PRIORITY_NORMAL;
+
   iree_notification_initialize(&out_scope->idle_notification);
 
   IREE_TRACE_ZONE_END(z0);
@@ -63,6 +65,12 @@ iree_string_view_t iree_task_scope_name(iree_task_scope_t* scope) {
   return iree_make_cstring_view(scope->name);
 }
 
+void iree_task_scope_set_priority(iree_task_scope_t* scope,
+                                  iree_task_priority_t priority) {
+  IREE_ASSERT_LT(priority, IREE_TASK_PRIORITY_COUNT);
+  scope->priority = priority;
+}
+
 iree_task_dispatch_statistics_t iree_task_scope_consume_statistics(
     iree_task_scope_t* scope) {
   iree_task_dispatch_statistics_t result = scope->dispatch_statistics;
@@ -161,3 +169,40 @@ iree_status_t iree_task_scope_wait_idle(iree_task_scope_t* scope,
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
+
+// Wait source control function for iree_task_scope_await_idle.
+static iree_status_t iree_task_scope_wait_source_ctl(
+    iree_wait_source_t wait_source, iree_wait_source_command_t command,
+    const void* params, void** inout_ptr) {
+  iree_task_scope_t* scope = (iree_task_scope_t*)wait_source.self;
+  switch (command) {
+    case IREE_WAIT_SOURCE_COMMAND_QUERY: {
+      iree_status_code_t* out_wait_status_code = (iree_status_code_t*)inout_ptr;
+      *out_wait_status_code = iree_task_scope_is_idle(scope)
+                                  ? IREE_STATUS_OK
+                                  : IREE_STATUS_DEFERRED;
+      return iree_ok_status();
+    }
+    case IREE_WAIT_SOURCE_COMMAND_WAIT_ONE: {
+      const iree_timeout_t timeout =
+          ((const iree_wait_source_wait_params_t*)params)->timeout;
+      return iree_task_scope_wait_idle(scope,
+                                       iree_timeout_as_deadline_ns(timeout));
+    }
+    case IREE_WAIT_SOURCE_COMMAND_EXPORT: {
+      return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                              "scopes cannot be exported to wait primitives");
+    }
+    default:
+      return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                              "unimplemented wait_source command");
+  }
+}
+
+iree_wait_source_t iree_task_scope_await_idle(iree_task_scope_t* scope) {
+  return (iree_wait_source_t){
+      .self = scope,
+      .data = 0,
+      .ctl = iree_task_scope_wait_source_ctl,
+  };
+}
@@ -20,6 +20,27 @@
 extern "C" {
 #endif  // __cplusplus
 
+// Relative scheduling priority of the tasks within a scope.
+// Workers run ready tasks of a higher priority before any of a lower priority
+// and dispatch shards yield between tile reservations when higher priority work
+// has been posted to the worker executing them. Priorities only order work that
+// is ready at the same time and do not starve lower priority work that is
+// already executing on workers not targeted by the higher priority work.
+//
+// NOTE: values are ordered such that lower values are higher priority and can
+// be used to index per-priority arrays.
+typedef enum iree_task_priority_e {
+  // Latency-sensitive work that should preempt all other work.
+  IREE_TASK_PRIORITY_HIGH = 0,
+  // Default priority of all scopes.
+  IREE_TASK_PRIORITY_NORMAL = 1,
+  // Background work that should only run when nothing else is ready.
+  IREE_TASK_PRIORITY_LOW = 2,
+} iree_task_priority_t;
+
+// Total number of task priorities, used for sizing per-priority arrays.
+#define IREE_TASK_PRIORITY_COUNT 3
+
 // iree_task_scope_t is an atomic reference-counting helper posting a
 // notification when the reference count is decremended to 0.
 //
@@ -53,6 +74,9 @@ typedef struct iree_task_scope_t {
   // The color will be modulated based on task type.
   IREE_TRACE(uint32_t task_trace_color;)
 
+  // Scheduling priority of all tasks within the scope.
+  iree_task_priority_t priority;
+
   // A permanent status code set when a task within the scope fails. All pending
   // tasks will be aborted, though any in-flight tasks may continue executing
   // to completion.
@@ -89,6 +113,18 @@ void iree_task_scope_deinitialize(iree_task_scope_t* scope);
 // string.
 iree_string_view_t iree_task_scope_name(iree_task_scope_t* scope);
 
+// Sets the scheduling priority of all tasks within the scope.
+// Must only be changed while the scope is idle.
+void iree_task_scope_set_priority(iree_task_scope_t* scope,
+                                  iree_task_priority_t priority);
+
+// Returns the scheduling priority of tasks within |scope|.
+// Tasks without a scope are scheduled at IREE_TASK_PRIORITY_NORMAL.
+static inline iree_task_priority_t iree_task_scope_priority(
+    const iree_task_scope_t* scope) {
+  return scope ? scope->priority : IREE_TASK_PRIORITY_NORMAL;
+}
+
 // Returns and resets the statistics for the scope.
 // Statistics may experience tearing (non-atomic update across fields) if this
 // is performed while tasks are in-flight.
@@ -156,6 +192,11 @@ bool iree_task_scope_is_idle(iree_task_scope_t* scope);
 iree_status_t iree_task_scope_wait_idle(iree_task_scope_t* scope,
                                         iree_time_t deadline_ns);
 
+// Returns a wait source that resolves when the scope becomes idle as with
+// iree_task_scope_wait_idle. The scope must remain live for as long as the
+// wait source is in use.
+iree_wait_source_t iree_task_scope_await_idle(iree_task_scope_t* scope);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -33,6 +33,16 @@ TEST(ScopeTest, LongNameTruncation) {
   iree_task_scope_deinitialize(&scope);
 }
 
+TEST(ScopeTest, Priority) {
+  iree_task_scope_t scope;
+  iree_task_scope_initialize(iree_make_cstring_view("scope_a"), &scope);
+  EXPECT_EQ(IREE_TASK_PRIORITY_NORMAL, iree_task_scope_priority(&scope));
+  iree_task_scope_set_priority(&scope, IREE_TASK_PRIORITY_HIGH);
+  EXPECT_EQ(IREE_TASK_PRIORITY_HIGH, iree_task_scope_priority(&scope));
+  EXPECT_EQ(IREE_TASK_PRIORITY_NORMAL, iree_task_scope_priority(NULL));
+  iree_task_scope_deinitialize(&scope);
+}
+
 TEST(ScopeTest, AbortEmpty) {
   iree_task_scope_t scope;
   iree_task_scope_initialize(iree_make_cstring_view("scope_a"), &scope);
@@ -10,6 +10,7 @@
 #include <string.h>
 
 #include "iree/base/tracing.h"
+#include "iree/task/executor_impl.h"
 #include "iree/task/list.h"
 #include "iree/task/pool.h"
 #include "iree/task/post_batch.h"
@@ -522,6 +523,44 @@ void iree_task_dispatch_statistics_merge(
 // IREE_TASK_TYPE_DISPATCH
 //==============================================================================
 
+void iree_task_dispatch_profile_initialize(
+    uint32_t worker_capacity, iree_task_dispatch_profile_t* out_profile) {
+  iree_atomic_store_int64(&out_profile->start_ns, 0, iree_memory_order_relaxed);
+  iree_atomic_store_int64(&out_profile->end_ns, 0, iree_memory_order_relaxed);
+  memset(out_profile->workgroup_count, 0,
+         sizeof(out_profile->workgroup_count));
+  out_profile->worker_capacity = worker_capacity;
+  for (uint32_t i = 0; i < worker_capacity; ++i) {
+    iree_atomic_store_int32(&out_profile->worker_tile_counts[i], 0,
+                            iree_memory_order_relaxed);
+  }
+}
+
+// Records a shard executing |tile_count| tiles on the worker with
+// |worker_index| between |start_ns| and |end_ns| into |profile|.
+static void iree_task_dispatch_profile_record_shard(
+    iree_task_dispatch_profile_t* profile, iree_host_size_t worker_index,
+    iree_time_t start_ns, iree_time_t end_ns, uint32_t tile_count) {
+  const uint32_t counter_index =
+      (uint32_t)iree_min(worker_index, profile->worker_capacity - 1);
+  iree_atomic_fetch_add_int32(&profile->worker_tile_counts[counter_index],
+                              (int32_t)tile_count, iree_memory_order_relaxed);
+  int64_t prior_start_ns =
+      iree_atomic_load_int64(&profile->start_ns, iree_memory_order_relaxed);
+  while ((prior_start_ns == 0 || start_ns < prior_start_ns) &&
+         !iree_atomic_compare_exchange_weak_int64(
+             &profile->start_ns, &prior_start_ns, start_ns,
+             iree_memory_order_relaxed, iree_memory_order_relaxed)) {
+  }
+  int64_t prior_end_ns =
+      iree_atomic_load_int64(&profile->end_ns, iree_memory_order_relaxed);
+  while (end_ns > prior_end_ns &&
+         !iree_atomic_compare_exchange_weak_int64(
+             &profile->end_ns, &prior_end_ns, end_ns,
+             iree_memory_order_relaxed, iree_memory_order_relaxed)) {
+  }
+}
+
 static void iree_task_dispatch_initialize_base(
     iree_task_scope_t* scope, iree_task_dispatch_closure_t closure,
     const uint32_t workgroup_size[3], iree_task_dispatch_t* out_task) {
@@ -530,6 +569,9 @@ static void iree_task_dispatch_initialize_base(
   memcpy(out_task->workgroup_size, workgroup_size,
          sizeof(out_task->workgroup_size));
   out_task->local_memory_size = 0;
+  out_task->cost_key = 0;
+  out_task->cost = NULL;
+  out_task->profile = NULL;
   iree_atomic_store_intptr(&out_task->status, 0, iree_memory_order_release);
   memset(&out_task->statistics, 0, sizeof(out_task->statistics));
 
@@ -559,6 +601,46 @@ void iree_task_dispatch_initialize_indirect(
   out_task->workgroup_count.ptr = workgroup_count_ptr;
 }
 
+// Selects how many tiles each shard reserves at a time from the grid of
+// |tile_count| tiles. |tile_duration_ns| is the measured cost of a single tile
+// or 0 if unknown.
+static uint32_t iree_task_dispatch_select_tiles_per_reservation(
+    uint32_t tile_count, iree_host_size_t worker_count,
+    int64_t tile_duration_ns) {
+  if (tile_duration_ns <= 0) {
+    // No measurements: a higher number reduces overhead and improves locality
+    // while a lower number reduces maximum worst-case latency (coarser work
+    // stealing).
+    if (tile_count <
+        worker_count * IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION) {
+      // Grid is small - allow it to be eagerly sliced up.
+      return 1;
+    }
+    return IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION;
+  }
+
+  // Reserve enough tiles that the reservation overhead stays under the target
+  // fraction of the time spent executing them. Very expensive tiles get 1 tile
+  // per reservation while very cheap tiles get many.
+  const int64_t reservation_budget_ns =
+      IREE_TASK_DISPATCH_RESERVATION_OVERHEAD_NS *
+      IREE_TASK_DISPATCH_RESERVATION_OVERHEAD_DIVISOR;
+  int64_t tiles_per_reservation =
+      (reservation_budget_ns + tile_duration_ns - 1) / tile_duration_ns;
+
+  // Leave each shard several reservations so that work can still balance out
+  // when some workers are slower (or start later) than others.
+  const int64_t balanced_tiles_per_reservation = iree_max(
+      1, tile_count /
+             (worker_count * IREE_TASK_DISPATCH_MIN_RESERVATIONS_PER_SHARD));
+  tiles_per_reservation =
+      iree_min(tiles_per_reservation, balanced_tiles_per_reservation);
+  tiles_per_reservation =
+      iree_min(tiles_per_reservation,
+               IREE_TASK_DISPATCH_MAX_ADAPTIVE_TILES_PER_SHARD_RESERVATION);
+  return (uint32_t)iree_max(1, tiles_per_reservation);
+}
+
 void iree_task_dispatch_issue(iree_task_dispatch_t* dispatch_task,
                               iree_task_pool_t* shard_task_pool,
                               iree_task_submission_t* pending_submission,
@@ -598,29 +680,41 @@ void iree_task_dispatch_issue(iree_task_dispatch_t* dispatch_task,
                           iree_memory_order_relaxed);
   dispatch_task->tile_count =
       workgroup_count[0] * workgroup_count[1] * workgroup_count[2];
+  if (dispatch_task->profile) {
+    memcpy(dispatch_task->profile->workgroup_count, workgroup_count,
+           sizeof(dispatch_task->profile->workgroup_count));
+  }
 
-  // Compute shard count - almost always worker_count unless we are a very small
-  // dispatch (1x1x1, etc).
+  // Compute shard count - almost always the live worker count unless we are a
+  // very small dispatch (1x1x1, etc).
   iree_host_size_t worker_count = iree_task_post_batch_worker_count(post_batch);
   iree_host_size_t shard_count =
       iree_min(dispatch_task->tile_count, worker_count);
 
   // Compute how many tiles we want each shard to reserve at a time from the
-  // larger grid. A higher number reduces overhead and improves locality while
-  // a lower number reduces maximum worst-case latency (coarser work stealing).
-  if (dispatch_task->tile_count <
-      worker_count * IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION) {
-    // Grid is small - allow it to be eagerly sliced up.
-    dispatch_task->tiles_per_reservation = 1;
-  } else {
-    dispatch_task->tiles_per_reservation =
-        IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION;
+  // larger grid based on the cost measured from prior dispatches with the same
+  // cost key, if any.
+  int64_t tile_duration_ns = 0;
+  dispatch_task->cost = NULL;
+  if (dispatch_task->cost_key) {
+    dispatch_task->cost = iree_task_executor_lookup_dispatch_cost(
+        post_batch->executor, dispatch_task->cost_key);
+    tile_duration_ns = iree_atomic_load_int64(
+        &dispatch_task->cost->tile_duration_ns, iree_memory_order_relaxed);
   }
-
-  // Randomize starting worker.
-  iree_host_size_t worker_offset = iree_task_post_batch_select_worker(
+  dispatch_task->tiles_per_reservation =
+      iree_task_dispatch_select_tiles_per_reservation(
+          dispatch_task->tile_count, worker_count, tile_duration_ns);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, tile_duration_ns);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, dispatch_task->tiles_per_reservation);
+  IREE_TRACE_PLOT_VALUE_I64("iree_task_dispatch_tiles_per_reservation",
+                            dispatch_task->tiles_per_reservation);
+
+  // Randomize starting worker and then round-robin across the live workers.
+  const iree_task_affinity_set_t worker_live_mask =
+      post_batch->worker_live_mask;
+  int worker_index = (int)iree_task_post_batch_select_worker(
       post_batch, dispatch_task->header.affinity_set);
-  iree_host_size_t worker_index = worker_offset;
 
   for (iree_host_size_t i = 0; i < shard_count; ++i) {
     // Allocate and initialize the shard.
@@ -628,9 +722,13 @@ void iree_task_dispatch_issue(iree_task_dispatch_t* dispatch_task,
         iree_task_dispatch_shard_allocate(dispatch_task, shard_task_pool);
 
     // Enqueue on the worker selected for the task.
-    iree_task_post_batch_enqueue(post_batch, worker_index % worker_count,
+    iree_task_post_batch_enqueue(post_batch, (iree_host_size_t)worker_index,
                                  &shard_task->header);
-    ++worker_index;
+    worker_index =
+        iree_task_affinity_set_find_next(worker_live_mask, worker_index + 1);
+    if (worker_index < 0) {
+      worker_index = iree_task_affinity_set_find_next(worker_live_mask, 0);
+    }
   }
 
   // NOTE: the dispatch is not retired until all shards complete. Upon the last
@@ -706,11 +804,14 @@ iree_task_dispatch_shard_t* iree_task_dispatch_shard_allocate(
   return shard_task;
 }
 
-void iree_task_dispatch_shard_execute(
-    iree_task_dispatch_shard_t* task, iree_cpu_processor_id_t processor_id,
-    iree_byte_span_t worker_local_memory,
+bool iree_task_dispatch_shard_execute(
+    iree_task_dispatch_shard_t* task, iree_host_size_t worker_index,
+    iree_cpu_processor_id_t processor_id,
+    iree_task_local_memory_t* worker_local_memory,
+    iree_atomic_int32_t* pending_priority_mask, uint32_t* out_tiles_executed,
     iree_task_submission_t* pending_submission) {
   IREE_TRACE_ZONE_BEGIN(z0);
+  if (out_tiles_executed) *out_tiles_executed = 0;
 
   iree_task_dispatch_t* dispatch_task = iree_task_dispatch_shard_parent(task);
   IREE_TRACE_ZONE_APPEND_VALUE(z0, dispatch_task->dispatch_id);
@@ -719,22 +820,17 @@ void iree_task_dispatch_shard_execute(
 
   // Map only the requested amount of worker local memory into the tile context.
   // This ensures that how much memory is used by some executions does not
-  // inadvertently leak over into other executions.
-  if (IREE_UNLIKELY(dispatch_task->local_memory_size >
-                    worker_local_memory.data_length)) {
-    iree_task_try_set_status(
-        &dispatch_task->status,
-        iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
-                         "dispatch requires %ub of local memory but only "
-                         "%zub is available per-worker",
-                         dispatch_task->local_memory_size,
-                         worker_local_memory.data_length));
+  // inadvertently leak over into other executions. The worker local memory is
+  // only grown if this dispatch needs more than any prior dispatch has.
+  iree_byte_span_t local_memory = iree_byte_span_empty();
+  iree_status_t local_memory_status = iree_task_local_memory_acquire(
+      worker_local_memory, dispatch_task->local_memory_size, &local_memory);
+  if (IREE_UNLIKELY(!iree_status_is_ok(local_memory_status))) {
+    iree_task_try_set_status(&dispatch_task->status, local_memory_status);
     iree_task_retire(&task->header, pending_submission, iree_ok_status());
     IREE_TRACE_ZONE_END(z0);
-    return;
+    return true;
   }
-  iree_byte_span_t local_memory = iree_make_byte_span(
-      worker_local_memory.data, dispatch_task->local_memory_size);
 
   // Prepare context shared for all tiles in the shard.
   iree_task_tile_context_t tile_context;
@@ -756,6 +852,20 @@ void iree_task_dispatch_shard_execute(
   // Hint as to which processor we are running on.
   tile_context.processor_id = processor_id;
 
+  // Measure the shard for cost tracking and profiling. We only time the shard
+  // as a whole to keep the overhead to a pair of clock queries regardless of
+  // tile count.
+  iree_task_dispatch_cost_t* cost = dispatch_task->cost;
+  iree_task_dispatch_profile_t* profile = dispatch_task->profile;
+  const iree_time_t shard_start_ns = cost || profile ? iree_time_now() : 0;
+  uint32_t tiles_executed = 0;
+
+  // Bits of all priorities that should preempt this shard. HIGH has no bits and
+  // never yields.
+  const int32_t preempting_priority_mask =
+      (1 << iree_task_scope_priority(task->header.scope)) - 1;
+  bool did_yield = false;
+
   // Loop over all tiles until they are all processed.
   const uint32_t tile_count = dispatch_task->tile_count;
   const uint32_t tiles_per_reservation = dispatch_task->tiles_per_reservation;
@@ -765,53 +875,119 @@ void iree_task_dispatch_shard_execute(
   while (tile_base < tile_count) {
     const uint32_t tile_range =
         iree_min(tile_base + tiles_per_reservation, tile_count);
-    for (uint32_t tile_index = tile_base; tile_index < tile_range;
-         ++tile_index) {
-      // TODO(benvanik): faster math here, especially knowing we pull off N
-      // sequential indices per reservation.
-      uint32_t tile_i = tile_index;
+    tiles_executed += tile_range - tile_base;
+    if (dispatch_task->closure.range_fn) {
+      // Hand the entire reservation to the closure in a single call.
+      uint32_t tile_i = tile_base;
       tile_context.workgroup_xyz[0] = tile_i % workgroup_count_x;
       tile_i /= workgroup_count_x;
       tile_context.workgroup_xyz[1] = tile_i % workgroup_count_y;
       tile_i /= workgroup_count_y;
       tile_context.workgroup_xyz[2] = tile_i;
 
-      IREE_TRACE_ZONE_BEGIN_NAMED(z_tile,
-                                  "iree_task_dispatch_shard_execute_tile");
-      IREE_TRACE_ZONE_SET_COLOR(z_tile, iree_task_tile_to_color(&tile_context));
-
-      // NOTE: these are useful for debugging but dramatically increase our
-      // cost here; only enable if needed for tracking work distribution:
-      IREE_TRACE_ZONE_APPEND_VALUE(z_tile, tile_context.workgroup_xyz[0]);
-      IREE_TRACE_ZONE_APPEND_VALUE(z_tile, tile_context.workgroup_xyz[1]);
-      IREE_TRACE_ZONE_APPEND_VALUE(z_tile, tile_context.workgroup_xyz[2]);
-      // IREE_TRACE_ZONE_APPEND_VALUE(z_tile, (uint64_t)task->closure.fn);
-
-      iree_status_t status =
-          dispatch_task->closure.fn(dispatch_task->closure.user_context,
-                                    &tile_context, pending_submission);
-
-      IREE_TRACE_ZONE_END(z_tile);
-
-      // If any tile fails we bail early from the loop. This doesn't match
-      // what an accelerator would do but saves some unneeded work.
-      // Note that other shards may have completed execution, be executing
-      // concurrently with this one, or still be pending - this does not
-      // have any influence on them and they may continue to execute even
-      // after we bail from here.
+      IREE_TRACE_ZONE_BEGIN_NAMED(z_range,
+                                  "iree_task_dispatch_shard_execute_range");
+      IREE_TRACE_ZONE_SET_COLOR(z_range,
+                                iree_task_tile_to_color(&tile_context));
+      IREE_TRACE_ZONE_APPEND_VALUE(z_range, tile_range - tile_base);
+
+      iree_status_t status = dispatch_task->closure.range_fn(
+          dispatch_task->closure.user_context, &tile_context,
+          tile_range - tile_base, pending_submission);
+
+      IREE_TRACE_ZONE_END(z_range);
+
       if (!iree_status_is_ok(status)) {
-        // Propagate failures to the dispatch task.
         iree_task_try_set_status(&dispatch_task->status, status);
-        goto abort_shard;  // out of the while-for nest
+        goto abort_shard;  // out of the while loop
+      }
+    } else {
+      for (uint32_t tile_index = tile_base; tile_index < tile_range;
+           ++tile_index) {
+        // TODO(benvanik): faster math here, especially knowing we pull off N
+        // sequential indices per reservation.
+        uint32_t tile_i = tile_index;
+        tile_context.workgroup_xyz[0] = tile_i % workgroup_count_x;
+        tile_i /= workgroup_count_x;
+        tile_context.workgroup_xyz[1] = tile_i % workgroup_count_y;
+        tile_i /= workgroup_count_y;
+        tile_context.workgroup_xyz[2] = tile_i;
+
+        IREE_TRACE_ZONE_BEGIN_NAMED(z_tile,
+                                    "iree_task_dispatch_shard_execute_tile");
+        IREE_TRACE_ZONE_SET_COLOR(z_tile,
+                                  iree_task_tile_to_color(&tile_context));
+
+        // NOTE: these are useful for debugging but dramatically increase our
+        // cost here; only enable if needed for tracking work distribution:
+        IREE_TRACE_ZONE_APPEND_VALUE(z_tile, tile_context.workgroup_xyz[0]);
+        IREE_TRACE_ZONE_APPEND_VALUE(z_tile, tile_context.workgroup_xyz[1]);
+        IREE_TRACE_ZONE_APPEND_VALUE(z_tile, tile_context.workgroup_xyz[2]);
+        // IREE_TRACE_ZONE_APPEND_VALUE(z_tile, (uint64_t)task->closure.fn);
+
+        iree_status_t status =
+            dispatch_task->closure.fn(dispatch_task->closure.user_context,
+                                      &tile_context, pending_submission);
+
+        IREE_TRACE_ZONE_END(z_tile);
+
+        // If any tile fails we bail early from the loop. This doesn't match
+        // what an accelerator would do but saves some unneeded work.
+        // Note that other shards may have completed execution, be executing
+        // concurrently with this one, or still be pending - this does not
+        // have any influence on them and they may continue to execute even
+        // after we bail from here.
+        if (!iree_status_is_ok(status)) {
+          // Propagate failures to the dispatch task.
+          iree_task_try_set_status(&dispatch_task->status, status);
+          goto abort_shard;  // out of the while-for nest
+        }
       }
     }
 
+    // Yield to higher priority work posted to the executing worker before
+    // reserving more tiles. The shard will resume where the dispatch left off
+    // when it is next executed.
+    if (pending_priority_mask &&
+        (iree_atomic_load_int32(pending_priority_mask,
+                                iree_memory_order_relaxed) &
+         preempting_priority_mask)) {
+      IREE_TRACE_ZONE_APPEND_TEXT(z0, "yield");
+      did_yield = true;
+      break;
+    }
+
     // Try to grab the next slice of tiles.
     tile_base = iree_atomic_fetch_add_int32(&dispatch_task->tile_index,
                                             tiles_per_reservation,
                                             iree_memory_order_relaxed);
   }
+
+  // Fold the measured per-tile duration into the cost estimate so long as the
+  // entry has not been reassigned to another key while we were executing.
+  if (cost && tiles_executed > 0 &&
+      iree_atomic_load_int64(&cost->key, iree_memory_order_relaxed) ==
+          (int64_t)dispatch_task->cost_key) {
+    const int64_t sample_ns =
+        iree_max(1, (iree_time_now() - shard_start_ns) / tiles_executed);
+    const int64_t prior_ns = iree_atomic_load_int64(&cost->tile_duration_ns,
+                                                    iree_memory_order_relaxed);
+    const int64_t estimate_ns =
+        prior_ns ? prior_ns + (sample_ns - prior_ns) /
+                                  IREE_TASK_DISPATCH_COST_SMOOTHING_DIVISOR
+                 : sample_ns;
+    iree_atomic_store_int64(&cost->tile_duration_ns, estimate_ns,
+                            iree_memory_order_relaxed);
+  }
 abort_shard:
+  if (out_tiles_executed) *out_tiles_executed = tiles_executed;
+
+  // Record partial shards as well so that failing dispatches still show up.
+  if (profile && tiles_executed > 0) {
+    iree_task_dispatch_profile_record_shard(profile, worker_index,
+                                            shard_start_ns, iree_time_now(),
+                                            tiles_executed);
+  }
 
   // Push aggregate statistics up to the dispatch.
   // Note that we may have partial information here if we errored out of the
@@ -819,8 +995,16 @@ abort_shard:
   iree_task_dispatch_statistics_merge(&shard_statistics,
                                       &dispatch_task->statistics);
 
+  // A yielded shard keeps the dispatch alive until it is resumed and finds no
+  // more tiles remaining.
+  if (did_yield) {
+    IREE_TRACE_ZONE_END(z0);
+    return false;
+  }
+
   // NOTE: even if an error was hit we retire OK - the error has already been
   // propagated to the dispatch and it'll clean up after all shards are joined.
   iree_task_retire(&task->header, pending_submission, iree_ok_status());
   IREE_TRACE_ZONE_END(z0);
+  return true;
 }
@@ -183,9 +183,13 @@ struct iree_alignas(iree_max_align_t) iree_task_t {
 };
 static_assert(offsetof(iree_task_t, next_task) == 0,
               "next_task intrusive pointer must be at offset 0");
+#if IREE_TASK_AFFINITY_SET_WORD_COUNT == 1
+// NOTE: executors configured for more than 64 workers trade a larger header
+// for the wider affinity set.
 static_assert(sizeof(iree_task_t) <= 64,
               "the task header greatly influences pool sizes due to alignment "
               "requirements and should be kept tiny");
+#endif  // IREE_TASK_AFFINITY_SET_WORD_COUNT == 1
 
 // Initializes a task header with the given type.
 // Must be called on all tasks to ensure proper dependency tracking and list
@@ -505,6 +509,43 @@ void iree_task_dispatch_statistics_merge(
     const iree_task_dispatch_statistics_t* source,
     iree_task_dispatch_statistics_t* target);
 
+// Measured execution cost of the tiles of dispatches sharing a cost key.
+// Entries are owned by the executor and used to select reservation sizes for
+// subsequent dispatches with the same key. Updates are racy but as the values
+// are only estimates this is not a problem.
+typedef struct iree_task_dispatch_cost_t {
+  // Cost key the entry is currently assigned to or 0 if unused.
+  iree_atomic_int64_t key;
+  // Moving average of the per-tile duration in nanoseconds or 0 if not yet
+  // measured.
+  iree_atomic_int64_t tile_duration_ns;
+} iree_task_dispatch_cost_t;
+
+// Profile of a single dispatch execution.
+// Allocated by the owner of the dispatch with |worker_capacity| trailing
+// counters and attached to the dispatch prior to it being issued. Updated once
+// per shard execution (instead of once per tile) so that the profiling overhead
+// is independent of the number of tiles in the dispatch.
+typedef struct iree_task_dispatch_profile_t {
+  // Time the first shard started executing tiles or 0 if none have.
+  iree_atomic_int64_t start_ns;
+  // Time the last shard finished executing tiles or 0 if none have.
+  iree_atomic_int64_t end_ns;
+  // Workgroup count the dispatch was issued with. Indirect dispatches have
+  // their workgroup count resolved prior to assignment.
+  uint32_t workgroup_count[3];
+  // Total number of counters in |worker_tile_counts|.
+  uint32_t worker_capacity;
+  // Number of tiles executed by each worker indexed by worker index. Tiles
+  // executed by threads donated to the executor are counted in the last
+  // counter.
+  iree_atomic_int32_t worker_tile_counts[];
+} iree_task_dispatch_profile_t;
+
+// Initializes |out_profile| with |worker_capacity| counters.
+void iree_task_dispatch_profile_initialize(
+    uint32_t worker_capacity, iree_task_dispatch_profile_t* out_profile);
+
 typedef struct iree_task_tile_storage_t {
   // TODO(benvanik): coroutine storage.
   // Ideally we'll be able to have a fixed coroutine storage size per dispatch
@@ -555,11 +596,22 @@ typedef iree_status_t(IREE_API_PTR* iree_task_dispatch_closure_fn_t)(
     void* user_context, const iree_task_tile_context_t* tile_context,
     iree_task_submission_t* pending_submission);
 
+// Function called with a contiguous range of |tile_count| tiles starting at the
+// |tile_context| workgroup_xyz. Tiles are ordered with X varying fastest and
+// the range never extends past the end of the dispatch grid.
+typedef iree_status_t(IREE_API_PTR* iree_task_dispatch_range_closure_fn_t)(
+    void* user_context, const iree_task_tile_context_t* tile_context,
+    uint32_t tile_count, iree_task_submission_t* pending_submission);
+
 // A function closure representing the function to call and its arguments.
 typedef struct iree_task_dispatch_closure_t {
   // Function called per tile invocation.
   iree_task_dispatch_closure_fn_t fn;
 
+  // Optional function called once per reservation of tiles instead of |fn|.
+  // Allows the closure to amortize per-tile setup across all reserved tiles.
+  iree_task_dispatch_range_closure_fn_t range_fn;
+
   // User-defined argument passed to task functions during invocation.
   // Opaque pointer-sized values that could point to user data structures or
   // contain embedded values. No lifetime management is performed by the task
@@ -573,7 +625,17 @@ typedef struct iree_task_dispatch_closure_t {
 // has completed execution.
 static inline iree_task_dispatch_closure_t iree_task_make_dispatch_closure(
     iree_task_dispatch_closure_fn_t fn, void* user_context) {
-  iree_task_dispatch_closure_t closure = {fn, user_context};
+  iree_task_dispatch_closure_t closure = {fn, NULL, user_context};
+  return closure;
+}
+
+// Binds a per-tile function pointer and a function processing ranges of tiles
+// that will be used in its place when executing reservations of tiles.
+static inline iree_task_dispatch_closure_t
+iree_task_make_dispatch_range_closure(
+    iree_task_dispatch_closure_fn_t fn,
+    iree_task_dispatch_range_closure_fn_t range_fn, void* user_context) {
+  iree_task_dispatch_closure_t closure = {fn, range_fn, user_context};
   return closure;
 }
 
@@ -625,6 +687,23 @@ typedef iree_alignas(iree_max_align_t) struct iree_task_dispatch_t {
   // dispatch closure.
   uint32_t local_memory_size;
 
+  // Optional key identifying the work performed by each tile (such as an
+  // executable export) used to track tile costs across dispatches. When
+  // non-zero shards measure their execution time and future dispatches with
+  // the same key size their tile reservations to keep reservation overhead
+  // under IREE_TASK_DISPATCH_RESERVATION_OVERHEAD_DIVISOR of their runtime.
+  // When 0 reservations are based only on the tile and worker counts.
+  uint64_t cost_key;
+
+  // Cost tracking entry for |cost_key| resolved when the dispatch is issued or
+  // NULL if costs are not tracked.
+  iree_task_dispatch_cost_t* cost;
+
+  // Optional profile updated by each shard as it executes tiles or NULL if the
+  // dispatch is not being profiled. Must remain valid until the dispatch has
+  // retired.
+  iree_task_dispatch_profile_t* profile;
+
   // Resulting status from the dispatch available once all workgroups have
   // completed (or would have completed). If multiple shards processing the
   // workgroups hit an error the first will be taken and the result ignored. A
@@ -640,7 +719,9 @@ typedef iree_alignas(iree_max_align_t) struct iree_task_dispatch_t {
 
   // Maximum number of tiles to fetch per tile reservation from the grid.
   // Bounded by IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION and a
-  // reasonable number chosen based on the tile and shard counts.
+  // reasonable number chosen based on the tile and shard counts or, if the
+  // dispatch has a |cost_key| with a measured cost, by
+  // IREE_TASK_DISPATCH_MAX_ADAPTIVE_TILES_PER_SHARD_RESERVATION.
   uint32_t tiles_per_reservation;
 
   // The tail tile index; the next reservation will start from here.
@@ -8,6 +8,7 @@
 #define IREE_TASK_TASK_IMPL_H_
 
 #include "iree/task/list.h"
+#include "iree/task/local_memory.h"
 #include "iree/task/pool.h"
 #include "iree/task/post_batch.h"
 #include "iree/task/submission.h"
@@ -111,18 +112,34 @@ iree_task_dispatch_shard_t* iree_task_dispatch_shard_allocate(
 // May block the caller for an indeterminate amount of time and should only be
 // called from threads owned by or donated to the executor.
 //
+// |worker_index| is the index of the executing worker or the executor worker
+// count if the shard is executing on a thread donated to the executor.
+//
 // |processor_id| is a guess as to which logical processor the shard is
 // executing on. It may be out of date or 0 if the processor could not be
 // queried.
 //
-// |worker_local_memory| is a block of memory exclusively available to the shard
-// during execution. Contents are undefined both before and after execution.
+// |worker_local_memory| is persistent memory exclusively available to the shard
+// during execution and is grown if the dispatch requires more than is
+// currently available. Contents are undefined both before and after execution.
+//
+// |pending_priority_mask| is an optional bitmask of (1 << iree_task_priority_t)
+// for work pending on the executing thread. If any priority higher than that of
+// the shard is set between tile reservations the shard yields by returning
+// false without retiring so that the caller can run the higher priority work
+// and then execute the shard again to resume processing tiles. Returns true if
+// the shard has completed and been retired.
+//
+// |out_tiles_executed| is optional and receives the number of tiles executed
+// by this call.
 //
 // Errors are propagated to the parent scope and the dispatch will fail once
 // all shards have completed.
-void iree_task_dispatch_shard_execute(
-    iree_task_dispatch_shard_t* task, iree_cpu_processor_id_t processor_id,
-    iree_byte_span_t worker_local_memory,
+bool iree_task_dispatch_shard_execute(
+    iree_task_dispatch_shard_t* task, iree_host_size_t worker_index,
+    iree_cpu_processor_id_t processor_id,
+    iree_task_local_memory_t* worker_local_memory,
+    iree_atomic_int32_t* pending_priority_mask, uint32_t* out_tiles_executed,
     iree_task_submission_t* pending_submission);
 
 #ifdef __cplusplus
@@ -6,7 +6,9 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 #include "iree/base/api.h"
 #include "iree/task/submission.h"
@@ -113,6 +115,201 @@ TEST_F(TaskDispatchTest, Issue345) {
   DispatchAndVerifyGrid(kWorkgroupSize, kWorkgroupCount, IREE_TASK_FLAG_NONE);
 }
 
+// Tests that executor statistics account for every tile executed.
+TEST_F(TaskDispatchTest, QueryStatistics) {
+  IREE_TRACE_SCOPE();
+  const uint32_t kWorkgroupSize[3] = {1, 1, 1};
+  const uint32_t kWorkgroupCount[3] = {3, 4, 5};
+  DispatchAndVerifyGrid(kWorkgroupSize, kWorkgroupCount, IREE_TASK_FLAG_NONE);
+
+  iree_task_executor_statistics_t statistics;
+  std::vector<iree_task_worker_statistics_t> worker_statistics(
+      iree_task_executor_worker_count(executor_));
+  IREE_ASSERT_OK(iree_task_executor_query_statistics(
+      executor_, worker_statistics.size(), worker_statistics.data(),
+      &statistics));
+  EXPECT_EQ(worker_statistics.size(), statistics.worker_count);
+  EXPECT_EQ(3 * 4 * 5, statistics.worker_totals.tile_count);
+  EXPECT_GE(statistics.worker_totals.task_count, 1);
+  EXPECT_GE(statistics.coordination_count, 1);
+  uint64_t tile_count = 0;
+  for (const auto& worker : worker_statistics) tile_count += worker.tile_count;
+  EXPECT_EQ(statistics.worker_totals.tile_count, tile_count);
+
+  // Totals can be queried without the per-worker statistics but asking for
+  // them without enough capacity fails.
+  IREE_ASSERT_OK(iree_task_executor_query_statistics(
+      executor_, /*worker_capacity=*/0, /*out_worker_statistics=*/NULL,
+      &statistics));
+  EXPECT_THAT(Status(iree_task_executor_query_statistics(
+                  executor_, /*worker_capacity=*/1, worker_statistics.data(),
+                  &statistics)),
+              StatusIs(StatusCode::kOutOfRange));
+}
+
+// Tests that profiled dispatches record their workgroup count, execution time,
+// and the distribution of tiles across workers.
+TEST_F(TaskDispatchTest, IssueProfiled) {
+  IREE_TRACE_SCOPE();
+  const uint32_t kWorkgroupSize[3] = {1, 1, 1};
+  const uint32_t kWorkgroupCount[3] = {3, 4, 5};
+  GridCoverage coverage(kWorkgroupCount);
+
+  const uint32_t worker_capacity =
+      (uint32_t)iree_task_executor_worker_count(executor_) + 1;
+  std::vector<uint8_t> profile_storage(
+      sizeof(iree_task_dispatch_profile_t) +
+      worker_capacity * sizeof(iree_atomic_int32_t));
+  iree_task_dispatch_profile_t* profile =
+      reinterpret_cast<iree_task_dispatch_profile_t*>(profile_storage.data());
+  iree_task_dispatch_profile_initialize(worker_capacity, profile);
+
+  iree_task_dispatch_t task;
+  iree_task_dispatch_initialize(
+      &scope_,
+      iree_task_make_dispatch_closure(GridCoverage::Tile, (void*)&coverage),
+      kWorkgroupSize, kWorkgroupCount, &task);
+  task.profile = profile;
+  IREE_ASSERT_OK(SubmitTasksAndWaitIdle(&task.header, &task.header));
+  EXPECT_TRUE(coverage.Verify());
+
+  EXPECT_EQ(profile->workgroup_count[0], kWorkgroupCount[0]);
+  EXPECT_EQ(profile->workgroup_count[1], kWorkgroupCount[1]);
+  EXPECT_EQ(profile->workgroup_count[2], kWorkgroupCount[2]);
+  int64_t start_ns =
+      iree_atomic_load_int64(&profile->start_ns, iree_memory_order_seq_cst);
+  int64_t end_ns =
+      iree_atomic_load_int64(&profile->end_ns, iree_memory_order_seq_cst);
+  EXPECT_GT(start_ns, 0);
+  EXPECT_GE(end_ns, start_ns);
+  int32_t tile_count = 0;
+  for (uint32_t i = 0; i < worker_capacity; ++i) {
+    tile_count += iree_atomic_load_int32(&profile->worker_tile_counts[i],
+                                         iree_memory_order_seq_cst);
+  }
+  EXPECT_EQ(tile_count, 3 * 4 * 5);
+}
+
+// Tests that dispatches with a cost key adapt their reservation size once the
+// tile cost has been measured. The tiles here are trivially cheap and should
+// end up reserving more tiles at a time than the unmeasured default.
+TEST_F(TaskDispatchTest, IssueAdaptiveReservation) {
+  IREE_TRACE_SCOPE();
+  const uint32_t kWorkgroupSize[3] = {1, 1, 1};
+  const uint32_t kWorkgroupCount[3] = {4096, 1, 1};
+  const uint64_t kCostKey = 0x1234u;
+
+  for (int i = 0; i < 2; ++i) {
+    GridCoverage coverage(kWorkgroupCount);
+    iree_task_dispatch_t task;
+    iree_task_dispatch_initialize(
+        &scope_,
+        iree_task_make_dispatch_closure(GridCoverage::Tile, (void*)&coverage),
+        kWorkgroupSize, kWorkgroupCount, &task);
+    task.cost_key = kCostKey;
+    IREE_ASSERT_OK(SubmitTasksAndWaitIdle(&task.header, &task.header));
+    EXPECT_TRUE(coverage.Verify());
+    if (i == 0) {
+      EXPECT_EQ(IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION,
+                task.tiles_per_reservation);
+    } else {
+      EXPECT_GT(task.tiles_per_reservation,
+                IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION);
+    }
+  }
+}
+
+// Tracks the progress of a low priority dispatch relative to a high priority
+// call submitted while the dispatch is executing.
+struct PreemptionState {
+  iree_atomic_int32_t tiles_executed = IREE_ATOMIC_VAR_INIT(0);
+  iree_atomic_int32_t tiles_executed_at_call = IREE_ATOMIC_VAR_INIT(-1);
+
+  static iree_status_t Tile(void* user_context,
+                            const iree_task_tile_context_t* tile_context,
+                            iree_task_submission_t* pending_submission) {
+    auto* state = reinterpret_cast<PreemptionState*>(user_context);
+    iree_atomic_fetch_add_int32(&state->tiles_executed, 1,
+                                iree_memory_order_seq_cst);
+    iree_wait_until(iree_time_now() + 100 * 1000);
+    return iree_ok_status();
+  }
+
+  static iree_status_t Call(void* user_context, iree_task_t* task,
+                            iree_task_submission_t* pending_submission) {
+    auto* state = reinterpret_cast<PreemptionState*>(user_context);
+    iree_atomic_store_int32(
+        &state->tiles_executed_at_call,
+        iree_atomic_load_int32(&state->tiles_executed,
+                               iree_memory_order_seq_cst),
+        iree_memory_order_seq_cst);
+    return iree_ok_status();
+  }
+};
+
+// Tests that a high priority task submitted while a low priority dispatch is
+// executing on all workers preempts the dispatch shards between tile
+// reservations instead of waiting for the whole dispatch to complete.
+TEST_F(TaskDispatchTest, IssuePreemptedByHighPriority) {
+  IREE_TRACE_SCOPE();
+  const uint32_t kWorkgroupSize[3] = {1, 1, 1};
+  const uint32_t kWorkgroupCount[3] = {1024, 1, 1};
+  PreemptionState state;
+
+  // Start the low priority dispatch and wait until it is executing.
+  iree_task_scope_set_priority(&scope_, IREE_TASK_PRIORITY_LOW);
+  iree_task_dispatch_t dispatch_task;
+  iree_task_dispatch_initialize(
+      &scope_,
+      iree_task_make_dispatch_closure(PreemptionState::Tile, (void*)&state),
+      kWorkgroupSize, kWorkgroupCount, &dispatch_task);
+  iree_task_fence_t* low_fence = NULL;
+  IREE_ASSERT_OK(iree_task_executor_acquire_fence(executor_, &scope_,
+                                                  &low_fence));
+  iree_task_set_completion_task(&dispatch_task.header, &low_fence->header);
+  iree_task_submission_t low_submission;
+  iree_task_submission_initialize(&low_submission);
+  iree_task_submission_enqueue(&low_submission, &dispatch_task.header);
+  iree_task_executor_submit(executor_, &low_submission);
+  iree_task_executor_flush(executor_);
+  while (iree_atomic_load_int32(&state.tiles_executed,
+                                iree_memory_order_seq_cst) == 0) {
+    iree_wait_until(iree_time_now() + 10 * 1000);
+  }
+
+  // Submit the high priority call and wait for it to complete; it should not
+  // need to wait for the dispatch.
+  iree_task_scope_t high_scope;
+  iree_task_scope_initialize(iree_make_cstring_view("high"), &high_scope);
+  iree_task_scope_set_priority(&high_scope, IREE_TASK_PRIORITY_HIGH);
+  iree_task_call_t call_task;
+  iree_task_call_initialize(
+      &high_scope,
+      iree_task_make_call_closure(PreemptionState::Call, (void*)&state),
+      &call_task);
+  iree_task_fence_t* high_fence = NULL;
+  IREE_ASSERT_OK(iree_task_executor_acquire_fence(executor_, &high_scope,
+                                                  &high_fence));
+  iree_task_set_completion_task(&call_task.header, &high_fence->header);
+  iree_task_submission_t high_submission;
+  iree_task_submission_initialize(&high_submission);
+  iree_task_submission_enqueue(&high_submission, &call_task.header);
+  iree_task_executor_submit(executor_, &high_submission);
+  iree_task_executor_flush(executor_);
+  IREE_ASSERT_OK(
+      iree_task_scope_wait_idle(&high_scope, IREE_TIME_INFINITE_FUTURE));
+  iree_task_scope_deinitialize(&high_scope);
+
+  // The dispatch should still complete all tiles after being preempted.
+  IREE_ASSERT_OK(iree_task_scope_wait_idle(&scope_, IREE_TIME_INFINITE_FUTURE));
+  EXPECT_EQ(1024, iree_atomic_load_int32(&state.tiles_executed,
+                                         iree_memory_order_seq_cst));
+  int32_t tiles_executed_at_call = iree_atomic_load_int32(
+      &state.tiles_executed_at_call, iree_memory_order_seq_cst);
+  EXPECT_GE(tiles_executed_at_call, 1);
+  EXPECT_LT(tiles_executed_at_call, 1024);
+}
+
 TEST_F(TaskDispatchTest, IssueIndirect) {
   IREE_TRACE_SCOPE();
 
@@ -149,6 +346,42 @@ TEST_F(TaskDispatchTest, IssueIndirect) {
   EXPECT_TRUE(coverage.Verify());
 }
 
+// Tests that dispatches requiring more local memory than the workers have
+// reserved grow the worker local memory instead of failing.
+TEST_F(TaskDispatchTest, IssueLocalMemoryGrowth) {
+  IREE_TRACE_SCOPE();
+
+  const uint32_t kWorkgroupSize[3] = {1, 1, 1};
+  const uint32_t kWorkgroupCount[3] = {16, 1, 1};
+  // Larger than the 64KB reserved by the test executor.
+  const uint32_t kLocalMemorySize = 256 * 1024;
+
+  auto tile = [](void* user_context,
+                 const iree_task_tile_context_t* tile_context,
+                 iree_task_submission_t* pending_submission) -> iree_status_t {
+    IREE_TRACE_SCOPE();
+    const iree_byte_span_t local_memory = tile_context->local_memory;
+    if (local_memory.data_length != 256 * 1024 ||
+        ((uintptr_t)local_memory.data %
+         iree_hardware_destructive_interference_size) != 0) {
+      return iree_make_status(IREE_STATUS_INTERNAL,
+                              "unexpected local memory");
+    }
+    memset(local_memory.data, 0xCD, local_memory.data_length);
+    return iree_ok_status();
+  };
+
+  for (int i = 0; i < 2; ++i) {
+    iree_task_dispatch_t task;
+    iree_task_dispatch_initialize(&scope_,
+                                  iree_task_make_dispatch_closure(tile, NULL),
+                                  kWorkgroupSize, kWorkgroupCount, &task);
+    task.local_memory_size = kLocalMemorySize;
+    IREE_ASSERT_OK(SubmitTasksAndWaitIdle(&task.header, &task.header));
+    IREE_EXPECT_OK(iree_task_scope_consume_status(&scope_));
+  }
+}
+
 TEST_F(TaskDispatchTest, IssueFailure) {
   IREE_TRACE_SCOPE();
 
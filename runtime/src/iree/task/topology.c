@@ -65,6 +65,32 @@ const iree_task_topology_group_t* iree_task_topology_get_group(
   return &topology->groups[group_index];
 }
 
+iree_task_topology_group_mask_t iree_task_topology_calculate_node_sharing_mask(
+    const iree_task_topology_t* topology, iree_host_size_t group_index) {
+  iree_task_topology_group_mask_t mask = iree_task_affinity_set_empty();
+  if (group_index >= topology->group_count) return mask;
+  const uint32_t numa_node = topology->groups[group_index].numa_node;
+  for (iree_host_size_t i = 0; i < topology->group_count; ++i) {
+    if (i == group_index) continue;
+    if (topology->groups[i].numa_node == numa_node) {
+      iree_task_affinity_set_insert(&mask, topology->groups[i].group_index);
+    }
+  }
+  return mask;
+}
+
+uint32_t iree_task_topology_query_common_numa_node(
+    const iree_task_topology_t* topology) {
+  if (topology->group_count == 0) return IREE_TASK_TOPOLOGY_NUMA_NODE_ANY;
+  const uint32_t numa_node = topology->groups[0].numa_node;
+  for (iree_host_size_t i = 1; i < topology->group_count; ++i) {
+    if (topology->groups[i].numa_node != numa_node) {
+      return IREE_TASK_TOPOLOGY_NUMA_NODE_ANY;
+    }
+  }
+  return numa_node;
+}
+
 iree_status_t iree_task_topology_push_group(
     iree_task_topology_t* topology, const iree_task_topology_group_t* group) {
   if (topology->group_count + 1 > IREE_ARRAYSIZE(topology->groups)) {
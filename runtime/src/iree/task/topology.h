@@ -13,6 +13,7 @@
 
 #include "iree/base/api.h"
 #include "iree/base/internal/threading.h"
+#include "iree/task/affinity_set.h"
 #include "iree/task/tuning.h"
 
 #ifdef __cplusplus
@@ -21,11 +22,24 @@ extern "C" {
 
 // A bitmask indicating which other groups from 0 to N may constructively share
 // caches. For example, a value of 0b1100 indicates that group 2 and 3 share.
-typedef uint64_t iree_task_topology_group_mask_t;
+// Group indices map 1:1 to executor worker indices and use the same bitset
+// representation.
+typedef iree_task_affinity_set_t iree_task_topology_group_mask_t;
 
-#define IREE_TASK_TOPOLOGY_GROUP_MASK_ALL UINT64_MAX
-#define IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT \
-  (sizeof(iree_task_topology_group_mask_t) * 8)
+#define IREE_TASK_TOPOLOGY_GROUP_MASK_ALL iree_task_affinity_for_any_worker()
+#define IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT IREE_TASK_AFFINITY_SET_BIT_COUNT
+
+// Class of processor core on systems with heterogeneous cores such as ARM
+// big.LITTLE/DynamIQ or hybrid x86 parts.
+typedef enum iree_task_topology_core_type_e {
+  // Any core type. Used when querying to include all cores and on groups when
+  // the core type is unknown or the system cores are homogeneous.
+  IREE_TASK_TOPOLOGY_CORE_TYPE_ANY = 0,
+  // The highest-performance cores on the system ("big"/P-cores).
+  IREE_TASK_TOPOLOGY_CORE_TYPE_PERFORMANCE = 1,
+  // Any core slower than the highest-performance cores ("LITTLE"/E-cores).
+  IREE_TASK_TOPOLOGY_CORE_TYPE_EFFICIENCY = 2,
+} iree_task_topology_core_type_t;
 
 // Information about a particular group within the topology.
 // Groups may be of varying levels of granularity even within the same topology
@@ -41,11 +55,28 @@ typedef struct iree_task_topology_group_t {
   // Processor index in the cpuinfo set.
   uint32_t processor_index;
 
+  // NUMA node the processor belongs to. Groups with the same node share the
+  // same local memory controllers and are preferred when stealing work after
+  // those groups indicated in |constructive_sharing_mask|. 0 if unknown or if
+  // the system only has a single node.
+  uint32_t numa_node;
+
+  // Class of the core the group is placed on, if known.
+  iree_task_topology_core_type_t core_type;
+
   // Ideal thread affinity for threads within this group.
   // All threads within the group share the same affinity and this is what
   // allows us to model Simultaneous Multi-Threading (SMT) (aka hyperthreading).
   iree_thread_affinity_t ideal_thread_affinity;
 
+  // Priority class of the threads within this group. Latency-critical groups
+  // (such as those placed on performance cores) can be raised to have their
+  // workers preempt other work on the system.
+  iree_thread_priority_class_t thread_priority_class;
+
+  // Scheduling policy of the threads within this group.
+  iree_thread_scheduling_policy_t thread_scheduling_policy;
+
   // A bitmask of other group indices that share some level of the cache
   // hierarchy. Workers of this group are more likely to constructively share
   // some cache levels higher up with these other groups. For example, if the
@@ -108,6 +139,21 @@ iree_host_size_t iree_task_topology_group_count(
 const iree_task_topology_group_t* iree_task_topology_get_group(
     const iree_task_topology_t* topology, iree_host_size_t group_index);
 
+// Returns a bitmask of the other groups in |topology| that are on the same
+// NUMA node as the group at |group_index|.
+iree_task_topology_group_mask_t iree_task_topology_calculate_node_sharing_mask(
+    const iree_task_topology_t* topology, iree_host_size_t group_index);
+
+// Indicates that the groups of a topology are not all on a single NUMA node.
+#define IREE_TASK_TOPOLOGY_NUMA_NODE_ANY UINT32_MAX
+
+// Returns the NUMA node shared by all groups in |topology| or
+// IREE_TASK_TOPOLOGY_NUMA_NODE_ANY if the groups span multiple nodes or there
+// are no groups. Memory primarily accessed by the workers of the topology is
+// best placed on the returned node.
+uint32_t iree_task_topology_query_common_numa_node(
+    const iree_task_topology_t* topology);
+
 // Pushes a new group onto the topology set.
 // The provided group data will be copied into the topology structure.
 iree_status_t iree_task_topology_push_group(
@@ -126,6 +172,86 @@ void iree_task_topology_initialize_from_group_count(
 void iree_task_topology_initialize_from_physical_cores(
     iree_host_size_t max_core_count, iree_task_topology_t* out_topology);
 
+// Initializes a topology with one group for each physical core in the machine
+// of the given |core_type|. Groups have their core_type set and callers can
+// adjust the thread priority class and scheduling policy of the groups prior
+// to creating the executor in order to place latency-critical workers on
+// performance cores.
+//
+// Core types are derived from the relative capacity (or, if unavailable,
+// maximum frequency) of each core. If the system cores are homogeneous or their
+// types cannot be determined then groups have IREE_TASK_TOPOLOGY_CORE_TYPE_ANY
+// and all cores are used regardless of |core_type|.
+void iree_task_topology_initialize_from_physical_cores_of_type(
+    iree_task_topology_core_type_t core_type, iree_host_size_t max_core_count,
+    iree_task_topology_t* out_topology);
+
+//===----------------------------------------------------------------------===//
+// CPU limits
+//===----------------------------------------------------------------------===//
+
+// Total number of logical processors that can be represented in a cpuset.
+#define IREE_TASK_TOPOLOGY_CPUSET_BIT_COUNT 1024
+
+// CPU limits imposed on the process by its environment.
+// On Linux these are derived from the cgroup (v1 or v2) of the process such as
+// when running in a container with a CPU bandwidth quota or a cpuset. Machines
+// may also change at runtime via CPU hotplug or orchestrators may resize a
+// container and limits can be queried again to pick up the new values.
+typedef struct iree_task_topology_cpu_limits_t {
+  // Number of processors worth of time the process may consume concurrently as
+  // defined by the CPU bandwidth quota (quota / period, rounded up). 0 if no
+  // quota is imposed.
+  iree_host_size_t quota_processor_count;
+
+  // True if |cpuset| is valid; otherwise all processors are allowed.
+  bool has_cpuset;
+
+  // Bitmask of logical processor IDs the process is allowed to run on.
+  uint64_t cpuset[IREE_TASK_TOPOLOGY_CPUSET_BIT_COUNT / 64];
+} iree_task_topology_cpu_limits_t;
+
+// Initializes |out_limits| to impose no limits.
+void iree_task_topology_cpu_limits_initialize(
+    iree_task_topology_cpu_limits_t* out_limits);
+
+// Queries the CPU limits imposed on the calling process.
+// Limits that are not imposed or cannot be determined on the current platform
+// are left unset.
+void iree_task_topology_cpu_limits_query(
+    iree_task_topology_cpu_limits_t* out_limits);
+
+// Parses a CPU bandwidth quota into |limits|.
+// |value| is in the cgroup v2 cpu.max format of `$MAX $PERIOD` where `$MAX`
+// may be `max` to indicate no quota. cgroup v1 cpu.cfs_quota_us and
+// cpu.cfs_period_us values can be joined with a space to use the same format
+// (a quota of -1 indicating no quota).
+iree_status_t iree_task_topology_cpu_limits_parse_quota(
+    iree_string_view_t value, iree_task_topology_cpu_limits_t* limits);
+
+// Parses a cpuset list such as `0-3,8,10-11` into |limits|.
+// This is the format used by cgroup cpuset.cpus/cpuset.cpus.effective and the
+// /sys/devices/system/cpu/online file.
+iree_status_t iree_task_topology_cpu_limits_parse_cpuset(
+    iree_string_view_t value, iree_task_topology_cpu_limits_t* limits);
+
+// Returns true if |limits| allow running on the logical |processor_id|.
+bool iree_task_topology_cpu_limits_allow_processor(
+    const iree_task_topology_cpu_limits_t* limits, uint32_t processor_id);
+
+// Returns the number of concurrently running workers that can make progress
+// under |limits| or IREE_HOST_SIZE_MAX if unlimited.
+iree_host_size_t iree_task_topology_cpu_limits_processor_count(
+    const iree_task_topology_cpu_limits_t* limits);
+
+// Initializes a topology with one group for each physical core in the machine
+// that the process is allowed to use under |limits|. Cores with no processors
+// in the allowed cpuset are skipped and the group count is clamped to the CPU
+// bandwidth quota and |max_core_count|.
+void iree_task_topology_initialize_from_physical_cores_with_limits(
+    const iree_task_topology_cpu_limits_t* limits,
+    iree_host_size_t max_core_count, iree_task_topology_t* out_topology);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
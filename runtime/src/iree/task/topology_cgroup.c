@@ -0,0 +1,318 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <stdio.h>
+#include <string.h>
+
+#include "iree/base/api.h"
+#include "iree/base/internal/math.h"
+#include "iree/base/target_platform.h"
+#include "iree/base/tracing.h"
+#include "iree/task/topology.h"
+
+//===----------------------------------------------------------------------===//
+// iree_task_topology_cpu_limits_t
+//===----------------------------------------------------------------------===//
+
+void iree_task_topology_cpu_limits_initialize(
+    iree_task_topology_cpu_limits_t* out_limits) {
+  memset(out_limits, 0, sizeof(*out_limits));
+}
+
+iree_status_t iree_task_topology_cpu_limits_parse_quota(
+    iree_string_view_t value, iree_task_topology_cpu_limits_t* limits) {
+  iree_string_view_t quota_str = iree_string_view_empty();
+  iree_string_view_t period_str = iree_string_view_empty();
+  iree_string_view_split(iree_string_view_trim(value), ' ', &quota_str,
+                         &period_str);
+  quota_str = iree_string_view_trim(quota_str);
+  period_str = iree_string_view_trim(period_str);
+
+  // No quota is indicated with `max` (v2) or a negative value (v1).
+  if (iree_string_view_equal(quota_str, IREE_SV("max"))) {
+    limits->quota_processor_count = 0;
+    return iree_ok_status();
+  }
+  int64_t quota = 0;
+  if (!iree_string_view_atoi_int64(quota_str, &quota)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "invalid CPU quota '%.*s'", (int)value.size,
+                            value.data);
+  }
+  if (quota < 0) {
+    limits->quota_processor_count = 0;
+    return iree_ok_status();
+  }
+
+  // The period is optional in cpu.max and defaults to 100ms.
+  int64_t period = 100000;
+  if (!iree_string_view_is_empty(period_str) &&
+      (!iree_string_view_atoi_int64(period_str, &period) || period <= 0)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "invalid CPU quota period '%.*s'", (int)value.size,
+                            value.data);
+  }
+
+  // A quota of less than one period still allows one processor to make
+  // (throttled) progress.
+  limits->quota_processor_count =
+      (iree_host_size_t)iree_max(1, (quota + period - 1) / period);
+  return iree_ok_status();
+}
+
+iree_status_t iree_task_topology_cpu_limits_parse_cpuset(
+    iree_string_view_t value, iree_task_topology_cpu_limits_t* limits) {
+  // An empty list places no restriction (such as an unset cpuset.cpus).
+  memset(limits->cpuset, 0, sizeof(limits->cpuset));
+  limits->has_cpuset = false;
+  iree_string_view_t remaining = iree_string_view_trim(value);
+  if (iree_string_view_is_empty(remaining)) return iree_ok_status();
+  while (!iree_string_view_is_empty(remaining)) {
+    iree_string_view_t range_str = iree_string_view_empty();
+    iree_string_view_split(remaining, ',', &range_str, &remaining);
+    iree_string_view_t first_str = iree_string_view_empty();
+    iree_string_view_t last_str = iree_string_view_empty();
+    intptr_t dash = iree_string_view_split(iree_string_view_trim(range_str),
+                                           '-', &first_str, &last_str);
+    uint32_t first = 0;
+    uint32_t last = 0;
+    if (!iree_string_view_atoi_uint32(first_str, &first) ||
+        (dash >= 0 && !iree_string_view_atoi_uint32(last_str, &last))) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "invalid cpuset range '%.*s'",
+                              (int)range_str.size, range_str.data);
+    }
+    if (dash < 0) last = first;
+    if (last < first) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "invalid cpuset range '%.*s'",
+                              (int)range_str.size, range_str.data);
+    }
+    // Processors we can't represent are dropped; we'll never be able to create
+    // groups for them anyway.
+    last = iree_min(last, IREE_TASK_TOPOLOGY_CPUSET_BIT_COUNT - 1);
+    for (uint32_t i = first; i <= last; ++i) {
+      limits->cpuset[i / 64] |= 1ull << (i % 64);
+    }
+  }
+  limits->has_cpuset = true;
+  return iree_ok_status();
+}
+
+bool iree_task_topology_cpu_limits_allow_processor(
+    const iree_task_topology_cpu_limits_t* limits, uint32_t processor_id) {
+  if (!limits->has_cpuset) return true;
+  if (processor_id >= IREE_TASK_TOPOLOGY_CPUSET_BIT_COUNT) return false;
+  return (limits->cpuset[processor_id / 64] >> (processor_id % 64)) & 1;
+}
+
+iree_host_size_t iree_task_topology_cpu_limits_processor_count(
+    const iree_task_topology_cpu_limits_t* limits) {
+  iree_host_size_t processor_count = IREE_HOST_SIZE_MAX;
+  if (limits->has_cpuset) {
+    processor_count = 0;
+    for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(limits->cpuset); ++i) {
+      processor_count += iree_math_count_ones_u64(limits->cpuset[i]);
+    }
+  }
+  if (limits->quota_processor_count) {
+    processor_count = iree_min(processor_count, limits->quota_processor_count);
+  }
+  return processor_count;
+}
+
+//===----------------------------------------------------------------------===//
+// Platform queries
+//===----------------------------------------------------------------------===//
+
+#if defined(IREE_PLATFORM_LINUX)
+
+// Reads the small text file at |path| into |buffer| and returns the trimmed
+// contents in |out_value|. Returns false if the file could not be read.
+static bool iree_task_topology_read_file(const char* path, char* buffer,
+                                         iree_host_size_t buffer_capacity,
+                                         iree_string_view_t* out_value) {
+  *out_value = iree_string_view_empty();
+  FILE* file = fopen(path, "r");
+  if (!file) return false;
+  size_t length = fread(buffer, 1, buffer_capacity - 1, file);
+  fclose(file);
+  buffer[length] = 0;
+  *out_value = iree_string_view_trim(iree_make_string_view(buffer, length));
+  return true;
+}
+
+// Parses the file at |path| with |parse_fn| into |limits|.
+// Returns false if the file could not be read or parsed.
+static bool iree_task_topology_parse_file(
+    const char* path,
+    iree_status_t (*parse_fn)(iree_string_view_t value,
+                              iree_task_topology_cpu_limits_t* limits),
+    iree_task_topology_cpu_limits_t* limits) {
+  char buffer[1024];
+  iree_string_view_t value = iree_string_view_empty();
+  if (!iree_task_topology_read_file(path, buffer, sizeof(buffer), &value)) {
+    return false;
+  }
+  iree_status_t status = parse_fn(value, limits);
+  if (iree_status_is_ok(status)) return true;
+  iree_status_ignore(status);
+  return false;
+}
+
+// Queries the cgroup v2 limits of the process at the unified hierarchy
+// |cgroup_path| (such as `/` or `/user.slice/foo.scope`).
+// The effective bandwidth quota is the smallest of all ancestor cgroups while
+// cpuset.cpus.effective already accounts for ancestors.
+static bool iree_task_topology_query_cgroup_v2_limits(
+    iree_string_view_t cgroup_path, iree_task_topology_cpu_limits_t* limits) {
+  char path[256];
+  bool found_any = false;
+  while (true) {
+    iree_task_topology_cpu_limits_t quota_limits;
+    iree_task_topology_cpu_limits_initialize(&quota_limits);
+    snprintf(path, sizeof(path), "/sys/fs/cgroup%.*s/cpu.max",
+             (int)cgroup_path.size, cgroup_path.data);
+    if (iree_task_topology_parse_file(
+            path, iree_task_topology_cpu_limits_parse_quota, &quota_limits)) {
+      found_any = true;
+      if (quota_limits.quota_processor_count &&
+          (!limits->quota_processor_count ||
+           quota_limits.quota_processor_count <
+               limits->quota_processor_count)) {
+        limits->quota_processor_count = quota_limits.quota_processor_count;
+      }
+    }
+    if (!limits->has_cpuset) {
+      snprintf(path, sizeof(path), "/sys/fs/cgroup%.*s/cpuset.cpus.effective",
+               (int)cgroup_path.size, cgroup_path.data);
+      found_any |= iree_task_topology_parse_file(
+          path, iree_task_topology_cpu_limits_parse_cpuset, limits);
+    }
+    // Walk up to the parent cgroup. The path may not be visible from within a
+    // cgroup namespace in which case we end at the mount root.
+    if (iree_string_view_is_empty(cgroup_path)) break;
+    iree_host_size_t last_slash = iree_string_view_find_last_of(
+        cgroup_path, IREE_SV("/"), IREE_STRING_VIEW_NPOS);
+    if (last_slash == IREE_STRING_VIEW_NPOS) break;
+    cgroup_path = iree_string_view_substr(cgroup_path, 0, last_slash);
+  }
+  return found_any;
+}
+
+// Queries the cgroup v1 limits of the process assuming the controllers are
+// mounted at their conventional locations. Containers usually have their own
+// cgroup mounted at the root of each hierarchy.
+static void iree_task_topology_query_cgroup_v1_limits(
+    iree_task_topology_cpu_limits_t* limits) {
+  static const char* cpu_roots[] = {
+      "/sys/fs/cgroup/cpu,cpuacct",
+      "/sys/fs/cgroup/cpu",
+  };
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(cpu_roots); ++i) {
+    char path[128];
+    char quota_buffer[64];
+    char period_buffer[64];
+    iree_string_view_t quota = iree_string_view_empty();
+    iree_string_view_t period = iree_string_view_empty();
+    snprintf(path, sizeof(path), "%s/cpu.cfs_quota_us", cpu_roots[i]);
+    if (!iree_task_topology_read_file(path, quota_buffer, sizeof(quota_buffer),
+                                      &quota)) {
+      continue;
+    }
+    snprintf(path, sizeof(path), "%s/cpu.cfs_period_us", cpu_roots[i]);
+    if (!iree_task_topology_read_file(path, period_buffer,
+                                      sizeof(period_buffer), &period)) {
+      continue;
+    }
+    char value[130];
+    snprintf(value, sizeof(value), "%.*s %.*s", (int)quota.size, quota.data,
+             (int)period.size, period.data);
+    iree_status_ignore(iree_task_topology_cpu_limits_parse_quota(
+        iree_make_cstring_view(value), limits));
+    break;
+  }
+  if (!iree_task_topology_parse_file(
+          "/sys/fs/cgroup/cpuset/cpuset.effective_cpus",
+          iree_task_topology_cpu_limits_parse_cpuset, limits)) {
+    iree_task_topology_parse_file("/sys/fs/cgroup/cpuset/cpuset.cpus",
+                                  iree_task_topology_cpu_limits_parse_cpuset,
+                                  limits);
+  }
+}
+
+// Returns the cgroup v2 path of the process from /proc/self/cgroup in
+// |buffer| or false if the process is not in a cgroup v2 hierarchy.
+static bool iree_task_topology_query_cgroup_v2_path(
+    char* buffer, iree_host_size_t buffer_capacity,
+    iree_string_view_t* out_path) {
+  iree_string_view_t contents = iree_string_view_empty();
+  if (!iree_task_topology_read_file("/proc/self/cgroup", buffer,
+                                    buffer_capacity, &contents)) {
+    return false;
+  }
+  while (!iree_string_view_is_empty(contents)) {
+    iree_string_view_t line = iree_string_view_empty();
+    iree_string_view_split(contents, '\n', &line, &contents);
+    // The unified hierarchy is always listed as `0::$PATH`.
+    if (iree_string_view_consume_prefix(&line, IREE_SV("0::"))) {
+      *out_path = iree_string_view_trim(line);
+      // The root is `/`; strip it so that we can append file names.
+      if (iree_string_view_equal(*out_path, IREE_SV("/"))) {
+        *out_path = iree_string_view_empty();
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+void iree_task_topology_cpu_limits_query(
+    iree_task_topology_cpu_limits_t* out_limits) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_task_topology_cpu_limits_initialize(out_limits);
+
+  char cgroup_buffer[1024];
+  iree_string_view_t cgroup_path = iree_string_view_empty();
+  if (!iree_task_topology_query_cgroup_v2_path(
+          cgroup_buffer, sizeof(cgroup_buffer), &cgroup_path) ||
+      !iree_task_topology_query_cgroup_v2_limits(cgroup_path, out_limits)) {
+    iree_task_topology_query_cgroup_v1_limits(out_limits);
+  }
+
+  // Processors may be taken offline with hotplug; those remain in cgroup
+  // cpusets but we can't run on them.
+  iree_task_topology_cpu_limits_t online_limits;
+  iree_task_topology_cpu_limits_initialize(&online_limits);
+  if (iree_task_topology_parse_file("/sys/devices/system/cpu/online",
+                                    iree_task_topology_cpu_limits_parse_cpuset,
+                                    &online_limits)) {
+    if (out_limits->has_cpuset) {
+      for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(out_limits->cpuset);
+           ++i) {
+        out_limits->cpuset[i] &= online_limits.cpuset[i];
+      }
+    } else {
+      out_limits->has_cpuset = true;
+      memcpy(out_limits->cpuset, online_limits.cpuset,
+             sizeof(out_limits->cpuset));
+    }
+  }
+
+  IREE_TRACE_ZONE_APPEND_VALUE(
+      z0, iree_task_topology_cpu_limits_processor_count(out_limits));
+  IREE_TRACE_ZONE_END(z0);
+}
+
+#else
+
+// TODO(benvanik): query job object CPU rate limits on Windows.
+void iree_task_topology_cpu_limits_query(
+    iree_task_topology_cpu_limits_t* out_limits) {
+  iree_task_topology_cpu_limits_initialize(out_limits);
+}
+
+#endif  // IREE_PLATFORM_LINUX
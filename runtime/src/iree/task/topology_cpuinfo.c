@@ -34,10 +34,29 @@ void iree_task_topology_initialize_from_physical_cores(
   iree_task_topology_initialize_fallback(max_core_count, out_topology);
 }
 
+void iree_task_topology_initialize_from_physical_cores_of_type(
+    iree_task_topology_core_type_t core_type, iree_host_size_t max_core_count,
+    iree_task_topology_t* out_topology) {
+  iree_task_topology_initialize_fallback(max_core_count, out_topology);
+}
+
+void iree_task_topology_initialize_from_physical_cores_with_limits(
+    const iree_task_topology_cpu_limits_t* limits,
+    iree_host_size_t max_core_count, iree_task_topology_t* out_topology) {
+  iree_task_topology_initialize_fallback(
+      iree_min(max_core_count,
+               iree_task_topology_cpu_limits_processor_count(limits)),
+      out_topology);
+}
+
 #else
 
 #include <cpuinfo.h>
 
+#if defined(IREE_PLATFORM_LINUX)
+#include <dirent.h>
+#endif  // IREE_PLATFORM_LINUX
+
 static bool iree_task_topology_is_cpuinfo_available() {
   return cpuinfo_initialize() && cpuinfo_get_cores_count() > 0;
 }
@@ -82,15 +101,31 @@ static void iree_task_topology_set_affinity_from_processor(
   memset(out_affinity, 0, sizeof(*out_affinity));
   out_affinity->specified = 1;
 
-  // Special bit to indicate that (if required) we want the entire core.
-  if (processor->core->processor_count > 1) {
-    out_affinity->smt = 1;
-  }
-
   // cpuinfo #ifdefs the fields we need to extract the right platform IDs.
   // We purposefully use the same exact macros they do there so that we don't
   // have to worry about skew.
 
+  // Special bit to indicate that (if required) we want the entire core.
+  // The bit selects the processor and the one immediately following it so we
+  // only set it when the SMT siblings of the core are numbered adjacently: on
+  // many x86 Linux systems siblings are numbered N and N + core count and
+  // selecting N + 1 would overlap with the group placed on the next core.
+  const struct cpuinfo_core* core = processor->core;
+  if (core->processor_count > 1) {
+    const struct cpuinfo_processor* sibling =
+        cpuinfo_get_processor(core->processor_start + 1);
+#if defined(__linux__)
+    out_affinity->smt = sibling->linux_id == processor->linux_id + 1;
+#elif defined(_WIN32) || defined(__CYGWIN__)
+    out_affinity->smt =
+        sibling->windows_group_id == processor->windows_group_id &&
+        sibling->windows_processor_id == processor->windows_processor_id + 1;
+#else
+    (void)sibling;
+    out_affinity->smt = 1;
+#endif  // cpuinfo-like platform field
+  }
+
 #if defined(__MACH__) && defined(__APPLE__)
   // TODO(benvanik): run on darwin to see how the l2 caches map. We ideally want
   // a unique affinity ID per L2 cache.
@@ -109,33 +144,128 @@ static void iree_task_topology_set_affinity_from_processor(
 #endif  // cpuinfo-like platform field
 }
 
-// Returns a bitset with all *processors* that share the same |cache|.
-static uint64_t iree_task_topology_calculate_cache_bits(
-    const struct cpuinfo_cache* cache) {
-  if (!cache) return 0;
-  uint64_t mask = 0;
-  for (uint32_t processor_i = 0; processor_i < cache->processor_count;
-       ++processor_i) {
-    uint32_t i = cache->processor_start + processor_i;
-    if (i < IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT) {
-      mask |= 1ull << i;
+#if defined(IREE_PLATFORM_LINUX)
+
+// Returns the NUMA node of the |processor| as reported by sysfs or 0 if it
+// cannot be determined. cpuinfo does not expose NUMA information.
+static uint32_t iree_task_topology_query_numa_node(
+    const struct cpuinfo_processor* processor) {
+  char path[64];
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u",
+           (unsigned int)processor->linux_id);
+  DIR* dir = opendir(path);
+  if (!dir) return 0;
+  uint32_t numa_node = 0;
+  struct dirent* entry = NULL;
+  while ((entry = readdir(dir)) != NULL) {
+    unsigned int value = 0;
+    if (sscanf(entry->d_name, "node%u", &value) == 1) {
+      numa_node = (uint32_t)value;
+      break;
     }
   }
-  return mask;
+  closedir(dir);
+  return numa_node;
+}
+
+// Reads a single unsigned integer value from the file at |path|.
+static bool iree_task_topology_read_sysfs_uint64(const char* path,
+                                                 uint64_t* out_value) {
+  FILE* file = fopen(path, "r");
+  if (!file) return false;
+  unsigned long long value = 0;
+  bool found = fscanf(file, "%llu", &value) == 1;
+  fclose(file);
+  *out_value = (uint64_t)value;
+  return found;
 }
 
-// Constructs a constructive sharing mask for all *processors* that share the
-// same cache as the specified |processor|.
-static uint64_t iree_task_topology_calculate_constructive_sharing_mask(
+// Returns a relative performance capacity of |core| or 0 if unknown.
+// The scheduler-provided cpu_capacity (present on heterogeneous ARM systems)
+// is preferred and otherwise the maximum frequency is used.
+static uint64_t iree_task_topology_query_core_capacity(
+    const struct cpuinfo_core* core) {
+  const struct cpuinfo_processor* processor =
+      cpuinfo_get_processor(core->processor_start);
+  char path[96];
+  uint64_t value = 0;
+  snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cpu_capacity",
+           (unsigned int)processor->linux_id);
+  if (iree_task_topology_read_sysfs_uint64(path, &value)) return value;
+  snprintf(path, sizeof(path),
+           "/sys/devices/system/cpu/cpu%u/cpufreq/cpuinfo_max_freq",
+           (unsigned int)processor->linux_id);
+  if (iree_task_topology_read_sysfs_uint64(path, &value)) return value;
+  return core->frequency;
+}
+
+#else
+
+// TODO(benvanik): query GetNumaProcessorNodeEx on Windows.
+static uint32_t iree_task_topology_query_numa_node(
     const struct cpuinfo_processor* processor) {
-  uint64_t mask = 0;
-  mask |= iree_task_topology_calculate_cache_bits(processor->cache.l1i);
-  mask |= iree_task_topology_calculate_cache_bits(processor->cache.l1d);
-  mask |= iree_task_topology_calculate_cache_bits(processor->cache.l2);
+  return 0;
+}
+
+// Returns a relative performance capacity of |core| or 0 if unknown.
+// TODO(benvanik): query EfficiencyClass from
+// GetLogicalProcessorInformationEx on Windows.
+static uint64_t iree_task_topology_query_core_capacity(
+    const struct cpuinfo_core* core) {
+  return core->frequency;
+}
+
+#endif  // IREE_PLATFORM_LINUX
+
+// Returns the largest capacity of any core in the system or 0 if the system
+// cores are homogeneous or their capacities are unknown.
+static uint64_t iree_task_topology_query_heterogeneous_max_capacity(void) {
+  uint64_t min_capacity = UINT64_MAX;
+  uint64_t max_capacity = 0;
+  for (uint32_t i = 0; i < cpuinfo_get_cores_count(); ++i) {
+    uint64_t capacity =
+        iree_task_topology_query_core_capacity(cpuinfo_get_core(i));
+    if (capacity == 0) return 0;  // unknown
+    min_capacity = iree_min(min_capacity, capacity);
+    max_capacity = iree_max(max_capacity, capacity);
+  }
+  return min_capacity == max_capacity ? 0 : max_capacity;
+}
+
+// Returns the type of |core| given the |max_capacity| of the system as
+// returned by iree_task_topology_query_heterogeneous_max_capacity.
+static iree_task_topology_core_type_t iree_task_topology_classify_core(
+    const struct cpuinfo_core* core, uint64_t max_capacity) {
+  if (max_capacity == 0) return IREE_TASK_TOPOLOGY_CORE_TYPE_ANY;
+  return iree_task_topology_query_core_capacity(core) >= max_capacity
+             ? IREE_TASK_TOPOLOGY_CORE_TYPE_PERFORMANCE
+             : IREE_TASK_TOPOLOGY_CORE_TYPE_EFFICIENCY;
+}
+
+// Returns true if |processor_index| shares the given |cache|.
+static bool iree_task_topology_cache_contains(const struct cpuinfo_cache* cache,
+                                              uint32_t processor_index) {
+  if (!cache) return false;
+  return processor_index >= cache->processor_start &&
+         processor_index < cache->processor_start + cache->processor_count;
+}
+
+// Returns true if the processor at |other_processor_index| shares some level of
+// cache with |processor|. Compares processor ranges directly instead of
+// building processor bitmasks so that systems with more processors than fit in
+// a single mask word are handled.
+static bool iree_task_topology_processors_share_cache(
+    const struct cpuinfo_processor* processor,
+    uint32_t other_processor_index) {
   // TODO(benvanik): include L3 here too (for systems that have it)? Or use L3
   // info purely for distribution and focus the group mask on lower-latency
   // caches?
-  return mask;
+  return iree_task_topology_cache_contains(processor->cache.l1i,
+                                           other_processor_index) ||
+         iree_task_topology_cache_contains(processor->cache.l1d,
+                                           other_processor_index) ||
+         iree_task_topology_cache_contains(processor->cache.l2,
+                                           other_processor_index);
 }
 
 // Populates |our_group| with the information from |core|.
@@ -154,6 +284,7 @@ static void iree_task_topology_group_initialize_from_core(
       cpuinfo_get_processor(processor_i);
   iree_task_topology_set_affinity_from_processor(
       processor, &out_group->ideal_thread_affinity);
+  out_group->numa_node = iree_task_topology_query_numa_node(processor);
 }
 
 // Fixes constructive_sharing_mask values such that they represent other chosen
@@ -162,23 +293,20 @@ static void iree_task_topology_group_initialize_from_core(
 // processor IDs a particular group is mapped to.
 static void iree_task_topology_fixup_constructive_sharing_masks(
     iree_task_topology_t* topology) {
-  // O(n^2), but n is always <= 64 (and often <= 8).
+  // O(n^2), but n is always <= IREE_TASK_EXECUTOR_MAX_WORKER_COUNT (and often
+  // <= 8).
   for (iree_host_size_t i = 0; i < topology->group_count; ++i) {
     iree_task_topology_group_t* group = &topology->groups[i];
 
-    // Compute the processors that we can constructively share with.
-    uint64_t constructive_sharing_mask =
-        iree_task_topology_calculate_constructive_sharing_mask(
-            cpuinfo_get_processor(group->processor_index));
-
-    iree_task_topology_group_mask_t group_mask = 0;
+    const struct cpuinfo_processor* processor =
+        cpuinfo_get_processor(group->processor_index);
+    iree_task_topology_group_mask_t group_mask = iree_task_affinity_set_empty();
     for (iree_host_size_t j = 0; j < topology->group_count; ++j) {
       if (i == j) continue;
       const iree_task_topology_group_t* other_group = &topology->groups[j];
-      uint64_t group_processor_bits =
-          iree_math_rotl_u64(1ull, other_group->processor_index);
-      if (constructive_sharing_mask & group_processor_bits) {
-        group_mask |= iree_math_rotl_u64(1ull, other_group->group_index);
+      if (iree_task_topology_processors_share_cache(
+              processor, other_group->processor_index)) {
+        iree_task_affinity_set_insert(&group_mask, other_group->group_index);
       }
     }
 
@@ -204,7 +332,8 @@ typedef bool (*iree_task_topology_core_filter_t)(
 static void iree_task_topology_initialize_from_physical_cores_with_filter(
     iree_task_topology_core_filter_t filter_fn, uintptr_t filter_fn_data,
     iree_host_size_t max_core_count, iree_task_topology_t* out_topology) {
-  max_core_count = iree_min(max_core_count, IREE_TASK_TOPOLOGY_GROUP_BIT_COUNT);
+  max_core_count =
+      iree_min(max_core_count, IREE_TASK_EXECUTOR_MAX_WORKER_COUNT);
   if (!iree_task_topology_is_cpuinfo_available()) {
     iree_task_topology_initialize_fallback(max_core_count, out_topology);
     return;
@@ -222,6 +351,8 @@ static void iree_task_topology_initialize_from_physical_cores_with_filter(
   core_count = iree_min(core_count, max_core_count);
 
   iree_task_topology_initialize(out_topology);
+  const uint64_t max_capacity =
+      iree_task_topology_query_heterogeneous_max_capacity();
 
   // Build each core up to the max allowed.
   // TODO(benvanik): if our group_count <= core_count/2 then distribute better;
@@ -239,6 +370,8 @@ static void iree_task_topology_initialize_from_physical_cores_with_filter(
     if (filter_fn(core, filter_fn_data)) {
       iree_task_topology_group_initialize_from_core(
           group_i, core, &out_topology->groups[group_i]);
+      out_topology->groups[group_i].core_type =
+          iree_task_topology_classify_core(core, max_capacity);
       ++group_i;
     }
   }
@@ -253,4 +386,62 @@ void iree_task_topology_initialize_from_physical_cores(
       iree_task_topology_core_filter_all, 0, max_core_count, out_topology);
 }
 
+// Matches cores of the iree_task_topology_core_type_t passed as |user_data|.
+static bool iree_task_topology_core_filter_type(const struct cpuinfo_core* core,
+                                                uintptr_t user_data) {
+  const iree_task_topology_core_type_t core_type =
+      (iree_task_topology_core_type_t)user_data;
+  return iree_task_topology_classify_core(
+             core, iree_task_topology_query_heterogeneous_max_capacity()) ==
+         core_type;
+}
+
+void iree_task_topology_initialize_from_physical_cores_of_type(
+    iree_task_topology_core_type_t core_type, iree_host_size_t max_core_count,
+    iree_task_topology_t* out_topology) {
+  // Homogeneous systems (or those we can't classify) use all cores.
+  if (core_type == IREE_TASK_TOPOLOGY_CORE_TYPE_ANY ||
+      !iree_task_topology_is_cpuinfo_available() ||
+      iree_task_topology_query_heterogeneous_max_capacity() == 0) {
+    iree_task_topology_initialize_from_physical_cores(max_core_count,
+                                                      out_topology);
+    return;
+  }
+  iree_task_topology_initialize_from_physical_cores_with_filter(
+      iree_task_topology_core_filter_type, (uintptr_t)core_type,
+      max_core_count, out_topology);
+}
+
+// Matches cores with at least one processor allowed by the
+// iree_task_topology_cpu_limits_t passed as |user_data|.
+static bool iree_task_topology_core_filter_cpu_limits(
+    const struct cpuinfo_core* core, uintptr_t user_data) {
+  const iree_task_topology_cpu_limits_t* limits =
+      (const iree_task_topology_cpu_limits_t*)user_data;
+  for (uint32_t i = 0; i < core->processor_count; ++i) {
+#if defined(__linux__)
+    uint32_t processor_id =
+        cpuinfo_get_processor(core->processor_start + i)->linux_id;
+#else
+    uint32_t processor_id = core->processor_start + i;
+#endif  // __linux__
+    if (iree_task_topology_cpu_limits_allow_processor(limits, processor_id)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void iree_task_topology_initialize_from_physical_cores_with_limits(
+    const iree_task_topology_cpu_limits_t* limits,
+    iree_host_size_t max_core_count, iree_task_topology_t* out_topology) {
+  // Workers beyond the number of processors that can run concurrently would
+  // only be throttled by the scheduler and add contention.
+  max_core_count = iree_min(
+      max_core_count, iree_task_topology_cpu_limits_processor_count(limits));
+  iree_task_topology_initialize_from_physical_cores_with_filter(
+      iree_task_topology_core_filter_cpu_limits, (uintptr_t)limits,
+      max_core_count, out_topology);
+}
+
 #endif  // IREE_TASK_CPUINFO_DISABLED
@@ -13,6 +13,8 @@
 
 namespace {
 
+using iree::Status;
+using iree::StatusCode;
 using namespace iree::testing::status;
 
 TEST(TopologyTest, Lifetime) {
@@ -65,6 +67,59 @@ TEST(TopologyTest, Construction) {
   iree_task_topology_deinitialize(&topology);
 }
 
+TEST(TopologyTest, NodeSharingMask) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize(&topology);
+
+  // Two nodes with groups interleaved: node 0 = 0,2,4 and node 1 = 1,3,5.
+  for (iree_host_size_t i = 0; i < 6; ++i) {
+    iree_task_topology_group_t group;
+    iree_task_topology_group_initialize(i, &group);
+    group.numa_node = i % 2;
+    IREE_EXPECT_OK(iree_task_topology_push_group(&topology, &group));
+  }
+
+  EXPECT_EQ(0b010100ull,
+            iree_task_topology_calculate_node_sharing_mask(&topology, 0)
+                .words[0]);
+  EXPECT_EQ(0b101000ull,
+            iree_task_topology_calculate_node_sharing_mask(&topology, 1)
+                .words[0]);
+  EXPECT_EQ(0b001010ull,
+            iree_task_topology_calculate_node_sharing_mask(&topology, 5)
+                .words[0]);
+  EXPECT_TRUE(iree_task_affinity_set_is_empty(
+      iree_task_topology_calculate_node_sharing_mask(&topology, 100)));
+
+  iree_task_topology_deinitialize(&topology);
+}
+
+TEST(TopologyTest, CommonNumaNode) {
+  iree_task_topology_t topology;
+  iree_task_topology_initialize(&topology);
+  EXPECT_EQ(IREE_TASK_TOPOLOGY_NUMA_NODE_ANY,
+            iree_task_topology_query_common_numa_node(&topology));
+
+  // All groups on node 1.
+  for (iree_host_size_t i = 0; i < 3; ++i) {
+    iree_task_topology_group_t group;
+    iree_task_topology_group_initialize(i, &group);
+    group.numa_node = 1;
+    IREE_EXPECT_OK(iree_task_topology_push_group(&topology, &group));
+  }
+  EXPECT_EQ(1, iree_task_topology_query_common_numa_node(&topology));
+
+  // One group on another node makes the topology span nodes.
+  iree_task_topology_group_t group;
+  iree_task_topology_group_initialize(3, &group);
+  group.numa_node = 0;
+  IREE_EXPECT_OK(iree_task_topology_push_group(&topology, &group));
+  EXPECT_EQ(IREE_TASK_TOPOLOGY_NUMA_NODE_ANY,
+            iree_task_topology_query_common_numa_node(&topology));
+
+  iree_task_topology_deinitialize(&topology);
+}
+
 TEST(TopologyTest, MaxCapacity) {
   iree_task_topology_t topology;
   iree_task_topology_initialize(&topology);
@@ -143,4 +198,112 @@ TEST(TopologyTest, FromPhysicalCores) {
   iree_task_topology_deinitialize(&topology);
 }
 
+TEST(TopologyTest, FromPhysicalCoresOfType) {
+  static constexpr iree_host_size_t kMaxGroupCount = 4;
+  // Every type must produce a valid topology: systems without the requested
+  // core type fall back to using all cores.
+  for (iree_task_topology_core_type_t core_type : {
+           IREE_TASK_TOPOLOGY_CORE_TYPE_ANY,
+           IREE_TASK_TOPOLOGY_CORE_TYPE_PERFORMANCE,
+           IREE_TASK_TOPOLOGY_CORE_TYPE_EFFICIENCY,
+       }) {
+    iree_task_topology_t topology;
+    iree_task_topology_initialize(&topology);
+    iree_task_topology_initialize_from_physical_cores_of_type(
+        core_type, kMaxGroupCount, &topology);
+    EnsureTopologyValid(kMaxGroupCount, &topology);
+    iree_task_topology_deinitialize(&topology);
+  }
+}
+
+TEST(TopologyTest, CpuLimitsParseQuota) {
+  iree_task_topology_cpu_limits_t limits;
+  iree_task_topology_cpu_limits_initialize(&limits);
+  EXPECT_EQ(IREE_HOST_SIZE_MAX,
+            iree_task_topology_cpu_limits_processor_count(&limits));
+
+  IREE_EXPECT_OK(iree_task_topology_cpu_limits_parse_quota(
+      IREE_SV("max 100000"), &limits));
+  EXPECT_EQ(0, limits.quota_processor_count);
+  IREE_EXPECT_OK(
+      iree_task_topology_cpu_limits_parse_quota(IREE_SV("-1 100000"), &limits));
+  EXPECT_EQ(0, limits.quota_processor_count);
+
+  IREE_EXPECT_OK(iree_task_topology_cpu_limits_parse_quota(
+      IREE_SV("400000 100000\n"), &limits));
+  EXPECT_EQ(4, limits.quota_processor_count);
+  EXPECT_EQ(4, iree_task_topology_cpu_limits_processor_count(&limits));
+
+  // Partial processors round up and tiny quotas still get one processor.
+  IREE_EXPECT_OK(iree_task_topology_cpu_limits_parse_quota(
+      IREE_SV("150000 100000"), &limits));
+  EXPECT_EQ(2, limits.quota_processor_count);
+  IREE_EXPECT_OK(iree_task_topology_cpu_limits_parse_quota(
+      IREE_SV("1000 100000"), &limits));
+  EXPECT_EQ(1, limits.quota_processor_count);
+
+  // The period defaults to 100ms if omitted.
+  IREE_EXPECT_OK(
+      iree_task_topology_cpu_limits_parse_quota(IREE_SV("300000"), &limits));
+  EXPECT_EQ(3, limits.quota_processor_count);
+
+  EXPECT_THAT(Status(iree_task_topology_cpu_limits_parse_quota(
+                  IREE_SV("abc 100000"), &limits)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(Status(iree_task_topology_cpu_limits_parse_quota(
+                  IREE_SV("100000 0"), &limits)),
+              StatusIs(StatusCode::kInvalidArgument));
+}
+
+TEST(TopologyTest, CpuLimitsParseCpuset) {
+  iree_task_topology_cpu_limits_t limits;
+  iree_task_topology_cpu_limits_initialize(&limits);
+  EXPECT_TRUE(iree_task_topology_cpu_limits_allow_processor(&limits, 123));
+
+  IREE_EXPECT_OK(iree_task_topology_cpu_limits_parse_cpuset(
+      IREE_SV("0-3,8,10-11\n"), &limits));
+  EXPECT_TRUE(limits.has_cpuset);
+  EXPECT_EQ(7, iree_task_topology_cpu_limits_processor_count(&limits));
+  EXPECT_TRUE(iree_task_topology_cpu_limits_allow_processor(&limits, 0));
+  EXPECT_TRUE(iree_task_topology_cpu_limits_allow_processor(&limits, 3));
+  EXPECT_FALSE(iree_task_topology_cpu_limits_allow_processor(&limits, 4));
+  EXPECT_TRUE(iree_task_topology_cpu_limits_allow_processor(&limits, 8));
+  EXPECT_FALSE(iree_task_topology_cpu_limits_allow_processor(&limits, 9));
+  EXPECT_TRUE(iree_task_topology_cpu_limits_allow_processor(&limits, 11));
+  EXPECT_FALSE(iree_task_topology_cpu_limits_allow_processor(&limits, 12));
+
+  // The quota further limits the processor count.
+  IREE_EXPECT_OK(iree_task_topology_cpu_limits_parse_quota(
+      IREE_SV("200000 100000"), &limits));
+  EXPECT_EQ(2, iree_task_topology_cpu_limits_processor_count(&limits));
+
+  // Empty lists place no restriction.
+  IREE_EXPECT_OK(
+      iree_task_topology_cpu_limits_parse_cpuset(IREE_SV(""), &limits));
+  EXPECT_FALSE(limits.has_cpuset);
+
+  EXPECT_THAT(Status(iree_task_topology_cpu_limits_parse_cpuset(
+                  IREE_SV("3-1"), &limits)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_THAT(Status(iree_task_topology_cpu_limits_parse_cpuset(
+                  IREE_SV("0,x"), &limits)),
+              StatusIs(StatusCode::kInvalidArgument));
+  EXPECT_FALSE(limits.has_cpuset);
+}
+
+// Tests that the limits of the current process can be queried and used to
+// construct a topology. The exact values depend on the machine.
+TEST(TopologyTest, CpuLimitsQuery) {
+  iree_task_topology_cpu_limits_t limits;
+  iree_task_topology_cpu_limits_query(&limits);
+  EXPECT_GE(iree_task_topology_cpu_limits_processor_count(&limits), 1);
+
+  iree_task_topology_t topology;
+  iree_task_topology_initialize_from_physical_cores_with_limits(
+      &limits, /*max_core_count=*/8, &topology);
+  EXPECT_GE(iree_task_topology_group_count(&topology), 1);
+  EXPECT_LE(iree_task_topology_group_count(&topology), 8);
+  iree_task_topology_deinitialize(&topology);
+}
+
 }  // namespace
@@ -12,10 +12,19 @@ extern "C" {
 #endif  // __cplusplus
 
 // Maximum number of workers that an executor can manage.
-// A 64 worker hard limit is based on us using uint64_t as a bitmask to select
-// workers. It's easy to go smaller (just use fewer bits) if it's known that
-// only <64 will ever be used (such as for devices with 2 cores).
+// Workers are selected with iree_task_affinity_set_t bitsets that use one
+// 64-bit word per 64 workers. The default of 64 keeps every set a single word
+// so that all mask operations are scalar; machines with more cores can raise
+// this (up to 256, the limit of the uint8_t topology group index) at the cost
+// of one additional word per 64 workers in each task header and worker mask.
+// It's easy to go smaller (just use fewer bits) if it's known that only <64
+// will ever be used (such as for devices with 2 cores).
+#if !defined(IREE_TASK_EXECUTOR_MAX_WORKER_COUNT)
 #define IREE_TASK_EXECUTOR_MAX_WORKER_COUNT (64)
+#endif  // !IREE_TASK_EXECUTOR_MAX_WORKER_COUNT
+#if IREE_TASK_EXECUTOR_MAX_WORKER_COUNT > 256
+#error "IREE_TASK_EXECUTOR_MAX_WORKER_COUNT must be <= 256"
+#endif  // IREE_TASK_EXECUTOR_MAX_WORKER_COUNT > 256
 
 // Initial number of shard tasks that are allocated in the executor pool.
 // Increasing this number will decrease initial allocation storms in cases of
@@ -23,7 +32,8 @@ extern "C" {
 // at the cost of a higher minimum memory consumption.
 #define IREE_TASK_EXECUTOR_INITIAL_SHARD_RESERVATION_PER_WORKER (4)
 
-// Maximum number of events retained by the executor event pool.
+// Number of events preallocated in the executor event pool. The pool grows to
+// retain more events as needed.
 #define IREE_TASK_EXECUTOR_EVENT_POOL_CAPACITY 64
 
 // Maximum number of simultaneous waits an executor may perform as part of a
@@ -53,6 +63,13 @@ extern "C" {
 // 1ms may result in 10-15ms.
 #define IREE_TASK_EXECUTOR_DELAY_SLOP_NS (1 /*ms*/ * 1000000)
 
+// Maximum amount of time a donated caller thread will sleep waiting for new
+// work before re-checking whether the wait source it is waiting on has
+// resolved. Only applies to executors without worker threads where the donated
+// caller is the only thread that can make progress and wait sources resolved
+// externally (such as from other devices) have no way of waking it.
+#define IREE_TASK_EXECUTOR_DONATION_POLL_INTERVAL_NS (1 /*ms*/ * 1000000)
+
 // Allows for dividing the total number of attempts that a worker will make to
 // steal tasks from other workers. By default all other workers will be
 // attempted while setting this to 2, for example, will try for only half of
@@ -93,6 +110,40 @@ extern "C" {
 // memory).
 #define IREE_TASK_DISPATCH_MAX_TILES_PER_SHARD_RESERVATION (8)
 
+// Number of dispatch cost keys whose measured tile durations are retained by
+// the executor. Keys are direct-mapped into the table and colliding keys evict
+// each other. Must be a power of two.
+#define IREE_TASK_DISPATCH_COST_CACHE_CAPACITY (256)
+
+// Estimated cost of a single tile reservation from the dispatch grid in
+// nanoseconds. This is dominated by the contended atomic on the dispatch tile
+// index and the per-reservation bookkeeping in the shard loop.
+#define IREE_TASK_DISPATCH_RESERVATION_OVERHEAD_NS (200)
+
+// Target fraction of dispatch runtime spent on reservation overhead expressed
+// as a divisor (100 = 1%). Dispatches with a measured tile cost reserve enough
+// tiles at a time to keep IREE_TASK_DISPATCH_RESERVATION_OVERHEAD_NS under this
+// fraction of the time spent executing the reserved tiles.
+#define IREE_TASK_DISPATCH_RESERVATION_OVERHEAD_DIVISOR (100)
+
+// Minimum number of reservations each shard should be able to make when
+// adaptively sizing reservations. Bounds the reservation size of cheap tiles
+// so that some granularity remains for balancing work across shards.
+#define IREE_TASK_DISPATCH_MIN_RESERVATIONS_PER_SHARD (4)
+
+// Maximum number of tiles that will be reserved at a time when adaptively
+// sizing reservations based on measured tile costs.
+#define IREE_TASK_DISPATCH_MAX_ADAPTIVE_TILES_PER_SHARD_RESERVATION (1024)
+
+// Weight of new samples in the dispatch tile cost moving average expressed as
+// a divisor (4 = 1/4 new sample + 3/4 prior estimate).
+#define IREE_TASK_DISPATCH_COST_SMOOTHING_DIVISOR (4)
+
+// Size of the huge pages used to back worker local memory when
+// IREE_TASK_LOCAL_MEMORY_FLAG_HUGE_PAGES is set. Blocks smaller than this use
+// regular pages as a huge page would mostly go unused.
+#define IREE_TASK_LOCAL_MEMORY_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
 // Whether to enable per-tile colors for each tile tracing zone based on the
 // tile grid xyz. Not cheap and can be disabled to reduce tracing overhead.
 // TODO(#4017): make per-tile color tracing fast enough to always have on.
@@ -23,22 +23,35 @@ static int iree_task_worker_main(iree_task_worker_t* worker);
 iree_status_t iree_task_worker_initialize(
     iree_task_executor_t* executor, iree_host_size_t worker_index,
     const iree_task_topology_group_t* topology_group,
-    iree_byte_span_t local_memory, iree_prng_splitmix64_state_t* seed_prng,
+    iree_task_affinity_set_t node_sharing_mask,
+    iree_task_local_memory_flags_t local_memory_flags,
+    iree_host_size_t local_memory_size, iree_prng_splitmix64_state_t* seed_prng,
     iree_task_worker_t* out_worker) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
   out_worker->executor = executor;
+  out_worker->worker_index = worker_index;
   out_worker->worker_bit = iree_task_affinity_for_worker(worker_index);
-  out_worker->ideal_thread_affinity = topology_group->ideal_thread_affinity;
-  out_worker->constructive_sharing_mask =
-      topology_group->constructive_sharing_mask;
+  if (topology_group) {
+    out_worker->ideal_thread_affinity = topology_group->ideal_thread_affinity;
+    out_worker->constructive_sharing_mask =
+        topology_group->constructive_sharing_mask;
+  } else {
+    iree_thread_affinity_set_any(&out_worker->ideal_thread_affinity);
+    out_worker->constructive_sharing_mask = iree_task_affinity_set_empty();
+  }
+  out_worker->node_sharing_mask = node_sharing_mask;
   out_worker->max_theft_attempts =
       executor->worker_count / IREE_TASK_EXECUTOR_MAX_THEFT_ATTEMPTS_DIVISOR;
   iree_prng_minilcg128_initialize(iree_prng_splitmix64_next(seed_prng),
                                   &out_worker->theft_prng);
-  out_worker->local_memory = local_memory;
+  iree_task_local_memory_initialize(local_memory_flags, executor->allocator,
+                                    &out_worker->local_memory);
+  out_worker->local_memory_size = local_memory_size;
+  out_worker->affinity_epoch = 0;
   out_worker->processor_id = 0;
   out_worker->processor_tag = 0;
+  memset(&out_worker->counters, 0, sizeof(out_worker->counters));
 
   iree_task_worker_state_t initial_state = IREE_TASK_WORKER_STATE_RUNNING;
   if (executor->scheduling_mode &
@@ -55,14 +68,29 @@ iree_status_t iree_task_worker_initialize(
   iree_notification_initialize(&out_worker->wake_notification);
   iree_notification_initialize(&out_worker->state_notification);
   iree_atomic_task_slist_initialize(&out_worker->mailbox_slist);
-  iree_task_queue_initialize(&out_worker->local_task_queue);
+  iree_atomic_store_int32(&out_worker->pending_priority_mask, 0,
+                          iree_memory_order_relaxed);
+  for (iree_host_size_t i = 0; i < IREE_TASK_PRIORITY_COUNT; ++i) {
+    iree_task_queue_initialize(&out_worker->local_task_queues[i]);
+  }
+
+  // Caller workers have no thread of their own and are only ever pumped by
+  // threads donated to the executor. Their local memory is reserved here as
+  // there is no better thread to do it.
+  if (!topology_group) {
+    iree_status_t status = iree_task_local_memory_reserve(
+        &out_worker->local_memory, local_memory_size);
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
 
   iree_thread_create_params_t thread_params;
   memset(&thread_params, 0, sizeof(thread_params));
   thread_params.name = iree_make_cstring_view(topology_group->name);
   thread_params.create_suspended =
       initial_state == IREE_TASK_WORKER_STATE_SUSPENDED;
-  thread_params.priority_class = IREE_THREAD_PRIORITY_CLASS_NORMAL;
+  thread_params.priority_class = topology_group->thread_priority_class;
+  thread_params.scheduling_policy = topology_group->thread_scheduling_policy;
   thread_params.initial_affinity = out_worker->ideal_thread_affinity;
 
   // NOTE: if the thread creation fails we'll bail here and let the caller
@@ -129,8 +157,8 @@ void iree_task_worker_await_exit(iree_task_worker_t* worker) {
 void iree_task_worker_deinitialize(iree_task_worker_t* worker) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
-  // Must have called request_exit/await_exit.
-  IREE_ASSERT_TRUE(iree_task_worker_is_zombie(worker));
+  // Must have called request_exit/await_exit (if the worker has a thread).
+  IREE_ASSERT_TRUE(!worker->thread || iree_task_worker_is_zombie(worker));
 
   iree_thread_release(worker->thread);
   worker->thread = NULL;
@@ -139,33 +167,142 @@ void iree_task_worker_deinitialize(iree_task_worker_t* worker) {
   // get anything more posted to it) and then discarding everything we still
   // have a reference to.
   iree_atomic_task_slist_discard(&worker->mailbox_slist);
-  iree_task_list_discard(&worker->local_task_queue.list);
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(worker->local_task_queues);
+       ++i) {
+    iree_task_list_discard(&worker->local_task_queues[i].list);
+  }
 
   iree_notification_deinitialize(&worker->wake_notification);
   iree_notification_deinitialize(&worker->state_notification);
   iree_atomic_task_slist_deinitialize(&worker->mailbox_slist);
-  iree_task_queue_deinitialize(&worker->local_task_queue);
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(worker->local_task_queues);
+       ++i) {
+    iree_task_queue_deinitialize(&worker->local_task_queues[i]);
+  }
+
+  iree_task_local_memory_deinitialize(&worker->local_memory);
 
   IREE_TRACE_ZONE_END(z0);
 }
 
+// Returns the bit representing the priority of |task| in priority masks.
+static inline int32_t iree_task_priority_bit(const iree_task_t* task) {
+  return 1 << iree_task_scope_priority(task->scope);
+}
+
 void iree_task_worker_post_tasks(iree_task_worker_t* worker,
                                  iree_task_list_t* list) {
+  int32_t priority_mask = 0;
+  for (iree_task_t* task = list->head; task; task = task->next_task) {
+    priority_mask |= iree_task_priority_bit(task);
+  }
+
   // Move the list into the mailbox. Note that the mailbox is LIFO and this list
   // is concatenated with its current order preserved (which should be LIFO).
   iree_atomic_task_slist_concat(&worker->mailbox_slist, list->head, list->tail);
   memset(list, 0, sizeof(*list));
+
+  // Let the worker know what priorities are now pending so that it can preempt
+  // lower priority work. The tasks are published before the mask so that the
+  // worker is guaranteed to find them when it flushes in response. We avoid
+  // the atomic RMW (and the cache line ping-pong it causes) when the worker
+  // already knows about the priorities.
+  int32_t existing_mask = iree_atomic_load_int32(&worker->pending_priority_mask,
+                                                 iree_memory_order_relaxed);
+  if ((existing_mask & priority_mask) != priority_mask) {
+    iree_atomic_fetch_or_int32(&worker->pending_priority_mask, priority_mask,
+                               iree_memory_order_release);
+  }
+}
+
+// Appends a FIFO |list| of tasks into the worker local queues based on each
+// task's priority. Must only be called from the worker thread.
+static void iree_task_worker_append_local_tasks(iree_task_worker_t* worker,
+                                                iree_task_list_t* list) {
+  iree_task_list_t priority_lists[IREE_TASK_PRIORITY_COUNT];
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(priority_lists); ++i) {
+    iree_task_list_initialize(&priority_lists[i]);
+  }
+  iree_task_t* task = NULL;
+  while ((task = iree_task_list_pop_front(list))) {
+    iree_task_list_push_back(
+        &priority_lists[iree_task_scope_priority(task->scope)], task);
+  }
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(priority_lists); ++i) {
+    if (iree_task_list_is_empty(&priority_lists[i])) continue;
+    iree_task_queue_t* queue = &worker->local_task_queues[i];
+    iree_slim_mutex_lock(&queue->mutex);
+    iree_task_list_append(&queue->list, &priority_lists[i]);
+    iree_slim_mutex_unlock(&queue->mutex);
+  }
+}
+
+void iree_task_worker_enqueue_local_tasks(iree_task_worker_t* worker,
+                                          iree_task_list_t* list) {
+  iree_task_list_reverse(list);
+  iree_task_worker_append_local_tasks(worker, list);
+}
+
+// Flushes the worker mailbox into the local queues and resets the pending
+// priority mask. Must only be called from the worker thread.
+static void iree_task_worker_flush_mailbox(iree_task_worker_t* worker) {
+  // Reset the mask prior to flushing so that any tasks posted after this point
+  // will set it again and preempt the work we are about to perform.
+  iree_atomic_exchange_int32(&worker->pending_priority_mask, 0,
+                             iree_memory_order_acquire);
+
+  // NOTE: there's a potential for theft pessimization if the queue runs too
+  // low and there's nothing there when a thief goes to grab some tasks. A
+  // standout there would indicate that we weren't scheduling very well in the
+  // first place (large uneven workloads for various workers, bad distribution
+  // in the face of heterogenous multi-core architectures where some workers
+  // complete tasks faster than others, etc).
+  iree_task_list_t list;
+  iree_task_list_initialize(&list);
+  if (iree_atomic_task_slist_flush(
+          &worker->mailbox_slist,
+          IREE_ATOMIC_SLIST_FLUSH_ORDER_APPROXIMATE_FIFO, &list.head,
+          &list.tail)) {
+    iree_task_worker_append_local_tasks(worker, &list);
+  }
+}
+
+// Pops the next task from the worker local queues in priority order.
+static iree_task_t* iree_task_worker_pop_local_task(
+    iree_task_worker_t* worker) {
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(worker->local_task_queues);
+       ++i) {
+    iree_task_t* task =
+        iree_task_queue_pop_front(&worker->local_task_queues[i]);
+    if (task) return task;
+  }
+  return NULL;
+}
+
+// Returns true if any of the worker local queues have tasks.
+// Note that due to races this may return both false-positives and -negatives.
+static bool iree_task_worker_has_local_tasks(iree_task_worker_t* worker) {
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(worker->local_task_queues);
+       ++i) {
+    if (!iree_task_queue_is_empty(&worker->local_task_queues[i])) return true;
+  }
+  return false;
 }
 
 iree_task_t* iree_task_worker_try_steal_task(iree_task_worker_t* worker,
-                                             iree_task_queue_t* target_queue,
+                                             iree_task_queue_t* target_queues,
                                              iree_host_size_t max_tasks) {
-  // Try to grab tasks from the worker; if more than one task is stolen then the
-  // first will be returned and the remaining will be added to the target queue.
-  iree_task_t* task = iree_task_queue_try_steal(
-      &worker->local_task_queue, target_queue,
-      /*max_tasks=*/IREE_TASK_EXECUTOR_MAX_THEFT_TASK_COUNT);
-  if (task) return task;
+  // Try to grab tasks from the worker starting with the highest priority; if
+  // more than one task is stolen then the first will be returned and the
+  // remaining will be added to the target queue of the same priority.
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(worker->local_task_queues);
+       ++i) {
+    iree_task_t* task = iree_task_queue_try_steal(
+        &worker->local_task_queues[i], &target_queues[i],
+        /*max_tasks=*/IREE_TASK_EXECUTOR_MAX_THEFT_TASK_COUNT);
+    if (task) return task;
+  }
+  iree_task_t* task = NULL;
 
   // If we still didn't steal any tasks then let's try the slist instead.
   task = iree_atomic_task_slist_pop(&worker->mailbox_slist);
@@ -174,12 +311,30 @@ iree_task_t* iree_task_worker_try_steal_task(iree_task_worker_t* worker,
   return NULL;
 }
 
+void iree_task_worker_query_statistics(
+    iree_task_worker_t* worker, iree_task_worker_statistics_t* out_statistics) {
+  iree_task_worker_counters_t* counters = &worker->counters;
+#define IREE_TASK_WORKER_LOAD_COUNTER(name) \
+  out_statistics->name =                    \
+      iree_atomic_load_int64(&counters->name, iree_memory_order_relaxed)
+  IREE_TASK_WORKER_LOAD_COUNTER(task_count);
+  IREE_TASK_WORKER_LOAD_COUNTER(tile_count);
+  IREE_TASK_WORKER_LOAD_COUNTER(steal_attempt_count);
+  IREE_TASK_WORKER_LOAD_COUNTER(steal_success_count);
+  IREE_TASK_WORKER_LOAD_COUNTER(steal_duration_ns);
+  IREE_TASK_WORKER_LOAD_COUNTER(wake_count);
+  IREE_TASK_WORKER_LOAD_COUNTER(idle_duration_ns);
+#undef IREE_TASK_WORKER_LOAD_COUNTER
+}
+
 // Executes a task on a worker.
 // Only task types that are scheduled to workers are handled; all others must be
 // handled by the coordinator during scheduling.
 static void iree_task_worker_execute(
     iree_task_worker_t* worker, iree_task_t* task,
     iree_task_submission_t* pending_submission) {
+  iree_task_statistics_counter_add(&worker->counters.task_count, 1);
+
   // Execute the task and resolve the task and gather any tasks that are now
   // ready for submission to the executor. They'll be scheduled the next time
   // the coordinator runs.
@@ -187,16 +342,28 @@ static void iree_task_worker_execute(
   // TODO(benvanik): think a bit more about this timing; this ensures we have
   // BFS behavior at the cost of the additional merge overhead - it's probably
   // worth it?
-  // TODO(benvanik): handle partial tasks and re-queuing.
   switch (task->type) {
     case IREE_TASK_TYPE_CALL: {
       iree_task_call_execute((iree_task_call_t*)task, pending_submission);
       break;
     }
     case IREE_TASK_TYPE_DISPATCH_SHARD: {
-      iree_task_dispatch_shard_execute(
-          (iree_task_dispatch_shard_t*)task, worker->processor_id,
-          worker->local_memory, pending_submission);
+      // Shards may yield to higher priority work posted to this worker. When
+      // they do they go back to the front of their queue so that they resume
+      // as soon as the higher priority work has been processed.
+      const iree_task_priority_t priority =
+          iree_task_scope_priority(task->scope);
+      uint32_t tiles_executed = 0;
+      bool completed = iree_task_dispatch_shard_execute(
+          (iree_task_dispatch_shard_t*)task, worker->worker_index,
+          worker->processor_id,
+          &worker->local_memory, &worker->pending_priority_mask,
+          &tiles_executed, pending_submission);
+      iree_task_statistics_counter_add(&worker->counters.tile_count,
+                                       tiles_executed);
+      if (!completed) {
+        iree_task_queue_push_front(&worker->local_task_queues[priority], task);
+      }
       break;
     }
     default:
@@ -208,6 +375,14 @@ static void iree_task_worker_execute(
   task = NULL;
 }
 
+// Returns true if the worker is in the executor live set and may steal work.
+static bool iree_task_worker_is_live(iree_task_worker_t* worker) {
+  return iree_task_affinity_set_test(
+      iree_atomic_task_affinity_set_load(&worker->executor->worker_live_mask,
+                                         iree_memory_order_relaxed),
+      worker->worker_index);
+}
+
 // Pumps the worker thread once, processing a single task.
 // Returns true if pumping should continue as there are more tasks remaining or
 // false if the caller should wait for more tasks to be posted.
@@ -215,34 +390,52 @@ static bool iree_task_worker_pump_once(
     iree_task_worker_t* worker, iree_task_submission_t* pending_submission) {
   IREE_TRACE_ZONE_BEGIN(z0);
 
-  // Check the local work queue for any work we know we should start
+  // Check the local work queues for any work we know we should start
   // processing immediately. Other workers may try to steal some of this work
   // if we take too long.
-  iree_task_t* task = iree_task_queue_pop_front(&worker->local_task_queue);
+  iree_task_t* task = iree_task_worker_pop_local_task(worker);
+
+  // If higher priority work has been posted to the mailbox than what we were
+  // about to run then put the task back and pick up the new work first.
+  if (task) {
+    const int32_t preempting_priority_mask =
+        (1 << iree_task_scope_priority(task->scope)) - 1;
+    if (iree_atomic_load_int32(&worker->pending_priority_mask,
+                               iree_memory_order_relaxed) &
+        preempting_priority_mask) {
+      iree_task_queue_push_front(
+          &worker->local_task_queues[iree_task_scope_priority(task->scope)],
+          task);
+      iree_task_worker_flush_mailbox(worker);
+      task = iree_task_worker_pop_local_task(worker);
+    }
+  }
 
   // Check the mailbox to see if we have incoming work that has been posted.
-  // We try to greedily move it to our local work list so that we can work
+  // We try to greedily move it to our local work lists so that we can work
   // with the full thread-local pending task list.
   if (!task) {
-    // NOTE: there's a potential for theft pessimization if the queue runs too
-    // low and there's nothing there when a thief goes to grab some tasks. A
-    // standout there would indicate that we weren't scheduling very well in the
-    // first place (large uneven workloads for various workers, bad distribution
-    // in the face of heterogenous multi-core architectures where some workers
-    // complete tasks faster than others, etc).
-    task = iree_task_queue_flush_from_lifo_slist(&worker->local_task_queue,
-                                                 &worker->mailbox_slist);
+    iree_task_worker_flush_mailbox(worker);
+    task = iree_task_worker_pop_local_task(worker);
   }
 
   // If we ran out of work assigned to this specific worker try to steal some
   // from other workers that we hopefully share some of the cache hierarchy
   // with. Their tasks will be moved from their local queue into ours and the
-  // the first task in the queue is popped off and returned.
-  if (!task) {
+  // the first task in the queue is popped off and returned. Workers that have
+  // been removed from the live set only drain what was posted to them.
+  if (!task && iree_task_worker_is_live(worker)) {
+    const iree_time_t steal_start_ns = iree_time_now();
     task = iree_task_executor_try_steal_task(
         worker->executor, worker->constructive_sharing_mask,
+        worker->node_sharing_mask,
         worker->max_theft_attempts, &worker->theft_prng,
-        &worker->local_task_queue);
+        worker->local_task_queues);
+    iree_task_statistics_counter_add(&worker->counters.steal_attempt_count, 1);
+    iree_task_statistics_counter_add(&worker->counters.steal_success_count,
+                                     task ? 1 : 0);
+    iree_task_statistics_counter_add(&worker->counters.steal_duration_ns,
+                                     iree_time_now() - steal_start_ns);
   }
 
   // No tasks to run; let the caller know we want to wait for more.
@@ -264,6 +457,62 @@ static void iree_task_worker_update_processor_id(iree_task_worker_t* worker) {
   iree_cpu_requery_processor_id(&worker->processor_tag, &worker->processor_id);
 }
 
+// Reapplies the ideal thread affinity of the worker if the executor indicates
+// that the processors available may have changed since it was last applied.
+// When all processors in a thread's affinity go offline (CPU hotplug) the
+// kernel discards the affinity and it must be requested again once they return.
+static void iree_task_worker_refresh_affinity(iree_task_worker_t* worker) {
+  const int32_t affinity_epoch = iree_atomic_load_int32(
+      &worker->executor->worker_affinity_epoch, iree_memory_order_acquire);
+  if (IREE_LIKELY(affinity_epoch == worker->affinity_epoch)) return;
+  worker->affinity_epoch = affinity_epoch;
+  iree_thread_request_affinity(worker->thread, worker->ideal_thread_affinity);
+  iree_task_worker_update_processor_id(worker);
+}
+
+bool iree_task_worker_pump_until_idle(iree_task_worker_t* worker) {
+  iree_atomic_task_affinity_set_fetch_and_not(
+      &worker->executor->worker_idle_mask, worker->worker_bit,
+      iree_memory_order_seq_cst);
+
+  // TODO(benvanik): we could try to update the processor ID here before we
+  // begin a new batch of work - assuming it's not too expensive.
+
+  iree_task_submission_t pending_submission;
+  iree_task_submission_initialize(&pending_submission);
+
+  while (iree_task_worker_pump_once(worker, &pending_submission)) {
+    // All work done ^, which will return false when the worker should wait.
+  }
+
+  bool schedule_dirty = false;
+  if (!iree_task_submission_is_empty(&pending_submission)) {
+    iree_task_executor_merge_submission(worker->executor, &pending_submission);
+    schedule_dirty = true;
+  }
+
+  // We've finished all the work we have scheduled so set our idle flag.
+  // This ensures that if any other thread comes in and wants to give us
+  // work we will properly coordinate/wake below.
+  iree_atomic_task_affinity_set_fetch_or(&worker->executor->worker_idle_mask,
+                                         worker->worker_bit,
+                                         iree_memory_order_seq_cst);
+
+  // When we encounter a complete lack of work we can self-nominate to check
+  // the global work queue and distribute work to other threads. Only one
+  // coordinator can be running at a time so we also ensure that if another
+  // is doing its work we gracefully wait for it. It's fine to block in here
+  // as the next thing we'd have done is go idle anyway.
+
+  // First self-nominate; this *may* do something or just be ignored (if
+  // another worker is already coordinating).
+  iree_task_executor_coordinate(worker->executor, worker);
+
+  // If nothing has been enqueued since we started (so even coordination didn't
+  // find anything) the worker can go idle.
+  return schedule_dirty || iree_task_worker_has_local_tasks(worker);
+}
+
 // Alternates between pumping ready tasks in the worker queue and waiting
 // for more tasks to arrive. Only returns when the worker has been asked by
 // the executor to exit.
@@ -282,9 +531,6 @@ static void iree_task_worker_pump_until_exit(iree_task_worker_t* worker) {
     // structures we use.
     iree_wait_token_t wait_token =
         iree_notification_prepare_wait(&worker->wake_notification);
-    iree_atomic_task_affinity_set_fetch_and(&worker->executor->worker_idle_mask,
-                                            ~worker->worker_bit,
-                                            iree_memory_order_seq_cst);
 
     // Check state to see if we've been asked to exit.
     if (iree_atomic_load_int32(&worker->state, iree_memory_order_seq_cst) ==
@@ -295,57 +541,32 @@ static void iree_task_worker_pump_until_exit(iree_task_worker_t* worker) {
       break;
     }
 
-    // TODO(benvanik): we could try to update the processor ID here before we
-    // begin a new batch of work - assuming it's not too expensive.
-
-    iree_task_submission_t pending_submission;
-    iree_task_submission_initialize(&pending_submission);
-
-    while (iree_task_worker_pump_once(worker, &pending_submission)) {
-      // All work done ^, which will return false when the worker should wait.
-    }
-
-    bool schedule_dirty = false;
-    if (!iree_task_submission_is_empty(&pending_submission)) {
-      iree_task_executor_merge_submission(worker->executor,
-                                          &pending_submission);
-      schedule_dirty = true;
-    }
-
-    // We've finished all the work we have scheduled so set our idle flag.
-    // This ensures that if any other thread comes in and wants to give us
-    // work we will properly coordinate/wake below.
-    iree_atomic_task_affinity_set_fetch_or(&worker->executor->worker_idle_mask,
-                                           worker->worker_bit,
-                                           iree_memory_order_seq_cst);
-
-    // When we encounter a complete lack of work we can self-nominate to check
-    // the global work queue and distribute work to other threads. Only one
-    // coordinator can be running at a time so we also ensure that if another
-    // is doing its work we gracefully wait for it. It's fine to block in here
-    // as the next thing we'd have done is go idle anyway.
-
-    // First self-nominate; this *may* do something or just be ignored (if
-    // another worker is already coordinating).
-    iree_task_executor_coordinate(worker->executor, worker);
-
-    // If nothing has been enqueued since we started this loop (so even
-    // coordination didn't find anything) we go idle. Otherwise we fall
-    // through and try the loop again.
-    if (schedule_dirty ||
-        !iree_task_queue_is_empty(&worker->local_task_queue)) {
+    // Run all available work and coordinate; if nothing has been enqueued
+    // since we started this loop we go idle. Otherwise we fall through and try
+    // the loop again.
+    if (iree_task_worker_pump_until_idle(worker)) {
       // Have more work to do; loop around to try another pump.
       iree_notification_cancel_wait(&worker->wake_notification);
     } else {
+      // Spin (if configured) and then park until woken. Spinning keeps the
+      // thread scheduled so that work arriving shortly (such as the next
+      // dispatch in a pipeline) can be picked up without the kernel wake
+      // latency.
       IREE_TRACE_ZONE_BEGIN_NAMED(z_wait,
                                   "iree_task_worker_main_pump_wake_wait");
+      const iree_time_t idle_start_ns = iree_time_now();
       iree_notification_commit_wait(&worker->wake_notification, wait_token,
+                                    worker->executor->worker_spin_ns,
                                     IREE_TIME_INFINITE_FUTURE);
+      iree_task_statistics_counter_add(&worker->counters.idle_duration_ns,
+                                       iree_time_now() - idle_start_ns);
+      iree_task_statistics_counter_add(&worker->counters.wake_count, 1);
       IREE_TRACE_ZONE_END(z_wait);
 
       // Woke from a wait - query the processor ID in case we migrated during
-      // the sleep.
+      // the sleep and reapply our affinity if processors have changed.
       iree_task_worker_update_processor_id(worker);
+      iree_task_worker_refresh_affinity(worker);
     }
 
     // Wait completed.
@@ -362,10 +583,21 @@ static int iree_task_worker_main(iree_task_worker_t* worker) {
   // Be explicit here on what we need.
   iree_fpu_state_push(IREE_FPU_STATE_FLAG_FLUSH_DENORMALS_TO_ZERO);
 
-  // Reset affinity (as it can change over time).
-  // TODO(benvanik): call this after waking in case CPU hotplugging happens.
+  // Reset affinity (as it can change over time). This is reapplied after
+  // waking if the executor is told the available processors have changed.
+  worker->affinity_epoch = iree_atomic_load_int32(
+      &worker->executor->worker_affinity_epoch, iree_memory_order_acquire);
   iree_thread_request_affinity(worker->thread, worker->ideal_thread_affinity);
 
+  // Reserve the worker local memory from the worker thread now that it is
+  // running with its ideal affinity. The executor does not allocate it so that
+  // on systems with first-touch page placement (Linux, Windows) the pages are
+  // allocated on the NUMA node of the worker instead of the creator. Failures
+  // are not fatal: dispatches will try to grow the block again and report the
+  // failure if they require local memory.
+  iree_status_ignore(iree_task_local_memory_reserve(
+      &worker->local_memory, worker->local_memory_size));
+
   // Enter the running state immediately. Note that we could have been requested
   // to exit while suspended/still starting up, so check that here before we
   // mess with any data structures.
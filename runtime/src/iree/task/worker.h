@@ -18,7 +18,9 @@
 #include "iree/task/affinity_set.h"
 #include "iree/task/executor.h"
 #include "iree/task/list.h"
+#include "iree/task/local_memory.h"
 #include "iree/task/queue.h"
+#include "iree/task/scope.h"
 #include "iree/task/task.h"
 #include "iree/task/topology.h"
 #include "iree/task/tuning.h"
@@ -50,6 +52,19 @@ typedef enum iree_task_worker_state_e {
   IREE_TASK_WORKER_STATE_ZOMBIE = 3,
 } iree_task_worker_state_t;
 
+// Statistics counters maintained by a worker and reported through
+// iree_task_executor_query_statistics. Only the thread pumping the worker
+// writes them and readers on other threads use relaxed loads.
+typedef struct iree_task_worker_counters_t {
+  iree_atomic_int64_t task_count;
+  iree_atomic_int64_t tile_count;
+  iree_atomic_int64_t steal_attempt_count;
+  iree_atomic_int64_t steal_success_count;
+  iree_atomic_int64_t steal_duration_ns;
+  iree_atomic_int64_t wake_count;
+  iree_atomic_int64_t idle_duration_ns;
+} iree_task_worker_counters_t;
+
 // A worker within the executor pool.
 //
 // NOTE: fields in here are touched from multiple threads with lock-free
@@ -63,9 +78,16 @@ typedef struct iree_task_worker_t {
   // them based on the work distribution policy. When workers go to look for
   // more work after their local queue empties they will flush this list and
   // move all of the tasks into their local queue and restart processing.
-  // LAYOUT: must be 64b away from local_task_queue.
+  // LAYOUT: must be 64b away from local_task_queues.
   iree_atomic_task_slist_t mailbox_slist;
 
+  // A bitmask of (1 << iree_task_priority_t) for each priority of the tasks
+  // posted to the mailbox since it was last flushed. Dispatch shards executing
+  // on the worker check this between tile reservations and yield if any higher
+  // priority work is pending.
+  // LAYOUT: next to mailbox_slist as posters touch both.
+  iree_atomic_int32_t pending_priority_mask;
+
   // Current state of the worker (iree_task_worker_state_t).
   // LAYOUT: frequent access; next to wake_notification as they are always
   //         accessed together.
@@ -84,12 +106,19 @@ typedef struct iree_task_worker_t {
   // pool. Executors always outlive the workers they own.
   iree_task_executor_t* executor;
 
+  // Index of the worker in the executor worker list.
+  iree_host_size_t worker_index;
+
   // Bit the worker represents in the various worker bitsets.
   iree_task_affinity_set_t worker_bit;
 
   // Ideal thread affinity for the worker thread.
   iree_thread_affinity_t ideal_thread_affinity;
 
+  // Value of the executor worker_affinity_epoch when the ideal thread affinity
+  // was last applied. Only touched by the worker thread.
+  int32_t affinity_epoch;
+
   // A bitmask of other group indices that share some level of the cache
   // hierarchy. Workers of this group are more likely to constructively share
   // some cache levels higher up with these other groups. For example, if the
@@ -97,6 +126,12 @@ typedef struct iree_task_worker_t {
   // all share the same L3 cache.
   iree_task_affinity_set_t constructive_sharing_mask;
 
+  // A bitmask of other workers that are on the same NUMA node. Work is stolen
+  // from these workers before any others outside of the
+  // constructive_sharing_mask so that tasks (and the memory they touch) tend to
+  // stay on the node they were issued to.
+  iree_task_affinity_set_t node_sharing_mask;
+
   // Maximum number of attempts to make when trying to steal tasks from other
   // workers. This could be 64 (try stealing from all workers) or just a handful
   // (try stealing from these 3 other cores that share your L3 cache).
@@ -107,7 +142,8 @@ typedef struct iree_task_worker_t {
   iree_prng_minilcg128_state_t theft_prng;
 
   // Thread handle of the worker. If the thread has exited the handle will
-  // remain valid so that the executor can query its state.
+  // remain valid so that the executor can query its state. NULL if the worker
+  // has no thread and is only pumped by donated callers.
   iree_thread_t* thread;
 
   // Guess at the current processor ID.
@@ -120,7 +156,7 @@ typedef struct iree_task_worker_t {
   iree_cpu_processor_tag_t processor_tag;
 
   // Destructive interference padding between the mailbox and local task queue
-  // to ensure that the worker - who is pounding on local_task_queue - doesn't
+  // to ensure that the worker - who is pounding on local_task_queues - doesn't
   // contend with submissions or coordinators dropping new tasks in the mailbox.
   //
   // Today we don't need this, however on 32-bit systems or if we adjust the
@@ -131,34 +167,52 @@ typedef struct iree_task_worker_t {
   // interference) this is the only place padding should be added.
   // uint8_t _padding[8];
 
-  // Pointer to local memory available for use exclusively by the worker.
-  // The base address should be aligned to avoid false sharing with other
-  // workers.
-  iree_byte_span_t local_memory;
+  // Persistent local memory available for use exclusively by the worker.
+  // Grows to the high-water mark of the dispatches executed by the worker and
+  // is aligned to avoid false sharing with other workers.
+  iree_task_local_memory_t local_memory;
+  // Bytes of local memory reserved when the worker thread starts.
+  iree_host_size_t local_memory_size;
 
-  // Worker-local FIFO queue containing the tasks that will be processed by the
-  // worker. This queue supports work-stealing by other workers if they run out
-  // of work of their own.
+  // Worker-local FIFO queues containing the tasks that will be processed by the
+  // worker, indexed by iree_task_priority_t. Tasks in higher priority queues
+  // are always processed first. These queues support work-stealing by other
+  // workers if they run out of work of their own.
   // LAYOUT: must be 64b away from mailbox_slist.
-  iree_task_queue_t local_task_queue;
+  iree_task_queue_t local_task_queues[IREE_TASK_PRIORITY_COUNT];
+
+  // Scheduling statistics counters.
+  // LAYOUT: only touched by the worker thread outside of infrequent queries.
+  iree_task_worker_counters_t counters;
 } iree_task_worker_t;
 static_assert(offsetof(iree_task_worker_t, mailbox_slist) +
                       sizeof(iree_atomic_task_slist_t) <
                   iree_hardware_constructive_interference_size,
               "mailbox_slist must be in the first cache line");
-static_assert(offsetof(iree_task_worker_t, local_task_queue) >=
+static_assert(offsetof(iree_task_worker_t, local_task_queues) >=
                   iree_hardware_constructive_interference_size,
-              "local_task_queue must be separated from mailbox_slist by "
+              "local_task_queues must be separated from mailbox_slist by "
               "at least a cache line");
 
 // Initializes a worker by creating its thread and configuring it for receiving
 // tasks. Where supported the worker will be created in a suspended state so
 // that we aren't creating a thundering herd on startup:
 // https://en.wikipedia.org/wiki/Thundering_herd_problem
+//
+// If |topology_group| is NULL then no thread is created and the worker will
+// only make progress when pumped by a donated caller thread with
+// iree_task_worker_pump_until_idle.
+//
+// |node_sharing_mask| indicates which other workers are on the same NUMA node.
+// |local_memory_size| bytes of local memory are reserved by the worker thread
+// itself so that on systems with first-touch page placement it resides on the
+// worker's node.
 iree_status_t iree_task_worker_initialize(
     iree_task_executor_t* executor, iree_host_size_t worker_index,
     const iree_task_topology_group_t* topology_group,
-    iree_byte_span_t local_memory, iree_prng_splitmix64_state_t* seed_prng,
+    iree_task_affinity_set_t node_sharing_mask,
+    iree_task_local_memory_flags_t local_memory_flags,
+    iree_host_size_t local_memory_size, iree_prng_splitmix64_state_t* seed_prng,
     iree_task_worker_t* out_worker);
 
 // Requests that the worker begin exiting (if it hasn't already).
@@ -189,13 +243,39 @@ void iree_task_worker_deinitialize(iree_task_worker_t* worker);
 void iree_task_worker_post_tasks(iree_task_worker_t* worker,
                                  iree_task_list_t* list);
 
+// Moves a LIFO list of tasks directly into the worker local queues based on
+// their priority, bypassing the mailbox.
+//
+// Must only be called from the worker thread.
+void iree_task_worker_enqueue_local_tasks(iree_task_worker_t* worker,
+                                          iree_task_list_t* list);
+
+// Returns the current statistics of |worker| in |out_statistics|.
+//
+// May be called from any thread.
+void iree_task_worker_query_statistics(
+    iree_task_worker_t* worker, iree_task_worker_statistics_t* out_statistics);
+
+// Pumps the worker from the calling thread until it has no more tasks to
+// process. Any newly-readied tasks are merged back into the executor and the
+// caller self-nominates for coordination.
+// Returns true if more work may be available for the worker and it should be
+// pumped again or false if it is idle.
+//
+// Must only be called from the worker thread or, for workers without a thread,
+// the single caller currently donated to the worker.
+bool iree_task_worker_pump_until_idle(iree_task_worker_t* worker);
+
 // Tries to steal up to |max_tasks| from the back of the queue.
 // Returns NULL if no tasks are available and otherwise up to |max_tasks| tasks
-// that were at the tail of the worker FIFO will be moved to the |target_queue|
-// and the first of the stolen tasks is returned. While tasks from the FIFO
-// are preferred this may also steal tasks from the mailbox.
+// that were at the tail of the worker FIFO will be moved to the |target_queues|
+// of the same priority and the first of the stolen tasks is returned. Higher
+// priority tasks are stolen first. While tasks from the FIFOs are preferred
+// this may also steal tasks from the mailbox.
+//
+// |target_queues| must have IREE_TASK_PRIORITY_COUNT queues.
 iree_task_t* iree_task_worker_try_steal_task(iree_task_worker_t* worker,
-                                             iree_task_queue_t* target_queue,
+                                             iree_task_queue_t* target_queues,
                                              iree_host_size_t max_tasks);
 
 #ifdef __cplusplus
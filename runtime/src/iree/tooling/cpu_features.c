@@ -6,6 +6,7 @@
 
 #include "iree/tooling/cpu_features.h"
 
+#include "iree/base/internal/cpu.h"
 #include "iree/base/target_platform.h"
 
 #if defined(IREE_PLATFORM_LINUX) && defined(IREE_ARCH_ARM_64)
@@ -143,11 +144,53 @@ void iree_cpu_features_free(iree_allocator_t allocator,
   iree_allocator_free(allocator, cpu_features);
 }
 
+typedef struct iree_cpu_features_data0_bit_t {
+  const char* name;
+  uint64_t bit;
+} iree_cpu_features_data0_bit_t;
+
+// Features detected by iree/base/internal/cpu.h, named as in LLVM.
+static const iree_cpu_features_data0_bit_t iree_cpu_features_data0_bits[] = {
+#if defined(IREE_ARCH_X86_64)
+    {"+avx", IREE_CPU_DATA0_X86_64_AVX},
+    {"+avx2", IREE_CPU_DATA0_X86_64_AVX2},
+    {"+fma", IREE_CPU_DATA0_X86_64_FMA},
+    {"+f16c", IREE_CPU_DATA0_X86_64_F16C},
+    {"+avx512f", IREE_CPU_DATA0_X86_64_AVX512F},
+    {"+avx512cd", IREE_CPU_DATA0_X86_64_AVX512CD},
+    {"+avx512vl", IREE_CPU_DATA0_X86_64_AVX512VL},
+    {"+avx512dq", IREE_CPU_DATA0_X86_64_AVX512DQ},
+    {"+avx512bw", IREE_CPU_DATA0_X86_64_AVX512BW},
+    {"+avx512vnni", IREE_CPU_DATA0_X86_64_AVX512VNNI},
+    {"+avx512vbmi", IREE_CPU_DATA0_X86_64_AVX512VBMI},
+    {"+avx512ifma", IREE_CPU_DATA0_X86_64_AVX512IFMA},
+    {"+avx512bf16", IREE_CPU_DATA0_X86_64_AVX512BF16},
+    {"+amx-tile", IREE_CPU_DATA0_X86_64_AMXTILE},
+    {"+amx-int8", IREE_CPU_DATA0_X86_64_AMXINT8},
+    {"+amx-bf16", IREE_CPU_DATA0_X86_64_AMXBF16},
+#elif defined(IREE_ARCH_ARM_64)
+    {"+fullfp16", IREE_CPU_DATA0_ARM_64_FP16},
+    {"+bf16", IREE_CPU_DATA0_ARM_64_BF16},
+    {"+sve", IREE_CPU_DATA0_ARM_64_SVE},
+    {"+sve2", IREE_CPU_DATA0_ARM_64_SVE2},
+#endif  // IREE_ARCH_*
+    {NULL, 0},
+};
+
 iree_status_t iree_cpu_features_query(iree_cpu_features_t* cpu_features,
                                       iree_string_view_t feature,
                                       bool* out_result) {
   *out_result = false;
 
+  for (const iree_cpu_features_data0_bit_t* entry =
+           iree_cpu_features_data0_bits;
+       entry->name; ++entry) {
+    if (iree_string_view_equal(feature, iree_make_cstring_view(entry->name))) {
+      *out_result = (iree_cpu_info()->data[0] & entry->bit) != 0;
+      return iree_ok_status();
+    }
+  }
+
 #ifdef IREE_ARCH_ARM_64
   if (iree_string_view_equal(feature, iree_make_cstring_view("+dotprod"))) {
     *out_result = iree_cpu_features_aarch64_dotprod(cpu_features);
@@ -163,3 +206,33 @@ iree_status_t iree_cpu_features_query(iree_cpu_features_t* cpu_features,
                           "unhandled CPU feature: '%.*s'", (int)feature.size,
                           feature.data);
 }
+
+iree_status_t iree_cpu_features_query_value(iree_cpu_features_t* cpu_features,
+                                            iree_string_view_t key,
+                                            uint64_t* out_value) {
+  *out_value = 0;
+  const iree_cpu_info_t* info = iree_cpu_info();
+  const struct {
+    const char* key;
+    uint64_t value;
+  } values[] = {
+      {"cache_line_size", info->cache_line_size},
+      {"l1_cache_size", info->cache_sizes[0]},
+      {"l2_cache_size", info->cache_sizes[1]},
+      {"l3_cache_size", info->cache_sizes[2]},
+      {"logical_processor_count", info->logical_processor_count},
+      {"physical_core_count", info->physical_core_count},
+      {"smt_width", info->smt_width},
+      {"numa_node_count", info->numa_node_count},
+      {"cluster_count", info->cluster_count},
+  };
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(values); ++i) {
+    if (iree_string_view_equal(key, iree_make_cstring_view(values[i].key))) {
+      *out_value = values[i].value;
+      return iree_ok_status();
+    }
+  }
+  return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                          "unhandled CPU property: '%.*s'", (int)key.size,
+                          key.data);
+}
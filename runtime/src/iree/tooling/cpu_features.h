@@ -37,7 +37,19 @@ void iree_cpu_features_free(iree_allocator_t allocator,
 // On success, *result contains true if and only if the named feature is
 // supported by the CPU. cpu_features must have been previously created by
 // iree_cpu_features_allocate.
+//
+// Features are named as in LLVM target features, such as `+avx2` or
+// `+avx512vnni` on x86_64 and `+dotprod`, `+i8mm` or `+sve` on aarch64.
 iree_status_t iree_cpu_features_query(iree_cpu_features_t* cpu_features,
                                       iree_string_view_t feature, bool* result);
 
+// On success, *value contains the named numeric property of the host CPU or 0
+// if it could not be determined on the current platform. Supported keys:
+//   cache_line_size, l1_cache_size, l2_cache_size, l3_cache_size (bytes)
+//   logical_processor_count, physical_core_count, smt_width
+//   numa_node_count, cluster_count
+iree_status_t iree_cpu_features_query_value(iree_cpu_features_t* cpu_features,
+                                            iree_string_view_t key,
+                                            uint64_t* value);
+
 #endif  // IREE_TOOLING_CPU_FEATURES_H_
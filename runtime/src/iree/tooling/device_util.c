@@ -371,3 +371,42 @@ iree_status_t iree_hal_create_device_from_flags(
   return iree_hal_create_device(iree_hal_available_driver_registry(),
                                 device_uri, host_allocator, out_device);
 }
+
+//===----------------------------------------------------------------------===//
+// Device profiling
+//===----------------------------------------------------------------------===//
+
+IREE_FLAG(string, device_profiling_mode, "",
+          "HAL device profiling mode: empty to disable or 'dispatches' to "
+          "capture per-dispatch timing and tile distribution on devices that "
+          "support it.");
+IREE_FLAG(string, device_profiling_file, "",
+          "File path the device profiling capture is written to.");
+
+iree_status_t iree_hal_begin_profiling_from_flags(iree_hal_device_t* device) {
+  iree_string_view_t mode_str =
+      iree_make_cstring_view(FLAG_device_profiling_mode);
+  if (iree_string_view_is_empty(mode_str)) return iree_ok_status();
+
+  iree_hal_device_profiling_options_t options = {0};
+  if (iree_string_view_equal(mode_str, IREE_SV("dispatches"))) {
+    options.mode = IREE_HAL_DEVICE_PROFILING_MODE_DISPATCHES;
+  } else {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "unsupported --device_profiling_mode=%.*s; "
+                            "expected 'dispatches'",
+                            (int)mode_str.size, mode_str.data);
+  }
+  options.file_path = FLAG_device_profiling_file;
+  if (!options.file_path || options.file_path[0] == 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "--device_profiling_file= must be specified when "
+                            "profiling is enabled");
+  }
+  return iree_hal_device_profiling_begin(device, &options);
+}
+
+iree_status_t iree_hal_end_profiling_from_flags(iree_hal_device_t* device) {
+  if (FLAG_device_profiling_mode[0] == 0) return iree_ok_status();
+  return iree_hal_device_profiling_end(device);
+}
@@ -33,6 +33,14 @@ iree_status_t iree_hal_create_device_from_flags(
     iree_string_view_t default_device, iree_allocator_t host_allocator,
     iree_hal_device_t** out_device);
 
+// Begins profiling |device| as specified by the --device_profiling_mode= and
+// --device_profiling_file= flags. No-op if profiling was not requested.
+iree_status_t iree_hal_begin_profiling_from_flags(iree_hal_device_t* device);
+
+// Ends profiling |device| if it was begun with
+// iree_hal_begin_profiling_from_flags and writes the capture.
+iree_status_t iree_hal_end_profiling_from_flags(iree_hal_device_t* device);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -0,0 +1,144 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/tooling/module_util.h"
+
+#include <stdio.h>
+
+#include "iree/base/internal/file_io.h"
+#include "iree/base/internal/flags.h"
+#include "iree/base/tracing.h"
+#include "iree/vm/bytecode_module.h"
+
+IREE_FLAG(string, module_native_library, "",
+          "Shared library containing an ahead-of-time compiled implementation "
+          "of the bytecode module used for execution instead of the "
+          "interpreter.");
+
+IREE_FLAG(string, parameter_archive, "",
+          "Parameter archive containing the large constants of the bytecode "
+          "module as produced by the compiler with "
+          "--iree-vm-bytecode-module-parameter-archive=. The archive is mapped "
+          "and used in-place.");
+
+// Function exported by C target modules to create the native module.
+typedef iree_status_t(IREE_API_PTR* iree_vm_c_module_create_fn_t)(
+    iree_allocator_t allocator, iree_vm_module_t** out_module);
+
+// Loads |library_path| and creates the native module implementing
+// |module_name| from it.
+static iree_status_t iree_tooling_load_native_module(
+    const char* library_path, iree_string_view_t module_name,
+    iree_allocator_t host_allocator, iree_dynamic_library_t** out_library,
+    iree_vm_module_t** out_module) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // C target modules export a `<module_name>_create` function.
+  char symbol_name[256];
+  int symbol_length = snprintf(symbol_name, sizeof(symbol_name), "%.*s_create",
+                               (int)module_name.size, module_name.data);
+  if (symbol_length < 0 || symbol_length >= (int)sizeof(symbol_name)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "module name '%.*s' too long",
+                            (int)module_name.size, module_name.data);
+  }
+
+  iree_dynamic_library_t* library = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_dynamic_library_load_from_file(library_path,
+                                              IREE_DYNAMIC_LIBRARY_FLAG_NONE,
+                                              host_allocator, &library));
+
+  iree_vm_c_module_create_fn_t create_fn = NULL;
+  iree_status_t status = iree_dynamic_library_lookup_symbol(
+      library, symbol_name, (void**)&create_fn);
+  iree_vm_module_t* module = NULL;
+  if (iree_status_is_ok(status)) {
+    status = create_fn(host_allocator, &module);
+  }
+
+  if (iree_status_is_ok(status)) {
+    *out_library = library;
+    *out_module = module;
+  } else {
+    status = iree_status_annotate_f(status, "loading native module from '%s'",
+                                    library_path);
+    iree_dynamic_library_release(library);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+iree_status_t iree_tooling_create_bytecode_module_from_flags(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_allocator_t host_allocator, iree_dynamic_library_t** out_library,
+    iree_vm_module_t** out_module) {
+  IREE_ASSERT_ARGUMENT(out_library);
+  IREE_ASSERT_ARGUMENT(out_module);
+  *out_library = NULL;
+  *out_module = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  // Map the parameters; ownership passes to the module created with them.
+  iree_file_contents_t* parameter_contents = NULL;
+  if (FLAG_parameter_archive[0] != 0) {
+    IREE_RETURN_AND_END_ZONE_IF_ERROR(
+        z0, iree_file_map_contents(FLAG_parameter_archive, host_allocator,
+                                   &parameter_contents));
+  }
+  iree_const_byte_span_t parameter_span =
+      parameter_contents ? parameter_contents->const_buffer
+                         : iree_const_byte_span_empty();
+
+  if (FLAG_module_native_library[0] == 0) {
+    iree_status_t status = iree_vm_bytecode_module_create_with_parameters(
+        archive_contents, archive_allocator, parameter_span,
+        parameter_contents ? iree_file_contents_deallocator(parameter_contents)
+                           : iree_allocator_null(),
+        host_allocator, out_module);
+    if (!iree_status_is_ok(status)) {
+      iree_file_contents_free(parameter_contents);
+    }
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+
+  // The module name is needed to find the native implementation and the
+  // simplest way to get it is to load the archive without taking ownership.
+  // Native modules embed their constants and only need the parameters here.
+  iree_vm_module_t* name_module = NULL;
+  iree_status_t name_status = iree_vm_bytecode_module_create_with_parameters(
+      archive_contents, iree_allocator_null(), parameter_span,
+      iree_allocator_null(), host_allocator, &name_module);
+  if (!iree_status_is_ok(name_status)) {
+    iree_file_contents_free(parameter_contents);
+    IREE_TRACE_ZONE_END(z0);
+    return name_status;
+  }
+  iree_dynamic_library_t* library = NULL;
+  iree_vm_module_t* native_module = NULL;
+  iree_status_t status = iree_tooling_load_native_module(
+      FLAG_module_native_library, iree_vm_module_name(name_module),
+      host_allocator, &library, &native_module);
+  iree_vm_module_release(name_module);
+  iree_file_contents_free(parameter_contents);
+
+  if (iree_status_is_ok(status)) {
+    status = iree_vm_bytecode_module_create_with_native(
+        archive_contents, archive_allocator, native_module, host_allocator,
+        out_module);
+  }
+  iree_vm_module_release(native_module);
+
+  if (iree_status_is_ok(status)) {
+    *out_library = library;
+  } else {
+    iree_dynamic_library_release(library);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -0,0 +1,40 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_TOOLING_MODULE_UTIL_H_
+#define IREE_TOOLING_MODULE_UTIL_H_
+
+#include "iree/base/api.h"
+#include "iree/base/internal/dynamic_library.h"
+#include "iree/vm/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Creates a bytecode module from |archive_contents| as with
+// iree_vm_bytecode_module_create.
+//
+// If the --module_native_library= flag is specified the shared library it
+// references is loaded and the module is executed using the ahead-of-time
+// compiled implementation it contains. Libraries are produced by compiling the
+// C target output (`--output-format=vm-c`) of the same program and must
+// export the `<module_name>_create` function the C target emits. The library
+// is returned in |out_library| (or NULL if none was loaded) and must be
+// released by the caller after all references to |out_module| are released.
+//
+// If the --parameter_archive= flag is specified the parameter archive it
+// references is mapped and used for the module rodata stored within it.
+iree_status_t iree_tooling_create_bytecode_module_from_flags(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_allocator_t host_allocator, iree_dynamic_library_t** out_library,
+    iree_vm_module_t** out_module);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_TOOLING_MODULE_UTIL_H_
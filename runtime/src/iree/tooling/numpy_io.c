@@ -26,6 +26,44 @@
 //   padded with spaces (\x20) such that
 //   `len(magic string) + 2 + len(length) + HEADER_LEN` % 64 = 0
 
+// Maximum supported ndarray rank. numpy itself limits arrays to 32 dimensions.
+#define IREE_NUMPY_NPY_MAX_SHAPE_RANK 128
+
+// Fixed prefix of all npy files preceding the variable-length header length.
+typedef struct {
+  uint8_t magic[6];
+  uint8_t version_major;
+  uint8_t version_minor;
+} iree_numpy_npy_prefix_t;
+static_assert(sizeof(iree_numpy_npy_prefix_t) == 8, "packing");
+
+// Verifies that |prefix| is from a supported npy file and returns the size in
+// bytes of the header length that immediately follows it.
+static iree_status_t iree_numpy_npy_verify_prefix(
+    const iree_numpy_npy_prefix_t* prefix, iree_host_size_t* out_length_size) {
+  // Verify magic bytes to confirm this is an npy file.
+  static const uint8_t kMagicBytes[6] = {0x93, 'N', 'U', 'M', 'P', 'Y'};
+  if (memcmp(prefix->magic, kMagicBytes, sizeof(kMagicBytes)) != 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "npy header magic mismatch");
+  }
+
+  // Ensure we support the version; newer versions aren't expected to parse.
+  // There's been no minor versions yet so we only need to check major.
+  if (prefix->version_major <= 0 || prefix->version_major > 3) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "npy version %d.%d not supported",
+                            prefix->version_major, prefix->version_minor);
+  }
+
+  // Have never seen a header actually needing 4-bytes (any reason to have one
+  // wouldn't matter here as we only need dtype and shape), but the v3.x format
+  // always uses 4-byte headers. numpy still saves in the v1.x 2-byte format for
+  // compatibility so we do the same.
+  *out_length_size = prefix->version_major == 1 ? 2 : 4;
+  return iree_ok_status();
+}
+
 // Reads the numpy file header string into an allocated |out_header_buffer|.
 // Upon successful return the |stream| will be positioned immediately at the
 // start of the file payload.
@@ -41,39 +79,17 @@ static iree_status_t iree_numpy_npy_read_header(
 
   // Since the header contents vary based on version we read the fixed prefix
   // first and then continue with the rest.
-  struct {
-    uint8_t magic[6];
-    uint8_t version_major;
-    uint8_t version_minor;
-  } header;
-  static_assert(sizeof(header) == 8, "packing");
+  iree_numpy_npy_prefix_t header;
   if (fread(&header, 1, sizeof(header), stream) != sizeof(header)) {
     return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
                             "unable to read entire header prefix");
   }
-
-  // Verify magic bytes to confirm this is an npy file.
-  static const uint8_t kMagicBytes[6] = {0x93, 'N', 'U', 'M', 'P', 'Y'};
-  if (memcmp(header.magic, kMagicBytes, sizeof(kMagicBytes)) != 0) {
-    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
-                            "npy header magic mismatch");
-  }
-
-  // Ensure we support the version; newer versions aren't expected to parse.
-  // There's been no minor versions yet so we only need to check major.
-  if (header.version_major <= 0 || header.version_major > 3) {
-    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                            "npy version %d.%d not supported",
-                            header.version_major, header.version_minor);
-  }
+  iree_host_size_t length_size = 0;
+  IREE_RETURN_IF_ERROR(iree_numpy_npy_verify_prefix(&header, &length_size));
 
   // Read 2- or 4-byte header length.
-  // Have never seen a header actually needing 4-bytes (any reason to have one
-  // wouldn't matter here as we only need dtype and shape), but the v3.x format
-  // always uses 4-byte headers. numpy still saves in the v1.x 2-byte format for
-  // compatibility so we do the same.
   iree_host_size_t header_length = 0;
-  if (header.version_major == 1) {
+  if (length_size == 2) {
     uint16_t header_length_u16 = 0;
     if (fread(&header_length_u16, 1, sizeof(header_length_u16), stream) !=
         sizeof(header_length_u16)) {
@@ -295,6 +311,59 @@ static iree_status_t iree_numpy_parse_shape_dims(iree_string_view_t shape,
   return iree_ok_status();
 }
 
+// ndarray metadata parsed from an npy header.
+typedef struct iree_numpy_npy_array_info_t {
+  iree_host_size_t shape_rank;
+  iree_hal_dim_t shape[IREE_NUMPY_NPY_MAX_SHAPE_RANK];
+  iree_hal_element_type_t element_type;
+  iree_hal_encoding_type_t encoding_type;
+} iree_numpy_npy_array_info_t;
+
+// Parses the npy |header| dict string into |out_info|.
+static iree_status_t iree_numpy_npy_parse_header(
+    iree_string_view_t header, iree_numpy_npy_array_info_t* out_info) {
+  // Parse the header.
+  // It look something like this:
+  //   {'descr': '|i1', 'fortran_order': False, 'shape': (2, 2, 1), }
+  // The spec says that although the keys should be sorted alphabetically that's
+  // not a requirement (yuck) and we have to handle out-of-order keys. There may
+  // also be keys we don't understand such as when what's saved is a pickled
+  // object. We implement a basic scanning parser here and try to deal with it.
+  out_info->shape_rank = 0;
+  out_info->element_type = IREE_HAL_ELEMENT_TYPE_NONE;
+  out_info->encoding_type = IREE_HAL_ENCODING_TYPE_OPAQUE;
+  iree_string_view_consume_prefix(&header, IREE_SV("{"));
+  iree_string_view_consume_suffix(&header, IREE_SV("}"));
+  while (!iree_string_view_is_empty(header)) {
+    // header => 'key': value{, header}
+    iree_string_view_t key, value;
+    IREE_RETURN_IF_ERROR(
+        iree_numpy_consume_dict_key_value(&header, &key, &value));
+    if (iree_string_view_equal(key, IREE_SV("descr"))) {
+      IREE_RETURN_IF_ERROR(
+          iree_numpy_descr_to_element_type(value, &out_info->element_type));
+    } else if (iree_string_view_equal(key, IREE_SV("fortran_order"))) {
+      if (!iree_string_view_equal(value, IREE_SV("False"))) {
+        return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                                "fortran order arrays not supported");
+      }
+      out_info->encoding_type = IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR;
+    } else if (iree_string_view_equal(key, IREE_SV("shape"))) {
+      iree_host_size_t shape_rank = iree_numpy_parse_shape_rank(value);
+      if (shape_rank > IREE_NUMPY_NPY_MAX_SHAPE_RANK) {
+        return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                                "shape rank %" PRIhsz
+                                " too large; be reasonable please",
+                                shape_rank);
+      }
+      out_info->shape_rank = shape_rank;
+      IREE_RETURN_IF_ERROR(
+          iree_numpy_parse_shape_dims(value, shape_rank, out_info->shape));
+    }
+  }
+  return iree_ok_status();
+}
+
 IREE_API_EXPORT iree_status_t
 iree_numpy_npy_load_ndarray(FILE* stream, iree_numpy_npy_load_options_t options,
                             iree_hal_buffer_params_t buffer_params,
@@ -327,48 +396,8 @@ iree_numpy_npy_load_ndarray(FILE* stream, iree_numpy_npy_load_options_t options,
   iree_string_view_t header = iree_string_view_trim(
       iree_make_string_view(header_buffer, header_length));
 
-  // Parse the header.
-  // It look something like this:
-  //   {'descr': '|i1', 'fortran_order': False, 'shape': (2, 2, 1), }
-  // The spec says that although the keys should be sorted alphabetically that's
-  // not a requirement (yuck) and we have to handle out-of-order keys. There may
-  // also be keys we don't understand such as when what's saved is a pickled
-  // object. We implement a basic scanning parser here and try to deal with it.
-  iree_status_t status = iree_ok_status();
-  iree_host_size_t shape_rank = 0;
-  iree_hal_dim_t* shape = NULL;
-  iree_hal_element_type_t element_type = IREE_HAL_ELEMENT_TYPE_NONE;
-  iree_hal_encoding_type_t encoding_type = IREE_HAL_ENCODING_TYPE_OPAQUE;
-  iree_string_view_consume_prefix(&header, IREE_SV("{"));
-  iree_string_view_consume_suffix(&header, IREE_SV("}"));
-  while (!iree_string_view_is_empty(header)) {
-    // header => 'key': value{, header}
-    iree_string_view_t key, value;
-    status = iree_numpy_consume_dict_key_value(&header, &key, &value);
-    if (!iree_status_is_ok(status)) break;
-
-    if (iree_string_view_equal(key, IREE_SV("descr"))) {
-      status = iree_numpy_descr_to_element_type(value, &element_type);
-    } else if (iree_string_view_equal(key, IREE_SV("fortran_order"))) {
-      if (iree_string_view_equal(value, IREE_SV("False"))) {
-        encoding_type = IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR;
-      } else {
-        status = iree_make_status(IREE_STATUS_UNIMPLEMENTED,
-                                  "fortran order arrays not supported");
-      }
-    } else if (iree_string_view_equal(key, IREE_SV("shape"))) {
-      shape_rank = iree_numpy_parse_shape_rank(value);
-      if (shape_rank > 128) {
-        status = iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
-                                  "shape rank %" PRIhsz
-                                  " too large; be reasonable please");
-      } else {
-        shape = iree_alloca(shape_rank * sizeof(*shape));
-        status = iree_numpy_parse_shape_dims(value, shape_rank, shape);
-      }
-    }
-    if (!iree_status_is_ok(status)) break;
-  }
+  iree_numpy_npy_array_info_t info;
+  iree_status_t status = iree_numpy_npy_parse_header(header, &info);
 
   // Allocate the buffer view and directly read into the allocated memory.
   // On targets where we can perform host mapping this will be zero-copy; on
@@ -379,9 +408,9 @@ iree_numpy_npy_load_ndarray(FILE* stream, iree_numpy_npy_load_options_t options,
     };
     buffer_params.access |= IREE_HAL_MEMORY_ACCESS_DISCARD_WRITE;
     status = iree_hal_buffer_view_generate_buffer(
-        device_allocator, shape_rank, shape, element_type, encoding_type,
-        buffer_params, iree_numpy_npy_read_into_mapping, &read_params,
-        out_buffer_view);
+        device_allocator, info.shape_rank, info.shape, info.element_type,
+        info.encoding_type, buffer_params, iree_numpy_npy_read_into_mapping,
+        &read_params, out_buffer_view);
   }
 
   iree_allocator_free(host_allocator, header_buffer);
@@ -389,6 +418,117 @@ iree_numpy_npy_load_ndarray(FILE* stream, iree_numpy_npy_load_options_t options,
   return status;
 }
 
+// Reads a little-endian value from unaligned |bytes|.
+static uint64_t iree_numpy_load_le(const uint8_t* bytes,
+                                   iree_host_size_t byte_count) {
+  uint64_t value = 0;
+  for (iree_host_size_t i = 0; i < byte_count; ++i) {
+    value |= (uint64_t)bytes[i] << (i * 8);
+  }
+  return value;
+}
+
+typedef struct {
+  const uint8_t* source;
+} iree_numpy_npy_copy_params_t;
+static iree_status_t iree_numpy_npy_copy_into_mapping(
+    iree_hal_buffer_mapping_t* mapping, void* user_data) {
+  iree_numpy_npy_copy_params_t* params =
+      (iree_numpy_npy_copy_params_t*)user_data;
+  memcpy(mapping->contents.data, params->source,
+         mapping->contents.data_length);
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_numpy_npy_load_ndarray_from_memory(
+    iree_const_byte_span_t contents, iree_hal_buffer_t* contents_buffer,
+    iree_device_size_t contents_buffer_offset,
+    iree_hal_buffer_params_t buffer_params,
+    iree_hal_allocator_t* device_allocator,
+    iree_hal_buffer_view_t** out_buffer_view, iree_host_size_t* out_length) {
+  IREE_ASSERT_ARGUMENT(device_allocator);
+  IREE_ASSERT_ARGUMENT(out_buffer_view);
+  *out_buffer_view = NULL;
+  if (out_length) *out_length = 0;
+
+  // Verify the fixed prefix and read the 2- or 4-byte header length.
+  iree_numpy_npy_prefix_t prefix;
+  if (contents.data_length < sizeof(prefix)) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "npy contents truncated reading header prefix");
+  }
+  memcpy(&prefix, contents.data, sizeof(prefix));
+  iree_host_size_t length_size = 0;
+  IREE_RETURN_IF_ERROR(iree_numpy_npy_verify_prefix(&prefix, &length_size));
+  iree_host_size_t header_offset = sizeof(prefix) + length_size;
+  if (contents.data_length < header_offset) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "npy contents truncated reading header length");
+  }
+  iree_host_size_t header_length = (iree_host_size_t)iree_numpy_load_le(
+      contents.data + sizeof(prefix), length_size);
+  if (contents.data_length - header_offset < header_length) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "npy contents truncated reading header string of "
+                            "%" PRIhsz " bytes",
+                            header_length);
+  }
+
+  // Parse the header directly from memory.
+  iree_numpy_npy_array_info_t info;
+  IREE_RETURN_IF_ERROR(iree_numpy_npy_parse_header(
+      iree_string_view_trim(iree_make_string_view(
+          (const char*)contents.data + header_offset, header_length)),
+      &info));
+  iree_device_size_t payload_length = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_compute_view_size(
+      info.shape_rank, info.shape, info.element_type, info.encoding_type,
+      &payload_length));
+  iree_host_size_t payload_offset = header_offset + header_length;
+  if (contents.data_length - payload_offset < payload_length) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "npy contents truncated; expected %" PRIdsz
+                            " bytes of array data",
+                            payload_length);
+  }
+
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_status_t status = iree_ok_status();
+  iree_device_size_t buffer_offset = contents_buffer_offset + payload_offset;
+  if (contents_buffer && iree_device_size_has_alignment(
+                             buffer_offset, IREE_HAL_HEAP_BUFFER_ALIGNMENT)) {
+    // Zero-copy: reference the array data in the buffer wrapping |contents|.
+    // numpy pads headers such that data in .npy files is always suitably
+    // aligned but arrays within .npz archives may not be.
+    iree_hal_buffer_t* buffer = NULL;
+    status = iree_hal_buffer_subspan(contents_buffer, buffer_offset,
+                                     payload_length, &buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_buffer_view_create(
+          buffer, info.shape_rank, info.shape, info.element_type,
+          info.encoding_type,
+          iree_hal_allocator_host_allocator(device_allocator),
+          out_buffer_view);
+    }
+    iree_hal_buffer_release(buffer);
+  } else {
+    iree_numpy_npy_copy_params_t copy_params = {
+        .source = contents.data + payload_offset,
+    };
+    buffer_params.access |= IREE_HAL_MEMORY_ACCESS_DISCARD_WRITE;
+    status = iree_hal_buffer_view_generate_buffer(
+        device_allocator, info.shape_rank, info.shape, info.element_type,
+        info.encoding_type, buffer_params, iree_numpy_npy_copy_into_mapping,
+        &copy_params, out_buffer_view);
+  }
+
+  if (iree_status_is_ok(status) && out_length) {
+    *out_length = payload_offset + (iree_host_size_t)payload_length;
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 // Builds a dtype string from |buffer_view|.
 static iree_status_t iree_numpy_npy_build_dtype(
     iree_hal_buffer_view_t* buffer_view, iree_string_builder_t* builder) {
@@ -625,3 +765,118 @@ IREE_API_EXPORT iree_status_t iree_numpy_npy_save_ndarray(
   IREE_TRACE_ZONE_END(z0);
   return status;
 }
+
+//===----------------------------------------------------------------------===//
+// .npz (zip archive of .npy files)
+//===----------------------------------------------------------------------===//
+
+// File format spec (local file headers, section 4.3.7):
+// https://pkware.cachefly.net/webdocs/casestudies/APPNOTE.TXT
+//
+// Each archive member is a 30 byte local file header followed by the file
+// name, an extra field, and the member contents. All values are little-endian.
+// numpy.savez writes members in argument order (`arr_0.npy`, `arr_1.npy`, ...)
+// without compression and with the sizes in the local header; zip64 sizes are
+// stored in the extra field when the 32-bit sizes are 0xFFFFFFFF.
+
+#define IREE_NUMPY_ZIP_LOCAL_HEADER_SIGNATURE 0x04034B50u
+#define IREE_NUMPY_ZIP_LOCAL_HEADER_SIZE 30
+#define IREE_NUMPY_ZIP_ZIP64_EXTRA_ID 0x0001u
+
+// Reads the zip64 sizes from the extra |field| when the 32-bit sizes are
+// saturated. Sizes not stored in the extra field are left unchanged.
+static iree_status_t iree_numpy_npz_read_zip64_sizes(
+    iree_const_byte_span_t field, uint64_t* inout_uncompressed_size,
+    uint64_t* inout_compressed_size) {
+  iree_host_size_t offset = 0;
+  while (field.data_length - offset >= 4) {
+    uint64_t id = iree_numpy_load_le(field.data + offset, 2);
+    iree_host_size_t size =
+        (iree_host_size_t)iree_numpy_load_le(field.data + offset + 2, 2);
+    offset += 4;
+    if (field.data_length - offset < size) break;
+    if (id == IREE_NUMPY_ZIP_ZIP64_EXTRA_ID) {
+      iree_host_size_t value_offset = 0;
+      if (*inout_uncompressed_size == UINT32_MAX && size - value_offset >= 8) {
+        *inout_uncompressed_size =
+            iree_numpy_load_le(field.data + offset + value_offset, 8);
+        value_offset += 8;
+      }
+      if (*inout_compressed_size == UINT32_MAX && size - value_offset >= 8) {
+        *inout_compressed_size =
+            iree_numpy_load_le(field.data + offset + value_offset, 8);
+      }
+      return iree_ok_status();
+    }
+    offset += size;
+  }
+  return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                          "npz member missing zip64 extended sizes");
+}
+
+IREE_API_EXPORT iree_status_t iree_numpy_npz_next_entry(
+    iree_const_byte_span_t archive, iree_host_size_t* inout_offset,
+    iree_string_view_t* out_name, iree_const_byte_span_t* out_contents) {
+  IREE_ASSERT_ARGUMENT(inout_offset);
+  IREE_ASSERT_ARGUMENT(out_name);
+  IREE_ASSERT_ARGUMENT(out_contents);
+  *out_name = iree_string_view_empty();
+  *out_contents = iree_const_byte_span_empty();
+
+  // Anything other than a local file header (such as the central directory
+  // that follows the last member) ends the members.
+  iree_host_size_t offset = *inout_offset;
+  if (offset > archive.data_length ||
+      archive.data_length - offset < IREE_NUMPY_ZIP_LOCAL_HEADER_SIZE) {
+    return iree_ok_status();
+  }
+  const uint8_t* header = archive.data + offset;
+  if (iree_numpy_load_le(header, 4) != IREE_NUMPY_ZIP_LOCAL_HEADER_SIGNATURE) {
+    return iree_ok_status();
+  }
+
+  uint64_t flags = iree_numpy_load_le(header + 6, 2);
+  uint64_t compression = iree_numpy_load_le(header + 8, 2);
+  uint64_t compressed_size = iree_numpy_load_le(header + 18, 4);
+  uint64_t uncompressed_size = iree_numpy_load_le(header + 22, 4);
+  iree_host_size_t name_length =
+      (iree_host_size_t)iree_numpy_load_le(header + 26, 2);
+  iree_host_size_t extra_length =
+      (iree_host_size_t)iree_numpy_load_le(header + 28, 2);
+  offset += IREE_NUMPY_ZIP_LOCAL_HEADER_SIZE;
+  if (archive.data_length - offset < name_length + extra_length) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "npz member header truncated");
+  }
+  iree_string_view_t name =
+      iree_make_string_view((const char*)archive.data + offset, name_length);
+  offset += name_length;
+  if (compressed_size == UINT32_MAX || uncompressed_size == UINT32_MAX) {
+    IREE_RETURN_IF_ERROR(iree_numpy_npz_read_zip64_sizes(
+        iree_make_const_byte_span(archive.data + offset, extra_length),
+        &uncompressed_size, &compressed_size));
+  }
+  offset += extra_length;
+
+  if (compression != 0) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "npz member '%.*s' is compressed; only archives "
+                            "written with numpy.savez are supported",
+                            (int)name.size, name.data);
+  } else if ((flags & (1u << 3)) && compressed_size == 0) {
+    return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                            "npz member '%.*s' uses a trailing data descriptor",
+                            (int)name.size, name.data);
+  } else if (compressed_size != uncompressed_size ||
+             archive.data_length - offset < compressed_size) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "npz member '%.*s' contents truncated",
+                            (int)name.size, name.data);
+  }
+
+  *out_name = name;
+  *out_contents = iree_make_const_byte_span(archive.data + offset,
+                                            (iree_host_size_t)compressed_size);
+  *inout_offset = offset + (iree_host_size_t)compressed_size;
+  return iree_ok_status();
+}
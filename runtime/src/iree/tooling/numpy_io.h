@@ -16,10 +16,10 @@
 // Pickled objects are not supported (similar to using `allow_pickle=False`) and
 // not all dtypes are supported.
 //
-// .npy and uncompressed .npz files can be mapped into host memory with
-// IREE_NUMPY_NPY_LOAD_OPTION_MAP_FILE if the HAL device allocator
-// supports using such memory. On devices with discrete memory the contents will
-// be loaded into host memory and copied to the device.
+// .npy and uncompressed .npz files can be mapped into host memory and loaded
+// with iree_numpy_npy_load_ndarray_from_memory. If the mapping has been
+// imported into a HAL buffer the arrays reference it directly without copies.
+// On devices with discrete memory the contents will be copied to the device.
 //
 // This current implementation is very basic; in the future it'd be nice to
 // support an iree_io_stream_t to allow for externalizing the file access.
@@ -89,6 +89,23 @@ iree_numpy_npy_load_ndarray(FILE* stream, iree_numpy_npy_load_options_t options,
                             iree_hal_allocator_t* device_allocator,
                             iree_hal_buffer_view_t** out_buffer_view);
 
+// Loads a single value from .npy-formatted |contents| into a buffer view.
+// |out_length| (optional) receives the total size of the ndarray in |contents|
+// including its header such that concatenated values can be iterated.
+//
+// If |contents_buffer| is provided it must be a buffer whose contents at
+// |contents_buffer_offset| are |contents|, such as a mapped file imported with
+// iree_hal_allocator_import_buffer. Values whose data is suitably aligned
+// will then reference subspans of |contents_buffer| and retain it instead of
+// being copied. Otherwise the value contents are copied into a new buffer
+// allocated from |device_allocator| with |buffer_params|.
+IREE_API_EXPORT iree_status_t iree_numpy_npy_load_ndarray_from_memory(
+    iree_const_byte_span_t contents, iree_hal_buffer_t* contents_buffer,
+    iree_device_size_t contents_buffer_offset,
+    iree_hal_buffer_params_t buffer_params,
+    iree_hal_allocator_t* device_allocator,
+    iree_hal_buffer_view_t** out_buffer_view, iree_host_size_t* out_length);
+
 // Saves |buffer_view| to a .npy |stream|.
 // The ndarray will be appended to the stream to produce a concatenated file.
 //
@@ -98,6 +115,23 @@ IREE_API_EXPORT iree_status_t iree_numpy_npy_save_ndarray(
     FILE* stream, iree_numpy_npy_save_options_t options,
     iree_hal_buffer_view_t* buffer_view, iree_allocator_t host_allocator);
 
+//===----------------------------------------------------------------------===//
+// .npz (zip archive of .npy files)
+//===----------------------------------------------------------------------===//
+
+// Returns the archive member at |inout_offset| in the .npz |archive| and
+// advances |inout_offset| to the next member. The first member is at offset 0.
+// |out_name| is the member file name (such as `arr_0.npy`) and |out_contents|
+// its .npy contents referencing |archive|. Both are empty when there are no
+// more members.
+//
+// Only uncompressed archives (`numpy.savez`) are supported as members are
+// returned in-place; `numpy.savez_compressed` members fail with
+// IREE_STATUS_UNIMPLEMENTED.
+IREE_API_EXPORT iree_status_t iree_numpy_npz_next_entry(
+    iree_const_byte_span_t archive, iree_host_size_t* inout_offset,
+    iree_string_view_t* out_name, iree_const_byte_span_t* out_contents);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -66,6 +66,15 @@ class NumpyIOTest : public ::testing::Test {
     return NULL;
   }
 
+  iree_const_byte_span_t GetInputFileContents(const char* name) {
+    const struct iree_file_toc_t* file_toc = iree_numpy_npy_files_create();
+    for (size_t i = 0; i < iree_numpy_npy_files_size(); ++i) {
+      if (strcmp(file_toc[i].name, name) != 0) continue;
+      return iree_make_const_byte_span(file_toc[i].data, file_toc[i].size);
+    }
+    return iree_const_byte_span_empty();
+  }
+
   FILE* OpenOutputFile(const char* name) {
     auto file_path = GetTempFilename(name);
     return fopen(file_path.c_str(), "w+b");
@@ -128,6 +137,27 @@ static void LoadArrayAndAssertContents(FILE* stream,
   iree_hal_buffer_view_release(buffer_view);
 }
 
+// Loads the ndarray at the start of |contents| and returns its total length.
+template <typename T>
+static iree_host_size_t LoadArrayFromMemoryAndAssertContents(
+    iree_const_byte_span_t contents, iree_hal_allocator_t* device_allocator,
+    std::vector<iree_hal_dim_t> shape, iree_hal_element_type_t element_type,
+    iree_hal_encoding_type_t encoding_type, std::vector<T> expected_contents) {
+  iree_hal_buffer_params_t buffer_params = {};
+  buffer_params.usage = IREE_HAL_BUFFER_USAGE_TRANSFER;
+  buffer_params.access = IREE_HAL_MEMORY_ACCESS_READ;
+  buffer_params.type = IREE_HAL_MEMORY_TYPE_HOST_LOCAL;
+  iree_hal_buffer_view_t* buffer_view = NULL;
+  iree_host_size_t length = 0;
+  IREE_CHECK_OK(iree_numpy_npy_load_ndarray_from_memory(
+      contents, /*contents_buffer=*/NULL, /*contents_buffer_offset=*/0,
+      buffer_params, device_allocator, &buffer_view, &length));
+  AssertBufferViewContents<T>(buffer_view, shape, element_type, encoding_type,
+                              expected_contents);
+  iree_hal_buffer_view_release(buffer_view);
+  return length;
+}
+
 // Tests that an empty file returns EOF.
 TEST_F(NumpyIOTest, LoadEmptyFile) {
   FILE* stream = OpenInputFile("empty.npy");
@@ -189,6 +219,129 @@ TEST_F(NumpyIOTest, LoadMultipleArrays) {
   fclose(stream);
 }
 
+// Tests loading multiple arrays from a concatenated file in memory.
+TEST_F(NumpyIOTest, LoadMultipleArraysFromMemory) {
+  iree_const_byte_span_t contents = GetInputFileContents("multiple.npy");
+  iree_host_size_t offset = 0;
+  auto remaining = [&]() {
+    return iree_make_const_byte_span(contents.data + offset,
+                                     contents.data_length - offset);
+  };
+
+  // np.array([1.1, 2.2, 3.3], dtype=np.float32)
+  offset += LoadArrayFromMemoryAndAssertContents<float>(
+      remaining(), device_allocator_, {3}, IREE_HAL_ELEMENT_TYPE_FLOAT_32,
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, {1.1f, 2.2f, 3.3f});
+
+  // np.array([[0, 1], [2, 3]], dtype=np.int32)
+  offset += LoadArrayFromMemoryAndAssertContents<int32_t>(
+      remaining(), device_allocator_, {2, 2}, IREE_HAL_ELEMENT_TYPE_SINT_32,
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, {0, 1, 2, 3});
+
+  // np.array(42, dtype=np.int32)
+  offset += LoadArrayFromMemoryAndAssertContents<int32_t>(
+      remaining(), device_allocator_, {}, IREE_HAL_ELEMENT_TYPE_SINT_32,
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, {42});
+
+  // Should have consumed the entire file.
+  ASSERT_EQ(offset, contents.data_length);
+}
+
+// Tests that arrays loaded from memory backed by a buffer reference it.
+TEST_F(NumpyIOTest, LoadArrayFromBufferIsZeroCopy) {
+  iree_const_byte_span_t file_contents = GetInputFileContents("single.npy");
+  iree_hal_buffer_params_t buffer_params = {};
+  buffer_params.usage =
+      IREE_HAL_BUFFER_USAGE_TRANSFER | IREE_HAL_BUFFER_USAGE_MAPPING;
+  buffer_params.access = IREE_HAL_MEMORY_ACCESS_ALL;
+  buffer_params.type = IREE_HAL_MEMORY_TYPE_HOST_LOCAL;
+  iree_hal_buffer_t* file_buffer = NULL;
+  IREE_ASSERT_OK(iree_hal_allocator_allocate_buffer(
+      device_allocator_, buffer_params, file_contents.data_length,
+      file_contents, &file_buffer));
+  iree_hal_buffer_mapping_t mapping;
+  IREE_ASSERT_OK(iree_hal_buffer_map_range(
+      file_buffer, IREE_HAL_MAPPING_MODE_SCOPED, IREE_HAL_MEMORY_ACCESS_READ,
+      0, IREE_WHOLE_BUFFER, &mapping));
+
+  buffer_params.access = IREE_HAL_MEMORY_ACCESS_READ;
+  iree_hal_buffer_view_t* buffer_view = NULL;
+  IREE_ASSERT_OK(iree_numpy_npy_load_ndarray_from_memory(
+      iree_make_const_byte_span(mapping.contents.data,
+                                mapping.contents.data_length),
+      file_buffer, /*contents_buffer_offset=*/0, buffer_params,
+      device_allocator_, &buffer_view, /*out_length=*/NULL));
+  IREE_ASSERT_OK(iree_hal_buffer_unmap_range(&mapping));
+
+  // npy pads the header such that the data is aligned and can be referenced.
+  EXPECT_EQ(iree_hal_buffer_allocated_buffer(
+                iree_hal_buffer_view_buffer(buffer_view)),
+            file_buffer);
+  AssertBufferViewContents<float>(buffer_view, {3},
+                                  IREE_HAL_ELEMENT_TYPE_FLOAT_32,
+                                  IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR,
+                                  {1.1f, 2.2f, 3.3f});
+  iree_hal_buffer_view_release(buffer_view);
+  iree_hal_buffer_release(file_buffer);
+}
+
+// Appends a little-endian |value| of |byte_count| bytes to |bytes|.
+static void AppendLE(std::vector<uint8_t>& bytes, uint64_t value,
+                     size_t byte_count) {
+  for (size_t i = 0; i < byte_count; ++i) {
+    bytes.push_back(static_cast<uint8_t>(value >> (i * 8)));
+  }
+}
+
+// Tests iterating the members of an uncompressed npz archive.
+TEST_F(NumpyIOTest, LoadArraysFromNpz) {
+  // Append each npy file as an uncompressed zip member as numpy.savez does.
+  // The CRC is not verified when loading and is left as 0.
+  std::vector<uint8_t> archive;
+  const char* member_files[] = {"single.npy", "multiple.npy"};
+  for (size_t i = 0; i < IREE_ARRAYSIZE(member_files); ++i) {
+    iree_const_byte_span_t contents = GetInputFileContents(member_files[i]);
+    std::string name = "arr_" + std::to_string(i) + ".npy";
+    AppendLE(archive, 0x04034B50u, 4);  // signature
+    AppendLE(archive, 20, 2);           // version needed to extract
+    AppendLE(archive, 0, 2);            // flags
+    AppendLE(archive, 0, 2);            // compression (stored)
+    AppendLE(archive, 0, 4);            // modification time and date
+    AppendLE(archive, 0, 4);            // crc-32
+    AppendLE(archive, contents.data_length, 4);  // compressed size
+    AppendLE(archive, contents.data_length, 4);  // uncompressed size
+    AppendLE(archive, name.size(), 2);           // file name length
+    AppendLE(archive, 0, 2);                     // extra field length
+    archive.insert(archive.end(), name.begin(), name.end());
+    archive.insert(archive.end(), contents.data,
+                   contents.data + contents.data_length);
+  }
+  AppendLE(archive, 0x02014B50u, 4);  // central directory signature
+
+  iree_const_byte_span_t archive_span =
+      iree_make_const_byte_span(archive.data(), archive.size());
+  iree_host_size_t offset = 0;
+  iree_string_view_t name = iree_string_view_empty();
+  iree_const_byte_span_t contents = iree_const_byte_span_empty();
+
+  IREE_ASSERT_OK(
+      iree_numpy_npz_next_entry(archive_span, &offset, &name, &contents));
+  EXPECT_TRUE(iree_string_view_equal(name, IREE_SV("arr_0.npy")));
+  LoadArrayFromMemoryAndAssertContents<float>(
+      contents, device_allocator_, {3}, IREE_HAL_ELEMENT_TYPE_FLOAT_32,
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR, {1.1f, 2.2f, 3.3f});
+
+  IREE_ASSERT_OK(
+      iree_numpy_npz_next_entry(archive_span, &offset, &name, &contents));
+  EXPECT_TRUE(iree_string_view_equal(name, IREE_SV("arr_1.npy")));
+  EXPECT_EQ(contents.data_length,
+            GetInputFileContents("multiple.npy").data_length);
+
+  IREE_ASSERT_OK(
+      iree_numpy_npz_next_entry(archive_span, &offset, &name, &contents));
+  EXPECT_EQ(contents.data, nullptr);
+}
+
 // Tests loading arrays with various shapes.
 TEST_F(NumpyIOTest, ArrayShapes) {
   FILE* stream = OpenInputFile("array_shapes.npy");
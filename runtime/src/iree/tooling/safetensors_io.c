@@ -0,0 +1,352 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/tooling/safetensors_io.h"
+
+#include <string.h>
+
+#include "iree/base/tracing.h"
+
+// File format:
+//   8b: little-endian uint64 header size N
+//   Nb: UTF-8 JSON object, possibly padded with trailing spaces:
+//       {
+//         "__metadata__": {"key": "value", ...},
+//         "name": {"dtype": "F32", "shape": [2, 3], "data_offsets": [0, 24]},
+//         ...
+//       }
+//   remainder: tensor data; data_offsets are [begin, end) relative to the
+//   start of the remainder.
+//
+// We only need a small subset of JSON to parse the header and implement a
+// basic scanner here. String escapes are not decoded and names containing them
+// are returned as they appear in the file.
+
+// Maximum supported tensor rank.
+#define IREE_SAFETENSORS_MAX_SHAPE_RANK 128
+
+// Tensor metadata parsed from the header.
+typedef struct iree_safetensors_tensor_info_t {
+  iree_string_view_t name;
+  iree_hal_element_type_t element_type;
+  iree_host_size_t shape_rank;
+  iree_hal_dim_t shape[IREE_SAFETENSORS_MAX_SHAPE_RANK];
+  uint64_t data_begin;
+  uint64_t data_end;
+} iree_safetensors_tensor_info_t;
+
+static void iree_safetensors_skip_whitespace(iree_string_view_t* json) {
+  iree_host_size_t i = 0;
+  while (i < json->size &&
+         (json->data[i] == ' ' || json->data[i] == '\t' ||
+          json->data[i] == '\n' || json->data[i] == '\r')) {
+    ++i;
+  }
+  *json = iree_string_view_remove_prefix(*json, i);
+}
+
+// Consumes |c| (after any leading whitespace) from |json|.
+static bool iree_safetensors_consume_char(iree_string_view_t* json, char c) {
+  iree_safetensors_skip_whitespace(json);
+  if (json->size == 0 || json->data[0] != c) return false;
+  *json = iree_string_view_remove_prefix(*json, 1);
+  return true;
+}
+
+static iree_status_t iree_safetensors_expect_char(iree_string_view_t* json,
+                                                  char c) {
+  if (!iree_safetensors_consume_char(json, c)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "malformed safetensors header; expected '%c'", c);
+  }
+  return iree_ok_status();
+}
+
+// Parses a JSON string and returns its (still escaped) contents.
+static iree_status_t iree_safetensors_parse_string(
+    iree_string_view_t* json, iree_string_view_t* out_value) {
+  IREE_RETURN_IF_ERROR(iree_safetensors_expect_char(json, '"'));
+  for (iree_host_size_t i = 0; i < json->size; ++i) {
+    if (json->data[i] == '\\') {
+      ++i;  // skip the escaped character
+    } else if (json->data[i] == '"') {
+      *out_value = iree_make_string_view(json->data, i);
+      *json = iree_string_view_remove_prefix(*json, i + 1);
+      return iree_ok_status();
+    }
+  }
+  return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                          "malformed safetensors header; unterminated string");
+}
+
+// Parses a JSON array of non-negative integers into |out_values|.
+static iree_status_t iree_safetensors_parse_uint_array(
+    iree_string_view_t* json, iree_host_size_t capacity, uint64_t* out_values,
+    iree_host_size_t* out_count) {
+  *out_count = 0;
+  IREE_RETURN_IF_ERROR(iree_safetensors_expect_char(json, '['));
+  if (iree_safetensors_consume_char(json, ']')) return iree_ok_status();
+  do {
+    iree_safetensors_skip_whitespace(json);
+    iree_host_size_t length = 0;
+    while (length < json->size && json->data[length] >= '0' &&
+           json->data[length] <= '9') {
+      ++length;
+    }
+    if (*out_count >= capacity) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "safetensors array exceeds %" PRIhsz " elements",
+                              capacity);
+    }
+    if (!iree_string_view_atoi_uint64(iree_make_string_view(json->data, length),
+                                      &out_values[*out_count])) {
+      return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                              "malformed safetensors header; expected integer");
+    }
+    ++*out_count;
+    *json = iree_string_view_remove_prefix(*json, length);
+  } while (iree_safetensors_consume_char(json, ','));
+  return iree_safetensors_expect_char(json, ']');
+}
+
+// Skips over an arbitrary JSON value.
+static iree_status_t iree_safetensors_skip_value(iree_string_view_t* json) {
+  iree_safetensors_skip_whitespace(json);
+  iree_host_size_t depth = 0;
+  while (json->size > 0) {
+    char c = json->data[0];
+    if (c == '"') {
+      iree_string_view_t value;
+      IREE_RETURN_IF_ERROR(iree_safetensors_parse_string(json, &value));
+      continue;
+    }
+    if (depth == 0 && (c == ',' || c == '}' || c == ']')) {
+      return iree_ok_status();  // end of the value in the enclosing container
+    } else if (c == '{' || c == '[') {
+      ++depth;
+    } else if (c == '}' || c == ']') {
+      --depth;
+    }
+    *json = iree_string_view_remove_prefix(*json, 1);
+  }
+  return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                          "malformed safetensors header; truncated value");
+}
+
+// Maps a safetensors |dtype| to a HAL element type.
+static iree_status_t iree_safetensors_dtype_to_element_type(
+    iree_string_view_t dtype, iree_hal_element_type_t* out_element_type) {
+  static const struct {
+    const char* dtype;
+    iree_hal_element_type_t element_type;
+  } kTypes[] = {
+      {"BOOL", IREE_HAL_ELEMENT_TYPE_BOOL_8},
+      {"U8", IREE_HAL_ELEMENT_TYPE_UINT_8},
+      {"I8", IREE_HAL_ELEMENT_TYPE_SINT_8},
+      {"U16", IREE_HAL_ELEMENT_TYPE_UINT_16},
+      {"I16", IREE_HAL_ELEMENT_TYPE_SINT_16},
+      {"U32", IREE_HAL_ELEMENT_TYPE_UINT_32},
+      {"I32", IREE_HAL_ELEMENT_TYPE_SINT_32},
+      {"U64", IREE_HAL_ELEMENT_TYPE_UINT_64},
+      {"I64", IREE_HAL_ELEMENT_TYPE_SINT_64},
+      {"F16", IREE_HAL_ELEMENT_TYPE_FLOAT_16},
+      {"BF16", IREE_HAL_ELEMENT_TYPE_BFLOAT_16},
+      {"F32", IREE_HAL_ELEMENT_TYPE_FLOAT_32},
+      {"F64", IREE_HAL_ELEMENT_TYPE_FLOAT_64},
+  };
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(kTypes); ++i) {
+    if (iree_string_view_equal(dtype,
+                               iree_make_cstring_view(kTypes[i].dtype))) {
+      *out_element_type = kTypes[i].element_type;
+      return iree_ok_status();
+    }
+  }
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "unsupported safetensors dtype '%.*s'",
+                          (int)dtype.size, dtype.data);
+}
+
+// Parses a tensor info object like
+// `{"dtype": "F32", "shape": [2, 3], "data_offsets": [0, 24]}`.
+static iree_status_t iree_safetensors_parse_tensor_info(
+    iree_string_view_t* json, iree_safetensors_tensor_info_t* out_info) {
+  out_info->element_type = IREE_HAL_ELEMENT_TYPE_NONE;
+  out_info->shape_rank = 0;
+  out_info->data_begin = out_info->data_end = 0;
+  bool has_offsets = false;
+  IREE_RETURN_IF_ERROR(iree_safetensors_expect_char(json, '{'));
+  if (iree_safetensors_consume_char(json, '}')) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "empty safetensors tensor info");
+  }
+  do {
+    iree_string_view_t key;
+    IREE_RETURN_IF_ERROR(iree_safetensors_parse_string(json, &key));
+    IREE_RETURN_IF_ERROR(iree_safetensors_expect_char(json, ':'));
+    if (iree_string_view_equal(key, IREE_SV("dtype"))) {
+      iree_string_view_t dtype;
+      IREE_RETURN_IF_ERROR(iree_safetensors_parse_string(json, &dtype));
+      IREE_RETURN_IF_ERROR(iree_safetensors_dtype_to_element_type(
+          dtype, &out_info->element_type));
+    } else if (iree_string_view_equal(key, IREE_SV("shape"))) {
+      uint64_t dims[IREE_SAFETENSORS_MAX_SHAPE_RANK];
+      IREE_RETURN_IF_ERROR(iree_safetensors_parse_uint_array(
+          json, IREE_ARRAYSIZE(dims), dims, &out_info->shape_rank));
+      for (iree_host_size_t i = 0; i < out_info->shape_rank; ++i) {
+        out_info->shape[i] = (iree_hal_dim_t)dims[i];
+      }
+    } else if (iree_string_view_equal(key, IREE_SV("data_offsets"))) {
+      uint64_t offsets[2];
+      iree_host_size_t offset_count = 0;
+      IREE_RETURN_IF_ERROR(iree_safetensors_parse_uint_array(
+          json, IREE_ARRAYSIZE(offsets), offsets, &offset_count));
+      if (offset_count != 2 || offsets[0] > offsets[1]) {
+        return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                                "invalid safetensors data_offsets");
+      }
+      out_info->data_begin = offsets[0];
+      out_info->data_end = offsets[1];
+      has_offsets = true;
+    } else {
+      IREE_RETURN_IF_ERROR(iree_safetensors_skip_value(json));
+    }
+  } while (iree_safetensors_consume_char(json, ','));
+  IREE_RETURN_IF_ERROR(iree_safetensors_expect_char(json, '}'));
+  if (out_info->element_type == IREE_HAL_ELEMENT_TYPE_NONE || !has_offsets) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "safetensors tensor info missing dtype or "
+                            "data_offsets");
+  }
+  return iree_ok_status();
+}
+
+typedef struct {
+  const uint8_t* source;
+} iree_safetensors_copy_params_t;
+static iree_status_t iree_safetensors_copy_into_mapping(
+    iree_hal_buffer_mapping_t* mapping, void* user_data) {
+  iree_safetensors_copy_params_t* params =
+      (iree_safetensors_copy_params_t*)user_data;
+  memcpy(mapping->contents.data, params->source,
+         mapping->contents.data_length);
+  return iree_ok_status();
+}
+
+// Creates a buffer view for the tensor described by |info| with its data at
+// |data_offset| in |contents|.
+static iree_status_t iree_safetensors_create_buffer_view(
+    const iree_safetensors_tensor_info_t* info, iree_const_byte_span_t contents,
+    iree_host_size_t data_offset, iree_hal_buffer_t* contents_buffer,
+    iree_hal_buffer_params_t buffer_params,
+    iree_hal_allocator_t* device_allocator,
+    iree_hal_buffer_view_t** out_buffer_view) {
+  iree_hal_encoding_type_t encoding_type =
+      IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR;
+  iree_device_size_t byte_length = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_compute_view_size(
+      info->shape_rank, info->shape, info->element_type, encoding_type,
+      &byte_length));
+  if (info->data_end - info->data_begin != byte_length ||
+      info->data_end > contents.data_length - data_offset) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "safetensors tensor '%.*s' data_offsets do not "
+                            "match its shape or exceed the file size",
+                            (int)info->name.size, info->name.data);
+  }
+  iree_host_size_t byte_offset =
+      data_offset + (iree_host_size_t)info->data_begin;
+
+  if (contents_buffer &&
+      iree_device_size_has_alignment(byte_offset,
+                                     IREE_HAL_HEAP_BUFFER_ALIGNMENT)) {
+    // Zero-copy: reference the tensor data in the buffer wrapping |contents|.
+    iree_hal_buffer_t* buffer = NULL;
+    IREE_RETURN_IF_ERROR(iree_hal_buffer_subspan(contents_buffer, byte_offset,
+                                                 byte_length, &buffer));
+    iree_status_t status = iree_hal_buffer_view_create(
+        buffer, info->shape_rank, info->shape, info->element_type,
+        encoding_type, iree_hal_allocator_host_allocator(device_allocator),
+        out_buffer_view);
+    iree_hal_buffer_release(buffer);
+    return status;
+  }
+
+  iree_safetensors_copy_params_t copy_params = {
+      .source = contents.data + byte_offset,
+  };
+  buffer_params.access |= IREE_HAL_MEMORY_ACCESS_DISCARD_WRITE;
+  return iree_hal_buffer_view_generate_buffer(
+      device_allocator, info->shape_rank, info->shape, info->element_type,
+      encoding_type, buffer_params, iree_safetensors_copy_into_mapping,
+      &copy_params, out_buffer_view);
+}
+
+IREE_API_EXPORT iree_status_t iree_safetensors_load_tensors(
+    iree_const_byte_span_t contents, iree_hal_buffer_t* contents_buffer,
+    iree_hal_buffer_params_t buffer_params,
+    iree_hal_allocator_t* device_allocator, iree_safetensors_tensor_fn_t fn,
+    void* user_data) {
+  IREE_ASSERT_ARGUMENT(device_allocator);
+  IREE_ASSERT_ARGUMENT(fn);
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  uint64_t header_size = 0;
+  if (contents.data_length >= sizeof(header_size)) {
+    for (iree_host_size_t i = 0; i < sizeof(header_size); ++i) {
+      header_size |= (uint64_t)contents.data[i] << (i * 8);
+    }
+  }
+  if (contents.data_length < sizeof(header_size) ||
+      header_size > contents.data_length - sizeof(header_size)) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "safetensors header truncated");
+  }
+  iree_string_view_t json = iree_make_string_view(
+      (const char*)contents.data + sizeof(header_size),
+      (iree_host_size_t)header_size);
+  iree_host_size_t data_offset =
+      sizeof(header_size) + (iree_host_size_t)header_size;
+
+  iree_safetensors_tensor_info_t info;
+  iree_status_t status = iree_safetensors_expect_char(&json, '{');
+  if (iree_status_is_ok(status) && iree_safetensors_consume_char(&json, '}')) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_ok_status();  // no tensors
+  }
+  while (iree_status_is_ok(status)) {
+    iree_string_view_t name = iree_string_view_empty();
+    status = iree_safetensors_parse_string(&json, &name);
+    if (iree_status_is_ok(status)) {
+      status = iree_safetensors_expect_char(&json, ':');
+    }
+    if (!iree_status_is_ok(status)) break;
+    if (iree_string_view_equal(name, IREE_SV("__metadata__"))) {
+      status = iree_safetensors_skip_value(&json);
+    } else {
+      status = iree_safetensors_parse_tensor_info(&json, &info);
+      info.name = name;
+      iree_hal_buffer_view_t* buffer_view = NULL;
+      if (iree_status_is_ok(status)) {
+        status = iree_safetensors_create_buffer_view(
+            &info, contents, data_offset, contents_buffer, buffer_params,
+            device_allocator, &buffer_view);
+      }
+      if (iree_status_is_ok(status)) {
+        status = fn(user_data, name, buffer_view);
+      }
+      iree_hal_buffer_view_release(buffer_view);
+    }
+    if (!iree_status_is_ok(status)) break;
+    if (!iree_safetensors_consume_char(&json, ',')) {
+      status = iree_safetensors_expect_char(&json, '}');
+      break;
+    }
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -0,0 +1,55 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+//===----------------------------------------------------------------------===//
+// safetensors IO
+//===----------------------------------------------------------------------===//
+//
+// Loads tensors from the safetensors file format:
+// https://github.com/huggingface/safetensors
+//
+// A file is an 8-byte little-endian header size, a JSON header of that size
+// mapping tensor names to their dtype, shape, and data offsets, and then the
+// raw tensor data. Files are expected to be mapped into memory by the caller
+// so that loading does not require reading the data through a stream.
+
+#ifndef IREE_TOOLING_SAFETENSORS_IO_H_
+#define IREE_TOOLING_SAFETENSORS_IO_H_
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+// Callback receiving each tensor loaded by iree_safetensors_load_tensors.
+// |buffer_view| is only valid for the duration of the call and must be
+// retained if needed. Returning a failure stops loading.
+typedef iree_status_t(IREE_API_PTR* iree_safetensors_tensor_fn_t)(
+    void* user_data, iree_string_view_t name,
+    iree_hal_buffer_view_t* buffer_view);
+
+// Loads all tensors from safetensors-formatted |contents| and passes each to
+// |fn| in the order they are declared in the file header.
+//
+// If |contents_buffer| is provided it must be a buffer whose contents are
+// |contents|, such as a mapped file imported with
+// iree_hal_allocator_import_buffer. Tensors whose data is suitably aligned
+// will then reference subspans of |contents_buffer| and retain it instead of
+// being copied. Otherwise the tensor contents are copied into new buffers
+// allocated from |device_allocator| with |buffer_params|.
+IREE_API_EXPORT iree_status_t iree_safetensors_load_tensors(
+    iree_const_byte_span_t contents, iree_hal_buffer_t* contents_buffer,
+    iree_hal_buffer_params_t buffer_params,
+    iree_hal_allocator_t* device_allocator, iree_safetensors_tensor_fn_t fn,
+    void* user_data);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_TOOLING_SAFETENSORS_IO_H_
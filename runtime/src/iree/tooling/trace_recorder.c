@@ -0,0 +1,264 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "iree/tooling/trace_recorder.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "iree/base/internal/synchronization.h"
+#include "iree/base/tracing.h"
+#include "iree/modules/hal/module.h"
+#include "iree/tooling/yaml_util.h"
+
+struct iree_trace_recorder_t {
+  iree_allocator_t host_allocator;
+  iree_trace_recorder_flags_t flags;
+  FILE* file;
+  iree_hal_device_t* device;
+  // Time the recorder was created; call timestamps are relative to this.
+  iree_time_t start_time_ns;
+  // Serializes writes to |file| so that events are not interleaved.
+  iree_slim_mutex_t mutex;
+};
+
+iree_status_t iree_trace_recorder_create(FILE* file, iree_hal_device_t* device,
+                                         iree_trace_recorder_flags_t flags,
+                                         iree_allocator_t host_allocator,
+                                         iree_trace_recorder_t** out_recorder) {
+  IREE_ASSERT_ARGUMENT(file);
+  IREE_ASSERT_ARGUMENT(out_recorder);
+  *out_recorder = NULL;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_trace_recorder_t* recorder = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(host_allocator, sizeof(*recorder),
+                                (void**)&recorder));
+  recorder->host_allocator = host_allocator;
+  recorder->flags = flags;
+  recorder->file = file;
+  recorder->device = device;
+  iree_hal_device_retain(recorder->device);
+  recorder->start_time_ns = iree_time_now();
+  iree_slim_mutex_initialize(&recorder->mutex);
+
+  *out_recorder = recorder;
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+void iree_trace_recorder_destroy(iree_trace_recorder_t* recorder) {
+  if (!recorder) return;
+  IREE_TRACE_ZONE_BEGIN(z0);
+  fflush(recorder->file);
+  iree_slim_mutex_deinitialize(&recorder->mutex);
+  iree_hal_device_release(recorder->device);
+  iree_allocator_free(recorder->host_allocator, recorder);
+  IREE_TRACE_ZONE_END(z0);
+}
+
+// Returns an error if any prior write to the recorder file failed.
+static iree_status_t iree_trace_recorder_check_file(
+    iree_trace_recorder_t* recorder) {
+  if (ferror(recorder->file)) {
+    return iree_make_status(IREE_STATUS_DATA_LOSS,
+                            "failed to write trace event");
+  }
+  return iree_ok_status();
+}
+
+iree_status_t iree_trace_recorder_record_context_load(
+    iree_trace_recorder_t* recorder) {
+  IREE_ASSERT_ARGUMENT(recorder);
+  iree_slim_mutex_lock(&recorder->mutex);
+  fprintf(recorder->file, "---\ntype: context_load\n");
+  iree_status_t status = iree_trace_recorder_check_file(recorder);
+  iree_slim_mutex_unlock(&recorder->mutex);
+  return status;
+}
+
+iree_status_t iree_trace_recorder_record_module_load(
+    iree_trace_recorder_t* recorder, iree_vm_module_t* module,
+    iree_string_view_t bytecode_path) {
+  IREE_ASSERT_ARGUMENT(recorder);
+  IREE_ASSERT_ARGUMENT(module);
+  iree_string_view_t name = iree_vm_module_name(module);
+  iree_slim_mutex_lock(&recorder->mutex);
+  fprintf(recorder->file, "---\ntype: module_load\nmodule:\n");
+  fprintf(recorder->file, "  name: %.*s\n", (int)name.size, name.data);
+  if (iree_string_view_is_empty(bytecode_path)) {
+    fprintf(recorder->file, "  type: builtin\n");
+  } else {
+    fprintf(recorder->file, "  type: bytecode\n  path: %.*s\n",
+            (int)bytecode_path.size, bytecode_path.data);
+  }
+  iree_status_t status = iree_trace_recorder_check_file(recorder);
+  iree_slim_mutex_unlock(&recorder->mutex);
+  return status;
+}
+
+// Writes the |shape| as a YAML sequence under a `shape` key at |indent|.
+static void iree_trace_recorder_write_shape(iree_trace_recorder_t* recorder,
+                                            int indent,
+                                            iree_host_size_t shape_rank,
+                                            const iree_hal_dim_t* shape) {
+  if (shape_rank == 0) {
+    fprintf(recorder->file, "%*sshape: []\n", indent, "");
+    return;
+  }
+  fprintf(recorder->file, "%*sshape:\n", indent, "");
+  for (iree_host_size_t i = 0; i < shape_rank; ++i) {
+    fprintf(recorder->file, "%*s- %" PRIdim "\n", indent, "", shape[i]);
+  }
+}
+
+// Writes the contents of |buffer| as a base64 `contents` key at |indent|.
+static iree_status_t iree_trace_recorder_write_contents(
+    iree_trace_recorder_t* recorder, int indent, iree_hal_buffer_t* buffer,
+    iree_device_size_t byte_length) {
+  void* contents = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      recorder->host_allocator, (iree_host_size_t)byte_length, &contents));
+  iree_status_t status = iree_ok_status();
+  if (recorder->device) {
+    status = iree_hal_device_transfer_d2h(
+        recorder->device, buffer, 0, contents, byte_length,
+        IREE_HAL_TRANSFER_BUFFER_FLAG_DEFAULT, iree_infinite_timeout());
+  } else {
+    status = iree_hal_buffer_map_read(buffer, 0, contents, byte_length);
+  }
+  if (iree_status_is_ok(status)) {
+    fprintf(recorder->file, "%*scontents: !!binary |\n", indent, "");
+    iree_yaml_base64_fprint(
+        recorder->file,
+        iree_make_const_byte_span(contents, (iree_host_size_t)byte_length),
+        indent + 2);
+  }
+  iree_allocator_free(recorder->host_allocator, contents);
+  return status;
+}
+
+static iree_status_t iree_trace_recorder_write_item_sequence(
+    iree_trace_recorder_t* recorder, int indent, iree_vm_list_t* list);
+
+// Writes |value| as an item of a sequence at |indent| in the form parsed by
+// iree_trace_replay_parse_item.
+static iree_status_t iree_trace_recorder_write_item(
+    iree_trace_recorder_t* recorder, int indent, iree_vm_variant_t* value) {
+  FILE* file = recorder->file;
+  if (iree_vm_variant_is_value(*value)) {
+    fprintf(file, "%*s- type: value\n", indent, "");
+    switch (value->type.value_type) {
+      case IREE_VM_VALUE_TYPE_I8:
+        fprintf(file, "%*s  i8: %" PRIi8 "\n", indent, "", value->i8);
+        break;
+      case IREE_VM_VALUE_TYPE_I16:
+        fprintf(file, "%*s  i16: %" PRIi16 "\n", indent, "", value->i16);
+        break;
+      case IREE_VM_VALUE_TYPE_I32:
+        fprintf(file, "%*s  i32: %" PRIi32 "\n", indent, "", value->i32);
+        break;
+      case IREE_VM_VALUE_TYPE_I64:
+        fprintf(file, "%*s  i64: %" PRIi64 "\n", indent, "", value->i64);
+        break;
+      case IREE_VM_VALUE_TYPE_F32:
+        fprintf(file, "%*s  f32: %.9g\n", indent, "", value->f32);
+        break;
+      case IREE_VM_VALUE_TYPE_F64:
+        fprintf(file, "%*s  f64: %.17g\n", indent, "", value->f64);
+        break;
+      default:
+        return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                                "unsupported value type %d",
+                                (int)value->type.value_type);
+    }
+    return iree_ok_status();
+  } else if (!iree_vm_variant_is_ref(*value) || !value->ref.ptr) {
+    fprintf(file, "%*s- type: null\n", indent, "");
+    return iree_ok_status();
+  }
+
+  if (iree_hal_buffer_view_isa(value->ref)) {
+    iree_hal_buffer_view_t* buffer_view =
+        iree_hal_buffer_view_deref(value->ref);
+    fprintf(file, "%*s- type: hal.buffer_view\n", indent, "");
+    iree_trace_recorder_write_shape(
+        recorder, indent + 2, iree_hal_buffer_view_shape_rank(buffer_view),
+        iree_hal_buffer_view_shape_dims(buffer_view));
+    fprintf(file, "%*s  element_type: %u\n", indent, "",
+            (uint32_t)iree_hal_buffer_view_element_type(buffer_view));
+    fprintf(file, "%*s  encoding_type: %u\n", indent, "",
+            (uint32_t)iree_hal_buffer_view_encoding_type(buffer_view));
+    if (iree_all_bits_set(recorder->flags,
+                          IREE_TRACE_RECORDER_FLAG_RECORD_CONTENTS)) {
+      IREE_RETURN_IF_ERROR(iree_trace_recorder_write_contents(
+          recorder, indent + 2, iree_hal_buffer_view_buffer(buffer_view),
+          iree_hal_buffer_view_byte_length(buffer_view)));
+    }
+    return iree_ok_status();
+  } else if (iree_hal_buffer_isa(value->ref)) {
+    // Raw buffers are replayed as zero-filled allocations of the same size.
+    iree_hal_buffer_t* buffer = iree_hal_buffer_deref(value->ref);
+    iree_hal_dim_t length = (iree_hal_dim_t)iree_hal_buffer_byte_length(buffer);
+    fprintf(file, "%*s- type: hal.buffer\n", indent, "");
+    iree_trace_recorder_write_shape(recorder, indent + 2, 1, &length);
+    fprintf(file, "%*s  element_type: %u\n", indent, "",
+            (uint32_t)IREE_HAL_ELEMENT_TYPE_INT_8);
+    return iree_ok_status();
+  } else if (iree_vm_list_isa(value->ref)) {
+    fprintf(file, "%*s- type: vm.list\n", indent, "");
+    fprintf(file, "%*s  items:\n", indent, "");
+    return iree_trace_recorder_write_item_sequence(
+        recorder, indent + 2, iree_vm_list_deref(value->ref));
+  }
+  return iree_make_status(IREE_STATUS_UNIMPLEMENTED,
+                          "unsupported ref type for recording");
+}
+
+// Writes each element of |list| as a sequence item at |indent|.
+static iree_status_t iree_trace_recorder_write_item_sequence(
+    iree_trace_recorder_t* recorder, int indent, iree_vm_list_t* list) {
+  for (iree_host_size_t i = 0; i < iree_vm_list_size(list); ++i) {
+    iree_vm_variant_t variant = iree_vm_variant_empty();
+    IREE_RETURN_IF_ERROR(iree_vm_list_get_variant(list, i, &variant),
+                         "variant %zu not present", i);
+    IREE_RETURN_IF_ERROR(
+        iree_trace_recorder_write_item(recorder, indent, &variant));
+  }
+  return iree_ok_status();
+}
+
+iree_status_t iree_trace_recorder_record_call(
+    iree_trace_recorder_t* recorder, const iree_vm_function_t* function,
+    iree_vm_list_t* input_list) {
+  IREE_ASSERT_ARGUMENT(recorder);
+  IREE_ASSERT_ARGUMENT(function);
+  IREE_TRACE_ZONE_BEGIN(z0);
+  iree_duration_t timestamp_ns = iree_time_now() - recorder->start_time_ns;
+  iree_string_view_t module_name = iree_vm_module_name(function->module);
+  iree_string_view_t function_name = iree_vm_function_name(function);
+
+  iree_slim_mutex_lock(&recorder->mutex);
+  fprintf(recorder->file, "---\ntype: call\nfunction: %.*s.%.*s\n",
+          (int)module_name.size, module_name.data, (int)function_name.size,
+          function_name.data);
+  fprintf(recorder->file, "timestamp_ns: %" PRId64 "\n", timestamp_ns);
+  iree_status_t status = iree_ok_status();
+  if (input_list && iree_vm_list_size(input_list) > 0) {
+    fprintf(recorder->file, "args:\n");
+    status = iree_trace_recorder_write_item_sequence(recorder, 0, input_list);
+  } else {
+    fprintf(recorder->file, "args: []\n");
+  }
+  if (iree_status_is_ok(status)) {
+    status = iree_trace_recorder_check_file(recorder);
+  }
+  iree_slim_mutex_unlock(&recorder->mutex);
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
@@ -0,0 +1,74 @@
+// Copyright 2022 The IREE Authors
+//
+// Licensed under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef IREE_TOOLING_TRACE_RECORDER_H_
+#define IREE_TOOLING_TRACE_RECORDER_H_
+
+#include <stdio.h>
+
+#include "iree/base/api.h"
+#include "iree/hal/api.h"
+#include "iree/vm/api.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif  // __cplusplus
+
+enum iree_trace_recorder_flag_bits_e {
+  IREE_TRACE_RECORDER_FLAG_NONE = 0u,
+  // Records the contents of buffer and buffer view arguments. When omitted only
+  // the shapes and element types are recorded and replays use zero-filled
+  // buffers of the same size.
+  IREE_TRACE_RECORDER_FLAG_RECORD_CONTENTS = 1u << 0,
+};
+typedef uint32_t iree_trace_recorder_flags_t;
+
+// Records the calls made into a context as a trace that can be replayed with
+// iree-run-trace and iree-benchmark-trace (see iree/tooling/trace_replay.h).
+//
+// Each event is written as its own YAML document. Call events include a
+// `timestamp_ns` relative to the creation of the recorder such that replays
+// can reproduce the recorded inter-arrival timing.
+//
+// Thread-safe; calls may be recorded from multiple threads concurrently and
+// each event is written atomically with respect to others.
+typedef struct iree_trace_recorder_t iree_trace_recorder_t;
+
+// Creates a recorder writing events to |file|. The file must remain open for
+// the lifetime of the recorder. |device| is optional and used to read the
+// contents of buffers that are not host-visible when
+// IREE_TRACE_RECORDER_FLAG_RECORD_CONTENTS is set.
+iree_status_t iree_trace_recorder_create(FILE* file, iree_hal_device_t* device,
+                                         iree_trace_recorder_flags_t flags,
+                                         iree_allocator_t host_allocator,
+                                         iree_trace_recorder_t** out_recorder);
+
+// Flushes any pending events and destroys |recorder|.
+void iree_trace_recorder_destroy(iree_trace_recorder_t* recorder);
+
+// Records a `context_load` event that begins a new context.
+iree_status_t iree_trace_recorder_record_context_load(
+    iree_trace_recorder_t* recorder);
+
+// Records a `module_load` event for |module|. Modules with a non-empty
+// |bytecode_path| are recorded as bytecode modules loaded from that path and
+// all others as builtin modules referenced by name (such as `hal`).
+iree_status_t iree_trace_recorder_record_module_load(
+    iree_trace_recorder_t* recorder, iree_vm_module_t* module,
+    iree_string_view_t bytecode_path);
+
+// Records a `call` event to |function| with the arguments in |input_list|.
+// Should be called immediately before the function is invoked so that the
+// recorded timestamp reflects when the call was issued.
+iree_status_t iree_trace_recorder_record_call(
+    iree_trace_recorder_t* recorder, const iree_vm_function_t* function,
+    iree_vm_list_t* input_list);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif  // __cplusplus
+
+#endif  // IREE_TOOLING_TRACE_RECORDER_H_
@@ -18,6 +18,105 @@
 #include "iree/modules/hal/module.h"
 #include "iree/vm/bytecode_module.h"
 
+//===----------------------------------------------------------------------===//
+// iree_trace_replay_call_stats_t
+//===----------------------------------------------------------------------===//
+
+void iree_trace_replay_call_stats_initialize(
+    iree_allocator_t host_allocator,
+    iree_trace_replay_call_stats_t* out_stats) {
+  memset(out_stats, 0, sizeof(*out_stats));
+  out_stats->host_allocator = host_allocator;
+}
+
+void iree_trace_replay_call_stats_deinitialize(
+    iree_trace_replay_call_stats_t* stats) {
+  iree_allocator_free(stats->host_allocator, stats->latencies_ns);
+  memset(stats, 0, sizeof(*stats));
+}
+
+// Ensures |stats| has capacity for at least |minimum_capacity| calls.
+static iree_status_t iree_trace_replay_call_stats_reserve(
+    iree_trace_replay_call_stats_t* stats, iree_host_size_t minimum_capacity) {
+  if (minimum_capacity <= stats->capacity) return iree_ok_status();
+  iree_host_size_t new_capacity = iree_max(64, stats->capacity * 2);
+  new_capacity = iree_max(new_capacity, minimum_capacity);
+  IREE_RETURN_IF_ERROR(iree_allocator_realloc(
+      stats->host_allocator, new_capacity * sizeof(stats->latencies_ns[0]),
+      (void**)&stats->latencies_ns));
+  stats->capacity = new_capacity;
+  return iree_ok_status();
+}
+
+iree_status_t iree_trace_replay_call_stats_append(
+    iree_trace_replay_call_stats_t* stats, iree_duration_t latency_ns) {
+  IREE_RETURN_IF_ERROR(
+      iree_trace_replay_call_stats_reserve(stats, stats->count + 1));
+  stats->latencies_ns[stats->count++] = latency_ns;
+  return iree_ok_status();
+}
+
+iree_status_t iree_trace_replay_call_stats_merge(
+    iree_trace_replay_call_stats_t* target,
+    const iree_trace_replay_call_stats_t* source) {
+  if (!source->count) return iree_ok_status();
+  IREE_RETURN_IF_ERROR(iree_trace_replay_call_stats_reserve(
+      target, target->count + source->count));
+  memcpy(&target->latencies_ns[target->count], source->latencies_ns,
+         source->count * sizeof(source->latencies_ns[0]));
+  target->count += source->count;
+  return iree_ok_status();
+}
+
+static int iree_trace_replay_compare_durations(const void* lhs,
+                                               const void* rhs) {
+  iree_duration_t a = *(const iree_duration_t*)lhs;
+  iree_duration_t b = *(const iree_duration_t*)rhs;
+  return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+// Returns the nearest-rank |percentile| of the sorted |stats| in milliseconds.
+static double iree_trace_replay_call_stats_percentile_ms(
+    const iree_trace_replay_call_stats_t* stats, double percentile) {
+  iree_host_size_t rank =
+      (iree_host_size_t)(percentile / 100.0 * (double)stats->count + 0.5);
+  rank = iree_min(iree_max(rank, 1), stats->count);
+  return (double)stats->latencies_ns[rank - 1] / 1e6;
+}
+
+void iree_trace_replay_call_stats_fprint(FILE* file,
+                                         iree_trace_replay_call_stats_t* stats,
+                                         iree_duration_t wall_time_ns) {
+  fprintf(file, "calls: %" PRIhsz, stats->count);
+  if (wall_time_ns > 0) {
+    fprintf(file, ", wall time: %.3f ms, throughput: %.2f calls/s",
+            (double)wall_time_ns / 1e6,
+            (double)stats->count / ((double)wall_time_ns / 1e9));
+  }
+  fprintf(file, "\n");
+  if (!stats->count) return;
+
+  qsort(stats->latencies_ns, stats->count, sizeof(stats->latencies_ns[0]),
+        iree_trace_replay_compare_durations);
+  iree_duration_t total_ns = 0;
+  for (iree_host_size_t i = 0; i < stats->count; ++i) {
+    total_ns += stats->latencies_ns[i];
+  }
+  fprintf(file,
+          "latency (ms): mean %.3f, min %.3f, p50 %.3f, p90 %.3f, p99 %.3f, "
+          "max %.3f\n",
+          (double)total_ns / (double)stats->count / 1e6,
+          (double)stats->latencies_ns[0] / 1e6,
+          iree_trace_replay_call_stats_percentile_ms(stats, 50.0),
+          iree_trace_replay_call_stats_percentile_ms(stats, 90.0),
+          iree_trace_replay_call_stats_percentile_ms(stats, 99.0),
+          (double)stats->latencies_ns[stats->count - 1] / 1e6);
+}
+
+//===----------------------------------------------------------------------===//
+// iree_trace_replay_t
+//===----------------------------------------------------------------------===//
+
 iree_status_t iree_trace_replay_initialize(
     iree_string_view_t root_path, iree_vm_instance_t* instance,
     iree_vm_context_flags_t context_flags,
@@ -36,6 +135,10 @@ iree_status_t iree_trace_replay_initialize(
 
   out_replay->driver_registry = driver_registry;
 
+  out_replay->start_timestamp_ns = -1;
+  iree_trace_replay_call_stats_initialize(host_allocator,
+                                          &out_replay->call_stats);
+
   return iree_ok_status();
 }
 
@@ -50,9 +153,16 @@ void iree_trace_replay_deinitialize(iree_trace_replay_t* replay,
   }
   iree_hal_device_release(replay->device);
 
+  iree_trace_replay_call_stats_deinitialize(&replay->call_stats);
+
   memset(replay, 0, sizeof(*replay));
 }
 
+void iree_trace_replay_set_flags(iree_trace_replay_t* replay,
+                                 iree_trace_replay_flags_t flags) {
+  replay->flags = flags;
+}
+
 void iree_trace_replay_set_hal_devices_override(
     iree_trace_replay_t* replay, iree_host_size_t device_uri_count,
     const iree_string_view_t* device_uris) {
@@ -143,8 +253,8 @@ static iree_status_t iree_trace_replay_load_bytecode_module(
     IREE_RETURN_IF_ERROR(iree_file_path_join(
         replay->root_path, iree_yaml_node_as_string(path_node),
         replay->host_allocator, &full_path));
-    status = iree_file_read_contents(full_path, replay->host_allocator,
-                                     &flatbuffer_contents);
+    status = iree_file_map_contents(full_path, replay->host_allocator,
+                                    &flatbuffer_contents);
     iree_allocator_free(replay->host_allocator, full_path);
   }
 
@@ -988,6 +1098,60 @@ iree_status_t iree_trace_replay_event_call_prepare(
   return status;
 }
 
+iree_status_t iree_trace_replay_event_call_timestamp(
+    yaml_document_t* document, yaml_node_t* event_node,
+    iree_duration_t* out_timestamp_ns) {
+  *out_timestamp_ns = -1;
+  yaml_node_t* timestamp_node = NULL;
+  IREE_RETURN_IF_ERROR(iree_yaml_mapping_try_find(
+      document, event_node, iree_make_cstring_view("timestamp_ns"),
+      &timestamp_node));
+  if (!timestamp_node) return iree_ok_status();
+  int64_t timestamp_ns = 0;
+  if (!iree_string_view_atoi_int64(iree_yaml_node_as_string(timestamp_node),
+                                   &timestamp_ns) ||
+      timestamp_ns < 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "(%zu): invalid call timestamp '%.*s'",
+                            timestamp_node->start_mark.line,
+                            (int)timestamp_node->data.scalar.length,
+                            timestamp_node->data.scalar.value);
+  }
+  *out_timestamp_ns = timestamp_ns;
+  return iree_ok_status();
+}
+
+// Invokes |function| for the call |event_node| and records its latency.
+// With IREE_TRACE_REPLAY_FLAG_REALTIME the invocation is delayed until its
+// recorded time relative to the first timestamped call.
+static iree_status_t iree_trace_replay_invoke(iree_trace_replay_t* replay,
+                                              yaml_document_t* document,
+                                              yaml_node_t* event_node,
+                                              iree_vm_function_t function,
+                                              iree_vm_list_t* input_list,
+                                              iree_vm_list_t* output_list) {
+  if (iree_all_bits_set(replay->flags, IREE_TRACE_REPLAY_FLAG_REALTIME)) {
+    iree_duration_t timestamp_ns = -1;
+    IREE_RETURN_IF_ERROR(iree_trace_replay_event_call_timestamp(
+        document, event_node, &timestamp_ns));
+    if (timestamp_ns >= 0) {
+      if (replay->start_timestamp_ns < 0) {
+        replay->start_time_ns = iree_time_now();
+        replay->start_timestamp_ns = timestamp_ns;
+      }
+      iree_wait_until(replay->start_time_ns +
+                      (timestamp_ns - replay->start_timestamp_ns));
+    }
+  }
+
+  iree_time_t start_ns = iree_time_now();
+  IREE_RETURN_IF_ERROR(iree_vm_invoke(
+      replay->context, function, IREE_VM_INVOCATION_FLAG_NONE,
+      /*policy=*/NULL, input_list, output_list, replay->host_allocator));
+  return iree_trace_replay_call_stats_append(&replay->call_stats,
+                                             iree_time_now() - start_ns);
+}
+
 iree_status_t iree_trace_replay_event_call(iree_trace_replay_t* replay,
                                            yaml_document_t* document,
                                            yaml_node_t* event_node,
@@ -1007,9 +1171,8 @@ iree_status_t iree_trace_replay_event_call(iree_trace_replay_t* replay,
       iree_vm_list_create(/*element_type=*/NULL, /*initial_capacity=*/8,
                           replay->host_allocator, &output_list);
   if (iree_status_is_ok(status)) {
-    status = iree_vm_invoke(replay->context, function,
-                            IREE_VM_INVOCATION_FLAG_NONE, /*policy=*/NULL,
-                            input_list, output_list, replay->host_allocator);
+    status = iree_trace_replay_invoke(replay, document, event_node, function,
+                                      input_list, output_list);
   }
   iree_vm_list_release(input_list);
 
@@ -1029,9 +1192,13 @@ static iree_status_t iree_trace_replay_event_call_stdout(
   IREE_RETURN_IF_ERROR(iree_yaml_mapping_find(
       document, event_node, iree_make_cstring_view("function"),
       &function_node));
+  const bool quiet =
+      iree_all_bits_set(replay->flags, IREE_TRACE_REPLAY_FLAG_QUIET);
   iree_string_view_t function_name = iree_yaml_node_as_string(function_node);
-  fprintf(stdout, "--- CALL[%.*s] ---\n", (int)function_name.size,
-          function_name.data);
+  if (!quiet) {
+    fprintf(stdout, "--- CALL[%.*s] ---\n", (int)function_name.size,
+            function_name.data);
+  }
 
   // Prepare to call the function.
   iree_vm_function_t function;
@@ -1045,14 +1212,13 @@ static iree_status_t iree_trace_replay_event_call_stdout(
       iree_vm_list_create(/*element_type=*/NULL, /*initial_capacity=*/8,
                           replay->host_allocator, &output_list);
   if (iree_status_is_ok(status)) {
-    status = iree_vm_invoke(replay->context, function,
-                            IREE_VM_INVOCATION_FLAG_NONE, /*policy=*/NULL,
-                            input_list, output_list, replay->host_allocator);
+    status = iree_trace_replay_invoke(replay, document, event_node, function,
+                                      input_list, output_list);
   }
   iree_vm_list_release(input_list);
 
   // Print the outputs.
-  if (iree_status_is_ok(status)) {
+  if (iree_status_is_ok(status) && !quiet) {
     status =
         iree_trace_replay_print_vm_list(output_list, replay->host_allocator);
   }
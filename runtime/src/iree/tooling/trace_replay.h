@@ -7,6 +7,8 @@
 #ifndef IREE_TOOLING_TRACE_REPLAY_H_
 #define IREE_TOOLING_TRACE_REPLAY_H_
 
+#include <stdio.h>
+
 #include "iree/base/api.h"
 #include "iree/hal/api.h"
 #include "iree/tooling/yaml_util.h"
@@ -22,6 +24,58 @@ enum iree_trace_replay_shutdown_flag_bits_e {
 };
 typedef uint32_t iree_trace_replay_shutdown_flags_t;
 
+enum iree_trace_replay_flag_bits_e {
+  IREE_TRACE_REPLAY_FLAG_NONE = 0u,
+  // Suppresses printing call events and their outputs to stdout.
+  IREE_TRACE_REPLAY_FLAG_QUIET = 1u << 0,
+  // Delays each call event with a `timestamp_ns` until the same amount of time
+  // has elapsed since the first timestamped call was replayed as was recorded.
+  // This reproduces the recorded inter-arrival timing of calls instead of
+  // issuing them back-to-back.
+  IREE_TRACE_REPLAY_FLAG_REALTIME = 1u << 1,
+};
+typedef uint32_t iree_trace_replay_flags_t;
+
+//===----------------------------------------------------------------------===//
+// iree_trace_replay_call_stats_t
+//===----------------------------------------------------------------------===//
+
+// Invocation latencies of replayed calls.
+typedef struct iree_trace_replay_call_stats_t {
+  iree_allocator_t host_allocator;
+  iree_host_size_t count;
+  iree_host_size_t capacity;
+  iree_duration_t* latencies_ns;
+} iree_trace_replay_call_stats_t;
+
+// Initializes empty call statistics in |out_stats|.
+void iree_trace_replay_call_stats_initialize(
+    iree_allocator_t host_allocator, iree_trace_replay_call_stats_t* out_stats);
+
+// Deinitializes |stats| and releases its storage.
+void iree_trace_replay_call_stats_deinitialize(
+    iree_trace_replay_call_stats_t* stats);
+
+// Appends a call with the given |latency_ns| to |stats|.
+iree_status_t iree_trace_replay_call_stats_append(
+    iree_trace_replay_call_stats_t* stats, iree_duration_t latency_ns);
+
+// Appends all calls in |source| to |target|.
+iree_status_t iree_trace_replay_call_stats_merge(
+    iree_trace_replay_call_stats_t* target,
+    const iree_trace_replay_call_stats_t* source);
+
+// Prints a latency report (count, mean, and percentiles) of |stats| to |file|.
+// |wall_time_ns| is the total time the calls were issued over and is used to
+// report throughput; pass 0 to omit it. Reorders the recorded latencies.
+void iree_trace_replay_call_stats_fprint(FILE* file,
+                                         iree_trace_replay_call_stats_t* stats,
+                                         iree_duration_t wall_time_ns);
+
+//===----------------------------------------------------------------------===//
+// iree_trace_replay_t
+//===----------------------------------------------------------------------===//
+
 typedef struct iree_trace_replay_t {
   iree_allocator_t host_allocator;
   iree_string_view_t root_path;
@@ -35,6 +89,14 @@ typedef struct iree_trace_replay_t {
 
   iree_vm_context_t* context;
   iree_hal_device_t* device;
+
+  iree_trace_replay_flags_t flags;
+  // Time the first timestamped call event was replayed and its recorded
+  // timestamp; used with IREE_TRACE_REPLAY_FLAG_REALTIME to pace calls.
+  iree_time_t start_time_ns;
+  iree_duration_t start_timestamp_ns;
+  // Latencies of all calls replayed.
+  iree_trace_replay_call_stats_t call_stats;
 } iree_trace_replay_t;
 
 // Initializes a trace replay context.
@@ -57,6 +119,17 @@ void iree_trace_replay_set_hal_devices_override(
     iree_trace_replay_t* replay, iree_host_size_t device_uri_count,
     const iree_string_view_t* device_uris);
 
+// Sets flags controlling how events are replayed.
+void iree_trace_replay_set_flags(iree_trace_replay_t* replay,
+                                 iree_trace_replay_flags_t flags);
+
+// Returns the `timestamp_ns` of a `call` event in |out_timestamp_ns| or -1 if
+// the event has no timestamp. Timestamps are relative to the start of the
+// trace.
+iree_status_t iree_trace_replay_event_call_timestamp(
+    yaml_document_t* document, yaml_node_t* event_node,
+    iree_duration_t* out_timestamp_ns);
+
 // Replays the given |event_node| against the replay context.
 // Automatically switches between the default iree_trace_replay_event_* methods.
 iree_status_t iree_trace_replay_event(iree_trace_replay_t* replay,
@@ -83,7 +156,8 @@ iree_status_t iree_trace_replay_event_call_prepare(
 
 // Replays a `call` event against the replay context.
 // Optionally |out_output_list| can be populated with a caller-owned set of
-// outputs from the call.
+// outputs from the call. The invocation latency is added to the replay call
+// statistics.
 iree_status_t iree_trace_replay_event_call(iree_trace_replay_t* replay,
                                            yaml_document_t* document,
                                            yaml_node_t* event_node,
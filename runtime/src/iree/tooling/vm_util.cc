@@ -6,86 +6,153 @@
 
 #include "iree/tooling/vm_util.h"
 
-#include <cerrno>
 #include <cstdint>
-#include <cstdio>
+#include <cstring>
 #include <ostream>
 #include <type_traits>
 #include <vector>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/file_io.h"
 #include "iree/base/status_cc.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/api.h"
 #include "iree/modules/hal/module.h"
 #include "iree/tooling/numpy_io.h"
+#include "iree/tooling/safetensors_io.h"
 #include "iree/vm/ref_cc.h"
 
-// TODO(benvanik): drop use of stdio and make an iree_io_stream_t.
-#if defined(IREE_PLATFORM_WINDOWS)
-static uint64_t GetFileLength(FILE* file) {
-  _fseeki64(file, 0, SEEK_END);
-  uint64_t file_length = _ftelli64(file);
-  _fseeki64(file, 0, SEEK_SET);
-  return file_length;
-}
-static bool IsEOF(FILE* file, uint64_t file_length) {
-  return _ftelli64(file) == file_length;
-}
-#else
-static uint64_t GetFileLength(FILE* file) {
-  fseeko(file, 0, SEEK_END);
-  uint64_t file_length = ftello(file);
-  fseeko(file, 0, SEEK_SET);
-  return file_length;
-}
-static bool IsEOF(FILE* file, uint64_t file_length) {
-  return ftello(file) == file_length;
+namespace iree {
+
+static void ReleaseMappedFile(void* user_data, iree_hal_buffer_t* buffer) {
+  iree_file_contents_free(reinterpret_cast<iree_file_contents_t*>(user_data));
 }
-#endif  // IREE_PLATFORM_*
 
-namespace iree {
+// Maps the file at |file_path| into host memory and tries to import the
+// mapping into a buffer usable by the device. On success |out_buffer| owns the
+// returned |out_contents| and releasing it unmaps the file. If the device
+// cannot import host memory |out_buffer| is NULL and the caller must free
+// |out_contents|.
+static iree_status_t MapFile(iree_string_view_t file_path,
+                             iree_hal_allocator_t* device_allocator,
+                             iree_file_contents_t** out_contents,
+                             iree_hal_buffer_t** out_buffer) {
+  *out_contents = NULL;
+  *out_buffer = NULL;
+  std::string file_path_str(file_path.data, file_path.size);
+  iree_file_contents_t* contents = NULL;
+  IREE_RETURN_IF_ERROR(iree_file_map_contents(
+      file_path_str.c_str(),
+      iree_hal_allocator_host_allocator(device_allocator), &contents));
 
+  iree_hal_external_buffer_t external_buffer = {};
+  external_buffer.type = IREE_HAL_EXTERNAL_BUFFER_TYPE_HOST_ALLOCATION;
+  external_buffer.size = contents->const_buffer.data_length;
+  external_buffer.handle.host_allocation.ptr =
+      const_cast<uint8_t*>(contents->const_buffer.data);
+  iree_hal_buffer_params_t import_params = {};
+  import_params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
+  import_params.access = IREE_HAL_MEMORY_ACCESS_READ;
+  import_params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+  iree_hal_buffer_release_callback_t release_callback = {
+      ReleaseMappedFile,
+      contents,
+  };
+  iree_status_t status = iree_hal_allocator_import_buffer(
+      device_allocator, import_params, &external_buffer, release_callback,
+      out_buffer);
+  if (!iree_status_is_ok(status)) {
+    // Not all devices can use host memory directly (or the mapping may not
+    // meet their requirements); fall back to copying the contents.
+    iree_status_ignore(status);
+    *out_buffer = NULL;
+  }
+  *out_contents = contents;
+  return iree_ok_status();
+}
+
+// Loads all ndarrays from the .npy (possibly concatenated) or .npz file at
+// |file_path| or tensors from a .safetensors file and appends them to
+// |variant_list|. Files are mapped and when possible the buffer views
+// reference the mapped contents directly instead of copies.
 static iree_status_t LoadNdarraysFromFile(
     iree_string_view_t file_path, iree_hal_allocator_t* device_allocator,
     iree_vm_list_t* variant_list) {
-  // Open the file for reading.
-  std::string file_path_str(file_path.data, file_path.size);
-  FILE* file = std::fopen(file_path_str.c_str(), "rb");
-  if (!file) {
-    return iree_make_status(iree_status_code_from_errno(errno),
-                            "failed to open file '%.*s'", (int)file_path.size,
-                            file_path.data);
-  }
-
-  uint64_t file_length = GetFileLength(file);
+  IREE_TRACE_SCOPE();
+  iree_file_contents_t* contents = NULL;
+  iree_hal_buffer_t* contents_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      MapFile(file_path, device_allocator, &contents, &contents_buffer),
+      "mapping file '%.*s'", (int)file_path.size, file_path.data);
+  iree_const_byte_span_t file_contents = contents->const_buffer;
 
   iree_hal_buffer_params_t buffer_params = {};
   buffer_params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
   buffer_params.access = IREE_HAL_MEMORY_ACCESS_READ;
   buffer_params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
 
+  // Loads the concatenated ndarrays in |npy_contents| located at
+  // |npy_offset| in the file.
+  auto load_npy = [&](iree_const_byte_span_t npy_contents,
+                      iree_host_size_t npy_offset) -> iree_status_t {
+    iree_host_size_t offset = 0;
+    while (offset < npy_contents.data_length) {
+      iree_hal_buffer_view_t* buffer_view = NULL;
+      iree_host_size_t length = 0;
+      IREE_RETURN_IF_ERROR(iree_numpy_npy_load_ndarray_from_memory(
+          iree_make_const_byte_span(npy_contents.data + offset,
+                                    npy_contents.data_length - offset),
+          contents_buffer, npy_offset + offset, buffer_params,
+          device_allocator, &buffer_view, &length));
+      auto buffer_view_ref = iree_hal_buffer_view_move_ref(buffer_view);
+      IREE_RETURN_IF_ERROR(
+          iree_vm_list_push_ref_move(variant_list, &buffer_view_ref));
+      offset += length;
+    }
+    return iree_ok_status();
+  };
+
   iree_status_t status = iree_ok_status();
-  while (iree_status_is_ok(status) && !IsEOF(file, file_length)) {
-    iree_hal_buffer_view_t* buffer_view = NULL;
-    status = iree_numpy_npy_load_ndarray(
-        file, IREE_NUMPY_NPY_LOAD_OPTION_DEFAULT, buffer_params,
-        device_allocator, &buffer_view);
-    if (iree_status_is_ok(status)) {
-      auto buffer_view_ref = iree_hal_buffer_view_retain_ref(buffer_view);
-      status = iree_vm_list_push_ref_move(variant_list, &buffer_view_ref);
+  if (iree_string_view_ends_with(file_path, IREE_SV(".npz"))) {
+    iree_host_size_t offset = 0;
+    while (iree_status_is_ok(status)) {
+      iree_string_view_t name = iree_string_view_empty();
+      iree_const_byte_span_t npy_contents = iree_const_byte_span_empty();
+      status = iree_numpy_npz_next_entry(file_contents, &offset, &name,
+                                         &npy_contents);
+      if (!iree_status_is_ok(status) || !npy_contents.data) break;
+      status = load_npy(npy_contents,
+                        (iree_host_size_t)(npy_contents.data -
+                                           file_contents.data));
     }
-    iree_hal_buffer_view_release(buffer_view);
+  } else if (iree_string_view_ends_with(file_path, IREE_SV(".safetensors"))) {
+    status = iree_safetensors_load_tensors(
+        file_contents, contents_buffer, buffer_params, device_allocator,
+        +[](void* user_data, iree_string_view_t name,
+            iree_hal_buffer_view_t* buffer_view) {
+          auto buffer_view_ref = iree_hal_buffer_view_retain_ref(buffer_view);
+          return iree_vm_list_push_ref_move(
+              reinterpret_cast<iree_vm_list_t*>(user_data), &buffer_view_ref);
+        },
+        variant_list);
+  } else {
+    status = load_npy(file_contents, 0);
   }
 
-  std::fclose(file);
+  if (contents_buffer) {
+    // Any buffer views referencing the mapping retain the buffer.
+    iree_hal_buffer_release(contents_buffer);
+  } else {
+    iree_file_contents_free(contents);
+  }
   return status;
 }
 
 // Creates a HAL buffer view with the given |metadata| and reads the contents
 // from the file at |file_path|.
 //
-// The file contents are directly read in to memory with no processing.
+// The file contents are used with no processing and are referenced directly
+// from the mapped file when the device can import host memory.
 static iree_status_t CreateBufferViewFromFile(
     iree_string_view_t metadata, iree_string_view_t file_path,
     iree_hal_allocator_t* device_allocator,
@@ -115,43 +182,54 @@ static iree_status_t CreateBufferViewFromFile(
   iree_hal_encoding_type_t encoding_type =
       IREE_HAL_ENCODING_TYPE_DENSE_ROW_MAJOR;
 
-  // Open the file for reading.
-  std::string file_path_str(file_path.data, file_path.size);
-  FILE* file = std::fopen(file_path_str.c_str(), "rb");
-  if (!file) {
-    return iree_make_status(iree_status_code_from_errno(errno),
-                            "failed to open file '%.*s'", (int)file_path.size,
-                            file_path.data);
-  }
+  iree_device_size_t byte_length = 0;
+  IREE_RETURN_IF_ERROR(iree_hal_buffer_compute_view_size(
+      shape_rank, shape, element_type, encoding_type, &byte_length));
 
-  iree_hal_buffer_params_t buffer_params = {0};
-  buffer_params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
-  buffer_params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
-  struct read_params_t {
-    FILE* file;
-  } read_params = {
-      file,
-  };
-  iree_status_t status = iree_hal_buffer_view_generate_buffer(
-      device_allocator, shape_rank, shape, element_type, encoding_type,
-      buffer_params,
-      +[](iree_hal_buffer_mapping_t* mapping, void* user_data) {
-        auto* read_params = reinterpret_cast<read_params_t*>(user_data);
-        size_t bytes_read =
-            std::fread(mapping->contents.data, 1, mapping->contents.data_length,
-                       read_params->file);
-        if (bytes_read != mapping->contents.data_length) {
-          return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
-                                  "file contents truncated; expected %zu bytes "
-                                  "based on buffer view size",
-                                  mapping->contents.data_length);
-        }
-        return iree_ok_status();
-      },
-      &read_params, out_buffer_view);
+  // Map the file and reference it directly when the device can import it.
+  iree_file_contents_t* contents = NULL;
+  iree_hal_buffer_t* contents_buffer = NULL;
+  IREE_RETURN_IF_ERROR(
+      MapFile(file_path, device_allocator, &contents, &contents_buffer),
+      "mapping file '%.*s'", (int)file_path.size, file_path.data);
 
-  std::fclose(file);
+  iree_status_t status = iree_ok_status();
+  if (contents->const_buffer.data_length < byte_length) {
+    status = iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "file contents truncated; expected %" PRIdsz
+                              " bytes based on buffer view size",
+                              byte_length);
+  } else if (contents_buffer) {
+    iree_hal_buffer_t* buffer = NULL;
+    status = iree_hal_buffer_subspan(contents_buffer, 0, byte_length, &buffer);
+    if (iree_status_is_ok(status)) {
+      status = iree_hal_buffer_view_create(
+          buffer, shape_rank, shape, element_type, encoding_type,
+          iree_hal_allocator_host_allocator(device_allocator),
+          out_buffer_view);
+    }
+    iree_hal_buffer_release(buffer);
+  } else {
+    iree_hal_buffer_params_t buffer_params = {0};
+    buffer_params.type = IREE_HAL_MEMORY_TYPE_DEVICE_LOCAL;
+    buffer_params.usage = IREE_HAL_BUFFER_USAGE_DEFAULT;
+    status = iree_hal_buffer_view_generate_buffer(
+        device_allocator, shape_rank, shape, element_type, encoding_type,
+        buffer_params,
+        +[](iree_hal_buffer_mapping_t* mapping, void* user_data) {
+          auto* source = reinterpret_cast<const uint8_t*>(user_data);
+          memcpy(mapping->contents.data, source,
+                 mapping->contents.data_length);
+          return iree_ok_status();
+        },
+        const_cast<uint8_t*>(contents->const_buffer.data), out_buffer_view);
+  }
 
+  if (contents_buffer) {
+    iree_hal_buffer_release(contents_buffer);
+  } else {
+    iree_file_contents_free(contents);
+  }
   return status;
 }
 
@@ -187,3 +187,38 @@ iree_status_t iree_yaml_base64_decode(iree_string_view_t source,
   }
   return iree_ok_status();
 }
+
+static const char iree_yaml_base64_encode_table[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Maximum number of encoded characters per line (per RFC 2045).
+#define IREE_YAML_BASE64_LINE_LENGTH 76
+
+void iree_yaml_base64_fprint(FILE* file, iree_const_byte_span_t source,
+                             int indent) {
+  char line[IREE_YAML_BASE64_LINE_LENGTH + 1];
+  size_t line_length = 0;
+  const uint8_t* p = source.data;
+  for (size_t i = 0; i < source.data_length; i += 3) {
+    // Pack up to 3 bytes into a 24-bit block and pad the remainder with '='.
+    size_t block_length = iree_min(source.data_length - i, 3);
+    uint32_t block = (uint32_t)p[i] << 16;
+    if (block_length > 1) block |= (uint32_t)p[i + 1] << 8;
+    if (block_length > 2) block |= (uint32_t)p[i + 2];
+    line[line_length++] = iree_yaml_base64_encode_table[(block >> 18) & 0x3F];
+    line[line_length++] = iree_yaml_base64_encode_table[(block >> 12) & 0x3F];
+    line[line_length++] = block_length > 1
+                              ? iree_yaml_base64_encode_table[(block >> 6) &
+                                                              0x3F]
+                              : '=';
+    line[line_length++] =
+        block_length > 2 ? iree_yaml_base64_encode_table[block & 0x3F] : '=';
+    if (line_length == IREE_YAML_BASE64_LINE_LENGTH) {
+      fprintf(file, "%*s%.*s\n", indent, "", (int)line_length, line);
+      line_length = 0;
+    }
+  }
+  if (line_length > 0) {
+    fprintf(file, "%*s%.*s\n", indent, "", (int)line_length, line);
+  }
+}
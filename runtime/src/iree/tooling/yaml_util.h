@@ -7,6 +7,8 @@
 #ifndef IREE_TOOLING_YAML_UTIL_H_
 #define IREE_TOOLING_YAML_UTIL_H_
 
+#include <stdio.h>
+
 #include "iree/base/api.h"
 
 #define YAML_DECLARE_STATIC
@@ -43,4 +45,10 @@ size_t iree_yaml_base64_calculate_size(iree_string_view_t source);
 iree_status_t iree_yaml_base64_decode(iree_string_view_t source,
                                       iree_byte_span_t target);
 
+// Encodes |source| as base64 and writes it to |file| as lines of at most 76
+// characters each prefixed with |indent| spaces, as used in the body of a
+// YAML `!!binary |` block scalar.
+void iree_yaml_base64_fprint(FILE* file, iree_const_byte_span_t source,
+                             int indent);
+
 #endif  // IREE_TOOLING_YAML_UTIL_H_
@@ -9,6 +9,7 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "iree/base/internal/bulk_memory.h"
 #include "iree/base/tracing.h"
 
 static iree_vm_ref_type_descriptor_t iree_vm_buffer_descriptor = {0};
@@ -185,6 +186,12 @@ iree_vm_buffer_length(const iree_vm_buffer_t* buffer) {
   return buffer->data.data_length;
 }
 
+IREE_API_EXPORT iree_byte_span_t
+iree_vm_buffer_data(const iree_vm_buffer_t* buffer) {
+  IREE_ASSERT_ARGUMENT(buffer);
+  return buffer->data;
+}
+
 IREE_API_EXPORT iree_status_t iree_vm_buffer_copy_bytes(
     const iree_vm_buffer_t* source_buffer, iree_host_size_t source_offset,
     const iree_vm_buffer_t* target_buffer, iree_host_size_t target_offset,
@@ -234,31 +241,12 @@ IREE_API_EXPORT iree_status_t iree_vm_buffer_fill_elements(
                                              element_count * element_length,
                                              element_length, &span));
   switch (element_length) {
-    case 1: {
-      const uint8_t pattern_value = *(const uint8_t*)value;
-      memset(span.data, pattern_value, span.data_length);
-    } break;
-    case 2: {
-      const uint16_t pattern_value = *(const uint16_t*)value;
-      uint16_t* target_ptr = (uint16_t*)span.data;
-      for (iree_host_size_t i = 0; i < element_count; ++i) {
-        target_ptr[i] = pattern_value;
-      }
-    } break;
-    case 4: {
-      const uint32_t pattern_value = *(const uint32_t*)value;
-      uint32_t* target_ptr = (uint32_t*)span.data;
-      for (iree_host_size_t i = 0; i < element_count; ++i) {
-        target_ptr[i] = pattern_value;
-      }
-    } break;
-    case 8: {
-      const uint64_t pattern_value = *(const uint64_t*)value;
-      uint64_t* target_ptr = (uint64_t*)span.data;
-      for (iree_host_size_t i = 0; i < element_count; ++i) {
-        target_ptr[i] = pattern_value;
-      }
-    } break;
+    case 1:
+    case 2:
+    case 4:
+    case 8:
+      iree_bulk_memory_fill(span.data, element_count, value, element_length);
+      break;
     default:
       return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
                               "invalid element length %" PRIhsz
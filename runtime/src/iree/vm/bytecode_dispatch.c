@@ -90,8 +90,36 @@ static iree_vm_registers_t iree_vm_bytecode_get_register_storage(
   return registers;
 }
 
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+// Accumulates the profiling counters of a |frame| that is being left into the
+// module state counters for its function.
+static void iree_vm_bytecode_stack_frame_profile_leave(
+    iree_vm_stack_frame_t* frame) {
+  iree_vm_bytecode_frame_storage_t* stack_storage =
+      (iree_vm_bytecode_frame_storage_t*)iree_vm_stack_frame_storage(frame);
+  if (!stack_storage->profile_start_ns) return;  // not profiled
+  iree_vm_bytecode_module_state_t* module_state =
+      (iree_vm_bytecode_module_state_t*)frame->module_state;
+  if (frame->function.ordinal >= module_state->function_profile_count) return;
+  iree_vm_bytecode_profile_counters_t* profile =
+      &module_state->function_profile_table[frame->function.ordinal];
+  iree_atomic_fetch_add_int64(&profile->call_count, 1,
+                              iree_memory_order_relaxed);
+  iree_atomic_fetch_add_int64(&profile->instruction_count,
+                              stack_storage->profile_instruction_count,
+                              iree_memory_order_relaxed);
+  iree_atomic_fetch_add_int64(
+      &profile->total_time_ns,
+      iree_time_now() - stack_storage->profile_start_ns,
+      iree_memory_order_relaxed);
+}
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+
 // Releases any remaining refs held in the frame storage.
 static void iree_vm_bytecode_stack_frame_cleanup(iree_vm_stack_frame_t* frame) {
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  iree_vm_bytecode_stack_frame_profile_leave(frame);
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
   iree_vm_registers_t regs = iree_vm_bytecode_get_register_storage(frame);
   // TODO(benvanik): allow the VM to elide this when it's known that there are
   // no more live registers.
@@ -165,6 +193,12 @@ static iree_status_t iree_vm_bytecode_function_enter(
   stack_storage->ref_register_count = ref_register_count;
   stack_storage->i32_register_offset = header_size;
   stack_storage->ref_register_offset = header_size + i32_register_size;
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  stack_storage->profile_start_ns = IREE_IS_DISPATCH_PROFILING_ENABLED()
+                                        ? iree_time_now()
+                                        : 0;
+  stack_storage->profile_instruction_count = 0;
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
   *out_callee_registers =
       iree_vm_bytecode_get_register_storage(*out_callee_frame);
 
@@ -476,17 +510,80 @@ static void iree_vm_bytecode_populate_import_cconv_arguments(
   }
 }
 
+// Begins a populated import call.
+// Imports of native modules using the default call handling are invoked by
+// calling the cached shim directly. This matches what the native module
+// begin_call would do (including leaving the same frame for resumption) but
+// skips the generic module routing.
+static iree_status_t iree_vm_bytecode_begin_import_call(
+    iree_vm_stack_t* stack, const iree_vm_bytecode_import_t* import,
+    const iree_vm_function_call_t* call,
+    iree_vm_execution_result_t* out_result) {
+  const iree_vm_native_function_ptr_t* function_ptr =
+      import->native_function_ptr;
+  if (!function_ptr) {
+    return call->function.module->begin_call(call->function.module->self,
+                                             stack, call, out_result);
+  }
+
+  iree_vm_stack_frame_t* callee_frame = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_stack_function_enter(
+      stack, &call->function, IREE_VM_STACK_FRAME_NATIVE, /*frame_size=*/0,
+      /*frame_cleanup_fn=*/NULL, &callee_frame));
+  memset(out_result, 0, sizeof(*out_result));
+  iree_status_t status = function_ptr->shim(
+      stack, IREE_VM_NATIVE_FUNCTION_CALL_BEGIN, call->arguments,
+      call->results, function_ptr->target, call->function.module,
+      callee_frame->module_state, out_result);
+  if (iree_status_is_deferred(status)) {
+    // Call deferred; the frame is kept for resumption via the module.
+    return status;
+  } else if (IREE_UNLIKELY(!iree_status_is_ok(status))) {
+#if IREE_STATUS_FEATURES & IREE_STATUS_FEATURE_ANNOTATIONS
+    iree_string_view_t module_name IREE_ATTRIBUTE_UNUSED =
+        iree_vm_module_name(call->function.module);
+    iree_string_view_t function_name IREE_ATTRIBUTE_UNUSED =
+        iree_vm_function_name(&call->function);
+    return iree_status_annotate_f(status,
+                                  "while invoking native function %.*s.%.*s",
+                                  (int)module_name.size, module_name.data,
+                                  (int)function_name.size, function_name.data);
+#else
+    return status;
+#endif  // IREE_STATUS_FEATURES & IREE_STATUS_FEATURE_ANNOTATIONS
+  }
+  return iree_vm_stack_function_leave(stack);
+}
+
 // Issues a populated import call and marshals the results into |dst_reg_list|.
 static iree_status_t iree_vm_bytecode_issue_import_call(
-    iree_vm_stack_t* stack, const iree_vm_function_call_t call,
-    iree_string_view_t cconv_results,
+    iree_vm_stack_t* stack, const iree_vm_bytecode_module_state_t* module_state,
+    const iree_vm_bytecode_import_t* import,
+    const iree_vm_function_call_t call, iree_string_view_t cconv_results,
     const iree_vm_register_list_t* IREE_RESTRICT dst_reg_list,
     iree_vm_stack_frame_t** out_caller_frame,
     iree_vm_registers_t* out_caller_registers,
     iree_vm_execution_result_t* out_result) {
   // Call external function.
-  iree_status_t call_status = call.function.module->begin_call(
-      call.function.module->self, stack, &call, out_result);
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  // NOTE: deferred calls are only timed until they first yield.
+  const iree_time_t profile_start_ns =
+      IREE_IS_DISPATCH_PROFILING_ENABLED() ? iree_time_now() : 0;
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+  iree_status_t call_status =
+      iree_vm_bytecode_begin_import_call(stack, import, &call, out_result);
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  if (profile_start_ns) {
+    iree_host_size_t import_ordinal = import - module_state->import_table;
+    iree_vm_bytecode_profile_counters_t* profile =
+        &module_state->import_profile_table[import_ordinal];
+    iree_atomic_fetch_add_int64(&profile->call_count, 1,
+                                iree_memory_order_relaxed);
+    iree_atomic_fetch_add_int64(&profile->total_time_ns,
+                                iree_time_now() - profile_start_ns,
+                                iree_memory_order_relaxed);
+  }
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
   if (iree_status_is_deferred(call_status)) {
     return call_status;  // deferred for future resume
   } else if (IREE_UNLIKELY(!iree_status_is_ok(call_status))) {
@@ -600,9 +697,9 @@ static iree_status_t iree_vm_bytecode_call_import(
   call.results.data_length = import->result_buffer_size;
   call.results.data = iree_alloca(call.results.data_length);
   memset(call.results.data, 0, call.results.data_length);
-  return iree_vm_bytecode_issue_import_call(stack, call, import->results,
-                                            dst_reg_list, out_caller_frame,
-                                            out_caller_registers, out_result);
+  return iree_vm_bytecode_issue_import_call(
+      stack, module_state, import, call, import->results, dst_reg_list,
+      out_caller_frame, out_caller_registers, out_result);
 }
 
 // Calls a variadic imported function from another module.
@@ -642,9 +739,9 @@ static iree_status_t iree_vm_bytecode_call_import_variadic(
   call.results.data_length = import->result_buffer_size;
   call.results.data = iree_alloca(call.results.data_length);
   memset(call.results.data, 0, call.results.data_length);
-  return iree_vm_bytecode_issue_import_call(stack, call, import->results,
-                                            dst_reg_list, out_caller_frame,
-                                            out_caller_registers, out_result);
+  return iree_vm_bytecode_issue_import_call(
+      stack, module_state, import, call, import->results, dst_reg_list,
+      out_caller_frame, out_caller_registers, out_result);
 }
 
 //===----------------------------------------------------------------------===//
@@ -714,6 +811,11 @@ static iree_status_t iree_vm_bytecode_dispatch(
           .bytecode_offset;
   iree_vm_source_offset_t pc = current_frame->pc;
 
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  // Cached as it is checked on every instruction.
+  const bool profiling_enabled = IREE_IS_DISPATCH_PROFILING_ENABLED();
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+
   BEGIN_DISPATCH_CORE() {
     //===------------------------------------------------------------------===//
     // Globals
@@ -1383,14 +1485,20 @@ static iree_status_t iree_vm_bytecode_dispatch(
       const iree_vm_type_def_t* type_def = VM_DecTypeOf("result");
       bool result_is_move;
       iree_vm_ref_t* result = VM_DecResultRegRef("result", &result_is_move);
-      // TODO(benvanik): use result_is_move with a _retain_or_move.
-      IREE_RETURN_IF_ERROR(iree_vm_list_get_ref_retain(list, index, result));
-      if (result->type != IREE_VM_REF_TYPE_NULL &&
+      // NOTE: the list keeps its reference to the element so the result
+      // always needs its own. The element is borrowed first such that type
+      // mismatches don't retain only to immediately release and retaining into
+      // a register that already holds the element is free.
+      iree_vm_ref_t element = {0};
+      IREE_RETURN_IF_ERROR(iree_vm_list_get_ref_assign(list, index, &element));
+      if (element.type != IREE_VM_REF_TYPE_NULL &&
           (iree_vm_type_def_is_value(type_def) ||
-           result->type != type_def->ref_type)) {
+           element.type != type_def->ref_type)) {
         // Type mismatch; put null in the register instead.
         // TODO(benvanik): return an error here and make a query type method?
         iree_vm_ref_release(result);
+      } else {
+        iree_vm_ref_retain(&element, result);
       }
     });
 
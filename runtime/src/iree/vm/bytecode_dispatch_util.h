@@ -93,6 +93,13 @@ typedef struct iree_vm_bytecode_frame_storage_t {
   // Relative byte offsets from the head of this struct.
   iree_host_size_t i32_register_offset;
   iree_host_size_t ref_register_offset;
+
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  // Time the frame was entered or 0 if the frame is not being profiled.
+  iree_time_t profile_start_ns;
+  // Instructions executed within the frame so far.
+  int64_t profile_instruction_count;
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
 } iree_vm_bytecode_frame_storage_t;
 
 // Interleaved src-dst register sets for branch register remapping.
@@ -140,11 +147,28 @@ static inline const iree_vm_type_def_t* iree_vm_map_type(
 #define IREE_DISPATCH_TRACE_INSTRUCTION(...)
 #endif  // IREE_VM_EXECUTION_TRACING_ENABLE
 
-#if defined(IREE_COMPILER_MSVC) && !defined(IREE_COMPILER_CLANG)
-#define IREE_DISPATCH_MODE_SWITCH 1
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+#define IREE_IS_DISPATCH_PROFILING_ENABLED()  \
+  !!(iree_vm_stack_invocation_flags(stack) & \
+     IREE_VM_INVOCATION_FLAG_PROFILE_EXECUTION)
+// Counts an instruction against the current frame. Relies on the dispatch loop
+// caching whether profiling is enabled in |profiling_enabled| so that there is
+// no per-instruction lookup when profiling is compiled in but not in use.
+#define IREE_DISPATCH_PROFILE_INSTRUCTION()                               \
+  if (IREE_UNLIKELY(profiling_enabled)) {                                 \
+    ++((iree_vm_bytecode_frame_storage_t*)iree_vm_stack_frame_storage(    \
+           current_frame))                                                \
+          ->profile_instruction_count;                                    \
+  }
 #else
+#define IREE_DISPATCH_PROFILE_INSTRUCTION()
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+
+#if IREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE
 #define IREE_DISPATCH_MODE_COMPUTED_GOTO 1
-#endif  // MSVC
+#else
+#define IREE_DISPATCH_MODE_SWITCH 1
+#endif  // IREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE
 
 #ifndef NDEBUG
 #define VMCHECK(expr) assert(expr)
@@ -273,7 +297,9 @@ static inline const iree_vm_register_list_t* VM_DecVariadicOperandsImpl(
 // We support both computed goto (gcc/clang) and switch-based dispatch. Computed
 // goto is preferred when available as it has the most efficient codegen. MSVC
 // doesn't support it, though, and there may be other targets (like wasm) that
-// can only handle the switch-based approach.
+// can only handle the switch-based approach. The mode can be selected with
+// -DIREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE=0/1 in order to compare the
+// two with bytecode_module_benchmark.
 
 // Bytecode data -offset used when looking for the start of the currently
 // dispatched instruction: `instruction_start = pc - OFFSET`
@@ -346,6 +372,7 @@ static inline const iree_vm_register_list_t* VM_DecVariadicOperandsImpl(
 #define DISPATCH_OP(ext, op_name, body)                          \
   _dispatch_##ext##_##op_name:;                                  \
   IREE_DISPATCH_TRACE_INSTRUCTION(VM_PC_OFFSET_##ext, #op_name); \
+  IREE_DISPATCH_PROFILE_INSTRUCTION();                           \
   body;                                                          \
   goto* kDispatchTable_CORE[bytecode_data[pc++]];
 
@@ -382,6 +409,7 @@ static inline const iree_vm_register_list_t* VM_DecVariadicOperandsImpl(
 #define DISPATCH_OP(ext, op_name, body)                            \
   case IREE_VM_OP_##ext##_##op_name: {                             \
     IREE_DISPATCH_TRACE_INSTRUCTION(VM_PC_OFFSET_##ext, #op_name); \
+    IREE_DISPATCH_PROFILE_INSTRUCTION();                           \
     body;                                                          \
   } break;
 
@@ -6,8 +6,10 @@
 
 #include "iree/vm/bytecode_module.h"
 
+#include <inttypes.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "iree/base/api.h"
@@ -152,8 +154,8 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_parse_header(
 }
 
 // Perform an strcmp between a FlatBuffers string and an IREE string view.
-static bool iree_vm_flatbuffer_strcmp(flatbuffers_string_t lhs,
-                                      iree_string_view_t rhs) {
+static int iree_vm_flatbuffer_strcmp(flatbuffers_string_t lhs,
+                                     iree_string_view_t rhs) {
   size_t lhs_size = flatbuffers_string_len(lhs);
   int x = strncmp(lhs, rhs.data, lhs_size < rhs.size ? lhs_size : rhs.size);
   return x != 0 ? x : lhs_size < rhs.size ? -1 : lhs_size > rhs.size;
@@ -236,6 +238,28 @@ static iree_status_t iree_vm_bytecode_module_resolve_types(
   return status;
 }
 
+// Verifies that we can properly handle the bytecode embedded in the module.
+// We require that major versions match and allow loading of older minor
+// versions (we keep changes backwards-compatible). This is a property of the
+// runtime and not the module contents and as such is always checked even when
+// structural verification is skipped.
+static iree_status_t iree_vm_bytecode_module_verify_version(
+    iree_vm_BytecodeModuleDef_table_t module_def) {
+  const uint32_t bytecode_version =
+      iree_vm_BytecodeModuleDef_bytecode_version(module_def);
+  const uint32_t bytecode_version_major = bytecode_version >> 16;
+  const uint32_t bytecode_version_minor = bytecode_version & 0xFFFF;
+  if ((bytecode_version_major != IREE_VM_BYTECODE_VERSION_MAJOR) ||
+      (bytecode_version_minor > IREE_VM_BYTECODE_VERSION_MINOR)) {
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "bytecode version mismatch; runtime supports %d.%d, module has %d.%d",
+        IREE_VM_BYTECODE_VERSION_MAJOR, IREE_VM_BYTECODE_VERSION_MINOR,
+        bytecode_version_major, bytecode_version_minor);
+  }
+  return iree_ok_status();
+}
+
 // Verifies the structure of the FlatBuffer so that we can avoid doing so during
 // runtime. There are still some conditions we must be aware of (such as omitted
 // names on functions with internal linkage), however we shouldn't need to
@@ -286,6 +310,8 @@ static iree_status_t iree_vm_bytecode_module_flatbuffer_verify(
         iree_vm_RodataSegmentDef_vec_at(rodata_segments, i);
     if (iree_vm_RodataSegmentDef_embedded_data_is_present(segment)) {
       continue;  // embedded data is verified by FlatBuffers
+    } else if (iree_vm_RodataSegmentDef_parameter_data_is_present(segment)) {
+      continue;  // verified against the parameters provided on creation
     }
     uint64_t segment_offset =
         iree_vm_RodataSegmentDef_external_data_offset(segment);
@@ -348,21 +374,7 @@ static iree_status_t iree_vm_bytecode_module_flatbuffer_verify(
     }
   }
 
-  // Verify that we can properly handle the bytecode embedded in the module.
-  // We require that major versions match and allow loading of older minor
-  // versions (we keep changes backwards-compatible).
-  const uint32_t bytecode_version =
-      iree_vm_BytecodeModuleDef_bytecode_version(module_def);
-  const uint32_t bytecode_version_major = bytecode_version >> 16;
-  const uint32_t bytecode_version_minor = bytecode_version & 0xFFFF;
-  if ((bytecode_version_major != IREE_VM_BYTECODE_VERSION_MAJOR) ||
-      (bytecode_version_minor > IREE_VM_BYTECODE_VERSION_MINOR)) {
-    return iree_make_status(
-        IREE_STATUS_INVALID_ARGUMENT,
-        "bytecode version mismatch; runtime supports %d.%d, module has %d.%d",
-        IREE_VM_BYTECODE_VERSION_MAJOR, IREE_VM_BYTECODE_VERSION_MINOR,
-        bytecode_version_major, bytecode_version_minor);
-  }
+  IREE_RETURN_IF_ERROR(iree_vm_bytecode_module_verify_version(module_def));
 
   flatbuffers_uint8_vec_t bytecode_data =
       iree_vm_BytecodeModuleDef_bytecode_data(module_def);
@@ -438,11 +450,18 @@ static void iree_vm_bytecode_module_destroy(void* self) {
   iree_vm_bytecode_module_t* module = (iree_vm_bytecode_module_t*)self;
   IREE_TRACE_ZONE_BEGIN(z0);
 
+  iree_vm_module_release(module->native_module);
+  module->native_module = NULL;
+
   module->def = NULL;
   iree_allocator_free(module->archive_allocator,
                       (void*)module->archive_contents.data);
   module->archive_contents = iree_const_byte_span_empty();
   module->archive_allocator = iree_allocator_null();
+  iree_allocator_free(module->parameter_allocator,
+                      (void*)module->parameter_contents.data);
+  module->parameter_contents = iree_const_byte_span_empty();
+  module->parameter_allocator = iree_allocator_null();
 
   iree_allocator_free(module->allocator, module);
 
@@ -524,7 +543,6 @@ static iree_status_t iree_vm_bytecode_module_lookup_function(
   out_function->linkage = linkage;
   out_function->module = &module->interface;
 
-  // NOTE: we could organize exports alphabetically so we could bsearch.
   if (linkage == IREE_VM_FUNCTION_LINKAGE_IMPORT ||
       linkage == IREE_VM_FUNCTION_LINKAGE_IMPORT_OPTIONAL) {
     iree_vm_ImportFunctionDef_vec_t imported_functions =
@@ -545,11 +563,26 @@ static iree_status_t iree_vm_bytecode_module_lookup_function(
       }
     }
   } else if (linkage == IREE_VM_FUNCTION_LINKAGE_EXPORT) {
+    // Find the first export in name order that is not less than |name|.
     iree_vm_ExportFunctionDef_vec_t exported_functions =
         iree_vm_BytecodeModuleDef_exported_functions(module->def);
-    for (iree_host_size_t ordinal = 0;
-         ordinal < iree_vm_ExportFunctionDef_vec_len(exported_functions);
-         ++ordinal) {
+    iree_host_size_t low = 0;
+    iree_host_size_t high =
+        iree_vm_ExportFunctionDef_vec_len(exported_functions);
+    while (low < high) {
+      iree_host_size_t mid = low + (high - low) / 2;
+      iree_vm_ExportFunctionDef_table_t export_def =
+          iree_vm_ExportFunctionDef_vec_at(exported_functions,
+                                           module->export_name_index[mid]);
+      if (iree_vm_flatbuffer_strcmp(
+              iree_vm_ExportFunctionDef_local_name(export_def), name) < 0) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    if (low < iree_vm_ExportFunctionDef_vec_len(exported_functions)) {
+      uint16_t ordinal = module->export_name_index[low];
       iree_vm_ExportFunctionDef_table_t export_def =
           iree_vm_ExportFunctionDef_vec_at(exported_functions, ordinal);
       if (iree_vm_flatbuffer_strcmp(
@@ -891,6 +924,24 @@ static iree_host_size_t iree_vm_bytecode_module_layout_state(
   offset +=
       iree_host_align(import_function_count * sizeof(*state->import_table), 16);
 
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  iree_host_size_t function_count = iree_vm_FunctionDescriptor_vec_len(
+      iree_vm_BytecodeModuleDef_function_descriptors(module_def));
+  if (state) {
+    state->function_profile_count = function_count;
+    state->function_profile_table =
+        (iree_vm_bytecode_profile_counters_t*)(base_ptr + offset);
+  }
+  offset += iree_host_align(
+      function_count * sizeof(iree_vm_bytecode_profile_counters_t), 16);
+  if (state) {
+    state->import_profile_table =
+        (iree_vm_bytecode_profile_counters_t*)(base_ptr + offset);
+  }
+  offset += iree_host_align(
+      import_function_count * sizeof(iree_vm_bytecode_profile_counters_t), 16);
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+
   return offset;
 }
 
@@ -931,6 +982,15 @@ static iree_status_t iree_vm_bytecode_module_alloc_state(
           (uint8_t*)iree_vm_RodataSegmentDef_embedded_data(segment),
           flatbuffers_uint8_vec_len(
               iree_vm_RodataSegmentDef_embedded_data(segment)));
+    } else if (iree_vm_RodataSegmentDef_parameter_data_is_present(segment)) {
+      // Data is in the parameter archive.
+      // Note that we've already verified the referenced range is in bounds.
+      iree_vm_ParameterDataDef_table_t parameter_def =
+          iree_vm_RodataSegmentDef_parameter_data(segment);
+      byte_span = iree_make_byte_span(
+          (uint8_t*)module->parameter_contents.data +
+              iree_vm_ParameterDataDef_offset(parameter_def),
+          iree_vm_ParameterDataDef_length(parameter_def));
     } else {
       // Data is concatenated with the FlatBuffer at some relative offset.
       // Note that we've already verified the referenced range is in bounds.
@@ -1015,6 +1075,15 @@ static iree_status_t iree_vm_bytecode_module_resolve_import(
   import->argument_buffer_size = (uint16_t)argument_buffer_size;
   import->result_buffer_size = (uint16_t)result_buffer_size;
 
+  // Cache the target function pointer if the import can be called directly.
+  // Most imports are to native modules (like the HAL) and this avoids the
+  // generic call routing on each invocation.
+  import->native_function_ptr = NULL;
+  if (function->linkage == IREE_VM_FUNCTION_LINKAGE_EXPORT) {
+    iree_status_ignore(iree_vm_native_module_lookup_function_ptr(
+        function->module, function->ordinal, &import->native_function_ptr));
+  }
+
   return iree_ok_status();
 }
 
@@ -1088,9 +1157,335 @@ static iree_status_t iree_vm_bytecode_module_resume_call(
                                           out_result);  // tail
 }
 
+//===----------------------------------------------------------------------===//
+// Ahead-of-time native implementation routing
+//===----------------------------------------------------------------------===//
+// When a native module is attached the bytecode module keeps serving
+// reflection (names, signatures, attributes) from the FlatBuffer and forwards
+// everything that touches module state or executes code to the native module.
+// Module state is allocated by the native module and the context associates it
+// with the bytecode module such that stack frames pushed by the native module
+// (which reference the bytecode module functions) resolve to it.
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_module_native_alloc_state(
+    void* self, iree_allocator_t allocator,
+    iree_vm_module_state_t** out_module_state) {
+  iree_vm_module_t* native_module =
+      ((iree_vm_bytecode_module_t*)self)->native_module;
+  return native_module->alloc_state(native_module->self, allocator,
+                                    out_module_state);
+}
+
+static void IREE_API_PTR iree_vm_bytecode_module_native_free_state(
+    void* self, iree_vm_module_state_t* module_state) {
+  iree_vm_module_t* native_module =
+      ((iree_vm_bytecode_module_t*)self)->native_module;
+  native_module->free_state(native_module->self, module_state);
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_module_native_resolve_import(
+    void* self, iree_vm_module_state_t* module_state, iree_host_size_t ordinal,
+    const iree_vm_function_t* function,
+    const iree_vm_function_signature_t* signature) {
+  iree_vm_module_t* native_module =
+      ((iree_vm_bytecode_module_t*)self)->native_module;
+  return native_module->resolve_import(native_module->self, module_state,
+                                       ordinal, function, signature);
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_module_native_notify(
+    void* self, iree_vm_module_state_t* module_state, iree_vm_signal_t signal) {
+  iree_vm_module_t* native_module =
+      ((iree_vm_bytecode_module_t*)self)->native_module;
+  return native_module->notify(native_module->self, module_state, signal);
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_module_native_begin_call(
+    void* self, iree_vm_stack_t* stack, const iree_vm_function_call_t* call,
+    iree_vm_execution_result_t* out_result) {
+  iree_vm_module_t* native_module =
+      ((iree_vm_bytecode_module_t*)self)->native_module;
+  return native_module->begin_call(native_module->self, stack, call,
+                                   out_result);  // tail
+}
+
+static iree_status_t IREE_API_PTR iree_vm_bytecode_module_native_resume_call(
+    void* self, iree_vm_stack_t* stack, iree_byte_span_t call_results,
+    iree_vm_execution_result_t* out_result) {
+  iree_vm_module_t* native_module =
+      ((iree_vm_bytecode_module_t*)self)->native_module;
+  return native_module->resume_call(native_module->self, stack, call_results,
+                                    out_result);  // tail
+}
+
+// Verifies that all functions of |linkage| in |native_module| match those in
+// the bytecode |module| by ordinal and name.
+static iree_status_t iree_vm_bytecode_module_verify_native_functions(
+    iree_vm_module_t* module, iree_vm_module_t* native_module,
+    iree_vm_function_linkage_t linkage, iree_host_size_t function_count) {
+  for (iree_host_size_t i = 0; i < function_count; ++i) {
+    iree_vm_function_t function;
+    IREE_RETURN_IF_ERROR(iree_vm_module_lookup_function_by_ordinal(
+        module, linkage, i, &function));
+    iree_vm_function_t native_function;
+    IREE_RETURN_IF_ERROR(iree_vm_module_lookup_function_by_ordinal(
+        native_module, linkage, i, &native_function));
+    iree_string_view_t name = iree_vm_function_name(&function);
+    iree_string_view_t native_name = iree_vm_function_name(&native_function);
+    if (!iree_string_view_equal(name, native_name)) {
+      return iree_make_status(
+          IREE_STATUS_INVALID_ARGUMENT,
+          "native module function %zu does not match the bytecode module; "
+          "expected '%.*s' but got '%.*s'",
+          i, (int)name.size, name.data, (int)native_name.size,
+          native_name.data);
+    }
+  }
+  return iree_ok_status();
+}
+
+// Verifies that |native_module| implements the same module as the bytecode
+// |module| such that imports and exports line up by ordinal.
+static iree_status_t iree_vm_bytecode_module_verify_native(
+    iree_vm_module_t* module, iree_vm_module_t* native_module) {
+  iree_string_view_t name = iree_vm_module_name(module);
+  iree_string_view_t native_name = iree_vm_module_name(native_module);
+  if (!iree_string_view_equal(name, native_name)) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "native module '%.*s' does not implement bytecode "
+                            "module '%.*s'",
+                            (int)native_name.size, native_name.data,
+                            (int)name.size, name.data);
+  }
+  iree_vm_module_signature_t signature = iree_vm_module_signature(module);
+  iree_vm_module_signature_t native_signature =
+      iree_vm_module_signature(native_module);
+  if (signature.import_function_count !=
+          native_signature.import_function_count ||
+      signature.export_function_count !=
+          native_signature.export_function_count) {
+    return iree_make_status(
+        IREE_STATUS_INVALID_ARGUMENT,
+        "native module '%.*s' signature mismatch; bytecode has %zu imports and "
+        "%zu exports but the native module has %zu imports and %zu exports",
+        (int)name.size, name.data, signature.import_function_count,
+        signature.export_function_count,
+        native_signature.import_function_count,
+        native_signature.export_function_count);
+  }
+  IREE_RETURN_IF_ERROR(iree_vm_bytecode_module_verify_native_functions(
+      module, native_module, IREE_VM_FUNCTION_LINKAGE_IMPORT,
+      signature.import_function_count));
+  return iree_vm_bytecode_module_verify_native_functions(
+      module, native_module, IREE_VM_FUNCTION_LINKAGE_EXPORT,
+      signature.export_function_count);
+}
+
+// Verifies the archive unless |verification_cache| indicates it has already
+// passed verification.
+static iree_status_t iree_vm_bytecode_module_verify(
+    iree_const_byte_span_t archive_contents,
+    iree_const_byte_span_t flatbuffer_contents,
+    iree_host_size_t archive_rodata_offset,
+    const iree_vm_bytecode_module_verification_cache_t* verification_cache) {
+  if (verification_cache &&
+      verification_cache->lookup(verification_cache->self, archive_contents)) {
+    // Previously verified; the root must still be present for us to use it.
+    iree_vm_BytecodeModuleDef_table_t module_def =
+        iree_vm_BytecodeModuleDef_as_root(flatbuffer_contents.data);
+    if (!module_def) {
+      return iree_make_status(
+          IREE_STATUS_INVALID_ARGUMENT,
+          "failed getting root from FlatBuffer; expected identifier "
+          "'" iree_vm_BytecodeModuleDef_file_identifier "' not found");
+    }
+    return iree_vm_bytecode_module_verify_version(module_def);
+  }
+
+  IREE_TRACE_ZONE_BEGIN_NAMED(z0, "iree_vm_bytecode_module_flatbuffer_verify");
+  iree_status_t status = iree_vm_bytecode_module_flatbuffer_verify(
+      archive_contents, flatbuffer_contents, archive_rodata_offset);
+  if (iree_status_is_ok(status) && verification_cache) {
+    verification_cache->insert(verification_cache->self, archive_contents);
+  }
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
+// Verifies that all parameter data referenced by |module_def| is in range of
+// |parameter_contents|. This is always performed (even if the verification
+// cache indicates the module archive is trusted) as the parameters are
+// provided independently of the module.
+static iree_status_t iree_vm_bytecode_module_verify_parameters(
+    iree_vm_BytecodeModuleDef_table_t module_def,
+    iree_const_byte_span_t parameter_contents) {
+  iree_vm_RodataSegmentDef_vec_t rodata_segments =
+      iree_vm_BytecodeModuleDef_rodata_segments(module_def);
+  for (size_t i = 0; i < iree_vm_RodataSegmentDef_vec_len(rodata_segments);
+       ++i) {
+    iree_vm_RodataSegmentDef_table_t segment =
+        iree_vm_RodataSegmentDef_vec_at(rodata_segments, i);
+    if (!iree_vm_RodataSegmentDef_parameter_data_is_present(segment)) continue;
+    if (!parameter_contents.data) {
+      flatbuffers_string_t name =
+          iree_vm_BytecodeModuleDef_parameter_archive(module_def);
+      return iree_make_status(
+          IREE_STATUS_FAILED_PRECONDITION,
+          "rodata[%zu] references parameter archive '%.*s' but no parameters "
+          "were provided",
+          i, (int)flatbuffers_string_len(name), name);
+    }
+    iree_vm_ParameterDataDef_table_t parameter_def =
+        iree_vm_RodataSegmentDef_parameter_data(segment);
+    uint64_t offset = iree_vm_ParameterDataDef_offset(parameter_def);
+    uint64_t length = iree_vm_ParameterDataDef_length(parameter_def);
+    if (offset > parameter_contents.data_length ||
+        length > parameter_contents.data_length - offset) {
+      return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                              "rodata[%zu] parameter reference out of range "
+                              "(offset %" PRIu64 ", length %" PRIu64
+                              ", parameter archive size %zu)",
+                              i, offset, length,
+                              (size_t)parameter_contents.data_length);
+    }
+  }
+  return iree_ok_status();
+}
+
+typedef struct iree_vm_bytecode_export_name_t {
+  flatbuffers_string_t name;
+  uint16_t ordinal;
+} iree_vm_bytecode_export_name_t;
+
+static int iree_vm_bytecode_export_name_compare(const void* lhs_ptr,
+                                                const void* rhs_ptr) {
+  const iree_vm_bytecode_export_name_t* lhs =
+      (const iree_vm_bytecode_export_name_t*)lhs_ptr;
+  const iree_vm_bytecode_export_name_t* rhs =
+      (const iree_vm_bytecode_export_name_t*)rhs_ptr;
+  int x = iree_vm_flatbuffer_strcmp(
+      lhs->name,
+      iree_make_string_view(rhs->name, flatbuffers_string_len(rhs->name)));
+  // Ties are broken by ordinal so lookups find the first matching export.
+  return x != 0 ? x : (int)lhs->ordinal - (int)rhs->ordinal;
+}
+
+// Builds an index of the ordinals of |exported_functions| sorted by name into
+// |out_index|. Names are referenced in place and only the ordinals are stored.
+static iree_status_t iree_vm_bytecode_module_build_export_name_index(
+    iree_vm_ExportFunctionDef_vec_t exported_functions,
+    iree_allocator_t allocator, uint16_t* out_index) {
+  iree_host_size_t export_count =
+      iree_vm_ExportFunctionDef_vec_len(exported_functions);
+  if (export_count == 0) return iree_ok_status();
+  if (export_count > UINT16_MAX) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "too many exports (%zu > %u)", export_count,
+                            UINT16_MAX);
+  }
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE_I64(z0, (int64_t)export_count);
+
+  iree_vm_bytecode_export_name_t* names = NULL;
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_allocator_malloc(allocator, export_count * sizeof(*names),
+                                (void**)&names));
+  for (iree_host_size_t i = 0; i < export_count; ++i) {
+    names[i].name = iree_vm_ExportFunctionDef_local_name(
+        iree_vm_ExportFunctionDef_vec_at(exported_functions, i));
+    names[i].ordinal = (uint16_t)i;
+  }
+  qsort(names, export_count, sizeof(*names),
+        iree_vm_bytecode_export_name_compare);
+  for (iree_host_size_t i = 0; i < export_count; ++i) {
+    out_index[i] = names[i].ordinal;
+  }
+  iree_allocator_free(allocator, names);
+
+  IREE_TRACE_ZONE_END(z0);
+  return iree_ok_status();
+}
+
+static iree_status_t iree_vm_bytecode_module_create_impl(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_const_byte_span_t parameter_contents,
+    iree_allocator_t parameter_allocator, iree_vm_module_t* native_module,
+    const iree_vm_bytecode_module_verification_cache_t* verification_cache,
+    iree_allocator_t allocator, iree_vm_module_t** out_module);
+
 IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
     iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
     iree_allocator_t allocator, iree_vm_module_t** out_module) {
+  return iree_vm_bytecode_module_create_impl(
+      archive_contents, archive_allocator, iree_const_byte_span_empty(),
+      iree_allocator_null(), /*native_module=*/NULL,
+      /*verification_cache=*/NULL, allocator, out_module);
+}
+
+IREE_API_EXPORT iree_status_t
+iree_vm_bytecode_module_create_with_verification_cache(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    const iree_vm_bytecode_module_verification_cache_t* verification_cache,
+    iree_allocator_t allocator, iree_vm_module_t** out_module) {
+  IREE_ASSERT_ARGUMENT(verification_cache);
+  return iree_vm_bytecode_module_create_impl(
+      archive_contents, archive_allocator, iree_const_byte_span_empty(),
+      iree_allocator_null(), /*native_module=*/NULL, verification_cache,
+      allocator, out_module);
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create_with_native(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_vm_module_t* native_module, iree_allocator_t allocator,
+    iree_vm_module_t** out_module) {
+  return iree_vm_bytecode_module_create_impl(
+      archive_contents, archive_allocator, iree_const_byte_span_empty(),
+      iree_allocator_null(), native_module,
+      /*verification_cache=*/NULL, allocator, out_module);
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create_with_parameters(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_const_byte_span_t parameter_contents,
+    iree_allocator_t parameter_allocator, iree_allocator_t allocator,
+    iree_vm_module_t** out_module) {
+  return iree_vm_bytecode_module_create_impl(
+      archive_contents, archive_allocator, parameter_contents,
+      parameter_allocator, /*native_module=*/NULL,
+      /*verification_cache=*/NULL, allocator, out_module);
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_query_parameter_archive(
+    iree_const_byte_span_t archive_contents, iree_string_view_t* out_name) {
+  IREE_ASSERT_ARGUMENT(out_name);
+  *out_name = iree_string_view_empty();
+  iree_const_byte_span_t flatbuffer_contents = iree_const_byte_span_empty();
+  IREE_RETURN_IF_ERROR(iree_vm_bytecode_module_parse_header(
+      archive_contents, &flatbuffer_contents, /*out_rodata_offset=*/NULL));
+  // Only the root table is accessed so a full verification is not required.
+  int verify_ret = iree_vm_BytecodeModuleDef_verify_as_root(
+      flatbuffer_contents.data, flatbuffer_contents.data_length);
+  if (verify_ret != flatcc_verify_ok) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "FlatBuffer verification failed: %s",
+                            flatcc_verify_error_string(verify_ret));
+  }
+  iree_vm_BytecodeModuleDef_table_t module_def =
+      iree_vm_BytecodeModuleDef_as_root(flatbuffer_contents.data);
+  flatbuffers_string_t name =
+      iree_vm_BytecodeModuleDef_parameter_archive(module_def);
+  if (name) {
+    *out_name = iree_make_string_view(name, flatbuffers_string_len(name));
+  }
+  return iree_ok_status();
+}
+
+static iree_status_t iree_vm_bytecode_module_create_impl(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_const_byte_span_t parameter_contents,
+    iree_allocator_t parameter_allocator, iree_vm_module_t* native_module,
+    const iree_vm_bytecode_module_verification_cache_t* verification_cache,
+    iree_allocator_t allocator, iree_vm_module_t** out_module) {
   IREE_TRACE_ZONE_BEGIN(z0);
   IREE_ASSERT_ARGUMENT(out_module);
   *out_module = NULL;
@@ -1102,15 +1497,10 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
       z0, iree_vm_bytecode_module_parse_header(
               archive_contents, &flatbuffer_contents, &archive_rodata_offset));
 
-  IREE_TRACE_ZONE_BEGIN_NAMED(z1, "iree_vm_bytecode_module_flatbuffer_verify");
-  iree_status_t status = iree_vm_bytecode_module_flatbuffer_verify(
-      archive_contents, flatbuffer_contents, archive_rodata_offset);
-  if (!iree_status_is_ok(status)) {
-    IREE_TRACE_ZONE_END(z1);
-    IREE_TRACE_ZONE_END(z0);
-    return status;
-  }
-  IREE_TRACE_ZONE_END(z1);
+  IREE_RETURN_AND_END_ZONE_IF_ERROR(
+      z0, iree_vm_bytecode_module_verify(archive_contents, flatbuffer_contents,
+                                         archive_rodata_offset,
+                                         verification_cache));
 
   iree_vm_BytecodeModuleDef_table_t module_def =
       iree_vm_BytecodeModuleDef_as_root(flatbuffer_contents.data);
@@ -1122,16 +1512,40 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
         "'" iree_vm_BytecodeModuleDef_file_identifier "' not found");
   }
 
+  // Native modules embed their own rodata and don't need the parameters.
+  if (!native_module) {
+    IREE_RETURN_AND_END_ZONE_IF_ERROR(
+        z0, iree_vm_bytecode_module_verify_parameters(module_def,
+                                                      parameter_contents));
+  }
+
   iree_vm_TypeDef_vec_t type_defs = iree_vm_BytecodeModuleDef_types(module_def);
   size_t type_table_size =
       iree_vm_TypeDef_vec_len(type_defs) * sizeof(iree_vm_type_def_t);
+  iree_vm_ExportFunctionDef_vec_t exported_functions =
+      iree_vm_BytecodeModuleDef_exported_functions(module_def);
+  size_t export_name_index_size =
+      iree_vm_ExportFunctionDef_vec_len(exported_functions) * sizeof(uint16_t);
 
   iree_vm_bytecode_module_t* module = NULL;
   IREE_RETURN_AND_END_ZONE_IF_ERROR(
-      z0, iree_allocator_malloc(allocator, sizeof(*module) + type_table_size,
-                                (void**)&module));
+      z0, iree_allocator_malloc(
+              allocator,
+              sizeof(*module) + type_table_size + export_name_index_size,
+              (void**)&module));
   module->allocator = allocator;
 
+  uint16_t* export_name_index =
+      (uint16_t*)((uint8_t*)module->type_table + type_table_size);
+  iree_status_t index_status = iree_vm_bytecode_module_build_export_name_index(
+      exported_functions, allocator, export_name_index);
+  if (!iree_status_is_ok(index_status)) {
+    iree_allocator_free(allocator, module);
+    IREE_TRACE_ZONE_END(z0);
+    return index_status;
+  }
+  module->export_name_index = export_name_index;
+
   iree_vm_FunctionDescriptor_vec_t function_descriptors =
       iree_vm_BytecodeModuleDef_function_descriptors(module_def);
   module->function_descriptor_count =
@@ -1146,6 +1560,8 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
   module->archive_contents = archive_contents;
   module->archive_allocator = archive_allocator;
   module->archive_rodata_offset = archive_rodata_offset;
+  module->parameter_contents = parameter_contents;
+  module->parameter_allocator = parameter_allocator;
   module->def = module_def;
 
   module->type_count = iree_vm_TypeDef_vec_len(type_defs);
@@ -1177,7 +1593,119 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
   module->interface.begin_call = iree_vm_bytecode_module_begin_call;
   module->interface.resume_call = iree_vm_bytecode_module_resume_call;
 
+  if (native_module) {
+    iree_status_t status = iree_vm_bytecode_module_verify_native(
+        &module->interface, native_module);
+    if (!iree_status_is_ok(status)) {
+      // NOTE: the caller retains ownership of the archive on failure.
+      iree_allocator_free(allocator, module);
+      IREE_TRACE_ZONE_END(z0);
+      return status;
+    }
+    module->native_module = native_module;
+    iree_vm_module_retain(native_module);
+    // Source locations are only available for bytecode frames.
+    module->interface.resolve_source_location = NULL;
+    module->interface.alloc_state = iree_vm_bytecode_module_native_alloc_state;
+    module->interface.free_state = iree_vm_bytecode_module_native_free_state;
+    module->interface.resolve_import =
+        iree_vm_bytecode_module_native_resolve_import;
+    module->interface.notify = iree_vm_bytecode_module_native_notify;
+    module->interface.begin_call = iree_vm_bytecode_module_native_begin_call;
+    module->interface.resume_call = iree_vm_bytecode_module_native_resume_call;
+  }
+
   *out_module = &module->interface;
   IREE_TRACE_ZONE_END(z0);
   return iree_ok_status();
 }
+
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_append_profile(
+    iree_vm_module_t* module, iree_vm_context_t* context,
+    iree_string_builder_t* builder) {
+  IREE_ASSERT_ARGUMENT(module);
+  IREE_ASSERT_ARGUMENT(context);
+  IREE_ASSERT_ARGUMENT(builder);
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  if (module->destroy != iree_vm_bytecode_module_destroy) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "module is not a bytecode module");
+  }
+  iree_vm_bytecode_module_t* bytecode_module =
+      (iree_vm_bytecode_module_t*)module->self;
+  if (bytecode_module->native_module) {
+    return iree_make_status(IREE_STATUS_UNAVAILABLE,
+                            "profiling is not available for bytecode modules "
+                            "executing natively");
+  }
+  iree_vm_module_state_t* module_state = NULL;
+  IREE_RETURN_IF_ERROR(
+      iree_vm_context_resolve_module_state(context, module, &module_state));
+  iree_vm_bytecode_module_state_t* state =
+      (iree_vm_bytecode_module_state_t*)module_state;
+  IREE_TRACE_ZONE_BEGIN(z0);
+
+  iree_string_view_t module_name = iree_vm_module_name(module);
+  iree_status_t status = iree_string_builder_append_cstring(
+      builder, "# function,calls,instructions,total_ns\n");
+  for (iree_host_size_t i = 0;
+       i < state->function_profile_count && iree_status_is_ok(status); ++i) {
+    iree_vm_bytecode_profile_counters_t* profile =
+        &state->function_profile_table[i];
+    int64_t call_count =
+        iree_atomic_load_int64(&profile->call_count, iree_memory_order_relaxed);
+    if (!call_count) continue;
+    iree_string_view_t function_name = iree_string_view_empty();
+    IREE_IGNORE_ERROR(iree_vm_bytecode_module_get_function(
+        bytecode_module, IREE_VM_FUNCTION_LINKAGE_INTERNAL, i,
+        /*out_function=*/NULL, &function_name, /*out_signature=*/NULL));
+    if (iree_string_view_is_empty(function_name)) {
+      status = iree_string_builder_append_format(
+          builder, "%.*s.<internal %zu>", (int)module_name.size,
+          module_name.data, i);
+    } else {
+      status = iree_string_builder_append_format(
+          builder, "%.*s.%.*s", (int)module_name.size, module_name.data,
+          (int)function_name.size, function_name.data);
+    }
+    if (iree_status_is_ok(status)) {
+      status = iree_string_builder_append_format(
+          builder, ",%" PRIi64 ",%" PRIi64 ",%" PRIi64 "\n", call_count,
+          iree_atomic_load_int64(&profile->instruction_count,
+                                 iree_memory_order_relaxed),
+          iree_atomic_load_int64(&profile->total_time_ns,
+                                 iree_memory_order_relaxed));
+    }
+  }
+
+  if (iree_status_is_ok(status)) {
+    status = iree_string_builder_append_cstring(
+        builder, "# import,calls,total_ns\n");
+  }
+  for (iree_host_size_t i = 0;
+       i < state->import_count && iree_status_is_ok(status); ++i) {
+    iree_vm_bytecode_profile_counters_t* profile =
+        &state->import_profile_table[i];
+    int64_t call_count =
+        iree_atomic_load_int64(&profile->call_count, iree_memory_order_relaxed);
+    if (!call_count) continue;
+    iree_string_view_t import_name = iree_string_view_empty();
+    IREE_IGNORE_ERROR(iree_vm_bytecode_module_get_function(
+        bytecode_module, IREE_VM_FUNCTION_LINKAGE_IMPORT, i,
+        /*out_function=*/NULL, &import_name, /*out_signature=*/NULL));
+    status = iree_string_builder_append_format(
+        builder, "%.*s,%" PRIi64 ",%" PRIi64 "\n", (int)import_name.size,
+        import_name.data, call_count,
+        iree_atomic_load_int64(&profile->total_time_ns,
+                               iree_memory_order_relaxed));
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+#else
+  return iree_make_status(
+      IREE_STATUS_UNAVAILABLE,
+      "profiling support not compiled in; build with "
+      "-DIREE_VM_EXECUTION_PROFILING_ENABLE=1");
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+}
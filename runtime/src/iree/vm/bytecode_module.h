@@ -24,6 +24,99 @@ IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create(
     iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
     iree_allocator_t allocator, iree_vm_module_t** out_module);
 
+// Host-provided cache of module archives that have previously passed
+// verification. Verifying the FlatBuffer structure of large modules can be a
+// significant part of load time and hosts that load the same trusted archives
+// repeatedly (such as across process launches) can use this to skip it.
+//
+// The cache decides how archives are identified: hosts may compare a content
+// digest produced when the archive was built or installed, a file identity, or
+// a hash of |archive_contents| computed at lookup. Returning true from |lookup|
+// for contents that were never verified (or that have been modified since)
+// bypasses the safety checks that allow the runtime to avoid bounds checking
+// the module during execution and must only be done for trusted archives.
+typedef struct iree_vm_bytecode_module_verification_cache_t {
+  // User-defined pointer passed to all functions.
+  void* self;
+  // Returns true if |archive_contents| is known to have passed verification.
+  bool(IREE_API_PTR* lookup)(void* self,
+                             iree_const_byte_span_t archive_contents);
+  // Records that |archive_contents| has passed verification.
+  void(IREE_API_PTR* insert)(void* self,
+                             iree_const_byte_span_t archive_contents);
+} iree_vm_bytecode_module_verification_cache_t;
+
+// Creates a VM module from an in-memory ModuleDef FlatBuffer archive as with
+// iree_vm_bytecode_module_create. FlatBuffer verification is skipped if
+// |verification_cache| reports that the archive has been verified before and
+// otherwise the archive is verified and inserted into the cache on success.
+// The archive header and bytecode version are always checked.
+IREE_API_EXPORT iree_status_t
+iree_vm_bytecode_module_create_with_verification_cache(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    const iree_vm_bytecode_module_verification_cache_t* verification_cache,
+    iree_allocator_t allocator, iree_vm_module_t** out_module);
+
+// Creates a VM module from an in-memory ModuleDef FlatBuffer archive that
+// executes using |native_module|, an ahead-of-time compiled implementation of
+// the same vm.module such as one produced by the C target and loaded from a
+// shared library next to the archive. Reflection metadata is provided by the
+// archive while all state and execution is handled natively, removing the
+// interpreter overhead. |native_module| is retained by the returned module.
+//
+// Fails if |native_module| does not implement the same module (by name and
+// with matching import and export functions at each ordinal). On failure the
+// ownership of |archive_contents| remains with the caller. Any parameter
+// archive referenced by |archive_contents| is not needed as native modules
+// embed all of their rodata.
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create_with_native(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_vm_module_t* native_module, iree_allocator_t allocator,
+    iree_vm_module_t** out_module);
+
+// Queries the file name of the parameter archive referenced by the module in
+// |archive_contents|, relative to the module file. Returns an empty string if
+// all of the module data is contained within the archive. The returned string
+// references the archive memory and is only valid while it is live.
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_query_parameter_archive(
+    iree_const_byte_span_t archive_contents, iree_string_view_t* out_name);
+
+// Creates a VM module from an in-memory ModuleDef FlatBuffer archive as with
+// iree_vm_bytecode_module_create that references read-only data stored in the
+// separate |parameter_contents| archive (as produced by the compiler with
+// --iree-vm-bytecode-module-parameter-archive=). Parameter data is used
+// in-place and |parameter_contents| should be mapped from the file such that
+// the pages can be shared across processes and are only paged in on use.
+// If a |parameter_allocator| is provided then it will be used to free the
+// |parameter_contents| when the module is destroyed.
+//
+// Fails if any parameter data referenced by the module is out of range. On
+// failure the ownership of both |archive_contents| and |parameter_contents|
+// remains with the caller.
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_create_with_parameters(
+    iree_const_byte_span_t archive_contents, iree_allocator_t archive_allocator,
+    iree_const_byte_span_t parameter_contents,
+    iree_allocator_t parameter_allocator, iree_allocator_t allocator,
+    iree_vm_module_t** out_module);
+
+// Appends the execution profile of |module| within |context| to |builder|.
+// Profiles are collected for invocations made with
+// IREE_VM_INVOCATION_FLAG_PROFILE_EXECUTION or within contexts created with
+// IREE_VM_CONTEXT_FLAG_PROFILE_EXECUTION and include every function and import
+// called at least once. The output is two comma-separated tables, each
+// preceded by a `#`-prefixed header line:
+//   # function,calls,instructions,total_ns
+//   module.fn,2,120,4100
+//   # import,calls,total_ns
+//   hal.buffer_view.create,1,350
+// Instruction counts exclude callees while times include them.
+//
+// Returns IREE_STATUS_UNAVAILABLE if the runtime was not built with
+// -DIREE_VM_EXECUTION_PROFILING_ENABLE=1 or if |module| executes natively.
+IREE_API_EXPORT iree_status_t iree_vm_bytecode_module_append_profile(
+    iree_vm_module_t* module, iree_vm_context_t* context,
+    iree_string_builder_t* builder);
+
 // Parses the module archive header in |archive_contents|.
 // The subrange containing the FlatBuffer data is returned as well as the
 // offset where external rodata begins. Note that archives may have
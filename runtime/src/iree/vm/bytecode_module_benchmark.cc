@@ -298,6 +298,40 @@ static void BM_LoopSumBytecode(benchmark::State& state) {
 }
 BENCHMARK(BM_LoopSumBytecode)->Arg(100000);
 
+static void BM_LoopBranchyReference(benchmark::State& state) {
+  static auto loop = +[](int count) {
+    int acc = 0;
+    for (int i = 0; i < count; ++i) {
+      benchmark::DoNotOptimize(i);
+      if (i & 1) {
+        acc += 3;
+      } else {
+        acc -= 1;
+      }
+      benchmark::DoNotOptimize(acc);
+    }
+    return acc;
+  };
+  while (state.KeepRunningBatch(state.range(0))) {
+    int ret = loop(static_cast<int>(state.range(0)));
+    benchmark::DoNotOptimize(ret);
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_LoopBranchyReference)->Arg(100000);
+
+// Comparing this against a build with
+// -DIREE_VM_BYTECODE_DISPATCH_COMPUTED_GOTO_ENABLE=0 shows the benefit of the
+// computed goto dispatch on control-heavy bytecode.
+static void BM_LoopBranchyBytecode(benchmark::State& state) {
+  IREE_CHECK_OK(RunFunction(
+      state, iree_make_cstring_view("bytecode_module_benchmark.loop_branchy"),
+      {static_cast<int32_t>(state.range(0))},
+      /*result_count=*/1,
+      /*batch_size=*/state.range(0)));
+}
+BENCHMARK(BM_LoopBranchyBytecode)->Arg(100000);
+
 static void BM_BufferReduceReference(benchmark::State& state) {
   static auto work = +[](int32_t* buffer, int i, int sum) {
     int new_sum = buffer[i] + sum;
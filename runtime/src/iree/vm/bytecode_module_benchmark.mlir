@@ -77,6 +77,32 @@ vm.module @bytecode_module_benchmark {
     vm.return %ie : i32
   }
 
+  // Measures the cost of control flow with a data-dependent branch per
+  // iteration. Control-heavy functions like this are dominated by dispatch
+  // overhead and are the most sensitive to the interpreter dispatch mode.
+  vm.export @loop_branchy
+  vm.func @loop_branchy(%count : i32) -> i32 {
+    %c1 = vm.const.i32 1
+    %c3 = vm.const.i32 3
+    %c0 = vm.const.i32.zero
+    vm.br ^loop(%c0, %c0 : i32, i32)
+  ^loop(%i : i32, %acc : i32):
+    %odd = vm.and.i32 %i, %c1 : i32
+    vm.cond_br %odd, ^loop_odd(%acc : i32), ^loop_even(%acc : i32)
+  ^loop_odd(%acc_odd : i32):
+    %acc_odd_next = vm.add.i32 %acc_odd, %c3 : i32
+    vm.br ^loop_latch(%acc_odd_next : i32)
+  ^loop_even(%acc_even : i32):
+    %acc_even_next = vm.sub.i32 %acc_even, %c1 : i32
+    vm.br ^loop_latch(%acc_even_next : i32)
+  ^loop_latch(%acc_next : i32):
+    %in = vm.add.i32 %i, %c1 : i32
+    %cmp = vm.cmp.lt.i32.s %in, %count : i32
+    vm.cond_br %cmp, ^loop(%in, %acc_next : i32, i32), ^loop_exit(%acc_next : i32)
+  ^loop_exit(%result : i32):
+    vm.return %result : i32
+  }
+
   // Measures the cost of lots of buffer loads.
   vm.export @buffer_reduce
   vm.func @buffer_reduce(%count : i32) -> i32 {
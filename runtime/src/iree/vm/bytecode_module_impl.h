@@ -16,6 +16,7 @@
 #endif  // _MSC_VER
 
 #include "iree/base/api.h"
+#include "iree/base/internal/atomics.h"
 #include "iree/vm/api.h"
 
 // NOTE: include order matters:
@@ -80,9 +81,24 @@ typedef struct iree_vm_bytecode_module_t {
   // aligned physical offset where content is located.
   iree_host_size_t archive_rodata_offset;
 
+  // Optional parameter archive data and allocator (which may be null).
+  // Referenced by rodata segments with parameter_data.
+  iree_const_byte_span_t parameter_contents;
+  iree_allocator_t parameter_allocator;
+
   // Loaded FlatBuffer module pointing into the archive contents.
   iree_vm_BytecodeModuleDef_table_t def;
 
+  // Optional ahead-of-time compiled implementation of the module.
+  // When present all state management and execution is routed to it and the
+  // bytecode is only used for reflection.
+  iree_vm_module_t* native_module;
+
+  // Export ordinals sorted by local name such that lookups by name can binary
+  // search the exports in the FlatBuffer. Stored after |type_table| in the
+  // module allocation.
+  const uint16_t* export_name_index;
+
   // Type table mapping module type IDs to registered VM types.
   iree_host_size_t type_count;
   iree_vm_type_def_t type_table[];
@@ -108,8 +124,30 @@ typedef struct iree_vm_bytecode_import_t {
   // don't support variadic values (yet).
   uint16_t argument_buffer_size;
   uint16_t result_buffer_size;
+
+  // Cached native module function pointer table entry if the import resolved
+  // to a function of a native module using the default call handling. This
+  // allows the dispatcher to call the shim directly and skip the generic
+  // module begin_call routing. NULL if the import must be called via the
+  // module interface.
+  const iree_vm_native_function_ptr_t* native_function_ptr;
 } iree_vm_bytecode_import_t;
 
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+// Profiling counters accumulated for a function or import within a context.
+// Counters are updated atomically as concurrent contexts may execute the same
+// function from multiple threads.
+typedef struct iree_vm_bytecode_profile_counters_t {
+  // Total number of calls made.
+  iree_atomic_int64_t call_count;
+  // Total number of instructions executed within the function (excluding
+  // callees). Always 0 for imports.
+  iree_atomic_int64_t instruction_count;
+  // Total wall time in nanoseconds spent within calls (including callees).
+  iree_atomic_int64_t total_time_ns;
+} iree_vm_bytecode_profile_counters_t;
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+
 // Per-instance module state.
 // This is allocated with a provided allocator as a single flat allocation.
 // This struct is a prefix to the allocation pointing into the dynamic offsets
@@ -134,6 +172,14 @@ typedef struct iree_vm_bytecode_module_state_t {
   iree_host_size_t import_count;
   iree_vm_bytecode_import_t* import_table;
 
+#if IREE_VM_EXECUTION_PROFILING_ENABLE
+  // Profiling counters indexed by internal function ordinal.
+  iree_host_size_t function_profile_count;
+  iree_vm_bytecode_profile_counters_t* function_profile_table;
+  // Profiling counters indexed by import ordinal.
+  iree_vm_bytecode_profile_counters_t* import_profile_table;
+#endif  // IREE_VM_EXECUTION_PROFILING_ENABLE
+
   // Allocator used for the state itself and any runtime allocations needed.
   iree_allocator_t allocator;
 } iree_vm_bytecode_module_state_t;
@@ -32,6 +32,9 @@ struct iree_vm_context_t {
   // Configuration flags.
   iree_vm_context_flags_t flags;
 
+  // Frame storage shared by the stacks of invocations within the context.
+  iree_vm_stack_frame_pool_t stack_frame_pool;
+
   struct {
     iree_host_size_t count;
     iree_host_size_t capacity;
@@ -271,10 +274,10 @@ IREE_API_EXPORT iree_status_t iree_vm_context_create_with_modules(
 
   context->context_id = iree_vm_context_allocate_id();
 
-  // TODO(benvanik): allow for non-frozen but static contexts.
-  context->is_frozen = module_count > 0;
+  context->is_frozen = 0;
   context->is_static = module_count > 0;
   context->flags = flags;
+  iree_vm_stack_frame_pool_initialize(&context->stack_frame_pool);
 
   uint8_t* p = (uint8_t*)context + sizeof(iree_vm_context_t);
   context->list.modules = (iree_vm_module_t**)p;
@@ -292,6 +295,9 @@ IREE_API_EXPORT iree_status_t iree_vm_context_create_with_modules(
     return register_status;
   }
 
+  // TODO(benvanik): allow for non-frozen but static contexts.
+  context->is_frozen = module_count > 0;
+
   *out_context = context;
   IREE_TRACE_ZONE_END(z0);
   return iree_ok_status();
@@ -315,6 +321,8 @@ static void iree_vm_context_destroy(iree_vm_context_t* context) {
     context->list.module_states = NULL;
   }
 
+  iree_vm_stack_frame_pool_deinitialize(&context->stack_frame_pool);
+
   iree_vm_instance_release(context->instance);
   context->instance = NULL;
 
@@ -364,16 +372,15 @@ IREE_API_EXPORT iree_status_t iree_vm_context_register_modules(
     }
   }
 
+  if (context->is_frozen) {
+    return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                            "context is frozen and cannot register modules");
+  }
+
   IREE_TRACE_ZONE_BEGIN(z0);
 
   // Try growing both our storage lists first, if needed.
   if (context->list.count + module_count > context->list.capacity) {
-    if (context->is_frozen) {
-      IREE_TRACE_ZONE_END(z0);
-      return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
-                              "context was allocated as static and cannot "
-                              "register modules after creation");
-    }
     iree_host_size_t new_capacity = context->list.capacity + module_count;
     if (new_capacity < context->list.capacity * 2) {
       // TODO(benvanik): tune list growth for module count >> 4.
@@ -485,6 +492,12 @@ iree_vm_context_state_resolver(const iree_vm_context_t* context) {
   return state_resolver;
 }
 
+IREE_API_EXPORT iree_vm_stack_frame_pool_t* iree_vm_context_stack_frame_pool(
+    iree_vm_context_t* context) {
+  IREE_ASSERT_ARGUMENT(context);
+  return &context->stack_frame_pool;
+}
+
 IREE_API_EXPORT iree_status_t iree_vm_context_resolve_module_state(
     const iree_vm_context_t* context, iree_vm_module_t* module,
     iree_vm_module_state_t** out_module_state) {
@@ -28,7 +28,12 @@ extern "C" {
 // back to the first, such that modules can override implementations of
 // functions in previously registered modules.
 //
-// Thread-compatible and must be externally synchronized.
+// Thread-compatible and must be externally synchronized unless created with
+// IREE_VM_CONTEXT_FLAG_CONCURRENT. Concurrent contexts may be invoked from any
+// number of threads at the same time once frozen: modules and their state are
+// shared by all invocations while registers and frames are per-invocation and
+// live on each invocation's stack. Mutable module state such as globals is
+// shared and programs that mutate it must synchronize themselves.
 typedef struct iree_vm_context_t iree_vm_context_t;
 
 enum iree_vm_context_flag_bits_t {
@@ -45,8 +50,18 @@ enum iree_vm_context_flag_bits_t {
   // Context allows concurrent execution.
   // Multiple OS threads may call into the context concurrently. Synchronization
   // is not performed by the context and callers must ensure the executing
-  // programs support concurrency.
+  // programs support concurrency. Contexts should be frozen with
+  // iree_vm_context_freeze (or created with their modules) before being shared
+  // such that module registration cannot race with execution.
   IREE_VM_CONTEXT_FLAG_CONCURRENT = 1u << 1,
+
+  // Enables profiling of execution (when available).
+  // See iree/base/config.h for the flags that control whether this
+  // functionality is available; specifically:
+  //   -DIREE_VM_EXECUTION_PROFILING_ENABLE=1
+  // All invocations made to this context will accumulate profiling counters
+  // that can be queried with iree_vm_bytecode_module_append_profile.
+  IREE_VM_CONTEXT_FLAG_PROFILE_EXECUTION = 1u << 2,
 };
 typedef uint32_t iree_vm_context_flags_t;
 
@@ -91,7 +106,9 @@ IREE_API_EXPORT iree_status_t iree_vm_context_register_modules(
 
 // Freezes a context such that no more modules can be registered.
 // This can be used to ensure that context contents cannot be modified by other
-// code as the context is made available to other parts of the program.
+// code as the context is made available to other parts of the program or
+// shared by concurrent invocations. Any attempt to register modules afterward
+// fails with IREE_STATUS_FAILED_PRECONDITION.
 // No-op if already frozen.
 IREE_API_EXPORT iree_status_t
 iree_vm_context_freeze(iree_vm_context_t* context);
@@ -101,6 +118,12 @@ iree_vm_context_freeze(iree_vm_context_t* context);
 IREE_API_EXPORT iree_vm_state_resolver_t
 iree_vm_context_state_resolver(const iree_vm_context_t* context);
 
+// Returns the pool of stack frame storage shared by invocations within
+// |context|. Stacks that grow beyond their initial storage reuse the storage
+// grown by prior invocations.
+IREE_API_EXPORT iree_vm_stack_frame_pool_t* iree_vm_context_stack_frame_pool(
+    iree_vm_context_t* context);
+
 // Sets |out_module_state| to the context-specific state for the given |module|.
 // The state is owned by the context and will only be live for as long as the
 // context is.
@@ -12,6 +12,7 @@
 
 #include "iree/base/api.h"
 #include "iree/base/internal/debugging.h"
+#include "iree/base/internal/wait_handle.h"
 #include "iree/base/tracing.h"
 #include "iree/vm/ref.h"
 #include "iree/vm/stack.h"
@@ -51,9 +52,11 @@ static void iree_vm_invoke_release_io_storage(iree_string_view_t cconv_fragment,
 }
 
 // Marshals caller arguments from the variant list to the ABI convention.
+// If IREE_VM_INVOCATION_FLAG_CONSUME_INPUTS is set in |flags| ref inputs are
+// moved out of the list instead of being retained.
 static iree_status_t iree_vm_invoke_marshal_inputs(
-    iree_string_view_t cconv_arguments, const iree_vm_list_t* inputs,
-    iree_byte_span_t arguments) {
+    iree_string_view_t cconv_arguments, iree_vm_invocation_flags_t flags,
+    const iree_vm_list_t* inputs, iree_byte_span_t arguments) {
   // We are 1:1 right now with no variadic args, so do a quick verification on
   // the input list.
   iree_host_size_t expected_input_count =
@@ -109,10 +112,15 @@ static iree_status_t iree_vm_invoke_marshal_inputs(
         p += sizeof(double);
       } break;
       case IREE_VM_CCONV_TYPE_REF: {
-        // TODO(benvanik): see if we can't remove this retain by instead relying
-        // on the caller still owning the list.
-        IREE_RETURN_IF_ERROR(
-            iree_vm_list_get_ref_retain(inputs, arg_i, (iree_vm_ref_t*)p));
+        // The callee takes ownership of its arguments so we either need to
+        // retain them or (when the caller allows it) move them out of the list.
+        if (flags & IREE_VM_INVOCATION_FLAG_CONSUME_INPUTS) {
+          IREE_RETURN_IF_ERROR(iree_vm_list_get_ref_move(
+              (iree_vm_list_t*)inputs, arg_i, (iree_vm_ref_t*)p));
+        } else {
+          IREE_RETURN_IF_ERROR(
+              iree_vm_list_get_ref_retain(inputs, arg_i, (iree_vm_ref_t*)p));
+        }
         p += sizeof(iree_vm_ref_t);
       } break;
     }
@@ -361,10 +369,13 @@ IREE_API_EXPORT iree_status_t iree_vm_begin_invoke(
   IREE_ASSERT_ARGUMENT(context);
   IREE_TRACE_ZONE_BEGIN(z0);
 
-  // Force tracing if specified on the context.
+  // Force tracing and profiling if specified on the context.
   if (iree_vm_context_flags(context) & IREE_VM_CONTEXT_FLAG_TRACE_EXECUTION) {
     flags |= IREE_VM_INVOCATION_FLAG_TRACE_EXECUTION;
   }
+  if (iree_vm_context_flags(context) & IREE_VM_CONTEXT_FLAG_PROFILE_EXECUTION) {
+    flags |= IREE_VM_INVOCATION_FLAG_PROFILE_EXECUTION;
+  }
 
   // Grab function metadata used for marshaling inputs/outputs.
   iree_vm_function_signature_t signature =
@@ -415,7 +426,7 @@ IREE_API_EXPORT iree_status_t iree_vm_begin_invoke(
   // buffer. If marshaling fails we need to cleanup the arguments.
   // NOTE: today we don't support variadic arguments through this interface.
   iree_status_t status =
-      iree_vm_invoke_marshal_inputs(cconv_arguments, inputs, arguments);
+      iree_vm_invoke_marshal_inputs(cconv_arguments, flags, inputs, arguments);
   if (!iree_status_is_ok(status)) {
     iree_vm_invoke_release_io_storage(cconv_arguments, arguments);
     IREE_TRACE_ZONE_END(z0);
@@ -433,6 +444,8 @@ IREE_API_EXPORT iree_status_t iree_vm_begin_invoke(
                   sizeof(state->stack_storage) - result_storage_size),
               flags, iree_vm_context_state_resolver(context), host_allocator,
               &stack));
+  iree_vm_stack_set_frame_pool(stack,
+                               iree_vm_context_stack_frame_pool(context));
 
   // NOTE: at this point the stack must be properly deinitialized if we bail.
 
@@ -528,6 +541,119 @@ iree_vm_resume_invoke(iree_vm_invoke_state_t* state) {
   return iree_ok_status();
 }
 
+// Scans the sources of a multi-wait |wait_frame| without blocking.
+// Returns OK if the wait is satisfied, IREE_STATUS_DEFERRED if it is not yet
+// satisfied, and otherwise the failure of the first source that failed.
+static iree_status_t iree_vm_wait_multi_query(
+    const iree_vm_wait_frame_t* wait_frame) {
+  const bool wait_any = wait_frame->wait_type == IREE_VM_WAIT_ANY;
+  iree_host_size_t resolved_count = 0;
+  for (iree_host_size_t i = 0; i < wait_frame->count; ++i) {
+    iree_status_code_t wait_status_code = IREE_STATUS_OK;
+    IREE_RETURN_IF_ERROR(
+        iree_wait_source_query(wait_frame->wait_sources[i], &wait_status_code));
+    if (wait_status_code == IREE_STATUS_DEFERRED) continue;
+    if (wait_status_code != IREE_STATUS_OK) {
+      return iree_status_from_code(wait_status_code);
+    }
+    if (wait_any) return iree_ok_status();
+    ++resolved_count;
+  }
+  return resolved_count == wait_frame->count
+             ? iree_ok_status()
+             : iree_status_from_code(IREE_STATUS_DEFERRED);
+}
+
+// Exports all unresolved sources of |wait_frame| into |wait_set| and blocks
+// until the wait-any/wait-all condition is met or |deadline_ns| elapses.
+// Returns IREE_STATUS_UNAVAILABLE if any source cannot be exported to a system
+// wait handle.
+static iree_status_t iree_vm_wait_multi_wait_set(
+    const iree_vm_wait_frame_t* wait_frame, iree_time_t deadline_ns,
+    iree_wait_set_t* wait_set) {
+  for (iree_host_size_t i = 0; i < wait_frame->count; ++i) {
+    iree_wait_source_t wait_source = wait_frame->wait_sources[i];
+    iree_wait_handle_t wait_handle = iree_wait_handle_immediate();
+    iree_wait_handle_t* wait_handle_ptr =
+        iree_wait_handle_from_source(&wait_source);
+    if (wait_handle_ptr) {
+      wait_handle = *wait_handle_ptr;
+    } else {
+      iree_wait_primitive_t wait_primitive = iree_wait_primitive_immediate();
+      IREE_RETURN_IF_ERROR(iree_wait_source_export(
+          wait_source, IREE_WAIT_PRIMITIVE_TYPE_ANY, iree_immediate_timeout(),
+          &wait_primitive));
+      iree_wait_handle_wrap_primitive(wait_primitive.type, wait_primitive.value,
+                                      &wait_handle);
+    }
+    if (iree_wait_handle_is_immediate(wait_handle)) continue;
+    IREE_RETURN_IF_ERROR(iree_wait_set_insert(wait_set, wait_handle));
+  }
+  if (wait_frame->wait_type == IREE_VM_WAIT_ANY) {
+    iree_wait_handle_t wake_handle = iree_wait_handle_immediate();
+    return iree_wait_any(wait_set, deadline_ns, &wake_handle);
+  } else {
+    return iree_wait_all(wait_set, deadline_ns);
+  }
+}
+
+// Performs a blocking multi-wait on all sources of |wait_frame|.
+// When all sources can be exported to system wait handles a single wait-set
+// wait is used; otherwise sources are waited on one at a time, which for
+// wait-any means the first unresolved source is waited on even if another
+// resolves earlier.
+static iree_status_t iree_vm_wait_multi(const iree_vm_wait_frame_t* wait_frame,
+                                        iree_time_t deadline_ns,
+                                        iree_allocator_t host_allocator) {
+  IREE_TRACE_ZONE_BEGIN(z0);
+  IREE_TRACE_ZONE_APPEND_VALUE(z0, (uint64_t)wait_frame->count);
+
+  // Fast path for waits that have already resolved (or failed).
+  iree_status_t status = iree_vm_wait_multi_query(wait_frame);
+  if (!iree_status_is_deferred(status)) {
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+  if (deadline_ns <= iree_time_now()) {
+    IREE_TRACE_ZONE_END(z0);
+    return iree_status_from_code(IREE_STATUS_DEADLINE_EXCEEDED);
+  }
+
+  // Try to wait on all sources at once with a system wait set.
+  iree_wait_set_t* wait_set = NULL;
+  status =
+      iree_wait_set_allocate(wait_frame->count, host_allocator, &wait_set);
+  if (iree_status_is_ok(status)) {
+    status = iree_vm_wait_multi_wait_set(wait_frame, deadline_ns, wait_set);
+  }
+  iree_wait_set_free(wait_set);
+  if (iree_status_is_ok(status)) {
+    // Signaled; query again to pick up any failures of the sources.
+    status = iree_vm_wait_multi_query(wait_frame);
+    if (!iree_status_is_deferred(status)) {
+      IREE_TRACE_ZONE_END(z0);
+      return status;
+    }
+  } else if (iree_status_is_deadline_exceeded(status)) {
+    IREE_TRACE_ZONE_END(z0);
+    return status;
+  }
+  iree_status_ignore(status);
+
+  // Fallback for sources that cannot be exported (or that woke without having
+  // resolved): wait on each in order.
+  status = iree_ok_status();
+  for (iree_host_size_t i = 0; i < wait_frame->count; ++i) {
+    status = iree_wait_source_wait_one(wait_frame->wait_sources[i],
+                                       iree_make_deadline(deadline_ns));
+    if (!iree_status_is_ok(status)) break;
+    if (wait_frame->wait_type == IREE_VM_WAIT_ANY) break;
+  }
+
+  IREE_TRACE_ZONE_END(z0);
+  return status;
+}
+
 IREE_API_EXPORT iree_status_t
 iree_vm_wait_invoke(iree_vm_invoke_state_t* state,
                     iree_vm_wait_frame_t* wait_frame, iree_time_t deadline_ns) {
@@ -556,12 +682,8 @@ iree_vm_wait_invoke(iree_vm_invoke_state_t* state,
     wait_frame->wait_status = iree_wait_source_wait_one(
         wait_frame->wait_sources[0], iree_make_deadline(min_deadline_ns));
   } else {
-    // TODO(benvanik): multi-wait when running synchronously. This is already
-    // supported by iree_loop_inline_t and maybe we can just reuse that. These
-    // are not currently emitted by the compiler.
-    return iree_make_status(
-        IREE_STATUS_UNIMPLEMENTED,
-        "multi-wait in synchronous invocations not yet implemented");
+    wait_frame->wait_status = iree_vm_wait_multi(
+        wait_frame, min_deadline_ns, iree_vm_stack_allocator(state->stack));
   }
 
   // Reset status to OK - the next resume will pick back up in the waiter.
@@ -36,7 +36,8 @@ typedef struct iree_vm_invocation_policy_t iree_vm_invocation_policy_t;
 //
 // |inputs| is used to pass values and objects into the target function and must
 // match the signature defined by the compiled function. List ownership remains
-// with the caller.
+// with the caller. If IREE_VM_INVOCATION_FLAG_CONSUME_INPUTS is set the ref
+// contents of the list are moved into the invocation.
 //
 // |outputs| is populated after the function completes execution with the
 // output values and objects of the function. List ownership remains with the
@@ -106,7 +107,9 @@ typedef struct iree_vm_invoke_state_t {
 //
 // |inputs| is used to pass values and objects into the target function and must
 // match the signature defined by the target |function|. List contents are
-// captured and the caller can reuse it immediately upon return.
+// captured and the caller can reuse it immediately upon return. If
+// IREE_VM_INVOCATION_FLAG_CONSUME_INPUTS is set the ref contents are instead
+// moved out of the list.
 //
 // Returns OK if the invocation began regardless of the invocation result.
 // When OK iree_vm_end_invoke is used to retrieve the invocation result.
@@ -136,8 +139,15 @@ iree_vm_resume_invoke(iree_vm_invoke_state_t* state);
 // to bound the wait operation. If successful the caller must use
 // iree_vm_resume_invoke to allow the invocation to process the wait results.
 //
+// Multi-wait (wait-any/wait-all) operations are performed with a single system
+// wait when all wait sources can be exported to wait handles and otherwise by
+// waiting on each source in turn.
+//
 // Hosting schedulers that can more efficiently perform the wait should do so,
-// either synchronously or asynchronously. Wait frames are stored on the stack
+// either synchronously or asynchronously. Running many invocations
+// cooperatively on a single thread can be done with iree_vm_async_invoke atop
+// an iree_loop_sync_t; the loop batches the waits of all suspended invocations
+// into one wait set and resumes each as its waits resolve. Wait frames are stored on the stack
 // and will remain valid until iree_vm_resume_invoke is used to complete the
 // wait.
 //
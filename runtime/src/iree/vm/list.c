@@ -170,6 +170,18 @@ IREE_API_EXPORT void iree_vm_list_deinitialize(iree_vm_list_t* list) {
   IREE_TRACE_ZONE_END(z0);
 }
 
+IREE_API_EXPORT iree_status_t iree_vm_list_initialize_transient(
+    const iree_vm_type_def_t* element_type, iree_host_size_t capacity,
+    iree_allocator_t allocator, iree_vm_list_t** out_list) {
+  IREE_ASSERT_ARGUMENT(out_list);
+  *out_list = NULL;
+  iree_byte_span_t storage = iree_make_byte_span(
+      NULL, iree_vm_list_storage_size(element_type, capacity));
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc_uninitialized(
+      allocator, storage.data_length, (void**)&storage.data));
+  return iree_vm_list_initialize(storage, element_type, capacity, out_list);
+}
+
 IREE_API_EXPORT iree_status_t iree_vm_list_create(
     const iree_vm_type_def_t* element_type, iree_host_size_t initial_capacity,
     iree_allocator_t allocator, iree_vm_list_t** out_list) {
@@ -243,6 +255,12 @@ iree_vm_list_reserve(iree_vm_list_t* list, iree_host_size_t minimum_capacity) {
   if (list->capacity >= minimum_capacity) {
     return iree_ok_status();
   }
+  if (iree_allocator_is_null(list->allocator)) {
+    // Lists initialized in caller-provided storage cannot grow.
+    return iree_make_status(IREE_STATUS_RESOURCE_EXHAUSTED,
+                            "fixed-capacity list cannot grow from %zu to %zu",
+                            list->capacity, minimum_capacity);
+  }
   iree_host_size_t old_capacity = list->capacity;
   iree_host_size_t new_capacity = iree_host_align(minimum_capacity, 64);
   IREE_RETURN_IF_ERROR(iree_allocator_realloc(
@@ -507,6 +525,142 @@ iree_vm_list_push_value(iree_vm_list_t* list, const iree_vm_value_t* value) {
   return iree_vm_list_set_value(list, i, value);
 }
 
+// Returns OK if [i, i + count) is within the bounds of |list|.
+static iree_status_t iree_vm_list_check_range(const iree_vm_list_t* list,
+                                              iree_host_size_t i,
+                                              iree_host_size_t count) {
+  if (count > list->count || i > list->count - count) {
+    return iree_make_status(IREE_STATUS_OUT_OF_RANGE,
+                            "range [%zu, %zu) out of bounds (%zu)", i,
+                            i + count, list->count);
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_list_get_values(
+    const iree_vm_list_t* list, iree_host_size_t i, iree_host_size_t count,
+    iree_vm_value_type_t value_type, void* out_values) {
+  IREE_RETURN_IF_ERROR(iree_vm_list_check_range(list, i, count));
+  iree_host_size_t value_size = iree_vm_value_type_size(value_type);
+  if (!value_size) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "invalid value type %d", (int)value_type);
+  }
+  uint8_t* target_ptr = (uint8_t*)out_values;
+  switch (list->storage_mode) {
+    case IREE_VM_LIST_STORAGE_MODE_VALUE: {
+      const uint8_t* source_ptr =
+          (const uint8_t*)list->storage + i * list->element_size;
+      if (value_type == list->element_type.value_type) {
+        memcpy(target_ptr, source_ptr, count * value_size);
+        break;
+      }
+      for (iree_host_size_t j = 0; j < count; ++j) {
+        iree_vm_value_t value;
+        value.type = list->element_type.value_type;
+        value.i64 = 0;
+        memcpy(value.value_storage, source_ptr + j * list->element_size,
+               list->element_size);
+        iree_vm_value_t converted_value;
+        iree_vm_list_convert_value_type(&value, value_type, &converted_value);
+        memcpy(target_ptr + j * value_size, converted_value.value_storage,
+               value_size);
+      }
+      break;
+    }
+    case IREE_VM_LIST_STORAGE_MODE_VARIANT: {
+      const iree_vm_variant_t* variants =
+          (const iree_vm_variant_t*)list->storage + i;
+      for (iree_host_size_t j = 0; j < count; ++j) {
+        if (!iree_vm_type_def_is_value(&variants[j].type)) {
+          return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                                  "variant at index %zu is not a value type",
+                                  i + j);
+        }
+        iree_vm_value_t value;
+        value.type = variants[j].type.value_type;
+        memcpy(value.value_storage, variants[j].value_storage,
+               sizeof(value.value_storage));
+        iree_vm_value_t converted_value;
+        iree_vm_list_convert_value_type(&value, value_type, &converted_value);
+        memcpy(target_ptr + j * value_size, converted_value.value_storage,
+               value_size);
+      }
+      break;
+    }
+    default:
+      return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                              "list does not store values");
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_list_set_values(
+    iree_vm_list_t* list, iree_host_size_t i, iree_host_size_t count,
+    iree_vm_value_type_t value_type, const void* values) {
+  IREE_RETURN_IF_ERROR(iree_vm_list_check_range(list, i, count));
+  iree_host_size_t value_size = iree_vm_value_type_size(value_type);
+  if (!value_size) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "invalid value type %d", (int)value_type);
+  }
+  const uint8_t* source_ptr = (const uint8_t*)values;
+  switch (list->storage_mode) {
+    case IREE_VM_LIST_STORAGE_MODE_VALUE: {
+      uint8_t* target_ptr = (uint8_t*)list->storage + i * list->element_size;
+      if (value_type == list->element_type.value_type) {
+        memcpy(target_ptr, source_ptr, count * value_size);
+        break;
+      }
+      for (iree_host_size_t j = 0; j < count; ++j) {
+        iree_vm_value_t value;
+        value.type = value_type;
+        value.i64 = 0;
+        memcpy(value.value_storage, source_ptr + j * value_size, value_size);
+        iree_vm_value_t converted_value;
+        iree_vm_list_convert_value_type(&value, list->element_type.value_type,
+                                        &converted_value);
+        memcpy(target_ptr + j * list->element_size,
+               converted_value.value_storage, list->element_size);
+      }
+      break;
+    }
+    case IREE_VM_LIST_STORAGE_MODE_VARIANT: {
+      iree_vm_variant_t* variants = (iree_vm_variant_t*)list->storage + i;
+      for (iree_host_size_t j = 0; j < count; ++j) {
+        iree_vm_variant_t* variant = &variants[j];
+        if (variant->type.ref_type) {
+          iree_vm_ref_release(&variant->ref);
+        }
+        variant->type.value_type = value_type;
+        variant->type.ref_type = IREE_VM_REF_TYPE_NULL;
+        memset(variant->value_storage, 0, sizeof(variant->value_storage));
+        memcpy(variant->value_storage, source_ptr + j * value_size,
+               value_size);
+      }
+      break;
+    }
+    default:
+      return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                              "list cannot store values");
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_list_push_values(
+    iree_vm_list_t* list, iree_host_size_t count,
+    iree_vm_value_type_t value_type, const void* values) {
+  iree_host_size_t i = iree_vm_list_size(list);
+  IREE_RETURN_IF_ERROR(iree_vm_list_resize(list, i + count));
+  iree_status_t status =
+      iree_vm_list_set_values(list, i, count, value_type, values);
+  if (!iree_status_is_ok(status)) {
+    // Drop the partially set elements; resizing down cannot fail.
+    iree_status_ignore(iree_vm_list_resize(list, i));
+  }
+  return status;
+}
+
 IREE_API_EXPORT void* iree_vm_list_get_ref_deref(
     const iree_vm_list_t* list, iree_host_size_t i,
     const iree_vm_ref_type_descriptor_t* type_descriptor) {
@@ -568,6 +722,14 @@ IREE_API_EXPORT iree_status_t iree_vm_list_get_ref_retain(
                                                out_value);
 }
 
+IREE_API_EXPORT iree_status_t iree_vm_list_get_ref_move(
+    iree_vm_list_t* list, iree_host_size_t i, iree_vm_ref_t* out_value) {
+  IREE_RETURN_IF_ERROR(iree_vm_list_get_ref_assign(list, i, out_value));
+  uintptr_t element_ptr = (uintptr_t)list->storage + i * list->element_size;
+  memset((void*)element_ptr, 0, list->element_size);
+  return iree_ok_status();
+}
+
 static iree_status_t iree_vm_list_set_ref(iree_vm_list_t* list,
                                           iree_host_size_t i, bool is_move,
                                           iree_vm_ref_t* value) {
@@ -626,6 +788,61 @@ IREE_API_EXPORT iree_status_t iree_vm_list_push_ref_move(iree_vm_list_t* list,
   return iree_vm_list_set_ref_move(list, i, value);
 }
 
+// Pushes |count| refs to the end of |list|. Either all refs are pushed or, if
+// any ref does not match the list element type, none are and |values| is left
+// unchanged.
+static iree_status_t iree_vm_list_push_refs(iree_vm_list_t* list,
+                                            iree_host_size_t count,
+                                            bool is_move,
+                                            iree_vm_ref_t* values) {
+  switch (list->storage_mode) {
+    case IREE_VM_LIST_STORAGE_MODE_REF: {
+      for (iree_host_size_t j = 0; j < count; ++j) {
+        if (values[j].type != IREE_VM_REF_TYPE_NULL &&
+            values[j].type != list->element_type.ref_type) {
+          return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                                  "source ref %zu type mismatch", j);
+        }
+      }
+      break;
+    }
+    case IREE_VM_LIST_STORAGE_MODE_VARIANT:
+      break;
+    default:
+      return iree_make_status(IREE_STATUS_FAILED_PRECONDITION,
+                              "list cannot store refs");
+  }
+
+  // Elements added by the resize are zeroed and hold no references.
+  iree_host_size_t i = iree_vm_list_size(list);
+  IREE_RETURN_IF_ERROR(iree_vm_list_resize(list, i + count));
+  if (list->storage_mode == IREE_VM_LIST_STORAGE_MODE_REF) {
+    iree_vm_ref_t* refs = (iree_vm_ref_t*)list->storage + i;
+    for (iree_host_size_t j = 0; j < count; ++j) {
+      iree_vm_ref_retain_or_move(is_move, &values[j], &refs[j]);
+    }
+  } else {
+    iree_vm_variant_t* variants = (iree_vm_variant_t*)list->storage + i;
+    for (iree_host_size_t j = 0; j < count; ++j) {
+      variants[j].type.value_type = IREE_VM_VALUE_TYPE_NONE;
+      variants[j].type.ref_type = values[j].type;
+      iree_vm_ref_retain_or_move(is_move, &values[j], &variants[j].ref);
+    }
+  }
+  return iree_ok_status();
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_list_push_refs_retain(
+    iree_vm_list_t* list, iree_host_size_t count, const iree_vm_ref_t* values) {
+  return iree_vm_list_push_refs(list, count, /*is_move=*/false,
+                                (iree_vm_ref_t*)values);
+}
+
+IREE_API_EXPORT iree_status_t iree_vm_list_push_refs_move(
+    iree_vm_list_t* list, iree_host_size_t count, iree_vm_ref_t* values) {
+  return iree_vm_list_push_refs(list, count, /*is_move=*/true, values);
+}
+
 IREE_API_EXPORT iree_status_t iree_vm_list_pop_front_ref_move(
     iree_vm_list_t* list, iree_vm_ref_t* out_value) {
   iree_host_size_t list_size = iree_vm_list_size(list);
@@ -54,6 +54,19 @@ IREE_API_EXPORT iree_status_t iree_vm_list_initialize(
 // iree_vm_list_initialize. Aborts if there are still references remaining.
 IREE_API_EXPORT void iree_vm_list_deinitialize(iree_vm_list_t* list);
 
+// Initializes a list with |capacity| in storage allocated from |allocator|.
+// This is designed for transient lists such as invocation arguments that are
+// allocated from bump-pointer allocators (like iree_arena_allocator) where
+// memory is reclaimed in bulk: once in steady state no system allocations are
+// made for the list.
+//
+// The list behaves as if initialized with iree_vm_list_initialize: it has a
+// fixed capacity, must be deinitialized with iree_vm_list_deinitialize, and
+// its storage is never returned to |allocator|.
+IREE_API_EXPORT iree_status_t iree_vm_list_initialize_transient(
+    const iree_vm_type_def_t* element_type, iree_host_size_t capacity,
+    iree_allocator_t allocator, iree_vm_list_t** out_list);
+
 // Creates a growable list containing the given |element_type|, which may either
 // be a primitive iree_vm_value_type_t value (like i32) or a ref type. When
 // storing ref types the list may either store a specific iree_vm_ref_type_t
@@ -121,6 +134,31 @@ IREE_API_EXPORT iree_status_t iree_vm_list_set_value(
 IREE_API_EXPORT iree_status_t
 iree_vm_list_push_value(iree_vm_list_t* list, const iree_vm_value_t* value);
 
+// Copies the |count| elements starting at index |i| into |out_values| as a
+// dense array of |value_type| elements. Primitive lists store their elements
+// contiguously and are copied with a single memcpy when |value_type| matches
+// the list element type; otherwise each value is converted using the value
+// type semantics (such as sign/zero extend, etc). The contents of |out_values|
+// are undefined on failure.
+IREE_API_EXPORT iree_status_t iree_vm_list_get_values(
+    const iree_vm_list_t* list, iree_host_size_t i, iree_host_size_t count,
+    iree_vm_value_type_t value_type, void* out_values);
+
+// Sets the |count| elements starting at index |i| from |values|, a dense array
+// of |value_type| elements. Primitive lists are copied with a single memcpy
+// when |value_type| matches the list element type; otherwise each value is
+// converted using the value type semantics (such as sign/zero extend, etc).
+IREE_API_EXPORT iree_status_t iree_vm_list_set_values(
+    iree_vm_list_t* list, iree_host_size_t i, iree_host_size_t count,
+    iree_vm_value_type_t value_type, const void* values);
+
+// Pushes the |count| elements of |values|, a dense array of |value_type|
+// elements, to the end of the list with a single resize. See
+// iree_vm_list_set_values for conversion behavior.
+IREE_API_EXPORT iree_status_t iree_vm_list_push_values(
+    iree_vm_list_t* list, iree_host_size_t count,
+    iree_vm_value_type_t value_type, const void* values);
+
 // Returns a dereferenced pointer to the given type if the element at the given
 // index matches the type. Returns NULL on error.
 IREE_API_EXPORT void* iree_vm_list_get_ref_deref(
@@ -138,6 +176,11 @@ IREE_API_EXPORT iree_status_t iree_vm_list_get_ref_assign(
 IREE_API_EXPORT iree_status_t iree_vm_list_get_ref_retain(
     const iree_vm_list_t* list, iree_host_size_t i, iree_vm_ref_t* out_value);
 
+// Returns the ref value of the element at the given index and transfers
+// ownership to the caller. The element is left as a null ref.
+IREE_API_EXPORT iree_status_t iree_vm_list_get_ref_move(
+    iree_vm_list_t* list, iree_host_size_t i, iree_vm_ref_t* out_value);
+
 // Sets the ref value of the element at the given index, retaining a reference
 // in the list until the element is cleared or the list is disposed.
 IREE_API_EXPORT iree_status_t iree_vm_list_set_ref_retain(
@@ -159,6 +202,18 @@ IREE_API_EXPORT iree_status_t iree_vm_list_set_ref_move(iree_vm_list_t* list,
 IREE_API_EXPORT iree_status_t iree_vm_list_push_ref_move(iree_vm_list_t* list,
                                                          iree_vm_ref_t* value);
 
+// Pushes the |count| ref values to the end of the list with a single resize,
+// retaining a reference to each in the list. Fails without modifying the list
+// if any ref does not match the list element type.
+IREE_API_EXPORT iree_status_t iree_vm_list_push_refs_retain(
+    iree_vm_list_t* list, iree_host_size_t count, const iree_vm_ref_t* values);
+
+// Pushes the |count| ref values to the end of the list with a single resize,
+// moving ownership of each reference to the list. Fails without modifying the
+// list or |values| if any ref does not match the list element type.
+IREE_API_EXPORT iree_status_t iree_vm_list_push_refs_move(
+    iree_vm_list_t* list, iree_host_size_t count, iree_vm_ref_t* values);
+
 // Pops the front ref value from the list and transfers ownership to the caller.
 IREE_API_EXPORT iree_status_t
 iree_vm_list_pop_front_ref_move(iree_vm_list_t* list, iree_vm_ref_t* out_value);
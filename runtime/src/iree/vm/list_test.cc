@@ -10,6 +10,7 @@
 #include <cstring>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/arena.h"
 #include "iree/testing/gtest.h"
 #include "iree/testing/status_matchers.h"
 #include "iree/vm/builtin_types.h"
@@ -390,6 +391,48 @@ TEST_F(VMListTest, ResizeVariant) {
 // TODO(benvanik): test ref get/set.
 
 // Tests pushing and popping ref objects.
+// Tests transient lists allocated from an arena with refs moved in and out.
+TEST_F(VMListTest, TransientVariant) {
+  iree_arena_block_pool_t block_pool;
+  iree_arena_block_pool_initialize(4096, iree_allocator_system(), &block_pool);
+  iree_arena_allocator_t arena;
+  iree_arena_initialize(&block_pool, &arena);
+
+  iree_vm_type_def_t element_type = iree_vm_type_def_make_variant_type();
+  iree_vm_list_t* list = nullptr;
+  IREE_ASSERT_OK(iree_vm_list_initialize_transient(
+      &element_type, 2, iree_arena_allocator(&arena), &list));
+  EXPECT_EQ(2, iree_vm_list_capacity(list));
+  EXPECT_EQ(0, iree_vm_list_size(list));
+
+  iree_vm_ref_t ref_a = MakeRef<A>(1.0f);
+  IREE_ASSERT_OK(iree_vm_list_push_ref_move(list, &ref_a));
+  iree_vm_value_t value = iree_vm_value_make_i32(2);
+  IREE_ASSERT_OK(iree_vm_list_push_value(list, &value));
+
+  // Transient lists have a fixed capacity.
+  EXPECT_THAT(Status(iree_vm_list_push_value(list, &value)),
+              StatusIs(iree::StatusCode::kResourceExhausted));
+
+  // Moving out of the list leaves a null ref behind.
+  iree_vm_ref_t moved_ref{0};
+  IREE_ASSERT_OK(iree_vm_list_get_ref_move(list, 0, &moved_ref));
+  EXPECT_TRUE(test_a_isa(moved_ref));
+  EXPECT_EQ(1.0f, test_a_deref(moved_ref)->data());
+  iree_vm_variant_t variant = iree_vm_variant_empty();
+  IREE_ASSERT_OK(iree_vm_list_get_variant(list, 0, &variant));
+  EXPECT_TRUE(iree_vm_variant_is_empty(variant));
+  iree_vm_ref_release(&moved_ref);
+
+  // Moving a value out is not possible.
+  EXPECT_THAT(Status(iree_vm_list_get_ref_move(list, 1, &moved_ref)),
+              StatusIs(iree::StatusCode::kFailedPrecondition));
+
+  iree_vm_list_deinitialize(list);
+  iree_arena_deinitialize(&arena);
+  iree_arena_block_pool_deinitialize(&block_pool);
+}
+
 TEST_F(VMListTest, PushPopRef) {
   iree_vm_type_def_t element_type =
       iree_vm_type_def_make_ref_type(test_a_type_id());
@@ -453,6 +496,130 @@ TEST_F(VMListTest, PushPopRef) {
   iree_vm_list_release(list);
 }
 
+// Tests bulk get/set of primitive values with and without conversion.
+TEST_F(VMListTest, BulkValuesI32) {
+  iree_vm_type_def_t element_type =
+      iree_vm_type_def_make_value_type(IREE_VM_VALUE_TYPE_I32);
+  iree_vm_list_t* list = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_list_create(&element_type, 0, iree_allocator_system(), &list));
+
+  int32_t values[5] = {0, -1, 2, -3, 4};
+  IREE_ASSERT_OK(
+      iree_vm_list_push_values(list, 5, IREE_VM_VALUE_TYPE_I32, values));
+  EXPECT_EQ(5, iree_vm_list_size(list));
+  for (iree_host_size_t i = 0; i < 5; ++i) {
+    iree_vm_value_t value;
+    IREE_ASSERT_OK(iree_vm_list_get_value(list, i, &value));
+    EXPECT_EQ(values[i], value.i32);
+  }
+
+  // Overwrite [1, 3) with i8 values that are sign extended.
+  int8_t narrow_values[2] = {-10, 11};
+  IREE_ASSERT_OK(iree_vm_list_set_values(list, 1, 2, IREE_VM_VALUE_TYPE_I8,
+                                         narrow_values));
+
+  int32_t read_values[5] = {0};
+  IREE_ASSERT_OK(
+      iree_vm_list_get_values(list, 0, 5, IREE_VM_VALUE_TYPE_I32, read_values));
+  EXPECT_EQ(0, read_values[0]);
+  EXPECT_EQ(-10, read_values[1]);
+  EXPECT_EQ(11, read_values[2]);
+  EXPECT_EQ(-3, read_values[3]);
+  EXPECT_EQ(4, read_values[4]);
+
+  int64_t wide_values[2] = {0};
+  IREE_ASSERT_OK(
+      iree_vm_list_get_values(list, 3, 2, IREE_VM_VALUE_TYPE_I64, wide_values));
+  EXPECT_EQ(-3, wide_values[0]);
+  EXPECT_EQ(4, wide_values[1]);
+
+  EXPECT_THAT(Status(iree_vm_list_get_values(list, 4, 2, IREE_VM_VALUE_TYPE_I32,
+                                             read_values)),
+              StatusIs(iree::StatusCode::kOutOfRange));
+  EXPECT_THAT(Status(iree_vm_list_set_values(list, 0, 1,
+                                             IREE_VM_VALUE_TYPE_NONE, values)),
+              StatusIs(iree::StatusCode::kInvalidArgument));
+
+  iree_vm_list_release(list);
+}
+
+// Tests bulk get/set of primitive values in variant lists.
+TEST_F(VMListTest, BulkValuesVariant) {
+  iree_vm_type_def_t element_type = iree_vm_type_def_make_variant_type();
+  iree_vm_list_t* list = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_list_create(&element_type, 0, iree_allocator_system(), &list));
+
+  float values[3] = {1.0f, 2.5f, -4.0f};
+  IREE_ASSERT_OK(
+      iree_vm_list_push_values(list, 3, IREE_VM_VALUE_TYPE_F32, values));
+  iree_vm_value_t value;
+  IREE_ASSERT_OK(iree_vm_list_get_value(list, 1, &value));
+  EXPECT_EQ(IREE_VM_VALUE_TYPE_F32, value.type);
+  EXPECT_EQ(2.5f, value.f32);
+
+  float read_values[3] = {0};
+  IREE_ASSERT_OK(
+      iree_vm_list_get_values(list, 0, 3, IREE_VM_VALUE_TYPE_F32, read_values));
+  EXPECT_EQ(0, memcmp(values, read_values, sizeof(values)));
+
+  // Ref elements cannot be read as values.
+  iree_vm_ref_t ref_a = MakeRef<A>(1.0f);
+  IREE_ASSERT_OK(iree_vm_list_push_ref_move(list, &ref_a));
+  float all_values[4] = {0};
+  EXPECT_THAT(Status(iree_vm_list_get_values(list, 0, 4, IREE_VM_VALUE_TYPE_F32,
+                                             all_values)),
+              StatusIs(iree::StatusCode::kFailedPrecondition));
+
+  // Setting values over a ref releases it.
+  float new_value = 8.0f;
+  IREE_ASSERT_OK(
+      iree_vm_list_set_values(list, 3, 1, IREE_VM_VALUE_TYPE_F32, &new_value));
+  IREE_ASSERT_OK(
+      iree_vm_list_get_values(list, 0, 4, IREE_VM_VALUE_TYPE_F32, all_values));
+  EXPECT_EQ(8.0f, all_values[3]);
+
+  iree_vm_list_release(list);
+}
+
+// Tests pushing refs in bulk.
+TEST_F(VMListTest, PushRefs) {
+  iree_vm_type_def_t element_type =
+      iree_vm_type_def_make_ref_type(test_a_type_id());
+  iree_vm_list_t* list = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_list_create(&element_type, 0, iree_allocator_system(), &list));
+
+  iree_vm_ref_t refs[4];
+  for (iree_host_size_t i = 0; i < 4; ++i) {
+    refs[i] = MakeRef<A>((float)i);
+  }
+  IREE_ASSERT_OK(iree_vm_list_push_refs_retain(list, 2, refs));
+  IREE_ASSERT_OK(iree_vm_list_push_refs_move(list, 4, refs));
+  EXPECT_EQ(6, iree_vm_list_size(list));
+  for (iree_host_size_t i = 0; i < 4; ++i) {
+    EXPECT_EQ(nullptr, refs[i].ptr);
+  }
+  for (iree_host_size_t i = 0; i < 6; ++i) {
+    iree_vm_ref_t ref_a{0};
+    IREE_ASSERT_OK(iree_vm_list_get_ref_assign(list, i, &ref_a));
+    ASSERT_TRUE(test_a_isa(ref_a));
+    EXPECT_EQ(i < 2 ? i : i - 2, test_a_deref(ref_a)->data());
+  }
+
+  // Mismatched types fail without changing the list or the refs.
+  iree_vm_ref_t mixed_refs[2] = {MakeRef<A>(6.0f), MakeRef<B>(7)};
+  EXPECT_THAT(Status(iree_vm_list_push_refs_move(list, 2, mixed_refs)),
+              StatusIs(iree::StatusCode::kInvalidArgument));
+  EXPECT_EQ(6, iree_vm_list_size(list));
+  EXPECT_NE(nullptr, mixed_refs[0].ptr);
+  iree_vm_ref_release(&mixed_refs[0]);
+  iree_vm_ref_release(&mixed_refs[1]);
+
+  iree_vm_list_release(list);
+}
+
 // TODO(benvanik): test primitive variant get/set.
 
 // TODO(benvanik): test ref variant get/set.
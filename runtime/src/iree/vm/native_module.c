@@ -491,3 +491,21 @@ IREE_API_EXPORT iree_status_t iree_vm_native_module_initialize(
 
   return iree_ok_status();
 }
+
+IREE_API_EXPORT iree_status_t iree_vm_native_module_lookup_function_ptr(
+    iree_vm_module_t* base_module, iree_host_size_t ordinal,
+    const iree_vm_native_function_ptr_t** out_function_ptr) {
+  IREE_ASSERT_ARGUMENT(base_module);
+  IREE_ASSERT_ARGUMENT(out_function_ptr);
+  *out_function_ptr = NULL;
+  if (base_module->begin_call != iree_vm_native_module_begin_call) {
+    return iree_status_from_code(IREE_STATUS_UNAVAILABLE);
+  }
+  iree_vm_native_module_t* module = (iree_vm_native_module_t*)base_module;
+  if (module->user_interface.begin_call ||
+      ordinal >= module->descriptor->function_count) {
+    return iree_status_from_code(IREE_STATUS_UNAVAILABLE);
+  }
+  *out_function_ptr = &module->descriptor->functions[ordinal];
+  return iree_ok_status();
+}
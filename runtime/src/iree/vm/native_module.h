@@ -136,6 +136,19 @@ IREE_API_EXPORT iree_status_t iree_vm_native_module_initialize(
     const iree_vm_native_module_descriptor_t* module_descriptor,
     iree_allocator_t allocator, iree_vm_module_t* module);
 
+// Looks up the function pointer table entry of the export function |ordinal|
+// in |module| so that callers can cache it and invoke the function directly
+// instead of going through the generic module begin_call. The shim must be
+// called as the default begin_call does: with a IREE_VM_STACK_FRAME_NATIVE
+// frame for the function on the top of the stack, |module| as the module
+// pointer, and the module state of that frame.
+//
+// Returns IREE_STATUS_UNAVAILABLE if |module| is not a native module or it
+// overrides the default call handling.
+IREE_API_EXPORT iree_status_t iree_vm_native_module_lookup_function_ptr(
+    iree_vm_module_t* module, iree_host_size_t ordinal,
+    const iree_vm_native_function_ptr_t** out_function_ptr);
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif  // __cplusplus
@@ -4,15 +4,238 @@
 // See https://llvm.org/LICENSE.txt for license information.
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
+#include <cstring>
+#include <memory>
+
 #include "benchmark/benchmark.h"
 #include "iree/base/api.h"
+#include "iree/base/internal/thread_caching_allocator.h"
+#include "iree/base/status_cc.h"
+#include "iree/vm/buffer.h"
+#include "iree/vm/invocation.h"
+#include "iree/vm/list.h"
 #include "iree/vm/module.h"
 #include "iree/vm/native_module.h"
+#include "iree/vm/native_module_cc.h"
 #include "iree/vm/native_module_test.h"
+#include "iree/vm/ref_cc.h"
 #include "iree/vm/stack.h"
+#include "iree/vm/value.h"
 
 namespace {
 
-// TODO(benvanik): native module benchmarks.
+using iree::StatusOr;
+namespace vm = iree::vm;
+
+// Runs the module_b.entry -> module_a round trip from native_module_test.h
+// the way an application would: creating the argument and result lists and
+// invoking the function each iteration. All host allocations made by the VM
+// (lists, stacks, statuses, etc) come from |host_allocator|.
+static void RunInvokeLoop(benchmark::State& state,
+                          iree_allocator_t host_allocator) {
+  iree_vm_instance_t* instance = NULL;
+  IREE_CHECK_OK(iree_vm_instance_create(host_allocator, &instance));
+  iree_vm_module_t* module_a = NULL;
+  IREE_CHECK_OK(module_a_create(host_allocator, &module_a));
+  iree_vm_module_t* module_b = NULL;
+  IREE_CHECK_OK(module_b_create(host_allocator, &module_b));
+  iree_vm_module_t* modules[] = {module_a, module_b};
+  iree_vm_context_t* context = NULL;
+  IREE_CHECK_OK(iree_vm_context_create_with_modules(
+      instance, IREE_VM_CONTEXT_FLAG_NONE, IREE_ARRAYSIZE(modules), modules,
+      host_allocator, &context));
+  iree_vm_module_release(module_a);
+  iree_vm_module_release(module_b);
+
+  iree_vm_function_t function;
+  IREE_CHECK_OK(iree_vm_context_resolve_function(
+      context, iree_make_cstring_view("module_b.entry"), &function));
+
+  for (auto _ : state) {
+    iree_vm_list_t* input_list = NULL;
+    IREE_CHECK_OK(iree_vm_list_create(/*element_type=*/NULL, 1,
+                                      host_allocator, &input_list));
+    iree_vm_value_t arg0 = iree_vm_value_make_i32(2);
+    IREE_CHECK_OK(iree_vm_list_push_value(input_list, &arg0));
+    iree_vm_list_t* output_list = NULL;
+    IREE_CHECK_OK(iree_vm_list_create(/*element_type=*/NULL, 1,
+                                      host_allocator, &output_list));
+    IREE_CHECK_OK(iree_vm_invoke(context, function,
+                                 IREE_VM_INVOCATION_FLAG_NONE,
+                                 /*policy=*/NULL, input_list, output_list,
+                                 host_allocator));
+    iree_vm_value_t ret0;
+    IREE_CHECK_OK(iree_vm_list_get_value(output_list, 0, &ret0));
+    benchmark::DoNotOptimize(ret0.i32);
+    iree_vm_list_release(input_list);
+    iree_vm_list_release(output_list);
+  }
+
+  iree_vm_context_release(context);
+  iree_vm_instance_release(instance);
+}
+
+static void BM_InvokeSystemAllocator(benchmark::State& state) {
+  RunInvokeLoop(state, iree_allocator_system());
+}
+BENCHMARK(BM_InvokeSystemAllocator)->ThreadRange(1, 8);
+
+// Returns a process-lifetime allocator shared by all benchmark threads as a
+// session would share one across its users. It is never freed as benchmark
+// threads may still be releasing their contexts when another finishes.
+static iree_thread_caching_allocator_t* SharedCachingAllocator() {
+  static iree_thread_caching_allocator_t* caching_allocator = [] {
+    iree_thread_caching_allocator_t* allocator = NULL;
+    IREE_CHECK_OK(iree_thread_caching_allocator_create(iree_allocator_system(),
+                                                       &allocator));
+    return allocator;
+  }();
+  return caching_allocator;
+}
+
+static void BM_InvokeThreadCachingAllocator(benchmark::State& state) {
+  iree_thread_caching_allocator_t* caching_allocator = SharedCachingAllocator();
+  RunInvokeLoop(state,
+                iree_thread_caching_allocator_as_allocator(caching_allocator));
+  if (state.thread_index() == 0) {
+    iree_thread_caching_allocator_statistics_t statistics;
+    iree_thread_caching_allocator_query_statistics(caching_allocator,
+                                                   &statistics);
+    state.counters["reuse_ratio"] =
+        statistics.small_alloc_count
+            ? (double)statistics.small_reuse_count /
+                  (double)statistics.small_alloc_count
+            : 0.0;
+    state.counters["reserved_kb"] = (double)statistics.bytes_reserved / 1024.0;
+  }
+}
+BENCHMARK(BM_InvokeThreadCachingAllocator)->ThreadRange(1, 8);
+
+//===----------------------------------------------------------------------===//
+// Per-call overhead of C and C++ native modules
+//===----------------------------------------------------------------------===//
+
+// C++ equivalent of module_a from native_module_test.h plus functions taking a
+// ref argument either retained (vm::ref<T>) or borrowed (T*).
+class CallModuleState final {
+ public:
+  StatusOr<int32_t> Add1(int32_t value) { return value + 1; }
+
+  StatusOr<int32_t> RetainedLength(vm::ref<iree_vm_buffer_t> buffer) {
+    return static_cast<int32_t>(iree_vm_buffer_length(buffer.get()));
+  }
+
+  StatusOr<int32_t> BorrowedLength(const iree_vm_buffer_t* buffer) {
+    return static_cast<int32_t>(iree_vm_buffer_length(buffer));
+  }
+};
+
+static const vm::NativeFunction<CallModuleState> kCallModuleFunctions[] = {
+    vm::MakeNativeFunction("add_1", &CallModuleState::Add1),
+    vm::MakeNativeFunction("retained_length", &CallModuleState::RetainedLength),
+    vm::MakeNativeFunction("borrowed_length", &CallModuleState::BorrowedLength),
+};
+
+class CallModule final : public vm::NativeModule<CallModuleState> {
+ public:
+  using vm::NativeModule<CallModuleState>::NativeModule;
+
+  StatusOr<std::unique_ptr<CallModuleState>> CreateState(
+      iree_allocator_t allocator) override {
+    return std::make_unique<CallModuleState>();
+  }
+};
+
+// Calls |function_name| with the |arguments| produced by |prepare_arguments|
+// by directly beginning the call on the module each iteration. Unlike
+// RunInvokeLoop this excludes list marshaling and stack setup and only
+// measures the calling convention and argument unpacking of the module.
+template <typename Arguments, typename PrepareFn>
+static void RunCallLoop(benchmark::State& state, const char* function_name,
+                        PrepareFn prepare_arguments) {
+  iree_allocator_t host_allocator = iree_allocator_system();
+  iree_vm_instance_t* instance = NULL;
+  IREE_CHECK_OK(iree_vm_instance_create(host_allocator, &instance));
+  iree_vm_module_t* module_a = NULL;
+  IREE_CHECK_OK(module_a_create(host_allocator, &module_a));
+  iree_vm_module_t* cc_module =
+      std::make_unique<CallModule>(
+          "module_cc", host_allocator,
+          iree::span<const vm::NativeFunction<CallModuleState>>(
+              kCallModuleFunctions))
+          .release()
+          ->interface();
+  iree_vm_module_t* modules[] = {module_a, cc_module};
+  iree_vm_context_t* context = NULL;
+  IREE_CHECK_OK(iree_vm_context_create_with_modules(
+      instance, IREE_VM_CONTEXT_FLAG_NONE, IREE_ARRAYSIZE(modules), modules,
+      host_allocator, &context));
+  iree_vm_module_release(module_a);
+  iree_vm_module_release(cc_module);
+
+  iree_vm_function_call_t call;
+  std::memset(&call, 0, sizeof(call));
+  IREE_CHECK_OK(iree_vm_context_resolve_function(
+      context, iree_make_cstring_view(function_name), &call.function));
+  Arguments arguments;
+  call.arguments = iree_make_byte_span(&arguments, sizeof(arguments));
+  int32_t result = 0;
+  call.results = iree_make_byte_span(&result, sizeof(result));
+
+  IREE_VM_INLINE_STACK_INITIALIZE(stack, IREE_VM_INVOCATION_FLAG_NONE,
+                                  iree_vm_context_state_resolver(context),
+                                  host_allocator);
+  iree_vm_module_t* module = call.function.module;
+  for (auto _ : state) {
+    prepare_arguments(&arguments);
+    iree_vm_execution_result_t execution_result;
+    IREE_CHECK_OK(
+        module->begin_call(module->self, stack, &call, &execution_result));
+    benchmark::DoNotOptimize(result);
+  }
+  iree_vm_stack_deinitialize(stack);
+
+  iree_vm_context_release(context);
+  iree_vm_instance_release(instance);
+}
+
+static void RunI32CallLoop(benchmark::State& state, const char* function_name) {
+  RunCallLoop<int32_t>(state, function_name,
+                       [](int32_t* arguments) { *arguments = 2; });
+}
+
+static void BM_CallCI32(benchmark::State& state) {
+  RunI32CallLoop(state, "module_a.add_1");
+}
+BENCHMARK(BM_CallCI32);
+
+static void BM_CallCCI32(benchmark::State& state) {
+  RunI32CallLoop(state, "module_cc.add_1");
+}
+BENCHMARK(BM_CallCCI32);
+
+// Passes a buffer the way the bytecode interpreter does: the argument slot
+// aliases the caller's reference without retaining it.
+static void RunRefCallLoop(benchmark::State& state, const char* function_name) {
+  iree_vm_buffer_t* buffer = NULL;
+  IREE_CHECK_OK(iree_vm_buffer_create(IREE_VM_BUFFER_ACCESS_MUTABLE, 16,
+                                      iree_allocator_system(), &buffer));
+  iree_vm_ref_t buffer_ref = iree_vm_buffer_retain_ref(buffer);
+  RunCallLoop<iree_vm_ref_t>(
+      state, function_name,
+      [&](iree_vm_ref_t* arguments) { *arguments = buffer_ref; });
+  iree_vm_ref_release(&buffer_ref);
+  iree_vm_buffer_release(buffer);
+}
+
+static void BM_CallCCRetainedRef(benchmark::State& state) {
+  RunRefCallLoop(state, "module_cc.retained_length");
+}
+BENCHMARK(BM_CallCCRetainedRef);
+
+static void BM_CallCCBorrowedRef(benchmark::State& state) {
+  RunRefCallLoop(state, "module_cc.borrowed_length");
+}
+BENCHMARK(BM_CallCCBorrowedRef);
 
 }  // namespace
@@ -31,10 +31,16 @@ namespace vm {
 //
 // Functions are defined on the State type as member functions returning either
 // Status or StatusOr. Arguments are passed as primitive types (int32_t),
-// wrapped ref objects (vm::ref<my_type_t>&), or some nesting of std::array,
-// std::tuple, and std::span to match fixed-length arrays of the same type,
-// tuples of mixed types, or dynamic arrays (variadic arguments). Results may be
-// returned as either their type or an std::tuple/std::array of types.
+// wrapped ref objects (vm::ref<my_type_t>&), borrowed ref objects
+// (my_type_t*), or some nesting of std::array, std::tuple, and std::span to
+// match fixed-length arrays of the same type, tuples of mixed types, or dynamic
+// arrays (variadic arguments). Results may be returned as either their type or
+// an std::tuple/std::array of types.
+//
+// Wrapped refs are retained for the duration of the call and may be stored by
+// the function. Borrowed refs are only valid for the duration of the call and
+// avoid the reference counting; prefer them for arguments that are only used
+// within the call.
 //
 // Usage:
 //   // Per-context module state that must only be thread-compatible.
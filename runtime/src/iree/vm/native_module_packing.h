@@ -199,6 +199,10 @@ template <typename T>
 struct cconv_map<ref<T>> {
   static constexpr const auto conv_chars = literal("r");
 };
+template <typename T>
+struct cconv_map<T*> {
+  static constexpr const auto conv_chars = literal("r");
+};
 template <>
 struct cconv_map<iree_string_view_t> {
   static constexpr const auto conv_chars = literal("r");
@@ -292,11 +296,19 @@ struct cconv_storage_void<0> {
 // implementations of these and prevent code bloat across many modules.
 // We can also try some non-templated base functions (like "UnpackI32") that the
 // templated ones simply wrap with type casts.
+//
+// Each ParamUnpack declares the kByteLength of the argument storage it consumes
+// or kDynamicByteLength if it depends on the argument values (variadic spans).
+// Signatures made only of fixed-length parameters have their argument buffer
+// length checked once before unpacking and each parameter is loaded from an
+// offset known at compile-time.
 
 namespace impl {
 
 using params_ptr_t = uint8_t*;
 
+static constexpr iree_host_size_t kDynamicByteLength = IREE_HOST_SIZE_MAX;
+
 template <typename T, typename EN = void>
 struct ParamUnpack;
 template <>
@@ -305,6 +317,8 @@ template <typename T>
 struct ParamUnpack<ref<T>>;
 template <typename T>
 struct ParamUnpack<const ref<T>>;
+template <typename T>
+struct ParamUnpack<T*>;
 template <>
 struct ParamUnpack<iree_string_view_t>;
 #if defined(IREE_HAVE_STD_STRING_VIEW)
@@ -320,11 +334,89 @@ struct ParamUnpack<iree::span<U>, enable_if_not_primitive<U>>;
 template <typename U>
 struct ParamUnpack<iree::span<U>, enable_if_primitive<U>>;
 
+// Total byte length of the argument storage of the parameters |Ts| or
+// kDynamicByteLength if any of them has a dynamic length.
+template <typename... Ts>
+struct ParamsByteLength;
+template <>
+struct ParamsByteLength<> {
+  static constexpr iree_host_size_t value = 0;
+};
+template <typename T, typename... Ts>
+struct ParamsByteLength<T, Ts...> {
+  static constexpr iree_host_size_t head_value =
+      ParamUnpack<typename remove_cvref<T>::type>::kByteLength;
+  static constexpr iree_host_size_t tail_value = ParamsByteLength<Ts...>::value;
+  static constexpr iree_host_size_t value =
+      head_value == kDynamicByteLength || tail_value == kDynamicByteLength
+          ? kDynamicByteLength
+          : head_value + tail_value;
+};
+
+// Returns an error for a ref argument of |type| passed to a parameter of
+// |expected_type|. Kept out of line so that it is not duplicated into every
+// unpacker.
+IREE_ATTRIBUTE_NOINLINE static inline iree_status_t MakeRefTypeMismatchStatus(
+    iree_vm_ref_type_t type,
+    const iree_vm_ref_type_descriptor_t* expected_type) {
+  iree_string_view_t type_name = iree_vm_ref_type_name(type);
+  return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                          "parameter contains a reference to the wrong type; "
+                          "have %.*s but expected %.*s",
+                          (int)type_name.size, type_name.data,
+                          (int)expected_type->type_name.size,
+                          expected_type->type_name.data);
+}
+
+static inline iree_status_t MakeArgumentLengthMismatchStatus(
+    iree_host_size_t consumed_length, iree_host_size_t storage_length) {
+  return iree_make_status(
+      IREE_STATUS_INVALID_ARGUMENT,
+      "argument buffer unpacking failure; consumed %zu of %zu bytes",
+      consumed_length, storage_length);
+}
+
 struct Unpacker {
   template <typename... Ts>
   static StatusOr<std::tuple<typename impl::ParamUnpack<
       typename std::remove_reference<Ts>::type>::storage_type...>>
   LoadSequence(iree_byte_span_t storage) {
+    using byte_length = ParamsByteLength<Ts...>;
+    return LoadSequence<Ts...>(
+        storage,
+        std::integral_constant<bool,
+                               byte_length::value != kDynamicByteLength>());
+  }
+
+ private:
+  // Fixed-length signatures: the length is verified before touching any of
+  // the arguments and the loads compile down to fixed offsets.
+  template <typename... Ts>
+  static StatusOr<std::tuple<typename impl::ParamUnpack<
+      typename std::remove_reference<Ts>::type>::storage_type...>>
+  LoadSequence(iree_byte_span_t storage, std::true_type) {
+    constexpr iree_host_size_t byte_length = ParamsByteLength<Ts...>::value;
+    if (IREE_UNLIKELY(storage.data_length != byte_length)) {
+      return MakeArgumentLengthMismatchStatus(byte_length,
+                                              storage.data_length);
+    }
+    auto params = std::make_tuple(
+        typename impl::ParamUnpack<
+            typename impl::remove_cvref<Ts>::type>::storage_type()...);
+    Status status;
+    params_ptr_t ptr = storage.data;
+    ApplyLoad<Ts...>(status, ptr, params,
+                     std::make_index_sequence<sizeof...(Ts)>());
+    IREE_RETURN_IF_ERROR(std::move(status));
+    return std::move(params);
+  }
+
+  // Dynamic-length signatures: the length is only known once the variadic
+  // span counts have been read.
+  template <typename... Ts>
+  static StatusOr<std::tuple<typename impl::ParamUnpack<
+      typename std::remove_reference<Ts>::type>::storage_type...>>
+  LoadSequence(iree_byte_span_t storage, std::false_type) {
     auto params = std::make_tuple(
         typename impl::ParamUnpack<
             typename impl::remove_cvref<Ts>::type>::storage_type()...);
@@ -335,9 +427,7 @@ struct Unpacker {
     IREE_RETURN_IF_ERROR(std::move(status));
     params_ptr_t limit = storage.data + storage.data_length;
     if (IREE_UNLIKELY(ptr != limit)) {
-      return iree_make_status(
-          IREE_STATUS_INVALID_ARGUMENT,
-          "argument buffer unpacking failure; consumed %zu of %zu bytes",
+      return MakeArgumentLengthMismatchStatus(
           (reinterpret_cast<intptr_t>(ptr) -
            reinterpret_cast<intptr_t>(storage.data)),
           storage.data_length);
@@ -345,7 +435,6 @@ struct Unpacker {
     return std::move(params);
   }
 
- private:
   template <typename... Ts, typename T, size_t... I>
   static void ApplyLoad(Status& status, params_ptr_t& ptr, T&& params,
                         std::index_sequence<I...>) {
@@ -361,6 +450,7 @@ struct Unpacker {
 template <typename T>
 struct ParamUnpack<T, enable_if_primitive<T>> {
   using storage_type = T;
+  static constexpr iree_host_size_t kByteLength = sizeof(T);
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     out_param = *reinterpret_cast<const T*>(ptr);
     ptr += sizeof(T);
@@ -371,6 +461,7 @@ struct ParamUnpack<T, enable_if_primitive<T>> {
 template <>
 struct ParamUnpack<opaque_ref> {
   using storage_type = opaque_ref;
+  static constexpr iree_host_size_t kByteLength = sizeof(iree_vm_ref_t);
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     iree_vm_ref_retain(reinterpret_cast<iree_vm_ref_t*>(ptr), &out_param);
     ptr += sizeof(iree_vm_ref_t);
@@ -382,6 +473,7 @@ struct ParamUnpack<opaque_ref> {
 template <typename T>
 struct ParamUnpack<ref<T>> {
   using storage_type = ref<T>;
+  static constexpr iree_host_size_t kByteLength = sizeof(iree_vm_ref_t);
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     auto* reg_ptr = reinterpret_cast<iree_vm_ref_t*>(ptr);
     ptr += sizeof(iree_vm_ref_t);
@@ -389,14 +481,8 @@ struct ParamUnpack<ref<T>> {
       out_param = vm::retain_ref(reinterpret_cast<T*>(reg_ptr->ptr));
       memset(reg_ptr, 0, sizeof(*reg_ptr));
     } else if (IREE_UNLIKELY(reg_ptr->type != IREE_VM_REF_TYPE_NULL)) {
-      status =
-          iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
-                           "parameter contains a reference to the wrong type; "
-                           "have %.*s but expected %.*s",
-                           (int)iree_vm_ref_type_name(reg_ptr->type).size,
-                           iree_vm_ref_type_name(reg_ptr->type).data,
-                           (int)ref_type_descriptor<T>::get()->type_name.size,
-                           ref_type_descriptor<T>::get()->type_name.data);
+      status = MakeRefTypeMismatchStatus(reg_ptr->type,
+                                         ref_type_descriptor<T>::get());
     } else {
       out_param = {};
     }
@@ -407,6 +493,7 @@ struct ParamUnpack<ref<T>> {
 template <typename T>
 struct ParamUnpack<const ref<T>> {
   using storage_type = ref<T>;
+  static constexpr iree_host_size_t kByteLength = sizeof(iree_vm_ref_t);
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     auto* reg_ptr = reinterpret_cast<iree_vm_ref_t*>(ptr);
     ptr += sizeof(iree_vm_ref_t);
@@ -414,25 +501,43 @@ struct ParamUnpack<const ref<T>> {
       out_param = vm::retain_ref(reinterpret_cast<T*>(reg_ptr->ptr));
       memset(reg_ptr, 0, sizeof(*reg_ptr));
     } else if (IREE_UNLIKELY(reg_ptr->type != IREE_VM_REF_TYPE_NULL)) {
-      status =
-          iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
-                           "parameter contains a reference to the wrong type; "
-                           "have %.*s but expected %.*s",
-                           (int)iree_vm_ref_type_name(reg_ptr->type).size,
-                           iree_vm_ref_type_name(reg_ptr->type).data,
-                           (int)ref_type_descriptor<T>::get()->type_name.size,
-                           ref_type_descriptor<T>::get()->type_name.data);
+      status = MakeRefTypeMismatchStatus(reg_ptr->type,
+                                         ref_type_descriptor<T>::get());
     } else {
       out_param = {};
     }
   }
 };
 
+// A borrowed `vm.ref<T>` type (`T*`), possibly null.
+// The caller keeps ownership for the duration of the call and no reference
+// counting is performed. Functions that need the object to outlive the call
+// must retain it themselves (or take a ref<T> instead).
+template <typename T>
+struct ParamUnpack<T*> {
+  using storage_type = T*;
+  static constexpr iree_host_size_t kByteLength = sizeof(iree_vm_ref_t);
+  static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
+    using type_descriptor =
+        ref_type_descriptor<typename std::remove_cv<T>::type>;
+    auto* reg_ptr = reinterpret_cast<iree_vm_ref_t*>(ptr);
+    ptr += sizeof(iree_vm_ref_t);
+    if (reg_ptr->type == type_descriptor::get()->type) {
+      out_param = reinterpret_cast<T*>(reg_ptr->ptr);
+    } else if (IREE_UNLIKELY(reg_ptr->type != IREE_VM_REF_TYPE_NULL)) {
+      status = MakeRefTypeMismatchStatus(reg_ptr->type, type_descriptor::get());
+    } else {
+      out_param = nullptr;
+    }
+  }
+};
+
 // An `util.byte_buffer` containing a string.
 // The string view is aliased directly into the underlying byte buffer.
 template <>
 struct ParamUnpack<iree_string_view_t> {
   using storage_type = iree_string_view_t;
+  static constexpr iree_host_size_t kByteLength = sizeof(iree_vm_ref_t);
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     auto* reg_ptr = reinterpret_cast<iree_vm_ref_t*>(ptr);
     ptr += sizeof(iree_vm_ref_t);
@@ -441,14 +546,8 @@ struct ParamUnpack<iree_string_view_t> {
       out_param = iree_make_string_view(
           reinterpret_cast<const char*>(byte_span.data), byte_span.data_length);
     } else if (IREE_UNLIKELY(reg_ptr->type != IREE_VM_REF_TYPE_NULL)) {
-      status = iree_make_status(
-          IREE_STATUS_INVALID_ARGUMENT,
-          "parameter contains a reference to the wrong type; "
-          "have %.*s but expected %.*s",
-          (int)iree_vm_ref_type_name(reg_ptr->type).size,
-          iree_vm_ref_type_name(reg_ptr->type).data,
-          (int)ref_type_descriptor<iree_vm_buffer_t>::get()->type_name.size,
-          ref_type_descriptor<iree_vm_buffer_t>::get()->type_name.data);
+      status = MakeRefTypeMismatchStatus(
+          reg_ptr->type, ref_type_descriptor<iree_vm_buffer_t>::get());
     } else {
       // NOTE: empty string is allowed here!
       out_param = iree_string_view_empty();
@@ -459,6 +558,7 @@ struct ParamUnpack<iree_string_view_t> {
 template <>
 struct ParamUnpack<std::string_view> {
   using storage_type = std::string_view;
+  static constexpr iree_host_size_t kByteLength = sizeof(iree_vm_ref_t);
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     auto* reg_ptr = reinterpret_cast<iree_vm_ref_t*>(ptr);
     ptr += sizeof(iree_vm_ref_t);
@@ -467,14 +567,8 @@ struct ParamUnpack<std::string_view> {
       out_param = std::string_view{
           reinterpret_cast<const char*>(byte_span.data), byte_span.data_length};
     } else if (IREE_UNLIKELY(reg_ptr->type != IREE_VM_REF_TYPE_NULL)) {
-      status = iree_make_status(
-          IREE_STATUS_INVALID_ARGUMENT,
-          "parameter contains a reference to the wrong type; "
-          "have %.*s but expected %.*s",
-          (int)iree_vm_ref_type_name(reg_ptr->type).size,
-          iree_vm_ref_type_name(reg_ptr->type).data,
-          (int)ref_type_descriptor<iree_vm_buffer_t>::get()->type_name.size,
-          ref_type_descriptor<iree_vm_buffer_t>::get()->type_name.data);
+      status = MakeRefTypeMismatchStatus(
+          reg_ptr->type, ref_type_descriptor<iree_vm_buffer_t>::get());
     } else {
       // NOTE: empty string is allowed here!
       out_param = {};
@@ -488,9 +582,13 @@ template <typename U, size_t S>
 struct ParamUnpack<std::array<U, S>> {
   using element_type = typename impl::remove_cvref<U>::type;
   using storage_type = std::array<element_type, S>;
+  static constexpr iree_host_size_t kByteLength =
+      ParamUnpack<element_type>::kByteLength == kDynamicByteLength
+          ? kDynamicByteLength
+          : ParamUnpack<element_type>::kByteLength * S;
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     for (size_t i = 0; i < S; ++i) {
-      ParamUnpack::Load(status, ptr, out_param[i]);
+      ParamUnpack<element_type>::Load(status, ptr, out_param[i]);
     }
   }
 };
@@ -499,6 +597,8 @@ struct ParamUnpack<std::array<U, S>> {
 template <typename... Ts>
 struct ParamUnpack<std::tuple<Ts...>> {
   using storage_type = std::tuple<typename impl::remove_cvref<Ts>::type...>;
+  static constexpr iree_host_size_t kByteLength =
+      ParamsByteLength<Ts...>::value;
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     UnpackTuple(status, ptr, out_param,
                 std::make_index_sequence<sizeof...(Ts)>());
@@ -521,6 +621,7 @@ template <typename U>
 struct ParamUnpack<iree::span<U>, enable_if_not_primitive<U>> {
   using element_type = typename impl::remove_cvref<U>::type;
   using storage_type = std::vector<element_type>;
+  static constexpr iree_host_size_t kByteLength = kDynamicByteLength;
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     iree_host_size_t count = *reinterpret_cast<const int32_t*>(ptr);
     ptr += sizeof(int32_t);
@@ -537,6 +638,7 @@ template <typename U>
 struct ParamUnpack<iree::span<U>, enable_if_primitive<U>> {
   using element_type = U;
   using storage_type = iree::span<const element_type>;
+  static constexpr iree_host_size_t kByteLength = kDynamicByteLength;
   static void Load(Status& status, params_ptr_t& ptr, storage_type& out_param) {
     iree_host_size_t count = *reinterpret_cast<const int32_t*>(ptr);
     ptr += sizeof(int32_t);
@@ -106,5 +106,26 @@ TEST_F(VMNativeModuleTest, Example) {
   ASSERT_EQ(v2, 8);
 }
 
+// Tests that the shim/target of native exports can be looked up for direct
+// calls from callers that cache resolved imports.
+TEST(VMNativeModuleLookupTest, FunctionPtr) {
+  iree_vm_module_t* module_a = nullptr;
+  IREE_ASSERT_OK(module_a_create(iree_allocator_system(), &module_a));
+
+  const iree_vm_native_function_ptr_t* function_ptr = nullptr;
+  IREE_ASSERT_OK(
+      iree_vm_native_module_lookup_function_ptr(module_a, 1, &function_ptr));
+  ASSERT_NE(function_ptr, nullptr);
+  EXPECT_EQ(function_ptr->target,
+            (iree_vm_native_function_target_t)module_a_sub_1);
+
+  // Out-of-range ordinals have no function pointer.
+  EXPECT_TRUE(iree_status_is_unavailable(
+      iree_vm_native_module_lookup_function_ptr(module_a, 2, &function_ptr)));
+  EXPECT_EQ(function_ptr, nullptr);
+
+  iree_vm_module_release(module_a);
+}
+
 }  // namespace
 }  // namespace iree
@@ -17,32 +17,64 @@
 // or something more complex).
 #define IREE_VM_MAX_TYPE_ID 64
 
-static inline volatile iree_atomic_ref_count_t* iree_vm_get_raw_counter_ptr(
+static inline iree_atomic_ref_count_t* iree_vm_get_raw_counter_ptr(
     void* ptr, const iree_vm_ref_type_descriptor_t* type_descriptor) {
-  return (volatile iree_atomic_ref_count_t*)(((uintptr_t)(ptr)) +
-                                             type_descriptor->offsetof_counter);
+  return (iree_atomic_ref_count_t*)(((uintptr_t)(ptr)) +
+                                    type_descriptor->offsetof_counter);
 }
 
-static inline volatile iree_atomic_ref_count_t* iree_vm_get_ref_counter_ptr(
+static inline iree_atomic_ref_count_t* iree_vm_get_ref_counter_ptr(
     iree_vm_ref_t* ref) {
-  return (volatile iree_atomic_ref_count_t*)(((uintptr_t)ref->ptr) +
-                                             ref->offsetof_counter);
+  return (iree_atomic_ref_count_t*)(((uintptr_t)ref->ptr) +
+                                    ref->offsetof_counter);
+}
+
+// Increments the reference count at |counter|.
+static inline void iree_vm_ref_counter_inc(iree_atomic_ref_count_t* counter) {
+#if IREE_VM_REF_COUNT_ATOMICS_ENABLE
+  iree_atomic_ref_count_inc(counter);
+#else
+  iree_atomic_store_int32(
+      counter, iree_atomic_load_int32(counter, iree_memory_order_relaxed) + 1,
+      iree_memory_order_relaxed);
+#endif  // IREE_VM_REF_COUNT_ATOMICS_ENABLE
+}
+
+// Decrements the reference count at |counter| and returns true if the last
+// reference was released and the object must be destroyed.
+static inline bool iree_vm_ref_counter_dec(iree_atomic_ref_count_t* counter) {
+#if IREE_VM_REF_COUNT_ATOMICS_ENABLE
+  // If the caller holds the only reference then no other thread can be
+  // retaining or releasing the object and we can skip the read-modify-write.
+  // The acquire load orders the destruction after prior releases on other
+  // threads just as the acq_rel decrement would. This is the common case for
+  // transient objects that are released by their only user.
+  if (iree_atomic_ref_count_load(counter) == 1) {
+    iree_atomic_store_int32(counter, 0, iree_memory_order_relaxed);
+    return true;
+  }
+  return iree_atomic_ref_count_dec(counter) == 1;
+#else
+  int32_t count = iree_atomic_load_int32(counter, iree_memory_order_relaxed);
+  iree_atomic_store_int32(counter, count - 1, iree_memory_order_relaxed);
+  return count == 1;
+#endif  // IREE_VM_REF_COUNT_ATOMICS_ENABLE
 }
 
 IREE_API_EXPORT void iree_vm_ref_object_retain(
     void* ptr, const iree_vm_ref_type_descriptor_t* type_descriptor) {
   if (!ptr) return;
-  volatile iree_atomic_ref_count_t* counter =
+  iree_atomic_ref_count_t* counter =
       iree_vm_get_raw_counter_ptr(ptr, type_descriptor);
-  iree_atomic_ref_count_inc(counter);
+  iree_vm_ref_counter_inc(counter);
 }
 
 IREE_API_EXPORT void iree_vm_ref_object_release(
     void* ptr, const iree_vm_ref_type_descriptor_t* type_descriptor) {
   if (!ptr) return;
-  volatile iree_atomic_ref_count_t* counter =
+  iree_atomic_ref_count_t* counter =
       iree_vm_get_raw_counter_ptr(ptr, type_descriptor);
-  if (iree_atomic_ref_count_dec(counter) == 1) {
+  if (iree_vm_ref_counter_dec(counter)) {
     if (type_descriptor->destroy) {
       // NOTE: this makes us not re-entrant, but I think that's OK.
       type_descriptor->destroy(ptr);
@@ -109,7 +141,7 @@ iree_vm_ref_lookup_registered_type(iree_string_view_t full_name) {
 // Useful debugging tool:
 #if 0
 static void iree_vm_ref_trace(const char* msg, iree_vm_ref_t* ref) {
-  volatile iree_atomic_ref_count_t* counter = iree_vm_get_ref_counter_ptr(ref);
+  iree_atomic_ref_count_t* counter = iree_vm_get_ref_counter_ptr(ref);
   iree_string_view_t name = iree_vm_ref_type_name(ref->type);
   fprintf(stderr, "%s %.*s 0x%p %d\n", msg, (int)name.size, name.data, ref->ptr,
           counter->__val);
@@ -148,9 +180,8 @@ IREE_API_EXPORT iree_status_t iree_vm_ref_wrap_retain(void* ptr,
                                                       iree_vm_ref_t* out_ref) {
   IREE_RETURN_IF_ERROR(iree_vm_ref_wrap_assign(ptr, type, out_ref));
   if (out_ref->ptr) {
-    volatile iree_atomic_ref_count_t* counter =
-        iree_vm_get_ref_counter_ptr(out_ref);
-    iree_atomic_ref_count_inc(counter);
+    iree_atomic_ref_count_t* counter = iree_vm_get_ref_counter_ptr(out_ref);
+    iree_vm_ref_counter_inc(counter);
     iree_vm_ref_trace("WRAP RETAIN", out_ref);
   }
   return iree_ok_status();
@@ -158,13 +189,18 @@ IREE_API_EXPORT iree_status_t iree_vm_ref_wrap_retain(void* ptr,
 
 IREE_API_EXPORT void iree_vm_ref_retain(iree_vm_ref_t* ref,
                                         iree_vm_ref_t* out_ref) {
-  // NOTE: ref and out_ref may alias or be nested so we retain before we
-  // potentially release.
+  // Retaining a ref into a ref that already holds the same object (including
+  // when they alias) would be an increment followed by a decrement; skip both.
+  if (ref->ptr == out_ref->ptr) {
+    *out_ref = *ref;
+    return;
+  }
+  // NOTE: ref and out_ref may be nested so we retain before we potentially
+  // release.
   iree_vm_ref_t temp_ref = *ref;
   if (ref->ptr) {
-    volatile iree_atomic_ref_count_t* counter =
-        iree_vm_get_ref_counter_ptr(ref);
-    iree_atomic_ref_count_inc(counter);
+    iree_atomic_ref_count_t* counter = iree_vm_get_ref_counter_ptr(ref);
+    iree_vm_ref_counter_inc(counter);
     iree_vm_ref_trace("RETAIN", ref);
   }
   if (out_ref->ptr) {
@@ -211,8 +247,8 @@ IREE_API_EXPORT void iree_vm_ref_release(iree_vm_ref_t* ref) {
   if (ref->type == IREE_VM_REF_TYPE_NULL || ref->ptr == NULL) return;
 
   iree_vm_ref_trace("RELEASE", ref);
-  volatile iree_atomic_ref_count_t* counter = iree_vm_get_ref_counter_ptr(ref);
-  if (iree_atomic_ref_count_dec(counter) == 1) {
+  iree_atomic_ref_count_t* counter = iree_vm_get_ref_counter_ptr(ref);
+  if (iree_vm_ref_counter_dec(counter)) {
     const iree_vm_ref_type_descriptor_t* type_descriptor =
         iree_vm_ref_get_type_descriptor(ref->type);
     if (type_descriptor->destroy) {
@@ -6,7 +6,11 @@
 
 #include "iree/vm/shims.h"
 
+IREE_VM_ABI_DEFINE_SHIM(CrD, r);
+IREE_VM_ABI_DEFINE_SHIM(CrID, r);
+IREE_VM_ABI_DEFINE_SHIM(iCrD, i);
 IREE_VM_ABI_DEFINE_SHIM(irIi, v);
+IREE_VM_ABI_DEFINE_SHIM(irIIIII, v);
 IREE_VM_ABI_DEFINE_SHIM(r, i);
 IREE_VM_ABI_DEFINE_SHIM(r, I);
 IREE_VM_ABI_DEFINE_SHIM(r, ii);
@@ -25,6 +29,11 @@ IREE_VM_ABI_DEFINE_SHIM(ri, v);
 IREE_VM_ABI_DEFINE_SHIM(rI, i);
 IREE_VM_ABI_DEFINE_SHIM(rI, r);
 IREE_VM_ABI_DEFINE_SHIM(rI, v);
+IREE_VM_ABI_DEFINE_SHIM(rIIIrIIII, v);
+IREE_VM_ABI_DEFINE_SHIM(rIIIrIIIII, v);
+IREE_VM_ABI_DEFINE_SHIM(rIIIrIIIrIIIII, v);
+IREE_VM_ABI_DEFINE_SHIM(rIIrIIrIIIIIi, v);
+IREE_VM_ABI_DEFINE_SHIM(rIIrIIrIIIIIiiii, v);
 IREE_VM_ABI_DEFINE_SHIM(riCiD, r);
 IREE_VM_ABI_DEFINE_SHIM(riiCID, r);
 IREE_VM_ABI_DEFINE_SHIM(riCiiD, r);
@@ -32,6 +41,7 @@ IREE_VM_ABI_DEFINE_SHIM(riCrD, r);
 IREE_VM_ABI_DEFINE_SHIM(rIi, i);
 IREE_VM_ABI_DEFINE_SHIM(rii, r);
 IREE_VM_ABI_DEFINE_SHIM(rII, r);
+IREE_VM_ABI_DEFINE_SHIM(rIrII, v);
 IREE_VM_ABI_DEFINE_SHIM(rii, v);
 IREE_VM_ABI_DEFINE_SHIM(rif, v);
 IREE_VM_ABI_DEFINE_SHIM(riii, r);
@@ -39,6 +49,8 @@ IREE_VM_ABI_DEFINE_SHIM(riiI, r);
 IREE_VM_ABI_DEFINE_SHIM(riii, v);
 IREE_VM_ABI_DEFINE_SHIM(riirII, r);
 IREE_VM_ABI_DEFINE_SHIM(riiirII, r);
+IREE_VM_ABI_DEFINE_SHIM(rIrrCrD, v);
+IREE_VM_ABI_DEFINE_SHIM(rIrrrCrIID, v);
 IREE_VM_ABI_DEFINE_SHIM(rrrrCrD, r);
 IREE_VM_ABI_DEFINE_SHIM(ririi, v);
 IREE_VM_ABI_DEFINE_SHIM(rr, i);
@@ -50,6 +62,7 @@ IREE_VM_ABI_DEFINE_SHIM(rrCirIID, r);
 IREE_VM_ABI_DEFINE_SHIM(rriCiD, v);
 IREE_VM_ABI_DEFINE_SHIM(rriiCID, v);
 IREE_VM_ABI_DEFINE_SHIM(rriCirIID, v);
+IREE_VM_ABI_DEFINE_SHIM(rriCiiIID, v);
 IREE_VM_ABI_DEFINE_SHIM(rriiii, v);
 IREE_VM_ABI_DEFINE_SHIM(rrIIii, v);
 IREE_VM_ABI_DEFINE_SHIM(rrirCID, v);
@@ -183,6 +183,13 @@ IREE_VM_ABI_FIXED_STRUCT(iI, {
   int64_t i1;
 });
 
+IREE_VM_ABI_FIXED_STRUCT(iiII, {
+  int32_t i0;
+  int32_t i1;
+  int64_t i2;
+  int64_t i3;
+});
+
 IREE_VM_ABI_FIXED_STRUCT(iii, {
   int32_t i0;
   int32_t i1;
@@ -259,6 +266,14 @@ IREE_VM_ABI_FIXED_STRUCT(rII, {
   int64_t i2;
 });
 
+IREE_VM_ABI_FIXED_STRUCT(rIrII, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  iree_vm_ref_t r2;
+  int64_t i3;
+  int64_t i4;
+});
+
 IREE_VM_ABI_FIXED_STRUCT(rif, {
   iree_vm_ref_t r0;
   int32_t i1;
@@ -342,6 +357,109 @@ IREE_VM_ABI_FIXED_STRUCT(rrrIii, {
   int32_t i5;
 });
 
+IREE_VM_ABI_FIXED_STRUCT(irIIIII, {
+  int32_t i0;
+  iree_vm_ref_t r1;
+  int64_t i2;
+  int64_t i3;
+  int64_t i4;
+  int64_t i5;
+  int64_t i6;
+});
+
+IREE_VM_ABI_FIXED_STRUCT(rIIIrIIII, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  int64_t i2;
+  int64_t i3;
+  iree_vm_ref_t r4;
+  int64_t i5;
+  int64_t i6;
+  int64_t i7;
+  int64_t i8;
+});
+
+IREE_VM_ABI_FIXED_STRUCT(rIIIrIIIII, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  int64_t i2;
+  int64_t i3;
+  iree_vm_ref_t r4;
+  int64_t i5;
+  int64_t i6;
+  int64_t i7;
+  int64_t i8;
+  int64_t i9;
+});
+
+IREE_VM_ABI_FIXED_STRUCT(rIIIrIIIrIIIII, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  int64_t i2;
+  int64_t i3;
+  iree_vm_ref_t r4;
+  int64_t i5;
+  int64_t i6;
+  int64_t i7;
+  iree_vm_ref_t r8;
+  int64_t i9;
+  int64_t i10;
+  int64_t i11;
+  int64_t i12;
+  int64_t i13;
+});
+
+IREE_VM_ABI_FIXED_STRUCT(rIIrIIrIIIIIi, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  int64_t i2;
+  iree_vm_ref_t r3;
+  int64_t i4;
+  int64_t i5;
+  iree_vm_ref_t r6;
+  int64_t i7;
+  int64_t i8;
+  int64_t i9;
+  int64_t i10;
+  int64_t i11;
+  int32_t i12;
+});
+
+IREE_VM_ABI_FIXED_STRUCT(rIIrIIrIIIIIiiii, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  int64_t i2;
+  iree_vm_ref_t r3;
+  int64_t i4;
+  int64_t i5;
+  iree_vm_ref_t r6;
+  int64_t i7;
+  int64_t i8;
+  int64_t i9;
+  int64_t i10;
+  int64_t i11;
+  int32_t i12;
+  int32_t i13;
+  int32_t i14;
+  int32_t i15;
+});
+
+IREE_VM_ABI_VLA_STRUCT(CrD, a0_count, a0, {
+  iree_vm_size_t a0_count;
+  iree_vm_abi_r_t a0[0];
+});
+
+IREE_VM_ABI_VLA_STRUCT(CrID, a0_count, a0, {
+  iree_vm_size_t a0_count;
+  iree_vm_abi_rI_t a0[0];
+});
+
+IREE_VM_ABI_VLA_STRUCT(iCrD, a1_count, a1, {
+  int32_t i0;
+  iree_vm_size_t a1_count;
+  iree_vm_abi_r_t a1[0];
+});
+
 IREE_VM_ABI_VLA_STRUCT(rCiD, a1_count, a1, {
   iree_vm_ref_t r0;
   iree_vm_size_t a1_count;
@@ -401,6 +519,25 @@ IREE_VM_ABI_VLA_STRUCT(rirCrD, a3_count, a3, {
   iree_vm_abi_r_t a3[0];
 });
 
+IREE_VM_ABI_VLA_STRUCT(rIrrCrD, a4_count, a4, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  iree_vm_ref_t r2;
+  iree_vm_ref_t r3;
+  iree_vm_size_t a4_count;
+  iree_vm_abi_r_t a4[0];
+});
+
+IREE_VM_ABI_VLA_STRUCT(rIrrrCrIID, a5_count, a5, {
+  iree_vm_ref_t r0;
+  int64_t i1;
+  iree_vm_ref_t r2;
+  iree_vm_ref_t r3;
+  iree_vm_ref_t r4;
+  iree_vm_size_t a5_count;
+  iree_vm_abi_rII_t a5[0];
+});
+
 IREE_VM_ABI_VLA_STRUCT(rrrrCrD, a4_count, a4, {
   iree_vm_ref_t r0;
   iree_vm_ref_t r1;
@@ -449,6 +586,14 @@ IREE_VM_ABI_VLA_STRUCT(rriCirIID, a3_count, a3, {
   iree_vm_abi_irII_t a3[0];
 });
 
+IREE_VM_ABI_VLA_STRUCT(rriCiiIID, a3_count, a3, {
+  iree_vm_ref_t r0;
+  iree_vm_ref_t r1;
+  int32_t i2;
+  iree_vm_size_t a3_count;
+  iree_vm_abi_iiII_t a3[0];
+});
+
 #if defined(IREE_COMPILER_MSVC)
 #pragma pack(pop)
 #endif  // IREE_COMPILER_MSVC
@@ -457,7 +602,11 @@ IREE_VM_ABI_VLA_STRUCT(rriCirIID, a3_count, a3, {
 // Shims for marshaling arguments and results
 //===----------------------------------------------------------------------===//
 
+IREE_VM_ABI_DECLARE_SHIM(CrD, r);
+IREE_VM_ABI_DECLARE_SHIM(CrID, r);
+IREE_VM_ABI_DECLARE_SHIM(iCrD, i);
 IREE_VM_ABI_DECLARE_SHIM(irIi, v);
+IREE_VM_ABI_DECLARE_SHIM(irIIIII, v);
 IREE_VM_ABI_DECLARE_SHIM(r, i);
 IREE_VM_ABI_DECLARE_SHIM(r, I);
 IREE_VM_ABI_DECLARE_SHIM(r, ii);
@@ -476,6 +625,11 @@ IREE_VM_ABI_DECLARE_SHIM(ri, v);
 IREE_VM_ABI_DECLARE_SHIM(rI, i);
 IREE_VM_ABI_DECLARE_SHIM(rI, r);
 IREE_VM_ABI_DECLARE_SHIM(rI, v);
+IREE_VM_ABI_DECLARE_SHIM(rIIIrIIII, v);
+IREE_VM_ABI_DECLARE_SHIM(rIIIrIIIII, v);
+IREE_VM_ABI_DECLARE_SHIM(rIIIrIIIrIIIII, v);
+IREE_VM_ABI_DECLARE_SHIM(rIIrIIrIIIIIi, v);
+IREE_VM_ABI_DECLARE_SHIM(rIIrIIrIIIIIiiii, v);
 IREE_VM_ABI_DECLARE_SHIM(riCiD, r);
 IREE_VM_ABI_DECLARE_SHIM(riiCID, r);
 IREE_VM_ABI_DECLARE_SHIM(riCiiD, r);
@@ -483,6 +637,7 @@ IREE_VM_ABI_DECLARE_SHIM(riCrD, r);
 IREE_VM_ABI_DECLARE_SHIM(rIi, i);
 IREE_VM_ABI_DECLARE_SHIM(rii, r);
 IREE_VM_ABI_DECLARE_SHIM(rII, r);
+IREE_VM_ABI_DECLARE_SHIM(rIrII, v);
 IREE_VM_ABI_DECLARE_SHIM(rii, v);
 IREE_VM_ABI_DECLARE_SHIM(rif, v);
 IREE_VM_ABI_DECLARE_SHIM(riii, r);
@@ -490,6 +645,8 @@ IREE_VM_ABI_DECLARE_SHIM(riiI, r);
 IREE_VM_ABI_DECLARE_SHIM(riii, v);
 IREE_VM_ABI_DECLARE_SHIM(riirII, r);
 IREE_VM_ABI_DECLARE_SHIM(riiirII, r);
+IREE_VM_ABI_DECLARE_SHIM(rIrrCrD, v);
+IREE_VM_ABI_DECLARE_SHIM(rIrrrCrIID, v);
 IREE_VM_ABI_DECLARE_SHIM(rrrrCrD, r);
 IREE_VM_ABI_DECLARE_SHIM(ririi, v);
 IREE_VM_ABI_DECLARE_SHIM(rr, i);
@@ -501,6 +658,7 @@ IREE_VM_ABI_DECLARE_SHIM(rrCirIID, r);
 IREE_VM_ABI_DECLARE_SHIM(rriCiD, v);
 IREE_VM_ABI_DECLARE_SHIM(rriiCID, v);
 IREE_VM_ABI_DECLARE_SHIM(rriCirIID, v);
+IREE_VM_ABI_DECLARE_SHIM(rriCiiIID, v);
 IREE_VM_ABI_DECLARE_SHIM(rriiii, v);
 IREE_VM_ABI_DECLARE_SHIM(rrIIii, v);
 IREE_VM_ABI_DECLARE_SHIM(rrirCID, v);
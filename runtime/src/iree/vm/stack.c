@@ -188,8 +188,93 @@ struct iree_vm_stack_t {
   // Allocator used for dynamic stack allocations. May be the null allocator
   // if growth is prohibited.
   iree_allocator_t allocator;
+
+  // Optional pool that grown frame storage is acquired from and returned to.
+  iree_vm_stack_frame_pool_t* frame_pool;
 };
 
+//===----------------------------------------------------------------------===//
+// Stack frame storage pooling
+//===----------------------------------------------------------------------===//
+
+// Header written to the head of frame storage while it is in a pool. Pooled
+// storage is unused so we can stash the information required to reuse or free
+// it in the storage itself.
+typedef struct iree_vm_stack_pooled_storage_t {
+  // Total capacity of the storage in bytes, including this header.
+  iree_host_size_t capacity;
+  // Allocator the storage was allocated from and must be freed with.
+  iree_allocator_t allocator;
+} iree_vm_stack_pooled_storage_t;
+
+IREE_API_EXPORT void iree_vm_stack_frame_pool_initialize(
+    iree_vm_stack_frame_pool_t* out_pool) {
+  IREE_ASSERT_ARGUMENT(out_pool);
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(out_pool->slots); ++i) {
+    iree_atomic_store_intptr(&out_pool->slots[i], 0, iree_memory_order_relaxed);
+  }
+}
+
+static void iree_vm_stack_pooled_storage_free(
+    iree_vm_stack_pooled_storage_t* storage) {
+  if (!storage) return;
+  iree_allocator_free(storage->allocator, storage);
+}
+
+IREE_API_EXPORT void iree_vm_stack_frame_pool_deinitialize(
+    iree_vm_stack_frame_pool_t* pool) {
+  IREE_ASSERT_ARGUMENT(pool);
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(pool->slots); ++i) {
+    iree_vm_stack_pooled_storage_free(
+        (iree_vm_stack_pooled_storage_t*)iree_atomic_exchange_intptr(
+            &pool->slots[i], 0, iree_memory_order_acquire));
+  }
+}
+
+// Takes a storage block from |pool|, if any.
+static iree_vm_stack_pooled_storage_t* iree_vm_stack_frame_pool_acquire(
+    iree_vm_stack_frame_pool_t* pool) {
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(pool->slots); ++i) {
+    // Cheap check to avoid dirtying the cache line of empty slots.
+    if (!iree_atomic_load_intptr(&pool->slots[i], iree_memory_order_relaxed)) {
+      continue;
+    }
+    iree_vm_stack_pooled_storage_t* storage =
+        (iree_vm_stack_pooled_storage_t*)iree_atomic_exchange_intptr(
+            &pool->slots[i], 0, iree_memory_order_acquire);
+    if (storage) return storage;
+  }
+  return NULL;
+}
+
+// Returns |storage| to |pool|. If the pool is full the smallest block seen
+// while scanning the slots is freed instead.
+static void iree_vm_stack_frame_pool_release(
+    iree_vm_stack_frame_pool_t* pool, void* storage, iree_host_size_t capacity,
+    iree_allocator_t allocator) {
+  iree_vm_stack_pooled_storage_t* pooled_storage =
+      (iree_vm_stack_pooled_storage_t*)storage;
+  pooled_storage->capacity = capacity;
+  pooled_storage->allocator = allocator;
+  for (iree_host_size_t i = 0; i < IREE_ARRAYSIZE(pool->slots); ++i) {
+    // Swap our block into the slot and carry whatever was there forward if it
+    // is smaller; other stacks may be releasing concurrently so we only ever
+    // inspect blocks we have exclusive ownership of.
+    iree_vm_stack_pooled_storage_t* existing =
+        (iree_vm_stack_pooled_storage_t*)iree_atomic_exchange_intptr(
+            &pool->slots[i], (intptr_t)pooled_storage,
+            iree_memory_order_acq_rel);
+    if (!existing) return;
+    if (existing->capacity > pooled_storage->capacity) {
+      existing = (iree_vm_stack_pooled_storage_t*)iree_atomic_exchange_intptr(
+          &pool->slots[i], (intptr_t)existing, iree_memory_order_acq_rel);
+      if (!existing) return;
+    }
+    pooled_storage = existing;
+  }
+  iree_vm_stack_pooled_storage_free(pooled_storage);
+}
+
 //===----------------------------------------------------------------------===//
 // Stack implementation
 //===----------------------------------------------------------------------===//
@@ -238,7 +323,13 @@ IREE_API_EXPORT void iree_vm_stack_deinitialize(iree_vm_stack_t* stack) {
   }
 
   if (stack->owns_frame_storage) {
-    iree_allocator_free(stack->allocator, stack->frame_storage);
+    if (stack->frame_pool) {
+      iree_vm_stack_frame_pool_release(stack->frame_pool, stack->frame_storage,
+                                       stack->frame_storage_capacity,
+                                       stack->allocator);
+    } else {
+      iree_allocator_free(stack->allocator, stack->frame_storage);
+    }
   }
 
   IREE_TRACE_ZONE_END(z0);
@@ -278,11 +369,23 @@ IREE_API_EXPORT void iree_vm_stack_free(iree_vm_stack_t* stack) {
   IREE_TRACE_ZONE_END(z0);
 }
 
+IREE_API_EXPORT void iree_vm_stack_set_frame_pool(
+    iree_vm_stack_t* stack, iree_vm_stack_frame_pool_t* pool) {
+  IREE_ASSERT_ARGUMENT(stack);
+  IREE_ASSERT(!stack->top);
+  stack->frame_pool = pool;
+}
+
 IREE_API_EXPORT iree_vm_invocation_flags_t
 iree_vm_stack_invocation_flags(const iree_vm_stack_t* stack) {
   return stack->flags;
 }
 
+IREE_API_EXPORT iree_allocator_t
+iree_vm_stack_allocator(const iree_vm_stack_t* stack) {
+  return stack->allocator;
+}
+
 IREE_API_EXPORT iree_vm_stack_frame_t* iree_vm_stack_top(
     iree_vm_stack_t* stack) {
   if (!stack->top) {
@@ -356,10 +459,23 @@ static iree_status_t iree_vm_stack_grow(iree_vm_stack_t* stack,
         iree_allocator_realloc(stack->allocator, new_capacity, &new_storage);
   } else {
     // We don't own the original storage so we are going to switch to our own
-    // newly-allocated storage instead. We need to make sure we copy over the
-    // existing stack contents.
-    status =
-        iree_allocator_malloc(stack->allocator, new_capacity, &new_storage);
+    // storage instead. If a previous stack left grown storage in the pool that
+    // is large enough we adopt it and otherwise allocate new storage. We need
+    // to make sure we copy over the existing stack contents.
+    iree_vm_stack_pooled_storage_t* pooled_storage =
+        stack->frame_pool ? iree_vm_stack_frame_pool_acquire(stack->frame_pool)
+                          : NULL;
+    if (pooled_storage && pooled_storage->capacity >= minimum_capacity &&
+        pooled_storage->allocator.self == stack->allocator.self &&
+        pooled_storage->allocator.ctl == stack->allocator.ctl) {
+      new_capacity = pooled_storage->capacity;
+      new_storage = pooled_storage;
+      status = iree_ok_status();
+    } else {
+      iree_vm_stack_pooled_storage_free(pooled_storage);
+      status =
+          iree_allocator_malloc(stack->allocator, new_capacity, &new_storage);
+    }
     if (iree_status_is_ok(status)) {
       memcpy(new_storage, old_storage, stack->frame_storage_capacity);
     }
@@ -32,8 +32,19 @@ extern "C" {
 // The value was chosen to fit quite a few i32 registers and a reasonable amount
 // of ref registers (that are 2 * sizeof(void*)). For many invocations this will
 // be more than enough to perform the work without needing an additional dynamic
-// allocation/resize.
+// allocation/resize. Deployments with known-deep call stacks can raise this
+// to avoid growth entirely.
+#if !defined(IREE_VM_STACK_DEFAULT_SIZE)
 #define IREE_VM_STACK_DEFAULT_SIZE (8 * 1024)
+#endif  // !IREE_VM_STACK_DEFAULT_SIZE
+
+// Maximum number of grown frame storage blocks retained by an
+// iree_vm_stack_frame_pool_t. Each block is as large as the deepest stack that
+// returned it so this should be roughly the number of invocations expected to
+// be in-flight on a single context at a time.
+#if !defined(IREE_VM_STACK_FRAME_POOL_CAPACITY)
+#define IREE_VM_STACK_FRAME_POOL_CAPACITY 4
+#endif  // !IREE_VM_STACK_FRAME_POOL_CAPACITY
 
 // The minimum size of VM stack storage.
 #define IREE_VM_STACK_MIN_SIZE (1 * 1024)
@@ -53,6 +64,18 @@ enum iree_vm_invocation_flag_bits_t {
   // Attributes invocation timings to the caller instead of a context or
   // invocation-specific fiber.
   IREE_VM_INVOCATION_FLAG_TRACE_INLINE = 1u << 1,
+
+  // Moves ref inputs into the invocation instead of retaining them. The input
+  // list elements are left as null refs and the list must not be reused
+  // without repopulating it. This avoids reference counting on transient input
+  // lists that are discarded after the invocation.
+  IREE_VM_INVOCATION_FLAG_CONSUME_INPUTS = 1u << 2,
+
+  // Enables profiling of execution (when available) for the invocation.
+  // See iree/base/config.h for the flags that control whether this
+  // functionality is available; specifically:
+  //   -DIREE_VM_EXECUTION_PROFILING_ENABLE=1
+  IREE_VM_INVOCATION_FLAG_PROFILE_EXECUTION = 1u << 3,
 };
 typedef uint32_t iree_vm_invocation_flags_t;
 
@@ -191,6 +214,34 @@ typedef struct iree_vm_stack_t iree_vm_stack_t;
   IREE_IGNORE_ERROR(iree_vm_stack_initialize(                         \
       __stack_storage_span, (flags), (state_resolver), (allocator), &stack));
 
+// Caches frame storage grown by stacks such that it can be reused by later
+// stacks. Without a pool a stack that exceeds its initial storage allocates
+// (and reallocates) on every invocation and frees the storage when it is
+// deinitialized; with a pool the storage is returned on deinitialization and
+// adopted by the next stack that needs to grow making growth a one-time cost.
+//
+// The pool holds up to IREE_VM_STACK_FRAME_POOL_CAPACITY storage blocks and
+// prefers keeping larger ones when full. Contexts created with
+// IREE_VM_CONTEXT_FLAG_CONCURRENT run one stack per in-flight invocation and
+// the capacity bounds how many of those can reuse pooled storage at the same
+// time; stacks that need to grow while all blocks are in use allocate their own
+// storage as if there were no pool.
+//
+// Thread-safe; the pool may be shared by stacks used on any thread.
+typedef struct iree_vm_stack_frame_pool_t {
+  // Pooled storage blocks or 0 if a slot is empty.
+  iree_atomic_intptr_t slots[IREE_VM_STACK_FRAME_POOL_CAPACITY];
+} iree_vm_stack_frame_pool_t;
+
+// Initializes an empty |out_pool|.
+IREE_API_EXPORT void iree_vm_stack_frame_pool_initialize(
+    iree_vm_stack_frame_pool_t* out_pool);
+
+// Deinitializes |pool| and frees any pooled storage.
+// All stacks using the pool must have been deinitialized.
+IREE_API_EXPORT void iree_vm_stack_frame_pool_deinitialize(
+    iree_vm_stack_frame_pool_t* pool);
+
 // Initializes a statically-allocated stack in |storage|.
 // The contents of the |storage| can be anything upon initialization and the
 // stack must be deinitialized with iree_vm_stack_deinitialize before the
@@ -240,10 +291,21 @@ IREE_API_EXPORT iree_status_t iree_vm_stack_allocate(
 // Frees a dynamically-allocated |stack| from iree_vm_stack_allocate.
 IREE_API_EXPORT void iree_vm_stack_free(iree_vm_stack_t* stack);
 
+// Sets the |pool| that |stack| acquires frame storage from when growing and
+// returns its grown storage to when deinitialized. The pool must remain valid
+// until the stack is deinitialized. Must be called before any frames are
+// entered.
+IREE_API_EXPORT void iree_vm_stack_set_frame_pool(
+    iree_vm_stack_t* stack, iree_vm_stack_frame_pool_t* pool);
+
 // Returns the flags controlling the invocation this stack is used with.
 IREE_API_EXPORT iree_vm_invocation_flags_t
 iree_vm_stack_invocation_flags(const iree_vm_stack_t* stack);
 
+// Returns the allocator used for stack-related host allocations.
+IREE_API_EXPORT iree_allocator_t
+iree_vm_stack_allocator(const iree_vm_stack_t* stack);
+
 // Returns the top stack execution frame, ignore wait frames.
 IREE_API_EXPORT iree_vm_stack_frame_t* iree_vm_stack_top(
     iree_vm_stack_t* stack);
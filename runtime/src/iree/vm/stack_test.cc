@@ -6,6 +6,9 @@
 
 #include "iree/vm/stack.h"
 
+#include <thread>
+#include <vector>
+
 #include "iree/base/api.h"
 #include "iree/testing/gtest.h"
 #include "iree/testing/status_matchers.h"
@@ -120,6 +123,82 @@ TEST(VMStackTest, StackOverflow) {
   iree_vm_stack_deinitialize(stack);
 }
 
+// Allocator that counts allocations and forwards to the system allocator.
+static iree_status_t CountingAllocatorCtl(void* self,
+                                          iree_allocator_command_t command,
+                                          const void* params,
+                                          void** inout_ptr) {
+  if (command != IREE_ALLOCATOR_COMMAND_FREE) ++*reinterpret_cast<int*>(self);
+  iree_allocator_t system_allocator = iree_allocator_system();
+  return system_allocator.ctl(system_allocator.self, command, params,
+                              inout_ptr);
+}
+
+// Tests that storage grown by one stack is reused by the next via a pool.
+TEST(VMStackTest, FramePoolReuse) {
+  iree_vm_state_resolver_t state_resolver = {nullptr, SentinelStateResolver};
+  int allocation_count = 0;
+  iree_allocator_t allocator = {&allocation_count, CountingAllocatorCtl};
+  iree_vm_stack_frame_pool_t pool;
+  iree_vm_stack_frame_pool_initialize(&pool);
+
+  iree_vm_function_t function_a = {MODULE_A_SENTINEL,
+                                   IREE_VM_FUNCTION_LINKAGE_INTERNAL, 0};
+  for (int i = 0; i < 2; ++i) {
+    allocation_count = 0;
+    IREE_VM_INLINE_STACK_INITIALIZE(stack, IREE_VM_INVOCATION_FLAG_NONE,
+                                    state_resolver, allocator);
+    iree_vm_stack_set_frame_pool(stack, &pool);
+    // Enter enough frames to exceed the inline storage several times over.
+    for (int j = 0; j < 1000; ++j) {
+      iree_vm_stack_frame_t* frame_a = nullptr;
+      IREE_ASSERT_OK(iree_vm_stack_function_enter(
+          stack, &function_a, IREE_VM_STACK_FRAME_NATIVE, 0, NULL, &frame_a));
+    }
+    iree_vm_stack_deinitialize(stack);
+    if (i == 0) {
+      // First stack has to grow.
+      EXPECT_GT(allocation_count, 0);
+    } else {
+      // Second stack adopts the pooled storage.
+      EXPECT_EQ(allocation_count, 0);
+    }
+  }
+
+  iree_vm_stack_frame_pool_deinitialize(&pool);
+}
+
+// Tests that stacks on many threads can share a pool.
+TEST(VMStackTest, FramePoolConcurrent) {
+  iree_vm_state_resolver_t state_resolver = {nullptr, SentinelStateResolver};
+  iree_vm_stack_frame_pool_t pool;
+  iree_vm_stack_frame_pool_initialize(&pool);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&]() {
+      iree_vm_function_t function_a = {MODULE_A_SENTINEL,
+                                       IREE_VM_FUNCTION_LINKAGE_INTERNAL, 0};
+      for (int j = 0; j < 16; ++j) {
+        IREE_VM_INLINE_STACK_INITIALIZE(stack, IREE_VM_INVOCATION_FLAG_NONE,
+                                        state_resolver,
+                                        iree_allocator_system());
+        iree_vm_stack_set_frame_pool(stack, &pool);
+        for (int k = 0; k < 256 * (1 + j % 4); ++k) {
+          iree_vm_stack_frame_t* frame_a = nullptr;
+          IREE_ASSERT_OK(iree_vm_stack_function_enter(
+              stack, &function_a, IREE_VM_STACK_FRAME_NATIVE, 0, NULL,
+              &frame_a));
+        }
+        iree_vm_stack_deinitialize(stack);
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  iree_vm_stack_frame_pool_deinitialize(&pool);
+}
+
 // Tests unbalanced stack popping.
 TEST(VMStackTest, UnbalancedPop) {
   iree_vm_state_resolver_t state_resolver = {nullptr, SentinelStateResolver};
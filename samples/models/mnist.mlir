@@ -10,6 +10,11 @@
 //
 // Input : a single 28x28 pixel image as a tensor<1x28x28x1xf32>, with pixels in [0.0, 1.0]
 // Output: a tensor<1x10xf32> containing prediction confidence values for each digit in [0, 9]
+//
+// @predict_image is an entry point for raw camera frames that performs the
+// preprocessing as part of the program: a tensor<64x64x1xi8> of unsigned 8-bit
+// grayscale pixels in HWC layout is center cropped to 56x56, downsampled 2x,
+// and normalized to [0.0, 1.0] before calling @predict.
 
 module {
   util.global private @"__iree_flow___sm_node17__model.layer-1.kernel" = dense<"0x40CDBC3B00CAFABA6A47443D78EC2D3D000037BA8EA5413D506FE73C7C9EBD3CD8D14C3C4040E03A1BE206BDC069993A8E614E3D44352BBD561B583D57D5A4BD7BE03BBD04244CBDF029ADBB50E275BD00FFDF3C96A9093D0012D1BA78360F3D30BC2CBC9EA3383DD8C37D3CE84413BCF1E78B3D02A3193D484497BC3CE2033D1E72713D5EB2A1BCF85B2D3D7CC5ED3CBACE7C3DD0F11ABC692A43BD06A57A3D0C85AA3C01B99C3DEDA6803D46321B3D500FC53B0FB9953D74A19EBD5D61A23DC2C5523D496A18BDCCD2C6BC709D523C40F57BBC18DF1F3C94B2273D54D1C43CBB1B8A3D76BB713DBA41473DBC0A83BC483305BCA8FA5D3CD511883D2AFA453D69A15ABD085CCABC4CEC86BDEDAB913DA4ACB5BC5B871ABD10602ABCA8B95E3C1895E63C72479DBDDDF11FBDB8F404BC81C6A23DB47D0F3DB22F5F3DBE14283D8F572FBD375C9ABDA53450BDF80582BC44FA083DA55D983D0CF393BC14F30D3DC1D2A4BD4C14DDBC78CE0F3DB8340E3D78EC8E3C83B9813DDC69CA3C601F28BC706892BDBD3400BD6C9C48BD50881D3C0D9110BD229D563DD06B623C40A00BBB6ADEFCBC00EF103B7230713D484791BCC8377C3CBB0797BD864E7E3D189977BC9012C23B9C4A89BC8624483D3244443D518B3FBD7DC1923D85528B3DE0E1ACBB00A3FF3C50793EBCB2D612BDCB52923D130F92BDC8D34DBC90FD573C4A284FBD0267A4BC6ACC443D86E5B6BC3E9983BD08F74B3C838A8CBD80931E3A42DC1ABD001291BCC19595BDB04B16BCEC3EAB3CC6FC433D58F94DBDF0753EBDC1888B3DF3320ABD345945BD6AF008BDF23A16BD993A7DBD806F273D98A6263DE09432BDC4332E3D307419BC98A3C3BC4A9C573D305EE83C1D1E88BD27F653BD4E73103D5432193DC1C9933D7246ACBCB4D2DABC835201BD086871BC684CE93CB8BB09BD68664CBD891058BD960B6D3DE1C1933D6A573D3DD27F8BBD7A78483DC551893DE6050BBDFDB232BD3A3010BDA34B853D0397813DDED39BBDD0C7003D1CE3D63C8EC1763D14F66ABD0015773BADACA33D841C70BDAFAA993DD0DA7CBC107BC23BD48A903CF76F933DA833063C2A779EBD683207BDF0D62B3DA0E80B3D132786BD8E1925BDA1A6A23DCCFECC3CF455163DE164853D049186BD241DA1BD7DF911BD923A423D36456C3D6093DA3BF813AB3C65859F3D38F60D3CB080B0BB407AFA3AE31E8ABD3181963D5E711C3D52B3013D020179BD8A76553DFE3255BDC46B85BC90E2873CEA728DBDE4458ABC364E36BD640AEE3CF0593BBD539F9ABD00071A3DBEC23A3DB6C35CBD18F6153CBB06A2BD5AF66FBDEC0FFEBC185D6BBCBF07933DBE11693D8BA44ABD5AE8493D79ECA23D7860203C30F8913CC23208BD4959953DB24A88BD805E2EBB598F9A3D34262B3DE430F03CDE9D10BDC267673D0E8A303DCF8E91BDE062BDBC5A34633DFFE62ABDF4D8C1BC8374A2BDB429F63C9CFA4FBD15EC843DEA2796BD5441F83CC01DD43C56E244BD907CDABC67C3863D4C452A3DB2F157BD441D80BDE8B633BD56670F3DE82D43BC98AF3D3CF6F8493D502EFB3B7A60453D6F0F1ABD419CA03DA8E6283C5A3BABBCB0869B3C00B8A0B836F4023D983B97BC398483BDD80564BCE67CC3BCB83707BDE864EF3C3B9D9E3D28DB28BCDA952B3D245A87BD086AA8BC58B5663C6E55163DB61D213D9B271EBD089C55BC16DD1A3D8ABF2F3DAF6E9B3D99BC953D4032ED3B1AE266BDA47E81BC607388BC6EDDE1BC00DDA2BB8D988CBDE7EB47BDD6286F3D1EAF6D3D08A4E5BC18D41B3D06483DBDA70D923DCC0819BDC94A16BD6C519FBC941A07BD105C5E3CF0D32D3C2B1C873DCC8AAB3CCE6D33BD0A25063D3D54A13DD9968A3D4F3A893D85ECA33D50A09DBDAC3561BD78875CBDA0269A3CB05891BCF878153D405EFF3BA7B093BD10D0943B4BF5A5BD5C40F23C04F1A43CCC1EF93C568271BD5FB8843DB03DACBCB0E31F3DF2C75FBD9674EABCDACE98BD60CFC2BB401F5EBD4B698F3DAB3499BDE6D51F3D5D3C87BD80DE77BBE0B8373B0E0AA4BD89C3823D091198BD8A40773DFD0E0CBD8AA3ABBCE076433B68B3813C788A0A3CDF6E9CBDF83E043C18D2AEBC50E4913C8ADE9CBDC605EBBCCCEAC13CA8D5E0BCABE043BDD097EA3BC82B173C785C13BD7B959CBDBA405ABD04A8A7BCA179983D3E4D493DB0F7F53B432122BD819F963D2A4D92BD1BC5A23DC10C913DB275513D2887913C4485A13C5EAE533D4037FEBA41B09A3DB2DA7B3DA1DC9D3D7F6E37BDF71F46BD0006C6B990DEBE3BF6D93D3D286E1A3CB0549DBD50B18B3C744550BDACB62D3D4675583D31E535BD00229FBB4C982ABD974C863D3C2297BDCCAB1EBDA441E5BC3A8B8FBDD1FD9FBD0820223C703F823CF8AF4BBC35C372BD3FEC35BD32CBE0BC0AFD87BD0E25A4BD2DFF91BDB09255BC76B0373DB65E313DC03751BCB485B2BCA9658F3D38A004BC2803913C481036BD606546BDB8D83DBC18D640BC220B733DBBBE8F3DE167963D98BB81BC641DD93CD22DA1BD08F3D73C48852A3C851712BDBB9CA13D908986BB58D04A3C536123BD0058EBB8CACE2BBD104FCFBB00D63BB92AFF453DCE7F0B3DEE9807BDF8D6C9BCB0409ABD64018DBCA80A9C3C92F54D3D55BA5ABD0CEA1A3DD64A51BD05AF5EBD78B249BD5114A43D10C2123CA6F27FBDD09D873B9A4A7ABD40E7F13C9AB85F3D8B614DBD0012B23BA33293BD5521923DB49B71BD7434193DC04B15BB584F213DD73825BDAC0DACBCF83A2D3C6BD0813DA6EE57BD2877AF3CB29C0DBDCC28D33C52413E3D6DEE13BD483DECBCC02B393B8D3D9FBD997A9FBDEDCB1CBDA8A1213DB69B3D3D6A68133D1A83483D307FACBC08D51CBD02AC563D26903A3D3BA1973DD0979D3CEE973F3D8014C0BA30A0CF3B002766BDF4E9BB3C2A2482BD7DFBA13DE69B9CBDE085963CF75E8E3D00348F38F3EDA53DCA73513DE2694EBD1AAA6D3D3DC9853DAE2D6B3D30659CBD646978BD74F01A3D08A01A3D18BB333CC42D0FBDACB01F3D909D1D3CC14E7DBD3617063D5C5E8FBCE47E83BD68A6563CE02A183B2A5E00BD40C5763B65B586BD4BF9943D565E303DDC06AC3C00B81ABA18D7543CFA039EBCF36D49BD883C4CBC4ED49DBDE0F6D5BC91798FBD8598A53DF2EC653DCEB220BDD21483BD7D56953D3A5F8EBD600D7FBC7D6483BDCB4887BD807481BCE97484BDE875443C80A39FBD8C918E3CD697FABCE2864BBD51A0A3BDBD7897BD67209FBDC13D9BBD0A90483D073D8C3D35C546BD1076A83BE185963D8050AA3CE04344BBDBFF81BDD093A2BD2C69D8BC3A512A3D8010EBBB9A15583DFB8D903DC6BA7D3D6599813D128C6A3D10FF223D80F2C0BB3A59133D31193BBD8611D0BCA28833BDBD67A23D1724843DCE8F60BD3F64923D2497023D3E3D62BD922E6A3D50F6753CD89F083C988E88BD88E0743C87BC89BD641BEE3CAF479C3D4EDA12BD4A4187BD4C6EBEBC9680363D146686BD906D3EBC487E2ABD4C8BA1BDEAFE25BDD4518CBC0C55F13CBABE733D707725BD30BE5F3C3C246CBDC05ACFBA296B9EBD40443FBBB8C3643C785B1C3D38DCE13C380721BC326894BD4005923C340D3ABD3836F53CB26B0F3D35479ABD8F2691BD77378E3DA241733D0071A4B9C0CF14BCF8FBC8BC60E4933BEF608BBDC9796FBD008939BA51378FBD5BB434BD42D35BBD87B2963DC006AABBF88311BCD43080BCE8A855BDDA3A493D7205593D2DFE823D7CD1CC3CD20F653D944F46BD8DF13EBD31D9923D28D95D3C2C2AA73C002B79BA002837BCED6A943D58A317BC6437FDBC2618F6BC6A57E0BC3177833D1BF4A23DF819A3BD40232DBD2AC2143DC0BE2BBD199592BD103754BCC822113CCAA6263DF0937A3C00304BB8038C8A3D8092CA3CBCCF82BD0C04DFBC4FC360BDFAF45D3D9D6C823DD9484ABD08D62B3DC554A33D3026333D666846BDCE5105BD693F3ABD81B6803DE09A143B002426BD20D19B3BB0480B3CF3BC9D3D5F029F3DDE888CBD48A0B73C3A096B3D943EFF3C27429E3D02282F3DFC659DBD0C328ABD6A4CCDBC5041A93BF56A8C3D911B58BDCE1B81BDEAA0313DA2B517BD9A8E4C3DCE7E8BBD9FD852BD0DD799BDE8F942BCDE59203D3FFC8A3DC08541BB80F1413C5837BE3C1E477B3D682EAEBC43F6893D95E48D3D803E7B3B78B923BC00AADF3CC7AC93BD91A6A23D9D22893D03A033BD1B58893DA16411BD8DF716BDACE776BD2EC9BBBC585D6B3C605E303D96A36D3D442ADBBC4A279CBDDA09FDBC4C7E9E3C9047303C7C405ABD5F63953DECB701BDE8C73F3CC0EE6CBC40730B3C4878243D3C41CCBC3CDB93BD809F4E3BB41FFE3CD67675BD600B5D3BCE6DDABCF080073C695058BDCC9D60BD508133BD3B98A43DB28A153D80F529BC712491BD00B13EBA605482BB0004AC3B42A36B3DDA9B683D0CCB9F3C608063BB743EB23C1CCE97BD3052733C0AD700BD12AE6E3D8901983DE8D176BC93DF9F3D9A76153DCA4ACDBCC01A3B3BE0ED0D3CFA4E153D45AF31BDAFD2903D1DB295BD245180BCBA6527BDDEA12A3DA82FB43CAA8E663D30B84F3C3078223C95CD9E3DC4A7B0BC60F6EE3B505BCC3C0AA08BBD8E9B3BBD20C3133BC1984CBD6EED653D689CDF3C583348BC7089D0BB19C997BDAA4A8ABD0834C5BCFA7AEBBCCE6410BD82C64DBD58F9B13CDC10A73CD5FF1FBD2A7E64BDECDA0C3DEEAD09BDB417A4BDFC50DC3C1A97183DEC8FE43CEA91353D853335BD683D5FBD0AB3593D68B3E23C24A3D43CE8BAE53CA23A3D3D302163BCDEE6D1BC4D3C00BD26A56C3D4A32773D9E547DBD669A483D0CCFC7BCE8A2613C889305BC41418A3DB0BCBBBCFD5A9C3D00F4BA3B866C44BD716C2BBDDE1E93BDAB6A9F3D10BB77BD668FB2BCB06828BC1E393D3D90FA1ABCB1F1973D8C8BC53C90375FBC8847263D0C5182BDD8E3FC3CCC557EBDDEE637BD9B5944BDDB77A5BD6CB9A1BDEADE9CBDB8897B3C1CD2CE3C90ED6ABD3CBC99BD60BD1C3CE49F9A3C95BF8BBD695C5BBD9E7E69BD8C1BBFBC02442B3DA36F903DBC949A3C43D5A1BD7B76913DFCB1F83CFB56993D422465BD106BD43BDEFA98BDC01873BC96BC383DC065E73BFE55783D00AF80392FA38BBDC0F18BBC605064BD00B8803CFCD6BD3C50A418BCFE263A3D008C1F392192A03D540E11BD5C713BBD60375FBC1B111FBDEEBD663D4152803D63AA27BD3B67983DC8F3F13C0494863C06D15EBD529F2B3DB8438BBCF1E774BD3632423DA4D786BD98EB6BBC9E67623D288DB33CFE8BE4BC87D8813D347B0E3D6023E6BC44182B3D76BD78BD894C02BD751DA53DBFF89FBD9114A33D9401A7BC083A0E3C367E6CBD7618783D512B70BDF08581BCE03390BCE76390BDD0176B3CC069BFBB666D5F3D36D73E3D406ABC3B5C5E5FBDEA010D3D403DCB3BA18D893DE07B213B0093F43BB6C29CBDA47DBA3CD95409BD6E7392BD78C191BD63DA92BD7206383D007020B8FCC4173D886B1D3D2FF1823DED5C883D3CD7BF3CE0EB2E3BE29664BD410994BDC0856FBB42A426BD51E5923DC2FD783DE0D02E3D9D7764BDF8595DBC3666393DB21D773D759E99BDB291343D6C7EE6BCF8EFD83C36AF35BD6060343BDE539FBD0A5FB6BC1CB89F3CF2E2A1BCA73103BDEA3E8EBD003C0D39E896013D8C8B0EBD2C03E63CEC5D993CD9BF9E3DD61A0D3DE465C13C078416BDB0C5C93CCC65A63C0006D33B4DAF9DBD5E63A4BD15841CBD7FFE3CBD84A1EA3C70F0B33CDE134EBD28459BBDB05A69BCAC60B8BCFCA392BCA478A4BDA432F5BC007AB93CE9131DBD67EB2FBD04DEF93C54A8A5BCE2C8A6BC10FEF03C5041103C40BAAFBB0096F33CBABA523DE6DE3BBDD04F8F3BBDF787BDBF5B3FBD3492A1BC54D10F3DF87C19BDDB3143BDDA5C16BDCC0325BDCBCA76BDB51D08BD6ECD123DDC463FBD223B9CBD489599BD19C7A33D3D6180BDBEB3D3BC5F9A9D3D1E04413DCA8F483DED3526BDEF2D29BDDE53693DC8035BBC7CC6F93C60278B3CB07A8E3BF57112BD90B6BB3C3E39193D5FA7A23D6CF9303D141B0D3DF4C68BBD8066F6BBD87190BD72895B3D204714BB0D2B913D1EC1A5BD43C5853DCABEF3BCCCBF2D3D9ED3213D5C601D3D68B73B3CB04E3FBDDA60373DBA8E5D3DEA3A82BD7BA547BD4A978DBD174F3BBD202A4D3BC2E0543DD8B5EFBCF4221C3D0000B037998788BDD2DFD9BCF5018A3DE8490E3D10E12F3D7C4762BD786D2A3D0CCFA3BC00987DBB456B823D04CD14BD7008A73B6079E93BE79721BD68692E3CF497AA3C568B433D381C22BC885A373CBAE26CBD20FF35BD3C110F3DEE914ABDB815A23CE070633BDB8828BD8EC584BD942F94BDA0F60DBD746A0A3DA51A0FBDE8CCDF3C0C4B4FBDF7FDA4BDA0C611BC12073C3D51E18A3D9818A83C9B371EBD2EE4513D088BA9BC4092F63AD4DAFA3CBA7AF4BC7CCBBE3C46685C3DC20E6A3DB0AC6A3C9CA3113DAC302C3DE0D7803CA47C92BC8FF78B3D202DF3BBC0E12BBCE8114ABC474C9A3D4D8B11BD9B2F813D38EB82BD30F5C3BC165D273D6017B6BC0301A23D288B7C3CC1A217BDC4F0B0BCF957803D48ED133C27DB4ABDB8721E3D2D20973DFE6CDABCE13096BDC526813D5EDF78BD70D989BC5FB90ABDBEBCA1BCB89C47BC5EBD39BDBEDC693D725B203D49079A3D30594DBD6CB98BBCFD2392BDF06A993B68DF733CC48F39BDA09FBEBBDEC0753DCC5583BD6C41F43C03E48F3DACCBA63CF8B8783C5684CDBC7A8E9BBCFCF7063D0360853D3C5EB0BCCBF29BBD606896BB485DF4BC9A6F4A3D9AE86C3D20D088BC74C1C2BC008AF8BC764C0E3DC05A9C3C58A5033CBA60683D4A3930BDD81E08BD0E1E2CBD2F83953DBFBF9FBD4840713CFAB02B3DA6BCFEBC58DDD9BC8C9852BD9669443DB5ED883D3C16EE3C83E1853D6091013DFDF2933DDE8CCCBC9D619E3D0CE89FBD80EA053C5A4857BD50D4C93B637B8BBDB5AE943DE8C74ABCBAC0753DC0AC92BB39648C3D04E29FBDF52A993D0045093BFAADEFBC107E73BC3046EE3BD0E252BCA2BF673DCD02933D0066853999AA41BD354E2BBD7F28A3BDB1CA39BD8A1436BDF0A5253D04C6103D2A510A3D418793BD204222BB1E3E6D3D18AA903C5ECCC2BCD349A33D2F209F3D78D2D1BCD8F718BD4019E2BC72E141BD6DAE863D25D849BD9ADBCEBC05FF66BD816904BD205049BB7E1D093D5E57033D040B9ABC8A2C98BD852996BD30399E3CFC472F3DCC7B73BD2E66DDBC2249633DF77C03BDDE805EBDCED370BD9AEF343D26AB22BDAB5388BD836902BDA8FD283DA8D979BD35A2803DB005103C088C47BD5137943DDA10A5BC3F4D943D61AC9DBD367D4FBDE17849BDA307843D1BE90EBD91D187BD4C0098BC4048BEBC7CBC293DD2712F3DF78F983DBA945D3D869D353D01B08A3DE2CA6E3D92331E3D3C7E813C15BCA23D496092BDD0F597BB8061C2BCDE74E2BCDCCE813CA5DA8FBD955E833DD88D013D52BC6CBD92FA2C3DF97706BD108D733C4BDE903DE2F83C3D0FB4973D47F786BD7EBF2ABDFC27EFBCA9B285BDD07BFA3C468A503DC0FA833AECDEC3BCA002D73C48D0833C2267593D3E3B273DF035CF3B602451BC580780BC9F72A1BDFCEABF3CE57E80BD483994BD8071A5BCCFC326BDE6124D3DA008BCBB5A504F3D5BB7973D7E609BBCE06225BBF4BA88BD93173CBD80B053BA63C6923DAFE310BDB8D16B3C000CCF39A03659BD3A387DBD9CDBE1BC8A83213DD01A97BDBE472F3DF090FDBCEEBF5F3DBBD69A3D93CCA03D30E238BDB4F897BC78073DBC4E7DDFBC9C349B3CE0547B3B120658BD308EB6BBF883693C0E1C6A3D0B4E903D908B453CA8739F3C06F3CFBCC429ED3CADB1873DDB51A13DD06DD53B98101BBD1A8F93BD744AC83CCF21A0BD222DA7BC50EB143DB38493BD70A4EA3CA867B83C3652D0BC1CBD2F3D965BA1BD9483E33C814F893DFFEF833DEB6888BD405E6ABCC843333CD4A9B3BC5D8029BD78D25BBD8C60023D83EE833DB044593CF3A010BD480CC03C86065A3D1C7D993CC0FA1F3B007E0FBC56F1EABC80BD113A789A39BDF0323C3C2679103D96656C3D956A88BDC3CF963D1579933DD0E28F3BB629353DC896283D902D3EBC208527BB68F72A3C53A98B3DFE0F7F3DF2E0C6BC067C29BDDA9B96BD415B90BD8100983D102E9ABBBC702ABDBEFD94BDC21779BDB65216BD6E8E123D8B9EA53D844DD53C712007BD50E99ABB488AC13C783CE1BC5AEC593D8E1A433D2FA89FBDB06AB4BB4840D6BCE070E13BE909813DDFDE24BDC03C83BAE0661B3B98DCD5BCEE9599BDE3941FBDFE81D8BCB0985BBCDDBFA03DFEEE6CBDEFC6903DD813553C882316BC2DDB1CBD2C0144BDE39AA23DD9E79F3DD8DC8CBCF600A2BD3C7894BD14199CBD40F0F3BB90B6DABC016F42BD84DB9FBD14CF053D612B0CBD0052BBBAABB5A1BDBE421FBDD2C63A3D765526BD90F1073DF02DAD3C0F599DBD8472EDBCE84CD2BC9000CC3BA24152BDD4C02D3DFAF29FBD3D00823D24BC83BD002D8039C40E133DE02BF1BB8BBA873D16655D3D0A6C9FBD9495E03CA7AF82BDBC6E323DF486E73CA0387F3B5C0481BDB14625BD18162E3D79D2913D4C0CEEBC00E026BB50738CBD18E8F2BCA08129BBCEE1063D1DAA3EBD606783BC2089F0BBEE8766BDFBF761BD184BE0BCE1C39ABDFBA4F1BC54E3A23DC2E9EF3C7A684F3D3EF6113CD81B62BC243F79BB22FE8C3D996BC0BAFBBB10BD33BE8F3CA00A8FBC10919F3CFD7E26BDFF0EE53CBB109ABDD2FA883D9C1C803DB4C4E6BC47A091BDADF12F3D581B1A3BDA43093DA98B31BCB25D923B89D82A3D9B3C483D624EF8BB21D997BC018E91B85561FF3C3CB5A1BB9F818C3DA7D77CBD98BE233CA9AF293BF3CE8ABC55D0D7BA8BE4DF3C1EC852BDD313423D8A11D4BA7E0E2A3D3D9AAABCD275663DCB51FDBCD3A4203DECF243BD31C49CBC37436FBB64EF6DBC8D0D773C4FBB14BD5AB081BC492885BBC9EC803D2580AFBC721F8C3D6A8DD6BC211C263D3E88A23CB022863B032895BD2EF111BD38C1073D90094E3C233F5D3C7C37853CFD22293B3465833D8A94543DE0EC5F3BBC022C3DA712E7BCD0E5743CAA0B9A3D1E9090BD31E9293D7E27E7BC993B65BD8B8DC9BC3930933D916C023D944F693B0CC54EBD10CB823D40108EBB82238FBDD101013DA01A1EBBAB668B3D5D39A0BD80D60CBAF4CC4ABDC3C6DE3C7F3B6BBC3150A03D404FA13D4AB80EBD68413ABDBBBBF83C658659BD1A1A883DFF51CEBAC7C4ED3BE6468CBDB8FDF93C6280743DDA0C9CBC8203943D3FCE58BD5D40993DF6744EBD0EAC243D2B7CA1BDB3AB213D9603B6BC217D23BDDF8B8E3C13AB37BD285F9BBDBEEADC3C27648C3C005051BDF0B826BC832CCDBC001D49BD5E3FBEBB8E7B4CBD1CA39EBD3E92E2BC9F842A3D57C314BD09BD893D454F87BA550053BCDEBC54BC78BD80BCABF67A3DE0256CBC452C25BD5BA7763DB4B658BD1020B4BB471B713CD6AC67BD3D4A7E3D06ABC8BC03D18CBDB4127E3D7806A3BD8A51263DF7A721BD256697BD09DC4BBDE3EC973DCA0A87BD64C6D83C3E38003C3C231CBDA8395C3DD08478BD979077BD82913FBCCAE5923C2879673DA1083D3DF8C62CBCE98B9CBC74E62BBDD37612BD0B35E93CE406E93CB0C856BD1264523BC2A982BDC694153C27869DBD9409053D9D3544BB2FE1393D696FA03DA11C9F3DB59182BD6D52353DC2722DBDC067E3BB956E84BDF88E203D3888C83CF7888F3DB25223BC79A5363CCE093CBDE572303DC055ABBB1F4DCD3C7D47043DFC71A5BDB0978EBB63A749BDDDF1F5BCD7371C3C2B0F883D8616763C002BCDBC40861F3BD28D563DA67481BD1DC9883D7F9DEF3C65A7DABBFB243D3D935993BD0B208A3D4D2B4ABD96D857BDFC484DBDEF42793D690D983CE26352BDC1DE2EBC5EA025BDCD38CDBCAB6CFAB962985DBCE236A23D00EB41BC5A4461BD227789BC4A5879BD6F89CE3BC5C56F3D69775ABDDBDE56BDD9FC943D92FC8FBD3E59FB3CBB5649BD9D3F4BBA1357D63C30D6D53CEAC99ABD37F1863D47D889BDED64683D14534F3D4147DD3CF32E92BD06E9A0BDA156F4BC45930DBBA0E07CBDAE3889BBF380013D13B816BDB097103C4B5167BDE58165BD130F2E3D86DF0FBDF22C2ABD2D0638BDEC3C243D15C4903D14E592BCFEC3C8BC45C8563C322B533DB41BBD3CF0CCDABAFD70833D4DA02EBDFA5469BD5E1AC23C4A8D3A3DBFC0A0BDA262E7BC123F67BD2791F4BC93EC5CBBD3E3113D35A32EBDF95E49BDB9CA0F3C06A84EBDC8D0E73CD5CAFCBC93D3B63CFAF3A03D2E4831BD8020023D7F7C74BC169200BD9B244F3D11ED8F3D5DDA863DB26A4C3D9A8E543D6BF50ABCA82246BC362459BDD6C597BD4C2A99BDDC7E91BDCB8E9EBD21254FBCEC3B213D58521BBB74D2E23B0F4314BD8B888CBDF2C52BBC16747DBD80C429BC26E20EBD811F9F3DF8557B3C20DC263D603A3E3C2AAA8ABD32E04EBD1251FCBCFAD49DBDF19DE83C17ECC13C42F711BDBF578CBD780B663CCD85A4BD99B73B3C24B3713DC4240C3D80F40E3DC05A81BC071EA23DFABB103D36016C3D62BA92BD088750BD4E2891BDD211503D6078743C287D303B201D433D7688D9BC523642BD67701DBD26F52ABDF4FF77BC59202E3D7970F6BC5E39A4BD6703373C4F0813BD83B0D7BCF030443D9982023DBDDB4EBC92BB1B3DF794883D3D7B3D3BD2CA2E3C2FD30ABDD30EAE3A9B3B1E3D4FBE82BDC639683CB8574BBD344807BDC20FF0BCDDFF86BDD14E253DBD14F5BCF98471BD209992BD3E6FCEBC32536D3D5A3D6A3DF75974BD00CC01BAB87E223CA6322EBDE5BAF33C587D04BC095A04BDEDA792BD40705ABD06EB2CBB2E4F5A3D4E9A1C3D799279BC152B12BDDDA900BD6BEE03BD4944583D6072EABBC9D2A43DC4BFDDBCAE1E0FBD14D2A53D61AA853B544D953DB5D999BD2F859B3DE3A8A8BC9D419F3CC37C5F3D3849F0BB708F333D14B51A3DCFD789BC08CAD43C80AEEDBC6799BABC292808BC7F1F7DBD1E3AB5BC7B7F25BDD68D0ABDF9CA393CD668BBBBA5D86B3DB42FA33D66FB16BD80A4953CC8988BBD7198A2BDB08AEABB7BBE283D215093BDA6C476BD50D9733C2B4A2D3B669941BC386AD33C1E1F3A3D84190DBD1AFB213D7E743C3DA6199CBD7639613D7407CB3CE83288BD41387E3D6E0C24BD85F508BC6A073CBDE92E893D415FD53B5DD575BD10F2A53BD28F623C272D0A3CA09F633C70A02B3D005DF73CBEA68DBD6EAD0BBD02A642BD568839BDDB0F08BDBE6CA5BDFEC70EBD183B713C7039F13C1C21983DE246433D578D903DB98D903D204CC3BB202F05BB06E334BD25EC913DDC84D93B44852FBDE00120BBD71D813DA4CE6FBD8DFB513D496A5ABDAD94933A6EE082BDDFE4A0BDFC7205BDE1B4243D8E4A8B3DC8D6F03CE70A073DDA8D87BDFB2101BDC8B1DC3C13E90ABD124AC53CC83457BCEEA0B23C77C452BD678C61BDB00940BDC75C02BDED5D9F3DEF4EC6BA48B79DBD733E8CBD032A98BD68CE0BBC25AA103D2F0B32BD4045E13B106CD23B339794BD4E1A103D2078FA3C003172BBC884FA3CD0267CBC743707BDB15D9FBD5C30123D7C2BD53C333316BDD6533F3D5255383DE03C073C1E7583BDACCF26BD3F928EBDE851A53CA6AB48BD020A373D53479F3D14A1063DE821E13C125A0F3D008082B865B42CBD7CD45DBD3783993D4C945BBD210C05BD20F5673BC0273D3C8BB718BDC0DB733C6EAC7C3D902A553CA8CC683CB0EBF63B02B5A9BC5E27FBBC3E753DBDD63E6BBD4F43A0BDA0398F3B02AF753D30F0EEBB9F64A33D02FE023DAD6444BD48863EBDFA1E5C3D38C2B73C259790BDC9D1A53DBDB624BD5BA875BD37448F3D4DCDA4BD22F6713D523D57BD002BA0BA7EB07A3D1AA43D3DC1050EBDAD8B903D00693ABCCECC4F3D72A268BD8A408EBD602D123DC0B7C33A1074EF3C1215CFBC3C28D63C7B1C38BDAAE65BBD21E604BDBA68583DB6A881BDFCBC9BBDD6EB553D643DC63CE0F3363B76180D3D2CCFC73C90A1973C0C3824BD09384DBDF6D76D3D861FB1BC8CF971BDDAC87A3DE8B9CD3C7C3C2BBD1E6A4A3D5E42763D53E08CBD7FCF87BD9A47533DE061A23B8663543D36BAE8BCCE89623D8A3E663DF1F3953DCE2CD9BC8FB333BD9E51253D836B98BD88E553BC18DD1D3C91DC49BD7A7C3CBD4001C3BAB5EC34BDB94113BD83D397BDA3B89B3D2123803D608113BDD72A40BD82D3EEBC78DD2E3D15B29C3DD0BEC43B685183BD085B0E3C80A2AF3CFCD2113D2C1BA43CC0DA73BBCECC6D3D1EA9563D0088D33A2086A63C0C03A2BD261B20BD767E383DBED2753DF10B00BD6813A83C4F2B963DE09EFC3B08B570BC4823B53C22656A3DB5388A3D5274223D3861663CD696563DC015DD3AC039CFBAF615653DD4ED1C3D5E1EDFBCE6D4733D58F883BDC28D82BDB4088ABDFF149FBD824E47BD6C44EE3C806C2FBC9214393D40C7A43C5E02ABBC317A56BDDA2885BD9E487BBD109557BD085157BD44C914BDCA7DEABC4026B63B3080E13C78E7DA3C81008F3DF4E2CDBCC2CA93BDDA44593DF8773DBCE21C99BDB0BFCBBB36432ABD779D963DCDC84ABD4A464C3DE03E0B3B1090AB3C80F9763B3AE8C2BC8657673D376713BDD8EF633C983264BCB237683DE0D757BB38ED9BBC908021BD565E0C3DBEA171BD60A13D3B5D27A03D2DC519BD543985BD04B791BC18DE3CBDB6B2743D58D3133CE4D9303D40C9EC3B5052013C563C7D3DBB120ABD906D083D2CBDBB3C1DF0973D296A963D744985BC7FB927BDA8C1E9BC961A343D428B4E3DC00724BC7F1646BD6A97743D8A075D3D74E024BD000C2CBA56F14F3D58A7DA3CE4FB0B3DFAD7333D4EF7C8BC10CC273C1C8A61BD653570BDBC07D1BC5CC8E83C3A139EBDF6A9B5BCC0D5153C604105BCDE27043D97BF46BD8E66783D10C60A3DC00CBC3C803E333A28D844BD7E8F783DBF2EA03D362A483D563C4E3DDA512D3D8D67A03D9BD56CBD38FD153D00BC623A939188BD9080C3BBA8132A3C64D9A3BDE2C05D3DFE4A6C3D2CC8F53CDAC6553D5084FE3CD8DDE93C5A0C53BD407FB23AF86C92BDF064E7BCAC58E83C4E48B2BCC6CA563D78981DBCE6B563BD137B923D009280B9665D503DE00F853B96A9503D0648203DA34C923D80E8EC3CB7D72FBD8EFCCFBCDA6559BDF8D5A1BCE1959B3DEA582E3D918435BD9E61A4BCAE8019BDD6FB3E3DD86F233D59D24DBDE65E82BD84462D3DC07B02BC2DDA983DA904853DFF728A3D848F8C3C18E8463C5040F0BB6EE94D3D3DC9953DFBA48B3D1027823CF02F323CF027993CB0B3143CF2321BBD3780943DCC1DA73C29729E3DDB0EA33D70F2E13C3FE58BBDAE096C3D2A90183D986B333DD6EC2ABDE0DEEA3B17C6823DE66B6B3D90D1DE3B9A96643D0059ECBB3C9976BD10C495BB180C163CF267A1BDA38481BD38DAED3C30375BBC126EA3BD5696693DC07974BCF2FB12BD6412B03CACF095BCC05D923BCE5985BD6E1C413DBE19433D00956E3A40E82BBC20FEB7BBB4B4DC3C2AB229BDA4AE263D4012983BD98365BDCB74913D8D1498BDD81677BC58B2703CC0CE41BD2BAAA43D5080993C6031A1BB5B86893D82855EBDEC178E3CEA5E033DF4072CBD14BF1A3D2443F3BC935B01BD5A7250BDC0FA923B80F652BCF817E13CE04F97BB33699A3DDA15073D97AE94BD697E28BD3449963C40A65BBC40F01CBCDEEF8ABD38DEC13C408709BCC70A883D50A634BC2423BB3C9A605E3D1201603DB0D16BBDCCF38C3C2ABA463D070F0CBD973E60BD1DA1853D670E80BD68CB923C1404C9BCF461C23C88E156BC1040BE3BF6D7173D327A583D59EF98BD508AE1BB10668EBB4CD803BDEA4807BD0C4E00BD46D1433DACAFEA3C7891A13C9EF55CBDF737813D42A4BFBC60C2403C00A77C3BC74A15BD1097E6BBA8BF2D3CD8B9733C369F6E3D9C60DBBC065A93BD0025A9B96E34683D705B90BDFC95823C6EAC723D4936843D009E853B68B3813CCA892CBD3E1F3A3D18985CBDA639573DD80562BDB08C0C3DB8C8873C03339C3D3CDE2ABD8A8F113DE5E48B3D58E169BCBE47333DCFAB963DBCC9F13C9461D33C5707843D53049EBDEEBE5D3D70B5A33B131923BD2B539D3DBB7E833D4D1D843D492239BDB6938FBD78EFD4BC9C4248BD1E03033D292898BDC0B79F3B81ADA2BDE1FF90BD2EE8723D5D9882BD64C1303DEB284FBD0092BD3B202F54BC04B738BD676B88BD044E053D341D69BD387D07BC30060C3D0712A3BD044ECE3C20EC88BB2E73133D585D143D4061D8BB10902BBC6CD8E8BC889E86BD4C5D163D3F05993DBD472BBDB40C9BBC33008D3D10B132BC3C8D0B3DE8B057BD002060BCC6F1713D2C3D85BD722729BD6AE07EBD46F5B5BC8D4949BDD60B3CBDAD35833D20A2B33CC6702DBD68B94EBC9E4D5A3DDEFF65BD20A9263CDF7C88BD7E9D52BDB4A4093DE6BB5A3D09E1833D606A8ABB2EE9103D107D5A3C758105BD0F87903D408BC5BB7420A63CC06733BB62E9493D73BD7DBDB63369BD761C403D3C27843C26114F3D1822413C6B099F3D617B8FBDE03F833C00BFE93A80E6F83CBC7257BD6C00AEBCC0EB09BC48A030BD768426BDC12C823D00C686BA7411CF3CC7085DBD00B782BC59FF93BDC04ED83B28099C3C0C71163D872E0DBD905FEB3C00DAE03A9014EEBBD05D86BDC0583D3B77249B3DD1320FBDAA264D3DEEDD4EBDAFC839BDC06432BCE542A43D018B81BD04C6C9BC22B47C3D2A83753D9E493C3D1F5D903DBDC291BDD28D623D0810E33CED1186BD30ADFABB74F535BD6432B3BC00F38FBB5057D63CD8B8593C1A3F84BD686110BCE1409C3D46B2483D10B34EBD4AFAC9BC9E06A4BDD0B7FF3B07C4883D86E49EBD65A7A1BD64BF5FBD003FFCBBB8248A3C8EA05A3DA0B043BB8004ECBB1D76A53DC501803D780A8ABC00BA043A580506BD808A1F3C7E9679BD423CD1BC2CA7FF3CF0E999BB83D364BDAE4DDDBCD82BC53C5AF593BDF23347BD8C2BF03CA02572BBD8AD563CCEE7673D4B109C3DBD4249BD36642BBD6C06A5BD9EAF1CBD50C374BCC6CB3EBDB8CB2FBC2E0073BD25A338BDDC059A3C569A8EBDDA39523D01AA8EBD384D523CC12AA13D6BD333BDFEC76B3D2061B33BB884DABC4048873C427DD4BC88279ABD88424CBD4A2E87BDA725983D908828BC80BF7BBCD22A4F3D9069D13C9AE97B3DB2E2433D29979FBDD67A203DA0F35E3B009636BADD9396BD9DEF853D0ABF643D3EC1123D14CA8CBC042785BC9C00013D9471283D80D1B23A74A88FBC9DE38D3DC3463CBD0FB089BDA6A190BD000E7FBD8AB34D3D151F8BBD73828CBD00F9DEBB801C6D3C46DA9EBDA062C33CB0FED63C9FF1843DC7D493BD929A47BD7059713CAAE4233D40853E3CAC4B5DBDC3EFA4BDCAD66C3D00B0993A806BA0BB10D2A93BF08333BC90171D3D10E1DBBB98504EBDC66F05BD94582D3D270A93BD582B4B3CA0E7613C5952863D949DC73C52DA063D67BC37BD16C6123D3067B0BB930629BDD64F333DCA6FDABC9AB49BBDC656BEBCF1E17FBD5F2E32BDF44641BDB1E89E3DC4C6EC3C7AD4533D1A1898BD723E423DCAB7233D6E87153DFC6A76BDF1549F3D5DAA8F3DC0E8F13C2ECC373D906215BDE695423DD75C3FBD3C8497BD497E973D927D60BDCA0F513D3EED3F3D3223673D25B217BDF45598BC0EA81F3D883222BC8081353C100CB9BC36365F3D2A4066BD985F62BD96F698BDD023ECBB71259B3DB8ED303D17A8943DAC1DA2BD40BAA8BCD66914BDB01179BCB2B80D3D408998BCE82F4FBCEF828DBD2EAF01BD723552BD6A8121BD8C82903CBE5F5CBD928E4A3D2AA8DABC549A81BCE004293D323E363DD2EC0F3D6ECA9DBDB471DC3CFE83223DA65074BD56A1D8BCB648433D42C393BD606CBC3C24E2D03CA245403D4254713DB078B83C80D5E6BB9CE1D03C85623CBD927C89BD37E1A3BDF8C07FBDC0232A3BEA4354BDFB660DBD5045A3BDD53901BDD0CFFF3B9ED0543D6CCF5EBD7CBBAA3CCFE89F3DDE500F3DD6F3DDBC8CDAEA3C59DA943D6E3C1A3DA4F9E2BC70D9063C50A9513CC27C3F3D205716BC2343863DB09F70BD342FFD3CA4A898BD9172A4BD56E171BD98B56ABD38661FBCEC8CFDBCAE67043DD4FB1D3D2A4106BDD0486BBD247D063DC8D0163C9FDD17BD92E2663D76A16ABD92F0413D1F077BBDF53B903DFD839FBD4D218EBD0662463D0A78513DFFEE953DBD0B973D2042143CBA480DBD9D9A873D80D558BA7AA2463D4F3022BD42203A3D0F059C3D61CB93BD2813F6BC02BF343DA0305F3B27739EBDC203EABC18F2973CC0F76A3B1D288EBDE82453BCA8A918BCBF8C903D028C2E3D1658ECBC088D43BC5520823DFEAE483D8284063D6EA590BDC0CE99BCC6081C3D3F33893DD0DA18BCCAB81DBDC3958E3D4629F5BC88BDD83CEEC5613D58B326BDA060B6BB253A8B3D19ED983DEAD9453DD1E30BBD4045C93C00E982BC2253273D3C1098BD3F785ABDC46361BD8059AD3C6AB7763D927658BDA4DD29BD19B51DBD24194FBD0610CDBCE8C986BD2EC4723DE4678DBD95948E3D780B913C04CCF03CB15B933DC0C10D3CA01DD9BB0E747A3DC4828CBD8015953BB1AF923DB074DA3B481D483C1C4958BD286A253D3F078E3D10C38ABDD5FD903DE9E88F3DFF5B9BBDD4E066BDC891013DC009363CC8E5003DBCF7DF3CBC5B8EBC0037923A440122BDDCEE103D5F582CBD1464DC3CB0C6983C008CE3B91701A53DB57B8E3D96F04F3DD04480BCCD9FA5BD686C453C19C13CBD08009FBCA8E40A3C704F7EBC840FFB3C1E61453DE81E8D3C809AB8BBEA5890BD80039CBAD8E4143CFDD8963D80A18C3BAF2231BDFC7130BD2A8D1C3D649A72BD0EF6B4BC36E65B3D5823F0BC72AB0E3D733F9FBDCB441FBD3093A2BBA82879BC880500BDD83CB93C48120E3C427B743DA7A52CBD036F8ABDABE577BDA22868BD310CA0BD51548FBD804661BAE8F06F3C40A6F8BB29F8A1BDA460C33C865665BD98E10EBC509DE13B2F0D45BD30E9C1BB645EB33CC82E6CBD6C6CE03CEB6A873D0808BF3C7EA66A3DE8AF92BDBD85A4BD516B46BDA9FE3CBD86E79CBDF2434B3D7EC7793DC071103B72DC5C3D509FE3BC864A62BD00EDBCB9B3E2913DB800A6BD7CB083BC1EAB393DFCFD833C72834F3D647A20BD98CE68BC7030FA3B369F4B3DA8DA2F3DD42AACBCACBCE03CC0CAC8BAFD09963DE8D88CBC52A1B5BCA26930BD61778EBD594D3FBD7E06013DC09786BA58F786BCF0B694BC204D2D3CB6FC2D3D4E102F3D104CB03C5C5B8E3C904B4B3CF038543C7448B33CADAE833D02084FBDE8A8803CD68E7F3DF421B1BCA8BCAD3CA8BE723C0B468EBDE73C84BDF47A89BC1EBC65BDB2046EBD04081E3D80FE3FBBF2DE743D1752A23DA8DC273D98CA133DE5DD893DBBFD8E3D6F7D52BD261910BD87FB0CBDEA250B3D9BB905BD909F56BDCCEF8ABD03FE9F3DF2CDE9BC4CB3FA3CB2DC23BD60DE9E3C9933913D48508CBC4E91203DB0768A3B37324DBD48E61B3C2A4A06BDBA71A3BC38E29E3CA86846BCC3F84BBD50A3C23B868957BDD63E72BD62DCA9BCDF1BA63D70F693BD6D6798BD6CEAA1BD0079A93B6439D0BC31C59FBDE572943D57AE8C3D26E73D3DC8E8DF3C8EDC7C3DA64E5B3DF0D1E23CFBA226BD104F8C3BD65B743DDEA4743DE3AE9A3D608C8C3B4C2CBCBCC2A10F3D0EE268BD8E38533D74AA92BDB1B9813DA056C9BB125052BD10F19FBD405309BC9039C13C48A4863CAED12DBDBE532EBD7E104E3DA8604FBC6DD5873D408E8CBD1FF2823DCE03403DD021AE3BA44A1D3D5E1C733D0176923D805578BD605B1E3D8CBD2A3D36DC6F3D601434BBEAFDF2BC5FF1803D441BAEBC5B5C843D8E6593BDC6416F3DAD6A843DE059B1BB86A4ADBC985A0ABD8D4594BDD4AD113DAEFE583D38ED58BD66F45F3DF46D51BD04B9C2BC8D968F3D9259753DC025153DE66249BD54B6E73CBA8C9DBDE43215BD5C25C23C40A4AF3CE51005BDEA2C763D60ACCB3B9AB55D3DD6D8623D7CEBE83C1C069D3C9C2393BC4BA389BDE87B293C967855BDFC58303D00C0FD3A2036EDBC00342D3B009600BB090F863D17C68C3D94770B3D28FD523C8CB99BBC809D0E3B64BCE83C4EFB53BDCA169DBD464C3E3D0028383AA1CD1CBD0C8580BD802433BDEA7B5C3D365BE9BC40704B3B1879333C0E707EBD30FCD7BBB92359BD504861BC68BAFE3C155524BDE07D53BC055A973DE669263D132C8ABDE03EAB3C7B1EA5BDCA38AEBC9F52A43DD23E493D026D32BDC3C547BD5F559F3D5CC2EE3CD277E5BC4085913AF81936BC1AED1D3D9BDAA5BDBEBDB0BC20DDE0BCFF90823D18D204BC0C9FFE3CF1638E3DCDE45FBD8A54A5BC4F499EBD7B93853D25143FBD4AEA403D6430BC3CEA3C743D207AF13C26DF633DE07C1F3BE02CE1BBB8CEEB3C0E2CB1BC731A893D204ACE3CD0CA25BC7DB3943DA87C093D9CB782BCA636C4BCB3F1A33DF4DBE2BC7C7A82BD9EB59ABD7F2FA03DF4C7A33C1CABF13C824C21BD584D563CAE138FBD020723BD085193BD0EB1663D6DB0883DA44988BD25CC823DC0FA29BC900987BB6C941B3DAC2D94BDEC13DE3CC1E3893DE8962ABC00AB6EBC9F618B3D5C42A3BDB0D7463C68F266BCE0F47ABC190401BD6A76233D4AA6A5BDA0B29A3CA45332BD26DD81BD9E3F8BBD786CC63C9801BCBCBA72F2BCBFB8A03DF06C6F3C7E035F3D048852BD8D706ABD4E7D9FBD4C08D43C2B5F8B3DCA10ECBCE813463C18ED78BD975390BD966587BD502745BC30F761BC69342ABD6BB301BDB9DE9F3D5EC64EBD0CCC15BD81F78E3D06693A3DC129883DE055D03B0008E63C00B0B2B869AE45BDE03249BB90AF2B3D2AA8463D144B31BD6B3A44BDC09E3E3B02F9423D1417E1BCCA0FF9BCB0F7703C9C2A83BCC0FC083BA0363FBB649C1B3D10B6923C195D08BD96BEB9BCFC4DFD3C52FC66BDD6C35C3DAAB883BD03F637BD7F78A0BD968D783DBA426EBD2ACC393D9890C4BC406003BD9026EEBB90C8E4BB1CCE053D7477B33C30E6CABBE281383D7E7F3B3D45BB09BD8EAC3F3DEA726CBD5BC58EBD444A2D3D5A267FBD52B9BEBCD8693E3CA466B2BC2B8529BD50E688BCDAEE7ABD70E30BBC7A25763DB28A633D6E604A3DAAC67A3DDADF78BD10B801BD2B318C3D72C2423D80F276BC5A36723D197438BD5DA7933DB2A5673D14C10EBDC05D453B6A3577BD00FA0B3950B28F3B5094AFBB8BEF9E3DEA059ABDB80666BD497233BD985A323CE082C23C806E223DE0F7C73B0A7D5E3DB9148D3D880305BDE8EB243D204071BCFA47743DF04D033D4034873CFE121C3D66C66CBD8615713D8C42AC3C782A233C68E6133CC4729F3C821166BD2A7FB0BCEABA7A3D003F703CAAAD053D4CAA25BD6F1A06BDBFAA46BD80F4DC3CBAB46E3DCA19CBBC86795A3DAE5E7D3D10BF49BD24330B3D32DC53BD825C133D4EEC673DD87C073D2ACCCABCC0BCC83CB0601C3C8485093DF947A13D562A5C3D2C6A0BBDB9FF833D7383863DB4B9E9BC131D4BBD4B2B823D7837183D80A1F4BC8873B03CA93F9FBDF0A68F3B9E3E2FBD5C0C88BD0C1164BD7AC17E3D6A6484BDFD9F8DBDE43F8ABCA84E9DBD68B36EBDC3E3A33DDD6D9D3D14EA9C3C5154A3BD171B1DBDC8C994BDF2C3043DDFA01FBD9F94823DE0D6D6BBFEED403D002BDA3AB00061BC875A8D3D0A9362BD20FE2BBC940326BDFD77853DEE0F59BD534BA23D009FB63A4C370BBD90CDE83B64879BBD0A65353D505AD13C58A7A0BCF4ECC33C37AE9C3D1CF1FCBCEA4ACDBCCA90A0BD0E0A0BBD72D59EBD6036413C8E2A033DB81F62BD5BE1923DC825E2BC7990A43DE019B9BB14E4CEBCDE9A80BD1CF3BEBC43C990BD566469BD73D991BD2ECFA8BC0020303D66DE7F3D0B7B24BD24E779BDC15B9DBD9D66A13DC63DA2BD9232A1BC109884BCD08180BCD6B0613D8C802DBD24EEDB3CC2C9763D0260583DE0962B3CE07CC5BCBB709C3DAE8EBFBC9AA313BD19319EBD8EB286BDD89E13BCE060B03BFE9CA3BD95E726BD05CD9D3D9036D03B19B7A13DC7398E3D62A5603D020D9FBDC8ECA53C80B0C93B3E68C4BCA8D24D3CB48FE53C913694BDF650033DD68B423DE8CD5BBD035B873DA294643D3058A93B9054C23CA09DB5BBC896D93C20750F3D657F51BD8BB43CBDC240113D18D62C3D1A2B373D955036BD84E953BD403642BB9A8102BD94C52EBD979622BD00D644B9578936BD8A148DBD2CAFD2BC059488BDB4E7BC3CBA0B22BD1445FF3C1E2791BD8413183D00E7043B584275BC88166ABCF09BD63C836C893D00C59F3CD0CA4CBCFE21303D4CE68ABD017B1DBD362C7C3D5686563D8E56743D1820BC3C734F41BDD20309BDD18F923D1CC37ABD685292BDDCA4D93CC335A33D96AF593DAB1B1FBDE1BF43BD185A543C6CA9173DC8EE16BCACCF71BDD7B0A23D00A3133C80A096BBE0E60D3B6C5DEB3CACFFB93C54C40C3DE11CA03D8090FF3C507349BCF0517FBC7898E03C58003DBD061D4E3DFBC02FBD565ADDBC2E2E623D20937B3C2812183D40C20A3B28D27ABD20F45ABCE7C00FBD40B33ABBA841083C5C26B83C944F7FBD3E3BEABC409590BCEE82793D7DF5A0BDFCE4F13CE10467BD4071963A70BDA5BD957E9B3DABA856BD7F429EBD0A2D73BDB243583D3CDA2D3D90B30C3C37D280BD6B6B4DBD9526953D6C02ADBCF8404D3C61EB4BBDC0EAE53C91369FBDCE4C64BD0844AB3CC23A593DB0FF8DBB804FFC3A0855C33C22C93D3DC0CBF3BBE4A6DEBC762F67BDC405C83CFA867CBD3CB9FE3C5809693C90A3CB3CA6436C3DB87DFA3C2800C3BCEC53A33CC5545FBD206480BC20F024BDC134A03D0081BABAB6CEA3BDD2E7433D44F70FBD357398BD7C81C6BC920B483D0CBB9B3C2E03603D90CD86BCF279073DA258E5BC98B08F3C16324CBDF0E713BCA451A93C1040093D1A8905BD7ABF713D66C792BD68AF70BDE0B296BBA7D1A43D38AF4C3C1EEE61BD6E49543D40C7443C10CDD03B87C023BDCF3644BDDA74593D00FA08B94CF498BD14DA8D3C74514BBD18CF2A3C68CE7B3C30FEFF3B74AFF13C089EF03C9CA0BC3C086E35BC27039A3D589BFE3CB88B6DBDEE43573D68F1143CCC0022BD0E423D3D887C6DBC282E473CA9F2A2BD56B021BD32F8353D9067A13BEE301A3D2EFEB9BC8AAC59BD64F2E13CC01E1BBC7E426B3D18BA893C7E048FBD022213BDA6DF89BDCA72123DBEDF683DC8FF203D70494B3C2B1A9F3D10EF203C0A9D86BDC974833D1C8D6FBDF028F3BCCD2790BD0E390ABD80BC1CBB160FD6BC7006353C3B7A44BD1CAC55BDD2FEB4BC620A403D623F0E3D96A0303DC67D623D4AEF793D8246343D1C11A13C92C2613D207C84BCBE76A4BD20970F3CD7A3963D986C0C3CD6CF86BDC02EE03AA08EC73BA80C4E3C005E903946512C3D001D683AE3018B3DAE0E243DBA6C12BD6A23593D009BC2BB9EF867BDAC1EBCBCB821073D4097493C878080BDA86C713C0D29A13D55A7833D61D921BD0AD34E3DB2AA24BD181A55BC253397BDA8E1133D10BDE6BB6012A1BCB6CF22BD12AB99BD3A2438BD5069AA3C6D6B4BBDC856423C681035BCD41AC1BC480E583CAD46983DF1F9A13D26223E3DEDA6A1BDC41032BD9A5CD5BC62E06ABD601229BCC0ABA13A60F28D3CFAE376BDD0BA003D13EE85BDBCD4E2BCAF3C9E3DB493A4BC4E420BBD441DC9BC5B7809BDA442CABCD6EE57BD28F84A3C26EB4A3D16436A3D2C4E88BDD7D725BD1AE7443D7083E73CF88A223D678282BD5DAD26BD70D792BB481F133C99419A3DBA8F373D987095BC8654543DAA6B26BD8DAA813D405E9CBB7647563D9C47913C50159A3CC8672C3D70ACD93CF3741BBD88D4253C565ADABCF24D5D3DEB6119BDF02BABBC7FFE8D3D167732BD0938913D1C0F053D70CE2B3C87BE9D3D4C93E13C4A1151BDE8C50B3D488247BC66AB3F3D555F823DA4306FBD1F8D8DBDCA6C2FBDBE127F3D54A0823CB092FABCB4A583BC00EDBD3A5B860EBDEE5B0A3D00CF80BD9638153DFA915ABD1E7A3B3D43534CBD22DAD1BCF1769A3D802BD43A20D1A53B80041E3BD75404BDE0AE383C5EF4013DF85291BC30B8B83C6885923CC83DCFBC584708BCA0706B3CFD1408BD1888483C41B8A33D1CC58DBD72E189BD64670EBDDE15693D141291BD80160C3A633A9F3DC4F8003D7CB585BC83179DBD73B98D3DCABD723D11383DBDAB158F3D08F84EBD6CF4193DD8568A3C83F71ABD602C65BBA55B993DF202623D8FD729BD60BE2BBCEEF75E3D102A09BDE8187A3C76414DBDC8361C3DAA3A123DA0E498BBE67E0FBDECA2BC3CD083E23BF89C24BD383CCB3CA06AD63C3BE13BBD7C4FC03C00C80738DC849FBDC6B8DEBCE2959CBC4244ECBC80AF95BC73B4A03D724E3F3D28EE6BBD94A166BD980288BCA85F043CC056F7BB44F3FE3C2CB9CBBC68BD84BCD44D303DBA89D3BC90106DBC40C94EBDF6C94F3DC4D1063D60DFE13CB4DCE1BCA22C9CBD22ED683DC0E59A3B38B24D3CC3858FBD369231BD76EC413D37DB83BDDB3E893DB49C073D1019EFBC00349FBD825357BDE9E23EBDBFCA3FBDD2ED2CBD6839CFBC0AD85D3DAC2FE83C50F390BB43BA913D3069DC3C5E3D5F3DF1FA89BDF8294EBD43FA2EBD78029CBD6C2C82BCA8619DBD7E25393D186E893CA44BF43CC8766BBDE3829CBDF72585BDEFA6803D905F6E3C58A28ABDC03451BDC5A41CBD00A9483BC88985BDB88C4ABD803C2ABA294641BDDEB393BD760274BDD2B22ABD3099173C30B9D03CA0FF49BB638C3EBDC0BDFC3A02CE433D623434BD6E4E20BD3ABB83BDE4BCEDBCDDAC8C3D98BA5C3C5CD9E53C12EF68BDC64B613DAFBF2BBD80786EBD1F7C33BD00CDEBB92A3070BD381B9E3CC469FD3C9A33193DE8CD183CC028D1BCE0ED6ABCD7D89B3DC84C033D30E3493C6E632DBDDC76A3BD807D163D5EDA7B3D0BBA813DBF3BA43D575684BD7CF484BCA84E9DBDEC81333DD5C6993D4005973AC40887BDCA10613D985D12BCEE6C043D60CCE03CAF03A33DF9160BBD287913BCC046A4BBF805EE3CC6BC103D7C97F43C2B0092BDC0C792BCB4D58FBC141A93BCA0F1033DF0DA283DD88036BD109984BD2F9D883D8CAF1ABD851982BD0F7F9EBC49E391BB944114BDA479563DEEDFBBBC28DF80BC88C52E3DB4AB2ABD967E063D3B544C3D06B70F3DA086233C59FA93BC2E77303D84BE9BBDF966A3BD33DEA3BC9EDF233D2B9825BD35FA08BD3B5167BD966B193D25B9823DD04AF33BD1427C3D8D2B893DBDC9CDBC630F3E3D66F179BDFB0883BD70AC95BDC65629BDEE30A1BD3366BDBCB1B1813D7D5889BD6C61363D7E33AF3CD81104BCD65586BDCE50F139AA191A3CA2E8623DB73B62BD1756443D5CF290BD2F508C3DD84E8BBC44C2AB3BB1F20CBD97752FBDA38AD23C79F2473C1C54B53C3D63203D03F1DEBB6B8C99BC116343BD6497833C7CCADFBC7D210BBD87B966BDF7D89D3C20A8013D7523613DA03E6CBD4683493BB47E5FBD6C45B23C5957083CA28F343D636A6C3C6AFD57BDA63017BCF8F8B53CC250123D92A1B63C97F3113D1002A0BD061B7C3DBDBB46BD5020C6BCC65750BDC0FB8EBDB992893DA67906BD8BE677BCD86287BC658934BD929593BD53DB7FBD0DA6183D5FEB8E3D0FCE703BDEC05C3D94EEAA3C907986BDFDB31FBD72C2583D40A0823D26B0283D62AD623D6E5F57BDEE5F5EBD227667BDE2E89A3DF0056BBDC4CD383D28F1243DB869CE3CEB755F3DD9CC8CBC016093BD1197C4BC18FA043CF83F33BC524050BCBEE2963D0024323C60B23ABDBF199A3D0374353DD658BDBCB05840BDDCE5E03C48FD3E3D064E273D6D1FD7BC0AB579BDDCC39CBD4ECF333DA7C6283D73B3CCBCA723A4BDBBE2B5BC183D4BBDB46C993D37C04A3D808E4C3AA03A99BB691B543C82ACACBBE9858E3DC170763D187891BDAA9C5ABD7C8E6EBDCF6B80BD16FE473DA61843BDDDDE393D4584CABC9C47A13B531E793D21644FBCBBF7C13C5761F73B5430A2BB845FA8BB5E0C73BD4AB24B3BE9B18C3D7B6A5F3D59F119BD537D82BCD932A2BD4C1B9E39480FA53D6E80C23CEFF881BB7690713D085A413D5C6444BCE2C80FBBEED4193DBE0A003D34F982BD889C673D9226FABC5C9E97BD15E9B1BC18FDB8BCF06F9FBD4C99013D94F8763DFF9CA43DF6E92D3D503314BD59D2F93C81A7FCBC1BAADC3C378E963DF5F8D1BC708979BDEA65013CAFE02E3B4B22A43D215416BD8907883D23A66ABD30086F3C18F4683D7D84D93C2532CE3CC425853DFC818A3DF01E94BD69F9103DD093AFBB142EA33CF029DABCCED67EBD56BA9ABD809C783C3EF957BD686392BDF89195BDBAF9143D7B62373DF5DC713D0B3DD23C65A278BD5A93183D1A0888BBA2EC26BD2732CFBB9E6B3F3D180A8BBD4B88793DE1C9113DAB0B5D3DF35CA0BD7566803D91C4743CF87C153D8312EE3CABADA53D9001A9BB6CD243BBEDF1193D188F2B3C5C15933DC051353B6EA6A1BD0F1E0ABD180A71BC0D2B3ABD05D361BDFB9E6F3D37CEA53D0105803D6BE9103CDDED5ABCBCBDABBC3FA222BDD7CD46BBDB8F6D3D3CFA053DD79ABFBB0F83FFBC594D4E3D9AB3693DF74BD8BBE21881BD1BAFD83C43E3AC3AB3A6F8BCA70860BD13665FBDDF56353DFF29A43D7FAC7ABD7660DABCA92707BDC1E6833D81B4483DBD8086BDAE1079BC09816FB9EEFA893BC1AF5FBC3B2753BD7C21A0BB87339CBC47D4913DB52D6E3CD6CCCFBAC2D6AEBBBDB7D53B924845BDDA4E0C3D22E0143D6BDA5D3DC4EF5F3D0DAD14BD23B55F3D33D549BDB2D33CBD2910D23C6419A3BDC02BEB3CDC6F8DBC33BE7E3CE1E9973D1333BA3CA606253BB68BAC3AB4E819BDF02DE43C8F07B7BC5E3687BC1FC0DBBB127B523DED34423C128797BA5BCFF33C135C2D3C1FA381BD07462BBD205FC53B2ED8163D7AFC953DC8BA9D3D6DB9193D8E0BAABC0D9A2EBDFC53DC3C108F3CBC21AA25BDD9700ABD087F1C3D4B27B2BCF6E0F73A006CEAB9C86614BD4F15983DD677593D707997BDCA850B3D321246BD2E2290BB6AA346BD3A087EBD249C9B3D11B995BDE8767ABD3AF3F4BC328031BD083D63BB599963BD26763CBDACA32B3D08D6CDBBDD1AE53C7A889B3DEE21563DEB8207BD57ABD83C99939E3C81AA813D235889BD882A1A3D89F5863DF099833D1304A53DBB7B07BD43589FBCD7BA3D3D2CF4DABBC62E5FBD84B0923CF055CD3C0363673DDA53DB3C5B02863D9B6F9DBDC7C36EBC544C783D0091DD3BEF6CBB3BC8301BBDB04359BDDC6990BBC75B903D9C44F03CECDF173D4DCE52BC8DFB0F3D8A55E53CD4E9353D8603A03C4204123D016C48BD2B8A983CD0CB873D6D938E3D849C963D1066E43CA0AFD8BBE0DB2EBC09278CBDF6D1613D80B3BC3A482050BD5A0D12BC313A873DB8F8FABCF5F891BCC45850BC0B5A213D110B973DCCD2353DA1D9173C63FFA43CF1DF783BC63F53BD14137F3D03F82EBDE77D093CE08B303D00AB533D8EB3883D702AC03C641297BD332FE8BC126A0CBB89EDE73C2597943D7A8F3DBC063E6F3CE4B2F5BC3DDF02BC0AF60C3CBA9A863CFAF563BDD3AA9B3B9EC9113D6779843DED7F6CBD4CB28D3BFADE993DB9EF23BD5972A23DFF33973D3A212BBD36245BBCBF8A6ABC90ABD83B1F8B723D565245BB1F7D9C3D923830BD0EE29ABD82D38E3D30DC66BDF3AAA23D75C2743D22A5D5BC708D5DBC76FC6FBD4D7C273C00126A3D299F58BC16A64FBD52D15E3CA5DD61BD8E7278BDE2E782BD4E0436BD604D2E3D04F3B2BC6605D2BC17733F3DA7E897BCC0649EBC88DB733D5D277E3D557E523D85708BBD8952843C2A3EA43C4D94953DAAF1903C47B79A3D058B26BC3F6725BD9C37473D72D42E3D7F652C3D07204BBD64D899BC263789BB194343BC9685323D5D028BBCF6CAEB3C6DB3503D207A97BD8EB99EBD0E5EF1BCDD56463A0D26A73D94548E3DC2BD92BD9AF14EBD1AEA623DE5CB3E3C5CE55C3DCA11A83C1897D63C9C1D7EBD3466FEBC26F887BDA20F3F3DB0CD29BDE5EF9ABC5E7A003D393164BC4C97C2BC0DC184BD17F50F3D3BA0FABB7CEF5ABDC2D733BD01C3BABC2FB1833D445937BDB7F34CBDA92996BDA8BFD2BCEDE017BDE5ABB6BC2C7B593D76B7133CC27A2BBD54A8A93C924ED73C6A13973DB40E873DEB83903D0CB9903DEE453EBC4FEC583D1DBB223C3A861E3DEF75E83C49B7353DB100F9BCD5B1653D32D1D23B7BEB593DD45BD1BC648D64BDEC3A353D7381D2BC8FB929BC82D7583B39A4A93B2A4DE93CF1AA09BDF06E383D59941EBD52BD3D3D81CE45BB3658A33DE809263D8429CDBCDCA214BDB95C563D072CC9BC3B7AE1BC26E960BDA60C42BD85F28F3D741E3FBC8D398D3D6D96413DDD1814BD07AF843D79582ABB75D182BD4DA7413D5C8D903B608A13BC0A1F853D9037A93C795612BD53FA86BD2D358BBD1D368B3D9A484C3DE8AD82BD80D25A3ABD9A85BDDB93063DAE29423DA3C787BBECCAA43D4D397D3DB19AF0BBC65A983DD6FC7CBCF2BF5DBDBFE0AEBCA9FC3A3D026055BD03D7263D6D6703BD24DE543DE5C401BDFE0B8D3DBBFF0A3C0BE4273DB02857BD918E8C3C6B77E33B71C41CBDFAA5AEBCC03005BCA4F846BD2245D9BC1B4A28BC58288CBD5218C33C7864DDBBAE9F77BCEEFFB83A9FCF9F3D6DE961BBDD19753BEC665CBDD33A31BBD81DCD3CA583883D3EB1993DE45F9FBDBCD92ABDD0DF683C14CF873C8367393DC7BF9EBD605C003DF652FE3A640A9A3D7A6C9B3D80FFB6BC066C593B90ABCEBB9D368CBDC12E95BD677CCBBCB78698BCBCD08EBDF0C5A23DD035B43B57E77A3DF088983DA7AF133D451690BDE0A6193DE5887F3DDFCA91BD02B92BBD70562DBD9247433D5B9976BD012F583C011A3FBDCA9F8EBDA4FB4BBD11B1033DCA8F89BDA968373D289723BDDB525CBDE93E8B3D50E4623C8CEB53BDFB3E5E3A5454C1BCFF39B5BC0D47513D862F8DBD79F42F3D17109FBD8532903DF14876BDB2E5A33D4B9D05BD2DB59DBD561C403DB9C4293D8189F7BC646E953DD502963D5638503D2645793BC233F1B9E88E24BD6FD138BDD95291BC2FD26BBD2B8A943D0D5433BD610261BDF59058BD808EA0BD710196BC0D94B1BC0CB49ABD348409BDBA89A0BC10896CBD06EDB3BC7D2987BD6F3EA53C75682EBDE96AF4BCD01CB9BB6BD470BD167A63BDD59E623D4361883D5D9B853D5E4F29BD2FF73E3D2A9F4FBD512E023D928898BDBF22883D79089EBD5A29D5BC918C93BDFB2C4B3DF79350BD829A713C836889BD1F73A4BD5E2A533D3572333D50C6AF3C2B06C8BB18F7C43C02AD88BDFDDC8C3D80BEDA3BFEE113BDB23E753DBABC13BC3F1AA5BDC51897BDA406433DEC0F4F3C297D62BA9F642EBD86528CBD231D97BBF4E747BD669648BD3344333C26DAF1BB3C36D8BCFF2A45BDE392333A91738CBD1B42B73B9BF2BD3CB0EA2FBB5C3D163CDD8A343D99664F3D7DA55AB90B8B9D3D674F54BC3A4E4F3D32556B3D4CBA5FBB16BD483DFFD3443DA4223D3DA7234BBD1284A7BC94B0A13C34F937BD3460EC3CA30D3A3C30BBD7BC75063ABD9E74863D649E68BD5AE838BD8CAF243D6EA826BCA7BD53BDAE9D7D3DA04C0A3DD5897FBD6EC45A3AAE9C56BD72E25DBC20BF93BBA5BEEEBC9382933B024064BC13345D3D81CCF1BCFF452A3D0A68573DF02BFEBCA8708FBD201F5DBBCBE69DBDCF6A56BD5EFA8E3D430A353C834B063C1187523DF2CF08BD42BEFE3C912E03BDB0D3923DACC672B9A06047BDF1F4A3BD95B54ABD15BDDABB1B80FDBCD87FE5BC535138BB9B77133DF8ED42BC304898BD83C83E3D2AB2853D11558E3DED711ABD49A82DBC04002D3D03498C3DFA403D3D93F9EF3C6F7166BD6925D93C8C409E3C04C6F0BC94AA1ABDB1B2663C5A8CCD3C3B32DD3C3C3D8D3C1C3613BC21CB2DBDFDE8603DFFCFA43CFCF35DBD801D28BB9C1812BDFA631FBC6DD1863D8DDDEF3C43A6C2BC21BA823DC04722BDAC4492BD24E7B73CB6993B3D1B13953DB0A61DBDF0BB0B3D021EA5BCE789A1BDB7539C3DC3EF2CBD105442BD4DCA8CBD0DA881BD845EEC3BE92BFABC7559A2BD9D16933D64FAD8BA7A02373DD414A0BDE07FEE3C2E89933DEFEC25BDF8959A3DC4D0893DC5CE8C3DFC38133D87AA41BDA2D58FBDD108A03B93288DBD5F5F6CBCA761053DBC0D923C5B101EBD8BA124BD7BA454BC038F973DB45C573D7168A43D6AD2A1BD646440BD16BFA3BD6B279FBDA9E75F3B2B888BBDD484883C20017D3B2A67D1BC84DE63BD7378993B75393FBDE6BEDA3B200203BD5D788A3C6E7C01BD073D863D0FC009BC0391763D9B79643D235D1BBD6086DBBA226D91BDFBC3DDBCD10F473D76CDCEBC1E1678BCC329563D02038BBDB6568E3D9D2F823D7630713A9AF158BD7D952F3DC6BE443DFF661DBDD7B1083DD1DE27BDCE968ABD5F7433BDB0198EBD7F9373BDAFE37D3D99747EBD25F1373CE3DE0BBDDD951B3D8CF53DBDB16C4BBD6FBE0F3D361B0FBDB8893CBD62F3E13B1035B5BB444111BCC5EA73BD8CDFEE3C4B56823D48E5813D02D389BD4CE29DBD45596BBC096287BBA1CB953D3EE3753DCECC0D3D73D711BA0B969A3DD7B4733DFD7D4CBD472D713DF86530BCFC966EBD4EFD5C3D8BB839BD797A08BC90447BBDDD02643C012C0D3CFAFE58BC52D095BDFB2736BC1DAE433D40DCA23D5297103C68E2693D9C308F3C92704EBDBF51913C73E8E7BB105C173C88CA07BDE247463B6CFFA53DC5B501BD64741C3DD20832BC90927F3D69DD783D9F768A3D3ABC883C33DF573D49C2A5BD1BB4953B8E95ADBC51B28C3D3DAF593D9AFBA13DDC27763D96DE443D5A4253BDC0848ABD5BE2C03CC785943BD5E4CC3C5A14B83C2F640EBDB2A799BD661ADA3B41028ABDE2407CBDA6258FBDBB00733DA43E8FBCFF85F33C0A989CBDB4CD5F3DD9C0893D1A100F3D1AA6613D75A258BCCA3180BD196A063D9CA851BDF84C613D3219383DA5D87FBDE984F5BCA71D643DF39918BDF715803D0ADEA6BA5EAEDEBC28C023BD8D14833C2BFA95BC1A91C8BB50628EBDC8970A3C856F163D8AFF983DAD17FE3CD2B68ABDF7651A3D1581D6BCEFD392BC51BA9E3D3BB2D2B96266483D4EE3383DA36004BDEEB1513DDCF87FBDE643B7BC9F2B73BC651685BD9948A43D2CBE083C3AAA4D3D033BFD3B01376C3D2B68AD3C074E993D633521BD7041833D0E006E3DE33D36BD58C7EE3C4C2B3DBD9F2B8F3D544E823CF7B29C3DE515D8BC529CC43B64716BBD8C9C963D2B6589BB0A2779BDAF5A90BAA3CC80BCD5F21C3CC5E635BD667384BD7EF609BDCC3399BCD7AC87BCFEC2AE3CC5E466BD40E33ABD7A7D633D3AB622BD39F1B13C422A1B3DE7F6AA3C5137A03DA67B52BDCDE4193DB559A4BD8E6C8D3D62F95B3DBB9AA1BD741D9EBD5F3A95BDAD1C953B1EF9793DB30389BDFCE97E3D01748D3DE883913DD3AC5C3CAA4A4DBDB3D52B3D2D30B6BA1C10123CDD7D10BDA52A333D4406D1BC6F451ABD4FB223BDA3DF223DE699793D183C523C60651E3D413471BD14CB56BCF47690BDA9031C3A8A2B9F3C1873B03CD56CAC3C625792BD818BF03B09478A3DF5874BBBD41471BC4AD6F23C1D3B30BCD1414A3C3F7C923DD827A1BD3E37913DE05D973AFC6C813D33B1A03D221799BD49D365BD0EFD293DAD3DE53C394C0BBDC4D0913D5DE73CBD43CF57BDBA3F133DE0422ABC4AE355BD32C3B23CA42906BD8146903D4334E3BCB0059F3D06DE673CAE7BD83CBC12223C03DB753C2F67E1BA25DADFBC593C1D3CB595DA3C4C0A93BDC0EA4DBA70E57ABD07EC5F3C02D7813CED561ABB172F07BD51B499BC33505ABC65BD2A3D4E591ABC9041623D0B4E023B795373BB2FE9253DDF4284BCCC533E3D7DE539BDF0AF42BC7B7243BD85E024BDCB078E3D3320673D081C25BDFE62C43AE48E3D3DC4DD41BD33D2453D9131E73A34E1963DFAFC1CBD6AE8733DD156E63C2560A13CB0182D3D958B7C3D6A3BD63CF0BD803D9B0340BC537CD13C908E3FBC1D9DBA3C48877C3C6CC3A1BDB6222ABD9AA7893C9724593B812B603D515FA1BD74594BBD7A0C0CBC846D9BBD558186BDA52ED63B29098EBD2CF384BDDB567F3D1F12713DBA2B91BCAD4B4B3DD46BEBBCF7A95D3DFC6FAF3C36AB1E3D012C84BDB4A632BD197CE73CA3A87BBD399249BDA5CD66BDF7CABFBC4A1969BD9274223D876A823D1DF22EBDB9E2003DC9B4713DCEE692BD58D3ECBC5DE3A3BD97E988BD69FAE53CAB30A0BDB63295BD1EF79DBDD960543C49ED6CBD586F9EBD9B3A63BD0DFC3E3C349010BD5EEB0FBDEEBD5F3D46858B3D4C29F0BCA06C8E3D4C77523CC19D1ABD6A523D3C1E37153B491FBC3CE40770BD021AAC3CE8D62EBDAE569EBDA091923D60CDFEBBE3F361BDBC45393DEC0B6ABD6EF5113B5B40723CF3D63CBD844E083DA742823C70D337BD9B8E7C3CAE1532BDBB8CCFBC17305C3DDE6F20BD66A56FBCE1017DBD95EE1F3C58E99CBDFC8F68BD99CFA4BD6DA6D73CD4DFCFBCDDD604BD9176A0BC08CB16BDF9D11C3D8AC4E6BC709D29BDAF58C7BC20F647BD3E398C3DA5AE93BCFE0E343CE9C38EBDE8DE293DF614403D8C942EBDDC81913DB6979A3BACF6CFBB19FF04BD8DF4983DB8FE91BDD6ED3B3D97B0B0BC8AA273BDB705A53D287C87BD6AA5543DD53091BC259BDE3C0A458C3D89445EBD3BE18EBD76758C3C3F169CBD099E14BDAF6DDEB7CF630BBAA6BF9A3C3678233D0C42A0BDECDF013D191A5EBDFC807EBAA05B1D3D4D6A083C36230FBDF79980BC316C2A3D825792BD75B48EBD0E8C4F3D83B36D3C4DBA0A3D9CD0A5BD013DA23D0C3C81BC9CB1573D508D89BB05FF64BD063F49BD72757C3D1A728D3D256A5CBDC27709BD84277ABD685D263D34AE61BD15B391BC6E648DBD4EB8C33ABB1348BD1F764B3DF33EA1BD020891BD972B8E3D1605343D42799E3DC9CB0F3DF3F5503DCAA7813DFA49C93CEB5412BD3850E3BCD485153D64BF5BBDD6A03D3D2978B1BC07FFA53D091495BDFD1E6CBC70AEF63B2C6A78BDF2EC70BCEFFE29BD8DEFC33B6253113DF962723DC39A94BD3146A3BD216A9A3D7914F83C9E432CBDF3B35D3DCA353CBDB9DE483D7E4E603D433E98BDFE0D88BD87D08A3A54EA29BD6A8F643D1A15883DBC011C3D8300573D1CB5533D4AE9593D0647A43DCB2384BDDA315A3DEB865F3D989F733D40E1B3BC25781DBC0DFC37BC16406CBDC4F8513CF99E963C00F3C8BCE5752CBC7D8C38BDA0981BBC2F3B953D3ADB9D3D15098B3D1AF2803DAE2AA1BDBC230ABC2B36853D3F2C013B77AEECBA67437B3DB27EDF3C144D54BDDA2F56BD7AC1FD3C91CA7EBD2ACABBBC0B1AE83CD1C67F3D80E2213DE3C5703DF13E95BD5CAC823DA674043D56BE08BD4B7490BD7D9816BD7B94803D44B2073B1DEEEB3B34F617BDFF9F9B3D04FE9A3D337008BD7AFC573CE54584BB969FA9BA8F3135BCD476D23C8178C9BA02F73EBD86B87BBCAC0C06BD8DA601BD21A157BDFC4E363DDD1B6A3C781C18BB0FF2433DD48869BD90AC8BBD40C4CC3A14AF913DBFCA943C40D34ABDBBADED3BBB068E3BD7BB75BD7BCA103926852ABDE5A3C9BCCB3F333C21C7BFBBD749423CD6A56E3D66528D3D2494933C08E351BCFFD8903D20BF2E3D46F6DDBCA1E2FA39312D4A3D426139BCB7AD95BDCC6C61BC6F1DFC3B885F95BB4D092E3D40B219BCD64E0DBD8C0176BDAF7466BCBDBD3B3DE9CB91BC75E116BD6574D13A70D2703D30378A3C6B7C20BB43323FBC4AF01E3DB91D643D91F8BA3CDEF0E6BC32DC8FBC940AA4BD7C1240BD45F190BD5C6485BD253CA83D1190A53DD136843DD8F82F3D142B43BC603CC83C9B6287BC54119F3D6F1D1C3C78DA413DB56A9B3D2C5B2B3A9BB42ABD5938973D9E71D5BC41EB583D533B9DBBF89F503D5CEF983DBA5997BDD45C363BB02818BDED0C703BFFBB243D210EF3BB754A173DA30A9C3D134187BC6B1B683B602A70BB7B35E4BC9FCB72BAD073FABA64941EBB5B2BAFBBC312183D3265A33DEA8B6C3D33108DBDBB2AA1BDBA40DDBC202B183C50CC94BD4BDF20BD6F52953DC98D6E3CD45D52BD709F7BBC566132BD69D5D93C26E85ABDCA7984BD12A90CBD613E94BD0C8B943DE980FABC21E87EBD4A46143D743A843C6A704E3DE1EE9CBDEA738F3D6BD196BD87980B3D2B6685BC3811433D277F3F3D61DD97BD862407BD59AD5BBCCFD281BD297E8DBD4AFC563DAB686F3D74E39DBDC746553A417924BD0B877ABD85403D3DCCC0A4BCCBA7D73B1CB3F33C69DF06BD9BC02B3D2D0CEA3B65C7E53CA3C48C3DDD4FFEBB6F23483D050D983D04488CBB992D95BDA59CA13D9F7DF4BBD267953DF495F8BBCF8027BD13B6793C9074883D2B922ABC7EC698BD79E687BD2747673D17F27CBDBDF9C13BA50B393D9177273D3D4767BD074B183DA4EBDC3B97C688BDAF06663D3DF7153C2186E03C60BB5FBD1F1B82BD5698AB3CE8A082BD2A68DA3CB45478BDD3D18CBC479E543D9C4E843DC25375BDEFBF5B3D8ACE45BD6F9E4ABC8A73143B96B26FBDBEC70E3C116A873DB05ED1BC880363BDF336A5BDCEEB653D86E59E3A1F32A43D323452BD904BB3BBB11B373D50DA993CBA4D023D26154CBD926859BDAA5C773DBF11253D4307B0BBBF47A1BD72FC843D8490033DC0F075BDB5AF74BD6933303D2717853C5DC78C3CB401D7BC1C110FBD1ED96F3C0F8DB4BCDA7F723DB0FDC7BCC3914C3D02D0A0BBEC61803D24B8D2BC7F56163DBB097CBD5E0A8E3D930DF9BB92E12B3C067E143D7F7316BC33ACA13D4A7EFE3C9A14273D9F1DA0BD28519EBD8507213DD9651C3D2EA37BBD9CFF5FBD48E024BDD27580BC5054A33D175B15BD7D2120BCCC402BBC142BE6BCFA45A23C1BFB943DA5BB65BD3161C13A1D2A7EBBE42979BDFB6631BDC183D23C4C4E2DBCC66F88BCAF759DBCED34DEBCD40C573C689B723DF3254D3DF2585D3D9DE07EBD5EE33ABD0F850E3DC0E55A3B3DDB9FBD09614CBDC93FB73CD0DDEBBC1F86E83CCF75A03B95E146BDB77BC4BCC61064BC9FFD863C761E25BDE24A81BC032394BD06009DBD95A97A3DFCEE293DFA3E7CBDC7C76EBD2051873B2CDD4C3D1CD271BD306038BD29CAD23CB841213C2C1C283D34E1FABC8FBF79BD6975E6BCD199093D3EDB03BD9DE421BDA81773BD9912C43C5EBF4BBDF4AB103D9F3912BD29629D3C4D57F5BB5E1C9B3D6D1713BD3649213D05CCA6BBAB56903D13B765BD5DF8A3BC4C9F8EBC8403863CC8E8783D3BE8993D636D55BD3B88393D4EDA2EBDA404A23D4DDE883D16D893BD68BA923D15C198BC2AAD98BDE0AA20BB0945883D3B6763BD100E47BD033D6FBDD62FA3BCFAF37F3C7416683D1260463DC6850A3DD7EEFFBCA8B7323D6C0056BC8198823DFE6A913D21F0693D69B1A53CE47726BB22737F3CBDF9733DE46A103C30E3983D0BCDA1BC0FED39BC5F0F62BD14C1A0BD4069BE3C7564833D24F95BBDF8670D3D18F63A3C336EEBB96F39A7BC3553C03C03DD1B3C25F3EB3CADF06F3D2510923D3A2A123D71459EBD1223353D4DC38CBC247914BD3E801F3D33AF5EBDF91135BD1AAB4FBDFB9C473D6770693D76C22BBD98CF543DDCBE8F3DDA0B48BD341C1BBD7C8BA23D4593C3BCC132BF3B1639A23C698E4D3C74A2763D9D121C3DE68BF33C60744EBBBF1EEF3BABA2573C25C8843D92AC9F3DA5F00B3DD33B8FBDCE5C443D3F3083BD797E70BD8D06A6BD1734033DBA403EBD480AD53C179E1F3D5A8D86BD29629D3B6A7913BD00EDF3BB5E64F53A12F3E63C5DE59E3D357C7CBD944FF5BC1F2D8F3D432DDC3C6C32843DFD15C63CE226E3BCFAB6E0BC525327BDCC19A3BD71825ABD0CDF063D19CB76BD2C903BBD1D9C6C3D09301E3DCEE43EBDE49D95BD6332193DF7B34FBD81F24CBD52292F3D7B3D0A3DCADF43BD2A8F1439F9EA1A3CC1824F3D21255D3BC4DB87BD6F027ABDCEC79EBD4545153D0772073DA14B47BDE4A177BDDBC65A3D80C1813C046E313DE42A5FBCCB683A3DDB7634BC5FF9DD3C8D60C73BFEEE9E3D0C27EF3CB5D318BDFAA65ABD6B9C48BDB14ABBBCC3EFEEBCB8A9873DFD8CDA3C4CF638BDD8BCB73C0895C53CB0139BBD479389BC2AC1E63CAD9ACEBBE706053DAE9F70BDB15D9B3C0C758E3D8F5A98BC860548BC9E8EA8BBAEBBFBBA2678573DC56437BDDEE935BD9FC0863D75789D3D2283F4BC5C508BBAA5B420BDB924A73C3F6D9ABDC6A438BDD67B96BD140D453DEFA782BD0A0DACBCED78F0BCD1549E3D2E90D5BCBCBB493D8174A23DE0CCFABC11656CBD9D547FBC0A52053D95ED84BDE735E5BCEC4739BD67018FBD008A89BA04F3FABC855970BDB73C9BBDF7135F3D68113A3C1EA7323C585197BDA7C077BDDB5F383D1D287A3D0593263DA8A6DCBCA1A88E3D065D763D4B84263DEF1C713DC60708BB9C67F0BC0E6573BAAE9A7ABDA343C2BC2501753B019E35BD3A85243D85A2363DA8C2AD3C3C8B17BD25C40EBD4FA58B3DDE6A343C3C5D773D3FC590BDC5024C3D1270653CEA47913DB22EA9BAB2FF763C9AB4653D937E10BDD61E4CBD890655BD0E2D47BD462A69BD252D87BDD436D13B0635A03DE359553C53C305BD1614793D0064423B48E270BDE3DF10BCF8E0863DEA679D3DFD68963C910F78BD421B04BD896A343DD2B678BDCEFDEBBCFCF74A3D0D6319BDA277A53C7456073C63EA133D8A58923D2E5AE63CE22E993D4845103D8FCD963D9C39A6BC97E36ABD189B5DBDB01DBDBC6D93683D1E59743D0275413D5B0B7C3DFD7C6CBD8A0B8A3D1BC4883D1BC56EBBA043073D666B803DF0B911BD6A1C373DDF2148BDBAFA9BBCE60B62BDF977843D170507BDEF43513DEAF793BB0E9E22BDA41B9D3CEC1C84BBC51270BDFE0D80BDE882893DBD8DDF3CE91647BC2A18A23D0E9084BD7EA897BD5DA920BD91995C3D1061693C975D6ABD6283583DEF1085BCA6A2E63C7F2062BD429EB43CF229EE3C3003823D587C6C3DC300BB3CBCCE8C3C5F18DABCE37D76BDD881DD3CB373983D192EB13C5C8B59BD18F6833DD09662BD0C88223D9045323C0B8239BC232047BC24B86F3DDA46C63CCD578ABC27FB24BDE3173ABCA303EFB9819AB8BC3BAF24BBFD7CF9BC092690BD9D2C9F3C2555833D0B7183BC6C37393D7A0E54BDCFE7603D22347DBD06A481BD72518C3D323C0A3D85D5363DE4CD753DE34A183CB400C23C624655BD105C09BD00169939DB83BCBCBAB041BBE093D3BC577BC9BB12763E3DAF1389BDFCE000BC5527913D77718FBDA34A20BDF642EA3C2867B8BCFE9E1FBCD7C0253D19AB9B3D58BD8F3DA10E83BDDA1E7DBD755F79BCC597B63CF2330EBD2759E53CC44697BC35E2A43D4B6CA43DEFA9363DC1960D3B374435BDCE1B7D3D484982BD90B742BD814F97BD83BD85BDA35C94BD259A68BC0E6D163B540A7ABB3D8499BDA3805F3CF7C18ABDE03E303D703B34BD1F781B3DFF4B9ABD381E72BC6C40293D3FFF323DFCC78DBC7E2375BDEDBB99BD342038BD89306D3D6552ADBC3B2085BD3379C23CA759603D5FA995BC42D052BDFA82003D54B0CE3CA264573DC43190BD745609BCA41F29BD2541873D1146B4BCF0380A3CE8B09CBD755C923C802E893D8DE57E3AA9C8C7BCC09F9D3D6DE0A03DEC203F3DDB5C593C2054803BFC6E443C19286DBD789D25BC1787E93CDF0975BDB9B28EBD37E3DE3BF9A79EBC001417BDFEE0103D69CDD9BC452738BD7A60DBBC5B94A83BED217C3D739C57BD8A4E6CBD5E260E3DDBBB7C3D3BB69D3D2A1B5E3DB91D6F3D9B3F0F3BCF83A13DA95BAF3C693747BBAC935C3BD524BABC91FA97BC7DDB85BDCEC3F6BC95738F3CC1D132BDB669ABBCF7BECA3B4D9BEFBCB88E9A3D42CA413D6EA2823D7EDC14BC3FB273BCA858D23B87F9FF3C44EC02BDAF575EBD400C96BD6131B5BB0FB5A23DC2A188BC13D590BDE0A96ABDDAEC90BC810846BDA09F8DBDBDE758BD45EC973D8CCD4A3DAB8D863D39DAD73C7442BC3CC4A8263CD80D6F3CCDA17FBDE5B0F73C6EA6AF3CFE28563D3047143D892432BD72B4013DF2A582BD244A8EBD1334823D3418883DCC30A23D2EAA353D5B190E3DC81F37BDCDF08C3D7B1B803D8B3F4ABDAC5D75BDB2D3E13B078CBD3C18DA823D23609B3C8A4F43BDDD34443B804341BD4B9455BDDD6B663D6C4A383D10CF81BB4E38043DC9C6843C00469B3C2A8E6B3D36194E3D945A2EBC59C367BD701C1DBDC6C78CBDEEE245BDC09C09BDB3391FBC22DF973DBF19083D4C9703BD2DFD323C68BD86BC516CBB3BEE42473DA1EF5F3C360144BD7068623D51AB9F3C8AFAE93BBA2B8CBD7BB76C3D908C5BBD7AD663BC0E43A63D79D161BD522DD83C84F497BD877299BD0B734DBD92E4323D3EB9923DD1037CBD9BC3223D88DB673CF841A5BD7ED238BDEA1BA2BDF748753DB6BEDABCB5FF7EBC4B7782BD139117BD9E73483A1BCD583D5B29993C54DC93BDA58C5EBC47C8773D2519AB3CD501DCBCC05E723BB6F76A3D2CB3183D685F993DA5DB9EBD8C91BEBC8C45843CB937363D1DAF3BBC4E26503DD79E4B3D7983F2BCD7A246BD2852553D02B7973D06EA96BDCCCA4EBCB95B3DBD71DB753B78612DBD2E0D9BBDCE2A2BBCEA6C933DCB9605BC4AAFBABCDE0E943D1CFE2FBDD84F153DF215BFBBB6F1EFBC1FD71CBDFE936D3DE12D65BC35F679BD1EDFEB3C41DAA5BD79EE76BDD9979C3DB53C3F3D4CA4583DE571843D6E8E4FBD4AB6843D3724703C0793A83CEE18603D9B58A53DEAB4543DEAE79F3D0B28743D20E1753B21927C3D38D29FBD20395C3D26D48C3D40BF04BD05179BBC2CA5263D64A1D2BB974B0D3C4DDADE3C1DB1913D1D4C9C3D0B149BBD086C9DBDDC412DBD488BE83CBD5B8DBCBB2EA0BC7B1BF03B9F8B51BC6A3B5DBD64A99C3C95C0A23BFF8D88BDF24B05BDF1A48C3D91D6953DF9EE5E3D3093B63C513E1A3DB20C9DBCA4AD5BBDA2C0223DDA5D503CEC05A6BD0F2E96BD8E739ABC3C31863DAC045FBD1CA6853D19736ABD153B7ABDD2976C3CA233783C0669CB3C2A3D7A3D937ED1BC0D649EBC261F033DD4F7E83C256FA2BD4BC3D63C777F41BDEE7C50BDD1F172BDEF826F3DAC8AA5BDB4C8533D092B523D7FA9F2BCDB0D10BDF22A6FBC21C99A3D29EF8FBD9F8E943D1C328EBDE97D73BCE524903CECBA323C97B261BB9B6E1A3DCE4A223D1A653BBC5F3DEC3CF064053C8C190BBD605D3A3C60ABF53C5B97233D175487BD632B62BD4BC97A3DFC1B353D8A34073D47F99FBB5A641EBD7FA190BDA02E733D2356193CE71FA4BD304E9EBC92253EBC282FB2BB3E4E8F3DEF19BE3B41CF963DC9F9223D10CC81BCBF4382BCAF3ABFBA1653463D0D8B4EBC9736FB3C08F9FABCDDE05D3D5A86643D0CEAA73CD0B86B3B36CC513D123C7F3D73AC8BBD74D974BDA0600F3D02ABA5BD8461CDBB0ACCA6BBEFC956BDD4EE283D65469BBC96FE843D4FE09E3D56552B3D55A5543D9C098E3C1146EB3C69D03FBDDD0CFFBBB98B37BD5479073D385091BD43104C3DA02291BD779F1FBDE43F593DBA58FC3CFF658BBD9004473CB55D0CBD2C454C3D2B87A33DCF22A53DD6BC623D21DD823D7F2E903D242710BD1A933C3DF64F05BD07499B3DE8B90BBCF11DA33D007DABBA74B0A13CE00C1CBC1F5049BD80C6763B7D1D8EBDAE2E573DA6E59ABCA33F9E3D30979DBBC080983AF5E716BD997A9F3DA0F3113D9077C83C54A372BD04FC983C561FD4BC4A4479BD8CB69EBC44767BBDC674403D08317C3C3A6180BDE7B18EBDF89520BD9A5D1DBD1CF482BC3ACA07BD14E19BBDE47010BD13C58B3D9ADF333DC0168F3B92145C3D4E257DBD3613223DC8C3663CE2724D3D399F2CBD880F53BDA0D464BD801DDEBBB89CA83CAEF83D3DA5CEA0BD48FA183DA1B93BBDE0630E3C3A558FBD47346CBD06203B3DACFA7ABD02F37D3D245143BD6E6A47BDD28E8CBDF65FA9BC8F5A893D280E29BC04EC293D47B6953DB80F7B3CF1A20DBD55050BBD804A51BB106BFFBBD0F8B13C060B9CBC56FE64BDB4BA093D72444D3D79A786BD705CD5BC4B0F37BD6D5F4FBD0896603CD742A03D6C3BDE3CC22AA0BC15CB833DA959A5BD9877883C5476293D846DF33CD037A2BDE4BA06BD727A3C3DD03344BC908FFDBC09EA8F3D2BB9953D4488C23CD0391A3D166460BD0C8955BDEDA78EBD267B453D60BA6ABB389500BD371D95BDE48EA03CF0C2893CB652363D12E67ABD5E20013D88F5DB3C72EC303D0681A8BCE7C00FBD115DA5BD354C3EBD12A425BDAAB198BD300771BCC87FB83C00AC99BA103E59BD61CE913DEF71A53D365D6E3D98FB97BC7B909D3D68BB713C3CD083BD5D0E4DBD805E34BA7665603D5B04A0BDC878213C7AA6673DE2B06D3D8ED84ABD0CAF87BC10B99BBC7AAF7E3DE4FA6BBDCAA2343DC0DACB3CB1DE9CBDF48889BDE8DE003D0074523C5B2480BD4E12563DC002653C47C12ABDDE1F1F3D683C7EBDAAD0B4BCB42040BD40E2D9BA9ACE113D00A2963A20BA953C60C4F4BCBA4409BD00AD81B9C25554BD0E8CA4BDE45C24BD60BB233BF49747BD63DF1BBDDE1F493DE86997BDD14A0ABD3849243DDE533E3DB8BC7CBC0F5936BD048F953CA886F93C4CE431BDA27B91BDE3A58C3D3829733C166EA0BC00AAEA3B7FC692BD4413E13C6018B93B5A27433D995347BD84F3CCBCA3B7A53DB16403BDF2AC603D22DB423DD40878BD1A0891BD68FE25BD20A2A2BC1077273DAE1E86BD0F4B883D600C5E3B7A80503DC06D88BC4CD6A9BC1A9703BD2EC25D3D06C85A3D3A03A1BD5260663DE44E9DBDB0BEE33BBA3A133D9FAA9C3D1EFF583DDB69A33DD0C287BB80DD573A6292333D6DD28B3DA013A63BB2314B3D8870523C3FCC51BD70FFC13C068E53BDB3869C3D3EC5623D42BC193D8EE6373D8084C53CC6495D3DF4B2A5BD006A5D390420FE3C38583F3C8880133CAC1D8EBDE67B01BD3357A43D30B2A2BBC4EFEC3CB278103D01A492BD943991BD4AF02B3DAE3A5A3DC729823DB8B183BDF8807BBDB063943BB61E583D740B1C3DE9389C3DB9762BBDA0B273BC787A763CC38E90BD48CA10BC65D2A53D6025083DC04DFB3A2A292B3DB2C708BD4AB0C3BC101EC63B207C12BB307F7ABC60DFB43B305E9EBB9FE486BD113699BDF8E233BDFEA2543DEA92393DF62F533DC2C9413D620EADBC4E38633D8635313D1A201D3DE0E5F33B3F2B8EBD2AA01FBDBDFC0BBD968D89BD7034463CF0AC423C8B8722BD5A39B4BC92859ABC56516C3D5C69A7BCAAA3693D36F47F3DD61D80BDB8F1F43CB795A2BD4072D1BB0545A13DC05DAF3AEB4747BDF05F25BDE8C501BC1E78793D00AC1E3D524A7F3D408FD03C50B19C3B8E57383D9ADD3B3DE6C08BBDE24B49BDA7E798BDC229343D461C493DD0A1A43CFB356CBD7024623C00404A39E4BC87BD88CC8ABC8840903C3D47863D8CA7A03CC882C6BC400A91BDE2D9653DC8EF96BD9627103DD8EE7B3CA9C58ABDA0E4BC3C6A630E3D445CF4BCEA48E4BCF09B183CE4949E3CC06E6CBC50E7FFBBDB5427BD2495D53C20AB1A3DC4A3F73CF6A2A1BDAEF0A5BC3CA7B0BC664F38BD74AF9B3CA9CE8FBDB453C83C3F8D0ABDB37D68BD383DC13CE05010BD8E185DBDF5BF78BD3A6A783D1A42C8BCA22F733D00B084BB989804BCA284203DDE37133D98A38EBDE8BB233C9E1E89BDCCD5E7BCA8FC8EBC5293E5BC2035EFBC286E523CE0427C3CF402203DE5A035BDB8B7273C506497BB122DB9BC5400D83C1DDF853D19B18A3D98F67EBC3C04033DF46A173DC481ED3C417214BD8081AF3B720E143D80B487BBA3E328BDB4CBA43CA84085BC7E8C573DFEAF6D3D98C75EBD00B8F13BC1992DBDF4FEBEBC6A1692BD72E57C3D404CDC3B68EC6ABD80EE52BD2AC991BDE1498F3DE493843CEC14CBBC34245BBDB619A4BC767B743D4DE79A3D6AEFABBC4A4989BD42223FBD00605D39C93C963D189A85BD480B6ABD15BE98BDEA405BBD6E3179BD238823BD6AB74F3DF5FCA23DDA9392BDBA1BBBBC605614BB70E30B3CC14B8C3D144381BD703A823B807B20BABF4F8B3DF39EA33D67CB39BD68088ABCFB570EBD6B0BA13D206D423B386B6FBC286169BDE0D3763B1EEAEABCE85B22BD48C8123D4E3941BD539082BD6666B5BC273F9BBDB07303BCE8F50B3D806D70BA7C35C93C8C1BA3BCD73CA2BD5086113C2A531EBD8E157EBDF3669FBD36269BBC726E553D68A578BC8059ABBBF0638DBC781627BC01999A3D248D93BCF6644F3D803AA53C9E0658BD5AD2763DC05431BB77FF80BD90649A3CEDA621BD2E22153DD8082CBD00F67BBCB0C4C4BB60C567BCFE284D3D7AAD7A3DD9D0A4BD60E647BBA0E1293C568E663D526109BD302EEFBCB871223CC87269BCBD24973D70FFB5BB48B5193D40920BBC3D2F9FBD42CB99BC703BC33BF8AF80BC00A92F3CEDBA6DBD603355BBC82549BC3259523DBEA70C3DC623FFBC0CA3873C36CC5A3D063160BDABC9923DC1588A3D469546BDC9C198BDF5E3A03D10D9423CBE65CEBC246E88BD50DDB8BBB8C267BD58C077BC917D953D95E876BDE71B913D811E2DBD2CA7B7BCEACE81BD306982BDBB399C3D184DDC3C92FB423D279392BD28E695BD4305933DF0F8DB3C80E9B63AB19B1DBDE597A5BD703E84BC64E789BC4D41833DE8D225BC824CDABC3E817C3D5A365B3D88D6EC3CA69CD4BCF08A49BCF04CE9BCFCBFB2BC46A8673DE4868BBC556E88BD13FE853D2E8BD9BCC0CDBD3A700D65BC3066183DCB3491BD58F90D3DDC9A84BC707A48BD38F6663C48ECDEBC5FFD81BD1AC07F3D9EA76C3D2CF9FA3C18BBCF3C1AAC25BDF2916DBD5610D9BC288E183DD3AFA0BD548B8FBCF82D76BCD646093D2836203D38BA313D1D988FBD80522D3D45BC8B3DDDF49B3D5666033D4CBC8BBD4AB2703DC8B2F43CAEC021BDF65D7E3D1918A6BDD01310BC24FFB7BC28BDC73C334D833D72F744BD71A59BBDC07781BA3019D2BB7E53BBBCC49166BD2B2800BD80BA4C3CDC7BDEBCEE6BE3BC70AA4CBCF2CF793DEA1D143D6A69FCBC5062D3BB8404C43C3D4D8ABD587E54BC5804CDBCF054263C79618BBD51C438BD3A5D2ABD4596983DB61466BD73B3863DA196863D4DA123BD86F0033D18BD2D3D13DD09BDB52A9ABDEA9D383D081503BCDB928CBDD0D7013C62A53C3D6E69F0BC545E20BDE8A976BCE41088BD6F041CBD3C838BBC32D65EBD1B2F9ABDD85C82BC7A65743DCB268A3D50F2123D2AA10E3DA222193DF893C9BCB0E190BD1E24C1BC98EE263DEC2187BDE02EE8BBACC3F53C607AACBB30E3273CE07C9EBB90337ABDE82BEDBC00C23FBC704C3ABC665EA2BC89F78EBD9A54283D47338A3D23FB6FBDDD65A13DA0336DBC966A793D988FB0BCD23C14BDF0E9A7BBF843A13C3086C3BC92E87C3DF22E543DFC19A4BD203AA2BB50FB973C800F1C3C72DD2E3D6C9C61BD11A3973D81D3993DAAF9F1BCC2D31A3DD1C59BBDB033CCBBB565883D586261BC08D753BC6596A43D6C7C8BBDD364863DE31599BDE0E50EBBBC3BAC3C80A4CCBA187F893C63DC9D3D30BB00BC5868FD3C56C4413D83F0813D594D8DBDE4A389BD66F2543D089324BDA4C4C9BCF6B3F6BC8A3A7D3D38153FBD96F44E3D4032343CEEAC28BDC817123DD09A8DBCD61F773D7560843DB9279A3DA226E5BC01D4923DCF2096BD80BA773B36C7573D5259563DC73A43BDBD953FBDBFB5A23D9DD9983D401D87BCD0658F3C3ACA3A3D462A633DABB697BD68B6C3BC411813BD7491163D3EC7593D407BD33C4039EBBB98D00CBCF49ACB3CB97952BD568B58BD6F95863D7A91613DA03377BCE20A4B3D884D223CDC5095BD0979A03D13CCA1BD92D64A3DF8C894BD407F0CBC74EDA63C9CCF82BDC36687BD8EE7443D94A2063DEB918D3D6CFA3CBD6EB7A2BDB8C8F9BC916287BD005D9F39F8B41BBC94F28A3CB15F25BDB3FE8FBD63E46D3DA6FB063C543E74BD2DB58A3D0E9F883C6C16863C2AA1A6BCC3FA4DBD89B9AEBC7EC91C3D2486133DA1F5D5BC28E04B3CA4EE903D7585A1BDBCF0473DF0F0D03C8064413A74C981BC326C603DD153483DC88DEF3BE175EE3C391A6ABDCF1A413C847B693B62A74F3D282D813DB7E21FBDFC58873D617DA0BD884553BDBAA98E3D70633B3D51CA953D9B2B843DD407D8BC46A68C3DD1A7D0BCC2FAA1BC33F5013C31A8EB3AF979AABCAA9FE73B8A23983D374EE0BCCADF1EBCFAD0A3BDE64B5D3D230D95BD8ADBB5BC515507BDCDA9C13CD95FC33BFEEE7CBD64C44F3DAC2D603DF87C703D98D7133DED41903D61C141BB26D6763D648C9BBA90517F3D5C4E383D265964BC426A863C6AC0693D2B990E3D9CF395BDA7308C3DDF5D52BDE50CDF3C06D897BDAA8334BC3C15093D03ACCABCC1282B3D766B9FBD1E0E9BBC67BD34BDDA91A0BC23F9AABCC15371BBBDB471BD41EDC6BCCFE22EBD544A64BC4A08913DB55673BD89ADB5BC08A9973D48CE61BD5EC9393D1EE8673D003262BDDEF872BD853539BDDFE484BDC51E9FBD5F76FEBC200F23BC615A2C3D0AE087BDFD804CBDA9393D3DBDE6493DA7869DBD00CA7E3AD6A08DBD44A0F1BC2B4F49BCE57DE83C48D678BD3EDD163C5C0F27BD2A1C6CBD6E45973DD292903CE25189BC55069C3DBD7E1A3CAAA45C3DBD59CDBC8844EA3CC6CD773D3A9A7A3D360AF5BC2BE19A3C4AE7753CE312D2BC1770483D6082C33C80B061BB307037BCC6DBF4BC7001A53CAE3A403D8F9683BB5BD88C3DC08C783BFD91A33D3EB45DBD0FF03A3DBB45A0BDAF31493D32AA303DC339A1BDDDA8573D20264C3D6C285CBD17D0B7BBCFA189BD48F9373D803DABBADC0A063D333705BD2AA80F3B66E7213D20D99A3D630331BAA14D6BBDC596863C397DB23CB9E28FBD0755C8BB5E0C82BD2B578A3BB1197ABD0DEA67BD7C18BA3C58C728BCBCCA0B3DC3EB2F3C217BAC3C798B593D60929F3D46CF543B3A3C6CBD3BF67B3DDA7489BC27E5D53A1D3B6DBB2C5E93BD17CD113DBE76C8BC0FC48D3D66296D3D7CD364BDB49F94BDB75ED2BCE87783BCE135063AEF9F7EBDF40196BA05BD3CBD66E9423DD80197BDD74E843D0268333DE989933D31E039BD795EB0BB418C52BDA05B133B52EF00BD532D37BD5C2DE5BCED7D24BD1614543D038D743DEAB8B0BC76FC6ABD3892043D1B6E0BBC9EEB9F3DCF448E3D455E303D79CF943D670C863D80B84D3B925681BDA78584BDC72B7E3C6C8280BC7B1C52BC3FDE16BCC53EFD39E9ABFBBC8D12B7BB0E441F3DA2D82A3D75BC9F3D42CB94BDC72E9B3D4C7A65BD3A69A2BDFA34A43D374B95BD2EC3103CB4D980BD0087A23C799461BD5059173C223CA83B1C8DA1BD6373823D3756F13CA93EE8BC1C4362BC0CA097BDDBE096BDBBC7123D909416BDEC7B45BC84F1CFBCD773783D587689BD548474BD5327B53BD43A9F3DE9038BBD01EA6F3DBDE897BD3686BFBAC0E96EBBEEE2963DF18D873D2B7161BD6B85C33CF010693D2739B63C0BE6863DDFC7F03C3F0F7EBC7A048C3DD074383DE162A13DC948D13C776C5ABCC026D13C072F24BD7A7201BDCD678B3D82D080BCC527913C492856BD1120813DF75E3EBD5E9E71BDD541F33C94DDC43CFC1F9FBD277A65BC740708BDBDD79EBD24C7A13C030DE5BCB90D723D593F60BD9A1E2A3D92B43FBCA57697BDEF1201BD1BA6183DB3A5B2BC87D52D3D516FA83BC7C48ABD93A1F3BCC607203DEAD9663DDCCB9DBC4D6C93BDEFFBC83C2849743C0B598ABC201827BB52A69FBD2DBA8BBC6FC03DBD12CE7B3D4300223C0FBDDB3CF7D1773D166284BDDBF1A53DA48866BDBC082D3DB753D03CDE2A083D3DE507BDD1E7733CC61DE0BBB1B8583DA8631BBDB117343D21174EBD7DE7903DDF2AE03C5DE48BBD8540D43C0FEF8ABD0D21643D1DB3A43D929C2F3D59E9043DD3BEC13A1C7CBC3C0D9685BCAD16853D520B8FBDA43A5ABDE5B99BBD7B51A2BDB099293D357F5BBDB7686DBD9790BD3CA8748EBC0B9DB93CEB5CCEBA49B3D83C5B8B9A3D8252A33DF16713BDCEFD17BD901AFC3C336B4F3DE212493D36E900BD46384BBDC3EA883DD5AA9ABD0E783F3D3DCD28BD47719D3C8C9FF5BC0B60A53D638BBD3BB77C6B3DEBE61ABC5E1671BD0184243C61EFF33C986354BD38846CBDA0321BBC0CF805BD9C1C253C3E88A4BDD66944BD9F9B863BE7CE1B3D388793BB12A701BD330C43BD6DCBF33BE827A03D007D29BDEC44393D91B59DBD8799433D7CF387BD78408F3D85A24DBCDB5D51BDE61C08BD1DB6683CFBF076BD797EFA3B48483E3D0A018F3C493C3E3DF6469DBD665B65BD988F5A3D2D0B7B3DB96755BD5DD965BCC9363CBD0A23833D3E81D13BE2A151BDD9CF94BBFA212CBD51C0983CF3C147BD94B83ABDFA100E3C7875613B990D23BC00F388BD08F3F53C90A3053D1A9F5D3C6A03253C48578A3CF8EC8C3D386E81BC242C97BDF316DB3B3C49F4BC2717FE3CC3CF963D9D569D3D9F647F3D333E223BF02F10BDB35C6E3CC2834BBD05D190BCF488A3BD450B8ABCDCA59DBDEB30543B682714BD08C892BD492C913DBABD8C3D1E9F5E3DABD48DBD6842C93CA03E0E3D02D978BBD068BABB7570823DDDAADBBC97869DBD41CDEEBCB871173DB72A2CBDF17865BC748AE6BCD40090BDEAE8353D5CF9103D595CCA3920E96B3D3B219B3DA49595BDC266B9BC25D8093D4A880E3D1CDE833D57A25CBDBFED903A2480D8BCD7E9893D31033BBD21FD973DFCDD84BD62D873BDEB10183DCB0266BD37D8643B3180383CC1A04CBD34AA79BDD3D8F23C5B6F463DD83F55BC24A70FBC336EF8BC12F591BCC911993D43BE343C39A89A3D344D893CDDFA0F3DA4CD82BDE4438A3DBE1B8EBD8A09A53D0F3337BDBD114FBAD5EC8DBC331030BD9B1CE4BB4AB09A3B3D44983DCE71933D9E4D77BD8F12033DA0CF333C38B0E2BCF3F2263D96ECDBBCE822E2BBEC12203D98758EBDDABC84BAF6B04F3DC773E13CFFF69A3C9C4E5EBD3D40803DBC5117BD732C223DE90250BCF61B143D451866BC5AB653BDFFAE143D8C1B98BDE63B653D1829833D65E887BCAAE8803D562802BD6840853D578BACBCF0AC53BDA81198BDB18490BDB4B52C3DB0B492BD42EF77BDAF23D3BC941F843C4E0CED3C674AB43B9FA30CBD381E0CBDF248043DB79759BD2E7EFF3C2F8A7ABDAC71983D06286C3D43E500BD735F01BDE9F841BDB9001BBC573FAC3C40793DBD443302BD4534B33C72259BBDB3FB05BD72CC8ABD7B1699BB95C29D3D559F70BD9A7B2EBD8C5B29BCFF5082BD8017CBBC0A4DB6BCE4A8353CA584803D80A68C3B3CD2BEBCA5A597BD60160C3D2E5C84BCA409193C068D6BBD3300913D4718713DFCE6353DD65AC4BC81BE3DBDB8EA4F3D4159953DFBBE8FBD8624353D639F2F3CAB2FD63CDD2F62BC74728B3DF1983C3D3F4E84BB0F6A13BD218E15BD122E0CBD06EC81BDBA1BD1BC770D7B3D4F6F3FBD2C188DBD2E353EBDEAB7553CB70497BCF16A603BD115E93CD00DA4BDFDDF063D9D78983D73A346BD48AC6B3D3BB417BD6936463DC8822EBDAEB983BD9FD586BD4529F6BA1B9877BB7AF4773C7B57C4BCDAF66B3D48AFB7BC17FD2C3C11CB5BBCA2F3573DC60AE8BCE9F25F3DD4FBA2BD7A0841BD2474793DEB2C86BD08A5E6BCD84B473CEA336CBD12CD77BD76EEE1BBE30738BD5F41363C2CDB6ABD45FE8EBC9BA92FBD7EF22C3DF9948C3DF3647B3DFC7D84BD583154BD2DADB03BEE8D9D39CF171FBDFBE736BDC33E9F3DB854873CA2309ABDA8B4393C01988FBB864465BDBBFC563DCC425B3DDD9196BDA29406BDA47B583DF4D4843D81B5BFBC2864F13C00649FBD7C934EBDB10576BC770F4F3D84990BBC17936CBDF5A450BD1EBE8C3D5A5F583DBDE2F63C155AB5BC04EFA03D991D5B3DE79BA5BD9FE64CBD65608B3DEE2FD2BCBAFF0C3CA4C9E9BBCD236EBC411705BD70BE4ABD36FE6B3DF385C93C586202BDF8F9F33BBA26623A7FAB063DC751E6BBF0B06E3D52F1D1BB527929BD6B419EBD0CFF733D2EEA353CB49B8A3DB98880BDC017813C33488D3DC804AC3C1581813DBAF361BD56F6A3BD57735FBBA10CA5BD01A4B0BC16E384BD4BC102BD50B21B3D96B60ABDAAE7553D4954793C60D03E3D60A4FEBC312839BD88BB13BDC37F18BD1C9261BD6F8034BD0E9F62BDBBC28CBDE20F64BC45320EBDFE9D21BD1C0386BCF53C11B8BDE645BDD7EC8DBDD35751BD50DC95BDCFA38C3B12FD3A3D51D98FBD6212753DF9C2D93AFB93813A2738C73CCBC29E3D38C9883D50F2AC3BCCAE94BDF00A01BDE9B6183D612D73BDDBC67C3DAF472DBDEE18453D3591A63D5934253AE90CCDBC39CD823D07BD3EBD7B589A3DEB62543DF80C3BBD65518E3D6CD281BC341C013DC57EE83CA2744ABD417467BD68CDE83CA9FF163DBB7515BCB0D70CBD4048563DCFA8B93C817B1D3DA65E0F3CDE1D80BC27748EBC64388BBD2AC5F63C1B8E813DA329213A863E323DCC0A213D0DA069BB8894523D56A8903DAA125EBDB172753DDEA2203D972D8CBC13FC85BDD5AA86BCA21CEE3CD455193CBA1F64BCEA172A3D824584BB3678AC3C73153D3DE5F965BC1E6A9EBDDDA49E3D41BB073DF1FE92BCF8888E3D05F889BD1646853D90B3E2BBA72E2C3D6F79FA3B1FF4D9BCB3C096BDC385FABB05FBD8BC063939BDD7AC6A3D9223623CA9B082BDEC9084BCD6BDC13CFE9E693A8B3375BDEC1B3CBB3C7B36BD12819C3BA102043B72A107BDB02E79BD8D5E27BD26398BBD5FE726BB6EDE5C3DDABE343DBA261B3D7989AE3CEBE02A3CAD38A33D1EA048BDAE490EBD083EC1BB9C5991BBB2C6233C195A31BCD2E1403D39628CBD4294293D88D9A5BD51E3FF3CF5E1AABBB8AA6A3B93F21D3D234F9DBD02C2993D2DDD4C3DB4A373BD0CA69A3C9B6B453C19DB6E3DF0A5433DA3C62DBD39B498BBC7C4CE3CCB449FBC24BA98BD5D7D7EBC19FDE2BB845533BDBBA2CF3C437749BD21DA66BD995A95BD5180073DA19C953D3EDAA73D74B3503D3E2B9B3D084646BCED7749BC09E62C3DDAC5ECBB12299C3DFA7A1DBD4476533D847394BD2D7467BC299084BC2E0F09BC96547BBD195488BD6463833DF999AABC0F23113DFC849A3D6245873DF2742FBD544573BD53CE96BD62205D3D52279FBDCBE27B3DECA7663ACB424B3C1FA17E3D31EC923C27213FBD25FD8D3D4EC68ABD6FBB523DBEEC8B3C9F7D893D2FF13EBD9DEF523D9717AA3CBA0757BDB0759CBD0C58213DCEC37C3C840E80BD9829AFBA4EDA793C66DF643BA671D83CE8D954BD14DE91BDF640D4BCB83D133D19F4ECBC4F82413D2977873DEBE4A9BC33E50FBD0F4B553DA5D82EBD52E99ABD3B8B19BD7DC79C3B4AE2803DA54CD1BBA33566BDA49C893D4C0D9B3C240787BD9D25A73C2C0EACBB30DA9D3D896F9DBD8FC98FBC70808E3DAC0067BD646D3A3DCABE2EBDFA7F23BCE3E1283D61909A3D7F57093D049EB6BC855D40BCC07445BD7A53EABCAA5A493DFB93913DA21B8EBD69E955BD17D90D3D24622CBC6B8FFA3C931F70BD93B7993CEA93513D9B95633D4CC89E3D94448C3CD1C66ABDC5B063BCEC8E873C68D158BCE6D32C3BA2C3E13C1D64D63B4295863DECCEB13C5ECD4F3D0949CF3C239D0ABD993B8E3C89BEFB3C59568A3D406ADBBC895345BD57DEF43CC9E3253CFFFF9DBD4767063DEB81E5BCA7990A3D67BF88BD5AE9F4BCB5518ABCF37B8EBD80D6CABB96E646BD33C4573D06CCF73CF85CECBB128CE7BC9DC109BCC80367BD6480893DBF8C5F3D5E38CCB90269C0BB71DB9EBD0C9B0FBDED3788BDEEDB43BD1059E33B36D66EBD524177BCCC392E3DB4420BBD5B35A5BC9856153DBF1070BCD3B38A3C7F15C1BCCAD981BB051245BDF528A73D038D0C3D90DC613D18D2AB3D0259E03BC7E5ADBC3939603DC8AB973DEEBB873D8F4CE23C0140E8BAFED32BBDE7EE7FBD8B2D36BD704C07BDB11C713C0598A93C4AF7E23CC0C542BD6794473D81788D3C1A049FBD8FF863BD675E883D56BFA8BD2C177EBDCF57DA3CCF70283D010C26BBB49E6C3BF3D6CDBCC8A4653D7E1AB4BCA3AE3FBDEE6E4ABD30A877BD9E48843DF0308CBDD3F999BDB2ED7CBDBEE8983D99117DBD09A6353D61CD0A3D25D748BCD1239BBD30D9023D73F7863CB0148CBC12378E3D4ACE1D3CE4535E3DBE8355BDBBA400BDDB1EA03DDCAA263D8284563D9D1E493D0DF6A4BD370310BD0DF9953D07A3313D4FDF943CCA0F863DE2B0343D9F978FBDED0219BD3EA5933D2221533C8B99483DF993563D02C716BD9D4E81BDE83A69BDF520713DF523E83C68E00BBDFEBBA5BC3365853CB60DBE3C97C9BA3C0CC6D53A473BF3BCEF12D1BC445BFABC8A1A713DC3CA473D42D998BDC72E0C3DE71F97BD2D4EA33B9D498CBD14ED32BB4042833CCBF754BB2B6DF3BC8112F9BCB5689ABDE81D983CC7569E3D301B40BD27DA213D4D649D3D300B8F3CFCB9913D70A5573D308A883BF2918B3D6B68573D7BB8413CA39E1CBDB3665FBD8C22A43DED1F743DF35F843D7DF3913D17E8F0BC1563F3BC345790BCEC42B6BA5C13363D7FAEA63DFCB6A13DBDECC1BCE3945A3DCBA02D3DD8FD943D239B163C7943823D56FA953D407440BDED823A3DDA4E82BD8D712E3D2FBCA5BB2CE7B7BC1651D63CEA8F0BBC118E333D73A670BC2C7C72BD04B0A03D1751373D99C45E3DD3CDA63D78D0033DA13E9A3C551BA7BB203D103D3A2B1FBDCFC5453D18A4D93C9AA588BD2C87983B89035EBD3B2543BD1C8F153D7C8729BD5EE418BD5EBBB7BB6CDD6D3DE3029D3D39D482BD13A380BDD25E8F3DD7FB33BDD62B3F3D31FC83BD5B60CB3C7754473D929EA5BC28224B3D52E7E83C82A3C13A4D805C3C8FE7703D3ECC5EBDBAD775396E5B703D3C37753B0077FEBC92B5933CA2BE443D18AFFEBCEA29153D84FC1CBD96A891BDEC4675BD57B6DE3BB46A9B3D117494BCC860E43CDEC6013D8D170D3DD8371E3C958E443D4556933DA5DC02BD6598753D70798D3D0937073D10D840BD67485DBDFD49B2BC2A29EABB3742883B70F004BD5EC2E9BC59AD08BD4CA2A9BD8DCCD33C3BCC0B3D3F26BC3C08AF0F3A9A5DFCBA24FF92BCFB6C9F3D5937733D8E1119BDB29C6BBDA2F3963DAE5E83BDE3DDE0BC300161BAE1FF9BBD03A7FFBC865623BDAFF52C3D7B2AF9BC974C81BD6A3AA43D3FA000BDAB0D8EBDA161A33DEA1B183D43B372BD080820BC4AF89C3D343F923D71F7883DA0D740BDCF92063D441F8A3C767587BDF2E7313BF3C2983D8A750C3D1AE78D3DD349143D687DEEBC779593BDAC351ABD651379BB81D82C3D45AA8D3D28D5353DC6A2683D656F9FBD08B2ADBC45CBAA3D2A8B87BBEFA6943D722065BB3A6BAC3C1968463D9BA7AB3C69F58C3CA3116B3DCCECA5BC06379D3D061F9ABDACCEF43B198FB8BC6376D3BBBEC53F3CD9EA34BDB092E73C3085D33C978B88BDFAB232BDF03D513D7929CE3CEB4972BD2EB995BD56EA083D8ECF643C03F8453D52343ABC63345EBD59C11ABDEC75893C7785443D2AA4883D6AF7153CD057A13D2A2C07BCD7A8413DD5089A3DE3E596BDE16E473D533B55BC4416143DB223F7BC19B8E53B131596BD7FCEB0BC569A803CB1F199BD3DBCF03C1226773D85174C3C59048E3D13952B3B0C169BBC07B36C3C86FF903D764B763D119B8BBD59695EBD5E0692BDCCE81DBC9E7D99BD8F37A43DEC945F3DC10788BDFAE5F9BCD1F087BD70A75F3DE2C080BB12C4D03C861FA93DF5C966BDD40552BDD5ED8EBDF7552FBD6AFA25BD299EBCBCD36912BBC9DDEB3C3B3E22BBDDA09CBDB02C563C92C1A6BD2405FFBCE324283DBCE9F13BB4BE923D60BD743D4E9FA3BC89F3A63D89EB323DF82F003DE3EED53C46B1EA3C0968BA3D78BEA9BDF66D8BBDE481A1BD37D5983D2D6297BD20F1963CD2733FBDA7F0673C76F47D3DD1B9693D531FAE3DC58DA53BD2D8133D546EA5BDED6422BDDDED8D3D7A959EBDB7618E3D1F2747BDD4C45D3CC6B994BC21CB743CCBC287BD13C98A3BA8E547BC58C657BD9ACB3D3D47FAA4BC80B20DBDB441203C6048A43DE07724BCB8492BBDEB5D7ABB93F16CBDB612583D72045EBD8A4FFFBC1EA88F3C615288BDF7C464BDCAB0A83DA0A2B83CA4A3353D6A0B0E3D7D6433BDC5E81EBC50B58A3DC8B28E3DF600233D87AFF43BBFFED93B4C0C863D215B2C3DF42DAB3D3DD7573DE692A03D233582BD37D8893D54D749BCDB20163CE4AF3D3D79878F3D95B9B2BA8D8C53BD2CD7AA3C281DE5B9182327BD096C5D3DFC18983D3E6BF53C8FFA7B3D85FB613CF0131DBD34DA11BC0B35FABC1008BD3DA0C8F1BCD290873DF9A16EBD052E8B3DB48D3EBD775279BD444286BCBBABE3BCE735AC3CDE5C723DEB5D8B3D4FD99BBD2E8DC1BB3BCD10BD823D953D700BC5BCEF8D47BD0036973DA1C5A2BD62870D3B3125453BE1149F3CCF72A83CEEAC4C3D52F8A93BD6DD863D86BF6A3D660AB2BD144DABBC20BA31BD3CE8DCBC594B35BBA610CDBB28F884BDE33A973CAEB959BD00E285BD772F903C792B333DC713683C3F8713BDE8CE95BDCE82043D46258D3CDAA97FBD7C8819BD4515D23BADBFAF3DED3F79BD16BB783DFBEB863D338F93BD7893013D0FB58EB9990FBC3C3D1E41BB6619953C1BA4693DBDFCD3BC9D5D94BDD4228D3DC51B523D1CD7DBBB299355BDD566B0BC47148ABDB24C4F3D1A6D1ABD10179DBCAE54E3BCAA1B883DEEFCA23DEEBFF23C24E7BEBC428789BD7AEE143D91A6A8BD42720FBDB9EF023B99C2C13B25D94DBD51925CBABB16813CB20682BBFD8B9FBD2B1C7DBDD52718BD247D053C18EB82BD95F2933CD8024B3D5CCB5E3D7131613DBF1C10BD5F80A5BD19A07C3DDA2EC5BC896E5ABD6F4075BD3CC39E3D50478A3C2FEC483D1A1A0FBD79C3B43CFACC0BBD3F54F73B3B9B6CBC40D3863D5610C6BC857A123D197D0ABD6D7D983DD7B34DBD64DB773D2279403DFC68613D3F9D91BCE385533DEEE5413D6CD324BD19436FBD44DD50BD63DF593D5DE6A2BB849218BDE50A9ABD592C2FBD77DC253DC05214BD67D495BD7663EEBBA4E68F3DFE6E2F3C85D657BC805480BDA64204BD4194383D0B7593BD901CF53C49EC13BCE82FA2BD7931923C856092BD25FFD6BC89FF21BC537BAA3D9398CBBB38DAA13C48CDC2BB5D1AD73C5A90143D6A50993D5861C3BCF766373DD5BDBABC859CA43BF7B099BD4F3B54BD5C42A0BDE8BA673D1262BA3CF6AE3C3D802460BC7090433D3C786F3C6DB7E53B8146D3BB24FB0BBD47637FBD173D393DA421863D0E6021BD801693BDBEE21A3DE92F6FBC6E21913D6F2272BCECCB5EBDA23108BD7B1CE23C171C833D548AAB3C5D5E25BDFB33FA3B01D7983D7B7E9D3DD06960BD2D8D8ABD36F188BD53D6E63CAD7E2C3D0B78743C2FB3393D01E796BDB6C9433D908B9F3D6FF4793D294CF73B845374BD1118423D1D6E993D909AB33D87BFA3BDA8C137BD435DECBBC460B2BCA5BD1F3D509085BD1DD201BD30CA7A3D8D72CA3CAA1207BC5F290EBD4D6FDE3C9D195A3D042E77BC60B12DBDE9E8BE3B1391D3BBBA8A9FBD7DFBE13BCA85753D6417D73BC0A53B3DB30F50BDE22057BD948680BD57D43FBD0F40273D8DD110BD5970B6BCEC5CB1BCB59DA7BD31A015BD6204A23C08B57F3D0BE563BD08692F393D8019BD8603233D1EAA953D852C82BD15E74DBDCF1D98BCA3617F3D24CBEFBCE83906BD196F353DD408563D22571EBCD859A73DF1E498BD647713BD4888813D47297D3D97381CBD82DB993DC9469C3D9196A0BDDC9280BCB601B4BCE7411D3DCBAD95391F99993DA829A3BD7319B83CE69CB5B944B472BDA7D54E3D66BF5DBDEE3D4CBD8EC9B03C66B9DEBC74D363BDF9D94DBD0EFF3E3CC769913D6F72C3BCAF6B27BCF38C653D4C2529BD20EFADBDCCA376BCF5DCFE3B49F9B53B6A8123BC26E29EBCD25D8ABD08324ABC44A959BC6A57273CBE6917BDEC408EBDD2209CBD0E3282BDD3E9783D61E7973D1CE424BD0F777F3DCAB58E3DE1019E3DB3D2853C8EF74E3DF074893C2D6EA13D189BD3BB6AA534BD57EEF13B132F62BC138AEDBB3BF88C3A6A7A943DE7DF78BD0B34393DEBFD1C3A2D395ABD8E31A13BDA042C3D3C22C33D155632BDB71F383D3ECCDEBCDBE3263D1B54FB3C0E99483DD2703FBC59E8B73DFC43993D56E5793D7C95A23D1647FBBC26061CBD328ED7BC2CB95ABD0ADBB4BCBCDD8B3CE08A8BBD2EEF9C3D7DD5AEBCD5E24C3D7A11A5BDB2707ABD45D5843DCAB4C43C6FD4013DC70550BD4D80453D98A854BCCAD9953D1D0AB5BCBD4E6FBC5FFF35BD40BA963D3101183BA8271ABC86AF7FBB0E7E7FBD01F06CBC6A58423CF89E44BC3802473D024E873C7A7967BD9044C13B8810AABD39B480BDE26A7A3D5C7146BCBEF482BD6591F9BC351E94BD775C83BCA346383D617FD13A5A39C33C1CF37ABD450157BD3E1B1FBD904B253DF719323DEF9A4E3CA8BE89BDB8DC07BD4C27D43C111BB1BC85276CBD0A56E2BCDC7A04BC51A3683DA18390BD6261B13C2C21243D4E450BBB3BE9C93CDD8FA33C994C133DF4EC88B8E5414D3D73211F3DFAFED03C7BC48C3D6A65933D2FFCC7BCB41E603D04D5893D15708FBD390109BDA1E52C3DE6E18E3D521287BDF0B78F3DAFD15ABC9A0B753C4AB498BD753D65BD44EB833D00A48B3D9B894DBBDCBD90BDAAE9863DCBC48DBD998CCBBC700C82BD403FDFBC89811EBD8DA6A43B3A62A73D9B03043D9D9E8D3DEDD04E3BC34582BD0B4F753C305014BDF089733C948D61BCD70A913D82EE34BD39ECD4BC21031EBC992C413D1D39353D191F8D3D32C9973DC6B4C1BC0F0A81BD16B0203DF969FD3B5C1192BB18CEF73C535174BD0F121D3D741A0CBD8A451B3D0ED7A2BCB7ADBA3D923FDDBC5F5B8B3D5B95A53DFBA2833CE199D1BC2A6BB1BC71C5433D265C983DE6A7E23C0354823DAAFCB83CB3E1C2BCAEF63B3C82F3C9BC1DCE8DBD353C193CD8D974BC58CF98BC6C91833DFDE400BBAF94813D5D885C3CA069E83C2F424DBDC7C1153D111D51BCACCE2E3DE6873C3C433286BC4212C1BC1F6B22BD6A837A3D93784A3C13CDFDBBE36A0ABDD8AA453D160E3BBB4D814CBC4682043D755DA9BC64E0A63C82BE97BC62462F3D2ECA4ABC403ED8BC6351963D88226B3DD98833BD7196983D9C2AED3AB3DB99BDF1F7633DCA8109BD0065093D49A2BCBC4E875A3D27E680BDA8F09B3C4DD587BDB55FD33C100464BD2619083C32FCC93C01E1753DABF9753B9088D13C9E650EBA47360FBC2E4D98BDE023073D6182CEBCA15E6EBDA4B291BDE2BE103DFF48DEBBDC49AABC1F3837BCDB52A3BD62B647BD80302F3DB99574BD9B4B8A3D1AADA8BD0CB9933DFEBADEBBFCE399BD3087A43DEA4E6CBD037725BDB4B186BD5FF8CD3C39388E3D0D958B3D5055813D20150ABD69351CBC414A353B7958923C39F395BD3F5FD0BC32C28BBDF4AD973D7A0F9ABD8903893DC33F3D3DC8D6D6B9EE04D9BCCA25973C02657EBD167B74BB49DF0BBD8AE24BBDDA69F03C186B5A3D49173F3DB3ADDDBB782BBFBB56A207BD7DB38BBABF6CD5BC1F98983C67578FBDC6C91EBDB3085B3DA25768BD146B38B889787DBD105B663CD2E4423D098F71BD1B0D6FBD52AD0D3CA21C503D0B43123D183BCABC26EA8F3DDEB393BD47581EBD63515CBDAA99513D1DCC823D2A89BF3C4B3B073C411FF53CC9A462BDB31E1A3DCE943BBD878BE4BC8C30983DC68A70BD44B94EBD136FAABC993253BD1DCAAABDAC6217BD8B569B3DE5E887BDB0F9E6BCB380EF3BD7F39BBD91BF493DC61A6C3D0B8A87BD3632FFBC44B9693DB25194BDD03FA8BD94375A3D96F27BBD839BA3BDADC205BD109255BD438BBCBBE561083CDD1152BDF8B93FBCDFE0E63C258890BD8DBFA8BB4F87A63DC3F130BD3FB609BDB7272ABD92289F3DE58EC6BBA47AAC3D35038F3DE36387BD5373E03B7D3F823DF353983C1A45AD3C4DD84DBDEDBB743DCDA271BDD8C4C73C6246A73C4B9D83BDC0936BBC56C3D23C5D8C853D20350EBD0E50CF3B67046FBDD7B1013C76A0243D82113CBDCEC229BD6B3C653DCECACABC2C4F94BD5667FBBB65B444BC9103D63BB7649B3CFA61443D2A69A93DDEEA8C3DFBD1A9BD11813A3C33B6AE3D14102CBDEF5BDB3C4931EE3CBB82803B368D9FBDF2ADC73CC2F44ABDE5799ABD9D4FB3BC770881BDCB268C3DDB8E9DBD5DB390BC97DDB6BC991B7A3C6FEA023C4949C63AAEF0FDBC33C986BDC5396A3C959D8D3DF0E654BD049F343D4F96F0BCB57A7EBDAC2FB13DEF542F3DB14823BC8A20813C0310AF3B4393E03BFCC30EBD7660C0BB49036BBC7A314DBD00C853BB3CDCEDBC618390BDC426813D47B529BDC066E5BC1A6F88BD433FCA3AC30808BDBAB375BD9BB83B3C2CF141BD97F01C3CD69ACFBC4C6665BDA6BE17BDC70F08BC0575A1BD0845843C744F2FBD47231E3C3FBB283C360B863D069742BD7A317BBD44FA063C42DF43BD94B1743D7D55FB3CCE9BC5BC708E45BD5D2BFEBAD2E3E3BC2121023DC644763DC56395BD8EF7503D50EC80BDA5E71A3D2B8682BDF580A7BD79C0BD3C9503B53C2193A3BD2B6F713D6B6F913DBEA39E3D90A2583D77709FBDFD8929BD1DD1A43CB896B33D06E984BCDD529E3D8A83773D44559B3D57609A3BC4B655BD66F9E13B8BEC8F3D4781453D28BE703ADD28CBBCE0E78C3D34488E3DB8158DBC13489B3DC1EF853D31986E3CCE779F3DD951E73C2803F13C10BF4BBCB779DF3C425286BD586E893CFBEC97BC6AB5063D47E9A33CBE571CBD009FB83BEC965D3D9258E2BC9818953D772212BD79A477BD51886ABC5025813D1D06423DDE5376BC17A50FBD35C211BD9EFD90BB3C1053BDBDB866BD476F8C3C2D6195BD09B5C2BC9EFE923D70739DBD97086BBDA2FD153D681D1DBD5DCBA03D0A6FF0B9CCB4853C1596AD3C458EA23DDAC9953D2F77543D6B9AA03D3CEFAC3D5B4C5B3DCC5B9FBB303D8FBDBF0F87BB912C13BDD5E35CBD7FEA843CB2E0DDBC8C6C353CC4E79D3DA2653E3D5B7E08BD4DE92C3C6E4175BDEAD9913D2B27FBBC7BD697BD7146AB3D9795383D6E0897BCCF108BBDD49E5F3D3051F13C920FA03BF3EA26BDE54A39BD9447A0BDC7B64D3CEB08EF3C36823F3D433FD8BB47F05CBD5F54D0BBEFD50D3D0337BD3BE55702BC4818E33CB3B2893DFC789CBCF72DA33D036113BA943249BDB21B8EBC03FC9FBD73D4FB3C1FE29D3DFA614ABD46A3FE3B428967BD5BEEBFBCB51129BC9198CA3CB297913DD7378D3D51D46F3D677D703D7FF1D73C88C5353D4D36693DCDFF953A784FBCBC302804BDE187893DD87802BC77B487BDFC26D1BC2328113DAA1E2FBD8206F63CF0304D3DDE5A973CE40FA43D08CC82BC2433533D695DA23D6CEF463D310885BC9F41903BED0CF0BC8CEB033DE1997C3DD6783CBD30D8AB3CC5D0D33C0B01B93BC4637CBD3D6941BD5497E5BC9F09DC3ADDF497BD9C0A51BD1638643D34406FBCDD3848BBEFC2E93C663AE2BC3FFB9D3D791530BD74E64E3DD89596BDC444EFBC6F29793BA87C9BBCF34F0EBD14995D3C160C38BDCCDB8F3B7DD1A0BDFABA94BC62A2A4BD569367BD31D54E3D620AD1BC286FCC3CD5A3323C95FD8F3D7CBF21BD8EA65E3CDA90D8BCCA44533DD3B95EBDFE12733DB3BCB63CD48C283D5FE1113D5548773D402105BD2C389A3CD6BD83BD6BC942BDB8E18C3D3EB8583D2E4DF1BA5810F53B9A02A2BB6B384F3D2D947CB8BFD68BBC8C8C6ABD7958463DD978DA3C2AD0233D2D7B433D3FEC4CBDE2EFD6BC02C9783D1AF9443DFE996ABDF66D913DA1B7A5BD99BB81BCCA9E94BD2B133D3D4A7F8A3DA17593BDDE216BBCFA268FBD9E34DFBBE98F65BC52BEA13D15D02A3D3614AFBCBD4AA5BC8C33A23DF648333DB3A9CA3C0C8404BD924399BD6365903BBEB6363D0603883D45A581BC3B4C84BD0395983D20E9413D581EEB3C3B47C6BC3FEB22BC19ACF23B932C293D2C7E123D90082BBD6716213D21ED9ABC594134BDCA17B5BCAFB7823CAFB24E3D82A24F3C107D21BC7B2C133D327D80BDEC640BBC24C53ABD0C41843D8DF83C3DC1D216BC5EB9043C62B7763CE087E9BCB2F0593DFFF4053B29F7FA3CBFFB843D967F023D686EB03C9666843D89279EBD81E3C63CB737A2BDCEEDC9BAB6FCC0BBEDACE6BB90F2623D0F70A43C0223FE3CBC9F723CE8F12BBDCBCB88BCFC946C3D0D9BA73C498569BC1601CF3C158EB03C8B660F3D086E51BD9EE49DBC44FF30BD582130BC9F8DEC3C3A3C063DAC3A3CBD028B823D9B399ABDF0E673BD5031843C1104733D8495223DAFA73FBD4EC825BC182BEB3C1A43963DA2011D3CB4F59BBDD31693BC1FF47DBDBCDB8CBD708F263D19B14E3DC946B83BB33C96BD6A25A73D8B95C7BC099E09BD2B6653BDE8D4D1BCCB238ABDE04452BC1C34563BEE7F613D2DE3493DAA3AEABCEE9CE93C5127443DD3E6C938D5625CBDD36381BCD3CB30BDCE1B943D1173A33D986A543DE84916BDB467E9BC2ACBEEBC67FF923CC745533CBDC80B3D822E4BBD473A58BD3295B5BCA11F93BD39017E3D3A9BDABCAFFCF8BC3758493DBF45753DDA882C3DD29DA0BD094905BB52EB87BD06A6B53C6B04983DE6B28C3D8588853D8912A43DCD01793DE8C7863DA5A369BD5E98313D25C7153A845F253D70384C3DCF18B23CE5A096BB5CBBB03B5C88683DDC420B3B0843343D7086073DEBBF973D51B9743D1DFB343D633D8C3DDA1191BC99DC17BD2F1287BD5BFD49BB8F7D083C656DBA3C9E99183D43A8A33D2EF62A3DD786B23C4ADC2A3D6AEDCFBC6FD7803D8962A13C040ABC3CB5A4143C394FCBBCCCDEED3C66159E3B7DCD3BBD266782BD0B1D333C493391BDE3CC1E3D249D1F3D1103CABCB292133DBDBC36BCA0192DBDE56C99BDB65F673C3B03A9BD72AE443D3C69C6BC1F855B3D9D409D3D8A60643DCB999DBD5B2F32BD7377A13D0F0F9E3BC257853D492F5F3C288A193D171A5BBD1E0266BDAB371C3C46EA0C3D055C88BD218D803D590E8CBDAAA788BC6D65C23CD8D00C3D7D6C0EBDF0BF19BDCE7969BDB4ECBCBC49560CBDE438513D8C69653BECF3953D1B75AC3B5406713D13182CBDADB0EFBCE3F573BD6095543D6894303DCFB8643CCDA6A03D85876EBD42A8313BAF6A68BDFACBC8BCD927843DF100913D3DEA833CF5628A3B7960623CE0CF35BD7C6AF43C1CEB9A3D60C861BD149D21BD76B59B3DC6FE803DA2264D3D4E49A3BB5168093DC80B433D527B6A3DC23AA6BC9B3B61BD1B31A53DDFFB1A3D8C4B403CEF4E37BD088377BD1E7474BD50DC903D8BC2D0BC770843BDFD60313D2E7BAEBC24DF07BCFE59A03D825892BD34D9563D72B806BD1785433D76D11D3D193994BD6FFD253DFBFA573D10BAC7BAEAFDACBC2B73293D827494BD421150BD4BF1F9BCEE2C203DF665E53CD75B0E3DA1AE023D5055813DA2C2D1BC6C69063DDCF9413D1FEE3EBB1ADF38BCB472D03C1E79353DABBC27BDEB4E6DBD00564CBD3A374ABDA344673D29572EBAA3061DBDE9091CBDF2C959BDF7AD3ABDFAB4613CDBDB95BB3292A4BDE1CA8B3D0623983D43AB83BD6847BDBC2A458ABDCC10073DAE4042BD5C9C4FBCC0E3E8BC92E1893DCE8E663D79507F3DC3A9333CEE7559BD3E4BEC3C7C5D3EBDEBDDF4BC1585893D3269993D00AB9DBDA02AA23D6A4AF6BB297FA5BB351C11BD98050EBDC2A69C3DFDFD3FBDAC7F96BD7CD9703D04AC1EBCAF5C5DBB4B7586BDF4C6E9BCB077543DA63197BD15A844BD062AE93C2017313D427C54BDDFE76B3DCE896E3D84CC2C3D56CED13C97D83A3D52DB08BDD976B63B98A3633D62BF5C3D2DC4063DF24E89BDBC3C88BD52AC50BD872D913D93803CBC830017BD246A2DBD50A9CA3C82529BBD474C513D6340193D8A6D59BAF50CE8BC87B9203D09A9E43CD772C33CFD6BE7BB904784BD78B055BDE33200BDC61D17BD67B2663C6BE606BDCF233D3DADFA9A3D0D329DBDCA49083D9F18E7BCD2BA563D54E790BDCB44D13C23305B3DB3F628BD146392BD0DD459BD3AAED7BCFB0892BD5788063D5F8DF03C26648F3DAB8E8D3DF40916BD89812E3D533F043D9E6BA33D27D9C13B5332A63C1CAC73BD72B33ABAE3AD01BDBC44043D348FE63C1FC8A2BD221D253BF965E73CA53E8C3DD96CBCBB95D16BBD43E7873DD09DC03B5574BEBC4CDE4D3D2E41473D45FF4B3D88B7293D7AFE89BD875E7FBD20B1853C9D58353DB0AE12BD7804913D4E6955BD8BC2513D9F676C3DB36A323C5F3F9DBD874401BB02267BBD009319BDCB89343DFE1A9A3C09FF6E3D129C683CEEAB763DCD660A3C5F659ABDA5771DBD647B313DD8FD543D28F98F3C34B8763D1FC29ABC3F13803D54CD68BD84DF99BD736BA03C20B88F3D60E899BD1808F13C298B5D3C0A928D3D86A5A5BC162D23BD985C85BD4CF4933D4523713D12DCB23C5829A23DD4F2293D28A625BD93FC7A3D43D498BC8F46333CA889063D17C280BCE8044B3C56F9863C03827B3CA409D43C0C4F4D3D277F13BB092390BD07434ABD2CC4A2BD861987BD908CF63C75ABA2BDE7A4773DA27584BC7BE769BC43FDB53C869892BD55E51A3C84FCA8BCA850673D413085BD93658D3D7E6C93BCDBA8E83CF734253CF0ED9A3D5A93553D1A20963DF337A5BD0B4E38BD329D2CBDE74E11BDCCD880BDBE43273DE01C9A3D55ACAFBC902D283CFB728EBDE0AA45BDBA3D523D6A336D3D06B5E03BAABD883DA06E7FBD296CE93BEA8C913D9FA9863CCFDF97BD63AF30BDC08AE0BCA97ECE3B8BCE33BD5AA1A0BD9DE9B1B9DE3A33BD71F38FBC157E293D67A9A1BDEB4B8CBD86FD543DCD22973DDDE48F3DD87293BDB9AE933DAE969FBCB854513D625D00BA208D95BDBBF2A03DC7797DBD1BC8D23CBE0D803D22A9DB3C1BEB853DC96D9E3D78F79BBDCB593D3DC5F0643DB3269EBD3B59A4BC725845BDDDFD73BC29AB5DBDBA0794BD3C877B3D1B156B3DBF7562BD904C0F3DA6FA40BA703DFA3CC891CABC650D9C3D7B31483DCC7A44BD24098E3C7B0116BD7FB403BD07D0253D6A73493DB7118ABB899234BCB08A57BD4DD022BD654857BCBDEE1FBC842C013D98E2763D676282BDDEA3A43D7EAC03BD57FA843DCB80173D517C273C62E8A1BDA06F87BDB63E8FBDFD17503DEA1B863D01C70B3D5D67A0BD9355FBBB0CC395BDA0128CBDE946F23C09A1C03C5BE4D1BB0EDBBEBCEED9FC3BF0D8C63BA80F823D37C988BD729B213BEBF3E03C6CDBED391769863D2856793B009B6CBDA094913CB0EC7ABDCDF351BDC3A529BD3F0085BDF76D8B3D918B54BD5D5246BB2C84913D29229D3DA16650BD7569863D00096ABABE36403DCACA6B3D40E8F7BB1F2B9E3D386409BD7E6A393D5021AF3BEC3A44BD8043FB3A5AA98EBD3409A2BD2212F7BC58E1F63CB68E043D4ADC363D02D5063DA6F25A3D4B728D3D19F2813DFC64903CD0FC1FBD66C13C3D647DA13C0416243D67C009BDF63EF3BCF24D82BDAB98963D80607B3AF4FACBBCB449153D727A82BDE0EE8C3B205F1DBC207134BC647B213D5AC2D8BC10E03B3C7503A43DC33015BD2E123D3D7600123D173A39BD10144C3CF4B338BD1C54AF3C81DEA43DF81514BD6CC2133DB839BCBC242A0CBDA8FFCEBC80A1083A6C61BC3CFB4D963D00B9C13A38B2CF3CB094D7BBD1538DBD6CE3B33C9AF50F3D2F52A2BD52FD83BD3668E5BC1845183D0926A33DB4BD253D4E1CA4BC042682BCFAA13A3D9E01453DD71804BD801EDE3CFE30D6BCF04F663C4437AD3C56470F3D7A2857BD32114D3D52A17CBD1568A53DBA7313BDF58E2FBD16C2653D29CF983D5E895FBD300FDABCC88D3D3CCFE865BD5AC5023D960F75BDA133913D2E72403D337904BDF93730BD86C6613D40E1853C26FEC6BC5022523C68C1563CE416DD3C80C5F0BBEED3EDBC82D3553D484547BC873EA13D9D288B3D8E9A6B3D90B9C93B120CEDBC2E521CBDAA86E8BCA0D14C3C06A744BDA99F9E3D209D6F3B78A506BC6CA337BDEE384D3D449EE23C46FE7D3D90FEB2BC44EEA43C6AE3603D8400B33CD6FE89BD68DCCC3CC0CD83BB0A857E3D80AA4FBB7F7433BD38282CBCDB3E40BD7F70A33D9C5131BD53D0A03DE0E228BB27F84BBDD03628BDC52F90BD5E346E3D4C4D61BDC63784BD88FC2ABC14F063BD8EB59DBD9D5D813DC012B4BA809909BC09AA8D3D18D3F13CA2C4E5BC7788833DBA45563D10A72EBD7AE6733D9077B03B3300873DF07F1E3D337F973D2B5D93BD34C2943C18DB7EBC817393BDCD5A3DBD482CA73CA4E4C03C403F1CBCC4EA9FBCB357813D1E393A3D9E5191BD70F7113D9DFB66BD956B46BDC913993D432E893D8A3E0C3D786F1ABC8C299DBC4178983D8033BB3A0EB75FBD6098DC3BF65AE7BC95EF3ABDD8937BBC7E2B453D0AD6383DDA1AC5BC70BB9C3C7AB689BDF2B08ABD093D883D7B5F803D2061C03CD27F81BDB47004BD6E5159BD52C9293D208C3ABCCB629FBD96B3B7BC0B2A2DBD27B956BDAD7675BD322477BDEA8FBEBC2CD88ABDF6B34B3DC00F12BBE8B5E53C46CE353DC1BD80BDA2F68CBDD9A90FBD78F759BC731E9CBD843E6FBDF893313C5741A2BDC123833D40E326BB7B8C99BDFA8F613DEA20DABCD500943DEE0019BD86AC503D69A90ABDD0BBBD3CC544973DF0EC09BC665600BD0CF8BF3C1AF0E0BC75948A3D1E0E9BBCC0441BBDE2491F3D58AD82BC60BFA4BCE087073DA0C55DBD584372BC720C3D3DB9FF833D00EE68BB701EDF3CB8DA293D10279D3B161E4A3D285D78BC502A443C2A661E3DF2D87C3D28320F3C6E8E4C3D8AA3543D34ED9CBD32ACFDBCD816F63C9D625EBDCD7C913DFAE85B3D77BD7CBDC5B1973D40D608BCC67F1EBDF8436A3CC0020DBB437A893D84EC64BD51982ABDC8FDC9BC78C6703C384C15BD33D08D3D324C383D3F5D9FBDA93554BDBCA4D03CBA22273D106DC6BB306AABBC8CDDB23C79FC8B3DB0585BBC400FE93BB21804BD74E1133D1A545B3D640BA73CE8AACDBC48E6183D8CAEB83C28C690BC1D8E4DBD20B00CBB4ED39CBD00310D3D70C9CE3C5BC3893D4294773D68888ABC9DD3A53D194B923D646D9ABD8EBB553D2010CF3CC863253C413C86BDF22B103DE8E9493CE4B646BD32922E3DD1F0843D204A12BB5F28963D8C4E67BD8C4138BDA0F8C03B03DF04BD805400BC3CE9AF3C4F7C9E3D30E8E8BB389B1F3D8EA5023DDD0318BD51FD8D3DDC4707BD12DCD2BC162E113DA3799C3D58F5053D5BC694BDDAD5293D1837A8BC32E7353DE26822BDC065D93C941245BDBE513E3D981897BDC9862FBD4F049A3D912F80BD36836F3D94A9A0BC10936E3C704FB7BB20092CBBE27D4E3DA1AC0CBD30498F3B594F9A3D479158BDA02ED83B84DFDD3C356A933D30753E3C065F08BD00113B3B5A5B4B3D945AB6BCF011313CD80A60BC8ED8F8BC3C91DB3C7C85D23C21148EBDAC9F30BDF4AA2A3D141F75BDE608273D8DD181BD9A8D25BDF8A252BDD77F96BD609AB6BCB62118BDFA107FBD0263583D82926B3D208D52BD453EA0BDA961913DFF149BBD808A1DBB4C7FD63CCA2CA3BC866393BDA64F6C3D8CA6DC3C5C1FB4BC928FA5BD00C03C3843FC34BD86E283BD189F8B3C7005A13B55E5A03D64E92EBDFD059C3D483A55BCD0D6DC3C804B89BCDA56383D5DFF17BDE44843BDF257CCBC845AA4BC3AF975BDFD83A1BD6090C93BF8D32B3C80930F3DC893223C16FF15BDF03D3FBDEC85313D36EA103DE8F81D3C63318D3DA8E00B3DBEF0C5BCC0428A3B90E09A3B00BED4B90CEEBB3C183D84BCBC3FFB3C1A5AFBBC48BB42BC0267153D408B98BA62BA9CBC1422203D2FCD3CBD6B3229BD08A5B73C9EE0763D7B6A983DB0D7C7BC252484BD003004BB242A103D41194DBD9EA26ABD622EBBBCE6F50A3D200D973C509931BCB2820C3DF8952A3D623275BD35D6873D48BD503CA2440E3D007277B9884BDD3C6E6AA1BD9B777FBD001253B95A9546BDF90041BDE45F92BC000110BD792995BD88DE963CE1EE973DAE5C3E3D46CC40BD104D90BB4023873AF87D80BC625E8FBD437988BDBAE772BD56FF6B3D0A8F41BD32DBCBBCD4412D3DD9B08E3D18C810BC4CD921BD9456DCBC92642E3D00912D3A329A30BD12231FBD803CB2BB82D79DBD36E7433DD2751F3D3922A03DD06367BCDAA7313D8C47F73C977A23BD8110823D82755ABDD8E17EBC0A087F3D00BCF0BAB32436BD60C5663CA073443BD924603B4374A3BD2EE9963C3138A1BD3FA997BDF9B5933D8A2C58BC0A54143D0A9946BD67569ABD7FA02F3D5E33273CC7C6D3BCCC4685BDA0061D3C3C676B3C1E0F433DA2165A3CDBB569BD46AB353D5401753DF628643D554C563B7A1A35BD032E7E3AD39B763D1DF176BCD2A14A3D509998BC9C778E3C2C6A96BCF703C5BBB7E8D8BCE4739EBD142250BDB55423BD73006F3DAFAF8F3DE2BEF83C9A2576BC1E22D83CDC6514BDA0AB8A3D50C686BD931196BDC130A0BC52C1143D4407A33DC5AB46BBE05BCF3CA01E163B8634D6BCF4B673BD8485CA3CE6B4F5BC125D4ABD0316893C21ABDC3C8CF2473DCAA3ACBA4FE2D13C8B2D56BD65B367BD66FE1D3D4644573D9C76963D5063173DD58F603D0556803BF545863D90AF03BD5CE4A0BDA03500BC2D6C2E3D8ED7043B182E38BDFD13633D197345BC18CB9CBDC1B5A33D001686BDFF9B883DEF21E5BB766B18BDF2B48DBAAA88A13CA16D97BD03C15F3D8F8F80BB0F7149BD6188693CF5E8713D55CA283D521F04BDEE6D703D8A21893DBFFE99BD408D1F3C8BE6EABC8FCB683DAD3FE1BC3227FBBC50C1B93B4D3C71BD51824ABC01248EBD5D4A9B3D02678BBDC7E594BD5F20A23D435144BDFC741D3DDC1C273D95EC9A3D28652ABDD4F56D3D2E829FBB7CB00A3C20277F3B54173B3CB2BD76BC583FAEBCE15363BD6976D4BA6D8630BDCEE2A9BCB44EAD3CC0CF2D3DC4AFDE3CDF3ACC3C1EEB9CBD2E2724BDED8664BCFAAE9D3C186DCABBDEC57DBD8202F53B5E5C53BD971B523BCD16A03DE43B26BDFF862D3D7A03743D6EDD2BBDCC8D413D4047293CB1A7903D139C56BBD5E3973D1D5012BDDBEA36BDD203F03C27A388BDE0191A3DD394293D0C28F7BC505AD33CAEED3E3DA6ECACBC1CD4ECBC4471243D61AA273DFE55553D520487BD3294CABC209B12BDCB3F43BDD50EE63CFFE1D83C346A5BBD7AD60F3D2C41F8BC04D01CBDD209D43BA81D9ABD249C483C36B89B3D4B583CBCFC39B03B63527DBD04FA933D4FA6303DC9F8A7B96B5D2ABD4757513D3E33B6BCA159713C3D8D793D3286AD3C518293BD4307063C37720ABD3E58E33C66220ABD008331BD5ACA5B3D749CA33D81BC5BBDC5E719BDBE3B643D6BD81EBDCF8E4FBD1A9C253DDBAE903D48B3943D2B57233BBB8A0FBD4930643D5C9E9C3D64C84FBD7DE5953D3C3A72BDDB06193D340537BDEEBB0FBD2ADB8DBDA57049BDBE6E8BBD538FF83CB25A8F3D2ACF60BD620D993D027E6F3D7780223DCBF41DBDD2E2A43D5C0F473DCD9A9ABD8F751BBD967246BDFDDAEF3C91D5073C3C9DA0BDCC9C53BDDAA59BBDC38E0DBDD4D23D3D0A46DEBC78341DBD6D7490BC635345BDD2377E3C7D306A3D2681663D33C966BCB4A0A3BD5D5675BD4BA3C2BC761E553DCE9C933C42CC7B3D5901883C62339CBCBDA4B4BAE5E48B3CA7CCA73CEF480B3DF4B0463C031D1EBA1D8653BDE4F84F3D558D97BDACCAD33CF141993D5B8C46BD592E3DBC5DE7733DD00BD0BCCAC607BDE9FE0BBDBA9C7F3D40E4823D39FA2A3D94DAA93CBBEE2D3D239F44BDA751763D52B0933D22D29C3CCC75E9BCE0D6133CDAE35CBB9211083D438C5FBDBD2F9FBBBBF66E3D13C3FB3A6BE670BC9514EFBB53840EBDA9A6153CC0247FBD35E37A3CC6A035BD853AE13C477F36BDB1F663BBAE4B82BD669340BB139763BDD42582BD2BD8263C7D09883D455E893D45892E3D20A2873B0D945EBD7A56853D4A670EBD5CD35DBDBD0CEABAA31B5B3D08C20C3C3ED39D3D4F55663AFEEB913D7EA8883D0AD2DF3C08609B3D4EDA64BB3572853DF7F79EBD3A45B53CC034083DAD0F0DBD8C842B3DB5038B3DFE0C8DBDED88933C73F373BDAB5C15BDB9B9843DF7A87CBD03952E3DD5DEA43DED979CBD706B92BD8516EE3CD90C80BD34F202BD9C38E0BC6F0C83BD9EFD26BD3C30063D3F3118BD80195DBDC14B5F3C6D95343D179414BDCEDF91BDE8692EBCE82CBE3C207692BB2F52A63DC0B49EBDF7988C3DE60703BC64A37ABD4F9FCCBC264A58BC6A59263C0B3BD43CBACC89BDDAE1893D208282BD7C54A1BDBD5C70BCC9118B3D97B8993D23918DBD603C543C19BE833D54F28B3C7C020B3D713756BD99D4A4BC7178C03B1BC7883D539C13BD4685A53DD5E2BA3CEA8BE03C87AEFEBC44D4B2BB36A5403DAFB77D3C9E924E3D329CEEBA4AF21FBBD6EFC1BC527404BDE04CB4BC4FBF19BBD1BB6E3C9C19CEBCFBFD163D2576043D929CA03D6E2691BDCD1FB43C79D4913C732C88BD5AD08DBD5F4213BCA2F558BC773C703D0A661FBDD01C07BDCCEA1E3D89969BBCCBF1FF3CB8E7D5BC4D0652BD31704A3D7C380EBD3ABF08BDBCE588BCF84E473D8B7E233D0A7E64BD5B53B0BA15A865BDDD5E4E3D41341F3D370600BDC09540BD94ED51BC52B0173CF363AB3B9C00ED3BC0437FBD225BF6BC4D84943D452EEC3CA5661FBDE769EFBB18288FBD12310ABD3AC819BD4CC03E3D9890E3BCFD85FDBC426D713CBCA0793D5B9C99BDBBA026BD4B861CBDD43A1F3DFD191BBD7EF3A43DFCF7A5BDC2A5A5BCEF3B86BB9AFF943D6C0779BD49B3993DACE91ABCEF9D42BD14E4643C351E5ABD89130FBD18FA1C3D187E6D3DD7EE95BD07F60ABCA23371BDFF70983D0223093D9557683A1CE318BD145475B9373AA2BDB8B9333DCAABF93C071165BDA8E21ABD604C46BDF83234BD3C16FC3C35B591BDB79997BDDD2701BD0564463C6735353C25284FBCAE95873D7FEA22BD9707863CEFF336BDD4FA493C0949053BB68E8B3D1F5A883C934571BDC3A5F53C449DB43C50B80C3DFF409DBD4A7DC73B410C983D82228ABDD45081BDDAA6803D6E8C703DEFD4593CC431E93C64AA26BDB1756F3D4962863D572E623DCB2670BC9FA1833DF6414EBD6BAF1A3CC5280B3D638CA13D9E3EDC3BF4923BBDBB8577BBA76C753A22EB5F3D6833A0BD6E4AE1BC852C2CBB20B47B3DCBAE21BAE0CEADBBA45C33BC630DDDBA7C5FC6BC1EAED83C42C24EBDB905263DC6A140BB85C882BCA154D73CA2781EBD1384533DF4EC91BDA9CD873DA673F2BCAF0638BDA09F7F3D4B54003DA37787BB5F9299BDAC0DF9BB8C04C43CAA0EE13C9A6B3C3D6B31603C4856243C70B8ED3C71B39D3D7D1771BB54BFFF3C1B22823D9241DE3C8BB4633DEC7D433D5FED933D7AFB473D5E19A1BD490B32BDD0956DBC6A85C4BCDCEE30BC6A5621BD6580403D2F4473BD9C3E44BD192488BD667189BC669661BD19354B3D320EA23C942410BD345398BCE11DE2BA9C4B80BD057A783D549E963DAD859E3BDB8AA53D720EA4BDCC3E033CBB7A6EBD14EA95BC72941EBDE4F16ABD90530A3D25F0053D8A69423DB5DA663D352B21BDCB712F3DD8F1A0BDEFE9553DD5D7963D8FFCA6BC6CEAAD3CFB5C8EBDB3FC11BD972A013D1BC3333BAEFD6EBCB2C3E8B9672B2CBC0DAC90BD972A23BBFA2E2F3DDC4283BD971DB4BC04E493BD241A6FBD6A3D04BD7A06B13B26AA413C31988ABD223998BDED53983D3DA4943DF574A4BDAAF2A23D8ADA6F3DA9B71CBD2CE24D3D5E4C693D88CF27BCEDBFEABB7F8E8C3D839CE93C2DDB31BDE84536BD426BA03DFEF916BDB3EE973DE4983A3DD845A4BD63BD9F3DD1B01EBC755B773BB429973D6990EABC73816B3DB70A443D804387BD3E7AA2BCA27258BD8CD0A73A0F105A3D79039A3D7DD22B3DE242323C261C6CBD287E0F3B3163C0BCDD263FBD2F5107BD8EF41A3D134428BC9D498F3DF23C14BCB67487BD912D3F3D684B443D51BE5B3D9EBF0DBC6A8D923DC81654BA88B754BDD6B8C53C5C81843CFDD6AA3CA110663D164065BC974373BB4499FDBC69D1A73DEB7418BD6236B4BC7C9DC9BC6960A0BCC8E0163D09AE23BD6E58533C65B61BBD5D7491BD1E82743D0B8082BD92F9A9BD3E8DF0BC1750993D97EC12BD070AADBC25D272BDF298EEBACD7586BD8C39063DC8CB5B3DD00E973D4A0C823DF067873D3BB4383D3EB578BD079F43BA644C753DFC5A48BD830F62BD361F423D8BA4713DDC8C213A1029113DE27F3B3D0E8592BD11F185BAA6D28ABB4F8061BDB31A03BB410127BDF575EABC0A2A933D79718EBCA6DDBBBCE4CADB3B7B8158BCDEAA05BC1A81723DAB2480BDA8768A3DE4A9813DF48C6DBD767B22BC9DB7033DB4D8A3BD888C4DBD683405BDAF3E88BC4473893C6487F93B5626A2BDFD009BBD390A9FBC29EDA7BBF6C0A6BD4F19933CFB7B243D991A21BD284BA7BD0396773CF8BC0B3D6BFA42BB6C4B7C3DF4B078BCA75028BD9A2261BC0CF6773D85AEE43C345B633DB88703BDD3B7073D8226753C12A107BD30F0213D7120373D7A26B2BC062D1EBDC92AAE3D9EF9183CA4FA4E3CA89D7B3DC0F61ABDC9D0D13BAE925CBD8345323CBEA7D8BCDBAFE5BCE2C01C3DB67D003D5BD6833D109A5ABD4437913D00CB2A3A4E5E9A3CC993973CCF9F00BD9F7C17BD44F3A0BCB2E057BDBE8E5C3BCE35A2BD341B49BCD6454DBCDF9B703B0711143D99DDB63CEACA893DFA254CBD448276BCD3D5A4BD5B34C9BA542529BD4AE97B3D184591BDE045A33DE27CFE3C0C8F793D98E3973D0F44EDBC572B54BD1C1C12BD71DAC13C1DAB933B7BF4E8BC05FA8D3D08B9A5BDF3F3963DF61488BDE7B5E1BC48628E3D69FC41BD21B78C3D676E013D630189BD7DBD88BD9EEB90BCA91EADBD8BDA073DB9D474BD4C927A3CE4CC223DD8409BBD25DA2B3D37FB12BDFB531E3DD54CF1BC88C783BC33589D3D5C2F2BBD5657A23D395C07BDD8632CBD05AE863D52151FBDFE69E4BCC2EF8BBD9422D3BCDE2C133D50A9E13B7C2484BA9A13193DC6C306BD62E7993D3B096DBD82446DBB42153C3D8478843D8E3074BAE6876BBD0354753D689D253D6A3585BC4B7AE63B27C9A53D2EA7093DF450AB3DF801B3BD4CBC48BD8D5B55BD943441BB425DD53CBFC327BD353C9CBCE49D253DE89C863D74DD8ABD4E7A00BD37AEDF3CB69A65BDB8D8FEBCF0BE0ABCDF1F323DC97CB9BCE295113D975946BDA3E9683D48E9BA3C06D9403DDD352E3CE28FF13A1AA667BAC743FEBC65AD72BC3670AA3C2E3E4C3CF39B45BD6A0397BDCFFC6ABDD189F23C9376B93CD292C1BC9674983D79A300BAE1647B3D8DF5BB3C99E1343D9E050A3B4983053CA652A53DD38564BD101A8B3B30A5633D1523A73D8B2852BDABD6A33D78E1013DC9126CBD0945BABC2EC7923D3DAA42BD95B836BDD990B63D024626BC5CDE78BDCF6B82BD57F1A1BC4248AEBDDBBA763D4C72173D8C18CF3CC09F7A3DC8289D3D7B88C5BC2CB98ABD2F030D3DF9E3563DBBA69B3D26E51BBDD79F20BD3EFA803D5FB193BC86A6763C585980BD55890A3D6E8E06BD518B54BD873C423C1D99DF3CF667663D6EB35BBDB47DC2BC23161EBCC3A3FABCA84B223DC178863DED89823D46E88F3CE5C060BCE2A05E3DE31E6E3DE6E1343DFC5AF23CB16B693D9DA81D3DDEED53BC076D29BD05E4773D738684BD45144C3DB3E7563DE6DFA0BC75D220B94C9DBE3BA44C3C3DD822E03C5C3F0A3CA484823CE9CCD4BC245D6BBDBAFC35BD4F14343D550B7CBD1A688FBCF9DB2D3A72EF533D16581B3C41CB593D6F1C9EBBF85E13BD501135BDF2733F3D4EAE8C3C2E292CBD8C9C3ABDF5E54B3DE7B82B3D5B8E663C2304B7BCD937723C2833CCBBB5A89ABDC71E6B3DC4D680BC2639ACBD0661893DA6DA2DBD34B5143CDB97913DA9C340BD12D1F4BCB81163BDB1DD393C35E960BD98CD5ABDD821DFBCAFE47ABDB7748C3C0A6078BDEC8E14BB5B26443D6554603D84D885BD99C2823D9F2F233DD335293D3DD292BD511F60BD931709BDD021403DCDF7083C8E2BE23A4CE9DB3C3BCC29BC7BAA4ABDF9505F3D6D962ABD767ED7BC6BAF05BDE229C63C68FFA0BB675CBBBC21874ABCB1559EBDA7596DBD14445FBDECC1983C4A95453C424CCF3BB854E83B0422BB3D762BF2BCAE7EB2BD86E935BCAF04F2BC4B3CB2BDE5D4743DD08F5C3D5B1B823D200EBD3CF30A12BCC1EC1D3D15E452BDEACD243DE6FC05BDCB5946BD1F1A923D0E2A9CBD3E3304BD4F6B633DFC756D3D57111D3CA31895BDB8C80A3D506FB53C9C63D5BB23CB8E3C0246333C1CC376BC29E16E3BB030403D155956BD5B2A82BB328B503A3EF310BC825861BD86375BBC546B0F3DC1806C3D6DFDA43D0D088CBD88C6A2BB9F635DBDD69B8B3C030A443DBD11433DAAE48E3D20E3A1BCD5C680BC16E401BD3C53703DFA97553DF50F64BDD3E166BD459378BDD2824A3D72438A3D69FB0A3DC6B29ABC3D9962BCCF3A91BD18653F3C6CCE91BDEE41973D827D4CBD5E788ABDB45821BDB08354BDE31C4FBD7175F9BC175A543DD66B50BD0D0AF6BC814C79BD5AE173BD89D9B0BD38175E3A87CB833BF732ABBBF59E81BD98ECA93C7CE292BC0B9E92BDF54E14BD2150ADBC18C8283CBECF313CF2519E3D2F709B3D667C4C3D1A645B3C987387BD90575BBC63C599BC9176DBBC27D223BDCBB3813DF1C86E3B2424B13B2CD005BDF5EE7D3D212D8EBB5198AE3D0FFC5A3C455E1CBC97F1533CC0F65EBD55E2A93BCBC1B4BC49F3D8BC1F208E3D4071F7BC09AA4DBC85DD49BDE86917BD84805C3C59230BBBC6512DBCD6428DBD397924BD853E84BBA203083D065590BD113D0FBD8E90B23CB767A93B6ECB993D5A2D44BD410DC23D2A9D0D3D7FF6323D6F57283D391B053D8CEA2F3D0AD7EEBC7EF75B3D8B0780BBA7EE36BD46C6AB3C88061C3DB415C1BDEF7A00BD688CB8BB7D55403D893E713DF93EE73BE14244BD3721993D2D3A0BBDBFC17B3DBFC357BDE290A7BDB92C70BD9085A53D79AAAC3DE0A75E3BDBA090BC8EFD263DD18D513D0D2AC9BA63FE7EBD89B5273CCAA697BCA1C333BDDE73843DC4FA913DD0AD9C3C758415BD17A3F83CB2A79E3C2B9B303D0F96893D234F9FBDE3CD9D3D55EE8ABDB5066EBD61FE02BD3C890ABD92EAF43C4A8B89BD027989BD701C753D713A393D1B13B6BCCAFD5BBBBC6D86BD0BDAE4BCD16CA03DB5A74CBDDB099EBDA5EE81BD3FC7A4BD3BB2573C5A7359BC70114CBC1BE566BD85A790BCF47E28BD5D51633D7F78A2BC99FBFC3CCE5F77BC66F313BD0CE48CBC689894BDA61F8BBD6F4B9F3DBA1C2A3D1395593D33BEACBDF0ECBCBC248677BD582651BC548C22BD9B47EABCB0189BBCCDBCE5BC731F0FBD1DAAFE3C57A226BD99D1553C3FD4873DB241F23BEF1C66BDA8846F3CF8937E3DEFA406BD70139FBD1EB7703C67DFF63C19D587BD4C57CC3AD4B72D3B27A358BC5003A23D8D0456BCB583ADBCE0EEAF3A433468BD5B91633DB3E801B86398B23DFA9B1A3C81B997BD9971673DCA9F883C4874E3BC9E63103D2F72B3BC1B6C453CA0619ABDE19F12BD1C6B97BD1759D3BC0FFB28BD0BAF1ABDCB7D3D3D0B9F763DD9D48F3C2F4AB63C092D89BDD5A293BDE1CD3E3D953E043D96703D3CF84AA13D26D91D3D5D9D61BD0B37153D022A653CA6C88CBADE2B463C4CCDA0BC0917A73D351080BD28E21EBD2FD9313D9063483DBAC09BBDB79F023DE29DAFBDCF555DBD794D3FBD7E26B73D4B446EBD2180563C347303BD31B83F3C2B91DD3C3E48273D19F1B63BFACD4CBD6547B8BC4F2B69BC372A69BD57C80A3DC0123BBD969C9FBDF3C0443C23660BBD91FF903D913D9F3C336E953D51E9F53C100834BD22CDABBDCF13CABD9841EBBC0D6F5A3D00B810BD845354BD45C3E3BCB76D18BDE849E8BCB2CD33BDE729943D107B7C3C12E3E83CD75733BC88662DBD04A873BD32D891BD417652BD696FA5BC0B4C673D9C7C4CBB7F608A3C3302313D28D877BD1AE30ABDE85EF53A1E36E0BCDDB6123CA5BD26BD739E4A3D7B49E53C720EF5BC9B1188BD13EA80BD2D3CCBBD0F208EBCF8F7F0BB56321E3D58F7823C05D6F3BC73D39ABDF4270DBD29FE6DBDDA8AB63DE5A6DA3C7C9939BD4B5E52BD83B5513C6185ADBD5C726DBDD1F3ADBDC4AF843DBC91A4BDA42E903D6C5A053D84D3593DB4796E3D78DC62BDA4C73FBC3F2DC53D2AC3743C217D2BBDA3CD653D087B5EBD0C641A3DC64C5BBD4EDC10BCEA2458BD5298083DE97DB43C03424C3DDD567C3C4C9854BD0F21883A54A70F3C6CF045BC05B205BB5DEA52BC7DA0823DB18D303D7CCE3F3C8E168EBD4A3D2CBC365353BD2F9E35BD68545BBC7B3211BDD1A919BD015851BD9E017EBD55128C3DBB8177BD94322D3DD8EC96BCC1674F3D5F6C743D4A7DCABB89DC843DB790E03C9781163D2B30C8BCA94755BDD3179CBC1A4799BDEB6404BDDE80C03CBFA2923DBFC0B43D7AC9943D93F8953D9C8FFCBC559703BDC66D373DD7F87E3C4B8939BB1120B1BBEB0D253D2D00F7BC0A629A3CA14EB3BC8FBC94BD4E71623A425A91BDA14BDB3C860EF13C7C948B3DBCADBD3C24AD963DDDBBB1BD3BF95FBC3717683D3E9F28BC9FD8713D8E31543DD5FC5DBDD638783C3699723DCD626BBD5CA542BDBBD50BBC9FF25CBD720BAEBD882A773D7EB9A63DDD4A29BDA958503D24A22F3B3B2CCEBCDD658D3DCF9C92BD3C0541BD2A8FB1BA042370BDFA004E3D030D51BDAC2710BDD17B2A3D7E75EDBCA0CA183DC766E63CED9B483DD9959BBC5BF508BDAE168A3B959E5A3DF92FBE3D3DEA86BDA680593C543110BD30632ABDA463583DA0FF933DB229903DBC2FA33C563520BBE568403D6333C53C380C29BD7FD1A93ABB021F3D785D1FBD04442A3DEDCD5E3D6144823C501242BD5B2D22BC3D870FBDC4DAD23D4E628F3DF52E543CF102C1BC14CA483D12F5003CE18750BDF7572FBC0DD4B23D3BF36BBDB40A393D0969353DB9F097BD7CA40F3D4DF4823B3E20A8BD249690BD62C8943DE322923C9FDE70BDF47300BCDE6B69BC42C92A3C4D1D0BBD4E653B3DD022FC3C4B45913DAA874EBCC755583DCDF404BD914B8E3B994421BD0305A0BC98D5773CBB3CFA3DC8E6833C36ECC53C143E8C3D6AAC943DBFD7CC3C0FC41E3D56F450BDD887813D837B9B3CBFCDC9BCF401A33DB3B85F3DBB85933C83C6993D5F40433DEFB272BC8995403DCBD3583D14226CBA5D8424BDD8C68BBDB4984D3D8699313D64DC993C1FBD863D1462A4BCCB1A6B3DFE30D1BB12E60EBD4417333B4163153C4DBC373D04E5C9BC7B4C8C3D1C03583DA328B43B283CBDBD44378D3C94D768BC8B1FBDBD9B53F1BBC89A01BDFC43C5BCABB9B13C000E833D6AA31E3D92B01BBCB72682BCB88B653D03B609BD76428DBD0474893CA9F04ABDE6567E3D661B0B3DDCB2ED3CD103DABC3FA15ABCECA3483D0990853DC84A9C3D2C87F2BCA19CB5BDBE6E3F3D535AA0BCD2DA90BC20D8233CBF0221BDAD5BB6BDA807813DF902963D6629E83DBF4EB7BDFABCCE3DCFDAFCBCD39B7E3DFB73CF3C74F6953D5F241CBA175F0B3D454FC8BC50C88A3D59D377BD8EC994BD1448B2BDA7048C3D589487BD577411BC15E22C3DC4D3DF3C50F687BCF132E7BBF800C0BC5044E73D65CDBD3C739388BD73A43F3DF0A121BD96CD3DBD93E068BB21A8EF3CE22748BC0CA19D3DC2B9AC3DA67930BD82F9263DD499F13A103F2F3D3B9E2DBD1322A6BCF3BB9BBD94019EBB357BB13C589D1DBC185810BDC10FE33CD4F58E3D1504603DB1FD12BB9B7FE63CD7156B3D0E00A0BC1555E13BEBF2903DD06ADA3CEB1A41BCA666893D6637E73CBB95233D68CDD03C209962BDA75CE6BC6C1333BDE3557C3D2B45C9BC68EEB8BCA2B19F3C24467ABDB8B939BDEC854BBD303E063CFE63903D95BFD5BC428B8A3D7BDC2EBDA7C0D4BC505D9ABC53EDB13DCE5EC1BB349AA43D2F9D92BD3705133DBD30C23BDFC8C43B388EAF3AE7126B3D96203C3D3E1451BDD60E033CAF66CEBC85D396BD240F90BC18A2EE3B0956FD3CB938063B5C80D6BD7BDE153DC379BDBD21410EBDA85E173D265E8EBD5DD75A3C647FA63DB040F1BA8A3E02BDC1F085BD0FCC2F3BEEAF7C3C904F99BC119E00BDB2FC4ABDE82B203DE7FC26BDF258083CAACA9F3CFE522D3D28F7A8BC925C403D57F78F3D8509DFBD839F96BD74294A3D960D353D0602733D790DEFBC6A4DB9BD9A3685BDCF3085BD674F58BD2E07EBBB2D5F583C16F4AC3C2A65303DEA44103D7DF580BDB11A883C5F6AF63CEE9EF13C071E163DBBE9643D6E19893CF6BC7F3D4806ABBD5007B7BC151D9EBC3C19363DEE0CF9BCC0A7193DE5FB08BDF77C85BDA2D5BDBA2BE9F63CB1F2C63C084B2ABDF53EA5BC5B6DC2BDB9C80B3B8C0E6D3C37307E3D0047813D6D169D3D1ACC5BBD32442A3DBC25963D3EF5B73BE9BA4ABB4C65DF3C718E083C350D423D409BCC3CA8F88A3DD7AE91BC206918BD0845BDBD69275DBD968797BDBA39343D63C1FCBCE065F2BC422B933D934DC5BB8CFCBE3B5D26A13DC058E5BB6D344CBD3E28D53DEBC4C33CB57B6A3B9FB3A63B4189ABBC299C803D2C1ABFBC9F16973D854FCE3CF12BA23D783AA93C4D9C3E3DD8ABAABD7E3E07BDD4289F3DC5C35BBCCEF702BD75FCC4BCAA56F73C661A9CBD6EC5773DADC60C3DAE197D3DEE8F913DBC14953D5DC5AF3C1098103DCD03ECBCEFACD43BD66698BD6F08B9BCCD7A56BD15221FBDACC55EBDA6C6A3BDDA7C89BDF242D1BD782225BDD3E608BD3F3196BDA710B8BCF6ED5CBDAF3D473D662F08BC1FA793BB066A7C3D0C89223DEF0CB2BDE30A0F3D288B7C3D7DED833C037678BD6EA02FBC8C1C313D905288BD06F72CBCF72FBD3C35C0E53C8B23AE3DCFD7A3BC5482C7BBBF4D8A3D7B28B43C4B48F4BA637858BD6295163D0E37B2BD86576EBD03B372BC50D5B4BBAC0E983CFB858ABC9F6CDD3C85E8EF3B8D020C3D358C9ABD02AD9F3B724BE83B62AE2E3DAD13753DD5D8853D33C086BBA79B573CF6310C3DC41A493D1B64553D06D43BBD4F52033C9A9E4A3DA34646BDFB48453DE5CD66BDC85AAABC71567D3D13766F3DBCB64ABDA8F7903D337718BD7DB1A13CEF0F8EBA902FCF3B952B9E3D2D38CD3D44DB5D3D13F7463D1D12B63CE7EDE5BBC564F4BCD8FAA2BD893400BDD606AD3C5022D23C56C3D33C30D88D3D2A5DDB3D106D2D3DAD53813D56D288BD54DA3ABD237E5DBD8E90AF3C214FFBBC20F1123D83C5693CF1E0C2BCD0B904BD223158BC84D1DBBC4B0E0A3D4E391F3D9424D8BCEF4FA73D556A813D8D91CD3C290E463DB1284FBDC451A23CACF895BD7C4B54BD05DC96BD1E5D753C82CE43BD20792ABD28D850BCFF988D3D319D8E3C67EC50BC9BC460BD60FB8F3D09AD24BD3F9244BDCE0F903C88C0DC39EFCD37BDC4F2C83DE39D49BD1DF326BD1E2D883D59EE03BDC8DEA13DAD6A4A3CC3871E3C073D89BD707882BC87AD81BD49E7DEBC40F02FBD7284373CC381F0BCEE4EDEBCAEE3563D2C1A70BD336B18BD1B8E433D48329DBCBC55413DBA9D303C82041D3D05C9933DFA8CDBBB98E443BDB314803DF6DE2FBDCDAC0DBD227CFCBC71E54F3D9949933D5EE18C3C4CB555BDD3E6553D721C8ABDEC629FBCFDB817BDC57279BD6A76BABB8420843CFC1D0BBDBC04B9BDD2EC5EBCC7919CBDCDC3A33BB71C8EBDAC77943D37C939BDFF6B30BDE8D4B23DB6AEAFBAC83473BBFEC54DBCBFC39C3D460240BD7358443D5258323D9E0ED23B46AF16BC3A0063BCFE65CFBCC95D803DE4378A3DBB80A43C2738F9BCDC42643D43184CBDFF15613D4F4A8BBD30C42CBD61439F3C981FC43C6AFF53BD314E203D2E8BCE3DFA3B10BC6072233C6D38953DE3C1EC3CE3180F3DEE970B3D68BF61BD3503383C28ECF03CF50A0B3D729A15BD90EA59BB75A511BC2C61813C88960ABC8CDEA5BD614D6ABDBF3B153DFFD79ABD85F3A23C4A42123D8E819D3DBFD010BDDFA12A3DFE1B49BD6FD2E43BA97EA9BD7D28913DA9BB593D3E0F613D9A2140BD4647BF3B3FC538BD260523BDF9071CBCD100C5BD466FA43B8F9B38BCD43C3B3D6EC07ABD5555193CC01B75BD43B8233D5E60983D5635563C6E3B92BCC20631BD0BAFAEBC588B97BD829E6F3D2104603C2FEE163DACA220BC564B6CBD0B701F3D4DC5943D924FDFBC745E603DC74094BD4FE42FBD3F1445BD492495BD3787983D0D2AA33CDDCBA9BD83F2763C3CF28C3D10FABCBBF8FD9BBDA2B7073D6A5708BD48E9723D63099EBD3B6F2A3DCDC1C43B9EFC72BD3B26F5BC9DBB653D4A635D3D916F6BBD708F1DBD7ACB0DBC7F3730BDE202A53D86DB5B3D556E623D210B773D90B7363D57AE39BDD2FD283BFE0882BD0D73E4BB76EB11BD97B4C0BB7B3F03BD9FE5943D13047DBD84EE863D1A764CBDB742423DB80A263DDAEC0ABD70757C3D1538F4BC649D4EBD56DA04BD1B8974BD5582F73C99977E3DC4ECF9BB0524A8BA1372623D1997203D2CA6ECBB1437243D38B9AB3CB8CE9DBCF22F8FBC80633F3D766CEE3CE11C15BD5ED95BBD67F85ABD979905BD55FE81BD3D558D3D1BFA6A3D72E1B5BC77FFFB3C3A39C23D248D20BD28E25D3D720047BD3D5389BDD147DE3C1B91D43CB91AA0BCAED76F3D322B8DBC9FDAB13D9D47BB3D7B10C03C8DD2263D35D280BC378682BD5467413D9597DC3C8B4F3CBDC492D7BC182D623D04009E3DF4904A3DE6B935BCE05F9CBD5256EBBA7B2FCB3B13FF263CA5B137BDA6FF6DBD97A63F3DAA0A99BC8127353DFCBB0E3A648A96BDF68F8FBDF2D3DFBDB0F06DBC2C070E3D98A9A73A918F44BD08E482BDD87B90BC615DB93C15DB9B3DF266933D54322C3D5737853CB5F2B13CB7156CBD83B5CE3C395988BDA13F68BDA2245FBD47CA43BDEA0FB93D47BAB0BC48B34ABDDE80ADBD513E83BDDEAF083DE3A48C3C5C08EE3C97E9BC3C3543EFBCABDD9D3CED93803D4E4648BDB690F03CC260363DD1CC9C3D8EB89FBD7D2E2BBD8F3A873DDCE988BBA85E81BD99CA033C5E1DA2BB548AA83D56638DBD3A1E79BC6953863C4EBA6F3D72A8243D8FA1BD3A9F06773D7AE4D93CDA093DBD0E1E713DA110A6BD809289BD3794B13D322720BDC91D11BC60B1A33AA45F4C3C235C003CA5AB6F3D6C716BBD7E02AC3B96A4893D6F5412BD2B8E773CA9B380BDF093B3BCE56273BC4B1A803C45288C3C01CD5A3DF61CFFBC4A47E93C0F80693D406F083DE570D73C5D4B763D8238FF3CABB363BDB2B851BD944BC03C2B39CF3B3A9563BCD76B5F3D720AA73CDF4DA8BC9D7A4BBDB3A4133CB6D19F3D33BD8DBD93BDD2BC0034A03D078419BD86658EBD26BF1C3D73D2FC3B8AAC86BDDE62113DC71E8CBD71FB743D669A6C3D49B85EBD7FA9673CEB0355BDF315953DDCF30ABDF8786B3DE41CC0BC5D1D27BDACA0883D240F383DFF7E8EBDF7E1813D971CC53CD99755BC53622BBD5EB98E3DF8B4153B664AE13CCF2D953D648D343CC866D03CAB9C2A3D78B899BDFE19063C91D1053D07F6E63CCB23043DB3C5713CA0785ABC7A186F3C9A87F23CD8D139BDBA2621BD4D6C753D20FC323DDA205CBD4EAE413D266E64BDC495843DE15A733D4C2990BD1F11163D7401A63B4297993D2BD00EBD92DC433C767C713C1361CABC365DE53AFF69AB3B8D4D18BDC5E03A3DC60E433D11965B3B770247BD340F8CBD06C6E8BBB9B9803D4DBF5EBDCCD005BD8D7989BDDB38823C9BE289BD87E93FBDB0AC7BBD4BA2F3BC3495423D0AE406BDDC9C2FBDECB60EBC72D22FBD46393E3DB1EF57BDFA18203D999DC13D22C5B4BC49C368BC8144E0BCB81EDC3C6988C93CA985A83A3F37053D6FA1C2BD17AE43BDDEBD4A3D79B37DBDE1AA603D058F72BD9C9FB03DC52B24BD0A13B3BC4639793D033E463D5315A63D52845B3DCBFEB13C71D86BBD798EC13D35427A3D14E866BD8D8D593D4BDD5E3DD501A8BBDF78AABD1E484CBD7C04043939391B3DE7AFB3BC9F187E3D5324393CF9DC103D25D543BD7D0F033D31E83A3DB3A0A13CDC02AD3DE0EB78BB342E39BDC3E13B3D644E713D13DF1A3DBC7CA53C849F49BDB614DD3CAB8414BDEBC09FBB7FE3963D2C09503DE41851BDB326963C80AD6E3D618D2A3DB4739DBC2502DFBC0A6830BD5B05813D9912E2BB92B6173D972B4DBD109B9E3C35329CBD064EDE3CB9720D3D68B14F3D061090BD2BC19CBD9DD8793DF758E03CD07B653DC3DF713D091F843BFF10723C2A893CBC9D5518BD7F7366BD745F9A3C8D663B3D65FE9EBCE63CAE3CB82BBB3C4BFA68BD7D6778B9304E5A3D1F0971BD511C42BC28DB8ABDE013B0BCA24D423BE531D53C87CE833D5EAD8A3C3B44313DDBA7853DDB5692BD18B1F23C78A012BD938AA53D5029303C20EF25BDAF3D2FBD49A35B3DED678EBD80C7603CB083033DE74B823CB3723E3D9C65D13CFEE7183B1D4C953D701BCE3AFE4EAE3D14285DBD69E1763DFB5DD4BB1F8FAF3C57FF9E3DA27B9B3CB3AA3B3D0656A73C367340BDA652303D1CC1A0BD545B8D3D577D0EBCB3690DBDB6787D3D226580BB759390BD528C8DBD976CB1BD11DC013C3E660EBD69DC75BC9BF3533D51FE88BDD59E203BB9B788BC3BA3BABC5FC188BDF5F00B3DAC8A4A3D97C393BD758CA4BBF21E8CBD918696BD59BABF3C95495FBC15A8B13C2F89A03D0B19343DA5960CBD6ED394BDD19273BC5341243D1BDF0C3D61406A3C80913C3D6C39603DFBE4413D2C5E8DBD17E0033C7D3E843D59A0D63C81E33E3CC4F37CBDCCB41D3D835063BDB1DD8A3D83CED03C37E5683D40D6D93C28A08F3DE2EEF73B27C190BD03EB59BB8305B33D3C8B2FBD76CC2B3D24D0753DE3FA7CBD0C375C3DCDB8E6BC6CACC6BB85E61DBD55C39E3DD726473DADF700BD244AA5BCC433F23CDA3AF9BC52C4C73C76537BBB9C48D73C164482BD10BE233DA2455FBDA17243BC86AC843D0733663DB0431DBD980F28BDCCC6F3398B9F593D35AE0C3D500ED23972009DBCDF4A4CBCBA1924BDBBA7223DF5FC3ABD8F951FBDC81656BDAB44013D30376C3B6CCAB73C5EFCAE3DFA4E8F3D011E37BDA95C63BD8E8A833D97403D3DADDB85BCF4E4013D07DC89BD1E429BBD9C34C13CEA4430BCC6ABA43D17945D3D4F1A45BD9B1D833D7839143DDF9C923DDFC11E3A5116343DE93784BD6C313ABD892BD63CA8B45BBD5A275F3DC50E8ABD917B43BD81009CBD2C2A8FBD27A7B63C9C79DB3CFBDC603D1F126A3D785494BC69EA7FBD55C6EDBA1C062D3D2D03A63D600CEDBBBD07F53C5DB4643DC2513BBCA3E3883CE737ACBA597213BB57A7B4BCC5A5193A94E6EB3BEA9A19BDA96C9D3DD3AB30BCF711E23CD4E453BC533940BDEB259DBD1B6964BC866A6E3DD674913D812C73BDB4265D3D2917203D5D0B65BD46D2D2BC8A032A3C40F1443C12EC913D2F49BC3C0425E93B8C7CD7BC06B79EBB07D738BCB4300BBCC2396EBD3FA18ABD4FD47D3C7B1CC13C2D54963CEDB2A53D7557113D2561383D7361A2BD1AB3243D085BA9BBC824953D53FAB43C64DF643D12118B3DD04D843DEFFA84BC7026133C7DD681BD0AFA9F3C9561B23B16BB7D3C205300BD9B2C3EBDE843203D14C60A3D80DB713D8194E53CB80465BD5373403CE7B574BD395689BA7964A5BC5D3D8A3CC602043D77ABDB3CD55F7DBDF71290BD52552E3D6BC9A6BD4E516CBD11B58ABDCAEE4CBDF9EBF3BCCB028B3D2EA0FABB7BE2E53B75379DBD57520DBD5A333ABDD0E0213C67B5AA3C7A8DDEBCB867473CCAB7943D9F2292BC438F57BDA435353DE42CBCBC55D5B63CEA41543A86F99F3DF34E313B9B5CA73B23FD4CBC812D64BDB73DA03B80C3603D40ED703D217C8BBCA63558BD083E09BCB3F780BC5F3F163D68269BBDB7E2933BC42E903BA666D9BC6567543D24CA753C5ABB7ABD64D6683BBB1FC33CE1FB533D73C78D3DBE7A043DB24D243D3A17BABCF38BBE39947399BD903DA43C4DF3D33C7FE0853D0C7DBCBCE34405BD79EC2EBB05AD653D88FC963DF33551BDF96295BCEA9C623D66DC2EBD056CE6BA4ABBD93BE6725DBD9896C6BCE44B89BC55DA883D8D432F3D556113BC68DF7EBDB4A7EC3C9E4CEABCEC38903CE88E793D7BCF8C3D6A5AA03DBD02FB3C80D7173CA72D313D3E0A8EBC4B94423DD7C3E7BBBF6391BDAF436E3D4ED78DBDDC8990BD500FDE3C144899BD6F236C3DC275D0BB200D9A3D3962913D504AB13CA1A94B3DF4E3683DC0D9413D9FE47E3C9093943DD331823B58274DBCF0A8FEBAFA5093BDFCE089BDFEF99A3D6C213DBCBB38A9BCC22A82BBB701F43CA9628BBDA86F8B3D8633B5BB03C58EBDEFCB233D8E6638BD2554693D2C8E84BDD5B5A5BDEBC243BD8DF781BD02C17EBC2DD26B3DD4C43C3DDB7D083DEB2141BD0091833DDAC1423D2D7E47BD29E3F1BB332D553D0A54DBBCC5008A3D2A0A833A366244BDC049913C05B2F13C2B1E653D435F833DF4F3133C3F2A63BB477034BD565F56BDDB437FBDFCBC71BDF40797BDE6872CBD9FBD913D7610763C099540BD6880363DE6D282BD7BA3603D7662173C54CB16BD8A225D3D3097F23CD7647DBDA99AB2BB49B189BDCFE335BD97039CBDEF1687BC18C388BD855D85BD3D9A8EBDA3CC523DA7F19B3DB7183FBCCD93B3BC7B77D43B5681C8BC2E009CBDBE05E1BCE18396BDAACE6DBC5EBD993D48E5CCBCB89A5A3C24F8263C2FE4B73CFDE2453DE99945BDE4B157BD61B5E43CFD11083DC3F0FE3C7FEC513DC906AABDC23A463D86D9BA3B30A9BB3CECAE1E3DE1641DBD424252BDF7EF003C53A7873D2D879A3CA63A653C7545A43D5DC2F33CAF0D8BBB28DD7BBDC524133DC958E0BC908EA73DF247283DB8A7D03CB30BA03C3548BF3C225C1DBDCA02CABC6EFD2E3B236B39BDC76E8C3DF2EE9EBDBA8BF83C08FB353D085958BDFE3066BDD5BEAA3C432B633D928A713D7E0204BD0F458FBCD5E93A3B6411E93C526C46BC248350BC490215BD59F7993D0A31A03DF1615CBD6B20FDBCA3B0163C3B5993BD5D2746BD8D67BABCCC9F3A3DE1C4363D76BDAC3C5A4A043D67074BBCB063423D78A317BD2AE28BBD2E39983D755579BD076D6ABDA95AB13C91321B3C0D240D3BB2C293BD1FF8B4BB584C473D3D094BBC48CECCBCB487F2BB010743BDDDCC75BDD0E0453DE3988EBD1FBC52BD653D9C3DDF06043DAA3AA1BDCFB4493D5DAD12BD4278673D2B50FABC1F19973BFEE68CBB085B5CBD1953A13DA7F40C3DFCDC9FBC180E113D9CC07A3D8C7882BD3CF96CBD2D8E763C9AF00B3D565CB73C2C3C8EBC31A68FBDD3C3623D39E64C3DC5F46D3DE2226BBD31984BBD44B91D3C69E829BD9509893D8001A63DC2C3A2BDE15DB13BC01B58BD55C38D3D1BA521BDB8833CBD99818A3BCC7C7FBDB5C2313D5E2D693D70C80C3C70F98ABC64250EBDE2D748BD7E6397BD16C1FF3CEFB4E43C57C7943D1F96DD3BD20B8B3D657CAB3CC6AA8A3D6C7D7CBD1E8146BD8AB6B9BB5AEA953DEEAD81BD657C54BCFA8615BD934131BDEF75323D09A3073DFCE8DBBC5532403CB1C39EBD872C8E3B0F270CBCB1FEAEBC7D88B93CC2EE263D5FC7E83B68E7493C0A8009BDAE2F113D5872CDBCC0E90C3C31B08DBDFAAFD7BCD9F1553D43FAA13D47E07BBD988CA5BA2DDFF23B8041A3BD77B0A0BD451329BDBEF53C3DB7689A3C2324973D0A439D3DF6C3123D60978E3BCDC875BDE76F9DBD14B66C3DF2901FBD4B029ABD597B52BD708A57BC4A9E8BBDD4B7EBBBF08E55BDB92091BDEDDAA33D9DC6763C0792963DD05BDA3C730F7A3BA48527BD10A8FABCA7EE2B3B62E47EBC4192EF3C83FF22BD5DE0083C2AE2573D90DAD83C563D423DB43395BD19BD543DB327833D25138DBC0DC4C8BC9789063DFFE6B73B1D0A8E3D550BD0BC35B1823B349CA43DF36D3EBDE38381BD7F0B8EBC2F92133C17444BBDE09BA0BD6C2231BDAA99203DA0158EBDD682A8BC964DA03B010B943C6F613DBB6EB0853D78D5A1BB5AEA40BC55C39BB9E6088A3D09A59EBD837478BD90331A3D44410A3D6ACBAD3C6053463C30735ABDF910D4BC201BEC3CCB73823C23BE3B3D7F4E233D8A002B3D059193BD9623433DB24E09BD46528BBD93198E3D171B0BBD8094A73A9851AFBC642E68BDC46871BC56532A3D7020A53B4DFA9E3C1C26F23C4108353D4FC06ABD90C1833D8308ADBC93FA1BBCA96E903CF12EAEBCA0930ABC3F0588BBF1F5583D5D8744BDE8C9A33DC3C3313D95EF08BD9AFE7EBDB5C1CDBBBF1599BD55EA45BD9B7D80BC205E893DEB7314BC99C0A43DAF2C6E3B369C78BD77DD17BD8610A0BCE5E3A0BDB2029DBDFC2BCFBC80C81BBC60A5C6BC92F3B5BCF85543BDBE8C383DCE0B653D001FF7BAC88BA73C8489CB3C6272513D3B4D0EBD9C8FBA3CBE2EB3BCF0CBEA3C75B984BDE04FC5BB9CE857BD40B7BDBA881DCABCA0FAE93BA4247ABD6CB937BDF474DFBCE8591D3D662B583D2E122A3D00045E3AE22794BDC4F593BC99A64BBDCD5D3DBD4FB2A0BDC8D14ABDE59A60BD503469BC388028BC985DF2BC8ABF413D1CCF993C902ED4BBAE9B8BBD30EAF03C514B943D7ABE453D5CAA97BCEDE798BD2BA18D3DDEF2DABC76CA493DB8D372BCE6E54A3DC81BE9BC4E717DBDB63F493D3C6765BDA01CA03B7C0B063D9B8411BD08D5DC3CAC112E3D98801F3C7886013CF086BC3C5292163D9FC492BDCFF89FBD931DA43D94DF0F3D9B6057BDFAC8423D50F79BBCB4B552BDA61D69BDC06EC2BAFF6D8FBDF607353D3E2CA4BC60FE58BC66230A3D58E41ABC08A9F23C1A62643D75C194BD3E0EDBBCA08B44BB9AB45F3DCCFF59BDBCBB85BCB8EB683CD484103D00551F3AD2BF663DBEA7783D1E03523D8815D9BCDEE84F3D54C794BDE07903BC30DACABB664BACBC3956A53DF9F441BD8094ADBBC09D1A3B16F5623D42A097BD41E547BDE02FBEBC4EA346BDCB0E43BD772DA1BD08AD87BC24E5EF3C8081773C7D46993D7E395B3D508B88BC46DA633D3805353C816B8D3D88365C3CD1498D3D5E17143D209A273DA838DE3CF864A0BD1C86FD3CCA405F3DAA778EBD503350BCA84B433C000421BA109C66BDFEBF88BD00BA4CB9535C9DBD57FD9B3D00F3DEBB97A098BD5A595B3DB6597F3D0ADA35BDE05CCDBBF83F6B3C0043C3BAA26971BD80FF6ABC9176A3BD68311B3D6E0D30BD5692393D7E738DBD187E193C90D1B23BE5CF963D06F3F6BC4490C23C28F7683CDEB3693DB4FAF5BCD01178BD0038B9B82490D8BC00803C38BEB1433D8D9D8C3D00D2A8B949A93BBDA779A23D4CDCEC3C7493003D76081E3D36E96C3D4E60A2BCC8EF64BD14CE39BD036713BD69C8923D4118933D92C845BD4EC35FBDF0E997BD01FDA23DB13945BD901896BB8EE46DBDA8ED33BDC007983C43E501BD60F04D3B8096163D2A95733D40EFFB3AAEC97E3D1EF6253D52105DBD05D60DBDC0B7BA3C84C7CCBC9A087EBD60B2AB3BB2D4423D738283BDFDE28F3DDEE9023DD049963C182961BC001689B91C67C4BCCE35633D521488BD1E253C3D92A8103DEC9A0C3D6EFC313DCC5727BD2DDE803DC6FD0B3DF2C40DBD3A5E353D8480E4BC74F98E3C72A7E4BC904CC83CB893423C170922BD1E988ABD403D533C2F474ABD7C7DD8BCC8CA1EBD2635503DF3899DBDAC39A63C4AF6673DDFE88D3D90B4FFBB5093C93B602F47BC2AFF493D966E343D569C513D6410223D1B00A03D6A6C31BD04830B3DF0F28B3B3F4BA2BD8086D83A60AF693B342ACCBCD0DD3ABCBB8E20BD02299B3D4FBB033D2BDA62BDCCCEF93B7910BFBBC54D9B3DCF9C833D80E529BA34E01BBD28A3293DA30984BC3573523BF8DD58BD5BB5793B234598BD25B54ABD44F83ABD808F383DC52AAABC00B085374D02DB3C70BF89BD4D55283DB8D1F93CBF8AC3BC7470943D8BA4BCBC6F7B77BCBC7F913C6FC508BCE8F1233DC86789BD66744F3D18AA88BC0B6189BD16D6613D02289A3D15D0E9BC1299B1BC42BDB7BCEC6E82B99124CABC6649243DFCF69ABDBC7E8E3DF918A7BC20CF893B63591A3D4F738BBC5A30A2BCE438D13C91EF9B3D68E9803BAE983BBD006B343D5DC9B6BC21D769BD671388BC7495813CFFD4B23CDB8011BDB7D2203CF43402BD04A04DBDD912E1BB0DD7973D11EB1F3CF8F48B3DE75229BC19B9AFBB5D280ABD69EB91BD2CF19A3C689AC2BC76BED23C34F897BDEF20813DEF3C033C5E23E13C568F93BD30EE773C4E49663D44ED623DA09E93BD7375823D5B708DBDDF87B43C96D6DFBC8879473DFD5738BC927197BD6BD12C3D2610343D5C12653C52705A3DBA8D40BD7861A4BD880B5BBD5F3CEF3C7D8E1C3D1819DE3CEAE443BDCCDF8BBDBA7CA5BD430B98BD4D5C11BD219B69BD1035073D3DCA983D865F73BCB13093BC0689CA3BF3DBE5BCE6ACC9BB5EF0D6BCF30624BD7EC81B3DC0A62D3D24B1CEBC5924A13D5993993D7A3E393BA89D043C0E87483D82975CBD186258BD78387EBC818A333DF35F983D98A3223D2C8810BD8F7F0E3DC59644BDE7BE5ABB765EBC3C8F447ABD0C8A9C3C4BA1133D6C9089BC371C5D3CB3BAC13CAEC2CBBCCAAF9CBDC3752E3D403D92BD4CBD303D7C3AA8BB9C30EA3C3820503C2D48593DE94C303C6C6F8F3D45BFFA3C6EE2CEBB909D95BD52E6023D56925DBC365B413DEA902A3D53F613BDAA95D2BC7968373C8F97ED3C3F30813B77F7D63CA668FE3CDC1820BD3A3216BD50D3163C4351333D8F32DCBC1598463DC8410ABC2FC9303DE4B3063D6F3446BD4E8B88BD3EDE0E3D1F5488BC76D3893DCCDD7C3CA06769BCFCE81CBD8E3E41BDC6E8113D36D55BBC84A1263D197A8DBD50D9983DFD9AA2BD6A2935BB6D628E3DA6E2A33D3DD38D3D9FD81DBC8B9CEA3CE1550E3DBBBF443D20A403BBC95A1EBDDA2807BDA5723B3CD2C25A3D1ED9293D067B25BD8FD0503D7B77713D58718D3D54A9BD3C9F13323C37098DBD6A31523DB740173D1AF97ABCE7568F3DB983703DA5359F3DACFFA1BDFA877CBD5EC065BC8AFE2DBD8366A43D03178E3DFE78D73CDFEB0CBC819F733DD69C9A3D380B003DC9BD883BA41680BD1895393CE15393BC108C5B3DA098483D0185373D4874D03BE63620BD8C22FDBCF29B4B3B5CBC773D51A742BD8A7CE83CA2DA6DBDBDAB0ABC3A1690BDD2FD7A3D36C98BBDF9C007BDAE3783BDE2B7C03C70774FBC1A9A943DEF4C74BD216D8C3C64DA0D3D7AB57D3DA03E73BD8AC1573CCF451D3DDBBA78BD88F093BD40BF2BB987E6B5BC717893BDB3998EBDF8A2A6BCE40A6F3DA0F098BD6297293DD438573C881E253CD77D423C92B890BDBA08913D441B97B9B2E494BC85BF873C3CC9653D16BF31BDFCBB29BDAE60853DDEEE64BD47F0973D59DC57BDE89C843D7F9688BD6F22823D78308B3D03D94E3DEA58593D14D843BD3F2887BDC782493D0E6CB4BC25408E3D7578163B538F90BDA0E5663DAADA3FBDAC1D73BD1ACF72BDA8D4A53D0AE8B6BC960897BC6AE21EBDDDB1AC3CDDB35F3D8B6398BD1C770C3D9AB0313CD74107BDCA087ABD4EA0AC3CDC756EBDBEC2403D4FAD31BDD4E3A4BD170CA0BD3B589BBD454A9C3D5E5C48BDC5BD9FBD8DCB84BD975F2DBD74C8453D0F9C80BD6E228E3D1DC820BDC2F04D3D372FC1BBD5ED013B07B4523D18269B3D9795D6BC6B0C303D234115BA5B1F013DEEBC273D28DE7F3D999B31BC50B5673D009B1CBD4CD868BCFF08843D91EB83BD529B873D521190BBFE6158BD0848D3BA044794BC746D2B3DE431EE3C1776483D8B03A23D1EBF8B3C0E588BBD6A9A36BD46A10B3B2671BFBC8336DE3CCC58073D614375BC39E1623D8EF80A3D557B9B3D0E18E63B6E23843CAEF8AEBBC142273DFD023F3DD9F3133C75A7893C8751A4BC556E37BB49B32BBD223F433D2E5A783D5E31BD3C7B09923DF204C33C7999293DC30E94BD9DD226BB2F4A083CCBFFCF3CD1E61B3DA0A2833DCCE5403D9A33C1BC5BE79D3D6EBB82BD6E0311BD7A5DFA3C0087833DC1AF883D155E9E3D9F8642BC443D7BBD8C59043DF8D46DBDB431553D2BE539BC22D68FBC34F116BC395CA0BD407994BD656FB2BCCC5B793C86C91BBD3393C0BCEB1B9A3D8D59703C4528A03D2E9529BD6855C4BC8C2445BDD27D173C882A92BD564397BCB9B7873CA7CA8ABDBEAA7B3CC2336ABCE626CC3CEB0046BDE3BD8A3C57C964BD7B803B3C623F883BF64E2ABD2786F63BB7C7923B50141EBCC6968ABD0E93403DF7058F3CB5BEE3BC1FF0623D050587BD50AFE53C6E3544BDA58C9D3D33CA753DC15F333D6BC0AD3CFCEADF3C5EA8243D5A94833CC7D269BD8C096B3D294D0D3D7BF3C2BC04A70CBDDD3A513B19A1413CDFBED33C0522833D4E323B3DE6A73F3C612DA1BDEA9798BD786E8F3DC183833DD99E13BB8C1699BDCB15633C637262BCAC097D3DA35A67BDB793473D153496BD589BF23C90CF563DC90D8EBDF193A13B9AABA03C23518ABD6B973F3C557AE3BC9E85973DEEB09C3C246C443DBFCA613C16DCC4BA1940D0BBC24768BDC537933DF032B73C4360373D761E243DCB3329BA0E8FAB3BAE8BA43DDDDD68BDB5A39E3CA74984BD2948B5BBFA3E5ABD682E063BCD1C82BDA23306BC7F2386BD59BF32BDBD361DBD33C361BD9243A1BDF6B92FBD6220D63CE6D10DBD93EE1CBDDA6D6B3DC56EE4BC7FECD0BC618F7ABD4D8D83BD36A4053B8E90F53B94ED0E3D1E7386BC0F377E3C60AE9A3DB3648A3D1E981C3D967D483CF5551E3DF9D52A3DCED5613D88CF50BC521D0EBD2E8A5E3D8DCC3BBDFC3BE43C81DF64BDDC3202BD087C043D6B243BBD3BE0423DD311ACBDAECDC0BC5B994FBC05D42EBD186D153DBF7C6D3D752F643DB1689FBC569F3A3D456340BC411F423DF86D3FBDB5DB1ABDA00AC7BC7E4F453D45A2F13CF402DCBC5710AF3D8B2ED0BC79201E3D696312BD7BE96FBDEF41A4BDC3E10DBDB6C9633C4E35773D57FB78BDC91C2B3D04B833BD37D6063DDB19EE3C2EFE73BDA486DBBCAD4850BC93DC963DEF2668BA60A847BD9B8A8D3DF0A659BC8A3F80BCDCFCED3C2DF31B3C23FF9C3CE3E6BE3CA9DAB9BC4C490F3D52E493BDF25555BDAA73F63C776882BDA43A563DE5702E3D95715FBD0EB0873D931B293C2C3EC23C791D8BBDCB6BCC3CF363743D25AC1B3DDE4C6DBDF3A9F53C8C8E133D818083BC89E0A4BD188794BD6067513AAED9E6BC1D7FD7BC853688BDCDE8B93CC0AC67BC4910D4BCA17E213C25878F3DA9657DBDD161F8BCDF5A33BD8E317B3D35619DBDB7CE9B3CC71A98BDE60E62BD6533323DCF3F6A3D406A9C3B1255533DDAD712BD4CE573BCC6FEFEBC3870F53C92C588BC794D88BC8C8147BD2F8F2B3DFEAA98BDDEB755BCF9711FBD534A503C67792A3DDE4D8F3D3168623C28E24A3DF9BC45BD5FA98FBD255AC53C3B2328BC6BAD4A3DC385113DDB91B3BCDB3967BC5B6DDBBC8D89673D331117BDA03B80BC5155F0BCFEAB5CBD6C52A63C501C313D05BD0CBD54E041BAFDEC803C1D0F94BD80CE38BD0B7468BC0D744C3C73FB75BD45D684BD0709163D3E4486BDA1379EBD081C8A3D515A9CBDAC20FABC15FD9BBD751CB03D5306E3BC59DBAA3B639D9F3D4FA7ACBCB31F8DBD730DC73BC2C5833D8FBCA23DC3FE043DE14BCF3C146273BDE5AAA7BCBB3B13BC6A5C4E3CC5B5A4BD84D01FBDC5F1EF3AC0AFCA3C5B73803DE8863B3B952B0C3C27902C3C10DB723D05CA4B3DD24A353D0874413D60DB92BDBC63AF3C270448BD5904F4BCAD8E833D237E1EBCA5DBBFBCA38059BD772AC63C942E30BC6552B33A32E995BD7E58DBBC798B8EBC8F6E4A3CE3D406BD1DAEA63BE5AD213D4E02893D7CDFA93B9D83123D7E4CFA3BA0279F3DDC8B1C3D8DFA7DBDBB29823BE6928EBDAA1D61BC47E22CBCB97C78BD9DCF66BCB4CD93BC4810193D76676BBD8BFC3CBD5A4F5E3D4B68B33CD745C2BBE5D9813D26638EBDEFE7503D613EE0BBA0DD9DBD5881AFBCBE6CC93C9CEB26BD906C68BC95A4AEBC445A383DCD691F3DFE39CCBC79C095BB2CE7883DD61B973DB4EA4FBD2A6B15BC57A9D73C370398BCBD3917BDD9B8763B8B0D41BD44204A3D980F1D3DF6B139BC22E1A7BD95A1FBBCA7526ABD21739C3DE6EB82BDBDCDA63CDB6C44BDCE8C80BDF39350BD19DF553C6B6C97BC7E0D8F3D5111683D4ECEFC3B5BAE44BD3C12D3BBA4E91EBC9D7186BD4C5E01BD875A94BDD7EE01BD621280BD3866883DF576C33BC01D0F3D8490333D4FA6523AE961AEBD8A17503CC953FD3CF03851BCF587663D691C993D6B8E3FBCB975A2BD848F60BDCDDA513DCF472F3D75D668BDA93DCF3C83025CBDA34650BD7157C9BC9C1782BC8F1359BBAE6EB4BB37A755BDDF9456BD73A961BD82D8E7BB1C759B3CE343B23CD1019DBDDE34E9BC856D0C3C032859BD530E933DD3F3563C175AAABCB875283D2E1C0C3DBE247D3D45F2253D7E7E0D3D8DA254BDD19B52BD80F8E9BC55A6F43C3A3462BD19D8763B52998D3D7B8196BD6DCBB9BD848598BC40B986BC0052053C8451813C8B7C323D92D8663BD90F813D4302F83C97C424BCE796F63CF321F6BC89E891BDE89B34BD0366533B2D995CBDD89EDD3C8929FC3CBCC0853DD7CC683DDE9082BD8D628B3CC77782BDB92924BACBE42BBD5E1E96BDE5C0F63C8C9A71BCEC548BBD10A6A73CC22D9FBD286E8A3CF82C653D0C7DBBBCA0ED063DD871123D84DDCABC0A9C63BDA5D9573DFAA2933DA29F75BDCC68273C432399BDFB1FFABC8E7C85BCF73096BDCCA5D23CA1A835BD132149BDB1379CBBF85B2D3D562E0F3DB8A8FE3C94B8933DA72AC53D46039C3DDBD80D3D8657F3BCD76477BD11B09EBDD868EDBCD615723DE46F63BDAA3B783C9DA6D63A6B55903DBE9684BD0378BE3CDDFA723DF55240BCA15337BD20A2983D5F798D3D4BA7393D32ACCB3CE881353CC546E93C22569DBD3CD359BD819331BDE6568E3C8C1C17BD7726693C68012A3D17003EBBC12C543D9B4F81BCFF03AE3D26F44CBD546D63BC98AD4E3D50E9703D28B363BDBE3B74BDA251283CA0074C3DD0D270BD0B7D8CBD3925333D9EE1F83C1AFB093D20B8D33C78B08EBD9D9B6EBC36264DBC871087BC6F3D70BD12402B3DF84738BDB195713D65FC683D43199D3D9041803D06C0183DA7E6943C3C221ABD073C2D3DC8550EBD09088A3DEC05503DF1619D3D50FD8FBCE6B1873D48D510BDDB5D1CBB4DDB4E3DB9DC13BDB85BE53C8A8F63BDE08108BC697F4BBD4C6B2BBC06FDCA3D4DB465BD1A1E04BD42599BBD9BEC00BDF5764E3D58B59B3CE739873CFB065D3DE556BF3CE0B481BD3597A8BD1CE6D1BA869320BC5B488C3D5C1B82BD8AC59B3C9AE24E3DBD0031BDD4036D3D37CC77BBCE00B2BC663BBB3C2D55233DE9585E3DC90BD3BB7ABD123DB6117FBD57EA86BDD9CB8E3D056A043DE54441BA86E2943DA6B758BDF714363D25D5563D8B4C24BDD97272BC9470333D565883BD56E05C3D871146BDF09C46BD3176883CAFA9863D077B53BD5F5A8FBD322668BCEB1DBE3CDEAF123D3108B73D09A05D3D737592BDA683463C7FEC59BD97AE543C4265E2BBC8B943BDE9834BBB2EFD2B3DCD2E29BD686EC5BC95CF5DBD851A8DBD4B4896BD804F2B3DDD0599BDD274653CB4147EBC4C619A3C0B5F3F3DB4A18BBDB3F32EBD3B28983D36F08ABD32C049BDE876A93CFA12A1BC61D9A4BC071ABBBB47DD8DBCE1DFECBC0BFB00BDD2844CBDFBAEA4BDF04C313C8B900E3D0A58903D843291BD2397C93DBB9227BD290C873BA47CADBDA5DF3B3CE82862BDF26194BBF54B9B3C431C35BCF95856BD964DA03D8AF8DF3C797A283CB1C9A03C9A6F353DF38365BD59D451BDB17B5FBD4B7679BD963A8F3D5A80B1BC6003823D1088613D9F85E13C6DDC31BD9420C7BC26503FBD110C263D9450503D27D1343CBC369CBD20065BBD08B65C3D35D4BE3CD725233C746BAABDDFCC3EBDBF7451BDBE4F39BDE931BF3946D4B33CF8CA2C3A928C9ABDA6B4163D423987BD92D939BC5E40163DEBB014BC55D788BD040EA1BD53D970BD4C613DBBC5533FBDAAD66A3D865A0C3DA34A673D3BBC423DC4BC46BD6BBEAD3BAF7C63BD06E7623C28606BBD09CA14BD8060DCBC356BF4BCDDF7EE3C6F13383D924794BC6F1E07BDAC862ABCC4B58CBDC7EF963D1BB97E3C918237BDF235593B0C714D3D8DAACCBCC12A95BD9D570ABD9954C73DFE1314BD4355603D331E46BDF42BCC3B4824A33C95F90EBC62A478BD466BC53C6A082DBD152C683DA4E0A5BD07AFBBBD809ED43CD32204BD40B385BD2CDC8CBD691ACC3D0C658BBDDBE2A73CEED0B63C933BAC3D9377A6BCAEE478BDA1D31BBDD3C4623CEC0164BD8A25BE3D54BC273DDAC8073D1E26A6BCCCEB82BDA56EDABDE0CEA13D75092ABDCE379ABC0450F73CA613DB3CB3C3693DF41AD53B785C8DBDE8A8313DEBC2E0BC8F699EBCA38734BCDA9DCABC0B3C1ABD3ECCCEBB1CBCA23B8AB0A33C870140BDB72211BDB331B9BD84BDB5BC27AEE4BC36FD00BD2646C53DA6D4EFBB84E2EE3CD3382EBDE8074BBD5585253CDD88703CA882063D66FA13BD2E21B8BC4E67623D23E39DBDCDF4163DFD084DBABB7E71BD654AB5BC9B6B843C2223A5BC8980B53B88751ABB227EAB3DBAA32C3D75F007BC1B3D0CBDCDC635BD7D1BF03CEB90C7BC7D228EBC23945EBD1942B73A6577173C9600DE3BEFF4823C5E3A2C3D12EE973D937580BDC13603BD4E86DB3B6F729ABDDF00963A1C7961BDC8488EBDB97DA03C2B8D0D3D414F06BD44CB23BB0963523D10E8BBBDC4BE43BD44EEDB3C1AA27D3C88E3533D5190633D974CD9BCD2CEAABCF8EC9F3D277712BD645119BD5CDFF23BC8D822BD1EE2913D648A9CBBC6E399BDD36CF83C9D6B50BDA439653DE5C419BDB57A0CBD2CFC5D3AB230273D69EC9FBD6466E63CF059D5BA230D333D68A6B8BC875B333CD67E243D841F5CBD425086BD105A873DCAC90F3D212792BD51BBB2BC88A660BDB4440BBDE84C2CBDEC6F32BCC5EB633BA85E963D10C5FFBC51A00F3DF481873C2529693DA86BFD3CF02E14BCB07F25BD17096EBDFF219D3D893DF9BC7A15A33D09842CBCCF49133D08F47FBD299A31BD4D472BBD9DE2393B589AB9BA5AA880BD1679B8BD24E8C13C8D610D3CD14E6D3BF8B183BD448B193C76AF8E3DE357183C2742B0BD6E0D15BDF73F2D3DC33C26BCFA1A113BAC088EB9A5AB68BDAFA168BD2F40F33BECB0943C6BAAC4BBDCBFB33DB3EDFF3C2A153D3DDC9E66BD2AAAAB3D344A4FBA30C8C63D06F04CBD96F62A3DE17A863C52AE11BDB509A83CE40B0DBD6EEE98BDC14371BC6FF1BB3D3A54AB3DABA21EBDB27EAE3D3CABC33D6B4415BD1716B03C905AA1BDC4EC713CE5B0C83B9F0737BC448F913DA3FD223A1E8E3EBD1DFE9CBD2AAEBCBC43014C3DFAFB603D5440083D8D0F29BDA752953C4C6911BCA0FD693CF9C1AA3DE5FA89BD0F1A65BD2EBC8A3CAC797DBDE13E87BCA82EA1BD167263BDC01E6A3D4B346B3C328961BC2D7D57BC3E9281BC9C4D353DDCD199BDB1FB41BD8FA0853D11D196BD9F6A0FBDC4A88DBC18AD9ABDC2DEB8BCFDAC1F3CA1B612BDA3148ABD9465BA3C98385ABC1F72443C81C2C63CFB333EBBB819E23CCD7B8BBBB6CDA4BCBCCF653B2A1F673DA653013E66760B3D7651103CDF5B04BD24EE40BDA22382BDC2D43DBD6FA6FC3C9AA9443D57B003BD109F3D3D757E5F3D3B78BEBD307DDD3CCA4AB43C8A5A76BD6451593DA03C363B38473E3B96A6243DE39EC23C0CB4663DC69E0ABD5E5421BD68F414BDA1E6CD3D957CB7BCD40CF73C546A573C990216BD6F4B81BD6AEBA13D9A7E7D3B261D12BD32B657BDB67E9C3D53E0C1BC991C6F3D93AC773C040286BCB6C47FBDF5C6493D9A61C63D9DF4D83C4E36DDBCF54EA53C370D5ABDE9EA09BD059670BD14E5113C536B103D6118943DB9C5903DF5A0B73DA39A0D3C5149C33D6806B23DD2AE0E3D8D3B80BD6F1D20BD427F0FBD626F463DD27213BDFC61083C43A87A3DCE94933D4A5114BD14C306BC78EC87BCF03945BC3E20BC3BCD91D13DC14E1F3D7687863D43E6713DE15447BD15FC4DBD0CBDABBD92EE883D8651073DD43757BDA65949BD34149DBD1E0F0EBD71675DBD15703DBD5B81DBBC5E5E9C3D6CFE3A3DCD8958BD42D82F3D5194EEBC48EDCEBDDEB338BD563ED3BD089AFF3CEB4A283DD05B773CCDAB363D18095EBC548E66BDFB083B3D004F873DAD20F6BBC68E1E371BF3A2BD213C8E3D27F8883D34D8A13DD5DE003D8F9E083C5B1C8FBD0EFDCE3CA610AABD97198A3D7AEC133D133DDF3C80B21CBCBDACBCBDC24A17BD326A953CD3CB9BBC184CCFBC1D43813CF39A0C3DA8BA3DBB52162D3D8722B0BB88FA8E3CD7B800BD38E3DF3D505AA9BCDC3975BD6FE914BD69F5633D1B847ABD0B37903D7374BCBD2AAC4E3DB63529BDC9FB63BC57106B3B2F36E43CAAE414BD54D360BDD3628C3D16C1DB3C048BF93C5C0DB5BD83EC9F3DC17899BCCB19883C7B52563D0EFB95BC1999D0BD2019033D833858BD7B26F03A8D399F3D87BD7B3CD399A83D577248BCFD9006BDF5B00EBDE97F24BDEAD0833C8D6507BD17A6A73A7C76033C5E2B823D8DB41BBBA357B43CDDCF1ABC8668AABB739F93BB4B6B81BD16E321BB540914BDBDEF4ABD71EA973C78BA28BD7E1F31BD4E3B5BBDAF8C5D3C9F31F33AF30A59BD4316153DFCD6ABBC508F81BD80289D3C0FB3BC3D5ECF7DBD5F1D493ACCD7983D3D60043D2068923D0704313C3D8CB7BBAE6A7ABD72601E3D2D74E33B871D2B3D7CF94C3D393116BDD8DACDBC82E6B63CFE3273BD1B2E77BD99621F3D7AC5ACBCEFA6013CD56717BD551203BEB2F7D03C32DB3FBCAD3CC23DC56755BB8B381ABCCEC57EBDE21328BDBB55ABBDE3102CBD7C5EECBD0C7963BDC174DDBC642EA93CD6A30FBDEA592A3D67078D3DCE25373DB14CA1BD1EDFA0BD8E26493DCA7D82BD488F2E3BC9E013BD49F9B53D298EECBC569F503D4815AABC76E7A93BA4819BBCF1EBA93D0CB354BCC25768BC84D3F63C847925BD14E4843CA44F4B3D6F65A2BCE99514BD058312BC7ED46EBD3BFF11BCBC0808BD2281793D4FDEAB3DA4799C3DE4ED573DB8D2AABDACD58DBCAAC1CDBCF56C1ABD0C3151BD2534803DF7453FBD56ECEB3D203F113D12DE8BBDCF6EB4BA472FE9BC0D82363CB5A6B1BC634AA23D5842B23DD3F88FBC941F7C3D3EBCAD3A0884173DF4D7AB3D76F5933D4FA459B8EBFC9CBD15CC5DBBF7725ABC093D213DDA2D47BD96BEAB3B87204ABD206FEDBC7196843D70ABCE3DD6B981BD4739ABBC33533B3D045E98BD388420BC5F04B33DDF3F343D6DA6123D88D4BCBD3D61BE3DBAA4A33C670E14BDAAAC34BDECF2BF3CC50A6A3DB68CD33C82F0263D3BB89BBCE80E28BB33CB223CA85C443D9628D93C58BCCE3C76B5A33C67339D3DB6F40B3D4590A4BC53483DBD8AFA073D0EB254BDAAF568BD99A7313DE31D253D06962A3D4D0B5BBDB6C8DC3DA48EF23D8AE3393D18B258BD9DEDD3BC390893BD4C6D323D7042593DDE3BA6BD3B760DBD076014BC10BB653C1A1D103CE39F16BDDF0843BD04E36B3DA99E723D2444363C9E7935BDDB2660BD52920F3D0D8D1E3D1CD924BD1B1DD5BDBA70B83D270DCEBDC35CEDBD171917BD3016B7BCE7EE683C5E43CD3AC9E2A03C166B4E3D9DAF5ABDE85E653D1480123D198F473D9D2BC9BCE74362BDB2C4C83CC7A07A3D9B954C3DD078D23B4FF9873D1531303D0C7087BD5C38F13CA32D4CBD7315B5BD6491493DE8253A3DDEE45BBC5D38EC3CC45A593D49811ABD69276ABD9572FB3C02C3DB3BFF6499BD0F49593D3FDE46BC04A94A3C2E85DE3BDF9E943C75E38F3D5ACB623C85156A3BCABFAA3DD2200ABD686CD2BCC113EC3C59E7B2BD71033F3CBB6162BD59D1D03D30CD843C87DA99BD7A47173D70B3813D4672703D0A6B993D5B359F3C46ABCB3D9B1AF13C0FE75B3DC3BC38BD5BBECC3C77C27C3D541336BC9711843DB5C903BDB8BD3DBDFCCA47BCAE2AE43CEFA03A3DD51A8EBD21DF813D0BCBE4BC60AE8A3CCF56E23DD5D502BD2AED17BC409E77BCA7C2CDBD901933BD1686C03CA4EB17BD07E198BDD39D203DF52A073DF2AD063DB66585BD9D8FBB3C0642953D88ACC43C479D52BDFFFF83BD1A45523D433B643CEED0E43D5F00623DBFBE9E3DBA8F903D07255EBCBD99213D51643A3D4506033D2F42233C4D1DCF3D69B439BBCE2F0F3D0F486B3DBA87743DD69D9CBC11E4573DFAADC63D02D6D63C0056CB3A0CEBB03D1D1FB33DA57ABB3B5D08983CC5182CBDD8D804BDF73B0B3D1146A9BD0E426B3C0552C7BC0087933C45E9F43BC20C503D2B3CFA3A2926823DBA0064BD1CCFFDBC8CEF42BD8E9D933C7A05FCBBD8858FBD3605B0BD12CD7DBB26D19B3D50F4833B9ED298BCE31388BD75DF923CEDEB933DBCCA723DAE09A53CC5C10C3DA9EA4ABD3AE8813D22273F3CBAC97E3BE9CC63BC8CE898BBD424CABD5F9883BB1C40653D5A4B903D01AE9EBD50DE1C3D36F2B63C6E6A0BBDE447A4BCD0620F3DC3B023BD0B417CBC8D759FBDC0002D3DDD91953A8236693A175FCE3C4C844DBD7F63B0BD3C6C21BDE264013C820D5C3D6B46A93D27BA8FBDB1FA143C060A27BD2EDCABBC8057C23B509D043D199A33BD2CE89B3DA9BE3CBD5545713DEC07A1BCE3821D3DCA43E0BDCD57233D88444C3D9B37803DEC79863C63FC3F3B817737BDC176983D5648C93C1A2E723DE8501EBD5562FABC71B64EBD6AC17EBD316BDA3B2FF40E3C4D0AD83DFA381BBDE6E02BBD4A155FBD7685A1BB36C335BCD100C63C989BDBBB9F5DEC3CF2837F3B13BB063D3FEC1C3D9745BDBD1070C23D4F52FF3D11D8913DFE6ACB3C7D0E6E3DF5980BBCBE17E23BFF46913DEA4A03BBA8A806BDE613A83DC36568BD6DFD9ABC8D29A2BD74F5983BC69B30BC6016A03D5825A63C845DD13D5929CCBCE851AE3CF3F0E8BCEEBCA43DBDB3B63C7E384B3C59681C3D1D2DB9BC7AB0D0BA9275363DA45C99BD0464B13B3B737A3D588B463C8FD1543DFAAC883D0EC7663DE46C06BCBBFB3D3D9F2C8EBC110D89BC1683293D4169D3BD1E5D4D3DAFB0AF3C031D97BCE4E18D3D29460F3DBE17723CC8CE92BC7DCCAB3CD91F1DBDFE62713BD348273D80730D38F285C93BCD252D3DE9C0C63B42619C3C6B4D0C3D483F173DF3C4943CB0F2903D0DBC863C84A68CBDA710C43CD07635BD562C5FBD3C0C9B3D5022ABBA4CC61B3D967D263D746E8E3DFAB014BD3841E3BCF511403DF9EAB9BC84E397BD6883C6BCB6B325BD778831BBF0F783BD75B5043CFEC56E3D5D7E2C3D8FC1FC3CBFD0893C0E0F423C66BA2BBD57D1BBBD32F97BBD9BAC4BBCD48B95BC17CB50BD7D4E8A3CC0C63EBCEB0FCDBB600522BD408114BC2B5414BD70D42CBDC7148B3D0CCE55BD3CDD853DEE32383CDB9B083C64B1843D008F89BC58E2A3BCCE72A83CF8D19ABD80C63CBD07C515BD19A08E3DE279803D400CCD3D5E56E03BE0A4D23C41F088BC1A330D3D12BA02BCDF299BBD60544DBB33CE043C3955343DBA6C5CBCDBB2E63BFADA903DC411603DC36D88BDF79F7A3D622F8C3D4C6A4CBD7CC17E3D7DAC8EBDFAFC0ABD879201BBED91223D2B3E88BC7BA3863D22958BBDECD3223D3F069FBD5892A13CD96ED13DC4C5E03B00345E3CC971B03DC2D7AA3DC54A8B3C1D208ABCD5EB743D8F606FBD1DB970BD9F58903DA89E383D525B73BC7405A23C27D933BD61C7813D307D5FBDEDA1C43C4D4B7C3C30B2E33CACFB013DD56B6E3D6E5A643DC41FD73C16E86EBD3D737B3A7D578ABC26A653BCCE4C7DBD8F4513BDA11F94BBF619863DF78FC6BCCB8D9BBC1C04473DB2AC66BDAA7F7C3CF7C5B93AA8C2C5BA536B203CCB84453DF211A4BD4FBF903DF54191BD9CAA103DA492F43B8E000DBD45B1953B302B72BD557F803D38B1FCBC522F50BBD00E2EBD0603663D98FC27BCB362CBBD9CD37BBBB2421BBAA491323DAF1E0ABD0CCFE83C5E93CB3CF283D73C2DB3BE3DFDBB86BD20501ABD2DCCBCBC1E6D51BDFF88A33D832AD5BB55589BBD2A1B05BD07CD3F3DB32820BDD4E91A3CD8C4413DE6B5B93DB73826BD74F810BB54CAA53D772E393CAD99FDBCC59E19BDB735053D76FD8EBC6FF29D3DF9195DBC978B0F3D3E027B3DFDD487BBCFB7C03DE56E34BDC276C93DCDDD27BD3A9310BD883D793D28DBA93C7F0E8B3DB14022BCEE23343DE742CDBC64349EBD525B40BDC7B404BD8D1BBFBC43230F3D73491C3BDE669FBDA45FA3BD0ADE8B3D7FCAC63C818F5C3D09C795BDC6D78A3DC846E13CFC90D4B8D19D8D3D07D7DE3A45089CBDCE60C23DB9DF0ABD7460653D1934903D95DA8CBD189039BDFDDB393C94F9E93AE8C00D3D6F9A073CCCA9693DF75A913CE91E423D73FE0EBDBB8E9ABB79B8853DAC5E69BBB9700B3C8E5E403C055C883D4C6A483D8E129CBC3BF336BD3740FBBC3CE66A3D5C32DD3C12D5913D3A8C40BDF9FF853D67567DBC6E2980BB5AE0293DFE681BBDF217A2BD55F8803DA7DF46BD921B913C2177B03D6E3D5E3D1FE2943DB284393D2C138DBC2BC45D3DF7A037BDFFA990BDF9FBAB3DB17C5BBD0D28053D9AEC093C209926BDDF8EF5BC00299EBD109B7BBA543058BD709DBDBB2F70B93D036B463D1EA4143B769ED8BCE9E0ADBDB947873D385553BDB8D01E3D269468BC278016BDA2A9A1BD24D47A3D8E9E203D95C997BD6508E0BB35B59B3DC5DD063DDD28E2BC8A2A363DEA01DDBC9651463D3426433D73BD323DB52B9FBBBF899F3DD0B0FABCE1558CBD38B2B8BB7B9A74BC9A406F3D696D313DB144683D99C37F3C64DCB83DFB8A8F3D1B957B3DE9AA6B3DA0F766BD78BEFE3C7EE873BDCC3E2EBC51B2DDBC20D5A23D45B37F3C9923B63D0F4C713CF9BE0C3DC732703DE312153D0B66123DF4EFB5BD43CB343D05E3613DAFEE23BD1C2AFDBC7F3D943DB6A4813DA11BCCBCF1288BBD8E6D73BD4A342B3D50335F3CB3D0C8BC5D5D053B19250E3DFA174EBCB4AD963C8C2C97BD31AC1CBC09EF6E3CC88E883D7A4E953D89F6E33CDF6EFCBC6F5EB63C51700E3DE50E5ABDA92ED53C677C313C4C94FD3B8AFBACBD96DB513DE5A34EBBC3DB8D3C4DCD2DBDB2C00B3D5463BA3C0D85BBBC05FF94BC489E8F3D0096A7BD7C28BB3C9EE357BDFB62A1BC679CBBBCB201673CCF00633CC00FBE3C5B0FA7BCCF95B83DFCAF2DBDFFE8A1BDE37D263D3669A0BC1025CF3CEEEFB93C5505203D39C801BD8E7489BC63E1883C84FD9FBC3B903FBD273B903D51B279BBF4D266BD565AB53C9139573C43C8533D5281A83C4CFD92BDBEA9843D100916BDB2869B3D3FB957BDADA68D3CA0C506BCDE4F213DEA37853D276B6B3D94E1D1BC72CCB2BDFD90923CDFC88EBC256A33BDD70C54BD53A1A53D32AB99BD986B493DE66025BD02997D3D78AB56BDA22EE73CE469B8BC712EBCBB0772E03CEE838D3DA8ED693DE312183D9E1D8A3DE50F2F3CEF90BB3D6490E23C7B47673D5689AD3CB2849A3D41FF3D3D983559BDA295D7BC059B2E3D10A4293D0B08713D50758F3D9F1545BBACAD2EBD5B36BBBCEA58CFBD40ADF93B82149D3DA2A21DBD478EA13C4D9E18BD94B23C3DD0BE843D29CE183D2E6680BCC9EC38BDFCDE5C3D28FC84BDD00E8E3D4C93213D4E575CBD2D1D683C4CE0FA3CA2B0B3BCF73184BCE3F08D3DA2396DBDE19671BCB10B1CBD01D893BC557C94BCE693ED3C1EE0DABC809839BD60F598BD479D2C3DA9C3ADBCABE45A3D0CA044BD21B6953B64C9EC3ACF970CBD24826BBD2970D13C1D39C3BC674A51BC65F9B2BDE5779BBC1AA20A3D6950C9BC12FAFD3C782BFFBC004275BDA009F43B64B092BD95E843BD1F86BFBC791A0B3DCBAC37BDEBAB14BD7B56A1BB01EA5EBC056AC43C91CD74BDCBC8533D37852C3DD26099BD0D15503CDC5C81BDD54B433D17A0D6BCF6AE883D1F1201BC51C9BDBC7AADFEBC447510BD88F8123C856A7A3B88CC293D2E4B443D42D23BBC66F25CBDE3471ABD372C3B3DA5E6373D0E68983DDAB481BD4A73373C121EC5BD7DB311BCE3267C3DA95490BD7291483D010440BD3C7B14BDA9BD00BDA861293DA724813D8117A6BDF2CAB03D8ACB7DBCE4CC6B3DB3A8BC3CDFA15CBD443235BD4CA115BCC2E2F93CD5878D3D36E2593AC68A8D3D1B5409BD07908B3D36128CBCCBFF1EBD59D822BD35F438BC764E82BCD587AEBC13DD883D7BE484BD13B7C7BC021A33BC835C04BD78E5AFBDE9CB123D7B3C92BDEC33243DD54B38BD8A3F40BD2E7666BDFB9B213D5625003D1AAF6EBD74C4F1BCD12A89BD653E3E3BA2817D3D7077B43DAC23D7BC743202BD4A75083DDEA44A3D2C8CAC3D6834373D38E2F03C502E0ABDCF3B97BD9D18353D69374E3D82F7DE3CCF0FA13D8BFD98BDFC0681BD4205F03CEDE621BC39A40D3D8363A3BD78B194BD3BC64E3B037F9B3DCA2697BC9B9768BCAACBCABC113015BC0E870FBD8AE67FBD872B563D16184EBD6A35563C3E2C323D0055DFBCE4D4B8BCFF545DBC9AC190BCD3F41CBBF03287BD821A87BDD41D7D3DE7915E3D733E3FBD462B93BD34A3EC3B6543863CD3789BBDD09A393C1F9097BD6EE0CB3C1606CEBCAA3C923DE243A03D21D048BDC28242BD09F3753CCB2E8BBDF44B513D297C2D3D0EDA80BD7B112ABDE1704F3C88AA79BD9711DA3CCB968EBB6E95C43CAB9001BD5279A2BDBF6A5D3DEEFB8E3DF3BA7FBDE1F9413C602E9DBD4F93F9BC949FF2BCF7A2003D64D37B3D6BA75B3D601D43BDD167783BDE7C86BDFBFC483D3A7B86BD66D245BDDFD9363D33A7943CFF1A8ABDDFDD99BCF9DCED3C82C3ED3B1CBE7D3CE8C8B8BC8AB3783CCBEC8CBC75851ABC494CEBBC44D295BDC587A63D4C75033DB5E9C0BCFBDC93BD8112A0BD0E91E2BC6AD39ABD5A3DBC3D6B29383D1948C8BBEC7A463D3264643CF98D86BCF802B23C5ADAB83D3C31793D58BE803DDFEF31BCA57F083D12CA8B3D9B8C473DD13A5A3D193F853D7B4A2FBDA668653B0B67CF3BC2B509BBDCDEC63C1BB43FBB05FAFDBB9B2491BD11703A3DB599C83B6F4B993D1129C53D86D437BD2B4EA83D991D243D4B849BBD0513793DC80C74BCBDF4BABC1047E33CDB05683D11C62CBDC25702BD95A65F3D19208FBDBC1D6D3D6CCF7CBDF8ADC6BDDE18EFBC1CE70E3D00605DBD6BCC24BD9E52A93D808F25BCDB75EABB1352BC391CA983BBEADEA1BD6E2718BD46B6FABC2C638D3D8D9E9DBD64B4BF3CA7B76BBDCF08EF3CD17D8DBD6E55D13C49643F3D5B7EA43C360E75BDD1723C3DC250663CCBCE853D463DBCBC4818F23C06A88B3D6D0A303D3F4B1F3BCF57413C2C1926BD19B14E391688853CF988FBBC757A8CBC2CF79EBDD9E1023D83A06FBD1530633DD6F5893D7653683DCAAC813DE46DB53C67F21BBDB2CBFD3C144A70BD1ECEA5BDD4831DBDE352813C9D59733DA5E115BD75618A3D22E89D3C2D81D1BC37FE86BD88A5B6BCC5237E3CF7F0873D8B055E3DEC7395BDD7BA05BDB209523D6D7DC3BC62631B3DF89EA3BC196187BD05F8313D5779DE3C0E6840BD439F5BBD9B9303BCA6D7353D38DCF7BBE55627BD0D7DC9BC6FF787BCEC071ABCB594AA3DF56E813CC2FF95BDF541CFBCC053AD3B024E8FBDF0FF07BD029C683C1DE0633D89723C3D5F7182BC0709DBBC1975AE3CCC22B63BD0E0A7BC8645C4BCE268A8BD029D873D7005B8BD50276EBD58D19EBD361E633DA360A73D1BB92A3D4601C03C01BBDF3C10A3B7BD737D183D21D7E1BC4C09133D1C60623DA76472BD1A2D57BC35C53A3C1EFFF6BA812EB63CB2A90BBD9C0C8CBD3E7EA4BD194782BD90E9113DCB1F6E3C738FA23C558A87BDCC9B64BDA30532BD00D07A3D53328F3D07D5BEBDD6F98ABDF1EA243D3AFBBABCFA02093D7AB58ABDBF4587BDF75FC5BC8D5D97BD1336BABDAB3567387D1EA2BD705883BD6DB13FBDFBD854BD213E373D44F546BD483C7E3D18377BBCFA60813B768306BD51CE2B3C63C00D3C3F41993D1C6C16BDB2C490BDA5A349BD8D1E093B0D0E853D71ADC4BCD70EA4BB6FE4593A31A2843D3469D3BC9F09713C3640D3BB02D464BC25F05A3D809A99BC989E37396D6E5ABD7EB83F3D363A9F3D9540FBBC253091BD0A828C3D3E805B3CC160C63D1BC6193B5A4653BD02F8483DEF5FB53DAD215DBCF52C8EBC6EFF063D7A0C83BD36A0FEBC68067C3C1EC8A83DC4916C3DB8CE85BD346677BCA2999E3D1E273C3B3E437FBD88008EBC2628643D6826CA3B734F8BBD36CC123D9259D4BBA153D3BBDF622ABD0DB50E3CBF7806BA0DF1623D9975803DA410BABDBF1F883DBC865DBD12B6A23D744489BC50B6DF3CF10CACBD70B74EBDFDCC83BC6B3D78BB1589893DEB2F8FBC8F3C8C3C7C533CBDD2EAAA3B0CAD2CBCFEE51B3DA5A16DBCBD1A21BD3829233D8E765D3D0A867A3DA320E6BAE997E5BC54427DBD22BEA93DA10235BD45D86B3DAB0308BD4939843CEFF2053D4D2F33BD8B1A453D1D4C033DF1C12EBD74A4013DC3854DBDEF0E7FBCD50EA43DDDA9F43C33C3133D707294BD5FCDE6BB2759D23C0A78A5BC0A184FBD7B057CBDC1978C3C1B27603D1CB3A93B03DDA73DC9C053BDAF11663D04795A3B74A096BD380904BDA6B197BDB39F9D3B02F194BD11188C3DE5ABB1BDFC87953D0A2FE13C0203753C9AC24D3D1BC65D3DB85345BD8110393D50219DBDFBB83B3D98D49ABC5DFD893CFAA8A4BD35B6973D1898443D6F5C663DFF5A6C3D7C931BBD024F3FBCFF618A3D4167073C0A57873D9B10B63CA75AFF3CED16B73BB66A25BD5BE187BCB73861BDC4D1043DFC284C3DD5941C3D768D423D89D697BD453382BCDDE736BDA848013B16F474BCA1253FBDF5256C3DF77C29BD4E897CBD67AE18BD8F7F96BD355D65BDB5D163BB4F421FBD0BBD72BD645E94BD640D483DB3D480BD00AC2E3D6B5C4D3C57E241BDB4609ABD3E2B1A3D9369513CC6EF4A3CE4560C3D5150053DD878613DE3AB103DB91F323C2CC066BD72A0013DEA629FBD58E3DDBCA911653DAB99143D95B0103BE9B25ABD6F2B99BC0CF626BC2CE9A3BD0FBBDE3C871F9ABC3ACB923DFA3BFF3BC1BA92BD7F9E2C3D384C963D94AE933D951874BCCA88A6BDB0033BBDDE8CA33C4B75833D5C899FBCBBF9643D6054F73C6122C9BC5CCB3E3CAE78BBBC0DA793BD2978733D1A887EBD49AB693CD01401BC7D5B543DDA83533C74D4633DD9B852BDB781A13D996CF33BCE8B6ABDB614EE3CD1F825BC42716ABD42E1333D089B9BBDC6D3603DD34B323DEA9F3BBB68D72F3DDE34883B8A228C3DD93C90BDCFD4883BD6B3EC3C04688D3C23988ABD5B464ABD4AC9093D4972AB3C83BD7F3DAC66703CDFBC173DE76D413D03E72A3AF3F1003D1CE911BD86FFD43C9650C0BC72355EBD2E620F3D17377ABD03061CBD4007483DA951083DBC03003D9271163DAEEB0DBDB21E623D7E40A63D6402AEBCC18B9E3DF7EB5EBCFC3ECF3C2C9503BDC7816D3DC765213D0A90A33CD24F4F3D4EAA8E3DF2D8793DEDFD70BD53C64BBD1C46773DF677C2BCDB31A7BD8B8E653AA07C663C5DA8613DEBFF33BD61E75D3D5B924B3CD86C9FBDF5381B3DDAD1243C9FFC52BD55C7A3BDE3F0193C02D693BC73BA363DC9F2413B5596A33D0E88BEBA6B54FABBBB71DF3CAF4098BDF1878FBDBFB0593D416E723C980BCDBB3D1A4A3D252635BDBA626CBB1DF5863D496955BDEECF92BD41F2A33D472278BD17CFA33C85ED70BDD9CA3B3DC0A24FBDA5A575BDBC8A5ABDFBB5133D3220D1BC932AF43BCBBE89BD7BA38ABD545A5C3D77A2A03DCAAC113DBCB539BC2D20783D615D84BB6494DF3BFBD3A13D4462153DAD07D73C788B3ABD2FA0563C87D59BBD96335DBDAD198DBD564E72BC09F25CBD928DC6BB523CE73CDE1A853D3A5D03BC6CA78ABD658C98BD33DE8BBD0112B83C1416F4BC38A91ABD69A7C93C9C6D803A842A23BDBBD5983DB0E805BDF8817F3B5BBB8B3C5F7B8EBD1ACA6C3C72C2BEBC1665833DE2C1243D82A341BC84BD11BD0941E63C28D89E3D0A7C51BD9E5490BD208953BDD7B178BD57A8A53DB6FCB83A52068CBD4725693D604A933D0D8E3EBC01918CBCF7F1A2BD32D95CBD6EDC9BBCFB8AA3BB1A6291BC3838F9BCDE84ACBC77B06EBDB19570BDCD18213DA6A13C3D28338C3D5FF372BC6C73E3BB54E37B3DF6C7AEBC0630B5BCB2727B3D2A1D44BD25AA6F3C635067BC92C098BD8F9840BDEDFD73BC39BB07BDADD09C3D3769FD3CC3378BBA5993E6BBCC38BFBBFBF99F3DFF17593D13E9053DBF8E153C8658DBBB0E7B0F3D10CC5F3D5F3995BD3BBB0EBD6EFE5DBDB5434D3C5329A2BDDC2C3E3D236B57BD66C39CBDAF4E803D223E1DBC604F393D19B0573B8016923C37B051BD8E076A3DA2019BBDAA1E67BD7D39A6BD00AAF13AA860923D6D1E02BD4DDD5B3D29B7423D6674203DC93D073C09E93C3DFC786F3B4C69A43D7D3823BDA5EA9A3DC6B4A5BDDEC0FD3CD52396BD201F953C3EFA9B3DFF3F903D2D4C1EBD06FB953B6C818D3D5A45693D1D4D413D77DE813DBC645F3B81AF993B57BD5ABCB5ABC1BC53AECEBC5B0A8EBDEF2D86BC0422EEBCDC1B89BDB6F1A1BDD6B12C3CFA1F5E3D1E9FF53CA354883DC377903D87C1453D4E02063D15F29D3DDF44993AC85437BD332D473CBE75183D61F6F73C755C26BCCD8332BD044CFBBC93D725BDD0B9293DF19E773D9CDA8ABDBE46A0BBAF69593D0921403D8BCB2F3A3F69FBBC54A4743D39852F3D9B1494BDE46FA4BDF312013D2936823D06251CBD1BC9463C8989503DFF9EE3BCD8D87DBD29497FBD799225BD02DD993D451B2B3DD273923D3B3E18BD2EB258BDA0CE3A3D0DDC893DF39B6D3D6C0E7BBD6E52953D58505BBCDAE40DBD2339733DA6FE0C3C9861303C0A3E20BDAB6286BC88F75ABC307606BD1DAB443C066C26BC958F92BDC40149BB1A755B3DBA9F91BC9A4E22BDD1D4903D60EA97BA7275A5BD9188A5BD727004BD6B48883D3BFB833DA0D352BC76D26EBD3B8A00BD946A7B3D11987EBD506EC03CC783A13D06EE2BBCBFB76C3D5776593DE1289CBC1C93AC3BF0E2F6BB0C3B6BBDC5F48D3DA5ADCE3C9A487ABDF00F203D57A4913D1AE07CBD472C18BD2303653DFDD8333D2B7813BD4B67A13D6A4E04BDC8CFA1BDCE87943DA8510D3C5F24103C344C03BC1F69893DC610113DCCFA6EBD9C7B91BD3E4817BD89C7903C9043463DC07AA4BD13AB5FBC25DD80BD32128B3D9025A2BD7A3B8D3D764D4D3DC43895BDB0EC83BCED6AA03DE73F0C3DE58637BD13128EBD12EF4B3D0ECAE6BC953B9E3C7C3E7A3D8C0E193B261F3A3DABE28EBD609AE5BC18E9F03C8F7892BDBE09373D0AF375BD00FEC63A80EF923C47FE0EBD480D11BC8C278B3C74B8B7BC20D589BDF40896BD31EF87BDAAFE56BD71EB04BDA1C8A1BD43DEA13D68664CBD1B0062BD8702A5BD30E0E0BB8E2E693DB1D4993D789CE63CA459C73C67D1823D007D2ABB8078693B2CB600BD630114BD60F7C83BFC8DB23CA14539BD5F4707BD90FD31BCB0D1253C1EAD023D429843BD86708CBD150A0CBDC050833AA0B63F3CDA55473DB45CA5BD8022B4BBC8D1253C42D80F3D7773973D96315A3D698C803DA28083BDFD0408BDDEB899BD0A13433D90218F3C004F7A3C86ECC2BC15BA0EBDAA4672BDF0A63CBD500BAFBC80BC353BE05885BBBCF180BD4668013D8689773D47B973BD62A1D2BCEE853F3D24B8D23C10AE223CDE5A253DB505913D9890323D647D0ABDEF0DA3BD1CA48CBCE82A0BBCCBC4843DEB7C9E3D8C5FFABC4CF9093D3925903D580615BC0080593CDCD5E93C601F62BB6F35933D6D6B883D2049983CE1318E3DC8AAD33CB1868B3D97A3933D8AD15FBD92B68FBDE4689EBD3CFAE03C18489FBC07998F3D2405C63C9B4A833D1FBC8A3D76F054BD5A82783D3871003C6FACA5BD999477BDB17779BD26043D3D4A5FDFBC8BCF93BDC565873DD636023D580ECC3C31109A3DACC99FBD129C4EBD68FFB83CDDBFA03DE02CC1BCC0ED66BB00B646BD496185BDC010CB3C0475E3BC7D224BBDCDF99ABD48EF483C6FCB963DA8DB20BC9BD201BDBE09E3BC3877B53C7E2980BDC86FA63CDCDEE3BC20B98EBCA42EA43CB074023D9E595C3D080444BD9D7B8A3DF6C58ABD7AF7113DF60E5E3D437613BD901C3B3CBA264E3DC080ACBB1973A3BD6F3B9C3D7A762E3D24EDC73CB05E1F3D867D80BDE7EE833D875544BD20740E3DC6B6F2BC261C33BDA38315BD70770DBCFB014EBDF046D33C43489ABD1F489E3DAEF0013D2EE5703D062A183D31F7943D9A9F4FBD924D6D3D00F658BA124A20BD806DF7BCB2787D3D8A7DDDBC51AA3EBDCE1C223D102BB53CC08ACDBAF862CD3CAFFD26BD90974BBCB06631BC3E8B583D128BB7BC628DD8BCD6F54E3DF8DB583C4385A03D74A947BDF28384BDB8FA793C1DB98A3D7D6876BDA4ED2D3D4068103DA6A7153D0813553C3E286ABDE280C8BCB10C12BD827D663DCBE647BD974C21BD40FF4EBD4AD60A3D007CE6390067A13A80AC2D3C7AEA2D3D573B993DE8EB6D3C420B9ABCE168953D1E025F3DF877633CF626703D8DB6A3BDA0D66DBD10C397BB2F43883DF49CEC3C892FA23DCF619C3DA086B4BBA8D7A23C0001AE3990D946BCFF33833D080904BCA244313D64B4A3BDD25635BD44A6EA3CA05645BB2AFFF8BC168E603DD4CBAC3C9CE4D3BC505DE4BC994790BD088117BD1F386EBD52FD7CBD36FCF2BCF72A3DBD64B9E03CD03397BB1CBF47BDF82A843CD64A83BD2009A13CCE8444BD12725C3D2EA96D3D5E19D93CBD2D623B691E803DAF07873DDC0993BDA71491BC4C797A3C909E16BDF5D5803D0426223D66493D3D1218613DE69B5CBDECEA1C3CE49C43BDD438D7BC55C2A03D559FE43B36B4A0BD220D863D3A42193D537E54BD524E493A755F363CBC5C293D0568903C58C41E3C6ED2973CB7DF73BDFE95323D37D67DBD9458993DA1233B3CD1A5A1BD12E847BB21FE65BB4C61A63CC4128E3D10A28C3D5668923D0604FA3BE2B278BCDB8C883D5DB7923DA88214BD6A3ACABC6FA3123D7CE4BEBB9FE8E1BBF54E4E3D3FE88CBD02EBF53BC683DFBB6B428F3B4CEA09BD288330BB7C669EBD08917B3CDA152FBD999E8EBDE0B9F83BBAB00A3D94F11CBB35988A3C6DB090BCC48A903DBC55503C5AE0853D1F8CBEBC9DF7643DC36D043D0A7370BC411C9C3D284895BD42489A3D261B963DA6965C3C92C50E3DA1D85EBD41B80BBC3379233D09BB323D759FDA3CAF8074BD8BBA50BDF83980BD07CA3F3C0A0DA1BDEE8808BA3EC546BB7CD9C33CFCBC8A3B295B083DB702A2BC836742BD3E4C58BBFAEEDA3C824087BD8A5E61BD6AC2CD3BDF3A283CD826F33C91B1763D154BB63C2D504E3DA3B3A1BD7311203D4B6823BD262904BD126A133D20C3C4BC3C27863D3E9B71BDCD0D993DA390B8BCF084A3B9A91E673D8E6CC6BC3CCCAD3CB9D7323DB66A55BDA8349D3C33A54EBD7E8B9EBB6A4BBDBC5BFA2C3D8529763D7A28953D7B37693D124E523D3E6A08BC94EFE23B81353F3C2BCC963D4AA6C33A931989BD153419BB6F823B3D52218CBD20AA96BD375077BDDB9DF43CBB2431BDD44383BDE459983DA5571FBCC4E16BBDF89A003D5804AABCE2929E3D32F363BD9B87923C9F1036BD0EB6ACBC75271D3D4D64833D4EEC793D5529983D180924BD5597773DB13C613DDA5943BDFE6909BCE9EB94BDD73B5B3D1D2F053D6DFEF0BCA0EB4B3CC8014A3CAB35E2BB258F823D151D063D625FAC3CB7F3A03D46ED8D3D965B133D751E9B3D6D0F2B3D99E697BB0C57A0BD555E01BCD3A29B3DE7FA12BD1CE4123DC8F472BCF4D30ABDCB5A7FBD9783343D2784A53D0D59633C61FB183D9A8B8A3C72E62CBD61E9903D113A05BCA43608BD54A2313D169C2BBCDBCB12BCCDC5C3BC158B3DBD13635DBB106578BDE459893D7CA7123D6C4C503D0BE5913D0B1924BDE8AFE5BC2B2194BD10E22B3DF786543D83DD97BD09905FBD5BA3923D7E27733D29715B3D10699FBD83309A3DC1A3913DD809373CF3B5D1BB081A9EBDFD3B95BDD63C8B3DBC235D3D3A5A8ABC148D893CAA0630BCBCBFA6BBA0643B3C61FE5EBD768F913D9B387539EBC7FC3C444EF4BBADF54ABCCD2481BD3FC23A3D393D6FBD58A9633D25260A3DC3769F3D178501BD066CACBCC2E1053D4B026A3DBA4A193D2F91BC3CC2DE92BD61002A3D122CA4BAC392E33C6E6A6FBD8731653CAB3DED3CC3FE0DBDCF71ED3B5C858ABDA560533D583A6ABD1E04823A74C6DB3C7DBD71BD3161883D92A2C33CC8058FBD9BAA9BBC3A4C2F3D3558B0BCCCEC2A3DF13509BCC41257BD0E0210BD19378DBDC4C644BD34818FBD48228ABD2E8B7D3DDFBD413C967F85BD3D1B273D2AB2623D784AB03C65E94ABD92F69ABD1A05CBBC04FA5EBD4C97693DE7606D3CC73C88BDE84A63BCDD15FB3C4CC29CBDBD08613DEB65903C8D78933DE5DF82BD390F00BC33BE733DD988763DB5E5863A3216C8BC375F833BC10D873D7A52893D819C08BC9C0756BD887598BD82FB60BD80B2193DD61067BD8437ED3C7DE7F93C50950BBD1EBA97BDDF3C15BDFBE1393D46B38FBD8CFAFEBC2D4A5ABCB9A094BDD6663C3DD530873D479B9BBD9A963DBCDAFD73BD8164A83C2B35063C92A60DBC7BA790BDA3EB953CB750F73C69BD38BD0A0E94BD9EED603D0906DBBAF1F8E53B33C3C9BC6D03873D58FF0CBD0C6E16BD59DD8B3D25219CBC1BC2313DE94C8A3DDCBE78BD830952BC08F0AEBCA7EF18BD4CC690BC0A20893C58D8133DDF8A4BBDDCAC6C3DB8F6613D36BD21BD6923583DCBC3873D3677A2BB79A78C3D528368BC2BB7323D3539EFBC3B6F27BDA8EA403D468DD4BCD9C45E3DE75FEE3912A2733DA777A23C2A5EFDBCCC1D9A3B37756A3D90DCF7BC2D695DBDE7DA013D63B60CBD2B49D43CAB4B8C3DD8FC213D4B5E873D4D378EBD0F6F803D9650D3BCD51BC2BC524EB53DBE003FBC94084DBD34EA85BDABC673BDB0B4EFBC282BAF3D3868933D00CAB5B91F209ABD86FEACBDFDFBEC3C2F21833DCA96CBBCDFAF903CD8EE4CBD844E603DEBC66B3DC1F059BAC6D386BC999479BB444766BDAC7A12BCD81907BD26509EBD3F70363BC8F43EBC09F7923DB1AE73BD586AF8BC28F00C3D9D7138BDAECBB0BC0F17AF3D1125053DC9F33F3D627B883D7A876BBDB33069BD4ADD503D6D1538BD188B50BDD13349BDC6F58E3D887696BC26D0673DAD786E3D722E8CBDB4E0F63C42449DBC30D0853D070B35BD4D0958BD437A91BDABFF633D94E0F63C3BAA183D377F443D4B45953CA138783D3C5BC03AAEC3FD3C6DF9F7BC50FE20BD9750953CD69F83BDE7F3293CC000D3BC1375463D1F966A3A23FDA8BD4ACC8BBDED6B9CBDE37AE43CE9C46BBD2BAFD23C36C7A9BC6E9BC3BC15C8683D8B29553DA7899BBDCD9EB3BC5CFD84BDAE19A6BD1D9F053D8766D1BC6670A23D47694DBDEBAABCBBDE6D153C702C203C94AE9CBD7258B3B90E0EA43C40D0A2BD6B08B03C1B50B23CD069763D1AA08DBDBFC05ABBBB566D3DC47CFDBCE90679BD38664E3DCD2C96BD5F90B23D7693973DDC6B46BD7EEA68BD76E770BDB37CAB3C802553BB07CD833D5C002ABD33C87FBC51DC97BAB9BB813DD72C603C6B1FBF3B7554133DF6F30C3DCE34293DB6A53A3D068143BD0DCB89BD429BD03BE6609C3D5594BCBC7C9EC63BCDC3AF384642F6BCA944393D43AC073D5DD365BD470313BD8E4A9A3B4ED0593D13A594BDF4738FBBB2C5913D6D9F833DB3D0A4BD7468803A0944A33DFA3021BC1227C1BCF1B21B3DB110813D065037BCAE2656BD1DB014BDB8E43F3DB1431A3DB72E783C2E81123D081F833CBD1169BDCBE9A93C3687E1BB1E67773D6F9763BD4D1C913D29A777BD020C1EBD35369F3DE4EC563DC0AE963D789B8BBDD1248DBD92E20B3D0707403D7CBB2D3C3CE851BDB5A091BC24AF273DA5F227BD25FA0B3DE76CB83B644B8F3CD4F905BD317B5CBC6FB5DFBB5605C0BD9D607D3DA78620BCC21C88BDE2E8D83C3072873DD54C833DBD72143D9313523DEB22A13D942168BD316ABD3C183A09BD688F533D9ABB143DF21B673D4C1C8F3D3352113C0160D03C4FD17DBD3EF786BD8DE22B3CB1B8ACBDC4A7483DEAF2D3BC85E20A3DEB89883D3E598D3DBC032B3CA5BF503DB4D39CBC396E76BD076897BD945B883D7DFBC4BCD393C1BCED4504BD1C1903BDFEBA6EBCFCD172BD1C4E993D5ABC94BD0783C83CC77B21BC7F07993DCF464E3CA750123D71013BBDC145AD3CB5E29F3DD4055BBC3384B23D93F99C3D51C187BDAE1A2A3D92E16F3DC51D58BB7829D7BBCF25053DED00593D323E3F3DD528CA3D8A00CBBCCC14FABC117D68BDA4111ABD83F64CBD417278BD6524B63D9F7558BD8C2576BDE6C2493DE482D5BB31FBA23D2A93953CC44D8E3DF0CC103B9F0592BDA3E5B3BCBAEB233D618049BD8D13FDBCACBD1CBD07E70B3CCE1DE73C6A92813D4B399BBDCFDDC83BF21CEEBC8EE962BD8E464A3DDF1496BDDAE36F3D375AA5BD6EB07C3D332B48BD2F7EC5BC1CE6AD3C938C463D185FA7BD232256BD38E98ABD1371773DB357383D39EB8B3B89A592BB0070C33C81D8AB3DD1F59B3DC280F93C20A674BC42DD873CCA3B12BD280FE83C038BE0BCB07C533DC9B857BC6A63993D6FAFA3BC7F4A62BD76F0013D4A83AF3D6C7E333D5230973D8F6D49BDBD1A303BE4665FBD2CD1D83CCABA8ABC0F9188BD002E4FBD41E99BBD5F6228BD9E69BDBDE30A993C98AB93BC21B8923CB3CD8E3DB1D412BDDAD6A33D378C123DD975063C6E61EC3CDB39E1BB157934BD067606BDAEE97ABC06A74BBD22604B3D9D1B57BCD3663A3D3826F6BCC752283DC543A43C0D0A493CCE8B5E3DD33F643D50B519BD25D2BABB91E5073DF55E803DD363453DF64390BD8DAAE33CD57C763D14B755BDFB44E93B504381BD68D65F3C398D203DAC54083DE9848D3CDDA897BC2C4FADBD534460BDF595C3BD5C3A08BD0AF52DBD650BDF3CEE66013D4C4A173CC8C003BDCC3F853C338A3DBDE629993D45A6BFBCB6E43BBD0DB699BD673A51BD7ABC3ABC2DC69ABDCB30933D2F795C3DBD3ECABCF9C77C3DABE71A3CF02166BC26DA5D3DEEA0CB3C786DA93CDA01D53C0BD0E23CA8A131BDBE3AD6BC22C0403D20CF4D3C872DE1BCB02F813DF85AE03CADBC6EBD52EC3E3D677488BDD75C983DBB34263DB2121ABDFA7C04BD5108A93C955C8B3DB145B5BDD2229D3D3554433D0142283CE39F0D3CDDDF16BDDE86A33DAF92B7BC51F167BDEEE174BDFEAD503C27DF6A3DF3488DBDC6B6603C2D35CB3BEF32DA3C35D167BD7D00D33CABBBFE3C2F469D3DF41DAB3DBEFC23BB597FC2BB16C392BD4A45213C0193683D90ACA8BDB396B83C5FFEE538BE112BBDA39E293D4CBCFC3B47FA083DB143613C4929853A4C953C3DF2F394BDC37E053DFD8A633C2AFDD3BCCBC712BB1260553C4F93BB3CE2BC453D4E96613D75E432BDF88907BD384E4B3D945DBABDFE70A13DE0C30EBA4332D23BA66BF4BCEAB195BDD121BB3BFF3AAE3C9AD6103DEB56B4BDC0D19F3B96F0773DF71A8ABDC5BB7A3D177B023B5EA65B3DBB347DBD6DFA08BD253E20BDD53B12BD40AFACBD640CCC3C9BB3173A99F40BBD9CCE62BD29CE27BDE3F27E3DB04431BC62C44ABDA3A669BC1A57BEBDC5E71A3D792C09BD0FB486BD5FAB913D1B8FC6BD569EBABC01C2833CEA739BBD904775BD10BA753D7DEA2C3C59F271BD9A9CD7BCB56415BD848A68BD94F51E3D625AE5BC951C4F3DA032C53B0FE7BDBCEAB4D33D70C3F9BCD508863D8A121CBDF650453D09F781BC8F280A3C1730B539EEE2203C2DD58B3D1545143D5AF8B73DD05F403D1FE7B83CE0261F3DFD2FA13DCFD9FDBC663F813D0B156B3D836414BD901EDABB3C3C08BD06A1FABC7203283DE9675ABD48A8A33D12E694BD6BF249BBFC7B943C21C005BD2757A3BDF84EE43DC492153CF6E6843B4FE8BEBC1B668A3DF43B4A3DB26DBC3CAA1DC7BC03A227BB60C09EBDAE80253D49A3CDBC1C88C1BBD92402BD9CB091BD5BD7E63A9CD9B2BC9D6F91BBE954843B590591BD5A034BBC37AC94BCC699AE3B86B4653D22F88B3DAD227F3D59A79C3D84700B3DF43A8FBA93D2A33D97BAA03DA0A8943CE7F751BD5B1F0C3DD0BB993D1CC761BDB49107BD1F75A03BDE4EA93BB8EC3EBCF6802BBD7042833CC707433C58C9E7BC9AD193BD86B461BD723744BDB0D14BBD4F8433BD93FD3CBC58A4B4BCA17607BD1CE5F53AED5747BCB0693BBD841E71BA408BABBC666670BDD49BC3BC2349CC3BF806823DB72F48BC1CE7823DA7A358BB60BB4BBD0B8C83BC13BA4BBD9696913D3E1B91BD924809BD4FCC433D16C8843D94083A3BE7F191BB15379F3C17068DBDCA29553D2BB9BE3C954D46BD6D48BEBCF8C25ABDA646633D865D00BD11E9E7BB1A84EFBD7EB83F3D4B4D4B3DAB7A083E4A07CD3C2A6D813D7B3B38BC0C629FBDD96541BDC6523BBD0B421BBDD35C113D5D7B143DE1FCE03D839287BDD655833B9794CDBCE35B713DDA3863BDB893BC3D9B39D33D1A2D123DB4E0413BFDC0533C1AF66B3D58E54A3D5AC2643D44A97F3906C1DB3D6B2D60BD50711C3C914F01BDF68F043C2B69C8BC105163BD893434BC4EAF9FBBDFCB82BD6221FCBC87A090BDEA029F3D54F0F63C52E8953DB99C8BBD9A00533D6A2A6A3D9F92B53C373F84BD2287D33DC0A0EB3CFA223A3DB63F423D3412543D8C7F9CBDD4631BBCE8D806BDED755F3D05244DBDF3C5213DA1D4C13D068C2A390410D53CF39DB83D9F99CB3C7930C83D0C81663DD33DEF3C83C841BD091DDDBC2C19883D4C8FAC3DD498C9BCD38E703D0C69533DFF78AFBCC43E983D4E19243B07FE7F3D977039BD2B917EBDDAD43BBDCD8D74BD9367553D5DADA5BD2258A03D3A3A3DBD92A634BDA8B0AF3C406127BDDBAEF13C4593E0BC6AF53BBB992F25BD5EFFA43CF29DF5BC2A55EABDFDA8AA3CE8E2E23C2E061DBD4505A0BD2709C1BD7D1C38BDA775B9BD0784BDBB355439BDE864A1BC7ADED0BA37DADCBD3EAD03BC75EF56BD716790BDFAF7F8BBC79E22BDC262EF3BD99928BD3DC69FBC179782BD39950B3DF4683C3BDB6EA33CA61C40BD22438D3DBB15363C311FB6BD9BF43DBC3856923C64EE68BDAB08083C53F31ABD3135AABB97FF5BBD89FF823DA58F47BB7458933DA0854ABC7335C43CDE1E33BCAE5908BBD896843D8C1F983D1BB3E8BC1F088BBA405CBCBC937E38BDC236303DE911ADBC9C0D10BDEA4045BD5365E73D3C4A183D0008A03D01DD31BD2BED72BDB49478BCE6848E3D17D7C2BC32B7623CA3D387BD18F5B93D0509823D071A573D96319ABD0147893C79C219BDF7474D3B2FFB4D3DDE9E90BDECB6B03CAF24043D27FB8A3D58928BBDD543F13CD6B6ED3C0ECAB43A10D657BD0D8D0D3DAFFD45BCCD298EBD72D91ABDE1AB003CD99D9B3D7B4772BDA44B4C3D1FCB353D6E5F8EBDC175BFBB429BA53DD10914BDFCCCA8BDF6A3A73C7E6FA83D731E413CAA9AB63B731056BB6A0A0A3C034642BC1A2730BD68C11EBDBEFE963D4CD84A3DBB96313D13C0B2BDAF0F1DBD23E9A3BC29B4983D3305FF3CAC69323D734CFC3C0913413C09C1A03C43180DBD8DA37C3D30D19C3D1D8A343CC420DABC9FFE9ABD4C95D6BBBB74BABBD33D193CD053853C24EEBF3CAB381FBC8E0E6CBDA6D64DBC01EB7E3DDDEB71BD5E1483BD35A252BDB1CA383BC9BA7BBC7A40B3BD5492803DD7F0B43D4547FBBC0DB045BDAC3DCC3CE31F83BDD472AF3DFB06A73C1151AC3C645C193D663377BD3FC495BD5498B83D69569BBA78B94CBD1469EDBCBA126FBD1FCFB9BDC5E43C3D2432B13B1EB8653D63D5BF3CE96374BCF1CCF7BC8761DF3C4754D8BDCBEC83BD515800BD0E6421BDFF6C18BDCCFB143D50BEA3BD15EBEABA0B0E97BCC6639D3D13A16EBDC75CD43C19D8C0BD9E5090BBB09637BDE930A4BD87B0AD3DEC0CB2BDF76CCABCE7FFD0BC947B163DE919A83D810715BCEE3E5D397116B2BCF6BC52BD744AA03CCD2096BD6C600B3DCA06473D0DEDA73CDB6906BD3A3B7A3D0E0E8CBCCE25223CE262FA3C7C1AF3BC971487BC49959E3DF40CE73C1B0F01BD542121BDDF0C02BC637E08BD339E103D5D81493B4AEF7FBCA3CF5FBB5917F9BCE23B29BD1731383D4B5130BDB3E0E03D7143763DB1A5423C804088BD6D2B22BCADA614BD2BA6CD3CB6952E3D4BD7523D54BCFD3C6F6B93BBE29C82BD824468BC04B1533DA92D19BD448F4BBD888D873D6D5EC9BC0CB07F3BB728BF3D533BDC3B96D002BCB6C2523C2DE8003D64E75ABAAE645D3CCF2564BCCBD047BD45B0803D127E1CBDC11F37BDFA53823D6F3970BD03628B3B923746BDDF21973C3BBA463CD24163BDF2DA0ABC6EF2CBBCEA6B8EBCC24133BCD95598BB4C7A3DBDF4153ABDF932AD3D0EA8643C7A00B3BD98ECC4BD30A4A6BD29E75F3D6E99D0BC3EEF443C18BD183C7355BEBC911AE9BD09A518BD9D25D5BC6920283D464C78BD4CF989BBEBC3163D2A3C873D9A4B51BDB853C9BC94F9BA3DA23D59BB319DC53DFBC2E1BB4C3F0FBB9DC1CABDF6CD233C8E3508BD83C10F3DCAC6F23AB1FCBE3DA8AAAEBDD76618BCB966013CB9878D3D253D873D9B9DEABC349A22BDAF54133D7E7EC6BCEEF42DBD698D8BBC7DE148BB4030823B48B043BD6C25123CA134E6BBFE9519BDDE7F89BDDDA3023DA0404EBD38C8D73DC23F31BCD18357BCB64CC8BDA5734DBD5C4ADD3C533685BDCDEABCBCEACE733CC41CE0BC1B173FBDD9627FB9AE72E8BCB15B02BD64298FBDF2FF6A3DE2BFE13CEFC85DBDDC8883BD35F8ABBDE50EE33C23A1E0BCD41B47BD2B4ABCBAC175BA3B865B2A3DE1E265BC315EAABC02AABEBC42B3B3BD97CC8B3D3C82063DEE3F4C3DC3BE7FBD2E065E3D3F8EE7BCBADA92393DA96C3D0D31C93D44774A3DF98CA3BCC69A113D529390BD17CD87BDBE2B823D9F97153D7AFBB73D3488FA3BD7CD003E5C6350BD664C74BDAC0AD53DD590883C59F198BD81C912BD44D2863D35642A3D230E9C3DA388353D5D85233D66FFA43DB4E86ABC8515C43AFB9F163DA3C2BABD4317773D809CE9BD8964D5BC43EFF6BB8D33243CA7BD4ABC52EF77BD593778BD5E80C13C62AA053DCBF136BD638BCFB948B060BDCAEE673D572D5DBDE8B3F0BDA59D353C02C5823D3AE4E9BA597E623DBB1EDCBC6622513D9C5D0E3A4EBD973D831EBABC45034F3D99D4333B1042213D2ADC01BD1D52933DDFE686BDADCDACBD660F6B3C0367B6BDB17EF6BCCADB37BC900B343CF18E7BBD4319E2BCD51A5EBBF66E8A3D3A4AC9BD652AF73C5D3D99BCDDFE293C51C23D3DEA16C83D8F5A84BD3E47873C14516FBD6155383D1F7D5B3CA9CC703DAB852DBDECFB833D677391BD8CED033D751070BD615FA6BD4EB48FBD077EFBBD7C2E3E3C8FF908BD79A7CFBCFC878C3D96B6343D31A1193D0F3CEA3C9E28BA3CD5CB54BD5B1D163DD9CC943CF5F8B33BE80D8A3C5692E1BC5D74A53DAB1565BD3776623CB8CF45BDAC03673C8B94153D5AC836BD5530BDBD50CB85BD0137D7BB6495913DF62AAABDFCEC2B3C6026BD3DD35903BDF9437E3CF0AC0BBD2CB9ADBDE8049B3C46E6BB3B3103873DD29DAA3B404F0A3C5F6E193DB388AF3D045C833DB851AE3D0E3ACF3DA1A2283DAA2E713D861286BC9832843D14A8A33D02BED43C8AE4AD3D7BDEF83C349D073ECDDA343D4D8729BD4786383D133BC8BCB30D22BD7F8BC23D2BEAA13D494D39BBE322AB3D86361C3D63C4B2BC3FED21BDF68BB03CFEDC17BC793A2A3D63C1103DC373423DFDE2133BDBA34EBD6AD437BBEC06633D26BE8B3D62EA803CA29FB4BCB4620EBDE34D823D3FC9B9BB5D26A4BC8BC705BCD16CA43D2EAE3BBDD68BFDBDF81DA4BD2BEBBD3D93C0A2BDEB2D17BDC46541BD80EFD9BC2A495BBD4EF3E6BC7E370A3E963AAA3D0845F9BC2D777FBD6E3AEE3CCF8E82BDA4D00ABD5FAE06BCEE93473B68AF2E3DD1C2103D21EB133D460A5FBDA666A43C6D082B3DAB0EE63DC591FF3CC272023CE5F633BCA8F5C6BD5969A03C89967EBD50385FBD89EF1B3D1FB5513D27E51CBCEB7431BDD1A534BB0BD754BC41C3BDBDE412703DF14C783C50A91CBD306EACBC785C8FBD41399DBC75C6B9BDAA6304BD288185BD7237703DD409AD3D805696BBE8671E3D9D4469BC516F113DBB0D953CBE760DBC95DB12BD1FDAA3BDD262273DE8848E3DDF4C7B3C23DAE2BB89C7013C7B3E25BD7322C13C4E622BBD9A26823D2AF81ABD7A1E4ABB6139943DA695B73CD35597BDBC56423D3DE47E3DBDE2093DF66724BD436B01BD82E9213D192A4A3D34A7E63CD228943DC4B587BDB47042BC9D2CDE3B7844BB3D7923713DA108CE3D64801ABC9F89273DC7C1CA3B41CB013D9BE88E3DA627843DEA8F603D39133CBC6726253DE04E54BC8AF2C43AD988D9BCDCAFA8BC6DB89D3D5A800CBC1EAE4F3D1A4A223DD83DBC3CE5142EBB8E3552BDD04C03BC2592AF3CFC31143C22077EBC2992A6BDE62249BDB2B40A3DE75E50BD45F2653DA7FE793C3708FABC4558443D505D5DBDD16363BDCA8792391AF42FBC2BA6673D5D6234BD448180BCDD6C873DD0FBB4BD079FA1BDA969213D6C11643D8D070DBDD0B3913DE5891D3CD7A2A43D7DB2B8BD4CABB5BCB40F7A3D0458273D2F4AC43C0AC533BD0988A03C231CAEBC39214CBC6AA7763DC9164E3DE12C9C3D56C54BBDD90AA2BD3860A0BD66CD7C3D523495BDD06CB83D230311BB755DC4BC119B0FBD7288A0B96CCC85BDE13C1FBD11BD7D3DC08CC83C15150EBD0D23273BC65B573CD895BD3D65E891BD38FF293D57E480BDF6D293BDD70474BC6B404ABD8FA85A3DA9D4BF3D9D89FBBD4B76073C96E08DBC1C1C883D9A524F3DF326B6BCCEDA363DE05E4FBDAEA6823D826839BC610AE7BB2F988F3DD693273D377B9C3D3286513D5A9557BD28A7853D7C4B5B3D3936003D36B09E3D0111CBBC46CD143DFB98063DCE9A53BC23EAA4BD15871EBDD9452ABB115E033DF860CC3D1202B73C26DC843D5C37B4BC3C0B4BBDF524B4BA2AC70F3DC6A8E83B48F6DE3C59D0993D402EA23DA930BF3C7032A93D81DF1F3C5A8CAC3D625E573D3252B33DC2CF2F3D90360E3D6844943D7C57A43D56BC07BD0E441F3D4F1D41BCE8D66DBDD2864E3DD38324BDE0856A3C0C5BAA3B40B1103DF68516BC73681E3E166DA43D77BCEFBCA5D393BD377B0A3D628102BDF933883DAE2D88BD4EADDBBC378E813BD44F58BD4FF381BDDF716FBC2E7690BD5FF63ABD0EDA19BD3458383C9D0BFFBCE4027CBDAEA886BD56AA81BD54EE85BD74BFC53DA53410BE151D21BD64A14FBD1A8BB7BC4A7B83BD9E5BF8BB1D7C88BC6036CF3C2E15953CED9118BD010190BC79300ABD6BCE82BD79C8EA3C5809FF3CC62491BD836C713CBDE5203DDB1C6EBDBDF9FF3C2A82A73D915F3EBD000CD53BD25C963CEBCC613D3BB82B3DEB5A3BBC0EA26F3DF8E4343D8F8DEEBD22988CBD68E870BD3B19A53C26B045BDDDBB2BBD4495A13C6DFDD6BACD0721BDF22FA63CC841A0BCA6101F3BFF72813C7F5C123DFF17D9BC710F613D8EB2933DC94B233B6C57993C42A5B13D6CB88D3D98D5C03D6A1F9DBD30FBF03D3D7F983C9B85AEBD920964BAA47D8EBD6BDC37BD3AA082BCB0A2713DF291823D82A719BD79AD103A4BC90EBDAC558D3D1202893D90EEECBBE40FAC3DFADCC6BD81B018391668DCBD2D584A3DAA7BC6BDB3591C3CD91BC43D759B95BD1A94813D59762DBD64EDD9BDD0D8323BC84D96BC4A7DCE3DBC39D13C219A54BD15920A3D3F3CBB3D4D887C3D360B34BCF89D03BC86E78ABB354F253C82E2513DCE9A083D2378D13D3BD7943DDA7843BD0790753D47DB91BD434AD53D1F7215BD8A8789BDB6ADACB845914EBD2226BE3D5B0B983D9AA7B93D8AAD7BBDA6091B3DC3AAF43C79A0883D5E70833DA0E192BD9249A9BDB6346DBCF6AF0C3DDB2F1B3CD5F3C23BC87F803D6C3A783D5CFE1C3D98E9C2BDF413193CCB4D03BC069D49BBEC548E3D1049703D6DFE25BD09D570BDAF831ABC0D3943BD009FB53D7C39813DFCEC88BDC7A3643D60738BBD621040BDE1A6F93C5362ABBD1D0DFE3D5A7E48BDD9BB26BD26048EBD522E023CC111A9BD4CCFA4BD91EC22BD0A4E52BD27679A3DF6087E3D3049B73D39F812BD1A86813D10569CBD8B2DBA3D41267C3DE8367F3DB23A8C3D342F38BDD72C1E3DE1D381BD47F4BC3DFBE6383D68366E3D5CA2ADBCD020B03C9A2C9E3D1951813DEC36EFBB706AC63BB891DABC94E67CBC5F4A69BDDBDF37BDCB7150BD9F83173BBC3778BD67E4D73CD933E83D190569BBAF7281BD9EE6603DDE09AEBBE59C913DCB678DBD47549F3D5AF9DDBCAF8A83BD1AE3C43B80A6A83D7C5EA43D180F313DB65C8FBD69A6B43D27B8823C6B60923CD574A93D5FE4CFBDAA9FB03CCDA141BC07491CBDE899C63C03BAE63D671E063DBC2BACBB3E94C23CD8C1533DBFF7CABC16EE5EBD181253BDD37C853D50DC01BC73F2E5BCAE0F30BD06BD0ABDB803E2BCF9F6F8BC1435713D4F5F9A3C4E06773DFB0654BD1F9599BD6D40DE3D4706553CE75D71BDB9A6903DF75B023DCBAD91BCA332A1BCEFF7D43CA13D17BD0C41DA3CF4C147BDC27D12BD1274D33DDB48AABC268268BC706985BDDDCE35BD5821BFBC833C113DAA2D563D8423E7BC907F593D9DC2553CFF2D5C3D8B60313C8C1BA63CC833F9BC0514BD3C8A4DCDBD4F118BBC4BF395BD747E473D4E78C5BD3BAF9FBDC33666BD9CD1C2BD7DDAEB3C4D298ABB00D32CBDFBD19A3D68238DBCFA4489BD4E073CBD887F373DFEADE5BBC87BB13D9E90823DB3C521BDACB4203DD97AB3BCC6F12ABC84E79B3B77E31CBDDBD20CBDB05BB93DC1BB74BD2D59923DC91754BDFFD7873DCAD0EEBCDA6E933A1C7C4C3D149976BDC992DB3C1760453CAFCFF73C8EFC783D0A8F63BC8312053D5EA72DBC67F8A33DF45759BC6EE6753DC2049ABDCE5F063D5118D13D2AE9DB3BAE58243CBA110A3C2403F3BC73E5B1BC3F8509BD58BF443D1905863C2A601ABB43C0AD3D529A1F3DA24FB23D0A93C23D104B39BDB1949839554E003D56E193BD334344BDC5196DBDB2E8F73CC2EB1C3D3D4F513DF5288D3D3DF1AA3DC81E0E3D763F583D817C213DBC55D23B3ECD5E3A9C52B23CC4C5883DD612B9BD548C0BBCB31E883C456506BDE1A102BDAF71D83C0BF72BBDC60EE2BCD91206BD8E38CBBC9669E2BC010E883D07D7333DCB81A5BC2A7C88BD1D11843D371423BD12EA6FBD51D5113C4583B7BC75D489BC128CA53D264E1F3DD3081A3C6EBFB9BCCE7508BDE97B27BC9E7D56BD0EB2CCBDB7BC3B3D5C7D793D6034D1BCC4B4963D022AB8BCDF8B69BC91B91BBD901E5ABC3F8471BB9C525FBD4C9689BD4651F3BAE915333C68DE8DBDF1E6CE3CA92652BDE80B2DBD1DCE9E3CACF46F3DEDE95BBC7F598DBDD92ECDBBBA90433DDAB78D3DA4618FBDFC1CF0BAD00D0FBDB88830BD2F2E343D2BBF06BDFA2CE03CE2E6943DC6B6ACBB202F4BBBC9268A3DB63132BC8A49ACBC1A9BB93D1CE327BD1915F53C9C8384BC6E33AE3D3AA094BA88E959BD92F4A8BD4A38913C20401D3BF20F20BDFDE2913D469CBFBDE75AA03C56613A3CB54A5ABD3F819F3CFA26CC3BD97BCCBC1790F1BD93D51E3DA2A383BD0C32903D417C23BD7FEE5E3DE40C67BB5F8B963CD99D403D306E64BDAA8B4CBD02974B3DEC7A6E3C28203C3DCEB984BCB9CB813DD999C03D420B09BD5943DC3BD6FA8FBCB976983C2EAD9EBC0206793D6F56813D413B5BBD50A919BD7BB7413CBF0A493CAF7403BDDBDC853C8F4F1FBB98A83DBDFED90A3D23B5A43D441E573DED4B273D0C23B33DF5AAFCBCDB658E3DD00ACCBCBE3338BD530C113DAA34CB3C8F52113D8772483C90DAD1BC7579C1BD3F6F803D01F686BD80410F3D90F1E3BD362DF0BDE844CBBC2DF5933D05750EBD9A34993A92AF9DBC107D94BD828EF9BC1CB091BDEE9C5A3DA0B2D7BBE55A86BD50D6783D94F3B2BC6DCBC33D89665F3BDDBCF8BC244FA4BDDFD46E3C98850C3CCF1402BC1917853D309E673DF290DABC3E18D53CBED7733DD9CEF9BCF4A47D3DA575D93C957664BCF2AB6F3C57D648BD084198BDF713A63D503E84BD851DC13CE359AC3DD71498BCA3DC353DA25D5BBCD694133D744016BD50FBBBBD28CAC93CBBF617BCC79357BC6CB65F3D52F097BC4EC0B0BD0D8F54BD190474BD4D47933D9B1183BA15EF4CBCE35880BD97A9C33CDFABD4BBE58E98BD0142A03CB5EBB33C87E853BD18A408BDDB823ABD662F97BBAF367ABD575E6DBDEC1DB1BD38E5E4BCEB9F86BB9CF9973D571CE4BDB70BBA3DECDAA4BD479F1A3D45E5BB3BD16FBABBD1F68B3D90BF583CBFF798BD2E54803C049D29BC263EA9BD4F0A69BD2D2E6B3DDDF0A3BD01E7BBBCFF77103D2662D63CDB188E3D59BAED3DA586EF3C446E16BBF766953DFB4A333DFC1934BDAE1E82BD862830BBA0F76EBDB67B553D23E626BC36B053BD4B82F43C46BFF3BC41D5B9BCB9A86CBD3F81243D30754DBCA7402DBD6C7B1E3D6FCD9A3D8DF905BB77CC73BD1B4407BD8694803DAAF8B3BB066992BC4834013DA89547BD92232E3D3233B13DC74C823D6362BE3D89AEB33DFD11893D831022BDE56E3C3DEB6925BC65C5F0BC64879BBDCD4BD6BCCD507B3CB5409E3DB7DA96BDBC4603BDEAEC893C1FEE84BD648C8EBD55BEC1BC83D5923D4AC4A3BDE62E3CBD30F446BD5B1838BDFE6D133D9FD95B3D13DB90BD5D722F3CC084D73C115067BD84933ABD2A5581BDD50387BD37DE7D3D5935FDBC12F001BD1CAFB13C3CD4BB3B2350823DAD1345BD19C56C3DE3E70B3DB5AF973C533268BD70FE6D3D34579E3A9BF530BB6A85753BE16034BD10E368BDE8F3C13BACBCACBD9B2FE33B1A6F5C3DD3E7CEBCC2CC383DE08FD3BC7B7D53BC7F3352BD10286A3DA1514D3DA0248B3DA9AFAF3C3069FDBC2CFA413DDB4BD3BBEE5166BDF1E26CBD8B1897BB44A50C3CD21EB2BB9391A23DB4F36E3DA624853DCED8033DA8EECBBDB39C423D460DB43C6CA8DCBA8060C9BD027A893DD1159B3D3583CF3CD19D9C3B572A8ABDAE7285BDCF17823DF0DCC1BC72DBE0BC14EB763DB2631DBBAD83A4BCD15157BD18F2B33C62D63C3DC238733D6C1AE8BB2E48EC3CCCFB8E3D6CAC59BD80D2353D21867FBCE9BC913D552E8ABBBC6F933D1EB9663D4B7F8CBD19033DBD34407FBD43CAE23D6DCA9C3DCED876BD84AC69BDA259353C5D9FADBDEF2E87BD363A86BD43659ABD4F1383BDE688913D8C8448BD503B0F3CB8A52B3D9B1C16BCAB613CBC6B49AE3BE91E92BD167B86BC422404BC7D192D3DA83C9A3D1932E2BC4DEEA0BDC3689A3DE5B4163D26438CBCC239A7BDBDED213AC1DAC3BD066C90BD850D82BDE3927CBD7389843D5EC8B2BC564B983CC76CA0BDD3D2963DC78A30BD5B1FE33B0A8345BD149518BDB5D3203DC161813D17AA9F3C59E9B7BDEFC08F3DC9569EBDCF0DC7BA0EB79C3DA378803DC7843BBD4F86283D88EBFFB8FB4278BC2D0D633D30877EBDF4C7B93DAEEF7EBCE1EB99BD6BA0B4BCF51425BDE24A093CF53C033D6E7191BC6EC9443D72F80BBC3E1BE23C035C3FBC82F68F3D70A9753D58E90ABC27F7AF3DE101803CE5C3963D02691C3DC9148DBDB9C345BC907B523D5563C8BBED5D27BCA4563CBD1A4AA2BD078F5B3DAA122B3D08A269BD3171C73C615C8C3C7F5938BD47665E3D38B95C3D7B24853CDE03A33C3D0B893D4EC711BA2FF44F3DAC385C3CEC05B23D4E9BD3BC44218E3D13D338BDEA4C41BDCDF5243D4E27AE3D483E8DBD558CEA3C168CF93CBECC4CBC7BA3BDBDEE044E3DB7B2DEBCEBCC323C02D452BDCBF6903C87319DBD9CA3DEBC5707F43CEEA66BBC675599BD7B68ACBC6EB6AD3CF371C33C1EEFD53CCA9D76BDC28D8ABD74EFBBBC2AA57ABD6CA77A3C89376C3D7DB60EBCE8912CBDEA0A29BD2299613AD70F3D3D2AD4C2BD346D093D315CD8BC0045993B3EC2A4BC037A2FBC5131413CB7CD8C3DBC99AF3D668B69BD8567903D821DFB3C9B41123DEE963A3B4BDA873D91F3123D3FD6613C5CC795BDF86184BD6DC9F9BCE4B3923DBFDD69BDED5081BDBB3B4F3DC7DCDF3CF9EB88BD060B603C63CC0CBDE043B33D8013F3BC7BDEC4BDD5DC34BDA6C35ABDC89C883D049A08BD424F6FBDB11F173C86FA1FBD2A314E3D0BC021BD37C743BD57A0A0BD32EFB6BDDCD49EBBE4EF943DCE74863D4CC796BC5F70D1BC963691BD171FCA3D3ADD84BD4C06513B5417C93C426900BDE5C1D33CAD497BBC1FD1C53CA5A888BD4073C93CC430043D43161A3D65D75CBDBF8C98BD908077BDD2D71DBDE1112E3DB4FC473D509D2DBBFF75243DC253C0BCA1EC72BCFB2137BD571743BD6835343D7114633D6B306CBDB6EF743CB76EA6BC1ECC9E3D59CADDBCECD0523CA27F913C64ED3A3D1D6DF13BA35EC53D637F223C60384D3DCA5F4CBD082DE2BC5866BB3C7F89C63C838A40BD749E763C2D971EBD0F36A63DF56B9A3DB7E71EBDADB1AFBCE9F6DD3C53C7423D3AE57DBDE940623D04454DBD20B898BAEED6B9BDF8979E3A8C56233D1C03573C341C943DFD12C7BBE827AA3CEC86993D5F0E643D14AFA73AC92E51BD08FC923C6CAE0A3DBDD50B3C16EF833D4B91973C8011AC3DBD604EBCDCF59C3D4EFF0B3D0D7A8EBC85508C3D43590C3D5E6515BD81485BBD2816543D8CA992BC0889CD3C843BF93CA9C338BDFE5D343DE4A291BD1649703C69CCF33B686C203D25F393BDDD2D85BD438B55BD06C34BBDD59F383DD0E444BBF0EB80BD9F4850BD991D863D254CEA3B5123CDBD202DF43B1B332B3DC7704CBD16F3833D14DD8E3C6CD52E3D587853BD3581E9BC9D32333C68E48FBCFB89663D03AD5F3CCAE79F3DF57509BDB24B8D3D367FF73C8194833C24CDD03B4A7682BDAD799ABD9B89BFBDF6852ABAEE47AA3D56F2403C531A50BC9842F9BC63C2183D6A856BBD480C663CB14C96BCE76A4CBDAAB9423D24815EBD4C33C6BC4A47093DD1089CBDA5A5F6BB6347CDBC886EB0BC309934BD532B3D3D8F678BBB192A073D04CB953D680C563DBB4F723D45FD863C14207F3CE1EADF3C4A18353D8EAC3E3D7912483DF4EB0CBC98C80DBD2E74583DD24B1FBD010EA63D8A03CB3C13EA863D9DD1CBBB317D8CBDBA1B2C3C19658E3CA8B0333ACE6DAB3C05335C3DC48647BD1C9E2E3D607C88BCF47006BDB17901BD63232DBCBD23283D99FF42BD0BBB2CBD5BF26FBD0EA8CFBC02BE093D7431ACBB3E5C11BD98F4853D64C5833DF639D13C640D523BB5C143BC9C310F3D133D6ABDAA5F353CA08686BDA905B73C9D2FD13C308F6B3C68799A3D6073AB3D6503463DE6025A3C0A17573D9616083C9CB72ABC513378BDCCF2AE3D791420BD105FFF3C4429783DEAE44B3D73DC73BC2A2E0FBDB202343DB51787BD723B803D62C7113C75A3953D3EAAB03DFA22C33CCC26593D45F2103DA9C2913C1E0FE3BC9929D93CB46141BDE7D4913B45DE833C7CE98A3D892121BC83667D3D05D3903D1FF8243DEBA1C33CE8413FBDD86D093D2AFD80BC86A887BD98102CBD86CDC43CF50FFFBB2823AFBB0A1C58BDE17DA63CA55DD63C7AE595BDB57D7ABD47E7473DBC7B91BC603980BD8D36583D0199D53CE75C813D06AFE53CB7FC853DC1E7143DBFD5313DE1BCB2BC9454363DEF66873CE53EA53D1E7D643D2FE5B4BC3E7B063DFD12543D1B7B3F3D3F78873D99F9CDBB68CDDF3BEDBF09BD1A28A83DA2F99B3D7E729E3D514E523D22993FBD6A6B87BD65908D3DAA350EBCE0118A3DF7B937BD46BE26BCF8B480BD978A633D9C11D03C6B643CBDC50095BDCCE67F3D48ACE1BBB5B85A3D482E383B1A1827BD182B623DCFCC7BBCD0CA91BD03FE2BBD9C496BBCF69694BD53DC383C0F4D9ABDF76FF2BB5A0848BD981692BD4696D6BC2A268E3DE25599BD24E8293D827EEB3C5EE34DBDC08A2DBD1C8EB63CEBDF03BD59A5803D8B5A9FBDEB642CBC119D873DC249D6BBD86CA2BC1A4199BD817A473D2EF51ABDCE495BBD58A236BDCB009D3D195597BD84D1893DC393CD3CE12A1ABD3B7A9D3D1F84803C52B994BD44ED713D0B140DBC12B3463DBDC1E93C4A3EE2BC31EE073DA58D67BD278EE13CD52868BC67F43B3CF31C103D9711E73C37FECCBCB19A903D5566843D1BF5213D28D1723C12C5943B36DB7CBDC3B2893DB8B700BDA66C953DF38110BCA90911BD22448FBDF0299E3D4CBB9B3DE84822BD61D81EBD27FE95BC16EA933D58E5613DE84F78BCB8398CBC2D946FBD391050BD1591573D24B7CB3C9B40EF3C102598BD5E8EC43C06A099BD018AF53CCDC499BC3587443D37DDD3BC706B133BE2AED8BCB675923DFEE32D3D8D067EBDB94685BDE09746BDE9F720BD8DF393BD3D9D3FBD8798773DCA65EB3CCA8DA4BD608D9DBDCB51873DFFA5823D92FF12BDB299F9BC45DBE5BCF41E34BD09CA593C152C3F3DE921473C306150BDB9601ABDB82675BD05E9D3BB2B7CF5BAA5127C3D6A955CBD14D28ABD92DFE23BB09D473CEF975FBD9A67D03CCD1FA2BD0C7030BDE89A58BA119D943D8073AD3C4BAC26BC7DE23CBD454823BB58BA413DC14AE7BBC2453BBDBDDC97BD0E6D0E3D359A933D9D67463D4E3B973D989EA13DCA4D3FBB8F2A763D4D1D83BD16DD93BDC5DC913D3376CD3C791CBC3CCC53ED3917CD27BD3D853BBDA2C7E3BB24C430BD621F8EBDDD749C3BE957973C9D44FC3C61F953BDBA483EBDB495CE3C02F3903DC801A43D00EC34BDEFD6843D26DC0BBDE34C0E3D4027463B320895BD9A2492BD1433A1BDA7EF21BD028FEEBA36998A3D893381BD13EFDCBC33F491BD8BB970BC14ABF03C5C3097BC9C439B3CCCB0943D83E957BDF50E9F3D79A67EBBCFCD4D3DEE0DA1BDA81E373C781D3C3C75B292BDFD5C1BBD6C364ABC8D3620BD206617BDAA988DBDFB352FBD4239CF3C037D5BBD3A589FBD4E861E3CD97558BD70BE0CBCE6231ABD8C97A43D3C55003C07E410BD3B3D483D80CA0FBC0E9F6EBD77489EBD90CF0BBD3AE3403D41259A3D57A6873D679F833CBDA887BC00FE22B9D13EF03C4286A43D162C3ABD73B843BCABDFC83CE8349B3D27EB2D3D831E21BCEDFE3BBDE1A5A43DA8B297BBAF7731BDFE0998BDB48A4B3D0770093D9D2148B8D4A9603D1E12203C0D4FC53C472EA53C70322F3DF571CEBBDCC196BDB5CA80BC015A1C3C8C1593BD47E521BDD609253D8096EB393257033C19B9D9BC9C0353BC2461133C94788C3D5247633DAC8A513D97B2013DD691203DD47CD0BC00599D3C7E1790BDA67E14BD7B8D1BBDA6AFC6BC09EF92BD708DCDBBD32C29BD07BE523C0541353C1D37C1BC48E17CBC9FF593BB33D2C0BC53F9253DD0CA76BD2AF4653CCE548A3CFBEF163DA3D38EBC63FC1ABDCB5A9A3CDD42F53CEF642A3D51C397BD694E73BC183695BDD6C080BD5F42423D53068FBD64DD803D5D8A20BB4EE97DBD008E313D46E308BD61E896BCD3EEBB3C5F08453D27D8CF3C147D6BBD17D3503D971980BD5C3B643D3BCD5FBBA6654C3DFD6C9EBD002AB9B9BB6B87BD1036843B128C433D9A46E4BCFE580E3DBA666FBDDAC51EBD08AE55BC7E259DBC608C543CC8140FBC885BAFBCF28F683D801A1E3CE09400BD845550BDDFFF29BDAC4BC03CF696ABBC02B31D3D00F9F23C407330BB400310BC601B61BD20A8A1BD6E130F3DED0A7DBD88780FBDDE7BA1BD8FBF843DFEA46EBDB860EA3CEB65A33D5EF802BDB61C9DBD9ABD1EBD3355803DA94B883DABDEA13D0C3A0D3DE10B99BDA6A4733D8AE7FCBC48D907BC8B7321BD7ED1343DE2E3E9BC98A2233C301526BCB42384BC1C8087BD4479CA3C1C90B9BC8E10603D7EBE74BDD8CC913CAD1E9EBDDACC9BBC32C3523D92A5E5BC260685BD4C3B9CBDF80FFB3CFC2990BCB8E6193D111F01BD6D9B00BD1825413C40F8B8BB3AB95F3D0A44D4BCFDBA84BD9023623C2A20B7BC908915BCC79D87BD0884D13CC3C19F3D3026C93C80836B3BE46B6EBD703785BC96314E3D2BED28BDA8BD2ABCA67B073DAE800E3D40A088BB804D8F3A208643BB30AE40BC06FB793D8D803FBDFA8B743D70CEB1BCAA399EBDE468AE3C00F8123C8424123DF9A7843DC42A893CE4B6D73CD1910BBD4E80473D3BE18EBD30041C3DD0048B3BEDEB953DD2054F3DC8D079BC456D15BD58FF1CBC480A88BD9736973D2E99743D0015703A024B53BDA0BB88BBABAB6FBD5C2C973C0208323D06D5583D00F3423ACCDFE03CC9E6913D2A534B3D8252163B7CC03ABDDD7ED3BCBD7D513C8A38AF3CE49E613C9C3189BD901D83BB36F12CBD6B019FBD83A917BB69F7513D7EB59B3D2B704F3C6AE19DBDB86CC2BC23B3A9BCED00703D4E85D3BC0F4172BDC5EA32BBC85F683D59F0483B7A23D03CD90B413D5381E23B8CAE1E3B0CB3A63AE492AC3C445C423D996E66BD7766A3BD228CA03D95AA643DFFCF623D0AB4923D7D0828BD95B89CBC1BB299BDAEF912BDA059CDBCD3C8DA3C0BEF0F3C944D90BDF1F451BC516AD93B2137F13C2FBA71BDA2CD413D6A34443D95583DBC7D17473C5320A03D16F438BD9654B6BC3C89A2BD07EC653D3DFD8FBD4F61E83CBB36B93B05EEA4BDAEAF86BD41DC993C57F08F3D0503803DC610173CC1175DBCB2337B3DFBB7053DEB1F983D141194BDC3AA243CB349A4BADAE9993D2FCC1CBD30225F3D48620B3DA44E963D95DF9EBD2AE183BDAE655CBCFA048FBD8B56E3BC2099703C36D6253C20986D3D9D9B273C2D24563D67F2A33D9038383B7AF92F3D18FC783CDA6425BCF7C42A3DD69A6A3DC14FA5BDE6C939BDE1E68A3D01675F3DEA7743BD50E02A3D9DFC92BDEADC7ABC76DE42BDC9179D3DFC54303DB40EC1BCFDB595BDD882403D5639A3BD1482193D3C0A893BD92A213D83608A3D47BB5FBC82A8523DBDC1893C74D6B53CBD5E18BDFB0470BD881602BD5ACEA23C4CC0373C10AA953D36D87EBBC52D873D4CEF1ABD84AAD0BB1F97233DD2749A3D7B995FBDB70D173D84D894BD48CFB23C3EACA03C93A45C3CBC5A883DAFD86D3C19AC363CF6281F3B5AE396BD561236BDE642363D83B5B23C2A8B1FBD64202A3D2B0982BD7A5FC4BCD877323C742B703DA813913CFA451FBDC5E21CBD10946E3CC19C02BD85BB553D424B01BD7E7D0DBD227396BD09EA833C5466713D7CE68DBC65455C3DE9E05F3CD1231D3DFC2DA03C1FEB81BC7D1529BD44814D3D5448BF3CDB81103D7E443B3D2EF2E23C053521BDBFE463BB28587C3D924935BD36D92EBD99378A3D6CE6213DE50941BDC7F25FBD226B20BD354B57BD592858BC4D6694BB76BFA33D4B84AF3C23EB9ABCE0B8F1BCE2981EBD2E36353DAAC69DBD362E01BDEE9A07BDB32E35BC18CD883DC777EDBC0B7540BD45AB51BC64B3A8BCE058DD3CC08193BB6FBE92BD8CE6013D0D058C3DBACF7D3DBC5400BDAF9A3ABCB85A1D3C17C6E83CE7CE87BDB74799B84955203D8716D43C5BD999BDC39619BC5B05553DC37327BDFBCE9A3CE195CD3986A3213CE8E7FDBC15DA2EBDFCE901BBD8F7E93C14FB4BBD2B97203D01A718BDDC0D50BDFC6CD7BBDB61933D9F3D313C5BEB1A3DC4CC0CBD2F2ED53C4E928C3DA3AF813DE57C43BD3BC895BDA061493DE18C54BB3191F7BC68A6143D56B7DC3BEF02F4BC1667623CC0F887BD078E723CE8B820BD92B50F3D22FF313C3B0F083D3F9E9EBCD20CFD3BD12E39BCE40FAC3DAA2710BD0D7B35BCCCB281BD3412053D8CFE44BDF6B40BBDCF7060BC07E1CEBB09EB8A3D41EDF3BC1488C4BCB0C60E3DF6454D3DAC840B3D008415BB272180BD93782ABDF4B3B3BCDDEEDEBB9E7090BD4498AA3C82641EBD43E1293DA93C063D599E0DBD8BA6173D87F89E3DF0D438BD2337823DD7FF533DD66D333C7B39C3BC642123BD57479B3C9CB9393D380E8ABD818E68BDC4FD2BBD5F584EBDD282903D288B4EBC53B1123D5EAD87BDD45314BDB15F253CC577973DFB1F973DE0FB573C0A42D3BB5B1F87BD9298DCBC82F8D83AE1EF08BC5233A43DA4F0E13C2E7A9B3D869687BCAE4C02BC9E5B8E3DE4B9403CD7654A3CF44F9C3DE85FEEBC0013473D28E45C3DFC4ACFBC4ED78ABC92C8403C853AC1BC76BD00BD2449323DD85B23BDDBD2433D9EA90A3D02A1B2BCA9AB2FBD2049EE3CD942333BC899A9BC7080193DF9953A3D7C3673BDBF28163DC4E3F13CD560803DEB70F93C647C62BDBB97993C5BFFFCBC2D21B9BCC34A8F3DB517473DF3C199BDC99A43BCB5E2E2BC3EDA103D0A7F24BD0E0DA5BD6F8C0F3DCB8E2F3D4DE6573DC245993DCC4F883DC43B883DBFAE863DD036D8BC4E4D913B245F9A3917FB96BD3A8A95BD7DDC1CBDC064583D2319673D727784BDC1D790BD4FF4683C0C5C14BD47EE5FBDDB9AA5BCC1CA503D6C4AAF3DE376CBBC368989BDF63C563D7435E43CA51C41BC6E75353D31BD56BDDB994BBD363A983DA8ECCABC135716BD5A06723C3636D03BD828CE3B88BE533C49988BBD813106BDD148733D7F1DEB3C3D7D97BDC0D90D3C374269BD8E6022BDC5B87FBD6AE4A33D64DF873D440A3ABCFE28743D3C25743D2B9C6DBDA10689BD286A8E3B5038843D004CB83C026730BC5B1051BCBD0C89BC02711FBDD32D103D2D209FBDDFF7913D22D22ABD3913C6BC1463133DD6519B3D3A0E65BC46DA10BD4E87A0BCC71179BD8E02903CAE00AE3C8B7C7FBD3D6271BD94784ABD3608EDBCBA81863C17EF063DB9C192BD5E6434BD0ADBF5BB1C739BBD0742873DC7C4DBBCBF7ACABC32E28A3BD2AC63BD601464BD78FA0EBD252C1CBDAF758CBDEBF9943DBE3344BD65B41F3C084CF93C4D98B0BCBF6F60BDDD114B3D381F533D832B583D57673B3DF03F483D0B5E7ABDAAE8B23C44B686BDEB649A3DEA7679BD8D0364BA59DD7DBCD52A9E3B37CD81BD6891CD3C8171CB3CA73D663CDF41223D9A51213C2117943D9A15973D15B7A93BE8F95DBD933A8E3C124D893D792F56BD3F7D35BDA8196D3D04F93A3C04BD62BC00E38FBBF39213BDA5CADA3C775A823D51BB193D5366013CFD28BABC8E225EBDC2B26B3D295BF1BC40D16EBD3711583C58EC823D2A31DDBC1E48A23DAC7345BD702FD3BC219420BD9A66393C552AED3CA76ECC3C149DE1BC74D7833C814A0CBC0ECF67BDA3C4533DED3DADBB66DCA7BCD443F4BC48BB30BDE3E287BDB1B9CABDD2F4A53D445176BD5A728F3C587A073BC833B73D9106AD3C7FC3783DFAD53CBDA79A463D8B72B13C5CFF35BDCBEC513AA42F0BBD967D5CBCD639A1BDF0E75FBD26E49A3DD38C3EBD6892A73C3C37933D4CDC2EBB1E205F3D2603A23C828F543D128FAABD4785A9BC48D482BC5237E5BC078F5C3D5ECB253D197BE3BC0954723D3DEA90BD9E9D23BDC1DB2ABDBA17FBBC94BB8EBD6BF387BD73DB383D65E68D3DF987193D129056BD3A2E3FBD9F3887BDBB6DA6BD66A05DBD7945A83D10C502BD7415F23CA1024B3A047381BD730B8ABD8DE3F83C5DF9B03AB17A8C3CAEA716BD783A91BD55FC4B3D29CB963CD7D454BD93A093BD4BBFEDBC3E6C81BD7DBB85BC512E943A6CA73ABD629D6ABB58852FBD8819F1BC95B45DBD7B74653DB2B6713C0F9A9ABB5CC2C53BC7677F3DA2C477BA74F129BCF5288D3D3EC63CBD3FAD903DA448603C5AE68F3D71ACBBBC577B9ABDF0F2293D841D77BD235F4DBC8DF6D63C1C2FD5BC0210BE3CDD5C0A3ADEE409BCECB9933D3E3794BD16D13EBD219C0D3DA238903CA20D843D5A6330BDE8DED3BCA1C6E63C48E2BCBD3FD28DBD64A5893D8C69A6BDD7834D3D1B92C53CDB2D06BD7A3D633C727C733C276FE93CB0DFF03C7F0D9DBD80C265BDA1C6703D3DECD13C8419903D6801873D3EE18ABD12905FBD09B137BDCCA322BDC48D253DED0E9A3D0D4428BD1F10FFBCB2EC303D74FD1A3D0E0D5A3D4E1E73BD8F218B3DDDA09ABDD1C8B23D1EAEDCBB4E0DAF3CAA663E3D258D7D3D6399E03C95D8243C7CC2D7BC4AC998BDD22B2FBDE9E40CBDD2E88EBC682745BB920CE93C00E38BBDFE4D583D1D7588BD73A31F3DE4885FBD9AE3633D9971A33B3C943A3D82D4A2BD44DF643DB042EEBCA088233D32EB583D6512973B4F1188BDAF00903D3FEE2E3D0D27C43C7705B9BCDED9573D82FCCFBCA06B08BCE48880BD1EB79E3D61FF1C3C9CFC1F3D3D0EBABDAC5097BD9C37B23C7B84A5BDAFB1A53C4106A13D00794A3D995F723DDB6E443C39A1E6BC78224ABD96D63D3DDF6E823D9E3BD0BB24CC93BD026276BD48094B3D0F755EBD67DC88BDBAF6C4BD41468CBCE3F00FBD1C8AB7BC98B9533C932C3DBD311A4B3DF34EB13B529033BD422BB8BD3627253C5732123C51214D3DACC44FBD79D14CBDD34890BD311B0BBD4203AC3CE529DB3C974E773C591CC03CBD1B45BDF16765BD2B4EAABD39462BBD2BF7DDBCF54A4B3D1388BF3CF3518D3D2856C1BCFFC51E3B8FE924BCEDF5063DB10F773DA00EBC3AD5645E3D0EA4A8BD1C44B33D46755CBDFAC588BDBA05FBBCBBB71E3CABA19E3DE51B1BBBC65BD33DFFA0B33C9B0E5E3DB4EA883D5C2FAD3D0D4222BDFC6B39BDE84235BCD4C4D1BBDEA1573D0AC6C13DD1D1BEBC72CD36BD3BAEDABC24E7883DBE0E9E3D5F220D3C72FA893D78CF8B3DC69BE33B92BE15BDD2152A3DFD77AA3CA1B251BDB5ACDFBCA6B99D3D93757BBCF212343DE48E6ABDBF513EBDD49BAFBC795ABE3C52C297BD3FD48B3B4D8FA3BDB82D0DBD48DE5E3A5ABF3C3D3A0DC63BBA919FBDC07A2FBD5ADAA3BC24DFB1BD1ADF91BDE4B9823BEEA6CC3B42FE8BBD1E47ABBC97DB1FBD493C393DCDCF743DFA2B81BDBE351C3DF7F092BD12AD033B7E403F3DCFF0973D319BB2BD93702A3DAC9D18BDA8D07BBD4812CA3DACA16FBD11E99ABDE2C27E3DA48FBABD6A3390BDE4FEB93DE422833DB2E588BC99AF16BD95E444BCED44B3BD012623BDC1E2A03DAB244E3DEACE3BBDA9D485BC9FB3823D87103EBD96D1103D8B5264BD9E8299BD36F1A3BDA27DB83CC3092EBCF36ADBBB997AFDBB1A44BC3D2F3999BDB0C6F93C646D31BC0781E8BD624C793DCB6BC6BCFA87F53C04D006BA87A19D3CA20646BDEF565A3B9579903D1DE88F3DEC6F24BD6F0ECBBDACDF5C3D3DD183BD06239F3A1BCB81BD43A66F3CA1748F3D95D3423D329341BD87AAA4BCD1C938B870C7003DFF2DF83C03A463BD5FE8B63CFDFCDA3BCC6B183D0441953C4B0E44BD6CBF77BC925246BD03C892BCD60D35BD960B9F3D7C7E7D3DD5E9C13D020A0FBC521B16BD1C219DBD002AD5BCB07289BDA1FB813DE271A7BD6421AA3BF6E975BDEC588A3C3993F93C4869EF3C6EC907BDBF96483DAF37FABCB8E2B63D72D9373A88AA92BD0DB8E6BA565226BDEBC3F2BBCF8E7BBD1CEBA3BCC055733DAEEA853B41D7B93D26FB683DA0B6B2BDDBBB8ABD325D08BDDC80C53CE404CFBD902E5DBDC686143C3BEF253C50F3823D813C50BC9A247CBCF470ACBDA7757B3D035911BD78F3AABDA8D53E3DDBDBB2BDEB9D903DB9FF49BDFC7B70BDC82962BCAC3409BD8F9A113D8A06B7BC9696AD3C2C388DBCC507013CC1CBB8BD4120B13DC44821BD647E9CBDD69A983D9F37B0BD1ED1AC3D8EE1E839E9A806BD6F0DBC3D967C6B3D9104463CCFC816BDE1A7A9BD0CDEB63D8F0F383A253D203D39F3D9BCA20378BD999B833D34FCA23C0C4C583DB325733D2107813C532D5B3D9DF8073DB3225F3D1477BEBDB431A6BDC9FDBFBD482646BD47B3CA3CC87CC53C061C833C383C8EBC2398263D17D2CE3C7760E5BDE79A1B3D26384CBD243D1CBDB20988BD3DF8D2BD0D74A0BD093A553A4F519BBC379410BC82BF233DAE1B423D1883A6BD425D98BDF150ACBCC90684BB4346BA3D486BBEBA21729D3DB193D9BB73F1233D02630D3D0317DA3DD4ED393DD55541BCFEE895BDEC1762BDC5283DBDC12E083D33C86ABDDE63443CDD54943D0D57783D353AB3BC949389BD6938C83DB406443D6D0F843D19EB3FBD85B642BC5EE9F0BCBD285F3DC4C2953DBAAD30BD6977E53C68947E3D0DEE15BDAC7AA2BD10578DBBF76387BD73E71FBDECC8673C35880ABD9B67C83DABD6113D5269CE3C0FA765BC10D47FBD87D78ABD58D5813DDD3E88BD1517153D5620EABC3CF0493C3DD58CBCED3E47BD384C75BD29EBC4BC34288BBD3A297B3D5936BCBC65C50B3DDCC87E3D7697C9BC24BD9C3D00FC7BBD14430B3D6BCF8D3D36BB383C79F0633DB9DEA3BC4BDBB83DCE14323B998023BDB2D97F3D0E312CBDCF46F8BC5B79243D4996B4BDE114E53BA057973C1A6B8A3DD94FEABCA6E00B3D0FB3613D4E304FBD8483C33C47805BBD014AFF3C643B98BDBE45A5BC2740A5BD8CC0553D013739BB028BA43CCE4DA1BC45368B3DDDA723BCB225823D9207103D6E4E863C140CA43CAFBE623DC868353C834AB63BE1280B3DE2F8953CC7D79B3D31424DBCA0053CBDCF0A403D08DEDEBB725760BDE529FFBCCF58BD3AB3D2383DF1F5883DF365C7BCA67F56BDAECEE13D0FFF7EBC17D068BAAE6E173DB561BBBCAF1F92BBA7C62FBD538350BD14407CBDB9AAD43CA214FEBCA71ABCBD19273ABDA00511BD34CD3CBB7967D93DD4BE863CBE9CA03DD3428E3DF7A07CBC83D37BBD3533673DF4BA5DBCBBB136BD75294D3D934700BDD4F2D13BC2B843BD69C420BD95FE4A3AF08B693CD6838E3C61D45DBD0919953D5E0C57BC145DE23D39F353BD5765773C02D1DABCF256543B3F9E57BD1DB865BD2492B6BC1662203D7AC9D239633CAE3C56FBA33C13632FBCDF44DFBCACA62CBD1D4EF33C911E5E3C1D2B693D35D350BB6A10F53CE745E73BB5F34A3C9C3D1CBDFAABD03CE3F580BDAB57663BDDC6D3BA1263E1BC0D7894BC4BC0363D349F34BD15FEDABCE3DE873DFEA736BD85553E3DC1E8B43C574DA33DB0BFDABB4635A33DC8AA703DB6289BBB2E7A403DC1AE43BD9836983D8FCB0EBD5CF905BDFAB4613D646DA43D210EC03DD03B41BD277491BCBD6781BAD0B0243DBF84353C822C5EBD5BF92DBB0627C33D0E6261398DEA153DE543F43C61B53C3D993E47BC5548953DB3E34F3C022FAB3D7D3EB43CEE11173D981E113D8A085B3D9E169D3D3F52593D803D4F3DE2B79ABD75A470BDA1A7903BF30287BCC9AD6B3DB5DC9C3DCD644BBBD1C0CFBD02CD083C715A2CBBA043DBBD07F00BBCB5E41DBD3FDB4D3D8D72913D86C5883D66FF62BD6153403DC424BB3BB66552BCFAF7D3BDCD499D3CF56CF8BA5EF2B4BD6DDD27BD13CD35BD5E70D53B3615743D9498773D8F68743D47E701BC7665713D9920013BA54DB4BD32BD3B3CF0BFA0BC8107DD3D057A29BC1FE67B3C20D077BDADA059BDC03033BD999F1D3DFF0AAD3D31654D3D699135BDB65804BDD19384BDECC51FBD73B4223CD51C5B3DD07C13BD51532ABDD6B689BD24C9A13C28BE23BC7553B53D3493893D29B7913D60CB6B3BF534853DFB0BCEBCCAF378BCE41FA0BDE9F9783DC223403DBCF54B3DA8CA693D1A0D03BD02CD5E3D07DC9DBD9C5B4D3DAFB2CE3DEA1B11BD25BB5EBD8AF5FB3C92BF1CBA3B2818BCDD8F143D9B9C6D3DAA8C883CB22F37BD8908C13D73602A3D95EEB4BD192CD53B479DAC3D47E059BDD99AB2BC84BF2A3CA95F3DBBA8EA37BDD07A293D4586313B9D09BA3D7964763CEADC1EBD725CA03D6BA306BD65D3223B21B7DBBDB2E572BD8BBE99BDEFFEA43D8071B03B568EA1BCE42D60BDB5E4E83CBB69903D9D059FBDA6289E3CED0EA23C0D76A33D966ADABD4077543D9EC66DBDBE27473C828CD73C692C43BD2D4F42BD9B7EFBBCC4B310BCB890C83D16F20EBCF7BD453C3C3C44BC5E42C6BD8F0A3CBA272E4E3DEF22943C0EB79A3DDD1729BD2995923B3CFA0C3DDECA8EBD753E80BC030582BDD5C404BC29645D3C5E2C9FBDB15E563DE0D0E2BCBB3F053DD9C9B23D94021D3CFA003EBCE492BE395FEFA9BD29BA783D83D4CCBCEED2C2BC7A9735BD5D97203B355118BEE4F099BD4D62BC3C630A72BD57073CBDFB13583D74F0EB3C412D8CBC3C697A3DA094693C40253DBDB6CCA9BAD2B7EF3C1CDE853C745908BCC319273D86E7B63D0C127B3D110FE1BC64269B3D06EABBBCB848333D6C174BBD3C36123C7B98423D12DA503DDAE106BC88E42F3C98AF03BB28C72A3C1CF198BD510075BD9F3C503DBB72BF3CE7C446BD4954D43CB2158DBDBF500E3C627CDBBD75B887BCB1D60E3C9EC105BCEF22E43CBCCBA6BC4FC863BCBA44483D5D3B88BD77F524BB8FC32A3DD79464BC97A57A3D019B3ABDD19709BDF888033DAF85273C14CE3E3DB4A1323B18C5413D3742013DD5F531BD83D3F03C73B884BD147585BDE37D2B3D03F65F3A32CF8E3D2596103D532B35BDF94B753C7C925BBDFFA94FBDA9FA0EBDADDDEA3C06E7703D7564433DA427E93C2D1E213D72BE1C3D2289F63C6DFDB73CF983663B672A0FBD956C8ABC352D753DCD13883D57BA9E3DA15F2F3C2A897C3D96B3BCBCFC27A73C4C001ABDB0E233BD7250E53D419415BC8AD3AE3DA66C1B3DFBE6013EC36955BC260B21BDDA615FBBFB5587BD06659F3C6A52A9BDE5D6A3BC6F239B3D8FEA803D2B6CE93CBF69773D0329B63DB29427BD1D97AD3B8AF5703D638D90BC6CC2223D36E589BDC672DFBC228545BD0281863D68EC103D729A73BDAED19FBD76A99C3C11C9A1BD045C463D68D33FBDAA3DE23BFBAC97BDC1EB2C3C583300BEADB92FBD2275B93C9CC0AE3C89DE16BDAC56D93CFB157C3DDBC481BDE9F2633C9DB2083D7AF653BD519192BC48005EBDC7575E3DA4F3493D3372683D16965C3D35D5B63C92D472BD3C65B43D9CF9823DB16DBEBDB0BE50BD6D53D2BC9B772C3B17D0953D722A4DBD94F5CBBC4A135FBD965260BC693E8EBD4403843CB60A7E3DE69E553D99E778BD28DA7C3DB8F8C33BFC83F3BC54E1D7BDA0E3663DB9D6C8BDFA0863BD175B063DE487383D6A575CBD5282BCBC0760533DF8BDBA3DF67F463DCF9E273DB04C923D3427083D287C103DFCADA93B87B3823D28DDBB3CBE2DCD3D492E953D7C2EDDBCE5E948BC31A659BDAE19863D807913BD0FCA943D5C0B80BC00219F3D2AE08A3C81984ABDA772FABCC25DEABCC5FF483D6DF826BC9526913C74859F3B8CFC293D85A4B73CD6805DBC30E77DBD1D02743D6543723B2B55653C9361213D8A1638BD9B62C2BC07FA333D9B7E74BD006C5ABDF518F63CEE2ECD3CFC6706BDC8F747BCCD34E13C210D723BBE01B7B89D35433DA209513D1855B23D0A50963C191B15BDBD64943DB5A74D3D3B8D5C3CE08E3DBDFC62E23DFAB6963DFE16F63DD6C014BDDDD4EBBBC0B37EB66895C8BC05334DBCC9033A3D77022CBD7B68973A6C1B55BCC982213D44CD30BD38AB9D3C6EBA803CFC17273DCE2AA8BD501F8B3D28457FBDF0F6493D789EA13C5C399ABC25BB9D3D7371CDBD76EF66BD67D0C1BB8F0E29BD467A9D3DEE9E303CA7A4BEBD7B19493DC4236CBD3343123DB5D7B43CD25314BD5EEC2C3CA3DE493DE6965FBD111F9BBDEB9C8A3D94B4FC3ADE9BE5BCCC81D3BD409AB83D0314EE3C62E0CBBBB6C542BD2B1B9ABDD5768B3C590C413D048CB2BB4DEEED3DD5E5ABBC621FA4BDEF5489BD13D7623DF6B83D3D5DCF083A76744F3DCA2517BD2370603D5E20C6BC0232BABDBC38B1BD86B6C7BDF811D23BE890743DD35E0EBCDD17C3BC80863ABD6CD83E3D86DA9C3C00855C3D2136B5BCA4838C3D534BB3BDA164583B732119BDAEC4B13C9CBA44BCE4F4A7BB17DE593DE8B0D4BB113C55BDCBFFD13CB7550D3DD1E3633D513D97BB71F06EBDBA76633C6AA74A3D94DDC8BBFB982DBD1B54D33D9631A2BDD38CBBBD3B26A73DF3CDEF3B4B70B53B10B8D8BC8A46EC3B1547EEBC68B55BBC4EB8053E63F9C03D7F7315BD932CAB3B3BA90CBC21B18F3D5957A0BC707B213C3DD5BB3C3053B3BDA97DFB3B7D8B96BD989033BD6BD9133EF38BA83C78989E3DC56E09BDC5EBF93DD11D0D3D936714BDD2477BBBAD30593DF05C7DBB3FCD3B3D522578BBC77E3D3DE3E8053E0845233D0DB44F3BD51BC9BC199D553D5904143B83E906BD4F05B7BD7AA9C73D7AA493BC3820F7BB2153003D480C70BD38D2CC3C78C9D23DCEA8DC3BA1A6913D07438ABC55027ABDB34CA23DA387A7BDB1C5973CF76BBE39E2D3283CA3C00CBD191B963DC8DF9DBD67D536BD309871BDA4C24C3D41A173BD1DE2B13D1EBECB3D76195E3D2652D93D0592AB3C810DFDBC0278A6BB868B58BDB46327BCCD83BEBD9B42CBBDE02C8D3D0B21543D5C29203D434670BD62F15DBDE6E23A3CDDA9603D658E8D3DD041E83DBF26FCBB2297E43C4FB9E23CB316643D6C75773D371A803D3AEF9CBD384B96BBBAAE593D0DEE2CBC86E8623D7F36113D51B9F2BD27ECAEBCC9F4943D5A0736BD958A8EBDA486E63BA8D93FBD8F07003C1A42423C92F3DFBBE41AB23C91AAA03CCD0F3B3DC4CB3A3DDF71EB3B509C13BD5D84443CCA97043CA78CE0BC32D29D3DC3735FBD4F04B03D375A00BD67D8DE3DE49F7A3DD050363D42FF9A3D757C4BBDD6F010BCC1AEAC3DF39C4A3D3FA3D6BD83D5133D3ABBE4BB1024543D8ADE2CBD0C5571BDAFBDB7BDF264BF3DA2A6923D7B8B213DF05E8FBD6D50243DC6DFDCBAEA529E3CAEF488BDF6B4BF3D8D579B3D9179383C958B893D1ED8AEBBAF2355BD9652C43DCC75813BF487C13D301DD53C7D0A1C3E3011B23997A8B13CAC8BBE3D3E1E5D3DDD8168BDAC64AF3C425D323D50272FBD46488A3DFF88C73D61BD593D0CC739BD7B752DBD456CBA3C2982353D637C28BDC714203C816084BDC42BF3BCAAB7A03C62B7B33B5E79983D7D44533D2B8CEDBDA341A73CBAF694BB91B1A0BDE636F0BC2373D4BB83F653BC9247B7BDE92F5F3D05321BBDB5B1C13CA3260B3C887C453D65D2303D9D68FA3C788E5A3D2B8F893D7B7A00BA6E2C92BDC180CD3DA5DDC5BD5B51853C0122283CB8C8CDBC494CFA3C640801BDB232AABD0FE121BC0C13533DDF6FC1BD1BF4A9BD521AA7BD09E7953D0E9A053C1C53E93A0C30AD3DF99E47BD2F22323D4C2FC13CC2FBA33CE49D293DB7CFAE3D805F0F3DCDBEC53D13361E3D17FB863CED1C06BD525F693CFBE109BD28B72DBDE001AB3CAB963FBD1D87A03BE9C7DDBDC51FE8BC61882DBCB58F823D1689263D24962B3CF158803C4ED9A13C485E823BE55ED5BC873C683D823C07BC34F6C53D0C5BC43B5DB359B7E7F8C4BCD352393CD1EDA33DED1FAEBC4F2C683CA3AF9D3DBE86A93DFDA63BBDBEE4373C4163F1BCF2725DBDBC9BCDBD341AEC3C03F7623DBB6F9D3DFCD5243B30E227BCD752B2BDE62AC23C63DEBB3D294FC33DA22F2A3DB92CC4395CEE6CBD605C80BD6CD7CCBB04BAFE3DDA44CEBA7C1D10BD46EF2B3D0713DC3CFB4D98BCFE57033E9EA8CBBDB37CC83C267775BD02CB95BC1012913C3B061ABA4842C73D7A7978BBD1F814BC3920753DD0E1CA3D1422323D67D0E0BC1CE8833DD0B4653D4DA2A2BDD28FF33C4967A1BC425EBEBC2EEEC23B21FD043E9A2006BDE894383DB73E5C3C1BDDA53D0FDA953D001817BD5A393B3BCFB3D8BC4D8B353D0C63E83CF25F333DC5B93F3DAAED163D18BB79BD7947863C6305A8BC448C8BBC86A5953C9565CB3B322BBBBD2D541FBDF2AC1EBDABAA10BD6A3DC33D13D5623DF1ECF63C17361FBBC4F7F8BCEE91683D1ECFB8BD83598D3C401A4A3B741FA9BB79B514BBC76983BB983EB8BDDEB6343D835799BBBB31663CA996B93DD99010BCEF26E63C803F883D0B6A9DBD5E0625BC0DFF853D8E5348BD48CFDB3D34246F3BF90550BD94ACCD3BEB56ACBDF024CF3DFADB53BD91A2813DD5667ABD576679BB220F3B3D025062BC4322BC3C2E4A093DE7D12BBD82DF28BB041B633CD177893D1E91F8BC894F4B3D518D8C3D011784BD97C89DBD4B6172BDABB3CB3A59CC84BD2C6A6BBCCE536B3C2B684D3C7DF888BBFFD8D23C92656C3DD32C47BBBBA9183D814EB63C27D54BBD0367663DD471F23CD47514BD39F26C3D57C1863D69679A3DA56B883DEF125B3D186CA5BDFE0D30BC9F98A53DB54F05BCA016783D095C863DDA8567BCA7CE173B84C69FBC3D53D23D64DE013C0D5062BD264B3E3D49F6BD3D0AE793BA0FEB0BBB10AF6DBC2A93053D966B74BDCD051A3D75C020BDFE6C463D9320C73DFEED413B22EB0ABB2DD40C3DFFC613BC8B685EBD11020E3DC287CC3C9BA77BBC7DE9843DC52913BCC30A20BBD73A9ABD673CC1BDD824843D46C50A3C0A1A4D3CB8DBC03D4864473D034F5DBD58C89CBCA0B800BE966999BCC29923BD37F6A3BCDCE5B83DADB5A0BDEFBACCBC8DD072BD5338353C8F18AABB98B3DD3CC65B813D5F3BBF3D270B39BDAB1C873D2E2D68BD98CF313DA8981DBCFB4A1ABD9A5D21BC7A10403A5BABA43BEAA68FBDF2D127BDEEB681BD82FC4DBDE6AD86BC353CD33CF892A0BC4B9723BD5B0C893D7D6D223D457C853D4090E2BCE0AA80BD5B0D113EABCB25BAF74B64BC31B8F83CBE43A3BC01256DBD9192403D7DA322BD0954FD3ADB6B66BDAFDA66BD1C35BE3B7CFF913D1B4F983AF10A38BDFF03883DB290F8BC5874443D7446AB3C4FDE423D0196A43C36D786BDF4CA9C3DE2BA313DDFDDDBBB1A293C3C72DB723DA003063D2933B5BC50D310BC5FE943BD345322BCE739FCBCFC240B3D8776573C736030BDE0C7F0BC3ED35A3DAC7614BD37FEC93CE8D9C8BD1907ED3C95B79FBDCF4685BD2D0C8B3C23F50A3E16CD45BD62DB013DEECC13BDBCCB61BD1803AFBD9E95B2BCDC62F03C6CB4AB3D822D2FBDC94697BDBB7742BDA64EAFBD3B2A3A3C652F173D61F5963A655DA63D13CEEC3CEA21803C6AC3C8BCF6F0033E1F641E3DF2DD19BDA2BF233D0F63ACBD41E38BBD4E3CAA3D9F1080BC6812BA3C49AB14BA3C949B3D53B7A23DAB75CC3CC9906CBDD3AD88BD6AD0953DCD9E6E3D129D253CF2B601BDDB8984BDB1939CBD0D6D53BDC671FB3CE256573CDDCF793D2C6221BC355F3C3D077F86BD2A5CB7BDC1E2213C103D5EBCEF4F53BCE67B50BDAC0DCCBDEF8ADEBCC16EA23C602E50BD38C1843D53CD24BD7B3D91BD0BF5FABC086B343D0170B4BDDACA11BDFAB592BC7FB0183D021C153C8BF5273DD7360D3DEA194CBC0251C03CABCAB13C8B7D3ABC944659BD0F72AC3B7B5A9ABB45127D3CE1FC9EBD6C7086BDA6668DBC16918DBDBECD993DDC34A9BC6558BA3DECE9F83C7763AA3DC43799BDA855A2BD71F7AABD0FCA963CD1AE11BD53FDF7BC2835A93D5F34C4BC39FA273D655B45BDCA8FFD3CED24AA3DB09AAB3D96F50EBDE142F63C7CA9DC3B53B7A9BD73A7B53CE340A23DFC1B003D94809CBCD732803D391379BC7DADA53CA2C6F93C63B8FD3BBA91B4BD0643E7BC4092763C6A7AA73C4A2A573C11B3D4BCA60FC5BC2ABFAC3DDA128DBDCC97CC3CA8DB473D34A78EBD81D979BC3951B3BD8A77F8BCA090A6BD76B0073DB19D33BDEA23B4BD61A7D9BCE4A6C23B6DCC63BDDF6E973C7382FA3C43B3FA3C355A3ABBA25F13BDAE7E82BDCB393BBC064EA2BC77272ABCE32DA33BF3C2C93C5AE7403DB83B26BC84FCBDBDCB82AABCA5222CBCCB946A3D174C2E3DF9AFBABDF9B1C0BC7B39F4BCCDE01A3D3BA64ABCED2C7FBDE8D96F3D57DDBDBC2EF7A33DD3677E3DC1F1DDBCD7747B3DD9BE073DF2A676BDDC2C86BC744D90BDE6B17D3DD925113CE1B582BDA3228FBC50F01DBD062D803D995289BCD5A314BD0AD7D63B9255693D26D9943D4144033D7EF2943C0702603D0AB02A3B955D213C674B4CBB7BC16DBC1A8DB4BD183406BD834631BD5E083EBD75AE503C43DF34BB872463BD6CF09B3DA1E967BD566C4BBDEF6021BD3577583DAF6391BC0828333D47FA113D198DABBD4FB93A3DF92DECBBCD63893D95EB203DDCAA8FBDAABF413D12299E3D050BAA3D4B8A5FBD6916B2BCB4FDF3BC207C12BD529449BDEF4F60BD10F6F93C9E019C3DFFF2CE3DD05627BD7F30A5BBD25BD83B6C2484BD089EB8BC13587C3DF2BEA83BDD30913DC26DDCBBC441C43D7374BCBD649584BCCB2818BC2F81C13B7C746B3DD8EEFFBCEA0355BD89EB473C820894BC379ABE3C286D1DBDC61160BD9D01A13C3BAA173D3C0C8B3D682A873CE64D02BD2C1B8FBDC8934CBB4CEA36BD010138BC8541253D4561B9BDABAAB63C0BDD8F3C829974BD12C8A33CA3F5963C7A7595BBCF4B9CBD6031E2BC6C8397BC884E46BC049D823D5DB4513DC9A4663D9A18673DB151EB3CB82797BDA181D23CDFC49DBDAA5D923D9D9E9C3D5338773D5B93923DF28D5CBD0EA384BD6C84513DE606A53DF8637D3D049D6FBD563199BD0EFA6D3C3C9C9F3DE5CB503D0484A6BC0744D83CBBB4F4BB2BFD2BBB41B9073B1DC115BC785FB03AC03C553BA719CC3D657257BD7B1D393D3F2E743CFF9E723C261CC33C1ED20E3DFC749B3C7DD94C3DD5AE693D82617E3DEC45B8BD4951BEBDA84A6BBD45C13B3D2D51703D5F39053D0EDB2E3DD1B66BBDE225A1BD916A19BD1B09513DE153453DC0AE3F3D2211293D819A7BBDC8F339BC4BB4A73DC4B43FBC42153C3D01507ABD6A586A3DC6E9AFBD79692BBD2973C1BB7D855F3D4DB54DBC6C72C3BD2B644BBD71E7363BB773D1BB271F083D1B3C1FBD37FC233D444F873C69E4733C45B385BD8BEEFD3CD06D3A3D93E3993C4D708B3DDF511A3DAD5070BDBAA12FBD4EFAEFBCDED5A1BC2F9D2ABCCDEC453C2EBFBC3C183B52BDEC77923DDDA6773BAEB75ABDD19D913D233B8D3DB0D27ABD0313743DB0CC06BCBEC9003D44472DBC1B76BE3DCF0C8C3D74108CBD1F5C1C3D4B40EDBC7D12223DA4A2E63C91A4A5BDB5DE8ABDAD0B513C992F18BD29ACED3C94C891BDD689AABC77C02D3D4E1431BDDD9A783DA4EBF83B50E4893C1D376B3DE3D22F3D307D04BD7DC1D03C177A19BD6300ABBD2FDC43BB2B244DBCD0963A3DBE3A1BBC6DF69FBD59E4513CD47A8D3D6664463DEB31493DFE26B7BD48C984BD14F0663C825D0DBD06498EBD7B4EE43C36111D3D6C9140BC30F7043DDA2F963D2C1E563D0F182EBD3CE493BC8B2BFF3CEC67BA3D64E591BD47F8BABCA53DAABC4E6ECA3CCCD6F23C85ACCD3D62B106BD25569E3C73A942BD2545AE3D323B3A3D8FC08B3D042F35BDD76AF43C397592BC5B9380BDD6C5AD3D513F343C117A23BDC827AE3CC0755EBDE557753C303F8D3D228B313C22D9A9BCFB81483C8A89D73A8D35533D44B1C2BC82E4043B4DAC873D80C118BD0539F83B016377BCCE0BA33C5C050ABDF57F863DADE184BCBF684A3BB02DDA3C7CB160B9B71118BB4E4244BD02EF51BBD030CA3C60D770BC9868263D392C383B0E51973DEBCB30BC5BEC933D8406823D8A34853CAE94A9BCB98F8A3C474199BDA5319F3DB80C3F3DCCD4EC3CE45240BCE824723C25CEB43C943BED3BB07E963DA3155F3D52CD9F3CA1B91E3C6B80A13A519D6F3D79DD913D5A4549BD335F293D40E9B0BAE65E4D3D185AC9BDAC93823D4CDE2C3DC5F8893CE482BB3DB5937F3D6039083D83C75BBC7BF4CBBC5F8EC83CC28C133C872EAFBD914FB33A691189BDD1AF6A3C833A173D509039BD4D43F43C667CBF3DE9AC5C3CB5ACCEBB54193EBDD9C769BD7B6B0CBDDD655B3B8319B63D2F508CBD7C52573D146F30BDABC77DBD42C61A3D865D173D590A053DE86C393C3F7AC43C304712BDC03F303D8A53AF3DC1E69BBDDD7C9EBC3548223D0B969EBD476804BDE5525F3D8448073D21177EBD2558D1BC283A563B37C9923DE285F13BAD08F83A3E11A6BC04EBB23D8C6B3DBDAF2C323D39BF043D9A5457BD75561DBDC8A78FBD7C14B53D8735533DFB346C3A45D6B83D64DD773CAA5286BDE7109ABCF92A7DBDD24F053B96B59C36FEFC0EBA79BF10BD2908A73DA204A7BDAB107FBDC4546ABDC34F3D3DDD7E9ABD50AFA6BC70B4CFBB88A9A6BC866751BD35735A3D1751FC3BC63330BD85D8913D7D00CA3DA78315BD8A7F3E3CBE295BBCFE790BBDAA2C713D17A1AB3C1B1232BD5A58083C09D4123D57DE2EBDFD3712BDA211DEBCCA7FFF3CFA7CD73CC6CF2FBB7C61633CE6BE07BD8C806FBD889185BB90C070BCF67B043D0C3B2D3DB5F5823CCC4D94BC8B26583D7D208DBD854D5CBC393813BD40DBBA3C6B78683DFA91C8BD973738BDE5A44BBD6442F83C9145443DA3B768BD237DE23D29D8283DF0BD4F3B98F1CCBCD6348A3C2A7704BD9416CABD86F28D3CF5C5053D9093DB3C1CE18B3D933AB5BC3D8270BCE8F92F3DDC4BB1BD2B319F3D74E52DBC920C8B3CCEAB5B3D9DEF423DD26CF03C4236793D679E363BA24DE1BCFA92D63CBAE4013D873982BDFA290ABC2492B13AEF3588BD687E85BD834584BA8DEB19BD1B1C923D88BE5E3D23C092BD007064BDD8C0853D9B1A903D9B540ABEBBF696BDE1807FBC0CD7903D95FA303D56B88ABDE8F31CBDC0970DBC5270DBBD069CB0BD4B34043DE9590D3DFAB85D3D1BE54DBD1DAB32BD3C2F023BD297693DA03E9C3D0DF1E3BCB14561BD2EA6273D9DF168BD3A355DBDFF9CDC3D697EECBCFA52A5BDEEDFA0BC0A9BAD3D866FEC3AE7FC23BD62CC793D7C4B3EBDE2E657BC6B626EBD7EE1DC3D3AAE2A3DE52C513D83D4EC3DC5DB303DD6715C3D16B608BC050ABFBC4004023DD77597BC3429CF3D0E85E1BCB5D033BD392F143DE0D89BBC2D1E7BB8541E703DB8CA6D3DC254EC3AD6D39C3DF7A3A5BD6E176BBD170C74BC45F76C3D27867B3D4BA1FCBC7B658B3DA43B94BD4597483D3ACC0ABD1E3464BDB7227C3DCF5F5BBC0C00943D227D82BD56B49B3D62BDDF3BFFDB9F3DCA82B73D2F98583C39DBAF3D42B9C7BCB20D2FBD902F0D3D299D8FBD4E25293C53B6DCBA1112193D67AE20BC391142BDD75B32BCD640643D16B8C3BC2D47743D342107BD71B33DBDF293EB3CB4F9B1BCA396233CFA6A9D3D1473903DFEC5B3BDAAB172BDBEFD273D7160A8BD2B4F09BD8B4B853C6FEE963C46DC2BBDD084C93B2324763DD86713BD6D9059BD9E5D8D3D25DC463CF7D9913D1C2CABBD11C18FBD8E8D8F3D24C6DD3DB4343FBDEC0402BDFB4F4BBD85A1943C833303BD4580CEBB213AA73D1BFD71BD8B191ABD51C39ABD9D4F6EBD4875B1BD203D96BD8EFB41BDD1219DBD632DC9BD37D5D43BBD1CD63CE641973D6DA91CBD306DB43CD550ADBD577C9A3C2508783D1BB1393D6243E7BC5D36ABBD88F396BCA9D9A13C12B2A63D381B18BD1F416A3DEF4B1E3DC2A2993C6E7B913D6AF29EBD6A242C3DD88B723DBC6DA73CA892CC3BA239F8BCB4E3A13C7FDFB2BC5752643CC6C48F3C9C9187BDD4D5743D9607EC3ACE630BBD2EDA803D7F4014BD71BC34BDC9BF40BCC13B47BD6FE28EBD108C103D1F7A99BBC53E893D913D4BBD87CA593DE696B33D0B7AE2BC4758E1BC12E6463DF3E1CDBCDD883F3DAB69D63CAF6CC039709D0EBCDD37D73D0D7CC43DEA42B3B9133486BD852E59BDAE90A7BBFD459D3D53B37ABD5CE9333D40E8853D100A9E3D78C4373DEFBC873D560175BD1072BA3CF4440D3D18DBFE3B215B29BDD38942BCCD62C83C5DFDB93D403260BB9357BEBCD0779CBD800B8BBDEBA180B94DFECBBDE2A5593C234CC6BB577B473DD696823D91C3523D041C283C043B2C3DB519AEBCAB4B663B7243EEBA956D433CF8B031BD242C983DF08B52BDDD9F78BDB6E4E33C417D83BD6CC5AD3D59DD813DB44441BDE1BAF6BBAAD1C3BD6CED2F3D99599FBDA803F3BCE748CDBCD43BB2BCE5AD293C3921793CAA4942BDE814973DB934163D73F4933D57C4BB3C5F168B3D8D228BBDB1A15BBDCFBC4FBD38AB6FBCE9C70DBD07D3A43CC3598FBC153F6D3D5E4E5E3DF3C091BDBB4ED13CA2CE033AA3CA543D85CD07BC8FB08C3D534292BD5F41873DB665BFBAEC9191BD9CC4B1BD1B02883BDDB7ECBC57FC313C8B4417BD8A9B883DAB8352BD1781A73DE0E3093D8E83C03B40C6453DC04EEEBB5EB168BD586B383D7CC0F33C4C74173A22EC11BD30ED1EBB88B9973D21D769BD0F9C66BC9E0ACABC79B4893C3AFF44BCE57D9A3D84E222BDBF8583BD08205E3D4493F4BCC23C5B3D028F68BD3E89223D9E1652BDC03EB4BD9D9D02BDF39BF8BC07ADAF3D9DF4F93C6B334ABDC33B243D276041BDA36675BD2E0466BD81025BBA7F45143DBDD254BD0DEFF83B7CEFC43D3E2523BDAA6D9BBD5019DBBCF90E02BD213F2E3D14EE5A3DE4AD553D11721FBDF4C370BCCF397FBD1DE7113DEC0A313D4B31963DF7DE52BACC43D7BC75183ABD1C667FBD45FC8F3D8C91843DE53696BD22C02BBDD8D4D1BB659B4ABDE07B743DE3AB2B3D4A695E3DCFA9133D6BEC4EBD525497BDB18B413DFC7888BC583F763DE5F77BBD5B19103CDEE2733C37BD7B3DD5F008BD1892B33C3276413B2338613DECCA20BD4943493D79C659BD5DE0873D3EA6F73B9B8D783DDC548C3DB201DBBC6FCA9B3D4D8B11BDB7AD903D464D9DBD995A313D4CDAA23C56A2CF3CF3209F3D8EE19B3D508F0ABC547D87BD0E87E6BC1211DB3CD9C4633D5C9590BD6B895D3DCC9433BA881AED3A2E12F43CA25F703D98C543BDF3AB103D60E899BD4C06863CED0505BD9E02EBBC644C373D93B0913D6C7091BD1DCAE23C92E6A23DFB2DC1BCC9A11BBD07D0AA3CB0EB47BD389B32BD4A6FC43C1367333C4F0DFBBC47AC8BBDD17AD3BC7E0B78BD28E5603C187050BD640D01BD165CEEBCF138323DC7C14EBDB46B883CA010F23C73AD7E3D2D039A3DB7C2A63C9E73FB3C54D7F73C64C6773DADC4063D397A45BB6B79153D05E9553D38BE8F3DA32BA63D66FCCD3C6D5DEBBB4158E5BB9DED813B15C885BDD2FA6C3D4DF09B3D34E7863D476B433DD8D8903D757E353D1EFC973D04FA5C3D70A9D53C3FB139BD77AD8D3D77EB54BD8A97043D169187BD0F3D253D12DE213D907D08BD8E0C543D8BB3753C8D654CBD3A79B53C8D830B3D9B6A44BC91E0393D3CF8B3BC9A5547BDD25F803D059F243D836694BD6A3A26BB8819643A7070A0BD51B275BCD5C96FBC16E9833DFE3B2A3DC650343D4AE5523D0FF52ABDF6B0F1BCD93845BCA03DA13CDD7EA33D3BA3833C8F05543DD687063C628F603C46EF5ABD7EEB9EBC42BE91BD31AE673DD0072F3D413513BD2BBA963DB2AD903DA927CABC5A74EC3C83E532BD7164613DD55E75BD8699033DF7FA4D3D809129BB3572393BB932123DE20E173C55DFD1BCA4192CBC26920DBD16CB50BD4048123D200B15BC8B3CFEBC680676BDC50DA43DBDC2F83A7971A5BD8BB3363D7539293D3EC781BCDA17A4BD5CF86BBCEC958BBDFA71193CA25321BD44ED83BD7A9ECF3C3979ECBBE1B02E3D38A7123CBD6B0ABD9F0430BDF201313D3B0B273DEDF483BD8FB4073DDFC175BDE71CE8BC790C3E3D9DE2DB3B3C00203DDAE171BD8D03D53C905B563DC90D4D3DA763073DA6E1973DD0CD9EBDFC7779BDA57D7F3D8AD415BD721E52BA659C8DBDA862A3BDBDD6063DF5CEFBBCFF58243CEAA8B73C53572A3DA354CB3C52CA41BBB891CF3C2DA8E33CBEB361BD703903BDBCCD8F3C7CB68EBCD18C963B86AD5D3DCA8A953D153E96BD5C3C7A3DE8C2653D4414563D8344F93CA94A273DA4027EBDB3AF3BBDD8A724BC5120DDBC5F61433A449D943DA81E1FBDC5DB83BD26DD32BBD7BB943D56577CBDE29C4CBD3CC1533CB05BAFBB137D913DBCBA86BDF9E66ABD486DA33D0274073C3A829FBD098F943D16AD56BD6BAF6ABD6702703D9C6C74BD51389CBBED98D6BCB0A5A3BB6E18EEBBC4CB51BDF2D22EBD19259CBDC5D9DFBC3FF172BD24D7F73BC211383D95E7F73B0DF9363DE8D588BD74F63DBDEB9412BDD72784BD91EB83BD31AFAFBB4DA28C3D3190B93CD112F1BB3096763D73249A3D1E2D52BD42F5A1BD7812F33B9350283ACFE14D3D80A3B13B14323EBC225759BD303AF43A50F56E3AC974EE3C6375353C68E432BC30397FBC4E54603D80AD133D3267A1BDF9D28CBDC640483D60B802BD20D7013BB45022BAEA4A123D38357ABC3DAD3BBDD9F550BD67C22B3DC21E88BDF31458BDA05A9BBD69941ABDD34EDE3C2C8D4FBDAA29113D9CA3AC3C1CAA4EBDF8258A3D43B1D73C3476A1BDCC3E0B3D76D640BDE0A32FBC3C588EBD2ACA6F3C50679C3B09D4B23CB787823D0E063CBC13D6863AD1C4953C9E438DBCA15D84BC80248DBD2F9241BDB04F803CFC64A0BD16A56E3B5779BABC74CD55BCF71ED9BC281A83BB778933BD3F1C69BD3EFA1FBD806E903B38C0833D20B5CD3B10D09B3C977833BC91913FBB4E0E95BCA4C1763D6BA69C3D9F9EEA3A638A7BBCB0E580BCAE667ABD717192BD325D603D97F4A33D300313BD30C19B3BFBCC64BDFF4FF2B93A76903C55B612BD6CC2C23CD7C5263C4E992D3D15E280BD3061B03BDA899B3DD8DE25BCD04E813D1938013DD645323DC182683CFBCB8BBD64D9B03B1946363D409E92BCBE6F533C74D1853C464789BD98C1593C2EDF63BD6494A3BD50B96D3D5C4C38BDACDAA53CB6745B3D8FCD96BD0089AAB9E0FC07BC380A8F3DD01D66BC0810C23C433425BCD50B803D96CF8F3D02B113BD1E563E3D156D9B3D33A1C03C9DCA753CCEDC293C8D60943DF5AA90BD0F3FF33C0F55B03C8327633DB59A9B3D40C6813DF565793D7278413B422F833D5AFA47BC91EE9C3BD8111DBDFB599B3DFA33363D62399BBC81FE203D148D5BBDA8F392BD6CFE703D0DA8A1BC4F7D923DBD7935BD556E843C0CAE95BDBBCE5ABCA067223D216E9D3D62C3353D5C21833D2F6BE13C3E6AF63C93D5D2BC4BE88DBBFB9760BDD7731D3D0C93953D84F93FBD9CAE963D6519D03C5B6CA3BA900077BDC13B623CA2FF9D3CFC31C03BF1C498BD5374F93C27F580BC11ACA3BD5C8414BD0F28D2BC484DF8BCD6C69A3C4BE43B3D795A89BDB08F49BD2BFF463DE5EB4FBD693A8A3DCB532ABCD0E79B3DB81593BDF2AD8FBD0036413D569C6EBDC2C1B53C8106543B6FC3383D39CEEEBB2D070F3CC9BAC5BCDECAD53B596DDCBC84C500BD56E3A03DFF473A3D703322BC629B56BD2FF561BDF9C17FBCF0205BBD7F49B23BADF0953D7EB0B9BC8303E8BC17257CBDB4562DBA3ADC993D921235BB7B3F2D3D7D07853DAFB7943D725B1F3C90E3A2BC84C99E3C4CD422BDC92725BC94C3093D3F641C3D70BF84BB03DC6A3C8C6790BD300F3D3D001F023D1B7E83BD8D7E2EBC892E833D062658BB5549D63C20784A3CA15A823DD030313C456F0BBC92749E3D32F53B3D633E1EBD6576BF3C5C4465BD922E703D1468423DAC8A28BC04E148BD151CC83BBCD4893DC1D9783B1B187F3DEDEE823C6B7D1EBD293A4E3D089C3FBD809D043D8A4E35BD156AEC3C09CF13BD26308A3D891D9BBD2D6B1A3DE0DC9E3B5D85833DBCFB61BD64C896BDFB7C883DE2D90DBCA49A96BD17A585BDE3F9013AFB242DBCBA08883D2A34D8BC89A0C13C4C2D48BDCC9C9C3B9A045FBC53794C3C794AA43CE2C76F3DC90D75BD7DB35D3D5F38893D93FCB73C526CD23CF4BE04BD071680BC5C5923BD17A7143D555EA6BC6F294F3D310FC1BBBBF4A0BC434C8E3D72C73C3D08CD2B3D4C044B3D63C84DBD3CAC25BD582ECDBB45923E3C6931E03B7DFA383DBE554E3DFBA7343BC19C9A3D8B48183C2FF898BD7CE0A43D0E3EA7BC72C5923D922124BD0B75F7BAF778E2BC47843A3D066F3A3D3E2A4C3DC58D33BDECAC85BDC1EA6ABDB8F195BD3B68093DC2B4983D65E9373D59138ABD4A830BBDD126F23C1E8706BDF19EFC3C9FF1E23B24E05CBDFF5BB73C1C2816BD72BBB03C5403A83B9217573DED4C29BDCDB662BD513E623D860C40BD15A7803BF028CE3CA5D1A43CA231F0BCA5B566BD34A299BDB3D73B3D3ED88A3C7C67F9BC5DE2A9BC279A09BC3787683DF76EAEBCE6D2333C79FED1BC9B5DE0BC156DA2BDCEEF55BC4DED893BDEDFCE3CC90B85BC0F9299BC3E01573DA937A1BD0EFE363D062B8FBD23CB5F3D64CBFA3BA9ECB0BBE621223DCC5352BDF5147F3D7AD016BDF613303C7E46343DCC417F3DA2560EBDA7D68F3D0A76E7B9E3B1713DF4E4853D9B1F99BCDE495CBD588A0CBD0612A1BD33A7EFBC49977EBCBC832BBB3DFCFEBC333D26BDD18844BD50B06F3D20FA423D5C9783BD26AD7D3D82A5283D8885FA3C544DE43C275F31BD495F8F3CF8A680BDE9CE74BD2812D3BCA1DF79BD30EF38BD3FE93DBC50A4D3BCD700373DC78DBC3CA40E9F3CF7DE603C5BC091BC5DC18F3D00C4563D36C1613D7740CE3C81A19EBCE2C53F3D3AF1173DD5A2303C501863BDF66762BD2340E1BCE697233D2512333C4A61923D0DBF9FBDE847A3BDCD8E853DAA86813DBC24DE3CA7E33CBBB06128BBAE0F8EBCE45B9F3DE0EB603C697F73BC7940CDBBCAC2A3BD4EBE803D9390CFBCEF4D313D9F316A3D87F3723DB610D73C762807BC6D77E0BCAA3101BD23F29A3C280E4ABDAFF691BDF1C7983D389B88BD6130A5BD0C6354BD996157BD2E8C32BD766611BD55B5623D415D5FBD4C492ABD1799643DC73232BD936333BDC2DC10BDDFCC963DA74FA7BD13477BBD52D300BDC7C540BDF1C2E13C746880BD684B95BC171E81BC5DA89D3C762223BDC97154BD71882F3C67CA54BC7DC1A4BC6702883DE8464F3C2A3469BC83D5733C9E2EC8BC3911A2BD0554003D75DE503BA53066BD22E6BCBCA575233D592076BC99F64CBC5214823D7D5B503DC21654BD558EA43D4D3C83BDD7C0C53C8CA3433D7FA6A3BC053C04BDF41685BDFE56BA3BD2AD40BDBCCEFBBC9FA581BDDBDB9FBDB157B83DDBCFBFBCA348BA3CAA0CD8BBC65D153C15D7803DF017873DD2CC30BD94A40B3DA0E755BC386802BD32F7A4BD7BBA8D3D4AAE79BD4FD4933DAA5009BDC1F8463D641687BD4CC787BD56012BBD001C93BD4AFC263DE22388BD149102BD92C1573B38FC2A3D3A7E913D222D8A3D75268EBD6B4BA03D64F20ABC1A207B3DC90922BD50E882BD7CB7A2BD0C5794BD1FBD0BBB77A18D3C8A4A003DDA3E4B3D8AD0F1B9B3BF733DC0EE203C2F0DCCBC4B9109BD63DEA63C83A2D23CA242B9BC8E22623D447F8D3D2EB95BBDD8EA73BD713791BD54BA82BC38EEC1BCF15820BC05AF893A6829DDBCD6D25CBB24F2623DF8C2983CB60B14BDEBB385BD3005783DDE00AB3B431E903DA6F72ABCB9F405BDF984E8BC687DBDBB4F33973BBB2EEFBC73C403BDC482353D5E7AAFBD9264B3BDEC087EBDC3145C3D352C713DB8A912BD8D3C8B3DD5BA55BD239E883D50357CBC49267ABD9BFCF93C045F9A3C26643F3C2A2ED83CA062643DE7E02F3D5357263CC4D775BD821181BDAF2D173D6642573D562D973D50DA8DBDB993F73C6023A6BC98797ABD2A88853DFE55923D276F61BAFCE1A03DE34E8BBDAD75823D33B389BD3FEC283DAD6391BDE088723CE573D73DE98A413C4550283C0F806B3D07D31DBD444D84BDE5DFC6BB015971BDD5E676BDEDEB50BAE866993D208F77BC6104DBBB8E1A2EBCCEBE823B6C074A3DB92595BD9E8C503D4F3758BD18F8053DC841ABBDFC7C17BD0A5FB93D6B9462BDC0F1993DD7AB413D1CCB3FBD66D23CBDB278913D677DFCBC66B8633C44E07B3D8B1DB5BAB7F8D9BC72BBA3BDB2A5913CE40CA4BCFBFB1B3D3DAE3EBD08DA02BD73F317BD88723D3DE7AB5EBAAF154B3C780E893D5D7DFDBA31B08EBC239F1CBBC5B3A4BDE26F6E3DF76B803C6774C5BC97F66E3D7DA89BBDA89B70BD1CB46B3D7FEE8CBB20E88BBDF8F311BD1456873D8C336FBD0673543D141181BDDE849ABD18829B3DE25E05BB2856BC3B94CAA33D9D05A73A023820BD56437BBD8BB75DBDB8738C3C1B086C3DCEA10A3DC55A2FBD17A8913D8D6A6B3D233F043DA8ADE8BB0A0F583CE23E523D69AB93BB790D903DA926DBBC9AD09DBD1456263B429459BDF7E6CB3AEF9D68BD997340BDCBE4EF3BC34998BC3EAF943C5646EBBD751300BD7D70E13C7FA899BDD2479CBDBFFC1FBD18A9423C07C06ABA5CF4FE3C94D8C3BCA7F4C53C843819BC4BE03D3CF6018BBD0032E63BF74D81BDCBD0903D40528DBA52FE763C2D45A53DA99F783DC9F8883DF552A5BDEB1805BC0D7316BDDF6A8FBD3C51D0BBB12B3BBDAD19FCBCC598CD3C39E000BD0295C2BDE56189BDE51A723C1AFA3A3D20309B3DA0D9BD3DFCE0FBBCF00BB13C99CBB6BC56353A3D3634DDBC1E5F4F3B512254BCF0EBE2BC93A63E3D374C35BCAAE3DCBCD2FFE0BC3CAA5ABD2CA282BBE775CD3CD2526EBDF385CFBCC420763C6A8D6EBD9A501E3DE6F863BDED11BEBC9C150DBD92D5933D12EB8ABC0F7C683D2DA8963D0049ADBDFA79A13C9BFB5B3CCE0A873BAA5892BAEFBC883DF410983BEAA1A23CEFFF47BD60C949BD32F76EBDBFFB45BD129C8FBD3CF20EBD4316933D01DD2B3D5F67BFBB47A03DBDAD3EA53D9937DF3CCEE5E93C2FC46CBDD84C94BC42045DBCED78133D1D6EA0BD6CD1F23C6DDD95BDB91C22BD4EEB98BB20AC463CAF19543C6D03543DF8804B3D7F7589BD7FC82BBD46EF9E3D30AC903D2DF88BBC04C1D23D0C3903BDCD27E6BCEF081B3BD4F18BBC389AC63C8507CABD0B408D3D9B88953D0DA93D3DEC68A03DF494173D7932633C171B8DBC8CD7133DFD52933BFD3F84BDFB7E8BBD20CE0D3CC23A6DBD428030BD1046BD3BA1A1A7BD2CBDC5BD5627AEBC8334E6BD7BDEE1BC60AC8A3C410E203DC3FAE53C7FB44E3C31C196BD178C863D6D22B3BB00FE56BD45868C3D88E5813D3FDF693D3730093DA261B6BC8EB9413DE419CDBCD7293CBC029F9EBBA75B17BC060E893D88CC9C3D43F94BBD653EADBDD346963DA4791D3DD974B1BDBD6BF4BCF8C1393D38D595BD2FF450BCE7B0AEBC5F92913D01A9163D83831F3D992789BDAE66C83B9F8961BD34558DBDF925FFBCDD35453DDF5437BDF4944E3C5ABDF83CC739A53D0B43503DA3207CBD923EFDBAB8B6B13C6121853C81526ABDECE2283D676827BCE70F8C3D92FDC5BD974492BC81696D3DD618C7BABCC8D8BC4B2A263D07BE913DA72113BD4DF68F3D848054BC15B88FBD67B23CBDA48C5A3DA73874BD97879C3CB5CA69BDBAAC373D6ACF12BC6A42CE3CC51FDA3C6EF3C9BC472A693D0FEBE03C65B144BD77C8C2BB6D851ABC4D8D5ABA1FAEA9BDFF5E2FBD3873B43D9DC4CE3C02F9953D61CBD83CE7ED753D2184903DAD9E233DCF37D73D3D1474BD98698FBD9867863D7C7BC0BC6717A83D55FB9B3D2A2F8B3D915C973DF636203D63FC65BDEF4B32BD76994D3D13C6D0BC56B8D2BC80E1C3BCA23F8F3C2FD34D3C903E343D7FBD323CEE44093B018EC43D0A35813C993C43BDA849303DAD2DBA3BE086EBBD04BA663D44DD133D59A44CBD068C0C3D238785B9BFAC77BD515EAF3DE4C0F53C11F18ABDBDF3EEBD341F1BBD0D02883C9EAE1DBD72EDC6BDFD26BCBC45B373BD1A05103D10C71C3DA04897BC6B7C2E3DBF0EA73B2D035C3DD5ADBE3C840B4A3DF2C986BCF921233DC7EBDFBCA978833C8A5C41BD0C208C3DDC01753C1DB1E9BC9326B13DA05723BDEAB683BDDEE8A7BD9A1CC1BC8937463C3751523DD3E3943D1400303D8724A63C26736C3CD846023D9E1DC73D7494DB3DA9491B3D9A9FBB3D5D25A8BDC3A03C3B1F48A6BCD82D7A3C050485BDC7A6B83C05750CBDC364793DBE92013D7DBEA9BC64DEB9BCF985C23D6F8C793D95B54EBD491ECCBC237BA4BC6DAE8D3D06C6B0BDEC319C3D3343973DFC4E0EBDA7BB82BDDB7E6DBCE4FCAC3CA46F193DCDC48BBD7E58DD3C35DB8D3D94C8C03C96D946BD54E6E43B51A0733DF7CE413D958CD7BB5774933DBBAE83BD4498833D820C8CBD0EF308BC3FA631BD0EB78ABDDDF9D6BDF7D73F3DEBB4613CFAD4A6BD44C39B3DDE77523D5E1E53BC83A909BCE957703C1FEA9BBDA3C839BD44EDB4BDB93E2CBC6EA7283CDFD2643D92A085BDF60F503DF52EED3C5849363CDD601F3B706F2D3D7955833DB4300B3C236FB93D82D9C3BA7021BD3DEF5570BDED5E98BCDC28B0BD45CB3B3CF4C696BB02C3183C624DC13DC44C963D750E613D86E45E3D5EC387BDE7B7A23CDF495CBDE9D703BD83D6EFBC1800A5BD1DA5A03D20BF73BD7CD28CBD0964F83C056477BDE41A203DBF3D0C3DC97A393D73C6983D9A9787BDF511B8BD454DC0BDEB9293BD12D4B93C096E84BDA9CE0E3DE7F1033E6B6B1F3D72D43B3DF81E253D5081343DB6051D3DCEC81F3D0B4BA43D1FBD803DDAEC553D2FBD7EBC46B9793DB895853D0516853C1D0DE8BCE9583F3CA3462FBD110E253D7C054A3D8F7E20BD0F29833DFD9992BD5496343DF41090BDE085EABC37C37A3DFA114C3D7C378E3C0E43F8BC1958A83C5C45ED3CB7D5ACBDE2EA993C427C99BDB16156BDC66D233D0839B53C81A58EBD11BA5FBD0FDA9ABDFE323EBD8B0C883DF0A91C3D96E05F3C2AAA93BCC951AC3C058F45B9F11CAA3D0AC9793C05B83E3DED5E7C3D35B135BD6D6349BBF0A6893DE5541FBD928E5D3D9670FBBB88D3A63C6834303D1768243D4A840BBC0A07783C6DA5A13CA568243C6DC698BD9FD3C7BC3AA6A9BD9C6CE3BC35301E3D6B763DBD7CCC8EBC41A8963D81D6D83BB511503CC800233D34F8743D522525BD4D57C93CD59262BD1C54D53C0F576B3D426CAABDB682F23C0FE9B2BD83029ABDD0EE0D3D45B4DBBCC588CB3DC23830BC7DD3893DF792243D3637BB3D849D903B4E0D6C3D5323C73D60609BBC160646BDB76429BDB84361BD066EFD3CCE6B40BD088F43BDEC0DC33D9B0ABE3D3DAB02BD400F463DADBF593BF514683DE2C53D3C5E7C50BC970C3B3DACB94C3D54F919BD9EBC503D8319433D219A04BDD12110BCA174DDBDDF6B603D1524AA3C93549D3C73B4CCBC55C1A63C09FB7FBC490C613DBFF387BD4D92C6BB9C958ABCE9EEB03DB724933C8DABA9BDAE1D61BC039267BDEAD88A3C749CEF3D73F5293DBCFFD2BCBCFFE83C197A0B3DEADF14BD85E79D3D0292B4BC4691FABC1F16D03C03E209BC9412CDBC6A2AA7BD6CAEFC3CD038F03C8E73FDBC7FF3073D14749EBCE57D843D0342573DE43244BD28A0323D5B37A33D0CB8EEBC47BA9D3DCAC7E63C0CE8163DE014C53C08F729BD7FB7593D487D253D439A48BD0163A2BD402D503DD8650F3D66DC4D3D174ED23A57F09D3C2C67413D39BC17BDD9C4D6BD83D0763DB5CEFBBC81DAC4BCCCFA9F3DF87D8ABB3EADB63C0D610BBD2BD673BC96463C3DA5268FBCFDAB90BD32F52A3D11357A3CB81D84BD357279BC7FC5853D975F8B3B74F009BDFFA4DCBC8A4BFF3A8018CC3D7B4639BC5B19C8BC873D5B3CD23C9A3DA644103D65A246BD0B37BB3DE91FB83DD62190BD4F3DA7BD649ED7BC5C71D3BD477E76BD0622A13C15E1753D9E8E87BC3E2979BD6532EB3B0BB78BBCC9AD103D25AB5D3D0B052E3D3BE8293CE88E003EA55A57BD528E973CD04160BBDBCA8BBDAF3485BD127172BDBE9E48BB75B004BDEB8ACEBCDE8DE83C19223B3D4607C13DB48690BC03DEDBBD02A6613D7B4ABD3D30C61DBB6602C0BDAECB13BD305BF23B71618CBC53DD53BCEA57873CF1F847BD336B1E3D579D39BD584D713DECC1B2BC971A94BC9571003D0A170EBDABD5B4BC0F8EB6BDE79F09BD1C66593C55629CBD97C0BA3D60F57FBD1575883C4ACED9BC591754BD72DA4DBDBAAE8C3D13301D3C33D4CCBD509B153D699FC83D28919D3D604E8F3CCCB70FBD6C46F23D43A267BD43E890BDCFB80F3CAC91233CBB84E13CD54FC43D43F123BD1D569B3D05FAFAB9212D48BC40F245BDDDA059BD018128BDFD7E2ABD253914BCC7331C3DB21DD1BB8F24ACBBDAFCBFBDB99E7D3C5E93803D3C99013DAF22893D80536CBC78EBB5BD0E97793C4CED823D2467863DB6DC5D3CB0EDFEBCB74E633DC0B1043DA0512FBD45E81C3D0E9E91BDB2175FBD6D92EC3C5523F63D9EBC8FBDD2343F3D8073523D3752903C9AE886BD0AC1F93CD5BF623C18DEC03D744AD6BC5637A33D96D737BD1BA5BE3D5D0EA33D7CBB10BD41292F3D69CF24BD4B0BA73D81A9373D6A85A1BD0D4E923D50568B3DF814743DD46E15BD6AF048BDEFD393BB988EF43CCCA03ABA517987BDDC7840BDE497DD3DBC9BF4BCA2F8093D4F5890BC2EB46C3DFA22E83D1AFD933C7BAC36BD520E383D66CE883DE9BDE6BC35DDAB3D8490063EE5836A3D566F393DBED303BDBC34A73C3FDB113C29B524BC4B92173DCB490C3EE83F963DA971B53D51E3A3BDF4049DBB8C4E8D3C7C6A293C9215493DBCABA83D560481BD92A50FBDB8FE91BADE755A3D6CB811BD702683BC2CDA483DE04D913CF7AD203D57374FBDA34B8ABDCDEE4DBD0B99A6BDA549423DC075A73D331C1BBD984AB53CBE95993D2647103D17EC083DC53A88BD812D8D3C8296A7BDB7E3B83D5DB7053D6A4BBBBD3E625A3D53215EBD9A7F093D5009583C24BE29BD5D5C1E3C892EC93D63CC3B3D226D9DBDE53CD0BD577F71BB4EA8A63D7EA775BD4390E4BCAEDE24BDF66E673CA782823C17681FBD1356D93C10378F3DA30C89BD82C2A23DEC92173D3385043DA9E2F2BD1D3888BDD896B3BD26E1003DE22FA63D8EBF313D5FE37E3CDDA4873D44BB2F3C5F25D93DF1242CBD50D5513D799FCEBC8A88A9BC19CF18BD093C943D8D6CA8B90E13B13C7F8372BBCE09383D1840F2BDC73C1EBDC24D4BBB5F4E2A3C7652BABC35F8973DA2F2C5BC24A8F8BCB16C393DFF56E33C6B2BBBBCAD74473DFBBF843CBF98363D5AFF583DDACA39BDF1109B3DE8E66DBD3D34E0BDFE18D03C6F55A6BC91141F3E66D2783CB8E1893D3A548DBD914727BD016089BDE7EDA7BDD3CDA0BB588B133ECC98F4BDC9D2163D5342233C12AD17BD2D809B3DB7E7943CEC86B93CC4CCB63C373B213E19FE53BDBCDEE73DB25D3D3DC1C2B9BCF737C2BD9D7F99BDB22DCF3DFA6E91BD1052783D4DD3E93B24471A3DAB7B623DEE3BCEBCAB24D0BDFFFDF9BC95A2453C5E86B3BC790CB2BD5CE1703C064AE03CF00CA63DEA44383DBA0CD53D118F5BBD89E6933DF697783D8001B9BB96915F3C5EC7A7BBAFAA763DAACFDFBC515BBCBD5F7241BDAF00DF3C9B66493C207E4F3D6A07C0BA358E84BD2EA654BCA59F81BD881F0DBD185B453DF798A53DF16763BD1874BABCFA7599BD1B20D83ABE679DBC42F7CFBC57C463BB6330D03D301BB9BC9735133D8747D7BDD6CD793CD10A54BDC188803B3E1CB0BD9E1D8E3DC122AEBCC521B03B818D41BD114C323C369B873DB50D783D15A097BD550A043D32789ABDFE80A3BDBC16AFBD33E7A0BDECE4653C919A8A3CC24B413CA4BB513DD40F85BDA10BED3BE86882BDC7E97A3DB2D0DB3CEF2E74BD829616BC566889BC45F125BDF3DA4BBB515370BC34B01C3D41066E3DF4FD8FBCFE64D8BD11322DBC999C9E3DC16F3BBDB46D333CAFCCD73D35401EBD7E041F3CFDE181BD12D54D3D73D84E3D9AF83FBDBB81723CB6C0A1BDA29BAE3C990095BDAFC0013E874021BD1945C5BDA8B592BCFFEDBD3DA094EE3DC5E4C83860F36F3D537E333D61568A3C6FF21C3DC1BBA93BAB8888BC1D20793DEB57A5BD3386593D70B2FDBD3DFD25BD4F7A143D0D050DBC718EB63DCBB3073D47220D3ED85DF5BC27A749BDE203A03D53C38B3D0099EBBCC727CCBD31C5703D7439DCBCC8547A3D640C62BD14DE0C3E1670FD3CFCA6053C2B24323C8392FAB92104183DD32D303D8ADD53BCE6969B3DC7F9AF3C1FADD1BC5752CA3D38E4993D0BD444BD64DA0D3CA82DF03B54E205BD08173DBB1AEF1ABD46088FBDC9A19CBD5AFC6CBDCB888EBCDB42AC3DFD4B3FBD801A1A3D0B6A83BD3DF5063D2DBC27BD66E32D3D3F8712BD52D1823DDD2C183EFA00DD3BC14342BDDC47C73C70A45EBD52D1DB3B3BAE383C71520ABE4AC7553D78D53B3CC0B13F3DD84A91BD52FB1A3DBC7948BC83F585BD666B383D2484993CE76E533D2AB5F13C9BF6AFBDE00BCDBB3C8D40BDBA40943C6A3C153D14E89C3D36E08EBBB50EC93CCC2100BD054FA3BD53F284BD404FAA3AAB6CC03D6C376CBDBE2FE43C377C8A3DAED8CB3C372D063EF20F1CBD407C5ABD31B6E5BAF9FC19BBA959C5BD0764BA3DABC194BDB52B213D3EFA5BBBADE0353D5CEB2CBD88FF6DBD037A65BD4CCE403D73FB903C7F551ABDB70CADB98D9C7B3D0E8D473D80DA33BB722D853D3027503D3C443BBC5B7367BB4186E53C9F3E7CBD5FA39A3DEBC435BDDC7C0ABD032E86BD8F167A3D30999C3C28E3833D9497BABC27B316BD194DFF3C1F66DBBDDC8C1C3C7EEF3E3DDE6FF93DF264B5BC3CC1CF3C0C571EBD20CDA2BD5EE0823D0F91E83BBA8BBB3D5B693DBDBD7EF33D62640D3D7D56A13D2BB0293ED7D69E3D3B8C4ABD035AF43C758A313DCF3216BCF627593C14D7963C113F1C3E3DC118BC766223BDE3E370BD46FB803C06E67BBD25130F3ECC5465BC601A243D4E6F20BDC1545EBD2DFDB83D48009A3D467D9ABD9B39953D2F5DE7BC459284BA6565DEBCEBC4DDBD99E8FA3A8A8336BD0CD0983D7A88933D30D65BBC77CF95BD2008B53DD65B6D3DE69196BDA4F81F3DD964D6BC123BF6BB49F18F3CE9FC013D32EE2BBDAF0BB3BCFC70393DE219223DC53188BD885B4EBADD38BEBDA20FE8BC3B71193DE497F6BB84CE0BBD0C18153D58F115BC1F5C7D3DC2A8593D9E5B3EBC7B17BB3D3ABC9CBD685EA7BDB094CCBC01D5FF3BF5CFDB3D4881A7BC066610BD9B88753D44F88BBD694D1DBD305F77BD054032BE30F4873D72D2FE3C7ADBC53B76E9C0BD8E632A3D83069EBD3CA1793D24287ABDBCE37B3CE121BE3D33CACB3C6331F63C0B22DEBC2F046D3D3E9231BD6EBEED3C3A9E5BBCC5D387BDDA5B6BBD3940B23DE58E5C3D03B8A33BDB47E6BC8C64263D56E4533D35CB4A3D98122CBD15AD943D59E960BDADB709BD41B26F3CC8FBFD3D1D2C0EBD85C0FF3A29FD533C2C300D3DB73A113D5C9BC83DC104403E8AB8D53D0B8B92BD8CF30EBDFDFF96BCC8E947BD3E7EBCBD66C6C53C6E9E7F3DB945A8BC708218BD69A23B3DC37FE93C7A53913D85518DBDCBEEA73C1BEF753CC9DC173D87142A3D573D4A3D5209073E51517DBDD09A08BD6284423D7291233D58E5E53CC87B1EBD443767BD0A216E3C789D55BC90D9EC3BE3ACB7BBC909D33B50D0FABC60F0CD3D7943B73C1574C7BB39C3883C9F15973D1A1AF33DFDA37C3DF64B393BAFF7A63DFE17343C7262BE3C708DC33D28C3673CAD36A03D74AB013DB2CB5E3D95310CBDCA7A3CBD963F86BCE48E0F3E42C128BDB115BCBC2AB45E3D45463DBD141896BDAB58493DD8A70B3D5F6B9BBAD357873CA57C1D3DECC082BCAF3A353C11BF0CBE015B5FBD63BDC33C2F0BCE3DDFF457BD457E363C8FC117BAD508363D16ACA33CFDA16B3DBC05E83DA6CDA23C3A91063DCF4BD23CB4D4693D6D11A63DEA8B2F3D3385F9BA7DDA87BA302AB73DC5AF7EBD87AAFC3D68780C3DD990DBBCC267C73BCA656A38D93D30BCF45F31BD6ACEFDBC5B5093BB3AC23E3DA61E44BB2CEBC5371336D9BB7ADDA3BDF872B4BDD1C4883D83F832BC07847C3D9843943DEFCEFA3DA4DAC1BD4CD9603D2BDD193D9529CD3D8AA4CABC0F586D3D97B7923D7BF8C1BCBBF2323D9770A93D0A62C33D9CC8403D7BE26CBDCD1573BC441DBB3D58E334BD5F8B163DB6020CBD0DCA4FBD92F7A9BCC2DD353E3254953D5041A73D63269B3C6EDBE43C6F401D3D121BB6BD734F0FBD3488503DFA987A3D740E2B3D62A25D3C9170633DD20197BDCD12BD3C8A54E8BD3DACFA3CB39AADBC5E7742BDFBB518BD0DB5F7BC2BC7A23D678DB2BC9BA7C8BC2DC3B4BC7150A23CABA7313A83962CBDD24017BD22841D3EA068D23D4C0EAD3C5A14EABC7AB8DABBF5AFB1BDD74C0B3DA5C0A23CCB54AD3DA6D49E3C6CFD32BD728CA93DE0A083BB085790BD8F2F073EEE844DBD9E9EBABD6C7126BCC572833D78F13E3D5D462C3DB163CD3D5EC1223DAB42C8BC0435DBBCC74BC53D39CFDFBCD7DC8C3C8220123C564D11BD0D9C2EBD9D334BBCC1B6613D66575DBD961BA93C83F185BDBE612DBB7263A4BDC3B70BBE8AB7973C7D9C38BD601AB43D9C09543DFC3C573D52C80D3D10FCE43C15DF2CBB4F8BEEBCC2B7063E9661053E4B73953C4143DCBD42C4CDBDE57F5A3DBEDD853D0D61DCBCD9A4CF3D520B503D4204863D0AA5103D462C563B8E324CBD4F465E3D8A8A7B3D5B66243CC1C9843DD2072DBAAC44B23CB7616EBB6CF6B03C5F892B3D7FC3A1BBCF918BBD884E00BCA75775BDAE545B3D278E81BD6938AB3C34C7943D822CA93C747AA43B78282A3DA4650ABC81E541BD631DB03D61ADB3BDAF8148BD03761DBD4855083DD05154BDC0ECD53CEE0074BD74D2473DBA59073E68F022BDB871B03C5747873D1809BA3BDCB421BDCB87013E93538F3D7462433DA38F883DF8C47C3D346F6F3C538F373CB9C40E3D18AA963DDDF8F43CDA88ECBCCB60333D4730CD3C775BBDBDCA4553BC5AA3F3BD6ADD68BD126B41BD2C88B8BD90751F3D6F4F003E41C4203D022594BD8C2F753D63FF063D2576D13DC67A4CBCD124B5BD49950A3D2D5FBC3C68A3343D86A8B23D18C42FBD4FD8D33CB065683CDCE8653C232A4ABD8C34583DC605F13D83172E3CBB69A73DC543C23CEF54AEBBC2043A3D81046FBD86C962BD10FBC53D2E65E4BC021DA43D4203AF3DD5F0A13DFE8C26BD73E5A9BC974B8CBD76C5B23DE143C8BCAB81223D7533083B2E0283BD2772C43C344E0F3D5883AD3D1D931B3C68DFCC3C9A29DBBC5042173D4C92A0BD68E00ABE9628B73D26E15EBDE987AC3DBA4681BD8125883D551067BD3D830FBDFE6AA63D75D5AFBD3412A03D5623C13D12D4D13C7548BDBD2B4A25BCF9898ABD8E30F8BC4D3A153DAD642ABDF3D7C73CC98B573C447C7F3DC9CD953D27F0CC3D05F20E3DDFBC16BD6F75BF3D51C798BC634F4ABDCD64A6BD8EA5863DCC951CBBFE27773B1A4651BCE25A103D0DA24CBD142980BDFD52ABBDAF9D943DF168883DDC37E23B2F232D3D9A865CBDCFF8CFBDD3E3B03DB12E783DF73A9D3D2E6517BDC1A61D3DD7332B3D3787E33C813463BD21E0693CCC38CDBDE1545D3D1F56C93D507789BD68DA563D38C0F4BB5E7C68BD36E0203C86CA9EBC033C333E2F0BC03D0127AF3CA2005D3D53BF973D6550E0BD30AB27BD1B71833D9376CA3D7E7CAE3C500993BCB8FE0B3C4B7BC1BDD4AA8A3D47F3023D61802DBD8A3CD13C64BD20BD3E7AD43C829C033E592D003E6B62193A5AF47FBDCC5EE63A42B24FBC622F6D3DD35380BD8700A6BD5FC09A3D640FED3D842083BC4C198BBC240482BBE788DEBD787C1F3B04CB5F3D6459F0BC650ECBBCCAFB8F3DC5207ABCCFCC8DB95F832BBD59335A3C07A272BD93950B3C2B4006BDB200033DCBB682BCB287FDBC4C7BF43DE4ADDABC8625663CBD327E3D2DF3E43D38013D3D2A129BBD28B3943DEE9B763DCEA3DB3CF5BE463D88AB9A3D51CBCABD4F851E3D8D2717BB0156D33C14D733BDCA66D8BD61E7DC3C220F79BD6D3D17BDE6293ABD63F229BC517D72BD3A00B13C2BCF25BC1A3014BC5C9BE63DC587E63DB9FE813D3DF4E2BC04DA923CD32F81BCC70832BDBF65A03D5AFB593DF2E6713D45E539BD5D50A93D64B4963D0D09B23C975B853CAB042C3CC01A883D2709A73D697667BD81FE9ABDB5FA98BD83C8E0BC4491BA3C19DB8F3CCDE6B8BDDB97C53C73E0CD3C62B55E3DD56BF83C3FA9223DD002653C6F7171BD3199723D4DC4383C0B752B3D7D37953CA2C8D03D1312293D089011BCAB92183D7D5D50BDEE1DAF3D612E50BDA4DA433CDE2AA63D6A8E203EDCFE7EBD5264ACBC7579AA3DAC7F563C6EF4A0BD4B3FCEBC0E2F763D2EC6A038F1D0B83CBDF7393D5AC4953DB1C5EABDE2D8A9BD55EA443CD9753A3DC77244BD59634BBD35E7193C8A0945BD283D0A3D8E8B723C620502BD9D53563CBDA5ECBDACCBEDBC4397FB3D02A2C53D09774DBDFF67AD3DAAE1523D0A4FEA3A333978BB1A0CD63CBBE7933D514DAE3D05998E3D34E279BD25B452BC9DBCD8BBCA43AE3C245E83BD7DB704BC9A4C5F3D96C6F63DCBEFA1BC42B84F3D5D12A2BD361FA23D03D130B9AFE35ABC553958BCC00070BB090EA8BDFEBC2EBDECBCB03DE45FCEBC7F827EBC77F7ADBC10008DBDC4DB983D640701BDE678B8BCE1B3683DF0D5BABCC9A86CB952DCEE3C4EABB03D235E57BD47A9823DC25E483D8AD3C0BAC17D403DE1B3D9BCF4B5173D268390BD153651BD0C30F1BC69CC1C3C81CE893D9A3225BCD88EBC3DA4DC203C1E8B0D3E02A6CC3C8CC17DBDEFA871BD69DB343D9ADD4C3B5ED97B3D69D9813D9AE38A3D610E10BDE838903D633FBB3D267A053D31D4403D329C9ABDA888D53CF91D783D833108BD3F40AFBDE3A2803C4634A9BD32A91EBDB194E1BCF85575BD6E20E4BB5DD7883B7A81F0BC60D48BBD0B0C9ABD6D2524BDD705253DA0336DBDE1748EBC1334ACBDA9558D3D287430BC26BD973D148DADBD291F2B3D29B86B3DD3C789BDE7257E3D86E2B43CFF6E8FBDCA7CA2BC885FD83BB6A2FBBC7D5BDEBC5A511D3D4ECA3DBD3A24733C8C19DCBC9EEB6A3B866008BDA6C0003C470FC6BC733165BBB45B9BBDE2AFEBBB4C052D3DEA7BB53D7CD540BCC74CBC3C0AC35ABD4ACACEBC3E2AE13C2252343CC7F917BDB532883D0D76CCBD4F17F43CD3B65B3D5485B43C083A743D9CDCBD3B93240BBC2A27273D638EB13C53F6F63C804E363DB264273D5D7E303D7294A8BC39C12CBDB964563DA1C30FBDDEB9613D3DDC353DC629A8BC4422D53DF9B48CBDEAA93FBABE52A7BCC9CBB93DEE0ECCBCB02E9CBD01977C3DFF64A63C93B11A3D2F857BBDE89F52BD7A2BE63D0B7F87BC3C44843DD0D8E4BC8BFC693D655F143CE0227D3D94769B3DC31EB7BD004397BD834B5DBD87022B3DF26347BD7A77AB3D4311C73C8F16BBBBE570F03A33ACC2BDC2CF77BD79A9213B05701ABD155C5F3CD53F983CDC137CBD9A33DF3BEF379BBCB025DF3B70DC723D763343BDCAC205BD821C47BD007D3ABC9189A43C3C8B56BD014B21BDEA4E88BDC121B53C9908D93BA50E1D3DDD33653DEB3F533DFFF5893C4200353DB5C4CC3DEF76683DAF28CFBC474665BD727D96BB79E8FCBA888A78BC41C266BD08C81CBC95772F3DF6D70B3D99C89CBC561F183DDC7C733D7B7D4DBD4ECAB0BC01C4223DDAD90B3D864CB6BB55BCD4BCFBF02ABC613B1D3B587FE1BCEE438F3DA45208BDBF6B85BDB1939DBD7A539DBD0D1F193D4C2A053E9BD1593DD733A53C0611BA3C31BE91BD6CEE883DD78E653D22371DBD9E878ABD57A1B33C0E08A1BCE0B5ADBC04A3A0BD601D7BBCC7D17DBD658B0C3DD2F7F13CCDED5FBD15674D3DB4E0353CBB2A863C9AF5423D0F6E97BD67EBC43C777DB4BDF91003BD3F3821BD48663BBC09158A3C1CD1813C8F07663D8E57C63CC3C5073D3B7702BD784F8A3C09D7F63CF8F389BC92182A3C870D02BDE9B2A33D6697273D0B419BBD420301BC94BD7A3D74B7993D1FCF463D200FCBBD8D5430BDF50445BD24C23E3D543FAD3D55AC163C44520E3CFC1AF83CDAF2813D6BB3AD3D1E7E1BBD67BF9E3DDC329DBCFF9F79BDDC43A8BC879E66BDF8A35BBDA3D1963D34C038BD12FFD33C5D4138BD68879CBC2BDE3E3DD1E61F3DB66193BDE8E3293DFAADA03D32F998BD3C0D0A3CFAD591BDF2DCC43C25095CBD415DE4BCC7074EBCB354153C4A8FF1BC7A08903D2E7EEE3CD63EE9BC31B9B63A19BF6A3DB5A456BD39D1983C31BA0CBD6698063D7532A5BD645C51BDE1229C3D7CF9D3BC81D0B23D6A5C8E3D61274B3C2C1490BC7CA812BDB1A80D3DD8195E3D13EDD43C94A456BDA6B701BCC43EC93CE5900D3D1A707D3D0B7E45BD3C26B93CD445E0BA30CD4CBCF43A70BD14F287BD214305BC2E10943C7D72543D5F56A7BDF7539DBD452024BDC27F5ABD759B473D2D033A3C5476E7BCA6179F3CCB2D143C0527573C4CFB0A3D6264AD3DCA1A12BC860EF53C33F194BC3E328F3D078D9D3DDBE301BE145B0F3D6DBC713D5792D9BCEFCFBB3C7A7C0CBD3021ADBAE0C04BBDCDBD953D9300B73B7D52853D16DA923D6F48B7BCB81C53BD7882C83C1BE8173DADD207BD064CE03DFBCA9CBDA9C911BD26BF7CBDA7887EBC3A4012BDCDE5EABAD1A136BDCFB80BBD64B2BB3DA0D4B93B85828EBCFD3CA7BC247D8CBCF15E8E3D0EF408BDC905333DAD98A0BC81AC333D57C4A5BD3A9EE53C4264153D1C0EFABC7CAB9EBD1B537ABD87927D3D5298A5398544C53D99F252BD87CD38BDE16FD0BADECC71BCCA6E833D8FFC8ABCB0549F3B5C052A3DBDAB013DD2795E3D9802833D37D5D43DC7F398BB3951773D1EDB8FBBE6E7043D5F15663B166AACBDA040423DDF48EBBC9D28903D8327903DC9ECBBBD36A8663D3E2C8ABD3A89293D9322FE3C66FA163B4EDB9DBDB47F23BD489DAD3DCB79093D49CFCFBCF538443DACC464BCA13798BC0CBDE0BC0D291D3D73598EBD4A61A9BC8E898FBD4F0CCD3B56096FBD3F278E3DA99D59BC1314A8BB4F1680BDA69F853D55B854BDAE52CC3BE523953AEA3448BDC07599BDD4941BBD013C03BDB607183D974C2CBDF2EDBFBD1FF167BD88DF803D7188923D4BCA2FBCDCC2BABD96A68C3D6336033DEE12503D904B693D652438BD7A34A83D27CA173D10748EBC1E2A59BD93BE1C3D25B508BD0739AFBB060D803D9A21753D75FFEC3DAE1036BCF4D9CBBD01A2C93B74BC653D3AE652BD96058ABDAC29DCBC675E9BBD9E9AE43C13480DBCB021CFBC396D3C3D7566993D20C4CABD28F7FEBB6FC4FEBB19F130BD64458EBC7C33A23C8D226B3D2213C93D4A4C95BDBB22FB3D66C215BDA24934BC85765D3C08E23EBD484F3A3DA4663ABCA89D4DBDAF837EBC3B2A91BD54D90B3D3E691D3D2305AB3C983909BD37B490BDBBAD28BC74498FBD7517793D29C8533D6024B4BDB11CD13DF5DAF2BB76FF0DBDEEB59EBC8C6594BDE84A73BB7955083D42C61F3DF32F2A3DE37566BD588D93BC03DB43BB88AEB83DE3BA193D2ACB29BD316EBDBC1EB59CBD86731ABD6227A03DBB9B8B3D36123E3DD7DA53BD1FAF873DB7C6E63CA07BB43B8A280BBDF5EF253D2395A3BCAEFE953D6746933D071404BD5EEF9EBD69E7553D94E08BBD9694963BFFE82EBD574A003D9F9BFEBC1AC3053D57458F3D6E9EB93DBE66AABD23237E3D54DF3EBDD88D67BDED3D7FBD13E0EB3CD594503C595A853DC7D2A13D2619C5BBCA9062BDBDB5393D1FAC333D40BCCDBC9455013CF77B6C3D48DFDF3B92C885BCB277A1BD1AFE8CBD58BE3E3D59609EBC4901E73C4285DD3DC9BBD8BA315CDABD7E91193A3DA55DBDCEADFCBC63A5B0BD63517F3C88D9CA3BD00CA83CF7A4E1BCC536A03D6FE744BD3829C93CB01EBC3DEEA54B3D01CDA8BD2281E3BC732427BC0E175DBD158B8A3D6F2EB1BC9538D8BC6B11583D5861B0BCAF24B5BC7F23913C694AD7BDAD9F363DBF7F88BD515E9B3DCD8921BC81F2A13CBFF395BC7F274BBD237C9DBD1A5A82BD42B47C3CD85ECFBC0F5D59BD3D1ABEBC057B2ABD7E43883D893A903CBE3962BC51432D3D7EE65CBD95CD843D2E40053D13438E3D8622BFBC1396543CD86D853C43F13B3C7AFCB6BC81BC2BBD5243C23D69EC2B3D335F5DBCBB8245BDA92CE5BB21E4C93D3103163D6C44A8BD28B83CBDA1060B3D2A247FBD9D4D39BDCA34293D48277E3D5E9E42BD8969803C90838D3DE755A9BCD3E5393D1DF810BDDE819E3D74C1A13D29F0203D5CEF5F3D0A008BBDF2DC853DAADE96BC1BBF9D3B68E909BB38F72FBD46CB853D1CFF92BC8BE38ABD8F9D83BD3751A2BD76E3793DBD3D3ABDEA0D9BBD8F2484BD22160DBD5D7A763DDA68843D8AB6C73A2098133DD4C0513D0E9B833D547FD13D5159153C67A2AF3D2104783DDA2D3B3C94354B3D6B3E453CF9E544BDEDC4123CEE2486BC0AC8E8BCD96EB6BC60CEC73C84A803BDE369123C158334BD7B56A4BC000842BD01FE06BD26FDA03D13607DBD1301053DA5F9D23C688F2B3D5C0F403AFCB7A1BDBF2E203BB637453D25FD9FBD87B1A03C142630BD1438643DDEBF993DBDEF79BDA92E8A3C2523F4BC38AC59BC6293CDBC96A3803DFC49853CEBD9043DA8B6903D99BC563D0FDC20BD6AAE14BD79CEA33D004111BDFF38073D94E995BD1B21163DDA69A6BB9E310D3D0D738BBC4A0B50BDA4DA843DFB63E83C208881BDC36B8CBDA8E72BBDBA6897BB514B31BB226CCDBCB7097DBD878485BC8942613A61C18A3D280D26BD988DC4BB489CA73D2648F0BB68EA2FBD4483EABCA493993DFD31C7BBFAA5C1BC9C7B16BDB072D23CE4B8053D1A466A3B5D3879BBCE4A55BD48D378BD5B5F6CBDC805B93DA0794D3D5C4F513CBAD7B2BC687AA33DB4F7983BC79F9EBD89CB8C3DD9CE48BCA3A8BC3C0351313DB3AA133CAA5C293DB6D8873D7FD0273D92408A3D4B8FE5BB982F3FBCB1291BBC1A9D2E3DAD55EF3C60C5843B8D87D33C5F401F3CB40568BDB130D9BA748BB03D4D2A8BBC6DB2BA3CA86B88BBE69CADB8563E3DBC2D8791BDBB754C3D249F483D922E5ABDF78802BD81E829BD043C08BD95E042BD43B27A3CA820AA3D6D3E97BCA9590FBCB75183BDF3E0063D2D3CEC3CB3D8143D69B2813C2158E8BC832B15BDFC157BBA4CD787BD17182EBDDC99BEBBA51F92BDE522423D44EFD73C1F43963C9F226ABD9F9A323C0BE6B3BD0449273D92F7593D9E2086BDEE0495BD972269BD41529F3C8ADD193DD72A84BDEAA39E3CF80A8D3DE198833DBE5AA8BDE156A53DFC2025BC71AFF13CD706F5BC4E17F5B99800E7BC578C423DC9FE50BC4EC99CBB4E0CFE3C6E692E3C3556063C02E6263D8C9B87BC042A8CBD0A3B193CCCC62CBD41CCEF3C042EF33CA1DEEB3CD0E20CBCCA45E93C8B97B33C9BD69F3DE56A7EBD25384FBDB4868A3D364903BDFA607BBDB1FE0CBD3F6082BC5F7B90BDBBA355BCA8847E3D37FF25BDD27DF3BC3A87E5BC96300B3D594E06BDE7319A3D83250ABDF67A6C3D22C3583DBA4C4F3CF599673D02A037BD21ACB9BCADF7A73DBE41D93C48E9EC3C45496D3C518C9EBD1BEA82BD9E426DBD5CCCE6BC4209A43D45AB23BB1F64133D854452BC55A0373CD87084BCE11A9ABDBCA6AE3CDAA0683D962492BDB36A8EBDB0C7DC3B252582BCB594A83C91B3703C4AF7683D61B1973D463B0E3D272E42BC081B8BBDBAB4B83C85A2023CF3B14DBD26CD243C6684F53C70FA3F3CA3818D3D848AE93C9A0F933BC1425B3D027C4F3CB7AEF6BC5D54513D9CE0C8BB7BC69ABCEF54F5BCB7A16D3CA45138BDC0CF6C3D19038ABD4D7673BD852AA53DAC495DBD16E9B8B9791656BD76984DBD06E1E53CC7944F3DA9F50F3D68208DBD5223963C1DFFDA3CBDCA23BD6B21F23C5F679B3B43127CBDA0C556BD6BBA1ABDC5F02CBC2547743D61DF333BD11B68BD8D7291BC3EE9A4BCD7437CBD2A081EBD074E8EBDA26A64BDC85C3ABD319C47BDF873ACBCD72D92BD116B65BD69F3573CC97AA53D381D953D3B1AF3BC9D17E43C8EDE8BB9E377E23C5C304FBDC0A7D7BABF9B4F3D68CCECBC4242B03C19BF973D5C62A53B9DDD63BC299B083DD3A0A2BCC483B0BC3CC7A4BD50BC90BB6E80913DB25284BC39401EBD84D1823DF4B0563D720212BCEBC388BDF733D03CAD22603C8A86953D62B903BCD7F6123D0DDE753DB7E98EBD643B8B3C835287BD15C289BC07F9EE3C8C3F92BC36D26BBD17CAE93C7A62233DA0E5EA3CCD073B3D97746B3D7ABF4F3C10AFA03C268685BD5FF95E3DAF68923C94A39CBDC68A92BCAAEB44BD8B72893D89C98F3D8E7C3B3C5EBC71BC18FF82BD3033853D2F8A183C4448AA3C23B45ABBE0979EBD9118363D7E1B8A3D2BE7823D420AA23D51779CBD507347BDAB56B5BCC790933D744560BBD280DCBC62D7A9BBFB753D3D3A856C3D31E9913D1D312CBDA565643DC574F73BCDA1183DD21770BC0B3D973D2E88E7BC477F1ABC82A9A53C6C9E1B3D562C5C3D9CBA64BDE3D644BD06C0933C7F20143D255F813C38CDA33D9DEC9B3C76A733BD3C84B7BA8D6B3EBD38271ABBF8099D3D629B37BD95023E3D830327BDF3AE37BC17E938BD74D713BCE9536CBD4C24003D7A5D943D3721F03C7B2D56BD5525133D6D767D3D945505BD86A78D3DA96D52BDF8A19ABC09E28ABD32762FBD97EAD13CBC376ABD807C9A3B23A0D73C13268A3D6EA632BDB084EB3BEB714A3D406CE8BB6F0F6C3CA00A17BC8F9D7ABD9A6F95BD0C39933DD85DB9BCF20D2CBD698D7FBDBA1854BD40E963BB1686C7BC0A5CF6BC6F688F3D7E04843D0EB2703D88379E3CB2822C3DF8AD2BBD5DF8653C6C249CBD2DAFE03CD669763D0567A1397674E03BD8390FBDAEBC2ABD5EC109BACB2875BD77269FBD54618EBDA6107E3D51F62E3D6606443DA305B43B10E1ADBA36430A3D84A3B1BC0EC085BDAAA6253D60BB95BB210F77BD36DD89BDF3BC84BC958695BDADAB603C98036C3C25F48FBB58A7213DE08FDF3B8817683CD3CA433D5BBE9C3CE6FDB23C14BA20BB26EC89BD5D9648BD1387EC3BB654643D6B3B9C3D195E9E3C80DD233C284F5C3DDED584BDE66B43BD0A759D3D549D67BD94DF943DCDAB21BD03789B3D92FB073DC9F956BCC23677BD7BB8FFBC6C10C03C18A87EBC639E803D46997E3DA522A33D171E513D2FE80DBDA31413BD927D903D7BF1933D37B6B13C93832EBDC57B4B3DD83484BD485EE3BCFC10B83C0FA08D3D1F1B113B30381A3D47C418BB80287B3B9896293D829E69BD1EDC1A3DA30561BD000FC6BC0E7D87BCB6735BBDC74279BA418B163DEDC339BDD2F11BBD3C0A21BD95D775BDA2C19E3D6AF6D3BCE002CCBB0C997C3DB679613D16DC91BDD90E933DB88460BD4998D33BE57A72BC1EBC01BD9049B2BCBD18883DDE0C7A3D6C5C88BD23D5803DB397F03C4AF5B9BB7BE715BDB4E83A3CFAEC833CF41A1ABD90901EBD11F8933D3C566CBD5B539F3D3231D2BC12FAD63CFF8A8D3D35A780BD36CA533C98ABF13C5923623DBECBA4BC8102163DF05985BD2ACD51BDA72B55BD06788F3D7E6D31BCDF45DC3CDCAD8F3C9BEDA0BDAAE9F23C5609123DB97FB33CC75DB5BCB6B9C7BC8A60E3BCE0CEA9BB4B171E3D170F993D744C2FBDCC701ABC7F3F1FBDDFD95CBD1E3CC63C1284743DBFAA4D3DF72678BD0B3900BDD7A54E3DD8FF3E3D0BE80F3D6B215C3C3ABD20BD50EF11BDA1799EBC0CEFFCBC504F7F3D43E62E3DC14CA6BD17E5393DFA91983D5234863DC779C9BC631924BDD77E3BBD06AFC63A26BC243C67C8313DD109953C31168DBD5AB948BB2D1086BDBBB027BDE4B7E9BA9CCB863BF489313D113AB1BB3C8A3A3DAE0280BD98039EBD334296BD3956003D82960FBC402E433D9BEC8FBCD22090BC6B611E3DC5D00B3C7BA88B3D45C3A33D2A52803C857B7CBDF3F482BD2EC892BB4A145ABD31CC5BBC8C742B3D4DC06FBD1B3E04BB8D87443B2F3F8D3DDA6B1F3D066EA03D72F44F3D663E8A3D928209BDC33D82BD3B629C3DBC80553D1E3D743D1EFBCF3C2DD7AC3C767AB4BCC3952D3D6CBCA4BD9694A0BDA3BC6ABD6F70F73C856082BD375EACBC8C35223D673E653D745F93BD8D352A3D342384BDA8B78FBD7E37D7BC94F6EABC55DE9F3D23AB02BD823C29BD3FED833DE24E813D19D746BD046A77BD3EF95ABDCDF4873D5FAB46BD8F81D6BC8F663EBD29313E3C7B37613D28C6333AC9F441BCEE54933D75934E3D466B37BCA35A08BDB3A37B3DB58F783B8640FDBB67EA2BBCB06129BD195465BD1E15843D2297B3BCD81C36BDACC4683C565298BDE167273D068DE03CF5E5983D4A63693D44778D3CCE51873DFEBF743D9F11CB3C638C60BDD31C18BDDE2E2C3DE57355BD41A8E4BCE29B493DEF559EBDDAB78DBDC3E198BC4096313D1683623D33C22D3DB578383DA1BD8D3DE849963D459026BDC4F3E93CEF09AA3CEE2307BC4FEF6D3CCE3211BD0B68263CD19285BC1BEA823D4ABAA53D01DD25BCA927523D22C375BD697191BDF0F2823C037F3E3DBD1F413DD4B39A3D1857193DC87D6B3D4BFE463C0E9BA9BB561E373C7879693C29B89ABD44DC60BBD1AD5C3DD7BA94BDFB84343D65FC993DF8A1E6BCDEC38B3D4C759DBD137C69BDED2092BD8B36073DDF27493CDCC7E7BC3910273CDC9808BD13A61F3D2A272D3DB79E4DBB8EA4783DDBF55BBDA5519ABD876F10BDE9F7BEBB05002EBDB2D23B3DF244643D3579FABCF3AE333D2B3F7E3DCDBCF6BC287CB5BBB288CEBC88203F3DBD1E95BDD49650BBE883CF3B657DA3BD95C057BD8399943D76DE723D189B59BD80A37BBD6DF82BBDF6276D3D94B87EBD131362BD6C7888BC72B8553D31251D3D04C1A93DA02B91BD0479FBBC8575253BF33D013B1CE2683CCBF3033D71D4E3BC4235CCBC9051473C01188A3CB6F7873D121CB03D7EB5193C518779BD8BC83C3C12735DBCC53355BD0875B6BCC0965DBD9DC9D4BB1AD7ACBC8D92263D7AA2053D770197BDC6A09A3B8641183CF70BC9BC3D0540BDA51E243B528283BDA0BDA93DB937383CC8F6363D3A6AE73BA0384A3D42C92D3DDC8E163DCCDDFD3C4B063BBD1067983DDD6848BDE83494BCD506513BFB5F3C3CA90833BD7901863DE7717A3CC3B41A3D353DA3BD2761343DB795103D506A14BD1BCB873DD30183BD23AF643D79B18EBDA51A4CBD156215BC7F92843C9F4320BDD6BD72BC4D9DAC3C847AA2BCB57C273D47335EBDE1731CBD17273ABCD19345BDDC85133D5280323D3340523CD99B1C3DF6F3FABC0029C6BCAC3A05BC6F153F3C67259BBC34766C3D5B84DA3CD970B5BBE03F8FBC56443ABC046334BDFBC496BD0D7FDDBCABB98D3DE7C7863DD96D6BBD0D9D9F3DBA5FDEBCD68A25BD4EA888BB11028E3D73CA23BD0B7BB2BC52A06BBD7C5296BD32DF9F3C41BD793D8CD237BD5F2854BDBB6D21BDC8AAE53CFEDE843DEADF96BD9FFA983DE8F0C4BC302682BDB1D9EA3C85D51F3C6D1EF3BC242F43BD41F0E53C5677153D165426BC812A81BD7CA2623BF21084BDD2DD76BA18CBBA3C4E27853DC811DF3CFDEF033DB62D943D8E45903DF098A3BD6DCCE73C55DB95BC232B05BB3B9D56BDED032A3DB12E963D669140BD07444ABD65E8133DE82E373D497BDB3CDB338A3D85600BBD81E8F93CE49C9B3D6F52243D0B61033D225180BD5EECCBBC51BA95BD73CC5DBD817C853DB2CD1CBDD012213C53FA7CBC220923BDA2AF5D3D2AD0143C9B92843D375BE8BCA74220BD7241EFBC8FBB8CBDE57A1D3D57FA38BDDE60F1BB97CF5A3D7A60C7BCF4F588BD66FC7A3DA22942BC065D63BDAF65633D5A676C3D282522BCB8E16E3D32D363BA712F603D2CD3AEBCE32882BDDDC4F93C9665BEBB8535883BCDCB4D3DD60CD1BC04B8673CD716B93C6FF746BD189890BD0450E73CE4AA943C6F7BAEBD3470CEBCF6880C3A5C6261BDAEE5833DF144123D7341C1BCF7F3543D96E002BD7581933C17371A3D3E131FBDB64E7BBD4BFC4ABD179BA63D0670C23CC951A83CF0F890BCFD939CBDB8698EBDB50E773D3DFB48BB131AECBB24916DBDF10C863B2440F0BCB613143DD321D13CAF89C3BD37DA0D3CF1D2003B057756BDD642DF3CC02B91BC8AD13D3C5F59273D5CD4253D79FF2EBD631DB33C52F04CBD47399E3C6F4ECDBC944CE43C21BA4EBDA089C73C84E77BBB1E1F9D3D0A92F63CC621A4BB01B092BDA02834BD04D23BBDA93986BD14E568BC6E5DF93C8E3C8E3D8229A6BDE758E53CBC0F70BD3097993D131869BD7AF985BD643925BD359F23BD8F1A853D4FDDFB3C13F25A3D3C6DFDBCE199503DB617633D2E58C93D727FA5BC187F2C3DFC6C9BBCB6660FBDFF8B4DBDBAE46F3DB9ADDCBCB8E0A33C52BCAA3D057CA4BC03F286BD5F062E3DEAA5633C12612FBCE17C243CEE87853D44FF93BD060CFE3982621C3D04847FBD680B943D30E19DBC320A4FBCE5B08A3D6F38993C920137BA7E69343C4F80573C2A8671BDED451BBC2AFB8D3DF23F1B3AFC1C373DDE0832BDDAE8233DA815B1BDAD48EBBC052E603D86724B3DECCC83BDF44F0E3C665F3C3DBFDF80BDC3C790BC8B4B45BD0939453C22E0DE3C837416BD4D01743DB5ACBE3DBC76123D69A9AD3D6F8F0DBDD85FDF3CD42B48BC8713B23C1491D3BC7218F8BB502A8EBC963F893CA22506BBC09E0BBC5207AABD1418883C7B5B403A0B046EBD1C0D8ABC523386BD3EEE32BD74F76F3C2C93483B25DFDFBB80FE2E3CD03E39BD2686A6BBF063133C3DD7113D65BE453D70BEACBDD33463BD9CB293BD91283FBD02D28E3D76ED413C1868B03D9DC0583DF1D956BCAB9762BD405A32BD7759A8BD70284D3D448717BDB8973ABD52F1A33DC96E043C65A56FBDADEB26BD2C4C353D678A49BD1DE7A3BD9B8636BDA52B58BBFF191F3D944761BD9FF7BBBDFB66333C371C843D25DE6ABD4D0609BD6ACF54BD11E82A3DE84DDEBCC648C6BCEB864E3D0220E13C70A45D3D1CE3EB3CAF70EBBB027997BC24CFDABBCABE93BCAE2522BAF78F713C9F68DE3CFA1F8E3D390E873D87BF4A3D36E1D4BC5107F0BB9E1D933DD7F8CFBCCD4751BD7BEA853A46A57BBDB18A9ABCB05B38BDB681D0BB9E67933D9C39883DE973273D09A90DBDDBBA9D3CCA179BBDAB4E71BCB9948B3D8A2879BDCD505D3C38D59BBD7BDE56BD4E7AC0BDE03ABEBC20A506BD062F88BD91E5AC3C3E1CD23B2529043D9BE278BDE6208B3DEAD6C43DD1C9353D0A3A9FBDE6DE92BC1E728B3C33965ABC57688DBCBB46E43C7172E23DC5330DBCD9A185BA4C22933DD11F66BBBAEF31BDED106BBD537044BDE2FE693D46AFF53A3D8AAF3D9A8C173D5B729FBD5DFA3E3D34DA08BB42756FBDED3CEF3BC9D45A3D0ABB2EBDE0CE623D1734DA3C041C6F3D8D15AA3C127784BDAA2CBDBC89A3B63CA20344BD2A4244BCF81489BD8BE0ACBDEBA2463DA34D39BC681E853D80F4D3BB07BEADBD2E66B33CC75C0CBC2D6F4B3D1BE5F43CA9D6333D3B3DB5B9B67772BDA6B2EBBCC5952ABC59DF3CBDB57BFE3B6720373D33DB2CBDD81D3DBDBF9092BB4BF197BD8C7E35BD9F2EB93C52689ABD0A9D393D5839FE3C87AB8A3D6CE75C3DDB634C3D204766BD79AD603C8EC46B3D198663BDC1585CBB95EAB5BC483FAF3DA9E72D3DD8488A3C8E629D3D50624D3D65476CBC6CE70D3C6D5B053D58B9323C531A20BA1873A6BDAF38853CB1520FBD6BC94EBBDEE342BD9B7EB43D61C1663D245C313D9167263DC6DE583D7CD5F2BA46E99D3DF094223C971C63BD3A05A43DFD374DBD498901BDEE9E7BBD187AE2BCE053B0BCFC618D3DD8F9443DD3B6AA3D6D5327BCBB6A22BDD6FDC03CA696973C7291AD3B05C58A3D2A1710BDEB97B03BDAEB973CE7C39BBA0155153DE9653FBC751BAABDD96DF0BB028B51BDB385C33CBEDA9D3A49A9A5BD7066223CBEB5D03C7EF9883DFA398E3D6F441BBD97EA80384862443D11C4583D8383EBBC112C313D4F2FDDBC93A9B7BCA9554EBD40E699BC081C46BCAB4585BD6D36833D1132933DCCE4BFBA1C5A803C51E346BD149B193DE00A60BD5FA9803D90370F3C7CFB14BD448A653D4C6192BD7B2510BD452518BD875A9E3C5246AFBDDD8248BD117203BD1516FABCC6C2163D2AA7953A41DA253D70F613BE076537BD404EA03C80DF913D8D0E493D06CE653DA5A57F3D6A4D873DC13E653D9AF684BD0270B1BD1A6576BDDC79903D571A37BD6F97ADBD080B8FBD2A4A8FBD38548D3D3E533FBDD70CB3BD2376443D4404793C48B424BDDACD61BC9B88953C49E6AEBD7BC91E3B95B3773D33A47ABDFA2D88BA9D7DC53C2B980C3D832CFDBCA6DD06BDD7EE503DCB2AF03CC105A9BC87B19BBDC391353C90443C3DD02A033C790A51BDDA5D923D641889BDDF09A93C205A873C822380BB2193E4BCFC81823D7603EEBC84FE3DBDEF7508BC26E962BD2AD99ABDBF2165BD96905ABD7F6B113D1105573D13E3A9BDC7E63BBDD0D2323CD3DEB53DEA72343D59234D3D12DBB73D51FDD6BC28646F3CE6DF663DAB36D83C191A873C201F0A3DD643363D94CFCF3C5E5F42BD718508BBBE9E92BD0E765A3DF56793BD5E9D3BBDDD99283C10D65C3C35C3B43B3CD1EFBB123C693C536A0B3DAA4830BD32FD07BD9C5C55BC8F09E63BC9B4F4BCECC9D7BDA9ED2ABDB58D88BD66E16BBDC344ABBCBBF81E3DFED3373DF7037B3CB0B446BD2EC1B1BD44392C3D0AE63C3D0D0B993D2DC5AFBC91BD84BD9F8C17BD29D1E23CCDDE413C93C2EA3C59FE4EBD3D2D953D9817DE3C5A730CBD1703213D11AC303D84AA3A3C9ED7313DC866393BC76E1ABD445640BD11676CBDC509B7BDC5FD903DB922003E7AA07D3D332A673CC5DC153D5857973D061A7CBD12FA0CBDB1923F3A7BBF83BD379393BC6F174D3D2AD491BB33ADA73CD8E58CBC02B26CBDC0B876BD4C38E33C64C1C73DC2519BBD0ECDDFBD2B0D8ABDA6376F3DABE65CBD0154153BAF30973CFD41993CBF9D6C3D4D4BA1BDFFD66DBDC1900A3DA7F3A2BCF5749EBC8BBA10BDC4F9E33CB2EB9E3C4C7A2A3C7C40573D05F01D3D26CC753CCFF4E33D16A3A9BD630E78BC90D73DBD80A9D6BCEE4E1C3DD4A2DDBCA53C1CBBA0FD123D667227BBC9A5873B09A4563D3917543D0F618C3D5E930D3D07F0483DE3FF82BB598E3EBDBB48B4BDD8F53FBD151A883DA0E54ABDA210B73C57FFB73CF11501BDEA8F35BCFA6E9B3BD99A1B3DCD7298BCCFF1C0BCD0B2533DD60714B9C76138BD37BC30BDEE16BC3C5560A93BA8E38ABD550BD6BCBF300E3D2AF2C63C090236BDA7608A3C47DC27BDBAC96EBDEC04953D5092EF3C9E34023DE827B93B9E4B8F3DBFCB3BBD74B0913BEFED49BDBEE518BD4C64263D3652F13CE43668BD08C6363D782F7A3DFC17FF3BC42DBE3B6035D33D5FC312BD42459F3CF9C3943DDAFD30BD33EF2ABC0F6A763910E8D13C6D1FB93D132B50BCDD04853DDFD116BD68EA8ABD4911BD3D720F873CF7E3983D3AB47F3DC84E3F3D8170793DB4228BBC585906BDCDC71ABB8566A1BC864275BD31E04B3D08B6CFBC36EA533C3FB77EBDBEE0C13DFEB8F53DB3FDC2BC21F7BEBD26C69A3D2A18953D31B89FBCA146B9BD34B20FBD33C3CFBCC6F2373C7900393D26254FBD6CD0973DBE3D9FBC600D3FBCDD5FCBBD37ACC53D19E5953D1B536DBA227A91BD1B4AD3BD5FDAA0BD17B684BD0D0373BD7C421F3DF4F6023E60BD9EBC642796BDFC73D0BDE90A233DEA591C3DD017D139927458BDEE2151BC380B383D8B25223D638F8DBC7D2DCC3DEE62873D43F0E53DBC33F5BCEF0C98BD4634BFBB04A28FBD84BF653D8A5A44BD0C41833D4EF6A43CB7662F3D444083BDE93BAEBDA89D85BB5BA5F5BC5CA7AD3B2B881EBDE18A623C44F0C2BCDA808E3A835F99BD7BC428BD25FC2B3D0878BABD23C5773D39A364BD5176BCBD7C92DB3DC9B78B3DD5F61D3DB97BA23D2E0F97BD8D0B97BC65328A3DD9E7B8BA1958983DC74F30BADE625BBDB5FD763BB2F828BC357F17BB888378BC331C3ABB43E2A93DAB4366BDC7618ABDE773193B69E8603CC17A46BC787609BD86BD2ABDA085B03D6EEDBABD1C3294BC44A88A3DCAE6943DD663D4BC1E6BB2BDB802843DE365193DD68F3D3CAF650E3EF6E2FD3CF5D05FBD3451B53CD48CD53C379C20BDDA78E13CCDF661BD904F493D02F4AFBD1DEE5A3D0B6E6ABCE9D11E3D9E1C343DA2AC773DBCA8A03D820DF7BBEF468D3DFBE20A3D64C8613D408B9BBCE3F3973D187CCE3CBD0D923DD5290ABD1738223DF449F5BC3848893D441ABC3D71C9D03D9F2C9C3DD1D8FABC898C443DBC013D3D60D4A7BDEBB7AD3CE40C82BA0360823D3068173C22D66F3C672ED1BC8823CDBC46799E3CA7E3E13CE6EC2F3CCA82CBBC32C08D3DC2133FBC1C5E87BD6C980CBE5424B5BD5871623DD232693B80D7B63DA430063DE1D2723D4355EF3C7C3B313DFC3D653D725F393D7C52703CCDC1583C3D36B4BC3D1556BD82EC973DE27A193DC4E8E93C991B423DB0DBDC3CC6C0A7BC00C9A03B870A6CBD723094BC98BD9F3D37212FBD0D641A3DCDAEDC3D2E5883BDDBADAC3C89B30EBC2D048ABC3E9B4F3D5645FB3CCD5ADD3CDAD6823CF9FF3B3C473A90BD8F0AACBDE88C883960A75EBDC46E58BBA4EB9A3D9134B9BDC4507B3DAD3BC33C90CC713D26C0823DAE70A5BB32B4183D7D95723DDD17A93D6FA4EEB91305503DB280AFBD07E9E43C6326423C32ABB83D56328ABD45F114BDF62428BCACE71ABD040481BC8583103D7769B0BBA1C800BDFA43323C9098DE3D659469BCCAE457BDF31F75BDDBB9C93CA172653D9067AE3D0E2809BD6E1F563D15EFB0BDE9A618BB8677923D2281AFBBB8F0A93CCF8AC3BC93AC06BCA94087BCF455453CE68E32BD134038BD5A77653DF951AFBDF88881BD7D4BEFBDDDA4B53C8944B7BCCE884BBCE666C5BB974DD83CBB8B743D4F6D853BD719793DA332023E8A4A5EBD86958A3C4186503DAB725BBD600E6FBD7E6D47BDC424A13D817DDF3C5146163EDA881E3DFA6965BDC2659CBC20D1C53D53F720BDC57540BD1D006BBCAC9093BD9B0DA53DE5BACE3D89B0CC3D85361EBCB5D06C3D40822CBDDEDC493CC632363D1CD96C3D9AA87C3D85A4953B08ACEEBDFD8D9AB9FD7B73BD459CA7BC82D15E3DB306663D5E1646BD30A191BC9586E6BCB4DE88BDB937E7BCDCCA8B3D1DCC4A3DBA11813B1E8C9CBD0CB888BC662094BD569892BD705F763C61CE9C3CE103AC3D974E483CF8BE01BD7EE807BDC0F9663D3A4855BC0F3A02BC191DA73D61FAE63CECA966BC1DCC89BD241E59BD0DE102BB526F563DD771613DEAF031BDCA4ECD3B6402DC3B41F0C6BD49DB333D7DC453BC33E43EBDBABA56BDB9F8543D083A8E3D88332BBDEF0550BD8CF0353CCFF2273C9253E6BC45B3D03C09DF2C3B966F12BDA96B853DD27C133D8BD18CBD8F098EBB25A3DD3A0757DFBD371C433D47E7553C15063D3D848E9F3C96B1A73DEE52B93DC34693BC9466023D6E6EEC3CFBC1743D895141BD6BCC8FBD942727BD10A5483DD3E5C0BA72F768BDE37D6E3C22B99D3C37CA8DBC73D436BD3326993D8DDA08BD3C27B03D97A943BDA689653DCD9D20BD8B6D99BDC39D71BD952AF0BB43CD473C0DBBBEBC70BB56BD149DAABD9D2AC2BC8554A93D6376DA3D693849BDBE744A3DCE63383C588B9D3DB99C8D3D77DDE1BB515E403C120BC4BD5F7E313D319C34BDE07352BD412D81BDFBAE843DBE1F863D4985243DBF4EE13C3E5C77BDDF661EBD62852FBDD6BD46BDDAACDD3C5F6F08BD4C83D4BC4518A83A9C5D6C3C949397BC2C850E3D876F023D30158D3DFF7FF3BDA960A7BD33DA3BBC92A00A3D4A469EBD4FC14A3DC0BA2E3DF1206D3D35C29BBD4E8272BD763A93BC5902FA3C1BD739BD3BBE39BD4709633C1025F23DA2330B3CB60A1C3DDA1A4CBD4ACA9ABDE3B7D6BC5E5221BDEABA9CBD6C438CBC9B4147BD3D1756BC79BCD03CB2129A3C3730183D7482363CDFDC083C7114523D52DB29BB61FD80BD7074883C061B20BDD03A7F3D1A5F013DC4726E3D28281EBC714C87BCEE930ABD318E493D8FC4843D3CC5B3BD414491BCC4329F3DDCFD833D3C8CBABDFF4B643C24D3AA3D612C763D20E15F3D738A823DF667F0BC37D516BDE6668B3D3C128DBD091F9A3BF890D53AA0F9203DDBB1AF3DB4F7EEBC196E92BCFC255EBD9C4C4ABD1384B3BC5F2EF0BC2053143D5C0D31BD7F628ABC6DC7B8BC8434803D3527D2BCF9D785BD06442A3B911F173D53CA0BBD82A5C7BBB61D1ABDA0DF21BD32F463BB3CBC603DE5BFFF3B50FFF6BC76ED0DBDC20D603D811FA13D9009193BA23C83BC740EC6BB41D6A83B90816C3D43FA47BCE146A5BD30E38D3C3DE91DBD009AFEBC9E2E6BBCE083073C39F0093DD1840EBC33790CBDD436EC3D2DD3833DF752193DF73EBF3C30243A3D17CB90BC7738A6BDDFB6A13D045B173E5A43943DC1A32F3C5DD5943C203689BD791353BDD4B4AC3D1DF6D6BDA1BB91BCE54A303DB69D3D3D0ADD703D0CFC4FBCA3CCE4BB625C7D3DA28BEE3C891922BD3A10D83C9A7501BC0A8043BD6174DA3CD7625B3C4B8CBC3D1F51433D2CB787BD9DA98BBC1B3730BD2BD86D3D667988BD1072603B37779EBD94C8643DB8C6C33D5B7FA1BD61E6D0BD08E0133D9D49A1BD696C31BD7F5C63BD432529BC2CD3093C63A4A1BC60F3B73D3862E2BDA4D0C23D8B9664BD0DB8AC3A72F2F6BC365DAE3DDB02EEBCCE998E3DE8EDC0BD975235BDC10A323D124E5D3D51D7EFBC866F52BD336966BC14B1A1BD8AD0623DD470233D6C9827BEE5FA913DC2D30A3D4D0E383DF955563C070B84BC2D5309BDA7AA8F3D9051253D94F585BDBDAB5E3D5F03513D25BE8C3D55A79A3D0C7DAFBD857CF9BC2AB29A3D6EC0DC3DE98AE6BC5D88573DDF03223DFE25A83CD51D2EBD3D13803BA8D2C1BCC2A4573DCB4CB2BD59872FBCCB2482BB3F75CD3DD468D9BCEBCF30BD01E140BCB7E304BC857603BD1BAF84BBAE6BBB3CFAAC863D829EF03D2F1AB73DA1133C3D7D8F1D3D192B2C3D1ADD62BD8DEDF3BAD917AD3DB5199D3DD2CBF33DEBE39CBD54011FBDD44BA4BC43ED45BD6B2579BC9D4488BD09E1013DFE4190BCC5A3793D35A339BDD595EE3DB3EDCE3D6D92F83C910156BD1D1D8A3C92409F3C1BBFAB3DF1ABECBC8B87783C9E71B63D50ACA4BD533ECC3BA8898FB9AA7C5A3DBEF233BD82B4ED3DC52DD23C6B063FBD3707ADBD568F80BD34FC923BB167953B9515C33D049AB33DB346993C0C59553CEBD913BDDE4547BA87721F3B30E9903D4CAD493DF013F53AE9FEFB3CB8AB83BD6C288F3D6761353C193884BCDF97BD3D21EF5CBBD64BDA3C01B144BC187F643DC0C53BBDD605BDBCD9EA043D2F9805BDC4C6803B9A0D0ABEFB7CABBD2C17503C7C0FD3BAA91D203D87E6B4BD9937933D35F6303DE3913ABC83EE25BDDC59333C5F29F03DC51495BD7810D5BDD4E6A83D199C143CD883333C8599F6BC19E08FBC5116433D236137BD29F80ABDC4DE2CBDFA71DBBD487697BC92E656BD16F8A43D66047BBD218608BD68C7EB3C4920C93DAA6517BDDB4C093D7665813DFAB581BDBF0D56BDDBD538BDC036713D24BBC1BC7B190B3E328FBE3C2EABBDBD6611343DF633EC3CCBB22FBD14078E3DBE23A6BD7B2FEBBC771BFFBCB62006BDD7D9F43DA7D18CBD558F893D698796BD3D7BB73D721DC83DD7E68A3D0932853CF8DD3DBD08408CBC7F686EBDE6F7623D821CD83D69AF83BD37F268BD2E5C74BD64E14E3DE2DEB6BDE757AC3D924FCEBC9A3E8C3D0EC4293D6B84843DDFA874BDC4339ABDE620FB3CBA72E2BDB4D0503DF94370BDEEBFA7BDADDD7FBD4E40B53DEFEB323E78EE163C5DD8B53C51AA453D4365123DA652AF3DC74FB13DE0E4153C1D7DD63D5A3B263D4F9F493D6B432ABDBB9F64BDA2259EBA3728CB3DBAF220BD0AEC073D5B4C92BDB720003CF19CDB3D39D0913D56222ABD72FFAD3D8E968DBD931B13BD0B22173D1641D8BDC14F14BDD42921BB6ADBB63DFA55AC3C832288BC32DF7EBD9213433DC56A66BDAB4C86BDE2121E3CC87041BCD642AB3C2CCAE6BC3151E63CDEFB0E3C973590BDA62549BD7AD0AA3BCACB3C3CAFEB9DBD984D653D5C234CBD15EC943DF63F07BD8D5469BDBEE264BD67FA0FBD2155633DFB8695BC0B20EA3D00C94E3DB66C453D4DD901BEE86791BD191CA13D74B8FA3D75564B3D767A3A3DAC7859BC170511BDCCA3B03D41FD013D979C8BBD8230C03CABB4FCBC99D9E83CED43E1BB13B33ABD3F62F3BC5573B1BC9A918E3CE3F260BD1DF9FABC4CA999BCE9956C3DD49D843D18F1ADBC2A06853D18509E3D4F92503D362E1ABD02CE35BD15D2CCBDF971413DCA9F9FBDB8BB87BDE6A450BD6A25C9BD50B8B83C7E23073DBEF9193DE61F433D58C31E3D977E183D150C803C7919723D35ED393CF1B65CBDBF3072BD34751B3D775F043DE2DD2E3E6EE0A63D765DA83BF1E12CBDE66EDEBCC9F5903CF82781BDF53D6EBCE5074D3D5BC48B3D0880E33C992A883D9AF402BE76C3873D1F7D36BD3443BFBCDB92383D9EFDB8BC7A64163DA0ABB43DAF9A8D3DF1860D3CC0508CBDAF72073D784E673DB13997BCD4FD7B3D5CCB783C1D1E003E58586D3DCDD2AD3D550A8EBD0B38AFBCE0828EBC1549933DB864663D8E662ABCD8CA98BCA03DE13DD6E058BDFAD4893D7D972D3D1C0931BD6D1D853DBA0F063DF370023D89C2473DF90C9FBC3199F13B8A203A3D13C05EBD54031ABDF0FA8CBD6B2BEF3D72046B3DF265CDBC3AD4953D3C3B063D1FE0FA3CF716E03A61C3DD3D9188B5BD487C00BE751B8C3D3E51BD3B73845C3B0948FCBD0050C5BC1F9139BC0FD1113B12AF843C739D66BD6634853D7FBF4F3D65EA813DF033EFBCF8C7B53D9744F43D083615BDF4F3C2BD677085BD46A8623D63ACB93DE24D38BDA37E61BB667A4EBD27D6903D3E82BB3D0E85E5BCC85200BB3D80B33BC2004E3DEE29BD3D543CCDBD5E3E6FBD657D6DBC246492BD67CA26BC040B163D85F4D63D53EFFABC975796BD920B523DF6709BBD480653BC4A5DFE3CA587FDBB272128BD8310FABCA6914B3CE729823D87B68ABDD2D1BEBD0CF5E23B92D3E5BCD28248BA5691AA3DB2372C3DD3CE89BDE9958B3C8348D33DC993923D8AEE05BD60D740BB86EE413D5F45EFBC710C0ABD564B09BAEA9C0B3DEF1A07BD8B55D33B28B7053D0F45813DBDA523BD707C9CBDF0D9373D2B74143E870B493DE66CF43D4840DABB7484B33CAB71183DF2055BBC596B26BDF5178CBD14033CBD995D2FBD4A92E13D524D043DD410233CF866013D6347863D970D873D1C59663D473B883DACE207BD9FAA433D2128A13A115B073D3679B4BB68C32C3D52DEDABD3B36A0BD3F0AE03C1F2DF7BB5E87B33DE278C53C7316B9BCDF39E0BB0DC6913D4D8FC23DA4094BBDF3F46CBDD37D023D7C8235BC641CAA3BBEB4023E6E6BA13D98152D3D91FD13BDF2BD9EBD95F4263DC703A43DE596FA3C242D9C3DF4C5343DB48E283D58DE093D9143D4BCFB60F43C842C89BC9BAC1FBC25EF5A3CDB7A0F3C4D83D0BD0D64E53D292313BDAB22A33D1835AD3D72AF66BDFCBD773D6FBD05BD157942BC6AEA613DBEA9E43D160FEB3C9789833C3A1F6BBDF2925D3DDBF2C4BBE8DA4C3CDECF17BD64E244BD246529BD7A67423D647E9A3D1A8245BCD52DB83CDB92943CC25E823D89FE203D65EB05BD71A72B3C1BD6103DC1F980BD03939D3D715E5CBD2BB4213C4595CBBD9FEAA23C3C2DC4BCCA3526BD6A58583C1FF704BDDA7ECC3DFC1390BD35AE833DFF0CBB3BAAD0DEBC647609BD5882FEBBB5E0EBBA473707BCA3445EBD10144BBD92F314BD8DCE503BD0BAEDBB8F4B88BBA6E2E7BC104332BDB89F06BD1595B7BC2CE77E3DE3E21CBCE9E4EA3C7475A23D5DF4CBBC78AD16BD94E823BDC43B153B0487F5BD5752AABC6F8B313DBCCB003E84E6883D36BDA13D2170813D6E2232BD1B43F33C26A6B0BC24DD59BDE7B6863DE8B5CA3C4E6ADDBCB0ACE23C5A48C63D1A163F3BE15B3DBDF38245BD53259A3DD225353C238C96BD2F6D54BD16FDDFBB5FE4093EBE49893DF71B65BD3B210A3BE9CBAC3C8FD6D1BD7C6519BD37B8B93B92B34B3D49502EBDE3D90DBEB948AFBD3425073ED4B25EBD8E99CCBC4EC08FBDA9706E3D4470253D7DC886BD71D31D3D8A88123DD8328DBD489341BD51ED2DBDAFE3813DE9E576BD877B34BD1471D53D0D4E9FBD2992D2BD22F295BC132D433D1A9B07BD6613B1BDC95524BDB2B9863D7F265E3D1C3C17BDFF91E83A2822573CDB3C5ABDEDB6BC3CCBD1DFBC63F17B3BF19E773D79757D3C08BAA7BDC623163D1684603DBDF5843DA50FD23C56A563BD0FF828BD9934A8BBF9808B3D7C3A03BD89FE633D9B2885BD1B03B93D7E0CBBBC15399C3DB3B1C9BD4B0FA93AEA07C03D25EC20BD076B4F3B3507923D92D32DBD96FD2ABDD31F973D8305FA3C86C195BD0492D5BD17B0203DB644B3BCC929B53C0BABB4BB15ECB33D5DCA0D3C7392963D9EADB3BDFA771A3D1DADE6BC1B5C0FBCDE23FB38428430BD05A9C83DA3176ABCD6B5D7BCFE42493CB3130A3D238C5BBDB63F283D440190BD635815BA5CABA03D7A4090BCC58FD03B3C9CD83D739B053E35600BBD88CBEC3C5F16A9BC866FED3C00F98A3CD9EC943B1193F33C30D48B3D9C20383DA651A13D870061BDA0C0D6BDD4F88FBD07B22F3B7851C3BC8B07823D5AA1633C6B49543D7B32053BC7ECFD3B209B8C3C105289BC830439BD1BDE823CDCD49A3D388CEDBA5C3DA83D0191983D2BD7243C370219BC5C1A66BDD519123D2BCC21BDECCDB43B384B83BB1722763DA74DE93D782D273D9E6631BD14C6E73C80D7703C955E4D3DE47884BD14AE21BD9BBF273B76FE8CBC7BA41DBD1ACDCF3C215E913D4D4E403D3D4FA6BC6BE0B7BCA89591BC5429163DBE6A403D38EC933DBF79433CD7370FBD82C6B0BCAB6BA53D74D770BDC162953C4A098FBD3E6BB4BCB3D6D0BA5993BEBA71448C3D2CED72BD6599AFBC25F2E53CAA5E433B426139BC0658A63D3A9AA63C7992B4BBE566AE3D609F043D7F2A7ABDB3F8D53C801E8C3DBFC4FA3CBA178B3CF537AFBC7A6E503D2EAA823D8E333DBDFAC1883C2C633D3D3F51B63DC205673D49BF1B3D860751BD4DD2FCBCD479A2BD4552203C1852693B07BAA03DE20508BDAD1206BDF45AB6BBBCE8CDBCB0F8CABD14E72ABD6965643D771A973D0A3635BD5F3EF2BCE9C2313DECD66FBC3A51C1BC65E00CBCFA4CD43B652BD2BDB82904BDB984C7BC2798803D72CA81BDCD0AA6BD84711CBD173E933D906BA53D059637BD1712EBBC54E1923DF785443DAFBF24BDBD33A53D2852043EF61DAABCAB14D4BCA0148C3DF9DDC13A557DBABC75A946BD22CAB63DDD720C3EEEF52FBDD498743DE68F603C419DF1BBA4485D3D80B20EBD3F6665BB6B30853C1AF1733B7101483BDD7A1E3D817BD4BCEF5378BDAB8593BC270D783C300E86BDBCB0363DA08A37BDA638C0BCD0CF483D85CD4ABD245099BCB1519BBD984A8BBD7072723D978A7C3C73DF373DB7A486BDBE62E93C99D012BD096DB8BD53A93D3D1EBC9A3DC02E4FBD8349473D03EC1A3C32021F3C718EE1BCE5C1A8BD5F108A3DEA4DCC3D34A6993DF251433D3BF14FBDBF4D173C5AC6363CE940A3BB36F624BB1CB25EBD170262BD6CDA73BBB16157BD9E91E2BCAAD21ABDDD4536BD7C05673DF53D843C048E10BDE26B073D119E1B3DC3771D3DBB1BD83DF4D6A0BC827574BD5D8DE8BC19F99B3D65392A3D8E8D573D3A7C6B3DF564FABC72FB923D089219BD72B64E3D6509603D7D1EFB3C3E0AA63C62CE15BD464E663B3F8FB93DF00EB5BC0575303D2FF37ABD395E563D52D0C83DCAE4B8BD024F5BBDF96352BD5B04DB3AA6A5903DEDD16BBD40F976BD8DA7A23ABFB84CBDF4BF5FBCBF83C8BBC92F2E3CDC0552BD9684223D0E7CA0BC2F8AF6BAA4BDC2BCBF31B13D1552463C08F6ABBB5104FBBC13D08FBDDB7D5ABC978D7EBDC2E890BDB240593D033DF0BBC132C33D55B72C3DDD01F8BD4A8FADBDE2E10ABD560810BD43D77A3D8B31003DFDAA01BDF9DED2BC919E6E3D02BA7A3DCFFE6EBD902030BD7CD082BC2945A53D78A4CA3C3E3C5A3C53953A3DCA8E61BD1B4102BBC9E50D3DCB767A3DA86D203D530140BBD3E4D6BC710A853DE455913C566CA03D08015D3CB725973D6D92EB3B2CDAB63C80BB6E3CD0E8AFBB1ED7A23D0A908C3DADBA90BC5F2D42BCD26BB5BC24A085BC843F813B2C29413D0E99423D354984BD89A86F3D634AF5BC81AAE5BD31D562BDEAA39D3DBF82593D017D70BDC040903DD97CF0BC2677113CEC8C73BCBE8DE13DBF04CABCEAE1CC3CB206AE3B14398BBD996FAD3ABA81D93DA27E973C4D68F4BB3C285C3C44D991BCF19508BD06A4FFBC9422863D538F4BBDEA2A62BD67B65A3D3EFD4B3DA817BEBD4757603DFA2B31BD5B38CABD59548FBC5D299CBD2064273AEC29833D8BBB9A3DFF0AFA3C23E6F03C89BC9CBC4D73213D6C0CFF3CD960D5BC15895F3DBA594A3D901C40BCC3AA70BDC8BF96BB7626013CF7B2DA3D353AD13C35114FBD26BADFBB7D80EEBCC3A0B53DA2B6C3BDF86EBABD2A8583BC9BDC28BDAC62ADBA0E05B8BC83FBC23DEEA5D03B37BFC8BBF93FEBBD93DFB53C1DC010BDC05985BB050B48BD89DA963A859187BDDECBCABDA7A045BDB95A6BBDFFC435BD003E553DA94B103D456C8C3DCE07D63C2F9EA5BCC337613D17B3B63C83393ABDBB2EECBC71ADCDBD7F6B583D8EBD393D076B753D6C928DBD3B54323DA38DCE3D1F5D7F3D76A1CF3DEA04AB3DE31036BCE21360BD89E24EBD4A841F3D2A65AE3D8A84AE3C94C1EA3C015CE7BC22435DBD58D450BD6F58223D269B47BDF2D0093D8A62E4BCDD79243DA7FD413C2590673D9FD720BD1EB7E03DD1895DBD029D9D3C6FC10DBD6B41853C08D1CD3C39447A3DFA13E33CD8F8043C72413DBDBD81EEBC4617DB3D0348F2BC1EC84BBD4B12473DF28A853C3417AC3BEF0A9BBD3C09CFBDF0B7413D4052153DF75FCA3C8D6B483DE0DD8D3B7BF3783D9958693D6BB33FBB2FD968BD7D3B5BBD5BCD713C61A18A3DCEEC423DB977DC3D3A080E3D5DED09BD6D8A4FBD2C6703BDFBE08D3C8BF9943D0F16943D8A723E3C1196C6BC825371BC4CE41C3D0104AB3D522CA5BC49C797BD684D80BD564F3D3D846FD4BC1E11EDBC5E66053DE084B23DF323533DBAEDE73DEAE5983C46004DBB6F20333C08623CBDBA6186BDECEB003D80C545BD94D293BB42648F3D025A28BD3CD8E6BCBA9D80BC908577BDB8E02E3D1BA593B9BFAD55BD3B72DCBB750CB0BDF260003D8341A0BD8C4C7D3DCFC29EBC68D59F3D960F9D3D72A163BC4051D1BB81A7423D19423BBD72F1CD3C34A89E3DEF1974BCB8C0B53BD997DBBDF6DF9C3CA4CB903CDF45F03C69A8043B5A14F43AC96B163D91425BBCAA5CB53D842940BD37B7F63CEAA6513DF2F14D3DA267773D4C1FC2BDD15F9D3CF0F724BC2B610CBDAA1D0ABC4494343C234EB63BD7AA383D8E1D083DF0FE9BBCBA1910BCFEE9CB3C00F2DDBD3F0F34BDD78A4ABDB13000BDA5F835BDE1E232BD0717B03D212EE43D6126B4BB2AB2DBBC25C2E9BA1A8EE33D040F8A3DAA1E303DC9C30E3DD96EF73CB55F3F3DF644BBBC3284B23D57DB9BBD63B5C03DE96F7CBDEEC6803DAE5156BD4911863D64BE983D99F8C63D9A5FBBBC0908A9BDCA9607BC74E0E8BC623375BDF63C95BDC09665BCABD18F3CA08B343D19092A3B95DF29BD95DE523CE028CE3CAF62623D1CB4F23D290531BDFEEE56BDDBCDD73D1A414B3C328269BDBC44313D36ABDB3DBED42E3C11487BBDFD63D83C9E0687BC06CF27BCE5DC15BD877F463C71111D3CF4CEF3BC785790BB4166C1BCACCDD03C6315FCBC0CC7CA3A8018F83C6339223D67A9A3BD336E953D9C305FBCD1D32EBC79FB6C3C7660A4BDC48D4D3DA5A89E3BDD9759BCB772CABDE7E82DBD06DB9C3B4BF05DBDE262383D594597BD9A0F3DBBDF99BB3CDB06FABD83B7E6BCBA4445BD37E2003D9529C63C977C3CBDBF6C333D7BD255BCC9EC313DB8612EBD1F6858BD0B5AB33D26E5C43C6ECB29BD360A5DBDA4CBEDBC66B286BDEC6056BD7AB3B4BDBD2593BBE1E6B4BB1B3E3B3DDE9D0E3DC5E4053D4F0D7CBCF286723D7517D6BCA9BB8FBCF5ADF43CD3D188BDFF4E963DB137B13DFDDF0ABDAE783F3CEB1CC13C7032D2BD6F397F3D7E9A143CBB0780BD014CC1BCC4D33F3DCD6204BD7F30713D2DBA22BDB18E413DB82BB23B44FF88BC276D92BD417074BDCEFFD6BD0E090C3DBA1B39BD732CAABA8DE1873D92E180BD4249E13C0D1ADBBAB1C1263D9B0001BD28417E3D5C8214BD0411BCBCC6D57DBD9250CABC273657BC274781BD6FE30C3DB446D03D04BA3DBDF78695BD872D49BD9729593D21005E3DC66AC83C5587CABD4044353D97F2ADBD41D65DBC655E87BDDF27A5BC53FBDD3D71D38F3D64995E3DC35CA13DA3C5EB3CCEFEEC3DA522483DFA812ABCBD1A85BD1DF0083DF1F5B139A09BB4BC052221BDF709CBBC637957BC4FB9A23D06EB1B3CDE838A3C928ED43C973BC93C7FF88439616EBABD34DB2EBD693C603D036D40BD0F625C3D8128193D0EBDA8BDA6288E3D48E0CB3D4F610A3C7DD84BBDB0922C3C420AA73B42F1743D5AE9A43DB272623DE4B5553D9E5B2D3D13A6BEBD6B1138BA6154383DA84A98BDE4F78CBC602459BD63D880BC939D513D59232D3C085FB2BC856104BECC32433D6913923DC1B247BCE074D33C38FE8BBD4F4E513D999A503D632749BDB91A993CEFAD853D086F10BC251EADBD3BFFCEBB8246A13DD46DF53C69866ABDB87FF4BCDFEF08BD2B42C4BD1CB47B3D4FE1E63C623EACBC00AC9E3DA3C9CE3A077F133D1E3DAABD8C386BBCDA9AA4BD6BDBBEBC0A9875BDEB2DE5BC9DC519BC46BD44BC1BCA9FBDBB38973DCC9E9ABD50176EBDC71C84BD93A98C3DC20C563DC883903C1A5517BCA556EB3C0EF052BDF348A0BDF3D7373C7D44433D2E047D3D84B61B3D0EE7A83D0634213DD72C7B3DC9722EBD697F6B3D98DF943B1F2D813DF180D3BCA7AA153B47848B3C6CA0D7BCC2C97EBDB25B9C3D9FF74BBC66049C3D4CC18C3C62BEFBBA275FAABB927DAA3D377FE6BB36BAC8BC9C107D3D315C8D3D62572BBDC51D923D269284BC492C87BC555AB63C2D9A80BC8B87A93C3B1558BDB5DF0BBDCF1F8D3D1ED5E8BC02D4BE3DB55A4F3D51A7973D26E6523D8A7DECBCFB779E3C713718BCB73362BCFF802C3DE682CB3DC9C7A6BC78A5A93DE6BBADBDFED35ABD6F4E36BD2AB1133D09BE843DBFC58A3D8273A3B9F76A6D3D3CF2903C51A26DBD145194BDD4BC3D3DEBD4923DAA9CC3BCED0C9E3D829B63BD3CF023BDA0EF0EBD8FD9ECBCE84B92BD076D02BDB057693DC5AE4E3D95E336BC7B36F5BC4950A1BD8A9F7BBD8DFD4BBDF0BE873D9FDE833DF5EAB6BC965DCF3CD25AABBD1498DC3C469D213C68431DBDE062E33AB55F82BD378257BC77668B3D694BF33C203A543D6415883DFBA838BDDBDEDDBC2B3F923D486E803C3CF239BD593558BDD8E2C6BCB111FD3A51A417BC78FB62BD1C92B0BCA83B5DBC335198BDFEE7963DE346A33DD229873C57E23F3DFBC867BDBB893A3DC7368ABB2B5B13BD7638953D23A0ABBC5919C9BCDAD22F3D211E24BC557F9BBC8F0F93BC55E596BDA65E0CBD86EE88BD4C98813DAC7039BD52780FBC8CA792BD814A8E3D71CFA0BC3FDB9F3C18449F3C21E4373D1F0414BC60FB37BD80BD633D3432BB3CC89A863C72DDB2BCE3F94ABDB1CEA03D4D3223BD98CDD0BBF3BD553D64B58DBB9A015B3C71011B3D53D24A3DA75116BD180D7CBC459E153CD5233F3C8A4B8BBDD35D4839571067BC2E8F043C809151BDED6679BD748099BD2E75753C381582BD31B88CBB794B24BD8F1686BD355062BB0D748CBD393885BC6CBAE43CFED45E3DC51A5DBDFD5612BD7601A2BDB33FA03B4777B7BC51D2D73C3AADD4BCCFAD4EBDC1630B3D0D637ABC972A153DCE9A093DC708B1BCE8E1EDBB7A68683D97A339BDD6EAD03C23BF0C3D753AA23D3EFE393DDD4026B960A8F33CEA4A203DFE0CD8BC6848963AB9E029BDB38A883C203392BD130199BD667318BB1D26AA3D47BC233D6BAD993C254D36BD7DD4A1BD1FC3F2BCEB60F6BCBD8F5B3CA83E813D4EE99ABDA250123DF457ABBD625A3FBD0C4649BD2D372DBD97EF21BD1237AABC61D7943DFF61503D71D8A0BDE3B58FBCB032033DD32ECB3BD7941ABD5CFB523D9F9DA3BD85AF73BD24ABCEBCF5A793BDAB147FBD2556033D1754603D56EB713DCC1881BD5AF1933DC27F973D45379DBD9F7282BDA89AAE3C2ACBF83B51FF19BD01E5803D849495BD921247BDECE8FA3CBD9BA23D0A9C493D9BD2BA3B8213713D3D018CBDF30E5FBD0F3CF1BB73EEAD3C597F7D3D44D29EBD901DA13D8CAF7EBD2368D1BC86FB7ABBE0DE81BDB5E27EBDB2AC703DB1E8593DE0029E3D55D462BD5F8B06BDE4F0703C26773D3D87CA51BD4557F4BC9CCB153DEEAAA93B508787BDC8EFCCBC082607BDF5CD8CBD6384D93CCE45A4BDB387533B6F1E3CBA49C291BDAEE820BD3F855D3DD2519CBD554E20BD438E9F3D0D3318BCF2C3CE3C22CD933BE9AD45BD1C6403BD7F1381BC18561C3DA1A55DBC25331EBDAD75063D3998993DE2731C3D89FAE8BC0B91783D5AA1973C914D50BDC59DB9BAC2B3553D74E8AA3C93D89EBC881973BDFF4CA3BD7831A33DD3D920BD861C62BB99A4EEBC14EF90BCB253333C8C33423DFF6B0DBDDEA892BD040A8ABD49521C3CFDAD0A39F45225BD7DBC373D5EB0E6397598263DE2789A3D255B97BDD79FFEBC991D2A3DD523543C5A1F3A3DBEC171BD3DF1243D41E1033B60EE283D2CF795BD72A297BD48EF6A3CF5B8D0BBEBE2A7BA3C6C733DAB929D3DE596B03C2FAD553CA10A71BB73A11B3DE9A4123D3940A9BC9EC1883D471F723CBACF7BBD0F0F0ABDA74737BC76738A3CB55259BD264A3A3D30A8743DB9CA51BCBF509DBD6D72A1BD678E803D30C558BD581F963D6A0A363D8490A53CB2FF783D1EE80EBDE3A6833DA33C803D56C5903D368529BB63D466BDBCAF78BD151866BDC392CCBCB0F2E3BCBD7E9F3C311B7F3C43309CBD881C69BDAC779C3D09464DBDC3DE553D7BA0883DE806BFBC56FE63BCBE1227BD5F8BB2BBBA048BBD30ED063C5182A23D5E1083BD4C462ABC993931BDC53558BD5E0C84BD3AC8FC3C92A77D3DFE1E3FBD3A12853BA85A17BD464A633D941064BDEDDB1F3D3064543D03024DBDE5C190BDB0BFCB3B623CB33CA972D5BCC9AEA5BD314104BC753178BD177226BD648DF23CB40786BC1D244B3D00A49ABD3F5E573DEE4993BD17104EBBA1C0A0BB747C9FBC7175E638FF3E6DBD966F143DAF11933D4853E2BC121492BDEC01B9BCB443AEBC2F2D4FBD534F8A3CCA112BBDF5E7A2BD54ED83BCE02A733D71F59E3DB06139BBF007C9BBC27486BD08C5203D49EEA03D25F527BCE0ED8FBC1AD4433D1329C7BAD2B8323DB22387BCBBDD433C2C6FFC3C2AEC3539E39FD5BC56EE793DEB8688BC07CEE5BC98859FBDCC652B3D2A6EA53D606C41BD940BB03C2CF3D3BCF6C9643D0F01FFBCD066F73CCFBE00BDF018423DCC6174BD79806E3DAD2689BD96419B3D6808063DE3DC053D8C743ABDF44787BD2C8D04BCDA9A583D2C6720BC388D29BDE18F0CBD6C1E2CBD09A6F9BA4C1A88BC974A52BDC9E937BD6CEFCE3CF9170A3C026310BBA26985BC8109D93CFBE4D9BC8E65153DE0C0D0BCCAF7833D7AC52D3D244595BDF5359BBD27F845BD38F8913A15E2A4BC02DDA1BD901CD7BCBBFA93BD4606523D95D0E83CB725143D3003B23CB0361ABDAB004FBDA9D682BD5F02AF3C888F7D3D27E2FFBB7750743CF5D1D43C08FB69BDC90A82BB45EB44BD3E3734BC4D3B453DDCEA6E3B2E18123C8BC2243D456BF6BC445D023DA1C3A43DFC5D923D8368C2BBD8CC103DD269B13CC400173CEAAE71BC359BA33D5D40633DEE1193BDF3E8A33D10B2A3BD993D65BD45074B3DA2469F3C133612BB753D96BD3D27693DC871C83C7E17253D828C41BD43CD01BC662C8EBDE42F8DBD1C1B653D10A843BD14D0643DD82B85BDF8FC1D3D37B246BCADF8B7BC451A52BD19032DBDD3B281BDAE782ABD81E6DBBC9B0172BC225C8E3D37E90FBDF9060EBC4030653DC0410CBD347270BDE2EB743D2A7894BDD44E36BDBFFB9CBDB36893BD9F2A833DDDBE92BD2C1F113B852F90BD02DDDDBB0733733DD88D013D74459F3CC116883C4DF760BD283174BDE0A54CBD3600E83B76EA9CBD83D502BDFC60233CF647E3BC4EEAFF3CC19307BD065F5F3D5FF9ECBC383324BCA721543D6F92893ABCC5083CB59C7E3D0DA1B6BCE3AD03BBB68741BD36AD7C3C8B7F8ABD18AD01BCB1EA883DA7EFEBBC094F8D3D22820A3D5B3AA43C08466B3D13772ABDB25793BDCDA8AE3CF3E197BC9AF463BD7EF11DBD13D3723D6310173DF04BE2BC431F713D47F0A13D23F1103BE81812BD4AB758BDF5898DBCEA803C3DC2BB17BD0F0031BDAA8C213BE8E8703D41C476BD82CC763DC1B496BD58D175BDA9B8A7BDDDE221BD12C1973D1577F7BCCD6FE93C8EFD053B31B363BD5193EE3CE195AE3B06F94A3DC6BEA1BCFC999B3D143729BD5E29A13D2B9067BC24EC583D10CC323D9A4CD83CB56EAABCC43F0A3D2DB936BDC6C6B63C9842643DA33AEABC4857143DA418A03DBAFD61BDA7497CBD24BE3E3C925A553DAC058B3C73E0BFBBD21BE83BB9041BBB47FF1A3D34F7953C4B13D2BC11BEDEBCDF1D44BD3D66403CA751AB3DABFBF6BC9E70893D8D31A0BD7F567ABC798731BD9BD1DC3CF592943BE713C13CEC9F58BD3DBE66BB3B60ABBCC8818C3CC199783D20DE9CBDA169523DD5BB563CF88B4FBD1D1890BD253E15BCB42035BDCF4E373B6BB9583DC7F6683D717062BD27C072BD4F77173C469E893DD6281FBD2DF034BD538A8BBDD6FC843DCF1EA6BD7571163CEEAD4F39580275BDDF0A9A3B1A269E3D08D4163C29CFECBCB243C23C40392E3D80CBEC3C43854A3CCE085ABDE22F893D2633443D98B285BD455F5EBDE4EE2CBC32F58A3CED8E34BDE8BF7A3C0FFC663D6D4B873D9806E1BCAD2DBC3C4C5ACE3C51C0153DFBC6DD3CEA8E32BDE9B59D3D8FC383BD1C0B733DE48D0ABD4443DB3C5B85223D345DD83BF1FE1EBDEC6A6F3C4019033D076A63BB942421BC8CFAE0BC5DEE5BBDE8F0AE3D2937D5BAD1F2013D4BE1A2BD5959503DE9729B3B9D5EF7BCB2FB803DE6B1393D3DFD523D9D944E3D3BC0EDBC80D1FF3C37BCE6BBA6B3683DABC8363D3A786A3C27A52FBD6C979B3D27FA0BBC56BE84BDF978673DEA3684BDA35E01BDA36CCDBC367B0E3D3CB21BBCEAB6B7BC51A620BD7BB933BD12EB11BD4CBA903D90A25CBD48BE8DBD0B0F20BD787E54BCD90DA4BD85B5D9B9E82C6D3D81D827BD77760D3D974D78BB97D4A63BE323123D9403993DD61C8BBC76327F3DC8BA893CBCAF293C3E9A9D3D72C4E43C9C4B4FBDAE8D75BB7D1764BDB256213D8F5C07BD3BF26C3D0BAB793C30D0353D8B04D3BBF2A8953D5A32A73C38621BBD865E7CBDC7FB593DD4CD8DBC1D82D43C84FB333D8F409CBD7D8048BDF5465DBD0292A5BDFAF6DEBCF60E70BDD6E468BDC837083D8B6B11BDC19106BDF32150BD919CB0BCFE9050BDFC8FC33C87E9573D63A486BD021E86BD5F0A8A3D39C16FBD0836123DC141C93CBE35E93C98F686BC570795BDEEDB88BDF2988EBD46DDFA3C08FE41BCDD42E2BCBB155BBD6EBD3B3CB89382BD3B7629BDB6281DBD6474B73CB34E6EBD813FC8BC25D071BDD18B09BD5A038DBDD0FF9E3D2C670EBD045CF93C31A2B83DB8507DBD7E92B43D54E0653DE7FA703D70562B3D08F4043BB1BCBC3D1FA58C3D7C8169BD693D863CA57E8FBDB689403D448D73BDB38E3D3C3C2B873AE8363E3DA725B43CFFDA99BDA44D91BC81F541BC50560C3D43EE14BD5C5528BD6F220C3DE71BCBBC7182A4BDE9DE3B3DE79C6E3D38623A3DBAB48EBD8F303EBD989D60BD0328053D6A7AEABC7868B03BD16351BD4D2F123DABEC043D72FAA0BDB62BA73D6FE9153DC4FCA7BD60E47FBD934F90BDECF3723CFA0AB8BCBB281FBD6E301C3DB5EA3E3DE62F66BDC57B973D2FBB4CBD7ED58A3DDB60A03DD917AA3C77A4D9BC8D3057BD7640BC3C5C2DC03CFC898C3D6982643D95043BBD563E433D44B49C3CE96533BDC4582ABDF0FD37BD7C967F3DF624C6BA4E50C93D745630BDF0FF04BD04317D3D72DEEB3CCE2582BC9F8EE63CD7A458BD45B7A03DD062673DF0A5783CAF1E843A2C97B9BD3E4BAE3DBE9884BD8F9B7C3DB7D471BD60A11B3D9AB063BA785269BC03DC19BD69716F3B6DF6803A197C49BD2083FABCA24B7B3AFE0D1B3DF3F181BC6D86043D8086313D3137903D4641583DFB01CFBCB25565BCC0D14BBD57DE9B3C32C2883D10D1653DC67EB6BAFEFCDE3D96E9BD3DE298893C0870AE3BB540A83CD7055B3D17E1B0BBFDDCA23DCA228B3DE3CA313D44B202BB3FD662BCFA8637BBE6E237BDA001B4BC42FE15BD9595D1BCD732B13DB80927BAA9741D3DE923CBBD2714823C7EFA123D5EC15ABDB8FD78BD76F98BBC48A59E3D949AD03D7A59493B990675BC9B7C413B31E098BDEC551B3C5D7090BD805D9DBC0A382E3D0311403D21C669BD5AAB8EBD3B763C39108973BDE28ABE3CD30492BC23E1A63B5CA704BC93C4AA3C037BB33C1C27943D7FC8C9BCD37284BDFDF0843D9B0A973DB2F9F83CF92642BD08CAC73B09FEFAB9985E05BD27191A3DF48FC4BB2969843D51F775BD117E82BD967940BD267979BDF5537CBB3E57343CFFDF933DC5F9B13C11FB04BDC80E25BD39E1BD3D1C30493D13BC883D7E3BB339EEF9863DE50E87BC12992CBD7E3B703CF07C653DD19911BD8A37A43C2423073D37B4DA3CAF2A433D3A1A16BC7BFD983D0CA7463B180257BC8C60B63B21C2B13D48D18E3CC016ECBCFE2797BDDFD0C83CA741D13CC57B92BD20166EBAF10456BD4A81C83C8D70813DCF459F3D49D3873D00726E3D03D7C4BDDFDB33BD5198A63CB548623DABA4C23CC7EE8EBC05229BBD1D1986BD9EED93BCA47E053DCFA3A93DA3FC33BDC54185BC43EF1ABD93F6B9BD0CB0C93C29EC16BDA36810BDC00D243D7B27793D02646EBD0F6F58BC47D8643D3E27A2BD5B34473DFDA3993DC9504B3D366E863DB00028BD3C2B023D4FBCAF3CBEC7993D0D00A3BDF01F20BDE313CE3C3CB757BC5FCDB53C92470FBD0843D23BF497DE3C266A813C738F0D3C8B0ABD3DB922AE3D436E303D5CC72C3D5E6AB13C252F34BD0B0E813C604EEF3C1387A03D73B5583D0D52863BCE277F3D0EE49DBC76CC5F3D332F34BD35EC91BD95BC7D3C004E1CBD74364CBDBAE9053D4FBD9A3D951E51BB63518DBD16A799BC14460B3D4C0FECBCBEB34B3DACA88B3B225B88BB263DC03C6DC738BDDAE0073DA5E563BD82BE6DBDCC956DBCA402DDBCD4D00C3DED2D8A3DF23E9A3C40BFFEBC0E93903CBC9FA1BC82F25A3D42485BBDD52C463AF79450BD64AA2A3D236FF6BC169B8C3D2F4C30BDC06B9C3D7C7BC0BC2306963D5D891F3CE47F263D73E6833C05F39B3D7623C6BC465D63BCD32C2ABD526C893D7544533D922688BD0DC2603DB7AA49BD35A22CBD44368FBD834C203DDFEE8DBC91F990BD117BCFBC71EC663D6A23AB3D9098013C936A7ABD840E043DE64B7F3DD038213D12C6A93DDCAC50BC0E8E95BDED6A4CBD8C8372BD2E44A5BD79AD40BD56A3B33D6351C4BCB32879BCCEA99DBDEC60823DEA8D1DBD417199BD00989B3DB03E14BDCF0025BC0732B63C33C58E3DCB8C9EBD13DD183D8FEA00BDBDC4A3BCB4AF28BA07AB9CBDC2F1C33B8D28083D8AAC633CAAD1A23C45174A3D22CFC1BD498651BC609CD7BCF6CDA93DDC9AB4BC01DAD6BCD1D8BC3BBC27353D1EE3C93B7EFE7D3D6CDB7CBD6A0182BDB7B8413DC2557E3A4BDECBBBEF12693DBB73553CF374B83D5735813D4E9C873C87538F3D3FC2BE3C81CD9FBD94AC99BDC74002BDD7E8573D340F023DCA13873DF574C73C258F4D3D3D06913D67E7B4BD13045ABD9B7C803DE41B7FBB582D77BD8D262B3DB7BC813D22E9FE3C5536AF3D6D3082BCFD5BA63C954BD63CE79441BD1AA4A63D8AF02EBDBE84603D0CAD003CF48E9C3D2CB0FDBC114756BDC6D1063D9358BDBB886965BDC7788ABDEE626F3DB09FDF3C606647BDDC77913DFC79CC3C5E8F11BB5A2DAA3C721157BD59513FBD80250ABDB4A8993D37D0763C2CE88B3D7AA88A3C93A7F5BCDC28803DBE432C3DDDD001BD6524663D5C50CA3BA473A4BD3BEEBEBCF72896BDC25856BC3FD4853D7088933C159DCB3C27CECDBCA03A103DA65C8BBC7F0A1DBDF4CEEA3C0C598CBCEFEA76BD272EA3BD76C1983D4D8F8BBDD8A9B33D4AA34ABD696DB13CBD89B8BD248CBD3C37BBB7BC55E2D6BC1607BABD64C55ABDF7E0063DFF135A3D4C4114BDEE96A93CCD4F513D541F8C3D22CC4EBC2C2641BDCA7599BDB3E5273C16703DBC78CF9B3DCA98343DBB9C7B3DCC1AAA3C24E098BDFCF76A3C8A7D583D26EA1CBDD5B2993C6C0393BCC8181ABCC6B7CABCA2401C3C1FA9D3BC9D965CBDD186143DE81A4A3D362499BDC1B4CE3CE011713C4B9F683D43EF13BC824386BDD0F8533D6CEC093D4F0C8EBD647C6CBDA9BFA73D1682B2BDE70B523DCEDB73BD35E1ACBDA3A4263D640834BDCF3326BD404EF03D599D89BD78BFA23D88C52D3DD2B7AE3D5C27423DA7D63F3A0929513D7D4295BD82190E3C8FEF8CBC8FF82CBC93915B3DF0C209BD3F597C3DB391E53BFC79A23D788F86BCDE644ABCEB2C6A3DA94CAA3D570B09BD81AB4A3D221F653CD9CC023D6CA06ABDA11E2C3C829803BD51CFBBBDD93349BCDAAB1DBDB8809CBD6EA3A23D40E89EBC42B442BDABF3063D808098BC009F45BC1874863C9E4DF6BA67A28EBDD1E3E4BD674182BC8DD525BD20D566BD7DD2413C4210803DA5B00FBD17F446BD214D02BDD68FAD3C6BDD183D5EE4A13D492EA3BDD71714BD188284BDCB5C88BDE36781BD0564AB3D08CF28BC8B32A13D9E9BAD3D2B4C1B3D74252EBD2E833DBD701A36BC52D40FBDE6AF8EBC5277B83C040133BD81552CBDBF293E3D20D4C4BC1E82123D6D5159BB874F86BCD318A03C3A5B023E61CD473D78592DBD6BED84BC79A980BD45714D39E44B12BD1C9A473DE2D9553CFED3A23DFAC5AC3CAF65D63C9044C1BDF8ADB2BDF8EB03BD2B6F51BD6D7204BC5A6A353D0AC466BBBE4D50BDA9DA153C71C2AF3C7A02A3BD5553823C536ABF3C7F8F3BBDB25F863C8C4F29BD778438BDA73CC23D3B7780BDCD72B53D713EDC3A1B45183DD015993B25E1EEBC42709C3D1B09A43D5A97A3BD19365EBDFCFBECBCFF77803DAAC56FBDA805623D64DB8C3D645A9FBD5768E43C137D71BC1310AEBD8FDFA93D8B812DBD57069C3C942F7D3D7153333D77BD11BDEFA62D3A57E7BF3C1472D8BC77AF973CE2EF933D5002863DF7B9DF3D45BB23BB169984BD0ACD943B38FF92BC8678F7BCA325B33C2F5EEF3C2DAA113DECE89BBD8D91873C76B280BC3A341F3DDDA5213DAB0F78BC7B79F1BCC45A9C3D0F81D53D9B3F89BDD5B4983D448D05BD60EF53BDF9394A3D545D6F3C78F6C6BC2771253CC2C6A4BDD604183D3CC722BD2FCD6DBDAFCC93BD9BBDB4BD4548373C4F92833C04213FBDD7EE9DBCE42F953DD91D5ABDB234193CF5EA903BB3C6113D20D4B63CBAD0F13C24C053BD3CB69ABDE00780BDF17D7F3D679B87BD532EC7BCA0382DBD8EAE563C3EA8E63DE3F4D53CA33B153D5359D8BBBC030D3CBB40A7BDF7ED26BD96AA92BCBBAD2BBDB734CFBC2E21803DEF2E163DA3FC0CBC56B9943DA2DA8BBC746A9CBD15AE003CD7FAD33D8D2DAEBD67CAD2BBCC6DD7BD42C35EBD2C31BDBC59AA9CBD057650BD1574913D86BC903DAD9BC83C5DD03EBD70AC85BCF9A0AC3C02874ABA398301BDD190A9BCFBA776BD221E3D3D723E313B105291BBED7C09BC4042963DF018633D08D19D3C708781BAF904A9BC5F4D9B3DDC861A3D8F3519BAAF50493DFF286ABD0730403D5387733BE2EF24BD7FE119BC1A3C953CB7C584BD80D6983D634E51BD4EB0553DA7F582BDFC06A53C033906BD50339DBDF8F7AF3D7679C3BD8227093CCF2E923D877208BC221C013DC885193DCEF4413DF491453C8D43D83C1D21B33DA12EF23C54766E3C819F3BBC8BE423BDD642EF3DE49A2C3C0AC4B3BDD73701BD7ADE0CBD01FCDB3CA36895BC53E7873D3BD7AEBCFCA238BDC8562B3DECC39ABDE983A33DE19A553D55D1D1BB9FC5173AA1403F3DF33150B9DAF4943DFB350D3D4369363CD28C303D5A1ABC3DD9E2313DDA5FA0BD5ABF00BD06A333BDFFDC163D7052F93CB25D953D72BCA0BD90B18B3D776213BDD3F162BC8CA0593D813F4DBD7EB8D7BC68C6B7BBDA4E853DA860F63DA3EE8E3D0F7B543D41A8F93B1D31E5BC9E1359BDDC41063DF90BA53D67ED553CB28EF9BC35705C3D069A9F3D0824123DAEE9D13C6AA1A4BD1E225B3DD165A83DFAB9243D04A896BCADDC603C63ACFF3B673B8DBD86180B3D7959C1BB6C6F513DF955FEBBC441DD3BAE1857BD660DA6BD4923C33D76B7BFBD0FF7253D85B8D8BD795BB4BD0290013D27FA553C0AED35BC12C3513DDE9F98BDADDB43BD6A7D4D3B2C0E1D3A7EF8403DFEE2B53D0A8C743BC529B13C36E163BDE00A343CC20BDDBC68136B3D508CEDBCC43FA83D4C258E3C378F9E3D9BD49EBC0AD9C2BDC6B6FABBAB948A3D43848DBD1519C03DC4199F3C1EABA63C3404FA3C3D1D95BD8D9BB43D3D748C3D37683B3CB08E8D3DEF7C2F3D8B15423DC1E98CBD8DE08F3C5C8D5EBCED6D353D5DC817BD76BE1FBDBAC0963D410E54BB15DAEBBC533CEF3D9CB974BDED0E7CBD6DFDC3BCCA4AF8BC921181BDC022A4BDBF89CDBDB62898BD130B713CA36DD93D880BC1BDCBD41A3DE61373BD9630193D0EE597BDD9B0E23DE22F8B3D2ACFBA3CB99DBCBC4556983DC38D2CBD132E403DF371893D383156BC231684BD02F735BD12744A3DC9C86FBD2763CABC2152FBBCEDE2923D605A223CB91376BD5DF98BBD858E99BDFF25BABCA47AB43D0AD2303CE24B95BD0C07CABD1A1DBDBB548FCEBC46249FBC4ABE083D8A9F803C18B3E1BC3617CB3DF0E0333C0AC10C3D614F393CC27DA13D6BD9233D9D3250BD8BB09A3D129FA3BD9942003DF3B58F3D8099863D717F933CB04A43BC8018333EDA2D09BDA8B27C3DFB21FCBCA4416F3C43166DBCA022EFBD52F2ACBC9124EBBCCD448CBDEA2336BDC0D0173DF33D93BCE2A9DABC725705BD01639B3B8A5F973C2243BA3D97848BBBEED5BEBDCE64533B87E54ABB70B6A5BBFEAD303B4E1C2B3D1C21EC3DA6D7153D7A7A9BBD0617863D2383AF3C6F44893D7794EB3CB74516BD39BDF93CE0B7CA3BC56BB83CCCCF193D1826A23DF39A95BD82F1D93CE1AE0F3D5CEF0F3CB12943BDF8EB1F3DB96EAC3D8EFFD43DCDE4C73C0516623D877F8C3CA2CE633D2C38823D97F5483D04A77BBC8D602D3DC4914BBD0472A2BDD3F54E3DF9FF1FBDB6F2533DAF3ED63D690347BDA184C6BD8EAD8EBAFC87EDBCE0D3383D6BB2ECBC068CC03D5E05DE3D3CBD943C297680BD671441BDA777B0BCCE67EF3CCC7D56BC89A8643DDFDB6ABBD601BFBCDDFB6E3D5CD0B2BDE5BE503C23F03D3D94DE80BD68B368BC6A70D23D9A3ADC3A0BE8EFBB34F2203DF87AE33C80A587BD8AF7EE3CBBA6423BA7CC50BD8A4BF3BC384BA43D8929073DB09F51BDF4F2EDBBCDE5063DAD61B63D2DE23C3C27FE7FBD9870913DC3CB18BDD750E53BAA3D9BBC44AA713DA1E324BD4267BDBA3EAC273DD03A753CDFB1653B3AE06F3D7623BABA4F1A00BDD95A883D86F9923C560659BBE9EC41BBE7EFB03DE731293D0A74833DF20ECA3D3106B5BD8C41563D4872E3BC008CBABDCE5BD53CDC8496BCEE65ED3C96F4CD3C7592883B56579CBD68B56D3DB0A7A43D762DFEBDAA212DBD274F483DB955273D1D1A80BDBACEFB3C301DC03DFBC37F3D25C5813D1EF3AEBAFC83ACBD9B9F62BC5FC8C73CBDEEAE3D36C3A43A68DCADBCB70CB33D7826773DF9BBB93D2637763BFBB9313D9C83B2BD3C88A43D8826C5BCEFF4A0BCEECE3E3D62E217BD59DFB0BD75305FBDA5825CBDECB9643CEA88F83A740088BD0783E63B913D50BD6E05833DED8DD3BD0D00993CB5B87B3D24C2EE3CF4A6C7BC32DE06BDEADC54BC3DE4173DE1CEA73D878911BB22B4A93D2F77643DF308413D80E293BDDB4B883DF20165BDB5AE00BC611D73BB942888BDF8D0C63C8D4A5F3D9CCA183D22CA67BDCD283FBDCBF2B0BC76C2E1BA1E2168BDC821893D748CA93D53DEAB3D56B9993CD420283D75FA70BD102DCBBC3ABDA23DDF7DE43D9A45023D88BF97BD4978763D977947BD4E37E3BCD222233DB28A5B3D8785AFBD7054AABDACE0F93D259AA13D9770483D4F24A03D40741B3DB22599BD2C683D3DC6D7BD3CCB5DB5BD34ECE4BD221EAB3D8AB3D43D47ADADBCDAAA10BDCDB5343D96F885BDA8106D3C04324BBC8A16D23C721153BD3FBD3F3D8C403CBD1B1BDFBDEE04A2BDA3357BBD505823BDBEBE5A3CD768FF3DDD1FE8BCC0E35ABC605884BD1A6B233D8E3ABB3DB808853C1F11F93D8D1C29BDD9895C3D87BA903DB97924BC02D7D3BC454B0CBDAA90963CA137DC3D5F6CAA3B94FB6ABD0FD02F3D31F8033BB89BB8BA8A6D2B3C39A583BD4D4B94BD69880BBD9A7EF3BCD04D3C3D59F7733D5D3429BD8F14833D79E87ABD3A1EC2BDF2BE843D3138543C0F0AE53D9098B23D9FC9863D93C898BD1C57FB3CC6849EBBAF92B73C309770BDDA1DB73D4DE8B6BC0A003C3D7190703CBE6407BD6941C0BD24F6F73C4971303D812608BD2D037BBD7A12EFBDC354C0BD9495BDBCBE39D53DE397883D0465A03C83DD313D266434BDCA42C0BCB16496BC4362B03D84B07D3C3AAB933D9C610FBD61B8A03D9039CB3CD79BB83DEC6C47BD72AE17BDC6AAAF3D13CAED3CB5BB3ABDEF8005BEDE477CBDC8A20EBCF22E3DB8CC94C5BB5CD22CBD009C853DDC64463C3E7403BD8FC41ABD17329B3D4C86353D689A2A3DBAE9A73DD49F95BDC2C087BD6981BD3DF6AD123C6DE8123D3128363C435746BD165FD53C28E195BDB81F38BDB7B535BD1E6ACFBD59D52D3DCDB18DBB78DE10BD8334813B2954633CCCA7F13C6AE46DBC606CDC3C2BF477BD95C80EBD11F1DBBD3992F9BC63DFF23DE805FC3DAE70233D08717F3DF36FCDBD77CA773DEA94473D1ED8983D3034963D14F4FD3C166B35BD8CCE6B3D0F9086BCFCA2C0BDC641FE3C8BC4553D10D5BD3B5C2EF03CEA86C4BC8F209EBC9F1B02BC7ADA023E9C8C313D5675E43DD90094BD7EE2133E3F80B43D74F89F39811291BCC990163CC9EDE73C0C51833DC768953CD1A53A3DF415D3BD5057943D384E913D1A2475BD9E91ADBD771BE7BC7BBEB2BCE482B03D91DC423EF87819B9524BF53C040083BDBAE067BD40B223BE3D7C2B3DF0C8C1BBAF4D083E3B3640BD35640A3DD19EB13BDAAAB43D51CF813BE55213BD49DFAC3DB8EAAFBCCF0F93BD2AB9C83D4891963D53013BBDC9A6CABD321601BDE1CBC1BD14B687BDE0C4E0BC3629E8BC75C94D3D1D148D3D61D0E53DD03E1FBDF046833C3CCF89BD843A933CB1844C3D73BE68BD2693FE3C75F6D0395108073D1FF6AE3CEDC66E3D3E83A03DF3FC3FBD69DF81BD70DF593D9A0863BBF4FC06BD16B0BE3D3C30D0BDE4181E3DAB14913CEEDFBC3DB6B3F9BC08463D3BC607A43D96A2B0BC9145EBBC14B0863C4B7056BD99F767BDA7C02CBDD57B7F3CBD72F13C84517D3C3D3A813D1A20D0BBEC2BDCBCFE592FBCD4B28F3DFCD1513D7D7488BD127FCFBD08ED97BD2FD362BDDF2C2E3CFA4E553D2A77443D961CE93D7C0189BD9904593CF700FCBDB4634FBC8964C8BABFBAC9BD4B26A03C7E8FB73CDDB8BB3D4C079D3C9C1806BD8FC8D23C7009443CD7812ABD441C44BD8E788E3D787B09BBEC42DF3DD2E9ABBC063B363DED5FA23D7B7CB1BDF35D7DBBA2E1BEBD0B95C8BC4D85143C074693BDE8AC95BDF8FED83B82B0B43CEAAB623DCBE38F3DA816203DA8D2EC3DE6AFFDBCA21D8ABD0350B43D8A6663BDCED3B3BC5B97EF3DB12783BD75A8803CF221473C8F080DBD4F77C63D23F7F6BB4F9F35BDDD77883DB4DFB83D33A2A0BC7DC0433EEC53BE3D6A753BBDE9A4EA3C62B8693C7ABA16BE983ADA3CB812DA3DBB218FBC8F8A083D4E908D3DE4B3013CE5070ABBEDBEF5BC79D17FBDEE03103D5F3F71BDC91D963C06FEA4BC1A55F93D27777F3D48747BBDD39B26BDDBF838BCF732A7BD7C42D6BBDEC933BB9DCE6B3DEDD942BDC258B73DA973133D93EC213CE79B363DA51D18BDDF32653D0E198DBDCE2BF73C7CA6203D0329D2BD34E7E53C5B8D963BAA1C933D791D203A2012C7BCCACCB83DFD77A1BCCC643BBD92FA85BB08F37CBC9D03803DCF6AABBDD55739BDEE155A3C5DEFC53D6BDB973DFB2EA1BDCCC036BDFB3C8C3C6EC11FBDAA61F2BC0BFBB53C52B76CBB51AA1F3D6C0D663D30CF023ED3F8E03DFA7E463D1F1CA13D28E217BD0FC3C2BCF4D779BD64D6A9BDD5D3BEBDA91BC33C594DA13CA2EB5C3DC1C5F93C22D9B1BC291056BD3DCC07BD1D632ABDF19587BDC84B06BD66B148BCA352923D7C0F643B5C5C2B3D775BE73C29001FBDED23B83DF04A84BDB562563D9A4486BD218ED83CDB76D73CC0D33E3EDE1E18BD2A34B13C0B39463CC59411BD43BFCABD0B012CBD2B50DCBD40A7E33C82769FBD6D0A8F3B82F6893BB26E173E038EBE3D50BDA73C3B78273D15638B3DA284183D79DCB73D3DC794BD71F4583CC95AB3BC45E5D13D27CA25BD72F06F3D2FEBA9BDEF7544BD71F6F4BBC70061BDC44B5DB7CE22873D5CF273BDD882353D707D253E21BA55BD0C488CBD34BF6A3DF050A23CF8D225BD4C69183D12E7933C56D8BCBCE9A7243DDA3A6DBD202E4B3D7EC6F8BCDD26823C744ABB3B6B2F743D13264DBD3889123DAFCEBD3DA0AAD73D85BE343D31DD013DD55555BD9633A1BD858F1C3DB988AABD897BAD3DD738A63ADA1E1FBDB65AF53D9971B43C0F3235BC2243BDBC536650BCD5A240BCD356AF3B9A7D683D9AFAEC3BD3DF4B3DFC7B43BDD4E7263D9413833D641257BD7F70653D9E6F1B3D84401DBD7FD1DC3BF44D1D3DCCD1BA3D3C8F13BC21C2A8BC175E063C359C9E3BDD6770BC775F193D414543BDCC02583C5673363D8C87593B03D3C93C9A0D113A79C56FBCB1A0473DFE1110BCA018083E6BA1BF3DACFB4FBD718F20BD8C03843CF29EF2BD408699BD15F76CBDF0473A3C9F2209BB04708BBD0ACA853D679293BC237B52BDD6DFEDBCB5FE343DEC0773BC92D976BDA259193CD0BB15BDBF606A3D7A66943D2337103D3793233E16C79C3DFEFF633D339E10BC649B0BBD9734DDBDE37A9B3D64DA9F3D5346FA3DA24B1EBD498EC63D4F8B883D51B859BD26ECE73C603DDEB9188D1CBEAE1977BC769491BD56CD573CFBC39E3D7060C43DBC86C8BBCCCBDE3959C3D7BC0EDC85BDD5726C3D93AA2BBDBD006B3C57AB95BD867CBC3B511223BBCDE3E53C597891BD1DFA8B3B82572ABDE2E8E83C5DB1A6BDA6F9363B99C6BA3C79AB5EBC41FAA2BC6B71603DE1907C3C4632C1BC8B3C7EBDF957B93D715FBBBDF03B97BC8D3A713D858B6C3D991F35BD496EA4BCEA22833DDC34733CECD483BC239A3D3C0005043DE399D23C14E421BD64099B3ADAB33F3CBBAF443D9B4ABABD779C9EBCFA38B1BB675C55BD864486BCCF30633A554A9FBCE8B579BD03B2103E0932EDBCD0D8DDBC48D57A3DE8CB293C5A7E51BD844D703DC8D3B13D129713BBF4E8AABDA736E8BC9AC19F3A060141BBF3DB153D093D10BD565192BD3D0494BDED5D853D2830963D0B9E683D07846FBCB30B22BDEF381FBC118996BA6C3B4BBD97470A3A6EA1EB3C2D8701BD7970AA3C69991A3DAFA0603DB68796BD11BD66BDA35518BD68B070BD1A3D063D40BD27BCC7FEFC3C96AD12BDAFB3B63C90F376BD04B3A2BC710E4FBEFD6000BEEB90E9BD0729A83DF1C53D3D2F2CB73C801C353D10A365BDDDCF543D0A7FABBDCE0A89BD3B97413D78363D3C657AB8BC792122BBE220953DF048963CB680E63DFB13B83D243CB33D5640D73C732BEEBDF983783D8DE1423D6B021A3E3DD835BD404AD8BB130F0CBD4035D8BACE0D8DBC852914BDE096C8BDF160F6BCFB98BF3AA2A9CB3DD3FA053E4EA61E3C3427A03DF20F023D51C0393D821520BD6412323B11E4823DABF5873B0A6F13BC2F4ED5BCDCC5943BFB237EBCD52C0F3D499BB83BD7A2FCBC6FAB513D8ACE7B3B849D033E05AD6CBD7FFB8ABDE487083CD6DC073EB48773BD67C40E3D45E388BCFF0B6EBDF446F73C33FBEC3B54E0C63DD1D7B93B827669BB3263BABC63F0AABDAEC39FBC4667763DB4A9693D4797A53D4E19723CCD4F863DAB2BA7BDFFB44CBDAFDC9CBC0ECF4DBD760333BD1D79203DC399533D88C2DB3CDEF01FBCAF0A0CBD9C83A0BB936F9B3B8CB509BDD2AA3ABD0B9BBD3D7C3F40BC27D4A53DB5774A3D90608C3D70B392BDBD1D91BA2826513D5D5AF43C2AC70ABB8E30093DEB2F853D77EF97BC542F97BD8A5EB93CAB472EBD314E9E3DB711B3BC94D7643DA8CA4EBB326C0D3DCD0D86BC829142BDF3FC36BC02718A3B6B2388BD60D0E63DADE8B33CBE0ACD3C76014D3D09AC993D7EEDCCBCE910FE3CD7F3873D5F6401BDDEECA93DB912783D2377553B36A1863B47D415BEDB7FC5BDFF77B9BD107474BDA93C19BDEA452C3CF6D91C3DCDEB41BD4DCA9B3C9612D13C15EE28BD7297ABBD6BE4443DCC0604BD56F0113D8E82403DCEFAD53DBE7DA23D3C8F673D9B83B33D001C8EBD667C7F3C4170ED3C083FBC3D5563CC3D9D59973DCF4112BC5FCF88BDA48EB4BD3B35093DD97AA03DCBC1E2BDB2D1813D8C36953C952B4D3C281DB7BC3623673D6AA46DBC084DA73DA25EAABC68001C3DD1DF1DBCF411113D90224A3D9E04D93C2F449B3B3F7423BD609C703CB3DE7B3D42E5133DB99567BD51C0C73CDAAD293D1932CA3C25FF563D809B06BE9C5D453DA7A17F3D9740E8BCFD73433D1CF9F13B1256853D8C1554BDE857C1BD85C4043E5E65AE3D4F9C93BD758F20BD477B8F3DB899703D903096BCB0D0853DD1050C3D1422213D1B6931BD46DBD7BD37219A3DD304DB3D06E942BD672A93BD863E82BD6F53EDBC7745213D646D31BD3F3C93BDC8C8ADBD3BF80F3E0C817CBC50E09E3D0D77753DA7FECCBCE62B313D586A113E2B42BA3D6A689B3D4604D23B542343BC74AB7E3D6D19F1BC2C8749BDB000A03C799D523BBC73FC3A8EE3E03D5E9E3D3D8C4C7D3D62F80BBA12136DBC4122A23C1EAD8DBD46822ABDD1363B3D97212CBDCE8C6D3DA1D3B7BD80717DBC341500BD227E933B039ECE3C7D7F803D0E6CA0BDA6D23EBC2725513D94EB893DF707683DECA0303C0D70FBBB77EC743B3F381CBEA8AB223C201A793CC4CC9F3D7EE2493DE315873DE606633CE60995BCB1463FBC6E34F9BDB29E1E3CEDED493C3CD88C3C89EF593D2FD9B33DF565C33C2A22E33C474CDBBCB7942C3D49CB303D535D173D0D946CBD479F3F3D99F3933DEB60F53D57E3783B2FE4D6BCB683E9BB3B8AB03C0497483BB2428E3D22B3C1BBF7EFA33DA0E95B3DB774E33C4591AFBB34B56CBDB2CF363D57CB8E3DD781BD3D92CAA73C76C10B3DD2DA563B1AB5353D14EE47BCF583A3BDE545CB3C8071943C58FB803D4E6EA83D2BD511BDD87082BDEA34013C3153EC3CCA5EA1BD302AA7BDBFEA8BBDE34AE33C11A325BD49426B3CF249C0BDA38C8ABDD3D306BDE5E97B3D9B8B113D47B8443C7537DA3C64D75E3D58AFA1BB6F9D98BC0B3C003C779A17BDBA9ED9BAD1433F3DDAB5393D61FD0BBDC4F966BA9FC7ED3D16F94CBDB1189C3D7EA6583C7220A03D78F887BDDDD788BDE67CB93B1BD7D0BDB6A9B63CB216183CC1CD97BDCF437E3D708C6B3D85232D3CA2F7FB3D6C1ABDBCE2FC303D1C5EB8BC8232533D2AD25D3D28F9383D4A9784BDE334723D913832BCD20009BDBF9E6DBC5354F83C698704BD2A72083A9873823DE54B143CD5BCA5BD5731B63D38999C3D766977BD188B86BC209596BD70FE43BDFA2638BD8A719DBC9B86ACBDC8F897BD9A7C2EBD9BEF633D7280483D91655CBDAE452ABD7C67653D70D785BBC6DF43BCEEEC88BDCBC0C23CF4BC8FBDD423D5BC5559653D98C9383DA9EDA2BC2B3F713D0191A53D0AD5D0BD06E2CBBDD030F9BC14889C3D98E401BD15D9A5BD750B823DB428EA3D2A37B7BCCA00853D545A153D7ED4EDBCDD3BF4BD91F775BDE518003CAC08E93D8DBA8C3D1E604FBC1ED134BD944BE0BC5044A6BD255D32BD371F8CBDE2CBD93D222F21BD4D5DAE3D13A52FBD228B2A3D03F787BC7FC7083D02667B3DC11F6A3D5C663A3B716A00BDCA16F0BC0D40023C8A6531BDB9E447BDC40487BD1EDC6EBD7F508CBC4CEC25BD56EC353D040D86BCF0CCD23D734C873C1CEF9BBDFD7582BD949FF83DE41E573DA6A7323D719EB2BD1391863DC70FCEBA66D3A9BD3A82603DE4EDC23C715B773BE16F5F3DB28D90BC622990BDAD1BE53D81F917BDC879543D4B8314BD8A4532BDAA879BBD6B80903D4B8D533DBE9373BD1368A53D3E91903C4C66A43A0A85263D4EACE4BB8AE181BD179DD23B0A4A9DBC1A901F3D7EEF6FBA1349B43CD08A93BA1A75553D3FF4183DEA1D6E3D2421233BA3B724BDD2D6A73DE53A82BDD80880BC5FF28FBD2479EA3BC2065EBDCC32B4BAFD502DBDD82AB23D49B8F2BD5ABCF23C2EA1A43B1C7D443DE7A9123DFC42723D8C126EBD24CD2D3DD714223C871A86BDCE97BD3D5DFF083CC57B72BC6604C13C04DE7B3DE4CAA83D714995BDA6ED363DDE88A2BD8636983D7BB89EBDC85D9BBD65DFEFBCB2E41ABEBDE021BD3D8E80BD5AF09DBB3A6919BC1E0B8C3DE2D5213CDDD174BC5148253DBA86E7BD1D9A573DEC14C9BC4094DEBC5F6A893D595B173DC284C2BCD4EFBE3D2776E1BCCE27C63D2A4A3C3DDF5DF1BB28C97EBDC284B5BD3AC75E3DC2623CBCFD398E3D633C283D540988BC0F52413D471FADBDA062A13C0370B43C04B1A03D9073AFBD7D4DB93D2C98B63B0F3AB83D94DB9FBBDB8CA43D1DA5A5BBF272F0BC28DD0A3DB1CE04BCCC8073BD7AA16A3D0F96D6BBF75DAD3C07D41D3DC07D343C8D094D3DAFFD85BDCAC3BBBDF2CCA33B34F4163DF569BE3C720C2B3D0D725CBC7A1642BC54C3293D69B72C3DDD0E14BC428ABABB212BDABC1FBE1BB9670CF13DDDBF2C3D94714ABDB18BF93C725D98BD8A1A743DC171CC3D4A8AE53CA359BF3D44C1133D66CE7DBD5227E53B0C51AABD1FF4053D854C4D3D1C0190BD178E2D3CDA2D6EBD32B2183D94C6933C4B566ABD786E0EBD9B82783B2ED5183D37B336BDB18A2B3D387FD43DCFA4553D0CD2993D1973223DFE581F3D21FFADBB6C2228BCFAE6123C4E085A3DC7132DBDC9F6B03DD2256ABD0F3F283D1279E83DCE187ABCE962A7BD17AC273C3C9B673D8A3615BCFB3983BDEAD3443D49A87CBCE36F59BD3190F03C10FC9ABD69A73DBC40B8973DFCA156BDB427E5BD70E29F3B0560883DA629D9BC4FF5ED3C10154E3DB26F8C3D6B8BC0BDB599F33A5719F23C524D3EBDC0AF01BC5AE0013D8E825C3C9967A1BD64AB393DC0EF33BDA14E9E3DC35CD2BCDE9FC8BD1F69583DC7A1573C381B59BDE2C0E83C824CD6BDF4E382BD74E5953D1AFA03BD64E8443D54908139C48838BD09618B3D88ECC03C83EA26BDE2F4023CACA98ABD9C94E3BB7D7790BDC6FEBFBC37352D3DF06B883D453FAABDAE9EFE3D4DDE1B3D75E8B23DB90AE73C18355DBDA83B253DEA53B4BCCDC3653DA325983C5E105F3D85187C3D9F46213D4E05ECBB2A152EBD8A370DBBF405EEBC932690BB34F0BE3BF17E923D5B84AABD79CF1C3DEACF15BDBFE53BBD6E5E3B3D8A490EBE52BDBA3D0B88D8BC7EE1A63C5C00373DFFBE2EBDE821F93CD09E63BA67AFFF3DCB89533D7C706CBD3B2706BD15BE6E3D6DAF68BD5A63E23DD636E73D7094953D9B80C7B85DEE8F3D9D73AEBD880685BDE580AB3D22F4A6BDF1B730BCAFB10FBD11748ABD03CF6D3D2AB6153DEE32A4BB8B12CFBBE0AC2B3CD23137BD2E1A7E3D40D1A63A9CE3703D00AF773CB1E1213EF5DDF63BC2920B3C8A3490B9AEE349BC1D09E2BD0041C1BD9B704DBDAB6249BD3BBA0ABDAE7F6B3CF4874F3D9CA8343D61FFB1BD40A3E8BDDDA0A53CCBFF793D9F118BBDD934E6BD73AD473DD30A393CF28F18BD17728A3D8EA38F3D8541AB3D9D23263B1F8410BE8BA52C3D59B696BD96CBE6BB74621D3D2D52F0BCE4C3A6BCC72812BD80588FBD1BC8843C990632BDDBB1DB3C55FDE6BC13551ABD19EB6E3CB558A63DC7EA9A3CB04ACB3B1602373DD3D2153D69EA54BDDBE9B33BB9838E3CEED475BDE26668BDEF38D9BD765139BD9E84B53D452DF1BC177EA9BC1E77CF3BB21D77BD6B6887BD346902BDE2958FBCD88646BD4D62FF3B3B3607BDD99587BCB0BD80BD76C3E63DE0DB2EBD3CBE373C0CACCC3C6E6D6ABD4128FEBCFFCFBF3DFC3884BD03A2EB3D1FDBEFBC06805EBDA3E4133D59B721BDBEFB343D7ED6ACBB0120FFBC14DA813D15D758BC0B5B9C3D2663C03B57497E3DAB754F3C624188BD80384C3D0517913C39408FBDDFB71ABD584CD43DE89271BDB931B33DB79157BD5A97033DA6D4BB3D260B143DC4C1903C50B283BCA176453D8699BC3B13678A3BBFA8323D409C4F3DC662083B0F1A2CBD0F848ABC0D4BCDBD47E3A4BDA21952BDA139893DE4093A3CBDDF46BD1DF9313C3508243DDA24AD3DEC96E7BCA066A8BD1351253D9A908EBC82F2BC3C6882603D1DD7593C0579DA3D22553BBC3E43FABB2D42ADBDBAC201BC074F9C3DD480A5BD2F4E2B3DC6CC7CBD59CD6D3D012E163C491D3DBD44DAFDBCBD7C9F3C5ACDED3D8074EDBD42ECF8BD20AE6A3DA0FC8E3D3CF1D3BCD92B02BDFD2434BD85AD8C3D64F639BC83FA27BDD0FE72BC87C9E53CA4EB83BD438936BDA78AADBCDB57A8BC71457FBC737EB13CF3F08CBDDF796F3BB111DFBDB1E124BDC127A13DD3A98BBDA554F53CF4EF103D3E1E32BDC8AE153D71B768BD6D8B413C92EC86BCCB0D14BCBA9C9E3C370D7ABD2B010F3D5CCC0A3B3180383D623D29BD3C4C40398FD82A3D13A21D3D39BDFE3B6EA4B93DD4CADC3CB222BB3C5095FFBCC5D19EBC5D9C89BCBDE0493D2E16F13CF9F3603DD9668E3CCBBC663D235C86BB877E3ABD512B2DBDEB6941BD011A1EBDFAE8103DA661C8BC514A56BC63BA09BD4242F1BB2BEA27BC6C3B2D3BD8BEA43D140387BBBCDC283DE45DBE3CA2D5383D3485443CB3A1163DFE7FB33CB28062BBF93389BD5E47D2BB841247BD8B8006BBCD8490BDAA6190BDC708313D2F873CBD6F7E583C4FA3C53D1AFBAA3D352370BDAB8D8BBD70C2853D33D979BDB32A5ABB956F5EBD6528CC3C0895F73CEB922B3D1D361B3DE7A4A13D950DA13DFF88CBBD8C5996BD531E273D2F6AD7BCDADDFBBCEAB5CB3B41D28A3C94718B3B107ECC3DDFBAB63C9AD4C3BBF72184BDD3F6153CFAFA3A3DB881E2BC47E88DBCE551DC3CE3E909BDB24AA63D22B16CBD311C8BBD958B483D8EE8B4BD5490F0BB1263623D8F1D8CBC4694693CFAC3CEBC5656A93DFAAB063C9BCCB33DF5D819BD152ADE3C455BCB3CC4127E3D1E93C93D4B0242BC6F7841B965D5CABCFD802ABD281FFA3C8D7983BD3F0E8BBC6B92D5BC368C843DDA90603D30665C3D9E4A1CBD3B82A1BDB0133F3DBD1F973DE6619CBDB6C893BD0FEE18BD0136E13BF1CDEABB800A053DEE11043BD74888BC80385EBD230423BD8E78883C935D583D51C8B9BC099E8FBB3EE49CBC2C5899BDB5DD75BD8F83D63C64013A3C2A44963D12574B3D53B59D3CA9599B3C3F69E7B98D397DBDEF9A6F3B0B573A3DA40267BC89208C3A3D32A4BD1D4898BDE9CE893D571D7DBDF36C55BDDA75D8BCCF282B3D2FA5243C235C103D08A39DBD523A8BBDBD738A3DB62AC8BCBE2F353DD7FC913CA219533D3C1E783DF7E2A23C363DA6BB0F06083961B9893D79920EBDD459D33CF191833CBBA773BDD07EC03C90F965BD512966BD65B7D33CACD31A3C22F2FBBCD4E396BC361081BB57EA9F3D969754BBD0B61CBCCEB8A53BC40A9FBD589CE2BBDA85DCBCBAD88DBD63ED31BD6DA96E3CD3C2723DB44F31BC8C5B083D0E867B3D1BCB9EBDCFAA85BD3793FC3BA5F2043DEE03573D09EF97BD7B08E5BCBA0C4FBDC28CFBBCE050F33C5352F8BCD3E2B93CA5F7223C9AAB79BD6C528F3D3CFB173C8860493D06649B3DDB62A03C58B87DBDFBFE143D9B53BF3B2B02CE3C0A9D5CBC9809DDBA2CA2A23DFD6B74BD8C43193D890D69BDB4094E3D04D2DFBC05DE9A3D38ECA1BDC9FF92BDD45F363D8813803D5F7E6ABD3D022C3D0D235A3D557C3F3DF3F182BDCE3B273B6F4F473CB00295BCD750233B3C3218BD6C9D64BD62A8573D9556613B7B4688BD77AD72BD3DC28ABD7C3B5B3D4CB7CABB802835BCF3464E3D99DF253B2A06B2BBC7F337BD78A33C3D70B989BD6A1198BD12D7C73C24548BBDAE78D83CEA9776BD9EF962BDF74B62BD5FCF9ABC1013D5BC1C9514BDDF6986BD1A97D13C206042BDC76A87BD29F98E3DD83F893C98B68F3C1AF652BBA82C2ABDE237A03BBF03433DD670043DC2317CBDDA81E23BF61B0B3C629B14BD68998F3C87E0323C765BCA3CFCEA4EBD513CA43BDDD525BD445388BDDB843E3D95D8E6BCD168473C9662233D88F66E3D3CC87BBDDE05E93C84E2493D890DF33AC5E98F3DBC61BABC87BC653C58C5FF39C4308C3D1505373CF955863D4A7835BDD18E49BD23AA32BD141E643D08838CBDB483753DEFBE6D3B353CEC3C8657733DB473CCBBED643FBC918744BD379CCA3C049B75BD594642BDADE30B3D95F48F3D99E747BD49CEFF3CB513893D3DCB03BD8DA05A3CFDDD83BD9CC4D83C51F38E3D51BB5EBCA7AAD63CC8CF503D59BEFABA0F384EBD5BFC2D3D44E399BDF6819439E36F513DC0131B3D6834983D2F04093C7B97973C5F50183D082D473C211B21BCEE9878BC8FE37BBD1F5E3A3BA6CE01BC2C4987BD2786C9BBE9B0A5BC178694BDAAB8083D34E78C3D133B273C862651BDEB4E5A3BAA26DCBC145747BDC821A03D73D78B3DDFDB233D5F9C96BD934C913D8AD2473DDAD38C3D70061C3DCA43233D75B7753C3694CABBBFC30F3DB46FD73CCFDA493D02086DBD8D0774BDC0DAF23CD5365A3DCB5D6ABD0EF4763D2C7FA1BDCEAC87BD68D915BC7377513D4F1C5B3C923B93BDAF658FBC40F7103D4B19CCBCF729C43A2058C03C96EB9ABCBE4C163DBD2E963D016C893DD46F803DF75FBC3ACC833FBC442F44BD8BF4A4BDE69B953D0A2446BD26A8E33CB8A788BC0B44C43B7A80423D815C4CBDCA1B8C3D96D0663D4BD26C3D2A9497BDB32BD43CF098A0BD176F3EBD07A96C3D2DA67C3D4097DDBC09A892BD3FFECE3BB28A6A3DABBD7CBDF5726ABDDCB7953D5D75AABA1CA54C3D63BAA23DD0682F3DA5386D3D774A90BDF28D9F3B40908EBD4C8B883DA8A59ABD9FE6453D61D95C3D05A78DBD948888BD1C7E9A3C3B6F8D3D485687BDF6807DBD10D561BD40693F3CFE6895BDEC8829BD58951B3C36DFB73BA1FDA03D488094BC58B092BDC80214BCE5137D3D8507833D7D783D3CD8D4FF3C4C7B8ABD9C23C8BC5FFD7FBC3E9BA53D90C0A13CDB1F56BD5F318E3D3FCF513D59F4683DF91B2F3C3F1B0EBDE0E4533D5F415F3DEE8709BD27600DBD220F3DBD928776BD22EF1E3DEDF605BD023F43BD0248513C24B228BDA01A133D248BA7BA5CCBAE3CC5C038BD357C843D692A4E3D3DC650BD9E8F24BD20C69FBD42EF4F3D697E8FBDF9D10CBD20DE58BDA7BF8F3CC3A30DBD235287BC443A1D3DBE12F2BC1BFD84BDD79C913D9C38A53DD0A31A3C2D7F723DE0204B3DDA29853DE93925BD61E5D1BC7855953DE8EC2BBD2E0E073DFCF044BDDC8118BDABDE213C69969ABDF5F51FBD48616A3D616F45BD77E1073CAD05253D499618BD93EE3DBD87A353BD3FA86BBD5965D0BB02D3203D77865D3DAFE0373D084C75BCEE2783B8A44B73BA9DBA4FBD978A973D6928613C12A503BD7AEA72BDA3D185BDC35E5BBC877F883CFC0C333C050797BCF0483ABD23B38EBD432EAD3C9879FBBCD42459BD64167CBD695FBE3CF2353C3DFACD61BCCBF1803DF357DEBC381560BD893E38BD3231853D043D323D29D593BC551F6CBCD63F91BD494953BD38692F3CAD788DBDD8E2403CBF5D4E3DC280A03D3D58E1BC4BED933D6D168C3DA528003CD5FC843C4A6B9F3D26A697BD29B1F5BC1D94893C6A206E3C075F0F3D55E0973D24B587BA3D369E3D8079F1BC08EC993D2C39213D273395BD81FF2DBD762866BD440B923D8CD234BB9C8628BD08E4D1B933CCB1BC9773BBBB65FC893D8E798B3DA6098B3DC3B3C13B4E9F783D5D582FBDCE88A63BA2AEA53DA1DC8F3D25B065BDB308C93C76EA0F3D67E92CBC26A5F3BA0EE307BDF2173F3C15F1793DB9D6A0BD41A6303D4DF1863D670982BCAC082C3D2E61303D90C71F3D526FF2BAD6032CBD2499943DBDB490BDE1298B3CBFCBF5BC367C403CC30743BD82D4963DD9D262BD6551953D229D883D3FD725BCE7EE5A3D783C85BD0EED86BDCB2D54BD38D68BBD2F7D1BBDA19E4A3DA819373DDD1C3ABD3F9571BD3334DE3BF6B41EBD1158133DB7D41ABBF37C283CFDC0693D11969A3D653673BDD45F8CBDE83AA2BC6F7699BD4CE1CF3C1EBCBA3C990AD0BC54428FBDA412F6BCB274703D08526EBDD91191BCF4E8CC3BA8D6243C803F84BD768D8CBDB2DEE5BC7D7AC0BC9A164D3DA0540DBD295DBFBC03D188BD7F5057BDF4BFCABC0A48693D6B1432BB0E5E423D7C0A413D7FA40B3D36B603BD1316843D511AB63BA2E7BD3BFDEF8CBDA6CA8DBD39F7553DC53AEEBCD982CB3C7416873D2F7A88BD5C9832BC21ED57BDCE17973DD57B5FBD8EDFB23B92951EBD5DD5993DEB0084BD6CE238BD9D75943D9F48723D6ED77C3D9CDDA5BD8C8508BC946280BC14E011BCCCCF80BDAD403A3D46D3893CD8DD143B73DB79BBF39F2BBB1DD7993DADCAA7BD3ABE333DD370973D458885BC1B81F33C167E313D44FA69BC83DF413CA9B65ABD98400B3C667849BC958885BD5FCF993D6A4C7BBDD6195F3C04BD83BD608FC13C922C433D925F3D3D2130A1BD144245BDB500E63C5FC1BB3B4FD69A3C9E7D0C3DB5AD023D784FF43C2ACF2CBD82EA253D1DEA50BD0D5D313DF6E7223DF138973D1AFA5EBDAA1B71BDDC5D833D78C45CBDD488503DECE37A3D378ECD3CD52DA53D6E56D8BCB6EAE9BA2718E3BC591862BD123ED5BCEEBF10BDF52D31BC176369BC7B3809BDCB4A3E3DCBD3163D83F437BCAB7B8EBD21A0B1BDFB0CDABC748A733D1D0F683DA52C81BD11612DBD4B032BBC3578673DAB5A5ABD1A84F6BC02317E3DBBF746BD9156513D840B473CEBDEA7BD3D478DBB34EDA1BD3D888B3DEE628CBBA4912DBD0CA317BDBEB613BDC2704BBDD1369C3DB7C98F3C6A9787BD874E583D7E8630BC19B85DBDA800C5BB76910E3D23879DBCABAB313DE09D7DBC35D19FBD99AE193D7898773CE18A2D3D1C66803D5CC3D3BC04FA403DB1CC2BB9CCF39C3DD54675BAFC4B12BC1A3385BDD97D84BD72CEAA3DA297653D03E25DBDBF6D8BBD6DC9853DCE3B06BC076A0D3DCA94B1BC443B153DD6F6483B0E20463C87EE6B3C12E1A3BCADA476BD18B4093D67FE79BD49E1763D60A5B0BCD6BBB3BD3D15343DFB324A3D2101983DC4B8B03C18737FBD48FBA5BD4A70363D1AEB25BD199194BDEBA1C33C043B833DF64196BD0F54DBBC61C0FABC8584CE3B2D19533C22F3543DA23FEABA6F5DD7BC7442173BF30E37BCBB7B523CB68925BD5EE858BD7D392CBDA699D4BB02E4A5BD4B668F3CF693C73BBE3C953D70773EBD592CA03C2B5EC7BCCB9AB93DDB82813D0E9890BDF22EE139E75D2BBDAD16193D9DF8A9BD9F03043D6C4924BD6E31E4B950C3A33D1A2D7A3D29B40DBCBE9C243D3B3A743D5D386D3B58D63ABDF6E84C3D77A9993D9879123CC4CD6F3CC5441C3D19D25C3C528429BDA56D2C3D4DBC83BBE818243CF40576BDE13034BD56CB87BD90E462BA9DD255BD2FB8FDBCF39C8C3CE849033DF27F6B3D30B789BDF7CCA23D966AD93C05EC21BD1C5E263DFE694BBDC50F8ABD16497CBD8FD8453C1DFA193D3933493DC510313D04A8963DFE9DD0BCAF17B8BA92E3F2BAAD01FD3BD0C4CE3CBB0D57BDCF0B9FBC3D4A0E3D1DD370BDAC82A6BD6B9E973D1ECEEA3C6956013DEFE0303D82D508BD54D76E3C32323BBD957993BDFB9546BD962403BCED28913C26858C3A232A9CBD59F3713D3DD2553AA5F45BBB6886FF3C5C01713D4641A3BCA29904BD2A9B033D7B5B91BDE0AF1A39D7EEB83AE62523BD3D3F55BD99CCB93CB40A353D71EE54BC109382BD2C0B973DB98DADBC6549B0BDAEA1F0BC6E4E0FBC3625A0BDA2C673BD6FF8893D271910BD0B8839BCE0BF4D3BD5078E3DC54C283D183315BD064198BDB9668ABDB6AE55BDCF55853DA2A6FABB9D445E3D007DA3BDBDAAEFBC7E0B943D441F323D5A82AA3CD9A24ABD7CCF82BDD0367A3CCC7A373D8B53743D86A9D23CEFB7A8BD5ACF3FBD5B84E9BC871C1B3D1BD4C63B3B6F893DB2A554BCF493E5BC5D09B63DFCA5133D65E08A3D68F682BDE052033DC5F045BDEBE0613D619D56BD8E9DBC3CE5D39FBD33DA46BD3F05133D76A3853D343A98BD2F468F3DF0F9D33C70587B3D791B863D1F81953D790F0CBC6D0F053D1D5FA0BCE8CD5C3D80F7CF3C5BC0623D99996C3D1EC4AB3D311173BD1CD1D63BD37E9D3CE1CF09BD936F293CBAD06FBD2833833AF7718BBC97B1173C6516043D06070EBDA8DF2CBCC2C382BDA07163BDC7AD2A3C18FBFBBBA5B78D3D7451C4BBED1A843D7B38093D80742FBCD55697BC5490CE3C7382A63DB42419BD1B3385BD91B423BDEA96A83A4815173DFB36D13C7CB6A33CD554A4BDA8E29B3DF238923BE1D6823D9C991C3D49FA93BD62049FBD7FCE5BBDC97DA43DCC2C63BD5AC4F3BC442D7A3D67DEDEBCA18B60BC34C42C3D232393BB895915BD8624FFBCE9F4A73D98ADEDBABE88233C68776F3D644D083CA13B833DC0A4F8BC396BFDBC0766823C5FF2923DFD0A653D618405B94CA164BD3B29E23C2E04503DDB5542BD4BB94D3BF92B8D3CA419F63C864DD0BC4F3CFB3C4239933D933C333D7EC63CBC4CF00FBD104CB33C1E08B83D9887BBBDA09AA0BD746042BABEB29C3D8BA408BDB78971BDF3E71C3DD38CA3BD06CC66BD29B1863D7C68AA3DEEAAF53C850C633DF7DBA13D7962B13C0273243DA453483D34448FBD012E673CC615AF3DDCC479BDA75CCCBC1596D73C8A6D263DE33D9BBCD8DC49BD0B77923DACFD803DA8B7563C1E32953B6C1397BD9B127DBCE15F9CBDAFF4DCBA61C3F0BC04983E3D1F90073DEDC552BDB36B3EBDA5EA25BDE2F7303D34FC0CBD81F913BC3F3E17BDDF1781BC26B8603C124C34BDE49363BD3333F83CA53B82BC3C32FF3BFFA614BD340EA13D76E051BCED38CE3B18FE6B3C1FCBD43A1D67C6BC2D64E9BCF893813C5A21A5BDB3616FBDE51E82BD656B1B3D85EF3CBD4668903DB32488BB1751A13CB0E5933D953928BBAE76D03C638E6B3D829A27BDBD8C913DD527A2BD3CCEDD3ADC63333C935E3B3D16A28A3C41CCE0BC5E26AB3D504814BE666C24BDFB7D30BDF430523DF913573D73A9083ADE1E4ABDAA882F3BD9D461BD4B08263D4B754ABB20F619BCCFEC8DBC72CF19BD6B41BF3C3AC100BD45018B3D5E7950BDF892283D663579BC2DCE0DBDDADE133DD225923D1C8C863D548C88BBC577463D332C913C2C6C0B3D6B0B743D094DAB3D40A8E7BA1A05A4BC99F7883D26DB613DBAA81A3DDEDC613DB1A794BD3E3E143DF46160BCFB6C463DEB51C1BDF3899ABC55D4CEBCDF96D03C0C8F283DA7674FBC9907C7BB14158D3D037949B907CC5B3C4C12073D18E186BD950895BDEEFD99BC798953BDBC0D993DCE0277BD4C33B43C0B3431BD3E5584BDEDE7BF3D9C1F27BC7F110B3D3DDF25BD14CB9BBDDA28DABC1E49F33C4C0ADCBC8350353D07DADE3CF29B7ABD2866453DCA4007BCE6B0353D1EAE00BD0514933DB5114C3D88D0B6BC6F8838BCE99F963DC6C48F3C48E0E9BB9981B2BD16C14F3D03A45EBD650A9CBD39B917BD2591D73C9FEDA83DC2DB923CE33F8B3B0E49B8BD7636CFBBE971D9BC3672043D9883ED3A7C695CBDD97A61BC5A06963D3EEFF0BC8608AA3C47EBDB3CA9DD1A3D754B8EBD044C7E3C3B8DACBDAF86AC3D001B81BD762CBABCE7C751BD801C95BB79068DBCC0F41D3DE75E893AD850263DC41836BD386846BC827E38BD8849533D5B98A03DAFAEA13D8151BDBD5D2B81BC95555D3A0E447CBDF4EF02BD7B46D1BC6A697CBD76C40ABE1BC052BCC08291BC78879ABA2BEC0DBC491F703D4411CD3CA032283DD2434ABC9E7EA93DC4009F3CBF0DAFBDE1F62F3D838938BD18A0343D69639ABBB8A4B6BB3E5BEDBB670C41BDBDAAA93D130C3DBD5262A33D43B583BBDFF5293C50404B3BD1EFC23C05B811BDCEF64CBD6C4EA13D0A1786BD599CE0BCCDC5EC3B51D65B3D007B84BDD11273BD379312BCE68D99BDC8FECE3D29EE233D8DEDE23C40C0B6BDBBB807BD350A19BD020037BD658D033D489AFABC9A467F3DD7209F3DB356E53C0C94CDBCBC6F3BBDE3111BBD98DE423C9E86FC3C303DBABDBD2D8E3CE2EB9EBC1130A1BC8F67F6BCB5B6BFBD39DECC3C0AA595BC3914193C5CE2A5BDC6388CBD02E04A3CDABC8C3DBCEBAABDBDBF813D8A02F33BFDD901BD7EE2A8BC7B97323DAF95963CFA69043D6255A6BDAAA3803B93A7703A2D3B023C08A27B3CD5A038BDEE9CAF3C7A96E03C5F385A3CD6A2FE3CABAC82BC7FE40F3DB10407BCA3031E3D3720CEBD4E2E5FBDBA1521BDC460DA3B3350A23D45FEC7BC109B533DB58C173D17DED33C460D4DBDC6E9A43C5FDA033D7762803C4218CC3C23C28DBD4F644FBD151BB4BC3DDB15BD02B0A8BD670969BD9C01613CD98B0FBD5FEFAA3B41F9F0BCC4C88D3DF3A8143D8B8D823D86B6F1BC207CDC3DA8BC913D6DCF263DCA34CB3DEF2E53BDC966BABC3493853D8D889F3C2613F33CBD8FFEBC2E62193D251A07BED79A40BC89715E3D06DAE2BD965382BD05A7F63CF918503DC47B973DDF25383D3D9FBB3D2E92C43D7DDE843D4BC883BC5C77BEBDCF178F3D72E0063DE2C0883D6EC8EC3C695589BDED698DBC1FB75DBD2CEFA7BCCBE71B3D94641EBD123A34BDACDD4DBC47911CBC5ECA9BBD2927D43D844DB93D0C4CFD3B169F2E3DCC4309BC3B6AAA3DD162DF3C3E80BF3BC9313ABDF9896C3D3111A23D2412C1BCA0908A3CAEECB9BCF30FABBDC73E45BD3A10C43BA09552BD1E1189BCA6C586BC1D70D9BCFD46A8BBB1A7A23D52C49E3DB2387DBDC31FE5BCD545123DBB0D243DEACD933C6DD0743C1A8B5DBDA1D257BC2DF8863D38828FBD68822A3DED38E03B652017BDFE2410BDAE319DBC2BC462BDA80D023CB155A23D1199093DD0E7313C817642BD40633E3DF3DD81BDEC0C853DC5FD3F3DE1D05E3DDB522F3C530D023D293FB13D5EE68F3DD2F8CE3C409DC83DFDAC3C3D0B748EBDD96F98BCC232EF3C074C933B250AEB3C34E7A5BCE8D8543D670CD13C54A8023C813C89BD940F2B3C1D87CFBCA0DCC6BDC711063C834DC83CB187CA3CC9878ABCDB531ABDE113543D50522C3D88875ABDF3A771BC5351A4BD1F58B23DFA3609BDC4CF97BBE2671E3DF344463DD450123DC648DEBC59789B3DEDADEF3B841B963CCD851E3DD102153DBA05D6BCABED503D3AD73F3CD8853D3D9D87113D3C0095BC154E96BC991396BDA169F0BD214191BB9AA83FBDFD2AE2BD7761993D69A43A3D25746B3D747008BC89EE69BD772AC33DD2FE4BBD59023CBC4058883CE5810CBC1405063D4363F73B5427043DEB3C97BC7DA9553D8A076E3DC0C4233DD02FDB3DED8E793DB25C2E3C33A786BD776BA8BDE06C6D3C5F4090BD8578D53D95BC8FBC2F0E1ABDE5EA0BBDF5D5C6BC9FB88C3DDE07723D9589A63C2C70AC3DD6B9EABB13FA043E05C873BCD9C3C6BDB48BC7BD1E0428BD2A26A33C7A2D47BD4A0D9C3DA3C2BD3DC7AEAE3DE20D8BBD69412CBDDCC92BBCB857D03C4AF58DBDA2FA87BD9D4B5DBD253BDDBC1C1F573B0C4B53BB36DB953C5E945D3DD5F43C3CBA228E3CF9F8A3BDEBDE3E3D2DD215BD5FE4AA3D6C223B3D21498BBDB6AAED3C6E03A03D1E33533DDAD99D3D2D3A373CD619D3BC88E486BD43D473BD935BA1BD3E7F443CB67611BDDE44B1BD3C83B23D59794B3B06D4053D1C2B213D4A7E2B3DADEFB6BC653E8FBD1C5A333A3B7AA5BC2D98993D6A7C543DEB134EBD2039153DCB05FABCF9B4E4BCB3E5CD3C30CD86BD29E539BC116097BC2B8CCBBC93F5313DDD3F57BD34A7423D0AB2143DDA91B93D9F5F29BBD063CF3BE75102BD7009CA3B8E4BD7BCB623333D11FC68BBFD76E2BCDDF6F93C6AA6543D78DFDB3D45518A3C32DC713CF2DC753CA12B823DDDBD8F3D57EF72BD6C0481BD662CB4BCDD48443D5571C33D6D780A3DA0DC94BDEE6C53BD82A987BDB123143D6F7113BE89A3B73D9408043C7EE10CBC6C88723DD22826BD75C6CF3DEDAEA23D8D1598BC7E73B93C5E02273DA90795BC8EE247BD8BDD343DB721B1BD4EBCE7BC7DA0D03D24697ABD4724253D21668CBC6260E23A28F47A3C6830F4BC79DE043D63E04EBD8BFE953D8F1874BDD0FB5B3D7C2A6D3DABF4863CCA3B683D140119BC2D55F63D57F77D3D5D2D98BC13C1A23D8715A8BD0F2CA6BD008981BA5563873CA81A6B3DC1E8C6BC3A50D63CB7288D3DFEC9B03D6AE053BDB623E83C60400E3D8D897A3DF6DFB6BD7214DCBC3086B9BDA2D4AD3CEF33983DAD629C3D0B2F42BDF1F4A4BCCD5653BD894C9C39CEDAB53CDF9A0BBC2A101A3D2A773BBDC06736BC8ADAE03CD1AF943D7E33D93CCD02883D3888893D799F33BD7A18E2BCAA10BDBD11E104BD81DBA6BD96BCA43D698885BC56F8363DFAE6353D31E3613B02C6E5BDF6975A3CF815953CFA3FA93D10DB1B3D164F983D549C883D291D7EBDB05F703B3A6F243D8351983CA96ACBBB9809E1BC05D8F8BCE5E93BBD8844133DC5661C3D67EA65BDE7B493BCCEB2BBBDCB04973D54BB2F3DDE3B023E4AE712BD1FD602BD432C91BDB7C6893D92E29CBDC9C763BD19A0DCBC32AE103D03D01D3CF0B6343D03FFC93DD2184BBB7EAA9CBDFEC0F03DDDFC0FBDC8218D3D54C3593DA2B3A3BD4480A53CF780B63CD1C8DABC895A8EBC20A4B3BB012210BEA2DE6EBD435E9BBD9B555CBDA8A2943D1476A2BCA7B930BDF646A73C5AEAB63D8FAF1E3C9896D13D3D7A0A3C2228DABC8D6901BDE0F56B3D6B1467BD120C273D45B60B3DEDAA5BBD2B627DBCA37CDDBA9771C33DC0F51EBDAECFC1BC9DAC55BDEC8B35BD3FC55D3DD739893C248FAF3DA34A90BDA3CF29BC67066EBDE0F2513D1A205CBDE1A4073DC3B05B3D638FD93D848BECBC502E243EE801DEBD2639BD3C7044ED3C70EFBABC81FC333D6F589ABC51FA033C9592B73D665F3CBDE094B5BDDCA9103DDE7372BDB04D123DAF1F19BC87DB5A3DAD732ABDF851003D4F55873D69CBA63A0EDA4CBDD6C0063DBDCC32BDC19B2CBD5589AE3D624F273D0BE44DBC9C50383C69005CBCBD93953C69CD503C3E1FD83D0DE0063C268C9ABC151A1A3C421C52BD79D704BE7CCFB8BCB711ECBC86D1663CE2FD053D9A211D3B0358D43DF2D38EBD32C889BD918A983CD55C2E3D7D28013DD8D755BD19AA03BC2B481EBD9AB9B8BC470E233B4928993DC34EA83D8F592F3D332BB3BD92B6673DE983ACBC00D3193D7AA48F3C87B13E3D175764BB6584B0BDAA118B3D97043E3A58E476BC8BCF8BBD575DB63D9D7C77BD8BABAB3D882A9E3D9A41B0BC4FF4EBBC918F64BD81A920BD179D913D65002D3C9D038BBB4B2F8D3CBF1A703D1017053C95EC6E3B764D1DBC55DD9B3DB59890BD46430F3D73DD93BDDF1F973C226EBFBD2E9636BE2F16343D02A16BBC57BFB13C944EFB3C3D7BD2BB10185B3D22ED27BC645747BDD5B279BDF73601BDF8AE3BBD2D9321BD4F5CFF3C9230E73CA868A0BB421943BD39DD3E3D938EA8BC5FBA413D518F81BD61FD96BCCE4648BDA586013E2D7C653D1F37AABDD3D4453D1FE8D9BD9C15863C46AA6C3C4CFC0DBD2714813DE3BCAEBCC860CE3C78E145BD6BEEE63D515B4EBC2666F5BCF805AD3D1C872BBBF7FE463D4F62083D019EBB3D53AFB23CF7C6D3397EC6843D16CE15BDE0661C3D75A323BC05595ABD8F905F3B33746CBC0ABFB0BD494E95BDCAAE4E3D2AC2B53C15CEA4BD10FA02B9BAACAABD3C8C69BDDF34A1BDA817A93C34343ABCD51D07BDDA2C31BD69AB253DAE1EFC3D876C6EBD48BBD73DBB2F693D22F68DBDB7357F3D97D651BD41C6923D43C735BDF6B3B53CAA27BEBD8376783B06077FBD7C0485BCC2F1A13D40A113BEFC0AF6BCCDB5BBBC0C1F45BD31795CBC06F399BDB36F9F3D6A3D46BC49B06C3CD2E887BCD593D43C7F1B88BC2B72943D323800BE3EB7ADBD3CA3A53D3B07CB3C63E0313DA034B23DBF98B4BD2E87E8BC3AC3503C7E1C0ABD66F70DBC19ADA4BD67B7543CC75DBBBDCA3E853DD657EB3C4F648ABC0BF974BCDC3BB73D088536BC544F1ABDBD22DE3CADB686BD135CA4BDE7D3673DEC1955BD67B5383D36C270BD81E6D53DD55B7E3D5671AEBC81DD9F3D1109B13DD29DC4BDAB88F7BD416481BDA7A704BE37ACB43B1073BD3DE29A04BD44F0DB3DDAD82E3CB12C2DBC67DB4C3D69CEE43C67375A3CE70D683DF8CADCBC9BD4383EC337ABBD15FFF13CF80DF0BC0D0269BD1B7192BD83BF5FBDB075403D9E59333D2223873DF504123D93D999BDCD7E583DBDC6073D3F4CEF3CE1EA4B3B145001BD982307BDDDC89A3C6E4ECE3D98A241BDB3FB203DDD0B06BD39532ABC2371FF3B39135FBC49C0BF3D37F0133E009FBE3D5C3B5B3DBB19733D2E192A3D52F79B3C79E4443DDDF42E3AB5477C3BB400DEBD522C823D51FC8BBDCE4A91BBE1ABA9BDD1CFCEBC6049ACBD7DC483BD0C1FB2BD3157C8BDCE6EE03C60B78A3CD6B7893C5B8644BD133D683D5F7170BC130E9EBC3BE3DF3D2FD3073D4AB4E83CE329063D6AABB53D18E96BBCCA5E51BD9F3510BE0D06093D59A0813BF4BBBE3C36FE4D3CF66DAF3D7EAC2C3D5B4A10BE0E9EDCBCC270AEBDF946CC3D772A0F3C75FB953D61EBA93D48E18BBC5645913C3F844F3DD8AF853CEA9194BDD22DB7386573103D107E52BD7D94B7BCDFF3B23DFC00543D298507BD906916BB17AF293C4F32053D7A6F4E3DEAAE0FBE91CA313D18C136BB8A3681BDF448A9BADA5895BC08B38C3D258D803DDC28353DAB1710BE17745EBD2A9282BDAFBD0DBEAD3FA93CFEF6AD3D74709A3D25DD8C3D81B4C5BD862CA23CFB5CEDBCA9F2573AC97A5BBC2D12CB3D4A5B16BDF90A863D0A1DE83C6857A1BD05E2573D6EF862BD97B9C8BD70E319BDE49A64BC2CBE00BD60EB2FBD99320ABDBF762F3D105C053E0CE18E3BA80EF23C79DDD5BC1888ED3D5CAFFB3D4194A9BD29A9903DA658A5BDC2CA82BDC4003E3D28CABD3D05E60A3DBC6C80BD057A243CAF5C253D560C04BE94E8C0BDCD55313C04F3F73D19DC11BDCFCE0F3EE213603DCE741ABD3AF61A3D0EB4AABDCB2111BD2CDE2A3CADF301BD44A2A63D8123E3BBD97353BD5FBFFE3BEFCAA1BDB73DE9BD61082DBC88A1B23D1085AF3CE99DD0BD35A51F3D3EF1663D7C6D413D248972BD8D7B663DD88128BD2377233D3FCDC4BD85598F3B8F85873A0D01183C24CEA53DB3ABCD3967E23B3D1733043DDE45023DA0C9E03DF9DDC8BC2059F23DCE3C063DAFC3FEBC12AF8D3DC81860BD2CF232BD0BDAAA3DCBB6163D1D05E03D1962B03D4E5D6DBD0590BF3DC92C07BE600389BD797792BDAF2B033DBA5084BD16F0BA3C8A3487BCD978E43CC2F462BCD12ADC3D114EAABCB18B44BD2222CCBD924C1ABCB2B813BDE4423BBDA1A5E1BC446080BC4A5645BDE9BF8B3DBDA7DABCA447EBBDAAEC403DBE3912BE072DF6BC78D3C6BCB1C83ABD6885DC3D112C293DBD30743D9E26B7BDF611F93B93C93ABE775AE4BD291D013D5C8E17BD7E39B1BC76917B3BD63BDD3D281BE73C98D5B53C2959D63AD9BB2B3C6DE1C83D4A4A2ABD4289B03D4FA4683D2823BA3D151AABBD5860B0BCC4965BBC6F825ABD9E84BBBDB5FC083C4427AE3CFA53B2BC384D3FBD23A59EBD3D52973DD869E13C5483A8BCD3CAB9BBA1C2B13C9253A7BA7C99503D74018DBD04CFB0BC88D82ABD6AADE0BD58BEC93DB0AFD1BC0C960D3D5B45013C7578D73C8FD7BC3D92B23EBDD2E8DABC5C5A883DA882E8BA0802F43C1356F83DCAA1103CFA3857BD7B9DB83C5BB39D3C974B04BEE883FA3C691EF23D36F4823DF88AAA3DEA189F3D7EF7A5BD79BB60BDE73DBA3C8898C4BDFFAF1C3DDF565EBD74E2FEBCC1F1DA3D4C88E2BBC50BE0BCECA5F9BC49B863BC5A5E53BD6376E93CC74A893D6CDCCFBC4646933C296193BDA5C68FBA618DCCBCE1CDF6BB44FA68BD69AE52BD52F6A03DCCA7DCBCD338D23CB13F3CBDC0CE01BD36D58DBD6140BEBC222929BC5157203D8DD3883DC7DDA3BCFB60F3BBB1EA113D30F146BD211AB23D70A8533D79F7873B27BD66BD0EE4193C5858453D6CF900BCBA16073D29A3403C2B19373D675EA03DA7008ABDB6397CBDA662923D2F970FBCDBB8323CED6656BC1936CE3D151D393D7C07E33B4BD66FBD96E745BD3E943E3DB4EB27BE9207DBBD2BDECFBDBEAE69BDF9E23E3D5EE8B0BD91A5D73D82B49BBDDB855A3BA12304BEDAD420BE8C5081BCE74AB63CFC0A673C6C16EA3DFF76743C2EC1AFB90F30C23C0868A13DE7D1723DC6D8A1BDAE08E5BC1A2B14BD2F290ABD89D6B23D55FC1D3DCEB4803D86C0183D0F8556BD010996BD83381B3D3C496FBC49D4223D14039D3C32C6663D43678C3D7405023D295E53BD5CA6CC3C98436D3C03779F3DF99337B891EBC83B50F385BCC21C97BDB809A4BD1DADC73DE5BCADBD2DC3993D409298BDBB26E3BCFA95BD3D8D2C99BD21C054BD2D6C283DEF83A8BC217756BAF50ED13D2B797ABD0A10E5BDF2BAE9BCB000883DA86095BDDB12323D5856703D6E46FF3965DB373DC6F723BD09A7453DB08FB7BD70F7813D2ABD0A3DB6B5A23D7D9ECD3C81DBF0BD70F3E53DD9C287BDA7A79B3C552283BA5917603D03B45C3DD38B0FBD8B10003DF7FC543DEFFE5CBDB651E6BDB14A183D5CC9353D5A49393C0A4A843DAD16C33C42BE653DF1A148BC88FDF93C76E552BD71D0923DE77281BDF7DB883DC46A63BD9B21A9BCFD3CEBBCB8CF7EBD5F63103DCD2623BD8AE8D1BB46BA223E882E093D5EAC6D3DD87EC2BDD1B1233D5710113DCF0DD43D2957C8BC29C16CBD562F97BC9298A13D4B21C0BD797C9BBDB36F7C3CABA5CA3CD16D1FBD45349F3AF6414D3991DEB43DC241993D13F304BD5BD32ABC5DA1FDBC8BD83BBEE4F2D8BD53CD9D3A973B1ABD705994BB3EABA2BCCCF0393DEFCA80BDD92C23BD8545F6BDFB1791BDFFA0A5BDF9B8F2BC79E361BDF0AD013C54BF233D91ABF23DF0832D3C2DD5733D7CAF383D8E460F3B66FC423A55CADB3BA7CD52BDD07DE93D1CCB043D8D777F3D10A502BDC18B32BDBDEFF73C814B81BDD970E4BDB065B5BD5949583DE0E6743B1A25283DCF72B03C305E01BC0324413C2CF9DB3DEFAC02BC69F83C3D93D72D3D14D5193D560203BD6ECB8DBD39F9443D88763A3D674363BC3DA083BD91D2B0BC2FE5263DEE62D23C3C48003D3B60313DDD7A52BD9C33B33D86DF513D35C0623CEA346FBD105C13BD9991A4BDFEEAA23BE608A4BBF5C2CB3DEE6E18BDC90FFE3C28ABB4BCCBB9B33C515A98BD6E6107BDD113D3BD480329BB51F0F1BC440E493B58CD84BC445F6E3DC13E7D3D22AA773DD92780BDFDB871BDC5FF4CBD2C6D733DA5D8043EAC2072BC61CC5CBCDA51EF3D7548B83DBCCF723D56A3D63DF14112BD8D6DB83D1F47E33D901DFE3C5A90B1BDE26BB0BC7CE0B93D8363993D19BE37BD11E3E3BDF9E594BCA82AA8BD6347F73C7C90953C0C6BAD3D10920C3E939A573DAF0773BD20016EBD28BF9F3DF682463B800A383D25F1603CBD38853DB073BCBCE615103DC889B4BD62BA04BB5C0BE53BBC69383DC9E719BD5F37633D29D7CA3D1510D53D779098BA55B3443D7EFE57BDB80F7ABD3A0D9DBD767B0FBE0AB1A1BC28CEEC3A5E7C283DEA88F6BC583C44BD5FFFE73C37D5EB3C4DFD89BD5ACAD5BD0383273DA975FF3C5B5518BDCAB5B03D9F44BF3D4CAE9A3CFF2845BAED42FE3C161562BDD2A738BD20FAD7BD8DF12FBDEDEDA93DC8B2943D3BE0943DD2F2A43DAE895D3D0227B5BC9B2B51BD2910B739FA2101BE98116F3D88DAD6BC6E930EBD578F9CBC2DADDA3DC39908BDF9BFAEBD103FBABC7B41AE3D3DD7F83C2FDC843D54241CBC269C58BD71F6613DDD9D9FBC9D4D303DAE0189BDA2BE3EBD1AF613BE374E90BD28BEF2BCEE648D3D7A67E83C00F9D0BD66EA823C0F2F9C3DC83A09BDE4C2313ABF5BC439DBC2113C0955B63C798346BD0E8CA13DCF92F6BCF588793D391BF93CDC87373CB47503BA42FFCFBD3F6575BD6E87253CCE604ABDB7E2603DFB850B3DDF43EB3BC7CA393DE639C4BDB186633D3022263B9CD1A43D49C38CBCA428353D4F6774BD7316A9BD31C8C83D1DE915BD2E5CD83CB09DEDBC9F43803D9D42833D112B093E0322CE3D2271943DAF57BD3D6624413DAD7FFEBC650AB63C66442A3CF94FFDBCCD42D8BC0E469F3D173E453DB74E363DAB21F3BCC1A0933C6E0C99BDA7A6DCBDC11969BD902C71BDE618B43C95269ABD30A6633D920D4D3D062A7D3DE54BE43B352C6A3D6C4467BD517D593DAA8D7EBD99379D3DA86F473B7868223DAC8264BDB9D37D3DA4CEB7BD217F0A3DD421BFBD3904EABD3758CEBDAE2C7C3D5D55A53D386C863D5D0CFDBCB5734FBD4DB72EBD37142DBE2A9EC1BD348462BDC82C963DCD86163D2F7E623D1859D43D30871E3E0A16DE3DCB30E83C92AA163BFF6143BCB4B735BD107080BD9EF4593D575A983CEEBF763C7C48BF3CA5EC8FBC1A2AA03DEBCA1FBD436DB5BDC043A0BDA7EE9A3DD62745BD137D3DBD13A74F3CCA13AE3DBEDCD1BCEE9D943B2BE993BB4848843D80A0A23C4EBC3FBD86CCA4BD5B39FBBDC9E469BD35B8903BDCF93BBD24DD573DBC5D603DFA8031BDBE7556BDE059603D47FCC1BCE6BF11BD26298FBD3F729C3D7D88073E622D70BDC9132DBCD38DAFBCD2F477BD2B911F3CAF09FFBCEC1D073C9D7897BCFDC522BDD7F9F73C329DB4BDD13A5BBD9D673B3DFF2357BD8213893B5EEC99BC73F87F3D1CFD0C3D6947AFBDDEC5F33DE5644DBD6DBB9CBDB9E36B3DB55E483D39FB7FBD26E1BBBDBDF5943BAA785FBDF0A2AE3D6E5B033DCCB38CBBE84C6EBD7E0D8EBC99FB27BCA9F10E3EC0540BBDBCCF22BC3BA055BD3187A73D1B6B913DBAF98A3C319ACA3C478DEDBC2E2AC5BB13AEFF3B4A3E19BCDD36E43C084B2E3CEE2441BD08E54F3C85A5C9BD6DC0B2BC6CAC4C3D93A059BD23665D3D7991D13D63D243BD23185FBB0A3D1ABDB46B663DB8419ABDF8E02E3D84C591BBEEE7DB3DF35FB53D454892BD85F3333DC85A85BD9B7FE6BC06448F3DCA38DDBD6FDE98BDDEB2463D7397753C99531DBC75359F3C85C2CABC2EA39ABDBEDF523D5D48D9BC8FC6B7BD8E5C44BD5E803ABD17D08B3D6F10C7BC724BA03D5CBD903DB29D9ABC01E5803D6DB5643D5411A2BD094274BDC96D8A3DD39BE9BC9F0A363DF2C3CABCE896FD3B226A13BD49AD0A3D71DB91BC5D3C69BABFAAB9BD6D0C073D7E5C39BDBA675E3DB75F933D3E465C3C6A7886BD12A393BC192F39BD3CDE9C3D9A3B87BDD20827BD45C30FBDE77245BD9C1273BD8340643D46128D3D3FE6CEBBA07D80BD4C2609BDB28B133D267A94BB0C56953D3F52CEBC8DE61C3D5B50223DDD669C3D3732013DAFD2C63CFDDE37BDB3C0CFBCA182703CE1E7603D46C1FC3C7C3A4DBCF4C1B1BD15C4673DAD4B743DDCEF98BDFBFE273D184C5C3D0046BB3BA620283D52A8CBBACC3935BD25002CBDB194ACBC68E1263D109E8CBC2FC67BBDF27FA03C500B5E3D61A0043DEA016BBD6FABD23B43048D3DD424243C9ABE4E3D279508BC4CB4A73DD45D863D1C75D03D189B353DBD688E3D8F154FBBE9F7B83DA6685EBD4759D93CAA8183BC86A4063C976D8D3DFB7376BD435C11BD09507C3D2CE6CCBD6D497B3CE127F6B99A9745BD29F1163DA56434BDF5A795BD496CC7BCC161BC3D16C497BD1D0E913B6BD900BDC8D930BD5199D9BDD85CB6BCCBB346BD34B44EBC2FD427BCD660623D433B50BD5717343D90FA8ABDAC6A6E3D17CB30BEAC72363A0496C93CC452A1BC4C5937BDAA9489BD40FC313D423926BD998F1BBD7CDF6FBD2B0CFD3C5BE464BD0EDA823B4D686B3D50B022BD625014BDAE256C3D5F742FBD783226BDAD11003DFC7D613CD304AC3C438D873CF552B03DA101C03D8C3D06BD4D33963D9872773CB879A73CC001AEB84DCE573D1842E3BD168997BDBB773BBD282C923DA107ADBD1D438C3CE8DE853DA3BB47BD0C1B803D69226A393218173D145FA8BD3F97823D1093B4BC5D5AAABD27686DBD57487F3D8931E9BA67121D3DA738ECBCDD4086BC2B6D3E3DFC30863D77367DBD74BC7BBD0D9D403D632F73BC9160BDBDC047703C5CBAB53C0FAA15BD462E9CBDD9811ABD7222BF3CA5388C3CBF78263DBEF083BD66B173BB0BFFB7BDF850153D9857353C97F90A3D07DA91BD2403CF3C4D04A13CF9FFB0BDD2A474BC277FC43C1BA144BD225A80BD7FB82FBDEB9E763D3436F63A1AA080BD06271E3A0D34753D314495BCB0D2B7BD1DB3963DDB29993DA65D16BDAB39DC3DE57A3B3D1D4FC23B597BAC3D03CFE5BC47EBBBBCF9CA533C0F7C3CBDB1E470BDC15BD83C238236BDB772D93C84FB8A3DCCF5C1BDC2CCCEBC34123ABDB7CB80BDA1FFCC3C8EC8A13B047216BDA7028DBDE884CABB8411733D90DAB03D1F6FC23CC898B4BC49D84EBDE1419FBC63E31D3DEB1F923D17B68E3D063EFDBC68347D3DE8D911BDE4D1553CCF5945BD2E9604BE21EEB9BCF892803DAE3332BD257C64BD59F16EBD4981103DEA5433BDF57083BD141A1ABE124E973D981D5FBC29D3453D80E408BB7143CA3BB7B9A23D702C833D1E5C153D1260893D124D20BD14ECA03C7BF8823D794B3C3DE7C0A43DFD84263C846351BD1F0DA9BC779E80BDCCEF3E3DFC1538BDA6EC95BC0784973C65CA973D4E10893BB31C58BCC70E4A3C52DFA33D9C9C6FBD95109ABDA3696BBDEC0B5D3B889FDA3C0EF0EEBC333268BD1E696ABD05C667BCBF65FC3CD2CE113B9F44E03C8A53F93C92477CBDD6FD223DA412463D26960C3CE9BBEC3CB0A22D3DBA02CB3CCB3CC33B2290CF3CEE8D07BD899F97BD8A40233DC2608A3D204D203DFA357B3D8145933D79869D3D8C99883D4550C2BC4630EB3C6F39F1BCBBAEDEB86C602DBD6E929D3CC3CAA3BCE76E0BBD2F782A3DF03BFA3D7E1B7DBD939C42BC51C70C3D20CD0E3D5956EFBCD71B4D39B3120EBD3C5BD8BD7CA15F3D93C11FBDCBD2AB3B6F40CCBC090DFE3D1D25ADBC6D9BE03D22FF0EBDF5B394BDD626B23CAF06EB3C28306BBDF456403CF07393BB165AB03CE471AA3CBECB2EBDB6E9DD3D5539A6BC87C18ABB307C233C632435BD027ACCBD66001A3D828FFF3BC26B57BDDED65BBD47EAC23DC485ADBD426B8D3D80F5CF3CB57FD8BC94A8DDBD6074253C9C2E6CBD5CCF09BCD5F1783DB07F7E3D46B61EBDFF7868BD7504643D14357EBDDC2D01BE04678E3DD6B108BDF9C6383C0A09F8BC86B03A3D9E7076BC5E860BBCC7BA8D3DF4DC50BDA35A67BCF145B2BA4F15B33C55944FBD5225B4BB2D0394BDFEB9603CEE85903DEB9749BD2BF58D3C69A7FCBA7D1419BBC94BA5BC299DBEBB6E58B9BDA40FDFBC6675223C44D25A3D93F64B3DC14E58BDAC75793DACB9B2BC30CE723D49EDB03B69B057BD9D3F143D6FFE90BCC80B2EBDBCE424BDE6175EBDA7A045BCD58987BC46E23CBD4A17953D3EE954BDD3D2573DEDDA073D25D082BD2794973B1F12A13C3BCAB03C01C6CCBD88045BBDADAA583D85CF84BCED6E393D6A2CFABDB3A588BC8EAB21BC55E59BBCBBBC93BC99AC333BF3EC7A3D4F3FDE3CD624103D8C4F063D70E21BBD15B3CF3C134551BDB947133DBC5E63BD52FDBDBCDFB904BD8BDE8C3C211E81BDC51C8DBD4C65EABCB8DF9F3D49F7A7BD9339B5BC3C89EA3C6E173ABC8651213D1DF1D4BD952BBABC8E8CAFBD43062EBD1E4CF3BC43FD1EBB93AAA1BC34E3C33DD1D340BC74D2C43D50BF40BD953A66BCACA717BD64292C3D51E1D5BC517E2FBD6D5517BD27FF18BDC892F6BBBA0226BD5675CD3DD14A013E8AD4C5BD8B386F3CE18F143C38B4ACBD3A590F3C69EE8ABD015C33BDAD68643C9A50303DFB450E3C26F9DCBCC90F89BAD1BD2F3D26D4C53A43A4B3BD34E7E13C1F49A3BCF4019EBD84BF30BDF74A6F3DAC2399BC68ED00BD9783553D2A99C8BD3095DD3C12F31DBD0013883DAEBB4ABCB9746EBC7347AABD5E4C813D9CC8993D04909DBD22DA3D3D95E1423D15E0753AD0FD0D3DE99CA7BD15F8A23C197C643CC57E5C3D051E543D912D8DBDD97C87BD5EF9F9BC1786BDBDA5EA75BD4AD18BBC412C6E3D39550F3D0E4BA4BD7B5C17BD916D08BD0010B93C2DA643BD14B2DFBAA211FCBC7EE21E3D47BD333D4A181DBCE4069DBD3A865F3D911097BDD038F7BC78A010BB09462A3DE1A4CA3C7B1E123D455C803D4E1722BCA39EB6BC98A2803D545680BC7F44913DC4C291BD249C13BD7A06DD3C133ECE3CA74AA4BDC9D3BFBD5C183D3DC95B46BD8B42F3BBDE1A9D3D6267723DB5E3063CC640153CBB3F603CCE8DAF3DDADF6E3D6EF4B53CB912173DA87B383D91B405BDB42107BDFCDA6D3D0A6BBDBC019365BD608D013DBFD2C43C65D0EF3D08A2D6BDF1B8D1BC46F41CBDA19672BD5A53C63AA0B8B83C964A8BBCA597B73C1660823D676464BD2353343D6CE28F3D3F5DBC3D5E46473D157535BCC6674C3DA18D183D91CE9E3DC664243CF2CC4F3DA9C64A3D5686813CE28392BD6068DE3CA211213CA4B4B63D8587BD3D881C6C3C108098BDE54084BCA3DB263D29DEBF3DACC880BD978E243D4C1196BDD26E09BDE8FE97BDE44054BD44B789BCDEEAB6BCFFB288BC74BFCB3CCB9109BD16C72DBD9204FE3C072B2D3DA6FE443D4B179FBD24970E3C313F7FBD6E7AD13C3719CE3DB1EDBCBB203B373D4C1095BDB083923B07FC633D5AD8A1BDEFD4AA3DE8D185BD459B7C3DF888A23A0501ACBDB85589BD3774853DA8B088BDE1E9A8BCD789A03C2BDE793CC13B773D171CC13C2D17BD3BAFED433DD4F7A5BD350D963C61CF373DB7A5163DF082A3BDD7760EBD105783BCFCAFB3BB56D8643DBED00EBC5CBA773DFDCA973CB00B6C3DDBEA2E3DA316E33B601E6D3DBCB34EBC78869F3D3B38553D196C6FBDC69258BD0B6577BD371E90BC60F3F13BAC8981BDA550E83CB978403C39120E3C8F86C13CFCAC3CBD2A9E433DA815C4BB297588BC7FAF9B3CC1A5003D3D81FD3CE380E1BC929B993D6AEBEB3CBD5A1D3DAB15713CA510CC3C2F54E5BCAEC485BD6F19643DF7D86C3C9F0A793C2D5D6CBC3B2F173D4AAD423D41F730BDB3CC9CBD259B783C30751E3DA56581BC1421A03C35D8623C063BBC3C9713023D0342553D91D1183D36341C3DACE796BC033B7ABDC119383D80C048BDA14480BD6131DDBCC476073D24A8893D05A15CBD7610FEBB5EB9853D9F442D3DBE9E84BDECC76A3D75D7AFBD94687DBBDF13543D49E3653DCE3836BD4F0C723DC23C17BDECB3EF3C878B73BD75AD753DCCB9A43DA0353F3D213B273BE7E383BCFF8DE53CD22D1C3D2661C73C9674D03C6C33A6BD9AFD27BDE367BF3C5D14BD3C0DC98B3D9BBD793D185465BDC953503D76E7A4BD48C5143DDD9783BD3F3779BC422DB13DE9775CBCCED193BCB4D13A3DCB35283D17B162BC477D2EBDD18950BD3B9928BD380B1C3C67E35EBD937DB63CB36B6EBD4EB758BB645408BD0E0A073C01258A3DA8269E3D28FC3D3D3AAE8F3D2A92993D5BD8353D02ED623DEBAA243BCC5F00BDEF0A513DE1F598BD30AD8D3BF7BA92BDFA2780BDDB153EBDD3FC31BD20859D3B0FA7473D858E7DBD896562BC49B5573D58603ABDFE6521BD935E6D3D754EF73CBBE9293D26A79F3C687B2CBD574F9B3CC89BA0BD986E8B3D5C5AF2BCECAF193D79AC993DFF1D80BD3A82173DCC599EBDE538933DD40AE2BCBC1D83BD329AFDBC00D93D3D13E309BC4C5E7B3DF524EA3CE2CDDEBB4183E3BC15B41B3B930E923CB650243DBE854B3DE94A92BCEFA59A3CEC2A993CDF945E3DA127A9BC5A88A73D1417203D013F243DEECC133CD62A80BD9877A8BC60B6443BFD9446BC932C65BD766494BD6023053D15FD8A3DE8E9313D9CC3EFBB179E183A618E7B3CB9D27A3DE7B79B3D615C7D3D0553053C9B2D73BD92A3783DA093893D2E424CBCBAAD643D4F6E64BD435C463D3563F13B4CD8923C26E9793D39EF92BDF6BB8D3DCC85933DE6AF9EBDCACC86BDF42D853D1463EF3A1748863DDE6693BDF9E7E3BBB623FD3C2E8F92BBE517C9BACC60A33C082583BDC5F1E23C7ACD8DBD3355973DA3D56FBBC9DE72BC898C25BDA1B72D3D24229DBD37C297BD2AFF84BD567A92BD702BAFBC3E31A53D8308803D624E24BC95C1003D20C248BD66678F3DD4AC6B3D92F776BB13D807BD7D90A3BD007D5A3CF4C503BDE80891B95362193D901A9FBD58FB24BD3B803BBC3BC72FBDF55D66BDD2EA73BD2DE154BD3533A03D64AA5A3C5A61B9BC7AC7653D578EEFBC122218BDC78FDCBBE525053D825B6D3D6B74A5BC827463BD62649A3DDCEC4ABCA0E680BD67B1643D45153BBD1D384CBC069C8DBD1900933D552CFABC4C53CFBA7FEA1D3BD9B6A33DDC56EF3CE7AE2ABC2766913D68F4E3BCC8C294BCDDB38BBDAE3604BDFD83053CE65664BD7CD694BDFAF6003D4E40D23CD363A33DCF0F583DDD0953BDFC1E913DB43316BD53510BBD9193A2BD5B6781BD5D748CBDA38C073DFCBEBC3CD568A0BC17C65C3D87EDD23B317782BD8049693DEF6493BDAEF36CBD674A2E3B3D0B3ABD8A6A4CBDB863A5BDF8A8863D8C1D1D3D791FDF3A7773B8BCC92BE0BC2D37C93C08D3F7BC3433973D624D0D3D6E1BF93CEA2E0F3D1B8F113D6BE0EFBBD670A1BD3E3D5E3D9D87FC3C46611DBDAFA71CBDD572F03CDC445B3DD3F5C8BB86FC013D4FD6D1BC698443BCD7F2013D5FD191BD12DF033D9E9454BCFA804DBDC0ACA03DA500AFBC63B889BCFF8B8E3D726E94BD69518B3C6EEF4ABDE036963C45DB653CB6851BBC6D95A0BDF59304BC553D683C17D98E3D3C8FAD3C1AF11CBD191F8C3D8A50BBBCA005BB3C71D016BDCBB8803D80628DBB13659A3D496E95BCCAD205BDC749E9BBC277F73B78CDA4BD493685BD9551FF3C232A46BD66CBF7BB22975BBD8613013D36665E3D2BB1BCBC9DE817BBF0F6CEBBC535953D8206573DCFD81DBDE5AE8D3D491E523D726A35BD929B9EBD67898C3DA5F593BD97B982BDB78683BB2E8427BDC0E33DBC8C478CBD0378183DABAB28BCE6A2523D9CB73E3B02329A3D72A79ABC22D71BBD55A02F3D2FCAA33D4D52993D238195BDF304813DF7C1C5BC1AE8FC3C745373BD20DCB4BB44DB91BC270F363D00F4BC3B748FB3BC61C6933D46E4293D23833FBD86A9C43CD00E94BD0CB90D3DC723A63C56271F3D41BD853B9957623D883C6C3D9E7D593C4EC6393D807DE3BA00DCF13A83FEA3BD392C80BD0B84E93CBD5713BDA0978B3CDB353DBDEB2D813D7CE4043D5651AEBC9ADB5C3DFB17173D18FBE03CC75E05BDBEBB913D69B30D3CD8B47BBD1154A53D67D9973D3B418D3CF084203DFBFB643B622F36BD7652B13BFEB6633D77F153BDD2D3DEBCDD6E5EBD3E1E2ABDCC54373DD60D24BD99B4123DE4361DBDF7B4903DF0018EBD2C4BDABC7125493D5A6C943DDF99CD3CCF25183C184A933D50AF9FBB33CDA33DA5EA37BD8A1E963DA3307FBDD41442BC71BD95BD1B396FBDBACA9FBD19009CBDED4E993D0CBC24BB46949ABDF0C1863C07517C3D58E4603D8AB6723D7CFE9FBDB5D674BCDAC6B1BC81D233BCF2378E3D7144123DFD54D73CCBC690BD7EF28D3D6E06A5BC2219643D6FAD873DAD2B173DCCCB79BCA9315D3D91CFBDBB77674ABC5CC855BD50359E3C9CE7C5BCEFD09DBDA1A2553D1C5F453DCBE911BD55C55FBD999A0B3D99A8F5BBB9DE2F3DE26D043D007115BD57F78B3D0E7F23BDC4A5FABC9D70F8BC8DF3BE3CB5B8813C407C0B3D7A19533DF349543D35D3A2BD27740B3D3BB1993D54E0613CE7EB2A3DD3BE963DBB0F1F3DCEEFAFBCFE18203D563639BD80D1753D09AC39BD449C8D3C32F3BA3C78E9713D4BFF953B13A01A3D8BAB6EBDC408433D0497C23C1D165D3DCDE80A3CFA2AF6BC02C469BD3170333D140D383D08EA6EBD5F58CE3B920A983D2BC889BB409E873DF1605A3D825C99BD6A109BBC49E197BD11028A3D885C413D5A31FFBCB40DC63C58DCA4BDDC4F5D3D8327A13DA2B0973DC331CD3C2FDB25BDAD9978BD3664B33CBF18943DCE03D9BCCE04E13CC5849B3D98B6733DB300CA3C5DA382BD5616863DF96763BD775086BD159920BDF6378E3CA3473EBD2B79663DD85436BD807A35BC66EE973DA74D1F3D7B0F98BDB86A953D2D6196BD1A10A3BDE6349BBDD8052D3D2CE57ABDD2C894BD0AE025BDB53CBB3CF50EF63CD48F32BD8FCA8CBD22906F3DEE42FB3C86DE5BBDD3D71FBD7E39E5BC8CEA97BDA38923BD0BCC54BDAA33BDBBEC55883D9FEA9ABDE6282B3DDA4C143DB7BA98BDF78F643DF28ED7BB906F79BD5C9A27BD00301D3D055182BDFD0772BD7703543DFD88553DE21F10BD917AF4BC719555BD479524BD783C07BD1BB61A3DAD1E953DD1F990BD96833A3D36592C3DCEDC81BA2052983A725F78BD0A4E92BDF06386BC47DA343DA95185BD5ECEB1BC293982BD6539503BF3F915BD47EEA5BD7EC69EBD167FB7BC64A5D83C6C2B44BD9A2C65BDB035693DC59EDBBC8942313D1BA097BD821F913B6E178C3D6688ABBC561ADB3C063D8EBCAC3F82BDA338033B895E77BCB39692BC79748ABD78B6BC3C3F8747BD08C492BDF778EBBBA29E763C17C3A33D488A043D73BE903D579D6ABDF978C23B1931053D2F505EBDADF9943D9DD136BD99E5E8BC2A05C7BCCBA1B6BC27B291BDA879363DF9B0A7BD41468FBD8B79213D3387733D338CA6BD7E787CBC6471133B4E66A63D78FD93BD99EA9EBD846EC73CEC6E0F3D50B435BD772E953C9E24D73CFE173EBDE68341BD135D82BD0A7650BD5DCD7A3D9C92403DD17684BCCC91B43C70C60C3D8BDBFEBC2459713C569F833C8C8462BD56CD3CBD8CBE71BD5404293D2228A9BBBB719C3DC2C4AABCE79B3BBDE96B833CECD5A1BDD43502BD9E799FBD406B1CBD010A5DBBFB8CA53D378B263D6E0E9B3D00E1B6BC9CAD053AA5838CBD7F4AACBD72FDB7BC83D5D23BE15C9FBD377F9ABD348A7F3DDD997F3DC7792FBD5AFB5A3D9239ADBDCDFC68BDCE7C423D8B04ABBCBDF816BDC75376BD6B2E6ABDFBFC67BD422395BCDB113B3DB2B654BC2099003D22341A3D508DD93C17941EBC288FC0BAC5AE373DDD47B23DBE1AA23D2750783DA334893DFC7F703CEEDD423D1497203B0E2FC4BC077369BDB3DAA63CF53B933D5904A3BCDCB2943DA2F83CBD18EC373D5D0283BDB7BFA13C04DE323C931896BCEB95A4BDD7783B3D2DAF583D2B3E9CBD400070BD43E2DA3C3E9B64BD27A5E1BCD8E463BD1C6A57BD188996BDAF8AE43C28214CBDB35B843CCE13143C565088BB936AF0BA6F9BC3BC9ECACFBCFA0F68BD54E5043D271070BD68F8A7BCD169DF3C87CE193D2821373D78CB56BCF2BCB13B3074833D80B6B73C9E5608BD9180CD3C2CAA923D76357DBBA6148E3C0640773D8ECCF73BF78249BD0A478E3C3789AD3CCE138FBD5307013C52D7A23ADF531B3D6C753E3DECE9483D5F84003D11E53A3C9FFE20BDC61C923D9B4E0D3DB3578F3D4546A4BD9A6780BD8384353CE0468E3D8DDD8DBD2C428F3D543E7ABD385D243C236754BD288F8E3D8C5584BBBC7F963DF499363A9C282FBDFEF9A6BDCE5182BD0A6503BCE445083D626E8C3D616E65BD75426C3DE4DB683DC62C59BD0BFF97BD0F81643CCA70ABBC73AC123D586F933D0A13DB3C8066EF3CB6B5AD3DA3289ABD21257C3C9BA43DBD715209BD70CA393B68382F3D894DCE3D746260BD45C847BD31829ABD91E5993D0CCF3FBD6BB5753D97BFF3BB8DD7DD3B082233BD08927E3B63484EBD0911C8BCF50E393B4C429C3D44F2A9BD61A171BD78CE5D3B64E582BDB9012DBDABBB91BC786D883D3578C23DDD6922BD35B9403D9BE8383AA5B0873C74E32F3C3A3F1DBDEA4B5F3DCE78573DDFE2AABC433C8E3D24CA903D03862F3B562D033D3C1D69BC8CCC40BD0806703CA5904FBDB088053DA44BD13B898BBB3B89CF62BD1A65A43C98B1753D8F6F36BC589065BCA2F23EBDC6E227BD00466D3C8C7275BD9CC28E3CC5BA0D3DF1A2ADBC865093BD0AE118BCBDA7C2BCFF0F9E3CB0217D3DAC7B283C30B67CBDC0F443BDE5F26C3D0C72B73C398359BDF2040BBC6CC34EBDEA915E3CB471CB3AFFD004BD48CE9CBD8A76813DB1AFA2BD48B99A3B51A365BDC77881BA04126CBD9FCDA73D32F7123DB0D5CEBC9C9E7D3D7A88133D9B4081BD8C48953C33ABFDBC4A5A5FBD58DD8ABD87EE60BD3C8634BD07934C3DABD294BDE57262BD191B0B3D1B7519BDC264D2BC3D41383CF59A5DBDBF82F4BCA887C2BC752BA6BDA479153DD96AA23C7D1CBA3D7E4185BD5B5B613DCB76ACBC91A1713C6274303D211EFEBCF4026B3D51DA783CD5E61ABDA8827E3D3A179FBDA8BD333DF28A873D3CEB903D9562553D44A27EBB5D59843D3427A93D0DBB13BCE3CA99BDF1CE82BDC3DE90BD2187DE3C73BE913D84639E3D3C9430BB8324DDBCD1E4353D5A6086BDB433383DCF36323D8B93303DA7FD8DBDCE59313BE9E122BB4BC80EBDB3369CBD2F2CD8BD679F943D723042BDB41822BD130404BB534709BD33C6FBBB23D191BD363276BD96B0763D23E490BD499372BC2A08C33C75738A3D69FBA43D8616B0BC505810398A0797BDEBE78BBD800BFDBC295BACBD0BE84ABD50307E3DCE87E53B0CAA87BDE24589BD3F6EC23DBD3DF03CC34C1D3DE199E13CC097903C6ABA773D7D49B5BD3D98673CB271323CE5A17B3B59A277BDADB92A3CFB4A8A3D07766E3CA46B8CBDFF1D55BDC815E4BDB6E554BD332B873C1FC54C3D47A966BDF9DB72BDC98013BD092928BD97FE69BDFF65913DA6B1A1BDF2ABCD3CED873DBD2B568C3DEFE59E3D9F7D16BCBAC4A4BDE887633D11E2103CDD6976BD51D6AB3DE161963D6A756CBD7908C63C441908BD8EBF46BDC50D723D1E2E0F3CA3D05C3D6CD40B3D08AE9ABD4EE5EC3B5CD7A03D279F1C3D83FA53BD16B9A43DD934653DA1C4513D95A1ED3C5B287DBDF2A7053DB67776BD7222A2BDD47C00BDCB49B33D17CD363CEDEC6D3D93E394BD3D81F9BCAFB24DBD41555E3D961CE23C4BF73BBC8735123DCCCC8DBB250EFA3CA572833B745E5D3D6947B03DA871EC3C0273F73B3FFC87BC5AC1A53D07FEBF3D490C123D740D503D4CAB81BBD0F917BD35D191BCE94446BDB5E1AABD457F843C8D2684BDABCCA33D2EAD193DA463AFBCC78FA13C4BE7383D844BA53B50033E3DC5CB0FBB794CB2BBFAE0CC3B8A0EC2BC3D935D3D2482553DBEA594BDD56D4E3C50B888BB504C993D084AB2BCE99D66BD95B3733CDC3F5C3D310A863D465509BDC7F0B2BD700B29BD940D993CBC4A993DD6F2B73D3EAEC33CB627FABC49A424BE5D8327BDCAFBBDBD64FDF8BCE2FA2B3DE3BC0E3CE9A1223DCF319A3DA4C88ABC4097F53CEBBAA4BDC50987BCF772193C2783D43C927EB23DC6B51FBD8CCB123D5E59ADBD782138BD90AB3E3DFF27433D31338A3D81E5ADBDA873B53B41BD99BD669AD03CC42317BB9C707FBDFCA5BE3C95EBB23B6CB103BD035AB93D0A68923DBEAA90BDB0E269BD2735473D2ADB2F3B2F3E793D71D700BCD2369ABCD65E773DF55487BD3384C53BB0F062BD4D811F3DB256D33C0A7E40BDD3F88DBDD3B04CBDE45C14BD03C845BDD9CD59BC021B053D7EC609BD056C9F3CF888963DC6B991BCBB3850BD7CE393BDA7DD613D26FEDC3ACDF875BCB155103DBAC913BDC4CFB1BC60AEB8BDE1E0DFBC7A5699BDAB8D753CA22512BD208544BDF0D1833D60A0CDBC57763ABC48AD48BD8D60A0BDA1F2893C016C0D3DA0C104BD737490BCAB5974BD60FD543DDBB1B3BAEF52893D3D3F90BD73B508BC8A9117BC84E6B73DD30F1E3DC7CD073D7E855DBD0ECBAE3CC3D72EBC5ED9203D82CD49BD813C87BD79D10C3DBF3830BDF712903C8A66D0BDA13C253DC5FA2C3CBD3C3F3DDE6DF83CB88C48BDECECA6BC295C9EBCBE5C8FBD0C9C51BD1247EABC4DAF883C1671B83DB9FB4CBDD2010C3C8DDE863DA81004BD4F3D69BDF8FEA13D4D46773CD2C7A83D4842953B991ADBBCE047743D7A463BBDC0B82FBD385F313DD718F83C4FAA473DD01504BE9D2EE13B3FEB4A3CE8D5AF3CD1A3043D61BBC4BD6D7137BDF470813CB2F9133DF234D33DE8D133BDAE02EE3C000FBEBC600F3B3D4CF842BDE837ED3A8088C9BC6A0FB53C7BF883BD29F503BDA682F0BB1C4EE63D10887BBA68BF9C3DD21B62BD54D391BDEDC0D5BD7DCD153D869F873D504D463D4A5C203C1EFC0BBCBFE455BD4E6C8A3D12DC593AD2C5483DEF3D543DBCB42E3D3BD55F3DD99E533A475B80BD08B4D3BDE3D008BD899B593D3484A0BD745549BD0479BD3C85F088BC347252BC00C0A4BCC134A03DEBCA923D66DA183D2C4D4ABD66D3A9BD6E8A84BC62EBE9BCA6C25E3D77BE9BBC85D0AC3C247CD9BC8E0247BDB59349BB4EEA403BAFB092BC3EDAA6BDA3A7453DFB0FE8BBDA28973D261CC1BC4B550A3D34F49B3DAF7D05BED88BABBD0F0663BD3FB84BBD1D6539BD799680BD2F728FBD2EC3F23C353D53BBF9BCA9BDDBE1E3BC7A18E23DAAE8E73CBFE693BCBDC768BDA56FA43DA6ED9CBC67999EBDACCA43BDB31C0B3C236833BD0422CC3BB775373C0A7C0C3D6525F93C6900E3BDB63221BCD9B2D7BD9F3AE23C21E8DEBCFF759E3C55D03A3D60756DBD0B05E8BB21E762BD727453BD3EF9EBBCE6EC023DA50E3B3DABA5953C5518A03B08943ABDB1DBD3BC76FD66BCC71603BD303C26BD19711DBD70944E3C04B656BC823A89BDDC7DFCBCC6845FBDCAA275BD84D32A3D736B40BD1280053DAFC9C9BDD5C3D13C5D4AC9BDE80EBA3CFD807CBC7DB2ABBB2E84683DB7F16FBDF0CD823DB5064A3D797B333D85E878BCB3F51E3C4BCC633B1733D1BB615A0ABDDAF095BDA2CF653D9D26AC3D3A5B6B3BC4DFC4BDC0B3FDBCC3DF0E3CB4D1073D52C2A4BC250485BD4579BDBC58FB1ABD0835813DA376563C673447BDD4958CBD8E9C2DBD4759673D699C1EBA00042ABCB9B229BD3410A93D41C1273E05945EBB292609BB4EFFCCBD55C484BD657A523C52158CBC0EFCB63D3CB6E53D0C98A93D3FBA70BD1983363D6AD025BCC072DE3C43118ABDEB74393CCA3A883BFB980A3CC8233A3CF57D813DF6BC99BD85C1A8BC3618823D9535C83CE303B9BD7B60893D4DB75BBD8CE62ABC500B9F3D3BD0873D09C3CE3DBFB5893CEAD395BCD47CAF3DC6B336BD9156C5BC402B06BEEC86543D789C1DBD57DF01BDB44B33BDE0E0A03B878BFA3C5E9CDEBC636160BD31B0A53D8B1D343DA3029EBD98CE303D44D402B99BC5433CD764FF3CE00A023D95D58C3D06EA9EBBFDF618BDE9E7D2BD211FA03C82BE22BDBF239FBD1DCD96BD1029943D8EB0273D75528EBD331A283DFA16B9BB558C453DDBAE75BDCD6A603D0C95723D4BBD34BDD86765BC047F853D2ABD823D50783C3C85396ABD8B158A3C669A65BD603A9ABC74A2CEBCBF15123D36B03A3D663ACE3D7C64F7BC6DE4CD3CD23BA2BB2E66AABD9273CDBC637FF13BA973B0BD60C32ABEF445643D0DDA41BCFD749CBCD0F3A23DDB13ABBCFE7B583D8B98E43C22264BBDD9F3C53DD10943BD931C823BCAE876BD132F97BCBF67C93D7C56ED3CFFAA10BC2E15AEBBF63B20BD4F8C623DB7040E3D2A92A0BC869E33BD2ACA9FBC8CCC91BD407BC7BDDCA1013DDC6C523D9C37183E35B1113DD29CB3BB8167E4BC0E0A46BC016A373B05EA723D1109E7BC5491863C5DC2123E65F6953D9F9D4FBC921602BDF4D4D8BD90EDBABDD90CA9BC319703BD4794E5BB000C073EE05E8C3C9F923F3D6932113B01D61D3DA06A8DBD4CFB943B9B7985BD39A04FBD9A9684BD0F37563DDB7A78BB0002FF3C8C1FC13C40371D3BA2AD7ABD4BD79EBD5E66533C9F6783BC9D5E733D9E27C73DC6EE92BD6ED1C63BD107BD3DF4CC7A3DE8AB15BDFEDF30BD4F7BAF3D17EB98BC2CE780B994C13DBC39DA703D7B553F3D15BFC9BC2DE04D3DF352F0BC639206BD3A86F43DAD6FCE3C96A981BD3C51A03D7A83533D9004863C3967C43C630D8ABC95C726BC119B9EBB948E57BD628A27BE36EA503DDE0E933DA846BFBBA4D8B0BDB292AE3DD36AF0BB802B6DBB87CD28BC1BF5833DC0DE153DC9CBB4BD2942473D047DB6BDC152C93B9E278FBD45D3BBBC19016FBD7D5D2B3DB42CA5BDF4B62CBB0AAE4BBC07CBCC3D2FDDC23B93EAE43DF34C263D0855ECBC24F297BB19E937BD0DFF0CBDA33C603D76EAE8BC657B163D1AC729BD2DCA34BEFA4B69BD089AD4BCC34F413D5451A23DC045ADBC51A10E3D4B50CE3D2993CDBC05AD01BD6C22AB3D589BD43C285F993D999E38BD9971093E92D8BC3C16E1E6BD8613B8BC0DD91F3C1CF888BB27EFD3BDDD801FBD28E49CBDD87C2C3D81930E3DE22AB0BD7D0ABD3CCE99B6BD74F14D3D84C8713DED634F3D6D065E3D143D0ABD6B519EBC74AA34BDEFBEAA3D76A34A3DC118D5BA15F58A3D4072B3BDABF2AF3DA508423CB1666EBDE26C443DD5461F3CA4C159BDBC58BC3D2CB0A63D3296C9BD21A5A93D1A3B27BDF68BCABC29A185BDFCCA84BD335CB1BC1D917FBDCA2C4E3D150D2BBC67B86DBD9B7694BD25D3DBBC0D8DA53DAD6F57BD5A21C93C720AA9BCDA21B3BD1826713B1A852ABD1518583DC245F7BC6AADA2BD6C86FCBCB308093D1ABD383D9D27B9BDB79041BD5A68DDBC367CBABCF3C4B8BD017E373CB6C1B13DF3363EBD18363FBC7EC965BBFFB92CBD99854E3D1EAE5C3C56A2AF3D632922BC8DAB4A39C138473DD3048D3DCF2A303DA218543D6E4929BEF90AAE3DAAE69CBD3082ADBD35C0113D1F7EE7BC5365A3BDA65782BC54E007BD1229CABB19E4B8BC92E1303CE39B4C3D518612BCE783A63D7A36D9BCA4E78A3D6CCBD43D31063EBDEFE5BCBDC02C1A3D4BB0FDBC5A8D953D262FC7BCBFCF1A3DD5714BBDEF2DA33D39408F3DE52396BD2C593F3D0077973D6138043DCA8E8D3DCBE0FFBD4FC918BE8D5C0BBD586580BDD96B4D3DCB5E6B3CA979693B2517A13C77E146BD125051BD3E16B1BD96A7703D1D596DBDCC6486BD29F43F3C2EFA2B3EF2EAC4BC80BE06BD6C5F7C3B83524BBB3CF672BD7FEF3BBD5EBEFB3CE444AFBC450DC63B98F6F13C634FF0BC71F6A3BCD8F4F7BA3FF2273CCB126AB95ED2693D9141853D37AB7C3D90534BBC29139D3D96580DBC3EE7A33D8E0272BD0C9A233ED932E23C82FC1D3DCDDDA23D7953203DEA9FDEBC423496BCBAB20CBDFEFDD63D85C79D3DA5F394BD41E6893D8C9B0FBCDC93123DB07D3CBDD5836F3CAD0BDCBC6A8F00BD9D6F23BD5719553D64133BBDEE6662BD79624CBDEDF316BCDBE8193D8D47853D4D29C5BB3884A7BDF047883D363B1D3DC917F83D08F9C4BCB17E9DBD56969ABCD26C0ABD19F443BD045806BDDD0B3F3DE5BC073D80D09FBD6232523CDE2D543DDFB29A3D7A70FFBD5CC273BD64A95B3DDB083ABDF21C38BD130949BD1EB281BBCF40C33C89341CBC7A9A373C38BC62BD8FA8AFBC53D6F4BC0833FFBD75500F3DF470F83B177AB9BD12DB5FBCAE0ABA3BFB1953BC6261583DE82DC1BBD4F624BD23CA3E3C99E1CFBDD7663F3D57B2F6BC3097813D83D0E7BC8714D4BD4491AD3DB0EE153D24B87FBD8B6B15BDC22690BD7C318DBD14163BBD1A60DF3D675CA7BDB0C9C83D94FB67BDB9B6EA3C65231D3D55591CBC03226FBDE3CFAA3D53D3B6BDFF849DBD899C8CBCC652DFBDFE9E383D5DBAC23C9BACBCBD72BC383C9BB180BCB77AA03D6F7F68BD382B01BD501DEABDD14396BD890C9B3D085E953DC3F415BAD04D4F3D7459083D7373213D6B04B63CA677BABDF90B42BD5A074BBD2A801C3D086C2F3D0D7F3FBCB1513D3DC9AA4ABD725BAA3D6981893D331D2C3D1E2B2C3DACEBD4BC96FAA33DC6786ABDC2BA053D983F593D4E15A63BC04DFB3DE8FF613D151BCF3D81BDA83D9D9BF83CEAE7B9BCDA0885BC01164EBD4A5C6A3997BF4FBCDC35AF3B0FC6343DC34EACBC2005E43C3EDE76BD11D8923D2B4CFCBB1A5089BBAFCC50BD2DBC14BA976F3FBC9761D4BD761093BDF3B8D63D4220D3BC03B4963D3EE7CBBBCA753D3BFD75D8BC182A993D083F573D8A66A3BCEC4F4C3D37E08D3DA5008EBD64CAA9BD84A909BE1CE00F3D5CE9D13CA38A603DB47F25BD871B8CBAEC62563D86C0FABD247DDF3C135419BD3D8BE63CFBDC983D802C143B6C6C7FBDA58212BC3375D53C7D4B013C6D45873D0852933C8698693DD6C18DBDE16D2D3D4A9C623DFAED3DBCF9852CBD1775933DFE05703D26301FBC846E2F3C6070A93CA2E6AEBD4E31D6BDF5DFBA3D9318B9BD57E3853D168069BD000BE5BB05C835BC6485D2BC20A227BEC7358DBB79389EBD7AFC0CBE742B98BDA8E3863DFD1FC23D1640B8BB829FB43CC1F9CDBC2595E2BC436BFABBCD5F87BD547D523C3F4BA0BD1EA132BE72C9F8BD1B3422BE4A1830BBF5802EBD3CEAAF3A2C8F063EB6D6A7BCBED4393D6C10B9BDBB73833D6AC4F9BDDC48AD3CD07BD6BC3C6BD93D53BD57BD91BF24BD0115D53DF5A977BCDEE3F5BCB7A6883DCD37863B8674AF3D47AB093E16DDA4BDC1C5953B06B42B3DC5F4A83D87B3B9BDFB5926BDA6C21ABD3F82D83D90B95DBD14060C3C96D5EFBA0A9DC73C25AE853D380AF6BDE24F473C3330773DE45F9AB8F135133E21A3E43D9C1A6A3D5BAD153D95B4A4BC15C3DA3B70C80B3D33C2163E92F8AB3D95A848BD1E8E51BC212EC9BD6CC2703D901BB6BD3FB37F3C7F61E2BC3B9396BD1310C73CA8348DBD6622273D5B816D3DA3D2C53C6D26923D84330EB800D2F1BCCCD64C3D5972A13C57AC42BCF84D8ABC9A4B523DA4E9B93B98D23BBDE49BC83CBED8F1BD32E7113D0612353D8080FA3DB3E92F3DBC2CDB3C3661753C8F24D0BD8FE1B5BD7248D63C967F1FBD7B9AA33DF3312DBC0D6E933D92201D3D6C9ED53C5BFBEE3D1A7769BD5C4C62BD18E3CE3C2DC1943DF7B98ABD7D977D3DB1528E3DB906613CCF1BF03DF22FA43DD7E9563C27F0023DAA6E2F3D6F1B303D00347A3D6041FCBC15C889BDA445C23D18E5FABCF0CA05BCE49ABABDE2CF133D090949BD30D940BD2481C6BCF683C4BDDA99593DE0BFE73C23A5AC3D7AF5173E0F449B3CBFFC75BC36FB1EBD27F91A3D86EE91BD5285E3BC54B69CBD3628BDBD7B5AAEBD660AF7BCF2BC9F3D8F12333DBF2DA0BD6976F03DDFBC353D3044AABDEF860FBC8027EABC020DBABD2FBD8A3D9A5B6ABCAB1D123D4A190D3DE537B83DFB31F73D1725513D9725E5BCF325A0BD5EE8A0BD1A121D3D14825E3D45652D3DAB64543DED239F3CFCC6323C015957BC9223E1BD2B2471BD46BB063E22A6033DF3CB273EB0CB3CBD4A7E063C1DE80E3DC25F9ABDA5983ABD5EF1503C9F13DB3D10C5083E08AD3C3D07CB983D0C87F83C28D28ABD1945A8BD5359AA3DB7D8E73DF19B3CBD6BCA01BECE5CB13D0EE070BDCAA5D53DCC60093DA1ED243D879169BD4B111ABCC3A0833DE74F03BEB6B98EBDDB4051BC108A91BDE1D04B3D83A3DB3DDD53D2BDC7C6EDBCC556043DBD6CD63CDD8C6F3C2EAD393C1C16FBBC15B4193C2E450EBDBC26B1BD7EE1143D97626EBD79AC323EFAF747BCF7F12F3CDDD638BDCE21B8BDF01E51BD0480BD3DCC3F87BD13A6633D3B011A3DD4AD5FBC1030ACBCA114913CA97FCC3C8A873ABC4AF6A8BDF16CF8BD73CDA73D2C1C683C9FA3853D8534E53D9DB41DBDFB73AC3DC9922ABDAE200DBDC01D92BD628893BDA93540BCA46881BDC3F3D13DFF39A03BA50109BD99CF54BD626CC03BCD6379BDC7BE033D45EE11BE6A2BCBBD3C8302BCA8891EBE9303583CC9DB2CBC7693093D5AD197BB36CE9DBC6D78773CD86ABF3D50A9A53DCE0E76BD3047A33DBF998CBBB52F24BCB18BE4BC0328B53BA94BC03DF1F3333D9383CBBD1E2421BCDA450ABD91ED69BD796AC83CBAD40A3C9BAFC8BDB40CF7BC6B104C3D27128FBDB7D8433DE2B48A3DA8BDC03DC03B0FBDE94C4F3D849E7FBCBA526ABD40D3193D51A8673D9CC20D3D975878BD521C8ABDE2C4B13D44448FBD52ED623CB9B10C3D4AEE9D3D4AFC653B1B16183E142343BDB1F64E3DAAC7343DB879833B54D4CC3C40E12A3B222C89BC94FA783D563F963D3FCE86BC9A59453DD75FF4BD49755E3DA4DDF13C4E480E3D02870CBD6B5AE9BDD33A873DB2CCB2BD4E4C943D881100BDF6DC9BBD686949BC82316B3B38944EBDE390B33D66629E3D3652383B4B057D3D74D29E3CC805163E1AF698BD53AF173C8393C23CA9CEB8BDCD0D273E7F27393DB32EB93DF062D33C4A0453BB13DA343BDA783F3D688279BDC0E7B73D1B09D13CD6E36FBD08BD123D7D26523DBB57DF3BF6400B3D01C2F6BC5100783D5479113DF86FD43D1A6C05BDDBC9A13C9F616E3D474EF63CAB47C8BB721F3CBD7556B3BBC8568DBDF0FFA1BD4BB7573B4D21DF3D620C083CC252A63D4CE397BC0D30E2BD6132FDBC54F02A3D75ECC0BC1C4F8F3DDA2E9A3DFDD6D03DAAC9F3BCCB660E3E67BA5FBDF44FC33C7162AFBDFFFA0ABE8E94973BF46093BD7C3C553D98E0063E84CE923D53CFE13CE41B053C13BC683D3571B8BC7C55CCBD535FFA3ADAD5683D4640BC3C31E0BCBDCC86CBBA82CE87BDB130AA3D4A2CB53D261151BDE5C7683C017DADBD018225BDFDCE93BD6AA44ABDA931B9BB1CF4813D559528BD9F5281BB6A90E63C5ACC943C6965DEBD020BDE3CEE4E513D9C1838BD460323BD31D5C23C3E078BBD10C930BD35871B3D812218BDD4F46BBC7D32A03DE45A07BDB2ACA73CDD2FEDBC1773B03DD49C8C3C92799BBBE4A48ABC72BF19BD1DD8A9BDD7D1463D724FAA3D0DF1AA3D7AE8423D48F3DEBBCD2DB7BD91EBB1BC83CD07BEBEADA93DE0D2473D82186C3DACFD09BA35CC3ABD96FD153D3C3C0B3CCE280B3DE34FB6BC445183BC80505DBD10FBB4BC385ED4BC6FC30F3E98661BBDF07194BCAD4360BD507947BDB1C9543DDE15283C56F46CBDC269973B6115CA3C4970083EE2DCEC3C5AFB2FBD30EDB4BC337B17BB8CFE933C09D3D0BD37F284BD9A0F113D7691823DA72563BCB1DC8ABDEB5D093EBC07773D2E60F8BCBB8DD0BD2647F63D271DB63D616E673D466FA63D4CC9103D65C9583DC3E7813CAA769DBD4EF61E3D0DD464BD478D6C3D5FD2883C8D4EE53D876FC4BCAEE6C0BC9D0D5E3DE3DC233D310265BD2A5D2EBDF2DE6FBD4406CCBD59AA9E3D70F485BD52C15DBD8DBAA63B5B65B93BF8E10DBD15B60D3D83A07ABD29195FBD9064EDBC72CD973D3E1627BDED1F143D3A8F043E2274913D12D990BBDA42A43DD3E8B63CA8CEFABDE035D1BD9704723D53C319BBFC70C23C6985C3BC8FBC78BD02D08A3DC219DB3D831A033C59D5CFBD42EF02BD5CA65F3D55BF993C73C579BD0BD0E13BCA8A603D1D034DBB461CADBC21234E3BF0F5133BDC9711BDD4918D3DC3A33DBCCB6B5C3DF16D043B2BE4B63DC5CFA4BCBE34743DD86D4D3B95A783BDE4E5A83DFDE06EBC64C9ED3C3064A73CF3C16F3D7C83603D4CF8BA3C280AACBDF913003DFA2D833D5F15BCBB8E55A23B84A2033DC1C239BD4B89D1BC1EAC0EBD90189EBBCFA05D3D10DDC9BD036507BD47961E3D179B573DE82C493D2418A0BD269DB5BC666B90BBA648B4BA59A93ABB51AD43BC47AF81BCBE1850BDDF548B3D5F07B63C023D813DAFF0113D2E221B3CB4CCAD3D2EFB0E3C1A25A43D306418BC077B7ABDD953C5BC3C408E3D1555A23D7D374BBB2FC8AC3BFC3EC33C68B5763DDF61F6BD7BD4CEBB4919073DE33A8FBDC2A75BBD6CB3643D3C0A063D65221E3D9823F03C1056A5BD0E8528BD264D903D6B370F3D17BF4B3D5504083D89E6633D26527C3D4F02B6BD17B72B3D8926653DDD40683C96217A3D2CDC73BCC0EC283CB490003D05A7313C4DBF19BD447F1D3B60ABC1BB6EB3F2BDA7AA46BC671DFA3C3F81BCBCA64E10BB873E9EBDD347C13DC685E3BD6A1C02BC0CD78FBD40C63BBD66CCB23DDFFCA43D915F273D81ADC53B84DA043E457E993D720B803DFF7E6F3DDB11AA3D8EAF23BD5063E3BDDEB3A23D144860BDB1943CBC43B29E3D0436A93C92CBC3BDDD73D43D42377C3C21A8F33C3413ADBBD26A1E3D6041B33D7ED46ABDABB6AE3DBF82713DE438843D0C7B49BDAE00123D75C5BFBCD353CB3C2B7923BDBE3EEABCDDC4A8BC93828A3D24A148BC834F753DE1CB9A3DBF500FBDF8199E3CC272393D8CE5B13D850BA53D666595BD9684E53BD69903BD621E83BC168C0C3B24664FBD05ABBFBDB99F693D91A1EE3C5B2D00BDABC34DBD9D6D753D14F74EBD1BC6233DCE7E5B3DF5693DBD192CF33CC76A97BD6D772BBD4FA96BBD0C92293D6E39A3BCFC51823D650786BB41E6CDBBB3C13ABC55C6683DB00B4B3C173286BD82338F3CA5255A3D0037A6BD3DB8A83D2B76853C65DCB43D01C85F3D62F072BCA6910F3DE5A0FFBCF43AA83C9928773D16E7283D9F85343DE5660A3D7D3B21BC376A6D3C59D327BB35F71D3D615B0F3CF66C16BD6DC0853C4411453D2C661D3D504A043D900319BD65EFB73DDB8A973D147A863C0D4819BC0A412EBD6BE8023DE8C39CBC66F743BD3FB296BC2DC6B6BDFD0EC1391F0719BD0441273C5CCEC73C73AD2A3DBEAC55BCCD788F3CA1B1193D5FB6043DC6381ABE818A11BE9740793D6D4B943CB643883DDD8F953DE51C3DBA7D77A6BC285E6ABD9F795BBD97801D3D759AA73D71E7F23D31A2A4BD3DD6953B3414643C85090B3E2255FE3D7B8F093D38024CBB1A912DBD7DA085BB2FF68A3D8B54E13D7A4FA63D0CA41BBDC3DB53BBE13EEDBDDE39673C7D99103CFD3A49BD5F2A19BD19955F3B067948BD565E233D5F9873BCC45DAEBC921287BD4FAF17BD5D729F3DB961793DAB87673DD251A0BC2B2D8CBDC6D954BD1EAA833C195D9D3D658FD23C0D9FFC3B8A696DBC495A86BD5DEA81BD3AFEFDBC0E94CE3DE74E60BC484EBF3D3809B23D9E100B3D0BB3BEBD260A2FBDCE01D6BDFE265CBDE9A29D3A0FAD51BDA33F12BD65CD1C3D3FD8F13CB28C3DBDB517813D52461EBB7FBC0E3D8E92D2BDE8F8983AA49C043D715150BCEC0474BD12CCA23D57222CBD322E073D2A6298BC450E5B3D579B6FBD26D7263DB68CC3BD55865B3D208ECDBDD6A1DE3DDE3905BD589B1EBD9EFC51BD3C3487BA80C3693D9A4433BD060CF9BC5C22183D8331BA3D83EFBDBC103D603D4093C43D3B69ADBDC62C703BBAE54F3C9FB021BCCA2814BD17B133BC988757BD3567B2BC74AB28BDD8010CBE01CB76BD9A0483BBC97EF73C01DEBDBD33E25ABD05D82ABDEFC308BD1AFE7DBB27E9633DF3F0853DFC2A78BC729396BD38193D3DD2A22D3C14077D3D93F23DBD1496E7BC04016ABDDF2A123D3B6870BD3BE490BD8597E1BB8C5F863DA0B082BB740239BD7FAB883DC854D63CC36305BDCA796FBD55085EBDC5AD573DC82DCF3D33AB98BCA5F650BD0992AE3C8D3A2D3EE10DB03D172D57BD92C965BD5980803B9B87B9BD35445BBCFF25E7BC09F7C1BC324C9E3D6986BE3DFF74BABC6F06A53DABFDFC3CB6F176BD26D352BDA5B6F0BD3D99003E7E2CC0BC20C6833C3DC4E43D77B8F53C89FDF8BD2DEF563D1648A6BCDD721A3C7B36883DF1EE68BD084FA1BD300203BEBDCE483D88FBFF3A028C96BD3D0E33BD5E4104BE0451803DC0B490BDAB908D3D6F0D16BD7036AF3B343CB33D7B0C42BD6C54A8BDE055DDBB9EA4B83C3688F73CF3EC703D0EB37ABD56CA333D7329673D9EE7EC3A4440A53CA75E483DF48B26BDCE6609BD9D12B8BCD75DD2BCF3BB4DBD0EDEF73CE5C7E8BD72BD97BD6D5D5C3D895C6FBD8F9EAA3C9B67173B5DF2C5BC481DACBD16DECDBD2A0B83BDCC70C4BC02DAD3BC7BB9103D234561BC3765BD3C3BACA5BD304C04BD05B3D73DDE3DCB3BED0FF6BBC615EC3C72D6A2BC1B20003D1D730BBCEDC71E3D5822B2BD414CA0BD91F28B3DD5792CBAABF8BFBC0D46BEBD254BF53B14661F3D1F77FABD804D9ABDC86B7E3DED08D2BA1BA77ABDE5F14D3DC0A1A03CD5C78C3C9862C7BD6A04D13C83228B3C34D2323D82C5823D9B8356BC03701EBC27C39CBC5655713D4CF7EB3CE276703DC6A21B3D075969BD5594003CEC06203C28991EBDC8160E3C6C75953C6AF78DBD9EF0D7BD43BDA7BDE25B62BD656D19BD5B7905B94F4FA9BBEE543E3CCC5C773D3B7FC73DEE290A3E408468BC57BCA4BDD2F233BDC2BA583D08F18C3DA571BABBC4B7633D9CAE9D3B174A653D13BF4CBD6691BABDE2D4903C57021E3CBC2C05BEC0692B3DF4089EBD5B07833D0668A53C34E6B6BDAB0F2A3D624DA1BDBB5C853CEA7023BC3320603D3DF7A73C2742A9BDCE09BCBD541F18BD3CEC8ABC45822ABC9424D53C75B1953CE086E1BA675C95BC48AE573DB64A23BD1DE4CA3D5C73803D8C4B20BD9441283D708007BCDB2DFABC6F0C70BDA30E23BCEDDFE53C4E2722BB4FC00FBD145534BCA8EC8E3D1FE6AEBDD30892BD33044C3D67109E3BC7972EBDB15792BD543C26BDAAFE693DA2D3A73D8B6171BDBFCC433D3E2804BD78F314BC5025EA3CB84681BDE4262EBD347937BD21DE83BDE0EF9E3D0422BFBDB0C45BBD13128DBD4B5138BDE5E01DBDF703113D545C73BDFEF9C1BC1736253D360D4C3D833D4A3D923930BD9ADB113D1617B7BD195A9D3CD6EE313D98588E3CE5C66FBD03DCCB3D4830EA3C81508FBD891F893DB39AACBCCBE944BD19D1133D9017ED3DA91283BDF673813DAA40903C4B0CF3BCB79F3E3DD83CB3BC0CF29C3DECB8043D16FA9FBD60E8403D2CF6383D7E6B1D3D245E9DBDCE6BCBBB9FDD4E3DD6F664BDDE0BFE3CD15F0E3CC04FBE3CED489ABDF85FAABD50550EBDABCA16BCB71C7A3DB7130ABD887FBF3AB5C8B9BC0A96263DE7358FBDB4B0203C521767BDAF7141BDD8172E3AFEBDF23BA90C3C3D903F32BD11CC2BBA15360FBD98DF09BD79C7683D46FEAB3D3123BC3C1A479A3C7552513D0C7099BDB6EA82BDC05581BDE18BCEBD6CFF433D67AE41BDEF85E7BB971039BC6BF774BCB8A0CF3C780E80BC87640EBB7FB3BD3C18D639BC35EF9BBCA86465BD61461E3D2A059AB86119D5BCF4ACB73CF048E03CD5196BBD5D57B0BDF2F05FBD5D3CA4BC6514A23D5327433D52DE5B3DD0F73FBDC930F6BC94C3C2BB26EFFDBCEE52133DF53CAB3C3F2A8D3BC738E33C386216BD2B484BBD2F878CBD1252483D86760B3CAC8583BD9958C53D1D55873D36F410BDE4E3323D72B52F3D79F5503C6FD7B23C7FB465BCC262973D4669353C163E61BD4E0C5C3D92C4843C6FAB9A3D2E12723C25DB1A3D7920D2BD0ACD0BBD552560BDB564FA39B4AD82BB7E35F23D8763073DDF32063E46DC6A3D02722C3CC51F10BC0EBD6A3C2F97D3BC96D9CBBC909E90BCAEC04FBD1D7269BDF9E93D3DFC50B9BCA28F6ABD729F59BDEE2A03BC9C386A3D39D6AC3CC983A6BDEC80403D4C5852BDB47CBC3C4AFA9E3CA780D1BDB93DEABC563161BD3EA3CD3C7A4A35BCF0F5AFBD51B8CE3C7D4918BD03649CBDE9487ABD1D25E33CAA62BFBDBCC78EBD4D6443BD0E8BE7BD59675ABD4694A8BC68BE0EBB828A1ABD2210943DBC328F3D57349C3CF49593BD967BF9BD75B0153C604445BC57BDF2BC6FF33CBD3AE61ABD6EB6293BC03C8D3DCAAC55BC2B6B813D4C5699BCD5EB7A3BD751043D155785BD48A6C83D71A35EBD6D98E3BB9C44C5BBFC407D3D3CEA823D5BD26BBD902A81BDB7EB1FBD788AFB3C290C3DBCFDCC403DBF678BBC1AD0F13C86C1CEBCF3F808BD396C573C69E2B33D85812DBDDC908DBDDCD420BD46F889BD453D81BD55D0823DC837243D5BC56A3D99E652BD3CA1E23CCFDF0D3DC981013DA6E265BD0F77853DA3C5543C0CCF513D9790B5BC0AB092BD8175BC3BA13DD4BC6E306DBD8D71803CB3A6983CFDD94EBC5813023CF5CD6FBD1EAE863C436DC2BB09903C3DBFB630BD1E9247BD99AF8ABDE5F569BD5AFF683D4CCC44BDCF4123BD30C8CBBC3FEFABBDB9868FBD93035F3B0B0C1C3D7BBB35BDE6FF17BD29C0DC3C59C094BD8BF6FC3BDB69A33BAC54573D655C66BD713EAB3C982D54BD6D5A403DB3161B3BB29F7CBD4BEA81BDB36309BD9CEFD1BCA77DE2BC7FCE023DB26645BD298C9FBC8305A7BD4D5532BCD59C5FBD9E0E203D3BE6B63CCAD3953D5AB4E1BC41DC463CD44198BD1DB1F4BCA85B33BC6DE5A3BC1AB80B3B1A041B3DF9D1433D7BD5743D01BD843BBBFC8D3D7F00563969F688BD4C8D73BDA8EF8E3B4476A0BDAAAD9E3C0E79C7BB2826F7BCE72B89BDB8AF37BCB5D898BDA7A7C7BCDAA1B1BD343F353D9B75D7BC723F833D06A555BDE1E5273D802B163A71ED27BDBBBF07BCE51F803D0A7101BD3CE8793DDDC462BDA27CF63C8180443D824516BD997E8DBC8A28B03D744BA5BD4F8A4CBC91ABA0BDE0C321BD2C91253C3FE3A5BDD14F1B3DFEF22CBD7B53553DE625AFBDCE6A063D597B8ABD8769D53C8C311A3D0C50423D474E223CA65B0DBDC8C67DBD0F0044BC84A5B5BCD61AAF3C5128973CA39416BD366AE4BA122C7CBD4070BF3CCE895ABCFA806A3DD33E8D3C8C3679BD81574F3DA61D5DBD01AE1A3D73E85A3C864BD3BCF1B901BD012CCFBCE97251BD030D913D83BDAC3DFDBC7E3CB9C319BD7A15163DFB853CBD6A75FE3C39BEB03CE162A03DFAAEEABC720C2DBD7DB34E3D1FFB9E3D8F3CBE3CF6EE20BD8448D63CA942983CDFFB15BD773C94BC0B15453D4D0B81BD85F3973DB2AE37BDA1556BBDC269A3BDD2583FBDAE30FD3CBC40B3BD5BB148BC882CF33C6CB9013ED65B823D4098723DD5D853BD2BF6803DB500CBBC7AB3A9BDC92725BC9555EC3C8027363C54C024BD0269EABC94FA61BBA439833D92DF793DDBF347BD07865E3B06ED803D1985C23B02DB74BDE7FCAB3C075C4EBD1C9B95BD29A99F3DF6E467BACB92373D1DA0FABC5DFFA6BDB3BF3D3DBC259FBB069223BC47F7A53C838295BD3783A1BAD887213D62FBE13A3ED29D3D97348FBDBFF491BDB42A2A3D74FD593D49578E3C666F42BC87738D3B5C05393C6A80F13C96E00DBDB2C662BC87FE903DB5EC6BBD3EEBA5BD63DD3EBDAD5022BDC3497BBD6DB9C03BCEE6043DD03784BD658B733CF66D37BB7520CD3C66CF95BDCAC58FBD04DCAEBC50F754BD74856BBDCEC396BDFEFFA8BC7341403DCDE11DBDCA50323DBAAD733C1F909EBDAED1133DA6946F3D4AE9883DDE1CD33C76E163BDCF92983D20FA973D6384993D827399BD597266BD046B0FBD0417A23BC97528BD45BC663DFB9671BD2A24E2BCCCECA4BCBE8D393B83EA6EBDBD7EAABD03317CBCAA70953DA53A15BD8203B53DF4CFF0383A1571BDA07BBDBC5F86EDBC794808BB29C2D23C0E69B53D418BA33DFB4E923D299085BD9149803D3FF858BD33307B3D0FFC0FBDC435683D6B9E8B3D6B02D63CAD2576BB603D62BDA180553DE434833D404BBD3AF3A91BBD3B9F903D9628CEBCBDCC3BBDD0D05B3CC78A65BDFADF3ABD8F4E9ABD9EBEDD3CD8E38DBB35099C3B40D5303DC0438F3DA592563D57703C3D77D5613D15558F3D56BF81BC29D7903DAC32483D422C52BD5E0485BD59C5503D011093BD697665BDF120DDBBACA8923CC259A13D3AE5603DD30B50BDD16C2ABD9C6F9FBDD2AC1F3DF8BC9ABDF04C9ABC54211FBC7317963C65DBAEBC3FC2953CC52FA8BCA66191BD4B92893D5ECC67BC948A23BDA49F9E3D1E9A823D5194533C103B79BD563F463DC368FC3CF6952D3D8D930C3CC2914E3CF7557D3D3454A73C055481BD61D988BC40C09D3DD084F2BB61859DBDBB8686BDB527B7BB0CDB52BCF95E11BD6FF49ABD0CCC1A3D89FB8E3D2105843DB1779EBD3E9054BDAB6208BD22EA5D3D27D87D3DBB3AFC3C637D6C3D05FBFF3C4EEA043DEDDBFB3CAEE1833AAAF6953D78CFF5BCCBDC18BD9F398CBD7FF026BC1585353CC43340BBF872063D329496BD6C0DA93D167D543D78864BBDD52E90BDC40721BDA6150C3D7AE95A3C2A07F43BC212A2BD23E5403CB18282BCEFD6763B1EA6883D34005D3C5B3D89BDE861413D487A893D7CB2813D4307403D65F1F6BC84E0A43D5FDBBBBCAAEC303D8B0FB1B9D2DCBF3C47950ABD4CDA8F3D3D61533C1C9C87BD6110ED3C176A7C3C10E1273D8A00F03CDDED7E3DD58F403DD8B3A23BB7581D3B453D37BD1C1549BD4227083D058BCB3C2360A23D4A9EF8BC263A863D43EE30BD16F62D3DAA4E75BC3FD2CA3CDCB552BC1BE9823D0031963D11D8A13D2B62B53B7A0587BD62F548BD94C0AEBCDF755FBD7782D1BB1F5A63BB1FB435BDD6FA593D1EE29A3C07EB0ABD45E5173C7B77BF3CB56F85BBB27853BD530E853D526C1EBD6BD58D3CC0F5F9BC7E6905BDBB5B9A3BF9E9003D24F985BD9CF0F03BC07292BD65C088BDF82952BD69446EBD800D6C3A8667903C466E8CBC9FE3A23DD42E95BDA73E883D1E31C3BCE64B2F3D6A879BBC257EE2BCA307B13C7D066EBD38F9BF3CF21768BD5A3C7D3CED677E3B2F848DBD41AA8C3D0AE08FBD73A6063D8ED89DBC8A26663DA5BAEFBC7D409B3DF93C5D3D82B9203D2A227CBCD585313D1E3A883CB9679A3DBDF628BDD3CE95BD8AD809BD996F83BD1F09A4BDBB7412BD87D783BDE331B43CA6533DBDBFFD9A3C5C48253D4672A13D088D913D5377833D5C9A5A3D33618CBDFD8485BD52889BBDBE884BBD1AC1A53D02961C3D8FEE363D1F3FC23C264C00BD77B71FBDB8F3AA3CCA8AF4BC4ED075BD50D42DBD8878863DF7B3A23DFE45103DD72D16BD3AF180BDAD3604BD454163BCACC76D3C4C18A33CFC66C4BC5F2994BD615352BBFF7D5CBD57FCD4BC19648B3D8886E03CBA7A293D49579F3DCA1690BD12C9DB3C279C18BA53434EBDBC3077BDC06BA23B24A587BDCD7B223D57940ABDA64101BCA0896BBC82DE683D1A26A5BDB0EA87BC7F63923DA2FC87BD8A760E3AB0449FBD850F82BC355F213D3BC12CBD8FE02DBB202D173D91ABB8BC3919183D083F3D3C048E75BD92CC6BBDDECA613D53B75E3DF510BCBCB2939CBC30CC823C435A8E3DB7A86B3C734555BD946DDABCB91E093D42BD47BD6CA16FBD7DA4B3BC3AA092BD69A67B3D000D523DD48E69BC741574BDF2CA20BDE127873D2BB851BC1CF49CBD1075B7BB2E69623DFEA4103DD4120E3D8F5B903D10CF9FBDAB0A923D128D523D6D37833DB7F4ABBC1A8F6A3DE829243C10BFC93B0EB89B3D8E6311BD1B5071BD7A9985BDC1B3503C8241063CA4639B3DF86607BD120006BC3984683C47096FBD0C72063D1C3F893D4EC92D3D52AABF3C8C7A8CBDAF4D8DBD1B72873D09793E3D2770A0BD22D94A3D5E3088BD2864583DB995BEBCF62BEE3CB597E23BE3989EBD486F63BD45364A3D6A90D83CB13D413DDBA5973B244D85BC0EB0073D736B863B84E72D3D9D7F9EBD84C0CB3C4EFCB3BCF64393BD8133DFBB54839F3D1E340E3C9AF397BB940262BD947425BDCE33713DE85F03BD52EBA33CED1F30BD6911683D273847BD7588A0BC0C088B3D4272363D3B44A33CFADA87BDC486063D3D879C3C7CF4A33D2D1C4CBD05F6963D20A17ABD5829023C948F873CDF1A3C3D5CAB75BDA27D19BB287097BCC01C95BAAF8374BC88553DBDB4529DBB764B623DD333203A60A067BCF80968BD4859A5BD3B5F1A3DA777643CDEDC873DD3F5583DC5E92BBD729496BD079D9B3D76B12C3D7A7814BD385A9D3C03E6B83C12D4E83C9320D03CDDB93EBD831780BC958E24BD936E8CBC700827BC98A9493C84138FBBF810CF3C330146BC18B5BE3C8FF14DBCBC0C38BD45D3273D1C1E8E3D17B20C3CC1212A3CF44B363D40332B3D5AE0EDBA7CBFEDBC48F66B3DEE9191BDEC40843D4B53983C6A245B3DA5FFA0BC2DF68BBD2A5F8EBD151D95BC011C13BDC6922C3DAE92CEBB981C513C730B2DBD56FDB23C067C823D466C7BBDF736A0BD195AA23DB70E9EBC8D5D913DD92720BCF02308BDBF64853D4C7287BD701661BD5BD1E63C6F7930BD3FAB29BD2FCB84BDB9F61BBCF2111BBD3578D9BCA090CE3CF00FB8BC5E17893DC2A27EBD68535FBB363C9ABD2492503C35403FBD0B81323DF8E2443DD7DD713D5A7DA1BD12FA8BBCE975803DE2EC963B164C5EBC8C16ABBC8034213D44E8F83C07AD83BDCF08E63CD2D5883BB63C57BDCB119EBC726C1BBD2FDD1CBDC614943D3F6A2A3DFAEF63BDB7490EBDD16B083D3FCD973DD385953DA658A43DF19FC2BC45AB2E3DEFA725BC795A683DACA98BBC5785DF3CC25F8EBD31B8223D633E69BDAF15F2BC44C1393D2CC36C3AC0244C3CEC2B663C4E55A93AE7628DBD9BF5573DC1D00EBDC864213C6147BBBC183F4D3C65AE97BD13D7303DECD499BD7D3103BD1C8F973DE9652CBD1A8D883B962C3CBDC8EE44BDF76684BC77A9A1BDDDD00CBD454EF03BD4ED903D74CA8D3DA19B85BD6FB2833DC3FFB9BAF10EA73D27F5E0BC174801BD38FDC93C4E2704BD980953BD27458DBDD2E4B33C28BD7FBD150A82BCB0CB31BD5DC09C3DAE959A3D7DC1803DFA061A3D576F32BDC2929BBDD1095A3DDA079B3C696B65BD024D563D1742E93C46D2A0BBAF76D13C7D6177BC22EF87BC8DDA11BD0538893D258C65BD5204FD3C1BB4883B8A0991BDF1F40D3D30A98CBC10462F3D31E0723D2AFDBC3C0D1A9E3D62910A3CEE7820BD959E35BD541485BD0F0DF23C9D536FBDB918743CC123A2BC61C69BBD271482BB3A4D24BD47A0413DC319863C9BED863CCF74ABBD1CEB343DAC8498BCF1C8013DED67933DFB380F3DF80428BDB50D023DE8D94E3DCD209DBB46E00DBDBB1A6A3DC02DE53C1CFD41BDC87693BDD8D9BC3CCB5D833D191491BD46384DBDAEC7303DF8829C3CB2C647BD3738F1BCBC3F9DBD3CD9D83CE301683DA2F533BDA28FA5BC6DEC3CBD60C505BC3730E5BC9D8C03BD1B0D573D038780BDEF14153CBF217CBB9E305A3DC365843D360BA53AA16BE6BC198270BD58638FBCB571E53B1857BD3C729916BD6B979A3D466A9A3DAD0AED3C54381EBDC26DB13C0FDAA0BDD65CB1BBBACFA2BD9A1909BDAD9289BD8A8BA73D2C718CBCC5A2323D56B3D0BB9A02B6BC78C30C3DED6669BD5AF7E83C12D794BD11BB6A3D75610A3D06934FBC3A6385BD7A128E3D14EA8CBDA31C403D0E8298BCFC6744BC92C49DBB1D758E3DDE2FA8BC73C6B73C06C39F3D55D6BDBB112BC53C1B0FE7BAE09A02BD34032EBD2A76643C851B81BDBFDD6E3D8D1E4F3C3224A33AC4965F3C3350203CC4F6013B257530BA6AA26E3D4DA1603C1EDC10BCB81C54BDB36A193CE3F0083D0DB179BD64AF843DE206AFBC7F7B2EBD839583BD51A47E3D8A9A4CBD122060BD296A80BDB77FAF3CC8F0443D51BBD1BBDA1060BD59130C3D7DB82D3D03FD9CBD1ACF0DBDCAA37BBC8B18F23C1213A13B1112593D6EBEA6BD349461BCAED8A3BD2C4EA63B7269743D417E8F3CC4E70D3D380788BD961182BC2931AABD7908403CCDAC863BC19C6CBDE94761BD9568AF3D0397F3BC85B375BDDDEA133DA851B0BC1CC0553DCDD9703D316550BD1ECAA83C9635A83D671E813DA49ED13C0631123D3D623C3D70898CBDE363983DA69C4FBDA8B6AEBDC87B183D7C3D8E3CC2E48D3DC62F923DA4FE0ABDABCA2EBB1A5263BD1A1C4EBDD7A55FBD75B568BDDA5742BC3B1C603C96A21B3D75F52B3D1F58093D24A5983DC5FC8EBC2663A53D477B983D2874453D14B8113D105802BD29BDF33C0316ACBC0B71E8BC7CCCD4BC8AD68DBCE68498BDEB3B2ABD162C6E3CE620553DA031D43C34E72F3DF097583DEFBF56BDCF0083BD053C0E3C6488843D0228D6BC2BA55F3D7404953D2AA1183C59A0263DF080613D7BC6A8BC54BD733DDCF32F3D7A9B5CBDEBAD0F3DA93ABEBB40B4ADBCCA6A193C708F263D063F983DB375953D187D87BDE995533D60A86EBDFE8572BDDA523DBD3F9F0C3D3C45603CD33A8ABDDA06F5BC25773C3D4EED8FBCE1F0533DF2E107BD62E3593C129E233DADD5A33D3666583D05CE3FBDA03333BD682494BD22463B3B3CE419BDD55299BD71DCC0BDCAC5C63B58AD9ABDEEFB3ABDBDC5083D609A88BDC4740EBCAA3C5ABDD089A0BD89D31D3DD076CB3CD96431BD639A74BDBE07913DC4813FBD5B23FABC908E233DF0DD2A3DF17C5CBDFD1B093DB7C1CC3CBBE490BD03B23BBD227D0EBC8B38413D03FAEC3C8A0FBBBBA826663D0A79AE3C16D147BD34129C3DF0B2583B09BA1CBD206762BC951EDABD0A4A22BD1B7108BDD721093C25BAD93C7F24803D8BB765BDF9078DBD4E37373D671F64BD691F2CBDBE5CA7BD99A8BFB9FED47F3DD60E46BDEFC142BDA00104BCA853033D692144BBA640963C289150BDE3FF123D992EC23B5D12813D30CE2B3DF87C733DDDF71EBD4B1346BDE0AC003D6363883D8DBAB0BC2516F83A355A083C474297BCECB08A3D62212DBD348C19BDD0CA593D896ED7B9D8F49FBD22A39FBD1828343DB4124D3D96B889BD0FD6CDBB7581373CB1DEC73CAC640F3D2213B53D6E1AAABD05BBC0BD35EBF93C1978EC3C2950953D7D0E913C5134D6BCB73D57BC13E6953BC7BE333D90D684BD6A299A3D8FE32D3DF5EF433D65B8033DABE2EDBC99D094BC29CF90BD7FAF1B3DCAC695BD5F4229BD6EBA0EBD55E13F3DB9B3793DD4BF76BC18DD893DF5D10CBDF3B93C3DE08198BCE226003DA112ADBCEA027EBC8E5BFC3C75DDCCBD8C16703D90AB563C2D3C263D38D4B93BF9B6E43CEBD48B3D164B78BD3BBC66BD28EB32BD92AF213DF2999C3D45C878BD25276EBC4A8D78BD226933BD884DF7BCE3AF473D6EE0983C8075CE3CF3BB3EBD07EA91BD99C8803D7D1CA23C14190D3D9EFD85BC58FB92BD090A993D1672AE3D29D6B0BD7E4CABBDBF169BBD4150803D12643BBD449909BDBE490D3CEE1F01BDCE1F853D628B8EBCF327343C5375C53C6EA7BDBDF29081BD7918423D3946BA3CD1D996BD738A26BE094F9FBDF33E043DF16F3CBDA173213DDD46A0BD7DDAAABCC2065EBD434C82BC7C81BABCEB2A95BC99E0C9BDE30D663D94A774BD6F066FBA8DE1603DBB77043C14EF41BCC2EEB0BC561C31BDE20C0F3D2D11D4BC2804243DDA3CC23BF087803CECFF8BBD520B29BD9C75A9BCF3D68B3CAF3535BD6F0723BCD06047BDAFB2693DAA139D3D8CBD36BD4C466BBD766B6CBCB1D5BE3D7DEA013EB602DA3CC9C2503B209EB2BC5B2833BDC1E1013D10518EBD4333B23D47049B3BB130FFBC53E68BBDBD6D92BDD167293DB1F06FBDADB39E3D6209FDBC5BEF71BDB62FFC3CE238BDBB9E0F64BDDD138BBD4F85D43C2ED99B3C0E58313D22204E3D082F92BDEB68B43C55CD8EBD6DCCFDBCB079D83A18B8A23D6237933D9A578F3B14474ABD5560EABD046086BDB5918FBDC61D4CBDB5976BBD89F01FBD1562113D171B8CBDEB144F3DB927633D9ADB7B3AA793703C540BCBBC9473CBBDFD5797BC2CE0853AAEB62C3C78FBB2BCE7CDBF3CEBA550BDBFA17B3D6456ABBBA591C5BD62C9BFBDB14C5D3D940054BB9FA561BDEF95BABD55B24F3DA8F8193DFAB30C3D6AF0323D76CE073D26CEB5BB6E97A23D979C8EBB9E13F73C7045653D69A88E3D1A95D43C0AFECB3C6042ADBD93AA893DE9A189BDD2199FBCF0C88A3DC70A15BD4AFAA83D2AFFDD3DA25ED9BDC00340BD186D58BD8E80BFBC94965A3D7CDD94BDBC61DABD5EEC2CBED7C4363DF114B1BC0353E93C071DE7BC6F5B82BD7B0B9D3D5DE24ABC3F9796BD31CA1D3D02EDA43A2BA3E5BC733E883D146BB2BD95D1A93BFE0058BDDC4FE0BCB8AF173A76C66FBC27A1A5BCACDE883C61F5C83C45B69EBD5705A03DD28F7BBDBA9BDCBDA676BABC0C604CBDFB96E53D42087B3DB4656B3D92A5573C137069BD108836BDC74F403D897055BC436126BC20E8803BEA9B5FBAD3D0B23CC25C8ABDDDFF503DD0E1423DF64A583D884E943D0920E9BBE6A9C93C85EF1A3C9E4E35BD0B8882BD4082E3BCDCA681BDD2A50F3DC4C854BDCB0F153DC15299BC4962703DAA8CF73CCAB1B5BD44AEAEBD874E433DFAAFA13D34666B3CF3D864BD045BA3BCBBC4CA3C6673423D8D451EBDBE6B58BD65A8DA3D338ECFBCADD3A6BD24C4F9BD874C3BBDD764B3BD9BF52BBB9F75283C31CD973DEE7E89BD3F27A7BDC29A5F3BF6469FBC4CB1EFBD3E7FE83DBDD97DBD7220253D2E3026BDA0584E3DD7CE4ABBD2EABCBDD3BA23BD12F8B8BC324F99BC0347F2BC932A403BC41C8D3CD9453D3D8412A6BD2F566DBDBA3DC2BD4FBFB33C0FAF663D2DF6DFBC3A2987BA8F0ACDBBC7FB57BDF2770B3D204D7CBDB3A7283D40C918BD45F5903D1FB4E33C034D4ABD43CB1CBB72F5A83DD96A9F3D1DE88BBC3FE3CD3D47CFE23BE8C8933CDC1F0FBDC3FE23BD22E8633D5981F0BBDC060CBD1A2D9EBD44464DBD16E013BDC61341BE431D90BDDD0F89BD09CF6FBD83108F3DB97A45BDCBC5393D7BBDB43DD73EB2BDEFFCFB3D8764A3BD5ED000BC225C46BD7BC84CBD36E6E13CBD4C67BD4A29583DACD94DBD312415BBE48922BCD6B7B63BB14911BCF60E5BBDB2B82D3D651F8EBD9BC3F5BDCA2F7CBD074E24BDCAD32A3E0CBC3F3D531C12BB174814BD6FCAAC3DB4B2E13C89158B3D5E2981BD6C339F3DB937183EAE94E63DFA0B5ABD1E8098BDC76C693BA480BF3AA44328BD809BE5BA60BA52BCDD447E3D4B12DB3DF48F3ABC02A5FA39EEE78F3DF67D41BD97DB7A3D843B9738ED7A9A3D5112863C5CAA7B3D736A68BC45A3B6BC0F6483BDBC01413D225C903D9149D73C67AF8C3D380CA2BD2C4345BD9A039A3DDAB7C43C67DB983CA515B03DA3AFDD3CF338B63C79DFA3BD434326BD80C932BE81802D3D49591F3DD8CC803D733769BDA97C4CBD73DAB23CE9F123BDCBB395BD23DE363DFC97213D2E59063D5F674DBD4F0D883D17E1383CF6E1C4BC8E83A9BDAC37A03C4DFC4ABD75D26B3C6F8DCEBDA71D803DB1C904BC53EA04BD9FED763D17D95DBCA3B784BC1D97D9BC8355B8BD16BD253BB15D79BD2CB79EBD774F063D2305133D063F07BDCD655F3B11C2763D1296B73D013A0E3D49A538BD3BC3923CCD1E7B3DEA112B3C61405BBC6228C63DC2CD1BBDE1801EBC86B5B9BC876C3DBDFB00503D85AF5D3DB99D45BDDAF515BC60CCF83A36B324BE898812BD22F5E73C7E92813D2103E6BC9BA0B1BDE6FDF739CDA0913D6CF2813DAFC9E9BCD785803C123EF23C40B0883BDA9C88BC7666E0B8EE79EA3CFD3CD4BDC571A4BD42E8CABCE03BAD3D8C45C9BB3524CB3D1FA0B9BDAF3DA13D2DB22B3D0151B8BD8EC2BD3A512A773D6384323E462BE2BCA785B13D9931843DA004803D3E2D2FBC333FAD3DC2A9CF3A64860EBCD12EDC3D5EC2813DB644CEBAE1C3B63D9FBCF33BBF1B3D3D9254A63DB838A6BDE8EB42BD08F6A83DD9D206BD858ADF3C122BD33B09D9D2BB2EA8543D3C4C313DF9AF013C95DE88BC5B8F723D3CEB1C3C0D3342BDC515803CEB1FFD3C1FC1E83CDAA5533CA8BB4B3C86DD0E3C27EFC1BD60FFB8BD77AF873D825342BD0796CB3D7FAA9D3BF94B453D3EF5BC3C481A523C6628F53C8AD029BE295D3EBDF68B48BC708ADFBC58EB8BBDEAF8A4BDEA21B53C3F37A6BDB6F6D1BDA5F94EBC0AAB60BDA07478BD4FFEC03DA9424ABDF206803DC4504FBCFE4E0C3C04EC22BD41C2003D03F496BC4A4ABEBDF037963BC76FA0BD4C82383D9DA0C23B0E5C0EBCD57BEB3B03C8AD3DF46D123DA959CABC22C8673D01B9A03B19278FBDD81191BDB47448BD199597BDDF9E163D42A28E3D202883BD35B716BE96F55E3DD0527F3C09115F3D971896BC1436423D9EF00A3C8DE9043DB6B1243D5B8C053D24E71FBDF7F71B3D9757333D1C87573D28D385BDBB0EDCBDBE5BBC3C2DDC8C3C2B0169BD59853B3C0B4A05BD80A3F83CBE4B583DC458ECBCA5C2C03DD748D73C5278C3BD9D9081BD48BAA9BD4BFF443C0E740C3D3E248F3BB0AC4BBDCF058D3D34698FBCB41F63BCC18DCC3A7FFA5DBD0FCBFC3CCC5197BDBB86D5BDEABE0D3D7086553C8675243EB9E611BD80FB51BD8F284EBCEB76383D2C6FC73C2491913DE0E2F13DF721F83C99DBEA3DFD92053E6AB04DBCAFD35ABA1A73A03CDB9783BD8B5E813DDDC4EF3C6EA4ACBD1001BFBC87C6A03C8C10A4BDB0D82F3C6B6CF1BC14DA78BD12EABDBAF8CE823D71B2913D757E853D0F5F6C3D03C365BC0B30133DDDAA50BD2CC1ADBD5D61303C4C8DD23CD2A535BD4F47203D57AEA4BD3E82B33DFE07BB3C3B99333DCEE4943D93D494BDAE684A3C5FBD62BDCB742F3D9CC126BD805E90BD09FDBCBDDECB3C3DAC37E43CDFC4983D665F673D089CD3BD799B70BD7EE42A3C1283AE3C953D013D651CF4BC35C2013D2222AFBDDC51C73C37EC97BD26CA383C7D4B87BC5862C03CDEA9D1BCEC88EE3C9C8F47BDA7C41F3B0B9043BCE369933D4E0FCBBDD616733D1FC1ACBDE3864FBD97AB2D3DE911FFBDBCBC053DAA379FBD135D07BDA95695BD37E29DBDE5AC323DBE207BBDE45ECB3CAABD723D6C8B323DF8EB27BD94271F3D65FA943DF994963D4D38BD3D908836BD7168F23A074356BD6F1429BCDDBB97BC5786E43D0BDCD6BC707186BDF4CAC4BCC466C5BD0264C73DFAC9963C2A5CC6BCF1F8553CFDAA27BC12D41A3D88ABEC3C75F7933DBB6793BDFD5DA0BD02E311BC058AFE3D35B919BDE0503EBD9975ABBD854085BC9FC28D3D016F2BBDB34E8D3DED8F6FBD430A3A3D46C9EB3B64D9A1BD71688D3D2A27213CE0A80E3E7A991F3CD3B6F7BC23AA7ABDB3BBE63D3CFC4DBDB367AF3CA4859B3D26CAA63D85D85A3D4544733DFD9D4FBD131A48BCB7B100BDD8447D3CEF40013D6B2D34BD8FA3583DB5D5CB3DE3B9EB3D7E8368BC132C553DE0AD953C127C28BDE56D00BDC76F8F3DCF654C3DF98C83BD32674F3D87A966BCFFA9013DAE16DBBDE2E996BDCE6F743C9E2DBDBCCEB8013ED6090C3CB6557B3CEFA067BB44D3C2BD9DCAC0BC137701BD6FB3BBBC58F43B3DC69465BD7D19BFBD807BFEBDF4359A3DB0E6B03B7D476ABD0FC1FE3C2BD3B73D0CBAADBC926B383C654B813D1C98B03DB2695DBD574629BDDDAA82BDA74D553CC18D72BD48DE01BCE23787BD1986033DC83270BC2C12363DBB170BBEC75C4EBCF3BB6ABCD17AC6BD3382AFBD0DA72D3D3EA4F73CD002853D95536ABD055B89BD7C8641BD04AD0ABEFAA7E23CBE90653C497BA9BDEA0C9F3C8B9639BDC8FE413D9752803DF6F60ABD80139FBD5236A43D7E62CF3C7ACD803CBA00DB3D46C2A63C4A3EF13B0F85053D1B57953D0BCD87BD81C8C1BDCA1061BD820DA63DBEED4FBD6FBB1EBD2642D9BD8D8A89BD4839A83DB83FBB3DF61F343DA4858B3D553637BD632CAF3D5D72B3BDEC9CF43CC2AFBBBDF001A2BCC383833D44801E3ED3235E3DC00C24BD49B3ADBDA39C47BDA06D9C3C0C84A6BD6B334BBB3938683D4BEDF63BB5DCC53CF86665BD6C64EF3D43AD843D02B1483D049E20BCFF86A2BDB6C99E3DC1BDC73C334923BD6C202A3D1F59B03D8BB4903DE4BEA93D75A0E13D7C45B4BD3DE32ABC4697303D9E6FA93D1DE03F3CD61088BD4DB660BD22F37B3D0885A0BCC9378E3B4D33D33DDDFA2D3DB068A5BDFD8EBD3C5C727DBD07D0B33D8D6684BDEE003BBC916A3C3D3A8B153D5EBB2ABD7BA2F53C497348BC4B55C23D745B1ABCA58905BC6685593DD2219CBB3CB5483CE7A1B63BD37C0CBDF2AF89BDCE019A3D078C96398ACB90BD70D319BE2323113D4F0D063D40522ABDAC68C63C5157B13D4229883DBBE6073DFD1B723D613934BD503433BB00D2A93DB44487BC1CD8ABBCA52B75BD1E7DA13C182D8B3D6A6EAC3D8F65B03D18A776BB0BBACCBD90BCC03D494417BC2C60EE3CFB7E8DBD0F85A53D19E89ABD40B4AB3C015C22BDF43C58BD93B8253D709099BC46F30D3BFFED12BDEE2AD13C7F458DBD81506EBDCDFA063E9D86983D6D21F9BDEE99B23D663276BC44B5F7BC1FBC2CBD58C5203C923457BCEF63A9BD73AAC03DD2D57FBD404AE2BCE38481BD37B684BC7F19073DC92E58BDD19326BE29D81ABD821F09BE1A09043D99ABDB3D295AF9BC19F7FD3D75EC8BBB83070CBC554C8BBDD28D683CEA7D13BE899F0FBEC98AA9BCD484563D0E0BE0BC799B8B3D01430C3DF3F6A6BDBFC5193D271F253D8D439BBCAF4F7ABD0FD4AE3D13E85CBD96990ABD31CF1A3E3DB7553DB657C63D2792FA3C2740CABC1FB2B3BD8A62A5BDFB9C13BE1F2DD8BD4E48F93DFCDDEF3D0220FEBC34E84E3DCC396DBDB2E8743C500255BD5DCD5B3C1D80443C881858BD556A98BCC273C13DE32DC93DA310FCBC2713573BE89C983DFB9C4C3D0B63F53C0462873DD776833DD16C433D1CAB783CA74904BD3F3289BD7BD4CDBCA0F782BDEC0E883D267BA33D421FD73DCF294FBC2461113B85A4543AFB0185BDF437003EA8D16D3C2607273B238B2F3D6CC9ED3B8C179DBB2B1E21BE487DC63CF4762ABDC415883DE6910D3CEDE099BC9431C5BC4E0AE4BC82E8E83A249E133CCE7D55BDDEAD953DE4506B3DAB52A23CA3DF613D5C34193E6A3AC6BC1E0E09BD630B573DCE42103DD0E7223C74A4FD3DA2D38A3D86F0413A8DBC06BE525CBE3DA0E8063DD15D0C3D3AC85CBD874853BC85BA94BD9151A9BDD90AAA3D55A999BC186B3EBDEF954CBCBCDFCF3CD9D4863B5311823C28BB26BD0660CA3D9664F9BC7FD7C5BD138D453D1AA1023B5243AD3C401DC33C1BC6A53CDAC06BBD31F241BC75884BBDC34D8EBC111C28BD8D0563BB5B5D06BE2576ACBD6C6080BD0D580FBD3886A13D5CCCD5BDB603303E9570593DE18C92BAE27091BACEC7ACBDD311DCBD5954D1BD81F77ABD39250FBD4338A83C14E1963D17ED0B3EAEA8393DF5C0263C41D43CBD06E3D1BD28B00CBDE14F6C3D25FC0A3DF7F9A93D676BA93D6F82433D38933F3B695CB7BA87DFE23B2844EA3D8632C3BD8AF01C3C3F8F65BD8D2906BC7CDB833C31FE8B3BCE8333BDAE4B80BDBD3EC93DD23ABABB191234BDA32F293D4F69273D1EB1C2BD1E2503BDB15505BC5719D63D373E31BDB87A86BD8E1E6C3CBA14843972F37A3B1E378A3D0D1E5C3C0BAC83BCC64ED7BC78C196BD230285BDB1D682BDA1A699BD5A949ABDFB9B093C5938C4BC588005BDF94D1F3D59C246BDEBE3C43DF7184B3DBDFC273C30BC833CF76E66BD60CAACBD223D9E3A6C408A3C6D45EC3B03E07E3D51C23ABD4A81D5BCFE4C463D498A383DD5F63CBD9E62F8BC0B3C19BDCEE5AF3D1AA9DC3BCA5A7BBD32F35F3CC2A34A3D537F4A3D321FA5BC81B3C2BD3B36E3BD1876893C84D65B3A684993BD22EE9C3D3B10C43CD3AFB13DF097843C536417BDE723783CEBDEED3CDA0D08BCBE20B43DACB9813DD33745BD32AAD7BB0B07A0BB6E207CBC3CD53BBD2D9D5BBC58C11BBD2C4728BD4A0E163D5F761CBE1722F73CEE53B8BD7AC5F03D1F28743D9B0A6CBD7E50D23C174332BD86FED3BC783386BD815997BDA48A183D517291BD6FED653C6006B0B8E8CBC2BCA54638BDB2AD4EBD0868C33D04898D3D7F7E6DBD79BAD4BC0F6691BDC0A7DBBDA8AB473DE5828FBD8F0CCA3CD84AEA3A6ACD283EA1710B3E6FC1A03D76D2EE3D723D943C9A2096BDB5630B3D00198D3D773DA2BCA8977B3CA348373D720BF2BCBCC590BD028137BD4F53A83D44CD223E31C4D73C31298C3D1953453DEE9DD83D29C7F33DDA63D6BD2AFC9F3C7377CB3DA1BE6C3DD912823D52F43A3D30D8D0BCE46F3B3DF20CA2BD26B6583C79C523BD1243453DF14AADBC9CB30FBE4AD7ED3DF9B0B4BD4E3213BD686125BC746E8C3C4120C4BDE393673DA9D7803DA2C5F3BDD53FC4BCA1C9DBBC298369BD3BA54BBDB2FD433DCCB6C9BC6059123D3F0FDF3B6149113DDBC55A3D0F9DE13CB1BD303C9A8F923DDB2431BBA170E7BD9429D6BC61C065BD10D9563DE0D52E3D13B14F3DE12BD6BB94E6A43DAD33BF3C2C57D53C5345BDBDBC14A83D7FABFF3CABAF643BB2A3FD3C3560CD3D69E7BC3DD8E938BD027FFCBC801A5CBDB58BDC398BDDC93D301FF23BACF5963CA89792BD53EF8E3DC3B264BCECE5D5BCE16B1A3D80C1AABC25287ABB2AB044BD11AC5E3C17C91ABDF554B53D8867273C8CA0163EFFC72DBCA4C22F3D260FA43C00970BBE14993B3D93F5C6BDBDD3173C090450BB7292943C0634A93D9C5DE43CB979533C5924383DA7CBCA3B8583B63CB8120FBD7397F8BC1090ACBCE4662BBDD6D761BC0C8EDE3D8F6A8E3C2ADA3EBB18FA5B3CD792A5BD5B749DBDDC4191BD15AC85BCD9DFB4BD660E4BBDC7B186BC2D3FA0BD6C17743DCDB8953DA8D9A83DA6F502BD118384BCD15E833C7E5D30BDB01B02BD16F5A0BD797B143D7DA0023D427B32BD296FCC3D55BDA43DD2638BBD40D5EBBC2DE4F23DC327783DD7DAE3BCB2EEC63DB689BC3D9C8B273DE71AE9BC6D15923DD84102BDB02154BD4AC1B03D4A93AFBC95446ABC39C089BDB2510DBEBB7DE0BCAEDBEABB266F6B3B533F323CB9E38CBD21B6E73D87BF8EBDC69D383D6EECA63D87B01B3B0F8AADBDC0AE013DD682013D83F464BD447B74BDE37AAB3C833762BDDB5E8CBC4E1A8D3CE822F6BD6C6E15BD637876BC8B84FABAF98B2C3EDF34CF3CEB5EC9BB3EF7453D49870E3D4E05DEBC177F5BBDC57C09BD059B373D65CCA1BD0EC2AEBDC443A3BD0182AD3BEE77483DA078163EDB8FD1BD1F76773CBE22813DB816B4BC5ADA5F3D90ACE33DC949823D3ADA2DBDFD628BBDF44B14BCF7832A3D13A9CDBB9FB949BD3A24443A0652943D1A00D13D3910A63D1492A83CE5A450BDCE48A1BDE9A7AD3BA59DA0BDD066A73D809100BDD8E172BD88CCB1BB5A4A1A3E33A7493CB59171BDBC7DDCBD24F4A3BD9E262E3D346918BDDA5028BDEC38973D7059D73D6625603D860BDB3BF721B53D4881B33DBC57A6BD6952E9BD084F473DB1D6543D09236A3B581735BD0D8C42BD4C426C3CC698193D5B681FBD7A2840BD75D084BD7A02D0BD92EC0E3DEC072F3DEE9B27BD2908C3BD8B0BBC3CC81C46BCBF2660BC2803BBBD94B8B0BC3E2D83BD2CBB3A3DFDF5F53B848B68BCF2678FBD5BC62DBCE10D7DBCE1A1A8BCDFB2E9BC2F1EF1BCE48EB13DEA9EB8BD41CF333DF6624EBDBBA5633DC55A813C99B4023C73A1553DD7840F3D52C424BDE3EBC63CC4365D3D04ED85BC6967983D185BA03DE95516BD3D575DBD91B948BD534400BDF609D83DA59A573DAC96A2BD90C930BD626CC43D7606123DD3D7813C6F78593AF6688B3BE02BA2BD9FCFC93C7C91823DE025B93D6817763DAEE62BBDA5E21DBD673948BDEED4773D9F5397BDCD1395BDD8616CBDC3957BBB0C78C33DEDCE983D9B911C3CF013DABC6695063DD2F283BD91CA28BC2ED875BD716ABA3B3EF3C9BB75F7A5BD978B803B19A01D3E71FFE83C19F2853DC98CC8BD27E1CC3DB2598CB919ACFDBC88927E39BC6FD73CDDA0A63D782B463DF2C183BD3CB5A5BB75063EBD96C4C23D5151D5BBA1A1ED3C9E56143C1DCC8C3D8B569DBC5815E23D6C35803DCB0A7E3C0D2F10BC907E01BEA0F5343B8B540BBDC7B109BDA5C2B8BBFC10053EA3B8E13C60E9C0BC7449963BC61067BCE609A93D890FEA3DD9E051BC7B54143E08C1103E56F518BC9356063CDB57C1BCB9D96D3DF9BAACBDCC460DBEEA0E023D153B55BD7352B03C6C2CD13C9F84A7BD31FEDABCC3729E3D8AB9FABC8D12C9BCA9AA3BBD8D3281BB7DECCBBB8F9C813C69E926BD27AF353DA1CE81BC0969C8BC00D4A6BDC872033B24EDD0BC9FC27B399279013D1D49D43CA17289BD95A53A3DF7D8A0BD8CD63ABDA9BBB5BC4F6B60BD33880CBDF4C1723B6F0767BDF812F93B7C086CBB246DF23D2EB963BDC253A13C82CA953DEFD156BD9771C13CEF9CA2BCB5A05E3D85FB6C3D9FB6113CE513443DC4A506BD6043A83CAC85D8BDAC3640BD9512C6BCAE69AFBB12B8523C18A7C4BBDBFC8E3DB17653BD32F4A33C01FB953C80CA293DE6DA1DBC3B52BDBC5B66123CEBCF653D307649BD19E6C33DD98387BD9B888E3C468EB53D1A399BBD741C47BD7EBAB5BDCA72713D2DD0093EB10127BCE0C5FFBCA3EC7DBCCB5F913D8AA4F23B89087C3D7B88B4BDF9FEAB3B414C48BDFA3F04BC2FFD063D8A2BEE3D2D6E013D2B73463C9673EABD0CC5B13DECB4043EDCF0E7BC3D41A43DD7382ABC7E591DBC930A89BD948E15BD5ADD92BB656B73BD63EE4CBDF2B999BDB1A95A3D421FA33CDE6E693D7C1D813D1D64223D1EAEA33CF1202DBD77062EBD0ED1EDBD032D453C8B97513DE3B76F3DA1AB783DE13B15BD7A3B09BC953DD2BC6299F43C0402A7BC6C95F53C26CB4C3CB61338BD5B4B963D16E46B3DE725033EC684513D2F24643DE4E16C3D2995EEBCA82096BD106A293CC5F8F93C78F2E4BC1DC069BC8DABDA3C06620ABC75DBA33D4D22303D48C8D5BDF99B9FBCB8984D3D21D6D1BCF6CED23CA217A2BD2D94243DB25BC6BC923B333DCFADED3CE5E973BDCC2852BD7A00713DB8A21EBD74E8723D3547623C99423DBD9FFFB13D94051CBD677260BCCF3D1F3D0537043DA74C07BDD9BB30BDF1D7603D8256853D5D2D9D3B88F0B73B946CE33C1B5970BD461B523DFD6AFC3B33DC9DBC5BB1C9BD9EF9D5BCBBEA32BD0AEE8DBDE281CDBC41B56DBDF1446A3DE7EF6A3D9523443D6BFB9CBCA23D05BDA801B13C33A147BDFD0BAD3D725B87BC42E1C53C0B933D3D3786AF3DB5834BBAFE9E7BBDC5D5D4BC2EEA4BBD3072FEBCC95BA8BCA7044BBC09C205BC610286BBFD960BBD8B1868BDEB4DA73D93CDD33CD697CE3C30449D3C717D7F3B5EE0953D318D85BB2CF529BC1A7D013C65FF00BDA769EBBCB8D3CB3D484017BD8A1A403D6871A13D4546AD3DE038B4BC902F98BCADC7D23D210AA03CB78775BD3994943D873578BDDA9E86BD3C9657BD8C52873D431C893C110BE33B894D94BDFE64BBBC75B1AB3DE08DB7BD1950C63C436E46BDA1B46CBCDFAF793CD18259BC7F6994BDEC071A3D6089313D56DB1FBDFD572B3DD847B4BD4DA3D7BD8B030D3D015CFABC482C92BD43B3263DC17C163E860E9D3D235023BCB7DB0A3EA2B0D33D2F508F3B8DC19E3C06450B3CB20181BD0FA0413C8743643D233AD13C302DB6BD00217039D40B70BDCE6135BC47730A3D3D5A893BAA5BD43C9EEB243D1886BABD09FC5BBD4FE38ABD4AC9213D7D65AD3DCB7AB0BD2DE985BDB54193BDC6E7863D566E063D4D4592BDC992343DD677033D1A48F7BA99702A3DA3F0013D640E6F3CB0FFC4BC9F725BBDA906613D1CD5F43CCEFEAA3D523F2CBD2E22E23B4C620CBC61E75CBDF1CE0DBD57D2CCBC7E5BCCBD3878263C18A6093D909C283CFFF1EFBDD74FFF3BD41944BD76806A3DD2570D3D3F42A33D2D6CE13CA766ECBCB96ABD3C20E94DBD6232513CA08FA5BDFC18A4BC6452DBBC4293C4BC53DF423C422F10BD44AB6DBD2FBC583DBEAECBBDDF7700BDECC1833DD87417BB78B66E3D25F289BDF26CF2BC662980BD905A4ABD9C10903CA648D13CEE8E8ABD9A205F3DD7B1DDBBE0CEC13D4EA18BBC6850063D4CDB313CCA9F073DB2A687BDB729913D3EDB1FBDD0EE5A3DBD1A803D3685B03D60A3083D500A443C8B2A473C74130ABDBB8F153D9539AD3DA0E9B2BD6856C2BCF273D73C65F1B83D50E36DBD0E647BBD2F7FDD3C58BE8D3D05D239BD4607B3BD1B64103D1FB36EBD20C0DCBC7B8FA13DF99AB8BD72262EBCAED9C13C585A2B3D51F436BD113F32BDBF0B44BC75D9C0BD25E914BD5E4ACABD956D793C62782FBD95A04E3DA46B513D4DFA83BD68CAE53AC8E8873D7B0321BC740B27BD29194EBDF3852E3DC7545CBDA60E873CC9B8E23D18ABD43C00CFB43DB23C713D4D180CBCF44DB23D375852394ED70ABD8C3A393D692DCABD4FA9523DD756DD3C4CAE0E3B79DE143DD2C511BD54BE18BD8D422CBD10659CBD5DF106BD13CC7F3DA89089BD2A30CEBD4176113DA0D5B23C53E98BBD34D554BC871AE8BD0C5400BEAD99103CF1438F3DBDF388BC0B908ABDDF898EBCE3F0C33D8CBC2ABDA7A67DBCD13D38BD990F62BCD338B23D528420BD11109A3D69F6FFBD129EB6BD44A6A6BD526893BDDDF14B3B3AEA813DC125813BDAB8313DCEDF133D91ADE73BB648AFBAF52CD63AB296503D9BB951BD576E5A3C1548EA3CDB27A13DA0A8BFBB27ADCEBCC5069A3C153664BCBDD7993C7DF47D3D6AD0A7BD7085B8BDA4ED76BDD3571D3D66A33A3D2D38C93D72D04B3DC2DA7BBD902C833D7589A9BD99A0BC3DEE52DDBC4D9D443DDA7CCEBD79CE81BC4C94C33CC27A913D2B4F10BD1BB6CABD802085BD9B82443D0ED9A8BD95AAE8BD7F3D6CBC959EF0BCE53E0CBD982D933C216D4EBD9AFB5FBD88FCAF3C93B509BD5CF98A3CB1D49EBDBBFB283C470F673DED063D3D1371D53B0E1439BBD37F8CBCE3C025BD918E47BD337CB0BCB8759EBD81ED463D5E9EB33C48BD1B3DF4D231BDEF11473DC1D6F4BCC54D313DE086F7BDF13D923DE5E0BC3D225FC23D9F2335BC1FACB03CC5353C3C08F3813D9EF09BBD4A37CBBD4BF08C3C1CFC4EBD3E519E3CAB67543DCF3F503DF8D78DBD5B4AF03C70DB33BD34D0023CAD46973DE386573D333C6CBC333F38BCA661BD3C04C4773DA71421BC36EC493C4084743CA637DDBD36B1EDBDBAA75B3C65CB603CF6A7203B5332A6BDD8B05BBD18CCF7BC8CD41BBDE1D3443DD5C453BCA7E18BBDE813E0BD643AE3BDBCFC5A3BD4C0023DAFFB9D3DE6FF7D3CE33A59BDD0FB4A3DC01B41BCF061D3BC403AA23C274354BD36033E3DED88CD3D1AC6CABC1425AFBD09CBAFBD620AB5BDE97A48BD0B461BBD0CD1673CC9A33F3C1B08923D4FC8043C0DD476BD13067B3D3087383D80F4B5BD48BD283DA86D7DBDC32390BDB13DAB3DCC44593DDE2113BD2B59573DE9ADA53D2B5473BD6825253C9CDB773CB54A893C9AE88EBD47ED16BD6AB15E3C351EACBCE7D8CEBBDE329ABDF76DA8BDCDE9E5BC00DDF2BC73BFB6BDD0AF863D5DC10FBD411BCB3C37473E3C6F3C443D8C47EDBCB9713C3D231E2D3C33C5C8BC1D7F86BDB9285FBDB7269F3BC8E6B83B5459133DDD2423BDCB7ECFBDA520553C5CBB8FBDEB09603D6C809D3D9EEB363D03A684BC3AEE7DBD5641813DC89F163D0D93AE3A3DBC96BDCCCB8B3D2FCE60BC96456D3BC6C811BE1E425BBD114933BD6D55613D0F92A73D03734EBDE389773DC56FFB3BC8A90FBEC3B0AC3DAE374FBD8222053E520646BCAA6885BD35F19E3D4D15023D90EE25BB2E5BA0BD1E5F893AF4F4A8BDE629BB3DF32C173D5C05943DBFDF29BD45CC19BD85E833BD18DBD3BC0B10AA3D4EC0673D17350BBE448B54BDA77CB3BD2CE48F3D1E64313DB988C4BD8061813D3F95EC3BD9CE01BEA0BBC7BC4B22083C252150BD8B8179BDF227CEBD9FD1C5BCC8A920BC63FBA9BD122A413DFF9E31BC8536EFBD7ED3DCBB1467B33C10AD1F3D1942D23D20781CBC9AEF53BD2EB868BBF55E453CFC2FEFBD48C384BD2A891F3DB4706BBC8D99093DFA1DF23C2953C2BDDAF4C1BDC63098BDD1AF403D4817A3BCFB8C803DAF63FD3C836772BD16EC1BBAC874113DE9B906BDDA7866BD9DA3FF3B7B87EE3BFAB1563C4EF5B33CD11443BDC7C95DBDA04DBFBCBEBF103DF709BC3CF0D0773D86383CBD157FA9BC5EEE7CBD0303AD3B472FF83CAD7089BD7C7C0FBC673FBA3C514C993C181ACFBDFC7CA8BC7B1E99BC49ADECBC959247BC0499FDBBB276813D452B373D8CB265BD8CFB433DF05DABBDAE8B363BE1E2A53DCBAEC7BDC76DC0BD24FE5C3DDBA10A3D24A3E83CB32A49BCB3C82FBD4B896E3D15091A3D8602E03D9B83383CEA5A693DE8FC86BC32C1C2BC28263ABD3780673D736422BD8688FF3C67B2F3BC636BE43B6F6CA4BD037782BD806B643D13FA56BD9C9CB2BD661583BD1740A33C277D65BC40A16F3D9A179FBB0033A83DA24A9E3A4834B73A38F2203D743201BD9627FC3B65DAAF3D353B9ABBDEAE8EBDAF0CB4BD521389BDCE2334BD4F3DACBDF2635B3DC46BD1B90DFCBA38F09FBCBB7E1F8EBDCB8898BDE934FE3C49F5FDBD1B7FDBBCF63B2ABD4499823D1E789EBD94C07F3D6113AC3A52CFD7BC7F4A4DBD9E52043C62CEA5BDE468B93CC74CD63A586013BDE3B2D7BD903CCDBC1E68483D8253013D4A59B1BC8706B5BD96E313BD6884FB3BD744163C8CD6453CDA0073BC232D52BDECA03D3DE82924BD0DD9DBBD8D14ED3AE5EC27BD4715473C08B9043D5F2CB33D9C51993C748C883D25EE51BDDEB2B33D5842B7BC5126743D39E3CABC3E1F09BDEB3C86BDFFBBBABDD3EC403B5B5E6A3D561174BD64D8973D731557BC664A2ABDC51B703D67B0853D627A3CBD29A8963C4626ACBD61020BBD8E14703A3B51E43B872851BDE656C8BD9B046A3D84D186BD64EAC03DFE441C3DA38386BDE3FC72BC632CA2BCEDB1BFBC7F3D82BC3E3621BD9CFD90BC895D4DBDABF8703DCA2042BD40B6A13D812C2CBDBFE6A23D2F6A48BDA841993C1093973B4D9B883DEBF791BC7D3588BD89B4C83DFF4C043D3091B13DE9D8853D881363BDE5121F3DAEACA13C174466BB72B112BD0639933DCF8AB83CA9AA0EBD156A21BD945C833D4CA84B3DD3D7A9BDC6578CBC5961963C04554D3D0495833D2BDE78BBF9B94F3CED6B56BC71B887BC12B03CBB4A5DF93C442633BC6EB09ABD0C38D0BBBBD6A4BDE2BB4F3DCFCD24BDCC34FE3C1851443D0F1EADBDD5B0A53D9D11883D0A377ABC73B9D1BB9EA35ABB3076E93C0E3CCF3C7EEE833DA419893DAE9E49BD7CB234BDB6F4813D12C4AC3C0D57233D61C4303A9B06B7BC6BE5913D55BB5F3DACC67CBC0D56573D0BFD8C3CA02E2D3DA5DAD63C60C191BD8C12AD3C7C8E5B3D7C12153C71907BBD957FC83B13D799BCD8BC75BD0B3682BC0837A33DF99F23BD64896FBD06D347BD3B5BD8BC108828BD73D88FBD045055BD333E6DBD58EC993CA65FC93C84F2D83C40CFA5BA0EF98FBDD67315BD493786BC0A185F3D9672853D750E753B7AEA3BBD4F1C68BDB0A3003D522D1B3D54E82D3DAAF6623D4EB4E93A8E9156BDF245AC3CE442E23CF6C6CC3AA9FEB23D55CB153DA8E3623DE107DF3CC22335BD2103863DE0FF56BD4B2396BD5F8B243D30A0793DB2B2223DFE5F0B3D068B45BDA70291BD9D24173D9BD5FF3BA35B2BBD2FDD23BDC4DF88BD18D19CBD5DAB68BDE2726C3C127B11BD9382ACBDD65E9E3C55BCA33D2799C1BC6FE60E3D420374BDF20F57BD0124A73D1FC46C3C3EC54DBCECC38EBDACB48BBDB08847BD01758ABD806F35BD34242EBCAA293CBD734662BD36E830BDD7454A3DA94F493CC4C0DA3BF0003A3C9FAA43BD9622003D6C850E3D8EA8E4BCC19AF83CC276713D26159CBD74682D3D6237263DC4ED33BD1A7F953D910E433CE847D23CD64A9C3D11A014BB00655D3DA8D04D3C33B878BB8F752DBD35A3323D24D950BD5EC8A83D5988233D361DABBCCF66893DF49FC43C15178ABD933CB73C720FEB3BFDF667BD87521CBC04BB0D3B607887BD779697BD2FF3FE3C869C97BDC6670D3C8D428DBD891E82BDC2D90DBCEE78B1BCD548D9BC078289BD94B587BC1508833D8F634D3DBE6E22BD81048ABDFABE4C3DF640123DD513EA3CEAD3BB3C342397BD73CB953DFAD6983C679F9B3D8369EE3CD97FDE3CF3BCF93C5D0760BC61674FBD5D01FCBB638D01BD2891363D52B511BD799F87BD19FA26BDEF527BBCE5AD4D3C2F2DE4BC507900BDA3E3F7BCCC0D9ABD9996ACBDE15F663C69FE34BCADCB903D7F7F133CE9AA4BBD59CD1EBD0CE7713C93E5F4BB947225BD1856933DA994833DC72A19BDC0CA32BD6EA8B73C7072073D622F25BDD47C68BD6BE7E23A65134F3C7887EC3C907AD13C829E413DD949E4BA3560DC3CF6B4963D6AF664BD33755DBDE3E12C3DE456953DE0CD6B3DCB9806BCCF4D593DD95A333D8B852C3D01779DBDC451C1BBC059553D571572BD0F5F85BD72BB0F3D5976CCBC7153C8BC1BA8A63B1B18863D2B954BBB31E312BC00213B3B059401BD43AA9CBDFE09543CBC488F3D1F117BBD2312B63CBECD6E3D8D007BBD385C283D050586BD960791BC700F44BD2F82113DDB55683D25BFF3BBF5CE38BDCB3A4B3D3EA36EBD55EDF3BC5F22423D167B853D489949BC3F34E7BCF27746BDA866A3BC1501103DE661613DBA083C3D7D5476BD53FB72BD07A8393D18F2823D215ED83B224C843BE9AB93BDC9B27FBC2228A8BD2DBC143CB7DC0B3D0E93853D3AACD23B6262CA3CAB8A963D23BD923D56F6833D8C9C363D3DA19CBB524B47BDB9799FBD764F1A3CFD5091BD1D1D35BC7F981FBDD66414BD2EA206BDD677A13DC8B8243DF9298CBD36399C3D0337FCBC2C84D43CD4C3633D37BCF43CA814423D6DF48DBD80BE1FBD355885BCDF340F3DDB460B3D3119E6BCF420A5BCCB6A27BD210631BD7D2859BDE54907BD9C9C35BB218EACBBEEFD5C3D7BF8003CAB799BBDFE0749BC8B91523DE96034BD159BA43DA907A0BDCF20A7BD34C38FBD9F3806BDD9073D3A43B11C3D3B8C763DD7D97ABD4BB0F2BCD4BF603B5E1F7EBCD4D0E7BC6D3F7EBD8D9F86BDBEF813BD0EFC8EBC5625463CF6B58B3C110596BC8DAF613D7FDF44BDAD3E783C4A3BF83CA556043DC1422C3D7BD18D3D339B9F3CBE452D3D5129E4BB9BEE8CBDC1A2763D084B9DBD7BC5003D13DA9E3D676BEEBCDEAE19BCAD8B9F3D84EB3A3D84608A3C97EA2ABD55383EBD4C60A63D8A841FBC927A6ABD2980BA3C844D00BC0774353D331A7B3DC129CBBC613B13BC6FDC873D46499F3D958F4A3DDB90053D420EE93CCF06733DC7B7633D57439EBCC6FD833DD0CC77BDCAE5913D13689B3DFE119CBC25F188BCE63023BD2B68013A6AFE383CF9968CBD34130FBC1E6671BC7135853D482936BD12F98B3D947C883D81D0AE3C82422DBD6FE616BD66DF2FBDE1B36D3D57E18D3C79715A3DCA7D753DA9CC943C15A78E3DE352243DFFC7463DBA123FBCB169B33C933456BD0E8EBBBCF0420EBD65597ABD30D4953C980C653DA4D9993D6D5D8B3DB3BBFBBCA6F7883CFD85DC3C2DAA853DEE5A48BD398602BD6079FBBB2723BABC0753973D66E762BDC8A36BBCBCCA6C3DCA5292BD7A5E5139BC1840BD8EB304BD16F905BDCA1264BDCF72FCBB92A904BD651D8B3AE8B68F3BC65F75BCBB2A9B3DEEEF763C5EBA0EBCEF5AC2BCA488953D1A03ECBBD272EC3CF2B792BB4A6C18BB9F8D863C7970473DEE42B73CF1CE993DBB40FDBC2763413CDF0F1FBDED397ABD663A233D732F43BD675A8D3DB60D6FBD7EE34CBD57D4ADBC9C49DE3CF2FB3D3DD1AE8B3DC191173DDC989C3D508B91BC5FDBE73CF5F7943D5ECF113C120D83BCBB6F453DFCE723BD1D8246BD11A8DEBC7D26053C3F00393DA40DE8BCE2C7A13CCD76163AAFAFC23C1AB9E7BCD1B3443D6767613D9175023D326AE4BC000DA33BA5697D3DEBD25B3D2DC4A43DE6D3503D3ED2443D48A89DBD10D25FBDD2E86D3CBE0A603D63E441BC902DABBC9208353D4D2604BDBD52A13D587BB33C4D1E913DA3A03DBD2EA4903DA4010F3D85237DBCEDB871BDFDF14BBD486190BC6FCAA13D196295BD00CD9CBC80BA143D5A859FBDF5B7813D5C80A73C6A226F3D82B9523CF58481BDAED3983DE48C493D19555FBD952A8FBDAB76A3BDCE1CD6BC94658E3CC1B58A3D4ABD253D780F3ABD3EE4D9BCAAE193BDD05BA13DECFC7A3D6CD5D239BF53ACBC058297BD98908B3DA5F3A23D176459BC215502BB592D77BD7D93A23DC0B3D1BB5EF5733DE1BA5ABD807FADBAEDF3953C0A4071BDB5B9EB3C004CEDBBE8A8D43CC1FE47BA8F9A33BD368B48BDD67913BC01B8A4BC534983BCB8F6843DD5C39CBC72D64F3DAC013BBC90559EBD96150F3C45FF82BD64BD913D6E5A643D8AD8033D34F0CDBB10BF9DBD22EB8FBD146F2FBC84CF56BD66B324BD3B0437BD3832063D9263CEBCDC5FB83C987F8DBC932921BCF4CC3FBD269522BD1075143C040C51BDCE303A3D80A9DABA70302C3C61A69ABD9BED6E3DD3366CBC00B358BDD7E48E3D857346BD0039383AEF7E3B3D5D1B3F3D69E651BD43E9373C3253593D61B9933D36B5263D5E66D7BC28EE60BD4F38E13CC54F91BC5F38C7BBD21A313B95B78BBCA412B23CC032C4BC62E4A3BD5DB580BD0037413DA79D103D8893253DA973DB3A45E8913D265C4DBDDB8E5F3DF80226BB217152BD500C353D8071943D17E1A7BC54F132BD1A270C3DFDECCABC00259FBCCC9266BD3BA41C3DD313DA3C54481E3DB41D7DBDA5379ABC1BB26A3D1C99033DDEEE8BBD77EA53BDE09989BC5D43F63C8213803D5F9695BD46BD3C3DCD4BAE3C436805BCBC65A5BD15394CBD5462FCBBDD0B333DB75355BC806AC83C413B213C5ED4473DE07D863D4D5E5D3D13880FBD137A743DDE8A033D044D4F3D59EB203D71BF05BD8484F5BC5E3DA3BC15A8F6BB2D7F02BB693D033DB334503D9EBB6DBD2FF90A3D0B692D3D7D64A53DD532933DBC335A3DE1ED58BC61F856BD786E973D5D4C8C3C904C923D809339BD8225773D783D9FBD297A36BDAD4852BDD31EE2BC0404293C9AC4823D6E7362BD3467083D7D4C88BDF63B75BD8544953DE4DC08BD4D6B4F3DCC9C70BD79F82E3C9CC6D3BACB89953DCA31F2BCC0AF873DDBDF9A3D4428943D9F7F943CA4DA19BA1009843C9D31523DBB24FF3BAF5CD5BC1976BC3C199B753DD78ED93C0122FCBC658F2A3C25078BB91245573D2984223D268F87BCA2B7DCBC5246463DC40F153DBCE697BD0CB55D3C0885FCBCF4A89EBD0F7A5FBDB9253C3D1CDF8CBDF3B836BD1C387C3B39B3593CF0DFC53CDF9D963D8FB46CBD5AFC583CF3DC5E3D8A3070BD0623A1BDE13272BD3354813D5107673D27D494BC49E6433D171F4B3D0A25A1BDF007A83DD944F9BC49D0393DB8ACEA3CEBC695BDD96D59BDCCAC663C381577BD4307AABD5DD254BDC0B501BB977F8C3DB6F85E3DB164CB3C07B0843D820B793D456A96BC4F0314BDCC4A5CBCCB231EBD455857BDAAC303BD5E2D193D986C323D8B3E84BD4A524C3DCEDA2B3D548C05BA536129BDD130833C3E2742BD5F26EDBC2EE6A2BD776CBB3C02028B3D540C1FBDB8248D3D1B73913DDF1989BDB1ED98BDF0D679BC4001A5BD94C82E3DC625A43B228FA5BCBD73ECBB06B6213D5FAB37BCAC31E9BC7A925ABD764E5DBD072B86BDC34294BDCBA39CBC6234C8BA3F0B3ABDC2B694BD610412BD2D25A0BC49AE883DF4013A3D50C9A8BD8BECA0BA96BD113D1549A2BC314B1D3D4842573DF4179C3D2C603CBD3242673DFFB487BD9A1975BD3E0E983C84938C3DFD5839BD9F2080BCD81790BDE1338EBC08BC8C3DCCFBC93A3F9E9BBDB455F0BC927B443DE0CA9CBC52C00F3DD9D672BCC888E53CAA7A4BBD772E67BD64899EBCC1D0A4BD5008BC3CD0D12B3D582986BC3320A5BD25B85ABC2484853C5A3B2D3D6931D8BC8B228CBC8CD979BCAEF398BDA9C5C63C00FE43BD08CE1A3D510E493DE26C2EBCBDF4A93C25DC683D06D73B3DADFA7F3B06B9913D90EA68BDB24A043D9C1B093D6EA6893D1256C8BBCF1D4B3D5F4E98BD127A9B3D47C381BB263EAA3DB11298BDD8AE923DED5FB3BC74B538BDE2B8A43C4F33303D32399DBDB745133DD68355BDB661923D58715FBDBD9964BCEC3625BD5AF50A3DF1B0FBBC9AA7533DCC1273BD4C57303DBDECC63C557365BDB2C380BD785CD33C03A56CBCC618663D53AD743D23417CBD22153EBDCC0AB2BDC17949BDB0C58FBDC16A903D187952BDFB84B13D2036963CBAC8473DAB50BABC445795BD2BBAFBBC92DB9A3D347E80BDE2BF5ABDDDD592BD66496EBC12A54D3CEE5B063D390523BD57C85CBD57CA76BD0C1572BD9A7865B9BE21843D363D9BBDF943053DAFAA353D58A89A3D9DB9D43A17996B3B37F3143D2DF113BDF83180BD995961BDD6CC883B5B43D53C33535A3D235594BCA11DBA3C66036EBC896250BD5AB8FB3CE2AA9ABC629C853DD69853BD0570D73C0FD1A43D44771B3D40D9233C6A9A59BD41EA9C3DF0A63F3D3A687C3DD61103BDDB1BECBB92619EBD08E882BD2132C33CE2B9A3BC0A9B91BD71D45A3D74B515BD397BCFBCAC8587BC11EBF13CA07D803DD07CAFBCD18786BCE2F13B3D7F17E3BC54E0C1BCE53AA93B9BEF023DDC08A23CFEF07E3D1780A7BC90F4BB3CACC0853CB62E073D15B2843DAD151EBD4540CD3C29A0903D198111BDB5DDA0BD969524BD02AF0E3DBF3A9B3D4530483C30954D3C9537A53CFA1897BDD3D2343C3651343C2E865ABC89FF6BBCFF0F31BD974B8EBDB7758EBD5A28EB3C707F3C3DECB5803C4B2F9D3D0698E4BBDF1B86BC093E07BCB72C8DBBA69A823C08DAE53928833BBDCC40113D67399EBDCBB1B03DAF4E85BDC444413D21239A3D6F7E44BCA13F5BBC48B03DBC2C64DE3C8BC7AA3CED55693D3B5738BCBD8A273D6E7BA73DECC92E3D2C6C973C61FD92BD7795A63C59D083BDD7CC463DD778FB3B2199F73BC8B2D1B90A0C08BDB20694BD3F1AA43D5B02533DDECCB4BC30F4A2BA1E15893D270337BDF30DF0BDD426AB3D6BD7C03C3BE9D33C14A394BA68BA18BD0E201B3C621FA03DE8DE453CA096963DB2A765BD54708B3C55B42D3D913193BB8BD0103D6C751C3C8B6737BD4BA0013DD31BDFBC823FF1BC374711BDD6F1BEBB8B630E3B58D0F33C6775A63A15811B3DD4EE903CD40E54BCF098273D057853BC14999CBD4F21303DA275323D57AD0E3D73613A3CCE0A79BDACE7C73C5B5A9B3DB55DFDBB6C31A83B12DEC0BC9D1179BCDFE4CB3BAFFC183B1355433D7323AB3B927D67BCCF29A1BD10EE9C3D60305C3DEFCBDEBB653A04BDCBB46DBDA869453C3F8556BC01F9403D2144FA3BC808493D8141B2BAB1901EBD6BA230BDD37A4B3D883021BD2803473D907E5B3D01E58FBD426C90BA6CB9F1BB62C3693D90CC803B693A9DBD2BAA35BD1DE87FBDEBB016BDB023CFBC21F96FBD4EBDB53CD7B0B1BDC13C39BDDB66ACBCFBEFE73C5085DCBCB993B8BCE8BCA0BC9D9A2E3CCBB0EABB132349BBDBF652BD402AC2BC955687BD00C15ABD8DAD553CBD7A633D78E291BD4B29A2BB325B3D3D8AF9123DC305B7BCE9BA65BC5C7C16BB99F83BBD833AD03C0A7910BD7694A8BC9F28863D9B8AB2BDEFEF563DEA1892BD3E84543C1C578D3D0926043D0C7E83BC87C55BBD2C721239CCD107BD58A7193DF50DE43B7647353D1C7CBABB3A5CC03C8DA0AD3CE759543D948A443DFB06EBBCF7214E3D9FB9B6BD1A6EA1BD8916B6BDB42ADFBD0DB1823C551B73BD55301CBC46DB3E3C26CCAFBD9D845CBD555F3E3D3E9DACBD4F467D3DF4B01DBC0EC370BDF2D1423DE5C2423D409F3ABD208557BCF615553BE24DD5BDAA5A99BC4018A63D214B143D564B44BD27453B3DE5735BBC417D733D6E2938BD68016C3DB4A91CBD46A3873D12EE413DC665803D78584B3D9E541E3D85BE2D3DC8E511BBC157853D0FAB933BCBA633BD2740BD3DEB45A33D2F0642BD9D9977BDB28C80BC47AA803DA8B834BC22A356BD64BFE0BC8BE6B63CD70AA03DBA6DB63CC9D968BDAEE15F3DECBF713C7B2E6F3D7EB68A3D4BF22CBDE9239F3B0A75B4BBBCE88CBCD10A7BBDD39D59BD3A9285BCB9B5CEBB464F093D78B45DBDB35352BC84AA1B3D6189ABBC97913D3D9B9C2B3DBB8DABBD4912373DE610073DB5CCCCBD865BD6BD490F803D882B613CDEFADFBC405527BC6AA643BD15F719BDC72E37BD2E1CF23C4718863A4A7F413CF40C0F3B71DF863D01218A3DFC12A93C23DDDC3C6AF4ADBDA20D58BD3F483D3DEE226B3D23A9BDBC8EEA89BD8E5A4A3D5A9173BDB916CCBD1150A9BBC42FA13D7DEBEC3CB00396BDCE0D2D3D879A033D934FD9BD6D3624BDCA28C3BBEDC5363B0EC1203DA3ACE33C0C81AE3CF9C959BD7BA84FBDEED9AF3C882424BDB997C53DE629A4BC2346913B81CE9A3A127B1EBCD761C6BC6D740F3D91B041BDCF9791BDADA6083D4ED5CFBBC1F04DBCD376C8BD2320CD3C8044B7BD3325973DEC1B0E3C4D8883BD4025083BE4652F3D5414B2BD37D97B3D524C363D952A31BD69B0723C803F7CBC37AE7EBC6DA8A7BD2C91C6BD7D02B5BD348019BDF80418BD319384BD0F87BFBCD8FD623D6ADAF93C76C987BD7A8A91BDF67FC5BC6E38533DC236283E569D153D252D53BDD3CBAF3DE23EAB3DA14AC33C79559DBD7CFBCCBC72DB88BD07EAA4B9D2715B3DC773BD3C195ADBBC047E0C3D9D10AEBD70930FBDC0BAEABC770D2BBDE83FB83DD5D9C23B4E4E9ABD7FB882BDC4709F3D41AA9CBDA0948ABDD85A4ABC6911D73D697C5FBB55088DBD244104BD23139B3CC4BD1B3DCC266EBDC841B8BC16DD4FBD4E92F73CCF568FBBA72D88BB13C4833D49F24DBD58AAB53D908C153CF2C27B3CF7850B3DC684C2BDCF11C9BDF93142BDB951C6BB10265C3D3EBF10BDDC0950BD28DD803C82AB6C3D82BB85BC314CDFBC18B556BCAD956DBDB4DF893C54C844BD0AD792BDD6292ABDBED029BDAA401ABDC6D8083D4AC695BC24FD25BD7E1A8BBD2A81DF3CE1DFBA384ABB143D0BC9C8BABFA61B3D9D01C23C48CB153B72294EBD7BF4703DF9F16EBD8EFAC03C780D603C626190BDFF2394BCA5F091BD01297D3DD07F7DBC44F5C13D79F9BBBD5F7B683D61216B3DF581D53DB33308BD0EBB86BC12D2D0BCCA6799BD97018CBDD095963D4DAE583DA6BA883D56106EBC49260A3D3E7DFDBCDFA2A0BD9C14393DE6DCF23B49BD8ABD6FF08BBC2309313D2C56B8BC566A92BA9F114A3D3C46C93DCB3510BD9C7CC4BD5EFF8CBD0E724E3D2470BA3DE30C00BD2259D3BDA6CFB83C8AC83D3D75B8463D28D493BC32D733BD90C653BDBCBCC53D003090BDDAAABEBDAC004A3C7A978A3DA792A73D1EF01DBDF1ADB23DA17BD6BBD87AC43DFE0E803D4524FCBBB61088BDA40F8DBD8667703DE7B6A43D3D21D23BBB5481BD163460BBB3E599BD6D9EF4BC16407CBD12EF1E3D2AAE373D6A12FD3CED8D5C3D4F07193D8811D93C34361DBBC5AE893C753B78BDC6B95BBC1FE16FBDF9358BBD095ACABA2995AD3CE110BEBDC0D68EBDE39A2F3C831CC43D80F2843C28301E3D6A38243D423A463DA0A099BDB6E1803DA879F0BC4B11E83AB56A50BDD08B0EBE6289D5BD21FAE2BCC04669BD8D84B3BC3BAF203D0D979E3CF486303DE984553D2C88483CA45F093C035BB53D525C05BB2C9078BDEF4B2EBD095F863CFE64953C531A39BD85724D3C69BCD33CD861483DD1534B3D6FB4ACBD0C6C2ABDA8D6343D7639843C390468BD6F4016BD3358BFBDD830C83DE85ECF3C196E233DCA6956BCE02FB2BD773D063DEB9397BD4F03953DE8F593BD1FCD86BD7287013ED86F3F3C141F46BDF8414DBC55C1A4BCA449803C773E863DF663093B2D86403D3C97EC3C4CA4303DB1D0F23BD4E017BD3389F53C085E3FBD65A6A23D216098BD037B10BDB6A33B3D01BDD4BCF3B2753D6A16D83DB2AD1CBD100ACC3CC8AD0C3D55407BBDE9CCF13DD69A923DF40CE8BD50E825BC3A639FBB2550053D97E8A43D4E40D9BA4F376EBDF68E2EBDACB73EBD35C123BB2EC4033C561D8EBD7561DC3CDA4D92BD397D79BD86F1563C1E7565BC9706DE3CACE6D83D7933BB3C8FF843BD4EC232BD5F2E9DBD447D663D5A5E60BD12A84F3D90011E3E42A9BD3D885763BDF12EF33BD51B82BD52C9CE3C43C6843CD29A5B3C1FC0D43CCA88953C5A25E93B85722EBD8F403B3D8C8F08BD2F82A2BDC8CA88BD23BAA93DB9FABE3D399E72BCC556FF3C5526BB3D10B7843D04DED6BC8F444BBC0A83BA3CD01E58BD51DB333CA9D800BDFB01F0BB0A658DBC51A37FBDF8292FBDFA80183D14F4CFBC6818F6BAD3BEF0BD94A5973C608886BDD84E5EBD4B60813CC5C64BBDD6A96F3D8ACD843D8F237CBBD333D13B1A81A2BBB59629BD1882A63DF64E2EBDA776DC3C82ED23BDEF407BBB03C9563DCBF4463DA78BE5BC85F72E3D343E5A3D7A50DDBD8A4E85BC420A3A3D25BA643D6C31C0BDE85392BD71FD8B3CFF1A493D962865BD4526883CB94332BD63F650BD37A2693D07064BBDAD77BEBC17B92A3C21B88EBD865C3DBCF5384A3D6213B73C5922463CD3A7C73C3648F4BCCFCDBB3D492C743DE47FCF3B49492EBD789489BBFC876B3C8D332FBD8FC8CDBD1BDA26BDED1E9D3D465589BC36EA70BD2E65953CD8A2213D33F782BBB594053D2D95AE3C33E978BD32738CBD75720ABD81782FBD883D8EBC1490053C818380BC6BB6CBBC8F46BA3D5DDFFD3CE4A4A1BD239D333D8F5EEEBC955F12BD0E4F693C3EA7CA3CF8AC8BBDEA058DBDC9800F3D796AF3BB605F683DDF27D03CB241163E3C9F5CBD8990A6BD511410BD2A26AC3DB63785BDB27FB83C14D62E3D19F981BD84E54F3DD4A4513DC3688CBC89ED433D778CC4BC5C7115BD34F6FCBCE4003B3D968F6FBD9798873D4773C03D2F9802BDBDFE783DDD1BEE3D980F6EBD9E80823DF697923D333FDA3D0748243D4A893ABD7EC530BDA954483A38B736BDEC129CBDE02B2F3D1DA9AD3DEEACAE3DDB0A72BDD800A3BC13A635BDF91525BB9AFF83BCA86612BDCAC65E3DC4CC90BC294AA93C5281BABDC93E27BCAA11F4BC326E2C3CB03C44BD6A29CC3B30A1C73C7BE98D3D5F9A113D065AA03D2004D3BC65D449BCC86571BC173C4B3DC64796BC8763D2BB85E8F03CAD94F1B89F66B23DA9EB34BC47FE02BB8EC0A7BD62E2ACBC626A95BD3A2402BD1632B9BD395F803C44065B3C15E8B4BBFB2A9C3C1F7D7EBDA250DC3CB2C5A43C5EBCE4BC3D93303C2D7778BD5021343C9CB39438BC2CC33D6865993D23CB95BDB98DE43CFC83C4BC87E1EABC1024493C72E41ABD25C780BDB6DB613DD68945BCE6D998BD7603EDBC011FA8BDE3B20FBD22F6393D7608A5BDA38159BDB399A23DA41980BC1CE0593D7725C93DB118053D0F7542BD845782BDD1676F3D4D6813BD72F77A3DDBB5E3BBBE84A3BD97EB6C3DD09C083E4D6CEFBC81FFB9BD38AEC5BD0FEF843D550580BD6BCB9B3C3AF2FF3BB5F9D83C8D00483D5588173DC8284FBC5F19DD3C0E2F343C02C32D3EA8A8E6BC4E2E8DBD46513BBD2064BABBB53601BEF647653D0097723D34BF233D066E0B3E856A813D26BA09BDD251213DDA6938BDBE5440BD3E4E9E3CFCED913DC915633D2F829B3D33A5483DA8B6CBBD33AD233D3932B63DEEC7CABB9385F1BCC28E6EBDAB43053EC51EC33CC7F9D23D19F7BE3DABEE353D12D6E83CDA01AFBD36B7A03DB842B2BCD4A8213D1D46173C41AD4FBDEC82A43DB1418C3D1E41A4BC3F144E3D4C2E253DDD3322BBA5927CBCADF890BDC41B133B51FC8C3BD73C83BC035B97BD84960E3C342B7E3DD947463D0DAF77BBE0F3A13D9D069D3D7D0447BD1AF5C43A03D986BCFD74BDBCA3E9A4BD8BC88F3CD514183DB12A31BD7D858A3D1CB7D83C4990C2BDBBE2E83C568400BD27DE4EBCB680FFBD179625BDE19853BC49BD5B3DE8AC93BDD10E1A3D9BC7FDBC1A255FBD1D81953D4821B43C1508983C9084D4BB3100BDBA467508BB992A74BC6239B5BDADCB1D3DFCCEA83D256A483CD8A0913C8BDF0FBD27C9CABDDFADBE3C0B47A43BB01C2EBD9954973DFFB8C03C71CE723DD4BF973D5E59D4BD9CE208BEF61E78BC694ECFBDB35CD03D15B57F3DAE0C3ABD1751513A7E9390BD9459DFBBCDAEF23CD44E08B9150510BECEDA99BD31E5923D93F0133DCF919D3D2D4730BC63C0513D81D1073BC9252CBDC59D0E3DEBBC9EBD0359DBBCAFFE033E7B37D93CEE72DD3D2A8DEF3D1C0E67BC7F78363E3CFBE23B70EC0BBDC817E7BC73C7B93CED7029BE31FC41BD3EA06A3C74668B3D461BE6BC4630003ECBF073BDE86FDA3D945B1EBD7AE551BDB2428FBA4665E7BC40D2213B4E96573D55D962BB1B14863C47D3B53D41E6CD3D08FC5ABD2EFB1F3B2677AE3D137C243DBDC370BD4A0CDD3D48E9643C8AF7D93CBF61C73C5E20EDBCD7CD413C0506BB3D609EFE3C13A6D03C68A82CBD7B0D843D90EC0BBD2350DC3D096A333C8970433DE398BE3DA46451BB7830ACBD01F320BD632AA33D75EA16BD7063463DB9FD88BCA22D0F3D420A073D43303A3C49EA07BDE10CB5BB801C81BD11516EBCA20AC6BDD5F803BDAC691ABC0138CB3D4D826D3DDE7C16BDC30BDB3DD04FA73C2C76E9B8F492183E7E6812BD94089FBC459109BE1A5852BCAA7E0FBD8A71DF3D70B6B63D7032943AAB69EB3BF84791BC119C08BD36095E3DD33880BD095C2B3D30D107BEEAB9A03D14F4C33DC5F231BB3229FA3DA43D2D3D98F539BD3299413CABFC0C3D2177813BD78512BD21BA993DFC4BB3BD56FEDD3B3F296BBD74512A3C788919BD0F5B4BBDCC1CAABC9ECA13BDA7E0E9BD9265AA3DA625913D170CCDBA4309FE3D96FF44BD093F903DEA1BE0BD36D443BC6BE30ABDFCF198BD64A4893DB18594BD6B78253D9CC7223C053C943DDE18EC3B894C5E3D904B1CBD90C533BC6E7586BC0F61B13D7CD04F3D0C5C813DFC1D5C3DCF20833DE00BC2BC0D21143DB61CB13C3BCBFB3B573D9ABC80D60EBE3237933D1443F83D701D65BD12B1B9BB06BDE3BC25EF2CBD0C8B223D1EADEFBBEC405D3D107050BD878B613DFF70FB3C27F64C3B5BE5E83CF1A406BD5776243DD464B3BBD9AA783B74D4A0BD139456BCCA1F883C1D1791BDC7CD82BDD82233BD998259BD57CB543D8C066B3DCC2FD7BCA4BB953BB0D9AC3D0B80F6BC6A00FA3C28B19EBAACE98A3CBB652A3DC6499FBD4D6FA33C413F7F3DDF34653D0041F0BD8A18FE3CCE6B7C3D4E9F073DCEF3053D7A47B5BB4B79C8BC380433BD0CDE983C03730BBD371A6F3D1F248F3D0C0440BCAA96BBBCA471B1BDE574133B30F9BB3DCA87333D3C831C3CE26BA33C9A80863B89B28CBD9806843DB256AB3C975616BD5A760C3CCDDDBC3DA0B0343DD1B9CC3D02D3943DD53563BDB371A13DE495253D9F4D283DA48A2FBD9B5F01BEF532D8BCEDCE023C604FCEBCAED2C53DC02617BD0BF1683D60782CBB6F5326BBCFB3943A01F2E1BDF8A2A03D657A40BD324FBC3D10994EBDF55F1F3DA3BE563C5933883C837A8A3CA96D59BD1F6C73BDFCB5C2BC045B4CBD4BBE83BC49BE0EBD27F6E1BD275DDF3DA19CB4BC784BB93D8AB3D2BDE2E1D03CA81FA8BD2B486EBC49ECBEBD5F5793BD941E403DC0C5093D6A19863D53DF253CC52C983DEBEF1DBC0027FEBD6A95673D2E6E023D4905793D5A94B33DA253C33DEF8C89BC2F2A413D3734FCBC08261A3DD126A23D6DF015BD069D89BD90EF9A3D714FF43D6EF1B33D0B76393D2784C73CDDCF363C9E92943CE9A5023E9BD4063D35CF253DE076063D892438BDFEBFB0BD2275F73D43A7ACBCB8A437BCB46C19BCFE17F53B354456BDB656AF3D865F8DBB002FE4BB10B1393D98272BBDFC51DDBC0977DFBDAFB9C5BC8B14ABBCCCED79BD8DCBD13CB0E19A3DBBFF42BDD7EAD8BC4608ACBC7F19973DE6D7F8BC60EA2BBD5E0442BD43CA4B3DC7DCE639958006BDBB3816BCA593133C3445483D621E243D118E6D3D657756BA41BCF1BC5DC7AD3D3A51A63DE9691F3DB698803BC416E4BD514FA8BD82923F3D6E4B633DB90F203E2ECD193DC3F7BABDB938DABDAAC2EE3DF6CFDC3DBB0A29BCB60F1D3CA8BA073BCF6E863CF4A60C3D61BBB7BC04F71ABC510B36BD7B61A2BDCD00EA3D6378733DBCF53FBD5CFF33BC80D13F3D20EE9D3D20C8B03B3133483C4D02053DA89F263D21C9C1BCEFFCEFBD09D6083D00F8893C774C5EBC36B7A9BDF73A923D8A0499BB7B9FCC3CA26DB43D00982EBD7480A7BDEAFA28BD41BFF1BD52F34E3D0AA41E3DF0A04D3D49BE7ABCEC04B9BD7D659F3D792D943B43FB63BDF829AEBD2BC289BD99070CBC0A918ABD232DD4BDB077EF3CEC1428BD1466173E82A00E3E1342AABCB25CD83D0D380BBDA5BDC7BD4E753C3D4C70C9BABCD54B3DD3C8473CF7B62D3DF241C03D22AC8DBC27D584BDF15958BDFEE48E3DBCDF773D4B3203BD3927513DD948A43D9DF4B13D5476133D0E06523CAA71143CCB9EB43B3377A13D10CD493BC5FB163D82E279BDB395473DAA76CCBD26D78B3D4E66933D3895703C8905A23C4326A33D7353A83BC21AA5BD71E0923D7DC21FBD0223DDBD3C1989BD50E701BDF396523D887BAD3D1332943CEC0D8D3CF5C486BD4FCE0D3BF80EC1BD7B72833B79430B3DCF07003D0CF9F23D2B3C993DAF86AE3C6B733D3D3D58B43D082ABFBC122251BD506E933D18CF193E5A6E843C55393D3DCC4906BE620F763DF503DABCD371EE3B1846DDBC417E5A3DF02FD73CDD632B3DDA2533BCE613DD3D4D7E113EDB3184BD88FEF6BD64E261BC35E2103E3710C43D9BAD31BDC6769F3D6AD945BC33A58A3C010049BDEC44E73DE48020BD873F173DA508603DFD2EBD3D2F0684BDA34FAEBCE3E73EBC4599A73D1AA03F3DCCDC643C24E2B8BBF224873C4C4F5BBD9BFD9D3D454797BD36CA8E3BAF22263D7750AF3D26FA623CBE2E3FBD86F61F3A243742BD006098BC362F923BC4633F3BDF04F6BC68A09EBD29131F3DECC42ABC00EAC03D8B7E44BDCDE2BCBD90BAF53DD57182BD8A02963C9B19A23CFC86D2BDDAB198BDD553FA3C9F77E8BD539F02BEE349A63CF308DEBA16552FBD5F6B6BBDF5BE313D7CF3BDBB578BD7BCCF1E9DBD111E64BDF3261FBDAF5D31BCB1E6973D646988BD2F780BBD2B1AC9BD9511A93D4ED9F5BC3C56933BC99F85BD9A5D243D8F7EBC3CDE43053D529CA6BDCA93103D5C32D03DCF8681BD9121763DAC7EAE3C4ACE343D3E9E94BD3149ABBDECEE72BD348A9E3DF469823C756BD0BB33A2AB3CD378B03D37CF70BBCA0661BD7AFCA03DCD8B683C523AA6BD737052BDD83EA53D743878BC04E92CBC1064A3BD3394E8BDE40316BD528E883DE94DBEBD4E6E8ABD06237DBDB3DF16BDE688993D57423C3DADF604BD87BC97BC0871D23DE2FB4A3D23F5E0BC7727BF3CE6BBD43DDE8669B9E9AA953C5D6A0BBEF87F5A3DE2AD5CBD4451123E2868AC3D2535453D6734803D5F42B23DCAB6553D07F29B3DC42AF93DFFCA913DB85F153C844AAA3CD49DAD3DEC7FBA3D9FB2E5BC5543AF3D20C0E93C7C3C08BD860353BCAF89CB3D89111EBDEA316EBD5B96953BF6C36A3D0E5530BC0F128D3C792B9ABC2A2FF13B764B383D8012E6BDD3949ABDECDACCBDD31EB2BC5885713C6F959E3D6DCEA33DCCA4033EBDBFDB3CB83AA33D50582CBDE183A23A4A7A513DE495263D321CCB3C8E3F05BCE573973D463483BD900411BDE0A38BBD0757313DB70293BCC1582EBD5363C43CACD718BD33B629BBF12460BD03FE1BBD2823DDBCC57DE8BB4A28503D7EC523BD668648BDB235343DD2D57E39556BAE3C283A9F3CE71315BC412A24BD2AE9713D89B5543CE941BFBC6F822EBD8059293D890C713D50B54A3D70DA90BDCFE4F73CF3AF913D3FB03E3E0D779CBDD3A0F43CF62A863D6C1038BDDF31323D497A053E119B933D1728013DF868B03D7C6A15BD2C1C18BC42C235BDEACDCB3B7EE5C63C82C5B13D36B36A3D26CC2CBDDD0CCF3C3EC0773DEA7879BD2E4FA63B2ACEC33CDA79393DB0C6CABB79962F3DAA948BBCD5DFD73D50C70E3B1E438BBC19ADFCBDF9B4533DD8797B3D4D8F273D1012B0BD0F779FBD5A810FBD164D5DBB94A9AF3D8BA39F3C875065BA1ED1003DAF473BBDF36DAEBC9851B2BD8A802ABDF164E63B6E1604BD4D0F04BE942EE7BB359F783D065F9F3D6BBA01BD4F2684BC7F13F03DE8C5B03DE5DDD03C59E8C0BBB9024C3C708705BCAF00CFBC27EC213DCF9594BD204DF23A5AFB51BDDE3FA8BC5C9D883D89E684BDBEB501BD7DCC50BA6075C2BCB0A7003CB15DB23D999135BC2DA83CBC0C0CA9BD9EB6383B33A3AA3D7DF970BC26955BBD66C839BC9F2B883CDF13B3BDEE13B4BC4D65D13DBB5F913D9CB4CB3D0ABE083ECCE41CBD8CB1C93D5F9688BD0CD464BB84C605BD29B0D73CE940163D441B76BD381B90BCC16B173D16EFC83AA3BFF23C60C6053D3CE7BABC6C83C13C0EBC91BDDD989DBD7381AE3CEB3D4B3D1D3821BDD1FD9DBDC8509ABBE98D19BDF96535BD534DDA3B8693F4BC62DE243D91125EBDE450F3BC6F7CF1BCC013033D9278EA3C84EB81BD156C1B3D6C42793DDB92673CA07D473BEB42B4BC0FA688BD8063853B1744C43D937379BB5D3D073D3DC92C3D2C5A92BD14A8B33B7019B0B946F8E33C326791BD98F9E9BCBF4918BD995A90BDEB880EBD9E4872BC07A6373D90330BBC7312B6BC60169ABD9637EDBC1643FB3BD3B75EBD38FA79BDB9B51E3D2627BBBBB4A046BDA2C9863BE4A06D3D190C443CDBED2ABDBF6310BD919FA4BBFB0D54BDB2786C3C1497923D7932D83CF8D952BD8ECE6BBC10F0C2BA244C42BD02937B3C72F4333DC98CC93DD7CC26BC75DA6B3DA372A73A0C4F64BDFB7090BDDD8F87BDB9240FBE1B6A0EBD92E18C3D7292883D41C55EBD4E3EFEBC1DA0F83D2A8743BD031687BD2573773D84E64FBDA9A3E83CAC3EC73A8E21013CDE374ABDFB9BE5BCEA2A803D87440FBD28355A3C694475BD21AD8A3D10FEF2BCA12CF4BC5B1F403D2E53333D4EE97CBDC58B36BD96EAAD3C8D89FC3CA18A8F3DDB1171BDFF7204BD61364BBDE6B28F3D815290BDD461AF3DE54D4A3D7C9A61BDB2807C3D0429903DE4768A3C92976D3D4045C4BDD732393D0808A0BDF021B6BDEEE3BE3D712165BD3488F0BC3AB8493D25EE51BDFDA2923D0B69F138BA5D0BBDBB58AEBD83C8E73C540938BA54BC29BD129464BD6880183DE51B393D7EDD323D17C6943DFF981E3D22380EBDA4AD81BD566A45BD41A670BD330B1B3D9EF7A43C41AC85BD4A6F36BD472AF9BC2DC4BFBD31B1E13C32E28BBBA80FD33D2D273C3D007886BD2B946C3DE774BA3C391E2CBBE4DB583D5360AC3C9887A1BDD8738CBD22C5693D46738FBA283831BD0A75A2BC2873123D079773BD5231953DE0F9C53CCE9D04BDE3126D3D5764B63D7273A0BCB8C59D3D80FFACBC3F337A3DA2CBA1BD4957653D0A2F713B0418473D25FA23BD41305C3D40F7FBBC0AC8963D8A5E83BC4E2B72BDDA3438BD5CD7C9BCB7C4B83C475E3BBD34AE1C3D3261CE3DFD64743D913179BC0A770DBD995E993D750E993D424F1E3D7124C33A9F9522BD5AD447BD9D0D9DBD623E703DCD1FFABC9164C03CC457533DB45F9E3DDA2DB0BDD06FA53C60567B3D1ECD77BCAD200B3D88C1933C649C823D8045013D29FFACBDFC20003D3D09A8BDA2064DBD7464273C34A366BD0C57733D3DA60ABD10AEA9BD90FCC43DD188153B51E779BD48CE7C3DA6A748BCEC54CA3D1044313D92BE373C4FB7BE3D74CA593D519373BCB81D90BB4BE809BC3E1C2A3D62E1A13C44528D3D7F96123BC2F3503D4C41A23C934F773DFBBDAB3D8B199DBDE22356BD8F63153DF55BBF3CD684A63D358E493DCC168DBD2022E03D9E3385BCB6E15ABC75021EBDE452743DB542493D27EA7EBD64EA493DAF2C023D3CF6113D52F8A8BD1B5145BDD3352A3D0A32453D745EB2BB757E543D7E01F2BC1E130FBDA380493D7440783D88A258BD1B4C97BC065B713D2F12EE3C8ED7F1BC31AA003DC020CE3CC615DB3DE5C0923D435A833D8E5A833D8CD4CA3DA690D0BD4D326CBB781191BD516F7CBDB78007BD2BECDA3DCA178CBD707F73BD33C687BBBA439DBD35A119BDF08FCABC9FE7733D382E643D6A39233D7E5094BCDE3DAEBD21485CBBAF10BABD525A02BD0BAF76BD4473933D52AC763DB5DF8A3D45A97FBDB3F6AABCC44A8ABCFF21D43D5429AD3C2077A0BCD03C0FBD0E09143DEC5579B8978A963D3FCCB1BDDB10883DFABA71BC1E8A3B3D120D133DB5EF59BCDB2F3C3DF23F1EBD8752B23D0B2DFABDA363ADBD7E90483C3D4145BD9D534CBD44D63B3D15C794BBE591153D5D57823CD5E53A3D1DAD9B3D957E6BBDA9B3853DFFC09FBCED6495BCBECE06BDF0E474BD12D9A13C9704BA3B6C68CDBDFB388A3D6AC87B3D996B1C3DD2A80F3DA81E243D01377E3DAD2910BD5C2148BD3BD4D13C990CC0BC09DF2FBD1A7292BD58BB22BDA4B615BDC6A100BD2DD396BDB42688BDF710333D23255ABC4779ADBB8969EB3BDEA06E3D2107E0BC39B700BDFC1AA13D017D993C6CC71B3B285121BD9437163D56D2F8BC57A533BC07F5A03DB9BC2FBC3F000DBDAAA1913D91AFB53BD5717C3D07AF90BDBB8F77BC63AA2D3DB2B224BB324E353BC1E7A93D78FDC7BD281485BD96D99ABD739A0EBDF745513D1E2155BDC8B075BDE77026BDE0FA3CBD3CB3AABDD5319EBD43AE7D3D14A6E2BC3E2421BD0862D63CC70CC63B4A659B3D38494B3D1BD50EBB02CAA63C2A39883DB46EB73D38670F3D5CAA063D57844C3DFA2664BD44998BBBC8FB68BB79B1663D4764BD3A82949CBD7E6F4B3DCB8A1CBD0D861D3D3B023A3BC3A42B3D21125C3D86BC71BD87A7E0BCDC035C3DF5E5C0BD3817373DED2E2BBDB90393BD7D3749BCA72A073DED225F3C734828BD144DB2BCFA7C313D049CD9BCDD6D0ABAB0A04F3D6DE8053C2B3D2FBD88A281BCA3E5BDBC3179C0BCDC193A3C994E5F3D6E581ABDF013C33C5410013BB180A4BD0133943A78FE2ABD67ADBDBDD8AA3E3DF87546BD98B3FABD8C97873D296B63BDCC40CA3D1AF4803D6AA122BD4B77F0BCF89582BDE952EEBC70965F3C796EEEBCA1D1883D8A963B3C318321BD653C723D0E4D803C14210C3C64472ABD2D7545BB98ECEA3C336A9A3C2359303D353B2EBDC5CB95BD4865DF3C5EE3B43CD4657DBDC940813DF79A333D85D1A0BC666C993DFCB987BD506766BD353186BDBCBFD03D9E89093D3025ED3D31F0593C46C6B1BC8476DC3C6D839B3DA5EB5E3DC8B7203D3982593CE49377BDD97E42BD48C6A23D584DEB3CB5AB10BEF2BC37BD66AF86BC4F93853CEA47A43D8617373D304FC83B580D89BDA385B3BDA401293D9F9FECBB38F72E3CC231A538465E753DCD2DDABCC12957BCF02773BDE048363DF43156BCF82F10BD3E9377BAE03FC9BD430FEFBC847BBABC83C682BB1CDB5B3D5AB1D93CC99102BD28AABF3DBF31F23C5E5B343C1780433DE84E8E3B3C91F3BC7EB3C8BBB3023C3D4AF678BDC0024DBD8AEA423DD24129BDB9AF8BBD906C423D89D94C3D4D9FDABCB7E747BDA8C3AE3C0B6C54BDC55C873B79FD783C65BA073D1ABE7BBBF89D163DC34E45BC53338F3D6B69C7BC527104BB30E18EBCD72DEBBCCD1F84BDFFD3A7BD5B48DBBCF591A5BDAA4459BDE8A304BBCF46583C7751363D1019A63D428EBABD08B9973D609370BC7BBB92BCC044643DFB224FBD057C213CFE232D3D527C9D3D8B86B9BCDDE71B3D79F6AABD42F78CBC454BB8BD42C60BBDC0CE9D3DFB06A13DA078ACBD8C611B3D3B49583D4A295BBD294C68BCF53665BB826448B98E8D983DBEC3033D582C953DCB98C93D161C003C5926283DA071D7BC46E27DBDA0F482BD001789BDDF2FDEBCA7C32CBDA13E823DF54D3F3C9B90D8BD1EA1283DC0DD613D0136973C22859C3D299F70BC5A925B3DE10F3F3CE6505EBD7E630B3E51A1823DC1A47C3A5DDF89BDC2A8323DAC0E7FBD393552BB0580C0BD6A18D73C99BD1C3BAF2A83BD61758DBBB4A76F3D977C2B3DA34950BDFD92D5BD4C1C853BCF021B3DD28E1EBC396D9DBC500B04BE72189EBCC43398BD96D8D73DB3CA5FBC8050BC3C063BB5BD167594BD88F775BDBD68B0BC3BA9493B440DC53C8562833A901845BDD872B83CAE459BBD3A813FBDEA53933DCDE148BD4DA6E9BC9531C2BD3BA8263DC0A18F3C748AA13C0B04643D70135D3D172D733DB15C3D3D49D34EBCA44AFFBC555A9DBDE6C235BDA54C2EBCA423263D0FBCB83C78CD8FBDE1C7763D0C42CB3CE279963C658C0FBD982C0A3D28D1C53CC8F65CBCD80876BDD1D29A3DDA6D3CBDAB6DD3BC1331FFBC8B2F42BC1F7BC63CF4DE7BBD9020DA3C68EFB23DF7A6A8BCF4621D3DAA45663C321381BCE70A823DF6B1103D73AA63BD678C913CCE899DBCDC8B12B947E72CBD6B3A343D2EE38BBDB20F8EBDF0C9393D06C091BD772A7D3DD84C1C3D13FF8EBD2C2B89BD092F5A3D40BD403D0907C8BB1EFA5F3B1C3311BDEFB510BD2976B8BDF5A7A13D7FEE633D72E5A5BB3E7E6F3C547D51BDF17D3D3D33778E3D46DA2EBC35187C3C972EC7BD2CDB12BD9766B2BD5117DD3C7197AEBD275823BDF1178CBD75616ABCD28B44BD3D3152BDF98A28BD1E22F13C152995BDDEEA50BD87ED073CF0EB0A3D1B7B373D40BCB03C694884BD5ED1DB3D1E46053DCBC0613D052D9B3D4FD88ABD80A343BD00C8763D3BE5883CD50BB4BD3C21B0BD80FD06BAAC571CBD2BF9013D54055ABC65BF503C4F4C20BD3C55113D03A89C3D6D42B33D92EB363DB8BC81BD8A2594BCFCC981BD8A2003BD0688EE3AB2617C3CA1801EBDAACD463DEF86233D459B96BC009232BD524BB23DB099003D823F00BE5C1934BD382600BDDBED53BD2D5DB33D1F508C3C876948BCDEEC363D8FD71CBD9B9BBE3DF1D1383D63DB67BCBF5B153D20013C3DDA52F5BC8B13A6BCC90B503DD68A363CB9480FBDFCC54B3DA19C94BAAC6EB2BDCFEA1DBD6329B0BD6E04BF3C9D61A3BA0AE29B3DFF4818BDF5B6813C277B80BDB921FCBC45C6D23B678B1DBC36FB27BDAF23D63C5437993B1507013D665608BDBCC7183BB1030A3DA85936BD0A55CD3CD0A2D53CF9EA14BDE742B13D0E9853BD874C923A9BB9D73C3D2438BDF9E7BDBCA98E62BD456180BDE18B72BDB7D368BD87EEC8BBA457F3BDB00AA43C21A5143DAA0E4E3D1CE0803D1A5D903C4BFB163D1660543D88D9793DA98072BDF76D3BBDE5D8273DC64068BC1D6C483D4FBE163C81DBB33CFD520EBDDB91EF3C428A843DEC63E83C576C0BBC2B340A3B8342193D890370BD9CFDBD3C26F2DB3CDA0C8B3DE0D9A2BD11B05CBD49A2B93B63C9843DAF8A87BC4640CCBCDA7DC73C7A2D47BDBAA23EBDAC3F513BB5F5CFBC9F1C1FBD20D153BD39B56ABB49A4093C5D89B23CB3931ABC9EAA8F3CA8D946BD0AD50ABD2B7CC4BCD123ACBB7FB4543D38905EBDDE0F4FBDAFD3ADBDC572843DB99DB43C70E3AC3CC2575A3D915EBEBBBBDF0B3D67CFA6BC103C523D80CF423D04CE153C144E353DAB6A22BDD7AE953D4BA591BD88A0373D7F9F603D9D2278BD4096EF3BE5EDD6BC1D3A803D79AAC6BD785354BA8426673C3C831E3DFC578CBA6875513CDF01A2BB08B2C1BDEF2F3C3DECDF49BD40EA0ABD97DEEFBB502558BD0B045CBDBC1168BD4D4D02BC80F85DBD88677DBDBC0F653D8510443D69299A3C68609DBB0B44B83CC70257BDE1C9073D2FDC3C3C104962BC6614D2BB60BD6CBC43FF5FBAB47DCC3B47E5D9BBF88D50BD559F73BBC36F1ABD43482CBCA0A235BDC03DC4BBDF5586BD63E41FBD454ED6BCF1F2B63C4D7239BDE85D81BD3929BEB9CE2730BDDE8400BD8253A03D077E0ABD37810C3D345308BC5820703D2FEF3C3DBB8D783D3546FDBC4B39703D752291BC61A085BB6944E83CC51D3F3D1BE0A1BCC72C273C6683CDBC8DB4833DB0E58FBC934EB2BDF129C4BC321031BD41F178BD6D239B3D0708F83C6726EA3CA496C33B39F991BDF42D60BDD17BEABC05827CBDB0A06E3A1DCA0DBD352483BD8BB894BD4701F8BC7E01923D1FF522BD00C06E3A9D9A4D3D43513ABD09178E3D1405B33B5FA3803DA5DDAF3B9541023D8BE7443D56A7453D2717293DE4226CBB79E308BDC72C743CCD1D1DBD23E07DBD7716013D87237EBD12B392BC55C1CCBB8DC1633CA00D3D3D26A6A5BC1C5EE4BBFCE82ABB169C183D53625F3C1C99A5BB3729563D3C5BC03C643B4CBDE1F62BBD0079103D80FB973D99200BBDBA42563D2FA38D3D455A8ABD75626B3DAAB0463D984D833DA96E28BD4C9B3FBDBAD469BD3F3EA13CA0206E3DB2150BBCD7D457BDCFC980BD04E89F3D969D99BD254A98BDCBE46D3C4C62A8BDC6BD5D3D12DA5EBDEFFE7D3DD5435DBDD88EC33C42A3513D0806753CBE913D3BBEE7973D5C6A2C3D469D9BBD151F8CBD2B161ABD9B6C81BDB1F8383D7A2E663D78C1EE3C153C8F3DB3979ABDCAC7D6BC11E231BDFBB66F3C7CFD0CBC7B59403DF87300BD1FC586BDB12CA23D49577DBDB38E1DBDFC2A2ABD9982593DCBF64B3D542F7A3D41CDC0BCB06D223D2A648F3CAD57763DE01196BDC9C7683C469734BCCBE0ABBDC2A720BD3D228EBB86E6033D0C5A243DBC63A03D7E72E03C069725BD4BF2143D97FAE4BC337B073D4EC7963D24D969BD84E55D3D2C8810BD71FDDBBA867848BD6118323D1D1C77BDE3B7683D4FE746BD7C4F6C3DE7DA953D9AAF6D3D7F639E3DAAFFC0BC03999F3DA0D13BBC6AA60FBD924620B7D4CEF03C36E587BD01FAE3BC23DC8FBC4C74013D029FA73CF07837BCF2B09E3D07B77D3DC01429BCC71105BDE82585BD0E5133BC3D2F81BDF109663DD356F73CC58E833D1160713D3E189FB9831EE7BCFBB965BD6CBE553D4C4FF8BC51A6A33DA9A48ABDB57693BD35C9FB3CF956933DE86A983D8186833D8E1596BDF1E6813CE38ED9B9BC0E82BD70BF1B3DE23152BCB1C2393C54C3943D9FA192BDD2B09CBDDD63873DC3523ABD368E7F3D4CEE913D5285A03D18C635BD9150A13CE7B16EBD35B8283D421CA33DAA37403DBE5B983D831C913C3941043D27BAE4BC6F4F343DCAC9283D64C24B3DFE4589BD28AE8C3CBB4FCF3B4B4E473D646C84BDA43024BDC4BE883D4FA10CBDB461983D7B5E9E3C61696C3DFE97413C1413163DECA93CBDE35D1D3D30D9873B8C5038BCBC1F8C3D1FBD983D115A73BC5DAF25BD628C3DBD491758BDFFEF27BD6F59823D34D058BD0536353DD8C2403D1B9B4B3D5DF6B03BBCF74A3DB8187ABD7D9525BC6D62D3BC9C6D31BDCDC72DBDB18990BDA33C263D589C1DBD628E98BB643367BD9FB753BD16BEB2BB7DBABABCF673943D9155A7BCB185C9BCB7F080BD45209CBDC1F63D3CCF15A3BD26B314BD0D1383BC628DA33DE288CB3A2BD51BBDD664613DE6F49DBDCC27873D1C9B9EBDAF2CA03D58539D3DECDD883D3531F93CE00ECFBB77AE9BBC445B57BCF953913DB7EC11BD3C7B2EBB19998BBD867883BD7B271EBC5D39423DBFB18ABD7F494E3DC7C5C33C8F129D3A2B96B73C54148A3D388995BD52C080BDD02A263C3A3EA33D0EBB4EBDDF4882BD8D9A97BD4B1142BD05B34E3DF0DA223D80896A3C63E3993DB1F197BC9F2A963D16CF553D202030BD7832833D8DD47D3D44D003BD599A263DD50B95BCDEC9093D07F4223D52A440BCFCC38C3D57265B3D09BC793C3DDB233D2B9CA3BDCE6A563D68CE07BD358C1FBC7554ABBB0E40A13DA43E94BD807B803BC7DD433C590F303C622B363D9E45903D7FC19C3D6B0909BD20DD353D186D24BD7E16D43C5930E9BC997193BDA6C415BD18F7C13C5281A53D6F3B90BD412FA53C35A3183D62BBB4BCC8F275BD634F16BD13B9D73C643F1D3D967A423D5BB2183D04D40E3D5181C0BB9E6F8EBC50ACB83C7A2CA1BD6D19583D24D566BDB52D84BDEB760D3D3F039A3CEA783DBD1F5583BDAC7682BD17F377BDF5B19B3C95DDC5BC257AAD3BB26B3E3DE2E6513D42CC7A3D9A218B3CA8DFC2BC31471EBDEDDB833D4636F3BCF282813DCC0754BD8D087D3D40040F3C6348A33D2BEE613DF197BDBC9974BE3C2DB2653D8AC67BBD8A8C24BDC3AC763D83E4223C9CB8363D5E28BE3C4C87363B2023A4BC119C333D668E8B3DF8B91B3D96B596BD65DA38BD9DCF42BD450EA33D5B2E653C4E7E8EBDBB11FBBCC7ED073C5C61F7BC3965EABC7E0C173DA4907CBCFD603C3C1B1C54BD418A8A3DD00490BDB97170BDC0F690BB4642A7BB911882BCDDE658BCB6F17A3D5D249ABD619C0D3DC1186A3DE01405BDC4638F3D47A193BD6882D3BB0FDE81BD3697533DF244043D4F6E783DC4BA813D5F9798BD97DDB4BC1A44623DBB1F9E3D66F9AC3CD6205D3CF73350BD80C3B3BA95698CBD39018C3DFE0D653D4F412C3B541C90BDF7116C3DBDAF1E3DB0277A3D33EA903D2C01E9BC608004BD16FBA5BD560C40BB426A3BBDF855503D335DA33D1447443D849D54BDFD650D3D9981DDBC9DE68EBD3C0225BDDBB406BD9F2991BD92650F3D4F05263DC2AD89BD262642BDA13A84BD3EA25C3D70D126BDB4B9E1BC15AD56BD050563BDE5904EBD4E1ACE3BC39083BC507A76BD39C817BD537844BD5EB10ABD695553BD8262073D678E663CC04E833A7C1723BD6D638A3D00961B3D20318FBD2676833C65DD983D86A159BDD7019B3C12E3043D4240CCBC0088C939900E9FBD1EA01BBD0EB095BD2EA9C9BC6788ACBCF4CC70BDB7B18E3C5FAA59BC0051233CDAB8673DE1849C3D68C906BD231486BC7573053C02A4343D16B6513D75CC9BBC648E983DF9B7B83CBC4684BB5D4D8BBDC3C57CBD906F9CBD83BC7B3D429527BD4CDFFA3C3B085FBC27C4623C3356913DA2FC103D1A98603D12A9843C3F0C973DE08C813DACA5BBBC7B56F13CC1BFC53C657E85BB52C080BAF51090BDB40053BD062CAEBC490F833DEBEC9DBD9DFEADBCE3948A3DD3798C3BFBE293BDCC93DDBBCA058A3D14CC813C8ACEC73CD83E843D2A4F18BD06A1A1BDF69999BD0C42473D76A9E53C08F18B3D1EAC24BDE06382BD4C55133DE4B0F33CB4F64FBC6853A03D77F699BB8AC85C3C2BD833BD8BA08EBD0A4F97BD7725FA3CA455B3BC38D2623D2F7144BD96B64E3D1CBA70BC0FDC38BDA31CDABC8E65C2BC9C799F3D470876BD9871CE3C9585BDBC269F7D3DCE2C763D37AC233D8C144E3D97EB84BDC4543BBDAB3286BD051EEFBCA7F8163D0229C23C628730BBF67F8BBD88DA58BBB8B8F23C0D37DE3C169C44BDC3009EBD939EDEBC946303BDE70835BDF95637BC816D6E3DE79A943D3F61793DF352003D878EA7B9E6E186BD0DE178BD5FCBE93C04479F3DBF1A823BD61B913D517305BD245778BD4AEC9BBDB537D0BC42DF8BBDB6512ABD90C2E23CFD968D3D8386B6BCB67A623D37C140BAB38085BD94F0803C1C79D0BB33579ABD20E09EBD69EE593CE97659BBEA9A1C3D4094C5BC850799BDCB262CBD2A3DBE3C7DFAABBADC1882BC86D586BD90598D3D478B8EBC992C523D72D2453DD3910E3DFE67FCBCD6A73C3D1D0B8BBD3C0152BDC8BC8DBDE00B3B3DA001B9BB15E1E8BCD18C49BB4A0291BD9D1A7D3C2F0F0F3D3692263CF08E133D1969C4BBCA5DF73C5FE58E3C0632B5BBD9704BBDB7CE2DBDC5B73FBC91E6A83B3E97B33C71282C3D5DFCEC3C136D8B3DD46B94BA4AAB1F3D784B4ABCC01C793B6FDC023D134B28BC444A5CBAF4E7C63BEAA1A0BC225C34BCBF708A3DE9478EBC4940533D290496BD9029EA3C20AA003C24122F3D10FB25BB48E2993D12C44A3B178082BB61A5D3BC5469593D83EB88BD487A653DB5AA983D59255A3D18CE93BD713484BBD0D69DBD8A579C3DE58F2CBD378CA43C25C5C63C2B8991BCF9138EBDE11C4C3D154E063D66A781BC487D993C2148D3BC65439CBD1F3864BDD1DF25BD6AF715BC2C833B3CB4F2733CEE566FBD740D51BCA0BA07BD163A0F3D04734FBD724E7B3D32895CBD81058EBD9379F03C4A0C0F3DED546CBD7BD0283D7682FD3B72A1B93BFF98B9BC8EFD7BBD5134813D1B98303DA3CF893DF51618BD67F4FE3C00A7973DD3BB8D3C09968D3D3DD28ABD2EF15ABD6C5C89BC2B3F163D40B686BDDFCBE33B19CB87BC8A4822BDD521A0BD642D4BBD8E6082BC7034113DB08B73BC47B58A3DA41161BD59BB84BD1E07643CB9EC17BCFBD03D3D57D356BDBAEF553B1D090BBC08BC3C3D8D0202BD400894BDC305903D704BC0BC1EB6553C178735BD9DE955BDB7D6BDBBA11BA2BDEB020B3BD0F19C3DF29A28BBFF54083DCEE7843D6ECF063B32F42DBD2079EE3AC2CA5CBD5FCA3DBD04AF09BBB943FFBC7A936ABD73C7743C3B95913D5F06913D98A5C03C2A1DE7BC039965BDA93C943DA876DB3CF404C6BC74114B3D76ACA33CA483BEBCD24197BD65D5953D69D5943CCF2F143C9A10A73C9A5EF03C222D053C882F06BD0AC09C3D4948083CF157A2BCE3F35C3D6C9CED3CB37724BDB34ACF3BCDCAA5BCB45828BDB26C51BD3668D93CBB3A8FBDCBDDB23DA91C81BD2F26363D266891BC4093B2BC18345D3D63A12A3D30ADD3BCA2A22E3CE5116F3D5B5B47BD43E2893D9A3FF63CB75CFFBC78774A3D79D9BFBB39FDFABC5FF91E3D3219493D2E137BBDCFCF15BDCDAF08BDD101983D2FDCA23CF8A392BC3C9071BDDE0F37BC51DA8FBDCC4B0CBD32FA9EBD6A0822BDD742853D5C930C3CE7C62FBD8A50A0BDD97B673B15B78C3D9E80963D8FAC8FBD7B28FEBC34A4693C3ACF2FBDE05082BC74EAD23C7CCCF43CA10EAEBC5C685EBDEF0182B9A2BF02BDBBA493BD2A6794BBB7FA5E3DBF7FA43D5F008EBD55AA84BC560F2238D1A7B23CF32C663DFB5B103DA3FD103D7D41BE3C2771C6BBF5C32FBD9FE09CBD5D79253DED72983C1F34CDBC7246153D5EDA64BD0949B33C4CCE4CBD7C788E3C3E0F143D55030FBD3A50FBBBF031983C1905583D377D853D888FF4BCC04680BDE1581C3BD3F73EBD14B4A13D1D34CF3C65539CBC93F3603DC4FA263DD0DFF03CD0F2273B22394ABC7B1A6DBC487FF73C6001C2BC89B4E43C97E51FBC90DC99BC197352BDFBC790BDD2EB7D3D679EA8BC6C53B0BDB1D902BD3F56673D97FE903DB9F937BD613D22BA46B3993DB458DA3CAA66E3BBC8E425BD3BF3F23CEEEAE3BC15DB1DBCA110263DC4B16FBD239D873CFA76A93C057610BC27FD90BD2638EEBC2FCFA93CEF7D07BD0AF7BEBDF23F33BD33BB8ABD04B4D23C97E01D3D35F2B33DFE4CB23C4B7FD13C5DAD3FBD91EE72BDFE89213D45F36FBD420252BDF5EC90BDCDCB8ABD804B663C382D8A3D9F02953DB2126CBDDBB247BC93A6753D65D50E3DD2B4873D9BE040BD6744933C6436A6BD2F4926BDEC8C503D2A32633DAFFA5DBD2BA03EBCC0218BBD41208BBDB03E2FBBEFEB853B637409BDE9DE96BDCB92C3BBFD1B3CBD77A18CBD7147193D1ED64FBDB19D543D319049BDEA18A43D186CC03C21395CBDC9305ABDEAE00DBD06A1913D4527993DC49B80BD4BAF553DD5A8B4BC7716FB3C7FA4BC3C6DFB44BD539715BC3A3D07BC5BE1733D2E8F643DE3BB97BD36D66FBDA3EDB0BD46238A3D0B0556BD7F1DB8BC5585603C361AF2BC8C6F133DCBA5173D754D7EBD7FCF5F3D1AB1653D2699133DA5E041BD654495BD309E2C3C25C3673D8C012BBD42719A3CD8F50E3CFA8BBEBCCA9655BCFE5C613CDF697F3D06AE0C3DBE71F0BC8CCF0A3D6C44683D228D8A3DB4357E3D829E963DB9E2813DD1CAC1BD4B2243BDA4C4223DBEF031BD7E2F6CBD884592BB1B06323C4425103D36B57CBD1A6F84BD795F86BDE34CA03CA3343DBDDA74853C78CEB2BD569FC53CEFBA05BD6010173D9BE1303DEDCE57BDA9C39A3D0DA672BD4563AEBCDF12933D449A553C7725953C93F28CBD9A79FB3BF7B0093C5FD782BD3BA2673DF66BBD3DCFAAACBC6EA2A7BBC3F990BCDBC928BD6E103B3C54E43EBD8050A13D5D8681BD8626053DE900493DDCEC4CBD85DF613DA4EB683DE0C5A13BE8770BBD2B43A2BC2588EBBC88FC70BD0758053D35CD4EBDE0AB843D217F2D3D9DC463BDB4CB383D086FA13C2A4A0D3DFD440EBDF92F753DDFC05C3DDCE364BCB5E4073C203C993DED8A163D76B80E3DFFBF603DC31AB03D617AADBC18B5863DC44761BDC774E43BFA56AB3CD69488BD7BF39ABC8C9A083DEB7B8D3D14C827BC4DCF8BBC2DD65ABD1CE18EBC5CDAE438F2117CBD5FB399BD9B08A43D55B8A1BB8008163DD65FF4BC2E1641BD1202AABDBFC1B53B98B135BD40854A3D7E9211BDD6142C3CA76005BCED92183D372162BD10936DBD374D623C5CB745BD01D27E3DA274E8BA4C4439BD71F80EBC584D3A3C6414833C8B59893DF114D03C449EB03C4C084F3DF493963D2DE2373CC1D4A7BD122D7B3CBD22753DCE3B4DBCC5D0A53C158B423DC71E1CBC0C20D6BDF690B5BD3EAC57BDD1BD7CBD156AECBC98646FBC36C694BD446A22BDC2F889BC6C3B753D413C43BC2202C73C8FC3583D957595BC3AFE5F3CE699E8BC1BBA2C3B870E83BDB96EDE3C9D8524BDD60F0CBC38439ABD5D3C9C3BF535B2BD2DCF983CB11E6EBD88CCC8BDEB3DA2BD06BB023DB4EB853D465568BD25F2DABC71B991BC3CDCCDBDF28620BCC65433BDA286663DECAF00BDC41B5A3C35E8E73DE8E8DFBB094FA0BDB3CF82BDE87A873D0A2A7F3CE791F93C679040BCF4D7573D38F0873C377F443DD2A9873DB1E3003D81462A3DB6070CBD3E281B3D8B86BCBC73C444B9E29C19BC9FF2903DA038EE3C8D5F473DB190E73C192574BDD2BD8FBD4D7BBDBD31039C3C55AB913D58609CBD9BD28D3CAE2C593D704A7C3C971E53BDDF1E603B71CC9CBC18D8C93C8A2071BD8907B8BDC5C45B3D1C29B8BC7ADF1D3DAA0F92BB00C8E3BDBEEB093D1C5C6F3DB6F53C3D22DCAFBC63FC6BBD3BD2F63C601FBF3D856090BD48D337BDCB2498BD5CCEBD3C5E4DDC3D5055473D70CC04BC925CED3C0FD9493D41DD17BD03AB223C1D19033D114C4E3D2E7FFEBC9F65393D0BC0463DF0A98CBBDD1D123CB76845BDEB7687BD62BB8D3D553F863DAF71C9BC43B76B3DB1B5DBBC72A68F3D05FFD2BBC48C0A3DAABA2EBDA4460F3D13C8A2BB3FC45C3C5375753DA353543D4E97113DD6833FBDD7B03DBC8CE0F1BAD68BBC3C317595BBDE269EBDC7F39B3C062C823D9FD3243D4DF8ABBD5CE753BD357085BD419423BD7402A4BB86D092BDD781663DE5604B3D1B46C4BD4EA6853D19CF8D3D6AA93FBDF24EB6BC41FCA2BD1F6E883D46E685BC72B19BBD38779FBD731826BD852241BDBE7C92BDC7C5F6BDCFFF9F3C2B284F3DB9E2A5BC9EB379BDA0DE0DBD6E315D3D4938BFBD3C176A3C60C8B33D727B6ABDD4E47E3D612DBDBCF727A43CE3CDBD3B59B190BD0B3BCE3C910AB3BC8723A53DD8AAA83DDCF707BD8471D8BD7B36943CD12B563DDDFF0DBDFB943E3D2CD6B0BC265F7D3D3E3877BC92D586BDED80F0BD7D7CC83DF99CBB3DF7A688BBBAF0EF3C6E55183C7C6561BD3AD27F3D4CED2BBC4785EE3DBBFC763D0CD6643C7540293DCC570EBD7B7A0BBD6C6403BC2D3B013D61144C3D059D08BD0E3749BD50A2CF3C57949CBD61208FBD99D9D7BC5C6AC5BC5B11893C09D1A7BCFC7C9FBB6315703D38C28FBC63F592BD94BB0EBC8134D93C3EEF613D36E5C43C659C35BC4D78CB3CE767983D6611BC3D437D1A3DA37C983D1FD3303C74CA863CCB52853D65EA54BDC56937BBB04394BCDA34BB3BDA19CCBC38EB4F3CACDDCF3C9D1B43BDB6F9AEBB36643FBC6F95003E2337853DB1C9E53CD6A1E63CCA8A653DC3287C3DD53373BDF3E5D1BCBD9B713DF530663DAC4E833DEFEB44BD84ACA33DC6FB51BD927119BD855E883D5FA72CBD0D0D59BDCA158CBD63DB00BDF616EA3CC70770BDD613513D448860BDC2181BBDE4A892BC7DCEFFBC1FB0413DB38C58BDF24D4D3C73FD01BD740A38BDF85C3E3DD8BD693D10B3C6BDD5C2ACBC157520BCE9AB6FBC441D5A3DADDF2B3D15ACE6BD93CC4A3CE80FA5BD593FB3BD5AB1ABBD00567A3DAF5E80BD6462943D71E8FD3A9AFCA1BD24EF713BE01E073D9C96733DE0E480BD386B17BD732684BDE16A18BD8583AB3DE477943D61BC923CC01BE1BC652159BCEDDDE13DDD890B3D6B39993D7E3560BCD78E32BD9CDFB5BCC1F9033D340223BDB7EF543DF6531ABB5E56883DB200EC3B8AF992BD4BC9043ED8B1613DA81BB3BC9F54C8BB2945463D4BDFDCBC1A17DBBC81207D3DC9E0853BC89179BDEACFBFBDDBB9AB3BA539453DC7890ABD4FE2563D72EB9C3C2FFA673DB163E6BAC49D873CAFDA99BDF53D1FBDCD791DBDD80B813D9CE268BDB8908BBCB3B1993DD5A71BBD7480B03D021E453DD0FE3B3C18A69F3D69DA4D3D7041E13C0B07A9BB288AA5BD8DB69FBDE381B73DE8756D3D27097D3D5A8C49BD1D013EBDE39158BD29EAC83DFDAE6ABD31EAFABC9B4A1ABB95A90C3D6AA18EBDE48E5F3D4BC4153D70158BBD94E58B3B180A5BBD6D4BFA3DE9182CBD353382BCA1F316BDA3AF893C91FF9EBAEF40283D96EB22BD78F731BB36CFFB3D35D831B9D4F8AB3D9049903C119204BD7542473D5E2681BC4B8B34BDB43B7D3D1C5B9BBD2F24F1BD3693493D0C9C833C942451BD588E273DA828F7BBF6E34D3D344F843B3226C8BC03868CBC98DD62BCAC9CA03C1B46F43A3B64363C7EC21CBC5C90343DAF28ABBD1427783C8079133D65CEE73D797EE73C56BE183D531DA23DFFC54DBDC46561BCA6BEAABDCBC24D3D2A6351BD3E76EEBBC87C103C2BD671BD1CDF523CDF373BBC77480ABDF1C8233D044E4BBD460998BC2E7623BDD9DEA03D0206793DE983FBBC562E503DB19FA43D04F83D3D7DF1233D261EB43D654CC7BD8274AA3B6A3033BDB80B1DBB3EC4383D38B374BD2B106E3DC1E9593D2AB363BDF1B9253D7F7AFBBC7612893C7C095F3D2E7D13BDC5A1C23C5960BB3CDD304CBDF787833CA221583D329143BD4BE5F03C0923E23CBC3AAC3CB790523C317F803DDEF0543D0136153CDE2A6A3D6FD3A23D0AF57A3CDD9D893B4191783D4376393D53D4813D2F7E8E3D6BF658BC6FB33D3D4239143E06BDFCBC7EBC0B3C362883BD631388BD4DB8AFBC15B4CB3DB3EA0E3C05AE1BBA8860EB3D45CC3D3B1620AD3CCBEFD23DA09D8B3BEF751EBBED00893DF4127CBDB2D6523DB9330C3C9EB3963D7100243D2FB5683D70CE973CC96B7A3D2CF1403D999C0E3C39FFC1BBF8DA7F3DD210863DC2D23B3D2E5A5B3B57C092BDA8A97B3D415286BBA849AB3CC336053ED9C278BD4B17AA3D3A37873D220A303D60ED4E3DAD0E5A3C61FCDA3B52B8993C1ECD1CBD39495FBB40D671BD2E797E3DBC553CBD851F8BBDF61C4BBDA356093DB11B073D9D2C803D28733C3DEB7A923D729A603DFA1F89BDC784DB3C2D85F4BBC7C9CBBDAF58123DEE8A6EBDE4778FBD989AAC3D428595BD88864CBD9DCF263DE723A03D8EB91A3DCA4558BCA56B743DA56E38BD2B3ED13DDD339DBC4E5708BD02BB5B3D27FCE0BBC5EE5CBDABD9513DC78849BD24FE1EBD42A5F6BD569481BCD6D7243C5A3793BC5EE4C2BA6FD23EBB73F1FE3C0CA24CBDFFBDEE3C787B8B3C1B83B8BD5B55F2BC211B9FBD5A578A3DC9CC36BC6AE9953D1D7F50BCD0F0723CBEDAE33CC6DB51BBF9870FBC09966A3BC50EE73D427969BC4732013D5E734DBDB1DDC53A09E21E3DE171F9BBCE59943CA0FF313DEAFE35BDA9DE1FBDA5C08A3CE993DEBCF04B6F3C187B9BBD902B783DE238CDBC7BB7803CB1E6993D0779463DD690EB3C346135BDEEBEAB3D26A73FBD25160B3E61A647BD70A43ABD18AA30BD4614253DFD0B793BFC813E3D5435A43DC33E1B3CE129003CD2361B3DDA0571BDAC8E02BD8EED063CD9D45B3D154B7F3D51BFE0BC24F23B3C623FF0BC8750833D8AB4DCBD28D8BC3D45162F3C4ECD65BD41CCA3BD6E915E3C30D1143D8DB5DCBCF0182DBD936E12BCAD0BF4BCDC638D3D7CB0F73C0CEB2BBBC010C43DE208973D11E2023DAB3026BDA6EC033DE8D393BD2A08433D09FBC7BD0CCD863C993EB63C885A703A1DD9C8BCA1BF1BBA7542BB3D9222B63D2D792BBDE106563DFED066BC52C4D83DAE4A273D4235223CEAF36DBDFC206EBD3D783A3D9A12A5BC24EBB7BCACE59CBD1966643D501001BE294C1B3D61B1293EE83CE93C700D4F3DE259293C781837BCC86902BEDC1A66BDDF4177BD513AC5BC319F7E3DD0869A3C22FA1B3DFA07553D676D26BDB000BF3DACE1EB3CF6E704BD06878CBD313E58BD2B37953D45092D3DFB72BCBDC255A33DEAEB8F3DAB8E84BD9D36F63B3240A5BD7AFB0B3D6ED0CDBBAC5BCD3DB222963CFC8E7C3DD118D1BDA816E83D1700723BAA9D32BD5971B33C8061A43662F4AFBDE87EDCBBD612A3BCB979CCBD3ADF743D64C2353DDBDE943D4DF901BE63AED83CF33136BD97D1EFBD9D6158BC9B54C7BA1A2D5A3CE72D22BDF4DED6BC467BE73C5C62A8BB09C288BDBD67AEBDEE89113D8EC9513DF725503D426DAF3CF6955B3DD0999E3D4BEC333E07FFD1BB1307D5BCAB5CB0BD0A4D7BBD294417BE6883C93DC1A8003E27FDC0BCE51CB93D4417963D6C164E3A0176253D4675623D62771CBDCE11283D6315F4BBD27260BA4309913D18BE483DDAF355BDD6CF1F3DD1F62C3E3090B6BDB25F55BD862EA33C7287093D8BE4673DC5D950BDE96B903CB47162BCC512473DB3AFBABCB251B0BC3C32913DE40E893A0AC06E3D9B2B823C235B883D52D4073DC556CC3D9DEEC9BC1BF84FBC8CA852BD0398A73C67ACAEBD0EF520BD9025073D2D111EBD81A5FEBCAA75853B9196B73CFBC5513DAAE3DF3DE7B3943DB691723D7CCF46BD66E6B4BCE85124BD5E7BE93C9D8363BC5BA88D3D3FD6CABD01F904BD2C156B3DF8BA83BCE74F473CD98FF33D2EEE5FBC0423A2BAC0944ABCE1008D3D2EF7B13CFBFBB93D5577073D3A39233C875DB23C8D39F93DD6B3393D1FAD493DC5A23BBDC7B549BD992E76BD8C853FBDBD568ABB962FCF3BFD425D3D3F3D663D699F40BB2A3D57BD8A488DBC9E95A93C548ACEBC02B1CC3D9F668EBD1739813B06B4C6BC9D2A1D3D7E59083D36520E3C688969BDCAD962BC0B835EBCDC1640BD1C118C3DD00B513C159AE43DCCBB893CFAEA863DC97A51BCEA0E64BDEA32F4BD491337BDA4E3C3BC0797EEBD0F0ACE3DA7C451BD7D45E73DE4E759BC5B04103D0E560C3CD66B14BB1494F53C0816933C84A432BAC2A9063E259E1D3D24C1FC3B5BCECE3D2412A3BC09CCD7BD2FBA9EBDDFD270BA558714BDFB202F3DCDFBB23C998861BD0CD62ABDDF72C93BB7E5633CD559253DC29A0CBDC360D03DD88D1CBD149716BDADA91C3D6CD5BFBA0641CB3D001A733D641BE43D98D4C33D137A253D070005BE6255733DE36A623DAB68083D3164873D5C5466BC1B81013D758217BDE37576BD4022863DA035A03CB4487F3DB9537BBD6D37B93DED34643D36D2CCBC7B28DA3CA1837EBD7BBDF63B3247D73B42C4B43CC4CB9CBACAF75F3DA1347B3D12F3AB3CD315883D82C0BC3D663C0C3DF3D50FBC9DD4CE3D88BFC83DB303703DB12F85BD9CBC2D3D5F25D6BD1D9ACABD7BF157BCA75BC13D16CC37BCEAEBBABD72603ABD9A3BC3BDF9E9E9BC3B77C93DA3686DBD06962D3C80E4CDBC5EE926BDFB5C4F3D6CA3883D3ACBB43D92ECA3BDFB3DEABCD907663DEBE3A33D574D663D2942253DAB41303DC935CBBC7E6206BB867D15BC8084653D7B12D5BC60591ABDAC2947BDCF68063DEDD307BE4A21FE3CF45A67BD13A4B73CFA1E42BD1CA479BD8489203D99A3D43DFD3B3ABCC9A9F1BCD183ABBDEDE34E3D27AD183BB7F4A43DFFA3093B8731C83C92C17A3D7DE02E3D435D6DBB15D4E0BD84B7433D350EACBC95088DBC269D84BDD2D2AEBD7C0D553C59BA8C3C044BCF3DF594023DEACEB63DDADAA73C73299BBDD06A5B3B569ACFBC2EC4123B93EE2F3C12558BBD5C900F3DAA641BBD140D8DBD3C34683D23F44EBCBDB88FBDBCBAE1BD17B29F3D95FE013CB6D3163C253581BC2E17F23BD154C93DA47F87BCA550763DC76275BDF5EB84BDB3A04D3D47673BBBB3964A3CF611ADBAFBF0383DEEED933D56C3E03DDA85773DF6AC34BC24A94F3DBE2CA73D90EED03CEA00B13C46A03F3D13CCA73D31CD90BCBC55A73D2EA1D43CE25843BDEEAEE5BC5D1D573D4CF702BC802E8D3C29DB69BD762D3E3D86BD833CE7FEAFB9AC8B373DDFBA8A3BECD0013DF90E8B3DF6DCCCBC895323BD19C0363E1916303BFB3C983CCB0CD9BC66C58F3BD9A03BBCF6A0163C5ED866BDBED505BDDFA4A3BD12AD433DB3FAB83CD2D57C3DAF20003DC320923BF5D1C9BD5816B93A187A003E5946633D5312C1BC37F195BC9A0F4F3C7F421F3D2F96C43D11A732BC1C4D98BB41787E3C31ECADBD818B323E4842ED3C31A28B3D66F6B6BD91C4BC3C1A55243DEAFA49BD8D31873D4C26E53B03931CBD58FEDF3C7A1D8DBBFE33853D7D8909BDA596FDBBD2A9323D047E87BD27F2763CAC5165BDC98A403C97C5F13DFAFDD0BD8B61FE3C5D5A19BD90652C3C5A4AA0BD29AAB0BCFCA1203D17914ABD158FFD3DC9E0703C2DC7F1BCDB2F32BD213BC1BCF54D9BBDAE909CBCD7F2A3BD705DDBBD3EF153BD19271E3E71054A3DA650623DFDCE7D3CB39F6BBD928D89BDD7608ABDC1958BBDD252A2BDD8DF52BB5949B13D5FD7D6BC2594C9BD152FD83BA6C3D53AE953E03D13B8D63DB66182BD3768C03D7263AB3B2BEC993CFAC3A0BDD933A13CC3699C3D394681BD27DFFA3D2836643C086848BD2F5334BDF72D2A3DCD34843C08CF753DA00292BD2249833D36E1A7BD963A603DD05BCCBDC446A7BD91E14F3D7D3F35BDFE649B3C3536EBBCEA1E4EBCEA3D4F3CFEFBEABC131ABCBC4915B8BDA9B6353B5EBDF83B53040DBD8100C4BCA9D16DBC8FCF7FBDD1A5AA3BE13E343DB807483C6F68FC3A015BD53D37DABC3DC3D9B03DD863B73D6AC9973D042E3DBD33C9173D40F224BD54EDD13DFBC019BD9316CEBCF83317BDB190C23D95EC1BBA445B10BD67FF0B3D4E3C093DD706E83DCB1E33BC75D214BD93AE523DFAA5123EE68B0C3DBA7D52BD6E50903DDF1B69BD556DBB3CCDAA72BB854FEE3D5DFF75BD5526953CA92343BD79140D3EA3DAAF3DD81E6FBD1C51963C2806A73DFB85E43DC1363BBD6D7DE1BB2E9304BDB46F783D9BF083BD10E6EBBC93F2A3BA58139B3CFF1B813DAC9A40BD40B563BD915519BC584FE1BC34A6D63C66389F3D9E0490BD418B333D7421D23C5192453D576CA8BD19398D3D1AFF8EBD5EBACBBD6D98233C8A5592BDC06CC13C365B993C28B2903DEB1623BD516C15BD24FA79BD5E87FABDC7AC2FBD622EF63C4803A93CB6B7903CFB7BFF3DBFB3633DF63FABBD179396BD2906593D3359ADBC9A4586BCD955E9BC43A75DBDED723C3CD2EC93BD802DB43D7447323D87B4A63DAF6B353D3CC2663D68D7773D0E3E063EBDA47FBDEA62C13D0220B43D8CBF6F3D1BC3CDBC3F23B63D7603EE3CF7815C3DA7C746BD833B3A3BB2625ABC0E7D313DEA27903DEACD6C3D95DF783CC976643BB3F20F3D27AEE23DDE95A8BCB7E090BD986BB13D3B60F93CE2F68839265587BC64E99CBD4ACCA7BD147A84BD770A993D715D3ABD9E4492BDDF77B9BC1AD095BD0CFF273D4D832BBC063F38BD3ADDB13D19A38C3D040578BDC149553D6048723D57D6843DC4D80DBD4B7F493B5C7BC7BCE3328BBCA1A3B0BCCFE3023E84D1693C167E083C58F55F3DA66185BC3D304BBD8823A23C2C1FEC3B65CD57BD1051CABD570A0E3DE02B743D5B889A3D97BFA2BDD2FF783C10F5BA3D39A485BC3CF516BD60A6243D7DBB22BDE75AFA3AF7DC683DFB0E01BDD1F254BD5D00053D026F603D09CD323DBB8CEE3D5610BFBC4A03823DB1963FBCD69B20BD8E1EB03D2171A93D79B2313D2DF3153EF0EFBF3D34664D3D0A5D89BD1C0268BD560D6CBDC0B53EBA5C2B81BD056F9ABC215409BCD8EAB7BC0F5A8CBDA8BFC6BD30334E3DB2AE093C67EA42BDFA99523B945B013D767A2EBD33B55CBD393C3038CBB43CBB39D3843D912A61BD1FB1BABCB63F59BD6F709ABC0128F6BD8CDA0CBDA4F88B3C56E3553BEDCF77BD1303453D52AF3BBDFB89033D8BB764BD711EB3BA83C3013CE225DF3D64D683BD1DE2C53CF31FD2BCC182153E21CAA5BDEB6C6B3DD311D03D3063903C40964D3B6196203EEC0F6A3DC5F0F83CAB053ABD8D82A13D54730BBD0CA08E3D5CCBBFBDE211CD3D9B51223DB17B293DD45B5F3D304F44BD285D33BC102C82BC995DD4BC3A79143E4BEA333CBB9F02BD4633FABC7AA42CBD1F19233D6E27243D6E652A3D8E2E95BDB15F4FBD4337CF3D72B92EBD993143BD18C441BD5338C4BD52FEEEBCD65B8DBDAF41F8BCD789863DC883363C90DC44BD875982BD6382DB3CC1A84D3CD23099BC5DB427BDAED492BDCBCBCF3D4030BE3D0F8FDE3D41D7113DD500CF3DDD70263D70E3073DBCC42FBDD563913D03B196BCC9BE18BCC1E3BCBD418C0F3D73C2BDBDFA64A33DD9CE4F3D31EE693DFF5AF4BC90FEF2BC5DC997BCF994A43D6D16763B8393F83CD88FAB3DC041AFBC80D963BC8FF870BD77A99F3D5F78AEBB4AAD273D5D6189BDAC38D53B662A16BDFFE6BABC1C68E63D5792333C8815A73D9CBBB93DA5D0813D90F57C3DFA729F3C6A9080BD5A5CB93DDBA2C8BBF1E21FBDF26BEF3D6EBDE1BCFDA6813D70655F3D29684EBDE569E4BCB61F2ABDCCE7EDBDAE95CEBC0D3FB0BDFBDB663CF06613BD83F323BDBA6AB2BDDCCD91BDA7BDB13C8438F73B97A836BD6A835FBD05B14D3C303FB4BCECD8BFBC2512DFBC9A550C3C38E7623D12079DBCABB19CBDA624AF3C138C283D204AC23CDA905FBC41A0C73DD494AD3D6231273A1292683D9DD832BCB045753DF7FD43BDBB7882BDC2848FBC27AC163E77C98CBD1973AE3BEF09A6BC900D5CBDA02AA4BD5D19A1BD9EADFCBCB2131A3CFE44213D8E3C8DBDC3F89D3D4041AC3B172A25BC40EB84BD09E3ABBD010A123E247C6E3D7DE450BCAFE4363D6DF32F3DEC63A23D1C8D543DD55053BD5EA915BD6D58B53B2D3F8F3D09DCCDBC2DED6A3D5DF1253D21592EBCAA8821BDDE87573D838D813C36106EBCC027953BD51F843CDEACA2BCF2DF6FBD1B6AC0BD4C122C3DA4BEB13B6D27A9BC14C86D3C050858BD883CB13D714E0ABCFC7911BD5ECF753CAC44B23D8F71A83C37BB053D20E2DD3AEE1253BD1AE442BC253B8ABD28B67DBD8B108ABC39809E3BA9B2723DAFF4AC3D3F2629BDDC7987BC5B552D3D667824BC342292BD68EC81BDDD4C85BB3F47BCBC13CF22BD2118623CB469A3BA0FCC75BD61E8EC3B7876633D6D96793D37D8F4BDDC953C3C445D683D2D7282BDBA12963D1FC7A93D345F0FBBA34E6B3C851A0DBBE2B8903DB8E5FE3CA65E7CBCE49A043E5E8C7D3DFA3341BDA428D0BC595166BC3A573D3CCABF973DDFD27C3BC9A09CBAF143E2BC6AE8F1BCF6CE563D2EADA33D181FEDBCE1A090BCEF454E3D295C7E3D7357BEBBFD19233D26C656BD64C210BD2103AD3C18135F3C4086FDBCB89F69BDBF898EBDD12A1BBD5F5BAF3C585AD3BB52699CBDF505AF3D4495FBBCEE39A83DA5F3CD3CDFD2BA3D210792BD23975E3B5EC1F53AC68C99BDE5DF683DF946363D08DAA3BCD5A2163D257202BBF034243B025B8EBCB4243CBD3707E23C1480DABCE6ACABBD5BFD1D3D99679CBD4AEE433DB39A3EBD4D074C3D270E273DBB27AA3D04579ABD579CDA3DC37D0FBBA3A4F63CE4C4BB3AF11759BD6294303D3FF9D13DD7A96A3D45E6D6BD299C08BD7BA75ABDDA2D85BDDFE8C43DD4FAB23D78D45A3C54503BBD13D81C3CFD78883D49A8823D3DF820BB71544BBDDB13EE3A1C75EDBCAD3579BD1ED70DBDB0EE803DFD7787BDFF8C32BD75CD8C3D366AAD3C62B0E9BB1E663FBD26C79DBC74D938BD0B9A47BC58EB3F3DD08C183D4D41F6BC294937BCAD22873D64BEDABC0FB3D33B3DD3703C583D04BD806B76BB2CA6933DA6A2D8BB71D43FBDD9CB713C21A89CBCF3728A3DDAFA6EBD0F33C2BB34DDCF3C47BEA1BDD46D81BC15370D3DFCC3FE3BA4909EBDCB4286BD4FBCC03DD3948CBC94F4903DBBF5AB3DD19D903D15F6F53C77E2893D6852C73C17C3683D10AA8FBC1504953D58703BBDC1B89ABDB438753CF39AC2BB21FAA23C236AF73C75FD1A3DF1FFB2BD406364BD9D5BDDBC327F50BD418A273DA884BCBD6219213DAC029B3DC03D4DBB9F3DA53C38AE37BDF15180BD00262DBD53A82FBCA00156BD74E5B8BC581CDEBCC74E06BD0A2232BD0EE03F3DF7C0A33C44E58A3CC6764F3D4A41393C49916BBDDC49153D7F174B3D27AD463D3A2D85BDEA46ABBC1F87B6BD254419BCA3DB9C3DA97E983C963FFEBCF4875BBBAE09493DB800403DFC0097BD8428E83C7265D7BBEB93C7BD36DE853D2A95283D0717DE3AB5220D3DCC3928BDF84174BDD236083BB4AB1A3D6417C33DB721993C95C6863D71CF983D4695753DE7BDE43C889B4ABDCB034E3DADB6A63C09E19D3D7FCA94BD1B7DDABDB7EF223D93189D3D16CCBA3BBA0F853CE6E5573D925AB4BC0C36ED3C35B6C8BC1F1F5DBDF83B80BDE6F76B3DB98C733DE6F2C4BDE4BE333D94B60CBC7806B73DFD8B9A3C1DF69F3C639A0A3DE135823C0EE84EBDA2C6BFBD83B6C93CF8611E3D2B5AD6BC2869A33DE646A0BC55E96CBD2CF8BCBCE3912D3DE4B48F3D969C083DABE994BD8ACBD4BA7CCC443D85942FB9AA6C523C2C4275BD3BF4A43D36BD9F3D8247393DB6E5D73C8F47323D66BE8D3DE38FCC3C42901A39A7D640BD832085BDC534C43CBB363CBD4B46FB3C2AEE83BDEC93B8BA16398D3DFFB9333B6905063D57FE6E3DC7395CBD77F62D3C181081BD391B4DBD5D544EBD9A0622BD38887BBDB6F6973DBB45863DA78D04BA137E453D02A826BCF3016A3C3AB0AC3DE01993BC0A6E363D38574E3D1982A5BDC48B8EBDEAAFE13B76C401BD0A3A233CB30D9CBDE2859F3D3B8BC1BD91198BBD4C0D39BD31EA773DF82E8FBDBCEAE03C4630A93D0510A33CA740003DB4C52C3DE27F563DFBBCD83D7B01153CF6D18BBD01C3BBBDD987A6BD252F5F3D7E49DF3BC8AABE3C64AEDBBD046ACBBD4ECC84BD9916A63D9535DCBC7A9372BDCB76753D3BD775BDB61327BD918E353DAFDD5FBDB7C8BEBD98D27C3DFE6A98BDABFACFBBA54A7C3DF4382E3D8CEE6E3D7A681A3D0ADD16BC5A2858BDFDE9713D32FBD23C6B5A8F3D53BADDBCCC80B63CCFC259BC06702F3C0CF072BD7B67883D736F94BD9D20753DEF5181BCA98E203DA92B9C3C855D373D6AFD7FBD386D92BDC0298B3B45B79C3D0CE6D73CA74A713C6F91D2BC0FC5083D2E070A3CEC83FDBBC51AE83D944F9C3DC28524BDC38B0A3D5504063DFA3F7C3D4A728CBCB6B3C83DEFC3F9BC16F2B1BD5EB79D3C7D3791BD3C4C973C57A1B9BD08B7143BDE205C3D97BF8F3DBCCD923D5751253D08840C3D00CB273DDB1664BDCEB8963D2EDFD33C816A3DBD416232BCCB8A9DBDC65F70BD7D3C81BCB7CAE53A5F86E23D44AD8EBDA06501BD66010BBC9A47573DFD43413DEB59223C6E08463D9D3B7A3D30148D3DDF022DBCC69965BDCF170BBD2828D03C02B5423D68AE4BBC9EA6943D2D6D7F3DD1B9C0BDC13DA8BC6D07C1BB5C8FA63D0DB447BDB089513A4C3A703C18C7AFBC0C5B56BD7AE93BBD1B8C19BCC2287FBD54C5663DFDAA353A299B87BD64E956BDBECFC8BC293A213D39C32EBC3970AEBBA348AFBD5AD145BCD226CD3D3165C73D909C483D5768A43DE23F283DEF978FBD095248BD75051E3DBE4FC4BD1B13773B66DED1BC6A46953D6D94A3BD29EA01BD2A79DD3B095EA03DBD352ABC4D000BBD19859ABC337C2E3DF0AB53BD2A84A7BD80B472BD79A6FFBC65FDAC3BDD8D373DBFB5E63C8C0B873CB586F1BCC6B709BD0FDFDD3B1273B13D3CF3463D994F5C3D0907793D5D1A883D7E69B2BD0ECCC23CFA4C0ABD3E49863B32A191BB6D5EA4BD3A9580BD6B7D82BDE0E0FC3C9A3D92BDC0DB72BD142683BD4701C5BA8C2547BDC7B7813D3C15BBBBFE4B8CBC99AB9F3D188C883DFDAD933C5C973FBD92A010BD66A22A3D4796613D869612BD3C93B5BD6A44583D22FCEA3CB156483CA4E5B9BB7E43033CD5A390BCBC75FBBBA0EBC3BDC108333DFB484FBD7DB2403D5E638FBD206BB6BD7FD1843BF69436BD3C4ED0BC267E403D40BA96BD71605DBDEDEA6D3CD495AE3C1A4FAB3D24098E3D3B3085BC4E309ABB2820023D448C4F3DB6DE5BBD958DAD3D59DD96BD046151BD9A402ABD114CCBBCE493473D9261B0BC307174BD7CFA8F3AF3CE57BC79E26CBCCD0924BDE93E46BD71E87EBD77A7633DC2D3163D22A148BD02B3E93C0465FC3C854C943C3E8C58BB3783E0BC62E34DBCAB2FFE3C5DC828BD3F5B4ABD7820E5BD27C3A6BD4AB919BB431215BD3999243DAE45BEBCD4F64B3DBF73C13D1A672ABD487668BD7C8D893C4911AB3D71BF8C3D062BCFBCC2FA68BD1A1C9FBB60BDF8BA220C2ABD83DAD5BD153D1ABDABA21CBDECCC243D2C8B7C3D05C98D3D65F4C1BD31BBD0BD83A25A3C85D649BB854883BD689E613CDE5A0DBD8F4727BD425F4FBD63FC5E3CC5B0E8BB33CCB0BCFF5DB83C5102DE3C2D7455BD4E9604BD08C81B3DE8A2893D6981033D78EE6E3DCEBF823CB975E8BCF775843DE647333DF3D995BDF8A040BD3FB959BD87C6AEBD7F60933C543D853D6CBE21BDCE931D3D5231F6BBA6CF4D3D6476EA3C441E72BD775906BD27B2E7BBDAB2833D10F4ED3C07FA813DA385FE3C11A307BDF01A20BDD59561BC6657A9BCD4CED33C5550923C07D5CDBDB87B57BD1B6CE53CAD4DCA3D267C56BDB7ECCE3D3215853CBC70363C577F71BD417EAF3CEB46ACBD3FD514BCC4F1BF3C2CE12EBDD914523DF7D076BDC04F9B3B2568243DA29816BDE4740DBD17609C3CF2A195BD38F10EBCFBA5353D34DD0ABC5AEFDBBDDFB9BB3DE3498FBD9742B43D0FF27E3D636621BDA69C97BDACA7DB3BFED2F03C7E2A30BCC5D622BD69E4A43CAF3B853DB95B913C1F0AB8BC471A65BD9F8BE5BCBB24293D79F187BD1FEB7DBDBE66993DAB2747BD4134F73A23C8EC3BFCDA893D8D9A213DAC3ED23CE5E1283D7A26213DEFF2FE3B19CB2DBD9E5B323D770889BD88636E3D950069BD8F72AC3CB74C91BD506514BC25CF3DBD164D19BBC0724EBD182F373DB59DC53D44A2193CD6AE4C3D0800673D12F5023D0F65D1BCD59A43BD01B397BA539597BDCF78D2BBC352C6BC33F3B6BBA3110A3D913AD73B124A093DC7A78BBDA215C0BCB2609DBD6025853D2AB40F3C9665003DF9E7373DD98E6EBD6A39813D8C4A723D558B013DBE8B933DAE94093D3C5655BDC3ADC43C34917FBD007219BDB19D82BDB08A8FBDD865973DCA8106BD9791853D57399BBDFC6B7CBDCAA33F3DABDF153D4F2E8DBD8C38C9BD247D483C6025A7BD08AD2E3DB786003D2AAFCCBCD86DE73C8C664EBD50FD313D6B0190BDAB67E93C64AD623D598EEC3A635E973D9FBBF9BCF1F8B7BD160D85BD4F4A96BCB8CFC53C9830DE3C93DD0DBD8D435CBD5ADA953D4298643DE17C523DE801883C7649863A2A3B3C3DCC66BABD372F3ABD71790EBDEC8A143C9CB057BD33B2FD3C970A753D3C2554BD85D8EBBC426E3E3DC0CF76BD9F30F8BC865B91BCEC42CD3C43EC43BD07D74E3DC68181BCC8C1BB3D8EE921BB4DB0CABC8F53603D1421A33DA4B55C3D2EDFDDBBF3B4BFBD892BACBDBE153C3DEB9F2ABD0674233DCBD589BDF3FB86BBDEE2A3BDBAA6953CE9AB573D76CF11BDBD70133DA1B9F53C470698BDDB42A9B95E716FBD1676043C650E0E3D84E0C63CE8D04D3DC5E6073C3AADBEBB1782F23B1FC56A3D372B2F3D9D335E3CE99CB53BAF64863DEFE794BD2FFDB3BBEE4F01BD8E2B093C97B337BD53E0BABC5AC5EFBC74FF8FBD1DD1863DD229C1BC1486F8BC842CD4BBFD31D5BCD20EA9BBDA374B3D8ECFE13CF9D6AEBD10E4353C83468B3D9406A0BD3B85ADBDB9B07BBD0B972ABD0D6A4B3DB40646BC511B93BDE3ADB4BD9F27633D81E87A3D327D56BD1762A13DA9DFC0BB9F3B8F3CF000073D4FF1603D8EFDC43C92DB35BCF62CB23D7299F4BBC3EBE9BA95BA103DD91A16BCCD6289BD148AF7BCF3DB92BD8A24B8B98C06D63CE3091CBD7236013DBD7E9CBD2B713CBD31A8173CE622A8BA8EB6403D9D83963DCB239BBDDFAB773DC482083C219C383C3DC0283C4B37C7BC3DA0C8BC5B6A85BC1ED4863C3E7B6F3C1A1F89BB54F6ACBC6B10003D294D563DAB83B4BBB60D68BDDF1A013DE4304BBDC823AF3D97BE94BD986EA1BD83FFA13DEEB489BD5753A03DF91803BDD0F895BDE1289CBD11DF88BD0196883C2765543DE3A8CA3B4577E0BC65B03ABBFC89F33B45F152BD740B6C3D862085BD0EDF9F3DD63D9CBC9BF705BDF6E142BD2333723D3C979D3DE4D0FF3C081197BD935070BC2C318FBD8317643C4FB0F23C0D50F3BA7DD584BD6AC239BBCCD76BBC14172EBCCD083FBB11C08EBD166957BDB25A843D8A43893D6B9C793DBFB290BD1C1764BC0DC5383C9FFAEA39B2065B3D513DAD3DD5F60B3D847FCE3C0CE67BBCA8459D3C4FED96BD0350F2BCBE2DD73CDE91933DCCAF0ABB55D503BDD9640F3D6CD71CBD57628B3CF22506BD9A359F3B2AE597BCEB28813DE5324ABDC827EDBC4E6E3EBDF93D49BDA0125C3D7ED916BD4E8B69BDBBBE87BC919D593D31E54C3D0EE98B3B783D233DAFA674BD3B503ABD50AF913D681477BDB3CA8BBD0B8B2DBDC7C68C3D69F7753DB86E963D10E7A0BCD6504ABCF74233BDDB388B3D0105003DA5B9A2BDB44E9ABD20F0273DDAF0753D265F69BD97AF10BCA31B45BC6D4E26BDA1A9A4BC1AB887BDF90792BD015B003D4BD2C7BC513284BCB4943BBD43CAE1BB023EA23DCECB813D0667923DB326CBBCE600073CC85761BBA46422BC943C99BD82DD6CBD8CE679BC32FD81BC9CADCFBBC5E269BDBE2E123D914DA43C4B5F06BD2ACB64BD03F9CA3CBD9240BD6FFEF4BA8519873D9E13343D97A18ABDB08A093D9FF53A3DE387DDBCC19B9ABDC910CC3B402ED33C37258F3CC252A5BD3895AC3CA21D333D7A07693DC22179BC9276853AE5742E3C8F6F53BD22A7F7BB18699F3DF7178F3D6FC0463C38B36DBDD0A60F3D432D253D084D73BCAB441DBD7CFCCC3C2EDE6B3D3FB066BD452D86BC562B6E3DC89FE23C1C9C483DEAEC9BBD16D4C0BCCD12ED3A80A6613DFB7D8E3DB48603BD13082B3D8988353D53D4433D566B8EBDCF6584BDD7B6BD3CF5D5653C525DE9BB2F217D3DB0943DBDD0EE473A75F313BD3D388D3D50A80BBCDE2C9E3D47A99D3D9D3495BB57C9913D6789A03D702492BDAA81A7BC0A237D3CDB92383DEFB59BBDC929B53CD452FFBCAB44013DE4DC503C43BD2B3C03B6853C51707CBAE0BF023D502C6EBDBE149C3DFDCCA7BCB8AC54BDC253CCBC052AE63C3AC373BD67540ABD2A5C153D023B813DC503B13C0510A6BD269568BD10128A3D08C9753C353C6BBD6829963D0014163D5677043B474F39BDB5027F3860E8E63B7416B33B394097BDA9C82E3DFC3F553D525000BDF5DA26BD60665F3D8011A13D38A770BDAC00F73C95E09CBC171B323D0695913DDD4F5ABC6F5B59BD922806BD6D00573CE9E1163DA59B11BD3AD4323D8E6ADE3CC8259DBD3B83513D0CA02CBD09AB3EBD46F248BC1B885DBC62F7763DCF4902BD70248C3DC34271BB5C95873DE8739D3B81E2813D2104263DF54C813DBF3516BD48107DBD2773493DBC909CBCE2AA9B3AFA8795BD0697F33C940CDE3C4B245DBD5D693EBD590289BD4B18B7BC61293BBCCEB692BD64C2683BF7658A3D707EAEBC99026EBDC9359BBBC660473D690E653D722D733C1BC013BD8686403D6C560EBDFAF6393D3FC407BD2B9254BD5A389F3D67924EBB2ED08ABD047B1CBD4345A2BD56EA98BDB017813D4DCC9A3D8CBE84BD31EC90BDCC581CBDCC75873D8B84743D9948563CC0072B3D645882BCBF138A3D23CC24BDF4C396BD7CEC4CB8641BCCBBBDFC8DBC540EA73CF57D66BC65AE093D2BD7A83C43B2E93B40AAD4BCC6E68A3D934F6F3C2E08BE3917AC603D3A7C42BD0CCD853C6FC94FBDD236223D18EBA63CE06296BDBE4B693D8FEB963DE69EA6BCA90EF03C35B2593D5B0206BD737753BD8A8178BC1240A13C8744BABC3CF3E3BC42128DBD566E1EBC183C9F3DAB1E21BD9D38183DE3D7023D97DD413D128281BAACDE9FBCB5F4983D57872C3D94FAE33C435D3D3BF768093DA4E44F3D6B9C0ABDCB9C86BD1F764EBDA6791BBC3254643DB36A943D4D800E3C9B50513C68164B3CA29857BDAE9A7939C2772DB98C607CBDD6221ABDC467553D66B789BC94D098BD9CAB283C9513A8BC4E6FD9BB29E6863D55FA5D3C4BD41E3DB73C6BBD6AAED23B63D38A3CA233D6BC0B0C603D246C5BBC31EB923DE631A53B9B60333DAD28A0BC36347DBDE3552B3D37A48CBC84995FBD779D913DCBA3C23C721A903D3AF133BD66CC073B91596A3D7611A3BD0E48EDBC2FCC0E3DA0A3993D8F21ECBC49AF5BBDDFE09A3D5EF6823D9E5EED3C5F0FAF3C054E39BD4DC72ABD3A366BBD2475283DBCACA43DBA39703DC902C1BADBB8A23DE648E5BC92AA983D431BE33C45C967BD1979733D1E4B273DE9337DBCDFF74BBDB876DB3C94FE81BDDFB29E3DE9A38FBB7DA4D13CD55CCE3C2B188BBDA052893D44B7433D413443BC6DD09DBD87142D3D51CF873DEA3A8E3CAB227BBD586333BD3EE444BC4F36EB3B2AB1C83C045B4EBD0CB6703CF524B03C32FFBC3C5BBD753CED6E17BD8E6552BD2FB907BB0FD41BBDDF2CF7BCC537613D549016BD635EF03CFD989CBDE6EF29BD70F68EBC1DB6D33C8D232CBD6A72DC3B87CAA8BC473253BD13EF013BC0977ABCBE165C3D5C90633D3C258D3C0354DBBC77522EBDC3B6613DF6ED0C3DB5F3803DCC0D723DE8D634BCAC728A3D837093BDD417783D23104BBDE2DB9CBD81AE39BCAF73633D6C2F3EBD5FD2E83CEB1B68BB9D0BBA3CBFDD6ABD2AE780BD221A2E3DB64FA0BB303103BC58E6963DFF438C3C380EC13ACC970C3C7753033DBAB6D5BCD72B0BBDD41D203C497ECEBB8BC38E3D11899DBDA7DF91BD22B7D6BB4E94EFBC545A6B3D19CAA5BDC9EE71BD1AEDA2BD594C313D02E934BD279D8FBDAC91403DC5F9513DC2E1E3BBFBC23C3D17BF8DBD5A51063DCFD4953DA0F608BC70BD9A3C6CC89EBC1556F5BB186EB73B357E943C568953BDAAA2A7BCC174A5BDCD352C3D18439E3DE838283D7570093CBF62D63C808DA13C454893BDE846033DAFA3B83C19342DBC2541F6BC705687BDBFB48B3A50B831BB0C3ACC3B3E89A33D091A20BD75498CBCCE0EED3CD270693C93B18EBDBD694CBDF78E9DBD04FF7E3DD0F405BC377F403D055F85BDC5126A3D2953893D3C0F5EBBEA1DE73C86A932BDA9098BBDF6DE85BDA10D11BDE6106FBD60756F3DE7F7DC3C8A46F3BC5028523DF14C98BD47E78C3DC9C60FBDE7F2B63C252777BD8D789F3D0BF4993DB626C1BC711553BD6CF8EDBC0F9F823C066D363D7B6C8C3DA1D485BDB6FA11BD1152EB3C6D8A4ABD3C227CBD044195BCC92FE73BA5127D3D8AAC85BC8107233DB6A9DDBB44218A3CA8DC023C8125A53D2881A23CAC24213D8563883D7A4EFDBCEF37983C82F58BBD51C17B3DA02A4B3CFBBB2B3DFF75893DF973AFBB1F858DBD31464A3DE23D0B3D096E9D3D44FE3B3C77B7223D188A2ABDB1D2EBBC76939B3D3FC7F9BA4F7D4B3D6E79163C7E26573DCD5F4FBDDE4459BD610299BD62F42E3D9719913DB98F5CBD5E87BC3C8163C03C7C145A3CADD7EF3C8087783D19B01D3DBA00F3BAF445063B52F24E3DDD4C8CBC8FCDA13D2F1C43BDD22B0EBD505D133C6293F93B97FAB5BBBA82E2BC9DE85ABC81253DBC918F293D6952243C480BA638027157BDD209423D5BE8873D657AAB3C1ADA5CBC3C1CA5BD3BFCE8BC58EF3EBC05A022BC26AE583DFEC38DBCC341473DA2C8AEBC7FAB983D3A21C23C86CFD3BC70608C3C9AF788BD3B9E933D856E43B94F71343D6118D23C91401D3D7DBD1C3DE789F7BCC0747E3DFC02AABC09FB7EBDC9541A3DD1F600BDFE3612BD521A3F3D9BA07FBD407043BD3813623DCAFE9BBD56FB9EBDFE34813C948180BD9F5DA1BDB2F2A13DD2A56B3DA604E7BCDF667DBDCA7D923B9B422BBC949E693DD337193D1060A63C9F3EDCBC31FD3ABDA711483CFBCB90BD0B7259BDB92A853DE94FCF3C9B19903DFE84CBBCFCD94FBD8460A03D1C2484BDB48D743D2641FABB1A8C253D5CF39EBDD56F00BDE677013DE5EB98BD7391903D6980D73A2C4987BD40B07C3D7E4A6A3C51C053BC952898BD63E9F2BC7D24F1BCE29BAABAEA9E88BBFB608EBDAA795D3D3CE9813C267716BDCF2A153CDCEA92BD46D215BDFC062B3DBAAABABC8A5D96BD25CA803DDBAD7EBD97D697BDD9993D3CFF8B223C7B6A923D96EA6D3D3E629BBDDAE670BDE6FD68BDD4BC5CBD563F9F3DDE4B84BDBB7100BBA3866CBD4E5D763D14636ABD7F1B9C3D4E35263B21B3A3BD0B729CBC196B313C2802763DFA3FF63C13015ABD68CE99BD91300FBD6C8C94BC5CCF93BD07DD373AE393143D6AFC8CBD3BFA8BBDFF7590BC920FC93CF770F53CE8B9FABC839571BD8364613C246B273DBAA03FBC7D7F67BDB89EDE3B8CF66ABD61149F3C904C413DE56F5F3D3A7C21BDEE9373BD2FB811BD28FA80BDBA8EA2BD8FE6103DCAA7B0BA570C1A3D9681E4BC6245423DEF970C3D7F274DBD7B4992BD7363873D31CF75BDE303C33C501F493D2FCDC739011AD8BC7A77753DE945BBBB77D67B3D6D5974BCD4C99E3DA6687ABD2CD5AF3C36E6CD3CD4D0093DB77E9CBDFF3CB13C0135A1BD642D753CDE0C9EBD381083BD648C08BC6D20613D552102BDF51783BDF690423CB97130BDF8CB603DD74F1ABDC1FA3B3DFFD9063C28EC9F3CCE8F983CFC42163DDB28A23D4A6AB93BE83366BDC5E4913D5982C0BCFC36813C2968BC3CCDCE17BDA148AF3C2B6B123DD929823C02065DBDC6E3A7BD0C83A0BDE385113D29DB3EBD9A03543DF100833D409542BD6CADBD3CCF042C3DB821953DE1F6843D545D9F3C91E164BD048D32BCD01C833DFE17E5BC6457263D7B119CBDF3D4F63A2F461B3DF3D3933C4F7E4EBD5D90ADBB0DEF52BDD03F483DC609BD3C8FB45ABDB18A1DBC347C643D162C9BBDB2BEED397CC1163C39C756BCA8472EBD5D45DABBAB6D5E3D1E6A2DBD7B18D13C1C9D6CBD312E9FBC5B54A83BDD51123D1248F2BBCF91A73C5C1906BD124FA5BDB1B49DBD35522EBDB0F6C5BBC9BF8CBDA9835D3D5940303A37BA83BD123E30BC0E99683CD5F988BC2720F2B992C0A5BD0AB4913B379F19BD0E34A13DA929E33C445944BCF3D294BDD946993D67648B3CEBAFA03D74200F3D75B03BBB62C3C03C728980BD118F88BA3EEBE53C2711253DAF42EB3B5C44BBBC1F128DBDC73A60BD25A40ABDF5E3973C873C603DEFB85E3CE7EB75BD7543E03C21CE6CBD1319B03D68511FBD72580E3D4FF11ABD0AA8E9BBAC059DBD4FF431BD869581BD698C2CBDFAF2253D681553BD0EDF1BBD4DE383BC9210223D1904DD3CFD15A0BD2E0B213B9159DDBCB01E9BBB854296BC050BBEBC297BEDBB0BC023BD2FDBD03C839BECBC5AF02C3D5C036F3D711B6D3C8F1E7E3D880F4E3DC1EC8F3D6372863D262631BCB2CEA2BD45B5C13C98F12ABDFB17953D68CCB5BB7FF56A3D35A734BCE04B45BC4C36173D3E1385BC742D9FBD9F65BFBCE20287BD466C9FBDDEE55C3D2B78D2BC51FE143D1BA7B53C444F173DF9C814BD1CB32D3DAA098FBDD4A38BBD6596C2BC66E37B3D216B3EBDBF3794BD8FAC94BDD867913DB7C79D3D471283BACE81D1BC978F123DBCA704BC05F1EEBB1847A1BC36446FBD972E6C3DBA0A963D0589903D6C5E7FBD04AFF3BB0A4C3B3D219B0CBC7E199D3C6381F7BCB75D913DC38F88BD988E81BD43DD44BDDA4F883C45A3013D4A3E6DBDFD9607BD2802803D3F9384BDEA8A6ABD9181203CDF7931BDA0497A3CABD2993D3A3F2E3D205145BDD7E056BDFB3C773DD15F7EBDF90AD53CEC6E35BD443A18BB3604613D0D25823DCBEAF83B3F1B2D3DBB161FBCFE9B543DA64564BD80B7F0BC88AF2C3DF866D83C83CC653C286CD8BC50DF963C23E5223D72DA0ABB7DBC74BCC69A953D7AC285BCA81D7A3C3F48603DB005F5BB5368E33C0C54483DC4754ABD9037863D5308A2BD2C7C32BD2D5684BD5EFA813D8EFBA33CA3889DBC1A48B4BDC03521BD439B1B3D080227BD6E605FBC7B379F3DCEC1EBBC71A99B3D0283B63CFCCCF3BB252EA83D44E9833DD1F725BC63884EBCB88E9EBC3685D43C155F6F3C43D0E9BC65D096BCDFEE11BD2D538BBD03031B3DB14E84BD33D6933C18FDB2BD220AE33CFA74B03D84E43F3D276A703C9EA4E339EEB895BD6D3EEE3D3299843D4713F53CB62BB5BD0ABA64BD5CBCF63B76E721BD9489ACBCFB391FBD7DECC83CFBED8A3C257A8CBDD263DC3C1AE7A8BD8DCB70BDD8EDB83C4CB6A0BD58F21DBD1209B1BDF8423B3DFE68403C68D2B2BDDB55C13DD4FC3B3D2CBC12BD073D653D89852C3DB5A0A73D6FB67FBDD52D95BD11E0F03C0FE264BD4F26A0BD27F9463C7EF2A13D526D603D98AD483D12D2023CFB98783DB69BB8BC88DE033D59D7633D0A208ABCA8AFBEBD680E89BDAD6EFCB91FA000BD76F940BD932B923D87BD83BD83D5453D3A01C13D38892EBD4989523C4701543D142238BD5F6D273DAAB1CC3BDDFE8E3C4B32B23BA993B0BD1D0BB4BBAA9C20BD786D1E3D53F0533DDCE0943D5AE8703DED76223C899F83BDD8AACF3C189F88BD79F4873D2566453CBDB1D13C457001BDB7D0A7BD56B56C3C03DD4EBD99BFC1BDA310983D140743BDC8039CBD1731AC3D934ACE3D134ABA3C43BEE13C1CF1CA3BFA23723D905A883D7BAC143DC90024BD731F493C76D331BD2F19BC3C7BD1D53CFF639FBC53EEC3BC1E5585BD045885BD9D4EA5BDEFA7953C9811903D57CB823D439242BD8A3A833C87AE49BDBEF5F0BD8B726ABDDCAEB23C2045243D0F98983DCAEAAF3C2CB218BC6F551DBDCA4B8F3DB2A46CBCD604AC3C238ECBBC412F21BDC2CFB13C29224BBCDC5600BDC44BA1BDBA8E243D6893473DECF00D3D1ECB0B3D0282D63B7E69003CCA5F383C06CA31BC512F2C3DEACED63D01A3993BB208D2BDCB61A6BADEE6D8BBE60C6BBD781A84BD339C2A3D2A5B9FBBCF643C3CAFF1893DCA42BB3C2109663C11DEBB3CE590C43C4E66BEBD2F3EF13C43E688BC632F2B3D82EC2FBDCD91503DDC6ED7BC8BFC453C00D53A3DDD4A803DCE6310BCE4CE153D3B24153D8097053C602B51BD6854E03DC1BF733DBAAAABBD485102BD4E7E883D491314BD4B7D093D1A01213CEE355FBD64A07E3D01803D3B073BEEBDABB4FABC122A5FBDC486ED3CDEC111BDE556933D7AF0B33C065638BD8BAC3E3D7AA3513DB55727BB3E3DC73C390B73BD91B7B43D2E9FB23CC18D593B6213F3BCE031EBBDB47B333D2700BF3D7816AC3C33FB3D3DA8B19EBC96E0CE3CF15857BDE69EFEBC7D3EA0BD6A8A22BD9401AFBBB9E267BD32DFF13C9B9E6DBC5D389EBD77D2B9BC35978D3B411B0CBD022AE93C4976913CD445003DAFF8B03B987BE0BD76833BBDE88F88BD38FEC73DEDDAF93C03AC8C3CB08C35BD7829E0BDAF71EE3C70545EBCB5833F3C44CBC4BCF8793DBA8E48333CC2B28C3CADE504BD0A7A083D2820963B6E8052BDBC3F833D4B32013D644F01BEDB202DBD627C1A3D717DB73D9D7D9C3D0E0A1EBDE8CB82BDFCE7853D00CA4D3DE44B043D3C98A5BD637F01BBAFBEBEBC5DFBB03DAA478ABD738A003DEA19C8BC4C0F91BC826A03BD5A9D253DA7F281BD2C97BD3A34B10A3EA601903DA5C213BCA13358BD435696BCFB60D5BC768619BBAC7599BDD7F1E3BC71A031BDB1D5793D896E52BD194280BD7195DA3BBE01ABBD399DAD3D28C432BDFCF63DBDAD5BEA3C2352C5BC306633BCD320C9BA3BC4EABCC0EE92BD90CEE0BBC8CA733DFDD7913D5EE6AEBAEA3CCA3B1E228EBD0D62523C428E3CBDD8DC8B3D05E79B3D885F9A3C9612DEB968515D3CEF0E9C3D318D3BBC831A243BCAEA94BDC1409FBD02918D3DA2F38FBDE286023DCDC06BBDB5C5163BEEB85F3D61382EBDE002D5BDBBC2373DD415943DC1B9BEBC1FD78FBDFDC5003CA15EB2BD97270F3C871CF5BC7DDAC63D74243E3D920D07BC3520B1BC1D67FBBDE3B5CCBC4371DA3DD3743CBD6D20693D9C8E213D9DFA7E3D754391BD10FF3CBD5A3C4F3D65E95ABD86C234BBD2E091BBCC718ABCBD1737BD13E07ABDE4A8CDBD8EC31FBDE158463DD79594BD341BB4BDA3778D3DB100DB3C7951CABD3568F63CE43E5A3BF9CA8B3D5A0DC73D84C3813C1942E9BDBAB31ABD97CE3ABDCE5D0B3D05DFB1BD01751F3D4643D23BAB93C73D9748BABC8ABC4FBC6FF5BB3D30AFCFBC6BCDBDBCA9E3853D3F64213DA53AF6BB03EF56BDA9479FBD1428383D1BF4863D486108BD42AD5E3D4B9F843D66E498BDDFCA63BC750D82BD03BD51BC155869BDA279873DC7558BBD14C13ABD22AB323DE6C3753D82A3733CBFB4BC3CC915013DF8279C3D95F7AA3D02315C3DAAF6CF3C80A114BD05EF153D14F8ABBD6DBB5D3D0B4C8A3C323F3C3D9EF12B3DE8CBD63C33426FBDF6E82B3D03107EBD708184BC0367F8BCD900893C4B040FBD2EB045BD0A0855BCCE32653DF82277BD5F47B23DB9BB0C3D898A32BD47A269BDE6248C3D5768243DA34DE43B9DDC7ABDEFB155BC3F28A53D42300F3DAA55923DE4D884BCD53A703D9E45FD3BD3F5763D006244BD25BE23BDB3B3A53D67E59C3C02F1F23C8059803C962549BA53FBB6BC3A9A3EBD73E1443BAC1B623D4E94423D53382A3D7E1F80BDD371603D6CA8573D553F183C67620CBD587BA53D5003063D14128EBDABB5F53C420205BC007F3BBB3243EDBD3D650ABD4A62DC3C862195BD7831453D1B4C8C3CC050E0BCDFCD19BD90A8CABDA9AB17BC1D33AABCBA0CB83D0E4B4B3D8C57C2BCF2782D3BA61498BC813582BD6B9C36BDFF634ABC36DD1ABDCC7B23BD5294AA3D8FDA893D50CEA7BCC2FB743C6F0EC03D9ED4223D98F8F6BB8AF7443DC83B92BC77EFBABD4FDF63BDC9FF0CBD7F9D74BA2B95763DAA2A1D3DB388D83D10BCBD3C452153BD7D7DA73DBB0094BDFB0F64BB3FAE423DE2C21BBDF841523C78D9433DEC481D3DA6CF883DB3A3C73DDC9E223DDDD078BC73397FBD9FFA32BD822081BD2291943CAD5586BDF85D32BB3A2068BDC2A0533C7C12C0BD0EC17F3D97FFA33CEB1C943D57FC08BD4AF073BA75735E3C74FD9F3DBE9CD73CFE3B0D3D448EB6BDB8F7793DFA49113BED7C903DCE1D143DAB42BE3C7F4C9D3D1D6F20BD3705463D259DB73D0462FB3B30948DBD07F4EE3D5368BFBB8A89983D17D950BD086B8CBD9BECE73C68460ABDEE7FF53DCF54D8BC6ACFA0BBC4BF753D0D08E73D5CFA9CBD399E913C3629243D4416913CFF82F8BC475212BCDCF0D93C62918E3CBCBDB83DC6A0A1BC40BC203DF0FB373D3BDA1DBDE875B6BC226C7B3DE333E5BC70F9B3BC71A22ABD62B08D3CFC6F363D3253B93D76795D3DD90F22BD17EE713CD439B0BC505AF73C82700B3DF0C91ABD208CF4397C15873DE7C7BA3C4308F03CD1CB7BBD0FA946BDD82CCFBC232E03BE4437F5BC88F0733DC9B94F3D716C74BD69712BBD0E0B9D3CF8B5C1BDCDBEB53C7AD77ABDC070ABBD83F91B3D9001D4BCD124B9BC41D8DA3B2F90B03C8AE174BD3703B7BCF6F69ABDCA9FCF3DB0F234BD32CB873D9311BB3D84E60FBDEC56D43D8BDF37BD3D117CBD495161BC845787BD1C69D1BD980DDCBDD0E06CBCF80818BD7FD7B0BDF75EB5BC6B93C33C09E5223D09E8723C596D603D8858D63D0B1958BDFA4FF33C8DF0BBBBC579A1BDB16BF0BC0A08F7BC826F52BDBAC71BBD7424813D4798A3BD85EE673D672279BD9CA70D3DC1588C3DE7D50FBD0E9231BD86D79CBD71E55F3DCD21023C54DB10BD285798BDA18DAC39BB7090BD7C2D69BBCF9D7D3DA43CEC3D080D2E3E59F15ABD474C8ABDE65E9DBD0A0F543D9867F5BDAEBBE53DE9E2CBBC4832B3BC46FCFA3D600918BCFADBA2BDFE43C83D5506633D0C2726BD7165CC3CB7F4EABCEA39A93D5F5DD5BC1B3C67BCC168AEBDA41659BCCD68B83DE1E944BD47012A3DB69F953DD0AA3BBD905EFA3CEEF67EBDDA79BCBA0D33CD3B67D43F3C66A8713C438E233DF2E31C3D838D683D29A39FBD3364AB3D28EA993D3367703D019E963D42CDC73C642979BB83A074BC92A61C3DD0D60BBEEF28DD3C877CE0BC91B78EBCCC80AABDDF62D23A48C68B3DF7E3633DD93D7D3D5EC4D7BB2061C13C0566193CA8B284BD04D997BCB141063C160FD83BDE9B62BD6ED2CDBDCA79C5BCDC381E3CDAB6923D206047BCD75C843C6822E7BBCC2131BB98F4433C334F1A3DEE458E3B867A803D46AD39BD503DD53CA0BF1BBC61270FBDA97B33BD06321A3C47D9CABC0AAF893C36C1D5BD8035B93DCAB2143DB6D7CABCDA30A33D51C6E23DD099DABC7CFE313DC6135ABD4428123D3A249ABDF4D8E93C74588E3C905E3ABDDD66153D03E7BF3DAFF6ED3C3A2B97BD6136CBBDFB1CBB3C252B42BDD208493DE21B133D1ABCA5BC9569743D9607B3BD430B68BD4B2574BDB4B800BD45CCEDBDD38929BD288C653D72389ABD31FC183DE87EE1BC86A800BD1D393A3A46F71D3C1FFD6EBC75CB3BBD7E70C7BD30862E3D4A5D063D90153E3DAADAE23D688A3B3C2A8BDD3D1E9E24BD93A16EBDF88790BD6F91E33C83E4DCBD25EF573DA74C1CBD9B88B43C5D170BBB4FBD0ABD4AA4483DF142B5BCE7708A3D159FFABC4F40333D17248ABDF5FC03BD2E4210BD78DC4E3DA5941B3C81E58A3D9D910A3EB818923DEEF05EBD283F8DBD72BA0EBDEE4DFABA7A99E63CEDFB3F3DF456CBBC73D1633CDEDF253C9809D53D0051CB3DD30BF53C4EDD90BD926BC23DEC57ADBCA614143DF3704FBC927000BDA98D33BD132F48BD9705D9BCF7E7183CF57D6CBBD4D090BC208CC63C41CFBE3AC60E0CBCAE224A3D927CC4BC1F49593DA988C93DFE5D6DBD27DD85BB8221E1BB89DBA73C6882423DD9AF383C40760D3CD543A8BD52237DBD84C70D3E1EA2463C356ADABA8076A73D2744D8BCD358733D93B38ABD7D649D3CE040773D0B87803DB9B4833D394D03BCDE7C0EBD43D59A3DC5A387BDBDE4393DAF8A4B3D47B0473DAAE5353D8DA0A1BDC9338A3CABDFCEBBA268923D692E89BCD8729ABCB34D883A9BB8C3BCD6EB71BDB5112EBD94D7A83DA63A08BDD9AC4FBD6AB787BDE1DE513D46D3C9BD0B6F65BDDCA2A8BC1877A9BC356DABBD83F3AD3D6EC6C8BCBD0A03BD25B6103ED3F8103DF3D72D3D523103BEC19CBFBC5CE61ABD2ED643BD7E1E04BCF2FECEBD30518FBB8041873D5CAC0B3C016087BC28FCA7BC5CBA213D257DB4BD869E393D16F8063D6A9EC43CA0BEB13DAD7B363DFA9C953D2C7F363C7BB96FBD7260813DA77F453C999CD4BCC8AE72BB80C46B3D5B22903D9AF151BB329E953D7A29143D107EB3BC54D1C33D3007BE3D8FB8AEBC3E019B3D24E5AEBBA543B43C2934733D3C531A3DC56C393DE5D8413DC31A2A3D8DBD323D21DCD0BC166C70BC2211753C3E9A9CBD247E3FBC078E0BBDBA3A9D3C6C37F6BC078FBCBB474E4B3C460E143D9711373DD900103D0F0CE0BC2AE8AD3C37DD59BDE74DA23D85BC213CA0CD87BDB6C1903DE8E7BA3D1E91A63CEE4F6E3C9F4C7DBDFE0AC93D1BE4833D6D48B13D7B7880BD8CF7F8BC8F02A63DE6E0583BF6A93C3D7BD9B13C25B53EBD03DE09BE1A8096BDDFEAF93CB82EE33DBDE93CBDB6503F3CDB950FBD80B64BBA91112F3E3281953D07E7C5BB7BC266BC3CBF7C3DD6EDC23C4D3D26BD25AA15BD43E1653D55C018BDB94A1D3D96DF7C3DE54B0CBDFCF6A63CA117B2BC3B85513C56BAB63BCFEF38BD20F6803DD63B3FBD5E9FC33D7692383DA503B6BDDC9619BC763BCCBDC69A843D769755BB0FAF1E3D72C36ABC16C390BCFB1F8D3954D71D3DB9DDB2BC5BD4C03D616B92BDAD98643D7EC9733D399342BD193E88BD13FF50BD0F161E3E17EE623D8A6A723D9033F4BC933F8E3D7B100FBD62CB91BD311B073DEC454DBC22C39EBC1DAED83D68D8453E7DEE76BDDB38033E02EED13BC1041DBCD69B1DBD755E1CBCE67B52BD71CF5F3D5887F0BC1DCBA93D484FC7BCB707D6BDBD7DBE3A86CB14BDAACBB7BBDE4456BD7DC4F2BB4534133B6F8C7C3DB3441C3DAE4A1F3D22AE443D6510D33CB11EF73C4B0E923B5904A8BDE690D33B63198ABD2A14A53DAB9E4B3DF72374BDE84B183C2DDF683DE464C43D636035BD74C36FBCFDCF8B3D73783F3D2FFD19BDC29E9D3CCAC73F3D8B99093BE4236D3BB300CABB8EDE363DB9B0343D0BF8B93DE06C4A3D990F23BB574A1CBD667D8FBDDA3E243BCC639BBD423D27BCB0EB073E73E5B13D31C23A3DB74B1D3C33CDBF3D70BE313E69763E3D49AE4A3D053792BD1F19AF3D0E1F10BBAA89063D596A9F3D73D93ABCB84826BC2677283D2CD071BD8B93FC3D44AADDBC2A05BABD9ACBB7BCD3F53F3D1A44243E92F79FB985788FBC05104BBDC6CE563D4EBC7D3CE29AA13DF02EC13D97F8833D60A26ABDAF0E43BD85C0C93DD42E25BCBC64183D02C09BBD04DB38BD62BA973DCF2D90BDF36D2C3DF3AFA83CE19FE53D55D75C3BBE16603DCD33DCBB269F6CBDCD58F43CA8F413BD6C74263D2B9B2C3D1AF79CBD9A98B23D3219AF3DBFBCBBBD60ED643D8B30BCBD0D44303D3E64D43C5DF8A03D0922BA3C87543E3C317F373E667720BD5ECF223CC099F9BDED4AC3BCC10C92BD0A897ABC4D9F183DE72AC2BC98D6413D9722DE3C427D0B3EC9B279BDCEC0223D931DC4BC68AE5DBD790C5D3D5CF2A8BC407768BDFE29A63C6DEE18BD42956B3C0C99AE3B50E33EBD0BFB583D90013A3C98E0D43D043EB63D07E5A53DC484093DFF73883D513C38BDF50994BCD0B1853B924F0FBD8178BB3C728D86BD183BD7BB3FFE1FBDF54ADABD45F870BC46FC8D3D363A82BD084F613C42239B3CD2C45F3D678041BDD0D0983CDFD4713D2486BEBB6420263C911A943D845B00BD82E4343CB0AEFC3B6EAF4CBD74FD4EBC68BE563B0EC62B3D2363993C238EB8BD6334EA3CAC88BBBD2B1633BC38821E3A982EAF3D94A1F53C5FEA1F3E4914A83D3D148ABDE810AA3D824C263E022BB33C0BD8E3BCF76492BD1E55AE3DF89CE9BB04CCE73D023AB53DF3652BBDC78C99BD844F98BD4D7BB8BD0461F53D3CB00F3DA40604BD54A426BD3B11D73C73F2993C1318C43DEEA42BBD382DB93DCE0B003C4853933DF5E792BDB3B6CE3DE33D8B3D8B150C3CE8ED45BD8F15263D1FD77A3D5CDE91BDD1B31C3DAB04A0BDE9C57D3D97B0193D678E9F3CA5BE93BD1D3B99BD17B38E3D083B633D6A721ABD437BFE3D1A0180BDB6C8183D672730BD6E988C3DF57B15BC68FFB63D27CEB53C4EBAD93C217CA03D0FCFE33CB9220C3DC7D855BDFFD49DBC4517D0BDEC19CABD0EBD773DCDDA0BBD9E0EE13C7EA17DBD1830A33D7BDD03BDDFFB84BD0D82503D1A9985BCB8EE643D84C65E3D7013963CE901A2BC79DDD13DFD5F1D3D7E8B283C3A7CC03CB18A83BD578CC2BC4D3AFABB62F997BC03B8D63C9245D23CBE34E0BC4DCADA3DE560A03DD49C293D46439B3D63F217BD97F8853DECE8E43D90F8CB3CD2DEF33DBAA7A23CD89415BD4C26AFBCDAC0F6BCDF0AD6BC9EE66BBD0667CFBB0388A93DCC53BD3D430C243D0E22EE3B47A3103D39D5AA3DCF81DABD08602ABB13A2C73D8CF44CBD32B099BDE5597ABDAF49CD3D33D6283D4E6A83BD0E85A4BDC15F2BBD5A3618BDCCFAC33C7541F53C0C59563D0DCFA73D2F5FE23C0DF5E43BD52169BBA458EF3AE0D3D23D0550073EBBAE353D2A3F5ABD3A3B28BCB7C65ABD9A7B3D3C7AA312BD0F567EBD6D31143C400EAE3D2482963C9B0326BCA71192BD8FB82F3C5C9E86BDB9F3BBBC3DECC0BC64A4A63DC4B8883D63471BBDD7F798394ADA6ABC9B1D71BB1AE8973D73992BBD6F50C73DE98516BD6C12063D7CA6043E6A44A83DE15688BD4043433D4F0DE5BA8D5B8DBD78AE473DE7A6A8BC7D53E33C471E393C02382B3D35E2323DB3CF2ABDA60FAEBD146C8C3D0379C83DF30F2ABD4742C03D0DBC55BC02A088BD2D3B833D2C48FE3C329E153DA2BB913DFAB38E3D66C0C23DDFDF953D96B794BD88B8F73CFFF090BD54D8A93D5E9B18BDE3B3C9BD5541083D6840B3BD2BEEC0BD9C1295BCA51A243D0DA857BD92158EBD9B35243DE0112EBD79ED933DAEC84BBD969F34BD354CB8BD8085EE3DFFDFFABCD6E5FBBC236B4E3A5DC2623C4258693DFC3F6C3D5F75633CF8E3A3BC2C687BBC1D0932BCCA9107BDFE9452BDEC4BA53D4B04483D1FD6A93DD2583CBD1B9D823C83E8353DBA5C8B3D607BA2BDD9CD5CBCE3C264BC93E3D6BC97AA30BD8DB871BD6D61013D029CF03D23BE983DE8C04C3CC828443D2F41ED3C5B7081BBF6FADBBC99550EBD26FF083EFA82773CB291243D3992293D405BCA3DA74832BC0B2F6E3D1C56533C5BBB2BBDE011783C9D62A73D8ED354BDAC860FBDB086663D31D8013DC2F8EABC69B5D93BAA1837BCA276233B20DD2F3D2847B73C044384BD72D0AABB77CBD53C516C873B614D7A3CC6040DBEF7D830BD9977FE3CBAFCD6BCB546A2BC3FC1623D15FCC03DAA209CBC73CE373DEFB8283DDBAF5D3DC60138BDBE8FAC3CCE7B2DBD44DEC7BD0946E3BB5B0C963D49E05ABDCCF737BCB6ECAC3C34CEFE3C7EDD363C3221793BBB201CBD3327273C24776E3D44BA2A3CF23244BD7857393BD1B6593D35F253BD6693353DDE97733D328AEFB8E9E8BF3B4867E43D7F94003E3AF3AA3BD24BFE3D8F7515BD170FC83D9C39DA3CD05CDD3CCFB480BD4B2A71BC1371F2BAE1789C3DFDA1143DD73224BD8BEBBA3C8DAC88BCDB6C683D259BCD3BF0B18BBDFBD8A4BD78A8FF3C3125173D80FD31BDE9D0053DFEC2EABD5CF8A23D9BEAD43C2B5E473DCE43373DE428C6BD350290BDACEC8EBD8EE0FD3C887F28BD393788BC0CE087BA0689B73CD5F738BC6FE937BB0A874EBD6BEF853C070A0D3DAC308A3BB7AEBBBC1B12FE3C84504C3D8F058CBDFC96293D4FBCBCBDD867DC3C2FA87BBD1376353D8AA8603DB7A21EBC146E05BCF28A9F3D721534BD507748BD20E0503CBC95DB3D7B029C3D4C395FBC4C15013DB45D153CFBDCE23B86B5463DBFB3173C952AC63CC11393BD1E2C34BDB51EB13DE64F1ABCAE79AABC97B3563CBAD65F3D6142C33D32A93CBC92521CBDFD0217BBD842D0BD89F3B2BDADD4543DA329403D077B2D3C0DAA2E3DCF061B3D3E35AC3C228F7F3D30D2973BBA4E99BC8277D1BD4DD596BD48F217BC5F45F7BD5F951B3C3D61193C8BE3BBBC4CA3A13C867B7A3D2D5B643DCA7E29BD55460EBD9A81D83C62C6633DF15179BCD9117EBC1CFA46BD3D3480BD270913BD6E1F703DFC7B19BD49D1D43D7646A8BCAF8D573C29777B3B14560D3C7EA5893DACE84E3D997A443D26579ABDAAEBA63DEC8E4DBD2F6C89BD61911E3DEE066FBD6E7F60BDF9D6A1BC6886103C1F9D853D7DCB553D4402943C420E073EF8645CBCC4409C3D643034BC3776AABC3445CD3B0BEEECBC0EA49EBD5456F93D80A0BFBDA25C4A3DC4A35CBDE28F70BD66B15A3DE2E4E3BC1884CCBD8565953CA3E6593B162A8D3CC53A61BDEBC4DE3D0AEE9DBD0E5DA53AEFD0EFBCA772243DE3F207BDCAE925BD194202BE27D6C5BDEBB088BD04DE513C884DC6BDE16F953C3971773DD10880BC0430693CCAB6523C236D6D3DC18F913D052AB03C57E1473D5E1981BB3DDC9E3C4F3F6DBDD0D531BDF60D2D3C7A942CBB498055BD217C49BD3AFEB6BC58FF0ABD043EC3BDE59E83BD9EDA4BBD21CC783D89A8803CF96BFA3D97F2BB3C25759EBCD0D342BD936699BD17E204BE133E943C3DDB1BBC7103843DD1821CBDE3F55E3DF81A773DDDCF7C3D209A6F3D913E4A3C6A4CD73DC40BE33BED01843DDAAD97BDE5EC2A3B29C9693C0CD22A3D7691D13DB2D675BD49668F3C29FA96BDA5C3B83D0C8344BDBE9E53BDBCA128BD5DE7AABC0ECA9EBC984F553B820D0D3B4CA1213C2E87CD3C21309BBCF1C7123D2CE6593D6099E83CAE7FF23D9F520CBD3174303D51A5363D88491ABD8EB0BC3D09B35C3DB91C373D270330BC95081DBD8864B8BC0B4D903DABDCB73DAD6513BD10DFD63C0DBE513C7CE006BC963F2ABD87C8193DF6255FBDBA3B933D013B9D3C7F8EDABCEBD8A23D40FBB3BD8BE9A4BD0D04F6BCEFF4E4BC97A474BDF95B50BDB6D056BBC8CB7C3D62A5C03D527024BC0B6C6B3DC9C74B3D65709EBCE5753EBDFCB1A4383BEF0D3D5CE3FB3D28B27D3CE93EF8BC824B763DAD3F83BDBC39123CE08D5F3D2F20E83CB2EDF93CA794073DC78D2ABD3F5C2EBC65CD9D3CAEC8433C98FED0BD8F47493B957FCD3D1B81F23CBFEDDC3B36CE5F3CBC64823C7E6D2BBD2EAF713D2ED483BDC4D58BBB7EFA9D3CFFAB523D82FDAB3D483D51BC0BF25E3C5AA15CBCB9497F3D04495DBB03C7F9BCFB0E863D1CF9AFBC6B7DA6BDC10CA3BC027532BCDF9E8FBD800143BC5875453D7EF293BDFA0EC0BDDA632A3D1758333DC38908BDBCA21A3D7783AD3D58319B3C241C8CBDE6950ABD92C192BDE12099BDF6AD363B2703D73CF7DD8BBC642B30BBF78E55BD1F3A983D4BEC913DB9160A3D553ACC3D1C48D6BC4477B83D348FA6BC337151BD5FC7763A028DB9BCC3DA293D683323BD1255813DEDB544BDF4A10EBDFF58653C2BC6B03CDF0556BDED6A6B3AEC0674BC718989BD60A4E63CE4890B3D03229EBB394C8CBC87CF893D3FE520BD4B35FD3C5F8405BC6582AE3CEB5011BC5E9A9EBD3733933D3F7F893D9D65B23B4AC352BD2F8D24BDC2C347BD229013BDC6698F3C6F5B1F3D826B513D061C1F3D528D76BD376215B923DF8ABC7907DB3CDFE8CA3CC70336BD26EEA13B44599BBCF0658BBD571D593DC91441BDCF2A973CC8A9933C85B308BD250A51BDAAE3FA3CBF70793D93C445BDCEA1853C824497BCE4179F3D0E446DBD885C763CC4F00C3DDF23B9BB4FCC66BD5193D53DF5EFE0BD2A6BDB3C8167A13CB46188BD38ADDC3C784E5F3A0B25C93CEC9D12BCD067A33D6DEE3D3CAF975E3C05FD81BDF564A1BD89EBB6BCBDF44BBD8D9BCE3DEC64C13C4474E9BCE73EFABDB811BEBD1D87123C2C2DDC3D567B483D1AD4973D76F8533DD067313DB63AAF3CA52243BDC72A9F3BF494043D7E990D3D540273BD7BE76DBD9807DF3D8D6685BCFBACF93BDB3F94BDF136AEBBCA0A483DC69502BB5D49D7BA3DE7BDBD03B378BD748B55BD99F747BD7AD01ABD252797BD487A4B3D49ED9CBD714C7B3DF4254F3C1476CD3B8F7EAB3C79D0893D344D71BD2D94763D7196643D563D9B3AC4CB193D7FE84B3DAEA3A93B4E0E36BD2B29CD3D5B5B69BC331A34BD550E173C1F46553D93FFC5BC5F0ED23C9EBA33BD2BF52C3D07C0233DC8DEB93B3863B33DA4BD7CBDDF709A3C673986BDE37834BD66148C3CC48C56BC7A6D5FBDE6E4343DEF669D3D53843BBD3016C0BBE1A92C3D3D9C623D74B5103EC0823F3D8E31CBBCE9FF88BDB110A13D583312BDF47C013CCD91063CF227DEBCD02F86BD3B67AB39D933D13CF3C368BDCB29D4BCEE9F3CBDFFD110BD52A9AFBDBBCAE3B9B301193D61A587BDB3E5673CF9B55B3DD3F0633D5B294B3D42660F3D04EB783DBE9CE0BA54CC1ABD99AD1BBD50FB7B3DB687993D726B0E3CA6C4963D668F8EBDA5D7043D1347B9BDD7B298BDCA8E133A8F2B67BD0FB420BD4CC8C53C8CB8E73CE5B2833DE6B5DCBD6CCF88BD16450DBD656FAB3D7DB133BD6B73ACBC2F742FBD0DBFFC3CF45C973D7469A0BDC773073D9DA5F1BCB2F41CBDD785F93D04CB63BC3A4A3CBD95E0E4BC44A4F4BB3573AFBD6E29CD3DFCEE22BCD658A73D70FEE13C3CBD9DBD95FF013C860694BDD5042BBB2085373DA634543D4F6116BD241B89BCE2FF833B7A0556BB7B2313BD991B22BD538B423DB6975C3D11A5C4BD51A2FEBCAE4355BD402D0C3DE1D886BD0F9849BD99F189BD7A56803D033CD4BCDAFFF1BD195BC03C38EA623D1D17CCBB3385FB3A6A1459BCFBDB81BA018C373C560738BD8C5356BD4BAA03BB88B157BCB5FA103D46DF85BD32E938BCE76F47BD19C816BD301EAC3CFB51A7BD9FBE0BBD9988C93CFA0188BD4012893D41C6803DCB87ECBC20A0053D7855E73C18C7D7BD9AD8993DA851DABC436965BC67DC9E3D85BE2CBDF453863DE6C301BD65D9033DF54D73BDA7B08B3DE57A82BC4FEC1B3D730F55BDF28C653D6DBBBC3C2F4AEF398ED4C83D20A1723D0005C43D74A3F33C7E74A0BD9ED1583D206ED9BC2BEBEDBB2D59803D72F6A63DE9DD853D3C118F3CBC07B1BC1AD663BDF1B4FFBC6D2D9FBDE0E1D4BC7E3577BD9156863C2BF8C63D6B42DFBC7C2B55BDB514293C6C39D0BC04D583BC5C632D3D620991BC28CE123C26E7A1BD1829CBBC5A8DAEBD773CBEBCF0FD25BD15E6053D46A18ABD479963BD62AB3C3D71458BBD1BB4D3BC8B238BBD63349EBC65370C3DBBA0883D77C29A3B8BAAEBBCE93C1A3D4145C4BC9BE893BDAB36AE3DDC25E1BD86837A3D3D6A8BBC17437EBDEE7C913C4B2E05BCC242913BB6CF8ABDA5E8703D829034BACBD2353DA7BB00BDA0259C3DD20F353DACCA9ABD750F80BD2B2D4B3C95A1C93DA8BC013DEC6EED3AEB27B6BC1DBF103D1C3B15BD2389BCBB2AD4F7B858F5333D9B9AAA3CFCB5A3BC64F390BBB1AD51BB6CE0233D4547AA3D0263A43D909DFD3C380E5D3D27301ABD0DC6763DB835B9BD06E6D83CE2332F3D58BDC93DB1FB90BD0CBE4FBDCBA32FBD62367C3D337385BD99CFC73D9BC6813CF91C353D150A1CBD592AAC3D340B02BC642F263D94672ABD9AF8C8BC3D799A3B39A539BD25CFA2BB96F065BD7B0E943DB82D793D3BB530BDBDDC13BCE7F675BD882A8EBD39C090BA6648A93C8358A6BD498B2CBDDCF5CE3C4F764CBC6127AABD1DC36E3C24B98ABD38106E3DD3AA473D1142B8BB444AB5BC87B10DBA31779DBC9B68823DA84D413DCB72933D6CEC14BC4213123D7755B4BDBB525A3DD60EA7BD4F05593DF35B9FBD05D67CBD771B86BD07DD4CBDD59D3ABDB17526BDD31F8FBB9AD6483D4EC096BDB31027BD3578CC3D9922FABC1D1133BD567C723D3E95AFBD6F5625BD72DEB63C19E513BDE09D80BDEBFFA03BF96594BD48302E3D61CE8FBD8C43893C6FC05B3DE87330BD80C79B3CE74E913A5B1578BDB157B63C0AE9B63C4D1C33BD00ACB53CFC022ABD048244BCEB5B98BD39E08A3C3F9D503BB429763B963CC2BDD17A7B3D02981DBD01BA8DBDA9DFBABDEDD8EDBA0411B23C490B90BC21516CBC67A15DBDA99903BD722CDBBB47F68FBD1FFB743BA0C183BDC2911F3D89007D3CC5667EBD6FD0573CF273013DA9ED63BC132E91BD978E7CBD70CB39BD8191B6BD3C351ABD9A53B2BD619E58BCC0318CBDEE10C2BDFFD9863DA764F63C3DEA853C8439B2BC82B00B3C75EA8E3CD5CA773CA01A17BC0EFD5EBCABAE30BDC365D43CF5784A3D323CDDBC7390883DF2E0113D707CFEBB03C6073D7799443DEFF156BD811ECFBB38734B3C1C6B98BC2F8E93BDC34C033DCC46E93C3B8130BD489D763DBA0E513D36AFA3BD3A5B453D29E682BC5ABF8A3CCFC7B3BD7120CB3AB4833C3BAEA9CFBCEE079DBDC5239BBD37846DBB134CCABCAEFB163D46755FBD7505AABDD45B00BD9A4A19BDEF42633D9F50723D5B5294BD86EC90BCE0489F3DD3B7933D92C9B03D65AA753D24FFC1BC677E3BBD0A85603C3452CEBCE6B431BD3E1416BD2FBDDA3A68C1C03CA79D71BDAFEE3DBDE6318D3CA941953DC23C903DFFE7603D7C0F803DEF22BE3D5A7C393D3E73CFBC19B2FEBC384CC33DEF8D89BDEBC5D63CC1A0963C5BFD4B3D98C53C3DF97E5E3D85A7533C94C8883D9CC3653D75FA67BD39B7EEBC040B0BBBCC2A763D0F0AA53D80428B3A0050183B22BC803D74993FBD7C51E83CA19DD1BB3AE0A13BCDCE8BBD00FDEABBD6D28BBDF31D9A3DE47AB1BCA47DBC3DA3005BBD4311893DA546F9BC475E2C3A9C9B853D9B2496BD43695BBC724A96BD355590BC4213783D798C14BDFA65B43D1609B3BD874369BDE33058BD148D41BD90C28DBDE39E7FBD003D4BBDA16B5B3DFC0EBE3CAD1493BC3B21AFBD3BB8ECBC75D603BDDEB30C3D96C6AB3B4A2C113D7F92BBBC9DEE3ABDB898A5BDD5A05CBD0F7343BDB7A199BDA02FFE3B646F0F3D7EAE6E3DCCA749BDA43589BD3EBD8BBB050E043C4E6D793D94268EBD785B75BD11F7663D5EC45A3D55F08CBDD40C61BDA3CD843CE9CD59BD07D1673CB4E69EBCC0C3F13B01A430BDF7FE113AAF33F73C78F31ABD3CE2E8BB55EEAC3D9364903D204962BD529839BD68CC09BD9D1B2EBDD8C5133DD6DD6F3D068F1DBAFCD969BD11FF483D5BFEDEBD3A0DB7BD049AE6BCBA8A9F3DC1A721BD000F923CB57122BC8E97EE3A7EB703BDEA64493CFCD546BD74844FBD89F7973CB0E79FBD422D3A3DE1E0453CE5E8A53DA78DB43B2DC8963DFD1478BCA8FBFCBCCE35973DD7D6063D544983BDE3D5B43C2152AE3DA57BF83AC32C3ABD6CDB0FBCB43899BD64F1A63DA9E7213CF401B6BC6483A0BD7AA27B3D5E1FDC3BFB8DB63C71E90A3DA76C6EBD4B6363BD70E8993C8196ABBB13C6DC3CED898CBD3FBB373DF18722BDBF50893D652B973DF90290BC3E5D2ABBC0DA59BCCD7A833D3070413D4D1AEDBCFFAEA6BD980BB53D7C4F89BDEE1496BD15C4AE3D10A242BD7FCF96BD4969C2B8DD69FCBCBFAF62BDEF875DBCE2DA13BCD9D489BD53A2B9BC7661093B0875F73CCB6E97BC27B989BD157F87BD5800013DC3A657BCDE87CBBC3F0A0F3B7CC85C3D1935C5BC2DF2853C77E84DBDE0DC53BD81C388BDE782323D24DBA5BDC37706BBFE4F393D17CEDCBC560C40BD49098A3D975EF4BCEAAC2BBBADB3AEBDDF90183D5F07EB3B69A298BCD78048BD232F82BC6220BDBCBAFD603D467F533D95E1A33DE5315BBD867D42BD52D35C3D7C60B63C6677973C4BA6A43CB118423C5420D6BC0EC974BC4834C13B7F4339BDA1FB303CA8A612BD45375DBDDA474DBCAE9C5D3B6D670ABD927A9EBC9F1B52BDC131CFBCA73394BCBBC8A03DB35546BDE7C8D9BCAD3FA1BC50AE84BD3A037BBDC6F083BDB11DEA3CBC132DBD70F1A13D97CD5FBC155A843B9B58F53C50C04E3D1269C7BCF641CCBC29DE9C3D815A903DE225533D8F38EA3B640E34BCE3F4F2BBBA982D3D28838D3DE391233DFA0198BD53BD44BD6859433D2BA3443D751CD5BC3703B2BBAD7C09BD402A95BC4B408F3DCDC3EA3C6302133C88B58D3DFDCAB6BCE4DF973C1A8F173DEFA5203DB9D57E3C53CD71BD86228CBDF2B7933D7121313DCAA08D3D9D3AAE3DD02ED7BCC1B49B3BA0A551BD8D96ACBCA047B1BC78B591BD029756BD3CD2933B4CF00E3DA4A80D3D5AAC76BDBE87BE3B85C6CE3BEAF75B3DFDDC583DF21D443DB72F253CB506473BC650FF3B6F7315BD7B3B693DA6C3B1BC8348823DE51917BDAD0DC83C423DB43B68F050BDDBE1D2BCBECC923C29130D3DBFAC0DBD29CDA43DE2F023BD76B20EBCF9270E3D1D860F3D96157B3DF58699BDBED495BD053AC43CF7622E3C186830BD4B0C8E3DFE310C3D8EF29BBC6733953C4FEE353D4059B73BD86196BDE1B192BDA4DE89BD816B1ABCB58F8CBD15494F3DCBEE453B0D1A21BDBDDDACBD984C90BD0FAB823D67B483BD95D290BD4DEA673B22146CBD17D663BDF04D0EBCF0638EBD5E4C8DBDC8FE4D3D1D09B7BC736491BD65F5113B6ABA22BCF495983AF176663D4E8191BD0119EF3C751A9D3D3D70383C4CCCE43A14E741BC29268DBDAFA94F3D561365BD7094C3BCC17C1DBD7143493BD1BF3F3DD0724B3D17C6F43B7E7C39BC421E913D39BD683D08D7FB3C8C4598BD39A59E3D2243D13CFE228BBDC0A0933D382E3DBC38CE70BD7933EE3C07C6A3BA48BFE9BB56D592BDA1D33EBD4679473D59CA2A3D6118B9BCFBFC4D3DD81802BDF8F7293D80F90C3DECE9693D9F9B90BDA3B9FD3C312B5BBD9B614DBC7B46913CC1F59CBCCAD50BBD4CE8EFBB818869BD9CDE44BDF48587BC33D90A3DB14A0D3D121B403C5593E6BCB0C74ABD795E4ABDDB4ECBB93E4089BDC9A4023DE7E8963DB36282BDF84785BDB10D823C24119F3CD9E6E03C3F0D6B3CDE54253DDE4E5B3DEEBBCA3B7DF904BD041859BDD1E5E4BA00195A3DC3BECEBB10EDC3BC39FD0EBCF261D23C0A0659BDD4C6C3BC596C233DEC9672BD850076BD6A47D2BCCDF15FBCDAC6913D70537BBC4744843DE1E274BCAB99C1BC63FAA23DFD3F803D582B553DD94D0E3C1F86D3BCA9C71F3DCDCCCCBB0A2624BDF1FB473D57739FBD4485653C8329A03D41B17EBDC41D903D5E1BCD3CF92788BD2D2961BDE47E173C3F94453D3F79C73CB1693B3D468091BD5A25ACBC7335043D974FD1BC80FD2B3D0918093D487D2EBB47D7CB3C679FA2BD8D1373BD633F2B3DFFF2DE3C08EB64BD3003A43D1ED8793D71E5163D7E8F7BBDDE33753AA811813D59A4703DBE702B3CACAA5B3D15BFDABCA9FF383CE8BF153D25FF9E3AC78F623DFF8366BDDB9198BDECD95D3D4C37E8BBEEB2923DB0D362BDB38FBBBB8CD62F3D20D449BC766E93BCC5C37E3DF448F83C9CA114BD119A9D3D92A6683C323728BD29BDA13DD374E5BC1BEE0E3D6D3D5CBD2C3382BD23AC9E3D80EF64BADBAA96BDA3739E3DEA4DD73CB0D3483C95959DBC1C74E43C62EF52BDFBF9483A421D493D2B162B3DD909AD3C3FD3283CDAAA21BD2F1C8DBDD4008E3D78B6863DCCFB083D1C5BA0BCBBF0063C3A485E3DE57C873D2415D83C71D5A43D48C47F3C25F0533D3872A0BDAAFF293D653A883DFCCE8C3D6F629E3D3327613D27E9713D12BB8ABD52C467BD0A4051BB8A3D323C54E0F0BC24F58CBD5185193B00F0033AA030A03D64DD40BC8009093D434852BD47AC92BC9F4575BCCBCDE5BC09979E3DB9BE4ABD8D8512B96552C83B281A48BDA546643B8637973DDA2AA13D34B592BCF72770BDEEF99CBC4054FABC078A1EBD72F35B3C74336CBD2E9490BD0FBD133C925A94BD452A0ABD32F96A3D9C0C963D2D9C12BDD20684BDD6AD8CBD6543A63A3E6084BD2918263D101487BBEC6850BDF29A8F3D4098C33B11BFD2BC517A8D3D7028E43B03573A3D64B9003DC5758FBCA38F0F3DE9AD89BDB5F11EBD2626AC3C1874E5BCBD03323DFDC40CBC6054F93C279784BDCB7B74BC190FFA3B07FBF53CEB4B8FBDB46808BD87B4A33D2038043B7CAAF8BC115E87BDD90D24BD02C454BDDF1A673D4C53EA3C2A0D90BD5AA6CE3C78B5DA3CBB27F9BC3A18D43CA6939DBDBF76033D1ABCB9BBB6F272BD1DE061BC91AB8EBD30410F3B440EE9BC7B89313D3CD7293D7184D63CB3B6D1BBC64C84BD988A633D32DB673D4A1733BD0EDA5CBDB7162DBC2C5954BDEB1518BDABA3D73C16F68DBD34C24EBCAEA4D33C0AD5F93CCEB2A03CCDCC2EBDE14A303D5CF3653DD97F59BD4E70BFBC67FF3A3DB2439C3CAD83D73C41EA383C284445BD634CD03C7D463ABDDA1F6A3D3AAA793DC37BA43CA4FC4D3DE1056B3DFAB5773B53FA1FBD76FB46BD867A0F3B81FEA3BD30C18CBD266F6CBDDDAF003D0D5FA33DEA8C073D491ECA3BC28FA0BD70A593BC3C70BDBB4B979EBD49EC06BD51716B3C0BB96ABC2596313D8D5F22BD168AD23A19EE253DDD924EBD5EBF033CF43D6C3D844973BC7E878D3C6EA821BD29EDECBC3BB59B3CF77B223D0B4B05BCBCC1493DBBC319BDDFA2473DCAB2363D5F1A6B3C1BC2CBBC542587BD1E3095BCD0EB7C3DEE96A1BD00CA35BC6BCF53BC930F563D982BF03CBCF9893D3D030B3D2CDE02BDA54EED3C5A183BBCCA3F8A3DCFB16F3D8A7E733DBCF4523D196D80BD68016A3C9DFA013D9041583D34D6263D38789BBC7D01D0BC6B3D963D3ACA253D2C66743DD7DA93BD1D1A893DA78A533D0A15133D401E9F3DD15A9EBD512A8DBD596D7ABDED441EBD6EE1D63BA556213D6F32443DD4445A3DE4170A3DB761B23CABBC7BBCA7CB88BC93ADA9BB903FA3BD095EDBBB1739A1BD6AE4C63BE8A6A73C8C41A53DEAFA82BDF380633B30DF303C273175BD1498A73DDDFA813C6362D63A4C1D993DC2C7633DD4AA943D310B583D7C8C463BCDCF993D5CE16FBD4C8B8C3DEEAFA8BC0E8AB33CCB9A23BBB71329BD2CD879BC55DC263D0FB04CBD0258943D96E5663DDDE7883CA996653DAFA58BBB6936C33C6FFCA53DA5B51E3D52D45A3D50CDA3BD91D4AB3CFBA49E3C9752163D88858F3C1D89693C5453DB3BA3DF8B3DF7826F3D1326D9BB56E457BD916062BD90B29A3D27CCA43D68414ABCB4DE58BC3D6966BDA03DD0BB2934513DBAE5D0BB184D84BD8AC48ABDA046023D735545BDFEAFDC3C1A069C3D6E06423DC3D16CBD0A983CBD885B85BD8A4D453C82EF3D3C1D56A83DF9131CBD37D9063D79F308BDC10B99BD4C62603CE2E31D3D6228353DEC881C3C8A74763CD89DB63C8C22933CF0FB843D94DCC2BCDE33BD3CCD4F3DBC4BEB72BDD397D23CCFFD46BC9B94813D92A7B33C511182BD66FD98BD353ADABC60B1103D1C88A3BD53AC4ABD38E9093D6B59453DB277313D325112BD8AF38ABD4EFD2ABDD4A5833D76C27A3CF0A1903C622F6ABDA4209D3C51124CBDCFB310BCB6A339BD85AE65BD9BBE9DBD459017BB87FC123DC7A5CB3C43B85CBD388D283D71CA533C7C2C583DF961FF3CE3ED843D454D93BDC413F8BC220C88BD7A755EBC7E1C8A3CAB5D823D188C3D3C55EAE4BC00109B3D77DA9C3C20E4B2BC7E31513D8E3A913DD75C9F3D098A8CBDD62CB4BC763F04BD351D273D3FA48A3D504F393DD0DA2BBD2E08193DC06525BDCD2790BD0C803A3DD13C5A3D3D7C4DBACAF79CBB0305A13D60EBFBBAA02C2CBD6A01D93C85A098BDCA0D67BC3A554ABD51A28C3D8ED1853D462C9B3BE315A6BDBCBA93BD1ADFF33CBA716C3D8CC90E3C26485F3DC1C8F6BB533585BD062D893D7850E03C10A796BDB8F08E3D5172813DF86D8EBC89FDF63C32F0853DDF314EBD2A4638BD9D982BBD50841B3D5047D53CC2681ABCB062CCBC1F46723D1548863DE0A586BC7F5FD3BC8B682C3DA8E78E3CFA8F70BD0C84413DF7B1BA3B2D2A203B4F974D3DB4B5E13C0D8995BD5B33983DE940C9BBFBB4783DCC6103BDD0A965BD94DB54BC823F43BD2CADE43CA2964B3D2EBC873CAA2F01BD31406F3CD52308BD5556563DBCF8713D1AB91D3D70D3423D9BA678BDD45E8D3D754914BC21F461BDD14303BD3CEA24BD56A26D3DF8EF94BC923BDC3BFAAB3B3BAFC93F3DDABB353CEDC485BDC25100BD11BA87BC2C75883D82AB303B2A5DBEBBA94060BDB46A953D9E0504BC79F6E1BC1FD43DBDEA61FCBCB54A45BC781867BD5E43BABBBFAC30BD257E333C26B531BDD8B615BCA7EF0D3DB0FD943D54486A3D71815B3DB440DDBC41649DBD5E06CD3B729C843D21E164BD85FB3CBD191D943CB7B47FBD0D4863BC894226BB5E12BC3CE4608FBD5AEF123D6AC88F3DF7901FBD40F81E3D0AEBA93C0EDC7C3DC52DE0BCB4064EBD4CBA673CE8868B3DCAF48BBC5C8489BD71F942BCC04005BD005892BC1A7F723DA7471A3A950F9A3CFE21193D8D1AD2BBE51C6ABC44BC49BD80184D3D4729C83B4519BCBC88806B3D1FB6293DFC6F733C637A5F3D2A45BBBBE20665BD533EA8BCDD50BF3CF108AB3D052C18BC6C77C53B8F33933D61830B3CE4C25CBD220A3BBD8BE0B03D41D26F3DDA6ACB3C15C79339DA4C933DB0D0A13B0850D63CBE1799BDCB699A3D94D02FBD14E4F73C2D678FBD76E439BDB50CAA3D000F883A3355D73C387D4EBDE28B2ABDAC4B973DDE04DF3C2B3BA4BD6D835CBD42A99DBBE68F143D9A2498BCE54650BDC8C6BB3BA77A663BF38E8BBDAE9ADC3C2078A6BD4B9C71BD7F98BFBC4B5548BD7ED44A3D15E8703D3C8F073DD09EA2BC0989A8BDBF8B4BBD7234593DA100863DD4C23ABD511B943CE51890BD60833ABD4E4491BDD69750BD80D3C2BAA816A9BD9EBD72BD9C6EDBBC2822583D17F65D3D47378FBC3A7F1BBD3877DC3CC25F8EBDE1E4E4BC68067BBD5BD130BD60FD46BCEF9D9BBC85709DBDFD64B1BC4E4DD5BC0E5D753DF9DD0F3D640F83BC7104573D949B263DF5EA433D9F3D9CBC7443973DF0F80EBD769D063CE0C89FBD274A1E3D079D83BD9A39A13D88B71B3D0D98333D616AAF3C77E107BD9B27B83CB7BA593D670B9B3C950820BC178355BDB8278ABDE2F299BCBFC9673B7568963DBE18C2BB6B72FEBC727589BDA5665FBDA6AA32BD00EA5EBD1CE5DD3B51FFA83C517DDBBCE2CAEEBCA40C5A3DA57392BD9F2B0ABD4207BBBDD9F1B63B1CCD8B3C2891423CDC486ABDDB825A3D17EF20BDB284EC3C50A6D5BC4016F73964519D3D43C310BDAD7F53BD9313DD3C9F309A3D838769BDF5671DBDAE65073D30F217BD367A4F3D90FF45BD3CA8E93C4AE38E3C4FCCC63BE9D0AB3D7E34983DD3C890BB129A1FBDAABA9D3A8CA2203DCECD45BD40567ABC60028A3DA3567EBD464386BD00DD133DE09BF23C0AAF9F3D019342BD437428BD1342A0BD7353853DE519CFBDC83F3FBDBC057A3D9790A5BCEE77193C7D40B73D34DE55BDED0094BD407710BC6701CA3D0030463D893B4A3DBFE1923DBE53513DEB50B93C9764A4BDFC1993BD2E8CABBDFE954D3DE6F8853D41D06C3B95F906BDAD2B443CD5B1313D058123BDA10BCC3D0731F13A04DC8EBD31CA6E3C6DA795BD4B6BD43C48B1013DB964313DD9377DBC6BDC373DA794923D3561303D17A0C93C26DA6E3D40211BBB70A75DBDCC038B3C2BC6783DB7A878BD4605B3BBAFD479BA4B34B0BCD558193D4DB8C9BC5F25593DDA9D733DAA13C13C030C5F3D58630F3CD453B0BB58BA383C9B957D3D274C77BB889C4C3D8868F0BC21C6973D50439F3AD0E8A33DE3B5C03C2A01BCBB1FF285BC1AF9573D4091CF395CB828BC0E866CBCED9308BD00F6AD3CD039023D4FBA6ABBEBF970BDADB48E3CFFFC8ABD76D15EBD6F42BE3C2AD8703D55B067BCBE752DBD8C08C0BCB871113DCE333C3D205784BD09F73B3CDAA6143C26E9C5BC252C6CBC884E8BBD4749B33DFA167E3C953676BC3AFBA23D44DB12BB7D8B9F3D59DA663D25FD293DC40643BD132838BA45AAA03C719D7ABD10DA513D6B4D39BD0E7441BD00B7F0BC467492BDF4A874BCA065503D655441BB20BD4A3DFF1A213D4BBC41BDC5A7B5BDF2002CBD31BDE43A7FFFB13DD1DF123DCE878FBD8F1149BC57E07DBCC5C69ABD8C2D7BBB3EA2B03BB9F7873D6231C73C4F1D46BDACF8C8BD1B154B3CDE936B3CAE966EBD163D91BD7FED6EBD6E1408BE41379ABD75BDB43D62C3EE3C13C02EBD8ACA84BDF0124A3DB35B8A3DA6EBFEBD263429BD6E76B4BCA0A576BDB11D13BD874811BC607E5D3D6DBABFBD784203BC92E83EBD78CD71BCD417653D26318DBD012F13BCE26850BD7A8957BD2D9EB13D571E15BDC5571B3DC1CE34BD8851013DFCC0063D1CBA333D1EFA71BDB7CE0B3DD17B3ABD75BD9FBDF5E5073DCFFFD83DE015663D11AD40BD67C4BE3B44B7B33D73AE82BDBEE883BC7FA748BD43FE47BD449A7DBDA80EA23CEB002BBDD1C106BC45A6643DF48D383D6170343C27E8443D22191DBD051180BD69B55DBD726A453D6DDA0FBC09F8A3BDC84305BCF0FDA53C2281ABBD6E6B0BBC9098813D6426DFBD99114CBDD0477DBA331E55BD2741AABD53B66FBDE0F8593CF7C1B4BD55D295BD8D63C13CE9CD87BDAEBFB2396BECACBD108A3ABD4FB423BC13AD4ABCDBE9B4BC46442EBCF6AF2DBD36B3E0BCFDEF13BDD528D53D013FC83D2B70053C4814ADBC6FFDAE3DFA719D3C29D7FABC6665A33D8DDA673DF91C9FBDD242723D07A636BD33E2AFBDC63D50BD085233BD5A53FBBCAE81F2BC6C50AEBCFCABF63D6334A43DED068B3C677A223D023CE6BDA39902BEA013253D3818953CF7FA833DA6E7193C4ECE0BBDCF8C99BDA7FE69BD080A16BDF677483DC29B07BD0E2A503DDFEF05BDA31754BD3029C3BDB98E3CBD127D073CC00806BC7B128DBD676E10BC4B8EB2BDB79A55BDB109293D6712463D2E0F9ABD22B83E3D3CA7493DD70064BC4CDF05BE55D494BDD415C8BC00AE12BC65147FBD61614E3CF94E503D9A34C3BDB0F8ADBD3901803DD56D9A3D8A571F3D6C6D8DBDD966A4BD1824813DC0BD33BCEA66F73C36DA8DBDFC062A3CCBE956BD2EC7613C301B94BDB409BABC5F3F8D3DF57BB1BD81156E3DC4802FBDF906F63C4DD4F5BCED40B6BCD2AAF6BCF05DB13DB218AA3D895CF23A9A31CEBC2C7FADBDEA6A9FBD8BD8BABC3000BDBA916CA4BD11169B3C6717DABCEACA23BD48D2BDBD0E6390BD3E3952BD3ABB7A3B979281BD6168E53CED0068BDDDB19C3C2ADB0D3DF320E13C2D96173C2E1488BD48EE70BCB80DBDBDE22E2D3D59F9953C8609BD3D2019853D5250493DF5A34D3D509CD0BD8C0296BD78D9A4BDA72057BD95EDACBBCEFB903C169ADF3C81CB17BD39A1C9BD3E9EB33BC58720BD5AFC6C3D32664EBD0C35B8BD55B10E3D1C60953C2F6A10BE236EADBCC60A573D7F70303DF064A53D09F0BC3CE5F069BD280059BD306C70BDC859AB3CE8CE573DDD2D653DF29C65BD3F26E63D5BE93EBDBE789FBC67FFFD3DF9B0223D944AD8BD0B3742BD123A6DBDF57F88BCB5E2D03C02A92CBBE7444E3D0E8815BDF1F84DBD3F657EBC761F02BBF47409BE206685BDCE731A3D6DE583BD2AD2A4BD22E0873D14BA85BDB542E7BDF7978EBDE09563BDC43604BDE292B83DA522D0BCDCEF3A3D3CCB1A3DA503EA3D1DD151BBF9AB51BDE5FC933DBD4CACBD617800BE59FC79BD889C8ABBECEC503D4310953C154E19BC137E5E3C419ED9BDE2F1853D551D413C35BC87BD7D99BA3DE3195DBD12F815BB765DACBD7BC48ABD068C603D2DB4283DBEACC2BD27B8963DB73076BC9C9EAB3B7EE164BD21C67ABD6F18C5BDE9A2A23C077FE53A6D85CB3C068CB83DD64F0CBD7A41383D4079ADBC1D99CBBCEC40503D2D44A43A33A595BD696E92BDA73B49BDF5B7103D2F8940BD36DAB0BD6E3103BC22B510BD39E30F3DDB429FBDB80BA13DC3E90EBCA581B13D768A573D0B419D3DA7927EBC219CB7BDC2B575BD1B3E36BD749E173D9B53ACBD138B07BEBD9C143D158F10BAE4D1A53DFE59A5BA11E3B5BD94DFDEBCE81AC43C6BDEFD3CA1179B3C4B0A85BD65BB1BBCE3678EBCC9B126BB413429BCF2CE98BC789E3FBD617084BD718C60BDDEEAE13C9295BFBDB642503DC4467B3D8575AC3CC226883D559595BCE2CA513D3085D73CBA0063BD63B8513D2A376ABD0C6E97BD5E3C14BDABC5863C43CC40BC8444B33CEA4F873DBE16913CED463CBCB7F6D23BDE06783DCB8D01BD2319423DAEF049BD7B8CA93CE5FBB5BC6A5594BD384835BCD7082DBD27CA473D564D6ABD713F263D387F0DBEC942973DF665523D30C68FBD8E8210BD71F178BC770DF33BC4AA0D3C706AFD3CA4CE75BDDCDF2CBDCB27E9BC2A9F87BD3E83DC3C7A316F3D9126C33C1D204DBC64F5D53AEFAFF8BC192B7FBDF49C34BD6B202E3C7E6EA2BDADEEC43DFCA1863C97DA553B3582313D150296BDB0F7DC39DB32FB3BBAA2A4BD4E12BA3CF939E43CAD50143CE07128BD158134BD0BE4DA3BAB5A213D6E94FCBCB44D563CDB159D3D0BED12BD9559A93DB7B4E8BC23EB373CC6720ABD5C3F62BC03494C3B35406C3D77E2FB3D9248AFBD9CD3F4BBE46214BC6DB55E3CFA3FFABCEB04233D6E9A96BD55A792BC67A85CBC9AE77EBD81F961BD0B54DD3DC8D0C1BC4558093B66BB4EBD8BF74B3D20D197BB335A0B3D2F9FC0BB223B933D23D19E3C89181D3C5A7A04BC97FB313D1E839F3C373F023DD87604BEF391B63DAF1F0E3EC41A2B3D5F8EC33D724D323DEC54613C1C6D8BBCDAC5093DEDB9ADBD670219BD1CCBA73D283F82BD4ED8753CA8C0C4BC06B2A33CE6B0D4BD90AC853DB70CD6BCDE439B3DE709203D12B0CBBC6EF39E3D52F246BDCCD7FC3DADBACE3DB668EC3CA0A1513DDC8FA5BDD833493D904122BDB9A5023D3B0DADBC7FB711BDE23EBFBDB2B842BBE5B04ABD1C42243DA60A06BDDACA653C8BF87EBDA39506BEAE29713DAF2FCCBD2697C2BDAEFE1F3B65D08EBD15BFA6BA71459E3D709E95BDD595F83C17C7A03B06B0F6BC34B5A4BDB87E9BBDB406B4BC980E5E3D3EF9BB3C18AC58BDCC5FD8BD4A9199BDD3D894BDED0AACB950A6FE3C785D423BF181053E0BE82DBC3EBCCC3D036DC9BD1817653CCD3266BD486AB0BD4CE1443DECEB393D202E26BDD185AD3DDACE343DEB9FB33CD8C45C3D15F97DBC203860BD5638753C2313CD3B9C4DDB3D1E588D3DBCEE82BD909BFD3CC5BC0DBD6E57893DC2EAED3CD12CB13B847161BD2F03513DC7410A3D1B08A5B98FD8D0BD3804653D43D9F1BCCD8F8BBD4A418B3D59E11E3C65DBC83D9C54A3BDEFAE523C6BF3883C7F13AD3C106AB93D7B686CBD2034A43B6C3F00BCC60A663D51B059BD44DDAABD223552BC46D4CFBCF5CC81BDC7A7BA3C3F71C53CBC8629BD4CBCAB3CEA098E3DE245713D3CD9293D55839FBDEF44D4BDE792AEBCBAF6F5BB566B08BDF00001BE2F7D1FBDF624FF3D0B0CC03D4C87943DDB8D063D331593BDAB7690BD10C560BC143A553DA75FFF3C2253203DC4C2D03D455A0DBDD67FC0BCCC8BFB3D82410ABD6C5A0EBC141E15BD59CE8C3D95B585BD422946BD5924C23C433C22BD65E60F3E812FAF3D2669003CCAB15FBC44A0F5BB33472CBD2905EC3AAD62E8BC8B63463DBED9B1BD98E68DBCA4EC8F3DCDE775BCF89BE13CE5789DBD6B76163E002B9B3C008FA1BD85CE5ABDDBF0C5BDCBCF0BBD52BC75BB44503BBCC967E3BBC03A94BC33CCDC3CC7F932BDF8AF523C0F290CBD1B4CEFB9440DB73DFA1078BC37ED8FBD287A183C6AA539BD4D7D69BCC052A6BDED102EBD29EB9B3DA7AE643DC3CA873D045547BCB7EAC33D78062BBD819DE43C6EA1AC3C5D69723D439D5CBD6842DA3C863815BDB4FFDDBC8C1C643D21315C3D477824BD95A4C43CCD70683D9E68023DF087743D8B0061BDC0628E3DD60F01BDD2A894BD3AE35FBDAA7A063D676A093E163867BC1B87C43C97CE11BD59811C3D8F8ACD3B6D99B8BD73ACC3BD607B60BD5D1090BC334F8FBD7391D73C58B0CCBAD642DC3BF8DDF53C4D9A523D5A4D8ABCB15118BD02FB81BC3CEA193D536B9ABDDEE15FBC073B403D94CAC4BCA8367ABDA616353D99876F3AC88479BD1EC84BBDCF5E5FBCB9B144BDF57DAD3DDFA2073D5FE613BC397FDABCBBBD8FBDB58B9B3C2C6EC4BC4794433DE7A0943DE7FE49BCFD96BABCF68C1B3D4BC64A3D22F7263DE9EB573D3B09E03C994779BD18ADA43D1FF705BD0EA4783DCBDE8CBA76369CBC4E621D3C0F29213CC4E2F53DC800A2BD87F989BCDB7E08BC3248D63C12DB073D9D86E6BCC317F8BC38D001BDEFE2E73D7762C73BF5238B3D76064BBD64AE59BD04F1673DD8399A3C2C08073DA9FB97BD88459CBC44AA4EBBACAA143E202266BD66B6263DEF6F393DB5B9043DBC0DD2BDBB7384BD25EF4BBC756EA5BDA1E4723D433DEABC303E42BD059F7CBCC58206BCC6AECE3C23007BBCF35391BCBE8F11BE23C5CA3CD0221E3D279AB73DD0DA353D1C800A3E6147DE3C12DC6DBD9DC9C7BD1DC671BDC50235BD6EC7FF3D813800BDD674F23CA98AA2BCE323DC3CD1C30CBC215627BDDCBB8D3C93D245BD0217603D63C4673B3E3F88BD0BDA083C5E80CC3DEBDAD43DA7CF4ABDDF0A0CBD395C3B3D58A545BD2EE582BDEEAF6CBDE04D843D0F43D13D6DFF583DC380173D155DBF3D87A1A73C66D8883AA255B3BCEA76A1BCA5DA603D65BCA6BD0614933D2CF31EBDB2CE983D680126BD47AB59BCCDC78C3D44DBFDBCB206893D29C01D3CEDB64E3D62D14E3DFFDDB8BCD36F72BDFE2ADEBCF74C4D3D67D39E3DC11F023E77A5F6BCC066113D0AD0203D3284993D622B623CC4CCD3BC4E26BABD41E7DD3C6ECA683D1CA0D13DD1AF643D433A85BB6BEA4DBBB02C723DC0B4B93CAEBABB3DD961D03CFCE689BD549E003D345C26BDF060B73D3564563D4DB206BD433997BCD02C543A5A4D69BD8426DF3C34CBB73DB93A17BD3C1F3FBCBCEC18BDF113EA3D14AED1BD8515BFBCF7AE903D7087B73D24A78F3C2F3634BD2630ACBC0EB70C3D6DAF813DA08456BCBD9DB1BCD18F96BC77D0923C214D97BDADF786BC993424BCBDCEA03C54C14EBD1670E43C1E760F3D3341B4BD38D0D43D33D8E8BC36FBA63DCFEE203D18EA04BCBABA80BD2D45C6BDE08FF33DD6829BBDF8C608BD8E4BD9BDF99B963D73474DBD1787A0BC25CF14BD1A1320BDBDBC61BDEC878C3DD7C1133EAF7F483D3B5EEA3CA95F963CE08BD4BC89DEB0BD2E2346BD213E8ABC2B3E043E3508DFBDD451B5BC5BE97FBD292350BD871BA23C6E4A403DC78ABEBBB94192BD6E14AB3D94C5C13C23EF963D8F17093D4BCFA83DC0B5143CF763FE3CE030013EE41403BD9B9F98BD70309EBDDF09BEBD4ECB713DDD64C03D918A473D9AAEEABAF415A73D1164163DCDB2803C409AE73A04E3DF3D3FDF87BDE5D33FBD2CC5E1BCCE79943D88CA0F3D5A3D43BD52571A3B9B62D73C97CBA2BD6A44D73BD38B6D3DBF92BBBD37C428BD7D2368BD2386A5BAC38371BD9B9A23BDC32DB83CD8A8383DEA2DC73D2768E53BDCF9E03CD22F773CB53F57BD9D2005BDD99FA0BD5808DC3DFBDD863D8715B33DE3B4CE3B204FEB3BF99BBBBCF85C90BDE41703BDCBF79BBC0AE24C3D1D5655BC3DD1F5BC42562D3DCC691D3E6DE4A83D329D573CFE3CC1BC9B08843D71A5A2BD87DC5B3CAEB3023D99F683BDEB1800BDE3CD39BD32F84E3CA73876BB2E490BBDC7AE26BD5BB18F3DF2F2063C3DFD7E3D049BDEBCD585B1BDDB958E3B6C9DA0BDD7A62EBB7703D6BCC468E8BC1F35FB3BA35546BD84222BBD3DFD09BD22D6A7BC4156BE3D5F38033E6DCF133C5914CC3CC0324CBD48B7F8BC9D9D343D1E09C63C038873BB0423A9BD827DA53D6FDE72BDEF63593D5CE881BCA96C64BBBB3BC2BDFB7A2BBDAE9FA33B87037BBDE6AFECBC7DC860BDF2FFC33D0CCF863CD914C73D419928BCE5414C3CBA0436BD0F5E8C3D90CC7CBC9391863D1D1CE73CADF7913D715F8DBD87E9D63C16238B3CDB5F9B3DCE3D0D3EE49A1A3D74182E3DCC250E3D82CA8D3D68DEE33CD18DBA3DE3D8813BB88B78BDBEF3B53DDB469DBD56408D3D665B98BDED2B5FBC0ABDB7BC66391E3C40FEEA3C7BEEE4BBB93E023DBCAA923D50AF54BCE9C44ABD95BCD83DCB27883CB43E07BD265BC13DEB7D8D3DAC1801BDA205C4BD1E48EB3BC48E473DC7E1D13CC1CD003E93308A3DE8153A3D78135BBD5418D7BD5DE3403C377A503D01ACFABCF0BE643D92A62C3D06ACD4BC56A2D43CFCF97E3D1811153D1C42DC3CA143AB3C52B7603C09F60FBD0821533CB32C5ABDB7AD6EBC4383A43D22C0AB3DC07C7BBC1656BFBDFA0D77BCDE77BC3D160F9FBD2AE15E3DFC7E6F3CBA1EBA3D30C8563DE744A6BDAFF4833D419C133D30CAE8BC279DB5BCFA9DF43D28BA87BD74E24DBD66C4A2BB0946C83DBAFBECBB8F6834BDCB5D953AB377A9BDF6BDCD3D2E08573D4BE3EC3CE7B9DFBCD10C33BD1838173B5476CFBC087F29BDCB64AF3DB78690BD0F5C723C725331BDBB5C7DBC331486BD333E443DF2B3013BBEE8383D51CEA43C1E3F0EBD7D8E92BC417429BCBB1F34BD0D6674BD2698E6BD0E553FBD8BB9303DF6D130BD610CD4BC26886B3D30EF6DBDF952C9BC86AF5ABC424D31BDBE86A33D98CAAE3BF2113A3D7D690D3D02A1D73DC75DC4BDE3C0B4BD3F7C9CBC2571233CA2178DBD1BFEDC3DFE47573CE524BFBD151E15BD5AED233D79FBAE3CBD853A3C4AECC13D7F3108BD9D32943DD464343CF774E73DA516903B0901E23DC8EC32BC0337603DF90A20BDD4D325BDAABF94BD5E9EE23C4F9FD6BC78951ABD5D5B7A3D4A9B8FBDC432C3BB93AFD23C96E1463D8B17E0BD31970BBDF81CB93D1A49333D5B63693DFFF3CD3CC95C2F3B186CBABB844256BDAB59323D352C5FBD731694BC3515ED3C428320BD7DDAC2BC579BF0BB34C5B0BDCDACA33D6C40353D862D6C3DADE96A3D2506EC3DB15D2DBCE9837D3D77E68D3D334A61BDA31F303DA3B5863DFA8952BD23DC5EBA36D1953C7DABEF3C012D04BDE47EE8BC6408233D470A36BDBDFC89BC93BD1A3D96378ABDB5D28DBC929F453D9DCE3EBD2044083C6C195BBD341496BD2C4175BDAB1DBD3D0D95133D1171403D5BD5843C8829863DE96D023B812CD0BCE049753DA80023BDA19C5D3C541FC73CC75A6BBDEDD627BD2EC385BD37B45F3CE083A3BD09B0F8BC7E2E6A3DD9D9A13DB0D8983D0918813DF0635E3C8B793F3D93089A3DD7909A3D81436CBD62FD96BC44E51ABD5FF7C83C22CB2EBC24F649BD5298C83A6B86B1BDE61079BD8A530D3CF1EA30BD4F46EB3C23D311BD17176A3D33412CBDCB20CB3D8AFB8A3C5B9123BCF7A38D3DE7FBDBBD7ED8ADBC70F88ABBC216EBBD73E01D3D9D4CE03D807849BDA2F8BBBD0078A0BCCF61553D2EACA6BD937E883D6F0F903AC94EC4BDE947363D7A84D43CDA0A3CBD18A6083D360CF83D50293BBDACE8F4BCEDFC25BD6C1F08BD7AB9863D6747823C5776173CA3EF873D4986C2BBCCC5573D5B3D6EBCBCAD193CF64BBC3C8D14FFBCF9B4893DEE408A3B4297A3BBCF4EA63DBA80ADBDFE1ED3BDCAD24CBDDD69613D13F5E6BCB4B1BF3D7979AF3DCB372FBDA87B563DE933AEBD429DD6BCA8BC223D69E883BCA3393A3D077C9E3DA1184CBD2FC9DBBB2DE21D3D1F4BB3BC2CFD04BD5F2DA93C6A89993D903B9B3D596128BCFFB01DBDA3576A3B7951ACBD967E3DBDDEB7943DE274B5BD1B7382BD3AEB5A3D14132CBC3A60163D97542BBD70CA593DE55AAD3D5BCF69BD9B8BD3BCB3F53E3DA47CAC3CAFF436BDA508A43C4EB51339D3A5E1BCB1F9433DC8DE493D239CBB3D6623943D5EC440BC051704BDDF16F33C941D70BDC430313D661611BDB7DD33BD16D17A3DFEADB73D26BE133CE4421A3D5DEF32BC96AC183DBF8CA5BD1EADEABDA66D443D9737903DE89304BBFFB2233EA264B9BCC781ED3D6FE8BEBCEF1188BC9C050ABD2FE8A9BC2E7736BCFC1B973D2E8F5DBDFD41303D03D1C53DFA19513C9B179ABDE77A74BD2407B4BDB65151BD84E8783D38698EBD4FF571BD629B173D59F4F13B7C4A4ABD7788B63C688BF13CC8D9E2BC64EBD4BDC9980DBE7578C3BD1C6A433CAFA0ABBC914C98BD1AF21EBCB7C6563DEFD77FBDFC14193D373484BD054D91BD3B8EBC3D369730BDB515C83C021834BDAEBC813DB24989BD8D363CBD87A2DABB3573693D49AA2E3D1D6D6D3D67817EBD69639DBC9D4B81BD0F19B73C50FAC8BC3A2748BDE052A33D125CC53CB31B02BD768D5BBDF4C822BCB3C124BD074CCDBDD07548BCC9467EBC7D23133DB3F984BD199BA03D31D97F3DDC3C73BD47785E3D8805913D779BF63C0CC3A33D4A055B3DBCADB4BDCB2C04BDCF751E3DAE9B83BD0B5D823DCD012B3CD59901BD453C823D519D8A3D17CDD23D2A19C13D16D040BD8A0C9B3D1FC7D13B5F4A303D7CE42A3D0BF6723D1CC4CCBC53D9923DE612A53D44F088BCDC099A3C6CA9883DEE7F9F3D8C27ACBC474D5D3DDBC5543DE440A83B9D28B73DEF359C3C6C0808BDAD8C8FBD876AA1BCC18C07BCDE6FA33C73B7D9BCD980ADBC2B20683DDCD3873D6733363D8D978B3C23C507BD7C37413DF532483ABCB68D3D9B1B75BD1730AEBD3F3B403D57EA2CBD5D8C953DBABDF9BCCB2ECC3DBAFE963D81BDA4BDA399E53CD939733DE57CD4BC175AA53B2807E33CA468EABCF08177BD606AC5BCC9FE3CBC1DB64BBD5671EB3C13C8B33CEBB1F2BC467BC3BCECDC7DBBA635ADBCB00898BDB9E2A63B698FA6BCAADD5C3D17AD893D1E95AA3C5FBF55BD4B06B43D26D6883CD27144BDF375C5BB64F8C3BDF0E0B2BD7F91D6BD279920BC4A5CED3CA278BE3D1B5E6A3DD11784BBD4C5B7BCB2F999BB80180EBDE5E0B63D4833E93C926BDEBC2306973DAF390F3D0E5D1BBD06D02FBCB1491ABD7D09FBBCF3A4063BD1DA49BDEE191EBCE7EBE43C0C13863CC88870BC6B79CC3CCF8E9CBC386C53BD6FE419BDD5D10D3D7A43E23CA3BD813DA4459B3DC5A2423C82EFA63CA49660BD2CC8BF3D26E362BC376C18BD6A42403DD73E2D3DE0CC903DEC019CBA6C378C3D9DB2F03C25A9923D13EB9B3BEB4505BD0A32CFBC7BD7B1BD997AF83C537C743D804874BCC9A28E3B5E25833D305DCC3CB6AD3D3D84C747BDCFAD043DAA74D7BDADAD80BDBECB8B3C9EA12C3CE2DD933D92D0AC3D6F3B373D45EF2ABDE222F4BCDBFBD03C403ADD3C4A07F63AA5273E3DA00D6D3D22AAAB3D5E9E38BD5BD64C3D59371E3CA435E0BBAFBB90BDEC0475BD88D547BB1ED2A63DD38956BCFD73B33D6F8649BD19A3113CDF4B56BD607A43BD547F913D1E54783D9CFAE13B8424A6BC539C33BDBBD8BD3CA230413C25F920BB4BCE9FBD213C7ABD6FC0A0BCFC40633CA5B3A43DE576E6BCB8F1B83C6123B83D71CA2B3C09A85A3D759DFEBCC6070C3D0A1967BC4C00173DFEDADF3C2DADAB3C3BD2283D446600BD326E933D22DD84BD0A4B7DBD1D338D3DAA044B3DCC5F443D1D4458BDCF92BABC328C34BCBDE3623D1221BA3D8C92293D323278BD5E5CA8BDC73A7EBCB94D0DBC62D5963D45505E3C22AB15BD107F67BD0B4782BD5CF2693D25A0993A81205F3D8F67BF3D2E3CC13D081CC0BC67C615BC1733BE3DEC94F1BC9DFD56BD9717BCBD53EF243D96E48B3D10F7D6BDC33CC43B274605BDC90669BD6DA0CABCA4A811BC8812D83B80F61A3D6344A53DB41CDFBD5648A13D874C7C3D81BC0B3D48F4A2BD46D8B3BC93AD8BBD7C136DBD3E75A03DFD3D363D026F13BA3640013D27D7833DB349BBBCE7B9F3BCED12143D306B823D1D29E7BDDA8ED7BC2D6A2C3DD864453D2ED658BD6E577EBC96980CBD77DA1F3B663D053D64FDCC39D6C89DBC9C79B0BC7C27293D498BC13CA648E73C154A673C2AA0AA3DA99B1E3C595CBA3DD10BB5BD488185BD55AFA8BDF8E4DC3DDD569E3D3D3674BC9A6A12BD5B8400BC22D6B73CE6A8A43D153D983D6F8EDA3CAE71A8BC033E7D3C49A93CBD16539B3D5B35FBBB49C112BD9CD45EBDD4D4E6BCEBA5DEBC8B52DABCF41C993DB5CD98BD39E31FBD93529CBC26056F3DFDE64DBDFF929B3DD8DA42BDBC4E8D3C1678B53C2554243DAADE3D3DAB0D4A3D90E91ABD8181273CA06956BD82A6A7BCB0C28DBC91D484BD94CD99BDE8078ABD946C01BC935D933CE413BB3C0E20C9BB6CE85E3D634DD6BB0CBF203DB5D42B3D0F2E65BDCE4AD03C5E8E84BD35CCAF3DF7698BB8B2677BBDD1285ABD0E761CBD62C1D93DDC7EA4BCB8FC363C48E9B9BDBABE27BDC11617BDE88E883C805F54BC3DD1833D99CA5F3DE701DF3C4967AA3D84CF703DFE276F3D94615E3D344C4E3BD8FA85BD183D343DA610B73C0221F6BCB682ADBDAFEBAABDA44D5EBD6117153DA09070BD80F38D3A20F98EBD1D5148BC6E098FBDEFD7633DEF44063D290C253DD7DDA43DCBEDEABD5008DE3CD231A3BD4A35DF3C132E2B3DA281BF3D60B214BC69F50ABDCF86D03C214656BD8F4754BD01648ABCFD04F7BCE8ACBC3C0F93213DD43AE03D94DB3B3CAC7CE6BC956890BC9D126D3D688710BB8E3F263DF1AFC0BDAC60103B55766ABDB0901DBB2467C2BD35B666BD59FA3DBD5D02C939C0D0C4BCA523963C1798413D64C0E63CB6DA603C07D1173CAD9A3BBD5D0C93BD34EEACBD9A2EC63CDE6D47BD7FA1813DE1D3D4BC0744A33C713F193DBCA7E43CF9C8A83DA01F943DEFEAD13C50D692BD51DC573CA713F4BA8CF366BD9E9557BD2B829F3D194DAB3C6A3CA6BD13D57B3C83CCF53C890318BC971915BD0070DDBB5340B33B78FEAABC8E6E9FBBAA8F37BD86E989BDF7CC003D12C7853D1813423D80F586BD3A2DB03D11823ABB6ED349BC7F7830BC61CF483D189FF03CC96691BC74A07F3D199598BCC4F41D3C7B895BBD2593193B3BA7933DB9B5823D1B09623DADB8923DA802A9BC0A7D01BC687874BD7E503BBD6859BB3C7C5B3C3DA812EBBD842E153D5042063E7249B7BCB11FCD3C20D13DBCD08CE53BC1DE8DBDC9BBB63D0A3925BDD8EA6E3C8CA2633C541228BDBA2D6DBCD4757F3DCE8E2FBD95625E3DF52246BD4AD06ABD16F92D3C7F746ABDF814DCBC742C533C166B30BDF4659A3C719320BD62CA27BD9ABF553D6D93623C657A0DBD153EC13CCADE983DBDC8E63C4AC3243D72E711BDCA5529BDA080ABBBA62090BCB79D1B3D6ADBA93CC5896B3D99C4B3BD4D4889BDA7480E3D469BEA3CE7178EBDB5291F3DAD3AA33DA79A4F3CD7FE66BDA1105A3DC922033C8C69A6BDC7ED8A3B47CA8BBC4F682E3DF697603D8CCF243D6C7F8A3C83B33D3D0D71123D05BFA3BD5450A0BD328E73BB3B4804BD96A5A7BDD4566CBDD100AABD542F53BD5A3AE03C5625303D2D4B66BD93D6A9BD01336CBDAD7CBF3CFCC2873C7138C3BCBAE4B33CA3753D3C43ED933D27D1933C1560C83D6AD5BEBA09D9ECBC8BE6A4BDF5FAD13CB0C9EDBBBA6CFEBBB089C7BC74E7FC3C4AE2B6BD1B135EBDA72F1C3D5D1356BD3F9C773C9D378B3DE040C4BB6C7205BD3A39F93A3EA956BD58D77F3D70A4B8BCB8382F3D2D2BA6BD8B7110BD3E188DBD833B993D2453B1BDDB3A51BD47D2BCBC4B358F3C5CE690BD0649DF3CB254A6BDD07F753D286DA9BDE624793C78FD0ABD0F227BBDA829243DC67F36BDF1EE4F3CBBAB67BD18E0B43DC539003D8628993CC6B5793D3837A6BC086BCFBDCC8C38BD4E86A53D6D9A543D3139963D0848663C980D53BD4C54B3BD6525833D8E3A403D9A3014BAE4D08A3D0F915CBCD9B4743D8DE083BD513FAEBD5C06683D4081813D4D4E8EBD0C136B3DE525A23CBED58A3C5899ADBD6BB4AFBC8C83BCBB99840F3DC4FAB33C46A64ABAEF14A03C8455F4BC2603B3BDE6D78D3D78A132BD3B39DB3C7274BCBCC69993BC09002B3DFBF791BDB00F993C346DD0BC9AB6E6BCC865A33D96641CBD3DE8903D62686CBD26BAA5BDEE660DBC734F683B1712E6BCA2375BBC13E27EBC06AA30BD859CE03B207EF73C7DCE00BD69C57CBD80C09E3C486FE0BD3AF2313D284686BD91E3D63D750B14BDB4520B3D97CE803DD5FEC43B6E31373C9CFD1F3D0B449FBD5EECC43D0E241EBD8195723D9525D9BD14349FBD2097B4BD74B1303D9A3B56BD16C6503DFE098E3DDB71883D161F6DBDA91838BD54E8B33D666EBC3CD3B007BDF38E63BDE42070BDC21C6B3D47D711BD0AAF2B3D59E88B3D3FFD90BD46BC8F3C013A0C3D621F87BDB50B02BD29E72E3CC2C2863DA3219D3D1B66C0BC4FB8963C2F019DBC02B4113D1A2459BC4F8D75BC4E70FF3C420CF63CF2EC303C28A252BD7A1AA6BD12B282BC71F762BD741C873D9907A2BCA778BBBC398EA0BB145693BC5769B63BB2248EBD072E38BD15B2273D293D46BD1061823D55C6A13C7D3FB53D68C3A2BC96C02A3D8E4D8CBDF53B4BBDA8329DBD770E36BD5F76053DBDF559BCAB7E8EBD605B103DAA2F40BD7DF2403B74B034BD9CA88CBDFFBA75BD9F589BBC676D86BD0BADA93DF068FDBCEC3904BD10103EBD7B0BD53C9598A5BBB37B993C5B2A8BBDFC4421BD8211343D978B333CF1E6993CD951583DDCCEF1BDFE786FBBAF0B6F3CC0EFDF3C2C5D98BD98E0653D0257903DEFF98F3C63DA273CB9BD80BD0809833C1EF0F83CBAA01DBD7DFC4DBDB796A13D177AAA3D2A4689BDB37D41BD350BA73CEB5DA0BDE1FB7DBB1D3B03BDE4ADA4BC301EA03C80163B3DA49D9DBA1A7CE7BC3517A93CA2E6693D5257693B6C9D183D19642B3D8A94963D5178A03D4E1CB23D86FE70BD2FEE9B3D64590BBD80680DBD58BB88BDF06F403BD0E4203D7E9C293D2C5E1F3D236F613D0C948D3C5CFA6FBD59C3BBBC6AEF29BD321812BD842FF4BC2C6BD93CA2EE0F3DFA6B1DBDD44D28BDA29DC33DB010B03CDF4EADBD3999B2BC4D38543D52E0573DC5C939BD11D46DBD5532B5BD11B45C3DACFC503C4D85A6BC4CD3B03B6F2F923D3BF22DBD8488593DCCD8A63AE58D86BD55F02A3D5A4AADBBDBC4853C3D53AD3D1F8C95BC09A60CBA7F3399BDABD4BD3BDEDB2DBA7F4326BCE940973DD89BBABD735D7CBD3CB361BDBF6F3FBD536D98BD2DB2E2BC984963BD3079393AF28E47BBCE89923C1719DD3CFA500B3D623E2BBC13AF5C3DB6739ABDB72F48BDF190B9BCCBDE69BC0335A8BD4C7A963D0FAD563DD6826F3C0F6833BBFD5D3EBD5EA865BD4CC88E3D95549F3DAF00003C3A993D3C509344BDF4DE823C6D71293DBBD568BBFF696E3D3BC897BD14A186BCC7FA2DBC48E7E23B069B303DA21111BC229C3FBD39A57EBDBA777CBD12EBF7BC4FCB4EBDBE6CC13C653BA6BD0A7E90BD5F60CBBC6E5CAD3B3446D03C9403BE3DE89B80BD64CC1ABD9C1071BD665A47BDA25653BD38603D3DB0966DBDC9EAAF399F132ABD3E0228BDBFDD663D1673F1BCCE276DBC76DE94BD0B6530BD7A03263CBB067C3D5ABDACBACAB53ABD525FC53D76FA28BD9DD2783B751E2D3D4060C1BC3F9A7F3D3DED813DB7789ABC2445003D401BD03D54318DBDCE7CEC3BEAC84FBDB5C0853DD94BA0BC1F7FBA3C4E39453CFF667FBC28CD983C075014BDEB515A3DA0CDA9BD2B599FBDF361293DC6E72EBC398A1CBCE82F9EBCC3B70BBD304B453B9283CD3C206839BDC3BF893DF1859CBD038B563D68B1883D7B0B47BD5758D13C848C9A3DBD6D99BD2CDE1B3D8B7D3F39934D3E3B5E5563BCD150263C4DAE74BD5866373D148CC5BD5395C0BC061F38BD18B6A2BC7C5F31BD827D283CDB397CBD91042DBD9BE6683C48E351BCAC81EEBCAE57FB3CE6FF3DBDC17213BCA4A9833D022C693DF1378ABDB825763D5D2511BDB97E6BBD2F18AABCE21665BD57E39C3D16486DBCE32B06BD1C0744BD75037BBCCFEE19BDA3C49BBDE3EE153CD95F6F3D028783BD268BC63CF7DD4EBDC8E6A73DEFB367BDECED8CBB4110D8BC912715BD0E1445BCE714513D84A6D1BC8C0F7D3D8037B3BC84D033BCD27BD1BB3D4C62BD96A2A5BC539BCA3B68CD553C7C40853DAFF5DE3C859AE53CE7CA453D2D5E3C3D4D14073C3EA6553C23CA4B3D836F8E3CEFC484BCB504563BFCC52D3D0BB3873D3F6AA2BDB1BA30BD3E47E93CFBB8A5BD4406D23CE75E53BD4A7D5BBD75D1F53C8CF2BC3CB5F9CC3B049B8D3B16EF953DD360783D5517333D87E11FBD7876BDBDCF95C43D2DAF40BD3E8A86BDED7BAABCBB24F73C27B67B3D6D22A53C8D20C0BD7C15493D32E4F3BC8E7C883D96091A3DF59A103D3B123F3D100FA7BC05DBE1BCB5134D3DC6EAD33C95FF91BD9CEC0F3DE44E03BD6A6D72BD12AA803DF679B03CD7508DBBB073993D4B4F6EBCDDD4F3BBD968973CF2E5503C04D326BD2B359D3D81E548BC8F2800BDE000223D223F8BBD1BF36C3B994202BB2FF6E03C82C87C3BDEA78DBC2C7BB73CE1D1393D0FECB53D9BF85B3D2D529EBC4CB157BD6DC0C6BC07808D3D247D6CBD1CB9563DBE404FBD2F0085BDFEE1823DD4102A3DADBF40BCDA63F53C4E7427BD04A5ECBCF514843C1F5F4BBD2C7B103DB069843D628E833D16691E3DE838A03DDE37CF3C4C5396BD8DAB9DBD6AAF81BD0CEE14BB6E8E94BDCB771CBD77B5943D8CBE97BD1808BEBCF99085BB7E393BBD0475303A6D2F84BB2A27F43C05F49DBDE2FB4DBD14495CBCD720F0BB082587BDE1E51B3DB6B873BD4DB645BDDF2D2EBDCC279EBDDA9F0D3C1A84CCBC8C0855BCA6A54A3D3A8E0B3D5FDA523B94C5813DBBDA9BBC759B063C2589763DEE063FBD1DEC923DA7ED1A3DD319263DBC8907BD82D5643D61A3C7BC72AF22BD6A337BBDEEE97EBD7B768FBD1E952F3C1223E1BBC4A2843DB19F933D68B2983B91348ABD1067783DF9EE16BCFE3BE63CD48320BDC8F9793D00B0A1BD8ECB9BBD1CD0B0BC1FCA82BDE202993DF00CF23B185B553D25466D3C0179DA3CB236843DA7B7CC3C7556153DF59482BB2C75ACBC9479853D1046D93C77D835BDDC32593C04F3993DBE19EE3CA6AE2E3C2343DEBCE22187BCE30272BC65A58ABDBCE80FBDBBE4823DB81698BAEB88ADBC2D05ACBD284698BD9FADE63BECEDE7BB9ECB0BBD8FBB9B3DFACB96BBDEB56EBCC309BABC594338BC087904BCF1A888BD645E4E3B59379DBD1A3B0D3B732A53BD60142D3D084FC3BCDEE6B1BCEE11353DF46C96BCFFC09D3D6B3A84BC13DD7E3DC4B1143DCB19493D58F7833DF883903C244095BCF6E7363DF715D9BC1852883DBCBFF1BC2FAE87BD8AF58D3D545D3ABDDB2D573D30AB513D62E32D3C25EAFF3C3D676DBAC4D4573D0131CB3C176A263DE50893BDA74F84BDE3212FBD56EA5CBDCEA1493B0352BF3C403B883D67AD303DC6CF613D133922BD1096DA3C5AF68F3D6EF0FBBC46A9953B37A33F3D630D803C09B5833D69F8DE3B92240B3DF004E0BC1F6A803D067442BCFD61A3BD945B36BD603166BD99BA833D1083FA3C0706853DD869813D6DDBE0BB4F0B6D3D2B2209BD1F3A15BDE3C5773B01DE883D190F5B3D3AC24A3D8BAE83BC2CBD903D5D5D5FBD8A3813BD3644C93CFAD71BBC626C7E3DB40F13BDBECE2A3D28CB59BC61709CBD1D1BEC3B4195143D8DB9943C73031FBB703C373A9016D33BFD8EADBB8DEE8C3C3F1A48BDA3AC6C3CC131133D8541A03DB0BCB43C2B1C083CB42F8FBD5A2747BC215A08BCBDFA803DB83D0DBD9665563B2C87983C2BB203BD921826BD948EA53DAB0AE63C56C7923B9A3DF83CB7A2DA3CA8B15E3D814E91BAC8CDD4BB632A7D3D9E1094BC01675B3C209B5B3D286678BD0B5B8D3D4BED2D3D26F1A2BD3C129CBD508E19BCD0CB0FBD706B293DD89AA9BC641CA1BD00F032B88011A73B6CA70D3D256C813D9BA98CBDA6013E3D263C3E3D0C3B9E3C0000DF3BFC8291BDD87A41BD6DF6853D966F1DBD0627673D700D7BBC84DC90BD789B8FBC20EB7BBB98ACAD3C6F35883D1414FFBC4059E83B7490E4BC488D46BD1837363CCA10AFBC6E4A06BD45205FBD7797823DCC5B3ABD2B3E20BDB0A080BD3833F23C306F703CC81E53BD58B910BDC8744F3C26EDD7BC8073BABC71328ABD200E203CC0CDAE3AA07A703C90CF05BCA4ABCA3C0FD30DBD281D663C3BB300BD98C54E3CB4CD953C4F7E963D685330BCA0ACFCBBE8CD80BD7A52303DBCBCD43C5AE4E2BCC3A976BDB6715A3D6EAE443D20A5053B68FEB73CB093C93CC05C34BB27BF9D3D39A31BBDD244673D145D33BD829CBABC789891BDE615DEBC806735BAE8BC7ABD15AB8D3DBCBAA03CF8538A3C13E98C3D80AEBABA24900D3D28D8C03CBB383CBD27B68D3DF807AE3C98313ABCACC7003D442487BC3488123D6C0EB03C44AE133DD82D9D3C03E017BD2B72A5BD99A1993DC8C127BC2A52653DB91A5DBDC61C543DCBDB8F3DE8B560BDEA14513D04A087BD5008043DB001EE3BF98BA53D4002633BBF5F00BD00D5E9BA002617394EBA433DB014753C6A0E563D5FC08B3DA311913D6485823CB28693BD407686BCB478E33CFC7083BC0065A3BA57459D3DE8FD833CE7A5B13CB4C01BBDED52BE3B9456083C57803A3D01F70A3CF0B49B3DF9CA41BCE00E9F3B8771293D3CCA62BDC64995BD67E95F3D506B023DD6C7E93C21CD96BDECAD8ABB233F8B3CAD1C493DAF36D6BCBE7E14BD1C018ABDE9B637BBC25FC13C5EE8FB3CFC9C6ABD23859EBDD192B53C7E50B43CD1730ABDACB2713CA234453D2E4CD13C6809323D4F7DB9BC15209B3DFBC46EBD8E169EBDC97B983D5B6B06BD4BCC843D78D6963D16C289BC471C8DBD5B3BA1BDA8B34EBC763C81BD6E343C3DF5E4933DEEB138BDDDE07FBDD2C7483DADC5383D63DE48BD2D8F5F3C62DB483D8495A5BD42EC3C3CEF1D50BD691567BD46A6943CC90840BD80047E3DC22477BC3D25E0BC7B4A693DC76C353B9B3FC73C566AA23DD4123ABD93A809BD8D6E95BD136F28BD102510BDC11FB83C9CA39E3D354173BD51AA3CBD057F2BBD7814553D1458C2BC64D7AABB89C320BDD2D18F3D3C33B43C8EAAB7BC64CC6C3DBE66A03D2EE36A3DE2924B3D4BC881BD3302863B60BE063DCCAA56BD214FDBBAE8F41F3D9588D5BC56CB80BD53ED3DBCC8B136BBA00224BC197599BDF98CDCBA68B50FBDC76150BDD0B3443D96F617BD31486C3DDA92B4BCEB67E0BCD42F8F3A952CECBB90AF1D3CFFED163D0A3F863D15DA7C3DF5DA4C3D7CE7863D34D7A03D4AE0CA3C31350EBC400E5FBDBC9407BCAD5940BDA0E674BD515B95BD86D1DABB908468BD9339D63BD00756BC24461D3BB2C7A03C36D1CA3CE72198BDAE2771BD6A27B53CA83A2D3DF806A73D07858F3B8BAA7CBD5DF9A9B98DA0E0BCF77317BD80E865BAA7A342BC9D1D933CF6B9B03C83F521BBFE5630BDAA985C3DA2EFC93C5B0466B904B90B3C4FAE893C2BD025BDD9C19DBDE554923CAA823F3D0B39103D9859533CA862A93B7D6EA73DF389B5BCEED62CBD3C6760BB2D959ABD8F1D5BBD372628BDAC9535BD6DC42A3DAE40A23DEC553A3D5E68573C4415A43D2A5DCDBCA6F1F4BC86CF8E3D4FB6B53C7E77153C0296083DFC354EBD02148A3DDC53923D77747FBDEFC203BDDA1158BBB5FF963CB3636EBDCBCBFA3CB4E987BD7649EB3C0DBD113D620546BD8F5882BD8D213E3D9D3AB23C16E4233DA1A589BC4A0B8A3CD6999EBDB4418EBC422429BB3CC6513D634459BC34EB303C6F216BBC616596BDB1ABE3BCD61BC3BC525A29BD1C32293DCC22523D2BBF313DF39B9FBD8C7B0B3D3A2F73BCD95D6EBD9E5D87BD66CC1DBDEA66DC3CB06D9A3DB9D0B43CBAA9383D4D03153DDD3F40BD5137FCBC96CF273D95591ABDD7338DBD0022E33C85529C3DA3CEDDB81D6851BDD87DA43DB2308ABD390229BDF3A041BDA747C93C15A3F93BFAD912BC8E65EA3C137895BDF06D9E3DC63F25BBD5E2AD3B5BD5553CCE8886BDE4B3A8BC6C400CBDF42F643C41D388BD146C5A3D32F5203C6F2C2CBC23A15BBD8F3BC93A632F00BD9B943EBD04B7873D55B33DBCE79E74BC6BD002BCC6C58B3B67B870BA4AE03DBDC285B93D071EFF3CEEFD8A3DE78F69BCF32627BD6C54B23B47F0D9BCCDAA283D05DD003C416E0BBCD4918D3D537EC7BC7C8887BDB65727BDA8BA9DBD16E902BDF2FF28BB04EF76BC8865C03B60EE883DFDB84FBC6C24963D55EEFD3B0D0402BCDF58A03CC5149BBD7F0829BD955880BD15EA1A3DD16ED3BCB3A686BA6A59B6BC69F21CBC2D96323C5C30693D7D399FBDEE3D01BCF9589B3DC9BB3FBDCF206E3D8CFC31BD7012323B0F769B3DCDA11BBC7451C9BC473E393DD13FD03C8C5AAE3D301E1C3D3AC441BD285EBDBCBE40B0BC317D43BCBBCB2BBDF60EA5BC36D7A5BC7F9EF6BC7322A13CCC02B63C408BB7BD203FA2BACEE697BD98A11EBD68C48EBD8ADF453DF42C14BD3BCB243DF82380BC883984BD9D68203D462004BC40753E3D34D15CBD7EA8A7BD18698E3DAD3882BC31644F3D91CF8A3D181C7EBDB4F010BD02648F3A9CA202BDDFE8633D851198BC4FA2DDBC4B89493C2A06053DBEA1253D19FD1CBD02B64A3D3994B93C784603BD5E86123D9008193DCE30033D4A40143D1A429A3D73B88F3D1FAA1C3D49B45EBD0B911E3C7D037DBDDAA587BD602582BD1627673D8D061CBC6D2229BD11A4DA3C856E0BBD5063393C1B7FA33C2876D33CCAEB963DA05A0D3DC660EFBA371B473CDF1B3A3D37009DBD8EB63DBDB5144F3D83FB4C3D8EDF4BBDFD4944BD512B92BCAF9B813D258295BD167847BD7033A63DEE8C143C62EF983D2685843DD3708D3D88AF1E3DE441353CEEF637BD2CF0083D88629C3DAC5386BDC3A06D3D92AD69BC1FF225BD79E16EBD13BD8CBD2452A0BCAFD97A3BC5A8B43A89DD59BDE7DBAA3CA5D13ABC1D55A13D2EE3633BEAC8173D2F61B8BC4C0085BD6B1E7F3C1CAB8DBD1C4820BCA35249BB27CE983C3E53C83D9F45783DBA0BAF3D302D6A3BFC8B383D942D4C3D63000CBD7EF0853D13644C3D668A523D87729B3D38497EBDD899A3BCDBDA953DB67589BD57D30F3D7573CD3D95B6CDBC959F813DFB0E673D6B4E943D729991BD7AC1823A782CBBBCA95AB43CDD4E3C3DD27A8B3D41D04EBDE7D83FBC82B89E3C269B9E3DAFAB91BC4888313D6018C33CF2819F3DA8D48BBD590903BC7C3C0DBC5C0539BC4AA64B3D91E4A53C1DCBD63BD2E9DC3C3B5B5D3D3D673D3DC3D811BD092C91BCA0A0C93BAD856DBD5790533DC55375BB27934BBD3F498ABD360702BC910DAABB6268A23D71485B3D73429A3D4943BBBD4FC700BD5F7E6B3C70594A3D49104BBD8614BA3CDAC7893D94723A3DC1A5673D5A8246BC849706BD2E7F6EBD171A2BBDC285743D565D7A3A23A8DE3CD15E7A3DE48FBE3CDD46943D5BD6363C8A75F9BCDD36853D8DBA3DBDBD9A85BC2C34EEBCBD96A13C6C6E293C79D1ADBC1E69A0BD8000893C780E2E3D6477A2BB9270213C18640D3C7AC8D13B0C7E2FBD2D27AEBD7D2A58BDB1273F3D1110093B84DE29BDC5C98F3D3E6668BBC54F46BC020B633CB6D3DD3C9C5A60BCB3244B3C8F1914BC7667013DDD00713DB02018B8C4249C3DE65089BC25E7663D11F61A3B26D9E83B6EE94CBDBCD5E63C10B98F3DA4DBA3BAD4463E3DF986893D7C5BA13D5C8D253DA58D543D537A70BD83445ABD255D8DBDFC89633DCD80E53C3C52813DA127D03C827D8E3CAC587CBD490F3ABBE048113D21B19EBDCED26E3B6C3C943D57E6DEBCC4FB32BD4B627F3DAE3DB93CE9D4A8BC3FAAE4BCB220CCBC069DFCBCBDF99B3D7122B8BCAA5A5FBD00C06CBD67F4513CE99D193DEDC3143D87B2C4BC8E551E3DB6A9E9B7A1C0F23BF839233DF514CCBC63AD9C3B853E483BE3B391BD67ED55BDC8B114BDB033283CC26B36BDB60AF0BDAB234FBCB55905BC510D733D60FF123D541D88BD2978993D3C5208BDD4F362BDE47FA8BD50B160BD709390BCE3527D3D8D31583DDF59D73B43E1473DB9B9A1BBB04D31BD2654F4BB6C13F43CD3BF54BD534E833DD4D1013DAE3435BDE060BD3D8CF278BD9C31363D69C565BC08E52A3D1F90273D358E2DBD8A645F3B2CBF8FBD2490F73C111C8A3D560216BD495A96BCEA169ABB1FB94CBD460B433C4DFA48BD899E123C2129B83CE1715CBDB6B98B3DA74FE1BDE7BCBE3C98EF69BD31FA16BC93936ABD2706B3BDA0744FBD44136C3CB53D9E3D2EBEB33D30D7B03CCDAABDBDEE23BBBB88706ABDBB3E85BDF1A7BFBDAFCA973D705A4DBD8712BD3CC8571B3DE5E035BDA70B4BBD339133BD9FB4D33A7377FB3C92B23B3D7704C83C3A03EA3CD3D0953DC652D63C7B1CD4BDA6A012BD4D98043D88D0803D2A8961BB9A0180BD2ABC583A961C253DDD2FA43D9EB84C3DAB5C1EBD0DDFBBBC1855843D5C408FBC6DBC683C0ABC7DBD7788023D9780DCBC3ED5B4BCD76369BD065655BD186F2FBDC45349BD9905563DC77F6CBDC977EEBA8AEC86BCBF3C8DBDECDB52BD5DB1553DC46675BD9364A13D834300BDA7E08BBD608CD83D9A5D6F397B81C9BD5EA657BD301CB13C9183C53C24E6813DFF11F0BD904226BC915063BD6BE8763D1703F83CAD894E3D80A6E9BBCE6460BCAD2D5CBDF3EC293D95844E3DA91121BD6A5A2BBD758F2F3DD953AC3DE390CB3C25B776BD3AD9AD3D321013BD0BB5CD3DB835453D5422C93C305540BD76FF33BDF554953D5197593D8FC91E3D956CD5BCD511A23D6C4BA4BD7072A13DA32738BD95FD743D3653243D0C44E5BBAFCF03BD317A973D53733A3B4537A3BCA555353DD3E6CC3D125FFA3B660041BBD58E95BDE43F1FBD956907BD8706AEBCC91C363DF78972BD3FA75E3D535EAEBD979A67BDC43280BCDF1BCDBC0E998BBC7B66D53C136C383C43DC67BC9614173DA608A4BDA61785BD0031C93CDD94363C36A0F4BC741C9BBD6A3A053D84F96D3D3DB3B73D91AA42BDD1B6A7BDD4548A3D779265BDB0FF713C66068FBBBBA53BBDD8B0BEBA67EE15BDF3C852BD7BBB783D20EC863D2B71893C242C2CB93D5CE23A96510E3D8819B4BDF6832EBCC3EAB53DC539A6BD2001CDBC06BE90BC489F343D3414253D1C832D3D59FCEF3C2E4B41BC7E4697BDED9065BD8A4E3E3D0125C53CE9136A3DC9AE1B3B262F373DD2F1F03C66BD25BDBC0A843D4FEE21BD6D47663DB011B7BD82B8DFBDB32DDEBC5EC6873C5E85A33ADBFA58BDC77249BD4041CFBCFB768C3D7FECB3BDE154BC3D20F23DBDD47E283D917BBBBDDE76E8BC5A94193C76280DBE1A07C3BDFEBD763DA78E35BDFBBB11BC3E700FBEC449CBBD6898FE3DC06F30BD3D9573BD716E79BD3624BA3DB86AF4BC9E881FBD578F18BC56F96ABDA2AF8EBDE59F723D5AC927BDEB7B0E3DFA5057BD528C813B6E3208BD64EA753DEAAAC73DCDBBA8BD98F685BD351BDD38BFF8463DE30CC13DDF7A04BCE8FD86BD9CB96CBCF555BA3DF5F62D3D8465043D000163BCE87C3C3D70D67F3DC4B9283C003C47BD69DA78BC159DB53D964C75BC6293983D1B25A43C58FF16BD4B72613D9286B0BD9DAE53BDAC5808BD366E83BD86FC7F3C62E25C3DEFA2973DC3B5573D9C988BBB50599DBBB483153D4355ED3B4112B7BB6EE53EBD8F42AEBD56A8B23BF03ECFBCADC129BD4AB09ABC46F700BB69A0D4BB97EF9EBD263757BDCB44AC3D65D7C83DA1F9AD3C3BB213BD74CCBE3CED7C79BD4519493B98067A3DA8CCA2BB9037173DFA8DAFBB8ACFA9BC988944BD5610B2B94A649EBDA055593DFD318B3D4BA87A3D6E448ABD8648373DEAFCBD3C684A99BDBD41C23DCED3F03CF1499C3C758488BD05AE813D72255DBD989254BD3B87BABC569C1F3C3F5C0FBD3B470F3D4C6A47BDC6FFA13CE873583DB11132BC5D844D3DA4CC3C3D828AF3BABD501BBD5C1439BD2CAABFBDDE564EBDF25E6FBD50B35FBC2DB788BDA32C7DBD3783243D6687B4BDBFDE8ABD96ADC5BA92BD363DA238F33C2C454B388DCE32BD02F2A53CD84D7BBDDB320A3D3BDC62BD6832C33BD6837D39E828A1BD994D413DC0B52F3D4B030D3D964790BD003FAABD96329E3CE7B7063D3D2792BD1AE390BD40713DBDB4BDAD3B73100DBDD730453D61A467BD1621353DD33D8B3C1BC5923DC0433B3DF12E473DF12C143C869D5CBDE237D03B794CAFBC8A77B63CCE69363D57F79EBDA71096BD88E6763D6381113DBD1F8FBDBBF78D3C0B450DBD60F0C03C509D30BD93CE8EBD45A08D3DF3EDA6BC19D2E4BB0886913D44F18B3B238F65BDB8AA983D5224373D0ABD43BD6B7386BDFED394BDDF58D0BB9EC9393C11DF5ABD62558A3CE5B795BD850486BB93A628BDBCBD5DBABE23AC3CE19FB93D62E471BD84C5823DA9B0F6BD3D48743D76039FBD0003593DC060FA3B00A1713C340B3BBD17C1E1BBC958F5BB1E465D3D0823B1BD009802BCB5108EBD53336EBD539109BD04B7083D4F1D8DBD4F8E763CDC014CBD6C9083BD68B1A03D9306A7BD4E094D3DB7F7BABDEF58E43DB3EA97BDF5419FBCB8D8F63CCCFCFEBD1D25A73D905B133D4CC8533BC65F87BB1254873D227E52BD30CD3ABD2E979FBD24CB54BDFAF939BDF9990FBCA78BCB3DB3849B3D2062363C07C252BC97A6803D1F0BB9BB81019DBDFF17A1BCAA4464BCB75EB9BAC10DFBBB3428C6BDD361C53DEB18923B86E0233D80DA173DEADFCDBDE41936BE50E5323D7B0194BD097D2EBD87DE0DBDCE97533D8786C5BD35BAC1BD3F539ABD3AD290BDDDBD79BC427A143DB6768EBD8B3F18BDC9C3F73D6178E73D509917BD19E5D1BD3CC5F2BB2D1FA9BD8F91CBBDF8CB873DB5F6BEBD896514BDB4AEF13D6052563D0B64ABBD647F96BD528C29BCECCB0DBC51D5A3BC4407953DEE2825BD021DA2BC578FEC3C90DBB43CC43AC53DABFC833DB673D2BDD1F8213D0830AA3C28D1443D244071BDB06B9CBD42EC363D00627D3DB5E64A3D740280BDF2855B3D8B0178BB02CEA7BDB68AC63D6E75F13DCB8C153C49DA9E3C4E338BBDDAA5F8BCDC9A203C4515DDBCC3AE9DBD89B1D23CE4A2E43D3B30163C3CA36A3DADC8BF3B7F1DFDBC0E8B683DE0A7453CBE1973BD9E6F7DBD3D3C613D748BA7BDC55E08BCADCE8C3D4468AF3CF64B0D3D2B9E5DBC5713B13C70F2BB3DC78AABBCC3D8053EA688C2BD4AAEF6BC27D9853C6E2CA3BD0710D6BD564D61BDFFBC7B3DCA4C673D2ADC603C697FB1BCA390AC3D1645A1BD7C4CF7BCCEA5E43B3243F2BC2DE938BD849447BD2BD557BDF5ED07BEB098D23D3D080D3D52FD473C948F163DFD53C93C830B973D4AC1E1BCFDB7C1BD52B61E3C5065653D6B85A53CAD511F3E13FC8BBDAFA71E3D78DA37BDA661C63D2FFEE1BCD40803BEC8C1273CFAED5C39B24089BD0E26A1BDA0EC6FBD3C96B73D41AB843DC545AABD1B3C27BD34D0E5BC8C6390BD739E073D5EF6FC3B7C35AB3D19DEEA3C0FBE983CA8DF42BD4ED550BD0089EDBD0DD59B3CAA3C8E3C8647BD3C9E43CC3CDB2B073EA535623D9FA8CB3DEBE06BBD872B003D0105A7BCA66603BC113A0DBE50592FBD6DD8E4BC59FDDD3D09F8F83C249523BDA8FC573D8B46533CE14A2CBD86894F3D70075B3DBB50823D5C22A03C838761BD7FE362BDA06B99BD90051C3E0B1DA6BB70268ABD503231BCE0001B3B420E2FBD4FE75DBD76623DBC1AED003D84C6803DDC49F4BC202524BD324F183DAE0C473D6D828ABDA82C08BBA148D53DDEEE59BDF07AF03BD7A1563D8E78DA3B091C633CAD08F93A0CE5413C8C51CD3A5ECB923CB761003CE675AC3B6A60D6B9A8D718BD05661ABDA386803D3058BB3D8A1F233C99106DBD604AD9BCAFD4843C48A8983DD802463C0195CB3CA06CCBBDE2D198BDC699AC3DFE57883DDEBCB23ACB80A2BCE7A481BDD2A9E2BD3A33303D5A2940BD0A397E3DD07B03BDA575BB3D72CDABBC2FBEB33D9846283D2229F8BD0B24EA3C78E567BDFA892DBD565277BCA651353C12528C3D6624D2BD254CE23D71CEC93D4D77BCBC89C1BFBD24D81A3D9E91713C47FD343D336CA3BD0360823DB4C1263D3C83113D2D01183EAA3CC0BCF6FD58BC4A6442BDC1C0E33DD46318BD71CF53BD84779E3B20D89D3A6E8803BE102987BCF892613DB533773D298390BC7B069DBCC67B24BC0F37BE3C8F23EDBD1FF89EBDEF138ABDA988973D01573CBC69262ABD7F07BF3C0EA8783DF96FDFBDC40833BD94F8403C566B653D965B9ABDA3397B3D3FD2A5BC22178D3D89F42FBC02846BBD3E3BB33DCA2C8C3C31E403BEB9B8763DA8CEED3CABD8AC3DC55ACA3DFB50F5BCE36F053D35C06C3C8687133BE82D9A3D5EF00E3DBEB8CA3D254D923D2E8FFABB1581BCBC24D890BDBDAF4F3D8B20583D637FA9BD7225EE3902CABABDB6FD81BB6B4599BDE06814BD57B8A13DF304CC3C768073BD59CD913DFD5991BD75883E3D348E1B3DCE101E3C05540C3D348E3F3DE60086BD6DE42A3D3ED385BD8DDB69BC9514B73DE649AE3C2951273D2D28F03C5CA7F4BC20C9A73C29D5CE3DE6F198BDA0C39EBD44BFE13D1BB4143D454589BCF1B6C93DB55FA03CBBCD81BDA62792BDE381C23DE905BA3D716E31BDA4C2643D126D6BBC2FCF283DE280C63D2D2A9D3AFED4AC3CAEBA05BDBBF84F3D46E13FBCA5F6AF3C94110CBD82DD243D98618DBC7498493D0291223CA76E91BD86214B3D46DC4C3D54E2DDBB85A6C73DC1BCAABD25845CBDCB35EFBD08F4B53D71EBE53D9AEBBD3D1BFFA8BD2B04B8BD2DA2983D0CB18CBD675C4E3C391B883C6FE733BB1F1106BD1DB5103E90B150BDE747D93C3196C8BD86BC933D0FAD29BBE2EAE63B00B5DD3B2F3347BC4AEF70BD4258A5BC2B1580BCC45F033C526A943D371A4FBD2F3FAE3DC090B5BD081107BEF6948FBC6896A1BDC2D27F3D0FD46BBCDB8F8A3D3B7E47BD9592A13D7B307CBD9E4F063D777B53BD8E2C0D3DBBC511BE94B0A33D37F0373D776B87BDD22DFCBC509A333DE0D3F33D37FF64BDCFF7DBBDA5147E3D8BE3113DA160C6BC6CBDABBBB3358B3C4408493D4A5E2BBAE7D1823D43EF16BDD1AC943D6EB3BF3D01A3FEBCB220553C6852003BABE639BD23FFC33C8816E93C220C6ABCFA271C3D7DFD943D177E83BC08CDC6BD7EA81E3DEEF3E63C372B923DADA93F3CE23F46BDA418BFBCCF16A23A2D74EE3CC6BB2F3C76D9373B35B4BC3D43E9643D90AC1CBDCD499ABD70B1ECBCD9C6FD3D7FD2063C8DD5853DD4AF9CBDF863A33C3D14BE3DAB20183DECCB8DBD183270BC32754CBC52AB353DD87E0C3DD867CE3C1FF83D3B1B3EDFBC85DD7F3C205AD73CDDB514BD5302C9BC0613853CD2572F3DAA52D73B1E131D3E243A0F3D623B313DEC19DB3C598B833D02F63FBDBA5803362235EC3D7CDD04BDCE26CF3C63971E3D13DE033EDAE4B3BD78BB533D8027713D5EB6A53C352BC7BC5953233D22BF37BCD3DEE6BDBBED41BD4940BC3CDBC4473CB3687B3C01D4BCBCAB4D68BD595EF6BD844CE0BD34AC693DB3EA08BB0437953D0B68583C682395BD6621573D07C7353C9616C33D41F3953DDA317FBDE997ADBD7A6DB6BC34C7D43D84A8BBBD5DEB603CF8E588BDDE6AE93CAFAA9C3C311950BD3A7DF5BD5D95D9BD4BA722BD3AB4ADBDB1DA06BB59CAF73C7730683D437EDE3B9853FC3CD7A555BD87C8DD3B6EC6C03C905A2A3D42E06EBDCFEC843DAB927EBD3A5166BDFD71EE3D303128BD56BA043E445E56BDD52CE7BD03D88BBC15008D3DEEA3653DDFEDD43C26ADD73DDC29B63CD621713CD56E43BCAD5A5C3DF58B1D3D5AEF2F3D8CF5333C9B21333D67C07C3D58A4F93CBBB62D3B41DB953D4AFC86BDF0B7B7BD8294853AE68DFFBC1A9A6B3B47FAA83DC9AE62BCB839913D48D9B0BC12C3B63CDCB9253D3FA9B2BD4AC2A9BC60E46D3D98F7ADBD3D97893D9B71DFBCB15BA93D20BC10BCA563A73B0E854C3D7F4E7A3DABC2843C2A8D2FBD6F2CFD3C7D42BD3BCC8AB73D888073BC656BB7BD4940D23DAE9EA43BA5D1D5BCC889AA3DA9B6F33CD07A2EBDAF1491BD36CC83BD24BE993D2648313DDDC667BDC77177BD31149A3DA373853D05B9B3BC998F963C47DD92BD1422AF3CD552013D19DA31BD8367603D78FEFEBC515F903D2F6B36BDA55E613A6135BFBD55478B3CFE2C7B3DCE5E243D4CFEFF3D4092AC3DEA0703BD9E51B33CB2119BBD1BF13C3D4A331A3DA3F1A23DAF14C43CEDD4C03CB637D8BD5688C3BDF34D49BDC078273D40865B3D0290723DC7B5003EB4AF8F3B9756CE3C100EC6BB4D7B4DBD2BAC47BC9207EA3C61F119BE9B05CB3D84C0803D716D2F3CBDB9073C1EE2D33D03A5DF3C632DA5BD9A4F3EBCE3EA2EBED19F13BCD6A781BD1EE26BBDF337A5BC632C1B3E9F6A5FBD0AFE7E3C757D413D58FC353C957B01BD761D983D3FC7793CB5FE883D0BBE5FBD8A9D903D7B97603D3EE930BDAFE53A3D631C823DCA62AD3B28D89ABC05A5283D38A0F33B9A739F3D8C85BE3DCA5C8F3D297570BCFDB3B93A257B8EBBB84021BB5A98F73C9FB0873D0A9749BC3862D53C6DA851BD839EAE3DD83C73BCE1E09FBDFA05813D7B051B3EB6DC7ABD9BE9C1BC3EE4A23DDA75BD3D740A9B3B5ED8E03CC1F002BE7DC4133DF42AB8BC2ADFE63D85F4503D24A66BBDC90E9B3DFA0CA73C6DAAF1BC0CB1BD3C4FC6DC3AC80C8E3D86C7223EA26031BD04EE2F3B72FC3ABD4F35B5BBBC30C03C408A4CBC81925B3CCC4E84BD7CF9DCBC7E6D4A3DA35F683DDA376D3D8A93D83D66F44C3D31DF68BDAEE38FBD690D6ABC23D211BD54D3943D7AFCF63C33B3C13DF90C423D9268563D2DE58BBD9741993DC424B7BDCABBB0BDD8F34D3D0C959DBDB533233D6BADB3BDBD32C9BBC33E143D4F0290BDB06E01BDBAA81E3DB59768BD8D0A183DF7F8A43D7E94ED3C57D26ABD4F2D66BC9507B93D043EBB3DD48B9E3D7192833BEDF4B8BDF24D8EBDC059AD3D8CC289BD0E074CBD3789833D0C2D183ED58CCDBC1F9B643C60989F3D66BDEDBDA5B4E7BBF6D81EBD71226CBDAF1D103DAADDAB3C391CF43B45EE19BC41FE8FBBB4FB82BD1439223D3F253CBB8690A8BD2FFDA93C5D0EFE3C8550243DB055B9BD920C003C3E363ABDB80187BD7B5C113D5DD5893DECA2443DAF4F10BD1036C5BD40955BBD4B2E2FBD01F7C2BC24AEF6BC5E59C23C0E76573D7298C2BA521810BC89AA683DDE3C2A3DEDC9A93CB389073E1B7C4EBD794932BCCB11BF3C08352F3D112589BD3D68C53AD588643C40922C3D9FCA11BC671986BDCEEA67BDE0C18B3CA5064FBC878897BDEDBD05BDDA7D023EA538D4BB4C4763BDBC5CD13D260C0ABDA490903DA269193DE984C33B99917A3D28515FBBAB37CB3D0059633B8581043D3E940FBB2BD87F3C3383093D7AE411BD7CF5863D3042D23DC6E1183EAC5EDC3D6DC49FBD4A445A3D52824FBD984728BD6CEE37BD07AD0BBC373E6BBDE50E5A3D8189563DF5D0CBBC48388FBD3E02CD3D817FD13CD5276C3CCE8C5E3DA25CA8BA7DD7023CDB0D21BD25F9B53D3B9FBFBD9275D4BC7586803B8E3D993D74D0793DDBE35EBDB81D023CD0EF9F3D17648E3D1B4EE13CCA30B33CC74F4FBD5C6CAA3CF86C12BDDB7C2DBD641FA7BDFB738ABDC7B5833D80C2033CBA775ABDDEF443BD16A6733D01CBDD3D1D4B8C3DD98C043EF2C47BBD76B7323DD1F5973D51A72E3DD6481ABC8CD2593C356735BD50E3F33C8F8A603D7748E5BC676AA93BCD5E33BDC5143A3D40AEA8B52AD5D3BDDDA1B3BCD00AFDBC85CD9A3DA3CE1FBC7A58D43D1212F1BDF3F06C3CECED9EBC7AAF04BD10D9CF3D3DC67FBD82E66CBDBD30083C4CDAE93D9EF671BD2B75E33C66122E3D4F37C33DAD3A7CBD537E8B3DC58DDD3C6897CDBD0FC0AC3DB91D93BDBD96A5BC16F621BCEC4D2A3DEE7B0ABDA5A3A73B4C4FEF3B95AB693D742D2A3D6A54C63D85F021BD15F6CD3C3EE911BD8C4CDABC195981BAC130BD3AA903013D151A59BCC591CA3CC2FF6F3DE923573D1CCF233D26E3A13CCB7FD0BC1C1D7C3D1F52653C7DABA63C656261BC0B1795BCF426A7B9FEE27FBC27E425BD976AFDBC8D4A043E587AA23DAA6A87BA6045463DE9C29DBD40C6C7BC70AF49BD555467BDFB3F98BD2EE269BD50968D3D641A89BC3C889EBC6C5530BDB9BEDA3C5B37193B807E4FBD308AE33D7505943DCFE83B3D73FEA03CACC2883C69F851BCE9B0203DE7E04DBDD6BB883D84FE6FBD0855623DD06C023D6E7A743D51A8B03DF7F8683DDE5555BB6C8766BDA182E33BC917743BBFF229BD928C1B3D38769ABBA257C63D3BA9DB3C54923DBD853100BA4458C7BC690B6FBC156FC2BC91E8043DC8D906BD5A7723BD03F938BCBE2E64BD7D58A53D3B2CA1BCA9CECABBA4F03A3CFACC8ABDC2AAFABA5489843D70C190BCEB7F33BD9815293DFF457CBC00FC933C3F0991BDB349D63DBDCB37BD7A1302BD0DA210BCD1625ABDAFA840BD1EC04EBDB715BABC9121CEBC6C062DBC95B3833DB91232BD12DF973DF693CDBCF41CAEBD0BC5143A59C19B3D64BD8E3DF939703ACC609EBCA8CF693C31E2423DC185B2BB7B17DBBD33829D3DB9D3B33D8B614DBD6B828E3D2258113DFC07A93D39D4013E7A1CDDBC2A1436BD1F245ABD970EDB3C87BF413C7D7FD43CAED8633DC2964FBDEBC2BA3B234939BDEF98053B594A7FBCEA9B51BD743B80BDEC2778BA42C089BB6F035F3DDFCBB1BB89279BBCBC3D07BD67C907BC61F9B93D25FC30BD8F8847BCD80B843D33427A3D339FDBBC77A4A13D59781ABC29372EBC2F099CBD8350903D193D783DC542DF3DFC24A03D617913BE6F2DDB3AF448C63B1459A23CE1F1933D3EC0A83C345B843D5881303D59018C3D012604BB3883CD3D00F696BD6797C9BC74B5ACBC9F29993D13F521BC63F9103D28C299BD687D883C072728BD4F082E3D3E2DDCBC3BEC14BD65C0893DFBF876BC47B88ABC5AC4333DDE2715BD2BC81DBD64C0373CC412B8BC1676F7BC89601E3D0DD5E83C04EC1E3DD17ADD3DC9583DBD9664093BF4C9953DF28D62BD8926833D939596BCC6A555BC3AA17EBD07041B3D911B8D3CF3F42F3D12E60C3DBF87AA3D1475B13DD33E90BD3DF96A3DE7AC92BC7398313D8ADB9C3B365FD33C4663993D61325ABDEA0CDBBBFCF509BCBD2C873C9A48223DE1E1803D28561EBDF8AE713C94ED18BC92E28F3B1F0D8B3D97B9A2BC8F8428BB343275BD062844BC8CB8093D7D931BBD26C1153DC143E0BCA73FBFBCB17D993D38E21EBCE802AA3D2B5F013D07BC283A1B1CB5BBFB9B4D3C0915D93D77788DBD499D763D044F9B3CDE5901BCB30CDE3D5F278E3D5112793D9537F03D3663AFBBE5A600BD51384B3A42564B3D17562FBD259A5DBC8B167ABDC60DA6BD214FC33AFEA5363D21FEFCBCF80F4F3D391156BDCB6864BD089FCB3BE2C4893DCE3B393D6313A83D2D1E1E3C0EF6953D875FEE3BB9D487BDA840B4BCBE6C3ABD080EA8BDC313033D388B89BD961CD13B98B6E6BC5002683D65276EBDB734F53C93BEBB3D7D8BD03C4CAE643C3AD6D9BD152CCC3C714CD4BCFB991DBDC400713C55F2F33B53B340BD4B44833D477018BDA79C9BBCE679443D3649403C4ECEA7BCFF9F86BD188428BDA117E6BC43A5CC3DDDB59B3D6BDE623DF30A98BBA47685BC642EDEBA131BB93D9DF9CF3C77025EBD6EFED9BC8352343D4420A73DC9724BBD197E423DC9CDABBBE838773DD9E090BD5168A7BB994A013B849FB23D82FF30BD7226403D73E0793CA8D5A4BC0D686B3DF01A0A3D5FBB653D36E9A1BD4EFB623C7064C23CF0E079BD97B7383DB8F6BB3C1A9E6E3CD38DC33C4C82263D976D773D2E4884BDDD6E4F3B5A565A3C3216A5BC5853A63DE3CD193DD0FFD63C79548BBDAA6E513D0405883D4FF88CBC356448BD9E48F63C17752DBD0A29383D2B1E2BBBBA3C0D3D2C8D31BD206AA13D88DE1FBD2CB1343D6952313C7B86B0BC863177BDA5082B3DF42B92B9E7262B3B052D59BD4DE77DBCA40B11BCF0C9083D803AFBBC95CC803D74DB123D72A62EBD9807CDBA65EABD3D2C10DBBA6E6D0D3D5B3B16BD5955F1BCA77093BDC7A0163D4C63C5BA72AB4F3D3F109ABD39FACEBD71DB963CEE3695BD3703D7BC5438A73C7D27B3BC8BE693BC2C5B84BD678A133CF7F17F3D2B4A9B3D337603BD4E1FDEBCB2EB1FBDD70C883D3D4038BDD55DA5BDCCAB303CAC68543DEEF1553D313E96BC0E51B83DB5CD00395F0652BD84F6ABBDA53CE9BB2B77D63D8E269F3D08AF293D9BC0DFBDB8AD94BDCDFE9FBC2779373D5B6DAF3D55B9F4BD7DC411BDBFFC8CBD126AE83CA050703B9B0C4F3D50C6543DBFAD473DD73A973D88606BBDEE9234BC8F5A7B3DD1F612BB0869DC3D6C0D693D1C25423D455E5E3DCA6AC03DF88472BD90A18BBD7D2FF1BC95E16C3DF9E1773C7C9F9F3DC1C42C3DE4DE8B3B72B7D93C189370BD0DA1A63D575F6B3D3AA0BF3DCB7E17BD44038ABDF67C61BC0F6D71BD8F1D1DBDA0E6163D47131E3D867B443D852B0ABDAE2968BD7B1FBD3C510FAD3D8D3D8DBD4A52A03CE45543BBEC717F3DB6116A3D07414C3D64A7ACBCFBDDD83C5A6B183D69222D3DF4EA2C3C9FD3063C17D1A2BDA81A713D9E0C2ABD8891B2BD065B5BBA613BAFBD60B4723DB41092BDA7BBDBBC1FB3E5BCFE0D5C3D4C5FB9BB7DE15DBC22B28A3CFAD603BDDCB09C3DEEF6F6BD5C36A23B3D1E933D38D38D3CAF1CA0BDA89BC4BC782F4BBDD60B033CD395543D2BF6213DF3F98B3D592B413BA548AABDB6E84FB8CCCE8ABD7CB22CBC423968BDFC5DA23D90C2883C58931A3DDDF0823CECA2B2BD7A7E783DC4C4C2BD911C5E3BCD90403D3BBF3CBC50DF23BDB38D183C18E1E4BD80C14ABD29753EBCA31F553D0539223DD67BB83C857FAFBD91DDF3BCE9971EBD14BC0D3DA4B085BDB6D1BF3DF459CEBD2454F03C0B89433C5FFA363C97B638BDC1FE45BDCE52A53BCEE9CE3C3F98513D0E35BA3D079630BD451AD2BCC1448D3DFC60493C0060653DD0720C3DBCDD643CF105833D4CEBEA3B2B2725BD96AAC23C17EECDB923EC6ABDC919033C1A8F603D450D263B3DD376BDEF11A33D2A86D7BCBDF9F23CEE02683DE1E5453D972D01BD04BEA6BC7CA369BCE93E59BC5B2005BC6764DE3C2D33773C47FAD43CA423B73DC8CAF13C1D60DA3C725EF0BCF0E4A53DF0BF1A3DBDE4883DE8BBDA3BE3AE123DF851923C575E2C3DB26540BCF783263D7C3D7D3C9824B93C1981443DF9FAB73C58E18A3D4B923A3D638714BCFF3898BD5A69E1BC782E72BBB58A413D54A919BD017285BD93F34F3D3493B8BC5FD16D3DF209163DF4223D3DE648053D7F1389BD80BCA0BD3BDBAE3CA96F533C9546153D6B75953DFC75EB3CD9B683BDD96B383DD7953EBD1D3DC53D5477B33C2AB0753D7CDDFBBC5E7885BD9B0B0ABD8CF97C3CC117A4BA4E3AA0BDBF640B3D54CFBB3CE14C4DBD4C74D33C1879C23D61E053BC0A67D63D5D55FDBC37BE13BDC66B2CBB78E502BC12DBEE3C41623FBD91B9CDBC28DC9CBDB4CBFB3B099B8ABD59793F3D12BD063D210FBDBDDA0EDEBDC04B0DBD4FEBADBCB81698BB8A773BBD488BBE3C776E873C38AD9B3DACCC9E3D1FC6AB3DBAE633BBECE1E63C49B34ABDD7A612BDA8029C3C720D6F3CBBB7FFBCDBD9DFBC01C9753CF3312BBD27C09EBC12EF863D31EA50BDBE713B3D496B28BC275E363D988001BD9796C83C9355023C61097B3D4BFC37BD32B4B5BD13F087BB3223B83B6659733B56576E3DFA1BCF3D7C32E2BC7D66B93C4BC4503DCD46B9BCCA10BBBD72550DBC0840C7BB4153C43D5FA03DBDD7AF1F3D881EE1BDE0B1C7BC6654963DD480B23D05592A3DDA1623BDD646923D558A91BD803E5DBDE84F5EBD0F02FABAEEFDE73B1E1D7BBD27B490BDB16E34BD1AD5133D7FB81F3DEC1860BD23778FBC960989BC1AC0B5BC8190513C8579E6BB94BCA53CFCD8523DF0288BBD4A0A813DFD71823BB39E99BB8BA990BDDFB15CBDFD5103BD7FA806BDD546A4BD4D609C3C2771523C6D3CC6BCCAF64BBD6B75883D6C9DA5BDE6020D3D5B309ABD1354403DDD7074BC18E0233CBBDB19BB3BABCDBC2D07853C346EB8BBD33332BD8F6CA53D1019CD3C7449A33CD9F35EBD2DD67E3DA425673DF58C34BC484EA6BD484FE2BC07F5CB3DC65CAF3C7B746ABDBF7763BBE00B1B3D535478BDAE7099BC48F2B5BC9321583C8A7D953D7F32813D3112A0BA5753A5BD295DFB3B84C0EDBC04FF823D68EE313C4AC012BDB56A98BDD836A6BCDE150DBD66FABBBD3998E0BCDBFDB1BDAF9F0DBE67CB86BC924A033DBB18D33C5E71B73BC019B63CFB97ADBBEC2C76BDA70B52BCF697D3BD7EAD89BDDEF3A03BD64B923D3616463DE06552BD1F8024BD5541C73BE57A5EBDF1B1633DA76C5D3DD8478E3D6939C4BD87BD423D2E1C7E3D3CCC463D53A2D9BCEC15B4BC6879C03CFF5018BDF49BAE3C6387003DA60B8BBC0E968CBBCDA4BABCE48CAE3D29558ABC0537BE3D2761C1BCF4E4A2BCEF15BE3CAEEE8FBC2D4A953DFFC79D3D3C45123D8542A93DFCFD5CBD48D7253DF7592A3C1489D7BBBCF4B4BCDEE7243C66EE763C03BE423DB46E823B4F992E3D6431E53CD944B23DB8DEE6BCF638A6B913EE493D6B48D2BB7A22003D52BB17BD1B3DE7BCD4C1F0BC409D823D519A96BD164689BD624C8EBDA08485BC26C4C4BC0BC222BD0300F1BC6BFEAD3C40933E3D3F646EBD0F028F3DC35E213D0364513C236DC4BAF45684BD19A748BDA673A6BDD93AEEBC2BCCB23CFCA4763DCFCD433D4741993DA4BEDDBD5DB83BBD3F4D9EBC2783643CC37F76BD15DA89BD524F8E3D9E7E9CBD0036E63CBCF9B03DA32BA93C890A463D72C53D3C84F222BD32BB13BD2D0D423C426E45BDDC5D7EBD1918BABC8ADD0FBD80A7A1BD9583BABCF017A03D232182BDE6A6283D34714DBDE9EC9FBD9799BE3D1B7B8CBDE2FE8DBDCD4AEABC1296183D921181BD4A28723C8EC57ABC0F0392BD73255D3DAEC49ABD1F0D79BD5C88353DE6E79CBC0B613F3D0B9E773BDE81C2BD0FADA2BC879A8E3DBBAC2DBD92FE913D526AABBDA2998DBDBE00ADBC0C1DB23CB3D66EBD0677793DC6820C3C4D3D89BDEFE441BD314B87BC2E4E20BCFC78AABC4774B0BCC682E13CA20B11BCBD4390BD8288BC3D23DC1CBCFE20913BADAAB43D509D4B3D8793083DE3DE993BA7BDD5BBE4BD6C3C5641983DCCF5D73D26E3893CA606883D2419393DF0B1673BFF183D3D6548AE3DC21D94BD43B8D03B70614CBD10E2C93C9FCD2ABD6F7691BDE605263DC930913CE7F75EBC7B83963DF03039BD48837CBC4D42083D21C0903DBD9E953D7946A83C8DA740BD9C3AAFBB992440BDE4B434BD07B11D3D29BA87BD80AC9BBDB6F3813D338348BD3B0F503C00CF753D5F47A0BC415410BD8FEE9CBCFD44803D4F0382BDE81C123D083E6DBD00C58EBD67119D3C226A393D6CAFAFBCCF53BABBA3D060BD36D701BD7921F5BB79B43FBD1A3B94BDBEBD923D879D403D9F6A413DC4027ABD72EB523C01169E3D92CD1C3D99F4D53B87CD2E3D3DC1C53AEC8140BD2BAA293DCD6D803D57088EBC65B43A3BDD208A3D2A9A08BD161D8E3D10697E396FF3823DB0E90F3DE695863CBCD4B33DD3CB1C3CC872F23BC1E7DEBB7BF0A53D3705423D6B009C3DBAF3E43C78A39A3C6703C2BC496983BD4F7AE1BD1C0F0E3C8C3AF03C9DED3CBD982D85BD790354BDCB151BBD683ED83C9B0A87BDAE2094BD11EA723D5B51DA3C7247FC3CAB47C3BD92ADFA3CF2F47E3C0CCCC6BCB6C7FFBB5A5142BDAA0C41BDA00A9CBDA9167EBDBB996E3D7790313D288104BD5159803DB7068CBD5959EB3BA7FC89BBD88A63BDC4FBBFBCDA1B16BD22D1AC3D4C2EA2BC69D0313DF16634BD85646A3AF738E73CCE1590BDCBDFB3BD52D751BDD8EC92BDDF56F93B17B245BDEF6C4D3D0D78603C842833BD5916553B2DFD093D8B96BCBDD2672F3D3BCC913DD67C5BBD3E8B4E3D2497613CA845C5BD0351753D0AA5BC3C8F468A3DB935EC3BAC47E83C6B6C033D5A144A3CFF07A2BBFDF22EBD8B68693D7DDE13BDFD8CB5BCC15292BDD2A97F3DE19BB53D6A1255BC7D87943D995A4FBDDA0E853D54A2D13C15C6A83CBAB8D93CE91BE2BC5FD5803C671C863D39FE84BD9C28E5BC92E649BD6DFEEE3C7E6FDE3C972F2CBABB91A33BBF8F483D602658BD2E3FA23CB880823DC18786BD973BA03C177BA5BCD3BCEB3C263A8CBD981B85BC4A54AABDBD44363DBBFD933A2CCFC13DC135EEBC3F04933DE17404BD4C4B75BD0F222F3C9546A5BD06EC93BCB67C843DE100A23C74A3553DEB04383D42C1533D11C3ABBD8A4BF73CC77C67BDD8BC523D1A70A43DE26E1B3D3C90053D62729B3C3793733B7B773BBC6C154A3D760920BDC57C0E3DE492FB3CB1C3D9BD0A219DBC7F3892BD31CDB7BCCE22A73D28AC0ABDEA6C073DDD8012BD9FA88DBD390C66BD83EBB83A9407433DF5E2D3BBAE2D5FBD6761A2BD6CB717BD0FAF683CDFA41BBDBC85793D190FBCBD624D37BDD78E63BC9E273A3D13F9FFBB8C2757BDBB8E633D0CFF63BD28ADBD3C3A349BBC94F0D6BB3FB8AB3C3D4439BDC92FCB3B1F08C43CD937993DD82D61BD5C25733B36F5AD3D7D9C31BD572B48BDB7BE99BCF4DD49BC0DFF973D7BDFA13C4EE124BDC314B33CE4EE11BDFED874BD217D8DBD196243BD13B5283CE6AFCFBCFDB8863DB3DF1EBDB230FEBC242701BCC4D65ABD6B6027BD998D6FBD92B3093C35C39F3BC1E4413B31E8973DE7981CBD70A702BC8A16033D0C4504BDC9968C3D381BE6BCED8324BD11213CBCD2D7A2BD73544C3D8CDC14BDCE17C9BCBCE741BDFB6D94BD6488A03D767D743DA9F151BD50DE3ABD13B04B3DBFF59BBD13CF22BDF185753C203297BD816B7CBD7C375A3D6E8B7ABDCC6A983D468B833D1D60053D6CFF143DBDDC553D429A37BD2545A43D63C54EBC763B85BD7E044E3DBE69DD3CAD1E87BCE07405BC3B04EF3CA6B19DBD5DE915BB85C48E3C7F9FA6BD172D34BD1F30C73C71A688BDDC9C973BB80D8A3D026B063D59F4133D36BDB8BCAFAF1DBBAF6364BC8DC6E03BE034C1B79C2219BD0484DABC0711A4BDC2E7853A2112D83BEBB4FD3B1145A23D4B5E66BDD04E713D404BD23CA6936ABD6A55483D43D464BD24C39D3D5137113D0D2142BDD1912F3D8EE9ABBD5758533CCEFDAD3CC01BB3BC76433F3DC8A2073DC9C2723D53330ABD5FAD8F3DE2318FBDD1F888BD5D422A3C3CA7143B3D91D5BC968B12BC9B0F0D3D7459493D2F2F3BBC50B00C3D81E075BC88C1213DC36CEBBCC1D893BD94F293BD5C4D6EBCB8D3EDBC699D6BBCDEACF43B98CD583DCF96A63D16D3963DF4287EBD63A8FCBCE034353D6E7813BDD7610BBDDDCDFD3BBBE9BC3BF3472D3D90EB85BDB8AB78BD6B85953DEBE4A6BC1D64BD3C58C7803D60619EBC9966143D8912A0BC35F52D3D749D29BD1157563D7D1EC43BD4F3243C8A95753DEA4D533D6068E5BC9753063D9D2B21BC93289E3C73254CBA1DDC84BD314D6ABCE3115F3D0014A23D16CD9B3D4A940D3D77D2543DE08D2B3C2CD634BB13DC603D0B09763D01D7873DD19C03BDEF39713D93928D3DE6D38B3D692961BD07E088BD8E3107BDADFBEA3C708FBE3C8DAC97BDA15DF83CDF7A943C1FA40CBDFF3C57BD3B2E9A3D2D23BDBC1A9A19BC1E8A5CBC5700C93CF843113D752183BD81F3263D23C39FBDA484943D05F0073C070A9D3D480A213CBB8799BC29EEEE3B34B7C43CC8B2B23BC054713BFB54C93C79BD12BD90FB4C3D1F21693D620A02BCEEF1553D543200BD2D3914BDE7A8F9BCE9366BBDA5E0353DB41EE23C061581BC5A0EA8BCD75B92BD424DE63CB49EE5BC313B51BDD76A5ABDCF3665BD06A0373DA9E5323DC3FC77BD59758DBD724D133DEF118B3D513D8ABDDB4C253CBC52D9BCD1EE043D30CE20BDEFA45E3B768239BCE84C18BDCEC312BCD108523D8C33C83BBA2186BDE80D973D598757BD00F5A3BDC899BFBB932B92BC28539D3C0F7F7F3C823F6C3DBCC33FBBF0558DBDD681213C7430BC3CD97837BD9FCE8E3C0CE10EBD67BEA63C84DF0E3D5F2393BD60296EBD0AA189BD4031803DBEC614BD1013EBB916B28BBDF748293C0767AEBBE23D9B3D9D05DC3C30E407BC0F06ABBBB63478BD67472D3D56BB143DAA5167BDFE671D3D1D2433BC11C1EC3B13758B3D6009F7BC539B5C3D819EDBBC4ABAB8BCE20D9BBD513090BC01515A3BF1D386BD2A29D0BCF08076BD50FA9EBDE9EE9B3D9409A13D6653013D114C253DDD835DBD5E886A3D2A1A52BDB74EDFBC8E5444BD2A8FD33C421181BD047EECBCBC8BE6BC0813853DF635E2BCB23499BD5F02A33D13432BBC7F0E16BD54815BBD5BAE463DA34416BCB12DD43C4B82E0BA69261C3C36A694BCD9F7683DB9A5E7BCBC98223DA936DFBCBA42AEBC9E98DE3CE687183DFF72603D92FF543DC6DD99BCDE8730BD6A7E593D9810613C211916BDC2A2A53D050B0B3D58AE3D3D536B973DBCF525BDB4E1C93C2FFDD43C235981BCD1BA85BDAFB99EBCEC3908BC20AC563D7C35893D2C2B953C6A76893DF4C6523DB48C09BCABD225BD7964733D6D4351BD35F8C0BCCCEB823DB04D163D9915073DA07C013C80369CBCBF5E8EBD0D1F173CD1789A3DFA06AB3B77A68A3D4A06983C5F63573C90A6F13C361894BD3308043B6FE002BD6E5C263D76DFD5BCB15E9EBD55C85B3DB516F2BC52D59DBD1B9604BD30E9F5BCEB0EA5BDAC8D85BD96DB3BBDF3F8003D9C98BDBCDEA2D4BCF2B71BBC50D720BCB2882FBCA46C79BD1B901FBD06673D3DE86B853D5FB1ECBCC1BFB03C17F644BBCDF5E9BCB7071ABDA5F7893DF202A1BD64D8293DE590033D64888CBA2BD8333D3C44793D72DDF43CCB9436BDA889193D97AB873CC9F70C3DCD3D143D6FAE6BBDC9E8033CC9A075BCE18B85BD3B532FBD9D7817BD7FF78D3DB542873D14F967BDAA53283D0BFE1DBDA4F31B3D95B8AEBCD09801BD90C33EBDB78AA53D4EAB7B3D58AA7BBCF1370ABD39C584BC83EA853DC7F876BB017265BB4736A1BD56B0E03BC5B2A43D459BC4BC23E93ABD8BF33D3D07D2B2BC625B993D5E77993CD29E753D164E923D94D9E5BCF45E593D9886E63B9B58F5BB99A2FFBB166F95BD6ECE0D3D42A4B33BAE9C8ABDA99AA8BC54026FBDBBF77C3CAB9F693D6B3AF6BC7ECC1FBD715F28BDCB4FA3BD73A7063C6436343C1536D7BCECB573BD914B243DC604663DF661543DD494AF3C18B117BDFEB8473C4F977A3B8E535A3D5E0882BDC95E8CBD924F263CE1657E3DE39FF0BC0056A93CEE52763C60989CBD5EB733BDDA8F1CBD3623FCBC9E1975BD2253A33C1B5782BC25C595BD73995ABDA984213DCBAF85BD8BF8113DE5CE41BC1F34833D9A1B60BDA2DA3B3D88E55BBD5A897E3DEDBBEDBC0BFB91BCAECA2E3D2A3807BDABBD993D23D4D7BBA5CC4BBD41D792BDBE36EABC4B4372BD0EC677BD5821E33C36C13ABD5337D1BC41BA8DBDB78F863D639E4CBD819B5FBDC73B9EBDF1499CBD55768E3D2BED3F3CAEEA4DBD4425483D691B493DBB7B503C70726EBD37A2533D0C39A43D7ECEA3BDA6444BBD869E8DBD45FE88BDB562CABCAB29343D25961D3D48CD9A3C20B46B3D1E79E4BCCDC79EBCB205EDBC5C0D3FBD23DEC3BCDA4C69BD4A394D3B253707BDFC8C4F3D04701D3C4B609F3D780F003D97B6A0BA2888A3BDEAEC97BB70581DBDC6D709BD4E629A3D9A48093D172CA4BD37C69B3D33085B3DAF883ABC2FDF9ABD6F7ECEBBBBE2503D6E656CBDF6CCBF3CCDE2523C2F00923D8E8568BCB370993DABD687BD0A800C3D01CE443D925144BD1CB735BD2666713DB4606FBD7C40823CE1A7E33C9300983D883513BDC8E6413D662239BD7ADE48BDF400323DB560C63C7E658CBD8B1E423D98DA7EBD4E210BBD34398DBDE8388FBD0D6F063D093D0CBD885701BD6652533DFE154ABD90D34CBD4A4D71BDEB26033D42A603BCF64806BC3DC4323DF5333F3B4569E5BC9C7D91BDD6D69C3DFECD273DDED44E3DDCFC643D1B0483BD5C163BBC0D716DBD261B713C5A2A39BD2988F03C5CDF573D9616413DC2E5DD3C792730BD3D072D3C4A90B3BC0C8B26BDC3178F3D064455BD84AB14BD079B98BD7C38F93C5AE8C7BBCA46983CCF1F85BD3175C53BA17F073D4B54313C5647EABCCB30223DC3D45EBCF21A8BBC0A988F3CF44062BD61B207BD1F59763DB0C95D3DF70FE6BCAB8A63BBCD7980BD4BD013BD23EA853D7F5A86BD62477D3D0AE2323DC6DF4CBD46E28C3DBAD4193D678376BDA7039BBD48AE6ABD1A49113D9089203D65D3B5BC12327FBBFEDD11BD45249CBBBE212DBC2901503DE4E0AFBCD3EEDA39A0580BBD64655B3C5605C33C0F56463B0C748D3D8D081CBC51ED86BB39EB5EBBC33B1B3DE0B3183B92867EBD033C33BDDC4191BD6E619F3D547A253DE0C035BD801546BD3EF236BDEA8DE93CD89737BD007414BDE90C34BD4F272CBD0FD98CBDF69DE7BC04BE8A3D521D803D7E7901BD844BF5BB46C0953D2E30BF3C11E29A3C1716963D915F8DBD2078513D7547A13D96AD923D1E8F923D3A038B3DD8AA42BC0CA583BD21871C3DFBA2A33D4B2CA73DF8B62FBD1796383D5DE15ABD883884BD1A78503D1CB7DA3CF68EAD3D0CA727BC61771BBD1804203CC79BA6BBBFEE0EBD28CCC43BECA060BD9ACBAEBC88E2A33D09E8503D0A70023D3B2A363DCB8C9C3A7FBDC3BC1B5721BD7B351ABDB30F9CBC4510DB3C21C7F83B6DF435BDFB37433C70038CBDF48525BDA681BB3B3FDAE03C9E64833DAEF2D33CB57B1DBD81218E3D36B40ABCF3B1893DB69BAEBDE1390BBD71E2273D8468EEBCE3A58F3D004A4F3C4C1D883DBF6A30BD0564843DA2878DBDF0423C3DA2B4143DEFEC1BBD93159BBC599E743C9FF109BDA0269DBBA6E708BD0C335EBD5E203C3DC4BC20BDEADA693D955386BDD97C3DBD971C97BD66B3CDBCF5A1B3BC67D9863DA09EEDBC061329BA3B2A50BD7DADBABB4CEAE5BC747A81BD04A9E03C50E0023D675A8CBD41CFDDBC12718C393DDB853C248023BCD5A57F3DBA72973CB88E9DBD7CB991BDA6009A3D467D9E3DCC388BBD380C1CBD8D1B64BD63F236BD5B59AB3D409829BC27A0663DA49A933C6BA63D3B7A53E93BD2A730BDA39C36BC11CE473DF2A662BC053E96BDA784A03D705B9BBD24944DBCBB408FBCA402273D1C1EC43BB42A923DB97793BC9ED7C4BC314984BD4B01883DFCCA0CBDA668383CA8675EBCD71D683C3578723D359C28BD1BBB8B3D205124BCE1348C3DF08AF3BC230A753DD70FEDBB67BE36BD54B13E3DC47BA43DF18178BA3BF4CB3D13360E3D5A0AACBC94088DBB6316843D4F6E773D3A9E9A3D0A77B73C1AEFD4BC4FF2783C6AEB833DD576EC3B539D553DB800883AAF05D13D432C843D0E5013BD7CEA0EBD4A7FCF3CA3E91ABC45497CBCA5DD4B3C47C509BDB58D5A3D3A135ABD159B7FBCFD28E6BC4268E03BE9586FBDF59F9A3DF27BA4BD5B8C9FBB44072F3D85DF763B7D9C30BD9AEF07BD77D5B4BD77EB1BBDFF7B90BD2DB201BDBE21CF3AC69D81BB74B024BC58F0863D96D2163DCF2963BBDCC49FBD640866BD3874973C53AA543DE8FAE63C579C0E3C95F7B5BB46EF833C2B9657BD7089E5BCE29353BD078F6B3DC59E9B3DE83F963CAEF5053C2603BB3D8CF69ABC70AF35BD4C690ABDC1A74EBCCF8B893D8E6EB03DEFE3C53B803CC3BC2FB9873DEEB5FBBC5EBBFF3C0543FF3C617B9ABDB40612BD2AB0873C97CA1A3BC67ACCBC4742873DA06686BD2DCF693D2B6305BD489D403D1462763D0169843CD6E5643DDF25AEBD83487BBD355C61BC328B3FBD082F54BD84EA47BCA320B0BCB2F62F3D3608EABC5BA1623D359FDEBC1B5048BDD49EB8BCB30380BDCB9D483DC37279BD87113C3D555D9F3CBC432ABDD3AB09BD46F05CBCABE09BBDE2FC823DF86F2CBD15B0C93D82229F3AE62EC6BC6AB262BD0811353CDC625ABDAD1D48BD94819E3BE00D96BCD63BB93D66044F3D22C6C53D980E0C3DFCA6973CA773CDBAA3828ABD75EC023E9ADF26BDCC549A3D5828FC3C0F05A0BC271080BD3091F4BC2C6096BCCA93B83D933D263D35A17EBCD460A1BC2B93023D0DEEE0BC9754A6BC8CB8243D6E91B83C7FF372BD50B1513D38EA31BDF33CBD3CA291533D2A32253DD500C03D9430323D646BF0BC2867533D9A80DDBD2FEF2D3B0FBE1A3CDDA5C1BDFAF4463D632DC5BD5822813B68B987BDC9DC06BD135715BC6BAA9CBD9A7213BD9B7F063D65EA423DB0FDEDBB451479BDDE90533C40DAF2BB815F8E3C1E9B5DBC8BEC72BD516724BD3283493CACD19DBBADF84EBD084420BD01723BBC246B0BBCAABCF7BC38A902BD340473BD311197BDC4D57E3D892142BDB4141ABD6BBBF6B9F12EABBD025AAD3CE408783DA7A9A3BB0AFECEBCADE8183D7872EC3CFD2F86BD8049933D67E69C3CE8F4A8BD05EA4D3C964550BDAA34803A26FAC83C46492C3D0990723DE579FCBB606FCFBCE77C353D32535EBC21BAC6BD713287BC920C36BDC39E90BDEECB8D3C5D108B3CAE92443CE64CAE3BF6509C3D826B91BDB92E63BDFAE821BDB3C5263DB59CA8BD9D8555BD1D30E2BCB030A33DDFE790BDBB568E3C115542BD2E590DBD160FC03D6EA391BCADAF873D18CE803B7393DF3B439480BC46A3833D4F4BD53D3A6764BD53079B3DE9220D3BFCA4943D563983BD1EC191BD501D3BBDD7B586BDA742F83C5E53253D3C26B2BCB8C03D3D1634903C8D09DDB800753D3D58C4CD3C684A8E3CF108AEBB75C3BCBCEB126ABDBD8DBEBD94F3A83D9837283D2628A83DEBFE723CE3F00A3DE0A5623D1CE78E3D2E7196BC0C62F63A4B0B083D2FFC80BBB664413DF4C168BCC478543CE5481ABDDA26CEBDB91FD0BCA88E2EBD494F22BD2879923DCE66723C8863C2BD1BDCDBBBEC0720BD21B38E3C9645763DB19E40BDBD979BBD59DC9F3BE173AF3D518D82BD3E3A603D73047CBD22853DBB5CCF6FBD4C2571BA8FCC0D3DBCA9F8BCE43FD0BCCC3F973D3466793AA75665BCFA7BD33CC065163DB02E543D96959FBD844320BDD6EC423DB9168BBD51B29D3D6D52D7BC11E595BD5C50143D2C1B68BC77B3433CA2F439BD7CB2A83D54D7923D11C1373D3F85D13D4FF07D3B14901EBDE30EE03DB9B65ABDD23B8FBDD8C5C93D50FB80BDEEF7BEBDBE613EBDADF7783D3A90683D776C02BD755C963DFA46903DA31F863C77C9ECBCB9C5453D5BBA433B08978CBDEFA4F8BCE3A3AEBD9FDEB13C4F750EBD0586A3BC0FA9FE3B80AD52BDE0FFCB3DAD43273D586E2F3CB9BEA0BDCDBB083DEDC7B3BD80C03E3DEBD3123D906A423D76CE713DA06F00BD3432243D38A2363D88063A3DD049A8BC5611A53DE859ECBCF8FF973DB13227BD9DB2793D5AF704BCEA0817BDEBAE24BC11ADD03D4817463CA7461F3C40CA703DC0B782BCA72917BDA3C759BD8A5EF73A66FE95BDA58688BD60099C3D214486BDCB7391BD6FCC603D3DF2DD3DE337263D492157BD20D389BD8F04803BE6D39C3D396AAABD02D0883C7CACDC3CD8FD1D3D8DED0FBDB0B609BAD1D2C7B99ACCF43CC54A66BD069D153DA5E44D3D909D07BC83EE9C3DEDA3C5BD87CEC3BD52FCCEBD691B543D37E4453DBDF5AA3DC24DB0BDD086E13C8AC6983AA3F78E3C06C6E9BCC6E539BD521EBEBC45767EBD8821B7BC5115043D15AEA0BC4E8C263CC07C953D3D8A633CE006E63C3F4D9CBD586930BD0DDD8E3DED83F73CD2A9083D7371AFBD0D40EBBCBAACAABD4CD881BCDE66093D102E97BD683DD3BD85C1563D3844AFBDBD91833C96F1983DBBDE8AB88E6F233D0F86D2BC9346ED3CE9DD8DBD2F921DBD76909ABDE1CF47BC56F7533D3BEBAE3D346E3A3DA9549B3D2ED08CBC3898A63C20137F3DE55658BD1356DABDE463B63D204DEA3C8A7DC73B22313F3D1C3C533DA08039BD3CD9973C1DB0F7BBEFCE2CBAA90BE8BCFA1688BD9D9A0B3DA9D6D6BC02D491BDE2CCCE3B0650C13D62287B3DF73A0C3D8062CE3DD26EAE3DDAB9CA3C79660E3D207F18BDDBE672BD4E07A6BDB88BA4BB3CD3AB3B48BEF9BB034928BD31111E3BC366213D702F93BCE273D7BDE9AD043D6F4BD73B7C8024BCD5ECBDBDD42BA43DC9394BBD88A941BD52D2303D4DF402BDF4D97D3D15625CBD1FB5C0BD750A6C3D40B7733DED5B9BBD17D2313D734B173DD493B2BD228BC03D52CA86BDFFC0C9BCE3D730BD8A38C3BC856681BD644C3ABB963FA7BDFE8D85BD5994CDBC59AE6BBC64D2953DA4EA143CCD628A3BB38F213C7E9F793C29B31B3C0B9756BD92F01CBA5E0EA93D224FBEBBB61981BD645FE03C8C02B0BD864586BD3FE751BC0D8A143D3055823CB9A70EBD6E3106BE2AC291BD6697C43D5A924D3D0ADAF1BCD10C74BDCCEF363D1159CD3C76FBD3BD89400B3D08C0A5BCCFE5F8BCE2B7CEBC97D60F3DEF663A3DDCEF523D0F0C923D4E5225BDCDFC4FBDC0E9DB3D3C3582BD260BC8BDBEE58CBD59B68D3DF2ED133C9623E6BBEBCE17BEA541B43D1DB999BDE0E7FCBA45D502BCA3C6F4BCE494EF3C8D638FBDF7959BBDBF621BBD95A73EBC43FE30BD9254623C219535BC6D3CA83D8235643DDFBDC3BB3E76B83CD0E44F3BE1CE813DBD793E3D2FBA7C3CE8461ABD8C0F85BD4D0882BD8B777EBD06453FBD55FE81BC4F08973DAB32F83C340A08BD3C10BBBD04C1763C0F8B2EBD54F380BB4A4E173D33D8A2BD7B0AAA3C3DAEB5BDFE3A853DAFB3F63D5C87573D513154BCFB9A64BD1CEAFEBC59F4DFBC33E3A33C2E9D45BB72229EBDFB352B3D34AB693A9B4F513D36C4663D53CAB43D1F2C3BBCC3A398BCD77B90BD06F5B53DC566F33C9A6974BD50014ABD1F3EFEBDF966DA3D2C413ABD22904EBD353A90BC7F1E193D809C1B3BD1F2A33B591E21BD625F573D547C063D6464C2BC98F0093DBF4F3ABC5891DA3C4EBCF2BC59DE733C0E2DE4BCE4D101BE4D210BBD7D499DBC4C88AEBDEED943BC135DCA3BBE1F763D91F8C53CEA20823D3F104CBCA6E56CBD07D7CD3854FBAFBDD0A56DBDD518BA3DB5A9133DBE735C3D04E554BDFFFD8DBD399DB7BDF67102BD2330373C67AD86BD279083BDED049D3C0F1BC73C7DA67E3C2387B7BD29FD113DD01F053D643E04BD10C752BEDBB3BABC18D617BD0AB8C639108D933D449218BCA71F70BC3C632C3D70CA8FBD2B48643D432E8ABD978A7F3DE866A5BDDE9292BCB191993B54918F3CA8D9A63D5B9C833B37D2AEBD45F7573D8A65AABC4167683D624BD93B0F627C3C0E1B3F3C716098BB758D74BD562071BC835E13BD9D602A3D221D4F3A1260B93D66CFE6BB939F223D995E09BC9BF4AD3CBEF91C3DEC257C3DA5E0773D6C51D8BBAC13DD3C144E0A3BEA8E9DBC7FCF91BD5FE15BBD9E4962BD4B422CBDC6D8723D39809FBB9F399B3BF42107BD657DC03C62E1CDBCACD89EBDC4CB943D2F06123CD9DF04BDC1EC9C3D33DE6E3D7687B93DD1F1503D374101BEC071DC3C4D73A4BDD8B2C5BD658CAA3CB02F04BD34FA593DFD02A73D063B98B973A58DBD00C4B83D028D29BDEE617CBB7AE5363D65372F3D8409FDBC8F5FDC3CB5E3803CEB68BDBD523B3A3EB95547BA125BE43C4E14E0BC4BC00CBD5BFAAD3DA0A10E3C8F1F63BC4DCC2DBDC014C53D716E27BC3489293DA83205BD22ECAC3C10CAC6BCD9744B3DE888A03DE1C00CBD9A25C4BC3087B9BDD1A656BD69C5EDBCDB898CBCB174603D6E50ABBDBED211BCE323A2BBF315E3BDD38E99BD8B342E3D712A173DCA5A8F3DEDE04D3D2890E13C3EE332BD01AF513C7B58A7BDEE019B3C0B5B24BDB889B1BC5E0A93BD33E33E3D8A9C0E3D46AF2EBCA33F65BD2E2C40BDDABDCDBC24D7AD3BE3722ABEB3532EBD1ADAA8BDB355193D285D1D3C64026A3D661E90BB32B34BBDEA9A883D6BF8CBBC4B3F90BC5AF1683DB8ECCABD802A09BDF3AA9CBD28911D3D631E523DD77A59BC2DB8C1BB28444E3D17F9BBBD49B4A03DC20AB3BCAC5FBE3CCD672F3DA3150ABCDC98983DBA2F2B3D822280BCB4DE03BD07A99C3C8AE558BD8EAA063EB1552F3B3639883D956BF13C93E9BBBC96F645BCE6E92CBDA6FB8BBC3293723DBBD7FC3C7F8BF5BDCA82823D38B4FCBC2EE12D3D20CB063C97FF0A3D20ACB93D7F239EBD269CB53D946D47BD7741AEBC3F15A23C14A8983C412F423C93808D3CAE8A2D3CD9A7733C237D973CF6F8AE3D856B98BC6858A3BDC16E2CBDDFCCC0BD77DFADBDF837C13B3D6EF33CD8DF50BD8806DCBCF73086BD10CBEC3D721188BC855CD1BBC78418BDBD0F8FBD50CA233BA85448BD5009803D7D908EBBE26ACB3D6D0F07BD5BCC893DD7D1173D47708EBC4307433C2E8A3CBD083386BD998C063D03034C3DA4A1AEBC2C06F93A9A27DEBD249E733C46B0543C15190C3C9A7A543DCD3BD4BD4AD1423D8F10C8BDA628BABDEE3DD0BDAAD180BD6AA51EBCFB553CBBD5FD3BBD1AADC43D6D93F6BDD43F85B90E4893BD072428BC2277E33C3150463D720AC73C399B69BD0C08B13DC1F7403C017294BD36DFC338B25C0DBD56B2F7BD4796823DFFB3003E660082BC859FA73D2EF491BD010B30BDF389C0BD665F2FBEB69837BC7FA488BC06A13ABC103B933DCD224EBD825211BD0DF9EFBC6D91723B85B9C1BBB3DF2DBD278FCB3C733D2E3D717B36BC2D26BEBCA3C472BD28DFFF3DA1A43F3D6D8BFFBD509BF7BCA0B8D4BDEF8986BD1AD5003D7259073DD112383D9E3353BD8F0CD63C2291C5BD55893C3D33EA23BD91172F3CBBA156BDE98F503C5ED3513D2E7D1ABD0B8F47BD094852BDE18C98BDC23C62390089C93C388BE5BCBB955EBC8DF283BDEC3A51BDAD59A7BC44BF053D67A0A1BDE1BFD7BBEAF1D53CE6C3963DCC26373D9550D8BD67D5F33CE89A9A3DB09B273C87CACFBCDA1D983A12489BBD8B50D43D7FFD543DA680E83BD51F36BD03D655BDAE1E36BC2B153CBD9CC08CBD25D574BC6D3F8ABC7FC1A03C937D9DBD18EA483D607E623D3794A6BDEDA4883D259F79BDA8E57ABD1CF2C53AAD7A37BDE0977BBDE0FDBFBDC511C13D3A8FE63C07CC823DF271C83C0ACB90BCED448BBD882ED13B6781C0BDE9C161BDBD3BC83D4B22583D194FD53D32CAD1BDC42175BCBD25D8BBD628983C47C6F83CFB21E4BD6278073D446C6CBD788739BDDA5278BB4ACAB93CA451B0BD881AE2BC5627D83C6C04043C166AD33C0C16F6BCCF860BBD1D944FBCDA5A723D5969D53C6F38E23CB98497BB6276B93C8FD8C6BC190BBEBD833491BD6A32A83DC0B370BD26EAD23C07EFBC3DDF11933D1B3325BD906E62BD41B22E3DAAF1813DBC9C31BEB03796BDBB193C3C965FAEBBC8C9DF3C5FBDB3BC2D1B31BDF3C47B3D680B923DE0FE043D2F0B28BC740F993D63FAACBAFB0D06BCFB6B0C3DC7C5C8BC07192EBBB430AB3ADAD61BBE7426913D9B351DBDD1CE1CBDDFBDC2BC82ACB33D82D293BC50C83BBBF622183D3465B4BC6FC96B3CE4DE75BD19D16EBD5CDC9E3DAEE1353C317ACB3B6A6EC83CFD0587BDB0D06A3DE3B93DBDBCE4723B49E6B83D8A80A13CB1AA12BCB403A1BC887004BC19F6D63C6EEBA1BDC3BA68BDF517833D9E71133DAA6608BCE0EB873B07D619BD0D979B3DBA7F6ABB7F994DBD2B81113C36C48ABD0375833DBC91C53D3D91E83DD97C113E40298BBD2991C9BCE6F952BC2BD5023C45773CBD097A1BBB8C551DBCE99279BDCA2F0CBDDEC956BD1792F53D7C3384BC7CD9D53849FE253D10DA3D3D52FE9C3D4B06743D60B6B43D077EAEBD937616BD2A938F3C8936C73B471E68BDB084863C65C4A6BD88272BBC86D2D5BCB97026BD3E0B81BDC993E23DBA6DA13DFA2E5BBD1BE5803DE35CB0BD9EBF713D6A7D5BBCE19D90BD098392BDAB6984BCF580983DA7E972BC4DD3923DC53416BE86AF673C73FA76BC884E07BDCFA5293DA735C3BD794531BB90BD3FBD5652F4BC3829E7BAE5580D3EACA7CDBDE5FD803D0A25F23BC53E9EBD115A94BD69A21A3D181ED1BDD5A935BDB0A3823D87A011BDC28ABA3D536C6EBB1B84A63C4EFADA3D2F0842BD980F43BD7057B93D3F7A8D3D8AC9E23D50C05B3B03BD3E3CBC88BB39D03A1F3C73F68EBD2543303B6BF4773D80B4263D2E23DA3B16B7D8BCFABAABBD6679E2BC146C9FBCD0E604BEAA032B3D7349A73DE3D584BD052286BDFB63A63C5A863F3C848C5B3D3E16543DA1550ABECB974DBDD7F627BD5ED7F5BCEDF33B3DA42BD0BD05D1D53CE86FCDBDEB15D03D302386BCE05F26BA5F639B3DEF68A33D424CDBBCE60536BD97268FBB0F0379BCEACB43BBC3CA723B76B382BBFD92813BEF2F443D3950CCBBBFB211BDB92FA7BC2F96033C52A6DEBC9E265E3DA5E72FBCEDA856BD40E034BD77567BBDCAA3873B253C053D6DAC0BBC32EB46BD7316923B62B1233D5A5EB33CF90ED23CB2F0713DCC4739BD399DB4BC3F18A4BDB596013ED7189CBCD5A26CBDE14A113C749C91BDBFADE03B4664263D879B5ABD75E2B0BD3C618CBD5404883D196E973DAE963C3D7C59B23DB9609F3C08E1CBBD3F7D983D14EA973DF98D50BB4B4ECB3D7C20FC3C2029C03C0167E63CFC0D7CBDF36231BDB910953C561581BDB0D3A4BDE03412BEBD8F56BBA3BD253D97F83EBD0A7ECABDD49521BDF407E1BC29757ABD56AF46BDFE5F01BE7ED543BDDD1479BD3B77643CC78B39BC5303033E58089A3C3F95D23BC4A6833DB8892EBC6D8E55BDF6A83CBCEB2053BCA91FC2BD796C533C83154DBC79F93D3D40F0BB3D538F46BCC4A5023EF35253BDF8BB5F3D0D68173D0C10333DB782083ED6089DBD1DB3343A81B2ED3DED4B8D3D07D2CEB8DE697CBDCAF866BD6DAD373CFC0817BD0C3A93BDF592573D43EB95BDAB3932BD83DC0CBEFB29BD3DCB3F80BBE3CD8C3DD9189A3DE8FF1FBD138C343D9749FDBB6C6142BDACA06CBD71E1C33A7F8DBFBBE771023D13A1A43C58B395BC6AD393BBEB526ABDE5E6B03DC245F93C0BD629BD0BFA3C3D6981423CEDCFEC3C24101D3C0AFFBBBDFF6716BDAE26133D9DA5B8BB9FB8E83CC9F12A3DE2FC373D12932F3C8A593DBBC9A55B3D06C1533D343C43BD5590ACBDB8A6843C578D91BCB994973CDB5CD3B9D3F233BCF31A8EBC31CF7BBD3A2743BC8FDC0A3DC4E02B3DDA24D2BDFE58AE3C85D6583D49CCA8BCCFE1EFBCA76E79BD2C996C3C22D591BDE49597BDCACF2B3D579DCDBD7091C33C2283993DAFDDA13D67C71DBDAF530CBD101037BDB80DD53C31C473BDF6B8E73D6CEC35BC98B84E3D5D70BA3CD8F83DBD041DB93C8F54F23C259371BC747F293C4515893DDD7D663CE6A1863DD88E98BDB5E822BDA755423D1739DDBBAEDBD23D4B82C5BC82FC14BD6B048FBC7EB59F3DA052D6BC4639A93B17CDACBC8C45DCBC77B4473DBAE90DBDBA30A3BD8A4905BD464806BD13E29EBC396BC2BDDAFB563D03D2383D1FCC5DBD8578BC3D66A3213D836052BD19EAA63D37E333BD7F7E1A3DF3BE933CC20BB83DD34AD43CA585F93C07C78BBD1FED1E3DFA23CCBD86C1343D92CDCC3CE6CC08BDCC0D903C181A943D53A8AB3C05D02F3D53462A3DE6F34D3DAB4EB63B2E6A6D3DDFC12EBD586E9C3DFC8688BDA1B6083DF79CFFBCAFA1CC3D80950A3D17CB3E3DD9C2BC3C873A44BC9FA5203C2D76CB3CBAF855BC2D6FD83D1D75923DAAC791BD735B733D7E3051BD04B9253D82C2C93CB9D417BD45CB5BBD2DD8793D814B593D613382BC57BEAB3B17051C3D8CE6153D9DC0613D8F7056BD36854A3D0271ABBC309EB1BDF755D33D4F8A7A3D5CF1673AFF44E83C462A9C3D2DCEC43D2C299C3C9E20BB3C8AA199BDA4EA6F3A2BA0F33DBF4C683CD77C7EBD00095CBC746297BDC5982E3926903F3DA05AF73C094B8B3DB30D883D90B2CDBC0E2227BDF0DE49BA2257683DE0F12E3C6F079D3C5E5E403DED21893C6FA177BD8DBABC3D9C2C823C1E04BCBB2749013CB786013D624CC23B96903ABDCC77DFBBE2C897BC5898E1BB30CED93D8BC8BE3BAF6EB2BC37F52BBBFA35A73DD356C43DB47922BD35346A3DD151A03DE33F9BBD5F6E6F3D61161D3D17A836BDD8A08F3DA2E673BDBDD8923DB5CA233DF38C6FBD1376043DF359E4BC1E3E15BD4C56D83CF91DCE3DED840EBDE72BF5BC76A5CC3B9F583D3D12FC2B3D212D063D4651C8BC22A6403D97C871BD5041A43DEFC93E3C6F7781BD5F16733DAE640CBDC1B596BD557E953CA61BE53DEADCDD3C31852D3D65AB1FBC363822BD0707C4BBDBFC323D705E89BBC9719B3BB480CC3B38B2953DFC581ABDBFDAAB3BB776AB3D13FF053D76F26C3CEE8CB03DB199943D582CF3BB1B856EBD7061783C8AF69F3DE7DF98BCD87F40BBADA987BC90E7AABB42D01A3DA4C36F3D7F70323D4CC641BC822D9B3DA2D6AB3BD7E7D0BD28439E3C6A27483D51C9ACBC677FE1BB413FCD3CF640C4BC4773D63C64B5E03D0F3B28BD50A2E13CE00A35BCB4EF3E3DAAE8D03CF844A1BCF4D635BDF26E66BC18832F3D21A47E3D0A744BBDE09EC83DCF7252BDBFABB13DED030E3D9225ABBC6342C0BCC8854DBD70E4863D5502203DC2F5803D25D686BDEBE422BD767F5FBD165533BD1C97E03B46C8A73D0119FA3A6F0A20BD4E77953D512BA0BD80F9333DC516AC3DE998A8BB716376BD1B11B8BC505783BDFE9979BDF1D7543C5BC6993D0176A33D1E26863D67E5B7BC109BD63CB647CBBCCAE506BD482C593D8FD9183D248A5BBC4D4C853DC0B86D3D2F758DBD2C3DAA3D14E78ABD58616A3D1BF82F3D4346A13DE74E7F3DBFE262BD4DD8793B72BDBEBB76C0CABC5A37C73C73EB3ABD48E5FF3CBB49913D8D9E4EBC1891C4BC979DAB3D7ED49C3DEF96933DB2D2B7BCEE63863D7D445ABDB1F6B0BD0926513D2E0B0EBD3CE563BDF34BA93D06975B3DC20DA43CD4FC213DA2E0753D4FD25B3D65E1CFBB59B31C3A9A5641BCF8210CBDD654603D5A22B2BB0E16123DD84C6EBD6512A8BDDB3E82BDD1F3ED3B4B628F3DCE909EBD8D2A35BD5C7736BCE7066DBD2441D639FAA1A2BD4B0CFA3CF3DA7F3C02FE963DC5D9A63D054EF6B939F421BD31E05A3C65F3D53D574BAE3CCC8C0ABB21158DBC1086D03CB9F682BD476A6B3D1553013C90DCC5BB1F965A3DA4BEBEBD849E12BD2AED74BD0F8B0FBD2CF5D53CEEC2C4BC8816583CF1F322BD42DA9B3D3CBAB8BDAA616F3C4DA4603DA4529F3DD2B8873D9BC2913D4F29D73BD07C853DD1023F3D7F142BBB49A5CEBB2255B63DACF2053CD56D283DD746353C09D756BD95BD553C69A82BBD39058A3DFA58A73D89ECC3BC8BA0713D9F7F5B3DF5AEF13C54E0ECBC61AB5ABD0229AD3D02354F3DAEF185BC2B370CBCC5E75BBD8BD59B3D7938BB3D7DCF49BD9DDABFBC4961433DB2D980BDCD9E90BD7FBA58BDA94080BDFEAC253D3A3E043D9B37D23DCF44AABD064B34BDF6F67C3D11E29CBD18EBEABC601DB13D398E9FBDC32D81BCEB18A5BA63358ABB7B0CC9BC2E3C823D9FB53FBCD1CB88BD1F449CBD556DE8BC8FE0FC3C853528BDC295413D244082BC2823943DEA46713DDE7B913DD1CDE13B2A7B9DBD0278AA3DC3AEEEBC3A3340BDF2F2213D0209E3BC25A77A3C6D6ED53C9B05613AF9970DBD92920FBD1B7BCB3D9DF9003CDBB19D3D9691E7BC54A840BDF72B86BD275BAF3DD3BF2F3B20231B3D9737AD3D43FB9EBD8BAC2B3D4B8B93BD4B35F6BC6015993D7381863CAD519CBD5F653FBDC80EA7BCA81E0ABD7999FB3ACB605EBD210F39BD68B666BCA95A70BD7931F53BC2AEA53B04F351BD886834BDAAD814BDEBB4443DE1E2AF3D2EB09BBD3452503D9EA6AABD7513B93BC570453CC5B14B3CABCC343C5D237D3D1A8FAF3C7DF600BE4A5FC63A39A3293DAE8B59BCF832123D3B5D19BD04A4BA3BA20201BDCB0534BB5AD2DBBDAE606B3D38890A3C970C7ABDF2804E3D558A42BDDAF6D3BCDB6B633D0E456A3DBDB4F13DEEFE573D1FFEB0BD8DE6C9BC2BB4F03C00642ABD9E0EEF3C836A2EBDACD1893B0BF639BD6545AFBA2B8F273D9AB566BDB4138B3CD4423BBC9CC30FBBA9CF0BBD4FE1923D5C5490BDE666A03D6FB32CBC6EF2983D53C0533D8E97623D170A8A3D62CA643B69A8783D0881373D3EFFF9BC95B8AD3BE5550ABCFA35223D9BDA903D2C120DBDB11591BD6BFBB63C531449BDC64987BDB12B0D3CA1EED73CF1204ABCB861003D521DC0BC88B227BCACC201BCBA92083CB074A2BD61AB96BDB550953BA06586BD542C723D127348BDEC0F60BD009726BB26F0B63DB68C5D3DD61DA4BC50BE203C6BE9ADBD5580043DA33E16BB0DEF3F3D21109D3DEEBF46BC81AC4EBD9445AB3A1ECBCC3D4660BDBD5122AB3DD73F8EBD0D2490BD475AD33C7CE46B3DE1E7A1BC2C007FBD2725023C8F0556BD5FFF2D3DAA1AB23C309031BDADFCD1BCAFF6B6BD855C803B413E7DBD19EEA2BBB755B43B9D81DEBD361F59BD2772F53CF6DD6FBD583CB3BC7BFDBFBCBE9B9DBB75783A3CAE90D8BCCBFCCCBC621E93BD80FD8E3CCF38C1BCA5F3EA3C03B63B3D86DAE0BC207B823D70295D3D917B3DBCEDC6BFBD3406523D3A5BA83C54712C3D489992BC09E2673C170608BDB6CA81BDF2D69CBD6F9F8C3DFD956EBCB1AF47BDFE444F3D8213E5BC9103E93C04E279BDAB12CC3C19DF8B3DB97A0A3DE577A33DD7E115BDDD4F883DF195ACBDA21E983DB8BCAC3CBC1324BCABBE2F3DF928843C8A418BBD367281BD7DAD31BD76723D3D34C6EFBC4991C13DA747CCBCDDE2823DA58E873D827885BCBD7BD1BCCE777A3ADCE80D3DDF5740BD0C09763DC87F8CBD0799403C39DBC83D438C2D3DCFE48EBDA0049E3C506D44BB73C39DBD1434D53CECE936BDFE1EA83D8E57403D22E84C3D92BB4F3C94611D3D3422E2BC24F1AA3C79632E3B0B095EBD0B17373DA692523DDCAD233DECF7CB3CFC7932BD5C1B89BD1C69B1BDC7F62FBDA334A63DE9D595BD7E71E73C7A3295BDAD7A3CBDC793883DAE5258BD11E52DBD2A317ABB7694973CCEDC91BC2ED892BC8D7E933DC4F6163D35B30EBD86116BBD7EA6883CB1F382BD053D05BDA1CCD43D522304BDE40BBEBCA302593D2D335E3D355A2ABD0C26E2BC6FCF043D802B13390F4252BD66DE6E3D5377123C86E5193D493BC73CD460A43C9FAE43BD8F3BBFBCAFC71C3DDE5994BDF83E64BDD3D187BD3E7FCABDC7F3673D9C2141BD5BF023BC685B5C3CE4A390BD38BD32BD9AFA4CBDEAEFFD3B37D134BD9A779F3DBDEADE3C62359FBDE8848F3DD7F0223D4F6A923C6FCB8D3CE8C96ABC1EDEB73CEA0BB43DA3FFF0B93557DA3C454494BD6C2DAF3BA51A313DEE82033DB0520D3DB8D1043DD8561D3DF5FA68BD2690A5BCAE699E3CA216C2BD8282233DCE677B3C08CAAF3DEA7F9F3BF942C23C9BFF493DFC8E6DBDA10A3A3DED011E3DE2F85B3DD1F61A3D4BEB8BBB404CA9BD36F491BDAB30393D5B86BD3DC77E913D56C9DCBC912BE63C376428BD90EA613D48CE9A3D1708F13C4C4C4A3C0BB590BD086FB03D51B94E3D3BC1E03B816DCF3B9B33833DC5AFD5BAF2D385BD57F770BD4237523D6AE134BDCBD9B63CCF37A93D8836583DA60682BD4E40243DB1D405BB1B52823D187C14BCE13AAABA10C5FA3C8BF50CBC8FC2BA3B291060BD8067F3BC832D5B3C2E2435BDEADF61BC8AD4DABD3BD5DABC630223BD89A499BDC6FC1ABD8C4E0BBD3FC9303DE8CB48BD544E103DDC6F583CCB0DCD3D45FC863D50E7613C44CBAE3D3AB12CBD49CF9F3DC2DC483DE880CB36B2C38F3D26ADC3BC58E2283C1272893D588CB03C1ACCF5BA6E6E453DD8D875BDF488823D56DCAA3D46FA8ABDD246C2BC5629D4BAD8635B3DEB36B33C127A153D8E54633CBBD1B0BD4F036EBD8228C5BD0453B93C9A17883DC73ABFBDD6B3923D3001CEBDE9B9AFBD14392D3D7E07AD3C3C122FBD0146233C62F34A3DFB871A3D30D763BDE063EC3CF38296BDC7F936BDDAEEF73C7AE907BD22BC4B3D39919DBD45439B3D777BD8BB3C2311BDCEC2F5BD420FF9BC63A7D9BCE973E7BCAF3035BD8D57E53C988C70BDCAD94ABC4F46363D269197BD0EC9DC3BAA299F3D27858A3D501F44BC6D8C00BCDE753FBDE2CE3ABDC48239BD2FDFAB3CA86E993C780DB13CA83DAF3D0FDC87BD353BB13B3428BCBD148ABEBC9F28A83A4DD7253D4C24AFBDDDBC003D9C1619BD4B7A483DAF0F50BD8AD4103D7E60093B3F5983BC84EB26BBF9CBB4BBEDBC2D3DCB1D673DD167F23C35CD3DBD1C8063BD9C4DDC3B64D11B3DFA68A9BC406B74BD58A199BBFA6993BC49DF0D3D75A85EBCCE44FCBC7EDA943DD3391EBD32BD623DB440F93CC2B5823CFACF143C807B64BC1CA49FBD63FD273BF5A586BD39BF1E3C7B59CEBD7D3555BD115D3CBD2320B93DD95687BDF63CA6BC50AA9E3B9C970F3DBB95203B1DBF9D3DBADD84BBF532983C16C5163DFD26723A33F0653DBDB703BDB974823DC0BD7B3C69A1A23DC5C0CC3D7CCED23C16F00FBCDD0A7B3D2AACCA3D5C1C28BD6C04673D88A3A63D380399BD8C7E79BD8AC3513D8A0948BD61455C3CD26A36BD3AD8373BF0C62DBD14850ABD587D1DBDC9735BBB27879BBD66F723BC6D0D0C3D72BA7DBD0AA5D8BD74AA31BDCEE271BD19ABB93B577EAFBD03D09ABD817265BDA5388ABDA9DC843DB1CB06BD342F7E3B234F9ABD220A74BC513F9CBCD75E3DBC84D8893D1F30203C008419BCA61974BD4B749BBDD6369FBDBAEE05BD3EFDBE3B3A90CCBDCAF6253D323206BD9E976EBD1630673C665780BD7F5B273DF7F82F3D69DC673D93ED883DDC49AE3AA84177BBC7B07B3D6A7D013D8AC4523D0D9ACEBA71B57B3DA706903DEC38043DDE1408BD3FD20FBDBB5F80BC4F898ABDFB23A33DF930CABDD8C4C1BCF8E99BBCE0999BBD7D18053D15941D3C8EBF433C64AE7F3D2990463DD8D1B53DD6FBDCBCBF1F44BDFB5467BDF119FEBC7DC39E3CD8A32D3CDA7F553C8E90853D045280BD95EA99BD7B4284BA704C8ABDE09A0F3D1DA4A63D0A08343D3665BF3CC7AB583DDE5A9A3DC2DC833D4924D0BCCE8C5BBD5D83F3BBB12AA43D780CB9BD4C88403DCABC28BD1A87EFBA3B14E03CCA57123DF8A2A4BDDE32883D0168C5BC6B72ED3DE60AEABD739E8EBDDE4A543D4FCE663D256E263D1E9C9EBD1F6C95BD3025CC3C769FC33D85EC2EBD938AD03AB4D02EBD6991EEBB8547883DC4C28C3DC718813D2C6C03BDE288653D74480BBD4934973CF6798ABD33E5CCBCDF13673C59532DBD453601BB6CE03C3DBFAA103C805C59BC39428FBDF8CCACBB568EF53CBD2657BD14FA76BDE87696BD2E890B3D398B93BD115A9ABD2636B5BCE3660CBD0B4E33BD258AA0BBDC0E61BD8E099FBDAE9E1E3BEF6AB0BD0D2074BD7BB407BD3D502FBC037F64BCBCAC9FBDCE098DBD7414C63C47AEEEBC7130753DC986F43C06666B3DAA370A3CB7EF14BD5E4F64BD55C1F33A87878C3CCDDA2E3C3225603D7FA96C3D2EC6CB3D041493BD3D2F43BD66EE28BC3E4DE03C3215ACBCF96E08BDEC29CABD8DAA97BDFF4BF0BC14850EBDE99BD5BCE33A883D7A1959BD31F882BD9691A8BD3CEB50BD9CA198BC4771613D1D6DC43C76F601BCC580063DB9F8C9BACD0AA6BD00EB72BD9DBD463DC2F6C4BB3C509FBD17DB283D9689843D5430B43C9FACB4BC48C1123D096AF63B6850043D5D35B0BC3361723DC255853D040A9BBD8578553DF4BE853D5B0194BD3889E03CD00217BBCB6F4B3D8F4787BD04F50B3D8D24363D0CA25C3D8002793DC01E66BDD8FDDCBC59B2833D3967AC3D4A7D65BD4738A63DE24D743D05B4A7BDC5CA14BDDDF763BD39EC823DCD49853DC29E673D7ACCE8BC10C414BD81E143BCC4FBD03DD1B1B93CC2007A3D8398373DEFA05E38FFB58ABD475CE6BBBE5B4D3DD8F551BC3BB6AABDB8CBFE3CF0491EBD026BFC3CE5B1B53DCE21ED3CC2388BBCC868EE3CA8B718BDCE4E9F3DFD383D3D1082213C1ED96C3D6E2451BCEA8A9B3DFABF4F3CF5B6873D205F13BDAF95F5BC2296C2BD2AA912BC10BDF93CCB2DCDBCFD2972BCD0E337BC278651BD2A4C51BD004E37BDBD9B85BDCA2045BD315E04BD839F093CB5CD33BD2787273D117B2BBD905BBE3CEB168C3D8E04573D9C42C53CF681B4BD5B71BBBDD8FF56BD7455773D3F2C3BBD595970BDC9BB2FBD53CEABBAC91598BC03C85DBDEBB6B03DA141403CD403A13CE2D0A9BC95D7993DDBD7823DADB697BD03F32F3D0F91C9BA446C88BC1DD00A3D280F1E3D5FB2803CDB84643DC02AB23CEB2FB13D5C606B3D4FD9F93CC0716D3D2F281CBDCFDE8F3D20D26C3CDE95F63CD62E893C2BD2963DADA093BD8868493D718D5D3DABC6E9BC07727ABD4E36613CBE51343CE146A1BDA473153D590905BD95F25EBD1CC1143D1ED156BDCF48FFBC3AE851BCA354653D9296EABBD015293DFF5AB4BC35795B3C372681BD023B63BD9367F53CCD4C6FBDE1F4B53B8B1E493D33ACCF3A3D4904BD3A5C02BD9E3E84BBFE4DCF3BEFDB173CCC7594BCDC6A36B9AD70DC3C64D279BD78AF183B6FBF5FBDB85399BDABED93BDAB6B90BCBA2594BD11F8953D26A172BCDA3B96BC36A26C3CBEF2EF3C6CFAC43C2A5A113CF7ED86BD5A8D9C3C59B65F3C7AE5263DBF4C80BDE12E06BC17F13D3D1854183D0DCC893D3209E3BC6C5E8CBD8739AB3C61D47E3DF33F59BDB609D1BC9F81183D32A28B3B162392BAEC9C9CBD6DF1A4BC1D263E3D829107BC7114A8BDC66211BDAB883FBDD68E1B3D5F0C4B3D01234F3DFE2C3EBCBA756FBB4AB469BDFC9A3139652F1D3D938A28BD7FF97DBB78CDE53B2C2CE73AF6C6903C4B5986BD0B4F04BD854509BD2D8B663DCB9B49BD8965BABD39C861BDF28C47BA53A3763C4880953D04A440BD2A3AC9BC300DE93B748790BC6EE36A3D6FB17E3D4B68A43D189297BAE7AA783C182C2B3D16FD6DBDED6B6D3CD468D43C1D42823D486084BD3EE5843D5BB80DBDAD1E0CBDD55884BD7ED40E3DCC7E7F3DD496843BA476FC3CFF10B83C53D690BD9C1A8C3DCBA8E03C2A9C27BC5E89AB3D67A2A7BCA338063D95BA24BD4E16693DC34B72BDDB43C23AAA0990BC60961B3D165FE7BA181936BD79BF543D92C057BDCF9E0F3C7E586E3D0360D9BC40B0933D2027233CF9401F3CFEE9813D54AB823DF72842BDCE758FBDC07F2FBD3BBE12BD60C9F7BB08E1FABCA6B0953D9775E5BCE8BF09BDD20D003D4EDF28BDB984893CB7D281BCABAF803D911ABEBC6783463D615AFF3C579691BD3E172A3DEE738E3D298629BDAC15973C4125103C849D9E3C323A99BD604A033D1ADEC83B770537BD9969853DB3D06FBDF9BE94BC1C77663D1A6C93BC71510B3DF4498A3CD192363D2BF79DBCAFE9F2BC4E4F96BC050FD33CF1C119BD3E3FA2BD2EEE29BD68DD84BD265441BD44C203BC35B59E3D4EBF793DCBEB733CCE9C373D75F4F8BC568F3CBD9DB914BD55B349BDCCAE88BD6775033DD96B9DBDDF889DBD8DFA0FBBF97014BD4C2BC83B4E6B0CBDF51F553D838290BD4BE65C3D48CB343DF848023D1B155DBDA89726BDAD3E913DC3265F3D2052A2BB4DA0C8BC281D1FBD41D19B3DE1869B3A1E8662BD59AF293D5815183DE76D89BD96DF86BD7F0C473C30DFB13C0256A0BD575C36BC60123DBDCE5CE33AB695063D562EF43C5D33ADBC40D30FBD4768483D1515953DB0D8A1BD2039553D893F453CFA93813D7A4398BD5477E7BC15DF0ABD931948BD983107BD0B69B83C98D1FA3C8789C0BC4B3127BBCF38983D145D3DBD1303FB3C325B643D82C15D3C94D48A3B17EF203D0B6EB03CBBD5673D511997BDE4EEA13C8272313DD424333DAB1B07BDF6EDA4BD0F90A6BC128878BDA64885BD0E8478BDA6A3A4BC3D59143AAEEF593DB60E053DF45D68BDB68DBFBC7FEA903C740E513BEBE8ED3B68279D3C38A728BDE436C4BC223553BDE0EE9BBC8F9A80BDFCBE98BDB766873C3AD4733DCE7D11BD4B0C3DBDB44B8FBDF7F135BDB359913D692D4A3BADD4823D2A9A22BDF2289E3D4E55963BE65FC03C0E092FBD08A786BDA1905FBD1E38263DC331213D5DCC6D3D82E086BD97E0FCBC14B1A13DE611F93CAA11633D74C0A23C6B00ABBC5E4290BC00EC143DA793893D5FD4253DB5DCC33CFE3438BCC215733D42C072BDBEE62C3D36669A3DBF1D8BBDD89EA53CD9D50CBD007394BDDD6865BA35A7E23C8FAD733DA3BE013D301D95BDAAC0C33CA11C1E3CD52E5DBD92BF61BDE18D033D65D39F3D608C9FBCE334863DA4CC993D1D1BFFBCF98B9A3DE2D0573D8AA415BDF4F494BD3A3133BD18D0713C82DA423D0338933D27451EBC5A1F983BD5009BBD088A7E3D18148FBD17D675BD54D6B53C24479B3D4F1985BD27927ABA885EA0BD526D87BD2587A4BDB83F303DB07F6F3DC7F187BD039D30BD723CCF3B8BA00B3DFE1D3F3DCF8793BD765E67BD333695BDED4F81BD29780D3D3277923C7181E3BC8CE61A3DEB7B01BD5FF17D3D5DF7AABAEDD29E3CE54253BDE638983D2E669A3D6497233D3055A9BC4F474FBC772AB53CF1F05C3D1B0816BCBA5D9C3D1178853D20C74FBB13135BBDB2D9103DFA012DBDB9D0913D17FE50BD02E368BDB01444BD231E9BBD0F31953D95FE5C3DA8E1AE3CBD5D6D3A95B286BC0A97C7BCE060503B791898BCC840053908BB91BD7174253D8312EABC5BD99FBD6C5E3DBD2644523D14A8193D4BD028BDC6BE583D8FAE6F3DFD6D8E3D96CBB63C0E1821BD32E5603DD544913D94EBA33DAE66F2BC8A3FA0BDB79E5F3D2B658D3DB336F5BCD16F57BCB63F393D2104883D9E39103CE4B38E3CE06DAD3B502B79BCA1C47BBC0A827D3D45BD893DDF0876BD4029BFBCC7925A3D2C74B0BBD741953D3DCA57BBAC2F6BBD6AD18EBD0D619F3D804AFCBCC4D4AEBC128C733D1278383C9EE89CBCAB81423DC437FC3C508822BDACA38BBD1DC9183DBACE133DBA670DBC550ADCBC60754A3D52DF8B3DD95E203C390223BD14C0373CAAC366BC300A31BD44FC93BDD3307C3D52FF663DCAE1393DC6DFFD3C346AA83CDF8073BD8C61F63CE3DDA5BD18DE933CDCF0D0BC5C71A53B39D67BBA61AA54BDB7EE8C3D99C653BDF559F43CE7A7C73C23A373BD6E537B3D10D7E93C97DB633BD1138DBD8F4E343D9E62793C8C27C9BC193FCDBB86CA293D1F94BEBC262D9DBDB0A5EC3C0D02933D8E3F803C807C483AD8131D3C391F083D20EC03BDC17F62BDB715453D289170BD837D57BCC4E87F3DFEC45BBCEAE7E03C19BA9C3D5AF8473D7CB118BD529F19BDCA6830BD99FC073DD9BD9FBD1FF68F3DAC9C6D3C8031563DF86A283CC2883CBDF185633DAFBFFC3CE922A03D947386BC6550F33AF59F823D3709893D5344BABCC7AF02BC05A918BD3155943B049A483DDBCA1ABD21F247BDE9A0203BBF863DBD4741BABC4D6D253C3BAEB1BC97F9803D38C88EBCFB747ABD4B941BBD5318863D28ABC8BC79C909BCDDB2853D2A01043DB1C09ABDBE4D5CBD40D381BDDB90783D01BF87BD5CEB75BD0EAF68BC7845373D38575F3D3B28053DA0C1463D52BC55BD656FA63C2A928FBDBB8D56BD1546C93CA6FF333D631B18BC25E48E3DC00EA5BDFD1773BB739FB83CB7E78A3D1A4B7FBDC81AF93C47CD82BD10012BBDE9E795BD2BD7A53DB6D7F1BC1A5E23BC697A163DD933543DF17CC83C2D9DC4BB227F22BCC6DEBC3CA01AD2BC428401BCAC5CB13C3498813DE71F3EBD31AD4CBD3A1E21BD2BACA3BDE9C745BDC0E3F6BBF54791BDB39E57BD7702863D5EAA2C3C7D1615BA65A798BD4E2A48BC0EED26BD7456A0BDA7E8743DDEF4B2BC3ABA71BD547D923CF6A3CD3CC9DB153A5EDAB2BC58DA9B3DE8D32ABDD1C0153DB74C85BD64C137BD54039B3D4309053D19C1093D123677BD535BD0BC5D4F80BC189F953D45AB8C3D554F613DADA8183C3D8F35BD309F55BCDE8903BDA8135A3DDEF1673C8D982B3D5169E0BC2F5E96BD06E151BCBC82B53C749B063D875190BD408EA03DE0A29BBD998E98BB69DC9FBD095722BD0649043D333BA2BDE447153B3A6A393DB92718BDB46A9ABDB52309BDDB83603DB736B9BC82A9BCBC86DD693DD5C4A7BC2BB91DBDF7B58E3DA7A54CBD8675573D1FD6113D133B4A3D0206353D24D50BBC6A1DD6BC2E6D52BDEA69913D2BF4623D373B073DC45AAC3C65CF793DFD24A8BBCB08403DD995CEBCDCC31ABDCFC7583C3BC812BD159368BD9FA956BD04B0D3BC9F9672BDFF00C0BCC09B8CBDEF41A4BD399150BD528AEB3C61F905BCF7AB34B90007DB3B543999BD5277FABB9420333D3FA46C3DEB3330BD091A9B3DCFBF863D2CAC99BCF3ACEC3C9271453DC729013DA62C463CF6D580BC3D382EBCA8A732BD6184953D7E2B6F3D8A836A3D28D3C2BC4E9D0EBC9A8E97BDF82322BC09D68D3DBFECC63C36839E3C2619F33C199495BDD0FF08BC874E803CC7B4063DBE2489BDB5E03FBB4668A8BCD4F61F3D536BA8BBD287683D26F004BDD57AC6BCC3B7B8BBAFF34DBC987E77BD829D053D27A103BD70E9693C5FB3C8BA5D6C64BDA624C6BB567A1BBDE14808BCE792913CEB36A53D4ADE70BDEDF8A0BD6B8D333C5D2D10BD880D593D43B43CBD95FF67BD120A893D0B9B423D344AA23DC00A8B3DA47078BD7752DCBC6D543EBDA1E2AABC6DC7BABC2BC77CBD7F7F39BDC2BD82BD6E48A9BCF13D7C3C74B6DF3CD3FB213D7D8C88BCA72D5D3D72C824BBBF0DFC3C1D04FEBC7D464B3C623A3A3D52F7863D0A5C91BC445B93BD240DB1BB3521BC3D6D462ABD770E19BC4FA0B7BC1ADDF1BA172A91BDD93B84BCD51989BDC9D493BDD38161BDA5ADE1BC39D250BD3D0907BCA91E133CEAC0273C3C9884BD83CC7FBC0289A2BDDFF6243DF2C2F8BC89AC4D3D223F2FBD4C58D7BB308D2CBDEB87863D0299893DEDD5153DD08FC6BCDC2CEE3C56F9473DBA1236BD18823A3DCF85EA3AF12C4CBD632C833B0B60FE3C1A7AC53D47B47FBC29C3A63D25D715BD3C6E193C348DCCBC293F02BDDD96963B0EE63C3B0F80BC3B9A288BBDDBE4AD3DF40B04BD88C416BDD5B6A93DFDB2883DDEA6E1BCC46B773D2ABF543C9A6A4E3D4B22833DAB6595BDB5D48CBDE44592BC9C3A85BDEDC6D53C719C5EBAA69F84BD7FD9913D92F74C3D769371BD175AA93DE7CDBEBB236B653D92A2C33C210B85BDD888E63C0310913D69B7ADBD2BA91CBD801C623C51F9A1BD65F468BCBE2685BC847958BBA997953D9B2F1F3DDBDE1BBCD6EACFBC9A550B3DF34BF13C9DAF90BC6B7F38BD9D72A3BD74245EBD7470B43C8A5E583A47B4823DEDA9163DECAF31BD37A5DC3C63E5183DF2321E3CABDD0CBBDBF1893D39D6343C2182D0BC580F1D3C1709E23C424D443D8594B8BC1A5D7BBD0D00A3BD31A790BC10AA8ABD48000FBCF9915A3D74C3A7BD085A80BD0FC06D3DE2215B3CF38069BD92E0E1BCD7736BBDFD2A793BD1A7993D71374E3CDF01C2BBB9D3733D77B9FA3CD0D447BD0570F33C2188893DC2C3E83C9133C73DDAA88BBD12974E3C5DF4373D3E8EA13B4BBC523D4C439B3D22223A3DADFE923D6D2CBEBCF1669F3D071C81BD037FD33C7F7BF8BCA7764EBC0F3EE93B2F45313DA8E2BEBC70DF6E3D42E38E3D9269253DB2859E3C305C3ABD7EC7A43B884EE23C6B539B3D5FC5C33B8659303CFCFE0F3DADF474BC32DA873DA441DC3C1979003DB947943A07BB663D060E84BCAEB8763D013233BD13A7FEBCE6838E3AC9A05D3DD107CABC5DB114BD8D4F67BCDD10713D79FD773DB309C53DD98B753DDD688B3D3C7A9A3D707854BDE817D23DEEBFB4BCCB9F05BD3A0D303DFD7349BB7584093D83DB89BD2C88B9BD512536BD1848B1BCEE81EFBCF374903DA1FFAFBCB3DF9FBD681DA13D348B6ABC9500693D9D1A61BDB0DB8FBD1D0B963D4D82793DC683A3BD8152FC3C07167E3CACA680BD4167FBBB8B3D74BD772508BDA5422D3D3DA7223D80F329BDA16A67BDE1A9033D08F58F3D27739E3DFB437FBD3B1055BD2FC66D3D5973323D68024BBCCD88823D9C52AD3CF638C2BCE84569BD0E9068BDC6AB093D2A9978BD1ADCE5BC323860BD7A5196BD4C48F4BC59C2803D00BD3ABD43D484BD125F803D48E1113DE3A48ABD3B2F15BC92C394BDDCE657BCFA6675BDCF94933DDAA0923DB51814BD1B9E1D3D5C4C50BC26D883BD047422BD2B387C3D4D035FBBBD7C71BC6C1B263CDE9A553DD3BA63BDF61E973CCBEC0FBD6FCE903D22EB2E3A709124BDFE1B87B9AC14503DA4CD3ABD1BA6953D527430BAE92B19BD6EC3753DDCB29A3D38DA913C8D96A43B2469953D83A682BDFFCC5BBC35BC213C141CE53DD31AADBDCD92253DD1B4B33A1E71D83B529880BCDD1998BDECB5A5BCF00BD13DB75456BCE860F33CB38D463D0E701E3DDFEAA0BDF485E23C7598C33D41DE433DC8EAB43A18EE64BDC567563D1F057A3D1A6C87390D24973D9D89FFBCED920D3D0B1C7A3DEDAF48BB028684BCB8D7B33CF5A8983D38BCE7B9FE3D9B3D4568593D659585BDAE430FBDCC776EBDD328773D11D0BA3D83A59E3D939996BD2FA3E43C4238B2BCFF91003D546B63BD7AFBC5BBFAEC643D367446BDE43C0F3D6E8EC3BDEBA8873DAADD5C3D79B43B3D1F2494BD30399EBD5137543D5F7125BD383C273DA5D9143D25948B3CBF8C6BBDFFADA73D4877CE3C3D48253DAEE809BDE6941E3C031A593D929196BD470E93BD53B8303D697D0E3DA2A045BDB5D6323D4A5712BD65D49ABD43D2B8BC640C933DDC8CAEBDF266313DA845D93C8106AFBC382D70BD4F74513D7A22943D021604BC21C77FBD69A3C7BC1CE8743D68D823BD99B3D13C66FAAF3D0BC2E9BCEEED0F3D4EF62C3D3BC155BD26AFB23D689222BD1CD8563CAFB0A03B9A80323D4D5D39BD8DE2C4BBD3F6653D821B9CBD75A77F3D184B1BBDD8501C3D1A2A6BBCA4C75C3D2534943D13ABC8BC443C4C3DE4C0213D2E1C6B3D0DE7883DE7EBEABC577C463C130199BDA78EAE3D989AC53A0F613EBD05D1D7BCC9ABC0BCC8F781BDCF057DBDDC45DABCEE0B74BD5A7C703D70A238BB6D1A3A3DA18D2B3D19C89C3DF4A539BD0D3269BD8546C3BDC4EF70BD083C9F3DB2998BBCBFA211BD02EE153D4B62BB3C85C9673BF10423BD1CD6313CFFCA7E3D09262B3DE3D295BD0336A33C6D13413C2BBD65BD88B1B03DFA7526BC2CADC5BCE8D96CBDE0A22EB94C965BBDE47B38BD48A27EBDC5D4D73B26D9A5BC3320BA3D75D17F3DBF391DBC8427333DA7A28D3DADBE7CBDE401753DA057953CB319483C74080E3D390B22BDCD3CD6BB654D41BDD0FD393D3BFB2CBD5CAAFCBCBF3499BDCAD3ACBDA401963B53D906BD52FFD4BC8F444F3D9A969EBD8033AEBD6DB23FBDAE346F3DA159BFBCF6710D3DE959703D7659913D32D585BD186EE33CBACCAA3DB23923BD6CF834BDB81ACFBDC621603CFEB4173DC842683D8C9423BCCA7B023D306008BC3BEE1C3D695BEABA9F3688BD890DF2BC8CCD53BD51AF0ABDEB763CBD4E5CC33D570174BC1F73BD3D6ACDCE3D2706B23BBF0C763D98CDBF3D2F3DC23C59B021BD47608D3D7C6693BDB931EA3CB1371EBD6B6121BD5565C0BCA17A343D945BC8BDC2991E3DFEAD91BC32EB80BD705BB73D6D6C173C6D290DBD4B1582BC9881203D51C62FBDC9401D3C5C4E9B3DEF511DBD53C8AE3C5749FFBC0BCA61BD8FEA39BDBF3123BDEE68143D45216D3C5C6369BD3310953D99C6113D59EB973C1A6B873D5A577A3D7BE007BDB71141BD48384D3D362847BD313760BD0A6DF0BC5B8F00BCC224783D2BA1F63C9F6B613DBF853F3D1ED20EBD42D49A3B0F20243CA7CB88BC1791BA3C1649BE3D693546BD85483CBC333C43BDA7C3E3BCC847513D86AF7A3D9C4486BC76EAB0BCE6EFF9BC237A8E3D6422D4BC9CC8423DAB716C3D6C361EBDA79E0A3D3D9B96BDEA4B31BD1FBB553D205120BDA6328B3D688AA13DBCD3033DF503F0BC9233E13D6765A5BD7BB0023C9FC70FBC0C1462BD632E10BD9424593D0011BE3BD8D44C3CDBE430BDAC9558BDBC30E8BD1C00843C11CCD7BC6B355B3DD14AC73C70DFEA3C469A86BD58FC8DBD66BDB5BD9B8DE4BA9DCED1BC7C78443CD201D8BCF2BC383A2B27C63BBCB2A9BC8F26DA3C68839FBD0220713D9C2C09BCC923FEBC8E2E133CB120DBBDBDB8203D5B8A40BC8855973D3561813DBC3502BD369C0D3C41650DBDF0DAAB3CBCAFB1BD3377ABBCB3A0483D27E52FBD1E2E2F3D7AA29A3D3B4C933DE7DC8E3DE8EBDEBDAB1A9ABD7301563DB118823D675FB7BC69DFCE3D8E185C3D651C8ABC63C7303D1818C13C58E7BABB6C1B00BD7065BFBD0ED66C3D65580CBDA85C38BD9F78153D56B50B3DB6D301BDCEAA6ABB89688CBD00D7063D24EFEA3C0065E53BF39EA93C17EAA93B9F2543BDC7F00DBC993C80BD9DA89C3A046E00BC5B7782BC86CAA4BD1F9633BD018888BD11791BBCE56BAC3D37B8623CF9FBA73D2307033CC7164D3D4168C4BD3B588EBD696C6F3D9F57D43C069FA83DE9DE4DBDCF0BBEBCB2AACFBC890209BDBCBB143D22989FBCDBA24E3D305391BC54DE913B660AFDBCE8DAFA3C7F8BF2BB55FD36BD54458A3D10F082BC5EB62E3DC384373DABF06CBD3D0512BDA9E5B63D50B7B0BD6D82AD3D6814D73BA499E83CE2458BBD1F1B41BD804291BDB7965D3D17CC3A3D0172053DB2E9803D6B7B15BD6AF72D3CC43386BCC262D3BDD3EC6F3D275100BA2BC312BDB589E13CD017E6BA98EAD93CB2234BBCB6E5DEB9F15B863B9080A9BDB11A90BCF17B1D3C75D51BBE8AD6AC3DC2E5EC3CB66242BD8AB095BDEF22003CB08F40BD2D27F5BB64B4913DD2873CBDCF9A0EBDFD66BE3D2EA09ABD306B9ABCD9F53ABC2A818B3CB6ADBF3DA75587BD9050B2BD9C38713D71033EBADAFF6DBD11B25FBD6C3890BD5680C5BBEC5C443D85A1F7BC38BFA7BD84C111BC5C6A1DBCB7729ABA14ABA73C4B08793C0CE8BC3C8BB64B3D89D3733CDAAC9A3DC2364ABD25F713BD5C96CDBB807BA43D7A49233DDDF93FBDA65032BD179A74BCDF74953DAA4E54BCFFAF3E3D8C7E42BD010FA7BDB4EB403D248043BD807489BDE8B894BD4E5F95BC57E0333CDA180B3B61768BBDB19EB7BBC8CEE63CEA741A3C81408E3C83E1863B84AF113D4D5B643D4E50413DC7BB86BD81CC143D1125AD3DB077953D687F94BDEA67843DD8A11F3DF822F7BB1F8E1FBCD8812C3DBB22473DA5DCD73CDA725CBD6296473C34A3373EEF09AC3D770BF2BBD015543D6C572BBD92CC113DA1AE033D860D5F3D7E68C53B39DA193C87998F3D3700FA3C3064D1BDF1F2323D85D6B9BB2C056E3D627112BD5316B6BDFEE413BC2B5A6F3D52EB6BBD703BCFBCEFE18F3D1415983DFB4FD53C4F5C72BCEC7457BC5460B9BCB36619BDDB52BCBCFC3EB93D98CFBDBB367118BD3B8789BC837F01BE4F72503B49F925BC2C1F5F3DE9024DBC6D45B53DFE1DB7BD718C6FBD0B703A3DFA69183DC2F3C9BDEA88873DC37F98BD287670BD8A680FBE6CFC34BCBD9F8DBDBD2DA9BD7B603FBD38A8A2BC88BC2C3DCE5CE5BC46B721BCFEE0A03C39CAAD3CAD43DD3D57C6B3BD1E60B3BC7566623DA2CD2D3DF50C433C5DD4B03D9CEEEBBD78B7E4BA6D9869BD235993BC387248BCB12505BD18BE903DA3BA95BD9B04923D92A6B1BD82A7CDBCBFCC73BD2C218ABB565CB73C8EEB883D352436BCCADC7C3D601528BD5CC70F3D0D289E3DBA20EFBC0F5BACBCFD1E013DF163B33DACD5ABBD8101223D73D0A2BC161CA53C9BAFDD3DE70E0B3DF519BE3DC92F003C26C8DEBC8072023D4B5AC6BDBC32833D9ED8E03C845DA13D67D3183B12065BBDC8B3443D5F041C3CDBDEDA3D402819BEEACC17BD56E185BDA42131BCC19497BD5AC38F3BFAF5BBBD1B7671BD9EF6963DE4738CBC6793DD3C9A0504BD5B6A9BBCF086FB3B83D0AD3CC3349C3C42457A3DAE36943D3FCA353C7994FF3D88D2C23A98FF91BC78F0A53C7F33EBBD1E4C63BD1FDA74BD592196BD0180063DDE4BB63D4EF51EBB6915FF3DEEB4F3BD0B47873C75B0AABBEE0D543D63EBA63CC7E0E73C3D5155BC5B88A6BDE014053D565F8EBCDC1CDEBCC82F04BDC9225E3B3DF9093CDDD5BD3CEF42813CBDA5D3BDEB018CBC6B153A3D71280F3D2C4924BC4F47503DCF73B33BE14A253D7225083DF0FA62BD11C1FEBC9AF581BC08B021BDA831AE3D99C89838E34C2ABDEE30783D853C5BBD24CE24BD074318BDCF9C9BBD1205783DCE5188BD43935EBDFBA82E3C353F383D10DC2D3D1D548CBD9E421BBD8B5DBE3B326D5FBDB303BC3DF9A988BD05058DBCE6D325BDD56F543DF5ACAB3DA055B13CD273F4BD3CFD2D3DEEE30FBD2C5C76BD115B7CBD1435AEBDB931693DCA2658BC1F79AE3CC86FB4BCE11D62BD6403933DA5E6ECBC6C3E853D3805AA3CCAD2913D93E4C4BC457266BD99D9983B73B42B3DFD06A13D80DFBFBD4C6990BD098B9C3C44595DBD0838F2BCB5C58439F6AC403D98F98C3DA6E715BD3813D13D786C85BDB2933D3D2AFC54BC4E3191BDE73478BD4BAB56BD97F66ABDFE9950BD43F685BD42D6E13D24EB253E7F5FDC3D73EE09BEFC81363A935ABEBD2DCC89BD97BE503D7120BABC67429ABD542E9EBC88C8EFBC26C6F3BCB5009D3DB93A37BD4C54E93B4C27283C4CA48DBD873D4E3C38DB83BD4C14823CA560F7BBBA732D3E5C60193D10B8403D1D1F78BD5CB52ABDEE461E3C67EEA7BDBD61833CE1090E3DED9046BC922305BD31A0123ED77B3BBD10F0D0BCBBE6BEBCFE7ED6BDE8E3A63D070E5BBD91CF563D62DF223DEF6B513D06F987BD97E87B3D527155BDC5A53C3CCFB6EEBA1574EE3C265E163D977AA6BDBA0F0DBD97053E3C140C36BD49FD8ABDE050D3BC45D404BEC244583C543FD13BCA4A53BD0F2F1D3D2CA7A93AC498A2BB4C0CC33D5800B6BC4EEB9E3DCBEF783D8242B53CC815393D63D0DCBA019F87BD391E563C5F4723BDAE352ABCC75FB33D7747CCB868FF333DEB750D3DF614633D68F0D43A136F203D03290E3E86EFD73CBA4EC8BDB069623B36D02D3D4E7616BDD760B73B0D6608BECDEDDE3D3D6882BD9023A3BD71BC0F3D7A591D3DAC02A13D01C7D13B429B8B3D1E7928BD093DA2BD3D42063D62DA093D024F653DA095313DEE97DDBCBDFCACBC5935CCBDB2ACE43CD521EDB900FEA83DBA5BF83C9DC80FBB1E871CBDF3C1C8BDD159C2BDB0B3DA3D64DA0FBD181E08BC323F563CE2C2F7BC5CCA4EBD2735BF3D4CCB39BD0257743D0BB9D93C7328DC3CC0C737BC3322ED3CB07A2B3D0337EA3CD201A53D8626B03C117691BC8C8F503D4FA6283C2D2F86BD0A018D3CC466523C9C3B3B3C373EAC3D5E5496BDAD1574BD7E1EFE3CF461313DB78C70BD80005DBD5315A4BD1A9F063D2F9DAF3DE70BAA3DA40488BD9AB3923D28171ABDF35B20BD332E3FBD551470BD0DA0D63C2355813C8EA5A53C3DFB0A3D079619BD2F75873D0B0B1E3E83DA95BC93B7723D4ACACE3D29834DBDF2460CBCB0DC56BDA0231A3DA7481E3D55358A3CFE60E9BDF4CB08BD84D048BD393DA33DF2F72DBD9CD4A13D9AF0743CFBCA91BDD02238BD6373913D8D7F7C3DDBF7C03CDB941EBD96C42ABDF4D08E3D6A4809BDABD6FE3C19A893BD8586DD3C50674DB86F4ADA3D6772F83C72AA47BD4CF1873D93273C3C7499A9BCCDA2C13D97F047BE8EC74DBD13B57B3DDD3D0DBD6EE0DD3C30B6683D2BEC853D9E64A13D9BBD01BCE8E459BDE9F098BC2262A73D531ECEBC88CDEEBDFC8EAEBD5AC46D3D07003FBA2955F33C241C15BEB429A1BC91588D3C6199A2BD6DC816BDC50A933DB45BFF3DD9A2ECBCCF3F0C3D08693BBDF10C1CBCDC75C0BC8A36793D0D843DBDF12ADF3B4858AC3CF6DEA2BD74C59ABCAF331DBD5A4078BD3CE8B73D505A18BD5CC58E3C46F17EBDA255D1BD7AA6DF3C9FCEE43DA035233D805B903D02288F3D9594173D9E5C383D85D0F9BC11F1D33C60FDCFBAF92C2DBD73268EBDCA4B82BD12DE49BD87D4053DB58D9A3C2E62873D35BDE33D22785BBB686587BD73760ABD5ACCF5BCAC08BABD26349A3DB71FFEBC26BB393DD5DF7E3CE4053C3CABA00E3CB8F4783DE1EE02BD0640A23D9AE72EBD52567E3D2852FA3C1B680E3DBAB609BDE3A2DB3D6E51393D5B33673DF93FF93CBCCB92BC2AE640BDCFD0CA3C6FFCA7BD1AAA823D1DC4503DDD972EBDB86EFD3D3012AF3D8BB11C3D9408C23D9F80223B5AF88DBABF76F4BB999998BD9B18BABD24B14ABD28C8B0BDF9AD123DB98F88BDB944B43D7A2D3D3D6DE405BD5B929C3D293E0F3DCF1230BDA0DD69BD1C203A3D014A70BD28FB713D7E91203CE1700B3D2D0247BDB646113D1783873D9BD9A63DB4378ABC16EEF63C165175BDD23152BD73B8593D4C5E1FBBFFE0C33AA1BE853CE61203BE0EA8E83CC560583C62C3063DDC40F4BC807C3B3DE5D0BD3D85A7013D91D2343D7122323C4FE2733D50ED85BCD03B1B3C6C7ECEBDBACADA3BCE902FBDC2D2723DE47D783D819FAEBD1EE8733D7CFB8FBC9CF713BD6373A4BD0CD397BD1E39F93DC9C60FBDC26FF93C6DD889BCA4DC89BDFD889C3D47F5303D534C43BDBA2F5D3BA7DCA13D36C2D53BB603D93B926F6C3D5B8963BD42DDACBC50B1C73AF7F5E33D18E6593D2E03DCBDDA23E83C7B3D5F3D3E2DABBC924AA13CBE947BBDD859163D987485BD92C4A5BD42091C3DED4CA63D5BDD3CBDE9D639395F63B3BC504846BCF3D401BDC0DE343BE1EA2D3DC3C4BE3DC71E89BD9551983D377640BD46C9A3BDFC09333D26029ABD975D973DE57F5F3D60485CBD4611A1BDFF51713D5D1BBF3D6824D5BC4411B6BC4268B03BDF92013DE0E0B4BC8AF7923D9249543D0EDEAF3DB94221BCAD19493D76E947BBA65F5F3CCDA1ADBBD74990BD55CA6ABCE18E413D6A97993DC55EA6BCDDD5333D01E1713CAE819B3C35F38A3D3DCADFBD54B43F3D0165413C5D5A8A3DFCA2083D532CEE3D591B3D3CF621A93D7DF135BCADAFF23BEEF518BB1B4A1C3DC026F53CEBD931BD46EC9D3D39242F3DE017BCBC15A0983C1A8A043D665B1FBA247DFEBC419CB2BCD456C43D827C8EBD0B6D96BC06AF9FBCA1BA903B14426A3D6C27F7BA45BDA63D61ED733DA2CFB83DB7E0753AB1EF1CBDD50AB7BD84CAE63D99FEF73CBE7A963CEBB1773D8F7DA6BB7A15C1BC6A03EFBC955AC03D881B893DE1878F3CA752643D9A2C173D5E2AA2BA0297103D6B40F9BC26D1FABCE25A44BC64FD613D10A0B23D90D40BBDB8300BBD2BA18EBD543051BC31E8AB3D270A283CF67D78BC7ED5803D0F4FDD3D2AF85A3D5F010BBDC6D495BD7099993CDCBCC4BBDF7D513DBB7B45BC545A2CBD9AB9983C3ECCA03CB65A563D0318093C348088BDECBCFEBB9CCD4A3DCE20AA3DC3783ABB0E6846BC57D8383DC7326A3D3A9305BD3C8F0CBD7390E73DA86D3B3DFE48B6BC5500673C8B882DB91728B0BD206AE13D6540223D32F9CE3BBB11FFBB096255BDEDC4983C9B6D11BDD159FF3C5DBD32BD67A159BC10EF86BBCB4160BD7B9FD8BCCF38ED3C9E5EB3BC3C61533CC5A84B3DF4FA44BDD70154BDBEEA1B3D320898BDEA03D3BBB470AD3A9001133D918A5FBD0DF5953D9BEE993D2F52D03CF3D7C7BDB28096BC7F089B3D13BB133DF2BFB43DF54613BDBF04023DC90A1E392D14D43D44A6623D9BFE9E3CBC55FC3B8EFCAB3B95D54D3DB729083CF0AD383D0D2414BD84C3CCBCEFB69CBC2FB3BBBCBB83A5BDB93AA03DC0BF1F3D547BF1BB06A8953D89058D3D8005AF3DBB7F07BDE1B352BD691B823A71055FBD88F03E3D1A980ABC84628F3C170A843C70021ABC02530DBD49250B3D1F202ABDA8D9003B0EF947BD62F5FA3B1AFDD8BDB462853D6BA9B83D522ABFBD76AE97BD43FC0A3DCD42D7BCFDD02E3D0E40913D50026B3DF84AB53CA760843D36B7D93CBC979D3C87F2763DAC25B93DF8C88C3C721C8CBDBEDA81BDC64D9D3DBE8FBC3D175B883D7F19C63CA31657BDABA7983DE26C5CBD00EF663C3881603C2AFB7FBD2A36D2BC14EE8A3CFDF9B1BDB72C51BDF1D439BC62C4D43CC1BB68BCCE5E123D3BA770BC167AD23CA0BC593D59203F3D8EA7463CAD0BDCBB99B888BDCFD7663D3070C13D0E338D3D9572DABDED68923DD636AEBDB2F1493D3B63AA3D0DC41CBC7B2221BC94D75F3D1A9408BB482B213DD56D25BDE98254BBE16901BD4D9D8ABC6721393D1878A5BD5EF02F3D73A3F5BDDFEE2ABDC75E733CD35A27BD2916AC3D1C02AB3BEF9E1EBD5387563D5419833C425133BD29F3103D2D0013BDAB82353D20962E3D71AA2BBDCA00AD3D8564893D054106BD778337BDC150E7BCE7C45C3DD8AE8DBCA48B193D6C5F14BD4B7A993D1E54983C54301DBD45358CBC7895DCBC5318C43DD4958F3DEB6C16BC32F502BC4FA9BB3DFD5492BD638AACBCF1C6F7BC9F839D3C1410863D08CAC83D7254F03CF46FEF3C1EDFB73C74310ABD6BD3153D5C6AA83CFB7CACBC4A4A713D7EFAFF3C0D8063BD200791BC33D88BBDCF2035BDC1D9EC3B3E92093C7B4BADBC5275AA3DD821453D6406F13C6E0A88BD200A9FBD63C9BFBBEE8C963D6732033D368EF73CA569C1BCB78DA8BC3E2956BD0F44363DF6EE863DEEF470BD1828B4BD15A282BDB1E389BDE391CE3C421C13BD93B64DBDBBAED43CF88719BD5D0AC43D8F90D13CCF92E13A829E8A3D3DC9E53CE6EB333A64659ABC087F1F3D60E05A3D313CF53CB51BABBD965E933D5AD9503AA40C20BD72BE9E3D46806EBD1F774CBD2A31D23B050AB53D972967BD4D3185BD082286BD8FFB973D38DDC23DA95CA3BB06A5C13DEF83B8BCF76814BC9D80A43C571A2FBDF20619BDBCCA2FBDCF135DBD8990D33CB4C8693DE366853D22F3CC3C2D8E9D3CC7A2823B9B8233BD87C1CE3C3A25603CD58A3C3D09C4CC3DA5E426BD1E6EA93D4ECF81BCAE29FA3CEB985E3DCEE6A4BD2549783D235090BB4FD1B63D56AC563D785C50BDBC1EFA3CE99D263BA3E08EBD86659ABC2BA2343DC12AC5BD2F5F82BD8B1F09BDB02544BDA46FD8BB1D296D3C70EDA43DBF5B603AD86E833D5D3329BD8E50553C0B344EBD169C0FBDA823983CCDDE20BD0DFBFEBB5CDEBEBBD0961ABD38CA9E3DC3B9383BD849E5BCE40A683D9C15D9BBF9DAC53DBAF890BC1DFEBE3DC06E72BB7D90A43D2496583DF48D9FBCD5E4E13BC9B4FC3C6614073C548C4E3C4E7F7A3C9AA6553D32FF7E3D1ED64C3D27A0403D40EDF3BCBFA0DB3CC77D933D69DBA23DF60894BC3C9EF83CEAF1893D979A363DF6A376BD78EA813D0D7A073D079F033D900F403DA38D633C6245B53BE5FC3DBD140087BBCA219BBCFC1BF83CFCD84FBB35294EBB546A68BD4C6BE3BBEE70B9BDAAB3893D1FA999BCC7038EBDEE7A2C3D468C4EBD1A932FBB958EE3BC0C70CD3BDE9E8B3DD03BA7BD996B723C39F20F3D09F59F3C6611853BC48840BD76DE91BDEFF92BBD294D2B3CDAF3393DAD48713DE9CC4CBB8DEF74BDB2C7723C40BE83BDBE89A3BD64A2933ABFDC083CE24B823B225BA93D90F683BD1B731F3DC566BFBCC1DB7A3D64D7F73CD70A8F3D208686BDCA72513D3040913BE6720A3D75B3D0BBA082043DD8CA51BD1FB2BC3D5B2298BD168E94BC6F6E8539328A15BDDFDC8ABDBBBCB23DD545B63D74676EBD49456FBD65178A3D4C90BE3D4282533D60FF993D0BE27B3D7C832DBDB5E44BBDC8BF40BC38E2D93C8441823C484FD0BCC1FC473D65D281BD0A97D13C521285BDB809663C6CD9DEBBD89254BDA0605F3D07172EBDBB9EDF3C2E8370BDDA7EB9BD4A68A3BC09E29EBDEC2147BC85C858BC86B9AABB859C393D75C85BBD3F66223D6C76733C04E5E9BB3A21A93BA58F8DBC72BBC2BC6CD156BD2D7116BC82FF07BDB214163D57E4503CE553C63D5F0804BD9D7ADDBC603952BB46CE15BDC61D9E3DED430F3D7FA56E3DACE48FBCFB4B353D18FC853D9ED5C23D0A254F3D2CEE093D345DCBBC678761BD7555123D9FE61D3DC7FB143B1C34223D77EDFABC756B973C560E633D37D3C93C6AE749BC2CFB3D3C6314583B321B3BBDD22FA5BD5E9027BD35C966BDBBA6C6B89536BCBD64E3833DE0CB4DBD16E1FCBC95CDAF3D618B80BD8C288ABD76B639BD24E6B8BCF618E8BC8FE380BDFA40FE3C62F52D3D0835D6BCDEC2D53B276A9DBC142BA2BCC96581BD4B468FBDF3750D3DBB91C7BCDC3EF0BBA087753DF63B87BD60F996BD20F8773CB9EEAABC5AC0C9BDF1D8F1BD2E7571BDA293BF3D85C80BBDFD9E293C8FAE86BD08C789BDF025BF3CE52A9D3CB7A2573B9AE957BDB591B2BC95B83DBD098EC9BC62775BBD5666923C44C68CBCDDABA83DDB7129BC510CEA3C51E70D3D87231BBCA5FBF53CF374E83C0C731D3D9D8C593B40027E3DDF2B323DE020C13DBB3C51BDB6988E3D02D4DABC7318A7BB42A2D63D55F49FBD7614DCBC97DFBBBCE74891BD41ED87BC00B2203DD939C1BC96152EBD989E743D57AF6B3DB940633DD31776BC9B745EBD5DE4BEBCBB4BD6BCC4EC33BB815A32BA1CC378BD2E54313D6D1B48BDD318B7BC78B5853D23559B3D261F8BBD1A1E90BCEC71FEBC1FA5BBBB72EC423DD8D4A0BBF70B843CACC88BBCE467AE3C6747AD3C50DD20BD309C5B3D5530203DB1E78F3C855C313C31EFAF3C6651233DCE5033BC8DBD573DD041C03D26C8973C8EB8493D43BE65BCBE64C0BDD0C273BDAC8B853D06D73EBDE41E21BD5ABCF33C047ED0BC1A93173D8CB99C3B3CC6703D3E8C6A3D0667293DD7051E3D7AEB6F3CD06357BD1D693E3D170C143D9DCFC2BD5E3F0CBDDCBADD3CAE3E00BDE79F1ABDE14437BD8A01C83B1ECA40BDE9C2C73CFB7EA0BDB853FD3C4E673CBD317D193D258E9FBD52EFA83D91AE87BD5E9279BC802E963C377872BD9F44DB3A1FDEBABD3CB3CCBDCDCE8B3C902E5E3DF0F795BD2100A1BD74D099BDF557153D26DF033DD412C7BB245446BDA705DFBDFF2D3ABB181998BD0E8F33BDB2F1F5BDB4168D3C4ABD773DECF257BD01F14E3D7CEC943C4C639EBDFB4035BD36B6A0BDDE6E9B3D7D0965BD958A34BDE8EC41BDA7C018BDC36CDD3C2B197FBD405BCD3D3926373DFBDC22BD2D90383DF9D0B6BBB9E19FBDC2D5C63CD28E0B3BCC95A13D5CE04FBCEA62F43C7C31A9BAF8526EBD9C739F3DBBDDE3BCD107C43C5C2E1B3D7071753D0CBE27BD83BE1FBD0312853DFC02883D8E57073DF1AC27BCDC67E039448D673DB0D3B33C795BFF3BEA971DBD2567D6BD7FE044BDD817F23CAF09D13DF8198FBC708B013D704FB6BDCD9B193C4A47013DD0C9DC3CF6FC7C3CF3707CBD8BEF8A3D69CC1EBDAB6B7CBB50BBA73D5E1D373D7E1D493D4AE1D1BB87FD153DDAB566BCF235A0BC9C4ACF3A69AD69BDF1930F3D67E12DBD64B9C1BBB4AB733D954A4BBDCDE0A23CFAEF25BD4853FE3CF0F8793D0EBE6CBCC5039FBDD944E43C5130CF3C910A42BDF0BCA33C79C463BD5B36E3BC78F6AABBBE49913C389029BD216E8ABCA4F5F93BE0EFA8BDD3D66B3DCE5BC1BDEFB6E1B9FFEDB8BD6229B4BD33E43DBD49019D3DB10B85BDBB41CF3CA9D111BDB9EBFF3CA13B6A3CADCE9CBD8E3D6ABD258D103C11443CBD652DA5BC90041FBD82B184BD060733BA0A3EAEBDD07B6B3DB99AA1BC0AC4AD3D510F51BDC55984BD27D283BD5A98683DAD548EBDE27EA83C8E6CF2BC7A2A873DAC5326BD17A2153D940A9ABD7CE8C3BBB3FA1F3CFB601ABD08078ABC35A02BBD345C853C7874B0BCCA7A04BD16C4923D01B28EBDE13AB43D037D4EBD943955BDCA18853DA15E2CBC0D519A3CDC8C463C5D9D5ABC1729223D9D3790BAEA7D253C0C489ABCAA6F0DBDAE6A733DAE1E663DBF80C73D5039A1BDA7CA9B3CB19F9EBD9247633D1BCFD9BB193FAC39E24592BDE909033D59350B3C221D68BD6FB0173D818229BD610196BD2EB147BD5E4D3ABD5169F5BCCB24AD3DBA620FBDE744C83C53C089BD11FBCEBDB5219EBD5A85C9BCC279ADBC37E099BAF3F979BDB689813B3705673DD1FD05BE6E4A2EBCDEA5573D0E5F94BDFB0E5B3D7E61E8BC6B184EBDB9F80F3C3C635F3D61C42ABD00E03DBDD962C1BCCB318EBD719C163DFC13293CD2F4AC3DDED0B93D54C26BBDB6D4043D988DDC3D1D1F7E3D6882973B6EF1B83D59CB1EBD00D82A3BB5EE8E3D7CF6413D7C18B03D75B9FFBC93C4803ACB5F673D760B913DB89211BDE14D74BCD04A41BDD0DC92BDDE1A293C21DA67BCB7A80D3BAE20033C82A9DDBD538D7BBD5F8F483BE8D8C9BD46E717BD6E3E26BDE5DF53BD7F1D8BBDB9D66C3D03D5F1BCD0DD8CBD5BA3AABDE580ABBCAC87753DA01012BD4D6D2E3C7F971C3DDF8BFA3CADC30BBDEA0D2B3D8A73893D1BCE9C3C15D9A53BD734913D347EE63BD534C839A2D93DBD29DAA33B9BA9993B63D973BC86158FBDF37530BD2B9707BD878E34BD74068B3D1D6B943C66EFB93D1FD32FBD9136743DBDE35ABD908C8FBD975A6EBD9DA59B3D1CD29CBDA34F943D9492C6BD3535783D3F4BA0BD52254D3DD3EE3B3DE6C5A83CF3C3D0BC2F41643DE8A270BD806824BD1F312BBD6E62AF3DDED9A83C8F12793CBC2FD73CDFF2863D0116BE3D6E83ABBDF94C0F3DD07D38BCFE759DBD18A58ABD726BD43D47BB8DBDD9E2BD3BCC623C37EAFF5ABD1142F3BC042831BD43D6743CBAA4B73DBC5CA53BE1C6213D1F21A43C77CEE5BC1ECD8CBDCCCCA63C631773BC4E9C19BD4CD0DABD34DD38BD74021E3DFC41473D3A8805BD4C0488BCCBFC933D1040393D07BC19BC7A623B3D76401BBD839B803D2FEE463D2A3BA03D1C54BD3DB7AC9B3D09E8E63A99E3783D302E3637DC4D3BBDD2EDE23CC1E9903D3A371C3D794720BC29C0613DC5AF17BD6F2BD7BBC800493DAF38903D32EB8C3DA14378BD558AB33C8938003CA44EE23C93468ABC2033253C66CA2EBD6612343CCA46B2BD7685CFBD884C8BBDB3AB063D00E285BD9FC478BD3521DD3CE6D1813A4DECB63C33E509BDD299E73C5BEED83B19641ABD0D5F773DBA2A80BDE2EA9E3C006DA0BD47E6193C2125B83D1D6BA23D2EE3463D5A6EBD3B6E2F4E3CA53C423C84A9633D24F60ABD9D2E99BD53D8CCBD2C2DA43D93AB9FBD3E4480BD49F682BD1E1A13BDE9B5D9BC85B7623D969632BD8D36963D872F92BD5F2EF5BCD83D77BCEB64C8BB9BB8C93C89E925BAAFAB0A3DD56B12BDA4846D3D6F091CBDC0B4543DBB2AB73DC9B2C1BD8238763D437FED3B1F9B533DE0C6C0BD61059EBCCD39BE3C3D9C4A3BD2A7883D442D79BC195A653DE4578E3C9D32A3BCF97A6EBD5EBEBBBD8467FFBC4AE6563D320A6C3D24A2A83B71C90DBCB57CEB3CF2AD7DBDDB08A33D77874EBD8C0B893D119D0BBD5E1F8DBD295989BDFE658F3D9AFF563D9B6C123D377603BD924893BCA57CCE3D080C473C768FBFBA75D49D3DBF29E83B17E0E5BBAADC963C7C74A03DF277E1BCCD00B53D1B335B3D7C712E3DC2D310BDA50A603D525F513D032B34BC69059F3D717C4F3CEDA0773DB7A9F7BB398BBABC9FC535BD1EB7373D668F92BDE39F84BD155C69BC36A4AB3D19F35C3C2F6047BDDA428D3C0DEBB13D05D23FBDCFE9E0BCA3E8AB3DB0694A3BEB6F833DBEA905BD0E5C25BD05659EBD12B921BD083E1EBC9E9EB9BDEFB9D8BD2380BB3C37D582BD2D751B3DDDB05FBD39B20ABDC65C533DDF77203D159D0D3DE3F976BC9B7C613D1E3662BD0068B2BD7537A7BDBA3B9EBDC5195E3DE06A9D3C4AC8E4BCCE4F823CB00D1ABDCCC3B13C123B8DBD3A47AF3D2E3A5F3BDAAF353C2440A63CAEE0973CA05C77BD71BE653DB174E63C38B1893D7867E7BC57C2F13C5CA3AB3CD878B83D6390A7BD755637BDC6929E3C61005A3D47F741BCAFF4083DDDC131BD1D033ABD6294773D16E2473C39E8753DEED4253DB7D24ABB9B4E84BB8F215E3D623C553DD64609BDA9D9623A89E791BDA60830BDD9FDE9BC370B7B3D9B71A0BCCE62F4BC6D5584BD40CB5FBDC64C873DD1B177BDAA49563DCC9FBE3C5C2E38BD7D38A43D4E0F273D67E517BD22068C3D37387DBD03F334BDE534493A06B3B5BD9DB636BD7571393CF32E833D68A5D23CC228A73D2FEE5A3DA02747BCC516C13B0CA30A3D2B67513D94C914BB2064D33B46D3ED3C297172BD47E01F3D7C67383D848118BD93F5143DF3D3233DEE8F833D5E899CBD5F3BBABCDFD7FEBCA06BCF3C843FEABC3AE7863DAE35C83D65CC793D83DE5D3CA9C9C9BCD7BF82BD95678F3DBBDA633CAF5BCFBB7ED06A3D59A197BBCC9A37BD69CC4C3D3CA45F3D34F2A23DCA90073D3945B03C0CC01E3DE46886BCC3C19D3DDB78D33DFA36573D05F4843D9BFE6BBD1B9699BDA6A60CBD133383BDE122473D4AA26ABD4C97283DD45E06BD10F644BC54C75EBD83CC9FBC4E24503D359FA7BCFF149E3DF84E44BCC717A5BDC0E049BDF8912C3D46154FBCCF6247BC8669D03C057993BC79E2123DCF5E0D3D1F05403DC15A57BDA6386F3DCFFE7E3DE60439BDA9CDA33DDFFD9A3DA1B819BC31C481BDAB35A23D14E263BD58013E3DB74E3CBDDD2712BD75ADB93DF64177BD98D2DA3BD6E95ABD620C153DDEC7A0BC75ACC53CC06F6CBD1B81ADBD3FCC98BDE6A2EEBC1D7F313D7F25FDB98D5F39BCCEFCB33DDE22C63C9F4E8F3DD8A9E0BCEC9C88BD047C6A3DE1AC803CE2C0343D66FF26BD41FA483D9519653C07559E3975CE8DBD9DDC723CAB7E49BD9362D6BC0EC170BCA1A5ABBD456C5F3D950525BD354AA83C2E319ABD43A2C6BC55538CBD02E80BBD0161B73CCE046A3D188E653CC8A984BDB09B143C6E555EBD8C4C243B684932BD0C47DFBBA212A33D3407EBBB344265BC278E853D898901BC13408F3DBA9E94BD12398C3C6EB8193DABB494BBF7359B3D09C0823DD78A49BD2DA8463DDE6275BD9A6245BCFADA773D272106BC853093BD7C1F5ABDD17941BBB4C8B23D26553E3DFB534DBD493620BDA6F6863DB2E612BB6F8D983D6479C6BBFAF841BCF0A6A63D687EB23CEBC48DBBBC0CA43BCBE18D3D16CB2ABDA3EF303D866C5CBDADC87C3D4EE3D53C3A45053D813E693D32DF9F3D5DFCBEBBDA7BBDBC9BF08DBDE1C4D83CE7968BBA457ECA3C5E20AD3CB71194BD33E30E3DAF25A23C42A058BD6E9A823DBCF7243D57B93ABC83DF99BDD19F843D0A6E6B3DB9C406BDAD8590BD6110BABB363734BD001A343A72218B3C39AA823DEF66D03C8B8282BC0BA16DBDA34E8E3DCF148FBD158235BDB148653D7B54353D0C0C24BD3E838FBD9B63E33CD0738C3D9564163D39849ABDB9B40F3DBE49A7BBF6750BBD169CC7BC715880BD99C00F3D9D481F3D47A639BD2F259ABD2DCE453D92B7CFBB75E60EBC0984F1BB86723C3D69C63DBDCA358DBB74A202BDE1EF97BD355A9EBC456E14BD783BA2BD0EDEF8BB480D56BD872574BD97477DBD24E8953C2763BB3CF40425BB82B169BCFBDCB63B2ECB15BD1E03EC3C5BDD8B3D04177C3DFA81533D99154B3D12F552BB4E1455BA9E33873DB855A4BD130E733D506D94BDE01B073C530D503DC45C623DE518A63DE820813DC83B33BDF72AAB3C1F66863DE07B5BBD893E903D02632BBD37EB883DE8893C3DC2B9413B60091ABDF026A0BDCF5F6CBD8600DA3C37EEE13BADC715BD3721013DC4001A3D2DFFDCBB458E8CBD500D37BB3200673C1D902DBD382F0DBD4520783D9466483B8354CF3C20B0C33BEB561C3DB68D7EBDB0118C3BD8273E3D9362243DB55C4EBC4D76A43CC747633DBCB702BD76A936BD822B8FBD1CE9043DEE19C1BC640F5D3D1D2888BC9EB841BD9C44723DBACF59BA853F2ABC017E083D464B0DBD8722A4BDEDF7813C282593BD7D937ABD1D09E23C2510FC3BCE12993AA0AD81BC7B9E61BD3D7602BB8F39983D891DF1BCD5AA2B3D9DAE263D09A8643DD5A6CFBC7800073C6C4C043D4137F93C80748BBB18C10CBDC7FA273C9786903DF5154C3D6695F9BB08EB663D93D9113D549CD43CEA4F593DAB5183BDB9BE473C28DF47BDFEC2A43D8C06E2BCA03AA63D6F7B74BD64C8863D4EDA07BDC6C6003D5B85E9BC2E2BE23C81A786BDE09434BB1CB1943D2EB8E13C158B733D392938BDDE4E49BA0A3BEC3C9D32E8BC7580433D2C2A413D6C32963B75B239BD2F75803B56CD9EBD5CAAEEBC328548BCC000623D26497EBC4B5B45BD75B01DBD5A416EBDD9CC98BC4ED5A63CE1A5AA3CCA32A43C132684BCCC2BC83CC76A51BC371A51BD3795C73C03A1683D1838813DC920953D76935F3DB08BB03B3EE7443D28E2DE3BCEEF95BB106A43B93F27823DC72671B97D620D3CA5C19F3DD722E23CB50D91BC5EBF3E3DB499CBBC045408BD67C7F93C6F5FA43D7DE32B3D9B35F73CFFB6CC3C6B93983D58DA29BD3EDD8FBD59A37DBD2520A5BDFBF58C3C9452F23C7AB3863D7A96343D6229233D64192F3DBAED28BC44079EBD7AF70CBD1A3B9ABDDBA285BD3C50943CA0A74EBD05DF2CBDEEF21A3AD6570F3DAA903D3D469686BA9E11803DB92092BD45913CBCBDA9893D7901B33C48F312BC786177BD17DD6E3CBF4E17BD7CB560BD12D5A6BDF57270BD58B4953DB278863D025D9EBDCE1946BDC9140C3D10029B3DE641183DD92A9C3DA80E673DBFD7FDBC6E8658BDD933803D55A280BC3ADF493DE79D96BDC21F65BC9FB6E63C50F89B3DCD03AFBC931D923DF8798B3C26B6D73C73F6C0BCE912163D06597E3DEE8F5B3D065C0C3D6324603DE23691BC37C4B73BAF00A43D51AF5BBD029641BDD4A7643D3C45183D2C5488BDC57B693D2A16FDBC236099BD3A2E083D5D278EBD2DF1763D4E50A23C46DF2D3D02A53D3D1C05EF3C2B82D4BC57471BBDD9D36DBD408D113DBBED1D3D4C1797BC2B9E943DBF5A9CBD35DFF8BCE9F4DFBC9632A5BDBA6B25BC705A543CFC3593BCC8E52A3D802B1F3C0E70423DC1CAA13DB66844BDA820183D31AD33BD10FB14BC1408E3BC08B166BC10BBC6BB6AFB563D6CC1B9BC78256BBD8BFB16BD04CBE1BC704D4FBD4EDC423D2FCC993DA0D9113C30A12F3D80CB003C545DA63C494103BD4EE0EABCB27153BD902B17BD165AD5BC9056AB3BFB459F3D8BD3893DAA42A7BCD8167DBCE471C7BC8E2642BD8DF66BBD50E90E3D7ACAA2BC9E9E343D621495BD4C06B13C072291BDCC031E3DF8F66F3CA8014C3CC73F883D07C531BDD61879BDAAFF91BDD689F8BC80D23ABB0A3E233DFC8EC6BCBEAF193D962F563DF82313BC60F0E0BB00C7003B8D38933D3612A1BD40EF6FBB4E0D7D3D497201BD30E5DD3C4925A03D731B8ABD404CA13CF94B55BDA897CC3C924FC5BC692F9D3D6010213C803F773B5DFC5FBD33BF65BD90DE17BC284DAB3CE581A33DFAA88CBD656837BDDD7B9BBDC05E063B0E69403D312314BDE09E393C408D1A3CBC766DBDD06E1FBC30D8473C5405DA3CC8E75FBDE5D5A23D14EEB9BC0E2D4E3DEBE3823DFB22953DFA9B253D6F24923D3F276ABD8BF68C3D32CD4DBD87A197BD1F768E3D10D12A3C9F6F993D58897BBDE15D59BDBD888D3D77C3843D5C4BB73CA0EA183B80919E3B4CAE81BDE7826ABD12304F3D48F2DE3C886A313D7A18213D97299D3DFA40543DB56E3CBDE3EEA53D041B90BCD508A63D6452AD3C07CB953DED334FBB3E62633700E554BCF2F15DBD965CCBBC440E8ABC65ECE8BC7A3E56BD20F0D93C7984C5BB491271BD3F9B01BD9E542BBDC602683B562044BD40C4CCBB6E7ED43C4A245ABB0F5D903C7812623D6FDD2ABD632091BDACC44BBD30D5963C2E897E3DE6A6B73C3B4C7EBBC18D423D089D8F3D04A4943DBC3214BD1291F7BC69F937BD8239933D46E25A3DA3C1753D38F6F73C96DF8EBD0D6F5FBDF0A68D3D9CA5823D76C313BD3C109DBD60006DBD40BCA53D5F41343DE8B4823C9D1A183D7D33903D9DBD5FBC18DC25BCA9838FBD144CA03CCCEFEFBC4BA5903D2CBAA53D24D1643C8EB4973D10CCB33CE81F833C716998BD4C512FBD8D7C3C3D9B81C13CD16891BD74A9E7B945FD7ABDA18890BD2A68AB3CF6DD863CCA1130BC25C019BDEAC21ABDF8E7803D2ED11B3D3D31873D965CE33C884CB33C320DA3BD835A7A3DD269E9BBE55159BD4FAA8BBDBFB7B2BC2C95043CD9809C3D02E905BDCB243E3D4DDF813C462A29BDB594DABC6104113DBE0081BC9CB64CBBD534943D402BEE3AFA0730BD9527873D5B78653D5D2810BBB2C89F3C6A96983DD72A183C7EDA17BB63AAB2BC4EE8333D24CC8DBD422176BA157E08BDF750343DAC5C493DCC7F193B0C3744BD79ED14BCDEDE813DB97084BDE7078EBC9B26B5BC1EF208BDAD97583D7202813DBC3E2CBDB71C8DBD7AB157BDCE08993D8BCE5B3CD6D59DBD307B59BD7D366FBD65AD2E3D6BE8833DDD2AD2BC379D59BD11467CBDB53F24BD5697143CDCE6F03C2E2CACBCE303C53C599C923C0D3B04BBA0068E3DA2938EBD80A9243B15F1CBBC5DEE20BD3427913D40ED293C7180473DEE13A2BD2235B73C055408BDACCC83BD439E19BD7D93663D6C45F3BBD6A432BD54D294BD1C158EBD737F85BDF6574A3D7451BE3C9FD428BDA01283BD61955EBD09D58D3DC7D08BBDAC7D133D18259B3D0E5F6BBDF02C983DDABA5C3C63ACBB3C66F1C13C47022FBDADBD99BDB0804D3D56CF8ABDABC2A6BCF9EF75BD132DD03C36728E3BFC93A13DC997A5BC281A8A3D81EEEBBC8D77DCBB6FE5B73C491489BD1669703D232B5C3CA0C1953C51897A3C7C998F3CDB8B07BB61284E3D2180A23DB76AB33B8E9E133D858C783D8DBC42BD7B1BF43C8414E33B6547F9BB94CCC6BC3F7D03BD7C2E32BD824D9CBCB30992BC64744EBDEE4D853DB07B863D0ADE0F3D7F65453DC6ABBBBC5ED892BDE0F5C2BB58637D3CE9071F3D2425FEBCBF90383DD7D5733C581C4A3DBBE1A8BBF4EB193D4011003DFCF228BDAF039D3D1B5DE4BCC23343BD86D0823D1C00803DC148813DE1A680BD2997A33D8D588BBD2D581BBC8701803C8CC0343D86249FBD4A1B923D6CDF95BD7431293C13551A3D2234943DF93B92BD3E29A13C452642BD7625A13D29F492BD126C90BDC0B2303DE4C71C3D0AECA43C438A7ABD9BFC84BDE6FCBEBB387635BCBE3D33BDE584903D766A74BD342CA7BDAFE915BD2BCC6F3C59E3453DDD7AD83C34123E3DBF7724BD088E3FBDB8E328BDFD3E5C3D1F0624BD8E1594BD02E689BDE3D29ABDDC63AB3B46D984BC8DB5183DFFD5823D6AC438BDC0FC0A3BBDB3623C82FD97BCA518B9BCFF22863D89AC2D3DE97F3C3D3A31A6BC0230A3BC9AE3933D2906493DB24B7DBD431E5CBDEB66573C4321BC3CB06304BA4875D9BC7C8B68BC290A9BBD1A656FBCF018803D2264C73B68D0BABCAFFF983DE5C0D33C3B43603D579C94BD00AFA6BD59B5FCBB727E78BB216698BC7B5231BD2B9F483D942CD63CAC6DAFBC0C1A233D92FC3B3D39E855BD86E09EBC2F6C60BC593D2ABDE123973DEC2FEABCC49FC8BC2DEB643D8569AD3C7BDA4CBD74585CBDC59D2BBC3AB5963D6D85A63D93728ABD4FE60DBD33E8D93CC4215BBD99A2653D73809DBDBBA4103D12943A3D855E7E3DD64E1C3DDB5C1A3C8901D63C15D0E3BA72B5ECBC08A6D7BC1138A6BD36474FBD60C97FBC7ED71F3DD4A7AA3C0CE8193D01C1D93B7FEDBABC8C3E2B3D7A726F3D66E5913C666A83BD1496753CE798903D4BBF0CBC5B70873CBF5382BCC1B9993DEA4D12BDD0AE9FBC3A41C6BBABD3A53D6B179D3D1C98953DF68B513C965FF13C80B9A13D2CFA56BDD46B823CD38716BDF1AA88BDF7C96DBD3F8A1B3DFFA1C4BC34C5373DF2E217BDADB1B33CD947D5BC3D29953D870C45BD09BB983CBE903ABB9F38853DF958BE3C3928AF3C1FB12BBD5F0DB9BCD421083DF6DE38BD975DCABC4ECB853D223961BD6470953C31B272BC3EC2873DBBE0FABA29C490BC2EA83A3D5B2C06BD93BC3BBC4908AC3C5C006D3D96B9C5BC32CC343D6BA4383B602F793DEC09A6BDA78A753DD4B044BD0F8D99BD0E0D3D3D86BB443CC83E16BD9464233D06EE92BC30057EBC963009BD9D71BCBCCBA8E03DB6B3A63C31468ABCFA43B1BBB05CA8BDC286863D41D2433D4B40B83B7A4E923CD3AC6A3DE8BD0ABB3D81F93B2B05703BEF0A04BD6160B7BC02F12EBD394FC43DC82773BCAAE4EBBA3E39A7BA30AC10BDED65913AF6B6793D69A789BCE04CD6BCF01D243BFFFAF9BC075C5CBD7F65D5BD6386383D39B8F53BF4A7BC3C18EAB63C1863F43C01699F3D5FC9193C6BFF0D3D03AD3F3DAE254B3C92F41CBDF172B33C7FB7C0BDA15D99BB430890BD4C5A8A3D23D682BD29CCF43B64803BBD7A9B0DBD8F03FC3B55183DBD2E77263BF9B3883CC93B813DCFAE813D2CDE483D07FE9A3D928D51BDD0EECEBC6CB79E3DD753DE3B41D86F3C04AA743D5D4D9ABD24D66EBD92420ABAFBD90C3C40A2E7BC651C43BD5955BCBD37557FBD239F083D3729713DDD23A0BDCED2CF3DA0CDE8BB24BBCEBC224FC63AFBA5D83CC9BB4BBC801EE1BCDD828E3DBB9DC4BC3FFE633D40B2B1BB24580ABCB2D9AABD7E4A7C3DAC2228BC62F8D43D6EFC063D9DC37ABBC7B42E3D2BEB853D6DF742BD34CC84BD8D9D61BD7FD559BC13AE9ABCEF97F33B1E7750BD1F214D3BC142DE3B9E112DBDE74B303D0DB29A3B9E28293DC4C793BD006A97BBC141EDBCEBAE4BBDB0EFAD3B176136BDBDE5F23D0F63BD3CB6D6843D58E0943D6C2C40BD9F63F53CD88B46BD547E7F3CECB5B43DAC0CD6BC2B21BA3DE87C563DC9CF853CEB5027BDA118A43DD70FDA3D4A610C3DDF6A72BD62910BBD72D1723D2C2B2B3D56D60ABD2942AA3B506163BC9A482F3DFB8751B9AD8184BD974F15BC217BDE3C1A53A13D323DE9BCC78FD43CCC56753C192F95BBDCA9FCBCF10A91BC41934F3D8B8679BD2E52963D2BAE0BBD2F6E6D3CB920543D82C6CBBC958BA9BD0DFBB9BCD762ADBD774F0E3DF7A614BDBE8586BD40E855BC2F30D73B3733183CCFE602BD74F9DEBD38873ABDA186F8BC1CB43A3C0D8DE23C5093E6BCD8F8953BDF67A23C552675BD0BE288BD121C50BD0CCC013DA366763D47C434BDDB6F5C3DC4C9C83C3C12783D9B4C0EBD1E5D2CBDCD6E0EBD38AF093D19D0383D08F16CBBF55223BD5A91073D7FB4723C7678C53B4698A9BC9F6ABC3C54D599BDAF33843B11FC43BD2511A63DDC20023DF46F9C3D62046BBD1400273DC9514ABC97FD0B3DD11569BDCF5F6EBDFFAD5ABDCECDB93D3E1BB3BDEB14913DD863B6BD2F76943CB769C9BC6A0840BDD8B815BC043066BDE5094B3D86D2923D57337B3DF8D93B3D2B4C20BD27CA4CBDECD01FBDC672E33CD8B241BD2254FD3C2968883C8A14683B38D4BBBD376B413BF1ADD33CC1D9BB3B065401BDF65022BD2F0BAC3CEF050FBDB621863C61F83B3C8A3F85BCF805B5BC625DC6BCF511FABB738A0F3D132511BD2EC2533C2B652FBD313802BDD85897BCB1D6BE3D98C5523C771B483DDC8F823DF163FABB9941ACBD47EB083D9A6D8A3D856D1CBD7CDA103C8ADE5ABD703B12BD4FC5903D7C5C58BC7300863DBEBFC23D5BD36E3C4D9A9C3D4A04DF3C8BB0343CCE9E8DBDA08F4BBDE2DF8EBCB793633D45771E3D0DC6A5BCE298E2BCA2E8203BA5A77BBDA87A8D3D79383A3C15614F3D727357BC5362E2BCCA49EE3C010CD6BDE4E665BDE03C483DDFC0593DA726453DC99C84BD7360313D3B2B13BDFE5AC0BD1616FA3C980DBABDB3761DBDE43A213D5190873C8169343DE1BE8A3D616572BD5D2D023D2E1E94BD4E779B3DA7746A3D676550BDE136533D40E3B1BDA9A1483DBD39A33DCE4B95BC8040A2BD3DBC963BD921803B1F20A7BD329738BD23692EBD94EF97BD51C8313CFCF1B2BD7864AABC1456CD3C4380063C55E3E03CEDA4653DC5983BBD636CF0BC34FF3DBD8B76703C76CBBEBD308CBE3DF08715BD238FB3BD3BE73FBD48A6083D5FC1A63DDAD1663D4D731DBD377D7BBD3B42A33C79CF2EBB3941CB3D618519BD114F213DE8DB3E3B5E7FA83DB9F88A3D67A95ABD3D18D73D56075C3C57CE4CBA8C43613D230956BCA3F76D3C1CD5A8BDB3DB50BD132565BD0277D6BAF600C5BC9159683CABFCAD3C2851B93D56894ABC5DBA763DA2B061BD7C80BB3DD8D1FA3CF6C57FBD860BF8BB4F223E3DB0404D3DD9F81C3CF3B8263D9BFF18BC4A99BFBCB297123C502D7DBD1ED4833DCE62813CA626553D55DECABCDEDF473D26040BBE2B6C083D9D3B863DE5B270BD1776B33DF41831BB7209173D9200AD3D22D1EC3D108B193DBCD973BC11F4403CE0243BBCE0CBDE3C2473133D7ED996BD58DFBA3D1C79733DD3AC723D0ADA013E45E449BD7FD170BDE630AEBDF2488EBCD7C8A2BD6F2009BCDF82AC3D9604343D602E34BD39AABBBC1225C4BC1E80913C97CCFA3BD25E06BD0476FDBC51F957BC4EEE503C376A223C6DEBD9BC19C01D398C9A28BDFC8092BDC3CA8F3D427005BC9969A63D852D05BD99B6703D11A7C93DDEAE313C4FB3F0BC1D94403C683A1CBDE6D6123C7D42413D6997433CD1C85F3D2B98F9BC7BE38E3B9D33CB3C89DA24BDB3E4A6BD1CDF693D55296D3DB6785BBDAE2FC8BC9C0A6BBDE401AB3C2C1F19BD534FDE3D00017ABDE01FCA3D275A57BDDEBA57BDAB778F3DAED51E3D31D29ABDAFA798BC2A6E10BD9079A6BD57FA01BD71821DBD9CD7843B163BFFBBF4D51A3C74E724BDF060BEBB56F2D6BCE0F939BDDADF74BCD7B942BCB277CABAD16A113D98619DBC1467953D6C48253DCF4F7F3C5F8C4A3CCAAD1F3BE46431BD07E68E3DB6E298BD48688CBBB542253D6A9CBBBDAD48C33D365A903CAB6276BC7D7AAA3D76D5693D7B195CBD755D0FBD776CD5BC2D8448BD487A2B3D327F963DA49F883C114DAE3C89F3DDBC14E4C8BD71ED7C3D47C8AFBD650EBDBC1E0D4E3C66E96C3BA76266BC2FEC7FBCD4927D3D7294AB3DAA2E0ABE0CA7B63CB055D23DD67B83BCB0B43C3DFF4666BD62835FBD30C85A3D6D13ED3C4B73B0BDB190FABBD8417E3D2B46B7BC9B8E763DC14AE93C125192BD7F97DE3D7285983C6DBAAF3D3F2DE73D57386D3D6877213DFF1A443A3163EF3C147C37BD2258AE3CA33F8D3D168F8F3D96B2F23CEC6A0CBD44F1B6BDBC576ABC689588BD80B78CBD89D518BD6A0038BD52228ABD8DA7B9BB417A0ABC73B517BD2B416E3C48E4DF3B64436FBDE11A32BD8A6AE9BC592E83BD85387ABDCAAB99BB709F9C3C8E08B23CFA66333D915EA3BD5D8D7CBD1F9414BDDC3705BD8F2A48BC2BD5ACBD89472B3D05C19A3DE14C80BC4241313D0868C1BB9D53233D2BF892BD1CC75EBD4BA3443DD5618DBD1A5281BC186AFABB1F9760BCC07E4C3D863A52BC53B8E9BC8529D4BCCC2E4CBD4BD324BD71EEACBC84F4823CA9EA543D154D163D86AA12BD4AD07E3D4E2A2BBC35AF6CBDA7FD8B3C2927B4BDF4DB69BD3EB6A93C19C9273C991FE43C174EB53C494290BDB2B3473DAC7D4C3B3237B63D73BFF9BB43EDB2BC4CBBD4BABC74503CB4888E3DCA3A373D971689BCF29D4A3DB3A862BD820841BDB2E3F5BC6286963CE2C5783DB7A0573D7E0615BDE079CFBD4ECBA03D6DEF2FBD2D9F563D35ECA0BCC11D463D4A38053E16A293BDFB116F3D8D2ECCBC94D2EEBD449BB13C914D283DE287B3BDDDF3ABBD3A1FF13D772DB4BC3CCAD7BC2FB58CBD7ED73BBDB92E53BCC5EEABBD9D7F683DF936D73B6CB895BB8C3563BDCD4C8C3D6BABBB3B1D62453D2A8384BC005F85BDA7FA1F3DB83ACE3CD6AD343DD3F3313DCF59793D72BC5BBCD900103A751EE83CCA3A60BDE97E0E3D1397683D0B398B3CFFAE483DAC5C8CBDC07C9EBC7FD25ABD35E5533DA165AEBDF33F65BDAEDAB7BDF9B839BD42DCE83C83CFFFBA12C9BCBD4C10AA3DD8C3213D5A90C1BD48C36CBD006B80BDE8841EBDD0623ABDB6641B3D7673373D7C017DBC883E8FBC2858F5BCA62BE53C9AF7993D19F840BD6F994DBD3FBC0ABD63F41DBD837230BD4424C4BC98AD4F3DFBAE85BDC2FD583C839BA7BBFF56D03BC521823DED8A343C205629BD379C17BD1BE63EBBB5FFA03DBA55043D77F8093D50C33FBD60DCB1BD749E27BCDE80603AA6595DBCC5A884BDABCF3BBDA103703CEAF9CC3CA345D3BBB89D2E3D67C272BD366EED3DA85DA73B67F2AE3D8BA4CC3A4A90A23DD85B7D3DED42453D9BE892BD8A3353BC121BF63C187B40BD10AD2DBDE6DF2C3DC539803D2183993D2D618EBDBEDC6C3D30C11EBD5F98CEBD72DA903CD19D23BD27421EBC071E74BDF72860BDB937523D3293F73D3DB3E1BCCE93613BD9BFB9BD58B6A0BDF55EB3BBD12AB13C34E0173D99B4CB3BFF94383EB69090BD7F1B093D75DD9EBD04EEABBBCE62B03CF921A13CB17D31BDF7F57DBDC21AF0BC332167BDD9B9803BF74F5DBD0E0AA13D71F27A3DB3BC703BE196EA3D08C8A73D48CD6A3D7ED7223D0B07B0BC454090BC28A316BD24403F3D29DCFEBC12F404BD36B2803D8CA54DBC8E39103D3DA0F1382F4BCB3CAA35F23DBDE2533D62FA05BDB61502BDEB0C5D3CF41F1EBD8B3298BCE326313DAD625E3DBB619EBD4DCBB23D865E773DD4C64A3D612E25BD734F56BCA59469BD56E1863CE6BEE3BD445F5C3B70479A3B24C9ADBDA7AB4BBD1E4C9DBD7A9B2D3CFC2FA0BCFDDF943BF8A1E33A3D5C9DBD61FAAFBC10D892BD79B771BD6AA75EBD371DFBBCAB7C033D20D27ABD9D2ED7BBAC41AE3AE544B3BD5D2984BD2011A4BD536228BD9C66083D6E7E383C30D5ABBC643F4DBDE56EB83C1986733C7BCB793C44DBA63C0580EB3D55C3613BA3D458BD02298EBD6DA2A2BD58A7D93CFE6EA2BCF8344F3CD916993DAC1022BDF94252BD23A703BCCAA69B3C4604823BEECA063EFA4583BDC8FF9C3D3B44133D1CD4C13C41D1A73D882ADCBC14F08FBDF07420BC4DE2F03CA5EE9E3DA180323CCBA9823D4712123D9EC6DD3C68994B3C86C34A3DAA8B773D8F9DE0BDB53BBABD73C5DF3C27881F3C374F503CB4AE1D3B415F443CD2F0AB3BCE3907BDEAA5223CDEB421BD9AF70F3AB85E4EBDDB39CABBF1CC20BD9551643D83BA493EF417D93BD17AC3BDD303B33DFEC948BDA03F353B2344BCBD28E721BD845A483CBC069D3D9993AA3C1BBE9E3C92C3D33B4A1D82BD52FFEE3D6993DEBC65A3EA3D4C6F043D973EBB3C88E0C4BC0D6F8CBBB5CD9FBD112082BD326DA3BCB3968DBC1BD0F0BB6CA7A7BDF6B2913D1B0968BC107F143D69C7F13C1DDBC63D4DCC5EBD39E284BD5602E8BC9305283D981A0E3DFDEEA639499494BDD97A01BD31065C3D3F83883C219918BD6BF9073DC9BB1F3D55D492BC427DBDBDF2144D3D21C822BD752B86BD9A3F01BDB36F90BD5A81A63C61435F3DB4A4F3BCF8844C3D31C43DBD425948BCBC96ACBD8607273D38E6ABBD3CE06ABCCF359EBDACA001BDB81380BD0863DB3BC839BFBB60FA81BBAB3933BD24D1CCBC3EB1273BFB1F513D3EF1E33D47020C3D64C6E6BB5F8EF13B366961BD2C2EDA3D137EE03C02E5DF3CAD8E593C99BCCDBC5AC9A7BDEB2AB23B9BA9813DC632A93DCD6B29BDA4FFBC3C1706B43C9F1A3B3D87A7EE3B7F42543CAE4DC53DA61783BCC94B803DFB2A7E3C46A009BDC14E9F3C027BB03C00B5FCBCF06A45BDD6C359BDFAF3AE3C5179A2BDDE2257BDFD535E3DBA85563D85A3183D5C5B9D3D3433CABD0463633D47D7ACBD938983BD8FFE023DD7B2B4BC2B2F23BA9C0B8E3A8142373B53A1E5BCE0F9533C22ECCABB3A8A7CBDC4EF82BDA042323D67585C3D6D8DA43DF90E91BC23F3A13C678D4C3EB3E96ABDF6E27B3DFBFA953B6AE889BD3E6F36BD788D2EBC0E9176BD09E93ABC025E833D6C15283D42FEB73DC67E9CBDB147773D49B3783CD2D19EBD1222C73D199216BD78370A3D290E6B3DDE887C3D96E8D8BD03878ABBC729C1BD859572BCC547573D2D1B82BDD611F3BBA824223C9F51A0BD7084613D2A22643D81713DBD37A320BCFCB8B83CED28DC3CD0583B3D38FA04BD8077D4BC588FAD3C0FBB043C3724F33DD83648BC94914D3C7062613D17105FBDDA6A69BD1B86DB3D5F423ABC732033BD4A5B863DB2CD873DFDD501BDC3CBCC3A1D3E9C3D56BE163CE78014BD810E2E3B09A9313DFF8F763DE717573DD1795ABD5718183DBD1912BDCFAED0BC4B546B3D2A430B3D6F76943D040E40BD3EA3823DA3D92ABD35537E3DD247033E31151ABCCFDE2F3C26C9B4BDF25D0ABD3BACB63DA7527A3D133DEA3A2BC9BE3D38B54ABCC9DA123C4837EEBD66E4703BCDF02CBD53F7F83C2C356DBB040401BC3481D93CB9690EBEC22AB2BDE57DDD3DED5D29BDB31AA73B8FF45B3DA7AE83BCBBE69CBC331D87BC1999893DDF33803D4988A63D64FF673CF56648BBAAB5853DB6E26B3D6C912A3B4EDF173EF3A3F4BC6AA19CBD9EFE933CAC81E23C21D5123D83CCB0BD7B1853BD305822BD537455BC7B0B74BD81F2BD3CBBF4463D6702B63DD42C87BDE51C403DBBD044BA38F4ADBCD8FAE03C707489BD49BC233D1F4F443EE542743D86FB16BDF2F4833D598A8F3AB78A01BC72C4233D2C5A73BD379883BDB38983BD78B308BDBD7E233D37662B3DA06F9FBCE924DB3AB96CD3BD51B143BD6F23CABC25F216BD107B75BDF6BFDD3C3E6A313DA620D7BC4F26193C3BC69FBCEF6BE0BCB417F6BC26C034BD2F2C09BB4ED687BD7EEE9BBC0D071EBB5FBD9A3B072E9ABD6C553FBD0644AF3CDF73693CB1F52A3D4C936CBD207F2FBDA51A273C17FB2CB99E4CD0BB4A5C50BCB96899BD1EB4213DAE65AFBCB02C86BC98D35ABD167EC1BD345BB03AAFD8253D70B25CBDB854F93BC05295BC61625F3D96E76FBD1316903D7BE296BDAE1F333B4C0E653DE315BBBD114836BDED3BA53DDB68EC3B86F63ABDAAA93F3DC097883DC95B5FBD95C9B53C0AD71DBD652039BCC73DD13C1A028F3C9275213D4667E73C02A7513D7B460A3D18CFC53CE0DDA53B9906503C0F7035BD9F2394BDE759C4BD6C6B9ABC983D963D7D6DC63D4F47ABBDF522873B2BFBAFBCBCE9903C6D1B8EBD02773F3C320313BB0377843DA0F996BD937E4F3D9F8327BD7E3C2B3D17553CBBBF039E3D707F46BDA1926E3DFA8ADE3C6DDFC63C68AA4CBC24FA5A3DFAB2113E6107733C5CD29DBD333A82BD96D2863DA01B523C343943BDD25365BD149C5ABC20B4F93C4A16143D74DCF83C18E8833DE480F5BC72D82B3D035735BD807413BD409251BAE439193E35C2B5BD413D983CDA0F343E8EB9B2BC4C317ABD159BA5BCA4A344BDABB976BCA55B3B3D3543883D141D713DE41984BDB513BE3AE78021BD3599473D0E54743B4AE39A3D9AC8C1BDAB3398BD260647BDB0E3BBBCFA82953D1D4BBE3D08603A3D7CF016BD38FCB2BC107CC9BC263A923DC4A1D23C0A67473D29EECA3D7EBE4FBCCE54353C5DEA343D25F397BDAF4159BDBCB912BDAF40093D12F4C0BC2B515DBD9025813D4DC3FB3C5D636B3DBF3F3BBD45B5783D8C793EBAC1BC1DBDE71056BC1518A73D42ADB03D43865ABDB14B5BBC3398123D8EB589BD5210463B67E72CBD43338ABCCB6FB53D8579813D5B7EB0BCF0FA8A3BD0229ABD7B89BABDB27E0C3D6FD9513DA53E7D3D5E6CEE3CBB019FBB69EC4B3DCB9F8E3D2531B3BC853664BC067D3B3D989755BDF268DFBCCBC548BDFF69C33CC1D7A5BD429707BDC727283DEFBB813DE339E93C590D18BD61F8463DC0CC63BDD9574BBDC4751D3C39318DBD5B032B3D4BC2703D9A19C4BCB75486BBB7FAC7BD7563B23DC588883D721516BD90C1C7BC58CD2ABC2B67FD3B1DA5A5BD9EC69B3DFC3901BD60B62A3D63FC99BC56F64D3D82F4ABBB3774BD3C3BBA8BBC8998633DB06FAE3DBD848A3DE72053BD26FA31BDB58106BDA3CD543A4EA4DD3CC65F4C3CD9DD433D51B45DBDCAD655BD9B44983D3722293C0DDCF4BC4CCBB0BC065FF5BC74AC59BD2386C03CBF98D03DDD63B9BDA422F33DD2AD0A3D9A17683D95BF513D550B65BD5580403DFDA8363D4CA1DFBC6E48513DE1F59ABD3F8DBB3CF63122BD004E803C8B1D9C3DF812B83D207A453C5FE5FFBBADBBBFBADC9C093DC0EF5EBD1CB5A6BB5134F73D07D30E3D030965BD1B2DE53DB02833BDCADD1B3DDB8893BC54BDF33C7515E2BC714854BD4B3B053DE101B63DE10DBE3D1F12183D37125ABBAB19D0BCE3DA58BD72E9CCBBED5169BD4D5A8B3C852AA9BC70F7E4BC96EFCD3DDFD4233D62D3A83CF646A1BCA45F37BC0966D63CB35757BD0C0D23BDD69DB23D492A79BD613C8ABDDF6584BCE8E0783D595F71BDDBBD173D3CE17F3CD73517BDA9A5013D47A4A6BDFC95383DFEEC44BD721A8D3DCA79743CB72B51BB8AA0B53D804A87BD6A72893D0567B1BD21B1303D36DF14BC1C52933D9664063D2B0525BDE481803DAF8EAEBDA0CDCA3C9FB98DBD6CCE17BC149C883CDB27DABCEC2B5EBD3B4062BDF211843DFE4FE53C4D0FCCBC276409BC11424A3D638D3DBDCEE7B0BDA2E9A23C1ADE273DB4ECAB3DA338473D3B0AA8BC44E7173D474D39BCC3C03DBDD432B53D9219F53D8E7893BCF3A43B3D80788D3D613E753C1D82BDBDEF16A73C8DF7A33D02A79CBC758114BD2D74873CC0A75B3D39AC6DBDAF0D223D75F394BC1EFD6DBDFE6E57BDFD6512BC814D923D3DFDAC3CD8BC0BBD5B9D383CC9D085BD5AF1FF3C034C333D838BA43D19A3753D4FA3D13DE028CB3D9C134BBDA26C5B3DA53D8B3D37D65A3CAAA513BD13CE54BDB49E1BBD7BED8DBC6095773DA17D0D3D9402143C9A0AB93C2938FFBC0D218C3DD16F6DBDF5079EB9FDF460BC67738BBC420C3A3DDF7DE4BC81BDE9B8247FA4BBEE72AF3D4DFB9BBDB41B71BD607E8DBB7ADF82BDF996D8BAEBF253BD1AFDED3D24DA883C32C100BBD26FC33D5911CBBCADA17DBD8F47913D534C38BD725A52BDB14570BC221DC73D5C4E96BDE464AD3C7590AABDB6285A3C7D00C23D5BA00EBDC6821D3CCAA83C3D7D232FBDCB42C83B0386C13C1CDFC9BC785A4D3C6FB302BD7062B6BD495B923DAE8031BD73BABE3ABE7F09BD8937563CC4DE793CEEC8613D07496A3D2A92D0BCF607DBBB75C437BBBBCB36BCB80BDE3D75654BBD0550AD3DE1459F3D1CCB8FBD0D5D743C356AA63C42A259BD5577FCBC482F8F3D9A411CBD0424CB3C3380ECBC04CA0DBD631C63BD69C04DBD980CCCBCA9DAE4BC4968BD3D6F0975BD8488A4BD53694F3D44072BBD02BCC53DB9E4993D856CBC3CB9A4973D0886F0BCD281A03DC94EBDBCB41A83BC8BB7263DCAF3833D0601C4BC9CD9F4BC85262EBDDCDDD33C648850BBBD1C4FBD3A4802BD96B9D3BC44C93A3D51FA73BDA3798C3D553B28BD4412AA3CEE990CBDDC61B9BB832A703B4E512BBDC2ABF4BC280F61BBC808293D6F7BC13B80F2573B2E5C84BCC695FB3A9C00AFBCDE4ACA3BE904123D831D873D5C9F38BDEE07ABBD0517933DCB495CBD68E7B3BD99D31FBD2F0D5CBDC1EBAC3C3ADF92BD64188CBD6C5205BDB92FA93CAD6796BC8B889F3D86EE6F3CD797083C4EF182BDFF1182BD92DF643D0113D83DAC6FC43D2EBF843D697A153C82C4A3BD11BA77BD1698A3BC72B3023D9F1ECF3DD81D0CBD03E9D23C915D943D4D92463DCD6F9FBC831F8EBDB689123D5A8C9D3DF9EE7B3D2DA56B3D8F700ABAEAC122BC4363BDBD588AB43D973266BD8E85F8BB719C9B3DD678B3BBFE35B8BD983689BC297B84BD3FE94DBD1B05803D563555BDE537953D46EB41BD2D6F8ABD0C205DBD9737E6BC31230ABA2A6B993C69BD88BA0C9F683D4B9FAE3C3D29EDBCC1ABBE3B553D803D63A7C23D21751C3D5BC91BBB000F913CF26B943D20B0B3BD3466C8BDBD94633D8ABD59BD592993BDE9F1E3BD6F00AE3DCB2EEFBC96C8FE3C6CD685BD235449BD359204BD8096B0BDA32B2ABD32BDB53D2BF6B5BC37183DBC4E5C27BD41F91DBCA8AFA13C9DC0D23DE23F5BBC354587BD1D4A033D87218EBD4044063D2513513D6DD69BBC2D2A573D4C6F433DA926B1BCDB067FBDBD5B003D8CEBCA3B2DAAE33B3E6F973DA281933D247B21BD5D3F1A3DB6D73E3D4B4DDA3C920795BDDDCDB9BC6EADB4BD303D0BBDB952D6BCF69BD63CCFFFBB3C3E1408BDCB5B3F3D4057823DAFC5C53CF4CBEC3C9B3FC43DF7D97A3D2A3CF7BC2798A33DCBACCB3DD0283DBDC459A2BD1B8CA33CC15C8EBD5828CBBDDB6413BC4760873DF0D92ABDEE1094BD76BF353D61CA02BDBB6068BD1C2B463B4472713D88F0003D3C93413CA635C03C240001BC0F4E933D0C46F73D35C41E3D16C59E3D843DDC3DED8AB9BD9169943DC1F51D3C2D6ECEBDD76F673DF3C1A53C50FDA03D380CEB3C66A8FA3D3D45233D3871FEBCC0DE0B3D4797553DDF486BBD648E90BD154D61BD3875F1BC91E8783DA5E2CEBC3C02DC3CCC142B3A8C843EBD70A849BCCEDA98BD498DA7BCDC7A13BCB948C4BD53D6A2BC27EB9DBC2DD0833DE23ABCBC4E84F6BD8B2A80BD2FD218BD9ACC7B3D50D08DBDE63259BDCB27A0BBE090143D94B930BDECE1703CD01C8D3D58871D3C0965293D9ECE603D543E3C3D88A98D3D177016BD29C7163C5FEBAC3C1E28123DCE28983C4D496DBD17CB92BCDF743CBDB25C54BD522607BD8FDB82BD5F8DA03CFA8BBCBD568788BCC14F1D3D84DF48BC63C4033DFC51AB3B571E033D82DA393D71E68F3D21BAA73DCD0E6CBC85B0703D087912BD47AA763CCB1FB7BD00A38ABD2941523D7684023CB27D2F3D09FAC73B1E08903D8909FE3B1B4BA03B8525F43C12619A3D8DF98E3C2531933D30193DBDA5358F3DCFB8BABA25D06FBC73115ABD50E6CA3D640D6DBC62C926BDBF20053BB02AC83D994A423DF0B5A23DEC16AFBD041E87BD188893BD21DBD8BB655F58BDC0C819BCA252213D62AD8CBC8AF0BABCA68E96BC386D8ABC8F61E8BB1378EF3C3F22443D33D381BDAE11BD3CD155D13C91B3A73A7EEDB2BD05F94C3DF38068BCD96C9B3CA558103D9406DCBCC3F3DFBB4624AE3DAF049BBCE49DBABB7971713D6D71A1BCEED200BA9E90713CF342713D25CD48BDA32D4E3D1EBE66BDD23BB9BC42FC183D5661E3BBD72506BDF564643DC395EDBC445E82BC82A67DBDBCC206BCF45C1D3B35CE2DBD6DFCB5BCFFEA973B2A490EBDF3A0CCBD4BAE213DEBFC59BD4E41B8BDC3FC09BDFD1D8DBDAAF2BDBC0A2624BD1199F7BBF5799ABB1C250DBCAD10D63CB80E3F3D59766DBD8B2881BC613E50BC5A68DB3C15186B3C02535A3B20DA58BD393F743C7BEDB4BC7C6FCE3CC56E68BD6F4E9C3D8B970BBDE96FFABC7283B5BD47A863BD06CAACBCE17A70BC55F791BC619F42BCBF3612BD950B1FBDE082FA3C757093BDEBAD02BC10C0B6BDD4F77FBB3209063D36D4153D6A7544BDCE3ED23CD7840C3DF53A9B3CB24B643D1E780F3DF18B98BD73C3433DBF5702BD224CBD3B27FEECBB07D4D83C1D10FFBB5ACF84BBF843A9BB27CB35BD5C56003D9630393D3BFF603DA080BE3AB1E49D3DD306533C62116FBBA3A50E3B6C6BA8BC5346FA3B7C1B83BD527CE8BC41E7733D1BD260BDE5B3893D302C1E3D89F2AA3CE756EF3C70BA9FBD6E8FA93D9EA9CC3C8779843DE6C7743DAA47AE3D12982A3D64E4683DE571093C446E7A3C14DBB2BD69D2A93DDF7FBBBD9EABFD3C2DA673BDCFDD773DA5F557BD1DDA04BD705E1D3D5EAF283C7A0DAC3CAB4658BC3BCF433DC851B63C8889733CA576CD3C49F0923DBC44C53DFEA798382C6D8EBC9AF72E3DE28ED83A1A674DBD2C6A23BD47805F3CDC7F4CBD63AF493CEBB33839DD38493DC1CFD13DDC5B7F3D9A6593BC51004CBD10124FBD72780FBD0297ABBD475B5F3D13A239BD202FD2BC7105E33BD89B4B3DC6618DBDD9101E3D770528BDBA69AE3CE47015BDF290E8BB37CCA13C49EDCDBDD8EE8C3D672449BCFD29543DFDD0D8BD0097BCBDE86688BDDD81B3BC82A045BDCC772C3DAD0E1B3A65EBB53CE979DFBBC86519BD9DB3423DA6711ABDDB7E0EBDDA461DBDB89B4CBD6D8561BDB5D825BD21B174BB210482BD2F8C623DC689EC3CDAE033BBCC12F43C5FE448BD9F7C543D515622BD717F68BD38CA433D0A5C0FBDC6F7C1BD484C9E3DBB8129BD07D4DB3DB278183D4EB420BDEB458EBD87FCE13CF8D5363D255F83BCD87B81BD092DED3B982499BD64A5DCBCAE72BDBCA1A3B2BD10A1263DC721943C06B5B3BDC658C93B1CBB11BD458D533DB6CE2CBDF28BAE3C984BEBBA7C94CABB2DDBED3C32C9A2BCABC06D3DCB2F89BDB0C8B43B15587FBD8E7D33BD7FEA943D57139EBD494B813DB1F4BA3D2BBCD1BC31B675BD38F3823D537587BDBE3FA8BAF09B40BDFC0C1ABDA423AD3D740697BA199E953B9A5688BBFA22433DFF233ABDE9D2DBBC925A86BD4BFCC93D8BDCB1BB781C36BBA17501BD2D3C753D940603BE1EF1D9BC9837303DB17D5ABD2B88973CDBE094BDF9005EBD3C7E79BDCE316F3DF3AA64BCF12D883D8151543DDCC8793DB55F05BDDCBBAABC58FF9ABD002814BDA1B794BDEC2FAE3D6D98AABC378F36BD22341ABC6FE9C9BC424F43BDE674C0BC75F5383D776F9D3DB99460BD0AF0DF3CD8E9263DEF6487BDF951193A926B753DB2722B3D438E5D3D7367693C5BED593C99E8D0BD59E76C3C3AE8E3BB6E8268BD2E73223CEE9D37BDE06594BDB9D846BD5382A2BD4CBF87BD14FFC03CEC6CDEBC704A97BD84394B3BABE075BBFCDBCA3C77F4883C3708343D7EAC8F3D10336C3B744E803DEB5887BD5CC38F3C7649913D0D27A3BBC974E33C87721FBDCD5D1A3DD6AB643C2C41893DD5231DBD20D7093DF8FF89BD3A296A3D6E3681BD26D865BCE7B09F3D77B9BD3DAE7A6D3D08EDECBCF42895BC2FC026BDFAA9403DAEA28C3D0B8AD83C449C99BCD6F8AABD5317AE3D6AE3BFBC21177BBD17A59ABD1EB5DABDFBE664BD9082873D9F499B3DE9F401BD732C83BDC5FB02BD35A6F33C595590BDCC1E88BBBC62D63CB7FF39BD30B8853C76611A3DFBD5A2BD6682543CE38619BDDCD6473D178DB63D022AE73DF516A63DE4B520BD111932BD64C829BAFA9D633D22FD86BD1A94883D2705AC3D41FD41BD6CACB63B95CA50BDAE22813C41371CBDCF839DBC62A0ADBDBF7A433ADD8F8FBB9CA11C3D1F67933D74CE953DBF746CBCAED7023CD82CAF3DB8D70B3DDDDECFBCB08CC5BCE874BFBB49B09A3D2AFC57BC97FA703DE4AF3CBC33ED2ABDA3205CBDEAAD963DC229143DF4E686BBB444E7BC81D7B53C0941A13D83DAA33D568B7B3C551C943DCD6BA53D4297943DB3CC473DDD5F8ABDF8D500BCED5F643D95C75CBD510EB7BD95BB95BC4D6F4C3D83AE143D58E90E3D4F1FB5BB8318FDBC98C05CBD3004DA3C18242FBD924FC23D0A337FBD4AC54FBCF0E19CBBD49781BC5D74AB3B6180CB3CF97B333B81A1C43C918D69BD0003013D020A82BBAF218CBDD69FB03B74DA143D97BD02BD1BF79E3D1B92513B0E9A80BDA20F453C6DD9693D3BEE0A3D82D93FBDE35B3ABD4EEFA83C5EE0AABC7F27883CD9F24BBD3606273DDFF56F3DFC3568BDCFBF233D3290EDBDCA7451BD3F71873D5A7C363CFB8D313D8B691D3DF78FFEBBF451243D430689BB5CACDABC7B5517BD3A38E6BC1BD0993C09C683BC6652D8BCA3DB6C3D41BBABBD3B59B6BB6A6B5C3DA8A947BC083607BA286E46BCD7DAB5BD291651BDBDDE57BD56E518BDE10FF03C277FF9BC9A9E0C3D365D7A3D2D4B31BC6D79493C0BB76B3D8544A7BDA4D798BCFBBF1FBDAB80ADBCDFE7613CB8709ABC5E9331BBB62FE03C3B6B25BD07CF25BCC680553DD3E28A3D1A965BBD70EC643DF43A8BBD6C07843DF2914BBDDFB1A3BD2B7CB63C0F44BCBC2811B23C8BB42EBDD769A3BD0E48C53D81988BBD0AE460BC5E49B63D50D1D13B574F9A3D3C8DB5BD8C3593BD7E16943DA63BDB3D17864ABD4BFC79BD7BB187BDC000A33DE88F063D06BA003C86A9353B3B92AC3C4F62713D122D1A3D0D23033C22D0D13C964DD83D9E492A3D640C933D22B3833C86E92D3D4B318CBC8B5D193D3ECF53BD02D37A3BB7337BBDFCE5623DECEE833D77200E3D445CD2BCE05197BDAD7B3CBDA5C2383D545042BD977F443DF875A2BC2F045C3C493B47BBC9A6183DAC389C3C8AC73ABDA4A8D43CAFCB373C71F49FBC21A5763C4D8798BD8C78AFBD236869BDE63C29BD8617AB3C1C0D453CDD7A123D91748E3D39F74DBCEBA542BDDB7D92BB5D3CB73CA5E8BDBB4EE82C3DACC26ABDC92BD83C8703F23BCFDEA2BA0F849F3D5E149EBA88B46ABD52971CBDBACDA03D5A23993D2136D0BBC0C3EDBC3C47D13B87B035BD0878B0BDE05DC9BC26B29D3D19F79EBDA51A7ABB81E338BCBA3A2C3C18169CBD3976ECBC6707043DBCDE55BDB1C882BDF1CFA33DB3F088BD11DC8FBD56B7F03C1FDFA13D5C71883D8CFBD1BC26A9533D8682753D29325E3DD6C45EBDA293133D4453A0BDA9CF20BD8C31003DAFE79C3D37846EBDD641593D906F0EBC45BE4E3D8B1E883C19FD823B9E0E203CAB66123DDD4B12BD8EE07A3DC566B2BB6C2A5C3B4A8B88BD66B351BDD715B53B511CEDBC00F6CABBDF7809BDB0DE45BD864D733D617D473C0AD7C23D48D9C5BB2F18B83C52B0943D3AF71D3DA3FDBB3D9BD4793DE38C4BBDA86F3F3DF6E159BCA1D24B3D867C2ABD39DE0CBDBDB58A3DEE5A1A3CA453EEBB85456CBD624401BDEF513B3CDD584F3D0E5C90BDB79B11BD7D750DBDCF5E813DC8935EBB9584C6BC25BFCA3B7D9F5E3D5E123ABC675872BD75525ABD080E77BD88A7273D1C1DCABCCC8E2ABD40C196BD9D23A5BD985D5FBD02FB5CBC2DF0D2BB59B0AFBC73A4703DA3748C3DAF82B0BD2D08033B63C847BD03EC35BDC71130BDA072133D64E031398CA327BD5657683D041A62BD612C8EBD770AA83C36F1E7BC77A49ABDD65F91BD8EF99C3C354D453D07746BBCA1158D3D51EE0FBDB40B2CBBE11591BD9F9898BCE4BB3B3B0045243D84C281BBB76E52BD35B4713D3749EFBC40E80FBDCCD593BC9F4E8ABD7431E3BCB3C4013B50B0D33B1FEA79BDBAD0AABCBC439C3C1747813DD92D98BDE14F433D507D52BD9F9117BB6853993CDD870C3CB4D70BBDEF659CBD124578BC8D8558BD3CEEF2BC2414DCBC4C79673DF95351BD5CAA863DAE7B02BD7D88083D8A4892BDF2BC4E3DA93DE6BC35CC3C399A60863D1EFE9ABBE184D1397645093DC667E1BC74D49C3C507D85BDB21E06BD3A446DBC2CC235B94F28503DA9687EBD5989513CC619C8BCB40E24BDD2C9F9BCFA7FD6BCBBF07E3DE20A60BC4301333C46CE183D87B364BD787F9CBC756E843D40F218BD19028CBB0E17E3BC08A8A83C98E990BDB54E87BD1D7F4EBD6C634FBDE7150E3BFF91603D6B9D27BC296E173D228388BD9FFF90BC0D3F74BDD66D98BD5749493D9252FFBC65B298BD17AE6CBDCB7B143D0C92CA3CA687313D8696A73DB6B482BD77B19BBBF4574F3D95B8B83C1E25D53C6BCDAA3C06BCD43CE32A88BD86DF29BD984BEA3C3A46863DE8E72F3DB4CCC4BC05DDC0BC6D15A23C0E679C3C0E5291BD016386BDCADF293D658299BDEC23FC3B2DCA15BC8F1F81BDA4320C3DE29EF8BC2A5FFC3C4F7E793CA598A3BD1504373DFEEB173C5664C6B959F085BDFF2982BD922A2BBD3A7F9EBB2A7C6D3C35E6DF3B16105F3D5E539C3DFA69D1BBE77970BD45C5933D5C106B3D3AC7023D1645A73B79F08A3D850E37BDF1CAF43C932A06BC8818893CC6D712BC796384BD65A99E3DBBC6493DD82209BD563672BD61A777BCBF399BBDBA2F96BDB2027BBD68EC91BDF2DF1F3DD468AABC76DACDBC79DC8DBD3E528DBDF610A0BDE3986ABDB73DA73D690589BDBB9CA8BCC2795BBDC4B4A53DA1E9233D814983BCD5B7A33D6DF8183D674F8B3D52B965BD2B18A33DC2696C3C7DEA7BBD8107803DC08F413CFC8A8FBDDB6DA93DF5D5C6BBACF66BBD03DC343D59A08B3D7EFC743DA1C50CBD0AC334BD42C78F3DC4C4EABCDB21983D4E42273C0A16B3BB18F7823D591514BCACCC563D68A8A43D179C8ABC4AD61F3D1D5CFEBCE4498B3D8BDBC0BCFFC77A3DA1F30EBDB66F9ABD0D58C1BC178C80BD51641D3C5373553DA573A2BD599AF43C1BB660BDABB9D6BC0C378A3D94F4193DAFDA8DBC07E915BCFFC095BDD59E8A3D673D88BD2F175DBDFE3C61BCD56B8ABD13A1653D5D9B50BBA1644BBDEEF968BDD59AA03C477A2BBDAB6122BD39780FBD82037ABDED983CBDABDC54BB2B9A9FBD2F1B59BD2802413DCE92643DAF155E3DCD2C00BD62BDA4BDEE71993D585A743D402279BDB0560ABDE523E2BC4CA093BD9B25913D0A6297BBD5328DBD8A36913D7F137FBDCDBE89BD279E8F3DD67AA63D692C213DA30B0F3D7E4D11BD50996DBCFDDA703DF6770EBD6793A3BD446797BDCF7F79BC3E5F5C3DBBF3ECBC232FDDBC864CE3BB14AB873D7EA6A3BD980FA53C0181C3BC152A5F3DC05751BB5F869CBDD30F8DBD6327903DC81281BC8E31A13B466F6FBD2475A7BD29034BBDCF40883DE6E035BAC15210BDA6C1A53C5913773D4C8859BCA44CBDBB0DB3373D1FB2E63C50B379BCD9F2F33CCECE8FBD76976A3D73878EBAD86209BD4891F23C0A94653D0080863B46B147BD64C191BD38FCFFBCF6EC7DBD7393B53C91FC27BD0F2215BD706C5ABDF0585DBD429F983C60BC7FBBDA1F533D4A1587BD40F0283B6B6F85BCE06110BD17D8B1BC6BFE4ABCA55D503DF0B42D3C4E68A2BD8FC670BDF903C23B238F14BDC80EA2BD4B5488BDB1B5913D47F0C9BCE8E70A3DD4E08ABDE9876FBC3CB9833D3CD6F3BC93DC983D66018CBD40E508BC882AA5BDF8AE843D2CC5833D0C05E4BC041F7ABD8E13033D922DA4BB9D4F97BD19B59F3DEE77813DBF74953DE1C9E33C02B4023D1D0333BD3DA4163DBA16F13C7C2485BD3B6711BD2C02563D70709B3B45BF173DFEC6A63B5091D7BB79ED9CBD89BFA53DB2163C3D1B4945BDBAC4663D384C67BDA56C75BDC02E98BD672FA43D91E4E53CEE25803DD4AFABBB3D8B5CBD5489853B400E83BD8E3CD53B50E252BCF7485B3D36B7CA3C81CC863C49A2CE3C1E610EBA67419FBD62E7513DC4961B3D6A2B6FBDE72F39BD3BF8823D9ECD9FBDBC73B03CAA392A3D70607ABCC0A5C23C466183BC1C0E183D9F0E583C9416C03CE7B439BDFD9C3A3D058A093B33A5873C7F4F073D208B1D3D18A6D3BB12093DBD90A79CBD217EEF3CB21A26BCE7DEC6B955F5E13C351D8D3D9BB0AB3B486781BC611F9BBDAC29393CDFE122BDA03EA9BCFAF4133DB7480BBDDF7DBCBC7661073D34552EBDE3946D3DB4CEF53C35003F3D450D79BD225C173DE860EC3C404A373B3AC7093DAFD2B33C10EE24BC9E024B3D0C0E933D5FD950BDB77938BD02D994BD264C24BCD8D4A43D8FFD10BDE0AE0A3D8249FC3C0D349C3D45AC7639A0157BBD9FE9A13D4056ED3C3DECF3BB9C279F3D308819BCF0CF9DBB8A9F6CBDD5038E3D16E4A7BC675CC1BB843284BC35865CBD5DB4443C804E7BBDA67F413D496D6EBD08CE9B3D838E8F3CB30955BD35A89B3D4302833D9966BB3C2089F93C3C7B9C3C18A573BC8BFFBE3C3FF4F33C122731BD9B638E3C6D6E943DF551B4BBEABC4CBCA22B71BD847449BD8D3E9E3D802E4F3BD44827BD7E6BF9BCBF91883DA89FD63C35E0E1BC7195A2BDCBCC043D5100853D4FE5D83C4DC195BD837040BD04862B3DA7CC5EBD03FC173C1760B43CC6544E3B11A1B73C1951663D5E2AAA3C4F1B723AAAE85F3C7DB892BA535D8BBDCC3098BCCB8EA93AB02AA1BD29FA713D6EFBE6BC20F12A3B4813863D6EC80CBD281AB03C1B7E1B3D7F4983BDE884B73C1C35D43C7B2707BD0B3970BDB340DD3C996D953C82410EBDF3CA833D0D73B23BF85FCC3C86842D3CF91E02BD46DC3EBDA406273DE833D7BC90A509BDA0CC0CBD0B7E733D631C99BC47173E3C064F88BD82EB163D1EAD27BD764B02BCCA34383D55F1793D729131BC0AE7743DA6BC59BD4498ADBCEB601F3D944D8B3DEFFD12BD411A5ABD2679A7BCBDF92E3D91E72FBD9B0A39BD1FD88B3CFD7585BD0740E73C8D82A13D8D3A543CF55E123D7F27613DEBD6FEBC4DAF793D8A3940BD2074A7BBDAB86CBD12A8E13C77EB28BD575A9F3CAF1D5D3C5A351DBCE120533D89C5EC3C67970BBCF0C4F73C235F9ABDD18888BD8E7A123DEA3BD73C05FD9DBB4946913B8C5C12BDDE7DE7BC8D65A5BDCA645EBD6849203D4C4B52BD332C033D4DA4263DE8C9F3BCDC898D3D0A66D1BABB76A13DA1E95C3D3F097EBD1AB0603DB599293D9B25563DAF5F35BC5EA93FBBA3826D3DDC2993BCD747093D08DBB63CE4BACDBCCB14D9BBC0048DBC5CC8223D9F521EBDFC9D58BD1FC5463C9DB9E73C893B4A3D651EE4BC182408BDC825C33C058C863D45D0773DDD95483D8719703D41B8303DDEA8BDBB90EFECBCDCD150BDC3CF0EBD038C4EBDCCBC023D447D8DBD25E3323A586959BD343526BD69E845BD26CB8F3C59CFBDBC9A86703D123C763BB3832D3D7CE7533BAF22B6BC4FEE95BD07CE93BD2A529CBB84FD7F3B9926B73C9F4113BD035E723C29DA1ABD2585143D39FF903D0BC701BDF8214BBBA26E2D3DDC4E683CCABCB6BCD617C23CFD61CB3C250DCBBC4756CE3B245050BC8B3712BD6D72B93C3D788CBD6268553D71C86DBC925E81BB7DDD5ABC5BB0C5B96772F1BB0F98EDBCFE5B543D75AB3DBD0993B23C3F315C3DDEAA0E3CA49B9D3D0DA392BDF3F880BCD614CCBCE84094BD990B603C46EC803D2E63693DD611853C351D51BD6B1ED4BBEB20C33C9F10F63BF45DBEBCE1F5413D0DB65CBC28F8713DF74ECEBCE34A973D9E2855BC2F192A3DEEF585BD8DAA13BC055A98BD162580BC95A291BDD66E963C2DF03A3DCF77133D02595CBD56CE93BC006E8C3DE52A5A3DC0B2903C8F98BEBB7757583D050B0CBD4E1E5FBD991ED9BA49945FBDBC3E6EBDA50905BCC73A0EBDEFBA19BC052D13BDA53889BDB51776BDA048413DFE129F3DA53A773D44695F3D7608583D08E38B3C0055C8BCFCC1DD3CC9FF8F3C3C58F53C3F6E283DBE6F64BD32E88E3CEE556D3CF99856BDCEFD78BD3D1D563D16BA613C0FA286BD627FFBBB31AB6D3DA625023DE042793CD769993DDB96093C9B9B733DA1A6963DCFE5353DD8A204BDF26A603CD17D9CBDD7BB07BCF1BDE73C323C793DDFF112BDE8B58B3DF20FA3BDF65F0C3CFCD46BBD36AB863D7A5DC2BC9B95473D245A88BDD2FD663D765607BCB08BE8BCC9ADA53D01AF1D3D096D0DBDAE9062BBA2944CBCE7091ABD295CA0BD4B699A3DF12A41BDC06AB7BCF10813BD9A31893D0C55EF38773A883C454392BC28927A3C128B02BD1A13FBBC0B92B9BA645C92BD99B99FBDFCAC88BBA48F983D1CE8113D836D6FBC4DCA64BD46CAA33BC5B44DBD008FCEBCBB296DBD526604BBE90120BDE6DD323DA8CE7CBD50AC903DEB81063DCFD80BBDAD81D5BBFD255FBDEBC1163D06C329BC813B17BD5913493D531EFF388E3B8E3CF9F08A3C3EC3553D95165C3C1F7B9DBDBFEADD3CC0627B3D065E89BD6F2B71BD5CEB5DBD85CD1E3B698619BC5E0C083DCE7D0EBD5D0D983DBFEF9C3D00DA72BD3A23993DBBB64A3DBDCE943DFA9B48BDF34550BCB96B9B3D8582E43C00BB2C3D9D1462BDF1505F3C6949C33C53AA67BCAAA5393D247948BDE2FC483C45D5E6BCB3E89B3D14B2073D53603CBC2771813D2F0F54BD3977753DEE3C013C4C2B803C883648BDF35DA23D0A85CFBCEAA7D6BC3F2A833D49E919BD34EB9FBC303251BDB492333C0664AB3D9136F43A2EF6A73CD5995B3C1223E2BB558F893D850B823D370384BD9EB498BC69A499BDD3B57ABDEC1E88BDB4C7583D1BFD3D3D97A2083BC5277B3DC0F143BC40CA893A5EDF953AF64234BDF3A9AA3C334A39BDFBE6AEBDDD6C2FBDAFC895BD7087483D85AC88BDDA12AA3C51842B3D47A75F3D987C90BD92809ABA20EE0DBD1F3D533D0CC20B3DB11318BDF62B883DED48353DE4FB3F3D4C0A18BC798767BC52DCBC3BADEA50BC193BA13D0C5F92BD04E87ABD8FE03E3DD9A6F43B312BB8BCD49D923D2BEE573D632455BDD812BD3CD1CB95BBA10A313CAEBC4D3DA0814FBD444B893DF36EAB3D6341283D06DB943DC9251EBDF8A721BDCAC3163D7FAE8CBD31EC803D18D4233C0A14423D084AF9BC1EB6843DADAA703D544456BD73B78F3DE72036BD7ADD1F3CBBF6793D6602833D76CD273D87C7673D45F06F3DFB0697BD96D7673D070B4ABD6032D3BC6693723D89A55C3DBF0A333DCEDC0FBC4578073DE8D8ACBCB39E98BDCA451CBBF416413DE69E9F3CA0F1083DD4626C3D2A1C113DCFC95A3DACE1F03C153E183DD8DB61BC119C443C07ED73BD056614BD99192B3D8D0E313D91BE48BD6B056EBD06BB843CD092CCBCE0752D3DF3CA883D6AED943DB861A63BA2463EBD7CE80BBCC18D713CED5FB53D71D924BDE3419DBB7CAE153A6A7819BD6A1A97BD5946AD3CE14289BDA1B686BDBF126A3DE8D9DE3C874E053D0376423D3DEE52BD8C3F3EBDE9EC39BD58A712BD1E437F3D811118BD7C7664BDFB74C63CDDDB9F3DE74EC13CD685BB3CE950FFBC88AD8DBD602934BDCCB5B4BC5E1C7BBD08B5513D14F51E3D5B9054BD16AD963D95B0053D55A03FBD37C38E3DDE69553D2E56A0BDE1ACBCBDA2CE24BC5F46C53C51D7073DCC80B3BC84E01A3C3D1C6F3D13559CBDA5EECCBC7ED39F3DD191843D4DBE56BD48958A3D6AD36EBDF3E9153D3B35B3BDA882CF3CFB84B4BC81BB573D1403BFBC7812963C5718A03D5F9A58BDE60067BD795E313D249AA33C46D837BD253CA63D73DB90BD0340A9BCE15D053C20DBA83D26C1583DF1B579BD432ACC3C7D2134BD3ED45FBD94B48B3D07731F3CCD4DECBC18C72B3C81FF423DE673513C3D36913D7BEF2A3DE03740BC1906C63CAD0A153D540E37BD7B6D72BD701A663D984E4FBCBA5FEDBC8B89833C273BB43DAD60A7BD5742953D00CFD2BC340300BA90CB1FBDB2B4F2BBFB5F30BCF7DFCB3ACD2A7ABCBA4329BDE498F3BB2794AC3DFDC578BD25DDEE3C73700BBB4EE7AEBCDFFDC93CB8E7D4BCF2946DBDB39763BD904338BDDDCF99BDC7B970BDBC8EC43DD8D339BDA5A35EBDEB8F15BD18140A3DBA18603D48371B3D0CD7623DCCFDAABC743A3FBDFF03F2BC1362493D15365D3D2707693DB55E423CB8CCF5BC96B528BDBC7081BDF44F12BDDF6CBABC0A45FCBCDE0828BD117F2BBDE3B87F3C48F0BD3D40106C3D216958BDF82598BC5EB9913CE9EA9B3D21A6A7BD48DD44BD02963FBCE7B64FBD3FBD8A3CE5807DBD86DA60BD28B6CD3CFA8B8BBD8C5A32BC228F95BD4E2F52BD9D6E85BDC4873C3DA073B03C91EA263C9A9F80BC9383B13C9E0FF3BC1B70603D315A84BD7ACEA2BB1EC4103D69166DBD95B6A6BD20F355BC9C2F32BC26A64CBDD9843C3DEEC1B13DA37D5A3C3169863D149C8DBD313A6CBD35AF673D8759CCBCCCA28E3A16C384BC792E7D3D8C54A63D6B38D73C43FC0BBD6CAA6DBC6C00263D1D8C003C9944C0BB6072973CE46B84BDEB3FA13BCB59F83CDFB458BD0D8918BC5D9A9DBD486D7CBC03E12E3C7C0133BDE54B85BD367E583D762C56BD089D4A3D9CB94F3C7713B0BDEAB2BB3DBFD0793D68751BBDAB86BA3D7204B13DFBB4C43CB8D2DA3C720C79BD1AF893BDA3DED3BC90BA82BD329E883D6227823D32700C3D25F8A23DBFAAC9BC2C6ADABADB80833DE3FAA53D9B2F543D15415E3DE8DA463DA1753F3C1BB00E3B5AFF873D3B0FCD3CD2079FBD14FE1A3B6AD2AB3D23D92CBD974E6E3D7F1B08BDE9C33A3D4649D03B200C7C3DD21FB6BC2020CD3DB2C88CBD7049323D9B65393D7327213CAEB4ADBB22BB803DB4BCBD3D30F289BC8DCB743D54C9383D772093BD2C7906BCE70BD33D60C34E3C6D01E83ABAF5B83C478A71BD39FD86BDA2C6A63DA0E4283DD34EAE3CA27FA03DBFC56E3C7542023E20DB7ABC5703963D832421BD20F84ABD45BA003CC5AB59BD11634C3D98A6A03DF072ACBD4B82DB3C426936BDA9DE94BCB8C9A8BD156C07BD83BCB1BDFCDB2DBD4E0B73BB0FCF103D3E57C1BDE79EFABBE156EDBCB6FA82BD03A70BBD5D27CEBBCF72103D3E95603D35C8F9BCB7E981BC67F738BDF8F4A23CE1DF72BA7D833F3D265F953D810589BC792404BD9A0DA6BD7BD7C6BD2A3CA1BB2428BBBC5D48D4BCA5CFC5BCF7DD0F3BA0EDA23DCF0F35BD0F3A14BDB9DAABBBDB160A3D9F93573D211875BBF657843D0052943D0BF696BDD734EC3C713DC6BC3B0DA3BC1082EBBB0DEEEF3C9285EBBC5F5C82BD5EA47038B99D46BCAB0E0F3B4091F0BC42978ABD2F10263DF5F9693DCFB47B3D21A5AF3C2A3F9ABD4A70ACBD469884BC6275083DC022123C76C29F3D482E28BD6B3A95BDD81104BDEFBF8CBDD795823CFC59A9BCA573BEBC8918A4BD6145B63D2628CFBD12900E3DB70F5C3D3E1299BD32419C3B74E6133B6C6396BD808550BCB5C1D73C030A7F3D7EAD793C20611D3DA18D6D3C67B8823D1DF04E3D44751BBDFF59583CB431FCBC76E984BD00FF4DBC8D3A423C2AFC07BD68603B3DB44AED3CB83DA83C71A2F7BD0A3232BC3451423DC87943BD36D78E3C68BC2B3DDE4A5A3D139F52BC5B3A753C1625883D9542873D3F2437BD0D69303D6B9B89BDADB2B0BC23008F3D79A164BDB7E2C33C7E6C343CC971103DFC30943AF9A210BC094B5C3D150C1BBD8997A03D24167339710D9E3D645C3CBD1803CFBDD0B88DBD9E1B593C548844BD6DC2ECBCC3A8663DA166D5BD20812DBC3809F0BC169D663BDE9C92BD3547003CA36B1FBD684AFABC61CE4FBD6CC8053D025445BDE1C2553D5AEF5FBC4EB44E3DE506B3BD90A1953D94C5BF3DA1DC473CF78E20BDF651423D74533A3D4ABCA43DD529433B23CF383D8AE027BD5527103D9A56A0BDBC148BBDF693843A5D57453C06E0A9BDCB6E11BB97C358BD72A11E3DC7A600BD80CFE13C9A11B83D96A081BB51B50DBCF092D33CD29F64BBDE2D68BCA8EA8B3D28045E3D8A3F0EBDE4493C3D8B1990BDF24480BC10AFFB3C1F8E4CBDC53D09BC475B33BDB4C5943C1B64B53C645996BD1BC242BDB45968BB197937BD58D6A1BC9072893C513F1E3D5BDE9B3D0C3EF1BC430125BDEDD1ABBCCF8EA0BD57B38FBDE818373D8D93593DC98B3DBDCD4B8C3D88F890BCF0CB11BD96E5A53D65D14C3D796521BBA7133ABD1E8DD53D42EEE8BCDD4168BC21C61CBD1B10F73D92C8B33D38A939BD64AE853D790A93BD603E2BBCE5D9E2BC5D9F51BD3B6D913DA350483DA3C9253DE36F8ABDA4568B3C1C1C65BD7D75283DA91F0EBD3D095A3D9A52A5BABFAD9D3D0199B4BD4767ED3A295FA83BCAADA13C9E83893DA70F263D399C643D9B23263BF690A93D1B351ABDEC3D62BDADF087BD68B7F0BC1EDF993D9942FDBCFBFEB73D7334353D486D74BD06BC98BCCB73453D22CE72BD194AFD3C14DF8E3D559B83BDB5E13DBD33CA9FBC1D9686BC4CDA2A3D4511A8BC5CCEDBBC10D906BD9609993C2D1D88BDB64C96BD4300993C4193EE3C96E455BDB6C58E3DAFF5323D0FB1883DFFB0FE3CADAB92BC476580BCA0C237BD9A4C3C3BA13401BD37B907BD07037ABC599F16BD83866ABC613305BC48A93C3947EF15BDC01A903CEF5219BDCBAB063D9E53AE3D9A7CBE3CDEF5CABD21995FBD48FA953D0272073C4F1720BD6B42A93DC2BE153DF381F8BB0721333DC610BBBC9F20993D9E7BC4BCE2294ABAF9D2A63DC152F3BCBA815CBCD01B96BDD655813DCCC8B13D578293BDF69D41BC2C753FBD1FA48E3C8CF2D63D1F960C3DCA08FFBCDDBA9E3D23029EBD1C5B02BC6E767FBD03CE40BCEA96E73CF3F7B5BC537F473CEA7697BD681B393C168A0C3DFCF733BA45092E3DEE3C2C3D166F893D036D2D3D96C7423DD963803DC5E1A13D86FEA33DAE20A8BDE5EC8D3D23CA56BC2D5CA2BD0F8725BD6C35A73CCCADF23D48239C3DE8D8883D7A7FA13CD040B0BD0EF788BD70139DBDEADD0D3D7BD9503B2C2911BDD7A77DBDD945B83D69D924BD2F09913CEF2ACB3D21DBD8BBDA95623D3E71913DEFE88CBD55B7A23DE2B520BD75C4463BAFFB40BDB452263D513B01BB3F5690BC81FD7EBD4E5A67BCACCD29BD2F8D52BD88EC8E3DCF354B3D1B6E453D9514543D1F5D7BBC2AC93E3D7F58AE3C5588A8BC4C34273DA4C4303D6DC71C3CB8C01A3DF2C099BD2DA8073DB084B9BD58DB183D46633BBDEAC2963D30EDB33BBF6E53BC271D30BC1CB4E73AE7D9203DB9BD8A3DF3779FBD411356BD2291173D553C453D9C462F3D0CCB95BA0DE901BD20449CBC86C8923D8D8AA3BD0E1F0A3DE0D16A3DDA2898BD4B4ABC3C2B0D90BC53FE98BB17E37ABD1EF03ABD7325663DFC0F97BD8DA843BD773CE63C037623BD0FCF833D7E61393B51B86ABD737D60BDAC63A2BA5949113D21080D3D7208B33B8B8EE1BB868CFF3C080A5BBD748B513D5CEC533DEB37A5BB6507C83DCB94723D0C505EBCF303083C405EC4BCF341F3BC87D8273C9BA8D13B3D22BCBCACF2B8BD1AF8513D0FFE193CF310DD3CCDA001BD2BB134BD254C253BD1B99F3D7361753DA41A67BD581D58BC02420DBD49D5ADBD3E6534BC5D6593BDA9B048BCF448363D3D7E12BD4BE19F3D7ADF0D3D179232BD249C0CBDF85ED73C7022CEBB6AF016BD90782C3DF0AE0A3DCB4951BCF0782C3ED1DC0ABD58856EBD8E0A2ABD6AD144BBDF748CBD8C9AD23926E7053D0E641BBDCC58A93B7EF8993D1452A53AE93BA9BDFE54F4BB82FD193D6C90F5BCC7B78C3DF8EB853DA9F36D3CA079EB3D05A5893DB4FA3B3DA917E93B4424093C05FA983D28331A3D65E900BDB1D9C8BC2085B23D1762B2BD18198EBB80E8E23D4767D5BC8914193D0E1F063D36E48DBDB3DF99BD1C499E3D2ECEAABC8CEB933B24AF08BB079FDF3C14841DBDEBDC543D4C9D40BC8870963D05E988BDF9DB71BC0B9E273DF3A6BBBACA875CBD6CEBCCBC673B303D6A8D143DD60425BD3BD17C3DE4FC873D44F7F13B5763CBBBCD90E23D1F569EBC3F00303D0788CEBC05F1A3BDB13FE1BCE139AABD289A8B3DC69171BDE98AB1BD0C0B9D3DD9BF503CB685B93CD0EB6FBD0A0AC1BCB5D998BBC6FA83BDFE48123D428AB73B0F4D9A3DAE0D53BD68A48D3D2B31863D65BF93BB4ED1CDBD083B87BCA0529B3C2C9F2E3DD2950B3D4FA3D83C50FE0D3DEDCF7DBCFB9DC73D28565EBDE3F4EEBC4583D53D7B3F913D1ADDBE3CE014DB3B681B863DB9F4163D047479BDB23F99BD4A1B19B9A487C63C7F4E8DBD359B7E3D645ED23DCB88173DBFD6773D8985E8BC3C5D783DCC4186BDCDC9083DB29B77BC7DB5683DA9CD6FBD4429B53D6102383DDF86473D3359263D7862E23C7D7F92BC17E8403D590385BD41643ABDD5E68DBBABBE103DC51B0E3EE6F0253EAFE0673DE63D613DE4E859BD9E9882BD27BAA8BCCA85DE3CAE1E89BDFFD762BD7D6B1C3D161760BD54CC36BCB25D423CF6CA443D991492BCF9ECE5BD8599CF3BC3E0CCBCD92B7DBD30865B3D14786CBDB40A63BD7DDA8BBDFAE7FCBBE738A63B3857383D178F1E3D12912EBDC01D483DDCA3473D3EC313BD759C5FBDC59625BD6AB375BD15A89C3C044A983D9245C43C72280D3D5ECA653D40C6D9BC4220A7BDB21AE3BC4D93DC3DB4ABA73D5E42B03D1697253D6FEDA03DED074D3BAF95AEBD7D66183D2A6AC8BCC879ACBD907660BD253917BCB2318ABD61DB883D5C4FB43D1BA3393D3240ACBD49DD63BCA44DADBC754BD23C19D2AB3D4E44C33C7327703DAD10F2BCCFBBF73C3289053DCF8AEF3B85238EBD6540D7BCC9A8883D25CA5ABC16A05ABD18CE52BD9B7F853DA564683DF00395BC2625A3BA6F94983D845A783DE72D973C086B163C87F85FBDF79A1ABC56EF88BCF2EA433D3A5384BD638B3C3D0A1F73BDC02CD9BDB2BC253D7F3881BD43919EBD0963F43D9D724F3D6863E2BC63C091BDC814033C6E6502BD2AF952BD8416213A99769DBD2C42333D48C2B6BC29A18D3D9C81EF3D4621F03C062B32BD798B81BD4808983BA6101E3D7F362EBDD676363D07E6E03C6B95EF3C019CFC3DBE40DEBCEE1D343BCB7C493D3315BD3DD92A543DA4FED2BC6C3B78BC4D2896BD1C63F73C93CD79BD8C0D003E87BDB63DC8E186BD2F4628BD2EAC86BC6FD61BBD1549A1BD8B31913C994C5CBB87CC18BD464B9A3C19415D3D14047B3C2511C3BC14D57D3A8CF6713DFF7216BDFBAF463D29BD173C671B2ABD3390A93C900316BD7D198D3D767E42BC39BCB8BDE9EE98BC5CB1C9BC5108A13CFF83AD3D0101AC3C8363783D149D113DBE60823BABBF783D9065A53C53D6A73BD1D1BD3DEF7C98BBF97816BD5E4D9A3D72EDA03C42636E3DBC33A0BCA3D4613C0233913C220E23BD8911253D50E496BCAA8D333B9BA255BCE2F8F6BCC6A433BD645E56BD0BA0A33CF85CC43CE0052D3DF52785BC700A4A3D556319BDDA77513D53699D3DCCF332BD3F8388BDF16E113DCC1DC33BBC7BD5BC7C663C3C52D4F23C37E839BBEE9A0FBCB1433C3D6AE55E3DAECDC63C1557E63D3A6528BDB60E4FBBFDA1843D78EC2EBB5786B53C0D912FBB1DD70F3D646DD4BC349BE3BBA955883C9BCE00BE4C9D5C3C0328E13CE9C8DFBC7240BDBD571C523DE10CECBB246DD5BD5E1F173C4A0F26BB7E73AEBC4575AABB10B27F3DF49ED03C65049DBD21CD063D21F209BD98B3C13CB08358BCED41DF3C774CE13D261AEE3CC983033CD358663975D4F23D6796A83C776DBABC8726A9BC4303C4BB403A94BDD4107D3C1EBF13BD776F33BDC17F3E3DF7AE2DBD52D45E3CEDE89DBD03977F3D82CB373D067E2DBDFB3210BD53698BBDE9B5E13C22FB45BD92181C3DFF8A593E64D2823AB183963D35D3F2BCC7926FBD49921DBDDA0B1A3D7CA792BD7456B1BD446EA7BBF8B2B73BEDC60E3E0B91413D23D549BD2A3B903C2486B1BB8ED6683D621BE13BF392913CFFAEEB3D0825AA3DD70CA43DD6C73E3C41ABA3BD889DCFBC5C58D33D323CFABC425F3BBD8B97153DE75591BD2679A13DFBDF0CBD1D4BA0BC280589BD10998FBD29E7AB3DEA8AAB3B6A3FE8BCC4FE863DBD810B3DEFF102BD80611F3D5F12DD3D525082BD518C7E3D421EC83D2878B53CD0797C3D0EFA3BBD8DB47A3D63F8BFBCE39866BDCAEAA53D178C053C2C64483C7BD1943C0CB714BD662E7BBD2D1682BDFC68623DFD1A85BD1F5423BDE8E861BD0C0E833CDFCF083DBCDF573DC15CBEBCBFAC2DBCD2E2433DEE33F1BCBC0D203C917C173D9B05D13D5337E5BCE67867BD12D1E13B21ADF9BCA75F38BDD450F33C714E42BD0050BCBB5B30B63D8F4D25BDC41B203C0AFEC33B233F6BBD63A148BDC94688BDFD7496BDB3339D3D6891E33CB80B093DCD9C79BDF802D1BC56F6803CE20AEABC8514E43CA6354CBD77E29E3DC0AA333D8FE9823D939C08BD5A015F3D9F3A0FBC2F44F1BC71BC42BDACF3693D3B1AE1BBC599CE3D2960B63DF1A4373D38B8773D2FC7523C8E65B23D951C833D437FD5BCB1A0CB3D139361BCF2B3C4BC97F369BC0DEAA43D65D2A0BCD994243D96BA293DC6C881BC5FA4973D18BB44BDC39D1F3C1D6CC13DF6F6C6BC4256F9BCD5F3453D8189DABA604AB5BD29FCB2BB3CD292BDF959083DA472C9BDE5CE6F3DCC43AB3C2007533DACA9D0BB3AABAF3DA4B105BDA05B753DC87AA13DF2AEF53C3560A73D64F535BD561C963DC8CE1ABDFFBD0D3D1796703CB9197C3D5ECA133D35DF023BCE88AD3D7538E23CF04359BC76E8C73DE1F70DBD6676CABD00DA53BD9984CE3D6ADCEB3C29859CBD1996213D49FB193D89C7233DC1E4903DCA7665BC46928A3D600C253D819EBE3DF6C10ABC56A847BD5BD6103D80BDF2BC07A7BD3D5F9158BD1178AEBCAFDCEFBC1505C83C51D5D9BC6E7E293BE2B05ABC7BF685BDD4CEA73D0BEB2F3D8143053C03D633BC81B1F23D7391F1BC893116BDD4CFF73C7D93133D8EB228BDCF13A9BC9B6864BD428A99BD5729353D0B66653D037684BC1958883D8A2D5CBA8C8AC03D69F846BD01AEABBD3F3DA9BB5B8932BC2001593D62EED4BAF79F9ABD8647543D6AC03DBD868F193D3B049EBD3A6B803DE0371ABDE0B5E73D153A3C3D8E4E88BDF99F333D567B88BD3A4E07BB1B3A2E3D1129893D5CAA7A3C1E1F1D3A1C82043DA149943D5DCC833CFA0088BDCA7A2B3B4B89963C902FED3D5FD808BCE6BA79BD358EC3BC1B1F47BC84792ABD376B9ABC72D56BBC1703893DC53BFA3C5C4B8E3D9C406FBC6348E4BC18204ABDFED10ABDDAE6673DDCEF52BD3C7232BDD82670BCC0E116BD740E0D3DBF261F3E2DAB7ABC705CB2BC2FED1B3DB77ACDBDD93D0D3C0D5065BDC3CB293D6439143D2522843C7A58D7BA3160333D3AC7903D6F98973B8543F8BB459BD4BD2458573BC450023D2A4393BD22C78E3DDE7BB33D28BFC13D7EA861BC72BF273DE3BCF9386DF11F3C945C60BBEAF471BD4133D13D48FE69BD1C87B23BE8BFE23CB6ACDE3D425EB0BC066CC03CAB2D7E3DFAED753D3755FE3B96AA763DF8C9B13CEAF11EBD0B7181BDC90C82BCDF09C1BDD0B25E3D3CC070BC38BC1FBD080C9AB824D08FBDA2EF56BD2CBC8D3DDBCC94BD70746B3DA2F1C0BCC5911E3B99DFD6BB030BB03C6317693D3106D9BC17550C3D5C2CCD3B6F0F323DABA4AABC7343D8BA0F862A3DA3705ABD34B4133C37B6A3BD56E6503BF83816BD45DB93BC2EF3933D5A34C5BCCC21C13C33A9523DD6E2D2BBE87611BE7C12A33DB54793BDB0B0473DEC47AD3D547C963C2BBAD9BC92E3D63C96F5413D3FB093BDEDB9AC3D013090BC639297BDE72691BD49F6C1BCFDB0123D6E309BBDE3219D3D56D2173A933029BDF8F60C3DD17832BD0BEF0DBBEF37AEBC8CA4753D06EC25BD79B637BD8550933C7E7628BDAE0757BD78F5443DDEF0AF3D34549ABC475C2A3D007924BD439E913DAEB49BBAEE39253DF3A0CCBCDBC5973D5602B83C5FC232BAF0056A3D0A0C33BD34A6BABCF65E0B3D7381C0BCA7AA07BD7B357EBC5FA2D43D7440083C9154BD3D69ED6B3D60EA14BD061B0ABDBB1B57BB00569F3CFE058ABD324C963C99CA533CB0AD8B3C97A482BB995EA73DF10D1FBC71B888BC4E5B86396D28893D8258803D8C6A1B3D47299EBDBCFD343DD339153E7070873D90FFC13DA61612BC80E78C3DCF85A6BDD611DD3B3DB1B3BD0AA6503D03861C3DBAC9553DFE7D9A3D857E13BCFB2C0C3DAFA75F3D6870663D3364423D26B296BD8A4A493D3647803D73467DBDE44DCC3C37BA8BBDCA60FFBB7B143CBC268D31BD04E6313DB524573DEB1682BDF6EC7F3D4DF89E3D55847D3D78A5A43DDEC8A4BBA9A31B3D777BBC3C470F6DBDB19B3FBD49FA9E3DA0A5223C81E393BD999CAEBD61665BBD02C69CBC1DB111BDB766AD3D4B6753BC3570A23D1402CEBDD48E9E3CE2DD0BBDBDCD203D2E26673D57C8913D6383773D08A180BD8E1A313C2405953B765865BC1D3027BD18CABDBD64ED01BDABF14FBD067AB43BCDC34EBD6259983C9810473D7E9B61BD91DF72BDE8CF86BBC459A0BC4051593B629AA43C31FE88BDEEBE8ABDF30CFF3B45F0DA399D92CC3D2E7C77BD8A775D3D947DAB3C9D3951BAA5E74C3D988FBA3D64CE233C17512ABB354B813D777A79BBE747BC3D500D44BDE9AE0EBC911E85BCFF8EFF3C4CD0A43CA90C0B3C2C18FB3C3644CF3D49C6B53CAB70873D3C94133DB82DAC3D9D568F3BB337853D169502BDC72DFFBC26568B3D9438883D24FBBE3C936B0FBD936DB73C446A893C0CCF343DC5F62CBDE814823C2AC02E3A0868223D000C033D90F850BDEA27063CB4748C3D4B94623DDF18153D78531BBDD24896BDE8478BBD1A4F74BC26AC2D3D58EEAF3D9D049B3C5DC9F03D85A5B83DFF6450BD27DB9B3D87DD76BD8EC3903D22254BBB688CBEBB67C9833D4E0FF23CB8BA783DE947063E759CCC3DECD89B3B4C6B213D40C288BDEFBA313DFB7E183D2C2CEBBCA1A9903D523F82BBFEC234BCC98DD1BCEB19AABDA04AA1BC929F05BDE2B921BD7018AD3C4001B0BD2BF9EA3C02C93B3D76CC833D273D923DFC2AF03B5BC635BD49BF7CBDB8C293BDCA9C31BB9A0D873D4346B0BC261D5BBCD4E284BDB633823CAE06C7BC9C18D43D8679633DC2FB82BC9E4EC5BDE0A2023E20F4A13DBF9E59BDC53105BD0A0BB5BD11465CBCD64D203D8F9B823DAAADFCBD58CF9EBC9428E2BC93D5B3BC8F2C0BBD06CCD43C92CFA7BBCC6EC1BD54913EBD89FAE4BCF426A43D06C9DEBCEBFFAEBD227555BDCE3F713D0459F2BC8EDA9ABD6C7147BDFD27A0BDA705373CF766333DF4301E3D90D52EBD0703643B7F88F83C7340173D00F2EB3B6227F43D1F71233B329594BAC0F96FBD6DEC2C3D81A6733D1E430E3B6B0F9F3D1E142EBD20639CBD778E9F3CE8B0D9BDFA1E02BD2E963A3D0DE98EBD8E228E3D61AA523D8EE6BBBD52253D3D7ABC70BCBCC3C33C9FDD4C3D62F8E63A46839BBA5DACBA3C805FBC3D3B37443D293DFA3B67548E3D3D3E1FBD729671BC70C2E2BDB532A23D82B99EBDF4A7C83CBBDA8FBD7CF7243D7E0E95BB1FBC6BBD2F27183D771345BCAB7C893D1F12703B569A9E3D9F1BB83C7C8FFE3D2AEFAC3D64695CBDCCDADB3D43B0E03B725E033DB26B25BD65E2213D4104013DF51792BD94F5913DE7DACCBAD85EA53D6B8010BD8C654BBD76FA9EBB21E0863D5A5EB33CDF1D813DC8D12ABA88C3E33CA32B78BD41BCCFBA33A37E3DCB0585BCD24E7D3D6826D0BC6DA573BDE418D0BB2BF7A3BD497D96BDCE8596BD2C0D3F3DF8D3A63D1EAB84BDC770BBBD12CC8FBDB01B4C3DA9518ABCC779133D28AA8F3CA67DB2BBE43F93BD60E82BBDC97A7ABC107AB93D743BE9BB5535ABBD15038DBC69C650BD5D14A5BC9EAEB63BA5208F3CFAE8593D854C8E3D66F7493DD0D77CBD887FE2BB252A30BD235F0B3D7738183DDBF6A0BD79A304BE9AFE543C8A1ADC3C87B0A73D90C8E2BC3A59BE3CE0645A3B0C8632BD9A30BC3C9FA8D23DCF7825BDA48D3DBC5AF84ABDCC0A93BD1009D83C49C4D4BC76500A3DC237FFBC442E1FBD99FF62BB6C7A3BBC3132313D3B4B91BD1EE383BD9D61783DCE02683CAE6967BDDB50AD3D4D2566BD7B87DCBA9F1110BCA0CCE8BC3C0696BDD776AF3D078F55BD5F3D22BDB12CBCBCFAE3B13DD7355EBDEA6B53BD23B365BD4AAD44BD01458D3C2A6B54BD08EC83BD66C8383D991AF93BD3B3E5BC4C63B13CDED3563D5A05E8BCD8C2813CDD67A2BD3D6E6BBC3FB7E83948DC353D7396523D2E8150BCEAF886BDE884453CF5FA4CBC6CC8A93D36409C3C979634BDD58367BD5055A6BCA59F053EB63E77BC6A8642BD05C7D4BCEF34753D62828DBD69ECC43CBF2099BD818BBABCB1E127BDA16FC13D0F690C3E5EB1F23DAA9EA63D89FFD43CEEBC3B3DD9AD8B3DB26B85BDBDC773BD942AE8BCE91798BC05BF853C31380F3DD30F04BD858A14BCAB4C473DB389933D90FD243CC9E285BD69B8D2BD12F964BC481336BC1CD7013D273AE0BCF02A013C7BF904BE650033BDF6785C3CB48E023DA66E21BDF2CC8EBC9C8DEEBCCE9949BD722098BB3F5B403C9415CF3DC97F8B3C6AA979BDEF4BB73D6F4DA23DD1A97A3DB5B2BABD63ABB1BD8900D43D950621BD3F66803BB1B7803C3252B3BD6D71263D9FEE31BD7E25BBBD9F8E4E3DF1DEFE3C24B8DCBD381EC13CCB7C7CBC90F1523DADC6713DD6198B3DE4686BBD362D9F3DA05E0FBB9EEC79BB22E9123D7F98973D725D56BD60E7D83D6CD0A9BD8E40083D90C495BDE1AF2EBD1032393D2AE5733DC584073D014ADCBBFEB19FBD3922F5BB349DB2BB705A9ABD537701BC04EC963DCF23793DB449983A97F95C3D3FF9433DDEE5CF3CBD83C5BB14576B3D02BA0DBC2818933D322A85BDFFB0AD3D4D88283DFDD153BD525876BDCC2D143C2A2349BD59961C3C8AA12E3DE03F08BD075C433C38865F3DB05BC13C955B69BDFE15B7BD72C0893D1C3C133DEF17BE3D6CC1B13C258CC6BC1A36DCBD1EB86E3D460FAE3C864CB13DAC9377BDCF363D3C24EB573D821414BDFBE3093EEBF81CBD5E1C843D90369E3D6307FF3CCAEEE33CF10F7FBD1398AABC47729A3DD0310F3C24DCB33DC746D03C960F14BD804D05BDFE30A1BCE7141C3CD72B063DCA125F3DF97B783DC8CD29BDF3CA1FBD7F24B43C8A5A643DFE5B373DDB35893BA8EE3DBAC544473D2243603C67C6073C49ACC4BDD22D2A3D0BEF8D3D121D343D4C0C0DBDAFDA00BC8753CBBC69EB463D9C053B3CBACF0DBCBCBE84BD3C05C23C12B92E3CF789D8BD7503B33C2CADBB3B17CA56BD59AE86BDF8C906BCD98231BCA5496D3CD4399E3DC5F4E8BC0404BBBCE923E9BB95C18F3DD0989C3C349C443DD1E5D93C520221BB10ACE03B057F90BD5A6A943CFF441C3CCCF7CDBC4172383CEA84213D6CF20CBCC798CBBCD09B183B9F1FC4BC28A79F3D9121AA3DAEF8B03C4CF1ABBC2A6CE43C6D259EBD21258E3D2EA44B3D082408BB03ED9BBD2014FBBC3F46AF3CFD139CBC47A3ED3C6E2C24BD7D966ABDBD7E4A3DEEBE973AFB7233BD7D0F42BDCD2E9CBDA333F03BC478093BADC02E3D5AD842BDD40C7B3DE684563D73CC933C8673CF3C3C1BB4BCC3169E3D4455ECBB40640EBD7FCE843DAB39C1BCF24F95BD379577BCF7C0CF3DA3CB89BDDD5A20BCCB4208BC10075CBB01A4A2BB53158D3C97CABEBD7B308C3D882C89BD37CF4CBD14B1FDBCA535833D9D83CEBD8CB3143D3A3F923D20005E3D924C7B3D3F8C59BD37F2583C099B39BDC83A9B3A11431E3D6A2AEB3CBB1C3A3BF65DAE3D09E5093C90E8D2BC79120DBD6297BEBCA9238BBD58EDF33C8EA4DC3D1A0D6A3D57D6B23DA84F263D353C92BDC31D9EBDD4DA81BDDEAFC23C3CF6C73C3B7392BDE9D827BB907BC1BA9323D4BBA6111A3D691A863DA2BCE2BC0B89D63C42F8633D6077C03BF3A1DBBDAD7044BD19F89B3DADEF19BDBEC19FBDEFA69C3BC43086BD9743743D6F5F213D4C37A3BB057BCDBCE4D53ABD9588D63C6F21A3BD709A66BD5B53A93BAEC70C3D9B278A3BA2F3C9BC31DCA13D12A9B93CC1F16ABD56BBB7BA124732BC6D55803D4F3E423DD4CFD3BC90F9F8B835ED3E3C7AD502BCCE49DEBC208E6BBB1D9146BD9FEAD1BD9A9693BD28A41ABDD29767BD361F2BBD8932D7BC111B4EBD775D94BD7C2F1ABD9CD2C6BC5764F9BC5B9111BD5A1888BD411267BD6BB586BD1264403D2D991BBDA5E9CCBDB47795BCE3C008BDA94E87BD66AC97BDD6D775BD7B988B3D918E0E3D0C32B6BD6BE5163D8342023D45230D3D7BEE33BD235131BD8ECE6FBD785FB4BD466DA3BC563B2A3D2E255DBD16DCCD3DC1EF143B72D79F3DA7905CBDEEA183BC5BC34EBD87D92FBC2B7FA1BC722604BCE64538BD6EA45D3D040825BC685E953D018619BDB193B5BB548694BD789B1ABD973E9A3C4A4EBE3C9EEFA8BD6DB64D3DC2B0D8BDCAAB53BDD57FD8BCDB9D3FBDBD973E3D6C2928BD5C78903CB532013D41E7DB3CDECF76BDD69D13BDB4F3DCBCEFE1873D2C2E043DE924ACBB49088ABD1CD7DB3C5A63173CDCA8B93A3CD0CABC941DC03C331F993C627D0C3D9B89533CE6403A3DE6843DBCBC5AACBB11C91CBDD21BAF3C95542D3D3C66523DC6DBA6BDFB97843CA0932C3D53250FBD1D5F05BDCE6953BC474FFF3C4865E4BC7929B33DB71687BD439DD6BCA82F1E3D37B6473D7E8F29BDEA128D3DA45581BD9A2BA7BCA1ED12BCF8EA9FBCE82CBCBC9EBBE7BC941CDB3CB50D9F3D87331B3D38D983BD6B4502BC90C8D23B7B677F3D88E2263B875649BDC49CA93DC8B19A3D0AFC99BD21A01ABC74EF3ABCEE72C6BC677009BD66248E3D11B239BDD964523DAA233BBD69247FBD32ADCC3C4FD0833DB053F5BC0836B23C61CD993AACF55EBDDF603B3DED08163D2D4D05BDF2DEDFBCC73D4ABDF567863D26E0FDBCBE359B3D8FF90D3C70FDE1B76228823CCC6CBA3DF5DE82BDB3DED2BCDED63EBDFA4727BDBF727ABDCBCBE7BC3A5199BB1AF533BD671230BD4BC175BCF60A9E3D6677A43B4AAB763CED284E3DFC6F923D3C2C3DBD9E3DCF3D69DF4F3DDC71253D30C2953C7B0CC8BBCB15183DF6D9653CBF87343D59B001BDF2665CBDC3E5913C3AB254BD17F9B23CF928123CA569063DEBBF9C3C40A4A23D112F9EBDECF5A6BBE3226CBDD8E029BDA10B88BD33B4E7BC85738CBBC2CD23BB7C5D443C687791BD394F673D3A8512BD2A7DD13BD635D4BC9EC1033DBDCC673B76888FBC2632E8BCA5160B3D4FE73C3D4B5536BCFA1791BC7C9F2D3D851A74BC457368BD35A1693C3AB9D33CA66A413D15D687BDC1872D3C85BD95BB416FC53C5735DFBC5D308EBDC2E588BC127996BD801A643D4F28A6BCD7CA623D9ECA41BC7FA2163D3D61403DC709A7BDBA01B0B97A1EECBAA33FDABCF5B6A63CE34F363D4C923C3D9C2A2DBB84A18EBD84C9553DD87E943C8AF080BD82067D3C248B923D9C60B63D5CD9EA3A3FFD923DC404CABCC70B233DF562FBBC6B6EAF3C8B9C8A3D03C9983DBCF0823C807B33BD2A9694BC6EF182BD74621DBD8E7F2D3DDE556EBCE932213BEC7BB33BA27A52BD0B7A8D3C57E882BDACF73ABD570111BD03E5723DF68CCF3D3C7EC73BC78B82BCF93C0FBCED08BF3C22BFE2BC8BB8C93A4F953D3D59D69ABD532FA43C9EAF60BD6B6F413DFA0D5C381FFD8F3D861F6DBDE787CA3A29FE94BD75FFA53CB386823D2C2D123DBB415C3DE1AFCDBC32F889BC6C9583BD11C8EF3CF9F906BD380A453D592A10BD395ECDBC14BE85BD0D6B3FBC00DEAA3B5309633D43A920BDC04783BCA2A3863D33DA8D3DD6ADB73C660B0A3D55D6343DAAAA973D15BB313B5B3C55BD77262C3D7BF0DF3B8F30753D62E4AEBD17B7683B67387FBDD2FD7D3DF7F903BB0D86933DAC80A9BDBE2328BD8D14043DB43F0CBC7C123A3AB47DA8BDD1BF823D082DAEBCFECE39BD70266CBD38F686BDDEAF863DF863EFBB5BFC293D1A2D67BC61D3A73DE48B883D6C026CBDEF6C893D7B2F313CE50F7C3D78F87BBD58D0313D3BAA6CBD3D9A99BC18ACE33CC37590BDA637163DF5F7D93C5324963DEF2636BDB4DA963D7F5E8A3C331C573DDCDE22BD01F38E3D86A2BA3C76E13A3DB74FDBBC8E2C713D15DEA03D6632413DA98F063DBDD23BBDB3EA273DC54D13BC2596043BA3E0403CCE16FF3CFD55963C622C41BD75AC823B01BE833D66CBC53CA70900BD602015BD1C76223DE7258CBD45D4903D17516C3D67BE44BDA092C73C1E291B3D1EFB3C3D3B25773C603C9B3CDD3304BD5077803DBBF4ADBD59BFBD3CDCEDF03C0FC39C3CD77AF0BB79C848BDB100663DF43BE63CCC4E293B6E12113DEE6B8F3D67DB9EBDCB9232BD39BB30BD017E9BBB97E8743DF1932EBDCD518E3DCAA87D3D71A19DBC9BDB373DAB79AB3B3A4697BD937312BDF5B3CC3C855FB7BB8E5E81BDEF874F3D38A788BDFF39823D0468A5BDC734EA3CED07803C4749903DB075833D3D368DBDC2F3423D1CE61A3D2D10A23DF9F386BDA23D3F3C8BCB06BD7A5471BD56A547BDC2C9F73B08DC99BDD04C8F3B092E82BD4A6C653DEC7881BD9A7D04BBE11B08BCAE447F3C16F6333D79CF1B3D4E6A623D46F058BD704098BD4176E7BCC9C1A73D139E7DBD501C4B3DC24195BDE8AF0D3D4BE68E3DE40C00BD607D7CBC5AB438BDEE7420BDA931843DB65E78BD104390BCA0BC06BC0B0848BD9CEAB53CE2676D3DD68D85BDCC39703D7092C6BC00E76C3DAE95F5BC8B59D13C09ED67BD51DFD8BC7E416E3D6D199D3C104258BD6A2510BDC9562EBD891F66BD2CC11B3C97B48EBD5BCB333D8E6081BD3029E8BC481370BDF6321BBD8CF2BFBCBCB0AABC1FAA85BDD1CC733DF723953DF11A8BBCE5B1D63B01ED55BD028E9FBC02B82A3DB3EB27BDA8F89DBD6F8690BD204186BD3AADBDBCC24DD4BBB83A663DD500D7BCF526773DC9BF473D05398DBDE8854DBD129180BD62B013BD96A9A43DB65114BDCCE887BDE6AB7EBD0FC5583BCAA78F3DB1B2893C9F9C84BDEA358D3D6C4609BDE8C46E3CA9B2163DDFB3883D0C6F29BD7F0F503D078D643D35A4963CD62BD53C2FC5D4BCE570473C59CAB53C81EE123DFD95A23A43BE4C3D815E823CD9277FBD8BE27FBDD0E151BD4E428B3D251C9ABD846040BDF6CA953D4F1727BDCFDE6CBD197CC0BC89EDB93B63D728BD50385D3C106D6B3DCC5DBC3C6EDB49BCE5B8703DFB09013D0EBB6CBDDE825C3DD7D7C23C96D298BD9BBF6B3D2E94A1BC4AC75F3CE94CAABBB51BEC3CC229A8BC24218E3D1CC3043DF49E383C94EE44BD0F3C9F3DB7BA283C37FF213D9736363D3FE3B3BC06101FBD63CD95BC501D5E3DC4CF3E3CC7D460BD9153A33D4FB857BD0EA9293D5C867A3D0FA1083D6387673DD33FB93C7428853D1B8B61BD88C4A53C0DFF873DC8F666BCE87A853D5B454FBD9FF872BD9190553DE0B4E33CEF760FBDFABB1CBD9352403D6D94913DC582B4BC7862FF3C845BCD3CB23BF53CAEEA323D0D6D8FBD3E368E3C2CF899BD46F5BB3C5CF2FC3C57B00ABDFD4395BD4CF863BDF473693DA4FECCBCF7F30BBCCCFC2D3CDE38673DB3DE8BBDB88D9F3D7199CE3BBB215D3C2B6004BDC11099BD0F57C33C67FF8B3D930C48BDAAF592BDF99512BD0F2F9E3DB486873DE1423DBDEB1866BC3291313C2B2199BD773E8E3D2B9A8EBDC396773BE4F399BDD9BBA0BDA0BE9BBD35BA613D8DCCA13D349183BD76E64A3D2E15A53D4168863D600EA8BC4CF01D3D5A680B3C99329F3D5C6E1D3D822D2F3D4DCC0FBDDA3E9FBD4BC0963D30A375BD909D933CF6FD16BD22FB4ABDCD74F4BCDE4089BD79E98F3C9678C73C1EF12DBDEFC77CBDE426903D12A49F3DDD8A54BA7AAF46BD4C7188BA871EE7BCAD5C943DEF10213DE37EC13CD5419A3D3651CCBC47958CBD639F4D3C5AE22DBD6FE6E23A4316A63DA5592ABC1F276ABDE2F3DABC1FF59F3D22AA623D34EDDB3C09461F3DFE9A223D20EDD7BBB085D73C936C9E3D10CBBA3C561441BD14B3983CA3CE66BDD4FB80BDE8A41B3CA49CB33CEAC126BD497E1B3DB94BA9BCB5FBC23C97E744BD2150933DC033753D70C02BBD7E2211BD7FD424BD68A978BD1CD3D9BC0623863DA8265C3DFA44963D584157BDAB3AAD3C5530303D073686BCFCA599BD86A429BD17CB413CC1B511BDD99084BC227B74BD83F6C73BA88E5BBCA54087BDEA0CE33C17399B3CE9CFD13C0073943B3CF82EBD0E1B213DC850D63C678188BD3BFA3ABCB64194BD4A255C3DEF8FA03DBE68573D97C38F3D89DC913DF51D42BD8F78A43C7D37B1BCD65D4F3DFFB9A7BCD4E77BBB8EE337BD36377D3DD8BF7E3C55BAA03D50ADA3BBE1171639D215033DA410A23D4AEBA9BC1E40563DEABC14BDF339A43D3077A23DBB2B883DD504193D01A3873D601418BD5AA5663D3D61FA3C94B8493D99B8EA3CE4E6853DF841FD3B934492BD80E1BA3B2F804E3D9E0253BDD018BEBB955EA5BDE089F23B57BBA53D91AF593BF8302BBDC1A79C3CEA00243D17AF373D78C7213D5917963B1E1092BD288E023D7F629F3D77FB973DBE17953D8EAA6B3C1800E83CE3559F3DF927993A1012F93C5D3386BCC03521BC9E6AC33B489814BC6B1C1B3DE38C44BD6B5D2CBD4F8F823D94A364BDE0109C3C0F6B333D1A8456BD484AE33CC9004E3C69A2613C29BB983D2600873D91A11ABDF6ED74BD4ADD5DBDF00A243D45AA843D8E3088BDB30B2C3D85C49ABD0E4B883D8354C6BC62E06C3D79CEBCBC1A39F6BC204A0B3C592C41BDBA3B9BBDCDBF913CE86DAD3A7888253D5A8BAA3C51D06C3D7A3B1FBDCDE0133D0A27783C3E46003D0F062B3CF1928FBCB0E3423C406F063B39E38EBDB276783D5B391FBD6EB75DBDFAA99A3DF11D023D0B5233BDE464E8BCABC80EBC4FD891BD625BA5BCE7335D3D823F603D351E7ABCC7CD66BCACDA3C3D5439473A4C9365BD104405BC891F97BDE8E3C33CF89A61BDCFBA8B3D7F321FBD02E9A03DAE3D713CD886383CD7C7843BD2F2343DF0FA90BCF37B07BD2B0F2B3D34BA8CBB33688BBD475C6B3A58D66ABDF646533D70F7313D22843A3DCD561EBDC53F9D3D6E59B2BCF13731BD08D22E3D36B0D6BCD9D6AB3C1113543C4D9E5ABC0253A1BDCE1D2E3D6087D93C4AC7D73C32DA8EBCCE6983BC2700133D49228DBD5DDDA13D757808BC5E65633DE055403D435B793D577C43BDE895563D8ED8903BE665C83CF0DFC6BC3B623FBDFED740B9A246823AA8B6323DDAFB7C3D54AF853D887F92BDDEB41B3DA5D095BD1BB34A39E4F1EFBBB3245FBD6F8F4D3D5DAB49BCB06E7AB985568D3C8041783D9277953D522A72BC17F9A7BC86348E3DF09BD53CF6112BBD10EF193DFDDA63BD52F219BCEC2767BD6853A03DBCF695BD29B774BDD827D3BCE336833D2A7711BD2AC616BDDCDE9B3DE4AB06BDCE19E83C8D726C3D94F65D3D2F81633DEDB494BCEB3E893DAD28893DA77208BDC6092FBDD5DC41BD9281C7BCC398A43D052F2E3DD228973D2D6B443D1B013FBDAF4C54BDEE803A3D0C89683DFFF4F7BC287354BD876F1A3C8E4A73BB13078CBD1BB0FBBB970B9CBD35E7A1BDEAE4C8BC2091123D43B82ABDE68C9B3D41CE243DD534F3BC88BE8BBB3AF0053D11B152BDCC6F61BD16FC863DC773D23C1931A7BC7BAAD9BC81099E3D95485F3D51098D3D00DBD6BC98C88A3DB17D783DDAFB85BD261F02BD4ECF513DF45C5E3DF732893DA3DE2ABDCA025BBC0E4E5D3BF680A2BBDE621CBD28332A3D62B0AF3CF2B7AD3C60C8653D0671763D2E9E3EBCCD15C23B1DAD933D2EE39EBDE31D943CDAAD44BD737030B9DD9BF1BCC24775BD277529BDA8DBD03CF7862C3D6DD1783D5F028BBD65D234BCCB4B71BD035EA23D6EA3ECBC06021DBC570157BD72FF8FBC3697413D063E95BD34111F3DEA1472BB19DD18BD473E96BDF1861B3CD50E49BD2953ED3C0EA56F3A2B71333D4350483D75BA59BDB96132BD7755853D3D944D3D3CE090BDA26908BB2D6207BD40ACC83C3D5D56BD4AFE25BDCB4FE03CA42CDDBC44504F3D5247C0BB2B741FBC86D87BBDC3EF57BDACF85D3BBBCE1EBD31B084BD9DEEA03D587CB03C25561DBD661FB6BB948278BCE79EB53C4F2CB4BB550F783DAE54E9BCDEBAA4BDCE7C9FBC98E378BDB2B2923D2C069A3D758A4BBD37912BBDCAF03EBDE226763D77F8B43CF2CA8B3D0DB6E8BC8669F03BBD68333D22F3A23CFDC4A2BDDF54083D69AC98BDB9BCFCBC12BD44BC2CCA31BD1196BCBC469795BDB1BA3C3DFD65F6BBBA07643DF6687BBD80C4103D421791BBC3D82B3D58D47ABDD2EA993B7E6588BD6360993D80E4C83C0897033D4922CBBC622B133C36FA9D3D261C84BD09AB433D2375F4BC7921823DFF236FBD4932EF3C94BD42BC245B663D38235ABDFD650B3D1B8888BD087E103C11FB9B3D66BD8E3D2399A2BDB96E93BAF48A023CF2CB8F3A2F16D8BCCC3F133D77A484BD5D05073D437B11BD5947C2BC6892893D0B724C3DC79E943DA128AFBB614D75BC9BBC4A3DFAF137BD304C2F3C1B5D1C3C3E7D94BD96CA273C192817BDB6F5983DFBED353DC78A9F3DC7E1A43DB751553D863E8E3DD4E89ABDA2F8EC3C080C513DCBF3573C42C516BD3E9F90BDA64A553D9F65913DBECC8BBD1E006E3D3F462C3DB8F5CD3CF34D54BD5BF05E3DDDF485BD250A0C3C7D5915BD7EF0263D8192473D4AACB3BC451292BD5DEE4E3D456015BD7E2B0DBDBAD1A53D549E7C3DCFFF83BDB7AE6DBDCC2F9F3D39699DBC6E05C1BC9C172D3DD74A3A3D52B6DABCA223303CD62A3ABDE77C2CBDD7921CBDC35E8DBDE7DA393C1B98CA3C518B0CBD3348513DCFFE01BDD2F704BD2FC312BC00F659BCBBBCA2BBBD4E2E3BBFBE633D6EF48E3DCB0A9E3D5ACBE7BC96269ABD39F8543B912B9ABD2E1FA33A8197863D6D0080BDA1F4AB3C3364C2BC9BAF88BD19258DBD2C076B3CF5219D3D4067553CD84F0D3D74D487BDB1145C3D5987953D22380D3DD8FC073DDA7794BD7DF579BD09B0673C5A1EA8BDC5C235BDA6ADC43C291B6EBD72CB4BBA1CEEA63BC383923D535A5F3D6ADB80BD5DEC13BD86E29EBDB6BE7EBC06B3D53C9A14A43CE313113D798628BD330891BD6D7893BD6AE37FBD53586B3D2BF973BB26A62FBDDC916CBD9911A2BD62AE403D00BB62BD398F81BDAFFB793C885B0C3C993054BB62EF683D98099AB91D42A23C53A591BD2B7596BC3DD5023D1D4B933CD4D7B83C60AAD6BBD838823BF10C2EBB3BE1343CD1AE5CBDEFB142BCAAF41A3DCF581FBC1F865E3D128F84BDF0EE7D3D1DDA013D3FCD60BDDF497E3DBABA83BCE2E0E2BC9BBF163B05FC473C396020BD9AE2A2BD5086E63C0F1B38BBFD625ABD641969BD4AE9893D518C503CC1CCA2BD3D7D803C1E12553D0296513C69E0CA3C0C1C05BD0953953C0EE822BB9820E1BC7EEF82BD156C86BD5E17843DE20718BD6F745DBC0D258EBB0BEA29BA9CD00FBDCB6846BDB0E2ABBCCA528ABD9E709C3CC20BB03D954F90BD502A09BD34B3983CF5813E3D98DA87BD156F02BDA9E84DBA4805B73C96B00BBD5CE72B3D32BB47BD2623A9BA0140993D4EDC80BD77443C3D641387BCEEF91B3DB7FAE73C55A2773CA94893BD56B809BDDED88E3D080D753DFCB7543CC65052BBFC00D7BA163EE8BC7F519ABD3551313DB4457DBD8A5791BD5612A53C1FC14DBB7875A23D3FB5EABC143EC63C148D2EBD4078AE3D6A2EC83DFF50843C85998ABD806FA13D962F9EBD7DE58F3B253B3FBDB06696BDE480353D6D348C3C0054E4BC1B0971BDCCDA9D3C62F2FF3BC299A03DF3E5A33DEA1B983D397AEB3C3BEFA63B652470BDFE7DD4BB54394F3D446911BC0A7589BD5527133D4589D5BC4ABEF33CE54EA43C876D85BD64E494BD6319483DE0D956BBF919D4BB72385F3CFB1864BC0F2A39BC116298BC77565C3D8BA35F3CFF8BA4BD8AFC92BD9174733D11064CBDF71D4E3D97B3DABC211F62BC03E01B3B3EDE2D3D1D8BA1BCA6709C3BAAF77F3DA3F72CBDCF66723D26EAD23B90629B3DFDF08EBD2EC9AF3C66D1463D5F4974BC5CDB543C6F4516BD4E3CDA3B08AB4FBD509612BC24302CBD683C4DBD29E4AF3CB677303C3892343D863D403D1F608ABD3A5AA13DCCBC373C77B2943D253B2E3BB2B1663C2D1282BDDCAAFBBC33297D3BC82B373DC79DF2BC052B15BD988E5D3B5D3649BD7EB8C43B1C92763DFB6CCDBC640964BDB29C823CAD898F3C8E31D23CA0593CBD3FA81F3D43FA0EBD60554EBDA7491C3CC59677BDE9C87D3DDF8E0D3DE53F4BBDD4F04C3D60E3763D18D74FBD24DAE4BCBBD005BB62939CBB4C3ED0BC31E168BDC3B85CBD4183D83C8D9D8DBD2F9008BDCB9FB6BB5E88E73A7B0805BD845DBDBD0A2DC73CECE59F3C0254AC3C3CA281BDFFFDBD3CDBA345BD16E2DEBC9E812B3CFA3D1D3DC681133D9E3DE83BEF69083BD69C09BD3E95A33BA85A0E3DDC00AB3DE0AB473D38A7ADBCB5A8163DAE7AE4BC89EC86BDDF2F833D25C399BD86FDAC3D22A7993D26B8123C0D7119BD52A5393D0F4A493C5D71BCBC701BBDBBD286423D92C2793DBDE2E9BC3DE8EB3C3AE6FD3B525F24BBC320B9BC85B890BDA8733C3D26E075BCB304813DE84BACBCE8C9753CF6A2593BE4BE69BDC64C013DB2AD09BDF9474E3DC03385BD0F45D9BDB391A53DD80BA8BD94EAA03CD8A574BDE818753C673930BBA740FABC83BFA3BD6DAFCE3BA57A373DF09DB33CEDC88CBDB16C4F3D40E4833D383FD8BCD747A53D1612443D63A06B3A8CF8C13B76B1E0BB5B0D41BD8C5636BDCB3BB03C4C9A0D3D20D177BC9085483DF29D8E3D66FB85BD74CA87BD558939BD4B2539BDA7151DBC25E0C83CEE132DBD41959E3D2EB3E63B4A6861BC308F53BD109385BDCFC715BD435295BD3D151CBB8679293C668FD23C163695BB8EBE48BD105B12BD1170B83C4CF990BC3C62A13D10CBEFBC94E084BD5D44913DEED4583CC95062BDD1062E3DC570983D456F99BDF63D6CBD5043633CDE7397BDCE18F43C0E618ABCBC9B073DC538003DC57721BDE71609BCA6DF153D362102BDEA5F3E3C02F0AF3DACEE293D0A5350BD714BBD39AA24BC3D9203BD3C5E2189BD5AB0CB3C0AF9BDBD6933D23B41537FBDD671333D9EC58ABDE0AFDFBC62CF133C7182CEBC5392D7BBAD59503D64A45A3CA83A883D48A5733DA52A5A3CB8360A3DB694C6BC3B6D0CBD842CBF3DCF221CBCD595B13C315D513D3D8B55BD63D2A3BCFBA7C53CF7EE5CBD7700A7BD5C929ABD2917093DF201233D969193BC646444BD7C6CD63BCAFFB5BCB3756EBD7263933B26C1533DEC3F85BA9C4952BCB600803D7D5DF8BD5F791EBDD9A2923D0D3591BD80CE88BD73F2763C81839FBD527D093DDF58083D8F2CA13CE2A13FBD928CC13B56F3B33C0D4C1CBDA68C8ABD2E198E3D7D2D903D9EED81BB091300BDAA0AEB3CB760613DDACA06BD1C9A553DD2E1F4BC397D833D748925BDC095EABCBD5F8FBDDEF61D3D499362BD311C65BD39F70BBD8946033DA8528EBD57AE4F3D4C56223D2301533D527835BD7F0E323C2EEBF0BCB746AF3C44F3203D46F03D3D77AD7DBC2BC1AA3DDAC0503D1E1B81BDDBE0533DF7B08A3D6F110FBD15EF473DAF19183DC4B414BCC07276BD08C3883D7E1B043D7FCDC2BBAAAD7D3DC8FC26BD41C9DD3C8CF2BD3DCFF2AE3CC7390F3D124CAF3DAC57663AD1528EBDF0A3AABC10F3023D6E0953BDF0F55C3DEBD0A3BC69607EBCEE77B43D7FDBB6BD172E40BD817839BDB1046BBC0AE2B63D69083F3DD07B97BDC51079BDA82AC03DBD0A0ABDF921FDBCBA4C7FBD9AB90D3D21A2633CDAF579BD756ED83C244D893DB3DD243C66FB0EBC4C0675BBD028183D22B1F73C48460E3CB271CF3C82EC92BD6F1082BDFB3A2FBC6D728ABCA755993C474D993D5042903D2CA6953DD76B2ABCDEA9C73D7C22163CEDE2F5BC1D0CC43B8C3AA43D3F8F4E3C093D543C36ACB33B088502BD0AC4B0BC642D583D0087B63DC469B63DA8F632BD5A447A3DDDE623BD1632063D7CEC2EBDD1AECC3B4960EA3C5B9207BD1DB4033C626FD2BD6F0F923D0611B8BCE7BD3DBD351EE9BCC88AB13DC8B0573DC4D483BC70131E3DB1129BBDF461F0BD24FEA53DCD80BC3B25BE32BC27218F3DEBBC893D7182A3BD5D22903DC42188BB2AC0903C116E6EBCFDE6A1BDAC2F9FBC890680BDD2B76F3D5D231B3D9AE8BDBDC21A933D836E343DE2625ABD2B8F4C3CBF80973D5F05183DAC4E193DF2AB483D41DFC7BD878D993D2587BDBC4FA61E3D86B3BBBD4EBAE5BCA8A1A33CB6E8943D2FA0683DFA46083D0179CDBCC360883DC1C1913D9322AB3C70BD26BD62CD933CCFFDE63A3503AB3C9312D3BA4B45EDBCE5A2443D641033BCECF7A63DA5018BBDC1176DBD1286F0BC6C238D3D54A35C3DFBCF713DD3E6E5BC35D86CBB2C44C13D0BEE6DBD58CA9D3DBC7493BC1949153D7C71663C7F0156BD3299BCBD8C930E3DAC16A03DA2FED5BCB1584BBDAC8D80BD383C643DC879673C13F6663D44FF843DD706493DA016733C1575AD3DD345243DFB38343D11741D3DD528C63CAEBA2EBDB22FE03C779AAD3D04E9223D1C6B4EBD712D8DBDF9ACF93CAA0960BD7515113C5E231EBD1163E73D510018BC32E5443DF51A15BA09EEA5BD85634D3D1E00843D8E0769BC2EC048BDA014ED3C3818A03CDEB19B3D021129BC14FB833D4D5266BD6C7C3D3D7615A5BC7157AE3D51D04B3D4AB94ABDC5DE983D12F2653C88052BBD7F7D10BBC18023BDB5ED3E3B23A3F3BCFC9014BBE372E0BD23A855BD3821E5BCB25F793C986216BDFE4CB03D825B923B1A3D86BD5C25E6BC12828E3DF245A4BDCC12473D7AF11E3D58D2B93CF6F5323D9EA375BC39A2C53C553E903DE17F0EBD19DDEB3CD082C03DED17BCBDAC1D9B3DA06738BDCCE99B3B7D990ABD53F733BD264F3FBD096A703DD090D83A611A2F3D6DDD93BD947272BD9A390FBD859B37BDCBC9AF3C95430ABC53521E3D9C70CE3DD7F4B9BC1E2A60BD6F549C3DC8124C3B498CB4BD0185C73C3B6C15BDD31425BD1A60F4BC2D35863D9540CB3C39970ABDB53DFC3C9509723D7C9F043D24516A3C4D0969BD92D73F3DA0BA363C1988AF3BF7041CBCCA0F2ABD866CB03D5439FFBC593722BDCDEE963D49B7013D7F6B243D32618F3C86F04E3C31DA5D3D3FFEB439535D6B3CB3E5533CA5C390BD67F5593CB0B0A4BDD245F7BCA757A83D376A16BD429A87BDBE23813CD390883C2F68BB3B611A2B3C7F95C9BC90F6453D01825ABCA804873DF39DCA3D601DAFBDBD9FA4BD8422FCBCB062853DD2AB7E3D8852F5BC8A809EBD59B3323DEFA4413D42CCE5BD677097BC7896783DC9BF193DB349E03DAA34F93C836B783A5F37083E3FBD6F3D62B754BD271E223D6C21DABCB809443DAD61B73D392BCC3C82A5883DB1A9663CF519043D25AF733DD9D1B5BC173A1D3D6EBC753AA2F8B43C3164173DC0D8FB3C0F3615BD2970ABBD830B1ABDFCA5883D30C4573B2FE309BDA403CA3D0AA67B39689FB4BD9D01D23B3F548F3DCF3E903DE4C0773DBF5813BB1F2AA6BD3C98513CBDA2553D639DBDBB6EDA6F3DC0E097BC5AC2613DED6790BCDABC403D974C36BBE9A792BC410E77BD758F35BD39FE213D187E74BD02E6A33D726F793DE624893D573012BDBCBFAB3D6EDA343BCD7F2A3C534B8CBD1279CB3D6B97FE3C2EDB543D076EA1BD7512793DF228323C9353B83D14FE02BD9DB1923C326A963D08CB83BDA31BB7BCAB1B573DBE7C67BD8B5134BCA7E7783D603C8C3C2BCC9FBC0F353EBCEDB7DEB94219C0BC91B3D6BCBD93B2BCAD953B3CC96051BDD747863D5DB0C13C6094CB3B5FD9E0BC04213A3DD5668B3D99DD903A59C8C2BC84FF0EBDEBC9953DB88592BD8BC7C33C0C0731BD6E88C23C9986373D34F4383DBE0E77BD60D1C53C45DCDABC85B6673C2A7E133DABF42F3D33CF49BD44B37F3D06BF0CBD8D0F623CEDC23BBD880D19BC174D883DA66C8E3D20CB993D925DDE3B066532BDFF3E1DBD016353BD4EB9203BC05C27BD7FB1283C776043BD887A823CF965B13D074AF4BD55D5BD3B2522973DF79BFBBC2825C53D1722DCBBE7E4313DD02D803B6EFC82BC8E763DBDAC5A653DAF5287BD2EBACBBCD077A93D3D8E373D610DB13DA5A284BCBCAC2C3DD1C7CFBAE3B7DB3DD09DC93DA02DA23C2BF589BD2E940F3D002B913DA00445BD0D3253BDE1BFCCBCFB408BBD2D7C923C0237583D8A87823D6D7A8A3DDDBDA7BDCF6F4FBD299B783DEB10723C906224BD8BD0283DD2AE85BD02F3A4BD10A0A83DFDC4823D9FFC94BCD6AFB53DB9FF0EBC23965ABD7488523D6B2196BD6296C3BC3F91333D9022CCBCC72D443AA5DC74BD57BF863D373F973DDDFB7FBB31A32E3D0E0E023D03601A3D0D43833C6FAF5C3D1F3EC2BC2983023D3C9F2ABC756C70BB763E173D01708ABC01F90C3D2ABF2E3D5173B83C3B676D3D26ECB6BC415083BC624492BCAB4515BD8E0F003D934AC53D4087383C4A1EB03DD3A4593D3EA634BDA58008BC079E4E3CFD1CA23BEDD8D33CE4C1AC3C5CD5A43CB6C2A2BD26778E3D0B4E6FBB6E84263D68DA4B3D769A783DEB9209BD32151D3D4823233DF38F58BB46EC293D63BE623CB15E35BCE06495BD68F643BBA52C9C3BDBCFC2BC4B023A3D9221223D70C1093DAD196DBC791E17BD011E6ABDC757D03D4EF459BA0DA0AC3D5AF58DBDAA62E93D48FA2F3D1956513D94A56D3D602BFEBCA74D3EBB39DDD53CCCF1043DBC729C3D260B813DA4C7BFBD2017ABBDFC53AF3DFB2F263C1F0E2D3D2B1C2EBDED9DB1BDE2FEEDBC2648203D7E9EC0BB6EB6863C67DC2DBD73038D3D25902A3D017E2A3D2E1F1A3D7535EC3D46996FBD111ACA3C19A6823DFC9252BD1D467C3DE399193D2505833A32CD653C6794B13C03F7A83CDA1EF5BA9BDFDEBC65EFFF3CF0F14DBD52507C3DBEBF25BDA508823DACABD23D4A948FBD6201C9BDF001BD3C5C09863AF2F3B13DE10A4C3DAA1AAC3AE7F7943C346A53BD61E3B5BCD5AFB2BDB0F603BD70275A3D4A9C42BDAFA9DFBC04FBD23D57D1893DC3C882BD93DFAC3945566FBC76F83A3D92BCA8BD75801FBDA4ADDABC938DDFBCABD331BC92E7863D45C888BD8D23ADBDDFB08B3D7272703DE5AD64BDA898083C08C19C3B5C777ABDD608D3BCD52A863DFBEAA63D883ED93D5B551E3DF1BC86BC7F725BBD863318BD03D8343D054A27BCBED0143D9ACF243DF90B4ABD78BA73BDD496193DA84DAE3D7DC2A4BDCCD6533D28B54A3DFBBBAA3CBBCC7E3D0D5E3BBDD0AF0F3D89C1A03D048ADEBC3DC5143D1D095BBCD1251E3BBFB2D93DA31555BD10925A3DD9631FBCA9A42ABD4061403D5438AA3DD925DC3B34BD623DACD38A3D2B85ECBC5A5A263C4036A4BD0649AEBC19D6563DBCE8AB3D7AC18E3DE587CFBCA903453DA49A12BD9079D93DC9E5243D291EFABC94D9B23D27721CBD0E4E96BDDBF60A3D312C163DA26257BD745C573D33EB99BD7F6D933D8B8C9E3DFCBD833D4EB64D3DC1B230BCF9C0CFBD1C305BBDFC1B8838B09864BD828EFA3D814F98BC71F7B03DA2360B3D4187CDBB211B7F3D0D0F0DBD8F55D63BFF152BBDE3C7883CB09E4E3DCBFBBABCE205B53DD332A73D48A39DBD03A28FBC770DA43DFA42163D0698E6BC7AFA073DF83026BDD0C6693D659E09BD4607D53B25E58D3A33A58BBDC491ABBD307897BD5F553C3CD7A35B3D21FBAD3DA18BE83CC52A78BD8748B53DB8300A3D33F549BC2BD38A3CFD4AB93D659B40BD844277BD305DF23B588184BDCA1CF53CF88081BC4CEF49BCDB8CEE3D28C6AD3B47F6D73CEEDAF7BC5FD80FBD4D92183CEC22E8BAE685A83BC29B7ABC880729BDB3E18B3D7A06AF3DC557733DBCCE2BBD703573B94D13AE3BDBADE83D18019A3D268D113D6CAF413C96D73DBC77FFA3BC79FE9D3DE2731F3DF62B77BD413F7FBCF39CC5B74F4BC93D22B3A6BD6C7344BDEFBDBA3D67A41C3DB070463DAE138CBC2FF115BDEA1D4BBC2615903C153A0E3D0B0AA73D2775053E5794C83CA8C96FBD454A453D21FB1CBDA09B313DD910A13CD8618F3DC6E7123DA233CEBCC55CE1BA030B15BD8AAEFB3C0586D73D814E83BDC00B193D9AECC6BC16AAA43D7AC79CBD9ADEDABCDF22943D88A027BB53A6E73CA95D9B3BF24CF53D5DB6C93C66EFA03B31559BBC03CF10BCC8DD85BD6D8545BCDAEC983D23993DBDECC5AEBD122D2D3D168BD43CA4B5643D2DE7BB3D0F30B13DD589523DE8F2ECBD76D7383D540C3FBD15988C3D3B8F6A3D66013A3DD6351A3CAF08CABCCD414339C1DAD13C5FCA2E3C450EBDBCDD09203D2309373C4165F8BC8447F73CE674C63D7A75E9BCA1CA25BC3B262ABD5C2BE83DD3A907BC1CE5E9BC588EEFBCCF224ABC833BFE3C6DBA9F3D0670DE3D89C3193DFF5C6DBC8199DFBC9BC2ABBDA4A6AFBD8A249ABD7087E53C32D445BCC80393BDAA04423D5C11833DA8229CBDA5E73D3C43EE50BD6CC13CBD88754E3DE366AF3D04BB0F3D5B4E0DBC9DCE9C3DDBD7533D9E2D4B3D9A4096BA59E1F63D28DCB5BDC19081BCCA2D72BD5ACD423B0BA98C39240BBB3C7154B73D7EF3D23B843E3E3D5B0521BD8C228E3D5650DD3C35C9C53C20EBD53DE103DBBA260DDA3DC97EE5BDD3006B3C10DF783C9BD40BBC964D80BDD07009BA46826C3D173D923C1ADC243D9D770A3D853D53BD5F8ABB3B2C249DBD3981D13B1A7D523C725BC83C801837BD1A1E48BD8E9E883DAEA875BC5B11D53D270C973D18C4423DA2B0F63C4AA6863D81D920BDE8951F3CDAC873BD4272683B27D5823DE41B79BCD20768BD4B8EA83CF28E03BD13B9883CB85E81B953864DBD9EA0D3BC543247BC922207BDA73F4EBCF7C188BDF0E610BDF7451ABC7871AE3D51D3153E9C07393D3756B7BCB997D73CAEA5D0BD795C3FBDCD5832BD963A77BDE14B3C3D2AFFA73C75EA363D1156793C9236253D064F9B3DE967693D35DCE2BDD6185D3D4D7360BD22D63EBDDA4F433DB090E63D0BD58F3D9B0DA4BCBE78EE3CB3E00ABD7D1A103D9D67A43DDC3D9A3CC5BD67BC636A5E3D4DC323BC6288D73B10A1C8BB8F8D63BC68EC8F3D8F645BBCB7752CBDCB4D40B9CBBC663D88B7B23CE0314F3C03BA1CBD98B85D3D057D883DEBB583BCF3EB673D2B03B0BC673B7B3DBE9C66BDC5BD5E3D21A6BA3DC97F453B946306BD906A39BD20C1B3BD612D44BC4F05243DFAF8933D7BB70F3DE86D1DBDF9D7E13C4B0C1A3C97CF873D2E2B8E3B23AA7D3DCB5094BD8321D83D73E9123CE53872BCB9DFAC3CA163C5BBED3553BB0AAE32BD36D24CBD1B70593DFE2BA13DF9D8E6BD37F632BD70CED2BCE08506BDE7F77B3D3ECDA23D293E423CBE04463D8B2A13BD764B243D5F4EA23D84299FBD8C79403CC043BF3D92D3033C243A173D5E56023D5D37053CC9D037BCF176813DB2558ABC1AD864BD3E9322BDA9FBCB3C8C82153C55451EBDA88B3DBD81C4963D002394BDFF8AFEBCA7125EBD1DCBA93DE632D2BC456A103C1EF79DBD7FD923BD4EF32D3DDD8582BCEF6687BDDE79A13DA69DB23D44EA4D3B0040883D8AA70B3BB14E6D3DDAF11DBD24BDFDBC0F3E1ABDC852873CE5AFC73DDB079FBD036D5CBDD188CD3D2C29EB3C63E265BD12A1D83CEA0A213D4C1753BD99B0B43D0392D8BC4DB48E3D8B1ABCBD701B79BCB96C50BDDFAB5E3D107A933DEFB8083C444B2CBDC4F775BDBB3F00BD5DC6CF3CFD8F0B3E1E7FEB3C30598E3C89EF623DFB92123E4971B6BCD5AD5C3D5E2570BD382F513D836A36BC06F95FBC4A9EE2BC863ABABB2F7E843D49425D3CD91BDA3C0191433D4747B93D125709BD3D35AABDD411813D0CCE853D860F20BBABA1863D8F9554BD1ECB8D3C7991003C623855BD7ADEAF3DF304D6BC173B9D3D78369D3DF58B93BC6DC4003D0258A63D7792B93CA911053D67FA08BDFCC88B3DF7604F3D97FD8ABD057E26BD17E3F73CA5809B3DC9C3F33CE67F9D3CB17D8B3D0C68073D576D34BD8055EDBBA377653DCD51CF3C5F6C0ABD215BF93CAFDBF73B131B9BBD499280BD2755F53BDB5854BDB05ECBBC5BC9F03C1F06C63D692496BC5C8F023D0D0D98BCD346A63CA338A53CCEB9033C415E3D3DFAFC6F3C8D9782BD0C3FD53C4F108CBC2F68923CABCC3D3DFDF8E1BC9D5689BD2E2015BDA651953DC759EABCAA0D173D9E0DD4BCFF67FD3BA8ED713DB14B803C5CC3713BB66973BD59A0383D0629CA3B378EA13D4853D0BCDC0A22BDDCEA013D2762CDBC26481E3DA83FB4BCDDCE063DF5276F3DB104DFBA3A2A8F3D05A4733DE5C26BBD6367193C0D5F94BD46AEA9BD7B58AB3DF786943C1E13FE3CBB56D43BA362713D7B990BBDBDC2B23CD57201BD57F7553DB1F4093C2662FD3CD04791BB8235813D12230B3D2BA356BD953A073DEE06833DC0BE49BD49AB92BC969C4B3DB0044DBDB36A8C3DB34064BD0E3C273DC6CF323D77546B3CA494433DBE31C73D4A4224BDBB93B93D4245DA3CDAD7CE3CE55829BC2C262CBDD0450F3DD150E33D3677A33CB76708BD5062613DF609EE3BD952CA3C9271043D9B5692BD46644DBDBD7AC23A18C341BD11CAAA3D13E7383D62F80CBDE5B53B3C23DE80BDDCD1913D3A89373D346815BA7C20BB3B54841FBD8E4A013DE3CC5C3CBEB1B73CDFE90DBBB7B58ABD85FC263D3A4988BD936DA83CB75A98BD5BDA973DD30469BD0C869ABD8F9F50BD37AC253D8CD2703D07CDBDBB4AF01FBD218E963DABCB503CA37209BDCE464B3CEC598D3D454117BD5885DA3BE1736DBDC23518BD583C14BD57A0853D94FD8CBC5F28B0BC682E683D2403673DB2B479BD19D95D3D934E9A3D643CE33CE751C5BDD5C801BDB45420BD1A3C82BCB62318BDE64CCDBD31659B3C3F7974BDF97B803D3A7E853C04D9983DBCC6BEBC4A2CC9BDA5CF613C6F15BA3C7F6D0BBC9304FC3B8CE7C3BC563631BD3BB9B33A35E83CBD3CAAF2BC0D5D02BDA51F32BBBDDDACBC3F5221BC840953BC8B400B3B2F130C3D80B9053D885395BD9C31753D785DD43C8AD9A03D3D9ACFBC817B733C7AAC89BDF6C68F3D0184B7BD3B54293D1D8AC13B53446DBD4CF909BC1374053D9FC63BBD9AF15EBD7A69793D96CCE0BC06B9BCBD27A0AB3CE898F4BC0F59343D061248BA9D7B8B3DB1E41C3D7F51393D3218853DC13694BCF287063DC807CF3D25477A3D7B88A33C79222B3C5330DD3CB36B073DD9BC8A3C553C97BAF53FC33C1AD7953C3B40AF3CD8DACEBC9B1CF63DEC2CA63C3CCCD13D1C3DE23CD995393D9D19613DFB3D6DBC89FD863D9B13653D0C812E3DF2774BBD61C9A1BD3CCDA2BD435EEABCBD05A73C68A3CB3C3C57103DB46475BAA9FDA6BCF4B4AB3D85011DBC37D5DCBBE436C43D982E18BD9E7A72BC9175713D8C883FBDB88E9E3D834DB5BD0DEB6E3D18863D3DF89396BD932E5E3AF473B83D2FE358BD343FA93DD8CE5F3D6C97DE3D10E846BD97A57CBB759F2B3D6061E8BC9AC518BD46578EBD857A163CCACC083DC1AB213D8C88C1BCCBE79C3D8823073DB2765EBD4B610DBCD2FF5ABD88ED163B3F4A833D314A00BD873B503D35DA1D3D42308E3D7CCB33BCF474203CC5A4AEBD097931BD2B6B683D1E7FD43CBDA3123DBE6E54BD61562DBDC1C12B3D8D5E6BBDDE84AABDD0D9653D1CCB633DBBBFFFBCBFF55CBD2D0F5FBD684DAFBD41175EBD75EAA53D6B237B3DD3297BBDE2598FBDFAAFE53C622520BD08F93C3C091B59BDE32281BCA41B843D0F0132BD46988FBDA80811BD4C058A3DB9A189BCF52D8D3DB990A63B009180BD5B7D893D5D871DBD3A354B3D2D5BA9BD5D85223DCBEEA2BD6B54B83C8B9635BDE38FBC3CF287E23CE8AF8B3D79F0343CFA57103D20AB14BD1D9B3EBC5EEB6EBD89E594BD3B902D3D7AB7343D0B3F64BD8FD9283DA525E13D32C6D43D8270AC3AC7321D3CC426003DC6EC2F3DE1F393BBC5D04A3CE5C96DBDDD098FBDE2A19C3D62998B3D93D616BD3131CD3D389CF23CD50699BC1F1D4A3C5D8D843B1A26F93C733B2DBD3C175CBDDF7ACEBD1DEFBEBDCBEBE3BCF01F8FBDBCCFB6BB6569353D0C3493BCBB8E43BD7EBD20BDA17386BD293C1A3DC07B72BCECAC393D1653B63C2A407CBDB787363C0B48A93C45CDD13C9B8102BD53BA753D9340B0BCC0DFCBBC68FAEABC7C5DE83C60B744BD8B661E3DB5CB6D3D5DBEAF3DF698B43C122162BCA43E6ABD1F10EC3B0DD0943D1A2B1A3D34BDE2BB2514053D4D8280BD11A7FB3CF4AD6F3CB10F0E3D0078DBBC5530C43C0E61F4BD8158A6BD9A71AD3DBCF90E3D1E98823C2382A0BCA82C403B60A69C3D262CE2B866FDF3BCA0E135BDAC2B193C61DC5EB9B6AE79BDCBDC6ABC03AB37BDA585F03CE87CB1BDC83145BDC99B603DA2F4E63D42ED8FBD21BC32BD9313E63CDAC30F3D4CBB68BD0F3CC73DCE875FBADD69683BD6AE393D9E010BBD5D27D93CD68BA3BB9F6399BDAD4DFD3C2C56923DF7A78D3D7BAB73BCC93CA73D24CFB9BD642839BDC045523D9E35603D5E0D4F3D5BEDC13C9DF7953DAD7913BDF074963D4233913D045998BD326EC2BD9C95BF3ACA4A3E3DD063D0BDBCE9143D7CC9C03CE4510DBDC0AFA5BD42AC823C0B6692BC689E823B3A03B7BB125F03BDFA2193BC4C9CD53D36260A3CD996D13C191055BD2C22773CF5A0973D83E63C3DECFD95BD085043BDF160353D7C2307BDBCD1963C4F28833C4757503D2A2E513D3429073DF4D92CBD6987A5BDADFF33BD686C02BCB4B31BBC9F0211BD091828BD9F1F98BD12A63E3D8F32493CF35277BB9B889CBDF840ABBC93CB0E3C9BE84CBD5724D13CA5EBDABC7E182D3DD7EB473D935B82BD0A5C8FBCAD315D3D99BD5CBD22BA31BDB187B5BC2DE7ACBDA516A83DA1839ABDED8285BDF1F8203D572E22BD731D5F3D1A3B9FBC184AD83C873F9EBDE884503DA802FCBCCF0541BDC4FB873CFF1F9F3C500C273D6D99C5BC49CBDBBCD651773D02EA1FBDAD1751BD7B6D2EBDEA2389BCB6359F3CA62F97BDA7AB113D169A393D37DC3A3DF081893D7217163DC40316BD71110DBDFE1178BD75C27FBD993E12BDB4AA1DBDCE28D1BCF6261EBDD08EF2BBC43FC13CE6E7CCBCDFD4B6BD0F47843DEF051EBD099A673D0F9BA0BDE0660CBDE381413DBBDBAB3C9B1505BD2BC1AABB1DFE553DDB558F3CEA49A43DA2E40BBD07F87F3DEC6252BD0F7BE73C45C75A3DA3AFB13D1C140DBCD57CACBCCE34B5BDA7C7343D30B4733DC1F94EBC2F69363DEB0BEEBBFC2FCDBCB4068C3B1B846A3D8988A03C10A481BD751EC3BD354C953CFF4C86BC5ECF693D153638BDF45E71BD468B22BD4C03A7BDCEA6E1BC1075623D8E74AA3C5FA90E3D3DFA353DF11394BDAD3D203D2466863D2EAE073D4566DD3A0196723D0349703D7BFA753C4A98293D24AA37BDC974D1BC1EED4ABCEDA5003C07E101BDE708223CA33DB13DD0E09ABA3D448F3D8FC0CBBC4D568A3C8891B1BB11665D3D9DBB303C56B98CBD736620BDE9485CBD8425A8BCEEBA07BDFB8D8E3C57EAE0BD20F6543D5863503DCEAA553CF021C43DF41CB8BB50C0DABC94978CBDCA46B9BD2AE11BBD7BC4223D7E6E3FBDBC711BBD3E3CDABCE6063CBD7C87A0BD36CF4DBDBEDC2DBD14A121BD7CE0E03C59A340BC756C143C5B584C3D36BB543B4E096ABDCC249FBDC77AEFBC0589F63CDEEB733D458989BDAC0E193CC854043C54054DBDC6838B3D2BB588BCE29F25BDF2647BBD40352A3D146CA9BC21AD28BCDB0E8ABD944B1ABD0B3CE8BC3E317CBD6948933D09D767BD70A1E23C64048CBC2DC32EBD9CC7A0BD02704EBCC711FCBC7E99A6BC65CD04BDA5921A3D63C87D3D4EFA5FBDFF2B3A3DB1DE273D06E5C13A62115D3DBD4400BDAAED3E3DDDD15EBDDB1B8CBD287F95BD8C00E23BAC01F5BC118503BB97E593BD35A850BD92BF87BC1171BB3A41EB1CBD34B92E3D4269273DD884B13C74AF06BD1EADFEBCB78C843DDA90E93DE84247BDE50041BDFD2B393D74BABB3DE6CF043D7F0B1BBDEDFA8CBDCB3E40BCE7FF92BD60B94D3D38E14FBC6200D63CE922613D66AAC6BCABADA0BDF6449D3A4063DF3C47D76EBBCDB1B1BDA07A493DE56C8D3DD50F3F3DEBBBC03C226DA6BDDCF4FBBBD6BDE73C1BBDA43D640D10BDCE365C3C9930FA3C608DA63C8B706BBD3B40833D7CF8CB3C740E5D3C0225253D306AEFBC039C4EBDA1E3493D092A3CBD1252133C4A54F0BBF19934BD6B91F43C5051B9BD2DAF6FBB6844463C6431C6BD4B84D3BC46D395BD41277CBC04E9ECBC2CB94ABDF1DB29BD927BBF3C8B25623A6FC188BCFB78A3BD26159FBD1C0AA13CF17C123D150099BDE2B8AFBDBA5A74BD4A39CF3DA6FE75BCB2B573BDC4A454BC4705593C682E883CFDF83E3D9DC1553D6713A23C4826CD3DE044CA3CD8606BBDA3581E3A32459BBD3D0B943D3004C13D1B9CC13C0FAF8CBD6484FFBCEDD79A3C61F5043B0093283DF30B1A3D686D503D562A31BDFB5CC43C25F31DBC42D13CBD76A982BD86A0483D86C1B03B54C0FDBC244B783D5C9D6DBDE36F88BD0CBB29BD82B9863CE0E6D4BC3F0A37BC0A4ED7BB0C6893BD70583B3D732DB7BCEC07853D36C2B6BD250C693D47D484BDFC49223D0A3F3EBCCAA63ABD64A2083DDDF3093BAF2327BDA0F5C2BCCB4493BD8162753DB005EEBCC0C26C3D70E879BDE26C1D3DB3DC65BDBBBC0B3D874961BC50E2813D72C2343D30E0ADBB3847D4BC51DEA43DA9F0033B451CBCBD54BA723D6434583D99468ABD97A45B3DE07D4CBD3078623D39F5A2BD7B7480BC20F8A03B157FD5BCB861903DED7B35BDC1955C3D258B863DCCCD253D7DCD653CDCA3C2BCBE58E8BCF02666BDF6BE8EBDC125463D5D2C9CBDA32DA5BD352F9FBDA9AE1CBDDE80FF3CB3AD0FBD610A173CF1AE93BD44C776BBE91F543DB477533DE2E5EFBC94CEA3BD001E9DBDB6232EBD546A163D24E401BD3192853D74307BBDE1E1A8BDE67305B943E31ABCA16C083D9E27D33CBE2D5D3D7342133C3A933EBD1337543C8D17A8BD50CB493CFEAC273D710E1CBCF221443C3B47183CA3A271BD6D78A8BC0B928B3C3489523D7C5994BC7C3F6F3DFCB97ABDE554813D72A83BBD925B533D9FD3083D72D7123D2D8C223CF25FF93C12F5983C2DD802BDE832283D3740BBBACABC623D8A8D6FBCF42D9E3D1FCF8D3D601792BC2D9C883C662A18BD3E90CCBC9E3B9ABD6607B23D241CDF3B887CA1BC628167BD928919BD6B7A1A3D10A628BDDABBC43CB78F8D3D694B24BC5D81473C371316BD432A1DBC0043813C4B12BF3DB6A02A3D177086BD32F8853D4EA0033C5DAA4D3D40A0DBBC739B623DD3DD1A3D9EA6D1BB2DE22D3D4428353C6FB3E2BB453C00BDEAD78EBDADBF96BD70F7813DB5F9E0BCB58065BD3C2D47BBF0CE4BBD001F90BDB07073BD5F35493D4A5193BA8BE229BDC7EB133D1AFDB73D1AC5423D73578FBDBD63EA3CF8B9B73BEC14853CAF762A3DBB0284BDA53EAB3DFF547E3D4690DDBCC1E4C0BD81F24F3D711CB03D87A4523D9CC1C4BBFB9B0DBD8B6F9DBDC3DB61BDD6012F3B6A955F3D3B9A933D6044F23CC41829BD551D713D1052E53B9C1717BCF0B7183D9A6563BD293FE03C4C61023D5E024B3D899316BD8A9096BDBEEDAB3D9F71F9BCAFFE8D3C28BCB73C19448C3D52F1B1BC3E1D883D13BA9DBD41AB6BBCA4A0A33B27669D3B4C6229BDDEF0AC3CE96B53BD4889933C4B76023C07742A3DEDE68B3DD8809FBD531D5BBA48FC9EBD08CBEDBC1DD85E3D32FD063D75F62E3B29687FBD8F41F1BC32C2FBBCEAC3C0BCBE2B403D00FB59BD0C5836BD0E6843BD1BC9A9BC2B13AEBC861BBF3BB6B6893DED0E283CEB6D643DCD6D503D3D0532BD40BAF13CBFFB43BDF18094BDD1CE82BD42F09ABAA1CA263C9324C7BA0DDD30BD3E40EF3CB49D443DA008363D9229683DF25E233D4E34923A501CB9BC4D26CC3CA1C81B3DE2F1363D4DD4213DB6FBB1BCF9CEEA3A4D3F95BD3FCA1C3D5E9DAB3C03A878BD26281B3D76DD9A3DF66579BD0BA0F5BBE7C0833DF7872DBDF2935D3DA92A803D02EAC4BCE0191ABDD4DA173BC078D8BC90E2163DEFC0FBBCC8D2BFBBBAEFA3BDC050183C8883BDBC3F0505BDD4E0BE3B15A740BD78C29DBD894AA03DC2157E3C9666CCBCCD49903D9FEC903C98B71FBD8A70F23BB9D5CCBC9142A03DD2B242BD0057ECBA4D2061BDA4DC003DED22B63C92B84B3DA21292BD45261DBD8B73303DFE40CBBCFE568FBC26FF69BDFD3DF1BBBF8FC9BCFDB8F63CF2252FBC32561D3DBFF02F3D1EF613BDE0E241BD22F5AC3DC2BAF0BCFDD74B3DD4FECB3CFD1D6C3D3B1C02BDFA9E693D97A7A3BD7B33E7BCDA9A0ABD2AC4AB3C1730983D075EA6BD4454163C9F044C3C39327C3DADBC523D334EFDBCC89258BD8723883C9568CB3BA9792E3DF642153C922BC23B487EA5BDE964933D5FD3CB3CA0980C3D8FBB17BCF2E01FBD4E0B40BCF7C2103D951F38BBFBAB91BD8E5980BD04681B3D86789FBCD6BD8CBD7FE363BDF9C2483B8EA7C9BB6E7C2CBDADDB0CBC029D313D273294BDA99F2C3DA44476BDF5CA37BD983A933D1A55ED3CD603C03CE97797BD9C8DC3BC865D943D22C4453C2CBB763CE5F077BD008B27BDD7C198BD2517A9BC897D873D49FD533DCFB78F3DD23884BD151EAF3DB8B0A23C79778F3C7CE68DBD50438F3DD495983DBA6826BDF3F8433D570826BBD7C5093D3AC2EEBC3223CDBCFE2C06BD5ABFA03DA78C183D06B28FBD83421BBDDBB1693C0DB7B7BC7E3B50BDCE8B40BD4A9414BDFE433B3D2D9346BD02E5D93C7BA211BC85D50C3D785F5F3D57A2913CE04A3CBCEA3B593D8CF96F3D6F1837BD33EE733D13BA403D77EF013D0A1A763CE5A8743D7720913DDE1D9E3D10834FBD122A363C2338493C7FE801BDA21D9D3DD60093BDDE830BBDE51981BD6DF000BC654B923D9F2820BD0D9C8A3DC0159E3DDF8407BD9F2F1BBD62A2A1BB10809B3DC105923DC3B90F3D4C3059BD39FCF4BCD250823D81958FBD4BAAB3BC286B12BD1D8E9DBDFE7653BC80EF08BD23229BBD3B6D243D9368B8BCAC8FFF3BFB668A3D260DE23C7A6A723DBD4792BC80B0A03DD89E343D7DD0833D116248BDBE2C483D2FF003BD388631BDA1D4553D67FC9C3D37D49FBCE8906DBDC94782BDE83B68BDF06CA33D91C960BDCB8C73BD2D2C083D7CB3883D459CCA3C201140BD1FDC36BC8D43E9BC3096A63C5D6495BC1FA9363D099B653DC8AE213D3A6EA33DC350B5BC27464CBDDC089DBD1B9A5D3D4638E73C6BD496BD8D82673D1555A2BD88CB793DC347C73AE9BCDB3CAEC737BD7D4385BD1ED0843D8758A1BC22054B3D281AADBB459465BD99F81ABDB347ACBB796CA03D0DC25CBDE9006ABDE4322A3DCA80203D8E63AEBCE6D88F3DD99EE33CD758A93CB6728EBD98185CBDCB6707BDF98D9F3D106E513DF939973DB3B89BBB8BA366BDFA3291BD03CF61BDD7D31A3DE8E998BD77399A3B0362E53BE6BE563DEB2C8F3DBB4A08BD76C43CBDF53E4BBD60DA6BBDEF9865BDA89202BCEA2486BD132352BD806B58BBC3C9813D663B803DF433663DDF976EBC473835BD549A23BD20E5E6BC68B5953DB0FC3F3D324A1B3D115A95BD4C3B573D59DEEFBAF7F906BDC8201ABDF936F83CFADA9B3C0BB8A23DFBB6803DF1A7B73CB80538BDA315993D48E85E3D7D011ABDB4EE233CE135EF3CB2F193BD375941BBBCB8273D2D8C8E3D041C3EBC9287953D0B3A9CBD483E943D1E7800BB75AD193DB21B333DC8FF863DFCC0EEBC4D41C6BCD473383C66D90CBD103C5F3C3369AFBC0BE20BBD045C923C4F6839BDB2A07F3D56BE4D3D718686BC0C035CBDAB2E56BC1928263DF608643D896B523C5A5502BCABA85FBD3AD692BD3B1831BDF7848DBD652836BD7DC6503D134638BD4E8C01BC8BC6983C4D82763D69FBC13C5060023D6859283D6A33BABB24642D3DC1BC553CACEED1BAD9282BBB0801933D87F0FE3C4348323C664008BD11F533BC787C2ABC34381F3D3817CDBC7100C1BC07D8213D17AD713C86275A3CE12D803DF58F50BDA410D1BB7C48B73C42464F3DAEB8C4BC9946543DEF64413D47BF81BB3DB15F3D301CA6BD62E6853DE56F8F3D18856BBAA435F93B99D9763D03BAB13C2BC8A23C664B963D7AB081BDAB9D713D6712443C8425963C9CD00DBDF377DDBBF36489BD96BCD6BC59A218BDB7A3F5BB593577BCE81C5FBDA5480DBD5A3C673D848C573D221CF5BC75DD3DBDCA7A1F3CF03E3A3DB375823DE958733D94CDB2BC4ADBBFBCBFC98B3AD485213CF54B993CC37621BC93C809BDCB0AA5BDA11F80BD1B1BB8BBF4E1F03C24F1213D264696BDFE33803C7C5C4B3D992F9BBDBAE1683D3EEC9DBD789780BD44C087BC710366BD762F413CF06D73BC1AF1F63B3699963DFBE1EEBCB652B13C2C95123D6ADF803DD7CD083DDCA9BCBC5620753C376E403D3EBC853D9A9C6C3DB17C62BD3F4A9CBD51A955BD9DB099BC4B2198BC6049AFBC9BD1F5BABF077FBD4FE84B3DB60E8B3D11D15ABD0C2746BDFE4C983DE042413D1EB44B3D87518D3DD4AF57BDA2237FBD09FE82BD35D67B3C3ED17E3D407E923AC25B79BDE2F3833DE6FCA0BD42C782BDB32A1D3D8D0D043D2ACD7A3D6F9AB2BC451B403CE61B653C50DBE8BB6887CE3CE40EAB3C04B9DEBCE1E894BD4C3E973D3B58AD3C1D3FA53D9F41933D6B4F173C9C428F3CAEF5E6BCCCADC13CB3023BBD4A6E363DA31D90BD002D04BAA640243DC133E33CA195A1BD7DBF84BDB38B87BBC86C39BDE88E83BC501FD2BC47EA333DCAED0EBD33AB523DAD5D81BD5C3B71BDF2418CBBD2ACD2BCB6C7223BDF5B853D771885BDA8B68B3C1C129A3C1DB661BDA0FD0B3BEAB037BD943043BDAD1171BC0D6EA1BD6E281D3DBB8796BC77AF5BBD10980DBCE42C79BD94F4CE3C444DD33CE01466BDD47B79BDF66D0EBD9002DB3C57EA0ABD68CDB2BC0ABB61BD72A380BD64EFD93CE0F7BD3BA66329BD74380B3D40AAA2BA06D61C3DC49AE03C500B563C68E6F1BCEF7F0CBDB07517BC4A01113DC46AAD3CA691523D272C883D28F007BC0009E2BB9B773FBD24F104BDED24A33DCFC2823D3D28A4BDC8F268BCB00D8E3BDB21A13DC06C80BB800992BA1513A43DCDCA13BDB83E5C3C3893DBBC7836DEBCE4F6ED3C330A73BD505DFD3BC8BDFEBC87C38D3D3C76CA3CB6C30A3DF25B143DC136973DA08D00BC4EF61CBD92BCF8BCABF562BD888960BC6CF8953C32D970BD488AED3CECAEEC3C9AFE463DD4D5F63C88DB663CCE528FBD0043A73B22B900BDA0903BBD0B8D953DD6DE6C3DD8B2C33CF047FC3B00B2EDB90C74A53CA43B54BD101565BCA082343C002D1CBC8C2895BD9621343D4D8446BD30B275BC384A82BCBD69943DCFB812BD0F728F3D049650BD2DBE03BDFB2F3EBD06267EBD9B69A13DCCAAF63C32CB11BD482B5CBDA1B7903D26CFC0BCDAC172BD80AFA8BB6860DB3CE3D8923D9013A5BD34A6983C66B25F3DD2E64FBD68C456BDB7AD8E3D00D22C3DC50AA3BDE4BB0B3DEEB058BD8A467C3D08AC833C048C76BDE2CD423D13A58A3DAEFC483DDFAC17BDA49FE03C80CA243C0CC3A4BD60A457BD6CE61E3DB8AA0D3C6CA7223D285B27BC4A9D413D9C611F3DD4571B3D6AD353BDEE8E6A3DC4B6213D7CD12B3D50D3843C7622713D123EDABC4DAA9FBD9034853BA0D34E3C86BA643DC087E53A6EC882BD394A82BD7009D3BB3301863DEECE7E3DB9248F3D404ACEBA400289BA16F9793DDBBAA03D8EF860BDDD513EBD3693D9BC4E2FC1BC547B2FBD6073223B209B733B96054B3D4E62523DF8A639BCF346803DC23FACBCF4FCB43C4A1B3C3D3CCE88BD80611CBAF0CED4BC28C090BC40484FBD15DA27BD40328FBDF44DC53C6C39EA3C0A4A6C3DC02C5E3B0E1F113D52E374BD707CA53BC83350BCE84C20BCE8091BBC4E757ABD0845133D017A883DCE335C3D3AAA82BD58D7103CE06FF9BBA8199CBD6D121CBD3486F7BC8ED47C3D046AB73C98D0E83CD6A34A3DC8FC3FBCD640263D6AC098BD6E4ECEBC86536F3DC236543D1700A33D6EA7D2BC8C1E6DBD40A1F43AC044E3BC0061F03A1CBA2CBDBEDC6F3DF22748BDC99F9DBD40DF71BB9036E53BC05521BC18C406BDCBEC9FBDB8E50ABD60336D3C49CA803D88790EBC18434EBD51248A3D84572F3D9BC88A3D708E20BC8B37913D246388BD882B4BBDD8348E3C9045BE3B7F924ABD5403A43C6FFA8A3D38152EBCA1570DBDB0EF8B3BB6F92A3D3BB477BD58D646BD08BA2FBC18EB6EBD1C80863C146A82BD48E1513CB70D3BBD281746BCC82D253C015E44BD16BA92BD29000BBD402FCE3B3C7583BC64B2F5BCB0DB3DBD7CB115BD92806EBDA473593DBA2A56BDA83F443C8FDE8CBDE866993A58BB59BD4A4AA03DF8C6573CADC34D3D875D84BD7BF76C3C8A33153DA0BCB53C7F2D9A3DE091713B88AF5EBC6A67DDBC315DFDBB48C26CBD75AD5C3D9D6EB0BA803156BCBF7F9CBDC2EADBBC915DDDBCDFA804BD49620B3DEBCC833D2902683C9ECC76BDBE6C143D25891E3D9CEDA5BDFA948FBCE61200BD18D1FCBB856FB43B5A9DDEBCC438A33D6C85643B089C85BC53D08DBC87A57F3D232604BCB651253B528B99BD1E26963D1C75A23D3A3918BDBBE8963D4B15BB3C273B0E3D6E9F363D9E39823D886FE0BCB0315FBD50D03ABD7261853DF07183BD628A76BD9A5A833C9A3E74BD49E56B3D347B27BD49FE1EBB24D115BD15839E3DA269483D70F9633DF6025FBC4A1356BC16C098BD12A3333D29456E3B8430EE3C06DF18BD1389333D9289C03C133A5C3CFFC26B3C1351983D066B283D3BF6B9BCEBF24F3D785A093CFF64913D84D68EBD5BAE833C11F91F3CF8A9FDBBAAB68BBCAF7998BD43C17A3D56196BBB6F77E63CE8A9A23CDE7B763BC7D7A0BC089DCCBC9542623D19DF523D6F1F85BC58B67B3DDB4436BC50D5B63B193E86BC1ACE69BD1D2C4ABDCEE2673CE35D7A3C679D723D7C5F77BD46869BBBD4329EBA94FCA63D283263BD60A63FBD0D23F43C33569E3DCC2EA33D554C9D3DFE64E03C7BAB113BFD3C3EBDC018353D644F68BDC374803DD11AED3C388D5FBC9477A73D9A062D3D305C213D09A7B73B010366BD4834E53CC0BD30BC596EA3BA939C6BBDD220993D0BEA8C3DD69B02BDD3850C3B570B8CBDD03011BC42A342BDB847B6BCB94E91BD05F860BDB3404DBD6E30CB3CC954A93CC3677ABD5B28ADBC3D2C3ABD583E02BB6B55A2BB827ECEBC7B8A8E3C73517A3DA551883D8A2F183CF83367BC344B683D85AC52BD171ED73C45D1873D27F1843DAC1E523C5A1690BD096B16BD0CA92E3D9FDC8BBAA898AA3A27EA0E3DF2821FBC8D40043C89078CBD83107BBDABBB7F3D5BD6A8BD19F2543D49BC01BC99D82F3D48F88D3D742239BDAFB4A13CA4E54BBDA5B0063C50A91DBD6F308E3DEE7B9EBCD8EDA43A3AE39B3DDBAB893D774B933C00C317BDBADC63BDBDF3713C546388BD8D126D3D702D05BDA33911BD8C107D3D74FF0E3DACA5A63B6BE710BD7D5D0EBC1A1574BD17B06ABD56747DBD28F466BB4F7D4FBD57CBC3BCF9CD893DA23336BDE20E9E3DB2D7273D57142DBC94CF1FBDC845D6BC4008813DBEEA83BD0C2F71BD6769083D8B80833DD286373D57B7243C374B7CBD4C6F113D9345C63C9B2116BC001C5DBC2DE2953DCCA86BBDDB123ABA293629BDB1C2D63CF5AE243CD7289ABDD228C3BCF78785BD7E1C383CEBEFFFBC5A020F3B19C77EBD2B277A3D52DBF13C4DAF5EBC2C77083DBB22B33C7CC448BD7DE77BBD3D59DA3CF03A483DF9EFFDBCEE594FBDA3AD99BD2E7429BDD3478F3D60EC8EBBD21294BD685E473C6118873DB4CB96BC83159E3DC362DABC430592BC524FC8BCFF0AA6BCAE6F993D9E89673D05469D3D99E259BD17E294BC94B5373DC9CA69BDBD3737BCA1F0C93CE9ED16BD40BC56BDEE9A96BD76B6493D705AB2BD0F38793C79879E3C8E7362BD0E9F0D3DD2ADA23CA87B74BD9DB62FBDB26DFBBCF87F1C3D2E4F52BDACDA9DBDB468353D70677DBDF173163DE9D9923D4FB2663D45D04ABDACC5C03CAD8F46BDEE5712BB8ABDA43D8821633CCB0F97BDFE58973CAE9803BBEDE914BDD4A7DA3C0B39CD3CEDA6A43D7C0D7C3D3B0B65BC9559C43CDBC4A2BD7F4DF33C3B23563DBD9B043DCA7D773DC3C738BD724D7EBB62784BBC116AEC3C89205DBDDA4C2CBDC8A8663D7565D63CBAD7923D0196DCBC60204E3DDA26383D18616E3D52BD3FBDB73E01BC1EFACEBC8CBA4A3D6BA965BCCEDD9EBC89E95E3D69C481BD4E1E6F3DF3990DBD6929223D3472AB3D542DA53D9F1848BDEEA78DBDA22B0A3D9895E4BBD6539CBC2EA3A2BDD4B2983DB20B25BC27350EBD7EE35BBD724595BD0289853DED146F3D336DF1BCB94A753D3C5C6DBCF80A2ABD0F18993B83BB953D867AB23CBF071A3D4A5FA2BBB47CA33D9BCDC9BBCE111A3D883F413D90834FBD7EC594BC5CABA1BDFB2DA4BCD60AA7BDDEBB9D3D826F64BD606D873DE1D2833DEA011C3C313F913C43E515BD7D7D1ABC8B7F22BCE8177BBDAF5084BA97A7EE3B6E94523DEFED53BD18224ABD0B144E3CE6A9533D895CA73C9CC78FBDB4B23C3DD430BFBC8477563D32D418BD704DC4BC6000053C67D69A3D06A0943D6C0083BD35F5283DFB1655BD9D8404BD72859D3DC9F7733D1DA2EF3CD19683BD79A8543C4FD4A8BD988370BD83B986BDAC6F9FBBA368243CB7E7E3BC1DEC52BD6DF7403CBFAEE53C8CF59FBDB52561BB1CB4DDBC6C215DBA431A773DA65A05BD3CE792BD5E3A4DBD8207A93C5F361E3D086F2A3DCB1AD63C6B9043BD6481833DE8A14BBDF66A9B3D49B8473DB7F6883D574305BD6F358B3D9985953DC653533D7C4948BDB9C217BD5D5B593D3A630B3D5C2B74BDDA59853D114F2F3C6EFDF93C4C4EC7BD9F8D833D62B4B5BCCB1F4F3DD1B78F3CC56C833D88C475BCE4C5BABD53884D3D328A173C341CE1BD100581BDCFE56C3D07CE90BD825B9DBD610824BD97D690BDFA285A3C66B298BD58D650BC2B71CDBC3D7341BC1688ADBD5A397B3D6559ECB96E44B9BC9CFFFC3CF0F5463CD4A695BC22EE7FBD69C495BC66533ABDE9209DBD348B753A2C0FCE3C7F060E3DD81788BD25CA193C51B29ABDA1F43EBD28EF8CBCFF6D8C3D70006DBD954C053DCD950F3D1FC3D13CC4CDE7BC2D3A393DD845473D726C6DBD39FD99BD14D583BD2E45333D154D9F3D6F915DBC546B76BD7221613DB79AD63CBB74BE3C80CF9DBD603851BD5917E13902C5AA3C03E0863BBF2E7BBC5B38953D685FAD3DE4E36ABD644A083DC0A5B33D2E1C20BDAF2693BD44BAE03B0CE210BC8569843D737D14BD2C777DBDBA11143D89DD093CCED14D3DC53C6B3D31F8633C9C2CF4BC756F44BD3A03E33C8E0C55BD4740D3BDEC6686BDE24998BDC0C378BD73808A3DD8698B3C03DB7C3D2EE9823C47F8803D13C4933D97738EBDA892E0BBAAA8B3BDC72D0CBD38C7023E47C524BDA54E973D7B72E7BCD8D91B3AF89DA93DB7EB82BC75C742BDF1E064BB5065A8BD976206BD072ACA3D4517423C6DA6B3BBB03D8BBDB4810A3D334D803DC9E223BD4690ADBDCA4EC7BC4FC4083B6234093D2CEBC53DACCE873DF733EFBCFD4285BCBEBEC6BCBD414D3BA96093BDA0E59E3D6B46EA3CA6982DBD837F8F3D865330BC6CCD353DA99D2E3D0D4A503DB63FB3BCBD2D89BD69F355BB3B4161BB75713B3D52FAA5BC05F01FB92FF888BD02B9B3BD3DC0633D8E5E81BDCF63823DC067B73C1E7703BC03E3893DBF4FD63DCC4242BD7D6B6F3D417D25BD4E9265BDD039EEBC363CA9BDC6D8993DF152F8BC4BAED43B53AEFD3A634242BD89EAA8BC64CE95BC8D3913BC202217BD51FA83BDBB09893D1288133C2D3C42BD4B01503DB1A4893D84B9CFBC3232083C70FDC7B8EDEE2BBD26A1ECBCF37372BCA9B7F93CA71A14BD768ABE3B1AB4733D2AAE71BD07421CBD7E3A4D3D0532A9BD9D192FBD224A193DA3BFDABA1B7CEF3C40AD76BD0A4052BC83B8603D031CD33C32D61CBD41368D3DA321913D974F30BD6D3587BC685F5BBD9D2EBC3C1D433F3D117A123D850E883C9DD740BC3F7F993DA6529BBDEDAB2D3DA18B983D3728353C0420DABC0375933DBC2BA6BD634B4F3C1F6791BD4DD152BC89F9443AA9EE85BD280B2A3C902603BD921CA23D2F9EAEBDD03EFB3C89E441BD99F83F3D18F91C3D5CF9E63D86919FBD8B0403BD9E21783D4DC390BC14BBAF3D6AA89DBD54AC4ABC7C8E223D1DFA92BD1A7CD3BC606229BD0BA4ACBCDB5E33BD98127EBD22C003BDB3DC9B3D002E70BDA46D553D8542A73C81DA1CBD5CBA80BD191144BDD93C7A3C333CF13B42386DBD7BDB38BD7B7F813D3E3E9BBC68B73E3DA6FD07BD7516163CBBCC2E3D804AAE3D4DDD643CC81E623D57369EBD903A53BD33D473BCE03AA93C859FBF3C4A993BBDF58D0FBDBB31833C76127CBD59900DBA304C1C3DD6AD733DB9AF65BD7271BCBC5FCCD2BD2C54ADBC3AEA583D576A73BD9BAB783ADDCD17BDB4E0403C932694BB55653E3D7CA8A5BD6532FE3CF8699F3DD28C423CB125803C18FE823CE683EF3B18E176BD00F2063D366BABBBDF7C983DCEC1863D85121D3CF39E083DC0B7A7BC4DDE623D9819663D278E513D5A1A103C70F5923ABC9D533C37AD8DBC6AC1C73CC090273C6F126C3DE59C57BD81F477BD08B8EC3CDA29D73C63F39EBB63BB863DAAD7393D3B77BF3D3734043D261E8ABD8031D33C8962823D5EAB7DBDBE2726BCFE92133B5DE668BD2696AD3DED5840BC6F3D803C480151BD4648703DA61205BC0266A7BD3800C3BB90B607BDA947C73DB3F097BDF3B4223DCC32EF3C3944A23C57730CBD29EF07BD8098AB3D05C16CBD2307143D1989863C15EE183D5D2B863C5D963E3D5DE6913C0D7F15BC9270ABBB6FC646BD9D9A38BC5EA0A83C0CC990BDEAA7B83CDD1204BDAD49963DD808633CC6A4F8BC339F513D7D0595BC211F4EBC3DF2943C4FD6C23C832A713D22486FBCD23D013D75E2333DB23A64BD8F2FF5BB5586863D63B139BD01F169BD5CED333D36AC8DBD579B56BD88A479BDB067A5BD045EE83CFEE8773C37EB65BCE77A9CBB16D8EBBC5B42AFBD165D12BBA13FA1BCE00D1A3DF9B1173D3783853D887F9EBCD739B9BCE7BD88BD7AF8503DDCCD9A3D9BDC173DA6F14C3D04F3513CA7F6133D7A704F3DC35574BD0AAE903DF714643D1564253C07D304BD97331B3DC0BCA8BCBB0C9EBDC8B264BC9F97A63B901D693D72087DBD88B4323D1E70523DFA1E8FBD3AB382BD2984ACBC22DC473DEF872D3DE414893DC92D193DFBBDA9BC439846BD7E52423DA5B4F23C899752BDC47B553D51C4493CB5859F3D2D906F3B00CE073DE752533C153462BD85CD003D4780EA3CC6E032BA8238F4BC53DF93BDCCDA0A3D6CD9853C27C670BCC819533DBCDF8F3D03D779BDFCC788BD009D8B3D1410BFBDBDCFF93C8582A7BC33B73E3B6FB90F3DD29474BDC1FC043D1B4215BD66164B3D15C9893D88B98BBDE4A7883D13BAA2BDFDE00ABD1CFF88B9B835993D37056B3D9201573C08475ABD0C7B4BBDC775BD3DE9824DBD82FC0BBD162AB63D0B398C3C6B39B73C3C0DB33D7C62BC3D0BA936BDA8691EBDD8979EBD5E5E843CD81CB93CB642EC3C5D14BC3D16EEE83DD8E9FABCCDF7433D71B284BD59763CBDB756573D54AFF9BC9E31C13C47AAA03D24C2E5BB03110D3DE4FD2ABC5169EABCE72438BC7D4DB73DDF52163DD797A9BAABBFAC3C82C3BCBA9EF7543BC745E13C7EC3AD3DBEAC2ABD33F8873D2EAA263D344FB73BB543123C4E5B40BDEDAD093DC996813CF0305D3AB89011BD2E7597BD539C7E3D8296DB3C58D7393DFE528FBDBADC923D6B63363DDED1AFBCC481803D7E83953CA6E362BDF698FA3CAEC2DEBC846C9A3D56F198BD19D11CBD757F573C8463193D66A9933B4D8248BD31F3933DBAED4BBD098D25BDDE52EA3CCEE68DBD081823BD7FC322BD700583BD11F7B1BC0EDBBFBC2BEF21BDDEC35DBD801B44BDDF39863C259BC93D369BD0BB4C2C2F3D344A9CBDF50FD9BC120B52BDB87507BD8C7A43BDDC5F6DBD02480FBDAE958C3D17BA243D858B243D77535ABC99AE32BCFE748F3D76907C3D5A38383D349949BC134B343DCE9933BB32BDFD3C53F5D03C0467B83DD5FAC43C73118CBD6D51823DD9F797BD9B80CCBC8D98B33DDF41953D01403EBD75C8DDBBE4B7103D5A98323D8E35A2BD261D82BC398C02BCDF919E3C6302C0BDE987A63DFDA87E3C1FE4EC3CFBE905BC73570B3D4222D73B666377BD7D3A503BACC58E3DA6C174BDED27E7BCF3130C3DE56B5A3D99FF923D7A75A13D70DB53BC4E3B593D6257B63C2B3A39BD33151FBDB3FCFE3BC0D5C33DED4EBBBBD6D781BC4166A53DCE338C3D25DB9EBB4D0A7C3D1E327F3CE4940E3C6BCC27BBBE182FBD45E06CBCEB6B123D752756BD72729F3D64DD03BD3F521CBD1B0018BDA05B863D7B7D22BC9B629FBD34BC63BCC624B63C07B4B43D0FEBE4BAA84156BD8FC3BD3C736BBB3AF63314BDEDB75E3D795A133DD81511BB0E5EE73B77ED9ABDCDF19ABD5928BE3C5E92533D8E9D953D4A51BEBCBEE8A9BD94CE4F3DEEDD923D822C0BBD964384BD3C53D83BAF62F23ABAA3983DB553333D2A94A23D293D1A3DB92592BCDD04633C7048873D31EE543DD0FE69BD945B88BDDE3E913D5CA77ABB36854BBDC5BAC43C70D0EABCDECC6A3D83D5913D3DDC7D3DA6FC36BDE844863DCB1C2EBDBE30C13D2184893DD89FB03D0BD65F3CAADE5ABD2F45223DAB9E8ABB7D9486BDB3F205B9FBC1A23C0674873D96A5653C6F9F60BDD289DEBC43370E3DFE62683B59ACCABC65EB86BB04B260BD4C89813D8FFBE4BDDD83BABD36D277BCA4C2B53CDB4E543DDC18373DFDFDF1BCB67725BD6D789D3C9E4057BDD25C4CBD467FD23C34B1A0BCD36B93BDB465A9BC547B0BBB267041BDAB4A963DF544B6BC6D65013DEDC4083C7B972DBDDA67913D5679EABC4DD470BDED3B81BD3AD345BD5EAA8D3D7244A4BBAD3C473D07DBB23D7718C0BC746D4DBD35A7C7BC51ABE5BC32CDCA3DD04031BCF8EDA9BD0B30A9BD54C324BDB66AEEBC9E6513BD8329A23D6789B53B7AB47B3D06963DBCEC539FBDD37D9A3DDC395FBCB194E1BCE0960F3C3BAC79BD171ADEBB99A2883C7C00C53D64F9C23D3620C43B8F41A23C1ED2AC3B0366E4BC4A8EC43D94E87FBC41C7253D5081C13D0D0B453D399917BDD3F669BDC5AA9CBC75540FBD18B5E7BC2FDEDE3CB768A43D09B5ADBBECCEC2BD564B8EBD4C80FB3CFDB76D3D3045A93D9915D9BC86C059BD1F081DBD1190AC3D317D823BA932743DB707243D239EA63CDD385E3DC3B485BC58321BBD17A811BCF3E31B3D3592613D4BCEAA3DF55442BD1620F63D6D0295BD0FF09ABD0C69573DEAB648BCD51F82BD6092BA3C06F18D3C908C423B0F06D13BF066103DB9BF99BD31CF413D2341583D92E6ED3DA8BB243C99971F3E99EB9DBD2692613C09AFB63CE112483DCFDA55BD06C019BDA4EC05BD8C88D93C37759D3DA770ADBD5B260FBDBF011CBD6E752D3D81E627BBDC6F3EBDDC2E96BC39DFA83C28D9813C4D2A89BD54592E3DD876863D274471BD0C19D23BE8FF463D3D2019BA31BD0ABCC044783DF0C485BD38EA353AF63A4FBD28405D3D4A979E3C031BAABDCA1C7EBDA70D8D3D434392BD222B79BD000A1D3CA0E2203DE66E9F3C1A6BD73C707B9EBD6370563DA41B493D7CB1173C76EC4F3D0D7CE8BC20CC1F3CB11C32BD1F67DABC70C67A3D9247DA3D4AF7D33D64C532BDBA08DDBD6E61403D0735133D8E2975BD67EC53BC6C2AB33DF895173D444D06BD07904B3D776EED3C8F074A3DBC5BF53B8404C53D2F3B5A3DE7D1693D174B5FBCFAE07FBC1A75633D57F10CBD86E76A3DCEF78DBDEA79853D133E7A3DB8F5823DBA5A5F3D7802E3BC124F193D7C9B473DC749F1BBF43687BCE4170C3D588465BD805989BD6405A73D1D56B83CEEEE593DD1F10E3DC19DCEBDEBDD9CBD4A8FDC3CCA989A3D18C020BCF73AF0BCAEE9B23C94F9D63CE91512BC52785F3D4CA2913A68B8473DFF55C13B0520A6BC32DB47BD3142B53D1638AEBC0478DEBB725BB43DEC0E73BD15A51D3DCD99B4BD35E0233DDA2357BD74EAF33BB546B73D97CBAABB067A49BD7B0246BDC9A7C0B9798F9B3CCD1187BDD7797D3D3C61653D6391EA3DFE490EBDE3F0DB3D84D81DBD8B8C1DBDEDB8D73C044B0D3CAA1A87BD7789EC3CEF434FBD5577353CAD4E1D3B54F1723DF8CF483CB89EB9BB3658943D170FA4BCACF7B93D5046503D6F14E33CEBEAA4BC8E990CBD0698A8BCBD85F93D8201A43CA3822DBDC55565BCF9FFADBD009187BD5E97973DB77B36BD7A4229BDDCF51C3D962C2FBDE05581BDEC4E743C03A3963D4C7EBA3CF8FD8E3D93B5383C30F6BFBCBABF043CD5E782BD1F788A3C1EE25ABDF6889DBCF09810BDF43FE43C8A9ED93D0C21AEBCE4D3E23B4EF93B3DD0EB4DBD4219C53D19B3D23D6C8E963D9F76F63BA053AB3BED2D413D6400463D16EDC83DF7BD973DB1AAE2BA5634D5BD5C00173D0DE198BDB67D5CBD5D6652BC026E5FBC5FDEEC3D468E0FBD4FBC473D4EDD633C92E3D93DBBB6AD3CBD7135BD1DA2B8BC37D494BD684970BD36C3B33D89E2983DC6E0AFBD503EA83D9AF8483DA866813D05771DBDEDA3A2BDF6F400BD6D9F6CBC6B60063D4ADC333D491735BD0E593E3D803A8FBCDDAC053C508D95BCABA136BDCB9A963C30726F3DA56E833B34A554BC02E131BBF42367BD6F6311BC9024F03C7AF6D33D746E893D92EC1DBDB3F0E13AFA7104BDAADB883CA1D30ABDEEDA92BCB6D683BD7BAD30BCA60974BDDEFCFDBC438F93BD814C503D507F00BD707FA0BD5B119E3D265AB8BC7BFC833DD6E42BBD2D888BBD30C8B1BCAB4EB43D841BE33D1FFC1BBDCB67E33D671AAB3C8EEC03BD7EB441BDA5618A3D2990F93CB78E80BDA0D1C33C6493F23CAAAB9D3CF4B302BD5DD8FD3C923FF83CA47A84BD741270BD56A551BD798B1A3D7C45BB3D5907F1BD56FA4D3D6CCB43BDEAA7A7BC74117D3D7BF2973DE9824E3D6B6885BD51CE00BD66A2633BB399903DFBF0013D5FEAB6BAC3D6423CD51CCD3B8AD713BDD929F5BC76C7F2BC4A831EBD0296ACBD649516BD4DE75FBDCA4B453BDD7789BD2D518CBDF298A03C27B61EBC8B75E43BE323E5BB413AB7BDFDCF6C3C3CF6373DE625E5BC93B7CB3D24C8FB3DB082E23D5055E8BCD0651A3D26252C3C0A9CD5BCB93CA43DBB4E133D21473C3DA5AA133D74A0063DDFA50E3D5D7765BDFAF4183DDB638B3D02B773BAA77464BCA4D8B23D2A704F3D718212BD051EDABA4ED38BBDC1FD3CBDFCE80CBDAB8E933D8F8DAE3DED64A53D2697783D2D3A723D63F38B3DFDA65A3D638D44BCF3A7743CB88B4EBC9E718BBD06749D3D9D9B313DDFD2663CD971BA3B302E84BDCFB5FABCA038893D34C5983C85BDC03DFDBD51BC631A33BC2D07763DD132663D1E19CC3CA636533C6D1600BD54CE703D037BA63C7E36953C64265DBD85EE10BD1AEA72BDAEFAA8BD1A25E53D5D6CED3BBACECF3DD11768BD7B55853D3673FDBB9C1E7B3DF3A4B13DB5E6423DDCAE89BC25AEB73AC96BB13D6CC8563CAAB13CBBFC7A3ABD0DF5D5BC8A998D3DAFC6003C2DAA0A3E51E5153DABB64DBD77F195BD9C09B6BC815C8ABD6102C4BD1341753BF1DC74BC5089B53BEBA691BC5841A3BD8FC8D23DC0E8EDBBEF47683D22D2473D96289BBC45AE5BBC8E8056BD8020103DCA8C14BD5F319D3D5A91833B5717B5BB5CD6A3BD8200D5BC985382BDEFDD263D05698B3D2ADEA43DCDACB03D22EB3DBDF17488BDC5CD4C3C0F12F4BC35F88DBDC074093D5C07DABDCFAF653D1993BDBCDD6F553D30D364BD0668B43C8793D13C7CE2B2BDE6D020BCE4CF873C9C6E92BD33F8783D84DF32BD7F5D4F3CFCABE73C1BFAE1BC0F49EF3CB5186ABDD032B3BC3BAA4A3D24752FBDEE785E3CC550453DCB744BBDE1FDB93C834B45BCE812613C256F3B3D5AB96C3DD7CF8FBC701A65BB1F01613DF126903DEAC99C3D20A5733CEED639BD40BAE7B927DEE83C482D78BC4563E8BCCE37A63D1E9C7CBC8A18863DC8E14F3DCA00043E6076B33CA4953DBD8B9BA1BD42F16B3DAF6DABBD3C01933D1DC495BDE881CCBC83AD1C3DED0A5EBCADC4E63BDF5D82BCBB8218BDB432A3BBE34A833DBD1D2EBCD778B63DC20D0B3DF98A85BD0F65243CBAB9EFBC2527A23D341EA0BDC188A5BCA00213BD1F1A853DB302983D175826BBF9D4A1BCB296783CC05B563DE108A8BC96D58DBD315273BD49740EBD67BC16BDDAAB0DBD0648D1BC97E045BD6493E33CDE683CBC018636BD6E41353DFAF7943D2E4AB8BAC1E0663DF3529C3DED5B543DBA44143D63913FBDCE0B97BC7A7D86BDA80F60BD4E20143BA6745F3DAE3CCA3D2D8438BC093EAEBD18E51BBCBC6F053C51BF8CBDD24681BD14561D3D1B54393D49D7993C1811623C5B4025BCFE88C93D1AAB8ABD69FC84BD00816DBDE9159F3C54E7823D249ECCBC09A42DBD179208BD51F78BBDDE8A193D0385853C5B53CCBB49E906BBF99E9E3DCE5C9D3DF6AE8BBD10FEA4BC35F1503D42717D3D3C3E7F3D339CB8BD46919F3CE55981BDBC44983C43C4743D09851DBD82422BBD2A54213D719B95BD4B31B43DF99E91BC450B27BD25B0443D513F4EBD40B10D3CB1BB5CBDF0B3D2BCBFB3913D25A729BDE09A4B3DE485373CB47BFC3BC5706D3CBBAC2BBDFF64DA3D45468C3D5A278BBD1164ADBC837FB03D8B53843D31A7AD3CA06659BDF13AAA3DAD5793BD6E0377BD29398FBB0E06003D1A971CBD8C800B3DE529893D0554313CDDDF233D9FD76CBB1D21843DC798DABDED668D3CA39490BDFE907C3AC26F8FBB5DD5013D56AC5DBCE98AEFBC46A16F3C03972D3CDB5338BD5B938F3C9FE1F1BCC814953D738D1EBDE8FC9EBD4E8E16BD44A74EBDBB1DDEBC92A0393D58B3323D33FDF73D8FC4DABCABE218BDC7BAD03C1BD3A8BC80A54B3D4665513BFF50913C5A9C11BD1D2300BC308B783D4B635BBC93B18B3D881ADA3CC36E013DA5C3C2BCE42E0B3DC77D26BDAD13883DB378D83D9E133D3DE393FEBC7B64AF3DF02854BD330F823D111E223C8F2778BDB04900BD10FF06BD908BB33C8CBFF23D1F7EE4BC704078BD7DA04FBD27B997BDA5291DBCE631CE3CF9CF69BD210796BCDFA40D3DA0D5B53B20708F3C0966E23DA610733DE7E231BD40CCC6BC2756C9BDD0499F3C81AF293C233510BD9A848B3D06A38F3D0E0DA63D350511BD3BB80FBD6F8883BDE71888BC838E1EBDD402A6BD65FD1BBDFB28043C91738EBD0E5A0DBD6DDD193CB234003D3D74F33CC869363D699263BD8F04893CE4CC80BDDA17A8BC3FA952BD5F8595BC8039413C401587BDDB593EBD57116CBD0B24AEBCE3A6933DB957163C75F52F3D7DE816BB6A5F183D5841023D4F99D7BCE00A5BBDF029AB3D527CA43C4B087C3DF468523CFD1E10BC8188EFBCB7791D3D7737A73DDFDC833C298944BCDA70073A13C8833B0E349A3D2065023D2BA0CB3C1307A93C9ABB94BC2EA27D3DA22185BD8DF85FBD548699BDDA5CBB3C91BB03BDCAA7FF3C33EAB5BDCE31663D64D1A8BD0877D0BC29F223BD97AEBBBC636CA13C005EA5BA0C96C33DD3EE383D4B38BD3AEFB60ABDCA62B6BD8FBA643DEC77443C5EA787BCAB2BBDBD13712ABDE212D73C2B4D97BCB18FE3BCEA3C573C15F88B3C098539BDD2FA24BD916C34BD4C7E113D1F15933DD9D721BDFFA6EABC87BFB63D85C3003D72C854BDB938B3BD1275373C6FE7343DF2FD14BD5E7E8F3DB75FA2BDC96DF83BE635873DBA02BB3C1A344D3DF78E9A3DCB7F65BD8ACE9FBDC7CE8D3D4D4993BD27A01FBDDD142B3C736ACCBCCEE5CA3C2B4D83BDC8F03DBD8099F23B0B7B9EBD19EC643C6CD099BD5B4390BDE91B0E3D0C7FDDBC369014BC04B3C1BCE965BBBD892508BDFD9B503DADD6673DA37C6F3B0249313D0DAE5E3DB83CA23D0F0B163CC6C7AF3D131BA83CB6E64CBDFA1107BD899C6DBD87848D3C29753DBD912F663D947776BDDFC493BC05845A3D978253BD1E7E9A3DAF49F9BBC488B0BC0F4BF8BCE04BA23DD8E331BD8B8482BD364C8F3C0F78253DEB1E68BD8F51653C1638903D91381CBD8975A23D5D9C873D15AB173BEB1192BDF2120C3DD4DE6BBD42BCA83D007456BCC2C7BFBC2BA608BD67957F3DCF83B6BC82CDEABCD8932FBDD4CFA5BDD7CB463D810B8EBCB6D26A3D9BAA60BBE3ADCCBCC3ED273D3E46AD3D9BF9DE3C8C0594BDFF68ABBC90FF38BD009AA8BC826C99BD2B21863C18849FBD23725FBDB7E255BD56A562BD844CB9BC2A8D4B3CBD43463D728758BDD79184BD7ED4603C8C6A863D4974B13CE17527BD44B352BCFB1C19BC3AE7023DF325EB3CAF93843BD443E93C86918C3D0A716A3D22EDB1BCCB72BBBDD910533CDB6FDA3BC3DAB4BCC397143D8383A93DF000AB3DE98CA73CD8DD083DFE091ABC0F69EC3C58F59CBDE4A389BC2F11233D46FD203D5B41D8BA017E25BD6C8A72BD09CF9DBD043FCFBC4182D6BC3ED6603C3EFA19BD4AAD7E39CCB41F3C00F7933DAC857EBD15CD1DBD519564BD7D8BADBD34ADB2BD7354903D6A7BDDBAD54087BDC78918BD3B121A3D10BAA0BDDDACE93C11E989BDEB43903D85363BBD5C33AF3CBEEB063DFF8470BD7BEE443D0541643D5041A53D8B2F94BD2551713D5D4BC03C95EB853D8872BBBC12FE8FBC15EE8F3B0631923DC92363BDAECC41BB75DDB03C61C25E3C7388283D2DB766BDBB7F78BDA12AB23D9A2B803D6B17FABBC78C9CBD0D3570BD89AC1CBDDD1DA13D01582C3DCACF83BC530BFBBD5A9D0F3D601599BD11AC9E3DED870B3D50315EBDD7A49D3B05CEE6BCBC272B3CD97BE13BB5E7A6BC8F4B353CB10CA23D3F87E7BCF889A43CEDAD06BD714FA33D4329CBBD0E801BBDDA7EA3BD7A2F9DBD332EABBCAC7DACBC298A99BD4E7CD53C10923E3DB708093DB0B1423DDB4F9DBD0178E8BC2FEC583DFB1274BC9E6F703DD86997BDA97F7DBDA30073BC4AB3D3BCA47D22BC5DFC89BDDA2114BC48CD68BD96B47BBBB55E1D3B85C2323D913D86BDE00B983D9AB8623DBAF1DD3CC4431CBD6942D03C22DB853C658702BDF4FB44BC434C383D21ABD33C32B729BD4EA24CBCBCA3B6BDACE44F3DE27B263D282E453C92C29BBDC8DB363D2F83163DDF7375BDE0AC583DBC5C5DBD04D6733D6C5E843D58C3513D0F7F633DE1F42D3D4D959EBD3A8B813D26E99FBD08902E3C19528D3D76AEB0BD480C8CBD24B4B43C41B647BDAF7F7FBCABF34D3D0C4A543D11A9683D91712FBDD18E7BBD0560593C2940E23C8D0098BCC860A23D8099ACBBEFD48B3D2767B9BD1611823C17E962BCF416B83D26988A3DC26DC8BC4A426F3D5C8568BDA58448BBB58251BD4F434FBD3620833D19EC783D256C05BD6FA48CBD49A566BDF7AA2C3DD009263D0E0B653A9B57613DD862093DAAFDAB3B2EC982BDB5B7833D2A33963D5B5A82BD1352763DF20B003D2492BB3C169B51BC5E4F27BD06F3973DC4BD313DAFAFE73B526DC7BD8B0147BD9285DBBC2ACB4F3DC117E4BCF4259CBD2CC0D53B0E25E33C811EACBD2308193D9868AC3D1CFE013DACC895BD5744A2BD4CB016BCD4EE6E3D953C3EBD99B3843D8653A9BDB77827BD30B880BD5981623DA57340BDA7A025BD1DD4A4BC7CB5033D3BD9713DCB803EBD7517C43CC31F86BDCD1E803D0019883C8531BABDB03994BDAF7C60BD652B113B6C1E843D56884B3C76DF4D3C9846703CFAAA62BC09224F3CB0B6113C361733BD44D1893DDDE2883C3312423D531E333C513F70BD48C04A3C4E5B8838492898BC883543BDF6B1F53C689B303C6C86353C1E1680BD2486B4BDDE2F25BDE907763D70FE423D86A1CEBCD2AD523BD8D28F3CF253203D56F164BAF575333D3872753DE65EEDBCDF753FBD869F5DBD104E143DC8A919BD98C2A5BD39F8153DB7ADD2BBEEC63D3C79F4673D6597C7BC9678B83C69501BBDCDE50D3D3A5AA63D11A68E3D2273A9BD9526F1BCB1203BBDD5902E3D4C0AADBD8C70AABDAB4E8DBBDC81553C902D2EBDA66B81BD4ACD35BD7A95E3BD62592ABD345E663D405F653CBE6527BCFF427BBDE2D171B9C303423D470707BDB3DB363C0FC73B3DCAC54D3D6B1549BC180789BCBE2D823D8B458C3D8C9C53BB647BD23C0A287B3B823BD6BC84BE8F3DA6A112BC2702533CCF40A2BDF52183BB1AC64D3D252A4FBDFB9A13BD054EB3BC278F00BC53F99E3D459BA83CD50CBCBD629861BD46D99BBDF9BB8ABBB42A06BD4AB69D3C9EAE72BCE0F28A3DC47586BD42D5803D13FBD23CDA9DA73DA5315B3D4B7A16BCCEDF053DB221EF3BD67446BDBC03803D6C61803BAC5D793DCB7BA1BC8DE9CDBCFA89593D16DE85BCF7D4F43C0F2F3E3DBED194BB54781FBDAF82AB3DB7D81F3DFB2DCF3BAADC6FBBC651F43CB3B57E3DC5B8A73D3CC9B8BD8E08FBBC0A83B1BDA426A73CE4473CBC776C23BD3F130CBD6D82133D3986E43C16B69CBDB153243D0735083BBA9B043D6943453DEE46F0BB1385C63BC46AFE3CF17CA8BD7327233D6C985A3D9AAC1D3D1AE3843DAB70543D9C0DFDBC0DC6493D051628BD310A113D0986AB3C8C1D9DBB20FF9C3D8C280E3B32829CBD133B65BDF256513CC1ED7B3DE1DAE7BCA3C9323DDAA3B73CC22E883D739D5C3D2D68843C9FA2293C484336BD52E2663BF8994ABD30D317BD592C87BD14219ABC82DF8EBBE899A3BC92F537BD665992BC6B9CCA3C19B981BC6FB296BDF3E1EABCFD602E3CE734A03B61B813BD95E9923DE55E1F3C670E0EBDE00472BC7344873DE2119B3CBC1A5BBC6D8CA6BB76642EBD201095BDD8282CBD8F598FBC164A4D3D7C859E3B481B9F3D304350BD45FAD4BC8C6EBC3B53D38D3DF7622DBD69D59E3CC6FF693D0129953D8C73FC3C7A1B9A3D407D163DF7F964BCD3E3803DFDFA073C3F85CF3D88AA13BD3036A0BCB8B682BD56F749BD55C4A73CB5DD37BB506055BD4E124A3D486E1CBC389CA7BCE77DD2BC701EA63DEBE5333DAD9BE33C1F1E4DBD1DF9C6BA3AAA2DBDA00E27BD48B2EB3CF206043D87C12B3CD7AFC03BFB329D3CF1088ABCFD187DBD886E9A3CA1F2FB3C1ADE7EBDE21236BDB1E49ABD597186BC4AAE98BD0FF6933D62C21ABDE445A73C26564A3C94F8743D52C5143D8FA6A43D79040BBBF785123D9C696DBD3CB9033D78D88F3DEEE58BBD988BF0BC7D26A23D0601973CC35096BD4AC3963D81249FBD0174C8BC9B473D3DC7A793BD6D869BBCC52A113CCFCE76BD1715B6BDE29E4D3CC8194D3DCCFE34BD45B17DBD21A2333D280CC4BCC09F6E3DE777CDBC72E493BD845048BD25EDEDBA2ECEAB3DC550F9BC4C56843D28D667BD501C80BC999A823D6B7C8ABD51EE17BDBAF485BD7CD9283D7261873D1BF8EE3C0EEE0E3D82B2613DAB119B3D3431EB3CE03D25BD2387F8BC53C52FBD571D8B3DC37896BD95EB943D29C0A8BD6DB8383D976739BDC56A37BD124F64BDDA9AC63C6329423D9D149B3D1E2E003D3E31023DADEC713D2AFC1A3DCF4E67BC5953093D500B0F3DB051023DF6AB6F3D25A3B1BC05A27E3DCFE4783D0B31273D2D33323CF6FDA63C496827BDA089503DB6979DBD6E65693D4105063CFF9F59BD472D5F3D9B40433D62DE053D1072803D8B5D0DBC5C34893D5EC863BC0FDD65BDE1910CBDD6E242BD4957143D887E99BC6CA942BC2053AABCF40650BD4CC80F3C2092AFBB96FD4ABCD4A73D3D0982313C4CCA1FBDA5D8543AC6933EBC5217AF3D5DE7A1BD87E289BDBFC594BD8ED6A13D400AD93C81CE4B3DFAE211BDCC9146BC556A443D3838063BFBD0113CCAA3863BC80D85BCC8EA6DBCB5634F3D88058EBDFCF3EB3C5A489C3D83A59ABD40BDF0BCD41B5E3C29D45C3D280ADCBCACF4A5BCC2369E3C1896173D3EC4AB3D8FB80FBDCE04863B13AC953DC949733D9111883DCACFE5BCE257113D6ADE123C50888F3B4056BCBCF8F1003DCF04863DE94FEFBC15AEA23D459998BD48EE2EBDBFDE7EBDE595E43ACDD7943D4BE7843B8FD8F33B3BBC64BDE0F02FBD0DC3803DA24E503DC7A87A3DBCEFA9BC22858D3D1F76A0BD369ED13ADA179A3C2F4E4EBD42B7D9BC645187BCB5FAD83C77DB353DA1B650BD444677BC4F37EE3C998A593CD507C93CCD6F943BF70E4ABD928678BCCD9284BDD058A43C92B99E3D9D9297BD11000B3DFF0CF73BB06386BD36DE75BD4D2244BC3BD1853CDB3016BCBA929BBCF32FC5BB7998F73B018445BD0D9072BD74C9DBBC25645EBAE814A43B89051FBDC0E83CBDC02A80BD608233BD77ED24BDA050A5BC11FF9ABB67CB653D4426943C589D403C0D532A3D133DA2BD42AE9DBDC1DF8EBC3B795CBC4D2CCBBCDD8970BD85C4A1BD00F89CBDAF9D79BD06955DBD795AA63DB1018EBDD88CD53C60031FBD6E182F3D116FDBBB4F7B103CE4E7333C663E81BD2CF6CCBB961675BD7E17C53C70BB5B3D4F7C973C2F56B53CE90543BDFD2FA1BBF6E51CBB452D97BDAB2820BC422581BDAEB680BD5B29A5BDF78DE2BCA3E68EBD64966ABCAF66A53DE89B29BDFAF87D3D2F9738BD28F70F3DEEE585BD9172693C3264F3BCB24486BDDDC89C3DD4DC903D511072BDE9CA94BD2DD2303DE2EE503C545F3E3D84ED57BD8DA3A03D15278C3DE7FD1B3D70145C3D61D53B3CEB582D3C7D14D6BC4C659ABC203B8FBD815F513CDCA856BDDCDB43BDD303EFBC675409BDDE093ABDE3189D3AB2BA7E3D697C7E3D49D251BD540005BD9E8FAB3C1F7193BD707BB93CF5772D3DCDA213BD3CCC5ABBFFF228BCD2435BBDBC1D44BD3CE4203D9CD329BD4739013D2E4A2EBC6FB384BD7E7B243C5D9CA5BD8B35563D4DB634BDCBDF2BBDAAA43B3D6CE89DBDC3C99E3D5B4A343DBD44033CB99463BD2A940FBDCB278D3DA08B8ABDC054F43B7F5CB53C1F089E3CD253613DB17594BDD219463DC87E143D415B09BD218711BDA22D833D7263423DA7729A3DE6AF643D2F7A573C1E6C85BD32AF92BDF1A5F63C09D242BD76B451BC8C953F3D8CC5FD3CF892D6BC414077BB6023AB3CCA5108BD66B5A5BDB5BAF23A764056BD79AA243C337849BDC64B5CBD9E363CBD1CB346BDB5B6383D5DFDE0BC7245193CE8812BBC64E245BD71D27ABBA91F0CBDA9F982BD10B263BDAAEBCCBB135E983D604AD3BC433A96BDD62BC0BCCE7570BD22B88CBD8CA391BD42AE683D3D3A21BC44659CBDDFDB1DBC55471E3D6812993C85B7883CDAB1DA3C2ABE833D1F485E3D33F7A93C6BDF06BD82DA49BA9AFE1D3D5A9E2CBC91F3E5BC06B595BD8E688ABD27F862BD95DA833D9A4065BDE5B96DBD09A69DBD0229B7BC6BAF6CBD6A74AD3C1BA79EBD94E78BBDEB5A3BBD3D84883DB0D3A1BDDA2F9DBDEC689ABDECFD6EBDE4D824BD8346463D9C5F213D645B973DE4B14F3DB8691E3DE939733D08AA713D2CDC233D861E2ABDC24A083DB1DD0ABCE0BD15BDD4AF21BD76238CBC4DBA27BDD239863D68AA723DF0700A3C5B91C9BCF03810BDC5C6CABC0BED083D4481113C14AFA43D5DB22ABD0B2E86BDEEA7143D08747E3DECE062BD256683BCC3A75EBDF82F72BD86C24EBD878DC53C8D72D0BBB93390BDCC66C03CC1BA093D26AA913DC885743D77B0A9BCBC6D8B3DB0E8A3BDF2E7443DD69358BD49DF353C1DE84D3B680F553D850D24BD3C4A3A3CA615663DFE557CBD73E93A3CDC9718BDA7A7D53CA62791BC5DD5E2BC8EFEBDBB57BA2D3CA3CA69BDCDD99BBDDE43593D82FECCBB524F52BD451B783D10F33A3D9401933D0F6FE4BCE1C45FBC314F833D30F1B43BF345FA3C59E5B53C9754FABC9DE24FBD6CDAE33CB59C06BD0CDA993D9151263DD98138BD719B553D794E2A3C24654CBCE1F71DBDE766F0BC9D1482BD53A9373D5DAF383DFA9A953D62368BBCFA30993D869F9C3DCB1930BD0AAFEBBC431D733C09F3A13DCCAE253C8E8918BD0D2F373D991E07BDF0F5043DF5D4813D895411BD495DA1BD7802A5BD798B453D9D3E36BD60F450BA908209BC2DC5A5BDC440A0BD3DC88E3D80EE5A3D7766053D0F328F3D3C6CC03C87EE8D3D17004DB9612B15BDF424DB3C4F4AEA3CFA21F23CCBF4F53C706F0FBD36A686BD6C6E15BDD5DA983DDC0CA73C47ADD93C30F4723D1EA1F63CE8F2A5BCB5995ABDD29B34BD51770D3D8560DCBC2D3F503DB9BEA2BBC541D33C52E213BDB7373B3D4C1323BD1F27643BA0E9433D13EE9DBCE9DC79BDF5049DBDEA6A4A3DA5D7A5BD2F74A2BDD9C4A53DBAC511BCD96E74BD5FB88BBDA4A30D3AD1318F3DCE8C93BD1D0430BDCC2669BD0B7DBD3C1A17913D7DF260BD13CB523D1A8F56BDFABCD1BC8E9E913D720AD3BC226A2A3CAA1827BC282AA2BD3D2BA2BDCF0552BDD53C7EBDBEA377BD0D4235BDD4A67FBD8AC795BD6C2E3ABCBC5A60BDAB21FCBB3983383D81011ABDCBC4A4BD0FDE44BD4C599C3C061F1D3D76EAEEBC293AA23DF4A351BDE1DF79BDE044CE3B6D44843DC294493DE5B780BD924330BDFD2A863D94F264BDDCAD913C27E393BD4081863BA0DD18BBF2897E3DD00B143DE0DFF33B4F0E27BD20EB4C3B63E923BD1EC4ADBC6047CBBCA854DDBC8161A43D6BAF89BD1002893B4002493C28315D3C258833BD522B6DBD108B823B7E6E5B3D243C073D40ABC93A708B6E3C506DA7BBD89D903C9CFF103D20BAAB3C44F4D03C56EB413DE7AE3FBD00D621BAA77EA2BD5A5E523DF5B700BD68BCDF3C20499CBDA79BA53D004C6639BF6511BDC01DE8BA7C87B03CA66E423D42290E3D805A81BC103AFE3CB6107A3D7A7D693D205240BC56F3363D78FE263CF680A0BDA8EA423C3064093C10268CBCAFBD3BBD302B1EBC7031D43B10E764BD6E3D0D3DC5BC833DAD14933DEB403FBD001D93391A2A8CBDB6D6063DDB712BBDD682613DD4FDA7BC80D24BBD4AFC6C3DBC8D123D748D6BBDC246353D785740BCFEC63B3D08BAC23C82597EBDC50B92BD78406F3C0053113AA220753DB04841BC54309F3C491203BDC3C13FBDE35231BD5B370BBD4265F8BCA80C5F3C0BE8933DF9E0903D3800953C6035E93C0ECE063D1836063C0071443BE065ACBC80D9593BEE2F443DE5F69EBD8AAD33BD64C7973C704FE23C58198EBC70A0BB3B9C9C843CEE577E3D251B973DC4D5FABC2B7047BD642D85BC3848E43C0E7EB1BC071366BDD7F295BD05D4903D759B9D3DDDAF2BBD551D953DA0491DBDFBD1A53D34768F3C78E064BDB09A223D5064F3BC6DED853DD5E8803DF66C4D3D9E89723D80AF943B0B7D9B3D647BB33C646E04BD86D0DFBCFC0AE7BCC08211BCA487283D50B1423C0A5CB3BCC86319BD2E28583D888655BC58951BBCD1228FBDE0BCB93C7046E83B62A3613D201D31BC601645BB04FBEE3C2CDB38BDA088323B02C5743D576705BD76FB723D80072FBB805F91BCCA40E2BC358525BD1AD0C7BC302A743CBA2D84BD1BC71DBDEBCB953D28953D3CF492243D406205BD107DDF3B18031CBD8C9E92BDEA1C3A3DDFF9923DFD1D9F3D22057BBD76AF5D3D182E04BC9A6E463DA6B2A5BD43691ABDC0D5683C7FD7A53D7BA3A13D52E54B3DDAC10BBD1811043DA4A69C3C8670A5BD6825633C00E77ABD1090C73BB03DE9BCAD59883DF8E8043DBA925DBD40C7DC3A0057243CB878A2BD5AC3703D6ACF233D1A409ABCC94D953D62AB1C3DC63E6D3DC070B0BB808CC73BDAC6233DEEEA673D13183BBD344595BD2C93B73CB62665BDB0CCAB3B60C21DBB9A6105BD2068483B613C67BD7087943CB829F33CA4789FBDD0E11A3D48F20F3DF87BB23C94B02FBD4AD7333DA6D187BDCE4E4DBDC6126FBD6DA98E3D6BFE873DBDF722BD9FE099BD50C266BC6657623D76903D3DC06AA6BC097AA53D785564BD6898A43C4013EDBC5BF09A3D08FFBC3CE025683B60E0E83B1C600A3DBF3199BD1044B43C743966BD168C493D4C72143D14D90D3DA0A7673BAD19923D9F35A0BD8D4E95BD7045593C249A1B3DA25A2ABD50018ABC14CA8BBCBE70403D5492D0BCB67F37BD28803EBDD06AE5BB9A7B433DAA94473D80308B3CA610333DA8C59DBDFA34CABC08A14DBDBFAD8F3D0020CA38EDB069BD7CE33FBD870B71BDD39B51BD4065B43A7426FA3CF8DCC13CC36E823DAC2095BDBF44A43D80E6B3BCCE61E2BC135F83BD30D1103CAE619ABD7455213DE3E054BDAEEC733D020755BD988656BCC4E9CDBC7FBD9E3DA5E1A33DCA94343DA8DA663CF6E0363DE71C34BDF6E58FBD521EF8BC23486ABD709F93BBA050C83B8626E4BCB8AB6E3CC3469F3D588299BCCCF296BCF01758BC2069F43B0F56863D6FEA9ABDA0C3D7BCB211473D987DB83C44ED81BC785F9E3C5E7BC8BC90470F3D26BC3C3D303C86BB49DA4BBDA091783B4AFC60BD408953BC303CE33C4D7DA43DCC8E85BC3022D7BBC8EBA43CF442AC3C824095BDD583843D35C1983D3AE6203DAEF7553D80218A3B68839E3C504C90BD3226443D44312A3D173A20BD474814BD78E8133D98E15DBC880B10BCB42780BCFF691EBD0045C83AF0F6963CD679143DF8CB2E3C0686173D9E89AEBC2E8287BDAA6E633D1795923D6FE98B3DE0E16EBB7CBA063D2EC57D3D28BA68BC2E2D013DE06E0DBBA855ECBCE9289A3D65E65A3C11CE5CBD0817943D828A93BB3250B63B95841FBD8BED683B3B124B3DDE1B04BD885594BD6BBE423DC2815FBC097A3A3C3FA8A83B05CE86BD807343BADF90EDBA69AC993D37E76C3DCE548E3D3C0BAFBC91467A3DB2EE69BD0BB1143DFADC88BD82DE973D7B96983DCACCB8BC2533CCBCF4F6383DEAEB8F3D6D8335BD6CB2953D47B4713D2C7B413C8CAF0D3D42ED2FBDCE5573BC53BEB1BC14C7BD3C750986BC9C48233B2B38913C5DFE623D560FA0BC29B4483C6C599C3D50E85F3DC4D6E5BB2E859E3D9EA8D53B644F5ABDC47E1DBCE0E946BD8CB793BCAE606BBCF7C510BD1B8C7CBD6D54C0BC317F3F3D0B495A3DC5CA123DDFB78EBDEB41F43C70B0A7BC66631B3AA9A327BC5D11883D1E280CBD9CF678BD920186BD27628EBD5CD88A3DF4AB003DF95B4EBD152FC0BC0644F6BC8901893D5FDF0ABB4C0234BDBD2DDBBBAB49CDBCB7FDBDBCEC806DBD3CD928BDA8147D3D389C0C3DACFF87BD726D03BD0BCA2D3D105A8D3DDB4A363DB85D8C3D26A75D3C8284973DBA4B343DDECA32BDBE5826BD7E30AABCF4FB90BDC5B701BDDD2B9B3D34C268BC43AD133D3F9DB03C0BC8D0BA96069ABB6D1E9BBD4917DCBBBABB8F3D9D4D8EBD6842C2BC20AF7ABBF09900BD46DE00BC0272F9BC80FF99BD55AB263D12CB583DF63D253D52FE313D83C6923C648744BD1A768C3D02309DBCCFFFA3BD00AA52BD286A743DB6039CBD54B2373CFD0589BD241910BD5926F33CB0BFCC3C96EF34BDFF383EBDDF2869BC0A8721BC9A3A3EBC177C7C3DD9259ABCAE987E3DEDE3E03C3CFDCD3C7DCF753D53A9573D21A63ABDBEE96C3D81081BBD8DED35BD8DD291BDCF112F3D3BAC76BDE45E583DE5F63EBD4127853D9100823DB5296E3C0D7DA33D701FA33D15A296BD1A569A3C8236E7BB563F8DBDC9CF64BDF1447A3D6311213D7ECE443CBFBD7E3D1450E7BAF26B683D14426EBDA5C13B3D4E2C67BDA9946A3B63EB79BDDAD88DBD664BA1BD6A97353C288F71BD80E383BCB53184BDBD64D2BCB38B7ABC7F4886BDDC908FBDF23E733D0DBBE5BC76A681BD434F9C3C6F4E89BDC98A66BDCC6F663CB1B0933D78A6273DF56B873D2007343CA57557BD8FFA403CA18FA4BB42D88ABD3BAF103D04139E3D914A103D9A0A633D9D71893DCA909FBD8BC04DBDA536A2BD1CF7003DDF05723DFA47A4BD14A370BD3B343B3CE432E7BC25B3C13C5266AD3BC6FB9A3D1179123D7C1E4C3DEB1E26BDCF0248BD5A138E3DB0601039BCA968BDEF7243BD0E754EBDA2567DBCB8653E3CF2B1113D4B1E1E3D363C80BDE70F50BB702612BDAFB6A1BC31CC08BDFD718B3D0620023DA39FD33B60E7093BB12118BD1197083D13E03D3D503C7B3CAA54C23CE6CE403D3C8A9BBDBC70CBBC8CA4603C25F3BEBC2613283D91BDD3BCBC2B323CC337FA3B4B685B3D11E6493D4E43833D002C633DFFC1A53D54CD4DBD4C0B84BDC62A853D6A5B2D3D985AA63DE687103DB857543D07A8AC3DEEEE6B3DBE5684BD002E993DFD8A89BD170962BD672BE73CA971863DC8DF47BDD09E963D4FE5C1BC5C555E3C723D3C3DEA16A9BDEB19603D3566863DE2FE7DBD342A88BDB1A03A3DA04A39BDA38F903DB76D00BC30A2B13D15732FBD6ECE6BBD2EE28DBD4C1D2A3D35224A3D1CCF6DBD6790E6BB9538D3BCA6E391BDD3224C3C6FFB063DC7CD9D3DC2665F3C0F65733D8747953D3900423CD03E413DD111693DC422133D7B4F68BDA108153DD42FBC3C31A9753D0B4A473DEAD7223C2CE18E3D193222BDC1BB3A3D20DA92BD268A7ABC34F8BF3CC8CBB5BCE56101BD11B7893D63EBC2BCB1FA6BBCFD03A33C84890E3DC3793DBC7E2599BD8CCF6EBD7DEF843DE07005BBC648563A788F3E3DD312C3BDB6B6173D09BD253D30C49D3D32EBC63C5D11ADBD3002D83BBE4976BDE79655BD50B739BDDE07623D538F693DD4E9A63CEFCF8BBD2D1752BD623F75BD32E0C6B916C29FBD819A51BDE19EEABCC7D0CBBCED8C4A3D35AE80BD10C7903DC8F60D3D835388BC2D1568BD134869BCB867743D1316E0385AF419BCE0907EBDD9165B3D8D5B9C3D7D0D11BD59B477BDDA1892BDC9B059BDBE0D0E3D1FBB54BDFACECA3CB58D953DD4EC7DBD7E7E54BD9EB9DFBCC5ED1EBD95F61E3DBEB1503DACF468BDCDA995BD216F343C3C300CBC9D2D88BC830A9A3DAB6EE43C294B993C3F12E3BAE74D4D3D5966873C01E8C63B7A324A3DDFE5B33B944302BDCF7E9BBCD623813D004DC23B7960223D5831553DF8E7843DB8B8933D85C8173D513B98BD33CC0FBCC50B0B3D90B1F63B0ECC39BC542D61BB60FEFBBB76D1493DC46C28BD827954BD8B0B41BC3466313DE1DE1DBD080411BDB51F1C3DC3C7723CFA878CBD8D0DACBCED0D5E3DCB294BBC8E07A1BD517785BDCC7011BD9526903D5B9630BD0047FABC0B3DA5BC6AAB0F3D4E80583C0714ACBDF04662BB8941033D77D257BD3764C33C3FFF8CBB6555FFBCE177C4BC030F6C3D2659ABBD4443A73CA4B324BCC6B3603D313252BD63EA963C6883893D791D80BD4DEFF7BC01CF3D3C6268683D36EE80BD8CC93EBD2ABB4EBC97205BBB55C0103CAAEA593D4243913DF530A3BDE5CF9EBD2A49DDBBBCBEBA3C953B2DBC2AC1353D21BD98BD1098DDBCC8EC28BCA9C91C3CBC2DA4BB40411D3DE1D858BDFE808EBDF9ABBFBC46A27BBB69C63BBC1E178C3DA25CAC3C1B5D8B3D1BD1F7BAD55D05BD775B953D3E0A37BD5E2756BABBE3913DFCC4DB3CD45D54BDEC7FAABC66219CBD1591823D2DBA05BD0F7230BC9FF687BDF6E96E3C7B9D91B9EBBA55BD73F9183CB6039E3D9A9B883D6A120BBD79DE57BC601E353DEB1AC03C50E573BD6176763D23AB513D2AC6F63A77D89F3C094ABABB7045EEBCF89B85BC9B3DA63DD4138CBDF88CC9BC9CA7F73C6C8B213D1466C0BB870E1DBD7E36023D7C69A03DDE40DF3C9CEFA33C10BB24BCD5F1943DF795803D82B0083DBFFBA33CF558ADBC3105553A44AF6C3C4885FB3C9FA3903DDBA288BB3E66D83A8DEB0ABD3E95903D73E507BC6EAC38BD8AFCA3BD29BFBEBA2060763C39C917BD3D67CBBC20E4963B16EB9D3D002337BD977623BD209E50BD5FDF4D3DC1639CBD75ACEA3D3148833DC02D0CBD4B20893CA4B395BDF99B943A4412493DF33A55BD2E8F4C3DCA6416BD094B18BB18507C3D5ECC8E3DB0ADB53D98B6EBBC60399DBDE2538EBD8227863CCBD405BCB889463DAE4D6F3C77DB04BD4BAF033DD538D2BCD2E4F6BA670418BCBEF166BD6C2C473D6C8CA93C3833523D3E5B28BB748872BC7C04073DB12A893DD69F01BDD8978E3BB9FE2ABC809ED43CCDB0993C67924BBD1A6151BABF8E88BC3753BBBBD2EC64BCEEB030BC35CA60BD226621BD5BE2D53C24A4213C5981213BB2AFB8BDC957943D2D36A93DFE719B3C48748BBD4A4BB8BCB8ED413D5AED4DBDF70E833D0B0FCABC15D0AF3CF11486BC437748BD3C39BF3C714134BC9FDB5DBA1D8A23BC9841BF3CE59BA2BB770EA33D2A8EDD3B03C7F93C584AFB3CCAE7903D42BA17BD21A899BCE3C64ABD10F9A9BDC530F23C1D0723BDCBBA26BDDE0D81BC26CEAF3CCEAE373DC5A6233D4CB2E13C1B02893D565C28BDF1C44C3D5387863DD65967BDF43156BD75C2FF3C9866C1BC043E4ABDBACD283D6B177D3DB623623CA5ED5CBD7E1C763D7F90493DB67F64BD9177A8BC4BF64EBB25E79B3C632C0ABC7A4251BD203FE5BC4D640F3DCDC1A43D9FABFF3B4BDA80BD4D3D9ABBFF44D2BA70E9F4BD67910EBDA6AE773D923A3DBDC274063D8390133D12933D3DFD1A04BD91D15A3D345291BAE1D394BD050558BDE601E83C4460C6BCBD458F3CB36957BD7BD681BDFB0D6DBD84E84C3D461717BD566BBABB5390B63AFD1A50BDABCA3F3CC7330CBDF46ECABC570F87BD64B8B3BBF8D9AC3DD9EF923D4D113F3DD8AFCCBD59713FBDC60E31BDCA9F553C5106F1BC88E4E73A8EB2D1BBD163893D6B98263D94922E3D624261BC4E79693D9C48E53C180297BDE54988BD422C8FBC1029063D3801A83D729BC0BD48BF94BD7675DFBB3E4A0EBC65BAB33C093E34BD848D793D032EEBBC3DE50BBDF6E6503D5C500D3DC8D6943D52FD413DA46A913D3FA31DBDEDFFAB3BD5016F3C6BDC54BC3F7F8BBD067E6C3DF7E072BD745188BDE2155FBD8B9B90BBCDD8E43B102E6EBCA1ABA53DB024043DFFEC8DBDADDB283DF70CB2BDAA8A95BD4F4EAB3CC4D457BD57DEE2BC189E6A3D48A38EBC917197BB514AF9BB204E8DBCEE5DE13BEB6CC33D366718BDDA4CDA3CA7172E3C93463BBDDFEE253D515B483CB7C1CCBCE2733E3D58880A3D9797DF3D91078CBDA79263BDA089AA3D72820E3B47FAB73CCEED3A3CCF97243CBE235E3D3CD65E3C362947BD6A16AA3CADBD3B3D6A42AC3D7F82933D40F605BDADB89C3D8A572ABD3F5D5C3BAF5A4EBD7CD09BBDFDC086BA6EFE883C3B5C5D3C7AF881BDFB0086BC3643033D193E8F3D6001E0BBC49637BCA2202E3DD39E873D3C228D3D3BC473BCE752FEBCA565E33C7B03AEBBF84843BD1C060BBCF9ACF9BDF258BA3BF2059EBDB919D63D29512CBDCCCF163DC7F858BC1D0503BD38E153BC3894013A5E0DCB3B2666343CA7FEC5BC54DD22BDD3098F3DD00B483D12E2A5BC683D47BC82E765BDE617DD3BCA19973C176DBB3C3FC6ED3A2888423D77E3973C56F8873DC598B83CEE0912BD4D95903DA176C63C69A2863D44E24CBD0A78793DB0FD533D9AC521BD989B75BC7D07C33CBB18CD3D8CC451BCF8E932BD203F95BCE7C594BDC30193BD96F9B7BC20B8BE3CF62193BD0D98C6BB4A1D3CBD815CB2BD432219BDEBCEC73C1980053DFDD79A3D61D224BC435EA4BD1839DF3CB0EA98BD4394C33C02C58A3C7EB174BD09657A3D148F833DCC2281BD581F8B3DF74A633C947D253DC11664BD8CEDB63D610137BD9E1274BD6EBAA3BD1C90B83C0FD1263D257C9F3CE5D373BC86FE0EBDE00823BC668A57BABBF905BD53B7843D17366BBC67EB08BCA721613D8DE4E0BC94A4A9BC896145BDA85E363D4D4589BD1D4F4ABDA3557C3D82E1183C9AFB38BD5FC28DBC5DADA83DB6A7033D7F5719BD43661FBCB78E27BD31C42B3D3121B5BC9E798F3DF2EE1C3C0FB06FBD46E0A73B0BEEA83DD3D6F03C77AFB53CBE5054BD8D944FBD83D9BF3CA35B823D864FB1BC288B193D840FB83BA3C836BD4CF35E3D1FE4023D9B371C3DF135C73C59EA373D42C36B3BB18188BD0BF0EDBC2FCA8FBCD617CABCBBD02B3D978C6D3C6E312A3DB0C893BDB0FC40BC037C0BBD6BB72D3D8B27413DF6A984BB0B8BAF3D971742BD2EA094BC06192FBC1BDDD33CE9A3A23DD448A0BDCC2610BCA3F77ABD3F4E363D79D6433CC328A43CBEB45D3DA158C3BC42A5EABC51E000BCBEB493BD662600BC087964BD0A69F7BC688425BDABB77B3D50D5B23D84962CBD7B2989BD2B98273DEEDC353DB82D9F3B46A0DD3C92B06EBB726B043C0CB0093D762D9D3D5B39833D442A20BCB275513BDBE453BD1480653B5828643D3E77583D46561F3D21AE9FBDADC344BDC150613DAE3A363D3A86523DDA22013D68A9BABDBC77A8BDE71914BC660A01BDAC0C343CDDA8D3BBC2598B3D3511993D579F893DC953EA3C7D9311BD48D7A53D9A37EA3B254C29BD3C2A50BDF8EE2D3DA1EBD2BC0BD7353DD9DA5F3CEE36A53D3982D6BB6D8097BCF4FBAB3DED78803D7CE0203D94500F3CE40FC63DC8090FBD941987BD93A6C73CD307AEBC0A635D3DB87F13B7FE29143DAACB6B3DCBC029BD03AF0ABDE80EACBDA6A714BD7B0373BB2EBCB9BC6AB8273CB722D13C872895BDB6BADDBCFB16EB3D61D28A3A6E14F6BC486B06BD2FC5FBBC370790BCEEB833BD166B173DCF4031BA2721343D0EF0AEBC7A028C3D63EE61BD88069CBBF54615BD551F3E3C8863013BBC77653C3948C03C1435B6BDC8569E3D7AD5143D43185BBDAC4E9A3CB89B6C3D54BDE13D201EF43DF388383C2D4E79BC6B7539BD591BB3BDC3CB8DBD1145863D6870A5BB454B333C6F4FECBC87639BBDD69CEFBC28DB173D15A1213D1B21693C2965AF3C1289B0BD62FF34BCD2359A3D54FB8FBC152CA63C3D48013CFB837C3B2D35813D925886BD8E38E23CF49CD2BB27BDB23C6E2A143D7E7E3CBD40EA4E3DE73D9FBC587E873D675630BCFA4BEC3B9EA63F3DA623D2BC10078BBD074F9A3D8CA05F3D0A05C63C83B9113DC2C6093D9F83E0BC852D353DD954C83C484A65BD1A16253DA4F152BDF45957BDC8111CBD7916E43BE12B00BD7A12353C809A993DDAFFB93D42FA13BDCF41E4BD9CCACFBCC86CDD3D7F01C73CF43EB33D382203BC259D8DBD723B233D2FBDF23CB320213C63C696BCBAD7BA3DE690D4BB83D74EBDB04EF1BCDF9B96BD5728A93DE57F4AB986AAC5BC0DEC3D3D465EFC3B80C78CBDF28C5D3D979D843D8BB040BD9D99083DCB2EEA3CD42CAB3D999F80BDF048A03D1C9EC8BCCC6FA73B6FAA92BDDCFBEB3B1F5CF5BCD288013CE73B443D6539463DBA969B3D889CD53D1765463D4B22E4BC82B07E3DA2675F3DC2A04A3DDC38703CAF13A3BBE4EB4CBD29CC093DC76B0FBD6871123DC72865BD099381BB26808B3DB303613DF6FAEBBC68DDA9BCC1987FBCB321D4BC53FF1BBD5FB55DBD10E0A2BDF09BA1BCEA5C94BC489CA8BD86939BBD95A339BD2C1B28BD63AD3F3CD3EBBB3BED4C78BA4E49103DE071DD3B5C9F613DA3F2613D6839B8BD3BEFBCBDCCDB1ABC206E373D10A620BD6911693C54D163BD2D314C3D28BA623C17D6D63DD382AB3D4C757C3DFCCC07BC3DFE6D3C5308393DEDC284BAB881553D08BBF43CE63C9D3D4C57CC3C1C301D3D7591FE3CD37C93BD74CA72BCD2C1613DB88101BD4C7B8FBD72E32CBC176C38BC0851B1BC1B8203BC610F773D3B4C863DA6502ABDAD31A8BDA955683CF209F83CCCCC643D57361BBDAEC2A4BBA01452BDB7D4913CC192213D8BB7423D4153A23D03582DBD5A957D3D5BCCAF3C44DC67BD1EA5933D5AD3D0BC3627DCBC13725DBCE2F91C3C13B48CBDD39BD23C4EE37BBDA9B0763DCDB9D9BC284EA0BD30BC163DC2A64E3CD1C4F23B4798413D3444903D3BE0EFBC156C473D26EA343DFAD031BDDDC43DBCA24521BD6A73503D7584393C398AA4BDA6EE273DDA219D3D3ED3073D34F0E73C68AA8CBDA3123F3DB858A03D06B7623D4B7F34BC1B9752BD1D28C8BD8CFD1F3DC982D83DAB4F353DF21307BDD402913D9425AFBC323F22BD58CB08BC32B5A5BDE65BB83D65C678BD28BC013D61FA8DBD18ACA73D5B870EBDD089B83DBC6B753D60421ABD5C47263DCFF061BCAB4CAB3DD8062E3D104F163C9ECD89BD5D9C633C8B7F5BBDA2443BBD03DC603C049260BDCAA2613DA0B3343D5CA6013E0061413D819FA8BD690550BD0C5A9DBD8A5BD9BDCD0D7B3C6C8BA93C4A971C3D020A21BCDD3F30BC5579D7BBED7246BC4F127ABCD22B643D36A16ABCE47984BD5F83DF3CB69F8EBD269485BD81D7823D3993B1BC8302E0BB3C0E8BBB2DB5A5BDA138C23C2999273D52D4FDBC738E67BDD2E4AC3D97AB8BBDC4D1FBBC56888D3CAFC8A8BC6A1995BCCFE6A53D9597C6BB59FDD23DC224333CA089313D87371D3DDEEDD1BC1C4F18BB966C76BD649F42BDB02738BDF553323D333F353DC91F68BDD2E8733BC6E2463D2B0A923CD4455FBD8E277C3BC5C083BDE88E9D3DAB7589BDE487C63B3F03A1BD07534BBD473983BC011E873D49ADB43C329E3A3D8F8D6A3DD8AE85BDBD5563BD7B60193DA6274EBD5A3C50BD7F0666BCFE76C0BCD7A3FA3B6AFB973D99BF86BCBB13A7BD219463BCE5F0A33DB76C93BD033099BD49DF4EBDFD86CBBC935F9C3D20F969BB46FA303DEF15A3BD58AC963CE6F9863D7BA6F13C8DDD35BB677F4B3DCDFC753CC2FD67BCB80FFE3BC6B6F83BC9F5A43C21B4A33C3A8705BDDC8E84BD91BD243D953413BC90E802BDB274763D6858873DCA26843D1462703D96D564BDF56B6CBC01B358BD5807FD3A7CE4493C3CD32BBDA3CA71BC6154AC3DB80886BD279A753DB34C64BDCBDC08BC4E989C3D9E4B8E3DB3E895BB5A08E93C0F487D3CDF0E863D89E689BD7FC37ABDC02C8BBC3BF28F3D652BC03C7CAB1EBC270951BCD769E2BC92F804BBCFDA6CBD09B96D3CC2037F3D4E27EE3DBB9DF5BCAB5539BCA0AC81BDA4F997BD4DCB5ABD2034C5BC766AF23C7474B3BCD54466BC806325BC8A3F313DACD4503DB83CD8BCF4C7573CE136653D28739CBC2655893DEDE8A33CF0AB6EBDF349BE3C16ADD43C759DE9BC03968FBDCA024D3DEC46803D95448F3CDBCE653D1A5DDE3C2C4297BBDC369CBDA3CF67BD271EBC3DDCBD37BD386C163D87F3C4BC19C59BBDD22E563B1A1849BDBD53E73CE0463D3C2BA1D23BE59CCB3C560836BDCC0104B8561A8C3C1B415CBC96F6A0BC36F1613D8E01263BC79C8E3D8E77B2BCFBDC4FBDD434AE3D948DB73DA27B8E3C8DDA32BDA5DF90BD7B409FBD613D923D41FC153DBAED20BDB070FC3C0E398A3DD2CE9E3DAE2A863DC2B5323D112D74BD5AF415BCB2833DBDA8D22EBDC84BF03CC8EEF43CD25AFA3DFBEEE9BC99779D3D3C4C0A3DF038283D44BD84BDE5AA30BD219B093C1D910EBCE7BC84BDE23BCD3D4946A03DA63E87BD2C3A173CDFB20F3DAE0C943DE4C52A3DBA685A3DB6BEB13DB53CA5BDB3116E3D230E093D6099AA3C2607F73C0C2521BD70FB83BB153D303CF8937D3DA91083BD4A665B3D3E5E153D95924FBD4CB8A23C12CB833CC5A6513D170E96BD4384E63CB31D983B1ECB1ABD190044BD1E5F183D6DAA853D88B4463C215911BD2C81C83A42072EBD7D1E323D72D39C3D427AD43B51A814BD593B5BBD4A0F293DD4D3743D3AFE75BDC36D103D733A0F3D202F713C14E9B7BC501DB33B9918BCBC2F7A4B3CDC9941BC730FF9BB38FE543C45DD80BD49CF8D3DB57002BDB6D625BD210E3A3D7E01053D8962DA3D6256313DA79BC73C9EB45C3D08CB303CC8EC9C3D931BDC3D3D2952BDF757843D0A77853BB6B2A63D0293A8BD1B4A2EBB99FBAC3D8BB0383DED7249BC4C2DADBD111BBEBC0D747FBC4EACBF3CF0D109BC6368EEBBB6AFBE3D610925BD0BA6683D503511BD5FEDECBCDDA86FBDE8AD7DBDEFE5753D64E097BD4B6901BDCA1E44BDA197B8BD70CFA4BB9899A33DFFEE40BD06CF9DBC9568213DC35A203D08203EBDE9B220BD8FF701BDA1FFB23A3BA90FBD352D103C3A74A2BD7FDB653D5E10A2BD9BD5F13AA332A23D8771BB3DA488D23C5D16A93DEF90E1BC2324C4BC1487C1BD0FCEB13D0A45453D6DC190BB748DD03DBA954CBDCFDD2FBD19A1713D2575893DF53CBB3B3D19BF3D214939BD6DE97F3D6C72A83C4AE138BDC57F1DBDA7DACB3DFAEBABBD06FD383D93A9473C70D229BDB7D18DBD508C863C990A90BC2CA0E63BE4B3273D7ADD3A3CC73421BDDBE2B5BDDE1396BDCB7E7A3DAF762CBBFCD80A3DD95CA73C67A171BA2C3ECFBBA96304BDDE04BCBDD3EB7D3CBB0AA0BD551A533C785F953CB6F0DC3B698932BCCECC383D8D9297BD7B9532BDA0E575BCD04D403D750A0F3D2D3C463D4B3549BDBCC483BC6FBC1C3DE25A85BDE4E7ACBC807BC43D749ACF3CDDAC773D95C5B7BBAC74ADBDA228763CA95D1E3D9A1054BD5ED83E3C740410BC56E0A43C0B98FABA94BD05BC43004A3D308D8C3DFE61B8BC3811C03D1C01073BD4D88EBBE7D3633D92F513BDCA39763D4A6C31BDF1F08ABDA139123D8F941F3D9ADE4F3DE3E4F8BC35741A3DA8B7983C308EE93C914E84BD0DB571BDEAD075BC4FAC3A3D4B8C7BBD70264A3D71C60ABD895F4CBC8C53703DCD9590BDBE2DCB3C8DFB5FBD514BF23C53EB5A3D82127B394B8FB33C481D373D1C8916BCFBB8233C169C08BD4E3EAEBD5F4B6A3C2F627C3D49FAE73DB2D2983C040345BD03FC223C14B8CC3B9A3329BD8A490DBDF53A85BC6518DB3CA7F3ED3CC342D13BF3CF41BD54A9E43C855FB2BCC63D6C3C336193BD144C4EBD92F5263C44EA563CD79A983CDF1BB03D116CEA3CD688853CDF2405BD629A603DE729E73B8F8AF73CB1300D3C554484BD49A248BB283EC13CEF23903C5D81E83A68981BBDBD22A83DE849593C84012E3D1855A93DCCEA77BC313FB3BD20D7A3BDFD9316BC50729B3DBEC7383C9E3991BB27A35E3D1651883BB5470DBB507E9CBDA1C37E3C801A913DC3E4913C0174B33DD242F1BB31B540BD46F2533B1A1CD8BC4FB1913DEB0559BD3977F13C0CC8223DBEF4443DD905043DEC440EBDFD5A8BBDBBAE983CDCC26B3DE90E043DEC533ABD3A41743DF41D52BD93A008BD1F1504BC77B346BD34FF913D1A9C2F3D6A137CBCE35D92BC91D4A4BD6B0A133C8183883D377F75BC37490A3D2D9572BDBA6B3CBCCD53ECBC0A4A83BC5D72BB3A86F0993D8AA7653DC693263DB5A0A43D52EB86BD9641D53CA44BB33D3CBB8CBD27F6993DC537A3BD4C1D84BCD970B13D8F76143DBD7BFDBC0280113DD529023C49537C3CCD4997BDB3C502BDABF422BDB5A8573D34B5F13AE75A0DBD575B653DCE4721BDD3B572BDD3FBBABC5532CE3C0B4E9ABD910FFFBC51E78E3D31A7573D34BA9A3DB2F0623DCADE9D3D1A7DACBD0F7E2DBD34F18EBDD50AA4BD61A0DCBC84A2DE3D11E7473D24BB2CBD1A6EDDBCF5263F3B1FAAE13C7C2C6B3DC51D6F3DD51E97BC433B383CAE19EEBC35D5B53D5416A03C60A79BBDD30B143D3EB58CBD7427103D49F01F3DD6E195BC74E083BDA47452BDE339A9BD28C9BD3D07310E3DC610943C225B5CBD58BC8CBDAFF0ED3B4D0633BB8A1BEBBC5FE00E3D099B0DBBDC34D73C51D288BD98DFBA3AD729913C5AB519BDFB50C23DD4CF2CBDC73ABBBC708A11BBD0BA233D323057BD608050BD264599BD704B05BD930C66BD732001BD40E1BBBDEC4740BC9D493DBD981267BDB01DB93C7FD4A63D71981EBC8A83DE3BAC6F8B3DCF6A5B3D0F0FF83B45A9A3BDE125203D6256593C7198843DEBA0EA3C331E173D4201FFBBE677043DCF581F3D7BDE493D1B9ED33C2940803B65E716BCF3D2D83B655E1ABD1AAC973D9E00863DFC0676BD441210BD241B903D20A90CBD98A99F3D5FCF52BD458FE3BC4176C83C81DA2CBDFF4392BCB04FD43C1740723D56F99B3DD38333BD04656D3DA75285BB1C4114BD3F7E363D712024BD68214ABB301D373D91CF4EBD376636BD4409F83C9BDB13BCF3E008BC0068BF3C3627A03D7496A1BD4A96883D27FA19BD0F4067BCA4598FBDB76EE5BBCFC04F3D2A34C0BD5A5D363DB6BC793DFBE8073DE6E6C03913DC91BCAACCB23DFBAEB53C255691BD4B6916BD0250A9BD14CE963CCC6D283CF36B2F3DDE37343DBC79CB3C537E90BDA791503D2E07973CB7B4883C657FA5BC45F7653D19C959BD2B72623B839C6FBD15A68A3B08B9A0BDFEE7983D9F03953D8465383D18B45EBD6533FCBCCB4EA9BA3508AEBDBA4837BD44EA1C3D6735103D60736F3CF088B33C869A05BDA2C6413CDE50743DC751AC3B9AE05B3DB6CAE03CD5C8223BE61E823C063E65BD9ECB8FBB0F412EBDB07359BD3F7CE13CE6FEAABDED4262BC941A5ABD68B5633DB357D73BF5EA0B3CD536E2BCF1C4C33D4EAD623BE4D6DA3C9138E7BB5047F63C904FA0BD9F8D563DC76AF93C93FA013D316795BDC91F853BD01C4D3D3FDFB6BC8CACA0BD290F10BD4CC3963D0246833D24A2203D05E7523D8BE37C3C34000EBCCAD79DBB0D8B35BD2C6342BD2EF9F5BCDAF2DEBC4F97F0BA78059A3D8AAA463B089287BDC68770BD5139603D28C4303D3315033C07AA7A3DAA04213D25D26FBDA94E53BD961AA8BC825B50BCB771E13C9AFA48BDA83920BD3FAD2FBD6CD5883D68FA913D8543383DA6A4C1BC2B9209BDA2541ABC77A4193D0F4AA43D294D22BD52989ABD094A593B2AE3343D1214943D01E310BCB6CAF7BC26E9843DAE8A8F3D81D8C1BC4B6DB0BD6109413CD61B4EBDB099D7BD4EDC0ABD39DB09BDBDC8083D56C6CD3C4ADCA7BD55E3C93CC4D811BD7A2ADDBC0D7E793DB45E003D2B9FDA3C77C8843D5EF18F3DCD8EDC3CE2F23CBD81295D3B31A8A1BC55F061BDA06E1DBDAFDDCF3CCE17BFBC00CF0BBC1A7747BD91FF7F3DF02257BDE26E973D28586A3DFA526BBD8DF55EBD5C91273DF6C6AB3DBD9560BDB504BABD6D127ABD477FB13DAF16AE3CD29AD93BDC1560BD50E65D3D694F973D811A633DD3B09FBDC80A57BBF77B97BD98FA03BBBF719F3D2F461ABDD100BB3DDD4A2BBD498F623DD476373CBBDFAF3DFE24CA3C3284113DFA1F34BD3BED813DD47BE43B9428AC3DB889843D0FAD10BDEEB7403D727D8BBD68B6E0BC77F848BC8061033DE9D4063DB1A7F83C27EEE2BC8A25223DC1F3AC3D17958F3DD216633C30C7163D366BCC3C08E665BC0792573D0DE2353D6CBA4EBDD9C343BD21FE94BD6035AEBCA5D179BCE3FAFCBCF4F3673D2D0637BD507AE3BCDAD9A03DBE2F303D50E6853D2B37BF3D2EDD0BBD5EB4383D651C7FBD3786A13DC9580BBCA6A2813D5FC09CBD8D8984BB10815B3D7C9239BD3721F23BBFCC813D2AC0CCBDCF4DAB3DC94A8D3D19D580BD8C1B943C50F36DBD965D52BDE2217C3D043CEF3AA30EF83C4E1E0B3C09E8223BF622AA3BF9E786BD7D3AB5BD6E0785BD462B99BD8FDBFBBC828981BD68333C3D80D823BC3BDEBCBC78408BBD5CF7BE3CF7E4043D4A1AB9BD33ACDB3CABF4003C3A2262BCFD54AFBD8D0120BD3751733CA30D663DA395ED3C60E392BDDA0F05BD8C98CCBC9E528F3C4142E23B3EEEA2BD996D3F3A9C22E73C0B20603CD3AFC33CCF00383D5EAD7E3DA5C777BD5347F1BCC6FA53BBC1B7DDBC9B448D3C55D461BDE0222D3DC5EC39BD81AE8FBD2C0C20BDD77B65BDBBD040BBCB18BBBB3E29A03CB7B4743C28A383BC3989A53CE21AABBDC19B33BD6111613D70AF4ABDFA1821BD2B4A063D5DC071BB1407BD3CE4F8F53A9BC00DBDA8A4023D7B1396BD85E6A8BB2D278FBC99739D3DBFFB88BD45208CBD11CA90BDBD6C823D268895BD6621A9BB946DD13A65518EBDAA5472BA5792963D399D0BBD57C024BD8FB6813D1732383D3FB082BD5B628ABC4D2E4ABDE23029BDDF918B3D9BE89ABD4E178D3DB8DE273D416E50BDA3E756BD0F68A9BB9F82313C165832BD2B7406BDD8B5883CF29E073C9BC4AFBC6AA08FBD8EFFF4BC54B42EBC06CD053BAB7B993D8330C7BC9E5A523CDE9640BD3F18A33CF272A7BD2226F3BCDD35BF3B20CD59BB32816D3D6D798BBC1E2F6E3DCA5594BD3147E3BBBB60AB3CA555B2BD40CB97BB42A0A0BB6A78453D4BBF6FBDAAE7393C52816C3D0B499C3CEBD8A3BD2CF5C13DBCF591BD1AB793BDC2C13DBD4F90DCBBA623D1BC1FEEBBBB261EB0BC14816B3D47121B3D50DC26BDEE740D3C12B8E13C7D539BBD75375ABC93F43DBD50754ABDF63E8A3C141200BDD77C3BBA970037BD4463623DD299E1BC5766833CD7D33A3C9B63AE3D0045933D72FA9BBC5EF5AD3C29BAE23C774B9ABD4E489D3DFF14EE39E983613D1DD11F3D4BD0543D93DEB33D24C470BD51A697BBA33AFD3C4713B2BC496A813A7C42ACBBBEDE593BBBCE9CBDB9402C3DCC6EC93B2967CFBB92D289BD65417D3D6EA5953DECC1483DCCEA39BA382673BD3219393D617EA9BDF9E0323D3079E6BC8478993D6297D83AF7B4AF3D636ECF3C9232663DB305973CA02597BD692464BCF3FE813DEAA29E3D6AA5583CB3FB173D41D917BD020FD73A51358E3D0914123D938B7DBB3BB216BACD3C69BD663D8CBDED8CB43C0EE7CFBCD8F70E3CB4E977BD334A93BD54A53B3DA2171BBD9C52D9BCEF44503DB89287BD3521A93DEBEC443D2656103DEA0C3F3D731E8ABC54A22DBD280410BC0A00A13D1AC6983D999D3F3C3DBA0EBD807D1ABD76BB563C836C9CBDD4A76DBD65225A3DDA957B3C4E079BBCDDC008BDA809133DCD7F8E3D7C297F3D285B35BDA118D63BC9FA67BC2873393D3680163D72351CBDD9B041BDE2A5A23C298298BD130153BDF97D993C39A5213D1439CEBC37FC873D1422F53B6F4C2CBDFEE077BDBB7992BD34C7953DB4F697BC8306893DE285C23D99D1A13B3264343DA7E368BCACD7B23D7BE9A4BCAB9434BDDBA106BDB0323D3CA0BE53BD9A76813CA889A7BDE76457BCAE3613BD5F1B373D4A8A7CBD13FD72BD3B11DEBBC0923DBD44E5103D0FC69B3CA18E123DA117CABCBC4D4ABD25DAD8BC0CCC10BDCF398D3D9AC0693DF261783DBD7CD83C66E98A3D8540FB3C91C3833DEE2E49BD64D43CBD7ACF8D3D0E9BD93C5D6BFD3C674D823D67FA9E3D37DC86BC3CCC91BD5886883D1D5F9C3D60BC75BDB9F809BD32F7D4BC62E6103D81BC5E3D6747023CEE04A9BCE77184BD1A483E3DD3A6313D68928BBD37543BBD02E2BA3BA70B6D3D045C69BD5CED883C04A68CBDB455A03DDC8B6C3A40C3553CE39F853C4D31513D25532CBD96F3893CDC4A78BDC35598BD367195BD14532E3DE5A23FBBA8630F3DB040DDBCC62818BD443339BD969F0D3D6D8043BD1AAA823CECE5953DFF4097BDAE21193B576872BDAA13623B1DE68DBDB94288BDB64E9B3D38D7E43C73D3A3BC1B7783BDC2B3563D0D871BBCF6E9C63C13001EBDF5BCC0BCF4954EBDA35F823CA76C553C1DA19DBD14BF19BD29B34EBDCE11473D86BF813D9628813D6AEA13BD1E1CED3C4A95573DF76D39BACFD45E3D06463F3DD3AA7ABDCCBEE33C5CB48A3A80AD45BCE0F036BC3E5506BCA8AF32BD3FBF4ABD895872BD89FF973D64EC97BD95DA933D0CCD3E3DD39349BD3723063D5FD7C4BCA318923C41D31A3D9DE2833D9C0BCD3C6E506F3D028BA03D681705BDEE25BABCDFD03F3DD85946BD0BB5A5BBC7A78ABDCE9768BD15EDA4BDAB16A83C7B64053C4ABBE5BC97C39FBB91E2893D56D67FBDFF1087BB59B5973DDFA37A3D6AFA2BBC0244303D0ECA99BD4EC314BD011D05BD72A3A6BC5583B6BC360B243D22E30C3D3CA168BDF872883D482BAE3C2D2647BCE43FA6BBEBE325BD016066BDB5FC563D37BC763D9B624C3D64C589BDB37D923D2241D73CC4A365BDD159743D9E1F3B3D5943843D9E30983D397F08BDAE5A5EBDE5CB42BD7672D93C5426583B7E0F163D0C1984BC338CF6BCFA9655BD1038A6BDF9340A3D42DB8DBD16FC01BC4D7A9FBC56F74BBDE55376BC8C65C13C6B01323DE9B1563D5F8F173DFB4A4EBD7C3436BD85818D3D5B41583CAD633EBD60AFB0BD0AF40B3D61D7ED3C415D973D3BF08ABDB2CEE3BB72D493BDEED67ABBAB512D3DD200493D16685BBD7D4FD03C50ED0B3D307B88BC38E924BD93AB133DA7A79A3DA49021BDD446F7B9DFFBBE3C47916DBD9542E83C2A2A8EBDE19D7E3DCECC99BDEC294EBD05E7973D2B4F2FBD06A3A1BDFC0FDD3A5F8620BD9841CC3C17BA8BBD39448D3D9EDFB2BCE401083D94FCA0BD754F94BD28C2683D8228533DB6FF923DA15C473D45DC04BDBF236BBDE9204EBC162A2FBDB999423C775A9BBD38CDA43DA98F633D047369BD481554BD28939E3C178590BCAA8F493CD90D4FBD75C34BBBFC7E7FBDB8ECB33DD4859EBDDD00043BE0CDA13D6B6C9C3D66EC883D60F6813DB6BC51BD00BA03BDE82B923DC0949DBC9298853D24391C3DA608A13D9C2FE1BC2E2908BDC2D456BD09DE89BD695E0C3DD9CC3CBD82457FBDEF231B3B150382BDF345513D166D433C2B4607BD5436823CEEE4C73C5674183D85F0BF3C0C0BA0BDA2993DBDDA8381BCDCCE23BC37387ABD59E2243D17CC613D1DF280BD550A6BBCC44C88BDFDE1A6BDD911743D289A7FBBDDD2AABD815C113A4CE583BD7E7698BD33C728BD83DD56BC937F2DBD83E9D6BC854527BC8F5C5CBD68866B3DEF1758BD9A7591BD851731BD823142BDB8E9543C340F2FBD64E4D8BCD352BE3A8256E4BC20EC25BDD29FB63CAF0901BD0A1309BDC180503DB815923CCC66C1BCD240A6BD6D601D3D7F5D02BDDA0E6ABD5265E03BC19CC5BC38973FBDEDC5F5BB9EC893BDCC86963D82AD87BDB2628A3D1C998D3D78BA8B3D63DA93BD23F8303DAA97E5BB40F233BC362DA23D644D8F3BA8A267BC89501B3CFF1078BD580744BD7F68833DE0D728BD1FF47C3DA4AB6D3D1608A13CA22A5D3C6D21EFBC98D7F3BC3CCB6BBD502B5A3C19E69C3D66486CBD1B2E403D114A7DBD6E069BBD180D8BBD7D8B24BDFB4CCF3B45C44B3CC0D780BDED5D773D30F51EBD4F96313DC397ED3C828B933DF91587BDDDC67DBDF6B9BBBC3BBB94BDB4E7903DBB40A53D86FF6B3C87AB873D08BA133DBDDEDDBC8A9101BD359FDBBC3F1F643D0BD9543BF721883AD2C45EBDDAE8D5BB1645333DC02FDE3C3A7696BBC3D374BD15B3843D76D5AE3C8A5B90BDA8FE54BDEDD9D13C62089C3D1B378D3D48FFA23DF75E183D2A14883D0FE6C2BC0A802ABCAE989DBDC3FC2FBDF2EABC3CB03AFC3A4AEA603D73F3BBBAB2531E3DB8F183BC964295BDED29FE3C043955BDBDC7B4BBAA3B933D285AA5BD1EDA46BDD092833D998B9DBC9FD8BFBCE70FA73C3160013D309984BD3B48883D26F337BDADAB8FBC2C6A9CBB36E5FA3B20909FBDBB1835BD2A1D7EBD490FA03C881A74BC4659403DB3C2E4BCA6035EBCB5F143BDC1E52E3DC59A9F3DA614943DC9C2973DBD8798BD156B0FBCF9E0573DE507373DBDAD91BD4CEC98BD4541993DB81F4D3D1718613DE351903D38982CBD8D795B3DC8D5A23DA88DFA3CC53D68BCEE65813D7BA5ED3CA0697F3BFC3928BD643457BDCAFFA23D24478EBDD1DE98BD3AAC40BCD68C0D3D4B2E7CBC58722C3D036B313D407F253C798B3D3D4285F6BC34BC8B3CBA1AD1BC889CF5BCE1209F3C57B9CA3A99F7023D871B023C91B79C3D53FE87BD6477A4BDC0D6453C88E9403D526A05BD06D89B3D0E8B493D86386B3C2E716EBD7F7D60BDD755A1BDFA34C2BC3BF2A2BDE8BD66BDE0EE6ABD6E6CF9BC894DFABCF6C295BD4C6B503D9EE9A4BD508D593CC2EA64BD8E2A75BDD756923CB6020C3D3AF9483C1A7A8ABDA0A34F3C45B78F3B3BBF6EBD69C861BADAF1823D2F70663D2D7D94BDA5A0903DD9CB933D777C063C790F463DB59C813D0C4D88BDD38EA5BD8B841B3DCC3C98BDEF9027BD26408C3CEC358F3D0674713DCFE9853DBB14A1BD2DFF903D945B2D3D87C367BD4E821F3C982868BC240137BD343832BD0A2B723D74C566BCB95D083B504EA33D01FD2E3DCF0E5ABCF0516C3D3F3029BD33BFA4BD66F30BBDAB50663D3B33543D46A2503D2C32A53C688E9BBC9C3E373CC1E38FBDC49A5F3DDF91893D513E42BD0432373CA1058FBC53DE683DFC52213D3B5D20BB6D18973D5BB7EE3B7DD60C3DA91036BDEAAC113D688D0E3D16ACA23D62309C3C95A754BD93AA263DB9F651BDB66A6DBDA36270BD00629ABC4A2770BC4F1EE6BC76AF65BDE5773C3D1DD3023D68CD22BD6DD103BD1CD635BBD63ED23C7C22173DB9788BBD08B653BDEA7A2FBDE76FBA3C2BEE82BD697184BDC1BCECBC498D82BD0085F7BB2B4190BD1FCA46BD65EA8BBD083981BD5B89A23DE74E7A3D53808D3DBAA873BDC9747B3DF5DE383DA99E813D933F50BBC4A2F03C231D863D1AFB2DBDC9DE433D1D7EB63BEE045A3D9BE2853DA00344BCD0589DBD393518BDCB82A3BC594DEBBCC24A523D4E78273C88BEC03CCCB5A83C82D87BBD50D9963B122494BDE3A929BD1EB16C3CB05967BD1C67933DDA814FBD80897C3D41502D3D7073133D3E05623D25EF75BD29171CBD13FB933DD9C997BD4DBC87BD7BDA8EBC99920A3CA7C7F83C2A42FEBCBF30EABC3F6472BD936F44BD3E2D1ABDD85890BD4C169E3C9B10843DED6B663D48794BBDADF41E3DE579993BB55A63BD8A8916BC4097053B3DCC9FBC2CD3803DCB1C5EBCD12481BDFC9392BDC7C990BDBB9778BDD49B2E3D80E9E33C1398893DAF7FB9BC6566B43C3421123DB099563DD13ECF3B298A903DF4132F3DF0268D3C3841373D85CE89BD5D21283DD859263CFF307BBDF7A055BD9CE56A3D557AC43B29DF7F3D2BEECCBCA0BD04BD50BF9F3DFC36853D46D56D3D40401FBBDDBE97BD1C6E0C3DF7DF773DBA33083DACDE15BD57A908BBBD9BD43B7B5BA2BDB8EC97BCFB408ABDED3BED3CD9C5C5BC157D75BDDCBA67BDE02A12BD2DF48E3D16C4AFBC2F9B8F3D84B7173D78964D3CB035533CA0803FBC4DAAA23D4D318EBDF4FE01BD962B5FBD98C4F33CB4DD9F3C9EC16A3DFABB65BD18F877BC8EC55B3D080B5FBC508F96BD257F1ABD75B49B3D668F4BBD7669553D48A4623C1E2C47BD9889EABC58C0783C7F1B88BDC3D2933D64D4F13C582DAF3CA57818BDBE59723D6A7A19BD710D8B3D806ED83A07C2933DF1BF03BDAF17823D900895BD407A363B218059BD9C97D5BC7057F53BE29783BD58F047BCC022E33A6BA189BDBB3BA53D7841203DDD5FA33DBC438D3C470C26BD8401BC3CCD0D0ABD469514BD9A4B743DE02D3B3BBCAA27BD806EF6BA36D579BD350608BD5492333D4E045A3D3A80183D96B20B3D141048BD24BCBABC1880873C08164ABD16B49DBC8085053C00ECA3BAAF6E2DBD20EFD43BC029D2BA1C9491BDC071FDBB359C26BD60A900BB6F26A4BDF021963CD0A3D53B997F923DDE47103D686D86BC56EE783D9EB47A3D7D60953D15B038BD44B0AEBC80C8EFBA027D793D0B0D25BDD6193B3DEE3251BD4087E73CF268093DF4879E3C50B2A43BE68116BDC8AC6EBC80B580BD0273433DC01B863B00E07EBA289A2F3CF24F023D7D6901BD504374BC9679A3BDD0F47FBC228D7D3D42584D3D0084633B20D268BB60751A3CAA8B393DFAD099BDD2324C3DB851D93CE0AC623BA53B5FBD6F06A03D3C1CE6BCF8DAAE3C53D48E3D72B2713D5C65113D1AECF5BC8C51A1BD441DC9BCF0614C3CDA4207BDAE95443D2E607D3D86333C3D60ABE23C16F3A2BD6CB082BCD550A2BD722D70BDA05CBEBB01370ABD4834BC3C5CD0A83C80C01F3A522352BD304E043D9E9773BD00FC8AB8B43DCF3C56AA83BD458998BD560D9EBDF3AE07BD2C24B53C509E32BC7E1D75BD621555BDCE215B3DB190883D11C332BD31F272BD7117943D9C4C48BD101682BC507835BC5ECB5E3D20509E3BC3AB8FBDAE712CBD466B2D3DAAB1DCBC180309BCFCEFA4BD9A3B6D3D6FBE37BDF2252C3DFA0D5E3DBE0F423D6CABA0BDDF6899BD60A8F73B8282243D541885BD00F2193C45C49D3D9467BDBCCC34E43CE8F195BD693A9ABDFAA05F3D1900903D5BC1A4BD2A3F5ABD674D873D4008BEBB5243773DFA459DBD6863093D03CC9A3DFB359A3D60C865BBCC6BC03C5D9A9A3D50A5023DB8FB2D3DD17A40BD1B2C81BDEE6B6EBD3AF9A3BCF8F7953C569E14BD88A171BCBFA03EBDFE2E473DC4E0B7BC9046833CCC4198BC506D98BC7C0F7CBD701BE8BB44EAA0BC370700BD006A4C3A0DD6903DA0E09FBBE0C44B3B58B02BBC72EC4DBD105F793C722B0DBDDC86CF3CDAC1383D12E35EBDEB7CA03D56D1763D2EE9623DD4D287BC8405013D07E50ABDB3F54BBD68612CBC0F228A3D4447093D2A32EFBC5F188BBD28C9FA3C608D5DBDE4AB5DBDB220573D7CD66ABDDDC921BD37288B3DF078F43C115E843D7233703D88293C3C54BC223DE8FD293D4A049FBCBFEE9BBD5E072D3DBA4EBCBC223F423D1EFC703D4CF09E3C41B3923DF0218BBC093F843D283E5EBD600723BB303A113D5E5329BDC8050F3DE8EA26BD0E192A3D9A1B503DAD9D8F3D30B433BDDCBF81BD54C7803CF9960CBDD6405E3D9CA877BD8491803C447F0CBD504270BDB40C8FBDF07B7F3C8A9F3F3D00523D3C1A7B52BD8A4B0C3D80B4113B315635BD547E8E3C31F18B3D575E8D3DEEE97C3D6833133DB074BA3BA07816BC181606BD2CB8EE3CF8D6E73CFFD842BDCEC39ABD28499C3C80627EBC9483EBBC94A3CFBC40D80A3C4320803D902E053C2C19093DC070D1BB1E286B3DF565A33DDA54593DF47897BD28C2CA3C79013CBD7041DCBB6852853C00BAFE3906812B3D82E3B5BC18A8D63C200F163D30158BBD8067EA3B84AB51BD0AA488BDFE0E0D3D40E0C83A60E58FBB00FDD2BCFECD38BDB7B19CBDBDFC863D1C031B3DE78421BDE4A759BD58C9FB3CDB6C9A3DCAD67C3D2810CC3CB655633DD00D30BC3CED9F3CCF499D3D68EB03BC4856FE3C13E85DBD0A9D1BBD00EB79BA2AF2F4BCB83C6ABDD680383D00A2FB3C08BB14BD0EF0E9BCB123883DB00E163CCCFCA63C1AEB683D985D5EBCFB2634BD60A8493C88B8213CF253553D18DE74BC60BB00BCBA9F7ABD08E729BD5137813DE7AB09BDF02D153C440ED43CA440E7BCE0383EBBB4BD2D3D58E8D03C5C618F3D8CC538BCC7939F3D9CB7FBBCD6ADF0BCDA9C29BD746230BB39B87E3C631691BD6FF6B93CBFD254BD5C428C3DBB4D2A3D212191BDC16CD5B936E9433D6315263C6153143C11328ABD83466E3B70AF78BD02939DBDC7EE773D5AE399BD54A129BC2664AF3BD81781BDF99CDD3C03C5CFBC3F41973D453BC1BC3A26E2BB8F8F483DE03A8ABD9D116CBDECA4233D8A2987BDEF4DFCB97A21A5BD3E67263CF0A680BC40669BBD6B9386BDF74B9EBD4E2E9CBDB60E863C357CB7BC608D9A3DFC492FBDC2471FBC20BE9E3DB585F638E7D129BD0D637F3DBCBC07BDEC0FA53BCA6DAABCE87202BC38DB93BCCA6023BDE456FE3C910A3DBDECEE4C3D20640E3D204E463C1D413D3DBD0636BD8328823DDE3F913D3E7FEA39E384E2BC81352ABD58649FBDDC4E143D251F81BD28C1003D4DAF9E3C164B943D9B32713D233F8EBD04278EBBB14845BCEAB7733D8FDD69BC7C59163D390D353C3190E6BCCC2C023D8DB51D3D9938EC3C63DC5B3C65ED50BDF2BF20BCD6E56D3DEEC195BDDE1D5A3D14B9A53B080985BDFA7492BDDB38913D8063593D21CBA3BDC5AA633B5DF954BC021B17BDDBDC7FBB28BA8A3C8A0A583D9D5E903DEDE6983C1DA16CBC4C4393BCDF9C893C421829BD19A6A2BDBD7AA03DA80DF5BBBA799C3D1DFFA43DB9AE10BDA333A33BECD101BD1EC169BDE451733D6C1E4EBDBF90F93C68B59D3CEE60063CA30512BD8607F63CCBF5963DA19D39BD22641D3D4D0B1EBC8D4789BC4BCA943D9E70EF3B838F753D12DF5C3C3BF9F4BC96DD4D3C961D3C3C23A5003D0821103C09CF243C8A0D093D0C1802BDCDA496BD1C9969BDE6ACA03DA5373F3DB3918B3C00A06CBC0E33E03C27A2993D076584BD7691923DE6A9303D75C1D43B810365BBF72C873D19424CBBE387A63DDB3B84BD7A2925BCF0FCB93C4446E5BC3C14943DC2CE503DF1317C3C4360013DA638103D42BF25BC18B581BDF217F53BC1ABC73B1821E13BDF5D433C15D018BDD556893D0BFCE43CE58AA23D216E9C3D7113ADBC19A42C3D3EDF94BDB890B2BCA8748A3DA27F613CB46C753DDFAC473D10FA3CBCE55B823D629714BD0CF3AE3ABCC434BCC5F2ED3CFBFB053DAC7CD53CDB931CBDB6933C3DEDCC1F3D2896953C1CE255BC6CBFA23D651481BDA2BC8F3D9E04983C176A03BD0EE9203C4E708A3DEE54E1BC204AECBBAB9727BDA5B65BBDFBC79C3D335A23BD75641ABD131FF73C35A780BD226B3E3DC4010ABD03B35EBDAD6E983D078E8B3C7A1F773DB9F4063DD18A2CBD10E8333DB514573D4B633BBDE09666BD207A39BDC334273D5AECAF3A69D2913A38CB79BDADA01C3A9BC2733D20FA6ABD7258143BB6D593BA9504593DB81A5B3DDDCCE53C7E5446BB29E667BD63BA0E3DA436573D5277983C518B2B3D2FDD693D33C69D3DC762073C9BE0BFBC091D1A3D3A9D94BDCA843C3D1CA48F3D1EEB6B3C1149DBBC8A3D56BD719298BD2998AD3C95E86BBDA43631BD043456BD58EB13BDCDF96F3D81A87ABCF127B83C9CF49DBD61DE40BD4DBD9D3D45FA97BDDDC32BBC91C2CA3C80D382BD097951BD5E8A703DD4C1A13D26CD6E3DC237BC3C315BD8BB44FE78399814403DDBAC9A3D29E96C3DA692D53BDF1744BD882ED33C30464239A763063DC61A9BBDE160DBBC4AD2063D8A4A843D9C0A693DE97B82BD07266BBC020627BCA17486BDC26646BDBD6B1C3C9270863CFEAD733D1043663D7537A03DF2E267BB4BBA9F3C40336FBDD8A2803DBA129F3D06FE1D3CA76F21BDD53643BC87F62BBDBC9CA63DFEBF15BD5D910ABDBCFE82BC40D7A6BC05C716BD0853363DE07B383B2C7986BD8C0B86BD319CA33CFD9568BDC080243D4B746D3C06C239BDF871F93C70970A3D592C45BD7A062B3B5255583D971BE4BC59AFD33C49E4CABC761B4DBD4BCA85BD3A57893D94FAF23BE2C544BDB14B083D15C220BC39BC9F3C46770C3C5E3596BC33D375BCB585B83B51DA6DBD6149EF3C59DD02BD47F6A3396AAA823C6013933DE96EC6BC18B1433D85D93EBD05DBB83A77F213BDE8F9593D35FB493D5D21E5BC548E3D3D92AF2BBD3DC364BDBD66BABCAE2EA0BCAC33E53CDFFC9B3DF501EC3CE4FB913D75BC013CE5411A3D620C843D13587ABDF50A8B3DF550163D13318C3D8221A03C48B590BCA4106BBD5F8B2B3DC2CC22BD315B163D7262133D1F42A93C16114ABD1CA78BBD41C0CABB5A24AE3D5CCF973D656C78BDDF989D3D3E2995BD50DD213C2204683DFF0C7ABD39063BBC4BC894BDF9C2543DEF54383DBB939F3DC16A3CBD06D9CB3CFED2973D6C57103D869E8CBCFBF2593D1CE260BDD0A4843DCBCCDABCFA67943D8C318A3CB1DF76BC23286EBC167353BD734A3BBDBF0C51BDCE3D1B3CD3540FBB12971B3D2165833D718220BCE9B2E9BC4B0301BD3F2B8E3D23F21EBDFF27073CE8B8B4BB6BD095BC6511A0BD323B9A3DD63434BD28E87C3BA6575B39FA40333D7302A2BD2B1C733DE480243B79FF14BC475F353D8B453D3C3C44963D2C26103CDC7C7DBD4BC2DD3C92D78FBD7E5F613D999986BBA5C8CF3CD05BAD3C93B3DEBC672D2EBDCA39B53CD69869BB260550BD74671F3D5A65C6BC71BC623D81BCAC3CF0DD043C3DB56E3DE59A2E3B9D7FABBC8E44B9BCCC7286BD7ECF363DABC6E4BCB1F2593DB0268F3D446648BD779099BD5E6D41BDBA539EBD3C0E95BD0A3E673A798C813D7820E03C77C5D23C689BA0BDDC6E4F3D5453A93D46B3B03B65738E3DCC26953DFDD0B0BDA182B2BDB2AB71BCA166DC3CAE128B3D68DF48BD6756113D225F24BD286A073D80BCCFBC023B83BC61A204BD125F11BD7A6CB5BC4C1E1DBD8E7809BD6B2774BD5C0D993DE34F8ABDC52CA3BD4162403DE1E1E5BC3614843D53A687BD6F5EA5BDF226E2BC0CF561BD1575E4BC7B67C43CE02897BBE8B77C3C0716753D1DF9B73D9DD2A83D0CCF6D3DF35C603D0DD26DBCAA392ABDC6211ABD9B6172BDFAA97D3D3331F1BB90FB7DBDB14AAA3D34D278BD9120753D57CE273CA2A683BC9B2B02BD3C5F40BD6865A03DFED677BC06613D3DD92A28BDB30F1A3CAB983FBD292788BDA518CB3C22DA523D4C786CBDE979F63C937B9EBDE38D533BEBDE913D6AC5EE3C17E74ABD6AD003BDB294873DF0C614BD0ED592BCE955893DD65E803D4D2A10BDCC56C53C1C8B293D4E1C14BC5B3005BDEF95AB3D89A2493D8AD113BC9F6D34BD0B76D0BC774E4E3D7A3D0C3DFE2E09BD17A4DD3BE2446E3DB7B3CBBCA31A973C99DD273D2F338A3CDF4007BD18F68D3D0FD7823CEC5948BC67EC23BDBC4F31BBF660D23C6DE6D1BCF53483BD0E8D01BD548973BD805D0EBAA0097F3D4194BA3BF273EABC909B90BC582688BC5EC266BD88FABF3CABCDE93B7A47F2BC71692E3CB2DA0A3DAFEFC0BBBA3813BDDFB8133DEC2280BDA05E2A3D549321BD2DBAA2BDAE829E3C02CE99BD7A2FEC3B7B9C5E3D3E3B6CBDF70994BDDC081A3D0EB1423D9FA591BD897A433D504A40BDFCE42D3C01F8BCBC7FC0943D37E604BD95DBAA3CB9DF083DB63F0ABDBFDF0ABCD986993DAA0F98BC1A6B07BD680FF03C2C5368BDDEB19F3DFB5BCBBCEE7475BD34E78BBD906A643D97BBE6BC2F10003D010853BDA5D1303DBFA6A93DA110CD3CAF2860BB5FE1B1BCC40EF9BC02541BBDB3A7703D042201BD8BFB02BD5F964F3C51C1753D5D869CBC7ED7963D4B230DBD65CD203D9E105FBCD5B9453DBE349CBDB62801BBC17CA7BC1B53753D05A280BD84EE61BCC01C3ABD127712BDE7E041BD409B4DBDDFE9B93C4C9EB73C3E3F7D3901DA37BDBEB0BE3B7DC2483DA6008B3D15639EBDFDB11B3D96E388396490F2BC639858BC17D8693D2FDC7ABD9BF8403D795292BDA57A1DBDD59D11BD0EAA6A3CB76D8BBD48F990BDFC9B823D62EFB9BCC87E50BD4C0B97BBF0077BBDE1F7033C0DB8A2BD26EA483C40962CBD17E79D3D85153BBD7EA9AE3D28B1A33C4BABCA3A09B88ABDEA2C7A3DEA6977BB703500BD8945EC3CE176963DFACBD23BA67D49BD64F28D3D61737E3C591180BD3DA4883D9CA67DBB1631823DB99392BD77060E3D54DC223B6C4F16BD8FED423D21186DBD20A08EBC44B04A3D3F46ADBDFCAE603D0704DCBC423E0C3D7AC3B13CF3763E3D52B5283D45B0503C273D643D96D3003DA761A63B9A9A8E3DC4E91F3DF7BF1DBD6E96A23D0CC846BD5CC785BB6ACA90BDDCCDD03A1F2D3B3D9E9281BD49C9323D1BDFB23DF9E2203D0B284DBC972D433DED7177BDF92745BDE6AD17BD8167AC3DD22D3B3DAC19163CA1B38DBD491C91BD62C8283D4F355CBD02A9A23D6E7873BD364D93BDB4E7F53C040E58BD6B337D3C0964FA3C7DDB953D0709043D31D581BDE8AC4EBD8B81803C83B03D3C33200A3DF4A7193C7D5FDC3DFFBC813D07902BBC322FCFBCEB8BBF3D000D1BBD84F99ABC712538BD41A089BD10A9543DCA5AA33CEF80913DA5E240BC731E9CBC8FB6013C010CF6BB9B5AAD3C09AB573DB1887C3D0B15193D2692293D0AD4FA3C9176E93DCA3DC93CA4DDBABC9E4534BDDC7011BC0DFF3ABD82902CBDD7D0B9BC7DF721BC433405BD314381BD5CC7E7BB02008C3D8554FEBC8D13BD3B114E02BC41614F3D6DFB9CBDE044963C8E211BBD6CB5C7BCDCF30C3D145D743CE00D29BD2CDC353D5E75D8BDE5508EBD5DB472BDA0EC043DFCDD083D92091FBDB2EFBFBC9EBC20BD67F567BD58C400BDC46174BD11F383BD21A1B53C330860BD67825CBC8F23813BC1C5F7BBC48F7B3C679F81BDB11D56BD9E5A83BDEAA6EEBC64C889BD93D1CFB99D07A23DE9499B3D02C5BF3C939B22BDD35D5D3D7CC8AABCCA99533CF7D93EBD187838BDD1462ABD878F063DB028EC3DC7F32ABDB2335E3B6EA993BD1A2D8A3DFC664BBD0F479E3D774334BCDDE2E83C81CDB83DCBFB97BD86AC503DF01E863CA85569BA7106E73C6B4E02BDA9E74DBD30D0AE3DE68610BD20432ABAFC0828BDC34B173D8C1B633CB4E8133D33CD1B3CEBE295BDFCB097BD1D799CBCF250B03CC9FFB7BD5F04BD3B6333863C89889ABDFF7C05BD4DC38D3D10534C3D2731713DB3439C3BD1EB38BD1F850D3DE1CF98BDF88FB0BCBA3A8C3D36CB803D878D10BDA88C4A3D64EE58BC6D5B2EBC11C7A9BDF8103FBDE0DF9C3DE2141CBD8DA5113D80B7A63C340EED3B645326BDE421483D636C9BBDCE61433D639494BBC28B88BD87BA8E3D2443DEBDDB9278BD56D03FBD6FB42CBDD955B13DEBC2A53D3D4686BB15D2943D0082253DD30F85BC4E13833DF711D5BD3BDD5DBDA3B6423D9794CC3D61B88E3D1BA993BD5A2F5CBD2C4F053C8CF2253D0C3D03BD3FAB04BD2D5E82BD437E7B3BD1D3113DCB19533DA399053D31AE33BDF18D543C1F37F13C1011CD3C339A5ABBFF8082BD4A0382BDC8223A3D6228203D20D7A53D23808B3D9E38ACBC207787BD443441BDE614ADBCAE89963D6A11593BA82D0C3D5CEF8ABCB004A63D6ED286BCA603EBBC062E3C3DCCC4F83CAB3B853D895B41BD1E1FAEBDB2304DBD84C689BD9663E33C4E25ACBD398070BD55CD8DBDDEDC2A3D52E832BD3DBB943DAD2081BD6F3A57BD29E6ABBC3509E4BCB9789EBD3BDE8EBDEB93F73C3CCA033D853DE4BC64CC26BD8C8802BDB58B063D890CC73D37FF883DE11243BDA99183BD353D74BDCF423DBCA1B409BDB6ECDD3BBE78C83DE9B416BCCEEB9C3D3347D83C552F02BD0BF36C3DD3BF9CBD3D2A19BD65E4BFBC4F29203D476E0D3DF50E8E3D88257FBD7713E8BCBC4337BDF22F21BD48B14C3CB223BE3D86F95ABD3C80E6BC573D453DB01D38BD8814663DF9A3003DEFEBA0BD9330713C3C4D793D39C91B3D0E4C11BD85D63D3D444881BAD3E86FBDDD07BE3D892B793D130A2D3D439D13BCAEE46BBC795691BD3059993D9EBD38BC1A51253CCEF27F3C8A73C2BD080540BC8F71463D1AD02B3C162C2C3B5A59A3BD46FAA4BCA34D41BD9D451FBC9D11CD3D0CB5FB3A44FC49BD431174BD127F453B6225E13CE7420EBD49C41E3C5E20F73D6D4A80BD65CA693D062F95BD79998CBD8F539EBDD2D3813C3E418BBDC1F363BD9E9A113D14E5AEBDC05B683D3D805D3D490F473CC8C5263D333B95BDCEFC683D2595D03C076D7ABDCB71CDBDA2E8673CC794993C7FDC613D7C565D3DA891B4BB3BF00EBCF7C74F3DB696C1BCD1CBC63CD5A970BDDC6A8B3B1FA3B23D2E485CBD2192BC3C627A843CE370DDBC27CB343D9F96B1BC20254F3D3D2F803B4A04F9BCC2AE6EBC3B51F43B1151753C89ED15BC6193DFBCF7FBDDBCF4DD44BD6F278A3C254CA73C342093BD64C984BCA8EAFE3D03C2083DE2615B3D91539EBD644A993C7CE2383D1FD4423D2B608BBDDE4234BDDE3EE6BCFDD4E6BCB4D81CBC62DB9ABCE2D0253D256B2CBC2DDF20BD9DBD2CBDD96C15BD5C32943DB86CA73D0C2A3C3D5C838F3DC9980BBD14BED23C3F80BC3D912972BD9E3952BBED8C753DC5DBA9BD89D1573D1631D3BB027ACA3DBC2505BC59ACD2BCF43A11BC5780063D873F84BD6673533DAFC0AB3CFCE8C03C532D69BDB7731FBDCC8A6F3D0CEF18BD67B95F3D93670C3D7828523D12A2AF3C1EFDA73B311895BD28E7E5BB864DC2BC1618ED3C429A22BD1FC72ABDFA29573D20DBC43CD0A473BDC5F090BD191383BDF6C51ABCBBB3703DF64E8FBDF12F4E3CB1F85FBD242933BD12BA0EBDF1108C3DE3530D3E08B83BBD717F4EBC4242323D689265BD2B99FBBD763F523CC2F96EBD63B03E3D8B1C023C8ED8453D3DBEFD3C385C263DB55835BD5084FB3B656D21BD2C5C843DD46883BDBF0B16BC6EC0A83D6950D6BC2706263C7A3EA0BB8EAD49BD903471BCED16CFBC936708BDEBE0A6BDFDF9EF3DE45733BB3F8F2B3DD116883DF6832DBD0773A4BC26297E3D9579B4BC3BEFE43C32A614BDC1590CBD3553B23DDFAC213DD7E9D63CF29DA53D1A566C3C968AB5BD6B39823D2513C6BD231498BDF54D873D32AA50BC4EE286BDD12EB0BD49934BBDA6AB933D22B8B23D33CC23BD24DAC03DE5C5BA3D25A8C9BD04488D3C5BA60B3D0CEB71BD0349AD3BA7A7163D3C1843BDE6F03C3CB313833DE0FB67BA77BEB4BDECCBAC3D734EFBBCB6777B3D6E7087BD7A10593CFF3A043D4E6EB0BD45D48ABD617FC63CBA4FA4BB7798A43CB7C8413B0849043D9F2C4F3DA2D5983CEF7E32BDBAF76DBD78B56C3B9037A03D6F08CF3CEE93A0BD4E18B9BC2E1D9CBCD90454BD77B6A6BD57C98F3DE4CD1DBD4E43D2BB542182BDFBE32CBDF8CC803DA130ADBDB8ED8EBDFF65E83BCEB0F5BBA6B14DBD50C60FBD76C1E23D385E9D3C88B2ABBCFF1B22BDC259D03B52DA843CE8E4FF3CC5F6773DB6EB08BD60AB1D3DFE3DC93CDA1491BDDD62323DFBD9FABC707451BDE4E1E7BC09F80C3D7AC8A43D54FC2E3C03438C3D370B24BD10DF083D3E14023E5F71603D77467E3D62067A3D8B9302BDE62FB6BD7C5A0BBDCBA4613C09C9DA3D0D0AA63CE2E2F23CB234A5BB0B9D2A3D9CFD203CA1BE6EBD1DD23FBCCB0FA83D69E9E13C22148EBD78C915BD1326F5BB28C3143C8F01CF3D00BC483D526E303D6B7812BD6A15B4BC4819D33BE726003E7385AD3D24B29D3D2C27AEBD217E1E3B760ACC3CACF3BE3D8FC9243D747609BDB9C56CBDC73337BDAE786FBC1D44923DC0098E3B24A89ABC4ECD053DFFB2303D18149DBD83C2923ACC9B333CBBDDAC3B94E7913D3A293EBD430189BDB69D26BDA2FDB7BDADC0723D03F6523D9A14D63DA413083D72AC66BB955858BDD3B0373DAA2B1B3CAEBA8BBCA1E4A03DBF5A653D70F7433DF13D1DBD590A7ABD5565AEBDF648A63D7E0905BD40DBC0BD4C84BFBC301E8CBD60FB893C73B72DBD88419B3D2F27833D69FB023D97B1093D2D9EC93C5F8B603D76392F3B3B3375BDD01CE53C5A8B4EBCA0E747BD4DE1023D17C48BBC3C58B83CB6D4463D06A43A3D16176DBD5447ED3BCBD9A13DC6A14F3D35A41ABC07D0FF3CF82A353D7FC4B7BCC9701B3DB077683DF94CBABD5C39F03C0973243B4D1BB73DACBFC43D7CE396BC59817EBD4A016BBD5606C13D612487BD6887D63CAE8D1A3D4F8B923D6AD4703D2DF053BCA298313D80F3BDBDC4C564BD20E6C23C4F3C44BD281CB6BDDC45313DE949BEBD2ADEAABDC407393D2DF4DCBB801CD93D9E55833DD325A13DDE9ABC3C17C524BDDC57CFBCD92C85BDCFF67CBD28EE86BC27FF9F3D06D781BD0A0AB4BCF16E403D5DECB3BCB4902E3D75F60F3D6C69BA3D7B14E83CBD3E91BD4BDF73BDAE9DC43C82995F3B719DC83D16085E3D309DD0BC8FF3413DB72641BD55DC4EBD0236BB3D7C4250BCD40E0CBDB7E82D3D8821533DEC64CEBC1FA871BD481CA8BDB09E67BC14674A3D618DB63C32E95B3D84C1B73CEA00E5BC1D275A3DF19C0735B8CB523C79948EBCE2E186BD97936F3D33711DBDD6BE833D96CADCBCB04E09BB59ACC0BCB56F143D6C9D1EBDF0B4743DB4E81A3DECF7A2BB00078F3AA8E1C2BD0052B33D3C0FA8BC3C4AA3BCAD3738BD5697123D700B3CBD9AC6473DB89A87BD05CF3BBD48AC21BB303549BC9B89F13C2C9FAA3D45AE5DBD6589D93C799D7CBDEFFA143CC1BC823D3FE2E6BCD317743D7F5F25BD0936663CAF91233D9D642F3D9E8D7EBC7462D73C860056BD3D99C13D17A99FBDCD6E81BCF3BC9A3DD0CE56BD3DA5E4BAC90234BD1B80713D1116A33D0C2DBD3D7092FDBCB1599E3D4B936BBDFB57E5BCBEDBB23CBD307FBCDC21C5BC3C9A503D632871BCC32BE13D80F7303C3B0550BDE02840BD524D0F3DB1BFF23C4DAC963D07E334BDED14523C1D264DBD8C459DBAB58C363B6387673D7A55193A71154CBD8D3CC9BC121AB93CFDC459BD02E05E3DC8A7013D4FA34BBD131F48BDF331B63CD26D7F3D5ECC4F3DAE0327BDC94097BD190FA7BDF3398DBDAD1530BD10719FBC0CB6D43ADBABD3BCA9ED31BC1CC625BD1717F33A67D3A4BB5B32103C74341DBCC32669BD3D9EA3BDE84ACB3ACB294B3CC2B4E73C36F1B5BB46EB093D41668DBD5B7B8DB9CA65913D2CB40B3C3AA14E3B80DC743DD6E1443DD392D4BCDA265BBD90C48ABDB27EA03D1F4F983A71B333BDE3935E3DF6E0823DB5D7A33D973F613D41D49F3D547DB4BC6596ECBC1931A6BCE4A715BD359552BD6202413B2F2A6B3DC4081D3DF0DC4BBD66659CBD722EA5BD320464BDA3B7263DF55181BDE0C6763D69A168BCBF9BA0BC0F34CFBD1C3A923CAB35833C32F8CA3B7FA140BDA45485BD4E2140BD870644BD79ED7A3D6E1177BD0709B63DD1A9983D1959B73C5DB660BDB02588BD7ED16B3DB928F9BB2333233CBA9216BCED300ABD6D48D2BC3094963D85B1AE3D5DB3BF3D31397FBB841D903D12199DBD7D1211BC0396173D8863BC3BD0D971BC7846BFBD02FCB33D4D41193D27EF6EBB95A4823C5CCBC33C7D6B973D6E95EC3B1F2B843DAE8245BD705EC2BDF3FE8E397EB2B3BCBB1B99BD268374BD2615823C18CD053D1811063D63AA13BD7B79AFBD9E30ED3CA467093D1BC8AC3C6423823D7F3F83BD57A9983D96968C3D4583683D2F9C233DD49D62BDBD6AD13C618439BDC68F593C89D3A6BCF196183DCA05923C81F3BA3BFFA3D8BB8445133E2A9CA13C5830B63C70D8A73D3DBD8C3C3D44C03C607CD23B03DC91BDAAF4D8BC508C883DBB2D7F3DF61366BDF40234BD750F013DBEAE1ABC291BE8BCA93B9FBD484BB2BCD543363DD824903C3C37AD3C55C9C7BC0CCE263D803402BD84C0E7BC5E8D9EBC8164A33D5A67B4BDA539F43DD0DD2ABCD93C0C3D7DCA54BB48567B3C7BE016BDC354943C9AECDE3C52E351BDAA3C0A3C535A623825B11CBC355814BD9E4B9A3D9C69FD3CC605BB3C894412BD17827ABD4B5075BC99DFAD3C7734CD3CDE29E43C35E9B03CC8C024BD49BBE8BCA8A70C3D09798EBCAEF8EB3C5E08A43DDAC003BD83076DBCF22B1CBD17E3283BC6DF27BC115BE63BFDF09FBD8219913DE94D98BB54CBDBBCE1A9B03CC65F9FBDB20E82BDB116C7BCB4BFD13C77C36FBDF7964F3C24344FBDCD8BA13BBDDE1A3B84B9A6BC1839A4BB3B13773D653E663D51E7273D07563F3D6C75953D0FA8EEBB4D18213D93F044BD9E1F42BC5F9D0FBD2D95CBBD7D18153DCE98BABC474FDABA16DE163D7BB9A33DAC28B73D9E519F3D1D858FBD0BB201BD46F196BCDE3B9CBD99777EBD38620BBD2019A6BD224496BC82DE983D4F7E4D391FC9B73DBAFC51BDFE0ADFBCF3228C3DC0E7873D4C9D1D3D9511593D42EA8D3DC008A9BD29C0BC3D99B40ABDAA16093DE368C9BDC3FF973C3533B73D5A50CA3CD393FFBC508D5C3B488498BDF5F7EABCDEFD01BD4BA0B53D608159BC39AA8B3D3FB48C3C9C0989BDCCD42C3DC46FA7BD77402ABD6225A03DE2B8573A3EFBCDBCDAC0453D9C398D3B0C6668BD6922B6BD6E7577BDB0796EBD000B4DBDDF840BBCF9DA963D5748013D814E9C3C97A1A53C09130ABDE1304BBD07B480BD2F50123D7ED3353D8CE3473C79FAC73D5A7DED3C7C96E5BC767D9D3D515C42BD20E39CBD668E14BC9A5E86BD9824B9BDE7CB42BD0D84223D2A842B3D101574BC8D0732BCB25C4ABD9959C93CFF09ADBCF325B63CAFC047BD6572C33C0467D6BA70F433BDAE72423D42C111BD6C174DBD9E8ED2BCE78F973D905E0A3DB3EF93BC19EFA53BA9D756BD57BA0ABDF3DCFC3C058ADE3C6747AA3C4CF4B9BC3F9D90BD034697BDCB26833B90BC10BBA1177CBDE6384F3CF8C480BD7A9D61BD47F49CBCB2E475BC8E0480BD1E072FBA6031B83C37B9233D5EAD91BD985CA43B74D6003DDBC2883D22ADBCBC9525AFBCAE22FA3C65924B3D2D963F3D46EDECBA152E193DF66D333DBE51A03DFE884ABC864A37BC467E8F3DFBF7B63D6CCA043D1908B8BD92C176BDDB21233B35AE5EBD6916203D035781BD595CA637841AB0BCAE68133D7F7F1A3CCA9268BD00F5DE3BF6B8BDBC32BBC23D84881F3DE729713D460727BD1EC729BD69701E3AAAE013BC3FF14CBDCBA1FDBCE06BE4BCBC5E68BDDA63423DFB273DBCB42CCA3D04F281BDB7A85B3D428850BCAB8C8CBC47F0143EF16581BDB920E33C689169BD0C8E353D6056683C5C8D7EBB16231B3C549C92BDBDBE5E3C7B128BBDE93AC0BDFEF2D3BCD45337BD7DC8403D9A95EEBCE6B42A3D4119563B178F8FBD7B6869BC542560BCCD2811BD59BCAA3CB8609ABDAC281D3DD59805BD07D8903D8C1DDB3CA4EDB33D7C4D2A3D43A7683CFA34D43CC217533D288FBFBDFF79113DDCC1A7BDDD51413D8D4C633CEAAA8EBD4DC509BDE2EB64BDB5AC10BDFEF3EFBC64E01DBD349B583C1D9F2FBD10CB6F3D2B639BBD0E8D1CBD5CFC87BDA86B903B5EEE1EBD397F0CBD71D18DBD051776BC86CA93BDB91BD33C079B773D9598E0BB00CEBEBD9D039D3DC8E8F23CFFC432BDECF35CBD99C522BD0DE8893D6F0884BD1299ED3CCE1A8ABCF29E78BD6D23C1BD12928CBD1F03393D7C567C3D2AD183BA45FC203C9E2018BD5D38BB3D36454E3D1E8782BD531E9B3C161E69BDBE92703CE5BA983D8D6D223B212E9E3DBBD086BDD208593DD4C492BCE4185FBD220FE53C5F77AA3D2AE78D3C7B3A8FBD16609DBC447C82BDA5F36A3D0AD316BDA9DF64BDB49123BD53F9A3BB726C9EBC6E2F75BA27E01EBCDC84893D664452BD843EA23AB1E71B3D845882BD4CC1313D4E0463BD413A303D8B43B6BAFCA175BD24D07EBAA2F5963B72D730BDC77F83BD812C023D56F6B4BDF2CB30BD05FF133D2F8DBABD3D26AA3C139592BD0A77A7BD2EEFB0BC924DC1BB8517C0BC6DFB123D71206FBD44B79F3C7F3140BDDA5284BC743F72BD56F8903D088A3E3D7C0AA23D845DE7BC6F0AC2BBADE8013DA735ACBD2A10443DDEA8A43C0703B6BD9614833DB77ED93CE9FC5C3D44268ABCAC81663D7802833D8ADB9C3D548AA5BC8CC59FBD5B5A963CBE6A133CEA22873C9C7B823CC54B3D3D2D95743D24B684BDEE153DBD111697BD2602293DBAA409BD160DADBD00284D3D66D0563D43AD43BD67DEC2BBE8DEAD3D5702483D9A6B79BDEDA00EBD6B2473BC60F3493DA3B97DBD69DD4CBDD2C2EFBCB3987FBB598A7BBCE7B748BD52DC4ABBE90B04BD48BF6DBD2D8367BD39429EBC2FE0863D91FB99BB6D06EC3B8DC275BD181E43BD0485FCBCAADF883D162A83BB01BAA13CBAB41BBD8F398D3DB040C1BD39B31ABC464FEBBC14DEE3BCB2CC48BD6A5D603B4A9B883DA33A66BCB89585BD3850A5BDC3A9A5BCD334143B563E7DBD95A735BD7358253CBDDD2C3B1C7A463D44142ABCDA3CBBBC980D4ABDFA1072BD9F243BBD2697BA3CA8D346BCFA7AAA3D9E82FCBB9C98343D6904F03C08A48FBD5C6B853D13E78DBBD239143DEC472CBDB364E13C54D41FBDCE07733B08BE7DBD81FB9A3D3DAFA4BD445EA5BDBAEA48BD9F21A13ADF42873C50E928BD5153F33B7D73153DC01468BD302818BD6E80883D54A2403D5366AB3CD58D753C1CD8D33CD894C6BCEF00C43BE138F5BC31FA62BB293F97BCD20B87BC673F80BD86AD10BCDA121E3DD471513DA2808D3C916B01BD6803A1BDD066833D73818FBD8556903DB4963D3C35D3843DF57446BDB943743D92891C3D6F71933B4993FA3C7863ED3C78B5FE3CCCC29A3D5B271D3DD48810BDC88058BCC5B738BC0D50233D9BA008BCEB944E3D042A0DBD7A8768BDE971BCBC1B789A3DE780FDBCD256A1BDC535873C4EEC613DACE78C3BFF3949BC5B8CFFBCA0771DBD9A31AC3A199E8BBC4B28973B02AE9E3D56685EBCA5BA93BC81A1CA3C5B76553D50BF7D3D9F6957BD5D1538BCA5C0AABDC74439BDBF0D6B3D41B7F03C5383BA3AF8CAD23C129FA4BC1388BEBB179498BC5FEB4EBD76F6813DDEB484BD687A9B3DC0B97B3D526F503D927E543C5C917E392CC14BBDDCE5BD3D97D36BBDE6DB493C9D9882BD9DCF27BD9CC2ADBC00615A3DA8EF70BD0C62BC3DF4704E3D5E0191BD1650933A6527333DCFB428BD38627A3D1F4C77BD607C1C3CFEF220BD061B22BDDD5D173DF9C659BD9FB6C3BC28CB903D5B9E393C111F67BD1B62103CBDE5A43D50828D3BDA3EA6BD4AC7863DFE685BBD434CCFBC0378C73CEC315D3DED1D02BCD8BA5C3CDD1D56BCA980213C95781EBDE23B363D182226BD1E8B0D3D21476B3D53437CBDA8D4A83C96DBAF3C3E6D86BDF3B4A03D0701F6BCE6D88C3DA6C350BD29F530BDB22D7BBD7B634DBDCC7836BC09EA8B3D80DE9BBD4C72063DE2F919BD26A37B3D5E71813DBA7D503C105E363D8FF796BDFC23ADBDE1314438250428BD5C737E3C1A166DBD2484453D30C4733D328EA6BD6B828FBC13B343BDBE9BF5BC13D0313D555E803D26A1BCBDC61A40BCA152AC3D0C7C27BDAA91B0BDE1E365BD7718353D5163F43B0DCB803D72155E3DE53B13BD6B035EBD82E8243C0EAFACBC01C2583C4684C6BD24976B3C5EB045BC1E5930BD67FB8F3C0C47213BB3C111BD77585ABD8FF0903C82EB783B68A7E23CD79C9C3D7DB5123D4162723D3282963DEACB97BDD4C9A2BDE677D73B0466C7B9DC000CBCDB78BABA58A5513D3133753D790DC13BB953E2BC349F76BC4CCF533D09A6F3BCE265A3BC8FB06F3DFD9445BD2455FDBCD9BEB93C08E9103C9BE168BD5210EB3C55CEB2BCBF2C4C3D8A2EE4BC542B8ABD8B25B5BBB909923D6A17C1BC5900C9BB0ADF53BBDD8F45BCCAE286BB8974853B08B715BD98F5AB3CAFD550BDE8C0AABC1B4B103D6415723D7BCF35BDE77111BD81B642BD656E90BD02CC1D3D8BA4803D14DC603BA4469FBDB5B481BC3BF14F3D8938773DB66FDBBC9CEAB2BD954B443D1FF7223C9B8610BD2A2D1E3DF0ADB5BCEE3B8FBD67F098BC75D19CBC396A6F3DC23729BD0A8F4C3DA8E4F4BCF707A53D57BC6EBDBCD6B33C47B0603C3C2591BD1FB8983C17698ABDDADE7F3DD4A512BD4063DABCAA4F83BD078297BABC494DBD9ADEADBD5BABB9BC3248D43C8CA9D2BC81C2423D8CBB503D48DEDE3CA5860FBDDA6E84BAF84284BD0A93183DDCEC46BDDB878ABD6DB5A8BC96426F3D70B2983DFD3055BD901BF23C504B4D3DD3C7663DE9990EBC5D686F3D95BE193D6DE1B5B9CED91C3DC19D463C2302803D3921653DA9C38DBC4A7DBEBB253C0E3DEB6D923DB1D6DBBCA8894ABDD0106D3C403A87BC60FD55BD2D5F893B7CBF78BCFDFD793D0A3AC0BB3210DB3CFA27063DC4BCB03D8E629ABC90B24D3AC0E772BCBD9893BA490EDABB32BF6EBC6BF5633D064A3FBD3E4D513D81F45E3B9F1F8E3C5E9064BD7E1772BD66FC943D1F65133D8D2F5EBCCAECE8BB854808BB5D75C9BCFC0E8FBDAADF383DA5AD503D96827FBC0AB9973DC91C7ABD8DA3A9BDBC03123D5F07AA3CEEDD91BBA7AE30BDBA0C243D482938BDD3824B3CDEFFE53C29A3683D15F488BC25E7333DFAA1093D1CAC233D416F6D3D12F4673CD7621C3D8A4A19BC25C9CCBC85564ABDFD9C7CBD1BD49E3C36CCF3BCAEF197BB396109BDA02881BD30D8883D7BAB9ABDA8FC69BB5C4586BD499C69BDE1C0933D7A48963D088259BC21E23ABDB0658ABD4C08093DEA0EDFBBCDE889BD98031F3CE8E3C53CACE195BDEC2ED0BC8230A2BD2DF18CBD2C0A893C9D223B3DB2298E3DAF747BBD551E833DA90D793D8C6995BD7EE3923D0DF5843D4F716E3DD253843D4F2C6D3BD390D2BC6B709BBDDA06993D25188D3D37566DBDEB6DA13D186492BD676E4A3B67C9123D16E71BBD535D843DA3E2843DA21DCDBCA62BB0BDDE4FB13D3A0B143D4489333DF1E4993DD2C250BD475188BC5E2EE3BB26CD2EBD0A2466BC1ABBE13B1605EB3B0C620ABDF3EB733C49209B3D541D6CBDA27C753D1B2C253D24DBCB3CB15195BC4D41BC3CBAC067BD00F1913DF456903D807C323DF2DD87BB8959A53DC4F515BD5E2C52BDC8BAB13C5A6998BCEF76743D03B7DABC598C493D4A6BFB3C8EC6553D61F91EBD9CD68D3C531CE33C3CED9F3D962D74BC3C6CA2BDF87A843DFCBA2A3DDDA42B3D40F7503D6EB1BB3C4567733DD6A9913CE66B763D6A6C2A3DBA6D2F3D1578833DB0CC89BCEA499A3D9DB2653D766942BD4A48A23C8ACF84BD822ECEBC51F4EBBC95CB03BDF28BF63C533999BD35DF12BDCD0517BDED8D2ABD4FCD07BD551429BDF9251DBD87DB8F3D7002573D8A2E99BB90A1003D021C063DD7303FBD6FBC1EBCD3F2683BF2A25E3D4B0EB8BB7E6305BD5CEFA4BDAA4CA9B9C3F655BDCEE11B3CCC235DBD0ABA583DBB820E3DBCD1FF3C95090BBD25DA703C0FDD353BDD115EBDE40D0C3D785C31BDE32F15BC52C1DF3C53BC71BD6BBB8CBD84D4CB3CC18E8ABCD06592BDD32D96BC4824193CF8B090BDE98E36BDECC1FDBC6145913D6598C6BC903F82BC0A64F33C51C09E3D1ED6A63DBB0B2A3D8C1517BD1E525EBDD63D4F3D99DAA63C3B8597BD9AF403BD7BF1013DFCA2B43C978492BCD46473BD6F78313C4CFF3B3D9FBD8E3CF513183CAE7F873C997326BD2058E43AC7B482BC0B63483DD70F92BD2066C13C9E0F4D3D190457BC1039873DF5E00FBDFB2B18BC6B991E3D5B8459BDDE296EBD7BA0D1BC0B2886BDD44F913D83DD8D3D9D276CBDA6D3063D2F7D57BDC8219B3D73A0EE3C8E6F223D85C3FE3CE491DBBC6C68403D76A01D3D389F813D6E6DB4BC7D4F933D8C63753DF5711A3D638A41BD62F15EBDDE329E3D4CD197BCD0D08E3D73F0D13CE6B467BD897C03BC7C6ACF3C21317D3D8356863CB4530CBABD712C3A02AB95BD2D79933D215DA73D67CE14BDBBF64A3D964911BD07A31BBD6623233CFEFD8FBD1BB0A03D175686BD4CC6D53CA6D030BDE72B0F3D17008FBCD8759ABD80DE97BD4D0E91BD131D303D49FD403D4AB69ABD0DFDA03D2EACC2BC12501BBC515C463D8CA1A73CF1DE223D4DB64D3D354F2CBDF01BC63B8401DD3C778EBDBC45D784BD447F5CBD7453353ABB1CFB3BC2AC673D777F12BD326C013DC3D1B43B9FF1493CB135F7BC7EB4913D623D03BC0865283DCEC6193D05FBB6BC3ED20E3DB81171BC2CA0A0BCC749283C84C97BBB862CDFBC23C1983D8DF53F3C1F27053B6CE9B03C79B2BABCBE984DBD6F28C73C543ACEBC7EFC18BD6D40C0BB0BBD2C3CDAEE4B3DEA9A123D8F3E2C3DDCA190BDA052A93B656B493DCF74C8BC31C9213DA5E35FBD090E8DBDEB1D67BDBB5C6BBD165D063D8871103DC93AA43CEFCF833DD347963DD3E4293B8A148B3A240B633D33464ABD19388DBD9512243DAC3F8DBC9E9E40BD7E3D1B3D3D4EFB3C7DE781BDDE52B83C37CF853DA99D983D82A766BDE7DE8B3D6E605D3D82FA733D9ED04E3D777CD8BC0D1906BD95C1A23D5E974FBDEC97913D46834C3D1695A03D4001A73DEB1A2F3C2BE9AF3C24ED0A3D975DE9BC2F0885BDF6AF39BCA18602BDDA44113C5C21FCBCBDFC8FBD3E7D473CD06D903D219ACBBC8B4C89BD93735F3D86FD6D3D596B36BDC497CABC7270DEBC91609F3D4AE017BC5062D03C860EC6BB06D41BBD42CC13BD6AEE9D3B5F27813DAE1A5B3D5775873DA2FC453D097E97BD2801D4BC62540D3DB4331CBDBA1B2B3D988A1FBBF03DD0BC2F6664BD821B4C3D32A6953D5C67A43DE65466BDA6031C3D9AF6953D53644FBD93FF85BC6A90463DBB6319BC522B9ABD650F613D3913253DBE659CBD6F6B8EBC61144ABD7BA5EA3CD41938BD06403C3D2F4BA33D79F752BD59011FBDFD6F92BD43DC623CA4CB24BDA507933D6DFF86BD8012A4BDE178703DAB45233D063BA3BD0E39F5BCBFF7413D5F5BF33CF063A43D457E403D3A4C39BCDFD23DBD482901BCE6783EBD47DA01BDCCD480BD25DA4CBCBCC53D3D68D791BDA1873C3D9C257C3D8580ADBC6576603D2A4DA63D1C9EF7BBAF33A8BC91C8493D6599953D8DF0383D0E63F03CFCA6893DE7E384BD801476BD63287F3D00B02BBD2053523DF381FD3C9BCA823C526A163D6026533DEB9FA4BD801C31BB2C346BBD4F8B843D0815F4BCF0A8B63CF540223DDC8249BC9E1869BDC79F15BD4A21593D1369783D7ACB2F3DE9EB32BDC7136D3C1416883D00A285BDF8DBC53B9A80C83CC59EB8BC7B379FBD0F1450BD66FD4ABBDF545D3DA20761BC3066CE3CF87247BD95515EBD2FD9C3BB4F5E18BC4CA714BDF8394CBCB68B8E3D428F37BC3C49C83CC293583C9B20FABCFFDA2ABDD18AC73CF101933D7C5D90BD4AA03F3DF6B69E3D683F593C862A85BDBEC2333D5D051DBD27D338BD395480BD549AC13BBF92943D3ED3A23DA54E82BD2C0D41BDD265A33D6645863DD1F998BD3BE9723DB6DD9D3D5437033D2270B33CAC4A9DBD66C11DBD8138843C84C952BDAF0D603C408F03BDE0C78FBB4ACE41BDC95E44BD4754B7BC7F36813D1E6D77BDCCAB873DF677CD3BE0E01A3B3771933D7797E33C503AED3B55A0D03BC213A83C00D3813DD65F5E3DF045323DC97E20BD71B09E3D9A62703D601ED13B967F1B3D261F33BB3C7F2ABD01AE973D8AC81F3CDC4E323D5D51823D4DC4F0BC80B5E83A56E5E4BC06374CBD70899BBCA839BB3CC033DFBBED7D203D740D75BDEA33183DCF6F463DB7B137BD4C5AF23C6B9C10BDB59397BD09B7313DFF18143C1B8DDFBC11BA11BB9C0C32BD41A58EBD2A1D723D3894B33C7B6A9FBC7D76A0BD495183BDD9A8F93C40A85E3D7A2E81BDE95CE93C9121D9BC95DD9A3CE160423CC0955CBCF06A85BDA63BF2BCC73DD03CB2B42CBDADA618BD7187253DD65B8B3B954487BD03988E3CD7C394BD05FB48BB5C134ABD73E03F3BE0D9543DE37E67BDA2B5F9BB9CC4A1BD842F05BD4B9F953D802DE43B7D3E903DE6E89EBDC02FAF3BA6C9D5BC81169ABD802928BA62BCACBC684F123C608236BD98D6763C1E0D123DF0435A3DA0B6EDBBDA80213CFE1ABF3C7E499FBDB66246BCF6DC14BC134526BD8051853A9A9F193D702D283BF3CD08BBC93A1F3DF978B1BCB7B2C6B9AA31843D91CD8E3D8AFA243D3064BCBC6FB6BB3C6EB0543DD0D3BB3C08E2B33C4028EB3A5BCCC2BC85C78CBD065E393D2959893DD8C7E5BCBEBB45BD88F7B93AB274913D737F993D574552BC5A15793D1280703D707EED3C1B66A5BCC0E77B3DC1AC0FBD1E114D3DE180273D325F89BD056C863DF04288BB0C769FBDDC0591BD94EDF9BC01E5F2BCF306D0BCAFB99E3D52619BBD135DA7BC2A152A3DCEE64C3D851801BDDCE0C13C885F5FBC2A4175BDEE84103D9EA76A3D3D26933DDB7F8E3D3AA797BDA87AA0BCF08950BC040F4DBD08FD3ABC3011FD3CA31A67BD00A4E43C46510FBDA1BF09BD807CAB3B8E075D3DBE8B463D3DA29B3DD0E3273DFC448DBD9116823D1CBA163DE69F603D484F193D19F58B3DBCFBA33C78A903BC268E293D0486D7BC0C9282BDEC4EFD3C92A306BD163F5F3DF553803DB8C719BC46683C3D24D79EBD5661ECBCDC969ABDC20EE7BCF4CB993C567E99BD6EA73E3D662461BD8F7E92BDC246AABC8A406FBD085D94BDC077813A7A4B083D34D32A3D824991BD1041AE3C70D5BD3C226C5D3D85B09ABD8095E33A1BFC993D8CFEA8BC78E9BD3CB0A09FBBC886AEBC32FE723DE0A15BBCCDB98F3D80A24EBD3E66303D0A2A303D2229E3BCC0103B3CB6534DBDF0DBAA3B688332BCE06298BDBB03A43DDEBB8CBD3D5D88BD7256303D8544933D8A75223D38A461BC7EB70BBDC48EEE3C867872BD8122833D495977BDDC3D82BC383E51BD8F5854BDD8B2B83C02EBEDBC40F75BBD053A9B3D7AF9F3BC40E253BBB8692ABD8E524CBD980F423C06CB49BDBD619A3DE6886A3DDBBB8F3D0A115E3D827E433D8EDAAFBC98BBEDBC2AA1533D002EDE3A43ED8A3DC0274EBC40A4023BD45B11BD38C3D13C62C3543D20732F3C63E89B3D7BA19B3DF4A472BDD87D073CBACC103D90EB583CC8BBE63C3A83063D1C30063DF8D1323D6B4D983DCEF0713DDCC0F03C8EAF9FBC8BBF16BD38C4F9BCAC99823C6315953D22A31D3D10B0E73B6306873D323153BDABB9903D644F013DE9AD84BD6466113D427F00BD56BB523DD6725EBD1010A1BC3CE60F3D0423B33C72977F3DD88D76BCDE806B3D407BC1BBAA091C3D745FD73CD05EA2BB1809633C5EB4373DB80B34BCEEB7373D73E5A2BD4E9C30BDD4B3E9BC14A393BCD6994A3D189D7BBD410609BDEE6B86BD8E0127BD7DA93FBDE0B88CBC389A683C36315ABDB817A4BCFE10593D1C87CCBC1C79D5BC4A474A3D9181983DE01ACC3BBE6113BD357BA43D9AF3293DE678E9BCC06FDA3AE87388BD4C09AC3C241AF03CC85970BCF4A9EABCE6C170BD601D75BD5219193D23E9A33D7864553C389DFB3C7EA0753D188F073D64385DBDB80C763CC275303DE6A6A3BD84EB9DBDFF888A3DCA755D3DD6065F3D066E99BDB067143D0DA490BD6A1415BD71B48A3DA43562BD0C46063D6B2F9F3DAEFF86BD4815C33CF1EA7BBDB07AA43B80A473BBC64A103DF2DF8BBDACE4D73C983746BC03249B3D0077AA39903F493C56CFC4BC38C115BD74C0E8BC584F0FBCDEB05BBD0CF6E13C80A5A7BC44D1083D2056D33BD0CA95BD46F55DBDC07FB6BA87F7843DC6ED80BD33ED93BD8C379A3CB00699BC501621BC0C4BF6BC2C84C5BCC54C4FBD08FB90BD321B453D02655B3D3C9F033D5A6C6D3DDCCA57BD3F77A53D7ECE7A3D097A973DA2DF1B3D8E872B3DE24D6C3D86B617BD5071933C485C68BDB0122BBCAB36913DA4AB0A3D7F9493BDC32D973DDC348F3CF0CA0ABC209B2BBB4436903C4818783C00A80D3B24F08ABCAA7624BD2ABA0E3D606B923B27072EBD2C21AA3C781F543CB8A346BC50BCFC3C72F15A3D3688ADBCC77095BD6CE974BD6D7B0EBD693D38BD90232EBDB87C91BD471C8B3D00A2C439503E97BCC02D84BB5082B43CCD826ABDE0E303BD1E1C5F3D555F10BDB8F3243DE2643EBDA0871ABCA090C03B46360A3D025C1FBD801595BBA837CD3C51E00CBDD7B64BBDEADB1A3DB466F3BC4F8E53BD82FF6E3D2FD744BD445AC63C343CCC3CFC2F46BDC37F43BDCC90B1BCB40DD13C8731823D08784E3CFA5A4B3DB803EABCE6EC5A3DADED91BD7A375DBDF7800BBD811588BD825AA2BD444BEFBC7B6C72BDA8B546BD880DC13C74B19F3C0DF19DBDD3019C3D902C30BC5238113DA466D33C5F2FA13DB82D703CFAE5183D92B4FEBC2F5977BDC8B8C43C3459163D681F953C1B448D3D602B1D3DA2FD343D00E941BA8CF8AB3C006605BD567F5C3DA970803D7ADA7E3D47878A3D53899EBD5A399BBDE0BAFEBBB8D886BC4C1A9BBD7F4606BD8095983CAC25323D7EB30B3D2208243DAC24823C6AEE493DB0C02DBD8CB5DD3C5ED651BDAE1C5C3D00E247BAC09C40BC98A79ABC90FFA03CD08A833CA08F7BBC3F158C3DE6221ABD771A9EBDAC7472BD87811CBDD3692EBD25F105BD3095CC3B16A52D3D276866BD52154C3D2339A33D00500F3A5ECE9DBC67B58B3D3E72283DCF208B3D0B1B40BD80BFD63C40D0013DB0E625BCBF7C903D6E89593D8C100C3D86F5213D322BF4BC274E21BD922D223DC4F84FBD729D763DA6C7073D80DFC83AAA4F393D68D138BCF5F733BD0D1F943DD49ACE3CD685653D05A29FBD135B963D620488BD4789853D3637563D120B763D80D25D3A20926C3B00C3463AB0F3893C8E4A123D3C9197BD704EC4BBEFA2993D2237703D234947BDE0042BBCE02D51BDBF0B8D3DE08780BD828EAFBC68F0E7BC6C61103DDF7B4BBDFC4274BDDCAE813C0889C33C81899A3D9851E1BC85AC56BDD85F6ABD629E39BDB4D103BD88DC543CD67F483D8B9CA13D80D22FBAC0B279BBFBD7A5BD2A834D3DA4C5003D864C723D542A94BD206E193D9A1B97BD9609533DD201123D6620EFBC2291C6BC0F2D813DFB5646BD22B95A3D606E12BCA6142C3D4E7395BD323D8BBD92A1373D70DC11BCA62CD3BC603B073B9095FFBBDAF7073D28B8963CD82E9EBDD288343D42030E3DA0BBFE3C601F08BBF15893BDEDE017BDAEB184BD6012093D608D1DBDD0D461BD7868243DDF0964BD287CD83C48B3B83C98EAA23CF040CFBBBACA573D186B1F3DB3B09B3D592E27BD293C92BD60377B3CDA2D3A3D88D6ED3C35891BBD586F383C902B85BD3799543D56CD003B800E7DBBD08A603DA5A9763C8E4988BDD301E53C6EC6363DB3BF02BD873B21BDFED94D3D466ADE3C34BB5E3D562EA3BC48E6983C66B3643D12261FBDE07518BB436215BDE2B1573DAEABD4BBB1C1BE3CB27C23BCAF998F3DD130103B9D96A1BDC60F15BD19AB0C3D507F133CD5ED6FBD241F76BD5F8A5F3DDD1B4EBD090E44BD1961BEBC534B6C3D52011F3D25ED13BDE7928DBDC9D1D2BB91EFE5BCA344823D271B95BDEC3E9FBDCD92AFBBCF544ABCA29CFFBCB156F83C00304DBB7F60A3BC67EA77BDA394FABCD39EA0BD41767DBD3B97D6BCB269B6BC343F45BD8EE783BC1D7E71BDD7AE263D84E7D4BC0A86F23C858D463B9045BEBB92728F3D15FB09BD0B5DB93C9BDBBF3BBCCB873C101E2F3DDF458BBDB69232BA536A6EBA01CDEC3C6F699C3D63876F3D64C026BD1121263CEE285B3CC556AF3C442A603D43DACCBC052F4C3C712C863D8874DEBCC36B99BD802289BDF4B06A3DC29CA03B0F2F7FBD279A493C566E693DA0F4C93B698B0A3C2C9EFF3CCE19D8BCFDADFDBC97101BBBE36197BDD9609ABDA45AFABBC918CF3CE2C2663DC5D88A3B8E0CB6BC187E8F3DB217ECBC04EE8ABC7194833D40144F3CDCBA283D0FEA9DBD1A9890BDAE88633C59088CBDF247573D3E42523D8D63BA3C9C9FADB9ACDF843C2F8E973DB5898ABD4C3E6ABD1A1165BDC3D456BDFD0C993D366097BDDAB89CBDFC754A3DCE84543DBD1998BD359E86BD5BBB83BDCE5E8E3C49BB493CBA7A95BD586995BDEDFF973D4C32E03C4482683CD99ADB3CC8F44B3B28419CBD8370163D0A56CD3C864ACF3C63AAD83BC52169BD3DEC993D257002BCDC23B3BB3A56A0BDA57110BDA85775BDB7DF233D02163EBC1CB6903DEEC143BDE21DA53D3BB6A63D9E42043DCE219FBDE1156D3D4062013DE131663DC181A13D1ACD7ABD2B53673C82C6A3BD4B6886BB7DDB35BD9838D33BF542BABC616D4F3C085BD03C5FBD9E3DC2395BBCAE3079BD10F7713D49E411BD34EC3A3C95568BBC04A64C3D23DB8D3D25AE4BBCBAE1AB3CC3FD12BD5A44733CCA2A80BD24D6993C5CEF7ABBC08B203D0FEB613DC65A2CBD2E953CBB237E07BD4E729C3D7B4B24BCB76C823BE036943D68EC9C3D6994893D2A8F983D43E68FBD062394BD488F833D778A6A3952908EBCEEBF2EBD292082BDCDFD3D3D525F203DA10A86BDCB6E393D9BE4533DAC0191BDB76B753DCAC346BDAB858D3DECB2BEBCAD8F783C92E34A3D5439163D998C383D6641FDBC92170B3DFE030D3D62DA413D7963683DA53EBB3BF99CC2BCCE30C33BA891A1BDDA4655BD6B27A03C0EA41ABD722E953DF260703D8D4C9B3DAF38A4BDD27D05BD68F722BDA30683BD6A21353DEBF9563D0CDA03BD12E559BDF6032CBD832E43BC95CEA63A67D64C3D703E26BD115B003DCE3DBD3BDA52D0BC0BE892BBA71A78BDE11AD0BCCD33E73C155F87BD953490BDD8B33FBC9D2B7ABD7BE981BDE1AC62BD70603D3C8549173DBD9CAABCD009943DA9B30E3D47858D3D4CCB123DDEC58E3D05BA6CBDED6B2BBD62623F3D5E314F3D4B1293BD6A16DF3B5E0E5BBC7B6A27BC24C59A3CDCBBCCBCCB9A8A3D51FB2DBD47F10CBDD936C2BC42CA32BDABA3943DCA82A43B9EE156BCF8B6A03DE90C99BC796CA6BD4FC384BD51806DBC30F5753D82CBDBBC18DE82BCCCA8D83B061D0BBCED6646BDD62C503D42AD39BD7DF8523D213186BD4D9720BCB8C663BDBCFE973DAE8CB3BCCE4B8F3D724FA33DBE0E1FBDC900EFBC6DD8763CD208953D05CA5CBD1BF9A4BC6D1B93BD9C9E2BBDC5910FBD6055BB3C36A076BD43BD67BB6239953DFB0EA9BC15CB8F3B1B220EBD0F14623D644EDCBA87E14FBC5D19043C9091CC3C29EA8ABD5881DDBC41E5293D6C11583C5726A03D5E5D6E3DE0F60A3D0F394ABD2AE0BB3B2D9D7F3DF078A0BDA35B9D3C8EC27CBCA4A71CBC2C668B3BE9D0F53B8B0276BDCD035F3DC9B8613D30E6A33C260898BDDAE2A63C975987BD7E0768BC7E1614BCFE98B23C9EE594BDB86F473D0383863DB80AA33C06998CBDE1FDA03DA10F52BD9B4A05BC35DC31BD940A1FBD4FD54EBD6B346BBD31759B3DCD3918BD049114BCE1C0A73C006A08BDC19B21BDB63B063D7081B8BC7171E83C8B60CF3BC2496D3D1779643B8CE02BBCB5820F3D293B16BD58605C3C43C2803C6C883FBDEF1585BDBE7F27BDCDDDA5BD0D8C613D8DF300BDCE3FB5BB8280D7BCBEF147BC3EDF9F3CD20F0F3D7A08833A9BAA9A3D9E0BE5BCDF7A6EBDDC4357BD7DA87FBDD2D95BBD1AE4FF3A83379B3D9EC9A2BC3ACE8DBDBA7DBBBC89B707BD09A8723D6C46B0BB1EC6D93C3C44FDBC7ED3D8BCA1D149BD88A3B43C464D933D21E6E3BCAA9AD73C63A20C3D85D70D3C4C3B1F3D5EF3803D4CBD2A3D0BCEA0BCEFF002BDBEA38B3C792FE3BB2DE32FBD758A9D3DB7F97CBD17932CBD0259D0BCBCC48E3CACAF0EBC9FD41D3D275D17BD5DE1103DA74E4FBD6D14BBBCFED29BBD2F923E3DA064473D3FFB103D676A37BD9622D1B94E3D0E3CF5446F3DC5CA81BD473C4D3D480DCDBC097C11BD3FCA113D0F1C6F3CC95B40BD68CB93BD0E63D53CC90E10BDC9AB8C3DFB627B3D155481BDF58E2ABD4BB583BDF9F314BDCEAE683D199C853CFF194C3CFFE51E3D28E898BCBE4B6EBBA0F7A1BDEB905EBC4A93883AFC165A3D8961CB3B89FE9ABD4F4C8BBDFB6794BD3482263D59BE943D00F0A0BD05E866BDCBD096BD4802673D376012BD2B2B2C3D0F88213D1FB780B9E4CE0C3D811E9D3C74C492B87A37443D2979803D9D664BBD2B3D04BB175DA73D4A1E3DBDEA5EE1BC59DA98BDF8AC903D48B3A9BD0C93A1BDCE8C803D0A72043DD9001C3C0DEF5F3DBA87A43D6272E13B74172E3D4F082F3DA3841A3DE29F203CC1B694BC8E1D853DAA63F73C7AFC08BCF802C9BCDFA789BDE7C1303D6CCADD3BA348B73CE99CA2BD084F883DE9399B3DCF3384BD7C6870BC891514BD91C12EBD00E3D2BC0BD3D5B7DD988C3D8870133D90EA85BD1FB8373DD2CAC43C8F3C033D596A87BD4B59A2BDBAA3953DBEFBA03CDDD4B73C3F5235BDCBFE843D35895ABD28B243BDAEBCB63C302CDCBC9A7986BDDA2140BD16B1A13C58FEC53CADC4F9BCB4B39DBDC86E39BD8A1F20BD04394DBD00A179BD85D98CBD462F3C3D3FC18FBC6A5B883D453F613D0D7DA43DB362CDBCD8822EBCDDC4AFBD1CC08A3DC2D48B3BA068293DB6D2A0BD7C97973D48554D3D1D80D0BC2BB64EBDEDF309BD495574BC37809CBD36C1FD3C913A133DBCDA9DBDD67E0ABC4983CF3ADB22D9BA1CAC213C5912943D26005F3BA4C98B3DE3C8FFBCDF9786BDE7B014BDE761183DCF7D5E3DDB0726BDBA16453D81C2A03DCFAB2C3C78EE833DCA215C3DBB4218BD034E9DBC0F9A4BBD232CA6BC31CC413DA931F93BA0210CBD3AFE8BBA8BB6903D6FE000BD858FE8BCB98A57BC38D036BB30B4AE3CEEB1523D10E7763DEFC4B7BC442B8CBCEBA7E8BCD61E7ABD0C6171BC4B4B383D3D7359BD248D5D3DF1808D3C7EE68F3D044B7FBD669C2BBD2186073D9FC77FBD76CE3E3DEC9273BD6FE131BB5D06D1BC61D5483CADD6773D75C640BDB064FABC88BB85BD3A146EBD0BCA2FBDA697963B3A2822BD3C3A6B3DCF576BBD36AC643D423A983D4C004EBDA66B093B0E95303C0E2C3B3DD8461ABDAB00363C9636A5BDD7770C3D763DFB3B88F12FBD615D26BDF04A093C50F59A3D1697283C0BB391BC4B1F343DE63E433DD97D45BDCEB48DBDF5FF74BC9E2C62BD153F56BD138BA4BC15B8AB3D884B883A4579953DDE2186BD8A2A6EBD9DD191BD67388BBD47455BBC9E509E3DE89C783D63126DBDB8A2473DD348E53C633693BD3FD1643D0BB48D3C00E895BD4FC2823B06A889BD045B1CBB9D0C84BDAF368FBC61BD233D5F12353CD3489E3D8691343C83000D3CDB61CEBCBA19AA3DC6337E3D5BD693BD741192BDCE7BBEBC208522BD0CAECBBC78E446BD81FB843C8514943C95E8803C5615983DD211BDBBBA494DBCE76A36BD30F6EFBCDBA7463D601BA8BDE2918F3D3DD41F3CCCD63BBCACE5023DB531ADBC05EA11BDC6A6CDBC9C013CBDADC16EBD38ECC3BCA92525BB4029C83C1ECBB63C1EDDE7BCF286833D30AB833DB1D77DBD9D00ADBCA5155B3DAF5DEC3C4A0383BC63836E3C75283B3DC4A850BDD38B77BCAFA1E8BB534CD5BCB25574BDB3C9533D0C4D02BD3B5F57BD3284AB3C166E7F3CC408B03C60E73A3C2444803CA1EEA83D6F9A523DB8822A3DC6588FBCB96E90BDFC2371BD0DDFA7BC0736873CC57991BD7EB9123D6C6C823DB2B4C13C92D8413DB84E533D3C6261BDC7D3933CA917D0BC021A983D358074BD9BACE23C07E98BBB5A4B81BD67DCA13D7F94133C0E538B3DCABC8ABDE2B1443D2DB199BD36CA8CBDE23E113D37579E3D337438BC6A820CBC6D1F76BD42B47F3B096B91BDFD9156BC90554D3DD8DF433BAB87243D3BCB9FBD89BBEFBC996F55BD899C82BC580354BC91768ABBA190E23BDB68D1BC81B6F23CA27CAD3CDDC917BC6135E23C4E1F9B3CFB954ABDBAC39D3CAAC2AEBC2ACA0BBA8AF1503D654D573C0939E0BC5852323D76531F3DF3B2783D59A185BD966C96BDAAE4AB3BB2DD943DF96F67BC8423EA3B75C23C3D3262EA3C2FBA6E3D22D869BD1157813D687F1DBD8B7B873D150C4E3B21C540BD1D0274BD250987BD7035ABBC50298ABD868E3E3D826886BD4C699BBD742C2BBD87E2513D2AFC4F3DDF9E94BADF13303D4245B6BB51CC9C3CDA4E73BDCF6C96BD34859CBD6862783C8D7AE43CA7B69BBDF28616BD00F858BD8C4DB9BCD35B8ABDE93CAE3C4A07903D475886BD58AC443CD11991BD989560BD80F4203C09E3F73B11FCA2BDA5479B3D75A034BD3A4688BDCB6182BD2FE540BDCA8383BDD641B2BD0B9B88BD0ECD1A3D7324663B251A81BD79CD84BD6DD568BD8395083D19B29DBDC78F513D54864CBCC3F0CBBCDF9236BD71211A3D817B2BBC1C80673D7EF7AF3D8ED681BD4A6C8A3DFCE775BDBF8887BDA75D84BD845C193C541BBE3D537ADB3C15F25F3D82439ABDAC11F9BC9BFB7CBD31E3E23B4E1F3A3C919A393D4D5E9CBB8AB689BDDC9B8FBDC3486D3D8343873D558F7FBD5B3388BDC664E8BC1C276ABDE796013D6B2D12BD3A2CA7BBEADE35BC2E24DB3B25078EBAF1DC823B5960CF3C711F113D600F5FBC89BDAD3CA234E8BCB518993D23F480BD0FB1863CDEC3BE3D479F503DE77D63BDF2CE88BD124A0ABDDAF510BAEA89123CF14C8C3D91B8783D5790793D7BBF79BC0B2A783D79CBAEBDFE8FE6BC949A93BD2B613CBD0A5DE53CB796803D9E969FBDA731433CBBEEF9BB3FEBA13D478EA2BCE0F2A73DC9EF9D3D0C2302BDF68932BBF9F293BDB7FC77BD0E0105BD9EAE1BBCD4E2C5BC693B47BD800B17BDC720AEBD2DDDC5BB88A9BABCCC1F56BBCBAD3BBDA60499BDDAA43ABD2EA3C43D2B23543DFC7F803D491E5CBC321DEE3CEFEA90BBD671833DCA199CBD8720543D916348BD6D117CBB5429C3BA1C2671BB1BC582BDEE6991BCFC442EBCD8CD873D746F35BD5DA904BDBB27BABC547DA83D1EAAAD3CA3568DBD3EEE94BDB1189D3DED52A8BD2843823D42E62A3DD5B38C3D97022FBDA19FF5BC5ABA353DAD4758BD5A400F3DFFC953BD9BAE05BD01473E3DA04EEABABF4811BDC70D90BD3F2F283DF619443D0544873B05E17EBCDBE1033D5B32A7BBC325EFBB7D501B3D1A3C5E3D8AADB53CFF2FDC3BC9C25F3D4E3D683DAD1A003C30CAB73D55ED1B3D2A223A3D088982BD962D94BD4ADEA33C061B52BC23F357BD8BD42B3DAD09853BDA1F88BDB9829B3D29097B3D1DE5CC3AF3FDE4BCD43186BDFDF5D2BC309FCC3C9389A03B74B84B3DF2D7943D1318F73C194C813DE3108D3CDF31B2BB4A09473BA742CCBC6EB192BDABA1063DEA16723C02CD8A3DEC7C8A3CAA209F3DC18EC93C2801BCBC395C7ABD46E4823B07692C3D91958ABCA97F7E3D3E4AA5BD32375BBD4E90923D0A95B23B6ADF893C0B118C3C827BC73C9978F03CAD58B1BDE64C59BD6056BA3BDDCC4ABDD4C552BD9918B33C280F953D05AD7E3DC2E705BD61F9F7BC900F1039FF4EB6BDCF44A3BD3D064B3C519F893C6EFF953C54A7593DD06B973DA1081E3DD5294A3C58B28C3D9D3277BDA979A63DFDFA18BD93498C3D738E29BD3AB4E13C9F6798BC85358DBCA015163DC53D1C3C8DA7D73B3B3AB23CD63F98BD1E15523C494C9D3DE99268BCD95D0F3CCB9C3C3D7CC525BDF7CFA5BB69AA82BD6C1262BD46A524BDDD0CCF3C0E2423BD05769B3CBCF918BD6608843D2B352D3D3145853D5DE3ADBDFB00283C9C8B83BCAF82E43B2CECCBBC27217D3D7A3D733C7405063DABFA593DF0CB91BC1B118F3DF3B9D3BB164B683D062CE9BAFFD29ABD0AAD2FBDF95A5EBD40BAD8BCB99297BD4AA1523D12EA1EBD8197563DD13BAF3B6AC7CA3C8E6F473DBF448B3D53765ABD6D7E88BCBAFD393D7002263DCE89C5BA45109B3D7A6E813BF2849CBDF0BD003D28FF8F3DCA1AA93DEA42BCBBF79A8C3DD08C773D522B7EBD69187F3D9F9E6A3D9690233D5662A8BCC050523DF8707D3DB51318BD95C35ABCD072943D60BE9B3B2692F8BC5BE304BDA2E32D3D1DB369BDA3DE573D7C9AC1BC847C813DB068823C3046183C3712733CF0E880BD1C513EB808AB263C2CC8CE3C057A7A3DB8EC7DBCA5C48B3D35D50E3D0A8E073D7D95CCBBAC1578BCD79B80BCA48966BD68F240BD26A71C3A048F11BCAB2A8FBC110548BA2CED41BC8C047DBDE16C0E3D0165BC3BF3D8453DAE51343DA92E873D4AA3CC3C43182CBD523299BDEDC439BD26F3033D1F33863D428F0EBD1B643ABB2C4A67BCC15591BB03A0B7BC3F78EC3CFC786A3D511C29BC9A936E3DA1247ABDF992DE3C5E86FB3CBE646E3C44BCD9BC760197BDD05C6C3DCB491A3D9834703DC1DC98BD3A04E8BC3B660EBD72EC9E3DC7626ABDEE960BBD3703D3BC9B63963DAF93513DB19E56BCF9E2573CF9D0A4BD87B3863C7C7029BDFD7805BD0CFF84BDDEDEA43DB9F7533D1F7399BD6E68933D435FA7BC80838EBD7221093D82C55EBD59F466BDE2209A3DAE05F4B9DA48073DA310AEBCC05955BD94F996BCC43401BD99E61C3CA47A8FBCC9A8223D76E46A3D4C7749BD4039D03C465A863D73A026BD7C84B93CEC9A41BCB3F5543D071599BC310382BDFE2FC13C8100783BB651563D425BE7BC348236BDF97C86BD812E45BD4BFE693D4B168BBD40C4A93CDEFBC43C03E19CBD1358423D65437FBD32831C3DDE2F01BB3D80313D22B3B4BD46F7A73DDC1677BD82E6263B885C30BD947B1A3C3FE212BDA26F4CBD9280043DE509753D122953BDCB9B23BD0560E03B60C1743D380626BD20AF69BDCE1993BD47DD013D4B48303DC42244BC7E69BCBC16367E3DBBAB1DBC3B423DBDC5A994BDB820173D3AFB66BD4CD356BC0F81D0BCE328583D57147B3DD5DF983D00AE333C4DA860BD04B089BD6CF2863DAE908FBABE2A33BD92E7E03CF7FB1C3D749E0E3D488CE0BC37D8493D565447BCA7F2223C516590BC8A73973C144E803C3BA1973D047E143C5C0769BD37A267BD025779BD46371BBD566F95BD18B5F83CD4344EBD7DC575BD37CE79BC9262EF3CFDF1A7BA8B7E873DAAB06F3CC7AA4C3B6CC5BEBC1742833D861796BD0657A13D10CA6BBD84B597BBC15E98BD27C588BD5D72CFBB1CB62CBD676497BDE99C2D3DD72DE53C22A5B53C05CE6F3BD724B33D65C510BBBBFB68BD958086BDC4E8853D9069FB3CF51390BDE8707ABD32D3DF3C6DF569BD109D55BDB2C273BDF17A873DCFCB17BDB74A52BBD143DD3C8BDE97BD27B7B33CEDFD89BDFF7B33BD06A674BDED9A65BD92E1443D2B2B523C21794E3D812A4B3D47BD5E3C324491BCB7AF8DBD99DB803C534B92BCE3577B3DEAC87ABB310222BDEE7BA43C1DF87D3D4809B43D577953BD097341BDCD0CDBBC99FC80BC160B533D1C658B3D2E80B23C785137BDB43463BDAAF758BCCC14813C53D713BDA40BA43B77F9943D72239FBD969EA8BD970169BC15DB9BBD8E70A43D66C3503D375D783D3BE7503DA557DBBD39DF3C3DC764CC3C86AF0ABDA6B12E3CDAB3F7BCD6F6223BE97D8C3DAF3AAF3D5F51B53C22A2643DA6E352BD5387EFBB341E8B3D80FC693D8EDE693B720FD53C8687543DD292D63A720863BD623FC83C1885F13CCFE78BBC10B1D1BDAA481F3D34ED183CDB85103DAEFEB73B8631B93C1F3B453D07CFEE3C6FC9163D57E62BBDDFAA45BC9E04C5BDA606A03C34343E3B209D25BD7FC0A2BC7E4C283D13FC8E3D728C84BD93A1133C9EA6903D678F43BD0188A93CE9590B3C3647DF3CE4BAC03DA0EAEFBBD81BCCBB5356763DBE0AD3BC87412DBCB750AD3B0E6275BDAF3A92BD0AB713BD377D7EBC0A967D3D886C9FBD1D8429BD3546EB3C732806BDF33C16B84E0178BC86D8573D717E59BC0EDD3E3D57EA823DE1419EBD628937BD2D8696BD8C595DBD39A02ABD504983BD5620E0BC26E0913D427C5BBC7165493CDAB5233C3FF533BD7922BD3C54DA863DA9D858BD3ECED43B30C41DBD9A8F963D188784BDB1356C3C529B3A3DFF5719BB9AFB123D72B81A3D633A56BD459DA03DA1E6F4BAC97D96BDFDA4553D6DC3783C3088BF3C2E22993D1D03ADBDA02F513DFCE43C3B1BF3853D4C9064BC18E3803D505B523D2CED94BD0FC3C7BC002B94BCDB5154BD07379C3BF067A03D7BB2A93D47AB6B3D2F073E3D75EAB8BD3B20FABC9A2082BDB3CE74BD922DC2BC13A0813D0F6CA438C5CDACBCC35A423D27689CBC10A3BA3CFB7DD1BC20CC843DC00F89BCABE23B3D1253763DBD755BBD514C583DFA0B00BD7D8AE83C66D08C3D3BFC783DA3E78EBDB00A833DF3728A3D8268123B6A273C3D29BA3F3DABF29DBD80DC67BD78B1F8BCE5FB7C3D3A968ABD4D81AEBD177C8B3B68E5643D2D56603C6DB484BD3BBB803D0C8902BDD1954D3DA57D0A3D0A6A64BD98585E3D18B642BD664F81BDE3D31F3DBE3973BBC9C81BBDC87452BD0CBADD3C9DDEB43CD998093D42C3EB3CE328683DCDE590BC90A1BE3C22382CBD93C407BD17F28C3D28BD953D8072053DBA37F63C088B52BD31F59CBDC3FF5F3D1CE2DB3CB26F86BDB7E775BD30416DBDF615A3BD6248E3BC726182BCAB9A95BC51CC78BDC858843D123A903C5DEBE33CDCAD803C1824E2BC232984BDE8611CBCBA2886BD16F2F0BCA5A648BD6F44883CF3E5593DD8CAF63CEC4239BD6250FFBCDBB10E3DDB57BE3CE05655BC694E123DFB635BBCFF1C30BDE58F833D47A994BB242450BDAAE88D3D2E143F3D7FA1033D53B2293DEDA71C3D56F69ABB42B63C3D0518913D4FB64DBD7DAF94BD12E632BD912F2FBDE2A30CBC36DD68BC4AFA4BBDF245443DE3FB513D4BB569BDCC7B7A3C5D94CFBC3D4E6A3D9B7609BD183075BD5818F63C52829D3DC5983DBD9A46813DE7D2E63C3EF442BCC410C7BDC8B8713D42002BBD906EA9BD3927863DDA4A783D4D842B3D977A02BD5D39433CD48196BDF9EA8ABDCDD4963D0E7E4EBD9701413D9CF1533D066E69BC72201C3D0316823DF94DAF3BED7E823D59D9A2BD9E6A543D9B7631BD5D33D6BB55042FBD0848723DA42C80BD74A97ABDFA97473D867394BDB31D423D2A2315BDDC2E1C3DBFAACC3C833590BD36CA79BC225FC83DAB47373DC7593F3D8718CE3D4C4E2BBD9200EE3CE3087C3C76699B3CFE5155BD728C2B3CDFDD57BDB518ADBAB5820E3DCFE075BCD24E893D3A7D03BD033D673C3303843D3775C63C76D62EBD37283D3D38C531BD466BAEBA3009553D3A57DABCAC9546BC48465D3AEEAB6EBD1ED167BD014C463D13698DBDFB4F57BDCEBC193D445282BC705C47BCDB60703D7E4D9B3CE39E5A3C8D5DD3BC96C4383DD6A5493DAADD50BDAB939EBDD6F2C63DFFF94DBCAB8DA83ABAEE093DF42BAB3DDB2CAABDECBE073D65FC533D7673EE3C93CA74BDC23461BD06935DBCA965723C17757ABD96651B3D8DBABE3C3110B1BCF110F5BCDDFF06BDF4B1CD3CE0F499BC282D00BD36F0193CE31784BD8EF128BDE03FEFBCA2FA5F3DF4B512BC9A32AB3C848F5B3C10F8B13CEB8FC1BCA66D1E3D6DE3773DC3D8A43CC29C03BDDC4D713D59F37E39719DD13C9AC52DBC9C65EF3C2161C93C1D97403D365F813D69C5CA3C6A560ABD4C21B33C0DE05E3D75C96F3D76849ABDAACF85BDF5570E3DC986C23BA5BF09BD51A59CBD465115BDAC0D763DF613143BFACD7DBD68692E3BDE5BE03CF9EB6ABDABA357BDEA6C173D723EEFBC30130ABD8D52953D4813E7BC68DB99BC94AA78BDF5741B3DD7D9A7BD14682CBD71994F3CD4649DBD2DF50C3D5512EBBC9EAF053D399939BCACF745BD271098BD19ADCEBC953B0F3D7CE9443DC3B4AABD14EE23BDEE2F93BD74340D3DED79D1BCC97499BD129616BD45CA953D0552E93C694820BD6E6A9CBD317E103D9CEC033D37A247BDA73C883D6FBD82BD713E553C93D851BDFF3D923DB80490BD796A88BD78ECDA3C424610BA1E04F0BBDA4D6D3D3987153DF4C501BD4D02E53CB992D3BC24301DBDF205A3BD3CA5FABC2FC1D0BCD945D1389BA159BC8D6A6BBD59317A3DABA7DA3CA6FC96BC572AA4BD377F84BC5548D2BC03BD483D936B893D15BF81BD7C4F6CBCF56354BDA2D622BD45CECE3C6AFF92BD2BD710BDF45C33BD1995A0BD49BF093D4A1EC5BCAE54CEBBF9D72E3D463D72BDC22B7C3DC9EF393DCA74A63B780AD83D801475BDE08F593D8766F23C105925BC06359C3C871288BD2A8439BC47B08DBDD24E3E3D896A5E3D475DC73C1112453D097F123D6C67D7BCFAFF03BD879041BDA13445BDE5AD993D535E6C3D1E420A3D82EB4C3DB771883D66CB373DF8F2E23C05639FBD874452BD4D97943DEDD9903C06839C3D86651EBD83817E3D5E4C32BDF0E2E6BC07BF993D8189733D04CA4A3D3AC969BD1FB8DDBB627B6BBBA76AA8BC1E0FEEBC871BF6BC65B7153DE996EDBCEFE2BDBCE58C5ABD96F24D3D7231013DB43D33BD98D2443D893133BD1C5F22BDDF55E5BC44E08FBD9706713BE394A6BDAFB1D0BB7E13AB3DD8FAA93D694E533D2DB39F3DC7EE683DCB803CBD33288D3D4217393A5538F93C5F40BE3C739E273D9C87873D0A255BBC3AD9393D120FD3BCAFD1743C1E9A88BDA8ECBBBC25EB7C3D74A0C93AEC51933DADF6BD3BAAF4EABB46E982BD4F2FFDBC56A2A43C26D3D83C399DC2BCEE05EFBCD28F403C0AA413BD2A349A3D6B8F24BDB1CB543D4176AABA6FA1F9BC487559BC10FC5B3D99CC42BD224E6DBDCCF34DBA59DE803B09508E3C7BBC673DE68DF4BC3FE5553D90BD9FBC55AB81BDAB25173D48DEAEBC39C291BDB339483C9B9E99BC3A07B1BCA8607B3D44469FBC11E52C3D748E8DBBA2E687BD117525BBB946A2BC3FDD2DBBB1899E3D85C4A03C2C367A3D511D9BBD49718FBDAB3D1C3D26D4DDBCFBB7703D61D4A73CAF3586BD758E60BD17992F3D21605F3C3A6E7E3CE33E56BD8CAE8ABD46A04DBD55AD8F3C2501603D12989BBC6D3866BC74F3793D804A8D3D60549C3D21D3773D031D4B3DF5690EBD2957403D74E7F53C757B2A3DAFADF1BC71C7083DB5C59ABD89C0803D436880BC46AC1EBC737DFDBC24DE43BDF16A11BDBF241CBD3511723D0E80173D7D4CFEBA7C348CBD0CF90DBD037E713C1F2B8DBDE4ADE13C656F94BCF3A815BDFD0D35BDB761FE3CC74D92BC5B48E53C57675FBD9D520ABD135C5CBC978C75BD7F0A4FBD45BD04BDD5648BBDB593AABBF4523EBD7F2F2F3DFA22CA3C4DAD11BD662C9A3D083430BDFC76333D098C85BDCDDA1D3D06D68B3D171661BDDBAB41BD14F8B6BA2A33763DE84FF83C284258BD9FCAA7BAE9BAA43CEE7985BD4A04ECBBBFDCA4BDCC5CA03D914E8ABD0ACB80BD82FF76BDC33A9E3D87799D3D0212A93DBC9D903DA7CB83BD7B71B0BD02E3A0BCA4BC66BD90089E3D1DE89F39B75F593D125A22BDDAB67D3D792AB2BCD907D63C74013FBD941FA0BDBF7A5E3D983E393CD95F403D392624BC1C8B73BD58421C3D6BF9153D17D5953DDCA0403D3A78243D74935DBCF0E343BD1A4F99BD972EC3BAE90A8C3CEAE3133DCD377CBD8B008CBC9D867C3C0CBE3F3D361306BDB06D32BCF737143D3DC13FBD042B113DE28F383DBEBD95BD184E0D3D8518613D05CB67BCE19B15BDD58A30BDF13A28BDB522933CEB93933D9D07A3BD1001A23D39C0343DE6B3383D61EC6F3D54963BBD45FB9A3DE60C8E3C41DFAF3CA372423D9346F03C604A70BD2C369A3D5BE8AC3CB68F823DEBBEBCBCD504143C1BBE1DBD4A78AFBCFD651EBD05EAE5BC3321C63C708B253D6A2E483DFAB6563DA386993D35ADA93D6C67943DB2D73B3C1D389A3D4938793D5461153DE5BC86BD6C359B3C2F009BBD6B529ABD99D58EBD690E843CD0E3523C467B47BADEB874BDB3E1F8BC1B31603D7AA517BD8C21BABCB09978BDD0748C3BFD1AA83CA5ACFFBC736F2CBDD2B4943D5CB9AABCD89D04BDB612383D95F17ABDAF4E143DFC99F3BCC50F7EBD22A29EBD982BF1BC2AEE9EBD1D8D533D7C797FBD63A5B13CFDFE2DBD7DE406BDA3631FBCF4A8923CC7BC643D71FB503DEB2B173DDD7669BC223544BD779F163DC5F8B13CAB6A853D17055E3DE360F53BDDB280BDACA782BD1FC414BD9241B7BCA5FBFF3CFFCCCC3C7DC260BD140D473DBFF6C0BC471F123C48794B3D0DE278BD7FE52F3D5404B2BC4DE516BC090A783D481686BD75FCA33C676D7ABDE9B6603D7EB0923DA6AEA7BD2EC5B43CFF5560BD07BA08BC28D7B3BC09B8863D0D9E90BD77B412BD918B14BD4890003DF1827BBD951ACD3C49FB93BD345D78BB00FF983B86D8F23CAE71BCBC48BC8EBC83B542BC27DF28BD0212B1BD62B19ABCC2CE95BD622D213DE38BB33C9D1C80BD5AC2C8BC81A08C3DC56A57BD4C4E6ABD1898133C76DA08BD3E36A73CD68BC2BB91958C3D18BC4D3DE85E393D903A8FBDC274A1BDDBB9EBBBE003BCBCC8D3BF3C5870F0BCD5AE4DBD7CB0BFBB89647F3D353EABBDCB7C90BD1BDA72BDBCAF36BD0CEC86BD343E71BDF812593B5968033D7494BB3C1134053DBB466F3D5237893DCD1D303D447F09BD60A129BC5009A0BD0A591D3D32CD8B3D984496BD5406DABC3DFC63BD0ADC1BBC2281523C4C23593D1DEE58BD79D1E83CB2B7E83B5F0C9D3D6D42663B49F8763D2EF488BDCA98DCBCFEE48D3DE22A4CBDCFE24CBB3AD5D9BCC906463D9E168B3D28E8493D27B5733D09AC29BCC27E863DA7CC333DB211013CD929113D717467BDA78C3BBD41B1013C5A11AD3D5549C83B5126D0BCA6E7533D0481F13C489394BDB778AF3C4D7A89BD53C1583D37165E3D6799A8BC1D66843DB7FB643B6B3908BD45E11DBDB1E278BD4B68FCBB853EE7BC81EE24BDF98570BD5EF07A3DDDF964BCB4DE783C909E923D43AB84BDD2B60A3CE60D4ABDFC1862BCD1D150BD18905D3DCC0FAD3C871649BD954105BDB6639A3B674C8EBC4BE9D9BC36ADD13C10D047BD7401BBBCF3E469BB9E58003C3E4CC7BC807297BC8BB65B3CB83B843DC6F2D73B143B79BC702A723D6897753D50D57E3D0EB79A3D31C02E3D9EBE87BDDCD2483D74D5863D8AE17CBD0CDE3EBD324164BD0C3474BD667696BDE87F2ABD547E96BD3312DC3B7627743A11AF3CBD8E0E19BB216EE1BBB2F5D7BCBABDE8BC6C6391BD384FAA3B10C8773D424C5FBDA67CDB383E744EBCD45E00BC3D37983D011B87BD5C564D3C702547BD0630C6BC50FD7CBD2F2940BD2139DEBCB25B93BD5E5BA4BBA4894C3C94D86CBDD2450BBCE433ACBB22CD19BB687397BD5AAC07BDDD33563D38856BBDA21B5EBC5F2D78BDFCC5DD3C7BB035BD60A950BC451C19BDF4129F3D60D196BD91517BBD87CD92BDDA151FBD9FEF60BCB13612BD7C24993C2AB4A53C22F6983D68CC91BC0949423D31BE1C3C0799583D43802F3DAF74333DFE06953DA6CF203D8C00093DA637263DAAA38DBD0A5212BB239D88BDA6527E3D92292EBDB299153D0F3F803C8BADA1BBAEE53A3DF79939BDAC1A6F3D02E284BCBD816B3D5EDC8C3C5A1AC63BD54A003D687191BDEF189ABC66E1403DA89D96BD46A0203CD9183FBDA8F586BD1FF40FBC567B77BDD6DD1B3DD099E0BC7F4B76BD565E0CBDB6829EBD704B8F3DD25F413D66252BBD502156BD9479973DBA2F94BD8511F7BBB80B82BDD87D3A3D986A8D3B5220A3BCF2264C3D43D7E03C75644DBDD2747B3D82F9C53BB9D011BDE72C1FBD391F083D6AA6A1BDBF3491BDDF489ABD9E242EBCBB464ABD689D8CBD2935B53C7F7DF13C15C20D3DA06B063D47800FBD7F13313DD54E563D4B97FFBC2168ED3CCBE9613D0009893DB52F8EBC7445203DA42794BC3CE994BB30AB92BDFA8B503CD37C823D176AF1BB5800AA3CDD55493D85EC6C3CD275753D58D9923CD3CBD4BC393603BCE93DE4BC2638933DDF54223D26DC823C436F45B837B9863DE4DA9BBC6A3F413D9C290A3DCCAE873D2ABB24BD612A933D447C8ABCB14292BD0F43293C1E5F1F3C70A49E3DAC57083D9FAC853CBE2DBDBCB0BC8FBC169B9B3D14BC8E3D88FF203C7A95A13DF021943D1A6D963D4EF002BD12C8133DD26732BDA7923A3DA3BDCEBC3F9653BCB6775C3D3B7BF03921D63C3D6C23C53C30124BBDCF4B493D9D9DA03D11AF703DA0B4BDBCAED617BC290F83BDCAC919BCA69EE5BCCF34643D168C8CBBC03DA3BDAA9DAABC47ABCD3C344289BDED05873DCDB387BC9199793BEAF6CABCBAA47B3D1A9D8CBDF40003BB8E6E583C1106273D324E40BD8C71B83B5EE4EDBC67DE0A3DE1478A3D27C48C3DD83362BDCF48F8BC80CC133A59C9403D9FEB2BBB023F74BC2A4B08BDA75E8A3D53158C3D8F469F3D473D6EBDF7D035BB50BB11BC512467BDBBAF08BDFACD383D22A1663D24A135BD97043F3D30053B3DB2E70F3C0CF3373DA3CBA43D61A28BBC2755E83BBBE5203D0260B0BB8A978BBD10D12E3DA68590BDBCB844BD9CCD5D3D59CCF93CD485F23CA27951BD512BA53DA1C4ED3CDD2E0BBCDB5EE3BCCC858ABCD3920EBCF0C58DBD78C5833DA6CBC3BC75EA5E3D1D520EBD6EA167BB187DC2BBC69738BDA79A12BCDB74823D2118D9BC122438BD4F5E4D3D9A8369BD928D09BD12AFE9BC4AE0673DC39622BC88E6803D665EA13DA2988EBD9DC2203DCF95A0BD86B555BDA21612BD202556BC1C07FDBC7DB5E03C0BC184BDEB33A53D668BC23C209808BD672C33BC58E094BC48689DBD4E093A3D4ABF543D5D0150BD9AC723BD307ECBBB922D69BDAEE703BD40351BBB55E8A2BB14EE36BDDB2F81BC4343843D9EE85ABD75C6113DAE09A43D8726723D0512063DCD04883D19BB633D59CAFEBC3B9D8C3B599A09BBA0CAF23CEAF8953D3FDF993DCAF9293D9ED823BD30BAEE3CA82722BC3191E2B8415F933CB5B7563D1684293DC09F2F3CAC4923BDF8650A3DB70885BD08F5C2BCA027583C5F94DCBB1A65293DD4E99D3D9E84C83B483E313D9A31933DFC4B853DE8E5A73C7286BA3BAE406E3D60FEE7BB3675E2BCD6C44CBCDD9A363DA5CC95BD1863283C32D61F3DEAD0F53BD874893D1B735A3CF525F5BCFA41783DED5209BDE8F4D6BC2B822E3BF454DD3CE3898D3D75ADA63C91D7AE3CCBA4913D2058A03D3CE052BD8A3E423D8EC6123DF115CCBCD03050BDB2B585BD451A353D9485E63C90BE07BBF3E435BBE5199B3D041073BD80A69C3DCBDF6EBDC5D069BDE0674138690B8CBDA4FCCCBCF298553D8F3AAA3C17F397BD76E691BCBF0907BDA25A9B3D003BC83CAFE736BD208AF63CADAD8CBD4DA315BDB6CC1BBD103ED83C4DB52CBDD0470ABD641887BD4FC703BD576EB7BC809E903C928178BC27FA34BDB8339B3D444762BD2B06783D7C3B523DA49A32BDEF643BBD2DEE95BDADE50D3D83225EBD0F6E1FBD603E1DBD5A8A58BCEFBBC9BCD38A98BDCEC02BBDB23FA3BDD2A4753DEED1653DDCC21DBC9DBB823C501202BCF52082BD7F259A3DFB9E953C2E9C5E3D02C5183D7E4396BD4027CBBCCC4BCE3C98B4D53B1EBF4D3D7AD49ABD9066653D586F643DF6E18C3D4F1EC1BC7EF821BD1E411D3D2064253B2F60243D645396BC91DF98BD2A654FBD736C963DB0E118BCBC0BB1BCEEBF083BBDB41ABD10C093BDCA8924BD02069F3D0277913D5F7E9A3D374F943DAF07873D1F480A3D72DD9EBD474873BC6AA8EABC9E68F03C5D8C9A3DDC7FB13975776ABD7D6C79BCBC1548BDBB0F75BC6E506DBD45600ABDF0DFC9BC7C2F72BD2E7D83BD692196BD51FC9DBDFE745C3D5F50693D01CF893D18DAF43CFEC3993C62F2DF3BB2C6BF3CA50202BC957F673C6068183DC54A693DD1A3A8BA8FBF963CA48864BDD45F713D04D159BD4A9A7F3BA214C9BC5BB7473DF7C230BD6B33893D8BC2753A19CB98BDF7D965BD87E17A3CF88783BC2477693C98B4C23C7B3818BD96A8153D981D303DA8AE1A3D4D3B6DBD57C5323D70A16EBDD6851B3D42EC0C3D33E68BBDED9E96BDF0009E3C4C3F90BD8D0222BD222A9FBD963648BD1E8D9A3D3FFE80BD77EF203D0E31A1BD41509A3D04A385BDF6E5A23DA7531A3D2B9B993D92DB753D4033DEBAB9D0C33C856E653D96F9393D88574E3D0D8711BDB7058B3D58D998BDF89B7BBD62B6203D80E7DB3C200CB43BB05FFE3CA0E6AD3C91B49C3DF6B851BD50D978BC1085403CC68A713DE3B539BD96379EBDB013A53C3D306FBD087A6DBCF2B3C5BC020F13BD4648ACBC3C26E7BC503AD33C22D16E3DF9EEA3BDA664563DCEC3703DA089AFBBC270C7BCF8DE2D3C20E48E3C83BE9A3D23599B3DD062F6BCE64C0D3D9E8C1F3D741E90BDDE06583D76FB653DA2BFB4BC2627643DB3AF953D3215653DCE8A8CBD6669073D6C1BE63CADB98E3D2043073B3B153ABDC22F0C3D567CC0BCC4104BBD474B8B3D74AF263D181EAF3C4805213CD009C2BB94665CBD141A80BCF0AD983B53B1803D598A40BD0CF7A83C4074243DBCFE88BC397C983D83528C3D703264BCD6F7363DFF8043BDDA9C5E3DA422FC3C3076733CF83770BDC0D1C03C2D0F943D61CF36BD9A7C553D48535F3CF963913D34B7E33C8D1B0ABD1A3A343DDDC3A1BDB3994BBD0211383DEED2053D8A51453DCE2C063DFE069DBC8025E73C62C83A3DA7F558BDBC2BC73C9AAD05BD00C176BD7E885B3D4039013CD6DB92BD3697BEBC2C8A83BC04DF9ABD9DDD2BBD7058A53CCFF595BD00B2D3BCE19991BD8B284DBD9D228F3D5A53A1BD0D4E0FBD8C836DBD78FAE1BCF0DF06BCFCA49E3C4259353D3F2E9C3D843180BDAE45A2BDD94368BDC82B163D28568CBCD4EDE3BC46035B3D91258ABDA09D053D80F5593AA1208E3DABA08DBDB71C8D3D28054B3CEA469ABC3A1E643D8427DA3CC01659BB6C3437BD6213483DA040CF3B44F496BD02DE51BD662D7ABD60EC9BBD383EE63C80FBD73A00E05538C0A94A3C206EC0BB08584BBC80ADC3BB3AEF4E3DFCD321BDE003023C7277673D68A1B5BCE2930F3D6DC78C3DC719A33D18A872BC4EAD7A3D393333BD96AFB0BC4E1564BDF431E53C50AA28BCD359923DE9697ABD5CC653BD41A1923DDE832C3DBA29F2BCB2BF0ABDAF328F3D7E5F5A3D30BC413C50698C3C2E408FBD80CE42BCFAA5A8BCE27A563D48C791BC47C5903D34D6C03C333E84BD45C2A43D45929C3DCDCBA33D5E2D6C3D8B67A5BD77C99E3D2DF86FBD502F2D3D151B11BDC86940BDF468203D6870063DA0827D3CFA3B6FBD580D0FBD3C82A33C23525CBD366D0E3D90FD5CBDBE79AABCE7EA6DBDC2182FBD40B6123DAE78793DE0F231BDA7948C3D987D613C74E6C13C532D953D380A12BDB0CC6B3CDA8C053DD8C9F23C088603BCA0064BBD8090EBBB8A57F0BC101D9D3C507366BC6A2D483D880A90BDCC4FCF3C26B0A8BC23B8943D80A89EBD6876893CF89FC73C800C223D5A1DA2BCF15A893D9046923B6A09433DE01CCABB7030C23BDD329DBDA832513C06D8CCBC952BA2BD80B8E73A0284D0BCF764933D684F24BD58303C3CB04CEBBB88C9CABCCFF49E3DDC71893C1A5C3B3DFC6A3ABDD40477BDF2A146BD16B0663DB0F963BDE4588ABDFCDE79BD8A9E6C3D66A51CBD302F9B3B0297593D88920D3CC063283BDE9DC9BC0037FCBC8034F7BAA6E164BDC26B57BD043B933CECAF7CBDB05CA2BBD0B726BCAE26583D300DAD3B43B88D3D1051F53C68A00EBC8BAD963D24FD073D9CA65BBD6A2346BDB80939BCB4DEC4BCE26B5BBD452E92BDC8DCD6BCC82430BC703E3EBC7C0AB03CCA719CBC3FDFA33DD8CC90BC487EAA3CCEF423BDB546983DDCDFAF3C980A8ABCA0776FBCD0372D3DCAD48EBD50BAB43C404E4E3CCCC5A3BCF20D1CBD204067BBC5FD933D19AE27BD95BC2FBD00199439805CEC3C008AE13B3A4B4B3D2761843D9051A0BB0AF67F3D07D1813D51DE903DFB4400BDE6C0693DB445303DD1282FBDA6C7273D403354BC4891153D804A45BCB6F148BDB20524BDDB8727BD35678C3D1B8343BDC1B436BD34831B3D60FD17BD68BD81BD3AE8253D667E3A3DC0E6A23B80DBF83ABBCE863D105348BC468985BDCA9B433D343E0D3D801448BA45D99B3D9DF806BD440AF13CB04D713C3838F63C6E81193D201218BCD0EF393CC1DF6ABD28168FBC288CB53CC85F5CBD462FD7BCC03EA63C14FB903C803AA4BAA33B943D8D752CBD800D0A3DD4F1C8BC5C8D2C3D8E8C2D3DF008B1BBE011453CA8B3423CE0AB623BBA3765BDBE53CBBC547521BD1881503CA22366BD87DBA1BDAC15A5BD66932FBD5280703D285D5EBD0062043A1C0864BD9A973BBD20A1DEBC00D120BA73E7A13DA41FB73CA22C1A3D2EB5F6BC3468A0BC0069CA390005823C052A883D8019363C58E42B3D60F0E0BB8E4588BD4248773DC2C24F3D2248613D9EC87F3D18482DBDE28359BD833080BD249B7ABD3013023DA161933DD8B2CB3CC8F378BC201C65BC602D03BD46670B3D5C3960BDCEC31A3D607DD73C4ADE10BD54E9B9BCFF20883DCE537D3DB0C35BBC6FF2A03DEC66313D28E1273C687764BC328E7C3DC2E9523D92BE21BD086A973C600796BB50B09FBD278B983D24C8083D06DB29BD42ECA8BCA827C0BC6D1A3EBD2D26893DFE783A3D56B86B3DCA88D9BC27900FBD52CA3F3D405D183C0867783C006D1FBB50386DBC8260093DC90C9B3D243C003DC22B94BDC7509FBD600C37BD4048E63B4F579CBDAF06933DCE0773BDD1660DBD105D94BC627B713DFCA855BDC83461BD73B7843D18EE403CBEDA593D52CC45BD81388FBD4858993CE7E478BD5927903D8EF4A4BD78A750BCD4BCFF3CD208413DD31473BDFA90373D5AE795BDA843413C00F050386B9247BD03196ABDFA49683D38294C3CA17399BDDAB05B3D42DE183DF8030C3C008D39BB206F74BCEF628B3D90DAF43C202C31BB26C0EFBCF280393D76667A3D26AA793D9D9FA4BD2895C33CCD68953DEE32CEBCE0D921BC17FE933D1CC9C83C39F9813D3C9CC43CC01EDFBAC0B6EE3C00CF393A000DBB3C80A8CBBB3B3346BD806012BB60DCCD3B444BBDBCC00E25BB7A8F233DC054053C6067023CE49E273DD5BF913D08B695BCA6BD493D0CA995BD4B6397BD920C2F3DF8F68FBCA8FC6FBD464566BDD0E3DB3C33A798BD34EB053D0520823D36A60B3D702B8ABD700C093DC066A5BCA06DE2BBF0C0D5BC7FFE843D7082BA3BA8292FBCBE9FA5BD0040493A6E25573D6AC59ABD84ED53BD80900EBC1C6D003D00EF23BBD801AE3CDD3C18BD26F9373D1143943D06D2DFBC647D87BD16A08ABDC5488F3DE0F87EBCCEFE433D9D8D823D4063D1BA52A330BD26E75F3D3A595B3D2E33323D911E843D2A4A713D48885EBC184F2ABD06985ABD90CC423CD0AA1B3CBDCA8F3D120C633DF688703DAC13A1BD295C9D3D4D2C933D028015BD32C99FBD717220BD80A30A3AF71C26BD36BC5F3D844059BD2EB4CBBCEEF24B3D20B0C2BBC007DF3B100A9BBC8088E4BB2F7598BD807F143A70C018BC72549DBD82BF5F3D80DA9A3C1EE4713D59AB883DF038C8BC3093823C72F6AABC959B3CBDFE73453D948B223DB0C7E8BB78AC6E3C8089B2BA8049893A1ABF50BDE780843D982248BDF9E99B3DAC8CA0BDAFF1903DE825D13CD772A13DD8A1F03C120D3C3DC05051BC20697F3CF264C5BC9CD363BDE8E46D3C7862163D8B688A3D48F14F3C404055BDAAB1ADBC6E85743D82750B3DF1221EBDC7A064BD580B5ABCF014833B9B239BBDD02A013C40C687BC2F0E63BD2E51023DF6E4F0BCC79A873DADDC85BDAC6D55BDEC964BBD26A347BD6B7C993DC33756BD805DCCBC9BF2923D78725DBC03F599BD1CE00FBD90C592BB980C7EBDA117A23D83AA44BD6897293CB1A54CBD2B974FBDA83A313C68A53ABDF6081A3DEAD918BD9CC98D3CC0D1873B5213523D80B318BB07359C3D23C7963DF4A40EBD13029D3DFC0C7FBD3410B03C76A4603D87EF3BBD1ECD6E3DEAD854BDAE5EFBBC4A949DBC5A57733D1CF190BC26F22E3D98548EBDB65A353DF958973DC85F223D28447EBD402D113D0E357CBDDB0933BD36FA6D3DC861133D7C918CBDECDA49BD2032523B76D8653DA96B34BD827876BD29C4A53D9EA2183D80CDE03CE84F233DE8AF87BC3F093DBDAD34893D4E7D573DCA6070BDF05EF23C987823BC9041613C0055EB3BEFCE933DA017F93B543681BCA01E78BDA272CCBCF8DF5CBC9B1D84BDB2EC1C3DC018EE3B967F1D3DB689053D26B0EBBC50F91CBC5C35F23C721B743D00021F3D968C663DB6C38FBD4E43513DC6077B3D7A3704BD0A403B3D4028433B34BE89BDE6B8583D84257BBD10D2C13CEABD99BC40D22B3CB8EB0A3CE837F63CC93C8CBD0A92743D11F1993D57708B3D0F5F963D267955BDF1B3893D62AB19BD809FBEBA089DD33CC6B44FBD70FE10BC3C16DE3C7BF40ABD53FAA4BD9DDA963DF23599BD4844643CFBF190BD4F977DBD1AB8373DBAEF0C3D12E0483D80F30A3C70B8543C50847D3CC062943BF0870BBD2DE67BBD57939A3DE85FFFBCE773B33C003339BD3893E03C6F449BBC5824173DBC3B31BB2C1E8DBD8882063DED6481BD0E3188BD36FC1FBC7B5E80BDF6CBCDBCA44F093D53DC87BD9B45D9BC5C2E143D8328943D692C693DB801A43D638B41BC8F7980BB42F70FBD54E6D2BC04D7A23B1A2099BDD76E17BC23BC953DB7EB44BDC523183D07B7873D1840643D4EBE00BDA6CF81BDD0426FBD624748BDE681693DBDAA45BDC95B83BC001987BCC901903DB07E7B3CCA6759BD967AA4BD3CC3833DC6007B3D539B55BC236E2B3D7666363D951EF43C74F5FF3A1466013C6A6B19BB38D6BABCB2EACB3C21C5F2BC321BBBBC219E37BDCA24A2BB8B8548BD713C98BD461414BDC82709BC745E45BDFC6A853D6D3F373DFD8A073DE8613A3D547C5BBD19066DBD5D62113CF4DDA03DA1F29E3CF95E1D3D05A2823D34C360BC8474C13C439759BC792A6BBD9BA2BD3C11B1C13CEB105DBD7A5DCEBCDCC40DBDF914E2BC57DD2BBC425A9B3DAB726ABD49A1013D6184943D6E56A1BBA78FAB3CDB9F853DC88E153CA3DCD1BBB04AEBBC52483D3D75ECCB3C04479C3CC5579A3DF778DC3994699EBDBC2FCB3C43FBA3BDF4A551B9A1C0823D78088D3DEC50973D4C2F08BDBDAE813D2A1A3B3D9FB59E3DFA741A3D31739EBD2974A53DE50EA4BDB51D19BA4148763D6D2C76BB70719F3C50058DBDAC4E333D73C5923CC9F10CBD69884F3DBE43C2BC3B4D22B9E081A53D96E206BB87A077BDF4F13F3D41E050BCF0AA27BD5B9A203D0B74A5BDD07EA1BDEC2348BDDC72833C3323783D60414CBC35FBFF3C622D573D15CF1DBDF612103D6ED3483DD036F63CCF91933C74B0A33D18ED23BCB7AB6EBD6614E03BA8F592BC3B3B303C3F9D113D6799913D5A06A5BD6DF695BD6C893D3B64632ABCA9217EBDF90EFC3C0CCB11BD620A6ABD0BE7293DBEEF6ABA8565603DEA29D8BC6E667F3DB9FF58BD0EFF88BCD4D81B3D6C2ED1BC2C29CFBC7071343C6233503DA3B16B3B381B543D85F022BBD8BD85BD742869BB8F1E94BD677D92BD6DDB75BCB0F7F13B98295ABCB84253BDD923F73CC7BE163AD8EDA03D6286383D79CC47BD983A6C3DC5489DBD9072493CE138A43DD397E23C86B9B63C3E7B80BDD378E8B96F9B74B9BFB91ABD483B7DBCB8AD8EBD7D868BBDB1B7E9BCC4CF993D7D18FB3CB840333DF41D9B3D2ECABF3CC0D389BA100E5A3D0A0D91BD52F863BDC1005A3CF239A7BB1A4B5EBD420865BD125B6E3C8EEE9FBDF4CB553DD25A24BDA806EB3BF45A773CF74785BD9E7388BD27E11D3DF5A9D03C9A9C833B31B75ABD230180BD0F1A6EBDC44459BD6D5857BDD9CD8ABDF51E94BDC95258BD803306BD811B9B3DCE4A863BFAE4233D763B87BD48BBFDBCD5EEBCBC67B4A23DB994A0BD1DD5D43C561D8EBD5AB28E3DE37A9DBD533D8C3B428D8DBD91EF083C42954E3D10FC923DCFFE823DA62985BD1E7787BD011D733D0965F4BB33814DBC1DF4983DEFD2703CD00CC83CBFF68CBD89EEBFBC0E8834BD3A0B543DF017963D2EA36A3DF7FA313DECD3EDBC6863533DA0B066BD5D3B5B3D2BB5D23C002959BD8F3A30BCB5B3573D02B65E3CAFFE853D632907BDE724E7BC3DCC523D4720EDBBE251EFBCEA1812BD18028CBD98D84BBD3ECF10BDC014C33C71D562BB1354ED3B94E7243D743B553CDBAD79BD0A5E2BBC7E5996BD95C19A3D5E2264BDD5099D3D0758B5BCAA2F6C3C43C4673C2054923D9D538A3D7FDD163DEEF79B3D7D424C3CCBDA8B3C9CA1643D9BED673CE6F4733D0076773DF3086D3D78C4903D0ECC8B3CDA1A65BD843897BCA74D0E3CD91B19BD3BA68BBDB52D613D608C123D23C059BD9A13A53C9A410DBDB5ECA3BDADB596BC842647BAA2438A3DE3CC8D3DFD54F1BC0897993DD6D08E3DFFB784BCDA8365BD5C9B0EBCBF2A943D7F689EBDC570DEBB00A5153D823A4CBDD25B3C3C0F26BABB0A3D2E3DC48235BD4504E6BB128A0BBDFEBC6E3DE8E9723D57D1343D2BA6A33DE6691DBDF65C543DDB40173CF88B153DBF306A3D49018C3D8B26803DCE04A1BAF6A002BD41203EBDD2D795BD1941853DD9B7AAB88FA9383D9C851D3DD647093C8A9966BB40248A3DC5851B3DFF33E03B33A0523DA8D6313C2927483D94E60DBDE7472CBDC78380BD6A814D3DB7C8053D36F4893D74BE8CBCC9FF00BD214078BD58B7603BAB11663D2D0FAC3C2AF01DBD0934E23C4195763D2E03CFBC05789C3C55889CBC1E6188BD6544073DC1AB543D178320BDB443183DFED45BBD69BB283DF979A33D7F4F7FBD24AA82BDBEA488BD8E6A98BD23EEC93CA96023BDEC4242BD4FDF9EBC467B86BD57B78F3D90112BBD66EE973DBB61923B0DBD8ABC1B708CBD3FB36EBD96BB7F3C3FE8D8BCAE545B3C9F45C8BCE6C5623DCF7A893DA375D3BA2DE91D3C051BEC3C3C5948BD021C573D01C299BD6ADABFBC3C9C8ABC191DC2BCD4F9013DAD5F793D5F4E0D3D218F8BBD46D88DBD02F92CBD1FD9373DFA96583D5939723DBFD580BC17D113BDCE70DFBCF64843BCE0B43D3B70219DBD131AE53C5F8126BCB85E423D98A5E2BC7B7671BC54D3F03C58DE75BDCE54183CE960A0BD6347333D6F82983A4BC41DBC60F386BD87DE9FBDC42436BD9A9E76BD0D44FFBBB1A6853C364E2F3D3DFFF7BC0FE6103DB78455BD381804BD587830BDDAA3503CFFFAB5BC27340DBD3EB33A3DED7030BC3258AABC935194BD331319BD81FADABCF1B282BDA951D7BCA2BA01BCB18696BD5433303C6EF99F3D0FD4A3BDBABE78BD1C8D723D55F156BDC6ED11BD4D14963DDC57973BD72EF6BC32DA58BDA111BB3C9067E33CF1305FBC5D1F0C3DEFC8783C7519273C0159353D372196BC156398BCE6398EBBF595553DA465283D98C055BD4F38063D6BCA29BB36DCA43D7F2690BD6FDB50BD7FEE84BD5E148A3DB6EF2ABD845D6D3D38CC4FBDD65D8EBD844988BDE069283C5EDE8FBD4D34143D6B3134BDA10898BDD7A8E83C2E88EF3C8CE19ABDEE4F7DBD1BE2A83CE3CB8C3CB2E37CBD2F34783DA631A83CBB356FBBC9124DBD6D5CB33B62C8BABCC14D293DD0D6303D8776813DE6488EBDD51141BD9EBBCC3B0FD8F8BC87732C3C06D9283DBC000C3D5069A2BD0A96043B4490043C4045E6BCC160593D9662A5BD387C4D3CE24645BCB14E903CE663A6BDC5C371BDF10F6ABD36A1D5BC280FC0BCCCAC5EBCB1F255BDC954B5BCC570353CED6618BDBF8CA4BDF8779BBD2391BB3C8BDD873CE7718CBD8EAC573DC84278BDA5F157BDFF5C5BBDE37D57BDF7F9283DB75B7BBD540896BC388872BCA4E019BD66E7983DE188B7BC446B82BD41BB23BDC12BBCBB1F513EBCFF4B40BD517C79BDC84384BD2710193D419656BDE43593BDD19C94BC76E0EE3C11EEBDBCD4C2833DC1DC1DBD14A7783D9ECF4A3D8F9D1FBCF567EABC82C13FBD188A45BD32E2A0BC5A7EE6BCBD96CFBCD9366ABDCC1A40BD8A650BBD74FDBAB9F8C7823C774D573C33DE713DE887843D0EB3BB3C1490223CD08A203D4DB90FBDF28CA2BD9582613DD4FCE13CB59A983D864D863C0379263DC5AD33BDEFBF53BD1291613C2F77453C79478F3C4455133DFE85BEB905398C3DFFA4433DF052893DDE440D3C80B87FBD1FFA7E3C64AECD3CE3B99E3DF60692BD0E1A15BD549155BDE652A0BB30CA66BD0D8B343D8D96A8BBC2E40CBDDDC11C3DCE467CBD827FCEBB418EA33DA301A1BDFD388C3D5E50A1BDB601F9BC2C9B9ABD0134333D2EFE523D80E3C6BC2CB1483D6DC6E53ABC78FE3C39DB493D139448BD0B8DD2BB13DECA3C90CF3C3D3D9E39BD954F243D786A2EBD2C869D3C3061EFBCB95C30BC93BA703DC5597CBC10F464BDAF65783D3AC967BC1EF8B93C8EF0753D4218693DA236803D463C80BC7AA4B93C34F691BCB28488BD222A2E3D62279DBDFD99EF3ADB1D933D6135C33CBD8F973DDE13A23DE952A03DB5FA863D1E0229BD487EBD3CD0D01C3D2CFA46BD676E38BD95A905BD7C7E9DBB2599A53DE5377A3C7D589EBC688EBBBC772552BD920EE0BC6F7113BD6F4480BD6A49953DAD3C71BD4111953C8EE496BDBE6C1D3BA8046FBD747C3FBD1DD62C3B2B924E3D13F2A1BD77B0D13C42888DBD1F07153DED22233C63602BBD1C3BA23D43D9A03D70B1E33C3F13863DBFC8073C10F590BD8359AFBCD06553BC479D943DFD7396BD266CEBBC7EBA2A3D01FB26BB93E485BD5844A03DA8E7A53C1307703C3425BB3ABAAA67BDC56C113C1A83DABC0138B23C12791DBD8D0456BD03D89B3CD4A43FBB7C877E3DD1BFA23D66D7F83C9E766BBD97D8A13CA16AC23C4BBBA23A806A27BDEDE0843D41C401BD44B08C3DB0169B3DA5B497BCBB3FF43C4A86313D0F982CBD49D37ABDB42818BB2F3B933DCE58CABB8A7A16BC933684BD007C503D327493BDFD52843D5C1E3CBDEF48723C5AFA37BD2B20563D6254D13B56B27BBD3114F03C3A5135BDB76986BD3A08813D7F890CBD16834FBD9123263DEC2B97BDDE4D12BDE1BE453D623047BDE404EEBCE8D4AC3C291A8D3DA2230D3DC4D1783D9BC809BC2F2A9E3DA6E7113C8A28EABCC5304C3DFE598ABDCE58933DBCC87ABDDFBA9ABDE457913DE7A864BC61DB6C3D9E6C2FBD02B74C3C0B442ABDA7BB64BC3E0598BD95CC1D3D6D0EDABCFB04E7BC6862E2BC93948F3D8787413DDB73883DD4A985BCC4DDCFBC0CF59B3D83466D3D295C553DD3DD803D1E5C12BD884C06BCAC6E61BD003E7BBC7B5E7FBD41609BBD0B600CBDF731EA3C9DD121BDD50428BD2E1D70BD6ECD463D81FD9EBC29948C3DB561513CF9DB923DA0B839BD07428D3DA13B97BD70A39FBD752F39BD8D761D3D064B94BDBBBB633DCE4299BC764AE3BB849FFD3BABE0383CC4CD86BDB258C63BAF7C27BD7113873D164684BDD7422FBDF6114C3CD1262BBD17D3423D0D1D78BD8DDF473D305D8A3CF37B163DC1A10A3D1A608E3C471E81BDE91394BC97AE7C3D458188BDF367803DD0AD033CCDC4D5BCD76D243C6471283DE112DE3C6E551DBD693A943C0EBC67BDC2F210BB746EA5BC72CBA1BDEC0E743D6DCE8A3D3E83ABBC1F79793D4EFAE6BC33CE893D3EB539BD0027953DBA8EA33D803903BD92D0D03C989187BB789DDC3CE184513C77109DBDDC08B7BC66CA8B3BB529F13C23F31BBD3F9318BD0558BFBC21B443BDF2C265BD207544BD60802DBCCDC26FBB8F16323D50FBFEBCCA411B3DADD4A8BC14EC823D89F995BDCDFB3C3C60F78E3D754165BD089EDDBC1BA31A3D7E1683BB71A6463DA9E8093DA027A3BD00894CBC49EA933C6E843ABCB4532B3D2AD3583C5CF933BDAFA56CBDBEB3D1BB903E9E3DE49D8FBCCD4E963D1AB84FBC3DA6713DA49BB73C89E55E3D902E7A3CF7B4143D638224BD8885D23CF9B7673D65BB893DE7212A3CF4F47DBD218184BD6E249FBD3F5123BD56D472BD0D047A3CB17441BC1EAE18BD83B6D93CA73207BCDE9CA53D0509AD3BA4F6B43C4123BB3C516C863C1BEE683CAEB2213D9ECDDABC3F739E3B6E04173CD59C873C829F243CBFC262BC05F413BD9E228FBD814127BC187671BDAAF1963CE3DF243DCE38BEBCCD61583D4FDE8F3D5BBE7F3D270B38BDA6E0873C9574A03D6F2B873D2DD57ABD7D25E9BC38B3CBBC527D3DBCEB078A3DEFD3C3B818E9F53B1A004A3C72D0A3BBB7A4963C5FA8503D535B9DBD8C799C3DDF57693D64F9293D74D1293CA940D2BC5033CC3CD162FCBC88D3C5BC99978DBD9776B93CC113D7BBA8C2273D8DD2893D45CB21BCFAD8903D62B39CBD02D0CA3CA3A5E5BC449E7BBDF84A5ABDE447A73DADBE49BC8F35543D13D474BDFB5C3A3D3534CF3C6209F2BCFF54C5BCCA351CBD0D1D2FBD30B93ABDC08D763D3FAA3A3D742A013DC440A43DC3BE36BC8E893B3D02B87A3D7780163C899D4D3D5602E7BCACF9B8BC0FF1883D4FB123BD8048E43BCA6D3EBBDBBA593DB1D2C6BCC96C78BCCE6DA03D4AA6813D3A4207BDCA7490BDDE595FBD23909B3D39448F3B59E5333CA8F69EBDC045133D32668EBD3D39413C4D0F503D650A48BDCEF1EC3CFDB9723DB8FFF13CC32C3C3DC28B8C3DA11B9F3D193A8C3D7E3F803D4710A43D44ADAC3B0A493D3CC848D9BBD0B72C3DF8A8883D5EC9DEBB05B154BDF5BD86BDD9CB00BD257B853B9708DC3CF37650BD05F74BBD5741813D1D93E1BCA398E23C6A2EA3BD988310BCB16F323DE05565BD65EF5039EC51523D8D4BF73C1AA9C93CBF569BBD8839FBBCD9C93A3C7CF8C5BA872AA43D774487BD557E803D58A28A3AED6798B9A609B23CF92F193D219B4A3C6ED1A2BC79BD58BD81549CBDDD444F3DE678FFBCDCEF353DD60C313D583396BDA127823DA3CCF8BCBC70703DBEB5D7BC8D2B42BD37A048BC5A57F2BCF82464BD135A973D257E8DBCA011653DB8883CBD1ED9EC3C43CF4EB97FC635BD6080A3BD51164FBA8E62843D4D4E233DD206BABB0D58773CB3AC78BC8C327DBD4556323BFCB73A3D2649023DCE4588BD4BFD903D481FA53D0AB37E3BA75001BD14F890BD6C17393B9880A53ADCAA22BD07F2B7BCB541A8BCCBBB37BD5414ADBC2E155ABDA835603DA55FD9BC49E55DBDB8614CBDC504D8BC8D1D4E3D5277853DC75EB8BACB5CFCBC029DD0BCD6C20B3C3AA49FBC94BE003DD39E3DBDF661123DEE6A803D92077CBD0D874F3D522B503D57D74CBDE3E4633D8CED913D88BED1BCE8E5FBBC318C7ABD37CD6E3DD04B8A3D0283A43D0DAAC83B07BA9FBD37C8263CDD8B06BA52148CBDE3FC3B3D822645BDC35691BDC395823DA47398BD92FB093D4C8A95BDBF5FA6BACB444D3CB43FA03DC138253D8C4222BD44E61C3D6CA81D3DAEFAA13D33D6CE3CAB02CEBC186B973D47E5433D0CEC313DE02892BD5294DDBC7EF719BD1B1B903D6DC30E3D55E184BD9791F73CC0AE583D6C649A3D137C523941825E3CF13C7D3D2E654D3DD91A97BBAB7C8ABD119885BC1263913D1904BB3A70F40DBDAE23963C3B7A343D5CFFD13CEF38733DC11435BD500A16BD28476BBB787016BC9F21423CE77FA7BD6400B6BCEF7557BDBB6F703D2CBDDF3C14A432BD081D0E3DF29F17BDC0BDD4BB84CFAABBC4B1353C9D56A13C5FB7843D3157523DE4FB563DB9EDE4BBC67473BD0D7D31BCA44107BD5AE72CBDCAAD34BD3CC90D3D29CFE7BCD175F13C466742BDEB57E53C48C5823D66280A3D0D4232BD6384823D81E7A13CFBA743BBFDE2A2BD850E173C15815E3D4E0E5C3DA57F8E3D4E862FBD667DA03D4EEA95BC9033583D2DD530BD01FC3CBB93A107BDB4AB98BB57BF433C4039693D96EF2F3BEB1A64BDE57600BC9A183CBD17662ABD7F5972BCCFAF22BD2F498C3C4B72933D6E3809BCC05187BD5D73DDBC53EAC63C0B42BF3C75F8793C7B06953C9D59733CABCF1FBCC4C16B3D31300A3CF5919DBDBF4B323DC958393DE375083D9141CEBC69625C3D26A26AB9974C743C94824E3DE9B8F33BA47DAABC006082BD70896DBDDCCB9EBD5AF7DFBCCA3C98BCF8D3A8BB6F5A10BD005180BC0DE998BD3AA63BBCA06F203D472E963CE62423BD60A4463D8BDA90BC47F7C83A8179C73B0CC294BDEB6D85BD64862E3D466D56BDF8F60B39EF0D7BBD0001D9BC2E5ECEBC4BB6D3BC71E9463D1D759C3D679724BDB8AA4BBC2BCBBF3CD367BCBC28B6933C81E4123D276EF9BC1A0F83BC6018B1BC32CA843DB58E45BDF7EC6E3D45A9A23D05CD16BC83A7D43CC8AC343C78EE6EBD8822E13BFE0E72BD6FD51FBD36A55C3DBF93CB3C14D9043D1EF909BDCA29023DE93D303CA59BC73B38FE873DEA1D943D3670233DFE800C3C03D8803DD85718BDC50142BD0329B4BCE7EB14BD0F11BFBC0B51E839356832BDCD8B873DBE54F33C376589BDE2441ABD4C4A793C8D28743D7D0040BDF4A84F3DDB6492BD3F0C91BC17ABA0BD0D75933CA21334BCCB7B9D3C6E2C873D22F093BDD579953CEA47B7BCE6B0573DD87546BDEAF88F3D2663C9BCB2B0843DEAB1363DA85ACABC85C6BFBC0AD880BDDA6B8FBD89163C3D89861E3D19EC503D91AB9F3C56CE483CF65D913D4F7750BD441FB9BC706E18BD451AFE3C41CDBFBC925221BB406DFCBB5BC1A4BDC83786BCF42E67BD0EB56EBD9F92C0BCCFD15A3D08F169BD4AA552BD03C929BDE4D93A3D0E5D813D99E6E9BBC92DA9BC212F503B94F66BBA38106EBD33929C3D5CC7843DDBF0683DC70EAABC4F33323DCD19C53C18DB823C3FB43E3D23D2233D43B22C3D5F7B073DE42384BDBAB18FBDE39721BD6E9E63BA5E7699BB08D0A83A3F0069BC5FB1A73D275170BDE6A2C03CA53540BD400480BD5FCB02BDF7E1A13D2FA67CBC2AE60CBDD42717BD3541813DF2A611BCC8DF73BD85F8053964AF45BD2AAF83BD8DC19BBDA5717ABD2142463BBEDD3E3D503581BC5A65783DC4329EBD597A1DBD08CFAFBBE88A9E3D5AC094BD44AE9FBC4C4A843DEB17233DECB8753D22C8EF3CA29FDABCC8DC5E3B217285BC7B6B6DBD7C7DBDBC59B6593D17E473BD4051A33D9AD418BD1654A8BD7A9EB03C18A6483C271686BDDCC6A8BC2DB9573C03E200BDE43A8DBCAF7D08BD269886BDC2732DBD1FE886BCF60FFE3C3F33D6BC41B30D3D87FE8E3DDC5F683DDE0A48BD56E79C3CFC63BABCE147F13C261A88BDA3F456BD2FAE83BC7757723DB1141C3DEB12B0BC8C37A2BD9EF294BDDF23BF3C574578BC2F963DBDBA219CBD0B2E3CBD311AA8BC05C5603DF9681E3D50B1AE389F5731BD660893BD1F5E993DD1F82DBDF1840B3D6B1D933BE6A871BC08D6643D3E64D3BC292822BDF214153D139A0C3DFE488C3D5670783DDC5DF63CFFD51FBD3437B2BCA70E853C2AC06D3D660081BC90C2133D6A5C9FBDDAEEAD3C7F8F09BC6BD089BCCC8B9EBD018A893DFB7888BD1272623D18D669BB662DD63AE0456CB9BE8753BD8D71383CE71085BD1A0A163DB0DA733DFBC01BBDA7665FBC6415313BAD7A3FBDE375333D70F622BD72AD11BCC9798B3C292F1DBDD8B933BD3A97853D95938D3D6E90793D487024BBE205DA3C399B6ABC3ED79EBC116294BDF75F6ABDCB5291BD8148823DC9FB9FBDACA3443DDBD0203DAE64B9BB5CAEEDBB3B2C963D4FAC723D2FF6E03CFD139D3DCC5223BD9F92ECBCBF5EAE3D5F05833C9D5D533BDB53A03DEA6F803D4FAA9EBD66B5433DF86C3A3C61090FBD6C7029BDCB64223D362D843DFB774BBDF26B1F3C7BCF2FBDE0BE543D5BF9383D826E87BDB37D673DC7D90CBD46D42E3CCB61463DA7EF793D4B4E0A3D107829BD8293823D534424BD9B9AAABCEEF53F3D9B41003DBBEF8FBDF0EF93BDA404353DF85D11BD48F097BD40D31A3DCBB400BC1BDE93BC7F2A1BBDC0BA90BC412BFFBB6DFBE33B458EAD3C86DF95BDDF07803D505B2D3DCFA2A4BD66A5C0BC3EBBF1B90B328E3DD302CC3CE8309B3BB732FC3B7224253DEDD95D3DB87A893D164B6DBDBA2870BCF7BD343C1BDD35BD1780833C0D3F73BC624C84BCD481833D4BFFE6BC6B916BBDD81DA83DE31597BD76CE8BBC0D508B3DFBA68DBC0FC9283DC20F173B4FA5C0BC167513BD59EE113D76406EBC3A97A1BDDA988FBDBA48693D854EC83BAE2E523DD369223D8F174B3D0EB98FBD0DFA04BD4E5453BAF2FD89BC26CB9EBD3CF7B7BC8EAB89BD383213BD528C993D121ABBBC06D39FBDB847513D498E153C9DFA4C3D5632683DC099103D089EEB3C6BF0AABD48EEA3BD5F5A91BD320E1D3C0DD66B3D3380793DD6FA97BDE56FAE3CF42DA0BB7D828C3DD179A6BC1A98483DCAD18D3D58093D3D599E593DC124A73D280C37BD3BAF9DBC2ED90B3DC9D1793D05C3B4BC9C2705BDB14B94BA91938C3BB615853D52E4083D06675D3D5D6CAFBCD0AE3DBD6642A33C3A09F23C8D8D9C3D792126BD299E89BDD960623DEAD272BD5A7A41BDCF476EBDD7DA883D74739A3DFDF30DBD58B5DFBCDBD6E3BC31DE893C696FDEBC42EF473D59A0DDBCEB81403D7B432E3D57D432BCEDA2813D7AE285BC4D43CC3CB7AE6A3D28F5893CAB8FCE3CC24F9FBB9FC238BCE0C26A3DB653C0BCE4051D3DE14C353D715796BC6E6429BD26856CBD2B2B8CBD9E1D6B3DB6049B3D8F3304BD7A83FF3CCF0EF0BCFD2A863D283E2BBD7AD0EDBC686F94BD6F4A87BC3D5CFDBCE95A823D629E5DBD891200BDA94E813DA5C5F1BC1D52B43C813A453D7817773D317929BDB860A8BC165176BDB57FA03D6B6A093D8B9E2C3DFCA81A3DA7A0903B30B08F3D7A1216BDAD951EBDFF42483DF1BED63CB9B1003DD012A0BD20CD9BBC0A8D9E3C6060163DEA9E8B3D4288253DC0B1583D36528FBD9DC185BD5C016A3DF1D5C4BA31768E3B09A09C3C94AF6B3D0FF024BD3256063D0F04763D7AD52F3D7566B1BC7A2FA03DF64C00BDBD61853C4B062E3D3A16EE3C007F983D2BAC6F3C317B7EBD401820BD940BAEBC1F17A5BD078164BD061EA3BD11691D3D0BDB2C3DC61F7ABC44F14D3DD612A1BD96385ABD251F7C3BF53B9F3D4ED3C13C6DF7473D045EBCBC49670F3DD4E5AB3C4CA6073DEACA83BD60DF9CBD49B6A13D477A6BBD8751823D8274A53C4CB59F3D49A2793DA9035FBD8998373D084B6CBD37083EBD76D89C3D1B0503BD9B60CB3CC2D396BD97DB8F3DB1DC6F3DBD5638BC33581EBDDC7A24BDD64B5F3D38F067BC19738C3DA7BE573DDB4708BD156B583CAC1381BD3928853DDA6EE8BBF601F2BC3CBEA7BCB67E4BBC461EE1BC3D5B813C7022A2BD648EB5BC933C75BCE283283DEB7A3A3DE202953DCB09B9BC0DB78C3D97C74F3D9DFA78BD320B9B3C4C8B883D875F39BD291985BDC6089C3D5B456DBD855F54BDBE9EF8BCFEF6713C051E2C3DFD291B3A52F28EBBB361873D02BCAABC4909EDBCF3D7143DBCB5C23CD34E7DBCBD32513D2E31863C938B973D876D7EBDD3EE13BDF017B03B8710A1BD0D0762BDA5702ABD5810323D35601B3B454788BD7447133C807B4D3D0323A8BCF70E71BD925972BD774954BD5D105A3D1194403DDDAFE63C90FDB2BBFE2A823DBC088ABDD11D8DBDCD9E9E3DFD1AB23CA7E43A3DDFA290BD09F5A53D223C363D80F3183D74AC11BD33204C3B538A54BD11B6A3BD70DB2E3D229A90BD40509F3C83E2993C56AA4E3D05C738BC60849D3D82BE513AB225923CCE6B5ABDA6317EBAFFD71E3D42641C3D93D37D3D41F986BB249B6CBDCEDA6E3D580C5A3D64303E3D10E381BCC154093DB8371F3DEF3731BDAC67B43C75E88E3D2477793DA67EDBBCE75476BDF42611BD8B9F063CCD0F37BDA7E1AD3CFAE534BD125D67BD85127DBDA09A763C0CB1A0BDF9A65D3D310E97BD12F9EFBBA6A092BB87FB753D43C386BDFE566B3D5B6F303CDE3058BC4A0D353D9CAD4C3DD151103DF579CBB9449CF83C54E6C13A60617F3D32D7DDBB37295CBD9C8D32BDE0FFFABBF4EF78BDDB0DDDBCDF0A1FBD22C2873D49729CBDA42DB53CF1FC253DFF1A7A3DDA5511BDE843E1BC51EEB33C22C49DBCE8106C3D7D10DDBCEB60613D98B3223C99D8993DB33A8A3C769D473DE3CA3FBD9BB1E83C1A9F263D868FA93C452D2ABC285FADBBCB1102BD46489E3CAF7B453DADBA87BDE00CFF3C92059C3DDF2985BDFC4A9EBD2B51573C651AFEB76707E0BCB54DF43CC864ECBB04141F3D44BD773DFA7F403C3A07513DA35582BC34897939E502DEBCC5B203BC7A437ABC7509073D29124CBDDF288FBCB48F80BDD7D93C3D8E5760BD39E5833CC743833CC9540D3D04EDAC3CBA547DBB1835953D84E959BD2D14A1BD51E796BD3C4FF1BBF794CF3AD34CECBBB15D84BCB71A5A3DA66D173BAFB4AF3B7E787C3D084E99BCD51F923B1CC386BD8011F53CEB1C05BD35329CBCAFAA84BD2A46C73CEAEB9A3BB102473D401A2ABDB7E0813DA2378ABDD49F703C15BC04BDBBB420BDFF45F8BCD778463D8AD391BD246842BD885E273D7689003D61F608BD7C1F603D71E8CABC2CF1743D3612213DFEE091BDE73B683DF27C99BD4AC3AB3BAE6A6EBD287F50BD8BA3833D22E6693D2F5584BCB8EF97BD8082873D4B3DA23DF07187BDFD6FC9BACA4C6A3D8B9F07BD7AB1403DBA6D33BD23A632BD6C7117BC540B89BAE12F833D3CCC9FBD3949813D2AAA763DDFB0B53C40F9813DEBCBEDBC2183D63CEF29D13CA828993C514930BDB9DA34BB01A8A23DF5E49D3D152D373C1727313C9E54823DBA34E73A5413B6BC0137973C47007FBD736D9D3DFBC9DCBA95EE883D5CADCCBCF7C3953D0E7B133D9342A1BC951E84BD0C629BBD9E2DE4BC3CE96E3D3C11CD3C8A76363D6126953CBE9A07BDCA95B23CC40C2D3DFA4AB03C398F843CAB3F8C3DFD2AC83CF7092F3D0DBF04BDF2B572BDC0C7643D36D092BDE64B46BD161C0CBD84552FBC38CDFB3CE59740BD6B174EBD4F8802BD1A23863CA24F0C3DC7358E3D62729BBDF34ABE3CA65178BC54EED03CC02AA53D32D08EBD9908E5BBE5644D3C7FD544BD11BAA33D3B8854BD302A513DF63142BD2C6AE3BCAE9EEABB018D1DBCD38B03BDAAB886BD829B333CAE43BE3C033CA8BCD3BB81BDDB6B863D1A518CBD8DAE89BBA3A1463D5E9370BD07BE91BC14A034BCCC457BBDF2E2DF3C0816FEBCC3259FBD50BE9BBD3FEFA5BCABA08D3CBA5C0ABDEDA7633D1FED083D533B703D838E003DB7F396BD7C9993BD6FA5A03DB5322E3D092A933D99348EBDAA9F323D746E2A3B604AAA3C154D5ABDE652DD3CECCF3A3D5A4625BB985AD33C4C1A963DD81E37BCDC1DF23B8B028FBD596D1E3D501D55BD0D123CBD5EE393BCB1729ABD1CF339BD1DB477BD6A79383D15AC2ABDB6AB54BC81B657BD4AEBB83CD048D63BF234383D9D56473D27D7653D0662A33D2B894F3DFE40363C5D5EC23CC71507BD04C9603DEDBE55BD64588D3C23DCFF3CF0987A3DAA2C08BDD3703A3DE8D9653C68BAD53CE0C372BD8539DABCE3327E3C6D4482BDEC9D8C3D9B574F3DE365CCBCB11C413D61C119BD7B20D3BCD4A0223C482CA8BC71524EBCD2CE153DFE548F3D158D563D5CF8693D216DEEBCB4F80F3DE0B0A23D5FCA67BD4CDF343DE2B3883B7DCD1FBCB03737BC99324B3D3718CF3C1DA3003CA0F7A53C104F4FBD52A7DEBCE91A47BDE6E596BD747E64BDAA5D2FBD8A5669BDA5B1B73CB63AECBC5828213D105E5C3D131E1CBB2E8A723D16488FBD0C7DD33CDE140FBDA0736ABD927DAB3BC1AA6FBD94CD593BA5BDCF3CFD72173DA79928BD3361EE3C023D643D606F67BD5846C2BC07E9B53C76DDAF3C9D8218BAF2B789BC5E37ADBBD299C73C142DCD3CD92F10BD3CB0FA3C42279B3D3E1E103D6B7C5F3C0B87153D4C70493D021A013DBB7D94BD901D0FBD5F5354BD6D4A793D862E163DE2A55E3D04552F3ABF8121BD3928BC3B046E603DF9AC713BA88090BDD209303DD9E4973D761B2DBC6790003C6824E73C0B3F27BCB7219CBDF1629DB911C3BFBCBFC6113A97508FBD94185ABDF4404C3BAEBBEBBC0F3723BD80604C3D98DA7ABCC4249EBDAC39553C537E193D783C263D6DBFDBBB926513BD0EB06CBD7D7729BDE1E65DBC06071F3C70C6DA3B1B1131BD4F5CD7BC62424D3B67EF9D3DB0A41A3D34AA8B3D968095BC3E3A21BDB7B1123DB19690BD5A6F823D00F3A3BCA57919BD593E29BC56FDC1BC836276BD9CE2C93C2B0C7ABD81E2613D21982DBDA2B339BD510D94BDA36443BDEF51A0BD3E14D6BBC9807B3D77143F3D3B37813C563556BD9900E0BC5A1F323D0855133DD9DC233DFEC8873D1DE8C23C2DB412BD99C6DF3CEB9416BDDA36813D71985F3D91DC94BD67D0813DCABD1C3DC74072BDC850623BC72C38BD9ACC04BDCA813DBCD20B98BDFD3F77BD7466D3BC786EE73A232B9B3D170DD5BB501EE1BB413FA4BDA05665BDBAD5713C25DE003C0D7AA53D8E40A1BD73019B3D67AE653DCBDD873DAC71F3BC985573BDA02190BC447C85BD4BFE1BBD8CAA02BD07C3FB3C21E6843D6B08953D57B7EDBBBF14653D11A699BC5DFB5D3D8DB6C7BCE34B1ABD9369093D7C80063D0E1753BD70E60BBCAAE57DBA9E7392BC3C1654BD9694A6BCBC427EBDD6FC71BD6BE9933DD0940E3C3CC580BDFEFBCCBCCCB007BD16AD5C3B2CA47ABD3CFBA2BD9F8A293C43021FBD0020D0BA24FCA23C386790BCF2310C3D935117BCCB9692BD81DC9FBD28E66B3C0AE21CBDE07B47BDFCF188BDAB659BBDF6FB153D8940D63C8BC4363D7A22623D99329D3DCFF05CBD68DFA1BC52271CBDAF5233BC802CE0BC3EDC803D2E733EBD5088C7BC7547113DD3D7993D5F6E0D3DDE79AFBC87FBC93C291381BCC83F8DBD382D6D3D8ACC893DA2700D3DCA47483DECBCA83C6EFB0CBDD80C053D5E5AA53DEE2CAB3BFB3C963C7F2864BD1761A13D9152EF3C75DD38BDA7CE2FBC602A9D3C37387C3C16E70C3DFB3D6F3C466290BC81129BBD76BC2F3D8CFBA1BD2E37BF3B960A83BC40A1813AE4612BBDBA6D813D212734BCD842B1BC8AF22FBD38C14ABD4C3CF2BCBFC663BDC2AAFEBC7BF225BD906DFB3B371A2EBD4DBE9ABD00A2263C68E5AD3C9CDC1CBD5B35303DA0D9ABBBFDADA03D0019F33932DC763D68CAD6BC608769BDE089D4BCD741923D2E0469BD7FA6A2BD68EFFF3C1CDE3BBD60444E3B8B5F9C3D28B788BC5E1E7C3D62ED1C3D288AD7BC1E77743D01BD80BD747719BD0C2AA1BDCF3F40BD385884BD24C0D1BC2509883D3C4481BC33201DBD203E59BDA020D23C30E163BCC673523DCD21A23D2FA3913D78D1073C09A746BDC0BB643B529D293D7DAD40BDDA337E3D0485F53C883061BC3E73A5BCF479C53C70090DBDDD363CBDAEB041BD8EBF603DE6A98ABD3050A63CF6F396BDECCA893CE089323B8062D93A0015B53CBE3A203D00B2F73C34DC66BD975A883D037CA0BD38FF343C53C5853DDE5A93BDC023153B3832F63C30C47BBC7246783DA286773DAA4D3B3D44C3A23CE44CD03C1AF33B3D28AE93BDA2DF553D127810BD9A8C163DA05417BD4A710E3D5CA31ABD858D833D72E5D7BCC2BF523D2DD0803D2090A43CA44383BD1D9CA2BD98FA1A3DB32698BDE8E4A33CB462CE3C086F113C7F0D863D06434E3DC2836E3DB87488BDC8A42FBC7845123DC84958BDF5A2A53DE7AEA2BD7DE4963DE08D813B000FF5BA306B6C3C93F730BD28D3B0BC38FCCDBC263DDFBC361F3F3DA22A793DDBA9903D65B291BD803F38BD946AC33C38175C3CDC4E88BDBA52E4BC680088BD6042503B3AE0AFBC0945983DB298433DAEE33E3DC87464BCD060D53B3A62713D091B37BD8D97A2BDD0D48DBD00C813BDFC4F983CF6E67ABD8007473BF83E17BDD223433D10857ABD99DA0CBDF009243C18E7903C28BE41BC9EF5203D0006523B163890BD3F949BBD70C6E7BB0CBE9EBD7035F03CF209713D2A62643DFC0E87BCB41B983C5A28083D788C333CF475F63CF8FEF73C80030EBB298411BDF555923DC09310BB5DF76BBDDEAF243D06F34E3DD2AA783D63E66EBDD87080BD10DD0A3D50491D3CD817D3BCDE4944BDA6765F3D40169D3C44B69E3CC054393C1676233D645E923CAA88473D8C1096BCE64689BD932F1EBD570A863D12CFBDBC04AEB2BC99F09A3D00A06BB80451D43CC06944BC9DAD9E3DAA9F7ABD7012CABB40C82B3B24196BBDFE76633DF2A9073DBC729CBDBDA5873D0CA484BD5FD959BDD0425B3C10E7013D103F943BC2666ABD8CCAF63C35C0833D91BC37BD42A981BD90BC4CBDED008F3D0C74003D626EF5BCC59382BD1DA58E3D8054893CB03FAE3C04F695BCAEE1493DA663653D9A36E3BC685248BDEEBB593D7AA31DBD8A65373D28F495BD80E4793C16739FBDC82B8F3C46BF40BD32D5483D507FE23BE86745BDDCC6073DF79C9A3D5CEAD63C6D3F9BBDFA5886BD38F034BCB23588BD7A039FBCC2027ABDCE7DF7BCF8F6EABC0DC8883DD32B87BD0798A53DEF4F9FBDBEBEAEBCC85C4E3C482E7D3C101A99BDCC98FBBC88922E3CB03EE3BB8B3C903D86C31BBD56E754BD9F78943DCADB773D78F2253C96A812BD26D3683D197C893D4A7BEFBCE2C22B3DE066173BDE93523D20A8A03CF48A023DC058F9BAF6E94F3D98BA1E3C4426C63CA9B789BDEEB52F3D9DD3A23D605271BD6F399DBDB00BB3BB0666713DE86FABBC6C0E1A3DCE77013D5E005D3DBD5DA2BDF48F8CBD1CAFF83C0449EB3C08377CBC744990BD20497C3C408DD3BA572286BDA4432EBD2AFAB3BC4236F2BC6983813D41BA883DB825E13CF23D5C3D5E57A1BDB8F3F03C1018F03B656B25BDD86073BDB493803CE272D1BC40C5B03C50CB83BB96B95EBD1F228C3DE6AB7B3D30FFBC3B40C1563C97C29E3DFC9688BCA049043B66C062BDAF5C2EBD4B6D2BBD3791873D629273BD48668EBC167CF8BC20A61F3B88926C3CC0100F3B90B913BDE84D93BC154498BD98CD9FBD425BC2BC4B2732BDE028613BB6BE4CBD9EB598BCB06DD23B0C4132BD85E8923D80C0EC3B9AA062BDA8435D3C75558F3DB04FB53C58308D3C2E2DAFBC506020BD774774BD92A393BDCAC39FBC3AA694BD39AFA5BDF4F32ABD52C91ABDF7CE913D49878E3DF089183CD7954DBDE8AB72BC0C56F03CE869D23CC09640BCC4F0A2BC584B9CBD322903BD70CF233C8C1AE2BC2AB7773D084D773CCA951DBD25E080BD58E2083DACBDA73CD4DC93BCA9789D3D226B633D6C1473BDBFF265BD101388BDDE6581BDCBA4893D19A097BDF6A385BD36B96FBD5A72573DF0A47ABD183B5BBD3259183DC5C4973D23618D3DCE06B8BC181D82BD6B7E54BD425F9CBD603930BC3398823D107793BB01B3A3BD6ADC1C3DF09D47BDF22923BD61D993BD5500A23D4053F43B72C2683DDAD7A0BCFC671DBD48628EBD531C833DB4C8E43CA684613DCA0F0A3DB40EF0BCE89F663C20FB4BBB39F986BD1B5C8CBDFC20B63CF06626BD80E1B63CE415A43C2CFF8BBD9EDA433D702CAA3C8E6B493D701DF23C4F9B41BD247C88BD6E61153D159487BDF038B73C6872F7BC889761BD34D7243D60602D3B81D58DBDC4A37BBDC529843DC0EBECBCE2F9393D467A88BD607A8D3B542898BC65AAA33DD858363C84A7DF3C00DBC7395CBF8A3C404BF53AA1368A3DACB10BBD662E083D40D22E3BC0EBA73CA06F873C729F5B3D244BD93CFDB9983DBE8583BDA07E3B3C04F49F3C354D963DA81896BD8CED8ABD336192BD184963BC80EBD83BFF073BBD005A5AB9BBCC5FBD60A94ABBF2E3433D4BFF87BDABEA893D1AC30DBD4C53FD3CF97EA3BD4BF33ABDC4E382BC7EC97CBDF8B27DBD02C999BD2694C8BCF6866B3D0CF6A13C806FE03CBA1851BD3D44893DE279EBBCC7E99BBDCDE4903DCE8944BD186039BCC02D1B3CEA855F3D046083BD8074173D27E434BD254C83BD3058D73CF8961ABD856E8EBD804F903B2C0334BDF97BA43D04B8B93C40D7A83CD451B0BC3C689BBC29A7A3BD1EC87DBDC226423D44051C3D82EC5CBD50AF8ABB"> : tensor<784x128xf32>
@@ -53,4 +58,30 @@ module {
     %25 = mhlo.divide %22, %24 : tensor<1x10xf32>
     return %25 : tensor<1x10xf32>
   }
+
+  // Crop, resize and normalization are a single linalg.generic that reads the
+  // 8-bit pixels directly so that the unnormalized frame is never materialized
+  // as floats by the host or by an intermediate dispatch.
+  func.func @predict_image(%image: tensor<64x64x1xi8>) -> tensor<1x10xf32> {
+    %zero = arith.constant 0.0 : f32
+    %init = linalg.init_tensor [1, 28, 28, 1] : tensor<1x28x28x1xf32>
+    %fill = linalg.fill ins(%zero : f32) outs(%init : tensor<1x28x28x1xf32>) -> tensor<1x28x28x1xf32>
+    %input = linalg.generic {
+        indexing_maps = [
+          affine_map<(n, h, w, c, kh, kw) -> (h * 2 + kh + 4, w * 2 + kw + 4, c)>,
+          affine_map<(n, h, w, c, kh, kw) -> (n, h, w, c)>
+        ],
+        iterator_types = ["parallel", "parallel", "parallel", "parallel", "reduction", "reduction"]}
+        ins(%image : tensor<64x64x1xi8>) outs(%fill : tensor<1x28x28x1xf32>) {
+    ^bb0(%pixel: i8, %sum: f32):
+      // Average of the 2x2 window scaled from [0, 255] to [0.0, 1.0].
+      %scale = arith.constant 9.80392214E-4 : f32
+      %value = arith.uitofp %pixel : i8 to f32
+      %scaled = arith.mulf %value, %scale : f32
+      %result = arith.addf %sum, %scaled : f32
+      linalg.yield %result : f32
+    } -> tensor<1x28x28x1xf32>
+    %result = call @predict(%input) : (tensor<1x28x28x1xf32>) -> tensor<1x10xf32>
+    return %result : tensor<1x10xf32>
+  }
 }
@@ -9,6 +9,12 @@
 # This script converts an image into a 28x28 grayscale f32 buffer.
 # Usage:
 #   cat image.png | python3 convert_image.py > converted_image.bin
+#
+# With --frame it instead emulates a raw camera frame by converting the image
+# into a 64x64 grayscale uint8 buffer, leaving the preprocessing to the
+# program's @predict_image entry point.
+# Usage:
+#   cat image.png | python3 convert_image.py --frame > frame.bin
 
 import sys
 from PIL import Image
@@ -16,6 +22,14 @@ import numpy as np
 
 # Read image from stdin (in any format supported by PIL).
 with Image.open(sys.stdin.buffer) as color_img:
+  if "--frame" in sys.argv[1:]:
+    # Pad the 28x28 digit to 32x32 and upscale to the 64x64 frame size.
+    # @predict_image crops the 4 pixel border and downsamples back to 28x28.
+    frame_img = Image.new("L", (32, 32))
+    frame_img.paste(color_img.resize((28, 28)).convert('L'), (2, 2))
+    frame_arr = np.array(frame_img.resize((64, 64), Image.NEAREST))
+    sys.stdout.buffer.write(frame_arr.astype(np.uint8).tobytes())
+    sys.exit(0)
   # Resize to 28x28, matching what the program expects.
   resized_color_img = color_img.resize((28, 28))
   # Convert to grayscale.
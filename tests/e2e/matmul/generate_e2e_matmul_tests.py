@@ -33,6 +33,9 @@ class ShapesId(enum.Enum):
   SMALL = "small"
   LARGE = "large"
   GPU_LARGE = "gpu_large"
+  # Shapes for performance sweeps with iree-e2e-matmul-test --benchmark_csv.
+  # Not used by any test target.
+  BENCHMARK = "benchmark"
 
 
 # Enumerates of the collections of compilation info that we can generate tests
@@ -135,13 +138,28 @@ def get_test_shapes(shapes_id: ShapesId):
     ]
   if shapes_id == ShapesId.GPU_LARGE:
     return [TestShape(m=256, k=128, n=512)]
+  if shapes_id == ShapesId.BENCHMARK:
+    return [
+        # square matrices of increasing sizes, from cache-resident to
+        # memory-bound.
+        TestShape(m=128, k=128, n=128),
+        TestShape(m=256, k=256, n=256),
+        TestShape(m=512, k=512, n=512),
+        TestShape(m=1024, k=1024, n=1024),
+        # rectangular shapes typical of fully-connected and attention layers.
+        TestShape(m=384, k=1024, n=1024),
+        TestShape(m=128, k=4096, n=1024),
+        TestShape(m=1024, k=256, n=4096),
+        # matrix*vector, which is memory-bound.
+        TestShape(m=1024, k=1024, n=1),
+    ]
   raise ValueError(shapes_id)
 
 
 # Returns the list of Dynamicity's to use for the collection of shapes
 # identified by shapes_id.
 def get_dynamicities(shapes_id: ShapesId):
-  if shapes_id == ShapesId.GPU_LARGE:
+  if shapes_id == ShapesId.GPU_LARGE or shapes_id == ShapesId.BENCHMARK:
     return [
         Dynamicity.STATIC,
     ]
@@ -0,0 +1,96 @@
+#!/usr/bin/env python3
+# Copyright 2022 The IREE Authors
+#
+# Licensed under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+"""Sweeps e2e matmul traces over thread counts and collects GFLOP/s as CSV.
+
+Runs iree-e2e-matmul-test in performance mode on each of the given traces
+(typically produced by generate_e2e_matmul_tests.py with --shapes=benchmark
+for each --lhs_rhs_type of interest and compiled with iree-compile) once per
+thread count and appends all results to a single CSV file. Each row is
+labeled with the thread count it was measured with.
+
+Example:
+  python3 generate_e2e_matmul_tests.py --lhs_rhs_type=f32 --shapes=benchmark \\
+      --output_code=/tmp/f32.mlir --output_trace=/tmp/f32.yaml \\
+      --module_path=/tmp/f32.vmfb
+  iree-compile --iree-hal-target-backends=dylib-llvm-aot /tmp/f32.mlir \\
+      -o /tmp/f32.vmfb
+  python3 run_matmul_benchmark_sweep.py \\
+      --e2e_matmul_test=iree-e2e-matmul-test --traces /tmp/f32.yaml \\
+      --thread_counts=1,2,4,8 --peak_gflops=512 --output_csv=/tmp/sweep.csv
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+
+def parse_arguments():
+  parser = argparse.ArgumentParser(
+      description="Sweeps e2e matmul traces over thread counts")
+  parser.add_argument("--e2e_matmul_test",
+                      type=str,
+                      help="Path of the iree-e2e-matmul-test tool",
+                      default="iree-e2e-matmul-test")
+  parser.add_argument("--traces",
+                      type=str,
+                      nargs="+",
+                      help="Paths of the .yaml trace files to run",
+                      required=True)
+  parser.add_argument("--thread_counts",
+                      type=str,
+                      help="Comma-separated list of thread counts to sweep",
+                      default="1")
+  parser.add_argument(
+      "--driver",
+      type=str,
+      help="HAL driver to create the device with. The thread count only "
+      "applies to the local-task driver.",
+      default="local-task")
+  parser.add_argument("--repetitions",
+                      type=int,
+                      help="Timed invocations of each matmul",
+                      default=10)
+  parser.add_argument(
+      "--peak_gflops",
+      type=float,
+      help="Theoretical peak GFLOP/s of the target for one thread. The peak "
+      "of each run is scaled by its thread count.",
+      default=0.0)
+  parser.add_argument("--output_csv",
+                      type=str,
+                      help="Path of the CSV file to write",
+                      required=True)
+  return parser.parse_args()
+
+
+def main(args):
+  if os.path.exists(args.output_csv):
+    os.remove(args.output_csv)
+  thread_counts = [int(count) for count in args.thread_counts.split(",")]
+  for trace in args.traces:
+    for thread_count in thread_counts:
+      print(f"--- {trace} with {thread_count} thread(s) ---", flush=True)
+      command = [
+          args.e2e_matmul_test,
+          f"--device={args.driver}",
+          f"--task_topology_group_count={thread_count}",
+          f"--benchmark_csv={args.output_csv}",
+          f"--benchmark_repetitions={args.repetitions}",
+          f"--benchmark_peak_gflops={args.peak_gflops * thread_count}",
+          f"--benchmark_label={thread_count}",
+          trace,
+      ]
+      result = subprocess.run(command)
+      if result.returncode != 0:
+        print(f"error: {' '.join(command)} failed", file=sys.stderr)
+        return result.returncode
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(main(parse_arguments()))
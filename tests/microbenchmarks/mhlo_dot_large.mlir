@@ -0,0 +1,19 @@
+//===----------------------------------------------------------------------===//
+// O(N^3) matmul ops with operands larger than the last level cache. Compare
+// the `microbenchmark_swizzle` and `microbenchmark_no_swizzle` suites to see
+// the effect of the workgroup swizzle.
+//===----------------------------------------------------------------------===//
+
+func.func @dot_2048x2048x2048() -> tensor<2048x2048xf32> {
+    %lhs = util.unfoldable_constant dense<1.0> : tensor<2048x2048xf32>
+    %rhs = util.unfoldable_constant dense<1.0> : tensor<2048x2048xf32>
+    %0 = "mhlo.dot"(%lhs, %rhs) : (tensor<2048x2048xf32>, tensor<2048x2048xf32>) -> tensor<2048x2048xf32>
+    return %0 : tensor<2048x2048xf32>
+}
+
+func.func @dot_4096x4096x4096() -> tensor<4096x4096xf32> {
+    %lhs = util.unfoldable_constant dense<1.0> : tensor<4096x4096xf32>
+    %rhs = util.unfoldable_constant dense<1.0> : tensor<4096x4096xf32>
+    %0 = "mhlo.dot"(%lhs, %rhs) : (tensor<4096x4096xf32>, tensor<4096x4096xf32>) -> tensor<4096x4096xf32>
+    return %0 : tensor<4096x4096xf32>
+}
@@ -51,25 +51,42 @@
 // how the full program will run, though, and YMMV. Always verify timings with
 // an appropriate device-specific tool before trusting the more generic and
 // higher-level numbers from this tool.
-
+//
+// Google Benchmark measures one request at a time and says nothing about how a
+// deployment behaves under concurrent load. Passing --load_clients=N replaces
+// the benchmark suite with a load test per function: N client threads invoke
+// the function for --load_duration_ms, either closed-loop (each client issues
+// its next request as soon as the previous one completes) or open-loop at an
+// aggregate --load_target_qps. Each client gets its own VM context unless
+// --load_shared_context is set. Throughput and p50/p90/p99/p999 latencies are
+// reported, where open-loop latencies are measured from when a request was
+// scheduled to be issued so that queuing delays are not hidden.
+
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdio>
 #include <iostream>
 #include <iterator>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "benchmark/benchmark.h"
 #include "iree/base/api.h"
+#include "iree/base/internal/dynamic_library.h"
 #include "iree/base/internal/file_io.h"
 #include "iree/base/internal/flags.h"
 #include "iree/base/status_cc.h"
 #include "iree/base/tracing.h"
 #include "iree/hal/api.h"
+#include "iree/hal/utils/tracking_allocator.h"
 #include "iree/modules/hal/module.h"
 #include "iree/tooling/device_util.h"
+#include "iree/tooling/module_util.h"
 #include "iree/tooling/vm_util.h"
 #include "iree/vm/api.h"
 #include "iree/vm/bytecode_module.h"
@@ -94,6 +111,28 @@ IREE_FLAG(string, entry_function, "",
 IREE_FLAG(bool, print_statistics, false,
           "Prints runtime statistics to stderr on exit.");
 
+IREE_FLAG(bool, track_allocations, true,
+          "Tracks device allocations to report the peak host and device memory "
+          "of each invocation. With --print_statistics the peaks are also "
+          "broken down by the program function that allocated them.");
+
+IREE_FLAG(int32_t, load_clients, 0,
+          "Runs a load test with the given number of concurrent client threads "
+          "per function instead of the benchmark suite.");
+IREE_FLAG(double, load_target_qps, 0.0,
+          "Target aggregate requests per second across all load test clients. "
+          "When 0 each client issues its next request as soon as its previous "
+          "one completes (closed-loop).");
+IREE_FLAG(int64_t, load_duration_ms, 10000,
+          "Duration in milliseconds of each load test after warmup.");
+IREE_FLAG(int64_t, load_warmup_ms, 1000,
+          "Duration in milliseconds of load test warmup. Requests issued "
+          "during warmup are not included in the results.");
+IREE_FLAG(bool, load_shared_context, false,
+          "Shares a single VM context across all load test clients with "
+          "invocations serialized. By default each client has its own context "
+          "and invocations run concurrently.");
+
 static iree_status_t parse_function_input(iree_string_view_t flag_name,
                                           void* storage,
                                           iree_string_view_t value) {
@@ -126,12 +165,67 @@ IREE_FLAG_CALLBACK(
     "  2x2xi32=@some/file.bin\n"
     "numpy npy files (from numpy.save) can be read to provide 1+ values:\n"
     "  @some.npy\n"
+    "as can uncompressed npz files (from numpy.savez) and safetensors files:\n"
+    "  @some.npz\n"
+    "  @some.safetensors\n"
+    "Files are mapped and used without copies when the device supports it.\n"
     "Each occurrence of the flag indicates an input in the order they were\n"
     "specified on the command line.");
 
 namespace iree {
 namespace {
 
+// Returns the |percentile| (in [0, 1]) of the |sorted_latencies| in
+// milliseconds using the nearest-rank method.
+static double LatencyPercentileMs(
+    const std::vector<iree_duration_t>& sorted_latencies, double percentile) {
+  if (sorted_latencies.empty()) return 0.0;
+  size_t rank = (size_t)std::ceil(percentile * sorted_latencies.size());
+  size_t index = std::min(std::max(rank, (size_t)1) - 1,
+                          sorted_latencies.size() - 1);
+  return sorted_latencies[index] / 1e6;
+}
+
+// Reports per-invocation latency percentiles, throughput, and the peak memory
+// of the device allocator as user counters on the benchmark |state|. These end
+// up in the JSON output next to the timing (and in every repetition aggregate)
+// so that benchmark tooling can track tail latency and memory regressions.
+// |peak_usage| is the largest per-invocation usage when allocations are
+// tracked and otherwise NULL.
+static void ReportInvocationCounters(
+    std::vector<iree_duration_t>& latencies, iree_hal_device_t* device,
+    const iree_hal_tracking_allocator_usage_t* peak_usage,
+    benchmark::State& state) {
+  if (latencies.empty()) return;
+  std::sort(latencies.begin(), latencies.end());
+  state.counters["p50_latency_ms"] = LatencyPercentileMs(latencies, 0.50);
+  state.counters["p90_latency_ms"] = LatencyPercentileMs(latencies, 0.90);
+  state.counters["p99_latency_ms"] = LatencyPercentileMs(latencies, 0.99);
+  iree_duration_t total_ns = 0;
+  for (iree_duration_t latency : latencies) total_ns += latency;
+  if (total_ns > 0) {
+    state.counters["throughput_per_second"] =
+        latencies.size() / (total_ns / 1e9);
+  }
+  if (peak_usage) {
+    state.counters["peak_host_memory_bytes"] =
+        (double)peak_usage->host_bytes_peak;
+    state.counters["peak_device_memory_bytes"] =
+        (double)peak_usage->device_bytes_peak;
+    state.counters["peak_memory_bytes"] =
+        (double)(peak_usage->host_bytes_peak + peak_usage->device_bytes_peak);
+    return;
+  }
+#if IREE_STATISTICS_ENABLE
+  // Peak since the device was created; this covers all prior repetitions.
+  iree_hal_allocator_statistics_t statistics;
+  iree_hal_allocator_query_statistics(iree_hal_device_allocator(device),
+                                      &statistics);
+  state.counters["peak_memory_bytes"] =
+      (double)(statistics.host_bytes_peak + statistics.device_bytes_peak);
+#endif  // IREE_STATISTICS_ENABLE
+}
+
 static void BenchmarkGenericFunction(const std::string& benchmark_name,
                                      int batch_size, iree_vm_context_t* context,
                                      iree_vm_function_t function,
@@ -145,18 +239,40 @@ static void BenchmarkGenericFunction(const std::string& benchmark_name,
   IREE_CHECK_OK(iree_vm_list_create(/*element_type=*/nullptr, 16,
                                     iree_allocator_system(), &outputs));
 
+  // When tracking allocations the peak is reset before each invocation so that
+  // the reported peak is that of the worst single invocation (including any
+  // memory that was live before it, such as inputs and constants).
+  iree_hal_allocator_t* allocator = iree_hal_device_allocator(device);
+  const bool track_allocations = iree_hal_tracking_allocator_isa(allocator);
+  iree_hal_tracking_allocator_usage_t peak_usage = {0};
+
   // Benchmarking loop.
+  std::vector<iree_duration_t> latencies;
   while (state.KeepRunningBatch(batch_size)) {
     IREE_TRACE_SCOPE0("BenchmarkIteration");
     IREE_TRACE_FRAME_MARK_NAMED("Iteration");
+    if (track_allocations) iree_hal_tracking_allocator_reset_peak(allocator);
+    const iree_time_t start_ns = iree_time_now();
     IREE_CHECK_OK(iree_vm_invoke(
         context, function, IREE_VM_INVOCATION_FLAG_NONE, /*policy=*/nullptr,
         inputs, outputs.get(), iree_allocator_system()));
     IREE_CHECK_OK(iree_vm_list_resize(outputs.get(), 0));
+    latencies.push_back(iree_time_now() - start_ns);
+    if (track_allocations) {
+      iree_hal_tracking_allocator_usage_t usage;
+      iree_hal_tracking_allocator_query_usage(allocator, &usage);
+      peak_usage.host_bytes_peak =
+          std::max(peak_usage.host_bytes_peak, usage.host_bytes_peak);
+      peak_usage.device_bytes_peak =
+          std::max(peak_usage.device_bytes_peak, usage.device_bytes_peak);
+    }
   }
 
   // Force a full flush and get the device back to an idle state.
   IREE_CHECK_OK(iree_hal_device_wait_idle(device, iree_infinite_timeout()));
+
+  ReportInvocationCounters(latencies, device,
+                           track_allocations ? &peak_usage : nullptr, state);
 }
 
 void RegisterGenericBenchmark(const std::string& function_name,
@@ -247,6 +363,168 @@ void RegisterDispatchBenchmark(const std::string& function_name,
       ->Unit(benchmark::kMicrosecond);
 }
 
+//===----------------------------------------------------------------------===//
+// Concurrent load testing
+//===----------------------------------------------------------------------===//
+
+// A function to be run under load along with the arguments to pass it.
+struct LoadFunction {
+  std::string name;
+  iree_vm_function_t function;
+  vm::ref<iree_vm_list_t> inputs;
+  // Number of logical items processed per request (dispatch batching).
+  int32_t batch_size;
+};
+
+// Per-client load test state and results.
+struct LoadClient {
+  iree_vm_context_t* context = nullptr;
+  // Latencies in nanoseconds of each request issued after warmup.
+  std::vector<iree_duration_t> latencies;
+  iree_status_t status = iree_ok_status();
+};
+
+// Runs requests against |client->context| until |end_ns|.
+// In open-loop mode requests are scheduled every |interval_ns| starting at
+// |first_issue_ns| and in closed-loop mode (|interval_ns| == 0) they are issued
+// back-to-back. Only requests issued at or after |measure_start_ns| are
+// recorded.
+static void RunLoadClient(const LoadFunction& load_function,
+                          std::mutex* context_mutex, iree_time_t first_issue_ns,
+                          iree_duration_t interval_ns,
+                          iree_time_t measure_start_ns, iree_time_t end_ns,
+                          LoadClient* client) {
+  IREE_TRACE_SCOPE0("RunLoadClient");
+  vm::ref<iree_vm_list_t> outputs;
+  client->status = iree_vm_list_create(/*element_type=*/nullptr, 16,
+                                       iree_allocator_system(), &outputs);
+  iree_time_t next_issue_ns = first_issue_ns;
+  while (iree_status_is_ok(client->status)) {
+    iree_time_t issue_ns = 0;
+    if (interval_ns > 0) {
+      // Clients that fall behind the schedule stop at the end of the test
+      // instead of draining their backlog.
+      if (next_issue_ns >= end_ns || iree_time_now() >= end_ns) break;
+      iree_wait_until(next_issue_ns);
+      issue_ns = next_issue_ns;
+      next_issue_ns += interval_ns;
+    } else {
+      issue_ns = iree_time_now();
+      if (issue_ns >= end_ns) break;
+    }
+
+    {
+      IREE_TRACE_SCOPE0("LoadRequest");
+      std::unique_lock<std::mutex> lock;
+      if (context_mutex) lock = std::unique_lock<std::mutex>(*context_mutex);
+      client->status = iree_vm_invoke(
+          client->context, load_function.function, IREE_VM_INVOCATION_FLAG_NONE,
+          /*policy=*/nullptr, load_function.inputs.get(), outputs.get(),
+          iree_allocator_system());
+    }
+    if (iree_status_is_ok(client->status)) {
+      client->status = iree_vm_list_resize(outputs.get(), 0);
+    }
+
+    const iree_time_t complete_ns = iree_time_now();
+    if (issue_ns >= measure_start_ns) {
+      client->latencies.push_back(complete_ns - issue_ns);
+    }
+  }
+}
+
+// Runs |load_function| with one client per context in |contexts|.
+// If |shared_context| is true all clients use the first context and are
+// serialized.
+static iree_status_t RunLoadTest(const LoadFunction& load_function,
+                                 iree::span<iree_vm_context_t* const> contexts,
+                                 int32_t client_count, bool shared_context,
+                                 iree_hal_device_t* device) {
+  IREE_TRACE_SCOPE_DYNAMIC(load_function.name.c_str());
+
+  const double target_qps = FLAG_load_target_qps;
+  const iree_duration_t warmup_ns = FLAG_load_warmup_ms * 1000000ll;
+  const iree_duration_t duration_ns = FLAG_load_duration_ms * 1000000ll;
+  if (target_qps < 0.0 || warmup_ns < 0 || duration_ns <= 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "load test qps/warmup must be >= 0 and duration "
+                            "must be > 0");
+  }
+
+  // Clients are staggered across the request interval so that the aggregate
+  // request rate is uniform.
+  const iree_duration_t interval_ns =
+      target_qps > 0.0
+          ? std::max((iree_duration_t)(1e9 * client_count / target_qps),
+                     (iree_duration_t)1)
+          : 0;
+  const iree_time_t start_ns = iree_time_now();
+  const iree_time_t measure_start_ns = start_ns + warmup_ns;
+  const iree_time_t end_ns = measure_start_ns + duration_ns;
+
+  std::mutex context_mutex;
+  std::vector<LoadClient> clients(client_count);
+  std::vector<std::thread> threads;
+  threads.reserve(client_count);
+  for (int32_t i = 0; i < client_count; ++i) {
+    clients[i].context = contexts[shared_context ? 0 : i];
+    threads.emplace_back(RunLoadClient, std::cref(load_function),
+                         shared_context ? &context_mutex : nullptr,
+                         start_ns + (interval_ns * i) / client_count,
+                         interval_ns, measure_start_ns, end_ns, &clients[i]);
+  }
+  for (auto& thread : threads) thread.join();
+  const iree_time_t complete_ns = iree_time_now();
+
+  // Force a full flush and get the device back to an idle state.
+  iree_status_t status =
+      iree_hal_device_wait_idle(device, iree_infinite_timeout());
+
+  std::vector<iree_duration_t> latencies;
+  for (auto& client : clients) {
+    status = iree_status_join(status, client.status);
+    latencies.insert(latencies.end(), client.latencies.begin(),
+                     client.latencies.end());
+  }
+  IREE_RETURN_IF_ERROR(status, "running load test for %s",
+                       load_function.name.c_str());
+  std::sort(latencies.begin(), latencies.end());
+
+  // Requests issued before the end may complete after it so throughput is
+  // measured over the time until the last one completed.
+  const double measured_s = (complete_ns - measure_start_ns) / 1e9;
+  const double request_rate = latencies.size() / measured_s;
+  double mean_ms = 0.0;
+  for (iree_duration_t latency : latencies) mean_ms += latency / 1e6;
+  if (!latencies.empty()) mean_ms /= latencies.size();
+
+  fprintf(stdout, "LOAD_%s\n", load_function.name.c_str());
+  if (target_qps > 0.0) {
+    fprintf(stdout, "  clients: %d (%s), open-loop at %.2f qps\n",
+            client_count, shared_context ? "shared context" : "own contexts",
+            target_qps);
+  } else {
+    fprintf(stdout, "  clients: %d (%s), closed-loop\n", client_count,
+            shared_context ? "shared context" : "own contexts");
+  }
+  fprintf(stdout, "  requests: %zu in %.3fs\n", latencies.size(), measured_s);
+  fprintf(stdout, "  throughput: %.2f requests/s", request_rate);
+  if (load_function.batch_size > 1) {
+    fprintf(stdout, " (%.2f items/s)", request_rate * load_function.batch_size);
+  }
+  fprintf(stdout, "\n");
+  fprintf(stdout,
+          "  latency (ms): mean=%.3f p50=%.3f p90=%.3f p99=%.3f p999=%.3f "
+          "max=%.3f\n",
+          mean_ms, LatencyPercentileMs(latencies, 0.50),
+          LatencyPercentileMs(latencies, 0.90),
+          LatencyPercentileMs(latencies, 0.99),
+          LatencyPercentileMs(latencies, 0.999),
+          latencies.empty() ? 0.0 : latencies.back() / 1e6);
+  fflush(stdout);
+  return iree_ok_status();
+}
+
 iree_status_t GetModuleContentsFromFlags(iree_file_contents_t** out_contents) {
   IREE_TRACE_SCOPE0("GetModuleContentsFromFlags");
   auto module_file = std::string(FLAG_module_file);
@@ -254,8 +532,8 @@ iree_status_t GetModuleContentsFromFlags(iree_file_contents_t** out_contents) {
     std::cout << "Reading module contents from stdin...\n";
     return iree_stdin_read_contents(iree_allocator_system(), out_contents);
   } else {
-    return iree_file_read_contents(module_file.c_str(), iree_allocator_system(),
-                                   out_contents);
+    return iree_file_map_contents(module_file.c_str(), iree_allocator_system(),
+                                  out_contents);
   }
 }
 
@@ -273,16 +551,26 @@ class IREEBenchmark {
     IREE_TRACE_SCOPE0("IREEBenchmark::dtor");
 
     // Order matters.
+    load_functions_.clear();
     inputs_.reset();
     iree_vm_context_release(context_);
     iree_vm_module_release(hal_module_);
     iree_vm_module_release(input_module_);
+    if (device_) {
+      IREE_CHECK_OK(iree_hal_end_profiling_from_flags(device_));
+    }
     if (FLAG_print_statistics) {
-      IREE_IGNORE_ERROR(iree_hal_allocator_statistics_fprint(
-          stderr, iree_hal_device_allocator(device_)));
+      iree_hal_allocator_t* allocator = iree_hal_device_allocator(device_);
+      IREE_IGNORE_ERROR(
+          iree_hal_allocator_statistics_fprint(stderr, allocator));
+      if (iree_hal_tracking_allocator_isa(allocator)) {
+        IREE_IGNORE_ERROR(
+            iree_hal_tracking_allocator_fprint(stderr, allocator));
+      }
     }
     iree_hal_device_release(device_);
     iree_vm_instance_release(instance_);
+    iree_dynamic_library_release(native_library_);
   };
 
   iree_status_t Register() {
@@ -301,7 +589,75 @@ class IREEBenchmark {
     return iree_ok_status();
   }
 
+  // Runs a load test for each function selected by Register.
+  iree_status_t RunLoadTests() {
+    IREE_TRACE_SCOPE0("IREEBenchmark::RunLoadTests");
+    const int32_t client_count = FLAG_load_clients;
+    const bool shared_context = FLAG_load_shared_context;
+
+    // Each client gets its own context (and thus module state) unless shared.
+    // The main context is used by the first client.
+    std::vector<iree_vm_context_t*> contexts = {context_};
+    iree_status_t status = iree_ok_status();
+    if (!shared_context) {
+      std::array<iree_vm_module_t*, 2> modules = {hal_module_, input_module_};
+      for (int32_t i = 1; i < client_count && iree_status_is_ok(status); ++i) {
+        iree_vm_context_t* context = nullptr;
+        status = iree_vm_context_create_with_modules(
+            instance_, IREE_VM_CONTEXT_FLAG_NONE, modules.size(),
+            modules.data(), iree_allocator_system(), &context);
+        if (iree_status_is_ok(status)) contexts.push_back(context);
+      }
+    }
+
+    for (size_t i = 0; i < load_functions_.size() && iree_status_is_ok(status);
+         ++i) {
+      status = RunLoadTest(load_functions_[i],
+                           iree::span<iree_vm_context_t* const>(
+                               contexts.data(), contexts.size()),
+                           client_count, shared_context, device_);
+    }
+
+    for (size_t i = 1; i < contexts.size(); ++i) {
+      iree_vm_context_release(contexts[i]);
+    }
+    return status;
+  }
+
  private:
+  // Registers a benchmark for a function taking |inputs| (or nothing if null)
+  // or in load test mode adds it to the functions to load test.
+  iree_status_t AddGenericFunction(const std::string& function_name,
+                                   iree_vm_function_t function,
+                                   iree_vm_list_t* inputs) {
+    if (FLAG_load_clients <= 0) {
+      RegisterGenericBenchmark(function_name, context_, function, inputs,
+                               device_);
+      return iree_ok_status();
+    }
+    load_functions_.push_back(
+        {function_name, function, vm::retain_ref(inputs), 1});
+    return iree_ok_status();
+  }
+
+  // Registers a benchmark for a dispatch benchmark function taking a batch
+  // size or in load test mode adds it to the functions to load test.
+  iree_status_t AddDispatchFunction(const std::string& function_name,
+                                    iree_vm_function_t function) {
+    if (FLAG_load_clients <= 0) {
+      RegisterDispatchBenchmark(function_name, context_, function, device_);
+      return iree_ok_status();
+    }
+    vm::ref<iree_vm_list_t> inputs;
+    IREE_RETURN_IF_ERROR(iree_vm_list_create(
+        /*element_type=*/nullptr, 1, iree_allocator_system(), &inputs));
+    iree_vm_value_t batch_size = iree_vm_value_make_i32(FLAG_batch_size);
+    IREE_RETURN_IF_ERROR(iree_vm_list_push_value(inputs.get(), &batch_size));
+    load_functions_.push_back({function_name, function,
+                               std::move(inputs), FLAG_batch_size});
+    return iree_ok_status();
+  }
+
   iree_status_t Init() {
     IREE_TRACE_SCOPE0("IREEBenchmark::Init");
     IREE_TRACE_FRAME_MARK_BEGIN_NAMED("init");
@@ -317,12 +673,22 @@ class IREEBenchmark {
     // Create IREE's device and module.
     IREE_RETURN_IF_ERROR(iree_hal_create_device_from_flags(
         iree_hal_default_device_uri(), iree_allocator_system(), &device_));
+    if (FLAG_track_allocations) {
+      // Wrap the device allocator before anything is allocated from it so that
+      // all program allocations are tracked and tagged by the HAL module.
+      iree_hal_allocator_t* tracking_allocator = NULL;
+      IREE_RETURN_IF_ERROR(iree_hal_tracking_allocator_create(
+          iree_hal_device_allocator(device_), iree_allocator_system(),
+          &tracking_allocator));
+      iree_hal_device_replace_allocator(device_, tracking_allocator);
+      iree_hal_allocator_release(tracking_allocator);
+    }
     IREE_RETURN_IF_ERROR(
         iree_hal_module_create(device_, iree_allocator_system(), &hal_module_));
-    IREE_RETURN_IF_ERROR(iree_vm_bytecode_module_create(
+    IREE_RETURN_IF_ERROR(iree_tooling_create_bytecode_module_from_flags(
         flatbuffer_contents->const_buffer,
         iree_file_contents_deallocator(flatbuffer_contents),
-        iree_allocator_system(), &input_module_));
+        iree_allocator_system(), &native_library_, &input_module_));
 
     // Order matters. The input module will likely be dependent on the hal
     // module.
@@ -331,6 +697,10 @@ class IREEBenchmark {
         instance_, IREE_VM_CONTEXT_FLAG_NONE, modules.size(), modules.data(),
         iree_allocator_system(), &context_));
 
+    // Profiling captures all benchmark iterations and is written when the
+    // benchmark is torn down.
+    IREE_RETURN_IF_ERROR(iree_hal_begin_profiling_from_flags(device_));
+
     IREE_TRACE_FRAME_MARK_END_NAMED("init");
     return iree_ok_status();
   }
@@ -349,9 +719,7 @@ class IREEBenchmark {
         iree::span<const std::string>{FLAG_function_inputs.data(),
                                       FLAG_function_inputs.size()},
         &inputs_));
-    RegisterGenericBenchmark(function_name, context_, function, inputs_.get(),
-                             device_);
-    return iree_ok_status();
+    return AddGenericFunction(function_name, function, inputs_.get());
   }
 
   iree_status_t RegisterAllExportedFunctions() {
@@ -369,14 +737,12 @@ class IREEBenchmark {
       iree_string_view_t benchmark_type = iree_vm_function_lookup_attr_by_name(
           &function, IREE_SV("iree.benchmark"));
       if (iree_string_view_equal(benchmark_type, IREE_SV("dispatch"))) {
-        iree::RegisterDispatchBenchmark(
-            std::string(function_name.data, function_name.size), context_,
-            function, device_);
+        IREE_RETURN_IF_ERROR(AddDispatchFunction(
+            std::string(function_name.data, function_name.size), function));
       } else if (iree_string_view_equal(benchmark_type, IREE_SV("entry"))) {
-        iree::RegisterGenericBenchmark(
-            std::string(function_name.data, function_name.size), context_,
-            function,
-            /*inputs=*/nullptr, device_);
+        IREE_RETURN_IF_ERROR(AddGenericFunction(
+            std::string(function_name.data, function_name.size), function,
+            /*inputs=*/nullptr));
       } else {
         // Pick up generic () -> () functions.
         if (iree_string_view_starts_with(function_name,
@@ -399,10 +765,9 @@ class IREEBenchmark {
           continue;
         }
 
-        iree::RegisterGenericBenchmark(
-            std::string(function_name.data, function_name.size), context_,
-            function,
-            /*inputs=*/nullptr, device_);
+        IREE_RETURN_IF_ERROR(AddGenericFunction(
+            std::string(function_name.data, function_name.size), function,
+            /*inputs=*/nullptr));
       }
     }
     return iree_ok_status();
@@ -413,7 +778,9 @@ class IREEBenchmark {
   iree_vm_module_t* hal_module_ = nullptr;
   iree_vm_context_t* context_ = nullptr;
   iree_vm_module_t* input_module_ = nullptr;
+  iree_dynamic_library_t* native_library_ = nullptr;
   iree::vm::ref<iree_vm_list_t> inputs_;
+  std::vector<LoadFunction> load_functions_;
 };
 }  // namespace
 }  // namespace iree
@@ -429,11 +796,15 @@ int main(int argc, char** argv) {
 
   iree::IREEBenchmark iree_benchmark;
   iree_status_t status = iree_benchmark.Register();
+  if (iree_status_is_ok(status) && FLAG_load_clients > 0) {
+    status = iree_benchmark.RunLoadTests();
+  } else if (iree_status_is_ok(status)) {
+    ::benchmark::RunSpecifiedBenchmarks();
+  }
   if (!iree_status_is_ok(status)) {
     int ret = static_cast<int>(iree_status_code(status));
     std::cout << iree::Status(std::move(status)) << std::endl;
     return ret;
   }
-  ::benchmark::RunSpecifiedBenchmarks();
   return 0;
 }
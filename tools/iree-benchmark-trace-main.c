@@ -14,6 +14,7 @@
 #include "iree/base/api.h"
 #include "iree/base/internal/flags.h"
 #include "iree/base/internal/path.h"
+#include "iree/base/internal/threading.h"
 #include "iree/hal/api.h"
 #include "iree/testing/benchmark.h"
 #include "iree/tooling/device_util.h"
@@ -28,6 +29,17 @@ IREE_FLAG(int32_t, call_iterations, 1,
           "Number of times to invoke each call in the trace. May break usage "
           "with stateful models.");
 
+IREE_FLAG(bool, replay_realtime, false,
+          "Delays calls with a recorded `timestamp_ns` to reproduce the\n"
+          "inter-arrival timing of the recorded trace in each iteration.");
+
+IREE_FLAG(int32_t, replay_threads, 1,
+          "Number of threads each replaying the trace concurrently in their\n"
+          "own context during each benchmark iteration.");
+
+IREE_FLAG(bool, print_call_latency, false,
+          "Prints a per-call latency report to stdout after each benchmark.");
+
 // A benchmark registration for each file to run.
 typedef struct iree_replay_benchmark_registration_t {
   iree_benchmark_def_t benchmark_def;  // Must be first.
@@ -43,6 +55,8 @@ typedef struct iree_replay_benchmark_registration_t {
 // A parsed call event from the trace file.
 typedef struct iree_replay_benchmark_call_t {
   iree_vm_function_t function;
+  // Recorded time of the call relative to the start of the trace or -1.
+  iree_duration_t timestamp_ns;
   iree_vm_list_t* input_list;
   iree_vm_list_t* output_list;
 } iree_replay_benchmark_call_t;
@@ -101,6 +115,8 @@ static iree_status_t iree_replay_benchmark_prepare_call(
   // Prepare the call event state.
   IREE_RETURN_IF_ERROR(iree_trace_replay_event_call_prepare(
       replay, document, event_node, &call->function, &call->input_list));
+  IREE_RETURN_IF_ERROR(iree_trace_replay_event_call_timestamp(
+      document, event_node, &call->timestamp_ns));
 
   // To avoid allocations in the inner benchmark loop we preallocate the outputs
   // here. To avoid a memory leak we'll need to trim it as soon as the call
@@ -188,19 +204,26 @@ static iree_status_t iree_replay_benchmark_load_trace(
   return status;
 }
 
-// Benchmark function that runs a trace file.
-static iree_status_t iree_replay_benchmark_run_file(
-    const iree_benchmark_def_t* benchmark_def,
-    iree_benchmark_state_t* benchmark_state) {
-  const iree_replay_benchmark_registration_t* registration =
-      (const iree_replay_benchmark_registration_t*)benchmark_def->user_data;
-
-  // Setup replay state used for this benchmark.
+// A replay of a trace file in its own context. Each benchmark thread owns one.
+typedef struct iree_replay_benchmark_worker_t {
   iree_trace_replay_t replay;
+  iree_replay_benchmark_call_list_t call_list;
+  iree_trace_replay_call_stats_t call_stats;
+  // Status of the last run on the worker thread.
+  iree_status_t status;
+} iree_replay_benchmark_worker_t;
+
+// Initializes |worker| by loading the trace with all modules ready for calls.
+static iree_status_t iree_replay_benchmark_worker_initialize(
+    const iree_replay_benchmark_registration_t* registration,
+    iree_replay_benchmark_worker_t* worker) {
+  memset(worker, 0, sizeof(*worker));
   IREE_RETURN_IF_ERROR(iree_trace_replay_initialize(
       registration->root_path, registration->instance,
       IREE_VM_CONTEXT_FLAG_NONE, iree_hal_available_driver_registry(),
-      iree_allocator_system(), &replay));
+      iree_allocator_system(), &worker->replay));
+  iree_trace_replay_call_stats_initialize(iree_allocator_system(),
+                                          &worker->call_stats);
 
   // Query device overrides, if any. When omitted the devices from the trace
   // file will be used.
@@ -208,35 +231,141 @@ static iree_status_t iree_replay_benchmark_run_file(
   iree_host_size_t device_uri_count = 0;
   iree_string_view_t* device_uris = NULL;
   iree_hal_get_devices_flag_list(&device_uri_count, &device_uris);
-  iree_trace_replay_set_hal_devices_override(&replay, device_uri_count,
+  iree_trace_replay_set_hal_devices_override(&worker->replay, device_uri_count,
                                              device_uris);
 
   // Load YAML file and setup replay state with all modules loaded and ready.
-  iree_replay_benchmark_call_list_t call_list;
-  iree_replay_benchmark_call_list_initialize(&call_list);
-  IREE_RETURN_IF_ERROR(iree_replay_benchmark_load_trace(registration->file_path,
-                                                        &replay, &call_list));
+  iree_replay_benchmark_call_list_initialize(&worker->call_list);
+  return iree_replay_benchmark_load_trace(registration->file_path,
+                                          &worker->replay, &worker->call_list);
+}
+
+static void iree_replay_benchmark_worker_deinitialize(
+    iree_replay_benchmark_worker_t* worker) {
+  iree_replay_benchmark_call_list_deinitialize(&worker->call_list);
+  iree_trace_replay_call_stats_deinitialize(&worker->call_stats);
+  iree_trace_replay_deinitialize(
+      &worker->replay, FLAG_print_statistics
+                           ? IREE_TRACE_REPLAY_SHUTDOWN_PRINT_STATISTICS
+                           : IREE_TRACE_REPLAY_SHUTDOWN_QUIET);
+}
+
+// Calls the functions within the trace in order once.
+static iree_status_t iree_replay_benchmark_worker_run(
+    iree_replay_benchmark_worker_t* worker) {
+  iree_time_t start_time_ns = iree_time_now();
+  iree_duration_t start_timestamp_ns = -1;
+  for (size_t i = 0; i < worker->call_list.count; ++i) {
+    iree_replay_benchmark_call_t* call = &worker->call_list.items[i];
+    if (FLAG_replay_realtime && call->timestamp_ns >= 0) {
+      // Pace calls relative to the first timestamped call of the iteration.
+      if (start_timestamp_ns < 0) start_timestamp_ns = call->timestamp_ns;
+      iree_wait_until(start_time_ns +
+                      (call->timestamp_ns - start_timestamp_ns));
+    }
+    for (int32_t j = 0; j < FLAG_call_iterations; ++j) {
+      iree_time_t call_start_ns = iree_time_now();
+      IREE_RETURN_IF_ERROR(iree_vm_invoke(
+          worker->replay.context, call->function, IREE_VM_INVOCATION_FLAG_NONE,
+          /*policy=*/NULL, call->input_list, call->output_list,
+          worker->replay.host_allocator));
+      if (FLAG_print_call_latency) {
+        IREE_RETURN_IF_ERROR(iree_trace_replay_call_stats_append(
+            &worker->call_stats, iree_time_now() - call_start_ns));
+      }
+      IREE_RETURN_IF_ERROR(iree_vm_list_resize(call->output_list, 0));
+    }
+  }
+  return iree_ok_status();
+}
+
+static int iree_replay_benchmark_worker_main(void* entry_arg) {
+  iree_replay_benchmark_worker_t* worker =
+      (iree_replay_benchmark_worker_t*)entry_arg;
+  worker->status = iree_replay_benchmark_worker_run(worker);
+  return 0;
+}
 
-  // Call the functions within the trace in order.
+// Runs each worker once on its own thread and waits for all to complete.
+static iree_status_t iree_replay_benchmark_run_workers(
+    iree_host_size_t worker_count, iree_replay_benchmark_worker_t* workers,
+    iree_thread_t** threads) {
+  iree_status_t status = iree_ok_status();
+  iree_host_size_t thread_count = 0;
+  for (; thread_count < worker_count; ++thread_count) {
+    iree_thread_create_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.name = iree_make_cstring_view("iree-benchmark-trace");
+    status = iree_thread_create(
+        iree_replay_benchmark_worker_main, &workers[thread_count], params,
+        iree_allocator_system(), &threads[thread_count]);
+    if (!iree_status_is_ok(status)) break;
+  }
+  // Releasing the threads joins them.
+  for (iree_host_size_t i = 0; i < thread_count; ++i) {
+    iree_thread_release(threads[i]);
+    threads[i] = NULL;
+    if (iree_status_is_ok(status)) {
+      status = workers[i].status;
+    } else {
+      iree_status_ignore(workers[i].status);
+    }
+    workers[i].status = iree_ok_status();
+  }
+  return status;
+}
+
+// Benchmark function that runs a trace file.
+static iree_status_t iree_replay_benchmark_run_file(
+    const iree_benchmark_def_t* benchmark_def,
+    iree_benchmark_state_t* benchmark_state) {
+  const iree_replay_benchmark_registration_t* registration =
+      (const iree_replay_benchmark_registration_t*)benchmark_def->user_data;
+
+  // Setup replay state for each thread used for this benchmark.
+  iree_host_size_t worker_count =
+      FLAG_replay_threads > 1 ? (iree_host_size_t)FLAG_replay_threads : 1;
+  iree_replay_benchmark_worker_t* workers =
+      (iree_replay_benchmark_worker_t*)calloc(worker_count, sizeof(*workers));
+  iree_thread_t** threads =
+      (iree_thread_t**)calloc(worker_count, sizeof(*threads));
+  for (iree_host_size_t i = 0; i < worker_count; ++i) {
+    IREE_RETURN_IF_ERROR(
+        iree_replay_benchmark_worker_initialize(registration, &workers[i]));
+  }
+
+  int64_t call_count = 0;
+  iree_time_t start_time_ns = iree_time_now();
   while (iree_benchmark_keep_running(benchmark_state,
                                      /*batch_count=*/FLAG_call_iterations)) {
-    for (size_t i = 0; i < call_list.count; ++i) {
-      iree_replay_benchmark_call_t* call = &call_list.items[i];
-      for (int32_t j = 0; j < FLAG_call_iterations; ++j) {
-        IREE_RETURN_IF_ERROR(iree_vm_invoke(
-            replay.context, call->function, IREE_VM_INVOCATION_FLAG_NONE,
-            /*policy=*/NULL, call->input_list, call->output_list,
-            replay.host_allocator));
-        IREE_RETURN_IF_ERROR(iree_vm_list_resize(call->output_list, 0));
-      }
+    if (worker_count == 1) {
+      IREE_RETURN_IF_ERROR(iree_replay_benchmark_worker_run(&workers[0]));
+    } else {
+      IREE_RETURN_IF_ERROR(
+          iree_replay_benchmark_run_workers(worker_count, workers, threads));
     }
+    call_count += (int64_t)(worker_count * workers[0].call_list.count *
+                            FLAG_call_iterations);
   }
+  iree_duration_t wall_time_ns = iree_time_now() - start_time_ns;
+  iree_benchmark_set_items_processed(benchmark_state, call_count);
 
-  iree_replay_benchmark_call_list_deinitialize(&call_list);
-  iree_trace_replay_deinitialize(
-      &replay, FLAG_print_statistics
-                   ? IREE_TRACE_REPLAY_SHUTDOWN_PRINT_STATISTICS
-                   : IREE_TRACE_REPLAY_SHUTDOWN_QUIET);
+  if (FLAG_print_call_latency) {
+    for (iree_host_size_t i = 1; i < worker_count; ++i) {
+      IREE_RETURN_IF_ERROR(iree_trace_replay_call_stats_merge(
+          &workers[0].call_stats, &workers[i].call_stats));
+    }
+    fprintf(stdout, "%.*s: ", (int)registration->file_path.size,
+            registration->file_path.data);
+    iree_trace_replay_call_stats_fprint(stdout, &workers[0].call_stats,
+                                        wall_time_ns);
+  }
+
+  for (iree_host_size_t i = 0; i < worker_count; ++i) {
+    iree_replay_benchmark_worker_deinitialize(&workers[i]);
+  }
+  free(threads);
+  free(workers);
   return iree_ok_status();
 }
 
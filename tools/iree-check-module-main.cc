@@ -98,9 +98,9 @@ iree_status_t Run(std::string module_file_path, int* out_exit_code) {
     IREE_RETURN_IF_ERROR(iree_stdin_read_contents(iree_allocator_system(),
                                                   &flatbuffer_contents));
   } else {
-    IREE_RETURN_IF_ERROR(iree_file_read_contents(module_file_path.c_str(),
-                                                 iree_allocator_system(),
-                                                 &flatbuffer_contents));
+    IREE_RETURN_IF_ERROR(iree_file_map_contents(module_file_path.c_str(),
+                                                iree_allocator_system(),
+                                                &flatbuffer_contents));
   }
 
   iree_vm_module_t* input_module = nullptr;
@@ -24,6 +24,20 @@
 
 IREE_FLAG(bool, trace_execution, false, "Traces VM execution to stderr.");
 
+IREE_FLAG(string, benchmark_csv, "",
+          "Enables performance mode: each matmul that passes its correctness\n"
+          "check is then timed and a row with its shape, element types and\n"
+          "throughput is appended to the CSV file at the given path. The\n"
+          "header row is written if the file is empty.");
+IREE_FLAG(int32_t, benchmark_repetitions, 10,
+          "Number of timed invocations of each matmul in performance mode.");
+IREE_FLAG(double, benchmark_peak_gflops, 0.0,
+          "Theoretical peak GFLOP/s of the target device. When non-zero the\n"
+          "fraction of peak achieved by each matmul is reported.");
+IREE_FLAG(string, benchmark_label, "",
+          "Free-form value of the label column of the CSV rows, such as the\n"
+          "thread count the device was configured with in a sweep.");
+
 static const char* emoji(bool good) { return good ? "🦄" : "🐞"; }
 
 /*****************************************************************************
@@ -956,6 +970,127 @@ static iree_status_t print_matmul_shape(FILE* file,
   return iree_ok_status();
 }
 
+// Formats |element_type| into |buffer| as a NUL-terminated string.
+static void format_element_type(iree_hal_element_type_t element_type,
+                                char buffer[16]) {
+  iree_host_size_t length = 0;
+  iree_status_t status =
+      iree_hal_format_element_type(element_type, 15, buffer, &length);
+  if (!iree_status_is_ok(status)) {
+    iree_status_ignore(status);
+    length = 0;
+  }
+  buffer[length] = 0;
+}
+
+// Appends a row to the --benchmark_csv file, writing the header first if the
+// file is empty.
+static iree_status_t append_benchmark_csv_row(
+    iree_string_view_t function_name, iree_hal_buffer_view_t* lhs,
+    iree_hal_buffer_view_t* rhs, iree_hal_buffer_view_t* acc,
+    iree_hal_dim_t m_size, iree_hal_dim_t k_size, iree_hal_dim_t n_size,
+    double mean_seconds, double min_seconds) {
+  FILE* file = fopen(FLAG_benchmark_csv, "ab");
+  if (!file) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to open benchmark CSV file '%s'",
+                            FLAG_benchmark_csv);
+  }
+  fseek(file, 0, SEEK_END);
+  if (ftell(file) == 0) {
+    fprintf(file,
+            "label,function,lhs_type,rhs_type,acc_type,m,k,n,repetitions,"
+            "mean_us,min_us,gflops,peak_fraction\n");
+  }
+  char lhs_type[16], rhs_type[16], acc_type[16];
+  format_element_type(iree_hal_buffer_view_element_type(lhs), lhs_type);
+  format_element_type(iree_hal_buffer_view_element_type(rhs), rhs_type);
+  format_element_type(iree_hal_buffer_view_element_type(acc), acc_type);
+  // Throughput is reported for the fastest repetition, which is the least
+  // perturbed by the host and the closest to what the kernel can achieve.
+  double flop_count = 2.0 * m_size * k_size * n_size;
+  double gflops = min_seconds > 0.0 ? flop_count / min_seconds * 1e-9 : 0.0;
+  fprintf(file,
+          "%s,%.*s,%s,%s,%s,%" PRIdim ",%" PRIdim ",%" PRIdim ",%d,%.3f,%.3f,"
+          "%.3f,",
+          FLAG_benchmark_label, (int)function_name.size, function_name.data,
+          lhs_type, rhs_type, acc_type, m_size, k_size, n_size,
+          FLAG_benchmark_repetitions, mean_seconds * 1e6, min_seconds * 1e6,
+          gflops);
+  if (FLAG_benchmark_peak_gflops > 0.0) {
+    fprintf(file, "%.4f", gflops / FLAG_benchmark_peak_gflops);
+  }
+  fprintf(file, "\n");
+  fprintf(stderr, "Performance: %.3f GFLOP/s (min %.3f us, mean %.3f us)\n",
+          gflops, min_seconds * 1e6, mean_seconds * 1e6);
+  bool failed = ferror(file) != 0;
+  if (fclose(file) != 0) failed = true;
+  if (failed) {
+    return iree_make_status(IREE_STATUS_DATA_LOSS,
+                            "failed to write benchmark CSV file '%s'",
+                            FLAG_benchmark_csv);
+  }
+  return iree_ok_status();
+}
+
+// Performance mode: times |function| on |input_list| and appends the results
+// to the --benchmark_csv file.
+//
+// The function is invoked on the same inputs every repetition. Functions that
+// update the accumulator in place produce different values each time but their
+// cost does not depend on the values.
+static iree_status_t benchmark_matmul(iree_trace_replay_t* replay,
+                                      iree_string_view_t function_name,
+                                      iree_vm_function_t function,
+                                      iree_vm_list_t* input_list) {
+  if (FLAG_benchmark_repetitions <= 0) {
+    return iree_make_status(IREE_STATUS_INVALID_ARGUMENT,
+                            "--benchmark_repetitions must be positive");
+  }
+  iree_hal_buffer_view_t* lhs = NULL;
+  iree_hal_buffer_view_t* rhs = NULL;
+  iree_hal_buffer_view_t* acc = NULL;
+  IREE_RETURN_IF_ERROR(get_item_as_buffer_view(input_list, 0, &lhs));
+  IREE_RETURN_IF_ERROR(get_item_as_buffer_view(input_list, 1, &rhs));
+  IREE_RETURN_IF_ERROR(get_item_as_buffer_view(input_list, 2, &acc));
+  iree_hal_dim_t lhs_dims[2] = {0};
+  iree_hal_dim_t rhs_dims[2] = {0};
+  IREE_RETURN_IF_ERROR(get_matrix_shape(lhs, lhs_dims));
+  IREE_RETURN_IF_ERROR(get_matrix_shape(rhs, rhs_dims));
+
+  iree_vm_list_t* outputs = NULL;
+  IREE_RETURN_IF_ERROR(iree_vm_list_create(/*element_type=*/NULL,
+                                           /*initial_capacity=*/8,
+                                           replay->host_allocator, &outputs));
+  // The correctness check already invoked the function once, warming up the
+  // executable and any lazily allocated resources.
+  iree_status_t status = iree_ok_status();
+  iree_duration_t total_duration = 0;
+  iree_duration_t min_duration = IREE_DURATION_INFINITE;
+  for (int32_t i = 0; i < FLAG_benchmark_repetitions; ++i) {
+    iree_time_t start_time = iree_time_now();
+    status = iree_vm_invoke(replay->context, function,
+                            IREE_VM_INVOCATION_FLAG_NONE,
+                            /*policy=*/NULL, input_list, outputs,
+                            replay->host_allocator);
+    iree_duration_t duration = iree_time_now() - start_time;
+    if (!iree_status_is_ok(status)) break;
+    total_duration += duration;
+    min_duration = iree_min(min_duration, duration);
+    status = iree_vm_list_resize(outputs, 0);
+    if (!iree_status_is_ok(status)) break;
+  }
+  iree_vm_list_release(outputs);
+
+  if (iree_status_is_ok(status)) {
+    status = append_benchmark_csv_row(
+        function_name, lhs, rhs, acc, lhs_dims[0], lhs_dims[1], rhs_dims[1],
+        (double)total_duration / FLAG_benchmark_repetitions * 1e-9,
+        (double)min_duration * 1e-9);
+  }
+  return status;
+}
+
 // Special handler for function calls in a e2e matmul test trace.
 // Assumes that all calls are to functions that take 3 inputs (lhs, rhs, acc)
 // and return the result of a matmul (lhs*rhs+acc).
@@ -1041,6 +1176,10 @@ static iree_status_t replay_event_call_matmul(iree_trace_replay_t* replay,
     iree_string_builder_deinitialize(&sb);
   }
 
+  if (iree_status_is_ok(status) && FLAG_benchmark_csv[0] != 0) {
+    status = benchmark_matmul(replay, function_name, function, device_inputs);
+  }
+
   // Clean up.
   iree_vm_list_release(device_inputs);
 
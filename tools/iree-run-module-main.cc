@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "iree/base/api.h"
+#include "iree/base/internal/dynamic_library.h"
 #include "iree/base/internal/file_io.h"
 #include "iree/base/internal/flags.h"
 #include "iree/base/status_cc.h"
@@ -20,6 +21,7 @@
 #include "iree/hal/api.h"
 #include "iree/modules/hal/module.h"
 #include "iree/tooling/device_util.h"
+#include "iree/tooling/module_util.h"
 #include "iree/tooling/vm_util.h"
 #include "iree/vm/api.h"
 #include "iree/vm/bytecode_module.h"
@@ -74,6 +76,10 @@ IREE_FLAG_CALLBACK(
     "  2x2xi32=@some/file.bin\n"
     "numpy npy files (from numpy.save) can be read to provide 1+ values:\n"
     "  @some.npy\n"
+    "as can uncompressed npz files (from numpy.savez) and safetensors files:\n"
+    "  @some.npz\n"
+    "  @some.safetensors\n"
+    "Files are mapped and used without copies when the device supports it.\n"
     "Each occurrence of the flag indicates an input in the order they were\n"
     "specified on the command line.");
 
@@ -87,8 +93,8 @@ iree_status_t GetModuleContentsFromFlags(iree_file_contents_t** out_contents) {
     std::cout << "Reading module contents from stdin...\n";
     return iree_stdin_read_contents(iree_allocator_system(), out_contents);
   } else {
-    return iree_file_read_contents(module_file.c_str(), iree_allocator_system(),
-                                   out_contents);
+    return iree_file_map_contents(module_file.c_str(), iree_allocator_system(),
+                                  out_contents);
   }
 }
 
@@ -104,11 +110,12 @@ iree_status_t Run() {
 
   iree_file_contents_t* flatbuffer_contents = NULL;
   IREE_RETURN_IF_ERROR(GetModuleContentsFromFlags(&flatbuffer_contents));
+  iree_dynamic_library_t* native_library = nullptr;
   iree_vm_module_t* input_module = nullptr;
-  IREE_RETURN_IF_ERROR(iree_vm_bytecode_module_create(
+  IREE_RETURN_IF_ERROR(iree_tooling_create_bytecode_module_from_flags(
       flatbuffer_contents->const_buffer,
       iree_file_contents_deallocator(flatbuffer_contents),
-      iree_allocator_system(), &input_module));
+      iree_allocator_system(), &native_library, &input_module));
 
   iree_hal_device_t* device = nullptr;
   IREE_RETURN_IF_ERROR(iree_hal_create_device_from_flags(
@@ -154,11 +161,13 @@ iree_status_t Run() {
                                            iree_allocator_system(), &outputs));
 
   std::cout << "EXEC @" << function_name << "\n";
+  IREE_RETURN_IF_ERROR(iree_hal_begin_profiling_from_flags(device));
   IREE_RETURN_IF_ERROR(
       iree_vm_invoke(context, function, IREE_VM_INVOCATION_FLAG_NONE,
                      /*policy=*/nullptr, inputs.get(), outputs.get(),
                      iree_allocator_system()),
       "invoking function '%s'", function_name.c_str());
+  IREE_RETURN_IF_ERROR(iree_hal_end_profiling_from_flags(device));
 
   IREE_RETURN_IF_ERROR(
       PrintVariantList(outputs.get(), (size_t)FLAG_print_max_element_count),
@@ -177,6 +186,7 @@ iree_status_t Run() {
 
   iree_hal_device_release(device);
   iree_vm_instance_release(instance);
+  iree_dynamic_library_release(native_library);
   return iree_ok_status();
 }
 
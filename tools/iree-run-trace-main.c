@@ -11,6 +11,7 @@
 #include "iree/base/api.h"
 #include "iree/base/internal/flags.h"
 #include "iree/base/internal/path.h"
+#include "iree/base/internal/threading.h"
 #include "iree/hal/api.h"
 #include "iree/tooling/device_util.h"
 #include "iree/tooling/trace_replay.h"
@@ -22,17 +23,30 @@ IREE_FLAG(bool, trace_execution, false, "Traces VM execution to stderr.");
 IREE_FLAG(bool, print_statistics, false,
           "Prints runtime statistics to stderr on exit.");
 
+IREE_FLAG(bool, replay_realtime, false,
+          "Delays calls with a recorded `timestamp_ns` to reproduce the\n"
+          "inter-arrival timing of the recorded trace.");
+
+IREE_FLAG(int32_t, replay_threads, 1,
+          "Number of threads each replaying the trace concurrently in their\n"
+          "own context. Call results are not printed when >1.");
+
+IREE_FLAG(bool, print_call_latency, false,
+          "Prints a per-call latency report to stdout after each trace.");
+
 // Runs the trace in |file| using |root_path| as the base for any path lookups
-// required for external files referenced in |file|.
-static iree_status_t iree_run_trace_file(iree_string_view_t root_path,
-                                         FILE* file,
-                                         iree_vm_instance_t* instance) {
+// required for external files referenced in |file|. Call latencies are
+// appended to |stats|.
+static iree_status_t iree_run_trace_file(
+    iree_string_view_t root_path, FILE* file, iree_vm_instance_t* instance,
+    iree_trace_replay_flags_t flags, iree_trace_replay_call_stats_t* stats) {
   iree_trace_replay_t replay;
   IREE_RETURN_IF_ERROR(iree_trace_replay_initialize(
       root_path, instance,
       FLAG_trace_execution ? IREE_VM_CONTEXT_FLAG_TRACE_EXECUTION
                            : IREE_VM_CONTEXT_FLAG_NONE,
       iree_hal_available_driver_registry(), iree_allocator_system(), &replay));
+  iree_trace_replay_set_flags(&replay, flags);
 
   // Query device overrides, if any. When omitted the devices from the trace
   // file will be used.
@@ -69,6 +83,9 @@ static iree_status_t iree_run_trace_file(iree_string_view_t root_path,
   }
 
   yaml_parser_delete(&parser);
+  if (iree_status_is_ok(status)) {
+    status = iree_trace_replay_call_stats_merge(stats, &replay.call_stats);
+  }
   iree_trace_replay_deinitialize(
       &replay, FLAG_print_statistics
                    ? IREE_TRACE_REPLAY_SHUTDOWN_PRINT_STATISTICS
@@ -76,20 +93,119 @@ static iree_status_t iree_run_trace_file(iree_string_view_t root_path,
   return status;
 }
 
+// Opens and runs the trace file at |file_path|.
+static iree_status_t iree_run_trace_file_path(
+    const char* file_path_cstr, iree_vm_instance_t* instance,
+    iree_trace_replay_flags_t flags, iree_trace_replay_call_stats_t* stats) {
+  iree_string_view_t file_path = iree_make_cstring_view(file_path_cstr);
+  iree_string_view_t root_path = iree_file_path_dirname(file_path);
+  FILE* file = fopen(file_path_cstr, "rb");
+  if (!file) {
+    return iree_make_status(iree_status_code_from_errno(errno),
+                            "failed to open trace file '%.*s'",
+                            (int)file_path.size, file_path.data);
+  }
+  iree_status_t status =
+      iree_run_trace_file(root_path, file, instance, flags, stats);
+  fclose(file);
+  return status;
+}
+
+// State for a thread replaying a trace file in its own context.
+typedef struct iree_run_trace_thread_t {
+  const char* file_path;
+  iree_vm_instance_t* instance;
+  iree_trace_replay_flags_t flags;
+  iree_trace_replay_call_stats_t stats;
+  iree_status_t status;
+} iree_run_trace_thread_t;
+
+static int iree_run_trace_thread_main(void* entry_arg) {
+  iree_run_trace_thread_t* thread_state = (iree_run_trace_thread_t*)entry_arg;
+  thread_state->status = iree_run_trace_file_path(
+      thread_state->file_path, thread_state->instance, thread_state->flags,
+      &thread_state->stats);
+  return 0;
+}
+
+// Runs the trace file at |file_path| concurrently on |thread_count| threads.
+// Each thread replays the entire trace in its own context and the call
+// latencies of all threads are merged into |stats|.
+static iree_status_t iree_run_trace_file_parallel(
+    const char* file_path, iree_host_size_t thread_count,
+    iree_vm_instance_t* instance, iree_trace_replay_flags_t flags,
+    iree_trace_replay_call_stats_t* stats) {
+  iree_allocator_t host_allocator = iree_allocator_system();
+  iree_run_trace_thread_t* thread_states = NULL;
+  iree_thread_t** threads = NULL;
+  IREE_RETURN_IF_ERROR(iree_allocator_malloc(
+      host_allocator, thread_count * sizeof(*thread_states),
+      (void**)&thread_states));
+  iree_status_t status = iree_allocator_malloc(
+      host_allocator, thread_count * sizeof(*threads), (void**)&threads);
+
+  for (iree_host_size_t i = 0; i < thread_count; ++i) {
+    thread_states[i].file_path = file_path;
+    thread_states[i].instance = instance;
+    thread_states[i].flags = flags | IREE_TRACE_REPLAY_FLAG_QUIET;
+    iree_trace_replay_call_stats_initialize(host_allocator,
+                                            &thread_states[i].stats);
+    thread_states[i].status = iree_ok_status();
+  }
+  for (iree_host_size_t i = 0; i < thread_count && iree_status_is_ok(status);
+       ++i) {
+    iree_thread_create_params_t params;
+    memset(&params, 0, sizeof(params));
+    params.name = iree_make_cstring_view("iree-run-trace");
+    status = iree_thread_create(iree_run_trace_thread_main, &thread_states[i],
+                                params, host_allocator, &threads[i]);
+  }
+
+  // Releasing the threads joins them.
+  for (iree_host_size_t i = 0; threads && i < thread_count; ++i) {
+    iree_thread_release(threads[i]);
+  }
+  for (iree_host_size_t i = 0; i < thread_count; ++i) {
+    if (iree_status_is_ok(status)) {
+      status = thread_states[i].status;
+    } else {
+      iree_status_ignore(thread_states[i].status);
+    }
+    if (iree_status_is_ok(status)) {
+      status = iree_trace_replay_call_stats_merge(stats,
+                                                  &thread_states[i].stats);
+    }
+    iree_trace_replay_call_stats_deinitialize(&thread_states[i].stats);
+  }
+
+  iree_allocator_free(host_allocator, threads);
+  iree_allocator_free(host_allocator, thread_states);
+  return status;
+}
+
 // Runs each of the given traces files sequentially in isolated contexts.
 static iree_status_t iree_run_trace_files(int file_count, char** file_paths,
                                           iree_vm_instance_t* instance) {
+  iree_trace_replay_flags_t flags = IREE_TRACE_REPLAY_FLAG_NONE;
+  if (FLAG_replay_realtime) flags |= IREE_TRACE_REPLAY_FLAG_REALTIME;
+  iree_host_size_t thread_count =
+      FLAG_replay_threads > 1 ? (iree_host_size_t)FLAG_replay_threads : 1;
   for (int i = 0; i < file_count; ++i) {
     iree_string_view_t file_path = iree_make_cstring_view(file_paths[i]);
-    iree_string_view_t root_path = iree_file_path_dirname(file_path);
-    FILE* file = fopen(file_paths[i], "rb");
-    if (!file) {
-      return iree_make_status(iree_status_code_from_errno(errno),
-                              "failed to open trace file '%.*s'",
-                              (int)file_path.size, file_path.data);
+    iree_trace_replay_call_stats_t stats;
+    iree_trace_replay_call_stats_initialize(iree_allocator_system(), &stats);
+    iree_time_t start_time_ns = iree_time_now();
+    iree_status_t status =
+        thread_count > 1
+            ? iree_run_trace_file_parallel(file_paths[i], thread_count,
+                                           instance, flags, &stats)
+            : iree_run_trace_file_path(file_paths[i], instance, flags, &stats);
+    iree_duration_t wall_time_ns = iree_time_now() - start_time_ns;
+    if (iree_status_is_ok(status) && FLAG_print_call_latency) {
+      fprintf(stdout, "%.*s: ", (int)file_path.size, file_path.data);
+      iree_trace_replay_call_stats_fprint(stdout, &stats, wall_time_ns);
     }
-    iree_status_t status = iree_run_trace_file(root_path, file, instance);
-    fclose(file);
+    iree_trace_replay_call_stats_deinitialize(&stats);
     IREE_RETURN_IF_ERROR(status, "replaying trace file '%.*s'",
                          (int)file_path.size, file_path.data);
   }